@@ -0,0 +1,77 @@
+#include "AKWFCodec.h"
+
+namespace {
+
+// MSB-first bit reader over a 32-bit window; 'avail' valid bits from the top
+struct BitReader {
+    const uint8_t* src;
+    uint32_t       acc   = 0;
+    uint8_t        avail = 0;
+
+    inline void refill() {
+        while (avail <= 24) {
+            acc |= (uint32_t)(*src++) << (24 - avail);
+            avail += 8;
+        }
+    }
+
+    inline void skip(uint8_t n) {
+        acc = (n >= 32) ? 0 : (acc << n);
+        avail -= n;
+    }
+
+    // n <= 24
+    inline uint32_t bits(uint8_t n) {
+        if (n == 0) return 0;
+        refill();
+        const uint32_t v = acc >> (32 - n);
+        skip(n);
+        return v;
+    }
+
+    // Count one-bits up to the terminating zero (consumed)
+    inline uint32_t unary() {
+        uint32_t q = 0;
+        for (;;) {
+            refill();
+            const uint32_t inv  = ~acc;   // Bits below 'avail' are zero in acc
+            const uint8_t  ones = inv ? (uint8_t)__builtin_clz(inv) : 32;
+            if (ones < avail) {
+                skip(ones + 1);
+                return q + ones;
+            }
+            q += avail;
+            skip(avail);
+        }
+    }
+};
+
+} // namespace
+
+namespace AKWFCodec {
+
+void decode(const uint8_t* src, uint16_t len, int16_t* out) {
+    const uint8_t order = *src++;
+    BitReader br{src};
+
+    int32_t p1 = 0, p2 = 0, p3 = 0;
+    uint8_t k = 0;
+    for (uint16_t n = 0; n < len; ++n) {
+        if ((n % AKWF_CODEC_BLOCK) == 0) k = (uint8_t)br.bits(4);
+
+        const uint32_t u = (br.unary() << k) | br.bits(k);
+        const int32_t  r = (int32_t)(u >> 1) ^ -(int32_t)(u & 1);
+
+        int32_t pred;
+        switch (order) {
+            case 1:  pred = p1;                      break;
+            case 2:  pred = 2 * p1 - p2;             break;
+            default: pred = 3 * p1 - 3 * p2 + p3;    break;
+        }
+        const int32_t v = pred + r;
+        out[n] = (int16_t)v;
+        p3 = p2; p2 = p1; p1 = v;
+    }
+}
+
+} // namespace AKWFCodec
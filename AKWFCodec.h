@@ -0,0 +1,29 @@
+#pragma once
+#include <Arduino.h>
+
+// ============================================================================
+// AKWFCodec: lossless compressed storage for AKWF single cycles
+// ----------------------------------------------------------------------------
+// Each table is one byte-aligned stream in flash:
+//   byte 0      predictor order p (1..3), chosen per table by the generator
+//               (tools/akwf_pack.py, which writes the AKWF_* bank sources)
+//   bitstream   MSB first; per block of AKWF_CODEC_BLOCK samples:
+//                 4 bits   Rice parameter k
+//                 per sample: residual zig-zag mapped to u, q = u >> k sent
+//                 as q one-bits and a zero, then the low k bits of u
+// Residual = sample − fixed polynomial prediction from the previous p
+// samples (p1; 2·p1 − p2; 3·p1 − 3·p2 + p3), history starting at zero.
+//
+// Decoding is byte-exact and runs in loop context when a table is selected;
+// the audio path only ever plays decoded RAM copies (see AKWFMip).  Bank
+// data is padded so the 32-bit reader may run up to 4 bytes past a stream.
+// ============================================================================
+
+#define AKWF_CODEC_BLOCK  16
+
+namespace AKWFCodec {
+
+// Decode 'len' samples of the stream at 'src' into 'out'
+void decode(const uint8_t* src, uint16_t len, int16_t* out);
+
+} // namespace AKWFCodec
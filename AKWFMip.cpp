@@ -0,0 +1,226 @@
+#include "AKWFMip.h"
+#include <Audio.h>
+#include <math.h>
+#include "DebugTrace.h"
+#include "WaveTablePool.h"
+
+namespace {
+
+// Highest harmonic kept at each level
+inline uint8_t harmonicsAt(uint8_t level) {
+    const uint16_t h = 128u >> level;
+    return (uint8_t)(h > 127 ? 127 : h);
+}
+
+// Resynthesis and decode scratch (loop context only, never re-entered)
+DMAMEM float   s_scratch[AKWF_MIP_LEVELS][AKWF_MIP_SIZE];
+DMAMEM int16_t s_decoded[AKWF_MAX_TABLE_LEN];
+
+// Table data lives in OCRAM (DMAMEM is not zero-initialised, so the slot
+// bookkeeping is kept apart in DTCM and 'valid' gates every read)
+DMAMEM AKWFMipSet s_sets[AKWF_MIP_POOL];
+
+struct Slot {
+    ArbBank  bank    = ArbBank::BwBlended;
+    uint16_t index   = 0;
+    uint8_t  refs    = 0;
+    bool     valid   = false;
+    bool     stale   = false;   // Source table rewritten while held: no new hits
+    uint32_t lastUse = 0;   // s_useClock stamp of the last acquire
+};
+Slot s_pool[AKWF_MIP_POOL];
+
+uint32_t        s_useClock = 0;
+AKWFMip::Stats  s_stats;
+
+} // namespace
+
+namespace AKWFMip {
+
+void build(const int16_t* src, uint16_t len, AKWFMipSet& out) {
+    // Fourier series of one source cycle (phasor recurrence, double precision)
+    double a[128] = {0.0}, b[128] = {0.0};
+    double dc = 0.0;
+    for (uint16_t n = 0; n < len; ++n) dc += src[n];
+    dc /= len;
+
+    for (uint8_t k = 1; k < 128; ++k) {
+        const double w  = 2.0 * M_PI * k / len;
+        const double cw = cos(w), sw = sin(w);
+        double c = 1.0, s = 0.0, re = 0.0, im = 0.0;
+        for (uint16_t n = 0; n < len; ++n) {
+            re += src[n] * c;
+            im += src[n] * s;
+            const double cn = c * cw - s * sw;
+            s = s * cw + c * sw;
+            c = cn;
+        }
+        a[k] = 2.0 * re / len;
+        b[k] = 2.0 * im / len;
+    }
+
+    // Levels are nested (level l ⊂ level l-1): add harmonics in ascending
+    // order and snapshot the running sum whenever a level is complete.
+    float acc[AKWF_MIP_SIZE];
+    for (uint16_t n = 0; n < AKWF_MIP_SIZE; ++n) acc[n] = (float)dc;
+
+    int8_t next = AKWF_MIP_LEVELS - 1;   // Level completed by the fewest harmonics
+    for (uint8_t k = 1; k < 128 && next >= 0; ++k) {
+        const double w  = 2.0 * M_PI * k / AKWF_MIP_SIZE;
+        const double cw = cos(w), sw = sin(w);
+        double c = 1.0, s = 0.0;
+        for (uint16_t n = 0; n < AKWF_MIP_SIZE; ++n) {
+            acc[n] += (float)(a[k] * c + b[k] * s);
+            const double cn = c * cw - s * sw;
+            s = s * cw + c * sw;
+            c = cn;
+        }
+        while (next >= 0 && harmonicsAt(next) == k) {
+            memcpy(s_scratch[next], acc, sizeof(acc));
+            --next;
+        }
+    }
+
+    // One scale for every level (keeps the mip levels level-matched);
+    // only ever reduces, for Gibbs overshoot above full scale
+    float peak = 1.0f;
+    for (uint8_t l = 0; l < AKWF_MIP_LEVELS; ++l)
+        for (uint16_t n = 0; n < AKWF_MIP_SIZE; ++n)
+            peak = fmaxf(peak, fabsf(s_scratch[l][n]));
+    const float scale = (peak > 32767.0f) ? 32767.0f / peak : 1.0f;
+
+    for (uint8_t l = 0; l < AKWF_MIP_LEVELS; ++l)
+        for (uint16_t n = 0; n < AKWF_MIP_SIZE; ++n)
+            out.level[l][n] = (int16_t)lrintf(s_scratch[l][n] * scale);
+}
+
+const AKWFMipSet* acquire(ArbBank bank, uint16_t index) {
+    for (uint8_t i = 0; i < AKWF_MIP_POOL; ++i) {
+        Slot& s = s_pool[i];
+        if (s.valid && !s.stale && s.bank == bank && s.index == index) {
+            s.refs++;
+            s.lastUse = ++s_useClock;
+            s_stats.hits++;
+            return &s_sets[i];
+        }
+    }
+
+    if (index >= wavebank_tableCount(bank)) return nullptr;
+
+    // Prefer a never-used slot, else the least recently used unheld one
+    int8_t victim = -1;
+    for (uint8_t i = 0; i < AKWF_MIP_POOL; ++i) {
+        if (!s_pool[i].valid) { victim = (int8_t)i; break; }
+    }
+    if (victim < 0) {
+        for (uint8_t i = 0; i < AKWF_MIP_POOL; ++i) {
+            if (s_pool[i].refs != 0) continue;
+            if (victim < 0 || s_pool[i].lastUse < s_pool[victim].lastUse) victim = (int8_t)i;
+        }
+    }
+    s_stats.misses++;
+    if (victim < 0) {
+        JT_LOGF("[WTCACHE] full: %u sets held, %s #%u not cached\n",
+                AKWF_MIP_POOL, wavebank_name(bank), index);
+        return nullptr;
+    }
+
+    const uint32_t t0  = micros();
+    const uint16_t len = wavebank_decode(bank, index, s_decoded);
+    if (len == 0) return nullptr;   // Empty user slot
+
+    Slot& slot = s_pool[victim];
+    if (slot.valid) s_stats.evictions++;
+    slot.valid = false;
+    slot.stale = false;
+    build(s_decoded, len, s_sets[victim]);
+    s_stats.lastBuildUs = micros() - t0;
+    slot.bank    = bank;
+    slot.index   = index;
+    slot.refs    = 1;
+    slot.lastUse = ++s_useClock;
+    slot.valid   = true;
+
+    JT_LOGF("[WTCACHE] miss %s #%u -> slot %d, decoded + built in %lu us (hits %lu, misses %lu, evictions %lu)\n",
+            wavebank_name(bank), index, victim, (unsigned long)s_stats.lastBuildUs,
+            (unsigned long)s_stats.hits, (unsigned long)s_stats.misses,
+            (unsigned long)s_stats.evictions);
+    return &s_sets[victim];
+}
+
+void release(const AKWFMipSet* set) {
+    if (!set) return;
+    for (uint8_t i = 0; i < AKWF_MIP_POOL; ++i) {
+        if (&s_sets[i] == set) {
+            // Unheld sets stay resident until evicted (LRU)
+            if (s_pool[i].refs) s_pool[i].refs--;
+            if (s_pool[i].refs == 0 && s_pool[i].stale) s_pool[i].valid = false;
+            return;
+        }
+    }
+}
+
+void invalidate(ArbBank bank, uint16_t index) {
+    for (Slot& s : s_pool) {
+        if (!s.valid || s.bank != bank || s.index != index) continue;
+        // Holders keep playing the old set until they re-acquire
+        if (s.refs) s.stale = true;
+        else        s.valid = false;
+    }
+}
+
+bool resampleRaw(ArbBank bank, uint16_t index, int16_t* out) {
+    const uint16_t len = wavebank_decode(bank, index, s_decoded);
+    if (len == 0) return false;
+    for (uint16_t n = 0; n < AKWF_MIP_SIZE; ++n) {
+        const uint32_t pos  = (uint32_t)n * len * 256u / AKWF_MIP_SIZE;   // 24.8 source position
+        const uint16_t i0   = (uint16_t)(pos >> 8);
+        const uint16_t i1   = (uint16_t)((i0 + 1 < len) ? i0 + 1 : 0);
+        const int32_t  frac = (int32_t)(pos & 0xFF);
+        out[n] = (int16_t)(s_decoded[i0] + (((s_decoded[i1] - s_decoded[i0]) * frac) >> 8));
+    }
+    return true;
+}
+
+Stats stats() {
+    Stats st = s_stats;
+    st.resident = st.held = 0;
+    for (const Slot& s : s_pool) {
+        if (!s.valid) continue;
+        st.resident++;
+        if (s.refs) st.held++;
+    }
+    return st;
+}
+
+float levelFor(float freqHz) {
+    if (freqHz <= 0.0f) return 0.0f;
+    // Level k is alias-free while f ≤ fs·2^k / 256, i.e. while l ≤ k
+    const float l = log2f(freqHz * (256.0f / AUDIO_SAMPLE_RATE_EXACT));
+
+    // Over the half-octave below level k's limit (l in [k - ½, k)) fade
+    // from level k to k + 1, so k + 1 is whole by the time k would alias;
+    // from the limit up to the next fade (l in [k, k + ½)) play k + 1 alone
+    const float k = floorf(l + 0.5f);
+    const float p = (l < k) ? 2.0f * l - k + 1.0f : k + 1.0f;
+    if (p < 0.0f) return 0.0f;
+    if (p > (float)(AKWF_MIP_LEVELS - 1)) return (float)(AKWF_MIP_LEVELS - 1);
+    return p;
+}
+
+void blend(const AKWFMipSet& set, uint8_t a, float t, int16_t* out) {
+    if (a >= AKWF_MIP_LEVELS - 1 || t <= 0.0f) {
+        memcpy(out, set.level[a < AKWF_MIP_LEVELS ? a : AKWF_MIP_LEVELS - 1],
+               AKWF_MIP_SIZE * sizeof(int16_t));
+        return;
+    }
+    const int32_t wb = (int32_t)(t * 32768.0f);   // Q15 weight of level a+1
+    const int32_t wa = 32768 - wb;
+    const int16_t* la = set.level[a];
+    const int16_t* lb = set.level[a + 1];
+    for (uint16_t n = 0; n < AKWF_MIP_SIZE; ++n) {
+        out[n] = (int16_t)((la[n] * wa + lb[n] * wb) >> 15);
+    }
+}
+
+} // namespace AKWFMip
@@ -0,0 +1,75 @@
+#pragma once
+#include <Arduino.h>
+#include "AKWF_All.h"
+
+// ============================================================================
+// AKWFMip: octave-mipmapped, band-limited AKWF tables
+// ----------------------------------------------------------------------------
+// AudioSynthWaveformModulated plays 256-sample arbitrary tables (8-bit phase
+// index) with the same harmonics at every pitch, so upper notes alias.  Each
+// AKWF cycle is analysed once (DFT of the full source cycle) and resynthesised
+// as AKWF_MIP_LEVELS 256-sample tables; level l keeps harmonics 1..128>>l
+// (level 0: 1..127), so level l is alias-free up to
+//   f = (fs/2) / (128 >> l).
+//
+// Sets are built on first use (table select, loop context: the compressed
+// flash table is decoded, then analysed) and shared by every oscillator
+// playing the same table; OscillatorBlock blends two adjacent levels into
+// its own table at control rate, so the per-sample cost is unchanged.  The
+// blend runs over the half-octave below each level's limit, so the top
+// harmonics go half an octave early rather than ever aliasing.
+//
+// The pool is an LRU cache in OCRAM: sets are reference-counted by the
+// oscillators holding them, and released sets stay resident until the slot
+// is needed again, so flipping back to a recent table costs no rebuild.
+// The audio path never reads the PROGMEM banks.
+// ============================================================================
+
+#define AKWF_MIP_SIZE    256   // AudioSynthWaveformModulated arbitrary table length
+#define AKWF_MIP_LEVELS  8     // 127, 64, 32 … 1 harmonics
+#ifndef AKWF_MIP_POOL
+#define AKWF_MIP_POOL    8     // Cached sets (4 KB each, OCRAM): osc1 + osc2 held, 6 recent
+#endif
+
+struct AKWFMipSet {
+    int16_t level[AKWF_MIP_LEVELS][AKWF_MIP_SIZE];
+};
+
+namespace AKWFMip {
+
+// Band-limit one source cycle of any length into 'out'.
+void build(const int16_t* src, uint16_t len, AKWFMipSet& out);
+
+// Shared set for a bank table (built on first use).  nullptr when the table
+// is empty or every pool slot is held by another table.
+const AKWFMipSet* acquire(ArbBank bank, uint16_t index);
+void release(const AKWFMipSet* set);
+
+// A user table was rewritten: drop its cached set (held sets live on for
+// their holders but are no longer handed out)
+void invalidate(ArbBank bank, uint16_t index);
+
+// Full-band fallback: decode a table and resample it to AKWF_MIP_SIZE
+// (linear).  false if the table does not exist.
+bool resampleRaw(ArbBank bank, uint16_t index, int16_t* out);
+
+// Cache counters since boot
+struct Stats {
+    uint32_t hits        = 0;
+    uint32_t misses      = 0;   // Includes misses that found every slot held
+    uint32_t evictions   = 0;
+    uint32_t lastBuildUs = 0;   // Decode + analysis + resynthesis time of the last miss
+    uint8_t  resident    = 0;   // Valid sets
+    uint8_t  held        = 0;   // Valid sets with at least one oscillator
+};
+Stats stats();
+
+// Fractional mip position for a fundamental, for blend(): integer part =
+// level, fraction = weight of the next level up.  Every level given weight
+// is alias-free at freqHz; rounding the fraction down keeps that true.
+float levelFor(float freqHz);
+
+// out = (1 - t)·level[a] + t·level[a + 1]   (a + 1 clamped to the last level)
+void blend(const AKWFMipSet& set, uint8_t a, float t, int16_t* out);
+
+} // namespace AKWFMip
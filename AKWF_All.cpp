@@ -0,0 +1,27 @@
+// Auto‑generated AKWF bank catalog. Do not edit manually.
+
+#include "AKWF_All.h"
+
+#include "AKWF_BwBlended/AKWF_BwBlended.h"
+#include "AKWF_BwPerfectwaves/AKWF_BwPerfectwaves.h"
+#include "AKWF_BwSaw/AKWF_BwSaw.h"
+#include "AKWF_BwSawbright/AKWF_BwSawbright.h"
+#include "AKWF_BwSawgap/AKWF_BwSawgap.h"
+#include "AKWF_BwSawrounded/AKWF_BwSawrounded.h"
+#include "AKWF_BwSin/AKWF_BwSin.h"
+#include "AKWF_BwSqu/AKWF_BwSqu.h"
+#include "AKWF_BwSqurounded/AKWF_BwSqurounded.h"
+#include "AKWF_BwTri/AKWF_BwTri.h"
+
+const AKWFBankDir akwf_banks[AKWF_BANK_COUNT] = {
+    { "BwBlended", AKWF_BwBlended::tables, AKWF_BwBlended::count },
+    { "BwPerfectwaves", AKWF_BwPerfectwaves::tables, AKWF_BwPerfectwaves::count },
+    { "BwSaw", AKWF_BwSaw::tables, AKWF_BwSaw::count },
+    { "BwSawbright", AKWF_BwSawbright::tables, AKWF_BwSawbright::count },
+    { "BwSawgap", AKWF_BwSawgap::tables, AKWF_BwSawgap::count },
+    { "BwSawrounded", AKWF_BwSawrounded::tables, AKWF_BwSawrounded::count },
+    { "BwSin", AKWF_BwSin::tables, AKWF_BwSin::count },
+    { "BwSqu", AKWF_BwSqu::tables, AKWF_BwSqu::count },
+    { "BwSqurounded", AKWF_BwSqurounded::tables, AKWF_BwSqurounded::count },
+    { "BwTri", AKWF_BwTri::tables, AKWF_BwTri::count }
+};
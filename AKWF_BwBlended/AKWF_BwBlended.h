@@ -1,94 +1,1813 @@
-// Auto‑generated AKWF bank. Do not edit manually.
+// Auto‑generated AKWF bank (compressed, see AKWFCodec.h). Do not edit manually.
 
 #pragma once
 #include <Arduino.h>
 
-#include "AKWF_BwBlended_Tables_Part0.h"
-#include "AKWF_BwBlended_Tables_Part1.h"
-#include "AKWF_BwBlended_Tables_Part2.h"
-#include "AKWF_BwBlended_Tables_Part3.h"
-
 namespace AKWF_BwBlended {
+
     constexpr uint16_t count = 73;
-}
 
-// Return a pointer to the n‑th waveform table in this bank.
-// If index is out of range, returns nullptr and length is set to 0.
-inline const int16_t* AKWF_BwBlended_get(uint16_t index, uint16_t &length) {
-    switch(index) {
-        case 0: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0001;
-        case 1: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0002;
-        case 2: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0003;
-        case 3: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0004;
-        case 4: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0005;
-        case 5: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0006;
-        case 6: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0007;
-        case 7: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0008;
-        case 8: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0009;
-        case 9: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0011;
-        case 10: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0012;
-        case 11: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0013;
-        case 12: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0014;
-        case 13: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0015;
-        case 14: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0016;
-        case 15: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0017;
-        case 16: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0018;
-        case 17: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0019;
-        case 18: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0021;
-        case 19: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0022;
-        case 20: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0024;
-        case 21: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0025;
-        case 22: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0026;
-        case 23: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0028;
-        case 24: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0029;
-        case 25: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0030;
-        case 26: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0031;
-        case 27: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0032;
-        case 28: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0033;
-        case 29: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0035;
-        case 30: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0036;
-        case 31: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0037;
-        case 32: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0038;
-        case 33: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0039;
-        case 34: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0041;
-        case 35: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0042;
-        case 36: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0044;
-        case 37: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0045;
-        case 38: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0046;
-        case 39: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0047;
-        case 40: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0048;
-        case 41: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0049;
-        case 42: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0050;
-        case 43: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0051;
-        case 44: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0052;
-        case 45: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0053;
-        case 46: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0054;
-        case 47: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0055;
-        case 48: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0056;
-        case 49: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0057;
-        case 50: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0058;
-        case 51: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0059;
-        case 52: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0060;
-        case 53: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0061;
-        case 54: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0062;
-        case 55: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0063;
-        case 56: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0064;
-        case 57: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0065;
-        case 58: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0066;
-        case 59: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0067;
-        case 60: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0068;
-        case 61: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0069;
-        case 62: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0070;
-        case 63: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0071;
-        case 64: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0072;
-        case 65: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0073;
-        case 66: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0074;
-        case 67: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0075;
-        case 68: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0076;
-        case 69: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0077;
-        case 70: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0078;
-        case 71: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0079;
-        case 72: length = 600; return AKWF_BwBlended::akwf_akwf_bwblended_akwf_blended_0080;
-        default: length = 0; return nullptr;
-    }
-}
+    // 87600 bytes as int16 → 27542 bytes
+
+    static const uint8_t data[27542] PROGMEM = {
+        0x02, 0xCF, 0xA2, 0xA8, 0x6D, 0xBF, 0xC3, 0x8F, 0xC0, 0x2D, 0x87, 0xBE, 0x8D, 0xE8, 0x72, 0xD7,
+        0xE8, 0x76, 0x71, 0xEF, 0x05, 0x74, 0x03, 0xA0, 0xD6, 0x08, 0x48, 0x30, 0x01, 0x22, 0xBF, 0xD0,
+        0xF6, 0xDD, 0x61, 0xB6, 0x99, 0x41, 0x75, 0x0F, 0x31, 0x34, 0x0F, 0x20, 0xE7, 0x2A, 0xD2, 0xF2,
+        0x8C, 0x31, 0xB4, 0x49, 0x49, 0x58, 0x7D, 0xC5, 0xEF, 0x9A, 0xDC, 0x3A, 0x05, 0x1B, 0x87, 0x72,
+        0x8E, 0xE0, 0xEB, 0xCA, 0x52, 0x91, 0xCD, 0x15, 0x9A, 0x90, 0xD2, 0x65, 0x74, 0x5B, 0x80, 0x05,
+        0x27, 0x14, 0x74, 0x59, 0xC5, 0x19, 0xE8, 0xC1, 0xA8, 0x02, 0x22, 0x09, 0xC6, 0x1C, 0x45, 0x11,
+        0x55, 0x7A, 0x14, 0x88, 0x2A, 0x02, 0x30, 0x00, 0xE2, 0xE3, 0x15, 0x26, 0x85, 0x25, 0x61, 0xC2,
+        0xB6, 0x3A, 0x46, 0xCF, 0xB6, 0xE9, 0x43, 0x68, 0x8E, 0x66, 0xC8, 0xD8, 0xA1, 0xBA, 0x5A, 0x25,
+        0xC5, 0x3A, 0xB0, 0xCC, 0xC8, 0xB1, 0x1F, 0x99, 0x0E, 0x34, 0x19, 0x92, 0xE7, 0x49, 0x9D, 0x55,
+        0x9D, 0x39, 0x7D, 0x03, 0x00, 0xFE, 0x1A, 0x16, 0x0A, 0x16, 0x3A, 0x46, 0x4A, 0x6E, 0xAA, 0xB5,
+        0xDA, 0x1A, 0x5C, 0x9E, 0x5F, 0xA0, 0xF1, 0x28, 0xAC, 0x52, 0x3F, 0x32, 0x9E, 0xD0, 0xA9, 0xF6,
+        0x0B, 0x6E, 0x03, 0xE8, 0x22, 0x61, 0x36, 0x0A, 0xD8, 0x5F, 0x03, 0x56, 0x1E, 0xA1, 0x18, 0x89,
+        0xD8, 0x4B, 0x6A, 0x07, 0xFC, 0xE3, 0xB7, 0x81, 0x7E, 0x8C, 0x07, 0x8B, 0xA2, 0x26, 0x2E, 0x4E,
+        0x20, 0xE0, 0x9B, 0x52, 0x79, 0x93, 0x24, 0xB8, 0x6A, 0x15, 0x76, 0x39, 0xD8, 0x8C, 0xF5, 0xB2,
+        0xE5, 0x3C, 0xDA, 0x5C, 0x66, 0x3E, 0xE3, 0x07, 0x65, 0x73, 0x55, 0x6F, 0x49, 0x47, 0x21, 0x37,
+        0x21, 0x33, 0x1C, 0xBA, 0xB8, 0x98, 0xB7, 0xB2, 0xF0, 0x2F, 0xD8, 0xBF, 0x5A, 0x7C, 0xCA, 0xB3,
+        0xA5, 0xC6, 0x4D, 0xB9, 0xB0, 0xD5, 0x8F, 0x16, 0x1B, 0xB2, 0xD9, 0x3C, 0x95, 0xD5, 0x5C, 0x87,
+        0xBE, 0x59, 0xE1, 0x9E, 0x18, 0xDB, 0x39, 0x46, 0x98, 0xCA, 0x2C, 0x59, 0x89, 0x57, 0x53, 0x16,
+        0xC5, 0x66, 0x2F, 0x03, 0xF7, 0x36, 0x50, 0x3D, 0xE1, 0xEF, 0x2A, 0x8B, 0x17, 0x78, 0xD5, 0x14,
+        0x21, 0x73, 0x81, 0x60, 0x45, 0xB8, 0x02, 0xE7, 0x56, 0x21, 0x13, 0x3C, 0xA4, 0xF2, 0x77, 0xCC,
+        0x08, 0x45, 0x2B, 0xD5, 0x13, 0xA3, 0x40, 0xE9, 0x94, 0x44, 0x15, 0x1A, 0x98, 0x1C, 0x4A, 0x8D,
+        0x64, 0xB4, 0x75, 0x34, 0x38, 0xCE, 0x86, 0x1C, 0x0E, 0x2C, 0xE0, 0x4C, 0xF6, 0x5B, 0x57, 0x05,
+        0xC2, 0xB9, 0x4F, 0x4C, 0x52, 0x88, 0xEC, 0x8E, 0x89, 0x70, 0x57, 0x74, 0xB8, 0x29, 0xAA, 0xBD,
+        0xD9, 0xD6, 0x43, 0xB1, 0xA1, 0xCC, 0x93, 0x52, 0x7C, 0xC9, 0x75, 0x2B, 0xD8, 0xAF, 0x72, 0xDB,
+        0x3C, 0x7F, 0x09, 0x0B, 0x09, 0x13, 0x29, 0x2F, 0x31, 0x37, 0x49, 0x57, 0x59, 0x5F, 0x71, 0x76,
+        0xEF, 0x90, 0x38, 0x64, 0x4E, 0x31, 0x25, 0x9A, 0x4E, 0xE8, 0x14, 0xFB, 0x15, 0xC7, 0x00, 0xC5,
+        0xF3, 0x8D, 0x77, 0x02, 0xF8, 0x1A, 0x90, 0xF4, 0x08, 0xC4, 0x4E, 0x82, 0x53, 0x50, 0x8F, 0xE7,
+        0x1D, 0xBC, 0x33, 0xF4, 0x5C, 0x3C, 0x5D, 0x10, 0x61, 0xDC, 0x19, 0x30, 0xC1, 0xC3, 0x9C, 0xFB,
+        0xEE, 0xAD, 0xA7, 0xE3, 0x98, 0xBD, 0xB2, 0xCF, 0x42, 0xA4, 0xCC, 0x26, 0xF1, 0xC8, 0xFC, 0x12,
+        0x1A, 0xF8, 0xF0, 0x57, 0x27, 0xB6, 0x86, 0xF5, 0xE6, 0x14, 0xE1, 0xF4, 0x35, 0x48, 0xAD, 0x62,
+        0x62, 0x37, 0xC6, 0x30, 0x87, 0xE7, 0xD8, 0x64, 0x1C, 0x4B, 0xD4, 0xC3, 0xE2, 0xC2, 0xE1, 0xEB,
+        0xFD, 0x45, 0x00, 0x02, 0xCF, 0xF7, 0x20, 0x6A, 0xFD, 0xFF, 0x1F, 0x8F, 0x3D, 0x76, 0x73, 0x9B,
+        0x2D, 0xA4, 0x7F, 0x6E, 0x32, 0x1C, 0xC8, 0xAC, 0x16, 0x70, 0x23, 0x84, 0x90, 0x2A, 0x60, 0xFA,
+        0x05, 0xDA, 0xFF, 0xD4, 0xFD, 0x30, 0x03, 0x24, 0x90, 0x05, 0x18, 0x31, 0x09, 0x31, 0x14, 0x0D,
+        0x3B, 0x56, 0x51, 0x47, 0xCB, 0x3C, 0x2F, 0xA6, 0xFA, 0x67, 0x6A, 0xA4, 0x93, 0xCD, 0x2D, 0x14,
+        0xD5, 0x6E, 0x2C, 0x39, 0x34, 0xE8, 0xBE, 0xAB, 0xD6, 0x34, 0x58, 0xD3, 0xED, 0x59, 0xAD, 0x46,
+        0x95, 0xBC, 0x0B, 0xB6, 0x2B, 0xE1, 0x63, 0xB4, 0x54, 0x7C, 0xA4, 0x8C, 0x94, 0xBC, 0xE4, 0xFD,
+        0x05, 0x1D, 0x75, 0x9D, 0xC5, 0xFE, 0x2B, 0x1E, 0xF1, 0x08, 0xAC, 0x82, 0x47, 0x24, 0x93, 0xCC,
+        0xA7, 0x74, 0x4A, 0x8D, 0x8A, 0xE3, 0x80, 0x60, 0xF8, 0x96, 0x43, 0x44, 0xD8, 0xA8, 0x97, 0x23,
+        0x26, 0x6D, 0x8E, 0xDA, 0x0E, 0x49, 0xAA, 0x79, 0x7F, 0xB8, 0x08, 0x3F, 0x96, 0xCB, 0x6B, 0xDE,
+        0x87, 0xFF, 0xFF, 0xF1, 0x33, 0x5F, 0xFF, 0xC5, 0x37, 0x9B, 0x88, 0x9F, 0xBA, 0x28, 0x4D, 0x82,
+        0xC6, 0x2A, 0xC8, 0x11, 0x7A, 0x5A, 0x38, 0xE7, 0xA8, 0xBD, 0x9A, 0x42, 0x72, 0x57, 0x9F, 0x0B,
+        0xCE, 0xAD, 0xB8, 0xC5, 0x67, 0x02, 0x9E, 0xDA, 0x26, 0xF5, 0xA8, 0xDD, 0x0A, 0x2B, 0x34, 0x81,
+        0xC9, 0x1A, 0xDF, 0x29, 0x57, 0x8A, 0xA5, 0xBE, 0x95, 0xAE, 0x91, 0xAE, 0x8F, 0xA4, 0x83, 0x9C,
+        0x7F, 0x24, 0xB7, 0xF6, 0x2D, 0xE6, 0x55, 0xCA, 0xB7, 0xA1, 0x46, 0xA4, 0x3B, 0x93, 0x6F, 0x4B,
+        0xA8, 0x97, 0xF0, 0x61, 0xCD, 0x2E, 0x49, 0x72, 0x57, 0xA2, 0x9C, 0x94, 0xDC, 0x97, 0x1C, 0x78,
+        0x57, 0x95, 0xF2, 0x7B, 0x2E, 0x11, 0xB1, 0xC8, 0x64, 0x4E, 0x8F, 0x8C, 0xF5, 0x9E, 0x91, 0x14,
+        0x35, 0x30, 0x33, 0xE6, 0x9E, 0x3E, 0x11, 0xC9, 0x87, 0x34, 0xB4, 0x4F, 0x5B, 0xC6, 0x33, 0x50,
+        0x21, 0xD4, 0x02, 0x87, 0xF8, 0x18, 0xAE, 0x7C, 0x18, 0x62, 0x8A, 0x03, 0x25, 0xF2, 0x6E, 0x5C,
+        0x39, 0x5E, 0x30, 0x41, 0xF3, 0xBC, 0xB8, 0x45, 0xE4, 0xDE, 0x95, 0xC9, 0x0E, 0x06, 0x75, 0xE7,
+        0xD6, 0x6B, 0x3D, 0x7B, 0x48, 0x1A, 0xC5, 0xB9, 0xF0, 0x3D, 0x92, 0xD5, 0x1B, 0x96, 0xC8, 0x55,
+        0xC8, 0x2F, 0x3B, 0x0A, 0x2C, 0x28, 0x32, 0xA6, 0xCA, 0x97, 0x4A, 0xAD, 0x09, 0xEB, 0x6A, 0xED,
+        0xEB, 0xF7, 0x2D, 0xE0, 0x60, 0xDC, 0xAF, 0x7B, 0x1F, 0x43, 0x4F, 0x43, 0x2D, 0xA3, 0x23, 0xE6,
+        0xAA, 0x6A, 0xA8, 0xEB, 0xAD, 0xEE, 0x2F, 0x71, 0x18, 0xBC, 0x66, 0x47, 0x39, 0xA3, 0x85, 0x42,
+        0xB5, 0x70, 0xBF, 0x62, 0x33, 0x5B, 0x0E, 0x17, 0x83, 0xF6, 0x10, 0x88, 0x63, 0x29, 0x2E, 0x68,
+        0xA2, 0x6C, 0x6C, 0x87, 0x5C, 0x82, 0x09, 0x2C, 0xA7, 0x8B, 0xF4, 0xE0, 0x11, 0x0D, 0x5B, 0x1D,
+        0x96, 0x79, 0xDF, 0xFD, 0x26, 0xFF, 0xA5, 0x36, 0x37, 0x89, 0x52, 0xF5, 0x93, 0x89, 0xB8, 0x45,
+        0x43, 0xE9, 0x24, 0x39, 0x8C, 0x0E, 0x3B, 0xDC, 0xBF, 0xB4, 0xCA, 0x0A, 0xCC, 0x87, 0xA7, 0xC7,
+        0x9A, 0x40, 0xF6, 0x1C, 0x22, 0x7F, 0x62, 0x96, 0xD5, 0xA4, 0x34, 0x88, 0x8C, 0xBA, 0x03, 0x1E,
+        0x71, 0x8A, 0x36, 0xC3, 0x1A, 0x96, 0xF2, 0x66, 0xE2, 0x56, 0xAA, 0x36, 0x9A, 0x0E, 0x59, 0xEC,
+        0xC3, 0xF9, 0x68, 0x19, 0x05, 0xA7, 0x89, 0x3F, 0x0A, 0x4D, 0x48, 0xB6, 0xA2, 0xCE, 0x66, 0x74,
+        0x5A, 0x0D, 0xC6, 0x4B, 0x78, 0xAD, 0xB1, 0x75, 0x43, 0x74, 0x76, 0x36, 0xAA, 0x71, 0x47, 0x71,
+        0xE7, 0xC1, 0xE8, 0xF6, 0x38, 0x05, 0x1E, 0x80, 0x80, 0x84, 0x38, 0x9C, 0x21, 0x86, 0x34, 0x21,
+        0xE8, 0x92, 0xC0, 0x84, 0x68, 0x43, 0xD4, 0x67, 0x40, 0x51, 0x15, 0x10, 0xC6, 0x89, 0xC3, 0x8D,
+        0x67, 0xF1, 0x0C, 0x18, 0x00, 0x00, 0x01, 0x81, 0x01, 0x08, 0xFB, 0x3F, 0xBE, 0xEE, 0xFE, 0x5B,
+        0xCC, 0xAE, 0xFD, 0x16, 0x89, 0x3A, 0x46, 0x81, 0xC6, 0xEA, 0x87, 0x3A, 0xC3, 0x20, 0x9A, 0xCD,
+        0xDF, 0x6C, 0x58, 0x02, 0x2F, 0xFF, 0x4A, 0x1C, 0x2B, 0xC1, 0x70, 0x11, 0x08, 0x5E, 0x69, 0xCB,
+        0x21, 0xBF, 0x9A, 0x18, 0x13, 0xA3, 0x4C, 0xD0, 0x71, 0x0E, 0xA6, 0x88, 0xCC, 0xB8, 0x01, 0xC0,
+        0x7C, 0x48, 0x2F, 0x00, 0x7C, 0x66, 0x6F, 0x39, 0xBC, 0x46, 0x3E, 0x27, 0x06, 0x64, 0x4E, 0x1C,
+        0x0F, 0xBD, 0xBC, 0x3D, 0x9E, 0x3F, 0x05, 0x0E, 0x28, 0x01, 0x0A, 0x26, 0xA8, 0x4E, 0x87, 0x7F,
+        0x37, 0x81, 0x84, 0xC0, 0xC9, 0x9A, 0x3C, 0x38, 0x65, 0xCE, 0x30, 0xC8, 0xF0, 0x1C, 0xBC, 0xC0,
+        0x38, 0x3E, 0x27, 0x04, 0xB0, 0x54, 0x15, 0x53, 0x18, 0xBE, 0x26, 0x8A, 0x28, 0x7A, 0x9A, 0x07,
+        0x05, 0x1A, 0x10, 0xE8, 0x17, 0xE3, 0x6C, 0xBF, 0xD1, 0xF8, 0x07, 0x9A, 0xDE, 0x0F, 0x6B, 0x0B,
+        0xE2, 0x07, 0x37, 0x8C, 0x1F, 0x10, 0x4B, 0xF3, 0x79, 0xBC, 0x00, 0x32, 0x98, 0x24, 0xDC, 0x89,
+        0xCA, 0xF2, 0xBC, 0xB9, 0xA0, 0x02, 0x80, 0x0C, 0x00, 0x00, 0x00, 0xA0, 0x03, 0x00, 0x06, 0x00,
+        0x20, 0x00, 0x1F, 0xFF, 0xE0, 0xA5, 0xFF, 0xFF, 0x82, 0x8C, 0x00, 0x30, 0x00, 0x00, 0x02, 0x80,
+        0x0C, 0x00, 0x18, 0x00, 0x82, 0x6C, 0xCD, 0xE6, 0xCC, 0xD8, 0xDC, 0x88, 0xDC, 0x9A, 0x30, 0x0D,
+        0xE6, 0xC4, 0x12, 0x77, 0xCE, 0xC1, 0x65, 0x23, 0xBC, 0x1A, 0x37, 0x9A, 0x06, 0x91, 0xB9, 0x48,
+        0x4D, 0x4A, 0xBC, 0x5A, 0x9A, 0x90, 0x19, 0x18, 0xD0, 0xA9, 0x79, 0xAB, 0x3B, 0x83, 0x46, 0xC4,
+        0xD9, 0xA0, 0x69, 0x07, 0x59, 0x52, 0xB3, 0x42, 0xE7, 0xB8, 0x34, 0xA9, 0x43, 0x42, 0x76, 0xF3,
+        0x44, 0xAC, 0xD6, 0x54, 0xA1, 0xA0, 0x4A, 0xD8, 0x44, 0x4B, 0xAB, 0x4C, 0xD6, 0x44, 0x66, 0x97,
+        0x29, 0xA0, 0x6C, 0xD1, 0xCB, 0xBC, 0xA9, 0x41, 0xB1, 0xD8, 0x23, 0x34, 0xDE, 0x56, 0x6E, 0x76,
+        0x4A, 0x44, 0x2B, 0xC5, 0xA9, 0xA9, 0x08, 0xCE, 0x2C, 0x63, 0x79, 0xBC, 0xDD, 0xE1, 0x52, 0x67,
+        0xA3, 0x97, 0x9D, 0x80, 0x06, 0x9C, 0xB1, 0x14, 0x89, 0x3B, 0xE2, 0x5C, 0xA6, 0x03, 0x4C, 0x29,
+        0x94, 0x02, 0x4F, 0xFF, 0xFF, 0x27, 0xFD, 0x80, 0x20, 0xC0, 0x40, 0x08, 0x20, 0x10, 0x40, 0x22,
+        0x0E, 0xF3, 0x78, 0xB8, 0xC0, 0xCF, 0x7E, 0x50, 0xA1, 0xC0, 0x62, 0x00, 0x70, 0x1E, 0xB7, 0xC1,
+        0xC6, 0x0F, 0x25, 0x47, 0x94, 0x6D, 0x7C, 0x2B, 0x6C, 0xF4, 0x46, 0xB9, 0xAE, 0x6C, 0x55, 0xDD,
+        0x2C, 0xD4, 0xD5, 0x4D, 0x10, 0xC8, 0xAC, 0xBD, 0x06, 0x14, 0x39, 0x51, 0xE3, 0x4B, 0x9D, 0x1E,
+        0x34, 0xBA, 0x53, 0xE7, 0x2D, 0x3B, 0x98, 0x38, 0xD8, 0xB8, 0x15, 0xEE, 0x63, 0xE7, 0x65, 0xE6,
+        0x69, 0xEF, 0x6F, 0xEF, 0x3B, 0x1B, 0x83, 0xCB, 0xF4, 0x06, 0x21, 0x1D, 0x94, 0x4C, 0xE7, 0xD4,
+        0x9A, 0xF5, 0xDF, 0x18, 0xD0, 0x77, 0xE9, 0x71, 0xE1, 0x64, 0xD9, 0xC4, 0x6F, 0xE7, 0x8D, 0x6B,
+        0xD3, 0x1F, 0x44, 0xF7, 0x70, 0xED, 0xE1, 0x53, 0xED, 0x90, 0x08, 0x04, 0xFA, 0x1D, 0x1F, 0xC5,
+        0x88, 0xB8, 0x10, 0x6E, 0x50, 0x5F, 0x64, 0x39, 0x96, 0x1D, 0xC4, 0x10, 0xDF, 0x91, 0xDC, 0x11,
+        0x57, 0x7A, 0xFE, 0xE6, 0x0E, 0x65, 0x5C, 0x4A, 0xF8, 0xD4, 0xEF, 0x4D, 0xA9, 0x1E, 0xB4, 0xF5,
+        0xAD, 0x0E, 0x43, 0x71, 0x19, 0x80, 0xBC, 0x25, 0xE1, 0x41, 0x8C, 0x8B, 0x09, 0x9F, 0x0A, 0xF0,
+        0xC7, 0x6A, 0xE9, 0x19, 0x1E, 0x55, 0xB1, 0xDA, 0x27, 0x25, 0xC2, 0x38, 0x4F, 0x08, 0xC0, 0x90,
+        0x19, 0x6C, 0xE5, 0x87, 0xA6, 0x94, 0x23, 0x46, 0x83, 0xD1, 0x18, 0xF0, 0x0C, 0x99, 0xBC, 0x66,
+        0x4E, 0xD0, 0x08, 0x00, 0x20, 0x18, 0x00, 0x80, 0x20, 0x02, 0x00, 0x80, 0x27, 0x98, 0x19, 0xBD,
+        0xF7, 0x3D, 0xAD, 0x5E, 0xC0, 0x63, 0x08, 0x9A, 0x01, 0xE8, 0x2B, 0x40, 0x54, 0x25, 0xA5, 0x68,
+        0x56, 0x94, 0x74, 0xA9, 0x13, 0x41, 0x8E, 0x86, 0x82, 0xF1, 0x4C, 0x9C, 0x43, 0x2F, 0x5B, 0xA9,
+        0xB5, 0xC4, 0xC6, 0xD0, 0xB1, 0x81, 0x5A, 0x54, 0xC9, 0x8F, 0x40, 0x79, 0xE3, 0xCB, 0x96, 0x5A,
+        0x5A, 0xD8, 0x5A, 0x14, 0x86, 0x01, 0x64, 0x62, 0xD4, 0x0E, 0x85, 0x6A, 0x75, 0x46, 0xA1, 0x62,
+        0x4B, 0x18, 0x9E, 0x27, 0x53, 0xA7, 0xA1, 0x13, 0xC4, 0xE8, 0xCE, 0x93, 0xB4, 0x6D, 0x1C, 0x23,
+        0x68, 0xC8, 0xED, 0x9F, 0x64, 0x9E, 0x67, 0xC0, 0xB8, 0x9B, 0x24, 0x74, 0x47, 0x45, 0x7A, 0x31,
+        0xDC, 0xAB, 0xC0, 0x7E, 0x33, 0xF0, 0x20, 0xCC, 0x97, 0x4A, 0x8D, 0x09, 0x35, 0x2C, 0xE0, 0x33,
+        0x97, 0x4E, 0xE2, 0xA3, 0x63, 0xA1, 0xE3, 0x23, 0xE7, 0xA8, 0xEA, 0xAA, 0x6D, 0x2E, 0x70, 0x10,
+        0x83, 0x48, 0x24, 0xD3, 0xCA, 0x75, 0xC3, 0x1D, 0xC8, 0xF9, 0x85, 0xA3, 0x79, 0xBA, 0xBB, 0xC5,
+        0xDB, 0x6F, 0xC9, 0x53, 0xFC, 0xF1, 0xAD, 0x3A, 0x5F, 0xE8, 0xBE, 0xF0, 0x1D, 0xBC, 0x2C, 0x7E,
+        0x32, 0x09, 0x02, 0x9E, 0xC3, 0xB4, 0x1A, 0x07, 0x98, 0x60, 0x1D, 0xBC, 0xF2, 0x5E, 0x79, 0xDE,
+        0xEA, 0x1F, 0x35, 0x0F, 0x82, 0x87, 0xB0, 0x89, 0xAC, 0x89, 0x9C, 0x7A, 0xB9, 0x95, 0xF3, 0x2C,
+        0xE2, 0x4F, 0xB5, 0x16, 0x74, 0x39, 0xCF, 0xD0, 0x8B, 0x3A, 0x1A, 0x6E, 0xBF, 0x35, 0xBA, 0x27,
+        0xB2, 0x1B, 0x23, 0xAA, 0x3C, 0x54, 0xE0, 0x79, 0xE5, 0x3D, 0xAB, 0x82, 0xD9, 0xF2, 0x8E, 0x11,
+        0xB4, 0x74, 0x89, 0x75, 0x78, 0x1C, 0x6F, 0xC4, 0xE8, 0x01, 0xA0, 0x70, 0x44, 0x69, 0xEA, 0x61,
+        0x40, 0x87, 0x50, 0x50, 0xE4, 0x78, 0xCC, 0x03, 0x8F, 0x2E, 0x03, 0x97, 0x23, 0xC0, 0x66, 0x44,
+        0x38, 0x2B, 0x39, 0x70, 0x00, 0xE6, 0xE4, 0x46, 0x3C, 0xB8, 0x6F, 0x00, 0x03, 0x7F, 0xE9, 0x94,
+        0xAF, 0xFB, 0xA8, 0x70, 0x38, 0x80, 0x08, 0x30, 0x00, 0x50, 0x18, 0x40, 0x20, 0x08, 0x10, 0x50,
+        0xAF, 0x81, 0x8F, 0x9B, 0xE2, 0x63, 0x30, 0x88, 0xAC, 0xF8, 0xDC, 0x24, 0xA6, 0x04, 0x30, 0x68,
+        0x29, 0x1C, 0x22, 0x8F, 0x85, 0xE8, 0xF6, 0xE3, 0xE5, 0xEE, 0xCF, 0x3F, 0x91, 0xF8, 0x7F, 0xF3,
+        0xDB, 0xC9, 0xE0, 0x86, 0x09, 0x88, 0x22, 0x30, 0x88, 0x20, 0xA0, 0x07, 0xA6, 0x8D, 0x5B, 0xCF,
+        0x63, 0x3D, 0xF0, 0x9B, 0x82, 0xEB, 0x7A, 0x1B, 0xD3, 0x00, 0xA2, 0x21, 0x4E, 0x2E, 0x01, 0x11,
+        0x7A, 0xDF, 0x1B, 0x70, 0xE8, 0x2E, 0x3E, 0x9D, 0x22, 0x4E, 0x4A, 0x06, 0x2C, 0x13, 0x2E, 0x33,
+        0xE8, 0x5A, 0xD7, 0x91, 0xCE, 0x4F, 0xFF, 0xDC, 0x35, 0xDA, 0xF8, 0x2D, 0x08, 0x86, 0xD1, 0xA2,
+        0xC0, 0x82, 0x78, 0x15, 0xBE, 0x1A, 0x38, 0x91, 0x4C, 0x71, 0x4F, 0x34, 0xCD, 0xF3, 0xBC, 0x41,
+        0x2A, 0x9A, 0xBA, 0x75, 0x30, 0xE1, 0xD6, 0xFC, 0x65, 0x83, 0x0D, 0x28, 0x5D, 0x23, 0x38, 0x6F,
+        0xE5, 0x7E, 0x17, 0xFC, 0xB7, 0x0D, 0x30, 0x20, 0xA1, 0x51, 0x45, 0xBA, 0xF9, 0xD6, 0xC4, 0x87,
+        0x75, 0x37, 0x8D, 0xE0, 0xB7, 0xAE, 0x75, 0xBC, 0x1C, 0xF1, 0xB4, 0x83, 0x52, 0x86, 0xCB, 0xF9,
+        0xFC, 0xAA, 0xE4, 0xD1, 0x36, 0x04, 0x44, 0xA3, 0x09, 0x80, 0x50, 0x81, 0x20, 0x00, 0xC2, 0x0B,
+        0xA5, 0xFF, 0x53, 0x77, 0xD3, 0xE0, 0xCB, 0x9A, 0x24, 0xB6, 0x55, 0x03, 0xFC, 0x57, 0xC8, 0x7F,
+        0x9B, 0xE0, 0xE6, 0x40, 0x19, 0x2C, 0x14, 0x50, 0x41, 0x00, 0x85, 0x19, 0xD1, 0x70, 0x7B, 0x3D,
+        0x16, 0x0D, 0x1A, 0x01, 0xD0, 0xB3, 0xD6, 0x63, 0x16, 0xB0, 0xD0, 0x34, 0xE9, 0x92, 0x4E, 0x8B,
+        0xD5, 0xA1, 0xAF, 0x3E, 0x33, 0x86, 0xC1, 0x03, 0x88, 0x0A, 0x28, 0x79, 0x62, 0xA4, 0x07, 0x9E,
+        0x5A, 0xF3, 0xF8, 0x7F, 0x8F, 0xFF, 0x30, 0x9F, 0xFE, 0x4F, 0xC4, 0x08, 0x12, 0x25, 0x99, 0xE2,
+        0x28, 0x4E, 0x66, 0x98, 0x7A, 0x6F, 0x3A, 0x89, 0x65, 0xBE, 0x74, 0x20, 0x9B, 0xA6, 0x9C, 0x4C,
+        0x4E, 0xB7, 0xAC, 0xA2, 0x0E, 0x82, 0x80, 0x83, 0x10, 0x40, 0x43, 0xAB, 0xFC, 0x7F, 0xFF, 0xF4,
+        0xF7, 0x3C, 0xD9, 0x09, 0x20, 0x30, 0xA8, 0x4C, 0xC0, 0xEF, 0xA7, 0x6A, 0x5E, 0x3F, 0x41, 0x5F,
+        0x00, 0x17, 0x12, 0x39, 0xE9, 0x5C, 0x96, 0x8B, 0x21, 0x20, 0xB5, 0x64, 0x0C, 0x59, 0xD3, 0xC4,
+        0xC1, 0xA9, 0x80, 0x13, 0x84, 0x44, 0xC1, 0x06, 0xA6, 0x9A, 0x9E, 0x37, 0x8B, 0x3A, 0x56, 0x8E,
+        0xCF, 0x28, 0xC9, 0xD1, 0x69, 0x8E, 0xDA, 0xB1, 0x84, 0x6D, 0xBF, 0x87, 0xF8, 0xBF, 0xF3, 0x1C,
+        0x05, 0x10, 0x02, 0x84, 0x48, 0x1B, 0x18, 0x34, 0x21, 0x77, 0x8B, 0x64, 0xE7, 0x12, 0x6F, 0x16,
+        0x05, 0xA2, 0x92, 0x01, 0x04, 0x03, 0x0A, 0x12, 0x40, 0x83, 0x17, 0xE6, 0xF5, 0x24, 0x7A, 0x76,
+        0xD3, 0x3C, 0x65, 0x9D, 0x95, 0xA9, 0x66, 0x48, 0x0C, 0xC2, 0x42, 0x01, 0xB6, 0xF5, 0x92, 0x79,
+        0x9A, 0x73, 0x2F, 0x46, 0x29, 0x4D, 0x07, 0xFC, 0x97, 0xC7, 0x37, 0xFA, 0x3D, 0x8D, 0x48, 0x62,
+        0xA4, 0x82, 0x90, 0x02, 0x9F, 0x60, 0x3F, 0xF4, 0x1B, 0x5B, 0x6B, 0x1D, 0x85, 0x87, 0xF1, 0x7D,
+        0x7F, 0x6A, 0xD0, 0xF4, 0xCC, 0xC3, 0x38, 0xC8, 0xF2, 0xBC, 0x6B, 0x5F, 0x1F, 0x47, 0x9F, 0x77,
+        0x6E, 0x7E, 0x4C, 0x5B, 0xAF, 0xCF, 0x76, 0x2A, 0xB0, 0xD3, 0x3D, 0xF5, 0xC7, 0x1A, 0xE6, 0xBA,
+        0x8E, 0xA5, 0x9B, 0x6A, 0x55, 0x42, 0x46, 0xA8, 0xE0, 0xBE, 0xCC, 0xB8, 0x32, 0xE2, 0xD3, 0xA3,
+        0x7E, 0xEE, 0x79, 0x0F, 0x04, 0x51, 0x30, 0x5B, 0x1A, 0x07, 0xD2, 0x78, 0xD9, 0x3F, 0xBF, 0x3A,
+        0x7C, 0x13, 0xE1, 0x24, 0xDA, 0xAF, 0x4C, 0xB3, 0xFC, 0xDC, 0x87, 0xAE, 0xA6, 0xD9, 0x2A, 0xB4,
+        0x11, 0x1C, 0x1D, 0xC1, 0x15, 0x85, 0x50, 0x0F, 0x2C, 0x73, 0xB4, 0x6D, 0x5A, 0x3C, 0x15, 0x0D,
+        0x09, 0xE0, 0x66, 0x46, 0xCF, 0x07, 0xA5, 0xF0, 0xBE, 0x58, 0xE5, 0xAF, 0x0D, 0xD8, 0xC1, 0x73,
+        0x88, 0xD5, 0x2B, 0x5C, 0xC5, 0xC3, 0xD8, 0x28, 0x99, 0x8A, 0x7B, 0xED, 0x1C, 0x9B, 0x5B, 0xB3,
+        0xF0, 0xA6, 0x29, 0xFF, 0x3E, 0x3E, 0x10, 0x62, 0xCA, 0x87, 0x0B, 0x45, 0xF4, 0x1C, 0x16, 0x1D,
+        0xC4, 0xE0, 0xC4, 0x5C, 0x48, 0x7E, 0xA0, 0xFC, 0x01, 0xF5, 0x07, 0xB0, 0x7D, 0x07, 0xD4, 0x5C,
+        0x87, 0xB8, 0xA7, 0xE0, 0x70, 0xFD, 0x4E, 0x12, 0x50, 0x20, 0x03, 0x21, 0x83, 0xC1, 0xED, 0x8E,
+        0x57, 0xCB, 0x3E, 0x1C, 0x7A, 0x75, 0x72, 0x02, 0x32, 0x82, 0x92, 0xE3, 0x13, 0x63, 0xD4, 0xA5,
+        0x76, 0x87, 0xD9, 0x05, 0x4E, 0xF1, 0xFF, 0xFF, 0xFF, 0x65, 0x8F, 0xF0, 0x8F, 0xE2, 0x4D, 0xB1,
+        0xD0, 0x14, 0x96, 0x02, 0x67, 0x46, 0x06, 0x25, 0xD0, 0x98, 0xE8, 0x08, 0x29, 0x02, 0x47, 0x08,
+        0xFD, 0x0F, 0xBA, 0x3B, 0x1F, 0x13, 0x5C, 0x97, 0x35, 0x87, 0x31, 0x5E, 0xAF, 0x17, 0x86, 0x03,
+        0xC5, 0xE2, 0xF1, 0x68, 0x83, 0xA9, 0xB0, 0x3E, 0x07, 0xC0, 0xF8, 0xA7, 0xB2, 0xBC, 0x19, 0x68,
+        0x14, 0x1C, 0x79, 0x27, 0xA4, 0x55, 0x46, 0x0B, 0xC6, 0xF4, 0xC9, 0x71, 0x8C, 0x55, 0xB7, 0x61,
+        0x59, 0x56, 0x3E, 0xF1, 0x60, 0x95, 0x15, 0xB7, 0xFD, 0x3F, 0xB1, 0xFA, 0x9C, 0xEF, 0x2B, 0x07,
+        0x7E, 0x46, 0x2C, 0x52, 0x93, 0x86, 0x4F, 0x03, 0x34, 0x84, 0xC0, 0x2C, 0x08, 0xA9, 0x55, 0x2A,
+        0x47, 0x40, 0xC7, 0x39, 0x07, 0x84, 0x2C, 0x94, 0x4C, 0x07, 0x48, 0xED, 0x1D, 0xAB, 0xCB, 0x15,
+        0x71, 0x57, 0x97, 0x80, 0xDC, 0x68, 0xF3, 0xA4, 0xD4, 0xA3, 0x6B, 0x07, 0x3B, 0x56, 0x46, 0xC2,
+        0x0C, 0xA8, 0x35, 0xCF, 0xCF, 0xCE, 0x9F, 0x01, 0x78, 0x35, 0x37, 0xAB, 0xF3, 0x2C, 0xFF, 0x1A,
+        0x49, 0x70, 0xC8, 0x5C, 0x26, 0xAF, 0xE4, 0x57, 0xB0, 0xBC, 0xCB, 0xD1, 0x0D, 0x89, 0x91, 0xF2,
+        0x35, 0xC5, 0x78, 0x71, 0x34, 0x03, 0x48, 0xC3, 0x8B, 0x45, 0x25, 0xCF, 0x81, 0xF0, 0x4B, 0x54,
+        0xF5, 0x57, 0x65, 0xB8, 0x30, 0xC0, 0x98, 0x4E, 0x2C, 0x19, 0x8E, 0x87, 0xA4, 0x42, 0x79, 0x70,
+        0xCE, 0x7E, 0x50, 0xB5, 0xBE, 0xD7, 0xFF, 0xC4, 0xF9, 0x5E, 0x7F, 0x9F, 0x5F, 0x08, 0x31, 0x65,
+        0x43, 0x85, 0xA2, 0xFA, 0x0E, 0x0B, 0x0E, 0xA2, 0x50, 0x5E, 0x2E, 0x02, 0x22, 0xD0, 0x02, 0x28,
+        0x20, 0x3C, 0xC0, 0xEC, 0x07, 0x00, 0xF5, 0x17, 0x21, 0x6A, 0x1C, 0x80, 0x61, 0x0D, 0x1C, 0x28,
+        0x38, 0x06, 0x05, 0x67, 0x8B, 0x44, 0x1D, 0xD0, 0xC4, 0xD8, 0x25, 0xAA, 0x9B, 0x2D, 0xC1, 0x8F,
+        0x46, 0x98, 0x17, 0x0C, 0x46, 0xC3, 0xD2, 0x51, 0x54, 0xC8, 0x79, 0x4E, 0x33, 0xDE, 0x9F, 0xFE,
+        0xE3, 0xFF, 0x07, 0xFE, 0x20, 0xDB, 0x5D, 0x00, 0xDF, 0x94, 0xFE, 0xFB, 0x90, 0xF6, 0x14, 0x5B,
+        0xA4, 0xD6, 0xC1, 0x25, 0x04, 0xB8, 0x1E, 0xA0, 0x79, 0xE3, 0xCF, 0xA5, 0xF2, 0xAE, 0x15, 0xC2,
+        0xB4, 0x76, 0x34, 0x32, 0x20, 0x00, 0x00, 0x3C, 0x5E, 0x2F, 0x5B, 0xE3, 0x6E, 0x18, 0x1A, 0x20,
+        0x1E, 0x24, 0x26, 0x28, 0x2A, 0x30, 0x2E, 0x38, 0x3E, 0x41, 0xBF, 0x7F, 0xEF, 0x1F, 0xFD, 0xC2,
+        0x67, 0xD0, 0x36, 0x4E, 0xDA, 0x4F, 0x9B, 0xC4, 0x5F, 0xBF, 0xDA, 0x50, 0x02, 0xAE, 0x7B, 0x3F,
+        0xFC, 0x4A, 0x7F, 0xF2, 0xE2, 0x23, 0x21, 0xAD, 0x1C, 0x25, 0xF0, 0x47, 0x4F, 0x27, 0xFC, 0x97,
+        0x89, 0xC1, 0xF2, 0x1F, 0x86, 0x58, 0x72, 0x6D, 0xCD, 0x16, 0x4E, 0x2A, 0xDD, 0xF5, 0x3B, 0xA9,
+        0xF6, 0xD0, 0xE8, 0x9F, 0xA2, 0x6E, 0x89, 0x36, 0xCD, 0x9E, 0xED, 0x72, 0x4E, 0xE9, 0xD4, 0xF2,
+        0x3C, 0x81, 0x49, 0xC6, 0x99, 0x82, 0x8C, 0x5D, 0x63, 0x13, 0xAC, 0xEB, 0x75, 0x3C, 0xD4, 0x5F,
+        0x45, 0x56, 0xE1, 0xC1, 0x8B, 0x2E, 0x5C, 0xDC, 0x3A, 0x78, 0x65, 0xFF, 0xE7, 0xF2, 0x40, 0xB0,
+        0x64, 0x57, 0x35, 0x25, 0x9A, 0x3A, 0x3A, 0x4E, 0x95, 0x22, 0x51, 0x6C, 0x70, 0xCD, 0x58, 0x87,
+        0x02, 0x1C, 0x07, 0x5C, 0x87, 0x0A, 0x6D, 0x6B, 0x34, 0xAB, 0xDA, 0xC1, 0x74, 0x44, 0xB4, 0xE5,
+        0x75, 0xC6, 0xB7, 0x88, 0x2C, 0x3A, 0x2B, 0x1C, 0x9A, 0xD0, 0xAA, 0x36, 0xCC, 0x4E, 0xC5, 0x08,
+        0x54, 0x47, 0x40, 0x53, 0xCF, 0xD1, 0x59, 0x3F, 0x58, 0x4A, 0xCE, 0xFD, 0x62, 0xC1, 0x71, 0x2A,
+        0xC8, 0x20, 0x89, 0x46, 0x48, 0x58, 0xC4, 0xA9, 0xF0, 0xFB, 0x75, 0x4E, 0x81, 0x2D, 0x8F, 0x45,
+        0x60, 0x4E, 0xAD, 0x8C, 0x2B, 0x4B, 0xAB, 0x09, 0xE9, 0x4B, 0x93, 0x89, 0x87, 0x81, 0x5E, 0x64,
+        0x77, 0x13, 0x51, 0xB6, 0x9B, 0x71, 0x54, 0x8B, 0xEF, 0xE3, 0x94, 0x96, 0x75, 0x9A, 0x94, 0x51,
+        0x02, 0xA6, 0x6C, 0xB9, 0x79, 0xA1, 0x7C, 0xE8, 0x86, 0x14, 0x89, 0x73, 0x29, 0x7C, 0x29, 0xC4,
+        0x8C, 0x6F, 0xC6, 0xF0, 0x93, 0xA5, 0x45, 0x0C, 0x79, 0x17, 0x23, 0xF1, 0x4F, 0x62, 0xF1, 0x53,
+        0xAA, 0x7E, 0x2C, 0xAC, 0xF9, 0x1C, 0x22, 0xD9, 0x45, 0xB2, 0xCC, 0xEB, 0x1E, 0xDB, 0x3D, 0xC3,
+        0x45, 0xE9, 0xA8, 0xEC, 0x33, 0x01, 0xE4, 0x3F, 0x82, 0xAC, 0x85, 0x0F, 0xD1, 0x2F, 0x02, 0xBC,
+        0x77, 0x06, 0x54, 0xF1, 0x14, 0xF3, 0xF5, 0x72, 0xAC, 0x9F, 0xD5, 0xBC, 0x24, 0xA3, 0xCE, 0x38,
+        0xE3, 0x31, 0x86, 0xFF, 0x3E, 0xDF, 0x31, 0xBA, 0x71, 0xF2, 0x80, 0x65, 0x9A, 0x96, 0x26, 0x44,
+        0xE9, 0x41, 0x7A, 0xF6, 0xB9, 0x37, 0xB6, 0xE4, 0x61, 0xC2, 0xB6, 0xF5, 0x38, 0x55, 0xE0, 0x4B,
+        0x68, 0xFC, 0xF2, 0xDE, 0x1A, 0xE1, 0xBD, 0x2B, 0x2B, 0xC2, 0x20, 0x24, 0x36, 0xE6, 0xCB, 0x85,
+        0x00, 0xCA, 0x86, 0x69, 0xFB, 0xAD, 0x78, 0x3C, 0x22, 0xE0, 0x4D, 0xFC, 0xD8, 0x46, 0x70, 0xD4,
+        0x88, 0x65, 0x5B, 0x4F, 0x0A, 0xDA, 0x78, 0x6B, 0xDB, 0xBA, 0xC8, 0x93, 0x22, 0x0C, 0x48, 0x72,
+        0x25, 0xD6, 0xAF, 0x81, 0x87, 0x8D, 0x9B, 0xBD, 0xBA, 0xEC, 0x0C, 0xEE, 0x8F, 0x30, 0x68, 0x6C,
+        0x7A, 0x53, 0x38, 0xA6, 0xDD, 0x30, 0xDC, 0xE3, 0x47, 0xEA, 0x5A, 0x4D, 0x9F, 0x62, 0xB6, 0x7E,
+        0xB1, 0x55, 0x99, 0xFA, 0xC6, 0x82, 0xF2, 0x52, 0x90, 0x41, 0x0E, 0x8C, 0x60, 0xAF, 0x89, 0x80,
+        0x85, 0x87, 0x70, 0x68, 0x86, 0x33, 0x6A, 0xF3, 0x58, 0xBC, 0x25, 0xDD, 0xC5, 0x1C, 0xE4, 0x9C,
+        0xA4, 0x4C, 0x34, 0x0C, 0x23, 0x96, 0xC9, 0xB7, 0x76, 0x5D, 0x17, 0xD9, 0x1C, 0x8F, 0xA2, 0x5A,
+        0x23, 0x99, 0xB1, 0x17, 0x3A, 0x10, 0x70, 0xE8, 0xD0, 0xC4, 0xAD, 0x14, 0x09, 0x08, 0x04, 0x00,
+        0x68, 0xAB, 0x83, 0xC9, 0xCD, 0xDD, 0xC1, 0xC5, 0x99, 0x36, 0x5D, 0x8A, 0xA9, 0xB0, 0x45, 0x33,
+        0xA0, 0x81, 0xCA, 0x62, 0x20, 0x31, 0xB2, 0x49, 0x86, 0xC1, 0x05, 0xDA, 0x34, 0x3C, 0x1D, 0x24,
+        0x4D, 0x12, 0xE0, 0x4C, 0xCD, 0xC9, 0x2E, 0xEC, 0x3D, 0xD9, 0xFD, 0x1A, 0x5A, 0x19, 0x5C, 0xF3,
+        0x7A, 0xA8, 0x1B, 0xC8, 0x5C, 0x74, 0x8E, 0xA2, 0x97, 0x90, 0xBB, 0xEE, 0xB4, 0xF3, 0x04, 0x2F,
+        0x96, 0x61, 0x16, 0x6F, 0x03, 0x33, 0x71, 0xB4, 0xD8, 0x03, 0x9C, 0x72, 0xED, 0x37, 0xDF, 0x90,
+        0x40, 0x08, 0x00, 0xC7, 0x15, 0x8E, 0xAA, 0xBC, 0x53, 0xB8, 0x2D, 0x0E, 0x83, 0x10, 0xB8, 0x15,
+        0x46, 0x36, 0x27, 0xBA, 0x78, 0xA9, 0x11, 0x4F, 0x58, 0xB3, 0xBB, 0xE4, 0x3F, 0xB5, 0x68, 0x4A,
+        0xB9, 0x44, 0x80, 0x01, 0x16, 0x98, 0x96, 0xAB, 0x30, 0xA6, 0x08, 0x29, 0x6F, 0xC7, 0x68, 0x8F,
+        0x1E, 0xE1, 0x0D, 0xD4, 0xC8, 0x91, 0xCC, 0x49, 0xCB, 0xA7, 0x23, 0x00, 0x69, 0xD1, 0xE5, 0x39,
+        0x19, 0xC8, 0xDC, 0x90, 0x4C, 0x29, 0x79, 0x25, 0x68, 0x13, 0xCA, 0xA6, 0xC7, 0x07, 0x82, 0xB3,
+        0x87, 0xF9, 0x7F, 0xE1, 0xCF, 0x55, 0xC7, 0x12, 0x5E, 0xEB, 0xCC, 0xC0, 0xF9, 0xF5, 0x3B, 0x49,
+        0x3C, 0x97, 0xC7, 0x62, 0x04, 0x5A, 0x06, 0xA6, 0xAE, 0x99, 0x67, 0xE3, 0xDF, 0x59, 0x24, 0xB0,
+        0x7B, 0x13, 0x9D, 0xA2, 0xD7, 0x39, 0x65, 0xFD, 0x56, 0x0E, 0x08, 0x54, 0x52, 0x21, 0x21, 0x2A,
+        0x52, 0xB1, 0x97, 0xE3, 0x30, 0xD0, 0x4F, 0x05, 0x37, 0xE1, 0xB3, 0x4A, 0xF1, 0x74, 0x1E, 0x32,
+        0x58, 0x9C, 0x0C, 0xD2, 0x20, 0x25, 0x34, 0xE0, 0xA7, 0x59, 0xC4, 0xC0, 0x34, 0x66, 0x8D, 0x4D,
+        0x1C, 0x60, 0x8A, 0x32, 0x11, 0x16, 0x39, 0x5F, 0x4B, 0xFF, 0xC1, 0x3D, 0x50, 0xBE, 0x92, 0x92,
+        0xF4, 0x14, 0xE9, 0x9B, 0x0E, 0x09, 0x5C, 0xE0, 0xA0, 0xC0, 0x81, 0x36, 0xEF, 0xE8, 0x1B, 0x8F,
+        0xD4, 0x63, 0x67, 0x20, 0x82, 0x81, 0xC3, 0xC2, 0x02, 0x8E, 0x0C, 0x0A, 0xCB, 0xB6, 0xFE, 0x9F,
+        0xD5, 0xBE, 0xF4, 0x66, 0x68, 0x3A, 0x40, 0x2E, 0x1C, 0x0A, 0x10, 0x22, 0x97, 0x69, 0x99, 0x69,
+        0x7B, 0x33, 0xAB, 0x5B, 0xBE, 0x0E, 0x01, 0x88, 0x24, 0x6B, 0x1F, 0x3F, 0x13, 0x59, 0xD3, 0xA9,
+        0x7A, 0x70, 0x53, 0x42, 0xF4, 0xC5, 0x5C, 0x00, 0x70, 0xF6, 0x5E, 0x06, 0xFA, 0x92, 0x9E, 0x27,
+        0x12, 0xF0, 0xE8, 0xAE, 0xA6, 0x05, 0x66, 0x11, 0x89, 0xA9, 0xC3, 0x35, 0xA4, 0xE4, 0x11, 0xA3,
+        0xB4, 0x70, 0x75, 0x2A, 0x4D, 0x19, 0x1C, 0x83, 0x5F, 0xBB, 0xA0, 0x34, 0xB6, 0x72, 0x4A, 0x73,
+        0x42, 0x56, 0x9A, 0xC8, 0x22, 0xF4, 0x77, 0xA1, 0xBF, 0x05, 0xE7, 0xE3, 0xBD, 0x4B, 0x88, 0x1B,
+        0xE1, 0xB3, 0x8B, 0x34, 0xAD, 0x2E, 0xC2, 0xEE, 0xA6, 0xF5, 0x7C, 0xE7, 0xC4, 0xC7, 0xFF, 0xA7,
+        0xD1, 0xCC, 0x99, 0xE0, 0x6D, 0x7D, 0x1D, 0x64, 0x52, 0x20, 0x4E, 0xA4, 0x3E, 0x33, 0x8C, 0xC7,
+        0x5E, 0xCD, 0x24, 0xE4, 0xCE, 0x81, 0x97, 0x4D, 0xB1, 0x45, 0x35, 0x21, 0x2C, 0xB8, 0xCD, 0x5A,
+        0x71, 0x35, 0xCE, 0x8B, 0x3D, 0x65, 0x19, 0xEA, 0xE6, 0xB1, 0x92, 0xB5, 0x68, 0x14, 0x1C, 0x46,
+        0x34, 0x71, 0x15, 0x51, 0xFC, 0x9E, 0x28, 0xD3, 0x09, 0xF5, 0xC3, 0x19, 0x88, 0xBC, 0xB3, 0xE1,
+        0x9C, 0x0A, 0x93, 0x28, 0x72, 0x76, 0x34, 0xDB, 0xB5, 0xD2, 0xA4, 0x30, 0x70, 0x38, 0x03, 0x7F,
+        0x60, 0xFF, 0x38, 0xFF, 0xFD, 0x8F, 0x12, 0x80, 0xAD, 0x22, 0x96, 0x14, 0x94, 0x13, 0x8C, 0x0A,
+        0x88, 0x08, 0x86, 0x1D, 0xED, 0xAE, 0x58, 0xD2, 0x24, 0xF0, 0x51, 0x14, 0x74, 0x22, 0x42, 0xBE,
+        0x39, 0xD1, 0xBE, 0x24, 0xD3, 0x81, 0xB3, 0x07, 0x97, 0x0C, 0xBE, 0x26, 0x41, 0xC4, 0xE1, 0x86,
+        0x5F, 0xCA, 0x78, 0x1C, 0x29, 0xEA, 0xF0, 0x68, 0xD0, 0x11, 0x13, 0xA0, 0x4B, 0x5C, 0xF8, 0x68,
+        0x1D, 0x5D, 0x29, 0xD5, 0xC4, 0x0F, 0x7C, 0x4B, 0x80, 0x81, 0x60, 0x98, 0x19, 0x2C, 0x27, 0x2B,
+        0xE1, 0x78, 0x4E, 0x98, 0xE1, 0x9A, 0xA8, 0xDB, 0x90, 0xE4, 0x60, 0xFE, 0x97, 0xEE, 0xE5, 0xFC,
+        0x4C, 0x9A, 0x11, 0x58, 0x4C, 0xC2, 0xEF, 0xAD, 0xAB, 0xE3, 0x95, 0x1B, 0xC1, 0x98, 0x64, 0x84,
+        0x5D, 0x5E, 0x2E, 0x0C, 0x4C, 0x3A, 0x70, 0x3B, 0xC2, 0x39, 0xBE, 0x0E, 0x67, 0x7E, 0x44, 0x61,
+        0xC0, 0xE3, 0x84, 0xF2, 0xF1, 0xC0, 0xB0, 0xF0, 0xE9, 0x08, 0x48, 0x51, 0x1A, 0x22, 0xF1, 0xCE,
+        0x77, 0xC0, 0x38, 0xDF, 0x8E, 0x96, 0x03, 0xA9, 0x55, 0x68, 0x57, 0x3D, 0x6F, 0x19, 0x39, 0x4E,
+        0x97, 0x93, 0x91, 0xA4, 0x59, 0xE1, 0x8D, 0xA6, 0xC2, 0x09, 0x98, 0x42, 0x81, 0x2A, 0x65, 0xEC,
+        0xA0, 0xE5, 0xB0, 0x3F, 0xB0, 0xFE, 0xF5, 0xDF, 0x96, 0x5E, 0xCE, 0x75, 0xD9, 0x92, 0x63, 0x4B,
+        0x84, 0xEA, 0x89, 0xA0, 0xA9, 0xC5, 0x90, 0x75, 0x93, 0xA5, 0xF4, 0xCE, 0x91, 0x41, 0x05, 0x65,
+        0x41, 0x6E, 0x05, 0xE5, 0x93, 0x78, 0x41, 0x25, 0x01, 0x1C, 0x5D, 0x54, 0xEA, 0x69, 0x04, 0x4A,
+        0x8A, 0x84, 0x70, 0x9E, 0x00, 0xE3, 0x78, 0x2A, 0x2A, 0x9D, 0x20, 0x94, 0x3D, 0x67, 0xA9, 0x28,
+        0x0F, 0xAD, 0xF1, 0x6A, 0xA6, 0x8C, 0x5E, 0xAC, 0xA1, 0x5E, 0x0B, 0xAC, 0xD1, 0x59, 0xE3, 0x9D,
+        0x64, 0xD9, 0xE1, 0x7C, 0x31, 0xC3, 0x5C, 0xB1, 0xB6, 0x78, 0x63, 0xA7, 0x9A, 0xCE, 0xC5, 0xFD,
+        0x2F, 0xDD, 0xC9, 0xF7, 0xB0, 0x66, 0x45, 0x69, 0xB6, 0x13, 0x31, 0x13, 0x8B, 0x75, 0x61, 0x32,
+        0x9C, 0x73, 0xE3, 0x62, 0xAC, 0x92, 0x62, 0x2F, 0x0D, 0x38, 0x4E, 0x27, 0xA2, 0xE7, 0x86, 0xF8,
+        0x66, 0x21, 0xE1, 0xC2, 0x48, 0x9E, 0x9D, 0x05, 0x4D, 0x6A, 0xF1, 0x57, 0x88, 0x27, 0xA9, 0xA8,
+        0x2A, 0x2A, 0xF8, 0x9C, 0x4E, 0x01, 0x3E, 0xB7, 0x88, 0xBD, 0x31, 0x06, 0x03, 0x80, 0x40, 0xC3,
+        0x46, 0x33, 0xC7, 0x3C, 0x58, 0x20, 0x9A, 0x4E, 0x0A, 0x4F, 0x0C, 0x72, 0xC6, 0x98, 0xE1, 0xBF,
+        0x0F, 0x16, 0x48, 0xAD, 0x32, 0x95, 0xD0, 0x32, 0x17, 0xA0, 0x02, 0x6F, 0xFF, 0xB6, 0xFD, 0xAF,
+        0x09, 0x2B, 0x30, 0xE5, 0x72, 0xD4, 0x46, 0x48, 0x0F, 0x20, 0x3C, 0x60, 0xF2, 0xEB, 0x35, 0x91,
+        0x0D, 0x82, 0xB7, 0x8B, 0x52, 0x33, 0xB2, 0xB3, 0x76, 0x69, 0x4D, 0x28, 0x9B, 0x4B, 0xBC, 0xF5,
+        0x5B, 0xB3, 0x68, 0xB6, 0x9B, 0x4D, 0xEE, 0x5F, 0x59, 0x7E, 0x8C, 0x7A, 0xBD, 0x9E, 0x9E, 0x94,
+        0xFA, 0xA4, 0xF3, 0x5B, 0x32, 0x6C, 0x66, 0xBF, 0x3E, 0x27, 0xCC, 0x29, 0x20, 0x06, 0x48, 0xA1,
+        0x16, 0x32, 0xEA, 0x43, 0x91, 0x8F, 0xAD, 0xDB, 0xF5, 0x24, 0xC5, 0x3A, 0x12, 0x15, 0x29, 0x8D,
+        0x73, 0x21, 0x5C, 0x7E, 0x9D, 0xB5, 0x7A, 0xFC, 0xE4, 0xB6, 0xB0, 0xF1, 0x1B, 0xB0, 0x3E, 0x84,
+        0x62, 0xCA, 0xDC, 0x71, 0x1B, 0x6D, 0xC4, 0xDE, 0x97, 0x3A, 0x9A, 0x7E, 0x18, 0x24, 0xE3, 0xC5,
+        0xE1, 0x03, 0xBA, 0xE8, 0x93, 0x06, 0x7E, 0xC3, 0x46, 0x96, 0x78, 0x99, 0xB1, 0xE1, 0x8E, 0x8F,
+        0xE0, 0xAD, 0x47, 0x8C, 0xAE, 0xBA, 0x6A, 0x61, 0x88, 0x1F, 0x2C, 0x45, 0x09, 0xF0, 0xCE, 0x4A,
+        0x1D, 0x9F, 0xA7, 0x1C, 0x2A, 0x26, 0x06, 0x22, 0x31, 0x96, 0x39, 0x6E, 0x43, 0x5C, 0x96, 0xB7,
+        0x59, 0x19, 0x8B, 0x90, 0xCA, 0x58, 0x7B, 0xAB, 0xB4, 0xCD, 0x9B, 0x8C, 0x8D, 0x36, 0xD6, 0x7D,
+        0x5A, 0x7A, 0x1E, 0x88, 0x5D, 0xA1, 0xE9, 0xBC, 0xF4, 0x9D, 0x45, 0xA1, 0xA5, 0x28, 0xD8, 0xEC,
+        0x21, 0x28, 0xB8, 0x62, 0x69, 0xC6, 0x75, 0xDF, 0xC3, 0x8A, 0x8D, 0x0F, 0x91, 0x13, 0x99, 0x1D,
+        0xA5, 0x2D, 0xC4, 0x30, 0xD3, 0x0F, 0x42, 0xF5, 0x79, 0xD2, 0x8A, 0x7D, 0x1D, 0x3C, 0x1B, 0xF3,
+        0x5B, 0x54, 0xF4, 0x46, 0xE4, 0xB1, 0x6A, 0x19, 0x6B, 0x30, 0x88, 0xA9, 0xA0, 0x22, 0x78, 0xCE,
+        0x09, 0x4E, 0x9C, 0x08, 0x46, 0x80, 0x8A, 0x9D, 0x10, 0x14, 0x20, 0x60, 0xE1, 0xEA, 0x74, 0x2A,
+        0x0A, 0x7C, 0x38, 0x88, 0x51, 0x47, 0x82, 0xB0, 0x28, 0xA2, 0x28, 0x52, 0xC1, 0xD0, 0xD0, 0x8A,
+        0x1A, 0x34, 0x09, 0x0D, 0x0F, 0x2C, 0xF4, 0xB6, 0x3C, 0x15, 0x91, 0x98, 0x20, 0x40, 0xC2, 0x84,
+        0x98, 0x2E, 0xC1, 0xCC, 0xE5, 0x7E, 0x73, 0x6F, 0xD7, 0x79, 0x5F, 0x94, 0xA3, 0x0E, 0x76, 0x91,
+        0x0A, 0x88, 0x5D, 0x2D, 0xB9, 0xF8, 0xC5, 0x04, 0xAB, 0xD2, 0x85, 0xB8, 0xE4, 0x23, 0x63, 0xBD,
+        0x22, 0x7B, 0x65, 0xFE, 0x8D, 0x33, 0xD2, 0xE3, 0x52, 0x9F, 0xC3, 0x0C, 0x9C, 0x18, 0xBF, 0x20,
+        0x67, 0x5D, 0x32, 0x5C, 0xCF, 0xE4, 0x68, 0x52, 0xD5, 0x13, 0x14, 0x85, 0x83, 0x8B, 0x18, 0x60,
+        0xA4, 0x5F, 0xCF, 0x3B, 0x2F, 0x28, 0xD6, 0x72, 0xCB, 0xAD, 0x5A, 0x37, 0x08, 0x5D, 0x4C, 0x29,
+        0x2E, 0x13, 0x18, 0x00, 0x34, 0xA4, 0x02, 0xC7, 0xA2, 0xE0, 0xBE, 0x5B, 0xE1, 0x94, 0x6C, 0x43,
+        0x83, 0xA1, 0xE2, 0x71, 0x85, 0x43, 0x54, 0x74, 0x49, 0x55, 0x1E, 0x0E, 0x9C, 0x68, 0x51, 0xAA,
+        0x24, 0xA2, 0x84, 0x0D, 0x4D, 0x45, 0x08, 0x14, 0x2F, 0x0E, 0x60, 0xF9, 0x8C, 0xC3, 0x8F, 0x04,
+        0x38, 0xF0, 0x32, 0x3C, 0x66, 0x1C, 0x35, 0x61, 0x21, 0xA4, 0xE8, 0xB0, 0x9E, 0x58, 0xF0, 0xE3,
+        0xD9, 0x90, 0xB2, 0x7F, 0x19, 0x2B, 0x88, 0xF0, 0xAC, 0x00, 0x02, 0x84, 0xC7, 0xFB, 0x02, 0xA6,
+        0xBF, 0xCD, 0x7D, 0x7B, 0x13, 0xCD, 0xAB, 0x24, 0xEA, 0x38, 0xC6, 0x46, 0x1E, 0x8C, 0x05, 0xE7,
+        0xD3, 0x9E, 0xDC, 0x40, 0x0E, 0x6F, 0x0D, 0xD2, 0xA9, 0x18, 0x9D, 0xF0, 0xDD, 0x47, 0x19, 0x71,
+        0x4A, 0xB5, 0xD4, 0xEF, 0x12, 0x13, 0x67, 0x97, 0xB1, 0xCC, 0xC5, 0xEF, 0x2E, 0x8B, 0xC9, 0xD8,
+        0xC8, 0xEE, 0xB3, 0x36, 0x5E, 0xD8, 0x2C, 0xE6, 0xBB, 0x38, 0xEC, 0xD8, 0x90, 0x33, 0xEF, 0xE0,
+        0xB9, 0x2E, 0x58, 0xEF, 0x8D, 0xCE, 0x36, 0x33, 0x52, 0x52, 0xE6, 0x86, 0x73, 0xAC, 0x89, 0x0C,
+        0x4E, 0x4B, 0x4F, 0x6B, 0xAF, 0x75, 0x32, 0x88, 0x6E, 0x32, 0x39, 0x77, 0x9E, 0x8F, 0x9F, 0x6E,
+        0x07, 0x50, 0xA7, 0x8E, 0xF4, 0xF3, 0xD7, 0x6A, 0x33, 0x0C, 0x0A, 0x2E, 0xE1, 0x4C, 0x2D, 0xD6,
+        0x75, 0x2C, 0x43, 0x92, 0xA9, 0x75, 0x78, 0xDD, 0x48, 0x0C, 0x15, 0x92, 0xC2, 0xEF, 0x59, 0x00,
+        0x39, 0x86, 0x39, 0xC2, 0x2D, 0x86, 0x25, 0xEB, 0xE7, 0x1B, 0x8B, 0x3C, 0xD6, 0xCA, 0xB9, 0x2F,
+        0x76, 0x3B, 0x8B, 0xEF, 0x66, 0xF9, 0xCA, 0x0E, 0x51, 0xA6, 0x53, 0xCA, 0x0B, 0x47, 0xA5, 0x5C,
+        0xF9, 0x3E, 0xFF, 0x44, 0x91, 0xE3, 0xB2, 0xAA, 0xBD, 0xDA, 0xF3, 0x1D, 0xE1, 0x4D, 0x99, 0xF8,
+        0x21, 0x06, 0x66, 0x64, 0xFB, 0xBC, 0xD9, 0x0B, 0xBE, 0x56, 0xFD, 0x33, 0x88, 0xFF, 0xC7, 0xF7,
+        0xBA, 0x87, 0xE3, 0x7D, 0x4A, 0x78, 0x56, 0x30, 0x3A, 0x73, 0x1E, 0x79, 0xA1, 0x15, 0x09, 0x2D,
+        0x0F, 0x09, 0x09, 0x04, 0xCB, 0xFE, 0x6D, 0xD6, 0xBF, 0x42, 0x05, 0xB2, 0x34, 0xCF, 0x0F, 0x5D,
+        0x87, 0x55, 0x00, 0x4D, 0x81, 0x0C, 0x03, 0x8F, 0x4E, 0x58, 0x69, 0x6D, 0xA5, 0x0C, 0xAC, 0x94,
+        0x0C, 0x88, 0x0F, 0x4B, 0xF2, 0xCF, 0x48, 0xE9, 0x58, 0x1B, 0x5E, 0xC5, 0x18, 0x15, 0x96, 0x04,
+        0xD6, 0x6B, 0x6F, 0x5D, 0xB8, 0x92, 0xB8, 0xCD, 0x64, 0xF3, 0xAC, 0x8C, 0x83, 0xB5, 0xB2, 0x55,
+        0xCC, 0x64, 0x67, 0x59, 0x1E, 0xFC, 0x6D, 0x89, 0x21, 0x95, 0x6A, 0x43, 0x91, 0x35, 0x97, 0x30,
+        0x4A, 0xF7, 0x8C, 0xD4, 0xDE, 0x32, 0xE7, 0x4F, 0xBD, 0x10, 0x95, 0xBA, 0x65, 0xD6, 0xD1, 0x0D,
+        0x92, 0x0E, 0x18, 0x9A, 0xCC, 0x39, 0xD6, 0x6B, 0x7C, 0x16, 0x67, 0x59, 0xA9, 0x13, 0x8B, 0xA6,
+        0x58, 0xA1, 0x7B, 0x86, 0xF0, 0xAC, 0x63, 0x4C, 0x24, 0x58, 0x10, 0xA4, 0x42, 0xDF, 0x89, 0x7A,
+        0x26, 0x5F, 0x8D, 0xD5, 0x48, 0x1A, 0x9A, 0x57, 0xE0, 0x9C, 0x54, 0xD4, 0x0D, 0x23, 0x5A, 0x11,
+        0x5A, 0x33, 0x94, 0x0A, 0xCC, 0x12, 0xC1, 0x13, 0x66, 0x4E, 0x0C, 0xC3, 0x06, 0x12, 0x28, 0x20,
+        0xB0, 0x06, 0x45, 0xE4, 0x1B, 0xDE, 0x53, 0xEB, 0x8A, 0x7F, 0xF4, 0xD6, 0x3E, 0x05, 0xBC, 0x0F,
+        0xE3, 0x38, 0x36, 0xA3, 0xA8, 0x4D, 0xE4, 0xFC, 0x67, 0xE7, 0x3C, 0x96, 0xAB, 0x84, 0xFF, 0x73,
+        0x66, 0xFF, 0xC8, 0x0F, 0xBB, 0x05, 0xFE, 0x39, 0xD4, 0x89, 0x86, 0xA2, 0xE7, 0xA9, 0x21, 0xBF,
+        0x9C, 0x81, 0x2B, 0x80, 0x02, 0xC0, 0x1B, 0x7F, 0xB9, 0x73, 0xFF, 0x41, 0xAE, 0xA1, 0xAA, 0xAF,
+        0xE3, 0x78, 0x79, 0x0B, 0x0F, 0x94, 0x4A, 0x88, 0xA3, 0xA0, 0x98, 0xD8, 0xA9, 0xE4, 0x92, 0x1F,
+        0xC8, 0xDB, 0x1F, 0xED, 0x3F, 0x02, 0xF2, 0x5E, 0x91, 0xBA, 0xE7, 0x18, 0x0D, 0x4A, 0x4B, 0x02,
+        0x63, 0x44, 0x2B, 0x1A, 0x0D, 0x08, 0x10, 0x6F, 0x1B, 0xC6, 0x77, 0xC0, 0xEF, 0x82, 0x33, 0x72,
+        0x1D, 0xF0, 0x6F, 0x19, 0xA3, 0x90, 0xEF, 0x83, 0x78, 0xC3, 0xBE, 0x08, 0xDE, 0x33, 0x72, 0x6E,
+        0x43, 0xBE, 0x0C, 0x1D, 0xC8, 0x77, 0xC1, 0xBC, 0x66, 0xE4, 0x10, 0xE8, 0x00, 0x46, 0x60, 0x88,
+        0xAA, 0x7D, 0x19, 0x7B, 0xBE, 0xBF, 0xEC, 0x92, 0x84, 0xD4, 0x42, 0xD4, 0x25, 0xF5, 0xC8, 0x83,
+        0xB2, 0x02, 0x77, 0xD6, 0xEB, 0xEB, 0x92, 0x9A, 0xA3, 0xC3, 0x0E, 0x9C, 0xF9, 0x05, 0x8A, 0x1F,
+        0x61, 0xC3, 0xC6, 0x63, 0x6A, 0xAA, 0xAF, 0x50, 0x27, 0xFE, 0x89, 0x30, 0x38, 0x7F, 0xE8, 0x2A,
+        0xD4, 0x1B, 0x55, 0xB4, 0x6E, 0x2F, 0x1C, 0x61, 0xAA, 0x87, 0x91, 0x03, 0x3D, 0x3A, 0xE1, 0x7E,
+        0xA8, 0x64, 0xAD, 0xF6, 0xAC, 0x73, 0x9A, 0x3E, 0xC2, 0x87, 0x45, 0x7A, 0x4C, 0xCF, 0xC3, 0x0C,
+        0x98, 0x1E, 0x53, 0xEE, 0xF2, 0xF1, 0x5E, 0xE0, 0x04, 0x45, 0x20, 0x80, 0x74, 0x00, 0x23, 0x78,
+        0xCD, 0xC9, 0xB9, 0x06, 0xF1, 0x83, 0xB9, 0x0E, 0xF8, 0x37, 0x8C, 0xDC, 0x80, 0xF7, 0xC1, 0x9B,
+        0x90, 0xEF, 0x83, 0x78, 0x8C, 0xDC, 0x9B, 0x90, 0x3B, 0xE3, 0x0E, 0xF8, 0x27, 0x7C, 0x0E, 0xF8,
+        0x37, 0x21, 0xDF, 0x08, 0x03, 0x06, 0x45, 0x84, 0x33, 0x22, 0x0D, 0x50, 0xD1, 0x81, 0x24, 0x1A,
+        0x1A, 0xCF, 0xC4, 0x19, 0xD7, 0x72, 0x73, 0x5F, 0x03, 0xFA, 0x09, 0x26, 0x15, 0x38, 0x31, 0x88,
+        0x74, 0x01, 0x0F, 0xE2, 0x87, 0x86, 0x21, 0x8F, 0x28, 0x26, 0xE2, 0x6A, 0xE9, 0x50, 0x9F, 0xA2,
+        0x7B, 0xFE, 0x2A, 0xAB, 0x50, 0x66, 0xA8, 0x6A, 0xBF, 0x57, 0x3E, 0xDC, 0xBB, 0x27, 0xE1, 0x13,
+        0x44, 0x78, 0x8C, 0xB4, 0x5A, 0x32, 0x94, 0xD8, 0x94, 0x7F, 0x2D, 0xB1, 0x71, 0xA7, 0x64, 0x3E,
+        0x74, 0x1B, 0xF0, 0xBF, 0x05, 0xE0, 0xF9, 0x2D, 0x3E, 0x12, 0x8E, 0x11, 0x59, 0xA0, 0xA0, 0x03,
+        0x88, 0x00, 0x04, 0x6E, 0x43, 0xBE, 0x07, 0x7C, 0x3B, 0xE0, 0xC1, 0xEF, 0x80, 0xDE, 0x37, 0x8C,
+        0xDC, 0x80, 0xF7, 0xC1, 0xBC, 0x61, 0xDF, 0x06, 0xF1, 0x19, 0xB9, 0x0E, 0xF8, 0x37, 0x8C, 0xDC,
+        0x82, 0x37, 0x8D, 0xE3, 0x37, 0x21, 0xDF, 0x06, 0x02, 0x0C, 0x30, 0x10, 0x40, 0x06, 0xA0, 0x63,
+        0x0D, 0x3B, 0x75, 0x97, 0xE1, 0x3B, 0xBF, 0x69, 0x45, 0xE4, 0xE9, 0x22, 0x74, 0xFC, 0xB9, 0x5B,
+        0x23, 0xF5, 0x89, 0x69, 0x4F, 0xA3, 0x0B, 0x39, 0xC4, 0x16, 0x87, 0x78, 0x36, 0xEC, 0x6F, 0xDB,
+        0x96, 0x55, 0x6B, 0xA8, 0x23, 0xFF, 0x44, 0x68, 0x1A, 0xBF, 0xF4, 0x15, 0x6A, 0x0F, 0xAA, 0xCA,
+        0x36, 0x97, 0x90, 0x31, 0x0D, 0x44, 0xC8, 0x81, 0x39, 0xD1, 0x8B, 0xCA, 0xA4, 0x49, 0x38, 0xEF,
+        0x6E, 0x6D, 0xDE, 0x19, 0xFF, 0x0F, 0x58, 0xF3, 0xF4, 0x83, 0x06, 0x34, 0xD4, 0x47, 0xB2, 0xE0,
+        0xF4, 0x4C, 0x17, 0x2F, 0x19, 0xA2, 0xA6, 0x10, 0xBC, 0x02, 0xE8, 0x8C, 0xDC, 0x87, 0x7C, 0x1B,
+        0xC6, 0x1D, 0xF0, 0x46, 0xF1, 0xBC, 0x66, 0xE4, 0x3B, 0xE0, 0x2C, 0xDC, 0x87, 0x7C, 0x1B, 0xC6,
+        0x6E, 0x0C, 0x3B, 0xE0, 0xDE, 0x30, 0xEF, 0x81, 0xD3, 0x80, 0x92, 0xA1, 0x2A, 0x10, 0x03, 0xDB,
+        0x8F, 0xD3, 0xFC, 0xE4, 0x64, 0x20, 0x4A, 0x63, 0x45, 0x02, 0x4D, 0xD7, 0x67, 0x1E, 0x13, 0x48,
+        0x19, 0xD5, 0x59, 0x6F, 0x76, 0x45, 0xEA, 0x87, 0x0D, 0x70, 0xE8, 0x48, 0x89, 0x51, 0x33, 0x0F,
+        0x5E, 0x45, 0x1B, 0xBD, 0x58, 0x1A, 0x84, 0x40, 0x02, 0x4F, 0xFF, 0xC9, 0xFF, 0xEE, 0x01, 0x8E,
+        0x20, 0x18, 0xE2, 0x31, 0xD0, 0x50, 0x04, 0xB1, 0x35, 0x27, 0x12, 0x0E, 0x26, 0xAD, 0x54, 0x91,
+        0x55, 0x35, 0x6A, 0xAD, 0x0A, 0xBC, 0x48, 0x2A, 0xB4, 0x21, 0xD4, 0x9C, 0x48, 0x38, 0x9A, 0x2B,
+        0x55, 0x27, 0x12, 0x2A, 0xF1, 0x20, 0xAA, 0x2B, 0xC4, 0xD4, 0x94, 0x2A, 0xF1, 0x35, 0x68, 0x15,
+        0x5A, 0xA9, 0xAB, 0x40, 0xE2, 0x6A, 0xF1, 0x24, 0x0E, 0x24, 0x55, 0xE2, 0x4A, 0xA9, 0xAB, 0x45,
+        0x52, 0x55, 0x5E, 0x24, 0x55, 0xA1, 0x56, 0x90, 0xC7, 0x41, 0x40, 0x1F, 0xFF, 0xFF, 0xFF, 0x09,
+        0x0A, 0x00, 0x20, 0xE0, 0x02, 0x07, 0xF7, 0xF3, 0x48, 0x87, 0x2A, 0x1C, 0xA8, 0x87, 0x9D, 0x00,
+        0xF3, 0xA0, 0x1E, 0x74, 0x42, 0x66, 0x84, 0x79, 0xA4, 0x79, 0xA2, 0x44, 0x3C, 0xE8, 0x1E, 0x74,
+        0x0F, 0x07, 0xA0, 0x1E, 0x74, 0x08, 0xF3, 0x48, 0x39, 0xA1, 0x13, 0x95, 0x39, 0xB1, 0x04, 0x3C,
+        0xE8, 0x1E, 0x74, 0x03, 0xCE, 0x82, 0x13, 0x34, 0x8F, 0x34, 0x8F, 0x34, 0xD0, 0x00, 0x80, 0x01,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1C,
+        0x00, 0x0F, 0xFF, 0xE4, 0x4F, 0xFF, 0xFF, 0x22, 0x80, 0x00, 0x00, 0x00, 0x0A, 0x99, 0x02, 0xB7,
+        0xD5, 0x80, 0x31, 0x60, 0x09, 0x33, 0x43, 0xCF, 0xDF, 0xCD, 0x22, 0x72, 0x8A, 0x1C, 0xA8, 0x72,
+        0xA0, 0x1E, 0x0F, 0x40, 0xF3, 0xA0, 0x79, 0xD0, 0x26, 0x0E, 0x91, 0x39, 0xB1, 0x0E, 0x54, 0x0B,
+        0x16, 0x00, 0xC7, 0x7E, 0x2C, 0x00, 0xA2, 0x40, 0xC7, 0x9A, 0x47, 0x9A, 0x44, 0x39, 0x45, 0x0F,
+        0x3A, 0x07, 0x9D, 0x00, 0x3C, 0x1E, 0x84, 0xCD, 0x08, 0xF3, 0x48, 0xF1, 0x0A, 0x2F, 0xFF, 0xFF,
+        0xFF, 0x40, 0xC0, 0x11, 0x18, 0xA6, 0x38, 0x8C, 0x50, 0x88, 0xAA, 0xF1, 0x22, 0xAD, 0x54, 0x9C,
+        0x4D, 0x5A, 0x20, 0x71, 0x35, 0x35, 0x68, 0x43, 0x15, 0x78, 0x29, 0x07, 0x12, 0x2A, 0xF1, 0x25,
+        0x0A, 0xBC, 0x14, 0xD4, 0x95, 0x56, 0xAA, 0x6A, 0xD0, 0xAB, 0x25, 0x57, 0x89, 0x07, 0x12, 0x2A,
+        0xF1, 0x20, 0x96, 0x26, 0xAD, 0x54, 0x95, 0x52, 0x71, 0x35, 0x64, 0x85, 0x5A, 0xA9, 0xAB, 0x42,
+        0x1D, 0x49, 0x2C, 0x48, 0xAB, 0x55, 0x6A, 0xA4, 0xAA, 0x9A, 0x2B, 0x55, 0x25, 0x55, 0x80, 0x02,
+        0xBF, 0xFF, 0xF0, 0xA0, 0xFF, 0xFF, 0x02, 0xF0, 0x01, 0x00, 0x00, 0x03, 0x00, 0x40, 0x00, 0x00,
+        0x20, 0x01, 0x00, 0x30, 0x04, 0x00, 0x00, 0x02, 0x00, 0x50, 0x04, 0x00, 0x00, 0x58, 0xEF, 0xD3,
+        0xBC, 0xB0, 0x24, 0xDC, 0x18, 0x17, 0x23, 0x70, 0x05, 0x85, 0x8B, 0x1D, 0xE0, 0xD7, 0x78, 0xB1,
+        0x61, 0x06, 0x3B, 0xDB, 0xEF, 0x16, 0x2C, 0x20, 0x5E, 0x25, 0xC2, 0x6E, 0x02, 0x18, 0xB1, 0xDE,
+        0xD3, 0xBC, 0xC3, 0xB8, 0x30, 0x2F, 0x12, 0xE1, 0x34, 0x3C, 0x2C, 0x58, 0xEF, 0xD0, 0x3B, 0xCD,
+        0xF7, 0x85, 0x8B, 0x01, 0xDF, 0xAE, 0xF1, 0x62, 0xC0, 0x2C, 0x77, 0xB5, 0xDE, 0x2C, 0x05, 0x85,
+        0x8E, 0xF6, 0xBB, 0xC2, 0x30, 0x2F, 0x12, 0xE4, 0x4B, 0x82, 0x4D, 0xC0, 0x60, 0x5E, 0x25, 0xC0,
+        0xD7, 0x78, 0xDF, 0x78, 0xB1, 0xC3, 0xC6, 0xE1, 0x37, 0x00, 0x60, 0x3A, 0x00, 0x10, 0x00, 0x00,
+        0x00, 0x00, 0x06, 0x00, 0x20, 0x00, 0x40, 0x00, 0x80, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00, 0x7F,
+        0xF8, 0x14, 0x3F, 0xE0, 0x36, 0x78, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x1D, 0xED, 0x77, 0x8B, 0x16,
+        0x04, 0xBC, 0x4B, 0x93, 0x70, 0x18, 0x03, 0x78, 0x85, 0xC8, 0xDC, 0x26, 0xE0, 0x23, 0x02, 0xF1,
+        0x2E, 0x11, 0xB8, 0x24, 0xDC, 0x06, 0x17, 0x23, 0x70, 0x05, 0x85, 0x8B, 0x1D, 0xE0, 0xD7, 0x78,
+        0xB0, 0xB1, 0x06, 0x3B, 0xDB, 0xEF, 0x16, 0x2C, 0x20, 0x5E, 0x25, 0xC2, 0x6E, 0x02, 0x18, 0xB0,
+        0xEF, 0xD3, 0xBC, 0xC3, 0xB8, 0x0C, 0x2F, 0x12, 0xE1, 0x10, 0xEF, 0x16, 0x2C, 0x77, 0xE8, 0x1D,
+        0xE6, 0xFB, 0xC2, 0xC5, 0x80, 0xEF, 0xD7, 0x78, 0xB0, 0xB0, 0x16, 0x3B, 0xDA, 0xEF, 0x16, 0x02,
+        0xC2, 0xC7, 0x7B, 0x5D, 0xE0, 0x2C, 0xEF, 0xD0, 0xB3, 0xBC, 0x24, 0xDC, 0x06, 0x05, 0xE2, 0x5C,
+        0xB0, 0x02, 0x00, 0x10, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x03, 0x00, 0x02,
+        0xA0, 0xA5, 0xFF, 0xE9, 0xF3, 0xFF, 0xBE, 0x50, 0x08, 0x00, 0x40, 0x08, 0x02, 0x00, 0x00, 0x00,
+        0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02, 0x00, 0x20, 0xEF, 0x54, 0x3B, 0x39, 0x4A, 0x19,
+        0x04, 0x90, 0x89, 0x9F, 0xFF, 0xB3, 0xFA, 0xF3, 0x1B, 0x48, 0xF1, 0x87, 0x18, 0x71, 0x8D, 0x4A,
+        0xAA, 0xD9, 0x74, 0x1B, 0x34, 0xD2, 0xD9, 0xD1, 0xB4, 0xD1, 0x2D, 0xA5, 0xAD, 0xAB, 0x6D, 0x0A,
+        0x64, 0x19, 0x19, 0x8C, 0x86, 0x73, 0x5B, 0xC2, 0x9F, 0xFF, 0xFB, 0x1F, 0xA1, 0x45, 0xA5, 0x46,
+        0x2C, 0x41, 0xC3, 0x04, 0x30, 0xC3, 0x14, 0x5A, 0xDE, 0x97, 0x6B, 0x6E, 0xD6, 0x8E, 0xB6, 0xDB,
+        0xA6, 0xDD, 0x36, 0xEA, 0x2E, 0xDA, 0xDD, 0xB5, 0xD7, 0x4E, 0xAA, 0x18, 0x61, 0x82, 0x48, 0x83,
+        0x84, 0x69, 0x08, 0x8D, 0xFF, 0xFA, 0xBF, 0xC1, 0x9C, 0xE9, 0x75, 0xDC, 0x5A, 0xB6, 0x59, 0x92,
+        0x5C, 0xA1, 0xEA, 0xDA, 0xD6, 0xD5, 0xB4, 0xA3, 0x56, 0xB5, 0xA6, 0x8B, 0xA0, 0x3A, 0x9A, 0x85,
+        0xDC, 0xD4, 0x6C, 0x51, 0xC6, 0x1C, 0x63, 0x4C, 0x27, 0xFF, 0xF5, 0x3F, 0x6A, 0x8A, 0xC7, 0x94,
+        0x48, 0xC3, 0x87, 0xEF, 0xED, 0x22, 0x5B, 0x8B, 0x00, 0x00, 0x00, 0x20, 0x00, 0x80, 0x04, 0x00,
+        0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x40, 0x01, 0x80, 0x03, 0xFD, 0xF4, 0xBF, 0x7E,
+        0x26, 0xFE, 0x20, 0x00, 0x0E, 0x5C, 0x40, 0xE6, 0xC8, 0xCC, 0xB8, 0x45, 0x20, 0x12, 0x30, 0x0E,
+        0x1D, 0x5F, 0xA5, 0x4D, 0x0F, 0xFF, 0xD5, 0xFD, 0x59, 0xCA, 0xA4, 0x59, 0xC3, 0x90, 0x19, 0x00,
+        0x88, 0x00, 0xF2, 0xF0, 0xE0, 0x70, 0x99, 0x26, 0x10, 0xA8, 0x42, 0x50, 0xA1, 0x28, 0x4A, 0x92,
+        0x25, 0x10, 0xA1, 0x44, 0x25, 0x83, 0x50, 0x92, 0x88, 0x30, 0x41, 0x08, 0x30, 0x43, 0x06, 0x70,
+        0xE9, 0x13, 0xFF, 0xFC, 0x0F, 0xDA, 0x9A, 0x7E, 0x57, 0xD2, 0x34, 0x3B, 0x2C, 0x81, 0x98, 0x12,
+        0x00, 0x51, 0x81, 0x11, 0x42, 0xA2, 0x92, 0xAC, 0x1A, 0x28, 0x88, 0x55, 0x11, 0x11, 0x0A, 0xA2,
+        0x14, 0x15, 0x44, 0x28, 0x8A, 0x51, 0x0B, 0x4F, 0x10, 0x94, 0x61, 0x02, 0x10, 0x03, 0x8B, 0x43,
+        0xFF, 0xF4, 0x7F, 0x5E, 0xB3, 0x2C, 0x1A, 0x80, 0x25, 0xA7, 0x51, 0x41, 0x54, 0x2A, 0x11, 0x10,
+        0x86, 0x66, 0x4C, 0x39, 0x93, 0x0E, 0x13, 0xC0, 0x4C, 0xE1, 0x33, 0x09, 0x92, 0x66, 0x5F, 0x04,
+        0x38, 0x4C, 0x21, 0xC8, 0x1E, 0x77, 0xF1, 0x49, 0x48, 0x9F, 0xFF, 0xD8, 0xFD, 0xA9, 0xF0, 0x11,
+        0x38, 0x72, 0x05, 0x28, 0x51, 0x02, 0x0B, 0xC6, 0xBF, 0x57, 0xE8, 0xC0, 0x6B, 0x2D, 0xB8, 0x02,
+        0xA1, 0x55, 0xFE, 0xDD, 0xBF, 0xC5, 0x68, 0x04, 0x00, 0x00, 0x00, 0x01, 0x80, 0x40, 0x06, 0x01,
+        0x00, 0x18, 0x02, 0x00, 0x40, 0x0C, 0x02, 0x00, 0x31, 0xCA, 0x65, 0x09, 0xBE, 0x52, 0xF9, 0xDF,
+        0x18, 0x59, 0x02, 0x66, 0x11, 0x9C, 0xFF, 0xFE, 0x4F, 0xF7, 0xF4, 0x0C, 0xD1, 0x17, 0x20, 0x2C,
+        0x40, 0x71, 0xC0, 0xB9, 0x43, 0x2D, 0xC2, 0xF3, 0x44, 0xCE, 0xE1, 0x78, 0xD0, 0x06, 0x51, 0xCD,
+        0x80, 0x28, 0x46, 0xF3, 0x43, 0x01, 0x21, 0x23, 0x21, 0x36, 0x8D, 0x2B, 0x97, 0x5F, 0x66, 0x3B,
+        0xFF, 0xFC, 0xB7, 0xEF, 0xA8, 0xDD, 0x29, 0x3C, 0x54, 0x70, 0xD1, 0x41, 0x41, 0x01, 0x02, 0x08,
+        0x56, 0x1B, 0xCD, 0x71, 0x73, 0x5C, 0x42, 0x2D, 0xCB, 0x3B, 0x4E, 0xF0, 0x76, 0xBB, 0xCE, 0x0E,
+        0xB0, 0xC0, 0xC2, 0x03, 0x00, 0x0C, 0x40, 0x91, 0x44, 0xCE, 0x23, 0x31, 0xFF, 0xFC, 0x7F, 0xF0,
+        0xF4, 0xCD, 0xCF, 0xD3, 0x9E, 0xD8, 0xD2, 0x70, 0x52, 0x03, 0x06, 0x50, 0x31, 0xE6, 0x84, 0x46,
+        0x58, 0x8C, 0xA3, 0x22, 0xDE, 0x6F, 0x36, 0x24, 0x54, 0x79, 0xB1, 0x8C, 0xDE, 0x6C, 0x8B, 0x16,
+        0x02, 0x18, 0x49, 0x03, 0x28, 0x8C, 0xFF, 0xFF, 0x25, 0xFC, 0x15, 0x1B, 0x84, 0xA7, 0x8B, 0x8E,
+        0x0A, 0x31, 0x66, 0x6C, 0x60, 0xC6, 0x59, 0xA0, 0x01, 0x00, 0x02, 0x00, 0x10, 0x00, 0x60, 0x01,
+        0x00, 0x02, 0x00, 0x20, 0x00, 0x20, 0x00, 0x80, 0x04, 0x00, 0x10, 0x00, 0x1F, 0xFC, 0x37, 0x3F,
+        0xFC, 0x2C, 0x48, 0x16, 0x00, 0x00, 0x8B, 0x9B, 0xC6, 0x59, 0x2C, 0x8C, 0x12, 0x45, 0x03, 0x52,
+        0x82, 0x2A, 0x7A, 0xF3, 0xFA, 0x64, 0xA8, 0x3F, 0xFF, 0x95, 0xFD, 0xED, 0x03, 0x54, 0x45, 0x49,
+        0x0D, 0x14, 0x14, 0x30, 0x51, 0x01, 0x47, 0x9B, 0xCD, 0xE3, 0x19, 0x19, 0x78, 0xC1, 0x64, 0xBC,
+        0x62, 0x47, 0x8D, 0xE4, 0x1B, 0x1C, 0x88, 0x73, 0x72, 0xF2, 0x51, 0x83, 0x01, 0x00, 0x00, 0x00,
+        0x61, 0x24, 0x09, 0x98, 0x2E, 0x80, 0xAF, 0xFF, 0xF2, 0x1F, 0xC2, 0x51, 0x9F, 0xF4, 0xF7, 0xE9,
+        0x7A, 0x4E, 0x86, 0x86, 0x87, 0x03, 0x04, 0x1B, 0xE5, 0x0C, 0x61, 0x97, 0x19, 0x94, 0x73, 0x7E,
+        0x52, 0x3E, 0x56, 0x63, 0x08, 0x32, 0xC9, 0x1C, 0x63, 0x31, 0x8C, 0x60, 0x22, 0x86, 0x92, 0x2A,
+        0x81, 0x29, 0xEF, 0xFF, 0xE5, 0x7F, 0x7B, 0x44, 0xD5, 0x31, 0x92, 0x42, 0x4B, 0x5B, 0xEB, 0x38,
+        0x26, 0x11, 0x08, 0xC1, 0x42, 0x12, 0x5C, 0x88, 0x63, 0x2E, 0x60, 0xD8, 0xE5, 0xC0, 0x8E, 0x5C,
+        0xB8, 0x10, 0x00, 0x41, 0x41, 0xC0, 0x0F, 0x8E, 0xFE, 0x18, 0xBA, 0x43, 0xFF, 0xFF, 0xCB, 0x7F,
+        0x09, 0x46, 0xE1, 0x19, 0x81, 0xE3, 0x03, 0x86, 0x0A, 0x10, 0x00, 0x80, 0x65, 0x32, 0xE5, 0x8E,
+        0x5C, 0x1B, 0x85, 0xCB, 0x20, 0x02, 0xA1, 0x31, 0xFF, 0xEF, 0x7B, 0xFF, 0xCA, 0x68, 0x03, 0x00,
+        0x80, 0x0C, 0x00, 0x00, 0x40, 0x06, 0x01, 0x00, 0x18, 0x00, 0x00, 0x80, 0x0C, 0x01, 0x00, 0x11,
+        0xCA, 0x01, 0x78, 0x97, 0x19, 0x71, 0x82, 0x8A, 0x1E, 0x50, 0xD9, 0x6F, 0xFF, 0xA3, 0xFC, 0x5C,
+        0x92, 0xB3, 0x44, 0x48, 0x0D, 0x0C, 0x0C, 0x72, 0x91, 0x26, 0xE2, 0xC6, 0x58, 0x12, 0xCE, 0xF7,
+        0x0E, 0xF7, 0x03, 0x37, 0x14, 0x96, 0x3B, 0xC2, 0x89, 0x20, 0xC2, 0x2E, 0x26, 0xAF, 0x1B, 0xEB,
+        0xE7, 0xFA, 0x63, 0x3F, 0xFF, 0x45, 0xF9, 0x09, 0x76, 0x08, 0x4B, 0x0F, 0x14, 0x1C, 0x10, 0x10,
+        0x00, 0x41, 0x03, 0x1C, 0xEE, 0x16, 0x37, 0x9A, 0x4A, 0xC0, 0x3B, 0x4E, 0x69, 0xDA, 0x4C, 0x3B,
+        0x10, 0xB9, 0x4B, 0x96, 0x2A, 0xC0, 0x80, 0x81, 0x04, 0x04, 0x20, 0xB1, 0x42, 0xCA, 0x23, 0x3D,
+        0xFF, 0xF5, 0x3F, 0x89, 0x94, 0x62, 0x5F, 0xE3, 0xF3, 0xE2, 0xE2, 0xF1, 0x29, 0xA2, 0x09, 0x40,
+        0xB7, 0x2D, 0xCF, 0x72, 0xDC, 0x12, 0x2C, 0xB1, 0x73, 0x66, 0x76, 0x40, 0xEF, 0x70, 0x73, 0xDC,
+        0xD0, 0xC1, 0x45, 0x0B, 0x20, 0x5C, 0xF1, 0x7F, 0xFF, 0xA4, 0xFC, 0x64, 0x9A, 0xC3, 0x24, 0x87,
+        0x8C, 0x16, 0x3F, 0x9F, 0x7C, 0xB9, 0xBC, 0xA0, 0xC0, 0x1D, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0x00, 0x08, 0x00, 0x30, 0x01, 0x00, 0x01, 0x00, 0x08, 0x00, 0x30, 0x01, 0x00, 0x01, 0xFF,
+        0xD6, 0x5D, 0xFF, 0x8A, 0x15, 0x45, 0x48, 0x00, 0x40, 0x5B, 0xBF, 0x7D, 0xEB, 0x16, 0x04, 0x11,
+        0x00, 0x43, 0x40, 0x45, 0xF1, 0xDF, 0xC3, 0x1B, 0x35, 0xFF, 0xF4, 0xBF, 0x8B, 0x9A, 0x6E, 0x98,
+        0xA8, 0xE1, 0x63, 0x02, 0x86, 0x0E, 0x20, 0x18, 0x6B, 0xC0, 0x6B, 0xC6, 0x84, 0x91, 0x8E, 0x4D,
+        0xE3, 0x97, 0x00, 0x43, 0x2F, 0x94, 0x8E, 0x32, 0x4D, 0xF1, 0x80, 0x82, 0x06, 0x10, 0x00, 0x40,
+        0xA3, 0x07, 0x94, 0x26, 0x78, 0xCF, 0xFF, 0xD3, 0x7E, 0x42, 0x4C, 0xFE, 0xDD, 0x78, 0x5E, 0x4B,
+        0x05, 0x60, 0x14, 0x21, 0x00, 0x1E, 0x21, 0x8B, 0xE5, 0x90, 0x8C, 0x07, 0x9B, 0x81, 0x80, 0x18,
+        0xC8, 0xE0, 0xCB, 0x26, 0x53, 0x03, 0x2E, 0x4D, 0xFC, 0x61, 0x63, 0x84, 0x8A, 0x1A, 0x50, 0xA9,
+        0x2F, 0xFF, 0xA1, 0xFC, 0x5C, 0xC2, 0xF4, 0x46, 0x4B, 0x0D, 0x1F, 0x96, 0x40, 0x0C, 0xB9, 0x94,
+        0x90, 0x5E, 0x58, 0xCC, 0x65, 0xE3, 0x97, 0x00, 0x0D, 0xBB, 0xDA, 0x6D, 0x5F, 0x88, 0x84, 0x0A,
+        0x11, 0x3A, 0xDF, 0x1B, 0xE3, 0x3E, 0x18, 0xBA, 0x43, 0xBF, 0xFF, 0x55, 0xF8, 0xA9, 0x56, 0x06,
+        0xCB, 0x13, 0x20, 0x24, 0x30, 0x30, 0x80, 0x47, 0x9D, 0xC0, 0x22, 0x06, 0x50, 0xC1, 0xA6, 0x5C,
+        0xB9, 0x40, 0x02, 0xA1, 0x5D, 0xFF, 0xCD, 0xD7, 0xFE, 0xB6, 0xC0, 0x00, 0x00, 0x00, 0x20, 0x08,
+        0x00, 0x00, 0x30, 0x08, 0x00, 0x40, 0x08, 0x02, 0x00, 0x00, 0x04, 0x00, 0x8E, 0x50, 0xB9, 0x65,
+        0x04, 0x58, 0xC0, 0xC2, 0x0B, 0x20, 0x6C, 0xB7, 0xFF, 0x63, 0xF3, 0xF1, 0x49, 0xCD, 0x15, 0x18,
+        0x34, 0x40, 0x50, 0xDF, 0x27, 0x2E, 0x74, 0xE8, 0x3B, 0x2B, 0x4D, 0x95, 0xA6, 0x95, 0x13, 0xA2,
+        0xDA, 0x6A, 0xBA, 0x94, 0xCD, 0x48, 0xD4, 0x14, 0x15, 0x2A, 0xD5, 0xA6, 0xBB, 0x31, 0x9F, 0xFE,
+        0xCB, 0xE5, 0xA3, 0x51, 0x17, 0x14, 0x3C, 0x40, 0x90, 0x01, 0x40, 0x05, 0x00, 0x24, 0x46, 0xED,
+        0x9D, 0x74, 0xD3, 0xAB, 0xA4, 0x64, 0x8B, 0x3F, 0xFF, 0xFF, 0xB3, 0x6A, 0xCB, 0x2E, 0x45, 0x3A,
+        0xE9, 0xA6, 0xD7, 0xB2, 0xEA, 0xC0, 0xC1, 0x81, 0x06, 0x14, 0x20, 0xF1, 0x84, 0x48, 0x21, 0x29,
+        0xFF, 0xD9, 0xFC, 0xEC, 0x42, 0xB2, 0xFA, 0xF7, 0x8C, 0x86, 0xCB, 0x26, 0xC0, 0x92, 0x3A, 0x3A,
+        0x57, 0x4A, 0xAE, 0xA0, 0xD6, 0x8E, 0xA8, 0xF7, 0x34, 0xB0, 0x7A, 0x25, 0xB2, 0x8D, 0x2C, 0xEE,
+        0x30, 0x50, 0xC2, 0xC6, 0x15, 0x38, 0x5F, 0xFF, 0xB0, 0xF9, 0xC9, 0x15, 0x87, 0x49, 0x0D, 0x14,
+        0x2C, 0x78, 0xA8, 0x5C, 0xB3, 0x79, 0x59, 0x68, 0x02, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x02,
+        0x00, 0xA0, 0x18, 0x00, 0x80, 0x10, 0x04, 0x00, 0x7F, 0xF5, 0xB6, 0x00, 0xBF, 0xF5, 0xB8, 0x00,
+        0x02, 0xCB, 0x68, 0xF4, 0xCD, 0x12, 0x46, 0x00, 0x08, 0x41, 0x87, 0xAE, 0x7F, 0x0C, 0x64, 0xA7,
+        0xFF, 0x5F, 0xF2, 0xB1, 0x09, 0x4F, 0x0F, 0x18, 0x24, 0x60, 0x30, 0x80, 0x81, 0x00, 0x19, 0x90,
+        0x90, 0xE4, 0x79, 0x23, 0xC8, 0x32, 0x64, 0x7C, 0x38, 0xF1, 0xE1, 0xE3, 0x83, 0x8F, 0x90, 0xE4,
+        0xC7, 0xC3, 0x33, 0x1F, 0x8C, 0x04, 0x20, 0x40, 0x41, 0x03, 0x03, 0x1C, 0x2C, 0xA0, 0xD3, 0x43,
+        0x7F, 0xFB, 0x0F, 0xA4, 0x8D, 0x3F, 0xCB, 0x9F, 0x4B, 0xD8, 0xE8, 0x72, 0x04, 0x26, 0x06, 0x42,
+        0x51, 0x47, 0x02, 0xA2, 0x8C, 0x61, 0x28, 0x47, 0x01, 0xFF, 0xF0, 0x24, 0x42, 0x42, 0x81, 0x04,
+        0x85, 0x80, 0xB0, 0x34, 0x62, 0x21, 0x45, 0x0A, 0x54, 0x29, 0x80, 0x08, 0x06, 0x38, 0x59, 0x82,
+        0xE7, 0x3F, 0xFB, 0x1F, 0x95, 0x90, 0x52, 0x90, 0xA9, 0x20, 0xA5, 0xD3, 0xA1, 0x42, 0xA0, 0x42,
+        0xA1, 0x41, 0x0E, 0x64, 0x9C, 0x38, 0xE6, 0x4C, 0x87, 0x01, 0x99, 0x84, 0x9C, 0x78, 0xF0, 0x98,
+        0x61, 0x20, 0xA1, 0x04, 0x85, 0x1A, 0x78, 0xBF, 0x0C, 0x44, 0xD1, 0x1F, 0xFE, 0xD3, 0xE6, 0xA1,
+        0xD5, 0x19, 0x28, 0x2C, 0x40, 0x10, 0x80, 0x42, 0x00, 0x12, 0x4B, 0xCB, 0x81, 0x1C, 0x60, 0x87,
+        0xAC, 0x77, 0x80, 0x03, 0xCF, 0xF1, 0x57, 0x7F, 0xFF, 0x8A, 0xBF, 0xFC, 0x00, 0x80, 0x01, 0x00,
+        0x18, 0x01, 0x80, 0x0A, 0x00, 0x00, 0x02, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x18, 0x01, 0x00,
+        0x06, 0x00, 0x20, 0x5B, 0xBD, 0x11, 0x9F, 0x78, 0x40, 0x34, 0x89, 0x4A, 0xF5, 0x9D, 0x58, 0x80,
+        0x96, 0x5A, 0x7B, 0xED, 0xA0, 0x2F, 0x4B, 0xDD, 0x8B, 0xDD, 0x81, 0x72, 0xC0, 0x9B, 0xE6, 0xE2,
+        0xF2, 0x82, 0x65, 0x21, 0x37, 0x82, 0x19, 0x51, 0xF3, 0x66, 0x6C, 0x8C, 0x97, 0x2E, 0x14, 0xB1,
+        0x29, 0x35, 0x57, 0x44, 0xD4, 0xC0, 0x04, 0xA7, 0x57, 0x00, 0x26, 0xA2, 0x68, 0x38, 0x14, 0xCB,
+        0x88, 0x63, 0x7C, 0xEF, 0x96, 0x09, 0x78, 0x2F, 0x37, 0x8B, 0x22, 0xF8, 0x3E, 0xF2, 0x5C, 0xB0,
+        0x89, 0x12, 0x01, 0xB9, 0x8D, 0xD9, 0xBB, 0xD0, 0x1B, 0xBD, 0x1B, 0xBD, 0x2F, 0x40, 0xB2, 0x6E,
+        0x0C, 0x4C, 0xD2, 0x40, 0x77, 0x0B, 0x8C, 0x5C, 0xB1, 0x8A, 0x39, 0x73, 0x79, 0x41, 0xC6, 0xF2,
+        0xDF, 0x30, 0x00, 0x60, 0x03, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x08, 0x00,
+        0x40, 0x03, 0x00, 0x0F, 0xF7, 0xFC, 0xFF, 0x7F, 0xE7, 0xF7, 0xFE, 0x7F, 0x7F, 0xC8, 0x00, 0x46,
+        0xF3, 0x4C, 0xB0, 0xB9, 0x60, 0x58, 0x51, 0x78, 0xB8, 0x22, 0x24, 0x25, 0x35, 0x28, 0x62, 0xC9,
+        0xDF, 0x9A, 0xE5, 0xC4, 0x60, 0x2C, 0x97, 0x91, 0x7A, 0x0B, 0x96, 0x03, 0x96, 0x03, 0x96, 0x03,
+        0x76, 0x35, 0x7E, 0xE6, 0xB0, 0x6F, 0x05, 0x39, 0x4C, 0xB1, 0x92, 0x8E, 0x31, 0x92, 0xE5, 0xE6,
+        0xE0, 0x4A, 0x33, 0x37, 0x33, 0xB9, 0x94, 0x30, 0x5C, 0x19, 0xBC, 0x2C, 0xCD, 0xE1, 0x71, 0x32,
+        0x87, 0xA6, 0xBD, 0xD8, 0xC4, 0xFC, 0x34, 0x0C, 0x59, 0x17, 0xCF, 0x7E, 0x7B, 0xE0, 0x3B, 0x34,
+        0xD6, 0x77, 0xEA, 0xC0, 0x6E, 0xCD, 0xDE, 0x8D, 0xDE, 0x84, 0x25, 0xC4, 0x1E, 0x77, 0x96, 0x4D,
+        0x1C, 0x0B, 0x82, 0x3C, 0xD2, 0x05, 0x1C, 0x9D, 0xE3, 0x78, 0xB1, 0x72, 0xE5, 0x13, 0x3B, 0xC5,
+        0xC7, 0x7C, 0xD9, 0x37, 0x96, 0xC0, 0x00, 0x00, 0x00, 0x04, 0x01, 0x80, 0x24, 0x02, 0x00, 0x0F,
+        0xFF, 0xFB, 0xFF, 0x00, 0x03, 0x6F, 0x31, 0xFF, 0x35, 0xFF, 0xF6, 0x60, 0x80, 0x00, 0x0A, 0x18,
+        0x18, 0x00, 0x80, 0xC0, 0x80, 0x08, 0x14, 0xA1, 0xC4, 0xE3, 0x34, 0x2F, 0x0E, 0x2E, 0x13, 0x25,
+        0x3A, 0xCC, 0x45, 0xA0, 0x68, 0xCC, 0x3C, 0x14, 0xCF, 0x5B, 0x84, 0x5A, 0x81, 0x9C, 0x00, 0xC9,
+        0x22, 0xF5, 0xBA, 0x8C, 0xE0, 0x31, 0x0E, 0x03, 0x8F, 0xDD, 0x61, 0xA5, 0xF8, 0x57, 0x89, 0xA3,
+        0x1B, 0xD5, 0x6E, 0x89, 0xD4, 0xC8, 0xFF, 0x3D, 0x84, 0xE7, 0xDF, 0x18, 0x00, 0x05, 0x8D, 0xD0,
+        0x82, 0xE8, 0x9A, 0x13, 0x0A, 0x58, 0x60, 0x91, 0x01, 0x41, 0x01, 0xFF, 0x4F, 0xFE, 0xB0, 0x00,
+        0x31, 0x82, 0xC4, 0x01, 0x04, 0x00, 0x58, 0xF2, 0x90, 0x8C, 0xBC, 0x73, 0xD2, 0xE2, 0x61, 0xC0,
+        0x70, 0x9A, 0x42, 0x78, 0x92, 0x6B, 0x5C, 0xE1, 0x31, 0x13, 0xAB, 0x46, 0x88, 0x9B, 0xE1, 0xBC,
+        0x42, 0xFE, 0x7E, 0xF8, 0x90, 0x83, 0x18, 0xB1, 0x8E, 0x7C, 0x73, 0xC6, 0x70, 0xDC, 0x12, 0x62,
+        0x0B, 0x85, 0x74, 0xF1, 0xBC, 0x38, 0x1D, 0xCB, 0xCE, 0xF9, 0xDE, 0x50, 0x01, 0x82, 0x84, 0xDC,
+        0x37, 0xE7, 0xB9, 0xBF, 0x35, 0x0A, 0xB2, 0xB1, 0x65, 0x56, 0x69, 0x82, 0xAB, 0x23, 0x9D, 0xFC,
+        0xD4, 0x78, 0xEE, 0x20, 0x42, 0x93, 0xAB, 0x86, 0x1F, 0x1B, 0x81, 0x3A, 0xB8, 0x23, 0x3A, 0xB8,
+        0x06, 0x75, 0x31, 0x30, 0x54, 0x95, 0x0C, 0xF8, 0xE7, 0x17, 0xAB, 0x87, 0x57, 0x8B, 0x81, 0x97,
+        0x2C, 0x1C, 0xB9, 0xB3, 0x96, 0xF0, 0x88, 0x35, 0x9E, 0x33, 0x89, 0xA6, 0xF0, 0x18, 0x28, 0x9C,
+        0x19, 0xD6, 0x70, 0xE1, 0xD4, 0x8A, 0x65, 0x59, 0xC0, 0x52, 0x22, 0x18, 0x8D, 0xFC, 0x79, 0xF4,
+        0x5C, 0xC0, 0xA9, 0xA7, 0x3D, 0x37, 0x0F, 0x0C, 0xB0, 0x40, 0x1F, 0xEB, 0x3F, 0xD3, 0x83, 0x04,
+        0x0C, 0x40, 0x70, 0x80, 0x80, 0x01, 0x04, 0x10, 0x48, 0xFE, 0x6C, 0x66, 0x37, 0x25, 0xF3, 0xB8,
+        0x25, 0x53, 0x00, 0x03, 0x53, 0x8D, 0xF5, 0x9C, 0x5E, 0x09, 0xA0, 0x50, 0x35, 0x35, 0x30, 0xF1,
+        0x74, 0x4D, 0x46, 0xF8, 0x2D, 0x44, 0xC5, 0xF0, 0xEF, 0x82, 0xB1, 0x8B, 0x41, 0x34, 0xA7, 0x12,
+        0x21, 0x8C, 0x2C, 0xCD, 0xC5, 0x39, 0xDE, 0x6C, 0x82, 0xB0, 0x4C, 0xD0, 0xE7, 0x79, 0xDC, 0x0A,
+        0x37, 0xC5, 0x84, 0x98, 0x29, 0x4E, 0x39, 0xE0, 0xA6, 0x0B, 0x4F, 0x5B, 0x02, 0xA0, 0x01, 0xFF,
+        0xFB, 0xC6, 0xFF, 0xFD, 0x8F, 0x80, 0x40, 0x00, 0x00, 0xC0, 0x30, 0x05, 0x00, 0x80, 0x0C, 0x02,
+        0x00, 0x10, 0x04, 0x00, 0x00, 0x18, 0x04, 0x1B, 0xCD, 0xCB, 0x83, 0x2E, 0x5E, 0x6E, 0x03, 0x71,
+        0x97, 0x2F, 0x1A, 0x60, 0xCA, 0x38, 0x59, 0x0B, 0x93, 0x72, 0x99, 0x34, 0x70, 0xB8, 0xB8, 0x5E,
+        0x37, 0x29, 0xC1, 0x6E, 0x17, 0x9A, 0x60, 0xC2, 0x98, 0x2C, 0x2E, 0x0B, 0x97, 0x26, 0xE1, 0x44,
+        0xE6, 0xE1, 0x72, 0x69, 0x97, 0x8D, 0xC1, 0x2C, 0x97, 0x0B, 0xCD, 0xCB, 0x8C, 0x06, 0xE5, 0xE6,
+        0xE5, 0xC1, 0x97, 0x2F, 0x11, 0xB9, 0x71, 0x97, 0x06, 0x5C, 0xB8, 0x8C, 0x2E, 0x5E, 0x6E, 0x5C,
+        0x9B, 0x97, 0x28, 0xF3, 0x70, 0xB8, 0xCB, 0x97, 0x8D, 0xCA, 0x38, 0xCB, 0x85, 0xE6, 0xE5, 0xC6,
+        0x14, 0x72, 0xF3, 0x72, 0xE0, 0xCB, 0x97, 0x9B, 0x82, 0x5C, 0x5C, 0x2E, 0x4D, 0xCB, 0x8C, 0x27,
+        0x01, 0xD4, 0xC3, 0x87, 0x45, 0xC3, 0xA1, 0xDC, 0xB8, 0x32, 0xE5, 0xC6, 0x14, 0xD0, 0x01, 0x80,
+        0x01, 0x00, 0x0C, 0x00, 0x40, 0x00, 0xC0, 0x04, 0x00, 0x08, 0x00, 0x50, 0x00, 0x00, 0x04, 0x00,
+        0x00, 0x00, 0x3F, 0xFF, 0xC6, 0x2D, 0xFF, 0xF2, 0xC5, 0x2D, 0x8D, 0x00, 0x08, 0x25, 0x38, 0xDC,
+        0xB9, 0x34, 0xC1, 0x83, 0x72, 0xE3, 0x0B, 0x97, 0x9B, 0x97, 0x20, 0xEE, 0x5C, 0xBC, 0xDC, 0x2E,
+        0x32, 0xE5, 0x1E, 0x37, 0x0B, 0x25, 0xC2, 0xF3, 0x72, 0x8E, 0x30, 0xB9, 0x79, 0xB9, 0x70, 0x65,
+        0x1C, 0xBC, 0xDC, 0x2E, 0x32, 0xE5, 0xC9, 0xA3, 0x97, 0x19, 0x70, 0xBC, 0xDC, 0xB9, 0x78, 0x2D,
+        0xCB, 0xCD, 0xCB, 0x83, 0x2E, 0x5C, 0x16, 0x17, 0x19, 0x72, 0xE4, 0xDC, 0xB8, 0x2C, 0x2E, 0x5E,
+        0x6E, 0x5C, 0x19, 0x70, 0x6F, 0x37, 0x0B, 0x8B, 0x85, 0xC9, 0xB8, 0x34, 0xE3, 0x70, 0xBC, 0xD3,
+        0x0B, 0xC4, 0x6E, 0x59, 0x0B, 0x83, 0x29, 0x82, 0x30, 0xA7, 0x37, 0x0B, 0x93, 0x4C, 0xB8, 0x33,
+        0x70, 0xB2, 0x5C, 0x2F, 0x1A, 0x60, 0xDE, 0x37, 0x05, 0xC2, 0xE3, 0x0A, 0x26, 0x4D, 0xCB, 0x8C,
+        0xB8, 0x5E, 0x6E, 0x0D, 0xC6, 0x17, 0x2F, 0x37, 0x2E, 0x0C, 0x1B, 0x97, 0x9B, 0x85, 0x02, 0xBF,
+        0xFE, 0x31, 0x1F, 0xFC, 0x3D, 0xC0, 0x04, 0x00, 0x80, 0x0C, 0x01, 0x80, 0x04, 0x00, 0x40, 0x08,
+        0x00, 0xC0, 0x18, 0x01, 0x40, 0x10, 0x00, 0x40, 0x08, 0x00, 0x05, 0x8C, 0x65, 0xE3, 0x79, 0xBC,
+        0xDC, 0x46, 0x0C, 0x63, 0x2F, 0x1B, 0xCD, 0x90, 0x46, 0x0C, 0x63, 0x2F, 0x1B, 0xCD, 0x1E, 0x6E,
+        0x30, 0x63, 0x19, 0x78, 0xD1, 0xE6, 0xF3, 0x71, 0x82, 0x41, 0x97, 0x82, 0xD9, 0x26, 0xE3, 0x04,
+        0x83, 0x06, 0xF1, 0xB2, 0x4D, 0xC6, 0x09, 0x01, 0x65, 0xE3, 0x64, 0x9B, 0x8C, 0x62, 0x30, 0x65,
+        0xE6, 0xE3, 0x26, 0xE3, 0x11, 0x8C, 0x19, 0x79, 0xB8, 0xC9, 0xB8, 0x8C, 0x63, 0x06, 0x5E, 0x6E,
+        0x32, 0x68, 0xE3, 0x18, 0xC1, 0x97, 0x9B, 0x8C, 0x19, 0xB8, 0xC6, 0x30, 0x65, 0xE6, 0xE0, 0xB2,
+        0x6E, 0x31, 0x8C, 0x19, 0x78, 0x3B, 0x8C, 0x9B, 0x8C, 0x63, 0x06, 0x0D, 0xE6, 0xE3, 0x26, 0xE3,
+        0x18, 0xC0, 0x59, 0x79, 0xB8, 0xC9, 0xB8, 0xC6, 0x3A, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x02,
+        0x00, 0x20, 0x00, 0x40, 0x02, 0x80, 0x08, 0x00, 0x08, 0x00, 0x40, 0x00, 0x7F, 0xFC, 0x81, 0xDF,
+        0xFC, 0xF2, 0x0D, 0x8F, 0xE0, 0x00, 0x00, 0x01, 0x19, 0x78, 0xD9, 0x06, 0x31, 0x97, 0x82, 0xB2,
+        0xF3, 0x71, 0x83, 0x18, 0xC1, 0xBC, 0x59, 0x79, 0xB8, 0xC1, 0x8C, 0x16, 0x5E, 0x2C, 0xBC, 0xDC,
+        0x60, 0xC1, 0x63, 0x2F, 0x16, 0x5E, 0x6E, 0x30, 0x16, 0x31, 0x97, 0x8B, 0x2F, 0x37, 0x11, 0x83,
+        0x18, 0xCB, 0xC5, 0x97, 0x9A, 0x38, 0xC1, 0x8C, 0x65, 0xE2, 0xCA, 0x3C, 0xDC, 0x60, 0xC6, 0x32,
+        0xF1, 0x46, 0x5E, 0x6E, 0x30, 0x63, 0x19, 0x78, 0x2A, 0xE4, 0xDC, 0x60, 0x90, 0x60, 0xDE, 0x2B,
+        0x93, 0x71, 0x82, 0x40, 0x59, 0x78, 0xAE, 0x4D, 0xC6, 0x08, 0x30, 0x65, 0xE6, 0xF3, 0x72, 0x6E,
+        0x31, 0x18, 0xC1, 0x97, 0x9B, 0xCD, 0xC9, 0xB8, 0x8C, 0x63, 0x06, 0x0B, 0xCD, 0xC9, 0xA3, 0x8C,
+        0x63, 0x06, 0x5E, 0x6F, 0x37, 0x06, 0x6E, 0x31, 0x8C, 0x19, 0x79, 0xB9, 0x60, 0x02, 0x00, 0x40,
+        0x04, 0x00, 0xA0, 0x08, 0x00, 0x20, 0x05, 0xFF, 0xC3, 0xE0, 0x02, 0xBF, 0xFF, 0xEE, 0x75, 0xFF,
+        0xFD, 0xB3, 0x40, 0x10, 0x00, 0x00, 0x04, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0C,
+        0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x85, 0x71, 0x85, 0xC6, 0x5C, 0x61, 0x47, 0x19, 0x71,
+        0x23, 0x2E, 0x32, 0xE0, 0x8C, 0xB8, 0xC2, 0xE3, 0x2E, 0x20, 0xC6, 0x5C, 0x65, 0xC1, 0x97, 0x18,
+        0x37, 0x06, 0x5C, 0x42, 0x17, 0x18, 0x37, 0x18, 0x5C, 0x65, 0xC6, 0x24, 0x08, 0xD3, 0x5B, 0xBD,
+        0x6E, 0xF0, 0x2D, 0xDB, 0x3B, 0xC8, 0x68, 0x30, 0xB8, 0xB8, 0x30, 0xB8, 0xCA, 0x1E, 0xB4, 0xD1,
+        0xBB, 0xCA, 0xF0, 0x8C, 0xB8, 0x2E, 0x0C, 0xB8, 0x22, 0xE1, 0x71, 0x85, 0x90, 0xB8, 0xC0, 0x76,
+        0xCE, 0xF4, 0xD1, 0xAC, 0x37, 0x19, 0x70, 0x65, 0xC6, 0x5C, 0x02, 0x34, 0x67, 0x7A, 0xDD, 0xE8,
+        0x33, 0xBD, 0x6E, 0xF5, 0xA6, 0x81, 0x89, 0x19, 0x71, 0x97, 0x06, 0x5D, 0x00, 0x10, 0x00, 0x10,
+        0x00, 0x80, 0x03, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xFF,
+        0xFC, 0x20, 0xBF, 0xF0, 0xD1, 0x3B, 0xD9, 0x00, 0x02, 0x00, 0x02, 0x21, 0x0B, 0x8C, 0xB8, 0xC2,
+        0xE2, 0x1B, 0xBD, 0x69, 0xA3, 0x4D, 0x0C, 0xB8, 0xCB, 0x83, 0x2E, 0x32, 0xE0, 0x23, 0x46, 0x77,
+        0xAD, 0xDE, 0x16, 0x17, 0x19, 0x71, 0x88, 0x44, 0x49, 0x70, 0x5C, 0x19, 0x70, 0x51, 0xC1, 0x97,
+        0x0B, 0x21, 0x71, 0x80, 0xD9, 0x0B, 0x8C, 0x2C, 0x85, 0xC4, 0x0D, 0x35, 0xBB, 0xD6, 0xEF, 0x20,
+        0xCE, 0xDB, 0xBC, 0x9A, 0x18, 0x4B, 0x82, 0xE3, 0x0B, 0x8C, 0xB8, 0x16, 0x9A, 0x34, 0xD6, 0xEF,
+        0x0B, 0x2E, 0x0C, 0xB8, 0xCB, 0x82, 0x09, 0x2E, 0x30, 0xB8, 0xCB, 0x8C, 0x06, 0xE3, 0x2E, 0x31,
+        0x25, 0xC6, 0x51, 0xC1, 0x97, 0x18, 0x5C, 0x65, 0xC4, 0x62, 0x4B, 0x8C, 0xB8, 0x32, 0xE2, 0x32,
+        0xE0, 0xCB, 0x22, 0x42, 0xE3, 0x60, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0x04, 0x00, 0x00, 0x07,
+        0xFF, 0xFD, 0xB3, 0x80, 0x02, 0xCF, 0xFB, 0xF6, 0x3C, 0x15, 0xBF, 0xDE, 0xAB, 0xC5, 0x29, 0x80,
+        0x66, 0x76, 0x08, 0x8C, 0xDD, 0x70, 0xC2, 0xF5, 0x22, 0x22, 0xFC, 0xEF, 0x86, 0x67, 0x2C, 0x11,
+        0x2F, 0xC8, 0x31, 0x1D, 0x07, 0xC0, 0x1A, 0x27, 0x13, 0x59, 0xB3, 0xD4, 0x5E, 0xF4, 0x5F, 0xA5,
+        0x0E, 0x25, 0x41, 0xC8, 0x90, 0x2A, 0x0E, 0x1D, 0x23, 0xCD, 0x89, 0x1E, 0x69, 0x10, 0x6D, 0x4D,
+        0x69, 0xFB, 0xED, 0x06, 0x27, 0x36, 0x31, 0x23, 0xCD, 0x20, 0xBC, 0xF7, 0xC5, 0x23, 0x25, 0x8C,
+        0x41, 0xAF, 0xDF, 0x34, 0xD6, 0xD4, 0x18, 0xF3, 0xDF, 0x14, 0x93, 0x79, 0x63, 0x05, 0x39, 0xB1,
+        0x22, 0x48, 0xB1, 0xD0, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x01, 0x80, 0x05, 0xFF, 0xD2,
+        0xD9, 0xFF, 0xD2, 0xDA, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x06, 0x00, 0x24, 0x00, 0xA0, 0x01,
+        0x40, 0x00, 0x18, 0x9C, 0xD8, 0x91, 0x91, 0x48, 0x29, 0x1E, 0x69, 0x18, 0x9C, 0xD8, 0x89, 0x1E,
+        0x7B, 0xE2, 0x92, 0x6F, 0x14, 0x18, 0x9C, 0xD8, 0x91, 0x8E, 0x2C, 0x14, 0x8F, 0x34, 0x89, 0x26,
+        0xF1, 0x44, 0x93, 0xBF, 0x36, 0x24, 0x79, 0xA4, 0x46, 0x24, 0x8A, 0x44, 0xE7, 0xBF, 0x36, 0xC0,
+        0x48, 0x42, 0x38, 0x29, 0x9C, 0x92, 0x6C, 0x07, 0xCC, 0x79, 0x3F, 0xD9, 0x98, 0x97, 0x48, 0x70,
+        0x3F, 0x45, 0x78, 0x5F, 0x44, 0xBE, 0x16, 0x0C, 0x66, 0x61, 0xDC, 0x48, 0xB8, 0x28, 0xFC, 0xC2,
+        0xE3, 0xAE, 0x52, 0x38, 0x5D, 0x9E, 0x01, 0x15, 0x28, 0xDF, 0xF5, 0xA3, 0xBD, 0x73, 0xFE, 0xFA,
+        0xBD, 0x29, 0x8B, 0xF0, 0x21, 0xDD, 0xA3, 0x23, 0x7B, 0x5F, 0x50, 0xD6, 0x48, 0x90, 0xB7, 0x77,
+        0x66, 0x6D, 0x58, 0xE4, 0xC5, 0x41, 0x63, 0x7F, 0x2F, 0xC2, 0x85, 0x21, 0xE6, 0xFE, 0x0F, 0xEE,
+        0x3D, 0xBF, 0x7D, 0xC3, 0xE6, 0x2C, 0x65, 0x1B, 0xA2, 0x22, 0x20, 0x08, 0x10, 0x40, 0x44, 0x93,
+        0xBF, 0x36, 0x24, 0x79, 0xA4, 0x46, 0x38, 0xB1, 0x22, 0x73, 0x63, 0x05, 0x23, 0xCD, 0x22, 0x47,
+        0x9A, 0x41, 0x63, 0x8B, 0x12, 0x3C, 0xD2, 0x20, 0xD7, 0xEF, 0xB4, 0xD3, 0x6A, 0x0C, 0x64, 0xEF,
+        0xCD, 0x89, 0x22, 0x90, 0x52, 0x45, 0x89, 0x13, 0x9B, 0x11, 0x30, 0xDE, 0x58, 0xC4, 0xE6, 0xC4,
+        0x18, 0xF3, 0xDF, 0x16, 0x24, 0x8A, 0x41, 0x48, 0xF3, 0x48, 0xC4, 0xE6, 0xC4, 0x1A, 0xFD, 0xF3,
+        0x4D, 0xAB, 0x41, 0x89, 0xCD, 0x89, 0x18, 0xE2, 0xC1, 0x49, 0x3B, 0xF3, 0x62, 0x48, 0xB1, 0x12,
+        0x3C, 0xD2, 0x24, 0x64, 0xB1, 0x32, 0x10, 0x22, 0x11, 0x02, 0x16, 0x8D, 0xB9, 0xFE, 0x5F, 0xF3,
+        0x91, 0xB8, 0x97, 0x32, 0x0F, 0xB4, 0xD1, 0x79, 0x73, 0xA1, 0x2C, 0x8A, 0x9F, 0xF6, 0x0B, 0x04,
+        0xF2, 0xFB, 0x60, 0xF8, 0xD9, 0xD7, 0x9C, 0x45, 0xC2, 0x8F, 0xD8, 0x60, 0xEB, 0x38, 0x8C, 0x27,
+        0x63, 0xC0, 0x3D, 0xC5, 0x16, 0x02, 0x5F, 0xE9, 0x6B, 0x04, 0x08, 0x00, 0x04, 0x00, 0x64, 0x1A,
+        0xA3, 0x31, 0x28, 0xE1, 0x41, 0x4C, 0xD0, 0x7F, 0x4D, 0x2C, 0xDA, 0x8F, 0xB8, 0xA2, 0x57, 0xA4,
+        0xAD, 0x5C, 0x41, 0x9D, 0xF7, 0x27, 0x33, 0xF8, 0x3A, 0xD3, 0x8D, 0x83, 0x1F, 0x16, 0x55, 0x98,
+        0x65, 0xFF, 0xF4, 0xA0, 0xFC, 0x96, 0x7E, 0x48, 0xB8, 0x65, 0x4A, 0x9D, 0xF0, 0x98, 0x25, 0x39,
+        0x10, 0x34, 0xDA, 0x0B, 0x8D, 0xFD, 0xE3, 0xC7, 0xFA, 0xC7, 0x15, 0xD6, 0xB2, 0x7B, 0xE5, 0x4E,
+        0x69, 0x17, 0x7C, 0x65, 0x56, 0x45, 0x36, 0x27, 0x2F, 0xE3, 0xDF, 0x52, 0x11, 0x02, 0x18, 0x08,
+        0xA0, 0x9A, 0x1E, 0xE3, 0x5A, 0x50, 0x00, 0x00, 0x40, 0x2C, 0x16, 0x06, 0x11, 0x64, 0x48, 0xCD,
+        0xD2, 0x7D, 0x6F, 0x91, 0x87, 0x4E, 0x18, 0xB5, 0xE0, 0x23, 0xCB, 0x9F, 0xF1, 0x75, 0x9F, 0xD1,
+        0x2F, 0x92, 0xE3, 0xE3, 0xE2, 0xB2, 0xEE, 0x17, 0x26, 0x03, 0xA2, 0xF0, 0xCE, 0x64, 0xC4, 0x1B,
+        0xE8, 0xA0, 0x03, 0x6E, 0x12, 0x20, 0x58, 0x81, 0x78, 0x04, 0xA1, 0xFE, 0xF7, 0x34, 0x68, 0xF7,
+        0x01, 0xA6, 0xB4, 0x3D, 0xC6, 0x81, 0xA6, 0x9E, 0xE1, 0xA3, 0x40, 0x02, 0x00, 0x04, 0x00, 0x40,
+        0x00, 0xC0, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x1F, 0xFF, 0x2B,
+        0xD7, 0xFF, 0xCA, 0xF8, 0x00, 0x04, 0x00, 0x00, 0x01, 0x03, 0x9A, 0x1A, 0x35, 0xEE, 0x06, 0x8D,
+        0x0D, 0x3D, 0xCC, 0x13, 0x47, 0xB8, 0xD3, 0x59, 0xC0, 0x40, 0x00, 0x01, 0x00, 0xC0, 0x00, 0x00,
+        0x82, 0xCA, 0x97, 0x65, 0x98, 0xEF, 0x38, 0xF7, 0xBF, 0xDE, 0x30, 0x97, 0xE6, 0x70, 0x45, 0xBB,
+        0x01, 0xA1, 0x71, 0xB2, 0xE3, 0xFA, 0x25, 0x72, 0x5D, 0x7C, 0x7B, 0xD6, 0x5D, 0xC2, 0xEC, 0xC0,
+        0x74, 0x5B, 0x19, 0xBC, 0x98, 0xC3, 0x7F, 0x6F, 0xFC, 0x17, 0xEE, 0xFD, 0x26, 0xBE, 0x71, 0x38,
+        0xC0, 0x00, 0x40, 0x00, 0x00, 0x08, 0x08, 0x00, 0x81, 0xCD, 0x34, 0x7B, 0x86, 0x94, 0x20, 0x40,
+        0x08, 0x32, 0x0D, 0x51, 0x98, 0x94, 0x70, 0xB4, 0xF9, 0x1D, 0xFF, 0x72, 0x4B, 0x73, 0x60, 0xFF,
+        0x4A, 0x95, 0x76, 0x49, 0xD5, 0x84, 0x11, 0xDE, 0x72, 0x56, 0x3C, 0x06, 0xCD, 0xFE, 0x06, 0x77,
+        0x17, 0xE5, 0x55, 0xE1, 0x8B, 0xFF, 0xD2, 0x73, 0xF2, 0x5B, 0xF9, 0x21, 0xE1, 0x99, 0x2A, 0xB7,
+        0xC4, 0x60, 0x94, 0xE4, 0x40, 0xD3, 0x68, 0x2E, 0x32, 0x7C, 0x22, 0x31, 0xD4, 0x18, 0xF6, 0xF9,
+        0x6F, 0x4B, 0xE0, 0x39, 0xBD, 0xC6, 0x5E, 0xFA, 0x9E, 0x52, 0x05, 0x82, 0x13, 0x43, 0xC4, 0x05,
+        0x0D, 0xA3, 0x5A, 0x68, 0xD1, 0x00, 0x21, 0x84, 0x42, 0x21, 0x1C, 0xFF, 0xF1, 0x80, 0x61, 0x05,
+        0x90, 0x49, 0x43, 0x7C, 0x27, 0xF1, 0xBE, 0x13, 0x04, 0xCD, 0xC8, 0xB5, 0x60, 0x34, 0x2E, 0x36,
+        0x5D, 0x7F, 0x44, 0xBE, 0x4B, 0xAF, 0x8F, 0x7A, 0xCB, 0x99, 0xFF, 0x5C, 0xBF, 0x01, 0x7C, 0xBA,
+        0xE3, 0x9E, 0x62, 0x57, 0xD9, 0x00, 0xDB, 0xA4, 0x45, 0x88, 0xBC, 0x12, 0x81, 0x80, 0x18, 0x00,
+        0x00, 0x06, 0x8D, 0x1A, 0x7B, 0xB4, 0x06, 0x87, 0xB8, 0xD6, 0x98, 0x23, 0xDC, 0x35, 0xA6, 0x81,
+        0x91, 0xA5, 0xE9, 0xEE, 0xD0, 0x0D, 0x1A, 0x7B, 0x9A, 0x06, 0x87, 0xB8, 0xD6, 0x9A, 0x03, 0xDC,
+        0x34, 0xD3, 0x5E, 0x90, 0x0C, 0x00, 0x00, 0x00, 0x20, 0x2C, 0x2A, 0x17, 0xCB, 0x04, 0x7D, 0xBA,
+        0x8F, 0xF5, 0xEB, 0x2F, 0xF8, 0xDD, 0xE5, 0xAF, 0xE0, 0x36, 0x42, 0xE3, 0x65, 0xD7, 0xF4, 0x4B,
+        0xE4, 0xBC, 0xF8, 0xF7, 0x2C, 0xBB, 0x85, 0xD9, 0x80, 0xE8, 0xB6, 0x33, 0x79, 0x31, 0x86, 0xFE,
+        0x28, 0x20, 0xDD, 0x84, 0x90, 0x15, 0xE7, 0xFF, 0xD3, 0xDE, 0x80, 0x20, 0x00, 0x40, 0x20, 0x42,
+        0x04, 0x13, 0x4F, 0x70, 0x02, 0xCF, 0xF5, 0xE6, 0x51, 0x93, 0xFF, 0x4E, 0x7F, 0x68, 0xF6, 0x6D,
+        0x1B, 0x11, 0xA6, 0x01, 0x87, 0x29, 0xD7, 0x2C, 0x66, 0x54, 0x6A, 0x42, 0x8F, 0x8A, 0x6B, 0x22,
+        0xE0, 0x93, 0xCA, 0x3C, 0x77, 0xD3, 0x9C, 0x1F, 0xA5, 0xB1, 0x5D, 0x9D, 0x3C, 0xC6, 0x0E, 0xF5,
+        0xC2, 0x24, 0xCC, 0x45, 0x15, 0x05, 0xC1, 0xC3, 0x5C, 0xA1, 0x96, 0x26, 0x58, 0xC2, 0x04, 0x43,
+        0x41, 0xD3, 0x10, 0xCF, 0x8F, 0xFB, 0xB0, 0x4C, 0x07, 0xD0, 0xBE, 0x11, 0x11, 0x82, 0x21, 0x12,
+        0xCE, 0x3C, 0xB5, 0x3A, 0x79, 0x3A, 0x3E, 0x7E, 0x8B, 0x37, 0xE4, 0xF4, 0x74, 0xA3, 0xBB, 0xC9,
+        0x47, 0xC6, 0xFD, 0x95, 0xB3, 0x70, 0x85, 0x03, 0x0C, 0x30, 0xD0, 0x45, 0x11, 0x80, 0x4C, 0x04,
+        0x00, 0x00, 0x01, 0x00, 0x61, 0xA7, 0xBB, 0x59, 0x3D, 0xDA, 0x07, 0xB9, 0x8B, 0xDC, 0x7B, 0xB4,
+        0x1C, 0xB1, 0x82, 0x65, 0x85, 0xE5, 0x30, 0x00, 0x80, 0x03, 0x00, 0x10, 0x00, 0x40, 0x08, 0x00,
+        0x3F, 0xFF, 0x1D, 0xCF, 0xFF, 0x8E, 0xE8, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00,
+        0x00, 0x01, 0x80, 0x18, 0x6C, 0x72, 0x99, 0x48, 0xE5, 0x20, 0x2C, 0x72, 0x91, 0xCA, 0x19, 0x62,
+        0x1E, 0xE7, 0xBE, 0xF0, 0x99, 0x6A, 0x00, 0x80, 0x30, 0x00, 0x04, 0x20, 0x27, 0x26, 0x1F, 0x58,
+        0x50, 0xBD, 0x05, 0x83, 0xF6, 0x77, 0x65, 0xFC, 0x75, 0xFD, 0x27, 0x74, 0x7C, 0xFD, 0x16, 0x6F,
+        0xCD, 0xE8, 0xE9, 0x47, 0xB7, 0x94, 0x53, 0x93, 0xCC, 0x2C, 0xD2, 0x12, 0x18, 0x51, 0x1A, 0x0C,
+        0x30, 0x82, 0x04, 0xD0, 0x28, 0x1F, 0xF7, 0x85, 0xE5, 0x80, 0x99, 0x48, 0x8E, 0x52, 0x0C, 0x72,
+        0x99, 0xBC, 0x76, 0x02, 0x42, 0x52, 0x01, 0x7D, 0x10, 0xB5, 0x77, 0x45, 0xF3, 0xC5, 0x97, 0x8B,
+        0xB4, 0xBF, 0x08, 0x74, 0xDF, 0x8F, 0x3D, 0xE3, 0xA2, 0xE0, 0x0D, 0x5A, 0x3E, 0x01, 0x20, 0x25,
+        0x45, 0x18, 0xCA, 0x75, 0xC2, 0x38, 0xAA, 0xFF, 0x38, 0x83, 0x1B, 0x32, 0xE8, 0x7F, 0xFE, 0x85,
+        0x87, 0xD6, 0xEB, 0xF6, 0x72, 0x6E, 0x8B, 0x5F, 0xB6, 0x6F, 0x44, 0x6D, 0x80, 0x71, 0xCC, 0xB5,
+        0xED, 0x1A, 0x25, 0x1B, 0x10, 0xA7, 0xC3, 0x6A, 0xE5, 0xBF, 0x4F, 0x24, 0x3B, 0x39, 0xC3, 0x0F,
+        0x29, 0x67, 0xF2, 0xBE, 0x9D, 0xBC, 0xE6, 0x16, 0xD9, 0xA4, 0x15, 0x89, 0x0C, 0xB0, 0x5C, 0x20,
+        0x00, 0x00, 0x00, 0x04, 0x48, 0x31, 0xCA, 0x65, 0x89, 0x95, 0x40, 0x08, 0x00, 0x01, 0x00, 0x40,
+        0xC0, 0x05, 0x08, 0xF9, 0x9D, 0xDF, 0xBD, 0xFE, 0x8D, 0x8C, 0x11, 0x08, 0x96, 0x71, 0xE5, 0xA9,
+        0xD3, 0xC9, 0xD1, 0xF3, 0xF4, 0x59, 0xBF, 0x37, 0xA3, 0xA5, 0x1E, 0xDE, 0x51, 0x4E, 0x4F, 0x30,
+        0xB3, 0x48, 0x41, 0xBF, 0x03, 0xE6, 0x38, 0x1B, 0xE8, 0xB5, 0x03, 0xC1, 0x00, 0x04, 0x00, 0x08,
+        0x20, 0x21, 0x01, 0x89, 0x9B, 0xCB, 0x04, 0x80, 0x5E, 0x50, 0x7B, 0xB5, 0xEE, 0x31, 0x3D, 0xC1,
+        0xA7, 0xB9, 0x89, 0xEE, 0x68, 0x71, 0x9B, 0x8C, 0x04, 0xCB, 0x1C, 0x0E, 0x31, 0x3D, 0xCF, 0x76,
+        0x83, 0x96, 0x30, 0x4C, 0xB1, 0x32, 0x81, 0x89, 0xEE, 0x6B, 0xDC, 0xCE, 0xB0, 0x10, 0x02, 0x70,
+        0x4C, 0x07, 0xD0, 0xBE, 0x11, 0x31, 0x86, 0x21, 0x32, 0xCE, 0x3C, 0xB5, 0x3A, 0x79, 0x3A, 0x3D,
+        0x7E, 0x8A, 0xB7, 0xE4, 0xF4, 0x70, 0x9F, 0xC7, 0x5E, 0xC9, 0x69, 0xBD, 0xC6, 0x99, 0x30, 0x51,
+        0x85, 0x46, 0x0C, 0x32, 0x08, 0x4F, 0x0A, 0x81, 0x10, 0x20, 0x03, 0x00, 0x03, 0xDD, 0xAF, 0x71,
+        0x89, 0xEE, 0x1A, 0x19, 0x08, 0x21, 0x90, 0x91, 0x4F, 0x97, 0xC7, 0xFC, 0x3F, 0xFB, 0xC9, 0x10,
+        0x5A, 0x9D, 0xC9, 0x7A, 0xF0, 0xE5, 0xC2, 0xE9, 0x37, 0x46, 0x2D, 0x1E, 0x20, 0x67, 0x6E, 0xDE,
+        0x72, 0xB7, 0xB8, 0x1E, 0x80, 0xE2, 0xA2, 0x18, 0xC6, 0xEB, 0xA8, 0x71, 0xE5, 0xFE, 0xB1, 0x07,
+        0x36, 0x57, 0x68, 0x68, 0x02, 0x3F, 0xFF, 0xFB, 0x7F, 0x01, 0x14, 0x59, 0x39, 0x0A, 0x00, 0x8A,
+        0x08, 0xB8, 0xB8, 0xB8, 0xCB, 0x1C, 0x61, 0x34, 0x9A, 0x41, 0xA3, 0x8C, 0xD3, 0x48, 0xC1, 0x58,
+        0x15, 0x8D, 0x95, 0x15, 0x8E, 0x5C, 0x7F, 0x6B, 0x05, 0xB0, 0x8E, 0x0D, 0x31, 0x2A, 0x19, 0x72,
+        0x2C, 0x2E, 0xF4, 0x0C, 0x5D, 0xF8, 0xD6, 0x7C, 0x1C, 0xE8, 0x89, 0xD0, 0xB2, 0x34, 0xEB, 0xC0,
+        0x81, 0x6F, 0xF6, 0xEF, 0x2B, 0xE3, 0xD9, 0x6D, 0x62, 0x2A, 0xC0, 0x6A, 0x34, 0x12, 0x04, 0x04,
+        0x06, 0x08, 0x0A, 0x0C, 0x22, 0xE2, 0xE2, 0xE2, 0xE3, 0x2A, 0x08, 0x28, 0x49, 0x86, 0x40, 0x84,
+        0xCD, 0xB3, 0x3F, 0x17, 0x87, 0xE6, 0x83, 0x39, 0xF9, 0x3A, 0xBE, 0x6D, 0xC0, 0xD1, 0xBC, 0xD5,
+        0x51, 0xDD, 0x58, 0xEF, 0x4D, 0x70, 0x3F, 0x48, 0x78, 0xC7, 0xDE, 0xD8, 0x5F, 0xB3, 0xB4, 0x26,
+        0x05, 0xA1, 0xD2, 0x45, 0xFF, 0x09, 0xC7, 0x6B, 0xBF, 0x1E, 0x2C, 0x92, 0x0D, 0x0B, 0x4C, 0x31,
+        0xDA, 0xCB, 0xF8, 0x4F, 0x52, 0x18, 0x0E, 0x3E, 0x38, 0x3B, 0x50, 0xE4, 0x4B, 0xBE, 0xA8, 0x9B,
+        0x63, 0xC8, 0x35, 0xC4, 0xB9, 0x4E, 0x20, 0x4C, 0xC4, 0xB1, 0xC0, 0xA4, 0xBF, 0xAF, 0x3C, 0x6E,
+        0x91, 0x4E, 0x09, 0x82, 0x98, 0xC7, 0x19, 0x64, 0xB2, 0x1B, 0xCB, 0x20, 0x04, 0x00, 0x03, 0x84,
+        0x84, 0x23, 0xE3, 0x1A, 0x49, 0xA7, 0x17, 0x53, 0x78, 0xAB, 0x76, 0xF8, 0x2B, 0xED, 0x9F, 0xFA,
+        0x92, 0xBF, 0xF0, 0xE3, 0xC2, 0x47, 0xF0, 0x55, 0x9A, 0x59, 0xDC, 0x80, 0x95, 0xE4, 0x8B, 0xCC,
+        0xF1, 0x2F, 0x1B, 0x02, 0x44, 0x2F, 0x03, 0x90, 0x40, 0x01, 0xC7, 0x79, 0x64, 0x37, 0x82, 0xE2,
+        0xE2, 0x2E, 0x2E, 0x32, 0xE6, 0xF0, 0x5C, 0x45, 0xC6, 0x58, 0xF9, 0xEF, 0x2C, 0x96, 0x4D, 0x00,
+        0x00, 0x00, 0x50, 0x01, 0x80, 0x03, 0x00, 0x10, 0x00, 0x10, 0x00, 0x80, 0x03, 0x00, 0x08, 0x00,
+        0x20, 0x00, 0x3F, 0xFF, 0xBF, 0x33, 0xFF, 0xFD, 0xF9, 0x40, 0x01, 0x80, 0x00, 0x00, 0x04, 0x5C,
+        0x5C, 0x5C, 0x65, 0x92, 0xC8, 0x26, 0xF2, 0xC8, 0x59, 0x2C, 0x86, 0xF0, 0x6C, 0x86, 0xF0, 0xDE,
+        0x1B, 0xC3, 0x78, 0x28, 0x20, 0x88, 0x08, 0x41, 0x84, 0x08, 0x83, 0x3B, 0x73, 0x7F, 0xD0, 0xFD,
+        0x3F, 0xF9, 0xD6, 0x33, 0x24, 0x50, 0x5D, 0xA8, 0x10, 0xBA, 0xF1, 0xA4, 0xF8, 0x35, 0xD0, 0xF3,
+        0xA1, 0x84, 0x68, 0xD7, 0x61, 0x01, 0xCB, 0xC0, 0x8A, 0xC6, 0x70, 0x4B, 0x57, 0xF5, 0x3D, 0x1E,
+        0x25, 0xD8, 0x48, 0x90, 0x08, 0x41, 0x84, 0x08, 0x80, 0x84, 0x18, 0xC9, 0x64, 0x37, 0x97, 0x19,
+        0x64, 0xAA, 0x10, 0x40, 0x0A, 0x11, 0x06, 0xAC, 0xFC, 0xAB, 0x39, 0xDC, 0x3E, 0xF7, 0xAF, 0xF5,
+        0xA4, 0xDD, 0x42, 0x93, 0x75, 0xA9, 0xA3, 0x7B, 0xA2, 0x1C, 0xA2, 0xA1, 0xF6, 0x53, 0x0C, 0x73,
+        0xDB, 0x7D, 0xFA, 0xC9, 0xEC, 0x0F, 0xE8, 0x56, 0x49, 0x0F, 0xFC, 0x27, 0xDD, 0xB0, 0x7C, 0x77,
+        0xF2, 0x4A, 0x34, 0x3D, 0x30, 0x47, 0x67, 0x2F, 0xE1, 0x3D, 0x48, 0x64, 0x38, 0xF1, 0x84, 0x0A,
+        0x64, 0x47, 0x81, 0xE9, 0x7E, 0x49, 0xB5, 0xE7, 0x98, 0x4D, 0x7A, 0x7B, 0x20, 0x7F, 0x66, 0x51,
+        0x40, 0x31, 0x26, 0x19, 0x10, 0x07, 0x24, 0x9A, 0x38, 0xCD, 0x34, 0x84, 0xD0, 0x92, 0xA1, 0x34,
+        0x1A, 0x42, 0x69, 0xA4, 0xF5, 0x40, 0x64, 0x1B, 0x05, 0xF1, 0x2C, 0x35, 0xC9, 0x71, 0x9F, 0x46,
+        0x0B, 0xBE, 0x03, 0x27, 0x7F, 0x35, 0x1F, 0xF8, 0x6D, 0xE1, 0x03, 0xF8, 0x32, 0xCD, 0x5C, 0x7D,
+        0xC1, 0xE0, 0xBD, 0xDD, 0x8A, 0xE9, 0xE8, 0xB5, 0xB0, 0x97, 0x33, 0x0F, 0xC4, 0x80, 0xD0, 0x10,
+        0x04, 0x08, 0x05, 0x1E, 0x0B, 0x8B, 0x82, 0xE6, 0xFC, 0xEC, 0x17, 0x19, 0x64, 0xB1, 0xF3, 0xDE,
+        0x59, 0x04, 0xDE, 0x16, 0x4B, 0x25, 0x90, 0xDE, 0x0D, 0x90, 0xDE, 0x08, 0x02, 0x5F, 0x1B, 0xF5,
+        0x00, 0x04, 0x20, 0x42, 0x04, 0x01, 0x09, 0x51, 0xB8, 0x52, 0xED, 0x41, 0x2C, 0xBC, 0x71, 0x47,
+        0x2A, 0xD9, 0x4E, 0xF8, 0x72, 0x47, 0x9E, 0xAB, 0x7B, 0xFB, 0x26, 0xEB, 0x0E, 0x29, 0xEC, 0x4B,
+        0x48, 0xB5, 0xA0, 0x73, 0x78, 0xF3, 0x5E, 0x4F, 0xFF, 0x5E, 0xCF, 0xB5, 0x9F, 0xB9, 0xCD, 0xE5,
+        0xA3, 0xCA, 0xE7, 0x0B, 0x3E, 0x91, 0x47, 0x82, 0x65, 0x85, 0x62, 0xFE, 0x99, 0xDE, 0x79, 0xB6,
+        0xF3, 0xA2, 0x62, 0x76, 0xCA, 0x2C, 0x92, 0x12, 0xE4, 0xBA, 0x98, 0x72, 0x58, 0x42, 0x5F, 0xC7,
+        0xCF, 0x59, 0xC1, 0x29, 0xD1, 0x26, 0x8B, 0x1E, 0x6F, 0x37, 0x12, 0x0C, 0x12, 0x34, 0x00, 0x80,
+        0x00, 0x09, 0x04, 0xC1, 0x74, 0x5C, 0x13, 0x33, 0xA4, 0xA7, 0xDD, 0x74, 0x82, 0xD6, 0x36, 0x4A,
+        0xF8, 0xAA, 0xF4, 0xBB, 0xFD, 0x1E, 0x67, 0xF7, 0x7A, 0xE6, 0xAA, 0xFA, 0x14, 0x2E, 0x41, 0x89,
+        0x79, 0x94, 0xE9, 0x2E, 0x36, 0x39, 0x41, 0x07, 0x56, 0x2A, 0x00, 0xE6, 0x84, 0xC0, 0x17, 0x60,
+        0x66, 0x01, 0x58, 0xFE, 0x24, 0x18, 0xC6, 0x31, 0x88, 0xC1, 0x78, 0xB1, 0x72, 0x6F, 0x1A, 0x1B,
+        0x5A, 0xD6, 0x4C, 0xB5, 0xA0, 0x01, 0x00, 0x02, 0x00, 0x10, 0x00, 0x20, 0x01, 0x00, 0x02, 0x00,
+        0x10, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x88, 0x53, 0xFF, 0xE2, 0x15, 0x00, 0x04,
+        0x00, 0x00, 0x00, 0x23, 0x18, 0xC6, 0x5E, 0x6F, 0x15, 0xC4, 0x36, 0xFB, 0x64, 0xCB, 0x5A, 0xC2,
+        0xC6, 0x30, 0x5E, 0x6F, 0x15, 0xC7, 0x02, 0x05, 0x02, 0x02, 0x02, 0x05, 0x04, 0x02, 0x0D, 0x2A,
+        0x61, 0x9C, 0x65, 0xFD, 0x43, 0xE3, 0xFF, 0xCB, 0x30, 0xA0, 0x66, 0xC8, 0x49, 0x5B, 0x2A, 0x22,
+        0x61, 0xB9, 0x0B, 0xFB, 0xBD, 0xF3, 0x56, 0x7D, 0x09, 0x97, 0x20, 0xC4, 0xCC, 0xCA, 0xF4, 0x98,
+        0x1B, 0x1C, 0xA0, 0x83, 0xAB, 0x6F, 0xFD, 0x07, 0xF1, 0xFE, 0xBB, 0x67, 0x44, 0xB4, 0x70, 0x20,
+        0x20, 0xC1, 0x02, 0x04, 0x14, 0x20, 0x10, 0xD6, 0xB5, 0xAC, 0x9A, 0xC5, 0x04, 0x00, 0x80, 0x04,
+        0x21, 0x50, 0x6E, 0x45, 0x3B, 0xD9, 0x3B, 0xDD, 0x5F, 0x3A, 0x4A, 0x93, 0x30, 0xEF, 0x45, 0x93,
+        0xF5, 0xD1, 0xB3, 0x7F, 0x22, 0x7C, 0xB2, 0xA4, 0xF6, 0xFB, 0x20, 0xF6, 0x63, 0xA6, 0x7E, 0xF3,
+        0x5D, 0xE4, 0x7F, 0xF5, 0xEC, 0xFB, 0x5C, 0xFB, 0x99, 0xDE, 0x52, 0x3C, 0xAE, 0x6C, 0xB3, 0xA9,
+        0x18, 0x78, 0x66, 0x5C, 0x56, 0xA4, 0x9C, 0x3E, 0xE3, 0x64, 0x2E, 0xAD, 0xF0, 0x5E, 0x4F, 0xAA,
+        0xE1, 0x74, 0xD8, 0x9B, 0x29, 0xD9, 0x07, 0xEB, 0x8F, 0x96, 0x1E, 0x30, 0x38, 0x6C, 0xB6, 0xF9,
+        0xEB, 0x5A, 0xC2, 0x21, 0x02, 0x8A, 0x28, 0xA2, 0xB7, 0xFF, 0xAC, 0x03, 0x08, 0x2E, 0x82, 0x5E,
+        0x1C, 0xE1, 0x4F, 0x8E, 0xA8, 0x9F, 0xE6, 0xC2, 0x49, 0x3B, 0x2A, 0x22, 0x5F, 0xB8, 0xFB, 0xFB,
+        0xBB, 0xF3, 0x51, 0x7D, 0x0A, 0x17, 0x1E, 0xCF, 0xFC, 0x5E, 0xFC, 0xAB, 0xF4, 0xCB, 0x99, 0x7A,
+        0x0D, 0x6A, 0xE5, 0x03, 0x9E, 0x99, 0x17, 0x23, 0x10, 0x4E, 0x05, 0x00, 0x20, 0x10, 0x02, 0x30,
+        0x5E, 0x2B, 0xE6, 0xBC, 0xDC, 0x60, 0x5B, 0x7D, 0xB2, 0xD6, 0xB4, 0xC2, 0x30, 0x48, 0xCB, 0xCD,
+        0xE2, 0xA3, 0x93, 0x79, 0xB8, 0xCB, 0x8C, 0x60, 0x83, 0x59, 0x32, 0xBF, 0x56, 0x89, 0x3A, 0x9A,
+        0x9A, 0x98, 0x52, 0x91, 0x40, 0x26, 0x4C, 0xB5, 0xAD, 0x69, 0x00, 0x40, 0x20, 0x0C, 0x06, 0x03,
+        0x42, 0xC1, 0x94, 0xBC, 0x4C, 0x5D, 0x29, 0x43, 0x6A, 0xB3, 0xFF, 0x98, 0xDE, 0x96, 0xFE, 0x54,
+        0x64, 0x4B, 0xB7, 0x1F, 0x7F, 0x77, 0x8E, 0x6A, 0x8F, 0xA1, 0x2A, 0xE3, 0xB8, 0x97, 0x99, 0x52,
+        0x92, 0xE3, 0x64, 0x94, 0x20, 0x75, 0xA2, 0xA0, 0x0E, 0x88, 0x4D, 0x01, 0x72, 0x7F, 0xFE, 0xDF,
+        0x7B, 0x00, 0x90, 0x90, 0x90, 0x90, 0x08, 0xB0, 0xEF, 0x1B, 0x24, 0xD0, 0x02, 0x5F, 0xFF, 0xFF,
+        0x9D, 0x20, 0x51, 0x01, 0x00, 0x20, 0x41, 0x08, 0x31, 0x03, 0x00, 0x10, 0x85, 0xB0, 0xD8, 0xA1,
+        0xB9, 0x6A, 0x09, 0x5A, 0x4E, 0x9B, 0x9B, 0x4A, 0x88, 0x50, 0x84, 0xA2, 0x38, 0x0A, 0x01, 0x94,
+        0x4F, 0xCD, 0xF9, 0x7F, 0xF8, 0xB0, 0x25, 0x21, 0xBC, 0x14, 0x68, 0xE3, 0x09, 0xBE, 0x68, 0xC4,
+        0x73, 0xB1, 0x0A, 0x1D, 0x1B, 0x53, 0xBF, 0xAB, 0xE7, 0x2A, 0xE7, 0xCB, 0x25, 0x6A, 0xAC, 0x39,
+        0x4C, 0x49, 0x8F, 0xF7, 0x17, 0xE9, 0x9F, 0x6F, 0x74, 0xBE, 0x8A, 0xB2, 0xE2, 0xC5, 0xE9, 0x78,
+        0x5E, 0x08, 0x02, 0x80, 0xC0, 0xA0, 0x30, 0x28, 0xD7, 0xB7, 0x5E, 0xEB, 0xBB, 0x77, 0x5E, 0x99,
+        0xB8, 0xA9, 0xC4, 0x55, 0x46, 0xB2, 0xE7, 0xD3, 0xF5, 0xFD, 0xA0, 0x96, 0x50, 0x35, 0x9E, 0x14,
+        0x2B, 0x46, 0xCB, 0xBA, 0x21, 0x92, 0xA8, 0xDB, 0x03, 0x08, 0xE5, 0xED, 0xB3, 0xCB, 0x96, 0x83,
+        0x2A, 0x0C, 0xD0, 0x70, 0xE4, 0xB0, 0x4F, 0xFD, 0x4D, 0x3E, 0x3F, 0x3E, 0x69, 0x35, 0xFC, 0x87,
+        0x6B, 0x3C, 0x28, 0x8A, 0x08, 0x1B, 0x39, 0x6A, 0x13, 0x9B, 0xF8, 0x87, 0x4D, 0xE0, 0x1A, 0xAE,
+        0x3D, 0x7F, 0xA8, 0x4E, 0x62, 0x50, 0x36, 0x25, 0xB4, 0x23, 0xB2, 0x22, 0x32, 0xF5, 0xF3, 0x5C,
+        0xAD, 0x8B, 0x97, 0x2E, 0xCD, 0x91, 0xEB, 0xEB, 0x77, 0x75, 0xDD, 0x7B, 0x6D, 0xA0, 0x0E, 0x00,
+        0x80, 0x98, 0x26, 0x0C, 0xA2, 0xB8, 0x93, 0x9B, 0xC5, 0x1E, 0xE2, 0x23, 0x6E, 0xA2, 0xB1, 0xCF,
+        0xC2, 0x17, 0x9D, 0x1F, 0xE5, 0x1B, 0x3F, 0xAB, 0xBF, 0x2A, 0xD7, 0xCB, 0x19, 0x6A, 0x6C, 0x39,
+        0x0C, 0x4B, 0x47, 0x11, 0xA4, 0xC9, 0xB0, 0x39, 0x31, 0x46, 0x07, 0x2C, 0x25, 0x40, 0xBB, 0x03,
+        0x00, 0x0B, 0x47, 0xE5, 0xDA, 0xD9, 0xD6, 0x8F, 0x65, 0xA2, 0x9A, 0x2E, 0xC7, 0x44, 0xA2, 0x34,
+        0xB0, 0xB7, 0x1A, 0x24, 0xA8, 0xE6, 0xC0, 0xB2, 0x52, 0x66, 0x91, 0x1C, 0xB9, 0x70, 0xCB, 0x1E,
+        0x5C, 0x0C, 0x19, 0x73, 0x19, 0x0C, 0x86, 0x3C, 0x20, 0xC9, 0x86, 0x1C, 0x32, 0x49, 0xC8, 0x63,
+        0x81, 0x03, 0x01, 0x00, 0x03, 0x02, 0x01, 0x02, 0x03, 0x97, 0x2D, 0xCD, 0xB2, 0x5E, 0x91, 0xF0,
+        0x9F, 0xE2, 0x98, 0x4D, 0x73, 0x49, 0x23, 0x65, 0x88, 0x50, 0xE2, 0xDA, 0xA1, 0xFD, 0x5D, 0x79,
+        0x59, 0xBE, 0x59, 0x2B, 0x51, 0xE1, 0xD2, 0x62, 0x0A, 0x3A, 0x0D, 0x16, 0x4E, 0x01, 0xC4, 0xB7,
+        0xFE, 0x43, 0xF7, 0xBE, 0xB3, 0x5F, 0x4C, 0x94, 0x90, 0x20, 0x82, 0x01, 0x06, 0x08, 0x08, 0x50,
+        0x42, 0x55, 0x55, 0x11, 0x51, 0x58, 0x51, 0x85, 0x8A, 0x51, 0x08, 0x08, 0x80, 0x52, 0x1D, 0x63,
+        0xE0, 0x3F, 0x6A, 0xEE, 0xD7, 0x07, 0xC4, 0x92, 0x44, 0xBA, 0x34, 0x50, 0x44, 0x85, 0x5A, 0x60,
+        0x5C, 0xE8, 0x23, 0x1E, 0x26, 0xAD, 0x68, 0xC1, 0x1D, 0x14, 0xE3, 0xAF, 0x9D, 0x57, 0x5F, 0x5F,
+        0xFA, 0x9D, 0x7C, 0x7B, 0xFC, 0xCF, 0x6C, 0x11, 0x0D, 0xB6, 0x7A, 0x50, 0x14, 0x1A, 0x35, 0xB2,
+        0xDA, 0x25, 0xF2, 0x14, 0x1B, 0xF1, 0x90, 0x14, 0xD6, 0xF4, 0xDD, 0x7F, 0x31, 0xAF, 0xD0, 0x5C,
+        0xD8, 0x48, 0xC5, 0x31, 0x68, 0x6C, 0xE0, 0x91, 0x81, 0x0A, 0xAA, 0x31, 0x14, 0xAB, 0x11, 0x1A,
+        0x15, 0x18, 0x34, 0x48, 0x13, 0x24, 0x02, 0x08, 0x8C, 0x90, 0x9F, 0xE1, 0x80, 0x59, 0x05, 0xD0,
+        0x49, 0xC3, 0x94, 0x28, 0x51, 0xC7, 0x13, 0x4C, 0xD2, 0x48, 0xDB, 0x62, 0x44, 0x39, 0x36, 0xA9,
+        0x7F, 0x57, 0x5E, 0x56, 0x4F, 0x96, 0x62, 0xD4, 0xF9, 0xFF, 0x75, 0xBF, 0x10, 0xFC, 0xE8, 0xE4,
+        0x5E, 0x6F, 0x58, 0x79, 0x18, 0xDD, 0xA5, 0x45, 0x78, 0xC4, 0x11, 0x82, 0x00, 0x08, 0x08, 0x03,
+        0x0E, 0x13, 0x93, 0x32, 0xFC, 0x32, 0x19, 0x80, 0xE1, 0xC8, 0xE4, 0xC0, 0xE5, 0xE3, 0xC0, 0x4C,
+        0x1C, 0xCB, 0x92, 0xF1, 0x81, 0x01, 0xAB, 0xD6, 0xC0, 0x02, 0x6F, 0xFF, 0x21, 0xFE, 0xE0, 0x90,
+        0xF1, 0x81, 0x40, 0x02, 0x00, 0x04, 0x00, 0x61, 0x22, 0x82, 0x82, 0x40, 0x88, 0x26, 0x5B, 0x92,
+        0x62, 0xA9, 0xF2, 0x53, 0x93, 0x7F, 0xB9, 0xBF, 0x6F, 0xFB, 0x99, 0x25, 0xE9, 0x90, 0x9A, 0x26,
+        0x48, 0x78, 0xE1, 0x21, 0x01, 0x86, 0x00, 0x36, 0x26, 0x29, 0x97, 0x1B, 0xE7, 0xDF, 0xF1, 0x88,
+        0x94, 0x2E, 0x79, 0x3A, 0x0F, 0xFF, 0xFA, 0x1F, 0xF0, 0xB6, 0x90, 0x6B, 0x8F, 0x98, 0x22, 0x30,
+        0x28, 0xC8, 0xA4, 0x8D, 0xC1, 0xE6, 0x91, 0x02, 0x40, 0x84, 0x41, 0x20, 0x42, 0x20, 0xFF, 0xFF,
+        0xFF, 0x78, 0x46, 0x21, 0x04, 0xCB, 0x76, 0xD6, 0x9B, 0xBC, 0x60, 0x24, 0x02, 0x4A, 0xC2, 0xD3,
+        0xA5, 0x76, 0xEF, 0xF4, 0x64, 0x7F, 0xFF, 0xF5, 0x1F, 0xE0, 0x2B, 0xDF, 0x27, 0x38, 0x4C, 0x70,
+        0x70, 0xC1, 0xC5, 0x07, 0x04, 0x08, 0x57, 0x94, 0x03, 0x3B, 0xE6, 0xE5, 0xF3, 0xF5, 0x89, 0x15,
+        0x38, 0x85, 0x84, 0x8F, 0xEE, 0xBF, 0x71, 0x22, 0xC9, 0x09, 0xC2, 0xE4, 0x86, 0x8A, 0x1D, 0xE7,
+        0x78, 0x84, 0xB8, 0x92, 0xCC, 0x60, 0xA1, 0x01, 0x84, 0x02, 0x08, 0x39, 0x02, 0xA7, 0x93, 0x9E,
+        0xFF, 0xFF, 0xA3, 0xFF, 0x03, 0x64, 0xFC, 0xFE, 0x5D, 0x74, 0x9D, 0x2F, 0x41, 0x10, 0x02, 0x34,
+        0x12, 0x1B, 0x8C, 0xB8, 0xCB, 0x89, 0x9B, 0x88, 0xBE, 0x69, 0x10, 0x85, 0x92, 0xE2, 0x32, 0xE0,
+        0xCB, 0x8C, 0xB9, 0x79, 0xBC, 0x60, 0xE2, 0x86, 0x96, 0x3E, 0xB1, 0x1F, 0xFF, 0xFD, 0x37, 0xF8,
+        0x2A, 0xD7, 0x89, 0xCE, 0x13, 0x1C, 0x1C, 0x72, 0xE3, 0x19, 0x64, 0xDE, 0x21, 0x8C, 0x1C, 0x50,
+        0x90, 0xC1, 0x46, 0x0F, 0x28, 0x75, 0x43, 0x19, 0x2F, 0xDD, 0xFE, 0xE6, 0x51, 0x79, 0xF8, 0x6F,
+        0xA6, 0x36, 0x74, 0x38, 0x4E, 0x4A, 0x82, 0x8E, 0x54, 0x42, 0x2A, 0x70, 0xD4, 0xEB, 0x7D, 0x79,
+        0xFD, 0x32, 0x33, 0x9F, 0xFF, 0xF4, 0xBF, 0xDE, 0xD8, 0x3D, 0x48, 0x5C, 0xA0, 0xF1, 0x41, 0x42,
+        0x01, 0x04, 0x0C, 0x79, 0xB8, 0x31, 0x71, 0x85, 0xC1, 0x41, 0x04, 0x24, 0x08, 0x83, 0xFF, 0xFF,
+        0xFE, 0x61, 0x0C, 0x40, 0x10, 0xC0, 0x21, 0x79, 0xEF, 0x8B, 0x25, 0x23, 0xCD, 0x23, 0x00, 0x04,
+        0x0C, 0x10, 0x31, 0x02, 0x48, 0x13, 0x28, 0x6D, 0x41, 0xBF, 0xFF, 0xFA, 0x0F, 0xF0, 0x96, 0x67,
+        0xFE, 0x9F, 0x5F, 0x4E, 0x36, 0x8C, 0x9E, 0x0E, 0xC6, 0x42, 0x86, 0x64, 0x28, 0x68, 0xAC, 0xB0,
+        0x78, 0x57, 0x4D, 0x7A, 0x7A, 0xB3, 0x49, 0x5F, 0xDF, 0x7E, 0xE2, 0x45, 0x92, 0x53, 0xC4, 0xC7,
+        0x0B, 0x14, 0x24, 0x50, 0x70, 0xC4, 0xD1, 0x86, 0x81, 0x45, 0x2B, 0xD6, 0x74, 0xC1, 0xC5, 0x0F,
+        0x24, 0x5D, 0x22, 0xB3, 0xDF, 0xFF, 0xF3, 0xFF, 0xE1, 0x6C, 0x9E, 0xAA, 0x3E, 0x58, 0x78, 0xFE,
+        0x6E, 0x58, 0xC0, 0x2E, 0x00, 0x01, 0x6B, 0x2C, 0x3B, 0xDA, 0x01, 0x65, 0xB7, 0xDE, 0x5E, 0x84,
+        0x42, 0x0A, 0x60, 0x00, 0xF5, 0xCF, 0x8F, 0x7F, 0xC3, 0x90, 0x93, 0x0D, 0xFF, 0xB1, 0x78, 0x33,
+        0x99, 0xF1, 0x38, 0x02, 0x4F, 0xEE, 0xFF, 0xCC, 0x20, 0x14, 0x86, 0x49, 0x80, 0x11, 0x00, 0x22,
+        0x08, 0xC1, 0x8B, 0xE6, 0xC5, 0x9C, 0xBB, 0xC5, 0x04, 0x62, 0x4C, 0x45, 0x62, 0xFF, 0xFF, 0xC6,
+        0xFE, 0x95, 0x77, 0x8F, 0x30, 0x92, 0x03, 0x10, 0x88, 0x1C, 0xFB, 0xC3, 0x9A, 0x02, 0x86, 0x40,
+        0xE5, 0x16, 0x81, 0xA4, 0x16, 0xB4, 0x1B, 0x9F, 0xF9, 0x7F, 0xF9, 0x38, 0x51, 0xCF, 0xB7, 0x1D,
+        0xAF, 0x29, 0xD0, 0xC4, 0x18, 0xC4, 0x89, 0xCB, 0x4C, 0x8A, 0x71, 0x2F, 0x53, 0x59, 0xD6, 0x7A,
+        0x54, 0x4C, 0xFF, 0xFF, 0x17, 0xFA, 0x76, 0x20, 0xB0, 0x79, 0x43, 0x90, 0x18, 0x00, 0x08, 0x38,
+        0xE6, 0x50, 0x33, 0xBE, 0x50, 0x00, 0x50, 0x48, 0x14, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF5, 0x40,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x14, 0x00, 0x13, 0x55, 0xBE, 0x37, 0x40, 0x28, 0x00, 0x02,
+        0x10, 0x00, 0x00, 0x00, 0xA6, 0x16, 0x81, 0xBF, 0xFF, 0xE3, 0x7F, 0x52, 0x89, 0x7E, 0xBC, 0xF1,
+        0x9A, 0x35, 0x9D, 0x67, 0x04, 0xBD, 0x49, 0x90, 0x90, 0x81, 0x24, 0xE9, 0x19, 0x46, 0xDB, 0xF6,
+        0xEA, 0xB1, 0x2C, 0xFF, 0xE3, 0x7F, 0xE6, 0x60, 0xCA, 0x65, 0x44, 0xD0, 0x24, 0x81, 0xC4, 0x00,
+        0x00, 0x3B, 0xC0, 0x77, 0xFB, 0xFB, 0xC2, 0x80, 0x00, 0x65, 0x16, 0x61, 0xE5, 0x7F, 0xFF, 0x87,
+        0xFD, 0x1A, 0x4B, 0x9C, 0x48, 0xC0, 0x8C, 0xDE, 0x33, 0x72, 0x0C, 0xDE, 0x31, 0x1B, 0xC3, 0x72,
+        0x0C, 0xDC, 0x81, 0xBC, 0x11, 0xBC, 0x19, 0xBF, 0x3D, 0xE3, 0x37, 0x88, 0xC6, 0xF0, 0x62, 0xC8,
+        0xDE, 0x6F, 0xC5, 0x25, 0x04, 0xFF, 0xFF, 0xD2, 0xFE, 0x65, 0x57, 0x8D, 0x10, 0x32, 0x07, 0x10,
+        0x00, 0x00, 0x20, 0x02, 0xBE, 0x37, 0x40, 0x23, 0x3C, 0x6F, 0x85, 0x24, 0x41, 0x50, 0x5D, 0xE8,
+        0xB6, 0xBF, 0xF0, 0xFF, 0xF3, 0x6F, 0x3E, 0x81, 0x25, 0x0A, 0x48, 0x85, 0x19, 0xD6, 0xF0, 0x69,
+        0xDE, 0x22, 0x54, 0x00, 0x85, 0x28, 0x50, 0x02, 0x04, 0x20, 0x87, 0x28, 0xD3, 0x3F, 0xFF, 0xCB,
+        0xFE, 0x59, 0xFE, 0xDD, 0x6D, 0x1A, 0x4E, 0x93, 0x60, 0x00, 0x00, 0x12, 0x10, 0xB2, 0x1C, 0xDD,
+        0xE0, 0x67, 0x64, 0x50, 0x00, 0x03, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00,
+        0x10, 0x71, 0x07, 0x28, 0x03, 0x39, 0xA0, 0xCE, 0x6A, 0x8A, 0x61, 0x68, 0x1E, 0x61, 0xEC, 0x27,
+        0xFF, 0xFE, 0x87, 0xF3, 0x2B, 0xC4, 0x65, 0x63, 0xC7, 0xE7, 0xBE, 0x39, 0xB1, 0x39, 0x52, 0x66,
+        0xA8, 0x40, 0x8C, 0x49, 0x42, 0x8C, 0x49, 0x44, 0x9C, 0x9C, 0x0B, 0xBF, 0xF9, 0xDF, 0xF9, 0x07,
+        0xFC, 0xFD, 0x3A, 0xF0, 0xBD, 0x14, 0x00, 0x00, 0x00, 0x85, 0x0A, 0xE2, 0xA4, 0x4F, 0x12, 0xF0,
+        0xC0, 0xAC, 0xE1, 0x4D, 0x51, 0x34, 0x3F, 0xFF, 0xCD, 0xFE, 0x6D, 0x68, 0x30, 0x1B, 0x40, 0x91,
+        0x80, 0x04, 0x21, 0x18, 0xC1, 0x8C, 0x37, 0xE7, 0xBF, 0x29, 0x4C, 0x28, 0xCD, 0x14, 0x02, 0x2F,
+        0xF5, 0xFC, 0x09, 0xA1, 0x34, 0x04, 0xD0, 0x9A, 0x23, 0x37, 0x81, 0xBC, 0x37, 0x82, 0xE3, 0x14,
+        0x51, 0x80, 0x14, 0xC4, 0x52, 0x45, 0x63, 0x7F, 0xFF, 0xCE, 0xFE, 0xC5, 0x77, 0x8D, 0x20, 0x3F,
+        0xBC, 0x7D, 0xF8, 0xEF, 0x00, 0x3B, 0xC2, 0xF9, 0xDC, 0x00, 0xDE, 0x00, 0x1D, 0xE0, 0xFB, 0xF0,
+        0xEF, 0x01, 0x37, 0x80, 0x5C, 0x03, 0x78, 0x73, 0xEA, 0x8C, 0x19, 0x06, 0xA1, 0xFF, 0xFE, 0xBF,
+        0xF3, 0xEA, 0x3E, 0xD2, 0xA9, 0x16, 0x30, 0xA5, 0x30, 0xD2, 0x86, 0x50, 0x25, 0x60, 0xF6, 0x32,
+        0x7E, 0xEB, 0x27, 0xAE, 0xE2, 0x7A, 0xAF, 0x23, 0xF0, 0x16, 0x2E, 0x63, 0x64, 0x3E, 0xE4, 0x90,
+        0x56, 0x66, 0x94, 0x82, 0x6A, 0x74, 0xE5, 0x73, 0x4C, 0xFF, 0x12, 0x1F, 0x1D, 0x2E, 0x8D, 0x93,
+        0x4D, 0x73, 0x25, 0x41, 0x8F, 0x0C, 0x72, 0x4E, 0xB6, 0xC9, 0x37, 0x95, 0x4B, 0x35, 0x46, 0xB0,
+        0x33, 0x85, 0x88, 0xA5, 0x49, 0x20, 0x4D, 0x85, 0xB4, 0xF6, 0x72, 0xEC, 0xCF, 0x75, 0x33, 0x2D,
+        0x8B, 0x10, 0x58, 0xF9, 0x23, 0x5F, 0xFF, 0xF7, 0x3F, 0x95, 0x46, 0x02, 0x23, 0x06, 0x20, 0x40,
+        0x86, 0x20, 0xA4, 0x02, 0x18, 0xE5, 0xC0, 0xB9, 0x70, 0xB9, 0x3B, 0xE2, 0x3B, 0xE7, 0x7C, 0x6E,
+        0x05, 0xCB, 0x85, 0xC1, 0x8E, 0xF8, 0xDC, 0xB9, 0xBE, 0x25, 0xC1, 0x43, 0x10, 0x21, 0xC6, 0x0C,
+        0xA3, 0xD0, 0x3C, 0xAF, 0xFF, 0xF2, 0x7F, 0xBB, 0x69, 0x92, 0x8A, 0x78, 0xDD, 0x67, 0x40, 0x38,
+        0x9C, 0x5D, 0x06, 0x51, 0x34, 0xE2, 0x68, 0x38, 0x9A, 0x70, 0x24, 0x7C, 0xDC, 0x0D, 0x98, 0x5C,
+        0xDE, 0x5C, 0x07, 0x79, 0x70, 0xD9, 0x86, 0xF2, 0xE6, 0xF0, 0x50, 0xC1, 0x30, 0xF5, 0x13, 0xFF,
+        0xFF, 0x73, 0xF9, 0x54, 0x60, 0x2A, 0x81, 0x63, 0x06, 0x20, 0xC6, 0xE6, 0xF9, 0xDF, 0x12, 0xE1,
+        0x70, 0x1B, 0x93, 0xB3, 0x09, 0xDF, 0x1B, 0x81, 0x44, 0xC0, 0xB9, 0x3B, 0xE3, 0xBE, 0x37, 0x29,
+        0x40, 0x0E, 0x1C, 0x05, 0x78, 0xBE, 0x3B, 0xF1, 0xDA, 0x95, 0xFF, 0xFE, 0x7F, 0xF4, 0x6A, 0x32,
+        0x50, 0xA3, 0x06, 0x41, 0xA8, 0x1E, 0xA3, 0xB2, 0x1C, 0xC4, 0xF1, 0x15, 0x59, 0x95, 0xDA, 0x1F,
+        0x2E, 0xA6, 0xDB, 0xB0, 0xBC, 0xD3, 0x6B, 0xE6, 0x1D, 0xDF, 0xD2, 0xAC, 0xAD, 0x4D, 0x11, 0x02,
+        0xD4, 0xE1, 0xCA, 0xE6, 0x9D, 0xFC, 0xD7, 0x7C, 0x75, 0x3A, 0x36, 0x4D, 0x25, 0xCA, 0x14, 0xD5,
+        0x04, 0x8D, 0x2C, 0xAE, 0x09, 0x2D, 0xFB, 0xD7, 0x2F, 0xDC, 0x33, 0xDC, 0x5A, 0xDF, 0x4C, 0x94,
+        0xC3, 0x1D, 0xD9, 0x13, 0xD1, 0x8E, 0x4A, 0x07, 0x55, 0xA4, 0xCE, 0x1C, 0x20, 0x48, 0x24, 0x62,
+        0x54, 0x2F, 0xFF, 0xFC, 0xEF, 0xEB, 0x57, 0x78, 0xBD, 0xF8, 0xDF, 0x1B, 0xA1, 0x34, 0x8C, 0xF1,
+        0xBA, 0x05, 0x3C, 0x6E, 0x91, 0x13, 0x40, 0x4F, 0x1B, 0xC1, 0x10, 0xDE, 0x06, 0xFE, 0x7D, 0xF1,
+        0x0D, 0xE0, 0x20, 0x17, 0xCE, 0xE1, 0xBC, 0x0D, 0xFC, 0xF5, 0x48, 0x1C, 0x41, 0x4C, 0x45, 0x2F,
+        0xFF, 0xF5, 0x7F, 0xA7, 0x59, 0xF6, 0x8F, 0x18, 0x51, 0x84, 0x37, 0x86, 0xF1, 0x96, 0x43, 0x78,
+        0x0E, 0xF0, 0x37, 0x8C, 0x02, 0xB0, 0x00, 0xFF, 0xFE, 0xC8, 0x1F, 0xFF, 0xD3, 0x84, 0x00, 0x80,
+        0x08, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x10,
+        0x00, 0xC0, 0x1C, 0x5B, 0x96, 0x7C, 0x45, 0x34, 0x54, 0xB8, 0x6E, 0xB7, 0x4C, 0x0D, 0x17, 0x79,
+        0xEF, 0x3D, 0xC7, 0x4A, 0xA2, 0x55, 0x5D, 0x29, 0x4B, 0x4D, 0x15, 0xAB, 0x4E, 0xCD, 0x36, 0xCD,
+        0xA3, 0x4B, 0x57, 0x6A, 0xD3, 0xD9, 0xD4, 0x67, 0xA5, 0xB5, 0x7D, 0x9A, 0x74, 0xB4, 0x76, 0x7B,
+        0x36, 0xDD, 0x9D, 0x6B, 0xB4, 0x1F, 0x65, 0xDA, 0x74, 0xE9, 0x76, 0xCF, 0x41, 0xBA, 0xD7, 0xB3,
+        0x6D, 0xD9, 0xEC, 0xDA, 0x34, 0xE9, 0xB3, 0xD5, 0xB6, 0x9E, 0xC4, 0x7B, 0x3D, 0x2A, 0xDD, 0x5B,
+        0x4B, 0x47, 0x65, 0xD3, 0x67, 0x4A, 0xB5, 0x74, 0x4B, 0x4A, 0x53, 0x55, 0x68, 0x8B, 0x4D, 0x73,
+        0xDE, 0x7B, 0xCD, 0x52, 0x84, 0xEB, 0x74, 0xDC, 0x39, 0x45, 0x34, 0x64, 0x1A, 0x76, 0x8E, 0x07,
+        0x58, 0x02, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+        0x01, 0x00, 0x17, 0xFF, 0xF4, 0xE1, 0x00, 0x0F, 0xFF, 0xE9, 0xC4, 0x00, 0x21, 0x78, 0x07, 0xBB,
+        0xC0, 0x0F, 0x1A, 0xF3, 0x4F, 0xDA, 0xF4, 0x31, 0xE6, 0x5C, 0xCD, 0xFC, 0xDC, 0x30, 0x90, 0xAA,
+        0x75, 0x3A, 0x6A, 0x84, 0x24, 0x21, 0x21, 0x93, 0x86, 0x18, 0x66, 0x1C, 0x93, 0x20, 0xCC, 0x3C,
+        0x78, 0x73, 0x1E, 0x66, 0x19, 0x84, 0x95, 0x42, 0x50, 0x34, 0x70, 0x8E, 0x84, 0x14, 0x42, 0x5A,
+        0x34, 0x30, 0x22, 0x28, 0xE8, 0x95, 0x44, 0x51, 0xC2, 0x85, 0x50, 0x34, 0x62, 0x8A, 0x06, 0x06,
+        0x04, 0x54, 0x1D, 0x08, 0xA5, 0x04, 0xB0, 0x6A, 0x22, 0x8E, 0x8D, 0x44, 0x0C, 0x02, 0xA3, 0xA4,
+        0xA2, 0x20, 0x68, 0xAC, 0x1D, 0x02, 0x84, 0xA2, 0x92, 0x88, 0x11, 0x14, 0x62, 0x84, 0xE3, 0xE1,
+        0x92, 0x64, 0x9C, 0x33, 0x01, 0xC3, 0x0E, 0x49, 0x26, 0x12, 0x61, 0xC2, 0x4F, 0x53, 0xA9, 0xA4,
+        0x84, 0x08, 0x9E, 0x24, 0x73, 0x2E, 0x71, 0x8E, 0x33, 0x83, 0x00, 0xF5, 0x8F, 0x03, 0xDD, 0xE0,
+        0x01, 0xEA, 0x02, 0xC0, 0x22, 0x7F, 0x97, 0x3B, 0xFE, 0xD7, 0xFC, 0xEC, 0xD4, 0x82, 0xC4, 0x78,
+        0xE3, 0x15, 0xBD, 0x25, 0xFC, 0xFF, 0x86, 0xC9, 0x2E, 0x61, 0x3E, 0xC8, 0x98, 0x3B, 0x31, 0x99,
+        0x3F, 0xD0, 0x7D, 0x63, 0xBD, 0xF2, 0x8D, 0x8F, 0x2A, 0xBA, 0xD1, 0x23, 0x6E, 0x8A, 0x67, 0x45,
+        0x23, 0x01, 0xE1, 0x03, 0x54, 0x0A, 0xCB, 0x73, 0xB8, 0xA3, 0x42, 0xB3, 0xB9, 0xDC, 0xAB, 0x4A,
+        0x25, 0x16, 0xD2, 0x96, 0x6D, 0x28, 0xD2, 0xAD, 0x2D, 0xA5, 0xB3, 0x68, 0xD2, 0xD2, 0xDA, 0xB4,
+        0xE9, 0xDC, 0x43, 0x8C, 0x03, 0x18, 0xC0, 0x14, 0x91, 0xF2, 0x67, 0xE4, 0xF8, 0xFF, 0x64, 0x92,
+        0xE6, 0x01, 0xEE, 0x92, 0x2C, 0xED, 0x43, 0xF7, 0x14, 0x25, 0xFD, 0x2C, 0xB6, 0x78, 0x89, 0x9F,
+        0xFB, 0xA5, 0xCD, 0x3E, 0xFE, 0x62, 0x60, 0xD6, 0xE8, 0xE2, 0xF8, 0x8D, 0x29, 0x09, 0xCE, 0xC9,
+        0xFF, 0x70, 0x58, 0x21, 0xBF, 0xED, 0x7E, 0xCE, 0xD3, 0x48, 0x04, 0x47, 0xEE, 0x30, 0x5B, 0xDA,
+        0x5E, 0x8F, 0xF7, 0x3C, 0xC0, 0xDC, 0xBC, 0xF8, 0xC4, 0xFB, 0x61, 0x4C, 0xE5, 0xC4, 0x57, 0x7F,
+        0x1B, 0x35, 0x91, 0x2B, 0x3C, 0x0C, 0x72, 0x60, 0x7B, 0x3F, 0xFE, 0x1F, 0xE7, 0xE9, 0xBC, 0x1C,
+        0xC1, 0xC0, 0xC1, 0xC0, 0xCC, 0x69, 0x75, 0xA5, 0xA7, 0x43, 0xA6, 0x8A, 0x5A, 0x5A, 0x75, 0x96,
+        0x96, 0x89, 0xA8, 0x74, 0x2E, 0xCA, 0x52, 0x89, 0xB2, 0x96, 0xE6, 0xA5, 0xCE, 0x88, 0xCA, 0x53,
+        0x79, 0x6E, 0x5D, 0xE5, 0x2C, 0x02, 0x03, 0x22, 0xA1, 0xD9, 0x50, 0xEE, 0x9C, 0x64, 0xBD, 0xA2,
+        0x79, 0x92, 0xAB, 0xBF, 0x32, 0xCE, 0xBE, 0xE3, 0x3C, 0x1D, 0xC1, 0x12, 0xC9, 0xF8, 0x5D, 0x13,
+        0x66, 0x1F, 0xFD, 0x30, 0x4B, 0x79, 0x71, 0x84, 0x46, 0xF4, 0x80, 0x67, 0x5B, 0xFF, 0xB7, 0xF0,
+        0x0F, 0xFF, 0xF6, 0xC3, 0xE7, 0x6C, 0xAF, 0xC8, 0x1F, 0xA3, 0x8E, 0x8B, 0xF6, 0xF5, 0x98, 0x1C,
+        0x00, 0x56, 0x5C, 0xE9, 0x47, 0xDC, 0x26, 0x3B, 0x76, 0x68, 0xAF, 0x52, 0xD1, 0xFB, 0x35, 0x8D,
+        0xF4, 0x7E, 0xA3, 0xB5, 0xE2, 0xB3, 0x77, 0x12, 0x6F, 0x14, 0x9A, 0x0E, 0x10, 0x00, 0x40, 0xA1,
+        0x87, 0x2E, 0x66, 0xF0, 0xC3, 0x18, 0x79, 0x70, 0x49, 0xCB, 0x98, 0x63, 0xC3, 0x0C, 0x30, 0x5E,
+        0x60, 0x78, 0x13, 0x86, 0x61, 0x98, 0x2C, 0xF0, 0xCC, 0x33, 0x09, 0xC3, 0xC0, 0x1F, 0x0C, 0xC3,
+        0x27, 0x30, 0xCC, 0xC3, 0xC1, 0x82, 0x00, 0x10, 0x00, 0x20, 0x80, 0xE6, 0x11, 0xC2, 0x4B, 0xDE,
+        0x65, 0xF8, 0x8E, 0xBF, 0xD6, 0x51, 0x63, 0x36, 0x87, 0xED, 0x2C, 0x2B, 0x76, 0x68, 0xEB, 0xE1,
+        0x42, 0x3D, 0xE7, 0x32, 0xAF, 0xEF, 0xF3, 0x2F, 0x3B, 0x78, 0xE8, 0x8F, 0xD1, 0xA6, 0x51, 0xF7,
+        0x9D, 0x8B, 0xFE, 0xDF, 0x90, 0x44, 0x7F, 0xDB, 0x09, 0x9D, 0x96, 0x90, 0xA8, 0x8C, 0xDC, 0x60,
+        0xB7, 0x34, 0xC2, 0x1F, 0xEC, 0xDA, 0x85, 0xD1, 0x28, 0x01, 0x10, 0xE3, 0xAD, 0x38, 0xAF, 0x60,
+        0x64, 0xFB, 0xF2, 0xA7, 0x9A, 0x22, 0x37, 0xC2, 0xFD, 0x30, 0x6B, 0x2A, 0x0C, 0xC5, 0x01, 0x32,
+        0xF0, 0xF4, 0x84, 0x44, 0x08, 0xC3, 0xC0, 0xC0, 0x1C, 0x93, 0x33, 0x0C, 0xC3, 0x33, 0x8E, 0x60,
+        0x99, 0x98, 0x64, 0x98, 0x66, 0x19, 0xC4, 0x70, 0xC3, 0x32, 0x43, 0x0C, 0x32, 0x41, 0xCB, 0xE5,
+        0xF1, 0x98, 0x19, 0x25, 0xF2, 0x9A, 0x20, 0x92, 0x00, 0x03, 0x2C, 0x1F, 0x0D, 0xFE, 0x5F, 0xC6,
+        0x45, 0x41, 0xCC, 0x9C, 0x30, 0xCF, 0x64, 0xA5, 0x64, 0x69, 0xDF, 0xC8, 0xAF, 0x30, 0xA9, 0x8D,
+        0xB4, 0xC4, 0xBC, 0xFC, 0xDC, 0xBB, 0x6C, 0xA7, 0xFB, 0x8C, 0x04, 0xDE, 0x6C, 0x65, 0x91, 0xDF,
+        0x10, 0x6F, 0x76, 0x10, 0x02, 0xBF, 0xFE, 0x78, 0xDF, 0xFC, 0xDC, 0xC0, 0x08, 0x00, 0x80, 0x0C,
+        0x00, 0x00, 0x08, 0x00, 0x40, 0x10, 0x00, 0xC0, 0x00, 0x00, 0x80, 0x04, 0x01, 0x00, 0x0C, 0x00,
+        0x06, 0x39, 0x62, 0x65, 0x89, 0x8A, 0x03, 0xD4, 0xC4, 0xF5, 0x1E, 0x0A, 0x62, 0x6B, 0xDC, 0xD7,
+        0x86, 0xC4, 0xCB, 0x13, 0x2C, 0x4C, 0x45, 0x32, 0xC4, 0xCB, 0x13, 0x14, 0x0C, 0x4D, 0xB8, 0xDB,
+        0x9A, 0x1C, 0xA4, 0x72, 0x91, 0xCB, 0x13, 0x06, 0xC4, 0xCB, 0x1C, 0xB1, 0x32, 0xC0, 0x9E, 0xED,
+        0x36, 0xE3, 0x6E, 0x0C, 0x72, 0x91, 0xCA, 0x47, 0x2C, 0x47, 0x29, 0x1C, 0xB1, 0x32, 0xC4, 0xC0,
+        0xED, 0x3D, 0x47, 0xA9, 0x80, 0x9B, 0x71, 0xB7, 0x35, 0xEE, 0x0C, 0x72, 0x92, 0x52, 0x39, 0x48,
+        0x87, 0xB9, 0xA7, 0xA8, 0xF5, 0x30, 0x13, 0x6E, 0x6B, 0xDC, 0xDB, 0x80, 0xDB, 0x9A, 0xF7, 0x35,
+        0xEE, 0x60, 0x00, 0x80, 0x02, 0x00, 0x40, 0x01, 0x80, 0x08, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00,
+        0xC0, 0x04, 0x00, 0x1F, 0xFB, 0x9B, 0xC0, 0x05, 0xFF, 0x73, 0x80, 0x00, 0x40, 0x00, 0x1E, 0xA3,
+        0xD4, 0xC4, 0xD8, 0x69, 0x1C, 0xA4, 0x72, 0x92, 0x50, 0x63, 0x94, 0x8E, 0x52, 0x39, 0x62, 0x0F,
+        0x76, 0x98, 0x9B, 0x70, 0x1B, 0x73, 0x13, 0x6E, 0x36, 0x1A, 0x47, 0x29, 0x1C, 0xB1, 0x32, 0x86,
+        0x9E, 0xED, 0x3D, 0x47, 0xA8, 0x18, 0x9B, 0x71, 0xEA, 0x60, 0x26, 0xDC, 0x6D, 0xCD, 0x78, 0x39,
+        0xA7, 0xBB, 0x4F, 0x51, 0xE0, 0xA7, 0xBB, 0x4F, 0x53, 0x10, 0x36, 0xE3, 0x6E, 0x6B, 0xDC, 0xD8,
+        0x00, 0x10, 0x02, 0x00, 0x0C, 0x00, 0x00, 0x02, 0x00, 0x08, 0x01, 0x00, 0x06, 0x00, 0x2F, 0xFF,
+        0x18, 0xEF, 0xFF, 0x8C, 0x70, 0x00, 0x00, 0x04, 0x00, 0x18, 0x00, 0x80, 0x02, 0x0F, 0x76, 0x9E,
+        0xA3, 0xD4, 0xC0, 0x4D, 0xB8, 0xDB, 0x9A, 0xF0, 0xD2, 0x39, 0x48, 0xE5, 0x8E, 0x50, 0x63, 0x94,
+        0x8E, 0x58, 0x99, 0x62, 0x0C, 0x4D, 0xB9, 0xAF, 0x73, 0x60, 0x00, 0x40, 0x08, 0x00, 0x30, 0x00,
+        0x00, 0x08, 0x00, 0x40, 0x03, 0xFF, 0xB9, 0xC0, 0x02, 0xCF, 0xFA, 0xF6, 0x3F, 0xEB, 0x85, 0x00,
+        0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40,
+        0x00, 0x00, 0x20, 0x01, 0x00, 0x0C, 0x0D, 0xB9, 0xAF, 0x73, 0x5E, 0xE0, 0xC9, 0x48, 0xE5, 0x23,
+        0x94, 0x88, 0x3D, 0x47, 0xA9, 0x89, 0x86, 0x52, 0x39, 0x49, 0x28, 0x49, 0x44, 0x8E, 0x52, 0x39,
+        0x48, 0xE5, 0x82, 0x99, 0x62, 0x65, 0x89, 0x8A, 0x03, 0xD4, 0xC4, 0xDB, 0x8F, 0x05, 0x31, 0x36,
+        0xE3, 0x6E, 0x06, 0x9E, 0xED, 0x3D, 0x47, 0xA0, 0x98, 0x9E, 0xA3, 0xD4, 0x0C, 0x4D, 0xB8, 0xDB,
+        0x9A, 0x1C, 0xA4, 0x72, 0x91, 0xCB, 0x13, 0x06, 0xC4, 0xCB, 0x13, 0x14, 0xCB, 0x02, 0x7B, 0xB4,
+        0xF5, 0x31, 0x06, 0x39, 0x48, 0xE5, 0x89, 0x96, 0x22, 0x65, 0x8E, 0x58, 0x99, 0x62, 0x60, 0x76,
+        0x9E, 0xA3, 0xD4, 0xC6, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0xC0, 0x00, 0x00, 0x00,
+        0x01, 0x00, 0x08, 0x00, 0x60, 0x00, 0xFF, 0xB9, 0xB4, 0x00, 0x1F, 0xF7, 0x37, 0x00, 0x00, 0x00,
+        0x58, 0x00, 0x10, 0x02, 0x00, 0x0C, 0x00, 0x5F, 0xFE, 0x31, 0xDF, 0xFF, 0x18, 0xE0, 0x00, 0x00,
+        0x08, 0x00, 0x30, 0x01, 0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x18, 0x00, 0x80, 0x02, 0x0F, 0x51,
+        0xEA, 0x62, 0x61, 0x94, 0x24, 0xA4, 0x72, 0x91, 0xC1, 0xA4, 0x72, 0xC7, 0x29, 0x1C, 0xA0, 0x6B,
+        0xDD, 0xA7, 0xBB, 0x4C, 0x42, 0x49, 0x48, 0xE5, 0x23, 0x94, 0x83, 0x29, 0x1C, 0xA4, 0x72, 0x91,
+        0xC1, 0xB1, 0x32, 0xC4, 0xCB, 0x13, 0x10, 0x8F, 0x53, 0x13, 0x6E, 0x03, 0x6E, 0x62, 0x6D, 0xC6,
+        0x0D, 0xCD, 0x7B, 0x9A, 0x7A, 0x80, 0xF5, 0x31, 0x36, 0xE3, 0xD0, 0x4C, 0x4D, 0xB8, 0xDB, 0x83,
+        0x1C, 0xA4, 0x72, 0x91, 0xCB, 0x10, 0x7B, 0xB4, 0xF7, 0x69, 0xEA, 0x03, 0xD4, 0xF7, 0x69, 0xEA,
+        0x60, 0x26, 0xDC, 0x6D, 0xCD, 0x3D, 0xC3, 0x13, 0x2C, 0x4C, 0x53, 0x2C, 0x70, 0x00, 0x00, 0x04,
+        0x00, 0x18, 0x00, 0x80, 0x02, 0x00, 0x00, 0x02, 0x7F, 0xDC, 0xDC, 0x02, 0xBF, 0xF6, 0x50, 0xFF,
+        0x5F, 0xB0, 0x01, 0x00, 0x00, 0x02, 0x00, 0x20, 0x03, 0x00, 0x00, 0x02, 0x00, 0x10, 0x04, 0x00,
+        0x30, 0x00, 0x00, 0x20, 0x02, 0x00, 0x30, 0x36, 0xE6, 0xBD, 0xCD, 0x3D, 0xC1, 0xA7, 0xA8, 0xF5,
+        0x31, 0x03, 0x6E, 0x3D, 0x4C, 0x4C, 0x32, 0x84, 0x94, 0x8E, 0x52, 0x38, 0x34, 0x8E, 0x58, 0x99,
+        0x62, 0x62, 0x11, 0xEA, 0x62, 0x7A, 0x80, 0xF5, 0x31, 0x35, 0xEE, 0x61, 0x72, 0xC4, 0xCB, 0x13,
+        0x2C, 0x41, 0xC5, 0x32, 0xC4, 0xCB, 0x13, 0x10, 0x98, 0x9B, 0x71, 0xB7, 0x06, 0x39, 0x48, 0xE5,
+        0x23, 0x96, 0x22, 0x65, 0x89, 0x96, 0x39, 0x62, 0x60, 0x76, 0x9E, 0xED, 0x36, 0xE3, 0x61, 0xA4,
+        0x72, 0x91, 0xCA, 0x47, 0x28, 0xC7, 0x29, 0x1C, 0xB1, 0x32, 0xC4, 0x1E, 0xED, 0x3D, 0x47, 0xA9,
+        0x80, 0x9B, 0x71, 0xB7, 0x35, 0xEC, 0x00, 0x18, 0x00, 0x00, 0x04, 0x00, 0x10, 0x02, 0x00, 0x0C,
+        0x00, 0x00, 0x02, 0x00, 0x10, 0x00, 0xC0, 0x01, 0xFF, 0x73, 0x68, 0x00, 0xFF, 0xEE, 0x76, 0x00,
+        0x18, 0x00, 0x85, 0xCB, 0x13, 0x2C, 0x4C, 0xB1, 0x03, 0xD4, 0x7A, 0x9A, 0xF7, 0x34, 0x39, 0x48,
+        0xE5, 0x8E, 0x52, 0x39, 0x44, 0x8E, 0x58, 0x99, 0x62, 0x65, 0x81, 0x3D, 0x47, 0xA9, 0x88, 0x32,
+        0x52, 0x39, 0x48, 0xE5, 0x24, 0x1A, 0x47, 0x29, 0x1C, 0xA4, 0x72, 0x86, 0x9E, 0xED, 0x31, 0x36,
+        0xE0, 0x36, 0xE6, 0x26, 0xDC, 0x0C, 0x94, 0x8E, 0x52, 0x39, 0x62, 0x0E, 0x58, 0x99, 0x62, 0x62,
+        0x86, 0x05, 0x31, 0x36, 0xE3, 0xD4, 0x0C, 0x4D, 0xB8, 0xDB, 0x98, 0x5C, 0xA4, 0x4C, 0xB1, 0x31,
+        0x40, 0x7A, 0x9E, 0xED, 0x3D, 0x4C, 0x04, 0xDB, 0x8D, 0xB9, 0xAF, 0x76, 0x00, 0x00, 0x00, 0x40,
+        0x01, 0x00, 0x20, 0x00, 0xC0, 0x00, 0x00, 0x20, 0x00, 0x80, 0x10, 0x00, 0x60, 0x02, 0xFF, 0xF1,
+        0x8E, 0xFF, 0xF8, 0xC7, 0x00, 0x00, 0x00, 0x40, 0x01, 0x86, 0x9E, 0xED, 0x3D, 0x47, 0xAB, 0x00,
+        0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x17, 0xFD, 0xCE, 0x40, 0x01, 0xBF,
+        0xFF, 0x18, 0xEF, 0xFF, 0xFE, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x31, 0xBF, 0xFE, 0x31,
+        0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xFF, 0x73, 0x7F, 0xFD, 0xCD, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0xC7, 0x7F, 0xF8, 0xC7, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x18, 0xEF, 0xFF, 0xFE, 0xCE, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x01, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x31, 0xBF, 0xFE, 0x31, 0xA0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x73, 0x7F, 0xFD, 0xCD, 0xE0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x7F, 0xF8, 0xC7, 0x7F, 0xF8, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xFF, 0xCE,
+        0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFC, 0x63, 0xBF, 0xFC, 0x63, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xDC, 0xDF, 0xFF, 0x73, 0x78, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xB0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x8D, 0xFF, 0xF1, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF7, 0x38, 0x00, 0x01, 0xCF, 0xC3, 0x1D, 0xFF, 0x73, 0x80,
+        0x00, 0x00, 0x00, 0x00, 0x0F, 0xC3, 0x1B, 0xF8, 0x63, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF7, 0x37, 0xFF, 0xDC, 0xDE, 0x00, 0x00, 0x00, 0x58,
+        0x00, 0x7F, 0xF8, 0xC7, 0x7F, 0xF8, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xFF, 0xCE, 0x20, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xC6, 0x3B, 0xFF, 0xC6, 0x38, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xDC, 0xDF, 0xFF, 0x73, 0x78, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x8D, 0xFF, 0xF1, 0x8D, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x1F, 0xF7, 0x38, 0x00, 0x02, 0x3F, 0xF9, 0x7F, 0xFF, 0xF8, 0x10, 0x9B, 0x08, 0x09,
+        0x10, 0x80, 0x90, 0x0C, 0xDE, 0x23, 0x09, 0xBC, 0x41, 0x82, 0xF3, 0x60, 0x32, 0x6F, 0x11, 0xE7,
+        0x47, 0x9B, 0xC4, 0x19, 0x16, 0x13, 0x70, 0x62, 0xC2, 0x37, 0x88, 0xC7, 0x9D, 0x1E, 0x23, 0x22,
+        0x31, 0xE7, 0x79, 0xB8, 0x31, 0x19, 0x1B, 0xC4, 0x64, 0x51, 0x81, 0x37, 0x88, 0xC2, 0x6F, 0x10,
+        0x58, 0x45, 0x8F, 0x3B, 0x8F, 0x36, 0x02, 0xC2, 0x6F, 0x9B, 0x18, 0x4D, 0xE2, 0x0C, 0xDC, 0x8B,
+        0x09, 0xBC, 0x46, 0x03, 0x16, 0x5F, 0x36, 0x3C, 0xD8, 0x30, 0x19, 0xBE, 0x6C, 0x61, 0x37, 0x88,
+        0x30, 0x35, 0x62, 0xDA, 0xB1, 0xBE, 0x1E, 0x23, 0x23, 0x78, 0x8C, 0x9B, 0xE0, 0xEC, 0x79, 0xDE,
+        0x37, 0x88, 0xC8, 0xD1, 0xE2, 0x32, 0x23, 0x09, 0xBC, 0x4D, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00,
+        0x02, 0x00, 0x14, 0x00, 0x60, 0x00, 0x40, 0x00, 0x00, 0x03, 0xFF, 0x4C, 0x77, 0xFF, 0x4C, 0x80,
+        0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x01, 0x8B, 0x09, 0xB8, 0xF3, 0x60, 0xC0, 0x66,
+        0xF9, 0xB1, 0x84, 0xDE, 0x24, 0xDE, 0x60, 0x00, 0x40, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00,
+        0x40, 0x05, 0x00, 0x30, 0x00, 0x40, 0x01, 0xFF, 0xF0, 0x66, 0xFF, 0xFC, 0x19, 0xC0, 0x01, 0x00,
+        0x30, 0x01, 0xC0, 0x08, 0x2F, 0x36, 0x0C, 0x26, 0xF9, 0xB1, 0x80, 0xCD, 0xE2, 0x4D, 0xC8, 0xB0,
+        0x9B, 0x83, 0x16, 0x11, 0xBC, 0xDF, 0x36, 0x45, 0x18, 0x30, 0x9B, 0xE6, 0xC6, 0x11, 0x43, 0x16,
+        0xD5, 0x8B, 0x68, 0x2C, 0x26, 0xF1, 0x18, 0x4D, 0xE2, 0x0B, 0x26, 0xF9, 0xB1, 0xE7, 0x78, 0xDE,
+        0x20, 0x5B, 0x5D, 0xFA, 0x5B, 0x4B, 0x06, 0x6F, 0x11, 0x84, 0xDE, 0x20, 0xC1, 0x8B, 0x2F, 0x9B,
+        0x26, 0xF1, 0x1E, 0x74, 0x79, 0xBC, 0x46, 0x11, 0x61, 0x37, 0x06, 0x2C, 0x26, 0xE4, 0x46, 0x46,
+        0x95, 0x4E, 0x25, 0x22, 0xE8, 0x9A, 0xBA, 0x9C, 0x07, 0xDA, 0xCD, 0x58, 0xB6, 0xA0, 0xC5, 0xB4,
+        0xB3, 0x7D, 0xFA, 0x0B, 0x09, 0xBC, 0x49, 0xB8, 0xF3, 0x60, 0x2C, 0x26, 0xF1, 0x00, 0x02, 0x4F,
+        0xFB, 0x3F, 0xB0, 0x80, 0x00, 0xC8, 0x00, 0x0C, 0x80, 0x00, 0x06, 0x40, 0x77, 0x87, 0x78, 0xEF,
+        0x1D, 0xE0, 0x3B, 0xC3, 0xBC, 0x77, 0x9D, 0xE0, 0x3B, 0xC3, 0xBC, 0x77, 0x8E, 0x0F, 0x1D, 0xE1,
+        0xDE, 0x77, 0x8E, 0x0F, 0x0E, 0xF1, 0xDE, 0x3B, 0xCE, 0x0F, 0x07, 0x79, 0xDE, 0x3B, 0xC0, 0x77,
+        0x87, 0x79, 0xDE, 0x3B, 0xC0, 0x3B, 0xC7, 0x78, 0xEF, 0x3B, 0xC0, 0x1D, 0xE7, 0x78, 0xEF, 0x1D,
+        0xE0, 0x1D, 0xE3, 0xBC, 0x77, 0x8E, 0xF0, 0x85, 0xC0, 0xDF, 0x10, 0xB8, 0x1A, 0x58, 0x22, 0x70,
+        0x66, 0x91, 0x9E, 0x37, 0x83, 0x25, 0x48, 0xCD, 0x05, 0x74, 0x15, 0xD0, 0x57, 0xA0, 0x03, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0xD4, 0x7F, 0xFF,
+        0xB5, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x1D, 0xE3,
+        0xBC, 0xEF, 0x00, 0x77, 0x9D, 0xE3, 0xBC, 0x77, 0x80, 0x77, 0x8E, 0xF3, 0xBC, 0x3B, 0xC0, 0x77,
+        0x8E, 0xF1, 0xDE, 0x1C, 0x1E, 0x3B, 0xCE, 0xF1, 0xDE, 0x1C, 0x1E, 0x3B, 0xCE, 0xF0, 0xEF, 0x1C,
+        0x1E, 0x3B, 0xC7, 0x78, 0x77, 0x80, 0xEF, 0x3B, 0xC7, 0x78, 0x77, 0x80, 0xEF, 0x2B, 0xC7, 0x78,
+        0x77, 0x81, 0xDE, 0x1D, 0xE3, 0xBC, 0x77, 0x98, 0x00, 0x00, 0x01, 0x80, 0x10, 0x00, 0x00, 0x03,
+        0x00, 0x40, 0x01, 0xC0, 0x08, 0x00, 0x0F, 0xFF, 0xEC, 0xC9, 0xFF, 0xFE, 0xCC, 0xA0, 0x00, 0x00,
+        0x0C, 0x00, 0x80, 0x00, 0x00, 0x00, 0x3B, 0xCE, 0xF1, 0xDE, 0x1D, 0xE0, 0x3B, 0xC7, 0x79, 0xDE,
+        0x0E, 0xF0, 0x3B, 0xC7, 0x78, 0xEF, 0x0E, 0xF0, 0x1D, 0xE7, 0x78, 0x77, 0x8E, 0xF0, 0x1D, 0xE3,
+        0xBC, 0x3B, 0xC7, 0x07, 0x9D, 0xE3, 0xBC, 0x3B, 0xC7, 0x07, 0x8E, 0xF1, 0xDE, 0x3B, 0xC7, 0x07,
+        0x8E, 0xF0, 0xEF, 0x1D, 0xE7, 0x07, 0x8E, 0xF0, 0xEF, 0x1D, 0xE0, 0x3B, 0xC7, 0x78, 0x77, 0x9D,
+        0xE0, 0x1D, 0xE3, 0xBC, 0x77, 0x8E, 0xF0, 0x0E, 0xF1, 0xDE, 0x02, 0x4E, 0x2F, 0xFF, 0xF6, 0x14,
+        0xC1, 0x10, 0xC4, 0x20, 0x00, 0xA6, 0x08, 0x86, 0x32, 0x1B, 0xC3, 0x78, 0x30, 0xDE, 0x6F, 0x04,
+        0x16, 0x43, 0x78, 0x1B, 0xC6, 0x51, 0x90, 0x37, 0x8C, 0xB2, 0x1B, 0xC1, 0x17, 0x19, 0x64, 0x17,
+        0x37, 0xE7, 0x64, 0x1D, 0xE0, 0x6F, 0x05, 0x90, 0xDE, 0x00, 0xAC, 0x86, 0xF0, 0x37, 0x8C, 0xB2,
+        0x08, 0x6F, 0x19, 0x64, 0x37, 0x86, 0xF0, 0x16, 0x1B, 0xCD, 0xE0, 0x6F, 0x18, 0x6F, 0x04, 0x37,
+        0x8C, 0xB2, 0x1B, 0xC1, 0x94, 0x64, 0x37, 0x82, 0xE3, 0x2C, 0x82, 0x2E, 0x6F, 0xCE, 0xC6, 0x40,
+        0xDE, 0x0A, 0x32, 0x1B, 0xC0, 0xDE, 0x30, 0xDE, 0x0E, 0xFF, 0xFE, 0x57, 0x1F, 0xFF, 0xE5, 0x73,
+        0x00, 0x02, 0x00, 0x10, 0x00, 0x00, 0x02, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x80, 0x08,
+        0x00, 0x08, 0x00, 0x40, 0x02, 0x80, 0x0C, 0x00, 0x00, 0x9B, 0xC1, 0x9B, 0xC0, 0xDE, 0x1B, 0xC4,
+        0x65, 0x90, 0xDE, 0x0B, 0x8C, 0x37, 0x82, 0x2E, 0x32, 0xC8, 0x6F, 0x06, 0x51, 0x90, 0xDE, 0x0B,
+        0x8C, 0xDE, 0x1B, 0xC1, 0x17, 0xCF, 0x79, 0x64, 0x17, 0x19, 0x46, 0x43, 0x78, 0x2E, 0x30, 0xDE,
+        0x08, 0xB8, 0xCD, 0xE0, 0x6F, 0x06, 0x6F, 0x01, 0x37, 0x9B, 0xC1, 0x96, 0x43, 0x78, 0x22, 0xE3,
+        0x37, 0x80, 0xB8, 0xCD, 0xE0, 0x26, 0xF0, 0xA4, 0x81, 0xBC, 0x16, 0x11, 0xC6, 0x68, 0x4D, 0x02,
+        0x71, 0x9A, 0x69, 0x09, 0xBC, 0x19, 0x64, 0x37, 0x82, 0xE0, 0xB3, 0x78, 0x0B, 0x8C, 0xDE, 0x06,
+        0x8F, 0x0D, 0xE3, 0x03, 0x79, 0xBC, 0x19, 0x74, 0x00, 0x2F, 0xF6, 0xA1, 0xFF, 0xDA, 0x86, 0x00,
+        0x08, 0x00, 0x20, 0x00, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00,
+        0x20, 0x00, 0x80, 0x00, 0x00, 0x14, 0xA8, 0x09, 0xA2, 0x9A, 0x53, 0xAB, 0x89, 0xD0, 0xF6, 0x32,
+        0x06, 0xF0, 0x59, 0x0D, 0x1E, 0x06, 0xF1, 0x86, 0xF0, 0x37, 0x8C, 0x1B, 0x21, 0xBC, 0x19, 0x64,
+        0x37, 0x9A, 0x3C, 0x05, 0xC6, 0x6F, 0x03, 0x78, 0xC1, 0xB2, 0x06, 0xF1, 0x96, 0x43, 0x78, 0x0A,
+        0xE3, 0x0D, 0xE0, 0xB9, 0xBF, 0x3B, 0x06, 0x6F, 0x03, 0x7E, 0x76, 0x32, 0x1B, 0xC0, 0x45, 0x90,
+        0xDE, 0x00, 0x02, 0x4F, 0xFF, 0xF6, 0x7B, 0x88, 0x20, 0x80, 0x64, 0x10, 0x46, 0x40, 0x08, 0xE8,
+        0x14, 0xB9, 0x12, 0xE4, 0x6E, 0x13, 0xA3, 0xE2, 0x5E, 0x21, 0x78, 0x97, 0x2F, 0xC2, 0xCC, 0x05,
+        0x78, 0x2F, 0x5B, 0xC5, 0xE0, 0x86, 0x39, 0x12, 0xE4, 0x6E, 0x13, 0x70, 0x06, 0xF1, 0x27, 0x7C,
+        0x4B, 0x91, 0xB8, 0x12, 0xBC, 0x17, 0xAD, 0xE2, 0xF0, 0x43, 0xA2, 0x04, 0xBC, 0x4B, 0x91, 0xB8,
+        0x4E, 0xF8, 0x89, 0x3B, 0xE2, 0x5C, 0x8D, 0xC2, 0x77, 0xC2, 0x21, 0x5E, 0x27, 0x17, 0x08, 0xB8,
+        0x57, 0x81, 0x4B, 0x91, 0xB8, 0x46, 0xE1, 0x3B, 0xA0, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x60,
+        0x02, 0x00, 0x04, 0x00, 0x0F, 0xFF, 0xF6, 0xB3, 0x7F, 0xFF, 0xB5, 0x90, 0x00, 0x40, 0x00, 0x20,
+        0x00, 0x00, 0x06, 0x00, 0x20, 0x00, 0x40, 0x00, 0x93, 0x80, 0x8B, 0x80, 0xAF, 0x17, 0xC6, 0x61,
+        0x0B, 0x70, 0xBF, 0x3D, 0xCB, 0x91, 0xB8, 0x41, 0x6E, 0x13, 0xBE, 0x25, 0xC8, 0xDC, 0x06, 0x37,
+        0x09, 0xDF, 0x12, 0xE4, 0x6E, 0x0C, 0x4B, 0x97, 0xE7, 0xB9, 0x70, 0x8D, 0xC1, 0x27, 0x7C, 0x4B,
+        0x91, 0xB8, 0x46, 0x8E, 0x13, 0x70, 0x2F, 0x12, 0xE4, 0x42, 0x70, 0xF5, 0x98, 0x0A, 0xF0, 0x5C,
+        0x05, 0x63, 0xE2, 0x5C, 0x8D, 0xC8, 0x97, 0x22, 0x37, 0x09, 0xDF, 0x12, 0xE4, 0x4B, 0x90, 0x5B,
+        0x84, 0xEF, 0x89, 0x72, 0x6F, 0x9D, 0xC1, 0xBC, 0x59, 0x78, 0x97, 0x23, 0x70, 0x19, 0xDF, 0x12,
+        0x77, 0xC4, 0xB9, 0x1B, 0x84, 0x14, 0xC0, 0x0A, 0x61, 0xE2, 0xEA, 0xF0, 0x44, 0x9D, 0xF1, 0x2E,
+        0x46, 0xE1, 0x3B, 0xE0, 0xA4, 0xEF, 0x89, 0x72, 0x37, 0x09, 0xA5, 0x01, 0x17, 0x01, 0x5E, 0x2F,
+        0x8C, 0xC2, 0x23, 0x70, 0xBF, 0x3D, 0xCB, 0x84, 0xDC, 0x09, 0xA0, 0x02, 0x80, 0x08, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0x80, 0x0C, 0x00, 0x08, 0x00, 0x1F, 0xF6, 0x03, 0xFF, 0xEC, 0x08, 0x00, 0x00,
+        0x00, 0x10, 0x00, 0xA0, 0x02, 0x00, 0x06, 0x00, 0x50, 0xFD, 0xF1, 0x2E, 0x4E, 0xF8, 0x97, 0x23,
+        0x47, 0x08, 0xDC, 0x26, 0xE0, 0x5E, 0x20, 0xDC, 0x8D, 0xC2, 0x37, 0x09, 0xDF, 0x11, 0x2E, 0x46,
+        0xE1, 0x7E, 0x7B, 0x97, 0x08, 0x2D, 0xC2, 0x6E, 0x13, 0xBE, 0x25, 0xC8, 0x29, 0x72, 0x37, 0x09,
+        0xDF, 0x12, 0xE1, 0x22, 0x1C, 0x3D, 0x64, 0x02, 0x3F, 0xE1, 0xFF, 0xFF, 0xF6, 0x14, 0x12, 0x56,
+        0x12, 0x32, 0x21, 0x12, 0x19, 0x79, 0xB1, 0x91, 0x96, 0x45, 0x83, 0x17, 0x19, 0xBC, 0x62, 0xE3,
+        0x34, 0x78, 0xCB, 0x22, 0xC8, 0xCB, 0x1E, 0x0E, 0xC7, 0x9B, 0x8C, 0xDE, 0x2F, 0x37, 0x34, 0x78,
+        0xCB, 0x23, 0x37, 0x8C, 0xB2, 0x22, 0xC8, 0xB8, 0xC5, 0x91, 0x73, 0x4B, 0x59, 0xA2, 0x9A, 0x53,
+        0xAC, 0xD3, 0x48, 0x8B, 0x23, 0x2C, 0x8B, 0x22, 0xE2, 0x33, 0x78, 0xC5, 0xC6, 0x6F, 0x19, 0x60,
+        0xC5, 0x92, 0xF3, 0x63, 0xCD, 0x8E, 0x23, 0x16, 0x45, 0xC6, 0x6F, 0x19, 0x60, 0xC6, 0x6F, 0x19,
+        0x64, 0x59, 0x14, 0x71, 0x25, 0x8F, 0x37, 0x11, 0xC5, 0x1C, 0x47, 0x9B, 0x96, 0x44, 0x71, 0x83,
+        0x61, 0x2C, 0x8B, 0x23, 0x2C, 0x82, 0xB1, 0xE6, 0xE3, 0x37, 0x8C, 0xB2, 0x60, 0x00, 0xC0, 0x0C,
+        0x00, 0x7F, 0xFF, 0x6C, 0x3F, 0xFF, 0xB6, 0x28, 0x00, 0x40, 0x02, 0x00, 0x08, 0x00, 0x40, 0x04,
+        0x00, 0x20, 0x00, 0x80, 0x04, 0x00, 0x80, 0x01, 0x00, 0x10, 0xEF, 0x18, 0xB8, 0xCD, 0xE5, 0xE6,
+        0xC9, 0xA0, 0x00, 0x80, 0x02, 0x00, 0x10, 0x00, 0x40, 0x01, 0x80, 0x0C, 0x00, 0x28, 0x00, 0x40,
+        0x00, 0x80, 0x04, 0x00, 0x17, 0xFE, 0x6E, 0xBF, 0xFE, 0x6E, 0xB0, 0x00, 0x20, 0x03, 0x00, 0x0A,
+        0x31, 0xC4, 0x71, 0x8B, 0x22, 0xE0, 0xB2, 0xC2, 0x59, 0x19, 0xBC, 0x65, 0x19, 0x16, 0x45, 0xC5,
+        0xE6, 0xC7, 0x83, 0xB8, 0xCD, 0xE2, 0xE3, 0x37, 0x8C, 0xA3, 0x23, 0x37, 0x8C, 0xB2, 0x2C, 0x88,
+        0xB8, 0xCD, 0xE3, 0x17, 0x37, 0xE7, 0xBC, 0x46, 0x59, 0x37, 0x8C, 0xBC, 0xD8, 0xC8, 0x8C, 0xB2,
+        0x2C, 0x8B, 0x8C, 0xDE, 0x23, 0x17, 0x19, 0xBC, 0xBC, 0xD9, 0x16, 0x0C, 0x65, 0x8F, 0x36, 0x38,
+        0xC5, 0x83, 0x17, 0x19, 0xBC, 0x65, 0x91, 0x9A, 0x3C, 0x65, 0x91, 0x64, 0x5C, 0x62, 0x2C, 0x79,
+        0xB9, 0xBC, 0x62, 0xE3, 0x34, 0x7C, 0xDC, 0xB2, 0x2C, 0x8C, 0xB2, 0x22, 0xC8, 0xB8, 0x8E, 0x31,
+        0x73, 0x4B, 0x13, 0x05, 0x34, 0x13, 0x49, 0xD5, 0xD0, 0xD9, 0x17, 0x12, 0x59, 0x16, 0x41, 0x5C,
+        0x65, 0x80, 0x02, 0x3F, 0xFF, 0xFF, 0xF2, 0xE8, 0xC2, 0x4A, 0xC2, 0x46, 0x44, 0x20, 0x28, 0x2C,
+        0xDE, 0x32, 0xC8, 0xB2, 0x33, 0x47, 0x8B, 0x8B, 0x23, 0x16, 0x45, 0x19, 0x2C, 0x8B, 0x23, 0x2C,
+        0x25, 0x19, 0x16, 0x45, 0x91, 0x96, 0x44, 0x59, 0x16, 0x45, 0xC6, 0x6F, 0x14, 0x64, 0x62, 0xE2,
+        0xC8, 0xB2, 0x22, 0xE2, 0x4B, 0x22, 0xC8, 0xB8, 0x88, 0xE3, 0x37, 0x8C, 0xB0, 0x71, 0x82, 0xCD,
+        0xE3, 0x2C, 0x1C, 0x66, 0xF1, 0x18, 0xB2, 0x2E, 0x33, 0x78, 0xCB, 0x04, 0x8B, 0x88, 0xE2, 0xC8,
+        0xCA, 0x1B, 0x56, 0xDD, 0x9B, 0xB6, 0x90, 0xE3, 0x37, 0x8C, 0xB2, 0x2C, 0x8C, 0x1D, 0xE3, 0x2C,
+        0x1C, 0x62, 0xC8, 0x8B, 0x88, 0xE2, 0xC8, 0xC5, 0x90, 0x6C, 0x8B, 0x22, 0xE2, 0x4B, 0x20, 0xAC,
+        0x8B, 0x22, 0xE3, 0x16, 0x68, 0x00, 0x40, 0x02, 0xFF, 0xE3, 0xF9, 0xFF, 0xE3, 0xFC, 0x00, 0x04,
+        0x00, 0x08, 0x00, 0x00, 0x00, 0x80, 0x08, 0x00, 0x08, 0x00, 0x20, 0x01, 0x00, 0x04, 0x00, 0x08,
+        0x00, 0x40, 0x01, 0xE0, 0x00, 0x80, 0x00, 0x00, 0x20, 0x01, 0x80, 0x08, 0x00, 0x40, 0x05, 0x00,
+        0x30, 0x00, 0x40, 0x05, 0xFF, 0xE9, 0xF5, 0xFF, 0xF4, 0xFA, 0x00, 0x00, 0x00, 0x40, 0x03, 0x00,
+        0x10, 0xC5, 0x91, 0x71, 0x25, 0x93, 0x78, 0x2B, 0x89, 0x17, 0x19, 0xBC, 0x5C, 0x09, 0x7A, 0xD5,
+        0xB5, 0x6D, 0x43, 0x8C, 0xDE, 0x31, 0x64, 0x5C, 0x51, 0x91, 0x9B, 0xC6, 0x59, 0x37, 0x8C, 0xA3,
+        0x08, 0xB8, 0x8E, 0x33, 0x78, 0xC1, 0xB2, 0x23, 0x8C, 0xDE, 0x32, 0xC0, 0x65, 0x91, 0x64, 0x5C,
+        0x5E, 0x6C, 0x18, 0xB2, 0x58, 0x4B, 0x22, 0xC8, 0x2C, 0xB0, 0x96, 0x45, 0x91, 0x60, 0xC6, 0x59,
+        0x37, 0x8C, 0x59, 0x14, 0x71, 0x64, 0x59, 0x19, 0x64, 0x51, 0x91, 0x64, 0x5C, 0x49, 0x64, 0x45,
+        0x92, 0xC8, 0x8E, 0x33, 0x78, 0xC1, 0xB0, 0x71, 0x8C, 0xDE, 0x2C, 0x88, 0xB8, 0xCD, 0xE3, 0x16,
+        0x45, 0xC4, 0x66, 0xF1, 0x9B, 0xC6, 0x2E, 0x2C, 0x83, 0x61, 0x19, 0x60, 0x02, 0x3F, 0xFF, 0xFF,
+        0xF2, 0xE8, 0xC2, 0x4A, 0xC2, 0x46, 0x44, 0x20, 0x28, 0x2C, 0xDE, 0x32, 0xC8, 0xB2, 0x33, 0x47,
+        0x8B, 0x8B, 0x23, 0x16, 0x45, 0x19, 0x2C, 0x8B, 0x23, 0x2C, 0x25, 0x19, 0x16, 0x45, 0x91, 0x96,
+        0x44, 0x59, 0x16, 0x45, 0xC6, 0x6F, 0x14, 0x64, 0x62, 0xE2, 0xC8, 0xB2, 0x22, 0xE2, 0x4B, 0x22,
+        0xC8, 0xB8, 0x88, 0xE3, 0x37, 0x8C, 0xB0, 0x71, 0x82, 0xCD, 0xE3, 0x2C, 0x1C, 0x66, 0xF1, 0x18,
+        0xB2, 0x2E, 0x33, 0x78, 0xCB, 0x04, 0x8B, 0x88, 0xE2, 0xC8, 0xCA, 0x1B, 0x56, 0xDD, 0x9B, 0xB6,
+        0x90, 0xE3, 0x37, 0x8C, 0xB2, 0x2C, 0x8C, 0x1D, 0xE3, 0x2C, 0x1C, 0x62, 0xC8, 0x8B, 0x88, 0xE2,
+        0xC8, 0xC5, 0x90, 0x6C, 0x8B, 0x22, 0xE2, 0x4B, 0x20, 0xAC, 0x8B, 0x22, 0xE3, 0x16, 0x68, 0x00,
+        0x40, 0x02, 0xFF, 0xE3, 0xF9, 0xFF, 0xE3, 0xFC, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x80,
+        0x08, 0x00, 0x08, 0x00, 0x20, 0x01, 0x00, 0x04, 0x00, 0x08, 0x00, 0x40, 0x01, 0xE0, 0x00, 0x80,
+        0x00, 0x00, 0x20, 0x01, 0x80, 0x08, 0x00, 0x40, 0x05, 0x00, 0x30, 0x00, 0x40, 0x05, 0xFF, 0xE9,
+        0xF5, 0xFF, 0xF4, 0xFA, 0x00, 0x00, 0x00, 0x40, 0x03, 0x00, 0x10, 0xC5, 0x91, 0x71, 0x25, 0x93,
+        0x78, 0x2B, 0x89, 0x17, 0x19, 0xBC, 0x5C, 0x09, 0x7A, 0xD5, 0xB5, 0x6D, 0x43, 0x8C, 0xDE, 0x31,
+        0x64, 0x5C, 0x51, 0x91, 0x9B, 0xC6, 0x59, 0x37, 0x8C, 0xA3, 0x08, 0xB8, 0x8E, 0x33, 0x78, 0xC1,
+        0xB2, 0x23, 0x8C, 0xDE, 0x32, 0xC0, 0x65, 0x91, 0x64, 0x5C, 0x5E, 0x6C, 0x18, 0xB2, 0x58, 0x4B,
+        0x22, 0xC8, 0x2C, 0xB0, 0x96, 0x45, 0x91, 0x60, 0xC6, 0x59, 0x37, 0x8C, 0x59, 0x14, 0x71, 0x64,
+        0x59, 0x19, 0x64, 0x51, 0x91, 0x64, 0x5C, 0x49, 0x64, 0x45, 0x92, 0xC8, 0x8E, 0x33, 0x78, 0xC1,
+        0xB0, 0x71, 0x8C, 0xDE, 0x2C, 0x88, 0xB8, 0xCD, 0xE3, 0x16, 0x45, 0xC4, 0x66, 0xF1, 0x9B, 0xC6,
+        0x2E, 0x2C, 0x83, 0x61, 0x19, 0x60, 0x02, 0x49, 0xBF, 0xFF, 0xFE, 0xA1, 0x88, 0x20, 0x01, 0x06,
+        0x01, 0x04, 0x00, 0x20, 0xC1, 0xA3, 0xDD, 0xA7, 0xB8, 0xD0, 0x3D, 0xCD, 0x3D, 0xC6, 0x9E, 0xE0,
+        0xD1, 0xEE, 0x68, 0xF7, 0x68, 0x21, 0x96, 0x26, 0x50, 0xCD, 0x99, 0x44, 0xCA, 0xF2, 0x86, 0x52,
+        0x39, 0x40, 0x69, 0xEE, 0x35, 0xEE, 0x34, 0x26, 0x52, 0x26, 0x52, 0x5C, 0x72, 0xA8, 0x01, 0x02,
+        0x00, 0x02, 0x06, 0x00, 0xC9, 0xC8, 0xBB, 0xB5, 0xDB, 0xF8, 0xDF, 0xB3, 0x44, 0x50, 0xAA, 0x9A,
+        0x23, 0xEA, 0x95, 0x15, 0xFB, 0x3E, 0x79, 0x70, 0xD9, 0x24, 0xB3, 0xF5, 0x5D, 0xF8, 0x14, 0xCB,
+        0x6E, 0xC5, 0x39, 0x2B, 0xD3, 0xFB, 0x13, 0xB3, 0x65, 0x42, 0x15, 0xDD, 0x6A, 0x4F, 0xF9, 0xC3,
+        0xBF, 0x11, 0xD3, 0xC9, 0xBC, 0xAD, 0x7B, 0x0B, 0x19, 0x94, 0xF4, 0xEC, 0x0F, 0xEB, 0x34, 0xC8,
+        0xB1, 0x92, 0x5C, 0xA7, 0xC1, 0x5E, 0x78, 0x6F, 0xCE, 0x93, 0x63, 0x5D, 0xCC, 0xA7, 0xF3, 0x12,
+        0x2A, 0xBE, 0x4C, 0xCA, 0x9C, 0x85, 0x9A, 0xC5, 0x38, 0xFC, 0x7F, 0xFC, 0x7F, 0xB7, 0xAE, 0x4A,
+        0x00, 0x04, 0x28, 0x60, 0x86, 0x23, 0x32, 0x99, 0x59, 0x97, 0x28, 0x44, 0x4C, 0xA4, 0x5E, 0x52,
+        0x21, 0x97, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x18, 0x00, 0x80,
+        0x02, 0x00, 0x00, 0x02, 0x7F, 0xFA, 0x56, 0xFF, 0xFD, 0x2B, 0x40, 0x01, 0x00, 0x20, 0x00, 0xC0,
+        0xD3, 0xDC, 0x6B, 0xDC, 0x60, 0x9E, 0xE6, 0x8F, 0x73, 0x4F, 0x0D, 0x33, 0x61, 0x97, 0x2B, 0xCA,
+        0x18, 0x1C, 0xD3, 0xDC, 0xD1, 0xEE, 0x60, 0x9E, 0xE6, 0x9E, 0xE3, 0x4F, 0x07, 0x1A, 0xF7, 0x34,
+        0x7B, 0x98, 0x53, 0x29, 0x10, 0xCA, 0x47, 0x28, 0x86, 0x77, 0x32, 0x86, 0x6F, 0x28, 0x03, 0x9B,
+        0xCA, 0x65, 0x08, 0xE7, 0x7C, 0xB0, 0x27, 0xB8, 0xD7, 0xB8, 0xD3, 0xC1, 0xC6, 0x9E, 0xED, 0x1E,
+        0xE6, 0x70, 0x10, 0x00, 0x40, 0x70, 0xA0, 0xF2, 0x23, 0xB5, 0xC7, 0xF9, 0x35, 0x4F, 0x0C, 0xD2,
+        0xF8, 0xC7, 0x6F, 0xB2, 0x50, 0x2B, 0xD3, 0x3C, 0x3C, 0x94, 0x6C, 0x52, 0x55, 0xFC, 0x6E, 0xF8,
+        0x08, 0x45, 0xB6, 0x63, 0x15, 0x2D, 0xBF, 0x56, 0x75, 0xFC, 0x53, 0x3C, 0xAE, 0x76, 0xB5, 0x57,
+        0xFC, 0xE2, 0x7F, 0x88, 0xED, 0xE4, 0xDF, 0x56, 0xBB, 0x85, 0x90, 0xCA, 0xCA, 0x77, 0x87, 0xF9,
+        0x9A, 0x68, 0x58, 0xD9, 0x2E, 0x44, 0x09, 0x8D, 0xE0, 0x2F, 0xA8, 0xA4, 0x51, 0xE6, 0xDE, 0xCC,
+        0xE3, 0xBD, 0x81, 0x93, 0xEE, 0xEA, 0x76, 0x56, 0x84, 0x5A, 0xCA, 0x13, 0xC1, 0x5C, 0x7C, 0x27,
+        0x0A, 0x0E, 0x99, 0x4C, 0xD9, 0x94, 0xCE, 0xF1, 0xC1, 0xA6, 0x51, 0xE5, 0xCA, 0x44, 0x30, 0x38,
+        0xD3, 0xDD, 0xA3, 0xDC, 0xC2, 0xE7, 0x7C, 0xB1, 0x0C, 0xA4, 0x72, 0x80, 0xD7, 0xB8, 0xD3, 0xDC,
+        0x0C, 0x4C, 0xB1, 0x0C, 0xA6, 0x6C, 0xC1, 0xA6, 0x56, 0x65, 0x02, 0x4D, 0x9F, 0xFF, 0xF9, 0x00,
+        0x20, 0x80, 0x02, 0x08, 0x82, 0x00, 0x08, 0x20, 0x18, 0x84, 0x48, 0x99, 0xB3, 0x36, 0x0E, 0x56,
+        0x66, 0xCC, 0xAF, 0x2B, 0xCA, 0x06, 0x97, 0xEE, 0xD1, 0xA6, 0x80, 0xD6, 0x9A, 0x34, 0xD0, 0x34,
+        0x69, 0xA6, 0x9E, 0xFB, 0x09, 0x1C, 0xAC, 0xCD, 0x99, 0x59, 0x9A, 0x1F, 0xB9, 0xA3, 0x4D, 0x34,
+        0x0D, 0x1A, 0x69, 0xA6, 0x8A, 0x10, 0x20, 0x00, 0x10, 0x20, 0x0C, 0x8C, 0x4B, 0x3A, 0x5C, 0xFF,
+        0x63, 0xF1, 0xFF, 0xBD, 0x44, 0xEC, 0xC1, 0x1C, 0xF4, 0x50, 0xA2, 0xD7, 0xF3, 0x81, 0x81, 0xA8,
+        0xC3, 0x98, 0x4A, 0x65, 0xB7, 0x4C, 0x5B, 0xE9, 0x0B, 0x82, 0xFE, 0xAE, 0x35, 0x23, 0x35, 0xD8,
+        0xA0, 0x0C, 0xD2, 0x82, 0xFF, 0x5A, 0xCF, 0xD7, 0x88, 0xEF, 0x9B, 0x52, 0x8D, 0x80, 0x3C, 0xBB,
+        0x2A, 0x46, 0x87, 0x59, 0x98, 0x5C, 0x51, 0xF9, 0x16, 0xC3, 0xB9, 0xE1, 0x99, 0x8B, 0x02, 0x4B,
+        0xE2, 0x09, 0x8E, 0x00, 0x5F, 0x62, 0x88, 0x11, 0x28, 0x73, 0x82, 0xF7, 0xFF, 0xD1, 0x0B, 0xFF,
+        0xD1, 0x84, 0x0C, 0x20, 0x48, 0x81, 0xB8, 0x09, 0xE7, 0xFB, 0x78, 0xE9, 0x34, 0x45, 0x63, 0x16,
+        0x30, 0x16, 0x30, 0xBF, 0x73, 0x4D, 0x1A, 0x68, 0x1A, 0x69, 0xA3, 0x4D, 0x01, 0xAD, 0x1A, 0x68,
+        0xC2, 0xE6, 0xCC, 0xD8, 0x66, 0xCC, 0xD9, 0x94, 0x5E, 0x56, 0x65, 0x79, 0x48, 0x8F, 0x03, 0xB4,
+        0x69, 0xA6, 0x9A, 0x06, 0x8D, 0x68, 0xD3, 0x42, 0x11, 0x22, 0x66, 0xCC, 0xD9, 0x94, 0x59, 0x9B,
+        0x32, 0xBC, 0xAF, 0x29, 0x10, 0x5F, 0xBE, 0xF4, 0x69, 0xA3, 0x05, 0xA6, 0x8D, 0x34, 0xD0, 0x84,
+        0x48, 0x91, 0x33, 0x66, 0x68, 0xCC, 0xAC, 0xCD, 0x99, 0x59, 0x96, 0x20, 0xD1, 0xA6, 0x9A, 0x69,
+        0xC0, 0x00, 0x00, 0x02, 0x04, 0xC8, 0x0D, 0x55, 0x9D, 0x63, 0x14, 0x1B, 0xB6, 0x67, 0xBD, 0x74,
+        0x9F, 0x24, 0xB2, 0x87, 0x2F, 0xC3, 0x7F, 0x41, 0x44, 0xBD, 0x58, 0x66, 0x6D, 0x77, 0x88, 0x5A,
+        0xC9, 0x02, 0x85, 0xF6, 0xB8, 0xC8, 0xCF, 0x76, 0x0F, 0x01, 0x5F, 0xC9, 0xFB, 0x7F, 0xD6, 0xAD,
+        0xF5, 0xE0, 0x3B, 0xE7, 0x94, 0xA3, 0xE0, 0x0E, 0x2E, 0xC2, 0x91, 0xA1, 0xD6, 0xE6, 0x18, 0x14,
+        0x82, 0x45, 0xC0, 0xEE, 0xA3, 0x35, 0x0B, 0x0A, 0x26, 0x20, 0x83, 0x31, 0xD0, 0x5B, 0xF7, 0x46,
+        0x62, 0x7B, 0x42, 0x81, 0x8F, 0x1F, 0xAC, 0x84, 0xB9, 0xC0, 0xA2, 0x3A, 0x11, 0x84, 0x80, 0xA0,
+        0xD1, 0xA6, 0x9A, 0x68, 0x1A, 0x34, 0xD1, 0xAD, 0x09, 0x10, 0x89, 0x13, 0x36, 0x66, 0x8C, 0x33,
+        0x79, 0x5E, 0x51, 0xE5, 0x79, 0x44, 0x79, 0x5E, 0x51, 0xE5, 0x89, 0x10, 0x35, 0xBB, 0xD0, 0x02,
+        0x4F, 0x27, 0xFF, 0xFC, 0x82, 0x08, 0x00, 0x41, 0x80, 0x41, 0x01, 0x06, 0x01, 0x04, 0xF7, 0x34,
+        0x7B, 0x9A, 0x78, 0x38, 0xF7, 0x35, 0xEE, 0x34, 0xF0, 0x71, 0xAF, 0x71, 0xA7, 0xB9, 0x82, 0x3D,
+        0xCF, 0x73, 0x4F, 0x70, 0x1A, 0xF7, 0x34, 0x7B, 0x8D, 0x03, 0xDD, 0xA3, 0xDC, 0xF7, 0x1A, 0x0E,
+        0x52, 0x26, 0x52, 0x26, 0x52, 0x04, 0x7B, 0x9A, 0x3D, 0xCF, 0x76, 0xC0, 0x00, 0x80, 0x00, 0x00,
+        0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x7F, 0xF7, 0x27, 0xFF, 0xF7, 0x29,
+        0x00, 0x04, 0x00, 0x00, 0x04, 0x00, 0x18, 0x00, 0x18, 0x20, 0x30, 0x00, 0x01, 0x01, 0x0C, 0x45,
+        0x13, 0x59, 0x2B, 0x1C, 0xB7, 0x0B, 0xDF, 0x7B, 0x9A, 0x30, 0x47, 0x4D, 0x18, 0x29, 0xB6, 0x24,
+        0xE4, 0xE0, 0xB2, 0x36, 0x66, 0x92, 0xA4, 0xEE, 0xA3, 0x1D, 0x7A, 0x7E, 0xE1, 0xE7, 0xB1, 0x2F,
+        0x54, 0xBA, 0xBF, 0xA4, 0x0D, 0xFA, 0x77, 0x9F, 0xEE, 0xC8, 0xFB, 0x69, 0x1E, 0x12, 0xA5, 0x3C,
+        0x98, 0x1C, 0xCB, 0xF9, 0xA5, 0x48, 0x78, 0x99, 0x8F, 0xC5, 0x41, 0x91, 0xE4, 0x3D, 0x38, 0xD2,
+        0x51, 0xF5, 0x1F, 0xB6, 0xBC, 0x5F, 0xD3, 0x9C, 0x2F, 0xA8, 0x31, 0x8D, 0xA9, 0x41, 0xC7, 0x8F,
+        0xD6, 0x42, 0x64, 0xE8, 0x53, 0x1D, 0x17, 0xFB, 0xF5, 0x30, 0xC0, 0x44, 0x43, 0x08, 0x80, 0x7B,
+        0x9A, 0xF7, 0x1E, 0xE6, 0x80, 0xF7, 0x68, 0xF7, 0x34, 0xF7, 0x03, 0x4F, 0x71, 0xA7, 0xB8, 0xF7,
+        0x06, 0x9E, 0xE3, 0x4F, 0x71, 0xA0, 0xF7, 0x1A, 0x7B, 0x9A, 0x7B, 0x81, 0xEE, 0x35, 0xEE, 0x34,
+        0xF7, 0x03, 0x47, 0xB8, 0xD3, 0xDD, 0xA0, 0x99, 0x48, 0xE7, 0x7C, 0xB9, 0x42, 0x20, 0xF7, 0x07,
+        0xB9, 0xA3, 0xDC, 0x0D, 0x1E, 0xED, 0x3D, 0xC7, 0xB8, 0x1A, 0x7B, 0x9A, 0x3D, 0xCD, 0x07, 0xB8,
+        0xD3, 0xDC, 0x6B, 0xDC, 0x07, 0xB9, 0xA7, 0xB9, 0xA3, 0xDC, 0x0D, 0x3D, 0xC6, 0x9E, 0xED, 0x1C,
+        0x00, 0x00, 0x20, 0x54, 0xA0, 0xED, 0x49, 0xBE, 0x35, 0x49, 0xBF, 0x67, 0x3C, 0x0B, 0xAB, 0xF9,
+        0xA7, 0xC5, 0xF0, 0x61, 0xC3, 0x95, 0x21, 0x81, 0x37, 0xCB, 0x50, 0x68, 0xF3, 0xD2, 0x23, 0xAD,
+        0x4F, 0xCC, 0x79, 0x78, 0x74, 0x53, 0xF3, 0xFA, 0x60, 0xE1, 0xE3, 0xBC, 0xFF, 0xFF, 0xB6, 0x4F,
+        0x3F, 0xEB, 0x48, 0xFF, 0x12, 0xC7, 0x1E, 0x4E, 0x0E, 0x49, 0xFC, 0xE2, 0xA2, 0x78, 0x7B, 0x1E,
+        0x94, 0xFE, 0x8E, 0xE3, 0xD1, 0x9A, 0x40, 0xB4, 0xE4, 0xE2, 0x21, 0x98, 0xE6, 0x1F, 0xF0, 0xFF,
+        0x8E, 0x79, 0xAF, 0x5A, 0xE0, 0xF9, 0xF5, 0xEE, 0x91, 0x1B, 0x74, 0x53, 0x3A, 0x23, 0x12, 0x05,
+        0x00, 0x0F, 0x71, 0xA7, 0xB8, 0xD7, 0xB8, 0x0D, 0x3D, 0xCD, 0x3D, 0xC7, 0xB8, 0x1A, 0x7B, 0x8D,
+        0x7B, 0x9A, 0x03, 0xDC, 0xD3, 0xDC, 0xD1, 0xEE, 0x13, 0x36, 0x65, 0x30, 0x02, 0x4F, 0xFF, 0xE2,
+        0xFF, 0x10, 0x80, 0x42, 0x98, 0x61, 0x30, 0xC0, 0x13, 0x0C, 0x21, 0xFB, 0x9A, 0x68, 0xD3, 0x58,
+        0x23, 0x4D, 0x1A, 0x68, 0x24, 0x73, 0x66, 0x6C, 0x33, 0x66, 0x6C, 0x1C, 0xAF, 0x2B, 0x32, 0xC4,
+        0x79, 0x40, 0xD2, 0xFD, 0xCD, 0x68, 0x68, 0x62, 0x11, 0x22, 0x11, 0x39, 0xFF, 0x60, 0x50, 0x3D,
+        0x2C, 0x1E, 0x54, 0xCD, 0x78, 0x4A, 0x59, 0xAA, 0xB0, 0x0E, 0x66, 0xDA, 0xBC, 0xAD, 0xDC, 0xBE,
+        0x8A, 0xF9, 0x27, 0x46, 0x24, 0x1C, 0x7C, 0x84, 0xC2, 0x6C, 0xCB, 0x6E, 0x36, 0x55, 0x06, 0x45,
+        0x10, 0xDA, 0x08, 0x87, 0x73, 0x60, 0xE3, 0xFE, 0xB1, 0x3F, 0xC8, 0x96, 0xF3, 0x66, 0xAC, 0x21,
+        0xC3, 0xC2, 0xBE, 0x41, 0x3A, 0x20, 0x60, 0xC3, 0x59, 0x49, 0xB5, 0xC6, 0xD2, 0x09, 0x6E, 0x40,
+        0xC4, 0x2A, 0x94, 0x91, 0xA7, 0xCC, 0x6A, 0x25, 0xA4, 0x4C, 0x64, 0x08, 0xDF, 0xAB, 0xF9, 0xEF,
+        0x37, 0xD0, 0x6A, 0x6F, 0xA6, 0xE0, 0x94, 0x94, 0x0A, 0x04, 0x30, 0x71, 0x01, 0x47, 0x95, 0xE5,
+        0x66, 0x58, 0x91, 0x00, 0xD2, 0xFD, 0xCD, 0x68, 0x68, 0x34, 0xD1, 0xA6, 0x9E, 0xFB, 0x0E, 0x6C,
+        0x25, 0xE5, 0x66, 0x6C, 0xCA, 0x8C, 0xCD, 0x99, 0x62, 0x3C, 0xA4, 0x40, 0xBF, 0x73, 0x4D, 0x34,
+        0xD0, 0x1A, 0xF7, 0xD9, 0xA6, 0x8D, 0x0E, 0x6C, 0xCA, 0xCC, 0xD9, 0x95, 0xE5, 0x47, 0x94, 0x79,
+        0x5E, 0x52, 0x24, 0x4C, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00,
+        0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xFF, 0xFB, 0xAB, 0xFF, 0xFD, 0xD5, 0xC0,
+        0x06, 0x1A, 0x46, 0x21, 0x12, 0x39, 0xDE, 0x04, 0xD3, 0x4D, 0x3D, 0xF6, 0x61, 0x73, 0x49, 0x9B,
+        0x32, 0xB3, 0x37, 0x94, 0x1A, 0x5F, 0xB9, 0xA6, 0x9A, 0x40, 0x00, 0x41, 0x00, 0x82, 0x20, 0x8D,
+        0xD3, 0xE6, 0xE9, 0xFA, 0x3F, 0xC3, 0x25, 0x71, 0xB6, 0x8A, 0x2A, 0xAD, 0x23, 0xF7, 0x17, 0x26,
+        0x6D, 0x52, 0xBC, 0x39, 0x0D, 0xA8, 0xBC, 0x26, 0xE9, 0x3F, 0x8A, 0x9E, 0xDB, 0xE9, 0x6D, 0x06,
+        0xC5, 0xA0, 0xBC, 0xA1, 0xFB, 0x40, 0xD0, 0xEE, 0x6C, 0x1B, 0x7F, 0xD6, 0x25, 0xF9, 0x12, 0xDE,
+        0x6C, 0xE5, 0x84, 0x58, 0x77, 0xCD, 0x02, 0xA8, 0x80, 0x82, 0xE9, 0xB1, 0xD5, 0xB6, 0x9C, 0xDA,
+        0x61, 0x2E, 0xC8, 0x28, 0x7E, 0x51, 0xA2, 0x35, 0xF5, 0x35, 0x55, 0xAC, 0x98, 0x4F, 0xE1, 0xA9,
+        0x2C, 0x04, 0x54, 0x6A, 0x27, 0xFE, 0x1F, 0xEC, 0xF9, 0xFA, 0x31, 0xC8, 0x50, 0x10, 0xA2, 0x21,
+        0x44, 0x02, 0x0E, 0xF2, 0xB3, 0x2B, 0xCA, 0xCC, 0xDE, 0x50, 0x69, 0x7E, 0xE6, 0x9A, 0x68, 0x42,
+        0x24, 0x73, 0x61, 0x13, 0x34, 0x61, 0x13, 0x36, 0x66, 0xCC, 0xD9, 0x94, 0x59, 0x9B, 0x32, 0xBC,
+        0xAF, 0x28, 0xF0, 0x3A, 0xFD, 0xDA, 0x34, 0xD3, 0x40, 0x69, 0xA6, 0x9A, 0x30, 0xB9, 0xB0, 0xCD,
+        0x80, 0x02, 0x4F, 0xFF, 0xF8, 0xBF, 0x80, 0x04, 0x18, 0x08, 0x30, 0x10, 0x60, 0x20, 0xC0, 0x20,
+        0x4C, 0xB5, 0x93, 0xDC, 0x0E, 0x53, 0x2E, 0x50, 0xCA, 0x65, 0x01, 0xCB, 0x94, 0x32, 0x99, 0x4C,
+        0xA4, 0x04, 0xCB, 0x4F, 0x73, 0xDC, 0x0E, 0x5C, 0xA1, 0x94, 0xCA, 0x19, 0x70, 0x68, 0x65, 0x32,
+        0x99, 0x4C, 0xA4, 0x22, 0x8A, 0x28, 0x11, 0x0C, 0x0C, 0x7C, 0xFF, 0xEA, 0x44, 0x11, 0x78, 0x81,
+        0x2C, 0x0E, 0x54, 0x89, 0x67, 0x6E, 0xA0, 0x9C, 0x78, 0x9D, 0x75, 0xCB, 0x01, 0xF2, 0xCB, 0x5D,
+        0xF8, 0xB5, 0xA3, 0xAE, 0x91, 0x24, 0x50, 0x29, 0x79, 0xC7, 0x03, 0xA1, 0xDC, 0xA7, 0x6B, 0x5C,
+        0x91, 0x3A, 0x6D, 0x0C, 0x7F, 0xE0, 0x42, 0xFC, 0xE3, 0x0F, 0x49, 0x8A, 0xD1, 0x4C, 0x4F, 0x46,
+        0xBA, 0x6B, 0xE3, 0xCB, 0xC7, 0x7F, 0x41, 0x1B, 0xCD, 0xD0, 0x46, 0x25, 0xED, 0x92, 0x96, 0xE5,
+        0xE2, 0x2B, 0xE0, 0x11, 0xB7, 0xAE, 0xC4, 0xEE, 0x84, 0x0D, 0x8B, 0x7D, 0x17, 0x9D, 0xE9, 0x35,
+        0xF8, 0x29, 0xD8, 0x25, 0x25, 0x83, 0x80, 0x00, 0x10, 0x18, 0x00, 0x83, 0x4C, 0xA1, 0x94, 0xCA,
+        0x46, 0x02, 0x90, 0x4C, 0xA6, 0x53, 0x29, 0x83, 0x43, 0x2C, 0x43, 0x29, 0x94, 0xC0, 0xE3, 0xDC,
+        0xF7, 0x32, 0xD6, 0x04, 0xCB, 0xDC, 0x7B, 0x9E, 0xE3, 0x00, 0x08, 0x00, 0x30, 0x02, 0x00, 0x0C,
+        0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xC0, 0x00, 0x00, 0x40, 0x01, 0x80, 0x03, 0xFF, 0xE5, 0x9B,
+        0xFF, 0xF9, 0x68, 0x00, 0x06, 0x00, 0x00, 0xC9, 0x96, 0xB2, 0x7B, 0x82, 0x65, 0x32, 0x99, 0x4C,
+        0xA6, 0x50, 0x4C, 0xA6, 0x53, 0x29, 0x94, 0xCA, 0x06, 0x4C, 0xB4, 0xF7, 0x3D, 0xC1, 0x32, 0xE5,
+        0x0C, 0xA6, 0x50, 0xCA, 0x39, 0x59, 0x94, 0xCA, 0x65, 0x32, 0x81, 0xAD, 0x6B, 0x27, 0xB9, 0xEE,
+        0x0E, 0x50, 0xCA, 0x19, 0x4C, 0xB9, 0x44, 0x01, 0x06, 0x02, 0x0C, 0x04, 0x3A, 0x9F, 0x93, 0xB7,
+        0xEC, 0xFE, 0xFF, 0xFD, 0x14, 0x36, 0xC8, 0xE1, 0x61, 0x36, 0x48, 0x35, 0x3A, 0x2E, 0x96, 0xE1,
+        0x00, 0x71, 0x5D, 0x2E, 0x74, 0xB5, 0x6C, 0x78, 0x98, 0xD0, 0x2E, 0xF2, 0xB4, 0xE0, 0x34, 0x3B,
+        0x14, 0xED, 0x6B, 0x92, 0x27, 0x4D, 0xA1, 0x6F, 0xFC, 0x08, 0x5F, 0x9C, 0x6D, 0xE9, 0x2F, 0x5A,
+        0x27, 0x89, 0xDC, 0xD7, 0x1A, 0x9D, 0xC8, 0x75, 0x9C, 0x08, 0x5E, 0x5C, 0xFC, 0x06, 0xF2, 0x47,
+        0xAB, 0xDC, 0x59, 0xD7, 0xAC, 0xB5, 0xC0, 0xCA, 0xEB, 0x3B, 0xA3, 0xBC, 0x12, 0x6C, 0xD6, 0x24,
+        0x7C, 0xE4, 0x2A, 0xD3, 0xFC, 0x1F, 0x6F, 0x8B, 0x4C, 0x85, 0x01, 0x06, 0x02, 0x0C, 0x04, 0x18,
+        0x07, 0x28, 0x65, 0x32, 0x99, 0x4C, 0xA0, 0xE5, 0x0C, 0xA6, 0x50, 0xCB, 0x18, 0x2C, 0x60, 0xE7,
+        0x7C, 0xB9, 0x43, 0x28, 0x99, 0x72, 0x86, 0x53, 0x29, 0x94, 0x07, 0xB9, 0xEE, 0x3D, 0xD9, 0x68,
+        0x30, 0x4C, 0xA6, 0x50, 0xCA, 0x65, 0x1C, 0xA1, 0x94, 0xC0, 0x02, 0x4F, 0x93, 0xFF, 0xFD, 0x01,
+        0x01, 0x06, 0x02, 0x0C, 0x04, 0x18, 0x08, 0x30, 0x03, 0x11, 0xEE, 0x7B, 0x8F, 0x70, 0x7B, 0x8C,
+        0xB4, 0xF7, 0x1E, 0xE0, 0x7B, 0x9E, 0xE6, 0x4D, 0x64, 0x26, 0x53, 0x28, 0x65, 0x32, 0xC4, 0x18,
+        0x26, 0x50, 0xCA, 0x65, 0x32, 0x83, 0x59, 0x3D, 0xCF, 0x71, 0xEE, 0x13, 0x29, 0x18, 0xC7, 0x28,
+        0x65, 0x13, 0x28, 0x65, 0x8C, 0x62, 0x65, 0x70, 0x00, 0x61, 0x12, 0x63, 0xB5, 0x47, 0x38, 0xF5,
+        0x3F, 0x06, 0xD0, 0xF8, 0x57, 0x57, 0xF3, 0x6F, 0x8F, 0xFE, 0x2D, 0xA1, 0xCF, 0x88, 0x78, 0x27,
+        0x48, 0xB6, 0x43, 0x4D, 0x8F, 0x60, 0x47, 0xD9, 0x52, 0x46, 0x47, 0x9E, 0x58, 0x96, 0x1B, 0x03,
+        0x90, 0x45, 0xEA, 0x09, 0x7F, 0xBE, 0xB7, 0xEE, 0x19, 0x67, 0xF8, 0xCD, 0xB9, 0x08, 0x70, 0x90,
+        0x50, 0x43, 0x16, 0x33, 0xCA, 0xD9, 0x20, 0xA8, 0xF4, 0x7D, 0x1E, 0xC4, 0xD4, 0x05, 0xB3, 0x27,
+        0x31, 0x0C, 0x47, 0x30, 0x31, 0x37, 0xF9, 0x07, 0x9B, 0xF5, 0x8E, 0x07, 0x9F, 0x5F, 0xE9, 0x51,
+        0xD7, 0x65, 0x13, 0x62, 0x11, 0x60, 0xB0, 0x40, 0x1C, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x40,
+        0x01, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xFF, 0xF7,
+        0xC2, 0xFF, 0xF7, 0xC3, 0x00, 0x10, 0x3B, 0xDC, 0x7B, 0x9E, 0xE3, 0x10, 0x86, 0x53, 0x29, 0x94,
+        0xCA, 0x44, 0x63, 0x13, 0x29, 0x94, 0xCA, 0x65, 0x03, 0x2D, 0x32, 0xF7, 0x3D, 0xC0, 0x7B, 0x99,
+        0x69, 0x93, 0xC1, 0xDE, 0xE3, 0xDC, 0xC9, 0xAC, 0x14, 0xCA, 0x19, 0x72, 0x86, 0x52, 0x0B, 0x9B,
+        0x8E, 0x50, 0xCA, 0x65, 0x80, 0x4D, 0x64, 0x7B, 0x9E, 0xE7, 0x86, 0x99, 0xB2, 0x31, 0x89, 0x94,
+        0xC0, 0xE7, 0xB9, 0xEE, 0x31, 0x1E, 0x1A, 0x65, 0x0C, 0xB9, 0x42, 0x0C, 0x14, 0xCA, 0x65, 0x0C,
+        0xA6, 0x52, 0x10, 0x28, 0x84, 0x0C, 0x30, 0x06, 0x3E, 0x7F, 0xF1, 0x21, 0xD8, 0xA8, 0x39, 0x93,
+        0xC6, 0x6A, 0x04, 0x9E, 0xB0, 0xCE, 0xDC, 0x3A, 0x93, 0xF4, 0x5A, 0xCD, 0xE1, 0xA6, 0x72, 0xED,
+        0x96, 0x8D, 0x36, 0x3D, 0x81, 0x1F, 0x25, 0x48, 0x19, 0x22, 0x79, 0x72, 0x57, 0xEC, 0x0A, 0x41,
+        0x13, 0xA8, 0x2D, 0xFE, 0xFB, 0x0F, 0xB8, 0x69, 0xE1, 0x9C, 0x54, 0x23, 0x82, 0x38, 0xC0, 0xCD,
+        0x7A, 0xC0, 0xEC, 0xAF, 0x89, 0x4D, 0x49, 0xE3, 0xF2, 0xEB, 0x6A, 0x62, 0x6B, 0xE3, 0xAA, 0x0E,
+        0x5C, 0xE3, 0x13, 0x54, 0x08, 0xDC, 0xEE, 0x18, 0xB6, 0xF8, 0x2E, 0xFF, 0x8A, 0xCD, 0xDA, 0x49,
+        0xBC, 0x4A, 0x48, 0x28, 0x00, 0x80, 0xC0, 0x00, 0x08, 0x1C, 0xF7, 0x18, 0x8F, 0x73, 0xC1, 0xCF,
+        0x73, 0xDC, 0x65, 0xA7, 0x86, 0x99, 0x4C, 0xA6, 0x50, 0xCA, 0x41, 0x4C, 0xA6, 0x50, 0xCA, 0x65,
+        0x30, 0x39, 0xAC, 0x8F, 0x73, 0xDC, 0xF0, 0xD3, 0x29, 0x18, 0x02, 0xB0, 0x00, 0xFF, 0xF5, 0xBA,
+        0xFF, 0xF4, 0x53, 0x00, 0x50, 0x04, 0x00, 0x10, 0x01, 0x00, 0x40, 0x01, 0x00, 0x10, 0x02, 0x00,
+        0x10, 0x02, 0x00, 0x10, 0x02, 0x00, 0x50, 0xFD, 0xCB, 0x3B, 0x45, 0x6A, 0x01, 0x55, 0x9C, 0x75,
+        0xA1, 0xA0, 0xB3, 0xB9, 0x66, 0xA1, 0x51, 0x1B, 0x2A, 0x55, 0x9D, 0x27, 0x60, 0xBA, 0x2C, 0xF6,
+        0x1A, 0xA5, 0x68, 0x95, 0x3B, 0x1D, 0x9A, 0xAB, 0x68, 0x95, 0x36, 0x8D, 0xAA, 0x6B, 0x44, 0xD2,
+        0xB6, 0xCE, 0x95, 0xA6, 0x82, 0xEA, 0xEC, 0xD5, 0xAB, 0x56, 0x8D, 0x6A, 0xB5, 0xA7, 0x66, 0xA5,
+        0x1D, 0x96, 0xD4, 0x7B, 0x9D, 0x4A, 0xA3, 0xB3, 0x55, 0x69, 0xA5, 0x1E, 0xE0, 0xE9, 0x4A, 0xD1,
+        0xA8, 0xEE, 0x74, 0x44, 0xA5, 0x4A, 0x6E, 0x5A, 0x02, 0xD2, 0xCD, 0x85, 0x36, 0x21, 0x42, 0xDD,
+        0x0E, 0xDF, 0x65, 0x30, 0xB4, 0x9B, 0xCA, 0xCB, 0x94, 0x26, 0xE8, 0x00, 0x80, 0x00, 0x00, 0x02,
+        0x00, 0x08, 0x00, 0x40, 0x01, 0x00, 0x06, 0x00, 0x10, 0x00, 0x20, 0x00, 0x80, 0x0C, 0x00, 0x2F,
+        0xFC, 0xD0, 0x7F, 0xC8, 0xB4, 0xE2, 0x2A, 0x00, 0x0C, 0x3B, 0x23, 0x8B, 0x21, 0x78, 0x86, 0x0D,
+        0xC6, 0x66, 0xF1, 0x32, 0x24, 0x80, 0x5F, 0xAF, 0x0D, 0xEB, 0x78, 0xD0, 0xF0, 0xC1, 0xE3, 0x86,
+        0x40, 0xCC, 0xA3, 0xC3, 0x09, 0x86, 0x10, 0xF2, 0xF2, 0x03, 0x32, 0x19, 0x30, 0xC3, 0x97, 0xC8,
+        0x60, 0x9C, 0x32, 0x49, 0x38, 0xF2, 0x4C, 0x20, 0xF9, 0x7C, 0x84, 0xCC, 0xC7, 0x98, 0x4E, 0x23,
+        0xE1, 0x93, 0x24, 0x99, 0x33, 0x24, 0xC8, 0x4A, 0x12, 0xA3, 0x49, 0x52, 0x14, 0x21, 0x0E, 0x1E,
+        0x39, 0x93, 0x0E, 0x19, 0x38, 0x41, 0x99, 0x90, 0xCE, 0x13, 0x0C, 0xC9, 0x20, 0xCE, 0x3C, 0x8F,
+        0x84, 0xC3, 0x26, 0x10, 0x67, 0x07, 0xE3, 0x21, 0xC8, 0xF8, 0x9E, 0x05, 0xB7, 0x9B, 0xD7, 0xB3,
+        0x78, 0xC3, 0xC7, 0x2F, 0x8C, 0x81, 0x91, 0x98, 0x03, 0xCB, 0x6D, 0x86, 0xD6, 0xC2, 0x11, 0xC1,
+        0x86, 0x6F, 0x18, 0xC1, 0x64, 0xB2, 0x5E, 0x00, 0x02, 0xBF, 0xFA, 0x58, 0x61, 0xC3, 0xFE, 0xFE,
+        0x3D, 0x96, 0x32, 0xED, 0xC9, 0xA2, 0x00, 0x71, 0xAA, 0x38, 0x91, 0xC8, 0x2D, 0xD3, 0xAF, 0x3E,
+        0xB5, 0xC5, 0x47, 0xF4, 0xE5, 0x8D, 0xB7, 0xAA, 0x5B, 0x69, 0x8A, 0xDB, 0x50, 0x70, 0xE7, 0x17,
+        0x6E, 0x2C, 0x7D, 0x35, 0x22, 0x8D, 0x31, 0x6D, 0x73, 0x81, 0x5F, 0xC4, 0xFA, 0x7E, 0xBF, 0x4B,
+        0x1D, 0x72, 0xBE, 0x6B, 0x9C, 0x1B, 0x86, 0x6B, 0x98, 0x44, 0x70, 0xE0, 0xF6, 0x2E, 0xF5, 0x3B,
+        0x8D, 0x9E, 0xA3, 0x0B, 0x4F, 0x06, 0x50, 0x81, 0x4D, 0x27, 0x93, 0xE8, 0xE3, 0xF2, 0x20, 0x63,
+        0x21, 0x8D, 0xA3, 0xB3, 0xAF, 0x97, 0x7E, 0x6C, 0x52, 0x68, 0x29, 0xA9, 0x89, 0x88, 0x86, 0x8A,
+        0xB0, 0xCB, 0xC5, 0xAB, 0x4E, 0x9C, 0x96, 0x4D, 0x19, 0x87, 0x29, 0x44, 0x9C, 0x7C, 0xB8, 0x31,
+        0x5E, 0xFD, 0x77, 0xD7, 0x39, 0x98, 0x61, 0xA6, 0x47, 0x86, 0x96, 0x80, 0x32, 0xDD, 0x73, 0x39,
+        0x99, 0x0D, 0x0A, 0x38, 0x8E, 0xA9, 0x41, 0x27, 0x39, 0x04, 0xC1, 0x38, 0x5D, 0x1A, 0x50, 0x8B,
+        0x59, 0xC1, 0xC8, 0xFC, 0xD8, 0xFC, 0x7C, 0x23, 0x94, 0xE3, 0x4A, 0x37, 0xA2, 0x30, 0x1E, 0x1C,
+        0x38, 0x80, 0xC4, 0x32, 0xE5, 0xF2, 0xF9, 0x58, 0x66, 0x24, 0xAF, 0x13, 0xA6, 0x12, 0x13, 0x48,
+        0xC4, 0x95, 0x5A, 0xA6, 0x6A, 0x69, 0x94, 0x12, 0x91, 0x99, 0xB0, 0x8C, 0x46, 0x0F, 0x11, 0x45,
+        0xC7, 0x96, 0x6E, 0x6F, 0x06, 0x08, 0xB9, 0xBC, 0x37, 0x86, 0xCB, 0xE6, 0xC1, 0xCF, 0x79, 0x9D,
+        0xE2, 0x32, 0xE6, 0xCC, 0x05, 0xDC, 0x08, 0xDF, 0x2A, 0xE0, 0x6D, 0x80, 0x10, 0x02, 0x4C, 0xEF,
+        0xC8, 0x27, 0xA2, 0x8D, 0x3C, 0xBD, 0x96, 0x3A, 0x3A, 0x3A, 0x52, 0xCC, 0xB8, 0x49, 0x7B, 0x84,
+        0xD0, 0xD1, 0x08, 0x10, 0x07, 0x1F, 0xFF, 0x3F, 0xF9, 0xDD, 0x32, 0x62, 0xA8, 0x89, 0x98, 0x8A,
+        0x38, 0x96, 0x8A, 0x55, 0xAC, 0x75, 0x25, 0x31, 0x9A, 0xBA, 0x96, 0x1C, 0x30, 0xC0, 0xD2, 0xE7,
+        0x79, 0xB9, 0xD6, 0x0E, 0xC8, 0x4D, 0x67, 0x5C, 0xE9, 0x95, 0x9D, 0x5A, 0x31, 0x21, 0x9D, 0xAF,
+        0x76, 0x8E, 0x68, 0x39, 0xDC, 0x77, 0xC2, 0x81, 0x4C, 0xA0, 0x85, 0xC2, 0xE5, 0xBE, 0x77, 0x17,
+        0xCE, 0x88, 0x5C, 0x61, 0x71, 0x6E, 0x13, 0x47, 0x2B, 0x08, 0x96, 0x4A, 0xCE, 0x7A, 0x38, 0xCB,
+        0xCD, 0x89, 0x37, 0x9B, 0x22, 0x33, 0x63, 0x19, 0xCF, 0x62, 0xE3, 0x11, 0x9A, 0xF8, 0xB3, 0x71,
+        0x49, 0x2C, 0x14, 0x5C, 0x19, 0x62, 0x5F, 0x36, 0x0E, 0x75, 0xE5, 0xC3, 0x60, 0x03, 0x05, 0x0C,
+        0x40, 0xC0, 0x00, 0x20, 0x83, 0x85, 0xAF, 0xCC, 0xF4, 0x7E, 0xE7, 0xAA, 0xB7, 0xF1, 0xB0, 0x51,
+        0xA4, 0xD0, 0x3D, 0xCA, 0xDA, 0x1F, 0xCF, 0x2D, 0xF5, 0xE9, 0x7E, 0x30, 0x60, 0x02, 0x3D, 0xBF,
+        0xFF, 0xD0, 0x89, 0x58, 0x80, 0x45, 0x00, 0x06, 0x0A, 0x20, 0x19, 0x4C, 0xB9, 0xDF, 0x2F, 0x37,
+        0xC0, 0xFB, 0xD3, 0x3D, 0x19, 0x67, 0x85, 0x8C, 0xDE, 0x43, 0x29, 0x78, 0x5F, 0x05, 0x60, 0xC9,
+        0x1C, 0xAF, 0x01, 0x18, 0x17, 0xCB, 0x24, 0xB1, 0x8F, 0x94, 0x73, 0xB8, 0x65, 0xC2, 0x2C, 0x8C,
+        0x83, 0x3B, 0xC7, 0x2E, 0x11, 0x0C, 0xDE, 0x23, 0x19, 0x37, 0x86, 0x53, 0x3B, 0xE5, 0xC4, 0x64,
+        0xB8, 0xBE, 0x58, 0xE5, 0x8E, 0x01, 0xA1, 0xB5, 0xEA, 0xCD, 0xB8, 0x79, 0x40, 0xC8, 0xCD, 0xE2,
+        0x4C, 0xA3, 0x9B, 0x31, 0x21, 0x8C, 0x6C, 0x90, 0x6B, 0x19, 0x70, 0x0E, 0xF3, 0x64, 0x44, 0xA5,
+        0x7C, 0xD9, 0xBC, 0xB4, 0xCD, 0x82, 0x89, 0xB8, 0xE5, 0x57, 0x37, 0x11, 0x59, 0xA6, 0x36, 0x0D,
+        0x8D, 0xF0, 0xAC, 0x2B, 0xA2, 0x4E, 0x2D, 0xC4, 0xC3, 0x43, 0x36, 0xC8, 0xB1, 0x67, 0x72, 0x6C,
+        0xC0, 0x00, 0xC7, 0x53, 0xD7, 0x93, 0xC3, 0xC3, 0x34, 0x17, 0x8D, 0x23, 0x88, 0x01, 0x9B, 0x49,
+        0xD7, 0x62, 0xE9, 0x4F, 0x42, 0x18, 0x2E, 0x80, 0xE3, 0x00, 0x88, 0x13, 0xF6, 0x10, 0x60, 0x4F,
+        0x13, 0x3E, 0x84, 0xFB, 0xB7, 0xCA, 0xFB, 0xBE, 0x26, 0xF2, 0x8C, 0x14, 0x94, 0xEB, 0xA2, 0x4F,
+        0x60, 0xFC, 0x2A, 0xC1, 0xA8, 0x01, 0xC7, 0xFF, 0x3F, 0xF3, 0xCD, 0x30, 0x00, 0x59, 0x94, 0x41,
+        0x4D, 0x22, 0x33, 0x75, 0xB9, 0xE9, 0xA5, 0xAE, 0xCA, 0x3B, 0x9D, 0x77, 0x2D, 0x4D, 0x2B, 0xBC,
+        0x1E, 0xA5, 0x1D, 0x8C, 0xBB, 0xCD, 0x88, 0x9A, 0x46, 0xE2, 0xB3, 0x43, 0x01, 0xEE, 0x33, 0x79,
+        0xBC, 0xD9, 0x72, 0x82, 0x58, 0xDA, 0x44, 0x1A, 0xB4, 0xA6, 0x1A, 0x02, 0x2B, 0x9B, 0xCA, 0x4A,
+        0x0E, 0x51, 0x8B, 0x16, 0x0B, 0x94, 0x65, 0x1F, 0x35, 0x9B, 0xC6, 0x58, 0x96, 0x4A, 0x39, 0x46,
+        0x32, 0x6C, 0x2C, 0x9B, 0xE0, 0xE8, 0xBE, 0x76, 0x4B, 0x17, 0x14, 0x1E, 0x7A, 0x63, 0x12, 0x36,
+        0x32, 0x68, 0xF9, 0xA2, 0xE1, 0x37, 0x16, 0x6E, 0x60, 0xD2, 0xC9, 0x78, 0xD9, 0x36, 0x12, 0x8C,
+        0x8B, 0x9B, 0xC5, 0xCE, 0xF9, 0xB0, 0x07, 0x37, 0x94, 0x79, 0x40, 0x02, 0x7F, 0xFF, 0x8E, 0x41,
+        0xA2, 0xF0, 0x77, 0x36, 0x75, 0xF4, 0xB4, 0x93, 0xD3, 0x92, 0x92, 0xD2, 0x32, 0x51, 0x53, 0xE7,
+        0xBE, 0x38, 0xD5, 0xF3, 0x75, 0x78, 0x89, 0xA9, 0xB8, 0xC1, 0xEC, 0x47, 0x1B, 0x88, 0x01, 0xA3,
+        0x4D, 0xBB, 0x40, 0x4E, 0x1C, 0x64, 0x44, 0xB1, 0x98, 0xC8, 0xCC, 0xA0, 0xDE, 0x26, 0xAD, 0x69,
+        0x86, 0x16, 0xC7, 0x3C, 0xB4, 0xDB, 0x69, 0xFA, 0xF8, 0xFD, 0x7E, 0x39, 0xC4, 0x04, 0x48, 0xCC,
+        0x8C, 0x94, 0x72, 0xCD, 0x73, 0x65, 0xB9, 0x67, 0x64, 0x1B, 0x3D, 0xE6, 0xC3, 0x58, 0x96, 0x28,
+        0xD0, 0xDC, 0x55, 0xCD, 0x0A, 0xA3, 0x28, 0xC7, 0x49, 0xBC, 0xF6, 0x59, 0x0A, 0xD3, 0x86, 0xD4,
+        0xC1, 0x9A, 0xDE, 0x25, 0x19, 0x91, 0x99, 0x08, 0x84, 0x73, 0xF8, 0xFD, 0x7C, 0x7D, 0x7A, 0xF3,
+        0x3E, 0xB9, 0xEF, 0x9D, 0x71, 0xC6, 0x33, 0x9D, 0x4A, 0xE6, 0xB1, 0x13, 0xDC, 0xED, 0x52, 0xA8,
+        0x4D, 0x80, 0xDD, 0x97, 0x93, 0x6E, 0xF3, 0x05, 0x8D, 0xAC, 0xF5, 0x3F, 0x76, 0x18, 0x01, 0x13,
+        0x1E, 0x77, 0x97, 0x8B, 0x81, 0x81, 0x01, 0x00, 0x00, 0x6A, 0xFF, 0xDC, 0x7F, 0x8B, 0xBE, 0xE1,
+        0x98, 0x05, 0x8A, 0x91, 0x2E, 0x8C, 0x42, 0x17, 0xA9, 0xC8, 0xE0, 0x66, 0x65, 0x5E, 0xB5, 0x2A,
+        0x74, 0x48, 0xCB, 0x38, 0xC2, 0x49, 0x17, 0x58, 0xF8, 0xC5, 0x63, 0x4A, 0x2A, 0x30, 0x42, 0xC0,
+        0x59, 0xBB, 0x7B, 0xB0, 0xB0, 0x2C, 0x17, 0x18, 0x0E, 0x4B, 0x94, 0xB4, 0x1D, 0x40, 0xD3, 0xD0,
+        0xD5, 0x47, 0x83, 0xD2, 0x31, 0x8A, 0x8A, 0x27, 0x49, 0x44, 0x97, 0x59, 0x76, 0x6C, 0x5B, 0xB5,
+        0x17, 0xC6, 0x82, 0x46, 0x20, 0xC1, 0xAB, 0xE2, 0x68, 0x65, 0xE3, 0x99, 0x71, 0xF1, 0x71, 0xF9,
+        0xA3, 0xC4, 0xE4, 0x61, 0x8C, 0x98, 0x1C, 0x1B, 0x24, 0x97, 0x81, 0x92, 0x38, 0x41, 0x67, 0x07,
+        0x9B, 0xF1, 0xC5, 0xF1, 0xCA, 0x39, 0x8F, 0x2C, 0xE3, 0x97, 0x8E, 0x39, 0x88, 0x11, 0x08, 0x0A,
+        0x93, 0x56, 0xEC, 0x59, 0xAE, 0xBA, 0xA9, 0xA8, 0x90, 0xED, 0x96, 0x52, 0xA5, 0x2C, 0x38, 0x23,
+        0x48, 0x24, 0x70, 0x0F, 0x6C, 0xF6, 0xC6, 0xB2, 0xF4, 0x0D, 0xCC, 0xAF, 0x72, 0xD0, 0x15, 0xA7,
+        0x6C, 0xFB, 0xD4, 0x04, 0x61, 0x66, 0xF9, 0xB9, 0xB3, 0x14, 0x80, 0x04, 0xB1, 0xDE, 0x5D, 0x30,
+        0x7E, 0x82, 0xDF, 0xEE, 0x10, 0x02, 0x3F, 0x87, 0xFF, 0xD9, 0x01, 0x81, 0x18, 0x19, 0x00, 0x28,
+        0xF4, 0x13, 0x23, 0xF8, 0x61, 0xC7, 0xCC, 0x7C, 0xC0, 0x86, 0x82, 0x58, 0x34, 0x22, 0xAA, 0x74,
+        0x91, 0x21, 0xA0, 0x22, 0x85, 0x43, 0xD0, 0x81, 0x42, 0x71, 0xF2, 0x43, 0x38, 0x61, 0xC3, 0x80,
+        0xE1, 0xC7, 0xC7, 0x86, 0x47, 0x9C, 0x66, 0x09, 0xC3, 0x09, 0x8F, 0x8C, 0xC3, 0x8C, 0x28, 0x15,
+        0x3C, 0x5E, 0x08, 0xA1, 0x45, 0xE9, 0x8E, 0x1C, 0xDC, 0x99, 0x7E, 0x68, 0x70, 0x30, 0x6E, 0x44,
+        0x98, 0x1B, 0xF9, 0xA3, 0xE1, 0xA0, 0x00, 0x80, 0x06, 0x00, 0x30, 0x00, 0x20, 0x01, 0x00, 0x02,
+        0x00, 0x10, 0x00, 0x20, 0x03, 0x00, 0x06, 0x00, 0x08, 0x00, 0x40, 0x02, 0x00, 0x0B, 0xFF, 0xFE,
+        0x0D, 0x8F, 0xFF, 0xF8, 0x36, 0x85, 0x12, 0x8D, 0x30, 0x54, 0xEB, 0x30, 0xEA, 0x45, 0x80, 0x5C,
+        0xD2, 0x37, 0x29, 0xA3, 0xCD, 0xE7, 0xB8, 0x55, 0x94, 0xAC, 0x49, 0x6F, 0x8D, 0x85, 0x31, 0x9A,
+        0x90, 0xC9, 0x43, 0x6B, 0x79, 0xD5, 0x29, 0xA5, 0x61, 0x6F, 0x07, 0x68, 0x4A, 0xB5, 0x21, 0x89,
+        0x03, 0xA5, 0x36, 0x86, 0xEC, 0xD3, 0x4A, 0x35, 0x3D, 0xE6, 0xED, 0x2A, 0x75, 0x3D, 0x1E, 0x7D,
+        0x8D, 0xD9, 0xBA, 0x56, 0x97, 0x45, 0x75, 0xB3, 0xB4, 0x3D, 0x34, 0x9F, 0x44, 0xB9, 0xEE, 0xC6,
+        0xED, 0x66, 0xDA, 0x89, 0x7B, 0x0F, 0x59, 0xB5, 0xA1, 0xEA, 0x33, 0x67, 0x68, 0x5D, 0x34, 0xA6,
+        0xF0, 0x7E, 0xCD, 0x0F, 0x72, 0x9B, 0x3B, 0x34, 0xA2, 0x34, 0x2B, 0x4D, 0x27, 0x60, 0x8F, 0x72,
+        0xB3, 0x43, 0x79, 0xEE, 0x50, 0xD2, 0xA9, 0x70, 0xCA, 0x91, 0x53, 0x38, 0xBA, 0x65, 0x30, 0xA4,
+        0x1C, 0x4C, 0xD3, 0x89, 0xA9, 0x42, 0x91, 0x23, 0x94, 0xBC, 0x48, 0x8D, 0xF9, 0xA4, 0x79, 0x5E,
+        0x06, 0xF0, 0xE0, 0xF7, 0xCD, 0xC9, 0x95, 0xE0, 0x73, 0x78, 0x23, 0xCB, 0x92, 0x40, 0x33, 0x9B,
+        0x33, 0x20, 0xB3, 0x2F, 0x8C, 0xF1, 0x0E, 0x19, 0x12, 0xE2, 0x44, 0x60, 0x8A, 0x38, 0x34, 0x21,
+        0xE8, 0x43, 0x99, 0x7C, 0x86, 0x1C, 0xE6, 0xFC, 0x02, 0x8C, 0x11, 0xA7, 0x51, 0x08, 0xD0, 0xD2,
+        0x22, 0x7E, 0x3C, 0x0F, 0x80, 0x02, 0x4F, 0x9B, 0xFF, 0xFF, 0x88, 0x04, 0x31, 0x0C, 0x60, 0x11,
+        0x40, 0x12, 0x04, 0x82, 0x7C, 0x25, 0xA9, 0xE0, 0xF1, 0x3A, 0x58, 0x0A, 0x0A, 0x2A, 0x81, 0xE0,
+        0x42, 0x88, 0xA4, 0x63, 0x03, 0x8C, 0xF9, 0x73, 0x39, 0x1E, 0x60, 0x70, 0x1F, 0x97, 0x0C, 0x98,
+        0x49, 0x32, 0xFC, 0x01, 0x0F, 0x9B, 0x30, 0xE6, 0xE4, 0xCB, 0x80, 0x3C, 0xDE, 0x00, 0xF9, 0xDF,
+        0x37, 0x08, 0x9A, 0x00, 0x10, 0x00, 0x20, 0x00, 0x7F, 0xFF, 0x83, 0x63, 0xFF, 0xFE, 0x0D, 0x90,
+        0x00, 0x40, 0x00, 0x80, 0x00, 0x00, 0x10, 0x00, 0x20, 0x01, 0x00, 0x0E, 0x00, 0x40, 0x00, 0xE0,
+        0x04, 0x00, 0x0A, 0x2C, 0x0D, 0xE6, 0x85, 0xCA, 0x6E, 0x51, 0xB9, 0xB1, 0x9F, 0x79, 0xB1, 0xA6,
+        0x81, 0x32, 0xC3, 0x2E, 0xB6, 0x15, 0xB5, 0x68, 0x5E, 0xE7, 0xA2, 0xF5, 0x4F, 0x43, 0x68, 0xE9,
+        0x4F, 0xB1, 0xEB, 0x4D, 0xF4, 0x29, 0x4C, 0xB9, 0xAE, 0xE2, 0xCD, 0x96, 0x36, 0xA4, 0xB3, 0x19,
+        0x62, 0x65, 0xEF, 0x1B, 0x19, 0x5B, 0x04, 0x6D, 0xDA, 0xDA, 0xDA, 0xB3, 0x6D, 0xC8, 0x2D, 0xAC,
+        0x9B, 0x8E, 0xD5, 0xB5, 0xB9, 0x62, 0x4B, 0x21, 0xED, 0x4C, 0x8C, 0xB3, 0x67, 0x21, 0x8E, 0xDD,
+        0x3E, 0xCF, 0x5B, 0x74, 0xF5, 0xEA, 0x36, 0xE9, 0xBE, 0x87, 0xB5, 0xBB, 0x4D, 0x1D, 0xB5, 0xBB,
+        0x4D, 0x3D, 0x36, 0x9A, 0x35, 0xB5, 0xB5, 0xBB, 0xCF, 0xB4, 0x28, 0xE9, 0xA5, 0x37, 0x7C, 0xFA,
+        0x1B, 0x3B, 0x04, 0xF7, 0x29, 0xA6, 0xCC, 0xF4, 0x2A, 0x0C, 0xD6, 0x54, 0x27, 0x60, 0xDE, 0x68,
+        0x84, 0xEF, 0x0A, 0xCC, 0xAC, 0xCA, 0x0B, 0x18, 0x3C, 0xB9, 0xBE, 0x20, 0x70, 0x77, 0x21, 0x95,
+        0xF3, 0x37, 0x8C, 0xE3, 0x05, 0xE0, 0x71, 0xE0, 0x70, 0xC2, 0x3F, 0x82, 0x93, 0xCB, 0xCC, 0x38,
+        0x19, 0xF2, 0xF1, 0x2E, 0x26, 0x30, 0x95, 0x1A, 0x85, 0x14, 0x6A, 0x88, 0x45, 0x51, 0xA5, 0x81,
+        0x43, 0x42, 0x28, 0x17, 0x06, 0x86, 0x86, 0xA7, 0x88, 0xA1, 0x51, 0x08, 0xB4, 0x78, 0x14, 0x7C,
+        0x3D, 0x1C, 0x61, 0x45, 0x41, 0x0D, 0x2C, 0x28, 0xD3, 0xE9, 0x1E, 0x22, 0x8E, 0x0B, 0x02, 0xB8,
+        0x35, 0x03, 0x88, 0x85, 0xA3, 0xC0, 0x2A, 0x88, 0xC2, 0xC1, 0xE0, 0xF0, 0x22, 0xB5, 0x3C, 0x14,
+        0x0D, 0x0A, 0xD3, 0xC0, 0x02, 0x49, 0x3F, 0xFF, 0xFF, 0xF8, 0x08, 0x11, 0x0C, 0x42, 0x18, 0x82,
+        0x11, 0x04, 0x85, 0x19, 0x72, 0xDC, 0x51, 0x2B, 0x14, 0x4D, 0x8D, 0xCD, 0x55, 0x1D, 0x94, 0x4E,
+        0xC7, 0x73, 0x76, 0x5A, 0xAE, 0xA3, 0x3B, 0x66, 0xEC, 0xD6, 0xBA, 0x6D, 0x45, 0xDD, 0x1B, 0xD3,
+        0x6C, 0xFB, 0x3A, 0x74, 0x5B, 0x6E, 0xAF, 0xB3, 0xD3, 0x74, 0xDA, 0x56, 0x59, 0xB7, 0x22, 0xCE,
+        0x55, 0xCA, 0xD8, 0xB6, 0xEE, 0x9D, 0xEA, 0xED, 0xEB, 0x7A, 0x35, 0xEB, 0xB7, 0xA7, 0x6E, 0xBD,
+        0x6F, 0x46, 0xBD, 0xBA, 0xBD, 0xE9, 0xBB, 0x6B, 0xF4, 0x66, 0xF5, 0xAF, 0xA6, 0xDE, 0xB7, 0x4E,
+        0x8E, 0x9B, 0xA7, 0xAB, 0xAE, 0xDB, 0x74, 0x1D, 0xB6, 0xBA, 0xBD, 0xAD, 0x6D, 0xA2, 0xDA, 0xE9,
+        0xAB, 0x76, 0x5A, 0xD1, 0xB6, 0x6A, 0xEC, 0xA7, 0x66, 0xCA, 0x8E, 0xC3, 0xB9, 0xAC, 0xB4, 0xB1,
+        0x41, 0xA5, 0x8A, 0x2E, 0x77, 0x2C, 0x4B, 0x00, 0x10, 0x01, 0x00, 0x20, 0x02, 0x00, 0x50, 0x02,
+        0x00, 0x10, 0x04, 0x00, 0x10, 0x01, 0x00, 0x00, 0x04, 0xFF, 0x39, 0x7F, 0x85, 0xEF, 0xF0, 0x8A,
+        0xF0, 0xEC, 0x9F, 0xF2, 0x23, 0xE0, 0xF6, 0x0A, 0x4D, 0xA1, 0x28, 0x8C, 0x31, 0x42, 0x94, 0x14,
+        0x5F, 0x3F, 0x47, 0x53, 0x7C, 0x71, 0x33, 0x46, 0xB6, 0xDA, 0xD0, 0xE7, 0x69, 0x70, 0x34, 0x36,
+        0x32, 0xB4, 0xF1, 0x73, 0x70, 0xF1, 0xAF, 0xE2, 0xD8, 0xAE, 0x0D, 0x1A, 0xB3, 0xE6, 0xC9, 0x93,
+        0x06, 0x2B, 0xB0, 0x5B, 0x65, 0x75, 0xD3, 0x3D, 0x73, 0x9E, 0x35, 0xAC, 0xDE, 0xAA, 0xEB, 0x11,
+        0x18, 0x88, 0xAD, 0xCB, 0x39, 0x64, 0xC9, 0x90, 0xA0, 0x68, 0x61, 0x45, 0x45, 0x60, 0x69, 0x63,
+        0x04, 0xAB, 0x18, 0x55, 0x8A, 0xE0, 0xF0, 0xAB, 0x85, 0x82, 0xA8, 0xD6, 0x22, 0xB4, 0xB1, 0x55,
+        0x8C, 0x2D, 0x41, 0x56, 0xAA, 0x31, 0x15, 0xA5, 0xA8, 0xAC, 0x46, 0x28, 0x97, 0x11, 0x15, 0x5A,
+        0x1A, 0x8C, 0x2D, 0x2A, 0xD1, 0x28, 0xD0, 0xD4, 0x61, 0x54, 0x62, 0xA2, 0x95, 0x16, 0x8F, 0x03,
+        0x0A, 0xB0, 0xB0, 0x34, 0xA2, 0x30, 0x4A, 0xA2, 0x29, 0x60, 0x62, 0x28, 0xE9, 0x2D, 0x11, 0xA8,
+        0x8C, 0x1C, 0x28, 0x85, 0x49, 0x60, 0x14, 0x50, 0xC0, 0x50, 0xA9, 0x42, 0x81, 0x18, 0x1D, 0xF3,
+        0x09, 0x98, 0x4C, 0x87, 0x09, 0x82, 0x63, 0xC8, 0x1E, 0x59, 0x26, 0x00, 0x33, 0x9B, 0xC7, 0x00,
+        0xC6, 0x11, 0xC0, 0x9B, 0x57, 0xA0, 0x02, 0x5F, 0xFF, 0xEA, 0x76, 0x02, 0x00, 0x20, 0x00, 0x00,
+        0x31, 0x83, 0x04, 0x40, 0x01, 0x08, 0x4B, 0xE7, 0x72, 0xE0, 0x21, 0x0B, 0x82, 0x5F, 0x3B, 0x82,
+        0x44, 0xCD, 0xC0, 0x0E, 0xF3, 0xBC, 0x5A, 0x69, 0x82, 0x17, 0x0B, 0x83, 0x0B, 0x85, 0xC1, 0x0B,
+        0xCB, 0x10, 0x85, 0xF3, 0xB8, 0x68, 0x00, 0x60, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x01,
+        0x00, 0x02, 0x00, 0x17, 0xFC, 0x40, 0x1F, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+        0x60, 0x04, 0x00, 0x0E, 0x38, 0x5C, 0x13, 0x3B, 0xC2, 0xE0, 0x5D, 0x00, 0x10, 0x00, 0x00, 0x00,
+        0x00, 0x01, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x02, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0F, 0xF8, 0x80, 0xBF, 0xF1, 0x01, 0x84, 0xBC, 0xA4, 0x2E, 0x17, 0x00, 0x43,
+        0x46, 0xB1, 0xDE, 0x77, 0x80, 0xB4, 0xD3, 0x0E, 0xF3, 0xBC, 0x22, 0x66, 0xE1, 0x70, 0x2E, 0x0C,
+        0x09, 0x9D, 0xE1, 0xDE, 0x4D, 0x06, 0x77, 0x8E, 0xF1, 0x69, 0xAD, 0x00, 0x04, 0x00, 0x40, 0x00,
+        0x00, 0x03, 0x00, 0x20, 0x00, 0x70, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x01,
+        0x00, 0x00, 0x00, 0x4F, 0xF8, 0x80, 0xBF, 0xF1, 0x00, 0x83, 0x77, 0x83, 0xBD, 0x35, 0xAF, 0x0E,
+        0xE1, 0x70, 0x2F, 0x29, 0x12, 0x01, 0xDE, 0x1D, 0xE4, 0xD6, 0x77, 0x80, 0xEF, 0x13, 0x5B, 0xBC,
+        0x70, 0xE0, 0x17, 0x18, 0xE6, 0xE1, 0x70, 0x12, 0xE0, 0xC4, 0x85, 0xC2, 0xF9, 0xD1, 0xC1, 0x22,
+        0x67, 0x78, 0x17, 0x0A, 0x1E, 0x2D, 0x33, 0xBC, 0x3B, 0xC0, 0x8C, 0x77, 0x8E, 0xF3, 0xBF, 0x0D,
+        0x21, 0x70, 0xBE, 0x77, 0x04, 0x88, 0x35, 0x8E, 0xF3, 0xBC, 0x5A, 0xD0, 0x00, 0x00, 0x02, 0x00,
+        0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x04, 0xFF, 0x88, 0x03,
+        0xFF, 0x0F, 0xF8, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x08, 0x1D, 0xE7, 0x78, 0x4D, 0x34, 0x18,
+        0xEF, 0x1D, 0xE5, 0xA6, 0x0E, 0xF0, 0xBE, 0x77, 0x04, 0x89, 0x9B, 0x82, 0x14, 0xF3, 0xB8, 0x0C,
+        0xB3, 0x37, 0x00, 0x3B, 0xDD, 0xE5, 0x8E, 0xF7, 0x0E, 0x01, 0x79, 0x42, 0x30, 0xBE, 0x77, 0x40,
+        0x04, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x03, 0x00, 0x18, 0x00, 0x30, 0x00, 0x80, 0x01, 0x00,
+        0x0B, 0xFE, 0x20, 0x1F, 0xFC, 0x40, 0x20, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x31, 0xF3, 0xB8,
+        0x5C, 0x63, 0x9B, 0x85, 0xC0, 0x4B, 0x83, 0x0B, 0x33, 0x70, 0x04, 0x47, 0x96, 0x30, 0x02, 0xBF,
+        0xFD, 0x34, 0xBB, 0x28, 0x7F, 0xFE, 0x33, 0xE0, 0x04, 0x00, 0x40, 0x06, 0x00, 0x40, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x60, 0x0C, 0x00, 0x20, 0x04, 0x00, 0xA0, 0x0C, 0x28, 0x0C, 0x9B, 0xC4, 0x72,
+        0xC9, 0x80, 0x05, 0x00, 0x30, 0x00, 0x40, 0x04, 0x00, 0x50, 0x03, 0x7F, 0xFE, 0x33, 0xBF, 0xFF,
+        0xC6, 0x74, 0x00, 0x20, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x32,
+        0x58, 0x4B, 0x19, 0x37, 0x8C, 0xA3, 0x07, 0x37, 0x8C, 0xDE, 0x2C, 0x00, 0x66, 0xF1, 0x18, 0x03,
+        0x8C, 0xDC, 0x01, 0x7A, 0xB3, 0x76, 0xBD, 0x02, 0xF5, 0x60, 0xBD, 0x58, 0x02, 0xF5, 0x60, 0xBD,
+        0x5B, 0x00, 0x00, 0x00, 0x20, 0x01, 0x80, 0x08, 0x00, 0x20, 0x04, 0xFF, 0xFC, 0x66, 0xFF, 0xFF,
+        0x8C, 0xD0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x04, 0x2C,
+        0x17, 0xA9, 0xB7, 0x60, 0x0B, 0x6E, 0xC1, 0x6D, 0xC1, 0x82, 0xDB, 0xB3, 0x76, 0xB0, 0xCD, 0xE3,
+        0x2C, 0x1C, 0xDE, 0x33, 0x78, 0x12, 0xC6, 0xFB, 0xF4, 0xB0, 0x17, 0x19, 0xB8, 0x03, 0x8B, 0x08,
+        0x1D, 0xAF, 0x4B, 0x6E, 0xC1, 0x07, 0xAB, 0x05, 0xEA, 0xC2, 0xC0, 0x00, 0x00, 0x40, 0x10, 0x00,
+        0x40, 0x04, 0x00, 0x80, 0x00, 0x00, 0x80, 0x0C, 0x00, 0x80, 0x04, 0x01, 0x3F, 0xFF, 0x19, 0xF0,
+        0x04, 0xFF, 0xFC, 0x66, 0x80, 0x00, 0x05, 0xEA, 0xC1, 0x7A, 0x81, 0xB7, 0x60, 0xB6, 0xEC, 0x60,
+        0x00, 0x00, 0x01, 0xFF, 0xF8, 0xCD, 0xFF, 0xFF, 0x19, 0xC0, 0x00, 0x80, 0x06, 0x00, 0x20, 0x00,
+        0x80, 0x10, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x80, 0x04, 0x00, 0x30, 0x01, 0x00, 0x5B, 0x76,
+        0x0B, 0x60, 0xEC, 0x16, 0xDD, 0x9B, 0xB4, 0x38, 0x8C, 0x96, 0x01, 0x78, 0xCA, 0x18, 0x59, 0xBE,
+        0xFD, 0x0B, 0x0C, 0xDE, 0x33, 0x79, 0x60, 0xE3, 0x37, 0x81, 0x5A, 0xF4, 0xBD, 0x58, 0x30, 0x00,
+        0x20, 0x04, 0xFF, 0xFC, 0x67, 0x3F, 0xFF, 0x8C, 0xD8, 0x00, 0x80, 0x05, 0x00, 0x30, 0x00, 0x40,
+        0x04, 0x00, 0x50, 0x03, 0x00, 0x04, 0x00, 0x20, 0x04, 0x00, 0x18, 0x00, 0x84, 0x9B, 0xC5, 0x80,
+        0x4D, 0xE3, 0x34, 0x3C, 0x2F, 0x56, 0x6E, 0xD7, 0xA0, 0x5B, 0x76, 0x0B, 0x6E, 0xC0, 0x16, 0xDD,
+        0x82, 0xF5, 0x06, 0x6E, 0xD7, 0xA5, 0xB7, 0x60, 0x4B, 0xC6, 0x58, 0x03, 0x09, 0xBC, 0x14, 0x18,
+        0x4D, 0xE3, 0x37, 0x96, 0x02, 0xE3, 0x37, 0x8B, 0x1C, 0x47, 0x10, 0xB0, 0x5E, 0x03, 0xCE, 0xF3,
+        0xEA, 0xE8, 0xFF, 0xC7, 0x3B, 0xF8, 0x01, 0x80, 0x06, 0x00, 0x00, 0x02, 0x00, 0x14, 0x00, 0x80,
+        0x05, 0x00, 0x40, 0x01, 0xC0, 0x0C, 0x00, 0x30, 0x01, 0x00, 0x04, 0x5C, 0xB8, 0xD9, 0x9B, 0x96,
+        0x01, 0xBA, 0x00, 0x50, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x20, 0x01, 0x7F, 0x25, 0x67, 0xFF,
+        0x4B, 0x2B, 0xE4, 0xB5, 0x80, 0x04, 0x00, 0x00, 0x00, 0x80, 0x02, 0x80, 0x08, 0x00, 0x08, 0x00,
+        0x25, 0x0E, 0x19, 0xD6, 0xF1, 0x78, 0x24, 0x1C, 0x64, 0x7C, 0xF7, 0xE5, 0x1C, 0xB8, 0xB0, 0x08,
+        0x53, 0x8B, 0xA1, 0x7A, 0x60, 0x04, 0x1C, 0x31, 0xC1, 0x39, 0xA3, 0xE3, 0x61, 0x0A, 0x38, 0x39,
+        0xBC, 0x2F, 0x37, 0x04, 0xE7, 0x47, 0xCA, 0x12, 0x6E, 0x73, 0xDC, 0x8E, 0x58, 0x49, 0xC1, 0x46,
+        0xAE, 0x84, 0xE0, 0x67, 0xC6, 0xC9, 0x62, 0xD2, 0x00, 0x18, 0x59, 0xEB, 0x35, 0x25, 0x40, 0xBE,
+        0x37, 0x49, 0xD6, 0x75, 0x35, 0x34, 0x1F, 0x78, 0x1B, 0xB6, 0x46, 0x25, 0x34, 0xE2, 0x71, 0x74,
+        0xE0, 0x34, 0x00, 0xBE, 0x7B, 0x91, 0x4F, 0x3B, 0x0B, 0xE5, 0x4A, 0x18, 0x51, 0xBE, 0x2F, 0x1B,
+        0xE2, 0xD2, 0x70, 0x44, 0xC4, 0xC0, 0x57, 0x15, 0xBD, 0x4A, 0x59, 0x1F, 0xCB, 0x72, 0xC9, 0xB9,
+        0x37, 0x17, 0x2E, 0x00, 0x10, 0x00, 0x60, 0x01, 0x00, 0x30, 0x01, 0xC0, 0x10, 0x00, 0x50, 0x01,
+        0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x1F, 0xDF, 0xF7, 0xF7, 0xFF, 0x7E, 0x00, 0x0F, 0xC0, 0x02,
+        0x31, 0xCD, 0xCB, 0x18, 0x0D, 0xF9, 0xEF, 0x05, 0xB3, 0x37, 0x1B, 0xC4, 0xDF, 0x9D, 0x93, 0x40,
+        0x03, 0x00, 0x13, 0xE4, 0xB5, 0xFF, 0xE9, 0x6A, 0x7C, 0x96, 0xD0, 0x00, 0x80, 0x00, 0x00, 0x10,
+        0x00, 0x50, 0x01, 0x00, 0x01, 0x00, 0x04, 0x00, 0x40, 0x00, 0xC0, 0x02, 0x00, 0x08, 0xAF, 0x8D,
+        0xE2, 0xF8, 0xDC, 0x27, 0x8B, 0x0A, 0x2C, 0x79, 0x72, 0xE2, 0xC0, 0x26, 0xF9, 0xDE, 0x09, 0xDF,
+        0x94, 0x08, 0x5C, 0xB8, 0x38, 0x3B, 0x93, 0xBF, 0x2C, 0xB2, 0x17, 0x06, 0x10, 0x09, 0xD4, 0xC0,
+        0x22, 0x9C, 0xF5, 0x94, 0x32, 0x6F, 0x9B, 0x08, 0xE5, 0x81, 0x02, 0x31, 0x30, 0x88, 0x41, 0xEB,
+        0x2B, 0x16, 0x89, 0x03, 0x57, 0x4B, 0x3D, 0x66, 0xA7, 0x13, 0x0C, 0xAA, 0x71, 0x9C, 0x09, 0xD5,
+        0xA1, 0x13, 0x00, 0x08, 0x04, 0xB3, 0x9D, 0x86, 0x53, 0x29, 0x44, 0xE2, 0xE8, 0x5F, 0x16, 0x8D,
+        0x5E, 0xB3, 0x04, 0x22, 0xE9, 0xC1, 0x0F, 0x59, 0xC6, 0x70, 0x41, 0x13, 0x8B, 0xC6, 0xF4, 0x5C,
+        0x38, 0x26, 0x24, 0xA0, 0x2B, 0xC4, 0x8A, 0x6E, 0xA6, 0x8B, 0x81, 0xB0, 0x95, 0xC1, 0x72, 0xE5,
+        0x78, 0x3B, 0x00, 0x2F, 0x00, 0x03, 0xCE, 0x57, 0xC0, 0xAD, 0x7F, 0xE0, 0x4F, 0xFD, 0x2F, 0x80,
+        0x00, 0x00, 0x48, 0x03, 0x00, 0x0A, 0x00, 0x00, 0x01, 0x80, 0x28, 0x01, 0x60, 0x08, 0x00, 0x18,
+        0x00, 0x40, 0x08, 0x22, 0x99, 0xB3, 0x36, 0x0E, 0x6E, 0x1A, 0x00, 0x18, 0x00, 0x80, 0x00, 0x80,
+        0x06, 0x00, 0x30, 0x00, 0x3E, 0x7A, 0x2F, 0xFB, 0xD1, 0x5E, 0x7A, 0x28, 0x00, 0x20, 0x03, 0x00,
+        0x06, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x0A, 0x54, 0x5D, 0x33, 0x11, 0x95, 0x59, 0xE2, 0xE2,
+        0x4A, 0x8B, 0xC5, 0xD4, 0xE2, 0xE0, 0xC3, 0x08, 0x08, 0x6F, 0xCD, 0xCB, 0x13, 0x9B, 0x09, 0xA3,
+        0xE3, 0xBC, 0x18, 0xCC, 0xF7, 0x91, 0x9A, 0x54, 0xA6, 0x8C, 0xE9, 0xA6, 0xA2, 0xF5, 0x28, 0x93,
+        0xAB, 0xA5, 0x34, 0x42, 0x70, 0x98, 0x1C, 0x48, 0x9E, 0x7D, 0xF0, 0xB9, 0x37, 0xCD, 0x13, 0x94,
+        0x80, 0x4D, 0xF1, 0x0B, 0xC2, 0x0E, 0xA5, 0x53, 0x27, 0x59, 0xD6, 0x75, 0x9D, 0x14, 0x9D, 0x66,
+        0x2A, 0xC5, 0x4C, 0x00, 0xB3, 0xE0, 0xB9, 0xD4, 0x8A, 0x98, 0x75, 0x29, 0x07, 0x52, 0x4A, 0x2F,
+        0x0C, 0x22, 0x85, 0xE8, 0xBA, 0x91, 0x80, 0x4A, 0x49, 0xBC, 0xB2, 0xE0, 0x36, 0x12, 0xE6, 0xE0,
+        0x84, 0xBC, 0xF4, 0xA9, 0x33, 0x57, 0x8B, 0x84, 0xD4, 0xE1, 0x9C, 0x00, 0x10, 0x00, 0x00, 0x06,
+        0x00, 0x40, 0x00, 0x00, 0x04, 0x00, 0x60, 0x08, 0x00, 0x28, 0x00, 0x80, 0x06, 0x00, 0x6F, 0xD2,
+        0xFB, 0xFA, 0x5F, 0xBF, 0x4B, 0x97, 0xE9, 0x79, 0x1C, 0x13, 0x3B, 0x8E, 0x34, 0xE5, 0xB8, 0x33,
+        0x71, 0x9B, 0x99, 0xD9, 0x9B, 0x09, 0x74, 0x00, 0x20, 0x00, 0x3C, 0xF4, 0x5F, 0xF7, 0xA2, 0xBC,
+        0xF4, 0x50, 0x00, 0x00, 0x02, 0x00, 0x0C, 0x00, 0x60, 0x01, 0xC0, 0x06, 0x00, 0x1C, 0x00, 0xC0,
+        0x02, 0x40, 0x06, 0x00, 0x0C, 0x8D, 0x4A, 0x4F, 0x19, 0x55, 0x21, 0x21, 0x91, 0xFC, 0xD8, 0x38,
+        0xEF, 0x8A, 0x49, 0x42, 0xAC, 0xD4, 0x67, 0x57, 0x40, 0x94, 0x11, 0x05, 0x13, 0x0F, 0x5B, 0xC1,
+        0x78, 0x24, 0xD4, 0xA2, 0xC6, 0xF0, 0xEA, 0xF5, 0x9A, 0x4E, 0x27, 0x0C, 0x06, 0xEF, 0xD0, 0xD6,
+        0x17, 0xB1, 0x5F, 0x1B, 0xC0, 0x70, 0x1D, 0x38, 0x78, 0xCE, 0x06, 0xC1, 0xF3, 0xA6, 0x12, 0xC8,
+        0xB8, 0x51, 0x9C, 0x10, 0x6A, 0x6A, 0x55, 0x4A, 0x34, 0x3B, 0x08, 0xC7, 0x37, 0x8D, 0xE2, 0x41,
+        0x5C, 0x5C, 0x17, 0x8D, 0x3E, 0x7E, 0xFE, 0x16, 0x70, 0xC2, 0x6A, 0x2F, 0x05, 0x8A, 0x98, 0x29,
+        0xA2, 0x62, 0x69, 0xA2, 0x6A, 0xF5, 0x64, 0x7C, 0xD7, 0x86, 0xE6, 0xF0, 0x58, 0x90, 0x59, 0x60,
+        0xCB, 0xCE, 0xF9, 0xB9, 0x5C, 0x17, 0x3B, 0x83, 0x9D, 0x02, 0x6D, 0x07, 0xB2, 0x02, 0x04, 0x28,
+        0x10, 0x5D, 0x87, 0xF4, 0x7D, 0xE1, 0xF1, 0x41, 0x43, 0x84, 0x06, 0x3B, 0x1E, 0xE7, 0xB3, 0x73,
+        0xAA, 0xDA, 0x0E, 0xE7, 0x4A, 0xD6, 0x6E, 0xCB, 0x73, 0xED, 0x00, 0x60, 0x0E, 0x00, 0x80, 0x2F,
+        0x19, 0xFE, 0x60, 0x7F, 0x54, 0xD8, 0x70, 0x92, 0x10, 0x0A, 0x34, 0x81, 0x98, 0x1D, 0x00, 0xC0,
+        0x08, 0x01, 0x93, 0x72, 0x37, 0xAC, 0xCA, 0x99, 0x8D, 0xC1, 0xB1, 0xA3, 0xB2, 0xD4, 0xE9, 0x6C,
+        0x3E, 0x8E, 0x1E, 0xF1, 0xE8, 0x3B, 0xCE, 0xA3, 0x46, 0x3A, 0x16, 0xC6, 0x76, 0x77, 0x97, 0x49,
+        0x15, 0xBD, 0x58, 0x33, 0x4E, 0xE0, 0x32, 0x2C, 0xEE, 0x52, 0xB7, 0x9A, 0x52, 0xC1, 0x5B, 0x1E,
+        0xF9, 0xB3, 0x66, 0xC4, 0xA5, 0x12, 0x55, 0xD1, 0x77, 0x87, 0xBE, 0x23, 0xF7, 0xD6, 0x23, 0x5F,
+        0xFF, 0x6D, 0xCF, 0xEB, 0x18, 0xF8, 0x55, 0x06, 0x72, 0x00, 0xD0, 0x03, 0x80, 0x30, 0x00, 0x60,
+        0x13, 0x00, 0x50, 0x03, 0x40, 0x04, 0x00, 0x50, 0x04, 0x00, 0x44, 0x85, 0x77, 0x07, 0x31, 0x32,
+        0xD3, 0x73, 0x1C, 0x94, 0x48, 0x91, 0x94, 0xE6, 0xB6, 0x2D, 0x0B, 0x26, 0xAC, 0x36, 0x5C, 0x6D,
+        0x5D, 0x59, 0x91, 0x9A, 0x7B, 0xE7, 0xB3, 0x55, 0xD1, 0xD8, 0x4E, 0xEB, 0x35, 0xB8, 0xCD, 0x5D,
+        0x77, 0x8C, 0xD6, 0x68, 0x02, 0x00, 0x70, 0x02, 0x00, 0x80, 0x28, 0x18, 0x2A, 0x3E, 0x11, 0x7E,
+        0x25, 0x4D, 0xAE, 0x03, 0x2F, 0x42, 0x7B, 0x20, 0xF1, 0x7F, 0x22, 0xC7, 0xE1, 0x99, 0x65, 0x53,
+        0x92, 0x71, 0x7D, 0xB9, 0x18, 0xE8, 0xB8, 0xA0, 0x80, 0x78, 0x50, 0x60, 0x78, 0x10, 0xF6, 0xCA,
+        0xD6, 0xB4, 0xA5, 0x91, 0x68, 0x59, 0x1F, 0x05, 0xC0, 0x97, 0x8B, 0xF1, 0x58, 0x35, 0x54, 0x3C,
+        0x67, 0x81, 0x15, 0xC6, 0x6F, 0x97, 0x9F, 0xD5, 0x56, 0x1C, 0xA4, 0x5C, 0x03, 0x8D, 0xA0, 0x5E,
+        0x06, 0x40, 0x60, 0x04, 0x00, 0x20, 0x14, 0x06, 0x00, 0xB0, 0x0C, 0x2D, 0xCB, 0x9D, 0x93, 0xBE,
+        0x3B, 0x2C, 0x46, 0xE1, 0xD8, 0xAC, 0xA1, 0x4B, 0x06, 0x5D, 0xC2, 0xB3, 0x79, 0xD6, 0x4D, 0x84,
+        0xDA, 0x21, 0xA3, 0x7C, 0x73, 0x0E, 0x24, 0x92, 0x6A, 0xE0, 0xCD, 0x5A, 0x17, 0x56, 0x80, 0xD1,
+        0xA3, 0x2E, 0xF3, 0x5E, 0x75, 0x05, 0x03, 0xDF, 0x9E, 0xB3, 0x3A, 0x5C, 0xDC, 0xC0, 0x02, 0x80,
+        0x14, 0x01, 0x80, 0x07, 0x00, 0x48, 0x03, 0x00, 0x0E, 0x00, 0xB0, 0x07, 0x00, 0x00, 0x02, 0x60,
+        0x06, 0x46, 0x9F, 0xFE, 0xDB, 0x9F, 0xD6, 0x35, 0xF0, 0xA7, 0x2F, 0xFF, 0xFF, 0xFD, 0x53, 0x43,
+        0x10, 0x32, 0xC1, 0x08, 0x90, 0x02, 0x2C, 0x11, 0x0B, 0x04, 0x94, 0xCA, 0x97, 0x78, 0xCB, 0x07,
+        0x75, 0x24, 0xA4, 0x8B, 0x25, 0xC7, 0x70, 0xDB, 0xAE, 0xE0, 0x9B, 0x56, 0x2D, 0x36, 0xAC, 0xB8,
+        0xDD, 0x17, 0x34, 0x59, 0xB5, 0x20, 0xCA, 0xB0, 0xB2, 0x32, 0xD1, 0xD4, 0x76, 0x6A, 0x6C, 0x1D,
+        0x29, 0x77, 0x9E, 0x80, 0x02, 0xBB, 0x38, 0x7F, 0xF8, 0x5E, 0x7F, 0xFD, 0xAA, 0x40, 0x00, 0x01,
+        0x00, 0x0C, 0x00, 0x80, 0x04, 0x00, 0x00, 0x10, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x16, 0x57, 0xAD, 0x2C, 0x52, 0x01, 0x00, 0x00, 0x00, 0x06, 0x02, 0x00, 0x7E, 0xBF, 0xFE,
+        0x8E, 0xFF, 0xDC, 0xAE, 0x27, 0x5D, 0x10, 0x14, 0xA4, 0x09, 0x41, 0x30, 0x20, 0x65, 0x85, 0xC2,
+        0x92, 0xCC, 0xD2, 0x05, 0xEE, 0x0B, 0xD2, 0xCB, 0x07, 0x7F, 0xBA, 0xC0, 0x07, 0x83, 0x9A, 0x61,
+        0x7A, 0x5E, 0x83, 0x4D, 0x7B, 0xB0, 0x33, 0x83, 0xF4, 0xB3, 0xDD, 0xAC, 0x33, 0x00, 0x02, 0x00,
+        0x40, 0x01, 0x80, 0x08, 0x00, 0x80, 0x03, 0x00, 0x10, 0x00, 0x40, 0x0C, 0x00, 0x50, 0x03, 0x7F,
+        0xF7, 0xB1, 0xFF, 0xEA, 0xC6, 0xA8, 0x00, 0x1D, 0xC0, 0x8B, 0x6C, 0x9E, 0x16, 0xCE, 0xA6, 0x8E,
+        0x4E, 0x3E, 0x0D, 0xDB, 0xB5, 0xEB, 0x52, 0xA9, 0x32, 0x75, 0x59, 0x45, 0x73, 0x4D, 0x34, 0x32,
+        0x43, 0x18, 0x47, 0x38, 0x9B, 0x5D, 0x3E, 0xA9, 0x7E, 0xFB, 0xEF, 0x9B, 0xCC, 0xDB, 0x6E, 0x58,
+        0x72, 0x39, 0xEE, 0x3B, 0x11, 0xA4, 0xA0, 0x05, 0x0E, 0xC8, 0xDF, 0x7A, 0x0B, 0x95, 0xC2, 0x91,
+        0x64, 0x5C, 0x0E, 0x02, 0xCE, 0xDA, 0x61, 0xA6, 0x6E, 0x17, 0x04, 0x06, 0x36, 0x00, 0x80, 0x06,
+        0x00, 0x00, 0x04, 0x00, 0x20, 0x04, 0x00, 0x20, 0x02, 0x00, 0x40, 0x04, 0x00, 0x20, 0x03, 0xFF,
+        0xF6, 0xA3, 0x00, 0x1F, 0xFF, 0xB5, 0x40, 0x00, 0x86, 0x5A, 0x7B, 0x8B, 0x6E, 0xC1, 0x47, 0x19,
+        0x72, 0xC0, 0xBC, 0x6C, 0x80, 0x80, 0x1F, 0xB0, 0x3F, 0xA3, 0x3F, 0xF7, 0x23, 0x89, 0xD7, 0x3C,
+        0x09, 0x29, 0x82, 0x70, 0x44, 0x0A, 0x00, 0x00, 0x10, 0x04, 0x02, 0x0E, 0xDA, 0x76, 0x6E, 0xDB,
+        0x80, 0xC4, 0x71, 0x63, 0x94, 0x92, 0xC1, 0x1C, 0xB2, 0x2E, 0x21, 0x94, 0x81, 0x7B, 0x9B, 0x76,
+        0x69, 0xAD, 0x09, 0x9B, 0xCB, 0x85, 0xC6, 0x5C, 0x08, 0x1D, 0xB5, 0xEE, 0xC1, 0xAF, 0x4C, 0x00,
+        0x10, 0x00, 0x40, 0x08, 0x00, 0x30, 0x03, 0x00, 0x14, 0x00, 0x9F, 0xFD, 0xEC, 0x3F, 0xFA, 0xB2,
+        0x29, 0xFE, 0x07, 0x60, 0x22, 0xC1, 0x22, 0x08, 0x10, 0x3B, 0x81, 0xA5, 0x78, 0x3A, 0xF9, 0xB8,
+        0x76, 0xED, 0xD1, 0x93, 0x2D, 0xF8, 0x2D, 0xAE, 0xAA, 0xA6, 0xA3, 0x5A, 0x71, 0x8C, 0x48, 0xAB,
+        0xF1, 0x7D, 0x9F, 0xC7, 0xFC, 0x76, 0xBD, 0xED, 0x1E, 0xFB, 0xDD, 0x7A, 0xE9, 0xD9, 0xD1, 0x10,
+        0xFB, 0x52, 0x51, 0x59, 0xC3, 0x9B, 0x27, 0x7C, 0xA5, 0xC4, 0x19, 0x47, 0x0A, 0xF2, 0xB8, 0xB0,
+        0x10, 0x0B, 0xD5, 0x95, 0xB4, 0xB0, 0x11, 0x9D, 0xEE, 0xF7, 0x6B, 0x10, 0x35, 0x7A, 0x00, 0x03,
+        0x70, 0x2F, 0xFF, 0xF6, 0x6F, 0xFF, 0xF6, 0xD0, 0x40, 0x70, 0x00, 0x30, 0x40, 0x90, 0x40, 0x90,
+        0x60, 0x90, 0x60, 0x90, 0x01, 0x9B, 0x3B, 0x16, 0x7B, 0xC7, 0x63, 0x3A, 0x3C, 0x56, 0x21, 0x2C,
+        0x09, 0x34, 0x96, 0x24, 0x63, 0x3D, 0x5E, 0x27, 0x17, 0xD3, 0x7A, 0x25, 0x7D, 0x4C, 0x25, 0x4E,
+        0x14, 0x0A, 0xBF, 0x05, 0x78, 0x30, 0xA1, 0xE0, 0x08, 0x50, 0xD5, 0x14, 0x5E, 0x9E, 0x2E, 0x84,
+        0x29, 0x84, 0xF8, 0xD9, 0x44, 0x12, 0x21, 0xA3, 0x1B, 0xF1, 0xDE, 0x08, 0x2B, 0xD6, 0x4E, 0x2C,
+        0x0B, 0xD6, 0xE2, 0x71, 0xDE, 0x8A, 0xC3, 0x43, 0x30, 0xE3, 0x9D, 0x65, 0x34, 0x4A, 0xF1, 0xBA,
+        0x90, 0x41, 0x22, 0x68, 0xDD, 0x14, 0xD4, 0xBD, 0x66, 0xA5, 0x22, 0x8A, 0x74, 0x53, 0x48, 0xCF,
+        0x52, 0x12, 0x0A, 0xAF, 0x44, 0xA1, 0xD2, 0x87, 0x14, 0xF0, 0x9E, 0x1E, 0x01, 0x0A, 0x8B, 0xE9,
+        0x8E, 0x33, 0xA7, 0xC6, 0x74, 0x09, 0x52, 0x38, 0x98, 0x58, 0xCD, 0x27, 0xA6, 0x11, 0x11, 0x89,
+        0x09, 0x5E, 0xB3, 0xAC, 0xEB, 0x9E, 0x32, 0x49, 0x4D, 0x66, 0xB3, 0xAC, 0xA9, 0x42, 0x53, 0x1D,
+        0x85, 0xD9, 0x4B, 0x53, 0x72, 0xFA, 0x50, 0x73, 0xC7, 0x70, 0x2D, 0x1B, 0xAB, 0x52, 0x09, 0x49,
+        0x46, 0x51, 0x53, 0x59, 0x58, 0xE6, 0x89, 0x4D, 0x4C, 0x14, 0xE9, 0xC4, 0xE9, 0xBD, 0x13, 0x49,
+        0x3A, 0x15, 0x7A, 0x44, 0xF1, 0x28, 0xB0, 0xF5, 0x9E, 0x03, 0xEB, 0x3A, 0x08, 0x6B, 0x3A, 0x2A,
+        0xCF, 0x0E, 0xA1, 0xE2, 0x70, 0x68, 0x1C, 0x32, 0x42, 0x80, 0x2A, 0xA6, 0x89, 0x58, 0xE7, 0x44,
+        0xB3, 0xAC, 0xEB, 0x35, 0x38, 0x92, 0x50, 0x24, 0x51, 0x73, 0xD3, 0x9E, 0x99, 0xD9, 0xA0, 0x34,
+        0xB9, 0xF6, 0x66, 0xD2, 0xE6, 0xDC, 0xD2, 0x8D, 0xEA, 0xC0, 0xBC, 0x4A, 0x2D, 0xEA, 0xC0, 0x80,
+        0xCB, 0x97, 0x9B, 0xE7, 0x71, 0x9E, 0x16, 0x68, 0xC2, 0x7A, 0xCF, 0x13, 0x0A, 0x1D, 0x01, 0x98,
+        0x1E, 0x6F, 0xCB, 0xC7, 0x38, 0xCC, 0x07, 0x31, 0x99, 0x26, 0x33, 0x23, 0xE5, 0xE0, 0xDC, 0xE7,
+        0x7C, 0x8B, 0xC1, 0x92, 0x6E, 0x09, 0x2F, 0x3B, 0x8C, 0x59, 0xB9, 0x3D, 0x83, 0x17, 0x62, 0xCE,
+        0xC7, 0x5F, 0x3F, 0xBC, 0x26, 0xD6, 0x71, 0xB8, 0xB0, 0x03, 0xBF, 0xBA, 0x67, 0xF2, 0xD3, 0xE9,
+        0x1B, 0xF9, 0xFB, 0x65, 0x5F, 0x36, 0x47, 0xE5, 0x5C, 0x44, 0x41, 0x31, 0xC2, 0x43, 0x1A, 0x21,
+        0x21, 0x0B, 0xE0, 0x77, 0x04, 0x02, 0xF9, 0x4E, 0x14, 0xC1, 0x70, 0x9B, 0xC6, 0x78, 0x3B, 0xE0,
+        0xAA, 0x10, 0x78, 0x45, 0x96, 0x53, 0x94, 0x50, 0xD9, 0xC8, 0x04, 0x8E, 0x57, 0xCA, 0xA8, 0x30,
+        0xBF, 0x45, 0x9B, 0xDE, 0xEA, 0x7E, 0xFA, 0x87, 0x90, 0x4A, 0x4A, 0xA4, 0x59, 0x45, 0x98, 0x2A,
+        0x04, 0x82, 0x87, 0x67, 0xFF, 0x84, 0x5F, 0xFD, 0xDA, 0xE8, 0x49, 0x86, 0x00, 0x10, 0x8A, 0xCF,
+        0xAF, 0x3C, 0x16, 0x28, 0xBA, 0x0C, 0x1A, 0x0A, 0x2A, 0x08, 0x42, 0xB9, 0x54, 0x2D, 0x7C, 0x26,
+        0xA1, 0x10, 0x38, 0x42, 0x0E, 0x60, 0x23, 0x88, 0x53, 0xF8, 0xDD, 0x7F, 0xC0, 0xFF, 0x7F, 0x03,
+        0x34, 0x22, 0xF1, 0x74, 0x0E, 0xCC, 0x83, 0x81, 0xDE, 0xFD, 0x95, 0x5F, 0xFE, 0x5A, 0x9D, 0x9F,
+        0x5C, 0x81, 0x11, 0x5F, 0xAD, 0xB8, 0xFC, 0xE5, 0xBC, 0x21, 0x88, 0xC6, 0x1B, 0xFE, 0x2F, 0xF5,
+        0xDE, 0x9F, 0x80, 0xB7, 0x88, 0x3E, 0x20, 0x18, 0x80, 0xA1, 0x00, 0x82, 0x00, 0x0C, 0xAA, 0x33,
+        0x18, 0xE7, 0xAC, 0xD0, 0x31, 0x2B, 0x16, 0x48, 0x43, 0x08, 0x56, 0xF8, 0xDE, 0x8A, 0xBD, 0x28,
+        0xE3, 0x02, 0x32, 0x2D, 0x43, 0xEF, 0x72, 0xBF, 0x5C, 0xE2, 0x46, 0x1C, 0xC3, 0x51, 0xC9, 0x20,
+        0x80, 0xD9, 0x16, 0xA7, 0xD5, 0xFF, 0xB4, 0xBF, 0xFD, 0x57, 0xC0, 0x5D, 0xF0, 0x54, 0xD5, 0xE2,
+        0x60, 0x80, 0xAF, 0xA2, 0xEF, 0x89, 0x30, 0x63, 0x38, 0x56, 0xA1, 0xC5, 0x90, 0xE3, 0xBF, 0x1B,
+        0x0A, 0x19, 0x18, 0xE7, 0x05, 0x60, 0x01, 0x00, 0x3A, 0x04, 0x60, 0x3E, 0x83, 0x28, 0x25, 0x61,
+        0xA0, 0x11, 0x68, 0xB7, 0x07, 0x4A, 0x41, 0x20, 0xED, 0x7E, 0xCB, 0x2F, 0xFF, 0x2D, 0x4E, 0xCF,
+        0x2E, 0x40, 0xA9, 0xFF, 0x97, 0xFF, 0x5B, 0x3B, 0xC7, 0xB8, 0x18, 0x8F, 0x4A, 0xA2, 0x6B, 0x48,
+        0x90, 0x98, 0x43, 0xD8, 0x84, 0x0C, 0x80, 0xC0, 0x10, 0x0A, 0x42, 0x9B, 0x85, 0x35, 0x78, 0x9A,
+        0xDF, 0x8E, 0x51, 0x42, 0xBC, 0x67, 0x04, 0xC5, 0xE1, 0x9C, 0x73, 0xE1, 0x4B, 0x08, 0x40, 0xC3,
+        0x41, 0x34, 0x93, 0x59, 0x56, 0x20, 0xF5, 0xBA, 0x5F, 0xB6, 0x7A, 0x6B, 0x93, 0x89, 0x22, 0x90,
+        0xC2, 0x32, 0x9E, 0x9E, 0x2B, 0x53, 0xF1, 0xCA, 0xFA, 0xD1, 0x5A, 0x2C, 0x00, 0x81, 0x10, 0x21,
+        0xCA, 0x35, 0x03, 0x9D, 0x26, 0xC0, 0x0D, 0x3A, 0x4F, 0x0A, 0xA4, 0xAF, 0x41, 0x6F, 0x0A, 0x63,
+        0x9B, 0x91, 0x7C, 0xEB, 0x83, 0x02, 0x83, 0x03, 0x07, 0x85, 0x03, 0x0A, 0x9B, 0x36, 0xCF, 0xB2,
+        0x3E, 0x51, 0xE8, 0x7F, 0x78, 0xFE, 0x6B, 0x84, 0x14, 0x0E, 0xF7, 0xEC, 0xB2, 0xFF, 0xF2, 0xD5,
+        0xEC, 0xF8, 0xE4, 0x06, 0x8A, 0xED, 0x6C, 0x47, 0xCF, 0x2D, 0x61, 0x0C, 0xC6, 0x34, 0x23, 0xF0,
+        0xCE, 0x04, 0x84, 0x19, 0x09, 0xFD, 0xFE, 0xCC, 0x6A, 0x2A, 0x82, 0x12, 0x1D, 0x00, 0x2A, 0x9A,
+        0xC2, 0x8E, 0x78, 0x95, 0x59, 0x84, 0x1E, 0xA5, 0xD0, 0x31, 0x19, 0x4E, 0x02, 0x2D, 0x19, 0x1A,
+        0x57, 0x86, 0xF9, 0x22, 0xD9, 0x4F, 0xF4, 0x7E, 0xCF, 0xFF, 0x8D, 0x07, 0x20, 0x48, 0x10, 0x14,
+        0xC4, 0x51, 0xC0, 0x39, 0x97, 0x9F, 0x91, 0xF5, 0xC2, 0xFA, 0x92, 0x61, 0x22, 0x30, 0x62, 0x14,
+        0xD4, 0xE2, 0xC6, 0x2C, 0x23, 0x8C, 0x88, 0x45, 0x75, 0x7D, 0x6C, 0x40, 0xBD, 0x1B, 0x58, 0x96,
+        0x88, 0x4A, 0x06, 0x10, 0x21, 0xAA, 0x28, 0x82, 0x8A, 0xFC, 0x5F, 0xDB, 0x26, 0x52, 0x5A, 0xD6,
+        0x44, 0x19, 0xDD, 0x6B, 0xF0, 0x49, 0xDE, 0x02, 0xCF, 0xFE, 0xA4, 0xEF, 0xE4, 0x9D, 0xF9, 0x9D,
+        0x67, 0x44, 0x62, 0x69, 0xF8, 0x8B, 0x12, 0x41, 0x01, 0x86, 0x89, 0x50, 0x39, 0x21, 0x56, 0x07,
+        0xD8, 0x2F, 0x81, 0x1E, 0x06, 0x84, 0xF8, 0x7C, 0x5C, 0xBA, 0xB2, 0xE2, 0xC3, 0x65, 0x73, 0x3D,
+        0x4D, 0x40, 0xCA, 0x3C, 0xD0, 0x36, 0xE5, 0x6B, 0x34, 0x0A, 0x44, 0xE3, 0x9A, 0xCD, 0x6E, 0x1C,
+        0xA3, 0xBE, 0x92, 0xDF, 0xE0, 0xFF, 0xFC, 0x83, 0x22, 0x42, 0x30, 0x0C, 0x25, 0x18, 0x44, 0xB4,
+        0x32, 0xC0, 0x99, 0xBF, 0xFA, 0x7F, 0xFB, 0xF0, 0x4E, 0x85, 0x99, 0x60, 0x28, 0xD4, 0x01, 0xC3,
+        0x00, 0x92, 0x95, 0x42, 0x5F, 0xF1, 0x3F, 0x6A, 0x8B, 0x8A, 0x88, 0x49, 0x0D, 0xE3, 0x95, 0x36,
+        0xB2, 0x5C, 0x8D, 0xD7, 0x94, 0x42, 0xC0, 0x52, 0x8C, 0x23, 0x58, 0x0D, 0x87, 0x77, 0xC7, 0xFD,
+        0x5F, 0xFE, 0x9C, 0x08, 0x90, 0x5C, 0xC3, 0xB0, 0x25, 0x11, 0x23, 0x11, 0x4B, 0xFB, 0x79, 0xBE,
+        0xF1, 0x7D, 0x9D, 0x6D, 0x50, 0x3D, 0x49, 0x45, 0x87, 0x56, 0x2B, 0x21, 0x02, 0x85, 0xD9, 0x7F,
+        0xDB, 0xFC, 0x2F, 0x2F, 0x5A, 0xFB, 0xC8, 0x86, 0x08, 0x62, 0x8A, 0x01, 0x64, 0x26, 0x58, 0x9D,
+        0xAB, 0x5B, 0x13, 0x2A, 0xDC, 0xB2, 0x85, 0x16, 0xDF, 0xFF, 0xFF, 0x4E, 0xF2, 0x0C, 0xA1, 0x19,
+        0x46, 0x11, 0x94, 0x28, 0x31, 0x9C, 0xCF, 0x55, 0x3F, 0xBB, 0xFF, 0xF3, 0x2C, 0xC5, 0x28, 0x06,
+        0x74, 0x11, 0x40, 0xB3, 0x14, 0x09, 0x34, 0x33, 0x7F, 0xF0, 0xFF, 0xF6, 0xD1, 0x0A, 0x87, 0xF7,
+        0x34, 0xA6, 0xE7, 0xA1, 0xA6, 0x90, 0x7B, 0x1A, 0x34, 0xDE, 0x6D, 0xCD, 0x8A, 0x92, 0x82, 0xAB,
+        0x36, 0xE3, 0xF1, 0xA6, 0xC8, 0x97, 0x63, 0x0F, 0x2B, 0x67, 0x89, 0xA0, 0x34, 0x80, 0xD4, 0x03,
+        0x18, 0x0B, 0x00, 0x28, 0x80, 0xA8, 0x02, 0xF8, 0x10, 0xC0, 0x82, 0x85, 0x0C, 0x3E, 0xAF, 0x81,
+        0x25, 0xF8, 0x6F, 0x5F, 0xD7, 0x31, 0xD6, 0x79, 0x5D, 0x0A, 0x7F, 0x13, 0xFB, 0xC9, 0xB0, 0x38,
+        0x11, 0x42, 0x62, 0x93, 0x7E, 0xA8, 0x1F, 0x66, 0x21, 0x22, 0x33, 0x09, 0x21, 0xF0, 0x62, 0x19,
+        0x1F, 0xD7, 0xE5, 0xE7, 0xD2, 0xF9, 0x63, 0x81, 0xA2, 0xC0, 0x58, 0xD0, 0xAA, 0x6A, 0xAF, 0x02,
+        0x11, 0xC1, 0x14, 0x29, 0x00, 0x06, 0x1C, 0x88, 0x00, 0x82, 0xC2, 0xA9, 0xFF, 0xC1, 0xFF, 0xFC,
+        0xCB, 0x2E, 0x04, 0x28, 0xA0, 0x38, 0x9D, 0x28, 0x9F, 0x5B, 0x4B, 0x3F, 0xF8, 0x7F, 0xF8, 0x70,
+        0x25, 0x87, 0x70, 0x58, 0x52, 0x20, 0x82, 0x52, 0x8A, 0x60, 0xAB, 0x41, 0xFE, 0x67, 0xEF, 0x41,
+        0x70, 0x94, 0x0B, 0x48, 0x54, 0x87, 0x2E, 0x1E, 0xA3, 0x13, 0xAA, 0xA1, 0x51, 0x83, 0x54, 0xE0,
+        0x81, 0x00, 0x80, 0x00, 0xC0, 0xC1, 0x42, 0x67, 0x8B, 0x31, 0x2A, 0x1E, 0x2D, 0xB3, 0xF5, 0xEF,
+        0x43, 0xC1, 0x28, 0x11, 0x5B, 0xFB, 0x7C, 0x3E, 0xF0, 0x7D, 0x9D, 0xED, 0x60, 0x3C, 0xF9, 0x49,
+        0x07, 0x4E, 0x2B, 0xE1, 0x02, 0x86, 0x18, 0x22, 0x20, 0xC8, 0x03, 0xE8, 0x16, 0x0B, 0xFF, 0x7F,
+        0xA4, 0x34, 0xA0, 0x69, 0x46, 0x20, 0x69, 0xA3, 0x08, 0x03, 0x18, 0x88, 0x09, 0x8C, 0x03, 0x11,
+        0x99, 0x7F, 0xFF, 0xFC, 0x67, 0xEF, 0x46, 0x40, 0x80, 0xD0, 0x10, 0x91, 0x89, 0x11, 0x04, 0xA7,
+        0xFF, 0x37, 0xFF, 0xEA, 0x0B, 0x06, 0xA0, 0x18, 0x04, 0x12, 0x8A, 0x8C, 0x2B, 0x0A, 0xC3, 0xDD,
+        0xFF, 0xCF, 0xFF, 0xC7, 0x89, 0x24, 0x12, 0x8A, 0x61, 0x33, 0xCD, 0xF9, 0x73, 0x80, 0x73, 0x83,
+        0x0A, 0x88, 0xC1, 0xA9, 0xE2, 0x45, 0x01, 0x0F, 0x85, 0x2D, 0x05, 0x61, 0x47, 0xA5, 0x56, 0xE6,
+        0x0E, 0x96, 0xEF, 0x13, 0x83, 0xC2, 0xDD, 0xD8, 0xB0, 0x51, 0x05, 0x40, 0x5B, 0x08, 0x20, 0xFF,
+        0x28, 0x27, 0xD3, 0xFF, 0xFF, 0x09, 0x40, 0x02, 0xCF, 0xFF, 0x9A, 0x7B, 0xFF, 0x69, 0xEF, 0x28,
+        0xBB, 0x92, 0x8F, 0x1E, 0x4D, 0x41, 0xAF, 0x89, 0xE8, 0x3B, 0xA1, 0x6E, 0x08, 0x98, 0x33, 0x01,
+        0x32, 0x07, 0x40, 0x29, 0x81, 0x01, 0x38, 0xF4, 0x5B, 0x55, 0x35, 0x53, 0x33, 0x54, 0x95, 0x14,
+        0x45, 0x30, 0xCB, 0x06, 0x32, 0x77, 0x83, 0x18, 0x2E, 0x6F, 0x37, 0x9B, 0xCD, 0xE2, 0xC5, 0xF0,
+        0xE7, 0xFD, 0xBF, 0xFF, 0xF6, 0x32, 0x12, 0x12, 0x14, 0x56, 0x56, 0x34, 0x10, 0x4C, 0xD9, 0xBF,
+        0x87, 0xF8, 0x66, 0x6A, 0x92, 0x60, 0x99, 0x26, 0x40, 0x99, 0x2A, 0x4A, 0x92, 0xE9, 0xFF, 0xD1,
+        0xFE, 0xEA, 0x60, 0x7C, 0x0B, 0x0F, 0xF7, 0x06, 0x83, 0xDC, 0x20, 0x00, 0x01, 0x04, 0x00, 0x21,
+        0xD0, 0x06, 0xDD, 0xC7, 0xF0, 0x7F, 0x1D, 0x85, 0x30, 0x6F, 0x89, 0x10, 0xB3, 0x8B, 0x41, 0x56,
+        0x7F, 0xD5, 0x53, 0xF9, 0x33, 0xF3, 0x91, 0x81, 0x82, 0x59, 0x99, 0x51, 0x20, 0x8D, 0x30, 0x9D,
+        0x87, 0x72, 0x7F, 0xED, 0xFE, 0xCF, 0x97, 0x9A, 0xD8, 0x0A, 0x00, 0x00, 0x04, 0x18, 0x00, 0x00,
+        0x68, 0x3D, 0xC0, 0xF7, 0x18, 0x17, 0x1F, 0xFF, 0xFF, 0xF1, 0xEE, 0xC2, 0x42, 0x44, 0xAC, 0xAC,
+        0xA6, 0xCA, 0xCA, 0x4D, 0x5F, 0xF8, 0x7F, 0xFF, 0xC8, 0x59, 0x58, 0x44, 0x90, 0x20, 0x10, 0x8A,
+        0x23, 0x25, 0x49, 0x77, 0xED, 0xFD, 0xF2, 0x2C, 0x44, 0x2A, 0xEA, 0x52, 0x29, 0x33, 0x53, 0x52,
+        0x54, 0x49, 0xA2, 0x51, 0x45, 0x29, 0xFF, 0xFF, 0xFF, 0x49, 0x0A, 0xA4, 0xA9, 0xB1, 0x43, 0x14,
+        0xB5, 0x57, 0x8B, 0x4F, 0x07, 0x4F, 0x8B, 0x00, 0x82, 0x04, 0x20, 0x20, 0x80, 0xF8, 0x07, 0x20,
+        0x38, 0x01, 0xB8, 0x13, 0x81, 0x3E, 0x19, 0x02, 0x69, 0xFB, 0xC0, 0x3F, 0xA0, 0x2B, 0xFE, 0x7D,
+        0x7E, 0x51, 0x77, 0x23, 0x47, 0xF4, 0x7F, 0xB7, 0x39, 0x97, 0x3F, 0x5B, 0xF3, 0x54, 0x26, 0xD4,
+        0x4E, 0x9D, 0x0A, 0xE4, 0x01, 0x58, 0x90, 0x42, 0x1E, 0x4A, 0x6A, 0xA6, 0x66, 0xA9, 0xAE, 0x2F,
+        0xDE, 0x20, 0x04, 0x41, 0x10, 0xB1, 0x8C, 0x71, 0xDE, 0x4D, 0xE6, 0xF0, 0xD5, 0x95, 0x95, 0x84,
+        0x45, 0x96, 0x59, 0xFF, 0xCB, 0xFF, 0xFE, 0xC2, 0x31, 0x8C, 0x95, 0xE6, 0xF2, 0xC6, 0x28, 0xCF,
+        0xDF, 0xFB, 0x5C, 0x95, 0x24, 0xC2, 0x09, 0x50, 0x54, 0x25, 0x48, 0x95, 0x25, 0xD3, 0xFF, 0xA3,
+        0xFD, 0xD4, 0xC0, 0xF8, 0x16, 0x83, 0xA0, 0x62, 0x11, 0x00, 0x32, 0x99, 0xDF, 0x3A, 0xC2, 0x01,
+        0x80, 0x04, 0x14, 0x40, 0x01, 0xA7, 0x98, 0xC7, 0x5A, 0xE9, 0xB9, 0xDF, 0x45, 0xF4, 0xF6, 0x2D,
+        0x45, 0x51, 0xFF, 0x55, 0x8F, 0xE4, 0xD7, 0xCE, 0x3E, 0x06, 0x09, 0x66, 0x65, 0x44, 0x7E, 0x34,
+        0x82, 0x6E, 0x1C, 0xC1, 0x52, 0x0F, 0x80, 0xAA, 0x06, 0xC3, 0xFF, 0xFB, 0xFE, 0x68, 0x01, 0x94,
+        0x0C, 0xA1, 0x80, 0x01, 0x08, 0x00, 0x02, 0x18, 0x01, 0x6B, 0xFF, 0xFF, 0xFF, 0x12, 0xFD, 0xD1,
+        0x4A, 0x6A, 0x6A, 0x6A, 0x6A, 0x68, 0x9A, 0xCA, 0xBF, 0xE5, 0xFF, 0xFF, 0xA2, 0xB2, 0xB0, 0x89,
+        0x08, 0x10, 0xA0, 0x82, 0x64, 0xB1, 0x6C, 0xFD, 0x7F, 0xAD, 0x87, 0x31, 0xD4, 0x73, 0x0D, 0x8C,
+        0x63, 0x18, 0xC5, 0xE2, 0x2C, 0x63, 0x18, 0xC6, 0x31, 0xE2, 0x92, 0x51, 0xAB, 0x32, 0xD3, 0x70,
+        0xA4, 0xD0, 0xAB, 0x7B, 0x07, 0x0A, 0xED, 0x8B, 0x03, 0x50, 0x36, 0x03, 0x70, 0x4E, 0x09, 0xF1,
+        0x90, 0xFF, 0xEF, 0x79, 0xA9, 0x78, 0x02, 0xBF, 0xFF, 0x9C, 0x77, 0xF9, 0x43, 0xFE, 0x28, 0x35,
+        0x3C, 0x70, 0x34, 0x88, 0x32, 0xD2, 0x52, 0x1B, 0xB1, 0x54, 0x10, 0x30, 0xC0, 0x09, 0x90, 0x76,
+        0x05, 0x10, 0x36, 0x3F, 0x8F, 0x4E, 0x3A, 0x6F, 0xA5, 0xE1, 0x59, 0x38, 0x08, 0xBA, 0x15, 0xC4,
+        0xC8, 0x39, 0xC4, 0xBB, 0x2A, 0xDA, 0x1F, 0x5A, 0xE9, 0xE9, 0xA7, 0xA6, 0xDE, 0xF0, 0xF7, 0xFF,
+        0x2F, 0xFF, 0xF0, 0x8A, 0x9A, 0x3B, 0x8A, 0xB8, 0x29, 0xBA, 0x04, 0xE1, 0x4A, 0xBF, 0x7F, 0xED,
+        0x51, 0xC4, 0xB0, 0xB4, 0x8D, 0x12, 0x1C, 0x4B, 0x19, 0xC0, 0xB5, 0x5F, 0xFD, 0xDF, 0xDD, 0x96,
+        0x08, 0x48, 0x52, 0x9B, 0x36, 0x76, 0xB7, 0x1B, 0x17, 0x91, 0x2D, 0x0E, 0x03, 0x9C, 0x69, 0x43,
+        0x46, 0x73, 0x4B, 0x37, 0x2F, 0x93, 0xF4, 0xD8, 0x46, 0x06, 0x78, 0x83, 0x0A, 0x68, 0xA1, 0x14,
+        0x17, 0xFB, 0xE8, 0x7E, 0xCB, 0x3C, 0x65, 0x5E, 0x71, 0x18, 0x4B, 0x80, 0x85, 0xC6, 0x08, 0x49,
+        0xC3, 0x51, 0x3F, 0xF4, 0xFF, 0x07, 0xC7, 0xC5, 0x84, 0x85, 0x38, 0x12, 0x13, 0x89, 0x23, 0x39,
+        0x0D, 0xC6, 0xC5, 0xDB, 0x23, 0x91, 0x96, 0xB2, 0x85, 0x16, 0x1F, 0xFE, 0xDA, 0x46, 0x50, 0x15,
+        0x23, 0x0A, 0x42, 0x74, 0x1E, 0x22, 0x66, 0xA3, 0x7F, 0xDB, 0xFF, 0xFE, 0xDA, 0xA3, 0x8B, 0xB6,
+        0x28, 0x24, 0x91, 0x23, 0x38, 0x92, 0x48, 0x5D, 0xFA, 0xFF, 0x86, 0x04, 0x84, 0x7A, 0xF5, 0x7A,
+        0x3E, 0x95, 0xEB, 0x52, 0x92, 0x4C, 0x8D, 0xD4, 0xAD, 0x98, 0x79, 0x84, 0x2A, 0x21, 0x74, 0xAE,
+        0x5C, 0x16, 0xDD, 0x7D, 0x99, 0x74, 0x70, 0xF5, 0x60, 0x0E, 0xC0, 0x70, 0x03, 0x70, 0x19, 0x00,
+        0xD4, 0x06, 0x40, 0x37, 0x02, 0xA0, 0x26, 0xC2, 0xE0, 0x47, 0x5F, 0x4B, 0x87, 0xEF, 0x72, 0xFF,
+        0x68, 0xEF, 0x09, 0xFB, 0x50, 0x23, 0xF7, 0xEF, 0x9E, 0xB8, 0x8F, 0x27, 0x57, 0x72, 0x93, 0xF5,
+        0x84, 0x8D, 0x34, 0x13, 0x47, 0xC2, 0xF1, 0x60, 0x6C, 0x2C, 0x75, 0xB5, 0xF9, 0x63, 0x41, 0x41,
+        0x80, 0xC0, 0x51, 0x08, 0x96, 0xAF, 0x87, 0x18, 0x11, 0x08, 0x69, 0x50, 0x36, 0x40, 0xA0, 0xA3,
+        0x30, 0x32, 0x49, 0x7F, 0xB7, 0xFF, 0xFD, 0x84, 0xBC, 0x1A, 0x1C, 0x1E, 0x00, 0xD6, 0x9F, 0x07,
+        0xC5, 0xA4, 0x9F, 0x6F, 0xE3, 0x88, 0xF0, 0x00, 0xC6, 0x60, 0xD0, 0x06, 0x09, 0x88, 0x37, 0x1E,
+        0x47, 0xFF, 0x9B, 0xFC, 0xD0, 0xCC, 0x76, 0x05, 0x84, 0x20, 0x8B, 0x1C, 0x3A, 0xAD, 0x28, 0xA8,
+        0xD0, 0x8D, 0x2A, 0x61, 0x40, 0x82, 0x98, 0x0E, 0x28, 0x30, 0x53, 0xC8, 0xE2, 0x28, 0x73, 0x5C,
+        0x3F, 0x90, 0xF8, 0x3B, 0x14, 0xA2, 0x90, 0xFF, 0x7D, 0x8F, 0xD9, 0x2F, 0x8C, 0x4B, 0xC9, 0x22,
+        0x69, 0x78, 0x10, 0x98, 0xCA, 0x09, 0x18, 0x71, 0x04, 0xC8, 0x38, 0x01, 0xF8, 0x18, 0x17, 0x9F,
+        0x4F, 0x15, 0x43, 0x84, 0x7A, 0x18, 0x88, 0xA4, 0x31, 0x10, 0x40, 0x21, 0x00, 0x32, 0x80, 0x24,
+        0x32, 0x9F, 0xFD, 0xA5, 0xF3, 0x8A, 0x88, 0xAC, 0x0C, 0x60, 0x44, 0x68, 0xF4, 0x81, 0x62, 0x7C,
+        0xDF, 0xE8, 0x31, 0x84, 0xA1, 0x10, 0x0C, 0x02, 0x82, 0x8A, 0x12, 0x8F, 0x00, 0x62, 0xFC, 0xFF,
+        0x7C, 0xCB, 0x88, 0xAA, 0x30, 0x0B, 0x10, 0x95, 0x42, 0x88, 0x85, 0x54, 0x68, 0x97, 0x09, 0xF1,
+        0x38, 0x85, 0x06, 0x20, 0x51, 0xE9, 0x4B, 0x41, 0x37, 0x99, 0x69, 0x98, 0xD1, 0x68, 0x55, 0xB9,
+        0x6E, 0xE5, 0xDC, 0x2B, 0x03, 0x50, 0x32, 0x03, 0x30, 0x4E, 0x09, 0x71, 0x76, 0x47, 0xFF, 0xF8,
+        0xBB, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+
+    static const AKWFTableRef tables[count] PROGMEM = {
+        { data +      0, 600 },   //   0 AKWF_blended_0001
+        { data +    499, 600 },   //   1 AKWF_blended_0002
+        { data +   1059, 600 },   //   2 AKWF_blended_0003
+        { data +   1345, 600 },   //   3 AKWF_blended_0004
+        { data +   1836, 600 },   //   4 AKWF_blended_0005
+        { data +   2275, 600 },   //   5 AKWF_blended_0006
+        { data +   2844, 600 },   //   6 AKWF_blended_0007
+        { data +   3369, 600 },   //   7 AKWF_blended_0008
+        { data +   3774, 600 },   //   8 AKWF_blended_0009
+        { data +   4138, 600 },   //   9 AKWF_blended_0011
+        { data +   4586, 600 },   //  10 AKWF_blended_0012
+        { data +   5012, 600 },   //  11 AKWF_blended_0013
+        { data +   5544, 600 },   //  12 AKWF_blended_0014
+        { data +   5871, 600 },   //  13 AKWF_blended_0015
+        { data +   6143, 600 },   //  14 AKWF_blended_0016
+        { data +   6511, 600 },   //  15 AKWF_blended_0017
+        { data +   6901, 600 },   //  16 AKWF_blended_0018
+        { data +   7282, 600 },   //  17 AKWF_blended_0019
+        { data +   7667, 600 },   //  18 AKWF_blended_0021
+        { data +   7972, 600 },   //  19 AKWF_blended_0022
+        { data +   8300, 600 },   //  20 AKWF_blended_0024
+        { data +   8606, 600 },   //  21 AKWF_blended_0025
+        { data +   8906, 600 },   //  22 AKWF_blended_0026
+        { data +   9188, 600 },   //  23 AKWF_blended_0028
+        { data +   9589, 600 },   //  24 AKWF_blended_0029
+        { data +  10116, 600 },   //  25 AKWF_blended_0030
+        { data +  10660, 600 },   //  26 AKWF_blended_0031
+        { data +  11196, 600 },   //  27 AKWF_blended_0032
+        { data +  11740, 600 },   //  28 AKWF_blended_0033
+        { data +  12281, 600 },   //  29 AKWF_blended_0035
+        { data +  12707, 600 },   //  30 AKWF_blended_0036
+        { data +  13118, 600 },   //  31 AKWF_blended_0037
+        { data +  13556, 600 },   //  32 AKWF_blended_0038
+        { data +  13858, 600 },   //  33 AKWF_blended_0039
+        { data +  14372, 600 },   //  34 AKWF_blended_0041
+        { data +  14664, 600 },   //  35 AKWF_blended_0042
+        { data +  14955, 600 },   //  36 AKWF_blended_0044
+        { data +  15246, 600 },   //  37 AKWF_blended_0045
+        { data +  15444, 600 },   //  38 AKWF_blended_0046
+        { data +  15642, 600 },   //  39 AKWF_blended_0047
+        { data +  15849, 600 },   //  40 AKWF_blended_0048
+        { data +  16023, 600 },   //  41 AKWF_blended_0049
+        { data +  16230, 600 },   //  42 AKWF_blended_0050
+        { data +  16526, 600 },   //  43 AKWF_blended_0051
+        { data +  16810, 600 },   //  44 AKWF_blended_0052
+        { data +  17122, 600 },   //  45 AKWF_blended_0053
+        { data +  17447, 600 },   //  46 AKWF_blended_0054
+        { data +  17746, 600 },   //  47 AKWF_blended_0055
+        { data +  18028, 600 },   //  48 AKWF_blended_0056
+        { data +  18310, 600 },   //  49 AKWF_blended_0057
+        { data +  18714, 600 },   //  50 AKWF_blended_0058
+        { data +  19087, 600 },   //  51 AKWF_blended_0059
+        { data +  19484, 600 },   //  52 AKWF_blended_0060
+        { data +  19889, 600 },   //  53 AKWF_blended_0061
+        { data +  20298, 600 },   //  54 AKWF_blended_0062
+        { data +  20698, 600 },   //  55 AKWF_blended_0063
+        { data +  20984, 600 },   //  56 AKWF_blended_0064
+        { data +  21373, 600 },   //  57 AKWF_blended_0065
+        { data +  21675, 600 },   //  58 AKWF_blended_0066
+        { data +  22005, 600 },   //  59 AKWF_blended_0067
+        { data +  22309, 600 },   //  60 AKWF_blended_0068
+        { data +  22628, 600 },   //  61 AKWF_blended_0069
+        { data +  22966, 600 },   //  62 AKWF_blended_0070
+        { data +  23326, 600 },   //  63 AKWF_blended_0071
+        { data +  23677, 600 },   //  64 AKWF_blended_0072
+        { data +  24053, 600 },   //  65 AKWF_blended_0073
+        { data +  24425, 600 },   //  66 AKWF_blended_0074
+        { data +  24836, 600 },   //  67 AKWF_blended_0075
+        { data +  25215, 600 },   //  68 AKWF_blended_0076
+        { data +  25529, 600 },   //  69 AKWF_blended_0077
+        { data +  26039, 600 },   //  70 AKWF_blended_0078
+        { data +  26567, 600 },   //  71 AKWF_blended_0079
+        { data +  27046, 600 }    //  72 AKWF_blended_0080
+    };
+
+} // namespace AKWF_BwBlended
@@ -1,1304 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwBlended {
-
-    // AKWF_blended_0001 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0001[600] PROGMEM = {
-        11349, 22259, 18605, 21106, 19263, 20603, 19665, 20257, 19901, 20040, 20004, 19953, 
-        20009, 19932, 19951, 19897, 19963, 19951, 19924, 19909, 19880, 19864, 19835, 19814, 
-        19781, 19758, 19727, 19702, 19667, 19640, 19605, 19574, 19537, 19505, 19466, 19433, 
-        19392, 19356, 19315, 19278, 19232, 19193, 19149, 19106, 19060, 19015, 18967, 18922, 
-        18872, 18824, 18775, 18725, 18671, 18621, 18568, 18514, 18458, 18404, 18350, 18292, 
-        18234, 18176, 18118, 18058, 17996, 17936, 17876, 17812, 17750, 17686, 17622, 17557, 
-        17489, 17423, 17357, 17290, 17220, 17149, 17081, 17011, 16938, 16866, 16795, 16723, 
-        16646, 16572, 16497, 16423, 16344, 16268, 16189, 16110, 16029, 15949, 15870, 15789, 
-        15704, 15622, 15539, 15454, 15367, 15282, 15197, 15112, 15027, 14945, 14864, 14781, 
-        14700, 14622, 14543, 14469, 14390, 14315, 14243, 14170, 14094, 14025, 13955, 13887, 
-        13818, 13752, 13688, 13624, 13560, 13498, 13438, 13380, 13320, 13262, 13208, 13152, 
-        13098, 13046, 12997, 12947, 12897, 12850, 12806, 12758, 12715, 12672, 12632, 12593, 
-        12554, 12516, 12481, 12446, 12411, 12378, 12349, 12320, 12291, 12262, 12239, 12212, 
-        12187, 12166, 12148, 12127, 12108, 12090, 12077, 12061, 12048, 12034, 12028, 12015, 
-        12009, 12001, 11999, 11992, 11992, 11988, 11995, 11990, 11997, 11997, 12009, 12011, 
-        12024, 12030, 12046, 12055, 12073, 12082, 12106, 12119, 12144, 12158, 12189, 12208, 
-        12239, 12257, 12297, 12318, 12357, 12380, 12425, 12452, 12498, 12527, 12578, 12607, 
-        12659, 12690, 12744, 12771, 12827, 12854, 12912, 12937, 12994, 13019, 13079, 13104, 
-        13162, 13185, 13247, 13268, 13330, 13346, 13415, 13429, 13495, 13508, 13578, 13587, 
-        13659, 13663, 13740, 13742, 13818, 13814, 13899, 13889, 13976, 13959, 14054, 14030, 
-        14131, 14094, 14212, 14156, 14290, 14210, 14375, 14259, 14458, 14355, 12968, -1618, 
-        -12235, -9444, -8585, -8819, -8811, -8403, -8384, -8131, -8067, -7837, -7773, -7568, 
-        -7502, -7318, -7250, -7084, -7022, -6869, -6809, -6670, -6614, -6488, -6434, -6320, 
-        -6272, -6167, -6123, -6026, -5989, -5902, -5865, -5788, -5757, -5686, -5660, -5595, 
-        -5573, -5517, -5496, -5444, -5430, -5384, -5370, -5328, -5318, -5281, -5268, -5233, 
-        -5225, -5194, -5185, -5157, -5152, -5128, -5121, -5101, -5099, -5080, -5078, -5061, 
-        -5063, -5051, -5051, -5041, -5045, -5036, -5041, -5036, -5043, -5041, -5049, -5049, 
-        -5059, -5061, -5072, -5076, -5090, -5099, -5113, -5121, -5138, -5150, -5167, -5181, 
-        -5200, -5217, -5237, -5256, -5279, -5299, -5322, -5343, -5368, -5395, -5422, -5446, 
-        -5475, -5502, -5533, -5560, -5593, -5624, -5658, -5691, -5726, -5761, -5796, -5831, 
-        -5871, -5908, -5945, -5987, -6026, -6067, -6109, -6152, -6196, -6239, -6283, -6328, 
-        -6376, -6421, -6467, -6515, -6564, -6614, -6664, -6715, -6767, -6819, -6871, -6922, 
-        -6980, -7034, -7088, -7146, -7204, -7262, -7318, -7378, -7440, -7500, -7560, -7620, 
-        -7684, -7751, -7813, -7879, -7945, -8011, -8076, -8142, -8208, -8272, -8332, -8394, 
-        -8456, -8517, -8574, -8630, -8690, -8746, -8800, -8854, -8908, -8960, -9009, -9057, 
-        -9109, -9156, -9200, -9245, -9291, -9332, -9374, -9413, -9452, -9492, -9527, -9564, 
-        -9599, -9632, -9663, -9695, -9726, -9755, -9779, -9806, -9831, -9856, -9875, -9897, 
-        -9918, -9937, -9951, -9970, -9984, -9999, -10009, -10022, -10032, -10042, -10046, -10055, 
-        -10059, -10063, -10063, -10065, -10065, -10065, -10059, -10057, -10051, -10044, -10034, -10028, 
-        -10015, -10005, -9988, -9978, -9960, -9945, -9922, -9906, -9881, -9862, -9833, -9813, 
-        -9781, -9759, -9723, -9697, -9659, -9632, -9589, -9560, -9516, -9483, -9434, -9398, 
-        -9349, -9314, -9256, -9218, -9160, -9117, -9055, -9011, -8945, -8900, -8829, -8782, 
-        -8713, -8666, -8593, -8548, -8475, -8430, -8355, -8310, -8235, -8192, -8115, -8073, 
-        -7997, -7958, -7877, -7840, -7759, -7724, -7639, -7608, -7523, -7494, -7405, -7378, 
-        -7289, -7266, -7173, -7154, -7059, -7047, -6945, -6937, -6833, -6833, -6720, -6728, 
-        -6608, -6628, -6492, -6531, -6380, -6442, -6260, -6359, -6144, -6227, -7599, -22170, 
-        -32767, -29960, -29085, -29300, -29277, -28851, -28813, -28544, -28466, -28217, -28136, -27913, 
-        -27830, -27629, -27544, -27362, -27281, -27112, -27035, -26880, -26805, -26664, -26594, -26462, 
-        -26397, -26275, -26215, -26103, -26047, -25944, -25890, -25797, -25720, -25677, -25592, -25582, 
-        -25464, -25435, -25420, -25201, -25526, -24847, -25770, -24342, -26182, -23573, -27354, -17547 
-    };
-
-    // AKWF_blended_0002 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0002[600] PROGMEM = {
-        18208, 30913, 26729, 29672, 27594, 29191, 28164, 28900, 28554, 28763, 28792, 28785, 
-        28924, 28893, 28987, 28987, 29141, 29189, 29237, 29283, 29324, 29360, 29396, 29429, 
-        29465, 29499, 29535, 29566, 29603, 29631, 29667, 29696, 29732, 29761, 29795, 29824, 
-        29855, 29882, 29918, 29944, 29978, 30004, 30040, 30064, 30098, 30122, 30153, 30177, 
-        30211, 30233, 30266, 30288, 30322, 30343, 30377, 30396, 30432, 30451, 30488, 30504, 
-        30540, 30560, 30593, 30610, 30646, 30663, 30699, 30711, 30752, 30764, 30803, 30817, 
-        30856, 30865, 30906, 30916, 30954, 30964, 31007, 31014, 31058, 31062, 31108, 31113, 
-        31159, 31161, 31209, 31209, 31257, 31255, 31308, 31303, 31358, 31349, 31409, 31397, 
-        31457, 31442, 31507, 31490, 31555, 31536, 31606, 31582, 31656, 31625, 31707, 31668, 
-        31757, 31714, 31808, 31757, 31861, 31796, 31916, 31834, 31971, 31870, 32032, 31899, 
-        32101, 31919, 32185, 31907, 32323, 31789, 32767, 21892, 18780, 17936, 16500, 16041, 
-        15031, 14555, 13684, 13213, 12462, 12012, 11334, 10901, 10278, 9865, 9295, 8900, 
-        8371, 7999, 7508, 7157, 6697, 6366, 5940, 5630, 5228, 4935, 4564, 4290, 
-        3941, 3682, 3357, 3114, 2811, 2582, 2299, 2085, 1820, 1618, 1373, 1183, 
-        952, 776, 560, 394, 194, 40, -146, -291, -468, -601, -764, -889, 
-        -1041, -1156, -1301, -1406, -1536, -1640, -1762, -1854, -1969, -2053, -2159, -2239, 
-        -2335, -2407, -2496, -2566, -2647, -2710, -2784, -2840, -2910, -2960, -3023, -3068, 
-        -3126, -3169, -3217, -3258, -3304, -3338, -3379, -3407, -3443, -3470, -3501, -3525, 
-        -3552, -3571, -3595, -3612, -3631, -3645, -3660, -3670, -3682, -3691, -3701, -3703, 
-        -3710, -3710, -3715, -3713, -3710, -3708, -3706, -3701, -3696, -3686, -3679, -3670, 
-        -3660, -3645, -3633, -3621, -3605, -3590, -3571, -3552, -3532, -3513, -3492, -3470, 
-        -3446, -3422, -3395, -3371, -3342, -3314, -3287, -3253, -3225, -3193, -3157, -3126, 
-        -3092, -3056, -3020, -2982, -2946, -2907, -2866, -2825, -2782, -2741, -2688, -2635, 
-        -2578, -2518, -2465, -2404, -2344, -2282, -2222, -2162, -2099, -2037, -1974, -1911, 
-        -1847, -1782, -1719, -1652, -1584, -1519, -1452, -1387, -1320, -1253, -1183, -1115, 
-        -1048, -978, -909, -839, -769, -699, -630, -557, -488, -416, -346, -274, 
-        -202, -129, -57, 14, 88, 163, 235, 303, 367, 428, 488, 548, 
-        606, 666, 726, 781, 841, 892, 952, 1007, 1065, 1118, 1178, 1228, 
-        1286, 1337, 1394, 1445, 1503, 1553, 1611, 1661, 1717, 1762, 1820, 1868, 
-        1923, 1972, 2027, 2073, 2133, 2176, 2234, 2277, 2337, 2378, 2436, 2477, 
-        2539, 2578, 2638, 2676, 2739, 2775, 2835, 2871, 2936, 2970, 3035, 3068, 
-        3131, 3164, 3229, 3261, 3323, 3357, 3422, 3451, 3520, 3547, 3614, 3643, 
-        3710, 3737, 3809, 3828, 3900, 3922, 3999, 4016, 4093, 4107, 4189, 4201, 
-        4283, 4292, 4379, 4384, 4473, 4475, 4569, 4567, 4663, 4656, 4757, 4745, 
-        4853, 4834, 4951, 4923, 5048, 5007, 5146, 5088, 5247, 5170, 5353, 5242, 
-        5466, 5307, 5596, 5339, 5776, 5266, 6267, -4586, -7676, -8496, -9913, -10348, 
-        -11334, -11791, -12640, -13087, -13819, -14247, -14903, -15312, -15913, -16303, -16854, -17226, 
-        -17734, -18083, -18554, -18881, -19321, -19629, -20033, -20324, -20702, -20973, -21325, -21577, 
-        -21902, -22140, -22443, -22667, -22948, -23155, -23417, -23609, -23852, -24033, -24259, -24425, 
-        -24634, -24790, -24985, -25129, -25307, -25442, -25608, -25730, -25884, -25995, -26139, -26243, 
-        -26373, -26469, -26589, -26676, -26784, -26866, -26967, -27039, -27130, -27198, -27279, -27337, 
-        -27414, -27467, -27534, -27582, -27645, -27683, -27736, -27775, -27820, -27852, -27893, -27919, 
-        -27955, -27977, -28006, -28022, -28051, -28063, -28085, -28092, -28109, -28114, -28123, -28126, 
-        -28133, -28133, -28135, -28133, -28131, -28123, -28119, -28109, -28099, -28087, -28075, -28061, 
-        -28047, -28027, -28010, -27989, -27967, -27945, -27919, -27895, -27871, -27842, -27813, -27782, 
-        -27753, -27719, -27686, -27654, -27618, -27582, -27544, -27505, -27467, -27426, -27385, -27342, 
-        -27301, -27255, -27207, -27164, -27116, -27068, -27020, -26969, -26919, -26868, -26815, -26760, 
-        -26707, -26654, -26596, -26539, -26483, -26423, -26365, -26305, -26240, -26180, -26108, -26034, 
-        -25957, -25880, -25803, -25726, -25646, -25565, -25485, -25403, -25290, -25257, -25129, -25127, 
-        -24954, -24922, -24867, -24603, -24930, -24129, -25148, -23472, -25557, -22503, -26839, -15420 
-    };
-
-    // AKWF_blended_0003 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0003[600] PROGMEM = {
-        25, 51, 79, 105, 133, 162, 187, 216, 244, 270, 298, 326, 
-        355, 383, 411, 440, 468, 499, 527, 555, 586, 615, 645, 676, 
-        707, 735, 769, 800, 831, 862, 895, 928, 959, 993, 1026, 1062, 
-        1096, 1129, 1165, 1201, 1235, 1271, 1309, 1345, 1384, 1420, 1459, 1497, 
-        1536, 1577, 1616, 1657, 1698, 1739, 1780, 1821, 1865, 1909, 1953, 1996, 
-        2043, 2089, 2135, 2182, 2228, 2277, 2326, 2375, 2424, 2472, 2524, 2575, 
-        2627, 2681, 2732, 2786, 2843, 2897, 2954, 3010, 3067, 3123, 3183, 3242, 
-        3301, 3363, 3425, 3486, 3548, 3612, 3677, 3741, 3805, 3872, 3939, 4009, 
-        4076, 4145, 4215, 4287, 4359, 4431, 4503, 4577, 4652, 4727, 4804, 4881, 
-        4958, 5038, 5118, 5198, 5280, 5360, 5442, 5527, 5612, 5697, 5782, 5869, 
-        5957, 6047, 6134, 6224, 6317, 6410, 6500, 6595, 6687, 6785, 6880, 6978, 
-        7076, 7174, 7274, 7374, 7475, 7578, 7681, 7784, 7889, 7995, 8103, 8208, 
-        8316, 8424, 8535, 8646, 8759, 8870, 8983, 9099, 9214, 9330, 9446, 9564, 
-        9683, 9801, 9922, 10043, 10166, 10287, 10411, 10537, 10663, 10789, 10915, 11044, 
-        11173, 11301, 11433, 11564, 11695, 11829, 11963, 12096, 12233, 12369, 12506, 12645, 
-        12783, 12922, 13064, 13203, 13344, 13489, 13630, 13777, 13921, 14068, 14214, 14361, 
-        14510, 14657, 14809, 14958, 15110, 15262, 15413, 15568, 15722, 15877, 16031, 16188, 
-        16345, 16504, 16661, 16821, 16981, 17140, 17302, 17464, 17626, 17789, 17953, 18118, 
-        18283, 18447, 18615, 18782, 18949, 19116, 19286, 19456, 19626, 19796, 19968, 20140, 
-        20313, 20485, 20658, 20833, 21008, 21183, 21358, 21533, 21710, 21888, 22065, 22243, 
-        22420, 22601, 22781, 22961, 23141, 23321, 23504, 23684, 23867, 24049, 24232, 24415, 
-        24597, 24783, 24968, 25153, 25338, 25521, 25709, 25894, 26082, 26267, 26455, 26643, 
-        26831, 27019, 27207, 27395, 27585, 27773, 27961, 28151, 28341, 28532, 28720, 28910, 
-        29101, 29291, 29481, 29674, 29865, 30055, 30248, 30439, 30629, 30822, 31013, 31206, 
-        31396, 31589, 31782, 31972, 32165, 32356, 32549, 32742, -32767, -32577, -32384, -32191, 
-        -32001, -31808, -31617, -31424, -31231, -31041, -30850, -30657, -30467, -30274, -30084, -29893, 
-        -29700, -29510, -29319, -29129, -28941, -28751, -28560, -28370, -28182, -27992, -27801, -27613, 
-        -27425, -27238, -27050, -26862, -26674, -26486, -26301, -26113, -25928, -25742, -25557, -25372, 
-        -25187, -25001, -24819, -24633, -24451, -24268, -24085, -23903, -23722, -23540, -23360, -23180, 
-        -22999, -22819, -22642, -22462, -22284, -22106, -21929, -21754, -21576, -21401, -21226, -21051, 
-        -20876, -20704, -20532, -20359, -20187, -20017, -19845, -19675, -19505, -19338, -19168, -19001, 
-        -18833, -18669, -18501, -18337, -18172, -18010, -17845, -17683, -17521, -17359, -17199, -17040, 
-        -16880, -16721, -16564, -16407, -16250, -16095, -15941, -15787, -15635, -15480, -15328, -15177, 
-        -15027, -14876, -14729, -14580, -14433, -14286, -14140, -13996, -13851, -13707, -13563, -13422, 
-        -13280, -13141, -13002, -12863, -12724, -12588, -12452, -12315, -12181, -12048, -11914, -11782, 
-        -11651, -11520, -11391, -11263, -11134, -11008, -10882, -10756, -10632, -10506, -10385, -10262, 
-        -10141, -10020, -9901, -9783, -9665, -9549, -9433, -9317, -9204, -9091, -8978, -8864, 
-        -8754, -8646, -8535, -8427, -8319, -8213, -8108, -8002, -7899, -7797, -7694, -7593, 
-        -7493, -7393, -7295, -7197, -7099, -7004, -6909, -6814, -6718, -6626, -6536, -6446, 
-        -6355, -6265, -6175, -6088, -6003, -5915, -5831, -5746, -5663, -5581, -5496, -5416, 
-        -5336, -5257, -5177, -5100, -5023, -4948, -4871, -4796, -4721, -4649, -4577, -4505, 
-        -4433, -4364, -4294, -4227, -4158, -4091, -4027, -3960, -3895, -3831, -3767, -3705, 
-        -3643, -3581, -3520, -3461, -3401, -3342, -3286, -3229, -3172, -3116, -3059, -3005, 
-        -2951, -2900, -2846, -2794, -2743, -2691, -2642, -2591, -2544, -2496, -2447, -2400, 
-        -2354, -2308, -2261, -2218, -2171, -2128, -2084, -2043, -1999, -1958, -1917, -1875, 
-        -1834, -1796, -1754, -1716, -1677, -1639, -1603, -1564, -1528, -1489, -1453, -1420, 
-        -1384, -1348, -1314, -1281, -1248, -1214, -1178, -1147, -1114, -1083, -1049, -1019, 
-        -988, -957, -926, -895, -864, -833, -805, -777, -746, -717, -687, -658, 
-        -630, -602, -573, -545, -517, -488, -463, -434, -406, -378, -352, -324, 
-        -298, -272, -244, -216, -190, -164, -136, -108, -82, -56, -28, -2 
-    };
-
-    // AKWF_blended_0004 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0004[600] PROGMEM = {
-        162, 402, 642, 884, 1124, 1364, 1606, 1848, 2091, 2333, 2575, 2818, 
-        3060, 3302, 3545, 3790, 4032, 4277, 4519, 4764, 5008, 5251, 5496, 5740, 
-        5985, 6230, 6475, 6722, 6964, 7211, 7456, 7701, 7948, 8193, 8440, 8687, 
-        8932, 9177, 9424, 9671, 9918, 10163, 10410, 10657, 10902, 11152, 11396, 11646, 
-        11891, 12140, 12385, 12635, 12882, 13131, 13376, 13626, 13871, 14123, 14367, 14619, 
-        14864, 15116, 15358, 15610, 15855, 16107, 16352, 16604, 16849, 17103, 17343, 17598, 
-        17842, 18097, 18339, 18594, 18836, 19090, 19335, 19590, 19832, 20089, 20329, 20586, 
-        20825, 21085, 21325, 21584, 21821, 22081, 22321, 22580, 22817, 23079, 23317, 23578, 
-        23813, 24078, 24310, 24577, 24809, 25073, 25309, 25575, 25805, 26074, 26305, 26574, 
-        26801, 27075, 27301, 27574, 27797, 28076, 28294, 28575, 28791, 29079, 29288, 29581, 
-        29784, 30082, 30279, 30587, 30771, 31095, 31258, 31612, 31738, 32142, 32181, 32767, 
-        31440, 29675, 27245, 23653, 20811, 17850, 15678, 13757, 12412, 11195, 10359, 9581, 
-        9070, 8576, 8275, 7967, 7807, 7623, 7553, 7454, 7441, 7398, 7427, 7422, 
-        7480, 7502, 7580, 7623, 7713, 7771, 7875, 7946, 8055, 8137, 8253, 8341, 
-        8464, 8561, 8689, 8794, 8925, 9036, 9174, 9288, 9429, 9552, 9695, 9824, 
-        9971, 10105, 10255, 10393, 10548, 10691, 10851, 10994, 11156, 11309, 11474, 11629, 
-        11796, 11956, 12128, 12291, 12465, 12632, 12809, 12981, 13158, 13333, 13517, 13694, 
-        13878, 14060, 14249, 14433, 14622, 14808, 15002, 15191, 15388, 15579, 15778, 15972, 
-        16170, 16369, 16570, 16771, 16975, 17176, 17384, 17588, 17796, 18002, 18213, 18422, 
-        18632, 18843, 19056, 19270, 19483, 19699, 19914, 20132, 20350, 20566, 20787, 21007, 
-        21228, 21448, 21671, 21894, 22117, 22340, 22565, 22791, 23019, 23244, 23472, 23699, 
-        23927, 24157, 24388, 24615, 24846, 25076, 25309, 25541, 25774, 26006, 26239, 26474, 
-        24468, 21727, 21497, 19880, 16342, 13413, 10638, 7878, 5161, 2573, 179, -1982, 
-        -3911, -5622, -7134, -8476, -9671, -10732, -11677, -12518, -13265, -13929, -14515, -15034, 
-        -15494, -15896, -16253, -16560, -16832, -17064, -17268, -17440, -17585, -17709, -17811, -17891, 
-        -17956, -18005, -18039, -18058, -18068, -18065, -18053, -18031, -18002, -17966, -17922, -17871, 
-        -17816, -17755, -17690, -17617, -17544, -17464, -17382, -17297, -17207, -17115, -17023, -16924, 
-        -16825, -16723, -16616, -16512, -16403, -16291, -16180, -16066, -15950, -15833, -15712, -15594, 
-        -15472, -15346, -15223, -15094, -14968, -14837, -14709, -14576, -14445, -14309, -14173, -14035, 
-        -13900, -13759, -13621, -13478, -13337, -13190, -13049, -12901, -12758, -12608, -12463, -12310, 
-        -12162, -12007, -11857, -11702, -11549, -11389, -11239, -11074, -10921, -10757, -10601, -10437, 
-        -10279, -10112, -9952, -9782, -9622, -9450, -9288, -9114, -8954, -8774, -8612, -8435, 
-        -8270, -8089, -7924, -7740, -7572, -7388, -7221, -7032, -6865, -6673, -6506, -6315, 
-        -6145, -5949, -5782, -5583, -5413, -5214, -5045, -4839, -4672, -4466, -4296, -4088, 
-        -3920, -3705, -3540, -3322, -3157, -2934, -2772, -2546, -2386, -2154, -1996, -1759, 
-        -1606, -1361, -1216, -957, -823, -550, -433, -133, -55, 302, 293, 833, 
-        -540, -2350, -4824, -8462, -11348, -14353, -16568, -18531, -19917, -21174, -22052, -22871, 
-        -23421, -23956, -24296, -24640, -24841, -25061, -25170, -25309, -25355, -25437, -25442, -25483, 
-        -25459, -25471, -25427, -25420, -25359, -25335, -25265, -25226, -25149, -25100, -25013, -24955, 
-        -24863, -24795, -24698, -24620, -24519, -24436, -24330, -24240, -24126, -24031, -23913, -23813, 
-        -23690, -23583, -23457, -23346, -23215, -23096, -22963, -22839, -22701, -22573, -22432, -22301, 
-        -22153, -22018, -21867, -21724, -21572, -21426, -21269, -21119, -20961, -20806, -20644, -20486, 
-        -20319, -20157, -19987, -19822, -19650, -19483, -19306, -19134, -18955, -18780, -18601, -18422, 
-        -18237, -18058, -17871, -17687, -17498, -17309, -17120, -16931, -16737, -16543, -16350, -16153, 
-        -15957, -15761, -15560, -15361, -15157, -14956, -14753, -14549, -14343, -14137, -13929, -13723, 
-        -13514, -13303, -13093, -12882, -12669, -12455, -12242, -12026, -11811, -11595, -11377, -11159, 
-        -10941, -10723, -10502, -10282, -10059, -9838, -9615, -9392, -9167, -8944, -8719, -8493, 
-        -8268, -8040, -7812, -7584, -7357, -7129, -6899, -6668, -6438, -6208, -5978, -5745, 
-        -5513, -5282, -5050, -4815, -4582, -4347, -4112, -3877, -3642, -3407, -3172, -2934, 
-        -2699, -2462, -2224, -1987, -1749, -1512, -1272, -1034, -794, -554, -317, -77 
-    };
-
-    // AKWF_blended_0005 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0005[600] PROGMEM = {
-        486, 1559, 2584, 3568, 4507, 5409, 6273, 7102, 7896, 8660, 9392, 10096, 
-        10774, 11425, 12050, 12654, 13236, 13795, 14335, 14856, 15358, 15843, 16310, 16763, 
-        17199, 17622, 18031, 18426, 18809, 19179, 19537, 19885, 20222, 20548, 20866, 21171, 
-        21471, 21760, 22040, 22312, 22577, 22836, 23086, 23329, 23565, 23796, 24020, 24237, 
-        24449, 24655, 24857, 25050, 25242, 25428, 25610, 25784, 25958, 26124, 26288, 26446, 
-        26605, 26752, 26904, 27041, 27193, 27127, 26679, 26120, 25544, 24998, 24484, 24014, 
-        23578, 23180, 22811, 22477, 22169, 21888, 21631, 21398, 21185, 20992, 20816, 20657, 
-        20514, 20385, 20269, 20165, 20071, 19990, 19917, 19853, 19797, 19750, 19707, 19672, 
-        19643, 19618, 19599, 19585, 19574, 19569, 19564, 19564, 19569, 19573, 19581, 19591, 
-        19603, 19617, 19632, 19649, 19667, 19686, 19707, 19727, 19750, 19772, 19795, 19819, 
-        19843, 19867, 19893, 19917, 19944, 19968, 19995, 20019, 20047, 20012, 19770, 19360, 
-        18863, 18318, 17762, 17198, 16648, 16102, 15583, 15065, 14773, 14880, 15112, 15376, 
-        15620, 15844, 16037, 16210, 16355, 16480, 16582, 16667, 16736, 16790, 16828, 16857, 
-        16872, 16879, 16875, 16864, 16846, 16822, 16790, 16754, 16714, 16673, 16625, 16576, 
-        16524, 16470, 16413, 16357, 16299, 16239, 16180, 16120, 16061, 16002, 15942, 15881, 
-        15823, 15765, 15707, 15651, 15594, 15540, 15485, 15432, 15380, 15329, 15279, 15229, 
-        15182, 15135, 15091, 15046, 15003, 14960, 14920, 14880, 14842, 14804, 14768, 14732, 
-        14699, 14663, 14632, 14601, 14573, 14541, 14515, 14483, 14463, 14429, 14416, 14189, 
-        13585, 12871, 12146, 11454, 10799, 10191, 9619, 9088, 8592, 8134, 7703, 7304, 
-        6931, 6584, 6260, 5959, 5679, 5416, 5173, 4947, 4734, 4538, 4353, 4183, 
-        4022, 3875, 3735, 3607, 3485, 3373, 3270, 3171, 3082, 2997, 2917, 2843, 
-        2775, 2711, 2652, 2595, 2543, 2477, 2345, 2112, 1783, 1384, 935, 447, 
-        -64, -594, -1134, -1679, -2226, -2774, -3317, -3855, -4387, -4914, -5432, -5941, 
-        -6443, -6937, -7422, -7841, -8040, -8066, -7993, -7870, -7719, -7563, -7400, -7252, 
-        -7098, -6971, -6642, -5943, -5144, -4343, -3585, -2870, -2211, -1597, -1031, -508, 
-        -26, 419, 828, 1206, 1551, 1869, 2157, 2423, 2663, 2884, 3082, 3263, 
-        3424, 3569, 3701, 3815, 3917, 4007, 4083, 4151, 4206, 4255, 4293, 4322, 
-        4346, 4361, 4368, 4371, 4368, 4360, 4347, 4328, 4306, 4279, 4250, 4217, 
-        4181, 4143, 4101, 4058, 4013, 3964, 3916, 3865, 3812, 3757, 3705, 3647, 
-        3591, 3532, 3474, 3415, 3357, 3296, 3236, 3174, 3115, 3051, 2993, 2930, 
-        2870, 2805, 2750, 2682, 2631, 2369, 1728, 976, 211, -518, -1211, -1860, 
-        -2470, -3040, -3576, -4075, -4545, -4985, -5398, -5785, -6150, -6490, -6812, -7113, 
-        -7397, -7664, -7917, -8153, -8376, -8587, -8786, -8974, -9151, -9319, -9477, -9627, 
-        -9771, -9905, -10033, -10155, -10271, -10380, -10484, -10585, -10680, -10771, -10857, -10940, 
-        -11018, -11094, -11166, -11237, -11302, -11367, -11427, -11487, -11543, -11599, -11651, -11702, 
-        -11752, -11799, -11845, -11889, -11932, -11974, -12013, -12053, -12089, -12187, -12488, -12961, 
-        -13515, -14117, -14731, -15351, -15956, -16556, -17127, -17699, -18041, -17984, -17800, -17586, 
-        -17390, -17212, -17064, -16937, -16837, -16754, -16695, -16651, -16625, -16611, -16612, -16623, 
-        -16645, -16677, -16719, -16764, -16819, -16879, -16944, -17011, -17085, -17161, -17241, -17321, 
-        -17404, -17488, -17574, -17659, -17746, -17833, -17920, -18007, -18093, -18180, -18266, -18350, 
-        -18433, -18516, -18597, -18677, -18756, -18835, -18911, -18987, -19060, -19132, -19202, -19273, 
-        -19339, -19406, -19470, -19535, -19595, -19657, -19715, -19773, -19828, -19884, -19936, -19989, 
-        -20038, -20087, -20134, -20182, -20225, -20272, -20312, -20356, -20392, -20438, -20467, -20707, 
-        -21324, -22050, -22789, -23492, -24159, -24780, -25364, -25903, -26411, -26882, -27323, -27732, 
-        -28117, -28474, -28807, -29118, -29408, -29678, -29933, -30169, -30389, -30594, -30788, -30967, 
-        -31135, -31292, -31438, -31577, -31704, -31824, -31937, -32042, -32140, -32231, -32317, -32399, 
-        -32473, -32544, -32610, -32672, -32730, -32767, -32732, -32588, -32345, -32024, -31648, -31230, 
-        -30782, -30314, -29829, -29339, -28838, -28340, -27840, -27344, -26849, -26360, -25877, -25397, 
-        -24925, -24459, -24000, -23489, -22776, -21903, -20947, -19960, -18955, -17963, -16978, -16021, 
-        -15073, -14168, -13073, -11621, -10086, -8557, -7087, -5673, -4326, -3037, -1809, -634 
-    };
-
-    // AKWF_blended_0006 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0006[600] PROGMEM = {
-        1216, 5123, 8335, 11113, 13440, 15479, 17214, 18757, 20086, 21279, 22318, 23259, 
-        24086, 24841, 25508, 26121, 26666, 27170, 27618, 28035, 28406, 28753, 29063, 29354, 
-        29614, 29858, 30078, 30283, 30469, 30644, 30801, 30948, 31083, 31207, 31322, 31428, 
-        31527, 31616, 31702, 31777, 31851, 31914, 31978, 32032, 32089, 32135, 32182, 32222, 
-        32264, 32296, 32333, 32360, 32395, 32414, 32447, 32461, 32491, 32502, 32530, 32537, 
-        32564, 32567, 32593, 32591, 32619, 32612, 32643, 32628, 32665, 32639, 32692, 32636, 
-        32707, 31125, 28509, 26679, 25214, 24194, 23377, 22815, 22357, 22050, 21794, 21627, 
-        21481, 21393, 21309, 21264, 21215, 21194, 21164, 21156, 21137, 21134, 21123, 21123, 
-        21117, 21118, 21114, 21117, 21113, 21115, 21113, 21115, 21114, 21115, 21114, 21115, 
-        21117, 21115, 21117, 21117, 21118, 21117, 21119, 21117, 21119, 21117, 21121, 21117, 
-        21121, 21117, 21122, 21118, 21123, 21117, 21123, 21117, 21123, 21117, 21125, 21115, 
-        21126, 21115, 21127, 21114, 21129, 21113, 21130, 21110, 21134, 21106, 21141, 21094, 
-        21156, 20469, 18481, 16195, 15825, 16751, 17120, 17327, 17255, 17135, 16883, 16642, 
-        16341, 16079, 15792, 15551, 15301, 15096, 14890, 14724, 14557, 14427, 14296, 14195, 
-        14092, 14017, 13938, 13880, 13819, 13776, 13729, 13697, 13662, 13637, 13612, 13593, 
-        13572, 13560, 13545, 13534, 13524, 13515, 13507, 13501, 13495, 13491, 13487, 13483, 
-        13480, 13476, 13476, 13472, 13472, 13468, 13471, 13465, 13468, 13463, 13467, 13461, 
-        13467, 13460, 13467, 13459, 13467, 13457, 13467, 13456, 13468, 13455, 13469, 13452, 
-        13472, 13448, 13476, 13441, 13486, 13425, 13488, 11900, 9279, 7444, 5973, 4950, 
-        4128, 3563, 3101, 2791, 2530, 2362, 2213, 2122, 2035, 1989, 1938, 1915, 
-        1884, 1873, 1854, 1850, 1836, 1836, 1828, 1829, 1823, 1824, 1820, 1823, 
-        1819, 1821, 1819, 1820, 1817, 1819, 1817, 1819, 1817, 1819, 1819, 1819, 
-        1819, 1817, 1819, 1817, 1819, 1817, 1819, 1817, 1819, 1817, 1820, 1816, 
-        1820, 1816, 1820, 1816, 1820, 1816, 1821, 1814, 1821, 1814, 1823, 1813, 
-        1823, 1605, 727, -954, -2973, -5016, -6948, -8167, -7751, -7164, -5081, -2129, 
-        -89, 1468, 2494, 3242, 3682, 3969, 4075, 4102, 4022, 3908, 3730, 3543, 
-        3318, 3098, 2857, 2630, 2390, 2165, 1938, 1724, 1512, 1316, 1121, 942, 
-        767, 605, 448, 304, 165, 36, -86, -200, -308, -409, -503, -593, 
-        -675, -753, -824, -893, -956, -1017, -1070, -1124, -1168, -1217, -1255, -1298, 
-        -1330, -1369, -1395, -1430, -1451, -1483, -1500, -1529, -1542, -1569, -1577, -1605, 
-        -1610, -1636, -1636, -1661, -1657, -1686, -1676, -1709, -1688, -1733, -1694, -1763, 
-        -1706, -3302, -5925, -7767, -9242, -10270, -11095, -11665, -12130, -12444, -12708, -12880, 
-        -13031, -13124, -13212, -13262, -13315, -13341, -13373, -13385, -13406, -13413, -13425, -13427, 
-        -13437, -13437, -13444, -13444, -13448, -13448, -13450, -13450, -13453, -13453, -13453, -13453, 
-        -13455, -13456, -13456, -13457, -13456, -13457, -13456, -13459, -13457, -13460, -13456, -13460, 
-        -13456, -13460, -13456, -13463, -13457, -13463, -13456, -13463, -13456, -13464, -13456, -13465, 
-        -13455, -13465, -13453, -13467, -13452, -13468, -13450, -13472, -13448, -13476, -13441, -13487, 
-        -13426, -14113, -16100, -18387, -18757, -17831, -17462, -17255, -17327, -17447, -17699, -17940, 
-        -18240, -18503, -18790, -19031, -19281, -19486, -19692, -19858, -20024, -20155, -20286, -20387, 
-        -20488, -20565, -20644, -20702, -20763, -20806, -20852, -20885, -20920, -20945, -20970, -20989, 
-        -21008, -21022, -21037, -21048, -21058, -21066, -21075, -21080, -21085, -21091, -21095, -21099, 
-        -21100, -21106, -21106, -21110, -21110, -21114, -21111, -21117, -21114, -21118, -21114, -21121, 
-        -21115, -21122, -21115, -21123, -21115, -21125, -21115, -21126, -21114, -21127, -21113, -21130, 
-        -21110, -21133, -21106, -21140, -21096, -21156, -21094, -22682, -25302, -27138, -28609, -29632, 
-        -30453, -31019, -31481, -31791, -32052, -32220, -32369, -32459, -32547, -32593, -32644, -32667, 
-        -32698, -32709, -32728, -32732, -32746, -32746, -32754, -32753, -32759, -32757, -32762, -32759, 
-        -32763, -32761, -32763, -32762, -32763, -32762, -32763, -32763, -32763, -32763, -32763, -32763, 
-        -32763, -32763, -32763, -32765, -32763, -32765, -32763, -32765, -32762, -32765, -32762, -32765, 
-        -32762, -32766, -32762, -32766, -32761, -32766, -32761, -32767, -32761, -32767, -32759, -32767, 
-        -32759, -32560, -31661, -30002, -27962, -25936, -23989, -21576, -17772, -14038, -9025, -3352 
-    };
-
-    // AKWF_blended_0007 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0007[600] PROGMEM = {
-        1782, 9782, 11965, 14218, 15905, 17876, 19543, 21192, 22012, 22576, 22988, 23478, 
-        23843, 24271, 24597, 24980, 25270, 25609, 25874, 26176, 26418, 26691, 26912, 27162, 
-        27364, 27593, 27786, 27996, 28174, 28369, 28536, 28720, 28881, 29053, 29205, 29372, 
-        29517, 29672, 29815, 29965, 30103, 30246, 30381, 30518, 30647, 30778, 30908, 31033, 
-        31153, 31279, 31395, 31511, 31624, 31736, 31843, 31946, 32046, 32141, 32231, 32319, 
-        32400, 32475, 32543, 32603, 32655, 32700, 32736, 32756, 32767, 32767, 32753, 32721, 
-        32672, 32604, 32514, 32402, 32267, 32098, 31903, 31674, 31420, 31153, 30885, 30617, 
-        30349, 30077, 29805, 29532, 29256, 28980, 28707, 28427, 28150, 27870, 27589, 27306, 
-        27025, 26740, 26457, 26170, 25885, 25594, 25309, 25017, 24726, 24436, 24143, 23849, 
-        23558, 23258, 22966, 22664, 22374, 22066, 21774, 21464, 21170, 20861, 20566, 20253, 
-        19957, 19638, 19346, 19025, 18729, 18405, 18110, 17782, 17488, 17156, 16863, 16526, 
-        16235, 15890, 15605, 15253, 14972, 14616, 14338, 13969, 13697, 13320, 13061, 12664, 
-        12428, 12023, 11850, 11509, 11674, 12529, 20234, 26196, 26328, 26506, 26086, 25926, 
-        25491, 25257, 24845, 24582, 24183, 23903, 23517, 23227, 22850, 22552, 22179, 21871, 
-        21504, 21191, 20829, 20512, 20148, 19828, 19468, 19145, 18785, 18459, 18099, 17771, 
-        17415, 17081, 16727, 16387, 16037, 15697, 15343, 15002, 14647, 14306, 13954, 13611, 
-        13256, 12911, 12559, 12208, 11858, 11509, 11155, 10806, 10452, 10101, 9747, 9394, 
-        9040, 8687, 8333, 7979, 7624, 7268, 6912, 6558, 6201, 5845, 5487, 5131, 
-        4773, 4418, 4060, 3702, 3344, 2984, 2628, 2268, 1908, 1548, 1190, 832, 
-        472, 112, -247, -607, -967, -1329, -1689, -2047, -2407, -2767, -3129, -3487, 
-        -3848, -4205, -4565, -4925, -5281, -5643, -5997, -6357, -6713, -7068, -7422, -7778, 
-        -8131, -8483, -8832, -9182, -9529, -9880, -10221, -10568, -10905, -11250, -11578, -11918, 
-        -12244, -12576, -12891, -13219, -13526, -13845, -14139, -14452, -14734, -15034, -15300, -15589, 
-        -15836, -16106, -16333, -16586, -16785, -17015, -17186, -17388, -17523, -17696, -17786, -17926, 
-        -17964, -18063, -18035, -18093, -17885, -17171, -15851, -14619, -13149, -11882, -10133, -7714, 
-        1546, 9068, 10774, 12553, 13763, 15257, 16445, 17619, 17962, 18052, 17986, 17998, 
-        17885, 17836, 17685, 17587, 17400, 17263, 17047, 16871, 16635, 16428, 16168, 15939, 
-        15664, 15409, 15120, 14848, 14546, 14259, 13946, 13650, 13326, 13018, 12688, 12371, 
-        12036, 11710, 11372, 11038, 10693, 10356, 10007, 9664, 9314, 8969, 8616, 8267, 
-        7913, 7559, 7204, 6850, 6494, 6136, 5780, 5421, 5063, 4703, 4345, 3987, 
-        3627, 3267, 2907, 2547, 2187, 1829, 1469, 1108, 748, 388, 29, -331, 
-        -691, -1048, -1407, -1767, -2126, -2486, -2844, -3202, -3560, -3918, -4276, -4632, 
-        -4988, -5345, -5703, -6059, -6415, -6771, -7126, -7484, -7836, -8191, -8545, -8899, 
-        -9252, -9606, -9959, -10309, -10662, -11014, -11365, -11717, -12064, -12418, -12765, -13118, 
-        -13463, -13815, -14160, -14511, -14854, -15208, -15547, -15902, -16237, -16593, -16929, -17282, 
-        -17617, -17970, -18303, -18658, -18986, -19342, -19666, -20024, -20347, -20709, -21024, -21386, 
-        -21700, -22066, -22374, -22743, -23045, -23418, -23712, -24091, -24378, -24768, -25036, -25439, 
-        -25686, -26097, -26275, -26618, -26459, -25606, -17900, -11935, -11801, -11620, -12034, -12188, 
-        -12613, -12840, -13243, -13494, -13879, -14145, -14516, -14788, -15146, -15427, -15778, -16063, 
-        -16410, -16697, -17034, -17325, -17658, -17949, -18277, -18570, -18896, -19188, -19509, -19803, 
-        -20120, -20414, -20727, -21020, -21329, -21624, -21929, -22224, -22527, -22818, -23120, -23410, 
-        -23710, -23999, -24295, -24582, -24876, -25165, -25454, -25741, -26029, -26313, -26599, -26882, 
-        -27166, -27447, -27728, -28005, -28285, -28564, -28838, -29113, -29389, -29663, -29935, -30207, 
-        -30475, -30743, -31013, -31279, -31532, -31761, -31956, -32124, -32261, -32374, -32462, -32531, 
-        -32578, -32610, -32625, -32627, -32618, -32593, -32559, -32514, -32462, -32402, -32334, -32259, 
-        -32179, -32093, -32003, -31905, -31808, -31704, -31598, -31487, -31373, -31260, -31140, -31020, 
-        -30896, -30775, -30643, -30516, -30383, -30252, -30113, -29978, -29833, -29693, -29541, -29400, 
-        -29243, -29091, -28928, -28772, -28598, -28435, -28249, -28080, -27880, -27700, -27484, -27289, 
-        -27059, -26851, -26596, -26369, -26089, -25842, -25533, -25259, -24914, -24610, -24222, -23885, 
-        -23444, -23065, -22561, -22141, -21457, -20268, -18470, -16762, -14814, -13071, -10845, -7952 
-    };
-
-    // AKWF_blended_0008 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0008[600] PROGMEM = {
-        569, 2686, 4818, 6973, 9155, 11362, 13537, 15502, 16830, 17762, 18673, 19540, 
-        20392, 21204, 21999, 22766, 23511, 24227, 24923, 25591, 26238, 26852, 27442, 27995, 
-        28512, 28990, 29425, 29803, 30125, 30371, 30548, 30698, 30844, 30979, 31109, 31235, 
-        31354, 31463, 31571, 31673, 31770, 31862, 31949, 32031, 32110, 32183, 32256, 32320, 
-        32380, 32439, 32492, 32541, 32587, 32627, 32663, 32694, 32720, 32740, 32755, 32766, 
-        32767, 32766, 32755, 32735, 32705, 32671, 32623, 32563, 32492, 32410, 32311, 32198, 
-        32068, 31918, 31748, 31555, 31339, 31093, 30819, 30514, 30183, 29840, 29498, 29155, 
-        28811, 28466, 28123, 27776, 27431, 27084, 26740, 26393, 26048, 25703, 25356, 25012, 
-        24667, 24322, 23979, 23637, 23294, 22950, 22611, 22269, 21929, 21593, 21254, 20918, 
-        20585, 20249, 19919, 19588, 19259, 18930, 18605, 18280, 17959, 17639, 17323, 17007, 
-        16691, 16408, 16198, 16047, 15944, 15886, 15864, 15869, 15902, 15953, 16025, 16109, 
-        16202, 16306, 16421, 16536, 16660, 16790, 16920, 17051, 17184, 17320, 17457, 17590, 
-        17729, 17866, 18001, 18136, 18271, 18408, 18543, 18677, 18810, 18941, 19073, 19203, 
-        19334, 19462, 19590, 19716, 19835, 19957, 20072, 20187, 20297, 20401, 20498, 20587, 
-        20666, 20735, 20793, 20832, 20852, 20850, 20821, 20759, 20658, 20512, 20309, 20046, 
-        19712, 19360, 19004, 18642, 18282, 17915, 17546, 17172, 16795, 16419, 16039, 15654, 
-        15267, 14879, 14487, 14092, 13698, 13300, 12896, 12494, 12089, 11683, 11274, 10863, 
-        10450, 10036, 9619, 9203, 8785, 8361, 7939, 7517, 7093, 6666, 6239, 5813, 
-        5384, 4956, 4525, 4094, 3663, 3230, 2799, 2365, 1932, 1497, 1064, 633, 
-        199, -235, -668, -1101, -1534, -1967, -2399, -2829, -3260, -3689, -4118, -4545, 
-        -4973, -5397, -5822, -6244, -6666, -7086, -7504, -7921, -8334, -8744, -9154, -9561, 
-        -9966, -10366, -10764, -11157, -11550, -11939, -12322, -12702, -13080, -13451, -13816, -14176, 
-        -14532, -14881, -15225, -15559, -15891, -16211, -16527, -16803, -17002, -17133, -17204, -17228, 
-        -17208, -17142, -17046, -16916, -16755, -16567, -16357, -16114, -15855, -15564, -15252, -14912, 
-        -14547, -14154, -13731, -13283, -12691, -11475, -9820, -8087, -6354, -4650, -2973, -1313, 
-        337, 1992, 3660, 5351, 7068, 8808, 10520, 12021, 12887, 13353, 13800, 14202, 
-        14585, 14934, 15265, 15566, 15844, 16096, 16326, 16525, 16708, 16854, 16974, 17062, 
-        17113, 17119, 17086, 16994, 16848, 16626, 16335, 16015, 15690, 15358, 15020, 14675, 
-        14322, 13964, 13605, 13234, 12861, 12483, 12103, 11716, 11327, 10934, 10540, 10142, 
-        9738, 9333, 8925, 8516, 8103, 7689, 7274, 6854, 6434, 6012, 5588, 5165, 
-        4739, 4312, 3884, 3455, 3024, 2595, 2166, 1731, 1298, 867, 432, 0, 
-        -432, -865, -1298, -1733, -2166, -2600, -3031, -3462, -3895, -4326, -4757, -5185, 
-        -5614, -6041, -6469, -6896, -7322, -7744, -8167, -8589, -9009, -9428, -9844, -10260, 
-        -10673, -11086, -11495, -11902, -12310, -12713, -13117, -13517, -13913, -14310, -14702, -15093, 
-        -15480, -15868, -16249, -16627, -17005, -17382, -17752, -18121, -18483, -18848, -19206, -19559, 
-        -19913, -20229, -20479, -20664, -20797, -20885, -20940, -20960, -20956, -20932, -20885, -20824, 
-        -20753, -20671, -20580, -20479, -20373, -20262, -20147, -20028, -19909, -19785, -19657, -19531, 
-        -19402, -19270, -19141, -19007, -18877, -18741, -18607, -18470, -18333, -18198, -18063, -17926, 
-        -17787, -17652, -17515, -17378, -17243, -17111, -16978, -16848, -16719, -16598, -16479, -16370, 
-        -16268, -16174, -16092, -16026, -15979, -15953, -15952, -15983, -16050, -16163, -16328, -16558, 
-        -16854, -17170, -17484, -17800, -18120, -18443, -18766, -19093, -19420, -19749, -20077, -20412, 
-        -20744, -21077, -21414, -21750, -22088, -22428, -22768, -23108, -23451, -23792, -24134, -24477, 
-        -24823, -25166, -25511, -25854, -26200, -26547, -26888, -27233, -27580, -27924, -28269, -28614, 
-        -28956, -29299, -29641, -29982, -30313, -30620, -30892, -31138, -31356, -31549, -31719, -31869, 
-        -31999, -32112, -32210, -32294, -32366, -32424, -32473, -32510, -32539, -32559, -32572, -32576, 
-        -32574, -32563, -32550, -32530, -32508, -32477, -32442, -32402, -32358, -32313, -32260, -32203, 
-        -32145, -32083, -32013, -31940, -31865, -31787, -31701, -31611, -31518, -31418, -31315, -31208, 
-        -31094, -30970, -30846, -30713, -30574, -30424, -30273, -30079, -29809, -29473, -29076, -28627, 
-        -28141, -27610, -27043, -26446, -25820, -25166, -24488, -23781, -23055, -22298, -21520, -20717, 
-        -19888, -19027, -18140, -17226, -16171, -14492, -12372, -10175, -7976, -5809, -3667, -1543 
-    };
-
-    // AKWF_blended_0009 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0009[600] PROGMEM = {
-        304, 1452, 2498, 3579, 4630, 5696, 6742, 7790, 8819, 9849, 10860, 11864, 
-        12850, 13826, 14783, 15727, 16650, 17559, 18443, 19311, 20154, 20978, 21778, 22555, 
-        23305, 24032, 24733, 25407, 26053, 26673, 27263, 27825, 28358, 28861, 29334, 29778, 
-        30189, 30573, 30923, 31244, 31535, 31792, 32021, 32219, 32385, 32522, 32628, 32705, 
-        32751, 32767, 32755, 32715, 32646, 32551, 32428, 32279, 32104, 31905, 31680, 31433, 
-        31163, 30870, 30556, 30222, 29870, 29499, 29109, 28703, 28281, 27845, 27395, 26933, 
-        26457, 25973, 25479, 24975, 24465, 23949, 23427, 22902, 22371, 21841, 21308, 20776, 
-        20244, 19715, 19188, 18666, 18149, 17637, 17132, 16636, 16146, 15667, 15199, 14741, 
-        14298, 13863, 13444, 13039, 12649, 12274, 11913, 11571, 11244, 10935, 10645, 10371, 
-        10118, 9882, 9665, 9469, 9290, 9132, 8994, 8876, 8776, 8696, 8636, 8596, 
-        8575, 8573, 8590, 8626, 8679, 8750, 8839, 8945, 9068, 9206, 9360, 9527, 
-        9711, 9906, 10117, 10336, 10571, 10814, 11069, 11330, 11603, 11879, 12166, 12454, 
-        12753, 13049, 13356, 13656, 13969, 14262, 14640, 14992, 15280, 15586, 15873, 16165, 
-        16443, 16719, 16983, 17241, 17485, 17722, 17946, 18158, 18354, 18540, 18709, 18862, 
-        19001, 19120, 19223, 19309, 19375, 19423, 19451, 19458, 19444, 19411, 19355, 19279, 
-        19179, 19059, 18915, 18749, 18560, 18350, 18116, 17860, 17580, 17279, 16955, 16610, 
-        16241, 15851, 15440, 15009, 14557, 14086, 13593, 13082, 12553, 12005, 11440, 10860, 
-        10261, 9648, 9022, 8382, 7729, 7063, 6387, 5701, 5005, 4302, 3591, 2874, 
-        2151, 1423, 694, -38, -770, -1503, -2235, -2966, -3692, -4415, -5131, -5842, 
-        -6545, -7239, -7924, -8598, -9260, -9909, -10545, -11165, -11770, -12360, -12930, -13481, 
-        -14014, -14526, -15018, -15488, -15933, -16357, -16756, -17130, -17479, -17803, -18099, -18368, 
-        -18612, -18826, -19011, -19170, -19299, -19398, -19469, -19509, -19521, -19504, -19455, -19378, 
-        -19272, -19137, -18970, -18778, -18554, -18304, -18024, -17719, -17384, -17025, -16636, -16225, 
-        -15787, -15326, -14841, -14334, -13803, -13253, -12681, -12091, -11479, -10854, -10209, -9550, 
-        -8873, -8188, -7483, -6775, -6048, -5321, -4575, -3834, -3073, -2326, -1550, -810, 
-        110, 955, 1695, 2469, 3216, 3975, 4715, 5458, 6183, 6909, 7614, 8315, 
-        8997, 9670, 10324, 10967, 11588, 12194, 12779, 13347, 13891, 14416, 14918, 15399, 
-        15851, 16284, 16688, 17069, 17422, 17749, 18049, 18322, 18565, 18781, 18967, 19125, 
-        19254, 19352, 19421, 19461, 19472, 19452, 19404, 19326, 19219, 19084, 18918, 18724, 
-        18502, 18253, 17977, 17673, 17342, 16986, 16605, 16200, 15770, 15319, 14843, 14345, 
-        13828, 13289, 12733, 12157, 11564, 10955, 10330, 9690, 9036, 8371, 7694, 7006, 
-        6309, 5604, 4890, 4171, 3448, 2719, 1988, 1255, 520, -211, -944, -1675, 
-        -2401, -3123, -3840, -4549, -5252, -5946, -6630, -7304, -7967, -8618, -9255, -9880, 
-        -10488, -11084, -11661, -12222, -12765, -13290, -13799, -14285, -14754, -15200, -15627, -16034, 
-        -16418, -16782, -17123, -17442, -17737, -18012, -18262, -18491, -18697, -18879, -19041, -19179, 
-        -19294, -19388, -19458, -19509, -19538, -19546, -19532, -19501, -19447, -19377, -19286, -19179, 
-        -19053, -18912, -18752, -18581, -18391, -18191, -17973, -17748, -17507, -17259, -16997, -16731, 
-        -16453, -16172, -15878, -15589, -15282, -14992, -14614, -14259, -13964, -13650, -13350, -13042, 
-        -12745, -12446, -12159, -11872, -11595, -11322, -11062, -10808, -10566, -10333, -10113, -9906, 
-        -9711, -9530, -9364, -9212, -9076, -8954, -8853, -8765, -8696, -8646, -8612, -8598, 
-        -8603, -8626, -8669, -8732, -8813, -8916, -9037, -9178, -9338, -9519, -9719, -9937, 
-        -10175, -10431, -10708, -10999, -11311, -11638, -11982, -12345, -12721, -13112, -13519, -13940, 
-        -14373, -14820, -15277, -15746, -16225, -16713, -17209, -17712, -18224, -18740, -19262, -19787, 
-        -20315, -20845, -21374, -21904, -22434, -22959, -23483, -24002, -24513, -25020, -25519, -26008, 
-        -26489, -26957, -27415, -27860, -28290, -28706, -29107, -29491, -29855, -30203, -30529, -30836, 
-        -31120, -31384, -31624, -31840, -32034, -32199, -32341, -32456, -32542, -32603, -32634, -32637, 
-        -32612, -32557, -32473, -32358, -32212, -32037, -31831, -31594, -31326, -31028, -30698, -30338, 
-        -29947, -29526, -29073, -28593, -28080, -27541, -26970, -26371, -25744, -25090, -24409, -23702, 
-        -22967, -22210, -21427, -20621, -19791, -18941, -18067, -17178, -16265, -15337, -14388, -13427, 
-        -12446, -11457, -10448, -9436, -8403, -7371, -6321, -5274, -4207, -3153, -2072, -1027 
-    };
-
-    // AKWF_blended_0011 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0011[600] PROGMEM = {
-        443, 667, 989, 1268, 1591, 1885, 2202, 2496, 2807, 3105, 3411, 3709, 
-        4015, 4313, 4617, 4913, 5216, 5514, 5815, 6111, 6407, 6705, 7001, 7295, 
-        7589, 7882, 8176, 8464, 8756, 9044, 9333, 9619, 9906, 10189, 10473, 10755, 
-        11036, 11318, 11597, 11873, 12150, 12424, 12698, 12970, 13242, 13511, 13780, 14047, 
-        14314, 14578, 14840, 15102, 15362, 15619, 15879, 16134, 16388, 16641, 16893, 17143, 
-        17390, 17638, 17883, 18126, 18368, 18608, 18846, 19084, 19319, 19552, 19785, 20015, 
-        20241, 20469, 20695, 20916, 21136, 21357, 21576, 21789, 22003, 22216, 22425, 22633, 
-        22840, 23043, 23247, 23446, 23645, 23839, 24033, 24225, 24417, 24603, 24788, 24972, 
-        25154, 25331, 25511, 25685, 25858, 26028, 26197, 26362, 26527, 26687, 26850, 27000, 
-        27158, 27313, 27459, 27607, 27750, 27893, 28034, 28170, 28303, 28437, 28565, 28696, 
-        28815, 28944, 29055, 29186, 29281, 29419, 29495, 29645, 29696, 29863, 29885, 30072, 
-        30060, 30278, 30218, 30477, 30361, 30676, 30482, 30875, 30579, 31086, 30632, 31334, 
-        30606, 31698, 30303, 32767, 25829, 15510, 15624, 14486, 15772, 14950, 15617, 15066, 
-        15529, 15153, 15496, 15224, 15476, 15272, 15457, 15304, 15432, 15314, 15401, 15311, 
-        15365, 15294, 15321, 15267, 15275, 15231, 15224, 15187, 15168, 15136, 15112, 15081, 
-        15049, 15015, 14981, 14945, 14908, 14870, 14831, 14787, 14748, 14700, 14661, 14610, 
-        14559, 14513, 14460, 14406, 14350, 14295, 14234, 14176, 14113, 14050, 13982, 13916, 
-        13846, 13773, 13700, 13625, 13547, 13467, 13387, 13305, 13217, 13132, 13043, 12950, 
-        12858, 12764, 12669, 12570, 12470, 12366, 12264, 12157, 12048, 11939, 11827, 11713, 
-        11597, 11480, 11364, 11242, 11119, 10995, 10869, 10743, 10612, 10481, 10350, 10214, 
-        10078, 9942, 9804, 9663, 9520, 9377, 9234, 9086, 8938, 8787, 8639, 8486, 
-        8333, 8181, 8025, 7868, 7710, 7550, 7390, 7230, 7067, 6904, 6739, 6574, 
-        6407, 6240, 6072, 5902, 5733, 5563, 5390, 5218, 5046, 4871, 4697, 4522, 
-        4345, 4170, 3993, 3816, 3636, 3459, 3280, 3103, 2921, 2744, 2559, 2384, 
-        2198, 2025, 1836, 1664, 1472, 1305, 1108, 948, 742, 608, 339, 94, 
-        138, -118, -281, -485, -645, -834, -999, -1188, -1358, -1543, -1715, -1899, 
-        -2071, -2253, -2428, -2608, -2782, -2962, -3137, -3314, -3486, -3663, -3838, -4012, 
-        -4187, -4362, -4534, -4709, -4881, -5053, -5225, -5395, -5568, -5735, -5907, -6075, 
-        -6242, -6412, -6577, -6744, -6909, -7074, -7237, -7399, -7562, -7722, -7882, -8042, 
-        -8200, -8355, -8513, -8666, -8819, -8972, -9122, -9272, -9420, -9568, -9712, -9857, 
-        -9998, -10141, -10279, -10420, -10556, -10692, -10825, -10956, -11090, -11216, -11344, -11470, 
-        -11594, -11716, -11837, -11956, -12072, -12189, -12300, -12412, -12523, -12630, -12737, -12841, 
-        -12943, -13043, -13140, -13237, -13331, -13424, -13513, -13603, -13688, -13773, -13853, -13933, 
-        -14011, -14086, -14161, -14231, -14299, -14367, -14430, -14494, -14552, -14612, -14663, -14724, 
-        -14775, -14819, -14872, -14913, -14957, -14998, -15037, -15073, -15107, -15139, -15168, -15192, 
-        -15221, -15238, -15267, -15272, -15306, -15294, -15338, -15304, -15362, -15301, -15379, -15287, 
-        -15391, -15258, -15398, -15214, -15403, -15153, -15408, -15071, -15418, -14957, -15449, -14785, 
-        -15544, -14477, -15893, -13443, -20394, -30715, -30601, -31736, -30441, -31246, -30560, -31084, 
-        -30591, -30933, -30550, -30778, -30472, -30620, -30378, -30465, -30266, -30310, -30142, -30147, 
-        -30002, -29980, -29851, -29800, -29681, -29609, -29499, -29410, -29298, -29196, -29082, -28968, 
-        -28852, -28730, -28604, -28478, -28345, -28214, -28073, -27935, -27789, -27646, -27486, -27338, 
-        -27182, -27017, -26857, -26690, -26523, -26350, -26178, -26001, -25824, -25639, -25457, -25271, 
-        -25081, -24890, -24696, -24502, -24303, -24101, -23900, -23694, -23487, -23279, -23068, -22854, 
-        -22641, -22422, -22204, -21981, -21760, -21537, -21309, -21081, -20850, -20620, -20387, -20151, 
-        -19914, -19676, -19436, -19193, -18950, -18705, -18460, -18210, -17963, -17713, -17461, -17206, 
-        -16951, -16694, -16437, -16177, -15918, -15656, -15394, -15129, -14862, -14595, -14329, -14059, 
-        -13787, -13516, -13244, -12970, -12696, -12419, -12143, -11864, -11585, -11306, -11024, -10743, 
-        -10459, -10175, -9891, -9605, -9318, -9032, -8743, -8455, -8166, -7875, -7584, -7290, 
-        -6999, -6705, -6412, -6118, -5825, -5526, -5233, -4934, -4638, -4338, -4044, -3741, 
-        -3447, -3141, -2848, -2540, -2249, -1933, -1649, -1327, -1048, -701, -485, -245 
-    };
-
-    // AKWF_blended_0012 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0012[600] PROGMEM = {
-        76, 1272, 2679, 3830, 4927, 5545, 6015, 6302, 6678, 6975, 7343, 7661, 
-        8014, 8336, 8682, 9004, 9340, 9662, 9995, 10315, 10635, 10955, 11273, 11585, 
-        11893, 12205, 12505, 12807, 13102, 13399, 13691, 13978, 14257, 14544, 14819, 15091, 
-        15362, 15624, 15891, 16145, 16401, 16650, 16902, 17146, 17387, 17626, 17857, 18083, 
-        18309, 18532, 18751, 18969, 19180, 19389, 19592, 19795, 19991, 20184, 20379, 20570, 
-        20755, 20935, 21113, 21294, 21466, 21637, 21802, 21967, 22127, 22287, 22439, 22594, 
-        22744, 22891, 23034, 23176, 23316, 23450, 23582, 23714, 23841, 23963, 24088, 24205, 
-        24321, 24441, 24553, 24664, 24771, 24878, 24982, 25086, 25190, 25289, 25378, 25477, 
-        25569, 25660, 25749, 25835, 25919, 26003, 26079, 26161, 26237, 26310, 26387, 26458, 
-        26529, 26595, 26664, 26730, 26793, 26854, 26912, 26973, 27034, 27090, 27141, 27197, 
-        27248, 27299, 27347, 27395, 27441, 27487, 27530, 27568, 27611, 27652, 27687, 27723, 
-        27766, 27799, 27835, 27868, 27898, 27929, 27959, 27989, 28017, 28043, 28071, 28094, 
-        28119, 28142, 28162, 28185, 28203, 28221, 28238, 28259, 28274, 28287, 28302, 28317, 
-        28332, 28343, 28353, 28363, 28370, 28383, 28388, 28398, 28406, 28409, 28419, 28421, 
-        28424, 28429, 28429, 28431, 28431, 28431, 28431, 28434, 28429, 28426, 28424, 28419, 
-        28416, 28414, 28406, 28401, 28391, 28386, 28378, 28368, 28358, 28350, 28340, 28327, 
-        28317, 28304, 28289, 28277, 28261, 28249, 28231, 28216, 28198, 28180, 28162, 28142, 
-        28122, 28101, 28081, 28056, 28035, 28015, 27987, 27964, 27936, 27908, 27880, 27852, 
-        27822, 27789, 27758, 27725, 27692, 27652, 27616, 27581, 27540, 27499, 27456, 27413, 
-        27367, 27319, 27276, 27222, 27172, 27116, 27062, 27004, 26945, 26879, 26816, 26747, 
-        26681, 26608, 26534, 26458, 26376, 26290, 26204, 26110, 26018, 25922, 25818, 25708, 
-        25597, 25482, 25360, 25233, 25104, 24964, 24822, 24675, 24517, 24355, 24182, 24009, 
-        23821, 23631, 23420, 23214, 22980, 22764, 22500, 22272, 21972, 21731, 21319, 20717, 
-        19643, 18469, 17054, 15794, 14326, 13122, 11649, 10534, 9037, 8039, 6462, 5646, 
-        3817, 3464, -7384, -14224, -14697, -16790, -17773, -19528, -20656, -22272, -23471, -25007, 
-        -26242, -27718, -28929, -30217, -31094, -31734, -31957, -32183, -32295, -32460, -32531, -32633, 
-        -32676, -32734, -32750, -32767, -32757, -32745, -32709, -32666, -32613, -32547, -32473, -32389, 
-        -32298, -32196, -32089, -31978, -31858, -31731, -31602, -31467, -31332, -31188, -31043, -30898, 
-        -30743, -30596, -30436, -30286, -30126, -29971, -29806, -29648, -29486, -29326, -29163, -29008, 
-        -28846, -28683, -28525, -28363, -28205, -28048, -27893, -27738, -27583, -27431, -27276, -27126, 
-        -26973, -26826, -26681, -26531, -26389, -26249, -26107, -25968, -25833, -25696, -25564, -25429, 
-        -25299, -25170, -25048, -24921, -24799, -24677, -24560, -24443, -24327, -24217, -24106, -24001, 
-        -23895, -23786, -23684, -23580, -23481, -23382, -23288, -23189, -23095, -23001, -22917, -22825, 
-        -22739, -22655, -22571, -22490, -22409, -22333, -22256, -22183, -22109, -22038, -21967, -21898, 
-        -21832, -21766, -21703, -21637, -21576, -21517, -21461, -21403, -21344, -21289, -21240, -21187, 
-        -21139, -21088, -21040, -20996, -20948, -20905, -20864, -20826, -20783, -20742, -20709, -20671, 
-        -20633, -20598, -20562, -20532, -20499, -20468, -20438, -20410, -20379, -20354, -20328, -20303, 
-        -20278, -20255, -20234, -20214, -20194, -20176, -20156, -20138, -20120, -20105, -20087, -20074, 
-        -20059, -20046, -20036, -20021, -20011, -19998, -19991, -19978, -19970, -19965, -19955, -19950, 
-        -19942, -19937, -19932, -19930, -19924, -19922, -19917, -19914, -19912, -19912, -19912, -19909, 
-        -19907, -19909, -19909, -19909, -19912, -19912, -19912, -19914, -19917, -19919, -19922, -19924, 
-        -19927, -19932, -19937, -19940, -19942, -19945, -19950, -19955, -19960, -19963, -19965, -19970, 
-        -19975, -19978, -19980, -19988, -19988, -19991, -19996, -19996, -19998, -20001, -20006, -20003, 
-        -20006, -20006, -20003, -20003, -20003, -20003, -19998, -19996, -19991, -19985, -19983, -19973, 
-        -19965, -19955, -19942, -19932, -19919, -19904, -19889, -19869, -19848, -19828, -19805, -19777, 
-        -19749, -19719, -19686, -19648, -19612, -19571, -19526, -19480, -19427, -19371, -19315, -19254, 
-        -19185, -19114, -19041, -18957, -18870, -18781, -18680, -18576, -18466, -18350, -18225, -18090, 
-        -17951, -17801, -17651, -17476, -17313, -17110, -16935, -16698, -16513, -16241, -15959, -15306, 
-        -14405, -13137, -11933, -10523, -9332, -7907, -6794, -5362, -4346, -2867, -1991, -378, 
-        213, 2263, -6185, -10617, -8674, -8336, -6868, -6144, -4762, -3828, -2438, -1348 
-    };
-
-    // AKWF_blended_0013 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0013[600] PROGMEM = {
-        27, 18276, 14994, 17101, 15784, 16959, 16197, 17002, 16508, 17107, 16777, 17242, 
-        17027, 17397, 17258, 17557, 17483, 17730, 17702, 17902, 17915, 18084, 18124, 18269, 
-        18331, 18458, 18535, 18646, 18735, 18837, 18932, 19031, 19130, 19229, 19327, 19423, 
-        19522, 19620, 19716, 19815, 19913, 20012, 20107, 20206, 20305, 20404, 20499, 20598, 
-        20697, 20795, 20894, 20990, 21088, 21187, 21286, 21381, 21480, 21579, 21677, 21773, 
-        21872, 21970, 22069, 22165, 22263, 22362, 22461, 22556, 22655, 22754, 22852, 22948, 
-        23047, 23145, 23244, 23343, 23438, 23537, 23636, 23734, 23830, 23929, 24027, 24126, 
-        24222, 24320, 24419, 24515, 24613, 24712, 24811, 24906, 25005, 25104, 25202, 25301, 
-        25397, 25495, 25594, 25693, 25788, 25887, 25986, 26084, 26180, 26279, 26377, 26476, 
-        26572, 26670, 26769, 26868, 26963, 27062, 27161, 27259, 27355, 27454, 27552, 27651, 
-        27747, 27848, 27941, 28046, 28132, 28249, 28320, 28453, 28505, 28663, 28687, 28872, 
-        28866, 29088, 29039, 29310, 29205, 29539, 29366, 29779, 29511, 30035, 29634, 30322, 
-        29714, 30670, 29693, 31201, 29295, 32767, 14661, -3389, 86, -1822, -311, -1289, 
-        -333, -940, -252, -653, -129, -397, 15, -160, 172, 70, 339, 289, 
-        515, 508, 690, 718, 872, 928, 1060, 1131, 1249, 1332, 1440, 1532, 
-        1631, 1730, 1828, 1927, 2023, 2121, 2220, 2319, 2414, 2513, 2612, 2710, 
-        2806, 2905, 3003, 3102, 3198, 3296, 3395, 3491, 3589, 3688, 3787, 3885, 
-        3981, 4080, 4178, 4277, 4373, 4471, 4570, 4669, 4764, 4863, 4962, 5060, 
-        5156, 5255, 5353, 5452, 5548, 5646, 5745, 5844, 5939, 6038, 6137, 6235, 
-        6334, 6430, 6528, 6627, 6726, 6821, 6920, 7019, 7117, 7213, 7312, 7410, 
-        7509, 7605, 7703, 7802, 7898, 7996, 8095, 8194, 8293, 8388, 8487, 8585, 
-        8684, 8783, 8878, 8977, 9076, 9171, 9270, 9369, 9468, 9563, 9662, 9761, 
-        9859, 9955, 10053, 10152, 10251, 10346, 10445, 10544, 10646, 10735, 10846, 10923, 
-        11050, 11111, 11256, 11296, 11466, 11475, 11679, 11651, 11895, 11824, 12123, 11984, 
-        12354, 12138, 12601, 12271, 12869, 12379, 13184, 12419, 13594, 12280, 14387, 11108, 
-        -29353, -11105, -14387, -12280, -13594, -12419, -13184, -12379, -12872, -12271, -12601, -12138, 
-        -12354, -11984, -12123, -11824, -11895, -11651, -11679, -11475, -11466, -11296, -11256, -11111, 
-        -11050, -10923, -10846, -10735, -10646, -10544, -10445, -10346, -10251, -10152, -10053, -9955, 
-        -9859, -9761, -9662, -9563, -9468, -9369, -9270, -9171, -9076, -8977, -8878, -8783, 
-        -8684, -8585, -8487, -8388, -8293, -8194, -8095, -7996, -7898, -7802, -7703, -7605, 
-        -7509, -7410, -7312, -7213, -7117, -7019, -6920, -6821, -6726, -6627, -6528, -6430, 
-        -6334, -6235, -6137, -6038, -5939, -5844, -5745, -5646, -5548, -5452, -5353, -5255, 
-        -5156, -5060, -4962, -4863, -4764, -4669, -4570, -4471, -4373, -4277, -4178, -4080, 
-        -3981, -3885, -3787, -3688, -3589, -3491, -3395, -3296, -3198, -3102, -3003, -2905, 
-        -2806, -2710, -2612, -2513, -2414, -2319, -2220, -2121, -2023, -1927, -1828, -1730, 
-        -1631, -1532, -1440, -1332, -1249, -1131, -1060, -928, -872, -718, -690, -508, 
-        -515, -289, -339, -70, -172, 160, -15, 397, 129, 653, 252, 940, 
-        333, 1289, 311, 1822, -86, 3386, -14717, -32767, -29292, -31201, -29693, -30670, 
-        -29711, -30322, -29634, -30035, -29511, -29779, -29366, -29539, -29205, -29310, -29039, -29088, 
-        -28866, -28872, -28687, -28663, -28505, -28453, -28320, -28249, -28132, -28046, -27941, -27848, 
-        -27747, -27651, -27552, -27454, -27355, -27259, -27161, -27062, -26963, -26868, -26769, -26670, 
-        -26572, -26476, -26377, -26279, -26180, -26084, -25986, -25887, -25788, -25693, -25594, -25495, 
-        -25397, -25301, -25202, -25104, -25005, -24906, -24811, -24712, -24613, -24515, -24419, -24320, 
-        -24222, -24126, -24027, -23929, -23830, -23734, -23636, -23537, -23438, -23343, -23244, -23145, 
-        -23047, -22948, -22852, -22754, -22655, -22556, -22461, -22362, -22263, -22165, -22069, -21970, 
-        -21872, -21773, -21677, -21579, -21480, -21381, -21286, -21187, -21088, -20990, -20894, -20795, 
-        -20697, -20598, -20499, -20404, -20305, -20206, -20107, -20012, -19913, -19815, -19716, -19620, 
-        -19522, -19423, -19327, -19229, -19130, -19031, -18932, -18837, -18735, -18646, -18535, -18458, 
-        -18331, -18269, -18124, -18084, -17915, -17902, -17702, -17730, -17483, -17557, -17258, -17394, 
-        -17027, -17242, -16777, -17107, -16508, -17002, -16197, -16959, -15784, -17101, -14994, -18272 
-    };
-
-    // AKWF_blended_0014 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0014[600] PROGMEM = {
-        114, 331, 548, 768, 984, 1201, 1418, 1638, 1854, 2071, 2291, 2507, 
-        2727, 2944, 3161, 3377, 3597, 3814, 4034, 4251, 4467, 4687, 4904, 5121, 
-        5337, 5557, 5774, 5994, 6210, 6427, 6647, 6864, 7080, 7297, 7517, 7734, 
-        7954, 8170, 8387, 8607, 8823, 9040, 9257, 9477, 9693, 9913, 10130, 10347, 
-        10567, 10783, 11000, 11217, 11436, 11653, 11873, 12090, 12306, 12526, 12743, 12960, 
-        13176, 13396, 13613, 13833, 14049, 14266, 14486, 14703, 14919, 15139, 15356, 15573, 
-        15793, 16009, 16229, 16446, 16663, 16879, 17096, 17316, 17532, 17752, 17969, 18189, 
-        18406, 18622, 18839, 19056, 19276, 19492, 19712, 19929, 20149, 20365, 20582, 20799, 
-        21019, 21235, 21452, 21672, 21889, 22109, 22325, 22542, 22759, 22975, 23195, 23412, 
-        23632, 23848, 24068, 24285, 24502, 24718, 24938, 25155, 25372, 25592, 25808, 26028, 
-        26245, 26461, 26678, 26898, 27115, 27335, 27551, 27768, 27988, 28205, 28421, 28638, 
-        28858, 29074, 29294, 29511, 29728, 29948, 30164, 30381, 30598, 30818, 31034, 31251, 
-        31471, 31687, 31907, 32124, 32341, 32557, 32548, 32541, 32531, 32521, 32511, 32505, 
-        32495, 32485, 32475, 32469, 32456, 32449, 32439, 32429, 32420, 32410, 32400, 32390, 
-        32383, 32374, 32364, 32354, 32344, 32337, 32328, 32318, 32308, 32298, 32292, 32282, 
-        32272, 32262, 32252, 32242, 32236, 32226, 32216, 32206, 32196, 32186, 32180, 32170, 
-        32160, 32150, 32141, 32134, 32124, 32114, 32104, 32095, 32085, 32078, 32068, 32058, 
-        32049, 32039, 32032, 32022, 32012, 32003, 31993, 31983, 31973, 31967, 31957, 31947, 
-        31937, 31927, 31921, 31911, 31901, 31891, 31881, 31875, 31865, 31855, 31845, 31835, 
-        31825, 31819, 31809, 31799, 31789, 31779, 31770, 31760, 31753, 31743, 31733, 31724, 
-        31717, 31707, 31697, 31687, 31678, 31668, 31658, 31651, 31642, 31632, 31622, 31615, 
-        31605, 31596, 31586, 31576, 31566, 31556, 31550, 31540, 31530, 31520, 31510, 31504, 
-        31494, 31484, 31474, 31464, 31454, 31448, 31438, 31428, 31418, 31408, 31399, 31392, 
-        31382, 31372, 31363, 31353, 31346, 31336, 31326, 31317, 31307, 31300, 31290, 31280, 
-        31271, 31261, 31251, 31241, 31234, 31225, 31215, 31205, 31195, 31189, 31179, 31169, 
-        -31385, -31395, -31405, -31415, -31422, -31431, -31441, -31451, -31461, -31468, -31481, -31487, 
-        -31497, -31507, -31517, -31527, -31533, -31543, -31553, -31563, -31573, -31582, -31589, -31599, 
-        -31609, -31619, -31625, -31638, -31645, -31655, -31665, -31674, -31684, -31694, -31701, -31710, 
-        -31720, -31730, -31740, -31747, -31756, -31766, -31776, -31786, -31793, -31802, -31812, -31822, 
-        -31832, -31842, -31852, -31858, -31868, -31878, -31888, -31898, -31904, -31914, -31924, -31934, 
-        -31944, -31950, -31960, -31970, -31980, -31990, -31999, -32006, -32016, -32026, -32035, -32045, 
-        -32055, -32062, -32072, -32081, -32091, -32101, -32111, -32118, -32127, -32137, -32147, -32157, 
-        -32163, -32173, -32183, -32193, -32203, -32209, -32223, -32229, -32239, -32249, -32259, -32269, 
-        -32278, -32285, -32295, -32305, -32314, -32324, -32331, -32341, -32351, -32360, -32370, -32377, 
-        -32387, -32397, -32406, -32416, -32426, -32436, -32443, -32452, -32462, -32472, -32482, -32488, 
-        -32498, -32508, -32518, -32528, -32534, -32544, -32554, -32564, -32574, -32584, -32594, -32600, 
-        -32610, -32620, -32630, -32639, -32646, -32656, -32666, -32676, -32685, -32695, -32702, -32712, 
-        -32722, -32731, -32741, -32748, -32758, -32767, -32548, -32331, -32114, -31898, -31681, -31461, 
-        -31244, -31024, -30808, -30591, -30371, -30154, -29938, -29721, -29501, -29285, -29065, -28848, 
-        -28631, -28411, -28195, -27978, -27758, -27541, -27325, -27105, -26888, -26668, -26452, -26235, 
-        -26018, -25802, -25582, -25365, -25145, -24928, -24708, -24492, -24275, -24058, -23839, -23622, 
-        -23405, -23185, -22969, -22749, -22532, -22315, -22099, -21879, -21662, -21445, -21225, -21009, 
-        -20789, -20572, -20356, -20139, -19922, -19702, -19486, -19266, -19049, -18829, -18612, -18396, 
-        -18179, -17959, -17743, -17526, -17306, -17089, -16869, -16653, -16436, -16219, -15999, -15783, 
-        -15566, -15346, -15130, -14910, -14693, -14476, -14260, -14040, -13823, -13606, -13386, -13170, 
-        -12950, -12733, -12516, -12300, -12080, -11863, -11643, -11427, -11210, -10990, -10773, -10557, 
-        -10340, -10120, -9903, -9687, -9467, -9250, -9030, -8814, -8597, -8380, -8160, -7944, 
-        -7727, -7507, -7290, -7070, -6854, -6637, -6420, -6201, -5984, -5764, -5547, -5331, 
-        -5111, -4894, -4677, -4457, -4241, -4024, -3804, -3588, -3371, -3151, -2934, -2718, 
-        -2501, -2281, -2064, -1844, -1628, -1411, -1191, -974, -758, -541, -321, -105 
-    };
-
-    // AKWF_blended_0015 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0015[600] PROGMEM = {
-        16464, 16520, 16575, 16630, 16683, 16738, 16793, 16849, 16904, 16957, 17012, 17067, 
-        17123, 17176, 17231, 17286, 17341, 17395, 17450, 17505, 17560, 17613, 17669, 17724, 
-        17779, 17832, 17887, 17942, 17996, 18051, 18106, 18161, 18216, 18272, 18325, 18380, 
-        18435, 18489, 18544, 18599, 18654, 18707, 18762, 18818, 18873, 18926, 18981, 19036, 
-        19091, 19145, 19200, 19255, 19310, 19365, 19419, 19474, 19529, 19584, 19638, 19693, 
-        19748, 19803, 19856, 19911, 19967, 20022, 20075, 20130, 20185, 20240, 20294, 20349, 
-        20404, 20459, 20513, 20568, 20623, 20678, 20733, 20787, 20842, 20897, 20952, 21005, 
-        21060, 21116, 21169, 21224, 21279, 21334, 21388, 21443, 21498, 21553, 21607, 21662, 
-        21717, 21772, 21827, 21880, 21936, 21991, 22046, 22099, 22154, 22209, 22265, 22318, 
-        22373, 22428, 22483, 22537, 22592, 22647, 22702, 22756, 22811, 22866, 22921, 22974, 
-        23029, 23085, 23140, 23195, 23248, 23303, 23358, 23414, 23467, 23522, 23577, 23631, 
-        23686, 23741, 23796, 23849, 23905, 23960, 24015, 24068, 24123, 24178, 24234, 24287, 
-        24342, 24397, 24452, 24507, 24561, 24616, 24671, 24726, 24780, 24835, 24890, 24945, 
-        24998, 25054, 25109, 25164, 25217, 25272, 25327, 25383, 25436, 25491, 25546, 25601, 
-        25656, 25710, 25765, 25820, 25875, 25929, 25984, 26039, 26094, 26147, 26203, 26258, 
-        26311, 26366, 26421, 26476, 26530, 26585, 26640, 26695, 26749, 26804, 26859, 26914, 
-        26969, 27023, 27078, 27133, 27188, 27241, 27296, 27352, 27407, 27460, 27515, 27570, 
-        27625, 27679, 27734, 27789, 27844, 27898, 27953, 28008, 28063, 28118, 28172, 28227, 
-        28282, 28337, 28390, 28445, 28501, 28556, 28609, 28664, 28719, 28773, 28828, 28883, 
-        28938, 28991, 29047, 29102, 29157, 29210, 29265, 29321, 29376, 29431, 29484, 29539, 
-        29594, 29650, 29703, 29758, 29813, 29868, 29922, 29977, 30032, 30087, 30140, 30196, 
-        30251, 30306, 30359, 30414, 30470, 30525, 30578, 30633, 30688, 30743, 30799, 30852, 
-        30907, 30962, 31017, 31071, 31126, 31181, 31236, 31289, 31345, 31400, 31453, 31508, 
-        31563, 31619, 31672, 31727, 31782, 31837, 31892, 31946, 32001, 32056, 32111, 32165, 
-        32220, 32275, 32330, 32383, 32438, 32494, 32549, 32602, 32657, 32712, 32767, -16411, 
-        -32767, -32712, -32657, -32602, -32549, -32494, -32438, -32383, -32330, -32275, -32220, -32165, 
-        -32111, -32056, -32001, -31946, -31892, -31837, -31782, -31727, -31672, -31619, -31563, -31508, 
-        -31453, -31400, -31345, -31289, -31236, -31181, -31126, -31071, -31017, -30962, -30907, -30852, 
-        -30799, -30743, -30688, -30633, -30578, -30525, -30470, -30414, -30359, -30306, -30251, -30196, 
-        -30140, -30087, -30032, -29977, -29922, -29868, -29813, -29758, -29703, -29650, -29594, -29539, 
-        -29484, -29431, -29376, -29321, -29265, -29210, -29157, -29102, -29047, -28991, -28938, -28883, 
-        -28828, -28773, -28719, -28664, -28609, -28556, -28501, -28445, -28390, -28337, -28282, -28227, 
-        -28172, -28118, -28063, -28008, -27953, -27898, -27844, -27789, -27734, -27679, -27625, -27570, 
-        -27515, -27460, -27407, -27352, -27296, -27241, -27188, -27133, -27078, -27023, -26969, -26914, 
-        -26859, -26804, -26749, -26695, -26640, -26585, -26530, -26476, -26421, -26366, -26311, -26258, 
-        -26203, -26147, -26094, -26039, -25984, -25929, -25875, -25820, -25765, -25710, -25656, -25601, 
-        -25546, -25491, -25436, -25383, -25327, -25272, -25217, -25164, -25109, -25054, -24998, -24945, 
-        -24890, -24835, -24780, -24726, -24671, -24616, -24561, -24507, -24452, -24397, -24342, -24287, 
-        -24234, -24178, -24123, -24068, -24015, -23960, -23905, -23849, -23796, -23741, -23686, -23631, 
-        -23577, -23522, -23467, -23414, -23358, -23303, -23248, -23195, -23140, -23085, -23029, -22974, 
-        -22921, -22866, -22811, -22756, -22702, -22647, -22592, -22537, -22483, -22428, -22373, -22318, 
-        -22265, -22209, -22154, -22099, -22046, -21991, -21936, -21880, -21827, -21772, -21717, -21662, 
-        -21607, -21553, -21498, -21443, -21388, -21334, -21279, -21224, -21169, -21116, -21060, -21005, 
-        -20952, -20897, -20842, -20787, -20733, -20678, -20623, -20568, -20513, -20459, -20404, -20349, 
-        -20294, -20240, -20185, -20130, -20075, -20022, -19967, -19911, -19856, -19803, -19748, -19693, 
-        -19638, -19584, -19529, -19474, -19419, -19365, -19310, -19255, -19200, -19145, -19091, -19036, 
-        -18981, -18926, -18873, -18818, -18762, -18707, -18654, -18599, -18544, -18489, -18435, -18380, 
-        -18325, -18272, -18216, -18161, -18106, -18051, -17996, -17942, -17887, -17832, -17779, -17724, 
-        -17669, -17613, -17560, -17505, -17450, -17395, -17341, -17286, -17231, -17176, -17123, -17067, 
-        -17012, -16957, -16904, -16849, -16793, -16738, -16683, -16630, -16575, -16520, -16464, 0 
-    };
-
-    // AKWF_blended_0016 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0016[600] PROGMEM = {
-        41, 6544, 6916, 7290, 7663, 8035, 8408, 8781, 9154, 9526, 9898, 10270, 
-        10642, 11013, 11385, 11756, 12127, 12496, 12867, 13237, 13606, 13974, 14342, 14710, 
-        15078, 15444, 15811, 16178, 16543, 16908, 17272, 17635, 17996, 18361, 18721, 19085, 
-        19440, 19801, 19925, 19941, 19979, 20003, 20036, 20061, 20089, 20113, 20140, 20163, 
-        20187, 20210, 20231, 20251, 20271, 20289, 20306, 20322, 20337, 20351, 20364, 20375, 
-        20387, 20397, 20404, 20411, 20416, 20422, 20425, 20428, 20428, 20428, 20426, 20422, 
-        20419, 20412, 20405, 20397, 20387, 20375, 20363, 20348, 20333, 20316, 20297, 20276, 
-        20255, 20232, 20207, 20181, 20153, 20123, 20092, 20060, 20026, 19990, 19952, 19914, 
-        19873, 19829, 19785, 19740, 19692, 19644, 19591, 19540, 19484, 19428, 19370, 19311, 
-        19247, 19186, 19119, 19056, 18985, 19150, 19419, 19663, 19920, 20166, 20415, 20658, 
-        20903, 21144, 21383, 21621, 21857, 22091, 22323, 22552, 22780, 23006, 23231, 23454, 
-        23673, 23892, 24109, 24323, 24535, 24746, 24955, 25162, 25366, 25568, 25769, 25968, 
-        26164, 26359, 26552, 26743, 26932, 27119, 27303, 27487, 27668, 27847, 28023, 28199, 
-        28372, 28543, 28711, 28878, 29044, 29207, 29368, 29527, 29685, 29841, 29994, 30145, 
-        30294, 30442, 30587, 30731, 30872, 31013, 31150, 31286, 31420, 31552, 31682, 31811, 
-        31935, 32061, 32183, 32306, 32422, 32542, 32653, 32767, 32646, 32412, 32201, 31975, 
-        31756, 31529, 31304, 31075, 30847, 30615, 30381, 30146, 29909, 29671, 29430, 29188, 
-        28945, 28700, 28452, 28205, 27954, 27702, 27449, 27194, 26937, 26679, 26419, 26158, 
-        25895, 25630, 25364, 25097, 24828, 24557, 24286, 24013, 23738, 23462, 23185, 22906, 
-        22626, 22344, 22061, 21776, 21491, 21203, 20915, 20626, 20336, 20043, 19750, 19457, 
-        19161, 18864, 18567, 18267, 17966, 17665, 17364, 17061, 16755, 16451, 16144, 15836, 
-        15528, 15219, 14908, 14598, 14284, 13973, 13658, 13346, 13027, 12714, 12396, 12312, 
-        12337, 12337, 12348, 12351, 12359, 12362, 12368, 12370, 12375, 12376, 12378, 12379, 
-        12380, 12380, 12380, 12380, 12379, 12378, 12376, 12375, 12372, 12369, 12366, 12362, 
-        12358, 12355, 12351, 12346, 12341, 12337, 12332, 12327, 12321, 12317, 12311, 12305, 
-        -6088, -12223, -12229, -12235, -12239, -12245, -12249, -12254, -12259, -12264, -12269, -12271, 
-        -12276, -12280, -12283, -12287, -12290, -12291, -12294, -12295, -12297, -12298, -12298, -12298, 
-        -12298, -12297, -12295, -12294, -12291, -12288, -12286, -12280, -12276, -12269, -12266, -12254, 
-        -12252, -12242, -12467, -12799, -13108, -13428, -13739, -14056, -14366, -14680, -14990, -15302, 
-        -15610, -15919, -16226, -16533, -16837, -17143, -17446, -17749, -18049, -18349, -18649, -18946, 
-        -19243, -19539, -19833, -20126, -20418, -20708, -20998, -21287, -21573, -21859, -22143, -22426, 
-        -22708, -22988, -23267, -23544, -23820, -24095, -24368, -24640, -24911, -25179, -25446, -25712, 
-        -25977, -26240, -26501, -26761, -27019, -27276, -27531, -27784, -28036, -28287, -28534, -28782, 
-        -29027, -29270, -29512, -29753, -29992, -30228, -30463, -30697, -30929, -31158, -31386, -31611, 
-        -31838, -32058, -32282, -32497, -32717, -32697, -32568, -32462, -32339, -32224, -32099, -31979, 
-        -31853, -31729, -31598, -31470, -31337, -31204, -31068, -30929, -30790, -30649, -30504, -30359, 
-        -30212, -30061, -29910, -29757, -29602, -29444, -29286, -29125, -28962, -28796, -28629, -28461, 
-        -28290, -28115, -27941, -27764, -27585, -27404, -27221, -27037, -26850, -26661, -26470, -26277, 
-        -26082, -25885, -25687, -25486, -25283, -25078, -24872, -24664, -24453, -24240, -24025, -23809, 
-        -23591, -23371, -23148, -22924, -22698, -22470, -22241, -22007, -21775, -21539, -21301, -21062, 
-        -20820, -20576, -20331, -20084, -19837, -19583, -19335, -19079, -19056, -19141, -19199, -19270, 
-        -19329, -19395, -19453, -19512, -19566, -19622, -19675, -19726, -19774, -19822, -19869, -19913, 
-        -19955, -19996, -20034, -20072, -20108, -20142, -20174, -20205, -20235, -20263, -20289, -20314, 
-        -20337, -20360, -20380, -20398, -20415, -20430, -20445, -20457, -20469, -20480, -20487, -20494, 
-        -20501, -20506, -20508, -20510, -20511, -20510, -20507, -20504, -20500, -20494, -20487, -20479, 
-        -20469, -20457, -20447, -20433, -20419, -20405, -20388, -20371, -20353, -20333, -20313, -20292, 
-        -20271, -20247, -20222, -20197, -20172, -20143, -20118, -20087, -20061, -20026, -19996, -19730, 
-        -19355, -19004, -18637, -18279, -17914, -17553, -17188, -16826, -16459, -16095, -15729, -15362, 
-        -14996, -14628, -14260, -13892, -13523, -13155, -12784, -12414, -12045, -11673, -11302, -10931, 
-        -10560, -10188, -9816, -9444, -9071, -8699, -8326, -7953, -7581, -7208, -6834, -6462 
-    };
-
-    // AKWF_blended_0017 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0017[600] PROGMEM = {
-        85, 4709, 5150, 5593, 6036, 6479, 6920, 7363, 7804, 8247, 8688, 9130, 
-        9573, 10014, 10457, 10898, 11341, 11782, 12223, 12666, 13107, 13548, 13989, 14431, 
-        14870, 15313, 15754, 16195, 16634, 17077, 17516, 17959, 18396, 18841, 19276, 19723, 
-        20152, 20595, 20548, 20277, 20054, 19805, 19573, 19329, 19093, 18851, 18613, 18371, 
-        18131, 17891, 17651, 17409, 17169, 16927, 16685, 16443, 16203, 15961, 15717, 15475, 
-        15233, 14989, 14748, 14504, 14260, 14018, 13772, 13528, 13284, 13038, 12795, 12551, 
-        12305, 12059, 11813, 11567, 11321, 11074, 10828, 10580, 10334, 10085, 9837, 9589, 
-        9341, 9093, 8844, 8594, 8344, 8094, 7845, 7595, 7343, 7094, 6842, 6590, 
-        6338, 6085, 5833, 5580, 5328, 5074, 4821, 4567, 4311, 4058, 3800, 3548, 
-        3289, 3039, 2774, 2528, 2267, 2497, 2950, 3353, 3785, 4196, 4622, 5037, 
-        5459, 5874, 6294, 6711, 7129, 7546, 7962, 8379, 8795, 9210, 9626, 10042, 
-        10455, 10871, 11284, 11696, 12110, 12523, 12935, 13349, 13760, 14170, 14582, 14993, 
-        15403, 15813, 16223, 16632, 17042, 17450, 17858, 18265, 18673, 19081, 19487, 19894, 
-        20300, 20706, 21110, 21516, 21920, 22325, 22729, 23131, 23535, 23939, 24341, 24743, 
-        25145, 25547, 25949, 26349, 26748, 27148, 27548, 27948, 28346, 28746, 29144, 29542, 
-        29938, 30338, 30733, 31133, 31523, 31927, 32313, 32711, 32621, 32303, 32036, 31741, 
-        31464, 31173, 30893, 30604, 30321, 30032, 29747, 29459, 29172, 28885, 28596, 28307, 
-        28021, 27732, 27443, 27152, 26864, 26573, 26282, 25991, 25701, 25410, 25119, 24827, 
-        24536, 24243, 23951, 23658, 23365, 23071, 22778, 22483, 22189, 21896, 21602, 21307, 
-        21010, 20716, 20419, 20125, 19828, 19532, 19235, 18938, 18642, 18345, 18047, 17748, 
-        17452, 17153, 16855, 16556, 16258, 15959, 15661, 15360, 15062, 14761, 14461, 14162, 
-        13862, 13561, 13261, 12960, 12658, 12359, 12055, 11759, 11450, 11158, 10853, 11037, 
-        11446, 11805, 12192, 12560, 12943, 13314, 13692, 14067, 14443, 14818, 15192, 15567, 
-        15944, 16318, 16693, 17067, 17442, 17817, 18191, 18566, 18940, 19315, 19688, 20062, 
-        20437, 20811, 21186, 21559, 21933, 22306, 22681, 23055, 23428, 23802, 24177, 24552, 
-        -20571, -24380, -24005, -23631, -23258, -22883, -22511, -22136, -21762, -21387, -21014, -20640, 
-        -20265, -19892, -19518, -19143, -18769, -18394, -18019, -17645, -17270, -16896, -16521, -16146, 
-        -15772, -15395, -15021, -14646, -14271, -13895, -13520, -13144, -12771, -12391, -12020, -11636, 
-        -11271, -10890, -11000, -11333, -11618, -11930, -12225, -12531, -12828, -13132, -13431, -13733, 
-        -14032, -14334, -14632, -14933, -15231, -15532, -15830, -16131, -16429, -16728, -17026, -17325, 
-        -17623, -17920, -18218, -18515, -18814, -19110, -19407, -19703, -20000, -20296, -20591, -20888, 
-        -21182, -21477, -21771, -22066, -22361, -22655, -22950, -23242, -23535, -23830, -24122, -24413, 
-        -24706, -24998, -25291, -25582, -25872, -26163, -26454, -26745, -27033, -27324, -27613, -27904, 
-        -28192, -28479, -28768, -29057, -29343, -29630, -29917, -30204, -30491, -30775, -31064, -31345, 
-        -31636, -31915, -32206, -32481, -32767, -32565, -32137, -31759, -31351, -30963, -30561, -30167, 
-        -29767, -29373, -28973, -28575, -28175, -27777, -27377, -26979, -26577, -26177, -25777, -25375, 
-        -24975, -24571, -24169, -23767, -23365, -22961, -22558, -22154, -21750, -21344, -20940, -20534, 
-        -20129, -19723, -19315, -18909, -18501, -18096, -17686, -17278, -16870, -16461, -16053, -15641, 
-        -15231, -14822, -14412, -14000, -13589, -13177, -12765, -12352, -11938, -11526, -11113, -10699, 
-        -10284, -9870, -9454, -9039, -8623, -8208, -7792, -7374, -6957, -6539, -6122, -5704, 
-        -5287, -4865, -4450, -4026, -3613, -3184, -2774, -2349, -2415, -2704, -2944, -3211, 
-        -3459, -3720, -3972, -4229, -4481, -4739, -4990, -5246, -5498, -5751, -6005, -6257, 
-        -6508, -6760, -7012, -7263, -7515, -7765, -8016, -8266, -8516, -8766, -9015, -9263, 
-        -9513, -9761, -10008, -10256, -10504, -10752, -10998, -11245, -11491, -11739, -11985, -12229, 
-        -12475, -12720, -12966, -13210, -13456, -13700, -13944, -14188, -14431, -14675, -14917, -15161, 
-        -15403, -15647, -15889, -16131, -16373, -16615, -16857, -17099, -17339, -17580, -17820, -18060, 
-        -18302, -18542, -18782, -19022, -19264, -19500, -19744, -19978, -20224, -20452, -20696, -20449, 
-        -19976, -19553, -19102, -18669, -18224, -17787, -17344, -16905, -16463, -16024, -15583, -15142, 
-        -14701, -14260, -13819, -13378, -12935, -12494, -12053, -11610, -11169, -10726, -10285, -9843, 
-        -9402, -8959, -8518, -8075, -7634, -7191, -6748, -6307, -5864, -5423, -4981, -4538 
-    };
-
-    // AKWF_blended_0018 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0018[600] PROGMEM = {
-        76, 6791, 7195, 7597, 8001, 8403, 8805, 9209, 9611, 10015, 10417, 10819, 
-        11223, 11625, 12028, 12430, 12834, 13236, 13638, 14040, 14442, 14844, 15244, 15647, 
-        16049, 16451, 16851, 17253, 17654, 18056, 18456, 18858, 19257, 19661, 20057, 20463, 
-        20855, 21258, 21227, 20998, 20810, 20600, 20403, 20197, 19999, 19794, 19592, 19388, 
-        19186, 18982, 18778, 18575, 18371, 18167, 17964, 17758, 17554, 17349, 17143, 16938, 
-        16732, 16527, 16320, 16114, 15907, 15700, 15492, 15285, 15078, 14869, 14662, 14453, 
-        14244, 14035, 13826, 13615, 13406, 13195, 12984, 12773, 12563, 12350, 12139, 11927, 
-        11714, 11501, 11289, 11075, 10862, 10648, 10431, 10217, 10003, 9787, 9571, 9354, 
-        9138, 8922, 8704, 8486, 8269, 8051, 7831, 7613, 7392, 7174, 6952, 6734, 
-        6510, 6293, 6065, 5852, 5626, 5833, 6240, 6603, 6990, 7360, 7741, 8114, 
-        8492, 8866, 9241, 9615, 9989, 10362, 10736, 11108, 11482, 11852, 12224, 12596, 
-        12966, 13337, 13707, 14075, 14446, 14814, 15182, 15551, 15918, 16284, 16651, 17018, 
-        17383, 17749, 18114, 18479, 18842, 19205, 19569, 19932, 20295, 20656, 21018, 21379, 
-        21740, 22100, 22460, 22821, 23179, 23538, 23896, 24254, 24612, 24968, 25326, 25682, 
-        26038, 26392, 26748, 27102, 27457, 27811, 28164, 28516, 28869, 29221, 29572, 29924, 
-        30275, 30628, 30975, 31327, 31673, 32029, 32367, 32720, 32636, 32355, 32116, 31852, 
-        31604, 31343, 31090, 30833, 30578, 30319, 30064, 29806, 29549, 29290, 29032, 28773, 
-        28514, 28254, 27993, 27733, 27473, 27212, 26952, 26690, 26428, 26165, 25903, 25639, 
-        25375, 25113, 24849, 24585, 24320, 24056, 23790, 23524, 23258, 22993, 22727, 22460, 
-        22194, 21926, 21659, 21391, 21122, 20855, 20585, 20316, 20049, 19778, 19508, 19239, 
-        18968, 18699, 18428, 18157, 17886, 17615, 17344, 17071, 16798, 16527, 16254, 15981, 
-        15709, 15436, 15163, 14890, 14614, 14343, 14066, 13797, 13516, 13250, 12972, 13128, 
-        13482, 13794, 14128, 14449, 14779, 15101, 15429, 15751, 16079, 16401, 16727, 17051, 
-        17377, 17700, 18026, 18350, 18674, 18998, 19321, 19645, 19969, 20293, 20617, 20940, 
-        21264, 21588, 21912, 22235, 22559, 22881, 23205, 23528, 23852, 24174, 24498, 24821, 
-        -18679, -24670, -24348, -24024, -23700, -23377, -23053, -22731, -22406, -22084, -21760, -21437, 
-        -21113, -20789, -20465, -20142, -19818, -19494, -19170, -18846, -18522, -18197, -17873, -17549, 
-        -17225, -16901, -16575, -16251, -15926, -15601, -15276, -14949, -14626, -14297, -13976, -13645, 
-        -13328, -12998, -13103, -13406, -13664, -13950, -14217, -14495, -14766, -15043, -15314, -15588, 
-        -15859, -16134, -16405, -16678, -16950, -17223, -17494, -17765, -18036, -18307, -18578, -18849, 
-        -19120, -19390, -19661, -19930, -20199, -20468, -20736, -21005, -21274, -21542, -21809, -22077, 
-        -22344, -22612, -22878, -23143, -23411, -23676, -23942, -24206, -24472, -24736, -25000, -25264, 
-        -25528, -25792, -26054, -26318, -26578, -26840, -27102, -27363, -27625, -27885, -28146, -28406, 
-        -28665, -28923, -29184, -29441, -29699, -29956, -30215, -30472, -30729, -30984, -31242, -31494, 
-        -31754, -32004, -32264, -32509, -32767, -32590, -32213, -31878, -31520, -31177, -30822, -30475, 
-        -30123, -29774, -29421, -29071, -28718, -28365, -28013, -27659, -27304, -26950, -26596, -26242, 
-        -25885, -25529, -25173, -24817, -24459, -24102, -23746, -23386, -23028, -22669, -22309, -21949, 
-        -21588, -21228, -20867, -20506, -20142, -19781, -19418, -19055, -18692, -18327, -17962, -17597, 
-        -17232, -16867, -16500, -16134, -15767, -15399, -15032, -14663, -14293, -13925, -13556, -13186, 
-        -12814, -12444, -12074, -11702, -11330, -10958, -10584, -10212, -9838, -9463, -9091, -8713, 
-        -8341, -7962, -7588, -7209, -6837, -6455, -6084, -5704, -5757, -6008, -6215, -6446, 
-        -6660, -6887, -7103, -7326, -7544, -7764, -7983, -8201, -8419, -8637, -8855, -9073, 
-        -9289, -9507, -9723, -9937, -10153, -10369, -10584, -10798, -11013, -11225, -11439, -11652, 
-        -11866, -12079, -12290, -12502, -12713, -12926, -13136, -13347, -13556, -13767, -13976, -14185, 
-        -14394, -14603, -14812, -15021, -15229, -15436, -15645, -15852, -16058, -16265, -16472, -16678, 
-        -16883, -17089, -17296, -17500, -17705, -17910, -18114, -18318, -18523, -18727, -18931, -19133, 
-        -19338, -19538, -19744, -19944, -20150, -20350, -20555, -20752, -20961, -21152, -21358, -21127, 
-        -20699, -20314, -19905, -19510, -19104, -18708, -18304, -17905, -17503, -17103, -16701, -16300, 
-        -15896, -15496, -15094, -14692, -14290, -13888, -13485, -13083, -12681, -12279, -11877, -11473, 
-        -11071, -10669, -10267, -9863, -9461, -9059, -8655, -8253, -7849, -7447, -7043, -6641 
-    };
-
-    // AKWF_blended_0019 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0019[600] PROGMEM = {
-        87, 6027, 6481, 6935, 7389, 7842, 8296, 8750, 9202, 9656, 10109, 10561, 
-        11014, 11467, 11919, 12370, 12823, 13274, 13725, 14176, 14625, 15076, 15525, 15975, 
-        16423, 16871, 17319, 17766, 18213, 18659, 19104, 19550, 19994, 20440, 20880, 21328, 
-        21762, 22207, 22275, 22167, 22096, 22005, 21927, 21838, 21755, 21665, 21579, 21490, 
-        21402, 21311, 21220, 21128, 21036, 20942, 20848, 20753, 20656, 20559, 20460, 20360, 
-        20260, 20158, 20055, 19952, 19846, 19741, 19634, 19526, 19416, 19306, 19193, 19081, 
-        18967, 18852, 18735, 18618, 18498, 18378, 18256, 18133, 18010, 17883, 17756, 17628, 
-        17499, 17368, 17235, 17102, 16966, 16829, 16691, 16552, 16410, 16267, 16124, 15979, 
-        15832, 15682, 15533, 15382, 15228, 15074, 14917, 14760, 14600, 14442, 14277, 14115, 
-        13946, 13783, 13609, 13446, 13270, 13471, 13843, 14176, 14526, 14864, 15207, 15542, 
-        15881, 16215, 16549, 16880, 17211, 17539, 17867, 18190, 18513, 18835, 19155, 19472, 
-        19787, 20103, 20415, 20726, 21034, 21342, 21647, 21952, 22253, 22553, 22852, 23148, 
-        23443, 23735, 24026, 24317, 24604, 24890, 25130, 25369, 25604, 25840, 26072, 26303, 
-        26532, 26760, 26986, 27209, 27431, 27653, 27871, 28088, 28302, 28516, 28727, 28938, 
-        29146, 29352, 29557, 29758, 29960, 30160, 30357, 30553, 30747, 30939, 31130, 31319, 
-        31505, 31693, 31873, 32059, 32236, 32421, 32589, 32767, 32567, 32192, 31853, 31492, 
-        31142, 30782, 30426, 30065, 29704, 29341, 28976, 28610, 28242, 27873, 27503, 27129, 
-        26755, 26381, 26004, 25626, 25245, 24864, 24482, 24097, 23712, 23325, 22937, 22546, 
-        22155, 21762, 21368, 20973, 20577, 20178, 19778, 19378, 18976, 18573, 18168, 17763, 
-        17357, 16948, 16538, 16127, 15716, 15304, 14888, 14474, 14057, 13640, 13221, 12803, 
-        12381, 11959, 11536, 11113, 10688, 10261, 9835, 9407, 8979, 8550, 8119, 7688, 
-        7255, 6823, 6387, 5953, 5516, 5082, 4642, 4208, 3763, 3332, 2889, 2822, 
-        2929, 2995, 3083, 3156, 3238, 3313, 3393, 3467, 3544, 3620, 3695, 3769, 
-        3843, 3917, 3989, 4063, 4135, 4208, 4278, 4351, 4422, 4492, 4563, 4632, 
-        4703, 4773, 4842, 4911, 4980, 5050, 5117, 5187, 5256, 5324, 5393, 5461, 
-        43, -5374, -5305, -5236, -5168, -5099, -5030, -4962, -4893, -4823, -4754, -4685, 
-        -4616, -4545, -4475, -4405, -4334, -4263, -4191, -4120, -4048, -3975, -3903, -3829, 
-        -3755, -3681, -3607, -3532, -3457, -3380, -3304, -3226, -3150, -3069, -2995, -2909, 
-        -2836, -2753, -3046, -3510, -3938, -4385, -4817, -5257, -5691, -6130, -6563, -6998, 
-        -7431, -7863, -8294, -8725, -9155, -9583, -10010, -10437, -10863, -11288, -11713, -12135, 
-        -12556, -12978, -13397, -13815, -14232, -14650, -15065, -15479, -15892, -16304, -16714, -17123, 
-        -17533, -17939, -18345, -18748, -19152, -19553, -19955, -20354, -20753, -21148, -21544, -21938, 
-        -22330, -22723, -23112, -23500, -23888, -24273, -24657, -25039, -25422, -25801, -26180, -26557, 
-        -26932, -27305, -27679, -28048, -28418, -28786, -29152, -29517, -29880, -30240, -30602, -30957, 
-        -31318, -31669, -32027, -32372, -32724, -32700, -32498, -32335, -32147, -31973, -31785, -31605, 
-        -31418, -31233, -31042, -30853, -30659, -30465, -30269, -30072, -29872, -29672, -29469, -29264, 
-        -29058, -28850, -28639, -28429, -28215, -28001, -27784, -27565, -27343, -27122, -26899, -26672, 
-        -26444, -26215, -25984, -25752, -25516, -25281, -24998, -24714, -24428, -24140, -23851, -23560, 
-        -23268, -22972, -22675, -22378, -22076, -21775, -21471, -21167, -20859, -20551, -20238, -19926, 
-        -19612, -19296, -18978, -18659, -18338, -18014, -17690, -17363, -17035, -16704, -16373, -16039, 
-        -15705, -15367, -15031, -14688, -14351, -14002, -13665, -13314, -13340, -13537, -13694, -13872, 
-        -14032, -14203, -14365, -14530, -14688, -14848, -15005, -15162, -15316, -15470, -15621, -15770, 
-        -15919, -16066, -16212, -16355, -16498, -16638, -16778, -16917, -17054, -17189, -17323, -17456, 
-        -17586, -17716, -17843, -17971, -18097, -18221, -18344, -18465, -18585, -18705, -18822, -18939, 
-        -19055, -19169, -19281, -19393, -19504, -19614, -19721, -19829, -19934, -20040, -20143, -20246, 
-        -20348, -20448, -20548, -20646, -20743, -20840, -20936, -21030, -21123, -21216, -21308, -21399, 
-        -21490, -21578, -21667, -21753, -21841, -21925, -22013, -22093, -22182, -22258, -22343, -22050, 
-        -21584, -21154, -20703, -20265, -19817, -19375, -18929, -18484, -18037, -17591, -17143, -16695, 
-        -16247, -15798, -15348, -14900, -14449, -14000, -13549, -13098, -12647, -12195, -11744, -11291, 
-        -10839, -10386, -9933, -9481, -9027, -8574, -8120, -7666, -7212, -6760, -6306, -5852 
-    };
-
-    // AKWF_blended_0021 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0021[600] PROGMEM = {
-        16727, 17069, 17412, 17755, 18096, 18438, 18778, 19116, 19454, 19790, 20125, 20459, 
-        20790, 21120, 21447, 21772, 22095, 22415, 22733, 23047, 23359, 23668, 23974, 24277, 
-        24576, 24871, 25162, 25450, 25735, 26014, 26289, 26560, 26827, 27090, 27347, 27599, 
-        27847, 28090, 28327, 28559, 28787, 29007, 29224, 29433, 29639, 29838, 30030, 30217, 
-        30398, 30573, 30741, 30903, 31059, 31208, 31351, 31487, 31616, 31740, 31856, 31965, 
-        32068, 32164, 32253, 32335, 32409, 32477, 32538, 32592, 32638, 32678, 32710, 32735, 
-        32753, 32764, 32767, 32764, 32753, 32735, 32710, 32678, 32638, 32592, 32538, 32477, 
-        32409, 32334, 32253, 32163, 32068, 31965, 31856, 31740, 31616, 31487, 31351, 31208, 
-        31058, 30903, 30741, 30572, 30397, 30216, 30030, 29836, 29637, 29433, 29223, 29007, 
-        28785, 28559, 28327, 28088, 27846, 27598, 27345, 27089, 26827, 26560, 26289, 26013, 
-        25733, 25450, 25162, 24871, 24575, 24276, 23974, 23667, 23359, 23047, 22732, 22415, 
-        22094, 21770, 21446, 21118, 20789, 20458, 20124, 19790, 19453, 19115, 18776, 18436, 
-        18096, 17753, 17412, 17069, 16726, 16383, 16040, 15698, 15355, 15012, 14671, 14329, 
-        13989, 13651, 13313, 12977, 12642, 12308, 11977, 11647, 11320, 10995, 10672, 10351, 
-        10034, 9720, 9407, 9099, 8792, 8490, 8191, 7896, 7605, 7316, 7032, 6753, 
-        6478, 6206, 5940, 5677, 5420, 5168, 4920, 4677, 4440, 4208, 3980, 3760, 
-        3543, 3332, 3128, 2929, 2737, 2550, 2369, 2194, 2026, 1864, 1708, 1559, 
-        1416, 1279, 1149, 1026, 911, 802, 699, 603, 514, 432, 358, 290, 
-        229, 175, 129, 89, 57, 32, 14, 3, 0, 3, 14, 32, 
-        57, 89, 129, 175, 229, 290, 358, 432, 514, 603, 699, 802, 
-        911, 1027, 1151, 1280, 1416, 1559, 1708, 1864, 2026, 2194, 2370, 2551, 
-        2737, 2929, 3128, 3334, 3544, 3760, 3982, 4208, 4440, 4677, 4920, 5168, 
-        5420, 5678, 5940, 6207, 6478, 6754, 7034, 7317, 7605, 7896, 8192, 8490, 
-        8793, 9099, 9408, 9720, 10034, 10352, 10673, 10995, 11321, 11649, 11977, 12309, 
-        12643, 12977, 13313, 13651, 13991, 14331, 14671, 15012, 15355, 15698, 16040, 0, 
-        -16040, -15698, -15355, -15012, -14671, -14329, -13989, -13651, -13313, -12977, -12642, -12308, 
-        -11977, -11647, -11320, -10995, -10672, -10351, -10034, -9720, -9407, -9099, -8792, -8490, 
-        -8191, -7896, -7605, -7316, -7032, -6753, -6478, -6206, -5940, -5677, -5420, -5168, 
-        -4920, -4677, -4440, -4208, -3980, -3760, -3543, -3332, -3128, -2929, -2737, -2550, 
-        -2369, -2194, -2026, -1864, -1708, -1559, -1416, -1279, -1149, -1026, -911, -802, 
-        -699, -603, -514, -432, -358, -290, -229, -175, -129, -89, -57, -32, 
-        -14, -3, 0, -3, -14, -32, -57, -89, -129, -175, -229, -290, 
-        -358, -432, -514, -603, -699, -802, -911, -1027, -1151, -1280, -1416, -1559, 
-        -1708, -1864, -2026, -2194, -2370, -2551, -2737, -2929, -3128, -3334, -3544, -3760, 
-        -3982, -4208, -4440, -4677, -4920, -5168, -5420, -5678, -5940, -6207, -6478, -6754, 
-        -7034, -7317, -7605, -7896, -8192, -8490, -8793, -9099, -9408, -9720, -10034, -10352, 
-        -10673, -10995, -11321, -11649, -11977, -12309, -12643, -12977, -13313, -13651, -13991, -14331, 
-        -14671, -15012, -15355, -15698, -16040, -16384, -16727, -17069, -17412, -17755, -18096, -18438, 
-        -18778, -19116, -19454, -19790, -20125, -20459, -20790, -21120, -21447, -21772, -22095, -22415, 
-        -22733, -23047, -23359, -23668, -23974, -24277, -24576, -24871, -25162, -25450, -25735, -26014, 
-        -26289, -26560, -26827, -27090, -27347, -27599, -27847, -28090, -28327, -28559, -28787, -29007, 
-        -29224, -29433, -29639, -29838, -30030, -30217, -30398, -30573, -30741, -30903, -31059, -31208, 
-        -31351, -31487, -31616, -31740, -31856, -31965, -32068, -32164, -32253, -32335, -32409, -32477, 
-        -32538, -32592, -32638, -32678, -32710, -32735, -32753, -32764, -32767, -32764, -32753, -32735, 
-        -32710, -32678, -32638, -32592, -32538, -32477, -32409, -32334, -32253, -32163, -32068, -31965, 
-        -31856, -31740, -31616, -31487, -31351, -31208, -31058, -30903, -30741, -30572, -30397, -30216, 
-        -30030, -29836, -29637, -29433, -29223, -29007, -28785, -28559, -28327, -28088, -27846, -27598, 
-        -27345, -27089, -26827, -26560, -26289, -26013, -25733, -25450, -25162, -24871, -24575, -24276, 
-        -23974, -23667, -23359, -23047, -22732, -22415, -22094, -21770, -21446, -21118, -20789, -20458, 
-        -20124, -19790, -19453, -19115, -18776, -18436, -18096, -17753, -17412, -17069, -16726, 0 
-    };
-
-    // AKWF_blended_0022 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0022[600] PROGMEM = {
-        140, 721, 1301, 1881, 2461, 3041, 3618, 4195, 4770, 5343, 5916, 6487, 
-        7055, 7620, 8184, 8744, 9302, 9856, 10408, 10955, 11501, 12041, 12578, 13112, 
-        13639, 14163, 14682, 15198, 15707, 16211, 16711, 17205, 17694, 18175, 18653, 19123, 
-        19587, 20047, 20499, 20944, 21382, 21812, 22237, 22656, 23066, 23469, 23863, 24252, 
-        24633, 25003, 25369, 25725, 26073, 26414, 26747, 27070, 27384, 27691, 27991, 28279, 
-        28559, 28831, 29095, 29349, 29594, 29831, 30059, 30276, 30487, 30686, 30876, 31059, 
-        31230, 31393, 31548, 31693, 31828, 31955, 32072, 32181, 32280, 32369, 32448, 32520, 
-        32583, 32636, 32680, 32715, 32741, 32758, 32767, 32767, 32758, 32739, 32713, 32680, 
-        32636, 32585, 32524, 32456, 32380, 32298, 32204, 32103, 31998, 31883, 31761, 31631, 
-        31492, 31349, 31199, 31039, 30876, 30705, 30527, 30342, 30151, 29957, 29754, 29546, 
-        29332, 29113, 28889, 28660, 28426, 28187, 27943, 27694, 27444, 27187, 26926, 26661, 
-        26394, 26124, 25849, 25572, 25292, 25008, 24723, 24437, 24147, 23855, 23562, 23265, 
-        22970, 22672, 22375, 22076, 21776, 21474, 20894, 20314, 19734, 19152, 18574, 17994, 
-        17416, 16839, 16264, 15691, 15119, 14549, 13980, 13415, 12852, 12291, 11733, 11178, 
-        10627, 10079, 9535, 8993, 8456, 7923, 7396, 6870, 6351, 5836, 5327, 4822, 
-        4323, 3830, 3341, 2858, 2382, 1911, 1446, 988, 537, 90, -347, -777, 
-        -1202, -1621, -2029, -2433, -2829, -3216, -3596, -3969, -4333, -4691, -5038, -5378, 
-        -5710, -6035, -6350, -6656, -6953, -7244, -7525, -7796, -8060, -8314, -8559, -8795, 
-        -9022, -9242, -9449, -9650, -9841, -10023, -10196, -10359, -10512, -10657, -10794, -10919, 
-        -11036, -11145, -11242, -11334, -11413, -11486, -11547, -11601, -11644, -11678, -11705, -11723, 
-        -11731, -11731, -11723, -11705, -11678, -11644, -11601, -11548, -11489, -11421, -11346, -11260, 
-        -11169, -11069, -10962, -10846, -10724, -10594, -10458, -10313, -10163, -10004, -9840, -9668, 
-        -9490, -9306, -9116, -8920, -8718, -8510, -8297, -8078, -7854, -7625, -7391, -7151, 
-        -6908, -6660, -6407, -6152, -5890, -5626, -5358, -5089, -4814, -4536, -4256, -3974, 
-        -3687, -3400, -3112, -2819, -2525, -2231, -1936, -1637, -1339, -1039, -739, -439, 
-        -140, 159, 461, 761, 1061, 1357, 1655, 1952, 2247, 2540, 2830, 3120, 
-        3409, 3694, 3977, 4257, 4534, 4808, 5079, 5348, 5612, 5870, 6127, 6379, 
-        6628, 6872, 7111, 7343, 7574, 7798, 8017, 8231, 8437, 8640, 8836, 9027, 
-        9212, 9388, 9560, 9724, 9882, 10034, 10179, 10314, 10444, 10566, 10682, 10789, 
-        10889, 10981, 11066, 11141, 11209, 11270, 11319, 11364, 11398, 11425, 11441, 11451, 
-        11451, 11443, 11425, 11400, 11364, 11321, 11267, 11204, 11133, 11052, 10963, 10864, 
-        10756, 10639, 10512, 10377, 10232, 10079, 9915, 9741, 9560, 9370, 9169, 8960, 
-        8742, 8515, 8278, 8034, 7778, 7516, 7243, 6963, 6673, 6376, 6070, 5753, 
-        5429, 5098, 4758, 4409, 4053, 3687, 3315, 2936, 2547, 2153, 1749, 1339, 
-        921, 497, 65, -372, -817, -1270, -1728, -2193, -2662, -3140, -3623, -4111, 
-        -4603, -5102, -5608, -6119, -6633, -7152, -7676, -8203, -8739, -9274, -9817, -10359, 
-        -10907, -11459, -12015, -12572, -13133, -13695, -14260, -14831, -15401, -15972, -16546, -17121, 
-        -17699, -18276, -18854, -19434, -20014, -20594, -20896, -21196, -21496, -21795, -22095, -22392, 
-        -22690, -22987, -23282, -23575, -23867, -24157, -24443, -24730, -25012, -25292, -25569, -25844, 
-        -26116, -26383, -26646, -26907, -27164, -27416, -27665, -27907, -28146, -28380, -28609, -28834, 
-        -29052, -29266, -29474, -29676, -29872, -30062, -30247, -30424, -30596, -30759, -30919, -31069, 
-        -31214, -31350, -31481, -31603, -31718, -31825, -31924, -32016, -32100, -32176, -32245, -32304, 
-        -32356, -32398, -32433, -32459, -32478, -32486, -32487, -32478, -32461, -32435, -32398, -32356, 
-        -32303, -32240, -32169, -32089, -31998, -31899, -31790, -31675, -31548, -31411, -31268, -31113, 
-        -30950, -30779, -30596, -30405, -30205, -29996, -29777, -29550, -29314, -29068, -28815, -28551, 
-        -28279, -27999, -27709, -27411, -27104, -26788, -26465, -26134, -25793, -25445, -25088, -24723, 
-        -24351, -23972, -23583, -23188, -22784, -22374, -21957, -21532, -21100, -20662, -20217, -19765, 
-        -19307, -18843, -18371, -17894, -17412, -16925, -16430, -15931, -15425, -14916, -14402, -13883, 
-        -13357, -12830, -12296, -11759, -11219, -10675, -10126, -9574, -9019, -8462, -7902, -7338, 
-        -6773, -6203, -5635, -5063, -4490, -3914, -3336, -2758, -2179, -1601, -1019, -439 
-    };
-
-    // AKWF_blended_0024 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0024[600] PROGMEM = {
-        0, 7651, 7734, 7819, 7904, 7987, 8073, 8156, 8241, 8324, 8409, 8493, 
-        8578, 8663, 8746, 8831, 8914, 9000, 9083, 9168, 9251, 9336, 9421, 9505, 
-        9590, 9673, 9758, 9841, 9927, 10010, 10095, 10180, 10263, 10348, 10432, 10517, 
-        10600, 10685, 10768, 10854, 10939, 11022, 11105, 11190, 11275, 11359, 11444, 11527, 
-        11612, 11697, 11780, 11864, 11949, 12034, 12117, 12202, 12288, 12371, 12456, 12539, 
-        12622, 12707, 12793, 12876, 12961, 13046, 13129, 13214, 13298, 13381, 13466, 13551, 
-        13634, 13720, 13805, 13888, 13973, 14056, 14139, 14225, 14310, 14393, 14478, 14563, 
-        14646, 14732, 14815, 14898, 14983, 15068, 15152, 15237, 15322, 15405, 15488, 15573, 
-        15657, 15742, 15827, 15910, 15995, 16080, 16164, 16247, 16332, 16415, 16500, 16586, 
-        16669, 16754, 16839, 16922, 17005, 17091, 17174, 17259, 17344, 17427, 17512, 17598, 
-        17681, 17764, 17849, 17932, 18018, 18103, 18186, 18271, 18356, 18439, 18523, 18608, 
-        18691, 18776, 18861, 18944, 19030, 19113, 19198, 19281, 19366, 19450, 19535, 19620, 
-        19703, 19788, 19871, 19957, 20040, 20125, 20208, 20293, 20378, 20462, 20547, 20630, 
-        20715, 20798, 20884, 20969, 21052, 21137, 21220, 21305, 21389, 21474, 21557, 21642, 
-        21727, 21811, 21896, 21979, 22064, 22147, 22232, 22316, 22401, 22486, 22569, 22654, 
-        22737, 22823, 22906, 22991, 23074, 23159, 23245, 23328, 23413, 23496, 23581, 23664, 
-        23750, 23833, 23918, 24003, 24086, 24171, 24255, 24340, 24423, 24508, 24591, 24677, 
-        24762, 24845, 24930, 25013, 25098, 25182, 25267, 25350, 25435, 25520, 25603, 25689, 
-        25772, 25857, 25940, 26025, 26109, 26194, 26279, 26362, 26447, 26530, 26616, 26699, 
-        26784, 26867, 26952, 27037, 27121, 27206, 27289, 27374, 27457, 27543, 27626, 27711, 
-        27796, 27879, 27964, 28048, 28131, 28216, 28301, 28384, 28469, 28555, 28638, 28723, 
-        28806, 28891, 28975, 29060, 29143, 29228, 29313, 29396, 29482, 29565, 29650, 29733, 
-        29818, 29901, 29987, 30072, 30155, 30240, 30323, 30409, 30492, 30577, 30660, 30745, 
-        30830, 30914, 30999, 31082, 31167, 31250, 31335, 31419, 31504, 31589, 31672, 31755, 
-        31841, 31926, 32009, 32094, 32177, 32262, 32348, 32431, 32514, 32599, 32684, 32767, 
-        -25285, -32767, -32684, -32599, -32514, -32431, -32348, -32262, -32177, -32094, -32009, -31926, 
-        -31841, -31755, -31672, -31589, -31504, -31419, -31335, -31250, -31167, -31082, -30999, -30914, 
-        -30830, -30745, -30660, -30577, -30492, -30409, -30323, -30240, -30155, -30072, -29987, -29901, 
-        -29818, -29733, -29650, -29565, -29482, -29396, -29313, -29228, -29143, -29060, -28975, -28891, 
-        -28806, -28723, -28638, -28555, -28469, -28384, -28301, -28216, -28131, -28048, -27964, -27879, 
-        -27796, -27711, -27626, -27543, -27457, -27374, -27289, -27206, -27121, -27037, -26952, -26867, 
-        -26784, -26699, -26616, -26530, -26447, -26362, -26279, -26194, -26109, -26025, -25940, -25857, 
-        -25772, -25689, -25603, -25520, -25435, -25350, -25267, -25182, -25098, -25013, -24930, -24845, 
-        -24762, -24677, -24591, -24508, -24423, -24340, -24255, -24171, -24086, -24003, -23918, -23833, 
-        -23750, -23664, -23581, -23496, -23413, -23328, -23245, -23159, -23074, -22991, -22906, -22823, 
-        -22737, -22654, -22569, -22486, -22401, -22316, -22232, -22147, -22064, -21979, -21896, -21811, 
-        -21727, -21642, -21557, -21474, -21389, -21305, -21220, -21137, -21052, -20969, -20884, -20798, 
-        -20715, -20630, -20547, -20462, -20378, -20293, -20208, -20125, -20040, -19957, -19871, -19788, 
-        -19703, -19620, -19535, -19450, -19366, -19281, -19198, -19113, -19030, -18944, -18861, -18776, 
-        -18691, -18608, -18523, -18439, -18356, -18271, -18186, -18103, -18018, -17932, -17849, -17764, 
-        -17681, -17598, -17512, -17427, -17344, -17259, -17174, -17091, -17005, -16922, -16839, -16754, 
-        -16669, -16586, -16500, -16415, -16332, -16247, -16164, -16080, -15995, -15910, -15827, -15742, 
-        -15657, -15573, -15488, -15405, -15322, -15237, -15152, -15068, -14983, -14898, -14815, -14732, 
-        -14646, -14563, -14478, -14393, -14310, -14225, -14139, -14056, -13973, -13888, -13805, -13720, 
-        -13634, -13551, -13466, -13381, -13298, -13214, -13129, -13046, -12961, -12876, -12793, -12707, 
-        -12622, -12539, -12456, -12371, -12288, -12202, -12117, -12034, -11949, -11864, -11780, -11697, 
-        -11612, -11527, -11444, -11359, -11275, -11190, -11105, -11022, -10939, -10854, -10768, -10685, 
-        -10600, -10517, -10432, -10348, -10263, -10180, -10095, -10010, -9927, -9841, -9758, -9673, 
-        -9590, -9505, -9421, -9336, -9251, -9168, -9083, -9000, -8914, -8831, -8746, -8663, 
-        -8578, -8493, -8409, -8324, -8241, -8156, -8073, -7987, -7904, -7819, -7734, -7651 
-    };
-
-    // AKWF_blended_0025 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0025[600] PROGMEM = {
-        11460, 11532, 11603, 11675, 11745, 11818, 11890, 11961, 12033, 12103, 12176, 12246, 
-        12318, 12389, 12461, 12533, 12604, 12676, 12747, 12819, 12890, 12962, 13032, 13105, 
-        13177, 13247, 13320, 13390, 13463, 13533, 13605, 13676, 13748, 13820, 13891, 13963, 
-        14034, 14106, 14177, 14249, 14319, 14392, 14464, 14534, 14607, 14677, 14748, 14820, 
-        14892, 14963, 15035, 15107, 15178, 15250, 15321, 15393, 15464, 15536, 15606, 15679, 
-        15751, 15821, 15894, 15964, 16037, 16107, 16179, 16250, 16322, 16394, 16465, 16537, 
-        16608, 16680, 16751, 16823, 16893, 16966, 17038, 17108, 17181, 17251, 17324, 17394, 
-        17466, 17537, 17609, 17681, 17752, 17823, 17895, 17967, 18038, 18110, 18180, 18253, 
-        18325, 18395, 18466, 18538, 18611, 18681, 18753, 18824, 18896, 18968, 19039, 19110, 
-        19182, 19254, 19325, 19397, 19467, 19540, 19612, 19682, 19753, 19825, 19898, 19968, 
-        20040, 20111, 20183, 20255, 20326, 20397, 20469, 20541, 20612, 20684, 20754, 20827, 
-        20899, 20969, 21040, 21112, 21185, 21255, 21327, 21398, 21470, 21541, 21613, 21684, 
-        21756, 21828, 21899, 21971, 22041, 22114, 22184, 22256, 22327, 22399, 22472, 22542, 
-        22614, 22685, 22757, 22828, 22900, 22971, 23043, 23115, 23186, 23258, 23328, 23401, 
-        23471, 23543, 23614, 23686, 23759, 23829, 23901, 23972, 24044, 24115, 24187, 24258, 
-        24330, 24402, 24473, 24545, 24615, 24688, 24758, 24830, 24901, 24973, 25046, 25116, 
-        25188, 25259, 25331, 25402, 25474, 25545, 25617, 25689, 25760, 25832, 25902, 25975, 
-        26045, 26117, 26188, 26260, 26333, 26403, 26475, 26546, 26618, 26689, 26761, 26832, 
-        26904, 26976, 27047, 27119, 27189, 27262, 27332, 27404, 27475, 27547, 27620, 27690, 
-        27762, 27833, 27905, 27976, 28048, 28119, 28191, 28263, 28334, 28406, 28476, 28549, 
-        28619, 28691, 28762, 28834, 28907, 28977, 29049, 29120, 29192, 29263, 29335, 29406, 
-        29478, 29550, 29621, 29693, 29763, 29836, 29906, 29978, 30049, 30121, 30194, 30264, 
-        30336, 30407, 30479, 30550, 30622, 30693, 30765, 30837, 30908, 30980, 31050, 31123, 
-        31193, 31265, 31336, 31408, 31481, 31551, 31623, 31694, 31766, 31837, 31909, 31980, 
-        32052, 32124, 32195, 32265, 32337, 32410, 32480, 32552, 32623, 32695, 32767, -21448, 
-        -32767, -32695, -32623, -32552, -32480, -32410, -32337, -32265, -32195, -32124, -32052, -31980, 
-        -31909, -31837, -31766, -31694, -31623, -31551, -31481, -31408, -31336, -31265, -31193, -31123, 
-        -31050, -30980, -30908, -30837, -30765, -30693, -30622, -30550, -30479, -30407, -30336, -30264, 
-        -30194, -30121, -30049, -29978, -29906, -29836, -29763, -29693, -29621, -29550, -29478, -29406, 
-        -29335, -29263, -29192, -29120, -29049, -28977, -28907, -28834, -28762, -28691, -28619, -28549, 
-        -28476, -28406, -28334, -28263, -28191, -28119, -28048, -27976, -27905, -27833, -27762, -27690, 
-        -27620, -27547, -27475, -27404, -27332, -27262, -27189, -27119, -27047, -26976, -26904, -26832, 
-        -26761, -26689, -26618, -26546, -26475, -26403, -26333, -26260, -26188, -26117, -26045, -25975, 
-        -25902, -25832, -25760, -25689, -25617, -25545, -25474, -25402, -25331, -25259, -25188, -25116, 
-        -25046, -24973, -24901, -24830, -24758, -24688, -24615, -24545, -24473, -24402, -24330, -24258, 
-        -24187, -24115, -24044, -23972, -23901, -23829, -23759, -23686, -23614, -23543, -23471, -23401, 
-        -23328, -23258, -23186, -23115, -23043, -22971, -22900, -22828, -22757, -22685, -22614, -22542, 
-        -22472, -22399, -22327, -22256, -22184, -22114, -22041, -21971, -21899, -21828, -21756, -21684, 
-        -21613, -21541, -21470, -21398, -21327, -21255, -21185, -21112, -21040, -20969, -20899, -20827, 
-        -20754, -20684, -20612, -20541, -20469, -20397, -20326, -20255, -20183, -20111, -20040, -19968, 
-        -19898, -19825, -19753, -19682, -19612, -19540, -19467, -19397, -19325, -19254, -19182, -19110, 
-        -19039, -18968, -18896, -18824, -18753, -18681, -18611, -18538, -18466, -18395, -18325, -18253, 
-        -18180, -18110, -18038, -17967, -17895, -17823, -17752, -17681, -17609, -17537, -17466, -17394, 
-        -17324, -17251, -17181, -17108, -17038, -16966, -16893, -16823, -16751, -16680, -16608, -16537, 
-        -16465, -16394, -16322, -16250, -16179, -16107, -16037, -15964, -15894, -15821, -15751, -15679, 
-        -15606, -15536, -15464, -15393, -15321, -15250, -15178, -15107, -15035, -14963, -14892, -14820, 
-        -14748, -14677, -14607, -14534, -14464, -14392, -14319, -14249, -14177, -14106, -14034, -13963, 
-        -13891, -13820, -13748, -13676, -13605, -13533, -13463, -13390, -13320, -13247, -13177, -13105, 
-        -13032, -12962, -12890, -12819, -12747, -12676, -12604, -12533, -12461, -12389, -12318, -12246, 
-        -12176, -12103, -12033, -11961, -11890, -11818, -11745, -11675, -11603, -11532, -11460, 0 
-    };
-
-    // AKWF_blended_0026 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0026[600] PROGMEM = {
-        16285, 16339, 16395, 16451, 16506, 16562, 16617, 16672, 16727, 16783, 16837, 16893, 
-        16949, 17004, 17059, 17115, 17170, 17224, 17280, 17335, 17391, 17447, 17501, 17557, 
-        17612, 17668, 17722, 17778, 17833, 17889, 17945, 17999, 18055, 18110, 18166, 18220, 
-        18276, 18331, 18386, 18442, 18497, 18553, 18607, 18663, 18718, 18774, 18828, 18884, 
-        18940, 18995, 19051, 19105, 19161, 19216, 19272, 19328, 19382, 19438, 19493, 19549, 
-        19603, 19659, 19714, 19769, 19825, 19880, 19936, 19990, 20046, 20101, 20157, 20211, 
-        20267, 20323, 20378, 20434, 20488, 20544, 20599, 20655, 20709, 20765, 20821, 20876, 
-        20932, 20986, 21042, 21097, 21152, 21207, 21263, 21319, 21373, 21429, 21484, 21540, 
-        21594, 21650, 21705, 21761, 21817, 21871, 21927, 21982, 22038, 22092, 22148, 22203, 
-        22259, 22314, 22369, 22425, 22480, 22535, 22590, 22646, 22701, 22756, 22812, 22867, 
-        22923, 22977, 23033, 23088, 23144, 23198, 23254, 23310, 23365, 23421, 23475, 23530, 
-        23586, 23642, 23696, 23752, 23808, 23863, 23918, 23973, 24028, 24084, 24139, 24194, 
-        24250, 24306, 24360, 24416, 24471, 24525, 24581, 24637, 24692, 24748, 24804, 24858, 
-        24914, 24969, 25025, 25079, 25135, 25190, 25246, 25301, 25356, 25412, 25467, 25522, 
-        25577, 25633, 25687, 25743, 25799, 25854, 25908, 25964, 26020, 26075, 26131, 26185, 
-        26241, 26297, 26352, 26406, 26462, 26518, 26573, 26629, 26683, 26739, 26795, 26850, 
-        26904, 26960, 27016, 27070, 27126, 27181, 27237, 27293, 27347, 27402, 27458, 27514, 
-        27568, 27624, 27679, 27735, 27791, 27845, 27900, 27956, 28012, 28066, 28122, 28177, 
-        28232, 28288, 28343, 28398, 28453, 28509, 28564, 28620, 28674, 28730, 28785, 28841, 
-        28895, 28951, 29007, 29062, 29118, 29172, 29228, 29283, 29339, 29393, 29449, 29505, 
-        29560, 29615, 29670, 29726, 29781, 29836, 29891, 29947, 30003, 30057, 30113, 30168, 
-        30224, 30278, 30334, 30389, 30445, 30501, 30555, 30611, 30666, 30722, 30776, 30832, 
-        30887, 30943, 30998, 31053, 31109, 31164, 31219, 31274, 31330, 31385, 31440, 31496, 
-        31551, 31607, 31661, 31717, 31772, 31828, 31882, 31938, 31994, 32049, 32105, 32159, 
-        32215, 32270, 32326, 32380, 32436, 32492, 32547, 32602, 32657, 32713, 32767, -16593, 
-        -32767, -32713, -32657, -32602, -32547, -32492, -32436, -32380, -32326, -32270, -32215, -32159, 
-        -32105, -32049, -31994, -31938, -31882, -31828, -31772, -31717, -31661, -31607, -31551, -31496, 
-        -31440, -31385, -31330, -31274, -31219, -31164, -31109, -31053, -30998, -30943, -30887, -30832, 
-        -30776, -30722, -30666, -30611, -30555, -30501, -30445, -30389, -30334, -30278, -30224, -30168, 
-        -30113, -30057, -30003, -29947, -29891, -29836, -29781, -29726, -29670, -29615, -29560, -29505, 
-        -29449, -29393, -29339, -29283, -29228, -29172, -29118, -29062, -29007, -28951, -28895, -28841, 
-        -28785, -28730, -28674, -28620, -28564, -28509, -28453, -28398, -28343, -28288, -28232, -28177, 
-        -28122, -28066, -28012, -27956, -27900, -27845, -27791, -27735, -27679, -27624, -27568, -27514, 
-        -27458, -27402, -27347, -27293, -27237, -27181, -27126, -27070, -27016, -26960, -26904, -26850, 
-        -26795, -26739, -26683, -26629, -26573, -26518, -26462, -26406, -26352, -26297, -26241, -26185, 
-        -26131, -26075, -26020, -25964, -25908, -25854, -25799, -25743, -25687, -25633, -25577, -25522, 
-        -25467, -25412, -25356, -25301, -25246, -25190, -25135, -25079, -25025, -24969, -24914, -24858, 
-        -24804, -24748, -24692, -24637, -24581, -24525, -24471, -24416, -24360, -24306, -24250, -24194, 
-        -24139, -24084, -24028, -23973, -23918, -23863, -23808, -23752, -23696, -23642, -23586, -23530, 
-        -23475, -23421, -23365, -23310, -23254, -23198, -23144, -23088, -23033, -22977, -22923, -22867, 
-        -22812, -22756, -22701, -22646, -22590, -22535, -22480, -22425, -22369, -22314, -22259, -22203, 
-        -22148, -22092, -22038, -21982, -21927, -21871, -21817, -21761, -21705, -21650, -21594, -21540, 
-        -21484, -21429, -21373, -21319, -21263, -21207, -21152, -21097, -21042, -20986, -20932, -20876, 
-        -20821, -20765, -20709, -20655, -20599, -20544, -20488, -20434, -20378, -20323, -20267, -20211, 
-        -20157, -20101, -20046, -19990, -19936, -19880, -19825, -19769, -19714, -19659, -19603, -19549, 
-        -19493, -19438, -19382, -19328, -19272, -19216, -19161, -19105, -19051, -18995, -18940, -18884, 
-        -18828, -18774, -18718, -18663, -18607, -18553, -18497, -18442, -18386, -18331, -18276, -18220, 
-        -18166, -18110, -18055, -17999, -17945, -17889, -17833, -17778, -17722, -17668, -17612, -17557, 
-        -17501, -17447, -17391, -17335, -17280, -17224, -17170, -17115, -17059, -17004, -16949, -16893, 
-        -16837, -16783, -16727, -16672, -16617, -16562, -16506, -16451, -16395, -16339, -16285, 0 
-    };
-
-    // AKWF_blended_0028 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0028[600] PROGMEM = {
-        20460, 32641, 28523, 30879, 29126, 30365, 29274, 30067, 29300, 29847, 29274, 29659, 
-        29224, 29494, 29156, 29342, 29078, 29198, 28993, 29063, 28902, 28930, 28806, 28804, 
-        28706, 28682, 28601, 28562, 28494, 28444, 28383, 28329, 28272, 28215, 28159, 28102, 
-        28048, 27991, 27935, 27878, 27821, 27765, 27708, 27654, 27597, 27540, 27484, 27427, 
-        27370, 27314, 27259, 27203, 27146, 27089, 27033, 26976, 26920, 26863, 26806, 26752, 
-        26695, 26639, 26582, 26525, 26469, 26412, 26355, 26301, 26244, 26188, 26131, 26075, 
-        26018, 25961, 25905, 25848, 25794, 25737, 25680, 25624, 25567, 25513, 25454, 25399, 
-        25343, 25286, 25229, 25173, 25116, 25060, 25005, 24948, 24892, 24835, 24779, 24722, 
-        24665, 24609, 24552, 24498, 24441, 24384, 24328, 24271, 24214, 24158, 24101, 24045, 
-        23990, 23934, 23877, 23820, 23764, 23707, 23653, 23594, 23539, 23483, 23426, 23369, 
-        23313, 23258, 23200, 23145, 23088, 23032, 22975, 22919, 22862, 22805, 22751, 22694, 
-        22638, 22581, 22524, 22468, 22411, 22354, 22298, 22243, 22187, 22130, 22074, 22017, 
-        21960, 21904, 21847, 21790, 21736, 21679, -21751, -21808, -21864, -21921, -21978, -22032, 
-        -22091, -22145, -22202, -22259, -22315, -22372, -22429, -22483, -22540, -22596, -22653, -22710, 
-        -22766, -22823, -22879, -22934, -22990, -23047, -23104, -23160, -23217, -23274, -23330, -23387, 
-        -23441, -23498, -23555, -23611, -23668, -23724, -23781, -23838, -23892, -23949, -24005, -24062, 
-        -24119, -24175, -24232, -24286, -24345, -24400, -24456, -24513, -24570, -24626, -24681, -24739, 
-        -24794, -24850, -24907, -24964, -25020, -25077, -25134, -25188, -25245, -25301, -25358, -25415, 
-        -25471, -25528, -25584, -25641, -25696, -25752, -25809, -25865, -25922, -25979, -26035, -26092, 
-        -26146, -26203, -26260, -26316, -26373, -26430, -26486, -26541, -26599, -26654, -26710, -26767, 
-        -26824, -26880, -26935, -26994, -27048, -27105, -27161, -27218, -27275, -27331, -27388, -27442, 
-        -27499, -27556, -27612, -27669, -27725, -27782, -27839, -27895, -27950, -28006, -28063, -28120, 
-        -28176, -28233, -28290, -28344, -28403, -28457, -28514, -28573, -28623, -28690, -28729, -28810, 
-        -28834, -28932, -28934, -29061, -29030, -29191, -29122, -29328, -29206, -29472, -29285, -29622, 
-        -29352, -29788, -29405, -29975, -29429, -30195, -29402, -30494, -29254, -31010, -28653, -32767, 
-        -1226, 10955, 6836, 9193, 7437, 8677, 7585, 8380, 7612, 8158, 7588, 7973, 
-        7535, 7808, 7470, 7655, 7392, 7511, 7307, 7374, 7215, 7244, 7117, 7117, 
-        7017, 6993, 6912, 6873, 6806, 6756, 6697, 6642, 6586, 6529, 6473, 6416, 
-        6359, 6303, 6248, 6189, 6135, 6078, 6022, 5965, 5908, 5852, 5795, 5741, 
-        5684, 5627, 5571, 5514, 5458, 5401, 5346, 5290, 5233, 5177, 5120, 5063, 
-        5007, 4950, 4893, 4839, 4782, 4726, 4669, 4613, 4556, 4499, 4443, 4386, 
-        4332, 4275, 4218, 4162, 4105, 4048, 3992, 3935, 3881, 3824, 3767, 3711, 
-        3654, 3598, 3541, 3486, 3430, 3373, 3317, 3260, 3203, 3147, 3090, 3036, 
-        2979, 2922, 2866, 2809, 2752, 2696, 2639, 2585, 2528, 2472, 2415, 2358, 
-        2302, 2245, 2188, 2132, 2077, 2021, 1964, 1907, 1851, 1794, 1738, 1683, 
-        1624, 1570, 1513, 1457, 1400, 1343, 1287, 1232, 1176, 1119, 1062, 1006, 
-        949, 892, 836, 781, 725, 668, 612, 555, 498, 442, 385, 328, 
-        274, 217, 161, 104, 47, -8, -63, -121, -176, -233, -289, -346, 
-        -402, -459, -516, -570, -627, -683, -740, -797, -853, -910, -964, -1023, 
-        -1078, -1134, -1191, -1247, -1304, -1361, -1417, -1472, -1528, -1585, -1642, -1698, 
-        -1755, -1812, -1868, -1925, -1979, -2036, -2093, -2149, -2206, -2262, -2319, -2376, 
-        -2430, -2487, -2543, -2600, -2657, -2713, -2770, -2824, -2881, -2938, -2994, -3051, 
-        -3108, -3164, -3219, -3275, -3332, -3388, -3445, -3502, -3558, -3615, -3672, -3726, 
-        -3783, -3839, -3896, -3953, -4009, -4066, -4122, -4179, -4234, -4290, -4347, -4403, 
-        -4460, -4517, -4573, -4628, -4687, -4741, -4798, -4854, -4911, -4968, -5024, -5079, 
-        -5135, -5192, -5248, -5305, -5362, -5418, -5475, -5529, -5586, -5643, -5699, -5756, 
-        -5813, -5869, -5926, -5982, -6037, -6094, -6150, -6207, -6263, -6320, -6377, -6433, 
-        -6488, -6544, -6601, -6658, -6714, -6771, -6825, -6884, -6936, -7002, -7043, -7122, 
-        -7146, -7246, -7246, -7372, -7344, -7505, -7435, -7640, -7520, -7784, -7599, -7936, 
-        -7666, -8102, -7716, -8287, -7742, -8509, -7716, -8805, -7566, -9321, -6965, -11079 
-    };
-
-} // namespace AKWF_BwBlended
@@ -1,1304 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwBlended {
-
-    // AKWF_blended_0029 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0029[600] PROGMEM = {
-        121, 285, 450, 614, 778, 942, 1107, 1272, 1435, 1602, 1762, 1932, 
-        2089, 2264, 2414, 2597, 2738, 2931, 3060, 3266, 3382, 3604, 3700, 3944, 
-        4016, 4289, 4327, 4637, 4631, 4995, 4923, 5370, 5191, 5786, 5386, 6352, 
-        5168, 15840, 20067, 18883, 19848, 19449, 20043, 19864, 20311, 20239, 20603, 20597, 
-        20907, 20945, 21219, 21290, 21534, 21630, 21852, 21968, 22174, 22304, 22496, 22637, 
-        22821, 22970, 23146, 23302, 23472, 23632, 23799, 23963, 24127, 24292, 24456, 24620, 
-        24784, 24950, 25114, 25278, 25442, 25607, 25771, 25936, 26100, 26264, 26429, 26593, 
-        26757, 26921, 27085, 27251, 27415, 27579, 27743, 27908, 28072, 28237, 28401, 28565, 
-        28729, 28894, 29053, 29234, 29366, 29587, 29662, 29958, 29935, 30358, 30171, 30808, 
-        30330, 31392, 30220, 32725, 19794, 11563, 14069, 12897, 13958, 13479, 14118, 13931, 
-        14354, 14330, 14626, 14702, 14923, 15055, 15234, 15394, 15558, 15724, 15888, 16052, 
-        16217, 16381, 16545, 16709, 16874, 17038, 17202, 17366, 17532, 17696, 17860, 18024, 
-        18189, 18353, 18517, 18682, 18846, 19011, 19175, 19339, 19503, 19667, 19833, 19997, 
-        20161, 20325, 20490, 20654, 20818, 20983, 21147, 21311, 21476, 21640, 21804, 21970, 
-        22134, 22298, 22462, 22626, 22791, 22955, 23119, 23283, 23448, 23612, 23778, 23942, 
-        24106, 24271, 24435, 24599, 24763, 24928, 25092, -25299, -25134, -24970, -24806, -24640, 
-        -24476, -24312, -24147, -23983, -23819, -23655, -23491, -23326, -23162, -22998, -22834, -22669, 
-        -22505, -22339, -22175, -22011, -21846, -21682, -21518, -21354, -21189, -21025, -20861, -20697, 
-        -20533, -20368, -20204, -20040, -19874, -19710, -19546, -19381, -19217, -19053, -18888, -18724, 
-        -18560, -18396, -18230, -18066, -17902, -17738, -17573, -17409, -17245, -17080, -16916, -16751, 
-        -16587, -16423, -16259, -16093, -15929, -15765, -15601, -15436, -15277, -15097, -14964, -14745, 
-        -14669, -14373, -14395, -13973, -14159, -13521, -13999, -12938, -14110, -11606, -24537, -32767, 
-        -30262, -31435, -30373, -30851, -30214, -30401, -29977, -30001, -29704, -29629, -29408, -29275, 
-        -29096, -28937, -28772, -28607, -28443, -28279, -28115, -27951, -27786, -27622, -27458, -27292, 
-        -27128, -26964, -26799, -26635, -26471, -26306, -26142, -25978, -25814, -25648, -25484, -25320, 
-        -25156, -24992, -24827, -24663, -24498, -24334, -24170, -24005, -23842, -23675, -23515, -23345, 
-        -23188, -23013, -22863, -22680, -22539, -22346, -22217, -22010, -21895, -21672, -21577, -21333, 
-        -21261, -20988, -20950, -20640, -20646, -20282, -20352, -19907, -20086, -19491, -19891, -18926, 
-        -20108, -9436, -5210, -6394, -5428, -5828, -5234, -5413, -4966, -5038, -4674, -4680, 
-        -4368, -4330, -4058, -3986, -3743, -3647, -3423, -3309, -3103, -2973, -2780, -2639, 
-        -2456, -2306, -2132, -1975, -1805, -1643, -1477, -1314, -1150, -985, -821, -657, 
-        -493, -328, -164, 1, 165, 329, 494, 658, 822, 986, 1151, 1315, 
-        1479, 1643, 1807, 1973, 2137, 2301, 2466, 2630, 2794, 2959, 3123, 3287, 
-        3452, 3616, 3775, 3956, 4088, 4309, 4383, 4680, 4657, 5080, 4894, 5531, 
-        5053, 6114, 4942, 7447, -5484, -13714, -11209, -12381, -11320, -11798, -11159, -11346, 
-        -10923, -10947, -10651, -10575, -10354, -10222, -10043, -9883, -9717, -9553, -9389, -9225, 
-        -9060, -8896, -8732, -8568, -8403, -8239, -8075, -7911, -7746, -7582, -7418, -7252, 
-        -7088, -6923, -6759, -6595, -6431, -6266, -6102, -5938, -5774, -5610, -5444, -5280, 
-        -5116, -4952, -4787, -4623, -4458, -4294, -4130, -3965, -3801, -3637, -3473, -3307, 
-        -3143, -2979, -2815, -2651, -2486, -2322, -2157, -1993, -1829, -1664, -1500, -1336, 
-        -1171, -1006, -842, -678, -514, -349, -185, -21, 142, 307, 471, 635, 
-        801, 965, 1130, 1294, 1458, 1622, 1786, 1951, 2115, 2279, 2443, 2608, 
-        2772, 2936, 3102, 3266, 3430, 3595, 3759, 3923, 4088, 4252, 4416, 4580, 
-        4744, 4910, 5074, 5238, 5402, 5567, 5731, 5896, 6060, 6224, 6389, 6553, 
-        6717, 6881, 7047, 7211, 7375, 7539, 7703, 7868, 8032, 8196, 8361, 8525, 
-        8689, 8854, 9018, 9184, 9348, 9512, 9676, 9841, 10000, 10180, 10312, 10532, 
-        10608, 10905, 10882, 11304, 11118, 11755, 11277, 12338, 11166, 13671, 740, -7489, 
-        -4984, -6157, -5095, -5573, -4936, -5123, -4699, -4723, -4426, -4351, -4130, -3997, 
-        -3818, -3659, -3494, -3329, -3165, -3001, -2837, -2673, -2508, -2343, -2179, -2015, 
-        -1850, -1686, -1522, -1357, -1193, -1029, -864, -700, -536, -370, -206, -42 
-    };
-
-    // AKWF_blended_0030 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0030[600] PROGMEM = {
-        17894, 32615, 27648, 30504, 28391, 29897, 28586, 29552, 28633, 29301, 28618, 29092, 
-        28571, 28907, 28506, 28738, 28428, 28580, 28340, 28431, 28244, 28288, 28143, 28150, 
-        28037, 28016, 27926, 27887, 27813, 27760, 27695, 27637, 27577, 27516, 27457, 27396, 
-        27335, 27274, 27215, 27154, 27094, 27033, 26972, 26913, 26852, 26792, 26731, 26671, 
-        26611, 26550, 26489, 26430, 26369, 26309, 26249, 26187, 26128, 26067, 26006, 25947, 
-        25886, 25824, 25770, 25696, 25660, 25561, 25557, 25416, 25468, 25255, 25401, 25061, 
-        25390, 24749, 25706, 19962, 16252, 17208, 16568, 16897, 16558, 16704, 16491, 16542, 
-        16400, 16398, 16298, 16263, 16187, 16135, 16073, 16012, 15951, 15890, 15831, 15770, 
-        15710, 15649, 15588, 15529, 15468, 15408, 15347, 15287, 15227, 15166, 15105, 15046, 
-        14985, 14925, 14864, 14803, 14744, 14683, 14622, 14562, 14502, 14442, 14381, 14322, 
-        14261, 14200, 14139, 14080, 14019, 13959, 13898, 13837, 13778, 13717, 13657, 13596, 
-        13536, 13476, 13415, 13354, 13295, 13234, 13174, 13114, 13052, 12993, 12932, 12871, 
-        12812, 12751, 12691, 12630, 12571, 12510, -12604, -12665, -12726, -12786, -12846, -12907, 
-        -12967, -13027, -13089, -13148, -13209, -13269, -13330, -13389, -13450, -13511, -13570, -13631, 
-        -13692, -13752, -13813, -13872, -13933, -13994, -14054, -14114, -14175, -14235, -14296, -14355, 
-        -14416, -14477, -14537, -14598, -14657, -14718, -14779, -14840, -14899, -14960, -15020, -15081, 
-        -15140, -15201, -15262, -15321, -15383, -15443, -15503, -15563, -15623, -15684, -15745, -15805, 
-        -15865, -15926, -15986, -16047, -16106, -16167, -16228, -16290, -16344, -16418, -16454, -16553, 
-        -16555, -16697, -16646, -16859, -16713, -17053, -16724, -17365, -16408, -22152, -25861, -24904, 
-        -25545, -25216, -25556, -25410, -25623, -25571, -25714, -25716, -25816, -25851, -25925, -25979, 
-        -26042, -26102, -26162, -26224, -26283, -26344, -26404, -26464, -26524, -26585, -26646, -26705, 
-        -26766, -26827, -26887, -26948, -27007, -27068, -27129, -27189, -27249, -27310, -27370, -27431, 
-        -27490, -27551, -27612, -27671, -27733, -27792, -27852, -27915, -27969, -28042, -28083, -28172, 
-        -28193, -28305, -28298, -28443, -28400, -28587, -28495, -28735, -28583, -28893, -28661, -29062, 
-        -28727, -29247, -28775, -29456, -28788, -29707, -28742, -30052, -28547, -30659, -27805, -32767, 
-        5367, 20087, 15122, 17976, 15863, 17369, 16058, 17025, 16105, 16773, 16090, 16564, 
-        16044, 16379, 15978, 16210, 15900, 16052, 15812, 15903, 15716, 15760, 15615, 15622, 
-        15510, 15488, 15399, 15359, 15285, 15233, 15169, 15109, 15049, 14989, 14929, 14868, 
-        14807, 14747, 14687, 14626, 14566, 14505, 14446, 14385, 14324, 14265, 14204, 14144, 
-        14083, 14022, 13963, 13902, 13841, 13781, 13721, 13661, 13600, 13539, 13480, 13419, 
-        13358, 13296, 13242, 13168, 13132, 13033, 13029, 12888, 12940, 12727, 12873, 12533, 
-        12862, 12221, 13178, 7434, 3725, 4682, 4041, 4370, 4030, 4176, 3963, 4014, 
-        3872, 3870, 3771, 3735, 3661, 3607, 3545, 3484, 3423, 3363, 3303, 3242, 
-        3182, 3121, 3062, 3001, 2940, 2881, 2819, 2760, 2699, 2639, 2579, 2518, 
-        2457, 2397, 2337, 2277, 2217, 2155, 2096, 2035, 1974, 1915, 1854, 1794, 
-        1733, 1674, 1613, 1552, 1491, 1431, 1371, 1311, 1250, 1189, 1130, 1069, 
-        1009, 948, 887, 828, 767, 706, 646, 586, 526, 465, 404, 345, 
-        284, 223, 163, 102, 43, -17, -76, -138, -198, -259, -319, -379, 
-        -439, -500, -561, -620, -681, -741, -802, -861, -922, -983, -1044, -1104, 
-        -1164, -1224, -1285, -1346, -1405, -1466, -1527, -1586, -1647, -1707, -1768, -1829, 
-        -1888, -1949, -2009, -2070, -2130, -2190, -2251, -2312, -2371, -2432, -2492, -2553, 
-        -2614, -2673, -2734, -2795, -2855, -2915, -2975, -3036, -3097, -3156, -3217, -3278, 
-        -3338, -3399, -3458, -3519, -3580, -3640, -3700, -3762, -3816, -3890, -3926, -4025, 
-        -4029, -4171, -4118, -4331, -4185, -4525, -4196, -4837, -3881, -9624, -13333, -12378, 
-        -13018, -12689, -13028, -12884, -13097, -13044, -13186, -13188, -13288, -13323, -13398, -13452, 
-        -13515, -13574, -13635, -13696, -13755, -13816, -13876, -13937, -13996, -14057, -14118, -14179, 
-        -14239, -14299, -14359, -14420, -14481, -14540, -14601, -14662, -14721, -14782, -14842, -14903, 
-        -14964, -15023, -15084, -15144, -15205, -15265, -15324, -15389, -15441, -15514, -15555, -15644, 
-        -15665, -15777, -15770, -15915, -15872, -16059, -15967, -16209, -16055, -16367, -16135, -16534, 
-        -16199, -16719, -16247, -16928, -16261, -17180, -16214, -17524, -16019, -18131, -15278, -20240 
-    };
-
-    // AKWF_blended_0031 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0031[600] PROGMEM = {
-        71, 170, 268, 365, 464, 560, 661, 758, 856, 953, 1052, 1151, 
-        1249, 1346, 1445, 1543, 1640, 1739, 1837, 1934, 2033, 2131, 2228, 2327, 
-        2425, 2524, 2621, 2719, 2816, 2915, 3013, 3112, 3209, 3307, 3406, 3503, 
-        3601, 3700, 3799, 3896, 3994, 4091, 4192, 4288, 4387, 4484, 4582, 4681, 
-        4780, 4876, 4975, 5074, 5170, 5269, 5366, 5466, 5563, 5662, 5758, 5857, 
-        5954, 6056, 6145, 6261, 6331, 6472, 6507, 6691, 6671, 6929, 6811, 7211, 
-        6859, 7745, 3453, 731, 1615, 1263, 1663, 1545, 1802, 1781, 1967, 2002, 
-        2145, 2213, 2329, 2418, 2520, 2617, 2715, 2814, 2911, 3010, 3106, 3205, 
-        3304, 3402, 3499, 3598, 3696, 3793, 3892, 3990, 4087, 4186, 4284, 4381, 
-        4480, 4578, 4677, 4774, 4872, 4969, 5070, 5166, 5265, 5362, 5461, 5559, 
-        5656, 5756, 5849, 5956, 6043, 6155, 6234, 6356, 6426, 6559, 6613, 6762, 
-        6801, 6971, 6985, 7180, 7165, 7395, 7339, 7616, 7505, 7850, 7658, 8101, 
-        7778, 8403, 7811, 8890, 7339, 20280, 25353, 23799, 24877, 24285, 24912, 24589, 
-        25032, 24840, 25184, 25072, 25351, 25293, 25525, 25509, 25705, 25718, 25889, 25925, 
-        26074, 26130, 26264, 26333, 26453, 26535, 26645, 26734, 26838, 26933, 27034, 27129, 
-        27227, 27326, 27424, 27523, 27620, 27719, 27817, 27914, 28013, 28111, 28210, 28307, 
-        28405, 28502, 28601, 28699, 28798, 28895, 28993, 29092, 29189, 29287, 29386, 29485, 
-        29581, 29680, 29777, 29875, 29974, 30073, 30168, 30272, 30359, 30477, 30545, 30686, 
-        30721, 30907, 30887, 31144, 31026, 31425, 31075, 31959, 27666, 24945, 25829, 25478, 
-        25877, 25759, 26018, 25997, 26183, 26217, 26359, 26428, 26544, 26631, 26734, 26833, 
-        26929, 27028, 27125, 27223, 27322, 27421, 27517, 27616, 27715, 27813, 27910, 28009, 
-        28107, 28204, 28303, 28401, 28498, 28597, 28695, 28792, 28891, 28989, 29088, 29185, 
-        29284, 29380, 29479, 29578, 29676, 29773, 29872, 29970, 30067, 30166, 30264, 30363, 
-        30460, 30558, 30655, 30756, 30852, 30951, 31048, 31146, 31245, 31342, 31440, 31539, 
-        31638, 31734, 31833, 31930, 32029, 32127, 32226, 32323, 32421, 32520, 32619, -32767, 
-        -32671, -32572, -32473, -32375, -32278, -32179, -32081, -31984, -31885, -31787, -31690, -31591, 
-        -31493, -31394, -31297, -31199, -31100, -31003, -30905, -30806, -30707, -30611, -30512, -30415, 
-        -30317, -30218, -30119, -30022, -29924, -29825, -29728, -29630, -29531, -29432, -29336, -29237, 
-        -29140, -29042, -28943, -28844, -28748, -28649, -28550, -28454, -28355, -28256, -28160, -28061, 
-        -27962, -27866, -27767, -27668, -27570, -27473, -27374, -27276, -27177, -27080, -26982, -26885, 
-        -26786, -26684, -26597, -26480, -26411, -26270, -26235, -26049, -26068, -25811, -25929, -25531, 
-        -25881, -24997, -29287, -32011, -31127, -31477, -31079, -31197, -30939, -30959, -30773, -30738, 
-        -30597, -30529, -30411, -30324, -30220, -30125, -30026, -29928, -29829, -29732, -29634, -29537, 
-        -29438, -29340, -29241, -29144, -29046, -28947, -28850, -28752, -28653, -28554, -28458, -28359, 
-        -28262, -28163, -28065, -27966, -27869, -27771, -27672, -27575, -27477, -27378, -27279, -27183, 
-        -27086, -26985, -26891, -26786, -26697, -26587, -26506, -26386, -26316, -26183, -26126, -25978, 
-        -25941, -25771, -25757, -25562, -25577, -25345, -25403, -25124, -25237, -24892, -25084, -24641, 
-        -24962, -24337, -24929, -23852, -25403, -12459, -7389, -8943, -7863, -8455, -7830, -8153, 
-        -7710, -7902, -7557, -7668, -7391, -7447, -7217, -7232, -7037, -7024, -6853, -6815, 
-        -6666, -6612, -6478, -6408, -6287, -6207, -6095, -6008, -5902, -5809, -5708, -5611, 
-        -5513, -5414, -5317, -5219, -5122, -5021, -4925, -4826, -4729, -4631, -4532, -4433, 
-        -4337, -4238, -4139, -4043, -3944, -3845, -3749, -3650, -3551, -3454, -3356, -3257, 
-        -3158, -3062, -2963, -2866, -2768, -2669, -2572, -2470, -2381, -2265, -2197, -2054, 
-        -2019, -1833, -1855, -1597, -1715, -1315, -1667, -783, -5074, -7797, -6911, -7263, 
-        -6863, -6981, -6724, -6745, -6559, -6524, -6381, -6314, -6196, -6110, -6006, -5909, 
-        -5811, -5714, -5615, -5519, -5420, -5321, -5223, -5126, -5027, -4929, -4832, -4733, 
-        -4634, -4536, -4439, -4340, -4244, -4143, -4046, -3948, -3851, -3752, -3654, -3555, 
-        -3458, -3360, -3261, -3164, -3066, -2969, -2868, -2772, -2673, -2576, -2478, -2379, 
-        -2280, -2184, -2085, -1986, -1889, -1791, -1692, -1595, -1497, -1398, -1301, -1203, 
-        -1104, -1005, -909, -810, -713, -615, -516, -417, -321, -222, -123, -25 
-    };
-
-    // AKWF_blended_0032 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0032[600] PROGMEM = {
-        67, 240, 413, 585, 758, 930, 1103, 1275, 1447, 1621, 1790, 1969, 
-        2134, 2316, 2476, 2665, 2816, 3014, 3155, 3367, 3493, 3720, 3827, 4076, 
-        4161, 4435, 4489, 4798, 4812, 5170, 5123, 5558, 5411, 5984, 5633, 6549, 
-        5471, 15391, 19333, 18254, 19170, 18819, 19392, 19245, 19679, 19632, 19991, 20005, 
-        20313, 20368, 20642, 20727, 20974, 21083, 21310, 21438, 21648, 21789, 21987, 22138, 
-        22327, 22487, 22669, 22834, 23013, 23181, 23356, 23526, 23700, 23873, 24045, 24218, 
-        24389, 24563, 24736, 24908, 25079, 25253, 25426, 25597, 25771, 25942, 26116, 26287, 
-        26460, 26632, 26804, 26977, 27150, 27322, 27495, 27668, 27840, 28012, 28185, 28357, 
-        28530, 28703, 28871, 29058, 29198, 29430, 29508, 29819, 29794, 30240, 30043, 30713, 
-        30209, 31326, 30092, 32728, 19113, 10447, 13085, 11850, 12966, 12462, 13133, 12936, 
-        13381, 13356, 13667, 13747, 13979, 14117, 14306, 14473, 14646, 14818, 14990, 15163, 
-        15336, 15508, 15681, 15853, 16026, 16198, 16371, 16543, 16716, 16888, 17061, 17233, 
-        17406, 17579, 17751, 17922, 18096, 18269, 18441, 18614, 18786, 18957, 19130, 19304, 
-        19475, 19649, 19822, 19993, 20165, 20338, 20510, 20683, 20855, 21028, 21200, 21373, 
-        21546, 21718, 21890, 22063, 22236, 22408, 22581, 22753, 22926, 23098, 23271, 23443, 
-        23616, 23788, 23961, 24133, 24306, 24479, 24651, -24862, -24690, -24517, -24344, -24172, 
-        -23999, -23827, -23654, -23482, -23309, -23137, -22964, -22793, -22619, -22448, -22274, -22101, 
-        -21929, -21758, -21585, -21413, -21240, -21066, -20895, -20723, -20550, -20377, -20205, -20033, 
-        -19860, -19687, -19515, -19342, -19170, -18997, -18825, -18652, -18480, -18307, -18135, -17962, 
-        -17790, -17617, -17444, -17272, -17101, -16927, -16756, -16582, -16409, -16237, -16066, -15893, 
-        -15719, -15548, -15376, -15203, -15029, -14858, -14685, -14511, -14344, -14156, -14017, -13786, 
-        -13707, -13396, -13421, -12976, -13173, -12502, -13005, -11888, -13124, -10487, -24102, -32767, 
-        -30130, -31366, -30247, -30752, -30081, -30278, -29833, -29858, -29547, -29468, -29238, -29098, 
-        -28909, -28743, -28570, -28396, -28223, -28052, -27880, -27707, -27533, -27362, -27189, -27017, 
-        -26844, -26672, -26499, -26327, -26154, -25982, -25809, -25637, -25464, -25291, -25119, -24947, 
-        -24774, -24602, -24429, -24256, -24084, -23912, -23739, -23566, -23394, -23221, -23051, -22873, 
-        -22709, -22525, -22367, -22178, -22026, -21827, -21687, -21476, -21350, -21122, -21014, -20767, 
-        -20680, -20407, -20352, -20043, -20030, -19672, -19718, -19285, -19430, -18859, -19210, -18294, 
-        -19371, -9450, -5510, -6588, -5672, -6023, -5451, -5598, -5163, -5210, -4850, -4837, 
-        -4529, -4473, -4200, -4114, -3867, -3758, -3532, -3405, -3195, -3054, -2856, -2705, 
-        -2514, -2355, -2173, -2007, -1830, -1661, -1486, -1315, -1143, -970, -797, -625, 
-        -452, -278, -107, 64, 237, 409, 582, 754, 927, 1099, 1272, 1445, 
-        1617, 1789, 1962, 2135, 2307, 2480, 2652, 2825, 2997, 3170, 3342, 3515, 
-        3687, 3860, 4027, 4215, 4354, 4586, 4666, 4977, 4952, 5396, 5200, 5869, 
-        5366, 6483, 5248, 7884, -5728, -14395, -11758, -12992, -11875, -12380, -11708, -11906, 
-        -11461, -11486, -11175, -11096, -10864, -10725, -10537, -10369, -10196, -10024, -9851, -9679, 
-        -9506, -9333, -9161, -8990, -8816, -8643, -8471, -8300, -8125, -7953, -7782, -7608, 
-        -7437, -7264, -7092, -6919, -6747, -6574, -6400, -6229, -6057, -5884, -5711, -5539, 
-        -5366, -5194, -5021, -4849, -4676, -4504, -4332, -4159, -3986, -3814, -3641, -3468, 
-        -3296, -3124, -2951, -2779, -2606, -2435, -2261, -2090, -1916, -1743, -1571, -1400, 
-        -1227, -1053, -882, -708, -537, -364, -192, -19, 152, 325, 497, 670, 
-        842, 1015, 1188, 1360, 1532, 1705, 1877, 2050, 2223, 2395, 2567, 2740, 
-        2913, 3085, 3256, 3430, 3603, 3775, 3948, 4120, 4293, 4464, 4638, 4809, 
-        4983, 5154, 5328, 5499, 5672, 5846, 6017, 6189, 6362, 6534, 6707, 6880, 
-        7052, 7224, 7397, 7570, 7742, 7914, 8087, 8260, 8432, 8605, 8777, 8950, 
-        9122, 9295, 9467, 9640, 9812, 9985, 10156, 10330, 10497, 10686, 10824, 11056, 
-        11135, 11447, 11422, 11866, 11670, 12341, 11837, 12953, 11718, 14354, 741, -7924, 
-        -5288, -6522, -5405, -5909, -5238, -5436, -4990, -5015, -4704, -4626, -4394, -4255, 
-        -4065, -3899, -3726, -3553, -3381, -3208, -3036, -2863, -2691, -2518, -2346, -2173, 
-        -2000, -1828, -1657, -1483, -1312, -1138, -965, -794, -622, -449, -275, -104 
-    };
-
-    // AKWF_blended_0033 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0033[600] PROGMEM = {
-        343, 706, 1066, 1428, 1789, 2150, 2512, 2873, 3233, 3594, 3953, 4314, 
-        4673, 5032, 5390, 5749, 6107, 6463, 6820, 7177, 7531, 7886, 8240, 8593, 
-        8946, 9299, 9649, 10001, 10351, 10699, 11046, 11393, 11740, 12085, 12429, 12771, 
-        13113, 13456, 13795, 14134, 14470, 14808, 15143, 15476, 15809, 16140, 16470, 16800, 
-        17127, 17453, 17778, 18100, 18423, 18742, 19061, 19377, 19693, 20007, 20318, 20630, 
-        20934, 21257, 21529, 21890, 22102, 22536, 22643, 23204, 23141, 23916, 23551, 24755, 
-        23678, 26352, 13285, 5000, 7668, 6581, 7771, 7388, 8142, 8051, 8583, 8655, 
-        9052, 9219, 9536, 9758, 10027, 10272, 10521, 10767, 11011, 11252, 11491, 11727, 
-        11961, 12194, 12423, 12650, 12874, 13097, 13316, 13532, 13747, 13959, 14168, 14375, 
-        14579, 14780, 14980, 15176, 15370, 15560, 15749, 15935, 16119, 16298, 16476, 16651, 
-        16823, 16994, 17158, 17327, 17482, 17651, 17793, 17962, 18093, 18264, 18381, 18558, 
-        18654, 18840, 18917, 19113, 19164, 19380, 19397, 19638, 19614, 19893, 19807, 20151, 
-        19970, 20432, 20060, 20826, 19795, 28646, 32124, 31085, 31836, 31444, 31880, 31667, 
-        31974, 31845, 32078, 31997, 32180, 32132, 32276, 32249, 32365, 32353, 32445, 32444, 
-        32516, 32522, 32577, 32586, 32628, 32640, 32669, 32680, 32700, 32709, 32721, 32726, 
-        32732, 32732, 32732, 32728, 32721, 32712, 32700, 32686, 32668, 32649, 32626, 32602, 
-        32574, 32545, 32511, 32476, 32439, 32399, 32356, 32310, 32263, 32213, 32160, 32106, 
-        32048, 31988, 31926, 31862, 31794, 31727, 31650, 31592, 31483, 31461, 31291, 31343, 
-        31067, 31243, 30797, 31188, 30439, 31259, 29798, 32084, 18634, 9965, 12246, 10776, 
-        11582, 10814, 11183, 10710, 10857, 10546, 10561, 10346, 10280, 10120, 10008, 9873, 
-        9743, 9611, 9476, 9339, 9201, 9061, 8922, 8779, 8635, 8489, 8343, 8196, 
-        8045, 7895, 7743, 7589, 7434, 7279, 7121, 6963, 6804, 6644, 6481, 6319, 
-        6156, 5990, 5824, 5657, 5490, 5321, 5152, 4982, 4810, 4638, 4464, 4291, 
-        4118, 3943, 3766, 3591, 3415, 3237, 3059, 2880, 2701, 2523, 2343, 2162, 
-        1983, 1801, 1620, 1439, 1258, 1075, 893, 712, 529, 346, 164, -16, 
-        -199, -382, -564, -747, -928, -1111, -1292, -1475, -1656, -1837, -2016, -2197, 
-        -2377, -2558, -2736, -2916, -3094, -3272, -3450, -3626, -3801, -3978, -4153, -4326, 
-        -4500, -4673, -4845, -5017, -5187, -5356, -5525, -5692, -5860, -6025, -6190, -6354, 
-        -6517, -6679, -6839, -6999, -7157, -7315, -7470, -7625, -7778, -7930, -8081, -8231, 
-        -8378, -8524, -8670, -8814, -8957, -9097, -9236, -9375, -9511, -9645, -9778, -9909, 
-        -10044, -10156, -10314, -10381, -10595, -10581, -10892, -10745, -11218, -10850, -11615, -10811, 
-        -12282, -10001, -23454, -32120, -29833, -31294, -30474, -31223, -30832, -31279, -31102, -31378, 
-        -31326, -31497, -31518, -31627, -31685, -31762, -31830, -31897, -31962, -32023, -32083, -32140, 
-        -32195, -32249, -32298, -32345, -32391, -32434, -32474, -32511, -32546, -32579, -32609, -32637, 
-        -32662, -32683, -32703, -32721, -32735, -32748, -32757, -32763, -32767, -32767, -32766, -32761, 
-        -32757, -32744, -32735, -32715, -32703, -32675, -32663, -32622, -32612, -32557, -32551, -32479, 
-        -32480, -32388, -32401, -32284, -32312, -32167, -32215, -32032, -32114, -31880, -32009, -31702, 
-        -31916, -31480, -31871, -31121, -32158, -23310, -19830, -20861, -20096, -20465, -20005, -20186, 
-        -19842, -19928, -19649, -19674, -19433, -19416, -19199, -19149, -18952, -18875, -18690, -18593, 
-        -18416, -18300, -18128, -17997, -17829, -17686, -17517, -17362, -17193, -17029, -16859, -16687, 
-        -16512, -16334, -16154, -15970, -15784, -15595, -15405, -15212, -15015, -14816, -14615, -14409, 
-        -14203, -13994, -13783, -13568, -13351, -13132, -12909, -12685, -12458, -12229, -11996, -11763, 
-        -11526, -11287, -11046, -10802, -10556, -10306, -10062, -9794, -9571, -9255, -9087, -8690, 
-        -8616, -8087, -8176, -7424, -7806, -6616, -7703, -5037, -18105, -26387, -23713, -24791, 
-        -23586, -23951, -23176, -23239, -22679, -22571, -22137, -21925, -21564, -21291, -20969, -20665, 
-        -20353, -20042, -19729, -19413, -19095, -18777, -18458, -18136, -17813, -17488, -17161, -16836, 
-        -16506, -16176, -15844, -15511, -15178, -14843, -14506, -14169, -13830, -13491, -13149, -12806, 
-        -12464, -12120, -11775, -11428, -11081, -10734, -10384, -10036, -9685, -9335, -8982, -8629, 
-        -8276, -7921, -7566, -7212, -6856, -6498, -6142, -5784, -5425, -5068, -4708, -4349, 
-        -3989, -3629, -3269, -2908, -2547, -2185, -1824, -1464, -1102, -741, -379, -16 
-    };
-
-    // AKWF_blended_0035 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0035[600] PROGMEM = {
-        392, 1068, 1753, 2430, 3113, 3793, 4473, 5154, 5835, 6515, 7195, 7878, 
-        8556, 9239, 9919, 10600, 11280, 11961, 12641, 13324, 14001, 14685, 15364, 16046, 
-        16725, 17409, 18085, 18771, 19444, 20135, 20802, 21508, 21994, 22259, 22565, 22847, 
-        23148, 23432, 23729, 24016, 24312, 24600, 24895, 25185, 25477, 25767, 26060, 26353, 
-        26644, 26936, 27227, 27518, 27811, 28103, 28394, 28685, 28978, 29269, 29562, 29854, 
-        30144, 30438, 30726, 31022, 31309, 31606, 31891, 32191, 32471, 32767, 32502, 31978, 
-        31512, 31012, 30535, 30042, 29561, 29071, 28587, 28100, 27614, 27129, 26643, 26156, 
-        25669, 25183, 24698, 24212, 23724, 23238, 22752, 22265, 21781, 21294, 20807, 20321, 
-        19834, 19349, 18863, 18376, 17890, 17403, 16918, 16432, 15945, 15459, 14972, 14293, 
-        13613, 12931, 12250, 11570, 10889, 10208, 9528, 8848, 8167, 7487, 6805, 6124, 
-        5444, 4763, 4083, 3402, 2721, 2041, 1359, 679, -1, -682, -1362, -2042, 
-        -2723, -3403, -4086, -4766, -5447, -6125, -6809, -7487, -8172, -8846, -9536, -10204, 
-        -10890, -11012, -10878, -10800, -10691, -10602, -10499, -10406, -10306, -10210, -10111, -10016, 
-        -9916, -9820, -9723, -9625, -9528, -9432, -9333, -9236, -9139, -9042, -8945, -8848, 
-        -8749, -8654, -8555, -8459, -8361, -8265, -8165, -8072, -7970, -7879, -7774, -7686, 
-        -7574, -7503, -7211, -6699, -6228, -5732, -5253, -4760, -4279, -3789, -3306, -2818, 
-        -2333, -1845, -1361, -874, -388, 98, 584, 1071, 1556, 2043, 2529, 3015, 
-        3502, 3987, 4473, 4961, 5446, 5933, 6418, 6905, 7391, 7878, 8361, 8852, 
-        9332, 9827, 10302, 10792, 10720, 10391, 10119, 9815, 9532, 9234, 8946, 8652, 
-        8364, 8068, 7778, 7487, 7195, 6903, 6611, 6320, 6027, 5736, 5444, 5153, 
-        4860, 4569, 4277, 3986, 3693, 3402, 3110, 2819, 2526, 2235, 1943, 1651, 
-        1361, 1068, 777, 485, 192, -97, -389, -681, -972, -1264, -1556, -1848, 
-        -2139, -2430, -2723, -3015, -3306, -3599, -3890, -4182, -4473, -4766, -5057, -5348, 
-        -5640, -5931, -6224, -6515, -6807, -7098, -7391, -7682, -7975, -8265, -8558, -8848, 
-        -9142, -9431, -9727, -10012, -10313, -10592, -10889, -10623, -10100, -9632, -9134, -8656, 
-        -8164, -7682, -7193, -6708, -6221, -5736, -5249, -4763, -4276, -3790, -3303, -2818, 
-        -2332, -1845, -1361, -874, -388, 98, 584, 1072, 1556, 2045, 2529, 3016, 
-        3500, 3990, 4472, 4964, 5441, 5938, 6410, 6923, 7214, 7284, 7396, 7484, 
-        7588, 7680, 7782, 7875, 7975, 8071, 8169, 8265, 8365, 8459, 8558, 8654, 
-        8752, 8849, 8948, 9043, 9141, 9238, 9335, 9433, 9530, 9628, 9723, 9822, 
-        9919, 10017, 10112, 10212, 10306, 10407, 10499, 10604, 10691, 10792, 10330, 9613, 
-        8952, 8260, 7586, 6900, 6224, 5540, 4861, 4179, 3499, 2818, 2138, 1456, 
-        777, 95, -585, -1265, -1946, -2626, -3307, -3989, -4669, -5350, -6030, -6710, 
-        -7392, -8072, -8752, -9433, -10113, -10794, -11476, -12156, -12837, -13517, -14198, -14684, 
-        -15169, -15656, -16142, -16628, -17113, -17600, -18087, -18573, -19060, -19544, -20033, -20518, 
-        -21004, -21491, -21977, -22462, -22949, -23436, -23922, -24409, -24893, -25380, -25867, -26353, 
-        -26839, -27324, -27811, -28297, -28785, -29269, -29758, -30239, -30730, -31211, -31706, -32181, 
-        -32670, -32599, -32270, -31999, -31694, -31412, -31112, -30825, -30531, -30242, -29948, -29658, 
-        -29364, -29074, -28781, -28490, -28198, -27907, -27614, -27323, -27031, -26740, -26447, -26156, 
-        -25863, -25573, -25280, -24990, -24696, -24406, -24112, -23825, -23528, -23242, -22942, -22661, 
-        -22354, -22090, -21603, -20896, -20230, -19539, -18867, -18180, -17503, -16819, -16141, -15458, 
-        -14780, -14097, -13418, -12736, -12056, -11375, -10695, -10013, -9333, -8652, -7971, -7291, 
-        -6610, -5930, -5249, -4567, -3889, -3206, -2528, -1845, -1166, -482, 194, 879, 
-        1552, 2243, 2912, 3596, 3720, 3585, 3507, 3398, 3310, 3206, 3113, 3012, 
-        2917, 2819, 2723, 2625, 2528, 2430, 2333, 2236, 2139, 2042, 1943, 1846, 
-        1749, 1652, 1555, 1458, 1361, 1264, 1166, 1069, 971, 874, 777, 679, 
-        582, 485, 388, 291, 192, 95, -1, -98, -195, -292, -389, -487, 
-        -584, -681, -779, -876, -972, -1071, -1168, -1265, -1363, -1459, -1556, -1653, 
-        -1751, -1849, -1946, -2043, -2139, -2238, -2335, -2432, -2529, -2626, -2725, -2819, 
-        -2920, -3013, -3116, -3205, -3311, -3398, -3499, -3039, -2320, -1659, -967, -295 
-    };
-
-    // AKWF_blended_0036 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0036[600] PROGMEM = {
-        63, 209, 356, 503, 647, 793, 942, 1086, 1233, 1380, 1526, 1673, 
-        1820, 1966, 2113, 2259, 2406, 2553, 2699, 2846, 2992, 3137, 3286, 3432, 
-        3579, 3725, 3870, 4016, 4165, 4312, 4456, 4603, 4749, 4898, 5042, 5192, 
-        5333, 5485, 5631, 6036, 6562, 7060, 7573, 8078, 8589, 9095, 9605, 10113, 
-        10621, 11129, 11638, 12146, 12654, 13162, 13670, 14181, 14686, 15194, 15702, 16213, 
-        16721, 17229, 17737, 18245, 18751, 19261, 19767, 20278, 20783, 21296, 21802, 22312, 
-        22816, 23331, 23829, 24357, 24719, 24916, 25146, 25356, 25581, 25793, 26016, 26231, 
-        26451, 26665, 26885, 27103, 27320, 27537, 27757, 27975, 28192, 28410, 28629, 28844, 
-        29064, 29282, 29499, 29716, 29936, 30154, 30374, 30591, 30806, 31026, 31243, 31463, 
-        31678, 31898, 32113, 32335, 32548, 32767, 32727, 32565, 32431, 32280, 32141, 31994, 
-        31852, 31706, 31564, 31420, 31276, 31132, 30990, 30844, 30700, 30558, 30414, 30270, 
-        30126, 29982, 29840, 29694, 29552, 29408, 29264, 29120, 28976, 28832, 28688, 28544, 
-        28399, 28258, 28114, 27970, 27826, 27682, 27537, 27029, 26521, 26013, 25505, 24997, 
-        24489, 23981, 23473, 22965, 22457, 21948, 21440, 20932, 20424, 19916, 19408, 18897, 
-        18389, 17884, 17373, 16868, 16357, 15849, 15341, 14833, 14325, 13817, 13308, 12800, 
-        12292, 11784, 11276, 10768, 10257, 9752, 9241, 8738, 8228, 7977, 7848, 7694, 
-        7553, 7403, 7259, 7110, 6964, 6817, 6673, 6524, 6380, 6231, 6086, 5940, 
-        5793, 5644, 5500, 5353, 5207, 5060, 4914, 4767, 4620, 4474, 4330, 4180, 
-        4036, 3887, 3743, 3594, 3452, 3298, 3159, 3005, 2869, 2704, 2702, 2866, 
-        2997, 3149, 3288, 3437, 3576, 3723, 3865, 4011, 4153, 4297, 4441, 4585, 
-        4729, 4873, 5015, 5159, 5303, 5447, 5591, 5735, 5879, 6023, 6165, 6311, 
-        6453, 6597, 6741, 6885, 7029, 7173, 7315, 7462, 7603, 7750, 7889, 8033, 
-        7919, 7684, 7474, 7252, 7037, 6817, 6600, 6382, 6165, 5945, 5728, 5510, 
-        5293, 5073, 4855, 4638, 4421, 4203, 3986, 3766, 3549, 3331, 3114, 2896, 
-        2676, 2459, 2242, 2022, 1804, 1587, 1370, 1152, 935, 715, 497, 280, 
-        63, -154, -374, -591, -808, -1026, -1246, -1463, -1680, -1898, -2115, -2335, 
-        -2550, -2770, -2987, -3205, -3422, -3642, -3859, -4077, -4294, -4512, -4732, -4949, 
-        -5166, -5384, -5601, -5819, -6038, -6256, -6473, -6691, -6911, -7128, -7348, -7563, 
-        -7783, -7995, -8217, -8174, -8013, -7879, -7730, -7588, -7444, -7302, -7156, -7014, 
-        -6870, -6726, -6582, -6438, -6294, -6150, -6006, -5861, -5720, -5573, -5432, -5288, 
-        -5144, -5000, -4855, -4711, -4570, -4423, -4282, -4135, -3993, -3849, -3708, -3559, 
-        -3422, -3270, -3137, -2975, -2975, -3142, -3278, -3430, -3574, -3723, -3867, -4014, 
-        -4160, -4307, -4454, -4600, -4744, -4893, -5037, -5187, -5333, -5480, -5624, -5770, 
-        -5920, -6066, -6210, -6357, -6504, -6650, -6799, -6943, -7090, -7237, -7383, -7530, 
-        -7676, -7821, -7970, -8114, -8265, -8410, -8817, -9342, -9840, -10353, -10859, -11370, 
-        -11875, -12386, -12891, -13402, -13910, -14418, -14926, -15434, -15942, -16450, -16959, -17467, 
-        -17975, -18483, -18993, -19502, -20010, -20518, -21023, -21531, -22042, -22550, -23058, -23566, 
-        -24072, -24582, -25091, -25599, -26107, -26615, -27123, -27267, -27411, -27555, -27699, -27841, 
-        -27985, -28129, -28273, -28417, -28561, -28703, -28849, -28993, -29135, -29279, -29423, -29567, 
-        -29711, -29855, -30000, -30144, -30285, -30429, -30573, -30717, -30862, -31006, -31147, -31291, 
-        -31438, -31579, -31726, -31865, -32012, -32153, -32302, -32439, -32586, -32469, -32234, -32027, 
-        -31802, -31590, -31367, -31152, -30932, -30717, -30498, -30280, -30060, -29843, -29625, -29408, 
-        -29191, -28971, -28753, -28536, -28319, -28101, -27881, -27664, -27446, -27229, -27009, -26794, 
-        -26574, -26357, -26137, -25922, -25702, -25487, -25265, -25053, -24825, -24628, -24264, -23736, 
-        -23238, -22722, -22221, -21708, -21203, -20692, -20184, -19676, -19168, -18660, -18152, -17644, 
-        -17136, -16627, -16119, -15609, -15103, -14595, -14084, -13576, -13068, -12563, -12052, -11544, 
-        -11038, -10528, -10020, -9512, -9004, -8493, -7987, -7477, -6974, -6461, -5958, -5447, 
-        -5199, -5070, -4914, -4775, -4620, -4479, -4330, -4186, -4039, -3892, -3746, -3599, 
-        -3452, -3306, -3159, -3013, -2866, -2719, -2573, -2426, -2280, -2133, -1986, -1842, 
-        -1693, -1549, -1400, -1253, -1109, -963, -816, -667, -523, -376, -230, -83 
-    };
-
-    // AKWF_blended_0037 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0037[600] PROGMEM = {
-        17, 48, 79, 107, 138, 169, 197, 228, 259, 290, 318, 349, 
-        380, 408, 439, 469, 500, 528, 559, 590, 621, 649, 680, 711, 
-        739, 770, 801, 831, 860, 891, 921, 952, 980, 1011, 1042, 1070, 
-        1104, 1129, 1163, 1188, 1224, 1253, 1545, 1961, 2349, 2752, 3148, 3548, 
-        3944, 4342, 4740, 5138, 5533, 5931, 6329, 6727, 7123, 7521, 7919, 8317, 
-        8715, 9113, 9511, 9909, 10304, 10702, 11100, 11496, 11896, 12292, 12690, 13088, 
-        13486, 13884, 14282, 14677, 15075, 15473, 15871, 16269, 16665, 17063, 17461, 17859, 
-        18257, 18655, 19050, 19448, 19846, 20244, 20642, 21038, 21436, 21834, 22232, 22630, 
-        23028, 23423, 23821, 24219, 24617, 25015, 25411, 25809, 26207, 26605, 27003, 27398, 
-        27796, 28194, 28595, 28990, 29388, 29784, 30184, 30577, 30978, 31111, 31124, 31163, 
-        31186, 31222, 31247, 31281, 31309, 31340, 31368, 31401, 31427, 31463, 31486, 31525, 
-        31545, 31589, 31602, 31653, 31656, 31720, 31710, 31787, 31763, 31856, 31812, 31928, 
-        31858, 32005, 31900, 32087, 31928, 32190, 31930, 32339, 31830, 32767, 25367, 22296, 
-        22863, 21983, 22024, 21392, 21284, 20755, 20573, 20098, 19872, 19435, 19179, 18768, 
-        18488, 18095, 17800, 17422, 17117, 16747, 16431, 16069, 15745, 15394, 15065, 14716, 
-        14382, 14035, 13699, 13357, 13021, 12679, 12338, 11996, 11660, 11316, 10982, 10638, 
-        10564, 10607, 10625, 10659, 10684, 10712, 10738, 10766, 10795, 10823, 10849, 10877, 
-        10902, 10931, 10959, 10985, 11013, 11039, 11067, 11095, 11123, 11149, 11177, 11203, 
-        11231, 11259, 11285, 11313, 11342, 11367, 11396, 11424, 11449, 11478, 11503, 11532, 
-        11560, 11586, 11614, 11642, 11670, 11696, 11724, 11750, 11778, 11806, 11832, 11860, 
-        11889, 11917, 11942, 11971, 11999, 12025, 12053, 12079, 12107, 12132, 12161, 12189, 
-        12217, 12243, 12271, 12299, 12325, 12353, 12382, 12407, 12435, 12461, 12492, 12515, 
-        12546, 12569, 12597, 12364, 12004, 11673, 11329, 10990, 10648, 10312, 9970, 9631, 
-        9287, 8948, 8609, 8270, 7929, 7590, 7248, 6910, 6568, 6229, 5890, 5549, 
-        5210, 4868, 4529, 4188, 3849, 3507, 3168, 2829, 2488, 2149, 1807, 1468, 
-        1127, 788, 449, 107, -231, -572, -911, -1250, -1589, -1931, -2272, -2611, 
-        -2950, -3291, -3630, -3972, -4311, -4652, -4991, -5330, -5672, -6011, -6352, -6691, 
-        -7030, -7372, -7713, -8052, -8391, -8733, -9072, -9413, -9752, -10094, -10433, -10772, 
-        -11113, -11455, -11791, -12135, -12469, -12813, -12887, -12844, -12826, -12792, -12769, -12738, 
-        -12713, -12685, -12659, -12631, -12602, -12574, -12548, -12520, -12495, -12466, -12441, -12412, 
-        -12384, -12356, -12330, -12302, -12274, -12248, -12220, -12192, -12166, -12138, -12109, -12084, 
-        -12058, -12030, -12002, -11973, -11948, -11919, -11891, -11865, -11837, -11809, -11781, -11755, 
-        -11729, -11701, -11673, -11645, -11619, -11591, -11562, -11537, -11508, -11480, -11455, -11426, 
-        -11398, -11372, -11344, -11318, -11290, -11262, -11234, -11208, -11180, -11154, -11126, -11098, 
-        -11069, -11044, -11015, -10990, -10959, -10936, -10905, -10882, -10854, -11090, -11447, -11778, 
-        -12122, -12461, -12803, -13142, -13483, -13820, -14164, -14500, -14844, -15178, -15527, -15856, 
-        -16210, -16534, -16893, -17209, -17576, -17884, -18264, -18557, -18953, -19230, -19641, -19898, 
-        -20337, -20560, -21035, -21217, -21746, -21857, -22486, -22447, -23326, -22758, -29789, -32490, 
-        -31553, -32061, -31653, -31912, -31650, -31810, -31622, -31728, -31581, -31650, -31535, -31579, 
-        -31484, -31509, -31432, -31440, -31378, -31376, -31324, -31312, -31265, -31247, -31209, -31186, 
-        -31150, -31124, -31091, -31062, -31032, -31003, -30970, -30942, -30911, -30885, -30849, -30819, 
-        -30526, -30110, -29722, -29319, -28926, -28525, -28130, -27729, -27334, -26936, -26538, -26143, 
-        -25745, -25346, -24948, -24553, -24152, -23757, -23359, -22961, -22566, -22165, -21770, -21372, 
-        -20973, -20575, -20177, -19782, -19384, -18986, -18588, -18193, -17792, -17397, -16998, -16600, 
-        -16202, -15804, -15409, -15011, -14613, -14215, -13820, -13419, -13024, -12625, -12227, -11829, 
-        -11431, -11036, -10638, -10240, -9842, -9444, -9046, -8648, -8252, -7852, -7456, -7058, 
-        -6660, -6265, -5867, -5469, -5071, -4676, -4275, -3879, -3479, -3083, -2685, -2290, 
-        -1889, -1497, -1096, -962, -950, -911, -888, -852, -824, -793, -765, -734, 
-        -703, -672, -644, -613, -582, -554, -523, -493, -462, -433, -403, -372, 
-        -341, -313, -282, -251, -223, -192, -161, -130, -102, -71, -41, -10 
-    };
-
-    // AKWF_blended_0038 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0038[600] PROGMEM = {
-        0, 16160, 16335, 16511, 16688, 16863, 17038, 17213, 17388, 17563, 17738, 17913, 
-        18088, 18261, 18436, 18609, 18782, 18955, 19128, 19301, 19474, 19645, 19816, 19987, 
-        20157, 20328, 20497, 20666, 20834, 21003, 21172, 21338, 21503, 21669, 21833, 21998, 
-        22162, 22327, 22489, 22649, 22811, 22971, 23129, 23290, 23445, 23603, 23759, 23915, 
-        24069, 24223, 24376, 24528, 24677, 24829, 24976, 25126, 25271, 25418, 25564, 25707, 
-        25850, 25991, 26131, 26270, 26409, 26546, 26682, 26817, 26951, 27084, 27214, 27344, 
-        27472, 27600, 27726, 27852, 27976, 28098, 28220, 28339, 28457, 28574, 28689, 28803, 
-        28916, 29027, 29138, 29245, 29353, 29458, 29563, 29665, 29765, 29866, 29964, 30060, 
-        30154, 30248, 30340, 30430, 30519, 30607, 30692, 30775, 30857, 30938, 31017, 31096, 
-        31170, 31245, 31316, 31386, 31457, 31523, 31589, 31653, 31715, 31775, 31834, 31892, 
-        31945, 31999, 32050, 32101, 32148, 32195, 32240, 32283, 32323, 32364, 32400, 32437, 
-        32471, 32503, 32533, 32560, 32588, 32612, 32635, 32656, 32676, 32693, 32708, 32723, 
-        32733, 32744, 32753, 32759, 32763, 32767, 32767, 32767, 32763, 32759, 32753, 32744, 
-        32733, 32723, 32708, 32693, 32676, 32656, 32635, 32612, 32588, 32560, 32533, 32503, 
-        32471, 32437, 32400, 32364, 32323, 32283, 32240, 32195, 32148, 32101, 32050, 31999, 
-        31945, 31892, 31834, 31775, 31715, 31653, 31589, 31523, 31457, 31386, 31316, 31245, 
-        31170, 31096, 31017, 30938, 30857, 30775, 30692, 30607, 30519, 30430, 30340, 30248, 
-        30154, 30060, 29964, 29866, 29765, 29665, 29563, 29458, 29353, 29245, 29138, 29027, 
-        28916, 28803, 28689, 28574, 28457, 28339, 28220, 28098, 27976, 27852, 27726, 27600, 
-        27472, 27344, 27214, 27084, 26951, 26817, 26682, 26546, 26409, 26270, 26131, 25991, 
-        25850, 25707, 25564, 25418, 25271, 25126, 24976, 24829, 24677, 24528, 24376, 24223, 
-        24069, 23915, 23759, 23603, 23445, 23290, 23129, 22971, 22811, 22649, 22489, 22327, 
-        22162, 21998, 21833, 21669, 21503, 21338, 21172, 21003, 20834, 20666, 20497, 20328, 
-        20157, 19987, 19816, 19645, 19474, 19301, 19128, 18955, 18782, 18609, 18436, 18261, 
-        18088, 17913, 17738, 17563, 17388, 17213, 17038, 16863, 16688, 16511, 16335, 16160, 
-        0, -16160, -16335, -16511, -16688, -16863, -17038, -17213, -17388, -17563, -17738, -17913, 
-        -18088, -18261, -18436, -18609, -18782, -18955, -19128, -19301, -19474, -19645, -19816, -19987, 
-        -20157, -20328, -20497, -20666, -20834, -21003, -21172, -21338, -21503, -21669, -21833, -21998, 
-        -22162, -22327, -22489, -22649, -22811, -22971, -23129, -23290, -23445, -23603, -23759, -23915, 
-        -24069, -24223, -24376, -24528, -24677, -24829, -24976, -25126, -25271, -25418, -25564, -25707, 
-        -25850, -25991, -26131, -26270, -26409, -26546, -26682, -26817, -26951, -27084, -27214, -27344, 
-        -27472, -27600, -27726, -27852, -27976, -28098, -28220, -28339, -28457, -28574, -28689, -28803, 
-        -28916, -29027, -29138, -29245, -29353, -29458, -29563, -29665, -29765, -29866, -29964, -30060, 
-        -30154, -30248, -30340, -30430, -30519, -30607, -30692, -30775, -30857, -30938, -31017, -31096, 
-        -31170, -31245, -31316, -31386, -31457, -31523, -31589, -31653, -31715, -31775, -31834, -31892, 
-        -31945, -31999, -32050, -32101, -32148, -32195, -32240, -32283, -32323, -32364, -32400, -32437, 
-        -32471, -32503, -32533, -32560, -32588, -32612, -32635, -32656, -32676, -32693, -32708, -32723, 
-        -32733, -32744, -32753, -32759, -32763, -32767, -32767, -32767, -32763, -32759, -32753, -32744, 
-        -32733, -32723, -32708, -32693, -32676, -32656, -32635, -32612, -32588, -32560, -32533, -32503, 
-        -32471, -32437, -32400, -32364, -32323, -32283, -32240, -32195, -32148, -32101, -32050, -31999, 
-        -31945, -31892, -31834, -31775, -31715, -31653, -31589, -31523, -31457, -31386, -31316, -31245, 
-        -31170, -31096, -31017, -30938, -30857, -30775, -30692, -30607, -30519, -30430, -30340, -30248, 
-        -30154, -30060, -29964, -29866, -29765, -29665, -29563, -29458, -29353, -29245, -29138, -29027, 
-        -28916, -28803, -28689, -28574, -28457, -28339, -28220, -28098, -27976, -27852, -27726, -27600, 
-        -27472, -27344, -27214, -27084, -26951, -26817, -26682, -26546, -26409, -26270, -26131, -25991, 
-        -25850, -25707, -25564, -25418, -25271, -25126, -24976, -24829, -24677, -24528, -24376, -24223, 
-        -24069, -23915, -23759, -23603, -23445, -23290, -23129, -22971, -22811, -22649, -22489, -22327, 
-        -22162, -21998, -21833, -21669, -21503, -21338, -21172, -21003, -20834, -20666, -20497, -20328, 
-        -20157, -19987, -19816, -19645, -19474, -19301, -19128, -18955, -18782, -18609, -18436, -18261, 
-        -18088, -17913, -17738, -17563, -17388, -17213, -17038, -16863, -16688, -16511, -16335, -16160 
-    };
-
-    // AKWF_blended_0039 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0039[600] PROGMEM = {
-        34, 17195, 14196, 16240, 15081, 16256, 15614, 16441, 16052, 16685, 16449, 16955, 
-        16823, 17241, 17185, 17538, 17538, 17838, 17884, 18142, 18222, 18451, 18557, 18761, 
-        18887, 19071, 19213, 19384, 19534, 19696, 19850, 20008, 20164, 20319, 20473, 20627, 
-        20781, 20935, 21087, 21238, 21390, 21540, 21688, 21838, 21984, 22132, 22279, 22425, 
-        22569, 22713, 22857, 22999, 23140, 23282, 23420, 23560, 23696, 23834, 23970, 24105, 
-        24239, 24371, 24503, 24633, 24763, 24891, 25019, 25146, 25272, 25396, 25518, 25640, 
-        25760, 25880, 25998, 26117, 26233, 26347, 26461, 26573, 26683, 26793, 26901, 27008, 
-        27114, 27218, 27322, 27424, 27524, 27622, 27720, 27816, 27910, 28005, 28097, 28187, 
-        28275, 28363, 28449, 28533, 28617, 28699, 28779, 28857, 28934, 29010, 29084, 29158, 
-        29228, 29298, 29364, 29432, 29496, 29558, 29620, 29680, 29738, 29794, 29850, 29905, 
-        29955, 30007, 30051, 30105, 30139, 30199, 30217, 30289, 30285, 30377, 30345, 30459, 
-        30393, 30539, 30431, 30619, 30455, 30697, 30465, 30779, 30453, 30872, 30417, 30984, 
-        30333, 31148, 30147, 31476, 29600, 32766, 15702, -1295, 1867, -16, 1301, 282, 
-        1079, 406, 946, 464, 846, 486, 762, 486, 682, 468, 602, 436, 
-        524, 394, 442, 340, 358, 276, 270, 202, 178, 120, 80, 28, 
-        -20, -72, -126, -180, -238, -296, -356, -416, -480, -544, -610, -678, 
-        -748, -818, -890, -965, -1041, -1119, -1197, -1277, -1359, -1441, -1527, -1613, 
-        -1699, -1789, -1879, -1972, -2066, -2160, -2256, -2354, -2452, -2552, -2654, -2756, 
-        -2862, -2969, -3075, -3183, -3293, -3403, -3515, -3629, -3743, -3860, -3978, -4096, 
-        -4214, -4336, -4458, -4580, -4704, -4831, -4957, -5085, -5213, -5343, -5473, -5605, 
-        -5737, -5872, -6006, -6142, -6278, -6416, -6556, -6694, -6835, -6977, -7119, -7263, 
-        -7405, -7551, -7697, -7844, -7990, -8138, -8286, -8436, -8586, -8739, -8889, -9041, 
-        -9195, -9347, -9501, -9658, -9812, -9968, -10124, -10282, -10436, -10603, -10749, -10925, 
-        -11059, -11253, -11369, -11586, -11680, -11922, -11986, -12264, -12288, -12613, -12587, -12971, 
-        -12879, -13337, -13157, -13722, -13417, -14136, -13638, -14609, -13764, -15251, -13538, -16863, 
-        34, 16867, 13536, 15251, 13764, 14609, 13638, 14136, 13417, 13722, 13157, 13337, 
-        12879, 12971, 12587, 12613, 12288, 12264, 11986, 11922, 11680, 11586, 11369, 11253, 
-        11059, 10925, 10749, 10603, 10436, 10282, 10124, 9968, 9812, 9658, 9501, 9347, 
-        9195, 9041, 8889, 8739, 8586, 8436, 8286, 8138, 7990, 7844, 7697, 7551, 
-        7405, 7263, 7119, 6977, 6835, 6694, 6556, 6416, 6278, 6142, 6006, 5872, 
-        5737, 5605, 5473, 5343, 5213, 5085, 4957, 4831, 4704, 4580, 4458, 4336, 
-        4214, 4096, 3978, 3860, 3743, 3629, 3515, 3403, 3293, 3183, 3075, 2969, 
-        2862, 2756, 2654, 2552, 2452, 2354, 2256, 2160, 2066, 1972, 1879, 1789, 
-        1699, 1613, 1527, 1441, 1359, 1277, 1197, 1119, 1041, 965, 890, 818, 
-        748, 678, 610, 544, 480, 416, 356, 296, 238, 180, 126, 72, 
-        20, -28, -80, -120, -178, -202, -270, -276, -358, -340, -442, -394, 
-        -524, -436, -602, -468, -682, -486, -762, -486, -846, -464, -946, -406, 
-        -1079, -284, -1299, 16, -1867, 1291, -15772, -32767, -29600, -31476, -30147, -31148, 
-        -30333, -30984, -30417, -30872, -30453, -30779, -30465, -30697, -30455, -30619, -30431, -30539, 
-        -30393, -30459, -30345, -30377, -30285, -30289, -30217, -30199, -30139, -30105, -30051, -30007, 
-        -29955, -29905, -29850, -29794, -29738, -29680, -29620, -29558, -29496, -29432, -29364, -29298, 
-        -29228, -29158, -29084, -29010, -28934, -28857, -28779, -28699, -28617, -28533, -28449, -28363, 
-        -28275, -28187, -28097, -28005, -27910, -27816, -27720, -27622, -27524, -27424, -27322, -27218, 
-        -27114, -27008, -26901, -26793, -26683, -26573, -26461, -26347, -26233, -26117, -25998, -25880, 
-        -25760, -25640, -25518, -25396, -25272, -25146, -25019, -24891, -24763, -24633, -24503, -24371, 
-        -24239, -24105, -23970, -23834, -23696, -23560, -23420, -23282, -23140, -22999, -22857, -22713, 
-        -22569, -22425, -22279, -22132, -21984, -21838, -21688, -21540, -21390, -21238, -21087, -20935, 
-        -20781, -20627, -20473, -20319, -20162, -20008, -19850, -19696, -19534, -19384, -19213, -19071, 
-        -18887, -18761, -18557, -18451, -18222, -18142, -17884, -17838, -17538, -17538, -17185, -17241, 
-        -16823, -16955, -16449, -16685, -16052, -16441, -15614, -16256, -15081, -16240, -14196, -17193 
-    };
-
-    // AKWF_blended_0041 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0041[600] PROGMEM = {
-        11747, 11788, 11830, 11873, 11914, 11955, 11997, 12038, 12081, 12122, 12163, 12205, 
-        12246, 12289, 12330, 12371, 12413, 12454, 12497, 12538, 12580, 12621, 12662, 12705, 
-        12746, 12788, 12829, 12870, 12913, 12955, 12996, 13037, 13078, 13121, 13163, 13204, 
-        13245, 13287, 13329, 13371, 13412, 13453, 13496, 13538, 13579, 13620, 13661, 13704, 
-        13746, 13787, 13828, 13870, 13912, 13954, 13995, 14036, 14078, 14119, 14162, 14203, 
-        14244, 14286, 14327, 14370, 14411, 14453, 14494, 14535, 14578, 14619, 14661, 14702, 
-        14743, 14786, 14827, 14869, 14910, 14951, 14994, 15036, 15077, 15118, 15161, 15202, 
-        15244, 15285, 15326, 15369, 15410, 15452, 15493, 15534, 15577, 15619, 15660, 15701, 
-        15743, 15785, 15827, 15868, 15909, 15951, 15994, 16035, 16076, 16117, 16159, 16202, 
-        16243, 16284, 16326, 16367, 16410, 16451, 16492, 16534, 16575, 16618, 16659, 16700, 
-        16742, 16783, 16826, 16867, 16909, 16950, 16991, 17034, 17075, 17117, 17158, 17199, 
-        17242, 17283, 17325, 17366, 17409, 17450, 17492, 17533, 17574, 17617, 17658, 17700, 
-        17741, 17782, 17825, 17866, 17908, 17949, 17990, 18032, 18075, 18116, 18157, 18198, 
-        18240, 18283, 18324, 18365, 18407, 18448, 18491, 18532, 18573, 18615, 18656, 18699, 
-        18740, 18781, 18823, 18864, 18907, 18948, 18990, 19031, 19074, 19115, 19156, 19198, 
-        19239, 19282, 19323, 19365, 19406, 19447, 19490, 19531, 19573, 19614, 19655, 19698, 
-        19739, 19781, 19822, 19863, 19906, 19948, 19989, 20030, 20071, 20114, 20156, 20197, 
-        20238, 20280, 20322, 20364, 20405, 20446, 20488, 20531, 20572, 20613, 20654, 20696, 
-        20739, 20780, 20821, 20863, 20904, 20947, 20988, 21029, 21071, 21112, 21155, 21196, 
-        21237, 21279, 21322, 21363, 21404, 21446, 21487, 21530, 21571, 21612, 21654, 21695, 
-        21738, 21779, 21820, 21862, 21903, 21944, 21987, 22029, 22070, 22111, 22152, 22195, 
-        22237, 22278, 22319, 22361, 22403, 22445, 22486, 22527, 22569, 22612, 22653, 22694, 
-        22736, 22777, 22820, 22861, 22902, 22944, 22987, 23028, 23069, 23110, 23152, 23195, 
-        23236, 23277, 23319, 23360, 23403, 23444, 23485, 23527, 23568, 23611, 23652, 23693, 
-        23735, 23776, 23819, 23860, 23902, 23943, 23984, 24027, 24068, 24110, 24151, 3912, 
-        -16326, -16284, -16243, -16202, -16159, -16117, -16076, -16035, -15994, -15951, -15909, -15868, 
-        -15827, -15785, -15743, -15701, -15660, -15619, -15577, -15534, -15493, -15452, -15410, -15369, 
-        -15326, -15285, -15244, -15202, -15161, -15118, -15077, -15036, -14994, -14951, -14910, -14869, 
-        -14827, -14786, -14743, -14702, -14661, -14619, -14578, -14535, -14494, -14453, -14411, -14370, 
-        -14327, -14286, -14244, -14203, -14162, -14119, -14078, -14036, -13995, -13954, -13912, -13870, 
-        -13828, -13787, -13746, -13704, -13661, -13620, -13579, -13538, -13496, -13453, -13412, -13371, 
-        -13329, -13287, -13245, -13204, -13163, -13121, -13078, -13037, -12996, -12955, -12913, -12870, 
-        -12829, -12788, -12746, -12705, -12662, -12621, -12580, -12538, -12497, -12454, -12413, -12371, 
-        -12330, -12289, -12246, -12205, -12163, -12122, -12081, -12038, -11997, -11955, -11914, -11873, 
-        -11830, -11788, -11747, -11706, -11665, -11622, -11580, -11539, -11498, -11456, -11414, -11372, 
-        -11331, -11290, -11248, -11205, -11164, -11123, -11082, -11039, -10997, -10956, -10915, -10873, 
-        -10831, -10789, -10748, -10707, -10665, -10622, -10581, -10540, -10499, -10457, -10414, -10373, 
-        -10332, -10290, -10249, -10206, -10165, -10124, -10082, -10041, -10000, -9957, -9916, -9874, 
-        -9833, -9792, -9749, -9707, -9666, -9625, -9584, -9541, -9499, -9458, -9417, -9374, 
-        -9333, -9291, -9250, -9209, -9166, -9124, -9083, -9042, -9000, -8958, -8916, -8875, 
-        -8834, -8792, -8749, -8708, -8667, -8626, -8584, -8541, -8500, -8459, -8417, -8376, 
-        -8333, -8292, -8251, -8209, -8168, -8125, -8084, -8043, -8001, -7960, -7917, -7876, 
-        -7834, -32767, -32726, -32685, -32642, -32601, -32559, -32518, -32477, -32434, -32393, -32351, 
-        -32310, -32269, -32226, -32184, -32143, -32102, -32061, -32018, -31976, -31935, -31894, -31852, 
-        -31810, -31768, -31727, -31686, -31644, -31601, -31560, -31519, -31478, -31436, -31393, -31352, 
-        -31311, -31269, -31228, -31185, -31144, -31103, -31061, -31020, -30977, -30936, -30895, -30853, 
-        -30812, -30769, -30728, -30686, -30645, -30602, -30561, -30520, -30478, -30437, -30394, -30353, 
-        -30312, -30270, -30229, -30186, -30145, -30103, -30062, -30021, -29978, -29937, -29895, -29854, 
-        -29813, -29771, -29729, -29687, -29646, -29605, -29563, -29520, -29479, -29438, -29396, -29355, 
-        -29312, -29271, -29230, -29188, -29147, -29104, -29063, -29022, -28980, -28937, -28896, -8575 
-    };
-
-    // AKWF_blended_0042 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0042[600] PROGMEM = {
-        19948, 19989, 20030, 20071, 20114, 20156, 20197, 20238, 20280, 20322, 20364, 20405, 
-        20446, 20488, 20531, 20572, 20613, 20654, 20696, 20739, 20780, 20821, 20863, 20904, 
-        20947, 20988, 21029, 21071, 21112, 21155, 21196, 21237, 21279, 21322, 21363, 21404, 
-        21446, 21487, 21530, 21571, 21612, 21654, 21695, 21738, 21779, 21820, 21862, 21903, 
-        21944, 21987, 22029, 22070, 22111, 22152, 22195, 22237, 22278, 22319, 22361, 22403, 
-        22445, 22486, 22527, 22569, 22612, 22653, 22694, 22736, 22777, 22820, 22861, 22902, 
-        22944, 22987, 23028, 23069, 23110, 23152, 23195, 23236, 23277, 23319, 23360, 23403, 
-        23444, 23485, 23527, 23568, 23611, 23652, 23693, 23735, 23776, 23819, 23860, 23902, 
-        23943, 23984, 24027, 24068, 24110, 24151, 24192, 24235, 24276, 24318, 24359, 24400, 
-        24443, 24485, 24526, 24567, 24608, 24651, 24693, 24734, 24775, 24817, 24859, 24901, 
-        24942, 24983, 25025, 25068, 25109, 25150, 25191, 25234, 25276, 25317, 25358, 25400, 
-        25442, 25484, 25525, 25566, 25608, 25651, 25692, 25733, 25774, 25816, 25859, 25900, 
-        25941, 25983, 26024, 26065, 26108, 26149, 26191, 26232, 26273, 26316, 26358, 26399, 
-        26440, 26481, 26524, 26566, 26607, 26648, 26690, 26732, 26774, 26815, 26856, 26899, 
-        26941, 26982, 27023, 27064, 27107, 27149, 27190, 27231, 27273, 27315, 27357, 27398, 
-        27439, 27481, 27524, 27565, 27606, 27647, 27689, 27732, 27773, 27814, 27856, 27897, 
-        27940, 27981, 28022, 28064, 28105, 28148, 28189, 28230, 28272, 28313, 28356, 28397, 
-        28439, 28480, 28521, 28564, 28605, 28647, 28688, 28729, 28772, 28813, 28855, 28896, 
-        28937, 28980, 29022, 29063, 29104, 29147, 29188, 29230, 29271, 29312, 29355, 29396, 
-        29438, 29479, 29520, 29563, 29605, 29646, 29687, 29729, 29771, 29813, 29854, 29895, 
-        29937, 29978, 30021, 30062, 30103, 30145, 30186, 30229, 30270, 30312, 30353, 30394, 
-        30437, 30478, 30520, 30561, 30602, 30645, 30686, 30728, 30769, 30812, 30853, 30895, 
-        30936, 30977, 31020, 31061, 31103, 31144, 31185, 31228, 31269, 31311, 31352, 31393, 
-        31436, 31478, 31519, 31560, 31601, 31644, 31686, 31727, 31768, 31810, 31852, 31894, 
-        31935, 31976, 32018, 32061, 32102, 32143, 32184, 32226, 32269, 32310, 32351, 12113, 
-        -8125, -8084, -8043, -8001, -7960, -7917, -7876, -7834, -32767, -32726, -32685, -32642, 
-        -32601, -32559, -32518, -32477, -32434, -32393, -32351, -32310, -32269, -32226, -32184, -32143, 
-        -32102, -32061, -32018, -31976, -31935, -31894, -31852, -31810, -31768, -31727, -31686, -31644, 
-        -31601, -31560, -31519, -31478, -31436, -31393, -31352, -31311, -31269, -31228, -31185, -31144, 
-        -31103, -31061, -31020, -30977, -30936, -30895, -30853, -30812, -30769, -30728, -30686, -30645, 
-        -30602, -30561, -30520, -30478, -30437, -30394, -30353, -30312, -30270, -30229, -30186, -30145, 
-        -30103, -30062, -30021, -29978, -29937, -29895, -29854, -29813, -29771, -29729, -29687, -29646, 
-        -29605, -29563, -29520, -29479, -29438, -29396, -29355, -29312, -29271, -29230, -29188, -29147, 
-        -29104, -29063, -29022, -28980, -28937, -28896, -28855, -28813, -28772, -28729, -28688, -28647, 
-        -28605, -28564, -28521, -28480, -28439, -28397, -28356, -28313, -28272, -28230, -28189, -28148, 
-        -28105, -28064, -28022, -27981, -27940, -27897, -27856, -27814, -27773, -27732, -27689, -27647, 
-        -27606, -27565, -27524, -27481, -27439, -27398, -27357, -27315, -27273, -27231, -27190, -27149, 
-        -27107, -27064, -27023, -26982, -26941, -26899, -26856, -26815, -26774, -26732, -26690, -26648, 
-        -26607, -26566, -26524, -26481, -26440, -26399, -26358, -26316, -26273, -26232, -26191, -26149, 
-        -26108, -26065, -26024, -25983, -25941, -25900, -25859, -25816, -25774, -25733, -25692, -25651, 
-        -25608, -25566, -25525, -25484, -25442, -25400, -25358, -25317, -25276, -25234, -25191, -25150, 
-        -25109, -25068, -25025, -24983, -24942, -24901, -24859, -24817, -24775, -24734, -24693, -24651, 
-        -24608, -24567, -24526, -24485, -24443, -24400, -24359, -24318, -24276, -24235, -24192, -24151, 
-        -24110, -24068, -24027, -23984, -23943, -23902, -23860, -23819, -23776, -23735, -23693, -23652, 
-        -23611, -23568, -23527, -23485, -23444, -23403, -23360, -23319, -23277, -23236, -23195, -23152, 
-        -23110, -23069, -23028, -22987, -22944, -22902, -22861, -22820, -22777, -22736, -22694, -22653, 
-        -22612, -22569, -22527, -22486, -22445, -22403, -22361, -22319, -22278, -22237, -22195, -22152, 
-        -22111, -22070, -22029, -21987, -21944, -21903, -21862, -21820, -21779, -21738, -21695, -21654, 
-        -21612, -21571, -21530, -21487, -21446, -21404, -21363, -21322, -21279, -21237, -21196, -21155, 
-        -21112, -21071, -21029, -20988, -20947, -20904, -20863, -20821, -20780, -20739, -20696, -374 
-    };
-
-    // AKWF_blended_0044 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0044[600] PROGMEM = {
-        9000, 9042, 9083, 9124, 9166, 9209, 9250, 9291, 9333, 9374, 9417, 9458, 
-        9499, 9541, 9584, 9625, 9666, 9707, 9749, 9792, 9833, 9874, 9916, 9957, 
-        10000, 10041, 10082, 10124, 10165, 10206, 10249, 10290, 10332, 10373, 10414, 10457, 
-        10499, 10540, 10581, 10622, 10665, 10707, 10748, 10789, 10831, 10873, 10915, 10956, 
-        10997, 11039, 11082, 11123, 11164, 11205, 11248, 11290, 11331, 11372, 11414, 11456, 
-        11498, 11539, 11580, 11622, 11665, 11706, 11747, 11788, 11830, 11873, 11914, 11955, 
-        11997, 12038, 12081, 12122, 12163, 12205, 12246, 12289, 12330, 12371, 12413, 12454, 
-        12497, 12538, 12580, 12621, 12662, 12705, 12746, 12788, 12829, 12870, 12913, 12955, 
-        12996, 13037, 13078, 13121, 13163, 13204, 13245, 13287, 13329, 13371, 13412, 13453, 
-        13496, 13538, 13579, 13620, 13661, 13704, 13746, 13787, 13828, 13870, 13912, 13954, 
-        13995, 14036, 14078, 14119, 14162, 14203, 14244, 14286, 14327, 14370, 14411, 14453, 
-        14494, 14535, 14578, 14619, 14661, 14702, 14743, 14786, 14827, 14869, 14910, 14951, 
-        14994, 15036, 15077, 15118, 15161, 15202, 15244, 15285, 15326, 15369, 15410, 15452, 
-        15493, 15534, 15577, 15619, 15660, 15701, 15743, 15785, 15827, 15868, 15909, 15951, 
-        15994, 16035, 16076, 16117, 16159, 16202, 16243, 16284, 16326, 16367, 16410, 16451, 
-        16492, 16534, 16575, 16618, 16659, 16700, 16742, 16783, 16826, 16867, 16909, 16950, 
-        16991, 17034, 17075, 17117, 17158, 17199, 17242, 17283, 17325, 17366, 17409, 17450, 
-        17492, 17533, 17574, 17617, 17658, 17700, 17741, 17782, 17825, 17866, 17908, 17949, 
-        17990, 18032, 18075, 18116, 18157, 18198, 18240, 18283, 18324, 18365, 18407, 18448, 
-        18491, 18532, 18573, 18615, 18656, 18699, 18740, 18781, 18823, 18864, 18907, 18948, 
-        18990, 19031, 19074, 19115, 19156, 19198, 19239, 19282, 19323, 19365, 19406, 19447, 
-        19490, 19531, 19573, 19614, 19655, 19698, 19739, 19781, 19822, 19863, 19906, 19948, 
-        19989, 20030, 20071, 20114, 20156, 20197, 20238, 20280, 20322, 20364, 20405, 20446, 
-        20488, 20531, 20572, 20613, 20654, 20696, 20739, 20780, 20821, 20863, 20904, 20947, 
-        20988, 21029, 21071, 21112, 21155, 21196, 21237, 21279, 21322, 21363, 21404, 1166, 
-        -19074, -19031, -18990, -18948, -18907, -18864, -18823, -18781, -18740, -18699, -18656, -18615, 
-        -18573, -18532, -18491, -18448, -18407, -18365, -18324, -18283, -18240, -18198, -18157, -18116, 
-        -18075, -18032, -17990, -17949, -17908, -17866, -17825, -17782, -17741, -17700, -17658, -17617, 
-        -17574, -17533, -17492, -17450, -17409, -17366, -17325, -17283, -17242, -17199, -17158, -17117, 
-        -17075, -17034, -16991, -16950, -16909, -16867, -16826, -16783, -16742, -16700, -16659, -16618, 
-        -16575, -16534, -16492, -16451, -16410, -16367, -16326, -16284, -16243, -16202, -16159, -16117, 
-        -16076, -16035, -15994, -15951, -15909, -15868, -15827, -15785, -15743, -15701, -15660, -15619, 
-        -15577, -15534, -15493, -15452, -15410, -15369, -15326, -15285, -15244, -15202, -15161, -15118, 
-        -15077, -15036, -14994, -14951, -14910, -14869, -14827, -14786, -14743, -14702, -14661, -14619, 
-        -14578, -14535, -14494, -14453, -14411, -14370, -14327, -14286, -14244, -14203, -14162, -14119, 
-        -14078, -14036, -13995, -13954, -13912, -13870, -13828, -13787, -13746, -13704, -13661, -13620, 
-        -13579, -13538, -13496, -13453, -13412, -13371, -13329, -13287, -13245, -13204, -13163, -13121, 
-        -13078, -13037, -12996, -12955, -12913, -12870, -12829, -12788, -12746, -12705, -12662, -12621, 
-        -12580, -12538, -12497, -12454, -12413, -12371, -12330, -12289, -12246, -12205, -12163, -12122, 
-        -12081, -12038, -11997, -11955, -11914, -11873, -11830, -11788, -11747, -11706, -11665, -11622, 
-        -11580, -11539, -11498, -11456, -11414, -11372, -11331, -11290, -11248, -11205, -11164, -11123, 
-        -11082, -11039, -10997, -10956, -10915, -10873, -10831, -10789, -10748, -10707, -10665, -10622, 
-        -10581, -10540, -10499, -10457, -10414, -10373, -10332, -10290, -10249, -10206, -10165, -10124, 
-        -10082, -10041, -10000, -9957, -9916, -9874, -9833, -9792, -9749, -9707, -9666, -9625, 
-        -9584, -9541, -9499, -9458, -9417, -9374, -9333, -9291, -9250, -9209, -9166, -9124, 
-        -9083, -9042, -9000, -8958, -8916, -8875, -8834, -8792, -8749, -8708, -8667, -8626, 
-        -8584, -8541, -8500, -8459, -8417, -8376, -8333, -8292, -8251, -8209, -8168, -8125, 
-        -8084, -8043, -8001, -7960, -7917, -7876, -7834, -32767, -32726, -32685, -32642, -32601, 
-        -32559, -32518, -32477, -32434, -32393, -32351, -32310, -32269, -32226, -32184, -32143, -32102, 
-        -32061, -32018, -31976, -31935, -31894, -31852, -31810, -31768, -31727, -31686, -31644, -11321 
-    };
-
-    // AKWF_blended_0045 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0045[600] PROGMEM = {
-        12487, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        20280, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        -12487, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -20280, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793 
-    };
-
-    // AKWF_blended_0046 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0046[600] PROGMEM = {
-        12487, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 20280, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        -12487, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -20280, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793 
-    };
-
-    // AKWF_blended_0047 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0047[600] PROGMEM = {
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 20280, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 12487, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -20280, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -12487 
-    };
-
-    // AKWF_blended_0048 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0048[600] PROGMEM = {
-        12487, 32767, 32767, 32767, 32767, 20280, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        -12487, -32767, -32767, -32767, -32767, -20280, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793 
-    };
-
-    // AKWF_blended_0049 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0049[600] PROGMEM = {
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 7793, 
-        20280, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 12487, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, -7793, 
-        -20280, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -12487 
-    };
-
-    // AKWF_blended_0050 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0050[600] PROGMEM = {
-        37, 154, 272, 389, 504, 622, 739, 856, 972, 1089, 1207, 1324, 
-        1441, 1557, 1674, 1791, 1909, 2024, 2142, 2259, 2376, 2492, 2609, 2726, 
-        2844, 2959, 3077, 3194, 3311, 3428, 3544, 3661, 3777, 3896, 4012, 4129, 
-        4246, 4363, 4479, 4596, 4714, 4829, 4947, 5064, 5181, 5297, 5416, 5531, 
-        5649, 5764, 5882, 5999, 6116, 6233, 6349, 6466, 6584, 6701, 6817, 6934, 
-        7051, 7169, 7284, 7401, 7519, 7636, 7752, 7869, 7986, 8104, 8221, 8336, 
-        8454, 8571, 8688, 8804, 8921, 9037, 9156, 9271, 9389, 9506, 9623, 9739, 
-        9856, 9974, 10091, 10208, 10324, 10441, 10557, 10676, 10791, 10909, 11024, 11141, 
-        11259, 11376, 11493, 11609, 11726, 11844, 11961, 12076, 12194, 12311, 12428, 12544, 
-        12661, 12779, 12896, 13012, 13129, 13246, 13363, 13481, 13596, 13714, 13831, 13948, 
-        14064, 14181, 14298, 14416, 14531, 14649, 14766, 14883, 14999, 15116, 15233, 15351, 
-        15468, 15584, 15701, 15817, 15936, 16051, 16168, 16284, 16403, 16519, 16636, 16753, 
-        16869, 16986, 17103, 17221, 17336, 17455, 17571, 17688, 17804, 17921, 18038, 18156, 
-        18271, 18389, 18506, 18623, 18741, 18856, 18973, 19091, 19208, 19324, 19441, 19558, 
-        19676, 19791, 19909, 20026, 20143, 20259, 20376, 20493, 20611, 20728, 20844, 20961, 
-        21076, 21195, 21311, 21428, 21544, 21663, 21779, 21896, 22013, 22129, 22246, 22363, 
-        22481, 22596, 22715, 22831, 22948, 23064, 23181, 23298, 23416, 23531, 23649, 23766, 
-        23883, 24000, 24116, 24233, 24351, 24468, 24584, 24701, 24818, 24935, 25051, 25168, 
-        25286, 25403, 25519, 25636, 25753, 25870, 25988, 26103, 26221, 26338, 26455, 26571, 
-        26688, 26806, 26923, 27038, 27156, 27273, 27390, 27506, 27623, 27741, 27856, 27975, 
-        28091, 28208, 28324, 28443, 28558, 28676, 28793, 28908, 29026, 29143, 29260, 29376, 
-        29493, 29611, 29728, 29843, 29961, 30078, 30195, 30311, 30428, 30546, 30663, 30780, 
-        30896, 31013, 31130, 31248, 31363, 31481, 31598, 31715, 31831, 31948, 32065, 32183, 
-        32298, 32416, 32533, 32650, 32767, -10523, -10405, -10288, -10171, -10055, -9938, -9821, 
-        -9703, -9586, -9470, -9353, -9236, -9118, -9003, -8886, -8770, -8651, -8535, -8418, 
-        -8301, -8185, -8068, -7951, -7833, -7718, -7599, -7483, -7366, -7250, -7133, -7016, 
-        -6898, -6783, -6665, -6548, -6431, -6313, -6198, -6080, -5963, -5846, -5730, -5613, 
-        -5496, -5378, -5263, -5145, -5028, -4911, -31521, -31404, -31288, -31169, -31054, -30937, 
-        -30821, -30702, -30586, -30469, -30352, -30236, -30119, -30002, -29884, -29769, -29650, -29534, 
-        -29417, -29301, -29184, -29067, -28949, -28834, -28716, -28599, -28482, -28364, -28249, -28132, 
-        -28014, -27897, -27781, -27664, -27547, -27429, -27314, -27197, -27079, -26962, -26846, -26729, 
-        -26612, -26494, -26377, -26262, -26144, -26029, -25910, -25794, -25677, -25559, -25442, -25326, 
-        -25209, -25092, -24976, -24859, -24742, -24624, -24509, -24390, -24274, -24157, -24041, -23924, 
-        -23807, -23689, -23572, -23456, -23339, -23222, -23105, -22989, -22872, -22754, -22637, -22521, 
-        -22404, -22287, -22170, -22054, -21937, -21819, -21702, -21585, -21469, -21352, -21235, -21117, 
-        -21002, -20884, -20767, -20650, -20534, -20417, -20300, -20182, -20067, -19949, -19832, -19715, 
-        -19599, -19482, -19364, -19249, -19130, -19014, -18897, -18781, -18662, -18547, -18429, -18312, 
-        -18197, -18079, -17962, -17845, -17729, -17612, -17494, -17377, -17262, -17144, -17027, -16910, 
-        -16794, -16677, -16559, -16442, -16325, -16209, -16092, -15975, -15857, -15742, -15624, -15507, 
-        -15390, -15274, -15157, -15040, -14922, -14807, -14689, -14572, -14455, -14338, -14222, -14105, 
-        -13987, -13870, -13754, -13637, -13522, -13403, -13287, -13170, -13052, -12937, -12819, -12702, 
-        -12585, -12469, -12350, -12235, -12117, -12002, -11884, -11767, -11650, -11534, -11417, -11300, 
-        -11182, -11065, -10949, -10832, -10715, -10597, -10482, -10365, -10247, -10130, -10014, -9897, 
-        -9780, -9662, -9547, -9430, -9312, -9195, -9078, -8962, -8845, -8727, -8610, -8495, 
-        -8377, -8262, -8143, -8027, -7910, -7792, -7675, -7560, -7442, -7325, -7209, -7090, 
-        -6975, -6857, -6742, -6623, -6507, -6390, -6274, -6157, -6040, -5922, -5805, -5689, 
-        -5572, -5455, -5338, -5222, -5105, -4987, -4870, -4754, -4637, -4520, -4403, -4287, 
-        -4170, -4052, -3935, -3818, -3702, -3585, -3468, -3350, -3235, -3117, -3000, -2883, 
-        -2767, -2650, -2533, -2415, -2300, -2182, -2065, -1948, -1830, -1715, -1598, -1482, 
-        -1363, -1247, -1130, -1013, -897, -780, -663, -545, -430, -312, -195, -78 
-    };
-
-    // AKWF_blended_0051 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0051[600] PROGMEM = {
-        78, 218, 360, 502, 644, 784, 926, 1068, 1210, 1350, 1492, 1634, 
-        1776, 1918, 2058, 2200, 2342, 2482, 2624, 2766, 2908, 3050, 3190, 3332, 
-        3474, 3616, 3756, 3898, 4040, 4182, 4322, 4464, 4606, 4748, 4888, 5030, 
-        5172, 5314, 5456, 5596, 5738, 5880, 6022, 6162, 6304, 6446, 6586, 6728, 
-        6870, 7012, 7152, 7294, 7436, 7578, 7720, 7860, 8002, 8144, 8286, 8426, 
-        8568, 8710, 8852, 8992, 9134, 9276, 9418, 9558, 9700, 9842, 9984, 10126, 
-        10266, 10408, 10550, 10690, 10832, 10974, 11116, 11256, 11398, 11540, 11682, 11824, 
-        11964, 12106, 12248, 12390, 12530, 12672, 12814, 12956, 13096, 13238, 13380, 13520, 
-        13662, 13804, 13946, 14088, 14230, 14370, 14512, 14654, 14794, 14936, 15078, 15220, 
-        15360, 15502, 15644, 15786, 15926, 16068, 16210, 16352, 16494, 16634, 16776, 16918, 
-        17058, 17200, 17342, 17484, 17624, 17766, 17908, 18050, 18192, 18332, 18474, 18616, 
-        18758, 18898, 19040, 19182, 19324, 19464, 19606, 19748, 19888, 20030, 20172, 20314, 
-        20456, 20598, 20738, 20880, 21022, 21162, 21304, 21446, 21588, 21728, 21870, 22012, 
-        22154, 22294, 22436, 22578, 22720, 22862, 23002, 23144, 23286, 23428, 23568, 23710, 
-        23852, 23994, 24134, 24276, 24418, 24560, 24700, 24842, 24984, 25126, 25266, 25408, 
-        25550, 25692, 25831, 25974, 26116, 26258, 26400, 26540, 26682, 26824, 26966, 27105, 
-        27248, 27390, 27532, 27671, 27814, 27956, 28095, 28237, 28380, 28522, 28661, 28806, 
-        28945, 29088, 29230, 29369, 29511, 29654, 29796, 29935, 30077, 30219, 30362, 30501, 
-        30643, 30785, 30928, 31067, 31209, 31351, 31494, 31633, 31775, 31917, 32059, 32199, 
-        32341, 32483, 32625, 32767, -19643, -19501, -19359, -19217, -19077, -18935, -18793, -18651, 
-        -18509, -18369, -18227, -18085, -17943, -17803, -17661, -17519, -17377, -17237, -17095, -16953, 
-        -16813, -16671, -16529, -16387, -16245, -16103, -15963, -15821, -15679, -15539, -15397, -15255, 
-        -15113, -14973, -14831, -14689, -14547, -14407, -14265, -14123, -13981, -13839, -13699, -13557, 
-        -13415, -13273, -13133, -12991, -12849, -12709, -12567, -12425, -12283, -12141, -12001, -11859, 
-        -11717, -11575, -11435, -11293, -11151, -11009, -10869, -10727, -10585, -10443, -10303, -10161, 
-        -10019, -9877, -9735, -9595, -9453, -9311, -9169, -9029, -8887, -8745, -8605, -8463, 
-        -8321, -8179, -8039, -7897, -7755, -7613, -7471, -7331, -7189, -7047, -6905, -6765, 
-        -6623, -6481, -6341, -6199, -6057, -5915, -5773, -5633, -5491, -5349, -5207, -5067, 
-        -4925, -4783, -4641, -4501, -4359, -4217, -4075, -3935, -3793, -3651, -3509, -3367, 
-        -3227, -3085, -2943, -2801, -2661, -2519, -2377, -2237, -2095, -1953, -1811, -1671, 
-        -1529, -1387, -1245, -1103, -963, -821, -679, -537, -397, -255, -113, 28, 
-        168, 310, 452, 594, 734, 876, 1018, 1160, 1302, 1442, 1584, 1726, 
-        1866, 2008, 2150, 2292, 2434, 2574, 2716, 2858, 3000, 3140, 3282, 3424, 
-        3566, 3706, 3848, 3990, 4132, 4272, 4414, 4556, 4696, 4840, 4980, 5122, 
-        5264, -26951, -26809, -26667, -26527, -26385, -26243, -26101, -25959, -25819, -25677, -25535, 
-        -25395, -25253, -25111, -24969, -24829, -24687, -24545, -24403, -24261, -24121, -23979, -23837, 
-        -23695, -23555, -23413, -23271, -23129, -22989, -22847, -22705, -22565, -22423, -22281, -22139, 
-        -21997, -21855, -21715, -21573, -21431, -21291, -21149, -21007, -20865, -20725, -20583, -20441, 
-        -20299, -20159, -20017, -19875, -19733, -19591, -19451, -19309, -19167, -19025, -18885, -18743, 
-        -18601, -18461, -18319, -18177, -18035, -17893, -17753, -17611, -17469, -17327, -17187, -17045, 
-        -16903, -16761, -16621, -16479, -16337, -16195, -16055, -15913, -15771, -15629, -15487, -15347, 
-        -15205, -15063, -14921, -14781, -14639, -14497, -14357, -14215, -14073, -13931, -13791, -13649, 
-        -13507, -13365, -13223, -13083, -12941, -12799, -12657, -12517, -12375, -12233, -12091, -11951, 
-        -11809, -11667, -11525, -11385, -11243, -11101, -10959, -10819, -10677, -10535, -10393, -10253, 
-        -10111, -9969, -9827, -9687, -9545, -9403, -9261, -9119, -8979, -8837, -8695, -8553, 
-        -8413, -8271, -8129, -7989, -7847, -7705, -7563, -7423, -7281, -7139, -6997, -6855, 
-        -6715, -6573, -6431, -6289, -6149, -6007, -5865, -5723, -5583, -5441, -5299, -5157, 
-        -5017, -4875, -4733, -4591, -4449, -4309, -4167, -4025, -3885, -3743, -3601, -3459, 
-        -3317, -3177, -3035, -2893, -2751, -2611, -2469, -2327, -2185, -2045, -1903, -1761, 
-        -1619, -1479, -1337, -1195, -1053, -911, -771, -629, -487, -345, -205, -63 
-    };
-
-    // AKWF_blended_0052 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0052[600] PROGMEM = {
-        25, 184, 340, 499, 657, 816, 973, 1131, 1290, 1449, 1608, 1764, 
-        1923, 2081, 2240, 2397, 2555, 2714, 2873, 3029, 3188, 3347, 3503, 3662, 
-        3821, 3979, 4138, 4297, 4453, 4612, 4768, 4927, 5086, 5245, 5403, 5560, 
-        5718, 5877, 6036, 6192, 6351, 6510, 6669, 6825, 6984, 7142, 7301, 7458, 
-        7616, 7775, 7934, 8093, 8249, 8408, 8566, 8725, 8882, 9040, 9199, 9358, 
-        9514, 9673, 9832, 9990, 10147, 10306, 10464, 10623, 10780, 10938, 11097, 11256, 
-        11414, 11571, 11730, 11886, 12047, 12204, 12362, 12521, 12677, 12836, 12995, 13154, 
-        13310, 13469, 13628, 13786, 13943, 14101, 14260, 14419, 14575, 14734, 14893, 15052, 
-        15210, 15367, 15525, 15684, 15843, 15999, 16158, 16317, 16476, 16632, 16791, 16949, 
-        17108, 17265, 17423, 17582, 17741, 17900, 18056, 18215, 18373, 18532, 18689, 18847, 
-        19006, 19165, 19321, 19480, 19639, 19795, 19954, 20113, 20271, 20430, 20589, 20745, 
-        20904, 21060, 21219, 21378, 21537, 21693, 21852, 22010, 22169, 22328, 22484, 22643, 
-        22802, 22961, 23117, 23276, 23434, 23593, 23750, 23908, 24067, 24226, 24382, 24541, 
-        24700, 24858, 25017, 25174, 25332, 25491, 25650, 25806, 25965, 26124, 26282, 26439, 
-        26598, 26756, 26915, 27072, 27230, 27389, 27548, 27706, 27863, 28022, 28178, 28339, 
-        28496, 28654, 28811, 28969, 29128, 29287, 29446, 29602, 29761, 29920, 30078, 30235, 
-        30393, 30552, 30711, 30867, 31026, 31185, 31344, 31500, 31659, 31817, 31976, 32135, 
-        32291, 32450, 32609, 32767, -25813, -25654, -25496, -25337, -25178, -25022, -24863, -24704, 
-        -24546, -24389, -24230, -24072, -23913, -23757, -23598, -23439, -23280, -23124, -22965, -22806, 
-        -22648, -22489, -22333, -22174, -22015, -21856, -21700, -21541, -21382, -21226, -21067, -20909, 
-        -20750, -20593, -20435, -20276, -20117, -19961, -19802, -19643, -19485, -19328, -19169, -19011, 
-        -18852, -18693, -18537, -18378, -18219, -18061, -17904, -17745, -17587, -17428, -17271, -17113, 
-        -16954, -16795, -16639, -16480, -16321, -16163, -16004, -15847, -15689, -15530, -15371, -15215, 
-        -15056, -14897, -14739, -14582, -14423, -14265, -14106, -13950, -13791, -13632, -13476, -13317, 
-        -13158, -13000, -12843, -12682, -12526, -12367, -12210, -12052, -11893, -11734, -11576, -11419, 
-        -11260, -11102, -10943, -10786, -10628, -10469, -10310, -10154, -9995, -9836, -9678, -9521, 
-        -9362, -9204, -9045, -8886, -8730, -8571, -8412, -8254, -8097, -7938, -7780, -7621, 
-        -7465, -7306, -7147, -6988, -6832, -6673, -6514, -6356, -6197, -6041, -5882, -5723, 
-        -5564, -5408, -5249, -5093, -4934, -4775, -4617, -4458, -4301, -4143, -3984, -3825, 
-        -3669, -3510, -3351, -3193, -3036, -2877, -2719, -2560, -2404, -2245, -2086, -1927, 
-        -1769, -1612, -1453, -1295, -1136, -980, -821, -662, -503, -347, -188, -29, 
-        128, 285, 443, 602, 761, 920, 1076, 1235, 1394, 1552, 1709, 1867, 
-        2024, 2185, 2341, 2500, 2659, 2815, 2974, 3133, 3291, 3448, 3609, 3765, 
-        3924, 4081, 4239, 4398, 4557, 4713, 4872, 5031, 5189, 5348, 5505, 5663, 
-        5822, 5981, 6137, 6296, 6455, 6613, 6770, 6929, 7087, 7246, 7402, 7561, 
-        7720, 7879, 8037, 8194, 8353, 8511, 8670, 8826, 8985, 9144, 9303, 9459, 
-        9618, 9777, 9933, 10092, 10250, 10409, 10568, 10727, 10883, 11042, 11198, 11357, 
-        11516, 11674, 11833, 11990, 12148, -23858, -23701, -23543, -23384, -23225, -23069, -22910, 
-        -22751, -22592, -22434, -22277, -22119, -21960, -21801, -21645, -21486, -21327, -21168, -21012, 
-        -20853, -20695, -20536, -20379, -20221, -20062, -19906, -19745, -19588, -19429, -19273, -19112, 
-        -18955, -18797, -18640, -18482, -18323, -18164, -18005, -17849, -17690, -17531, -17373, -17216, 
-        -17058, -16899, -16740, -16584, -16425, -16266, -16107, -15951, -15792, -15634, -15475, -15316, 
-        -15160, -15001, -14842, -14683, -14527, -14368, -14210, -14051, -13894, -13736, -13577, -13418, 
-        -13262, -13103, -12944, -12786, -12627, -12470, -12312, -12153, -11994, -11838, -11679, -11523, 
-        -11364, -11205, -11046, -10888, -10731, -10572, -10414, -10255, -10099, -9940, -9781, -9622, 
-        -9466, -9307, -9149, -8990, -8833, -8675, -8516, -8357, -8198, -8042, -7883, -7725, 
-        -7566, -7409, -7251, -7092, -6933, -6777, -6618, -6459, -6301, -6144, -5985, -5827, 
-        -5668, -5509, -5353, -5194, -5035, -4877, -4720, -4561, -4405, -4244, -4087, -3929, 
-        -3770, -3614, -3455, -3296, -3137, -2981, -2820, -2663, -2505, -2348, -2190, -2031, 
-        -1872, -1716, -1557, -1398, -1239, -1081, -924, -766, -607, -448, -292, -133 
-    };
-
-    // AKWF_blended_0053 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0053[600] PROGMEM = {
-        134, 307, 482, 658, 833, 1008, 1181, 1356, 1532, 1707, 1880, 2055, 
-        2230, 2406, 2578, 2754, 2929, 3104, 3277, 3452, 3628, 3803, 3978, 4151, 
-        4326, 4502, 4677, 4850, 5025, 5200, 5376, 5548, 5724, 5899, 6074, 6247, 
-        6423, 6598, 6773, 6948, 7121, 7297, 7472, 7647, 7820, 7995, 8168, 8346, 
-        8519, 8694, 8869, 9045, 9217, 9393, 9568, 9741, 9919, 10091, 10267, 10439, 
-        10615, 10790, 10965, 11138, 11313, 11489, 11664, 11839, 12012, 12187, 12363, 12538, 
-        12711, 12886, 13061, 13237, 13410, 13585, 13760, 13935, 14108, 14284, 14459, 14634, 
-        14810, 14982, 15158, 15333, 15508, 15681, 15856, 16032, 16207, 16380, 16555, 16730, 
-        16906, 17078, 17254, 17429, 17602, 17780, 17952, 18128, 18300, 18476, 18651, 18826, 
-        18999, 19175, 19350, 19525, 19700, 19873, 20049, 20224, 20399, 20572, 20747, 20923, 
-        21098, 21271, 21446, 21621, 21797, 21969, 22145, 22320, 22495, 22671, 22843, 23019, 
-        23194, 23369, 23542, 23717, 23893, 24068, 24241, 24416, 24591, 24767, 24939, 25115, 
-        25290, 25465, 25641, 25813, 25989, 26162, 26339, 26512, 26687, 26863, 27038, 27211, 
-        27386, 27562, 27734, 27910, 28085, 28260, 28433, 28608, 28784, 28959, 29132, 29307, 
-        29482, 29658, 29833, 30006, 30181, 30356, 30532, 30704, 30880, 31055, 31230, 31403, 
-        31578, 31754, 31929, -32767, -32595, -32419, -32244, -32069, -31896, -31721, -31545, -31370, 
-        -31197, -31022, -30847, -30671, -30496, -30323, -30148, -29973, -29797, -29625, -29449, -29277, 
-        -29099, -28926, -28751, -28575, -28400, -28227, -28052, -27877, -27704, -27526, -27353, -27178, 
-        -27005, -26830, -26654, -26479, -26306, -26131, -25956, -25780, -25605, -25432, -25257, -25082, 
-        -24906, -24734, -24558, -24383, -24208, -24035, -23860, -23684, -23509, -23336, -23161, -22986, 
-        -22810, -22635, -22462, -22287, -22112, -21936, -21764, -21588, -21413, -21238, -21065, -20890, 
-        -20714, -20539, -20366, -20191, -20015, -19840, -19665, -19492, -19317, -19144, -18966, -18793, 
-        -18618, -18445, -18270, -18095, -17919, -17744, -17571, -17396, -17221, -17045, -16873, -16697, 
-        -16522, -16347, -16174, -15999, -15823, -15648, -15475, -15300, -15125, -14949, -14774, -14601, 
-        -14426, -14251, -14075, -13902, -13727, -13552, -13377, -13204, -13028, -12853, -12678, -12505, 
-        -12330, -12154, -11979, -11804, -11631, -11456, -11283, -11105, -10932, -10757, -10582, -10406, 
-        -10234, -10058, -9883, -9710, -9535, -9360, -9184, -9012, -8836, -8661, -8486, -8313, 
-        -8138, -7962, -7787, -7614, -7439, -7263, -7088, -6913, -6740, -6565, -6389, -6214, 
-        -6041, -5866, -5691, -5515, -5343, -5167, -4992, -4817, -4644, -4469, -4293, -4118, 
-        -3943, -3770, -3595, -3419, -3244, -3071, -2896, -2721, -2545, -2373, -2197, -2022, 
-        -1847, -1674, -1499, -1323, -1150, -973, -800, -625, -452, -276, -101, 73, 
-        248, 421, 597, 772, 947, 1120, 1295, 1471, 1646, 1819, 1994, 2169, 
-        2345, 2517, 2693, 2868, 3043, 3219, 3391, 3567, 3742, 3917, 4090, 4265, 
-        4441, 4616, 4789, 4964, 5139, 5315, 5488, 5663, 5838, 6013, 6189, 6362, 
-        6537, 6710, 6887, 7060, 7236, 7408, 7584, 7759, 7934, 8110, 8282, 8458, 
-        8633, 8808, 8981, 9156, 9332, 9507, 9680, 9855, 10030, 10206, 10378, 10554, 
-        10729, 10904, 11080, 11252, 11428, 11603, 11778, 11951, 12126, 12302, 12477, 12650, 
-        12825, 13000, 13176, 13349, 13524, 13699, 13875, 14050, 14223, 14398, 14573, 14749, 
-        14921, 15097, 15269, 15447, 15620, 15795, 15971, 16146, 16319, 16494, 16669, 16842, 
-        17020, 17193, 17368, 17541, 17716, 17891, 18067, 18240, 18415, 18590, 18765, 18941, 
-        19114, 19289, 19464, 19639, 19812, 19988, 20163, 20338, -19431, -19256, -19081, -18905, 
-        -18732, -18557, -18384, -18206, -18034, -17858, -17683, -17508, -17335, -17160, -16984, -16812, 
-        -16636, -16461, -16286, -16113, -15938, -15762, -15587, -15414, -15239, -15064, -14888, -14713, 
-        -14540, -14365, -14190, -14014, -13841, -13666, -13491, -13316, -13143, -12967, -12792, -12617, 
-        -12444, -12269, -12093, -11918, -11745, -11570, -11395, -11219, -11044, -10871, -10696, -10521, 
-        -10345, -10173, -9997, -9822, -9647, -9474, -9299, -9123, -8948, -8775, -8600, -8425, 
-        -8252, -8074, -7901, -7726, -7553, -7378, -7203, -7027, -6852, -6679, -6504, -6329, 
-        -6153, -5980, -5805, -5630, -5454, -5282, -5106, -4931, -4756, -4583, -4408, -4232, 
-        -4057, -3882, -3709, -3534, -3358, -3183, -3010, -2835, -2660, -2484, -2312, -2136, 
-        -1961, -1786, -1613, -1438, -1262, -1087, -912, -739, -564, -391, -213, -40 
-    };
-
-    // AKWF_blended_0054 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0054[600] PROGMEM = {
-        28, 143, 257, 373, 488, 604, 717, 833, 948, 1064, 1178, 1293, 
-        1409, 1524, 1638, 1753, 1869, 1983, 2100, 2214, 2329, 2443, 2558, 2674, 
-        2789, 2905, 3019, 3134, 3250, 3365, 3479, 3594, 3710, 3825, 3939, 4055, 
-        4170, 4286, 4399, 4515, 4630, 4746, 4861, 4975, 5091, 5206, 5322, 5435, 
-        5551, 5666, 5782, 5896, 6011, 6127, 6242, 6356, 6471, 6587, 6702, 6818, 
-        6932, 7047, 7161, 7278, 7392, 7507, 7621, 7738, 7852, 7968, 8083, 8199, 
-        8312, 8428, 8543, 8657, 8774, 8888, 9004, 9117, 9233, 9348, 9464, 9578, 
-        9693, 9809, 9924, 10040, 10153, 10269, 10384, 10500, 10614, 10729, 10845, 10960, 
-        11074, 11189, 11305, 11420, 11534, 11650, 11765, 11881, 11996, 12110, 12225, 12341, 
-        12456, 12570, 12686, 12799, 12917, 13030, 13146, 13261, 13377, 13491, 13606, 13722, 
-        13835, 13953, 14066, 14182, 14296, 14411, 14527, 14642, 14756, 14871, 14987, 15102, 
-        15218, 15332, 15447, 15563, 15678, 15792, 15907, 16023, 16138, 16252, 16368, 16483, 
-        16599, 16712, 16828, 16943, 17059, 17174, 17288, 17404, 17519, 17635, 17748, 17864, 
-        17979, 18095, 18209, 18324, 18440, 18555, 18669, 18784, 18900, 19014, 19131, 19245, 
-        19360, 19474, 19591, 19705, 19820, 19934, 20050, 20165, 20281, 20396, 20510, 20625, 
-        20741, 20856, 20970, 21086, 21201, 21317, 21430, 21546, 21661, 21777, 21891, 22006, 
-        22122, 22237, 22353, 22466, 22582, 22697, 22813, 22927, 23042, 23158, 23273, 23387, 
-        23502, 23618, 23733, 23847, 23963, 24078, 24193, 24309, 24423, 24538, 24652, 24769, 
-        24883, 24999, 25114, 25229, 25343, 25459, 25574, 25688, 25804, 25919, 26034, 26148, 
-        26265, 26379, 26495, 26609, 26724, 26840, 26955, 27070, 27184, 27300, 27415, 27531, 
-        27645, 27760, 27875, 27991, 28105, 28220, 28336, 28451, 28565, 28680, 28796, 28911, 
-        29027, 29141, 29256, 29372, 29487, 29601, 29716, 29830, 29947, 30061, 30177, 30292, 
-        30408, 30521, 30637, 30752, 30868, 30982, 31097, 31213, 31327, 31444, 31557, 5362, 
-        5476, 5591, 5707, 5822, 5936, 6051, 6167, 6282, 6396, 6512, 6627, 6743, 
-        6856, 6972, 7087, 7203, 7318, 7432, 7548, 7663, 7779, 7892, 8008, 8122, 
-        8239, 8353, 8468, 8584, 8699, 8813, 8928, 9044, 9158, 9275, 9389, 9504, 
-        9618, 9733, 9849, -32767, -32652, -32538, -32421, -32307, -32192, -32078, -31962, -31847, 
-        -31732, -31618, -31502, -31387, -31271, -31156, -31042, -30927, -30811, -30696, -30582, -30466, 
-        -30351, -30235, -30121, -30006, -29891, -29775, -29661, -29546, -29430, -29315, -29199, -29086, 
-        -28970, -28855, -28739, -28625, -28510, -28394, -28279, -28165, -28050, -27934, -27819, -27705, 
-        -27589, -27474, -27360, -27243, -27129, -27014, -26900, -26783, -26669, -26553, -26438, -26322, 
-        -26209, -26093, -25978, -25864, -25748, -25633, -25517, -25404, -25288, -25173, -25057, -24943, 
-        -24828, -24712, -24597, -24481, -24368, -24252, -24137, -24021, -23907, -23792, -23676, -23561, 
-        -23447, -23332, -23216, -23101, -22987, -22871, -22756, -22640, -22527, -22411, -22296, -22180, 
-        -22065, -21951, -21835, -21722, -21604, -21491, -21375, -21260, -21144, -21030, -20915, -20799, 
-        -20686, -20570, -20455, -20339, -20225, -20108, -19994, -19879, -19765, -19650, -19534, -19419, 
-        -19303, -19189, -19074, -18958, -18843, -18729, -18614, -18498, -18383, -18269, -18153, -18038, 
-        -17922, -17809, -17693, -17578, -17462, -17347, -17233, -17117, -17002, -16886, -16773, -16657, 
-        -16543, -16426, -16312, -16197, -16081, -15966, -15852, -15737, -15621, -15506, -15390, -15276, 
-        -15161, -15047, -14930, -14816, -14701, -14587, -14471, -14356, -14240, -14125, -14011, -13896, 
-        -13780, -13665, -13551, -13435, -13320, -13204, -13091, -12975, -12860, -12744, -12630, -12515, 
-        -12399, -12284, -12168, -12055, -11939, -11824, -11708, -11594, -11479, -11363, -11248, -11134, 
-        -11019, -10903, -10788, -10674, -10558, -10443, -10327, -10212, -10098, -9983, -9869, -9752, 
-        -9638, -9522, -9409, -9293, -9178, -9062, -8947, -8833, -8717, -8602, -8486, -8373, 
-        -8256, -8142, -8026, -7912, -7797, -7681, -7566, -7452, -7337, -7221, -7106, -6990, 
-        -6876, -6761, -6645, -6530, -6416, -6301, -6185, -6070, -5956, -5840, -5725, -5610, 
-        -5496, -5380, -5265, -5149, -5034, -4920, -4804, -4691, -4574, -4460, -4344, -4229, 
-        -4113, -3999, -3884, -3769, -3653, -3539, -3424, -3308, -3194, -3077, -2964, -2848, 
-        -2734, -2619, -2503, -2388, -2274, -2158, -2043, -1928, -1812, -1698, -1583, -1467, 
-        -1352, -1238, -1123, -1007, -892, -778, -662, -547, -431, -317, -202, -87 
-    };
-
-    // AKWF_blended_0055 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0055[600] PROGMEM = {
-        97, 208, 322, 435, 549, 660, 774, 887, 1001, 1113, 1226, 1340, 
-        1453, 1566, 1678, 1792, 1905, 2019, 2130, 2244, 2357, 2471, 2583, 2696, 
-        2810, 2923, 3035, 3148, 3262, 3375, 3489, 3600, 3714, 3827, 3939, 4053, 
-        4166, 4278, 4391, 4505, 4618, 4732, 4845, 4957, 5070, 5184, 5297, 5409, 
-        5522, 5636, 5748, 5861, 5975, 6088, 6200, 6313, 6427, 6540, 6654, 6766, 
-        6879, 6992, 7106, 7218, 7331, 7445, 7558, 7670, 7783, 7897, 8010, 8122, 
-        8235, 8349, 8462, 8576, 8688, 8801, 8915, 9028, 9140, 9253, 9367, 9480, 
-        9592, 9705, 9819, 9932, 10044, 10158, 10271, 10385, 10496, 10610, 10723, 10835, 
-        10948, 11062, 11175, 11289, 11402, 11514, 11628, 11741, 11853, 11966, 12080, 12193, 
-        12305, 12418, 12532, 12645, 12757, 12871, 12984, 13097, 13211, 13323, 13436, 13550, 
-        13663, 13775, 13888, 14002, 14115, 14227, 14341, 14454, 14567, 14679, 14793, 14906, 
-        15020, 15131, 15245, 15358, 15472, 15584, 15697, 15810, 15922, 16036, 16149, 16263, 
-        16376, 16490, 16601, 16715, 16828, 16942, 17054, 17167, 17280, 17392, 17506, 17619, 
-        17733, 17844, 17958, 18071, 18185, 18298, 18410, 18523, 18637, 18750, 18862, 18976, 
-        19089, 19203, 19314, 19428, 19541, 19655, 19767, 19880, 19993, 20107, 20220, 20332, 
-        20446, 20559, 20672, 20784, 20898, 21011, 21123, 21236, 21350, 21463, 21577, 21689, 
-        21802, 21916, 22029, 22141, 22254, 22368, 22480, 22593, 22706, 22820, 22932, 23045, 
-        23159, 23272, 23385, 23497, 23611, 23724, 23838, 23949, 24063, 24176, 24290, 24402, 
-        24515, 24629, 24742, 24854, 24967, 25081, 25194, 25308, 25419, 25533, 25646, 25760, 
-        25872, 25985, 26098, 26210, 26324, 26437, 26551, 26664, 26776, 26889, 27003, 27116, 
-        27228, 27342, 27455, 27568, 27680, 27794, 27907, 28019, 28132, 28246, 28359, 28473, 
-        28586, 28698, 28811, 28925, 29037, 29150, 29264, 29377, 29489, 29602, 29716, 29829, 
-        29941, 30055, 30168, 30281, 30395, 30507, 30620, 30734, 30847, 30959, 31072, 31186, 
-        31299, 31411, 31524, 31638, 31751, 31863, 31977, 32090, 32204, 32317, 32429, 32542, 
-        32656, 32767, -9100, -8987, -8873, -8760, -8647, -8535, -8421, -8308, -8196, -8083, 
-        -7969, -7856, -7742, -7630, -7517, -7404, -7290, -7178, -7065, -6951, -6840, -6726, 
-        -6613, -6499, -32236, -32123, -32010, -31896, -31784, -31671, -31557, -31444, -31332, -31219, 
-        -31105, -30992, -30880, -30766, -30653, -30540, -30426, -30314, -30201, -30087, -29976, -29862, 
-        -29749, -29637, -29523, -29410, -29297, -29183, -29070, -28958, -28844, -28731, -28617, -28506, 
-        -28392, -28279, -28167, -28053, -27940, -27827, -27715, -27601, -27488, -27374, -27261, -27149, 
-        -27036, -26922, -26809, -26697, -26584, -26470, -26357, -26245, -26131, -26018, -25904, -25793, 
-        -25679, -25566, -25452, -25339, -25227, -25114, -25000, -24887, -24775, -24661, -24548, -24436, 
-        -24323, -24209, -24096, -23982, -23871, -23757, -23644, -23530, -23418, -23305, -23191, -23080, 
-        -22966, -22853, -22739, -22627, -22514, -22401, -22287, -22174, -22062, -21948, -21835, -21722, 
-        -21610, -21496, -21383, -21269, -21158, -21044, -20931, -20817, -20705, -20592, -20478, -20365, 
-        -20252, -20140, -20026, -19913, -19799, -19688, -19574, -19461, -19347, -19235, -19122, -19009, 
-        -18895, -18783, -18670, -18556, -18443, -18331, -18218, -18104, -17991, -17879, -17765, -17652, 
-        -17540, -17425, -17313, -17200, -17086, -16973, -16861, -16748, -16634, -16522, -16409, -16296, 
-        -16182, -16070, -15957, -15843, -15730, -15618, -15505, -15391, -15278, -15164, -15052, -14939, 
-        -14826, -14712, -14600, -14487, -14373, -14260, -14148, -14035, -13921, -13808, -13696, -13583, 
-        -13469, -13356, -13242, -13130, -13017, -12903, -12792, -12678, -12565, -12451, -12338, -12226, 
-        -12113, -11999, -11886, -11774, -11660, -11547, -11435, -11322, -11208, -11095, -10983, -10870, 
-        -10756, -10643, -10529, -10417, -10304, -10190, -10077, -9965, -9852, -9738, -9625, -9513, 
-        -9400, -9286, -9173, -9061, -8947, -8834, -8721, -8607, -8495, -8382, -8268, -8155, 
-        -8043, -7930, -7816, -7704, -7591, -7477, -7364, -7251, -7139, -7025, -6912, -6798, 
-        -6687, -6573, -6460, -6346, -6234, -6121, -6008, -5896, -5782, -5669, -5555, -5442, 
-        -5328, -5217, -5103, -4990, -4878, -4765, -4651, -4538, -4426, -4312, -4199, -4085, 
-        -3974, -3860, -3747, -3633, -3520, -3408, -3295, -3181, -3068, -2956, -2842, -2729, 
-        -2615, -2504, -2390, -2277, -2163, -2052, -1938, -1825, -1711, -1598, -1486, -1372, 
-        -1259, -1147, -1034, -920, -808, -695, -582, -468, -355, -241, -129, -16 
-    };
-
-} // namespace AKWF_BwBlended
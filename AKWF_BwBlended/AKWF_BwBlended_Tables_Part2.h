@@ -1,1304 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwBlended {
-
-    // AKWF_blended_0056 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0056[600] PROGMEM = {
-        97, 208, 322, 435, 549, 660, 774, 887, 1001, 1113, 1226, 1340, 
-        1453, 1566, 1678, 1792, 1905, 2019, 2130, 2244, 2357, 2471, 2583, 2696, 
-        2810, 2923, 3035, 3148, 3262, 3375, 3489, 3600, 3714, 3827, 3939, 4053, 
-        4166, 4278, 4391, 4505, 4618, 4732, 4845, 4957, 5070, 5184, 5297, 5409, 
-        5522, 5636, 5748, 5861, 5975, 6088, 6200, 6313, 6427, 6540, 6654, 6766, 
-        6879, 6992, 7106, 7218, 7331, 7445, 7558, 7670, 7783, 7897, 8010, 8122, 
-        8235, 8349, 8462, 8576, 8688, 8801, 8915, 9028, 9140, 9253, 9367, 9480, 
-        9592, 9705, 9819, 9932, 10044, 10158, 10271, 10385, 10496, 10610, 10723, 10835, 
-        10948, 11062, 11175, 11289, 11402, 11514, 11628, 11741, 11853, 11966, 12080, 12193, 
-        12305, 12418, 12532, 12645, 12757, 12871, 12984, 13097, 13211, 13323, 13436, 13550, 
-        13663, 13775, 13888, 14002, 14115, 14227, 14341, 14454, 14567, 14679, 14793, 14906, 
-        15020, 15131, 15245, 15358, 15472, 15584, 15697, 15810, 15922, 16036, 16149, 16263, 
-        16376, 16490, 16601, 16715, 16828, 16942, 17054, 17167, 17280, 17392, 17506, 17619, 
-        17733, 17844, 17958, 18071, 18185, 18298, 18410, 18523, 18637, 18750, 18862, 18976, 
-        19089, 19203, 19314, 19428, 19541, 19655, 19767, 19880, 19993, 20107, 20220, 20332, 
-        20446, 20559, 20672, 20784, 20898, 21011, 21123, 21236, 21350, 21463, 21577, 21689, 
-        21802, 21916, 22029, 22141, 22254, 22368, 22480, 22593, 22706, 22820, 22932, 23045, 
-        23159, 23272, 23385, 23497, 23611, 23724, 23838, 23949, 24063, 24176, 24290, 24402, 
-        24515, 24629, 24742, 24854, 24967, 25081, 25194, 25308, 25419, 25533, 25646, 25760, 
-        25872, 25985, 26098, 26210, 26324, 26437, 26551, 26664, 26776, 26889, 27003, 27116, 
-        27228, 27342, 27455, 27568, 27680, 27794, 27907, 28019, 28132, 28246, 28359, 28473, 
-        28586, 28698, 28811, 28925, 29037, 29150, 29264, 29377, 29489, 29602, 29716, 29829, 
-        29941, 30055, 30168, 30281, 30395, 30507, 30620, 30734, 30847, 30959, 31072, 31186, 
-        31299, 31411, 31524, 31638, 31751, 31863, 31977, 32090, 32204, 32317, 32429, 32542, 
-        32656, 32767, -9100, -8987, -8873, -8760, -8647, -8535, -8421, -8308, -8196, -8083, 
-        -7969, -7856, -7742, -7630, -7517, -7404, -7290, -7178, -7065, -6951, -6840, -6726, 
-        -6613, -6499, -32236, -32123, -32010, -31896, -31784, -31671, -31557, -31444, -31332, -31219, 
-        -31105, -30992, -30880, -30766, -30653, -30540, -30426, -30314, -30201, -30087, -29976, -29862, 
-        -29749, -29637, -29523, -29410, -29297, -29183, -29070, -28958, -28844, -28731, -28617, -28506, 
-        -28392, -28279, -28167, -28053, -27940, -27827, -27715, -27601, -27488, -27374, -27261, -27149, 
-        -27036, -26922, -26809, -26697, -26584, -26470, -26357, -26245, -26131, -26018, -25904, -25793, 
-        -25679, -25566, -25452, -25339, -25227, -25114, -25000, -24887, -24775, -24661, -24548, -24436, 
-        -24323, -24209, -24096, -23982, -23871, -23757, -23644, -23530, -23418, -23305, -23191, -23080, 
-        -22966, -22853, -22739, -22627, -22514, -22401, -22287, -22174, -22062, -21948, -21835, -21722, 
-        -21610, -21496, -21383, -21269, -21158, -21044, -20931, -20817, -20705, -20592, -20478, -20365, 
-        -20252, -20140, -20026, -19913, -19799, -19688, -19574, -19461, -19347, -19235, -19122, -19009, 
-        -18895, -18783, -18670, -18556, -18443, -18331, -18218, -18104, -17991, -17879, -17765, -17652, 
-        -17540, -17425, -17313, -17200, -17086, -16973, -16861, -16748, -16634, -16522, -16409, -16296, 
-        -16182, -16070, -15957, -15843, -15730, -15618, -15505, -15391, -15278, -15164, -15052, -14939, 
-        -14826, -14712, -14600, -14487, -14373, -14260, -14148, -14035, -13921, -13808, -13696, -13583, 
-        -13469, -13356, -13242, -13130, -13017, -12903, -12792, -12678, -12565, -12451, -12338, -12226, 
-        -12113, -11999, -11886, -11774, -11660, -11547, -11435, -11322, -11208, -11095, -10983, -10870, 
-        -10756, -10643, -10529, -10417, -10304, -10190, -10077, -9965, -9852, -9738, -9625, -9513, 
-        -9400, -9286, -9173, -9061, -8947, -8834, -8721, -8607, -8495, -8382, -8268, -8155, 
-        -8043, -7930, -7816, -7704, -7591, -7477, -7364, -7251, -7139, -7025, -6912, -6798, 
-        -6687, -6573, -6460, -6346, -6234, -6121, -6008, -5896, -5782, -5669, -5555, -5442, 
-        -5328, -5217, -5103, -4990, -4878, -4765, -4651, -4538, -4426, -4312, -4199, -4085, 
-        -3974, -3860, -3747, -3633, -3520, -3408, -3295, -3181, -3068, -2956, -2842, -2729, 
-        -2615, -2504, -2390, -2277, -2163, -2052, -1938, -1825, -1711, -1598, -1486, -1372, 
-        -1259, -1147, -1034, -920, -808, -695, -582, -468, -355, -241, -129, -16 
-    };
-
-    // AKWF_blended_0057 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0057[600] PROGMEM = {
-        11, 195, 377, 560, 742, 924, 1106, 1290, 1472, 1654, 1837, 2019, 
-        2201, 2383, 2567, 2749, 2931, 3114, 3296, 3478, 3660, 3844, 4026, 4209, 
-        4391, 4573, 4757, 4939, 5121, 5303, 5486, 5668, 5850, 6034, 6216, 6398, 
-        6581, 6763, 6945, 7129, 7311, 7493, 7675, 7858, 8040, 8222, 8406, 8588, 
-        8771, 8953, 9135, 9317, 9501, 9683, 9865, 10048, 10230, 10412, 10594, 10778, 
-        10960, 11143, 11325, 11507, 11689, 11871, 12055, 12237, 12420, 12602, 12784, 12968, 
-        13150, 13332, 13514, 13698, 13879, 14061, 14245, 14427, 14609, 14793, 14975, 15156, 
-        15340, 15522, 15704, 15886, 16070, 16252, 16434, 16617, 16799, 16983, 17165, 17347, 
-        17529, 17712, 17894, 18076, 18260, 18442, 18624, 18806, 18989, 19171, 19355, 19537, 
-        19719, 19901, 20084, 20266, 20448, 20632, 20814, 20996, 21179, 21361, 21543, 21727, 
-        21909, 22091, 22274, 22455, 22638, 22820, 23004, 23186, 23368, 23551, 23733, 23915, 
-        24097, 24281, 24463, 24645, 24830, 25005, 25200, 25364, 25573, 25720, 25950, 26071, 
-        26330, 26418, 26715, 26761, 27105, 27097, 27504, 27425, 27912, 27740, 28333, 28038, 
-        28777, 28309, 29259, 28523, 29825, 28605, 30625, 28199, 32767, -1336, -14389, -9812, 
-        -12242, -10221, -11440, -10139, -10876, -9924, -10393, -9653, -9948, -9355, -9527, -9040, 
-        -9119, -8712, -8721, -8376, -8330, -8035, -7945, -7688, -7565, -7335, -7189, -6980, 
-        -6816, -6621, -6445, -6260, -6078, -5896, -5714, -5532, -5349, -5167, -4983, -4801, 
-        -4619, -4435, -4253, -4072, -3890, -3706, -3524, -3342, -3158, -2976, -2795, -2613, 
-        -2429, -2247, -2063, -1881, -1699, -1517, -1334, -1152, -970, -786, -604, -422, 
-        -239, -57, 124, 308, 490, 672, 855, 1037, 1219, 1401, 1585, 1767, 
-        1950, 2132, 2314, 2496, 2678, 2862, 3044, 3227, 3409, 3591, 3775, -21815, 
-        -21632, -21450, -21266, -21084, -20902, -20720, -20537, -20355, -20173, -19989, -19807, -19625, 
-        -19443, -19260, -19078, -18894, -18712, -18530, -18348, -18165, -17983, -17801, -17617, -17435, 
-        -17253, -17070, -16888, -16706, -16524, -16340, -16158, -15976, -15793, -15611, -15429, -15245, 
-        -15063, -14881, -14697, -14516, -14334, -14152, -13968, -13786, -13602, -13420, -13239, -13055, 
-        -12873, -12691, -12509, -12325, -12143, -11961, -11778, -11596, -11414, -11230, -11048, -10866, 
-        -10683, -10501, -10319, -10137, -9953, -9771, -9589, -9406, -9224, -9042, -8858, -8676, 
-        -8494, -8311, -8129, -7947, -7763, -7581, -7399, -7217, -7034, -6852, -6670, -6486, 
-        -6304, -6122, -5940, -5757, -5575, -5391, -5209, -5027, -4844, -4662, -4480, -4298, 
-        -4114, -3932, -3750, -3567, -3385, -3203, -3019, -2837, -2655, -2472, -2290, -2108, 
-        -1926, -1742, -1560, -1378, -1195, -1013, -829, -647, -465, -283, -99, 81, 
-        263, 447, 629, 811, 993, 1177, 1358, 1542, 1724, 1906, 2088, 2270, 
-        2454, 2635, 2819, 3001, 3183, 3367, 3549, 3731, 3913, 4096, 4278, 4462, 
-        4642, 4826, 5008, 5191, 5373, 5555, 5739, 5921, 6103, 6285, 6468, 6650, 
-        6834, 7016, 7198, 7380, 7563, 7745, 7927, 8111, 8293, 8475, 8657, 8840, 
-        9022, 9204, 9388, 9570, 9753, 9935, 10117, 10299, 10483, 10665, 10847, 11030, 
-        11212, 11394, 11578, 11758, 11943, 12120, 12314, 12478, 12688, 12834, 13063, 13186, 
-        13443, 13534, 13829, 13876, 14219, 14211, 14617, 14538, 15025, 14853, 15447, 15153, 
-        15891, 15422, 16373, 15637, 16938, 15719, 17738, 15312, 19883, -14222, -27276, -22699, 
-        -25128, -23105, -24327, -23023, -23761, -22809, -23279, -22540, -22835, -22242, -22412, -21925, 
-        -22005, -21599, -21607, -21263, -21215, -20920, -20832, -20573, -20451, -20222, -20074, -19866, 
-        -19702, -19507, -19332, -19147, -18965, -18783, -18599, -18417, -18235, -18051, -17870, -17688, 
-        -17504, -17322, -17140, -16956, -16776, -16593, -16411, -16227, -16045, -15863, -15679, -15497, 
-        -15315, -15134, -14950, -14768, -14584, -14402, -14220, -14037, -13855, -13673, -13491, -13307, 
-        -13125, -12943, -12761, -12578, -12396, -12214, -12030, -11848, -11665, -11483, -11301, -11119, 
-        -10935, -10753, -10571, -10388, -10206, -10022, -9842, -9658, -9476, -9293, -9111, -8929, 
-        -8747, -8563, -8381, -8199, -8016, -7834, -7650, -7468, -7286, -7104, -6922, -6739, 
-        -6557, -6373, -6191, -6009, -5827, -5644, -5462, -5280, -5096, -4914, -4732, -4550, 
-        -4367, -4185, -4003, -3819, -3637, -3454, -3272, -3090, -2908, -2724, -2542, -2360, 
-        -2176, -1995, -1813, -1629, -1447, -1265, -1081, -899, -718, -536, -352, -170 
-    };
-
-    // AKWF_blended_0058 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0058[600] PROGMEM = {
-        22, 190, 358, 527, 695, 863, 1031, 1200, 1368, 1537, 1705, 1873, 
-        2041, 2210, 2378, 2546, 2715, 2883, 3051, 3219, 3388, 3556, 3724, 3893, 
-        4061, 4229, 4399, 4566, 4734, 4904, 5071, 5239, 5409, 5577, 5744, 5912, 
-        6082, 6249, 6417, 6587, 6755, 6922, 7092, 7260, 7427, 7597, 7765, 7933, 
-        8102, 8270, 8438, 8605, 8775, 8943, 9112, 9280, 9448, 9616, 9785, 9953, 
-        10121, 10290, 10458, 10626, 10794, 10963, 11131, 11300, 11468, 11636, 11805, 11973, 
-        12141, 12309, 12478, 12646, 12814, 12983, 13151, 13319, 13488, 13656, 13824, 13992, 
-        14161, 14329, 14497, 14666, 14834, 15002, 15171, 15339, 15507, 15677, 15844, 16012, 
-        16180, 16349, 16517, 16687, 16855, 17022, 17190, 17360, 17527, 17695, 17865, 18033, 
-        18200, 18368, 18538, 18705, 18875, 19043, 19211, 19380, 19548, 19716, 19884, 20053, 
-        20221, 20389, 20558, 20726, 20894, 21063, 21231, 21399, 21568, 21736, 21904, 22072, 
-        22241, 22409, 22577, 22746, 22914, 23082, 23251, 23419, 23587, 23756, 23924, 24092, 
-        24261, 24429, 24597, 24765, 24934, 25102, 25270, 25441, 25603, 25783, 25934, 26126, 
-        26262, 26474, 26586, 26825, 26906, 27180, 27222, 27540, 27532, 27907, 27833, 28284, 
-        28125, 28672, 28400, 29082, 28648, 29527, 28846, 30049, 28922, 30788, 28545, 32767, 
-        1315, -10741, -6514, -8758, -6891, -8019, -6817, -7497, -6618, -7051, -6369, -6641, 
-        -6094, -6252, -5803, -5876, -5501, -5508, -5191, -5149, -4876, -4793, -28329, -28216, 
-        -28006, -27869, -27677, -27525, -27346, -27184, -27012, -26846, -26678, -26508, -26341, -26171, 
-        -26003, -25836, -25666, -25498, -25330, -25163, -24993, -24825, -24658, -24488, -24320, -24152, 
-        -23983, -23815, -23647, -23478, -23310, -23142, -22974, -22805, -22637, -22469, -22300, -22132, 
-        -21964, -21795, -21627, -21459, -21290, -21122, -20954, -20785, -20617, -20449, -20281, -20112, 
-        -19944, -19776, -19607, -19439, -19271, -19103, -18934, -18766, -18597, -18429, -18261, -18093, 
-        -17924, -17756, -17588, -17419, -17251, -17083, -16915, -16746, -16578, -16408, -16241, -16073, 
-        -15903, -15736, -15568, -15400, -15230, -15063, -14895, -14725, -14558, -14390, -14220, -14052, 
-        -13885, -13715, -13547, -13380, -13212, -13042, -12874, -12707, -12537, -12369, -12201, -12032, 
-        -11864, -11696, -11529, -11359, -11191, -11022, -10854, -10686, -10518, -10349, -10181, -10013, 
-        -9844, -9676, -9508, -9339, -9171, -9003, -8834, -8666, -8498, -8329, -8161, -7993, 
-        -7825, -7656, -7488, -7319, -7151, -6983, -6815, -6646, -6478, -6310, -6141, -5973, 
-        -5805, -5637, -5468, -5300, -5132, -4963, -4795, -4627, -4457, -4290, -4122, -3952, 
-        -3785, -3617, -3447, -3279, -3112, -2944, -2774, -2607, -2439, -2269, -2101, -1934, 
-        -1764, -1596, -1429, -1259, -1091, -923, -754, -586, -418, -251, -81, 86, 
-        255, 423, 591, 759, 928, 1096, 1264, 1433, 1601, 1769, 1937, 2106, 
-        2274, 2443, 2611, 2779, 2948, 3116, 3284, 3452, 3621, 3789, 3957, 4126, 
-        4294, 4462, 4631, 4799, 4967, 5135, 5304, 5472, 5640, 5809, 5977, 6145, 
-        6314, 6482, 6650, 6820, 6987, 7155, 7325, 7492, 7660, 7830, 7998, 8165, 
-        8333, 8503, 8670, 8838, 9008, 9176, 9343, 9511, 9681, 9849, 10018, 10186, 
-        10354, 10523, 10691, 10859, 11027, 11196, 11364, 11532, 11701, 11869, 12037, 12206, 
-        12374, 12542, 12711, 12879, 13047, 13215, 13383, 13555, 13717, 13895, 14046, 14240, 
-        14375, 14586, 14700, 14937, 15020, 15292, 15335, 15652, 15645, 16020, 15947, 16396, 
-        16238, 16787, 16513, 17195, 16762, 17641, 16960, 18163, 17036, 18901, 16659, 20880, 
-        -10570, -22628, -18400, -20644, -18778, -19905, -18702, -19383, -18504, -18938, -18256, -18529, 
-        -17981, -18140, -17689, -17763, -17388, -17396, -17078, -17036, -16762, -16681, -16442, -16330, 
-        -16118, -15982, -15790, -15639, -15459, -15297, -15126, -14958, -14790, -14621, -14453, -14285, 
-        -14117, -13948, -13780, -13612, -13443, -13275, -13107, -12938, -12770, -12602, -12433, -12265, 
-        -12097, -11928, -11760, -11592, -11424, -11255, -11087, -10919, -10750, -10582, -10414, -10246, 
-        -10077, -9909, -9740, -9572, -9404, -9235, -9067, -8899, -8731, -8562, -8394, -8226, 
-        -8057, -7889, -7721, -7551, -7384, -7216, -7046, -6879, -6711, -6543, -6373, -6206, 
-        -6036, -5868, -5701, -5531, -5363, -5195, -5028, -4858, -4690, -4523, -4353, -4185, 
-        -4017, -3850, -3680, -3512, -3345, -3175, -3007, -2839, -2672, -2502, -2334, -2165, 
-        -1997, -1829, -1660, -1492, -1324, -1156, -987, -819, -650, -483, -314, -146 
-    };
-
-    // AKWF_blended_0059 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0059[600] PROGMEM = {
-        34, 206, 379, 551, 723, 895, 1069, 1241, 1413, 1586, 1758, 1930, 
-        2104, 2276, 2448, 2621, 2793, 2965, 3139, 3311, 3483, 3656, 3828, 4000, 
-        4172, 4346, 4518, 4690, 4863, 5035, 5207, 5381, 5553, 5725, 5897, 6071, 
-        6243, 6415, 6588, 6760, 6934, 7106, 7278, 7450, 7623, 7795, 7967, 8141, 
-        8313, 8485, 8657, 8830, 9002, 9176, 9348, 9520, 9692, 9865, 10037, 10209, 
-        10383, 10555, 10727, 10900, 11072, 11244, 11416, 11590, 11762, 11934, 12108, 12280, 
-        12452, 12625, 12797, 12969, 13143, 13315, 13487, 13659, 13832, 14004, 14178, 14350, 
-        14522, 14695, 14867, 15039, 15211, 15385, 15557, 15729, 15901, 16074, 16246, 16418, 
-        16592, 16764, 16937, 17109, 17281, 17453, 17627, 17799, 17971, 18145, 18317, 18489, 
-        18661, 18834, 19006, 19178, 19352, 19524, 19696, 19869, 20041, 20213, 20387, 20559, 
-        20731, 20904, 21076, 21248, 21422, 21594, 21766, 21939, 22111, 22283, 22455, 22629, 
-        22801, 22973, 23146, 23318, 23490, 23662, 23836, 24008, 24180, 24354, 24526, 24699, 
-        24871, 25043, 25215, 25389, 25561, 25733, 25906, 26078, 26250, 2062, 2235, 2407, 
-        2579, 2753, 2925, 3097, 3271, 3443, 3615, 3787, 3960, 4132, 4307, 4473, 
-        4656, 4812, 5009, 5149, 5364, 5480, 5723, 5809, 6088, 6133, 6458, 6449, 
-        6833, 6759, 7219, 7058, 7619, 7338, 8037, 7594, 8494, 7797, 9029, 7874, 
-        9785, 7488, 11813, -20415, -32767, -28437, -30736, -28824, -29978, -28746, -29444, -28543, 
-        -28988, -28288, -28568, -28007, -28168, -27708, -27784, -27398, -27408, -27082, -27037, -26758, 
-        -26673, -26430, -26314, -26098, -25959, -25762, -25607, -25423, -25257, -25082, -24910, -24736, 
-        -24564, -24392, -24220, -24047, -23875, -23703, -23529, -23357, -23185, -23012, -22840, -22668, 
-        -22496, -22322, -22150, -21978, -21805, -21633, -21459, -21287, -21115, -20943, -20769, -20597, 
-        -20425, -20252, -20080, -19908, -19736, -19562, -19390, -19217, -19045, -18873, -18701, -18527, 
-        -18355, -18183, -18010, -17838, -17666, -17492, -17320, -17148, -16975, -16803, -16631, -16457, 
-        -16285, -16113, -15941, -15768, -15596, -15424, -15250, -15078, -14906, -14734, -14560, -14388, 
-        -14215, -14043, -13871, -13697, -13525, -13353, -13181, -13008, -12836, -12664, -12490, -12318, 
-        -12146, -11974, -11801, -11629, -11455, -11283, -11111, -10939, -10766, -10594, -10422, -10248, 
-        -10076, -9904, -9731, -9559, -9387, -9213, -9041, -8869, -8695, -8523, -8351, -8179, 
-        -8006, -7834, -7660, -7488, -7316, -7144, -6971, -6799, -6627, -6453, -6281, -6109, 
-        -5936, -5764, -5592, -5420, -5246, -5074, -4902, -4730, -4557, -4385, -4213, -4039, 
-        -3867, -3694, -3522, -3350, -3178, -3004, -2832, -2660, -2487, -2315, -2141, -1971, 
-        -1797, -1625, -1451, -1279, -1107, -935, -762, -590, -418, -244, -72, 100, 
-        272, 444, 616, 790, 962, 1134, 1307, 1479, 1651, 1823, 1997, 2169, 
-        2341, 2514, 2686, 2858, 3030, 3204, 3376, 3549, 3721, 3893, 4067, 4239, 
-        4411, 4583, 4757, 4929, 5101, 5274, 5446, 5618, 5792, 5964, 6136, 6309, 
-        6481, 6653, 6825, 6999, 7171, 7343, 7516, 7688, 7862, 8034, 8206, 8378, 
-        8551, 8723, 8895, 9069, 9241, 9413, 9585, 9758, 9930, 10104, 10276, 10448, 
-        10620, 10794, 10966, 11138, 11311, 11483, 11655, 11829, 12001, 12173, 12346, 12518, 
-        12690, 12862, 13036, 13208, 13380, 13553, 13725, 13897, 14071, 14243, 14415, 14587, 
-        14760, 14932, 15104, 15278, 15450, 15623, 15795, 15967, 16139, 16311, 16487, 16652, 
-        16837, 16992, 17188, 17328, 17545, 17661, 17904, 17990, 18269, 18312, 18637, 18630, 
-        19014, 18939, 19400, 19237, 19798, 19519, 20218, 19775, 20675, 19978, 21208, 20054, 
-        21966, 19669, 23994, -8235, -20588, -16257, -18555, -16643, -17797, -16566, -17263, -16363, 
-        -16807, -16108, -16387, -15826, -15989, -15527, -15603, -15219, -15227, -14901, -14858, -14578, 
-        -14494, -14251, -14134, -13917, -13778, -13581, -13426, -13242, -13076, -12901, -12729, -12557, 
-        -12383, -12211, -12039, -11867, -11694, -11522, -11350, -11176, -11004, -10832, -10660, -10487, 
-        -10315, -10141, -9969, -9797, -9625, -9452, -9280, -9108, -8934, -8762, -8590, -8417, 
-        -8245, -8073, -7899, -7727, -7555, -7383, -7209, -7037, -6865, -6692, -6520, -6348, 
-        -6174, -6002, -5830, -5658, -5485, -5313, -5139, -4967, -4795, -4622, -4450, -4278, 
-        -4106, -3932, -3760, -3588, -3415, -3243, -3071, -2897, -2725, -2553, -2380, -2208, 
-        -2036, -1864, -1690, -1518, -1346, -1172, -1001, -829, -655, -483, -311, -137 
-    };
-
-    // AKWF_blended_0060 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0060[600] PROGMEM = {
-        121, 307, 494, 681, 870, 1056, 1245, 1432, 1618, 1807, 1994, 2181, 
-        2367, 2556, 2743, 2929, 3118, 3305, 3492, 3680, 3867, 4054, 4242, 4429, 
-        4616, 4803, 4991, 5178, 5365, 5553, 5740, 5928, 6115, 6302, 6489, 6677, 
-        6864, 7051, 7239, 7426, 7613, 7800, 7988, 8175, 8362, 8550, 8737, 8924, 
-        9111, 9299, 9486, 9675, 9861, 10048, 10237, 10423, 10610, 10797, 10986, 11172, 
-        11359, 11548, 11734, 11921, 12110, 12297, 12483, 12672, 12859, 13045, 13232, 13421, 
-        13608, 13796, 13983, 14170, 14356, 14545, 14732, 14919, 15107, 15294, 15481, 15667, 
-        15856, 16043, 16230, 16418, 16605, 16793, 16980, 17167, 17354, 17541, 17729, 17916, 
-        18104, 18291, 18478, 18665, 18853, 19040, 19227, 19415, 19602, 19789, 19976, 20164, 
-        20351, 20538, 20728, 20908, 21108, 21277, 21490, 21642, 21877, 22004, 22268, 22359, 
-        22663, 22710, 23064, 23055, 23473, 23392, 23892, 23715, 24324, 24021, 24780, 24297, 
-        25277, 24518, 25857, 24602, 26679, 24183, 28883, -6117, -19538, -14834, -17332, -15253, 
-        -16507, -15169, -15928, -14949, -15432, -14673, -14976, -14367, -14543, -14042, -14124, -13707, 
-        -13715, -13362, -13315, -13010, -12919, -12653, -12529, -12293, -12142, -11928, -11760, -11559, 
-        -11379, -11189, -11002, -10816, -10627, -10442, -10253, -10067, -9878, -9691, -9505, -9316, 
-        -9129, -8943, -8756, -8567, -8380, -8192, -8005, -7818, -7630, -7443, -7256, -7069, 
-        -6881, -6694, -6507, -6321, -6132, -5945, -5758, -5570, -5383, -5195, -5008, -4821, 
-        -4634, -4447, -4259, -4072, -3884, -3697, -3510, -3322, -3135, -2948, -2761, -2573, 
-        -2386, -2199, -2011, -1824, -1637, -1448, -1262, -1075, -886, -700, -513, -326, 
-        -138, 48, 237, 424, 610, 797, 986, 1172, 1359, 1548, 1735, 1921, 
-        2108, 2297, 2483, 2670, 2859, 3046, 3234, 3421, 3608, 3794, 3983, 4170, 
-        4357, 4545, 4732, 4919, 5105, 5294, 5481, 5668, 5856, 6043, 6230, 6418, 
-        6605, 6792, 6980, 7167, 7354, 7542, 7729, 7916, 8103, 8291, 8478, 8667, 
-        8853, 9040, 9227, 9415, 9602, 9789, 9977, 10164, 10351, 10538, 10726, 10913, 
-        11102, 11288, 11475, 11664, 11851, 12037, 12224, 12413, 12599, 12786, 12975, 13162, 
-        13348, 13537, 13724, 13910, 14099, 14286, 14473, 14659, 14848, 15035, 15221, 15410, 
-        15597, 15784, 15972, 16159, 16346, 16534, 16721, 16908, 17096, 17283, 17470, 17657, 
-        17845, 18032, 18219, 18407, 18594, 18781, 18968, 19156, 19343, -6926, -6740, -6551, 
-        -6364, -6177, -5989, -5802, -5614, -5427, -5240, -5053, -4865, -4678, -4491, -4303, 
-        -4116, -3927, -3742, -3554, -3367, -3180, -2992, -2805, -2618, -2430, -2243, -2056, 
-        -1868, -1681, -1494, -1305, -1119, -932, -745, -557, -370, -181, 5, 191, 
-        378, 567, 753, 940, 1129, 1316, 1502, 1689, 1878, 2064, 2253, 2440, 
-        2627, 2815, 3002, 3189, 3375, 3564, 3751, 3938, 4126, 4313, 4500, 4688, 
-        4875, 5062, 5250, 5437, 5624, 5811, 5999, 6186, 6373, 6561, 6748, 6936, 
-        7123, 7308, 7500, 7680, 7879, 8049, 8263, 8412, 8648, 8774, 9038, 9131, 
-        9434, 9483, 9834, 9826, 10243, 10163, 10662, 10486, 11097, 10792, 11553, 11070, 
-        12047, 11290, 12628, 11374, 13451, 10955, 15654, -19346, -32767, -28062, -30560, -28483, 
-        -29737, -28399, -29156, -28178, -28661, -27902, -28205, -27596, -27771, -27271, -27354, -26936, 
-        -26945, -26591, -26542, -26239, -26149, -25883, -25756, -25523, -25371, -25157, -24987, -24789, 
-        -24609, -24419, -24232, -24045, -23856, -23670, -23483, -23294, -23108, -22921, -22734, -22545, 
-        -22359, -22170, -21983, -21797, -21610, -21421, -21234, -21048, -20859, -20672, -20486, -20299, 
-        -20110, -19924, -19735, -19548, -19361, -19173, -18986, -18799, -18613, -18424, -18237, -18050, 
-        -17862, -17675, -17488, -17300, -17113, -16926, -16738, -16551, -16364, -16177, -15989, -15802, 
-        -15615, -15427, -15240, -15051, -14865, -14678, -14491, -14303, -14116, -13929, -13740, -13554, 
-        -13367, -13180, -12992, -12805, -12618, -12429, -12243, -12056, -11867, -11681, -11494, -11305, 
-        -11119, -10932, -10743, -10556, -10370, -10183, -9994, -9808, -9621, -9432, -9245, -9059, 
-        -8870, -8683, -8497, -8308, -8121, -7934, -7748, -7559, -7372, -7186, -6997, -6810, 
-        -6622, -6435, -6248, -6061, -5873, -5686, -5499, -5311, -5124, -4937, -4749, -4562, 
-        -4375, -4188, -4000, -3813, -3626, -3438, -3251, -3064, -2876, -2689, -2502, -2314, 
-        -2127, -1940, -1753, -1565, -1378, -1189, -1003, -816, -629, -440, -254, -67 
-    };
-
-    // AKWF_blended_0061 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0061[600] PROGMEM = {
-        137, 330, 523, 718, 911, 1104, 1299, 1492, 1685, 1880, 2073, 2266, 
-        2461, 2654, 2847, 3041, 3235, 3428, 3621, 3815, 4009, 4202, 4396, 4589, 
-        4783, 4977, 5170, 5363, 5558, 5751, 5944, 6137, 6332, 6525, 6718, 6913, 
-        7106, 7301, 7494, 7687, 7880, 8075, 8268, 8461, 8656, 8849, 9042, 9235, 
-        9430, 9623, 9818, 10011, 10204, 10397, 10592, 10785, 10978, 11173, 11366, 11559, 
-        11754, 11947, 12140, 12334, 12528, 12721, 12914, 13108, 13302, 13495, 13689, 13882, 
-        14075, 14270, 14463, 14656, 14851, 15044, 15237, 15430, 15625, 15818, 16013, 16206, 
-        16399, 16592, 16787, 16980, 17173, 17368, 17561, 17754, 17947, 18142, 18335, 18530, 
-        18723, 18916, 19109, 19304, 19497, 19690, 19885, 20078, 20271, 20466, 20659, 20852, 
-        21047, 21240, 21433, 21627, 21820, 22014, 22207, 22401, 22594, 22788, 22982, 23175, 
-        23368, 23563, 23756, 23949, 24142, 24339, 24525, 24732, 24906, 25127, 25283, 25527, 
-        25656, 25930, 26024, 26339, 26388, 26753, 26744, 27176, 27092, 27609, 27426, 28056, 
-        27743, 28527, 28028, 29040, 28256, 29639, 28343, 30489, 27910, 32767, -3403, -17277, 
-        -12414, -14996, -12848, -14145, -12761, -13545, -12533, -13032, -12247, -12562, -11931, -12114, 
-        -11597, -11680, -11249, -11258, -10893, -10844, -10531, -10435, -10162, -10032, -9788, -9632, 
-        -9411, -9237, -9030, -8844, -8647, -8454, -8261, -8068, -7873, -7680, -7487, -7292, 
-        -7099, -6906, -6711, -6518, -6325, -6132, -5937, -5744, -5551, -5356, -5163, -4970, 
-        -4776, -4583, -4389, -4195, -4002, -3809, -3615, -3421, -3228, -3035, -2840, -2647, 
-        -2454, -2259, -2066, -1873, -1678, -1485, -1292, -1097, -904, -711, -518, -323, 
-        -130, 64, 257, 450, 643, 838, 1031, 1224, 1419, 1612, 1805, 2000, 
-        2193, 2386, 2579, 2774, 2967, 3160, 3355, 3548, 3741, 3935, 4129, 4322, 
-        4516, 4709, 4903, 5097, 5290, 5483, 5677, 5871, 6064, 6259, 6452, 6645, 
-        6838, 7033, 7226, 7419, 7614, 7807, 8000, 8193, 8388, 8581, 8776, 8969, 
-        9162, 9355, 9550, 9743, 9936, 10131, 10324, 10517, -16632, -16437, -16244, -16051, 
-        -15857, -15663, -15470, -15277, -15083, -14889, -14696, -14502, -14309, -14115, -13921, -13728, 
-        -13535, -13340, -13147, -12954, -12761, -12566, -12373, -12180, -11985, -11792, -11599, -11404, 
-        -11211, -11018, -10823, -10630, -10437, -10242, -10049, -9856, -9663, -9468, -9275, -9082, 
-        -8887, -8694, -8501, -8306, -8113, -7920, -7725, -7532, -7339, -7144, -6951, -6758, 
-        -6564, -6370, -6177, -5984, -5790, -5596, -5403, -5209, -5016, -4823, -4628, -4435, 
-        -4242, -4047, -3854, -3661, -3468, -3273, -3080, -2885, -2692, -2499, -2306, -2111, 
-        -1918, -1725, -1530, -1337, -1144, -951, -756, -563, -368, -175, 17, 210, 
-        405, 598, 791, 986, 1179, 1372, 1567, 1760, 1953, 2148, 2341, 2534, 
-        2728, 2921, 3115, 3308, 3502, 3695, 3889, 4083, 4276, 4469, 4664, 4857, 
-        5050, 5245, 5438, 5631, 5826, 6019, 6212, 6405, 6600, 6793, 6986, 7179, 
-        7374, 7567, 7760, 7955, 8148, 8343, 8536, 8729, 8922, 9117, 9310, 9503, 
-        9698, 9891, 10084, 10279, 10470, 10666, 10854, 11060, 11235, 11456, 11613, 11854, 
-        11985, 12258, 12354, 12667, 12717, 13081, 13072, 13503, 13420, 13936, 13754, 14385, 
-        14070, 14855, 14357, 15368, 14585, 15968, 14672, 16818, 14239, 19095, -17076, -30948, 
-        -26085, -28666, -26520, -27816, -26433, -27216, -26205, -26704, -25920, -26233, -25603, -25786, 
-        -25268, -25353, -24920, -24930, -24565, -24516, -24202, -24106, -23833, -23704, -23461, -23304, 
-        -23083, -22909, -22702, -22516, -22320, -22127, -21934, -21739, -21546, -21353, -21158, -20965, 
-        -20772, -20577, -20384, -20191, -19996, -19803, -19610, -19417, -19222, -19029, -18836, -18641, 
-        -18448, -18255, -18060, -17867, -17674, -17479, -17286, -17093, -16898, -16705, -16512, -16319, 
-        -16124, -15931, -15738, -15543, -15350, -15157, -14964, -14769, -14576, -14382, -14189, -13995, 
-        -13802, -13608, -13415, -13221, -13027, -12834, -12639, -12448, -12253, -12060, -11865, -11672, 
-        -11479, -11286, -11091, -10898, -10705, -10510, -10317, -10122, -9929, -9736, -9543, -9348, 
-        -9155, -8962, -8767, -8574, -8381, -8186, -7993, -7800, -7607, -7412, -7219, -7026, 
-        -6831, -6638, -6445, -6252, -6057, -5864, -5670, -5476, -5283, -5089, -4896, -4703, 
-        -4509, -4315, -4122, -3929, -3734, -3541, -3348, -3153, -2960, -2767, -2574, -2379, 
-        -2186, -1993, -1798, -1605, -1410, -1217, -1024, -831, -636, -443, -250, -55 
-    };
-
-    // AKWF_blended_0062 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0062[600] PROGMEM = {
-        42, 216, 389, 562, 737, 910, 1083, 1258, 1431, 1604, 1779, 1952, 
-        2125, 2300, 2473, 2646, 2819, 2993, 3167, 3341, 3514, 3687, 3860, 4035, 
-        4208, 4381, 4556, 4729, 4902, 5075, 5250, 5423, 5598, 5771, 5944, 6117, 
-        6291, 6465, 6638, 6812, 6985, 7158, 7333, 7506, 7679, 7852, 8027, 8200, 
-        8373, 8548, 8721, 8894, 9069, 9242, 9415, 9589, 9763, 9936, 10109, 10283, 
-        10456, 10630, 10804, 10977, 11150, 11325, 11498, 11671, 11846, 12019, 12192, 12365, 
-        12540, 12713, 12886, 13061, 13234, 13408, 13581, 13754, 13928, 14102, 14275, 14448, 
-        14623, 14796, 14969, 15142, 15317, 15490, 15663, 15838, 16011, 16184, 16359, 16532, 
-        16705, 16879, 17052, 17226, 17400, 17573, 17746, 17921, 18094, 18267, 18442, 18615, 
-        18788, 18961, 19136, 19309, 19482, 19657, 19830, 20003, 20177, 20350, 20524, 20697, 
-        20871, 21044, 21219, 21392, 21565, 21738, 21913, 22086, 22259, 22434, 22607, 22780, 
-        22953, 23128, 23301, 23475, 23648, 23822, 23995, 24169, 24342, 24515, 24690, 24863, 
-        25036, 25212, 25379, 25565, 25721, 25919, 26059, 26278, 26393, 26639, 26723, 27004, 
-        27049, 27377, 27369, 27756, 27679, 28144, 27980, 28545, 28264, 28967, 28520, 29426, 
-        28724, 29964, 28802, 30726, 28414, 32767, 338, -12098, -7739, -10053, -8127, -9290, 
-        -8050, -8752, -7846, -8292, -7589, -7871, -7305, -7469, -7006, -7080, -6694, -6702, 
-        -6374, -6330, -6050, -5964, -5719, -5602, -5384, -5245, -5047, -4890, -4706, -4539, 
-        -4361, -4189, -4015, -3842, -3669, -3494, -3321, -3146, -2973, -2800, -2627, -2452, 
-        -2279, -2106, -1932, -1758, -1585, -25927, -25754, -25579, -25406, -25231, -25058, -24885, 
-        -24712, -24537, -24364, -24191, -24016, -23843, -23670, -23497, -23323, -23149, -22975, -22802, 
-        -22629, -22456, -22281, -22108, -21935, -21760, -21587, -21414, -21239, -21066, -20893, -20718, 
-        -20545, -20372, -20198, -20025, -19851, -19678, -19504, -19331, -19158, -18983, -18810, -18637, 
-        -18462, -18289, -18116, -17941, -17768, -17595, -17420, -17247, -17074, -16901, -16727, -16553, 
-        -16380, -16206, -16033, -15860, -15686, -15512, -15339, -15164, -14991, -14818, -14643, -14470, 
-        -14297, -14124, -13949, -13776, -13603, -13429, -13255, -13082, -12908, -12735, -12562, -12388, 
-        -12214, -12041, -11868, -11693, -11520, -11345, -11172, -10999, -10826, -10651, -10478, -10305, 
-        -10131, -9957, -9784, -9611, -9437, -9264, -9090, -8916, -8743, -8570, -8395, -8222, 
-        -8049, -7876, -7701, -7528, -7353, -7180, -7007, -6834, -6659, -6486, -6313, -6139, 
-        -5966, -5791, -5619, -5445, -5272, -5097, -4924, -4751, -4578, -4403, -4230, -4057, 
-        -3882, -3709, -3535, -3361, -3188, -3015, -2841, -2668, -2494, -2320, -2147, -1974, 
-        -1801, -1626, -1453, -1280, -1105, -932, -759, -584, -411, -238, -63, 109, 
-        282, 456, 629, 803, 976, 1150, 1323, 1496, 1671, 1844, 2017, 2192, 
-        2365, 2538, 2713, 2886, 3059, 3234, 3407, 3580, 3753, 3927, 4101, 4275, 
-        4448, 4621, 4794, 4969, 5142, 5315, 5490, 5663, 5836, 6009, 6184, 6357, 
-        6532, 6705, 6878, 7051, 7225, 7399, 7572, 7746, 7919, 8092, 8267, 8440, 
-        8613, 8788, 8961, 9134, 9307, 9482, 9655, 9828, 10003, 10176, 10349, 10523, 
-        10697, 10870, 11044, 11217, 11390, 11564, 11738, 11911, 12086, 12259, 12432, 12605, 
-        12778, 12955, 13121, 13307, 13463, 13661, 13801, 14020, 14136, 14381, 14467, 14748, 
-        14791, 15119, 15111, 15498, 15423, 15886, 15722, 16287, 16006, 16709, 16263, 17169, 
-        16466, 17706, 16546, 18468, 16156, 20511, -11919, -24355, -19995, -22309, -20385, -21546, 
-        -20307, -21010, -20103, -20550, -19847, -20127, -19563, -19727, -19262, -19338, -18952, -18960, 
-        -18632, -18588, -18306, -18222, -17977, -17860, -17642, -17502, -17304, -17148, -16962, -16795, 
-        -16619, -16446, -16273, -16098, -15925, -15752, -15579, -15404, -15231, -15058, -14883, -14710, 
-        -14537, -14364, -14190, -14016, -13842, -13669, -13496, -13323, -13148, -12975, -12802, -12627, 
-        -12454, -12281, -12106, -11933, -11760, -11585, -11412, -11239, -11066, -10892, -10718, -10545, 
-        -10371, -10198, -10025, -9850, -9677, -9504, -9329, -9156, -8983, -8808, -8635, -8462, 
-        -8287, -8114, -7941, -7768, -7593, -7420, -7247, -7073, -6900, -6727, -6552, -6379, 
-        -6206, -6031, -5858, -5685, -5512, -5337, -5164, -4991, -4816, -4643, -4470, -4295, 
-        -4122, -3949, -3775, -3602, -3428, -3254, -3081, -2908, -2735, -2560, -2387, -2214, 
-        -2039, -1866, -1693, -1518, -1345, -1172, -997, -824, -651, -477, -304, -130 
-    };
-
-    // AKWF_blended_0063 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0063[600] PROGMEM = {
-        0, 13021, 13200, 13376, 13554, 13731, 13907, 14085, 14262, 14438, 14615, 14791, 
-        14968, 15144, 15321, 15495, 15672, 15847, 16022, 16196, 16371, 16546, 16719, 16893, 
-        17066, 17239, 17412, 17584, 17755, 17927, 18098, 18268, 18438, 18608, 18778, 18947, 
-        19115, 19282, 19448, 19615, 19782, 19947, 20112, 20277, 20440, 20602, 20765, 20927, 
-        21087, 21247, 21407, 21566, 21724, 21883, 22038, 22195, 22350, 22506, 22659, 22811, 
-        22963, 23115, 23265, 23414, 23563, 23711, 23857, 24004, 24149, 24293, 24437, 24579, 
-        24720, 24860, 25001, 25138, 25275, 25413, 25547, 25682, 25816, 25947, 26078, 26208, 
-        26337, 26467, 26592, 26718, 26844, 26967, 27089, 27210, 27331, 27450, 27568, 27684, 
-        27800, 27914, 28027, 28140, 28249, 28359, 28468, 28574, 28681, 28785, 28888, 28990, 
-        29091, 29191, 29289, 29385, 29481, 29575, 29668, 29761, 29851, 29939, 30027, 30114, 
-        30199, 30282, 30364, 30445, 30526, 30604, 30681, 30756, 30831, 30903, 30975, 31045, 
-        31114, 31181, 31246, 31312, 31374, 31436, 31496, 31555, 31612, 31669, 31723, 31777, 
-        31830, 31880, 31929, 31977, 32022, 32068, 32111, 32153, 32194, 32233, 32271, 32308, 
-        32343, 32377, 32410, 32441, 32470, 32498, 32524, 32549, 32573, 32596, 32617, 32637, 
-        32655, 32673, 32687, 32702, 32714, 32725, 32736, 32745, 32751, 32758, 32763, 32766, 
-        32767, 32767, 32767, 32766, 32761, 32758, 32751, 32743, 32735, 32725, 32714, 32702, 
-        32687, 32673, 32656, 32638, 32619, 32599, 32578, 32555, 32532, 32506, 32480, 32452, 
-        32424, 32395, 32362, 32331, 32297, 32263, 32227, 32191, 32153, 32114, 32073, 32032, 
-        31990, 31946, 31901, 31856, 31810, 31761, 31714, 31663, 31612, 31560, 31508, 31454, 
-        31400, 31344, 31287, 31230, 31171, 31112, 31050, 30990, 30928, 30864, 30800, 30736, 
-        30671, 30604, 30537, 30468, 30400, 30329, 30259, 30189, 30117, 30045, 29970, 29896, 
-        29821, 29746, 29671, 29594, 29516, 29439, 29360, 29280, 29200, 29120, 29040, 28958, 
-        28877, 28793, 28710, 28627, 28543, 28458, 28373, 28289, 28204, 28117, 28030, 27944, 
-        27855, 27769, 27681, 27592, 27504, 27414, 27326, 27236, 27146, 27056, 26967, 26875, 
-        26785, 26695, 26604, 26512, 26421, 26331, 26239, 26148, 26056, 25963, 25873, 25780, 
-        -12845, -25780, -25873, -25963, -26056, -26148, -26239, -26331, -26421, -26512, -26604, -26695, 
-        -26785, -26875, -26967, -27056, -27146, -27236, -27326, -27414, -27504, -27592, -27681, -27769, 
-        -27855, -27944, -28030, -28117, -28204, -28289, -28373, -28458, -28543, -28627, -28710, -28793, 
-        -28877, -28958, -29040, -29120, -29200, -29280, -29360, -29439, -29516, -29594, -29671, -29746, 
-        -29821, -29896, -29970, -30045, -30117, -30189, -30259, -30329, -30400, -30468, -30537, -30604, 
-        -30671, -30736, -30800, -30864, -30928, -30990, -31050, -31112, -31171, -31230, -31287, -31344, 
-        -31400, -31454, -31508, -31560, -31612, -31663, -31714, -31761, -31810, -31856, -31901, -31946, 
-        -31990, -32032, -32073, -32114, -32153, -32191, -32227, -32263, -32297, -32331, -32362, -32395, 
-        -32424, -32452, -32480, -32506, -32532, -32555, -32578, -32599, -32619, -32638, -32656, -32673, 
-        -32687, -32702, -32714, -32725, -32735, -32743, -32751, -32758, -32761, -32766, -32767, -32767, 
-        -32767, -32766, -32763, -32758, -32751, -32745, -32736, -32725, -32714, -32702, -32687, -32673, 
-        -32655, -32637, -32617, -32596, -32573, -32549, -32524, -32498, -32470, -32441, -32410, -32377, 
-        -32343, -32308, -32271, -32233, -32194, -32153, -32111, -32068, -32022, -31977, -31929, -31880, 
-        -31830, -31777, -31723, -31669, -31612, -31555, -31496, -31436, -31374, -31312, -31246, -31181, 
-        -31114, -31045, -30975, -30903, -30831, -30756, -30681, -30604, -30526, -30445, -30364, -30282, 
-        -30199, -30114, -30027, -29939, -29851, -29761, -29668, -29575, -29481, -29385, -29289, -29191, 
-        -29091, -28990, -28888, -28785, -28681, -28574, -28468, -28359, -28249, -28140, -28027, -27914, 
-        -27800, -27684, -27568, -27450, -27331, -27210, -27089, -26967, -26844, -26718, -26592, -26467, 
-        -26337, -26208, -26078, -25947, -25816, -25682, -25547, -25413, -25275, -25138, -25001, -24860, 
-        -24720, -24579, -24437, -24293, -24149, -24004, -23857, -23711, -23563, -23414, -23265, -23115, 
-        -22963, -22811, -22659, -22506, -22350, -22195, -22038, -21883, -21724, -21566, -21407, -21247, 
-        -21087, -20927, -20765, -20602, -20440, -20277, -20112, -19947, -19782, -19615, -19448, -19282, 
-        -19115, -18947, -18778, -18608, -18438, -18268, -18098, -17927, -17755, -17584, -17412, -17239, 
-        -17066, -16893, -16719, -16546, -16371, -16196, -16022, -15847, -15672, -15495, -15321, -15144, 
-        -14968, -14791, -14615, -14438, -14262, -14085, -13907, -13731, -13554, -13376, -13200, -13021 
-    };
-
-    // AKWF_blended_0064 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0064[600] PROGMEM = {
-        9816, 17471, 15917, 18247, 18154, 20417, 21654, 24128, 26149, 28398, 30280, 31690, 
-        32598, 32767, 32360, 31326, 29926, 28185, 26334, 24559, 23003, 21783, 20961, 20546, 
-        20500, 20741, 21163, 21654, 22092, 22379, 22445, 22252, 21793, 21102, 20235, 19266, 
-        18282, 17355, 16554, 15927, 15495, 15261, 15201, 15273, 15423, 15601, 15748, 15819, 
-        15784, 15628, 15356, 14979, 14532, 14045, 13561, 13117, 12738, 12449, 12254, 12154, 
-        12132, 12173, 12248, 12329, 12393, 12418, 12393, 12310, 12171, 11988, 11773, 11544, 
-        11320, 11115, 10943, 10816, 10733, 10694, 10691, 10714, 10748, 10785, 10810, 10816, 
-        10795, 10748, 10675, 10581, 10474, 10360, 10249, 10150, 10065, 10005, 9963, 9944, 
-        9938, 9944, 9953, 9963, 9965, 9959, 9938, 9905, 9861, 9807, 9747, 9685, 
-        9623, 9569, 9525, 9490, 9463, 9446, 9436, 9430, 9424, 9421, 9415, 9401, 
-        9384, 9357, 9328, 9293, 9256, 9220, 9183, 9152, 9123, 9100, 9079, 9065, 
-        9054, 9044, 9036, 9027, 9017, 9006, 8990, 8969, 8948, 8926, 8903, 8882, 
-        8859, 8838, 8818, 8805, 8791, 8780, 8770, 8762, 8755, 8747, 8737, 8728, 
-        8714, 8704, 8693, 8677, 8666, 8652, 8639, 8625, 8616, 8606, 8600, 8594, 
-        8589, 8583, 8579, 8573, 8567, 8564, 8560, 8554, 8550, 8540, 8535, 8529, 
-        8523, 8521, 8519, 8515, 8515, 8513, 8513, 8511, 8511, 8513, 8515, 8515, 
-        8515, 8515, 8517, 8517, 8519, 8519, 8523, 8525, 8531, 8535, 8538, 8542, 
-        8546, 8552, 8560, 8567, 8575, 8579, 8587, 8592, 8602, 8610, 8618, 8627, 
-        8637, 8647, 8654, 8664, 8675, 8685, 8697, 8706, 8718, 8726, 8735, 8747, 
-        8757, 8766, 8778, 8787, 8799, 8809, 8818, 8828, 8838, 8849, 8861, 8870, 
-        8880, 8892, 8901, 8911, 8921, 8932, 8942, 8953, 8963, 8973, 8982, 8992, 
-        9002, 9011, 9023, 9034, 9044, 9054, 9063, 9071, 9081, 9090, 9102, 9112, 
-        9123, 9131, 9141, 9148, 9158, 9168, 9177, 9187, 9197, 9206, 9214, 9224, 
-        9231, 9241, 9251, 9258, 9268, 9278, 9285, 9293, 9299, 9309, 9316, 9324, 
-        9334, 9339, 9347, 9357, 9363, 9372, 9380, 9388, 9395, 9403, 9409, 9417, 
-        9422, 9428, 9436, 9444, 9451, 9455, 9461, 9467, 9473, 9480, 9486, 9490, 
-        9498, 9504, 9509, 9513, 9519, 9525, 9531, 9534, 9538, 9544, 8112, 2323, 
-        -7091, -14848, -17697, -16904, -15178, -14169, -14061, -14333, -14528, -14514, -14371, -14221, 
-        -14117, -14051, -13993, -13933, -13864, -13792, -13719, -13653, -13588, -13524, -13462, -13402, 
-        -13343, -13285, -13225, -13169, -13113, -13059, -13007, -12955, -12904, -12854, -12804, -12756, 
-        -12709, -12663, -12619, -12576, -12532, -12489, -12449, -12410, -12370, -12333, -12294, -12260, 
-        -12223, -12190, -12154, -12121, -12090, -12059, -12030, -11999, -11970, -11941, -11914, -11887, 
-        -11862, -11837, -11814, -11789, -11768, -11744, -11723, -11700, -11681, -11663, -11644, -11625, 
-        -11607, -11592, -11576, -11559, -11544, -11528, -11517, -11501, -11492, -11478, -11466, -11455, 
-        -11443, -11436, -11424, -11416, -11407, -11399, -11389, -11382, -11374, -11366, -11360, -11353, 
-        -11347, -11339, -11333, -11326, -11320, -11314, -11308, -11304, -11300, -11295, -11291, -11287, 
-        -11281, -11279, -11275, -11272, -11272, -11268, -11264, -11262, -11260, -11258, -11256, -11256, 
-        -11256, -11254, -11254, -11254, -11254, -11254, -11256, -11256, -11256, -11258, -11258, -11260, 
-        -11264, -11264, -11268, -11270, -11273, -11277, -11277, -11281, -11285, -11289, -11295, -11299, 
-        -11304, -11308, -11312, -11318, -11322, -11327, -11333, -11341, -11347, -11353, -11358, -11366, 
-        -11372, -11380, -11389, -11397, -11405, -11412, -11420, -11428, -11438, -11447, -11455, -11465, 
-        -11476, -11486, -11493, -11505, -11515, -11526, -11536, -11548, -11557, -11569, -11580, -11592, 
-        -11604, -11615, -11629, -11640, -11654, -11667, -11679, -11692, -11704, -11719, -11733, -11748, 
-        -11762, -11777, -11791, -11802, -11818, -11833, -11849, -11866, -11881, -11897, -11912, -11928, 
-        -11943, -11961, -11980, -11995, -12011, -12028, -12044, -12063, -12080, -12098, -12117, -12136, 
-        -12154, -12171, -12190, -12208, -12227, -12246, -12266, -12287, -12306, -12325, -12345, -12364, 
-        -12385, -12405, -12426, -12447, -12470, -12489, -12511, -12532, -12551, -12574, -12598, -12619, 
-        -12642, -12663, -12684, -12708, -12731, -12754, -12777, -12800, -12823, -12847, -12870, -12893, 
-        -12918, -12941, -12966, -12991, -13016, -13040, -13063, -13088, -13096, -13148, -13146, -13217, 
-        -13194, -13246, -13287, -13213, -13466, -13103, -13729, -12895, -14097, -12516, -14941, -8787 
-    };
-
-    // AKWF_blended_0065 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0065[600] PROGMEM = {
-        11, 88, 166, 245, 321, 400, 480, 560, 639, 717, 797, 877, 
-        957, 1036, 1119, 1199, 1279, 1359, 1439, 1519, 1601, 1681, 1761, 1843, 
-        1923, 2005, 2083, 2165, 2245, 2328, 2408, 2492, 2573, 2656, 2738, 2820, 
-        2903, 2986, 3071, 3155, 3239, 3323, 3408, 3493, 3577, 3662, 3747, 3834, 
-        3920, 4007, 4093, 4180, 4264, 4351, 4439, 4527, 4617, 4705, 4793, 4879, 
-        4968, 5057, 5144, 5235, 5325, 5414, 5504, 5594, 5683, 5773, 5864, 5956, 
-        6047, 6140, 6231, 6321, 6414, 6507, 6600, 6692, 6785, 6878, 6971, 7062, 
-        7157, 7250, 7344, 7439, 7535, 7629, 7724, 7818, 7913, 8007, 8105, 8201, 
-        8299, 8393, 8489, 8585, 8683, 8779, 8877, 8975, 9074, 9172, 9269, 9367, 
-        9466, 9564, 9663, 9763, 9864, 9961, 10061, 10160, 10261, 10360, 10461, 10562, 
-        10664, 10765, 10866, 10967, 11070, 11170, 11273, 11375, 11478, 11580, 11683, 11787, 
-        11888, 11992, 12096, 12202, 12306, 12410, 12516, 12618, 12724, 12828, 12934, 13039, 
-        13145, 13252, 13357, 13464, 13570, 13675, 13784, 13891, 13999, 14106, 14215, 14322, 
-        14430, 14537, 14646, 14755, 14865, 14974, 15083, 15192, 15301, 15411, 15522, 15632, 
-        15744, 15855, 15965, 16076, 16187, 16299, 16412, 16523, 16637, 16749, 16861, 16973, 
-        17085, 17199, 17314, 17428, 17543, 17655, 17770, 17884, 17998, 18113, 18230, 18345, 
-        18462, 18576, 18691, 18808, 18924, 19040, 19157, 19274, 19393, 19511, 19630, 19748, 
-        19864, 19981, 20099, 20218, 20335, 20451, 20568, 20684, 20801, 20916, 21033, 21150, 
-        21267, 21384, 21497, 21613, 21726, 21840, 21955, 22069, 22183, 22295, 22407, 22517, 
-        22626, 22739, 22849, 22960, 23068, 23179, 23288, 23395, 23502, 23611, 23717, 23824, 
-        23930, 24036, 24141, 24246, 24348, 24452, 24555, 24660, 24763, 24865, 24966, 25066, 
-        25168, 25267, 25368, 25468, 25567, 25665, 25764, 25860, 25956, 26054, 26151, 26246, 
-        26342, 26438, 26533, 26626, 26720, 26813, 26904, 26999, 27090, 27181, 27273, 27361, 
-        27452, 27542, 27631, 27719, 27811, 27899, 27985, 28073, 28158, 28245, 28330, 28416, 
-        28503, 28587, 28669, 28752, 28836, 28919, 29001, 29084, 29166, 29247, 29329, 29407, 
-        29487, 29568, 29646, 29725, 29803, 27364, 17272, 795, -12801, -17785, -16369, -13308, 
-        -11507, -11289, -11742, -12061, -12008, -11728, -11431, -11214, -11063, -10932, -11979, -16630, 
-        -24281, -30557, -32767, -31959, -30378, -29393, -29153, -29231, -29246, -29090, -28828, -28559, 
-        -28328, -28131, -27944, -27755, -27558, -27361, -27164, -26970, -26782, -26593, -26409, -26225, 
-        -26044, -25865, -25684, -25508, -25331, -25157, -24986, -24816, -24648, -24478, -24313, -24148, 
-        -23986, -23824, -23664, -23506, -23349, -23195, -23040, -22887, -22737, -22585, -22437, -22290, 
-        -22146, -22000, -21856, -21714, -21573, -21432, -21294, -21156, -21020, -20885, -20753, -20618, 
-        -20487, -20357, -20227, -20099, -19971, -19844, -19720, -19595, -19471, -19346, -19223, -19103, 
-        -18980, -18860, -18739, -18619, -18499, -18382, -18265, -18147, -18030, -17915, -17798, -17682, 
-        -17567, -17453, -17338, -17226, -17114, -17002, -16888, -16774, -16664, -16552, -16441, -16329, 
-        -16220, -16108, -15999, -15887, -15778, -15668, -15560, -15450, -15342, -15234, -15126, -15019, 
-        -14908, -14803, -14697, -14590, -14484, -14378, -14273, -14165, -14061, -13956, -13850, -13747, 
-        -13642, -13539, -13435, -13331, -13227, -13124, -13022, -12921, -12818, -12718, -12615, -12514, 
-        -12413, -12311, -12211, -12111, -12011, -11912, -11811, -11712, -11612, -11513, -11415, -11316, 
-        -11218, -11121, -11023, -10925, -10828, -10732, -10634, -10538, -10442, -10347, -10251, -10157, 
-        -10059, -9964, -9870, -9775, -9683, -9588, -9494, -9399, -9306, -9212, -9119, -9026, 
-        -8935, -8843, -8750, -8659, -8566, -8475, -8384, -8294, -8203, -8113, -8022, -7930, 
-        -7841, -7751, -7661, -7573, -7484, -7394, -7307, -7216, -7128, -7040, -6953, -6867, 
-        -6777, -6691, -6604, -6516, -6430, -6343, -6257, -6172, -6085, -5999, -5914, -5829, 
-        -5741, -5658, -5575, -5490, -5406, -5321, -5237, -5153, -5068, -4984, -4902, -4819, 
-        -4737, -4654, -4570, -4489, -4404, -4322, -4240, -4159, -4079, -3997, -3915, -3832, 
-        -3752, -3670, -3589, -3509, -3428, -3350, -3270, -3188, -3108, -3028, -2950, -2871, 
-        -2791, -2713, -2632, -2552, -2474, -2395, -2315, -2238, -2160, -2082, -2003, -1926, 
-        -1848, -1769, -1691, -1614, -1535, -1459, -1380, -1302, -1225, -1146, -1071, -992, 
-        -916, -839, -762, -685, -606, -530, -451, -374, -297, -221, -142, -65 
-    };
-
-    // AKWF_blended_0066 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0066[600] PROGMEM = {
-        846, 1759, 2596, 3365, 4076, 4735, 5346, 5919, 6455, 6960, 7436, 7891, 
-        8323, 8737, 9132, 9516, 9886, 10244, 10593, 10933, 11266, 11595, 11914, 12229, 
-        12541, 12849, 13152, 13454, 13754, 14051, 14346, 14637, 14929, 15221, 15512, 15799, 
-        16087, 16374, 16661, 16947, 17235, 17522, 17807, 18094, 18380, 18666, 18952, 19238, 
-        19525, 19811, 20097, 20383, 20670, 20956, 21242, 21529, 21817, 22103, 22390, 22676, 
-        22962, 23248, 23534, 23820, 24104, 24390, 24674, 24960, 25241, 25522, 25805, 26085, 
-        26363, 26641, 26914, 27189, 27459, 27729, 27994, 28256, 28516, 28768, 29021, 29267, 
-        29507, 29741, 29970, 30190, 30401, 30605, 30799, 30981, 31152, 31310, 31453, 31581, 
-        31690, 31782, 31851, 31899, 31937, 31970, 32003, 32035, 32066, 32098, 32128, 32156, 
-        32185, 32212, 32240, 32265, 32292, 32317, 32343, 32366, 32388, 32412, 32433, 32455, 
-        32475, 32493, 32513, 32531, 32550, 32565, 32581, 32598, 32613, 32629, 32640, 32654, 
-        32665, 32677, 32689, 32698, 32706, 32715, 32723, 32731, 32737, 32744, 32750, 32755, 
-        32758, 32761, 32764, 32764, 32766, 32767, 32767, 32766, 32764, 32764, 32761, 32758, 
-        32755, 32750, 32744, 32737, 32731, 32723, 32715, 32706, 32698, 32689, 32677, 32665, 
-        32654, 32640, 32629, 32613, 32598, 32581, 32565, 32550, 32531, 32513, 32493, 32475, 
-        32455, 32433, 32412, 32388, 32366, 32343, 32317, 32294, 32265, 32240, 32212, 32185, 
-        32156, 32128, 32098, 32066, 32035, 32003, 31970, 31937, 31899, 31851, 31782, 31690, 
-        31581, 31453, 31310, 31153, 30981, 30799, 30605, 30401, 30190, 29970, 29741, 29507, 
-        29267, 29021, 28768, 28516, 28256, 27994, 27729, 27459, 27189, 26914, 26641, 26364, 
-        26085, 25805, 25524, 25243, 24960, 24676, 24391, 24106, 23821, 23537, 23250, 22964, 
-        22678, 22393, 22106, 21820, 21534, 21247, 20962, 20677, 20391, 20105, 19820, 19536, 
-        19250, 18966, 18682, 18399, 18115, 17832, 17549, 17266, 16984, 16703, 16421, 16140, 
-        15859, 15580, 15300, 15019, 14738, 14460, 14180, 13901, 13623, 13345, 13067, 12789, 
-        12511, 12234, 11956, 11678, 11402, 11125, 10851, 10573, 10298, 10021, 9747, 9472, 
-        9195, 8919, 8644, 8369, 8094, 7647, 6695, 5283, 3808, 2467, 1254, 154, 
-        -846, -1759, -2596, -3365, -4076, -4735, -5346, -5919, -6455, -6960, -7436, -7891, 
-        -8323, -8737, -9132, -9516, -9886, -10244, -10593, -10933, -11266, -11595, -11914, -12229, 
-        -12541, -12849, -13152, -13454, -13754, -14051, -14346, -14637, -14929, -15221, -15512, -15799, 
-        -16087, -16374, -16661, -16947, -17235, -17522, -17807, -18094, -18380, -18666, -18952, -19238, 
-        -19525, -19811, -20097, -20383, -20670, -20956, -21242, -21529, -21817, -22103, -22390, -22676, 
-        -22962, -23248, -23535, -23820, -24104, -24390, -24674, -24960, -25241, -25522, -25805, -26085, 
-        -26363, -26641, -26914, -27189, -27459, -27729, -27994, -28256, -28516, -28768, -29021, -29267, 
-        -29507, -29741, -29970, -30190, -30401, -30605, -30799, -30981, -31153, -31310, -31453, -31581, 
-        -31690, -31782, -31851, -31899, -31937, -31970, -32003, -32035, -32066, -32098, -32128, -32156, 
-        -32185, -32212, -32240, -32265, -32294, -32317, -32343, -32366, -32388, -32412, -32433, -32455, 
-        -32475, -32493, -32513, -32531, -32550, -32565, -32581, -32598, -32613, -32629, -32640, -32654, 
-        -32665, -32677, -32689, -32698, -32706, -32715, -32723, -32731, -32737, -32744, -32750, -32755, 
-        -32758, -32761, -32764, -32764, -32766, -32767, -32767, -32766, -32764, -32764, -32761, -32758, 
-        -32755, -32750, -32744, -32737, -32731, -32723, -32715, -32706, -32698, -32689, -32677, -32665, 
-        -32654, -32640, -32629, -32613, -32598, -32581, -32565, -32550, -32531, -32513, -32493, -32475, 
-        -32455, -32433, -32412, -32388, -32366, -32343, -32317, -32292, -32265, -32240, -32212, -32185, 
-        -32156, -32128, -32098, -32066, -32035, -32003, -31970, -31937, -31899, -31851, -31782, -31690, 
-        -31581, -31453, -31310, -31152, -30981, -30799, -30605, -30401, -30190, -29970, -29741, -29507, 
-        -29267, -29021, -28768, -28516, -28256, -27994, -27729, -27459, -27189, -26914, -26641, -26364, 
-        -26085, -25805, -25524, -25243, -24960, -24676, -24391, -24106, -23821, -23535, -23250, -22964, 
-        -22678, -22393, -22106, -21820, -21534, -21247, -20962, -20677, -20391, -20105, -19820, -19536, 
-        -19250, -18966, -18682, -18399, -18115, -17832, -17549, -17266, -16984, -16703, -16421, -16140, 
-        -15859, -15580, -15300, -15019, -14738, -14460, -14180, -13901, -13623, -13345, -13067, -12789, 
-        -12511, -12234, -11956, -11678, -11402, -11125, -10851, -10573, -10298, -10021, -9747, -9472, 
-        -9195, -8919, -8644, -8369, -8094, -7647, -6695, -5283, -3808, -2467, -1254, -154 
-    };
-
-    // AKWF_blended_0067 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0067[600] PROGMEM = {
-        20, 95, 172, 249, 329, 409, 491, 576, 661, 749, 839, 929, 
-        1019, 1115, 1207, 1305, 1403, 1503, 1604, 1704, 1810, 1916, 2024, 2132, 
-        2243, 2353, 2467, 2583, 2698, 2817, 2938, 3059, 3180, 3306, 3432, 3559, 
-        3687, 3819, 3950, 4084, 4218, 4354, 4493, 4635, 4774, 4918, 5063, 5209, 
-        5356, 5503, 5655, 5807, 5959, 6113, 6270, 6427, 6587, 6749, 6909, 7074, 
-        7239, 7406, 7573, 7743, 7913, 8086, 8258, 8434, 8611, 8789, 8967, 9147, 
-        9330, 9513, 9698, 9883, 10071, 10259, 10450, 10641, 10834, 11027, 11223, 11418, 
-        11617, 11815, 12016, 12217, 12420, 12624, 12827, 13033, 13242, 13450, 13659, 13870, 
-        14081, 14295, 14509, 14725, 14941, 15158, 15377, 15595, 15817, 16038, 16260, 16484, 
-        16708, 16935, 17161, 17388, 17617, 17846, 18078, 18307, 18542, 18773, 19008, 19242, 
-        19476, 19713, 19950, 20190, 20429, 20666, 20908, 21148, 21390, 21632, 21877, 22119, 
-        22363, 22608, 22855, 23100, 23350, 23597, 23844, 24091, 24341, 24591, 24841, 25093, 
-        25343, 25595, 25848, 26100, 26352, 26605, 26860, 27115, 27370, 27622, 27880, 28135, 
-        28390, 28644, 28902, 29160, 29417, 29672, 29930, 30187, 30445, 30702, 30960, 31217, 
-        31477, 31735, 31992, 32250, 32510, 32767, -32729, -32471, -32211, -31954, -31696, -31439, 
-        -31179, -30921, -30663, -30406, -30148, -29893, -29633, -29378, -29121, -28866, -28608, -28353, 
-        -28099, -27844, -27589, -27334, -27079, -26826, -26571, -26319, -26067, -25814, -25562, -25312, 
-        -25060, -24810, -24560, -24313, -24063, -23816, -23566, -23321, -23074, -22827, -22582, -22338, 
-        -22095, -21851, -21609, -21367, -21127, -20888, -20648, -20409, -20169, -19935, -19695, -19461, 
-        -19227, -18992, -18760, -18526, -18297, -18065, -17836, -17607, -17380, -17154, -16929, -16703, 
-        -16479, -16257, -16036, -15817, -15595, -15377, -15160, -14944, -14728, -14514, -14300, -14089, 
-        -13878, -13669, -13461, -13252, -13049, -12842, -12636, -12436, -12235, -12034, -11836, -11637, 
-        -11442, -11246, -11053, -10860, -10669, -10478, -10290, -10102, -9917, -9732, -9549, -9366, 
-        -9186, -9008, -8830, -8652, -8477, -8305, -8132, -7962, -7792, -7625, -7458, -7293, 
-        -7130, -6968, -6806, -6649, -6489, -6332, -6178, -6026, -5874, -5724, -5575, -5426, 
-        -5281, -5137, -4993, -4854, -4712, -4576, -4439, -4303, -4169, -4038, -3906, -3777, 
-        -3651, -3525, -3401, -3278, -3157, -3036, -2917, -2801, -2686, -2572, -2461, -2351, 
-        -2243, -2134, -2029, -1926, -1823, -1720, -1622, -1524, -1429, -1334, -1238, -1148, 
-        -1058, -970, -880, -795, -713, -630, -548, -468, -391, -316, -242, -167, 
-        -95, -25, 43, 110, 177, 242, 303, 365, 427, 484, 540, 597, 
-        651, 703, 754, 803, 852, 901, 945, 988, 1032, 1073, 1115, 1153, 
-        1189, 1225, 1261, 1295, 1326, 1357, 1385, 1413, 1439, 1465, 1488, 1514, 
-        1534, 1555, 1573, 1591, 1609, 1622, 1637, 1650, 1663, 1673, 1684, 1691, 
-        1699, 1704, 1709, 1712, 1715, 1717, 1717, 1717, 1717, 1715, 1712, 1707, 
-        1702, 1694, 1686, 1679, 1668, 1658, 1648, 1637, 1622, 1609, 1594, 1578, 
-        1563, 1545, 1527, 1509, 1488, 1470, 1447, 1426, 1403, 1380, 1357, 1331, 
-        1308, 1282, 1254, 1228, 1200, 1171, 1143, 1112, 1081, 1053, 1022, 988, 
-        958, 924, 893, 860, 824, 790, 757, 721, 685, 648, 615, 579, 
-        540, 504, 466, 430, 391, 355, 316, 278, 239, 200, 162, 123, 
-        84, 46, 7, -30, -69, -108, -149, -187, -226, -265, -303, -342, 
-        -383, -419, -458, -497, -535, -574, -610, -648, -687, -723, -759, -795, 
-        -834, -870, -906, -939, -976, -1009, -1045, -1079, -1112, -1143, -1176, -1210, 
-        -1241, -1272, -1303, -1331, -1362, -1390, -1418, -1447, -1473, -1501, -1527, -1552, 
-        -1576, -1599, -1622, -1645, -1668, -1689, -1707, -1728, -1748, -1766, -1782, -1797, 
-        -1813, -1828, -1841, -1856, -1867, -1879, -1890, -1897, -1905, -1913, -1921, -1926, 
-        -1931, -1934, -1936, -1939, -1936, -1936, -1936, -1934, -1928, -1923, -1918, -1910, 
-        -1903, -1892, -1882, -1869, -1856, -1841, -1828, -1810, -1792, -1774, -1753, -1730, 
-        -1709, -1684, -1658, -1632, -1604, -1576, -1545, -1511, -1480, -1444, -1408, -1372, 
-        -1334, -1292, -1251, -1210, -1164, -1120, -1073, -1024, -973, -921, -870, -816, 
-        -762, -703, -643, -584, -525, -460, -396, -329, -262, -195, -123, -51 
-    };
-
-    // AKWF_blended_0068 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0068[600] PROGMEM = {
-        43, 239, 435, 633, 834, 1037, 1243, 1452, 1661, 1872, 2088, 2304, 
-        2521, 2742, 2964, 3190, 3414, 3644, 3875, 4107, 4344, 4578, 4818, 5057, 
-        5302, 5544, 5791, 6039, 6291, 6543, 6796, 7051, 7308, 7568, 7831, 8094, 
-        8356, 8624, 8892, 9162, 9433, 9706, 9981, 10259, 10538, 10816, 11096, 11380, 
-        11666, 11951, 12237, 12528, 12817, 13108, 13401, 13697, 13994, 14290, 14589, 14890, 
-        15191, 15492, 15796, 16100, 16409, 16716, 17025, 17334, 17645, 17957, 18271, 18585, 
-        18900, 19216, 19533, 19852, 20169, 20491, 20813, 21135, 21457, 21779, 22106, 22430, 
-        22755, 23082, 23409, 23739, 24066, 24395, 24725, 25057, 25387, 25719, 26051, 26383, 
-        26718, 27050, 27385, 27720, 28055, 28390, 28724, 29062, 29396, 29734, 30069, 30406, 
-        30743, 31081, 31418, 31755, 32093, 32430, 32767, -32649, -32312, -31974, -31637, -31300, 
-        -30962, -30625, -30287, -29953, -29615, -29281, -28943, -28608, -28274, -27939, -27604, -27269, 
-        -26937, -26602, -26270, -25938, -25606, -25276, -24944, -24614, -24284, -23957, -23628, -23301, 
-        -22976, -22649, -22325, -22000, -21676, -21351, -21032, -20710, -20391, -20071, -19752, -19435, 
-        -19118, -18804, -18490, -18176, -17864, -17553, -17244, -16935, -16628, -16322, -16018, -15711, 
-        -15410, -15109, -14807, -14509, -14213, -13916, -13623, -13329, -13036, -12747, -12456, -12170, 
-        -11884, -11599, -11315, -11035, -10756, -10478, -10200, -9927, -9654, -9381, -9111, -8843, 
-        -8578, -8313, -8050, -7787, -7530, -7272, -7015, -6762, -6510, -6260, -6010, -5763, 
-        -5521, -5279, -5037, -4797, -4560, -4326, -4094, -3865, -3633, -3409, -3183, -2961, 
-        -2740, -2523, -2307, -2093, -1879, -1671, -1462, -1256, -1055, -852, -654, -458, 
-        -262, -69, 121, 309, 491, 677, 857, 1037, 1212, 1388, 1558, 1728, 
-        1897, 2062, 2225, 2384, 2544, 2698, 2853, 3002, 3152, 3298, 3443, 3584, 
-        3723, 3860, 3994, 4128, 4256, 4385, 4509, 4632, 4751, 4872, 4985, 5099, 
-        5209, 5317, 5426, 5529, 5629, 5727, 5825, 5920, 6010, 6100, 6188, 6270, 
-        6353, 6433, 6510, 6587, 6659, 6729, 6798, 6863, 6927, 6986, 7045, 7102, 
-        7156, 7208, 7257, 7306, 7349, 7393, 7432, 7470, 7506, 7540, 7571, 7602, 
-        7628, 7653, 7674, 7694, 7712, 7728, 7741, 7754, 7764, 7769, 7774, 7779, 
-        7779, 7777, 7774, 7769, 7761, 7751, 7741, 7728, 7712, 7694, 7674, 7653, 
-        7630, 7604, 7576, 7548, 7517, 7486, 7450, 7414, 7375, 7334, 7293, 7249, 
-        7203, 7156, 7107, 7056, 7004, 6950, 6894, 6837, 6778, 6716, 6657, 6592, 
-        6525, 6458, 6391, 6322, 6250, 6178, 6103, 6028, 5951, 5874, 5794, 5711, 
-        5632, 5547, 5462, 5377, 5289, 5202, 5111, 5021, 4931, 4836, 4743, 4648, 
-        4553, 4455, 4357, 4256, 4156, 4058, 3955, 3852, 3749, 3644, 3538, 3432, 
-        3327, 3219, 3110, 3002, 2892, 2781, 2670, 2559, 2449, 2335, 2222, 2109, 
-        1995, 1879, 1766, 1650, 1534, 1418, 1303, 1184, 1068, 952, 834, 715, 
-        597, 481, 363, 244, 126, 10, -108, -226, -345, -463, -582, -700, 
-        -818, -937, -1053, -1171, -1287, -1406, -1521, -1637, -1753, -1869, -1985, -2098, 
-        -2214, -2328, -2441, -2554, -2665, -2778, -2892, -3002, -3110, -3221, -3329, -3438, 
-        -3546, -3651, -3757, -3862, -3968, -4071, -4174, -4277, -4377, -4478, -4576, -4674, 
-        -4772, -4867, -4962, -5055, -5148, -5240, -5333, -5420, -5508, -5596, -5683, -5766, 
-        -5851, -5933, -6013, -6093, -6170, -6247, -6324, -6399, -6469, -6541, -6610, -6680, 
-        -6744, -6811, -6876, -6937, -6997, -7056, -7112, -7169, -7223, -7275, -7326, -7375, 
-        -7421, -7468, -7512, -7553, -7594, -7633, -7669, -7702, -7736, -7767, -7797, -7823, 
-        -7849, -7872, -7895, -7913, -7931, -7947, -7960, -7973, -7980, -7988, -7993, -7998, 
-        -7998, -7998, -7993, -7991, -7983, -7973, -7960, -7947, -7931, -7913, -7893, -7872, 
-        -7846, -7821, -7790, -7759, -7725, -7692, -7651, -7612, -7568, -7525, -7478, -7427, 
-        -7375, -7321, -7264, -7205, -7146, -7082, -7017, -6948, -6878, -6806, -6729, -6654, 
-        -6572, -6489, -6407, -6319, -6229, -6136, -6044, -5948, -5848, -5748, -5645, -5536, 
-        -5428, -5317, -5204, -5091, -4972, -4851, -4728, -4604, -4475, -4347, -4213, -4079, 
-        -3942, -3803, -3662, -3517, -3371, -3221, -3072, -2917, -2763, -2603, -2443, -2281, 
-        -2116, -1946, -1779, -1606, -1431, -1256, -1076, -896, -713, -525, -339, -149 
-    };
-
-    // AKWF_blended_0069 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0069[600] PROGMEM = {
-        10, 236, 464, 691, 919, 1145, 1372, 1600, 1826, 2053, 2279, 2504, 
-        2730, 2955, 3182, 3406, 3631, 3854, 4079, 4302, 4523, 4746, 4968, 5189, 
-        5410, 5630, 5850, 6068, 6285, 6503, 6720, 6936, 7152, 7365, 7579, 7792, 
-        8003, 8216, 8426, 8635, 8843, 9050, 9256, 9462, 9667, 9869, 10072, 10273, 
-        10474, 10671, 10869, 11066, 11260, 11456, 11649, 11839, 12030, 12219, 12406, 12592, 
-        12777, 12961, 13142, 13322, 13503, 13680, 13855, 14031, 14204, 14374, 14545, 14713, 
-        14880, 15045, 15209, 15370, 15531, 15689, 15845, 16000, 16154, 16305, 16453, 16601, 
-        16748, 16893, 17034, 17175, 17313, 17449, 17586, 17717, 17849, 17977, 18105, 18229, 
-        18352, 18473, 18592, 18709, 18823, 18936, 19048, 19155, 19263, 19366, 19469, 19569, 
-        19666, 19763, 19857, 19949, 20037, 20124, 20209, 20293, 20373, 20451, 20526, 20601, 
-        20672, 20742, 20807, 20873, 20935, 20994, 21054, 21108, 21161, 21212, 21261, 21307, 
-        21350, 21393, 21432, 21467, 21501, 21534, 21564, 21592, 21616, 21639, 21660, 21677, 
-        21692, 21706, 21716, 21725, 21731, 21735, 21735, 21735, 21731, 21725, 21716, 21706, 
-        21692, 21677, 21660, 21639, 21616, 21592, 21564, 21534, 21501, 21467, 21432, 21393, 
-        21350, 21307, 21261, 21212, 21161, 21108, 21054, 20994, 20935, 20873, 20807, 20740, 
-        20671, 20601, 20526, 20451, 20373, 20293, 20209, 20124, 20037, 19947, 19857, 19763, 
-        19666, 19569, 19469, 19366, 19263, 19155, 19046, 18936, 18823, 18709, 18592, 18473, 
-        18352, 18229, 18103, 17977, 17848, 17717, 17584, 17449, 17313, 17174, 17034, 16893, 
-        16748, 16601, 16453, 16303, 16152, 15999, 15844, 15687, 15529, 15369, 15207, 15044, 
-        14878, 14712, 14543, 14373, 14202, 14029, 13853, 13678, 13501, 13322, 13142, 12960, 
-        12776, 12590, 12405, 12217, 12028, 11838, 11645, 11453, 11259, 11065, 10867, 10670, 
-        10470, 10271, 10070, 9868, 9663, 9459, 9255, 9047, 8841, 8632, 8422, 8213, 
-        8002, 7789, 7576, 7361, 7147, 6932, 6716, 6500, 6282, 6064, 5844, 5625, 
-        5405, 5184, 4963, 4741, 4518, 4297, 4072, 3849, 3624, 3400, 3175, 2950, 
-        2724, 2497, 2271, 2046, 1818, 1591, 1363, 1137, 910, 682, 454, 228, 
-        -8650, -22743, -29599, -32241, -32767, -31998, -30707, -29051, -27358, -25595, -23931, -22288, 
-        -20776, -19312, -17975, -16697, -15531, -14422, -13416, -12464, -11603, -10791, -10058, -9376, 
-        -8759, -8191, -7680, -7212, -6796, -6418, -6086, -5790, -5533, -5308, -5121, -4959, 
-        -4830, -4726, -4649, -4596, -4566, -4557, -4569, -4598, -4646, -4709, -4789, -4883, 
-        -4990, -5109, -5240, -5381, -5533, -5695, -5863, -6040, -6224, -6415, -6612, -6813, 
-        -7021, -7232, -7447, -7665, -7888, -8112, -8337, -8567, -8797, -9028, -9260, -9493, 
-        -9728, -9961, -10196, -10430, -10661, -10894, -11126, -11357, -11586, -11814, -12040, -12265, 
-        -12488, -12711, -12929, -13147, -13361, -13574, -13785, -13993, -14199, -14402, -14601, -14800, 
-        -14994, -15187, -15376, -15561, -15745, -15926, -16103, -16276, -16448, -16617, -16782, -16944, 
-        -17100, -17257, -17408, -17558, -17705, -17846, -17986, -18122, -18255, -18386, -18512, -18634, 
-        -18754, -18871, -18983, -19094, -19201, -19305, -19406, -19503, -19596, -19688, -19775, -19860, 
-        -19942, -20019, -20093, -20165, -20233, -20299, -20362, -20420, -20477, -20529, -20579, -20626, 
-        -20669, -20710, -20747, -20781, -20814, -20841, -20866, -20889, -20909, -20926, -20938, -20950, 
-        -20957, -20962, -20963, -20963, -20958, -20952, -20943, -20929, -20914, -20897, -20875, -20853, 
-        -20826, -20797, -20764, -20730, -20693, -20654, -20611, -20565, -20517, -20466, -20414, -20359, 
-        -20299, -20240, -20175, -20110, -20041, -19971, -19898, -19821, -19743, -19661, -19579, -19492, 
-        -19404, -19314, -19222, -19126, -19029, -18929, -18827, -18723, -18616, -18508, -18396, -18284, 
-        -18168, -18050, -17929, -17809, -17684, -17558, -17431, -17299, -17168, -17034, -16898, -16760, 
-        -16618, -16477, -16332, -16186, -16038, -15888, -15737, -15583, -15428, -15272, -15112, -14952, 
-        -14790, -14625, -14460, -14291, -14122, -13952, -13780, -13607, -13431, -13254, -13075, -12895, 
-        -12713, -12531, -12347, -12159, -11974, -11785, -11594, -11403, -11211, -11017, -10821, -10625, 
-        -10428, -10229, -10029, -9829, -9626, -9423, -9219, -9013, -8807, -8599, -8392, -8182, 
-        -7971, -7760, -7549, -7334, -7121, -6907, -6692, -6476, -6258, -6040, -5822, -5604, 
-        -5385, -5163, -4944, -4722, -4501, -4278, -4055, -3832, -3609, -3384, -3160, -2935, 
-        -2710, -2484, -2259, -2032, -1806, -1580, -1353, -1125, -898, -672, -444, -217 
-    };
-
-    // AKWF_blended_0070 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0070[600] PROGMEM = {
-        250, 560, 871, 1182, 1494, 1806, 2118, 2430, 2740, 3053, 3364, 3674, 
-        3986, 4298, 4609, 4921, 5233, 5543, 5857, 6167, 6479, 6789, 7101, 7413, 
-        7725, 8036, 8347, 8658, 8970, 9282, 9592, 9904, 10216, 10526, 10840, 11150, 
-        11462, 11774, 12085, 12396, 12708, 13019, 13330, 13643, 13953, 14265, 14577, 14889, 
-        15199, 15511, 15823, 16133, 16445, 16757, 17069, 17380, 17692, 18003, 18314, 18626, 
-        18937, 19248, 19560, 19872, 20184, 20496, 20806, 21118, 21430, 21740, 22052, 22364, 
-        22675, 22987, 23299, 23609, 23921, 24233, 24543, 24855, 25167, 25479, 25789, 26102, 
-        26413, 26725, 27036, 27347, 27658, 27970, 28282, 28592, 28906, 29216, 29528, 29840, 
-        30150, 30462, 30774, 31085, 31396, 31708, 32019, 32331, -4734, -4423, -4112, -3800, 
-        -3488, -3178, -2864, -2554, -2242, -1930, -1620, -1308, -996, -685, -374, -61, 
-        248, 560, 872, 1182, 1494, 1806, 2118, 2428, 2740, 3052, 3364, 3675, 
-        3987, 4298, 4609, 4921, 5231, 5543, 5855, 6167, 6479, 6791, -30276, -29964, 
-        -29652, -29342, -29029, -28718, -28407, -28095, -27783, -27473, -27161, -26849, -26539, -26227, 
-        -25915, -25603, -25291, -24980, -24668, -24357, -24046, -23735, -23423, -23112, -22800, -22488, 
-        -22176, -21866, -21554, -21242, -20932, -20620, -20308, -19996, -19685, -19373, -19062, -18751, 
-        -18439, -18128, -17817, -17505, -17193, -16881, -16569, -16259, -15947, -15635, -15325, -15013, 
-        -14701, -14390, -14079, -13766, -13456, -13144, -12832, -12522, -12210, -11898, -11586, -11276, 
-        -10964, -10652, -10341, -10029, -9718, -9407, -9095, -8783, -8473, -8161, -7849, -7537, 
-        -7225, -6915, -6603, -6291, -5980, -5669, -5357, -5046, -4734, -4422, -4112, -3800, 
-        -3488, -3176, -2866, -2554, -2242, -1930, -1619, -1307, -996, -685, -373, -62, 
-        248, 560, 872, 1182, 1496, 1806, 2118, 2430, 2740, 3052, 3364, 3675, 
-        3986, 4299, -32767, -32456, -32144, -31834, -31522, -31210, -30898, -30586, -30274, -29964, 
-        -29652, -29341, -29030, -28718, -28407, -28095, -27784, -27471, -27161, -26849, -26537, -26227, 
-        -25915, -25603, -25291, -24981, -24668, -24357, -24046, -23734, -23423, -23112, -22800, -22488, 
-        -22178, -21866, -21554, -21242, -20930, -20620, -20308, -19996, -19685, -19374, -19062, -18751, 
-        -18439, -18127, -17817, -17505, -17193, -16881, -16571, -16259, -15947, -15635, -15324, -15013, 
-        -14701, -14390, -14078, -13768, -13456, -13144, -12832, -12522, -12210, -11898, -11586, -11274, 
-        -10964, -10652, -10341, -10029, -9718, -9405, -9095, -8783, -8471, -8161, -7849, -7537, 
-        -7225, -6915, -6603, -6291, -5980, -5668, -5357, -5046, -4734, -4422, -4112, -3800, 
-        -3488, -3178, -2864, -2554, -2242, -1930, -1619, -1308, -996, -685, -374, -61, 
-        248, 560, 872, 1184, 1494, 1806, 2118, 2428, 2740, 3052, 3364, 3675, 
-        3987, 4298, 4609, 4921, 5233, 5543, 5855, 6167, 6479, 6791, 7101, 7413, 
-        7725, 8036, 8347, 8658, 8970, 9282, 9594, 9904, 10216, 10528, 10840, 11150, 
-        11462, 11774, 12084, 12397, 12708, 13019, 13331, 13643, 13953, 14265, 14577, 14887, 
-        15201, 15511, 15823, 16135, 16446, 16757, 17069, 17380, 17691, 18003, 18314, 18626, 
-        18938, 19250, 19560, 19872, 20184, 20494, 20806, 21118, 21430, 21741, 22053, 22364, 
-        22675, 22987, 23298, 23609, 23921, 24233, 24545, 24857, 25167, 25479, -11586, -11276, 
-        -10964, -10652, -10341, -10029, -9717, -9407, -9095, -8783, -8473, -8161, -7849, -7537, 
-        -7225, -6914, -6603, -6291, -5980, -5669, -5357, -5046, -4734, -4422, -4110, -3800, 
-        -3488, -3176, -2864, -2554, -2242, -1930, -1619, -1307, -996, -685, -373, -61, 
-        248, 560, 872, 1182, 1496, 1806, 2118, 2430, 2741, 3052, 3364, 3675, 
-        3986, 4299, 4609, 4921, 5233, 5545, 5855, 6165, 6479, 6789, 7101, 7413, 
-        7725, 8036, 8348, 8658, 8969, 9282, 9592, 9904, 10216, 10528, 10840, 11152, 
-        11462, 11774, 12084, 12396, 12708, 13019, 13331, 13643, 13955, 14265, 14577, 14887, 
-        15199, 15511, 15823, 16135, 16445, 16758, 17069, 17380, 17691, 18003, 18314, 18626, 
-        18938, 19248, 19562, 19872, 20184, 20494, 20806, 21118, 21428, 21741, 22052, 22364, 
-        22675, 22987, -14079, -13768, -13456, -13144, -12832, -12522, -12208, -11898, -11586, -11274, 
-        -10964, -10652, -10341, -10029, -9718, -9405, -9095, -8783, -8471, -8161, -7849, -7537, 
-        -7225, -6915, -6603, -6291, -5980, -5668, -5356, -5046, -4735, -4422, -4112, -3800, 
-        -3488, -3176, -2864, -2553, -2242, -1932, -1619, -1308, -996, -685, -373, -61 
-    };
-
-    // AKWF_blended_0071 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0071[600] PROGMEM = {
-        10857, 25594, 25787, 25981, 26176, 26369, 26563, 26757, 26951, 27145, 27337, 27532, 
-        27726, 27921, 28113, 28308, 28502, 28696, 28890, 29084, 29277, 29471, 29666, 29858, 
-        30053, 30247, 30441, 30634, 30829, 31022, 31216, 31411, 31603, 31798, 31992, 32187, 
-        32379, 32574, 3683, 3877, 4072, 4265, 4459, 4653, 4847, 5041, 5235, 5428, 
-        5622, 5817, 6010, 6204, 6398, 6593, 6786, 6980, 7173, 7367, 7562, 7754, 
-        7949, 8143, 8338, 8531, 8725, 8919, 9112, 9307, 9499, 9694, 9888, 10083, 
-        10275, 10470, 10664, 10857, 11051, 11245, 11439, 11633, 11828, 12020, 12215, 12409, 
-        12603, 12796, 12990, 13184, 13378, 13572, 13765, 13960, 14154, 14349, 14541, 14735, 
-        14929, 15123, 15317, 15510, 15705, 15899, 16092, 16286, 16480, 16675, 16868, 17062, 
-        17255, 17450, 17644, 17838, 18031, 18226, 18420, 18613, 18807, 19001, 19195, 19389, 
-        19583, 19776, 19971, 20165, 20358, 20552, 20746, 20940, 21134, 21328, 21521, 21716, 
-        21910, 22103, 22297, 22491, 22685, 22879, 23073, 23266, 23461, 23655, 23848, 24042, 
-        24236, 24431, 24624, 24818, 25011, 25206, -3683, -3490, -3296, -3102, -2908, -2714, 
-        -2520, -2327, -2132, -1938, -1745, -1551, -1357, -1163, -969, -775, -582, -387, 
-        -193, 0, 193, 387, 582, 775, 969, 1163, 1357, 1551, 1745, 1938, 
-        2132, 2327, 2520, 2714, 2908, 3102, 3296, 3490, 3683, 3877, 4072, 4265, 
-        4459, 4653, 4847, 5041, 5235, 5428, 5622, 5817, 6010, 6204, 6398, 6593, 
-        6786, 6980, 7173, 7367, 7562, 7754, 7949, 8143, 8338, 8531, 8725, 8919, 
-        9112, 9307, 9499, 9694, 9888, 10083, 10275, 10470, 10664, 10858, 11051, 11245, 
-        11439, 11633, 11828, 12020, 12215, 12409, 12603, 12796, 12990, 13184, 13378, 13572, 
-        13765, 13960, 14154, 14349, 14541, 14735, 14929, 15123, 15317, 15510, 15705, 15899, 
-        16092, 16286, 16480, 16675, 16868, 17062, 17255, 17450, 17644, 17838, 18031, 18225, 
-        18420, 18613, 18807, 19001, 19195, 19389, 19583, 19776, 19971, 20165, 20358, 20552, 
-        20746, 20940, 21134, 21328, 21521, 21716, 21910, 22103, 22297, 22491, 22685, 22879, 
-        23073, 23266, 23461, 23655, 23848, 24042, 24236, 24431, 24624, 24818, 25011, 25206, 
-        10857, -3490, -3296, -3102, -2908, -2714, -2520, -2327, -2132, -1938, -1745, -1551, 
-        -1357, -1163, -969, -775, -582, -387, -193, 0, 193, 387, 582, 775, 
-        969, 1163, 1357, 1551, 1745, 1938, 2132, 2327, 2520, 2714, 2908, 3102, 
-        3296, 3490, -25400, -25206, -25011, -24818, -24624, -24431, -24236, -24042, -23848, -23655, 
-        -23461, -23266, -23073, -22879, -22685, -22491, -22297, -22103, -21910, -21716, -21521, -21328, 
-        -21134, -20940, -20746, -20552, -20358, -20165, -19971, -19776, -19583, -19389, -19195, -19001, 
-        -18807, -18613, -18420, -18226, -18031, -17838, -17644, -17450, -17255, -17062, -16868, -16675, 
-        -16480, -16286, -16092, -15899, -15705, -15510, -15317, -15123, -14929, -14735, -14541, -14349, 
-        -14154, -13960, -13765, -13572, -13378, -13184, -12990, -12796, -12603, -12409, -12215, -12020, 
-        -11828, -11633, -11439, -11245, -11051, -10857, -10664, -10470, -10275, -10083, -9888, -9694, 
-        -9499, -9307, -9112, -8919, -8725, -8531, -8338, -8143, -7949, -7754, -7562, -7367, 
-        -7173, -6980, -6786, -6593, -6398, -6204, -6010, -5817, -5622, -5428, -5235, -5041, 
-        -4847, -4653, -4459, -4265, -4072, -3877, -32767, -32574, -32379, -32187, -31992, -31798, 
-        -31603, -31411, -31216, -31022, -30829, -30634, -30441, -30247, -30053, -29858, -29666, -29471, 
-        -29277, -29084, -28890, -28696, -28502, -28308, -28113, -27921, -27726, -27532, -27337, -27145, 
-        -26951, -26757, -26563, -26369, -26176, -25981, -25787, -25594, -25400, -25206, -25011, -24818, 
-        -24624, -24431, -24236, -24042, -23848, -23655, -23461, -23266, -23073, -22879, -22685, -22491, 
-        -22297, -22103, -21910, -21716, -21521, -21328, -21134, -20940, -20746, -20552, -20358, -20165, 
-        -19971, -19776, -19583, -19389, -19195, -19001, -18807, -18613, -18420, -18225, -18031, -17838, 
-        -17644, -17450, -17255, -17062, -16868, -16675, -16480, -16286, -16092, -15899, -15705, -15510, 
-        -15317, -15123, -14929, -14735, -14541, -14349, -14154, -13960, -13765, -13572, -13378, -13184, 
-        -12990, -12796, -12603, -12409, -12215, -12020, -11828, -11633, -11439, -11245, -11051, -10858, 
-        -10664, -10470, -10275, -10083, -9888, -9694, -9499, -9307, -9112, -8919, -8725, -8531, 
-        -8338, -8143, -7949, -7754, -7562, -7367, -7173, -6980, -6786, -6593, -6398, -6204, 
-        -6010, -5817, -5622, -5428, -5235, -5041, -4847, -4653, -4459, -4265, -4072, -3877 
-    };
-
-    // AKWF_blended_0072 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0072[600] PROGMEM = {
-        8095, 20747, 21109, 21472, 21834, 22195, 22557, 22917, 23277, 23634, 23992, 24347, 
-        24702, 25055, 25407, 25757, 26104, 26450, 26793, 27135, 27475, 27811, 28144, 28476, 
-        28804, 29130, 29452, 29771, 30087, 30400, 30710, 31014, 31317, 31615, 31909, 32199, 
-        32487, 32767, 11362, 11637, 11906, 12170, 12429, 12685, 12935, 13181, 13422, 13657, 
-        13888, 14113, 14334, 14549, 14757, 14963, 15161, 15355, 15541, 15723, 15900, 16071, 
-        16236, 16394, 16549, 16696, 16839, 16973, 17103, 17227, 17345, 17456, 17562, 17661, 
-        17755, 17843, 17924, 17999, 18068, 18131, 18188, 18240, 18284, 18324, 18356, 18383, 
-        18405, 18418, 18427, 18430, 18427, 18418, 18403, 18383, 18358, 18326, 18289, 18245, 
-        18196, 18142, 18082, 18016, 17947, 17872, 17791, 17703, 17612, 17517, 17416, 17310, 
-        17199, 17084, 16965, 16840, 16711, 16578, 16440, 16299, 16152, 16002, 15849, 15691, 
-        15531, 15366, 15198, 15027, 14852, 14673, 14493, 14308, 14122, 13933, 13741, 13546, 
-        13349, 13151, 12949, 12745, 12542, 12335, 12126, 11916, 11704, 11492, 11278, 11063, 
-        10848, 10631, 10414, 10196, 9978, 9759, 9542, 9323, 9105, 8888, 8669, 8452, 
-        8237, 8019, 7806, 7592, 7378, 7168, 6958, 6749, 6542, 6337, 6134, 5933, 
-        5733, 5536, 5343, 5149, 4961, 4774, 4591, 4409, 4231, 4057, 3886, 3716, 
-        3553, 3391, 3233, 3080, 2930, 2786, 2643, 2506, 2372, 2244, 2119, 2000, 
-        1884, 1773, 1667, 1566, 1470, 1379, 1293, 1213, 1137, 1066, 1001, 942, 
-        888, 839, 795, 757, 726, 699, 679, 664, 656, 652, 656, 664, 
-        679, 699, 726, 760, 799, 844, 895, 952, 1014, 1085, 1160, 1241, 
-        1329, 1423, 1522, 1626, 1739, 1857, 1981, 2111, 2245, 2387, 2535, 2688, 
-        2848, 3013, 3183, 3359, 3543, 3729, 3923, 4121, 4327, 4535, 4751, 4971, 
-        5196, 5427, 5662, 5903, 6149, 6399, 6655, 6914, 7178, 7447, 7722, 7999, 
-        8280, 8568, 8857, 9152, 9450, 9752, 10059, 10366, 10679, 10996, 11315, 11638, 
-        11963, 12291, 12623, 12956, 13292, 13632, 13973, 14317, 14663, 15010, 15360, 15711, 
-        16065, 16420, 16775, 17133, 17490, 17850, 18210, 18571, 18933, 19295, 19658, 20020, 
-        8095, -3830, -3467, -3105, -2743, -2382, -2020, -1660, -1300, -942, -585, -230, 
-        124, 477, 829, 1179, 1525, 1872, 2215, 2557, 2897, 3233, 3566, 3898, 
-        4226, 4552, 4875, 5193, 5509, 5822, 6132, 6436, 6739, 7037, 7331, 7622, 
-        7908, 8191, -13215, -12940, -12671, -12407, -12148, -11892, -11642, -11396, -11155, -10920, 
-        -10689, -10464, -10244, -10028, -9820, -9614, -9416, -9222, -9036, -8852, -8676, -8506, 
-        -8341, -8183, -8028, -7880, -7739, -7604, -7473, -7350, -7232, -7121, -7015, -6916, 
-        -6822, -6734, -6653, -6578, -6509, -6446, -6389, -6337, -6293, -6253, -6221, -6194, 
-        -6172, -6159, -6150, -6147, -6150, -6159, -6174, -6194, -6219, -6251, -6288, -6332, 
-        -6381, -6435, -6495, -6559, -6630, -6706, -6786, -6874, -6965, -7061, -7161, -7267, 
-        -7378, -7493, -7612, -7737, -7866, -7999, -8137, -8279, -8425, -8575, -8728, -8886, 
-        -9046, -9211, -9379, -9550, -9725, -9904, -10084, -10267, -10456, -10644, -10836, -11031, 
-        -11228, -11426, -11628, -11830, -12035, -12242, -12451, -12661, -12873, -13085, -13299, -13514, 
-        -13730, -13947, -14164, -14381, -14599, -14816, -15035, -15254, -15472, -15690, -15908, -16125, 
-        -16341, -16558, -16771, -16985, -17199, -17409, -17619, -17828, -18035, -18240, -18444, -18644, 
-        -18844, -19041, -19234, -19428, -19616, -19803, -19986, -20168, -20345, -20520, -20691, -20860, 
-        -21024, -21186, -21342, -21497, -21647, -21792, -21935, -22071, -22204, -22333, -22458, -22577, 
-        -22693, -22804, -22910, -23011, -23107, -23198, -23284, -23365, -23440, -23511, -23577, -23635, 
-        -23689, -23738, -23782, -23819, -23851, -23878, -23898, -23913, -23921, -23925, -23921, -23913, 
-        -23898, -23876, -23851, -23817, -23778, -23733, -23683, -23625, -23563, -23492, -23417, -23336, 
-        -23249, -23154, -23055, -22949, -22838, -22720, -22596, -22466, -22332, -22189, -22042, -21887, 
-        -21729, -21564, -21393, -21216, -21034, -20848, -20654, -20456, -20250, -20042, -19827, -19606, 
-        -19381, -19150, -18915, -18674, -18428, -18178, -17922, -17663, -17399, -17130, -16855, -16578, 
-        -16295, -16009, -15720, -15425, -15126, -14825, -14519, -14211, -13898, -13581, -13262, -12939, 
-        -12614, -12286, -11955, -11620, -11283, -10945, -10604, -10260, -9914, -9567, -9217, -8866, 
-        -8512, -8157, -7802, -7444, -7086, -6727, -6367, -6006, -5644, -5281, -4919, -4555 
-    };
-
-    // AKWF_blended_0073 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0073[600] PROGMEM = {
-        6846, 20711, 21075, 21440, 21806, 22168, 22532, 22895, 23257, 23616, 23977, 24334, 
-        24691, 25046, 25398, 25749, 26099, 26447, 26792, 27134, 27475, 27812, 28146, 28479, 
-        28808, 29134, 29457, 29776, 30093, 30405, 30714, 31020, 31321, 31619, 31913, 32201, 
-        32486, 32767, 14705, 14977, 15244, 15505, 15763, 16016, 16264, 16506, 16744, 16975, 
-        17202, 17424, 17639, 17850, 18055, 18253, 18446, 18636, 18818, 18993, 19164, 19326, 
-        19485, 19637, 19784, 19923, 20057, 20185, 20305, 20421, 20529, 20632, 20727, 20818, 
-        20901, 20978, 21048, 21113, 21171, 21222, 21267, 21306, 21339, 21366, 21384, 21398, 
-        21405, 21407, 21402, 21391, 21373, 21348, 21319, 21283, 21241, 21193, 21140, 21079, 
-        21014, 20944, 20866, 20783, 20695, 20601, 20502, 20397, 20287, 20174, 20053, 19927, 
-        19797, 19662, 19523, 19377, 19227, 19074, 18915, 18753, 18587, 18414, 18239, 18060, 
-        17878, 17691, 17500, 17307, 17108, 16908, 16704, 16497, 16288, 16075, 15861, 15642, 
-        15421, 15199, 14973, 14746, 14517, 14286, 14054, 13819, 13583, 13347, 13109, 12869, 
-        12629, 12388, 12146, 11904, 11661, 11417, 11176, 10932, 10689, 10447, 10204, 9962, 
-        9722, 9481, 9243, 9005, 8767, 8532, 8298, 8065, 7834, 7605, 7378, 7153, 
-        6931, 6709, 6491, 6276, 6064, 5855, 5647, 5443, 5243, 5045, 4852, 4661, 
-        4473, 4291, 4113, 3938, 3765, 3599, 3435, 3278, 3123, 2975, 2829, 2690, 
-        2555, 2423, 2299, 2178, 2062, 1954, 1850, 1750, 1657, 1568, 1485, 1408, 
-        1337, 1273, 1211, 1159, 1110, 1069, 1033, 1002, 979, 961, 950, 944, 
-        946, 953, 966, 986, 1013, 1045, 1085, 1130, 1181, 1240, 1303, 1374, 
-        1451, 1534, 1624, 1720, 1823, 1933, 2046, 2167, 2295, 2428, 2569, 2715, 
-        2867, 3025, 3189, 3359, 3536, 3718, 3905, 4098, 4298, 4502, 4713, 4929, 
-        5151, 5377, 5609, 5847, 6089, 6336, 6588, 6846, 7108, 7376, 7647, 7923, 
-        8204, 8489, 8778, 9071, 9369, 9670, 9977, 10285, 10597, 10914, 11234, 11556, 
-        11883, 12211, 12544, 12878, 13215, 13556, 13899, 14245, 14591, 14941, 15293, 15646, 
-        16001, 16358, 16715, 17074, 17435, 17797, 18158, 18522, 18886, 19251, 19615, 19981, 
-        6846, -6287, -5921, -5557, -5193, -4829, -4466, -4104, -3741, -3381, -3022, -2665, 
-        -2308, -1952, -1599, -1249, -899, -551, -207, 135, 476, 813, 1148, 1480, 
-        1810, 2135, 2457, 2778, 3094, 3406, 3716, 4021, 4322, 4619, 4913, 5202, 
-        5487, 5768, -12294, -12022, -11755, -11493, -11235, -10983, -10734, -10492, -10254, -10024, 
-        -9796, -9575, -9358, -9147, -8943, -8743, -8550, -8363, -8181, -8006, -7834, -7670, 
-        -7513, -7360, -7214, -7075, -6942, -6814, -6691, -6578, -6469, -6367, -6271, -6181, 
-        -6098, -6020, -5948, -5885, -5827, -5775, -5730, -5692, -5660, -5633, -5613, -5600, 
-        -5591, -5591, -5597, -5607, -5626, -5649, -5680, -5716, -5757, -5804, -5858, -5918, 
-        -5984, -6055, -6132, -6215, -6302, -6396, -6495, -6601, -6709, -6825, -6945, -7070, 
-        -7202, -7337, -7476, -7620, -7770, -7923, -8082, -8246, -8411, -8583, -8758, -8938, 
-        -9120, -9308, -9497, -9692, -9890, -10090, -10294, -10500, -10711, -10923, -11138, -11356, 
-        -11576, -11800, -12025, -12252, -12481, -12712, -12945, -13179, -13415, -13652, -13890, -14129, 
-        -14369, -14611, -14853, -15094, -15338, -15579, -15823, -16066, -16308, -16551, -16793, -17034, 
-        -17276, -17516, -17756, -17994, -18232, -18466, -18701, -18933, -19164, -19393, -19620, -19846, 
-        -20067, -20287, -20506, -20722, -20935, -21144, -21351, -21555, -21755, -21952, -22147, -22338, 
-        -22523, -22707, -22886, -23061, -23232, -23400, -23562, -23721, -23874, -24024, -24170, -24309, 
-        -24444, -24574, -24700, -24819, -24934, -25044, -25149, -25248, -25342, -25430, -25513, -25589, 
-        -25661, -25726, -25785, -25840, -25888, -25930, -25966, -25995, -26018, -26036, -26047, -26052, 
-        -26052, -26045, -26031, -26011, -25986, -25953, -25913, -25868, -25818, -25758, -25695, -25623, 
-        -25547, -25463, -25373, -25277, -25174, -25066, -24952, -24830, -24704, -24570, -24429, -24283, 
-        -24132, -23973, -23809, -23638, -23463, -23281, -23093, -22900, -22700, -22496, -22285, -22069, 
-        -21847, -21620, -21389, -21151, -20910, -20661, -20408, -20152, -19889, -19622, -19352, -19076, 
-        -18794, -18509, -18219, -17927, -17630, -17328, -17022, -16713, -16400, -16084, -15765, -15442, 
-        -15116, -14786, -14454, -14119, -13781, -13441, -13098, -12754, -12406, -12058, -11706, -11353, 
-        -10997, -10640, -10283, -9924, -9564, -9201, -8839, -8476, -8112, -7748, -7382, -7018 
-    };
-
-    // AKWF_blended_0074 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0074[600] PROGMEM = {
-        80, 313, 545, 776, 1004, 1231, 1459, 1807, 1913, 2145, 2361, 2582, 
-        2800, 3014, 3230, 3444, 3655, 3867, 4078, 4285, 4494, 4698, 4903, 5105, 
-        5309, 5509, 5708, 5906, 6103, 6298, 6491, 6684, 6874, 7066, 7254, 7442, 
-        7628, 7813, 7996, 8178, 8361, 8541, 8718, 8896, 9072, 9246, 9422, 9592, 
-        9765, 9934, 10104, 10271, 8798, 5084, 4781, 5558, 5678, 5795, 6017, 6213, 
-        6394, 6578, 6763, 6946, 7127, 7306, 7482, 7658, 7828, 8003, 8173, 8340, 
-        8508, 8673, 8835, 8999, 9157, 9317, 9476, 9631, 9784, 9937, 10089, 10238, 
-        10388, 10536, 10682, 10827, 10972, 11113, 11254, 11393, 11530, 11668, 11806, 11938, 
-        12072, 12206, 12335, 12467, 12598, 12725, 12852, 12979, 13105, 13228, 13354, 13476, 
-        13597, 13718, 13838, 13956, 14075, 14193, 14308, 14423, 14538, 14651, 14762, 14874, 
-        14985, 15097, 15205, 15314, 15419, 15527, 15633, 15736, 15840, 15943, 16047, 16145, 
-        16248, 16347, 16446, 16544, 16639, 16737, 16833, 16925, 17019, 17113, 17205, 17296, 
-        17386, 17477, 17564, 17653, 17740, 17827, 17912, 17996, 18078, 18163, 18245, 18327, 
-        18407, 18487, 18565, 18644, 18722, 18799, 18874, 18950, 19025, 19096, 19171, 19243, 
-        19316, 19386, 19457, 19525, 19594, 19662, 19730, 19796, 19864, 19929, 19993, 20058, 
-        20119, 20183, 20246, 20307, 20364, 20425, 20484, 20537, 20596, 20657, 20704, 20758, 
-        19680, -3635, -13242, -12439, -12049, -11666, -11287, -10902, -10519, -10146, -9768, -9397, 
-        -9025, -8656, -8283, -7919, -7555, -7188, -6829, -6468, -6108, -5753, -5396, -5042, 
-        -4691, -4342, -3992, -3644, -3298, -2955, -2610, -2272, -1932, -1595, -1258, -924, 
-        -590, -261, 69, 397, 722, 1050, 1372, 1694, 2012, 2331, 2650, 2965, 
-        3278, 3592, 3902, 4212, 4520, 4826, 5131, 5434, 5739, 6038, 6338, 6634, 
-        6933, 7228, 7522, 7813, 8105, 8394, 8683, 8967, 9255, 9538, 9822, 10103, 
-        10383, 10662, 10940, 11215, 11490, 11764, 12035, 12307, 12577, 12843, 13112, 13376, 
-        13643, 13904, 14167, 14425, 14686, 14943, 15203, 15455, 15711, 15962, 16216, 16465, 
-        16716, 16963, 17209, 17456, 17700, 17956, 18043, 16047, 11416, 6566, 2746, -74, 
-        -2136, -3656, -4793, -5652, -6313, -6824, -7229, -7424, -7823, -8039, -8220, -8372, 
-        -8501, -8610, -8703, -8781, -8849, -8905, -8946, -8985, -9013, -9032, -9044, -9049, 
-        -9047, -9040, -9028, -9007, -8985, -8953, -8920, -8878, -8838, -8786, -8737, -8680, 
-        -8622, -8556, -8494, -8424, -8351, -8274, -8198, -8119, -8037, -7952, -7867, -7774, 
-        -7686, -7592, -7498, -7402, -8945, -12725, -13092, -12378, -12316, -12258, -12091, -11948, 
-        -11818, -11682, -11544, -11407, -11273, -11133, -10999, -10862, -10726, -10592, -10456, -10322, 
-        -10186, -10054, -9921, -9787, -9657, -9523, -9390, -9260, -9129, -9000, -8870, -8741, 
-        -8614, -8485, -8356, -8231, -8105, -7980, -7856, -7733, -7609, -7487, -7365, -7243, 
-        -7123, -7003, -6885, -6766, -6646, -6528, -6413, -6296, -6179, -6064, -5950, -5835, 
-        -5723, -5608, -5497, -5387, -5276, -5164, -5055, -4945, -4837, -4731, -4624, -4518, 
-        -4412, -4308, -4203, -4099, -3999, -3893, -3794, -3693, -3594, -3493, -3395, -3298, 
-        -3200, -3104, -3007, -2914, -2819, -2725, -2634, -2540, -2450, -2359, -2268, -2181, 
-        -2091, -2005, -1918, -1831, -1746, -1661, -1577, -1495, -1413, -1332, -1250, -1170, 
-        -1093, -1013, -936, -860, -781, -706, -632, -558, -485, -412, -339, -266, 
-        -198, -125, -57, 10, 78, 148, 214, 280, 344, 410, 473, 538, 
-        600, 659, 724, 785, 841, 903, 961, 1013, 1072, 1131, 1180, 1232, 
-        154, -23161, -32767, -31966, -31576, -31193, -30812, -30429, -30048, -29673, -29299, -28924, 
-        -28554, -28184, -27813, -27448, -27084, -26718, -26358, -25999, -25639, -25282, -24928, -24573, 
-        -24221, -23871, -23525, -23175, -22830, -22487, -22144, -21802, -21466, -21127, -20791, -20456, 
-        -20124, -19793, -19462, -19135, -18809, -18484, -18161, -17836, -17519, -17200, -16883, -16568, 
-        -16255, -15939, -15631, -15321, -15013, -14707, -14400, -14097, -13794, -13495, -13195, -12897, 
-        -12601, -12304, -12011, -11719, -11429, -11137, -10851, -10562, -10280, -9995, -9711, -9429, 
-        -9148, -8871, -8593, -8318, -8043, -7769, -7498, -7226, -6958, -6690, -6421, -6157, 
-        -5892, -5629, -5368, -5107, -4847, -4590, -4334, -4078, -3823, -3571, -3318, -3068, 
-        -2819, -2570, -2324, -2077, -1833, -1589, -1347, -1105, -865, -628, -388, -153 
-    };
-
-    // AKWF_blended_0075 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0075[600] PROGMEM = {
-        1848, 16078, 16143, 16208, 16275, 16340, 16406, 16471, 16536, 16603, 16668, 16733, 
-        16798, 16863, 16928, 16993, 17058, 17122, 17187, 17252, 17316, 17379, 17444, 17508, 
-        17573, 17637, 17701, 17764, 17828, 17892, 17956, 18019, 18083, 18147, 18211, 18273, 
-        18337, 18399, 17245, 14412, 14112, 14619, 14637, 14652, 14749, 14827, 14895, 14967, 
-        15040, 15111, 15183, 15255, 15325, 15397, 15469, 15539, 15609, 15680, 15749, 15819, 
-        15891, 15960, 16029, 16099, 16168, 16239, 16308, 16377, 16446, 16515, 16584, 16652, 
-        16722, 16791, 16860, 16928, 16997, 17066, 17134, 17203, 17270, 17341, 17410, 17478, 
-        17547, 17616, 17685, 17754, 17823, 17892, 17961, 18030, 18099, 18168, 18237, 18308, 
-        18377, 18446, 18516, 18585, 18654, 18724, 18794, 18864, 18934, 19003, 19074, 19144, 
-        19214, 19283, 19354, 19424, 19495, 19565, 19635, 19706, 19776, 19848, 19918, 19989, 
-        20060, 20131, 20202, 20273, 20344, 20416, 20488, 20558, 20631, 20703, 20775, 20846, 
-        20918, 20990, 21064, 21136, 21209, 21281, 21354, 21427, 21500, 21573, 21647, 21721, 
-        21794, 21869, 21942, 22016, 22092, 22166, 22241, 22315, 22392, 22466, 22543, -1878, 
-        -4440, -3674, -2789, -1974, -1233, -559, 57, 620, 1133, 1604, 2035, 2432, 
-        2799, 3136, 3449, 3739, 4010, 4260, 4497, 4719, 4928, 5128, 5316, 5497, 
-        5671, 5838, 6003, 6163, 6321, 6482, 6645, 6822, 7049, 7321, 7535, 7690, 
-        7831, 7964, 8089, 8207, 8321, 8430, 8536, 8638, 8738, 8836, 8932, 9025, 
-        9116, 9207, 9296, 9382, 9470, 9553, 9638, 9722, 9803, 9885, 9966, 10047, 
-        10127, 10205, 10283, 10362, 10439, 10516, 10593, 10670, 10746, 10821, 10896, 10971, 
-        11046, 11119, 11193, 11267, 11340, 11413, 11486, 11560, 11631, 11704, 11776, 11848, 
-        11919, 11992, 12063, 12133, 12205, 12277, 12347, 12417, 12488, 12558, 12627, 12697, 
-        12768, 12838, 12907, 12978, 13047, 13116, 13185, 13254, 13323, 13392, 13461, 13529, 
-        13598, 13667, 13734, 13802, 13871, 13939, 14007, 14076, 14143, 14210, 14279, 14345, 
-        14413, 14481, 14547, 14615, 14683, 14750, 14817, 14884, 14951, 15017, 15084, 15150, 
-        15218, 15284, 15350, 15417, 15483, 15550, 15616, 15681, 15747, 15814, 15880, 15945, 
-        1848, -12250, -12184, -12119, -12053, -11987, -11922, -11856, -11791, -11726, -11659, -11594, 
-        -11529, -11464, -11400, -11335, -11269, -11205, -11140, -11075, -11011, -10947, -10884, -10819, 
-        -10755, -10690, -10627, -10562, -10499, -10435, -10371, -10307, -10245, -10180, -10116, -10054, 
-        -9990, -9928, -11083, -13915, -14215, -13708, -13689, -13675, -13578, -13501, -13433, -13360, 
-        -13287, -13215, -13144, -13072, -13002, -12931, -12859, -12788, -12717, -12648, -12578, -12508, 
-        -12437, -12368, -12298, -12227, -12158, -12089, -12020, -11951, -11881, -11812, -11743, -11675, 
-        -11605, -11536, -11468, -11399, -11331, -11261, -11193, -11125, -11056, -10986, -10918, -10849, 
-        -10780, -10712, -10642, -10574, -10505, -10435, -10366, -10298, -10228, -10159, -10090, -10021, 
-        -9950, -9881, -9812, -9742, -9673, -9602, -9533, -9464, -9394, -9323, -9254, -9184, 
-        -9114, -9043, -8973, -8903, -8832, -8762, -8691, -8621, -8551, -8479, -8410, -8338, 
-        -8268, -8196, -8124, -8054, -7982, -7911, -7839, -7769, -7697, -7625, -7553, -7480, 
-        -7409, -7337, -7264, -7192, -7118, -7046, -6973, -6900, -6827, -6754, -6681, -6607, 
-        -6534, -6459, -6385, -6311, -6236, -6162, -6086, -6012, -5935, -5861, -5785, -30206, 
-        -32767, -32001, -31117, -30303, -29562, -28886, -28270, -27707, -27193, -26723, -26292, -25895, 
-        -25528, -25191, -24879, -24588, -24319, -24066, -23830, -23608, -23398, -23199, -23011, -22830, 
-        -22656, -22489, -22326, -22165, -22006, -21846, -21682, -21505, -21279, -21007, -20793, -20637, 
-        -20496, -20363, -20238, -20120, -20006, -19897, -19792, -19690, -19589, -19492, -19396, -19303, 
-        -19210, -19121, -19031, -18945, -18859, -18774, -18689, -18605, -18524, -18442, -18361, -18281, 
-        -18201, -18122, -18043, -17965, -17888, -17811, -17734, -17658, -17583, -17507, -17431, -17357, 
-        -17281, -17208, -17134, -17059, -16988, -16913, -16840, -16767, -16696, -16623, -16551, -16479, 
-        -16407, -16336, -16264, -16194, -16122, -16050, -15980, -15911, -15839, -15769, -15700, -15629, 
-        -15559, -15490, -15420, -15350, -15280, -15211, -15142, -15073, -15005, -14935, -14866, -14798, 
-        -14729, -14660, -14592, -14525, -14457, -14388, -14320, -14252, -14185, -14117, -14049, -13981, 
-        -13914, -13847, -13780, -13712, -13644, -13578, -13510, -13444, -13376, -13310, -13243, -13177, 
-        -13110, -13043, -12976, -12910, -12844, -12777, -12711, -12646, -12579, -12513, -12447, -12381 
-    };
-
-    // AKWF_blended_0076 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0076[600] PROGMEM = {
-        1, 1078, 2152, 3225, 4293, 5356, 6412, 7463, 8504, 9537, 10557, 11567, 
-        12562, 13545, 14511, 15460, 16393, 17307, 18203, 19077, 19930, 20761, 21569, 22355, 
-        23114, 23849, 24559, 25241, 25896, 26523, 27123, 27692, 28233, 28745, 29227, 29678, 
-        30099, 30489, 30848, 31176, 31474, 31740, 31975, 32179, 32352, 32495, 32609, 32691, 
-        32742, 32766, 32760, 32724, 32662, 32569, 32452, 32307, 32138, 31942, 31723, 31477, 
-        31211, 30923, 30611, 30280, 29931, 29560, 29174, 28770, 28350, 27915, 27466, 27006, 
-        26533, 26049, 25555, 25053, 24543, 24028, 23504, 22979, 22449, 21918, 21385, 20852, 
-        20320, 19791, 19263, 18740, 18222, 17709, 17203, 16705, 16217, 15737, 15266, 14807, 
-        14362, 13927, 13507, 13100, 12710, 12333, 11972, 11627, 11300, 10992, 10700, 10426, 
-        10171, 9933, 9718, 9520, 9341, 9183, 9045, 8926, 8826, 8747, 8687, 8647, 
-        8626, 8626, 8641, 8679, 8732, 8804, 8894, 9002, 9124, 9265, 9420, 9588, 
-        9773, 9971, 10182, 10406, 10639, 10886, 11141, 11406, 11678, 11961, 12247, 12541, 
-        12839, 13141, 13445, 13752, 14062, 14370, 14678, 14984, 15290, 15589, 15886, 16176, 
-        16460, 16736, 17005, 17266, 17515, 17756, 17983, 18199, 18401, 18589, 18762, 18920, 
-        19062, 19187, 19295, 19383, 19454, 19507, 19538, 19550, 19540, 19511, 19460, 19385, 
-        19291, 19173, 19034, 18871, 18685, 18477, 18246, 17993, 17717, 17419, 17097, 16754, 
-        16387, 15999, 15591, 15162, 14709, 14239, 13749, 13239, 12710, 12163, 11598, 11016, 
-        10420, 9806, 9179, 8538, 7885, 7218, 6540, 5852, 5156, 4450, 3736, 3017, 
-        2291, 1562, 831, 96, -639, -1376, -2111, -2844, -3575, -4301, -5020, -5736, 
-        -6442, -7140, -7830, -8506, -9173, -9826, -10467, -11090, -11700, -12292, -12866, -13423, 
-        -13960, -14476, -14972, -15444, -15895, -16323, -16727, -17103, -17456, -17783, -18083, -18358, 
-        -18603, -18820, -19009, -19169, -19301, -19405, -19477, -19520, -19534, -19518, -19471, -19397, 
-        -19291, -19158, -18993, -18801, -18577, -18328, -18048, -17742, -17409, -17048, -16662, -16248, 
-        -15811, -15348, -14864, -14354, -13823, -13270, -12698, -12106, -11494, -10865, -10218, -9555, 
-        -8879, -8189, -7485, -6769, -6044, -5309, -4566, -3815, -3058, -2297, -1533, -766, 
-        1, 770, 1539, 2303, 3064, 3821, 4569, 5314, 6048, 6773, 7489, 8192, 
-        8883, 9561, 10222, 10869, 11498, 12110, 12702, 13274, 13827, 14358, 14866, 15352, 
-        15815, 16252, 16664, 17050, 17411, 17744, 18052, 18330, 18579, 18803, 18995, 19158, 
-        19293, 19397, 19473, 19518, 19534, 19520, 19477, 19403, 19301, 19169, 19009, 18818, 
-        18601, 18356, 18081, 17781, 17454, 17101, 16723, 16321, 15893, 15442, 14968, 14474, 
-        13956, 13419, 12864, 12290, 11696, 11088, 10463, 9822, 9169, 8502, 7826, 7136, 
-        6438, 5732, 5016, 4297, 3570, 2840, 2107, 1372, 635, -99, -835, -1568, 
-        -2295, -3021, -3740, -4454, -5160, -5856, -6544, -7220, -7887, -8541, -9183, -9810, 
-        -10422, -11020, -11600, -12164, -12711, -13241, -13751, -14241, -14711, -15162, -15593, -16001, 
-        -16389, -16754, -17097, -17419, -17719, -17993, -18248, -18479, -18685, -18871, -19032, -19173, 
-        -19289, -19385, -19458, -19511, -19540, -19548, -19536, -19505, -19454, -19383, -19293, -19185, 
-        -19060, -18918, -18760, -18587, -18397, -18195, -17981, -17752, -17513, -17264, -17003, -16734, 
-        -16456, -16172, -15882, -15586, -15286, -14982, -14676, -14366, -14058, -13751, -13443, -13137, 
-        -12835, -12537, -12245, -11957, -11676, -11404, -11139, -10884, -10637, -10404, -10180, -9969, 
-        -9771, -9586, -9418, -9263, -9124, -9000, -8892, -8802, -8732, -8677, -8641, -8624, 
-        -8626, -8647, -8687, -8747, -8826, -8926, -9045, -9185, -9343, -9522, -9718, -9935, 
-        -10171, -10427, -10702, -10992, -11302, -11629, -11974, -12335, -12711, -13104, -13509, -13931, 
-        -14364, -14811, -15270, -15740, -16219, -16709, -17207, -17713, -18226, -18744, -19267, -19795, 
-        -20324, -20857, -21389, -21922, -22453, -22983, -23510, -24031, -24547, -25057, -25559, -26053, 
-        -26537, -27009, -27470, -27919, -28354, -28774, -29178, -29564, -29933, -30284, -30615, -30925, 
-        -31215, -31481, -31725, -31944, -32140, -32311, -32454, -32573, -32664, -32726, -32760, -32767, 
-        -32744, -32691, -32609, -32497, -32354, -32179, -31975, -31740, -31474, -31176, -30848, -30487, 
-        -30097, -29676, -29225, -28743, -28231, -27690, -27119, -26521, -25894, -25237, -24555, -23847, 
-        -23112, -22351, -21565, -20757, -19926, -19073, -18199, -17303, -16389, -15456, -14505, -13539, 
-        -12559, -11561, -10553, -9532, -8500, -7459, -6408, -5352, -4287, -3219, -2146, -1072 
-    };
-
-    // AKWF_blended_0077 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0077[600] PROGMEM = {
-        6054, 10632, 10079, 11046, 11141, 11822, 12078, 12647, 12984, 13487, 13866, 14330, 
-        14734, 15173, 15587, 16008, 16425, 16839, 17248, 17654, 18058, 18457, 18853, 19245, 
-        19631, 20013, 20392, 20766, 21133, 21497, 21853, 22207, 22551, 22893, 23230, 23559, 
-        23880, 24197, 24506, 24811, 25107, 25397, 25678, 25955, 26222, 26484, 26736, 26980, 
-        27219, 27449, 27671, 27885, 28090, 28287, 28474, 28656, 28825, 28990, 29144, 29289, 
-        29424, 29553, 29668, 29783, 29875, 30007, 30237, 30453, 30665, 30865, 31057, 31236, 
-        31411, 31571, 31725, 31867, 32002, 32124, 32239, 32344, 32438, 32523, 32600, 32660, 
-        32725, 32698, 32580, 32466, 32334, 32196, 32047, 31890, 31723, 31546, 31359, 31164, 
-        30960, 30748, 30523, 30294, 30052, 29803, 29546, 29279, 29002, 28718, 28426, 28124, 
-        27815, 27499, 27174, 26840, 26499, 26150, 25795, 25431, 25060, 24681, 24294, 23903, 
-        23501, 23097, 22684, 22262, 21838, 21404, 20968, 20524, 20073, 19619, 19158, 18691, 
-        18220, 17741, 17260, 16776, 16285, 15789, 15293, 14781, 14288, 13754, 13275, 12707, 
-        12255, 11639, 11231, 10557, 10143, 10228, 24721, 28321, 26785, 26773, 25885, 25584, 
-        24858, 24441, 23796, 23319, 22716, 22202, 21629, 21093, 20534, 19988, 19439, 18891, 
-        18342, 17796, 17250, 16706, 16163, 15622, 15083, 14544, 14008, 13477, 12946, 12417, 
-        11894, 11370, 10852, 10335, 9822, 9313, 8807, 8306, 7807, 7311, 6822, 6336, 
-        5854, 5376, 4904, 4436, 3972, 3513, 3059, 2613, 2169, 1733, 1299, 872, 
-        451, 37, -374, -777, -1176, -1568, -1954, -2331, -2708, -3072, -3441, -3752, 
-        -3952, -4149, -4336, -4518, -4692, -4862, -5022, -5179, -5326, -5468, -5603, -5730, 
-        -5849, -5967, -6074, -6176, -6268, -6358, -6433, -6580, -6802, -7006, -7208, -7400, 
-        -7590, -7772, -7947, -8114, -8276, -8430, -8580, -8722, -8859, -8989, -9113, -9231, 
-        -9343, -9448, -9550, -9642, -9732, -9814, -9891, -9964, -10031, -10093, -10148, -10201, 
-        -10248, -10288, -10325, -10358, -10385, -10408, -10425, -10440, -10453, -10458, -10463, -10460, 
-        -10455, -10448, -10438, -10423, -10405, -10385, -10363, -10335, -10308, -10278, -10246, -10211, 
-        -10171, -10141, -10086, -10069, -9989, -9996, -9882, -9926, -9762, -9857, -9690, -9024, 
-        6054, 10243, 9296, 9874, 9577, 9867, 9734, 9914, 9859, 9974, 9964, 10039, 
-        10054, 10106, 10133, 10168, 10198, 10226, 10253, 10276, 10295, 10313, 10328, 10338, 
-        10345, 10350, 10350, 10348, 10340, 10330, 10315, 10298, 10273, 10248, 10216, 10178, 
-        10136, 10091, 10039, 9984, 9921, 9854, 9782, 9704, 9622, 9532, 9438, 9338, 
-        9231, 9121, 9001, 8879, 8749, 8612, 8470, 8321, 8163, 8004, 7834, 7662, 
-        7478, 7293, 7096, 6899, 6685, 6513, 6440, 6356, 6271, 6174, 6074, 5967, 
-        5852, 5730, 5603, 5468, 5326, 5176, 5022, 4859, 4692, 4515, 4338, 4144, 
-        3959, 3683, 3321, 2964, 2593, 2221, 1842, 1456, 1064, 665, 261, -147, 
-        -563, -982, -1411, -1842, -2281, -2722, -3171, -3625, -4084, -4548, -5014, -5488, 
-        -5964, -6448, -6932, -7423, -7919, -8415, -8919, -9425, -9934, -10448, -10964, -11482, 
-        -12004, -12530, -13058, -13589, -14121, -14657, -15195, -15734, -16275, -16819, -17362, -17908, 
-        -18454, -19003, -19552, -20098, -20649, -21200, -21748, -22304, -22841, -23414, -23928, -24529, 
-        -25005, -25646, -26072, -26758, -27182, -27105, -12614, -9011, -10540, -10542, -11415, -11702, 
-        -12403, -12792, -13407, -13851, -14412, -14884, -15412, -15896, -16400, -16886, -17372, -17853, 
-        -18332, -18804, -19270, -19731, -20185, -20636, -21080, -21517, -21950, -22374, -22796, -23210, 
-        -23614, -24015, -24407, -24793, -25172, -25541, -25905, -26262, -26611, -26952, -27287, -27611, 
-        -27927, -28237, -28538, -28830, -29114, -29391, -29656, -29915, -30164, -30404, -30636, -30857, 
-        -31072, -31276, -31471, -31655, -31835, -31999, -32159, -32306, -32446, -32573, -32700, -32767, 
-        -32720, -32665, -32598, -32523, -32438, -32344, -32239, -32124, -31999, -31867, -31725, -31571, 
-        -31409, -31239, -31054, -30867, -30663, -30458, -30232, -30077, -29992, -29887, -29783, -29663, 
-        -29536, -29399, -29254, -29099, -28937, -28765, -28586, -28396, -28199, -27995, -27780, -27558, 
-        -27329, -27092, -26848, -26593, -26332, -26065, -25790, -25506, -25217, -24920, -24619, -24307, 
-        -23990, -23668, -23339, -23003, -22664, -22317, -21963, -21606, -21245, -20876, -20502, -20125, 
-        -19741, -19355, -18963, -18567, -18168, -17766, -17357, -16948, -16534, -16118, -15699, -15278, 
-        -14851, -14432, -13988, -13582, -13113, -12732, -12225, -11881, -11325, -11029, -10472, -9415 
-    };
-
-    // AKWF_blended_0078 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0078[600] PROGMEM = {
-        23847, 32767, 30620, 31451, 30707, 30972, 30528, 30604, 30289, 30272, 30026, 29951, 
-        29750, 29644, 29466, 29340, 29173, 29039, 28878, 28738, 28579, 28437, 28278, 28133, 
-        27974, 27826, 27670, 27519, 27361, 27207, 27051, 26892, 26736, 26577, 26418, 26259, 
-        26100, 25938, 25774, 25612, 25448, 25283, 25116, 24948, 24781, 24611, 24441, 24271, 
-        24098, 23925, 23749, 23577, 23398, 23222, 23041, 22863, 22679, 22497, 22313, 22126, 
-        21940, 21753, 21560, 21374, 21173, 21028, 20997, 20964, 20933, 20897, 20860, 20821, 
-        20782, 20741, 20699, 20654, 20607, 20559, 20512, 20459, 20409, 20353, 20297, 20236, 
-        20186, 20043, 19804, 19581, 19346, 19115, 18878, 18644, 18404, 18164, 17921, 17676, 
-        17431, 17182, 16931, 16680, 16424, 16173, 15911, 15657, 15381, 15219, 15166, 15088, 
-        15024, 14949, 14876, 14798, 14720, 14636, 14556, 14469, 14383, 14294, 14201, 14109, 
-        14012, 13914, 13814, 13711, 13608, 13499, 13393, 13278, 13167, 13050, 12933, 12813, 
-        12690, 12565, 12439, 12311, 12177, 12043, 11912, 11764, 11639, 11472, 11366, 11159, 
-        11089, 10833, 10813, 10496, 10470, 10997, 27639, 32109, 30829, 31253, 30696, 30790, 
-        30414, 30383, 30093, 29990, 29745, 29597, 29379, 29204, 28997, 28805, 28604, 28401, 
-        28197, 27991, 27782, 27570, 27358, 27140, 26926, 26702, 26482, 26259, 26030, 25802, 
-        25570, 25339, 25102, 24865, 24625, 24382, 24140, 23894, 23646, 23395, 23142, 22888, 
-        22631, 22375, 22096, 21652, 21184, 20718, 20250, 19779, 19307, 18833, 18356, 17877, 
-        17397, 16915, 16430, 15944, 15456, 14966, 14472, 13981, 13482, 12988, 12481, 12029, 
-        11692, 11349, 11009, 10666, 10320, 9974, 9626, 9274, 8923, 8569, 8215, 7855, 
-        7498, 7138, 6778, 6413, 6051, 5680, 5320, 4871, 4327, 3795, 3254, 2718, 
-        2175, 1634, 1090, 546, 0, -546, -1095, -1642, -2194, -2746, -3298, -3853, 
-        -4408, -4966, -5524, -6081, -6642, -7202, -7763, -8326, -8889, -9453, -10019, -10585, 
-        -11154, -11720, -12289, -12860, -13429, -14001, -14572, -15144, -15721, -16290, -16870, -17439, 
-        -18022, -18591, -19176, -19742, -20331, -20900, -21491, -22054, -22651, -23211, -23816, -24371, 
-        -24979, -25534, -26139, -26700, -27302, -27862, -28470, -29011, -29683, -30032, -31384, -16279, 
-        23847, 32332, 29748, 30141, 28958, 28785, 27907, 27545, 26794, 26340, 25662, 25152, 
-        24516, 23978, 23367, 22807, 22210, 21644, 21053, 20487, 19898, 19330, 18744, 18172, 
-        17592, 17021, 16441, 15869, 15295, 14723, 14148, 13577, 13005, 12436, 11865, 11296, 
-        10730, 10161, 9595, 9032, 8465, 7902, 7339, 6778, 6218, 5657, 5100, 4542, 
-        3984, 3429, 2874, 2322, 1770, 1218, 672, 122, -426, -970, -1514, -2057, 
-        -2601, -3139, -3680, -4216, -4760, -5248, -5613, -5984, -6349, -6714, -7077, -7439, 
-        -7799, -8156, -8513, -8870, -9221, -9575, -9924, -10272, -10618, -10967, -11307, -11653, 
-        -11985, -12406, -12916, -13410, -13909, -14402, -14899, -15389, -15880, -16365, -16853, -17339, 
-        -17821, -18301, -18780, -19254, -19731, -20202, -20676, -21139, -21619, -21981, -22232, -22500, 
-        -22754, -23013, -23264, -23521, -23769, -24020, -24262, -24508, -24748, -24990, -25227, -25462, 
-        -25693, -25927, -26156, -26382, -26605, -26828, -27048, -27266, -27480, -27695, -27907, -28116, 
-        -28323, -28526, -28727, -28928, -29126, -29321, -29511, -29711, -29881, -30096, -30238, -30478, 
-        -30579, -30860, -30902, -31234, -31270, -30751, -14112, -9637, -10914, -10479, -11020, -10903, 
-        -11254, -11254, -11513, -11577, -11778, -11879, -12043, -12163, -12305, -12434, -12562, -12690, 
-        -12813, -12935, -13055, -13175, -13290, -13404, -13516, -13624, -13730, -13836, -13937, -14040, 
-        -14137, -14232, -14327, -14419, -14508, -14595, -14678, -14762, -14843, -14921, -14999, -15074, 
-        -15147, -15214, -15300, -15548, -15816, -16078, -16337, -16594, -16851, -17104, -17358, -17606, 
-        -17854, -18100, -18345, -18588, -18828, -19067, -19304, -19539, -19773, -20002, -20239, -20417, 
-        -20478, -20540, -20596, -20654, -20707, -20760, -20810, -20860, -20908, -20955, -20997, -21042, 
-        -21081, -21123, -21159, -21198, -21231, -21268, -21290, -21404, -21608, -21795, -21987, -22177, 
-        -22366, -22550, -22737, -22921, -23105, -23287, -23465, -23646, -23822, -24000, -24176, -24349, 
-        -24522, -24695, -24868, -25038, -25205, -25372, -25540, -25707, -25871, -26036, -26201, -26362, 
-        -26524, -26683, -26845, -27001, -27160, -27319, -27475, -27631, -27787, -27941, -28097, -28247, 
-        -28403, -28551, -28710, -28852, -29014, -29151, -29315, -29449, -29616, -29742, -29915, -30038, 
-        -30210, -30333, -30503, -30629, -30796, -30921, -31092, -31198, -31432, -31345, -32260, -16717 
-    };
-
-    // AKWF_blended_0079 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0079[600] PROGMEM = {
-        27471, 32767, 31267, 31596, 30957, 30936, 30483, 30347, 29972, 29780, 29450, 29222, 
-        28917, 28670, 28381, 28124, 27841, 27578, 27300, 27035, 26757, 26492, 26214, 25947, 
-        25673, 25404, 25130, 24861, 24589, 24318, 24044, 23773, 23503, 23231, 22960, 22689, 
-        22417, 22146, 21874, 21603, 21333, 21059, 20788, 20517, 20245, 19974, 19702, 19431, 
-        19159, 18889, 18616, 18346, 18073, 17803, 17530, 17260, 16987, 16717, 16446, 16174, 
-        15903, 15631, 15358, 15089, 14814, 14570, 14401, 14230, 14060, 13889, 13719, 13548, 
-        13378, 13207, 13038, 12866, 12697, 12525, 12356, 12185, 12015, 11844, 11676, 11501, 
-        11337, 11116, 10838, 10571, 10297, 10028, 9754, 9483, 9211, 8942, 8668, 8397, 
-        8125, 7856, 7582, 7313, 7039, 6770, 6496, 6229, 5950, 5739, 5599, 5446, 
-        5301, 5148, 5003, 4852, 4705, 4556, 4407, 4258, 4109, 3960, 3812, 3663, 
-        3514, 3365, 3216, 3067, 2920, 2771, 2622, 2473, 2324, 2175, 2026, 1878, 
-        1729, 1580, 1431, 1284, 1133, 986, 839, 685, 546, 381, 256, 73, 
-        -27, -239, -306, -553, -620, -345, 9828, 12525, 11693, 11909, 11523, 11542, 
-        11272, 11213, 10996, 10898, 10713, 10590, 10424, 10285, 10131, 9985, 9836, 9687, 
-        9538, 9389, 9240, 9093, 8944, 8795, 8646, 8497, 8348, 8200, 8051, 7902, 
-        7753, 7604, 7455, 7308, 7159, 7010, 6861, 6712, 6563, 6414, 6267, 6118, 
-        5969, 5821, 5660, 5402, 5128, 4857, 4585, 4314, 4042, 3771, 3501, 3228, 
-        2958, 2685, 2415, 2142, 1872, 1599, 1329, 1056, 784, 515, 239, -1, 
-        -172, -344, -513, -685, -854, -1024, -1195, -1365, -1536, -1707, -1877, -2046, 
-        -2218, -2389, -2557, -2730, -2898, -3071, -3237, -3458, -3735, -4002, -4275, -4547, 
-        -4819, -5088, -5361, -5631, -5904, -6176, -6447, -6719, -6990, -7260, -7532, -7805, 
-        -8075, -8348, -8618, -8891, -9161, -9432, -9704, -9977, -10247, -10518, -10790, -11061, 
-        -11333, -11604, -11876, -12147, -12417, -12690, -12914, -13137, -13363, -13584, -13810, -14031, 
-        -14259, -14478, -14706, -14925, -15155, -15372, -15603, -15817, -16052, -16263, -16503, -16710, 
-        -16950, -17157, -17397, -17606, -17844, -18054, -18292, -18491, -18770, -18849, -19546, -10131, 
-        14649, 19993, 18541, 18916, 18323, 18352, 17946, 17859, 17532, 17386, 17102, 16924, 
-        16667, 16468, 16225, 16014, 15781, 15566, 15334, 15117, 14887, 14670, 14440, 14221, 
-        13995, 13774, 13546, 13325, 13101, 12829, 12558, 12287, 12015, 11744, 11472, 11201, 
-        10929, 10658, 10386, 10115, 9843, 9572, 9300, 9030, 8759, 8485, 8214, 7944, 
-        7671, 7401, 7128, 6858, 6585, 6315, 6042, 5772, 5499, 5229, 4958, 4686, 
-        4413, 4143, 3870, 3602, 3324, 3083, 2913, 2742, 2572, 2401, 2231, 2060, 
-        1890, 1721, 1550, 1378, 1209, 1037, 868, 697, 527, 356, 186, 15, 
-        -150, -371, -647, -916, -1190, -1459, -1733, -2004, -2274, -2545, -2819, -3089, 
-        -3362, -3631, -3905, -4174, -4448, -4717, -4991, -5258, -5537, -5748, -5888, -6041, 
-        -6186, -6339, -6484, -6635, -6782, -6933, -7080, -7229, -7378, -7527, -7675, -7824, 
-        -7973, -8122, -8271, -8420, -8569, -8716, -8865, -9014, -9161, -9312, -9459, -9610, 
-        -9757, -9906, -10055, -10203, -10354, -10501, -10648, -10802, -10941, -11105, -11230, -11414, 
-        -11515, -11727, -11794, -12041, -12107, -11833, -1659, 1037, 205, 421, 35, 54, 
-        -215, -274, -489, -589, -774, -897, -1063, -1202, -1356, -1502, -1651, -1800, 
-        -1949, -2098, -2247, -2396, -2543, -2692, -2841, -2990, -3139, -3286, -3435, -3584, 
-        -3733, -3882, -4031, -4179, -4328, -4477, -4626, -4775, -4924, -5071, -5220, -5369, 
-        -5518, -5666, -5825, -6085, -6359, -6630, -6902, -7173, -7443, -7716, -7986, -8259, 
-        -8529, -8802, -9072, -9345, -9615, -9888, -10158, -10429, -10703, -10972, -11248, -11491, 
-        -11660, -11832, -12001, -12173, -12342, -12512, -12683, -12853, -13024, -13195, -13365, -13536, 
-        -13706, -13877, -14045, -14218, -14385, -14558, -14725, -14946, -15221, -15490, -15763, -16033, 
-        -16307, -16576, -16849, -17119, -17391, -17662, -17934, -18205, -18477, -18748, -19020, -19291, 
-        -19563, -19834, -20106, -20377, -20649, -20922, -21192, -21463, -21735, -22006, -22278, -22549, 
-        -22821, -23092, -23364, -23635, -23907, -24178, -24450, -24721, -24993, -25264, -25536, -25805, 
-        -26079, -26348, -26624, -26889, -27167, -27432, -27711, -27973, -28256, -28515, -28801, -29056, 
-        -29344, -29599, -29885, -30143, -30428, -30686, -30972, -31219, -31546, -31673, -19546, -10131 
-    };
-
-} // namespace AKWF_BwBlended
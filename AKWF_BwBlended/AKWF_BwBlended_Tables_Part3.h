@@ -1,62 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwBlended {
-
-    // AKWF_blended_0080 → 600 samples
-    static const int16_t akwf_akwf_bwblended_akwf_blended_0080[600] PROGMEM = {
-        13767, 19018, 17964, 18604, 18346, 18668, 18583, 18795, 18785, 18945, 18975, 19101, 
-        19150, 19258, 19325, 19419, 19492, 19579, 19653, 19737, 19809, 19891, 19965, 20043, 
-        20114, 20190, 20262, 20334, 20405, 20475, 20541, 20609, 20673, 20739, 20802, 20862, 
-        20922, 20981, 21035, 21093, 21148, 21201, 21250, 21298, 21347, 21392, 21435, 21479, 
-        21518, 21556, 21592, 21627, 21659, 21691, 21718, 21745, 21769, 21793, 21812, 21831, 
-        21847, 21861, 21871, 21884, 21885, 21919, 22017, 22110, 22200, 22288, 22378, 22464, 
-        22546, 22627, 22705, 22779, 22853, 22924, 22993, 23058, 23122, 23182, 23241, 23295, 
-        23354, 23357, 23305, 23258, 23207, 23157, 23101, 23044, 22980, 22918, 22849, 22781, 
-        22709, 22638, 22561, 22482, 22399, 22316, 22227, 22143, 22043, 22006, 22032, 22039, 
-        22054, 22060, 22068, 22073, 22075, 22073, 22070, 22063, 22055, 22041, 22028, 22009, 
-        21992, 21969, 21946, 21919, 21887, 21855, 21820, 21783, 21742, 21701, 21656, 21607, 
-        21556, 21500, 21448, 21389, 21328, 21263, 21201, 21128, 21066, 20977, 20922, 20814, 
-        20776, 20634, 20623, 20445, 20428, 20732, 30228, 32767, 32031, 32269, 31946, 31991, 
-        31768, 31738, 31560, 31488, 31331, 31230, 31087, 30969, 30834, 30701, 30565, 30425, 
-        30285, 30140, 29994, 29844, 29695, 29541, 29385, 29225, 29065, 28899, 28735, 28565, 
-        28395, 28221, 28043, 27863, 27682, 27501, 27313, 27125, 26932, 26737, 26543, 26344, 
-        26142, 25941, 25723, 25410, 25084, 24756, 24425, 24094, 23760, 23421, 23080, 22738, 
-        22391, 22043, 21691, 21343, 20986, 20628, 20268, 19906, 19541, 19175, 18801, 18454, 
-        18178, 17891, 17606, 17317, 17027, 16733, 16442, 16142, 15843, 15539, 15237, 14930, 
-        14621, 14308, 13996, 13679, 13364, 13040, 12723, 12352, 11924, 11504, 11079, 10653, 
-        10223, 9792, 9357, 8921, 8484, 8043, 7602, 7160, 6713, 6266, 5817, 5367, 
-        4913, 4458, 4001, 3543, 3082, 2620, 2157, 1693, 1226, 759, 286, -184, 
-        -657, -1129, -1607, -2086, -2563, -3042, -3526, -4008, -4493, -4974, -5464, -5947, 
-        -6441, -6928, -7421, -7906, -8406, -8891, -9392, -9879, -10385, -10871, -11382, -11864, 
-        -12376, -12860, -13372, -13859, -14373, -14862, -15379, -15854, -16407, -16776, -17716, -9256, 
-        13469, 18131, 16489, 16543, 15702, 15434, 14764, 14389, 13792, 13364, 12809, 12351, 
-        11822, 11345, 10829, 10344, 9835, 9348, 8847, 8357, 7860, 7370, 6872, 6387, 
-        5893, 5405, 4916, 4429, 3941, 3457, 2972, 2491, 2009, 1529, 1051, 574, 
-        98, -373, -848, -1317, -1788, -2257, -2722, -3187, -3650, -4111, -4571, -5031, 
-        -5486, -5940, -6391, -6842, -7290, -7736, -8182, -8622, -9063, -9502, -9938, -10371, 
-        -10804, -11234, -11662, -12085, -12511, -12906, -13230, -13555, -13872, -14190, -14505, -14820, 
-        -15129, -15439, -15743, -16047, -16351, -16650, -16944, -17240, -17530, -17821, -18104, -18391, 
-        -18668, -18992, -19366, -19731, -20100, -20461, -20822, -21180, -21535, -21884, -22235, -22582, 
-        -22929, -23270, -23610, -23944, -24280, -24609, -24942, -25265, -25596, -25860, -26057, -26263, 
-        -26458, -26657, -26850, -27044, -27232, -27418, -27602, -27785, -27964, -28137, -28312, -28484, 
-        -28653, -28817, -28980, -29141, -29299, -29455, -29606, -29757, -29906, -30050, -30193, -30333, 
-        -30468, -30602, -30739, -30864, -30993, -31117, -31238, -31362, -31471, -31598, -31689, -31829, 
-        -31892, -32055, -32082, -32271, -32295, -31991, -22491, -19941, -20660, -20410, -20711, -20636, 
-        -20827, -20816, -20951, -20973, -21072, -21115, -21190, -21241, -21301, -21352, -21405, -21454, 
-        -21500, -21543, -21586, -21623, -21659, -21696, -21726, -21756, -21782, -21806, -21828, -21847, 
-        -21863, -21877, -21887, -21895, -21903, -21907, -21907, -21907, -21904, -21896, -21888, -21879, 
-        -21866, -21847, -21841, -21922, -22014, -22102, -22187, -22270, -22351, -22429, -22503, -22577, 
-        -22647, -22713, -22779, -22843, -22905, -22962, -23020, -23071, -23123, -23169, -23220, -23236, 
-        -23184, -23129, -23071, -23012, -22948, -22883, -22816, -22749, -22676, -22603, -22525, -22448, 
-        -22366, -22283, -22195, -22111, -22019, -21928, -21828, -21780, -21780, -21769, -21764, -21750, 
-        -21739, -21723, -21704, -21685, -21662, -21637, -21611, -21584, -21554, -21522, -21489, -21454, 
-        -21417, -21378, -21338, -21295, -21249, -21204, -21156, -21109, -21056, -21002, -20950, -20892, 
-        -20837, -20778, -20717, -20655, -20591, -20528, -20463, -20396, -20329, -20259, -20190, -20114, 
-        -20044, -19966, -19898, -19815, -19745, -19662, -19592, -19503, -19433, -19339, -19272, -19175, 
-        -19108, -19011, -18945, -18846, -18774, -18677, -18606, -18496, -18462, -18241, -18596, -9548 
-    };
-
-} // namespace AKWF_BwBlended
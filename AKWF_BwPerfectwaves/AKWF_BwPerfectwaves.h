@@ -1,22 +1,73 @@
-// Auto‑generated AKWF bank. Do not edit manually.
+// Auto‑generated AKWF bank (compressed, see AKWFCodec.h). Do not edit manually.
 
 #pragma once
 #include <Arduino.h>
 
-#include "AKWF_BwPerfectwaves_Tables_Part0.h"
-
 namespace AKWF_BwPerfectwaves {
+
     constexpr uint16_t count = 4;
-}
 
-// Return a pointer to the n‑th waveform table in this bank.
-// If index is out of range, returns nullptr and length is set to 0.
-inline const int16_t* AKWF_BwPerfectwaves_get(uint16_t index, uint16_t &length) {
-    switch(index) {
-        case 0: length = 600; return AKWF_BwPerfectwaves::akwf_akwf_bwperfectwaves_akwf_saw;
-        case 1: length = 600; return AKWF_BwPerfectwaves::akwf_akwf_bwperfectwaves_akwf_sin;
-        case 2: length = 600; return AKWF_BwPerfectwaves::akwf_akwf_bwperfectwaves_akwf_squ;
-        case 3: length = 600; return AKWF_BwPerfectwaves::akwf_akwf_bwperfectwaves_akwf_tri;
-        default: length = 0; return nullptr;
-    }
-}
+    // 4800 bytes as int16 → 806 bytes
+
+    static const uint8_t data[806] PROGMEM = {
+        0x02, 0x30, 0xFF, 0xFF, 0xFF, 0xE4, 0x04, 0x20, 0x04, 0x20, 0x00, 0x42, 0x00, 0x1A, 0x1A, 0x34,
+        0x34, 0x06, 0x86, 0x8D, 0x00, 0xD1, 0xA3, 0x43, 0x40, 0x68, 0x68, 0xD0, 0xC1, 0x1A, 0x1A, 0x34,
+        0x03, 0x46, 0x86, 0x8D, 0x00, 0xD1, 0xA1, 0xA0, 0x34, 0x34, 0x68, 0x68, 0x0D, 0x0D, 0x1A, 0x30,
+        0x43, 0x46, 0x86, 0x80, 0xD0, 0xD1, 0xA1, 0x82, 0x34, 0x34, 0x68, 0x06, 0x8D, 0x0D, 0x1A, 0x01,
+        0xA3, 0x43, 0x40, 0x68, 0x68, 0xD1, 0xA0, 0x1A, 0x34, 0x34, 0x60, 0x86, 0x8D, 0x0D, 0x34, 0x00,
+        0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00,
+        0x00, 0x02, 0x00, 0x07, 0xFF, 0xFB, 0xFF, 0x7F, 0xFF, 0xDF, 0xFC, 0x00, 0x00, 0x00, 0x20, 0x8D,
+        0x0D, 0x1A, 0x01, 0xA3, 0x43, 0x46, 0x80, 0x68, 0xD0, 0xD0, 0x1A, 0x34, 0x34, 0x68, 0x06, 0x8D,
+        0x0D, 0x18, 0x21, 0xA3, 0x43, 0x40, 0x68, 0x68, 0xD0, 0xC1, 0x1A, 0x1A, 0x34, 0x03, 0x46, 0x86,
+        0x8D, 0x01, 0xA1, 0xA3, 0x40, 0x34, 0x68, 0x68, 0xD0, 0x0D, 0x1A, 0x1A, 0x30, 0x43, 0x46, 0x86,
+        0x80, 0xD0, 0xD1, 0xA1, 0x82, 0x34, 0x34, 0x68, 0x06, 0x8D, 0x1A, 0x1A, 0x03, 0x43, 0x46, 0x80,
+        0x68, 0xD0, 0xD1, 0xA0, 0x1A, 0x34, 0x03, 0x60, 0x1F, 0xFA, 0xEF, 0xFD, 0x68, 0x00, 0x00, 0x00,
+        0x84, 0x06, 0x08, 0x08, 0x20, 0x00, 0x41, 0x01, 0x0D, 0x34, 0x68, 0x08, 0x72, 0xE5, 0x32, 0x99,
+        0xBC, 0xDC, 0x10, 0x65, 0xC2, 0xE5, 0xC4, 0x1C, 0x58, 0x05, 0xEE, 0x63, 0xBF, 0x73, 0x58, 0x23,
+        0x5B, 0xBD, 0x0D, 0xDB, 0x0D, 0x92, 0xC0, 0x1C, 0xB1, 0xCB, 0x04, 0x60, 0xC7, 0x37, 0x9B, 0xCA,
+        0x66, 0x8E, 0x0C, 0x48, 0x5E, 0x50, 0xCD, 0xC0, 0xB5, 0xA6, 0xB4, 0xD6, 0xB0, 0xDE, 0x50, 0xCD,
+        0xC1, 0x23, 0x0A, 0x3C, 0xA6, 0x6F, 0x37, 0x96, 0x30, 0x60, 0x2E, 0x58, 0xE5, 0x80, 0x38, 0xB8,
+        0x15, 0xE8, 0x6E, 0xF5, 0xA3, 0x05, 0xA7, 0xBE, 0xF1, 0x3D, 0xD8, 0x16, 0x4B, 0x02, 0x5C, 0xB8,
+        0x5C, 0x44, 0x85, 0xE6, 0xF2, 0x99, 0x4C, 0xB9, 0x43, 0x01, 0xA3, 0x4D, 0x06, 0xB2, 0xD7, 0xBB,
+        0x00, 0x06, 0xEF, 0x5A, 0x6B, 0x59, 0x06, 0x2C, 0x06, 0xEF, 0x77, 0x84, 0xB8, 0x5E, 0x6F, 0x29,
+        0x07, 0x28, 0x39, 0x72, 0xC0, 0x96, 0x44, 0x25, 0x0F, 0x23, 0xDF, 0x79, 0x6B, 0x10, 0xC7, 0x2C,
+        0x01, 0xC5, 0xC5, 0xC0, 0x86, 0xEF, 0x5B, 0xBD, 0x34, 0x18, 0xCB, 0xCD, 0xE6, 0xE1, 0x79, 0x48,
+        0x8C, 0x13, 0x37, 0x02, 0xF2, 0xC6, 0x23, 0x06, 0x30, 0x63, 0x1C, 0xDC, 0x04, 0xBC, 0xA4, 0x18,
+        0x99, 0xB8, 0x51, 0xE6, 0xF3, 0x71, 0x89, 0x12, 0x5C, 0x46, 0x5C, 0x40, 0x96, 0x4B, 0x25, 0x80,
+        0x2F, 0x76, 0xB1, 0x6B, 0x06, 0xF2, 0x84, 0x2E, 0x21, 0x17, 0x05, 0x07, 0x2E, 0x53, 0x2C, 0x13,
+        0x07, 0x79, 0xB8, 0x5C, 0x2E, 0x5C, 0x40, 0x01, 0x62, 0xCB, 0x5A, 0x06, 0xB7, 0x7A, 0x00, 0x01,
+        0xB0, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0xFF, 0xBF, 0xFF,
+        0xDF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x02, 0x4F, 0xFF, 0xFF, 0xFE, 0x41, 0x04, 0x00, 0x20, 0xC0, 0x00, 0x10,
+        0x62, 0x08, 0x00, 0x1E, 0xE1, 0xEE, 0xD1, 0xEE, 0x03, 0x96, 0x24, 0x62, 0x19, 0x63, 0x02, 0x68,
+        0xF7, 0x32, 0x68, 0x1A, 0xD7, 0xB8, 0xD6, 0x9A, 0xF0, 0x71, 0xAD, 0x35, 0xEE, 0x1E, 0x1A, 0x11,
+        0xCA, 0xE3, 0x94, 0x22, 0x19, 0x1E, 0xE1, 0xEE, 0xD0, 0x39, 0x65, 0x99, 0x62, 0x19, 0x40, 0x51,
+        0x03, 0x08, 0x10, 0x00, 0xFF, 0xFF, 0xFF, 0xE3, 0x80, 0x00, 0x21, 0x06, 0x20, 0x00, 0x00, 0x37,
+        0x01, 0x97, 0x25, 0x97, 0x01, 0x0D, 0xDE, 0x1D, 0xE2, 0x6B, 0x04, 0xB8, 0xE3, 0x71, 0x81, 0x70,
+        0x01, 0xDE, 0xB2, 0xD6, 0x3B, 0xD6, 0x05, 0xAC, 0x77, 0xAD, 0x65, 0x81, 0x33, 0xBC, 0x59, 0x6B,
+        0x07, 0x78, 0xB5, 0x96, 0xEF, 0x00, 0xEF, 0x16, 0xEF, 0x0E, 0xF1, 0x06, 0xEF, 0x0E, 0xF1, 0x65,
+        0x80, 0xEF, 0x0E, 0xF5, 0x8E, 0xF0, 0x0E, 0xF5, 0x8E, 0xF0, 0xEF, 0x58, 0x16, 0xB1, 0xDE, 0xB5,
+        0x96, 0x03, 0xBC, 0x99, 0x65, 0xAC, 0x1D, 0xE2, 0xD6, 0x5B, 0xBC, 0x41, 0xAC, 0xB7, 0x78, 0x77,
+        0x88, 0x65, 0xC9, 0x65, 0xC0, 0x62, 0x40, 0x4B, 0x80, 0x5C, 0x60, 0x5C, 0x70, 0x5B, 0x8C, 0x0B,
+        0x80, 0x5C, 0x62, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x02, 0x04, 0x40, 0xC0, 0x00, 0x01,
+        0x03, 0x00, 0x01, 0x8E, 0x57, 0x1C, 0xA1, 0x1C, 0xA0, 0x1E, 0xE3, 0x2D, 0x1E, 0xEC, 0x36, 0x65,
+        0x88, 0x65, 0x03, 0x2C, 0x09, 0xAD, 0x1E, 0xED, 0x35, 0x82, 0x3D, 0xDA, 0xD3, 0x4C, 0x81, 0xEE,
+        0x34, 0xD6, 0xBD, 0xC0, 0x6B, 0x4D, 0x7B, 0x87, 0xB8, 0x0D, 0x7B, 0x87, 0xB8, 0xD7, 0xB8, 0x07,
+        0xB8, 0xD0, 0x00, 0x00, 0x00, 0x00
+    };
+
+    static const AKWFTableRef tables[count] PROGMEM = {
+        { data +      0, 600 },   //   0 AKWF_saw
+        { data +    182, 600 },   //   1 AKWF_sin
+        { data +    415, 600 },   //   2 AKWF_squ
+        { data +    564, 600 }    //   3 AKWF_tri
+    };
+
+} // namespace AKWF_BwPerfectwaves
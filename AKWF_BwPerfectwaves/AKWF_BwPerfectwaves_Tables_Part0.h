@@ -1,224 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwPerfectwaves {
-
-    // AKWF_saw → 600 samples
-    static const int16_t akwf_akwf_bwperfectwaves_akwf_saw[600] PROGMEM = {
-        0, 109, 218, 328, 437, 546, 655, 765, 874, 983, 1092, 1201, 
-        1311, 1420, 1529, 1638, 1748, 1857, 1966, 2075, 2184, 2294, 2403, 2512, 
-        2621, 2731, 2840, 2949, 3058, 3167, 3277, 3386, 3495, 3604, 3714, 3823, 
-        3932, 4041, 4150, 4260, 4369, 4478, 4587, 4697, 4806, 4915, 5024, 5133, 
-        5243, 5352, 5461, 5570, 5680, 5789, 5898, 6007, 6117, 6226, 6335, 6444, 
-        6553, 6663, 6772, 6881, 6990, 7100, 7209, 7318, 7427, 7536, 7646, 7755, 
-        7864, 7973, 8083, 8192, 8301, 8410, 8519, 8629, 8738, 8847, 8956, 9066, 
-        9175, 9284, 9393, 9502, 9612, 9721, 9830, 9939, 10049, 10158, 10267, 10376, 
-        10485, 10595, 10704, 10813, 10922, 11032, 11141, 11250, 11359, 11468, 11578, 11687, 
-        11796, 11905, 12015, 12124, 12233, 12342, 12451, 12561, 12670, 12779, 12888, 12998, 
-        13107, 13216, 13325, 13434, 13544, 13653, 13762, 13871, 13981, 14090, 14199, 14308, 
-        14417, 14527, 14636, 14745, 14854, 14964, 15073, 15182, 15291, 15400, 15510, 15619, 
-        15728, 15837, 15947, 16056, 16165, 16274, 16383, 16493, 16602, 16711, 16820, 16930, 
-        17039, 17148, 17257, 17367, 17476, 17585, 17694, 17803, 17913, 18022, 18131, 18240, 
-        18350, 18459, 18568, 18677, 18786, 18896, 19005, 19114, 19223, 19333, 19442, 19551, 
-        19660, 19769, 19879, 19988, 20097, 20206, 20316, 20425, 20534, 20643, 20752, 20862, 
-        20971, 21080, 21189, 21299, 21408, 21517, 21626, 21735, 21845, 21954, 22063, 22172, 
-        22282, 22391, 22500, 22609, 22718, 22828, 22937, 23046, 23155, 23265, 23374, 23483, 
-        23592, 23701, 23811, 23920, 24029, 24138, 24248, 24357, 24466, 24575, 24684, 24794, 
-        24903, 25012, 25121, 25231, 25340, 25449, 25558, 25667, 25777, 25886, 25995, 26104, 
-        26214, 26323, 26432, 26541, 26650, 26760, 26869, 26978, 27087, 27197, 27306, 27415, 
-        27524, 27634, 27743, 27852, 27961, 28070, 28180, 28289, 28398, 28507, 28617, 28726, 
-        28835, 28944, 29053, 29163, 29272, 29381, 29490, 29600, 29709, 29818, 29927, 30036, 
-        30146, 30255, 30364, 30473, 30583, 30692, 30801, 30910, 31019, 31129, 31238, 31347, 
-        31456, 31566, 31675, 31784, 31893, 32002, 32112, 32221, 32330, 32439, 32549, 32658, 
-        -32767, -32658, -32549, -32439, -32330, -32221, -32112, -32002, -31893, -31784, -31675, -31566, 
-        -31456, -31347, -31238, -31129, -31019, -30910, -30801, -30692, -30583, -30473, -30364, -30255, 
-        -30146, -30036, -29927, -29818, -29709, -29600, -29490, -29381, -29272, -29163, -29053, -28944, 
-        -28835, -28726, -28617, -28507, -28398, -28289, -28180, -28070, -27961, -27852, -27743, -27634, 
-        -27524, -27415, -27306, -27197, -27087, -26978, -26869, -26760, -26650, -26541, -26432, -26323, 
-        -26214, -26104, -25995, -25886, -25777, -25667, -25558, -25449, -25340, -25231, -25121, -25012, 
-        -24903, -24794, -24684, -24575, -24466, -24357, -24248, -24138, -24029, -23920, -23811, -23701, 
-        -23592, -23483, -23374, -23265, -23155, -23046, -22937, -22828, -22718, -22609, -22500, -22391, 
-        -22282, -22172, -22063, -21954, -21845, -21735, -21626, -21517, -21408, -21299, -21189, -21080, 
-        -20971, -20862, -20752, -20643, -20534, -20425, -20316, -20206, -20097, -19988, -19879, -19769, 
-        -19660, -19551, -19442, -19333, -19223, -19114, -19005, -18896, -18786, -18677, -18568, -18459, 
-        -18350, -18240, -18131, -18022, -17913, -17803, -17694, -17585, -17476, -17367, -17257, -17148, 
-        -17039, -16930, -16820, -16711, -16602, -16493, -16383, -16274, -16165, -16056, -15947, -15837, 
-        -15728, -15619, -15510, -15400, -15291, -15182, -15073, -14964, -14854, -14745, -14636, -14527, 
-        -14417, -14308, -14199, -14090, -13981, -13871, -13762, -13653, -13544, -13434, -13325, -13216, 
-        -13107, -12998, -12888, -12779, -12670, -12561, -12451, -12342, -12233, -12124, -12015, -11905, 
-        -11796, -11687, -11578, -11468, -11359, -11250, -11141, -11032, -10922, -10813, -10704, -10595, 
-        -10485, -10376, -10267, -10158, -10049, -9939, -9830, -9721, -9612, -9502, -9393, -9284, 
-        -9175, -9066, -8956, -8847, -8738, -8629, -8519, -8410, -8301, -8192, -8083, -7973, 
-        -7864, -7755, -7646, -7536, -7427, -7318, -7209, -7100, -6990, -6881, -6772, -6663, 
-        -6553, -6444, -6335, -6226, -6117, -6007, -5898, -5789, -5680, -5570, -5461, -5352, 
-        -5243, -5133, -5024, -4915, -4806, -4697, -4587, -4478, -4369, -4260, -4150, -4041, 
-        -3932, -3823, -3714, -3604, -3495, -3386, -3277, -3167, -3058, -2949, -2840, -2731, 
-        -2621, -2512, -2403, -2294, -2184, -2075, -1966, -1857, -1748, -1638, -1529, -1420, 
-        -1311, -1201, -1092, -983, -874, -765, -655, -546, -437, -328, -218, -109 
-    };
-
-    // AKWF_sin → 600 samples
-    static const int16_t akwf_akwf_bwperfectwaves_akwf_sin[600] PROGMEM = {
-        0, 343, 686, 1029, 1372, 1715, 2057, 2400, 2742, 3084, 3425, 3766, 
-        4107, 4447, 4787, 5126, 5465, 5803, 6140, 6477, 6813, 7148, 7482, 7816, 
-        8149, 8481, 8812, 9142, 9471, 9799, 10126, 10451, 10776, 11099, 11422, 11743, 
-        12062, 12381, 12698, 13013, 13328, 13640, 13952, 14261, 14569, 14876, 15181, 15484, 
-        15786, 16085, 16383, 16680, 16974, 17267, 17557, 17846, 18133, 18418, 18701, 18981, 
-        19260, 19537, 19811, 20083, 20353, 20621, 20886, 21150, 21411, 21669, 21925, 22179, 
-        22431, 22679, 22926, 23170, 23411, 23650, 23886, 24120, 24351, 24579, 24804, 25027, 
-        25247, 25465, 25679, 25891, 26100, 26306, 26509, 26709, 26907, 27101, 27292, 27481, 
-        27666, 27848, 28028, 28204, 28377, 28547, 28714, 28878, 29038, 29196, 29350, 29501, 
-        29648, 29793, 29934, 30072, 30207, 30338, 30466, 30591, 30712, 30830, 30944, 31056, 
-        31163, 31268, 31368, 31466, 31560, 31650, 31738, 31821, 31901, 31978, 32051, 32121, 
-        32187, 32249, 32308, 32364, 32415, 32464, 32509, 32550, 32587, 32622, 32652, 32679, 
-        32702, 32722, 32738, 32751, 32760, 32765, 32767, 32765, 32760, 32751, 32738, 32722, 
-        32702, 32679, 32652, 32622, 32587, 32550, 32509, 32464, 32415, 32364, 32308, 32249, 
-        32187, 32121, 32051, 31978, 31901, 31821, 31738, 31650, 31560, 31466, 31368, 31268, 
-        31163, 31056, 30944, 30830, 30712, 30591, 30466, 30338, 30207, 30072, 29934, 29793, 
-        29648, 29501, 29350, 29196, 29038, 28878, 28714, 28547, 28377, 28204, 28028, 27848, 
-        27666, 27481, 27292, 27101, 26907, 26709, 26509, 26306, 26100, 25891, 25679, 25465, 
-        25247, 25027, 24804, 24579, 24351, 24120, 23886, 23650, 23411, 23170, 22926, 22679, 
-        22431, 22179, 21925, 21669, 21411, 21150, 20886, 20621, 20353, 20083, 19811, 19537, 
-        19260, 18981, 18701, 18418, 18133, 17846, 17557, 17267, 16974, 16680, 16383, 16085, 
-        15786, 15484, 15181, 14876, 14569, 14261, 13952, 13640, 13328, 13013, 12698, 12381, 
-        12062, 11743, 11422, 11099, 10776, 10451, 10126, 9799, 9471, 9142, 8812, 8481, 
-        8149, 7816, 7482, 7148, 6813, 6477, 6140, 5803, 5465, 5126, 4787, 4447, 
-        4107, 3766, 3425, 3084, 2742, 2400, 2057, 1715, 1372, 1029, 686, 343, 
-        0, -343, -686, -1029, -1372, -1715, -2057, -2400, -2742, -3084, -3425, -3766, 
-        -4107, -4447, -4787, -5126, -5465, -5803, -6140, -6477, -6813, -7148, -7482, -7816, 
-        -8149, -8481, -8812, -9142, -9471, -9799, -10126, -10451, -10776, -11099, -11422, -11743, 
-        -12062, -12381, -12698, -13013, -13328, -13640, -13952, -14261, -14569, -14876, -15181, -15484, 
-        -15786, -16085, -16383, -16680, -16974, -17267, -17557, -17846, -18133, -18418, -18701, -18981, 
-        -19260, -19537, -19811, -20083, -20353, -20621, -20886, -21150, -21411, -21669, -21925, -22179, 
-        -22431, -22679, -22926, -23170, -23411, -23650, -23886, -24120, -24351, -24579, -24804, -25027, 
-        -25247, -25465, -25679, -25891, -26100, -26306, -26509, -26709, -26907, -27101, -27292, -27481, 
-        -27666, -27848, -28028, -28204, -28377, -28547, -28714, -28878, -29038, -29196, -29350, -29501, 
-        -29648, -29793, -29934, -30072, -30207, -30338, -30466, -30591, -30712, -30830, -30944, -31056, 
-        -31163, -31268, -31368, -31466, -31560, -31650, -31738, -31821, -31901, -31978, -32051, -32121, 
-        -32187, -32249, -32308, -32364, -32415, -32464, -32509, -32550, -32587, -32622, -32652, -32679, 
-        -32702, -32722, -32738, -32751, -32760, -32765, -32767, -32765, -32760, -32751, -32738, -32722, 
-        -32702, -32679, -32652, -32622, -32587, -32550, -32509, -32464, -32415, -32364, -32308, -32249, 
-        -32187, -32121, -32051, -31978, -31901, -31821, -31738, -31650, -31560, -31466, -31368, -31268, 
-        -31163, -31056, -30944, -30830, -30712, -30591, -30466, -30338, -30207, -30072, -29934, -29793, 
-        -29648, -29501, -29350, -29196, -29038, -28878, -28714, -28547, -28377, -28204, -28028, -27848, 
-        -27666, -27481, -27292, -27101, -26907, -26709, -26509, -26306, -26100, -25891, -25679, -25465, 
-        -25247, -25027, -24804, -24579, -24351, -24120, -23886, -23650, -23411, -23170, -22926, -22679, 
-        -22431, -22179, -21925, -21669, -21411, -21150, -20886, -20621, -20353, -20083, -19811, -19537, 
-        -19260, -18981, -18701, -18418, -18133, -17846, -17557, -17267, -16974, -16680, -16383, -16085, 
-        -15786, -15484, -15181, -14876, -14569, -14261, -13952, -13640, -13328, -13013, -12698, -12381, 
-        -12062, -11743, -11422, -11099, -10776, -10451, -10126, -9799, -9471, -9142, -8812, -8481, 
-        -8149, -7816, -7482, -7148, -6813, -6477, -6140, -5803, -5465, -5126, -4787, -4447, 
-        -4107, -3766, -3425, -3084, -2742, -2400, -2057, -1715, -1372, -1029, -686, -343 
-    };
-
-    // AKWF_squ → 600 samples
-    static const int16_t akwf_akwf_bwperfectwaves_akwf_squ[600] PROGMEM = {
-        0, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        0, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767 
-    };
-
-    // AKWF_tri → 600 samples
-    static const int16_t akwf_akwf_bwperfectwaves_akwf_tri[600] PROGMEM = {
-        218, 437, 655, 873, 1091, 1311, 1529, 1747, 1965, 2183, 2403, 2621, 
-        2840, 3058, 3276, 3494, 3714, 3932, 4150, 4368, 4586, 4806, 5024, 5243, 
-        5461, 5679, 5897, 6117, 6335, 6553, 6771, 6989, 7209, 7427, 7646, 7864, 
-        8082, 8301, 8519, 8738, 8956, 9174, 9392, 9612, 9830, 10049, 10267, 10486, 
-        10704, 10922, 11141, 11359, 11577, 11795, 12015, 12233, 12451, 12670, 12889, 13107, 
-        13325, 13544, 13762, 13980, 14199, 14417, 14636, 14854, 15074, 15292, 15510, 15728, 
-        15947, 16165, 16384, 16602, 16820, 17039, 17257, 17477, 17695, 17913, 18131, 18350, 
-        18568, 18787, 19005, 19223, 19442, 19660, 19880, 20098, 20316, 20534, 20752, 20972, 
-        21190, 21408, 21626, 21845, 22063, 22283, 22501, 22718, 22937, 23155, 23375, 23593, 
-        23811, 24029, 24248, 24466, 24685, 24904, 25122, 25340, 25558, 25778, 25996, 26214, 
-        26432, 26650, 26870, 27088, 27307, 27525, 27743, 27961, 28181, 28399, 28618, 28835, 
-        29053, 29273, 29491, 29710, 29928, 30146, 30364, 30584, 30802, 31020, 31238, 31456, 
-        31676, 31894, 32113, 32331, 32549, 32767, 32549, 32331, 32113, 31894, 31676, 31456, 
-        31238, 31020, 30802, 30584, 30364, 30146, 29928, 29710, 29491, 29273, 29053, 28835, 
-        28618, 28399, 28181, 27961, 27743, 27525, 27307, 27088, 26870, 26650, 26432, 26214, 
-        25996, 25778, 25558, 25340, 25122, 24904, 24685, 24466, 24248, 24029, 23811, 23593, 
-        23375, 23155, 22937, 22718, 22501, 22283, 22063, 21845, 21626, 21408, 21190, 20972, 
-        20752, 20534, 20316, 20098, 19880, 19660, 19442, 19223, 19005, 18787, 18568, 18350, 
-        18131, 17913, 17695, 17477, 17257, 17039, 16820, 16602, 16384, 16165, 15947, 15728, 
-        15510, 15292, 15074, 14854, 14636, 14417, 14199, 13980, 13762, 13544, 13325, 13107, 
-        12889, 12670, 12451, 12233, 12015, 11795, 11577, 11359, 11141, 10922, 10704, 10486, 
-        10267, 10049, 9830, 9612, 9392, 9174, 8956, 8738, 8519, 8301, 8082, 7864, 
-        7646, 7427, 7209, 6989, 6771, 6553, 6335, 6117, 5897, 5679, 5461, 5243, 
-        5024, 4806, 4586, 4368, 4150, 3932, 3714, 3494, 3276, 3058, 2840, 2621, 
-        2403, 2183, 1965, 1747, 1529, 1311, 1091, 873, 655, 437, 218, 0, 
-        -218, -437, -655, -873, -1091, -1311, -1529, -1747, -1965, -2183, -2403, -2621, 
-        -2840, -3058, -3276, -3494, -3714, -3932, -4150, -4368, -4586, -4806, -5024, -5243, 
-        -5461, -5679, -5897, -6117, -6335, -6553, -6771, -6989, -7209, -7427, -7646, -7864, 
-        -8082, -8301, -8519, -8738, -8956, -9174, -9392, -9612, -9830, -10049, -10267, -10486, 
-        -10704, -10922, -11141, -11359, -11577, -11795, -12015, -12233, -12451, -12670, -12889, -13107, 
-        -13325, -13544, -13762, -13980, -14199, -14417, -14636, -14854, -15074, -15292, -15510, -15728, 
-        -15947, -16165, -16384, -16602, -16820, -17039, -17257, -17477, -17695, -17913, -18131, -18350, 
-        -18568, -18787, -19005, -19223, -19442, -19660, -19880, -20098, -20316, -20534, -20752, -20972, 
-        -21190, -21408, -21626, -21845, -22063, -22283, -22501, -22718, -22937, -23155, -23375, -23593, 
-        -23811, -24029, -24248, -24466, -24685, -24904, -25122, -25340, -25558, -25778, -25996, -26214, 
-        -26432, -26650, -26870, -27088, -27307, -27525, -27743, -27961, -28181, -28399, -28618, -28835, 
-        -29053, -29273, -29491, -29710, -29928, -30146, -30364, -30584, -30802, -31020, -31238, -31456, 
-        -31676, -31894, -32113, -32331, -32549, -32767, -32549, -32331, -32113, -31894, -31676, -31456, 
-        -31238, -31020, -30802, -30584, -30364, -30146, -29928, -29710, -29491, -29273, -29053, -28835, 
-        -28618, -28399, -28181, -27961, -27743, -27525, -27307, -27088, -26870, -26650, -26432, -26214, 
-        -25996, -25778, -25558, -25340, -25122, -24904, -24685, -24466, -24248, -24029, -23811, -23593, 
-        -23375, -23155, -22937, -22718, -22501, -22283, -22063, -21845, -21626, -21408, -21190, -20972, 
-        -20752, -20534, -20316, -20098, -19880, -19660, -19442, -19223, -19005, -18787, -18568, -18350, 
-        -18131, -17913, -17695, -17477, -17257, -17039, -16820, -16602, -16384, -16165, -15947, -15728, 
-        -15510, -15292, -15074, -14854, -14636, -14417, -14199, -13980, -13762, -13544, -13325, -13107, 
-        -12889, -12670, -12451, -12233, -12015, -11795, -11577, -11359, -11141, -10922, -10704, -10486, 
-        -10267, -10049, -9830, -9612, -9392, -9174, -8956, -8738, -8519, -8301, -8082, -7864, 
-        -7646, -7427, -7209, -6989, -6771, -6553, -6335, -6117, -5897, -5679, -5461, -5243, 
-        -5024, -4806, -4586, -4368, -4150, -3932, -3714, -3494, -3276, -3058, -2840, -2621, 
-        -2403, -2183, -1965, -1747, -1529, -1311, -1091, -873, -655, -437, -218, 0 
-    };
-
-} // namespace AKWF_BwPerfectwaves
@@ -1,70 +1,1025 @@
-// Auto‑generated AKWF bank. Do not edit manually.
+// Auto‑generated AKWF bank (compressed, see AKWFCodec.h). Do not edit manually.
 
 #pragma once
 #include <Arduino.h>
 
-#include "AKWF_BwSaw_Tables_Part0.h"
-#include "AKWF_BwSaw_Tables_Part1.h"
-#include "AKWF_BwSaw_Tables_Part2.h"
-
 namespace AKWF_BwSaw {
+
     constexpr uint16_t count = 50;
-}
 
-// Return a pointer to the n‑th waveform table in this bank.
-// If index is out of range, returns nullptr and length is set to 0.
-inline const int16_t* AKWF_BwSaw_get(uint16_t index, uint16_t &length) {
-    switch(index) {
-        case 0: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0001;
-        case 1: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0002;
-        case 2: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0003;
-        case 3: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0004;
-        case 4: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0005;
-        case 5: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0006;
-        case 6: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0007;
-        case 7: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0008;
-        case 8: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0009;
-        case 9: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0010;
-        case 10: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0011;
-        case 11: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0012;
-        case 12: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0013;
-        case 13: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0014;
-        case 14: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0015;
-        case 15: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0016;
-        case 16: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0017;
-        case 17: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0018;
-        case 18: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0019;
-        case 19: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0020;
-        case 20: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0021;
-        case 21: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0022;
-        case 22: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0023;
-        case 23: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0024;
-        case 24: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0025;
-        case 25: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0026;
-        case 26: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0027;
-        case 27: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0028;
-        case 28: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0029;
-        case 29: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0030;
-        case 30: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0031;
-        case 31: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0032;
-        case 32: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0033;
-        case 33: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0034;
-        case 34: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0035;
-        case 35: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0036;
-        case 36: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0037;
-        case 37: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0038;
-        case 38: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0039;
-        case 39: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0040;
-        case 40: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0041;
-        case 41: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0042;
-        case 42: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0043;
-        case 43: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0044;
-        case 44: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0045;
-        case 45: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0046;
-        case 46: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0047;
-        case 47: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0048;
-        case 48: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0049;
-        case 49: length = 600; return AKWF_BwSaw::akwf_akwf_bwsaw_akwf_saw_0050;
-        default: length = 0; return nullptr;
-    }
-}
+    // 60000 bytes as int16 → 15299 bytes
+
+    static const uint8_t data[15299] PROGMEM = {
+        0x02, 0xCF, 0xF9, 0xD6, 0xB7, 0x5A, 0xFF, 0xB3, 0x4F, 0xAD, 0xB3, 0x4E, 0xCD, 0xD4, 0x52, 0xF0,
+        0xBA, 0xC9, 0x20, 0xA4, 0xA4, 0x0C, 0x28, 0x12, 0xC2, 0x70, 0x16, 0x90, 0x84, 0x03, 0x1D, 0x7F,
+        0xF2, 0xBF, 0x7C, 0x31, 0x00, 0x00, 0x10, 0x80, 0x00, 0x11, 0x01, 0x08, 0x10, 0x03, 0x03, 0x4C,
+        0xB0, 0x03, 0x4C, 0xBD, 0x0C, 0x84, 0xC5, 0xC4, 0x89, 0x07, 0x2E, 0x04, 0x6B, 0x17, 0xBB, 0xCE,
+        0xF4, 0x18, 0x37, 0x7A, 0x61, 0x60, 0x6B, 0x77, 0x96, 0x34, 0x60, 0xB2, 0xC3, 0x26, 0xBD, 0xC1,
+        0x8D, 0x1E, 0xE7, 0xBB, 0x6B, 0x0A, 0x46, 0x39, 0x64, 0xB8, 0xC1, 0x0D, 0x7B, 0xB6, 0x9A, 0xCB,
+        0x00, 0x6B, 0x77, 0x82, 0xDA, 0x06, 0x58, 0x03, 0x5A, 0x0C, 0xBD, 0x0F, 0x73, 0x5E, 0xEC, 0x0D,
+        0x34, 0x7B, 0xBD, 0xD8, 0xC1, 0x6B, 0x4F, 0x77, 0xA1, 0xAC, 0x0B, 0x5B, 0x77, 0xAD, 0x35, 0x81,
+        0xBB, 0x6B, 0x46, 0x2C, 0xC1, 0x5B, 0x5A, 0xD6, 0x34, 0x03, 0x5A, 0xF7, 0x65, 0x9A, 0xD0, 0x6B,
+        0x5E, 0xED, 0xAB, 0xD3, 0x01, 0x7B, 0x9E, 0x8D, 0x6B, 0x5A, 0x1C, 0xB8, 0x84, 0x61, 0x72, 0x58,
+        0x05, 0xE8, 0xC7, 0x78, 0x5E, 0x81, 0xAD, 0xDE, 0xB0, 0x00, 0x69, 0xAC, 0xB6, 0x80, 0x1E, 0xE6,
+        0xB0, 0x6E, 0xD9, 0x03, 0x2C, 0x03, 0x4C, 0x17, 0xBB, 0x00, 0xD6, 0x43, 0x18, 0xE2, 0x12, 0xE1,
+        0x70, 0x43, 0x17, 0xA6, 0xEF, 0x5B, 0xBC, 0x00, 0x59, 0xA6, 0xB5, 0x80, 0x58, 0xD1, 0xA6, 0xDC,
+        0x19, 0x66, 0x87, 0xB9, 0xAC, 0x05, 0xEA, 0xF4, 0xD3, 0xDC, 0xF3, 0x03, 0x04, 0x00, 0x08, 0x40,
+        0x20, 0x00, 0x43, 0x6B, 0x78, 0xCF, 0x1F, 0xF5, 0xDE, 0xB5, 0xA7, 0xEE, 0x34, 0x4F, 0x32, 0x5B,
+        0x8F, 0x31, 0x5A, 0x01, 0xF6, 0x19, 0x5B, 0x97, 0x68, 0xFC, 0x36, 0x20, 0x02, 0x6F, 0xF7, 0x02,
+        0xFC, 0x6C, 0x64, 0xAA, 0x05, 0xA4, 0x0F, 0x94, 0x4E, 0x50, 0xE8, 0xA3, 0xE2, 0x0F, 0x9C, 0xC2,
+        0x81, 0x41, 0x90, 0x31, 0xE1, 0x5C, 0x1F, 0x03, 0x8D, 0x96, 0x42, 0x88, 0x43, 0x68, 0xC9, 0xF0,
+        0x8D, 0x0B, 0x3C, 0x3A, 0x74, 0x00, 0x50, 0x1D, 0x04, 0x45, 0x08, 0x6A, 0x1A, 0x08, 0xEB, 0xBE,
+        0xA4, 0xC6, 0x51, 0x83, 0xD2, 0xF8, 0x46, 0x11, 0x92, 0x8C, 0x14, 0x84, 0x17, 0x00, 0x2C, 0xEA,
+        0xF1, 0x74, 0x58, 0xF3, 0x63, 0x02, 0xB3, 0x2B, 0x28, 0x4A, 0x37, 0xAD, 0xF5, 0xE7, 0xC6, 0xD4,
+        0x4A, 0x69, 0x0F, 0xBE, 0x1E, 0xE4, 0xD8, 0x37, 0x9A, 0x08, 0xEF, 0x9A, 0x0B, 0x36, 0x25, 0x25,
+        0x12, 0xE7, 0x79, 0xD9, 0x3A, 0x44, 0xD3, 0x0B, 0x35, 0x31, 0x61, 0x16, 0xAE, 0xA4, 0xA2, 0x6A,
+        0x45, 0x18, 0x56, 0x95, 0xA6, 0x38, 0x63, 0x6B, 0xDB, 0x33, 0x90, 0x38, 0xB4, 0xE1, 0x39, 0x56,
+        0x55, 0xB6, 0x78, 0x6A, 0x7B, 0x71, 0xD3, 0x3B, 0x4C, 0x95, 0x1E, 0x17, 0x92, 0x9A, 0x15, 0x80,
+        0xDA, 0x19, 0xA9, 0x8E, 0xF8, 0xB1, 0x26, 0x8A, 0x93, 0x65, 0x07, 0xA6, 0x36, 0xD7, 0x6E, 0x7C,
+        0x39, 0xAA, 0xCA, 0x9C, 0x7A, 0x0C, 0xAC, 0xCB, 0x50, 0x5E, 0x7D, 0xE8, 0xF0, 0x3F, 0xFF, 0xC1,
+        0xAC, 0x80, 0xFA, 0x3B, 0xE5, 0x04, 0x40, 0x64, 0x29, 0xEF, 0x1C, 0xC1, 0xD2, 0x0B, 0xF4, 0xA0,
+        0x4D, 0x11, 0x10, 0x7E, 0x25, 0x81, 0x78, 0x7B, 0x3B, 0x95, 0xB2, 0x15, 0x60, 0x87, 0x54, 0x20,
+        0x94, 0x26, 0xC9, 0x33, 0x04, 0x31, 0x29, 0xE0, 0xE9, 0x91, 0x67, 0x6A, 0x40, 0xCA, 0x62, 0xE3,
+        0x13, 0x92, 0xA4, 0x24, 0xE1, 0x21, 0x20, 0x91, 0xE1, 0xB2, 0x78, 0x06, 0x8D, 0xB2, 0xF2, 0x4A,
+        0x25, 0x92, 0xC4, 0xB5, 0x1A, 0xC4, 0x46, 0xA2, 0x97, 0x07, 0x51, 0x04, 0xA3, 0x82, 0xAB, 0x0F,
+        0x50, 0x70, 0x2A, 0x99, 0x68, 0xAD, 0x5F, 0x53, 0x54, 0x05, 0x08, 0x48, 0xA9, 0xD1, 0xC4, 0xF0,
+        0x4D, 0x23, 0x51, 0x9F, 0x45, 0x9C, 0x1A, 0xBE, 0xA5, 0x55, 0xF5, 0x9C, 0x22, 0x0A, 0x9D, 0x00,
+        0x22, 0x2F, 0x89, 0x18, 0xBC, 0x12, 0x3A, 0xBA, 0x29, 0x18, 0x35, 0x9F, 0x1C, 0xE8, 0x91, 0x55,
+        0x38, 0xDE, 0x81, 0x48, 0x4E, 0xAF, 0x03, 0xDF, 0x9D, 0xF3, 0x64, 0x63, 0x82, 0xE0, 0x4F, 0x19,
+        0xC1, 0x78, 0x6E, 0x2B, 0xBF, 0x8F, 0x7C, 0x31, 0xCB, 0x9D, 0xF2, 0xCB, 0x8B, 0x2F, 0x2A, 0x55,
+        0x70, 0xD2, 0x9D, 0x6E, 0x98, 0x8B, 0xC6, 0xCE, 0x91, 0x65, 0x68, 0xC2, 0x38, 0x67, 0x85, 0xED,
+        0x9F, 0x2D, 0x51, 0x8D, 0x82, 0x39, 0x23, 0x9A, 0x99, 0x9E, 0xA4, 0xC5, 0x3D, 0x95, 0xAB, 0xCC,
+        0xCA, 0xA3, 0x9D, 0x87, 0xDA, 0xBE, 0x02, 0x4F, 0x37, 0xFF, 0x76, 0x98, 0x8A, 0x32, 0x08, 0xEC,
+        0x48, 0x14, 0xB4, 0x14, 0x7E, 0x7D, 0xF1, 0x19, 0x72, 0x2E, 0x53, 0x08, 0xCE, 0xA6, 0x2F, 0x52,
+        0x8C, 0x38, 0x98, 0x43, 0x73, 0x72, 0x6E, 0x00, 0xCB, 0xE3, 0xA5, 0x01, 0xEB, 0x7A, 0x93, 0x45,
+        0xD3, 0x89, 0xA1, 0x41, 0xBF, 0x9B, 0x72, 0x6F, 0x9A, 0x1C, 0x2B, 0x85, 0x38, 0xDF, 0x12, 0x80,
+        0x22, 0x0B, 0x2A, 0x17, 0xC6, 0xF0, 0x41, 0x1A, 0xF7, 0xF1, 0xCE, 0x08, 0xDE, 0x52, 0x4B, 0x9B,
+        0xCB, 0x9B, 0x84, 0x2B, 0xE3, 0x35, 0x30, 0x99, 0xD6, 0xF0, 0x4A, 0x65, 0xAC, 0xC1, 0x89, 0xA7,
+        0x04, 0xA7, 0xAC, 0xA1, 0xCD, 0xE2, 0xE6, 0xE4, 0xDC, 0x94, 0x81, 0x93, 0xDA, 0xF4, 0x8D, 0x22,
+        0x4D, 0x18, 0x04, 0x72, 0xB9, 0xB1, 0xC1, 0x5A, 0x76, 0xAE, 0x15, 0x82, 0xCA, 0x72, 0x89, 0x55,
+        0x64, 0x53, 0x82, 0x44, 0x4E, 0x2E, 0xA4, 0xE0, 0xEC, 0xF4, 0x8A, 0x01, 0x3D, 0xB1, 0xC2, 0x72,
+        0x89, 0x61, 0xD4, 0xA2, 0x20, 0xBA, 0x9D, 0x6F, 0x8E, 0xE0, 0x20, 0x09, 0x05, 0x03, 0xC2, 0x40,
+        0xD0, 0x40, 0x0C, 0x0C, 0x09, 0x03, 0x00, 0x00, 0x63, 0x0C, 0x9B, 0xFF, 0xFF, 0xFF, 0xEB, 0x1A,
+        0xFF, 0x85, 0x15, 0xF7, 0xD1, 0xA7, 0x3A, 0x1A, 0x78, 0xB7, 0xA9, 0x4C, 0x7C, 0x0A, 0xE9, 0x0D,
+        0x17, 0x82, 0x50, 0x35, 0x85, 0x60, 0x82, 0x0D, 0x8B, 0xAD, 0x95, 0x72, 0xC5, 0x09, 0x14, 0x1C,
+        0x91, 0x09, 0xE6, 0xA0, 0x29, 0x09, 0x64, 0x8B, 0x02, 0xB3, 0x0B, 0x20, 0xB1, 0x12, 0xC2, 0x54,
+        0x89, 0x14, 0xE3, 0xA5, 0x9B, 0x92, 0xEC, 0x58, 0x42, 0x12, 0x6B, 0x04, 0x30, 0x23, 0xAA, 0xD1,
+        0xF1, 0x7E, 0x90, 0xE1, 0xF8, 0xCF, 0x48, 0x95, 0x28, 0x51, 0x09, 0x52, 0x31, 0x8B, 0xD1, 0x04,
+        0x31, 0x78, 0x89, 0xD3, 0x50, 0x0C, 0x21, 0x24, 0xB9, 0x8C, 0x70, 0x08, 0xF8, 0x5B, 0xF1, 0xBD,
+        0x67, 0x53, 0x4D, 0x45, 0xE0, 0xBD, 0x0F, 0x72, 0x77, 0xE6, 0xC8, 0x00, 0xC3, 0x0A, 0xF0, 0xCD,
+        0x38, 0x62, 0xA6, 0xA6, 0xB3, 0xC1, 0x5D, 0x4E, 0x39, 0xF5, 0xB8, 0x53, 0x8C, 0xEA, 0x51, 0x1E,
+        0x50, 0x07, 0x27, 0xBF, 0x9A, 0xE3, 0x05, 0x0C, 0xDC, 0x0B, 0x8C, 0x0D, 0xF0, 0x5B, 0x93, 0xBE,
+        0x25, 0xC9, 0xB8, 0x5F, 0x85, 0x91, 0x8B, 0x85, 0x30, 0x1E, 0xB7, 0x89, 0xA2, 0x4F, 0x17, 0x57,
+        0xC6, 0xF5, 0x9C, 0x13, 0x0D, 0x12, 0x89, 0xA2, 0xE1, 0x5F, 0x19, 0x80, 0x15, 0xE0, 0x89, 0x11,
+        0x34, 0xEB, 0x38, 0x21, 0xC5, 0x6C, 0xB1, 0x30, 0x8C, 0xF5, 0xEC, 0x02, 0x4E, 0xEF, 0xFB, 0x23,
+        0x21, 0xC0, 0x70, 0x8C, 0xA9, 0x25, 0x66, 0x8C, 0x85, 0xC5, 0x3C, 0x44, 0x41, 0xD2, 0xBF, 0x56,
+        0xB8, 0xC9, 0x7A, 0xDF, 0x8B, 0xC2, 0x09, 0x51, 0x4A, 0x9C, 0x10, 0x83, 0x8B, 0xD5, 0xE9, 0xA4,
+        0x02, 0x44, 0xA1, 0xD3, 0x83, 0x8E, 0xFD, 0x5A, 0x4D, 0x56, 0xCB, 0xD7, 0x78, 0x28, 0x1A, 0xB5,
+        0x02, 0xF8, 0xCD, 0x0B, 0x0D, 0xF3, 0x5E, 0x2E, 0x6F, 0x3B, 0xE6, 0x92, 0x22, 0x1B, 0xC5, 0xA4,
+        0x2F, 0x13, 0x59, 0x2E, 0x37, 0x53, 0x53, 0x17, 0xAD, 0xEB, 0x38, 0x95, 0x65, 0x89, 0x89, 0x45,
+        0x12, 0xEA, 0x62, 0xF5, 0xE4, 0xBD, 0x77, 0xA9, 0x29, 0xA2, 0xB7, 0xC5, 0x85, 0x65, 0x8E, 0x78,
+        0xDF, 0x1C, 0xE2, 0x4D, 0x58, 0x0E, 0x32, 0x5C, 0x77, 0xAB, 0x44, 0x82, 0x2F, 0x8F, 0x3D, 0x6E,
+        0x8B, 0x38, 0x92, 0x17, 0x3C, 0x4B, 0x8B, 0xA7, 0x78, 0x2B, 0x57, 0x8B, 0x28, 0x4A, 0x95, 0x35,
+        0x70, 0x57, 0x0E, 0x6B, 0x3A, 0xEF, 0x8B, 0x22, 0x61, 0x82, 0x64, 0x4D, 0x67, 0x17, 0x38, 0xDE,
+        0xB7, 0x17, 0x82, 0xCA, 0x12, 0x9B, 0x8B, 0x35, 0x33, 0x13, 0x05, 0x9A, 0x39, 0xA9, 0x59, 0xD6,
+        0x4C, 0x39, 0x46, 0x80, 0x18, 0x04, 0x01, 0x60, 0x18, 0x01, 0x80, 0x10, 0x06, 0x0F, 0x52, 0xCE,
+        0xB6, 0xFE, 0x87, 0xFA, 0x29, 0xAB, 0x2C, 0xDE, 0x39, 0x03, 0xA1, 0x1B, 0x5B, 0xCB, 0x9D, 0x65,
+        0x78, 0x40, 0x0C, 0xE7, 0xA3, 0x29, 0x80, 0xAE, 0x68, 0x34, 0x99, 0xCD, 0x25, 0xC2, 0xE9, 0xB4,
+        0xDA, 0x2C, 0x26, 0x0A, 0xCA, 0x8A, 0x52, 0x69, 0x74, 0xA2, 0x07, 0x08, 0x8F, 0x28, 0x1C, 0x7D,
+        0x32, 0xC3, 0x29, 0x4B, 0x24, 0xA4, 0x24, 0xCD, 0x2A, 0x01, 0xD2, 0x0D, 0x08, 0x26, 0x01, 0x91,
+        0xE0, 0x90, 0xA2, 0x50, 0x96, 0x3A, 0x7E, 0x8F, 0x11, 0x1A, 0xA1, 0x85, 0xA4, 0x4A, 0x30, 0xEA,
+        0x11, 0xE3, 0x7A, 0x05, 0x0A, 0x1E, 0xE1, 0x79, 0xD3, 0xCF, 0x5C, 0x51, 0xD2, 0x11, 0x71, 0x98,
+        0x33, 0x56, 0x62, 0xD3, 0x82, 0xDE, 0xB7, 0x52, 0x9A, 0x37, 0x8C, 0xC1, 0xAE, 0xCB, 0xAE, 0xFC,
+        0x6D, 0x18, 0xB5, 0x13, 0x04, 0x80, 0x63, 0x0B, 0xE9, 0x8D, 0x27, 0x6A, 0xC9, 0xE4, 0xE4, 0x42,
+        0x49, 0xC3, 0xC5, 0xE3, 0x7D, 0x5A, 0x0F, 0x07, 0x25, 0xF1, 0xE7, 0x04, 0x55, 0xE2, 0x42, 0x35,
+        0x75, 0x23, 0xE5, 0xB9, 0x2D, 0xF2, 0xCB, 0x8B, 0x02, 0x2A, 0x71, 0x9A, 0x22, 0x75, 0x62, 0x33,
+        0xC6, 0x48, 0xEB, 0x98, 0x4E, 0x1B, 0x42, 0x60, 0xB8, 0x2B, 0xAD, 0xE0, 0x6F, 0x13, 0x1B, 0x85,
+        0x2E, 0x24, 0xC1, 0xE1, 0x7B, 0x67, 0x97, 0xB8, 0x02, 0x3F, 0xFF, 0x87, 0xC0, 0x18, 0x50, 0x01,
+        0x00, 0x84, 0x90, 0x48, 0x6E, 0x65, 0x31, 0x83, 0xCB, 0x18, 0x06, 0xDC, 0xF5, 0x80, 0xD0, 0x70,
+        0x5C, 0x18, 0x3C, 0xD9, 0x18, 0x16, 0x5B, 0x4D, 0x1B, 0x70, 0x71, 0x72, 0xE2, 0x46, 0x17, 0x00,
+        0x03, 0xBC, 0xF7, 0x58, 0x01, 0xEE, 0x68, 0xF7, 0x34, 0xF7, 0x07, 0x2C, 0x4C, 0xB1, 0xCB, 0x13,
+        0x28, 0xE6, 0xF2, 0xE5, 0x23, 0x94, 0x89, 0x81, 0xDA, 0x7B, 0x86, 0x8F, 0x70, 0x06, 0x81, 0xDF,
+        0xEF, 0xEF, 0x00, 0x4C, 0xB3, 0xBD, 0xDE, 0x80, 0xBD, 0xDE, 0xA7, 0xA8, 0xD3, 0x0A, 0x32, 0x2C,
+        0xBC, 0xDE, 0x6F, 0x36, 0x06, 0x96, 0x59, 0x65, 0x78, 0x1D, 0xAF, 0x71, 0xA0, 0x02, 0xC2, 0xE0,
+        0xB9, 0x64, 0xA4, 0x74, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x08, 0x00, 0x10, 0x00, 0x40, 0x02,
+        0x00, 0x03, 0xF0, 0x96, 0xEF, 0x64, 0x0D, 0x91, 0xE9, 0x7B, 0x52, 0x8F, 0xAE, 0xAD, 0x46, 0x9D,
+        0xEA, 0xEB, 0xE9, 0x4F, 0xC6, 0xCA, 0x65, 0x3A, 0xDA, 0x26, 0xBD, 0x92, 0x9C, 0xC4, 0xF1, 0x27,
+        0x86, 0x66, 0xB3, 0x2F, 0x2C, 0xB5, 0x67, 0x1A, 0xA0, 0xB4, 0x4D, 0xA8, 0xE4, 0x4F, 0x56, 0x64,
+        0x2B, 0xE0, 0xEB, 0x02, 0xE7, 0xBC, 0x8F, 0x96, 0xE5, 0x95, 0x99, 0x71, 0xCD, 0x33, 0x4B, 0x51,
+        0xD3, 0x6D, 0xA0, 0xA1, 0x72, 0xFC, 0x9F, 0x0B, 0xA3, 0x9D, 0x1A, 0xEA, 0x8A, 0xE2, 0xCA, 0x61,
+        0x60, 0x34, 0xC3, 0xDF, 0xE3, 0xEF, 0xDA, 0xB1, 0x59, 0x9B, 0x65, 0x96, 0x18, 0xAF, 0x9C, 0xF3,
+        0xCE, 0x22, 0xD4, 0xA6, 0x10, 0x80, 0x8A, 0xC5, 0x4C, 0x47, 0x39, 0x39, 0x80, 0xA9, 0x62, 0x39,
+        0x8E, 0x00, 0x32, 0xE5, 0xC2, 0x02, 0xF3, 0xB6, 0x58, 0xB6, 0x86, 0x4D, 0xE2, 0xC2, 0x39, 0x64,
+        0xB8, 0x16, 0xEF, 0x1D, 0xE0, 0x7B, 0x82, 0x65, 0x23, 0x96, 0x4B, 0x96, 0x40, 0x6C, 0x83, 0x06,
+        0x17, 0x8A, 0xE0, 0x69, 0x65, 0xAC, 0xDF, 0x7E, 0x81, 0x65, 0x96, 0x59, 0x6E, 0xF0, 0xB0, 0xB2,
+        0x59, 0x2E, 0x52, 0x20, 0x7B, 0x80, 0x3B, 0xCA, 0xF0, 0xA9, 0x12, 0x2C, 0x5E, 0x6C, 0x03, 0xBD,
+        0xDA, 0x2D, 0xDA, 0x40, 0xA8, 0xA9, 0xD0, 0x02, 0x4F, 0xFF, 0x93, 0xE8, 0x3B, 0x12, 0x41, 0xA8,
+        0xA3, 0x50, 0xC2, 0x57, 0x1C, 0x9E, 0x86, 0x74, 0xE1, 0xC4, 0xE2, 0xD4, 0x2E, 0x4B, 0xD6, 0x61,
+        0x5A, 0xE6, 0xB6, 0xE2, 0x69, 0xC4, 0x8E, 0xF2, 0x21, 0xBE, 0x3F, 0x78, 0x72, 0xA1, 0x09, 0xE3,
+        0x78, 0x3B, 0xE2, 0x40, 0xA6, 0x6A, 0x4A, 0x78, 0x90, 0x88, 0x9A, 0x9A, 0x9A, 0x9A, 0x91, 0x88,
+        0x01, 0xCD, 0x37, 0xF3, 0xEF, 0x00, 0x84, 0xE2, 0xEA, 0x6A, 0x68, 0x48, 0x15, 0xBE, 0x08, 0x6F,
+        0x8D, 0xF1, 0xBA, 0xA9, 0x13, 0x55, 0xBA, 0x04, 0x24, 0x71, 0xBA, 0x90, 0x28, 0x4D, 0x48, 0xA2,
+        0x9A, 0x91, 0x52, 0x2A, 0x40, 0x15, 0xCE, 0x01, 0x09, 0xAA, 0xDF, 0x1B, 0xA1, 0x35, 0x5B, 0xA9,
+        0xA1, 0x37, 0x2F, 0x0D, 0xE6, 0x9C, 0xDE, 0x1A, 0x10, 0x38, 0x9A, 0xDF, 0x12, 0x05, 0x48, 0xA9,
+        0x24, 0xEA, 0xA4, 0x4D, 0x00, 0x71, 0xBA, 0x9A, 0xAD, 0x00, 0x2C, 0x00, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0x04, 0x00, 0x30, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x50, 0x03, 0x00, 0x0B, 0x00, 0x18,
+        0x00, 0x7F, 0xE4, 0x64, 0xFF, 0xD3, 0x30, 0xBF, 0xFF, 0xCC, 0x4F, 0xC9, 0xB1, 0xA4, 0x59, 0xC8,
+        0x66, 0xCA, 0x40, 0x53, 0x46, 0xB0, 0x47, 0xC5, 0x10, 0x39, 0xC3, 0xE8, 0x2D, 0x43, 0x98, 0x1C,
+        0xC2, 0xB1, 0x79, 0xBE, 0x66, 0x7F, 0x22, 0xAE, 0xD4, 0xFC, 0xA7, 0xEC, 0x23, 0x59, 0x18, 0x80,
+        0x40, 0x31, 0xF0, 0x5E, 0x14, 0xE0, 0xBC, 0x87, 0xB1, 0xF6, 0x5D, 0xA1, 0x43, 0x84, 0xA9, 0x69,
+        0x59, 0x21, 0x46, 0xA5, 0x19, 0xA9, 0x03, 0x90, 0x68, 0x12, 0x85, 0x12, 0x0C, 0xD4, 0x0D, 0x1D,
+        0x8B, 0xE2, 0xFD, 0x28, 0xC5, 0x47, 0x40, 0x6B, 0x14, 0x28, 0xAB, 0xAB, 0xE2, 0xA7, 0xE0, 0xD2,
+        0x85, 0xA5, 0xC1, 0x24, 0x34, 0xF8, 0xA1, 0x0F, 0x8A, 0x14, 0x29, 0x14, 0x0A, 0xA9, 0xC4, 0x05,
+        0xA1, 0x8B, 0xC4, 0x22, 0x2B, 0x48, 0xE0, 0x43, 0xA3, 0x8A, 0x98, 0x45, 0x3E, 0xA6, 0x8A, 0xA0,
+        0x05, 0x50, 0x9A, 0x05, 0x40, 0x0C, 0x5F, 0x13, 0xC4, 0xCE, 0x22, 0xA7, 0x05, 0x74, 0x14, 0x07,
+        0xA0, 0xE2, 0xB3, 0xA4, 0x48, 0x62, 0xF0, 0x51, 0x47, 0x11, 0x9D, 0x2B, 0xC1, 0x4E, 0x9C, 0x38,
+        0x75, 0x0C, 0x42, 0xA3, 0x92, 0xA8, 0x74, 0x55, 0x4C, 0x3A, 0xAB, 0xC6, 0xE8, 0xB8, 0xB7, 0x55,
+        0x34, 0x5D, 0x0A, 0x9A, 0x92, 0x3E, 0x00, 0x70, 0xDE, 0x6F, 0x39, 0xA7, 0x01, 0x03, 0xFE, 0x73,
+        0x79, 0x30, 0x2B, 0xC0, 0x1F, 0x3B, 0xC9, 0xDE, 0x44, 0x22, 0x44, 0x2C, 0x58, 0xC5, 0x8E, 0x8C,
+        0xB8, 0x18, 0xB0, 0x88, 0xA3, 0x4A, 0xC7, 0x40, 0x02, 0x7F, 0xF5, 0x0F, 0xEA, 0xA3, 0xE2, 0x84,
+        0x80, 0x22, 0x40, 0x41, 0x40, 0xA0, 0x00, 0x00, 0x40, 0xA0, 0x20, 0x05, 0x8E, 0x74, 0xDD, 0x34,
+        0xE9, 0xA7, 0x57, 0x44, 0x62, 0xD6, 0x2C, 0xA8, 0x98, 0x9A, 0x69, 0x8E, 0x25, 0xC5, 0x8E, 0x6E,
+        0x77, 0xE6, 0x82, 0xE5, 0x97, 0x16, 0x32, 0xF3, 0x40, 0x63, 0x37, 0xCB, 0x64, 0x16, 0x4B, 0x09,
+        0xD1, 0x69, 0x38, 0x68, 0xC3, 0x8B, 0xA0, 0x4B, 0xFD, 0xFD, 0x82, 0xC4, 0x30, 0x65, 0xF3, 0x5C,
+        0x9B, 0x8C, 0x60, 0xEF, 0xCF, 0x78, 0x2C, 0xCD, 0xCB, 0x88, 0x95, 0x4C, 0x17, 0xAB, 0x41, 0x34,
+        0x13, 0x42, 0x4D, 0xE3, 0x2C, 0x23, 0x7C, 0xEE, 0x41, 0x12, 0xF9, 0x46, 0x66, 0x93, 0x9D, 0x8A,
+        0x09, 0x02, 0x84, 0x19, 0xC1, 0x7A, 0xBF, 0xE9, 0x7B, 0x61, 0x14, 0x09, 0x01, 0x80, 0x1E, 0x90,
+        0xD1, 0x62, 0x0D, 0x64, 0xDD, 0xB4, 0xB0, 0x2C, 0x19, 0x70, 0xB9, 0x64, 0xB1, 0x0F, 0x71, 0x96,
+        0x8D, 0x1B, 0x80, 0x02, 0x80, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40,
+        0x00, 0x00, 0x00, 0xFE, 0x9A, 0x1F, 0xFF, 0x0A, 0x89, 0xF6, 0x38, 0xB9, 0x8E, 0xA0, 0x04, 0xC0,
+        0x8D, 0x41, 0x0A, 0xAF, 0xFC, 0x1F, 0x5F, 0x25, 0xB1, 0x4A, 0x28, 0xA3, 0x8A, 0x18, 0x61, 0x02,
+        0x18, 0x11, 0x62, 0x25, 0xE6, 0xB8, 0x53, 0x28, 0x7E, 0xAD, 0x9E, 0xB6, 0x37, 0x81, 0xC8, 0x07,
+        0x18, 0x72, 0xE4, 0x8E, 0x28, 0x01, 0x00, 0x00, 0x80, 0x02, 0x30, 0x00, 0x88, 0x00, 0x3D, 0x4F,
+        0xF1, 0xFF, 0x08, 0xBB, 0xF7, 0x17, 0xA9, 0x87, 0x86, 0x82, 0x30, 0x46, 0x4A, 0x60, 0x06, 0x77,
+        0x39, 0xA4, 0x1C, 0xD9, 0x18, 0x98, 0x97, 0x8C, 0xA3, 0x97, 0x0D, 0xF2, 0xB0, 0x25, 0xCB, 0x05,
+        0xCA, 0xFC, 0xF6, 0x19, 0xB8, 0x91, 0x43, 0xD4, 0xFD, 0xF3, 0x4D, 0x01, 0x04, 0xD3, 0xC5, 0xA8,
+        0x98, 0x31, 0x74, 0x46, 0x52, 0x4B, 0x1C, 0xDE, 0x37, 0x94, 0x17, 0x9B, 0x8E, 0x6E, 0x5E, 0x69,
+        0xCD, 0x88, 0xF3, 0x63, 0x8B, 0x8B, 0x97, 0x9B, 0x20, 0xD9, 0x1D, 0xF8, 0xD9, 0x19, 0x79, 0xB0,
+        0x92, 0x91, 0x8B, 0x4A, 0x2E, 0x0E, 0x33, 0x52, 0x5A, 0x94, 0xD6, 0x33, 0x02, 0xA4, 0x2A, 0xBD,
+        0x40, 0x1C, 0x24, 0x09, 0x08, 0x05, 0xBC, 0x83, 0xE1, 0x4F, 0xBF, 0x00, 0x02, 0x4F, 0xFF, 0x47,
+        0xFF, 0x60, 0x8A, 0x20, 0x84, 0x20, 0x08, 0xC0, 0x00, 0x84, 0x60, 0x5C, 0x76, 0xF8, 0xED, 0xD0,
+        0x4D, 0xCB, 0x65, 0x9B, 0x15, 0x10, 0x5B, 0x96, 0xCA, 0x0D, 0x04, 0x46, 0xC3, 0x65, 0x8A, 0x59,
+        0x41, 0x1B, 0x9B, 0x15, 0x94, 0x12, 0x88, 0x82, 0x85, 0x9B, 0x96, 0x50, 0xA1, 0xA5, 0xD9, 0xDA,
+        0x95, 0xA0, 0x55, 0xA9, 0xBB, 0xBD, 0x48, 0x12, 0xD5, 0x0A, 0xDC, 0x04, 0x3B, 0x51, 0x5A, 0x04,
+        0x4E, 0xF5, 0x41, 0x02, 0xB4, 0x8E, 0xF7, 0x6E, 0xD0, 0x52, 0x6E, 0x59, 0x73, 0x79, 0x6E, 0x58,
+        0x2B, 0x94, 0xBC, 0xD9, 0x72, 0x91, 0x41, 0x65, 0x6A, 0xF7, 0x3B, 0xD0, 0x59, 0x72, 0xCD, 0xE5,
+        0x18, 0xCB, 0x02, 0xBD, 0xC5, 0xBB, 0x21, 0x58, 0x00, 0x00, 0x10, 0x02, 0x80, 0x30, 0x01, 0x80,
+        0x08, 0xB5, 0xC8, 0x37, 0x9E, 0x0F, 0x97, 0xCE, 0x15, 0x2D, 0x89, 0x87, 0x86, 0x3D, 0x17, 0x06,
+        0x9A, 0x04, 0x7F, 0x72, 0x7C, 0x99, 0xCF, 0x59, 0x1A, 0x74, 0x78, 0x27, 0x8B, 0xC4, 0x21, 0x40,
+        0x70, 0x1C, 0x0E, 0x04, 0x00, 0x80, 0x81, 0xE6, 0xC3, 0xDD, 0xB6, 0xEF, 0x00, 0xCB, 0xF7, 0x3C,
+        0xB6, 0xB3, 0x05, 0xEB, 0x6E, 0xF0, 0xC6, 0x60, 0x5B, 0x0F, 0x76, 0xF7, 0x78, 0x06, 0x6B, 0x65,
+        0xED, 0x33, 0x41, 0xE1, 0xAF, 0x19, 0x78, 0xF0, 0xB1, 0xC1, 0xE6, 0xF0, 0x09, 0x00, 0x49, 0x1C,
+        0xBE, 0x6F, 0x13, 0x19, 0x00, 0x36, 0x63, 0x1E, 0x6E, 0xF0, 0x7A, 0x66, 0x67, 0x96, 0xDA, 0x19,
+        0x23, 0x8F, 0x2E, 0x38, 0x12, 0x03, 0x08, 0x19, 0x2E, 0x62, 0x4C, 0x60, 0x3D, 0x78, 0xD9, 0x9B,
+        0x6B, 0xC0, 0x79, 0x99, 0xB6, 0x66, 0x07, 0xB5, 0xB6, 0xD7, 0xB3, 0x36, 0xC0, 0xCF, 0x36, 0xD7,
+        0x9B, 0xD7, 0xB0, 0x1E, 0x6C, 0xF3, 0xD7, 0x9B, 0xD0, 0xCE, 0x26, 0x48, 0x80, 0x02, 0x3F, 0xFF,
+        0xFF, 0xFE, 0x9A, 0x10, 0x80, 0x21, 0xA1, 0x90, 0x00, 0xA0, 0x86, 0xB5, 0xAC, 0x2F, 0x77, 0xA0,
+        0x35, 0xA6, 0x2C, 0xB3, 0x05, 0x6D, 0x0D, 0x6B, 0x3B, 0xC0, 0xB0, 0xEF, 0x00, 0x00, 0x68, 0x34,
+        0xD0, 0x1A, 0xD3, 0x5E, 0xED, 0x6B, 0x41, 0xAD, 0x7A, 0xB5, 0x96, 0x5E, 0x0A, 0xC5, 0xB5, 0x62,
+        0xF4, 0x05, 0x9A, 0x58, 0xD5, 0x80, 0xD1, 0x66, 0x86, 0xE0, 0xC1, 0xA1, 0xBB, 0x00, 0x68, 0x6A,
+        0xC3, 0x40, 0x34, 0x2D, 0xA1, 0xA0, 0x0D, 0x2C, 0xD0, 0x06, 0x96, 0x68, 0x68, 0xA8, 0x01, 0x00,
+        0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD4, 0x3D, 0x0B, 0xFC, 0x61, 0x6D, 0xCF,
+        0xBE, 0x79, 0x0A, 0x28, 0xC0, 0x72, 0x0B, 0x50, 0x85, 0x3D, 0x74, 0x5E, 0x16, 0x75, 0x3D, 0x35,
+        0x47, 0x90, 0xA3, 0xE9, 0xB8, 0xC4, 0x59, 0x28, 0x91, 0x4D, 0x84, 0xB6, 0xA2, 0xA2, 0x94, 0x8A,
+        0x84, 0x80, 0x68, 0xC9, 0x82, 0x84, 0x49, 0x10, 0x1A, 0x3D, 0xB9, 0x69, 0x96, 0x19, 0x52, 0xD6,
+        0x6B, 0x49, 0xA5, 0x04, 0x2D, 0x45, 0x54, 0x61, 0x2C, 0x2A, 0x4A, 0x28, 0x0E, 0x64, 0xC9, 0x30,
+        0xE1, 0x98, 0xE6, 0x03, 0x98, 0xE4, 0x93, 0x21, 0x26, 0x47, 0xC1, 0x64, 0xC2, 0x43, 0x24, 0x26,
+        0x38, 0x1B, 0x3C, 0xD9, 0xB7, 0xAF, 0x30, 0x71, 0xE0, 0xE4, 0x86, 0x32, 0x42, 0x08, 0x71, 0xCB,
+        0xE5, 0xC7, 0x97, 0x21, 0x00, 0xCF, 0x1B, 0x1B, 0x5B, 0xC3, 0x78, 0xC2, 0x06, 0x39, 0x79, 0x70,
+        0x18, 0xE3, 0x23, 0x8E, 0x5C, 0x8C, 0x01, 0x8F, 0x4C, 0xCB, 0xD6, 0xC1, 0x66, 0xBD, 0x33, 0x5A,
+        0xF0, 0x17, 0xAC, 0x6B, 0xD1, 0xE8, 0x07, 0xA6, 0x59, 0xBB, 0xC6, 0x0B, 0x59, 0xA6, 0xBD, 0x35,
+        0x81, 0x7B, 0xBC, 0xB6, 0xED, 0xA6, 0x02, 0xDA, 0x65, 0x80, 0x18, 0xE5, 0x83, 0x80, 0x02, 0x3F,
+        0xFF, 0xF0, 0xFB, 0x01, 0x91, 0xA1, 0x80, 0x80, 0x00, 0x08, 0x8B, 0x12, 0x6C, 0x65, 0x96, 0x22,
+        0x32, 0xCD, 0xC6, 0x50, 0x41, 0x94, 0x2C, 0xAD, 0x2D, 0xD7, 0xB9, 0x83, 0xB5, 0xDA, 0xDD, 0x9D,
+        0x90, 0x36, 0x31, 0x66, 0xF3, 0x79, 0xDC, 0xB1, 0x0D, 0xC6, 0xAB, 0x56, 0xB7, 0x00, 0xDF, 0x65,
+        0x68, 0x80, 0x47, 0x64, 0xBD, 0xC5, 0xBE, 0x1C, 0x2C, 0x65, 0x8C, 0x59, 0xBC, 0xA2, 0x17, 0x9B,
+        0x12, 0x6E, 0x4D, 0x88, 0x24, 0xD8, 0xE5, 0x06, 0x58, 0x90, 0x55, 0x92, 0xCA, 0x12, 0xC2, 0xE0,
+        0xD8, 0xB9, 0x40, 0x37, 0xCE, 0xF3, 0x70, 0x3B, 0x57, 0xA9, 0x62, 0x77, 0x85, 0x0B, 0x8B, 0x96,
+        0x58, 0x2C, 0x04, 0x1D, 0xEE, 0x69, 0x68, 0x65, 0x85, 0x80, 0x5C, 0xA4, 0xB0, 0x6E, 0x31, 0x47,
+        0x2E, 0x56, 0x38, 0x2A, 0x32, 0xE2, 0x5C, 0x61, 0x41, 0x71, 0x27, 0x70, 0x33, 0xB9, 0x4C, 0x49,
+        0x5C, 0x3A, 0x0E, 0x37, 0x87, 0x09, 0xAE, 0x4E, 0x83, 0x05, 0x72, 0x7C, 0xA7, 0x49, 0xA8, 0xD2,
+        0x7F, 0xFF, 0xD3, 0x18, 0x2B, 0xE2, 0xA7, 0xF7, 0xAA, 0xF9, 0x28, 0x3E, 0x02, 0xC7, 0xB6, 0x16,
+        0x74, 0x13, 0x00, 0x40, 0x01, 0x28, 0x00, 0x00, 0x0A, 0x00, 0x10, 0x00, 0x00, 0x38, 0x01, 0x25,
+        0x1E, 0x70, 0xE0, 0x4C, 0x6F, 0x0D, 0x0C, 0xC4, 0x94, 0x02, 0x33, 0x8B, 0xA6, 0x45, 0xD3, 0xAB,
+        0x11, 0xBC, 0xEF, 0x35, 0x19, 0x65, 0x41, 0xBC, 0xD2, 0x92, 0xCA, 0xCD, 0xE7, 0x70, 0x74, 0x96,
+        0x2E, 0xC8, 0x9B, 0x9B, 0x05, 0x0A, 0xC6, 0x77, 0x9D, 0xCD, 0xE6, 0x82, 0x5C, 0xD8, 0xA3, 0x2C,
+        0xA8, 0x8E, 0x55, 0x8A, 0x33, 0x63, 0x1A, 0x31, 0xB9, 0x65, 0x17, 0x2B, 0x28, 0x21, 0xB9, 0x62,
+        0x88, 0xCB, 0x28, 0x82, 0xE7, 0x79, 0xB1, 0x12, 0xE5, 0x0D, 0xC7, 0x64, 0xEC, 0xED, 0xD8, 0x4A,
+        0x46, 0xCB, 0x26, 0xE6, 0xC4, 0x60, 0x00, 0x40, 0x82, 0x06, 0x13, 0xE1, 0x3E, 0x24, 0x02, 0xCF,
+        0x67, 0x24, 0x1E, 0xBE, 0x82, 0xBB, 0x9B, 0xA2, 0xF9, 0x89, 0xD9, 0x01, 0x29, 0xAE, 0x1C, 0x38,
+        0x72, 0x85, 0xC2, 0x3A, 0xD1, 0xF7, 0x97, 0x24, 0x90, 0xE4, 0xE9, 0x8D, 0xAF, 0xAB, 0x5A, 0xE9,
+        0x0B, 0x03, 0x4F, 0x70, 0xE7, 0x1A, 0x6E, 0x2C, 0x89, 0x37, 0x21, 0x0D, 0x31, 0x6D, 0x7B, 0x82,
+        0x5F, 0xC4, 0x7A, 0x8E, 0xC3, 0x49, 0x25, 0x76, 0xBF, 0x6B, 0x1C, 0x33, 0x85, 0x6B, 0x98, 0x44,
+        0x80, 0xC8, 0xF6, 0x2A, 0xF5, 0x5B, 0x8D, 0xAE, 0x9F, 0x13, 0x47, 0x02, 0x4E, 0x82, 0x4C, 0xA7,
+        0x94, 0x09, 0x03, 0xC2, 0x20, 0x63, 0x23, 0x89, 0xA9, 0xB1, 0xAF, 0x9B, 0x7E, 0x6C, 0x42, 0xA8,
+        0x09, 0x89, 0xA9, 0x68, 0x47, 0x09, 0x40, 0xA9, 0xC3, 0xD3, 0xC7, 0xCB, 0xAE, 0x95, 0x9A, 0x6C,
+        0x1A, 0xB3, 0x6C, 0x4B, 0x26, 0x50, 0x5F, 0x0D, 0x74, 0xD3, 0x0A, 0x4A, 0x26, 0x41, 0x21, 0x7A,
+        0xF8, 0xE3, 0x08, 0x4F, 0x3B, 0xDE, 0xED, 0x91, 0x82, 0xAE, 0x2B, 0x15, 0x41, 0x8B, 0x79, 0x2C,
+        0x91, 0xC3, 0x3C, 0x93, 0x20, 0x96, 0x8D, 0x03, 0x5F, 0xAF, 0xCD, 0x64, 0xA0, 0xDF, 0x79, 0x79,
+        0x79, 0xA6, 0x81, 0x34, 0xBD, 0x63, 0x77, 0x80, 0x77, 0xAD, 0x5E, 0xB4, 0xCD, 0x02, 0xDA, 0x00,
+        0xF7, 0x01, 0xEE, 0xC5, 0xAC, 0x0C, 0x13, 0x76, 0x7B, 0xB5, 0xAC, 0xB0, 0x68, 0x06, 0xAC, 0xD0,
+        0x6B, 0x6F, 0xBF, 0x56, 0x16, 0x60, 0xAC, 0x68, 0xD3, 0x6E, 0xC1, 0x6B, 0x00, 0x00, 0x1E, 0xFB,
+        0xD6, 0xB1, 0x30, 0x02, 0xCD, 0x1B, 0xBF, 0x70, 0x0C, 0xB5, 0xEE, 0xD3, 0xD0, 0x00, 0x33, 0xB3,
+        0xDC, 0x78, 0x6C, 0x73, 0x71, 0xC5, 0xC4, 0x00, 0x03, 0x4D, 0x64, 0xF7, 0x07, 0x2C, 0x19, 0x2C,
+        0x88, 0xE1, 0x46, 0x46, 0x24, 0x4C, 0xB1, 0x32, 0x8C, 0x1C, 0xB8, 0x83, 0x8C, 0x65, 0x0F, 0x4D,
+        0x6B, 0x2C, 0x9E, 0xE0, 0xC0, 0x37, 0x7A, 0x34, 0x1A, 0xD1, 0xB7, 0x6B, 0x17, 0x86, 0xC7, 0x12,
+        0x5C, 0xB9, 0x70, 0x60, 0xDC, 0x18, 0xC6, 0x01, 0x78, 0xA3, 0x8B, 0x96, 0x4B, 0x97, 0x12, 0x31,
+        0x41, 0x08, 0x10, 0x00, 0x08, 0x00, 0x63, 0x6C, 0xF2, 0xBC, 0xFF, 0xBD, 0xEB, 0xB1, 0xFC, 0x2C,
+        0x14, 0x39, 0x34, 0x0F, 0x7E, 0xB7, 0x47, 0xFA, 0xCB, 0x99, 0x7A, 0xFF, 0x8C, 0xE0, 0x02, 0x3F,
+        0xFF, 0xED, 0xFB, 0x20, 0x80, 0x12, 0x1A, 0x0A, 0x09, 0x1A, 0x09, 0xB2, 0x54, 0x36, 0x15, 0x2E,
+        0x0E, 0xA0, 0x8D, 0xCA, 0x29, 0x3A, 0x3C, 0xB7, 0x2C, 0xA4, 0xA0, 0xCA, 0x06, 0xEB, 0xDC, 0x25,
+        0xA9, 0x85, 0xB9, 0x61, 0x60, 0x83, 0x2C, 0x08, 0x9B, 0xB2, 0xDD, 0x7A, 0x04, 0xD4, 0x16, 0xEC,
+        0x81, 0xB8, 0x59, 0x6F, 0xB6, 0xB4, 0x2B, 0x89, 0x79, 0x6F, 0x16, 0x58, 0x86, 0xEF, 0x53, 0x45,
+        0xBB, 0x21, 0x32, 0xB9, 0x59, 0x16, 0x32, 0xC1, 0x05, 0xC4, 0xB8, 0x5C, 0xB9, 0xB8, 0x2B, 0x96,
+        0x2F, 0x36, 0x24, 0x40, 0x4B, 0xCB, 0x2E, 0x6F, 0x29, 0x37, 0xCD, 0x06, 0x0D, 0xF9, 0xEE, 0x31,
+        0x25, 0x8C, 0x11, 0x1C, 0xB2, 0x56, 0x12, 0x98, 0x3B, 0xCA, 0x5F, 0x37, 0x37, 0x1C, 0xD8, 0x23,
+        0x13, 0x37, 0x2C, 0x18, 0xC4, 0x94, 0x00, 0xC0, 0x20, 0x03, 0x00, 0x03, 0xB6, 0x97, 0xFC, 0x4D,
+        0xFA, 0x85, 0x96, 0x9A, 0x8C, 0xC4, 0x95, 0x5F, 0x42, 0xA2, 0x40, 0x1B, 0xC0, 0xFA, 0x44, 0xE3,
+        0x69, 0xB0, 0x93, 0xD5, 0x9A, 0xF9, 0x61, 0x55, 0xFA, 0xAF, 0x92, 0x89, 0xAC, 0x24, 0x86, 0xF5,
+        0x35, 0xE7, 0x87, 0xEF, 0xE8, 0xBE, 0x13, 0xC3, 0xEE, 0xE8, 0xAB, 0x56, 0x4D, 0x1B, 0x78, 0xDD,
+        0xB3, 0xCB, 0x83, 0xE0, 0x33, 0x5D, 0x15, 0xBC, 0x2F, 0xA5, 0xF3, 0x3D, 0xEE, 0xE6, 0xAC, 0xFB,
+        0x0A, 0xEC, 0xF6, 0x93, 0x51, 0x88, 0xA2, 0x4C, 0x2D, 0xA0, 0xE9, 0xF0, 0xB9, 0x1C, 0x3D, 0x8C,
+        0xBA, 0xD0, 0xA6, 0x1C, 0x46, 0x48, 0x47, 0x3C, 0x4C, 0xAA, 0x1E, 0xED, 0x7B, 0xB8, 0x37, 0xE8,
+        0xC3, 0x44, 0x43, 0x9E, 0x91, 0x12, 0x42, 0x55, 0x12, 0x8F, 0x0D, 0x73, 0xDF, 0x6C, 0x6B, 0x49,
+        0x91, 0x24, 0x07, 0xB6, 0x14, 0x82, 0x1A, 0xD6, 0x77, 0x8C, 0x5D, 0x8E, 0x05, 0xAC, 0x6B, 0x18,
+        0x10, 0x5C, 0xCC, 0xB6, 0x40, 0xC9, 0xCC, 0xF1, 0xF0, 0x72, 0x9A, 0x6C, 0x17, 0x2F, 0x0E, 0x39,
+        0x23, 0x17, 0x34, 0x35, 0xAD, 0x9F, 0xA6, 0xD6, 0xB0, 0x97, 0x1C, 0xBC, 0xB2, 0x10, 0x20, 0x0B,
+        0x65, 0xB4, 0xF0, 0x78, 0x6E, 0x4B, 0x0C, 0xB2, 0x32, 0x00, 0x1E, 0xEF, 0x17, 0x86, 0x36, 0x84,
+        0xC4, 0xC6, 0x4B, 0xC5, 0xC8, 0xC0, 0xEF, 0xCC, 0x5E, 0x31, 0x81, 0xCB, 0x83, 0xC6, 0x00, 0x02,
+        0xDF, 0x92, 0xC5, 0xD6, 0x7D, 0xE1, 0x91, 0xEA, 0xB3, 0x4E, 0x4D, 0x80, 0x14, 0xCD, 0xE9, 0xF4,
+        0x05, 0x89, 0x89, 0x64, 0x15, 0x98, 0x19, 0x60, 0x48, 0x04, 0x3A, 0x04, 0xD0, 0x2C, 0xED, 0xC7,
+        0x7D, 0xBC, 0x8C, 0xBC, 0xFC, 0x9C, 0x9B, 0xF8, 0x36, 0xED, 0x52, 0xAB, 0x3E, 0x7C, 0xB9, 0xE3,
+        0x3B, 0xAA, 0x90, 0x14, 0x25, 0x2A, 0x53, 0x0D, 0x28, 0x93, 0x49, 0x14, 0x93, 0x4D, 0x24, 0x94,
+        0x49, 0x24, 0xD2, 0x4D, 0x23, 0x92, 0xA8, 0x9D, 0x24, 0x50, 0x44, 0xC8, 0x19, 0x13, 0x90, 0xE5,
+        0x38, 0xE5, 0x26, 0xA3, 0x51, 0x92, 0x0C, 0xCD, 0x01, 0x82, 0x0E, 0x4C, 0xE3, 0xC7, 0x97, 0x38,
+        0xC1, 0xE1, 0x3A, 0xBC, 0x4D, 0x34, 0x98, 0x89, 0x48, 0x8B, 0x9B, 0x00, 0x63, 0x71, 0x8A, 0x20,
+        0x02, 0xF3, 0x63, 0x2F, 0x37, 0x03, 0x80, 0xB2, 0xDD, 0xFA, 0xE1, 0x84, 0xDE, 0x2C, 0x1C, 0x6E,
+        0x08, 0xC7, 0x9B, 0x2E, 0x4B, 0x0B, 0xC5, 0x81, 0xAB, 0xD3, 0x5B, 0xB6, 0x5A, 0x0C, 0xEF, 0xD0,
+        0xDD, 0x8F, 0x70, 0x4C, 0xB8, 0xA6, 0x2F, 0x9D, 0x92, 0xF0, 0x6C, 0x18, 0xE3, 0x2C, 0x97, 0x18,
+        0x21, 0x2C, 0x2F, 0x94, 0x09, 0x71, 0x1C, 0xA4, 0x8A, 0x63, 0x16, 0x44, 0x65, 0x98, 0xB1, 0x8E,
+        0x5C, 0x65, 0x19, 0x18, 0xCB, 0x82, 0x4C, 0xEF, 0x9D, 0x2A, 0x70, 0x62, 0xE8, 0xC5, 0xE2, 0x68,
+        0x98, 0x1D, 0xF3, 0x4E, 0x6C, 0x89, 0x12, 0x30, 0x4B, 0xC5, 0xCB, 0x97, 0x17, 0x94, 0x05, 0xE5,
+        0x8C, 0x0B, 0xE6, 0xC0, 0x88, 0x1A, 0x69, 0x96, 0xB6, 0xF8, 0x7C, 0xD9, 0x37, 0xCA, 0xE0, 0x21,
+        0x01, 0x96, 0x17, 0x85, 0xCB, 0xCE, 0xF0, 0x60, 0xDC, 0x94, 0x80, 0xC1, 0xE6, 0xC8, 0x37, 0x9B,
+        0x83, 0x18, 0xC1, 0x82, 0x39, 0x63, 0xCA, 0x04, 0x65, 0xE5, 0x07, 0x28, 0x61, 0x72, 0xC3, 0x3D,
+        0xF0, 0x46, 0x0C, 0xB8, 0xF3, 0xB3, 0x9B, 0x19, 0x02, 0xB6, 0x99, 0xDB, 0x2C, 0x02, 0xCB, 0xD5,
+        0x9E, 0xE0, 0x1C, 0xA6, 0x5B, 0xF3, 0x60, 0x9C, 0xD9, 0x8C, 0x14, 0x10, 0x20, 0x60, 0x81, 0x00,
+        0x02, 0xFB, 0x4F, 0xCD, 0x79, 0xDF, 0xBA, 0xF8, 0x99, 0x6F, 0xCC, 0x68, 0x9B, 0xA4, 0xBF, 0x1E,
+        0xFA, 0xB8, 0xC4, 0x06, 0x19, 0x89, 0x97, 0xD5, 0x7C, 0x28, 0x40, 0x02, 0xCF, 0xFB, 0xCA, 0xFF,
+        0x1F, 0x37, 0x06, 0xA1, 0xDE, 0x80, 0x22, 0x0A, 0x80, 0x3A, 0x02, 0x3C, 0x1A, 0x00, 0x21, 0x01,
+        0x80, 0x05, 0x80, 0xC4, 0x01, 0x10, 0x13, 0x00, 0xA1, 0x8B, 0x18, 0x88, 0x2C, 0xB6, 0x79, 0xC2,
+        0x76, 0xC1, 0x21, 0x0C, 0x8C, 0xFB, 0x4F, 0xE7, 0xEB, 0x97, 0x19, 0x3D, 0xFF, 0xFE, 0xC7, 0x45,
+        0x34, 0x86, 0x77, 0x08, 0x44, 0x66, 0x10, 0x8D, 0x04, 0x58, 0x30, 0x4B, 0x35, 0x03, 0x21, 0x1D,
+        0xA7, 0xC4, 0x15, 0x83, 0x22, 0x5B, 0xB9, 0x3B, 0xF2, 0x32, 0xDB, 0xA2, 0x07, 0x1E, 0xCB, 0xB9,
+        0x68, 0x72, 0x4A, 0xDD, 0x0F, 0xC7, 0xE4, 0xA7, 0x7F, 0x71, 0x73, 0x8F, 0xC5, 0xDB, 0x02, 0x98,
+        0x38, 0xF0, 0xC7, 0x1C, 0xB6, 0x6B, 0xCA, 0x5F, 0xF5, 0xB9, 0x42, 0x39, 0x9E, 0x5A, 0xD2, 0x5D,
+        0x71, 0x49, 0xB9, 0x2E, 0xAE, 0x70, 0x5A, 0xF9, 0x85, 0xC3, 0x16, 0xB5, 0x71, 0x5A, 0x47, 0x76,
+        0xEA, 0x13, 0xF2, 0xC9, 0x8B, 0x86, 0x24, 0x65, 0xEE, 0xF1, 0x86, 0xA4, 0x67, 0x6E, 0xE3, 0x77,
+        0xF7, 0x57, 0x3D, 0x86, 0xD7, 0x33, 0xB8, 0xEA, 0x52, 0x1F, 0x2E, 0x80, 0xF8, 0xFD, 0x45, 0xF1,
+        0xE2, 0x01, 0x1F, 0xB3, 0xD7, 0xD5, 0xD2, 0xE1, 0xC9, 0x52, 0x0E, 0x83, 0x3C, 0x19, 0x1B, 0x69,
+        0xA6, 0x51, 0xEC, 0x92, 0x58, 0xCF, 0x99, 0x64, 0x22, 0x28, 0xCC, 0x6A, 0x2C, 0x1A, 0xE6, 0xD1,
+        0xC7, 0x5F, 0x23, 0x52, 0x11, 0xE1, 0x5B, 0x08, 0x9A, 0x9C, 0x69, 0x26, 0x58, 0xDB, 0x9D, 0x1E,
+        0x95, 0x79, 0x40, 0xD1, 0x58, 0x80, 0x9E, 0x8C, 0xAA, 0x77, 0x05, 0xD7, 0xAD, 0x02, 0xA9, 0xB7,
+        0x21, 0x96, 0xA0, 0x3D, 0x04, 0xFA, 0x58, 0xB3, 0x12, 0x03, 0x7F, 0x85, 0x06, 0x7F, 0x13, 0x3E,
+        0x13, 0x9D, 0xE3, 0xD7, 0xFA, 0x6D, 0xB8, 0xAF, 0x25, 0xF0, 0xE8, 0x2A, 0xD8, 0x00, 0x30, 0xC8,
+        0xE0, 0xF2, 0xEA, 0xDA, 0x2A, 0x7A, 0xD1, 0x32, 0xED, 0x12, 0xED, 0x29, 0x23, 0x83, 0x29, 0x5A,
+        0xAC, 0xE0, 0x83, 0xB3, 0x49, 0x26, 0xE1, 0xA2, 0xE4, 0x76, 0x3F, 0xE1, 0x9E, 0x7A, 0x79, 0x28,
+        0x30, 0x0A, 0x54, 0x6C, 0xD8, 0x54, 0xB2, 0xCD, 0xDC, 0xBE, 0x4B, 0xC5, 0xCF, 0xD0, 0x65, 0x55,
+        0x0D, 0x83, 0xC7, 0x28, 0x42, 0x48, 0x02, 0x4D, 0x25, 0x3C, 0x8F, 0xFE, 0x3F, 0xB1, 0x51, 0xB8,
+        0xFC, 0xC7, 0x25, 0xC2, 0xAA, 0x6E, 0x59, 0x03, 0xD8, 0x66, 0x21, 0x08, 0xB4, 0x3A, 0x3D, 0x56,
+        0x91, 0xAF, 0x08, 0xC0, 0x1B, 0xA5, 0x65, 0x44, 0x89, 0xA7, 0xA9, 0x0D, 0x55, 0x8C, 0x7C, 0xFB,
+        0x09, 0x57, 0x8B, 0xCA, 0x83, 0x27, 0x23, 0x3E, 0x11, 0x47, 0x8A, 0x92, 0x1B, 0x8F, 0x04, 0x19,
+        0xE2, 0xA3, 0x1A, 0x36, 0x71, 0xA1, 0x88, 0xCA, 0xC4, 0x0C, 0x2B, 0x38, 0x72, 0x37, 0xCB, 0x7D,
+        0x09, 0xE9, 0xCA, 0x72, 0xFE, 0x83, 0x3E, 0x49, 0x3A, 0x4C, 0x05, 0x82, 0x27, 0xB6, 0x89, 0x57,
+        0xEA, 0xF9, 0x43, 0xF5, 0x65, 0xE5, 0x59, 0xCB, 0x63, 0xBD, 0x1A, 0x7C, 0xA3, 0x53, 0x00, 0x28,
+        0x58, 0x3A, 0x57, 0x4F, 0x5B, 0x8E, 0x91, 0x16, 0xE4, 0x90, 0xEB, 0x2B, 0x56, 0x21, 0x89, 0xBC,
+        0xAC, 0x95, 0xC2, 0x2B, 0x26, 0x34, 0x4A, 0x62, 0xDA, 0x7E, 0xBF, 0x1B, 0x0C, 0x17, 0x04, 0xCB,
+        0x6E, 0xFA, 0xBF, 0xD6, 0xF3, 0x86, 0x75, 0x3E, 0xF9, 0x7C, 0x49, 0x20, 0x25, 0xD0, 0xC9, 0x25,
+        0x42, 0x99, 0x88, 0xF4, 0x12, 0x50, 0x41, 0x77, 0xCB, 0xE4, 0x15, 0xBC, 0x5D, 0x22, 0x58, 0xC9,
+        0xA2, 0x15, 0x0A, 0x63, 0x48, 0x7C, 0xA1, 0x0B, 0xA3, 0x84, 0xA6, 0x9A, 0xEC, 0x36, 0xFA, 0x90,
+        0x2F, 0xAD, 0x00, 0xB8, 0xB3, 0x85, 0x8A, 0x94, 0x29, 0xEC, 0x50, 0x59, 0x61, 0x28, 0x0A, 0xA9,
+        0x58, 0x19, 0xFD, 0xF6, 0x53, 0xF8, 0xFE, 0x49, 0x77, 0x1E, 0xDA, 0x0E, 0x0B, 0x6E, 0xA8, 0x12,
+        0xD0, 0xF0, 0x8C, 0xD0, 0x25, 0x2C, 0x30, 0xEA, 0x25, 0xEA, 0xE0, 0xA5, 0x21, 0x05, 0x44, 0x50,
+        0x95, 0xE2, 0xFC, 0x0E, 0x4B, 0xC9, 0x4F, 0xED, 0x51, 0x01, 0x38, 0x49, 0x04, 0xFE, 0x0B, 0x35,
+        0x97, 0xAF, 0x8F, 0xFE, 0x1C, 0xC0, 0x02, 0xCF, 0xFB, 0xC8, 0x7F, 0x20, 0x17, 0x06, 0x21, 0xDE,
+        0x00, 0x72, 0x0F, 0x20, 0x01, 0x00, 0xFC, 0x1A, 0x80, 0x6F, 0x05, 0x00, 0x0F, 0xC0, 0xC8, 0x00,
+        0xE0, 0x09, 0x00, 0xF9, 0x22, 0x47, 0xAA, 0xC8, 0xFD, 0x82, 0x0F, 0x56, 0x64, 0xD9, 0xB9, 0x8B,
+        0xEC, 0x43, 0x47, 0xBB, 0x04, 0x76, 0x1A, 0xAC, 0xD3, 0x4A, 0x0D, 0xC1, 0x4D, 0x49, 0x74, 0xEA,
+        0xDD, 0xC3, 0xA1, 0x41, 0x26, 0x09, 0xCB, 0xA9, 0x9D, 0xFE, 0xA4, 0x0E, 0x9B, 0x26, 0x6A, 0x73,
+        0x03, 0xB7, 0xC4, 0x73, 0xC7, 0xC4, 0x9C, 0xA9, 0x90, 0x94, 0x86, 0x8A, 0xF4, 0x1B, 0xB6, 0xAA,
+        0x13, 0x5E, 0x0B, 0xE6, 0x45, 0x4B, 0x6F, 0x11, 0xF6, 0xF1, 0x46, 0x89, 0x5C, 0x53, 0xB9, 0xAF,
+        0x48, 0x01, 0xA6, 0xE8, 0x21, 0x86, 0xCB, 0xC5, 0x93, 0x84, 0x58, 0xAF, 0xBD, 0x3A, 0xB2, 0x84,
+        0x4E, 0xD6, 0xCC, 0x92, 0xCF, 0x62, 0xEF, 0xD1, 0x6B, 0xD1, 0x97, 0x53, 0x97, 0x9B, 0x2A, 0xF1,
+        0x53, 0x1E, 0xAC, 0x2D, 0xA8, 0x9C, 0x29, 0x63, 0xB0, 0xA1, 0xD5, 0xB9, 0x69, 0x2D, 0x01, 0xD7,
+        0x06, 0xAF, 0x3A, 0x4D, 0x45, 0x6F, 0xD5, 0xAD, 0xBA, 0x21, 0x9D, 0x90, 0xEC, 0xDF, 0xAA, 0xB4,
+        0x84, 0x97, 0x63, 0x2B, 0x11, 0x85, 0x56, 0x52, 0x18, 0x21, 0x9F, 0x02, 0x67, 0x37, 0x05, 0xBA,
+        0x68, 0xD1, 0xDE, 0x8D, 0xDC, 0x21, 0xC9, 0x84, 0x69, 0x4D, 0x9E, 0x5E, 0x83, 0xE1, 0x25, 0xD4,
+        0xAE, 0x65, 0x74, 0xF2, 0x4B, 0x4E, 0x25, 0x12, 0x6C, 0x62, 0x2B, 0xBC, 0x94, 0x92, 0x6A, 0x17,
+        0x1E, 0x12, 0xDA, 0xB4, 0x11, 0x16, 0xAA, 0x08, 0x46, 0x7C, 0xDC, 0xF3, 0x3A, 0x98, 0x06, 0xD0,
+        0xA5, 0x9C, 0xA4, 0xF2, 0x6F, 0x9F, 0x72, 0xF8, 0xE8, 0xDD, 0x9C, 0x76, 0x56, 0xB4, 0xD1, 0x3E,
+        0x1D, 0x01, 0xCF, 0xB9, 0xB4, 0xD0, 0x52, 0x4B, 0x21, 0x67, 0x4C, 0x0D, 0x7C, 0x08, 0x79, 0xE0,
+        0x7A, 0x74, 0x6B, 0x06, 0x06, 0xE3, 0x4E, 0x48, 0xC7, 0x0E, 0x6C, 0xA1, 0xC4, 0xFC, 0x3D, 0x5A,
+        0x43, 0x8A, 0x5E, 0x14, 0xF1, 0x0B, 0x8E, 0xE3, 0x1E, 0x5D, 0x18, 0xCD, 0x10, 0x70, 0xB2, 0xCC,
+        0xA9, 0x70, 0xF2, 0xC1, 0x73, 0xEB, 0xC9, 0x48, 0x09, 0x57, 0x0C, 0x18, 0xB1, 0xA0, 0xB3, 0x61,
+        0xA7, 0x21, 0x70, 0xF0, 0x36, 0xDC, 0xC1, 0x8C, 0xB8, 0x32, 0xA0, 0x74, 0x3F, 0x6E, 0xC2, 0x4F,
+        0x31, 0x2D, 0x05, 0x56, 0xD4, 0x93, 0x24, 0xAE, 0x33, 0xC1, 0x66, 0x51, 0x66, 0xC2, 0xFE, 0x6C,
+        0x2B, 0xB0, 0x29, 0x9E, 0xE7, 0x52, 0x59, 0x0D, 0x5D, 0x8B, 0xAF, 0x41, 0xF4, 0xF4, 0x05, 0x38,
+        0x6A, 0x8A, 0xF5, 0x66, 0xBE, 0xBC, 0x85, 0x86, 0xE5, 0xDB, 0x52, 0x12, 0xDA, 0x88, 0x3C, 0x35,
+        0x32, 0xDC, 0x40, 0xDB, 0x8A, 0x0E, 0xFC, 0x5A, 0x16, 0xB8, 0x98, 0x15, 0xE0, 0xE7, 0x3B, 0x0D,
+        0xA7, 0x24, 0x98, 0x82, 0xA2, 0x42, 0x57, 0xD3, 0x90, 0x6A, 0xEA, 0x39, 0x8B, 0x69, 0x0C, 0x58,
+        0x52, 0x30, 0x4A, 0x8C, 0x90, 0xC7, 0x24, 0x5A, 0xEC, 0x64, 0xE9, 0xD5, 0x6B, 0xEC, 0x2B, 0xE0,
+        0x47, 0x67, 0x82, 0xCB, 0xE2, 0x09, 0xE1, 0xB1, 0xA9, 0xB0, 0xAB, 0x6A, 0x68, 0xB4, 0xFC, 0x5A,
+        0xDB, 0x90, 0x58, 0xF6, 0x43, 0x2D, 0x05, 0x4C, 0x08, 0x29, 0xE4, 0x82, 0x58, 0xEA, 0x25, 0x6E,
+        0x92, 0xD3, 0x60, 0xB6, 0x54, 0xF2, 0x6D, 0x6E, 0x8A, 0x61, 0xC4, 0xEC, 0x28, 0x08, 0x41, 0x03,
+        0xD6, 0xB1, 0x02, 0x9E, 0xD3, 0x13, 0xE4, 0x16, 0x25, 0x5E, 0x46, 0xBA, 0xD9, 0x1F, 0x2F, 0xFB,
+        0x54, 0x4F, 0x4D, 0x42, 0x11, 0x34, 0xC0, 0x09, 0xD1, 0xEF, 0xCB, 0xFF, 0x9D, 0x50, 0x02, 0x2F,
+        0xD7, 0xFD, 0x14, 0x42, 0x04, 0x24, 0xCD, 0x10, 0x77, 0x96, 0x99, 0x35, 0xA0, 0xD6, 0xB5, 0x93,
+        0x26, 0x86, 0x31, 0x8C, 0x63, 0x9B, 0xC5, 0x03, 0x26, 0xB5, 0xAD, 0x6B, 0x02, 0x64, 0xD6, 0xB5,
+        0xAD, 0x0C, 0x12, 0x4A, 0xF3, 0x79, 0x63, 0x10, 0xD6, 0x4C, 0x9A, 0xD6, 0x83, 0x5A, 0xC9, 0x93,
+        0x5A, 0x18, 0xC7, 0x37, 0x8A, 0x41, 0x20, 0x13, 0x5A, 0x64, 0xC4, 0x0C, 0x9A, 0xD3, 0x26, 0x40,
+        0xDA, 0x9A, 0xD3, 0x26, 0x16, 0x31, 0xCD, 0xC6, 0x09, 0x04, 0x1A, 0xD6, 0xB5, 0xAC, 0x98, 0x66,
+        0xCC, 0xDE, 0x58, 0xC6, 0x31, 0x81, 0x64, 0xC9, 0xAD, 0x6B, 0x05, 0xAC, 0x99, 0x35, 0xAF, 0x70,
+        0x00, 0x50, 0x00, 0xC0, 0x01, 0x40, 0x03, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00,
+        0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xFC, 0x4F, 0xBF, 0xFC, 0x34, 0x67, 0x5F, 0x4B, 0x57, 0xDF,
+        0x7F, 0xF0, 0x78, 0xFD, 0xC1, 0xB1, 0xC9, 0xE0, 0xFE, 0x4A, 0x91, 0xE2, 0x0E, 0xE3, 0xA3, 0x10,
+        0x71, 0x36, 0x09, 0xE0, 0x57, 0x04, 0xF0, 0x16, 0x02, 0x20, 0x01, 0x1F, 0xEC, 0x90, 0x12, 0x31,
+        0x8E, 0x68, 0x7E, 0xEC, 0x99, 0x35, 0xAD, 0x06, 0xB5, 0xAD, 0x64, 0xC8, 0x1A, 0xD6, 0xB5, 0xAF,
+        0x53, 0x02, 0x6B, 0x4C, 0x98, 0x81, 0x93, 0x5A, 0x64, 0xC8, 0x18, 0x9A, 0xF7, 0xDB, 0xD4, 0xC2,
+        0xC6, 0x39, 0xB8, 0xC1, 0x20, 0x83, 0x26, 0xB5, 0xAD, 0x6B, 0x08, 0x90, 0x48, 0xE6, 0xF2, 0xC6,
+        0x05, 0x93, 0x26, 0xB5, 0xAC, 0x16, 0xB2, 0x64, 0xD6, 0xB0, 0xB1, 0x8C, 0x95, 0xE2, 0x91, 0x81,
+        0x6B, 0x5A, 0xC9, 0x93, 0x05, 0xAD, 0x6B, 0x5A, 0xD6, 0x42, 0x49, 0x5E, 0x58, 0xC6, 0x31, 0x80,
+        0x99, 0x35, 0xA6, 0x40, 0xC7, 0x78, 0x80, 0x02, 0x3F, 0xFF, 0xD3, 0xD0, 0x85, 0x9C, 0x81, 0x1D,
+        0x23, 0x42, 0x74, 0x18, 0x58, 0x19, 0xB0, 0xCE, 0xCC, 0x60, 0xA1, 0x9E, 0xE6, 0x32, 0xE7, 0xEF,
+        0xC0, 0xC1, 0x65, 0x1F, 0x34, 0xC2, 0x97, 0x93, 0x4A, 0x8C, 0x5C, 0xE8, 0x29, 0x81, 0x73, 0xD0,
+        0x04, 0xA6, 0x06, 0x6A, 0x00, 0x4F, 0x9F, 0x0A, 0x60, 0x81, 0x8F, 0x9F, 0x84, 0x5C, 0x1C, 0xBE,
+        0x20, 0xC1, 0x4A, 0x8F, 0x9F, 0x86, 0x90, 0x6B, 0xCF, 0xA4, 0xD1, 0x25, 0x7D, 0xFC, 0x05, 0x30,
+        0x2F, 0xCF, 0xE8, 0x00, 0x45, 0x2F, 0xBF, 0x49, 0x00, 0x47, 0xDF, 0xF1, 0x29, 0x19, 0x2A, 0x75,
+        0xE8, 0xCE, 0x40, 0x9F, 0x5F, 0x90, 0x01, 0x19, 0x21, 0xF9, 0xFA, 0x80, 0x01, 0x1F, 0xBF, 0xF1,
+        0x34, 0x49, 0xA2, 0xF5, 0xF2, 0x25, 0x20, 0x28, 0xF3, 0xF4, 0x04, 0x74, 0x32, 0x1F, 0x1F, 0x02,
+        0x02, 0x30, 0x2F, 0x3F, 0x65, 0x22, 0x23, 0x56, 0xF8, 0xFB, 0x22, 0x91, 0x16, 0x3C, 0x7E, 0x00,
+        0x46, 0x86, 0x29, 0xF8, 0xFD, 0x80, 0x08, 0xC3, 0xDF, 0xE8, 0xA4, 0x48, 0xE6, 0x5F, 0x3F, 0xB0,
+        0x19, 0x01, 0x1F, 0xE7, 0xFB, 0x01, 0x2A, 0x01, 0x97, 0xE3, 0xF8, 0x09, 0x12, 0x91, 0x7C, 0xFD,
+        0x90, 0x84, 0x8F, 0x80, 0x01, 0x00, 0x2D, 0x00, 0x60, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x20, 0x00,
+        0x00, 0x00, 0x80, 0x07, 0x80, 0x23, 0x00, 0x60, 0x00, 0x10, 0x00, 0x2F, 0xEA, 0x9F, 0xFF, 0xF4,
+        0x99, 0x1C, 0xE0, 0xEE, 0xFF, 0x50, 0xBF, 0xE4, 0xC3, 0x73, 0x15, 0x20, 0x61, 0xD4, 0x8D, 0x15,
+        0x89, 0x4C, 0x40, 0x82, 0x07, 0xA7, 0x08, 0x94, 0x29, 0x00, 0x56, 0x80, 0xBD, 0x02, 0x74, 0x02,
+        0x80, 0x13, 0x0C, 0xA3, 0x59, 0x21, 0x11, 0xFF, 0xCB, 0xDF, 0x99, 0x02, 0x12, 0x1B, 0xFD, 0x3C,
+        0xC9, 0x0C, 0x93, 0xE1, 0xF1, 0x22, 0x20, 0x12, 0x3F, 0x97, 0x9A, 0x91, 0x11, 0x97, 0xE1, 0xF7,
+        0x43, 0x20, 0x45, 0x3F, 0xB7, 0xC4, 0x11, 0x48, 0x8B, 0xDB, 0xE2, 0x82, 0x46, 0x84, 0x7F, 0x0F,
+        0x98, 0x10, 0x23, 0x9F, 0xE5, 0xEA, 0xA4, 0x42, 0xCE, 0x7F, 0x2F, 0x30, 0x54, 0x00, 0x2F, 0x2F,
+        0x10, 0x27, 0x61, 0x23, 0xF6, 0xF8, 0xA0, 0xA1, 0x83, 0xFE, 0x1E, 0x6A, 0x80, 0x46, 0x47, 0xE9,
+        0xE6, 0x8A, 0x40, 0x9D, 0x3B, 0x81, 0x01, 0xA1, 0x78, 0x1F, 0xA9, 0x11, 0x2A, 0x06, 0xDA, 0x89,
+        0x01, 0x18, 0x78, 0x1F, 0x54, 0x52, 0x20, 0x3E, 0xDC, 0x44, 0x8C, 0x90, 0x34, 0x3D, 0xC8, 0x51,
+        0x50, 0x74, 0xD5, 0x00, 0x50, 0xC3, 0x91, 0x7B, 0x90, 0x82, 0x7F, 0x8F, 0x94, 0x40, 0x0B, 0xC1,
+        0x79, 0x41, 0xC1, 0xCF, 0xF8, 0xFC, 0xD1, 0x89, 0x4B, 0xD1, 0x79, 0x69, 0x29, 0x5F, 0x1E, 0x43,
+        0x80, 0xA7, 0xC1, 0x64, 0xA9, 0x4A, 0x2E, 0x04, 0x5C, 0x0E, 0x36, 0x44, 0x42, 0xB8, 0xD6, 0x54,
+        0xC0, 0x89, 0xD5, 0x90, 0x4D, 0x05, 0x74, 0x04, 0x5C, 0x0D, 0x72, 0x3C, 0x49, 0x67, 0x28, 0x02,
+        0xCB, 0x69, 0xBF, 0xFC, 0x95, 0xDF, 0xFF, 0x89, 0x44, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xC0,
+        0x02, 0x00, 0x30, 0x00, 0x80, 0x00, 0x00, 0x20, 0x03, 0x00, 0x00, 0x00, 0xC0, 0x02, 0x25, 0x2B,
+        0x65, 0xB2, 0xA5, 0x41, 0xDC, 0xD2, 0xA3, 0x44, 0xAA, 0x0D, 0x15, 0x54, 0xD8, 0x6E, 0x74, 0x12,
+        0x85, 0xB1, 0xA4, 0xF7, 0x16, 0x8C, 0xD8, 0xD9, 0xB2, 0xCA, 0xAC, 0xA2, 0x3D, 0xF3, 0x4B, 0x36,
+        0x59, 0x56, 0x0D, 0x43, 0xBC, 0xA9, 0xB9, 0x45, 0xA3, 0x8B, 0x66, 0xCB, 0x0B, 0x61, 0x61, 0x36,
+        0x83, 0x57, 0x4D, 0x4C, 0x66, 0x89, 0x11, 0xB0, 0xB2, 0xAE, 0x36, 0x77, 0xC1, 0xB7, 0x3E, 0xFC,
+        0xA0, 0xF7, 0xCA, 0x26, 0x8E, 0x31, 0x3D, 0xF2, 0xC4, 0xF7, 0xE2, 0xA4, 0xB3, 0x87, 0x0E, 0xF0,
+        0x0B, 0x8B, 0x80, 0x47, 0x2F, 0xBF, 0x05, 0x37, 0x88, 0x1D, 0xE0, 0x89, 0xDF, 0x8A, 0xCE, 0xFC,
+        0xA5, 0xCE, 0x8F, 0x8B, 0x1B, 0xCB, 0x07, 0x79, 0x10, 0x8B, 0x84, 0x56, 0xFA, 0x94, 0x04, 0xD1,
+        0x44, 0xE2, 0x69, 0xC0, 0x66, 0x9D, 0x11, 0x9D, 0x08, 0x3B, 0xE0, 0xC3, 0x7C, 0x48, 0xE8, 0xF8,
+        0x01, 0xDF, 0xCA, 0x65, 0x72, 0x08, 0xDF, 0x2E, 0x05, 0x9C, 0xB2, 0x77, 0xC0, 0x12, 0x6F, 0x8C,
+        0x26, 0xF0, 0x8D, 0xF0, 0x12, 0x2E, 0x65, 0xC3, 0x7C, 0x0C, 0x74, 0x7E, 0x5C, 0x26, 0xF8, 0x39,
+        0x3B, 0xE1, 0x88, 0xDE, 0x42, 0x17, 0x32, 0x33, 0x7E, 0x38, 0x2C, 0xBE, 0x38, 0x27, 0x1C, 0x9B,
+        0xC8, 0x24, 0x97, 0x31, 0xC9, 0xBC, 0x86, 0x14, 0x78, 0x64, 0xB3, 0x21, 0x2F, 0x31, 0xC0, 0x77,
+        0xF2, 0xE4, 0x1E, 0x39, 0x25, 0xCC, 0x06, 0x46, 0x71, 0xCB, 0xC3, 0x22, 0x66, 0x09, 0x07, 0x90,
+        0x99, 0x79, 0x0C, 0x28, 0xF8, 0x49, 0x09, 0x31, 0x38, 0x63, 0x80, 0xCF, 0xCC, 0x7F, 0xA7, 0x9E,
+        0x61, 0x90, 0xC8, 0x49, 0x21, 0x8E, 0x62, 0x39, 0x21, 0x86, 0x38, 0x64, 0x31, 0xE0, 0x86, 0x47,
+        0xCB, 0xC7, 0x8E, 0x42, 0x60, 0x36, 0xCF, 0x3C, 0x02, 0x2F, 0xE3, 0x05, 0x91, 0x30, 0x10, 0x76,
+        0x20, 0x08, 0x16, 0xCA, 0x12, 0x5E, 0xC1, 0x1E, 0x2A, 0x86, 0x19, 0xCE, 0xB3, 0x30, 0x5E, 0x39,
+        0x6F, 0x1E, 0x71, 0x36, 0x4E, 0x0C, 0x24, 0xB1, 0x99, 0xC9, 0x52, 0x60, 0xE4, 0x22, 0xC3, 0xC8,
+        0x1B, 0x93, 0xC1, 0x64, 0x01, 0xE1, 0xE3, 0x34, 0xE6, 0x09, 0x81, 0x9D, 0xCC, 0x9E, 0x16, 0x9E,
+        0x41, 0xC2, 0x39, 0x64, 0xE4, 0x8E, 0xE6, 0x60, 0xCE, 0x68, 0xF8, 0x64, 0x88, 0xCC, 0xC1, 0x98,
+        0xE3, 0x70, 0xE6, 0x66, 0x84, 0xE0, 0xE1, 0x22, 0xC9, 0xC9, 0x95, 0x39, 0x07, 0x8E, 0x05, 0xC3,
+        0x9C, 0x96, 0xE4, 0xC1, 0xC2, 0x73, 0x49, 0x33, 0x81, 0xDE, 0x64, 0x2A, 0x01, 0x26, 0xA8, 0xD6,
+        0x25, 0xA8, 0x81, 0xE3, 0x8C, 0xD2, 0x4E, 0x35, 0x70, 0x1C, 0x2C, 0x34, 0xE3, 0x25, 0x77, 0x90,
+        0x72, 0x81, 0xA4, 0x98, 0xB6, 0xF1, 0x1E, 0x2B, 0x36, 0x39, 0x0B, 0xB2, 0x02, 0x65, 0x1A, 0xF1,
+        0x91, 0xE8, 0x65, 0x80, 0x00, 0x02, 0x00, 0x28, 0x00, 0x00, 0x10, 0x03, 0x80, 0x08, 0x02, 0x00,
+        0x10, 0x00, 0x00, 0x20, 0x02, 0x80, 0x2F, 0x04, 0x5F, 0xF8, 0xD4, 0xFF, 0x54, 0xFB, 0xE7, 0xF5,
+        0xFF, 0x98, 0x17, 0xF5, 0x90, 0xBE, 0x35, 0x06, 0xEE, 0x76, 0xCE, 0xA2, 0x9C, 0x72, 0x04, 0x54,
+        0x04, 0x41, 0x8A, 0x15, 0x60, 0x62, 0x03, 0x40, 0x50, 0x5A, 0x9E, 0xFB, 0x73, 0x6C, 0xB9, 0xCD,
+        0xB3, 0x22, 0xF4, 0xF7, 0x76, 0xD6, 0xDD, 0xF5, 0xA1, 0x5A, 0xB3, 0x72, 0x4C, 0xC4, 0xDC, 0xB5,
+        0x22, 0x8F, 0x6E, 0xAA, 0x1E, 0xD4, 0xA3, 0x73, 0x62, 0x8F, 0x60, 0x5B, 0x11, 0x94, 0x69, 0xB1,
+        0xC6, 0xE8, 0x02, 0x32, 0xE8, 0xCB, 0x27, 0x56, 0x23, 0x2C, 0xD9, 0xAC, 0x1C, 0xDD, 0x79, 0xA3,
+        0xCD, 0x96, 0x88, 0x3C, 0xED, 0x62, 0x31, 0x95, 0xAC, 0x71, 0x75, 0x88, 0xC9, 0xA1, 0x6C, 0x25,
+        0x9D, 0x66, 0x0A, 0xB3, 0x4B, 0x1C, 0x36, 0x80, 0x39, 0x43, 0x4B, 0x97, 0xCD, 0x3B, 0x18, 0x31,
+        0x43, 0x58, 0xF1, 0x7A, 0x18, 0x2C, 0xA2, 0x77, 0x0C, 0x6E, 0xC0, 0x18, 0xB2, 0xAA, 0x02, 0x21,
+        0xFE, 0x9D, 0x4A, 0x6C, 0xC1, 0xA9, 0x2C, 0x8E, 0x26, 0x6E, 0x74, 0x59, 0x26, 0xD4, 0x64, 0x61,
+        0x96, 0xF0, 0x9C, 0x28, 0x8F, 0x21, 0x86, 0x50, 0x39, 0x21, 0x41, 0x9C, 0x39, 0x61, 0x37, 0xC3,
+        0x80, 0xA3, 0x99, 0x32, 0xE3, 0x08, 0x79, 0x2A, 0x0F, 0x0E, 0x01, 0x94, 0xC9, 0xE2, 0x50, 0x79,
+        0x26, 0x04, 0x49, 0xC3, 0x9A, 0x03, 0xC7, 0x92, 0x05, 0xCC, 0x33, 0x9A, 0x23, 0xCC, 0x39, 0x70,
+        0xB8, 0x73, 0x04, 0x06, 0x72, 0x12, 0x17, 0x24, 0xF1, 0x5C, 0x19, 0x92, 0x46, 0x04, 0xE1, 0x86,
+        0xE0, 0xCE, 0x42, 0x65, 0x78, 0xF9, 0x01, 0x83, 0x33, 0x31, 0x22, 0x66, 0x67, 0x3A, 0x41, 0x9C,
+        0x98, 0x0C, 0x32, 0x72, 0x5A, 0x07, 0xB0, 0xBB, 0x79, 0xA3, 0xEF, 0x05, 0xB0, 0xBB, 0x5E, 0xCB,
+        0xB8, 0x7C, 0xB3, 0x1A, 0x16, 0x49, 0x3B, 0x28, 0xC8, 0xE5, 0x8D, 0x09, 0x26, 0xD8, 0x46, 0x9A,
+        0x57, 0x56, 0x80, 0x49, 0xCA, 0xB0, 0x01, 0x00, 0x60, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01,
+        0x00, 0x30, 0x02, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x08, 0xFF, 0xF1, 0xAD, 0xFE, 0xA9, 0xBD, 0x00,
+        0x2F, 0xFF, 0x30, 0x2F, 0xEB, 0x15, 0x7C, 0x8A, 0x0B, 0xDC, 0xE5, 0x9C, 0xC5, 0x28, 0xE3, 0x88,
+        0x88, 0x09, 0x02, 0xF4, 0x29, 0xC0, 0xBC, 0x05, 0x00, 0x90, 0x02, 0x0A, 0x7B, 0xB9, 0xB3, 0x37,
+        0x6E, 0x55, 0xCF, 0x28, 0x76, 0xDD, 0xD9, 0xF7, 0x5D, 0x6B, 0xDD, 0xA2, 0xDA, 0xDD, 0x7B, 0x54,
+        0xBE, 0xA8, 0xE8, 0xE8, 0xF5, 0xAD, 0x27, 0x76, 0x88, 0xC6, 0xCD, 0x66, 0xC9, 0x5D, 0x06, 0x25,
+        0xCD, 0x4D, 0x8E, 0x37, 0x41, 0x06, 0x2B, 0x57, 0x26, 0xAD, 0x18, 0xE6, 0xC6, 0xA2, 0x13, 0x6C,
+        0x1B, 0x06, 0x53, 0xB0, 0x02, 0xB4, 0x4C, 0xA0, 0xAA, 0xC9, 0x67, 0x41, 0x63, 0x12, 0xE6, 0xA8,
+        0x66, 0xA3, 0x2C, 0x42, 0xA1, 0x78, 0xDD, 0xC1, 0xB8, 0x2C, 0xD4, 0x0C, 0xB5, 0x01, 0x63, 0xB7,
+        0xCB, 0x67, 0x5C, 0x31, 0xC1, 0x55, 0x09, 0x2F, 0x60, 0x92, 0x6F, 0x2D, 0xA0, 0x02, 0x2F, 0xD6,
+        0x14, 0x92, 0x82, 0x66, 0x1C, 0xC3, 0x1C, 0x65, 0xAE, 0x16, 0x23, 0x48, 0x32, 0x65, 0xB8, 0x70,
+        0x84, 0x65, 0xE0, 0x9C, 0x11, 0xF2, 0xF0, 0xCB, 0x97, 0x11, 0xF0, 0x82, 0x4C, 0x86, 0x17, 0x1E,
+        0x0B, 0xCC, 0xA9, 0xC8, 0x60, 0x44, 0xE0, 0x93, 0x0B, 0x0F, 0x1C, 0x8C, 0x4C, 0x1C, 0xC7, 0x3B,
+        0x99, 0x24, 0x81, 0x73, 0x06, 0x4E, 0x6B, 0x92, 0x4E, 0x59, 0x07, 0x03, 0x3D, 0x97, 0xB7, 0x98,
+        0x60, 0xCF, 0x19, 0x4F, 0x09, 0x0E, 0x56, 0x70, 0x4E, 0x14, 0xC3, 0x87, 0x2E, 0x17, 0x30, 0x64,
+        0xC5, 0x92, 0x66, 0x32, 0x5C, 0xC1, 0x7C, 0x95, 0xC9, 0x92, 0x42, 0x5E, 0x23, 0xCC, 0x65, 0x32,
+        0x30, 0x27, 0x60, 0x38, 0x67, 0x41, 0xF3, 0x72, 0x6C, 0x28, 0x39, 0x0D, 0x19, 0x97, 0x11, 0xB2,
+        0x0B, 0x33, 0xAC, 0x20, 0xC4, 0xD8, 0x8F, 0x05, 0xA6, 0x5C, 0x65, 0x16, 0x05, 0xFA, 0xEE, 0xC0,
+        0x4E, 0x60, 0x00, 0x80, 0x04, 0x00, 0x30, 0x00, 0x00, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x0D, 0x08,
+        0x3E, 0x9A, 0x5E, 0xD3, 0xFA, 0xFF, 0xBE, 0x2F, 0xAE, 0xD8, 0x07, 0xE3, 0x30, 0x76, 0x3F, 0xFF,
+        0x8B, 0x7F, 0x39, 0xC9, 0x9D, 0x19, 0x88, 0x84, 0x8C, 0x15, 0x28, 0xC4, 0x34, 0x26, 0x05, 0x02,
+        0xC1, 0xE0, 0xF0, 0x00, 0xEA, 0xFB, 0xEB, 0xD6, 0xDD, 0xDE, 0xDD, 0xA2, 0xDD, 0x7E, 0xB4, 0xEB,
+        0xAD, 0xEB, 0xA2, 0x9A, 0xFA, 0xD2, 0xAF, 0x4E, 0xD0, 0x53, 0xA7, 0x4D, 0x07, 0xAB, 0x4A, 0x31,
+        0x5A, 0x5C, 0x54, 0x6A, 0x0C, 0xB3, 0x4B, 0x10, 0xA2, 0xA8, 0xC6, 0x6A, 0x80, 0x6F, 0x3A, 0x34,
+        0x70, 0x4D, 0x62, 0x09, 0x4D, 0xC0, 0xB3, 0xFB, 0x70, 0x4E, 0x76, 0x1B, 0xC6, 0xE9, 0x1C, 0xA5,
+        0x96, 0xC1, 0x97, 0x35, 0x63, 0x19, 0xA2, 0x80, 0x6E, 0xE2, 0xD6, 0xE9, 0xC1, 0x92, 0x95, 0x22,
+        0x4D, 0x8E, 0xF0, 0x77, 0x8B, 0x58, 0xC1, 0x2B, 0x10, 0x6A, 0xE6, 0xB5, 0x6E, 0xAC, 0x0C, 0xFA,
+        0x5E, 0x02, 0x2F, 0x5D, 0x41, 0x09, 0xD5, 0x80, 0x4A, 0x40, 0x75, 0x71, 0x8B, 0x29, 0x8E, 0x1C,
+        0x1A, 0x39, 0xC6, 0x30, 0x92, 0x42, 0x0A, 0x63, 0xC6, 0x71, 0x60, 0x64, 0xC1, 0x29, 0x93, 0x08,
+        0xC8, 0x9C, 0x90, 0x52, 0x3C, 0x91, 0xE5, 0x23, 0xE1, 0x04, 0x1C, 0xC0, 0x98, 0xB8, 0x4C, 0xC1,
+        0xA1, 0x30, 0xC8, 0x5C, 0x26, 0x48, 0x36, 0x3C, 0x86, 0x04, 0x64, 0x99, 0x06, 0xC2, 0x4E, 0x38,
+        0xC1, 0x9C, 0x80, 0xE6, 0xCC, 0x7C, 0x08, 0x0F, 0x0E, 0x41, 0x6E, 0x19, 0xCB, 0x91, 0x8C, 0xE6,
+        0x22, 0x38, 0x4E, 0x06, 0x31, 0x3C, 0x90, 0x2B, 0x6F, 0x7A, 0xF0, 0xD3, 0x78, 0x74, 0x64, 0x71,
+        0x63, 0x70, 0xCA, 0x25, 0x8C, 0x81, 0x65, 0x23, 0xE6, 0x8C, 0xEC, 0x7C, 0xA0, 0x54, 0xCB, 0xCA,
+        0x29, 0x64, 0x0B, 0x9B, 0x96, 0xF8, 0xA2, 0x6C, 0x8C, 0x62, 0xD8, 0xE3, 0x06, 0xA5, 0xC0, 0xB8,
+        0xA5, 0x83, 0x80, 0x00, 0x00, 0x15, 0x07, 0xFE, 0x98, 0x5E, 0xD2, 0x9A, 0xFC, 0xBE, 0x2D, 0xAE,
+        0xD6, 0xA7, 0xDF, 0x30, 0x55, 0xE5, 0xA6, 0x71, 0x0A, 0x60, 0xE4, 0x04, 0x40, 0x02, 0xC4, 0xFF,
+        0xF4, 0xFF, 0xE7, 0xDF, 0x56, 0x65, 0x0E, 0x34, 0x94, 0xA3, 0x19, 0x42, 0x32, 0xCC, 0xB7, 0x2B,
+        0x6B, 0x2E, 0xC3, 0x92, 0xC6, 0xFA, 0x69, 0xD9, 0xBB, 0x5D, 0x3B, 0x28, 0xED, 0xD9, 0xAA, 0xDD,
+        0x35, 0x54, 0x6D, 0xAA, 0x34, 0xE9, 0x48, 0x83, 0x5B, 0x12, 0x3B, 0x1D, 0xC4, 0x05, 0xD2, 0x6F,
+        0x2A, 0x2D, 0x32, 0x82, 0xD6, 0x08, 0xB3, 0xB0, 0x62, 0x2D, 0x60, 0xB0, 0xB5, 0xCB, 0x94, 0x1F,
+        0x02, 0xA5, 0x6B, 0x07, 0x76, 0xB7, 0x69, 0x71, 0x60, 0xB6, 0xE1, 0x71, 0x55, 0x22, 0x0C, 0xEB,
+        0x23, 0x36, 0x1B, 0x12, 0x22, 0x6C, 0x48, 0x94, 0x9D, 0xC6, 0x41, 0xBB, 0x00, 0x65, 0x9B, 0x2E,
+        0x08, 0x3E, 0xDA, 0x5B, 0x91, 0x6C, 0x3A, 0xC5, 0xE6, 0xC0, 0x02, 0x2F, 0xFC, 0x51, 0x86, 0x41,
+        0x01, 0x12, 0x14, 0x8C, 0x49, 0x9B, 0xCD, 0xF0, 0x91, 0xC1, 0x18, 0x71, 0xE6, 0xF3, 0x7C, 0x21,
+        0x97, 0x11, 0x93, 0x08, 0x30, 0xE3, 0x8E, 0x08, 0xC9, 0x24, 0x18, 0x72, 0xF9, 0x64, 0x46, 0x4C,
+        0x70, 0xB8, 0x71, 0xC7, 0x10, 0x36, 0xDB, 0x5A, 0xF6, 0x6F, 0x4C, 0x2E, 0x43, 0x02, 0xF8, 0xE4,
+        0x66, 0x50, 0x7B, 0x3C, 0x5B, 0xF5, 0xB3, 0x05, 0xC9, 0x82, 0xE4, 0xC6, 0x47, 0x11, 0xE1, 0x07,
+        0x19, 0x24, 0x7C, 0xB1, 0x1C, 0x73, 0x1C, 0x5C, 0xC7, 0x08, 0xE0, 0xB3, 0x0C, 0x53, 0xC4, 0xCC,
+        0x50, 0x6E, 0x46, 0x36, 0x38, 0x17, 0x2A, 0x24, 0x71, 0x2B, 0x85, 0xCB, 0x8D, 0x16, 0x65, 0x8D,
+        0x72, 0x52, 0x50, 0x0E, 0xCD, 0x50, 0x1D, 0xB8, 0x03, 0x75, 0x7B, 0xB4, 0x50, 0xB9, 0x60, 0xEC,
+        0x8B, 0x94, 0x5B, 0x00, 0x20, 0x03, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x50, 0x04, 0x00,
+        0x00, 0x01, 0x00, 0x10, 0x04, 0xE0, 0x5F, 0xFF, 0x15, 0x7F, 0xEA, 0x0B, 0xCF, 0x72, 0xFF, 0xF2,
+        0xA4, 0xFE, 0xA8, 0xD7, 0xB4, 0xA0, 0x6D, 0xC7, 0xD9, 0xB4, 0x51, 0x8E, 0x38, 0x88, 0x80, 0xA8,
+        0x30, 0xC2, 0x94, 0x0B, 0xC0, 0x70, 0x08, 0x80, 0x30, 0xB3, 0xCD, 0xC8, 0xB7, 0x64, 0xD8, 0xB6,
+        0xE4, 0x6D, 0xA6, 0xDE, 0xD2, 0xDA, 0xED, 0x47, 0x56, 0xB6, 0xE9, 0xA3, 0x5B, 0xA3, 0x3A, 0x27,
+        0x4E, 0xE6, 0xA3, 0x76, 0x0E, 0x8A, 0xB6, 0xE5, 0x94, 0x14, 0x25, 0x9D, 0x4D, 0xD7, 0xB9, 0x07,
+        0x6E, 0xC9, 0xC5, 0xAE, 0x05, 0xB8, 0x8A, 0xB9, 0x62, 0xA0, 0xAC, 0x66, 0xCD, 0xE5, 0x61, 0x66,
+        0x89, 0x2E, 0x59, 0xA3, 0x96, 0x29, 0x46, 0x58, 0xC5, 0xB2, 0x6C, 0x06, 0x80, 0x3B, 0x70, 0xEF,
+        0x5C, 0x12, 0xE3, 0x34, 0x19, 0x71, 0xB9, 0xD1, 0x91, 0x63, 0x62, 0xC9, 0xB9, 0x51, 0x9B, 0xC4,
+        0xA2, 0xE2, 0x16, 0x50, 0x37, 0x67, 0x5A, 0xD6, 0xB8, 0x33, 0x78, 0x8D, 0x80, 0x02, 0x2F, 0xF5,
+        0xFE, 0x12, 0x90, 0x80, 0x70, 0x18, 0x48, 0x48, 0x63, 0x0C, 0x73, 0x29, 0x84, 0x18, 0xE4, 0x49,
+        0x21, 0x25, 0xC7, 0x03, 0xCB, 0x6B, 0x66, 0xF5, 0x6F, 0x04, 0xC7, 0x12, 0x12, 0x49, 0xBC, 0x70,
+        0x2F, 0xD6, 0x9E, 0x3D, 0xBB, 0x60, 0x72, 0x5E, 0x20, 0x66, 0x24, 0x4C, 0x1C, 0x63, 0x8C, 0x09,
+        0xCD, 0xC6, 0x03, 0x84, 0x25, 0x86, 0x49, 0x64, 0x70, 0x0F, 0x5A, 0xD9, 0xE4, 0x7E, 0x81, 0xE1,
+        0x6F, 0x5E, 0x07, 0x86, 0x5C, 0x32, 0x98, 0x3E, 0x56, 0x60, 0x06, 0x6B, 0x32, 0xDF, 0x6B, 0x08,
+        0x81, 0x41, 0xE5, 0x6E, 0x58, 0x22, 0x16, 0x16, 0x39, 0x6B, 0x20, 0xB3, 0x61, 0x59, 0x15, 0x94,
+        0x02, 0x6E, 0xBD, 0xC7, 0x6A, 0x02, 0x52, 0x2D, 0x32, 0xE7, 0x60, 0xA2, 0x65, 0xB9, 0xB9, 0x41,
+        0x16, 0x38, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x80, 0x03, 0x00, 0x18, 0x00, 0xA8, 0x11, 0xF4,
+        0x83, 0xF6, 0x66, 0xD7, 0x65, 0xF1, 0x22, 0x76, 0x82, 0x3E, 0x91, 0x7F, 0x2F, 0x19, 0x7F, 0xFF,
+        0x61, 0xD2, 0x3F, 0x85, 0x79, 0x21, 0x45, 0x16, 0x3E, 0x5E, 0x30, 0x54, 0x18, 0x0E, 0x1A, 0x16,
+        0x06, 0x00, 0x2D, 0xDA, 0xED, 0x4E, 0xB6, 0xEC, 0xE8, 0xCE, 0xCE, 0x9A, 0xD2, 0xBA, 0x5A, 0x8A,
+        0xB5, 0xAD, 0x15, 0xD2, 0x82, 0xD2, 0xAE, 0xC2, 0xA5, 0xA8, 0x0A, 0x4E, 0xD7, 0xBA, 0x57, 0x86,
+        0x91, 0xB1, 0x4C, 0xAA, 0x4A, 0x31, 0x0A, 0x4A, 0xF3, 0x65, 0x18, 0x09, 0x6E, 0xEF, 0x2D, 0xD0,
+        0x12, 0xC9, 0xDE, 0x77, 0x18, 0x54, 0x94, 0x61, 0x65, 0x96, 0x30, 0x77, 0x18, 0x34, 0x8A, 0x5C,
+        0xA6, 0x6B, 0x04, 0x41, 0x26, 0xC5, 0xC5, 0x5C, 0xA3, 0x17, 0x36, 0x58, 0x91, 0x57, 0x04, 0xA0,
+        0xCD, 0xC6, 0x50, 0xB1, 0x06, 0xB7, 0x4B, 0xDD, 0xAA, 0xC0, 0x57, 0xBE, 0xD5, 0xE9, 0x40, 0x0B,
+        0x76, 0xEC, 0x02, 0x2F, 0xFF, 0xFF, 0xFC, 0x04, 0xC0, 0x09, 0x31, 0x02, 0x0D, 0x05, 0xEE, 0xF1,
+        0xE6, 0xDD, 0xB6, 0x07, 0x00, 0x66, 0x49, 0xB9, 0x13, 0x01, 0xC2, 0xC8, 0x13, 0x14, 0x93, 0x28,
+        0xE0, 0xC0, 0x39, 0x61, 0x2F, 0x1C, 0x1B, 0x81, 0x7C, 0xB2, 0x0C, 0x23, 0x07, 0x17, 0x2E, 0x46,
+        0x31, 0x90, 0x82, 0xE2, 0xE2, 0x71, 0xB2, 0x04, 0x81, 0x34, 0xD7, 0xE5, 0x3D, 0x6C, 0x2C, 0x9B,
+        0x8C, 0xC1, 0x4C, 0x66, 0x0D, 0x02, 0x4B, 0x83, 0x01, 0xE6, 0x8F, 0x18, 0xB2, 0x4B, 0xCD, 0x92,
+        0xE0, 0x39, 0x62, 0x19, 0x72, 0xD8, 0xC5, 0x11, 0x94, 0x65, 0xCD, 0x63, 0x28, 0x07, 0x2D, 0xDA,
+        0x9D, 0xEE, 0x01, 0xDB, 0xEC, 0xB7, 0x39, 0xA4, 0x32, 0xA1, 0x72, 0x83, 0xBC, 0x50, 0x59, 0x6E,
+        0x29, 0x1D, 0x8E, 0x50, 0x6E, 0x5B, 0x1C, 0x6C, 0xDC, 0xA0, 0x60, 0x00, 0x00, 0x06, 0x00, 0x29,
+        0xFB, 0xFD, 0x14, 0x7D, 0x91, 0xF5, 0xBA, 0x7C, 0x3A, 0x1D, 0x97, 0x8F, 0x98, 0x5F, 0xAB, 0xBF,
+        0xCC, 0xC2, 0x14, 0x81, 0xC7, 0x08, 0x89, 0x32, 0x7F, 0xF6, 0xFF, 0xE3, 0xD7, 0x36, 0xA7, 0x06,
+        0x31, 0x94, 0x23, 0x21, 0x42, 0x3A, 0xAF, 0x73, 0x56, 0xD4, 0x3A, 0x0A, 0xBB, 0x35, 0x94, 0xD3,
+        0x62, 0x8D, 0x96, 0x96, 0x2D, 0xA4, 0xD8, 0x8B, 0x49, 0xAB, 0x0B, 0x66, 0xF1, 0x05, 0x8A, 0xE5,
+        0x92, 0x81, 0x70, 0x07, 0x0B, 0x2D, 0xDB, 0xB6, 0xF8, 0x79, 0x62, 0x5C, 0xB9, 0x40, 0x0A, 0x38,
+        0xB1, 0x61, 0x36, 0x5C, 0x65, 0x1C, 0xD8, 0x0C, 0xB9, 0x49, 0xB9, 0x34, 0x64, 0xAE, 0x58, 0xE6,
+        0xCB, 0x97, 0x28, 0x99, 0xB2, 0xE2, 0xE3, 0xB2, 0x24, 0x09, 0xDA, 0x05, 0xB9, 0xA0, 0x6F, 0xB5,
+        0xAC, 0xEB, 0x0E, 0x28, 0x71, 0x74, 0x5C, 0x29, 0x53, 0x4D, 0x01, 0x42, 0xE5, 0x23, 0x1A, 0x62,
+        0x83, 0x56, 0xAC, 0xB7, 0x1A, 0x10, 0x2E, 0x5C, 0xA0, 0x02, 0x3C, 0xBF, 0xFF, 0xF9, 0x01, 0x08,
+        0x30, 0x80, 0x20, 0x00, 0x21, 0x8E, 0x00, 0x06, 0x58, 0xE5, 0xCB, 0x82, 0xCB, 0x97, 0x18, 0x03,
+        0x2E, 0x03, 0x10, 0xB8, 0xCC, 0xA3, 0x0B, 0x81, 0xA3, 0xB6, 0x3D, 0xF5, 0xE0, 0x2C, 0x2E, 0x59,
+        0x02, 0xE2, 0xE0, 0x25, 0x8E, 0x53, 0x0B, 0x1C, 0xA0, 0x1E, 0xED, 0x07, 0xB8, 0x2C, 0x01, 0xDE,
+        0x07, 0x7B, 0xBD, 0xC3, 0x85, 0xCA, 0x65, 0xCB, 0x94, 0x00, 0x3D, 0xC0, 0x05, 0x9C, 0x38, 0x14,
+        0xC1, 0x97, 0x29, 0x8A, 0x1E, 0xE1, 0xA3, 0xDD, 0xBE, 0x30, 0x4B, 0xED, 0x65, 0x50, 0xE1, 0x89,
+        0x6E, 0x0A, 0x16, 0x36, 0x0B, 0x17, 0x79, 0xBC, 0xAA, 0x06, 0xC1, 0x02, 0xDC, 0x2C, 0x4B, 0x1B,
+        0xC1, 0xD2, 0x6C, 0x63, 0x2B, 0x2B, 0x01, 0x0D, 0x97, 0x2E, 0x50, 0xB1, 0x2E, 0x00, 0x12, 0x7C,
+        0x7F, 0x42, 0x0F, 0x62, 0x5D, 0x65, 0xDF, 0x0A, 0xD7, 0x63, 0x83, 0xE1, 0x97, 0xC2, 0xEF, 0x13,
+        0x2C, 0x85, 0x18, 0x71, 0x02, 0x20, 0x01, 0x50, 0x2E, 0xD3, 0xFF, 0x2E, 0xBB, 0xB0, 0x48, 0x18,
+        0x4A, 0x30, 0x00, 0x21, 0x38, 0x82, 0x2A, 0xDA, 0x07, 0x73, 0xB9, 0xAC, 0xD0, 0xCF, 0xA3, 0x92,
+        0xE7, 0x68, 0x9D, 0x66, 0xB3, 0x4C, 0xA1, 0x29, 0x87, 0x03, 0x42, 0xC6, 0xE5, 0xE6, 0x98, 0xA0,
+        0x69, 0xA3, 0x4D, 0xF7, 0xAC, 0x16, 0x0B, 0xCD, 0xC6, 0x5E, 0x6C, 0x41, 0xE6, 0xC4, 0x8C, 0x62,
+        0x4D, 0xE2, 0x31, 0x9B, 0x20, 0xC9, 0xBC, 0xD9, 0x11, 0x8C, 0x58, 0x4B, 0x08, 0xEF, 0x11, 0xE6,
+        0xC5, 0xC6, 0x31, 0x96, 0x4D, 0x1E, 0x32, 0xC6, 0x4B, 0x18, 0xE6, 0xF0, 0x6C, 0x5E, 0x57, 0x96,
+        0x2F, 0x2B, 0x03, 0xDF, 0x65, 0xB4, 0xD2, 0xC8, 0x79, 0x58, 0x33, 0x36, 0x44, 0x60, 0x31, 0x18,
+        0x46, 0x39, 0xB3, 0x36, 0x0C, 0x86, 0xF3, 0x78, 0x31, 0x8C, 0x60, 0xC8, 0xB1, 0xE5, 0x02, 0x4F,
+        0x57, 0xFF, 0x50, 0x8C, 0x23, 0x0C, 0x26, 0x28, 0x42, 0x22, 0x84, 0x23, 0x15, 0x4D, 0x8A, 0xCA,
+        0xCD, 0x18, 0xCA, 0xCD, 0x86, 0xF3, 0x65, 0x60, 0xCD, 0xCD, 0x86, 0xF3, 0x60, 0xA3, 0x05, 0x73,
+        0x61, 0xB3, 0x36, 0x0A, 0xC0, 0xF7, 0xD7, 0xA9, 0x65, 0x2C, 0x16, 0x1B, 0xCA, 0xB8, 0xC3, 0x60,
+        0x0B, 0x05, 0xCD, 0x83, 0x0D, 0xE5, 0x06, 0x39, 0xAE, 0x29, 0x8A, 0x30, 0x1D, 0xE0, 0x6C, 0x19,
+        0x95, 0x48, 0x8E, 0x1B, 0x06, 0x16, 0x43, 0x61, 0x83, 0xB0, 0x19, 0x63, 0x96, 0x21, 0x05, 0x19,
+        0x73, 0x79, 0x73, 0x79, 0x46, 0x09, 0xBC, 0xA2, 0x82, 0x85, 0x78, 0x36, 0xC4, 0x36, 0x05, 0x9B,
+        0x97, 0x07, 0x61, 0x46, 0x53, 0x35, 0xCB, 0x60, 0x67, 0x1F, 0x60, 0xFB, 0x1C, 0x1E, 0xFB, 0x1C,
+        0x59, 0xC7, 0x68, 0x01, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x02, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x18, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x57, 0x9E, 0x7F, 0xBE, 0xC2, 0x1A, 0xC1, 0x3E, 0x10,
+        0xCE, 0xC3, 0x47, 0xC1, 0x2F, 0x65, 0xDC, 0xE6, 0x53, 0x0A, 0x40, 0xE1, 0x04, 0x44, 0x02, 0x40,
+        0x5D, 0x82, 0x74, 0x06, 0x25, 0xFE, 0xBF, 0xE3, 0xD4, 0xF3, 0x92, 0x81, 0x59, 0x4C, 0x91, 0x8D,
+        0x53, 0x79, 0xAE, 0x7B, 0xCE, 0xC4, 0x46, 0x55, 0x37, 0x96, 0x68, 0xC0, 0x6B, 0x0D, 0x86, 0xF2,
+        0x8A, 0x30, 0x0F, 0xB2, 0xC6, 0x8B, 0xF7, 0x0B, 0x32, 0xC4, 0x1E, 0x58, 0x84, 0x17, 0x17, 0x2B,
+        0xCB, 0x8C, 0xAF, 0x01, 0xB2, 0x0B, 0x83, 0x06, 0x5C, 0x47, 0x95, 0x81, 0x12, 0x26, 0x6C, 0xC1,
+        0x5C, 0x37, 0x86, 0xF0, 0x18, 0x30, 0x4C, 0xDE, 0x56, 0x65, 0x90, 0xDE, 0x08, 0xC0, 0x88, 0xCC,
+        0x65, 0xCD, 0xE0, 0x2F, 0x2B, 0xCA, 0x48, 0x30, 0x60, 0x1A, 0xF5, 0x8B, 0x7A, 0xBD, 0x60, 0xBC,
+        0x17, 0x1E, 0x59, 0x33, 0x61, 0x06, 0x12, 0x1B, 0xC9, 0x07, 0x96, 0x4C, 0x16, 0x48, 0x3C, 0x24,
+        0x90, 0x79, 0x0A, 0x8A, 0x84, 0x8E, 0x80, 0x02, 0x4E, 0xCF, 0xFF, 0xFD, 0x0A, 0x42, 0x02, 0x13,
+        0x9D, 0x21, 0x1A, 0x4A, 0x32, 0x8B, 0x75, 0xD6, 0xEB, 0xBC, 0xEE, 0xCD, 0x45, 0x57, 0x63, 0xB1,
+        0xDE, 0x7B, 0x14, 0x59, 0xB1, 0xAB, 0x19, 0xB3, 0x44, 0x63, 0x36, 0x59, 0xB2, 0x59, 0xB1, 0xA3,
+        0xCD, 0x88, 0xA4, 0xDE, 0x69, 0x34, 0x2A, 0x94, 0x5A, 0x57, 0x45, 0xD4, 0x85, 0x23, 0x8C, 0x5B,
+        0xCD, 0xC5, 0x23, 0x60, 0x6E, 0x69, 0x4D, 0xBA, 0xDD, 0x86, 0x58, 0x83, 0x2C, 0x96, 0x37, 0x05,
+        0x97, 0x9A, 0x4D, 0xC2, 0x6E, 0x28, 0x24, 0x6E, 0x4D, 0x23, 0x96, 0x6E, 0x41, 0xDC, 0xBC, 0xD0,
+        0x88, 0x32, 0xF3, 0x44, 0xC5, 0x05, 0x08, 0xDB, 0xCD, 0x13, 0x36, 0x50, 0x65, 0x26, 0xE7, 0x70,
+        0x66, 0xE5, 0x14, 0x09, 0xB9, 0xDC, 0x05, 0x73, 0xB8, 0xCB, 0x70, 0x67, 0x70, 0x1B, 0x25, 0x29,
+        0x8A, 0x5C, 0xA4, 0xA0, 0x02, 0x00, 0xC0, 0x20, 0x03, 0x00, 0x80, 0x0C, 0x00, 0x00, 0x10, 0x04,
+        0x00, 0xC0, 0x20, 0x03, 0x00, 0x00, 0x03, 0xEE, 0x8F, 0xFF, 0xFE, 0xF2, 0x73, 0xB0, 0x3E, 0xAF,
+        0x2F, 0x83, 0x63, 0xB0, 0x51, 0xEF, 0x8B, 0xD1, 0x76, 0xF9, 0x95, 0xC2, 0x8C, 0x38, 0xC1, 0x0D,
+        0x00, 0xB0, 0x17, 0x60, 0xA5, 0x01, 0x48, 0x06, 0x8B, 0xFF, 0x1E, 0xA7, 0x3C, 0xD4, 0xA9, 0x08,
+        0xC9, 0x08, 0x76, 0x69, 0x34, 0x9B, 0x1B, 0xCF, 0x48, 0x28, 0xA4, 0xD1, 0x97, 0x9E, 0xE2, 0x89,
+        0x37, 0x16, 0xE2, 0x91, 0xB1, 0x07, 0x7E, 0x9A, 0x34, 0xD0, 0x3C, 0xD3, 0x9A, 0x73, 0x4C, 0x65,
+        0xE6, 0xE0, 0x8C, 0x23, 0x78, 0x84, 0x95, 0xE0, 0xD9, 0x2E, 0x32, 0xC8, 0x46, 0xF1, 0x10, 0x8E,
+        0x29, 0x25, 0xE3, 0x72, 0x0A, 0x44, 0x89, 0xCD, 0xC9, 0xB9, 0x34, 0x73, 0x9A, 0x49, 0x71, 0x84,
+        0x48, 0x89, 0xC6, 0xF1, 0x23, 0x21, 0x37, 0x20, 0xA7, 0x1B, 0xC4, 0x92, 0xF1, 0x88, 0x3C, 0x6F,
+        0xCD, 0x90, 0x89, 0xC6, 0x20, 0xF1, 0xE6, 0xE4, 0x64, 0x38, 0xC7, 0x9A, 0x58, 0x45, 0x2A, 0x98,
+        0x4A, 0x8D, 0x4E, 0x89, 0x2A, 0x34, 0x92, 0xA4, 0x96, 0x12, 0xAA, 0x25, 0x58, 0x3D, 0x42, 0xE8,
+        0x02, 0x5F, 0xFF, 0x81, 0xFD, 0x87, 0x03, 0x66, 0x3C, 0xD8, 0xAC, 0x9E, 0x7A, 0xA4, 0xA6, 0x49,
+        0xA5, 0x7B, 0x7C, 0xCE, 0x5D, 0xE4, 0xB9, 0xB3, 0x36, 0x25, 0xD6, 0xEC, 0xF4, 0x74, 0xA7, 0x41,
+        0x2D, 0x1D, 0xCF, 0x79, 0xEF, 0x34, 0x74, 0x19, 0xB9, 0xDC, 0xB4, 0x0A, 0x14, 0xA3, 0x12, 0xC6,
+        0xC7, 0x78, 0xAB, 0x05, 0x46, 0x2D, 0xC5, 0x2F, 0x34, 0x12, 0xE5, 0x33, 0xB9, 0x40, 0x0A, 0x00,
+        0x76, 0x8E, 0xDB, 0x96, 0x1B, 0x25, 0x79, 0x77, 0x96, 0x31, 0x34, 0x78, 0xB1, 0x62, 0x32, 0x6C,
+        0x41, 0x89, 0x37, 0x9A, 0x11, 0x23, 0x70, 0x54, 0xC5, 0x2E, 0x32, 0xE5, 0x01, 0x9B, 0x80, 0x50,
+        0xCA, 0x46, 0xE0, 0xD6, 0x5C, 0xA1, 0x73, 0x60, 0x6C, 0x10, 0x61, 0xB1, 0x73, 0x79, 0xB3, 0x78,
+        0x3B, 0x18, 0xCD, 0xC7, 0x72, 0x36, 0x22, 0x13, 0x72, 0xC4, 0xB9, 0x79, 0xA1, 0x60, 0x06, 0x00,
+        0x80, 0x00, 0x00, 0x60, 0x00, 0x00, 0x80, 0x06, 0x00, 0x60, 0x08, 0x00, 0x00, 0x06, 0x00, 0x9B,
+        0xC6, 0xFF, 0xBC, 0x7F, 0xF3, 0xE3, 0xE5, 0x8D, 0x7F, 0xF8, 0x49, 0x7F, 0x3E, 0xAB, 0xB8, 0x4F,
+        0x26, 0xDA, 0xAC, 0x9A, 0x28, 0x07, 0x10, 0x43, 0x80, 0x50, 0x16, 0xA1, 0x4A, 0x05, 0x60, 0x3C,
+        0x04, 0xC0, 0x20, 0x3D, 0xED, 0xF7, 0x86, 0xC7, 0x64, 0xD1, 0x46, 0xF3, 0x41, 0x4A, 0x67, 0x72,
+        0x80, 0x97, 0x29, 0x62, 0x16, 0x4A, 0x22, 0xE6, 0xF2, 0xB0, 0xD9, 0x11, 0x88, 0xC7, 0x9B, 0x33,
+        0x64, 0x49, 0x17, 0x07, 0x78, 0xC1, 0x83, 0x33, 0x79, 0x58, 0x38, 0xB8, 0x30, 0xDE, 0x19, 0xB3,
+        0x28, 0xBC, 0xB8, 0xC2, 0xE3, 0x32, 0x99, 0xA1, 0xBC, 0x05, 0x9E, 0x77, 0xB8, 0x70, 0x32, 0x99,
+        0x72, 0xE1, 0x94, 0x07, 0x9B, 0x80, 0x1C, 0xDC, 0xB9, 0x25, 0x06, 0x42, 0x38, 0xCB, 0xC8, 0xC6,
+        0x40, 0xB6, 0xD6, 0xBF, 0x2C, 0xF5, 0x83, 0x8C, 0xC0, 0x30, 0x0C, 0xCB, 0x90, 0x65, 0xF2, 0x39,
+        0x1E, 0x3C, 0x38, 0x9E, 0x0B, 0x3C, 0x0F, 0x89, 0x9F, 0x1E, 0x4E, 0x60, 0x6D, 0x06, 0x44, 0x68,
+        0x33, 0x42, 0x4D, 0x66, 0x95, 0x91, 0xD1, 0x32, 0x69, 0x26, 0xC1, 0x60, 0x02, 0x6F, 0xFD, 0xC7,
+        0xFD, 0xC0, 0xDC, 0x5E, 0xE7, 0x57, 0x5A, 0xD4, 0xD9, 0xF3, 0xE6, 0xCE, 0x93, 0x22, 0x2C, 0xF5,
+        0xAB, 0xDE, 0x2F, 0x18, 0xAC, 0x55, 0x5D, 0xC2, 0x23, 0x7A, 0x74, 0xF6, 0x96, 0xF4, 0x5D, 0xA2,
+        0x77, 0x3A, 0x1B, 0x3D, 0xCD, 0x42, 0xD1, 0x36, 0x1B, 0x15, 0xB1, 0xA1, 0x44, 0x28, 0xA3, 0x2B,
+        0x37, 0x14, 0x6C, 0x4B, 0x94, 0xB9, 0x4B, 0x86, 0x8C, 0xB9, 0xB1, 0x86, 0xF3, 0xDC, 0x8A, 0x83,
+        0x5D, 0xEA, 0x1C, 0x3D, 0xFC, 0x39, 0x4C, 0xA1, 0xBC, 0xA3, 0x01, 0x17, 0x36, 0x31, 0x9B, 0xCD,
+        0x8C, 0x9A, 0x32, 0xF3, 0x71, 0x42, 0x6E, 0x5C, 0x50, 0x07, 0x7B, 0x7C, 0x58, 0x09, 0x4C, 0xB9,
+        0x58, 0x16, 0x42, 0x8B, 0xCA, 0x30, 0x65, 0x63, 0x14, 0x52, 0x23, 0x29, 0x1B, 0x97, 0x9A, 0x25,
+        0xCB, 0x94, 0x05, 0xCA, 0x08, 0xC2, 0xC4, 0x79, 0xEF, 0x0D, 0x91, 0x6C, 0x00, 0x80, 0x04, 0x00,
+        0x40, 0x08, 0x00, 0x80, 0x14, 0x01, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0xB7, 0x7D, 0xFF, 0x75,
+        0xFF, 0xE7, 0x8B, 0xCA, 0xA3, 0xFF, 0x06, 0x4A, 0xFF, 0xFD, 0xDF, 0x76, 0xD1, 0xBB, 0xFE, 0xB2,
+        0xE9, 0x44, 0xA4, 0x38, 0x64, 0x30, 0x0B, 0x05, 0xE8, 0xA1, 0x05, 0x60, 0x80, 0x12, 0x01, 0x80,
+        0x1A, 0x3E, 0xBE, 0xE4, 0x6C, 0x69, 0x72, 0x9A, 0x3C, 0xEE, 0x1B, 0x19, 0xB1, 0x8B, 0x28, 0xCD,
+        0xCA, 0x73, 0x4B, 0x94, 0x31, 0x47, 0x66, 0x50, 0x06, 0x5C, 0xB8, 0xC0, 0xEF, 0x16, 0x3D, 0xC3,
+        0xCF, 0x87, 0x97, 0x2E, 0x00, 0x01, 0x94, 0xE0, 0xEE, 0x5C, 0x0B, 0xC4, 0x32, 0xC9, 0x47, 0x18,
+        0x44, 0x22, 0x73, 0x78, 0xC1, 0xDC, 0x8C, 0x8C, 0x73, 0x78, 0xCC, 0xD1, 0x8F, 0x0B, 0xC4, 0x1E,
+        0x5C, 0x00, 0x43, 0x0B, 0x99, 0x4C, 0xB9, 0x13, 0x05, 0x84, 0x79, 0xB9, 0x1E, 0x59, 0x1E, 0x0D,
+        0xC1, 0xE0, 0x19, 0x70, 0xE2, 0x03, 0xC6, 0x39, 0xCB, 0x39, 0x70, 0xCC, 0xB8, 0x50, 0xF5, 0x3A,
+        0x2A, 0x0D, 0x40, 0x1A, 0x30, 0x49, 0x54, 0x0C, 0x2A, 0x4A, 0xB0, 0x3A, 0x3A, 0x30, 0xA3, 0x42,
+        0x14, 0x68, 0x52, 0xD4, 0xB6, 0x19, 0x65, 0xC1, 0x56, 0x7A, 0x24, 0xE9, 0xD9, 0x9A, 0x9E, 0x70,
+        0x02, 0x74, 0xAF, 0xFF, 0xF9, 0xB2, 0xDF, 0x1D, 0xEB, 0x3B, 0x6C, 0xE4, 0xD4, 0x3C, 0x6C, 0xB4,
+        0x9C, 0xAC, 0x54, 0x5C, 0x4C, 0xE7, 0xAC, 0xF1, 0xAB, 0xCE, 0x31, 0x58, 0xBC, 0x5C, 0x2A, 0x33,
+        0xF4, 0xDD, 0xDB, 0x75, 0xDA, 0x74, 0xA3, 0xA3, 0xB5, 0x4D, 0x5A, 0x52, 0x83, 0xAA, 0xA7, 0x38,
+        0xEE, 0xC2, 0xB3, 0x59, 0x4B, 0xCD, 0xAF, 0x9F, 0x78, 0x35, 0x96, 0x6C, 0x9A, 0x4D, 0x00, 0x1B,
+        0xCD, 0xDE, 0x50, 0x14, 0x63, 0x07, 0x63, 0x37, 0x9A, 0x11, 0xA0, 0x00, 0x70, 0x3B, 0xDF, 0x65,
+        0xB8, 0x63, 0x9B, 0x37, 0x8B, 0x14, 0x8D, 0x1E, 0x36, 0x20, 0x4D, 0xCA, 0x65, 0x04, 0xB8, 0x53,
+        0x36, 0x00, 0x6F, 0x28, 0xE6, 0xCC, 0xBB, 0xC6, 0x1B, 0xCD, 0x8F, 0x07, 0x63, 0x37, 0x9B, 0xCD,
+        0xC5, 0x22, 0x06, 0x9D, 0xFB, 0xE0, 0xE7, 0xB8, 0x12, 0xE1, 0x58, 0x0B, 0x9B, 0x33, 0x46, 0x1B,
+        0xC5, 0x4E, 0x54, 0x65, 0xE5, 0x80, 0x28, 0x02, 0x00, 0x08, 0x00, 0x80, 0x00, 0x00, 0x00, 0x18,
+        0x03, 0x00, 0x08, 0x00, 0x00, 0x1E, 0xEC, 0xFF, 0xEE, 0x73, 0xFC, 0xE9, 0x79, 0x4C, 0x7F, 0xE0,
+        0x49, 0x5F, 0xFF, 0xBA, 0x4E, 0xD8, 0xB7, 0x7B, 0xD6, 0x3D, 0x22, 0x94, 0x07, 0x08, 0x86, 0x81,
+        0x60, 0xBB, 0x13, 0xE0, 0xBC, 0x11, 0x02, 0x40, 0x20, 0x00, 0x4B, 0x73, 0x35, 0x21, 0x4C, 0x37,
+        0x0C, 0x38, 0x1A, 0x0A, 0x30, 0xDE, 0x68, 0xC8, 0x3B, 0x8A, 0x5C, 0x65, 0xCA, 0x17, 0x06, 0x77,
+        0xCE, 0xF9, 0xD8, 0x00, 0x5C, 0x7C, 0x1E, 0xC3, 0x28, 0x60, 0x5C, 0x27, 0x7C, 0x19, 0x40, 0xCB,
+        0xCD, 0xC2, 0xF1, 0x01, 0x92, 0xC9, 0x79, 0xBC, 0x48, 0xC6, 0x0C, 0x63, 0x20, 0xC1, 0xE5, 0x78,
+        0x02, 0xC3, 0xDF, 0x7E, 0x03, 0xC3, 0x72, 0x20, 0x73, 0x70, 0x89, 0xCD, 0x1E, 0x31, 0x91, 0xC6,
+        0x19, 0xBC, 0x01, 0xCB, 0x80, 0x65, 0xCE, 0x69, 0xC4, 0xE0, 0x2D, 0xAF, 0x3D, 0x67, 0xB5, 0xE0,
+        0x9C, 0x63, 0xCC, 0xDF, 0x97, 0x32, 0x38, 0x0C, 0xF1, 0x98, 0x61, 0x9C, 0x91, 0xF8, 0x61, 0x51,
+        0xD1, 0xD0, 0xA5, 0xA8, 0x88, 0x8D, 0x46, 0x11, 0x48, 0x22, 0x98, 0x85, 0x39, 0x90, 0x39, 0xD2,
+        0x51, 0x45, 0x8C, 0x79, 0x13, 0x07, 0xD0, 0x15, 0x58, 0xEF, 0x64, 0x02, 0x8F, 0xFC, 0xBD, 0x1B,
+        0x6D, 0x5E, 0x05, 0xC1, 0x2C, 0xB0, 0x58, 0x40, 0x26, 0x3B, 0x1C, 0x8A, 0xC2, 0xA1, 0xB0, 0x68,
+        0x4C, 0xF3, 0xBD, 0xE7, 0x59, 0xC5, 0xE3, 0x19, 0x9A, 0xCC, 0x2A, 0x43, 0x2C, 0xED, 0xB5, 0xB5,
+        0x90, 0xF2, 0x88, 0xF4, 0x3D, 0x9B, 0x43, 0xB3, 0x52, 0xD1, 0x14, 0xD2, 0x97, 0x3B, 0x9A, 0xA0,
+        0xDE, 0x6D, 0x0D, 0x8C, 0xA9, 0x62, 0x37, 0x29, 0xB0, 0x65, 0x49, 0xA4, 0x16, 0xE5, 0xB9, 0xBC,
+        0xA6, 0xF3, 0x63, 0x05, 0x50, 0x9B, 0x94, 0x0B, 0x95, 0x18, 0x1B, 0xCD, 0x83, 0x79, 0xBC, 0xD2,
+        0x0E, 0xE1, 0x42, 0x21, 0x73, 0x60, 0x08, 0x6F, 0x36, 0x11, 0x37, 0x8D, 0x90, 0x54, 0x9B, 0x93,
+        0x72, 0x81, 0x10, 0x6E, 0x14, 0x79, 0x40, 0xB2, 0x50, 0x62, 0x67, 0xBC, 0x63, 0x37, 0x9B, 0x22,
+        0x16, 0x9A, 0xDF, 0x79, 0x40, 0x33, 0xBE, 0x34, 0x61, 0x70, 0xDE, 0x50, 0x58, 0x2C, 0x73, 0x4E,
+        0x56, 0xF1, 0xC0, 0x01, 0x80, 0x18, 0x00, 0x20, 0x03, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x40,
+        0x01, 0x80, 0x0A, 0x76, 0x3F, 0x39, 0x2F, 0x5C, 0x7D, 0x51, 0x5F, 0x00, 0x57, 0x5C, 0x84, 0xFF,
+        0x56, 0x3E, 0xD9, 0xFF, 0x30, 0x78, 0x96, 0xA1, 0x58, 0x48, 0x3C, 0x14, 0x17, 0x25, 0x18, 0x56,
+        0x10, 0x05, 0x00, 0x70, 0x02, 0x07, 0x8E, 0xC6, 0x34, 0xBC, 0xD0, 0xDE, 0x50, 0x77, 0x86, 0xCD,
+        0xC9, 0xA4, 0x42, 0x68, 0x99, 0x40, 0xB9, 0x73, 0x79, 0x41, 0x18, 0x06, 0xF3, 0x79, 0x5E, 0x58,
+        0xE6, 0x8F, 0x06, 0x00, 0xC3, 0x2B, 0xCB, 0x82, 0x05, 0xC0, 0xCA, 0x73, 0x72, 0xE0, 0x31, 0x08,
+        0x9C, 0xDC, 0x64, 0x62, 0x31, 0xE6, 0xF2, 0xC8, 0x30, 0x33, 0x78, 0x00, 0x3D, 0xDE, 0xD0, 0xFC,
+        0x3B, 0xC4, 0x8C, 0x92, 0xC9, 0x95, 0xE0, 0x07, 0xBB, 0xC6, 0xCB, 0x7E, 0xF8, 0x79, 0xBC, 0xCD,
+        0x98, 0x65, 0xC0, 0x32, 0x0B, 0xCD, 0xE3, 0xC0, 0x30, 0x30, 0x88, 0xF2, 0x40, 0xC0, 0xCE, 0x32,
+        0x4C, 0x0A, 0x05, 0x41, 0x51, 0x14, 0x68, 0xD4, 0x52, 0x25, 0x81, 0xA3, 0x51, 0x8A, 0x88, 0xD4,
+        0x69, 0x78, 0x41, 0x29, 0x48, 0x72, 0x1C, 0xE8, 0x20, 0x82, 0x6A, 0x26, 0xC9, 0x53, 0x97, 0x16,
+        0x21, 0x25, 0x37, 0x48, 0xB9, 0x57, 0xEF, 0x40, 0x02, 0x8F, 0xFD, 0xAD, 0x57, 0x71, 0x4F, 0x2C,
+        0xE3, 0x76, 0x68, 0x2C, 0x28, 0x15, 0x1C, 0x8F, 0x46, 0x21, 0x90, 0xB8, 0x3C, 0x26, 0x7C, 0x67,
+        0x7B, 0xD6, 0x33, 0xA9, 0xD5, 0xD5, 0xE2, 0xE6, 0x3B, 0xDD, 0xD7, 0xBB, 0x6D, 0xD7, 0x4F, 0x60,
+        0xED, 0xA6, 0xAD, 0xA6, 0xB3, 0xB1, 0x1F, 0x79, 0x76, 0x36, 0x85, 0x66, 0xCD, 0x10, 0xA1, 0x4D,
+        0xE7, 0xBC, 0xDC, 0x74, 0x13, 0x79, 0x4D, 0x8C, 0xDE, 0x69, 0x72, 0x8D, 0xCA, 0x67, 0xBC, 0xAC,
+        0x59, 0x62, 0x1D, 0xEE, 0xD3, 0xEC, 0x14, 0x86, 0x2C, 0x52, 0x6E, 0x5C, 0x52, 0x94, 0x33, 0x4C,
+        0x38, 0x9A, 0x65, 0x46, 0x68, 0x55, 0x91, 0x6E, 0x32, 0xE2, 0x82, 0x5C, 0xB9, 0x40, 0x60, 0x5C,
+        0xD1, 0x99, 0x58, 0x6F, 0x37, 0x9B, 0xCD, 0x91, 0x1D, 0xC9, 0xB9, 0x37, 0x29, 0x10, 0x00, 0xDF,
+        0x7B, 0xBD, 0xC2, 0xC0, 0x1A, 0xF2, 0x8C, 0x37, 0x9B, 0xCB, 0x14, 0x66, 0xE4, 0xDC, 0xBC, 0xD2,
+        0x20, 0x5C, 0x00, 0x30, 0x01, 0xC0, 0x10, 0x00, 0x50, 0x00, 0x00, 0x10, 0x00, 0x60, 0x00, 0x00,
+        0x00, 0x01, 0x67, 0x53, 0xF3, 0x8C, 0xF5, 0xC2, 0xD5, 0x09, 0xEF, 0xF8, 0xEB, 0x80, 0x9F, 0xEA,
+        0xD7, 0xDB, 0x3F, 0xE5, 0xFF, 0x11, 0xD4, 0x4A, 0xFD, 0x08, 0x02, 0x82, 0xF4, 0x9D, 0x0B, 0xC2,
+        0x20, 0x98, 0x14, 0x02, 0x40, 0x91, 0xE8, 0x01, 0x4D, 0xE5, 0x63, 0x34, 0x49, 0xB9, 0x72, 0xC7,
+        0x79, 0x72, 0x80, 0x8C, 0xB9, 0xBC, 0xAC, 0x60, 0xC4, 0x58, 0xCB, 0xCD, 0x8F, 0x34, 0x91, 0x84,
+        0xEA, 0x68, 0x15, 0x34, 0x54, 0x4D, 0x34, 0x2E, 0x6F, 0x00, 0x61, 0x97, 0x2E, 0x03, 0x70, 0x0C,
+        0xB2, 0x5C, 0x22, 0x41, 0x4E, 0x6F, 0x16, 0x46, 0x47, 0x0D, 0x1E, 0x0C, 0xCB, 0x97, 0x00, 0x32,
+        0x68, 0xE0, 0x49, 0x78, 0xB3, 0x9B, 0xC0, 0x46, 0x06, 0x06, 0x53, 0x09, 0x2F, 0x11, 0x8F, 0x06,
+        0x18, 0x06, 0x07, 0x34, 0x72, 0x46, 0x70, 0xBE, 0x5C, 0x38, 0x9C, 0x11, 0xE0, 0x67, 0x37, 0x38,
+        0xF0, 0xC0, 0x2A, 0x49, 0x60, 0xC0, 0xA3, 0xA1, 0x15, 0x10, 0x42, 0x34, 0x6B, 0x49, 0x70, 0xB1,
+        0x18, 0xD5, 0x61, 0x10, 0xA4, 0x39, 0x0E, 0x72, 0xA4, 0x82, 0x49, 0x28, 0xBA, 0xEC, 0x0E, 0x58,
+        0x64, 0x84, 0xA4, 0xE9, 0x26, 0xEA, 0xDF, 0xD9, 0x00, 0x02, 0x2F, 0xFF, 0xFF, 0xEB, 0xD0, 0x82,
+        0x51, 0x49, 0xA0, 0x42, 0x0B, 0x6E, 0xCB, 0x4F, 0x56, 0x43, 0x95, 0xE2, 0xC9, 0xBC, 0xA4, 0x18,
+        0x1B, 0xB4, 0xCB, 0xD4, 0xCB, 0x0B, 0x96, 0x30, 0x72, 0xC6, 0x32, 0x0D, 0x8C, 0x63, 0x25, 0x8C,
+        0x62, 0x38, 0xB1, 0x8E, 0x6F, 0x16, 0x31, 0x1C, 0xB0, 0x63, 0x96, 0x30, 0x73, 0x47, 0x96, 0x30,
+        0x72, 0xC6, 0x32, 0x51, 0x8C, 0x63, 0x25, 0x8C, 0x63, 0x82, 0xB1, 0x92, 0xBC, 0x58, 0xC9, 0x44,
+        0x83, 0x1C, 0x58, 0xC7, 0x37, 0x82, 0xB1, 0x8E, 0x58, 0x31, 0xCB, 0x05, 0x83, 0x96, 0x31, 0x83,
+        0x96, 0x0B, 0x19, 0x2C, 0x63, 0x1C, 0x58, 0x16, 0x4F, 0x56, 0xB6, 0xE6, 0x05, 0xB7, 0x69, 0x96,
+        0xDD, 0xAC, 0x2C, 0x71, 0x63, 0x1C, 0xDE, 0x2C, 0x16, 0x39, 0x60, 0xC7, 0x2C, 0x61, 0xA0, 0x00,
+        0xFF, 0xDD, 0x27, 0xFF, 0x1D, 0xAA, 0x17, 0xC1, 0xF6, 0xC3, 0x6F, 0x05, 0x50, 0x05, 0x50, 0x05,
+        0xA0, 0x3D, 0x81, 0x02, 0x03, 0xB8, 0x0B, 0x60, 0x25, 0x80, 0x72, 0x01, 0x7A, 0x65, 0xBE, 0xDB,
+        0x6B, 0xB6, 0xBB, 0xED, 0xC3, 0x8E, 0xDC, 0xB7, 0xE5, 0xC2, 0x98, 0x70, 0xE3, 0xAF, 0x1D, 0xF6,
+        0xD7, 0x6D, 0x35, 0xCB, 0x2D, 0x71, 0xC2, 0x7B, 0xC7, 0x7A, 0xD6, 0xB7, 0x8C, 0x67, 0x17, 0x77,
+        0x57, 0x1B, 0x6D, 0xB5, 0x51, 0x10, 0x01, 0xEA, 0xFD, 0x6C, 0xCF, 0x36, 0x0C, 0xC7, 0x89, 0xC3,
+        0x1C, 0x72, 0x3C, 0x06, 0x5F, 0x87, 0x9A, 0xF3, 0x02, 0xF0, 0xD9, 0x66, 0x18, 0x01, 0xAD, 0xBE,
+        0xFD, 0x34, 0x1C, 0xA4, 0x1C, 0xB0, 0x97, 0x2E, 0x22, 0xE1, 0x72, 0xC0, 0x09, 0x72, 0xE0, 0x76,
+        0x0B, 0xDD, 0xEE, 0xD6, 0x41, 0xEE, 0x7B, 0x9A, 0xC9, 0xA0, 0x34, 0x69, 0xA3, 0x44, 0x1E, 0x9A,
+        0xB3, 0x4B, 0x6A, 0x0C, 0xBD, 0x2D, 0xBB, 0x59, 0xB8, 0x60, 0xC7, 0x16, 0x0E, 0x6F, 0x14, 0x63,
+        0x25, 0x8C, 0x02, 0x2F, 0x1F, 0xFA, 0x05, 0x38, 0x29, 0xC0, 0x29, 0xC0, 0x8C, 0x65, 0xC1, 0x97,
+        0x18, 0x51, 0xC6, 0x5C, 0x19, 0x70, 0x63, 0x28, 0xE3, 0x0B, 0x8C, 0x2E, 0x30, 0xB8, 0x2C, 0xB8,
+        0x31, 0x85, 0xC6, 0x14, 0x71, 0x85, 0xC6, 0x5C, 0x19, 0x70, 0x16, 0x30, 0xB8, 0xC2, 0xE3, 0x2E,
+        0x05, 0x9D, 0xE5, 0xBB, 0xCB, 0x58, 0x37, 0x19, 0x70, 0x65, 0xC6, 0x17, 0x01, 0x6E, 0xF2, 0xD6,
+        0x77, 0xAC, 0x1B, 0x8C, 0xB8, 0x32, 0xE0, 0xC4, 0x18, 0xC6, 0x17, 0x18, 0x5C, 0x60, 0x37, 0x19,
+        0x70, 0x63, 0x12, 0x30, 0x4B, 0x8C, 0x2E, 0x32, 0xE0, 0xCA, 0x38, 0x31, 0x85, 0xC6, 0x17, 0x18,
+        0x25, 0xC6, 0x5C, 0x19, 0x70, 0x62, 0x30, 0xB8, 0xC2, 0xE3, 0x0B, 0x8C, 0x12, 0xE3, 0x2E, 0x0C,
+        0x61, 0x70, 0x16, 0x5C, 0x19, 0x70, 0x65, 0xC6, 0x09, 0x71, 0x8C, 0x2E, 0x0C, 0xB8, 0x60, 0x00,
+        0x40, 0x04, 0x00, 0x30, 0x02, 0x00, 0x03, 0xFF, 0xBD, 0x0F, 0xF8, 0x45, 0xB3, 0xD8, 0x4B, 0xE4,
+        0xBF, 0x03, 0x24, 0x0C, 0xE0, 0x31, 0x80, 0xB8, 0x02, 0x60, 0x09, 0x11, 0x01, 0x2A, 0x5B, 0x3C,
+        0xB8, 0xF2, 0xE9, 0xDF, 0xCB, 0xD3, 0xD7, 0xDB, 0xE3, 0x5B, 0xF8, 0x78, 0xB8, 0x38, 0x78, 0x78,
+        0x37, 0xEE, 0xDF, 0xAF, 0x6E, 0x9D, 0x3A, 0x73, 0x53, 0x7E, 0x7D, 0x39, 0xF0, 0xDF, 0x7D, 0xB4,
+        0xCF, 0x3C, 0xEF, 0x85, 0xAF, 0x2D, 0xF3, 0x77, 0x97, 0x65, 0xB6, 0x14, 0xD3, 0x19, 0x84, 0xC7,
+        0x98, 0x70, 0xCE, 0x1C, 0x07, 0xC8, 0x72, 0x1E, 0x1C, 0x30, 0xC9, 0x30, 0x49, 0x84, 0x86, 0x5F,
+        0x2E, 0x4B, 0x80, 0xE5, 0x86, 0x32, 0xE0, 0x03, 0x30, 0x39, 0x6F, 0x75, 0xBD, 0xCB, 0x00, 0x77,
+        0x88, 0xBD, 0x6E, 0x68, 0x63, 0x18, 0x8E, 0x59, 0x2C, 0x70, 0x38, 0xD0, 0xF7, 0x00, 0x00, 0xEF,
+        0x02, 0xC0, 0xDC, 0x06, 0x17, 0x06, 0x17, 0x11, 0x85, 0xC6, 0x0C, 0xB8, 0x30, 0xA3, 0x8C, 0x2E,
+        0x32, 0xE3, 0x0B, 0x88, 0xC1, 0x97, 0x18, 0x02, 0x2F, 0xFF, 0xAF, 0xFF, 0x10, 0xD0, 0x21, 0x03,
+        0x0D, 0x02, 0x0C, 0xBD, 0xD9, 0x32, 0xF7, 0x60, 0x4C, 0xBD, 0xD9, 0x32, 0xF0, 0x76, 0x4C, 0xBD,
+        0xD9, 0x30, 0x5C, 0x58, 0x92, 0x6F, 0x16, 0x20, 0x6D, 0xD9, 0x35, 0xB7, 0x64, 0x0D, 0x6D, 0xD9,
+        0x35, 0xB7, 0x60, 0x4D, 0x6D, 0xD9, 0x35, 0xB7, 0x06, 0x4D, 0x6D, 0xD9, 0x35, 0x86, 0x58, 0xC6,
+        0x32, 0x58, 0xC6, 0x05, 0xB7, 0x6B, 0x59, 0x7B, 0x98, 0x16, 0x5E, 0xE6, 0x59, 0x7B, 0x81, 0x96,
+        0x5E, 0xE6, 0x59, 0x78, 0x39, 0x96, 0x5E, 0xE6, 0x58, 0x17, 0xB9, 0x96, 0x5E, 0xE6, 0x41, 0x97,
+        0xB9, 0x96, 0x5E, 0xE6, 0x11, 0x93, 0x79, 0x63, 0x19, 0x29, 0x01, 0x6B, 0x6E, 0x65, 0xAD, 0xB8,
+        0x19, 0x6B, 0x6E, 0x65, 0xAD, 0xA0, 0x01, 0x00, 0x06, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x03,
+        0xFF, 0x88, 0x5B, 0xFE, 0x55, 0x16, 0x7F, 0xF2, 0x84, 0xE2, 0x48, 0x03, 0x06, 0x00, 0x30, 0x0B,
+        0x20, 0x1D, 0x80, 0x82, 0xB6, 0xEB, 0xD3, 0xA3, 0x4E, 0x5C, 0x79, 0x71, 0xE2, 0xC1, 0x76, 0x0B,
+        0xEC, 0xB2, 0x94, 0xD3, 0x2C, 0xB1, 0xC7, 0x1C, 0x2B, 0x86, 0x16, 0xAD, 0x6B, 0x59, 0x6E, 0xF7,
+        0x99, 0xDC, 0xCD, 0xDD, 0xB7, 0x6E, 0x47, 0x5B, 0xAE, 0xA6, 0xE8, 0xD9, 0xD8, 0x35, 0x50, 0xD2,
+        0x52, 0xCB, 0x00, 0xE2, 0xDC, 0xD4, 0xD3, 0xBC, 0x2C, 0xDC, 0x61, 0x4C, 0xB1, 0x8C, 0x0E, 0xDB,
+        0xB5, 0xEE, 0xC9, 0x90, 0x1A, 0x1A, 0x2D, 0xA4, 0x19, 0xAB, 0x2D, 0xAB, 0x58, 0x2E, 0x23, 0x19,
+        0x2C, 0x60, 0xE0, 0x56, 0x99, 0x7A, 0xB5, 0x90, 0x7B, 0xB2, 0x65, 0xEE, 0xC9, 0x81, 0x7B, 0xB2,
+        0x65, 0xEE, 0xC8, 0x63, 0x1C, 0xB0, 0x63, 0x1C, 0xB0, 0x46, 0x31, 0xCB, 0x06, 0x31, 0xC0, 0xEC,
+        0xB5, 0xAF, 0x76, 0x4C, 0x0B, 0xDD, 0x93, 0x00, 0x02, 0x2F, 0xFF, 0xEB, 0xFF, 0xD0, 0x05, 0x26,
+        0x12, 0x68, 0x00, 0x2C, 0x07, 0x2C, 0x94, 0x92, 0xC4, 0x71, 0x60, 0x39, 0x64, 0xA4, 0x94, 0x63,
+        0x8B, 0x01, 0xCB, 0x25, 0x20, 0xCB, 0x1C, 0x53, 0x17, 0x2C, 0x94, 0x49, 0x2C, 0x71, 0x4C, 0x5C,
+        0xB0, 0x65, 0x24, 0xB1, 0xC5, 0x31, 0x70, 0x6C, 0x94, 0x92, 0xC7, 0x14, 0xC4, 0x5C, 0xB2, 0x52,
+        0x4B, 0x1C, 0x50, 0x71, 0x72, 0xC9, 0x49, 0x2C, 0x72, 0x8C, 0x71, 0x72, 0xC7, 0x2C, 0x96, 0x23,
+        0x96, 0x38, 0xB9, 0x63, 0x96, 0x4A, 0x31, 0xCB, 0x1C, 0x5C, 0xB1, 0xCB, 0x06, 0x58, 0xE5, 0x8E,
+        0x2E, 0x58, 0xE0, 0xD9, 0x2C, 0x72, 0xC7, 0x17, 0x2C, 0x17, 0x2C, 0x96, 0x39, 0x63, 0x8B, 0x83,
+        0x63, 0x96, 0x4B, 0x01, 0x8E, 0x22, 0x9C, 0xD3, 0x2C, 0x94, 0xC5, 0x88, 0xE2, 0x9C, 0xD3, 0x2C,
+        0x94, 0xC5, 0xD0, 0x00, 0x80, 0x01, 0x00, 0x10, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x18, 0x00,
+        0x5F, 0xFF, 0x21, 0x47, 0xFF, 0xE9, 0x38, 0x0B, 0x71, 0x8A, 0xF2, 0x57, 0x90, 0x1A, 0x41, 0x78,
+        0x03, 0x1C, 0xFC, 0x03, 0x40, 0xC5, 0x2D, 0xD4, 0x49, 0x54, 0x11, 0xE1, 0x71, 0x38, 0xF8, 0xC0,
+        0x98, 0x78, 0x40, 0x40, 0xD0, 0x06, 0x33, 0x9E, 0x39, 0xE7, 0x9E, 0xBC, 0x79, 0xEB, 0xAF, 0x34,
+        0xA6, 0xB9, 0x65, 0xBE, 0x1A, 0x63, 0x9E, 0x39, 0x63, 0x8E, 0x17, 0xC6, 0x75, 0xC6, 0x78, 0xC6,
+        0x75, 0x9B, 0xCD, 0xE3, 0x13, 0x58, 0x8D, 0xDB, 0xD7, 0x57, 0x4D, 0x94, 0x68, 0xE6, 0x86, 0x56,
+        0x13, 0x78, 0x80, 0x0C, 0x1E, 0xED, 0x78, 0x5E, 0x0B, 0x5B, 0xDD, 0x7A, 0xCB, 0x01, 0x79, 0xB2,
+        0x31, 0x08, 0x2F, 0x28, 0xCB, 0x33, 0x71, 0x23, 0x12, 0x58, 0x31, 0x96, 0x45, 0x91, 0x72, 0xF3,
+        0x41, 0xB5, 0x7B, 0xB6, 0xEC, 0x20, 0x7E, 0xF9, 0xEA, 0xC1, 0x60, 0x16, 0xDC, 0xF5, 0x60, 0xB0,
+        0x09, 0xFB, 0xE7, 0xAB, 0x2C, 0x00, 0xB0, 0xB6, 0xE7, 0xA8, 0x30, 0xB0, 0x5B, 0x73, 0x06, 0xEC,
+        0x2C, 0x02, 0x2F, 0xFF, 0xFF, 0x5F, 0x00, 0x18, 0x20, 0x27, 0x0D, 0x04, 0x37, 0x10, 0x1C, 0x42,
+        0x5C, 0xB0, 0x1B, 0xBD, 0x0B, 0xD1, 0xBB, 0xC3, 0x61, 0x2E, 0x23, 0x97, 0x10, 0x83, 0x61, 0x2E,
+        0x5C, 0x47, 0x10, 0x04, 0x96, 0x12, 0xE5, 0xC4, 0x71, 0x04, 0x09, 0x61, 0x2E, 0x5C, 0x47, 0x02,
+        0x0D, 0xD9, 0xBB, 0xDD, 0xE8, 0x2E, 0x20, 0x12, 0xC2, 0x5C, 0xB8, 0x12, 0xF4, 0x1B, 0xB3, 0x77,
+        0x83, 0xBD, 0x2F, 0x41, 0xBB, 0x30, 0xDC, 0xB8, 0x8E, 0x20, 0x12, 0xC0, 0x6E, 0xF7, 0x7A, 0x5E,
+        0x83, 0x0D, 0x84, 0xB9, 0x71, 0x1C, 0x40, 0x12, 0x58, 0x4B, 0x97, 0x11, 0xC4, 0x10, 0x25, 0x84,
+        0xB9, 0x71, 0x1C, 0x08, 0x37, 0x66, 0xEF, 0x77, 0xA0, 0xB8, 0x80, 0x4B, 0x09, 0x72, 0xE0, 0x77,
+        0xBB, 0xD0, 0x06, 0xEF, 0x68, 0x00, 0x60, 0x02, 0x00, 0x06, 0x00, 0x20, 0x00, 0x60, 0x02, 0x00,
+        0x03, 0xFF, 0xBD, 0x0B, 0xFF, 0x80, 0x95, 0xA3, 0xCD, 0x27, 0xAC, 0x6F, 0xF1, 0x26, 0xC0, 0x3D,
+        0x01, 0x20, 0x09, 0xA5, 0xF7, 0xBD, 0x6F, 0x0B, 0xA9, 0xBD, 0x99, 0x89, 0x52, 0x53, 0xCE, 0x24,
+        0x60, 0xC1, 0x00, 0x67, 0x18, 0xCE, 0xB3, 0xCE, 0xF8, 0xEB, 0x5D, 0xF3, 0xC7, 0x1D, 0x4F, 0x3B,
+        0xEB, 0x7C, 0xEF, 0x8D, 0xEB, 0x9C, 0xEB, 0x59, 0xDD, 0xCB, 0x9C, 0xF2, 0xF7, 0x99, 0xBB, 0xB7,
+        0x6D, 0xCD, 0x89, 0x75, 0xA3, 0xA2, 0x96, 0x50, 0x37, 0x1B, 0xB5, 0x93, 0x20, 0x7A, 0x1A, 0x60,
+        0x30, 0xA4, 0x07, 0x11, 0xCB, 0xCD, 0xCA, 0x3C, 0xDC, 0x18, 0x86, 0x52, 0x30, 0x15, 0xE5, 0x23,
+        0x0B, 0x8C, 0x40, 0x62, 0x10, 0xB8, 0xCB, 0x97, 0x10, 0x49, 0x72, 0xE2, 0x01, 0x2E, 0x5C, 0x07,
+        0x3D, 0x06, 0xEF, 0x39, 0xE0, 0xEF, 0x3B, 0x6E, 0xC3, 0x76, 0x61, 0xB9, 0x70, 0xA6, 0x20, 0x12,
+        0xC1, 0x25, 0xC2, 0xC1, 0xC4, 0x25, 0xC0, 0xEC, 0xDD, 0xE7, 0x65, 0xE8, 0xC3, 0x72, 0xC2, 0x5C,
+        0x02, 0x3F, 0xFF, 0x0F, 0xFE, 0xC4, 0x86, 0x44, 0x60, 0x82, 0x20, 0x4B, 0x01, 0xB0, 0x1C, 0xB0,
+        0x27, 0x64, 0xC4, 0x53, 0x0B, 0x1C, 0xD8, 0x47, 0x28, 0x38, 0xB9, 0x73, 0xBE, 0x50, 0x31, 0x12,
+        0x49, 0x98, 0x78, 0xCE, 0x1C, 0x34, 0x98, 0x1C, 0xEF, 0x95, 0xC9, 0x60, 0x39, 0x65, 0x1E, 0x50,
+        0xCB, 0x1C, 0xB9, 0x42, 0x51, 0xE5, 0x8E, 0x5C, 0xB1, 0x88, 0x18, 0x2A, 0x62, 0x17, 0xCD, 0x19,
+        0x25, 0x13, 0x17, 0x36, 0x4B, 0x80, 0xE5, 0x82, 0x12, 0x83, 0x8E, 0x5C, 0xB1, 0xC1, 0xB9, 0xDC,
+        0x32, 0xE5, 0x8E, 0x5C, 0xB0, 0x3B, 0x1E, 0x8B, 0xDD, 0x8E, 0x87, 0xCB, 0x96, 0x4A, 0x62, 0x8C,
+        0xCA, 0x18, 0xBD, 0xD8, 0xEC, 0xF7, 0x6C, 0x34, 0xC5, 0x07, 0x8A, 0x65, 0xCA, 0x31, 0xC3, 0xB9,
+        0x9B, 0x89, 0x88, 0x23, 0x94, 0x03, 0x2E, 0x58, 0xE5, 0xCB, 0xA0, 0x00, 0x00, 0x04, 0x00, 0x10,
+        0x00, 0x80, 0x04, 0x00, 0x18, 0x01, 0x00, 0x08, 0x80, 0x3E, 0x02, 0xB0, 0x02, 0x02, 0x91, 0xDF,
+        0xFF, 0xEB, 0xEE, 0xFF, 0xFF, 0xAF, 0xBC, 0xA4, 0x68, 0x07, 0xEB, 0xFF, 0xAF, 0xDB, 0xC3, 0x7C,
+        0xB1, 0xC3, 0x04, 0x10, 0x04, 0x0C, 0x40, 0xC2, 0x04, 0x3D, 0xDE, 0xE0, 0xF7, 0x63, 0x70, 0x65,
+        0xE5, 0xBE, 0x16, 0x39, 0x72, 0x90, 0x66, 0xC0, 0x92, 0x98, 0xB9, 0x44, 0x3C, 0x5E, 0xEC, 0x5E,
+        0xEB, 0x30, 0xCA, 0x62, 0xE5, 0xCE, 0xCC, 0x07, 0x06, 0xC0, 0x94, 0x1C, 0x72, 0xE5, 0x82, 0xE5,
+        0xCA, 0x5F, 0x2E, 0x58, 0xE5, 0xC0, 0xED, 0xD8, 0xF4, 0x5E, 0xEC, 0x0D, 0xC5, 0xE5, 0x92, 0x98,
+        0xAC, 0x07, 0x9D, 0xC0, 0x94, 0x92, 0x81, 0x11, 0x8E, 0x5C, 0xB1, 0xCD, 0xC4, 0x32, 0x8E, 0x58,
+        0xE5, 0x0C, 0xDC, 0x72, 0xC0, 0x47, 0x1B, 0x33, 0xBE, 0x53, 0x17, 0x28, 0xE7, 0x7E, 0x77, 0x2C,
+        0xC5, 0x84, 0xA0, 0x26, 0x77, 0xCB, 0x96, 0x4A, 0x65, 0x88, 0x2F, 0x2C, 0x70, 0xA4, 0x95, 0x7C,
+        0x44, 0x1C, 0xB0, 0x1C, 0xEF, 0x12, 0x41, 0xA6, 0x2E, 0x54, 0x02, 0x3F, 0xFC, 0xBF, 0xF4, 0x26,
+        0x8A, 0x10, 0x90, 0x81, 0x2B, 0x09, 0x0B, 0x29, 0xCD, 0x84, 0x5E, 0x57, 0x9A, 0x30, 0x8C, 0xDF,
+        0x9E, 0xE4, 0x49, 0xBC, 0x46, 0x37, 0xE6, 0x8C, 0x93, 0xB9, 0x19, 0xA3, 0xC9, 0xDE, 0x31, 0x9B,
+        0xE3, 0xB8, 0x40, 0x77, 0xCD, 0xE6, 0xC0, 0x8B, 0xC7, 0x72, 0x0A, 0x4D, 0xE4, 0xD8, 0x44, 0x64,
+        0x49, 0x4E, 0x26, 0x99, 0xAB, 0xA2, 0x8A, 0x98, 0x1E, 0x7B, 0x8F, 0x1D, 0xE2, 0x44, 0x7C, 0xF4,
+        0x72, 0x20, 0xF3, 0x79, 0xB2, 0x21, 0x05, 0xBC, 0x12, 0x6F, 0x9B, 0x23, 0x10, 0x62, 0x30, 0xE7,
+        0xB9, 0x19, 0xBC, 0x41, 0x8B, 0xC7, 0x7C, 0xD8, 0x3C, 0xD9, 0x9A, 0x32, 0x23, 0xCD, 0x87, 0x3D,
+        0xC8, 0xBC, 0x1E, 0xF1, 0x89, 0x16, 0x04, 0x5E, 0x0E, 0xF3, 0x64, 0xB8, 0xC6, 0x6F, 0x2E, 0x22,
+        0xF3, 0x64, 0x49, 0xBE, 0x6F, 0x36, 0x44, 0x41, 0xE6, 0xF3, 0xBC, 0x11, 0xE5, 0xBC, 0xE0, 0x00,
+        0x80, 0x01, 0x40, 0x02, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x78, 0x01, 0x60, 0x07, 0x80, 0x18, 0x00,
+        0xBC, 0x80, 0xCA, 0xAD, 0xB2, 0xFF, 0x62, 0x83, 0xFE, 0xC5, 0x09, 0x6D, 0x88, 0x19, 0x66, 0xFF,
+        0xEC, 0x77, 0xF6, 0xEA, 0xCE, 0x80, 0x12, 0x0C, 0x30, 0x30, 0xA1, 0x02, 0x05, 0x04, 0x00, 0x61,
+        0xBE, 0x6F, 0x36, 0x04, 0x5E, 0x6F, 0x07, 0xBC, 0x48, 0xBC, 0xD9, 0x2E, 0x6F, 0x11, 0x8C, 0xB8,
+        0xBC, 0xDE, 0x6C, 0x88, 0x0B, 0x22, 0x46, 0x6F, 0x9B, 0x23, 0x7E, 0x0E, 0x8F, 0x36, 0x11, 0x79,
+        0x5E, 0x6C, 0x11, 0xE7, 0x79, 0x36, 0x44, 0x9B, 0xC6, 0x0B, 0x7E, 0x68, 0xC2, 0x24, 0x62, 0x8F,
+        0x3B, 0xC4, 0x86, 0xE4, 0x42, 0x28, 0xF3, 0x79, 0xB0, 0x23, 0x7E, 0x76, 0x11, 0x20, 0xA6, 0x94,
+        0xA7, 0xA9, 0x74, 0x51, 0x43, 0xBE, 0x6C, 0xCD, 0xE7, 0x78, 0xC5, 0x84, 0x14, 0x78, 0xEF, 0x12,
+        0x37, 0x93, 0x60, 0xC4, 0x1E, 0x6F, 0x3B, 0xC1, 0x2F, 0x20, 0xF7, 0x8C, 0x66, 0xF8, 0xEF, 0x18,
+        0xDF, 0x05, 0x58, 0x73, 0xDC, 0x8C, 0xDE, 0x24, 0x16, 0xFC, 0xF7, 0x8C, 0x47, 0x9B, 0x33, 0x60,
+        0xC4, 0x79, 0xA6, 0x31, 0x9B, 0xC4, 0x18, 0xC6, 0xFC, 0xD4, 0x02, 0x3F, 0xF2, 0xFF, 0xE8, 0x04,
+        0x64, 0x00, 0x46, 0x44, 0x26, 0x80, 0x39, 0x6E, 0x01, 0x94, 0x2E, 0x19, 0xD1, 0xC0, 0xCE, 0xF9,
+        0x40, 0x02, 0xE6, 0x07, 0x05, 0x80, 0x02, 0x65, 0xB8, 0x00, 0x67, 0x70, 0x30, 0x6D, 0xF3, 0xBE,
+        0x77, 0x00, 0x0C, 0xA8, 0x39, 0x72, 0xCE, 0x7B, 0x31, 0x00, 0x01, 0x18, 0x44, 0x0C, 0xEF, 0x9D,
+        0xCB, 0x83, 0xE7, 0xDC, 0x00, 0x25, 0x85, 0xF1, 0xA3, 0x09, 0x72, 0xE5, 0xCB, 0x25, 0x92, 0x8E,
+        0x2E, 0x21, 0x7C, 0xEE, 0x19, 0x40, 0x42, 0xF9, 0x6F, 0x9D, 0xCC, 0xA1, 0x7C, 0xA0, 0x77, 0xFB,
+        0x80, 0x6F, 0xBC, 0x13, 0x3B, 0x80, 0x06, 0x5B, 0x99, 0x41, 0xB8, 0x19, 0x40, 0xB8, 0x67, 0x70,
+        0x10, 0xCA, 0x31, 0xC4, 0x72, 0xE2, 0x00, 0xF7, 0xF7, 0x97, 0xA1, 0xE1, 0xEE, 0x19, 0xDF, 0x3B,
+        0x99, 0xDC, 0x08, 0x9C, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x09, 0x00,
+        0x38, 0x01, 0x0C, 0x02, 0xD0, 0x1F, 0x20, 0x3B, 0xF7, 0x60, 0xDF, 0xEC, 0x55, 0x7F, 0xD2, 0x97,
+        0x2D, 0xB1, 0x03, 0x30, 0xDF, 0xFD, 0x8F, 0x03, 0x62, 0xCC, 0x98, 0xB0, 0x01, 0x40, 0x80, 0x06,
+        0x10, 0x20, 0x30, 0x62, 0x06, 0x80, 0x01, 0x7C, 0xEF, 0x94, 0x01, 0x97, 0x2C, 0x2F, 0xCE, 0xC0,
+        0x8B, 0x82, 0xDC, 0x33, 0xB8, 0x19, 0x6F, 0x96, 0xF8, 0x57, 0x11, 0x71, 0x17, 0x86, 0xF0, 0xC0,
+        0x78, 0x1E, 0xF9, 0xDF, 0x28, 0x13, 0x70, 0x71, 0x04, 0x01, 0xC9, 0xDC, 0x0C, 0xEE, 0x00, 0x1E,
+        0xE7, 0x7B, 0xBF, 0xDC, 0x00, 0x69, 0x7A, 0x59, 0xA0, 0x00, 0xB6, 0x83, 0xDF, 0xDE, 0x08, 0x5C,
+        0xF3, 0xEE, 0x01, 0x2E, 0x5C, 0xA2, 0xF9, 0x40, 0x88, 0xE5, 0xCB, 0x20, 0xAE, 0x21, 0x7C, 0xA1,
+        0x70, 0xCA, 0x20, 0x17, 0xE7, 0x65, 0xCC, 0xA0, 0x02, 0x12, 0xC2, 0xF8, 0xD8, 0x04, 0xD1, 0xF3,
+        0xB8, 0x19, 0xDC, 0x0C, 0xEE, 0x65, 0xA3, 0xE7, 0x7C, 0xEE, 0x19, 0x40, 0x2E, 0x67, 0x47, 0xCE,
+        0xE1, 0x94, 0xBC, 0x41, 0xCB, 0x01, 0xA0, 0x00, 0x02, 0x3F, 0xED, 0xFF, 0x40, 0x12, 0x00, 0x12,
+        0x00, 0x36, 0x50, 0x80, 0xF6, 0x40, 0x60, 0x33, 0xBE, 0x67, 0x60, 0xC1, 0x81, 0x78, 0xF7, 0xF3,
+        0x5C, 0x01, 0x60, 0x33, 0xBF, 0x96, 0xC8, 0x0C, 0x11, 0x94, 0xF3, 0x5C, 0x06, 0x17, 0x02, 0xBF,
+        0xDD, 0xDB, 0x16, 0x28, 0x39, 0x37, 0x01, 0x80, 0xCB, 0x93, 0xA3, 0x90, 0x18, 0x0C, 0xEF, 0xE5,
+        0xB2, 0x02, 0xC5, 0x78, 0xED, 0x88, 0x60, 0x33, 0xBF, 0x8F, 0x72, 0x03, 0x01, 0x17, 0x26, 0x9E,
+        0x77, 0x18, 0x0C, 0x1B, 0xE7, 0x49, 0x01, 0x80, 0xB8, 0x0A, 0xF9, 0xDC, 0x60, 0x59, 0x02, 0xC0,
+        0xC5, 0x78, 0xB3, 0xBD, 0x6E, 0x0F, 0x58, 0xB1, 0xDB, 0x77, 0x90, 0xC0, 0x5F, 0x2F, 0x7E, 0x37,
+        0x06, 0x02, 0xC0, 0xB3, 0x9F, 0x7C, 0x18, 0x0C, 0x03, 0xB6, 0x3B, 0x62, 0xCE, 0xE0, 0x00, 0x40,
+        0x01, 0x80, 0x01, 0x80, 0x0A, 0x00, 0x14, 0x00, 0x78, 0x01, 0x80, 0x0B, 0x40, 0x0F, 0x41, 0x92,
+        0x84, 0xBC, 0xCB, 0xE2, 0x7F, 0xCB, 0x54, 0xFF, 0xCB, 0x55, 0x4B, 0xE1, 0x89, 0x7A, 0x6F, 0xFF,
+        0xFF, 0xF8, 0x9B, 0x9D, 0x9A, 0xF3, 0xA2, 0x44, 0x84, 0x0A, 0x04, 0x20, 0x00, 0x20, 0x80, 0x00,
+        0x0A, 0xF1, 0x5E, 0x2C, 0x58, 0x4E, 0xFE, 0x6B, 0x80, 0xC1, 0x85, 0xC1, 0x9E, 0xF9, 0x9D, 0x90,
+        0x18, 0x5C, 0x50, 0xF1, 0x62, 0xDD, 0xEB, 0x77, 0x81, 0x63, 0xB6, 0x2B, 0xC5, 0x0E, 0x03, 0x2F,
+        0x9D, 0x90, 0xB2, 0x00, 0xB0, 0x14, 0xF3, 0xB8, 0xC0, 0x60, 0xDF, 0x3A, 0x71, 0xB2, 0x03, 0x01,
+        0x1B, 0xE4, 0xFB, 0xE3, 0x01, 0x80, 0xB8, 0x21, 0x64, 0x06, 0x0B, 0x99, 0xF7, 0xC1, 0x60, 0x30,
+        0x1B, 0xE3, 0x71, 0x80, 0x58, 0xEF, 0xD7, 0x36, 0x21, 0x80, 0xB9, 0x9D, 0x92, 0xE0, 0xC0, 0x4B,
+        0x39, 0xD3, 0x18, 0x30, 0x14, 0x73, 0x3E, 0xF8, 0xC0, 0x60, 0x59, 0xCF, 0xA3, 0xE4, 0xDC, 0x06,
+        0x0B, 0xE5, 0xEF, 0x88, 0xC0, 0x60, 0x2F, 0x9D, 0x39, 0xB8, 0x02, 0xC5, 0x80, 0x02, 0x3F, 0xE9,
+        0xFC, 0x01, 0x0D, 0x01, 0x58, 0xD0, 0xC8, 0x8D, 0x04, 0xB2, 0x53, 0x2C, 0x85, 0xCA, 0x70, 0x5A,
+        0x65, 0x92, 0xE5, 0xCB, 0xCD, 0xCA, 0x26, 0x2E, 0x14, 0xE6, 0x9E, 0x76, 0xFC, 0x49, 0x8C, 0x6F,
+        0x0A, 0x44, 0x38, 0x2A, 0xF0, 0x04, 0xB1, 0xCB, 0x82, 0xE5, 0x31, 0x83, 0x72, 0xE3, 0x28, 0x63,
+        0x2E, 0x5C, 0x1B, 0xCD, 0x30, 0xDE, 0x17, 0x29, 0x20, 0x37, 0x2E, 0x2E, 0x53, 0x26, 0xE5, 0xCA,
+        0x31, 0x30, 0xB8, 0xCB, 0x96, 0x4A, 0x0E, 0x5C, 0x65, 0xCB, 0x8B, 0x94, 0xC4, 0x65, 0xCB, 0x97,
+        0x9B, 0x94, 0xC5, 0xCA, 0x38, 0x2E, 0x5C, 0xB2, 0x5C, 0xB9, 0x61, 0x21, 0x7C, 0x5A, 0x4C, 0x43,
+        0x82, 0x9C, 0x0D, 0xC5, 0xCA, 0x63, 0x2E, 0x53, 0x89, 0x5E, 0x1C, 0x14, 0x18, 0x87, 0x46, 0xF0,
+        0xC7, 0x17, 0xCF, 0xBE, 0x0B, 0x97, 0x2E, 0x6F, 0x04, 0xB9, 0x64, 0x29, 0x8B, 0x97, 0x0E, 0x00,
+        0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x80, 0x04, 0x00, 0x08, 0x00, 0x89, 0x00, 0x8B, 0x14, 0x90,
+        0x4F, 0x3E, 0xE6, 0xDB, 0xEC, 0x6C, 0x7C, 0x05, 0x37, 0x80, 0xA5, 0xFB, 0x1B, 0x2B, 0x9B, 0x58,
+        0xFF, 0xFF, 0xED, 0x0F, 0xFC, 0x8E, 0x8C, 0x84, 0x43, 0xE1, 0xF0, 0x38, 0x0C, 0x0E, 0x04, 0x00,
+        0x00, 0xC0, 0x80, 0x30, 0x10, 0x08, 0x69, 0x82, 0xE5, 0xC3, 0x79, 0x72, 0xE1, 0x34, 0x85, 0xF1,
+        0x69, 0x38, 0xBC, 0x29, 0x81, 0xA6, 0x0C, 0xB9, 0xDF, 0x26, 0x99, 0x70, 0x59, 0x4C, 0xB2, 0x5C,
+        0xB8, 0xCB, 0x83, 0x4C, 0x5F, 0x3E, 0xF8, 0x2E, 0x5C, 0xB8, 0x2B, 0x97, 0x2C, 0x85, 0xCB, 0x25,
+        0x07, 0x2F, 0x37, 0x2E, 0x5C, 0x65, 0x32, 0xC1, 0x97, 0x2E, 0x32, 0xE5, 0x31, 0x72, 0x8E, 0x32,
+        0xE1, 0x48, 0xE5, 0xCB, 0xC4, 0x69, 0x96, 0x4B, 0x97, 0x05, 0x32, 0x8E, 0x1B, 0xC2, 0x9C, 0xDC,
+        0xB9, 0x71, 0x83, 0x43, 0x19, 0x72, 0xE3, 0x29, 0x94, 0x64, 0x2E, 0x58, 0xE0, 0x77, 0xC6, 0x52,
+        0x86, 0x28, 0xDF, 0x16, 0x21, 0x66, 0x31, 0x60, 0x79, 0xA6, 0x16, 0x4A, 0x65, 0xE6, 0xE5, 0x1C,
+        0xB8, 0xB9, 0x4C, 0x9A, 0x65, 0xC0, 0x57, 0x29, 0x8B, 0x85, 0xC5, 0xCA, 0x39, 0xBC, 0x2E, 0x50,
+        0x02, 0x2F, 0xFC, 0x7F, 0xF0, 0x82, 0x9A, 0x98, 0x28, 0xA0, 0x51, 0x29, 0x83, 0x52, 0x9D, 0x4E,
+        0xB2, 0x12, 0x42, 0xDE, 0x6F, 0x11, 0x8C, 0xBF, 0x3D, 0x90, 0x46, 0x4D, 0xC9, 0xBC, 0xD3, 0x8C,
+        0xDC, 0x22, 0x94, 0xC2, 0x9A, 0x2D, 0x54, 0xA7, 0x43, 0xBC, 0x45, 0xE3, 0x78, 0xAF, 0x9B, 0x05,
+        0x97, 0x8C, 0xD3, 0xE7, 0xB2, 0x0B, 0xF0, 0xB3, 0x05, 0x22, 0xE8, 0xCE, 0xAD, 0x25, 0x23, 0x93,
+        0x78, 0xDE, 0x2B, 0x91, 0x65, 0x1E, 0x6F, 0x1B, 0xC6, 0x6E, 0x2F, 0x11, 0x24, 0xA6, 0x14, 0xAA,
+        0xBA, 0x9A, 0x98, 0x28, 0x94, 0xC2, 0x9A, 0x98, 0x44, 0xA7, 0x53, 0x42, 0xD9, 0x39, 0xE9, 0xCD,
+        0xE2, 0x31, 0x82, 0x31, 0x83, 0x26, 0xE3, 0x26, 0xE1, 0x29, 0x55, 0x69, 0x29, 0x85, 0x34, 0x5D,
+        0x0E, 0xFC, 0xF4, 0xE6, 0xF1, 0x18, 0xC1, 0x82, 0xBE, 0x3B, 0x20, 0xC9, 0xB9, 0x37, 0x82, 0xF7,
+        0xE3, 0x37, 0x19, 0x37, 0x26, 0xF1, 0xE0, 0x00, 0x00, 0x00, 0x40, 0x0A, 0x00, 0x21, 0x01, 0x08,
+        0x03, 0x94, 0x1D, 0x70, 0x73, 0xD3, 0x66, 0x4E, 0x37, 0x78, 0x97, 0x8F, 0xD4, 0x22, 0xF8, 0x07,
+        0x6F, 0x00, 0xEB, 0xFA, 0x84, 0x6E, 0x25, 0xDE, 0xBF, 0xFF, 0x1B, 0xDF, 0xB3, 0x1B, 0x3E, 0x75,
+        0xA3, 0x98, 0x41, 0x82, 0x20, 0x26, 0x00, 0x80, 0x00, 0x02, 0x00, 0xA0, 0x18, 0x00, 0x80, 0x30,
+        0x0C, 0x2B, 0x2F, 0x19, 0xEF, 0x93, 0x78, 0xDE, 0x22, 0xC1, 0x79, 0x3B, 0x23, 0x06, 0x24, 0x82,
+        0x9A, 0x91, 0xAC, 0xD4, 0xC2, 0x9A, 0x23, 0x78, 0xAF, 0x9A, 0xF1, 0xBC, 0x59, 0x43, 0xF5, 0x65,
+        0xAC, 0xB5, 0x98, 0x77, 0x9A, 0x7C, 0xD5, 0xC9, 0xBC, 0xDC, 0x61, 0x22, 0xEA, 0x68, 0xBA, 0x25,
+        0x3A, 0x9A, 0x1D, 0xF3, 0x5E, 0x37, 0x8B, 0x09, 0xB2, 0x0D, 0xE3, 0x37, 0x26, 0xF3, 0x71, 0x91,
+        0xA3, 0x24, 0xDC, 0x9B, 0xC6, 0xF1, 0x5F, 0x3D, 0x1E, 0x4D, 0xC8, 0xB2, 0xFC, 0xF6, 0x41, 0x4B,
+        0x59, 0x14, 0x54, 0xC1, 0x46, 0xAD, 0x24, 0x3B, 0x93, 0x64, 0x26, 0xF3, 0x71, 0xE6, 0xA3, 0x93,
+        0x78, 0xDE, 0x2C, 0xBC, 0x66, 0x83, 0xCD, 0xE3, 0x78, 0xB0, 0x5F, 0x9E, 0xE2, 0x31, 0x84, 0xDE,
+        0x6E, 0x45, 0x4F, 0x9E, 0x8F, 0x37, 0x1E, 0x6C, 0xBC, 0x58, 0x31, 0x19, 0x79, 0xBC, 0x44, 0x02,
+        0x4F, 0xFD, 0x1F, 0xF9, 0x88, 0x20, 0x84, 0x01, 0x08, 0x44, 0x11, 0x94, 0x04, 0x11, 0x50, 0xB1,
+        0xB9, 0xF4, 0xE2, 0x0A, 0x85, 0x0A, 0x6E, 0x67, 0xB9, 0x60, 0x94, 0x1A, 0xE3, 0xDE, 0x0A, 0xC1,
+        0xB2, 0xDC, 0xDE, 0x69, 0x12, 0x93, 0x47, 0x3D, 0xF2, 0xEF, 0x11, 0x11, 0x66, 0x86, 0x76, 0x48,
+        0xAE, 0xF3, 0xE1, 0x84, 0xD8, 0xCA, 0x1B, 0xCB, 0x71, 0x19, 0x41, 0x0D, 0xF3, 0x69, 0x01, 0x16,
+        0x5C, 0xB7, 0x1B, 0x01, 0x00, 0x39, 0xBB, 0x75, 0xB5, 0x12, 0x18, 0x77, 0x07, 0x2B, 0x11, 0x96,
+        0x07, 0x1A, 0xB4, 0x9B, 0x9D, 0x80, 0x25, 0x9C, 0x77, 0xAC, 0x2B, 0x2C, 0x62, 0x97, 0x05, 0xC0,
+        0xE6, 0xED, 0x57, 0x9C, 0xCA, 0x06, 0xA1, 0x6E, 0xF7, 0x67, 0x61, 0x73, 0x48, 0x80, 0xC5, 0xCB,
+        0x34, 0x00, 0x50, 0x01, 0x80, 0x01, 0x00, 0x10, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00, 0x90, 0x04,
+        0x80, 0x31, 0x00, 0x18, 0x2A, 0xBB, 0xFF, 0xFC, 0xC8, 0x5F, 0xFF, 0xF3, 0x21, 0x8A, 0xAD, 0x00,
+        0x5D, 0x3F, 0xFC, 0x7E, 0x7C, 0x6F, 0x58, 0x06, 0x22, 0x98, 0x24, 0x18, 0x84, 0x11, 0x80, 0x44,
+        0xE5, 0x8E, 0x0E, 0x50, 0xF5, 0x86, 0xD3, 0x64, 0xF0, 0x96, 0x48, 0xE2, 0x65, 0x90, 0xB8, 0x0D,
+        0xAD, 0x7A, 0xDA, 0xDD, 0xE0, 0x3C, 0xB3, 0x05, 0xE7, 0xA0, 0x66, 0xB6, 0x8F, 0x5E, 0xB3, 0x0B,
+        0x32, 0xC2, 0xF8, 0x30, 0x81, 0x03, 0x56, 0xF5, 0xE9, 0xE1, 0x81, 0x72, 0x5C, 0xCB, 0x8C, 0x80,
+        0x98, 0x3C, 0xEF, 0x02, 0x06, 0x32, 0xE6, 0x6F, 0x04, 0x31, 0x8F, 0x11, 0xE1, 0x72, 0x40, 0x33,
+        0x2F, 0x2F, 0xD6, 0xCC, 0x24, 0x26, 0xF3, 0x3B, 0xF2, 0xF1, 0x30, 0x82, 0x9C, 0xDE, 0x5C, 0xC7,
+        0x19, 0x21, 0xA3, 0xE4, 0xB3, 0x20, 0x60, 0xE5, 0xF9, 0x68, 0xF0, 0xC0, 0xC0, 0x90, 0x9A, 0x7E,
+        0x51, 0xC8, 0xE0, 0x49, 0x0A, 0x73, 0x22, 0x1B, 0x66, 0xD7, 0x00, 0x02, 0x4F, 0xF9, 0x3F, 0xE6,
+        0x01, 0x92, 0x03, 0x0C, 0x64, 0x3A, 0x16, 0x81, 0x88, 0x76, 0x52, 0x2D, 0xE6, 0x92, 0xB9, 0xA4,
+        0x11, 0x06, 0x75, 0xCE, 0x08, 0x71, 0xBC, 0x11, 0x9A, 0xF9, 0xD7, 0x14, 0xA6, 0x6E, 0x7A, 0x5C,
+        0x3C, 0xD1, 0x53, 0x5B, 0xD1, 0x94, 0xF1, 0x63, 0x7C, 0xEE, 0x16, 0xF2, 0x80, 0xEE, 0x41, 0x6E,
+        0x77, 0x33, 0xA1, 0x9A, 0xC7, 0x28, 0xAC, 0x05, 0xCF, 0x78, 0x21, 0xB8, 0x33, 0xB0, 0x8E, 0xF1,
+        0x65, 0x66, 0x7A, 0x1F, 0xA9, 0x34, 0x88, 0x0B, 0x70, 0x43, 0x7C, 0xEE, 0x5C, 0xAC, 0x0D, 0xD7,
+        0xBE, 0xDB, 0x83, 0xB0, 0x28, 0xC2, 0xCB, 0xCD, 0x25, 0x82, 0x2E, 0x50, 0x05, 0xE7, 0x71, 0x18,
+        0x3B, 0xCB, 0x0B, 0x9B, 0x25, 0x33, 0x62, 0x31, 0x4C, 0xD8, 0x4B, 0x37, 0x94, 0x02, 0xF7, 0x37,
+        0x34, 0xB5, 0xA8, 0x1A, 0x5A, 0x6E, 0x35, 0xDF, 0xB4, 0x00, 0x00, 0x01, 0x40, 0x08, 0x00, 0x00,
+        0x00, 0x20, 0x05, 0x00, 0x1E, 0x01, 0x30, 0x07, 0xC0, 0x77, 0x81, 0x13, 0x63, 0x9B, 0xFF, 0xFD,
+        0xB1, 0xFF, 0xFF, 0xF6, 0xC8, 0x18, 0xE5, 0x04, 0x51, 0x7F, 0xFF, 0x77, 0xB7, 0x96, 0xEA, 0x60,
+        0x80, 0x38, 0xC0, 0x0A, 0x20, 0x40, 0x80, 0x00, 0x7A, 0x6B, 0x34, 0xDA, 0xD6, 0x12, 0x26, 0x26,
+        0x58, 0x19, 0xBC, 0x47, 0x11, 0xE5, 0x24, 0x63, 0xCA, 0x60, 0xAF, 0x2E, 0x0E, 0x6F, 0x18, 0x4B,
+        0xE0, 0x7D, 0xB0, 0x7B, 0xB6, 0x5E, 0x83, 0xCD, 0xC7, 0x06, 0x10, 0x1C, 0x01, 0x0C, 0x5E, 0x59,
+        0x8B, 0x32, 0xE5, 0x1F, 0x3B, 0xC0, 0x85, 0xC8, 0x04, 0x01, 0x84, 0x48, 0x49, 0xBF, 0x2B, 0x31,
+        0x19, 0x37, 0x91, 0x1F, 0x1B, 0xC0, 0x80, 0xEF, 0xCB, 0x20, 0x32, 0x65, 0x8C, 0xE0, 0xD0, 0xF2,
+        0xDF, 0x2E, 0x46, 0xF2, 0x01, 0x08, 0x98, 0x80, 0xF1, 0x71, 0x8B, 0x83, 0x48, 0xB3, 0xC4, 0xD1,
+        0x53, 0xA8, 0xDE, 0x9D, 0x31, 0x04, 0x12, 0x6B, 0x16, 0xA8, 0xAB, 0xE1, 0xC0, 0x25, 0x7D, 0x66,
+        0x90, 0x44, 0x53, 0x50, 0x41, 0x54, 0xC2, 0x44, 0x41, 0xA3, 0x17, 0xC5, 0xE0, 0x6E, 0x66, 0x9F,
+        0x34, 0x02, 0x4F, 0xF2, 0x7F, 0x91, 0x03, 0x00, 0x04, 0x30, 0x01, 0x2C, 0x19, 0x46, 0x62, 0xAD,
+        0xA4, 0x18, 0x8B, 0x82, 0xDC, 0x44, 0x8C, 0x65, 0x25, 0x1B, 0x93, 0x72, 0x81, 0xB8, 0x51, 0xDE,
+        0x96, 0x84, 0x56, 0x5F, 0x3D, 0xE5, 0x1C, 0x6C, 0x13, 0x71, 0x48, 0xB0, 0x58, 0xE8, 0xE6, 0x7B,
+        0xCB, 0xCD, 0x01, 0x9B, 0x0A, 0x1E, 0x49, 0xBB, 0x51, 0x60, 0xD8, 0x32, 0xCB, 0xCF, 0x79, 0x63,
+        0x11, 0x18, 0x56, 0x4D, 0x91, 0x61, 0x46, 0x1B, 0xE5, 0x6E, 0x4A, 0x12, 0x80, 0x1C, 0x65, 0x7A,
+        0x96, 0x82, 0x6D, 0xF6, 0x40, 0xED, 0xC3, 0x89, 0x2C, 0x4B, 0xE6, 0xA4, 0x10, 0x09, 0x7A, 0xFB,
+        0xCD, 0xF6, 0x06, 0xE6, 0xB7, 0xD9, 0xA9, 0xA0, 0x6E, 0x6E, 0xD6, 0x97, 0xA8, 0x02, 0x2D, 0x6B,
+        0x44, 0xE0, 0x00, 0x20, 0x01, 0x80, 0x01, 0x80, 0x04, 0x00, 0x18, 0x00, 0x38, 0x01, 0x50, 0x06,
+        0x60, 0x10, 0xC0, 0xB6, 0x01, 0x69, 0xA4, 0x54, 0xFF, 0x4B, 0xF7, 0xFE, 0x97, 0xF1, 0x22, 0x98,
+        0x2D, 0x45, 0xFF, 0xFF, 0xFD, 0x7F, 0x17, 0x8B, 0x24, 0xD2, 0xC3, 0x10, 0x50, 0x80, 0x08, 0x00,
+        0x02, 0x04, 0x35, 0xAC, 0x60, 0xDB, 0xB0, 0x35, 0xAF, 0x4F, 0x4D, 0x36, 0x14, 0x78, 0xC4, 0xC4,
+        0x78, 0x94, 0x3F, 0x6E, 0xCC, 0x19, 0x37, 0xE1, 0xEE, 0x11, 0xC4, 0x97, 0x1C, 0x00, 0x0C, 0xBF,
+        0x53, 0x6B, 0x36, 0x0E, 0xD9, 0x1E, 0x0F, 0x40, 0xE3, 0x72, 0x67, 0x78, 0x38, 0x32, 0x22, 0xF1,
+        0x66, 0x0C, 0x23, 0x1C, 0xD1, 0xF9, 0xB8, 0xE3, 0x07, 0x06, 0x04, 0x18, 0xE2, 0x42, 0x17, 0x07,
+        0x8C, 0x10, 0x39, 0xB9, 0xBF, 0x2D, 0xE4, 0x64, 0x05, 0x91, 0x24, 0xBC, 0x1C, 0x96, 0x03, 0x9B,
+        0xF3, 0xB8, 0xC9, 0x08, 0xC2, 0x51, 0xC0, 0x90, 0x0C, 0x4C, 0xBC, 0x68, 0xE4, 0x31, 0x31, 0x8F,
+        0x2D, 0xCC, 0x84, 0xF0, 0xC4, 0x02, 0x78, 0x99, 0x8A, 0x8D, 0xE8, 0x43, 0x10, 0xCE, 0x80, 0x02,
+        0x4F, 0xE2, 0xFF, 0x30, 0x40, 0x32, 0x04, 0x01, 0x00, 0x0E, 0xA3, 0x85, 0x05, 0x98, 0x4C, 0x00,
+        0x1A, 0x1C, 0xF1, 0x19, 0x81, 0x40, 0x4B, 0x87, 0xDF, 0xCB, 0x72, 0xE0, 0xD0, 0x13, 0xDF, 0xE3,
+        0xF7, 0x91, 0x18, 0x34, 0x95, 0xC5, 0x25, 0x22, 0xE0, 0xDE, 0xFE, 0x3E, 0xF9, 0x42, 0x52, 0x36,
+        0x8F, 0x86, 0xC1, 0x88, 0x33, 0x70, 0xD1, 0xC5, 0xC4, 0x40, 0xEF, 0xC7, 0xB8, 0x06, 0x92, 0x5E,
+        0xBE, 0xFD, 0x20, 0x80, 0x3B, 0xE4, 0xFB, 0xC1, 0x88, 0x08, 0xA6, 0x5B, 0xE6, 0xB8, 0xC6, 0xE0,
+        0xDC, 0x7B, 0xE2, 0x31, 0x96, 0x37, 0xC1, 0xD7, 0x11, 0x85, 0xC5, 0x8E, 0xF0, 0x16, 0xEF, 0x51,
+        0x7B, 0xEC, 0x41, 0x90, 0xB7, 0x1E, 0xFB, 0x02, 0x0C, 0xDF, 0x36, 0xF9, 0x58, 0xC4, 0x01, 0x77,
+        0xFB, 0xA3, 0x45, 0x85, 0x9B, 0x93, 0x64, 0x58, 0xC2, 0x9C, 0x00, 0x08, 0x00, 0x20, 0x00, 0x50,
+        0x01, 0x40, 0x01, 0x00, 0x0D, 0x00, 0x28, 0x01, 0x18, 0x01, 0x78, 0x25, 0xF0, 0x73, 0x76, 0xA9,
+        0x5F, 0xED, 0x1C, 0xFF, 0xDA, 0x3A, 0x35, 0x49, 0x0E, 0x70, 0xDF, 0xFF, 0xFB, 0xD9, 0xDC, 0x5A,
+        0x73, 0x20, 0xC4, 0x86, 0x06, 0x04, 0x00, 0x40, 0x00, 0x41, 0x01, 0x19, 0x17, 0x8D, 0xE3, 0x18,
+        0x11, 0x03, 0x7B, 0xFB, 0xD8, 0x35, 0xAC, 0x39, 0xDC, 0xE7, 0x78, 0xC0, 0x07, 0x94, 0x07, 0xAC,
+        0x32, 0xC5, 0xFB, 0x86, 0x04, 0x97, 0x18, 0x6F, 0x23, 0x20, 0xDC, 0x18, 0x4B, 0x39, 0xDC, 0x8E,
+        0x23, 0x18, 0x4E, 0xF9, 0x2E, 0x5C, 0x8C, 0xA3, 0x39, 0xDC, 0xCA, 0x48, 0x04, 0x60, 0x3B, 0xF8,
+        0xF7, 0x90, 0x00, 0x84, 0xDE, 0x0C, 0xB0, 0x84, 0x22, 0x5F, 0x27, 0xBE, 0x08, 0x10, 0x96, 0x4B,
+        0xC2, 0xF1, 0x82, 0x11, 0x83, 0xC3, 0xB9, 0x91, 0x30, 0x88, 0x11, 0x7A, 0x5B, 0xC4, 0x34, 0x88,
+        0x81, 0x49, 0x2C, 0xC4, 0xC6, 0x11, 0xD2, 0xE1, 0x73, 0xA0, 0x80, 0x10, 0xE1, 0xC4, 0x6C, 0xB8,
+        0x0E, 0x02, 0x00, 0x27, 0xA7, 0xBE, 0x80, 0xB8, 0x01, 0x8D, 0xF9, 0xD9, 0xE7, 0xBE, 0x00, 0xCD,
+        0xDE, 0x60, 0x02, 0x3F, 0xFF, 0x2F, 0xFF, 0x46, 0x31, 0x82, 0xBD, 0x1C, 0x84, 0x84, 0x80, 0x52,
+        0xF3, 0xAF, 0x94, 0x8B, 0x0A, 0x0E, 0x6B, 0xE7, 0x71, 0x89, 0x70, 0xDE, 0x52, 0x7A, 0xB0, 0x11,
+        0x4D, 0x4E, 0xA6, 0x71, 0x24, 0x85, 0x6E, 0x81, 0x74, 0x58, 0xAB, 0x82, 0x50, 0xC3, 0x89, 0xE2,
+        0xC9, 0xAB, 0xA1, 0x30, 0x2C, 0xB8, 0x9B, 0xCE, 0xF0, 0xCE, 0xC0, 0x1B, 0xCA, 0x99, 0xB8, 0x2E,
+        0x6C, 0xCD, 0x1C, 0xAF, 0x3B, 0xC3, 0x70, 0x42, 0x54, 0x79, 0xEF, 0x25, 0x89, 0x2C, 0x61, 0x51,
+        0xF3, 0xB8, 0x92, 0xC1, 0x27, 0x79, 0x9E, 0x8E, 0x65, 0x06, 0x5C, 0xAF, 0x9D, 0xC6, 0x0A, 0x5C,
+        0x18, 0xEF, 0xCD, 0x09, 0x70, 0x6C, 0xBC, 0xAC, 0x63, 0x2E, 0x16, 0x0D, 0xE6, 0x99, 0x60, 0xC4,
+        0x2F, 0x9A, 0x2E, 0x5C, 0x5C, 0xDC, 0x2E, 0x2C, 0x44, 0x09, 0xBC, 0x53, 0x36, 0x31, 0x03, 0x5A,
+        0x59, 0xDE, 0xAF, 0x47, 0x00, 0x01, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x60, 0x01, 0xE0, 0x03, 0x40,
+        0x3C, 0x80, 0x3C, 0x88, 0xEA, 0x22, 0x6B, 0x29, 0x85, 0xF1, 0xC0, 0x3E, 0x04, 0x7B, 0xC0, 0x8E,
+        0xFC, 0x70, 0x14, 0xA6, 0x0C, 0x7F, 0xFF, 0xC6, 0xDF, 0xEE, 0x93, 0xD3, 0xC4, 0x32, 0x1D, 0x05,
+        0x80, 0x00, 0xA0, 0x20, 0x00, 0x00, 0x04, 0x03, 0x01, 0x00, 0x86, 0xE0, 0xC2, 0x31, 0x23, 0x1E,
+        0x0D, 0x24, 0xDE, 0x20, 0x46, 0x4B, 0x82, 0x5E, 0x59, 0x2E, 0x59, 0xCE, 0xE0, 0x41, 0x60, 0xE5,
+        0x39, 0xB8, 0xE1, 0x71, 0x18, 0xC6, 0x66, 0xE3, 0x97, 0x10, 0xE0, 0xFB, 0xC8, 0xC2, 0xE1, 0x19,
+        0x7C, 0xEC, 0x1C, 0xB8, 0xC0, 0xCB, 0x7E, 0x5D, 0xF1, 0x06, 0x0E, 0x24, 0xBE, 0x76, 0x60, 0xC4,
+        0x71, 0x23, 0x8E, 0xFC, 0xD9, 0x88, 0x42, 0x0E, 0x84, 0xE2, 0x54, 0x3A, 0x66, 0x9A, 0x18, 0x5E,
+        0x52, 0x66, 0xE0, 0x3E, 0x50, 0xA7, 0x13, 0x41, 0x38, 0x29, 0xD0, 0x9C, 0x49, 0x25, 0x8D, 0xD3,
+        0x81, 0x0D, 0x3C, 0x48, 0x82, 0x53, 0x08, 0x4F, 0x12, 0x0D, 0x5D, 0x56, 0x68, 0x5C, 0x62, 0x1E,
+        0x7B, 0x99, 0xBC, 0x2E, 0x09, 0x19, 0x7C, 0xEC, 0xE5, 0x30, 0x64, 0x14, 0xCE, 0xCF, 0x37, 0x08,
+        0x31, 0x89, 0x63, 0x78, 0xAB, 0x51, 0x20, 0x02, 0x3F, 0xF4, 0xFF, 0xC8, 0x00, 0x4D, 0x05, 0xA3,
+        0x03, 0x04, 0x78, 0x13, 0x2E, 0xA2, 0xD0, 0x71, 0x56, 0xE0, 0xD1, 0x33, 0x12, 0x38, 0xD9, 0xA7,
+        0x17, 0xC5, 0xBA, 0x19, 0xB0, 0xBC, 0x50, 0xBE, 0x55, 0xC2, 0x74, 0x5A, 0x00, 0xC4, 0xA8, 0xCE,
+        0xAE, 0x86, 0xBF, 0x3B, 0x72, 0x58, 0x0B, 0xC7, 0x47, 0x04, 0xE6, 0xA7, 0x37, 0x2C, 0xA7, 0xE1,
+        0x6C, 0x24, 0xE0, 0xBA, 0xCF, 0x59, 0x08, 0x32, 0xD4, 0xB5, 0x13, 0x0D, 0x3A, 0x70, 0xC0, 0x05,
+        0xEA, 0xC5, 0xB9, 0xE7, 0x06, 0x1B, 0xE5, 0x72, 0x6C, 0xDF, 0x28, 0x41, 0x48, 0xB2, 0xCC, 0x52,
+        0xF9, 0xB8, 0x1C, 0xBD, 0xB8, 0xBD, 0x4C, 0x84, 0x8B, 0x33, 0xB3, 0x28, 0x66, 0x9C, 0x1D, 0x8C,
+        0x4C, 0x77, 0x22, 0x02, 0x2F, 0xCE, 0xDE, 0x2F, 0x9D, 0x89, 0x04, 0x10, 0x86, 0xE3, 0x97, 0x1B,
+        0xCD, 0x80, 0x2C, 0x27, 0xBE, 0xF4, 0xB7, 0xB8, 0x00, 0x18, 0x00, 0x10, 0x02, 0x80, 0x07, 0xC0,
+        0x45, 0x00, 0xFB, 0x07, 0xF8, 0x1F, 0x2C, 0xE0, 0xE3, 0xB4, 0x5D, 0x2F, 0xA7, 0xE0, 0xC7, 0x7C,
+        0x06, 0xB7, 0x80, 0xD5, 0xFC, 0x18, 0xF6, 0x97, 0xCE, 0xBF, 0xFF, 0x68, 0xDF, 0xC0, 0xDD, 0xE6,
+        0x3F, 0xB1, 0xF8, 0x22, 0x41, 0x00, 0x13, 0x00, 0x40, 0x10, 0x01, 0x80, 0x10, 0x04, 0x00, 0x00,
+        0x10, 0x03, 0x1E, 0x52, 0x00, 0xC0, 0x79, 0xB9, 0x03, 0xBD, 0xDB, 0xBF, 0x21, 0x93, 0x0B, 0xE7,
+        0x64, 0xDC, 0xF3, 0xD9, 0x00, 0x88, 0xDE, 0x4A, 0x46, 0x3C, 0xD3, 0x94, 0x07, 0x2B, 0xE5, 0x64,
+        0x48, 0x24, 0x83, 0x60, 0x63, 0x61, 0x97, 0x9D, 0xC2, 0x0C, 0xAE, 0x32, 0x24, 0x43, 0x3B, 0xC1,
+        0x78, 0xD9, 0x9D, 0xE0, 0x98, 0x53, 0x05, 0x80, 0xC9, 0x60, 0x19, 0x73, 0x4A, 0x0C, 0x3A, 0x66,
+        0x2B, 0x30, 0x08, 0xD7, 0x25, 0xA9, 0x84, 0xE0, 0x91, 0xC6, 0xC4, 0x18, 0x63, 0xCD, 0x27, 0x34,
+        0x85, 0xE4, 0xD9, 0x02, 0x06, 0x0B, 0x8C, 0x65, 0x44, 0xE3, 0x3A, 0x64, 0x79, 0x60, 0x39, 0x37,
+        0x2C, 0x99, 0xDC, 0x10, 0x93, 0x70, 0x78, 0xEE, 0x79, 0xF7, 0xCA, 0x51, 0x2B, 0x8D, 0x8A, 0x6A,
+        0x25, 0x38, 0xC4, 0x93, 0x80, 0x70, 0xE6, 0x14, 0x5E, 0x18, 0x8B, 0x1F, 0x9B, 0x2E, 0x40, 0x00,
+        0x00, 0x00, 0x00
+    };
+
+    static const AKWFTableRef tables[count] PROGMEM = {
+        { data +      0, 600 },   //   0 AKWF_saw_0001
+        { data +    252, 600 },   //   1 AKWF_saw_0002
+        { data +    630, 600 },   //   2 AKWF_saw_0003
+        { data +    987, 600 },   //   3 AKWF_saw_0004
+        { data +   1352, 600 },   //   4 AKWF_saw_0005
+        { data +   1655, 600 },   //   5 AKWF_saw_0006
+        { data +   2024, 600 },   //   6 AKWF_saw_0007
+        { data +   2348, 600 },   //   7 AKWF_saw_0008
+        { data +   2605, 600 },   //   8 AKWF_saw_0009
+        { data +   2862, 600 },   //   9 AKWF_saw_0010
+        { data +   3134, 600 },   //  10 AKWF_saw_0011
+        { data +   3454, 600 },   //  11 AKWF_saw_0012
+        { data +   3775, 600 },   //  12 AKWF_saw_0013
+        { data +   4091, 600 },   //  13 AKWF_saw_0014
+        { data +   4662, 600 },   //  14 AKWF_saw_0015
+        { data +   5166, 600 },   //  15 AKWF_saw_0016
+        { data +   5415, 600 },   //  16 AKWF_saw_0017
+        { data +   5823, 600 },   //  17 AKWF_saw_0018
+        { data +   6104, 600 },   //  18 AKWF_saw_0019
+        { data +   6398, 600 },   //  19 AKWF_saw_0020
+        { data +   6685, 600 },   //  20 AKWF_saw_0021
+        { data +   6961, 600 },   //  21 AKWF_saw_0022
+        { data +   7226, 600 },   //  22 AKWF_saw_0023
+        { data +   7501, 600 },   //  23 AKWF_saw_0024
+        { data +   7762, 600 },   //  24 AKWF_saw_0025
+        { data +   8025, 600 },   //  25 AKWF_saw_0026
+        { data +   8286, 600 },   //  26 AKWF_saw_0027
+        { data +   8567, 600 },   //  27 AKWF_saw_0028
+        { data +   8864, 600 },   //  28 AKWF_saw_0029
+        { data +   9164, 600 },   //  29 AKWF_saw_0030
+        { data +   9472, 600 },   //  30 AKWF_saw_0031
+        { data +   9787, 600 },   //  31 AKWF_saw_0032
+        { data +  10104, 600 },   //  32 AKWF_saw_0033
+        { data +  10425, 600 },   //  33 AKWF_saw_0034
+        { data +  10690, 600 },   //  34 AKWF_saw_0035
+        { data +  10967, 600 },   //  35 AKWF_saw_0036
+        { data +  11224, 600 },   //  36 AKWF_saw_0037
+        { data +  11505, 600 },   //  37 AKWF_saw_0038
+        { data +  11776, 600 },   //  38 AKWF_saw_0039
+        { data +  12058, 600 },   //  39 AKWF_saw_0040
+        { data +  12362, 600 },   //  40 AKWF_saw_0041
+        { data +  12648, 600 },   //  41 AKWF_saw_0042
+        { data +  12925, 600 },   //  42 AKWF_saw_0043
+        { data +  13232, 600 },   //  43 AKWF_saw_0044
+        { data +  13551, 600 },   //  44 AKWF_saw_0045
+        { data +  13819, 600 },   //  45 AKWF_saw_0046
+        { data +  14113, 600 },   //  46 AKWF_saw_0047
+        { data +  14383, 600 },   //  47 AKWF_saw_0048
+        { data +  14674, 600 },   //  48 AKWF_saw_0049
+        { data +  14983, 600 }    //  49 AKWF_saw_0050
+    };
+
+} // namespace AKWF_BwSaw
@@ -1,1304 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwSaw {
-
-    // AKWF_saw_0001 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0001[600] PROGMEM = {
-        19373, 32767, 28135, 31109, 28726, 30264, 29001, 29619, 29082, 29139, 29001, 28825, 
-        28805, 28604, 28535, 28366, 28362, 28246, 28128, 28012, 27896, 27780, 27663, 27547, 
-        27431, 27315, 27198, 27083, 26967, 26852, 26736, 26620, 26505, 26390, 26275, 26160, 
-        26045, 25930, 25816, 25701, 25586, 25472, 25358, 25243, 25129, 25015, 24901, 24787, 
-        24673, 24559, 24446, 24332, 24218, 24105, 23992, 23878, 23766, 23653, 23540, 23427, 
-        23314, 23202, 23090, 22977, 22864, 22753, 22641, 22528, 22417, 22305, 22193, 22082, 
-        21970, 21858, 21747, 21636, 21524, 21414, 21302, 21192, 21081, 20970, 20859, 20749, 
-        20638, 20528, 20418, 20308, 20197, 20088, 19977, 19868, 19759, 19648, 19539, 19429, 
-        19320, 19211, 19102, 18993, 18884, 18776, 18666, 18558, 18449, 18340, 18232, 18124, 
-        18016, 17908, 17799, 17691, 17583, 17476, 17368, 17261, 17152, 17045, 16938, 16830, 
-        16723, 16616, 16509, 16403, 16296, 16189, 16082, 15976, 15869, 15763, 15657, 15550, 
-        15444, 15338, 15232, 15126, 15021, 14916, 14810, 14704, 14599, 14493, 14389, 14283, 
-        14178, 14073, 13968, 13864, 13759, 13654, 13549, 13446, 13341, 13236, 13133, 13028, 
-        12924, 12821, 12717, 12614, 12510, 12406, 12303, 12199, 12096, 11992, 11890, 11786, 
-        11683, 11581, 11477, 11375, 11272, 11170, 11068, 10965, 10863, 10760, 10659, 10556, 
-        10454, 10353, 10251, 10149, 10048, 9946, 9845, 9744, 9642, 9541, 9440, 9339, 
-        9238, 9137, 9037, 8936, 8836, 8734, 8634, 8534, 8434, 8334, 8234, 8133, 
-        8033, 7934, 7834, 7734, 7635, 7536, 7436, 7337, 7238, 7139, 7040, 6941, 
-        6842, 6743, 6644, 6545, 6447, 6348, 6250, 6151, 6053, 5955, 5856, 5759, 
-        5661, 5563, 5465, 5367, 5271, 5173, 5075, 4978, 4880, 4784, 4686, 4589, 
-        4492, 4396, 4299, 4202, 4106, 4009, 3912, 3815, 3720, 3623, 3528, 3431, 
-        3335, 3239, 3143, 3048, 2952, 2857, 2761, 2666, 2570, 2474, 2380, 2284, 
-        2190, 2095, 2000, 1905, 1810, 1716, 1621, 1527, 1433, 1338, 1244, 1149, 
-        1055, 962, 867, 774, 680, 587, 493, 399, 306, 212, 119, 26, 
-        -66, -160, -253, -345, -438, -530, -623, -716, -809, -901, -993, -1085, 
-        -1178, -1270, -1362, -1453, -1545, -1638, -1730, -1821, -1913, -2004, -2096, -2187, 
-        -2279, -2370, -2461, -2552, -2642, -2733, -2824, -2915, -3006, -3096, -3187, -3277, 
-        -3368, -3457, -3548, -3638, -3728, -3819, -3909, -3999, -4088, -4178, -4267, -4357, 
-        -4446, -4536, -4625, -4715, -4803, -4893, -4982, -5070, -5159, -5249, -5337, -5426, 
-        -5515, -5603, -5691, -5779, -5868, -5955, -6044, -6133, -6220, -6308, -6396, -6484, 
-        -6571, -6659, -6746, -6834, -6921, -7009, -7096, -7184, -7270, -7358, -7444, -7531, 
-        -7618, -7705, -7791, -7878, -7964, -8050, -8138, -8224, -8309, -8396, -8482, -8568, 
-        -8655, -8740, -8826, -8912, -8998, -9083, -9168, -9253, -9340, -9425, -9510, -9595, 
-        -9680, -9766, -9850, -9935, -10020, -10104, -10189, -10273, -10359, -10443, -10528, -10612, 
-        -10696, -10780, -10864, -10948, -11032, -11116, -11200, -11284, -11367, -11451, -11535, -11618, 
-        -11702, -11785, -11868, -11952, -12035, -12117, -12200, -12283, -12366, -12449, -12532, -12615, 
-        -12696, -12779, -12862, -12944, -13027, -13109, -13191, -13273, -13355, -13437, -13518, -13601, 
-        -13683, -13764, -13845, -13927, -14009, -14090, -14171, -14253, -14334, -14415, -14496, -14577, 
-        -14658, -14739, -14820, -14901, -14981, -15062, -15143, -15223, -15304, -15383, -15464, -15544, 
-        -15624, -15704, -15784, -15864, -15944, -16024, -16104, -16183, -16263, -16342, -16421, -16501, 
-        -16580, -16660, -16739, -16819, -16897, -16976, -17055, -17134, -17212, -17292, -17370, -17448, 
-        -17528, -17606, -17684, -17763, -17841, -17919, -17997, -18076, -18153, -18231, -18309, -18386, 
-        -18465, -18542, -18620, -18697, -18776, -18853, -18930, -19007, -19084, -19161, -19238, -19315, 
-        -19393, -19470, -19547, -19623, -19700, -19777, -19853, -19930, -20006, -20083, -20159, -20235, 
-        -20311, -20387, -20464, -20540, -20616, -20692, -20767, -20843, -20919, -20995, -21070, -21146, 
-        -21222, -21297, -21371, -21447, -21522, -21597, -21673, -21748, -21823, -21897, -21972, -22047, 
-        -22122, -22197, -22270, -22345, -22420, -22494, -22569, -22643, -22717, -22791, -22866, -22939, 
-        -23013, -23088, -23161, -23235, -23309, -23382, -23456, -23530, -23602, -23676, -23750, -23822, 
-        -23896, -23969, -24042, -24116, -24188, -24261, -24334, -24407, -24445, -24570, -24593, -24752, 
-        -24728, -24855, -24956, -24837, -25352, -24660, -25913, -24286, -26676, -23580, -28374, -16351 
-    };
-
-    // AKWF_saw_0002 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0002[600] PROGMEM = {
-        284, 562, 705, 886, 1024, 1178, 1309, 1448, 1571, 1704, 1817, 1940, 
-        2048, 2161, 2258, 2359, 2446, 2527, 2608, 2695, 2782, 2875, 2967, 3064, 
-        3161, 3261, 3359, 3465, 3564, 3671, 3774, 3885, 3991, 4104, 4214, 4329, 
-        4443, 4559, 4677, 4796, 4914, 5039, 5159, 5284, 5405, 5534, 5658, 5788, 
-        5913, 6044, 6173, 6305, 6435, 6568, 6701, 6834, 6967, 7101, 7237, 7373, 
-        7507, 7644, 7781, 7919, 8056, 8194, 8332, 8472, 8610, 8749, 8890, 9029, 
-        9169, 9309, 9450, 9590, 9735, 9872, 10016, 10157, 10297, 10442, 10582, 10726, 
-        10866, 11012, 11150, 11296, 11437, 11582, 11722, 11867, 12009, 12150, 12295, 12437, 
-        12579, 12723, 12866, 13007, 13150, 13293, 13436, 13580, 13719, 13863, 14003, 14147, 
-        14287, 14430, 14572, 14712, 14855, 14995, 15136, 15276, 15417, 15558, 15699, 15838, 
-        15976, 16115, 16256, 16395, 16533, 16672, 16809, 16946, 17084, 17224, 17358, 17497, 
-        17630, 17770, 17901, 18040, 18173, 18307, 18443, 18576, 18710, 18842, 18975, 19109, 
-        19238, 19371, 19504, 19632, 19762, 19893, 20021, 20150, 20279, 20407, 20533, 20662, 
-        20788, 20914, 21040, 21165, 21287, 21413, 21536, 21659, 21782, 21904, 22025, 22147, 
-        22266, 22386, 22505, 22624, 22741, 22858, 22976, 23092, 23208, 23322, 23438, 23550, 
-        23665, 23776, 23888, 24001, 24110, 24219, 24329, 24438, 24547, 24653, 24759, 24867, 
-        24970, 25076, 25179, 25284, 25385, 25486, 25588, 25689, 25788, 25888, 25984, 26083, 
-        26179, 26274, 26370, 26465, 26557, 26650, 26744, 26833, 26926, 27012, 27104, 27189, 
-        27280, 27362, 27452, 27533, 27621, 27701, 27788, 27865, 27947, 28029, 28107, 28184, 
-        28264, 28338, 28416, 28488, 28565, 28635, 28710, 28778, 28853, 28918, 28991, 29053, 
-        29126, 29186, 29256, 29316, 29383, 29444, 29506, 29565, 29626, 29683, 29744, 29797, 
-        29855, 29910, 29963, 30018, 30069, 30120, 30171, 30220, 30267, 30315, 30363, 30406, 
-        30452, 30495, 30540, 30577, 30620, 30659, 30698, 30734, 30772, 30807, 30844, 30875, 
-        30909, 30940, 30971, 30998, 31031, 31055, 31086, 31106, 31137, 31154, 31183, 31198, 
-        31224, 31239, 31261, 31275, 31297, 31306, 31326, 31333, 31353, 31356, 31374, 31376, 
-        31393, 31390, 31403, 31159, 29762, 26031, 20603, 15239, 11032, 7320, 3838, 239, 
-        -3384, -5687, -7836, -9712, -11525, -13188, -14804, -16297, -17733, -19051, -20300, -21437, 
-        -22503, -23465, -24361, -25160, -25905, -26567, -27181, -27725, -28232, -28679, -29097, -29465, 
-        -29810, -30113, -30400, -30650, -30888, -31096, -31292, -31465, -31629, -31768, -31905, -32019, 
-        -32131, -32226, -32313, -32391, -32461, -32520, -32577, -32618, -32659, -32690, -32718, -32735, 
-        -32755, -32762, -32767, -32766, -32763, -32753, -32741, -32722, -32702, -32677, -32650, -32618, 
-        -32582, -32544, -32504, -32459, -32412, -32362, -32311, -32254, -32198, -32137, -32074, -32009, 
-        -31943, -31875, -31801, -31728, -31654, -31577, -31496, -31417, -31333, -31247, -31162, -31073, 
-        -30984, -30892, -30797, -30704, -30606, -30509, -30411, -30308, -30209, -30103, -30000, -29894, 
-        -29785, -29676, -29567, -29455, -29343, -29229, -29114, -28998, -28879, -28762, -28642, -28523, 
-        -28400, -28280, -28154, -28029, -27905, -27778, -27650, -27523, -27393, -27261, -27134, -26998, 
-        -26867, -26732, -26598, -26461, -26328, -26188, -26051, -25913, -25772, -25635, -25491, -25352, 
-        -25209, -25065, -24922, -24779, -24633, -24489, -24342, -24195, -24048, -23901, -23752, -23601, 
-        -23454, -23301, -23151, -23001, -22847, -22697, -22543, -22390, -22238, -22081, -21928, -21772, 
-        -21617, -21461, -21304, -21148, -20990, -20833, -20673, -20518, -20355, -20199, -20038, -19878, 
-        -19719, -19559, -19396, -19236, -19072, -18914, -18751, -18588, -18426, -18263, -18099, -17935, 
-        -17774, -17608, -17446, -17280, -17118, -16951, -16788, -16621, -16457, -16292, -16126, -15961, 
-        -15795, -15630, -15463, -15296, -15130, -14965, -14798, -14631, -14466, -14297, -14133, -13965, 
-        -13798, -13633, -13464, -13297, -13132, -12965, -12795, -12633, -12461, -12299, -12131, -11965, 
-        -11797, -11631, -11463, -11299, -11131, -10965, -10798, -10633, -10466, -10300, -10135, -9969, 
-        -9805, -9638, -9473, -9309, -9142, -8979, -8814, -8651, -8487, -8322, -8160, -7993, 
-        -7832, -7668, -7506, -7344, -7180, -7020, -6856, -6698, -6534, -6375, -6213, -6054, 
-        -5892, -5735, -5574, -5418, -5254, -5100, -4938, -4784, -4623, -4472, -4308, -4155, 
-        -3996, -3844, -3684, -3534, -3374, -3224, -3063, -2915, -2756, -2605, -2449, -2298, 
-        -2138, -1990, -1828, -1680, -1517, -1367, -1196, -1050, -865, -714, -502, -322 
-    };
-
-    // AKWF_saw_0003 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0003[600] PROGMEM = {
-        35, 165, 274, 392, 507, 620, 735, 851, 963, 1081, 1194, 1307, 
-        1425, 1537, 1653, 1766, 1884, 1996, 2112, 2227, 2342, 2456, 2571, 2684, 
-        2799, 2915, 3030, 3144, 3260, 3374, 3488, 3604, 3719, 3831, 3948, 4062, 
-        4178, 4290, 4407, 4521, 4636, 4750, 4866, 4980, 5096, 5209, 5324, 5440, 
-        5554, 5670, 5783, 5898, 6014, 6127, 6242, 6357, 6472, 6587, 6701, 6816, 
-        6929, 7046, 7162, 7275, 7390, 7505, 7618, 7736, 7848, 7965, 8079, 8192, 
-        8308, 8423, 8536, 8652, 8766, 8882, 8995, 9111, 9226, 9341, 9456, 9570, 
-        9682, 9800, 9915, 10028, 10143, 10259, 10372, 10489, 10603, 10717, 10831, 10948, 
-        11061, 11176, 11292, 11405, 11522, 11633, 11750, 11864, 11979, 12094, 12209, 12323, 
-        12437, 12553, 12668, 12781, 12897, 13013, 13125, 13243, 13355, 13471, 13586, 13701, 
-        13815, 13929, 14048, 14157, 14276, 14388, 14504, 14619, 14732, 14848, 14962, 15076, 
-        15191, 15307, 15421, 15537, 15650, 15766, 15880, 15996, 16109, 16224, 16339, 16455, 
-        16567, 16685, 16798, 16914, 17027, 17142, 17258, 17372, 17485, 17603, 17715, 17831, 
-        17946, 18060, 18175, 18288, 18406, 18519, 18634, 18748, 18864, 18977, 19093, 19207, 
-        19323, 19438, 19552, 19667, 19780, 19898, 20011, 20125, 20241, 20354, 20470, 20585, 
-        20699, 20815, 20928, 21043, 21159, 21272, 21387, 21503, 21617, 21731, 21846, 21961, 
-        22077, 22189, 22308, 22419, 22536, 22648, 22766, 22879, 22993, 23110, 23222, 23338, 
-        23454, 23565, 23685, 23797, 23912, 24025, 24142, 24256, 24373, 24484, 24602, 24713, 
-        24832, 24944, 25060, 25173, 25291, 25403, 25520, 25632, 25747, 25865, 25978, 26091, 
-        26207, 26321, 26437, 26552, 26666, 26780, 26896, 27009, 27126, 27239, 27355, 27468, 
-        27585, 27698, 27814, 27926, 28044, 28157, 28272, 28387, 28503, 28615, 28734, 28844, 
-        28962, 29074, 29191, 29303, 29419, 29533, 29650, 29764, 29879, 29993, 30107, 30223, 
-        30338, 30451, 30567, 30680, 30798, 30910, 31028, 31138, 31256, 31369, 31487, 31597, 
-        31716, 31828, 31944, 32058, 32175, 32287, 32402, 32517, 32630, 32767, 32609, 28778, 
-        20298, 11436, 4392, -884, -4820, -7799, -10100, -11905, -13361, -14548, -15547, -16398, 
-        -17142, -17800, -18393, -18932, -19428, -19887, -20316, -20717, -21094, -21451, -21784, -22103, 
-        -22402, -22684, -22951, -23205, -23443, -23671, -23882, -24082, -24273, -24448, -24618, -24769, 
-        -24919, -25051, -25182, -25296, -25408, -25506, -25602, -25685, -25764, -25833, -25897, -25954, 
-        -26005, -26049, -26090, -26118, -26149, -26169, -26188, -26199, -26206, -26209, -26207, -26202, 
-        -26190, -26178, -26162, -26138, -26115, -26087, -26056, -26020, -25985, -25942, -25903, -25855, 
-        -25806, -25757, -25702, -25649, -25588, -25532, -25469, -25405, -25340, -25272, -25203, -25132, 
-        -25060, -24986, -24910, -24833, -24755, -24674, -24592, -24511, -24428, -24341, -24258, -24170, 
-        -24082, -23993, -23904, -23811, -23722, -23629, -23534, -23442, -23345, -23250, -23154, -23056, 
-        -22958, -22861, -22762, -22662, -22562, -22461, -22359, -22259, -22157, -22053, -21950, -21846, 
-        -21743, -21638, -21533, -21428, -21323, -21217, -21112, -21003, -20900, -20789, -20684, -20574, 
-        -20469, -20359, -20252, -20142, -20034, -19925, -19814, -19707, -19596, -19486, -19378, -19265, 
-        -19156, -19045, -18933, -18825, -18712, -18602, -18491, -18379, -18267, -18155, -18043, -17931, 
-        -17820, -17708, -17596, -17482, -17372, -17258, -17146, -17035, -16921, -16809, -16695, -16583, 
-        -16471, -16356, -16244, -16129, -16017, -15902, -15792, -15676, -15564, -15449, -15337, -15221, 
-        -15112, -14994, -14882, -14768, -14653, -14541, -14425, -14314, -14198, -14085, -13971, -13858, 
-        -13742, -13628, -13514, -13400, -13286, -13172, -13059, -12944, -12828, -12717, -12600, -12486, 
-        -12373, -12258, -12144, -12029, -11915, -11801, -11687, -11571, -11458, -11343, -11228, -11113, 
-        -11000, -10885, -10771, -10656, -10541, -10426, -10314, -10198, -10083, -9970, -9855, -9739, 
-        -9627, -9511, -9396, -9281, -9168, -9053, -8937, -8824, -8709, -8594, -8481, -8363, 
-        -8250, -8137, -8020, -7907, -7792, -7676, -7563, -7448, -7333, -7220, -7102, -6990, 
-        -6874, -6761, -6645, -6530, -6417, -6300, -6187, -6071, -5959, -5841, -5729, -5612, 
-        -5500, -5384, -5269, -5155, -5039, -4925, -4810, -4696, -4580, -4467, -4351, -4236, 
-        -4123, -4008, -3892, -3780, -3662, -3549, -3434, -3319, -3204, -3088, -2976, -2860, 
-        -2745, -2631, -2517, -2401, -2288, -2172, -2058, -1941, -1829, -1713, -1598, -1483, 
-        -1370, -1255, -1137, -1025, -909, -796, -681, -565, -450, -338, -219, -110 
-    };
-
-    // AKWF_saw_0004 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0004[600] PROGMEM = {
-        31, 140, 239, 340, 437, 534, 627, 719, 809, 896, 978, 1062, 
-        1132, 1205, 1268, 1333, 1404, 1478, 1550, 1626, 1704, 1784, 1866, 1947, 
-        2033, 2120, 2203, 2295, 2383, 2472, 2567, 2657, 2756, 2849, 2950, 3047, 
-        3148, 3250, 3352, 3455, 3559, 3666, 3772, 3879, 3987, 4098, 4207, 4318, 
-        4429, 4542, 4654, 4770, 4882, 4999, 5112, 5230, 5346, 5463, 5581, 5699, 
-        5817, 5936, 6056, 6175, 6296, 6415, 6537, 6657, 6779, 6900, 7025, 7142, 
-        7268, 7390, 7513, 7637, 7759, 7882, 8008, 8128, 8257, 8378, 8503, 8627, 
-        8752, 8877, 9001, 9128, 9251, 9375, 9501, 9627, 9749, 9877, 10000, 10126, 
-        10251, 10377, 10503, 10626, 10753, 10877, 11000, 11126, 11251, 11375, 11501, 11624, 
-        11750, 11872, 11998, 12121, 12245, 12368, 12491, 12616, 12739, 12860, 12985, 13106, 
-        13228, 13351, 13474, 13593, 13716, 13836, 13959, 14077, 14201, 14319, 14440, 14558, 
-        14679, 14797, 14917, 15033, 15154, 15269, 15389, 15504, 15623, 15739, 15856, 15969, 
-        16086, 16200, 16316, 16429, 16543, 16656, 16770, 16883, 16995, 17105, 17218, 17328, 
-        17440, 17548, 17661, 17765, 17878, 17983, 18093, 18200, 18306, 18413, 18518, 18624, 
-        18729, 18835, 18935, 19041, 19143, 19245, 19348, 19447, 19550, 19646, 19748, 19844, 
-        19946, 20041, 20140, 20236, 20331, 20429, 20523, 20617, 20711, 20803, 20897, 20986, 
-        21081, 21168, 21260, 21348, 21437, 21525, 21612, 21699, 21785, 21871, 21953, 22041, 
-        22120, 22206, 22286, 22369, 22447, 22529, 22608, 22686, 22764, 22843, 22915, 22993, 
-        23068, 23141, 23216, 23287, 23361, 23433, 23501, 23573, 23641, 23710, 23775, 23844, 
-        23909, 23973, 24038, 24103, 24165, 24228, 24288, 24349, 24407, 24468, 24525, 24584, 
-        24639, 24696, 24751, 24803, 24858, 24908, 24963, 25010, 25063, 25112, 25160, 25208, 
-        25253, 25300, 25345, 25390, 25433, 25475, 25517, 25556, 25598, 25635, 25676, 25713, 
-        25747, 25785, 25817, 25854, 25885, 25918, 25947, 25980, 26008, 26037, 26066, 26092, 
-        26119, 26144, 26167, 26192, 26213, 26233, 26256, 26276, 26293, 26312, 26328, 26346, 
-        26359, 26375, 26390, 26400, 26413, 26423, 26434, 26440, 26451, 26457, 26462, 26469, 
-        26474, 26476, 26479, 26481, 26481, 26483, 26479, 26478, 26475, 26471, 26465, 26428, 
-        26090, 24362, 19802, 13429, 7913, 3643, -171, -3753, -6972, -9633, -11821, -13761, 
-        -15573, -17282, -18869, -20355, -21745, -23048, -24247, -25341, -26332, -27218, -28012, -28713, 
-        -29331, -29868, -30339, -30745, -31094, -31394, -31652, -31865, -32055, -32203, -32335, -32439, 
-        -32526, -32598, -32650, -32695, -32726, -32748, -32762, -32767, -32767, -32762, -32748, -32732, 
-        -32710, -32684, -32653, -32619, -32582, -32540, -32492, -32444, -32390, -32332, -32271, -32206, 
-        -32137, -32066, -31987, -31908, -31820, -31734, -31640, -31544, -31444, -31338, -31230, -31116, 
-        -31001, -30882, -30756, -30632, -30499, -30367, -30229, -30089, -29947, -29800, -29650, -29500, 
-        -29346, -29191, -29031, -28870, -28708, -28544, -28376, -28210, -28041, -27870, -27698, -27527, 
-        -27350, -27179, -27003, -26827, -26652, -26476, -26300, -26121, -25946, -25769, -25592, -25417, 
-        -25239, -25065, -24891, -24713, -24540, -24368, -24194, -24021, -23849, -23677, -23506, -23338, 
-        -23170, -23000, -22834, -22666, -22503, -22338, -22174, -22013, -21849, -21689, -21530, -21369, 
-        -21212, -21054, -20898, -20740, -20588, -20431, -20280, -20126, -19975, -19823, -19673, -19522, 
-        -19372, -19226, -19076, -18931, -18784, -18638, -18489, -18348, -18200, -18060, -17912, -17770, 
-        -17627, -17485, -17341, -17201, -17060, -16917, -16777, -16635, -16494, -16354, -16214, -16074, 
-        -15935, -15792, -15657, -15512, -15376, -15234, -15098, -14955, -14819, -14678, -14541, -14399, 
-        -14261, -14122, -13982, -13843, -13703, -13565, -13425, -13287, -13145, -13007, -12865, -12729, 
-        -12586, -12447, -12307, -12167, -12029, -11887, -11746, -11610, -11464, -11327, -11186, -11046, 
-        -10906, -10763, -10624, -10481, -10341, -10201, -10060, -9920, -9777, -9638, -9496, -9357, 
-        -9214, -9073, -8934, -8793, -8651, -8511, -8373, -8231, -8091, -7950, -7811, -7670, 
-        -7530, -7391, -7251, -7111, -6972, -6832, -6695, -6554, -6418, -6279, -6141, -6003, 
-        -5868, -5728, -5592, -5456, -5318, -5185, -5046, -4912, -4779, -4641, -4510, -4377, 
-        -4243, -4111, -3977, -3845, -3715, -3584, -3453, -3325, -3195, -3066, -2939, -2810, 
-        -2685, -2557, -2435, -2309, -2183, -2063, -1939, -1818, -1695, -1578, -1459, -1339, 
-        -1222, -1107, -990, -876, -762, -652, -538, -432, -319, -216, -104, -12 
-    };
-
-    // AKWF_saw_0005 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0005[600] PROGMEM = {
-        52, 124, 196, 271, 345, 421, 497, 573, 651, 729, 808, 886, 
-        965, 1046, 1126, 1207, 1286, 1367, 1450, 1531, 1612, 1695, 1777, 1860, 
-        1943, 2025, 2110, 2193, 2277, 2360, 2444, 2528, 2613, 2699, 2783, 2867, 
-        2953, 3038, 3124, 3210, 3296, 3382, 3468, 3554, 3640, 3727, 3813, 3899, 
-        3987, 4075, 4162, 4248, 4336, 4424, 4511, 4599, 4687, 4774, 4864, 4951, 
-        5039, 5128, 5216, 5305, 5393, 5482, 5571, 5659, 5748, 5838, 5927, 6016, 
-        6106, 6195, 6284, 6373, 6463, 6554, 6643, 6732, 6823, 6913, 7002, 7093, 
-        7182, 7273, 7363, 7453, 7544, 7634, 7725, 7816, 7905, 7996, 8087, 8178, 
-        8269, 8360, 8451, 8542, 8631, 8722, 8813, 8906, 8997, 9087, 9178, 9269, 
-        9360, 9451, 9542, 9633, 9726, 9817, 9908, 10000, 10091, 10182, 10273, 10366, 
-        10457, 10548, 10640, 10731, 10822, 10915, 11006, 11097, 11190, 11281, 11373, 11464, 
-        11555, 11648, 11739, 11831, 11922, 12015, 12106, 12198, 12289, 12380, 12473, 12564, 
-        12657, 12747, 12840, 12931, 13024, 13115, 13206, 13298, 13389, 13482, 13573, 13664, 
-        13756, 13847, 13938, 14031, 14122, 14214, 14305, 14396, 14489, 14580, 14671, 14762, 
-        14853, 14945, 15036, 15127, 15218, 15311, 15402, 15493, 15584, 15675, 15766, 15858, 
-        15949, 16040, 16131, 16222, 16313, 16404, 16493, 16586, 16675, 16766, 16857, 16948, 
-        17039, 17130, 17220, 17310, 17401, 17492, 17582, 17673, 17764, 17853, 17944, 18033, 
-        18124, 18214, 18304, 18394, 18483, 18574, 18663, 18754, 18844, 18933, 19022, 19113, 
-        19203, 19292, 19381, 19470, 19560, 19649, 19738, 19828, 19917, 20006, 20094, 20183, 
-        20273, 20362, 20450, 20539, 20626, 20716, 20803, 20893, 20980, 21070, 21157, 21245, 
-        21334, 21422, 21510, 21597, 21685, 21773, 21860, 21948, 22036, 22123, 22211, 22299, 
-        22386, 22472, 22560, 22648, 22734, 22821, 22907, 22995, 23081, 23167, 23253, 23340, 
-        23426, 23512, 23598, 23684, 23770, 23856, 23942, 24028, 24113, 24199, 24285, 24369, 
-        24455, 24541, 24626, 24710, 24796, 24880, 24965, 25051, 25135, 25219, 25304, 25388, 
-        25472, 25555, 25639, 25724, 25808, 25891, 25975, 26059, 1265, -15493, -31383, -28462, 
-        -32013, -28481, -31305, -30202, -32767, -32043, -32748, -30675, -29222, -25940, -23579, -20736, 
-        -19399, -18473, -18979, -19843, -21399, -22742, -23995, -24627, -24841, -24457, -23784, -22859, 
-        -21993, -21258, -20841, -20716, -20893, -21243, -21683, -22077, -22356, -22456, -22383, -22153, 
-        -21832, -21478, -21159, -20916, -20779, -20741, -20785, -20876, -20974, -21043, -21063, -21023, 
-        -20926, -20785, -20622, -20461, -20317, -20205, -20127, -20081, -20058, -20041, -20023, -19991, 
-        -19940, -19867, -19780, -19679, -19575, -19474, -19381, -19300, -19229, -19168, -19112, -19057, 
-        -18999, -18935, -18865, -18787, -18705, -18619, -18534, -18450, -18369, -18293, -18220, -18149, 
-        -18078, -18008, -17936, -17861, -17785, -17706, -17625, -17544, -17463, -17383, -17304, -17226, 
-        -17148, -17072, -16995, -16919, -16841, -16761, -16682, -16601, -16520, -16439, -16358, -16277, 
-        -16197, -16116, -16037, -15956, -15877, -15796, -15715, -15633, -15551, -15470, -15387, -15304, 
-        -15223, -15141, -15058, -14975, -14893, -14810, -14727, -14644, -14562, -14479, -14395, -14312, 
-        -14228, -14143, -14061, -13976, -13892, -13809, -13725, -13641, -13556, -13472, -13386, -13302, 
-        -13217, -13131, -13047, -12961, -12876, -12790, -12706, -12620, -12534, -12448, -12364, -12278, 
-        -12192, -12106, -12020, -11934, -11848, -11760, -11674, -11588, -11502, -11414, -11328, -11242, 
-        -11155, -11069, -10981, -10895, -10808, -10720, -10634, -10546, -10460, -10373, -10285, -10197, 
-        -10111, -10024, -9936, -9848, -9761, -9673, -9585, -9498, -9410, -9322, -9236, -9147, 
-        -9059, -8972, -8886, -8798, -8709, -8621, -8533, -8446, -8358, -8270, -8183, -8095, 
-        -8008, -7920, -7832, -7743, -7657, -7568, -7480, -7392, -7305, -7217, -7129, -7042, 
-        -6954, -6866, -6779, -6691, -6603, -6516, -6428, -6340, -6253, -6165, -6079, -5991, 
-        -5904, -5816, -5728, -5642, -5555, -5467, -5381, -5294, -5206, -5120, -5032, -4946, 
-        -4860, -4773, -4687, -4601, -4513, -4427, -4341, -4255, -4169, -4083, -3997, -3911, 
-        -3825, -3739, -3655, -3569, -3483, -3398, -3314, -3228, -3143, -3059, -2975, -2890, 
-        -2806, -2722, -2637, -2553, -2470, -2386, -2303, -2221, -2136, -2054, -1971, -1888, 
-        -1807, -1724, -1643, -1561, -1480, -1399, -1318, -1238, -1157, -1078, -998, -919, 
-        -840, -762, -684, -606, -529, -453, -377, -302, -228, -155, -82, -13 
-    };
-
-    // AKWF_saw_0006 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0006[600] PROGMEM = {
-        106, 256, 402, 554, 701, 850, 997, 1149, 1298, 1445, 1597, 1747, 
-        1896, 2042, 2195, 2344, 2491, 2643, 2795, 2942, 3094, 3244, 3396, 3546, 
-        3698, 3847, 4000, 4149, 4299, 4451, 4604, 4750, 4905, 5055, 5207, 5360, 
-        5509, 5659, 5802, 5948, 6088, 6226, 6366, 6503, 6643, 6781, 6921, 7058, 
-        7192, 7329, 7467, 7604, 7741, 7878, 8012, 8150, 8287, 8418, 8552, 8686, 
-        8823, 8958, 9092, 9226, 9360, 9491, 9628, 9759, 9894, 10028, 10156, 10290, 
-        10421, 10552, 10683, 10817, 10949, 11080, 11214, 11345, 11473, 11607, 11738, 11869, 
-        12001, 12132, 12263, 12391, 12522, 12650, 12781, 12909, 13040, 13168, 13299, 13427, 
-        13556, 13684, 13812, 13940, 14068, 14196, 14324, 14455, 14583, 14711, 14836, 14967, 
-        15092, 15220, 15348, 15476, 15604, 15729, 15858, 15983, 16111, 16236, 16364, 16489, 
-        16617, 16745, 16870, 16995, 17120, 17248, 17370, 17498, 17626, 17748, 17876, 17998, 
-        18126, 18248, 18373, 18501, 18626, 18751, 18873, 18998, 19126, 19248, 19373, 19498, 
-        19623, 19745, 19867, 19995, 20117, 20242, 20364, 20486, 20608, 20733, 20858, 20980, 
-        21105, 21227, 21349, 21474, 21596, 21721, 21843, 21965, 22090, 22212, 22334, 22459, 
-        22581, 22703, 22825, 22947, 23072, 23190, 23312, 23434, 23556, 23675, 23797, 23922, 
-        24041, 24166, 24285, 24407, 24529, 24648, 24770, 24895, 25014, 25136, 25255, 25377, 
-        25499, 25618, 25739, 25858, 25980, 26102, 26221, 26343, 26462, 26581, 26703, 26822, 
-        26944, 27066, 27185, 27304, 27423, 27541, 27663, 27782, 27904, 28020, 28142, 28261, 
-        28380, 28499, 28621, 28740, 28859, 28981, 29100, 29218, 29334, 29453, 29575, 29694, 
-        29813, 29929, 30048, 30167, 30286, 30404, 30526, 30642, 30761, 30877, 30996, 31118, 
-        31234, 31353, 31472, 31591, 31709, 31825, 31941, 32060, 32179, 32295, 32417, 32533, 
-        32652, 32767, 3085, 12723, 7631, 6945, 5418, 4716, 3808, 3228, 2481, 1948, 
-        1271, 756, 125, -381, -978, -1460, -2000, -2454, -2963, -3402, -3881, -4308, 
-        -4762, -5171, -5604, -6000, -6412, -6796, -7189, -7555, -7930, -8287, -8644, -8985, 
-        -9327, -9653, -9982, -10299, -10610, -10909, -11211, -11500, -11790, -12065, -12342, -12604, 
-        -12869, -13123, -13373, -13617, -13857, -14092, -14321, -14543, -14760, -14970, -15178, -15382, 
-        -15580, -15775, -15964, -16147, -16327, -16504, -16675, -16842, -17004, -17166, -17318, -17470, 
-        -17617, -17760, -17897, -18032, -18163, -18291, -18416, -18535, -18654, -18763, -18876, -18986, 
-        -19086, -19190, -19285, -19379, -19471, -19559, -19644, -19727, -19803, -19879, -19955, -20026, 
-        -20093, -20157, -20221, -20282, -20340, -20391, -20446, -20495, -20541, -20590, -20629, -20669, 
-        -20706, -20742, -20776, -20809, -20837, -20864, -20885, -20907, -20928, -20949, -20965, -20983, 
-        -20995, -21004, -21013, -21020, -21029, -21032, -21032, -21032, -21029, -21026, -21020, -21013, 
-        -21004, -20995, -20983, -20968, -20956, -20940, -20922, -20904, -20885, -20861, -20837, -20809, 
-        -20785, -20757, -20727, -20696, -20666, -20635, -20599, -20562, -20526, -20486, -20446, -20404, 
-        -20364, -20321, -20279, -20233, -20184, -20138, -20090, -20041, -19995, -19940, -19888, -19833, 
-        -19779, -19724, -19666, -19608, -19550, -19492, -19431, -19367, -19303, -19242, -19178, -19114, 
-        -19047, -18980, -18913, -18846, -18775, -18708, -18635, -18565, -18489, -18416, -18346, -18272, 
-        -18196, -18117, -18041, -17961, -17885, -17806, -17727, -17647, -17565, -17483, -17403, -17318, 
-        -17233, -17150, -17065, -16977, -16894, -16806, -16717, -16629, -16541, -16449, -16361, -16269, 
-        -16178, -16086, -15995, -15903, -15812, -15717, -15620, -15528, -15431, -15333, -15239, -15141, 
-        -15046, -14946, -14848, -14748, -14650, -14550, -14452, -14351, -14248, -14147, -14046, -13943, 
-        -13839, -13732, -13626, -13525, -13421, -13315, -13211, -13104, -12998, -12891, -12781, -12674, 
-        -12565, -12458, -12348, -12235, -12126, -12013, -11906, -11796, -11680, -11568, -11458, -11345, 
-        -11229, -11116, -11000, -10885, -10772, -10656, -10540, -10421, -10305, -10186, -10070, -9955, 
-        -9836, -9717, -9598, -9479, -9360, -9238, -9116, -8997, -8875, -8756, -8634, -8509, 
-        -8387, -8265, -8140, -8015, -7890, -7765, -7640, -7506, -7369, -7235, -7098, -6960, 
-        -6820, -6680, -6540, -6402, -6265, -6125, -5985, -5845, -5701, -5561, -5418, -5274, 
-        -5134, -4991, -4847, -4704, -4561, -4418, -4274, -4131, -3988, -3844, -3701, -3558, 
-        -3411, -3268, -3125, -2978, -2835, -2692, -2542, -2393, -2247, -2103, -1957, -1811, 
-        -1661, -1515, -1369, -1222, -1076, -929, -783, -634, -484, -338, -192, -39 
-    };
-
-    // AKWF_saw_0007 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0007[600] PROGMEM = {
-        552, 613, 658, 713, 786, 858, 939, 1021, 1108, 1192, 1276, 1360, 
-        1445, 1527, 1608, 1689, 1774, 1852, 1935, 2016, 2095, 2177, 2257, 2338, 
-        2417, 2499, 2579, 2660, 2739, 2821, 2899, 2980, 3060, 3142, 3220, 3299, 
-        3382, 3461, 3539, 3618, 3699, 3777, 3857, 3934, 4014, 4092, 4171, 4248, 
-        4327, 4405, 4483, 4559, 4637, 4714, 4790, 4867, 4943, 5021, 5096, 5173, 
-        5246, 5324, 5399, 5474, 5548, 5624, 5698, 5773, 5846, 5921, 5995, 6068, 
-        6142, 6215, 6289, 6361, 6436, 6508, 6580, 6652, 6725, 6797, 6870, 6940, 
-        7014, 7086, 7156, 7227, 7299, 7371, 7442, 7512, 7583, 7655, 7725, 7796, 
-        7865, 7937, 8008, 8077, 8147, 8218, 8287, 8358, 8427, 8497, 8566, 8637, 
-        8706, 8777, 8844, 8914, 8984, 9053, 9122, 9190, 9262, 9330, 9399, 9468, 
-        9537, 9606, 9675, 9743, 9812, 9881, 9950, 10018, 10087, 10156, 10224, 10293, 
-        10360, 10431, 10499, 10566, 10635, 10705, 10772, 10841, 10909, 10978, 11046, 11115, 
-        11181, 11252, 11318, 11387, 11456, 11524, 11591, 11659, 11729, 11796, 11865, 11932, 
-        12001, 12069, 12137, 12204, 12274, 12341, 12410, 12478, 12544, 12615, 12682, 12750, 
-        12818, 12887, 12954, 13022, 13090, 13159, 13226, 13294, 13362, 13431, 13497, 13566, 
-        13634, 13703, 13770, 13838, 13906, 13975, 14043, 14109, 14179, 14245, 14313, 14382, 
-        14451, 14519, 14587, 14653, 14723, 14791, 14859, 14926, 14994, 15064, 15131, 15198, 
-        15266, 15337, 15404, 15472, 15539, 15610, 15678, 15747, 15814, 15888, 15963, 15963, 
-        16100, 16159, 16219, 16284, 16348, 16416, 16482, 16548, 16616, 16683, 16750, 16816, 
-        16882, 16948, 17014, 17081, 17147, 17213, 17279, 17344, 17410, 17476, 17542, 17607, 
-        17673, 17738, 17804, 17870, 17935, 18000, 18066, 18130, 18195, 18261, 18326, 18391, 
-        18455, 18520, 18585, 18650, 18714, 18779, 18844, 18908, 18973, 19036, 19101, 19166, 
-        19229, 19294, 19357, 19421, 19486, 19549, 19613, 19676, 19741, 19804, 19867, 19930, 
-        19994, 20058, 20121, 20185, 20248, 20311, 20374, 20438, 20501, 20564, 20627, 20691, 
-        20752, 20816, 20879, 20942, 21005, 21067, 21130, 21193, 21255, -32767, -4195, -22954, 
-        -22140, -21307, -20757, -20474, -20336, -20274, -20249, -20238, -20230, -20217, -20199, -20176, 
-        -20146, -20111, -20073, -20032, -19989, -19945, -19898, -19852, -19807, -19761, -19716, -19671, 
-        -19627, -19583, -19541, -19496, -19454, -19413, -19370, -19327, -19286, -19245, -19202, -19161, 
-        -19117, -19074, -19032, -18989, -18945, -18901, -18855, -18810, -18764, -18717, -18670, -18623, 
-        -18575, -18525, -18475, -18425, -18373, -18320, -18267, -18214, -18161, -18105, -18050, -17994, 
-        -17938, -17879, -17822, -17763, -17703, -17642, -17582, -17520, -17458, -17395, -17332, -17269, 
-        -17204, -17139, -17075, -17008, -16941, -16875, -16807, -16739, -16672, -16547, -16554, -16464, 
-        -16382, -16310, -16236, -16166, -16091, -16019, -15945, -15873, -15797, -15723, -15648, -15573, 
-        -15497, -15422, -15345, -15269, -15192, -15114, -15038, -14962, -14884, -14806, -14728, -14650, 
-        -14572, -14492, -14416, -14338, -14257, -14179, -14101, -14022, -13941, -13863, -13784, -13704, 
-        -13625, -13545, -13466, -13387, -13306, -13226, -13146, -13068, -12987, -12907, -12826, -12747, 
-        -12666, -12587, -12506, -12425, -12347, -12265, -12185, -12106, -12026, -11946, -11866, -11785, 
-        -11706, -11625, -11546, -11466, -11387, -11306, -11227, -11149, -11066, -10988, -10909, -10830, 
-        -10749, -10671, -10591, -10512, -10433, -10353, -10274, -10196, -10116, -10037, -9959, -9881, 
-        -9800, -9722, -9644, -9565, -9487, -9409, -9330, -9252, -9174, -9096, -9018, -8940, 
-        -8862, -8783, -8706, -8628, -8552, -8472, -8396, -8319, -8240, -8164, -8086, -8009, 
-        -7930, -7855, -7777, -7700, -7622, -7546, -7470, -7393, -7315, -7239, -7162, -7086, 
-        -7008, -6933, -6855, -6778, -6703, -6625, -6549, -6473, -6398, -6320, -6245, -6168, 
-        -6092, -6014, -5939, -5862, -5787, -5709, -5634, -5559, -5481, -5406, -5330, -5255, 
-        -5177, -5102, -5026, -4951, -4874, -4798, -4723, -4646, -4570, -4495, -4418, -4343, 
-        -4265, -4190, -4114, -4037, -3962, -3886, -3809, -3733, -3660, -3582, -3505, -3430, 
-        -3354, -3277, -3201, -3124, -3049, -2971, -2896, -2820, -2743, -2665, -2590, -2515, 
-        -2436, -2361, -2285, -2208, -2129, -2054, -1977, -1901, -1821, -1746, -1668, -1593, 
-        -1513, -1436, -1358, -1282, -1205, -1124, -1048, -970, -892, -811, -733, -655, 
-        -576, -494, -416, -333, -254, -166, -83, 8, 110, -333, -254, 591 
-    };
-
-    // AKWF_saw_0008 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0008[600] PROGMEM = {
-        100, 294, 489, 681, 874, 1066, 1257, 1447, 1637, 1826, 2013, 2200, 
-        2387, 2573, 2758, 2941, 3124, 3307, 3489, 3669, 3849, 4029, 4207, 4386, 
-        4562, 4738, 4914, 5088, 5263, 5436, 5608, 5780, 5952, 6121, 6292, 6461, 
-        6628, 6796, 6962, 7129, 7293, 7458, 7622, 7785, 7947, 8109, 8270, 8431, 
-        8591, 8749, 8909, 9067, 9223, 9380, 9535, 9690, 9845, 9999, 10151, 10303, 
-        10455, 10606, 10757, 10907, 11055, 11204, 11353, 11499, 11646, 11791, 11937, 12082, 
-        12226, 12370, 12512, 12655, 12796, 12937, 13078, 13218, 13356, 13496, 13633, 13771, 
-        13908, 14044, 14179, 14315, 14449, 14583, 14717, 14850, 14983, 15114, 15245, 15375, 
-        15505, 15635, 15764, 15892, 16020, 16148, 16274, 16401, 16525, 16651, 16775, 16900, 
-        17023, 17146, 17269, 17390, 17512, 17633, 17754, 17874, 17992, 18111, 18230, 18347, 
-        18465, 18582, 18698, 18814, 18929, 19043, 19158, 19272, 19386, 19499, 19611, 19722, 
-        19834, 19945, 20055, 20165, 20276, 20385, 20492, 20601, 20709, 20816, 20923, 21029, 
-        21135, 21240, 21345, 21449, 21554, 21658, 21761, 21863, 21965, 22067, 22169, 22270, 
-        22370, 22471, 22570, 22669, 22768, 22866, 22964, 23062, 23160, 23256, 23353, 23449, 
-        23544, 23639, 23734, 23828, 23921, 24015, 24108, 24201, 24293, 24385, 24477, 24568, 
-        24659, 24748, 24839, 24929, 25018, 25106, 25194, 25282, 25370, 25458, 25545, 25632, 
-        25718, 25803, 25889, 25974, 26059, 26143, 26227, 26311, 26393, 26477, 26559, 26642, 
-        26723, 26805, 26886, 26967, 27047, 27127, 27208, 27286, 27366, 27444, 27523, 27600, 
-        27679, 27755, 27834, 27911, 27986, 28063, 28138, 28214, 28289, 28363, 28439, 28513, 
-        28587, 28659, 28734, 28806, 28879, 28950, 29023, 29094, 29165, 29237, 29308, 29378, 
-        29448, 29517, 29587, 29657, 29726, 29794, 29863, 29931, 29998, 30067, 30134, 30201, 
-        30266, 30333, 30399, 30465, 30530, 30596, 30660, 30726, 30790, 30855, 30917, 30982, 
-        31045, 31108, 31170, 31233, 31295, 31358, 31419, 31481, 31542, 31602, 31664, 31724, 
-        31784, 31844, 31903, 31963, 32021, 32080, 32139, 32197, 32255, 32313, 32371, 32428, 
-        32485, 32543, 32598, 32656, 32712, 32767, 32640, 31226, 26259, 16815, 5238, -5473, 
-        -14016, -20267, -24595, -27483, -29361, -30561, -31316, -31780, -32058, -32216, -32295, -32327, 
-        -32326, -32305, -32270, -32228, -32179, -32126, -32072, -32016, -31958, -31900, -31841, -31781, 
-        -31721, -31661, -31601, -31539, -31479, -31418, -31356, -31293, -31232, -31169, -31106, -31043, 
-        -30980, -30916, -30852, -30789, -30723, -30659, -30595, -30529, -30463, -30398, -30332, -30265, 
-        -30199, -30132, -30065, -29997, -29930, -29861, -29793, -29724, -29654, -29586, -29516, -29446, 
-        -29376, -29306, -29235, -29164, -29093, -29021, -28949, -28876, -28803, -28731, -28658, -28584, 
-        -28510, -28436, -28362, -28286, -28212, -28137, -28060, -27985, -27908, -27831, -27754, -27677, 
-        -27599, -27521, -27442, -27364, -27285, -27205, -27125, -27046, -26965, -26883, -26802, -26721, 
-        -26639, -26557, -26474, -26392, -26308, -26224, -26140, -26056, -25971, -25887, -25801, -25715, 
-        -25629, -25542, -25455, -25369, -25281, -25193, -25105, -25015, -24926, -24836, -24747, -24656, 
-        -24565, -24475, -24382, -24292, -24199, -24106, -24013, -23920, -23826, -23731, -23636, -23541, 
-        -23446, -23350, -23253, -23157, -23059, -22963, -22863, -22766, -22666, -22567, -22468, -22367, 
-        -22267, -22166, -22064, -21962, -21860, -21758, -21655, -21551, -21447, -21342, -21237, -21132, 
-        -21026, -20920, -20814, -20706, -20598, -20489, -20382, -20273, -20162, -20052, -19942, -19831, 
-        -19720, -19608, -19496, -19383, -19270, -19155, -19040, -18926, -18811, -18695, -18578, -18462, 
-        -18345, -18227, -18108, -17990, -17870, -17751, -17629, -17509, -17387, -17266, -17143, -17020, 
-        -16897, -16773, -16648, -16523, -16397, -16271, -16144, -16017, -15890, -15761, -15631, -15503, 
-        -15373, -15241, -15110, -14979, -14847, -14713, -14580, -14446, -14312, -14176, -14041, -13904, 
-        -13767, -13630, -13492, -13353, -13214, -13074, -12934, -12793, -12651, -12508, -12366, -12222, 
-        -12078, -11934, -11788, -11642, -11495, -11348, -11200, -11052, -10903, -10753, -10602, -10451, 
-        -10299, -10147, -9994, -9841, -9686, -9530, -9375, -9219, -9062, -8904, -8745, -8587, 
-        -8427, -8266, -8105, -7943, -7781, -7618, -7454, -7289, -7124, -6958, -6792, -6624, 
-        -6456, -6287, -6117, -5946, -5776, -5604, -5432, -5259, -5084, -4910, -4734, -4557, 
-        -4380, -4203, -4024, -3845, -3665, -3484, -3303, -3120, -2937, -2752, -2568, -2382, 
-        -2196, -2009, -1820, -1632, -1443, -1251, -1060, -869, -676, -482, -287, -93 
-    };
-
-    // AKWF_saw_0009 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0009[600] PROGMEM = {
-        110, 230, 351, 471, 591, 711, 833, 953, 1075, 1195, 1316, 1437, 
-        1558, 1678, 1800, 1921, 2043, 2164, 2286, 2407, 2529, 2650, 2772, 2894, 
-        3016, 3138, 3259, 3382, 3503, 3626, 3748, 3870, 3992, 4115, 4237, 4360, 
-        4482, 4604, 4727, 4850, 4973, 5095, 5218, 5341, 5463, 5586, 5709, 5833, 
-        5956, 6078, 6201, 6325, 6448, 6571, 6694, 6817, 6941, 7064, 7188, 7311, 
-        7435, 7559, 7681, 7805, 7929, 8052, 8176, 8300, 8424, 8548, 8670, 8794, 
-        8918, 9042, 9166, 9290, 9414, 9538, 9662, 9786, 9910, 10034, 10158, 10282, 
-        10407, 10531, 10655, 10779, 10903, 11027, 11152, 11276, 11400, 11525, 11649, 11773, 
-        11897, 12022, 12146, 12271, 12395, 12519, 12644, 12768, 12894, 13018, 13143, 13267, 
-        13392, 13516, 13641, 13765, 13890, 14014, 14139, 14263, 14389, 14514, 14638, 14763, 
-        14887, 15012, 15137, 15261, 15386, 15511, 15635, 15761, 15886, 16010, 16135, 16260, 
-        16385, 16509, 16634, 16760, 16885, 17009, 17134, 17259, 17384, 17508, 17634, 17759, 
-        17884, 18009, 18133, 18258, 18383, 18509, 18634, 18759, 18883, 19008, 19133, 19258, 
-        19384, 19509, 19633, 19758, 19883, 20008, 20134, 20259, 20384, 20509, 20633, 20758, 
-        20883, 21009, 21134, 21259, 21384, 21509, 21635, 21759, 21884, 22009, 22134, 22259, 
-        22384, 22510, 22635, 22760, 22885, 23010, 23136, 23260, 23385, 23510, 23635, 23760, 
-        23885, 24011, 24136, 24261, 24386, 24511, 24637, 24762, 24886, 25011, 25136, 25261, 
-        25386, 25512, 25637, 25762, 25887, 26012, 26138, 26263, 26388, 26513, 26638, 26762, 
-        26887, 27013, 27138, 27263, 27388, 27513, 27639, 27764, 27889, 28014, 28139, 28264, 
-        28390, 28515, 28640, 28764, 28889, 29014, 29140, 29265, 29390, 29515, 29640, 29765, 
-        29891, 30016, 30141, 30265, 30390, 30515, 30641, 30766, 30891, 31016, 31141, 31267, 
-        31392, 31517, 31642, 31766, 31891, 32016, 32142, 32267, 32392, 32517, 32642, 32767, 
-        30520, 27493, 27123, 25287, 21415, 18188, 15124, 12074, 9069, 6200, 3538, 1120, 
-        -1050, -2989, -4721, -6272, -7665, -8920, -10050, -11070, -11992, -12825, -13577, -14260, 
-        -14877, -15435, -15944, -16404, -16822, -17203, -17550, -17865, -18154, -18418, -18658, -18878, 
-        -19081, -19266, -19435, -19591, -19736, -19868, -19990, -20103, -20208, -20304, -20394, -20477, 
-        -20553, -20626, -20692, -20753, -20811, -20864, -20913, -20960, -21002, -21042, -21079, -21113, 
-        -21145, -21173, -21200, -21226, -21248, -21269, -21287, -21304, -21320, -21334, -21345, -21356, 
-        -21365, -21372, -21378, -21382, -21385, -21387, -21387, -21387, -21384, -21381, -21376, -21369, 
-        -21363, -21355, -21345, -21335, -21323, -21309, -21296, -21281, -21265, -21248, -21230, -21210, 
-        -21189, -21168, -21146, -21123, -21098, -21072, -21047, -21018, -20990, -20961, -20931, -20899, 
-        -20867, -20834, -20800, -20766, -20730, -20693, -20655, -20617, -20578, -20537, -20497, -20455, 
-        -20412, -20368, -20324, -20278, -20232, -20185, -20137, -20089, -20040, -19990, -19938, -19887, 
-        -19834, -19781, -19727, -19673, -19617, -19562, -19504, -19446, -19389, -19330, -19270, -19209, 
-        -19148, -19085, -19023, -18960, -18896, -18831, -18766, -18700, -18634, -18568, -18499, -18431, 
-        -18361, -18293, -18221, -18151, -18079, -18008, -17934, -17862, -17788, -17713, -17638, -17562, 
-        -17486, -17410, -17333, -17256, -17177, -17098, -17019, -16939, -16858, -16777, -16696, -16614, 
-        -16531, -16449, -16366, -16281, -16198, -16112, -16027, -15941, -15855, -15768, -15681, -15594, 
-        -15505, -15417, -15327, -15239, -15148, -15059, -14968, -14877, -14785, -14694, -14601, -14509, 
-        -14416, -14322, -14229, -14134, -14040, -13944, -13850, -13754, -13657, -13561, -13464, -13367, 
-        -13270, -13172, -13074, -12976, -12876, -12777, -12678, -12578, -12478, -12377, -12276, -12176, 
-        -12074, -11973, -11871, -11768, -11666, -11563, -11460, -11356, -11253, -11148, -11044, -10940, 
-        -10835, -10730, -10624, -10519, -10413, -10308, -10201, -10094, -9987, -9881, -9773, -9666, 
-        -9558, -9450, -9342, -9233, -9125, -9015, -8906, -8797, -8688, -8577, -8467, -8357, 
-        -8247, -8137, -8025, -7914, -7803, -7691, -7579, -7468, -7356, -7244, -7131, -7020, 
-        -6907, -6794, -6681, -6567, -6454, -6340, -6227, -6113, -5999, -5884, -5770, -5656, 
-        -5541, -5427, -5311, -5196, -5081, -4965, -4850, -4734, -4618, -4503, -4386, -4271, 
-        -4154, -4037, -3921, -3804, -3686, -3570, -3453, -3335, -3218, -3101, -2983, -2865, 
-        -2747, -2630, -2512, -2393, -2275, -2157, -2038, -1919, -1801, -1682, -1563, -1444, 
-        -1325, -1206, -1087, -968, -848, -729, -608, -489, -369, -249, -130, -9 
-    };
-
-    // AKWF_saw_0010 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0010[600] PROGMEM = {
-        64, 151, 238, 323, 409, 493, 579, 663, 747, 830, 913, 996, 
-        1079, 1162, 1244, 1325, 1405, 1486, 1566, 1646, 1727, 1805, 1884, 1962, 
-        2041, 2118, 2196, 2272, 2349, 2425, 2501, 2576, 2652, 2726, 2801, 2873, 
-        2947, 3020, 3094, 3166, 3238, 3310, 3381, 3452, 3523, 3593, 3664, 3733, 
-        3801, 3870, 3939, 4007, 4074, 4142, 4209, 4276, 4342, 4409, 4474, 4538, 
-        4604, 4668, 4732, 4797, 4860, 4924, 4987, 5048, 5110, 5171, 5233, 5293, 
-        5354, 5415, 5474, 5534, 5594, 5653, 5712, 5771, 5828, 5886, 5943, 6001, 
-        6058, 6114, 6171, 6225, 6282, 6336, 6393, 6446, 6501, 6554, 6608, 6661, 
-        6715, 6767, 6819, 6871, 6924, 6976, 7027, 7077, 7128, 7178, 7227, 7277, 
-        7326, 7376, 7424, 7472, 7520, 7568, 7617, 7663, 7710, 7757, 7803, 7848, 
-        7894, 7939, 7984, 8029, 8073, 8117, 8161, 8205, 8248, 8291, 8334, 8375, 
-        8417, 8459, 8500, 8541, 8581, 8623, 8663, 8703, 8743, 8782, 8822, 8859, 
-        8898, 8937, 8974, 9012, 9049, 9087, 9123, 9160, 9196, 9233, 9269, 9304, 
-        9340, 9373, 9409, 9443, 9477, 9511, 9543, 9578, 9610, 9643, 9675, 9707, 
-        9740, 9770, 9802, 9835, 9865, 9896, 9926, 9956, 9986, 10017, 10045, 10074, 
-        10102, 10132, 10160, 10188, 10216, 10243, 10271, 10297, 10324, 10350, 10376, 10403, 
-        10429, 10454, 10478, 10503, 10529, 10553, 10578, 10601, 10624, 10647, 10671, 10693, 
-        10716, 10739, 10760, 10783, 10804, 10826, 10847, 10867, 10889, 10909, 10929, 10949, 
-        10969, 10989, 11006, 11027, 11044, 11064, 11081, 11100, 11117, 11135, 11152, 11168, 
-        11186, 11203, 11219, 11235, 11250, 11266, 11282, 11298, 11313, 11328, 11341, 11356, 
-        11370, 11384, 11398, 11410, 11424, 11437, 11449, 11463, 11475, 11488, 11499, 11511, 
-        11523, 11534, 11544, 11555, 11566, 11576, 11586, 11596, 11606, 11616, 11624, 11634, 
-        11642, 11650, 11659, 11667, 11675, 11682, 11690, 11697, 11705, 11711, 11718, 11725, 
-        11730, 11736, 11742, 11748, 11754, 11758, 11764, 11768, 11772, 11777, 11780, 11784, 
-        11786, 11790, 11793, 11797, 11800, 11802, 11804, 11805, 11808, 11809, 11812, 11813, 
-        11813, 11814, 11814, 11816, 11817, 11817, 11817, 11816, 11816, 11814, 11814, 11813, 
-        11812, 11809, 11808, 11806, 11805, 11804, 11801, 11798, 11794, 11792, 11789, 11786, 
-        11784, 11778, 11774, 11770, 11766, 11764, 11758, 11754, 11748, 11742, 11738, 11733, 
-        11729, 11721, 11715, 11707, 11702, 11697, 11690, 11685, 11674, 11667, 11658, 11651, 
-        11645, 11637, 11630, 11616, 11608, 11599, 11594, 11586, 11574, 11563, 11548, 11542, 
-        11530, 11524, 11512, 11497, 11481, 11471, 11455, 11501, 10000, -33, -20221, -31625, 
-        -32767, -31935, -31822, -31633, -31412, -31210, -31008, -30809, -30611, -30413, -30208, -30008, 
-        -29806, -29613, -29416, -29221, -29024, -28827, -28633, -28437, -28247, -28053, -27861, -27668, 
-        -27475, -27287, -27097, -26910, -26721, -26532, -26344, -26156, -25973, -25786, -25603, -25417, 
-        -25233, -25050, -24867, -24688, -24506, -24326, -24143, -23964, -23785, -23607, -23431, -23252, 
-        -23077, -22899, -22724, -22550, -22376, -22203, -22029, -21857, -21684, -21513, -21343, -21173, 
-        -21005, -20834, -20666, -20498, -20332, -20166, -19999, -19834, -19668, -19504, -19341, -19177, 
-        -19016, -18852, -18692, -18530, -18371, -18212, -18052, -17894, -17735, -17577, -17420, -17266, 
-        -17111, -16955, -16800, -16645, -16493, -16339, -16188, -16036, -15885, -15734, -15583, -15434, 
-        -15286, -15137, -14989, -14840, -14695, -14547, -14403, -14257, -14114, -13968, -13825, -13682, 
-        -13539, -13398, -13255, -13115, -12974, -12834, -12695, -12556, -12418, -12279, -12142, -12004, 
-        -11868, -11733, -11598, -11464, -11328, -11194, -11061, -10929, -10796, -10664, -10533, -10402, 
-        -10272, -10141, -10013, -9884, -9756, -9627, -9499, -9373, -9246, -9120, -8996, -8870, 
-        -8746, -8621, -8498, -8375, -8253, -8132, -8009, -7888, -7768, -7647, -7528, -7409, 
-        -7290, -7171, -7055, -6937, -6821, -6704, -6588, -6473, -6358, -6244, -6130, -6017, 
-        -5903, -5791, -5678, -5567, -5456, -5345, -5235, -5126, -5015, -4908, -4798, -4691, 
-        -4583, -4476, -4369, -4263, -4157, -4053, -3947, -3843, -3738, -3635, -3532, -3429, 
-        -3328, -3226, -3124, -3023, -2922, -2823, -2723, -2623, -2525, -2426, -2329, -2231, 
-        -2133, -2037, -1941, -1844, -1748, -1654, -1559, -1466, -1372, -1277, -1185, -1091, 
-        -1000, -908, -817, -726, -635, -545, -456, -366, -278, -188, 64, 151 
-    };
-
-    // AKWF_saw_0011 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0011[600] PROGMEM = {
-        9842, 17513, 15946, 18274, 18173, 20435, 21668, 24140, 26160, 28409, 30289, 31698, 
-        32603, 32767, 32351, 31306, 29897, 28145, 26285, 24497, 22933, 21704, 20873, 20452, 
-        20400, 20638, 21059, 21546, 21980, 22263, 22323, 22122, 21656, 20957, 20081, 19104, 
-        18108, 17171, 16361, 15723, 15283, 15040, 14971, 15034, 15177, 15345, 15482, 15544, 
-        15499, 15333, 15049, 14661, 14199, 13701, 13204, 12746, 12354, 12051, 11842, 11729, 
-        11696, 11723, 11784, 11851, 11900, 11912, 11871, 11773, 11619, 11419, 11187, 10941, 
-        10699, 10478, 10289, 10144, 10044, 9987, 9964, 9969, 9986, 10004, 10009, 9997, 
-        9956, 9889, 9795, 9679, 9550, 9415, 9283, 9162, 9057, 8973, 8908, 8865, 
-        8836, 8818, 8805, 8791, 8769, 8738, 8693, 8635, 8564, 8484, 8399, 8311, 
-        8224, 8143, 8070, 8007, 7953, 7909, 7871, 7837, 7804, 7771, 7735, 7692, 
-        7643, 7588, 7527, 7462, 7395, 7327, 7259, 7195, 7134, 7079, 7027, 6979, 
-        6934, 6892, 6850, 6806, 6762, 6714, 6664, 6609, 6553, 6495, 6436, 6376, 
-        6318, 6260, 6204, 6152, 6101, 6051, 6003, 5956, 5909, 5861, 5813, 5763, 
-        5711, 5659, 5606, 5551, 5496, 5441, 5387, 5332, 5280, 5227, 5177, 5127, 
-        5078, 5028, 4979, 4930, 4880, 4830, 4779, 4727, 4676, 4622, 4570, 4518, 
-        4465, 4414, 4363, 4311, 4261, 4211, 4162, 4112, 4062, 4013, 3963, 3913, 
-        3862, 3811, 3761, 3710, 3659, 3607, 3557, 3506, 3456, 3406, 3356, 3307, 
-        3256, 3207, 3158, 3109, 3060, 3009, 2960, 2910, 2861, 2811, 2760, 2711, 
-        2661, 2612, 2562, 2512, 2463, 2414, 2366, 2317, 2268, 2218, 2169, 2121, 
-        2072, 2023, 1974, 1925, 1876, 1827, 1778, 1729, 1680, 1633, 1584, 1535, 
-        1486, 1439, 1390, 1342, 1294, 1246, 1197, 1149, 1100, 1052, 1004, 956, 
-        908, 860, 812, 765, 717, 669, 622, 573, 525, 477, 431, 383, 
-        336, 288, 241, 193, 146, 99, 51, 4, -42, -89, -136, -183, 
-        -230, -277, -324, -371, -418, -464, -511, -559, -606, -653, -699, -746, 
-        -792, -839, -885, -930, -978, -1023, -1069, -1116, -1162, -1208, -1254, -1300, 
-        -1347, -1393, -1439, -1484, -1530, -1577, -1623, -1669, -1715, -1760, -1806, -1852, 
-        -1898, -1943, -1989, -2035, -2080, -2124, -2170, -2215, -2261, -2306, -2352, -2397, 
-        -2442, -2487, -2532, -2577, -2622, -2667, -2712, -2757, -2802, -2847, -2892, -2937, 
-        -2982, -3027, -3070, -3116, -3160, -3205, -3249, -3294, -3338, -3382, -3426, -3471, 
-        -3516, -3560, -3604, -3648, -3692, -3736, -3780, -3825, -3869, -3913, -3956, -4000, 
-        -4044, -4088, -4131, -4176, -4218, -4262, -4306, -4350, -4394, -4437, -4480, -4524, 
-        -4567, -4611, -4653, -4697, -4740, -4784, -4828, -4870, -4913, -4956, -4999, -5042, 
-        -5085, -5128, -5171, -5214, -5257, -5300, -5342, -5384, -5428, -5471, -5514, -5555, 
-        -5598, -5641, -5684, -5725, -5768, -5810, -5853, -5894, -5938, -5980, -6023, -6064, 
-        -6106, -6149, -6190, -6232, -6274, -6316, -6358, -6400, -6442, -6484, -6526, -6568, 
-        -6609, -6651, -6693, -6734, -6776, -6817, -6858, -6900, -6942, -6982, -7024, -7066, 
-        -7106, -7148, -7189, -7230, -7272, -7313, -7353, -7395, -7436, -7476, -7517, -7558, 
-        -7600, -7640, -7680, -7722, -7763, -7803, -7844, -7884, -7925, -7966, -8006, -8047, 
-        -8088, -8127, -8168, -8208, -8249, -8290, -8329, -8370, -8410, -8450, -8491, -8530, 
-        -8571, -8610, -8650, -8690, -8730, -8771, -8810, -8850, -8889, -8929, -8968, -9009, 
-        -9048, -9088, -9128, -9167, -9207, -9246, -9286, -9325, -9364, -9404, -9443, -9482, 
-        -9522, -9562, -9600, -9640, -9679, -9718, -9757, -9796, -9835, -9874, -9913, -9952, 
-        -9990, -10030, -10068, -10107, -10146, -10185, -10223, -10262, -10300, -10339, -10377, -10416, 
-        -10455, -10494, -10532, -10569, -10608, -10646, -10685, -10723, -10761, -10799, -10838, -10875, 
-        -10914, -10952, -10991, -11028, -11066, -11104, -11141, -11180, -11217, -11256, -11293, -11332, 
-        -11369, -11406, -11444, -11481, -11520, -11557, -11594, -11632, -11669, -11707, -11744, -11782, 
-        -11819, -11856, -11893, -11930, -11969, -12005, -12042, -12080, -12116, -12153, -12191, -12227, 
-        -12265, -12302, -12338, -12376, -12412, -12450, -12486, -12523, -12560, -12596, -12633, -12669, 
-        -12706, -12742, -12779, -12816, -12853, -12889, -12925, -12962, -12980, -13043, -13053, -13135, 
-        -13122, -13185, -13236, -13174, -13436, -13082, -13720, -12892, -14107, -12532, -14973, -8810 
-    };
-
-    // AKWF_saw_0012 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0012[600] PROGMEM = {
-        63, 153, 245, 336, 427, 518, 610, 704, 796, 890, 983, 1078, 
-        1172, 1267, 1360, 1455, 1550, 1642, 1735, 1829, 1921, 2012, 2103, 2194, 
-        2282, 2371, 2460, 2547, 2633, 2719, 2803, 2889, 2972, 3054, 3136, 3218, 
-        3299, 3380, 3460, 3538, 3618, 3696, 3774, 3851, 3927, 4003, 4080, 4153, 
-        4229, 4303, 4375, 4449, 4521, 4594, 4665, 4736, 4808, 4878, 4948, 5018, 
-        5087, 5157, 5225, 5293, 5362, 5429, 5495, 5563, 5629, 5695, 5761, 5827, 
-        5892, 5957, 6021, 6086, 6150, 6213, 6276, 6340, 6403, 6464, 6527, 6588, 
-        6650, 6712, 6772, 6833, 6894, 6954, 7014, 7074, 7133, 7193, 7251, 7310, 
-        7368, 7426, 7484, 7541, 7598, 7656, 7712, 7769, 7826, 7882, 7939, 7994, 
-        8048, 8104, 8159, 8214, 8268, 8322, 8377, 8431, 8484, 8537, 8590, 8643, 
-        8696, 8748, 8801, 8852, 8904, 8956, 9007, 9058, 9110, 9160, 9210, 9260, 
-        9310, 9359, 9409, 9459, 9508, 9558, 9605, 9653, 9702, 9750, 9799, 9847, 
-        9894, 9940, 9988, 10035, 10082, 10127, 10175, 10221, 10265, 10312, 10358, 10403, 
-        10449, 10493, 10538, 10582, 10627, 10670, 10715, 10759, 10802, 10845, 10889, 10932, 
-        10975, 11018, 11060, 11103, 11144, 11186, 11228, 11269, 11310, 11353, 11394, 11434, 
-        11476, 11516, 11555, 11595, 11636, 11676, 11715, 11755, 11794, 11834, 11872, 11911, 
-        11950, 11989, 12027, 12064, 12103, 12141, 12179, 12215, 12253, 12291, 12327, 12365, 
-        12401, 12439, 12474, 12511, 12547, 12582, 12619, 12654, 12690, 12725, 12759, 12796, 
-        12830, 12865, 12899, 12933, 12968, 13002, 13036, 13070, 13104, 13136, 13171, 13204, 
-        13238, 13270, 13304, 13335, 13369, 13401, 13433, 13466, 13496, 13530, 13561, 13592, 
-        13624, 13656, 13687, 13716, 13750, 13779, 13810, 13840, 13871, 13901, 13931, 13962, 
-        13991, 14021, 14050, 14080, 14110, 14139, 14168, 14196, 14226, 14254, 14283, 14313, 
-        14341, 14368, 14396, 14424, 14453, 14480, 14507, 14536, 14562, 14591, 14618, 14645, 
-        14670, 14699, 14725, 14753, 14778, 14805, 14831, 14859, 14884, 14910, 14936, 14961, 
-        14987, 15012, 15037, 15064, 15088, 15114, 15138, 15163, 15188, 15212, 15237, 15261, 
-        15286, 15310, 15334, 15359, 15382, 15407, 15430, 15453, 15357, 14445, 11407, 5998, 
-        -104, -5368, -9535, -12839, -15589, -18051, -20402, -22722, -25003, -27175, -29131, -30752, 
-        -31938, -32619, -32767, -32406, -31599, -30455, -29097, -27666, -26291, -25083, -24119, -23443, 
-        -23058, -22934, -23010, -23210, -23445, -23635, -23711, -23624, -23349, -22887, -22267, -21527, 
-        -20725, -19920, -19169, -18517, -17996, -17622, -17389, -17283, -17270, -17311, -17368, -17401, 
-        -17379, -17278, -17095, -16828, -16493, -16109, -15706, -15309, -14946, -14635, -14391, -14220, 
-        -14117, -14071, -14069, -14090, -14114, -14126, -14110, -14056, -13962, -13829, -13666, -13484, 
-        -13292, -13108, -12939, -12798, -12688, -12611, -12566, -12546, -12544, -12551, -12556, -12554, 
-        -12537, -12500, -12445, -12370, -12282, -12185, -12083, -11985, -11896, -11821, -11758, -11711, 
-        -11679, -11657, -11641, -11630, -11616, -11598, -11570, -11534, -11487, -11432, -11371, -11306, 
-        -11239, -11174, -11112, -11057, -11008, -10967, -10931, -10900, -10873, -10843, -10815, -10783, 
-        -10746, -10705, -10659, -10609, -10555, -10501, -10445, -10390, -10337, -10287, -10240, -10196, 
-        -10154, -10114, -10075, -10036, -9996, -9955, -9911, -9865, -9815, -9766, -9713, -9660, 
-        -9608, -9554, -9502, -9450, -9401, -9352, -9306, -9259, -9213, -9165, -9119, -9070, 
-        -9021, -8969, -8918, -8865, -8811, -8756, -8702, -8647, -8593, -8540, -8485, -8433, 
-        -8380, -8328, -8275, -8223, -8170, -8116, -8062, -8005, -7949, -7893, -7836, -7778, 
-        -7721, -7663, -7606, -7548, -7490, -7434, -7376, -7319, -7260, -7203, -7143, -7085, 
-        -7026, -6966, -6906, -6845, -6784, -6723, -6661, -6599, -6537, -6476, -6414, -6351, 
-        -6288, -6226, -6163, -6099, -6036, -5973, -5908, -5843, -5778, -5713, -5648, -5581, 
-        -5516, -5449, -5381, -5315, -5248, -5181, -5112, -5045, -4977, -4908, -4840, -4771, 
-        -4701, -4631, -4561, -4491, -4419, -4349, -4277, -4205, -4133, -4062, -3989, -3916, 
-        -3843, -3770, -3696, -3622, -3548, -3473, -3397, -3322, -3247, -3170, -3094, -3018, 
-        -2940, -2863, -2785, -2706, -2629, -2549, -2470, -2392, -2312, -2231, -2151, -2070, 
-        -1991, -1909, -1827, -1744, -1661, -1578, -1496, -1412, -1328, -1244, -1159, -1074, 
-        -989, -903, -817, -731, -643, -557, -469, -381, -294, -204, -115, -25 
-    };
-
-    // AKWF_saw_0013 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0013[600] PROGMEM = {
-        21681, 28195, 22019, 26774, 25602, 28531, 28165, 29799, 30015, 30832, 31303, 31672, 
-        32113, 32283, 32530, 32597, 32767, 32749, 32690, 32587, 32436, 32243, 32008, 31741, 
-        31440, 31111, 30755, 30380, 29983, 29570, 29141, 28700, 28250, 27794, 27330, 26863, 
-        26393, 25924, 25455, 24987, 24523, 24064, 23610, 23162, 22720, 22286, 21862, 21444, 
-        21037, 20640, 20252, 19874, 19507, 19151, 18805, 18469, 18145, 17831, 17527, 17234, 
-        16951, 16679, 16417, 16162, 15920, 15687, 15461, 15245, 15038, 14839, 14649, 14465, 
-        14289, 14119, 13958, 13804, 13654, 13511, 13373, 13242, 13116, 12995, 12877, 12765, 
-        12656, 12553, 12453, 12355, 12261, 12170, 12082, 11997, 11916, 11834, 11756, 11680, 
-        11606, 11533, 11462, 11394, 11325, 11259, 11192, 11128, 11062, 10998, 10937, 10875, 
-        10814, 10753, 10691, 10632, 10571, 10513, 10451, 10393, 10332, 10274, 10214, 10155, 
-        10097, 10037, 9977, 9919, 9858, 9798, 9739, 9679, 9618, 9559, 9497, 9436, 
-        9375, 9314, 9253, 9191, 9130, 9068, 9004, 8942, 8879, 8817, 8754, 8690, 
-        8626, 8562, 8498, 8434, 8370, 8305, 8239, 8176, 8110, 8045, 7979, 7914, 
-        7847, 7783, 7716, 7651, 7584, 7517, 7450, 7383, 7316, 7249, 7182, 7114, 
-        7047, 6980, 6912, 6845, 6776, 6710, 6643, 6574, 6506, 6438, 6371, 6301, 
-        6234, 6166, 6097, 6029, 5961, 5892, 5825, 5757, 5687, 5619, 5551, 5482, 
-        5414, 5345, 5279, 5210, 5142, 5072, 5004, 4937, 4868, 4800, 4732, 4662, 
-        4595, 4527, 4458, 4390, 4323, 4255, 4186, 4119, 4051, 3983, 3916, 3848, 
-        3781, 3712, 3644, 3577, 3510, 3442, 3375, 3307, 3240, 3173, 3104, 3038, 
-        2971, 2904, 2837, 2770, 2704, 2636, 2569, 2502, 2435, 2370, 2303, 2236, 
-        2169, 2104, 2037, 1972, 1906, 1839, 1772, 1707, 1641, 1574, 1511, 1444, 
-        1378, 1313, 1246, 1182, 1116, 1051, 986, 920, 855, 789, 725, 660, 
-        596, 530, 465, 401, 335, 271, 206, 142, 78, 14, -49, -114, 
-        -178, -242, -308, -370, -434, -498, -562, -626, -689, -754, -817, -881, 
-        -943, -1007, -1071, -1134, -1196, -1259, -1323, -1387, -1449, -1512, -1574, -1637, 
-        -1701, -1764, -1826, -1889, -1951, -2015, -2078, -2139, -2201, -2264, -2326, -2389, 
-        -2451, -2514, -2575, -2638, -2699, -2761, -2822, -2885, -2947, -3008, -3070, -3131, 
-        -3193, -3254, -3317, -3378, -3439, -3501, -3563, -3624, -3683, -3746, -3805, -3868, 
-        -3928, -3990, -4050, -4111, -4170, -4233, -4293, -4354, -4413, -4476, -4535, -4597, 
-        -4656, -4716, -4777, -4836, -4898, -4956, -5017, -5078, -5136, -5197, -5257, -5316, 
-        -5376, -5436, -5495, -5555, -5615, -5674, -5734, -5793, -5852, -5913, -5971, -6030, 
-        -6090, -6148, -6208, -6266, -6326, -6384, -6443, -6503, -6560, -6619, -6678, -6737, 
-        -6797, -6854, -6913, -6971, -7030, -7088, -7146, -7204, -7264, -7320, -7379, -7437, 
-        -7495, -7553, -7610, -7668, -7726, -7784, -7841, -7899, -7957, -8014, -8072, -8130, 
-        -8187, -8244, -8302, -8359, -8417, -8474, -8530, -8589, -8644, -8702, -8759, -8815, 
-        -8874, -8929, -8986, -9044, -9100, -9156, -9212, -9269, -9326, -9383, -9439, -9495, 
-        -9550, -9607, -9663, -9719, -9777, -9832, -9887, -9944, -9999, -10056, -10110, -10168, 
-        -10223, -10278, -10334, -10389, -10446, -10501, -10555, -10611, -10667, -10722, -10777, -10832, 
-        -10888, -10943, -10998, -11054, -11107, -11163, -11218, -11272, -11328, -11381, -11437, -11491, 
-        -11545, -11600, -11654, -11709, -11763, -11818, -11872, -11926, -11981, -12035, -12089, -12144, 
-        -12197, -12252, -12306, -12361, -12413, -12467, -12521, -12575, -12629, -12682, -12736, -12789, 
-        -12844, -12896, -12950, -13004, -13056, -13110, -13164, -13218, -13270, -13322, -13376, -13428, 
-        -13482, -13535, -13588, -13639, -13695, -13747, -13799, -13852, -13904, -13956, -14009, -14061, 
-        -14115, -14167, -14220, -14270, -14324, -14377, -14427, -14480, -14532, -14585, -14637, -14688, 
-        -14740, -14793, -14845, -14896, -14948, -15000, -15051, -15102, -15155, -15207, -15258, -15309, 
-        -15361, -15412, -15463, -15514, -15565, -15617, -15668, -15719, -15771, -15821, -15872, -15924, 
-        -15975, -16026, -16075, -16126, -16177, -16228, -16279, -16330, -16379, -16430, -16481, -16530, 
-        -16581, -16634, -16682, -16733, -16783, -16833, -16884, -16935, -16983, -17034, -17084, -17132, 
-        -17183, -17233, -17282, -17333, -17383, -17432, -17481, -17531, -17550, -17653, -17647, -17784, 
-        -17732, -17845, -17915, -17781, -18270, -17544, -18801, -17102, -19548, -16324, -21207, -9384 
-    };
-
-    // AKWF_saw_0014 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0014[600] PROGMEM = {
-        -20374, -27961, -29298, -29678, -30067, -30372, -30619, -30938, -31153, -31385, -31593, -31790, 
-        -31938, -32095, -32233, -32351, -32458, -32553, -32612, -32660, -32731, -32755, -32751, -32767, 
-        -32756, -32743, -32696, -32662, -32622, -32396, -32410, -32369, -32293, -32227, -32209, -32003, 
-        -31854, -31715, -31567, -31416, -31280, -31111, -30940, -30778, -30594, -30406, -30227, -30024, 
-        -29827, -29630, -29417, -29215, -29002, -28777, -28554, -28329, -28102, -27868, -27655, -27409, 
-        -27164, -26925, -26686, -26429, -26187, -25922, -25662, -25426, -25172, -24912, -24667, -24407, 
-        -24138, -23869, -23626, -23361, -23081, -22828, -22563, -22291, -22030, -21776, -21502, -21236, 
-        -20988, -20706, -20437, -20192, -19916, -19643, -19390, -19139, -18855, -18602, -18341, -18075, 
-        -17813, -17559, -17302, -17031, -16789, -16520, -16278, -15930, -15646, -15481, -15242, -15012, 
-        -14859, -14599, -14281, -14007, -13768, -13534, -13270, -13028, -12813, -12559, -12304, -12093, 
-        -11844, -11601, -11376, -11154, -10905, -10684, -10466, -10235, -9997, -9790, -9562, -9333, 
-        -9112, -8910, -8698, -8469, -8265, -8052, -7835, -7637, -7408, -7213, -7019, -6812, 
-        -6599, -6417, -6212, -6004, -5828, -5621, -5428, -5247, -5052, -4854, -4678, -4491, 
-        -4297, -4129, -3948, -3762, -3580, -3417, -3234, -3052, -2904, -2719, -2537, -2389, 
-        -2224, -2059, -1892, -1733, -1552, -1409, -1237, -1094, -944, -757, -490, -448, 
-        -312, -189, -80, -24, 134, 192, 364, 453, 465, 758, 906, 1045, 
-        1190, 1317, 1449, 1578, 1715, 1830, 1956, 2102, 2222, 2328, 2460, 2585, 
-        2705, 2824, 2941, 3041, 3169, 3288, 3400, 3502, 3623, 3723, 3829, 3963, 
-        4051, 4162, 4253, 4369, 4457, 4566, 4674, 4757, 4858, 4958, 5050, 5133, 
-        5237, 5315, 5423, 5528, 5589, 5677, 5781, 5858, 5928, 6028, 6110, 6186, 
-        6262, 6353, 6427, 6493, 6584, 6640, 6718, 6805, 6892, 6931, 7019, 7090, 
-        7137, 7234, 7291, 7365, 7409, 7596, 7655, 7611, 7686, 7739, 7645, 7814, 
-        7916, 7972, 8028, 8087, 8133, 8193, 8268, 8296, 8353, 8415, 8453, 8502, 
-        8569, 8598, 8656, 8709, 8747, 8810, 8852, 8890, 8927, 8985, 9032, 9052, 
-        9100, 9156, 9182, 9221, 9278, 9289, 9335, 9343, 9310, 9188, 9325, 9492, 
-        9511, 9571, 9597, 9623, 9654, 9704, 9715, 9743, 9796, 9811, 9819, 9873, 
-        9895, 9912, 9944, 9970, 9972, 10014, 10043, 10061, 10077, 10105, 10125, 10141, 
-        10162, 10185, 10203, 10225, 10247, 10248, 10274, 10310, 10414, 10338, 10338, 10364, 
-        10286, 10284, 10387, 10391, 10416, 10413, 10421, 10445, 10438, 10466, 10469, 10474, 
-        10470, 10492, 10499, 10498, 10508, 10538, 10524, 10527, 10536, 10545, 10540, 10560, 
-        10551, 10552, 10562, 10567, 10546, 10567, 10570, 10562, 10573, 10576, 10555, 10562, 
-        10578, 10566, 10535, 10557, 10562, 10546, 10566, 10546, 10543, 10545, 10539, 10530, 
-        10531, 10535, 10513, 10507, 10509, 10491, 10482, 10485, 10470, 10459, 10470, 10455, 
-        10444, 10439, 10438, 10418, 10406, 10406, 10384, 10376, 10382, 10349, 10455, 10384, 
-        10328, 10318, 10256, 10182, 10252, 10242, 10241, 10220, 10210, 10200, 10184, 10168, 
-        10161, 10146, 10124, 10114, 10093, 10066, 10076, 10043, 10009, 10020, 10012, 9977, 
-        9965, 9964, 9927, 9905, 9902, 9875, 9869, 9856, 9833, 9810, 9788, 9783, 
-        9745, 9748, 9720, 9684, 9678, 9657, 9640, 9604, 9598, 9571, 9542, 9540, 
-        9527, 9487, 9465, 9449, 9423, 9412, 9390, 9347, 9337, 9332, 9290, 9267, 
-        9262, 9231, 9197, 9192, 9171, 9122, 9124, 9092, 9059, 9040, 9023, 8968, 
-        9040, 9056, 8921, 8896, 8858, 8735, 8771, 8783, 8758, 8742, 8725, 8696, 
-        8650, 8645, 8621, 8580, 8558, 8538, 8510, 8486, 8464, 8431, 8398, 8373, 
-        8363, 8310, 8291, 8273, 8240, 8232, 8195, 8159, 8142, 8115, 8079, 8044, 
-        8033, 7996, 7962, 7948, 7918, 7893, 7870, 7841, 7787, 7766, 7755, 7702, 
-        7693, 7670, 7631, 7602, 7589, 7544, 7510, 7492, 7468, 7425, 7405, 7382, 
-        7340, 7307, 7291, 7251, 7221, 7185, 7160, 7130, 7116, 7091, 7045, 7021, 
-        7000, 6947, 6957, 7041, 6893, 6850, 6830, 6706, 6662, 6715, 6676, 6658, 
-        6641, 6601, 6557, 6547, 6511, 6491, 6452, 6424, 6402, 6365, 6345, 6301, 
-        6271, 6238, 6210, 6190, 6153, 6126, 6090, 6062, 6055, 5981, 5987, 5940, 
-        5908, 5885, 5838, 5852, 5737, 5847, 5668, 5743, 5728, 5355, 6386, 1727 
-    };
-
-    // AKWF_saw_0015 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0015[600] PROGMEM = {
-        -20369, -27937, -29263, -29633, -30032, -30310, -30587, -30896, -31099, -31358, -31537, -31748, 
-        -31909, -32063, -32208, -32322, -32427, -32528, -32592, -32642, -32702, -32724, -32745, -32767, 
-        -32760, -32734, -32713, -32678, -32620, -32556, -32498, -32410, -32319, -32238, -32134, -32014, 
-        -31904, -31780, -31653, -31513, -31354, -31184, -31025, -30866, -30684, -30503, -30327, -30138, 
-        -29934, -29742, -29545, -29325, -29130, -28915, -28695, -28476, -28255, -28018, -27793, -27571, 
-        -27328, -27079, -26862, -26608, -26355, -26123, -25877, -25620, -25370, -25125, -24861, -24597, 
-        -24364, -24098, -23836, -23578, -23330, -23057, -22789, -22540, -22273, -22004, -21748, -21493, 
-        -21226, -20973, -20700, -20424, -20179, -19921, -19651, -19386, -19135, -18868, -18617, -18355, 
-        -18088, -17832, -17591, -17325, -17063, -16824, -16560, -16306, -16048, -15801, -15547, -15296, 
-        -15049, -14795, -14548, -14309, -14062, -13815, -13589, -13348, -13099, -12859, -12628, -12383, 
-        -12154, -11924, -11676, -11453, -11229, -10988, -10763, -10554, -10316, -10097, -9879, -9660, 
-        -9434, -9230, -9020, -8792, -8575, -8370, -8151, -7938, -7741, -7524, -7322, -7128, 
-        -6928, -6713, -6511, -6328, -6118, -5927, -5742, -5540, -5351, -5172, -4972, -4789, 
-        -4613, -4424, -4233, -4067, -3887, -3700, -3530, -3356, -3175, -3008, -2834, -2666, 
-        -2503, -2343, -2171, -2000, -1851, -1694, -1516, -1374, -1221, -1056, -905, -762, 
-        -598, -456, -321, -166, -20, 114, 254, 385, 538, 667, 817, 953, 
-        1080, 1209, 1353, 1479, 1602, 1731, 1864, 1980, 2101, 2236, 2358, 2479, 
-        2608, 2728, 2836, 2960, 3064, 3171, 3302, 3418, 3513, 3620, 3747, 3842, 
-        3941, 4063, 4160, 4256, 4370, 4467, 4562, 4652, 4764, 4841, 4946, 5047, 
-        5131, 5217, 5318, 5406, 5488, 5581, 5679, 5748, 5843, 5927, 5998, 6086, 
-        6176, 6243, 6329, 6419, 6481, 6558, 6644, 6709, 6769, 6855, 6935, 6995, 
-        7072, 7160, 7205, 7274, 7347, 7405, 7468, 7539, 7601, 7661, 7717, 7792, 
-        7839, 7897, 7962, 8014, 8074, 8132, 8183, 8233, 8297, 8334, 8373, 8446, 
-        8495, 8532, 8592, 8646, 8674, 8714, 8777, 8820, 8861, 8916, 8957, 8992, 
-        9047, 9090, 9116, 9162, 9207, 9232, 9280, 9321, 9349, 9389, 9426, 9465, 
-        9493, 9531, 9566, 9589, 9628, 9660, 9684, 9716, 9752, 9780, 9804, 9836, 
-        9860, 9879, 9918, 9935, 9952, 9985, 10011, 10019, 10053, 10077, 10099, 10112, 
-        10144, 10157, 10169, 10198, 10219, 10223, 10256, 10268, 10279, 10307, 10324, 10316, 
-        10341, 10367, 10367, 10382, 10400, 10414, 10417, 10440, 10445, 10453, 10470, 10486, 
-        10485, 10490, 10509, 10509, 10524, 10537, 10531, 10533, 10550, 10559, 10554, 10567, 
-        10567, 10567, 10569, 10584, 10574, 10572, 10587, 10584, 10582, 10599, 10599, 10586, 
-        10591, 10593, 10578, 10587, 10589, 10576, 10582, 10587, 10582, 10574, 10582, 10571, 
-        10559, 10567, 10567, 10544, 10543, 10544, 10533, 10533, 10535, 10522, 10509, 10509, 
-        10494, 10492, 10485, 10481, 10466, 10458, 10453, 10440, 10427, 10428, 10410, 10393, 
-        10395, 10380, 10357, 10361, 10348, 10329, 10324, 10318, 10292, 10281, 10277, 10260, 
-        10240, 10230, 10223, 10202, 10195, 10182, 10155, 10148, 10137, 10105, 10101, 10096, 
-        10066, 10049, 10041, 10017, 9998, 9998, 9982, 9952, 9940, 9925, 9901, 9892, 
-        9877, 9847, 9830, 9817, 9789, 9774, 9761, 9746, 9714, 9695, 9682, 9654, 
-        9643, 9632, 9598, 9581, 9572, 9531, 9507, 9503, 9471, 9441, 9443, 9417, 
-        9374, 9370, 9351, 9314, 9290, 9280, 9249, 9224, 9207, 9179, 9153, 9144, 
-        9119, 9084, 9069, 9047, 9013, 8989, 8979, 8934, 8918, 8910, 8867, 8841, 
-        8835, 8796, 8762, 8747, 8723, 8689, 8665, 8650, 8613, 8590, 8573, 8544, 
-        8510, 8497, 8469, 8433, 8411, 8386, 8353, 8328, 8310, 8272, 8242, 8226, 
-        8194, 8171, 8147, 8119, 8082, 8059, 8029, 7994, 7973, 7949, 7919, 7882, 
-        7865, 7833, 7797, 7786, 7753, 7713, 7691, 7670, 7631, 7614, 7588, 7551, 
-        7526, 7498, 7465, 7440, 7416, 7380, 7354, 7336, 7307, 7268, 7242, 7218, 
-        7180, 7149, 7128, 7092, 7059, 7042, 7010, 6967, 6958, 6926, 6887, 6868, 
-        6836, 6795, 6771, 6754, 6720, 6690, 6659, 6627, 6595, 6571, 6539, 6501, 
-        6481, 6462, 6419, 6389, 6371, 6329, 6307, 6279, 6253, 6200, 6199, 6154, 
-        6120, 6122, 6038, 6079, 5961, 6055, 5884, 5924, 5965, 5540, 6644, 1881 
-    };
-
-    // AKWF_saw_0016 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0016[600] PROGMEM = {
-        13, 45, 76, 108, 139, 170, 202, 234, 265, 296, 328, 361, 
-        392, 422, 455, 487, 519, 549, 581, 613, 644, 676, 707, 738, 
-        770, 802, 833, 864, 896, 927, 959, 990, 1022, 1053, 1085, 1116, 
-        1148, 1179, 1211, 1243, 1274, 1305, 1337, 1369, 1400, 1431, 1463, 1494, 
-        1526, 1557, 1589, 1620, 1652, 1683, 1715, 1746, 1778, 1809, 1842, 1872, 
-        1905, 1937, 1968, 1999, 2031, 2063, 2094, 2125, 2157, 2188, 2220, 2251, 
-        2283, 2314, 2346, 2377, 2409, 2440, 2472, 2504, 2535, 2566, 2598, 2630, 
-        2661, 2692, 2724, 2755, 2787, 2818, 2850, 2881, 2913, 2944, 2976, 3007, 
-        3039, 3071, 3102, 3133, 3165, 3198, 3229, 3259, 3292, 3322, 3355, 3386, 
-        3418, 3449, 3481, 3512, 3544, 3575, 3607, 3639, 3670, 3701, 3733, 3765, 
-        3796, 3827, 3859, 3890, 3922, 3953, 3985, 4016, 4048, 4079, 4111, 4142, 
-        4174, 4206, 4237, 4268, 4300, 4332, 4363, 4394, 4426, 4457, 4489, 4520, 
-        4552, 4583, 4615, 4646, 4679, 4709, 4742, 4774, 4805, 4836, 4868, 4900, 
-        4931, 4962, 4994, 5026, 5057, 5088, 5120, 5151, 5183, 5214, 5245, 5277, 
-        5309, 5340, 5371, 5403, 5435, 5467, 5498, 5529, 5561, 5593, 5624, 5655, 
-        5687, 5718, 5750, 5781, 5812, 5844, 5876, 5907, 5938, 5970, 6002, 6033, 
-        6064, 6096, 6129, 6161, 6192, 6223, 6255, 6286, 6318, 6349, 6380, 6412, 
-        6444, 6475, 6506, 6538, 6569, 6601, 6632, 6664, 6695, 6728, 6758, 6790, 
-        6821, 6853, 6885, 6916, 6947, 6979, 7011, 7042, 7073, 7105, 7136, 7168, 
-        7199, 7231, 7262, 7294, 7325, 7357, 7388, 7420, 7452, 7483, 7514, 7546, 
-        7579, 7609, 7640, 7673, 7703, 7736, 7767, 7799, 7830, 7862, 7893, 7925, 
-        7956, 7988, 8019, 8051, 8082, 8114, 8146, 8177, 8208, 8240, 8272, 8303, 
-        8334, 8366, 8397, 8429, 8460, 8492, 8523, 8555, 8586, 8618, 8649, 8681, 
-        8713, 8744, 8775, 8807, 8839, 8870, 8901, 8933, 8964, 8996, 9027, 9060, 
-        9090, 9123, 9153, 9186, 9217, 9249, 9281, 9312, 9343, 9375, 9407, 9438, 
-        -32767, -406, 1280, -10850, -13704, -9515, -7603, -8827, -9753, -9414, -8956, -8964, 
-        -9104, -9089, -8995, -8945, -8935, -8914, -8876, -8839, -8810, -8780, -8749, -8717, 
-        -8685, -8653, -8622, -8591, -8559, -8528, -8496, -8465, -8433, -8402, -8369, -8339, 
-        -8306, -8275, -8243, -8211, -8180, -8149, -8117, -8085, -8054, -8023, -7991, -7960, 
-        -7928, -7897, -7865, -7834, -7802, -7771, -7739, -7708, -7676, -7645, -7613, -7582, 
-        -7550, -7518, -7487, -7456, -7424, -7392, -7361, -7330, -7298, -7267, -7235, -7204, 
-        -7172, -7141, -7109, -7078, -7046, -7015, -6982, -6950, -6919, -6888, -6856, -6824, 
-        -6793, -6762, -6730, -6699, -6667, -6636, -6605, -6573, -6541, -6510, -6479, -6447, 
-        -6415, -6383, -6352, -6321, -6289, -6257, -6226, -6195, -6163, -6132, -6100, -6069, 
-        -6038, -6006, -5974, -5943, -5912, -5880, -5848, -5817, -5786, -5754, -5722, -5690, 
-        -5659, -5628, -5596, -5565, -5532, -5502, -5471, -5438, -5406, -5375, -5344, -5312, 
-        -5281, -5249, -5218, -5186, -5155, -5122, -5092, -5060, -5029, -4997, -4965, -4934, 
-        -4903, -4871, -4839, -4808, -4777, -4745, -4713, -4682, -4651, -4619, -4588, -4556, 
-        -4525, -4493, -4462, -4430, -4399, -4367, -4336, -4304, -4272, -4241, -4210, -4178, 
-        -4146, -4115, -4084, -4052, -4021, -3988, -3958, -3925, -3894, -3862, -3831, -3799, 
-        -3768, -3736, -3704, -3673, -3642, -3610, -3578, -3547, -3516, -3484, -3453, -3421, 
-        -3390, -3358, -3327, -3295, -3264, -3232, -3201, -3169, -3137, -3106, -3075, -3043, 
-        -3011, -2980, -2949, -2917, -2886, -2854, -2823, -2791, -2760, -2728, -2697, -2665, 
-        -2634, -2602, -2569, -2538, -2508, -2475, -2443, -2412, -2381, -2349, -2318, -2286, 
-        -2255, -2223, -2192, -2160, -2129, -2097, -2066, -2034, -2002, -1971, -1940, -1908, 
-        -1876, -1845, -1814, -1782, -1751, -1719, -1688, -1656, -1625, -1593, -1562, -1530, 
-        -1499, -1467, -1436, -1404, -1373, -1341, -1309, -1278, -1247, -1215, -1182, -1151, 
-        -1121, -1088, -1057, -1025, -994, -962, -931, -899, -868, -836, -805, -773, 
-        -741, -710, -679, -647, -615, -584, -553, -521, -490, -458, -427, -396, 
-        -364, -332, -301, -270, -238, -206, -174, -144, -112, -80, -48, -17 
-    };
-
-    // AKWF_saw_0017 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0017[600] PROGMEM = {
-        58, 134, 211, 287, 366, 441, 517, 593, 671, 745, 821, 892, 
-        969, 1047, 1121, 1197, 1274, 1351, 1426, 1502, 1578, 1654, 1732, 1807, 
-        1883, 1959, 2037, 2111, 2186, 2263, 2339, 2416, 2492, 2568, 2644, 2722, 
-        2795, 2870, 2947, 3023, 3100, 3175, 3252, 3322, 3397, 3472, 3547, 3624, 
-        3700, 3777, 3852, 3927, 4001, 4079, 4154, 4229, 4306, 4383, 4458, 4533, 
-        4606, 4682, 4759, 4833, 4910, 4986, 5064, 5138, 5209, 5285, 5361, 5438, 
-        5512, 5588, 5664, 5736, 5805, 5881, 5957, 6033, 6110, 6184, 6260, 6336, 
-        6407, 6481, 6557, 6633, 6709, 6786, 6861, 6929, 7005, 7082, 7156, 7232, 
-        7308, 7383, 7460, 7526, 7602, 7679, 7755, 7829, 7905, 7980, 8050, 8118, 
-        8192, 8268, 8343, 8420, 8494, 8569, 8646, 8712, 8788, 8862, 8937, 9013, 
-        9089, 9163, 9238, 9304, 9379, 9455, 9529, 9604, 9680, 9757, 9830, 9895, 
-        9970, 10045, 10121, 10194, 10269, 10344, 10415, 10477, 10552, 10627, 10702, 10777, 
-        10851, 10926, 11002, 11066, 11139, 11213, 11288, 11363, 11438, 11512, 11586, 11648, 
-        11724, 11797, 11871, 11946, 12022, 12095, 12170, 12230, 12304, 12381, 12454, 12528, 
-        12602, 12678, 12731, 12805, 12879, 12953, 13028, 13101, 13175, 13249, 13310, 13382, 
-        13456, 13530, 13604, 13678, 13751, 13824, 13883, 13958, 14030, 14105, 14179, 14252, 
-        14327, 14399, 14456, 14530, 14605, 14677, 14750, 14823, 14897, 14966, 15021, 15094, 
-        15167, 15242, 15313, 15386, 15460, 15533, 15589, 15661, 15734, 15807, 15881, 15953, 
-        16025, 16098, 16153, 16227, 16298, 16370, 16443, 16517, 16588, 16662, 16715, 16787, 
-        16861, 16932, 17004, 17077, 17151, 17216, 17268, 17340, 17412, 17485, 17556, 17629, 
-        17701, 17775, 17824, 17896, 17968, 18040, 18113, 18184, 18255, 18306, 18379, 18449, 
-        18520, 18592, 18666, 18736, 18807, 18856, 18928, 19000, 19070, 19141, 19212, 19284, 
-        19354, 19398, 19469, 19540, 19612, 19681, 19752, 19823, 19895, 19942, 20013, 20083, 
-        20154, 20226, 20295, 20365, 20436, 20485, 20553, 20623, 20694, 20764, 20835, 20904, 
-        20974, 21021, 21092, 21161, 21230, 21300, 21370, 21441, 21504, 21549, 21618, 21689, 
-        21757, -32767, -663, 3266, -24061, -29689, -21451, -17407, -20090, -22084, -21420, -20496, 
-        -20552, -20883, -20886, -20716, -20641, -20645, -20629, -20575, -20520, -20470, -20427, -20379, 
-        -20329, -20278, -20226, -20176, -20089, -20022, -19969, -19915, -19861, -19805, -19748, -19689, 
-        -19634, -19557, -19498, -19438, -19376, -19316, -19255, -19192, -19109, -19047, -18984, -18920, 
-        -18855, -18790, -18726, -18661, -18575, -18507, -18442, -18376, -18309, -18241, -18175, -18108, 
-        -18017, -17950, -17881, -17814, -17746, -17678, -17608, -17541, -17451, -17382, -17313, -17242, 
-        -17174, -17105, -17035, -16964, -16874, -16805, -16734, -16664, -16593, -16524, -16453, -16381, 
-        -16289, -16219, -16149, -16078, -16007, -15934, -15865, -15798, -15706, -15633, -15563, -15492, 
-        -15420, -15349, -15275, -15205, -15114, -15041, -14968, -14898, -14826, -14754, -14682, -14609, 
-        -14519, -14446, -14373, -14299, -14229, -14156, -14084, -14011, -13919, -13848, -13775, -13703, 
-        -13629, -13557, -13485, -13417, -13325, -13251, -13180, -13107, -13034, -12960, -12888, -12815, 
-        -12724, -12651, -12576, -12504, -12431, -12358, -12283, -12194, -12121, -12048, -11974, -11900, 
-        -11828, -11754, -11679, -11588, -11516, -11443, -11369, -11294, -11222, -11148, -11074, -10989, 
-        -10915, -10842, -10768, -10694, -10619, -10546, -10473, -10384, -10310, -10234, -10161, -10087, 
-        -10012, -9937, -9864, -9776, -9701, -9627, -9552, -9479, -9405, -9329, -9253, -9167, 
-        -9093, -9018, -8944, -8868, -8795, -8720, -8646, -8562, -8489, -8414, -8339, -8265, 
-        -8189, -8115, -8041, -7954, -7877, -7803, -7729, -7654, -7579, -7503, -7429, -7343, 
-        -7268, -7192, -7117, -7042, -6967, -6892, -6816, -6732, -6657, -6581, -6505, -6431, 
-        -6355, -6280, -6210, -6124, -6051, -5975, -5900, -5823, -5749, -5674, -5598, -5513, 
-        -5437, -5363, -5288, -5212, -5135, -5061, -4986, -4901, -4825, -4749, -4675, -4599, 
-        -4523, -4446, -4372, -4290, -4213, -4137, -4060, -3986, -3911, -3835, -3757, -3683, 
-        -3607, -3531, -3453, -3379, -3303, -3227, -3145, -3069, -2994, -2919, -2842, -2764, 
-        -2690, -2614, -2533, -2457, -2380, -2306, -2230, -2154, -2076, -2001, -1921, -1845, 
-        -1769, -1692, -1617, -1541, -1465, -1388, -1315, -1239, -1163, -1087, -1009, -935, 
-        -859, -783, -702, -628, -551, -475, -399, -322, -247, -171, -92, -15 
-    };
-
-    // AKWF_saw_0018 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0018[600] PROGMEM = {
-        3795, 32765, 32766, 32767, 32766, 32765, 32762, 32758, 32752, 32745, 32738, 32730, 
-        32720, 32710, 32698, 32685, 32672, 32657, 32642, 32625, 32607, 32587, 32568, 32547, 
-        32524, 32502, 32478, 32453, 32428, 32401, 32373, 32345, 32314, 32285, 32253, 32221, 
-        32187, 32152, 32117, 32081, 32043, 32005, 31966, 31927, 31886, 31844, 31801, 31758, 
-        31713, 31668, 31622, 31575, 31527, 31478, 31428, 31377, 31326, 31272, 31219, 31166, 
-        31110, 31056, 30998, 30940, 30882, 30822, 30762, 30702, 30640, 30576, 30513, 30449, 
-        30383, 30317, 30252, 30182, 30114, 30045, 29975, 29903, 29832, 29758, 29685, 29611, 
-        29535, 29460, 29382, 29305, 29226, 29148, 29068, 28987, 28905, 28822, 28740, 28656, 
-        28572, 28487, 28398, 28313, 28225, 28137, 28047, 27958, 27866, 27775, 27682, 27590, 
-        27496, 27401, 27305, 27210, 27113, 27015, 26917, 26819, 26717, 26618, 26517, 26415, 
-        26313, 26208, 26105, 26000, 25895, 25789, 25682, 25573, 25466, 25358, 25249, 25138, 
-        25028, 24915, 24803, 24689, 24576, 24463, 24348, 24231, 24115, 23999, 23881, 23764, 
-        23645, 23524, 23404, 23284, 23162, 23041, 22916, 22794, 22670, 22547, 22421, 22297, 
-        22168, 22042, 21915, 21787, 21659, 21530, 21399, 21269, 21139, 21007, 20876, 20743, 
-        20609, 20474, 20341, 20207, 20071, 19936, 19797, 19662, 19525, 19386, 19249, 19106, 
-        18968, 18828, 18688, 18548, 18407, 18262, 18121, 17978, 17835, 17691, 17547, 17400, 
-        17255, 17109, 16964, 16818, 16672, 16521, 16374, 16225, 16077, 15928, 15779, 15625, 
-        15476, 15326, 15175, 15023, 14872, 14716, 14564, 14410, 14258, 14104, 13946, 13792, 
-        13638, 13483, 13326, 13171, 13012, 12855, 12698, 12540, 12384, 12226, 12063, 11905, 
-        11747, 11588, 11428, 11268, 11105, 10945, 10784, 10623, 10462, 10301, 10136, 9974, 
-        9812, 9649, 9486, 9319, 9157, 8994, 8830, 8665, 8501, 8333, 8170, 8005, 
-        7840, 7673, 7508, 7339, 7174, 7008, 6841, 6675, 6508, 6339, 6173, 6005, 
-        5838, 5671, 5503, 5332, 5164, 4997, 4829, 4661, 4492, 4321, 4152, 3984, 
-        3815, 3647, 3473, 3306, 3136, 2967, 2798, 2629, 2457, 2288, 2118, 1949, 
-        1778, 1609, 1437, 1268, 1097, 928, 759, 588, 416, 247, 76, -92, 
-        -261, -430, -604, -773, -942, -1111, -1281, -1454, -1623, -1792, -1962, -2131, 
-        -2300, -2472, -2640, -2809, -2978, -3146, -3315, -3487, -3655, -3823, -3991, -4159, 
-        -4327, -4499, -4665, -4833, -5001, -5167, -5335, -5504, -5671, -5837, -6003, -6170, 
-        -6339, -6504, -6671, -6836, -7001, -7166, -7333, -7499, -7662, -7827, -7991, -8154, 
-        -8321, -8484, -8647, -8810, -8973, -9135, -9300, -9461, -9623, -9784, -9945, -10105, 
-        -10268, -10428, -10588, -10747, -10907, -11069, -11227, -11385, -11543, -11700, -11858, -12017, 
-        -12174, -12329, -12486, -12641, -12796, -12954, -13108, -13262, -13416, -13568, -13721, -13877, 
-        -14028, -14181, -14332, -14483, -14633, -14786, -14935, -15084, -15234, -15382, -15529, -15680, 
-        -15827, -15974, -16119, -16265, -16413, -16558, -16702, -16846, -16989, -17132, -17277, -17420, 
-        -17561, -17701, -17842, -17982, -18125, -18263, -18402, -18539, -18677, -18814, -18953, -19088, 
-        -19224, -19358, -19492, -19627, -19762, -19894, -20027, -20158, -20288, -20421, -20551, -20680, 
-        -20809, -20937, -21064, -21193, -21320, -21445, -21571, -21695, -21818, -21944, -22067, -22189, 
-        -22311, -22431, -22551, -22673, -22792, -22911, -23028, -23144, -23262, -23379, -23494, -23608, 
-        -23722, -23835, -23950, -24062, -24172, -24283, -24392, -24501, -24613, -24719, -24827, -24933, 
-        -25038, -25143, -25249, -25352, -25456, -25558, -25659, -25759, -25861, -25961, -26059, -26157, 
-        -26254, -26350, -26447, -26543, -26636, -26730, -26822, -26916, -27007, -27098, -27187, -27275, 
-        -27364, -27453, -27540, -27625, -27710, -27794, -27878, -27963, -28045, -28126, -28207, -28287, 
-        -28365, -28445, -28522, -28598, -28674, -28748, -28822, -28898, -28970, -29042, -29113, -29183, 
-        -29252, -29321, -29389, -29456, -29521, -29587, -29653, -29716, -29779, -29840, -29902, -29962, 
-        -30022, -30081, -30140, -30196, -30252, -30307, -30362, -30417, -30468, -30520, -30572, -30622, 
-        -30672, -30720, -30768, -30815, -30861, -30906, -30951, -30994, -31036, -31078, -31119, -31159, 
-        -31198, -31236, -31274, -31310, -31347, -31382, -31415, -31449, -31481, -31512, -31542, -31572, 
-        -31600, -31628, -31654, -31681, -31706, -31731, -31754, -31776, -31798, -31818, -31839, -31857, 
-        -31875, -31893, -31909, -31924, -31940, -31952, -31966, -31977, -31989, -31998, -32008, -32016, 
-        -32023, -32030, -32036, -32040, -32044, -32047, -32049, -32050, -32051, -32050, -32049, -32046 
-    };
-
-    // AKWF_saw_0019 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0019[600] PROGMEM = {
-        14, 32, 49, 64, 78, 92, 103, 116, 129, 143, 157, 169, 
-        177, 185, 195, 205, 215, 225, 235, 243, 249, 256, 261, 266, 
-        271, 277, 284, 289, 290, 292, 294, 295, 299, 302, 304, 305, 
-        305, 305, 305, 307, 309, 313, 320, 323, 325, 328, 333, 340, 
-        346, 355, 363, 373, 381, 387, 396, 404, 415, 429, 442, 455, 
-        465, 476, 488, 503, 519, 535, 552, 570, 586, 603, 619, 636, 
-        655, 677, 700, 721, 741, 761, 782, 805, 830, 856, 882, 909, 
-        935, 960, 986, 1012, 1042, 1073, 1104, 1135, 1163, 1193, 1224, 1259, 
-        1293, 1328, 1364, 1400, 1436, 1472, 1507, 1545, 1583, 1625, 1666, 1708, 
-        1747, 1786, 1828, 1872, 1916, 1962, 2008, 2054, 2102, 2146, 2192, 2240, 
-        2289, 2342, 2395, 2446, 2495, 2544, 2597, 2651, 2707, 2763, 2820, 2876, 
-        2934, 2990, 3047, 3105, 3166, 3228, 3291, 3353, 3412, 3473, 3536, 3601, 
-        3667, 3736, 3802, 3868, 3933, 4002, 4071, 4142, 4214, 4287, 4359, 4431, 
-        4502, 4574, 4648, 4724, 4801, 4880, 4958, 5038, 5117, 5194, 5273, 5352, 
-        5434, 5518, 5604, 5687, 5770, 5853, 5937, 6024, 6113, 6202, 6292, 6383, 
-        6473, 6562, 6652, 6743, 6837, 6932, 7029, 7124, 7218, 7312, 7409, 7507, 
-        7608, 7708, 7810, 7912, 8014, 8114, 8216, 8318, 8423, 8531, 8640, 8747, 
-        8852, 8959, 9067, 9177, 9289, 9401, 9514, 9630, 9743, 9856, 9970, 10085, 
-        10202, 10322, 10442, 10562, 10678, 10797, 10918, 11040, 11165, 11290, 11415, 11541, 
-        11668, 11793, 11919, 12048, 12176, 12307, 12442, 12574, 12704, 12835, 12968, 13103, 
-        13241, 13378, 13517, 13655, 13794, 13930, 14066, 14203, 14341, 14482, 14622, 14760, 
-        14897, 15033, 15171, 15309, 15449, 15589, 15727, 15866, 16005, 16141, 16277, 16416, 
-        16554, 16693, 16833, 16971, 17108, 17242, 17379, 17517, 17657, 17795, 17933, 18071, 
-        18209, 18344, 18479, 18615, 18752, 18891, 19029, 19166, 19301, 19434, 19570, 19705, 
-        19843, 19980, 20116, 20251, 20387, 20520, 20654, 20787, 20922, 21058, 21194, 21328, 
-        21459, 21591, 21724, 21857, 21990, 22125, 22258, 22391, 22523, 22653, 22782, 22914, 
-        23045, 23177, 23310, 23442, 23570, 23698, 23826, 23956, 24086, 24218, 24347, 24476, 
-        24606, 24732, 24857, 24984, 25112, 25240, 25370, 25497, 25621, 22638, 10226, -10034, 
-        -26713, -32767, -30941, -27096, -24801, -24456, -24938, -25253, -25112, -24694, -24259, -23923, 
-        -23673, -23448, -23210, -22952, -22689, -22429, -22177, -21933, -21691, -21452, -21217, -20984, 
-        -20752, -20522, -20295, -20073, -19855, -19639, -19424, -19212, -19001, -18794, -18587, -18385, 
-        -18186, -17990, -17796, -17604, -17413, -17224, -17037, -16853, -16674, -16496, -16320, -16144, 
-        -15972, -15799, -15630, -15462, -15298, -15137, -14977, -14818, -14662, -14504, -14349, -14198, 
-        -14050, -13904, -13757, -13613, -13470, -13327, -13185, -13047, -12911, -12778, -12646, -12515, 
-        -12385, -12255, -12125, -12000, -11877, -11755, -11633, -11513, -11395, -11275, -11158, -11040, 
-        -10923, -10807, -10691, -10576, -10465, -10353, -10241, -10129, -10019, -9911, -9802, -9694, 
-        -9585, -9478, -9371, -9265, -9161, -9057, -8956, -8854, -8753, -8650, -8548, -8448, 
-        -8351, -8254, -8157, -8060, -7963, -7867, -7770, -7675, -7583, -7491, -7400, -7308, 
-        -7218, -7127, -7035, -6947, -6860, -6774, -6687, -6601, -6514, -6429, -6343, -6260, 
-        -6176, -6095, -6015, -5934, -5853, -5773, -5691, -5612, -5536, -5461, -5383, -5308, 
-        -5230, -5155, -5079, -5005, -4933, -4861, -4790, -4719, -4648, -4578, -4505, -4436, 
-        -4369, -4303, -4236, -4170, -4103, -4037, -3970, -3905, -3841, -3779, -3718, -3656, 
-        -3595, -3532, -3470, -3409, -3351, -3294, -3236, -3179, -3121, -3062, -3006, -2950, 
-        -2894, -2840, -2788, -2735, -2682, -2628, -2576, -2523, -2474, -2426, -2377, -2326, 
-        -2276, -2227, -2179, -2130, -2084, -2038, -1994, -1949, -1905, -1859, -1813, -1770, 
-        -1729, -1688, -1647, -1606, -1563, -1522, -1481, -1440, -1402, -1364, -1328, -1290, 
-        -1254, -1214, -1177, -1140, -1107, -1073, -1040, -1006, -971, -937, -904, -871, 
-        -838, -808, -779, -749, -720, -688, -657, -627, -601, -575, -549, -521, 
-        -494, -466, -440, -414, -389, -364, -343, -320, -297, -272, -248, -226, 
-        -207, -187, -167, -147, -126, -106, -87, -67, -49, -32, -16, -1 
-    };
-
-    // AKWF_saw_0020 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0020[600] PROGMEM = {
-        0, 17, 32, 50, 65, 81, 95, 107, 118, 131, 143, 158, 
-        170, 181, 190, 198, 208, 217, 226, 237, 245, 255, 261, 267, 
-        272, 276, 281, 287, 294, 298, 300, 301, 303, 306, 308, 311, 
-        314, 319, 322, 323, 327, 331, 336, 344, 352, 358, 364, 369, 
-        377, 386, 395, 406, 417, 430, 441, 452, 463, 474, 488, 503, 
-        519, 535, 549, 563, 578, 596, 614, 635, 654, 674, 694, 715, 
-        733, 755, 777, 802, 827, 852, 876, 899, 924, 951, 979, 1009, 
-        1037, 1067, 1096, 1126, 1156, 1187, 1218, 1253, 1289, 1323, 1356, 1389, 
-        1425, 1461, 1500, 1539, 1578, 1617, 1658, 1697, 1736, 1777, 1819, 1865, 
-        1910, 1955, 1998, 2041, 2087, 2134, 2182, 2232, 2282, 2332, 2383, 2433, 
-        2483, 2534, 2588, 2642, 2699, 2753, 2807, 2861, 2918, 2974, 3033, 3093, 
-        3154, 3215, 3276, 3335, 3396, 3459, 3522, 3587, 3655, 3720, 3785, 3849, 
-        3916, 3985, 4054, 4126, 4196, 4268, 4340, 4410, 4482, 4554, 4629, 4706, 
-        4783, 4859, 4935, 5011, 5088, 5168, 5249, 5330, 5412, 5495, 5578, 5659, 
-        5742, 5826, 5911, 6000, 6088, 6175, 6261, 6349, 6438, 6529, 6621, 6714, 
-        6808, 6901, 6995, 7089, 7183, 7278, 7376, 7474, 7574, 7674, 7771, 7870, 
-        7970, 8073, 8177, 8281, 8386, 8493, 8598, 8702, 8809, 8915, 9025, 9136, 
-        9247, 9358, 9468, 9579, 9691, 9805, 9921, 10039, 10156, 10273, 10391, 10508, 
-        10625, 10744, 10865, 10988, 11114, 11236, 11358, 11481, 11605, 11732, 11860, 11990, 
-        12120, 12250, 12379, 12509, 12639, 12771, 12904, 13040, 13177, 13312, 13445, 13578, 
-        13713, 13849, 13985, 14121, 14257, 14392, 14525, 14659, 14795, 14931, 15068, 15204, 
-        15340, 15476, 15609, 15744, 15878, 16013, 16149, 16285, 16421, 16557, 16692, 16825, 
-        16959, 17092, 17227, 17363, 17499, 17634, 17767, 17898, 18033, 18166, 18300, 18436, 
-        18571, 18704, 18837, 18970, 19101, 19233, 19366, 19500, 19635, 19766, 19898, 20028, 
-        20159, 20291, 20422, 20555, 20686, 20818, 20949, 21078, 21207, 21336, 21466, 21597, 
-        21729, 21858, 21985, 22113, 22240, 22370, 22498, 22627, 22757, 22883, 23012, 23137, 
-        23263, 23389, 23515, 23642, 23770, 23896, 24019, 24143, 24266, 24392, 24517, 24642, 
-        24767, 24891, 25014, 25135, 25257, 25379, 25501, 25625, 22641, 10226, -10036, -26714, 
-        -32767, -30943, -27099, -24803, -24456, -24935, -25249, -25108, -24694, -24262, -23925, -23672, 
-        -23443, -23204, -22947, -22686, -22428, -22178, -21932, -21689, -21450, -21212, -20977, -20746, 
-        -20519, -20294, -20072, -19849, -19630, -19414, -19205, -18995, -18788, -18583, -18380, -18180, 
-        -17983, -17785, -17593, -17404, -17216, -17031, -16847, -16665, -16484, -16307, -16133, -15961, 
-        -15790, -15621, -15454, -15288, -15124, -14963, -14803, -14647, -14493, -14340, -14188, -14036, 
-        -13886, -13741, -13597, -13454, -13314, -13174, -13035, -12899, -12763, -12628, -12497, -12367, 
-        -12239, -12112, -11987, -11862, -11736, -11614, -11495, -11378, -11261, -11145, -11028, -10912, 
-        -10798, -10683, -10571, -10460, -10348, -10239, -10129, -10018, -9909, -9801, -9696, -9591, 
-        -9485, -9380, -9275, -9172, -9067, -8965, -8864, -8763, -8665, -8566, -8468, -8368, 
-        -8269, -8172, -8078, -7984, -7890, -7796, -7703, -7609, -7516, -7424, -7333, -7244, 
-        -7156, -7069, -6980, -6890, -6803, -6717, -6632, -6549, -6465, -6382, -6297, -6215, 
-        -6132, -6050, -5970, -5891, -5812, -5734, -5656, -5578, -5499, -5423, -5349, -5274, 
-        -5201, -5127, -5053, -4980, -4906, -4834, -4762, -4694, -4625, -4556, -4487, -4418, 
-        -4349, -4282, -4216, -4152, -4088, -4022, -3958, -3894, -3830, -3767, -3705, -3644, 
-        -3584, -3525, -3465, -3404, -3345, -3285, -3229, -3173, -3118, -3062, -3007, -2951, 
-        -2896, -2841, -2788, -2733, -2681, -2630, -2580, -2530, -2480, -2428, -2379, -2331, 
-        -2282, -2235, -2187, -2140, -2093, -2046, -2001, -1957, -1913, -1869, -1827, -1782, 
-        -1738, -1696, -1657, -1616, -1577, -1536, -1495, -1455, -1416, -1376, -1339, -1303, 
-        -1267, -1231, -1195, -1157, -1121, -1087, -1054, -1021, -988, -956, -923, -890, 
-        -857, -826, -794, -765, -736, -708, -679, -649, -619, -591, -564, -539, 
-        -513, -488, -461, -434, -408, -383, -359, -336, -314, -292, -270, -247, 
-        -223, -201, -183, -164, -145, -125, -104, -86, -65, -46, -29, -14 
-    };
-
-    // AKWF_saw_0021 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0021[600] PROGMEM = {
-        13, 30, 48, 63, 77, 90, 104, 118, 133, 146, 158, 172, 
-        184, 193, 204, 213, 224, 234, 245, 254, 261, 267, 275, 283, 
-        289, 296, 302, 308, 313, 316, 319, 323, 328, 334, 342, 348, 
-        352, 358, 364, 373, 382, 392, 402, 413, 423, 434, 443, 455, 
-        467, 482, 497, 511, 525, 538, 555, 570, 588, 606, 626, 644, 
-        664, 682, 702, 721, 744, 767, 791, 815, 838, 861, 885, 911, 
-        938, 965, 994, 1023, 1050, 1079, 1107, 1138, 1168, 1201, 1236, 1269, 
-        1301, 1333, 1368, 1404, 1440, 1478, 1516, 1554, 1593, 1631, 1669, 1710, 
-        1751, 1793, 1837, 1881, 1923, 1966, 2009, 2056, 2102, 2150, 2199, 2247, 
-        2296, 2344, 2392, 2442, 2494, 2548, 2601, 2656, 2707, 2760, 2815, 2871, 
-        2928, 2986, 3045, 3104, 3163, 3220, 3279, 3340, 3402, 3465, 3531, 3594, 
-        3656, 3720, 3785, 3851, 3918, 3988, 4056, 4125, 4195, 4265, 4334, 4405, 
-        4477, 4549, 4623, 4698, 4773, 4847, 4923, 5000, 5079, 5158, 5238, 5318, 
-        5398, 5478, 5559, 5640, 5722, 5808, 5893, 5979, 6063, 6147, 6235, 6323, 
-        6412, 6502, 6592, 6685, 6776, 6866, 6957, 7051, 7145, 7242, 7339, 7434, 
-        7529, 7626, 7723, 7823, 7923, 8026, 8127, 8230, 8333, 8434, 8537, 8642, 
-        8748, 8855, 8964, 9072, 9179, 9287, 9396, 9506, 9618, 9732, 9845, 9959, 
-        10074, 10187, 10302, 10419, 10535, 10655, 10776, 10895, 11013, 11133, 11254, 11377, 
-        11501, 11626, 11752, 11878, 12005, 12130, 12258, 12385, 12515, 12647, 12778, 12910, 
-        13040, 13170, 13302, 13435, 13567, 13700, 13833, 13966, 14100, 14230, 14361, 14492, 
-        14625, 14758, 14893, 15024, 15155, 15286, 15416, 15550, 15681, 15814, 15948, 16079, 
-        16211, 16343, 16473, 16603, 16735, 16868, 17001, 17131, 17261, 17390, 17520, 17652, 
-        17782, 17914, 18045, 18176, 18306, 18434, 18563, 18693, 18822, 18952, 19084, 19212, 
-        19339, 19467, 19595, 19724, 19853, 19981, 20110, 20238, 20366, 20491, 20617, 20742, 
-        20870, 20998, 21125, 21251, 21375, 21499, 21625, 21749, 21875, 22000, 22126, 22250, 
-        22374, 22497, 22619, 22742, 22864, 22989, 23113, 23235, 23355, 23476, 23597, 23718, 
-        23839, 23960, 24081, 24202, 24322, 24442, 24560, 24678, 24797, 24917, 25035, 25153, 
-        25269, 25386, 25503, 25619, 22630, 10214, -10042, -26715, -32767, -30947, -27108, -24820, 
-        -24475, -24956, -25271, -25132, -24720, -24290, -23957, -23707, -23482, -23244, -22987, -22725, 
-        -22469, -22221, -21981, -21741, -21504, -21268, -21033, -20803, -20578, -20354, -20134, -19915, 
-        -19698, -19483, -19271, -19062, -18857, -18654, -18454, -18256, -18059, -17864, -17672, -17481, 
-        -17296, -17112, -16930, -16748, -16570, -16393, -16219, -16046, -15875, -15708, -15542, -15379, 
-        -15217, -15055, -14896, -14738, -14585, -14433, -14283, -14133, -13985, -13838, -13692, -13550, 
-        -13408, -13270, -13134, -12998, -12863, -12728, -12597, -12466, -12339, -12212, -12088, -11964, 
-        -11840, -11717, -11598, -11480, -11363, -11248, -11133, -11020, -10906, -10793, -10681, -10570, 
-        -10461, -10352, -10245, -10136, -10028, -9921, -9815, -9709, -9604, -9501, -9399, -9297, 
-        -9194, -9093, -8991, -8892, -8793, -8696, -8598, -8501, -8404, -8307, -8212, -8117, 
-        -8023, -7930, -7838, -7747, -7655, -7564, -7472, -7383, -7295, -7208, -7121, -7034, 
-        -6947, -6860, -6776, -6689, -6606, -6523, -6441, -6361, -6279, -6197, -6116, -6035, 
-        -5957, -5880, -5802, -5725, -5648, -5571, -5495, -5419, -5345, -5271, -5200, -5127, 
-        -5055, -4982, -4909, -4840, -4770, -4702, -4634, -4566, -4498, -4430, -4363, -4296, 
-        -4231, -4166, -4103, -4039, -3977, -3912, -3848, -3786, -3727, -3668, -3608, -3549, 
-        -3488, -3429, -3370, -3313, -3255, -3199, -3145, -3090, -3034, -2980, -2924, -2871, 
-        -2819, -2768, -2716, -2665, -2613, -2562, -2510, -2461, -2412, -2364, -2317, -2270, 
-        -2223, -2176, -2128, -2082, -2038, -1994, -1950, -1907, -1863, -1820, -1776, -1734, 
-        -1693, -1652, -1613, -1574, -1534, -1493, -1454, -1415, -1378, -1342, -1306, -1269, 
-        -1233, -1197, -1160, -1126, -1091, -1057, -1026, -992, -961, -927, -894, -862, 
-        -832, -803, -773, -744, -714, -684, -655, -626, -599, -573, -546, -520, 
-        -494, -467, -441, -416, -393, -370, -346, -323, -299, -276, -254, -231, 
-        -210, -190, -171, -151, -131, -110, -89, -71, -54, -37, -21, -3 
-    };
-
-    // AKWF_saw_0022 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0022[600] PROGMEM = {
-        9, 25, 43, 60, 77, 95, 111, 130, 145, 160, 175, 189, 
-        202, 216, 231, 246, 258, 269, 279, 291, 302, 314, 325, 335, 
-        346, 355, 364, 375, 385, 397, 409, 424, 437, 450, 462, 476, 
-        493, 509, 526, 542, 559, 576, 594, 613, 633, 654, 675, 697, 
-        718, 739, 762, 784, 809, 833, 858, 886, 913, 939, 966, 993, 
-        1020, 1049, 1079, 1111, 1143, 1173, 1203, 1235, 1268, 1303, 1338, 1374, 
-        1409, 1445, 1482, 1518, 1554, 1593, 1633, 1674, 1714, 1754, 1795, 1835, 
-        1878, 1922, 1967, 2011, 2058, 2103, 2148, 2194, 2239, 2288, 2337, 2387, 
-        2437, 2487, 2536, 2587, 2640, 2693, 2746, 2800, 2856, 2911, 2965, 3021, 
-        3077, 3134, 3193, 3254, 3313, 3372, 3431, 3491, 3553, 3615, 3679, 3744, 
-        3809, 3872, 3937, 4002, 4068, 4136, 4205, 4275, 4343, 4412, 4480, 4551, 
-        4623, 4695, 4769, 4843, 4917, 4992, 5066, 5141, 5217, 5294, 5373, 5453, 
-        5531, 5610, 5689, 5769, 5850, 5934, 6017, 6102, 6186, 6271, 6356, 6440, 
-        6525, 6613, 6702, 6791, 6882, 6970, 7059, 7150, 7240, 7334, 7428, 7522, 
-        7617, 7712, 7807, 7901, 7998, 8095, 8195, 8296, 8396, 8494, 8594, 8694, 
-        8796, 8901, 9004, 9109, 9215, 9320, 9426, 9531, 9637, 9746, 9857, 9967, 
-        10077, 10186, 10297, 10408, 10520, 10635, 10750, 10865, 10982, 11098, 11215, 11331, 
-        11447, 11567, 11688, 11810, 11931, 12051, 12172, 12294, 12418, 12544, 12669, 12796, 
-        12923, 13050, 13177, 13305, 13432, 13559, 13687, 13817, 13944, 14071, 14197, 14324, 
-        14452, 14579, 14708, 14836, 14963, 15091, 15218, 15343, 15470, 15597, 15726, 15853, 
-        15980, 16105, 16231, 16356, 16482, 16609, 16736, 16863, 16988, 17114, 17238, 17362, 
-        17487, 17611, 17739, 17864, 17990, 18112, 18235, 18357, 18483, 18607, 18731, 18855, 
-        18979, 19101, 19222, 19343, 19466, 19587, 19711, 19833, 19954, 20075, 20194, 20314, 
-        20435, 20556, 20677, 20796, 20917, 21035, 21155, 21273, 21389, 21509, 21628, 21746, 
-        21864, 21979, 22095, 22212, 22328, 22445, 22561, 22678, 22794, 22909, 23022, 23136, 
-        23249, 23364, 23478, 23593, 23706, 23818, 23930, 24040, 24152, 24264, 24376, 24486, 
-        24598, 24709, 24819, 24929, 25037, 25146, 25255, 25363, 25471, 25580, 22585, 10179, 
-        -10056, -26714, -32767, -30959, -27136, -24860, -24527, -25019, -25345, -25215, -24813, -24389, 
-        -24066, -23827, -23612, -23384, -23137, -22885, -22635, -22395, -22160, -21928, -21699, -21472, 
-        -21247, -21025, -20804, -20585, -20371, -20160, -19951, -19744, -19540, -19335, -19136, -18936, 
-        -18741, -18548, -18359, -18170, -17983, -17799, -17616, -17435, -17256, -17082, -16908, -16737, 
-        -16566, -16399, -16231, -16066, -15904, -15744, -15585, -15429, -15273, -15121, -14968, -14817, 
-        -14669, -14523, -14380, -14236, -14095, -13955, -13816, -13678, -13542, -13409, -13276, -13146, 
-        -13017, -12889, -12762, -12636, -12512, -12390, -12270, -12151, -12033, -11915, -11798, -11683, 
-        -11568, -11457, -11346, -11237, -11128, -11018, -10909, -10800, -10693, -10587, -10483, -10378, 
-        -10274, -10170, -10065, -9961, -9860, -9758, -9657, -9559, -9459, -9360, -9261, -9162, 
-        -9064, -8969, -8874, -8778, -8685, -8589, -8495, -8402, -8309, -8217, -8126, -8037, 
-        -7948, -7857, -7768, -7679, -7591, -7505, -7420, -7334, -7248, -7163, -7078, -6994, 
-        -6911, -6827, -6747, -6666, -6585, -6505, -6424, -6344, -6265, -6188, -6112, -6035, 
-        -5958, -5882, -5807, -5731, -5655, -5581, -5509, -5438, -5365, -5294, -5221, -5150, 
-        -5079, -5011, -4943, -4875, -4807, -4739, -4671, -4604, -4538, -4473, -4408, -4344, 
-        -4281, -4217, -4154, -4090, -4028, -3968, -3907, -3847, -3786, -3727, -3667, -3608, 
-        -3549, -3491, -3435, -3379, -3323, -3268, -3212, -3156, -3101, -3048, -2997, -2944, 
-        -2891, -2840, -2787, -2735, -2684, -2634, -2585, -2537, -2489, -2440, -2392, -2344, 
-        -2295, -2250, -2206, -2161, -2115, -2070, -2024, -1981, -1937, -1893, -1852, -1810, 
-        -1769, -1728, -1686, -1645, -1604, -1566, -1527, -1489, -1451, -1412, -1374, -1336, 
-        -1300, -1264, -1227, -1194, -1159, -1125, -1090, -1054, -1020, -989, -957, -925, 
-        -893, -861, -830, -798, -768, -737, -709, -680, -653, -624, -595, -567, 
-        -539, -514, -488, -461, -435, -409, -384, -358, -334, -310, -287, -264, 
-        -241, -219, -196, -172, -151, -131, -110, -90, -71, -49, -30, -10 
-    };
-
-    // AKWF_saw_0023 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0023[600] PROGMEM = {
-        20, 43, 65, 89, 111, 132, 153, 173, 193, 213, 234, 254, 
-        273, 292, 312, 329, 347, 364, 381, 399, 419, 436, 456, 473, 
-        494, 515, 537, 560, 582, 606, 630, 653, 677, 701, 728, 754, 
-        783, 809, 838, 864, 894, 924, 955, 986, 1019, 1050, 1083, 1115, 
-        1148, 1182, 1218, 1254, 1291, 1328, 1364, 1401, 1438, 1478, 1517, 1558, 
-        1598, 1640, 1682, 1723, 1765, 1808, 1852, 1897, 1943, 1989, 2034, 2080, 
-        2126, 2175, 2222, 2273, 2322, 2372, 2423, 2473, 2524, 2576, 2630, 2683, 
-        2738, 2793, 2846, 2901, 2956, 3014, 3071, 3130, 3188, 3248, 3307, 3366, 
-        3426, 3487, 3549, 3612, 3676, 3739, 3803, 3866, 3931, 3997, 4063, 4130, 
-        4199, 4267, 4335, 4404, 4472, 4542, 4613, 4684, 4757, 4830, 4903, 4974, 
-        5049, 5123, 5199, 5276, 5352, 5429, 5508, 5585, 5662, 5741, 5821, 5901, 
-        5983, 6065, 6147, 6228, 6310, 6395, 6479, 6564, 6650, 6736, 6823, 6910, 
-        6996, 7084, 7173, 7264, 7355, 7445, 7534, 7625, 7717, 7811, 7904, 7998, 
-        8093, 8187, 8283, 8378, 8476, 8574, 8673, 8772, 8870, 8970, 9069, 9169, 
-        9270, 9372, 9475, 9577, 9683, 9787, 9892, 9996, 10102, 10207, 10314, 10423, 
-        10531, 10641, 10750, 10858, 10968, 11080, 11191, 11304, 11417, 11531, 11644, 11759, 
-        11873, 11988, 12105, 12222, 12341, 12459, 12576, 12693, 12814, 12934, 13054, 13176, 
-        13300, 13423, 13545, 13667, 13787, 13909, 14032, 14154, 14277, 14399, 14519, 14640, 
-        14760, 14882, 15004, 15126, 15246, 15368, 15488, 15607, 15726, 15846, 15965, 16086, 
-        16206, 16326, 16444, 16561, 16680, 16799, 16916, 17035, 17152, 17271, 17389, 17505, 
-        17620, 17736, 17854, 17970, 18087, 18203, 18317, 18430, 18545, 18661, 18775, 18889, 
-        19004, 19117, 19230, 19343, 19454, 19566, 19678, 19791, 19903, 20014, 20124, 20234, 
-        20344, 20454, 20564, 20674, 20784, 20892, 21001, 21108, 21215, 21322, 21429, 21536, 
-        21644, 21750, 21855, 21959, 22065, 22169, 22274, 22378, 22482, 22586, 22689, 22791, 
-        22892, 22995, 23096, 23198, 23300, 23401, 23499, 23598, 23698, 23797, 23895, 23995, 
-        24093, 24191, 24288, 24384, 24481, 24576, 24672, 24768, 24864, 24959, 25051, 25145, 
-        25239, 25332, 25424, 25518, 22516, 10126, -10075, -26710, -32767, -30981, -27185, -24932, 
-        -24615, -25121, -25464, -25352, -24967, -24561, -24253, -24028, -23827, -23612, -23380, -23142, 
-        -22909, -22683, -22461, -22242, -22023, -21808, -21595, -21386, -21178, -20971, -20768, -20565, 
-        -20366, -20169, -19974, -19782, -19592, -19404, -19218, -19032, -18849, -18668, -18491, -18316, 
-        -18141, -17968, -17797, -17628, -17460, -17295, -17132, -16970, -16811, -16653, -16496, -16341, 
-        -16187, -16035, -15885, -15738, -15591, -15447, -15303, -15160, -15019, -14879, -14741, -14606, 
-        -14470, -14338, -14206, -14075, -13944, -13817, -13690, -13567, -13442, -13320, -13199, -13078, 
-        -12958, -12840, -12725, -12609, -12496, -12383, -12271, -12160, -12050, -11941, -11834, -11729, 
-        -11622, -11517, -11411, -11307, -11203, -11099, -10996, -10894, -10793, -10692, -10592, -10491, 
-        -10390, -10291, -10193, -10096, -9999, -9901, -9805, -9710, -9613, -9518, -9423, -9329, 
-        -9237, -9144, -9053, -8961, -8869, -8778, -8687, -8598, -8509, -8420, -8332, -8243, 
-        -8155, -8069, -7983, -7897, -7812, -7729, -7644, -7560, -7476, -7393, -7311, -7230, 
-        -7150, -7068, -6988, -6907, -6827, -6748, -6670, -6592, -6515, -6439, -6362, -6286, 
-        -6209, -6135, -6060, -5988, -5913, -5840, -5768, -5695, -5622, -5551, -5479, -5410, 
-        -5341, -5271, -5203, -5133, -5065, -4996, -4930, -4864, -4799, -4732, -4667, -4601, 
-        -4536, -4472, -4408, -4346, -4283, -4222, -4160, -4099, -4037, -3976, -3916, -3858, 
-        -3799, -3739, -3682, -3624, -3566, -3508, -3451, -3396, -3341, -3286, -3231, -3176, 
-        -3121, -3068, -3014, -2962, -2910, -2858, -2806, -2756, -2704, -2653, -2604, -2555, 
-        -2506, -2459, -2410, -2362, -2313, -2267, -2221, -2175, -2130, -2084, -2040, -1994, 
-        -1949, -1906, -1861, -1820, -1778, -1735, -1693, -1652, -1610, -1569, -1530, -1490, 
-        -1451, -1413, -1374, -1334, -1297, -1258, -1221, -1185, -1148, -1114, -1077, -1041, 
-        -1005, -971, -937, -904, -872, -838, -805, -772, -739, -708, -676, -646, 
-        -616, -586, -555, -526, -496, -466, -438, -411, -383, -356, -328, -301, 
-        -273, -246, -221, -196, -170, -147, -121, -96, -71, -47, -25, -2 
-    };
-
-    // AKWF_saw_0024 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0024[600] PROGMEM = {
-        17, 50, 84, 119, 151, 183, 216, 249, 282, 313, 346, 379, 
-        410, 441, 473, 506, 539, 573, 607, 643, 678, 714, 750, 788, 
-        825, 864, 905, 944, 983, 1024, 1065, 1107, 1150, 1192, 1236, 1281, 
-        1325, 1369, 1414, 1460, 1507, 1554, 1602, 1651, 1698, 1747, 1795, 1845, 
-        1897, 1949, 2000, 2052, 2105, 2157, 2210, 2264, 2318, 2373, 2430, 2486, 
-        2541, 2597, 2655, 2713, 2771, 2831, 2890, 2951, 3011, 3071, 3132, 3193, 
-        3255, 3318, 3382, 3447, 3509, 3574, 3638, 3704, 3769, 3837, 3904, 3972, 
-        4039, 4106, 4175, 4244, 4313, 4384, 4456, 4526, 4597, 4669, 4741, 4813, 
-        4887, 4962, 5035, 5111, 5186, 5261, 5336, 5411, 5488, 5567, 5645, 5723, 
-        5802, 5880, 5958, 6038, 6120, 6201, 6283, 6364, 6447, 6529, 6612, 6695, 
-        6778, 6862, 6949, 7033, 7119, 7204, 7290, 7376, 7464, 7552, 7641, 7730, 
-        7820, 7908, 7997, 8086, 8177, 8269, 8362, 8453, 8545, 8638, 8730, 8824, 
-        8918, 9012, 9108, 9203, 9299, 9394, 9490, 9587, 9684, 9783, 9882, 9980, 
-        10078, 10176, 10277, 10377, 10477, 10579, 10681, 10783, 10885, 10986, 11088, 11192, 
-        11295, 11400, 11505, 11610, 11715, 11820, 11925, 12032, 12140, 12246, 12354, 12462, 
-        12572, 12680, 12788, 12898, 13008, 13117, 13230, 13341, 13451, 13562, 13675, 13788, 
-        13901, 14014, 14128, 14242, 14357, 14471, 14586, 14701, 14817, 14933, 15048, 15164, 
-        15277, 15391, 15504, 15618, 15732, 15845, 15958, 16071, 16184, 16295, 16406, 16517, 
-        16627, 16740, 16851, 16961, 17069, 17179, 17287, 17396, 17505, 17613, 17721, 17829, 
-        17935, 18042, 18149, 18254, 18360, 18465, 18572, 18677, 18780, 18882, 18985, 19089, 
-        19192, 19296, 19397, 19499, 19601, 19701, 19800, 19900, 20001, 20101, 20200, 20298, 
-        20397, 20494, 20591, 20688, 20784, 20880, 20977, 21072, 21166, 21262, 21356, 21450, 
-        21544, 21636, 21729, 21821, 21912, 22003, 22094, 22185, 22276, 22365, 22454, 22544, 
-        22633, 22721, 22807, 22893, 22981, 23067, 23155, 23239, 23324, 23409, 23493, 23576, 
-        23659, 23744, 23827, 23908, 23991, 24071, 24153, 24233, 24313, 24393, 24472, 24551, 
-        24629, 24706, 24784, 24861, 24938, 25015, 25090, 25167, 25242, 25315, 25389, 22382, 
-        10027, -10111, -26704, -32767, -31020, -27271, -25055, -24772, -25306, -25676, -25593, -25236, 
-        -24859, -24581, -24383, -24209, -24023, -23816, -23603, -23394, -23192, -22996, -22802, -22608, 
-        -22415, -22224, -22036, -21850, -21665, -21483, -21303, -21124, -20945, -20770, -20596, -20424, 
-        -20254, -20087, -19919, -19755, -19590, -19429, -19267, -19109, -18951, -18796, -18642, -18490, 
-        -18338, -18188, -18039, -17893, -17747, -17603, -17461, -17320, -17180, -17041, -16903, -16767, 
-        -16632, -16499, -16367, -16237, -16107, -15978, -15850, -15723, -15599, -15475, -15353, -15231, 
-        -15110, -14991, -14872, -14755, -14639, -14524, -14412, -14299, -14186, -14075, -13965, -13855, 
-        -13747, -13641, -13536, -13431, -13326, -13222, -13119, -13016, -12914, -12812, -12712, -12611, 
-        -12511, -12409, -12309, -12210, -12111, -12013, -11916, -11817, -11720, -11623, -11525, -11428, 
-        -11333, -11237, -11142, -11048, -10954, -10858, -10764, -10671, -10579, -10487, -10394, -10303, 
-        -10211, -10120, -10029, -9938, -9849, -9760, -9670, -9582, -9495, -9405, -9318, -9230, 
-        -9144, -9058, -8973, -8887, -8801, -8716, -8631, -8547, -8462, -8379, -8298, -8215, 
-        -8132, -8050, -7967, -7886, -7806, -7726, -7646, -7566, -7486, -7408, -7329, -7249, 
-        -7173, -7094, -7019, -6942, -6866, -6789, -6712, -6637, -6563, -6489, -6414, -6341, 
-        -6267, -6193, -6121, -6048, -5977, -5905, -5835, -5764, -5694, -5623, -5552, -5482, 
-        -5415, -5346, -5278, -5209, -5142, -5075, -5007, -4940, -4874, -4808, -4744, -4678, 
-        -4614, -4550, -4484, -4421, -4359, -4296, -4233, -4171, -4109, -4047, -3986, -3925, 
-        -3863, -3804, -3744, -3685, -3627, -3567, -3508, -3450, -3393, -3337, -3279, -3223, 
-        -3166, -3110, -3055, -2998, -2944, -2889, -2836, -2782, -2729, -2676, -2622, -2569, 
-        -2517, -2466, -2416, -2364, -2312, -2262, -2212, -2162, -2113, -2063, -2016, -1967, 
-        -1919, -1870, -1823, -1776, -1729, -1684, -1638, -1593, -1548, -1502, -1457, -1411, 
-        -1367, -1324, -1281, -1239, -1195, -1153, -1110, -1068, -1027, -987, -946, -905, 
-        -864, -824, -785, -744, -706, -667, -629, -592, -553, -515, -477, -440, 
-        -404, -368, -332, -296, -260, -224, -189, -153, -119, -84, -51, -17 
-    };
-
-} // namespace AKWF_BwSaw
@@ -1,1304 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwSaw {
-
-    // AKWF_saw_0025 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0025[600] PROGMEM = {
-        52, 104, 157, 208, 259, 310, 361, 413, 466, 517, 568, 621, 
-        674, 729, 783, 840, 896, 954, 1010, 1068, 1126, 1184, 1244, 1304, 
-        1365, 1427, 1487, 1548, 1610, 1673, 1736, 1799, 1864, 1929, 1994, 2059, 
-        2123, 2188, 2255, 2323, 2392, 2458, 2526, 2595, 2663, 2731, 2801, 2871, 
-        2943, 3015, 3085, 3156, 3228, 3300, 3372, 3445, 3520, 3594, 3667, 3740, 
-        3814, 3889, 3966, 4041, 4118, 4195, 4271, 4348, 4425, 4502, 4579, 4659, 
-        4737, 4816, 4895, 4975, 5053, 5134, 5214, 5296, 5376, 5458, 5540, 5622, 
-        5702, 5786, 5868, 5951, 6035, 6119, 6202, 6286, 6370, 6455, 6539, 6624, 
-        6711, 6797, 6882, 6969, 7054, 7141, 7229, 7316, 7404, 7491, 7579, 7666, 
-        7754, 7843, 7932, 8022, 8111, 8202, 8292, 8381, 8472, 8562, 8652, 8745, 
-        8837, 8927, 9018, 9110, 9202, 9294, 9387, 9481, 9574, 9667, 9761, 9854, 
-        9947, 10041, 10134, 10230, 10326, 10421, 10515, 10609, 10705, 10800, 10896, 10993, 
-        11089, 11186, 11284, 11379, 11476, 11572, 11669, 11768, 11867, 11965, 12062, 12159, 
-        12258, 12356, 12455, 12556, 12655, 12754, 12853, 12952, 13052, 13153, 13252, 13353, 
-        13454, 13554, 13655, 13756, 13857, 13957, 14060, 14160, 14263, 14365, 14468, 14570, 
-        14671, 14773, 14876, 14980, 15082, 15187, 15289, 15392, 15496, 15598, 15702, 15806, 
-        15912, 16016, 16121, 16225, 16329, 16433, 16539, 16643, 16749, 16853, 16955, 17058, 
-        17160, 17263, 17365, 17466, 17567, 17667, 17768, 17867, 17966, 18064, 18163, 18260, 
-        18359, 18455, 18550, 18646, 18741, 18837, 18931, 19025, 19119, 19213, 19305, 19397, 
-        19488, 19580, 19670, 19761, 19851, 19940, 20029, 20116, 20205, 20292, 20379, 20466, 
-        20553, 20638, 20724, 20807, 20891, 20975, 21058, 21142, 21224, 21306, 21386, 21466, 
-        21547, 21627, 21707, 21786, 21866, 21944, 22021, 22098, 22175, 22250, 22327, 22402, 
-        22477, 22552, 22626, 22697, 22771, 22844, 22916, 22988, 23059, 23131, 23201, 23269, 
-        23339, 23408, 23476, 23544, 23613, 23681, 23746, 23812, 23877, 23944, 24009, 24074, 
-        24137, 24202, 24265, 24326, 24388, 24449, 24512, 24574, 24634, 24695, 24753, 24813, 
-        24871, 24929, 24987, 25045, 25103, 25159, 25216, 22209, 9904, -10153, -26696, -32767, 
-        -31064, -27365, -25197, -24949, -25518, -25923, -25873, -25550, -25209, -24963, -24799, -24657, 
-        -24504, -24330, -24149, -23969, -23799, -23631, -23466, -23302, -23140, -22976, -22815, -22655, 
-        -22498, -22342, -22187, -22033, -21883, -21731, -21582, -21434, -21287, -21142, -20999, -20857, 
-        -20715, -20573, -20435, -20297, -20160, -20024, -19889, -19757, -19624, -19494, -19365, -19235, 
-        -19107, -18979, -18854, -18729, -18607, -18484, -18362, -18241, -18122, -18002, -17884, -17768, 
-        -17652, -17538, -17423, -17309, -17196, -17085, -16976, -16867, -16757, -16650, -16542, -16435, 
-        -16329, -16225, -16121, -16016, -15914, -15813, -15713, -15612, -15511, -15412, -15315, -15217, 
-        -15122, -15024, -14927, -14830, -14734, -14637, -14541, -14446, -14352, -14256, -14162, -14067, 
-        -13971, -13877, -13783, -13689, -13595, -13503, -13409, -13315, -13221, -13129, -13037, -12945, 
-        -12853, -12762, -12670, -12578, -12487, -12395, -12305, -12214, -12125, -12035, -11944, -11856, 
-        -11765, -11676, -11586, -11497, -11408, -11321, -11232, -11145, -11056, -10969, -10882, -10795, 
-        -10708, -10621, -10534, -10449, -10362, -10276, -10191, -10105, -10020, -9936, -9851, -9766, 
-        -9680, -9597, -9513, -9431, -9347, -9264, -9180, -9098, -9014, -8933, -8851, -8769, 
-        -8687, -8606, -8524, -8444, -8362, -8282, -8202, -8121, -8043, -7963, -7882, -7804, 
-        -7725, -7645, -7567, -7490, -7411, -7334, -7256, -7179, -7100, -7024, -6947, -6872, 
-        -6795, -6720, -6643, -6568, -6493, -6416, -6342, -6267, -6194, -6119, -6045, -5972, 
-        -5897, -5823, -5752, -5680, -5607, -5535, -5463, -5390, -5318, -5246, -5176, -5105, 
-        -5035, -4965, -4895, -4825, -4755, -4685, -4616, -4546, -4478, -4410, -4341, -4273, 
-        -4205, -4136, -4070, -4003, -3937, -3870, -3804, -3737, -3670, -3605, -3541, -3476, 
-        -3411, -3346, -3281, -3218, -3153, -3090, -3025, -2964, -2900, -2837, -2776, -2713, 
-        -2649, -2588, -2526, -2467, -2405, -2345, -2284, -2223, -2163, -2103, -2043, -1985, 
-        -1925, -1867, -1809, -1750, -1692, -1633, -1575, -1519, -1463, -1405, -1348, -1292, 
-        -1236, -1179, -1123, -1068, -1012, -957, -903, -848, -793, -739, -684, -631, 
-        -578, -525, -471, -418, -365, -312, -259, -208, -155, -104, -51, 0 
-    };
-
-    // AKWF_saw_0026 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0026[600] PROGMEM = {
-        9, 95, 181, 268, 354, 440, 529, 617, 705, 793, 883, 973, 
-        1063, 1153, 1245, 1335, 1427, 1519, 1611, 1703, 1795, 1887, 1979, 2073, 
-        2165, 2258, 2350, 2444, 2536, 2630, 2722, 2816, 2909, 3003, 3095, 3189, 
-        3281, 3375, 3468, 3562, 3656, 3750, 3844, 3937, 4031, 4123, 4217, 4311, 
-        4406, 4500, 4594, 4688, 4780, 4874, 4967, 5061, 5157, 5251, 5345, 5438, 
-        5532, 5626, 5718, 5812, 5907, 6001, 6095, 6189, 6281, 6374, 6468, 6562, 
-        6656, 6752, 6845, 6937, 7031, 7125, 7219, 7313, 7406, 7500, 7594, 7686, 
-        7780, 7872, 7965, 8059, 8153, 8247, 8339, 8433, 8526, 8618, 8712, 8806, 
-        8900, 8992, 9085, 9177, 9271, 9363, 9455, 9549, 9643, 9735, 9828, 9920, 
-        10014, 10106, 10198, 10290, 10384, 10476, 10569, 10661, 10753, 10845, 10937, 11029, 
-        11123, 11215, 11307, 11399, 11491, 11583, 11674, 11766, 11858, 11950, 12042, 12134, 
-        12224, 12316, 12408, 12500, 12592, 12684, 12776, 12866, 12958, 13048, 13140, 13230, 
-        13322, 13414, 13504, 13596, 13686, 13776, 13868, 13958, 14050, 14140, 14232, 14322, 
-        14412, 14502, 14592, 14682, 14774, 14864, 14954, 15044, 15134, 15224, 15314, 15404, 
-        15494, 15584, 15674, 15764, 15853, 15943, 16033, 16121, 16211, 16301, 16391, 16479, 
-        16567, 16657, 16747, 16836, 16926, 17014, 17104, 17192, 17280, 17370, 17459, 17547, 
-        17637, 17725, 17813, 17901, 17989, 18078, 18166, 18254, 18342, 18432, 18520, 18609, 
-        18695, 18781, 18867, 18954, 19040, 19126, 19211, 19293, 19376, 19458, 19541, 19624, 
-        19706, 19787, 19867, 19946, 20025, 20104, 20183, 20260, 20338, 20415, 20492, 20567, 
-        20640, 20715, 20790, 20864, 20937, 21010, 21083, 21154, 21226, 21297, 21366, 21436, 
-        21505, 21575, 21644, 21712, 21777, 21845, 21910, 21978, 22044, 22109, 22173, 22237, 
-        22301, 22365, 22426, 22488, 22550, 22612, 22674, 22734, 22792, 22852, 22912, 22970, 
-        23029, 23087, 23145, 23201, 23258, 23314, 23368, 23425, 23479, 23533, 23588, 23640, 
-        23693, 23745, 23798, 23850, 23903, 23954, 24004, 24055, 24104, 24152, 24201, 24250, 
-        24299, 24348, 24394, 24441, 24486, 24533, 24578, 24625, 24670, 24715, 24760, 24803, 
-        24847, 24890, 24933, 24974, 25017, 22016, 9766, -10202, -26691, -32767, -31107, -27460, 
-        -25334, -25121, -25721, -26158, -26143, -25856, -25548, -25334, -25203, -25094, -24970, -24830, 
-        -24680, -24531, -24391, -24254, -24119, -23984, -23849, -23715, -23582, -23453, -23323, -23194, 
-        -23066, -22939, -22813, -22689, -22567, -22445, -22323, -22201, -22083, -21963, -21847, -21729, 
-        -21614, -21500, -21385, -21273, -21160, -21047, -20937, -20828, -20719, -20610, -20503, -20396, 
-        -20290, -20184, -20079, -19976, -19873, -19772, -19670, -19569, -19470, -19368, -19271, -19171, 
-        -19076, -18978, -18882, -18787, -18691, -18595, -18502, -18408, -18316, -18224, -18134, -18042, 
-        -17952, -17862, -17772, -17684, -17595, -17507, -17421, -17333, -17247, -17158, -17072, -16986, 
-        -16898, -16811, -16725, -16639, -16552, -16466, -16380, -16293, -16207, -16121, -16035, -15948, 
-        -15862, -15776, -15689, -15605, -15519, -15434, -15348, -15262, -15177, -15091, -15005, -14920, 
-        -14836, -14749, -14665, -14579, -14494, -14408, -14324, -14237, -14153, -14068, -13984, -13900, 
-        -13813, -13729, -13644, -13560, -13476, -13391, -13307, -13222, -13138, -13053, -12969, -12885, 
-        -12800, -12718, -12633, -12549, -12464, -12380, -12295, -12213, -12130, -12046, -11962, -11879, 
-        -11795, -11710, -11628, -11543, -11461, -11378, -11294, -11211, -11127, -11044, -10960, -10877, 
-        -10795, -10712, -10629, -10545, -10463, -10380, -10297, -10213, -10130, -10050, -9967, -9885, 
-        -9800, -9718, -9635, -9553, -9472, -9389, -9307, -9224, -9142, -9059, -8977, -8894, 
-        -8813, -8731, -8648, -8568, -8485, -8403, -8320, -8239, -8157, -8076, -7994, -7911, 
-        -7830, -7748, -7667, -7585, -7504, -7421, -7341, -7258, -7177, -7095, -7014, -6934, 
-        -6851, -6770, -6690, -6607, -6526, -6444, -6363, -6283, -6200, -6119, -6039, -5958, 
-        -5875, -5795, -5714, -5633, -5553, -5472, -5390, -5309, -5228, -5146, -5065, -4984, 
-        -4904, -4823, -4742, -4662, -4579, -4498, -4418, -4337, -4256, -4176, -4095, -4012, 
-        -3932, -3851, -3769, -3688, -3607, -3527, -3446, -3365, -3283, -3202, -3121, -3041, 
-        -2960, -2879, -2797, -2716, -2634, -2553, -2470, -2390, -2309, -2226, -2146, -2065, 
-        -1983, -1900, -1817, -1737, -1654, -1574, -1491, -1408, -1326, -1243, -1161, -1078, 
-        -996, -913, -831, -748, -664, -579, -495, -412, -328, -245, -159, -75 
-    };
-
-    // AKWF_saw_0027 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0027[600] PROGMEM = {
-        37, 167, 298, 432, 567, 705, 841, 976, 1114, 1249, 1383, 1516, 
-        1650, 1781, 1911, 2040, 2170, 2299, 2427, 2554, 2680, 2806, 2929, 3053, 
-        3176, 3298, 3419, 3541, 3661, 3780, 3900, 4017, 4135, 4252, 4370, 4486, 
-        4601, 4717, 4830, 4944, 5058, 5169, 5283, 5394, 5506, 5616, 5725, 5835, 
-        5946, 6054, 6164, 6271, 6379, 6487, 6592, 6700, 6805, 6911, 7017, 7122, 
-        7226, 7330, 7433, 7537, 7640, 7742, 7846, 7947, 8049, 8151, 8250, 8350, 
-        8452, 8551, 8651, 8751, 8850, 8948, 9045, 9143, 9243, 9340, 9436, 9534, 
-        9631, 9727, 9823, 9918, 10014, 10110, 10205, 10299, 10393, 10486, 10580, 10674, 
-        10767, 10861, 10955, 11046, 11140, 11232, 11323, 11413, 11505, 11596, 11688, 11780, 
-        11869, 11959, 12049, 12139, 12228, 12318, 12408, 12497, 12585, 12675, 12762, 12850, 
-        12938, 13025, 13113, 13201, 13286, 13374, 13460, 13546, 13633, 13719, 13807, 13892, 
-        13976, 14062, 14147, 14231, 14315, 14401, 14486, 14570, 14654, 14737, 14821, 14905, 
-        14986, 15070, 15154, 15238, 15319, 15401, 15483, 15564, 15646, 15730, 15812, 15893, 
-        15973, 16053, 16134, 16214, 16296, 16378, 16457, 16537, 16617, 16696, 16776, 16856, 
-        16934, 17013, 17093, 17173, 17250, 17328, 17406, 17486, 17563, 17641, 17719, 17797, 
-        17874, 17952, 18028, 18105, 18181, 18259, 18335, 18412, 18488, 18564, 18640, 18717, 
-        18793, 18869, 18944, 19020, 19094, 19170, 19243, 19319, 19393, 19469, 19542, 19618, 
-        19692, 19766, 19839, 19913, 19987, 20058, 20132, 20204, 20276, 20347, 20417, 20487, 
-        20557, 20626, 20694, 20762, 20830, 20896, 20961, 21029, 21095, 21159, 21224, 21288, 
-        21352, 21416, 21477, 21539, 21601, 21663, 21723, 21784, 21842, 21902, 21960, 22020, 
-        22077, 22135, 22193, 22249, 22305, 22360, 22416, 22470, 22524, 22580, 22633, 22685, 
-        22739, 22791, 22841, 22892, 22944, 22996, 23046, 23096, 23146, 23193, 23241, 23289, 
-        23337, 23385, 23433, 23478, 23524, 23570, 23616, 23660, 23706, 23749, 23793, 23837, 
-        23881, 23923, 23965, 24007, 24048, 24090, 24132, 24172, 24212, 24252, 24290, 24329, 
-        24369, 24407, 24445, 24483, 24521, 24559, 24594, 24630, 24666, 24702, 24738, 24774, 
-        24808, 24842, 24875, 21878, 9667, -10241, -26691, -32767, -31137, -27522, -25424, -25234, 
-        -25854, -26310, -26316, -26049, -25764, -25573, -25461, -25374, -25270, -25148, -25017, -24889, 
-        -24768, -24652, -24537, -24421, -24305, -24190, -24074, -23963, -23851, -23741, -23632, -23524, 
-        -23415, -23307, -23201, -23096, -22992, -22888, -22787, -22683, -22582, -22482, -22380, -22283, 
-        -22183, -22087, -21990, -21894, -21798, -21703, -21607, -21513, -21420, -21328, -21236, -21147, 
-        -21055, -20965, -20874, -20786, -20698, -20611, -20523, -20435, -20349, -20264, -20178, -20092, 
-        -20009, -19925, -19841, -19760, -19676, -19594, -19512, -19431, -19351, -19271, -19192, -19112, 
-        -19032, -18952, -18875, -18797, -18719, -18642, -18564, -18486, -18408, -18329, -18251, -18173, 
-        -18095, -18018, -17938, -17860, -17783, -17705, -17625, -17547, -17468, -17390, -17312, -17234, 
-        -17157, -17077, -16999, -16920, -16842, -16764, -16686, -16607, -16529, -16449, -16370, -16292, 
-        -16212, -16134, -16057, -15977, -15899, -15819, -15740, -15660, -15582, -15505, -15425, -15345, 
-        -15267, -15188, -15108, -15028, -14949, -14871, -14791, -14711, -14632, -14552, -14472, -14393, 
-        -14313, -14235, -14155, -14076, -13994, -13914, -13835, -13755, -13675, -13595, -13514, -13434, 
-        -13354, -13273, -13193, -13113, -13031, -12952, -12872, -12790, -12709, -12629, -12547, -12465, 
-        -12386, -12304, -12222, -12143, -12061, -11979, -11897, -11816, -11734, -11652, -11571, -11489, 
-        -11407, -11323, -11242, -11158, -11076, -10995, -10913, -10829, -10747, -10664, -10580, -10496, 
-        -10415, -10331, -10247, -10164, -10080, -9996, -9912, -9827, -9743, -9659, -9576, -9492, 
-        -9406, -9321, -9235, -9151, -9065, -8982, -8896, -8810, -8725, -8637, -8551, -8466, 
-        -8378, -8292, -8206, -8119, -8031, -7943, -7856, -7768, -7680, -7593, -7505, -7417, 
-        -7328, -7240, -7150, -7061, -6971, -6881, -6791, -6702, -6612, -6520, -6429, -6339, 
-        -6247, -6156, -6064, -5972, -5881, -5787, -5693, -5600, -5508, -5414, -5321, -5225, 
-        -5131, -5036, -4940, -4842, -4747, -4651, -4555, -4458, -4360, -4262, -4163, -4063, 
-        -3963, -3866, -3766, -3665, -3563, -3461, -3360, -3256, -3154, -3051, -2947, -2841, 
-        -2736, -2630, -2523, -2415, -2307, -2200, -2090, -1980, -1869, -1757, -1644, -1530, 
-        -1416, -1303, -1187, -1070, -950, -831, -711, -589, -466, -342, -219, -91 
-    };
-
-    // AKWF_saw_0028 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0028[600] PROGMEM = {
-        30, 208, 391, 578, 769, 959, 1148, 1333, 1514, 1690, 1865, 2038, 
-        2206, 2371, 2534, 2694, 2853, 3010, 3164, 3317, 3467, 3616, 3763, 3907, 
-        4050, 4190, 4333, 4472, 4608, 4745, 4879, 5012, 5144, 5275, 5405, 5534, 
-        5660, 5787, 5913, 6036, 6160, 6283, 6403, 6526, 6644, 6763, 6881, 6998, 
-        7114, 7231, 7345, 7460, 7574, 7686, 7797, 7907, 8018, 8128, 8239, 8347, 
-        8456, 8562, 8668, 8773, 8879, 8984, 9090, 9193, 9297, 9399, 9502, 9602, 
-        9703, 9805, 9905, 10006, 10104, 10203, 10301, 10397, 10496, 10592, 10689, 10785, 
-        10881, 10976, 11070, 11164, 11259, 11351, 11446, 11538, 11630, 11723, 11813, 11903, 
-        11996, 12086, 12177, 12267, 12355, 12444, 12534, 12620, 12709, 12797, 12883, 12972, 
-        13058, 13144, 13231, 13315, 13401, 13486, 13572, 13657, 13741, 13823, 13908, 13990, 
-        14074, 14157, 14239, 14321, 14404, 14486, 14566, 14647, 14729, 14809, 14889, 14970, 
-        15050, 15130, 15209, 15287, 15365, 15444, 15524, 15602, 15679, 15757, 15833, 15910, 
-        15988, 16064, 16141, 16217, 16293, 16369, 16444, 16520, 16594, 16669, 16745, 16819, 
-        16894, 16968, 17040, 17114, 17187, 17261, 17333, 17408, 17480, 17552, 17625, 17695, 
-        17767, 17839, 17912, 17982, 18054, 18125, 18195, 18265, 18335, 18406, 18476, 18544, 
-        18614, 18685, 18753, 18821, 18890, 18958, 19028, 19096, 19165, 19231, 19299, 19368, 
-        19434, 19502, 19568, 19637, 19703, 19769, 19835, 19902, 19968, 20034, 20100, 20165, 
-        20231, 20295, 20362, 20426, 20490, 20556, 20621, 20685, 20749, 20813, 20876, 20938, 
-        21000, 21062, 21125, 21187, 21247, 21305, 21366, 21424, 21482, 21542, 21599, 21657, 
-        21713, 21769, 21825, 21880, 21936, 21990, 22044, 22099, 22151, 22205, 22255, 22307, 
-        22360, 22410, 22462, 22512, 22562, 22611, 22659, 22707, 22755, 22803, 22852, 22898, 
-        22946, 22990, 23036, 23082, 23127, 23171, 23217, 23259, 23303, 23346, 23390, 23432, 
-        23472, 23514, 23556, 23597, 23639, 23677, 23717, 23757, 23795, 23834, 23874, 23912, 
-        23950, 23986, 24022, 24060, 24097, 24133, 24169, 24203, 24239, 24273, 24307, 24342, 
-        24376, 24408, 24442, 24474, 24508, 24540, 24572, 24603, 24635, 24665, 24697, 24727, 
-        24757, 24787, 21791, 9606, -10267, -26691, -32767, -31153, -27557, -25474, -25295, -25928, 
-        -26398, -26414, -26161, -25886, -25705, -25607, -25530, -25440, -25330, -25211, -25095, -24984, 
-        -24880, -24773, -24669, -24564, -24462, -24360, -24257, -24155, -24056, -23958, -23860, -23761, 
-        -23665, -23568, -23474, -23380, -23285, -23193, -23101, -23008, -22918, -22827, -22737, -22649, 
-        -22558, -22472, -22386, -22299, -22213, -22127, -22042, -21958, -21874, -21789, -21707, -21625, 
-        -21544, -21462, -21382, -21299, -21221, -21141, -21062, -20984, -20906, -20827, -20751, -20673, 
-        -20596, -20520, -20446, -20370, -20295, -20221, -20147, -20072, -19998, -19926, -19853, -19781, 
-        -19709, -19639, -19566, -19494, -19422, -19349, -19277, -19205, -19133, -19060, -18988, -18916, 
-        -18843, -18771, -18699, -18627, -18552, -18480, -18408, -18333, -18261, -18189, -18114, -18042, 
-        -17970, -17896, -17823, -17749, -17677, -17602, -17530, -17456, -17382, -17309, -17235, -17161, 
-        -17086, -17012, -16940, -16865, -16791, -16717, -16643, -16568, -16492, -16418, -16345, -16269, 
-        -16195, -16120, -16044, -15970, -15894, -15819, -15743, -15669, -15594, -15518, -15442, -15365, 
-        -15289, -15215, -15138, -15062, -14986, -14910, -14833, -14757, -14679, -14602, -14526, -14450, 
-        -14373, -14295, -14219, -14140, -14062, -13986, -13908, -13829, -13751, -13673, -13594, -13516, 
-        -13438, -13359, -13281, -13203, -13122, -13044, -12964, -12883, -12805, -12725, -12644, -12566, 
-        -12486, -12403, -12323, -12243, -12162, -12080, -12000, -11918, -11837, -11755, -11673, -11590, 
-        -11508, -11426, -11343, -11261, -11179, -11094, -11010, -10928, -10843, -10759, -10675, -10590, 
-        -10506, -10421, -10335, -10249, -10162, -10078, -9992, -9905, -9819, -9733, -9644, -9556, 
-        -9470, -9381, -9293, -9205, -9116, -9026, -8938, -8847, -8757, -8666, -8576, -8486, 
-        -8393, -8301, -8211, -8116, -8024, -7931, -7837, -7743, -7648, -7554, -7460, -7363, 
-        -7267, -7170, -7074, -6978, -6879, -6781, -6680, -6582, -6482, -6381, -6281, -6180, 
-        -6078, -5976, -5871, -5767, -5662, -5558, -5451, -5347, -5239, -5130, -5022, -4913, 
-        -4803, -4690, -4580, -4468, -4355, -4241, -4124, -4008, -3889, -3773, -3652, -3532, 
-        -3411, -3287, -3164, -3038, -2911, -2783, -2654, -2522, -2389, -2255, -2120, -1981, 
-        -1841, -1700, -1556, -1409, -1261, -1110, -955, -801, -640, -477, -313, -142 
-    };
-
-    // AKWF_saw_0029 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0029[600] PROGMEM = {
-        208, 540, 886, 1230, 1561, 1872, 2160, 2429, 2685, 2933, 3173, 3402, 
-        3626, 3840, 4049, 4251, 4449, 4641, 4831, 5014, 5194, 5369, 5542, 5711, 
-        5875, 6038, 6199, 6357, 6511, 6664, 6814, 6960, 7106, 7250, 7391, 7531, 
-        7669, 7804, 7940, 8071, 8202, 8332, 8459, 8586, 8711, 8836, 8957, 9078, 
-        9199, 9318, 9435, 9552, 9668, 9781, 9896, 10006, 10119, 10227, 10338, 10446, 
-        10554, 10661, 10765, 10869, 10974, 11076, 11180, 11280, 11382, 11482, 11580, 11678, 
-        11776, 11874, 11970, 12066, 12162, 12256, 12350, 12442, 12535, 12627, 12719, 12809, 
-        12900, 12990, 13078, 13167, 13255, 13340, 13428, 13515, 13601, 13686, 13770, 13855, 
-        13939, 14022, 14105, 14187, 14270, 14352, 14433, 14512, 14593, 14673, 14752, 14831, 
-        14908, 14988, 15065, 15142, 15219, 15294, 15371, 15446, 15521, 15598, 15671, 15746, 
-        15819, 15892, 15965, 16038, 16111, 16184, 16255, 16326, 16397, 16468, 16539, 16610, 
-        16679, 16749, 16818, 16887, 16956, 17023, 17091, 17160, 17227, 17294, 17360, 17427, 
-        17492, 17558, 17625, 17690, 17754, 17821, 17886, 17948, 18013, 18076, 18140, 18203, 
-        18267, 18330, 18393, 18453, 18516, 18578, 18639, 18701, 18762, 18822, 18883, 18943, 
-        19003, 19062, 19122, 19183, 19241, 19300, 19358, 19416, 19475, 19533, 19591, 19650, 
-        19706, 19765, 19821, 19877, 19933, 19990, 20046, 20102, 20159, 20215, 20269, 20325, 
-        20380, 20434, 20488, 20544, 20599, 20653, 20707, 20759, 20813, 20866, 20920, 20972, 
-        21026, 21078, 21130, 21182, 21235, 21285, 21337, 21389, 21441, 21493, 21543, 21593, 
-        21643, 21695, 21745, 21795, 21846, 21896, 21944, 21994, 22042, 22089, 22137, 22183, 
-        22231, 22277, 22323, 22369, 22413, 22459, 22502, 22546, 22590, 22634, 22675, 22717, 
-        22759, 22801, 22842, 22884, 22926, 22965, 23005, 23044, 23082, 23122, 23159, 23199, 
-        23236, 23274, 23309, 23347, 23382, 23418, 23453, 23489, 23524, 23560, 23593, 23628, 
-        23662, 23693, 23726, 23760, 23793, 23824, 23856, 23887, 23918, 23949, 23981, 24010, 
-        24041, 24070, 24100, 24129, 24158, 24185, 24214, 24241, 24271, 24298, 24325, 24352, 
-        24377, 24404, 24431, 24456, 24481, 24508, 24533, 24556, 24581, 24606, 24629, 24654, 
-        21664, 9514, -10302, -26691, -32767, -31174, -27605, -25545, -25384, -26030, -26516, -26550, 
-        -26314, -26058, -25893, -25811, -25751, -25676, -25582, -25480, -25382, -25288, -25196, -25109, 
-        -25019, -24929, -24842, -24754, -24667, -24583, -24498, -24412, -24329, -24246, -24164, -24083, 
-        -24004, -23922, -23843, -23764, -23685, -23607, -23530, -23453, -23378, -23303, -23226, -23153, 
-        -23078, -23005, -22932, -22859, -22786, -22715, -22642, -22571, -22500, -22431, -22361, -22292, 
-        -22223, -22154, -22087, -22019, -21950, -21883, -21816, -21750, -21685, -21618, -21554, -21487, 
-        -21422, -21358, -21293, -21228, -21166, -21103, -21039, -20976, -20913, -20851, -20788, -20726, 
-        -20663, -20601, -20536, -20474, -20411, -20346, -20284, -20221, -20157, -20094, -20031, -19967, 
-        -19902, -19838, -19775, -19710, -19648, -19583, -19519, -19454, -19389, -19325, -19260, -19195, 
-        -19131, -19066, -18999, -18935, -18868, -18803, -18739, -18674, -18607, -18541, -18476, -18409, 
-        -18342, -18276, -18209, -18142, -18078, -18011, -17944, -17875, -17809, -17742, -17673, -17606, 
-        -17540, -17471, -17404, -17335, -17267, -17198, -17129, -17062, -16993, -16925, -16856, -16785, 
-        -16716, -16647, -16576, -16508, -16439, -16368, -16297, -16226, -16155, -16084, -16013, -15942, 
-        -15872, -15801, -15730, -15657, -15584, -15513, -15440, -15369, -15296, -15223, -15150, -15075, 
-        -15002, -14929, -14854, -14781, -14706, -14633, -14558, -14483, -14406, -14331, -14256, -14181, 
-        -14103, -14028, -13951, -13874, -13797, -13720, -13643, -13563, -13486, -13407, -13330, -13251, 
-        -13171, -13090, -13011, -12932, -12852, -12771, -12690, -12608, -12527, -12444, -12362, -12279, 
-        -12198, -12114, -12029, -11945, -11860, -11776, -11691, -11605, -11520, -11434, -11347, -11259, 
-        -11172, -11084, -10997, -10907, -10817, -10728, -10638, -10548, -10456, -10365, -10273, -10181, 
-        -10087, -9994, -9900, -9804, -9708, -9612, -9516, -9418, -9320, -9222, -9124, -9024, 
-        -8922, -8822, -8720, -8617, -8513, -8411, -8305, -8198, -8092, -7984, -7875, -7767, 
-        -7656, -7546, -7433, -7320, -7204, -7089, -6974, -6855, -6737, -6618, -6495, -6372, 
-        -6249, -6121, -5994, -5867, -5738, -5604, -5471, -5335, -5198, -5058, -4916, -4774, 
-        -4629, -4480, -4328, -4174, -4018, -3859, -3696, -3530, -3361, -3188, -3010, -2829, 
-        -2641, -2450, -2254, -2051, -1841, -1622, -1397, -1161, -915, -658, -385, -98 
-    };
-
-    // AKWF_saw_0030 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0030[600] PROGMEM = {
-        348, 1012, 1669, 2256, 2750, 3158, 3511, 3837, 4149, 4445, 4725, 4991, 
-        5242, 5483, 5715, 5941, 6156, 6364, 6568, 6764, 6955, 7142, 7324, 7501, 
-        7675, 7844, 8010, 8173, 8332, 8487, 8642, 8792, 8940, 9084, 9228, 9368, 
-        9508, 9643, 9776, 9909, 10040, 10169, 10294, 10419, 10543, 10666, 10786, 10904, 
-        11022, 11136, 11252, 11364, 11476, 11588, 11697, 11807, 11912, 12019, 12123, 12226, 
-        12329, 12432, 12533, 12632, 12731, 12827, 12924, 13021, 13115, 13210, 13304, 13397, 
-        13489, 13579, 13670, 13760, 13848, 13936, 14024, 14110, 14196, 14282, 14366, 14450, 
-        14533, 14615, 14697, 14778, 14860, 14940, 15019, 15099, 15176, 15255, 15333, 15410, 
-        15485, 15561, 15636, 15711, 15784, 15859, 15932, 16005, 16076, 16149, 16220, 16291, 
-        16360, 16431, 16502, 16570, 16639, 16706, 16775, 16841, 16908, 16974, 17041, 17108, 
-        17172, 17239, 17301, 17365, 17430, 17494, 17557, 17619, 17681, 17744, 17806, 17866, 
-        17928, 17989, 18049, 18109, 18169, 18229, 18287, 18345, 18403, 18461, 18521, 18577, 
-        18635, 18691, 18747, 18805, 18861, 18917, 18973, 19026, 19082, 19136, 19190, 19243, 
-        19297, 19351, 19405, 19458, 19510, 19564, 19615, 19667, 19718, 19770, 19821, 19873, 
-        19922, 19974, 20023, 20073, 20122, 20172, 20223, 20271, 20320, 20367, 20417, 20464, 
-        20513, 20561, 20608, 20655, 20702, 20750, 20795, 20842, 20887, 20934, 20980, 21025, 
-        21070, 21115, 21160, 21205, 21250, 21293, 21338, 21384, 21427, 21470, 21513, 21555, 
-        21598, 21641, 21684, 21727, 21770, 21811, 21852, 21895, 21936, 21979, 22020, 22060, 
-        22101, 22142, 22183, 22222, 22262, 22303, 22344, 22383, 22421, 22462, 22501, 22540, 
-        22578, 22617, 22656, 22694, 22733, 22770, 22806, 22843, 22879, 22916, 22952, 22987, 
-        23021, 23055, 23090, 23124, 23158, 23191, 23225, 23257, 23289, 23322, 23354, 23384, 
-        23416, 23446, 23479, 23509, 23539, 23567, 23597, 23625, 23655, 23683, 23711, 23739, 
-        23767, 23794, 23820, 23848, 23874, 23900, 23926, 23951, 23977, 24003, 24027, 24052, 
-        24076, 24100, 24123, 24149, 24170, 24194, 24218, 24239, 24261, 24284, 24306, 24327, 
-        24349, 24370, 24390, 24411, 24433, 24452, 24473, 24493, 24512, 24531, 24551, 21564, 
-        9441, -10333, -26695, -32767, -31192, -27645, -25602, -25453, -26113, -26609, -26654, -26431, 
-        -26186, -26036, -25967, -25920, -25857, -25776, -25683, -25597, -25516, -25436, -25361, -25284, 
-        -25206, -25129, -25054, -24978, -24903, -24830, -24757, -24686, -24613, -24542, -24471, -24403, 
-        -24332, -24265, -24196, -24127, -24061, -23994, -23928, -23861, -23797, -23732, -23668, -23603, 
-        -23539, -23476, -23412, -23350, -23287, -23227, -23165, -23105, -23045, -22982, -22922, -22862, 
-        -22804, -22744, -22686, -22628, -22570, -22510, -22451, -22393, -22338, -22282, -22224, -22168, 
-        -22112, -22056, -22000, -21944, -21889, -21833, -21779, -21723, -21669, -21613, -21558, -21502, 
-        -21448, -21392, -21336, -21280, -21225, -21169, -21113, -21057, -20999, -20943, -20887, -20831, 
-        -20775, -20717, -20659, -20604, -20546, -20490, -20432, -20376, -20318, -20260, -20202, -20144, 
-        -20086, -20028, -19970, -19912, -19852, -19794, -19736, -19675, -19617, -19557, -19499, -19439, 
-        -19379, -19319, -19261, -19200, -19140, -19080, -19020, -18958, -18898, -18837, -18775, -18715, 
-        -18653, -18592, -18530, -18468, -18405, -18343, -18281, -18219, -18156, -18094, -18032, -17967, 
-        -17905, -17840, -17776, -17711, -17649, -17585, -17520, -17456, -17391, -17325, -17260, -17194, 
-        -17129, -17062, -16998, -16931, -16865, -16798, -16729, -16663, -16596, -16530, -16461, -16392, 
-        -16325, -16255, -16186, -16117, -16048, -15980, -15909, -15840, -15769, -15698, -15627, -15556, 
-        -15485, -15414, -15341, -15268, -15197, -15124, -15049, -14976, -14903, -14828, -14755, -14680, 
-        -14604, -14529, -14454, -14377, -14301, -14224, -14147, -14069, -13992, -13912, -13835, -13756, 
-        -13676, -13597, -13515, -13435, -13354, -13272, -13191, -13107, -13025, -12941, -12857, -12774, 
-        -12688, -12602, -12516, -12430, -12342, -12256, -12168, -12080, -11989, -11899, -11809, -11719, 
-        -11626, -11534, -11441, -11349, -11255, -11158, -11063, -10967, -10868, -10771, -10672, -10573, 
-        -10472, -10369, -10268, -10165, -10060, -9957, -9849, -9744, -9634, -9525, -9415, -9303, 
-        -9192, -9078, -8962, -8846, -8730, -8609, -8489, -8367, -8244, -8120, -7993, -7864, 
-        -7735, -7602, -7468, -7331, -7193, -7054, -6912, -6766, -6620, -6467, -6315, -6158, 
-        -6001, -5838, -5672, -5502, -5328, -5148, -4965, -4778, -4585, -4385, -4179, -3966, 
-        -3745, -3515, -3276, -3025, -2763, -2486, -2191, -1873, -1532, -1153, -732, -240 
-    };
-
-    // AKWF_saw_0031 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0031[600] PROGMEM = {
-        37, 1189, 2295, 3194, 3856, 4335, 4721, 5080, 5431, 5768, 6082, 6376, 
-        6648, 6909, 7158, 7397, 7630, 7852, 8068, 8275, 8475, 8671, 8861, 9046, 
-        9226, 9403, 9575, 9743, 9906, 10065, 10224, 10376, 10529, 10675, 10821, 10964, 
-        11104, 11241, 11376, 11509, 11639, 11768, 11894, 12018, 12142, 12262, 12382, 12500, 
-        12615, 12730, 12844, 12955, 13064, 13172, 13279, 13386, 13490, 13593, 13695, 13795, 
-        13895, 13993, 14091, 14187, 14283, 14377, 14470, 14562, 14653, 14743, 14832, 14921, 
-        15008, 15095, 15180, 15265, 15350, 15433, 15514, 15596, 15677, 15757, 15838, 15916, 
-        15993, 16071, 16147, 16223, 16297, 16374, 16448, 16520, 16591, 16666, 16735, 16807, 
-        16877, 16946, 17016, 17084, 17153, 17219, 17286, 17354, 17419, 17484, 17550, 17613, 
-        17676, 17739, 17802, 17865, 17926, 17990, 18051, 18109, 18170, 18229, 18288, 18347, 
-        18406, 18464, 18521, 18578, 18634, 18691, 18747, 18804, 18858, 18913, 18967, 19022, 
-        19074, 19129, 19181, 19233, 19285, 19338, 19390, 19440, 19490, 19540, 19590, 19640, 
-        19690, 19740, 19788, 19836, 19884, 19932, 19980, 20028, 20074, 20122, 20167, 20213, 
-        20259, 20304, 20350, 20394, 20439, 20483, 20529, 20572, 20616, 20657, 20701, 20744, 
-        20786, 20829, 20871, 20912, 20953, 20995, 21036, 21075, 21117, 21158, 21197, 21237, 
-        21276, 21315, 21354, 21393, 21433, 21470, 21509, 21546, 21583, 21622, 21659, 21696, 
-        21733, 21768, 21805, 21842, 21877, 21912, 21949, 21983, 22018, 22053, 22088, 22123, 
-        22158, 22190, 22225, 22258, 22293, 22325, 22358, 22393, 22426, 22456, 22489, 22521, 
-        22554, 22587, 22617, 22650, 22680, 22711, 22741, 22774, 22804, 22835, 22865, 22896, 
-        22924, 22955, 22983, 23014, 23042, 23072, 23101, 23129, 23157, 23186, 23214, 23242, 
-        23271, 23299, 23327, 23353, 23382, 23408, 23434, 23460, 23486, 23512, 23536, 23560, 
-        23586, 23610, 23634, 23658, 23682, 23704, 23728, 23752, 23774, 23795, 23817, 23839, 
-        23861, 23882, 23902, 23924, 23943, 23963, 23985, 24004, 24024, 24044, 24061, 24081, 
-        24100, 24118, 24135, 24152, 24172, 24190, 24207, 24224, 24240, 24257, 24272, 24290, 
-        24305, 24322, 24338, 24353, 24368, 24383, 24396, 24412, 24427, 24442, 24455, 21472, 
-        9372, -10363, -26694, -32767, -31206, -27676, -25649, -25514, -26182, -26690, -26748, -26537, 
-        -26304, -26165, -26106, -26071, -26019, -25949, -25871, -25794, -25723, -25655, -25590, -25522, 
-        -25457, -25392, -25326, -25263, -25198, -25135, -25074, -25011, -24950, -24889, -24830, -24769, 
-        -24710, -24651, -24592, -24534, -24477, -24420, -24364, -24307, -24250, -24196, -24139, -24085, 
-        -24031, -23978, -23924, -23869, -23817, -23763, -23710, -23658, -23606, -23556, -23504, -23453, 
-        -23401, -23351, -23299, -23249, -23199, -23149, -23101, -23051, -23000, -22953, -22902, -22855, 
-        -22804, -22757, -22709, -22661, -22613, -22565, -22517, -22469, -22423, -22375, -22328, -22277, 
-        -22230, -22182, -22134, -22084, -22036, -21988, -21940, -21890, -21840, -21790, -21742, -21692, 
-        -21642, -21591, -21544, -21493, -21441, -21391, -21341, -21291, -21241, -21189, -21139, -21086, 
-        -21036, -20984, -20932, -20882, -20829, -20777, -20725, -20673, -20620, -20566, -20514, -20461, 
-        -20407, -20355, -20300, -20248, -20193, -20139, -20085, -20030, -19976, -19921, -19867, -19812, 
-        -19756, -19701, -19645, -19590, -19534, -19477, -19420, -19364, -19307, -19250, -19194, -19135, 
-        -19078, -19022, -18963, -18904, -18845, -18787, -18728, -18669, -18610, -18551, -18490, -18432, 
-        -18371, -18310, -18249, -18188, -18127, -18066, -18005, -17942, -17881, -17818, -17754, -17691, 
-        -17628, -17565, -17502, -17436, -17373, -17308, -17243, -17177, -17112, -17047, -16979, -16914, 
-        -16846, -16779, -16711, -16644, -16576, -16507, -16439, -16369, -16300, -16230, -16160, -16088, 
-        -16019, -15947, -15875, -15803, -15729, -15657, -15583, -15509, -15435, -15361, -15285, -15211, 
-        -15135, -15056, -14980, -14904, -14825, -14747, -14669, -14588, -14507, -14427, -14346, -14264, 
-        -14183, -14100, -14017, -13932, -13848, -13763, -13678, -13591, -13503, -13416, -13327, -13238, 
-        -13149, -13057, -12966, -12874, -12783, -12689, -12593, -12500, -12402, -12306, -12208, -12108, 
-        -12007, -11907, -11805, -11703, -11600, -11493, -11387, -11280, -11171, -11062, -10951, -10840, 
-        -10727, -10611, -10494, -10376, -10259, -10137, -10015, -9891, -9764, -9638, -9507, -9377, 
-        -9242, -9107, -8969, -8830, -8686, -8540, -8392, -8242, -8090, -7933, -7774, -7611, 
-        -7443, -7271, -7097, -6918, -6733, -6544, -6350, -6149, -5942, -5727, -5505, -5276, 
-        -5037, -4786, -4523, -4246, -3954, -3645, -3312, -2948, -2552, -2103, -1583, -910 
-    };
-
-    // AKWF_saw_0032 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0032[600] PROGMEM = {
-        1327, 2809, 3928, 4660, 5131, 5500, 5863, 6234, 6595, 6926, 7228, 7508, 
-        7777, 8032, 8280, 8518, 8746, 8966, 9178, 9384, 9583, 9776, 9964, 10148, 
-        10327, 10501, 10669, 10835, 10998, 11155, 11312, 11462, 11612, 11757, 11900, 12042, 
-        12178, 12312, 12444, 12577, 12704, 12832, 12955, 13078, 13199, 13315, 13432, 13548, 
-        13660, 13772, 13884, 13991, 14099, 14204, 14307, 14410, 14513, 14612, 14712, 14809, 
-        14905, 15001, 15095, 15187, 15279, 15370, 15460, 15550, 15637, 15724, 15809, 15894, 
-        15977, 16062, 16143, 16226, 16306, 16385, 16463, 16541, 16617, 16696, 16772, 16846, 
-        16920, 16994, 17065, 17137, 17208, 17280, 17350, 17419, 17488, 17555, 17623, 17690, 
-        17755, 17822, 17887, 17952, 18014, 18077, 18140, 18202, 18265, 18326, 18386, 18446, 
-        18507, 18565, 18623, 18682, 18740, 18796, 18854, 18910, 18964, 19020, 19073, 19129, 
-        19183, 19237, 19288, 19342, 19393, 19445, 19496, 19548, 19599, 19649, 19698, 19747, 
-        19796, 19846, 19893, 19942, 19989, 20036, 20083, 20130, 20175, 20222, 20267, 20311, 
-        20356, 20401, 20446, 20488, 20533, 20575, 20618, 20661, 20703, 20743, 20786, 20826, 
-        20869, 20909, 20949, 20990, 21028, 21068, 21108, 21146, 21184, 21222, 21261, 21299, 
-        21337, 21375, 21411, 21449, 21484, 21520, 21556, 21592, 21628, 21664, 21697, 21733, 
-        21766, 21800, 21834, 21869, 21903, 21937, 21968, 22002, 22035, 22066, 22098, 22131, 
-        22163, 22194, 22225, 22257, 22286, 22317, 22349, 22378, 22409, 22438, 22467, 22496, 
-        22525, 22555, 22584, 22613, 22640, 22669, 22698, 22725, 22752, 22778, 22807, 22834, 
-        22861, 22888, 22915, 22940, 22966, 22993, 23018, 23043, 23069, 23094, 23119, 23146, 
-        23168, 23193, 23217, 23242, 23266, 23291, 23313, 23338, 23360, 23383, 23407, 23430, 
-        23452, 23475, 23497, 23519, 23542, 23564, 23587, 23607, 23629, 23651, 23672, 23692, 
-        23712, 23732, 23752, 23772, 23793, 23810, 23831, 23851, 23869, 23887, 23904, 23922, 
-        23940, 23956, 23974, 23992, 24007, 24025, 24041, 24057, 24072, 24088, 24104, 24119, 
-        24133, 24148, 24162, 24178, 24191, 24204, 24220, 24234, 24247, 24258, 24272, 24285, 
-        24296, 24310, 24323, 24334, 24345, 24357, 24368, 24381, 24392, 24404, 21422, 9333, 
-        -10380, -26696, -32767, -31214, -27697, -25678, -25548, -26224, -26739, -26804, -26598, -26372, 
-        -26239, -26188, -26159, -26114, -26049, -25977, -25906, -25843, -25783, -25722, -25662, -25601, 
-        -25541, -25483, -25425, -25369, -25310, -25254, -25198, -25142, -25089, -25033, -24979, -24925, 
-        -24874, -24820, -24766, -24715, -24663, -24614, -24563, -24511, -24462, -24413, -24363, -24314, 
-        -24265, -24216, -24166, -24119, -24072, -24023, -23976, -23929, -23882, -23835, -23790, -23743, 
-        -23698, -23651, -23607, -23560, -23515, -23470, -23425, -23381, -23336, -23291, -23246, -23201, 
-        -23159, -23114, -23072, -23027, -22984, -22942, -22897, -22854, -22810, -22767, -22722, -22680, 
-        -22635, -22590, -22546, -22501, -22456, -22411, -22366, -22322, -22277, -22232, -22185, -22140, 
-        -22096, -22049, -22004, -21957, -21910, -21863, -21816, -21771, -21724, -21677, -21630, -21581, 
-        -21534, -21487, -21437, -21390, -21341, -21294, -21245, -21196, -21146, -21097, -21048, -20999, 
-        -20949, -20900, -20851, -20799, -20750, -20699, -20649, -20598, -20546, -20495, -20443, -20392, 
-        -20340, -20289, -20235, -20184, -20130, -20078, -20025, -19971, -19917, -19864, -19810, -19756, 
-        -19702, -19646, -19593, -19537, -19481, -19425, -19369, -19313, -19257, -19201, -19145, -19087, 
-        -19031, -18973, -18914, -18856, -18798, -18740, -18682, -18621, -18563, -18502, -18442, -18382, 
-        -18321, -18261, -18200, -18138, -18075, -18014, -17952, -17889, -17824, -17761, -17699, -17634, 
-        -17569, -17504, -17439, -17374, -17307, -17242, -17175, -17108, -17041, -16973, -16904, -16835, 
-        -16767, -16698, -16626, -16557, -16485, -16416, -16344, -16270, -16199, -16127, -16053, -15979, 
-        -15903, -15829, -15753, -15677, -15601, -15525, -15447, -15368, -15290, -15209, -15131, -15050, 
-        -14970, -14887, -14804, -14721, -14638, -14553, -14468, -14383, -14296, -14209, -14121, -14034, 
-        -13944, -13853, -13761, -13669, -13577, -13483, -13389, -13295, -13199, -13100, -13002, -12903, 
-        -12803, -12702, -12599, -12496, -12391, -12286, -12178, -12068, -11959, -11849, -11737, -11623, 
-        -11506, -11390, -11271, -11153, -11032, -10909, -10783, -10656, -10528, -10396, -10264, -10127, 
-        -9991, -9852, -9711, -9566, -9418, -9268, -9116, -8959, -8800, -8636, -8471, -8298, 
-        -8124, -7945, -7761, -7573, -7378, -7179, -6973, -6760, -6539, -6310, -6073, -5825, 
-        -5565, -5294, -5005, -4703, -4378, -4031, -3651, -3234, -2762, -2209, -1443, -232 
-    };
-
-    // AKWF_saw_0033 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0033[600] PROGMEM = {
-        1387, 2989, 4186, 4954, 5438, 5819, 6194, 6579, 6953, 7298, 7612, 7901, 
-        8177, 8441, 8697, 8943, 9176, 9403, 9622, 9833, 10037, 10236, 10429, 10615, 
-        10799, 10976, 11149, 11319, 11485, 11646, 11803, 11958, 12110, 12258, 12403, 12545, 
-        12686, 12823, 12957, 13089, 13219, 13347, 13472, 13596, 13717, 13838, 13954, 14071, 
-        14185, 14297, 14407, 14517, 14624, 14730, 14835, 14938, 15039, 15140, 15238, 15335, 
-        15433, 15527, 15622, 15716, 15805, 15897, 15987, 16074, 16162, 16249, 16334, 16417, 
-        16500, 16583, 16664, 16744, 16825, 16903, 16982, 17058, 17134, 17210, 17284, 17358, 
-        17432, 17504, 17576, 17645, 17717, 17784, 17854, 17921, 17990, 18058, 18123, 18188, 
-        18253, 18315, 18380, 18443, 18506, 18566, 18627, 18687, 18748, 18806, 18867, 18925, 
-        18983, 19039, 19097, 19153, 19207, 19263, 19317, 19371, 19427, 19478, 19532, 19584, 
-        19635, 19687, 19738, 19788, 19839, 19888, 19938, 19987, 20034, 20083, 20130, 20178, 
-        20225, 20272, 20316, 20361, 20406, 20451, 20496, 20541, 20585, 20628, 20671, 20713, 
-        20756, 20798, 20839, 20881, 20922, 20962, 21002, 21043, 21081, 21121, 21159, 21199, 
-        21238, 21276, 21314, 21350, 21388, 21424, 21459, 21497, 21533, 21569, 21603, 21639, 
-        21672, 21708, 21742, 21775, 21809, 21845, 21876, 21910, 21943, 21975, 22006, 22038, 
-        22071, 22103, 22134, 22163, 22194, 22224, 22255, 22284, 22315, 22345, 22374, 22403, 
-        22432, 22459, 22488, 22515, 22544, 22571, 22598, 22625, 22652, 22678, 22705, 22732, 
-        22759, 22784, 22811, 22835, 22860, 22887, 22912, 22936, 22961, 22986, 23008, 23033, 
-        23055, 23080, 23102, 23127, 23149, 23172, 23196, 23219, 23239, 23261, 23284, 23304, 
-        23326, 23349, 23369, 23391, 23411, 23431, 23452, 23472, 23492, 23512, 23532, 23552, 
-        23573, 23591, 23611, 23629, 23649, 23667, 23685, 23703, 23721, 23738, 23756, 23774, 
-        23792, 23810, 23828, 23846, 23862, 23877, 23895, 23911, 23927, 23942, 23958, 23974, 
-        23987, 24003, 24016, 24032, 24046, 24061, 24075, 24088, 24102, 24113, 24126, 24140, 
-        24151, 24164, 24175, 24189, 24200, 24211, 24223, 24234, 24245, 24256, 24267, 24276, 
-        24288, 24296, 24308, 24317, 24326, 24337, 24346, 24355, 24364, 24370, 21390, 9309, 
-        -10391, -26697, -32767, -31221, -27710, -25697, -25572, -26251, -26768, -26838, -26636, -26414, 
-        -26287, -26239, -26215, -26174, -26114, -26044, -25979, -25919, -25863, -25807, -25751, -25695, 
-        -25639, -25583, -25529, -25475, -25424, -25370, -25318, -25267, -25215, -25164, -25112, -25063, 
-        -25014, -24964, -24917, -24868, -24821, -24772, -24725, -24677, -24630, -24586, -24539, -24494, 
-        -24447, -24402, -24357, -24312, -24267, -24223, -24178, -24135, -24090, -24048, -24003, -23960, 
-        -23918, -23875, -23833, -23790, -23747, -23705, -23662, -23620, -23579, -23537, -23496, -23454, 
-        -23414, -23371, -23331, -23290, -23250, -23207, -23167, -23127, -23086, -23044, -23003, -22961, 
-        -22921, -22878, -22838, -22795, -22752, -22710, -22667, -22627, -22584, -22542, -22499, -22454, 
-        -22412, -22367, -22324, -22280, -22237, -22192, -22150, -22105, -22060, -22015, -21970, -21926, 
-        -21881, -21836, -21789, -21744, -21697, -21652, -21605, -21558, -21513, -21466, -21419, -21372, 
-        -21325, -21276, -21229, -21181, -21132, -21085, -21036, -20987, -20937, -20888, -20839, -20789, 
-        -20740, -20691, -20639, -20590, -20538, -20487, -20437, -20386, -20334, -20283, -20231, -20178, 
-        -20126, -20072, -20018, -19967, -19913, -19859, -19806, -19752, -19696, -19642, -19586, -19532, 
-        -19476, -19420, -19364, -19308, -19252, -19194, -19135, -19079, -19021, -18963, -18905, -18846, 
-        -18786, -18728, -18667, -18607, -18548, -18488, -18425, -18365, -18302, -18239, -18176, -18114, 
-        -18051, -17988, -17925, -17860, -17795, -17730, -17663, -17598, -17533, -17466, -17399, -17331, 
-        -17262, -17195, -17125, -17056, -16986, -16917, -16845, -16773, -16702, -16630, -16558, -16484, 
-        -16410, -16336, -16262, -16186, -16110, -16034, -15955, -15879, -15801, -15722, -15642, -15563, 
-        -15483, -15400, -15317, -15236, -15151, -15068, -14983, -14898, -14810, -14723, -14636, -14546, 
-        -14456, -14367, -14275, -14183, -14091, -13997, -13900, -13806, -13710, -13611, -13513, -13412, 
-        -13311, -13208, -13105, -13002, -12896, -12789, -12681, -12572, -12459, -12347, -12233, -12119, 
-        -12002, -11886, -11765, -11644, -11521, -11395, -11267, -11137, -11007, -10875, -10738, -10602, 
-        -10463, -10319, -10174, -10028, -9876, -9723, -9566, -9407, -9244, -9076, -8905, -8730, 
-        -8551, -8367, -8179, -7984, -7785, -7579, -7366, -7148, -6920, -6684, -6438, -6182, 
-        -5914, -5631, -5333, -5019, -4683, -4322, -3928, -3493, -3000, -2424, -1613, -304 
-    };
-
-    // AKWF_saw_0034 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0034[600] PROGMEM = {
-        47, 103, 159, 217, 274, 330, 387, 443, 500, 558, 614, 671, 
-        728, 784, 840, 897, 953, 1010, 1068, 1124, 1181, 1238, 1294, 1351, 
-        1407, 1463, 1521, 1578, 1634, 1691, 1748, 1804, 1862, 1918, 1973, 2031, 
-        2088, 2144, 2201, 2259, 2314, 2372, 2428, 2484, 2541, 2598, 2654, 2711, 
-        2769, 2825, 2882, 2938, 2994, 3051, 3108, 3164, 3222, 3279, 3335, 3391, 
-        3448, 3505, 3561, 3618, 3674, 3732, 3788, 3845, 3901, 3958, 4015, 4071, 
-        4129, 4185, 4242, 4298, 4355, 4411, 4468, 4526, 4582, 4639, 4695, 4752, 
-        4808, 4865, 4921, 4978, 5036, 5092, 5149, 5205, 5262, 5318, 5375, 5431, 
-        5489, 5546, 5602, 5659, 5715, 5772, 5828, 5886, 5941, 5999, 6056, 6112, 
-        6169, 6225, 6282, 6338, 6396, 6452, 6509, 6566, 6622, 6679, 6735, 6793, 
-        6849, 6906, 6962, 7019, 7076, 7132, 7190, 7245, 7303, 7359, 7416, 7472, 
-        7529, 7586, 7642, 7700, 7756, 7813, 7869, 7926, 7982, 8039, 8097, 8153, 
-        8210, 8266, 8323, 8379, 8436, 8492, 8549, 8607, 8663, 8720, 8776, 8833, 
-        8889, 8946, 9002, 9060, 9117, 9173, 9230, 9286, 9343, 9401, 9457, 9512, 
-        9570, 9627, 9683, 9740, 9796, 9853, 9911, 9967, 10023, 10080, 10137, 10193, 
-        10250, 10306, 10364, 10421, 10477, 10534, 10590, 10647, 10703, 10761, 10816, 10874, 
-        10931, 10987, 11044, 11100, 11157, 11213, 11271, 11327, 11384, 11441, 11497, 11554, 
-        11610, 11668, 11724, 11781, 11837, 11894, 11951, 12007, 12065, 12121, 12178, 12234, 
-        12291, 12347, 12404, 12461, 12517, 12575, 12631, 12688, 12744, 12801, 12857, 12914, 
-        12972, 13028, 13085, 13141, 13198, 13254, 13311, 13367, 13425, 13482, 13538, 13595, 
-        13651, 13708, 13765, 13821, 13877, 13935, 13992, 14048, 14105, 14161, 14218, 14276, 
-        14332, 14388, 14445, 14502, 14558, 14615, 14673, 14729, 14786, 14842, 14898, 14955, 
-        15012, 15068, 15125, 15183, 15239, 15296, 15352, 15409, 15465, 15522, 15578, 15636, 
-        15693, 15749, 15806, 15862, 15919, 15975, 16033, 16088, 16146, 16203, 16259, 16316, 
-        16372, 16429, 16485, 16543, 16599, 16656, 16713, 16769, 16826, 16882, 16940, 16996, 
-        17053, 17109, 17166, 17223, 17279, -23261, -30084, -32431, -32767, -32224, -31341, -30373, 
-        -29428, -28545, -27727, -26969, -26257, -25583, -24938, -24317, -23715, -23129, -22558, -22002, 
-        -21460, -20933, -20420, -19923, -19441, -18976, -18529, -18097, -17684, -17287, -16909, -16548, 
-        -16204, -15877, -15568, -15273, -14996, -14735, -14489, -14257, -14040, -13836, -13646, -13467, 
-        -13299, -13145, -13001, -12866, -12743, -12625, -12519, -12420, -12328, -12243, -12166, -12094, 
-        -12027, -11966, -11910, -11858, -11810, -11766, -11725, -11688, -11653, -11620, -11589, -11560, 
-        -11533, -11508, -11484, -11461, -11439, -11417, -11396, -11375, -11355, -11335, -11315, -11295, 
-        -11275, -11253, -11232, -11212, -11189, -11167, -11144, -11120, -11096, -11071, -11046, -11019, 
-        -10992, -10964, -10935, -10906, -10876, -10844, -10813, -10779, -10746, -10713, -10677, -10641, 
-        -10603, -10566, -10527, -10489, -10449, -10408, -10368, -10325, -10282, -10238, -10194, -10151, 
-        -10105, -10059, -10013, -9967, -9919, -9871, -9822, -9774, -9724, -9674, -9623, -9572, 
-        -9522, -9470, -9418, -9366, -9314, -9261, -9207, -9153, -9100, -9046, -8992, -8937, 
-        -8882, -8827, -8772, -8716, -8660, -8604, -8548, -8492, -8436, -8379, -8323, -8266, 
-        -8208, -8153, -8095, -8038, -7981, -7923, -7866, -7809, -7750, -7693, -7636, -7578, 
-        -7520, -7463, -7404, -7347, -7289, -7231, -7172, -7115, -7056, -6999, -6940, -6882, 
-        -6825, -6766, -6707, -6650, -6591, -6534, -6476, -6418, -6360, -6302, -6244, -6185, 
-        -6128, -6069, -6012, -5953, -5896, -5838, -5780, -5722, -5664, -5606, -5549, -5490, 
-        -5433, -5374, -5317, -5259, -5202, -5144, -5086, -5029, -4970, -4913, -4856, -4797, 
-        -4740, -4683, -4625, -4568, -4510, -4452, -4395, -4338, -4280, -4223, -4166, -4109, 
-        -4051, -3994, -3937, -3880, -3822, -3765, -3708, -3650, -3593, -3536, -3479, -3421, 
-        -3364, -3307, -3250, -3194, -3136, -3079, -3022, -2964, -2907, -2851, -2794, -2737, 
-        -2679, -2622, -2565, -2509, -2452, -2394, -2337, -2281, -2224, -2167, -2111, -2053, 
-        -1996, -1939, -1883, -1826, -1768, -1712, -1655, -1599, -1542, -1485, -1427, -1371, 
-        -1314, -1257, -1201, -1144, -1088, -1030, -973, -917, -860, -803, -747, -689, 
-        -634, -576, -519, -463, -406, -350, -293, -235, -179, -122, -66, -9 
-    };
-
-    // AKWF_saw_0035 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0035[600] PROGMEM = {
-        8, 37, 66, 94, 123, 150, 179, 207, 236, 263, 292, 321, 
-        349, 378, 405, 434, 463, 491, 520, 548, 577, 604, 633, 662, 
-        690, 719, 746, 775, 803, 832, 861, 888, 917, 945, 974, 1001, 
-        1030, 1059, 1087, 1116, 1143, 1172, 1201, 1229, 1258, 1286, 1315, 1342, 
-        1371, 1399, 1428, 1457, 1484, 1513, 1541, 1570, 1599, 1626, 1655, 1683, 
-        1712, 1741, 1768, 1797, 1825, 1854, 1881, 1910, 1939, 1967, 1996, 2024, 
-        2053, 2082, 2109, 2138, 2166, 2195, 2224, 2251, 2280, 2308, 2337, 2366, 
-        2393, 2422, 2450, 2479, 2506, 2535, 2564, 2592, 2621, 2648, 2677, 2706, 
-        2734, 2763, 2791, 2820, 2849, 2876, 2905, 2933, 2962, 2991, 3018, 3047, 
-        3075, 3104, 3131, 3160, 3188, 3217, 3246, 3273, 3302, 3331, 3359, 3388, 
-        3415, 3444, 3473, 3501, 3530, 3558, 3587, 3616, 3643, 3672, 3700, 3729, 
-        3756, 3785, 3814, 3842, 3871, 3898, 3927, 3955, 3984, 4013, 4040, 4069, 
-        4098, 4126, 4155, 4182, 4211, 4240, 4268, 4297, 4325, 4354, 4383, 4410, 
-        4439, 4467, 4496, 4525, 4552, 4581, 4609, 4638, 4665, 4694, 4723, 4751, 
-        4780, 4807, 4836, 4865, 4893, 4922, 4950, 4978, 5007, 5035, 5064, 5092, 
-        5121, 5150, 5177, 5206, 5234, 5263, 5292, 5319, 5348, 5376, 5405, 5434, 
-        5461, 5490, 5518, 5547, 5574, 5603, 5632, 5660, 5689, 5717, 5746, 5774, 
-        5802, 5831, 5859, 5888, 5917, 5944, 5973, 6001, 6030, 6059, 6086, 6115, 
-        6143, 6172, 6199, 6228, 6257, 6285, 6314, 6341, 6370, 6399, 6427, 6456, 
-        6484, 6513, 6542, 6569, 6598, 6626, 6655, 6684, 6711, 6740, 6768, 6797, 
-        6826, 6853, 6882, 6910, 6939, 6966, 6995, 7024, 7052, 7081, 7108, 7137, 
-        7166, 7194, 7223, 7251, 7280, 7309, 7336, 7365, 7393, 7422, 7451, 7478, 
-        7507, 7535, 7564, 7593, 7620, 7649, 7677, 7706, 7735, 7762, 7791, 7819, 
-        7848, 7875, 7904, 7933, 7961, 7990, 8018, 8047, 8076, 8103, 8132, 8161, 
-        8189, 8218, 8245, 8274, 8303, 8331, 8360, 8387, 8416, 8445, 8473, 8502, 
-        8529, 8558, 8586, 8615, 8644, 8671, 8700, 8728, 8757, 8785, 8814, 8843, 
-        8870, 8899, 8928, 8956, 8985, 9012, 9041, 9070, 9098, 9127, 9154, 9183, 
-        9212, -15241, -25219, -30117, -32206, -32767, -32524, -31869, -31016, -30071, -29088, -28087, 
-        -27082, -26078, -25077, -24081, -23092, -22115, -21149, -20201, -19272, -18364, -17480, -16623, 
-        -15795, -14997, -14230, -13497, -12796, -12129, -11497, -10898, -10333, -9802, -9304, -8838, 
-        -8403, -8000, -7625, -7280, -6961, -6668, -6401, -6157, -5937, -5737, -5558, -5399, 
-        -5257, -5131, -5021, -4926, -4844, -4774, -4716, -4670, -4632, -4603, -4581, -4567, 
-        -4559, -4558, -4561, -4568, -4580, -4594, -4612, -4631, -4652, -4675, -4700, -4725, 
-        -4749, -4776, -4800, -4826, -4851, -4874, -4897, -4919, -4939, -4960, -4978, -4994, 
-        -5010, -5023, -5036, -5047, -5055, -5063, -5068, -5073, -5074, -5074, -5074, -5071, 
-        -5067, -5063, -5055, -5047, -5036, -5025, -5012, -4999, -4984, -4968, -4951, -4932, 
-        -4913, -4893, -4871, -4849, -4826, -4802, -4778, -4752, -4728, -4700, -4674, -4646, 
-        -4617, -4590, -4561, -4532, -4501, -4472, -4442, -4412, -4380, -4349, -4317, -4287, 
-        -4255, -4223, -4191, -4159, -4127, -4096, -4064, -4030, -3998, -3966, -3935, -3903, 
-        -3869, -3837, -3806, -3774, -3740, -3708, -3676, -3645, -3613, -3581, -3549, -3517, 
-        -3485, -3455, -3423, -3391, -3359, -3328, -3297, -3266, -3236, -3204, -3173, -3141, 
-        -3111, -3081, -3050, -3020, -2989, -2959, -2928, -2898, -2867, -2837, -2807, -2778, 
-        -2747, -2718, -2688, -2657, -2628, -2598, -2569, -2538, -2509, -2480, -2451, -2421, 
-        -2392, -2363, -2334, -2305, -2274, -2245, -2216, -2187, -2158, -2129, -2100, -2071, 
-        -2042, -2013, -1984, -1955, -1926, -1899, -1870, -1841, -1812, -1783, -1754, -1725, 
-        -1697, -1668, -1639, -1610, -1583, -1554, -1525, -1496, -1468, -1439, -1410, -1383, 
-        -1354, -1325, -1297, -1268, -1239, -1212, -1183, -1155, -1126, -1097, -1070, -1041, 
-        -1013, -984, -955, -927, -898, -871, -842, -813, -785, -756, -727, -700, 
-        -671, -643, -614, -585, -558, -529, -501, -472, -445, -416, -388, -359, 
-        -330, -303, -274, -246, -217, -188, -160, -131, -104, -75, -47, -18 
-    };
-
-    // AKWF_saw_0036 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0036[600] PROGMEM = {
-        27, 78, 131, 182, 234, 286, 337, 388, 440, 492, 543, 596, 
-        647, 699, 751, 802, 853, 905, 957, 1008, 1061, 1112, 1164, 1216, 
-        1267, 1318, 1370, 1422, 1473, 1526, 1577, 1629, 1681, 1732, 1783, 1835, 
-        1887, 1938, 1991, 2042, 2094, 2146, 2197, 2248, 2300, 2352, 2403, 2456, 
-        2507, 2559, 2611, 2662, 2713, 2765, 2817, 2868, 2921, 2972, 3024, 3076, 
-        3127, 3178, 3230, 3282, 3333, 3386, 3438, 3489, 3541, 3592, 3643, 3695, 
-        3748, 3798, 3851, 3903, 3954, 4006, 4057, 4108, 4160, 4213, 4264, 4316, 
-        4368, 4419, 4470, 4522, 4573, 4625, 4678, 4729, 4781, 4833, 4884, 4935, 
-        4987, 5038, 5090, 5143, 5194, 5246, 5298, 5349, 5400, 5452, 5503, 5555, 
-        5608, 5659, 5711, 5763, 5814, 5865, 5917, 5968, 6020, 6073, 6124, 6176, 
-        6228, 6279, 6330, 6382, 6433, 6485, 6538, 6589, 6641, 6693, 6744, 6795, 
-        6847, 6898, 6950, 7003, 7054, 7106, 7158, 7209, 7260, 7312, 7363, 7415, 
-        7468, 7519, 7571, 7622, 7674, 7725, 7777, 7828, 7880, 7933, 7984, 8036, 
-        8087, 8139, 8190, 8242, 8293, 8345, 8398, 8449, 8501, 8552, 8604, 8655, 
-        8707, 8759, 8810, 8863, 8914, 8965, 9017, 9069, 9120, 9172, 9224, 9275, 
-        9328, 9379, 9430, 9482, 9534, 9585, 9637, 9689, 9740, 9793, 9844, 9895, 
-        9947, 9999, 10050, 10102, 10154, 10205, 10258, 10309, 10360, 10412, 10464, 10515, 
-        10567, 10619, 10670, 10723, 10774, 10825, 10877, 10929, 10980, 11032, 11084, 11135, 
-        11188, 11239, 11290, 11342, 11394, 11445, 11497, 11549, 11600, 11653, 11704, 11755, 
-        11807, 11859, 11910, 11962, 12014, 12065, 12118, 12169, 12220, 12272, 12324, 12375, 
-        12427, 12479, 12530, 12583, 12634, 12685, 12737, 12789, 12840, 12892, 12944, 12995, 
-        13048, 13099, 13150, 13202, 13254, 13305, 13357, 13410, 13460, 13513, 13564, 13616, 
-        13667, 13719, 13770, 13822, 13875, 13926, 13977, 14029, 14081, 14132, 14184, 14235, 
-        14287, 14340, 14391, 14442, 14494, 14546, 14597, 14649, 14700, 14752, 14805, 14856, 
-        14907, 14959, 15011, 15062, 15114, 15165, 15217, 15270, 15321, 15372, 15424, 15476, 
-        15527, 15579, 15630, 15682, 15735, 15786, 15837, 15889, 15941, 15992, -25452, -32767, 
-        -29843, -29499, -28571, -27837, -27100, -26408, -25746, -25117, -24518, -23947, -23402, -22882, 
-        -22388, -21916, -21464, -21034, -20624, -20233, -19859, -19500, -19158, -18832, -18519, -18219, 
-        -17932, -17658, -17395, -17143, -16901, -16669, -16447, -16234, -16027, -15829, -15640, -15458, 
-        -15282, -15112, -14948, -14790, -14638, -14490, -14348, -14211, -14077, -13949, -13824, -13702, 
-        -13584, -13470, -13360, -13252, -13146, -13044, -12944, -12847, -12753, -12660, -12569, -12481, 
-        -12394, -12310, -12227, -12144, -12064, -11987, -11910, -11834, -11760, -11685, -11614, -11542, 
-        -11472, -11403, -11335, -11268, -11201, -11134, -11070, -11006, -10941, -10878, -10815, -10754, 
-        -10692, -10632, -10571, -10510, -10451, -10392, -10333, -10275, -10216, -10159, -10102, -10044, 
-        -9987, -9931, -9875, -9818, -9762, -9706, -9652, -9596, -9541, -9485, -9432, -9377, 
-        -9323, -9268, -9213, -9160, -9107, -9052, -8999, -8945, -8892, -8838, -8785, -8731, 
-        -8679, -8626, -8572, -8520, -8467, -8415, -8361, -8309, -8256, -8203, -8151, -8099, 
-        -8046, -7993, -7941, -7889, -7837, -7784, -7732, -7680, -7628, -7576, -7523, -7471, 
-        -7419, -7367, -7316, -7264, -7211, -7159, -7107, -7056, -7004, -6952, -6899, -6847, 
-        -6796, -6744, -6692, -6641, -6589, -6536, -6484, -6433, -6381, -6330, -6278, -6226, 
-        -6175, -6122, -6070, -6018, -5967, -5915, -5864, -5812, -5759, -5708, -5656, -5605, 
-        -5553, -5501, -5450, -5397, -5345, -5294, -5242, -5191, -5140, -5088, -5036, -4985, 
-        -4932, -4880, -4829, -4777, -4726, -4674, -4622, -4571, -4518, -4467, -4415, -4363, 
-        -4312, -4261, -4209, -4157, -4106, -4053, -4002, -3950, -3898, -3847, -3796, -3744, 
-        -3692, -3641, -3588, -3537, -3485, -3433, -3382, -3331, -3279, -3227, -3176, -3123, 
-        -3072, -3020, -2968, -2917, -2865, -2814, -2762, -2711, -2658, -2607, -2555, -2503, 
-        -2452, -2400, -2349, -2297, -2246, -2193, -2142, -2090, -2038, -1987, -1935, -1884, 
-        -1832, -1781, -1728, -1677, -1625, -1573, -1522, -1470, -1419, -1367, -1316, -1263, 
-        -1212, -1160, -1108, -1057, -1005, -954, -902, -851, -798, -747, -695, -643, 
-        -592, -541, -489, -437, -386, -333, -282, -230, -178, -127, -76, -24 
-    };
-
-    // AKWF_saw_0037 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0037[600] PROGMEM = {
-        31, 87, 143, 199, 254, 310, 367, 422, 477, 533, 590, 645, 
-        701, 757, 813, 869, 924, 980, 1036, 1092, 1147, 1204, 1259, 1315, 
-        1372, 1427, 1482, 1538, 1595, 1650, 1706, 1761, 1818, 1874, 1929, 1985, 
-        2041, 2097, 2152, 2209, 2264, 2320, 2377, 2432, 2487, 2543, 2600, 2655, 
-        2711, 2766, 2823, 2879, 2934, 2990, 3046, 3102, 3157, 3214, 3269, 3325, 
-        3382, 3437, 3492, 3548, 3605, 3660, 3716, 3771, 3828, 3884, 3939, 3994, 
-        4051, 4107, 4162, 4219, 4274, 4330, 4387, 4442, 4497, 4553, 4610, 4665, 
-        4721, 4776, 4833, 4889, 4944, 4999, 5056, 5112, 5167, 5224, 5279, 5335, 
-        5392, 5447, 5502, 5558, 5615, 5670, 5726, 5781, 5838, 5894, 5949, 6004, 
-        6061, 6117, 6172, 6229, 6284, 6340, 6397, 6452, 6507, 6563, 6620, 6675, 
-        6731, 6786, 6843, 6899, 6954, 7009, 7066, 7122, 7177, 7234, 7289, 7345, 
-        7402, 7457, 7512, 7568, 7625, 7680, 7736, 7791, 7848, 7904, 7959, 8014, 
-        8071, 8127, 8182, 8239, 8294, 8350, 8407, 8462, 8517, 8573, 8630, 8685, 
-        8741, 8796, 8853, 8908, 8964, 9019, 9076, 9132, 9187, 9244, 9299, 9355, 
-        9410, 9467, 9522, 9578, 9635, 9690, 9746, 9801, 9858, 9913, 9969, 10024, 
-        10081, 10137, 10192, 10249, 10304, 10360, 10415, 10472, 10527, 10583, 10640, 10695, 
-        10751, 10806, 10863, 10918, 10974, 11029, 11086, 11142, 11197, 11254, 11309, 11365, 
-        11420, 11477, 11532, 11588, 11645, 11700, 11756, 11811, 11868, 11923, 11979, 12034, 
-        12091, 12147, 12202, 12259, 12314, 12370, 12425, 12482, 12537, 12593, 12650, 12705, 
-        12761, 12816, 12873, 12928, 12984, 13039, 13096, 13152, 13207, 13264, 13319, 13375, 
-        13430, 13487, 13542, 13598, 13655, 13710, 13766, 13821, 13878, 13933, 13989, 14044, 
-        14101, 14157, 14212, 14269, 14324, 14380, 14435, 14492, 14547, 14603, 14660, 14715, 
-        14771, 14827, 14883, 14938, 14994, 15049, 15106, 15162, 15217, 15272, 15330, 15385, 
-        15440, 15497, 15552, 15608, 15665, 15720, 15775, 15832, 15888, 15943, 15999, 16054, 
-        16111, 16167, 16222, 16277, 16335, 16390, 16445, 16502, 16557, 16613, 16670, 16725, 
-        16780, 16837, 16893, 16948, 17004, 17059, 17116, 17172, 17227, 17282, 17340, 17395, 
-        -32767, -27321, -21143, -23858, -25172, -26381, -27214, -27848, -28290, -28572, -28716, -28741, 
-        -28668, -28510, -28286, -28002, -27672, -27303, -26903, -26479, -26036, -25578, -25112, -24638, 
-        -24162, -23686, -23211, -22741, -22277, -21819, -21370, -20931, -20502, -20083, -19675, -19280, 
-        -18899, -18529, -18170, -17825, -17493, -17175, -16868, -16572, -16292, -16021, -15763, -15515, 
-        -15279, -15053, -14838, -14633, -14438, -14252, -14074, -13906, -13745, -13593, -13447, -13310, 
-        -13178, -13052, -12933, -12820, -12711, -12608, -12509, -12415, -12326, -12239, -12155, -12076, 
-        -11999, -11925, -11853, -11785, -11718, -11654, -11591, -11529, -11470, -11411, -11355, -11298, 
-        -11243, -11188, -11134, -11082, -11028, -10977, -10926, -10875, -10822, -10771, -10721, -10670, 
-        -10619, -10567, -10518, -10466, -10415, -10364, -10313, -10262, -10211, -10159, -10107, -10055, 
-        -10003, -9951, -9897, -9845, -9792, -9740, -9686, -9632, -9578, -9524, -9471, -9416, 
-        -9362, -9307, -9253, -9198, -9141, -9086, -9032, -8976, -8921, -8865, -8809, -8754, 
-        -8698, -8642, -8586, -8530, -8475, -8417, -8362, -8306, -8249, -8193, -8136, -8080, 
-        -8024, -7968, -7911, -7854, -7798, -7743, -7685, -7629, -7572, -7517, -7461, -7403, 
-        -7348, -7291, -7235, -7179, -7122, -7066, -7009, -6953, -6897, -6840, -6785, -6729, 
-        -6672, -6616, -6559, -6504, -6448, -6391, -6335, -6280, -6224, -6167, -6111, -6056, 
-        -5999, -5944, -5886, -5831, -5776, -5720, -5663, -5607, -5552, -5495, -5440, -5384, 
-        -5327, -5272, -5216, -5160, -5104, -5048, -4993, -4938, -4880, -4825, -4770, -4713, 
-        -4657, -4602, -4546, -4490, -4434, -4378, -4322, -4267, -4211, -4155, -4099, -4043, 
-        -3988, -3932, -3875, -3820, -3765, -3708, -3652, -3597, -3541, -3485, -3429, -3373, 
-        -3317, -3262, -3206, -3150, -3094, -3038, -2983, -2928, -2870, -2815, -2760, -2703, 
-        -2647, -2592, -2536, -2480, -2425, -2369, -2313, -2257, -2201, -2145, -2089, -2034, 
-        -1978, -1922, -1866, -1810, -1755, -1699, -1642, -1587, -1532, -1475, -1419, -1364, 
-        -1308, -1252, -1196, -1140, -1085, -1029, -973, -917, -861, -805, -750, -694, 
-        -637, -582, -527, -471, -414, -359, -303, -247, -191, -135, -80, -24 
-    };
-
-    // AKWF_saw_0038 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0038[600] PROGMEM = {
-        41, 92, 143, 194, 244, 296, 347, 398, 449, 501, 551, 603, 
-        653, 704, 755, 807, 857, 909, 960, 1011, 1062, 1113, 1163, 1215, 
-        1266, 1317, 1368, 1420, 1470, 1522, 1572, 1623, 1674, 1726, 1776, 1828, 
-        1879, 1930, 1981, 2032, 2082, 2134, 2185, 2236, 2287, 2339, 2389, 2441, 
-        2491, 2542, 2593, 2645, 2695, 2747, 2798, 2849, 2899, 2951, 3001, 3053, 
-        3104, 3155, 3206, 3258, 3308, 3359, 3410, 3462, 3512, 3564, 3614, 3666, 
-        3717, 3768, 3818, 3870, 3921, 3972, 4023, 4074, 4125, 4177, 4227, 4278, 
-        4329, 4381, 4431, 4483, 4533, 4585, 4636, 4687, 4737, 4789, 4840, 4891, 
-        4942, 4993, 5044, 5096, 5146, 5197, 5248, 5300, 5350, 5402, 5452, 5504, 
-        5555, 5606, 5656, 5708, 5759, 5810, 5861, 5912, 5963, 6015, 6065, 6116, 
-        6167, 6219, 6269, 6321, 6371, 6423, 6474, 6525, 6575, 6627, 6678, 6729, 
-        6780, 6831, 6882, 6934, 6984, 7035, 7086, 7138, 7188, 7240, 7290, 7342, 
-        7393, 7444, 7494, 7546, 7597, 7648, 7699, 7750, 7801, 7853, 7903, 7954, 
-        8005, 8057, 8107, 8159, 8209, 8261, 8312, 8363, 8413, 8465, 8516, 8567, 
-        8618, 8669, 8720, 8772, 8822, 8873, 8924, 8976, 9026, 9078, 9128, 9180, 
-        9231, 9282, 9332, 9384, 9435, 9486, 9537, 9588, 9639, 9691, 9741, 9792, 
-        9843, 9895, 9945, 9997, 10047, 10099, 10150, 10201, 10251, 10303, 10354, 10405, 
-        10456, 10507, 10558, 10610, 10660, 10711, 10762, 10814, 10864, 10916, 10966, 11018, 
-        11069, 11120, 11170, 11222, 11273, 11324, 11375, 11426, 11477, 11529, 11579, 11630, 
-        11681, 11733, 11783, 11835, 11885, 11937, 11988, 12039, 12089, 12141, 12192, 12243, 
-        12294, 12345, 12396, 12448, 12498, 12549, 12600, 12652, 12702, 12754, 12804, 12856, 
-        12907, 12958, 13008, 13060, 13111, 13162, 13213, 13264, 13315, 13367, 13417, 13468, 
-        13519, 13571, 13621, 13673, 13723, 13775, 13826, 13877, 13927, 13979, 14030, 14081, 
-        14132, 14183, 14234, 14286, 14336, 14387, 14438, 14490, 14540, 14592, 14642, 14694, 
-        14744, 14796, 14846, 14898, 14949, 15000, 15051, 15102, 15153, 15204, 15255, 15306, 
-        15357, 15409, 15459, 15511, 15561, 15613, 15663, 15715, 15765, 15817, 15868, -28948, 
-        -32767, -26103, -24805, -24403, -24591, -24810, -24993, -25099, -25126, -25078, -24965, -24794, 
-        -24576, -24320, -24030, -23714, -23377, -23025, -22659, -22284, -21903, -21519, -21134, -20749, 
-        -20366, -19988, -19615, -19248, -18888, -18534, -18190, -17854, -17527, -17211, -16902, -16605, 
-        -16318, -16040, -15771, -15513, -15265, -15025, -14796, -14575, -14364, -14161, -13967, -13781, 
-        -13602, -13433, -13270, -13114, -12965, -12822, -12687, -12556, -12432, -12313, -12201, -12091, 
-        -11987, -11888, -11792, -11700, -11612, -11528, -11446, -11368, -11292, -11218, -11147, -11080, 
-        -11013, -10948, -10886, -10825, -10766, -10707, -10649, -10594, -10539, -10485, -10432, -10379, 
-        -10328, -10276, -10226, -10176, -10125, -10076, -10027, -9978, -9928, -9880, -9831, -9783, 
-        -9734, -9685, -9637, -9589, -9540, -9491, -9443, -9395, -9345, -9296, -9247, -9198, 
-        -9149, -9099, -9050, -9001, -8951, -8901, -8851, -8801, -8751, -8701, -8651, -8600, 
-        -8550, -8500, -8449, -8398, -8347, -8297, -8245, -8194, -8143, -8093, -8041, -7991, 
-        -7938, -7888, -7836, -7786, -7733, -7683, -7631, -7579, -7528, -7476, -7425, -7374, 
-        -7323, -7270, -7219, -7168, -7116, -7065, -7013, -6961, -6910, -6860, -6807, -6756, 
-        -6705, -6653, -6602, -6550, -6498, -6448, -6396, -6345, -6293, -6242, -6191, -6140, 
-        -6088, -6037, -5986, -5935, -5883, -5831, -5781, -5729, -5678, -5626, -5576, -5524, 
-        -5474, -5422, -5371, -5320, -5269, -5217, -5167, -5115, -5065, -5013, -4962, -4911, 
-        -4860, -4809, -4758, -4706, -4656, -4604, -4554, -4502, -4450, -4400, -4350, -4298, 
-        -4247, -4196, -4145, -4094, -4043, -3991, -3941, -3889, -3837, -3787, -3737, -3685, 
-        -3635, -3583, -3531, -3481, -3430, -3378, -3328, -3277, -3226, -3175, -3124, -3072, 
-        -3022, -2971, -2920, -2868, -2818, -2766, -2716, -2664, -2612, -2562, -2512, -2460, 
-        -2409, -2358, -2307, -2256, -2205, -2153, -2103, -2052, -2001, -1949, -1899, -1847, 
-        -1795, -1745, -1694, -1643, -1593, -1541, -1490, -1439, -1388, -1336, -1286, -1234, 
-        -1184, -1133, -1082, -1030, -980, -928, -876, -826, -775, -724, -674, -622, 
-        -571, -520, -469, -417, -367, -315, -265, -214, -163, -111, -61, -9 
-    };
-
-    // AKWF_saw_0039 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0039[600] PROGMEM = {
-        48, 143, 239, 337, 433, 530, 628, 724, 820, 918, 1015, 1111, 
-        1207, 1304, 1398, 1496, 1592, 1689, 1786, 1883, 1979, 2077, 2173, 2270, 
-        2367, 2464, 2562, 2656, 2751, 2847, 2945, 3042, 3138, 3234, 3332, 3430, 
-        3526, 3623, 3719, 3817, 3912, 4008, 4104, 4201, 4297, 4395, 4491, 4587, 
-        4685, 4782, 4878, 4976, 5072, 5170, 5264, 5362, 5458, 5554, 5650, 5746, 
-        5844, 5941, 6038, 6134, 6231, 6329, 6425, 6520, 6617, 6712, 6811, 6905, 
-        7003, 7099, 7197, 7293, 7390, 7488, 7584, 7680, 7778, 7872, 7970, 8066, 
-        8161, 8258, 8356, 8452, 8549, 8646, 8743, 8839, 8937, 9033, 9130, 9225, 
-        9323, 9419, 9515, 9611, 9709, 9805, 9902, 9998, 10096, 10192, 10290, 10386, 
-        10482, 10578, 10675, 10770, 10868, 10964, 11061, 11157, 11255, 11351, 11449, 11545, 
-        11642, 11738, 11835, 11931, 12027, 12123, 12219, 12317, 12414, 12510, 12606, 12704, 
-        12801, 12898, 12995, 13090, 13189, 13285, 13381, 13476, 13572, 13669, 13767, 13863, 
-        13959, 14057, 14154, 14250, 14348, 14443, 14539, 14636, 14731, 14828, 14925, 15022, 
-        15118, 15216, 15312, 15409, 15506, 15603, 15701, 15797, 15893, 15989, 16084, 16181, 
-        16277, 16375, 16471, 16569, 16665, 16762, 16858, 16956, 17052, 17150, 17244, 17340, 
-        17436, 17534, 17630, 17728, 17824, 17921, 18017, 18115, 18211, 18309, 18405, 18502, 
-        18597, 18693, 18789, 18885, 18983, 19080, 19177, 19274, 19370, 19468, 19564, 19661, 
-        19758, 19855, 19950, 20044, 20142, 20238, 20336, 20432, 20529, 20627, 20723, 20819, 
-        20917, 21014, 21110, 21206, 21301, 21397, 21495, 21591, 21688, 21785, 21882, 21978, 
-        22076, 22172, 22269, 22366, 22463, 22558, 22654, 22750, 22848, 22944, 23041, 23139, 
-        23235, 23331, 23429, 23526, 23622, 23718, 23814, 23909, 24007, 24104, 24200, 24296, 
-        24394, 24490, 24588, 24684, 24781, 24877, 24975, 25073, 25167, 25263, 25361, 25456, 
-        25553, 25649, 25745, 25843, 25940, 26037, 26134, 26230, 26328, 26424, 26520, 26616, 
-        26712, 26808, 26906, 27002, 27100, 27196, 27293, 27389, 27487, 27583, 27681, 27777, 
-        27873, 27970, 28068, 28168, 28272, 28382, 28508, 28668, 28890, 29284, 29710, 32767, 
-        -32767, -29710, -29284, -28890, -28668, -28508, -28382, -28272, -28168, -28068, -27970, -27873, 
-        -27777, -27681, -27583, -27487, -27389, -27293, -27196, -27100, -27002, -26906, -26808, -26712, 
-        -26616, -26520, -26424, -26328, -26230, -26134, -26037, -25940, -25843, -25745, -25649, -25553, 
-        -25456, -25361, -25263, -25167, -25073, -24975, -24877, -24781, -24684, -24588, -24490, -24394, 
-        -24296, -24200, -24104, -24007, -23909, -23814, -23718, -23622, -23526, -23429, -23331, -23235, 
-        -23139, -23041, -22944, -22848, -22750, -22654, -22558, -22463, -22366, -22269, -22172, -22076, 
-        -21978, -21882, -21785, -21688, -21591, -21495, -21397, -21301, -21206, -21110, -21014, -20917, 
-        -20819, -20723, -20627, -20529, -20432, -20336, -20238, -20142, -20044, -19950, -19855, -19758, 
-        -19661, -19564, -19468, -19370, -19274, -19177, -19080, -18983, -18885, -18789, -18693, -18597, 
-        -18502, -18405, -18309, -18211, -18115, -18017, -17921, -17824, -17728, -17630, -17534, -17436, 
-        -17340, -17244, -17150, -17052, -16956, -16858, -16762, -16665, -16569, -16471, -16375, -16277, 
-        -16181, -16084, -15989, -15893, -15797, -15701, -15603, -15506, -15409, -15312, -15216, -15118, 
-        -15022, -14925, -14828, -14731, -14636, -14539, -14443, -14348, -14250, -14154, -14057, -13959, 
-        -13863, -13767, -13669, -13572, -13476, -13381, -13285, -13189, -13090, -12995, -12898, -12801, 
-        -12704, -12606, -12510, -12414, -12317, -12219, -12123, -12027, -11931, -11835, -11738, -11642, 
-        -11545, -11449, -11351, -11255, -11157, -11061, -10964, -10868, -10770, -10675, -10578, -10482, 
-        -10386, -10290, -10192, -10096, -9998, -9902, -9805, -9709, -9611, -9515, -9419, -9323, 
-        -9225, -9130, -9033, -8937, -8839, -8743, -8646, -8549, -8452, -8356, -8258, -8161, 
-        -8066, -7970, -7872, -7778, -7680, -7584, -7488, -7390, -7293, -7197, -7099, -7003, 
-        -6905, -6811, -6712, -6617, -6520, -6425, -6329, -6231, -6134, -6038, -5941, -5844, 
-        -5746, -5650, -5554, -5458, -5362, -5264, -5170, -5072, -4976, -4878, -4782, -4685, 
-        -4587, -4491, -4395, -4297, -4201, -4104, -4008, -3912, -3817, -3719, -3623, -3526, 
-        -3430, -3332, -3234, -3138, -3042, -2945, -2847, -2751, -2656, -2562, -2464, -2367, 
-        -2270, -2173, -2077, -1979, -1883, -1786, -1689, -1592, -1496, -1398, -1304, -1207, 
-        -1111, -1015, -918, -820, -724, -628, -530, -433, -337, -239, -143, -48 
-    };
-
-    // AKWF_saw_0040 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0040[600] PROGMEM = {
-        41, 124, 208, 295, 377, 461, 546, 630, 715, 799, 883, 968, 
-        1050, 1135, 1219, 1304, 1388, 1473, 1556, 1639, 1725, 1808, 1892, 1976, 
-        2061, 2145, 2228, 2314, 2398, 2481, 2567, 2650, 2734, 2818, 2903, 2987, 
-        3072, 3154, 3241, 3323, 3407, 3492, 3576, 3660, 3745, 3827, 3912, 3996, 
-        4081, 4165, 4247, 4334, 4418, 4502, 4585, 4669, 4754, 4840, 4922, 5006, 
-        5091, 5175, 5260, 5342, 5427, 5513, 5595, 5680, 5764, 5849, 5933, 6018, 
-        6100, 6186, 6271, 6353, 6437, 6521, 6606, 6691, 6773, 6859, 6942, 7028, 
-        7111, 7195, 7279, 7363, 7448, 7532, 7615, 7701, 7786, 7868, 7952, 8037, 
-        8121, 8205, 8290, 8372, 8457, 8543, 8626, 8710, 8794, 8879, 8963, 9047, 
-        9130, 9214, 9299, 9383, 9468, 9550, 9636, 9719, 9805, 9889, 9972, 10058, 
-        10140, 10225, 10309, 10394, 10478, 10563, 10645, 10729, 10816, 10898, 10982, 11065, 
-        11151, 11236, 11318, 11403, 11487, 11571, 11656, 11740, 11824, 11907, 11994, 12076, 
-        12160, 12245, 12329, 12413, 12497, 12580, 12666, 12749, 12835, 12918, 13002, 13087, 
-        13171, 13255, 13339, 13424, 13508, 13590, 13675, 13760, 13844, 13928, 14013, 14095, 
-        14181, 14264, 14348, 14433, 14517, 14602, 14686, 14770, 14855, 14939, 15023, 15106, 
-        15190, 15274, 15361, 15443, 15527, 15612, 15696, 15781, 15863, 15948, 16032, 16116, 
-        16201, 16285, 16368, 16454, 16539, 16621, 16707, 16790, 16874, 16958, 17041, 17127, 
-        17210, 17294, 17380, 17463, 17547, 17632, 17716, 17800, 17883, 17969, 18052, 18136, 
-        18220, 18307, 18389, 18473, 18558, 18642, 18725, 18811, 18893, 18978, 19062, 19147, 
-        19231, 19315, 19400, 19484, 19567, 19651, 19735, 19819, 19904, 19988, 20071, 20157, 
-        20240, 20326, 20409, 20493, 20578, 20661, 20746, 20830, 20915, 20999, 21084, 21166, 
-        21251, 21334, 21419, 21503, 21586, 21672, 21755, 21839, 21924, 22008, 22092, 22177, 
-        22259, 22345, 22428, 22514, 22597, 22681, 22766, 22850, 22934, 23018, 23101, 23187, 
-        23270, 23356, 23438, 23523, 23608, 23692, 23776, 23859, 23945, 24029, 24111, 24196, 
-        24283, 24367, 24453, 24544, 24635, 24741, 24869, 25057, 25341, 26002, 26460, 32767, 
-        -32767, -26460, -26002, -25341, -25057, -24869, -24741, -24635, -24544, -24453, -24367, -24283, 
-        -24196, -24111, -24029, -23945, -23859, -23776, -23692, -23608, -23523, -23438, -23356, -23270, 
-        -23187, -23101, -23018, -22934, -22850, -22766, -22681, -22597, -22514, -22428, -22345, -22259, 
-        -22177, -22092, -22008, -21924, -21839, -21755, -21672, -21586, -21503, -21419, -21334, -21251, 
-        -21166, -21084, -20999, -20915, -20830, -20746, -20661, -20578, -20493, -20409, -20326, -20240, 
-        -20157, -20071, -19988, -19904, -19819, -19735, -19651, -19567, -19484, -19400, -19315, -19231, 
-        -19147, -19062, -18978, -18893, -18811, -18725, -18642, -18558, -18473, -18389, -18307, -18220, 
-        -18136, -18052, -17969, -17883, -17800, -17716, -17632, -17547, -17463, -17380, -17294, -17210, 
-        -17127, -17041, -16958, -16874, -16790, -16707, -16621, -16539, -16454, -16368, -16285, -16201, 
-        -16116, -16032, -15948, -15863, -15781, -15696, -15612, -15527, -15443, -15361, -15274, -15190, 
-        -15106, -15023, -14939, -14855, -14770, -14686, -14602, -14517, -14433, -14348, -14264, -14181, 
-        -14095, -14013, -13928, -13844, -13760, -13675, -13590, -13508, -13424, -13339, -13255, -13171, 
-        -13087, -13002, -12918, -12835, -12749, -12666, -12580, -12497, -12413, -12329, -12245, -12160, 
-        -12076, -11994, -11907, -11824, -11740, -11656, -11571, -11487, -11403, -11318, -11236, -11151, 
-        -11065, -10982, -10898, -10816, -10729, -10645, -10563, -10478, -10394, -10309, -10225, -10140, 
-        -10058, -9972, -9889, -9805, -9719, -9636, -9550, -9468, -9383, -9299, -9214, -9130, 
-        -9047, -8963, -8879, -8794, -8710, -8626, -8543, -8457, -8372, -8290, -8205, -8121, 
-        -8037, -7952, -7868, -7786, -7701, -7615, -7532, -7448, -7363, -7279, -7195, -7111, 
-        -7028, -6942, -6859, -6773, -6691, -6606, -6521, -6437, -6353, -6271, -6186, -6100, 
-        -6018, -5933, -5849, -5764, -5680, -5595, -5513, -5427, -5342, -5260, -5175, -5091, 
-        -5006, -4922, -4840, -4754, -4669, -4585, -4502, -4418, -4334, -4247, -4165, -4081, 
-        -3996, -3912, -3827, -3745, -3660, -3576, -3492, -3407, -3323, -3241, -3154, -3072, 
-        -2987, -2903, -2818, -2734, -2650, -2567, -2481, -2398, -2314, -2228, -2145, -2061, 
-        -1976, -1892, -1808, -1725, -1639, -1556, -1473, -1388, -1304, -1219, -1135, -1050, 
-        -968, -883, -799, -715, -630, -546, -461, -377, -295, -208, -124, -41 
-    };
-
-    // AKWF_saw_0041 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0041[600] PROGMEM = {
-        33, 112, 191, 271, 349, 428, 507, 586, 666, 744, 823, 903, 
-        982, 1059, 1138, 1217, 1298, 1377, 1454, 1533, 1612, 1691, 1770, 1851, 
-        1930, 2009, 2088, 2165, 2244, 2323, 2404, 2481, 2560, 2639, 2718, 2799, 
-        2876, 2957, 3036, 3115, 3194, 3273, 3352, 3431, 3510, 3587, 3666, 3747, 
-        3826, 3905, 3984, 4063, 4142, 4220, 4299, 4378, 4457, 4536, 4615, 4694, 
-        4773, 4852, 4931, 5010, 5089, 5170, 5249, 5326, 5405, 5484, 5563, 5642, 
-        5721, 5800, 5881, 5958, 6037, 6116, 6195, 6276, 6355, 6432, 6513, 6590, 
-        6671, 6748, 6827, 6906, 6985, 7064, 7143, 7222, 7303, 7382, 7460, 7538, 
-        7618, 7696, 7776, 7854, 7933, 8015, 8092, 8170, 8250, 8329, 8408, 8487, 
-        8566, 8645, 8724, 8803, 8882, 8960, 9039, 9118, 9198, 9277, 9356, 9435, 
-        9514, 9595, 9672, 9753, 9830, 9909, 9986, 10065, 10148, 10225, 10304, 10383, 
-        10462, 10541, 10620, 10699, 10779, 10857, 10936, 11015, 11092, 11173, 11253, 11331, 
-        11410, 11489, 11569, 11647, 11727, 11805, 11885, 11963, 12043, 12121, 12200, 12280, 
-        12358, 12437, 12517, 12595, 12675, 12754, 12832, 12912, 12991, 13070, 13149, 13226, 
-        13307, 13384, 13463, 13542, 13623, 13702, 13781, 13860, 13939, 14018, 14095, 14176, 
-        14255, 14332, 14413, 14490, 14569, 14650, 14729, 14808, 14887, 14964, 15045, 15124, 
-        15203, 15282, 15359, 15440, 15519, 15598, 15677, 15756, 15835, 15914, 15993, 16072, 
-        16152, 16229, 16308, 16387, 16466, 16547, 16624, 16703, 16782, 16861, 16940, 17019, 
-        17098, 17179, 17258, 17335, 17414, 17495, 17574, 17653, 17730, 17809, 17888, 17967, 
-        18048, 18127, 18206, 18285, 18364, 18441, 18520, 18599, 18680, 18757, 18836, 18915, 
-        18994, 19073, 19154, 19233, 19312, 19390, 19469, 19547, 19627, 19706, 19785, 19863, 
-        19943, 20021, 20101, 20180, 20259, 20338, 20417, 20496, 20575, 20656, 20733, 20812, 
-        20891, 20969, 21049, 21128, 21207, 21286, 21365, 21446, 21523, 21602, 21681, 21762, 
-        21839, 21920, 21997, 22076, 22157, 22234, 22313, 22392, 22471, 22551, 22630, 22709, 
-        22788, 22869, 22950, 23032, 23122, 23221, 23348, 23542, 23826, 24608, 24910, 32767, 
-        -31227, -24926, -24474, -23818, -23539, -23357, -23232, -23133, -23044, -22961, -22878, -22798, 
-        -22719, -22640, -22563, -22484, -22403, -22324, -22247, -22166, -22087, -22008, -21929, -21850, 
-        -21771, -21692, -21613, -21534, -21457, -21376, -21299, -21218, -21139, -21060, -20981, -20902, 
-        -20822, -20744, -20664, -20586, -20507, -20428, -20351, -20269, -20191, -20112, -20033, -19954, 
-        -19874, -19795, -19717, -19637, -19558, -19481, -19402, -19323, -19242, -19165, -19086, -19007, 
-        -18928, -18847, -18768, -18691, -18610, -18531, -18454, -18373, -18296, -18217, -18136, -18059, 
-        -17980, -17899, -17822, -17741, -17662, -17585, -17504, -17425, -17346, -17267, -17190, -17109, 
-        -17032, -16951, -16874, -16793, -16714, -16635, -16556, -16477, -16397, -16320, -16241, -16162, 
-        -16084, -16004, -15925, -15846, -15767, -15688, -15609, -15530, -15452, -15372, -15291, -15214, 
-        -15135, -15056, -14977, -14896, -14819, -14740, -14661, -14582, -14503, -14424, -14343, -14264, 
-        -14185, -14108, -14029, -13952, -13871, -13792, -13713, -13634, -13555, -13476, -13397, -13318, 
-        -13238, -13159, -13080, -13002, -12922, -12843, -12764, -12686, -12607, -12528, -12448, -12369, 
-        -12290, -12211, -12132, -12053, -11974, -11895, -11816, -11737, -11659, -11580, -11500, -11421, 
-        -11342, -11263, -11184, -11105, -11024, -10947, -10868, -10789, -10710, -10631, -10554, -10475, 
-        -10392, -10315, -10236, -10157, -10078, -9999, -9919, -9841, -9761, -9683, -9603, -9525, 
-        -9448, -9367, -9288, -9209, -9130, -9051, -8971, -8892, -8813, -8735, -8655, -8577, 
-        -8497, -8419, -8340, -8260, -8181, -8103, -8023, -7944, -7865, -7786, -7709, -7628, 
-        -7549, -7470, -7391, -7314, -7235, -7156, -7075, -6996, -6917, -6838, -6759, -6680, 
-        -6603, -6521, -6443, -6364, -6287, -6208, -6127, -6048, -5969, -5890, -5811, -5732, 
-        -5653, -5574, -5494, -5416, -5337, -5258, -5181, -5100, -5020, -4942, -4863, -4784, 
-        -4705, -4626, -4546, -4469, -4388, -4311, -4232, -4153, -4074, -3993, -3916, -3837, 
-        -3758, -3679, -3598, -3521, -3442, -3361, -3282, -3205, -3124, -3047, -2966, -2889, 
-        -2810, -2731, -2650, -2571, -2492, -2413, -2334, -2255, -2178, -2099, -2018, -1941, 
-        -1860, -1783, -1704, -1625, -1544, -1465, -1386, -1309, -1229, -1150, -1071, -992, 
-        -914, -834, -756, -677, -598, -518, -439, -360, -281, -202, -123, -44 
-    };
-
-    // AKWF_saw_0042 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0042[600] PROGMEM = {
-        31, 100, 169, 237, 306, 375, 444, 512, 581, 650, 719, 786, 
-        856, 923, 990, 1061, 1128, 1196, 1265, 1334, 1403, 1471, 1540, 1609, 
-        1678, 1746, 1815, 1880, 1949, 2020, 2087, 2155, 2224, 2293, 2361, 2430, 
-        2499, 2568, 2635, 2705, 2774, 2839, 2910, 2978, 3045, 3114, 3183, 3252, 
-        3320, 3389, 3458, 3527, 3595, 3664, 3729, 3800, 3869, 3936, 4004, 4073, 
-        4142, 4211, 4279, 4348, 4417, 4485, 4554, 4621, 4688, 4759, 4827, 4894, 
-        4963, 5032, 5101, 5169, 5238, 5307, 5374, 5443, 5511, 5578, 5649, 5718, 
-        5785, 5853, 5922, 5991, 6060, 6128, 6197, 6266, 6335, 6403, 6470, 6537, 
-        6606, 6676, 6743, 6812, 6881, 6950, 7018, 7087, 7156, 7225, 7293, 7362, 
-        7429, 7498, 7568, 7634, 7702, 7771, 7840, 7909, 7977, 8046, 8115, 8184, 
-        8252, 8321, 8386, 8457, 8526, 8593, 8661, 8730, 8799, 8867, 8936, 9005, 
-        9074, 9142, 9209, 9278, 9347, 9416, 9483, 9551, 9620, 9689, 9758, 9826, 
-        9895, 9964, 10033, 10101, 10170, 10235, 10306, 10376, 10442, 10510, 10579, 10648, 
-        10717, 10785, 10854, 10923, 10992, 11060, 11127, 11196, 11266, 11333, 11400, 11471, 
-        11538, 11607, 11675, 11744, 11813, 11882, 11950, 12019, 12086, 12157, 12224, 12291, 
-        12359, 12428, 12497, 12566, 12634, 12703, 12772, 12841, 12909, 12976, 13045, 13114, 
-        13182, 13249, 13320, 13387, 13456, 13524, 13593, 13662, 13731, 13798, 13866, 13935, 
-        14004, 14073, 14140, 14208, 14277, 14346, 14415, 14483, 14550, 14619, 14688, 14757, 
-        14825, 14894, 14963, 15030, 15099, 15167, 15236, 15303, 15372, 15440, 15509, 15578, 
-        15647, 15715, 15784, 15853, 15922, 15989, 16057, 16126, 16193, 16262, 16331, 16399, 
-        16468, 16537, 16606, 16674, 16741, 16812, 16881, 16946, 17016, 17085, 17152, 17221, 
-        17290, 17358, 17427, 17496, 17564, 17633, 17702, 17771, 17838, 17906, 17977, 18042, 
-        18111, 18180, 18248, 18317, 18386, 18455, 18523, 18592, 18661, 18730, 18797, 18865, 
-        18934, 19003, 19072, 19139, 19207, 19276, 19345, 19414, 19482, 19551, 19620, 19687, 
-        19755, 19826, 19895, 19969, 20048, 20142, 20260, 20468, 20737, 21811, 21672, 32767, 
-        -32767, -21672, -21811, -20737, -20468, -20260, -20142, -20048, -19969, -19895, -19826, -19755, 
-        -19687, -19620, -19551, -19482, -19414, -19345, -19276, -19207, -19139, -19072, -19003, -18934, 
-        -18865, -18797, -18730, -18661, -18592, -18523, -18455, -18386, -18317, -18248, -18180, -18111, 
-        -18042, -17977, -17906, -17838, -17771, -17702, -17633, -17564, -17496, -17427, -17358, -17290, 
-        -17221, -17152, -17085, -17016, -16946, -16881, -16812, -16741, -16674, -16606, -16537, -16468, 
-        -16399, -16331, -16262, -16193, -16126, -16057, -15989, -15922, -15853, -15784, -15715, -15647, 
-        -15578, -15509, -15440, -15372, -15303, -15236, -15167, -15099, -15030, -14963, -14894, -14825, 
-        -14757, -14688, -14619, -14550, -14483, -14415, -14346, -14277, -14208, -14140, -14073, -14004, 
-        -13935, -13866, -13798, -13731, -13662, -13593, -13524, -13456, -13387, -13320, -13249, -13182, 
-        -13114, -13045, -12976, -12909, -12841, -12772, -12703, -12634, -12566, -12497, -12428, -12359, 
-        -12291, -12224, -12157, -12086, -12019, -11950, -11882, -11813, -11744, -11675, -11607, -11538, 
-        -11471, -11400, -11333, -11266, -11196, -11127, -11060, -10992, -10923, -10854, -10785, -10717, 
-        -10648, -10579, -10510, -10442, -10376, -10306, -10235, -10170, -10101, -10033, -9964, -9895, 
-        -9826, -9758, -9689, -9620, -9551, -9483, -9416, -9347, -9278, -9209, -9142, -9074, 
-        -9005, -8936, -8867, -8799, -8730, -8661, -8593, -8526, -8457, -8386, -8321, -8252, 
-        -8184, -8115, -8046, -7977, -7909, -7840, -7771, -7702, -7634, -7568, -7498, -7429, 
-        -7362, -7293, -7225, -7156, -7087, -7018, -6950, -6881, -6812, -6743, -6676, -6606, 
-        -6537, -6470, -6403, -6335, -6266, -6197, -6128, -6060, -5991, -5922, -5853, -5785, 
-        -5718, -5649, -5578, -5511, -5443, -5374, -5307, -5238, -5169, -5101, -5032, -4963, 
-        -4894, -4827, -4759, -4688, -4621, -4554, -4485, -4417, -4348, -4279, -4211, -4142, 
-        -4073, -4004, -3936, -3869, -3800, -3729, -3664, -3595, -3527, -3458, -3389, -3320, 
-        -3252, -3183, -3114, -3045, -2978, -2910, -2839, -2774, -2705, -2635, -2568, -2499, 
-        -2430, -2361, -2293, -2224, -2155, -2087, -2020, -1949, -1880, -1815, -1746, -1678, 
-        -1609, -1540, -1471, -1403, -1334, -1265, -1196, -1128, -1061, -990, -923, -856, 
-        -786, -719, -650, -581, -512, -444, -375, -306, -237, -169, -100, -31 
-    };
-
-    // AKWF_saw_0043 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0043[600] PROGMEM = {
-        30, 88, 146, 206, 264, 324, 384, 441, 501, 559, 619, 677, 
-        736, 796, 854, 914, 974, 1032, 1091, 1151, 1209, 1267, 1327, 1385, 
-        1444, 1504, 1564, 1622, 1682, 1740, 1798, 1859, 1919, 1977, 2035, 2095, 
-        2153, 2212, 2272, 2330, 2390, 2448, 2508, 2566, 2627, 2685, 2745, 2803, 
-        2861, 2921, 2980, 3038, 3098, 3158, 3216, 3274, 3335, 3393, 3451, 3513, 
-        3571, 3627, 3688, 3748, 3806, 3864, 3926, 3982, 4042, 4103, 4161, 4219, 
-        4279, 4337, 4397, 4456, 4516, 4572, 4632, 4692, 4752, 4810, 4869, 4927, 
-        4987, 5045, 5105, 5165, 5224, 5282, 5342, 5400, 5458, 5518, 5577, 5637, 
-        5695, 5755, 5813, 5873, 5932, 5992, 6050, 6108, 6166, 6226, 6285, 6345, 
-        6403, 6463, 6521, 6581, 6639, 6700, 6758, 6816, 6876, 6936, 6993, 7053, 
-        7113, 7171, 7231, 7289, 7347, 7406, 7466, 7526, 7584, 7644, 7702, 7762, 
-        7821, 7879, 7939, 7997, 8055, 8115, 8176, 8234, 8294, 8352, 8412, 8470, 
-        8529, 8587, 8645, 8705, 8765, 8823, 8883, 8942, 9002, 9060, 9120, 9178, 
-        9237, 9297, 9355, 9413, 9473, 9531, 9591, 9650, 9710, 9768, 9828, 9886, 
-        9946, 10005, 10063, 10123, 10181, 10239, 10299, 10358, 10418, 10476, 10536, 10594, 
-        10654, 10712, 10773, 10831, 10891, 10949, 11007, 11067, 11126, 11184, 11244, 11302, 
-        11362, 11422, 11481, 11539, 11599, 11657, 11717, 11775, 11834, 11894, 11952, 12012, 
-        12070, 12130, 12188, 12247, 12307, 12367, 12423, 12485, 12543, 12602, 12662, 12720, 
-        12778, 12838, 12896, 12956, 13015, 13075, 13133, 13193, 13251, 13311, 13370, 13428, 
-        13488, 13546, 13604, 13664, 13723, 13783, 13841, 13901, 13959, 14017, 14078, 14138, 
-        14194, 14254, 14312, 14372, 14431, 14491, 14551, 14609, 14667, 14727, 14785, 14846, 
-        14906, 14962, 15022, 15080, 15140, 15199, 15257, 15319, 15375, 15435, 15495, 15554, 
-        15612, 15672, 15730, 15790, 15848, 15908, 15965, 16025, 16085, 16143, 16203, 16261, 
-        16320, 16380, 16440, 16498, 16556, 16616, 16675, 16733, 16793, 16851, 16911, 16971, 
-        17029, 17091, 17155, 17223, 17307, 17407, 17644, 17811, 19294, 18241, 32767, -28, 
-        28, -32767, -18241, -19294, -17811, -17644, -17407, -17307, -17223, -17155, -17091, -17029, 
-        -16971, -16911, -16851, -16793, -16733, -16675, -16616, -16556, -16498, -16440, -16380, -16320, 
-        -16261, -16203, -16143, -16085, -16025, -15965, -15908, -15848, -15790, -15730, -15672, -15612, 
-        -15554, -15495, -15435, -15375, -15319, -15257, -15199, -15140, -15080, -15022, -14962, -14906, 
-        -14846, -14785, -14727, -14667, -14609, -14551, -14491, -14431, -14372, -14312, -14254, -14194, 
-        -14138, -14078, -14017, -13959, -13901, -13841, -13783, -13723, -13664, -13604, -13546, -13488, 
-        -13428, -13370, -13311, -13251, -13193, -13133, -13075, -13015, -12956, -12896, -12838, -12778, 
-        -12720, -12662, -12602, -12543, -12485, -12423, -12367, -12307, -12247, -12188, -12130, -12070, 
-        -12012, -11952, -11894, -11834, -11775, -11717, -11657, -11599, -11539, -11481, -11422, -11362, 
-        -11302, -11244, -11184, -11126, -11067, -11007, -10949, -10891, -10831, -10773, -10712, -10654, 
-        -10594, -10536, -10476, -10418, -10358, -10299, -10239, -10181, -10123, -10063, -10005, -9946, 
-        -9886, -9828, -9768, -9710, -9650, -9591, -9531, -9473, -9413, -9355, -9297, -9237, 
-        -9178, -9120, -9060, -9002, -8942, -8883, -8823, -8765, -8705, -8645, -8587, -8529, 
-        -8470, -8412, -8352, -8294, -8234, -8176, -8115, -8055, -7997, -7939, -7879, -7821, 
-        -7762, -7702, -7644, -7584, -7526, -7466, -7406, -7347, -7289, -7231, -7171, -7113, 
-        -7053, -6993, -6936, -6876, -6816, -6758, -6700, -6639, -6581, -6521, -6463, -6403, 
-        -6345, -6285, -6226, -6166, -6108, -6050, -5992, -5932, -5873, -5813, -5755, -5695, 
-        -5637, -5577, -5518, -5458, -5400, -5342, -5282, -5224, -5165, -5105, -5045, -4987, 
-        -4927, -4869, -4810, -4752, -4692, -4632, -4572, -4516, -4456, -4397, -4337, -4279, 
-        -4219, -4161, -4103, -4042, -3982, -3926, -3864, -3806, -3748, -3688, -3627, -3571, 
-        -3513, -3451, -3393, -3335, -3274, -3216, -3158, -3098, -3038, -2980, -2921, -2861, 
-        -2803, -2745, -2685, -2627, -2566, -2508, -2448, -2390, -2330, -2272, -2212, -2153, 
-        -2095, -2035, -1977, -1919, -1859, -1798, -1740, -1682, -1622, -1564, -1504, -1444, 
-        -1385, -1327, -1267, -1209, -1151, -1091, -1032, -974, -914, -854, -796, -736, 
-        -677, -619, -559, -501, -441, -384, -324, -264, -206, -146, -88, -30 
-    };
-
-    // AKWF_saw_0044 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0044[600] PROGMEM = {
-        20, 62, 105, 148, 192, 233, 277, 318, 361, 403, 446, 488, 
-        531, 574, 616, 659, 703, 744, 787, 829, 874, 916, 959, 1000, 
-        1044, 1085, 1131, 1172, 1213, 1255, 1298, 1342, 1385, 1426, 1470, 1511, 
-        1555, 1598, 1641, 1683, 1726, 1768, 1811, 1852, 1898, 1939, 1981, 2024, 
-        2067, 2109, 2152, 2196, 2237, 2280, 2324, 2365, 2409, 2450, 2491, 2535, 
-        2578, 2622, 2663, 2706, 2748, 2791, 2835, 2876, 2919, 2963, 3004, 3048, 
-        3091, 3132, 3174, 3219, 3261, 3304, 3345, 3389, 3430, 3474, 3517, 3560, 
-        3602, 3643, 3687, 3730, 3771, 3815, 3858, 3900, 3941, 3986, 4028, 4071, 
-        4113, 4156, 4197, 4241, 4284, 4328, 4369, 4410, 4456, 4497, 4539, 4582, 
-        4625, 4667, 4708, 4754, 4795, 4838, 4880, 4923, 4967, 5010, 5051, 5095, 
-        5138, 5178, 5223, 5264, 5306, 5349, 5393, 5434, 5477, 5521, 5562, 5606, 
-        5649, 5690, 5734, 5777, 5819, 5860, 5903, 5947, 5990, 6032, 6075, 6116, 
-        6160, 6201, 6245, 6288, 6329, 6373, 6416, 6460, 6501, 6544, 6586, 6627, 
-        6671, 6714, 6757, 6799, 6842, 6886, 6927, 6970, 7014, 7055, 7097, 7142, 
-        7183, 7227, 7268, 7312, 7353, 7396, 7438, 7481, 7525, 7566, 7609, 7653, 
-        7694, 7738, 7779, 7822, 7866, 7909, 7951, 7994, 8035, 8079, 8120, 8164, 
-        8207, 8248, 8290, 8333, 8379, 8420, 8461, 8505, 8546, 8590, 8633, 8676, 
-        8718, 8761, 8803, 8846, 8889, 8931, 8974, 9016, 9059, 9102, 9144, 9187, 
-        9231, 9272, 9315, 9357, 9400, 9444, 9485, 9528, 9572, 9613, 9655, 9700, 
-        9741, 9783, 9826, 9870, 9911, 9954, 9998, 10039, 10083, 10126, 10167, 10211, 
-        10252, 10298, 10339, 10380, 10424, 10465, 10509, 10552, 10595, 10637, 10680, 10722, 
-        10765, 10808, 10850, 10893, 10935, 10976, 11021, 11065, 11106, 11148, 11191, 11234, 
-        11276, 11319, 11363, 11404, 11447, 11491, 11532, 11576, 11619, 11658, 11702, 11745, 
-        11789, 11830, 11873, 11915, 11958, 12002, 12043, 12086, 12130, 12171, 12215, 12258, 
-        12301, 12343, 12395, 12430, 12531, 12517, 12974, 12504, 15515, 11247, 32767, -20, 
-        20, -32767, -11247, -15515, -12504, -12974, -12517, -12531, -12430, -12395, -12343, -12301, 
-        -12258, -12215, -12171, -12130, -12086, -12043, -12002, -11958, -11915, -11873, -11830, -11789, 
-        -11745, -11702, -11658, -11619, -11576, -11532, -11491, -11447, -11404, -11363, -11319, -11276, 
-        -11234, -11191, -11148, -11106, -11065, -11021, -10976, -10935, -10893, -10850, -10808, -10765, 
-        -10722, -10680, -10637, -10595, -10552, -10509, -10465, -10424, -10380, -10339, -10298, -10252, 
-        -10211, -10167, -10126, -10083, -10039, -9998, -9954, -9911, -9870, -9826, -9783, -9741, 
-        -9700, -9655, -9613, -9572, -9528, -9485, -9444, -9400, -9357, -9315, -9272, -9231, 
-        -9187, -9144, -9102, -9059, -9016, -8974, -8931, -8889, -8846, -8803, -8761, -8718, 
-        -8676, -8633, -8590, -8546, -8505, -8461, -8420, -8379, -8333, -8290, -8248, -8207, 
-        -8164, -8120, -8079, -8035, -7994, -7951, -7909, -7866, -7822, -7779, -7738, -7694, 
-        -7653, -7609, -7566, -7525, -7481, -7438, -7396, -7353, -7312, -7268, -7227, -7183, 
-        -7142, -7097, -7055, -7014, -6970, -6927, -6886, -6842, -6799, -6757, -6714, -6671, 
-        -6627, -6586, -6544, -6501, -6460, -6416, -6373, -6329, -6288, -6245, -6201, -6160, 
-        -6116, -6075, -6032, -5990, -5947, -5903, -5860, -5819, -5777, -5734, -5690, -5649, 
-        -5606, -5562, -5521, -5477, -5434, -5393, -5349, -5306, -5264, -5223, -5178, -5138, 
-        -5095, -5051, -5010, -4967, -4923, -4880, -4838, -4795, -4754, -4708, -4667, -4625, 
-        -4582, -4539, -4497, -4456, -4410, -4369, -4328, -4284, -4241, -4197, -4156, -4113, 
-        -4071, -4028, -3986, -3941, -3900, -3858, -3815, -3771, -3730, -3687, -3643, -3602, 
-        -3560, -3517, -3474, -3430, -3389, -3345, -3304, -3261, -3219, -3174, -3132, -3091, 
-        -3048, -3004, -2963, -2919, -2876, -2835, -2791, -2748, -2706, -2663, -2622, -2578, 
-        -2535, -2491, -2450, -2409, -2365, -2324, -2280, -2237, -2196, -2152, -2109, -2067, 
-        -2024, -1981, -1939, -1898, -1852, -1811, -1768, -1726, -1683, -1641, -1598, -1555, 
-        -1511, -1470, -1426, -1385, -1342, -1298, -1255, -1213, -1172, -1131, -1085, -1044, 
-        -1000, -959, -916, -874, -829, -787, -744, -703, -659, -616, -574, -531, 
-        -488, -446, -403, -361, -318, -277, -233, -192, -148, -105, -62, -20 
-    };
-
-    // AKWF_saw_0045 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0045[600] PROGMEM = {
-        84, 251, 420, 590, 759, 927, 1095, 1262, 1428, 1593, 1759, 1924, 
-        2087, 2247, 2407, 2569, 2731, 2892, 3052, 3211, 3370, 3529, 3686, 3844, 
-        4001, 4156, 4313, 4464, 4615, 4769, 4922, 5075, 5227, 5378, 5529, 5680, 
-        5829, 5978, 6127, 6274, 6421, 6565, 6711, 6859, 7002, 7147, 7290, 7434, 
-        7578, 7720, 7862, 8004, 8145, 8284, 8422, 8562, 8701, 8836, 8974, 9112, 
-        9249, 9385, 9520, 9656, 9790, 9925, 10058, 10189, 10322, 10452, 10585, 10715, 
-        10845, 10976, 11106, 11236, 11364, 11492, 11621, 11747, 11875, 11998, 12125, 12250, 
-        12372, 12497, 12621, 12745, 12868, 12991, 13113, 13235, 13356, 13476, 13597, 13715, 
-        13834, 13953, 14070, 14188, 14306, 14423, 14540, 14656, 14772, 14888, 15003, 15117, 
-        15229, 15343, 15457, 15568, 15680, 15792, 15905, 16015, 16126, 16236, 16347, 16456, 
-        16565, 16674, 16780, 16889, 16996, 17101, 17208, 17314, 17421, 17526, 17631, 17736, 
-        17840, 17944, 18048, 18149, 18254, 18356, 18456, 18556, 18657, 18758, 18859, 18959, 
-        19058, 19158, 19256, 19356, 19454, 19550, 19648, 19745, 19840, 19936, 20032, 20128, 
-        20223, 20318, 20413, 20508, 20601, 20694, 20788, 20880, 20973, 21064, 21154, 21245, 
-        21337, 21428, 21518, 21608, 21698, 21787, 21876, 21964, 22053, 22142, 22227, 22314, 
-        22401, 22487, 22575, 22661, 22746, 22832, 22917, 23002, 23086, 23171, 23254, 23338, 
-        23420, 23502, 23584, 23667, 23749, 23830, 23912, 23993, 24074, 24154, 24234, 24315, 
-        24394, 24473, 24550, 24628, 24706, 24784, 24862, 24940, 25017, 25094, 25170, 25247, 
-        25324, 25399, 25474, 25549, 25622, 25697, 25771, 25846, 25920, 25993, 26067, 26139, 
-        26212, 26284, 26357, 26429, 26500, 26571, 26640, 26711, 26782, 26852, 26921, 26992, 
-        27061, 27130, 27200, 27268, 27337, 27405, 27472, 27538, 27606, 27674, 27740, 27806, 
-        27873, 27940, 28006, 28071, 28136, 28202, 28267, 28331, 28395, 28459, 28523, 28586, 
-        28650, 28712, 28776, 28838, 28901, 28964, 29025, 29087, 29148, 29211, 29271, 29331, 
-        29392, 29452, 29512, 29572, 29632, 29691, 29751, 29810, 29868, 29928, 29986, 30045, 
-        30101, 30160, 30218, 30278, 30338, 30404, 30478, 30570, 30698, 30924, 31162, 32767, 
-        -32767, -31162, -30924, -30698, -30570, -30478, -30404, -30338, -30278, -30218, -30160, -30101, 
-        -30045, -29986, -29928, -29868, -29810, -29751, -29691, -29632, -29572, -29512, -29452, -29392, 
-        -29331, -29271, -29211, -29148, -29087, -29025, -28964, -28901, -28838, -28776, -28712, -28650, 
-        -28586, -28523, -28459, -28395, -28331, -28267, -28202, -28136, -28071, -28006, -27940, -27873, 
-        -27806, -27740, -27674, -27606, -27538, -27472, -27405, -27337, -27268, -27200, -27130, -27061, 
-        -26992, -26921, -26852, -26782, -26711, -26640, -26571, -26500, -26429, -26357, -26284, -26212, 
-        -26139, -26067, -25993, -25920, -25846, -25771, -25697, -25622, -25549, -25474, -25399, -25324, 
-        -25247, -25170, -25094, -25017, -24940, -24862, -24784, -24706, -24628, -24550, -24473, -24394, 
-        -24315, -24234, -24154, -24074, -23993, -23912, -23830, -23749, -23667, -23584, -23502, -23420, 
-        -23338, -23254, -23171, -23086, -23002, -22917, -22832, -22746, -22661, -22575, -22487, -22401, 
-        -22314, -22227, -22142, -22053, -21964, -21876, -21787, -21698, -21608, -21518, -21428, -21337, 
-        -21245, -21154, -21064, -20973, -20880, -20788, -20694, -20601, -20508, -20413, -20318, -20223, 
-        -20128, -20032, -19936, -19840, -19745, -19648, -19550, -19454, -19356, -19256, -19158, -19058, 
-        -18959, -18859, -18758, -18657, -18556, -18456, -18356, -18254, -18149, -18048, -17944, -17840, 
-        -17736, -17631, -17526, -17421, -17314, -17208, -17101, -16996, -16889, -16780, -16674, -16565, 
-        -16456, -16347, -16236, -16126, -16015, -15905, -15792, -15680, -15568, -15457, -15343, -15229, 
-        -15117, -15003, -14888, -14772, -14656, -14540, -14423, -14306, -14188, -14070, -13953, -13834, 
-        -13715, -13597, -13476, -13356, -13235, -13113, -12991, -12868, -12745, -12621, -12497, -12372, 
-        -12250, -12125, -11998, -11875, -11747, -11621, -11492, -11364, -11236, -11106, -10976, -10845, 
-        -10715, -10585, -10452, -10322, -10189, -10058, -9925, -9790, -9656, -9520, -9385, -9249, 
-        -9112, -8974, -8836, -8701, -8562, -8422, -8284, -8145, -8004, -7862, -7720, -7578, 
-        -7434, -7290, -7147, -7002, -6859, -6711, -6565, -6421, -6274, -6127, -5978, -5829, 
-        -5680, -5529, -5378, -5227, -5075, -4922, -4769, -4615, -4464, -4313, -4156, -4001, 
-        -3844, -3686, -3529, -3370, -3211, -3052, -2892, -2731, -2569, -2407, -2247, -2087, 
-        -1924, -1759, -1593, -1428, -1262, -1095, -927, -759, -590, -420, -251, -84 
-    };
-
-    // AKWF_saw_0046 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0046[600] PROGMEM = {
-        74, 223, 372, 524, 671, 818, 968, 1116, 1262, 1410, 1554, 1702, 
-        1844, 1990, 2134, 2279, 2421, 2564, 2705, 2846, 2988, 3129, 3269, 3407, 
-        3548, 3686, 3824, 3963, 4100, 4236, 4374, 4509, 4644, 4780, 4915, 5050, 
-        5184, 5315, 5451, 5580, 5713, 5845, 5977, 6107, 6239, 6365, 6495, 6624, 
-        6754, 6881, 7007, 7137, 7263, 7388, 7515, 7641, 7766, 7891, 8014, 8137, 
-        8262, 8384, 8508, 8627, 8752, 8875, 8993, 9114, 9234, 9355, 9473, 9594, 
-        9709, 9829, 9948, 10064, 10181, 10296, 10415, 10530, 10643, 10760, 10873, 10988, 
-        11103, 11216, 11327, 11441, 11553, 11665, 11777, 11889, 12000, 12108, 12218, 12329, 
-        12439, 12547, 12657, 12763, 12871, 12981, 13087, 13193, 13299, 13407, 13512, 13616, 
-        13721, 13825, 13931, 14035, 14138, 14240, 14343, 14446, 14549, 14651, 14752, 14855, 
-        14953, 15054, 15155, 15255, 15355, 15455, 15552, 15651, 15751, 15847, 15944, 16041, 
-        16139, 16236, 16330, 16427, 16523, 16618, 16714, 16808, 16901, 16995, 17091, 17182, 
-        17276, 17369, 17461, 17553, 17644, 17735, 17827, 17918, 18009, 18099, 18189, 18279, 
-        18368, 18457, 18546, 18635, 18723, 18809, 18897, 18985, 19072, 19159, 19246, 19330, 
-        19418, 19502, 19588, 19672, 19758, 19842, 19925, 20009, 20094, 20177, 20259, 20343, 
-        20424, 20506, 20589, 20670, 20751, 20832, 20913, 20994, 21073, 21153, 21233, 21313, 
-        21392, 21471, 21549, 21628, 21707, 21784, 21862, 21938, 22017, 22093, 22169, 22246, 
-        22321, 22397, 22473, 22548, 22622, 22698, 22772, 22846, 22920, 22994, 23068, 23141, 
-        23213, 23288, 23359, 23432, 23504, 23576, 23647, 23719, 23788, 23860, 23930, 24001, 
-        24072, 24141, 24212, 24280, 24349, 24419, 24487, 24555, 24625, 24692, 24760, 24827, 
-        24895, 24962, 25028, 25094, 25162, 25227, 25293, 25359, 25426, 25491, 25557, 25620, 
-        25686, 25750, 25814, 25878, 25941, 26006, 26069, 26132, 26196, 26258, 26320, 26383, 
-        26445, 26507, 26568, 26630, 26691, 26753, 26814, 26874, 26934, 26995, 27055, 27115, 
-        27174, 27234, 27293, 27352, 27412, 27470, 27528, 27586, 27645, 27703, 27759, 27818, 
-        27877, 27933, 27993, 28053, 28114, 28185, 28271, 28395, 28581, 29006, 29293, 32767, 
-        -32767, -29293, -29006, -28581, -28395, -28271, -28185, -28114, -28053, -27993, -27933, -27877, 
-        -27818, -27759, -27703, -27645, -27586, -27528, -27470, -27412, -27352, -27293, -27234, -27174, 
-        -27115, -27055, -26995, -26934, -26874, -26814, -26753, -26691, -26630, -26568, -26507, -26445, 
-        -26383, -26320, -26258, -26196, -26132, -26069, -26006, -25941, -25878, -25814, -25750, -25686, 
-        -25620, -25557, -25491, -25426, -25359, -25293, -25227, -25162, -25094, -25028, -24962, -24895, 
-        -24827, -24760, -24692, -24625, -24555, -24487, -24419, -24349, -24280, -24212, -24141, -24072, 
-        -24001, -23930, -23860, -23788, -23719, -23647, -23576, -23504, -23432, -23359, -23288, -23213, 
-        -23141, -23068, -22994, -22920, -22846, -22772, -22698, -22622, -22548, -22473, -22397, -22321, 
-        -22246, -22169, -22093, -22017, -21938, -21862, -21784, -21707, -21628, -21549, -21471, -21392, 
-        -21313, -21233, -21153, -21073, -20994, -20913, -20832, -20751, -20670, -20589, -20506, -20424, 
-        -20343, -20259, -20177, -20094, -20009, -19925, -19842, -19758, -19672, -19588, -19502, -19418, 
-        -19330, -19246, -19159, -19072, -18985, -18897, -18809, -18723, -18635, -18546, -18457, -18368, 
-        -18279, -18189, -18099, -18009, -17918, -17827, -17735, -17644, -17553, -17461, -17369, -17276, 
-        -17182, -17091, -16995, -16901, -16808, -16714, -16618, -16523, -16427, -16330, -16236, -16139, 
-        -16041, -15944, -15847, -15751, -15651, -15552, -15455, -15355, -15255, -15155, -15054, -14953, 
-        -14855, -14752, -14651, -14549, -14446, -14343, -14240, -14138, -14035, -13931, -13825, -13721, 
-        -13616, -13512, -13407, -13299, -13193, -13087, -12981, -12871, -12763, -12657, -12547, -12439, 
-        -12329, -12218, -12108, -12000, -11889, -11777, -11665, -11553, -11441, -11327, -11216, -11103, 
-        -10988, -10873, -10760, -10643, -10530, -10415, -10296, -10181, -10064, -9948, -9829, -9709, 
-        -9594, -9473, -9355, -9234, -9114, -8993, -8875, -8752, -8627, -8508, -8384, -8262, 
-        -8137, -8014, -7891, -7766, -7641, -7515, -7388, -7263, -7137, -7007, -6881, -6754, 
-        -6624, -6495, -6365, -6239, -6107, -5977, -5845, -5713, -5580, -5451, -5315, -5184, 
-        -5050, -4915, -4780, -4644, -4509, -4374, -4236, -4100, -3963, -3824, -3686, -3548, 
-        -3407, -3269, -3129, -2988, -2846, -2705, -2564, -2421, -2279, -2134, -1990, -1844, 
-        -1702, -1554, -1410, -1262, -1116, -968, -818, -671, -524, -372, -223, -74 
-    };
-
-    // AKWF_saw_0047 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0047[600] PROGMEM = {
-        66, 198, 334, 468, 602, 736, 871, 1004, 1137, 1270, 1398, 1532, 
-        1664, 1793, 1920, 2050, 2183, 2310, 2438, 2567, 2696, 2823, 2950, 3079, 
-        3204, 3331, 3457, 3581, 3703, 3827, 3953, 4076, 4200, 4323, 4447, 4569, 
-        4691, 4814, 4935, 5056, 5176, 5294, 5414, 5535, 5653, 5773, 5891, 6009, 
-        6128, 6245, 6362, 6479, 6596, 6712, 6827, 6942, 7057, 7170, 7285, 7399, 
-        7513, 7626, 7740, 7853, 7966, 8078, 8189, 8299, 8410, 8519, 8632, 8740, 
-        8851, 8960, 9069, 9177, 9287, 9396, 9503, 9611, 9719, 9824, 9931, 10037, 
-        10142, 10247, 10353, 10458, 10562, 10667, 10772, 10876, 10979, 11083, 11186, 11286, 
-        11388, 11492, 11591, 11693, 11793, 11896, 11996, 12096, 12196, 12296, 12395, 12495, 
-        12592, 12690, 12788, 12884, 12982, 13080, 13177, 13274, 13370, 13466, 13563, 13658, 
-        13754, 13849, 13943, 14037, 14131, 14224, 14318, 14412, 14504, 14597, 14690, 14782, 
-        14875, 14966, 15058, 15148, 15241, 15329, 15420, 15509, 15599, 15688, 15778, 15867, 
-        15956, 16044, 16133, 16222, 16309, 16395, 16482, 16570, 16655, 16741, 16828, 16914, 
-        16999, 17085, 17171, 17255, 17340, 17425, 17507, 17593, 17677, 17760, 17841, 17924, 
-        18008, 18090, 18172, 18254, 18337, 18418, 18499, 18580, 18661, 18742, 18821, 18900, 
-        18979, 19059, 19139, 19218, 19296, 19376, 19455, 19533, 19611, 19688, 19766, 19843, 
-        19919, 19995, 20072, 20150, 20225, 20301, 20377, 20452, 20527, 20602, 20677, 20752, 
-        20827, 20900, 20974, 21046, 21120, 21193, 21266, 21340, 21412, 21485, 21557, 21629, 
-        21699, 21773, 21844, 21914, 21984, 22055, 22126, 22196, 22266, 22336, 22406, 22476, 
-        22545, 22614, 22682, 22752, 22821, 22887, 22955, 23023, 23092, 23158, 23225, 23292, 
-        23360, 23426, 23492, 23559, 23625, 23692, 23756, 23821, 23886, 23952, 24017, 24081, 
-        24145, 24210, 24274, 24338, 24403, 24466, 24529, 24593, 24655, 24718, 24780, 24843, 
-        24905, 24967, 25028, 25091, 25153, 25214, 25275, 25336, 25397, 25458, 25518, 25578, 
-        25638, 25697, 25757, 25816, 25876, 25935, 25995, 26054, 26113, 26172, 26230, 26288, 
-        26345, 26405, 26463, 26523, 26589, 26662, 26756, 26901, 27113, 27689, 27903, 32767, 
-        -32767, -27903, -27689, -27113, -26901, -26756, -26662, -26589, -26523, -26463, -26405, -26345, 
-        -26288, -26230, -26172, -26113, -26054, -25995, -25935, -25876, -25816, -25757, -25697, -25638, 
-        -25578, -25518, -25458, -25397, -25336, -25275, -25214, -25153, -25091, -25028, -24967, -24905, 
-        -24843, -24780, -24718, -24655, -24593, -24529, -24466, -24403, -24338, -24274, -24210, -24145, 
-        -24081, -24017, -23952, -23886, -23821, -23756, -23692, -23625, -23559, -23492, -23426, -23360, 
-        -23292, -23225, -23158, -23092, -23023, -22955, -22887, -22821, -22752, -22682, -22614, -22545, 
-        -22476, -22406, -22336, -22266, -22196, -22126, -22055, -21984, -21914, -21844, -21773, -21699, 
-        -21629, -21557, -21485, -21412, -21340, -21266, -21193, -21120, -21046, -20974, -20900, -20827, 
-        -20752, -20677, -20602, -20527, -20452, -20377, -20301, -20225, -20150, -20072, -19995, -19919, 
-        -19843, -19766, -19688, -19611, -19533, -19455, -19376, -19296, -19218, -19139, -19059, -18979, 
-        -18900, -18821, -18742, -18661, -18580, -18499, -18418, -18337, -18254, -18172, -18090, -18008, 
-        -17924, -17841, -17760, -17677, -17593, -17507, -17425, -17340, -17255, -17171, -17085, -16999, 
-        -16914, -16828, -16741, -16655, -16570, -16482, -16395, -16309, -16222, -16133, -16044, -15956, 
-        -15867, -15778, -15688, -15599, -15509, -15420, -15329, -15241, -15148, -15058, -14966, -14875, 
-        -14782, -14690, -14597, -14504, -14412, -14318, -14224, -14131, -14037, -13943, -13849, -13754, 
-        -13658, -13563, -13466, -13370, -13274, -13177, -13080, -12982, -12884, -12788, -12690, -12592, 
-        -12495, -12395, -12296, -12196, -12096, -11996, -11896, -11793, -11693, -11591, -11492, -11388, 
-        -11286, -11186, -11083, -10979, -10876, -10772, -10667, -10562, -10458, -10353, -10247, -10142, 
-        -10037, -9931, -9824, -9719, -9611, -9503, -9396, -9287, -9177, -9069, -8960, -8851, 
-        -8740, -8632, -8519, -8410, -8299, -8189, -8078, -7966, -7853, -7740, -7626, -7513, 
-        -7399, -7285, -7170, -7057, -6942, -6827, -6712, -6596, -6479, -6362, -6245, -6128, 
-        -6009, -5891, -5773, -5653, -5535, -5414, -5294, -5176, -5056, -4935, -4814, -4691, 
-        -4569, -4447, -4323, -4200, -4076, -3953, -3827, -3703, -3581, -3457, -3331, -3204, 
-        -3079, -2950, -2823, -2696, -2567, -2438, -2310, -2183, -2050, -1920, -1793, -1664, 
-        -1532, -1398, -1270, -1137, -1004, -871, -736, -602, -468, -334, -198, -66 
-    };
-
-    // AKWF_saw_0048 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0048[600] PROGMEM = {
-        57, 181, 304, 427, 548, 671, 793, 915, 1036, 1157, 1278, 1395, 
-        1517, 1635, 1752, 1873, 1989, 2107, 2226, 2343, 2460, 2577, 2694, 2811, 
-        2926, 3042, 3158, 3267, 3382, 3499, 3611, 3725, 3838, 3951, 4064, 4177, 
-        4289, 4401, 4511, 4623, 4735, 4841, 4953, 5063, 5171, 5281, 5389, 5499, 
-        5607, 5715, 5823, 5931, 6038, 6145, 6247, 6356, 6464, 6566, 6671, 6777, 
-        6882, 6987, 7091, 7196, 7299, 7402, 7506, 7608, 7709, 7812, 7914, 8015, 
-        8116, 8218, 8318, 8418, 8519, 8619, 8718, 8819, 8918, 9013, 9114, 9214, 
-        9309, 9408, 9505, 9602, 9699, 9797, 9893, 9989, 10086, 10182, 10276, 10368, 
-        10464, 10560, 10653, 10747, 10841, 10934, 11028, 11121, 11214, 11307, 11399, 11492, 
-        11582, 11674, 11766, 11855, 11946, 12036, 12125, 12216, 12306, 12396, 12485, 12574, 
-        12663, 12752, 12837, 12927, 13016, 13101, 13188, 13275, 13363, 13450, 13537, 13623, 
-        13709, 13794, 13879, 13963, 14049, 14134, 14216, 14301, 14385, 14469, 14552, 14635, 
-        14718, 14801, 14884, 14967, 15049, 15128, 15211, 15295, 15373, 15454, 15535, 15615, 
-        15696, 15776, 15856, 15936, 16016, 16095, 16173, 16251, 16331, 16409, 16485, 16565, 
-        16642, 16718, 16796, 16873, 16951, 17028, 17103, 17180, 17255, 17332, 17408, 17480, 
-        17556, 17631, 17706, 17780, 17855, 17929, 18004, 18077, 18151, 18224, 18295, 18370, 
-        18442, 18513, 18586, 18658, 18730, 18801, 18873, 18945, 19015, 19087, 19158, 19228, 
-        19299, 19369, 19436, 19506, 19576, 19645, 19715, 19783, 19853, 19922, 19990, 20058, 
-        20126, 20193, 20262, 20328, 20395, 20462, 20529, 20595, 20662, 20729, 20795, 20861, 
-        20927, 20993, 21058, 21124, 21188, 21252, 21316, 21382, 21445, 21509, 21573, 21637, 
-        21701, 21765, 21828, 21892, 21953, 22018, 22080, 22140, 22204, 22266, 22327, 22389, 
-        22450, 22512, 22573, 22634, 22695, 22756, 22817, 22877, 22935, 22997, 23057, 23116, 
-        23175, 23234, 23294, 23353, 23412, 23471, 23529, 23588, 23646, 23705, 23761, 23819, 
-        23878, 23934, 23991, 24049, 24106, 24162, 24219, 24275, 24332, 24389, 24444, 24499, 
-        24555, 24613, 24668, 24728, 24790, 24865, 24960, 25125, 25337, 26156, 26051, 32767, 
-        -32767, -26051, -26156, -25337, -25125, -24960, -24865, -24790, -24728, -24668, -24613, -24555, 
-        -24499, -24444, -24389, -24332, -24275, -24219, -24162, -24106, -24049, -23991, -23934, -23878, 
-        -23819, -23761, -23705, -23646, -23588, -23529, -23471, -23412, -23353, -23294, -23234, -23175, 
-        -23116, -23057, -22997, -22935, -22877, -22817, -22756, -22695, -22634, -22573, -22512, -22450, 
-        -22389, -22327, -22266, -22204, -22140, -22080, -22018, -21953, -21892, -21828, -21765, -21701, 
-        -21637, -21573, -21509, -21445, -21382, -21316, -21252, -21188, -21124, -21058, -20993, -20927, 
-        -20861, -20795, -20729, -20662, -20595, -20529, -20462, -20395, -20328, -20262, -20193, -20126, 
-        -20058, -19990, -19922, -19853, -19783, -19715, -19645, -19576, -19506, -19436, -19369, -19299, 
-        -19228, -19158, -19087, -19015, -18945, -18873, -18801, -18730, -18658, -18586, -18513, -18442, 
-        -18370, -18295, -18224, -18151, -18077, -18004, -17929, -17855, -17780, -17706, -17631, -17556, 
-        -17480, -17408, -17332, -17255, -17180, -17103, -17028, -16951, -16873, -16796, -16718, -16642, 
-        -16565, -16485, -16409, -16331, -16251, -16173, -16095, -16016, -15936, -15856, -15776, -15696, 
-        -15615, -15535, -15454, -15373, -15295, -15211, -15128, -15049, -14967, -14884, -14801, -14718, 
-        -14635, -14552, -14469, -14385, -14301, -14216, -14134, -14049, -13963, -13879, -13794, -13709, 
-        -13623, -13537, -13450, -13363, -13275, -13188, -13101, -13016, -12927, -12837, -12752, -12663, 
-        -12574, -12485, -12396, -12306, -12216, -12125, -12036, -11946, -11855, -11766, -11674, -11582, 
-        -11492, -11399, -11307, -11214, -11121, -11028, -10934, -10841, -10747, -10653, -10560, -10464, 
-        -10368, -10276, -10182, -10086, -9989, -9893, -9797, -9699, -9602, -9505, -9408, -9309, 
-        -9214, -9114, -9013, -8918, -8819, -8718, -8619, -8519, -8418, -8318, -8218, -8116, 
-        -8015, -7914, -7812, -7709, -7608, -7506, -7402, -7299, -7196, -7091, -6987, -6882, 
-        -6777, -6671, -6566, -6464, -6356, -6247, -6145, -6038, -5931, -5823, -5715, -5607, 
-        -5499, -5389, -5281, -5171, -5063, -4953, -4841, -4735, -4623, -4511, -4401, -4289, 
-        -4177, -4064, -3951, -3838, -3725, -3611, -3499, -3382, -3267, -3158, -3042, -2926, 
-        -2811, -2694, -2577, -2460, -2343, -2226, -2107, -1989, -1873, -1752, -1635, -1517, 
-        -1395, -1278, -1157, -1036, -915, -793, -671, -548, -427, -304, -181, -57 
-    };
-
-} // namespace AKWF_BwSaw
@@ -1,116 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwSaw {
-
-    // AKWF_saw_0049 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0049[600] PROGMEM = {
-        49, 148, 250, 350, 449, 552, 652, 748, 850, 948, 1047, 1145, 
-        1244, 1342, 1441, 1540, 1638, 1736, 1832, 1931, 2026, 2120, 2218, 2314, 
-        2410, 2507, 2603, 2698, 2794, 2890, 2984, 3078, 3174, 3267, 3359, 3455, 
-        3547, 3641, 3734, 3828, 3921, 4014, 4105, 4198, 4291, 4381, 4474, 4565, 
-        4654, 4748, 4838, 4928, 5018, 5109, 5199, 5290, 5379, 5469, 5556, 5648, 
-        5737, 5823, 5913, 6000, 6088, 6176, 6267, 6352, 6440, 6528, 6615, 6700, 
-        6788, 6875, 6960, 7045, 7133, 7217, 7303, 7388, 7475, 7560, 7645, 7728, 
-        7813, 7895, 7983, 8067, 8150, 8232, 8317, 8398, 8482, 8566, 8647, 8730, 
-        8812, 8895, 8976, 9059, 9141, 9223, 9302, 9384, 9462, 9543, 9624, 9707, 
-        9786, 9866, 9946, 10026, 10104, 10185, 10264, 10342, 10420, 10500, 10577, 10656, 
-        10735, 10813, 10890, 10969, 11045, 11122, 11201, 11277, 11355, 11431, 11506, 11584, 
-        11658, 11735, 11812, 11886, 11962, 12038, 12113, 12188, 12263, 12339, 12413, 12486, 
-        12562, 12633, 12707, 12782, 12855, 12929, 13002, 13075, 13149, 13221, 13294, 13366, 
-        13439, 13512, 13583, 13653, 13727, 13797, 13869, 13940, 14011, 14083, 14153, 14224, 
-        14295, 14365, 14435, 14506, 14573, 14643, 14715, 14782, 14851, 14922, 14991, 15060, 
-        15129, 15197, 15266, 15333, 15402, 15469, 15535, 15605, 15671, 15739, 15806, 15874, 
-        15941, 16008, 16073, 16140, 16207, 16273, 16340, 16406, 16469, 16537, 16602, 16667, 
-        16732, 16798, 16862, 16928, 16992, 17057, 17120, 17186, 17250, 17313, 17377, 17440, 
-        17504, 17567, 17631, 17693, 17757, 17821, 17883, 17946, 18007, 18071, 18132, 18193, 
-        18256, 18317, 18379, 18441, 18502, 18564, 18625, 18686, 18747, 18806, 18869, 18929, 
-        18988, 19049, 19108, 19169, 19229, 19288, 19349, 19407, 19467, 19527, 19585, 19645, 
-        19704, 19762, 19821, 19879, 19937, 19995, 20053, 20112, 20168, 20227, 20285, 20342, 
-        20399, 20458, 20514, 20571, 20627, 20684, 20740, 20796, 20853, 20909, 20966, 21022, 
-        21078, 21133, 21189, 21245, 21299, 21355, 21410, 21464, 21520, 21575, 21630, 21685, 
-        21739, 21796, 21853, 21916, 21994, 22085, 22297, 22448, 23740, 22829, 32767, -48, 
-        48, -32767, -22829, -23740, -22448, -22297, -22085, -21994, -21916, -21853, -21796, -21739, 
-        -21685, -21630, -21575, -21520, -21464, -21410, -21355, -21299, -21245, -21189, -21133, -21078, 
-        -21022, -20966, -20909, -20853, -20796, -20740, -20684, -20627, -20571, -20514, -20458, -20399, 
-        -20342, -20285, -20227, -20168, -20112, -20053, -19995, -19937, -19879, -19821, -19762, -19704, 
-        -19645, -19585, -19527, -19467, -19407, -19349, -19288, -19229, -19169, -19108, -19049, -18988, 
-        -18929, -18869, -18806, -18747, -18686, -18625, -18564, -18502, -18441, -18379, -18317, -18256, 
-        -18193, -18132, -18071, -18007, -17946, -17883, -17821, -17757, -17693, -17631, -17567, -17504, 
-        -17440, -17377, -17313, -17250, -17186, -17120, -17057, -16992, -16928, -16862, -16798, -16732, 
-        -16667, -16602, -16537, -16469, -16406, -16340, -16273, -16207, -16140, -16073, -16008, -15941, 
-        -15874, -15806, -15739, -15671, -15605, -15535, -15469, -15402, -15333, -15266, -15197, -15129, 
-        -15060, -14991, -14922, -14851, -14782, -14715, -14643, -14573, -14506, -14435, -14365, -14295, 
-        -14224, -14153, -14083, -14011, -13940, -13869, -13797, -13727, -13653, -13583, -13512, -13439, 
-        -13366, -13294, -13221, -13149, -13075, -13002, -12929, -12855, -12782, -12707, -12633, -12562, 
-        -12486, -12413, -12339, -12263, -12188, -12113, -12038, -11962, -11886, -11812, -11735, -11658, 
-        -11584, -11506, -11431, -11355, -11277, -11201, -11122, -11045, -10969, -10890, -10813, -10735, 
-        -10656, -10577, -10500, -10420, -10342, -10264, -10185, -10104, -10026, -9946, -9866, -9786, 
-        -9707, -9624, -9543, -9462, -9384, -9302, -9223, -9141, -9059, -8976, -8895, -8812, 
-        -8730, -8647, -8566, -8482, -8398, -8317, -8232, -8150, -8067, -7983, -7895, -7813, 
-        -7728, -7645, -7560, -7475, -7388, -7303, -7217, -7133, -7045, -6960, -6875, -6788, 
-        -6700, -6615, -6528, -6440, -6352, -6267, -6176, -6088, -6000, -5913, -5823, -5737, 
-        -5648, -5556, -5469, -5379, -5290, -5199, -5109, -5018, -4928, -4838, -4748, -4654, 
-        -4565, -4474, -4381, -4291, -4198, -4105, -4014, -3921, -3828, -3734, -3641, -3547, 
-        -3455, -3359, -3267, -3174, -3078, -2984, -2890, -2794, -2698, -2603, -2507, -2410, 
-        -2314, -2218, -2120, -2026, -1931, -1832, -1736, -1638, -1540, -1441, -1342, -1244, 
-        -1145, -1047, -948, -850, -748, -652, -552, -449, -350, -250, -148, -49 
-    };
-
-    // AKWF_saw_0050 → 600 samples
-    static const int16_t akwf_akwf_bwsaw_akwf_saw_0050[600] PROGMEM = {
-        34, 109, 184, 259, 333, 405, 479, 552, 628, 699, 774, 847, 
-        920, 995, 1066, 1141, 1214, 1286, 1356, 1429, 1504, 1575, 1647, 1719, 
-        1789, 1861, 1936, 2007, 2076, 2147, 2217, 2290, 2361, 2431, 2503, 2572, 
-        2641, 2716, 2785, 2853, 2924, 2993, 3064, 3131, 3204, 3273, 3340, 3410, 
-        3481, 3549, 3618, 3687, 3754, 3824, 3893, 3961, 4029, 4097, 4163, 4233, 
-        4301, 4368, 4434, 4502, 4568, 4637, 4705, 4771, 4838, 4905, 4972, 5038, 
-        5106, 5171, 5237, 5305, 5368, 5436, 5500, 5567, 5632, 5696, 5765, 5830, 
-        5893, 5958, 6024, 6088, 6153, 6218, 6283, 6347, 6410, 6476, 6541, 6603, 
-        6667, 6731, 6794, 6857, 6923, 6986, 7048, 7110, 7175, 7237, 7301, 7363, 
-        7426, 7487, 7548, 7615, 7676, 7737, 7799, 7862, 7923, 7986, 8048, 8108, 
-        8171, 8229, 8294, 8354, 8414, 8475, 8536, 8595, 8659, 8720, 8779, 8839, 
-        8901, 8960, 9021, 9080, 9140, 9198, 9259, 9318, 9379, 9438, 9497, 9556, 
-        9615, 9673, 9733, 9792, 9850, 9909, 9968, 10027, 10085, 10144, 10201, 10258, 
-        10317, 10376, 10433, 10490, 10548, 10606, 10661, 10720, 10777, 10833, 10891, 10950, 
-        11006, 11063, 11117, 11175, 11231, 11287, 11343, 11400, 11456, 11512, 11569, 11625, 
-        11680, 11736, 11790, 11845, 11902, 11958, 12013, 12068, 12121, 12178, 12232, 12288, 
-        12342, 12396, 12449, 12504, 12560, 12614, 12668, 12722, 12775, 12830, 12884, 12937, 
-        12990, 13044, 13098, 13151, 13204, 13258, 13311, 13363, 13416, 13471, 13522, 13574, 
-        13628, 13680, 13732, 13784, 13838, 13889, 13940, 13994, 14045, 14097, 14148, 14200, 
-        14251, 14302, 14355, 14407, 14456, 14507, 14559, 14610, 14661, 14712, 14763, 14813, 
-        14862, 14916, 14966, 15014, 15065, 15115, 15164, 15217, 15266, 15316, 15365, 15414, 
-        15464, 15514, 15563, 15612, 15661, 15710, 15760, 15810, 15857, 15906, 15954, 16004, 
-        16052, 16102, 16151, 16198, 16248, 16295, 16343, 16391, 16439, 16486, 16534, 16582, 
-        16630, 16678, 16725, 16772, 16821, 16867, 16915, 16962, 17009, 17055, 17102, 17151, 
-        17198, 17244, 17300, 17340, 17449, 17432, 17925, 17420, 20513, 16019, 32767, -36, 
-        36, -32767, -16019, -20513, -17420, -17925, -17432, -17449, -17340, -17300, -17244, -17198, 
-        -17151, -17102, -17055, -17009, -16962, -16915, -16867, -16821, -16772, -16725, -16678, -16630, 
-        -16582, -16534, -16486, -16439, -16391, -16343, -16295, -16248, -16198, -16151, -16102, -16052, 
-        -16004, -15954, -15906, -15857, -15810, -15760, -15710, -15661, -15612, -15563, -15514, -15464, 
-        -15414, -15365, -15316, -15266, -15217, -15164, -15115, -15065, -15014, -14966, -14916, -14862, 
-        -14813, -14763, -14712, -14661, -14610, -14559, -14507, -14456, -14407, -14355, -14302, -14251, 
-        -14200, -14148, -14097, -14045, -13994, -13940, -13889, -13838, -13784, -13732, -13680, -13628, 
-        -13574, -13522, -13471, -13416, -13363, -13311, -13258, -13204, -13151, -13098, -13044, -12990, 
-        -12937, -12884, -12830, -12775, -12722, -12668, -12614, -12560, -12504, -12449, -12396, -12342, 
-        -12288, -12232, -12178, -12121, -12068, -12013, -11958, -11902, -11845, -11790, -11736, -11680, 
-        -11625, -11569, -11512, -11456, -11400, -11343, -11287, -11231, -11175, -11117, -11063, -11006, 
-        -10950, -10891, -10833, -10777, -10720, -10661, -10606, -10548, -10490, -10433, -10376, -10317, 
-        -10258, -10201, -10144, -10085, -10027, -9968, -9909, -9850, -9792, -9733, -9673, -9615, 
-        -9556, -9497, -9438, -9379, -9318, -9259, -9198, -9140, -9080, -9021, -8960, -8901, 
-        -8839, -8779, -8720, -8659, -8595, -8536, -8475, -8414, -8354, -8294, -8229, -8171, 
-        -8108, -8048, -7986, -7923, -7862, -7799, -7737, -7676, -7615, -7548, -7487, -7426, 
-        -7363, -7301, -7237, -7175, -7110, -7048, -6986, -6923, -6857, -6794, -6731, -6667, 
-        -6603, -6541, -6476, -6410, -6347, -6283, -6218, -6153, -6088, -6024, -5958, -5893, 
-        -5830, -5765, -5696, -5632, -5567, -5500, -5436, -5368, -5305, -5237, -5171, -5106, 
-        -5038, -4972, -4905, -4838, -4771, -4705, -4637, -4568, -4502, -4434, -4368, -4301, 
-        -4233, -4163, -4097, -4029, -3961, -3893, -3824, -3754, -3687, -3618, -3549, -3481, 
-        -3410, -3340, -3273, -3204, -3131, -3064, -2993, -2924, -2853, -2785, -2716, -2641, 
-        -2572, -2503, -2431, -2361, -2290, -2217, -2147, -2076, -2007, -1936, -1861, -1789, 
-        -1719, -1647, -1575, -1504, -1429, -1356, -1286, -1214, -1141, -1066, -995, -920, 
-        -847, -774, -699, -628, -552, -479, -405, -333, -259, -184, -109, -34 
-    };
-
-} // namespace AKWF_BwSaw
@@ -1,28 +1,245 @@
-// Auto‑generated AKWF bank. Do not edit manually.
+// Auto‑generated AKWF bank (compressed, see AKWFCodec.h). Do not edit manually.
 
 #pragma once
 #include <Arduino.h>
 
-#include "AKWF_BwSawbright_Tables_Part0.h"
-
 namespace AKWF_BwSawbright {
+
     constexpr uint16_t count = 10;
-}
 
-// Return a pointer to the n‑th waveform table in this bank.
-// If index is out of range, returns nullptr and length is set to 0.
-inline const int16_t* AKWF_BwSawbright_get(uint16_t index, uint16_t &length) {
-    switch(index) {
-        case 0: length = 600; return AKWF_BwSawbright::akwf_akwf_bwsawbright_akwf_bsaw_0001;
-        case 1: length = 600; return AKWF_BwSawbright::akwf_akwf_bwsawbright_akwf_bsaw_0002;
-        case 2: length = 600; return AKWF_BwSawbright::akwf_akwf_bwsawbright_akwf_bsaw_0003;
-        case 3: length = 600; return AKWF_BwSawbright::akwf_akwf_bwsawbright_akwf_bsaw_0004;
-        case 4: length = 600; return AKWF_BwSawbright::akwf_akwf_bwsawbright_akwf_bsaw_0005;
-        case 5: length = 600; return AKWF_BwSawbright::akwf_akwf_bwsawbright_akwf_bsaw_0006;
-        case 6: length = 600; return AKWF_BwSawbright::akwf_akwf_bwsawbright_akwf_bsaw_0007;
-        case 7: length = 600; return AKWF_BwSawbright::akwf_akwf_bwsawbright_akwf_bsaw_0008;
-        case 8: length = 600; return AKWF_BwSawbright::akwf_akwf_bwsawbright_akwf_bsaw_0009;
-        case 9: length = 600; return AKWF_BwSawbright::akwf_akwf_bwsawbright_akwf_bsaw_0010;
-        default: length = 0; return nullptr;
-    }
-}
+    // 12000 bytes as int16 → 3465 bytes
+
+    static const uint8_t data[3465] PROGMEM = {
+        0x02, 0xCF, 0xCD, 0xF9, 0x93, 0xFB, 0xFB, 0xBC, 0x72, 0x82, 0xDA, 0xE4, 0x58, 0x11, 0x2A, 0x8C,
+        0x00, 0x3E, 0x20, 0xD4, 0x08, 0xE8, 0x1E, 0x81, 0xE6, 0x00, 0xA0, 0x4D, 0x80, 0x95, 0x09, 0xA7,
+        0xF9, 0x7A, 0xD7, 0x6C, 0xA7, 0x09, 0xD8, 0xA9, 0x99, 0x8A, 0xC5, 0x80, 0xF4, 0x88, 0xD3, 0xA1,
+        0x50, 0x89, 0x3A, 0x54, 0xA9, 0x91, 0x23, 0x4A, 0x84, 0x98, 0xB1, 0x59, 0x8A, 0x4A, 0x31, 0x32,
+        0xA7, 0x39, 0x8C, 0x62, 0x84, 0x4B, 0x49, 0x80, 0x32, 0x25, 0xEC, 0xCD, 0xE4, 0xA7, 0x67, 0x7B,
+        0x1C, 0xBC, 0xBC, 0xCD, 0x8C, 0xC9, 0x39, 0x27, 0x2A, 0x44, 0x94, 0xDD, 0x6F, 0xA2, 0xDC, 0x63,
+        0x70, 0x61, 0x3C, 0x30, 0x92, 0x24, 0xA7, 0x41, 0xE1, 0x81, 0x59, 0xE2, 0x4E, 0x24, 0x60, 0x45,
+        0x93, 0x73, 0x35, 0xC2, 0x86, 0xBD, 0xDD, 0xE1, 0xDA, 0x58, 0x31, 0x37, 0x9B, 0x8C, 0x62, 0x98,
+        0x8A, 0x5F, 0x36, 0x04, 0x4B, 0xE7, 0x79, 0x44, 0x81, 0x70, 0xA6, 0x5E, 0x36, 0x60, 0xE8, 0x65,
+        0xCB, 0x97, 0x0E, 0xF8, 0x6E, 0x13, 0xA2, 0x08, 0x11, 0x78, 0x19, 0xE3, 0x7A, 0x64, 0x04, 0x5E,
+        0x25, 0x2B, 0xAC, 0x6E, 0x0A, 0x02, 0x03, 0x32, 0xDC, 0x65, 0xF2, 0xB0, 0x40, 0x26, 0xE0, 0x13,
+        0x79, 0xBC, 0x44, 0x0B, 0xC4, 0x01, 0x99, 0xDC, 0x46, 0x5C, 0xCA, 0xC0, 0x06, 0x5F, 0xCE, 0x94,
+        0xE0, 0x9A, 0xBC, 0x30, 0x23, 0x3C, 0x6F, 0x40, 0x7B, 0xE5, 0x08, 0x4D, 0xCB, 0xC3, 0xBE, 0x03,
+        0x72, 0xE5, 0xCA, 0x1C, 0xAE, 0x4D, 0xC1, 0xA6, 0x17, 0x01, 0x33, 0x7C, 0xEE, 0x03, 0x10, 0x79,
+        0xDC, 0x24, 0xA4, 0x88, 0xC6, 0x5E, 0x6F, 0x08, 0x8C, 0x22, 0x38, 0x05, 0xCC, 0xB1, 0xC2, 0xCE,
+        0x52, 0x74, 0x4A, 0x44, 0x03, 0x56, 0xAB, 0x7A, 0x1D, 0x0C, 0xEE, 0x1E, 0xF1, 0x8A, 0x98, 0x57,
+        0x05, 0xA7, 0xC5, 0xBE, 0x39, 0xE2, 0x62, 0x09, 0x2A, 0x14, 0x74, 0x95, 0x45, 0x68, 0x62, 0xB4,
+        0x69, 0x24, 0xB0, 0x52, 0x85, 0x46, 0x94, 0x18, 0xA8, 0x85, 0x43, 0x40, 0x08, 0x39, 0x27, 0x3B,
+        0xDE, 0xF9, 0x46, 0xD2, 0xBC, 0x33, 0xC7, 0x86, 0xBC, 0x38, 0x70, 0xE9, 0xCB, 0x8F, 0x5E, 0x94,
+        0xD3, 0xB7, 0x1E, 0xFC, 0x3B, 0x72, 0xE7, 0xB6, 0xFA, 0xF0, 0xAE, 0x54, 0xAD, 0x84, 0x02, 0x10,
+        0x58, 0xF0, 0xC7, 0x96, 0xCA, 0x81, 0xA6, 0xCE, 0x09, 0xED, 0x2E, 0x7C, 0xF6, 0x03, 0x4C, 0x3E,
+        0x42, 0xFF, 0x12, 0xB1, 0x60, 0xAD, 0x71, 0xCA, 0x0D, 0xFD, 0xDE, 0x40, 0x02, 0xCF, 0xC9, 0x09,
+        0x9D, 0x7B, 0xFB, 0x12, 0x75, 0xA3, 0xD6, 0xF4, 0x26, 0x50, 0xE3, 0x8D, 0x90, 0x29, 0xA1, 0x02,
+        0x06, 0xA8, 0x26, 0x81, 0x8E, 0x01, 0xC0, 0x41, 0x80, 0x6D, 0x26, 0xCB, 0xF6, 0xF8, 0x4D, 0x84,
+        0xEB, 0x12, 0x0C, 0xCA, 0x1D, 0x76, 0x05, 0x6A, 0x14, 0x49, 0x10, 0xA8, 0x3D, 0x32, 0x24, 0xA8,
+        0x92, 0x21, 0x48, 0x84, 0xF2, 0x60, 0xBA, 0x8C, 0x11, 0x55, 0x24, 0x51, 0x39, 0x8E, 0x51, 0x90,
+        0x22, 0xC1, 0x48, 0x4A, 0xDD, 0x66, 0xCE, 0x5E, 0x6C, 0x9C, 0xE6, 0xF6, 0xBB, 0x37, 0x33, 0x72,
+        0x6E, 0x47, 0xBE, 0x7D, 0x5D, 0x1D, 0x18, 0x95, 0x2A, 0x71, 0x2B, 0x16, 0x92, 0x53, 0x49, 0xD0,
+        0xB7, 0xC0, 0xB9, 0x97, 0xCE, 0x9C, 0xDC, 0x04, 0x79, 0xDE, 0x6F, 0x94, 0x61, 0x71, 0x41, 0xEE,
+        0xEF, 0x11, 0x7B, 0x96, 0x10, 0x59, 0xCE, 0x93, 0x7E, 0x7B, 0xC5, 0x83, 0x15, 0x91, 0x23, 0x17,
+        0x9D, 0xE0, 0xAC, 0x8D, 0xF9, 0xB7, 0x9B, 0x8C, 0x61, 0x38, 0x53, 0x05, 0x14, 0xE2, 0x75, 0x69,
+        0x0D, 0x39, 0xB8, 0xB9, 0x63, 0x96, 0x38, 0x36, 0x4A, 0x47, 0x37, 0x94, 0x22, 0x14, 0x5E, 0xB3,
+        0x86, 0x88, 0x86, 0xF5, 0x20, 0x12, 0x20, 0x25, 0x70, 0x12, 0xBD, 0x67, 0x04, 0x52, 0xF8, 0xA1,
+        0x10, 0xE7, 0xB9, 0x83, 0x48, 0xE7, 0x7E, 0x7B, 0xE5, 0x22, 0x18, 0x3B, 0xCB, 0x13, 0x17, 0x2C,
+        0x72, 0xC1, 0x72, 0xC9, 0x79, 0xA6, 0x2F, 0x9E, 0xF2, 0x8E, 0x31, 0x97, 0x8D, 0xC6, 0x32, 0xF0,
+        0x77, 0x39, 0xEE, 0x45, 0x93, 0x7C, 0xD9, 0x11, 0x89, 0x16, 0x48, 0xB2, 0x6F, 0xCF, 0x47, 0x89,
+        0xE6, 0xB2, 0x03, 0x0C, 0xB0, 0x0C, 0x77, 0xBD, 0xCD, 0xBB, 0xC8, 0x90, 0x8B, 0xA9, 0xC4, 0xA0,
+        0x1D, 0x48, 0xC0, 0xF7, 0x2D, 0xC0, 0xEE, 0x4D, 0xC7, 0x78, 0x8A, 0xBE, 0x75, 0xE5, 0xCD, 0x98,
+        0x46, 0x10, 0xA4, 0x29, 0x2E, 0x2F, 0x15, 0x85, 0x58, 0xA2, 0xAC, 0x2F, 0x07, 0x8C, 0x6A, 0xA3,
+        0x1A, 0x8D, 0x2C, 0x16, 0xA7, 0x83, 0x40, 0x95, 0x66, 0xE7, 0x3C, 0xED, 0x1B, 0x0C, 0x31, 0xD3,
+        0x0D, 0xF3, 0xDB, 0x7D, 0xB8, 0x73, 0xE1, 0xCF, 0x8D, 0x34, 0xE3, 0xD7, 0x6E, 0xFC, 0x39, 0xF1,
+        0xE1, 0xA6, 0xFB, 0x5B, 0x3A, 0xCA, 0xA3, 0x82, 0x61, 0x10, 0x85, 0xC2, 0xDE, 0x8C, 0xAB, 0x9E,
+        0x23, 0x7F, 0x91, 0xEC, 0xFE, 0xB6, 0x04, 0x04, 0x29, 0xC3, 0x63, 0x0E, 0x40, 0x99, 0xAB, 0x79,
+        0xD6, 0x91, 0xFD, 0x89, 0x40, 0x02, 0xCF, 0xB7, 0xFB, 0x6A, 0x77, 0xF2, 0x4B, 0xF5, 0xAC, 0xC9,
+        0x4C, 0x59, 0x80, 0x8A, 0x13, 0x18, 0x0F, 0x81, 0x8C, 0x01, 0x78, 0x32, 0x80, 0xE6, 0x02, 0xC0,
+        0x2B, 0x80, 0x05, 0x2A, 0x5F, 0x8F, 0xA4, 0xCB, 0x08, 0x90, 0xC3, 0x54, 0xEA, 0x26, 0xC4, 0x92,
+        0x62, 0xBB, 0x06, 0x2C, 0x18, 0xAC, 0xC9, 0x75, 0xD7, 0x55, 0x75, 0x55, 0x1E, 0xDB, 0x6D, 0xA4,
+        0xB2, 0xDA, 0x14, 0x84, 0xA4, 0x32, 0x20, 0x1E, 0x43, 0x57, 0x57, 0x7A, 0xFB, 0x6F, 0x4A, 0xCC,
+        0xEC, 0xBC, 0xAD, 0xB9, 0x32, 0x5D, 0x89, 0x59, 0xD9, 0xAC, 0x58, 0x8C, 0x22, 0x8D, 0x4A, 0x48,
+        0x9D, 0x49, 0xD6, 0xE8, 0xA9, 0xA2, 0x93, 0xD6, 0x71, 0x28, 0x54, 0x81, 0x92, 0xE6, 0xCC, 0x5B,
+        0xF3, 0x6F, 0x10, 0x8A, 0x69, 0x35, 0x3A, 0xCC, 0x29, 0xA2, 0xC6, 0x3C, 0xD2, 0x31, 0x9B, 0x93,
+        0x78, 0x8B, 0xCD, 0x71, 0x9B, 0xF3, 0x62, 0xF3, 0x41, 0x9C, 0xF7, 0x8B, 0x26, 0xF1, 0x71, 0x60,
+        0xB1, 0x91, 0x63, 0x17, 0x8B, 0x82, 0xEF, 0x18, 0xCD, 0xF9, 0xB3, 0x78, 0xC4, 0x94, 0xEB, 0x34,
+        0x4A, 0x45, 0x4D, 0x4D, 0x11, 0x18, 0xF3, 0x63, 0x23, 0x37, 0x9B, 0xC1, 0x59, 0x26, 0xC5, 0xE2,
+        0xF9, 0xD9, 0x07, 0x64, 0x78, 0xAC, 0x9B, 0xCD, 0xE3, 0x05, 0x63, 0xCD, 0x8C, 0x26, 0xF3, 0x78,
+        0x8C, 0x59, 0x37, 0xE7, 0xBC, 0x63, 0x37, 0x89, 0x56, 0x68, 0xA2, 0xA6, 0x93, 0x4A, 0x52, 0x16,
+        0x32, 0x2C, 0x63, 0x25, 0x90, 0x77, 0x8B, 0x26, 0xFC, 0xD4, 0xE6, 0xC8, 0x95, 0x66, 0x8A, 0x6A,
+        0xA5, 0x29, 0xA2, 0xE8, 0x58, 0xC4, 0xE6, 0xC7, 0x26, 0xF1, 0xA5, 0xAC, 0xD1, 0x82, 0x60, 0xA0,
+        0xA6, 0x2B, 0x23, 0x92, 0x57, 0x97, 0x14, 0xE6, 0x8F, 0x0A, 0xF5, 0x98, 0x25, 0x18, 0x99, 0xE3,
+        0x2A, 0xB2, 0x32, 0x2B, 0xCD, 0x8C, 0x61, 0x18, 0x48, 0xAA, 0x38, 0x2A, 0x06, 0x21, 0x52, 0xA2,
+        0x8E, 0x0E, 0xA1, 0x71, 0x4B, 0x18, 0x88, 0xD2, 0xC1, 0x52, 0x54, 0x95, 0x03, 0x20, 0xE5, 0x67,
+        0x28, 0x75, 0x9E, 0x58, 0x53, 0x1C, 0xB2, 0xCB, 0x4D, 0x36, 0xD3, 0x6D, 0xA9, 0x6E, 0x3A, 0xF0,
+        0xDF, 0x86, 0xFB, 0x70, 0xC7, 0x86, 0x59, 0xDB, 0x49, 0x54, 0xB1, 0xC1, 0x08, 0xC1, 0x6D, 0x62,
+        0x18, 0xC8, 0x5B, 0x12, 0xFA, 0x9F, 0x93, 0x43, 0x03, 0x16, 0x07, 0xB2, 0x62, 0x84, 0x4C, 0xB2,
+        0xF2, 0x52, 0xF5, 0xAD, 0x7F, 0x24, 0xC0, 0x02, 0xCF, 0xB2, 0xB3, 0x73, 0xA7, 0xF1, 0x76, 0xF7,
+        0x3F, 0xC5, 0xE4, 0x72, 0xC0, 0xF4, 0x14, 0x98, 0x1B, 0x81, 0xAA, 0x00, 0x88, 0x34, 0x00, 0xE6,
+        0x02, 0xC0, 0x25, 0x80, 0x2D, 0x31, 0x27, 0xC7, 0xD2, 0x41, 0x80, 0x46, 0x81, 0x11, 0x55, 0x15,
+        0x16, 0x25, 0x19, 0x28, 0xC5, 0x66, 0x2C, 0x55, 0x5D, 0x82, 0xAC, 0x14, 0x59, 0x45, 0x07, 0xB6,
+        0x5B, 0x65, 0x6C, 0x30, 0x84, 0x30, 0x82, 0xE4, 0x08, 0x25, 0x4C, 0x15, 0x6C, 0x49, 0xBB, 0x6D,
+        0xEC, 0x85, 0xDC, 0x9B, 0xBA, 0xF3, 0x19, 0x36, 0xA4, 0x8E, 0xCF, 0x79, 0xEC, 0x66, 0xC6, 0x58,
+        0xC1, 0x59, 0xCD, 0xC6, 0x3C, 0x63, 0x18, 0x51, 0x34, 0x89, 0x47, 0x59, 0xA9, 0xA2, 0x88, 0xC6,
+        0x31, 0x64, 0xDF, 0x9E, 0xC7, 0x88, 0xB3, 0x64, 0x59, 0x37, 0x9B, 0xCD, 0x90, 0x5D, 0xF9, 0xD9,
+        0x37, 0xE6, 0xB1, 0x8C, 0x47, 0x37, 0x9B, 0x19, 0x18, 0x8C, 0x9A, 0x33, 0x9B, 0xCA, 0xC6, 0x31,
+        0x99, 0xEF, 0x08, 0xA2, 0x8D, 0x5A, 0xAC, 0xD4, 0xD1, 0xAB, 0x19, 0x19, 0xBC, 0x65, 0x91, 0x9B,
+        0xC4, 0x65, 0x93, 0x67, 0x34, 0xE6, 0xC6, 0x30, 0x61, 0xBC, 0xD9, 0x21, 0xBC, 0xDE, 0x2A, 0x3C,
+        0x37, 0x8B, 0x27, 0x79, 0x10, 0x88, 0xEF, 0x8B, 0x26, 0xF0, 0xD9, 0x26, 0xF3, 0x47, 0x82, 0xBC,
+        0xDE, 0x0B, 0x18, 0xF0, 0x74, 0xE6, 0xBC, 0x5C, 0x66, 0xF1, 0x88, 0xB8, 0xCD, 0xE3, 0x17, 0xCD,
+        0x9B, 0xCD, 0x1F, 0x9A, 0xF9, 0xB1, 0x8C, 0xDF, 0x95, 0x88, 0xC6, 0x33, 0x37, 0x9A, 0xF1, 0x61,
+        0x05, 0x8B, 0x1E, 0x6F, 0x2C, 0x63, 0x12, 0x55, 0x9A, 0x27, 0x19, 0xA4, 0x4D, 0x4D, 0x48, 0xF1,
+        0x64, 0x5E, 0x32, 0x6C, 0x7E, 0x7A, 0x3C, 0x59, 0x18, 0xC6, 0x33, 0x79, 0xA3, 0xF3, 0xD8, 0xC8,
+        0xEF, 0x2B, 0x18, 0xC1, 0xD8, 0xCB, 0xCD, 0x64, 0x63, 0x8C, 0x23, 0x45, 0x1D, 0x4E, 0x8D, 0x2A,
+        0x38, 0x5A, 0x27, 0xEA, 0x71, 0x85, 0x58, 0xC0, 0xE2, 0x22, 0x31, 0x82, 0x54, 0x23, 0x05, 0x08,
+        0x94, 0xC7, 0x9A, 0xB4, 0x79, 0xCE, 0xF7, 0xB6, 0x19, 0x61, 0x96, 0x79, 0xEB, 0x9E, 0xFA, 0x52,
+        0xFB, 0x69, 0xC3, 0x86, 0xBC, 0x33, 0xE3, 0x9E, 0xB9, 0xE1, 0xA6, 0x13, 0xA9, 0xE2, 0x82, 0x00,
+        0x81, 0xDA, 0xC4, 0x2A, 0x09, 0x99, 0x92, 0xFA, 0x9F, 0x9E, 0x96, 0x06, 0xA4, 0x1B, 0x65, 0x25,
+        0x0F, 0x39, 0xCA, 0xE2, 0xF1, 0xEE, 0x80, 0xFE, 0x2E, 0xE0, 0x02, 0xCF, 0xA0, 0xF3, 0x7D, 0x67,
+        0xE8, 0x0D, 0xEB, 0x35, 0x7A, 0x71, 0x4B, 0x01, 0x38, 0x3E, 0x20, 0x13, 0x03, 0xC0, 0x11, 0xA0,
+        0x52, 0x06, 0x48, 0x0D, 0xC1, 0x26, 0x05, 0x15, 0x93, 0x67, 0xAF, 0xC5, 0x76, 0x6A, 0xE7, 0x96,
+        0x20, 0x8B, 0x34, 0xC4, 0xE8, 0x4B, 0x5A, 0xA5, 0x4B, 0x97, 0x2F, 0x60, 0x60, 0x62, 0x5C, 0xC2,
+        0xBD, 0x7A, 0xE5, 0x8B, 0x49, 0xC5, 0xC5, 0xC1, 0xB3, 0x46, 0x8C, 0x18, 0xAA, 0xAA, 0x29, 0x98,
+        0xE3, 0x20, 0xC9, 0x8C, 0xC3, 0x12, 0xCE, 0x2B, 0xAC, 0x71, 0xAE, 0x39, 0x9D, 0x71, 0xBE, 0x77,
+        0x9E, 0x73, 0xBC, 0xEF, 0x1A, 0xCD, 0xE2, 0x53, 0x93, 0x79, 0x52, 0x66, 0xA5, 0x1A, 0x28, 0x95,
+        0x25, 0x0A, 0x95, 0x42, 0xA5, 0x50, 0x8A, 0xA1, 0xD5, 0x0C, 0x15, 0x00, 0xD3, 0xC3, 0x16, 0x65,
+        0xCD, 0x7C, 0xBB, 0xCB, 0x71, 0x44, 0xB3, 0x4C, 0xF7, 0x85, 0xDE, 0x1B, 0x30, 0x7E, 0xF1, 0x18,
+        0x1B, 0xC1, 0x73, 0x78, 0x37, 0x37, 0x86, 0xF0, 0x60, 0x33, 0x34, 0x94, 0x33, 0x4C, 0xEA, 0xE2,
+        0x68, 0x4D, 0x02, 0x69, 0x35, 0x57, 0x13, 0xAD, 0xD1, 0x81, 0x23, 0xC3, 0x66, 0x6C, 0x33, 0x79,
+        0x58, 0x03, 0x11, 0x97, 0xCD, 0x83, 0x09, 0xBE, 0x07, 0xF6, 0xCD, 0x16, 0x59, 0xA1, 0x06, 0x0C,
+        0x06, 0x67, 0x7C, 0xA8, 0x62, 0xCB, 0x1A, 0x58, 0x2C, 0x08, 0x8B, 0xE7, 0x78, 0x8C, 0x11, 0xE7,
+        0x71, 0x84, 0x41, 0x99, 0xA5, 0x4C, 0x1A, 0x66, 0x84, 0xD0, 0x6A, 0x78, 0x1F, 0x79, 0x7C, 0xD7,
+        0x17, 0x0D, 0xE1, 0xBC, 0x1B, 0xE7, 0xB3, 0x36, 0x65, 0x79, 0x58, 0x02, 0xC3, 0x78, 0x6F, 0x2E,
+        0x6F, 0x2C, 0x80, 0xEF, 0x01, 0x84, 0xDF, 0xCA, 0xF0, 0xDE, 0x0E, 0x1B, 0xF2, 0x9C, 0x70, 0x92,
+        0xE6, 0x69, 0x54, 0x5A, 0xA7, 0x0C, 0xA8, 0xB8, 0x94, 0x06, 0xB3, 0xA6, 0xEE, 0x5D, 0x6E, 0xBA,
+        0x8D, 0xD7, 0x5A, 0xBA, 0xB3, 0x63, 0xC2, 0x9A, 0x54, 0x75, 0x85, 0xAA, 0xD6, 0x38, 0xEB, 0x5E,
+        0x0E, 0x98, 0x53, 0x4A, 0x61, 0xA6, 0x19, 0x5B, 0x4C, 0xAD, 0x94, 0xB6, 0x36, 0x96, 0x83, 0x90,
+        0x22, 0x28, 0xBA, 0xD6, 0x7A, 0xE2, 0xAC, 0xB3, 0x05, 0xF8, 0xF1, 0xE5, 0xCF, 0xA3, 0x46, 0xCD,
+        0x7B, 0x77, 0x6E, 0xE0, 0xAD, 0xBC, 0x3B, 0xF7, 0xEE, 0xDB, 0xB7, 0x4E, 0x9D, 0x58, 0x33, 0x57,
+        0x65, 0x50, 0xD8, 0x18, 0xC2, 0x06, 0x17, 0x1E, 0xA6, 0xB8, 0x74, 0xAA, 0x4B, 0x28, 0xE3, 0x8A,
+        0x91, 0xC7, 0x60, 0x3B, 0xC0, 0x4A, 0x3E, 0x10, 0x4D, 0x94, 0xAD, 0xE9, 0xBD, 0x66, 0xDF, 0xA0,
+        0x38, 0x02, 0xCF, 0xB9, 0x3B, 0x57, 0x27, 0xF0, 0x59, 0xEF, 0x61, 0x99, 0x68, 0x0A, 0x61, 0xAF,
+        0x17, 0x20, 0x4D, 0xC1, 0x4C, 0x0F, 0xF0, 0x19, 0x03, 0xE4, 0x06, 0xE0, 0xB5, 0x02, 0xDA, 0xD5,
+        0xC7, 0xF3, 0x79, 0x6F, 0xDD, 0x8A, 0xCA, 0x23, 0x88, 0x32, 0xCE, 0x42, 0x84, 0xB4, 0x29, 0x58,
+        0xA9, 0x81, 0x81, 0x7B, 0x0B, 0x13, 0x03, 0x0B, 0x1A, 0xC6, 0x35, 0xAB, 0x8B, 0x52, 0xC5, 0x6A,
+        0x12, 0x26, 0x44, 0x8C, 0xF4, 0x23, 0x9C, 0x50, 0xA5, 0x80, 0x39, 0x13, 0x29, 0x2B, 0xBC, 0xD6,
+        0xF1, 0xCE, 0x39, 0xCC, 0xF1, 0xC6, 0x7A, 0xDE, 0x39, 0xD6, 0xF1, 0xBD, 0xE3, 0x38, 0xB9, 0x6D,
+        0xE6, 0xC6, 0xD6, 0x49, 0x4C, 0x29, 0x82, 0x84, 0x91, 0xD0, 0x87, 0xC4, 0x1D, 0x1D, 0x49, 0x62,
+        0x04, 0x54, 0xF8, 0xCD, 0x53, 0xA3, 0x17, 0x82, 0x44, 0x45, 0xF1, 0xB8, 0x0A, 0x62, 0xE8, 0xB1,
+        0xC7, 0x63, 0x14, 0xDE, 0x56, 0x14, 0x8A, 0x0E, 0x1C, 0x5E, 0x2E, 0x22, 0xE0, 0x32, 0x80, 0xF1,
+        0x70, 0xE1, 0xE2, 0xF1, 0x70, 0x00, 0xDF, 0xCF, 0xBC, 0x40, 0xCA, 0x61, 0xDC, 0xC1, 0x2C, 0xBE,
+        0x7B, 0x99, 0x72, 0x86, 0x50, 0x4C, 0xEF, 0x17, 0x37, 0xCA, 0x01, 0x70, 0xA2, 0xE1, 0xE3, 0x7C,
+        0x37, 0x01, 0xC0, 0x0C, 0x70, 0xB9, 0x70, 0x2E, 0x17, 0x2F, 0x94, 0x6E, 0x05, 0xC2, 0xC8, 0x9C,
+        0xD2, 0x0A, 0xE1, 0x70, 0x2E, 0x67, 0x72, 0xE0, 0x37, 0x02, 0xE5, 0xC2, 0xE0, 0x5C, 0x09, 0xC4,
+        0x6F, 0x8B, 0x87, 0x86, 0xE0, 0x00, 0x07, 0x3B, 0xCB, 0x26, 0xF9, 0x43, 0x28, 0x60, 0xDC, 0xB7,
+        0xE7, 0x71, 0xC2, 0xDF, 0x0A, 0x14, 0x30, 0x02, 0x9E, 0x37, 0x00, 0x3C, 0x5E, 0x0A, 0xE1, 0xC3,
+        0xC5, 0xC0, 0x70, 0x1E, 0x1B, 0x1F, 0x3B, 0xE5, 0xCB, 0x83, 0x30, 0x66, 0x69, 0x50, 0x48, 0xA3,
+        0x49, 0xC2, 0x9C, 0x3A, 0x22, 0x1F, 0x1B, 0xC3, 0x08, 0xDE, 0x1A, 0x98, 0x29, 0x9D, 0x77, 0x52,
+        0xC3, 0xBA, 0xCA, 0xCA, 0x63, 0xF7, 0x29, 0xEC, 0x56, 0xDE, 0x26, 0x26, 0x45, 0x21, 0xA0, 0x42,
+        0x49, 0x48, 0x4A, 0x92, 0xC3, 0x03, 0x96, 0x16, 0xD2, 0x58, 0x6D, 0x4C, 0xB2, 0xA6, 0x92, 0xD2,
+        0x58, 0x1B, 0x52, 0x10, 0x61, 0x65, 0x18, 0x86, 0xB1, 0xCF, 0x9D, 0x56, 0x0B, 0xB1, 0x61, 0xCB,
+        0x8F, 0x3E, 0xAD, 0x7A, 0x76, 0xEC, 0xE2, 0xD7, 0xC5, 0xC1, 0x5B, 0xF8, 0x78, 0x37, 0x6F, 0xDF,
+        0xA7, 0x5E, 0x8C, 0xF8, 0x30, 0x5B, 0x54, 0x50, 0xD8, 0x41, 0x23, 0x49, 0x9F, 0x20, 0xAC, 0xC7,
+        0x44, 0x36, 0x9C, 0xDB, 0x38, 0xEE, 0x98, 0xF8, 0x0C, 0x05, 0x28, 0x4E, 0x05, 0xC6, 0x1B, 0x00,
+        0x2A, 0x4C, 0xB3, 0xBD, 0x8B, 0xF8, 0x2D, 0x00, 0x02, 0xCF, 0x93, 0x63, 0x76, 0x87, 0xD8, 0x53,
+        0xC2, 0x1A, 0x84, 0xC3, 0x3C, 0x94, 0x9C, 0x28, 0x40, 0x05, 0x16, 0x80, 0x84, 0x86, 0x20, 0x19,
+        0x20, 0xBF, 0x01, 0x20, 0x06, 0x6F, 0x11, 0xC2, 0x75, 0x3C, 0xB6, 0x83, 0x09, 0x35, 0x10, 0x48,
+        0x64, 0x70, 0x6C, 0x5A, 0x4A, 0x2E, 0x22, 0x56, 0x90, 0x71, 0xA8, 0xD4, 0x2C, 0x60, 0x62, 0x61,
+        0x63, 0x5A, 0xBD, 0x6A, 0x84, 0xA4, 0xD5, 0xA3, 0x26, 0x8A, 0x30, 0x60, 0xB2, 0x48, 0xA6, 0x62,
+        0xA2, 0x00, 0x09, 0x21, 0x99, 0x7B, 0x9C, 0xEF, 0xDC, 0xF3, 0xED, 0xFD, 0x9C, 0xE7, 0x7B, 0xBE,
+        0x73, 0x7B, 0xBD, 0xDD, 0xDE, 0x2A, 0x3D, 0xBD, 0x5B, 0xD2, 0x6E, 0x5C, 0xE6, 0x85, 0x0A, 0x84,
+        0x3D, 0x21, 0x81, 0x0A, 0x84, 0x09, 0x87, 0xC4, 0xC0, 0xC3, 0x9B, 0x80, 0x03, 0x43, 0xBD, 0xCD,
+        0xF7, 0xB8, 0x73, 0xA6, 0x3B, 0x97, 0x2D, 0xE6, 0xE5, 0x00, 0xB7, 0x1E, 0xED, 0x07, 0x17, 0x5C,
+        0xC3, 0x88, 0x33, 0x10, 0xC0, 0x49, 0x88, 0x65, 0xE6, 0x99, 0x70, 0x67, 0x7C, 0x04, 0xBC, 0xDC,
+        0xA6, 0x5E, 0x6E, 0x17, 0x11, 0xDF, 0x2E, 0x5C, 0x77, 0x32, 0x84, 0x70, 0xAF, 0x0C, 0x29, 0xC5,
+        0xE2, 0xF5, 0x20, 0x3C, 0x0D, 0x79, 0xDC, 0x02, 0x4E, 0xE6, 0x77, 0x20, 0xB9, 0x41, 0xE7, 0xDF,
+        0xCA, 0x19, 0x40, 0xA3, 0x7C, 0x4A, 0x02, 0x1A, 0x2F, 0x0D, 0xE0, 0x54, 0x0B, 0xE6, 0xCC, 0xEE,
+        0x07, 0x3D, 0x2C, 0x5E, 0x2E, 0x88, 0x8B, 0xC3, 0x44, 0x08, 0x26, 0xE9, 0x38, 0x71, 0x74, 0x9C,
+        0x07, 0x43, 0xB9, 0x4C, 0xBC, 0xDC, 0x0E, 0xF8, 0xC0, 0x6E, 0x53, 0x9B, 0x94, 0x31, 0x43, 0x09,
+        0xBA, 0x4D, 0xC3, 0xEB, 0x98, 0x00, 0x04, 0x2E, 0x50, 0xC6, 0x01, 0x97, 0x9B, 0x83, 0x97, 0x2F,
+        0x25, 0x3C, 0xB9, 0x78, 0x98, 0x1D, 0xE1, 0xA0, 0x77, 0xEF, 0x83, 0x42, 0x93, 0xD2, 0x94, 0xD6,
+        0x83, 0xD1, 0xF7, 0x29, 0xAD, 0x39, 0xB7, 0x29, 0x51, 0x18, 0x84, 0xB1, 0x18, 0xAD, 0x63, 0x18,
+        0xF0, 0x70, 0xC2, 0x14, 0xD2, 0x18, 0x61, 0x4A, 0x70, 0x4D, 0x2C, 0xDA, 0x17, 0x1A, 0xAE, 0x22,
+        0xB4, 0x09, 0x03, 0xCE, 0x77, 0xF2, 0xA8, 0xA6, 0xDB, 0xEF, 0xAF, 0x1E, 0x1C, 0x79, 0x32, 0x67,
+        0xD9, 0xBB, 0x67, 0x15, 0x70, 0x70, 0xEF, 0xD7, 0x9F, 0x15, 0x96, 0xCF, 0x66, 0x0C, 0xDC, 0x9D,
+        0x9E, 0x5F, 0x3D, 0xD8, 0xD1, 0xC3, 0xCD, 0xA1, 0x54, 0x2C, 0xBB, 0x54, 0xC2, 0xA2, 0x46, 0x88,
+        0xFB, 0xEF, 0x11, 0xFC, 0x3F, 0xC4, 0x70, 0x59, 0xE0, 0x06, 0x0A, 0x09, 0x4A, 0x0C, 0xF4, 0x84,
+        0xBE, 0x10, 0xEF, 0xB0, 0xA8, 0x02, 0xCF, 0x1D, 0x07, 0x6B, 0x47, 0x96, 0xC7, 0xE9, 0x3D, 0x5B,
+        0x1C, 0x90, 0x8D, 0x62, 0x48, 0xB0, 0x83, 0x04, 0x26, 0x3E, 0x11, 0x8A, 0x89, 0x0C, 0x17, 0xE0,
+        0x5C, 0x09, 0x23, 0x7E, 0x53, 0xF3, 0x5E, 0xA3, 0x8E, 0xD3, 0x56, 0x32, 0x04, 0x4C, 0xDA, 0x52,
+        0x24, 0x41, 0x86, 0x0C, 0x78, 0x70, 0x6C, 0xA9, 0x28, 0x42, 0x0C, 0x52, 0x24, 0x84, 0x09, 0xF4,
+        0xA8, 0xD2, 0x3A, 0x2F, 0x52, 0x95, 0x8F, 0x26, 0xAC, 0xB3, 0x79, 0xF7, 0x8E, 0xA8, 0xF3, 0xAA,
+        0x1B, 0x03, 0x5C, 0xEE, 0x51, 0x9B, 0xE7, 0x4C, 0xA1, 0x42, 0x20, 0x25, 0xC2, 0xE5, 0x0C, 0xA6,
+        0x77, 0x01, 0x00, 0xA7, 0x9D, 0x32, 0xE5, 0x32, 0x89, 0x7C, 0xAF, 0x2D, 0xC2, 0xE1, 0x72, 0x87,
+        0xBB, 0xDC, 0x34, 0x07, 0x0E, 0x5C, 0x8D, 0x32, 0xE5, 0x31, 0x41, 0x32, 0x86, 0x6B, 0xE5, 0x00,
+        0x11, 0xE7, 0x72, 0xE0, 0x4D, 0xCB, 0x85, 0x90, 0x4A, 0x18, 0x4F, 0x7C, 0x29, 0x8C, 0xA2, 0x65,
+        0x24, 0xA1, 0x9D, 0xF9, 0xA0, 0x0E, 0x58, 0x99, 0xDC, 0xE6, 0x80, 0x10, 0x37, 0x77, 0xBD, 0x40,
+        0xD0, 0x39, 0x58, 0x67, 0x70, 0x89, 0xCD, 0x20, 0xA5, 0xF2, 0x8C, 0xCA, 0x11, 0x00, 0x1B, 0x77,
+        0x7B, 0xD4, 0x01, 0xE6, 0xDF, 0x29, 0x1C, 0xA0, 0x73, 0xDF, 0x06, 0x86, 0x29, 0x94, 0xC6, 0x53,
+        0x04, 0xEF, 0xC4, 0xA1, 0x82, 0xE1, 0x70, 0x6F, 0x10, 0xB9, 0x7C, 0xD8, 0x00, 0x0E, 0x76, 0x72,
+        0x86, 0x50, 0x92, 0x98, 0x37, 0x29, 0x91, 0xB9, 0x70, 0x00, 0x12, 0x20, 0x65, 0xCB, 0x97, 0x0B,
+        0x82, 0x5C, 0xCD, 0x99, 0xDC, 0x32, 0x99, 0x70, 0x69, 0xE7, 0x4C, 0x00, 0x2F, 0x94, 0xC0, 0xE3,
+        0xDD, 0xE7, 0x78, 0x68, 0x28, 0x02, 0x18, 0xC5, 0xD1, 0x87, 0x86, 0xA8, 0x41, 0xE0, 0x49, 0xE6,
+        0xC9, 0xC9, 0xBF, 0x83, 0xBC, 0x71, 0x93, 0x8E, 0xF8, 0xBC, 0xF7, 0x09, 0x65, 0x19, 0x52, 0x79,
+        0x8B, 0xB6, 0x72, 0x4D, 0x5D, 0xDE, 0x33, 0xC5, 0x77, 0xBA, 0xAA, 0x65, 0x97, 0xB4, 0x07, 0x02,
+        0x80, 0x11, 0x89, 0xAD, 0x4A, 0xCD, 0x89, 0xE9, 0x9A, 0x4E, 0x23, 0x2D, 0xB0, 0x32, 0x27, 0x0B,
+        0x77, 0x16, 0x08, 0x50, 0x41, 0x69, 0x15, 0x6B, 0x0C, 0x90, 0x6B, 0x64, 0xFA, 0x4F, 0xBC, 0xB6,
+        0x40, 0x02, 0xCE, 0xD9, 0xEE, 0xDE, 0xCE, 0x4B, 0x3F, 0x80, 0x06, 0x3D, 0x54, 0xF1, 0x1E, 0xC0,
+        0xCD, 0x01, 0xB4, 0x0C, 0x68, 0xCD, 0x45, 0x76, 0x21, 0x70, 0x52, 0x82, 0x48, 0x2D, 0xCF, 0xE4,
+        0x9E, 0x91, 0xE3, 0x1C, 0xE3, 0x7E, 0xD0, 0xA9, 0x50, 0xE4, 0x41, 0x80, 0x91, 0x52, 0xD1, 0xF2,
+        0xB2, 0x53, 0xE7, 0xD7, 0x5E, 0x78, 0xE3, 0x1A, 0x9B, 0x98, 0x22, 0x22, 0x16, 0x31, 0xA5, 0x4A,
+        0xA8, 0xE0, 0x4D, 0x09, 0x44, 0x26, 0x71, 0x95, 0x28, 0xCA, 0xBA, 0xCD, 0x64, 0x7C, 0xEC, 0xD3,
+        0x3B, 0xCD, 0x0A, 0x65, 0x45, 0xCB, 0x94, 0x0B, 0x97, 0x0A, 0x02, 0x06, 0x52, 0xF9, 0x6E, 0x00,
+        0x51, 0xCB, 0x97, 0x0A, 0x65, 0xCA, 0x67, 0xBC, 0x1C, 0xA0, 0x5C, 0x0B, 0x81, 0x73, 0x4A, 0x9C,
+        0x31, 0x17, 0x86, 0x14, 0xC4, 0x5E, 0x06, 0x96, 0x4B, 0xE7, 0x70, 0x2C, 0x70, 0x1B, 0x94, 0xE6,
+        0x86, 0x5C, 0xAF, 0x28, 0x26, 0x56, 0x65, 0x07, 0x9D, 0xCC, 0xEF, 0x83, 0xAF, 0x94, 0x06, 0x01,
+        0x67, 0x3A, 0x38, 0x0B, 0xE5, 0xB8, 0x32, 0xE5, 0xF0, 0xB3, 0x40, 0x38, 0x29, 0xC0, 0x9D, 0x5C,
+        0x31, 0xC1, 0x4F, 0x3B, 0x1C, 0x03, 0x79, 0x4A, 0x03, 0x48, 0x07, 0x13, 0x4F, 0x59, 0x89, 0x1E,
+        0x5C, 0x05, 0xC2, 0xE6, 0xF0, 0x02, 0x68, 0xE2, 0xC2, 0x41, 0xC3, 0xC6, 0x68, 0x0D, 0xC6, 0x5C,
+        0x0D, 0xF9, 0xDC, 0xB8, 0xC1, 0x2E, 0x67, 0x64, 0x0B, 0xE6, 0xB8, 0x02, 0x30, 0x0C, 0xEC, 0xE7,
+        0x7C, 0xB7, 0xCD, 0x18, 0x19, 0x59, 0x94, 0x33, 0x66, 0x51, 0xCA, 0x1C, 0xD3, 0x2E, 0x16, 0x38,
+        0x09, 0x7C, 0xEE, 0x2E, 0x19, 0xDF, 0x2D, 0xE2, 0x26, 0x77, 0xCA, 0x65, 0xCD, 0xE5, 0xC0, 0xA3,
+        0x81, 0x70, 0x0C, 0xBB, 0xF2, 0x99, 0x47, 0x29, 0x85, 0xCB, 0x97, 0x00, 0x28, 0xE6, 0x77, 0x0C,
+        0xA0, 0x06, 0x17, 0x06, 0xE0, 0x19, 0x72, 0xC9, 0x94, 0xC0, 0x85, 0x4E, 0x18, 0xA3, 0x8B, 0xD4,
+        0xEA, 0x70, 0x4A, 0x91, 0xA3, 0xAB, 0xAA, 0x06, 0x84, 0xD0, 0x2B, 0x53, 0x26, 0x4E, 0x6E, 0xDB,
+        0x6C, 0x42, 0x20, 0x8E, 0x54, 0x51, 0x59, 0x35, 0xD6, 0x66, 0xD9, 0x83, 0x74, 0xCA, 0x80, 0xB9,
+        0x0D, 0x1A, 0xC9, 0x90, 0x67, 0xDA, 0xDF, 0x0B, 0xE4, 0x7C, 0x47, 0x36, 0xA4, 0x54, 0xD8, 0x63,
+        0x5E, 0x71, 0xB6, 0x06, 0x38, 0x36, 0x66, 0x67, 0x3D, 0x7A, 0x78, 0x63, 0xD6, 0xF8, 0x00, 0xB9,
+        0x2D, 0x00, 0x02, 0xBF, 0xFF, 0xDA, 0xF2, 0x2D, 0x1F, 0xFF, 0xD4, 0xB4, 0x91, 0x53, 0x21, 0xD2,
+        0xC0, 0xCC, 0x50, 0x43, 0xCC, 0x31, 0xC0, 0x5C, 0x20, 0x40, 0x68, 0x0C, 0x40, 0x2C, 0x12, 0x17,
+        0x59, 0x20, 0xAE, 0x52, 0xA5, 0x52, 0xC5, 0x4A, 0xD3, 0x29, 0x52, 0x91, 0x3A, 0x62, 0xC4, 0xA1,
+        0x02, 0x24, 0x48, 0x90, 0x1A, 0x72, 0x12, 0x8B, 0x34, 0xB2, 0xC8, 0x1C, 0x39, 0x5A, 0x58, 0x25,
+        0x24, 0x96, 0x14, 0xA2, 0xB1, 0x11, 0x48, 0x89, 0x8C, 0xEA, 0xC6, 0xEA, 0x4B, 0x20, 0xD9, 0xCD,
+        0x31, 0x65, 0x5D, 0x6F, 0x0C, 0x7A, 0x65, 0x9A, 0x4D, 0x83, 0x2C, 0x47, 0x28, 0xCC, 0xAB, 0x81,
+        0x9A, 0xE0, 0x80, 0x30, 0x2F, 0x2E, 0x6F, 0x9D, 0xC1, 0x59, 0x9A, 0x61, 0x4C, 0xA1, 0x94, 0x42,
+        0x33, 0x72, 0xF9, 0xDC, 0xB9, 0x71, 0x18, 0x77, 0x31, 0x4B, 0xE2, 0xDF, 0x36, 0x0E, 0x77, 0x89,
+        0xBC, 0xBE, 0x6B, 0x93, 0x71, 0x22, 0x2A, 0x60, 0xAB, 0xD1, 0xBA, 0x46, 0x70, 0x53, 0xAB, 0x53,
+        0x49, 0xA2, 0x52, 0x31, 0x23, 0x39, 0xEF, 0x16, 0x66, 0xC8, 0xB0, 0x83, 0xBC, 0x66, 0xF1, 0x79,
+        0xAF, 0x11, 0x84, 0xA6, 0xA7, 0x59, 0xA9, 0xA2, 0x27, 0x09, 0x91, 0x20, 0xC8, 0xEF, 0x22, 0xE5,
+        0x90, 0x5D, 0xE4, 0x58, 0x24, 0xC7, 0xBC, 0x09, 0x4D, 0x4E, 0xB3, 0x53, 0x44, 0xA0, 0xA5, 0x0F,
+        0x36, 0x4D, 0xE3, 0x37, 0x88, 0xC8, 0x8B, 0xCA, 0xC9, 0xBF, 0x35, 0xE5, 0x8B, 0x09, 0x18, 0x33,
+        0x47, 0x19, 0xAB, 0xA4, 0x67, 0x04, 0xB3, 0x82, 0x9D, 0x48, 0x49, 0xD1, 0x68, 0xAA, 0xE2, 0x68,
+        0x29, 0xC3, 0x35, 0x70, 0x90, 0xF7, 0x09, 0x2D, 0xF0, 0x65, 0xCB, 0x94, 0x7C, 0xEE, 0x5E, 0x31,
+        0x0C, 0xA1, 0x94, 0x4C, 0x29, 0xCA, 0xC9, 0x7C, 0xEF, 0x2E, 0x07, 0xDE, 0x2C, 0x1D, 0xBF, 0x70,
+        0x36, 0x4C, 0xAC, 0x32, 0xC7, 0x18, 0x11, 0xA2, 0x28, 0xC3, 0x18, 0x8B, 0xE2, 0x70, 0x49, 0x60,
+        0x44, 0xE9, 0x44, 0x08, 0x55, 0x3C, 0x02, 0xC6, 0x74, 0xE8, 0x22, 0x51, 0x9A, 0xDB, 0x47, 0x53,
+        0x8C, 0xCE, 0xF1, 0xAF, 0x17, 0xBE, 0xBA, 0xF1, 0xD7, 0x35, 0x82, 0xDB, 0x2F, 0xC3, 0x87, 0x0D,
+        0xF9, 0xF0, 0xE5, 0xCD, 0x8F, 0x46, 0x8C, 0xB5, 0xAB, 0x4E, 0xBD, 0x3A, 0x34, 0x6D, 0x82, 0x8E,
+        0xAE, 0x39, 0x94, 0x99, 0xF0, 0x98, 0xB0, 0xC8, 0x0F, 0x41, 0x42, 0x03, 0x47, 0x4C, 0x4C, 0x72,
+        0x46, 0xFF, 0xFE, 0xA5, 0xC0, 0x00, 0x00, 0x00, 0x00
+    };
+
+    static const AKWFTableRef tables[count] PROGMEM = {
+        { data +      0, 600 },   //   0 AKWF_bsaw_0001
+        { data +    348, 600 },   //   1 AKWF_bsaw_0002
+        { data +    693, 600 },   //   2 AKWF_bsaw_0003
+        { data +   1031, 600 },   //   3 AKWF_bsaw_0004
+        { data +   1370, 600 },   //   4 AKWF_bsaw_0005
+        { data +   1729, 600 },   //   5 AKWF_bsaw_0006
+        { data +   2104, 600 },   //   6 AKWF_bsaw_0007
+        { data +   2469, 600 },   //   7 AKWF_bsaw_0008
+        { data +   2785, 600 },   //   8 AKWF_bsaw_0009
+        { data +   3122, 600 }    //   9 AKWF_bsaw_0010
+    };
+
+} // namespace AKWF_BwSawbright
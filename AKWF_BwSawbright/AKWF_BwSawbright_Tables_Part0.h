@@ -1,548 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwSawbright {
-
-    // AKWF_bsaw_0001 → 600 samples
-    static const int16_t akwf_akwf_bwsawbright_akwf_bsaw_0001[600] PROGMEM = {
-        13182, 31099, 32767, 29696, 30394, 30387, 30081, 30159, 29988, 29923, 29715, 29568, 
-        29299, 29035, 28693, 28332, 27973, 27593, 27154, 26685, 26210, 25720, 25219, 24714, 
-        24208, 23698, 23194, 22695, 22207, 21725, 21260, 20809, 20374, 19954, 19554, 19173, 
-        18815, 18474, 18157, 17858, 17582, 17327, 17093, 16881, 16687, 16512, 16358, 16221, 
-        16101, 15998, 15909, 15837, 15775, 15725, 15692, 15665, 15651, 15644, 15644, 15650, 
-        15662, 15680, 15703, 15727, 15752, 15782, 15813, 15842, 15871, 15900, 15929, 15953, 
-        15977, 15998, 16017, 16030, 16042, 16051, 16056, 16056, 16053, 16044, 16034, 16018, 
-        15996, 15974, 15945, 15914, 15878, 15840, 15797, 15751, 15701, 15651, 15596, 15538, 
-        15478, 15415, 15351, 15286, 15216, 15147, 15075, 15003, 14928, 14852, 14777, 14700, 
-        14621, 14545, 14463, 14388, 14307, 14228, 14153, 14072, 13993, 13913, 13835, 13758, 
-        13679, 13604, 13527, 13450, 13374, 13299, 13225, 13150, 13076, 12999, 12927, 12855, 
-        12781, 12711, 12639, 12567, 12495, 12426, 12352, 12284, 12213, 12141, 12073, 12002, 
-        11932, 11862, 11792, 11723, 11653, 11582, 11512, 11443, 11371, 11301, 11233, 11162, 
-        11090, 11020, 10950, 10878, 10807, 10735, 10665, 10593, 10519, 10447, 10375, 10303, 
-        10231, 10157, 10084, 10010, 9936, 9861, 9787, 9713, 9640, 9566, 9492, 9415, 
-        9341, 9264, 9189, 9113, 9038, 8962, 8887, 8811, 8734, 8657, 8582, 8506, 
-        8429, 8352, 8273, 8198, 8120, 8043, 7966, 7889, 7813, 7736, 7659, 7580, 
-        7505, 7426, 7350, 7272, 7194, 7117, 7040, 6963, 6884, 6807, 6730, 6651, 
-        6572, 6495, 6416, 6340, 6263, 6184, 6106, 6030, 5951, 5872, 5793, 5716, 
-        5637, 5560, 5481, 5404, 5325, 5248, 5171, 5090, 5013, 4936, 4856, 4778, 
-        4698, 4621, 4543, 4465, 4386, 4307, 4228, 4151, 4070, 3993, 3916, 3834, 
-        3758, 3676, 3599, 3520, 3441, 3362, 3285, 3204, 3127, 3047, 2968, 2890, 
-        2808, 2729, 2654, 2573, 2494, 2414, 2335, 2256, 2177, 2098, 2019, 1939, 
-        1860, 1783, 1704, 1623, 1544, 1464, 1385, 1304, 1227, 1148, 1068, 989, 
-        910, 831, 752, 673, 595, 514, 435, 356, 277, 198, 120, 39, 
-        -39, -120, -198, -277, -356, -435, -514, -595, -673, -752, -831, -910, 
-        -989, -1068, -1148, -1227, -1304, -1385, -1464, -1544, -1623, -1704, -1783, -1860, 
-        -1939, -2019, -2098, -2177, -2256, -2335, -2414, -2494, -2573, -2654, -2729, -2808, 
-        -2890, -2968, -3047, -3127, -3204, -3285, -3362, -3441, -3520, -3599, -3676, -3758, 
-        -3834, -3916, -3993, -4070, -4151, -4228, -4307, -4386, -4465, -4543, -4621, -4698, 
-        -4778, -4856, -4936, -5013, -5090, -5171, -5248, -5325, -5404, -5481, -5560, -5637, 
-        -5716, -5793, -5872, -5951, -6030, -6106, -6184, -6263, -6340, -6416, -6495, -6572, 
-        -6651, -6730, -6807, -6884, -6963, -7040, -7117, -7194, -7272, -7350, -7426, -7505, 
-        -7580, -7659, -7736, -7813, -7889, -7966, -8043, -8120, -8198, -8273, -8352, -8429, 
-        -8506, -8582, -8657, -8734, -8811, -8887, -8962, -9038, -9113, -9189, -9264, -9341, 
-        -9415, -9492, -9566, -9640, -9713, -9787, -9861, -9936, -10010, -10084, -10157, -10231, 
-        -10303, -10375, -10447, -10519, -10593, -10665, -10735, -10807, -10878, -10950, -11020, -11090, 
-        -11162, -11233, -11301, -11371, -11443, -11512, -11582, -11653, -11723, -11792, -11862, -11932, 
-        -12002, -12073, -12141, -12213, -12284, -12352, -12426, -12495, -12567, -12639, -12711, -12781, 
-        -12855, -12927, -12999, -13076, -13150, -13225, -13299, -13374, -13450, -13527, -13604, -13679, 
-        -13758, -13835, -13913, -13993, -14072, -14153, -14228, -14307, -14388, -14463, -14545, -14621, 
-        -14700, -14777, -14852, -14928, -15003, -15075, -15147, -15216, -15286, -15351, -15415, -15478, 
-        -15538, -15596, -15651, -15701, -15751, -15797, -15840, -15878, -15914, -15945, -15974, -15996, 
-        -16018, -16034, -16044, -16053, -16056, -16056, -16051, -16042, -16030, -16017, -15998, -15977, 
-        -15953, -15929, -15900, -15871, -15842, -15813, -15782, -15752, -15727, -15703, -15680, -15662, 
-        -15650, -15644, -15644, -15651, -15665, -15692, -15725, -15775, -15837, -15909, -15998, -16101, 
-        -16221, -16358, -16512, -16687, -16881, -17093, -17327, -17582, -17858, -18157, -18474, -18815, 
-        -19173, -19554, -19954, -20374, -20809, -21260, -21725, -22207, -22695, -23194, -23698, -24208, 
-        -24714, -25219, -25720, -26210, -26685, -27154, -27593, -27973, -28332, -28693, -29035, -29299, 
-        -29568, -29715, -29923, -29988, -30159, -30081, -30387, -30394, -29696, -32767, -31099, -13182 
-    };
-
-    // AKWF_bsaw_0002 → 600 samples
-    static const int16_t akwf_akwf_bwsawbright_akwf_bsaw_0002[600] PROGMEM = {
-        12866, 30771, 32767, 29223, 29196, 28862, 28300, 28172, 27877, 27711, 27438, 27242, 
-        26946, 26664, 26316, 25954, 25603, 25233, 24816, 24366, 23919, 23455, 22987, 22513, 
-        22040, 21571, 21105, 20645, 20197, 19756, 19330, 18920, 18523, 18143, 17781, 17439, 
-        17114, 16813, 16527, 16263, 16017, 15792, 15585, 15398, 15228, 15078, 14945, 14827, 
-        14725, 14638, 14563, 14504, 14454, 14417, 14390, 14372, 14363, 14361, 14365, 14376, 
-        14392, 14411, 14434, 14458, 14486, 14513, 14541, 14570, 14599, 14625, 14652, 14673, 
-        14697, 14716, 14731, 14745, 14754, 14761, 14763, 14761, 14757, 14750, 14738, 14722, 
-        14700, 14679, 14650, 14620, 14586, 14549, 14509, 14465, 14418, 14370, 14318, 14263, 
-        14204, 14149, 14088, 14026, 13963, 13897, 13831, 13764, 13694, 13624, 13553, 13483, 
-        13412, 13341, 13268, 13194, 13123, 13050, 12979, 12905, 12832, 12763, 12690, 12618, 
-        12547, 12477, 12408, 12336, 12267, 12199, 12129, 12062, 11994, 11924, 11858, 11792, 
-        11726, 11658, 11592, 11528, 11462, 11400, 11334, 11268, 11205, 11139, 11075, 11011, 
-        10947, 10882, 10820, 10754, 10691, 10625, 10563, 10499, 10435, 10370, 10306, 10242, 
-        10176, 10112, 10047, 9981, 9915, 9851, 9785, 9717, 9651, 9585, 9519, 9452, 
-        9385, 9318, 9250, 9184, 9116, 9048, 8979, 8911, 8843, 8775, 8706, 8636, 
-        8567, 8501, 8431, 8361, 8292, 8220, 8153, 8081, 8012, 7942, 7871, 7801, 
-        7732, 7662, 7591, 7519, 7448, 7378, 7307, 7236, 7166, 7095, 7025, 6954, 
-        6882, 6813, 6740, 6670, 6599, 6527, 6456, 6386, 6315, 6242, 6174, 6103, 
-        6030, 5960, 5887, 5816, 5744, 5673, 5601, 5530, 5457, 5386, 5316, 5243, 
-        5172, 5100, 5029, 4957, 4886, 4813, 4742, 4668, 4599, 4526, 4454, 4383, 
-        4310, 4237, 4167, 4094, 4023, 3951, 3878, 3807, 3734, 3662, 3589, 3518, 
-        3445, 3373, 3300, 3229, 3156, 3084, 3013, 2940, 2867, 2795, 2722, 2651, 
-        2577, 2506, 2433, 2360, 2287, 2215, 2142, 2069, 1998, 1923, 1853, 1778, 
-        1707, 1634, 1562, 1489, 1416, 1345, 1272, 1197, 1127, 1054, 981, 908, 
-        836, 763, 690, 617, 545, 474, 399, 326, 253, 181, 110, 35, 
-        -35, -110, -181, -253, -326, -399, -474, -545, -617, -690, -763, -836, 
-        -908, -981, -1054, -1127, -1197, -1272, -1345, -1416, -1489, -1562, -1634, -1707, 
-        -1778, -1853, -1923, -1998, -2069, -2142, -2215, -2287, -2360, -2433, -2506, -2577, 
-        -2651, -2722, -2795, -2867, -2940, -3013, -3084, -3156, -3229, -3300, -3373, -3445, 
-        -3518, -3589, -3662, -3734, -3807, -3878, -3951, -4023, -4094, -4167, -4237, -4310, 
-        -4383, -4454, -4526, -4599, -4668, -4742, -4813, -4886, -4957, -5029, -5100, -5172, 
-        -5243, -5316, -5386, -5457, -5530, -5601, -5673, -5744, -5816, -5887, -5960, -6030, 
-        -6103, -6174, -6242, -6315, -6386, -6456, -6527, -6599, -6670, -6740, -6813, -6882, 
-        -6954, -7025, -7095, -7166, -7236, -7307, -7378, -7448, -7519, -7591, -7662, -7732, 
-        -7801, -7871, -7942, -8012, -8081, -8153, -8220, -8292, -8361, -8431, -8501, -8567, 
-        -8636, -8706, -8775, -8843, -8911, -8979, -9048, -9116, -9184, -9250, -9318, -9385, 
-        -9452, -9519, -9585, -9651, -9717, -9785, -9851, -9915, -9981, -10047, -10112, -10176, 
-        -10242, -10306, -10370, -10435, -10499, -10563, -10625, -10691, -10754, -10820, -10882, -10947, 
-        -11011, -11075, -11139, -11205, -11268, -11334, -11400, -11462, -11528, -11592, -11658, -11726, 
-        -11792, -11858, -11924, -11994, -12062, -12129, -12199, -12267, -12336, -12408, -12477, -12547, 
-        -12618, -12690, -12763, -12832, -12905, -12979, -13050, -13123, -13194, -13268, -13341, -13412, 
-        -13483, -13553, -13624, -13694, -13764, -13831, -13897, -13963, -14026, -14088, -14149, -14204, 
-        -14263, -14318, -14370, -14418, -14465, -14509, -14549, -14586, -14620, -14650, -14679, -14700, 
-        -14722, -14738, -14750, -14757, -14761, -14763, -14761, -14754, -14745, -14731, -14716, -14697, 
-        -14673, -14652, -14625, -14599, -14570, -14541, -14513, -14486, -14458, -14434, -14411, -14392, 
-        -14376, -14365, -14361, -14363, -14372, -14390, -14417, -14454, -14504, -14563, -14638, -14725, 
-        -14827, -14945, -15078, -15228, -15398, -15585, -15792, -16017, -16263, -16527, -16813, -17114, 
-        -17439, -17781, -18143, -18523, -18920, -19330, -19756, -20197, -20645, -21105, -21571, -22040, 
-        -22513, -22987, -23455, -23919, -24366, -24816, -25233, -25603, -25954, -26316, -26664, -26946, 
-        -27242, -27438, -27711, -27877, -28172, -28300, -28862, -29196, -29223, -32767, -30771, -12866 
-    };
-
-    // AKWF_bsaw_0003 → 600 samples
-    static const int16_t akwf_akwf_bwsawbright_akwf_bsaw_0003[600] PROGMEM = {
-        12031, 29861, 32767, 28076, 26028, 24696, 23502, 22919, 22398, 22075, 21728, 21482, 
-        21178, 20896, 20570, 20243, 19929, 19609, 19255, 18872, 18492, 18106, 17719, 17333, 
-        16951, 16575, 16202, 15842, 15489, 15148, 14818, 14505, 14202, 13916, 13645, 13390, 
-        13152, 12930, 12725, 12534, 12361, 12203, 12060, 11932, 11817, 11717, 11630, 11556, 
-        11493, 11441, 11400, 11369, 11343, 11326, 11320, 11318, 11322, 11330, 11343, 11361, 
-        11378, 11400, 11423, 11446, 11472, 11499, 11526, 11550, 11573, 11595, 11614, 11632, 
-        11649, 11663, 11673, 11682, 11686, 11688, 11688, 11684, 11676, 11667, 11655, 11637, 
-        11618, 11597, 11571, 11546, 11515, 11482, 11446, 11409, 11369, 11328, 11285, 11238, 
-        11191, 11142, 11092, 11043, 10990, 10938, 10883, 10827, 10772, 10716, 10659, 10603, 
-        10546, 10489, 10431, 10374, 10316, 10259, 10201, 10146, 10088, 10031, 9975, 9920, 
-        9864, 9807, 9755, 9700, 9644, 9593, 9536, 9482, 9431, 9378, 9326, 9273, 
-        9221, 9170, 9117, 9069, 9016, 8967, 8915, 8864, 8813, 8765, 8714, 8663, 
-        8613, 8564, 8513, 8464, 8412, 8361, 8312, 8262, 8211, 8158, 8110, 8059, 
-        8006, 7956, 7905, 7854, 7802, 7751, 7698, 7646, 7595, 7542, 7490, 7435, 
-        7385, 7330, 7277, 7225, 7170, 7118, 7065, 7010, 6956, 6901, 6849, 6794, 
-        6739, 6685, 6630, 6576, 6521, 6467, 6410, 6355, 6301, 6244, 6190, 6135, 
-        6079, 6026, 5970, 5913, 5858, 5802, 5747, 5689, 5636, 5580, 5525, 5469, 
-        5412, 5358, 5301, 5244, 5188, 5135, 5077, 5022, 4966, 4909, 4853, 4798, 
-        4740, 4685, 4629, 4572, 4517, 4461, 4404, 4348, 4291, 4235, 4178, 4122, 
-        4067, 4011, 3954, 3898, 3841, 3785, 3728, 3670, 3615, 3559, 3502, 3447, 
-        3391, 3332, 3276, 3219, 3163, 3106, 3050, 2991, 2937, 2880, 2824, 2765, 
-        2709, 2652, 2596, 2539, 2483, 2424, 2370, 2311, 2255, 2198, 2140, 2083, 
-        2027, 1970, 1914, 1855, 1799, 1740, 1684, 1627, 1570, 1512, 1455, 1397, 
-        1342, 1284, 1227, 1169, 1112, 1056, 999, 943, 884, 828, 769, 713, 
-        656, 598, 541, 485, 430, 372, 315, 257, 198, 142, 85, 27, 
-        -27, -85, -142, -198, -257, -315, -372, -430, -485, -541, -598, -656, 
-        -713, -769, -828, -884, -943, -999, -1056, -1112, -1169, -1227, -1284, -1342, 
-        -1397, -1455, -1512, -1570, -1627, -1684, -1740, -1799, -1855, -1914, -1970, -2027, 
-        -2083, -2140, -2198, -2255, -2311, -2370, -2424, -2483, -2539, -2596, -2652, -2709, 
-        -2765, -2824, -2880, -2937, -2991, -3050, -3106, -3163, -3219, -3276, -3332, -3391, 
-        -3447, -3502, -3559, -3615, -3670, -3728, -3785, -3841, -3898, -3954, -4011, -4067, 
-        -4122, -4178, -4235, -4291, -4348, -4404, -4461, -4517, -4572, -4629, -4685, -4740, 
-        -4798, -4853, -4909, -4966, -5022, -5077, -5135, -5188, -5244, -5301, -5358, -5412, 
-        -5469, -5525, -5580, -5636, -5689, -5747, -5802, -5858, -5913, -5970, -6026, -6079, 
-        -6135, -6190, -6244, -6301, -6355, -6410, -6467, -6521, -6576, -6630, -6685, -6739, 
-        -6794, -6849, -6901, -6956, -7010, -7065, -7118, -7170, -7225, -7277, -7330, -7385, 
-        -7435, -7490, -7542, -7595, -7646, -7698, -7751, -7802, -7854, -7905, -7956, -8006, 
-        -8059, -8110, -8158, -8211, -8262, -8312, -8361, -8412, -8464, -8513, -8564, -8613, 
-        -8663, -8714, -8765, -8813, -8864, -8915, -8967, -9016, -9069, -9117, -9170, -9221, 
-        -9273, -9326, -9378, -9431, -9482, -9536, -9593, -9644, -9700, -9755, -9807, -9864, 
-        -9920, -9975, -10031, -10088, -10146, -10201, -10259, -10316, -10374, -10431, -10489, -10546, 
-        -10603, -10659, -10716, -10772, -10827, -10883, -10938, -10990, -11043, -11092, -11142, -11191, 
-        -11238, -11285, -11328, -11369, -11409, -11446, -11482, -11515, -11546, -11571, -11597, -11618, 
-        -11637, -11655, -11667, -11676, -11684, -11688, -11688, -11686, -11682, -11673, -11663, -11649, 
-        -11632, -11614, -11595, -11573, -11550, -11526, -11499, -11472, -11446, -11423, -11400, -11378, 
-        -11361, -11343, -11330, -11322, -11318, -11320, -11326, -11343, -11369, -11400, -11441, -11493, 
-        -11556, -11630, -11717, -11817, -11932, -12060, -12203, -12361, -12534, -12725, -12930, -13152, 
-        -13390, -13645, -13916, -14202, -14505, -14818, -15148, -15489, -15842, -16202, -16575, -16951, 
-        -17333, -17719, -18106, -18492, -18872, -19255, -19609, -19929, -20243, -20570, -20896, -21178, 
-        -21482, -21728, -22075, -22398, -22919, -23502, -24696, -26028, -28076, -32767, -29861, -12031 
-    };
-
-    // AKWF_bsaw_0004 → 600 samples
-    static const int16_t akwf_akwf_bwsawbright_akwf_bsaw_0004[600] PROGMEM = {
-        11862, 29670, 32767, 27864, 25386, 23826, 22510, 21853, 21306, 20972, 20629, 20390, 
-        20093, 19818, 19505, 19186, 18884, 18577, 18236, 17866, 17498, 17128, 16758, 16389, 
-        16023, 15665, 15311, 14966, 14634, 14311, 14000, 13703, 13418, 13151, 12896, 12658, 
-        12434, 12227, 12037, 11860, 11698, 11552, 11419, 11302, 11197, 11106, 11027, 10960, 
-        10904, 10857, 10821, 10794, 10774, 10762, 10758, 10758, 10762, 10774, 10790, 10803, 
-        10825, 10847, 10871, 10894, 10920, 10944, 10968, 10991, 11015, 11035, 11053, 11071, 
-        11086, 11100, 11110, 11116, 11120, 11122, 11122, 11116, 11110, 11100, 11086, 11069, 
-        11051, 11029, 11003, 10980, 10948, 10918, 10883, 10847, 10807, 10768, 10726, 10683, 
-        10637, 10592, 10542, 10495, 10443, 10392, 10340, 10289, 10235, 10182, 10128, 10075, 
-        10020, 9966, 9911, 9857, 9802, 9746, 9691, 9639, 9584, 9531, 9477, 9424, 
-        9370, 9319, 9267, 9216, 9164, 9113, 9061, 9010, 8961, 8909, 8860, 8812, 
-        8763, 8713, 8664, 8614, 8569, 8519, 8472, 8422, 8375, 8327, 8280, 8232, 
-        8185, 8137, 8090, 8042, 7995, 7947, 7898, 7850, 7803, 7753, 7708, 7658, 
-        7609, 7559, 7512, 7464, 7415, 7367, 7316, 7266, 7217, 7167, 7116, 7066, 
-        7017, 6965, 6916, 6864, 6815, 6763, 6712, 6662, 6611, 6557, 6508, 6455, 
-        6403, 6352, 6298, 6249, 6197, 6144, 6092, 6039, 5987, 5934, 5882, 5829, 
-        5778, 5724, 5673, 5619, 5566, 5512, 5459, 5407, 5354, 5302, 5249, 5196, 
-        5142, 5089, 5037, 4982, 4928, 4877, 4823, 4772, 4719, 4665, 4612, 4558, 
-        4505, 4451, 4398, 4344, 4291, 4240, 4184, 4131, 4077, 4024, 3970, 3917, 
-        3863, 3812, 3757, 3703, 3652, 3596, 3543, 3487, 3434, 3380, 3329, 3274, 
-        3220, 3167, 3113, 3060, 3004, 2951, 2897, 2844, 2789, 2735, 2682, 2628, 
-        2575, 2519, 2466, 2412, 2359, 2304, 2250, 2197, 2141, 2086, 2034, 1979, 
-        1924, 1872, 1817, 1763, 1708, 1654, 1599, 1545, 1492, 1439, 1383, 1330, 
-        1274, 1219, 1165, 1112, 1059, 1003, 950, 894, 841, 787, 732, 676, 
-        623, 570, 514, 461, 407, 352, 298, 245, 188, 134, 81, 27, 
-        -27, -81, -134, -188, -245, -298, -352, -407, -461, -514, -570, -623, 
-        -676, -732, -787, -841, -894, -950, -1003, -1059, -1112, -1165, -1219, -1274, 
-        -1330, -1383, -1439, -1492, -1545, -1599, -1654, -1708, -1763, -1817, -1872, -1924, 
-        -1979, -2034, -2086, -2141, -2197, -2250, -2304, -2359, -2412, -2466, -2519, -2575, 
-        -2628, -2682, -2735, -2789, -2844, -2897, -2951, -3004, -3060, -3113, -3167, -3220, 
-        -3274, -3329, -3380, -3434, -3487, -3543, -3596, -3652, -3703, -3757, -3812, -3863, 
-        -3917, -3970, -4024, -4077, -4131, -4184, -4240, -4291, -4344, -4398, -4451, -4505, 
-        -4558, -4612, -4665, -4719, -4772, -4823, -4877, -4928, -4982, -5037, -5089, -5142, 
-        -5196, -5249, -5302, -5354, -5407, -5459, -5512, -5566, -5619, -5673, -5724, -5778, 
-        -5829, -5882, -5934, -5987, -6039, -6092, -6144, -6197, -6249, -6298, -6352, -6403, 
-        -6455, -6508, -6557, -6611, -6662, -6712, -6763, -6815, -6864, -6916, -6965, -7017, 
-        -7066, -7116, -7167, -7217, -7266, -7316, -7367, -7415, -7464, -7512, -7559, -7609, 
-        -7658, -7708, -7753, -7803, -7850, -7898, -7947, -7995, -8042, -8090, -8137, -8185, 
-        -8232, -8280, -8327, -8375, -8422, -8472, -8519, -8569, -8614, -8664, -8713, -8763, 
-        -8812, -8860, -8909, -8961, -9010, -9061, -9113, -9164, -9216, -9267, -9319, -9370, 
-        -9424, -9477, -9531, -9584, -9639, -9691, -9746, -9802, -9857, -9911, -9966, -10020, 
-        -10075, -10128, -10182, -10235, -10289, -10340, -10392, -10443, -10495, -10542, -10592, -10637, 
-        -10683, -10726, -10768, -10807, -10847, -10883, -10918, -10948, -10980, -11003, -11029, -11051, 
-        -11069, -11086, -11100, -11110, -11116, -11122, -11122, -11120, -11116, -11110, -11100, -11086, 
-        -11071, -11053, -11035, -11015, -10991, -10968, -10944, -10920, -10894, -10871, -10847, -10825, 
-        -10803, -10790, -10774, -10762, -10758, -10758, -10762, -10774, -10794, -10821, -10857, -10904, 
-        -10960, -11027, -11106, -11197, -11302, -11419, -11552, -11698, -11860, -12037, -12227, -12434, 
-        -12658, -12896, -13151, -13418, -13703, -14000, -14311, -14634, -14966, -15311, -15665, -16023, 
-        -16389, -16758, -17128, -17498, -17866, -18236, -18577, -18884, -19186, -19505, -19818, -20093, 
-        -20390, -20629, -20972, -21306, -21853, -22510, -23826, -25386, -27864, -32767, -29670, -11862 
-    };
-
-    // AKWF_bsaw_0005 → 600 samples
-    static const int16_t akwf_akwf_bwsawbright_akwf_bsaw_0005[600] PROGMEM = {
-        11294, 28690, 32767, 29265, 27722, 26841, 26038, 25732, 25445, 25278, 25040, 24843, 
-        24545, 24219, 23819, 23378, 22916, 22425, 21874, 21272, 20655, 20015, 19363, 18703, 
-        18037, 17373, 16711, 16060, 15422, 14796, 14193, 13607, 13048, 12515, 12008, 11531, 
-        11084, 10668, 10284, 9932, 9614, 9326, 9071, 8847, 8654, 8491, 8356, 8250, 
-        8169, 8113, 8081, 8071, 8081, 8111, 8157, 8220, 8296, 8385, 8483, 8592, 
-        8707, 8829, 8954, 9083, 9213, 9346, 9477, 9606, 9735, 9855, 9976, 10087, 
-        10193, 10296, 10388, 10475, 10553, 10624, 10686, 10738, 10783, 10819, 10847, 10865, 
-        10875, 10879, 10873, 10861, 10841, 10815, 10781, 10742, 10696, 10644, 10588, 10527, 
-        10463, 10394, 10324, 10250, 10171, 10093, 10012, 9930, 9845, 9763, 9678, 9594, 
-        9509, 9427, 9344, 9262, 9181, 9103, 9026, 8950, 8876, 8803, 8733, 8664, 
-        8598, 8534, 8471, 8411, 8352, 8296, 8242, 8189, 8139, 8091, 8041, 7994, 
-        7950, 7906, 7866, 7825, 7785, 7747, 7709, 7670, 7634, 7596, 7562, 7526, 
-        7489, 7453, 7419, 7383, 7349, 7312, 7274, 7240, 7204, 7165, 7129, 7091, 
-        7051, 7013, 6974, 6934, 6894, 6852, 6811, 6767, 6723, 6681, 6634, 6590, 
-        6546, 6500, 6451, 6405, 6359, 6310, 6262, 6216, 6164, 6115, 6065, 6015, 
-        5964, 5914, 5864, 5814, 5761, 5711, 5661, 5610, 5558, 5508, 5455, 5405, 
-        5353, 5303, 5250, 5200, 5150, 5097, 5047, 4997, 4946, 4896, 4846, 4796, 
-        4745, 4695, 4647, 4596, 4546, 4498, 4448, 4397, 4349, 4299, 4248, 4202, 
-        4152, 4104, 4053, 4005, 3957, 3906, 3858, 3810, 3760, 3711, 3663, 3613, 
-        3564, 3518, 3468, 3420, 3369, 3323, 3271, 3222, 3172, 3124, 3076, 3025, 
-        2977, 2929, 2878, 2828, 2780, 2729, 2679, 2629, 2581, 2530, 2482, 2432, 
-        2381, 2331, 2281, 2231, 2182, 2132, 2082, 2031, 1981, 1929, 1881, 1830, 
-        1780, 1730, 1679, 1629, 1579, 1530, 1478, 1430, 1378, 1327, 1277, 1227, 
-        1178, 1128, 1078, 1028, 977, 927, 877, 826, 776, 726, 677, 627, 
-        577, 527, 476, 426, 376, 325, 275, 225, 175, 124, 74, 26, 
-        -26, -74, -124, -175, -225, -275, -325, -376, -426, -476, -527, -577, 
-        -627, -677, -726, -776, -826, -877, -927, -977, -1028, -1078, -1128, -1178, 
-        -1227, -1277, -1327, -1378, -1430, -1478, -1530, -1579, -1629, -1679, -1730, -1780, 
-        -1830, -1881, -1929, -1981, -2031, -2082, -2132, -2182, -2231, -2281, -2331, -2381, 
-        -2432, -2482, -2530, -2581, -2629, -2679, -2729, -2780, -2828, -2878, -2929, -2977, 
-        -3025, -3076, -3124, -3172, -3222, -3271, -3323, -3369, -3420, -3468, -3518, -3564, 
-        -3613, -3663, -3711, -3760, -3810, -3858, -3906, -3957, -4005, -4053, -4104, -4152, 
-        -4202, -4248, -4299, -4349, -4397, -4448, -4498, -4546, -4596, -4647, -4695, -4745, 
-        -4796, -4846, -4896, -4946, -4997, -5047, -5097, -5150, -5200, -5250, -5303, -5353, 
-        -5405, -5455, -5508, -5558, -5610, -5661, -5711, -5761, -5814, -5864, -5914, -5964, 
-        -6015, -6065, -6115, -6164, -6216, -6262, -6310, -6359, -6405, -6451, -6500, -6546, 
-        -6590, -6634, -6681, -6723, -6767, -6811, -6852, -6894, -6934, -6974, -7013, -7051, 
-        -7091, -7129, -7165, -7204, -7240, -7274, -7312, -7349, -7383, -7419, -7453, -7489, 
-        -7526, -7562, -7596, -7634, -7670, -7709, -7747, -7785, -7825, -7866, -7906, -7950, 
-        -7994, -8041, -8091, -8139, -8189, -8242, -8296, -8352, -8411, -8471, -8534, -8598, 
-        -8664, -8733, -8803, -8876, -8950, -9026, -9103, -9181, -9262, -9344, -9427, -9509, 
-        -9594, -9678, -9763, -9845, -9930, -10012, -10093, -10171, -10250, -10324, -10394, -10463, 
-        -10527, -10588, -10644, -10696, -10742, -10781, -10815, -10841, -10861, -10873, -10879, -10875, 
-        -10865, -10847, -10819, -10783, -10738, -10686, -10624, -10553, -10475, -10388, -10296, -10193, 
-        -10087, -9976, -9855, -9735, -9606, -9477, -9346, -9213, -9083, -8954, -8829, -8707, 
-        -8592, -8483, -8385, -8296, -8220, -8157, -8111, -8081, -8071, -8081, -8113, -8169, 
-        -8250, -8356, -8491, -8654, -8847, -9071, -9326, -9614, -9932, -10284, -10668, -11084, 
-        -11531, -12008, -12515, -13048, -13607, -14193, -14796, -15422, -16060, -16711, -17373, -18037, 
-        -18703, -19363, -20015, -20655, -21272, -21874, -22425, -22916, -23378, -23819, -24219, -24545, 
-        -24843, -25040, -25278, -25445, -25732, -26038, -26841, -27722, -29265, -32767, -28690, -11294 
-    };
-
-    // AKWF_bsaw_0006 → 600 samples
-    static const int16_t akwf_akwf_bwsawbright_akwf_bsaw_0006[600] PROGMEM = {
-        12071, 29632, 32767, 29837, 29768, 29657, 29330, 29373, 29260, 29230, 29072, 28939, 
-        28681, 28395, 28018, 27595, 27145, 26659, 26102, 25491, 24864, 24206, 23529, 22839, 
-        22140, 21437, 20736, 20038, 19351, 18678, 18022, 17383, 16768, 16178, 15616, 15080, 
-        14576, 14104, 13663, 13255, 12881, 12539, 12230, 11956, 11710, 11499, 11317, 11165, 
-        11039, 10941, 10870, 10823, 10796, 10791, 10804, 10836, 10883, 10947, 11018, 11103, 
-        11198, 11298, 11409, 11520, 11636, 11753, 11873, 11990, 12108, 12223, 12334, 12441, 
-        12542, 12640, 12730, 12815, 12890, 12960, 13020, 13074, 13119, 13155, 13185, 13204, 
-        13215, 13221, 13217, 13206, 13187, 13163, 13131, 13091, 13046, 12995, 12939, 12879, 
-        12813, 12745, 12672, 12595, 12518, 12435, 12353, 12266, 12178, 12089, 12001, 11911, 
-        11821, 11732, 11640, 11550, 11462, 11375, 11289, 11204, 11118, 11037, 10956, 10877, 
-        10796, 10721, 10648, 10574, 10505, 10435, 10370, 10302, 10238, 10176, 10114, 10054, 
-        9997, 9937, 9885, 9828, 9774, 9723, 9670, 9620, 9569, 9520, 9467, 9418, 
-        9370, 9321, 9272, 9225, 9174, 9129, 9078, 9029, 8980, 8932, 8881, 8832, 
-        8779, 8729, 8678, 8625, 8574, 8522, 8467, 8413, 8358, 8304, 8249, 8193, 
-        8137, 8078, 8022, 7964, 7905, 7847, 7789, 7729, 7668, 7608, 7548, 7486, 
-        7426, 7364, 7304, 7240, 7180, 7116, 7054, 6994, 6930, 6868, 6806, 6742, 
-        6680, 6618, 6554, 6494, 6430, 6368, 6304, 6242, 6178, 6118, 6054, 5994, 
-        5930, 5868, 5806, 5744, 5680, 5622, 5558, 5497, 5435, 5373, 5311, 5249, 
-        5189, 5127, 5065, 5005, 4945, 4881, 4819, 4759, 4699, 4637, 4576, 4513, 
-        4454, 4390, 4328, 4268, 4206, 4146, 4084, 4022, 3960, 3900, 3838, 3776, 
-        3714, 3654, 3590, 3529, 3467, 3404, 3343, 3279, 3219, 3157, 3095, 3033, 
-        2971, 2909, 2845, 2783, 2723, 2659, 2597, 2533, 2473, 2407, 2347, 2285, 
-        2221, 2159, 2097, 2033, 1971, 1909, 1847, 1783, 1721, 1659, 1595, 1533, 
-        1469, 1407, 1345, 1283, 1219, 1157, 1095, 1031, 969, 905, 845, 783, 
-        719, 657, 595, 533, 469, 407, 345, 281, 218, 156, 93, 30, 
-        -30, -93, -156, -218, -281, -345, -407, -469, -533, -595, -657, -719, 
-        -783, -845, -905, -969, -1031, -1095, -1157, -1219, -1283, -1345, -1407, -1469, 
-        -1533, -1595, -1659, -1721, -1783, -1847, -1909, -1971, -2033, -2097, -2159, -2221, 
-        -2285, -2347, -2407, -2473, -2533, -2597, -2659, -2723, -2783, -2845, -2909, -2971, 
-        -3033, -3095, -3157, -3219, -3279, -3343, -3404, -3467, -3529, -3590, -3654, -3714, 
-        -3776, -3838, -3900, -3960, -4022, -4084, -4146, -4206, -4268, -4328, -4390, -4454, 
-        -4513, -4576, -4637, -4699, -4759, -4819, -4881, -4945, -5005, -5065, -5127, -5189, 
-        -5249, -5311, -5373, -5435, -5497, -5558, -5622, -5680, -5744, -5806, -5868, -5930, 
-        -5994, -6054, -6118, -6178, -6242, -6304, -6368, -6430, -6494, -6554, -6618, -6680, 
-        -6742, -6806, -6868, -6930, -6994, -7054, -7116, -7180, -7240, -7304, -7364, -7426, 
-        -7486, -7548, -7608, -7668, -7729, -7789, -7847, -7905, -7964, -8022, -8078, -8137, 
-        -8193, -8249, -8304, -8358, -8413, -8467, -8522, -8574, -8625, -8678, -8729, -8779, 
-        -8832, -8881, -8932, -8980, -9029, -9078, -9129, -9174, -9225, -9272, -9321, -9370, 
-        -9418, -9467, -9520, -9569, -9620, -9670, -9723, -9774, -9828, -9885, -9937, -9997, 
-        -10054, -10114, -10176, -10238, -10302, -10370, -10435, -10505, -10574, -10648, -10721, -10796, 
-        -10877, -10956, -11037, -11118, -11204, -11289, -11375, -11462, -11550, -11640, -11732, -11821, 
-        -11911, -12001, -12089, -12178, -12266, -12353, -12435, -12518, -12595, -12672, -12745, -12813, 
-        -12879, -12939, -12995, -13046, -13091, -13131, -13163, -13187, -13206, -13217, -13221, -13215, 
-        -13204, -13185, -13155, -13119, -13074, -13020, -12960, -12890, -12815, -12730, -12640, -12542, 
-        -12441, -12334, -12223, -12108, -11990, -11873, -11753, -11636, -11520, -11409, -11298, -11198, 
-        -11103, -11018, -10947, -10883, -10836, -10804, -10791, -10796, -10823, -10870, -10941, -11039, 
-        -11165, -11317, -11499, -11710, -11956, -12230, -12539, -12881, -13255, -13663, -14104, -14576, 
-        -15080, -15616, -16178, -16768, -17383, -18022, -18678, -19351, -20038, -20736, -21437, -22140, 
-        -22839, -23529, -24206, -24864, -25491, -26102, -26659, -27145, -27595, -28018, -28395, -28681, 
-        -28939, -29072, -29230, -29260, -29373, -29330, -29657, -29768, -29837, -32767, -29632, -12071 
-    };
-
-    // AKWF_bsaw_0007 → 600 samples
-    static const int16_t akwf_akwf_bwsawbright_akwf_bsaw_0007[600] PROGMEM = {
-        10860, 27712, 32767, 31543, 31381, 30390, 28739, 27249, 25756, 24623, 23755, 23279, 
-        23004, 22920, 22872, 22798, 22651, 22371, 21921, 21320, 20622, 19855, 19061, 18275, 
-        17525, 16825, 16181, 15591, 15046, 14538, 14053, 13585, 13130, 12683, 12250, 11830, 
-        11429, 11052, 10703, 10386, 10103, 9853, 9638, 9452, 9297, 9171, 9069, 8988, 
-        8928, 8888, 8866, 8864, 8874, 8900, 8942, 8998, 9064, 9139, 9225, 9317, 
-        9414, 9520, 9626, 9732, 9839, 9947, 10055, 10158, 10258, 10356, 10448, 10537, 
-        10621, 10699, 10767, 10832, 10890, 10938, 10984, 11018, 11046, 11068, 11082, 11088, 
-        11090, 11082, 11068, 11050, 11024, 10994, 10956, 10914, 10868, 10818, 10763, 10705, 
-        10643, 10579, 10511, 10442, 10372, 10300, 10224, 10148, 10073, 9995, 9919, 9841, 
-        9765, 9692, 9616, 9540, 9466, 9393, 9323, 9253, 9185, 9115, 9050, 8986, 
-        8922, 8862, 8802, 8744, 8687, 8633, 8579, 8527, 8475, 8425, 8375, 8330, 
-        8284, 8238, 8194, 8150, 8106, 8064, 8022, 7983, 7941, 7901, 7861, 7821, 
-        7781, 7741, 7701, 7662, 7622, 7582, 7542, 7502, 7460, 7420, 7378, 7336, 
-        7295, 7251, 7209, 7165, 7123, 7077, 7031, 6987, 6942, 6894, 6848, 6800, 
-        6754, 6706, 6656, 6609, 6559, 6511, 6461, 6411, 6361, 6311, 6260, 6210, 
-        6158, 6106, 6054, 6004, 5952, 5901, 5849, 5797, 5745, 5693, 5641, 5587, 
-        5540, 5486, 5434, 5380, 5328, 5278, 5227, 5173, 5121, 5071, 5019, 4967, 
-        4915, 4864, 4814, 4762, 4710, 4658, 4608, 4556, 4507, 4455, 4403, 4353, 
-        4301, 4251, 4201, 4150, 4100, 4046, 3996, 3946, 3896, 3844, 3795, 3743, 
-        3693, 3641, 3589, 3539, 3487, 3438, 3386, 3336, 3286, 3234, 3184, 3133, 
-        3079, 3029, 2977, 2927, 2875, 2825, 2774, 2720, 2668, 2618, 2566, 2514, 
-        2462, 2411, 2359, 2309, 2255, 2205, 2153, 2101, 2050, 1996, 1946, 1892, 
-        1842, 1788, 1739, 1687, 1635, 1583, 1529, 1479, 1427, 1374, 1324, 1270, 
-        1218, 1166, 1114, 1062, 1011, 961, 907, 855, 805, 751, 699, 648, 
-        596, 546, 494, 442, 390, 337, 287, 231, 181, 129, 77, 25, 
-        -25, -77, -129, -181, -231, -287, -337, -390, -442, -494, -546, -596, 
-        -648, -699, -751, -805, -855, -907, -961, -1011, -1062, -1114, -1166, -1218, 
-        -1270, -1324, -1374, -1427, -1479, -1529, -1583, -1635, -1687, -1739, -1788, -1842, 
-        -1892, -1946, -1996, -2050, -2101, -2153, -2205, -2255, -2309, -2359, -2411, -2462, 
-        -2514, -2566, -2618, -2668, -2720, -2774, -2825, -2875, -2927, -2977, -3029, -3079, 
-        -3133, -3184, -3234, -3286, -3336, -3386, -3438, -3487, -3539, -3589, -3641, -3693, 
-        -3743, -3795, -3844, -3896, -3946, -3996, -4046, -4100, -4150, -4201, -4251, -4301, 
-        -4353, -4403, -4455, -4507, -4556, -4608, -4658, -4710, -4762, -4814, -4864, -4915, 
-        -4967, -5019, -5071, -5121, -5173, -5227, -5278, -5328, -5380, -5434, -5486, -5540, 
-        -5587, -5641, -5693, -5745, -5797, -5849, -5901, -5952, -6004, -6054, -6106, -6158, 
-        -6210, -6260, -6311, -6361, -6411, -6461, -6511, -6559, -6609, -6656, -6706, -6754, 
-        -6800, -6848, -6894, -6942, -6987, -7031, -7077, -7123, -7165, -7209, -7251, -7295, 
-        -7336, -7378, -7420, -7460, -7502, -7542, -7582, -7622, -7662, -7701, -7741, -7781, 
-        -7821, -7861, -7901, -7941, -7983, -8022, -8064, -8106, -8150, -8194, -8238, -8284, 
-        -8330, -8375, -8425, -8475, -8527, -8579, -8633, -8687, -8744, -8802, -8862, -8922, 
-        -8986, -9050, -9115, -9185, -9253, -9323, -9393, -9466, -9540, -9616, -9692, -9765, 
-        -9841, -9919, -9995, -10073, -10148, -10224, -10300, -10372, -10442, -10511, -10579, -10643, 
-        -10705, -10763, -10818, -10868, -10914, -10956, -10994, -11024, -11050, -11068, -11082, -11090, 
-        -11088, -11082, -11068, -11046, -11018, -10984, -10938, -10890, -10832, -10767, -10699, -10621, 
-        -10537, -10448, -10356, -10258, -10158, -10055, -9947, -9839, -9732, -9626, -9520, -9414, 
-        -9317, -9225, -9139, -9064, -8998, -8942, -8900, -8874, -8864, -8866, -8888, -8928, 
-        -8988, -9069, -9171, -9297, -9452, -9638, -9853, -10103, -10386, -10703, -11052, -11429, 
-        -11830, -12250, -12683, -13130, -13585, -14053, -14538, -15046, -15591, -16181, -16825, -17525, 
-        -18275, -19061, -19855, -20622, -21320, -21921, -22371, -22651, -22798, -22872, -22920, -23004, 
-        -23279, -23755, -24623, -25756, -27249, -28739, -30390, -31381, -31543, -32767, -27712, -10860 
-    };
-
-    // AKWF_bsaw_0008 → 600 samples
-    static const int16_t akwf_akwf_bwsawbright_akwf_bsaw_0008[600] PROGMEM = {
-        8656, 25172, 32767, 28939, 23653, 20993, 20046, 20262, 20740, 20952, 20667, 19987, 
-        19017, 17951, 16931, 16057, 15385, 14918, 14599, 14383, 14250, 14171, 14117, 14064, 
-        14001, 13924, 13828, 13723, 13609, 13493, 13380, 13270, 13168, 13078, 12991, 12913, 
-        12841, 12774, 12711, 12652, 12597, 12545, 12494, 12448, 12403, 12360, 12321, 12286, 
-        12249, 12219, 12190, 12164, 12137, 12113, 12090, 12066, 12047, 12027, 12005, 11988, 
-        11968, 11949, 11931, 11909, 11890, 11872, 11851, 11829, 11806, 11784, 11760, 11737, 
-        11711, 11688, 11659, 11633, 11606, 11576, 11545, 11513, 11484, 11451, 11417, 11382, 
-        11347, 11312, 11274, 11237, 11200, 11163, 11123, 11082, 11043, 11000, 10959, 10916, 
-        10874, 10829, 10788, 10743, 10698, 10655, 10610, 10565, 10520, 10473, 10426, 10379, 
-        10333, 10286, 10239, 10192, 10145, 10096, 10049, 10002, 9953, 9906, 9857, 9808, 
-        9759, 9712, 9663, 9614, 9567, 9516, 9467, 9418, 9369, 9320, 9271, 9222, 
-        9171, 9120, 9073, 9022, 8971, 8922, 8871, 8822, 8771, 8720, 8671, 8620, 
-        8569, 8516, 8467, 8416, 8364, 8315, 8264, 8211, 8160, 8109, 8056, 8005, 
-        7954, 7901, 7850, 7797, 7746, 7693, 7642, 7589, 7536, 7483, 7430, 7378, 
-        7325, 7272, 7219, 7166, 7113, 7060, 7007, 6952, 6899, 6844, 6791, 6739, 
-        6686, 6631, 6576, 6523, 6468, 6415, 6360, 6305, 6252, 6198, 6143, 6088, 
-        6033, 5980, 5925, 5870, 5815, 5762, 5706, 5649, 5596, 5541, 5486, 5431, 
-        5376, 5321, 5266, 5210, 5157, 5100, 5045, 4988, 4933, 4878, 4823, 4769, 
-        4712, 4657, 4600, 4545, 4490, 4433, 4377, 4322, 4267, 4210, 4153, 4096, 
-        4041, 3986, 3932, 3873, 3818, 3763, 3706, 3649, 3594, 3538, 3483, 3426, 
-        3369, 3314, 3257, 3200, 3144, 3089, 3032, 2975, 2918, 2863, 2804, 2750, 
-        2693, 2636, 2579, 2522, 2467, 2410, 2354, 2297, 2240, 2185, 2126, 2069, 
-        2015, 1958, 1901, 1844, 1787, 1730, 1673, 1617, 1562, 1505, 1446, 1389, 
-        1334, 1278, 1221, 1164, 1107, 1050, 993, 936, 880, 823, 766, 709, 
-        654, 597, 539, 482, 425, 370, 311, 254, 197, 141, 84, 27, 
-        -27, -84, -141, -197, -254, -311, -370, -425, -482, -539, -597, -654, 
-        -709, -766, -823, -880, -936, -993, -1050, -1107, -1164, -1221, -1278, -1334, 
-        -1389, -1446, -1505, -1562, -1617, -1673, -1730, -1787, -1844, -1901, -1958, -2015, 
-        -2069, -2126, -2185, -2240, -2297, -2354, -2410, -2467, -2522, -2579, -2636, -2693, 
-        -2750, -2804, -2863, -2918, -2975, -3032, -3089, -3144, -3200, -3257, -3314, -3369, 
-        -3426, -3483, -3538, -3594, -3649, -3706, -3763, -3818, -3873, -3932, -3986, -4041, 
-        -4096, -4153, -4210, -4267, -4322, -4377, -4433, -4490, -4545, -4600, -4657, -4712, 
-        -4769, -4823, -4878, -4933, -4988, -5045, -5100, -5157, -5210, -5266, -5321, -5376, 
-        -5431, -5486, -5541, -5596, -5649, -5706, -5762, -5815, -5870, -5925, -5980, -6033, 
-        -6088, -6143, -6198, -6252, -6305, -6360, -6415, -6468, -6523, -6576, -6631, -6686, 
-        -6739, -6791, -6844, -6899, -6952, -7007, -7060, -7113, -7166, -7219, -7272, -7325, 
-        -7378, -7430, -7483, -7536, -7589, -7642, -7693, -7746, -7797, -7850, -7901, -7954, 
-        -8005, -8056, -8109, -8160, -8211, -8264, -8315, -8364, -8416, -8467, -8516, -8569, 
-        -8620, -8671, -8720, -8771, -8822, -8871, -8922, -8971, -9022, -9073, -9120, -9171, 
-        -9222, -9271, -9320, -9369, -9418, -9467, -9516, -9567, -9614, -9663, -9712, -9759, 
-        -9808, -9857, -9906, -9953, -10002, -10049, -10096, -10145, -10192, -10239, -10286, -10333, 
-        -10379, -10426, -10473, -10520, -10565, -10610, -10655, -10698, -10743, -10788, -10829, -10874, 
-        -10916, -10959, -11000, -11043, -11082, -11123, -11163, -11200, -11237, -11274, -11312, -11347, 
-        -11382, -11417, -11451, -11484, -11513, -11545, -11576, -11606, -11633, -11659, -11688, -11711, 
-        -11737, -11760, -11784, -11806, -11829, -11851, -11872, -11890, -11909, -11931, -11949, -11968, 
-        -11988, -12005, -12027, -12047, -12066, -12090, -12113, -12137, -12164, -12190, -12219, -12249, 
-        -12286, -12321, -12360, -12403, -12448, -12494, -12545, -12597, -12652, -12711, -12774, -12841, 
-        -12913, -12991, -13078, -13168, -13270, -13380, -13493, -13609, -13723, -13828, -13924, -14001, 
-        -14064, -14117, -14171, -14250, -14383, -14599, -14918, -15385, -16057, -16931, -17951, -19017, 
-        -19987, -20667, -20952, -20740, -20262, -20046, -20993, -23653, -28939, -32767, -25172, -8656 
-    };
-
-    // AKWF_bsaw_0009 → 600 samples
-    static const int16_t akwf_akwf_bwsawbright_akwf_bsaw_0009[600] PROGMEM = {
-        7887, 23700, 32767, 31593, 27880, 25432, 23968, 23324, 22898, 22273, 21237, 19851, 
-        18197, 16460, 14796, 13315, 12108, 11193, 10546, 10119, 9883, 9808, 9834, 9931, 
-        10062, 10205, 10343, 10470, 10574, 10662, 10728, 10775, 10808, 10826, 10833, 10826, 
-        10810, 10785, 10755, 10718, 10679, 10636, 10591, 10546, 10503, 10462, 10423, 10386, 
-        10353, 10324, 10300, 10277, 10257, 10238, 10222, 10209, 10195, 10185, 10175, 10162, 
-        10152, 10142, 10129, 10117, 10105, 10090, 10072, 10058, 10039, 10021, 10000, 9980, 
-        9959, 9935, 9912, 9885, 9861, 9832, 9806, 9775, 9748, 9717, 9687, 9654, 
-        9621, 9590, 9555, 9523, 9488, 9453, 9418, 9381, 9344, 9309, 9272, 9234, 
-        9195, 9158, 9119, 9082, 9043, 9004, 8965, 8926, 8885, 8846, 8805, 8766, 
-        8727, 8686, 8645, 8604, 8563, 8522, 8481, 8442, 8401, 8360, 8317, 8278, 
-        8237, 8194, 8153, 8112, 8071, 8030, 7989, 7946, 7905, 7862, 7821, 7778, 
-        7737, 7696, 7653, 7610, 7569, 7526, 7485, 7442, 7399, 7358, 7312, 7269, 
-        7228, 7185, 7142, 7099, 7056, 7011, 6968, 6925, 6882, 6837, 6794, 6751, 
-        6708, 6663, 6620, 6574, 6531, 6486, 6443, 6398, 6353, 6310, 6263, 6220, 
-        6175, 6130, 6086, 6039, 5994, 5951, 5904, 5861, 5816, 5771, 5724, 5678, 
-        5633, 5586, 5543, 5496, 5451, 5406, 5361, 5314, 5268, 5221, 5176, 5131, 
-        5084, 5039, 4992, 4945, 4901, 4854, 4807, 4760, 4715, 4668, 4623, 4576, 
-        4528, 4483, 4436, 4389, 4342, 4297, 4250, 4202, 4155, 4110, 4063, 4016, 
-        3969, 3921, 3876, 3827, 3780, 3735, 3686, 3641, 3593, 3544, 3499, 3452, 
-        3405, 3358, 3311, 3263, 3216, 3169, 3122, 3075, 3026, 2978, 2933, 2884, 
-        2837, 2790, 2743, 2695, 2646, 2601, 2554, 2505, 2458, 2411, 2363, 2316, 
-        2267, 2220, 2171, 2126, 2076, 2029, 1982, 1935, 1886, 1839, 1791, 1744, 
-        1695, 1648, 1601, 1551, 1506, 1457, 1410, 1361, 1314, 1267, 1219, 1170, 
-        1121, 1076, 1027, 979, 930, 883, 836, 789, 742, 692, 645, 596, 
-        549, 502, 453, 405, 358, 311, 264, 215, 168, 118, 71, 22, 
-        -22, -71, -118, -168, -215, -264, -311, -358, -405, -453, -502, -549, 
-        -596, -645, -692, -742, -789, -836, -883, -930, -979, -1027, -1076, -1121, 
-        -1170, -1219, -1267, -1314, -1361, -1410, -1457, -1506, -1551, -1601, -1648, -1695, 
-        -1744, -1791, -1839, -1886, -1935, -1982, -2029, -2076, -2126, -2171, -2220, -2267, 
-        -2316, -2363, -2411, -2458, -2505, -2554, -2601, -2646, -2695, -2743, -2790, -2837, 
-        -2884, -2933, -2978, -3026, -3075, -3122, -3169, -3216, -3263, -3311, -3358, -3405, 
-        -3452, -3499, -3544, -3593, -3641, -3686, -3735, -3780, -3827, -3876, -3921, -3969, 
-        -4016, -4063, -4110, -4155, -4202, -4250, -4297, -4342, -4389, -4436, -4483, -4528, 
-        -4576, -4623, -4668, -4715, -4760, -4807, -4854, -4901, -4945, -4992, -5039, -5084, 
-        -5131, -5176, -5221, -5268, -5314, -5361, -5406, -5451, -5496, -5543, -5586, -5633, 
-        -5678, -5724, -5771, -5816, -5861, -5904, -5951, -5994, -6039, -6086, -6130, -6175, 
-        -6220, -6263, -6310, -6353, -6398, -6443, -6486, -6531, -6574, -6620, -6663, -6708, 
-        -6751, -6794, -6837, -6882, -6925, -6968, -7011, -7056, -7099, -7142, -7185, -7228, 
-        -7269, -7312, -7358, -7399, -7442, -7485, -7526, -7569, -7610, -7653, -7696, -7737, 
-        -7778, -7821, -7862, -7905, -7946, -7989, -8030, -8071, -8112, -8153, -8194, -8237, 
-        -8278, -8317, -8360, -8401, -8442, -8481, -8522, -8563, -8604, -8645, -8686, -8727, 
-        -8766, -8805, -8846, -8885, -8926, -8965, -9004, -9043, -9082, -9119, -9158, -9195, 
-        -9234, -9272, -9309, -9344, -9381, -9418, -9453, -9488, -9523, -9555, -9590, -9621, 
-        -9654, -9687, -9717, -9748, -9775, -9806, -9832, -9861, -9885, -9912, -9935, -9959, 
-        -9980, -10000, -10021, -10039, -10058, -10072, -10090, -10105, -10117, -10129, -10142, -10152, 
-        -10162, -10175, -10185, -10195, -10209, -10222, -10238, -10257, -10277, -10300, -10324, -10353, 
-        -10386, -10423, -10462, -10503, -10546, -10591, -10636, -10679, -10718, -10755, -10785, -10810, 
-        -10826, -10833, -10826, -10808, -10775, -10728, -10662, -10574, -10470, -10343, -10205, -10062, 
-        -9931, -9834, -9808, -9883, -10119, -10546, -11193, -12108, -13315, -14796, -16460, -18197, 
-        -19851, -21237, -22273, -22898, -23324, -23968, -25432, -27880, -31593, -32767, -23700, -7887 
-    };
-
-    // AKWF_bsaw_0010 → 600 samples
-    static const int16_t akwf_akwf_bwsawbright_akwf_bsaw_0010[600] PROGMEM = {
-        15198, 31600, 31979, 32067, 32767, 32533, 32273, 31852, 31309, 30666, 30011, 29291, 
-        28584, 27852, 27114, 26412, 25753, 25103, 24454, 23835, 23241, 22672, 22129, 21614, 
-        21125, 20663, 20223, 19808, 19418, 19048, 18701, 18376, 18069, 17786, 17519, 17270, 
-        17039, 16826, 16629, 16445, 16275, 16122, 15979, 15847, 15728, 15620, 15523, 15434, 
-        15349, 15277, 15212, 15152, 15100, 15050, 15006, 14967, 14930, 14900, 14869, 14840, 
-        14817, 14791, 14768, 14746, 14723, 14701, 14680, 14658, 14636, 14611, 14588, 14560, 
-        14537, 14510, 14483, 14450, 14420, 14387, 14353, 14317, 14281, 14243, 14203, 14162, 
-        14116, 14073, 14028, 13983, 13934, 13884, 13835, 13782, 13732, 13676, 13624, 13570, 
-        13512, 13454, 13398, 13340, 13283, 13223, 13163, 13104, 13042, 12981, 12920, 12858, 
-        12797, 12734, 12672, 12609, 12548, 12485, 12422, 12358, 12295, 12234, 12171, 12107, 
-        12042, 11979, 11916, 11853, 11792, 11728, 11663, 11600, 11537, 11474, 11411, 11348, 
-        11284, 11221, 11158, 11095, 11030, 10968, 10904, 10842, 10777, 10716, 10651, 10588, 
-        10524, 10459, 10395, 10333, 10268, 10203, 10140, 10077, 10012, 9947, 9884, 9819, 
-        9754, 9689, 9626, 9561, 9496, 9431, 9367, 9302, 9238, 9171, 9106, 9039, 
-        8976, 8909, 8844, 8777, 8712, 8645, 8580, 8514, 8449, 8384, 8315, 8248, 
-        8183, 8117, 8050, 7983, 7914, 7849, 7783, 7716, 7647, 7582, 7514, 7447, 
-        7382, 7313, 7247, 7180, 7113, 7043, 6976, 6907, 6842, 6774, 6705, 6638, 
-        6572, 6503, 6436, 6368, 6299, 6230, 6164, 6095, 6028, 5960, 5893, 5822, 
-        5756, 5689, 5618, 5550, 5483, 5415, 5344, 5277, 5207, 5142, 5073, 5005, 
-        4934, 4866, 4799, 4730, 4662, 4593, 4523, 4454, 4386, 4317, 4250, 4180, 
-        4111, 4045, 3974, 3906, 3837, 3767, 3698, 3631, 3561, 3492, 3424, 3355, 
-        3285, 3216, 3147, 3079, 3008, 2940, 2871, 2803, 2732, 2664, 2595, 2525, 
-        2458, 2388, 2317, 2249, 2180, 2111, 2041, 1972, 1904, 1833, 1765, 1694, 
-        1628, 1557, 1489, 1418, 1350, 1281, 1212, 1140, 1072, 1005, 936, 866, 
-        796, 727, 658, 588, 519, 451, 382, 310, 241, 173, 104, 34, 
-        -34, -104, -173, -241, -310, -382, -451, -519, -588, -658, -727, -796, 
-        -866, -936, -1005, -1072, -1140, -1212, -1281, -1350, -1418, -1489, -1557, -1628, 
-        -1694, -1765, -1833, -1904, -1972, -2041, -2111, -2180, -2249, -2317, -2388, -2458, 
-        -2525, -2595, -2664, -2732, -2803, -2871, -2940, -3008, -3079, -3147, -3216, -3285, 
-        -3355, -3424, -3492, -3561, -3631, -3698, -3767, -3837, -3906, -3974, -4045, -4111, 
-        -4180, -4250, -4317, -4386, -4454, -4523, -4593, -4662, -4730, -4799, -4866, -4934, 
-        -5005, -5073, -5142, -5207, -5277, -5344, -5415, -5483, -5550, -5618, -5689, -5756, 
-        -5822, -5893, -5960, -6028, -6095, -6164, -6230, -6299, -6368, -6436, -6503, -6572, 
-        -6638, -6705, -6774, -6842, -6907, -6976, -7043, -7113, -7180, -7247, -7313, -7382, 
-        -7447, -7514, -7582, -7647, -7716, -7783, -7849, -7914, -7983, -8050, -8117, -8183, 
-        -8248, -8315, -8384, -8449, -8514, -8580, -8645, -8712, -8777, -8844, -8909, -8976, 
-        -9039, -9106, -9171, -9238, -9302, -9367, -9431, -9496, -9561, -9626, -9689, -9754, 
-        -9819, -9884, -9947, -10012, -10077, -10140, -10203, -10268, -10333, -10395, -10459, -10524, 
-        -10588, -10651, -10716, -10777, -10842, -10904, -10968, -11030, -11095, -11158, -11221, -11284, 
-        -11348, -11411, -11474, -11537, -11600, -11663, -11728, -11792, -11853, -11916, -11979, -12042, 
-        -12107, -12171, -12234, -12295, -12358, -12422, -12485, -12548, -12609, -12672, -12734, -12797, 
-        -12858, -12920, -12981, -13042, -13104, -13163, -13223, -13283, -13340, -13398, -13454, -13512, 
-        -13570, -13624, -13676, -13732, -13782, -13835, -13884, -13934, -13983, -14028, -14073, -14116, 
-        -14162, -14203, -14243, -14281, -14317, -14353, -14387, -14420, -14450, -14483, -14510, -14537, 
-        -14560, -14588, -14611, -14636, -14658, -14680, -14701, -14723, -14746, -14768, -14791, -14817, 
-        -14840, -14869, -14900, -14930, -14967, -15006, -15050, -15100, -15152, -15212, -15277, -15349, 
-        -15434, -15523, -15620, -15728, -15847, -15979, -16122, -16275, -16445, -16629, -16826, -17039, 
-        -17270, -17519, -17786, -18069, -18376, -18701, -19048, -19418, -19808, -20223, -20663, -21125, 
-        -21614, -22129, -22672, -23241, -23835, -24454, -25103, -25753, -26412, -27114, -27852, -28584, 
-        -29291, -30011, -30666, -31309, -31852, -32273, -32533, -32767, -32067, -31979, -31600, -15198 
-    };
-
-} // namespace AKWF_BwSawbright
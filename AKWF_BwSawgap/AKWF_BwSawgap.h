@@ -1,61 +1,616 @@
-// Auto‑generated AKWF bank. Do not edit manually.
+// Auto‑generated AKWF bank (compressed, see AKWFCodec.h). Do not edit manually.
 
 #pragma once
 #include <Arduino.h>
 
-#include "AKWF_BwSawgap_Tables_Part0.h"
-#include "AKWF_BwSawgap_Tables_Part1.h"
-
 namespace AKWF_BwSawgap {
+
     constexpr uint16_t count = 42;
-}
 
-// Return a pointer to the n‑th waveform table in this bank.
-// If index is out of range, returns nullptr and length is set to 0.
-inline const int16_t* AKWF_BwSawgap_get(uint16_t index, uint16_t &length) {
-    switch(index) {
-        case 0: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0001;
-        case 1: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0002;
-        case 2: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0003;
-        case 3: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0004;
-        case 4: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0005;
-        case 5: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0006;
-        case 6: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0007;
-        case 7: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0008;
-        case 8: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0009;
-        case 9: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0010;
-        case 10: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0011;
-        case 11: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0012;
-        case 12: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0013;
-        case 13: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0014;
-        case 14: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0015;
-        case 15: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0016;
-        case 16: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0017;
-        case 17: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0018;
-        case 18: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0019;
-        case 19: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0020;
-        case 20: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0021;
-        case 21: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0022;
-        case 22: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0023;
-        case 23: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0024;
-        case 24: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0025;
-        case 25: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0026;
-        case 26: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0027;
-        case 27: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0028;
-        case 28: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0029;
-        case 29: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0030;
-        case 30: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0031;
-        case 31: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0032;
-        case 32: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0033;
-        case 33: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0034;
-        case 34: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0035;
-        case 35: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0036;
-        case 36: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0037;
-        case 37: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0038;
-        case 38: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0039;
-        case 39: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0040;
-        case 40: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0041;
-        case 41: length = 600; return AKWF_BwSawgap::akwf_akwf_bwsawgap_akwf_gapsaw_0042;
-        default: length = 0; return nullptr;
-    }
-}
+    // 50400 bytes as int16 → 8882 bytes
+
+    static const uint8_t data[8882] PROGMEM = {
+        0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x06, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00,
+        0x04, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x42,
+        0x5C, 0x19, 0x70, 0x2E, 0x30, 0xA1, 0xE4, 0x63, 0xBD, 0x6E, 0xF0, 0x11, 0x9D, 0xE5, 0xBB, 0xC7,
+        0x78, 0x2C, 0xEF, 0x23, 0x1D, 0xEB, 0x0D, 0xC0, 0xB8, 0xCB, 0x81, 0x71, 0x81, 0xDE, 0x3B, 0xD6,
+        0x77, 0x91, 0x81, 0xDE, 0x46, 0x77, 0x91, 0x84, 0xB8, 0x32, 0xE0, 0x5C, 0x61, 0x43, 0xC8, 0xC7,
+        0x7A, 0xDD, 0xE0, 0x23, 0x3B, 0xCB, 0x77, 0x8E, 0xF0, 0x59, 0xDE, 0x46, 0x3B, 0xD6, 0x0E, 0xF1,
+        0x19, 0xDE, 0x46, 0x03, 0xBD, 0x6E, 0xF1, 0x19, 0xC3, 0x83, 0x2E, 0x05, 0xC6, 0x5C, 0x01, 0xB8,
+        0xCB, 0x81, 0x71, 0x97, 0x00, 0x6E, 0x32, 0xE0, 0x5C, 0x65, 0xC0, 0x08, 0xCE, 0xF2, 0xDD, 0xE3,
+        0xBC, 0x81, 0x10, 0x06, 0x40, 0x04, 0x00, 0x10, 0x3F, 0xFE, 0x9F, 0xFF, 0xA8, 0x01, 0x00, 0x90,
+        0xB8, 0x32, 0xE0, 0x5C, 0x60, 0x3B, 0xC8, 0xC7, 0x7A, 0xDD, 0xE1, 0x0B, 0x8C, 0xB8, 0x17, 0x19,
+        0x70, 0x42, 0xE3, 0x2E, 0x05, 0xC6, 0x5C, 0x03, 0xBD, 0x67, 0x79, 0x18, 0x0E, 0xF5, 0xBB, 0xC4,
+        0x67, 0x78, 0x11, 0x8E, 0xF5, 0xBB, 0xC4, 0x12, 0x17, 0x06, 0x5C, 0x0B, 0x8C, 0x07, 0x79, 0x18,
+        0xEF, 0x5B, 0xBC, 0x04, 0x67, 0x79, 0x6E, 0xF0, 0x1D, 0xEB, 0x3B, 0xC8, 0xCE, 0xF0, 0x23, 0x3B,
+        0xC8, 0xCE, 0xF0, 0x59, 0x70, 0x2E, 0x32, 0xE0, 0x5C, 0x16, 0x5C, 0x0B, 0x8C, 0xB8, 0x08, 0x24,
+        0x2E, 0x0C, 0xB8, 0x17, 0x18, 0x0E, 0xF2, 0x31, 0xDE, 0xB7, 0x78, 0x08, 0xCE, 0xF2, 0xDD, 0xE0,
+        0x3B, 0xD6, 0x77, 0x91, 0x93, 0x68, 0x00, 0x20, 0x01, 0x00, 0x06, 0x00, 0x20, 0x00, 0x00, 0x00,
+        0x7F, 0x81, 0xB1, 0xFD, 0xFF, 0xD0, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x06, 0xF8, 0x00,
+        0x40, 0x04, 0x00, 0x20, 0x01, 0x80, 0x08, 0x00, 0x20, 0x02, 0x00, 0x08, 0x00, 0x80, 0x02, 0x00,
+        0x00, 0x01, 0x00, 0x08, 0x00, 0x63, 0x18, 0xC6, 0x39, 0x63, 0x18, 0x8C, 0x72, 0xC6, 0x31, 0x8E,
+        0x58, 0x86, 0xB5, 0xAF, 0x53, 0x5A, 0xD0, 0x7A, 0xB4, 0xD6, 0xBD, 0x5A, 0x0C, 0x63, 0x8B, 0x18,
+        0x91, 0xC4, 0x5C, 0x52, 0x31, 0x8C, 0x96, 0x20, 0xD6, 0xB6, 0xED, 0x69, 0xAC, 0x32, 0xC6, 0x31,
+        0x24, 0xB1, 0x88, 0xC4, 0x92, 0xC6, 0x31, 0x8E, 0x51, 0x8C, 0x63, 0x1C, 0xB1, 0x8C, 0x46, 0x39,
+        0x63, 0x18, 0xC7, 0x14, 0x19, 0x2C, 0x63, 0x1C, 0xB1, 0x8C, 0x16, 0x39, 0x63, 0x18, 0xC7, 0x14,
+        0x1A, 0xD6, 0xBD, 0x4D, 0x6B, 0x0B, 0x8B, 0x12, 0x31, 0xC5, 0x88, 0x69, 0xAF, 0x56, 0xB5, 0xA7,
+        0x82, 0xB5, 0xAD, 0x36, 0xED, 0x68, 0xC8, 0xBF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xB8, 0x89, 0x09, 0x0A, 0x08, 0x80, 0x6B, 0x5A,
+        0xDB, 0x9A, 0xD6, 0x86, 0x4B, 0x12, 0x31, 0x92, 0xC6, 0x04, 0xD6, 0xDD, 0xAD, 0x69, 0xB0, 0xD8,
+        0xC6, 0x24, 0x96, 0x31, 0x82, 0xC7, 0x2C, 0x63, 0x18, 0xE5, 0x82, 0xC6, 0x38, 0xA4, 0x96, 0x31,
+        0x18, 0xC7, 0x2C, 0x63, 0x18, 0xE5, 0x18, 0xC6, 0x31, 0xCB, 0x18, 0xC4, 0x35, 0xEA, 0x6B, 0x5A,
+        0xF5, 0x03, 0x5A, 0xD7, 0xAB, 0x4D, 0x68, 0x71, 0x63, 0x12, 0x38, 0xB1, 0x81, 0x69, 0xB7, 0x6D,
+        0xDA, 0x6B, 0x0B, 0x25, 0x8C, 0x48, 0xC9, 0x62, 0x1A, 0x6B, 0x6E, 0xD6, 0xB4, 0xC3, 0x2C, 0x63,
+        0x18, 0xE5, 0x8C, 0x46, 0x31, 0xCB, 0x18, 0xC6, 0x39, 0x43, 0x5A, 0xD6, 0xBD, 0x4D, 0x6B, 0x40,
+        0x02, 0x00, 0x04, 0x00, 0x40, 0x00, 0x40, 0x01, 0x00, 0x0B, 0xFC, 0x0E, 0x0F, 0xEF, 0xFE, 0x80,
+        0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x07, 0x38, 0x00, 0x40, 0x00, 0x00, 0x40, 0x01, 0x80,
+        0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x81,
+        0xCF, 0x73, 0x2D, 0x64, 0xF7, 0x03, 0xDC, 0x7B, 0x8D, 0x64, 0xF0, 0xD0, 0xCA, 0x65, 0x0C, 0xA1,
+        0x94, 0x1E, 0xE6, 0x5A, 0xCB, 0x20, 0x19, 0x65, 0xAC, 0x9E, 0xE0, 0x64, 0xF7, 0x1E, 0xE3, 0xDC,
+        0x0F, 0x73, 0x2D, 0x1E, 0xE3, 0xDC, 0x0C, 0xB2, 0xD6, 0x4C, 0x83, 0x27, 0xB8, 0xF7, 0x3D, 0xC7,
+        0x87, 0x66, 0x53, 0x28, 0x65, 0x0C, 0xA0, 0x65, 0x96, 0xB2, 0x65, 0x84, 0x4C, 0xA1, 0x9B, 0x8C,
+        0x60, 0x89, 0x94, 0xCA, 0x19, 0x43, 0x29, 0x81, 0xCC, 0xB5, 0x96, 0xB5, 0x83, 0xBE, 0x53, 0x29,
+        0x06, 0x30, 0x41, 0xCA, 0x65, 0x0C, 0xA1, 0x94, 0xCA, 0x60, 0x40, 0x24, 0x24, 0x1F, 0xFF, 0xFF,
+        0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+        0xFF, 0xFF, 0xFF, 0x88, 0x2D, 0x64, 0xF7, 0x3D, 0xC7, 0x83, 0x8F, 0x73, 0xDC, 0xCB, 0x58, 0x29,
+        0x94, 0xCE, 0xF0, 0x63, 0x18, 0x0B, 0x18, 0x26, 0x53, 0x28, 0x65, 0x10, 0xCA, 0x65, 0x20, 0xC6,
+        0x5E, 0x07, 0x1E, 0xE6, 0x59, 0x32, 0x0D, 0x65, 0x93, 0xDC, 0x7B, 0x82, 0x65, 0x32, 0xBC, 0xA1,
+        0x94, 0xCA, 0x07, 0xB9, 0x96, 0x4C, 0xB0, 0x59, 0x64, 0xF7, 0x1E, 0xE0, 0x35, 0x93, 0xDC, 0xF7,
+        0x1E, 0xE0, 0x3D, 0xCC, 0x9E, 0xE6, 0x5A, 0x0C, 0xB2, 0x19, 0x65, 0x82, 0xC9, 0xEE, 0x7B, 0x8F,
+        0x70, 0x1E, 0xE7, 0xB8, 0xF7, 0x32, 0xD0, 0x1E, 0xE3, 0xDC, 0xF7, 0x32, 0xD0, 0x64, 0xF7, 0x3D,
+        0xC7, 0xB8, 0xF6, 0x80, 0x06, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x00, 0x00, 0x17, 0xF8, 0x1D,
+        0x1F, 0xDF, 0xFD, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x07, 0x88, 0x00, 0x00, 0x00, 0x00,
+        0x40, 0x01, 0x80, 0x04, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0xC0, 0x02, 0x00, 0x20, 0x00, 0x00,
+        0x00, 0x00, 0x85, 0x2A, 0x2F, 0x12, 0x84, 0x5D, 0x11, 0x17, 0x42, 0x86, 0x6C, 0x0C, 0xEF, 0x10,
+        0x88, 0x81, 0x2E, 0x21, 0x13, 0x3B, 0xC4, 0x03, 0x4D, 0xDE, 0x86, 0x80, 0xDD, 0xE8, 0xD0, 0xDD,
+        0xE0, 0x8D, 0x0D, 0xDE, 0x8D, 0x09, 0x2E, 0x5C, 0x48, 0x84, 0xB8, 0x80, 0xD1, 0xBB, 0xD0, 0xD0,
+        0x1B, 0xBD, 0x1A, 0x1B, 0xBC, 0x29, 0x10, 0x97, 0x37, 0xCA, 0x44, 0x12, 0x5C, 0x40, 0x88, 0x4D,
+        0xF2, 0x88, 0x3C, 0xA1, 0x37, 0xCA, 0x33, 0x28, 0x8F, 0x3B, 0xE5, 0x79, 0x41, 0x99, 0x41, 0x66,
+        0x51, 0xE7, 0x7C, 0xAC, 0x32, 0xA3, 0x33, 0xBE, 0x6C, 0x0C, 0xD8, 0x67, 0x78, 0x98, 0x23, 0xB0,
+        0x80, 0x23, 0xB0, 0x82, 0x1F, 0xFF, 0xFF, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x60, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF9, 0xA1, 0x81, 0x2C, 0x06, 0x84, 0xDF,
+        0x29, 0x37, 0xCA, 0x3C, 0xA2, 0x0F, 0x3B, 0xE5, 0x66, 0x51, 0x99, 0xD1, 0xF3, 0x61, 0x95, 0x86,
+        0x56, 0x06, 0x14, 0xA8, 0xBC, 0x4A, 0x10, 0xCA, 0x11, 0x74, 0x28, 0x66, 0xC0, 0xCE, 0xF1, 0x08,
+        0x88, 0x12, 0xE2, 0x11, 0x33, 0xBC, 0xA1, 0xE8, 0xD3, 0x77, 0xA1, 0xA0, 0x37, 0x7A, 0x34, 0x37,
+        0x78, 0x23, 0x43, 0x77, 0xA3, 0x42, 0x4B, 0x97, 0x12, 0x21, 0x2E, 0x20, 0x34, 0x6E, 0xF4, 0x34,
+        0x06, 0xEF, 0x46, 0x86, 0xEF, 0x04, 0xD0, 0x6F, 0xBF, 0xDC, 0xD0, 0x49, 0x71, 0x02, 0x21, 0x37,
+        0xCA, 0x20, 0xF2, 0x84, 0xDF, 0x29, 0x37, 0xCA, 0x23, 0xCE, 0xF9, 0x5E, 0x50, 0x66, 0x53, 0x40,
+        0x01, 0x00, 0x08, 0x00, 0x40, 0x00, 0xC0, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0x2F, 0xEF, 0xFE, 0x80,
+        0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x07, 0xC8, 0x00, 0x00, 0x02, 0x00, 0x20, 0x00, 0x00,
+        0x04, 0x00, 0x40, 0x00, 0x00, 0x18, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x80, 0x08, 0x00, 0x01,
+        0x67, 0x6C, 0xB2, 0xD6, 0xEF, 0x02, 0xCA, 0xF2, 0xCA, 0xF2, 0x0C, 0xB5, 0x9D, 0xEB, 0x2D, 0x60,
+        0x46, 0xB2, 0xDD, 0xEB, 0x20, 0x32, 0xD6, 0x5B, 0xBD, 0x60, 0x59, 0x6E, 0xF5, 0x96, 0x5B, 0x87,
+        0x19, 0x71, 0x83, 0x06, 0x16, 0x06, 0x59, 0x65, 0x79, 0x64, 0x1A, 0xCE, 0xF5, 0x79, 0x65, 0x82,
+        0xCB, 0x8C, 0x18, 0xC2, 0xE3, 0x02, 0xCB, 0x23, 0x77, 0xAC, 0x83, 0x59, 0x1A, 0xCB, 0x2C, 0x37,
+        0x18, 0x30, 0x61, 0x64, 0xB8, 0x16, 0x59, 0x67, 0x6C, 0xB0, 0x2C, 0xED, 0x96, 0x5A, 0xDD, 0xE3,
+        0x01, 0x20, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01, 0xFF, 0xFF, 0xFF, 0xFC, 0xC0, 0x48, 0x0D, 0x04,
+        0x84, 0x80, 0x43, 0x2B, 0xCB, 0x2C, 0xAF, 0x02, 0xCB, 0x2D, 0xDE, 0xAF, 0x2C, 0x0B, 0x2D, 0xDE,
+        0xB2, 0xCB, 0x04, 0x65, 0xAC, 0xB7, 0x7A, 0x03, 0x2C, 0xB5, 0xBB, 0xCB, 0x41, 0x96, 0xEF, 0x59,
+        0x65, 0x9C, 0x1B, 0x77, 0x96, 0xB2, 0xCE, 0xD8, 0x16, 0x59, 0x5E, 0x59, 0x61, 0x19, 0x71, 0x97,
+        0x18, 0x30, 0x46, 0x5C, 0x60, 0xC1, 0x97, 0x18, 0x05, 0xAC, 0x8C, 0xB7, 0x7A, 0xC0, 0xB4, 0x65,
+        0xAC, 0xB7, 0x07, 0x96, 0xB2, 0xCE, 0xD9, 0x60, 0x76, 0xCB, 0x3B, 0xD6, 0xB2, 0x0C, 0xAF, 0x2C,
+        0xB2, 0xBC, 0xD0, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0xFF, 0x03, 0xEB,
+        0xFB, 0xFF, 0xA0, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x08, 0x28, 0x00, 0x00, 0x08, 0x00,
+        0x30, 0x01, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x50, 0x03, 0x00,
+        0x1C, 0x01, 0x01, 0xCD, 0x35, 0xA7, 0xB8, 0xBF, 0x07, 0x69, 0xA7, 0xBB, 0x43, 0x42, 0x47, 0x2B,
+        0xCA, 0x4B, 0x8C, 0x41, 0x89, 0x96, 0x24, 0xB8, 0x91, 0xC1, 0xA4, 0x48, 0xCB, 0x89, 0x9B, 0x30,
+        0x3B, 0x4D, 0x0D, 0x7B, 0x9A, 0x06, 0xBD, 0xF6, 0x3D, 0xCD, 0x68, 0x31, 0x33, 0xBE, 0x6F, 0x29,
+        0x12, 0x38, 0x35, 0xE7, 0x7C, 0xA4, 0x62, 0x66, 0xCC, 0x0E, 0x34, 0xD3, 0x5E, 0xE6, 0x80, 0x6B,
+        0x4F, 0x75, 0xFB, 0xB4, 0x03, 0x4D, 0x7B, 0x9A, 0x18, 0x2D, 0x3D, 0xCD, 0x68, 0x68, 0x1E, 0xED,
+        0x34, 0xD1, 0xEF, 0xB2, 0x10, 0x60, 0x10, 0x44, 0x10, 0x10, 0x7F, 0xFF, 0xE8, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFB, 0xA1, 0x83, 0x5A, 0x7B, 0xAF, 0xDC, 0x68, 0x1A,
+        0x6B, 0xDC, 0xD0, 0xD6, 0x09, 0xEE, 0x6B, 0x43, 0x4F, 0x0D, 0x89, 0x10, 0x23, 0x9B, 0x32, 0x83,
+        0x5A, 0x1A, 0x7B, 0xB4, 0x18, 0x91, 0x0C, 0xAF, 0x29, 0x18, 0x29, 0x9D, 0xF3, 0x66, 0x58, 0x91,
+        0x30, 0x77, 0x9D, 0xF2, 0x91, 0x23, 0x13, 0x28, 0x17, 0xEE, 0xD3, 0x4F, 0x76, 0x82, 0x11, 0x23,
+        0x95, 0xE5, 0x25, 0xC1, 0x62, 0x44, 0xCB, 0x12, 0x5C, 0x41, 0xAF, 0x73, 0x4D, 0x6E, 0xF4, 0x1C,
+        0xD9, 0x96, 0x24, 0x40, 0x8E, 0x0D, 0x22, 0x47, 0x36, 0x06, 0x52, 0x0B, 0x12, 0x26, 0x77, 0xCD,
+        0xE5, 0x23, 0xA0, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x80, 0x01, 0x80, 0x01, 0xFE, 0x08, 0x37,
+        0xF7, 0xFF, 0x40, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x08, 0x78, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x18, 0x01, 0x00, 0x06, 0x00, 0x40, 0x01, 0x80,
+        0x10, 0x00, 0x63, 0x94, 0xCB, 0x97, 0x2C, 0x00, 0x70, 0x6E, 0x53, 0x2E, 0x5C, 0xB9, 0x72, 0xE5,
+        0x0C, 0x2F, 0x76, 0x0B, 0xDD, 0xE1, 0xB9, 0x4C, 0xB9, 0x72, 0xE5, 0x32, 0xE0, 0xDC, 0xB0, 0x72,
+        0xC0, 0x1C, 0xB0, 0x40, 0x1C, 0xB0, 0x72, 0xE5, 0xCA, 0x39, 0x72, 0xE5, 0x83, 0x96, 0x00, 0x0B,
+        0x97, 0x2E, 0x5C, 0xA6, 0x5C, 0xB9, 0x43, 0xDD, 0xEE, 0xC1, 0x61, 0x78, 0x6E, 0x5C, 0xB9, 0x72,
+        0xE5, 0x32, 0xE5, 0x18, 0x00, 0xE5, 0xCA, 0x65, 0xCB, 0x83, 0x4C, 0xB9, 0x72, 0xE5, 0x32, 0xE5,
+        0xC1, 0xB9, 0x4C, 0xB9, 0x60, 0x03, 0x01, 0x07, 0x2E, 0x5C, 0xB9, 0x72, 0xE5, 0xC4, 0xFF, 0xFF,
+        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+        0x78, 0xC8, 0x32, 0x0C, 0x83, 0x20, 0x77, 0xBB, 0xDD, 0x85, 0x82, 0x1C, 0xB9, 0x4C, 0xB9, 0x72,
+        0xE5, 0x32, 0x8E, 0x5C, 0xB9, 0x4C, 0xB9, 0x72, 0x99, 0x47, 0x2C, 0x00, 0x72, 0xE5, 0x32, 0xE0,
+        0xDC, 0xB9, 0x72, 0xE5, 0x80, 0x30, 0x10, 0x1C, 0xB9, 0x72, 0xE5, 0xCA, 0x60, 0xDC, 0xB9, 0x72,
+        0xC0, 0x07, 0x2C, 0x11, 0xCB, 0x97, 0x2E, 0x5C, 0xB9, 0x60, 0x17, 0xBB, 0x05, 0xEE, 0xC2, 0x1C,
+        0xB0, 0x72, 0xE5, 0xCA, 0x65, 0xCA, 0x39, 0x72, 0x99, 0x72, 0xE5, 0x80, 0x02, 0xE5, 0x80, 0x39,
+        0x72, 0xE5, 0xCA, 0x39, 0x72, 0x99, 0x72, 0xC0, 0x07, 0x06, 0xE5, 0xCA, 0x65, 0xCB, 0x97, 0x2E,
+        0x5D, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x44, 0x3F, 0xBF,
+        0xFA, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x08, 0xC8, 0x00, 0xC0, 0x08, 0x00, 0x30, 0x02,
+        0x00, 0x14, 0x00, 0xC0, 0x01, 0x00, 0x08, 0x00, 0x80, 0x04, 0x00, 0x30, 0x01, 0x00, 0x08, 0x00,
+        0x63, 0x1C, 0x59, 0x2C, 0x71, 0x71, 0x46, 0x4B, 0x1C, 0x59, 0x2C, 0x96, 0x21, 0xEA, 0xDB, 0xB0,
+        0x0B, 0xC2, 0xB2, 0x58, 0xE2, 0xE2, 0xC9, 0x46, 0x38, 0xB2, 0x59, 0x2C, 0x71, 0x46, 0x4B, 0x25,
+        0x8E, 0x2C, 0x96, 0x00, 0x05, 0xEA, 0xDB, 0xB5, 0xE1, 0x5C, 0x59, 0x2C, 0x71, 0x64, 0xA3, 0x25,
+        0x8E, 0x2C, 0x9B, 0xCB, 0x8A, 0x38, 0xB2, 0x6F, 0x2E, 0x5C, 0xB8, 0xB8, 0x53, 0x45, 0x4D, 0x38,
+        0x9A, 0x13, 0x45, 0x49, 0x53, 0x89, 0xA2, 0x52, 0x13, 0x4E, 0x26, 0x85, 0x64, 0xB1, 0xC3, 0x78,
+        0xB2, 0x54, 0x10, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x20, 0x3F, 0xFF, 0xEB, 0x08, 0x00, 0x00, 0x04, 0x81, 0x08, 0x84, 0x53, 0x00, 0x6C,
+        0x71, 0x64, 0xDE, 0x5C, 0xDE, 0x09, 0x14, 0xA6, 0x9C, 0x4D, 0x15, 0x34, 0x26, 0x89, 0xC4, 0xD1,
+        0x53, 0x4D, 0x27, 0x0E, 0x18, 0xE6, 0xF1, 0x64, 0xB2, 0x5C, 0xDE, 0x28, 0xC9, 0x63, 0x8B, 0x8B,
+        0x25, 0x88, 0xE2, 0xC9, 0x64, 0xB1, 0xC5, 0x90, 0x3B, 0x00, 0xBD, 0x5B, 0x70, 0xC7, 0x17, 0x16,
+        0x4B, 0x1C, 0x51, 0xC5, 0x92, 0xC7, 0x16, 0x4B, 0x20, 0x76, 0xBD, 0x5B, 0x76, 0x00, 0x47, 0x16,
+        0x4B, 0x1C, 0x5C, 0x51, 0x92, 0xC7, 0x16, 0x4B, 0x25, 0x88, 0xE2, 0xC9, 0x63, 0x8B, 0x8B, 0x26,
+        0x80, 0x0A, 0x00, 0x30, 0x00, 0x60, 0x02, 0x00, 0x06, 0x00, 0x27, 0xF8, 0x23, 0x5F, 0xDF, 0xFD,
+        0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x09, 0x48, 0x00, 0x80, 0x00, 0x00, 0x30, 0x02, 0x00,
+        0x00, 0x00, 0x60, 0x04, 0x00, 0x00, 0x00, 0xC0, 0x08, 0x00, 0x30, 0x02, 0x00, 0x00, 0x00, 0x63,
+        0xE7, 0x70, 0xB8, 0x5C, 0x2E, 0x5C, 0x28, 0xE0, 0x17, 0x0B, 0x85, 0xCB, 0x85, 0x1C, 0x02, 0xE1,
+        0x70, 0xB9, 0x70, 0xA3, 0x83, 0x9B, 0x85, 0xC2, 0xE1, 0x71, 0x06, 0x98, 0xEF, 0x3B, 0xCE, 0xF4,
+        0x0D, 0x31, 0xDE, 0x77, 0x9D, 0xE8, 0x48, 0x91, 0xCD, 0xC2, 0xE1, 0x71, 0x06, 0xB4, 0xD6, 0x77,
+        0x9D, 0xE8, 0x34, 0xD3, 0x59, 0xDE, 0x4C, 0x11, 0xA6, 0x9E, 0xE6, 0x98, 0x23, 0x4C, 0xEF, 0x2D,
+        0x30, 0x46, 0x77, 0x9D, 0xE5, 0xA6, 0x40, 0x88, 0x64, 0x00, 0xC8, 0x01, 0x90, 0x00, 0xFF, 0xFF,
+        0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x07, 0xFF, 0xFE, 0x90, 0x00, 0x64, 0x12, 0xE1, 0x71, 0x89, 0x18, 0x5C, 0x07, 0x79, 0x1A, 0x6B,
+        0x3B, 0xC0, 0x9A, 0x34, 0xD3, 0xDC, 0x0D, 0x34, 0x69, 0x9D, 0xE4, 0x1A, 0x69, 0xAD, 0xDE, 0x77,
+        0x90, 0xC4, 0x8C, 0x49, 0x70, 0xB8, 0x51, 0xE5, 0x89, 0x12, 0x5C, 0x2E, 0x14, 0x3C, 0x4D, 0x37,
+        0x79, 0xDE, 0x70, 0x78, 0x9A, 0x6E, 0xF3, 0xBC, 0xE1, 0xC2, 0xF2, 0xC2, 0xE1, 0x72, 0xE1, 0x47,
+        0x0B, 0x80, 0x5C, 0x2E, 0x5C, 0x28, 0xE1, 0x70, 0x0B, 0x85, 0xCB, 0x85, 0x1C, 0x2E, 0x17, 0xCE,
+        0xE1, 0x72, 0xE1, 0x74, 0x00, 0x40, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00, 0x00, 0x00, 0x7F, 0xC1,
+        0x2A, 0xFE, 0xFF, 0xE8, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x09, 0xA8, 0x00, 0xC0, 0x08,
+        0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x18, 0x01, 0x00, 0x00, 0x00, 0x30, 0x02,
+        0x00, 0x04, 0x00, 0x00, 0xCE, 0xF5, 0x79, 0xDE, 0x80, 0x65, 0xC2, 0xE2, 0xE0, 0x84, 0xB8, 0x0E,
+        0xF4, 0x67, 0x7A, 0xB3, 0x70, 0xE1, 0x71, 0x97, 0x0B, 0x8B, 0x80, 0x36, 0x4B, 0x85, 0xC4, 0x71,
+        0x97, 0x04, 0xB2, 0x5C, 0x2E, 0x32, 0xE1, 0x70, 0x57, 0x02, 0xC9, 0x61, 0x2E, 0x14, 0x71, 0x97,
+        0x0B, 0x25, 0xC2, 0xE3, 0x06, 0xE1, 0x71, 0x19, 0x2E, 0x08, 0x0C, 0xB8, 0x5C, 0x65, 0xC2, 0xC9,
+        0x70, 0x1D, 0xE8, 0x37, 0x79, 0xDB, 0x70, 0xE0, 0x84, 0xB8, 0x5C, 0x65, 0xC1, 0x06, 0x4F, 0xFF,
+        0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF9, 0xC6, 0x40, 0x0C, 0x81, 0x10, 0xC8, 0x01,
+        0xB8, 0x84, 0x2E, 0x2E, 0x17, 0x11, 0x00, 0x97, 0x0B, 0x8B, 0x85, 0xC1, 0x65, 0xC2, 0xE2, 0x10,
+        0xB8, 0xA3, 0x09, 0x70, 0xB8, 0xCB, 0x85, 0xC4, 0x5C, 0x2E, 0x32, 0xE1, 0x71, 0x1C, 0x15, 0xC0,
+        0xB2, 0x5C, 0x2E, 0x32, 0x8E, 0x17, 0x17, 0x0B, 0x8C, 0xB0, 0x83, 0x70, 0xB8, 0xB8, 0x16, 0x4B,
+        0x80, 0xDC, 0x65, 0xC2, 0xE2, 0x32, 0x5C, 0x04, 0x6E, 0xF3, 0xBD, 0x19, 0xC1, 0xB7, 0x79, 0xDE,
+        0x83, 0x77, 0x83, 0x64, 0xB8, 0x21, 0x2E, 0x17, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+        0x00, 0x0C, 0x00, 0x4F, 0xF0, 0x4D, 0xBF, 0xBF, 0xFA, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF,
+        0x0A, 0x28, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x40, 0x01, 0x80, 0x00, 0x00, 0x00, 0x7B, 0x83, 0xDC, 0x32, 0x03, 0x5A, 0x69,
+        0xAD, 0x01, 0x90, 0xF7, 0x01, 0xEE, 0x00, 0xC8, 0xD1, 0x90, 0x07, 0xB8, 0x3D, 0xC0, 0x1E, 0xE0,
+        0xC8, 0xD6, 0x81, 0xA6, 0xB4, 0x64, 0x3C, 0x1C, 0x1E, 0xE0, 0xF7, 0x00, 0x7B, 0x83, 0xDC, 0x34,
+        0xC1, 0x68, 0x7B, 0x80, 0xF7, 0x00, 0xD6, 0x9A, 0x6B, 0x44, 0x00, 0x80, 0x10, 0x00, 0x04, 0xFF,
+        0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE5, 0x0E,
+        0x19, 0x1A, 0xD3, 0x40, 0xD6, 0x87, 0xB8, 0x00, 0xF7, 0x0D, 0x69, 0xA1, 0xE0, 0xE0, 0xF7, 0x07,
+        0xB8, 0x03, 0xDC, 0x1E, 0xE1, 0x90, 0x1A, 0xD3, 0x4D, 0x68, 0xC0, 0x83, 0xDC, 0x1E, 0xE0, 0x0F,
+        0x70, 0x64, 0x68, 0x0C, 0x83, 0xDC, 0x00, 0x7B, 0x86, 0x46, 0xB4, 0xC1, 0x35, 0xA3, 0x21, 0xEE,
+        0x00, 0xF7, 0x07, 0xB8, 0x34, 0x00, 0x40, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF,
+        0xC1, 0x46, 0xFE, 0xFF, 0xE8, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x0A, 0xB8, 0x00, 0x00,
+        0x02, 0x00, 0x20, 0x00, 0x80, 0x08, 0x00, 0x20, 0x02, 0x00, 0x08, 0x00, 0x80, 0x02, 0x00, 0x40,
+        0x01, 0x80, 0x10, 0x00, 0x63, 0x18, 0xC6, 0x31, 0x93, 0x79, 0xBC, 0x1D, 0xE6, 0xF1, 0x63, 0x06,
+        0x31, 0xC1, 0xDE, 0x2C, 0x60, 0xC6, 0x4D, 0xE6, 0x8F, 0x37, 0x9B, 0xCD, 0xE2, 0xC6, 0x31, 0x80,
+        0xB6, 0xED, 0x6B, 0x5A, 0xC0, 0xB9, 0xBC, 0xDE, 0x6F, 0x37, 0x96, 0x0C, 0x43, 0x5A, 0xD7, 0xAB,
+        0x2D, 0x68, 0x91, 0x89, 0xA9, 0xA7, 0x13, 0x53, 0x4D, 0x11, 0x8C, 0x60, 0xE6, 0xF1, 0x63, 0x11,
+        0x8C, 0x18, 0xE6, 0xF3, 0x79, 0xBC, 0x54, 0x10, 0x02, 0x20, 0x88, 0x22, 0x11, 0x4C, 0x53, 0x07,
+        0xFF, 0xFF, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0x91, 0x14, 0xC5,
+        0x30, 0x45, 0x8C, 0x60, 0xC9, 0xBC, 0xDE, 0x6F, 0x06, 0xC6, 0x0C, 0x63, 0x19, 0x37, 0x83, 0x60,
+        0xC6, 0x31, 0xCD, 0xE6, 0xF2, 0x8E, 0x6F, 0x37, 0x96, 0x31, 0x8C, 0x18, 0x32, 0xC6, 0x31, 0x8C,
+        0x1C, 0xDE, 0x0E, 0xF3, 0x79, 0xBC, 0xB0, 0x18, 0xC6, 0x05, 0xAF, 0x56, 0x5A, 0xD6, 0xB1, 0x29,
+        0xA9, 0xA9, 0xA9, 0xA9, 0xA2, 0x51, 0x42, 0x31, 0x93, 0x79, 0x63, 0x18, 0x23, 0x19, 0x37, 0x9B,
+        0xCD, 0xE6, 0xF1, 0x62, 0x31, 0x8C, 0x63, 0x97, 0x2C, 0x63, 0xA0, 0x01, 0x00, 0x02, 0x00, 0x10,
+        0x00, 0x20, 0x01, 0x00, 0x01, 0xFE, 0x0A, 0xC7, 0xF7, 0xFF, 0x40, 0x02, 0xCF, 0xFF, 0xEF, 0xFE,
+        0xFF, 0xFF, 0x0B, 0x58, 0x00, 0x00, 0x04, 0x00, 0x30, 0x01, 0x00, 0x08, 0x00, 0x60, 0x02, 0x00,
+        0x08, 0x01, 0x00, 0x02, 0x00, 0x10, 0x02, 0x00, 0x04, 0x00, 0x23, 0x8B, 0x8B, 0x25, 0x8C, 0x96,
+        0x40, 0xED, 0xBB, 0x5E, 0xAF, 0x40, 0x10, 0x63, 0x8B, 0x8B, 0x8B, 0x88, 0xB2, 0x59, 0x2C, 0x96,
+        0x4A, 0xF1, 0x0B, 0xD5, 0xE8, 0x2F, 0x57, 0xA1, 0x71, 0x71, 0x63, 0x25, 0x92, 0xC1, 0x96, 0x4B,
+        0x1C, 0x5C, 0x5C, 0x51, 0x83, 0x8B, 0x8B, 0x8B, 0x8B, 0x82, 0xB2, 0x59, 0x2C, 0x9B, 0xCB, 0x1C,
+        0x15, 0xC5, 0xC5, 0xC5, 0xC5, 0x91, 0x06, 0x21, 0x07, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x1F, 0xFF, 0xFF, 0xB4, 0x41, 0x09, 0x02, 0x11,
+        0x08, 0x62, 0x10, 0xC6, 0x4B, 0x25, 0x92, 0xC7, 0x37, 0x8A, 0x38, 0xB8, 0xB2, 0x59, 0x2C, 0x96,
+        0x0C, 0xB2, 0x58, 0x32, 0x59, 0x2C, 0x83, 0x63, 0x8B, 0x8B, 0x8B, 0x8B, 0x05, 0x92, 0xC9, 0x64,
+        0xB2, 0x58, 0x02, 0x12, 0xC9, 0x64, 0xD9, 0x8B, 0x88, 0xB8, 0xB8, 0xB2, 0x59, 0x2C, 0x94, 0x36,
+        0xED, 0x60, 0x1B, 0xB0, 0xCB, 0x1C, 0x5C, 0x5C, 0x58, 0xE0, 0xAC, 0x96, 0x4B, 0x25, 0x92, 0xC7,
+        0x40, 0x04, 0x00, 0x04, 0x00, 0x10, 0x01, 0x00, 0x01, 0x00, 0x03, 0xFC, 0x16, 0xCF, 0xEF, 0xFE,
+        0x80, 0x02, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFB, 0xFF, 0xBF, 0xFF, 0xC3, 0x02, 0x00, 0x00, 0x01,
+        0x00, 0x0C, 0x00, 0x40, 0x01, 0x00, 0x30, 0x01, 0x40, 0x08, 0x00, 0x30, 0x03, 0x00, 0x14, 0x00,
+        0x83, 0x64, 0xB2, 0x2E, 0x32, 0xE2, 0xE0, 0xB2, 0xC7, 0x94, 0x71, 0x71, 0x94, 0x64, 0x42, 0x59,
+        0x17, 0x2F, 0x37, 0x06, 0xC8, 0xB8, 0xB8, 0xCB, 0x8C, 0xA3, 0x25, 0x8F, 0x29, 0x2C, 0x8B, 0x94,
+        0x79, 0xB0, 0x22, 0xE2, 0xE3, 0x2E, 0x0B, 0x2C, 0x96, 0x3C, 0xDC, 0xB8, 0xCA, 0x32, 0x59, 0x10,
+        0x8B, 0x8B, 0x94, 0x79, 0xB0, 0xCD, 0x8E, 0x2E, 0x32, 0xE2, 0x04, 0x43, 0x10, 0x86, 0x20, 0x98,
+        0xA4, 0x07, 0xFF, 0xFF, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x89, 0x79, 0xB1, 0xC5, 0xC6, 0x5C,
+        0x60, 0xD9, 0x2C, 0x79, 0x47, 0x9B, 0x96, 0x41, 0xB2, 0x21, 0x17, 0x17, 0x19, 0x47, 0x2F, 0x36,
+        0x38, 0xB8, 0xCB, 0x8C, 0x1B, 0x25, 0x91, 0x07, 0x9B, 0x96, 0x41, 0x5C, 0x4C, 0xD8, 0xE2, 0xE3,
+        0x28, 0xE3, 0x2C, 0x96, 0x45, 0xCB, 0xCD, 0xC1, 0xB2, 0x2E, 0x21, 0x17, 0x19, 0x46, 0x4B, 0x0C,
+        0xD8, 0xE3, 0x2C, 0x94, 0x71, 0x96, 0x45, 0xC5, 0xCB, 0xCD, 0xC1, 0xBC, 0xD8, 0xE2, 0x00, 0x02,
+        0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x0C, 0xC8, 0x00, 0x00, 0x02, 0x00, 0x40, 0x00, 0x80, 0x00,
+        0x00, 0x20, 0x02, 0x00, 0x10, 0x00, 0x40, 0x02, 0x00, 0x20, 0x00, 0x00, 0x08, 0x00, 0x61, 0x97,
+        0xA5, 0xB7, 0x65, 0xE8, 0x17, 0xA5, 0xB5, 0x66, 0xED, 0x60, 0x6E, 0xCB, 0x6A, 0xCB, 0x68, 0x58,
+        0xF3, 0x63, 0x22, 0xC2, 0x58, 0x0B, 0xD2, 0xDA, 0xB5, 0xE9, 0x07, 0xA5, 0xB5, 0x66, 0xEC, 0xBC,
+        0x12, 0xDB, 0xB2, 0xF4, 0xB3, 0x07, 0x65, 0xB5, 0x6B, 0x6A, 0xC1, 0x71, 0x19, 0x16, 0x3C, 0xD8,
+        0xF1, 0x3F, 0xFF, 0xFF, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE7, 0x28,
+        0x82, 0x62, 0x88, 0x22, 0x0D, 0x59, 0xBB, 0x2D, 0xAB, 0x41, 0xB5, 0x65, 0xE9, 0x66, 0xEC, 0x0B,
+        0xD5, 0x9B, 0xB2, 0xF4, 0x83, 0x6A, 0xCD, 0xD9, 0xBB, 0x5B, 0x05, 0x66, 0xEC, 0xBD, 0x2D, 0xA1,
+        0x63, 0xCD, 0x8C, 0x8B, 0x06, 0x40, 0xAC, 0xBD, 0x2D, 0x7A, 0x58, 0x35, 0x66, 0xEC, 0xDD, 0x97,
+        0xA0, 0xB3, 0x76, 0x5E, 0x96, 0xD5, 0xA0, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x60, 0x01, 0x00,
+        0x01, 0xFE, 0x0C, 0xD7, 0xF7, 0xFF, 0x40, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x0D, 0x98,
+        0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x06,
+        0x00, 0x40, 0x01, 0x80, 0x10, 0x00, 0x63, 0x89, 0x2E, 0x5C, 0xB9, 0x70, 0xB9, 0x47, 0x2E, 0x5C,
+        0x2E, 0x5C, 0xB9, 0x72, 0xE0, 0xDC, 0xB9, 0x72, 0xE5, 0xCB, 0x97, 0x2E, 0x0A, 0x4B, 0x97, 0x2E,
+        0x5C, 0x2E, 0x5C, 0x1B, 0x97, 0x0B, 0x97, 0x2E, 0x5C, 0x2E, 0x0D, 0xCB, 0x97, 0x2E, 0x17, 0x2E,
+        0x5C, 0xA3, 0x88, 0x01, 0x2E, 0x5C, 0xB9, 0x70, 0x6E, 0x5C, 0xB9, 0x72, 0xE5, 0xC2, 0xE5, 0x42,
+        0x0C, 0x83, 0x20, 0x3F, 0xFF, 0xFF, 0xF9, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xE5, 0x00,
+        0xC8, 0x32, 0x0C, 0x83, 0x20, 0x06, 0x41, 0x90, 0x6E, 0x5C, 0xB9, 0x72, 0xE5, 0xCB, 0x97, 0x05,
+        0x00, 0x25, 0xCB, 0x97, 0x2E, 0x03, 0x72, 0xE5, 0xCB, 0x97, 0x0B, 0x97, 0x28, 0xE5, 0xC2, 0xE5,
+        0xCB, 0x97, 0x0B, 0x94, 0x72, 0xE5, 0xC4, 0x97, 0x2E, 0x5C, 0xB8, 0x37, 0x2E, 0x5C, 0xB9, 0x72,
+        0xE5, 0xCB, 0x83, 0x70, 0xB9, 0x72, 0xE5, 0xC2, 0xE5, 0xC1, 0xB9, 0x71, 0x25, 0xCB, 0x97, 0x10,
+        0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x06, 0xD3, 0xFB, 0xFF,
+        0xA0, 0x02, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFB, 0xFF, 0xBF, 0xFF, 0xC3, 0xAA, 0x00, 0x20, 0x00,
+        0x00, 0x0C, 0x00, 0x80, 0x01, 0x00, 0x10, 0x00, 0xC0, 0x08, 0x00, 0x10, 0x01, 0x00, 0x0C, 0x00,
+        0x82, 0xC2, 0xE2, 0xE3, 0x2E, 0x32, 0xE0, 0xB0, 0xB8, 0xCB, 0x8B, 0x8C, 0xB8, 0x2C, 0x2E, 0x32,
+        0xE3, 0x2E, 0x2E, 0x05, 0xBB, 0xC8, 0xD1, 0xBB, 0xC1, 0x66, 0xF0, 0xB8, 0xCB, 0x8C, 0xB8, 0x8C,
+        0x2E, 0x32, 0xC9, 0x71, 0x97, 0x11, 0x85, 0xC6, 0x5C, 0x65, 0x92, 0xE2, 0x82, 0x19, 0x00, 0x11,
+        0x0C, 0x81, 0x10, 0xC8, 0x11, 0x7F, 0xFF, 0xFF, 0xFC, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFC, 0xA1, 0x10, 0xDC, 0x65, 0xC6, 0x17, 0x19, 0x71, 0x17, 0x19,
+        0x71, 0x97, 0x06, 0x5C, 0x46, 0x5C, 0x5C, 0x65, 0xC1, 0x97, 0x11, 0x97, 0x19, 0x70, 0xDE, 0x30,
+        0xB8, 0x81, 0xA3, 0x3B, 0xD6, 0xED, 0xB8, 0x71, 0x97, 0x19, 0x70, 0x65, 0xC6, 0x0D, 0x92, 0xE3,
+        0x2E, 0x0C, 0xB8, 0xC1, 0xB8, 0xCB, 0x25, 0xC1, 0x97, 0x18, 0x37, 0x19, 0x70, 0x40, 0x02, 0xCF,
+        0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x0F, 0xB8, 0x00, 0x40, 0x00, 0x00, 0x10, 0x02, 0x00, 0x04, 0x00,
+        0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x61, 0x96, 0xD5,
+        0x9A, 0xB3, 0x42, 0x38, 0x8C, 0x9B, 0xC4, 0x9B, 0xC4, 0x1B, 0xB1, 0xBB, 0x59, 0xA4, 0x1B, 0x4B,
+        0x69, 0xBE, 0xDE, 0x80, 0xDD, 0x9A, 0xB3, 0x56, 0xB0, 0x35, 0x6D, 0x17, 0xA2, 0xF7, 0xC1, 0xFA,
+        0x6E, 0xC6, 0xEC, 0x6A, 0x41, 0x0B, 0xFF, 0xFF, 0xFF, 0xFA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x90, 0x84, 0x42, 0x08,
+        0x00, 0x12, 0x04, 0x41, 0xC4, 0x9B, 0xCB, 0x02, 0x58, 0x06, 0xAD, 0xA5, 0xAD, 0xA0, 0x5B, 0x4B,
+        0xD1, 0xBA, 0xFD, 0x03, 0x56, 0x6A, 0xCD, 0x2D, 0x0E, 0x20, 0xE2, 0x4D, 0xE2, 0x4D, 0xE0, 0x56,
+        0x6E, 0xCD, 0x2D, 0xA0, 0x5B, 0x56, 0x5E, 0x8D, 0xD9, 0xA0, 0x00, 0x00, 0x04, 0x00, 0x18, 0x00,
+        0x40, 0x00, 0x00, 0x05, 0xFE, 0x0F, 0xC7, 0xF7, 0xFF, 0x40, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF,
+        0xFF, 0x11, 0x18, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10,
+        0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x00, 0x01, 0x18, 0xB2, 0xC5, 0x80, 0xEF, 0x58,
+        0xB3, 0xBC, 0xB0, 0x2C, 0xEF, 0x2C, 0x58, 0xB0, 0x16, 0xEF, 0x16, 0x58, 0x83, 0x16, 0xEF, 0x16,
+        0x2C, 0x0E, 0xF2, 0xCB, 0x3B, 0xCB, 0x0A, 0x08, 0x40, 0x00, 0x08, 0x40, 0x01, 0xFF, 0xFF, 0x18,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE2, 0x81, 0x62, 0xC5, 0x9D, 0xE0, 0x59, 0x67, 0x79,
+        0x62, 0xC0, 0x77, 0xAC, 0x58, 0xB2, 0xC0, 0x77, 0xAC, 0x58, 0xB0, 0x16, 0x77, 0x96, 0x59, 0xDE,
+        0x41, 0x8B, 0x77, 0x8B, 0x16, 0x05, 0x88, 0xC5, 0x8B, 0x68, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+        0x10, 0x00, 0x00, 0x00, 0x7F, 0x84, 0x49, 0xFD, 0xFF, 0xD0, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF,
+        0xFF, 0x12, 0x98, 0x00, 0xC0, 0x02, 0x00, 0x60, 0x01, 0x80, 0x04, 0x00, 0x40, 0x02, 0x00, 0x10,
+        0x00, 0xC0, 0x02, 0x00, 0x60, 0x01, 0x80, 0x04, 0x00, 0x43, 0x25, 0x79, 0x59, 0x25, 0x79, 0x58,
+        0x32, 0x57, 0x95, 0x91, 0xCD, 0xE5, 0x60, 0xC7, 0x37, 0x95, 0x91, 0x24, 0xAC, 0x18, 0x92, 0x56,
+        0x44, 0x92, 0xBC, 0x1D, 0x84, 0x95, 0xE6, 0xC2, 0x39, 0xBC, 0x51, 0x42, 0x00, 0x20, 0x44, 0x14,
+        0x61, 0x42, 0x00, 0x20, 0x44, 0xFF, 0xFF, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFD, 0x50, 0xC2, 0x04, 0x00,
+        0x46, 0x1D, 0xE5, 0x88, 0xF3, 0x79, 0x62, 0x3C, 0x1D, 0x98, 0xA3, 0xCD, 0x98, 0xA4, 0x42, 0xDE,
+        0xA6, 0xAD, 0xEA, 0x68, 0x59, 0x9B, 0xCB, 0x16, 0x66, 0xF2, 0xC4, 0x59, 0x9B, 0x31, 0x59, 0x9B,
+        0x31, 0x45, 0x99, 0xB3, 0x15, 0x99, 0xB3, 0x17, 0x40, 0x01, 0x00, 0x08, 0x00, 0x40, 0x01, 0x40,
+        0x02, 0x00, 0x13, 0xFC, 0x25, 0x4F, 0xEF, 0xFE, 0x80, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF,
+        0x14, 0x98, 0x00, 0x00, 0x04, 0x00, 0x30, 0x01, 0x00, 0x08, 0x00, 0x60, 0x02, 0x00, 0x10, 0x00,
+        0xC0, 0x04, 0x00, 0x20, 0x00, 0x80, 0x04, 0x00, 0x82, 0xB8, 0xB8, 0xB8, 0x92, 0xC7, 0x05, 0x71,
+        0x64, 0x59, 0x2C, 0x96, 0x0C, 0x5C, 0x5C, 0x5C, 0x5C, 0x48, 0x36, 0x4B, 0x25, 0x92, 0xC8, 0xB2,
+        0x0D, 0x8E, 0x2C, 0x8B, 0x8B, 0x8A, 0xA2, 0x02, 0x00, 0x5F, 0xFF, 0xFE, 0xA0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xA0, 0x00, 0x07, 0xFF, 0xFF, 0xA6, 0x08, 0x01, 0x06, 0x10, 0x41, 0x84, 0x10, 0x61, 0x04,
+        0x2B, 0x25, 0x8E, 0x2C, 0x8B, 0x88, 0xB8, 0xB8, 0xB8, 0x92, 0xC9, 0x60, 0xCB, 0x25, 0x91, 0x71,
+        0x71, 0x60, 0xC5, 0x92, 0xC9, 0x63, 0x89, 0x28, 0xC9, 0x64, 0xB2, 0x59, 0x17, 0x17, 0x40, 0x04,
+        0x00, 0x04, 0x00, 0x10, 0x01, 0x00, 0x01, 0x00, 0x03, 0xFC, 0x29, 0x4F, 0xEF, 0xFE, 0x80, 0x02,
+        0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x16, 0xD8, 0x00, 0xC0, 0x04, 0x00, 0x10, 0x02, 0x00, 0x04,
+        0x00, 0x20, 0x04, 0x00, 0x08, 0x00, 0x40, 0x08, 0x00, 0x30, 0x00, 0x00, 0x08, 0x00, 0x02, 0xE5,
+        0x92, 0xC9, 0x48, 0xC9, 0x60, 0xB8, 0xB8, 0xDC, 0x1C, 0x5C, 0xB0, 0x65, 0x89, 0x25, 0x92, 0xC7,
+        0x14, 0x48, 0xE2, 0xE2, 0xE5, 0x82, 0x62, 0x86, 0x10, 0x41, 0x84, 0x10, 0x61, 0x02, 0x27, 0xFF,
+        0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+        0xFF, 0xEE, 0x86, 0x10, 0xB8, 0xB8, 0xB9, 0x48, 0x39, 0x60, 0xCB, 0x25, 0x89, 0x25, 0x8E, 0x28,
+        0xE2, 0x91, 0xC5, 0xCB, 0x25, 0x80, 0xDC, 0x96, 0x4B, 0x1C, 0x58, 0x98, 0x2B, 0x8B, 0x96, 0x09,
+        0x96, 0x4B, 0xA0, 0x01, 0x00, 0x04, 0x00, 0x18, 0x00, 0x40, 0x00, 0x80, 0x09, 0xFE, 0x16, 0xE7,
+        0xF7, 0xFF, 0x40, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x19, 0xD8, 0x00, 0x80, 0x02, 0x00,
+        0x20, 0x00, 0x80, 0x04, 0x00, 0x80, 0x01, 0x00, 0x10, 0x00, 0x40, 0x02, 0x00, 0x60, 0x02, 0x80,
+        0x10, 0x00, 0x23, 0x17, 0x18, 0xBC, 0xD9, 0x16, 0x41, 0x65, 0x91, 0x96, 0x46, 0x2E, 0x23, 0x19,
+        0x64, 0x62, 0xE3, 0x17, 0x05, 0x22, 0xE2, 0x4B, 0x23, 0x2F, 0x17, 0xFF, 0xFF, 0xFE, 0xD0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00,
+        0x07, 0xFF, 0xFF, 0xFD, 0x91, 0x44, 0x04, 0x20, 0x41, 0x10, 0x11, 0x25, 0x91, 0x25, 0x91, 0x96,
+        0x41, 0x62, 0xE3, 0x19, 0x64, 0x62, 0x8E, 0x31, 0x71, 0x8B, 0x22, 0xF3, 0x46, 0x46, 0x59, 0x19,
+        0x79, 0xB2, 0x33, 0x40, 0x03, 0x00, 0x08, 0x00, 0x20, 0x00, 0x40, 0x02, 0x00, 0x07, 0xFC, 0x33,
+        0xCF, 0xEF, 0xFE, 0x80, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x1D, 0x78, 0x00, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x0F, 0x77, 0x79, 0xA3, 0x04, 0xB0, 0xF7, 0x0B, 0x0A,
+        0x10, 0x20, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03, 0xFF, 0xFF, 0xFF, 0xE9, 0x82, 0x00, 0x00, 0x04, 0x08,
+        0x00, 0x02, 0x10, 0x00, 0x00, 0x20, 0x70, 0xB3, 0x46, 0x9D, 0xE0, 0xF7, 0x00, 0x34, 0x00, 0x00,
+        0x34, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7F, 0x87, 0x61, 0xFD,
+        0xFF, 0xD0, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x22, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+        0x00, 0x41, 0x31, 0xDE, 0x3B, 0xD6, 0x00, 0x8C, 0x11, 0x83, 0x03, 0x08, 0x00, 0x08, 0x00, 0x40,
+        0x41, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x2A,
+        0x00, 0x00, 0x00, 0x01, 0x69, 0x9D, 0xE1, 0x18, 0x02, 0x30, 0x5B, 0xBC, 0x07, 0x78, 0x9A, 0xC2,
+        0x6D, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF1, 0x15, 0x3F, 0xBF,
+        0xFA, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x29, 0xA8, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00,
+        0x80, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x80, 0x06, 0x00, 0x40, 0x00, 0x00, 0x0C, 0x00,
+        0x81, 0x1B, 0xBD, 0x34, 0xD1, 0x82, 0x69, 0xA0, 0xDD, 0xE7, 0x30, 0x40, 0x1F, 0xFF, 0xFE, 0xE0,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF6, 0xE0, 0x01,
+        0x84, 0x00, 0x0C, 0x20, 0x10, 0x00, 0x00, 0x03, 0x4D, 0x34, 0x69, 0xA1, 0x25, 0xC4, 0x25, 0xC2,
+        0xE2, 0x4D, 0x00, 0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x2F, 0xF1, 0x4D, 0xBF,
+        0xBF, 0xFA, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x34, 0x58, 0x00, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x00, 0x00, 0x0C,
+        0x00, 0xC2, 0xDC, 0x23, 0x70, 0x89, 0x72, 0x2C, 0x0C, 0x20, 0x00, 0x20, 0x80, 0x00, 0x05, 0xFF,
+        0xFF, 0xFF, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF1, 0xA1, 0x16, 0x77, 0xB5, 0xDE, 0x68, 0x37, 0x22,
+        0x5C, 0x9B, 0x83, 0x00, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF,
+        0x1A, 0x33, 0xFB, 0xFF, 0xA0, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x46, 0x78, 0x00, 0x40,
+        0x04, 0x00, 0x30, 0x01, 0x00, 0x08, 0x00, 0x20, 0x01, 0x00, 0x20, 0x00, 0xC0, 0x04, 0x00, 0x10,
+        0x02, 0x00, 0x04, 0x00, 0x4E, 0x02, 0x02, 0x08, 0x02, 0x04, 0x06, 0x04, 0x04, 0x06, 0x04, 0x02,
+        0x08, 0x02, 0x05, 0xFF, 0xFF, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xFF, 0xFF, 0xA8, 0x80, 0x81, 0x01, 0x81, 0x00, 0x82, 0x0A, 0xE3, 0x2C, 0x8C,
+        0xB1, 0xCB, 0x34, 0x00, 0x20, 0x00, 0x40, 0x01, 0x00, 0x10, 0x00, 0x10, 0x00, 0xBF, 0xC8, 0xD0,
+        0xFE, 0xFF, 0xE8, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x6B, 0xA8, 0x00, 0x40, 0x04, 0x00,
+        0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x06, 0x00, 0x40, 0x00, 0x00,
+        0x04, 0x00, 0x0E, 0x00, 0x00, 0x04, 0x01, 0xFF, 0xFF, 0xFF, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x07, 0xFF,
+        0xFF, 0xFE, 0xEE, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x08, 0x00, 0x02, 0x01, 0xA0,
+        0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x80, 0x05, 0xFE, 0x6B, 0xB7, 0xF7, 0xFF, 0x40,
+        0x02, 0xDF, 0xEF, 0xFF, 0x7F, 0xB8, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+        0x00, 0x60, 0x01, 0x80, 0x10, 0xE3, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF3, 0x68, 0x1C, 0x09, 0xA0, 0x02, 0x00,
+        0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xE3, 0x87, 0xF7, 0xFF, 0x40, 0x01, 0xCF,
+        0xFF, 0xEF, 0xFE, 0xEF, 0xFF, 0xEF, 0xFF, 0xEF, 0xFD, 0xEF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x01, 0x7F, 0xFE, 0xFF, 0xED, 0xFF,
+        0xFB, 0xFF, 0xFF, 0xDF, 0xFE, 0x00, 0x00, 0x02, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xDC, 0x8D, 0xFF,
+        0xFE, 0x1D, 0x70, 0x00, 0x80, 0x18, 0x00, 0x7C, 0x72, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x94, 0x22, 0x1B, 0x8C, 0xB8, 0xC2, 0xE3, 0x2E, 0x22, 0xE3,
+        0x2E, 0x32, 0xE0, 0xCB, 0x88, 0xCB, 0x8B, 0x8C, 0xB8, 0x32, 0xE2, 0x32, 0xE3, 0x2E, 0x1B, 0xC6,
+        0x17, 0x10, 0x34, 0x67, 0x7A, 0xDD, 0xB7, 0x0E, 0x32, 0xE3, 0x2E, 0x0C, 0xB8, 0xC1, 0xB2, 0x5C,
+        0x65, 0xC1, 0x97, 0x18, 0x37, 0x19, 0x64, 0xB8, 0x32, 0xE3, 0x06, 0xE3, 0x2E, 0x08, 0x02, 0xCF,
+        0xFF, 0xEC, 0x22, 0xFF, 0xFF, 0x0A, 0x28, 0x00, 0xC0, 0x08, 0x00, 0x00, 0x01, 0x80, 0x10, 0x00,
+        0x00, 0x01, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00, 0x0C, 0x00, 0x83, 0x71, 0x97,
+        0x0B, 0x82, 0x46, 0x03, 0x70, 0xB8, 0x5C, 0x65, 0xC4, 0x8B, 0x02, 0x01, 0xFF, 0xFF, 0xE9, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0x28, 0x70, 0xC8, 0xD6, 0x9A, 0x06, 0xB4,
+        0x3D, 0xC0, 0x07, 0xB8, 0x6B, 0x4D, 0x0F, 0x07, 0x07, 0xB8, 0x3D, 0xC0, 0x1E, 0xE0, 0xF7, 0x0C,
+        0x80, 0xD6, 0x9A, 0x6B, 0x46, 0x04, 0x1E, 0xE0, 0xF7, 0x00, 0x7B, 0x83, 0x23, 0x40, 0x64, 0x1E,
+        0xE0, 0x03, 0xDC, 0x32, 0x35, 0xA6, 0x09, 0xAD, 0x19, 0x0F, 0x70, 0x07, 0xB8, 0x3D, 0xC1, 0xA0,
+        0x02, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFE, 0x0A, 0x37, 0xF7, 0xFF, 0x40,
+        0x02, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFB, 0x5A, 0x3F, 0xFF, 0xC5, 0x22, 0x00, 0x30, 0x01, 0x00,
+        0x08, 0x00, 0x60, 0x04, 0x00, 0x08, 0x00, 0x40, 0x08, 0x00, 0x10, 0x00, 0x80, 0x10, 0x00, 0x03,
+        0x63, 0x97, 0x2C, 0x97, 0x17, 0x14, 0x70, 0xB2, 0x59, 0x2E, 0x58, 0xE5, 0xC6, 0x02, 0x04, 0x20,
+        0x0F, 0xFF, 0xFF, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x50, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x30, 0x40, 0x08, 0x30, 0x82, 0x0C, 0x20, 0x83,
+        0x19, 0x16, 0x4B, 0x1C, 0x59, 0x14, 0x71, 0x71, 0x71, 0x71, 0x25, 0x90, 0x6C, 0x96, 0x4B, 0x22,
+        0xE2, 0xE2, 0x2C, 0x8B, 0x25, 0x92, 0xC7, 0x10, 0x65, 0x92, 0xC9, 0x64, 0xB2, 0x2E, 0x0A, 0xE2,
+        0xE2, 0x00, 0x02, 0xCF, 0xFF, 0xEF, 0x62, 0xFF, 0xFF, 0x09, 0xC8, 0x01, 0x00, 0x02, 0x00, 0x00,
+        0x00, 0x00, 0x04, 0x00, 0x80, 0x03, 0x00, 0x10, 0x00, 0x40, 0x08, 0x00, 0x30, 0x02, 0x00, 0x0C,
+        0x00, 0x43, 0x2C, 0x4C, 0xB9, 0x63, 0x96, 0x00, 0xCB, 0x1C, 0xB1, 0x83, 0x96, 0x38, 0x28, 0x39,
+        0x63, 0x97, 0x29, 0x1C, 0x1B, 0x25, 0xCB, 0x1C, 0xB1, 0xC2, 0xC1, 0xB9, 0x2C, 0x07, 0x2C, 0x72,
+        0xE2, 0x2E, 0x58, 0x99, 0x72, 0xC7, 0x2C, 0x83, 0x72, 0xC7, 0x2C, 0x60, 0xE5, 0x8A, 0x10, 0x20,
+        0x00, 0x48, 0x31, 0x04, 0x83, 0x27, 0xFF, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x10, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xCE, 0x32, 0x00, 0x64, 0x08, 0x86, 0x40, 0x0D, 0xC4,
+        0x21, 0x71, 0x70, 0xB8, 0x88, 0x04, 0xB8, 0x5C, 0x5C, 0x2E, 0x0B, 0x2E, 0x17, 0x10, 0x85, 0xC5,
+        0x18, 0x4B, 0x85, 0xC6, 0x5C, 0x2E, 0x22, 0xE1, 0x71, 0x97, 0x0B, 0x88, 0xE0, 0xAE, 0x05, 0x92,
+        0xE1, 0x71, 0x94, 0x70, 0xB8, 0xB8, 0x5C, 0x65, 0x84, 0x1B, 0x85, 0xC5, 0xC0, 0xB2, 0x5C, 0x06,
+        0xE3, 0x2E, 0x17, 0x11, 0x92, 0xE0, 0x23, 0x77, 0x9D, 0xE8, 0xCE, 0x0D, 0xBB, 0xCE, 0xF4, 0x1B,
+        0xBC, 0x1B, 0x25, 0xC1, 0x09, 0x70, 0xB8, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+        0x60, 0x02, 0x7F, 0x82, 0x6D, 0xFD, 0xFF, 0xD0, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x14,
+        0x98, 0x00, 0x00, 0x04, 0x00, 0x30, 0x01, 0x00, 0x08, 0x00, 0x60, 0x02, 0x00, 0x10, 0x00, 0xC0,
+        0x04, 0x00, 0x20, 0x00, 0x80, 0x04, 0x00, 0x82, 0xB8, 0xB8, 0xB8, 0x92, 0xC7, 0x05, 0x71, 0x64,
+        0x59, 0x2C, 0x96, 0x0C, 0x5C, 0x5C, 0x5C, 0x5C, 0x48, 0x36, 0x4B, 0x25, 0x92, 0xC8, 0xB2, 0x0D,
+        0x8E, 0x2C, 0x8B, 0x8B, 0x8A, 0xA2, 0x02, 0x00, 0x5F, 0xFF, 0xFE, 0xA0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0,
+        0x00, 0x00, 0x01, 0x4E, 0xDC, 0x00, 0x40, 0x01, 0x40, 0x02, 0xFF, 0x0A, 0x5B, 0xF3, 0xB7, 0x40,
+        0x02, 0xCF, 0xFF, 0xEF, 0x46, 0xFF, 0xFF, 0x0B, 0x48, 0x00, 0x40, 0x04, 0x00, 0x10, 0x01, 0x00,
+        0x04, 0x00, 0x40, 0x01, 0x00, 0x10, 0x00, 0x40, 0x04, 0x00, 0x10, 0x01, 0x00, 0x04, 0x00, 0x42,
+        0xB8, 0xC6, 0x31, 0x8C, 0x62, 0x32, 0xE3, 0x18, 0xC5, 0xC6, 0x30, 0x2D, 0x5E, 0xB5, 0x96, 0xB5,
+        0x85, 0x8C, 0xB2, 0x31, 0x8C, 0x62, 0x1A, 0xD6, 0xED, 0x96, 0xB5, 0xA1, 0x71, 0x8C, 0x62, 0xE3,
+        0x18, 0xA8, 0x40, 0x84, 0x08, 0x40, 0x84, 0x07, 0xFF, 0xFC, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x7F,
+        0xFF, 0xFE, 0xD1, 0x04, 0x24, 0x08, 0x44, 0x21, 0x88, 0x43, 0x19, 0x2C, 0x96, 0x4B, 0x1C, 0xDE,
+        0x28, 0xE2, 0xE2, 0xC9, 0x64, 0xB2, 0x58, 0x32, 0xC9, 0x60, 0xC9, 0x64, 0xB2, 0x0D, 0x8E, 0x2E,
+        0x2E, 0x2E, 0x2C, 0x16, 0x4B, 0x25, 0x92, 0xC9, 0x60, 0x08, 0x4B, 0x25, 0x93, 0x66, 0x2E, 0x22,
+        0xE2, 0xE2, 0xC9, 0x64, 0xB2, 0x50, 0xDB, 0xB5, 0x80, 0x6E, 0xC3, 0x2C, 0x71, 0x71, 0x71, 0x63,
+        0x82, 0xB2, 0x59, 0x2C, 0x96, 0x4B, 0x1D, 0x00, 0x10, 0x00, 0x10, 0x00, 0x40, 0x04, 0x00, 0x04,
+        0x00, 0x0F, 0xF0, 0x5B, 0x3F, 0xBF, 0xFA, 0x02, 0xCF, 0xFF, 0xEF, 0xE2, 0xFF, 0xFF, 0x06, 0xE8,
+        0x00, 0x00, 0x02, 0x00, 0x20, 0x00, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x18, 0x01, 0x00, 0x02,
+        0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x21, 0x91, 0x96, 0x58, 0xEC, 0x18, 0xB7, 0x79, 0x64, 0x60,
+        0x59, 0x63, 0xB6, 0x2C, 0x83, 0x3B, 0xD6, 0x59, 0xDE, 0xB0, 0x1D, 0xB1, 0x65, 0x9D, 0xEB, 0x02,
+        0xC5, 0x78, 0xB2, 0xCE, 0x0F, 0x5B, 0xBC, 0xB2, 0xC5, 0x78, 0x0B, 0x2C, 0x8C, 0xB0, 0x16, 0x77,
+        0xA3, 0x2C, 0xB0, 0x23, 0x2C, 0x5B, 0xBC, 0x83, 0x2C, 0xB7, 0x79, 0xDE, 0xB2, 0x0C, 0x5B, 0xBC,
+        0xB2, 0xCB, 0x07, 0x79, 0x62, 0xC8, 0xDD, 0xE0, 0x59, 0x65, 0xBB, 0xCB, 0x01, 0x67, 0x7A, 0xCB,
+        0x2C, 0xEF, 0x18, 0x90, 0x07, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0xE2, 0x24, 0x24, 0x28, 0x22, 0x01,
+        0xAD, 0x6B, 0x6E, 0x6B, 0x5A, 0x19, 0x2C, 0x48, 0xC6, 0x4B, 0x18, 0x13, 0x5B, 0x76, 0xB5, 0xA6,
+        0xC3, 0x63, 0x18, 0x92, 0x58, 0xC6, 0x0B, 0x1C, 0xB1, 0x8C, 0x63, 0x96, 0x0B, 0x18, 0xE2, 0x92,
+        0x58, 0xC4, 0x63, 0x1C, 0xB1, 0x8C, 0x63, 0x94, 0x63, 0x18, 0xC7, 0x2C, 0x63, 0x10, 0xD7, 0xA9,
+        0xAD, 0x6B, 0xD4, 0x0D, 0x6B, 0x5E, 0xAD, 0x35, 0xA1, 0xC5, 0x8C, 0x48, 0xE2, 0xC6, 0x05, 0xA6,
+        0xDD, 0xB7, 0x69, 0xAC, 0x2C, 0x96, 0x31, 0x23, 0x25, 0x88, 0x69, 0xAD, 0xBB, 0x5A, 0xD3, 0x0C,
+        0xB1, 0x8C, 0x63, 0x96, 0x31, 0x18, 0xC7, 0x2C, 0x63, 0x18, 0xE5, 0x0D, 0x6B, 0x5A, 0xF5, 0x35,
+        0xAD, 0x00, 0x08, 0x00, 0x10, 0x01, 0x00, 0x01, 0x00, 0x04, 0x00, 0x2F, 0xF0, 0x38, 0x3F, 0xBF,
+        0xFA, 0x02, 0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x09, 0xA8, 0x00, 0xC0, 0x08, 0x00, 0x00, 0x00,
+        0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x18, 0x01, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x04, 0x00,
+        0x00, 0xCE, 0xF5, 0x79, 0xDE, 0x80, 0x65, 0xC2, 0xE2, 0xE0, 0x84, 0xB8, 0x0E, 0xF4, 0x67, 0x7A,
+        0xB3, 0x70, 0xE1, 0x71, 0x97, 0x0B, 0x8B, 0x80, 0x36, 0x4B, 0x85, 0xC4, 0x71, 0x97, 0x04, 0xB2,
+        0x5C, 0x2E, 0x32, 0xE1, 0x70, 0x57, 0x02, 0xC9, 0x61, 0x2E, 0x14, 0x71, 0x97, 0x0B, 0x25, 0xC2,
+        0xE3, 0x06, 0xE1, 0x71, 0x19, 0x2E, 0x08, 0x0C, 0xB8, 0x5C, 0x65, 0xC2, 0xC9, 0x70, 0x1D, 0xE8,
+        0x37, 0x79, 0xDB, 0x70, 0xE0, 0x84, 0xB8, 0x5C, 0x65, 0xC1, 0x06, 0x4F, 0xFF, 0xFE, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x28, 0x00, 0x01, 0xFF, 0xFF, 0xE7, 0x82, 0x08, 0x81, 0x80, 0x20, 0x60, 0x08, 0x08, 0x22,
+        0x0D, 0x0C, 0xB1, 0xCA, 0x40, 0x72, 0x83, 0xDD, 0x8B, 0xDC, 0xF7, 0x62, 0x1C, 0xA6, 0x58, 0x0E,
+        0x53, 0x2C, 0x43, 0xDC, 0xC5, 0xEE, 0x62, 0xF7, 0x09, 0x94, 0xC5, 0xCA, 0x65, 0x32, 0xCD, 0x00,
+        0x08, 0x00, 0x30, 0x00, 0x00, 0x04, 0x00, 0x0C, 0x00, 0x0F, 0xF0, 0x4F, 0x3F, 0xBD, 0x4E, 0x02,
+        0xCF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x06, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x04,
+        0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x42, 0x5C,
+        0x19, 0x70, 0x2E, 0x30, 0xA1, 0xE4, 0x63, 0xBD, 0x6E, 0xF0, 0x11, 0x9D, 0xE5, 0xBB, 0xC7, 0x78,
+        0x2C, 0xEF, 0x23, 0x1D, 0xEB, 0x0D, 0xC0, 0xB8, 0xCB, 0x81, 0x71, 0x81, 0xDE, 0x3B, 0xD6, 0x77,
+        0x91, 0x81, 0xDE, 0x46, 0x77, 0x91, 0x84, 0xB8, 0x32, 0xE0, 0x5C, 0x61, 0x43, 0xC8, 0xC7, 0x7A,
+        0xDD, 0xE0, 0x23, 0x3B, 0xCB, 0x77, 0x8E, 0xF0, 0x59, 0xDE, 0x46, 0x3B, 0xD6, 0x0E, 0xF1, 0x19,
+        0xDE, 0x46, 0x03, 0xBD, 0x6E, 0xF1, 0x19, 0xC3, 0x83, 0x2E, 0x05, 0xC6, 0x5C, 0x01, 0xB8, 0xCB,
+        0x81, 0x71, 0x97, 0x00, 0x6E, 0x32, 0xE0, 0x5C, 0x65, 0xC0, 0x08, 0xCE, 0xF2, 0xDD, 0xE3, 0xBC,
+        0x62, 0x40, 0x68, 0x02, 0x00, 0x40, 0x1F, 0xFF, 0xFF, 0xFC, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x00, 0x02, 0x9A, 0xF8, 0x00,
+        0x80, 0x01, 0x80, 0x01, 0xFE, 0x06, 0xE7, 0xE6, 0xBD, 0x80, 0x02, 0xC0, 0x00, 0x00, 0x03, 0xFF,
+        0xFB, 0xD8, 0xBF, 0xFF, 0xC7, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+        0x01, 0x40, 0x08, 0x00, 0x20, 0x00, 0x80, 0x00, 0x00, 0x00, 0x58, 0xDF, 0x7B, 0x5D, 0xFA, 0x00,
+        0x6F, 0xBD, 0xA0, 0xB0, 0xC0, 0x80, 0x83, 0x0C, 0x04, 0x00, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00,
+        0x17, 0xFF, 0xFC, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x03,
+        0xFF, 0xFF, 0xFF, 0xE9, 0x82, 0x00, 0x00, 0x04, 0x08, 0x00, 0x02, 0x10, 0x00, 0x03, 0xDC, 0x2C,
+        0xD1, 0xA0, 0x77, 0xBD, 0xC0, 0x0D, 0x00, 0x00, 0x0D, 0x00, 0x0F, 0x00, 0x02, 0xCF, 0xFF, 0xEF,
+        0xFE, 0xFF, 0xFF, 0x07, 0x38, 0x00, 0x40, 0x00, 0x00, 0x40, 0x01, 0x80, 0x00, 0x00, 0x80, 0x03,
+        0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x81, 0xCF, 0x73, 0x2D, 0x64,
+        0xF7, 0x03, 0xDC, 0x7B, 0x8D, 0x64, 0xF0, 0xD0, 0xCA, 0x65, 0x0C, 0xA1, 0x94, 0x1E, 0xE6, 0x5A,
+        0xCB, 0x20, 0x19, 0x65, 0xAC, 0x9E, 0xE0, 0x64, 0xF7, 0x1E, 0xE3, 0xDC, 0x0F, 0x73, 0x2D, 0x1E,
+        0xE3, 0xDC, 0x0C, 0xB2, 0xD6, 0x4C, 0x83, 0x27, 0xB8, 0xF7, 0x3D, 0xC7, 0x87, 0x66, 0x53, 0x28,
+        0x65, 0x0C, 0xA0, 0x65, 0x96, 0xB2, 0x65, 0x84, 0x4C, 0xA1, 0x9B, 0x8C, 0x60, 0x89, 0x94, 0xCA,
+        0x19, 0x43, 0x29, 0x81, 0xCC, 0xB5, 0x96, 0xB5, 0x83, 0xBE, 0x53, 0x29, 0x06, 0x30, 0x41, 0xCA,
+        0x65, 0x0C, 0xA1, 0x94, 0xCA, 0x60, 0x40, 0x24, 0x24, 0x1F, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF5, 0xC3,
+        0x08, 0x2C, 0xB2, 0xD3, 0x2D, 0x61, 0x1C, 0x58, 0xBC, 0x58, 0xC1, 0x18, 0x24, 0x60, 0xC6, 0x4D,
+        0xE2, 0x3B, 0xC9, 0xBC, 0x58, 0xC1, 0x89, 0x04, 0x60, 0xC6, 0x4D, 0x91, 0x93, 0x74, 0x00, 0x60,
+        0x00, 0x40, 0x01, 0x00, 0x08, 0x00, 0x10, 0x00, 0xBF, 0xC0, 0xE8, 0xFE, 0xF0, 0x68, 0x00, 0x00,
+        0x00, 0x00
+    };
+
+    static const AKWFTableRef tables[count] PROGMEM = {
+        { data +      0, 600 },   //   0 AKWF_gapsaw_0001
+        { data +    262, 600 },   //   1 AKWF_gapsaw_0002
+        { data +    528, 600 },   //   2 AKWF_gapsaw_0003
+        { data +    787, 600 },   //   3 AKWF_gapsaw_0004
+        { data +   1056, 600 },   //   4 AKWF_gapsaw_0005
+        { data +   1299, 600 },   //   5 AKWF_gapsaw_0006
+        { data +   1555, 600 },   //   6 AKWF_gapsaw_0007
+        { data +   1825, 600 },   //   7 AKWF_gapsaw_0008
+        { data +   2080, 600 },   //   8 AKWF_gapsaw_0009
+        { data +   2324, 600 },   //   9 AKWF_gapsaw_0010
+        { data +   2569, 600 },   //  10 AKWF_gapsaw_0011
+        { data +   2773, 600 },   //  11 AKWF_gapsaw_0012
+        { data +   3019, 600 },   //  12 AKWF_gapsaw_0013
+        { data +   3249, 600 },   //  13 AKWF_gapsaw_0014
+        { data +   3471, 600 },   //  14 AKWF_gapsaw_0015
+        { data +   3687, 600 },   //  15 AKWF_gapsaw_0016
+        { data +   3921, 600 },   //  16 AKWF_gapsaw_0017
+        { data +   4126, 600 },   //  17 AKWF_gapsaw_0018
+        { data +   4330, 600 },   //  18 AKWF_gapsaw_0019
+        { data +   4522, 600 },   //  19 AKWF_gapsaw_0020
+        { data +   4729, 600 },   //  20 AKWF_gapsaw_0021
+        { data +   4927, 600 },   //  21 AKWF_gapsaw_0022
+        { data +   5123, 600 },   //  22 AKWF_gapsaw_0023
+        { data +   5316, 600 },   //  23 AKWF_gapsaw_0024
+        { data +   5490, 600 },   //  24 AKWF_gapsaw_0025
+        { data +   5665, 600 },   //  25 AKWF_gapsaw_0026
+        { data +   5842, 600 },   //  26 AKWF_gapsaw_0027
+        { data +   6021, 600 },   //  27 AKWF_gapsaw_0028
+        { data +   6195, 600 },   //  28 AKWF_gapsaw_0029
+        { data +   6368, 600 },   //  29 AKWF_gapsaw_0030
+        { data +   6526, 600 },   //  30 AKWF_gapsaw_0031
+        { data +   6663, 600 },   //  31 AKWF_gapsaw_0032
+        { data +   6830, 600 },   //  32 AKWF_gapsaw_0033
+        { data +   7024, 600 },   //  33 AKWF_gapsaw_0034
+        { data +   7202, 600 },   //  34 AKWF_gapsaw_0035
+        { data +   7432, 600 },   //  35 AKWF_gapsaw_0036
+        { data +   7600, 600 },   //  36 AKWF_gapsaw_0037
+        { data +   7815, 600 },   //  37 AKWF_gapsaw_0038
+        { data +   8065, 600 },   //  38 AKWF_gapsaw_0039
+        { data +   8287, 600 },   //  39 AKWF_gapsaw_0040
+        { data +   8490, 600 },   //  40 AKWF_gapsaw_0041
+        { data +   8652, 600 }    //  41 AKWF_gapsaw_0042
+    };
+
+} // namespace AKWF_BwSawgap
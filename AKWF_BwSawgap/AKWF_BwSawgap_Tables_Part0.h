@@ -1,1304 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwSawgap {
-
-    // AKWF_gapsaw_0001 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0001[600] PROGMEM = {
-        32767, 32658, 32549, 32440, 32329, 32220, 32110, 32001, 31891, 31781, 31672, 31563, 
-        31453, 31343, 31233, 31124, 31015, 30904, 30795, 30686, 30576, 30467, 30356, 30247, 
-        30138, 30029, 29918, 29809, 29699, 29590, 29481, 29370, 29261, 29152, 29042, 28932, 
-        28822, 28713, 28604, 28495, 28384, 28275, 28165, 28056, 27945, 27836, 27727, 27618, 
-        27508, 27398, 27288, 27179, 27070, 26959, 26850, 26741, 26631, 26522, 26411, 26302, 
-        26193, 26084, 25973, 25864, 25754, 25645, 25536, 25425, 25316, 25207, 25097, 24987, 
-        24877, 24768, 24659, 24550, 24439, 24330, 24220, 24111, 24000, 23891, 23782, 23673, 
-        23562, 23453, 23343, 23234, 23123, 23014, 22905, 22796, 22685, 22576, 22466, 22357, 
-        22246, 22137, 22028, 21919, 21808, 21699, 21589, 21480, 21371, 21260, 21151, 21042, 
-        20932, 20822, 20712, 20603, 20494, 20383, 20274, 20165, 20055, 19945, 19835, 19726, 
-        19617, 19506, 19397, 19288, 19178, 19068, 18958, 18849, 18740, 18629, 18520, 18411, 
-        18301, 18192, 18081, 17972, 17863, 17754, 17643, 17534, 17424, 17315, 17206, 17095, 
-        16986, 16877, 16767, 16657, 16547, 16438, 16329, 16220, 16109, 16000, 15890, 15781, 
-        15670, 15561, 15452, 15343, 15233, 15123, 15013, 14904, 14795, 14684, 14575, 14466, 
-        14356, 14247, 14136, 14027, 13918, 13809, 13698, 13589, 13479, 13370, 13261, 13150, 
-        13041, 12932, 12822, 12712, 12602, 12493, 12384, 12275, 12164, 12055, 11945, 11836, 
-        11725, 11616, 11507, 11398, 11288, 11178, 11068, 10959, 10850, 10739, 10630, 10521, 
-        10411, 10301, 10191, 10082, 9973, 9864, 9753, 9644, 9534, 9425, 9314, 9205, 
-        9096, 8987, 8877, 8767, 8657, 8548, 8439, 8328, 8219, 8110, 8000, 7891, 
-        7780, 7671, 7562, 7453, 7342, 7233, 7123, 7014, 6903, 6794, 6685, 6576, 
-        6465, 6356, 6246, 6137, 6026, 5917, 5808, 5699, 5588, 5479, 5369, 5260, 
-        5149, 5040, 4931, 4822, 4711, 4602, 4492, 4383, 4272, 4163, 4054, 3945, 
-        3834, 3725, 3615, 3506, 3395, 3286, 3177, 3068, 2958, 2848, 2738, 2629, 
-        2520, 2409, 2300, 2191, 2081, 1972, 1861, 1752, 1643, 1534, 1423, 1314, 
-        1204, 1095, 986, 875, 766, 657, 547, 437, 327, 218, 109, -109, 
-        -218, -327, -437, -547, -657, -766, -875, -986, -1095, -1204, -1314, -1423, 
-        -1534, -1643, -1752, -1861, -1972, -2081, -2191, -2300, -2409, -2520, -2629, -2738, 
-        -2848, -2958, -3068, -3177, -3286, -3395, -3506, -3615, -3725, -3834, -3945, -4054, 
-        -4163, -4272, -4383, -4492, -4602, -4711, -4822, -4931, -5040, -5149, -5260, -5369, 
-        -5479, -5588, -5699, -5808, -5917, -6026, -6137, -6246, -6356, -6465, -6576, -6685, 
-        -6794, -6903, -7014, -7123, -7233, -7342, -7453, -7562, -7671, -7780, -7891, -8000, 
-        -8110, -8219, -8328, -8439, -8548, -8657, -8767, -8877, -8987, -9096, -9205, -9314, 
-        -9425, -9534, -9644, -9753, -9864, -9973, -10082, -10191, -10301, -10411, -10521, -10630, 
-        -10739, -10850, -10959, -11068, -11178, -11288, -11398, -11507, -11616, -11725, -11836, -11945, 
-        -12055, -12164, -12275, -12384, -12493, -12602, -12712, -12822, -12932, -13041, -13150, -13261, 
-        -13370, -13479, -13589, -13698, -13809, -13918, -14027, -14136, -14247, -14356, -14466, -14575, 
-        -14684, -14795, -14904, -15013, -15123, -15233, -15343, -15452, -15561, -15670, -15781, -15890, 
-        -16000, -16109, -16220, -16329, -16438, -16547, -16657, -16767, -16877, -16986, -17095, -17206, 
-        -17315, -17424, -17534, -17643, -17754, -17863, -17972, -18081, -18192, -18301, -18411, -18520, 
-        -18629, -18740, -18849, -18958, -19068, -19178, -19288, -19397, -19506, -19617, -19726, -19835, 
-        -19945, -20055, -20165, -20274, -20383, -20494, -20603, -20712, -20822, -20932, -21042, -21151, 
-        -21260, -21371, -21480, -21589, -21699, -21808, -21919, -22028, -22137, -22246, -22357, -22466, 
-        -22576, -22685, -22796, -22905, -23014, -23123, -23234, -23343, -23453, -23562, -23673, -23782, 
-        -23891, -24000, -24111, -24220, -24330, -24439, -24550, -24659, -24768, -24877, -24987, -25097, 
-        -25207, -25316, -25425, -25536, -25645, -25754, -25864, -25973, -26084, -26193, -26302, -26411, 
-        -26522, -26631, -26741, -26850, -26959, -27070, -27179, -27288, -27398, -27508, -27618, -27727, 
-        -27836, -27945, -28056, -28165, -28275, -28384, -28495, -28604, -28713, -28822, -28932, -29042, 
-        -29152, -29261, -29370, -29481, -29590, -29699, -29809, -29918, -30029, -30138, -30247, -30356, 
-        -30467, -30576, -30686, -30795, -30904, -31015, -31124, -31233, -31343, -31453, -31563, -31672, 
-        -31781, -31891, -32001, -32110, -32220, -32329, -32440, -32549, -32658, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0002 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0002[600] PROGMEM = {
-        32767, 32654, 32540, 32427, 32315, 32201, 32088, 31974, 31861, 31747, 31634, 31520, 
-        31406, 31293, 31181, 31067, 30954, 30840, 30727, 30613, 30500, 30386, 30273, 30159, 
-        30047, 29933, 29820, 29706, 29593, 29479, 29366, 29252, 29139, 29025, 28913, 28799, 
-        28686, 28572, 28459, 28345, 28232, 28118, 28005, 27891, 27779, 27665, 27552, 27438, 
-        27325, 27211, 27098, 26984, 26871, 26757, 26645, 26532, 26418, 26304, 26191, 26077, 
-        25964, 25850, 25737, 25623, 25511, 25398, 25284, 25171, 25057, 24943, 24830, 24716, 
-        24603, 24489, 24377, 24264, 24150, 24037, 23923, 23809, 23696, 23582, 23469, 23355, 
-        23243, 23130, 23016, 22903, 22789, 22676, 22562, 22448, 22335, 22221, 22109, 21996, 
-        21882, 21770, 21657, 21543, 21429, 21316, 21202, 21089, 20975, 20862, 20748, 20635, 
-        20523, 20409, 20296, 20182, 20068, 19955, 19841, 19728, 19614, 19501, 19389, 19275, 
-        19162, 19048, 18935, 18821, 18707, 18594, 18480, 18367, 18255, 18141, 18028, 17914, 
-        17801, 17687, 17574, 17460, 17346, 17233, 17121, 17007, 16894, 16780, 16667, 16553, 
-        16440, 16326, 16212, 16099, 15987, 15873, 15760, 15646, 15533, 15419, 15306, 15192, 
-        15079, 14965, 14853, 14739, 14626, 14512, 14399, 14285, 14172, 14058, 13945, 13831, 
-        13719, 13605, 13492, 13378, 13265, 13151, 13038, 12924, 12811, 12697, 12585, 12471, 
-        12358, 12244, 12131, 12017, 11904, 11790, 11677, 11563, 11451, 11338, 11224, 11110, 
-        10997, 10885, 10771, 10658, 10544, 10431, 10317, 10204, 10090, 9978, 9864, 9751, 
-        9637, 9524, 9410, 9297, 9183, 9070, 8956, 8844, 8730, 8617, 8503, 8390, 
-        8276, 8163, 8049, 7936, 7822, 7710, 7597, 7483, 7369, 7256, 7142, 7029, 
-        6915, 6802, 6688, 6576, 6463, 6349, 6235, 6122, 6008, 5895, 5781, 5668, 
-        5554, 5442, 5329, 5215, 5102, 4988, 4874, 4761, 4647, 4534, 4420, 4308, 
-        4195, 4081, 3968, 3854, 3741, 3627, 3513, 3400, 3286, 3174, 3061, 2947, 
-        2834, 2720, 2607, 2493, 2380, 2266, 2152, 2040, 1927, 1813, 1700, 1586, 
-        1473, 1359, 1246, 1132, 1018, 905, 793, 679, 566, 452, 339, 225, 
-        112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, -112, -225, -339, 
-        -452, -566, -679, -793, -905, -1018, -1132, -1246, -1359, -1473, -1586, -1700, 
-        -1813, -1927, -2040, -2152, -2266, -2380, -2493, -2607, -2720, -2834, -2947, -3061, 
-        -3174, -3286, -3400, -3513, -3627, -3741, -3854, -3968, -4081, -4195, -4308, -4420, 
-        -4534, -4647, -4761, -4874, -4988, -5102, -5215, -5329, -5442, -5554, -5668, -5781, 
-        -5895, -6008, -6122, -6235, -6349, -6463, -6576, -6688, -6802, -6915, -7029, -7142, 
-        -7256, -7369, -7483, -7597, -7710, -7822, -7936, -8049, -8163, -8276, -8390, -8503, 
-        -8617, -8730, -8844, -8956, -9070, -9183, -9297, -9410, -9524, -9637, -9751, -9864, 
-        -9978, -10090, -10204, -10317, -10431, -10544, -10658, -10771, -10885, -10997, -11110, -11224, 
-        -11338, -11451, -11563, -11677, -11790, -11904, -12017, -12131, -12244, -12358, -12471, -12585, 
-        -12697, -12811, -12924, -13038, -13151, -13265, -13378, -13492, -13605, -13719, -13831, -13945, 
-        -14058, -14172, -14285, -14399, -14512, -14626, -14739, -14853, -14965, -15079, -15192, -15306, 
-        -15419, -15533, -15646, -15760, -15873, -15987, -16099, -16212, -16326, -16440, -16553, -16667, 
-        -16780, -16894, -17007, -17121, -17233, -17346, -17460, -17574, -17687, -17801, -17914, -18028, 
-        -18141, -18255, -18367, -18480, -18594, -18707, -18821, -18935, -19048, -19162, -19275, -19389, 
-        -19501, -19614, -19728, -19841, -19955, -20068, -20182, -20296, -20409, -20523, -20635, -20748, 
-        -20862, -20975, -21089, -21202, -21316, -21429, -21543, -21657, -21770, -21882, -21996, -22109, 
-        -22221, -22335, -22448, -22562, -22676, -22789, -22903, -23016, -23130, -23243, -23355, -23469, 
-        -23582, -23696, -23809, -23923, -24037, -24150, -24264, -24377, -24489, -24603, -24716, -24830, 
-        -24943, -25057, -25171, -25284, -25398, -25511, -25623, -25737, -25850, -25964, -26077, -26191, 
-        -26304, -26418, -26532, -26645, -26757, -26871, -26984, -27098, -27211, -27325, -27438, -27552, 
-        -27665, -27779, -27891, -28005, -28118, -28232, -28345, -28459, -28572, -28686, -28799, -28913, 
-        -29025, -29139, -29252, -29366, -29479, -29593, -29706, -29820, -29933, -30047, -30159, -30273, 
-        -30386, -30500, -30613, -30727, -30840, -30954, -31067, -31181, -31293, -31406, -31520, -31634, 
-        -31747, -31861, -31974, -32088, -32201, -32315, -32427, -32540, -32654, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0003 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0003[600] PROGMEM = {
-        32767, 32650, 32532, 32414, 32298, 32180, 32062, 31946, 31828, 31710, 31592, 31476, 
-        31358, 31240, 31122, 31006, 30888, 30770, 30654, 30536, 30418, 30301, 30184, 30066, 
-        29949, 29831, 29714, 29597, 29479, 29361, 29245, 29127, 29009, 28893, 28775, 28657, 
-        28539, 28423, 28305, 28187, 28069, 27952, 27834, 27717, 27600, 27482, 27364, 27248, 
-        27130, 27012, 26894, 26778, 26660, 26542, 26426, 26308, 26190, 26072, 25956, 25838, 
-        25720, 25602, 25486, 25368, 25250, 25134, 25016, 24898, 24781, 24664, 24546, 24429, 
-        24311, 24194, 24077, 23959, 23842, 23725, 23607, 23489, 23371, 23253, 23136, 23019, 
-        22901, 22784, 22667, 22549, 22432, 22314, 22197, 22080, 21962, 21844, 21728, 21610, 
-        21492, 21375, 21258, 21140, 21022, 20906, 20788, 20670, 20552, 20436, 20318, 20200, 
-        20082, 19966, 19848, 19730, 19614, 19496, 19378, 19261, 19144, 19026, 18909, 18791, 
-        18673, 18555, 18439, 18321, 18203, 18085, 17969, 17851, 17733, 17616, 17499, 17381, 
-        17264, 17147, 17029, 16912, 16794, 16677, 16560, 16442, 16324, 16207, 16090, 15972, 
-        15855, 15738, 15620, 15502, 15386, 15268, 15150, 15032, 14916, 14798, 14680, 14564, 
-        14446, 14328, 14210, 14094, 13975, 13857, 13741, 13623, 13505, 13389, 13271, 13153, 
-        13035, 12919, 12801, 12683, 12565, 12449, 12331, 12213, 12096, 11979, 11861, 11744, 
-        11627, 11509, 11392, 11274, 11157, 11040, 10922, 10804, 10687, 10570, 10452, 10335, 
-        10218, 10100, 9982, 9866, 9748, 9630, 9512, 9396, 9277, 9160, 9042, 8925, 
-        8807, 8690, 8573, 8455, 8337, 8221, 8103, 7985, 7869, 7751, 7633, 7515, 
-        7399, 7281, 7163, 7045, 6929, 6811, 6693, 6577, 6459, 6341, 6224, 6107, 
-        5989, 5872, 5754, 5637, 5520, 5402, 5285, 5167, 5050, 4932, 4815, 4698, 
-        4578, 4462, 4344, 4226, 4110, 3992, 3874, 3757, 3640, 3522, 3405, 3287, 
-        3170, 3053, 2935, 2817, 2701, 2583, 2465, 2349, 2231, 2113, 1995, 1879, 
-        1761, 1643, 1525, 1409, 1291, 1173, 1057, 939, 821, 704, 587, 469, 
-        352, 234, 117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, -117, -234, -352, -469, -587, 
-        -704, -821, -939, -1057, -1173, -1291, -1409, -1525, -1643, -1761, -1879, -1995, 
-        -2113, -2231, -2349, -2465, -2583, -2701, -2817, -2935, -3053, -3170, -3287, -3405, 
-        -3522, -3640, -3757, -3874, -3992, -4110, -4226, -4344, -4462, -4578, -4698, -4815, 
-        -4932, -5050, -5167, -5285, -5402, -5520, -5637, -5754, -5872, -5989, -6107, -6224, 
-        -6341, -6459, -6577, -6693, -6811, -6929, -7045, -7163, -7281, -7399, -7515, -7633, 
-        -7751, -7869, -7985, -8103, -8221, -8337, -8455, -8573, -8690, -8807, -8925, -9042, 
-        -9160, -9277, -9396, -9512, -9630, -9748, -9866, -9982, -10100, -10218, -10335, -10452, 
-        -10570, -10687, -10804, -10922, -11040, -11157, -11274, -11392, -11509, -11627, -11744, -11861, 
-        -11979, -12096, -12213, -12331, -12449, -12565, -12683, -12801, -12919, -13035, -13153, -13271, 
-        -13389, -13505, -13623, -13741, -13857, -13975, -14094, -14210, -14328, -14446, -14564, -14680, 
-        -14798, -14916, -15032, -15150, -15268, -15386, -15502, -15620, -15738, -15855, -15972, -16090, 
-        -16207, -16324, -16442, -16560, -16677, -16794, -16912, -17029, -17147, -17264, -17381, -17499, 
-        -17616, -17733, -17851, -17969, -18085, -18203, -18321, -18439, -18555, -18673, -18791, -18909, 
-        -19026, -19144, -19261, -19378, -19496, -19614, -19730, -19848, -19966, -20082, -20200, -20318, 
-        -20436, -20552, -20670, -20788, -20906, -21022, -21140, -21258, -21375, -21492, -21610, -21728, 
-        -21844, -21962, -22080, -22197, -22314, -22432, -22549, -22667, -22784, -22901, -23019, -23136, 
-        -23253, -23371, -23489, -23607, -23725, -23842, -23959, -24077, -24194, -24311, -24429, -24546, 
-        -24664, -24781, -24898, -25016, -25134, -25250, -25368, -25486, -25602, -25720, -25838, -25956, 
-        -26072, -26190, -26308, -26426, -26542, -26660, -26778, -26894, -27012, -27130, -27248, -27364, 
-        -27482, -27600, -27717, -27834, -27952, -28069, -28187, -28305, -28423, -28539, -28657, -28775, 
-        -28893, -29009, -29127, -29245, -29361, -29479, -29597, -29714, -29831, -29949, -30066, -30184, 
-        -30301, -30418, -30536, -30654, -30770, -30888, -31006, -31122, -31240, -31358, -31476, -31592, 
-        -31710, -31828, -31946, -32062, -32180, -32298, -32414, -32532, -32650, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0004 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0004[600] PROGMEM = {
-        32767, 32645, 32523, 32401, 32281, 32159, 32036, 31914, 31792, 31672, 31550, 31427, 
-        31305, 31183, 31061, 30941, 30818, 30696, 30576, 30452, 30332, 30209, 30087, 29965, 
-        29845, 29721, 29600, 29478, 29356, 29236, 29112, 28991, 28869, 28747, 28625, 28505, 
-        28382, 28260, 28138, 28016, 27896, 27772, 27651, 27529, 27407, 27285, 27164, 27042, 
-        26920, 26798, 26676, 26555, 26432, 26311, 26189, 26067, 25945, 25824, 25702, 25580, 
-        25460, 25336, 25215, 25093, 24971, 24849, 24727, 24605, 24484, 24362, 24240, 24119, 
-        23996, 23875, 23753, 23631, 23509, 23387, 23266, 23144, 23022, 22900, 22779, 22656, 
-        22535, 22413, 22291, 22169, 22048, 21926, 21804, 21682, 21560, 21439, 21316, 21195, 
-        21073, 20951, 20829, 20708, 20586, 20464, 20342, 20220, 20099, 19976, 19855, 19733, 
-        19611, 19489, 19368, 19246, 19124, 19003, 18880, 18759, 18636, 18515, 18393, 18271, 
-        18150, 18028, 17906, 17784, 17663, 17540, 17419, 17297, 17175, 17053, 16931, 16810, 
-        16688, 16566, 16444, 16323, 16200, 16079, 15957, 15835, 15713, 15591, 15470, 15348, 
-        15226, 15104, 14983, 14860, 14739, 14617, 14495, 14373, 14252, 14130, 14008, 13886, 
-        13764, 13643, 13520, 13399, 13277, 13155, 13034, 12912, 12790, 12668, 12547, 12424, 
-        12303, 12179, 12059, 11937, 11815, 11694, 11572, 11450, 11328, 11207, 11084, 10963, 
-        10841, 10719, 10597, 10475, 10354, 10232, 10110, 9988, 9867, 9743, 9623, 9501, 
-        9379, 9257, 9134, 9014, 8892, 8770, 8648, 8527, 8403, 8283, 8161, 8039, 
-        7916, 7794, 7674, 7552, 7430, 7307, 7187, 7063, 6943, 6821, 6698, 6578, 
-        6456, 6334, 6212, 6089, 5967, 5847, 5725, 5603, 5480, 5358, 5238, 5116, 
-        4994, 4871, 4751, 4627, 4507, 4385, 4262, 4140, 4018, 3898, 3776, 3653, 
-        3531, 3411, 3287, 3167, 3044, 2922, 2800, 2678, 2558, 2435, 2313, 2191, 
-        2071, 1947, 1826, 1704, 1582, 1462, 1338, 1217, 1095, 973, 851, 731, 
-        607, 486, 364, 242, 122, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, -122, -242, -364, -486, -607, -731, -851, 
-        -973, -1095, -1217, -1338, -1462, -1582, -1704, -1826, -1947, -2071, -2191, -2313, 
-        -2435, -2558, -2678, -2800, -2922, -3044, -3167, -3287, -3411, -3531, -3653, -3776, 
-        -3898, -4018, -4140, -4262, -4385, -4507, -4627, -4751, -4871, -4994, -5116, -5238, 
-        -5358, -5480, -5603, -5725, -5847, -5967, -6089, -6212, -6334, -6456, -6578, -6698, 
-        -6821, -6943, -7063, -7187, -7307, -7430, -7552, -7674, -7794, -7916, -8039, -8161, 
-        -8283, -8403, -8527, -8648, -8770, -8892, -9014, -9134, -9257, -9379, -9501, -9623, 
-        -9743, -9867, -9988, -10110, -10232, -10354, -10475, -10597, -10719, -10841, -10963, -11084, 
-        -11207, -11328, -11450, -11572, -11694, -11815, -11937, -12059, -12179, -12303, -12424, -12547, 
-        -12668, -12790, -12912, -13034, -13155, -13277, -13399, -13520, -13643, -13764, -13886, -14008, 
-        -14130, -14252, -14373, -14495, -14617, -14739, -14860, -14983, -15104, -15226, -15348, -15470, 
-        -15591, -15713, -15835, -15957, -16079, -16200, -16323, -16444, -16566, -16688, -16810, -16931, 
-        -17053, -17175, -17297, -17419, -17540, -17663, -17784, -17906, -18028, -18150, -18271, -18393, 
-        -18515, -18636, -18759, -18880, -19003, -19124, -19246, -19368, -19489, -19611, -19733, -19855, 
-        -19976, -20099, -20220, -20342, -20464, -20586, -20708, -20829, -20951, -21073, -21195, -21316, 
-        -21439, -21560, -21682, -21804, -21926, -22048, -22169, -22291, -22413, -22535, -22656, -22779, 
-        -22900, -23022, -23144, -23266, -23387, -23509, -23631, -23753, -23875, -23996, -24119, -24240, 
-        -24362, -24484, -24605, -24727, -24849, -24971, -25093, -25215, -25336, -25460, -25580, -25702, 
-        -25824, -25945, -26067, -26189, -26311, -26432, -26555, -26676, -26798, -26920, -27042, -27164, 
-        -27285, -27407, -27529, -27651, -27772, -27896, -28016, -28138, -28260, -28382, -28505, -28625, 
-        -28747, -28869, -28991, -29112, -29236, -29356, -29478, -29600, -29721, -29845, -29965, -30087, 
-        -30209, -30332, -30452, -30576, -30696, -30818, -30941, -31061, -31183, -31305, -31427, -31550, 
-        -31672, -31792, -31914, -32036, -32159, -32281, -32401, -32523, -32645, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0005 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0005[600] PROGMEM = {
-        32767, 32641, 32515, 32388, 32262, 32136, 32009, 31883, 31757, 31629, 31502, 31376, 
-        31250, 31123, 30997, 30871, 30744, 30618, 30492, 30364, 30237, 30111, 29985, 29858, 
-        29732, 29606, 29479, 29353, 29226, 29100, 28972, 28846, 28720, 28593, 28467, 28341, 
-        28214, 28086, 27960, 27834, 27707, 27581, 27455, 27328, 27200, 27074, 26948, 26821, 
-        26695, 26569, 26442, 26316, 26189, 26063, 25937, 25809, 25683, 25556, 25430, 25304, 
-        25177, 25051, 24924, 24798, 24672, 24545, 24418, 24291, 24165, 24038, 23912, 23786, 
-        23659, 23533, 23405, 23279, 23152, 23026, 22900, 22773, 22646, 22519, 22393, 22267, 
-        22140, 22014, 21887, 21761, 21635, 21508, 21382, 21254, 21128, 21001, 20875, 20749, 
-        20622, 20496, 20370, 20243, 20117, 19989, 19863, 19736, 19610, 19484, 19357, 19231, 
-        19105, 18978, 18852, 18724, 18598, 18471, 18345, 18217, 18091, 17964, 17838, 17712, 
-        17585, 17459, 17333, 17206, 17080, 16954, 16826, 16699, 16573, 16447, 16320, 16194, 
-        16068, 15941, 15815, 15689, 15562, 15434, 15308, 15182, 15055, 14929, 14803, 14676, 
-        14550, 14423, 14297, 14171, 14043, 13917, 13790, 13662, 13536, 13410, 13283, 13157, 
-        13031, 12904, 12778, 12652, 12525, 12399, 12271, 12145, 12018, 11892, 11766, 11639, 
-        11513, 11386, 11260, 11134, 11006, 10880, 10753, 10627, 10500, 10374, 10248, 10121, 
-        9995, 9869, 9742, 9615, 9488, 9362, 9234, 9108, 8981, 8855, 8729, 8602, 
-        8476, 8349, 8223, 8097, 7970, 7843, 7716, 7590, 7463, 7337, 7211, 7084, 
-        6958, 6832, 6705, 6579, 6451, 6325, 6198, 6072, 5946, 5819, 5693, 5567, 
-        5440, 5314, 5188, 5060, 4933, 4807, 4679, 4553, 4426, 4300, 4174, 4047, 
-        3921, 3795, 3668, 3542, 3416, 3288, 3161, 3035, 2909, 2782, 2656, 2530, 
-        2403, 2277, 2151, 2023, 1896, 1770, 1644, 1517, 1391, 1265, 1138, 1012, 
-        885, 759, 631, 505, 379, 252, 126, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, -126, -252, -379, -505, -631, -759, -885, -1012, -1138, 
-        -1265, -1391, -1517, -1644, -1770, -1896, -2023, -2151, -2277, -2403, -2530, -2656, 
-        -2782, -2909, -3035, -3161, -3288, -3416, -3542, -3668, -3795, -3921, -4047, -4174, 
-        -4300, -4426, -4553, -4679, -4807, -4933, -5060, -5188, -5314, -5440, -5567, -5693, 
-        -5819, -5946, -6072, -6198, -6325, -6451, -6579, -6705, -6832, -6958, -7084, -7211, 
-        -7337, -7463, -7590, -7716, -7843, -7970, -8097, -8223, -8349, -8476, -8602, -8729, 
-        -8855, -8981, -9108, -9234, -9362, -9488, -9615, -9742, -9869, -9995, -10121, -10248, 
-        -10374, -10500, -10627, -10753, -10880, -11006, -11134, -11260, -11386, -11513, -11639, -11766, 
-        -11892, -12018, -12145, -12271, -12399, -12525, -12652, -12778, -12904, -13031, -13157, -13283, 
-        -13410, -13536, -13662, -13790, -13917, -14043, -14171, -14297, -14423, -14550, -14676, -14803, 
-        -14929, -15055, -15182, -15308, -15434, -15562, -15689, -15815, -15941, -16068, -16194, -16320, 
-        -16447, -16573, -16699, -16826, -16954, -17080, -17206, -17333, -17459, -17585, -17712, -17838, 
-        -17964, -18091, -18217, -18345, -18471, -18598, -18724, -18852, -18978, -19105, -19231, -19357, 
-        -19484, -19610, -19736, -19863, -19989, -20117, -20243, -20370, -20496, -20622, -20749, -20875, 
-        -21001, -21128, -21254, -21382, -21508, -21635, -21761, -21887, -22014, -22140, -22267, -22393, 
-        -22519, -22646, -22773, -22900, -23026, -23152, -23279, -23405, -23533, -23659, -23786, -23912, 
-        -24038, -24165, -24291, -24418, -24545, -24672, -24798, -24924, -25051, -25177, -25304, -25430, 
-        -25556, -25683, -25809, -25937, -26063, -26189, -26316, -26442, -26569, -26695, -26821, -26948, 
-        -27074, -27200, -27328, -27455, -27581, -27707, -27834, -27960, -28086, -28214, -28341, -28467, 
-        -28593, -28720, -28846, -28972, -29100, -29226, -29353, -29479, -29606, -29732, -29858, -29985, 
-        -30111, -30237, -30364, -30492, -30618, -30744, -30871, -30997, -31123, -31250, -31376, -31502, 
-        -31629, -31757, -31883, -32009, -32136, -32262, -32388, -32515, -32641, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0006 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0006[600] PROGMEM = {
-        32767, 32635, 32503, 32373, 32241, 32110, 31978, 31846, 31715, 31583, 31451, 31321, 
-        31188, 31058, 30924, 30794, 30662, 30530, 30399, 30267, 30135, 30004, 29872, 29741, 
-        29609, 29477, 29347, 29215, 29083, 28951, 28818, 28688, 28556, 28425, 28293, 28161, 
-        28030, 27898, 27766, 27636, 27504, 27373, 27241, 27109, 26977, 26845, 26714, 26582, 
-        26450, 26319, 26187, 26057, 25925, 25792, 25662, 25530, 25398, 25267, 25134, 25003, 
-        24871, 24740, 24608, 24476, 24345, 24213, 24081, 23951, 23819, 23688, 23556, 23424, 
-        23293, 23160, 23029, 22897, 22765, 22634, 22502, 22372, 22240, 22108, 21977, 21845, 
-        21713, 21582, 21450, 21319, 21186, 21055, 20923, 20791, 20661, 20528, 20396, 20266, 
-        20134, 20003, 19871, 19739, 19608, 19476, 19344, 19212, 19080, 18949, 18817, 18687, 
-        18555, 18423, 18292, 18160, 18028, 17897, 17765, 17635, 17502, 17370, 17238, 17106, 
-        16976, 16844, 16712, 16581, 16449, 16318, 16186, 16054, 15923, 15791, 15659, 15529, 
-        15395, 15265, 15132, 15002, 14870, 14738, 14607, 14475, 14343, 14212, 14080, 13950, 
-        13818, 13685, 13555, 13421, 13291, 13159, 13027, 12896, 12764, 12633, 12501, 12369, 
-        12239, 12106, 11974, 11844, 11712, 11580, 11448, 11317, 11185, 11053, 10922, 10790, 
-        10658, 10527, 10395, 10265, 10133, 10001, 9870, 9738, 9606, 9474, 9342, 9211, 
-        9079, 8948, 8816, 8684, 8554, 8422, 8289, 8159, 8027, 7896, 7764, 7632, 
-        7500, 7368, 7237, 7105, 6973, 6842, 6710, 6580, 6448, 6316, 6185, 6053, 
-        5921, 5789, 5657, 5526, 5394, 5263, 5131, 4999, 4869, 4737, 4605, 4474, 
-        4342, 4211, 4079, 3947, 3815, 3683, 3552, 3420, 3288, 3158, 3026, 2895, 
-        2763, 2631, 2500, 2368, 2236, 2105, 1973, 1841, 1709, 1579, 1446, 1314, 
-        1184, 1052, 920, 789, 657, 526, 394, 262, 132, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, -132, -262, -394, -526, -657, -789, -920, -1052, -1184, -1314, -1446, 
-        -1579, -1709, -1841, -1973, -2105, -2236, -2368, -2500, -2631, -2763, -2895, -3026, 
-        -3158, -3288, -3420, -3552, -3683, -3815, -3947, -4079, -4211, -4342, -4474, -4605, 
-        -4737, -4869, -4999, -5131, -5263, -5394, -5526, -5657, -5789, -5921, -6053, -6185, 
-        -6316, -6448, -6580, -6710, -6842, -6973, -7105, -7237, -7368, -7500, -7632, -7764, 
-        -7896, -8027, -8159, -8289, -8422, -8554, -8684, -8816, -8948, -9079, -9211, -9342, 
-        -9474, -9606, -9738, -9870, -10001, -10133, -10265, -10395, -10527, -10658, -10790, -10922, 
-        -11053, -11185, -11317, -11448, -11580, -11712, -11844, -11974, -12106, -12239, -12369, -12501, 
-        -12633, -12764, -12896, -13027, -13159, -13291, -13421, -13555, -13685, -13818, -13950, -14080, 
-        -14212, -14343, -14475, -14607, -14738, -14870, -15002, -15132, -15265, -15395, -15529, -15659, 
-        -15791, -15923, -16054, -16186, -16318, -16449, -16581, -16712, -16844, -16976, -17106, -17238, 
-        -17370, -17502, -17635, -17765, -17897, -18028, -18160, -18292, -18423, -18555, -18687, -18817, 
-        -18949, -19080, -19212, -19344, -19476, -19608, -19739, -19871, -20003, -20134, -20266, -20396, 
-        -20528, -20661, -20791, -20923, -21055, -21186, -21319, -21450, -21582, -21713, -21845, -21977, 
-        -22108, -22240, -22372, -22502, -22634, -22765, -22897, -23029, -23160, -23293, -23424, -23556, 
-        -23688, -23819, -23951, -24081, -24213, -24345, -24476, -24608, -24740, -24871, -25003, -25134, 
-        -25267, -25398, -25530, -25662, -25792, -25925, -26057, -26187, -26319, -26450, -26582, -26714, 
-        -26845, -26977, -27109, -27241, -27373, -27504, -27636, -27766, -27898, -28030, -28161, -28293, 
-        -28425, -28556, -28688, -28818, -28951, -29083, -29215, -29347, -29477, -29609, -29741, -29872, 
-        -30004, -30135, -30267, -30399, -30530, -30662, -30794, -30924, -31058, -31188, -31321, -31451, 
-        -31583, -31715, -31846, -31978, -32110, -32241, -32373, -32503, -32635, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0007 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0007[600] PROGMEM = {
-        32767, 32630, 32493, 32356, 32219, 32082, 31945, 31807, 31671, 31533, 31397, 31259, 
-        31123, 30985, 30849, 30711, 30575, 30437, 30299, 30163, 30025, 29889, 29751, 29615, 
-        29477, 29340, 29203, 29066, 28929, 28792, 28654, 28518, 28380, 28244, 28106, 27968, 
-        27832, 27694, 27558, 27420, 27284, 27146, 27010, 26872, 26736, 26598, 26462, 26324, 
-        26187, 26050, 25913, 25776, 25638, 25502, 25364, 25227, 25090, 24953, 24816, 24679, 
-        24541, 24405, 24267, 24131, 23993, 23857, 23719, 23581, 23445, 23307, 23171, 23033, 
-        22897, 22759, 22623, 22485, 22347, 22211, 22073, 21937, 21799, 21663, 21525, 21388, 
-        21251, 21113, 20977, 20839, 20702, 20565, 20428, 20291, 20153, 20017, 19879, 19742, 
-        19605, 19468, 19331, 19194, 19056, 18920, 18782, 18645, 18508, 18370, 18234, 18096, 
-        17960, 17822, 17686, 17548, 17412, 17274, 17138, 17000, 16864, 16726, 16589, 16452, 
-        16314, 16178, 16040, 15903, 15766, 15629, 15492, 15355, 15217, 15081, 14943, 14807, 
-        14669, 14533, 14395, 14259, 14121, 13983, 13847, 13709, 13573, 13435, 13299, 13161, 
-        13025, 12887, 12751, 12613, 12476, 12339, 12202, 12065, 11928, 11790, 11653, 11516, 
-        11379, 11242, 11104, 10968, 10830, 10694, 10556, 10420, 10282, 10146, 10008, 9872, 
-        9734, 9598, 9460, 9322, 9186, 9048, 8912, 8774, 8637, 8500, 8363, 8226, 
-        8089, 7951, 7815, 7677, 7541, 7403, 7265, 7129, 6991, 6855, 6717, 6581, 
-        6443, 6305, 6169, 6031, 5895, 5757, 5621, 5483, 5347, 5209, 5071, 4935, 
-        4797, 4661, 4523, 4387, 4249, 4113, 3975, 3837, 3701, 3563, 3427, 3289, 
-        3152, 3015, 2878, 2741, 2604, 2466, 2329, 2192, 2055, 1918, 1780, 1644, 
-        1506, 1370, 1232, 1096, 958, 822, 684, 548, 410, 274, 136, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -136, 
-        -274, -410, -548, -684, -822, -958, -1096, -1232, -1370, -1506, -1644, -1780, 
-        -1918, -2055, -2192, -2329, -2466, -2604, -2741, -2878, -3015, -3152, -3289, -3427, 
-        -3563, -3701, -3837, -3975, -4113, -4249, -4387, -4523, -4661, -4797, -4935, -5071, 
-        -5209, -5347, -5483, -5621, -5757, -5895, -6031, -6169, -6305, -6443, -6581, -6717, 
-        -6855, -6991, -7129, -7265, -7403, -7541, -7677, -7815, -7951, -8089, -8226, -8363, 
-        -8500, -8637, -8774, -8912, -9048, -9186, -9322, -9460, -9598, -9734, -9872, -10008, 
-        -10146, -10282, -10420, -10556, -10694, -10830, -10968, -11104, -11242, -11379, -11516, -11653, 
-        -11790, -11928, -12065, -12202, -12339, -12476, -12613, -12751, -12887, -13025, -13161, -13299, 
-        -13435, -13573, -13709, -13847, -13983, -14121, -14259, -14395, -14533, -14669, -14807, -14943, 
-        -15081, -15217, -15355, -15492, -15629, -15766, -15903, -16040, -16178, -16314, -16452, -16589, 
-        -16726, -16864, -17000, -17138, -17274, -17412, -17548, -17686, -17822, -17960, -18096, -18234, 
-        -18370, -18508, -18645, -18782, -18920, -19056, -19194, -19331, -19468, -19605, -19742, -19879, 
-        -20017, -20153, -20291, -20428, -20565, -20702, -20839, -20977, -21113, -21251, -21388, -21525, 
-        -21663, -21799, -21937, -22073, -22211, -22347, -22485, -22623, -22759, -22897, -23033, -23171, 
-        -23307, -23445, -23581, -23719, -23857, -23993, -24131, -24267, -24405, -24541, -24679, -24816, 
-        -24953, -25090, -25227, -25364, -25502, -25638, -25776, -25913, -26050, -26187, -26324, -26462, 
-        -26598, -26736, -26872, -27010, -27146, -27284, -27420, -27558, -27694, -27832, -27968, -28106, 
-        -28244, -28380, -28518, -28654, -28792, -28929, -29066, -29203, -29340, -29477, -29615, -29751, 
-        -29889, -30025, -30163, -30299, -30437, -30575, -30711, -30849, -30985, -31123, -31259, -31397, 
-        -31533, -31671, -31807, -31945, -32082, -32219, -32356, -32493, -32630, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0008 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0008[600] PROGMEM = {
-        32767, 32625, 32481, 32339, 32195, 32053, 31908, 31766, 31623, 31479, 31336, 31194, 
-        31050, 30907, 30765, 30621, 30478, 30334, 30192, 30049, 29905, 29762, 29620, 29476, 
-        29333, 29189, 29047, 28904, 28760, 28618, 28475, 28331, 28188, 28046, 27902, 27759, 
-        27615, 27473, 27330, 27186, 27043, 26901, 26757, 26614, 26472, 26328, 26185, 26041, 
-        25899, 25756, 25612, 25469, 25327, 25183, 25040, 24897, 24754, 24611, 24468, 24325, 
-        24182, 24039, 23895, 23753, 23610, 23466, 23323, 23181, 23037, 22894, 22750, 22608, 
-        22465, 22321, 22179, 22036, 21892, 21749, 21607, 21463, 21320, 21176, 21034, 20891, 
-        20747, 20604, 20462, 20318, 20175, 20033, 19889, 19746, 19602, 19460, 19317, 19173, 
-        19030, 18888, 18744, 18601, 18459, 18315, 18172, 18028, 17886, 17743, 17599, 17456, 
-        17314, 17170, 17027, 16884, 16741, 16598, 16455, 16312, 16169, 16026, 15882, 15740, 
-        15597, 15453, 15310, 15168, 15024, 14881, 14737, 14595, 14452, 14308, 14166, 14023, 
-        13879, 13736, 13594, 13450, 13307, 13163, 13021, 12878, 12734, 12591, 12449, 12305, 
-        12162, 12020, 11876, 11733, 11589, 11447, 11304, 11160, 11017, 10875, 10730, 10588, 
-        10444, 10302, 10159, 10015, 9873, 9730, 9586, 9443, 9301, 9156, 9014, 8870, 
-        8728, 8584, 8442, 8298, 8156, 8013, 7869, 7727, 7582, 7440, 7297, 7155, 
-        7010, 6868, 6724, 6582, 6437, 6295, 6153, 6008, 5866, 5723, 5581, 5436, 
-        5294, 5150, 5008, 4863, 4721, 4578, 4434, 4291, 4149, 4007, 3862, 3720, 
-        3576, 3434, 3289, 3147, 3004, 2860, 2717, 2575, 2431, 2288, 2144, 2002, 
-        1860, 1715, 1573, 1430, 1286, 1143, 1001, 857, 714, 571, 428, 285, 
-        142, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, -142, -285, -428, 
-        -571, -714, -857, -1001, -1143, -1286, -1430, -1573, -1715, -1860, -2002, -2144, 
-        -2288, -2431, -2575, -2717, -2860, -3004, -3147, -3289, -3434, -3576, -3720, -3862, 
-        -4007, -4149, -4291, -4434, -4578, -4721, -4863, -5008, -5150, -5294, -5436, -5581, 
-        -5723, -5866, -6008, -6153, -6295, -6437, -6582, -6724, -6868, -7010, -7155, -7297, 
-        -7440, -7582, -7727, -7869, -8013, -8156, -8298, -8442, -8584, -8728, -8870, -9014, 
-        -9156, -9301, -9443, -9586, -9730, -9873, -10015, -10159, -10302, -10444, -10588, -10730, 
-        -10875, -11017, -11160, -11304, -11447, -11589, -11733, -11876, -12020, -12162, -12305, -12449, 
-        -12591, -12734, -12878, -13021, -13163, -13307, -13450, -13594, -13736, -13879, -14023, -14166, 
-        -14308, -14452, -14595, -14737, -14881, -15024, -15168, -15310, -15453, -15597, -15740, -15882, 
-        -16026, -16169, -16312, -16455, -16598, -16741, -16884, -17027, -17170, -17314, -17456, -17599, 
-        -17743, -17886, -18028, -18172, -18315, -18459, -18601, -18744, -18888, -19030, -19173, -19317, 
-        -19460, -19602, -19746, -19889, -20033, -20175, -20318, -20462, -20604, -20747, -20891, -21034, 
-        -21176, -21320, -21463, -21607, -21749, -21892, -22036, -22179, -22321, -22465, -22608, -22750, 
-        -22894, -23037, -23181, -23323, -23466, -23610, -23753, -23895, -24039, -24182, -24325, -24468, 
-        -24611, -24754, -24897, -25040, -25183, -25327, -25469, -25612, -25756, -25899, -26041, -26185, 
-        -26328, -26472, -26614, -26757, -26901, -27043, -27186, -27330, -27473, -27615, -27759, -27902, 
-        -28046, -28188, -28331, -28475, -28618, -28760, -28904, -29047, -29189, -29333, -29476, -29620, 
-        -29762, -29905, -30049, -30192, -30334, -30478, -30621, -30765, -30907, -31050, -31194, -31336, 
-        -31479, -31623, -31766, -31908, -32053, -32195, -32339, -32481, -32625, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0009 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0009[600] PROGMEM = {
-        32767, 32617, 32468, 32319, 32168, 32019, 31870, 31719, 31570, 31421, 31270, 31121, 
-        30970, 30821, 30672, 30521, 30374, 30223, 30074, 29925, 29774, 29625, 29476, 29325, 
-        29176, 29027, 28876, 28727, 28576, 28427, 28278, 28127, 27978, 27829, 27680, 27531, 
-        27380, 27231, 27082, 26931, 26782, 26633, 26482, 26333, 26182, 26033, 25884, 25733, 
-        25584, 25435, 25286, 25137, 24986, 24837, 24688, 24537, 24388, 24239, 24088, 23939, 
-        23788, 23639, 23490, 23339, 23190, 23041, 22891, 22743, 22592, 22443, 22294, 22143, 
-        21994, 21845, 21694, 21545, 21396, 21245, 21096, 20946, 20796, 20647, 20497, 20347, 
-        20198, 20049, 19900, 19749, 19600, 19451, 19300, 19151, 19002, 18851, 18702, 18552, 
-        18402, 18253, 18103, 17953, 17804, 17655, 17506, 17355, 17206, 17057, 16906, 16757, 
-        16608, 16457, 16308, 16158, 16008, 15859, 15709, 15559, 15410, 15260, 15112, 14961, 
-        14812, 14663, 14512, 14363, 14214, 14063, 13914, 13764, 13614, 13465, 13315, 13166, 
-        13016, 12866, 12717, 12567, 12418, 12269, 12118, 11969, 11820, 11669, 11520, 11370, 
-        11221, 11071, 10921, 10772, 10622, 10472, 10323, 10173, 10024, 9875, 9724, 9575, 
-        9426, 9276, 9126, 8977, 8827, 8677, 8527, 8378, 8228, 8078, 7929, 7779, 
-        7629, 7481, 7331, 7181, 7032, 6882, 6732, 6583, 6433, 6283, 6133, 5984, 
-        5834, 5684, 5535, 5386, 5235, 5086, 4937, 4787, 4638, 4488, 4338, 4189, 
-        4039, 3889, 3739, 3590, 3441, 3290, 3141, 2992, 2841, 2692, 2543, 2393, 
-        2244, 2094, 1944, 1795, 1645, 1496, 1345, 1196, 1047, 896, 747, 598, 
-        447, 298, 149, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, -149, -298, -447, -598, -747, 
-        -896, -1047, -1196, -1345, -1496, -1645, -1795, -1944, -2094, -2244, -2393, -2543, 
-        -2692, -2841, -2992, -3141, -3290, -3441, -3590, -3739, -3889, -4039, -4189, -4338, 
-        -4488, -4638, -4787, -4937, -5086, -5235, -5386, -5535, -5684, -5834, -5984, -6133, 
-        -6283, -6433, -6583, -6732, -6882, -7032, -7181, -7331, -7481, -7629, -7779, -7929, 
-        -8078, -8228, -8378, -8527, -8677, -8827, -8977, -9126, -9276, -9426, -9575, -9724, 
-        -9875, -10024, -10173, -10323, -10472, -10622, -10772, -10921, -11071, -11221, -11370, -11520, 
-        -11669, -11820, -11969, -12118, -12269, -12418, -12567, -12717, -12866, -13016, -13166, -13315, 
-        -13465, -13614, -13764, -13914, -14063, -14214, -14363, -14512, -14663, -14812, -14961, -15112, 
-        -15260, -15410, -15559, -15709, -15859, -16008, -16158, -16308, -16457, -16608, -16757, -16906, 
-        -17057, -17206, -17355, -17506, -17655, -17804, -17953, -18103, -18253, -18402, -18552, -18702, 
-        -18851, -19002, -19151, -19300, -19451, -19600, -19749, -19900, -20049, -20198, -20347, -20497, 
-        -20647, -20796, -20946, -21096, -21245, -21396, -21545, -21694, -21845, -21994, -22143, -22294, 
-        -22443, -22592, -22743, -22891, -23041, -23190, -23339, -23490, -23639, -23788, -23939, -24088, 
-        -24239, -24388, -24537, -24688, -24837, -24986, -25137, -25286, -25435, -25584, -25733, -25884, 
-        -26033, -26182, -26333, -26482, -26633, -26782, -26931, -27082, -27231, -27380, -27531, -27680, 
-        -27829, -27978, -28127, -28278, -28427, -28576, -28727, -28876, -29027, -29176, -29325, -29476, 
-        -29625, -29774, -29925, -30074, -30223, -30374, -30521, -30672, -30821, -30970, -31121, -31270, 
-        -31421, -31570, -31719, -31870, -32019, -32168, -32319, -32468, -32617, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0010 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0010[600] PROGMEM = {
-        32767, 32611, 32453, 32297, 32141, 31984, 31827, 31670, 31514, 31356, 31200, 31044, 
-        30886, 30730, 30573, 30416, 30259, 30103, 29947, 29789, 29633, 29476, 29318, 29162, 
-        29006, 28848, 28692, 28535, 28378, 28221, 28064, 27907, 27751, 27593, 27437, 27281, 
-        27123, 26967, 26810, 26652, 26496, 26340, 26183, 26026, 25869, 25713, 25555, 25399, 
-        25243, 25085, 24929, 24772, 24615, 24458, 24302, 24146, 23988, 23832, 23675, 23517, 
-        23360, 23203, 23047, 22889, 22733, 22577, 22419, 22263, 22106, 21950, 21792, 21636, 
-        21480, 21322, 21166, 21009, 20851, 20695, 20539, 20383, 20225, 20068, 19912, 19754, 
-        19598, 19442, 19284, 19128, 18971, 18814, 18656, 18500, 18343, 18187, 18029, 17873, 
-        17717, 17559, 17402, 17246, 17088, 16932, 16776, 16618, 16462, 16305, 16149, 15991, 
-        15835, 15679, 15521, 15365, 15208, 15050, 14894, 14738, 14582, 14424, 14267, 14111, 
-        13953, 13796, 13639, 13483, 13325, 13169, 13013, 12855, 12699, 12542, 12386, 12228, 
-        12072, 11916, 11758, 11601, 11445, 11287, 11131, 10975, 10817, 10661, 10504, 10348, 
-        10190, 10034, 9878, 9720, 9564, 9407, 9250, 9092, 8935, 8779, 8621, 8465, 
-        8309, 8152, 7995, 7838, 7682, 7524, 7368, 7212, 7054, 6898, 6741, 6585, 
-        6427, 6271, 6115, 5957, 5800, 5644, 5486, 5330, 5174, 5016, 4860, 4703, 
-        4546, 4389, 4232, 4075, 3919, 3761, 3605, 3449, 3291, 3134, 2978, 2820, 
-        2664, 2508, 2351, 2194, 2037, 1881, 1723, 1567, 1411, 1253, 1097, 940, 
-        784, 626, 470, 314, 156, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, -156, -314, -470, -626, -784, -940, -1097, 
-        -1253, -1411, -1567, -1723, -1881, -2037, -2194, -2351, -2508, -2664, -2820, -2978, 
-        -3134, -3291, -3449, -3605, -3761, -3919, -4075, -4232, -4389, -4546, -4703, -4860, 
-        -5016, -5174, -5330, -5486, -5644, -5800, -5957, -6115, -6271, -6427, -6585, -6741, 
-        -6898, -7054, -7212, -7368, -7524, -7682, -7838, -7995, -8152, -8309, -8465, -8621, 
-        -8779, -8935, -9092, -9250, -9407, -9564, -9720, -9878, -10034, -10190, -10348, -10504, 
-        -10661, -10817, -10975, -11131, -11287, -11445, -11601, -11758, -11916, -12072, -12228, -12386, 
-        -12542, -12699, -12855, -13013, -13169, -13325, -13483, -13639, -13796, -13953, -14111, -14267, 
-        -14424, -14582, -14738, -14894, -15050, -15208, -15365, -15521, -15679, -15835, -15991, -16149, 
-        -16305, -16462, -16618, -16776, -16932, -17088, -17246, -17402, -17559, -17717, -17873, -18029, 
-        -18187, -18343, -18500, -18656, -18814, -18971, -19128, -19284, -19442, -19598, -19754, -19912, 
-        -20068, -20225, -20383, -20539, -20695, -20851, -21009, -21166, -21322, -21480, -21636, -21792, 
-        -21950, -22106, -22263, -22419, -22577, -22733, -22889, -23047, -23203, -23360, -23517, -23675, 
-        -23832, -23988, -24146, -24302, -24458, -24615, -24772, -24929, -25085, -25243, -25399, -25555, 
-        -25713, -25869, -26026, -26183, -26340, -26496, -26652, -26810, -26967, -27123, -27281, -27437, 
-        -27593, -27751, -27907, -28064, -28221, -28378, -28535, -28692, -28848, -29006, -29162, -29318, 
-        -29476, -29633, -29789, -29947, -30103, -30259, -30416, -30573, -30730, -30886, -31044, -31200, 
-        -31356, -31514, -31670, -31827, -31984, -32141, -32297, -32453, -32611, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0011 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0011[600] PROGMEM = {
-        32767, 32603, 32438, 32273, 32108, 31943, 31780, 31615, 31450, 31285, 31120, 30955, 
-        30792, 30627, 30462, 30297, 30132, 29967, 29804, 29639, 29474, 29309, 29144, 28979, 
-        28816, 28651, 28486, 28321, 28156, 27992, 27828, 27663, 27498, 27333, 27169, 27004, 
-        26840, 26675, 26510, 26346, 26181, 26016, 25852, 25687, 25523, 25358, 25193, 25028, 
-        24864, 24700, 24535, 24370, 24205, 24040, 23877, 23712, 23547, 23382, 23217, 23052, 
-        22887, 22722, 22559, 22394, 22229, 22064, 21899, 21734, 21570, 21406, 21241, 21076, 
-        20911, 20747, 20582, 20417, 20252, 20088, 19924, 19759, 19594, 19429, 19264, 19099, 
-        18936, 18771, 18606, 18441, 18276, 18111, 17948, 17783, 17618, 17453, 17288, 17123, 
-        16960, 16795, 16630, 16465, 16300, 16135, 15971, 15807, 15642, 15477, 15312, 15148, 
-        14983, 14819, 14654, 14489, 14325, 14160, 13995, 13831, 13666, 13502, 13337, 13172, 
-        13007, 12843, 12679, 12514, 12349, 12184, 12019, 11856, 11691, 11526, 11361, 11196, 
-        11031, 10868, 10703, 10538, 10373, 10208, 10043, 9880, 9715, 9550, 9385, 9220, 
-        9055, 8892, 8727, 8562, 8397, 8232, 8067, 7904, 7739, 7574, 7409, 7244, 
-        7080, 6915, 6750, 6586, 6421, 6257, 6092, 5927, 5762, 5597, 5434, 5269, 
-        5104, 4939, 4774, 4609, 4444, 4279, 4116, 3951, 3786, 3621, 3456, 3292, 
-        3127, 2963, 2798, 2633, 2469, 2304, 2139, 1975, 1810, 1646, 1481, 1316, 
-        1151, 987, 823, 658, 493, 328, 163, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, -163, -328, -493, -658, -823, -987, -1151, -1316, -1481, 
-        -1646, -1810, -1975, -2139, -2304, -2469, -2633, -2798, -2963, -3127, -3292, -3456, 
-        -3621, -3786, -3951, -4116, -4279, -4444, -4609, -4774, -4939, -5104, -5269, -5434, 
-        -5597, -5762, -5927, -6092, -6257, -6421, -6586, -6750, -6915, -7080, -7244, -7409, 
-        -7574, -7739, -7904, -8067, -8232, -8397, -8562, -8727, -8892, -9055, -9220, -9385, 
-        -9550, -9715, -9880, -10043, -10208, -10373, -10538, -10703, -10868, -11031, -11196, -11361, 
-        -11526, -11691, -11856, -12019, -12184, -12349, -12514, -12679, -12843, -13007, -13172, -13337, 
-        -13502, -13666, -13831, -13995, -14160, -14325, -14489, -14654, -14819, -14983, -15148, -15312, 
-        -15477, -15642, -15807, -15971, -16135, -16300, -16465, -16630, -16795, -16960, -17123, -17288, 
-        -17453, -17618, -17783, -17948, -18111, -18276, -18441, -18606, -18771, -18936, -19099, -19264, 
-        -19429, -19594, -19759, -19924, -20088, -20252, -20417, -20582, -20747, -20911, -21076, -21241, 
-        -21406, -21570, -21734, -21899, -22064, -22229, -22394, -22559, -22722, -22887, -23052, -23217, 
-        -23382, -23547, -23712, -23877, -24040, -24205, -24370, -24535, -24700, -24864, -25028, -25193, 
-        -25358, -25523, -25687, -25852, -26016, -26181, -26346, -26510, -26675, -26840, -27004, -27169, 
-        -27333, -27498, -27663, -27828, -27992, -28156, -28321, -28486, -28651, -28816, -28979, -29144, 
-        -29309, -29474, -29639, -29804, -29967, -30132, -30297, -30462, -30627, -30792, -30955, -31120, 
-        -31285, -31450, -31615, -31780, -31943, -32108, -32273, -32438, -32603, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0012 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0012[600] PROGMEM = {
-        32767, 32594, 32421, 32247, 32074, 31900, 31727, 31553, 31380, 31206, 31033, 30859, 
-        30687, 30513, 30341, 30167, 29994, 29820, 29647, 29473, 29300, 29126, 28953, 28779, 
-        28606, 28432, 28259, 28087, 27912, 27740, 27565, 27393, 27218, 27046, 26871, 26699, 
-        26526, 26352, 26179, 26005, 25832, 25659, 25485, 25312, 25138, 24965, 24791, 24619, 
-        24444, 24272, 24099, 23925, 23752, 23578, 23405, 23232, 23058, 22885, 22711, 22538, 
-        22366, 22191, 22019, 21844, 21672, 21497, 21325, 21150, 20978, 20803, 20631, 20458, 
-        20284, 20111, 19937, 19764, 19590, 19417, 19243, 19070, 18897, 18723, 18550, 18378, 
-        18204, 18031, 17857, 17684, 17510, 17337, 17163, 16990, 16816, 16643, 16470, 16297, 
-        16123, 15951, 15776, 15604, 15429, 15257, 15082, 14910, 14735, 14563, 14389, 14216, 
-        14043, 13869, 13696, 13522, 13349, 13175, 13002, 12828, 12655, 12481, 12309, 12136, 
-        11962, 11789, 11616, 11442, 11269, 11095, 10922, 10748, 10575, 10401, 10229, 10054, 
-        9882, 9707, 9535, 9361, 9189, 9014, 8842, 8667, 8495, 8321, 8148, 7974, 
-        7801, 7627, 7454, 7280, 7107, 6934, 6760, 6588, 6413, 6241, 6068, 5894, 
-        5721, 5547, 5374, 5200, 5027, 4853, 4680, 4507, 4333, 4160, 3986, 3814, 
-        3639, 3467, 3292, 3120, 2945, 2773, 2600, 2426, 2253, 2080, 1906, 1733, 
-        1559, 1386, 1212, 1039, 867, 692, 520, 345, 173, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, -173, -345, -520, -692, -867, -1039, -1212, -1386, -1559, -1733, -1906, 
-        -2080, -2253, -2426, -2600, -2773, -2945, -3120, -3292, -3467, -3639, -3814, -3986, 
-        -4160, -4333, -4507, -4680, -4853, -5027, -5200, -5374, -5547, -5721, -5894, -6068, 
-        -6241, -6413, -6588, -6760, -6934, -7107, -7280, -7454, -7627, -7801, -7974, -8148, 
-        -8321, -8495, -8667, -8842, -9014, -9189, -9361, -9535, -9707, -9882, -10054, -10229, 
-        -10401, -10575, -10748, -10922, -11095, -11269, -11442, -11616, -11789, -11962, -12136, -12309, 
-        -12481, -12655, -12828, -13002, -13175, -13349, -13522, -13696, -13869, -14043, -14216, -14389, 
-        -14563, -14735, -14910, -15082, -15257, -15429, -15604, -15776, -15951, -16123, -16297, -16470, 
-        -16643, -16816, -16990, -17163, -17337, -17510, -17684, -17857, -18031, -18204, -18378, -18550, 
-        -18723, -18897, -19070, -19243, -19417, -19590, -19764, -19937, -20111, -20284, -20458, -20631, 
-        -20803, -20978, -21150, -21325, -21497, -21672, -21844, -22019, -22191, -22366, -22538, -22711, 
-        -22885, -23058, -23232, -23405, -23578, -23752, -23925, -24099, -24272, -24444, -24619, -24791, 
-        -24965, -25138, -25312, -25485, -25659, -25832, -26005, -26179, -26352, -26526, -26699, -26871, 
-        -27046, -27218, -27393, -27565, -27740, -27912, -28087, -28259, -28432, -28606, -28779, -28953, 
-        -29126, -29300, -29473, -29647, -29820, -29994, -30167, -30341, -30513, -30687, -30859, -31033, 
-        -31206, -31380, -31553, -31727, -31900, -32074, -32247, -32421, -32594, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0013 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0013[600] PROGMEM = {
-        32767, 32584, 32401, 32219, 32035, 31852, 31670, 31486, 31303, 31119, 30937, 30754, 
-        30570, 30388, 30205, 30021, 29839, 29656, 29472, 29290, 29107, 28923, 28740, 28558, 
-        28374, 28191, 28007, 27824, 27642, 27458, 27275, 27093, 26909, 26726, 26544, 26360, 
-        26177, 25993, 25811, 25628, 25444, 25262, 25079, 24896, 24713, 24530, 24347, 24164, 
-        23981, 23798, 23614, 23431, 23247, 23065, 22882, 22698, 22516, 22333, 22149, 21967, 
-        21784, 21600, 21418, 21235, 21051, 20868, 20686, 20502, 20319, 20137, 19953, 19770, 
-        19588, 19404, 19221, 19039, 18855, 18670, 18488, 18305, 18121, 17939, 17756, 17572, 
-        17390, 17207, 17024, 16841, 16658, 16475, 16291, 16109, 15926, 15742, 15560, 15377, 
-        15193, 15011, 14828, 14644, 14462, 14279, 14095, 13912, 13728, 13545, 13363, 13179, 
-        12996, 12814, 12630, 12447, 12265, 12081, 11898, 11716, 11532, 11349, 11165, 10983, 
-        10800, 10616, 10434, 10251, 10067, 9885, 9702, 9518, 9335, 9152, 8968, 8786, 
-        8603, 8419, 8237, 8054, 7870, 7688, 7505, 7321, 7139, 6956, 6772, 6590, 
-        6407, 6223, 6040, 5858, 5674, 5491, 5309, 5125, 4942, 4760, 4575, 4393, 
-        4209, 4026, 3842, 3660, 3477, 3293, 3111, 2928, 2744, 2562, 2379, 2195, 
-        2013, 1830, 1646, 1464, 1281, 1097, 914, 732, 548, 365, 183, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -183, 
-        -365, -548, -732, -914, -1097, -1281, -1464, -1646, -1830, -2013, -2195, -2379, 
-        -2562, -2744, -2928, -3111, -3293, -3477, -3660, -3842, -4026, -4209, -4393, -4575, 
-        -4760, -4942, -5125, -5309, -5491, -5674, -5858, -6040, -6223, -6407, -6590, -6772, 
-        -6956, -7139, -7321, -7505, -7688, -7870, -8054, -8237, -8419, -8603, -8786, -8968, 
-        -9152, -9335, -9518, -9702, -9885, -10067, -10251, -10434, -10616, -10800, -10983, -11165, 
-        -11349, -11532, -11716, -11898, -12081, -12265, -12447, -12630, -12814, -12996, -13179, -13363, 
-        -13545, -13728, -13912, -14095, -14279, -14462, -14644, -14828, -15011, -15193, -15377, -15560, 
-        -15742, -15926, -16109, -16291, -16475, -16658, -16841, -17024, -17207, -17390, -17572, -17756, 
-        -17939, -18121, -18305, -18488, -18670, -18855, -19039, -19221, -19404, -19588, -19770, -19953, 
-        -20137, -20319, -20502, -20686, -20868, -21051, -21235, -21418, -21600, -21784, -21967, -22149, 
-        -22333, -22516, -22698, -22882, -23065, -23247, -23431, -23614, -23798, -23981, -24164, -24347, 
-        -24530, -24713, -24896, -25079, -25262, -25444, -25628, -25811, -25993, -26177, -26360, -26544, 
-        -26726, -26909, -27093, -27275, -27458, -27642, -27824, -28007, -28191, -28374, -28558, -28740, 
-        -28923, -29107, -29290, -29472, -29656, -29839, -30021, -30205, -30388, -30570, -30754, -30937, 
-        -31119, -31303, -31486, -31670, -31852, -32035, -32219, -32401, -32584, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0014 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0014[600] PROGMEM = {
-        0, 0, 32767, 32573, 32379, 32186, 31991, 31797, 31602, 31410, 31215, 31022, 
-        30827, 30635, 30440, 30247, 30052, 29858, 29665, 29470, 29276, 29083, 28889, 28694, 
-        28501, 28307, 28114, 27919, 27726, 27532, 27337, 27144, 26950, 26757, 26562, 26368, 
-        26173, 25981, 25787, 25593, 25398, 25205, 25011, 24816, 24623, 24429, 24236, 24041, 
-        23847, 23654, 23460, 23266, 23072, 22879, 22684, 22490, 22297, 22103, 21908, 21715, 
-        21520, 21328, 21133, 20940, 20745, 20551, 20358, 20164, 19969, 19776, 19582, 19387, 
-        19194, 19000, 18807, 18612, 18419, 18225, 18032, 17837, 17643, 17450, 17255, 17061, 
-        16866, 16674, 16480, 16286, 16093, 15898, 15704, 15511, 15317, 15122, 14929, 14734, 
-        14542, 14347, 14153, 13959, 13765, 13572, 13378, 13183, 12990, 12796, 12601, 12408, 
-        12214, 12021, 11826, 11633, 11439, 11246, 11051, 10857, 10664, 10469, 10275, 10080, 
-        9888, 9693, 9500, 9305, 9112, 8918, 8725, 8530, 8336, 8143, 7948, 7754, 
-        7561, 7367, 7173, 6979, 6786, 6592, 6397, 6204, 6010, 5815, 5622, 5427, 
-        5235, 5040, 4846, 4652, 4460, 4265, 4071, 3876, 3683, 3489, 3294, 3101, 
-        2907, 2714, 2519, 2326, 2132, 1939, 1744, 1550, 1357, 1162, 968, 773, 
-        581, 386, 193, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -193, 
-        -386, -581, -773, -968, -1162, -1357, -1550, -1744, -1939, -2132, -2326, -2519, 
-        -2714, -2907, -3101, -3294, -3489, -3683, -3876, -4071, -4265, -4460, -4652, -4846, 
-        -5040, -5235, -5427, -5622, -5815, -6010, -6204, -6397, -6592, -6786, -6979, -7173, 
-        -7367, -7561, -7754, -7948, -8143, -8336, -8530, -8725, -8918, -9112, -9305, -9500, 
-        -9693, -9888, -10080, -10275, -10469, -10664, -10857, -11051, -11246, -11439, -11633, -11826, 
-        -12021, -12214, -12408, -12601, -12796, -12990, -13183, -13378, -13572, -13765, -13959, -14153, 
-        -14347, -14542, -14734, -14929, -15122, -15317, -15511, -15704, -15898, -16093, -16286, -16480, 
-        -16674, -16866, -17061, -17255, -17450, -17643, -17837, -18032, -18225, -18419, -18612, -18807, 
-        -19000, -19194, -19387, -19582, -19776, -19969, -20164, -20358, -20551, -20745, -20940, -21133, 
-        -21328, -21520, -21715, -21908, -22103, -22297, -22490, -22684, -22879, -23072, -23266, -23460, 
-        -23654, -23847, -24041, -24236, -24429, -24623, -24816, -25011, -25205, -25398, -25593, -25787, 
-        -25981, -26173, -26368, -26562, -26757, -26950, -27144, -27337, -27532, -27726, -27919, -28114, 
-        -28307, -28501, -28694, -28889, -29083, -29276, -29470, -29665, -29858, -30052, -30247, -30440, 
-        -30635, -30827, -31022, -31215, -31410, -31602, -31797, -31991, -32186, -32379, -32573, -32767 
-    };
-
-    // AKWF_gapsaw_0015 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0015[600] PROGMEM = {
-        32767, 32561, 32355, 32148, 31943, 31737, 31531, 31324, 31118, 30913, 30707, 30500, 
-        30294, 30088, 29883, 29676, 29470, 29264, 29057, 28852, 28646, 28440, 28233, 28027, 
-        27822, 27615, 27409, 27203, 26996, 26791, 26585, 26379, 26172, 25967, 25761, 25555, 
-        25348, 25142, 24937, 24731, 24524, 24318, 24112, 23907, 23700, 23494, 23287, 23081, 
-        22875, 22670, 22463, 22257, 22051, 21844, 21638, 21433, 21227, 21020, 20814, 20608, 
-        20401, 20195, 19990, 19784, 19577, 19371, 19164, 18960, 18753, 18547, 18340, 18134, 
-        17929, 17723, 17516, 17310, 17104, 16899, 16692, 16486, 16280, 16073, 15868, 15662, 
-        15456, 15249, 15043, 14838, 14632, 14425, 14219, 14012, 13807, 13601, 13395, 13188, 
-        12983, 12777, 12571, 12364, 12158, 11953, 11747, 11540, 11334, 11128, 10923, 10716, 
-        10510, 10304, 10097, 9892, 9686, 9480, 9273, 9067, 8862, 8655, 8449, 8243, 
-        8036, 7831, 7625, 7419, 7212, 7006, 6800, 6595, 6388, 6182, 5976, 5769, 
-        5563, 5358, 5152, 4945, 4739, 4532, 4326, 4121, 3915, 3708, 3502, 3296, 
-        3089, 2884, 2678, 2472, 2265, 2059, 1854, 1648, 1441, 1235, 1028, 824, 
-        617, 411, 204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, -204, -411, -617, -824, -1028, 
-        -1235, -1441, -1648, -1854, -2059, -2265, -2472, -2678, -2884, -3089, -3296, -3502, 
-        -3708, -3915, -4121, -4326, -4532, -4739, -4945, -5152, -5358, -5563, -5769, -5976, 
-        -6182, -6388, -6595, -6800, -7006, -7212, -7419, -7625, -7831, -8036, -8243, -8449, 
-        -8655, -8862, -9067, -9273, -9480, -9686, -9892, -10097, -10304, -10510, -10716, -10923, 
-        -11128, -11334, -11540, -11747, -11953, -12158, -12364, -12571, -12777, -12983, -13188, -13395, 
-        -13601, -13807, -14012, -14219, -14425, -14632, -14838, -15043, -15249, -15456, -15662, -15868, 
-        -16073, -16280, -16486, -16692, -16899, -17104, -17310, -17516, -17723, -17929, -18134, -18340, 
-        -18547, -18753, -18960, -19164, -19371, -19577, -19784, -19990, -20195, -20401, -20608, -20814, 
-        -21020, -21227, -21433, -21638, -21844, -22051, -22257, -22463, -22670, -22875, -23081, -23287, 
-        -23494, -23700, -23907, -24112, -24318, -24524, -24731, -24937, -25142, -25348, -25555, -25761, 
-        -25967, -26172, -26379, -26585, -26791, -26996, -27203, -27409, -27615, -27822, -28027, -28233, 
-        -28440, -28646, -28852, -29057, -29264, -29470, -29676, -29883, -30088, -30294, -30500, -30707, 
-        -30913, -31118, -31324, -31531, -31737, -31943, -32148, -32355, -32561, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0016 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0016[600] PROGMEM = {
-        32767, 32548, 32328, 32108, 31888, 31668, 31448, 31228, 31008, 30788, 30569, 30348, 
-        30129, 29908, 29689, 29468, 29249, 29029, 28809, 28590, 28369, 28150, 27929, 27710, 
-        27489, 27270, 27049, 26830, 26611, 26390, 26171, 25950, 25731, 25510, 25291, 25070, 
-        24851, 24632, 24411, 24192, 23971, 23752, 23531, 23312, 23091, 22872, 22651, 22432, 
-        22211, 21992, 21771, 21552, 21331, 21112, 20891, 20672, 20451, 20232, 20011, 19792, 
-        19571, 19352, 19131, 18912, 18692, 18472, 18253, 18032, 17813, 17592, 17373, 17152, 
-        16933, 16712, 16493, 16274, 16053, 15834, 15613, 15394, 15173, 14954, 14733, 14514, 
-        14295, 14074, 13855, 13634, 13415, 13194, 12975, 12754, 12535, 12316, 12095, 11876, 
-        11655, 11436, 11215, 10996, 10775, 10556, 10335, 10116, 9897, 9676, 9457, 9236, 
-        9017, 8796, 8577, 8356, 8137, 7917, 7697, 7477, 7257, 7037, 6817, 6598, 
-        6377, 6158, 5937, 5718, 5497, 5278, 5057, 4838, 4617, 4398, 4177, 3958, 
-        3737, 3518, 3297, 3078, 2857, 2638, 2417, 2198, 1979, 1758, 1539, 1318, 
-        1099, 878, 659, 438, 219, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, -219, -438, -659, -878, -1099, -1318, -1539, 
-        -1758, -1979, -2198, -2417, -2638, -2857, -3078, -3297, -3518, -3737, -3958, -4177, 
-        -4398, -4617, -4838, -5057, -5278, -5497, -5718, -5937, -6158, -6377, -6598, -6817, 
-        -7037, -7257, -7477, -7697, -7917, -8137, -8356, -8577, -8796, -9017, -9236, -9457, 
-        -9676, -9897, -10116, -10335, -10556, -10775, -10996, -11215, -11436, -11655, -11876, -12095, 
-        -12316, -12535, -12754, -12975, -13194, -13415, -13634, -13855, -14074, -14295, -14514, -14733, 
-        -14954, -15173, -15394, -15613, -15834, -16053, -16274, -16493, -16712, -16933, -17152, -17373, 
-        -17592, -17813, -18032, -18253, -18472, -18692, -18912, -19131, -19352, -19571, -19792, -20011, 
-        -20232, -20451, -20672, -20891, -21112, -21331, -21552, -21771, -21992, -22211, -22432, -22651, 
-        -22872, -23091, -23312, -23531, -23752, -23971, -24192, -24411, -24632, -24851, -25070, -25291, 
-        -25510, -25731, -25950, -26171, -26390, -26611, -26830, -27049, -27270, -27489, -27710, -27929, 
-        -28150, -28369, -28590, -28809, -29029, -29249, -29468, -29689, -29908, -30129, -30348, -30569, 
-        -30788, -31008, -31228, -31448, -31668, -31888, -32108, -32328, -32548, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0017 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0017[600] PROGMEM = {
-        0, 0, 32767, 32531, 32296, 32061, 31824, 31589, 31353, 31118, 30881, 30646, 
-        30410, 30175, 29938, 29703, 29467, 29232, 28997, 28760, 28525, 28289, 28052, 27817, 
-        27581, 27346, 27109, 26874, 26638, 26403, 26166, 25931, 25695, 25460, 25225, 24988, 
-        24753, 24517, 24282, 24045, 23810, 23574, 23337, 23102, 22866, 22631, 22394, 22159, 
-        21923, 21688, 21453, 21216, 20981, 20745, 20510, 20273, 20038, 19802, 19567, 19330, 
-        19095, 18859, 18622, 18387, 18151, 17916, 17679, 17444, 17209, 16973, 16737, 16501, 
-        16266, 16030, 15794, 15558, 15323, 15086, 14851, 14616, 14380, 14145, 13907, 13672, 
-        13437, 13200, 12965, 12729, 12494, 12257, 12022, 11786, 11551, 11314, 11079, 10843, 
-        10608, 10373, 10136, 9901, 9665, 9430, 9193, 8957, 8722, 8485, 8250, 8014, 
-        7779, 7542, 7307, 7071, 6836, 6601, 6364, 6129, 5893, 5658, 5421, 5186, 
-        4950, 4715, 4478, 4242, 4007, 3770, 3535, 3299, 3064, 2827, 2592, 2357, 
-        2121, 1886, 1649, 1414, 1178, 943, 706, 471, 235, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, -235, -471, -706, -943, -1178, -1414, -1649, 
-        -1886, -2121, -2357, -2592, -2827, -3064, -3299, -3535, -3770, -4007, -4242, -4478, 
-        -4715, -4950, -5186, -5421, -5658, -5893, -6129, -6364, -6601, -6836, -7071, -7307, 
-        -7542, -7779, -8014, -8250, -8485, -8722, -8957, -9193, -9430, -9665, -9901, -10136, 
-        -10373, -10608, -10843, -11079, -11314, -11551, -11786, -12022, -12257, -12494, -12729, -12965, 
-        -13200, -13437, -13672, -13907, -14145, -14380, -14616, -14851, -15086, -15323, -15558, -15794, 
-        -16030, -16266, -16501, -16737, -16973, -17209, -17444, -17679, -17916, -18151, -18387, -18622, 
-        -18859, -19095, -19330, -19567, -19802, -20038, -20273, -20510, -20745, -20981, -21216, -21453, 
-        -21688, -21923, -22159, -22394, -22631, -22866, -23102, -23337, -23574, -23810, -24045, -24282, 
-        -24517, -24753, -24988, -25225, -25460, -25695, -25931, -26166, -26403, -26638, -26874, -27109, 
-        -27346, -27581, -27817, -28052, -28289, -28525, -28760, -28997, -29232, -29467, -29703, -29938, 
-        -30175, -30410, -30646, -30881, -31118, -31353, -31589, -31824, -32061, -32296, -32531, -32767 
-    };
-
-    // AKWF_gapsaw_0018 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0018[600] PROGMEM = {
-        32767, 32514, 32260, 32006, 31751, 31498, 31244, 30990, 30736, 30481, 30228, 29974, 
-        29720, 29466, 29213, 28958, 28704, 28450, 28195, 27941, 27688, 27434, 27179, 26925, 
-        26671, 26418, 26164, 25909, 25655, 25401, 25148, 24894, 24640, 24385, 24132, 23878, 
-        23624, 23369, 23115, 22862, 22606, 22353, 22099, 21845, 21592, 21336, 21083, 20829, 
-        20575, 20322, 20067, 19813, 19559, 19305, 19052, 18797, 18543, 18288, 18034, 17780, 
-        17527, 17273, 17019, 16764, 16510, 16257, 16003, 15749, 15494, 15240, 14987, 14733, 
-        14479, 14226, 13970, 13715, 13462, 13208, 12954, 12700, 12447, 12192, 11938, 11684, 
-        11431, 11177, 10922, 10668, 10414, 10161, 9907, 9652, 9398, 9143, 8889, 8635, 
-        8382, 8128, 7873, 7619, 7366, 7112, 6858, 6604, 6349, 6096, 5842, 5588, 
-        5334, 5079, 4826, 4570, 4317, 4063, 3809, 3556, 3301, 3047, 2793, 2539, 
-        2286, 2031, 1777, 1523, 1269, 1016, 762, 507, 253, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, -253, -507, -762, -1016, -1269, -1523, -1777, -2031, -2286, -2539, -2793, 
-        -3047, -3301, -3556, -3809, -4063, -4317, -4570, -4826, -5079, -5334, -5588, -5842, 
-        -6096, -6349, -6604, -6858, -7112, -7366, -7619, -7873, -8128, -8382, -8635, -8889, 
-        -9143, -9398, -9652, -9907, -10161, -10414, -10668, -10922, -11177, -11431, -11684, -11938, 
-        -12192, -12447, -12700, -12954, -13208, -13462, -13715, -13970, -14226, -14479, -14733, -14987, 
-        -15240, -15494, -15749, -16003, -16257, -16510, -16764, -17019, -17273, -17527, -17780, -18034, 
-        -18288, -18543, -18797, -19052, -19305, -19559, -19813, -20067, -20322, -20575, -20829, -21083, 
-        -21336, -21592, -21845, -22099, -22353, -22606, -22862, -23115, -23369, -23624, -23878, -24132, 
-        -24385, -24640, -24894, -25148, -25401, -25655, -25909, -26164, -26418, -26671, -26925, -27179, 
-        -27434, -27688, -27941, -28195, -28450, -28704, -28958, -29213, -29466, -29720, -29974, -30228, 
-        -30481, -30736, -30990, -31244, -31498, -31751, -32006, -32260, -32514, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0019 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0019[600] PROGMEM = {
-        32767, 32492, 32217, 31942, 31666, 31391, 31116, 30841, 30565, 30290, 30015, 29740, 
-        29464, 29189, 28914, 28639, 28363, 28087, 27811, 27536, 27261, 26986, 26710, 26435, 
-        26160, 25884, 25609, 25334, 25059, 24783, 24508, 24233, 23958, 23681, 23406, 23130, 
-        22855, 22580, 22305, 22029, 21754, 21479, 21202, 20927, 20652, 20376, 20101, 19826, 
-        19550, 19275, 19000, 18723, 18448, 18173, 17897, 17622, 17347, 17072, 16796, 16521, 
-        16246, 15971, 15695, 15420, 15145, 14870, 14594, 14319, 14042, 13767, 13492, 13217, 
-        12941, 12666, 12391, 12115, 11840, 11565, 11290, 11014, 10739, 10464, 10189, 9913, 
-        9638, 9361, 9086, 8811, 8536, 8260, 7985, 7710, 7435, 7159, 6884, 6609, 
-        6332, 6057, 5782, 5506, 5231, 4956, 4680, 4405, 4130, 3853, 3578, 3303, 
-        3027, 2752, 2477, 2202, 1926, 1651, 1376, 1101, 825, 550, 275, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -275, 
-        -550, -825, -1101, -1376, -1651, -1926, -2202, -2477, -2752, -3027, -3303, -3578, 
-        -3853, -4130, -4405, -4680, -4956, -5231, -5506, -5782, -6057, -6332, -6609, -6884, 
-        -7159, -7435, -7710, -7985, -8260, -8536, -8811, -9086, -9361, -9638, -9913, -10189, 
-        -10464, -10739, -11014, -11290, -11565, -11840, -12115, -12391, -12666, -12941, -13217, -13492, 
-        -13767, -14042, -14319, -14594, -14870, -15145, -15420, -15695, -15971, -16246, -16521, -16796, 
-        -17072, -17347, -17622, -17897, -18173, -18448, -18723, -19000, -19275, -19550, -19826, -20101, 
-        -20376, -20652, -20927, -21202, -21479, -21754, -22029, -22305, -22580, -22855, -23130, -23406, 
-        -23681, -23958, -24233, -24508, -24783, -25059, -25334, -25609, -25884, -26160, -26435, -26710, 
-        -26986, -27261, -27536, -27811, -28087, -28363, -28639, -28914, -29189, -29464, -29740, -30015, 
-        -30290, -30565, -30841, -31116, -31391, -31666, -31942, -32217, -32492, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0020 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0020[600] PROGMEM = {
-        32767, 32468, 32167, 31865, 31566, 31265, 30963, 30662, 30362, 30063, 29762, 29460, 
-        29161, 28860, 28558, 28257, 27957, 27658, 27357, 27055, 26756, 26455, 26153, 25852, 
-        25552, 25253, 24952, 24650, 24351, 24050, 23748, 23447, 23147, 22848, 22547, 22245, 
-        21946, 21645, 21343, 21042, 20742, 20441, 20142, 19840, 19541, 19240, 18938, 18637, 
-        18337, 18036, 17737, 17435, 17136, 16835, 16533, 16232, 15932, 15631, 15330, 15030, 
-        14731, 14430, 14128, 13827, 13527, 13226, 12925, 12625, 12326, 12025, 11723, 11422, 
-        11122, 10821, 10520, 10220, 9921, 9620, 9318, 9019, 8717, 8416, 8115, 7815, 
-        7516, 7215, 6913, 6614, 6312, 6011, 5710, 5410, 5109, 4810, 4508, 4209, 
-        3907, 3606, 3305, 3005, 2704, 2405, 2103, 1804, 1502, 1201, 900, 600, 
-        299, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, -299, -600, -900, 
-        -1201, -1502, -1804, -2103, -2405, -2704, -3005, -3305, -3606, -3907, -4209, -4508, 
-        -4810, -5109, -5410, -5710, -6011, -6312, -6614, -6913, -7215, -7516, -7815, -8115, 
-        -8416, -8717, -9019, -9318, -9620, -9921, -10220, -10520, -10821, -11122, -11422, -11723, 
-        -12025, -12326, -12625, -12925, -13226, -13527, -13827, -14128, -14430, -14731, -15030, -15330, 
-        -15631, -15932, -16232, -16533, -16835, -17136, -17435, -17737, -18036, -18337, -18637, -18938, 
-        -19240, -19541, -19840, -20142, -20441, -20742, -21042, -21343, -21645, -21946, -22245, -22547, 
-        -22848, -23147, -23447, -23748, -24050, -24351, -24650, -24952, -25253, -25552, -25852, -26153, 
-        -26455, -26756, -27055, -27357, -27658, -27957, -28257, -28558, -28860, -29161, -29460, -29762, 
-        -30063, -30362, -30662, -30963, -31265, -31566, -31865, -32167, -32468, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0021 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0021[600] PROGMEM = {
-        32767, 32436, 32105, 31775, 31443, 31112, 30782, 30450, 30119, 29789, 29457, 29126, 
-        28796, 28465, 28133, 27803, 27472, 27140, 26810, 26479, 26147, 25817, 25486, 25154, 
-        24824, 24493, 24162, 23832, 23500, 23169, 22837, 22507, 22176, 21844, 21514, 21183, 
-        20851, 20520, 20190, 19859, 19527, 19196, 18866, 18534, 18203, 17873, 17541, 17210, 
-        16880, 16549, 16217, 15887, 15556, 15224, 14894, 14563, 14231, 13901, 13570, 13238, 
-        12908, 12577, 12246, 11916, 11584, 11253, 10923, 10591, 10260, 9930, 9598, 9267, 
-        8937, 8605, 8274, 7944, 7613, 7281, 6950, 6620, 6288, 5957, 5625, 5295, 
-        4964, 4632, 4301, 3971, 3640, 3308, 2978, 2647, 2315, 1985, 1654, 1322, 
-        992, 661, 330, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, -330, -661, -992, -1322, -1654, 
-        -1985, -2315, -2647, -2978, -3308, -3640, -3971, -4301, -4632, -4964, -5295, -5625, 
-        -5957, -6288, -6620, -6950, -7281, -7613, -7944, -8274, -8605, -8937, -9267, -9598, 
-        -9930, -10260, -10591, -10923, -11253, -11584, -11916, -12246, -12577, -12908, -13238, -13570, 
-        -13901, -14231, -14563, -14894, -15224, -15556, -15887, -16217, -16549, -16880, -17210, -17541, 
-        -17873, -18203, -18534, -18866, -19196, -19527, -19859, -20190, -20520, -20851, -21183, -21514, 
-        -21844, -22176, -22507, -22837, -23169, -23500, -23832, -24162, -24493, -24824, -25154, -25486, 
-        -25817, -26147, -26479, -26810, -27140, -27472, -27803, -28133, -28465, -28796, -29126, -29457, 
-        -29789, -30119, -30450, -30782, -31112, -31443, -31775, -32105, -32436, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0022 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0022[600] PROGMEM = {
-        32767, 32400, 32031, 31663, 31294, 30927, 30559, 30190, 29823, 29455, 29086, 28719, 
-        28350, 27981, 27613, 27245, 26876, 26509, 26140, 25772, 25405, 25036, 24668, 24301, 
-        23932, 23563, 23195, 22826, 22458, 22091, 21722, 21354, 20985, 20618, 20250, 19881, 
-        19514, 19146, 18776, 18408, 18040, 17671, 17304, 16936, 16567, 16200, 15831, 15463, 
-        15096, 14727, 14359, 13990, 13621, 13253, 12886, 12517, 12149, 11782, 11413, 11045, 
-        10676, 10309, 9941, 9572, 9203, 8835, 8466, 8099, 7731, 7362, 6995, 6627, 
-        6258, 5891, 5522, 5154, 4786, 4417, 4048, 3681, 3312, 2944, 2577, 2208, 
-        1840, 1473, 1104, 736, 367, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, -367, -736, -1104, -1473, -1840, -2208, -2577, 
-        -2944, -3312, -3681, -4048, -4417, -4786, -5154, -5522, -5891, -6258, -6627, -6995, 
-        -7362, -7731, -8099, -8466, -8835, -9203, -9572, -9941, -10309, -10676, -11045, -11413, 
-        -11782, -12149, -12517, -12886, -13253, -13621, -13990, -14359, -14727, -15096, -15463, -15831, 
-        -16200, -16567, -16936, -17304, -17671, -18040, -18408, -18776, -19146, -19514, -19881, -20250, 
-        -20618, -20985, -21354, -21722, -22091, -22458, -22826, -23195, -23563, -23932, -24301, -24668, 
-        -25036, -25405, -25772, -26140, -26509, -26876, -27245, -27613, -27981, -28350, -28719, -29086, 
-        -29455, -29823, -30190, -30559, -30927, -31294, -31663, -32031, -32400, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0023 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0023[600] PROGMEM = {
-        32767, 32352, 31938, 31523, 31109, 30694, 30278, 29864, 29449, 29035, 28620, 28204, 
-        27791, 27375, 26961, 26546, 26132, 25717, 25301, 24887, 24472, 24058, 23643, 23227, 
-        22814, 22398, 21983, 21569, 21154, 20738, 20323, 19909, 19494, 19080, 18664, 18249, 
-        17835, 17420, 17006, 16590, 16175, 15761, 15346, 14932, 14517, 14101, 13687, 13272, 
-        12858, 12443, 12029, 11613, 11198, 10784, 10369, 9955, 9540, 9124, 8710, 8295, 
-        7881, 7466, 7050, 6636, 6221, 5806, 5392, 4977, 4561, 4147, 3732, 3317, 
-        2903, 2487, 2072, 1658, 1243, 829, 413, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, -413, -829, -1243, -1658, -2072, -2487, -2903, -3317, -3732, 
-        -4147, -4561, -4977, -5392, -5806, -6221, -6636, -7050, -7466, -7881, -8295, -8710, 
-        -9124, -9540, -9955, -10369, -10784, -11198, -11613, -12029, -12443, -12858, -13272, -13687, 
-        -14101, -14517, -14932, -15346, -15761, -16175, -16590, -17006, -17420, -17835, -18249, -18664, 
-        -19080, -19494, -19909, -20323, -20738, -21154, -21569, -21983, -22398, -22814, -23227, -23643, 
-        -24058, -24472, -24887, -25301, -25717, -26132, -26546, -26961, -27375, -27791, -28204, -28620, 
-        -29035, -29449, -29864, -30278, -30694, -31109, -31523, -31938, -32352, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0024 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0024[600] PROGMEM = {
-        32767, 32294, 31819, 31344, 30869, 30394, 29919, 29444, 28969, 28494, 28020, 27545, 
-        27070, 26595, 26120, 25645, 25170, 24695, 24220, 23745, 23270, 22795, 22320, 21845, 
-        21370, 20895, 20420, 19946, 19471, 18996, 18521, 18046, 17571, 17096, 16621, 16146, 
-        15671, 15196, 14723, 14248, 13771, 13296, 12821, 12347, 11872, 11397, 10922, 10448, 
-        9973, 9498, 9022, 8547, 8072, 7597, 7122, 6649, 6174, 5699, 5224, 4749, 
-        4273, 3798, 3323, 2848, 2374, 1899, 1424, 949, 474, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, -474, -949, -1424, -1899, -2374, -2848, -3323, -3798, -4273, -4749, -5224, 
-        -5699, -6174, -6649, -7122, -7597, -8072, -8547, -9022, -9498, -9973, -10448, -10922, 
-        -11397, -11872, -12347, -12821, -13296, -13771, -14248, -14723, -15196, -15671, -16146, -16621, 
-        -17096, -17571, -18046, -18521, -18996, -19471, -19946, -20420, -20895, -21370, -21845, -22320, 
-        -22795, -23270, -23745, -24220, -24695, -25170, -25645, -26120, -26595, -27070, -27545, -28020, 
-        -28494, -28969, -29444, -29919, -30394, -30869, -31344, -31819, -32294, -32767, 0, 0 
-    };
-
-} // namespace AKWF_BwSawgap
@@ -1,980 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwSawgap {
-
-    // AKWF_gapsaw_0025 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0025[600] PROGMEM = {
-        32767, 32212, 31657, 31102, 30547, 29992, 29436, 28881, 28325, 27769, 27214, 26659, 
-        26104, 25549, 24993, 24438, 23882, 23326, 22771, 22216, 21661, 21104, 20549, 19994, 
-        19439, 18882, 18327, 17771, 17216, 16661, 16106, 15551, 14996, 14440, 13884, 13328, 
-        12773, 12218, 11663, 11108, 10553, 9997, 9441, 8885, 8330, 7775, 7220, 6665, 
-        6108, 5553, 4998, 4442, 3886, 3331, 2775, 2220, 1665, 1110, 555, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -555, 
-        -1110, -1665, -2220, -2775, -3331, -3886, -4442, -4998, -5553, -6108, -6665, -7220, 
-        -7775, -8330, -8885, -9441, -9997, -10553, -11108, -11663, -12218, -12773, -13328, -13884, 
-        -14440, -14996, -15551, -16106, -16661, -17216, -17771, -18327, -18882, -19439, -19994, -20549, 
-        -21104, -21661, -22216, -22771, -23326, -23882, -24438, -24993, -25549, -26104, -26659, -27214, 
-        -27769, -28325, -28881, -29436, -29992, -30547, -31102, -31657, -32212, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0026 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0026[600] PROGMEM = {
-        32767, 32099, 31430, 30761, 30093, 29424, 28755, 28087, 27418, 26749, 26081, 25411, 
-        24743, 24075, 23405, 22737, 22068, 21399, 20730, 20062, 19392, 18724, 18055, 17386, 
-        16718, 16049, 15380, 14712, 14043, 13374, 12705, 12037, 11368, 10699, 10031, 9362, 
-        8693, 8025, 7356, 6687, 6018, 5349, 4680, 4012, 3342, 2674, 2006, 1336, 
-        668, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, -668, -1336, -2006, 
-        -2674, -3342, -4012, -4680, -5349, -6018, -6687, -7356, -8025, -8693, -9362, -10031, 
-        -10699, -11368, -12037, -12705, -13374, -14043, -14712, -15380, -16049, -16718, -17386, -18055, 
-        -18724, -19392, -20062, -20730, -21399, -22068, -22737, -23405, -24075, -24743, -25411, -26081, 
-        -26749, -27418, -28087, -28755, -29424, -30093, -30761, -31430, -32099, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0027 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0027[600] PROGMEM = {
-        32767, 31928, 31088, 30248, 29408, 28567, 27727, 26887, 26047, 25207, 24367, 23526, 
-        22686, 21846, 21004, 20165, 19325, 18483, 17643, 16803, 15964, 15124, 14282, 13442, 
-        12602, 11763, 10923, 10083, 9241, 8401, 7562, 6722, 5880, 5040, 4200, 3359, 
-        2519, 1679, 839, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, -839, -1679, -2519, -3359, -4200, 
-        -5040, -5880, -6722, -7562, -8401, -9241, -10083, -10923, -11763, -12602, -13442, -14282, 
-        -15124, -15964, -16803, -17643, -18483, -19325, -20165, -21004, -21846, -22686, -23526, -24367, 
-        -25207, -26047, -26887, -27727, -28567, -29408, -30248, -31088, -31928, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0028 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0028[600] PROGMEM = {
-        32767, 31638, 30508, 29379, 28248, 27118, 25989, 24859, 23728, 22599, 21468, 20338, 
-        19207, 18078, 16948, 15819, 14689, 13558, 12429, 11299, 10170, 9039, 7909, 6780, 
-        5649, 4519, 3388, 2259, 1129, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, -1129, -2259, -3388, -4519, -5649, -6780, -7909, 
-        -9039, -10170, -11299, -12429, -13558, -14689, -15819, -16948, -18078, -19207, -20338, -21468, 
-        -22599, -23728, -24859, -25989, -27118, -28248, -29379, -30508, -31638, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0029 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0029[600] PROGMEM = {
-        32767, 31043, 29318, 27594, 25870, 24145, 22420, 20695, 18970, 17246, 15522, 13796, 
-        12072, 10348, 8623, 6898, 5173, 3448, 1724, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, -1724, -3448, -5173, -6898, -8623, -10348, -12072, -13796, -15522, 
-        -17246, -18970, -20695, -22420, -24145, -25870, -27594, -29318, -31043, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0030 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0030[600] PROGMEM = {
-        32767, 29126, 25485, 21844, 18203, 14562, 10923, 7282, 3639, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, -3639, -7282, -10923, -14562, -18203, -21844, -25485, -29126, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0031 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0031[600] PROGMEM = {
-        32767, 24575, 16383, 8192, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, -8192, -16383, -24575, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0032 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0032[600] PROGMEM = {
-        0, 0, 26403, 19802, 13200, 6601, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, -235, -471, -706, -943, -1178, -1414, -1649, 
-        -1886, -2121, -2357, -2592, -2827, -3064, -3299, -3535, -3770, -4007, -4242, -4478, 
-        -4715, -4950, -5186, -5421, -5658, -5893, -6129, -6364, -6601, -6836, -7071, -7307, 
-        -7542, -7779, -8014, -8250, -8485, -8722, -8957, -9193, -9430, -9665, -9901, -10136, 
-        -10373, -10608, -10843, -11079, -11314, -11551, -11786, -12022, -12257, -12494, -12729, -12965, 
-        -13200, -13437, -13672, -13907, -14145, -14380, -14616, -14851, -15086, -15323, -15558, -15794, 
-        -16030, -16266, -16501, -16737, -16973, -17209, -17444, -17679, -17916, -18151, -18387, -18622, 
-        -18859, -19095, -19330, -19567, -19802, -20038, -20273, -20510, -20745, -20981, -21216, -21453, 
-        -21688, -21923, -22159, -22394, -22631, -22866, -23102, -23337, -23574, -23810, -24045, -24282, 
-        -24517, -24753, -24988, -25225, -25460, -25695, -25931, -26166, -26403, -26638, -26874, -27109, 
-        -27346, -27581, -27817, -28052, -28289, -28525, -28760, -28997, -29232, -29467, -29703, -29938, 
-        -30175, -30410, -30646, -30881, -31118, -31353, -31589, -31824, -32061, -32296, -32531, -32767 
-    };
-
-    // AKWF_gapsaw_0033 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0033[600] PROGMEM = {
-        32273, 31615, 30955, 30297, 29639, 28979, 28321, 27663, 27004, 26346, 25687, 25028, 
-        24370, 23712, 23052, 22394, 21734, 21076, 20417, 19759, 19099, 18441, 17783, 17123, 
-        16465, 15807, 15148, 14489, 13831, 13172, 12514, 11856, 11196, 10538, 9880, 9220, 
-        8562, 7904, 7244, 6586, 5927, 5269, 4609, 3951, 3292, 2633, 1975, 1316, 
-        658, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, -163, -328, -493, -658, -823, -987, -1151, -1316, -1481, 
-        -1646, -1810, -1975, -2139, -2304, -2469, -2633, -2798, -2963, -3127, -3292, -3456, 
-        -3621, -3786, -3951, -4116, -4279, -4444, -4609, -4774, -4939, -5104, -5269, -5434, 
-        -5597, -5762, -5927, -6092, -6257, -6421, -6586, -6750, -6915, -7080, -7244, -7409, 
-        -7574, -7739, -7904, -8067, -8232, -8397, -8562, -8727, -8892, -9055, -9220, -9385, 
-        -9550, -9715, -9880, -10043, -10208, -10373, -10538, -10703, -10868, -11031, -11196, -11361, 
-        -11526, -11691, -11856, -12019, -12184, -12349, -12514, -12679, -12843, -13007, -13172, -13337, 
-        -13502, -13666, -13831, -13995, -14160, -14325, -14489, -14654, -14819, -14983, -15148, -15312, 
-        -15477, -15642, -15807, -15971, -16135, -16300, -16465, -16630, -16795, -16960, -17123, -17288, 
-        -17453, -17618, -17783, -17948, -18111, -18276, -18441, -18606, -18771, -18936, -19099, -19264, 
-        -19429, -19594, -19759, -19924, -20088, -20252, -20417, -20582, -20747, -20911, -21076, -21241, 
-        -21406, -21570, -21734, -21899, -22064, -22229, -22394, -22559, -22722, -22887, -23052, -23217, 
-        -23382, -23547, -23712, -23877, -24040, -24205, -24370, -24535, -24700, -24864, -25028, -25193, 
-        -25358, -25523, -25687, -25852, -26016, -26181, -26346, -26510, -26675, -26840, -27004, -27169, 
-        -27333, -27498, -27663, -27828, -27992, -28156, -28321, -28486, -28651, -28816, -28979, -29144, 
-        -29309, -29474, -29639, -29804, -29967, -30132, -30297, -30462, -30627, -30792, -30955, -31120, 
-        -31285, -31450, -31615, -31780, -31943, -32108, -32273, -32438, -32603, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0034 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0034[600] PROGMEM = {
-        0, 0, 32436, 31775, 31112, 30450, 29789, 29126, 28465, 27803, 27140, 26479, 
-        25817, 25154, 24493, 23832, 23169, 22507, 21844, 21183, 20520, 19859, 19196, 18534, 
-        17873, 17210, 16549, 15887, 15224, 14563, 13901, 13238, 12577, 11916, 11253, 10591, 
-        9930, 9267, 8605, 7944, 7281, 6620, 5957, 5295, 4632, 3971, 3308, 2647, 
-        1985, 1322, 661, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, -330, -661, -992, 
-        -1322, -1654, -1985, -2315, -2647, -2978, -3308, -3640, -3971, -4301, -4632, -4964, 
-        -5295, -5625, -5957, -6288, -6620, -6950, -7281, -7613, -7944, -8274, -8605, -8937, 
-        -9267, -9598, -9930, -10260, -10591, -10923, -11253, -11584, -11916, -12246, -12577, -12908, 
-        -13238, -13570, -13901, -14231, -14563, -14894, -15224, -15556, -15887, -16217, -16549, -16880, 
-        -17210, -17541, -17873, -18203, -18534, -18866, -19196, -19527, -19859, -20190, -20520, -20851, 
-        -21183, -21514, -21844, -22176, -22507, -22837, -23169, -23500, -23832, -24162, -24493, -24824, 
-        -25154, -25486, -25817, -26147, -26479, -26810, -27140, -27472, -27803, -28133, -28465, -28796, 
-        -29126, -29457, -29789, -30119, -30450, -30782, -31112, -31443, -31775, -32105, -32436, -32767 
-    };
-
-    // AKWF_gapsaw_0035 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0035[600] PROGMEM = {
-        32689, 32453, 32219, 31984, 31749, 31514, 31278, 31044, 30808, 30573, 30337, 30103, 
-        29867, 29633, 29397, 29162, 28928, 28692, 28457, 28221, 27985, 27751, 27515, 27281, 
-        27045, 26810, 26574, 26340, 26104, 25869, 25634, 25399, 25165, 24929, 24694, 24458, 
-        24224, 23988, 23753, 23517, 23282, 23047, 22811, 22577, 22341, 22106, 21870, 21636, 
-        21401, 21166, 20931, 20695, 20461, 20225, 19990, 19754, 19520, 19284, 19050, 18814, 
-        18578, 18343, 18107, 17873, 17637, 17402, 17168, 16932, 16698, 16462, 16227, 15991, 
-        15757, 15521, 15286, 15050, 14816, 14582, 14346, 14111, 13874, 13639, 13405, 13169, 
-        12934, 12699, 12464, 12228, 11994, 11758, 11523, 11287, 11053, 10817, 10583, 10348, 
-        10112, 9878, 9642, 9407, 9171, 8935, 8701, 8465, 8231, 7995, 7760, 7524, 
-        7290, 7054, 6819, 6585, 6349, 6115, 5879, 5644, 5408, 5174, 4938, 4703, 
-        4467, 4232, 3997, 3761, 3527, 3291, 3056, 2820, 2586, 2351, 2116, 1881, 
-        1645, 1411, 1175, 940, 704, 470, 234, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, -156, -314, -470, -626, -784, -940, -1097, 
-        -1253, -1411, -1567, -1723, -1881, -2037, -2194, -2351, -2508, -2664, -2820, -2978, 
-        -3134, -3291, -3449, -3605, -3761, -3919, -4075, -4232, -4389, -4546, -4703, -4860, 
-        -5016, -5174, -5330, -5486, -5644, -5800, -5957, -6115, -6271, -6427, -6585, -6741, 
-        -6898, -7054, -7212, -7368, -7524, -7682, -7838, -7995, -8152, -8309, -8465, -8621, 
-        -8779, -8935, -9092, -9250, -9407, -9564, -9720, -9878, -10034, -10190, -10348, -10504, 
-        -10661, -10817, -10975, -11131, -11287, -11445, -11601, -11758, -11916, -12072, -12228, -12386, 
-        -12542, -12699, -12855, -13013, -13169, -13325, -13483, -13639, -13796, -13953, -14111, -14267, 
-        -14424, -14582, -14738, -14894, -15050, -15208, -15365, -15521, -15679, -15835, -15991, -16149, 
-        -16305, -16462, -16618, -16776, -16932, -17088, -17246, -17402, -17559, -17717, -17873, -18029, 
-        -18187, -18343, -18500, -18656, -18814, -18971, -19128, -19284, -19442, -19598, -19754, -19912, 
-        -20068, -20225, -20383, -20539, -20695, -20851, -21009, -21166, -21322, -21480, -21636, -21792, 
-        -21950, -22106, -22263, -22419, -22577, -22733, -22889, -23047, -23203, -23360, -23517, -23675, 
-        -23832, -23988, -24146, -24302, -24458, -24615, -24772, -24929, -25085, -25243, -25399, -25555, 
-        -25713, -25869, -26026, -26183, -26340, -26496, -26652, -26810, -26967, -27123, -27281, -27437, 
-        -27593, -27751, -27907, -28064, -28221, -28378, -28535, -28692, -28848, -29006, -29162, -29318, 
-        -29476, -29633, -29789, -29947, -30103, -30259, -30416, -30573, -30730, -30886, -31044, -31200, 
-        -31356, -31514, -31670, -31827, -31984, -32141, -32297, -32453, -32611, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0036 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0036[600] PROGMEM = {
-        32767, 32436, 32105, 31775, 31443, 31112, 30782, 30450, 30119, 29789, 29457, 29126, 
-        28796, 28465, 28133, 27803, 27472, 27140, 26810, 26479, 26147, 25817, 25486, 25154, 
-        24824, 24493, 24162, 23832, 23500, 23169, 22837, 22507, 22176, 21844, 21514, 21183, 
-        20851, 20520, 20190, 19859, 19527, 19196, 18866, 18534, 18203, 17873, 17541, 17210, 
-        16880, 16549, 16217, 15887, 15556, 15224, 14894, 14563, 14231, 13901, 13570, 13238, 
-        12908, 12577, 12246, 11916, 11584, 11253, 10923, 10591, 10260, 9930, 9598, 9267, 
-        8937, 8605, 8274, 7944, 7613, 7281, 6950, 6620, 6288, 5957, 5625, 5295, 
-        4964, 4632, 4301, 3971, 3640, 3308, 2978, 2647, 2315, 1985, 1654, 1322, 
-        992, 661, 330, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, -6620, -13238, -19859, -26479, 0, 0 
-    };
-
-    // AKWF_gapsaw_0037 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0037[600] PROGMEM = {
-        32675, 32401, 32126, 31852, 31577, 31303, 31028, 30754, 30479, 30205, 29930, 29656, 
-        29381, 29107, 28832, 28558, 28283, 28007, 27733, 27458, 27184, 26909, 26635, 26360, 
-        26086, 25811, 25537, 25262, 24988, 24713, 24439, 24164, 23890, 23614, 23340, 23065, 
-        22791, 22516, 22242, 21967, 21693, 21418, 21142, 20868, 20593, 20319, 20044, 19770, 
-        19495, 19221, 18946, 18670, 18396, 18121, 17847, 17572, 17298, 17024, 16749, 16475, 
-        16200, 15926, 15651, 15377, 15102, 14828, 14553, 14279, 14003, 13728, 13454, 13179, 
-        12905, 12630, 12356, 12081, 11807, 11532, 11258, 10983, 10709, 10434, 10160, 9885, 
-        9611, 9335, 9060, 8786, 8512, 8237, 7963, 7688, 7414, 7139, 6865, 6590, 
-        6314, 6040, 5765, 5491, 5216, 4942, 4667, 4393, 4118, 3842, 3568, 3293, 
-        3019, 2744, 2470, 2195, 1921, 1646, 1372, 1097, 823, 548, 274, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -183, 
-        -365, -548, -732, -914, -1097, -1281, -1464, -1646, -1830, -2013, -2195, -2379, 
-        -2562, -2744, -2928, -3111, -3293, -3477, -3660, -3842, -4026, -4209, -4393, -4575, 
-        -4760, -4942, -5125, -5309, -5491, -5674, -5858, -6040, -6223, -6407, -6590, -6772, 
-        -6956, -7139, -7321, -7505, -7688, -7870, -8054, -8237, -8419, -8603, -8786, -8968, 
-        -9152, -9335, -9518, -9702, -9885, -10067, -10251, -10434, -10616, -10800, -10983, -11165, 
-        -11349, -11532, -11716, -11898, -12081, -12265, -12447, -12630, -12814, -12996, -13179, -13363, 
-        -13545, -13728, -13912, -14095, -14279, -14462, -14644, -14828, -15011, -15193, -15377, -15560, 
-        -15742, -15926, -16109, -16291, -16475, -16658, -16841, -17024, -17207, -17390, -17572, -17756, 
-        -17939, -18121, -18305, -18488, -18670, -18855, -19039, -19221, -19404, -19588, -19770, -19953, 
-        -20137, -20319, -20502, -20686, -20868, -21051, -21235, -21418, -21600, -21784, -21967, -22149, 
-        -22333, -22516, -22698, -22882, -23065, -23247, -23431, -23614, -23798, -23981, -24164, -24347, 
-        -24530, -24713, -24896, -25079, -25262, -25444, -25628, -25811, -25993, -26177, -26360, -26544, 
-        -26726, -26909, -27093, -27275, -27458, -27642, -27824, -28007, -28191, -28374, -28558, -28740, 
-        -28923, -29107, -29290, -29472, -29656, -29839, -30021, -30205, -30388, -30570, -30754, -30937, 
-        -31119, -31303, -31486, -31670, -31852, -32035, -32219, -32401, -32584, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0038 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0038[600] PROGMEM = {
-        32753, 32627, 32501, 32374, 32248, 32122, 31995, 31869, 31743, 31615, 31489, 31362, 
-        31236, 31110, 30984, 30857, 30731, 30605, 30478, 30351, 30224, 30098, 29972, 29845, 
-        29719, 29593, 29466, 29340, 29214, 29088, 28960, 28833, 28707, 28581, 28455, 28328, 
-        28202, 28074, 27948, 27822, 27695, 27569, 27443, 27316, 27189, 27062, 26936, 26810, 
-        26683, 26557, 26431, 26304, 26178, 26052, 25926, 25798, 25671, 25545, 25419, 25293, 
-        25166, 25040, 24914, 24787, 24661, 24535, 24407, 24281, 24154, 24028, 23902, 23775, 
-        23649, 23523, 23395, 23269, 23142, 23016, 22890, 22764, 22636, 22509, 22383, 22257, 
-        22131, 22004, 21878, 21752, 21625, 21499, 21373, 21245, 21119, 20992, 20866, 20740, 
-        20613, 20487, 20361, 20235, 20108, 19980, 19854, 19728, 19602, 19475, 19349, 19223, 
-        19096, 18970, 18844, 18716, 18590, 18463, 18337, 18209, 18083, 17957, 17830, 17704, 
-        17578, 17451, 17325, 17199, 17073, 16946, 16818, 16692, 16566, 16440, 16313, 16187, 
-        16061, 15934, 15808, 15682, 15555, 15428, 15301, 15175, 15049, 14922, 14796, 14670, 
-        14544, 14417, 14291, 14165, 14037, 13911, 13784, 13657, 13530, 13404, 13278, 13151, 
-        13025, 12899, 12772, 12646, 12520, 12393, 12266, 12139, 12013, 11887, 11760, 11634, 
-        11508, 11382, 11255, 11129, 11001, 10875, 10749, 10622, 10496, 10370, 10243, 10117, 
-        9991, 9864, 9738, 9610, 9484, 9358, 9230, 9104, 8977, 8851, 8725, 8598, 
-        8472, 8346, 8220, 8093, 7967, 7839, 7713, 7587, 7460, 7334, 7208, 7081, 
-        6955, 6829, 6702, 6576, 6448, 6322, 6196, 6069, 5943, 5817, 5691, 5564, 
-        5438, 5312, 5185, 5058, 4931, 4805, 4677, 4551, 4425, 4298, 4172, 4046, 
-        3919, 3793, 3667, 3540, 3414, 3286, 3160, 3034, 2907, 2781, 2655, 2529, 
-        2402, 2276, 2150, 2022, 1896, 1769, 1643, 1517, 1390, 1264, 1138, 1011, 
-        885, 759, 631, 505, 378, 252, 126, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, -112, -225, -339, 
-        -452, -566, -679, -793, -905, -1018, -1132, -1246, -1359, -1473, -1586, -1700, 
-        -1813, -1927, -2040, -2152, -2266, -2380, -2493, -2607, -2720, -2834, -2947, -3061, 
-        -3174, -3286, -3400, -3513, -3627, -3741, -3854, -3968, -4081, -4195, -4308, -4420, 
-        -4534, -4647, -4761, -4874, -4988, -5102, -5215, -5329, -5442, -5554, -5668, -5781, 
-        -5895, -6008, -6122, -6235, -6349, -6463, -6576, -6688, -6802, -6915, -7029, -7142, 
-        -7256, -7369, -7483, -7597, -7710, -7822, -7936, -8049, -8163, -8276, -8390, -8503, 
-        -8617, -8730, -8844, -8956, -9070, -9183, -9297, -9410, -9524, -9637, -9751, -9864, 
-        -9978, -10090, -10204, -10317, -10431, -10544, -10658, -10771, -10885, -10997, -11110, -11224, 
-        -11338, -11451, -11563, -11677, -11790, -11904, -12017, -12131, -12244, -12358, -12471, -12585, 
-        -12697, -12811, -12924, -13038, -13151, -13265, -13378, -13492, -13605, -13719, -13831, -13945, 
-        -14058, -14172, -14285, -14399, -14512, -14626, -14739, -14853, -14965, -15079, -15192, -15306, 
-        -15419, -15533, -15646, -15760, -15873, -15987, -16099, -16212, -16326, -16440, -16553, -16667, 
-        -16780, -16894, -17007, -17121, -17233, -17346, -17460, -17574, -17687, -17801, -17914, -18028, 
-        -18141, -18255, -18367, -18480, -18594, -18707, -18821, -18935, -19048, -19162, -19275, -19389, 
-        -19501, -19614, -19728, -19841, -19955, -20068, -20182, -20296, -20409, -20523, -20635, -20748, 
-        -20862, -20975, -21089, -21202, -21316, -21429, -21543, -21657, -21770, -21882, -21996, -22109, 
-        -22221, -22335, -22448, -22562, -22676, -22789, -22903, -23016, -23130, -23243, -23355, -23469, 
-        -23582, -23696, -23809, -23923, -24037, -24150, -24264, -24377, -24489, -24603, -24716, -24830, 
-        -24943, -25057, -25171, -25284, -25398, -25511, -25623, -25737, -25850, -25964, -26077, -26191, 
-        -26304, -26418, -26532, -26645, -26757, -26871, -26984, -27098, -27211, -27325, -27438, -27552, 
-        -27665, -27779, -27891, -28005, -28118, -28232, -28345, -28459, -28572, -28686, -28799, -28913, 
-        -29025, -29139, -29252, -29366, -29479, -29593, -29706, -29820, -29933, -30047, -30159, -30273, 
-        -30386, -30500, -30613, -30727, -30840, -30954, -31067, -31181, -31293, -31406, -31520, -31634, 
-        -31747, -31861, -31974, -32088, -32201, -32315, -32427, -32540, -32654, -32767, 0, 0 
-    };
-
-    // AKWF_gapsaw_0039 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0039[600] PROGMEM = {
-        32767, 32611, 32453, 32297, 32141, 31984, 31827, 31670, 31514, 31356, 31200, 31044, 
-        30886, 30730, 30573, 30416, 30259, 30103, 29947, 29789, 29633, 29476, 29318, 29162, 
-        29006, 28848, 28692, 28535, 28378, 28221, 28064, 27907, 27751, 27593, 27437, 27281, 
-        27123, 26967, 26810, 26652, 26496, 26340, 26183, 26026, 25869, 25713, 25555, 25399, 
-        25243, 25085, 24929, 24772, 24615, 24458, 24302, 24146, 23988, 23832, 23675, 23517, 
-        23360, 23203, 23047, 22889, 22733, 22577, 22419, 22263, 22106, 21950, 21792, 21636, 
-        21480, 21322, 21166, 21009, 20851, 20695, 20539, 20383, 20225, 20068, 19912, 19754, 
-        19598, 19442, 19284, 19128, 18971, 18814, 18656, 18500, 18343, 18187, 18029, 17873, 
-        17717, 17559, 17402, 17246, 17088, 16932, 16776, 16618, 16462, 16305, 16149, 15991, 
-        15835, 15679, 15521, 15365, 15208, 15050, 14894, 14738, 14582, 14424, 14267, 14111, 
-        13953, 13796, 13639, 13483, 13325, 13169, 13013, 12855, 12699, 12542, 12386, 12228, 
-        12072, 11916, 11758, 11601, 11445, 11287, 11131, 10975, 10817, 10661, 10504, 10348, 
-        10190, 10034, 9878, 9720, 9564, 9407, 9250, 9092, 8935, 8779, 8621, 8465, 
-        8309, 8152, 7995, 7838, 7682, 7524, 7368, 7212, 7054, 6898, 6741, 6585, 
-        6427, 6271, 6115, 5957, 5800, 5644, 5486, 5330, 5174, 5016, 4860, 4703, 
-        4546, 4389, 4232, 4075, 3919, 3761, 3605, 3449, 3291, 3134, 2978, 2820, 
-        2664, 2508, 2351, 2194, 2037, 1881, 1723, 1567, 1411, 1253, 1097, 940, 
-        784, 626, 470, 314, 156, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, -328, -657, -987, -1315, -1645, 
-        -1975, -2303, -2633, -2963, -3291, -3620, -3950, -4278, -4608, -4938, -5268, -5596, 
-        -5926, -6255, -6585, -6913, -7243, -7573, -7902, -8231, -8560, -8890, -9218, -9548, 
-        -9878, -10206, -10536, -10865, -11194, -11523, -11853, -12181, -12511, -12841, -13169, -13499, 
-        -13828, -14157, -14486, -14816, -15144, -15474, -15804, -16132, -16462, -16791, -17120, -17449, 
-        -17779, -18107, -18437, -18767, -19095, -19425, -19754, -20084, -20412, -20742, -21072, -21401, 
-        -21730, -22059, -22389, -22717, -23047, -23377, -23706, -24035, -24364, -24694, -25022, -25352, 
-        -25682, -26010, -26340, -26670, -26998, -27327, -27657, -27985, -28315, -28645, -28973, -29303, 
-        -29633, -29961, -30291, -30620, -30948, -31278, -31608, -31936, -32266, -32596, 0, 0 
-    };
-
-    // AKWF_gapsaw_0040 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0040[600] PROGMEM = {
-        32767, 32658, 32549, 32440, 32329, 32220, 32110, 32001, 31891, 31781, 31672, 31563, 
-        31453, 31343, 31233, 31124, 31015, 30904, 30795, 30686, 30576, 30467, 30356, 30247, 
-        30138, 30029, 29918, 29809, 29699, 29590, 29481, 29370, 29261, 29152, 29042, 28932, 
-        28822, 28713, 28604, 28495, 28384, 28275, 28165, 28056, 27945, 27836, 27727, 27618, 
-        27508, 27398, 27288, 27179, 27070, 26959, 26850, 26741, 26631, 26522, 26411, 26302, 
-        26193, 26084, 25973, 25864, 25754, 25645, 25536, 25425, 25316, 25207, 25097, 24987, 
-        24877, 24768, 24659, 24550, 24439, 24330, 24220, 24111, 24000, 23891, 23782, 23673, 
-        23562, 23453, 23343, 23234, 23123, 23014, 22905, 22796, 22685, 22576, 22466, 22357, 
-        22246, 22137, 22028, 21919, 21808, 21699, 21589, 21480, 21371, 21260, 21151, 21042, 
-        20932, 20822, 20712, 20603, 20494, 20383, 20274, 20165, 20055, 19945, 19835, 19726, 
-        19617, 19506, 19397, 19288, 19178, 19068, 18958, 18849, 18740, 18629, 18520, 18411, 
-        18301, 18192, 18081, 17972, 17863, 17754, 17643, 17534, 17424, 17315, 17206, 17095, 
-        16986, 16877, 16767, 16657, 16547, 16438, 16329, 16220, 16109, 16000, 15890, 15781, 
-        15670, 15561, 15452, 15343, 15233, 15123, 15013, 14904, 14795, 14684, 14575, 14466, 
-        14356, 14247, 14136, 14027, 13918, 13809, 13698, 13589, 13479, 13370, 13261, 13150, 
-        13041, 12932, 12822, 12712, 12602, 12493, 12384, 12275, 12164, 12055, 11945, 11836, 
-        11725, 11616, 11507, 11398, 11288, 11178, 11068, 10959, 10850, 10739, 10630, 10521, 
-        10411, 10301, 10191, 10082, 9973, 9864, 9753, 9644, 9534, 9425, 9314, 9205, 
-        9096, 8987, 8877, 8767, 8657, 8548, 8439, 8328, 8219, 8110, 8000, 7891, 
-        7780, 7671, 7562, 7453, 7342, 7233, 7123, 7014, 6903, 6794, 6685, 6576, 
-        6465, 6356, 6246, 6137, 6026, 5917, 5808, 5699, 5588, 5479, 5369, 5260, 
-        5149, 5040, 4931, 4822, 4711, 4602, 4492, 4383, 4272, 4163, 4054, 3945, 
-        3834, 3725, 3615, 3506, 3395, 3286, 3177, 3068, 2958, 2848, 2738, 2629, 
-        2520, 2409, 2300, 2191, 2081, 1972, 1861, 1752, 1643, 1534, 1423, 1314, 
-        1204, 1095, 986, 875, 766, 657, 547, 437, 327, 218, 109, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, -6576, -13150, -19726, -26302, 0, 0 
-    };
-
-    // AKWF_gapsaw_0041 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0041[600] PROGMEM = {
-        0, 0, 32689, 32135, 31581, 31027, 30473, 29919, 29365, 28812, 28256, 27702, 
-        27149, 26595, 26041, 25487, 24933, 24379, 23824, 23270, 22716, 22162, 21609, 21053, 
-        20499, 19946, 19392, 18836, 18283, 17729, 17175, 16621, 16067, 15513, 14959, 14406, 
-        13850, 13296, 12743, 12189, 11635, 11081, 10527, 9973, 9418, 8864, 8310, 7756, 
-        7203, 6649, 6093, 5540, 4986, 4432, 3877, 3323, 2769, 2215, 1661, 1107, 
-        553, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, -474, -949, -1424, -1899, -2374, -2848, -3323, -3798, -4273, 
-        -4749, -5224, -5699, -6174, -6649, -7122, -7597, -8072, -8547, -9022, -9498, -9973, 
-        -10448, -10922, -11397, -11872, -12347, -12821, -13296, -13771, -14248, -14723, -15196, -15671, 
-        -16146, -16621, -17096, -17571, -18046, -18521, -18996, -19471, -19946, -20420, -20895, -21370, 
-        -21845, -22320, -22795, -23270, -23745, -24220, -24695, -25170, -25645, -26120, -26595, -27070, 
-        -27545, -28020, -28494, -28969, -29444, -29919, -30394, -30869, -31344, -31819, -32294, -32767 
-    };
-
-    // AKWF_gapsaw_0042 → 600 samples
-    static const int16_t akwf_akwf_bwsawgap_akwf_gapsaw_0042[600] PROGMEM = {
-        32767, 32650, 32532, 32414, 32298, 32180, 32062, 31946, 31828, 31710, 31592, 31476, 
-        31358, 31240, 31122, 31006, 30888, 30770, 30654, 30536, 30418, 30301, 30184, 30066, 
-        29949, 29831, 29714, 29597, 29479, 29361, 29245, 29127, 29009, 28893, 28775, 28657, 
-        28539, 28423, 28305, 28187, 28069, 27952, 27834, 27717, 27600, 27482, 27364, 27248, 
-        27130, 27012, 26894, 26778, 26660, 26542, 26426, 26308, 26190, 26072, 25956, 25838, 
-        25720, 25602, 25486, 25368, 25250, 25134, 25016, 24898, 24781, 24664, 24546, 24429, 
-        24311, 24194, 24077, 23959, 23842, 23725, 23607, 23489, 23371, 23253, 23136, 23019, 
-        22901, 22784, 22667, 22549, 22432, 22314, 22197, 22080, 21962, 21844, 21728, 21610, 
-        21492, 21375, 21258, 21140, 21022, 20906, 20788, 20670, 20552, 20436, 20318, 20200, 
-        20082, 19966, 19848, 19730, 19614, 19496, 19378, 19261, 19144, 19026, 18909, 18791, 
-        18673, 18555, 18439, 18321, 18203, 18085, 17969, 17851, 17733, 17616, 17499, 17381, 
-        17264, 17147, 17029, 16912, 16794, 16677, 16560, 16442, 16324, 16207, 16090, 15972, 
-        15855, 15738, 15620, 15502, 15386, 15268, 15150, 15032, 14916, 14798, 14680, 14564, 
-        14446, 14328, 14210, 14094, 13975, 13857, 13741, 13623, 13505, 13389, 13271, 13153, 
-        13035, 12919, 12801, 12683, 12565, 12449, 12331, 12213, 12096, 11979, 11861, 11744, 
-        11627, 11509, 11392, 11274, 11157, 11040, 10922, 10804, 10687, 10570, 10452, 10335, 
-        10218, 10100, 9982, 9866, 9748, 9630, 9512, 9396, 9277, 9160, 9042, 8925, 
-        8807, 8690, 8573, 8455, 8337, 8221, 8103, 7985, 7869, 7751, 7633, 7515, 
-        7399, 7281, 7163, 7045, 6929, 6811, 6693, 6577, 6459, 6341, 6224, 6107, 
-        5989, 5872, 5754, 5637, 5520, 5402, 5285, 5167, 5050, 4932, 4815, 4698, 
-        4578, 4462, 4344, 4226, 4110, 3992, 3874, 3757, 3640, 3522, 3405, 3287, 
-        3170, 3053, 2935, 2817, 2701, 2583, 2465, 2349, 2231, 2113, 1995, 1879, 
-        1761, 1643, 1525, 1409, 1291, 1173, 1057, 939, 821, 704, 587, 469, 
-        352, 234, 117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-        0, 0, 0, 0, 0, -364, -730, -1095, -1461, -1826, -2191, -2557, 
-        -2922, -3287, -3653, -4018, -4384, -4750, -5115, -5480, -5846, -6211, -6577, -6942, 
-        -7307, -7673, -8037, -8402, -8768, -9133, -9499, -9866, -10230, -10595, -10961, -11326, 
-        -11692, -12057, -12422, -12788, -13153, -13518, -13884, -14250, -14615, -14981, -15346, -15711, 
-        -16077, -16442, -16808, -17173, -17537, -17904, -18268, -18633, -19001, -19366, -19730, -20097, 
-        -20461, -20826, -21192, -21557, -21923, -22288, -22653, -23019, -23384, -23750, -24116, -24481, 
-        -24846, -25212, -25577, -25942, -26308, -26673, -27039, -27404, -27768, -28135, -28501, -28866, 
-        -29232, -29597, -29961, -30328, -30692, -31057, -31423, -31788, -32154, -32519, 0, 0 
-    };
-
-} // namespace AKWF_BwSawgap
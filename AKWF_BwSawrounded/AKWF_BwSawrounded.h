@@ -1,72 +1,1014 @@
-// Auto‑generated AKWF bank. Do not edit manually.
+// Auto‑generated AKWF bank (compressed, see AKWFCodec.h). Do not edit manually.
 
 #pragma once
 #include <Arduino.h>
 
-#include "AKWF_BwSawrounded_Tables_Part0.h"
-#include "AKWF_BwSawrounded_Tables_Part1.h"
-#include "AKWF_BwSawrounded_Tables_Part2.h"
-
 namespace AKWF_BwSawrounded {
+
     constexpr uint16_t count = 52;
-}
 
-// Return a pointer to the n‑th waveform table in this bank.
-// If index is out of range, returns nullptr and length is set to 0.
-inline const int16_t* AKWF_BwSawrounded_get(uint16_t index, uint16_t &length) {
-    switch(index) {
-        case 0: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_01;
-        case 1: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_02;
-        case 2: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_03;
-        case 3: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_04;
-        case 4: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_05;
-        case 5: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_06;
-        case 6: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_07;
-        case 7: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_08;
-        case 8: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_09;
-        case 9: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_10;
-        case 10: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_11;
-        case 11: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_12;
-        case 12: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_13;
-        case 13: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_14;
-        case 14: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_15;
-        case 15: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_16;
-        case 16: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_17;
-        case 17: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_18;
-        case 18: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_19;
-        case 19: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_20;
-        case 20: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_21;
-        case 21: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_22;
-        case 22: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_23;
-        case 23: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_24;
-        case 24: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_25;
-        case 25: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_asym_saw_26;
-        case 26: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_01;
-        case 27: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_02;
-        case 28: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_03;
-        case 29: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_04;
-        case 30: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_05;
-        case 31: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_06;
-        case 32: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_07;
-        case 33: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_08;
-        case 34: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_09;
-        case 35: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_10;
-        case 36: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_11;
-        case 37: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_12;
-        case 38: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_13;
-        case 39: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_14;
-        case 40: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_15;
-        case 41: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_16;
-        case 42: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_17;
-        case 43: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_18;
-        case 44: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_19;
-        case 45: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_20;
-        case 46: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_21;
-        case 47: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_22;
-        case 48: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_23;
-        case 49: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_24;
-        case 50: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_25;
-        case 51: length = 600; return AKWF_BwSawrounded::akwf_akwf_bwsawrounded_akwf_r_sym_saw_26;
-        default: length = 0; return nullptr;
-    }
-}
+    // 62400 bytes as int16 → 15095 bytes
+
+    static const uint8_t data[15095] PROGMEM = {
+        0x02, 0x5E, 0x67, 0xFF, 0xDA, 0x00, 0x12, 0xC0, 0x00, 0xD0, 0x00, 0x34, 0x00, 0x0D, 0x38, 0xD2,
+        0xD9, 0x0B, 0xB4, 0x76, 0x51, 0xD8, 0xE7, 0xAE, 0xCE, 0x76, 0xAD, 0x6D, 0x31, 0xAD, 0xAB, 0x3A,
+        0x54, 0xAE, 0x44, 0x57, 0x25, 0x0E, 0xD7, 0x3D, 0x72, 0x39, 0x00, 0x17, 0x28, 0x8E, 0x51, 0xE5,
+        0x15, 0xDA, 0x07, 0x64, 0x0A, 0xE4, 0x0E, 0x40, 0x03, 0x91, 0xCF, 0x5B, 0x22, 0x36, 0x42, 0xEF,
+        0xC7, 0x7B, 0xEB, 0xB4, 0x3B, 0xF0, 0x5C, 0x8E, 0x78, 0xD8, 0xE7, 0xAE, 0x40, 0xD9, 0x00, 0x16,
+        0xC8, 0x47, 0x64, 0x6F, 0xAE, 0xD1, 0xDF, 0x5D, 0x99, 0x56, 0xD5, 0x12, 0x0A, 0x85, 0xB9, 0xDA,
+        0xB6, 0xA9, 0x17, 0x7D, 0x72, 0x8F, 0x3D, 0x6C, 0xA3, 0xBE, 0x36, 0x76, 0x5C, 0x6C, 0x14, 0x3B,
+        0xF1, 0xC8, 0xE7, 0x8D, 0x80, 0x0C, 0x2B, 0x6A, 0x85, 0x6D, 0x3A, 0x54, 0x2B, 0x85, 0xED, 0x33,
+        0x1A, 0xE1, 0x7B, 0x4C, 0x67, 0x49, 0xDA, 0xE4, 0x33, 0xB1, 0x76, 0x80, 0x3B, 0xEB, 0x90, 0x57,
+        0x3D, 0x72, 0x3A, 0x2F, 0xDF, 0x43, 0x9E, 0xB9, 0x47, 0x9E, 0x86, 0xC8, 0x08, 0xBB, 0xEB, 0x67,
+        0xAF, 0xCF, 0x08, 0xEC, 0xA2, 0x8A, 0x3B, 0x95, 0xAE, 0x41, 0x7C, 0x2B, 0x6B, 0x90, 0x00, 0x54,
+        0xE9, 0x3B, 0x54, 0x02, 0xB6, 0x0A, 0x80, 0x5B, 0x9D, 0x80, 0x87, 0x3E, 0x3B, 0x00, 0x23, 0xCF,
+        0x5B, 0x3D, 0x72, 0x8C, 0x67, 0x4A, 0xE1, 0x7C, 0x2E, 0x05, 0x5A, 0x04, 0xED, 0x72, 0x45, 0x03,
+        0x0F, 0x7D, 0x76, 0x80, 0x28, 0x11, 0xDF, 0x5C, 0xF5, 0xC9, 0x40, 0x0E, 0x7A, 0x1C, 0x82, 0xE3,
+        0x60, 0x01, 0xBE, 0x07, 0x3D, 0x72, 0x3A, 0xE4, 0x10, 0xDF, 0x00, 0x73, 0xD6, 0xCF, 0x5C, 0xA2,
+        0x06, 0xCB, 0x81, 0xBE, 0x39, 0xF1, 0xD8, 0x45, 0x10, 0xBB, 0xF0, 0x47, 0x7C, 0x6C, 0xAE, 0x36,
+        0x51, 0xDF, 0x08, 0xEC, 0xED, 0x7C, 0x2A, 0x24, 0x03, 0x87, 0x3A, 0x10, 0x0C, 0xEC, 0x77, 0xC2,
+        0xB6, 0xB9, 0x05, 0xAE, 0x40, 0x15, 0xB0, 0x91, 0xD6, 0xD5, 0xB5, 0x69, 0x30, 0x0B, 0x54, 0x00,
+        0x02, 0xAA, 0x71, 0x96, 0xA4, 0x62, 0x56, 0xB1, 0x2A, 0xB4, 0xAB, 0x11, 0x9E, 0xAC, 0xE3, 0x49,
+        0xAB, 0x53, 0xB4, 0x3B, 0x53, 0x2E, 0xA9, 0x97, 0x3A, 0xA7, 0x03, 0x51, 0x8E, 0x14, 0xB6, 0x03,
+        0xD0, 0x4B, 0xA0, 0x95, 0x86, 0xC4, 0x5C, 0x00, 0xB8, 0x00, 0x75, 0xCF, 0x43, 0x9E, 0x80, 0x22,
+        0x80, 0xE7, 0xA1, 0xC8, 0xEB, 0x90, 0xBB, 0xEB, 0x92, 0x01, 0x1E, 0x42, 0x23, 0x65, 0x76, 0xBA,
+        0xFE, 0x4B, 0xC7, 0x25, 0x72, 0x00, 0xE4, 0x0E, 0x40, 0xE7, 0xA3, 0x9D, 0xED, 0x3B, 0xE1, 0x72,
+        0x02, 0x5A, 0x9F, 0xFF, 0xF1, 0x80, 0x24, 0x70, 0x07, 0x00, 0x91, 0xC0, 0x24, 0x70, 0x09, 0x08,
+        0xB3, 0x95, 0x95, 0xEF, 0x59, 0xBB, 0x2B, 0xDF, 0x1E, 0xC1, 0x0B, 0xB3, 0x63, 0x2B, 0x36, 0x32,
+        0x07, 0x78, 0x2F, 0x20, 0x65, 0x66, 0xCA, 0xCA, 0xCE, 0x51, 0xB2, 0xB2, 0xB2, 0x2F, 0x3A, 0xF3,
+        0x8E, 0xF1, 0x9B, 0x16, 0x40, 0xDA, 0xDA, 0xCA, 0x37, 0x65, 0x64, 0x02, 0xCA, 0xCA, 0xDA, 0x19,
+        0x59, 0x03, 0x2B, 0x20, 0x4E, 0xB3, 0xD3, 0xA1, 0xEC, 0x7A, 0x75, 0x18, 0xF7, 0xBE, 0x74, 0xF4,
+        0x3A, 0x1E, 0xC4, 0xAC, 0x0B, 0x2B, 0x20, 0x2D, 0xAC, 0xEB, 0x36, 0x5A, 0xDC, 0xE3, 0x28, 0xD8,
+        0x16, 0x50, 0xC8, 0x21, 0x78, 0xBC, 0xEB, 0x2B, 0x7C, 0x64, 0x67, 0x59, 0x43, 0xE8, 0x07, 0x58,
+        0x7A, 0x07, 0x40, 0x8A, 0xB2, 0x2F, 0x5B, 0x57, 0x8C, 0xA2, 0xB2, 0x20, 0x1D, 0x61, 0xEF, 0xCF,
+        0x43, 0xA7, 0x85, 0x79, 0xD6, 0x75, 0x79, 0xC0, 0xB0, 0x05, 0xE3, 0x24, 0x8D, 0xEB, 0x20, 0x01,
+        0x78, 0xB2, 0xB3, 0xA1, 0xF4, 0x88, 0x74, 0x01, 0xDF, 0x3D, 0x09, 0x1B, 0xD6, 0xD0, 0x00, 0x5E,
+        0x32, 0x81, 0x2B, 0xD6, 0x71, 0x24, 0x0B, 0xC6, 0x78, 0xDA, 0x04, 0xA6, 0xA6, 0xAD, 0x10, 0xB7,
+        0xC6, 0x71, 0x65, 0x10, 0x19, 0xE0, 0xD9, 0x08, 0xA2, 0xB7, 0xC6, 0x48, 0x0C, 0x5D, 0xE0, 0x0C,
+        0xAC, 0x59, 0x45, 0x0B, 0x3D, 0xF9, 0xEF, 0x9A, 0x80, 0x11, 0xF4, 0xB8, 0xDA, 0xC5, 0x82, 0x80,
+        0x33, 0x53, 0x52, 0x55, 0x24, 0x04, 0x42, 0x37, 0x81, 0x7A, 0xD9, 0x2D, 0x6D, 0x00, 0x00, 0x19,
+        0xD0, 0xCE, 0xB2, 0x5A, 0xB2, 0xB1, 0x90, 0x8A, 0x28, 0xDE, 0x89, 0x5E, 0x26, 0xAF, 0x16, 0x35,
+        0x90, 0x00, 0x00, 0x80, 0x00, 0x5E, 0x00, 0xCE, 0xAF, 0x17, 0x8C, 0x8C, 0xF3, 0xD8, 0x79, 0xEC,
+        0x60, 0xC6, 0x0A, 0x08, 0x44, 0x94, 0x08, 0x44, 0xC4, 0xC6, 0xDA, 0xCE, 0xDA, 0xC6, 0xC6, 0xBD,
+        0x90, 0xB3, 0x2F, 0x4C, 0xA9, 0x1A, 0x14, 0xC6, 0xA2, 0x34, 0xE3, 0x49, 0x34, 0x92, 0x05, 0xAF,
+        0x5E, 0xB1, 0xAC, 0x6B, 0x18, 0x54, 0x86, 0x35, 0x92, 0x1A, 0xCE, 0xB2, 0x11, 0x16, 0x06, 0x45,
+        0x82, 0x16, 0x6E, 0xC1, 0x9D, 0xAB, 0x37, 0x66, 0xC9, 0x6E, 0x4D, 0xE5, 0x67, 0x2B, 0x23, 0xCE,
+        0xBC, 0x82, 0xCA, 0xCE, 0x56, 0x6C, 0x00, 0x02, 0x5F, 0xF9, 0x5F, 0xFE, 0x40, 0xA6, 0x80, 0x58,
+        0xE2, 0x8E, 0x58, 0x02, 0x9A, 0x38, 0x46, 0x94, 0xDC, 0xCD, 0xCC, 0xDE, 0xC4, 0xDC, 0xDE, 0xC1,
+        0x4D, 0xC8, 0xE6, 0x64, 0x72, 0x2F, 0x6B, 0x2B, 0x92, 0x91, 0x7B, 0x03, 0x95, 0xDA, 0xB1, 0xB1,
+        0x72, 0x52, 0x5D, 0xDA, 0x9B, 0xB5, 0x36, 0x39, 0xC7, 0x24, 0xB2, 0xC5, 0xC8, 0xE6, 0xB7, 0x8E,
+        0xD5, 0xC8, 0x1D, 0x3B, 0xA6, 0x9D, 0xD3, 0x4E, 0xCE, 0xE8, 0xB5, 0xAE, 0x9D, 0xD8, 0xEF, 0x63,
+        0x47, 0xA1, 0xDA, 0x9A, 0x69, 0xD3, 0x4D, 0x1E, 0x7D, 0x4D, 0x8F, 0x6B, 0x3A, 0x1A, 0x0F, 0x63,
+        0xB3, 0xAC, 0xD6, 0x74, 0xD0, 0x13, 0x7B, 0xCA, 0xE8, 0x76, 0x1D, 0x22, 0x3A, 0x6B, 0x0E, 0x91,
+        0xD3, 0x79, 0xBD, 0x1F, 0x3B, 0x1D, 0x03, 0x41, 0xAC, 0x47, 0x62, 0x6B, 0x0D, 0x7C, 0xFD, 0xF3,
+        0xA0, 0x21, 0xA1, 0xB9, 0x46, 0x74, 0x22, 0x26, 0x81, 0xDF, 0x35, 0x8D, 0x7C, 0xEE, 0x8F, 0x0D,
+        0x00, 0xDE, 0x76, 0x0C, 0xE8, 0x3E, 0x76, 0x77, 0x86, 0x80, 0x06, 0x9C, 0x2B, 0x57, 0x81, 0x78,
+        0xB0, 0x8A, 0xBA, 0x9A, 0x1D, 0x08, 0xF7, 0xCD, 0xE6, 0x8C, 0x1C, 0x23, 0x78, 0xB4, 0x51, 0x08,
+        0xAB, 0xA9, 0xC0, 0xF4, 0x00, 0x0D, 0xE6, 0xF3, 0x79, 0xA8, 0xC0, 0x60, 0x77, 0xCE, 0xF9, 0xB9,
+        0x5F, 0x07, 0x52, 0x31, 0xDF, 0x19, 0xDE, 0x6F, 0x9D, 0x13, 0xCE, 0x9C, 0xD8, 0x80, 0x1B, 0xC0,
+        0x96, 0x70, 0xB3, 0xAC, 0xEB, 0x38, 0x9A, 0x91, 0x52, 0x05, 0xFF, 0xBF, 0xEC, 0x2C, 0x2C, 0x3B,
+        0xC6, 0x1B, 0x90, 0xEF, 0x86, 0xE5, 0xE1, 0x0B, 0xC5, 0xE2, 0x61, 0xD5, 0xE2, 0x61, 0xD5, 0x92,
+        0x87, 0x56, 0xAA, 0xD4, 0x33, 0x89, 0x38, 0x2B, 0x55, 0x6A, 0xAD, 0x43, 0x38, 0x93, 0x89, 0x50,
+        0x48, 0x1C, 0x21, 0x87, 0x08, 0x49, 0x5C, 0x4F, 0x13, 0xAD, 0xD8, 0xDE, 0xDC, 0xD8, 0x5C, 0x8C,
+        0x2B, 0x95, 0x28, 0x4E, 0x91, 0x01, 0xC8, 0x0A, 0x28, 0xB2, 0x43, 0x1C, 0x55, 0xE2, 0x02, 0x8C,
+        0x49, 0x57, 0x8E, 0x44, 0x92, 0x77, 0x37, 0x33, 0x7B, 0x13, 0xCD, 0xCC, 0xCD, 0x9C, 0xDD, 0x6A,
+        0x55, 0xA8, 0x54, 0xB5, 0x27, 0x9B, 0xD4, 0xCA, 0xAA, 0xEA, 0xB5, 0x70, 0x02, 0x5F, 0xFF, 0xFF,
+        0xF7, 0x8C, 0x25, 0x10, 0xCB, 0x24, 0xB2, 0xC7, 0x1C, 0x92, 0x4B, 0x24, 0x52, 0xDE, 0x76, 0xF7,
+        0x99, 0xCC, 0xEF, 0x33, 0x99, 0xDE, 0x4A, 0x5E, 0xE7, 0x33, 0x99, 0xDB, 0x9D, 0xB9, 0xCD, 0x93,
+        0xCC, 0xCC, 0xE6, 0x5D, 0xDD, 0xB9, 0x97, 0xB2, 0x97, 0x6D, 0xDB, 0xC9, 0x7B, 0x19, 0x1B, 0x64,
+        0x5E, 0xD7, 0x2A, 0x5D, 0xB9, 0x67, 0x22, 0x46, 0xEE, 0x9B, 0xB7, 0x76, 0x76, 0x9F, 0x62, 0x3E,
+        0x9B, 0x5B, 0xA7, 0xDE, 0x7A, 0x69, 0xBA, 0x4A, 0x64, 0x4A, 0xB6, 0x06, 0xC2, 0xB5, 0xB1, 0xE6,
+        0xD6, 0xB4, 0xAE, 0xCE, 0xCD, 0x04, 0xDA, 0xCD, 0x34, 0xD2, 0x76, 0x6A, 0x4A, 0x55, 0x85, 0x68,
+        0x5A, 0x9A, 0xCC, 0x48, 0xCE, 0xC3, 0x40, 0xD2, 0xB1, 0xB8, 0x3E, 0xF3, 0x43, 0x48, 0xD6, 0x77,
+        0xCD, 0xD1, 0xE6, 0x81, 0xBC, 0xF7, 0x0A, 0xCD, 0xCA, 0x20, 0x68, 0x05, 0x79, 0xEE, 0x4E, 0xC1,
+        0x61, 0xB9, 0x40, 0xDE, 0x68, 0x4E, 0x8F, 0x2E, 0x6C, 0x6E, 0x5C, 0xA3, 0x0D, 0x1C, 0xA0, 0x01,
+        0xBC, 0xDE, 0x6C, 0x42, 0x0E, 0x27, 0x17, 0x4C, 0xA2, 0xAF, 0x05, 0x8F, 0x3B, 0x0C, 0xA1, 0xBC,
+        0x0D, 0xCB, 0xC1, 0xD3, 0x9A, 0x00, 0x01, 0xBC, 0x34, 0x79, 0x73, 0x79, 0xB1, 0xE6, 0x91, 0x08,
+        0x28, 0x4E, 0xF2, 0x37, 0x0B, 0x9B, 0xE7, 0x47, 0x97, 0x2E, 0x5C, 0xD9, 0x95, 0x99, 0x51, 0x99,
+        0xB1, 0x99, 0x58, 0xC6, 0x65, 0x16, 0x31, 0x8C, 0x63, 0xE7, 0x63, 0x05, 0x8C, 0x19, 0x9B, 0x18,
+        0xC3, 0x07, 0x63, 0x1F, 0x3B, 0x1F, 0x3B, 0x1E, 0x54, 0xB1, 0x6A, 0x1C, 0x4A, 0x87, 0x13, 0x8B,
+        0xA6, 0x50, 0xAE, 0x95, 0xD2, 0xBA, 0x44, 0x38, 0x01, 0xA3, 0x46, 0x8D, 0xEF, 0x84, 0xA2, 0x45,
+        0x4D, 0x33, 0x42, 0x6A, 0x68, 0x30, 0x30, 0x80, 0x02, 0x86, 0x0C, 0xDB, 0x35, 0xB8, 0xD9, 0x64,
+        0xB0, 0x95, 0xD4, 0xD3, 0x50, 0x09, 0xE8, 0xE0, 0xE4, 0xC9, 0x8A, 0xA9, 0xA2, 0x81, 0x46, 0x50,
+        0x82, 0x22, 0x91, 0xB3, 0x39, 0xCC, 0xEF, 0x39, 0xE4, 0xF9, 0xDE, 0x7B, 0x35, 0x8E, 0x31, 0x8E,
+        0x2B, 0x59, 0xCE, 0x37, 0x9A, 0xDE, 0x27, 0x1C, 0x56, 0x37, 0x5C, 0x4C, 0x02, 0x5F, 0x1B, 0xFF,
+        0xFF, 0xFF, 0x40, 0x93, 0x51, 0x3C, 0xD3, 0x4F, 0x1D, 0x33, 0x4D, 0x24, 0xF2, 0xCE, 0xF1, 0xC4,
+        0xF5, 0x78, 0xD6, 0xB1, 0xB9, 0xE2, 0xB8, 0xA9, 0xC6, 0xB1, 0xA9, 0xDD, 0xE3, 0x18, 0xC5, 0xE6,
+        0xF1, 0x72, 0x9E, 0xEE, 0x6F, 0x39, 0x9B, 0xCE, 0x5E, 0x72, 0xF6, 0x47, 0x67, 0x77, 0x2F, 0x33,
+        0x73, 0x72, 0xF6, 0x8B, 0x91, 0x99, 0x79, 0x72, 0xDC, 0xDC, 0xCB, 0x65, 0x2D, 0xE4, 0xD8, 0x7B,
+        0x53, 0x65, 0xB9, 0x1A, 0x7A, 0x7A, 0x5D, 0x3A, 0x6E, 0xCF, 0x41, 0x3D, 0x2E, 0x96, 0xB6, 0x9A,
+        0x75, 0x19, 0xBB, 0x34, 0xA6, 0xD2, 0xB3, 0x68, 0x9B, 0x35, 0x97, 0x42, 0x9B, 0x1A, 0x3B, 0xCB,
+        0xA1, 0x59, 0xB1, 0xA6, 0xF0, 0x6E, 0x81, 0x59, 0xA4, 0x68, 0x68, 0x91, 0xA0, 0x5C, 0xF7, 0x86,
+        0x85, 0x1C, 0xA1, 0xBC, 0xD8, 0xDE, 0x68, 0x1A, 0x3C, 0xAC, 0x59, 0x62, 0x17, 0x28, 0x2C, 0x0D,
+        0x39, 0x52, 0x37, 0x28, 0x3C, 0xD0, 0x37, 0x97, 0x37, 0x95, 0x8C, 0x16, 0x6F, 0x37, 0x2F, 0x34,
+        0x24, 0xB7, 0x04, 0x27, 0x7C, 0x77, 0xCE, 0xCC, 0xA6, 0x54, 0x32, 0xDA, 0xB1, 0x6F, 0xBF, 0x03,
+        0xBC, 0x5C, 0xDE, 0x2C, 0x63, 0x9B, 0xC2, 0x9A, 0x9A, 0x91, 0x53, 0x4D, 0x13, 0x53, 0x45, 0x22,
+        0xA6, 0x9A, 0x26, 0xA6, 0xA6, 0xA6, 0x8A, 0x6A, 0x6A, 0x68, 0x4D, 0x4D, 0x09, 0xA2, 0x43, 0xD6,
+        0xFB, 0xF1, 0x5B, 0x16, 0x08, 0xC1, 0xF3, 0xB0, 0x33, 0x66, 0x50, 0x72, 0xE5, 0xCD, 0xF1, 0xDF,
+        0x1D, 0xF1, 0x00, 0xEF, 0x0D, 0x3D, 0x47, 0xA8, 0x72, 0xF3, 0x79, 0xB8, 0xC8, 0xDE, 0x30, 0x16,
+        0x31, 0x8C, 0x33, 0x66, 0x6F, 0x28, 0xE6, 0xF2, 0xE0, 0x6F, 0x00, 0x00, 0x10, 0xCA, 0x65, 0x39,
+        0xB9, 0x72, 0x6E, 0x09, 0x1B, 0x91, 0xE6, 0xC4, 0xE5, 0x78, 0xC1, 0x40, 0x0C, 0x9A, 0xE4, 0xBC,
+        0x87, 0x59, 0xC2, 0x69, 0x31, 0x16, 0x53, 0x11, 0x90, 0x0B, 0x92, 0x1F, 0x86, 0x19, 0x48, 0x10,
+        0xCD, 0x6B, 0x18, 0xE3, 0x1C, 0xEA, 0x75, 0xCF, 0x1B, 0xE3, 0x7D, 0xE7, 0x7D, 0xEF, 0x8D, 0x73,
+        0xC6, 0xE7, 0x8D, 0x73, 0xBC, 0xF3, 0xCE, 0x20, 0x02, 0x6A, 0xAF, 0xFF, 0xF8, 0xA2, 0xE5, 0x49,
+        0x93, 0x32, 0x4C, 0x79, 0x52, 0xA4, 0xC9, 0x91, 0x22, 0x3C, 0xF7, 0x9E, 0xF7, 0xAE, 0xB3, 0xC7,
+        0x1A, 0xE3, 0x3C, 0x6B, 0x7B, 0x9D, 0xDF, 0x1A, 0xD6, 0x73, 0xBC, 0xE7, 0x79, 0xBD, 0x67, 0x13,
+        0xAB, 0xCE, 0xEB, 0x1A, 0xBC, 0x67, 0x17, 0x9A, 0xCD, 0x4B, 0x79, 0x7C, 0xCD, 0xE6, 0x73, 0x76,
+        0xF3, 0x99, 0x92, 0xC9, 0xCB, 0xCD, 0xB7, 0x97, 0x93, 0x93, 0x39, 0x13, 0xBB, 0xD3, 0xBA, 0xEE,
+        0xEB, 0xD3, 0xBA, 0x27, 0x4E, 0xBD, 0x2D, 0xDA, 0xBE, 0xCD, 0x19, 0xE9, 0xA9, 0xB4, 0xE8, 0x6D,
+        0x52, 0x16, 0xA4, 0xAC, 0xC3, 0x61, 0xCD, 0x66, 0x83, 0xEE, 0x72, 0x9F, 0x29, 0xC1, 0x31, 0x35,
+        0x9A, 0x94, 0x58, 0x75, 0x33, 0x43, 0x45, 0x19, 0xA4, 0x6E, 0x3D, 0xF0, 0x7B, 0xE6, 0xEF, 0x2E,
+        0x6C, 0xB1, 0x63, 0x02, 0xA6, 0x8E, 0xDB, 0x9D, 0xE0, 0xDC, 0xA0, 0xC0, 0xB8, 0xA3, 0xC1, 0xA3,
+        0x37, 0x86, 0xF3, 0x79, 0xBC, 0xA8, 0x31, 0xE7, 0xBC, 0x63, 0x1B, 0xC6, 0xF1, 0x16, 0x5E, 0x6E,
+        0x2E, 0x2E, 0x2E, 0x22, 0xE5, 0x8E, 0x29, 0xCD, 0x09, 0x9A, 0x31, 0xC5, 0xCB, 0x1C, 0x5C, 0x5C,
+        0x22, 0x9D, 0x48, 0xA9, 0x85, 0x35, 0x30, 0xA4, 0x72, 0x6F, 0x12, 0x6F, 0x18, 0x91, 0x82, 0xC8,
+        0xB2, 0x2F, 0x36, 0x66, 0xF1, 0x16, 0x38, 0xCD, 0xE0, 0xC1, 0x82, 0x33, 0x2B, 0xCA, 0xF2, 0xE6,
+        0xF2, 0xE0, 0x07, 0xDF, 0x82, 0xC3, 0xDC, 0xF7, 0x03, 0xDD, 0xE7, 0x78, 0xEF, 0x00, 0x4E, 0x68,
+        0x65, 0x39, 0xB8, 0x5E, 0x20, 0xDE, 0x21, 0x13, 0x9A, 0x73, 0x4E, 0x68, 0xF3, 0x72, 0x2C, 0x8C,
+        0x63, 0x1E, 0x0E, 0xCC, 0xD9, 0x25, 0x93, 0x78, 0x0C, 0x11, 0x83, 0x32, 0x91, 0xCB, 0x86, 0x87,
+        0xE0, 0x0B, 0x7B, 0x9E, 0xE5, 0x10, 0x31, 0x03, 0x18, 0x10, 0x03, 0x10, 0x00, 0x00, 0x2B, 0xC4,
+        0xFF, 0xB1, 0xFF, 0xD8, 0x6F, 0x80, 0xED, 0xB8, 0x6C, 0xE5, 0x94, 0xE4, 0x23, 0x04, 0x43, 0x89,
+        0x00, 0x06, 0x34, 0x38, 0xD4, 0x96, 0x59, 0x65, 0xA6, 0x79, 0xEF, 0x9E, 0x7B, 0xE5, 0xA6, 0x9A,
+        0xE7, 0x4B, 0x63, 0xA6, 0xB8, 0xE7, 0xA6, 0x50, 0x02, 0x6D, 0x97, 0xFF, 0xFF, 0x90, 0x46, 0x74,
+        0xFA, 0x32, 0xA8, 0xCD, 0x9D, 0x36, 0x5C, 0xF9, 0x53, 0x66, 0x52, 0xB9, 0xE3, 0xB6, 0x39, 0x67,
+        0x9E, 0x58, 0x67, 0x8E, 0x58, 0xDF, 0x29, 0xDF, 0x5B, 0xE7, 0x8D, 0xF1, 0xAE, 0x38, 0xC7, 0x1C,
+        0x6B, 0x59, 0x9E, 0x31, 0xC6, 0x35, 0xAC, 0xE7, 0x55, 0xC6, 0x31, 0xAB, 0xCC, 0xAF, 0x79, 0xBD,
+        0xEE, 0x73, 0x9B, 0xCC, 0xDE, 0x6E, 0xCA, 0xEE, 0x67, 0x36, 0xEF, 0x27, 0x27, 0x2E, 0xD9, 0x4C,
+        0xBC, 0x8B, 0xB1, 0x62, 0xE6, 0x49, 0xC8, 0x97, 0xA5, 0xD6, 0xEA, 0xF6, 0x6D, 0x07, 0xA1, 0xEC,
+        0xA6, 0xAB, 0xA2, 0xD0, 0x77, 0x1D, 0xC7, 0x53, 0xEC, 0x1D, 0x9A, 0x4D, 0x88, 0xEE, 0x52, 0xC1,
+        0x4B, 0x96, 0xE5, 0x2E, 0x6C, 0x0A, 0x39, 0xB2, 0xE6, 0xC1, 0x86, 0xC6, 0x02, 0xCD, 0xE5, 0x63,
+        0x16, 0x31, 0x44, 0x8C, 0x6F, 0x16, 0x32, 0xC4, 0x1E, 0x6C, 0x4B, 0xC6, 0x23, 0x06, 0x0D, 0xE3,
+        0x71, 0x97, 0x9B, 0x8C, 0xBC, 0xD1, 0xC6, 0x53, 0x9B, 0x8C, 0xBC, 0xDC, 0x9A, 0x38, 0xC1, 0x85,
+        0xE3, 0x78, 0xC4, 0x0B, 0x34, 0xD7, 0xEE, 0x9B, 0x50, 0x9C, 0xDE, 0x6E, 0x32, 0x6E, 0x4D, 0xE2,
+        0x0C, 0x63, 0x18, 0xF3, 0x4E, 0x6C, 0x88, 0xC9, 0xBC, 0x59, 0x18, 0xC6, 0x30, 0x73, 0x64, 0x63,
+        0x1C, 0x66, 0xF1, 0x82, 0x31, 0x99, 0xB3, 0x36, 0x66, 0xF0, 0xD0, 0xFC, 0xB2, 0xCB, 0x34, 0xF7,
+        0xC1, 0xFB, 0xBD, 0x5E, 0x58, 0xB1, 0x0F, 0x29, 0x9B, 0xCB, 0x81, 0xBC, 0x00, 0x11, 0xE5, 0x0C,
+        0xB9, 0xBC, 0xB8, 0x00, 0xDC, 0x03, 0x2B, 0x32, 0x99, 0x70, 0x1B, 0x85, 0xC0, 0x03, 0x28, 0x73,
+        0x43, 0xDD, 0xEE, 0xF3, 0xBC, 0x34, 0x04, 0xCA, 0x73, 0x72, 0xE1, 0x78, 0x80, 0x31, 0x02, 0x39,
+        0x71, 0x97, 0x18, 0x21, 0x37, 0x0E, 0x68, 0x49, 0x64, 0xAE, 0x0C, 0x0A, 0x08, 0x06, 0x2D, 0x38,
+        0xE8, 0x9E, 0x0D, 0xC8, 0x33, 0x0B, 0x04, 0x91, 0xB1, 0x38, 0xB0, 0x59, 0x20, 0x79, 0x69, 0xAE,
+        0xDC, 0x38, 0xF0, 0xE9, 0xCB, 0x9F, 0x3E, 0x3C, 0x7A, 0xD3, 0x3E, 0x1C, 0xB9, 0x6F, 0xCB, 0x96,
+        0xF0, 0x02, 0x6F, 0xFF, 0xF0, 0x5F, 0xFD, 0x62, 0xB5, 0xEB, 0xD2, 0xB1, 0x4E, 0x9D, 0x2A, 0x94,
+        0x69, 0xD0, 0xA9, 0x3E, 0x96, 0xE5, 0xB7, 0x0D, 0xB8, 0x69, 0xB6, 0xDB, 0x65, 0xB6, 0x9A, 0x69,
+        0x8D, 0x29, 0xA6, 0x39, 0x65, 0x9E, 0x19, 0x5F, 0x4B, 0x63, 0x7C, 0x70, 0xC2, 0x77, 0x9E, 0xB1,
+        0xCE, 0x73, 0xBE, 0x31, 0x9C, 0xEF, 0x37, 0xB9, 0x6F, 0x39, 0xDD, 0xEF, 0x6F, 0xB7, 0xBB, 0xDB,
+        0xDB, 0x2D, 0xBB, 0xDB, 0x7B, 0x76, 0xEE, 0xDD, 0x8D, 0x93, 0x6E, 0xC6, 0xC3, 0x93, 0x6D, 0xB1,
+        0x63, 0x4E, 0x96, 0xBA, 0x5B, 0x4B, 0x41, 0x5E, 0xE7, 0x73, 0xA0, 0xB6, 0xE7, 0x70, 0x7B, 0x8B,
+        0x4B, 0x96, 0xC4, 0xA0, 0x37, 0x9B, 0x72, 0x85, 0x88, 0x14, 0x18, 0xDC, 0xA1, 0x12, 0xE5, 0x22,
+        0x07, 0x79, 0x4F, 0x71, 0xBE, 0xF0, 0x6E, 0x0C, 0xA6, 0x53, 0x9A, 0x06, 0x07, 0x68, 0x34, 0x0D,
+        0x03, 0xDC, 0x68, 0x3D, 0x40, 0xE5, 0x39, 0xA6, 0x5C, 0x65, 0xCB, 0x80, 0x58, 0x3B, 0xF4, 0x7B,
+        0x9A, 0x1C, 0xA6, 0x5E, 0x6E, 0x5C, 0x06, 0x00, 0x81, 0x97, 0x28, 0x63, 0x2E, 0x5C, 0x12, 0x6E,
+        0x00, 0x47, 0x29, 0x96, 0x06, 0x77, 0x9D, 0xFA, 0x03, 0x60, 0xE7, 0xBB, 0xD6, 0x77, 0x8D, 0x02,
+        0x18, 0xB9, 0x72, 0xE5, 0xE2, 0x00, 0xDF, 0x14, 0x0C, 0xB8, 0xCB, 0x85, 0x1C, 0x88, 0x01, 0x8B,
+        0x97, 0x2E, 0x05, 0x8E, 0xF1, 0xAF, 0x71, 0xEE, 0x1E, 0x6E, 0x5C, 0x06, 0x00, 0x65, 0x82, 0xE5,
+        0x32, 0xE4, 0xDC, 0x00, 0x20, 0xA1, 0x94, 0xC6, 0x5C, 0xB8, 0x10, 0x77, 0x03, 0x29, 0x25, 0x32,
+        0xE5, 0xE0, 0x4E, 0xF0, 0xD3, 0xDC, 0x7A, 0x0D, 0xDE, 0xEF, 0x0B, 0x0F, 0x70, 0x63, 0x97, 0x2E,
+        0x5E, 0x37, 0x00, 0x01, 0xA3, 0xDC, 0xF5, 0xBB, 0xC7, 0x38, 0x20, 0x00, 0x10, 0x08, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xD6, 0x11, 0xEF, 0xDF, 0x42, 0xF0, 0xCD, 0x91, 0xBB, 0x0C, 0x74, 0xF2,
+        0x81, 0x43, 0x4A, 0xA9, 0x5A, 0xD5, 0x7B, 0xD7, 0x2C, 0xDD, 0xB9, 0x5B, 0x34, 0xED, 0xCF, 0xB7,
+        0x3E, 0x9D, 0x30, 0x02, 0x7F, 0xFF, 0x6A, 0xEE, 0x08, 0x27, 0xE8, 0x66, 0xE8, 0x66, 0x67, 0xE6,
+        0x27, 0x26, 0x26, 0xA5, 0xA6, 0x65, 0xA9, 0xB7, 0x4E, 0xFC, 0xBA, 0x73, 0xE9, 0xC3, 0x8F, 0x2D,
+        0xF9, 0x6D, 0xC3, 0x5D, 0xE9, 0x5D, 0xB5, 0xCB, 0x7C, 0xB5, 0xCF, 0x2C, 0x75, 0xC3, 0x1C, 0xB1,
+        0xBC, 0xF7, 0xAE, 0x77, 0xC6, 0xF7, 0xBC, 0x73, 0x9C, 0xF1, 0x8D, 0x66, 0x6F, 0x59, 0xCE, 0x2F,
+        0x55, 0xAA, 0xBB, 0xCD, 0x62, 0xA5, 0x73, 0x97, 0x93, 0xB3, 0x39, 0x16, 0xED, 0xB1, 0xDD, 0x37,
+        0x5E, 0x9A, 0xDA, 0x6B, 0x46, 0xD9, 0xAA, 0xEC, 0xD9, 0x6B, 0x28, 0x3B, 0xBD, 0xDC, 0x71, 0xC2,
+        0x16, 0xE2, 0xDE, 0x69, 0x37, 0x16, 0x68, 0xE3, 0x16, 0x2C, 0x62, 0xC6, 0x0A, 0xC9, 0x62, 0xF3,
+        0x61, 0x16, 0x05, 0x96, 0xB2, 0xD5, 0xEB, 0x43, 0x06, 0x2E, 0x31, 0x99, 0xB1, 0x82, 0xC2, 0x2F,
+        0x36, 0x66, 0xF3, 0x79, 0xBC, 0x15, 0xC6, 0x33, 0x78, 0xF3, 0x63, 0x20, 0xAF, 0x37, 0x9B, 0xC5,
+        0x91, 0x8C, 0x43, 0x5A, 0xF5, 0xAD, 0x6B, 0x34, 0x31, 0x23, 0x13, 0x9B, 0x8C, 0x64, 0x13, 0x72,
+        0x24, 0x96, 0x38, 0xCB, 0xC1, 0xDC, 0x22, 0x3C, 0xA4, 0x72, 0xC8, 0x37, 0x18, 0x13, 0x70, 0xC5,
+        0x0C, 0x16, 0x5C, 0xB9, 0x37, 0x00, 0x89, 0x83, 0x4C, 0x5C, 0x2E, 0x05, 0xE2, 0x01, 0xEE, 0x3D,
+        0xCF, 0x77, 0x96, 0x02, 0x00, 0x65, 0x32, 0xE5, 0xC2, 0xE0, 0x05, 0x87, 0xBB, 0xDC, 0xF0, 0x6E,
+        0x0C, 0xB8, 0x65, 0x02, 0x38, 0x1D, 0xEE, 0xF5, 0x78, 0x2C, 0x78, 0x76, 0x65, 0xCB, 0x25, 0xC6,
+        0x00, 0x8C, 0x08, 0x99, 0xBC, 0xB9, 0xBC, 0x04, 0x65, 0xE2, 0x0C, 0xCD, 0x99, 0xBC, 0xB0, 0x61,
+        0xBC, 0x18, 0x30, 0x8B, 0xCA, 0x31, 0x8E, 0x2E, 0x31, 0x8C, 0x11, 0xE6, 0xC2, 0x31, 0x93, 0x78,
+        0xC6, 0x11, 0x40, 0xA4, 0x4D, 0x4A, 0x45, 0x1F, 0xF4, 0xFB, 0xF7, 0xEE, 0x5F, 0xCA, 0x3E, 0x01,
+        0xC0, 0xAC, 0x4E, 0x05, 0x01, 0x24, 0x67, 0x69, 0x29, 0x6A, 0x2A, 0xAA, 0xEB, 0xA3, 0xA3, 0xA7,
+        0x9B, 0x9B, 0x9F, 0x8B, 0x92, 0x02, 0x7F, 0xFF, 0xFE, 0x20, 0xE4, 0xBA, 0xBA, 0xB6, 0xAA, 0x9E,
+        0xAA, 0x9A, 0x9A, 0x86, 0x96, 0x86, 0x7E, 0x82, 0x7E, 0xB5, 0xED, 0xD9, 0xA7, 0x46, 0x9D, 0x19,
+        0xF2, 0xE5, 0xCB, 0x8F, 0x26, 0x1C, 0x38, 0xE9, 0x6E, 0x3B, 0xEF, 0xB6, 0xDA, 0x6D, 0x9E, 0xB9,
+        0x67, 0x9E, 0x59, 0xE1, 0x3C, 0xF3, 0xC7, 0x58, 0xEF, 0x1C, 0xEF, 0x1C, 0xE3, 0x3B, 0xC6, 0xE5,
+        0x79, 0xED, 0xF3, 0x7B, 0xB9, 0xBD, 0xD9, 0xDD, 0xB1, 0xEE, 0xEE, 0xDE, 0xEB, 0xBB, 0xA7, 0x5D,
+        0x47, 0x53, 0xD4, 0x74, 0xEC, 0x77, 0x3D, 0x81, 0xC7, 0x71, 0xCA, 0x52, 0x16, 0x28, 0xCA, 0xC0,
+        0xDE, 0x50, 0x45, 0xCA, 0x19, 0x6E, 0x05, 0xCA, 0x1E, 0xE7, 0xB8, 0xF7, 0x00, 0x00, 0x34, 0x7B,
+        0x80, 0x4C, 0xA6, 0x53, 0x2E, 0x5C, 0xB9, 0x70, 0x0E, 0xF0, 0x58, 0xF7, 0x3C, 0x37, 0x2C, 0x70,
+        0x2E, 0x30, 0x0C, 0x1D, 0x99, 0x49, 0x2E, 0x2E, 0x0C, 0x04, 0x79, 0x5E, 0x58, 0xE2, 0xE3, 0x10,
+        0xCB, 0x69, 0xAD, 0x6D, 0x5E, 0x16, 0x32, 0x2C, 0x8C, 0xBE, 0x56, 0x0C, 0x48, 0xC7, 0x17, 0x19,
+        0x78, 0x8D, 0xE2, 0x44, 0x92, 0x92, 0x5C, 0x83, 0xB8, 0x0C, 0x03, 0x9A, 0x19, 0x70, 0x2C, 0xEF,
+        0x06, 0x87, 0xB8, 0x3D, 0xDE, 0xEF, 0x3B, 0xC0, 0x03, 0x97, 0x29, 0x25, 0xC0, 0x2E, 0x44, 0x40,
+        0xCD, 0x99, 0x72, 0xC8, 0x1B, 0xC1, 0x08, 0x83, 0xCB, 0x1C, 0x37, 0x80, 0xAE, 0x33, 0x36, 0x0F,
+        0x37, 0x96, 0x23, 0x25, 0x91, 0x8C, 0x64, 0x5E, 0x68, 0xF3, 0x79, 0xBC, 0x59, 0x18, 0x91, 0xE0,
+        0xEC, 0x97, 0x9B, 0x8C, 0x26, 0xF1, 0x20, 0xA6, 0x29, 0xCD, 0xC6, 0x5C, 0x9B, 0x82, 0x44, 0x08,
+        0xE5, 0x92, 0xE5, 0xC0, 0xB3, 0xBC, 0x34, 0x7B, 0x80, 0xF7, 0x7A, 0xDD, 0xE3, 0xBC, 0x01, 0x32,
+        0x86, 0x17, 0x2C, 0x70, 0x2C, 0x01, 0x00, 0x00, 0x31, 0xB6, 0x10, 0xF5, 0xA7, 0xB1, 0x37, 0x74,
+        0xF8, 0xB4, 0x15, 0x07, 0xC9, 0x66, 0x33, 0xB9, 0xE5, 0xAE, 0xED, 0x70, 0x76, 0x75, 0xF6, 0xF4,
+        0x75, 0xA0, 0x02, 0x7F, 0xED, 0x5F, 0xFF, 0xED, 0x90, 0xD8, 0x1B, 0xFB, 0xEB, 0xCB, 0x7B, 0x6B,
+        0x2B, 0x4B, 0x1A, 0xCA, 0xBA, 0xCA, 0x5A, 0xE9, 0xE4, 0xE4, 0xE3, 0xDD, 0xC1, 0xBF, 0x5E, 0xDD,
+        0x3A, 0x35, 0x67, 0xCB, 0x9B, 0x1D, 0x34, 0xE7, 0xC7, 0x87, 0x2E, 0x1A, 0xEF, 0xAE, 0xD9, 0x6D,
+        0xAD, 0xF4, 0xCE, 0x78, 0xEB, 0x5D, 0xEB, 0x9D, 0xEB, 0x79, 0xDE, 0xB1, 0x9C, 0xEA, 0x57, 0xB9,
+        0xDE, 0x5E, 0xEF, 0x2E, 0x67, 0x2C, 0xF2, 0x33, 0xB7, 0xB5, 0xB6, 0xDA, 0xBA, 0x68, 0xA6, 0xCE,
+        0xF3, 0xD8, 0xA5, 0x28, 0x07, 0x0E, 0xD7, 0x6B, 0x56, 0xA1, 0x8B, 0x9B, 0x22, 0x0B, 0x82, 0x8E,
+        0x58, 0xE5, 0x89, 0x95, 0xE5, 0xCA, 0x2F, 0x2E, 0x57, 0x85, 0x8E, 0x1B, 0xC0, 0x4D, 0xE0, 0xC0,
+        0x66, 0x6C, 0xCD, 0x83, 0x1C, 0x5C, 0x63, 0x18, 0xC2, 0x0A, 0xF3, 0x79, 0xBC, 0x46, 0x46, 0x38,
+        0x2B, 0x8B, 0xC6, 0xF1, 0xBC, 0x42, 0x0C, 0xA4, 0x97, 0x2F, 0x12, 0xE1, 0x10, 0x7B, 0x8F, 0x77,
+        0xAC, 0x77, 0x81, 0x0C, 0xA4, 0x72, 0xE5, 0xC0, 0x10, 0xC1, 0xA7, 0xBB, 0xCE, 0xF5, 0x84, 0x18,
+        0x3C, 0xAF, 0x2C, 0x71, 0x83, 0xBC, 0x18, 0xF3, 0x64, 0x48, 0xC0, 0x66, 0xF1, 0x8C, 0x71, 0x71,
+        0x78, 0x8D, 0xE3, 0x78, 0x91, 0x31, 0x72, 0xC1, 0x85, 0xC9, 0xB8, 0x04, 0x4C, 0xA0, 0xE5, 0xC6,
+        0x5C, 0x02, 0xE1, 0x94, 0x10, 0xCB, 0x97, 0x2C, 0x97, 0x00, 0x04, 0x79, 0x42, 0x39, 0x71, 0x70,
+        0x43, 0x16, 0x69, 0xEF, 0xB7, 0xAB, 0x0C, 0xB2, 0x0C, 0x79, 0xB0, 0x8C, 0x46, 0x32, 0x6F, 0x18,
+        0x91, 0x91, 0x47, 0x17, 0x26, 0xF1, 0xBC, 0x48, 0x80, 0xC7, 0x17, 0x2F, 0x37, 0x0B, 0xC4, 0xA3,
+        0x91, 0xCA, 0x07, 0x34, 0xCB, 0x85, 0x0F, 0x16, 0x0F, 0x71, 0xEE, 0x06, 0xBC, 0xEF, 0x3B, 0xC1,
+        0x6F, 0x0D, 0x08, 0xE5, 0xCB, 0x20, 0x6F, 0x08, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x08, 0x0A,
+        0x44, 0xDC, 0xDF, 0x94, 0xBF, 0x03, 0x71, 0xD4, 0xA8, 0x4C, 0x1A, 0x9F, 0xDB, 0x3B, 0xB3, 0xDA,
+        0xEC, 0x75, 0xFA, 0x9D, 0x3E, 0x74, 0x02, 0x88, 0xB3, 0xFF, 0xEC, 0xC6, 0x6A, 0xF5, 0x62, 0xAD,
+        0x52, 0xA6, 0xD2, 0xE8, 0xD4, 0x49, 0xF4, 0xFA, 0x75, 0x36, 0x9A, 0xDA, 0x86, 0x8E, 0x5E, 0x5E,
+        0x46, 0x36, 0x2E, 0x0E, 0x15, 0xFB, 0xB6, 0xEE, 0x59, 0xAF, 0x62, 0x9B, 0x72, 0xED, 0xC7, 0x8F,
+        0x0E, 0x3B, 0x6F, 0xAE, 0x9A, 0xE5, 0x9E, 0x77, 0x9E, 0xF8, 0xEB, 0x1D, 0x67, 0x8C, 0xEB, 0x1B,
+        0xC6, 0x31, 0x9A, 0x97, 0x27, 0x97, 0x39, 0x77, 0x32, 0x66, 0x4D, 0xB1, 0x35, 0xD2, 0xDB, 0x36,
+        0x6A, 0x14, 0x6E, 0x77, 0x16, 0xC6, 0x6F, 0x2E, 0xF2, 0x86, 0x87, 0x7A, 0x9E, 0xE0, 0x00, 0x00,
+        0x00, 0x01, 0xA3, 0xDD, 0xEE, 0xF0, 0x76, 0xDD, 0xE1, 0x61, 0x7E, 0xE0, 0x6B, 0xD5, 0xE5, 0x96,
+        0xB0, 0x34, 0xCB, 0xD5, 0xB5, 0xAF, 0x42, 0xF3, 0x64, 0x60, 0x32, 0x26, 0x21, 0x3D, 0x6E, 0xF2,
+        0xC3, 0x40, 0x7B, 0xBD, 0xDE, 0xEF, 0x26, 0x01, 0x32, 0x99, 0x72, 0xE3, 0x2E, 0x02, 0x3C, 0xA1,
+        0x1C, 0xDE, 0x16, 0x41, 0x82, 0xCC, 0xD9, 0x1C, 0xB8, 0xB2, 0x30, 0x2D, 0x6B, 0xD6, 0xB5, 0x96,
+        0x0C, 0x48, 0x98, 0xB9, 0x78, 0xDC, 0x04, 0x60, 0x65, 0x8E, 0x53, 0x0B, 0x80, 0xEF, 0x01, 0xEE,
+        0x7B, 0xB4, 0x1E, 0xEF, 0x0B, 0x0B, 0x7B, 0x81, 0xAF, 0x57, 0xAC, 0xB2, 0xC8, 0x79, 0xBC, 0xB1,
+        0x93, 0x78, 0xC6, 0x30, 0x2D, 0xBB, 0x6B, 0x2C, 0xB6, 0x84, 0x8E, 0x58, 0xE5, 0xE6, 0xE5, 0xE2,
+        0x0D, 0xC2, 0x21, 0x94, 0xCB, 0x25, 0xC0, 0x77, 0x80, 0x0F, 0x70, 0x35, 0xE7, 0x79, 0xDB, 0x0B,
+        0x78, 0x68, 0xF2, 0xE6, 0xF0, 0xDE, 0x0B, 0x80, 0xB0, 0x8B, 0x23, 0x9B, 0xCD, 0xE2, 0x8C, 0x8C,
+        0x63, 0x19, 0x17, 0x18, 0x2C, 0x61, 0x37, 0x22, 0x47, 0x2C, 0x17, 0x2C, 0x85, 0xE6, 0xE0, 0x44,
+        0x20, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x30, 0x00, 0x00, 0x08, 0x09, 0x31, 0x77, 0xB7, 0xF9,
+        0x83, 0xF9, 0xBB, 0x96, 0x1B, 0x8E, 0x87, 0x39, 0xBA, 0xE0, 0x78, 0x1D, 0xFE, 0xE7, 0x6B, 0x02,
+        0x8F, 0xCB, 0x1F, 0xFC, 0x99, 0x0E, 0xC0, 0xEF, 0xD7, 0x7B, 0x5D, 0x9E, 0xC3, 0x5A, 0xAD, 0x53,
+        0xAA, 0x14, 0x6A, 0x2D, 0x02, 0xD6, 0xF6, 0x75, 0xB3, 0xF4, 0x33, 0x72, 0xB1, 0xB1, 0x30, 0xB0,
+        0x6E, 0xDD, 0xB9, 0x5E, 0xC5, 0x37, 0xE5, 0xDB, 0x97, 0x0E, 0x3B, 0x6D, 0xBE, 0x3A, 0xE7, 0x9E,
+        0x18, 0xE3, 0x3B, 0xCF, 0x3A, 0xDD, 0xEA, 0xF7, 0x75, 0x9C, 0x46, 0x31, 0x1A, 0xFB, 0x75, 0xF6,
+        0x6E, 0xCF, 0x65, 0x51, 0xAA, 0x85, 0xB9, 0x6E, 0x2D, 0xE0, 0xEC, 0x65, 0x8B, 0xCA, 0xCB, 0x8C,
+        0x1B, 0x8B, 0x85, 0x92, 0xE2, 0xE0, 0x8B, 0x83, 0x06, 0x0C, 0xCD, 0x99, 0xA3, 0xCB, 0x19, 0x18,
+        0xC6, 0x31, 0xE0, 0xEF, 0x37, 0x19, 0x1B, 0xC4, 0xE6, 0x90, 0x37, 0x7A, 0xDD, 0xE3, 0x41, 0xE0,
+        0xEF, 0x46, 0x77, 0x86, 0x81, 0xCB, 0x96, 0x38, 0x0C, 0x01, 0xE0, 0xD7, 0x96, 0x4B, 0x20, 0xC6,
+        0x3C, 0x1D, 0x91, 0x93, 0x78, 0xC4, 0x8C, 0x44, 0xE6, 0xE3, 0x0B, 0xC4, 0x08, 0x80, 0xF5, 0x7B,
+        0xBC, 0xEF, 0x00, 0x39, 0x4C, 0xB9, 0x79, 0xB8, 0x0C, 0x00, 0x2D, 0xEE, 0xD7, 0xBB, 0x65, 0x82,
+        0xC1, 0x91, 0x23, 0x26, 0xF1, 0x82, 0xC6, 0x31, 0xC6, 0x32, 0xF1, 0xA3, 0xC4, 0x88, 0x73, 0x4C,
+        0xB2, 0x14, 0x3C, 0x58, 0x7B, 0x8F, 0x77, 0xB8, 0x3D, 0xDE, 0x77, 0x80, 0xD3, 0xC3, 0x4C, 0x5C,
+        0x37, 0x80, 0xC0, 0x82, 0x91, 0x8E, 0x6F, 0x19, 0x64, 0x60, 0xBC, 0xD8, 0xF3, 0x79, 0xB8, 0xC9,
+        0xBC, 0x44, 0x89, 0x1C, 0x5C, 0xBC, 0xDC, 0x60, 0x3B, 0xDA, 0x0F, 0x53, 0xDD, 0xE0, 0xEF, 0x3B,
+        0xC7, 0x78, 0x7B, 0x81, 0xCA, 0x65, 0x92, 0xE0, 0x6F, 0x00, 0x17, 0x94, 0x79, 0x63, 0x96, 0x38,
+        0xC1, 0x65, 0x9C, 0xAC, 0x79, 0xB2, 0x31, 0x0D, 0xBB, 0x35, 0xA6, 0xB5, 0xE8, 0x5C, 0x63, 0x0B,
+        0xC4, 0x22, 0x64, 0x00, 0xC0, 0x40, 0x10, 0x00, 0x00, 0x08, 0x01, 0x00, 0x81, 0x00, 0x60, 0x80,
+        0x8A, 0x2B, 0xE5, 0xAF, 0xFD, 0xDD, 0xFE, 0xEC, 0x8E, 0x20, 0x09, 0x3F, 0x66, 0x39, 0xF6, 0x6F,
+        0x99, 0xE5, 0x50, 0x02, 0x9C, 0xB6, 0xFF, 0x18, 0x19, 0x15, 0xE5, 0x57, 0x50, 0xD2, 0xD4, 0x55,
+        0x01, 0x3A, 0x4D, 0xD3, 0x44, 0xC1, 0x2D, 0xCA, 0x32, 0x75, 0xB1, 0xF8, 0x9B, 0xBB, 0x1A, 0xF9,
+        0xF9, 0xF9, 0x98, 0x98, 0xF8, 0x57, 0xAE, 0xDB, 0xB7, 0x5A, 0x9A, 0x74, 0xE7, 0xC7, 0x86, 0xDA,
+        0xED, 0x96, 0x78, 0xE7, 0x5C, 0xEB, 0x79, 0x6F, 0x7D, 0xDD, 0xEF, 0x33, 0x77, 0x2F, 0x26, 0x48,
+        0xEB, 0x7B, 0x1D, 0x0E, 0xE7, 0x79, 0xAA, 0x30, 0xB1, 0xB9, 0x72, 0x81, 0x37, 0x04, 0xB8, 0xC2,
+        0xE3, 0x2E, 0x5E, 0x6E, 0x03, 0xBD, 0xA3, 0xBD, 0xEE, 0x18, 0x01, 0xBB, 0xC0, 0x5B, 0xC3, 0x73,
+        0x79, 0x71, 0x97, 0x1E, 0x6C, 0x11, 0xE6, 0xF2, 0xC1, 0xC6, 0x24, 0x8A, 0x38, 0xCB, 0xC4, 0x60,
+        0x49, 0x4C, 0x0E, 0xD9, 0xDE, 0x00, 0xF7, 0x09, 0x85, 0x92, 0xE0, 0x0C, 0xCA, 0x8F, 0x2C, 0x71,
+        0x96, 0x41, 0xE6, 0xC4, 0x79, 0xBC, 0xDE, 0x2C, 0x89, 0x13, 0x9A, 0x27, 0x37, 0x18, 0x5C, 0x88,
+        0x19, 0x43, 0x5E, 0xEF, 0x3B, 0xC0, 0x02, 0x47, 0x2F, 0x36, 0x42, 0xE3, 0x00, 0x62, 0x3C, 0xB1,
+        0x91, 0x71, 0x88, 0xC7, 0x9B, 0x22, 0xF1, 0xBC, 0x46, 0x03, 0x6E, 0xD3, 0xD6, 0xEF, 0x2C, 0x00,
+        0x1E, 0xEC, 0x0C, 0x0E, 0xF0, 0x34, 0x7B, 0xB4, 0x38, 0x6F, 0x06, 0x0C, 0x1E, 0x57, 0x83, 0xBC,
+        0xB0, 0x71, 0x89, 0x18, 0xF0, 0x76, 0x4B, 0x8C, 0x26, 0xE4, 0x42, 0x0B, 0x94, 0xC5, 0xC2, 0xE0,
+        0xC0, 0x00, 0x7B, 0x9E, 0xE6, 0xDD, 0xE0, 0x77, 0x96, 0x1A, 0x35, 0xEE, 0x19, 0x2C, 0x86, 0xF0,
+        0x64, 0x59, 0x02, 0x6B, 0x2D, 0xAB, 0x69, 0xF8, 0x74, 0x8E, 0x32, 0xE3, 0x06, 0x00, 0x34, 0x1B,
+        0x73, 0xDD, 0xE7, 0x07, 0x9D, 0xE0, 0x0F, 0x73, 0x04, 0xF3, 0xBD, 0x5E, 0x2C, 0x4C, 0x18, 0x08,
+        0x10, 0x00, 0x00, 0x86, 0x06, 0x08, 0x08, 0x40, 0xA2, 0x8B, 0xEF, 0x3F, 0xFF, 0xFF, 0xFC, 0xE5,
+        0x73, 0xE5, 0xA5, 0xC4, 0xCC, 0x44, 0x4F, 0x2A, 0x23, 0x41, 0xA7, 0xCC, 0x02, 0x9F, 0xFA, 0x6D,
+        0x84, 0xD0, 0x55, 0xE3, 0x6E, 0xD9, 0x75, 0xC5, 0x59, 0x4D, 0x51, 0x33, 0xFC, 0xF1, 0x36, 0xCC,
+        0x92, 0xDC, 0xA7, 0x6C, 0xCE, 0x47, 0x03, 0x67, 0x57, 0x4F, 0x2F, 0x2B, 0x0F, 0x12, 0xF5, 0xDB,
+        0x16, 0xA9, 0xD6, 0xA6, 0x3C, 0x36, 0xDB, 0x4C, 0xF2, 0xC7, 0x2A, 0xE1, 0x5B, 0xD2, 0xB2, 0x97,
+        0x27, 0x77, 0x26, 0xD9, 0xB1, 0x6A, 0x4A, 0x1D, 0x1A, 0x32, 0x93, 0x71, 0x48, 0x12, 0xDB, 0xB5,
+        0xAD, 0x6B, 0x05, 0x92, 0xC2, 0x24, 0x62, 0x73, 0x41, 0xEB, 0x3B, 0xF4, 0x06, 0x00, 0x5E, 0x02,
+        0xDE, 0xE1, 0x24, 0xB2, 0x59, 0x1E, 0x6C, 0x25, 0x19, 0x26, 0xF1, 0x22, 0x44, 0x92, 0x8E, 0x5C,
+        0x9B, 0x80, 0x01, 0x97, 0x28, 0x98, 0x5C, 0x60, 0x0C, 0xCA, 0xF0, 0x6C, 0x96, 0x46, 0x31, 0x91,
+        0x78, 0x3B, 0x8C, 0x22, 0xCC, 0xA4, 0x72, 0x87, 0xAC, 0xEF, 0x00, 0xF7, 0x03, 0x5E, 0xEF, 0x2B,
+        0xC6, 0x96, 0x1C, 0xDE, 0x59, 0x16, 0x46, 0x38, 0xA3, 0xCD, 0xC7, 0x37, 0x88, 0x4D, 0xCC, 0xB0,
+        0x27, 0xBB, 0xDD, 0xE5, 0xAC, 0x02, 0x65, 0x33, 0x66, 0x16, 0x40, 0x60, 0x2C, 0xD5, 0xFB, 0xB2,
+        0xF4, 0xC2, 0xC6, 0x27, 0x34, 0xE6, 0xE3, 0x00, 0x2C, 0x3D, 0xCC, 0x5E, 0xEF, 0x03, 0xBC, 0xB0,
+        0x1A, 0x7B, 0x83, 0x5E, 0x57, 0xAC, 0xB6, 0x90, 0xF3, 0x79, 0xBC, 0x58, 0x44, 0x89, 0x02, 0xF5,
+        0x7A, 0xCE, 0xF1, 0x60, 0x0F, 0x73, 0x2C, 0xDD, 0xE7, 0x78, 0x05, 0x86, 0x9E, 0xFB, 0xF7, 0x61,
+        0x96, 0x41, 0x8C, 0x60, 0xF3, 0x60, 0x6B, 0x2C, 0xB6, 0x9A, 0x78, 0x29, 0xEB, 0x77, 0xBB, 0xCB,
+        0x00, 0x07, 0xB9, 0xEE, 0x7B, 0xBD, 0x43, 0x80, 0x30, 0x18, 0x66, 0xCC, 0xD1, 0xE5, 0x8E, 0x2C,
+        0x8C, 0x60, 0xE2, 0x04, 0x40, 0x08, 0x4C, 0x52, 0x04, 0x41, 0x10, 0x51, 0x4F, 0xFF, 0xF0, 0x56,
+        0x4F, 0x3C, 0xA1, 0x6D, 0xB8, 0x8A, 0x27, 0xD5, 0xEA, 0xBA, 0x55, 0x38, 0x02, 0x95, 0x23, 0xFF,
+        0xEF, 0x35, 0x11, 0x97, 0xF1, 0xEE, 0x19, 0xBF, 0xAE, 0x6B, 0x3A, 0xB9, 0xA9, 0x69, 0x1A, 0x0E,
+        0x77, 0x9B, 0xE6, 0x1B, 0x6C, 0xF3, 0xB8, 0xFC, 0x1D, 0x8D, 0x4C, 0xDC, 0xAC, 0x5C, 0x1B, 0xF6,
+        0x2C, 0xD7, 0xA3, 0x4A, 0x96, 0xDB, 0x5C, 0x34, 0xC6, 0xD7, 0xB5, 0x2D, 0x4A, 0x46, 0x92, 0x93,
+        0x9B, 0x56, 0x2D, 0x30, 0xDC, 0x4C, 0x48, 0x6E, 0xF7, 0x1A, 0x3B, 0xCB, 0x06, 0xF1, 0xB8, 0x13,
+        0x70, 0x0C, 0xA0, 0x99, 0x72, 0xE1, 0x70, 0x60, 0x10, 0x26, 0xB6, 0xED, 0xAD, 0x6B, 0x60, 0xED,
+        0x96, 0x1A, 0x0F, 0x07, 0x7A, 0x6E, 0xF0, 0x34, 0xF0, 0xD8, 0xE3, 0x2C, 0x8F, 0x36, 0x3C, 0xD0,
+        0xF5, 0xAC, 0xD1, 0xAF, 0x73, 0xC1, 0x67, 0x78, 0x0B, 0xF7, 0x3C, 0x36, 0x4B, 0x8C, 0x18, 0x3C,
+        0xD9, 0x02, 0xD6, 0xD3, 0x4D, 0x3D, 0x41, 0xEE, 0xF2, 0xC0, 0x3D, 0xC0, 0xF7, 0x6D, 0xDE, 0x58,
+        0xB1, 0x85, 0x8C, 0x71, 0x1C, 0x71, 0x48, 0x32, 0xF3, 0x78, 0xB0, 0x00, 0x22, 0x39, 0x4C, 0xB9,
+        0x64, 0x2E, 0x03, 0xC1, 0xA3, 0xCA, 0x49, 0xBC, 0x5C, 0x62, 0x31, 0xE6, 0xC7, 0x19, 0x78, 0x8C,
+        0x00, 0xD7, 0xB8, 0xF7, 0x7A, 0x68, 0x18, 0x0D, 0x3D, 0xDA, 0xF7, 0x0C, 0x8B, 0x8C, 0x22, 0xC8,
+        0xCA, 0x3C, 0xDE, 0x2C, 0x08, 0x91, 0xCA, 0x07, 0xAD, 0xDE, 0xEF, 0x00, 0x04, 0xCA, 0x47, 0x2E,
+        0x32, 0xE3, 0x01, 0x61, 0x17, 0x9B, 0x23, 0x26, 0xF1, 0x18, 0x91, 0x23, 0x8B, 0x97, 0x18, 0x0E,
+        0xF1, 0xA0, 0x3D, 0xC1, 0xCB, 0x25, 0xC1, 0x08, 0x0F, 0x28, 0xB0, 0x8C, 0x73, 0x78, 0xCB, 0x08,
+        0x2C, 0x64, 0xB1, 0xC6, 0x5C, 0x60, 0x16, 0x0D, 0x1E, 0xE3, 0xDC, 0x39, 0x70, 0xB8, 0x21, 0x03,
+        0x36, 0x10, 0x09, 0x15, 0x78, 0x9D, 0x5A, 0x28, 0xF5, 0x40, 0xA4, 0xA0, 0x6F, 0x7B, 0xE4, 0x8B,
+        0x82, 0x21, 0xD3, 0x06, 0x70, 0x2A, 0x02, 0x9C, 0x16, 0xFF, 0xFD, 0xB0, 0xC2, 0x7B, 0x6B, 0x4E,
+        0xE7, 0x0C, 0x7D, 0x86, 0xEF, 0x6B, 0x72, 0xC0, 0xA9, 0xE8, 0xF9, 0xFE, 0x73, 0x99, 0xAD, 0xB5,
+        0xCF, 0xE2, 0x6E, 0x6A, 0xE8, 0xE3, 0xE2, 0xDF, 0xB9, 0x5E, 0xB5, 0x39, 0xF3, 0x67, 0xCF, 0x1D,
+        0xEF, 0x5B, 0xD6, 0x2B, 0x17, 0x37, 0x35, 0x07, 0x19, 0x5D, 0xE6, 0xA0, 0x32, 0xC4, 0x0D, 0x37,
+        0x66, 0x9A, 0xD3, 0xC1, 0x5E, 0xEF, 0x5B, 0xBC, 0x06, 0x11, 0x32, 0xE3, 0x2E, 0x30, 0x88, 0x2F,
+        0x37, 0x9B, 0xC4, 0x89, 0x18, 0xE0, 0x77, 0xAD, 0xDE, 0x01, 0xEE, 0x0C, 0x70, 0x5C, 0x18, 0x45,
+        0xE6, 0x8F, 0x37, 0x8B, 0x08, 0x92, 0x53, 0x11, 0x97, 0x02, 0xE1, 0x94, 0x08, 0xE0, 0xDC, 0x5C,
+        0x60, 0xC2, 0x2E, 0x23, 0x26, 0xF1, 0x22, 0x12, 0x53, 0x10, 0xDD, 0xE7, 0x78, 0x34, 0x7B, 0x86,
+        0x4B, 0x8B, 0x8C, 0x1E, 0x6C, 0x88, 0xC6, 0x5E, 0x24, 0x42, 0x26, 0x50, 0xF5, 0xBB, 0xC7, 0x78,
+        0x69, 0xE1, 0xB1, 0xE6, 0xC8, 0xB8, 0xC8, 0xB0, 0x48, 0xCB, 0xCD, 0xC8, 0x84, 0x40, 0x63, 0x97,
+        0x2E, 0x5C, 0x2E, 0x00, 0x08, 0x44, 0xCB, 0x1C, 0xB2, 0x31, 0x18, 0xC1, 0xC4, 0x97, 0x8D, 0xE2,
+        0x0B, 0x03, 0x2C, 0x72, 0x99, 0x70, 0xA1, 0xE1, 0xDE, 0xD0, 0xD7, 0xBB, 0x0B, 0x9B, 0xC1, 0x8C,
+        0x63, 0x22, 0x87, 0xAD, 0x62, 0xC6, 0x9E, 0xE1, 0x0C, 0xB9, 0x72, 0xE0, 0x17, 0x00, 0x34, 0x35,
+        0xAF, 0x76, 0xBD, 0x61, 0x63, 0x18, 0xE2, 0xF3, 0x71, 0x94, 0x3F, 0x45, 0x8F, 0x71, 0x80, 0x06,
+        0xEF, 0x05, 0x80, 0xC4, 0x8E, 0x58, 0xC8, 0xB8, 0xC1, 0x63, 0x8B, 0x25, 0xC6, 0x30, 0xA1, 0xED,
+        0x03, 0x5E, 0xE7, 0xBB, 0xC1, 0xDE, 0xED, 0xBB, 0xC2, 0xC3, 0x11, 0x09, 0x15, 0x2A, 0x27, 0x5B,
+        0xD6, 0x75, 0x34, 0x03, 0x01, 0x59, 0x98, 0xEC, 0xAB, 0xF3, 0x11, 0xC2, 0x73, 0xA9, 0xA2, 0xB0,
+        0x02, 0xA0, 0xA1, 0xFF, 0x7B, 0x93, 0xDF, 0x20, 0x70, 0xBE, 0xEA, 0xD9, 0xAA, 0xB3, 0x4B, 0x27,
+        0xEC, 0xDC, 0x97, 0xD2, 0x72, 0x41, 0x47, 0x48, 0xCB, 0x5F, 0xA3, 0xEB, 0xF8, 0x3C, 0xDD, 0xDD,
+        0x5C, 0x3B, 0xB4, 0x65, 0xC5, 0x7D, 0xB6, 0x4F, 0x4C, 0xBB, 0xCD, 0xF6, 0xEC, 0xED, 0x5A, 0x91,
+        0x28, 0x84, 0x77, 0xBB, 0xD4, 0x7A, 0x81, 0xC5, 0xCB, 0x85, 0xC2, 0xE0, 0x10, 0x50, 0xCB, 0x1C,
+        0x63, 0x18, 0xC0, 0xBD, 0x6B, 0x2C, 0x1E, 0xE0, 0xE5, 0xCB, 0x97, 0x01, 0x81, 0x10, 0x63, 0x1C,
+        0x48, 0xC6, 0x39, 0x70, 0x2D, 0xDE, 0x2C, 0xF7, 0x1A, 0xF0, 0xDC, 0x42, 0x0C, 0x1E, 0x6C, 0x88,
+        0x6B, 0x34, 0xD1, 0xB7, 0x7B, 0x83, 0xDD, 0xE0, 0x06, 0xBD, 0xC3, 0x25, 0x91, 0x8C, 0x1C, 0x5E,
+        0x68, 0x7B, 0x7D, 0xE6, 0x86, 0xB0, 0x10, 0x25, 0xC0, 0x19, 0x95, 0xE5, 0x18, 0xC9, 0x61, 0x18,
+        0xC9, 0x64, 0x0E, 0xF5, 0x9D, 0xE0, 0x64, 0x0F, 0x77, 0x93, 0x2C, 0xB2, 0xC3, 0x18, 0xE6, 0xF1,
+        0x60, 0x44, 0xC1, 0x5C, 0xB8, 0xCB, 0x85, 0xC0, 0x00, 0x69, 0xEE, 0x6B, 0xD6, 0xED, 0x82, 0xC9,
+        0x61, 0x2F, 0x37, 0x18, 0x30, 0x48, 0x99, 0x43, 0x2E, 0x5C, 0xB8, 0x83, 0x05, 0x9A, 0x7B, 0xEF,
+        0xDC, 0x32, 0x6F, 0x18, 0xC6, 0x31, 0xC5, 0x0F, 0x59, 0xDE, 0x2C, 0x3D, 0xC1, 0x32, 0xE5, 0xCB,
+        0x25, 0xC1, 0x82, 0x19, 0xA6, 0xAF, 0xD5, 0xAC, 0xC2, 0x91, 0x8E, 0x58, 0xE5, 0xC2, 0xE0, 0x2C,
+        0x0B, 0x3D, 0xCF, 0x70, 0x6B, 0xD5, 0xEB, 0x2D, 0x65, 0x83, 0x57, 0xAD, 0x65, 0x9A, 0x04, 0x88,
+        0x65, 0x92, 0xE5, 0xC2, 0xE0, 0x58, 0x16, 0x7B, 0xED, 0xEE, 0xC2, 0xC7, 0x17, 0x18, 0x91, 0xE6,
+        0x83, 0x22, 0xF8, 0x5A, 0xF1, 0xCB, 0x9D, 0xF9, 0x40, 0x24, 0x0B, 0x03, 0xF4, 0x29, 0xEC, 0xDB,
+        0xFA, 0x76, 0xDD, 0xA5, 0xA4, 0x80, 0x02, 0xAF, 0xF8, 0xA2, 0x83, 0xEB, 0x37, 0x9D, 0x98, 0xF3,
+        0x80, 0x76, 0xDA, 0xB1, 0x52, 0xB9, 0xE9, 0x33, 0xA5, 0x64, 0x87, 0x8D, 0xB1, 0x72, 0x29, 0xD7,
+        0xC7, 0xEB, 0xEB, 0xE9, 0xE0, 0xD3, 0x9B, 0x06, 0x0B, 0x66, 0xB2, 0x49, 0x26, 0x8A, 0x3E, 0xB7,
+        0x68, 0xD1, 0x96, 0x2C, 0x17, 0x2C, 0x64, 0xB0, 0x8C, 0x62, 0x1A, 0xF5, 0xBB, 0xD6, 0x00, 0x26,
+        0x5C, 0xB2, 0x5C, 0x60, 0xC8, 0x83, 0x77, 0xEA, 0xC6, 0x8F, 0x50, 0x7B, 0xBC, 0xEF, 0x16, 0x1A,
+        0xF0, 0xEF, 0x2C, 0x8C, 0x63, 0x25, 0x92, 0x87, 0xAC, 0x01, 0xEE, 0xF7, 0x61, 0x70, 0x5C, 0x1E,
+        0x6C, 0x23, 0x11, 0x83, 0x08, 0x99, 0x63, 0x97, 0x01, 0xB8, 0x17, 0x88, 0x04, 0x73, 0x78, 0x2B,
+        0x8C, 0x63, 0x25, 0x92, 0xC8, 0x0E, 0xF0, 0xD1, 0x96, 0xBC, 0x25, 0x90, 0x60, 0xC0, 0x97, 0x9A,
+        0x3C, 0x58, 0x11, 0x22, 0x65, 0xCA, 0x1B, 0x3B, 0xCB, 0x06, 0x9E, 0x1D, 0xE1, 0x71, 0x8C, 0x63,
+        0x1C, 0x45, 0xC6, 0x5C, 0x26, 0xE1, 0x94, 0x01, 0xCA, 0x62, 0xE5, 0xC1, 0x83, 0x00, 0xB6, 0xB5,
+        0xAD, 0x6D, 0x18, 0x52, 0x03, 0x97, 0x0B, 0x85, 0xC0, 0x03, 0x4D, 0x7B, 0xB5, 0xEA, 0x19, 0x18,
+        0xC6, 0x4B, 0x25, 0xE6, 0xE0, 0x16, 0x03, 0x27, 0xB8, 0x3D, 0xDE, 0xAF, 0x16, 0x59, 0xA1, 0x79,
+        0xBC, 0xDE, 0x2C, 0x22, 0x11, 0x06, 0xDC, 0xF7, 0x7B, 0xBC, 0x98, 0x00, 0x34, 0xD7, 0xAB, 0xD0,
+        0xB8, 0xC6, 0x31, 0xC5, 0xC5, 0xC0, 0xB1, 0x60, 0x0F, 0x70, 0x99, 0x72, 0xE5, 0xC6, 0x5C, 0x60,
+        0x0B, 0x22, 0x45, 0xE6, 0xF1, 0x61, 0x07, 0x78, 0x84, 0x94, 0x92, 0x99, 0x70, 0x1D, 0xE4, 0xC0,
+        0x68, 0x50, 0xCD, 0x20, 0x6C, 0x6A, 0x6A, 0xF5, 0xCF, 0x8B, 0x00, 0xD0, 0x1E, 0x05, 0x92, 0xB6,
+        0xE0, 0x59, 0xE7, 0xC9, 0x20, 0xC9, 0xF0, 0x80, 0x02, 0xAF, 0xB9, 0x0F, 0xD8, 0x46, 0x92, 0xF0,
+        0xF3, 0x52, 0xB2, 0xC7, 0x05, 0xED, 0xCD, 0x4F, 0xA3, 0x33, 0x56, 0x59, 0x48, 0xB8, 0xD7, 0x13,
+        0x22, 0x1D, 0x7B, 0x7B, 0x39, 0xB6, 0xE8, 0xC5, 0x6D, 0x75, 0x4D, 0x2C, 0x92, 0x41, 0x14, 0x31,
+        0xAD, 0xC7, 0x64, 0x41, 0x80, 0x86, 0xD1, 0xAD, 0x6D, 0x34, 0x0D, 0x7B, 0x9E, 0x4C, 0x00, 0x34,
+        0xF5, 0x6D, 0x6B, 0x5B, 0x07, 0x7A, 0xD6, 0x00, 0xF7, 0x0E, 0x58, 0xE0, 0xC1, 0x8C, 0x8C, 0x0B,
+        0x58, 0xD1, 0xAF, 0x77, 0xB8, 0x3D, 0xDE, 0xB0, 0x59, 0xAF, 0x42, 0xC1, 0xC4, 0x8E, 0x2E, 0x5C,
+        0x43, 0x3B, 0xC0, 0xD3, 0xDD, 0xA1, 0xC6, 0x2E, 0x3C, 0xD8, 0xE2, 0xF1, 0x0E, 0xF3, 0x41, 0xEE,
+        0x7B, 0x9E, 0x12, 0xC8, 0x30, 0x1E, 0x6C, 0x8C, 0x19, 0xBC, 0x42, 0x21, 0x1C, 0xB9, 0x43, 0xCE,
+        0xF0, 0x2C, 0xF7, 0xDB, 0xC3, 0x60, 0xE3, 0x18, 0x91, 0xC6, 0x07, 0x7B, 0x76, 0x00, 0x7B, 0x84,
+        0x8E, 0x59, 0x0B, 0x24, 0x58, 0x87, 0xEF, 0xB6, 0x5A, 0xC1, 0xA0, 0x1E, 0xE7, 0x9D, 0xEE, 0xF2,
+        0xC0, 0xB0, 0x89, 0x19, 0x37, 0x8B, 0x01, 0x89, 0x25, 0x31, 0x70, 0xB8, 0x50, 0xF0, 0x0D, 0x35,
+        0xEE, 0xC3, 0x17, 0x18, 0xC6, 0x4B, 0x1C, 0x43, 0x77, 0xB7, 0xDE, 0x0D, 0x1A, 0x0C, 0xBD, 0xDE,
+        0xAF, 0x2C, 0xB0, 0x59, 0x12, 0x5E, 0x6F, 0x1B, 0xC4, 0x03, 0x46, 0x2F, 0x73, 0xCE, 0xF0, 0x3B,
+        0xD6, 0x0D, 0x2F, 0xDD, 0xA0, 0xD6, 0xDD, 0x9A, 0xD3, 0x5E, 0x83, 0x73, 0xD6, 0xEF, 0x1D, 0xE0,
+        0x1C, 0xA0, 0x44, 0xCB, 0x25, 0x91, 0x19, 0x71, 0xC5, 0x8F, 0x36, 0x4B, 0x88, 0x6B, 0x16, 0x07,
+        0xB9, 0x88, 0x18, 0x70, 0x94, 0xB3, 0xC6, 0xFD, 0x7B, 0xEB, 0x9B, 0x01, 0x40, 0x17, 0x02, 0xE0,
+        0x79, 0x38, 0x2E, 0xC8, 0xDF, 0x1C, 0x66, 0xE0, 0x02, 0xAF, 0xFF, 0xE7, 0x9B, 0x6D, 0xFC, 0x30,
+        0xE6, 0x4E, 0xC1, 0x66, 0x4E, 0x00, 0xD9, 0xAA, 0x47, 0x3B, 0xA5, 0x1C, 0x8A, 0x8C, 0xD1, 0x0A,
+        0x16, 0x42, 0x8A, 0x7B, 0xF9, 0xF4, 0xDB, 0x4C, 0x2F, 0x48, 0xD6, 0x23, 0x84, 0x01, 0x08, 0x91,
+        0x63, 0x26, 0xF1, 0x1C, 0x40, 0xDB, 0x98, 0xCE, 0xF0, 0x43, 0xCA, 0x47, 0x16, 0x46, 0x31, 0xC0,
+        0xAF, 0x59, 0xDE, 0x03, 0xDC, 0x39, 0x64, 0xB8, 0xC6, 0x30, 0x97, 0x83, 0xB8, 0xC0, 0x61, 0x94,
+        0x32, 0xE0, 0x77, 0x95, 0xE6, 0x96, 0xD6, 0x86, 0x13, 0x78, 0x91, 0xCA, 0x61, 0x70, 0x3B, 0xC2,
+        0xC3, 0x5A, 0xF7, 0xC3, 0xC6, 0x6F, 0x1C, 0x53, 0x19, 0x72, 0x87, 0x80, 0x1A, 0xF7, 0x6C, 0x36,
+        0x46, 0x30, 0x96, 0x4B, 0x20, 0x1D, 0xED, 0x03, 0xDC, 0xD7, 0xB8, 0x3D, 0x67, 0x6D, 0xA5, 0xB5,
+        0x81, 0x65, 0x8C, 0xB5, 0xEE, 0xF7, 0x0E, 0x59, 0x2E, 0x04, 0x46, 0x46, 0x0B, 0xCA, 0x32, 0x24,
+        0x4C, 0xB2, 0x07, 0x7B, 0xBD, 0xDE, 0x05, 0x8F, 0x0E, 0xF2, 0xC6, 0x4B, 0x23, 0x12, 0x21, 0xB7,
+        0x7A, 0xDD, 0xE7, 0x78, 0x02, 0x19, 0x4C, 0xB2, 0x59, 0x2C, 0x80, 0xB1, 0x92, 0xF3, 0x64, 0xBC,
+        0x6E, 0x01, 0xA0, 0x3D, 0xCF, 0x77, 0xA0, 0x32, 0xBC, 0xD5, 0xB4, 0xD0, 0x65, 0x96, 0x6D, 0xC3,
+        0xD0, 0xB9, 0x72, 0xE3, 0x12, 0x00, 0xF0, 0x6B, 0x23, 0x9B, 0xCB, 0x07, 0x12, 0x0A, 0x49, 0x49,
+        0x2E, 0x5C, 0x48, 0x05, 0x96, 0x3D, 0xC6, 0xB5, 0xE1, 0xB2, 0x59, 0x18, 0xC6, 0x38, 0xA1, 0xEB,
+        0x77, 0xAC, 0xEF, 0x00, 0x30, 0x43, 0x2E, 0x58, 0xE3, 0x2E, 0x0B, 0x06, 0x32, 0x2F, 0x37, 0x18,
+        0x86, 0x58, 0x34, 0x3D, 0xC3, 0x43, 0x04, 0x02, 0x45, 0x89, 0x52, 0x7A, 0x6F, 0xA6, 0xF6, 0x04,
+        0x00, 0x42, 0x07, 0x81, 0x42, 0x91, 0x5E, 0xB9, 0x9F, 0x80, 0x00, 0xDF, 0x00, 0x02, 0xAF, 0xF5,
+        0xA5, 0xFE, 0x1D, 0xBD, 0x81, 0xF4, 0xEB, 0xA2, 0x9B, 0x0F, 0x94, 0x16, 0xF2, 0xAD, 0xCD, 0x59,
+        0x63, 0x1A, 0x62, 0xDC, 0x3B, 0x84, 0x10, 0x32, 0x7F, 0x3F, 0xC7, 0x7C, 0x6F, 0x35, 0x50, 0x51,
+        0x23, 0x00, 0x40, 0xE6, 0xBD, 0xD8, 0xBC, 0x76, 0xC0, 0xD5, 0xB5, 0xAD, 0xA3, 0x42, 0x65, 0x32,
+        0xE0, 0x5C, 0x19, 0x9A, 0x33, 0x36, 0x48, 0xB2, 0x24, 0x94, 0x0F, 0x77, 0x93, 0x01, 0xA0, 0xC9,
+        0x63, 0x23, 0x1C, 0xB1, 0xC4, 0x33, 0xBC, 0x03, 0x5E, 0xEC, 0x2E, 0x32, 0xC8, 0xE2, 0xC8, 0xC0,
+        0x3B, 0xC3, 0x41, 0xAF, 0x77, 0x85, 0x70, 0x63, 0x22, 0xF3, 0x71, 0x80, 0xB0, 0xD6, 0x4F, 0x76,
+        0xC3, 0x70, 0x60, 0x4B, 0x08, 0xBC, 0x42, 0xC6, 0x8D, 0x7B, 0x9E, 0xEF, 0x02, 0x6B, 0x17, 0xEE,
+        0xB6, 0xBC, 0x2B, 0x08, 0x91, 0x23, 0x97, 0x28, 0xE2, 0x41, 0x26, 0x51, 0x99, 0x60, 0x5E, 0x76,
+        0x6B, 0x4D, 0x7A, 0xC1, 0xD8, 0xCE, 0xF0, 0x7B, 0x90, 0xF2, 0x92, 0x59, 0x2C, 0x8C, 0x64, 0x0E,
+        0xCD, 0xDE, 0xB3, 0xBC, 0x34, 0x24, 0x43, 0x2E, 0x59, 0x2E, 0x31, 0x18, 0x31, 0xC6, 0x2F, 0x1B,
+        0x93, 0x47, 0x08, 0x99, 0x40, 0xCB, 0x97, 0x10, 0xDD, 0xEB, 0x2C, 0x6E, 0xDA, 0xC2, 0xC6, 0x13,
+        0x78, 0x99, 0x42, 0x00, 0x06, 0xEF, 0x0B, 0x02, 0xF2, 0xBC, 0xDE, 0x58, 0x32, 0x2C, 0x07, 0xA9,
+        0x8B, 0xDD, 0xE3, 0xBC, 0x0E, 0xF0, 0xD1, 0xA6, 0xB0, 0xB8, 0xB2, 0x31, 0x89, 0x1C, 0x40, 0xDD,
+        0xB3, 0xBC, 0x00, 0x41, 0xE5, 0x23, 0x96, 0x38, 0xC4, 0x62, 0xE4, 0xB1, 0x92, 0xE2, 0xE0, 0x16,
+        0x58, 0x03, 0xDC, 0x32, 0x14, 0x32, 0x06, 0x27, 0x70, 0xC2, 0xFD, 0x3D, 0x7D, 0x2C, 0x09, 0xC0,
+        0xB8, 0x0B, 0xC1, 0x40, 0x34, 0xD7, 0x83, 0xEE, 0x61, 0xFB, 0x2B, 0x00, 0x02, 0xBF, 0xFB, 0x45,
+        0x56, 0xCF, 0x5A, 0x5C, 0x04, 0xE3, 0x86, 0xCD, 0xA8, 0xAE, 0x51, 0x23, 0xEA, 0x1D, 0x21, 0xD6,
+        0x09, 0xE0, 0xDE, 0x05, 0xA0, 0x1A, 0x02, 0x45, 0xF3, 0xFC, 0xE7, 0x37, 0x20, 0x34, 0xE0, 0xA2,
+        0x85, 0x8C, 0x97, 0x9B, 0x8C, 0x01, 0x83, 0x10, 0xCB, 0x96, 0x42, 0xCC, 0x41, 0x71, 0x78, 0xDC,
+        0x88, 0x01, 0x83, 0x4C, 0xB8, 0xCB, 0x8C, 0x88, 0xC1, 0x83, 0x08, 0xDE, 0x30, 0x72, 0x83, 0x88,
+        0x42, 0xE3, 0xCD, 0x91, 0x88, 0xC6, 0x11, 0x08, 0xE5, 0x32, 0xE0, 0x97, 0x18, 0x0C, 0xCD, 0x92,
+        0x6F, 0x05, 0x61, 0x12, 0x39, 0x4C, 0x2E, 0x0D, 0xC0, 0x06, 0x66, 0xCC, 0xDE, 0x28, 0xC8, 0x91,
+        0x23, 0x96, 0x4B, 0x80, 0x3B, 0xC6, 0x86, 0xB5, 0xEE, 0x18, 0x45, 0xC0, 0x64, 0xB9, 0x71, 0x0C,
+        0x2D, 0x7A, 0x7B, 0x9A, 0xC3, 0x2C, 0x8C, 0x63, 0x25, 0x92, 0xE0, 0x59, 0xDE, 0x0F, 0x71, 0xAF,
+        0x0A, 0x46, 0x2E, 0x38, 0xB1, 0xC4, 0x35, 0xBB, 0xCB, 0x0F, 0x71, 0x85, 0x84, 0xB2, 0x5C, 0x63,
+        0x18, 0x0C, 0xB2, 0x30, 0xBC, 0x6E, 0x44, 0x82, 0xC6, 0x30, 0x97, 0x17, 0x06, 0x02, 0xCD, 0xDB,
+        0x5A, 0xC5, 0x84, 0x08, 0x99, 0x43, 0x2E, 0x5C, 0x43, 0x23, 0x2D, 0xA6, 0xB4, 0x1A, 0xC5, 0x98,
+        0x8F, 0x70, 0xE5, 0x30, 0xB8, 0x32, 0xE6, 0x6C, 0x04, 0x8B, 0xCD, 0xE6, 0xF1, 0x61, 0x10, 0x48,
+        0x99, 0x64, 0xA6, 0x17, 0x04, 0x34, 0xC6, 0x8D, 0x35, 0x81, 0x7A, 0x69, 0xA6, 0x9E, 0x80, 0xDC,
+        0xF3, 0xBC, 0x04, 0x3C, 0xA3, 0x32, 0xC6, 0x32, 0x31, 0x11, 0xC7, 0x2C, 0x64, 0xB9, 0x71, 0x81,
+        0xDE, 0x1D, 0xE1, 0xA3, 0xDF, 0x1B, 0x18, 0x11, 0x1D, 0x0D, 0xD4, 0xF9, 0x73, 0xF6, 0xFC, 0x7F,
+        0x6B, 0x03, 0xB0, 0x42, 0x04, 0x50, 0x72, 0x11, 0xF7, 0xA8, 0xFE, 0x60, 0xDF, 0xD1, 0x50, 0x02,
+        0xBB, 0x7B, 0x7F, 0xF8, 0x7A, 0x7E, 0xCA, 0xBB, 0x8C, 0xE0, 0xD2, 0xFA, 0x2A, 0x06, 0x58, 0xE2,
+        0xB6, 0x24, 0x60, 0x56, 0x11, 0xE0, 0x2C, 0x09, 0x20, 0x08, 0x01, 0xC5, 0xFF, 0xAF, 0x3F, 0xCB,
+        0xDA, 0x94, 0x1C, 0x38, 0x00, 0x0D, 0xE2, 0x11, 0x8C, 0x9B, 0xC4, 0x81, 0x31, 0x7B, 0xBC, 0x77,
+        0xB4, 0x03, 0x5A, 0xDA, 0xB3, 0x5E, 0xE0, 0xDB, 0xBD, 0xDE, 0x3B, 0xCD, 0x00, 0xD6, 0xD2, 0xF4,
+        0xDB, 0x9B, 0x07, 0x79, 0xDE, 0x0B, 0x7B, 0x9A, 0x18, 0xE2, 0x38, 0xE5, 0x92, 0x98, 0x05, 0x93,
+        0x34, 0x36, 0xEC, 0x23, 0x8C, 0x62, 0x49, 0x71, 0x88, 0x90, 0x2F, 0x94, 0x66, 0x58, 0xE5, 0x19,
+        0x12, 0x31, 0x92, 0xC9, 0x72, 0x87, 0x80, 0xF7, 0x1A, 0xF7, 0x61, 0x71, 0x8C, 0x49, 0x2C, 0x97,
+        0x10, 0xC0, 0xEF, 0x7B, 0x9A, 0x7B, 0x86, 0x41, 0x71, 0x8E, 0x2C, 0x97, 0x01, 0x6E, 0xF0, 0x7B,
+        0x87, 0xA1, 0x79, 0xB2, 0x31, 0x83, 0x25, 0x90, 0x3B, 0x65, 0x9D, 0xE1, 0xEE, 0x78, 0x69, 0x1C,
+        0x2C, 0x8B, 0x84, 0xB0, 0x2F, 0x4D, 0xDE, 0x58, 0xB6, 0x0A, 0x11, 0xCA, 0x63, 0x2E, 0x30, 0x16,
+        0x30, 0x97, 0x18, 0xCB, 0x91, 0x1B, 0x84, 0x63, 0x18, 0xE5, 0xCB, 0x82, 0xC5, 0xC1, 0x84, 0xB2,
+        0x2F, 0x02, 0xEF, 0x58, 0xD0, 0xF7, 0x03, 0x97, 0x2C, 0x08, 0x30, 0xBC, 0x50, 0xDA, 0xBD, 0x6B,
+        0x58, 0x58, 0x1E, 0xE6, 0x59, 0x66, 0x77, 0x85, 0x97, 0x1E, 0x6C, 0x1E, 0x6C, 0x8C, 0x05, 0x8B,
+        0xF7, 0x5B, 0xDC, 0x3C, 0x37, 0x2E, 0x5C, 0xB8, 0xCB, 0x83, 0x20, 0x4B, 0x6B, 0x5A, 0xD6, 0x68,
+        0x41, 0x86, 0x58, 0xE5, 0x83, 0x88, 0x1B, 0xBC, 0x59, 0x6D, 0x31, 0x88, 0x10, 0x90, 0x95, 0x15,
+        0xE6, 0x5D, 0x3C, 0x7F, 0x6F, 0xF9, 0xD8, 0x29, 0x02, 0xF8, 0x38, 0x03, 0x98, 0x54, 0x0C, 0xAC,
+        0x8D, 0xBF, 0xE4, 0xF0, 0x02, 0xBF, 0xF6, 0x42, 0xF7, 0x14, 0xFF, 0x2B, 0xFD, 0x36, 0xEC, 0x4A,
+        0x78, 0x66, 0x3A, 0x1A, 0x20, 0xD6, 0x0F, 0xE0, 0xA4, 0x0E, 0x60, 0xC8, 0x0C, 0x20, 0x5C, 0x01,
+        0x07, 0xFF, 0x0F, 0xAE, 0xB1, 0x13, 0x34, 0x12, 0x34, 0x12, 0x00, 0x01, 0xEE, 0x6B, 0xD1, 0xAD,
+        0x06, 0xB6, 0xED, 0xAC, 0x00, 0x4C, 0xB1, 0xC6, 0x59, 0x18, 0x4A, 0x1B, 0x77, 0xAC, 0x01, 0xEE,
+        0x06, 0xCA, 0xF5, 0xAD, 0xBB, 0x68, 0x37, 0x79, 0x60, 0xF7, 0x69, 0xE1, 0xB2, 0x2E, 0x12, 0xC9,
+        0x64, 0xB8, 0x16, 0x00, 0xF7, 0x6B, 0xC1, 0x5C, 0x63, 0x19, 0x2C, 0x83, 0x01, 0xDE, 0x0F, 0x73,
+        0xDC, 0xDB, 0x86, 0x46, 0x0C, 0x71, 0x64, 0x2E, 0x03, 0x40, 0xD1, 0xEE, 0xF4, 0x2E, 0x31, 0x8C,
+        0x96, 0x46, 0x5C, 0x05, 0x80, 0xF7, 0x35, 0xEE, 0x19, 0x19, 0x71, 0x92, 0xC7, 0x18, 0x07, 0x7A,
+        0xC0, 0x7B, 0x8D, 0x0F, 0x15, 0xC6, 0x31, 0x92, 0xC8, 0x86, 0xED, 0x8E, 0xF0, 0x7B, 0x81, 0xCB,
+        0x1C, 0x65, 0x92, 0xE4, 0xB1, 0x1C, 0x5C, 0x65, 0xC8, 0xDC, 0x0C, 0xA0, 0x1A, 0xF3, 0xB6, 0xAF,
+        0x58, 0x2D, 0x7A, 0x6E, 0xF5, 0x78, 0x41, 0x81, 0xEE, 0x6B, 0xDD, 0xAF, 0x0B, 0x19, 0x71, 0x92,
+        0xC9, 0x71, 0x81, 0xDE, 0xB0, 0xBD, 0x1E, 0xE0, 0x63, 0x97, 0x17, 0x18, 0xC6, 0x38, 0x12, 0xF5,
+        0xBB, 0xCB, 0x1D, 0xE0, 0x99, 0x43, 0x29, 0x1C, 0xB2, 0x30, 0x6E, 0x31, 0x8E, 0x2C, 0x97, 0x18,
+        0x37, 0x8D, 0xC0, 0x03, 0x2D, 0xF2, 0xC1, 0x70, 0xA4, 0x71, 0x8C, 0x63, 0x02, 0xF4, 0xBD, 0x6E,
+        0xF5, 0x80, 0x4B, 0x91, 0x88, 0x65, 0x8E, 0x58, 0x32, 0xC8, 0x59, 0x19, 0x2C, 0x71, 0x41, 0x0C,
+        0x42, 0x00, 0x44, 0xE3, 0xAD, 0x66, 0xC9, 0xCF, 0xF4, 0x7F, 0x5D, 0x84, 0x60, 0x4F, 0x85, 0xC0,
+        0x62, 0x88, 0xA1, 0x2F, 0xD8, 0x3B, 0xFF, 0xBE, 0x50, 0x02, 0xCF, 0xF7, 0x4A, 0x72, 0x76, 0xFA,
+        0x56, 0xD1, 0x9E, 0x89, 0xB0, 0xD8, 0x08, 0x74, 0x1C, 0x80, 0x6F, 0x00, 0x48, 0x19, 0x81, 0x0E,
+        0x09, 0xC0, 0x51, 0x81, 0xB0, 0x02, 0x69, 0xFC, 0x5F, 0x9C, 0x70, 0xA1, 0x2A, 0x39, 0x02, 0x41,
+        0x90, 0x22, 0x08, 0x6B, 0x6A, 0xF2, 0xCE, 0xFD, 0x00, 0xD1, 0xEA, 0xF2, 0xD6, 0xB0, 0xCB, 0x8C,
+        0xB8, 0x0E, 0x20, 0x60, 0xD2, 0x4B, 0x23, 0x18, 0xC7, 0x11, 0x97, 0x00, 0x0B, 0x99, 0x62, 0x60,
+        0xD9, 0x16, 0x46, 0x38, 0xCB, 0x94, 0x3C, 0xB1, 0x6F, 0x71, 0xAD, 0x86, 0xC8, 0x91, 0x8E, 0x59,
+        0x0B, 0x80, 0x3B, 0xCD, 0x0D, 0x6D, 0x0B, 0x23, 0x13, 0x17, 0x2E, 0x5C, 0x02, 0x60, 0xD6, 0x8D,
+        0xA0, 0x6F, 0xBF, 0xD4, 0xC5, 0x9A, 0x06, 0x98, 0x69, 0xAD, 0x68, 0x36, 0x9A, 0x36, 0xE7, 0xBB,
+        0xC1, 0xB8, 0x17, 0x22, 0xCC, 0xD9, 0x18, 0x33, 0x78, 0x91, 0x08, 0xE5, 0x30, 0x0B, 0x2C, 0x77,
+        0xB5, 0x6D, 0x60, 0x99, 0x66, 0x8C, 0x41, 0xCB, 0x97, 0x18, 0x5C, 0x60, 0x44, 0x2D, 0xAD, 0x62,
+        0xDA, 0x3C, 0x34, 0x20, 0xE1, 0x71, 0x97, 0x04, 0x33, 0x57, 0xAD, 0x6B, 0x2C, 0x03, 0x47, 0xB8,
+        0xF4, 0x5E, 0x11, 0x82, 0xE4, 0x5E, 0x6E, 0x24, 0x05, 0x9D, 0xFA, 0x3D, 0xC3, 0xDC, 0x18, 0xBD,
+        0x1A, 0xCB, 0x68, 0x59, 0x2F, 0x37, 0x18, 0x30, 0x00, 0x40, 0xCA, 0x65, 0x8E, 0x5C, 0x62, 0x2E,
+        0x0C, 0x71, 0x1C, 0x5C, 0x10, 0xCB, 0x00, 0x3D, 0xD8, 0x5C, 0x58, 0x38, 0xC6, 0x31, 0x81, 0xBB,
+        0x2F, 0x2D, 0xDE, 0xB0, 0x00, 0x68, 0xF7, 0x6B, 0xDD, 0xE1, 0x5C, 0x65, 0x92, 0x58, 0xE5, 0x91,
+        0x43, 0x08, 0x20, 0xC4, 0x00, 0x16, 0x97, 0x24, 0xD3, 0x2A, 0x6D, 0xFA, 0x1F, 0xA7, 0x80, 0xFA,
+        0x09, 0x08, 0x56, 0x02, 0xFE, 0x1F, 0xC1, 0xF9, 0xC9, 0x91, 0xFD, 0xF1, 0xC0, 0x02, 0x5F, 0xFD,
+        0xCF, 0xFE, 0x70, 0x42, 0x1A, 0x41, 0x49, 0x98, 0x21, 0xA2, 0x08, 0x39, 0xC1, 0x96, 0xF4, 0x55,
+        0xE0, 0x67, 0x17, 0xF5, 0xF2, 0x16, 0x32, 0x4A, 0x0E, 0xF0, 0x16, 0xF8, 0xDC, 0x38, 0x37, 0x45,
+        0x2A, 0x63, 0x3A, 0xDD, 0x73, 0xAC, 0xAF, 0x3A, 0x19, 0x26, 0x58, 0xBB, 0x19, 0x8E, 0x57, 0x91,
+        0x65, 0x9E, 0xE4, 0x5C, 0xCA, 0x39, 0xAC, 0x53, 0xAC, 0x5F, 0x73, 0xDD, 0x12, 0xFA, 0x57, 0x48,
+        0xF3, 0x8B, 0x0E, 0x52, 0xDB, 0x86, 0x1C, 0x34, 0xA6, 0x3C, 0x77, 0xDF, 0x9F, 0x6E, 0x1A, 0x61,
+        0x4B, 0x16, 0x01, 0x05, 0x47, 0x89, 0x1C, 0x9C, 0xAB, 0x6C, 0x72, 0xAA, 0x44, 0x29, 0x32, 0x78,
+        0x76, 0x75, 0x2E, 0x7C, 0x7E, 0x7C, 0x4E, 0x33, 0x65, 0xA3, 0x69, 0xCF, 0x8E, 0xF1, 0x9D, 0x4C,
+        0x77, 0x89, 0x2A, 0x9D, 0x73, 0x04, 0xC3, 0x8E, 0xF8, 0x92, 0x81, 0x0C, 0xE8, 0xB6, 0x16, 0x3D,
+        0xEA, 0x61, 0xD2, 0x39, 0xAE, 0x9A, 0xE5, 0x14, 0xC6, 0xCB, 0x01, 0x50, 0x12, 0x22, 0xA6, 0x09,
+        0x8B, 0xD6, 0xD0, 0xC7, 0x35, 0x82, 0xE6, 0x15, 0xFA, 0xEE, 0x1C, 0xF1, 0x1D, 0xD1, 0x28, 0x8C,
+        0x11, 0x8E, 0xF0, 0x55, 0xC0, 0x0A, 0x70, 0x56, 0x7D, 0x79, 0xE3, 0x65, 0x2C, 0x5D, 0x5C, 0x47,
+        0x65, 0xEA, 0xE1, 0x94, 0x56, 0x2C, 0xDF, 0xEB, 0xF3, 0x84, 0x58, 0xB2, 0x8A, 0x87, 0x8F, 0x3E,
+        0x1B, 0xC4, 0xE0, 0xAC, 0x95, 0xC6, 0xFD, 0x79, 0x58, 0xBA, 0x20, 0x32, 0xC1, 0x57, 0xE2, 0xC2,
+        0x68, 0xA5, 0x3E, 0x19, 0x6E, 0xA1, 0xF8, 0xF3, 0x82, 0xFA, 0xB9, 0xEA, 0xC1, 0x2E, 0x33, 0x86,
+        0x93, 0xA2, 0x8A, 0x14, 0xAC, 0xDA, 0xB9, 0x1C, 0xB1, 0xDB, 0x36, 0xA0, 0xAA, 0x1B, 0x44, 0xBE,
+        0x2C, 0x88, 0x85, 0x9D, 0x00, 0x55, 0x6F, 0xC1, 0x38, 0x69, 0x3E, 0xB3, 0x53, 0x57, 0xE1, 0xD6,
+        0x4E, 0x4F, 0x85, 0xD9, 0x06, 0x05, 0x18, 0x49, 0xDA, 0xFC, 0x8B, 0xBA, 0x8A, 0xCA, 0xC4, 0x5C,
+        0x71, 0xB1, 0xA7, 0xD1, 0xE3, 0x95, 0x6C, 0x30, 0x8A, 0x0E, 0x51, 0x21, 0x0A, 0x4D, 0x15, 0x15,
+        0x58, 0xB7, 0x68, 0xC1, 0x83, 0x26, 0x4A, 0xB1, 0x45, 0x8A, 0xE3, 0x26, 0x6C, 0x41, 0xD0, 0x4A,
+        0x99, 0x54, 0x0A, 0xA0, 0x94, 0x21, 0x57, 0x19, 0xC9, 0xB4, 0x90, 0xF4, 0x11, 0xE0, 0x85, 0x00,
+        0xC8, 0x4B, 0xA7, 0xA1, 0x8C, 0x08, 0x51, 0xA1, 0x9F, 0x47, 0x45, 0x9E, 0xA7, 0x8C, 0xE9, 0xD1,
+        0xA9, 0xC2, 0x70, 0xCB, 0x8D, 0xF0, 0x45, 0xF0, 0x99, 0xD5, 0x91, 0xF5, 0xF2, 0x58, 0xBD, 0x0B,
+        0xC1, 0x59, 0xE2, 0x39, 0xC3, 0x7D, 0x13, 0xDF, 0xC6, 0x6F, 0xA6, 0x40, 0x02, 0x5F, 0xFF, 0x33,
+        0xFF, 0xD2, 0x10, 0x51, 0x01, 0x08, 0x61, 0xC2, 0x04, 0x41, 0xCA, 0x0C, 0x62, 0xCA, 0xC4, 0xD6,
+        0xF8, 0x02, 0x54, 0x5F, 0x1B, 0xC1, 0x38, 0x0C, 0xD3, 0x81, 0x69, 0xAC, 0x73, 0x82, 0xB8, 0x72,
+        0x8E, 0x6A, 0x6F, 0x19, 0xE4, 0x0C, 0x9B, 0x9A, 0xCD, 0x67, 0x33, 0xDC, 0x71, 0x7E, 0x37, 0xBE,
+        0xEA, 0x8A, 0xAB, 0xB2, 0xFB, 0x30, 0xDB, 0x93, 0x0E, 0x9C, 0x99, 0x35, 0x6C, 0xD3, 0x3F, 0xEF,
+        0xF7, 0xE7, 0x08, 0xA1, 0x99, 0x39, 0x08, 0xA8, 0x81, 0x07, 0x3A, 0xCB, 0x30, 0xF7, 0xC5, 0x82,
+        0xEC, 0xB8, 0x97, 0x74, 0x45, 0xA2, 0x5C, 0x6E, 0x89, 0x2B, 0x02, 0xF1, 0xB8, 0x30, 0xE5, 0xEB,
+        0x20, 0x66, 0xEF, 0x8D, 0x59, 0xDC, 0xDE, 0x3E, 0xE1, 0x29, 0xA7, 0x9C, 0x5E, 0xBB, 0xD0, 0xDD,
+        0x2C, 0xE0, 0x7A, 0x01, 0xA4, 0xCF, 0x63, 0x3B, 0xC4, 0x90, 0xCC, 0x14, 0x33, 0xC7, 0x7D, 0x5A,
+        0x20, 0x8D, 0x32, 0x7B, 0x8C, 0xB8, 0xEF, 0x3B, 0xC4, 0x69, 0xCD, 0x02, 0xE5, 0xCD, 0xE6, 0xF3,
+        0xA5, 0x56, 0x69, 0x1B, 0xE2, 0x48, 0x10, 0xDC, 0x13, 0x87, 0x06, 0x2D, 0x04, 0x9B, 0xE3, 0x28,
+        0x8A, 0x78, 0xCE, 0xB3, 0xA9, 0x46, 0xB3, 0xA9, 0x44, 0x6B, 0x3A, 0xCE, 0xAE, 0x0A, 0x3A, 0xDC,
+        0x41, 0x14, 0x7C, 0xB2, 0xE5, 0xCB, 0x99, 0x40, 0x95, 0x6F, 0x08, 0xCA, 0xC4, 0xE2, 0x6A, 0x69,
+        0x8E, 0x5C, 0x03, 0x9A, 0x64, 0xDF, 0x37, 0x90, 0x6E, 0x32, 0xFC, 0x69, 0x90, 0x8F, 0x9F, 0xA5,
+        0xE3, 0x7A, 0x05, 0x3D, 0x02, 0xA7, 0x05, 0x12, 0xD3, 0x22, 0x80, 0x03, 0x17, 0xA3, 0x3C, 0x02,
+        0xCF, 0x8C, 0xE2, 0xF5, 0x13, 0x45, 0xE9, 0x4D, 0x32, 0xC1, 0x4A, 0x15, 0xD5, 0x11, 0xAC, 0xC5,
+        0x41, 0x34, 0xF8, 0xBC, 0x01, 0x82, 0xA7, 0x87, 0x08, 0x91, 0xC0, 0x53, 0x88, 0xAD, 0xE2, 0x10,
+        0xC6, 0xCB, 0x88, 0x6A, 0x35, 0x9A, 0x80, 0x15, 0x24, 0x51, 0x01, 0x21, 0x06, 0xA3, 0xD9, 0xC1,
+        0xE0, 0xE4, 0xEA, 0xE6, 0xD5, 0xAB, 0x91, 0x32, 0x6A, 0xB3, 0x25, 0x58, 0x2A, 0xA2, 0x68, 0xA8,
+        0x82, 0x0A, 0x91, 0x11, 0x97, 0x04, 0xA5, 0x1A, 0x8C, 0x90, 0x90, 0x05, 0xA4, 0xE5, 0x8A, 0x9D,
+        0x23, 0x50, 0xF1, 0x7D, 0x59, 0x82, 0x58, 0x0E, 0x25, 0x40, 0x71, 0x7C, 0x6F, 0x0C, 0x95, 0x01,
+        0xBE, 0x26, 0xAC, 0xEA, 0x63, 0x38, 0x68, 0x5F, 0x35, 0x97, 0x94, 0x02, 0x5F, 0xFF, 0xCA, 0xFF,
+        0xFC, 0x80, 0x82, 0x10, 0x71, 0x01, 0x10, 0x72, 0x80, 0x00, 0x30, 0x86, 0x26, 0x8A, 0xA9, 0xC3,
+        0x7C, 0x09, 0xA6, 0x28, 0x45, 0xFC, 0xEB, 0x91, 0x0D, 0x8C, 0xE9, 0x9B, 0x45, 0xC0, 0xE2, 0x77,
+        0x3B, 0x9E, 0x35, 0xD6, 0xAA, 0xCA, 0x2C, 0xBF, 0x05, 0xD8, 0xF2, 0x67, 0xD3, 0xAF, 0x87, 0x77,
+        0x57, 0x2F, 0x6C, 0xFF, 0xC7, 0xCC, 0xC0, 0x22, 0x06, 0x67, 0x0A, 0x90, 0xB9, 0x13, 0x2C, 0x4B,
+        0xAC, 0xCE, 0x37, 0x0D, 0x96, 0x33, 0xDE, 0x74, 0x1D, 0xAE, 0x6D, 0x0E, 0x92, 0x69, 0xC9, 0xAD,
+        0xE2, 0x4B, 0x70, 0xEC, 0x7E, 0x7A, 0x8C, 0xAF, 0x72, 0xC6, 0xCA, 0x57, 0x89, 0x28, 0xB2, 0xD5,
+        0x6C, 0xC3, 0x82, 0xBA, 0xEF, 0xAC, 0xC3, 0xBE, 0x32, 0xA4, 0x43, 0x03, 0x49, 0xEF, 0xCD, 0xB9,
+        0xB9, 0x58, 0xA9, 0x45, 0x88, 0x6E, 0x09, 0xAC, 0xA0, 0xEA, 0xC6, 0x5C, 0x9A, 0xC1, 0xB8, 0x59,
+        0x60, 0xDF, 0x3A, 0x4D, 0xE6, 0xC8, 0xD3, 0x18, 0x4D, 0xC0, 0x67, 0x56, 0x21, 0xA9, 0x85, 0x65,
+        0x4E, 0xB7, 0x84, 0xCE, 0x32, 0xB1, 0xBD, 0x48, 0x18, 0xE7, 0x7C, 0x69, 0x32, 0x99, 0x4C, 0x26,
+        0x44, 0x2B, 0xC3, 0x44, 0x56, 0x78, 0xB2, 0x5A, 0xB5, 0x06, 0xF8, 0x98, 0x9C, 0x17, 0x46, 0x06,
+        0x9E, 0x7B, 0x30, 0xB9, 0x8C, 0xA6, 0x41, 0x5E, 0x6F, 0x13, 0xCE, 0xE3, 0x8E, 0x14, 0x72, 0x0C,
+        0xE3, 0x71, 0xF3, 0x70, 0x7E, 0x0E, 0xC9, 0x73, 0x29, 0xE5, 0x92, 0x33, 0x09, 0xD3, 0x8A, 0xCE,
+        0x88, 0x81, 0x0C, 0x51, 0x2D, 0x6F, 0x10, 0xF5, 0xCF, 0x89, 0xC3, 0x86, 0xB8, 0x91, 0x72, 0x64,
+        0x67, 0x3B, 0xE6, 0x39, 0x1C, 0x27, 0x85, 0x05, 0x05, 0xAC, 0xE2, 0x1C, 0x42, 0x2A, 0xBE, 0x25,
+        0x54, 0x18, 0x38, 0x02, 0x29, 0x92, 0x8A, 0x40, 0x62, 0x74, 0x61, 0x44, 0x3E, 0x0A, 0xEB, 0x53,
+        0x14, 0x21, 0x41, 0xC2, 0x3D, 0x5A, 0x88, 0x20, 0x80, 0x14, 0x00, 0x02, 0x44, 0xC2, 0xDC, 0xCC,
+        0xD6, 0xBD, 0x89, 0x61, 0x39, 0x38, 0x35, 0x68, 0xBB, 0x16, 0x0A, 0xA2, 0xA9, 0xD3, 0x3A, 0x22,
+        0x40, 0x51, 0xE2, 0x35, 0x03, 0x1A, 0x98, 0xC1, 0x46, 0x80, 0x91, 0xB3, 0xCF, 0xB2, 0x1A, 0x66,
+        0xF0, 0x1F, 0xB9, 0x9D, 0xE6, 0xB1, 0xCD, 0x70, 0x3D, 0x1F, 0x2C, 0xBE, 0x55, 0x02, 0x5F, 0xFF,
+        0xF5, 0xBF, 0xFF, 0xDA, 0x08, 0x10, 0x82, 0x00, 0x51, 0x84, 0x0C, 0x60, 0x40, 0x10, 0x21, 0x32,
+        0xF8, 0xC9, 0xE3, 0x1E, 0x4E, 0x6E, 0x11, 0xC0, 0x29, 0x32, 0x26, 0x36, 0xAF, 0x76, 0xA6, 0x96,
+        0x89, 0xEB, 0xB2, 0xFB, 0xF1, 0x69, 0xD1, 0xB3, 0x8F, 0x9B, 0xAB, 0xCB, 0x4F, 0xE1, 0xFE, 0xFF,
+        0xD3, 0x94, 0x69, 0x00, 0xCE, 0x22, 0x94, 0x25, 0x00, 0xCA, 0xD5, 0xAD, 0xC5, 0xAB, 0x32, 0x9E,
+        0x62, 0x45, 0x7B, 0x1D, 0xAD, 0x9D, 0x2D, 0x02, 0xDD, 0x3C, 0xD1, 0xCC, 0x5A, 0x6D, 0x66, 0x24,
+        0x66, 0xB3, 0xBC, 0xFA, 0x66, 0xD0, 0xEC, 0x45, 0x36, 0x6A, 0x16, 0x69, 0xDF, 0x3E, 0xF0, 0x54,
+        0xEE, 0x3B, 0x29, 0x73, 0x79, 0xE8, 0x39, 0xD0, 0x4B, 0x1B, 0x9B, 0x36, 0x22, 0x5C, 0xAA, 0xF9,
+        0xEB, 0x03, 0x66, 0x0F, 0x49, 0x73, 0xDF, 0x28, 0xB3, 0x66, 0x74, 0x63, 0x95, 0x7C, 0xFB, 0xC6,
+        0x6C, 0xB8, 0x92, 0x61, 0xE2, 0xE0, 0x93, 0x56, 0xAB, 0x34, 0x3B, 0xE6, 0xB9, 0x73, 0x60, 0x2E,
+        0x67, 0xD1, 0xCC, 0x37, 0x95, 0x84, 0x4D, 0xE4, 0xD2, 0xA9, 0xAC, 0xF1, 0x9C, 0x4A, 0x53, 0xAB,
+        0xC6, 0x68, 0x89, 0xAB, 0xD6, 0xF5, 0x35, 0x34, 0x66, 0x82, 0x14, 0x66, 0x6F, 0x0B, 0x7F, 0x2D,
+        0x90, 0x20, 0x69, 0xC3, 0x55, 0x75, 0x3A, 0x93, 0x89, 0x19, 0x25, 0xF3, 0xB8, 0x63, 0x2E, 0x3C,
+        0x49, 0x4F, 0x16, 0x94, 0x34, 0x70, 0xCD, 0x14, 0x30, 0xCE, 0xFC, 0xB8, 0x9E, 0x57, 0x80, 0x92,
+        0xD5, 0xA4, 0xA1, 0xC0, 0x46, 0x8D, 0x31, 0xC8, 0xE1, 0x03, 0xCA, 0x7C, 0xDE, 0x5C, 0x21, 0x06,
+        0x93, 0xC0, 0x4A, 0x78, 0xBC, 0x0A, 0x17, 0x02, 0x71, 0xE1, 0x23, 0xE0, 0x61, 0x53, 0x1C, 0x4E,
+        0x0A, 0xA3, 0x4F, 0x46, 0x20, 0x8E, 0x1E, 0x94, 0xEA, 0x27, 0x80, 0x22, 0x06, 0x08, 0xC2, 0x8A,
+        0x47, 0x09, 0x53, 0xD4, 0x1A, 0x25, 0x83, 0x87, 0xC1, 0xC1, 0xC4, 0x0A, 0x55, 0x4A, 0x09, 0x02,
+        0x00, 0x50, 0x91, 0xB9, 0x5E, 0x07, 0x4B, 0x99, 0xAD, 0x9D, 0x91, 0x6A, 0x92, 0x72, 0x66, 0xC1,
+        0x82, 0xAA, 0x20, 0x89, 0x8E, 0x43, 0x10, 0x16, 0x0C, 0x78, 0x4C, 0x58, 0x76, 0x5E, 0x6B, 0xB0,
+        0x59, 0xD5, 0x9D, 0xCA, 0x34, 0x9B, 0x83, 0x77, 0x82, 0xC4, 0x02, 0x6F, 0xFC, 0x67, 0xFE, 0x30,
+        0x00, 0x40, 0x81, 0xC2, 0x08, 0x06, 0x18, 0x18, 0x40, 0x80, 0x80, 0x06, 0x13, 0xC7, 0xC9, 0x27,
+        0x38, 0xCE, 0x18, 0x54, 0x41, 0xC6, 0x52, 0x95, 0xF0, 0xC3, 0x4D, 0xB8, 0x78, 0x79, 0xFA, 0xFE,
+        0x55, 0xD7, 0xEA, 0xF8, 0xBE, 0xEF, 0xD1, 0xF5, 0x6E, 0x92, 0x38, 0x24, 0x82, 0x18, 0xE1, 0x92,
+        0x4A, 0x5C, 0xDD, 0xC6, 0x46, 0x5A, 0xD8, 0xCC, 0x0F, 0xA7, 0xB3, 0xB4, 0xEB, 0x5E, 0x9B, 0x42,
+        0x96, 0x2C, 0x66, 0xAD, 0xA9, 0xB4, 0x6E, 0x0B, 0x31, 0x6B, 0x70, 0xC8, 0xB0, 0x58, 0xB4, 0x33,
+        0xEF, 0x3D, 0x9B, 0x9A, 0xA5, 0x4E, 0x83, 0x97, 0xDF, 0x3A, 0x0D, 0xA0, 0x69, 0x07, 0xB0, 0xF7,
+        0xCA, 0xD6, 0x33, 0xA6, 0x74, 0x58, 0xE7, 0x43, 0x79, 0xDE, 0x55, 0x88, 0xD6, 0x33, 0x4C, 0xD7,
+        0x0D, 0x79, 0xD1, 0xCA, 0x17, 0x2C, 0x52, 0x6E, 0x50, 0x42, 0xE2, 0x89, 0x15, 0xC3, 0xA3, 0xE5,
+        0x29, 0x8A, 0x4D, 0xF3, 0x66, 0xE1, 0x03, 0x56, 0x02, 0x57, 0x86, 0xAF, 0x57, 0x02, 0x17, 0x0D,
+        0xE6, 0xF3, 0xBE, 0x28, 0x42, 0x9C, 0x67, 0x46, 0x55, 0x32, 0x0F, 0x5C, 0xA0, 0x4A, 0x24, 0xD2,
+        0xCE, 0xAE, 0x88, 0x09, 0x59, 0x62, 0x6A, 0x68, 0x38, 0x01, 0xE3, 0x38, 0x30, 0x57, 0x82, 0x40,
+        0xC4, 0xA0, 0xE8, 0xD5, 0xD0, 0xA4, 0x94, 0xC3, 0x3B, 0xE1, 0x64, 0x81, 0x33, 0x6E, 0xF0, 0xF7,
+        0x7E, 0x83, 0x23, 0x97, 0x03, 0x2F, 0x9B, 0x38, 0x51, 0x9C, 0xA7, 0x18, 0xCC, 0x8C, 0x99, 0xA3,
+        0xE6, 0xF0, 0x3C, 0xB1, 0x9E, 0x53, 0xC6, 0x0B, 0x32, 0x67, 0x7E, 0x0F, 0x89, 0xC0, 0x07, 0x32,
+        0x07, 0x9D, 0xF9, 0x94, 0xF0, 0x98, 0x12, 0x54, 0xE8, 0xEA, 0x78, 0x27, 0x02, 0x10, 0x2C, 0x05,
+        0x0F, 0x83, 0x87, 0xA7, 0x84, 0x71, 0x44, 0x63, 0x13, 0xA1, 0x81, 0x14, 0x22, 0x86, 0x11, 0x42,
+        0xC0, 0x8C, 0x1D, 0x0D, 0x3D, 0x0E, 0x0C, 0x16, 0x86, 0x9E, 0x31, 0x51, 0x47, 0x51, 0x88, 0x5A,
+        0x60, 0x42, 0x05, 0x3E, 0xCB, 0x6C, 0xB3, 0xD8, 0x6B, 0x69, 0x89, 0x67, 0x8E, 0x19, 0x22, 0x3C,
+        0x7C, 0xB2, 0xCB, 0x06, 0x66, 0x48, 0x3A, 0x01, 0x82, 0x88, 0xCD, 0xD5, 0x7B, 0x3A, 0x68, 0xDB,
+        0x85, 0x31, 0x6F, 0x0D, 0x80, 0x02, 0x6F, 0xFF, 0x11, 0xFF, 0xE4, 0x80, 0x00, 0x08, 0x08, 0x08,
+        0x60, 0x41, 0x80, 0x86, 0x10, 0x00, 0x30, 0x82, 0x18, 0xA8, 0xC2, 0xA1, 0x84, 0xC8, 0xBC, 0xFC,
+        0xB1, 0x32, 0xEA, 0xD9, 0xC2, 0xC5, 0xD6, 0xE0, 0xF4, 0xFC, 0x7F, 0x77, 0xC6, 0xCD, 0x89, 0x16,
+        0x0C, 0xB3, 0x33, 0xB3, 0x73, 0x77, 0x33, 0x36, 0x6E, 0xC9, 0xD9, 0xB9, 0x39, 0x19, 0x96, 0x32,
+        0x76, 0x87, 0xAD, 0x7E, 0xAD, 0xBD, 0x37, 0x73, 0xEA, 0x27, 0x56, 0xF6, 0x5D, 0x34, 0xEC, 0xDA,
+        0x25, 0x3A, 0x8D, 0xB6, 0x74, 0x9D, 0x04, 0xEC, 0xAA, 0x9D, 0x8C, 0xEB, 0x34, 0x73, 0xB3, 0x61,
+        0xDF, 0x3D, 0x8B, 0xB8, 0xA2, 0x8E, 0xF1, 0xDC, 0xEC, 0x9D, 0x99, 0xDC, 0x1E, 0xE6, 0xF3, 0x73,
+        0x62, 0x8C, 0x7B, 0xC0, 0x95, 0xEF, 0xB4, 0xB7, 0x16, 0x1B, 0x9A, 0x49, 0x57, 0x0D, 0x83, 0x83,
+        0x58, 0xB8, 0xCE, 0xF9, 0x4A, 0x60, 0x35, 0xE7, 0x78, 0xB0, 0xDE, 0x22, 0xF8, 0x3A, 0xE5, 0xBE,
+        0x37, 0x19, 0xBE, 0x5B, 0x83, 0x70, 0x5C, 0x2E, 0x2E, 0x57, 0x80, 0xEC, 0x93, 0xBE, 0x6E, 0x24,
+        0x79, 0xB1, 0x12, 0x5E, 0x77, 0xC5, 0x78, 0x6C, 0xCB, 0x06, 0x5C, 0x2C, 0x85, 0xCB, 0x99, 0xDE,
+        0x24, 0x9C, 0x2B, 0x88, 0x6A, 0xAD, 0x20, 0xA4, 0x78, 0x32, 0x6F, 0x9B, 0x30, 0xA6, 0x18, 0x3D,
+        0xF1, 0x96, 0x46, 0x65, 0x83, 0xC0, 0x6C, 0x98, 0xA7, 0x2E, 0x30, 0x31, 0x18, 0x47, 0x96, 0x42,
+        0x6F, 0x91, 0x81, 0x24, 0x69, 0xD4, 0xD3, 0xC3, 0xC3, 0x38, 0x24, 0x70, 0xE9, 0x4D, 0x20, 0x92,
+        0x74, 0x91, 0x1D, 0x5E, 0x01, 0xA3, 0x87, 0x45, 0x60, 0xA1, 0x7C, 0x24, 0x98, 0xF8, 0x1E, 0x27,
+        0x88, 0xE6, 0x64, 0x27, 0x86, 0x19, 0xC7, 0xC3, 0x84, 0x2A, 0x0E, 0x21, 0x2C, 0x05, 0xC3, 0xAA,
+        0x05, 0x88, 0x84, 0xB8, 0x50, 0xB0, 0x78, 0x5A, 0x10, 0x55, 0xA1, 0xA5, 0x58, 0x58, 0x8C, 0x61,
+        0x62, 0xA9, 0x46, 0x20, 0x81, 0x88, 0x08, 0xC1, 0x86, 0x28, 0x43, 0x0A, 0xDC, 0xFC, 0xEF, 0xEE,
+        0x2F, 0xE8, 0x7C, 0x8F, 0x13, 0x9D, 0x99, 0x8D, 0x52, 0x63, 0x0A, 0x2C, 0x51, 0x00, 0x04, 0x20,
+        0xBD, 0x35, 0xED, 0xDE, 0x9D, 0xD3, 0xBB, 0x07, 0x5D, 0x8D, 0x00, 0x02, 0x6F, 0xFF, 0xD0, 0x7F,
+        0xFE, 0x88, 0x08, 0x80, 0x40, 0xC7, 0x03, 0x10, 0x10, 0x50, 0x80, 0x82, 0x03, 0x0A, 0x45, 0x19,
+        0x40, 0x40, 0x84, 0x91, 0xCB, 0x4E, 0xBE, 0x9F, 0x7F, 0xED, 0xFF, 0xAD, 0xB8, 0x1F, 0x1F, 0xF0,
+        0xFE, 0x86, 0xFC, 0xB8, 0x51, 0xA0, 0xC8, 0x80, 0x1A, 0x34, 0x28, 0x71, 0x25, 0xB7, 0x77, 0xBC,
+        0xBB, 0xC9, 0xDC, 0xE4, 0xEC, 0x95, 0xBE, 0x56, 0xDB, 0xC9, 0xB7, 0x23, 0x33, 0x22, 0xF5, 0xD3,
+        0xE9, 0x7D, 0x9D, 0x35, 0xEC, 0x2B, 0x66, 0x63, 0x65, 0x49, 0x72, 0xAD, 0x31, 0xD9, 0xA5, 0xEF,
+        0x2E, 0xB3, 0x66, 0xD8, 0x1F, 0x1C, 0xE7, 0x47, 0x39, 0xC1, 0xBA, 0x2A, 0x70, 0xFB, 0x06, 0xE7,
+        0x73, 0x61, 0x71, 0xD8, 0x58, 0x0A, 0x5C, 0xDC, 0x6E, 0x77, 0xE7, 0x5E, 0x54, 0x58, 0x5C, 0xA6,
+        0x56, 0x2C, 0x28, 0xC9, 0xDF, 0x9A, 0xC0, 0xB2, 0x6C, 0x20, 0xD8, 0xC4, 0x02, 0x6E, 0x58, 0xE0,
+        0x94, 0x26, 0xF1, 0x09, 0xB2, 0x20, 0xC6, 0x6F, 0x37, 0xCE, 0xF1, 0x65, 0xC5, 0x2C, 0x5C, 0x31,
+        0x59, 0xE2, 0xC0, 0xA9, 0x10, 0xC7, 0x2E, 0x53, 0x28, 0x4B, 0xC0, 0xDC, 0x14, 0x32, 0x99, 0x72,
+        0xE5, 0x39, 0xA1, 0x0C, 0x6F, 0x52, 0x21, 0xE2, 0xD2, 0x70, 0x50, 0xCD, 0xF3, 0xBC, 0xDE, 0x31,
+        0x22, 0xF1, 0x10, 0x9B, 0xC4, 0x30, 0xB1, 0xCB, 0xC0, 0x83, 0x5A, 0xF4, 0xBF, 0x50, 0xE0, 0x33,
+        0x9E, 0xF8, 0xB8, 0x32, 0x23, 0x32, 0x99, 0x70, 0x64, 0xCD, 0x9E, 0x7A, 0x3E, 0x5C, 0x97, 0x97,
+        0x08, 0x38, 0x3C, 0x19, 0x70, 0x79, 0x7C, 0xB8, 0x3C, 0x00, 0x3C, 0xDB, 0x1B, 0xD7, 0x9E, 0x78,
+        0x24, 0xC3, 0x0C, 0x0E, 0x39, 0xC7, 0x89, 0x2A, 0x89, 0xC4, 0x0A, 0x35, 0x07, 0x06, 0xA0, 0x95,
+        0x15, 0xC3, 0xA5, 0x18, 0x38, 0x54, 0x30, 0x47, 0x50, 0x38, 0x14, 0xB0, 0xAA, 0xB4, 0x2A, 0x0B,
+        0x0B, 0x51, 0x1C, 0x1E, 0xA3, 0x0B, 0x85, 0xAA, 0xE0, 0xCA, 0x50, 0x49, 0x52, 0x10, 0x4A, 0x4A,
+        0x0D, 0x6B, 0x03, 0x12, 0x08, 0x38, 0x31, 0x8C, 0x07, 0xA2, 0xF8, 0x8F, 0x21, 0xC1, 0x67, 0x2B,
+        0xA4, 0x1D, 0x2C, 0x34, 0x5F, 0x51, 0xA2, 0x6C, 0x66, 0x73, 0x99, 0xB7, 0x79, 0x27, 0x71, 0xCC,
+        0x1B, 0x40, 0x02, 0x7F, 0xF4, 0x0F, 0xF3, 0xE0, 0xA0, 0x00, 0x01, 0x00, 0x30, 0xC0, 0x60, 0xE0,
+        0xA0, 0xE0, 0x60, 0xE0, 0xE0, 0x86, 0x20, 0x08, 0x50, 0x71, 0x65, 0x54, 0xC4, 0xD3, 0xE7, 0x7A,
+        0x1F, 0x8D, 0xFD, 0x9F, 0xE3, 0x75, 0xA5, 0xCF, 0x19, 0xDE, 0xB1, 0xAC, 0x71, 0x3D, 0x4E, 0xAB,
+        0x78, 0xCC, 0xDD, 0xEA, 0x75, 0x57, 0x7B, 0x95, 0x4E, 0x2E, 0xEA, 0x4F, 0x67, 0x2E, 0xE5, 0xE4,
+        0xCC, 0xCB, 0x76, 0x2F, 0x5D, 0x6F, 0x69, 0xB7, 0x5A, 0x7A, 0x33, 0x4E, 0x95, 0x69, 0xD5, 0x1E,
+        0x8E, 0x3D, 0x25, 0xAD, 0x0A, 0x52, 0x8C, 0x5A, 0x0D, 0x8A, 0xB2, 0xE0, 0xFD, 0xF8, 0xDA, 0x3C,
+        0xEC, 0x0A, 0x30, 0x25, 0x7B, 0xEC, 0xAC, 0xEC, 0x86, 0x57, 0x9D, 0x91, 0x8D, 0xCB, 0x00, 0x45,
+        0x92, 0xB9, 0x3D, 0xF1, 0x40, 0x27, 0x86, 0xE0, 0x9C, 0x6E, 0xA1, 0x94, 0xE8, 0x7B, 0xE6, 0xE5,
+        0x91, 0x42, 0x24, 0x44, 0xCD, 0x80, 0x17, 0x0C, 0xEE, 0x5C, 0x07, 0x78, 0xEF, 0x5A, 0x6E, 0x78,
+        0x2C, 0xA6, 0x3B, 0xF9, 0xD8, 0xE5, 0xCB, 0x09, 0x33, 0x8B, 0xD5, 0x84, 0x61, 0xC3, 0x86, 0x31,
+        0x3C, 0xF7, 0xCE, 0xCC, 0x5C, 0xB9, 0x60, 0xBE, 0x7D, 0xE4, 0xA6, 0x30, 0xA6, 0x20, 0xC6, 0x5C,
+        0x0B, 0x85, 0xCB, 0xE5, 0x03, 0xBC, 0x17, 0xEE, 0x69, 0xA0, 0x92, 0x2E, 0x5E, 0x77, 0xCD, 0xC6,
+        0x65, 0x29, 0xE2, 0xD2, 0x71, 0x17, 0x00, 0x04, 0xAC, 0x7E, 0x36, 0x62, 0xC8, 0x03, 0x97, 0x06,
+        0x31, 0x7C, 0xD9, 0x8C, 0x1C, 0x10, 0xD9, 0x7E, 0xED, 0x9A, 0xCF, 0x04, 0x71, 0x28, 0x44, 0x2C,
+        0xF0, 0xE0, 0xA4, 0x83, 0x5E, 0xC7, 0xB6, 0xBC, 0xF3, 0xC1, 0x32, 0x66, 0x27, 0x92, 0xF9, 0x09,
+        0x3C, 0x13, 0x24, 0xC3, 0xC3, 0x8F, 0xC3, 0x27, 0x30, 0xA8, 0x46, 0x21, 0x52, 0xC2, 0xC4, 0x45,
+        0x55, 0x12, 0xD4, 0x56, 0x23, 0x4B, 0x88, 0xAC, 0x63, 0x51, 0xD1, 0x8E, 0x10, 0x83, 0x59, 0x2D,
+        0x08, 0x52, 0x58, 0x35, 0x91, 0x8B, 0x04, 0x24, 0x28, 0x70, 0xA1, 0xC4, 0x06, 0x12, 0x31, 0xAE,
+        0xFC, 0x77, 0xED, 0x3E, 0x3B, 0xA2, 0x4F, 0xFB, 0xBF, 0x47, 0xAB, 0x54, 0xCC, 0x42, 0x42, 0xF3,
+        0xB5, 0xA5, 0x6A, 0x4B, 0x99, 0xDC, 0x76, 0x06, 0x40, 0x02, 0x7F, 0xFC, 0x03, 0xFF, 0x02, 0x06,
+        0x04, 0x06, 0x10, 0x02, 0x16, 0x08, 0x12, 0x10, 0x18, 0x10, 0x10, 0x0E, 0x0A, 0x70, 0x91, 0x12,
+        0xF5, 0x78, 0xED, 0xCF, 0x86, 0xF9, 0x7F, 0x8A, 0xDC, 0xC8, 0xC5, 0xC4, 0x44, 0x44, 0x43, 0xCF,
+        0x1C, 0x6F, 0x3C, 0x6B, 0x7A, 0xDD, 0xF1, 0x5C, 0x5E, 0xEA, 0x5E, 0x5F, 0x37, 0xBC, 0xDE, 0x5E,
+        0xF2, 0xF9, 0x39, 0xB2, 0x6F, 0x99, 0x33, 0x96, 0xF2, 0xB2, 0xDD, 0x91, 0xD6, 0xEE, 0xE7, 0xF7,
+        0xCE, 0xEA, 0xD7, 0x41, 0x75, 0xB2, 0xDD, 0xCD, 0x0B, 0x66, 0x89, 0x73, 0xB2, 0x89, 0xB8, 0x76,
+        0x4D, 0x18, 0xEF, 0x1A, 0x1B, 0xC6, 0x80, 0x0A, 0xC2, 0x80, 0xCD, 0xE6, 0xE5, 0x07, 0x29, 0x64,
+        0x58, 0x4D, 0x32, 0xE0, 0xD1, 0xCB, 0x18, 0x2C, 0x8B, 0x04, 0x4C, 0xDC, 0xB2, 0x5C, 0xA1, 0x80,
+        0xD0, 0x8D, 0xE3, 0x2C, 0xCA, 0xC0, 0x58, 0xE5, 0x32, 0x99, 0x63, 0x37, 0x83, 0x3B, 0xF3, 0xB8,
+        0x8F, 0x37, 0x12, 0x08, 0x97, 0xCD, 0xCB, 0xCD, 0x84, 0x65, 0x80, 0xBC, 0xD3, 0x05, 0x91, 0x61,
+        0x11, 0x79, 0xB0, 0x65, 0xF9, 0xAC, 0xCA, 0xC1, 0xE7, 0xB8, 0xC1, 0xE6, 0xC8, 0x8C, 0x82, 0xB2,
+        0x14, 0xE6, 0xC1, 0xC6, 0x22, 0x3C, 0xDC, 0xBC, 0xEE, 0x10, 0x49, 0x4A, 0xA5, 0x04, 0xF1, 0x9C,
+        0x19, 0xA2, 0x8C, 0x0D, 0x32, 0x99, 0x63, 0x06, 0x65, 0x47, 0x19, 0xB9, 0x10, 0xC2, 0x86, 0x51,
+        0xC5, 0xCB, 0xCA, 0x41, 0x91, 0x60, 0xC1, 0x8E, 0x58, 0x65, 0xCA, 0x71, 0x11, 0x91, 0x70, 0xCA,
+        0x65, 0xE6, 0xF0, 0x2C, 0x3C, 0xB6, 0x0F, 0x61, 0xDE, 0x06, 0x4D, 0xE4, 0x78, 0xBE, 0x14, 0x78,
+        0x43, 0x1F, 0x2E, 0x1C, 0x73, 0x00, 0xA9, 0xD4, 0x41, 0x85, 0x48, 0x52, 0x84, 0x8A, 0xB1, 0x7E,
+        0x1D, 0x54, 0x2A, 0x58, 0x88, 0xD1, 0x2D, 0x44, 0x6A, 0x95, 0x75, 0x11, 0x8D, 0x2E, 0xA3, 0x47,
+        0x44, 0x94, 0x25, 0x48, 0x59, 0x32, 0x6C, 0x21, 0x93, 0x64, 0x88, 0x81, 0xD0, 0x3A, 0x26, 0x41,
+        0x14, 0x50, 0x45, 0x14, 0x54, 0x64, 0x7B, 0xA7, 0x8B, 0x79, 0x87, 0x0E, 0xBA, 0x47, 0x96, 0x0C,
+        0x04, 0x82, 0x82, 0x43, 0x43, 0xC3, 0xC5, 0xC3, 0xCF, 0x17, 0xD4, 0x6E, 0xA6, 0xA0, 0x02, 0x7F,
+        0xFE, 0xBD, 0xFF, 0xD7, 0x82, 0x81, 0x03, 0x83, 0x86, 0x05, 0x86, 0x06, 0x88, 0x06, 0x04, 0x02,
+        0x85, 0x4E, 0xDE, 0x03, 0x77, 0xE9, 0x7F, 0x49, 0xFA, 0x1E, 0x92, 0x6E, 0x2E, 0x32, 0x3A, 0x22,
+        0x32, 0x26, 0x32, 0x22, 0x2E, 0x77, 0xC7, 0x1D, 0x6F, 0x7B, 0xCF, 0x3A, 0xCE, 0xB3, 0xAD, 0x62,
+        0x5B, 0xCE, 0x7B, 0x1E, 0x5E, 0xEE, 0xEF, 0x27, 0x77, 0x24, 0xEE, 0xC6, 0xE5, 0xB6, 0xED, 0x97,
+        0x94, 0x3B, 0x5A, 0xF4, 0x5D, 0xB9, 0xD4, 0xD1, 0x9B, 0xCF, 0xAF, 0x2D, 0x45, 0x1B, 0x06, 0x92,
+        0xA2, 0x39, 0xDC, 0xAE, 0x51, 0x8A, 0xE6, 0xF3, 0x73, 0x71, 0x72, 0x83, 0x37, 0x19, 0x4C, 0x3B,
+        0xC4, 0x73, 0x47, 0x17, 0xCD, 0x19, 0x7C, 0xD0, 0x88, 0x02, 0xF7, 0x7B, 0xBD, 0xCC, 0x50, 0xF2,
+        0x91, 0x22, 0xE0, 0xB2, 0x22, 0x0E, 0x2F, 0x3B, 0xC5, 0x83, 0x88, 0x93, 0x79, 0x60, 0x38, 0xB1,
+        0x98, 0x3A, 0x65, 0xCD, 0xE2, 0xC6, 0x4B, 0x01, 0x9B, 0xC5, 0x82, 0x72, 0xB1, 0xCD, 0x1E, 0x2C,
+        0x25, 0xCD, 0xC1, 0xE6, 0xC4, 0x64, 0xDE, 0x23, 0x88, 0x9F, 0x3D, 0x20, 0x92, 0xC2, 0x6F, 0x16,
+        0x3C, 0xD8, 0x0D, 0xE5, 0xC4, 0x64, 0xDE, 0x58, 0xCC, 0x1D, 0x20, 0xC9, 0xBC, 0x47, 0x16, 0x0B,
+        0x26, 0xF2, 0xE5, 0x39, 0x58, 0xC8, 0x36, 0x03, 0x9B, 0xC4, 0x96, 0x0C, 0x19, 0xBE, 0x6C, 0x96,
+        0x04, 0x59, 0x00, 0xED, 0xA6, 0x9E, 0xFB, 0x62, 0x0E, 0x5C, 0xB9, 0x60, 0x04, 0x43, 0x85, 0x70,
+        0x50, 0xAB, 0x49, 0xD3, 0x41, 0x48, 0xF8, 0x53, 0x19, 0x78, 0x99, 0x64, 0xA5, 0x4E, 0xA6, 0x9A,
+        0x48, 0xC3, 0x50, 0xF0, 0x1D, 0x99, 0xBD, 0x3D, 0x7B, 0x36, 0x20, 0xA2, 0x25, 0x71, 0x34, 0x68,
+        0x2C, 0x38, 0x2A, 0x48, 0x61, 0x42, 0x8A, 0x3A, 0x85, 0x18, 0x28, 0x88, 0x8A, 0xE0, 0x63, 0x11,
+        0x58, 0xE1, 0x6B, 0x07, 0x08, 0x51, 0x32, 0x0C, 0x25, 0x2A, 0x4A, 0xD6, 0xA5, 0xA8, 0x8E, 0x91,
+        0x90, 0x41, 0x04, 0xD1, 0x45, 0x05, 0x11, 0x55, 0x25, 0x51, 0x38, 0xF0, 0xD0, 0xC1, 0xC6, 0x95,
+        0xF4, 0x4F, 0xA5, 0x74, 0xCB, 0xC4, 0x08, 0xF0, 0x58, 0x24, 0x3C, 0x5C, 0x7C, 0xF8, 0xEF, 0xAE,
+        0xF5, 0xA9, 0xC4, 0x02, 0x8F, 0xE1, 0xAF, 0xE2, 0x40, 0x50, 0x50, 0x2C, 0x1A, 0x11, 0x09, 0x05,
+        0x02, 0x00, 0x50, 0x5C, 0xB6, 0xEB, 0xBE, 0x79, 0xED, 0xBF, 0xFF, 0x53, 0xFC, 0x0C, 0x7A, 0x34,
+        0x68, 0x51, 0xA1, 0x3A, 0x74, 0xD9, 0xF2, 0xA6, 0x4B, 0x97, 0x4A, 0x61, 0x95, 0xF4, 0xBD, 0xB1,
+        0xBD, 0xAD, 0x85, 0x6B, 0x6A, 0xCB, 0x3D, 0xBE, 0x6F, 0x39, 0xBC, 0xBE, 0x46, 0x6E, 0x64, 0x76,
+        0xF6, 0xEB, 0xBB, 0xAD, 0x3D, 0x9B, 0x44, 0xD3, 0xB2, 0xCE, 0xCE, 0xC2, 0xA8, 0x36, 0x77, 0x9D,
+        0xE5, 0x51, 0x26, 0x90, 0x6B, 0xCD, 0x33, 0x5C, 0x49, 0xB9, 0x41, 0x33, 0x79, 0xEF, 0x18, 0x85,
+        0xE2, 0xA3, 0xCA, 0x5E, 0x0D, 0xC1, 0x79, 0x62, 0x2E, 0x24, 0xB2, 0x2E, 0x29, 0x20, 0xB7, 0x25,
+        0x32, 0x86, 0x2E, 0x50, 0x65, 0xE5, 0x32, 0xC7, 0x2C, 0x42, 0x0B, 0x8D, 0xC7, 0x2C, 0x48, 0xE5,
+        0x83, 0x2C, 0xB8, 0x27, 0x35, 0xF3, 0x48, 0x0B, 0x96, 0x4E, 0xF9, 0x61, 0x3B, 0xE2, 0xE0, 0xAE,
+        0x52, 0x0E, 0x32, 0x91, 0x82, 0x9F, 0x3D, 0x23, 0x1C, 0xB2, 0x2C, 0x17, 0x14, 0xCB, 0x09, 0x79,
+        0xDF, 0x37, 0x05, 0x1C, 0xA4, 0x96, 0x32, 0x2E, 0x0D, 0x8C, 0x4F, 0x9E, 0x91, 0x89, 0x88, 0xCB,
+        0x04, 0xCB, 0x25, 0x93, 0xBE, 0x22, 0x39, 0xDF, 0x17, 0x2C, 0x13, 0x9D, 0x83, 0xCD, 0x21, 0x71,
+        0xC5, 0xCB, 0x10, 0x63, 0x96, 0x5C, 0x96, 0x21, 0x1C, 0x1B, 0x1C, 0xA6, 0x6E, 0x26, 0x59, 0x28,
+        0x86, 0x53, 0x1B, 0x91, 0x49, 0x28, 0xC8, 0xB8, 0x92, 0xC8, 0xE6, 0xC8, 0x25, 0xC8, 0x6E, 0x19,
+        0xB2, 0x4D, 0xC0, 0x48, 0xCD, 0xF9, 0xBC, 0xA1, 0x97, 0x88, 0x32, 0xCE, 0x53, 0x9B, 0x31, 0x38,
+        0x90, 0x49, 0x33, 0x7C, 0xDF, 0x1C, 0x24, 0xC1, 0x1F, 0x1F, 0x1C, 0x7C, 0x38, 0x67, 0x1F, 0x86,
+        0x12, 0xAA, 0xA5, 0x51, 0x88, 0xAA, 0xAC, 0x68, 0x74, 0x69, 0x28, 0x4A, 0x50, 0xB2, 0x61, 0x2A,
+        0x5A, 0x94, 0xCA, 0xC8, 0xE8, 0x24, 0x74, 0x15, 0x41, 0x34, 0x55, 0x51, 0x45, 0x53, 0x60, 0xB1,
+        0xC7, 0x87, 0x88, 0x89, 0x08, 0x89, 0x09, 0x14, 0x3A, 0x17, 0xF2, 0xAF, 0xDF, 0x3B, 0xD5, 0xB1,
+        0x70, 0x60, 0x25, 0x2F, 0xCF, 0x8F, 0x0D, 0x32, 0xC6, 0x90, 0x02, 0x8F, 0xF4, 0x37, 0xFA, 0x48,
+        0x1C, 0x1C, 0x16, 0x0C, 0x06, 0x03, 0x00, 0xA0, 0x95, 0x87, 0x83, 0xFC, 0x93, 0xEC, 0x3C, 0xBA,
+        0x6F, 0x59, 0xB6, 0xE6, 0xCD, 0x93, 0x26, 0x5C, 0x58, 0x70, 0xDD, 0x7D, 0xB8, 0x2A, 0xB2, 0x96,
+        0xC3, 0x3C, 0x70, 0xCB, 0x0B, 0x63, 0x85, 0x2F, 0x4B, 0xD2, 0xB2, 0xE6, 0x7B, 0x3B, 0xBC, 0xCC,
+        0xDD, 0xBC, 0x8B, 0x65, 0x95, 0xB4, 0xDB, 0x92, 0x58, 0x95, 0x94, 0x26, 0xCD, 0x06, 0xCB, 0x3B,
+        0x23, 0x46, 0x16, 0x5C, 0xD2, 0x16, 0x17, 0x11, 0x2C, 0x94, 0xCA, 0x33, 0x36, 0x20, 0x6B, 0x57,
+        0xEF, 0xB3, 0x42, 0xC2, 0xE6, 0xE0, 0x5C, 0xB8, 0x17, 0x96, 0x0D, 0xC2, 0xE0, 0x24, 0x62, 0xF2,
+        0x85, 0xFB, 0xB4, 0xD3, 0x26, 0xB0, 0x4D, 0x6B, 0x1D, 0xE7, 0x78, 0x12, 0x6E, 0x17, 0x96, 0x26,
+        0x37, 0x00, 0x2C, 0x2C, 0x77, 0xFB, 0xE7, 0x87, 0x7C, 0xD8, 0x05, 0xE2, 0xE2, 0x98, 0x3B, 0xE6,
+        0xC9, 0x72, 0x92, 0x59, 0x14, 0x61, 0x2C, 0x79, 0xDE, 0x20, 0xC0, 0x06, 0x96, 0x68, 0xBF, 0xDF,
+        0xD8, 0x0D, 0x2C, 0xD0, 0xB0, 0x33, 0x7C, 0xD8, 0xE2, 0x32, 0x2E, 0x22, 0x99, 0x71, 0x79, 0xDE,
+        0x52, 0x4B, 0x06, 0x6E, 0x00, 0xF3, 0xBC, 0xA7, 0x3B, 0x80, 0x2C, 0x2C, 0x3B, 0xDB, 0x83, 0x1C,
+        0xDC, 0x2F, 0x10, 0x2E, 0x14, 0x3C, 0x5A, 0xD3, 0x5A, 0x60, 0xA4, 0x48, 0xE6, 0xCC, 0xD9, 0x18,
+        0x29, 0x02, 0xE1, 0x71, 0xCD, 0xC0, 0x1B, 0x97, 0x02, 0xF2, 0xC6, 0x01, 0x05, 0x1E, 0x6C, 0x8C,
+        0x48, 0xF2, 0xA3, 0x0C, 0xA6, 0x2E, 0x12, 0xE0, 0xE0, 0x89, 0xCB, 0x8E, 0x0E, 0x45, 0xF1, 0x1C,
+        0x72, 0x07, 0x1E, 0x0F, 0xC7, 0x86, 0x12, 0x55, 0x11, 0x07, 0x83, 0xA8, 0xC0, 0xD4, 0x60, 0xE0,
+        0xCD, 0x28, 0x50, 0xB0, 0x6B, 0x52, 0x58, 0x4B, 0x09, 0x24, 0x52, 0x3A, 0x29, 0xA2, 0x92, 0x88,
+        0xAE, 0xAA, 0x6C, 0x56, 0x60, 0xB9, 0xC9, 0x09, 0x09, 0x8B, 0x0A, 0x8A, 0x8B, 0x8B, 0x8F, 0x0B,
+        0x9C, 0x3D, 0x7B, 0xFE, 0x89, 0xFE, 0x95, 0xE2, 0x14, 0x44, 0xCD, 0x1E, 0xFD, 0xFB, 0xF5, 0xD6,
+        0xD0, 0x02, 0x9F, 0x7C, 0x3D, 0xFE, 0x08, 0x02, 0xE1, 0x08, 0x46, 0x13, 0x01, 0x81, 0xBE, 0x03,
+        0xE8, 0xBF, 0x06, 0x69, 0x49, 0x26, 0x1F, 0x89, 0x2B, 0x6E, 0xFD, 0x99, 0xF5, 0xE6, 0xCF, 0x8F,
+        0x1D, 0xF8, 0xEF, 0xC1, 0x6D, 0x77, 0x4F, 0x5D, 0x77, 0xCF, 0x3C, 0x6F, 0x7B, 0xCE, 0x78, 0xAD,
+        0xDE, 0x65, 0x37, 0xB7, 0x79, 0x67, 0x66, 0x64, 0xCB, 0x23, 0xA6, 0x95, 0xAA, 0x35, 0x10, 0x69,
+        0x36, 0x16, 0x59, 0x79, 0x77, 0x20, 0xEE, 0x16, 0x17, 0x26, 0x90, 0x60, 0x10, 0x00, 0xB0, 0x16,
+        0x58, 0xEF, 0x4F, 0x76, 0x70, 0xF3, 0x7C, 0xEC, 0x80, 0xC2, 0xE4, 0xDC, 0x17, 0x2C, 0x60, 0x5E,
+        0x37, 0xCE, 0xE0, 0x0B, 0xDD, 0xAC, 0x6A, 0xCB, 0xC2, 0xB2, 0x59, 0x2C, 0x03, 0x3B, 0x80, 0xE7,
+        0x7C, 0xAC, 0x88, 0x06, 0x77, 0x01, 0xCE, 0xF9, 0x40, 0x22, 0x67, 0x70, 0xC1, 0xDC, 0x2E, 0x4E,
+        0xF9, 0x42, 0x20, 0x0C, 0x19, 0x71, 0x32, 0x92, 0xE4, 0xE8, 0xF9, 0x48, 0x86, 0x77, 0xCB, 0x1C,
+        0xA0, 0xC4, 0xCB, 0x2E, 0x39, 0x60, 0x38, 0x36, 0x5C, 0x72, 0x91, 0x32, 0xC7, 0x07, 0xBE, 0x50,
+        0x89, 0x9D, 0xF1, 0xB8, 0x81, 0xEE, 0x6E, 0xF5, 0x90, 0xD0, 0x4C, 0xEF, 0x8D, 0xC2, 0xF2, 0x97,
+        0xCA, 0x0C, 0x40, 0x33, 0xBE, 0x52, 0xF9, 0x40, 0x42, 0x2C, 0xCE, 0xF9, 0x4B, 0xE5, 0x01, 0x1C,
+        0x5C, 0x59, 0x2C, 0x19, 0x05, 0x06, 0x39, 0x60, 0x5F, 0x3B, 0x90, 0x77, 0x01, 0x8E, 0x59, 0x78,
+        0xDC, 0x05, 0x80, 0xBE, 0x77, 0x9B, 0x83, 0x94, 0x0D, 0xDE, 0x2C, 0xB1, 0x60, 0x00, 0x19, 0x64,
+        0x1E, 0x37, 0x07, 0x0B, 0xC6, 0xF3, 0x37, 0x05, 0xC7, 0x07, 0x89, 0x84, 0x26, 0x42, 0x09, 0x42,
+        0x81, 0x42, 0x94, 0x52, 0xAA, 0x32, 0xA1, 0x24, 0xA0, 0x94, 0x83, 0x52, 0x18, 0x36, 0x54, 0x46,
+        0x41, 0x04, 0x11, 0x49, 0x25, 0x13, 0x4D, 0x75, 0x16, 0x62, 0xC1, 0xA1, 0xC8, 0x0A, 0x0A, 0x0C,
+        0x0B, 0x8E, 0x0C, 0x0E, 0x90, 0x0F, 0x12, 0x90, 0x22, 0x9F, 0x95, 0x7F, 0xF8, 0xD7, 0xFE, 0x30,
+        0xDF, 0xE2, 0x2C, 0x0B, 0xC5, 0xC2, 0xC0, 0xAD, 0x3E, 0x02, 0x9F, 0xBD, 0x1F, 0x7F, 0x82, 0xE1,
+        0x40, 0x6E, 0x14, 0x00, 0xD7, 0x3F, 0x7C, 0xFB, 0x87, 0x85, 0x26, 0x88, 0xB2, 0x31, 0x8A, 0x22,
+        0xAA, 0xE4, 0xE4, 0xDB, 0xC1, 0xAB, 0x56, 0x7C, 0xD8, 0xB3, 0x5F, 0x86, 0xFB, 0x30, 0x53, 0x3D,
+        0xF5, 0xD6, 0xBB, 0xCE, 0xB8, 0xD5, 0xEB, 0x33, 0x9C, 0x54, 0x7D, 0x7D, 0xB7, 0xB6, 0xDB, 0x4D,
+        0x76, 0x09, 0xAA, 0x88, 0x6F, 0x3B, 0x06, 0x8E, 0x16, 0x4E, 0xE3, 0x8D, 0x84, 0xDE, 0x0A, 0xBC,
+        0xDE, 0x6C, 0x22, 0x5E, 0x20, 0x1D, 0xFA, 0x3B, 0xDA, 0x3B, 0xC0, 0xD2, 0xD7, 0xA5, 0x87, 0x7E,
+        0x16, 0x5C, 0x46, 0x01, 0x17, 0x9D, 0x1E, 0x21, 0x12, 0x5E, 0x6C, 0x21, 0x47, 0x18, 0xC6, 0x24,
+        0x5E, 0x2A, 0x3C, 0xDE, 0x2B, 0xC6, 0xF3, 0x67, 0x36, 0x21, 0x7E, 0xAC, 0xB2, 0xD6, 0x21, 0x83,
+        0x22, 0x6F, 0x88, 0xE5, 0x80, 0x2F, 0xDF, 0x6B, 0x0B, 0x34, 0x17, 0x2C, 0x66, 0x77, 0x8B, 0x00,
+        0x03, 0x7D, 0xFA, 0x0D, 0x0B, 0x04, 0x9B, 0xE5, 0x19, 0x95, 0x91, 0x60, 0xE5, 0x61, 0x9D, 0xE2,
+        0x0C, 0x00, 0x34, 0x1B, 0xEF, 0xD0, 0x58, 0x66, 0xF9, 0x58, 0xE5, 0x84, 0x46, 0x00, 0xB5, 0xFB,
+        0xEC, 0x5E, 0xEC, 0x19, 0xDE, 0x11, 0x60, 0xC0, 0x62, 0x30, 0x60, 0xC9, 0xB2, 0x3C, 0xD7, 0x85,
+        0x30, 0xA5, 0x25, 0x35, 0x29, 0x29, 0x48, 0x52, 0x31, 0x8C, 0xB8, 0x23, 0xC1, 0xDC, 0x48, 0x84,
+        0xDF, 0x36, 0x44, 0x02, 0xCD, 0xDE, 0xB7, 0xDE, 0x10, 0x66, 0xED, 0x66, 0x9D, 0xE3, 0x0B, 0x70,
+        0x26, 0xE0, 0x13, 0x70, 0x82, 0x8F, 0x37, 0x9B, 0x24, 0xDE, 0x23, 0x83, 0x2C, 0xBE, 0x2E, 0x17,
+        0x20, 0xF9, 0xA3, 0xC0, 0x84, 0x93, 0x83, 0xC9, 0xC3, 0x0D, 0x11, 0x12, 0x08, 0x92, 0x29, 0x34,
+        0xA8, 0x94, 0xB2, 0x21, 0xD1, 0x39, 0x94, 0x3A, 0x69, 0xA8, 0x93, 0x15, 0x58, 0x32, 0x60, 0x72,
+        0xE2, 0x62, 0xE3, 0x03, 0x63, 0x64, 0x23, 0xC4, 0xA4, 0xA5, 0x65, 0x26, 0x45, 0xAA, 0x97, 0xF9,
+        0x54, 0x7F, 0x62, 0x7D, 0xE9, 0x68, 0x03, 0x89, 0xE6, 0xD2, 0x78, 0xB4, 0x02, 0x9F, 0xD7, 0x0F,
+        0xD9, 0x61, 0x20, 0x8A, 0x2A, 0x07, 0x65, 0x3F, 0x96, 0xFE, 0xD8, 0xEB, 0x4A, 0x02, 0x38, 0x8F,
+        0x23, 0x38, 0xBE, 0x2C, 0xAE, 0x6E, 0x6E, 0x3D, 0x7B, 0x75, 0x65, 0xCD, 0x8B, 0x16, 0x1B, 0x6D,
+        0xBA, 0x9A, 0x67, 0xBE, 0x35, 0xC6, 0x37, 0x7B, 0xAC, 0xCE, 0x2E, 0x6A, 0xA3, 0xA6, 0xED, 0x9B,
+        0x4A, 0x59, 0x54, 0x62, 0x8C, 0x6C, 0x8B, 0x2C, 0x83, 0x48, 0xE5, 0x1C, 0x47, 0x16, 0x0C, 0xB1,
+        0xCB, 0x97, 0x29, 0x94, 0xCA, 0x31, 0x91, 0x64, 0x47, 0x2C, 0x94, 0x72, 0xE2, 0xC8, 0x92, 0xE5,
+        0xC6, 0x0A, 0x44, 0x8B, 0xCD, 0xC1, 0x22, 0x2F, 0x0D, 0xC1, 0xCD, 0x84, 0x4C, 0xA3, 0x18, 0x0E,
+        0x52, 0x27, 0x2B, 0x05, 0xC6, 0xF2, 0xE5, 0xCB, 0x1C, 0x37, 0x00, 0xDD, 0x83, 0x73, 0xF7, 0x5E,
+        0x1B, 0x97, 0x18, 0xA7, 0x2B, 0x97, 0x11, 0x1E, 0x3B, 0xC6, 0x5C, 0xB8, 0x24, 0x1B, 0x88, 0x4B,
+        0x08, 0xE6, 0xE5, 0xC1, 0x61, 0xBE, 0x6E, 0x17, 0x19, 0x70, 0xA3, 0xCA, 0x19, 0xBC, 0xD8, 0x41,
+        0x82, 0x23, 0xCD, 0xE5, 0x0C, 0xDC, 0x2E, 0x30, 0x9C, 0x07, 0x57, 0x40, 0xA7, 0x0E, 0x9A, 0x09,
+        0x7A, 0x37, 0x7A, 0x67, 0x78, 0x6E, 0x33, 0x79, 0x36, 0x12, 0xE5, 0x98, 0x3A, 0x48, 0xCB, 0x97,
+        0x2C, 0xCD, 0x30, 0x20, 0xBD, 0x1D, 0xF9, 0xDA, 0x1C, 0xB9, 0x73, 0x72, 0x58, 0xCC, 0xD2, 0x04,
+        0xF7, 0x62, 0xD7, 0xB9, 0xA0, 0xBC, 0xB0, 0xBC, 0x36, 0x44, 0x85, 0x1E, 0x6C, 0x89, 0x12, 0x32,
+        0xE5, 0xC1, 0x48, 0xB2, 0x5C, 0xB8, 0xB9, 0x60, 0x91, 0x64, 0x58, 0xE5, 0x32, 0x83, 0x97, 0x2E,
+        0x58, 0xE2, 0xC9, 0x60, 0x32, 0xC3, 0x2C, 0x4C, 0x5C, 0x64, 0x15, 0xC8, 0xC2, 0x46, 0x4C, 0x70,
+        0x28, 0x11, 0x46, 0x2A, 0x85, 0x55, 0x46, 0x35, 0x08, 0xC3, 0x40, 0x88, 0x15, 0x13, 0xA2, 0xA2,
+        0x49, 0x2E, 0xB2, 0xCC, 0x8C, 0x99, 0x32, 0xE5, 0x8D, 0x9E, 0x38, 0x88, 0x8E, 0x8E, 0x9A, 0xA0,
+        0xA8, 0xBA, 0xB2, 0xF0, 0x53, 0xAD, 0x5E, 0xD9, 0x72, 0xE1, 0x50, 0x1D, 0x4A, 0x72, 0x24, 0x47,
+        0x02, 0x9F, 0xF4, 0xBB, 0xFD, 0x74, 0x21, 0x8C, 0x83, 0x57, 0xB2, 0x7F, 0x87, 0x3D, 0x35, 0x61,
+        0x4A, 0xB2, 0xE4, 0x97, 0x23, 0x47, 0xB1, 0xDC, 0x61, 0x5E, 0x2E, 0x7E, 0x7E, 0x0D, 0xBA, 0xF4,
+        0x66, 0xC7, 0x8A, 0xFA, 0xEE, 0xB2, 0x8A, 0xA5, 0xCF, 0x9D, 0xE7, 0xBC, 0xCE, 0xCE, 0x66, 0x64,
+        0x39, 0x26, 0xAD, 0x4A, 0x61, 0xA1, 0x78, 0xB8, 0x23, 0x36, 0x03, 0x94, 0xCD, 0x84, 0x41, 0x60,
+        0xC8, 0x9B, 0xE2, 0x3C, 0xEF, 0x07, 0x78, 0x8C, 0x1E, 0x6C, 0x09, 0xBC, 0x08, 0xD1, 0x7E, 0xE2,
+        0xDA, 0x19, 0x79, 0x5C, 0x13, 0x28, 0x11, 0x03, 0xDC, 0xCB, 0x2C, 0xB0, 0x58, 0x39, 0x4C, 0xA6,
+        0x5C, 0xB9, 0x46, 0x03, 0x97, 0x2C, 0x09, 0x72, 0xC1, 0x97, 0x2E, 0x32, 0xE5, 0x84, 0x58, 0x30,
+        0x5C, 0x2F, 0x34, 0xE6, 0xE5, 0xE6, 0x8E, 0x32, 0xF3, 0x71, 0x82, 0xE3, 0x28, 0xF3, 0x70, 0x63,
+        0x10, 0x8C, 0x41, 0xCD, 0xE5, 0x0C, 0xDC, 0x60, 0xCB, 0xC1, 0xDE, 0x36, 0x65, 0x24, 0xDE, 0x59,
+        0x70, 0x2D, 0x62, 0x7A, 0xB5, 0xAC, 0x32, 0x90, 0x18, 0xCB, 0x8E, 0x6F, 0x05, 0x4C, 0xAE, 0x4D,
+        0xE6, 0xE3, 0x04, 0x65, 0xE5, 0x0C, 0xDE, 0x52, 0x31, 0x04, 0x8C, 0x61, 0x79, 0xB8, 0xCB, 0x20,
+        0x8C, 0xBC, 0xDC, 0x65, 0xE6, 0xE5, 0xE6, 0x89, 0xCD, 0xC2, 0xC8, 0x2C, 0x88, 0x8E, 0x5C, 0x65,
+        0xCB, 0x8B, 0x97, 0x10, 0x47, 0x2E, 0x58, 0x0E, 0x5C, 0xB9, 0x41, 0xEE, 0x7B, 0xB2, 0xCB, 0x2C,
+        0x0B, 0x27, 0xB8, 0xD0, 0xF0, 0xD2, 0x16, 0x66, 0xE3, 0x16, 0x00, 0xE6, 0xC0, 0x88, 0x4D, 0xE2,
+        0x08, 0xF3, 0x60, 0xC2, 0x6F, 0x37, 0xCD, 0x84, 0x1E, 0xF0, 0x8B, 0x06, 0x11, 0x1E, 0x0D, 0x32,
+        0xC0, 0x78, 0xCB, 0xE7, 0x7C, 0x05, 0xC3, 0x1E, 0x3E, 0x39, 0xCC, 0x39, 0xCE, 0x22, 0x84, 0xC3,
+        0x2A, 0x05, 0x32, 0x27, 0x4D, 0x15, 0x57, 0x51, 0x81, 0x93, 0x28, 0x5C, 0xC9, 0xC3, 0xC8, 0x29,
+        0x09, 0x0A, 0x6A, 0x2B, 0x8B, 0xCC, 0x76, 0x63, 0x75, 0x25, 0x63, 0x0D, 0xD3, 0x6F, 0xC3, 0xAE,
+        0xCA, 0x1A, 0xC6, 0x39, 0x0A, 0x02, 0xAF, 0x87, 0x4F, 0x8C, 0x42, 0x20, 0x01, 0x70, 0x7B, 0xD8,
+        0x8E, 0x57, 0x50, 0x38, 0xEB, 0x1D, 0xE3, 0x2C, 0x5A, 0x89, 0x11, 0x22, 0x1C, 0x43, 0x8A, 0xED,
+        0xEC, 0xE4, 0xDB, 0xB7, 0x3E, 0x7C, 0x78, 0x6C, 0xB6, 0xBA, 0xA7, 0x9E, 0x89, 0x4F, 0x73, 0x9B,
+        0x9C, 0x89, 0x2D, 0xB0, 0x58, 0x1C, 0xDF, 0x63, 0xB6, 0xED, 0x00, 0x1B, 0xB5, 0xEE, 0xD3, 0xD0,
+        0x58, 0x27, 0xAB, 0xD4, 0xF0, 0xB1, 0x71, 0x8B, 0x96, 0x46, 0x23, 0x17, 0x9D, 0xF2, 0x99, 0xB8,
+        0xCB, 0xCA, 0x2F, 0x15, 0xE5, 0x8E, 0x2C, 0x48, 0x2C, 0x89, 0x79, 0x64, 0xB9, 0xB3, 0xCE, 0x8E,
+        0x6F, 0x2E, 0x2E, 0x59, 0x11, 0xC4, 0x65, 0x30, 0x5C, 0x2E, 0x5C, 0x65, 0x1C, 0x2C, 0xCD, 0x99,
+        0xB2, 0x31, 0x94, 0x70, 0x62, 0xF2, 0xCB, 0x92, 0x84, 0x12, 0xF2, 0x90, 0x48, 0x17, 0x25, 0x18,
+        0x99, 0x48, 0xE6, 0xE4, 0xB1, 0x80, 0x77, 0x86, 0xFB, 0xC2, 0x61, 0x9B, 0xE7, 0x70, 0x9B, 0x89,
+        0x25, 0x90, 0x52, 0xF2, 0xE2, 0x90, 0x7C, 0xEC, 0x05, 0x24, 0xB9, 0xB8, 0x45, 0xC5, 0x06, 0x5E,
+        0x25, 0xF3, 0xBC, 0x52, 0x00, 0x37, 0x88, 0x17, 0x01, 0x8E, 0x34, 0x79, 0x62, 0x65, 0x23, 0x8D,
+        0xC0, 0x09, 0x93, 0xDF, 0x79, 0x1E, 0xB8, 0x71, 0xCD, 0x91, 0x85, 0xC6, 0x31, 0x17, 0x95, 0xE5,
+        0x70, 0xB8, 0xCB, 0x94, 0x70, 0xB2, 0x14, 0xC6, 0x58, 0x44, 0x8C, 0x34, 0x9C, 0x4D, 0x3C, 0x59,
+        0xA7, 0x02, 0xB9, 0xB8, 0x45, 0x89, 0x19, 0x06, 0xC7, 0x36, 0x49, 0xB3, 0x37, 0x19, 0x47, 0x94,
+        0xCE, 0xF9, 0xB2, 0x31, 0x8B, 0x83, 0x64, 0x65, 0x91, 0x94, 0x92, 0xC0, 0xDC, 0xC1, 0x6D, 0xCD,
+        0x78, 0x3B, 0x5E, 0x80, 0xD7, 0xA8, 0x70, 0x1E, 0x26, 0x06, 0x43, 0x33, 0x0C, 0x98, 0x24, 0xD0,
+        0x93, 0x60, 0xD9, 0x61, 0x86, 0xDC, 0x3A, 0x31, 0xA4, 0x8A, 0x18, 0x30, 0x78, 0xF2, 0x2A, 0x6A,
+        0x72, 0xCA, 0xCB, 0x25, 0x92, 0xDB, 0x71, 0x94, 0x3C, 0x07, 0x62, 0x08, 0xCA, 0xF7, 0x62, 0x58,
+        0x3E, 0x00, 0xC4, 0x3C, 0x02, 0xAF, 0xC7, 0xF7, 0xE7, 0x48, 0x5F, 0x63, 0xA7, 0xD4, 0x5F, 0x05,
+        0xAB, 0x3C, 0xA8, 0x94, 0x72, 0x16, 0x3B, 0xC6, 0x28, 0xA7, 0x11, 0x61, 0xFC, 0x33, 0xAF, 0x0F,
+        0x46, 0xFD, 0x7A, 0x35, 0x5D, 0x82, 0xDA, 0xE9, 0x9E, 0x79, 0xA3, 0x96, 0x3D, 0xBB, 0xD6, 0xBD,
+        0x88, 0xDB, 0xE6, 0x8B, 0x0B, 0x97, 0x14, 0x80, 0xCA, 0x38, 0x39, 0xB2, 0x26, 0x6C, 0xC5, 0x06,
+        0x30, 0x0B, 0xC4, 0xBC, 0xB1, 0xC1, 0xB9, 0x71, 0x72, 0x98, 0x59, 0x9B, 0x04, 0x02, 0x5C, 0xB8,
+        0x5C, 0x61, 0x47, 0x2E, 0x39, 0xB8, 0xC0, 0x49, 0x78, 0x17, 0x79, 0x62, 0xC7, 0x7E, 0x81, 0x63,
+        0xBF, 0x4B, 0x35, 0x60, 0x2D, 0xA3, 0x76, 0x37, 0x60, 0x8F, 0x37, 0x12, 0x24, 0xDE, 0x31, 0x18,
+        0xB2, 0x31, 0x8B, 0xCD, 0x99, 0xA3, 0x86, 0xF8, 0x8C, 0xB2, 0x31, 0x88, 0x6B, 0x76, 0xCB, 0x59,
+        0x30, 0x58, 0xC1, 0x70, 0x63, 0xCE, 0xC8, 0x16, 0xB2, 0xD6, 0x58, 0xA1, 0xC7, 0x9D, 0xE2, 0x0C,
+        0x63, 0x18, 0x2C, 0x09, 0xBE, 0x6C, 0xB2, 0x03, 0x04, 0x63, 0x06, 0x31, 0x7C, 0xD8, 0x86, 0x76,
+        0xCB, 0x59, 0x32, 0x0D, 0x65, 0x7A, 0xD6, 0xB5, 0xA1, 0x71, 0x84, 0xEF, 0x0B, 0xCA, 0xF3, 0x60,
+        0xC6, 0x31, 0x64, 0x63, 0x37, 0x88, 0x34, 0xDD, 0xFB, 0xEC, 0x5E, 0x80, 0xBD, 0x1A, 0xB1, 0x6D,
+        0x02, 0xCD, 0xF7, 0x8B, 0x37, 0xDE, 0x02, 0xC5, 0x9D, 0xED, 0xF7, 0xA6, 0x08, 0xCB, 0xCB, 0x2E,
+        0x5C, 0x19, 0x70, 0x4B, 0x97, 0x10, 0x07, 0x95, 0xC0, 0x69, 0x96, 0x4B, 0x97, 0x2C, 0x73, 0x70,
+        0x49, 0xB8, 0x03, 0x12, 0x4A, 0xF0, 0x69, 0x17, 0x96, 0x17, 0x18, 0x08, 0x92, 0x5C, 0xB8, 0x33,
+        0x9D, 0xCC, 0x81, 0x90, 0xC0, 0x90, 0xA0, 0xC9, 0x0A, 0x42, 0xD8, 0x61, 0xA3, 0x18, 0x38, 0x88,
+        0xF3, 0x66, 0x4E, 0x20, 0x24, 0xA9, 0x2A, 0x30, 0x18, 0xCD, 0x47, 0x0D, 0xD8, 0x51, 0x0C, 0x29,
+        0x05, 0x49, 0x68, 0x70, 0x5D, 0xEA, 0x33, 0x1D, 0x42, 0xF4, 0x02, 0xAF, 0xD2, 0x07, 0xEE, 0x01,
+        0x3D, 0x61, 0xDF, 0xE6, 0xFF, 0xB0, 0x96, 0x86, 0x52, 0x4A, 0x88, 0xFD, 0x1C, 0x22, 0xC4, 0x4B,
+        0x86, 0xD0, 0xCA, 0x15, 0xD3, 0xDF, 0xDB, 0xA7, 0x5E, 0x1B, 0xE9, 0x7B, 0xE1, 0x2B, 0xC6, 0x53,
+        0x84, 0x75, 0x2D, 0x26, 0xC9, 0x41, 0x94, 0x64, 0x0D, 0xE0, 0xDE, 0x0C, 0x65, 0x1C, 0xB8, 0x59,
+        0x94, 0x85, 0xC4, 0x83, 0x7C, 0xEE, 0x30, 0x06, 0x03, 0x01, 0x0B, 0xE5, 0xB9, 0x9D, 0xF3, 0xB9,
+        0x10, 0x01, 0xBB, 0xD0, 0x1E, 0xEC, 0x1D, 0x9A, 0x7B, 0x8C, 0x9E, 0xE0, 0x1A, 0xF7, 0x69, 0xEA,
+        0xD7, 0x86, 0x92, 0x77, 0xE6, 0xC9, 0x63, 0x96, 0x02, 0x0C, 0x71, 0x79, 0xB2, 0x59, 0x11, 0x64,
+        0x5C, 0x48, 0xB0, 0x97, 0x02, 0x6B, 0x56, 0xD6, 0x97, 0xA0, 0xD3, 0x5A, 0x69, 0xAD, 0xDE, 0x12,
+        0xF2, 0x91, 0x97, 0x04, 0x8A, 0x3C, 0xB1, 0x8E, 0x57, 0x12, 0x39, 0x46, 0x24, 0x62, 0x66, 0xE3,
+        0x94, 0xC1, 0xEF, 0xCD, 0x8C, 0x06, 0x26, 0x52, 0x0B, 0x01, 0x8F, 0x3D, 0xF2, 0x99, 0x65, 0x1E,
+        0x52, 0x31, 0x23, 0x96, 0x24, 0x1B, 0x32, 0xC6, 0x39, 0xB2, 0x24, 0x06, 0xE3, 0x13, 0x37, 0x0B,
+        0x8C, 0x40, 0xD3, 0x5A, 0x6B, 0x76, 0x68, 0x35, 0x6D, 0x69, 0xBB, 0xD2, 0xC3, 0x12, 0x59, 0x16,
+        0x45, 0xC5, 0x1E, 0x6C, 0x96, 0x30, 0x07, 0x2C, 0x47, 0x17, 0x9E, 0xF8, 0xA6, 0x58, 0xC9, 0x41,
+        0xAF, 0x76, 0x87, 0xB9, 0x90, 0x1E, 0xE6, 0x97, 0xAF, 0x70, 0x01, 0xBB, 0xD0, 0x35, 0xDF, 0xE1,
+        0xEF, 0x96, 0xE6, 0x77, 0x00, 0x60, 0x23, 0x00, 0x65, 0xF3, 0xB8, 0x92, 0xE0, 0x29, 0x95, 0xC2,
+        0xE5, 0xC6, 0x30, 0x1D, 0xC8, 0x6F, 0x01, 0x71, 0x81, 0x84, 0x4D, 0x11, 0x10, 0x15, 0x2C, 0x54,
+        0x78, 0xA6, 0x24, 0x40, 0x81, 0xA4, 0x08, 0x96, 0x2A, 0x7D, 0x21, 0x31, 0x4D, 0x5D, 0x98, 0xD9,
+        0x74, 0x54, 0x3F, 0x8A, 0x91, 0x4A, 0x68, 0x9D, 0x85, 0x7C, 0xE0, 0x61, 0xE1, 0x3C, 0x80, 0x02,
+        0xAF, 0xF4, 0x59, 0xFF, 0x0D, 0x59, 0x2D, 0xFD, 0x6E, 0xFB, 0xB5, 0x8C, 0x13, 0xFA, 0x7C, 0x4A,
+        0xA9, 0x39, 0x1B, 0xA3, 0x1C, 0x44, 0x87, 0xB0, 0x9E, 0x12, 0xD3, 0xC3, 0xA7, 0x5D, 0xF4, 0xCE,
+        0x97, 0xBC, 0x0B, 0x18, 0xC2, 0x30, 0x8A, 0x58, 0x58, 0x17, 0x19, 0x64, 0x16, 0x5C, 0x19, 0x64,
+        0x0B, 0x82, 0x1B, 0xBC, 0xB7, 0x78, 0x0B, 0x01, 0xDE, 0x7B, 0xFB, 0x7A, 0x00, 0x06, 0xEF, 0x40,
+        0xD0, 0x1A, 0x3D, 0x43, 0x4F, 0x7D, 0x87, 0x2C, 0x63, 0x96, 0x31, 0xE7, 0x70, 0x17, 0x2C, 0x1C,
+        0x58, 0x9C, 0xD8, 0x0C, 0xB0, 0x71, 0x1C, 0x2E, 0x5C, 0xA3, 0x89, 0x2E, 0x16, 0x12, 0xE5, 0xE6,
+        0x8C, 0x89, 0x12, 0x24, 0x9D, 0xE3, 0x02, 0x62, 0x69, 0xA6, 0xBC, 0x34, 0x8E, 0x52, 0x26, 0x6C,
+        0xCD, 0xE0, 0x3E, 0xF2, 0xF7, 0x34, 0xC3, 0x87, 0x96, 0x03, 0x96, 0x24, 0x07, 0x06, 0x91, 0xCB,
+        0x9B, 0xE7, 0x61, 0x33, 0x70, 0x77, 0x88, 0xE5, 0x20, 0x3C, 0xD8, 0x08, 0x99, 0x61, 0x37, 0x97,
+        0x95, 0x11, 0xF3, 0xBC, 0xB9, 0x62, 0x65, 0x80, 0x81, 0xAF, 0x76, 0x2F, 0x7D, 0xE1, 0x06, 0x26,
+        0x58, 0x5E, 0x1B, 0xCA, 0xF2, 0x83, 0x4F, 0x76, 0x9E, 0xED, 0x34, 0x0D, 0x31, 0x35, 0xBE, 0xFF,
+        0x50, 0x91, 0x22, 0x45, 0xE6, 0xE5, 0xC4, 0x47, 0x0B, 0x89, 0x2E, 0x5C, 0xB8, 0x0D, 0x84, 0xB0,
+        0x71, 0x1E, 0x69, 0x05, 0x92, 0xC1, 0xCB, 0x0B, 0xE6, 0xC4, 0x63, 0x96, 0x31, 0xCA, 0xF2, 0x91,
+        0x01, 0xB7, 0x1A, 0x34, 0x00, 0xDD, 0xE8, 0x00, 0x1B, 0xAF, 0xF7, 0x3B, 0xC5, 0x80, 0x0E, 0xF5,
+        0x9D, 0xEB, 0x3B, 0xC0, 0xAE, 0x30, 0xB8, 0xC5, 0xC6, 0x51, 0xC0, 0x70, 0x70, 0x93, 0x26, 0x67,
+        0xE2, 0x80, 0x82, 0x05, 0x30, 0xD4, 0x09, 0x92, 0xB0, 0xB3, 0x34, 0x3B, 0x9E, 0x57, 0xE4, 0x7E,
+        0xF5, 0x13, 0xA2, 0xAC, 0x7C, 0x8F, 0xF4, 0x61, 0x7B, 0xB6, 0xFD, 0x6F, 0x64, 0xB8, 0x02, 0xBF,
+        0x39, 0xAF, 0x80, 0x73, 0xC6, 0xF6, 0xCF, 0xDF, 0xDD, 0x5A, 0xC7, 0x34, 0x75, 0x44, 0x9C, 0x44,
+        0xC2, 0x74, 0x28, 0x41, 0x7C, 0x14, 0xC0, 0x94, 0x0C, 0xCF, 0xEB, 0xAE, 0xB8, 0xCE, 0x33, 0x50,
+        0x72, 0x30, 0x30, 0x20, 0x8B, 0xDD, 0x7E, 0xEC, 0x8D, 0x0C, 0x8A, 0x46, 0x4D, 0xE2, 0xC9, 0xA3,
+        0xC5, 0xE6, 0xC0, 0x8B, 0x08, 0x83, 0x37, 0xCD, 0xE5, 0x66, 0x6C, 0xCA, 0x44, 0x72, 0x99, 0xB3,
+        0x29, 0x9B, 0x81, 0x78, 0x37, 0x2E, 0x52, 0x01, 0x29, 0x97, 0x07, 0x7C, 0x6B, 0xE6, 0xE0, 0xB0,
+        0x08, 0x37, 0x0B, 0x8B, 0x97, 0x94, 0x83, 0x06, 0xE0, 0x84, 0x2E, 0x4D, 0x90, 0x46, 0x08, 0x42,
+        0x6E, 0x4D, 0xE6, 0xF2, 0x83, 0xD2, 0x7B, 0xB2, 0xCB, 0x61, 0x58, 0x30, 0x71, 0x19, 0x37, 0x82,
+        0xDF, 0x9D, 0x83, 0x9B, 0xE3, 0x5F, 0x36, 0x0C, 0x5C, 0x6F, 0x06, 0x6F, 0x12, 0x51, 0x91, 0x64,
+        0x65, 0x91, 0x64, 0x46, 0x6F, 0x0D, 0xE3, 0x19, 0x61, 0x2E, 0x0B, 0x05, 0xC4, 0x71, 0x39, 0xA4,
+        0x1B, 0x09, 0x64, 0x19, 0x71, 0x1C, 0x16, 0x33, 0x78, 0x6F, 0x18, 0xB2, 0x22, 0xE3, 0x16, 0x45,
+        0xC4, 0x9B, 0xC1, 0x61, 0xB9, 0x2C, 0x8B, 0xCE, 0xCC, 0x83, 0xDE, 0x58, 0x3E, 0x7B, 0x93, 0x78,
+        0xB0, 0x0D, 0xD9, 0x65, 0xB5, 0x65, 0x84, 0x72, 0x90, 0x94, 0xCD, 0xE6, 0xF1, 0x0E, 0xFD, 0x23,
+        0x2C, 0xAF, 0xD0, 0x77, 0x91, 0x9D, 0xEB, 0x27, 0x87, 0x72, 0xC9, 0x70, 0xB8, 0x80, 0xC2, 0x41,
+        0xD5, 0xA8, 0x57, 0x4E, 0x18, 0x82, 0x20, 0x26, 0x5C, 0xB9, 0xB8, 0x17, 0x83, 0x4C, 0xAF, 0x29,
+        0x96, 0x26, 0x54, 0x79, 0x59, 0x9B, 0xCE, 0xF1, 0x22, 0x30, 0x62, 0x0F, 0x36, 0x4D, 0xE2, 0xC9,
+        0xA1, 0xFA, 0xB4, 0xDA, 0xB4, 0x60, 0xB9, 0xB3, 0x2C, 0x08, 0x98, 0x62, 0xA4, 0x00, 0x31, 0x85,
+        0x18, 0x92, 0xCB, 0x4E, 0xA9, 0x1B, 0x53, 0x81, 0xF0, 0xBD, 0xEB, 0x11, 0x41, 0x28, 0x1D, 0x61,
+        0xCE, 0x56, 0xCD, 0xFE, 0x3B, 0x68, 0x3C, 0x70, 0x02, 0xBF, 0xD6, 0x73, 0xDD, 0x73, 0xDD, 0x47,
+        0xC4, 0x36, 0x12, 0xE6, 0xB6, 0x5E, 0xA3, 0x8E, 0x31, 0xA1, 0x9A, 0x1A, 0x20, 0xBA, 0x0E, 0x20,
+        0x6E, 0x05, 0x60, 0x12, 0x5F, 0x7E, 0xF9, 0xEE, 0x6C, 0xB5, 0x70, 0x4A, 0x28, 0x11, 0xAC, 0x9A,
+        0x6B, 0x0B, 0x12, 0x09, 0x1E, 0x6E, 0x58, 0x8E, 0x29, 0x25, 0x92, 0xC9, 0x66, 0x68, 0xC9, 0x64,
+        0x47, 0x1C, 0xD9, 0x9B, 0x81, 0x6B, 0xDD, 0x78, 0xB4, 0xD6, 0x10, 0x72, 0xC6, 0x39, 0x64, 0xA6,
+        0x04, 0x58, 0xD2, 0xCD, 0x43, 0x97, 0x2E, 0x24, 0x42, 0x5C, 0x10, 0x5E, 0x5A, 0x68, 0xD6, 0x0D,
+        0xC7, 0x37, 0x2E, 0x00, 0xC4, 0x82, 0x0C, 0x2F, 0x9D, 0xC1, 0x80, 0x20, 0xD7, 0xA1, 0x3D, 0x77,
+        0xB4, 0x37, 0xCD, 0x80, 0xC0, 0x9B, 0x81, 0x05, 0x64, 0xB1, 0xE7, 0x78, 0x84, 0xB0, 0x05, 0xB4,
+        0x37, 0xDF, 0xA0, 0x5E, 0x6C, 0x01, 0xF3, 0xDC, 0x22, 0x40, 0xB7, 0x61, 0x6D, 0x6B, 0x58, 0x2B,
+        0x0B, 0xD6, 0x9A, 0x70, 0xFC, 0xEC, 0x01, 0xE6, 0xC0, 0x9B, 0xC4, 0x06, 0xAC, 0x2F, 0x46, 0x1D,
+        0xF3, 0x63, 0x8B, 0x22, 0x17, 0x88, 0x83, 0x01, 0xE7, 0x72, 0x37, 0x25, 0x06, 0x1B, 0xB4, 0xC2,
+        0xC2, 0x5F, 0x3B, 0x83, 0x01, 0x23, 0x01, 0x0B, 0x97, 0x96, 0x5C, 0x18, 0x80, 0x69, 0xAC, 0xEC,
+        0xCE, 0xF4, 0x12, 0x24, 0xB9, 0x72, 0xC8, 0x8C, 0x06, 0x8B, 0x1B, 0x9E, 0xAF, 0x07, 0x6B, 0x5E,
+        0xEC, 0x5A, 0x68, 0x60, 0x59, 0x96, 0x32, 0xF2, 0xBC, 0xA3, 0x2C, 0x22, 0xE2, 0xF2, 0xB8, 0xA3,
+        0x8B, 0x8A, 0x49, 0x63, 0x97, 0x9A, 0x1A, 0x64, 0xD6, 0xB4, 0xD0, 0x32, 0xD1, 0x96, 0xB6, 0xE5,
+        0x20, 0x11, 0x02, 0x20, 0x64, 0x0E, 0x51, 0x82, 0xA6, 0x58, 0xE9, 0x6F, 0x7E, 0x95, 0x86, 0x70,
+        0xC7, 0x0E, 0x41, 0x7B, 0x1A, 0xE4, 0x26, 0x3C, 0x43, 0xBD, 0xD4, 0x80, 0x02, 0xBF, 0xE3, 0x59,
+        0xF4, 0x72, 0xF9, 0xFB, 0xFC, 0x12, 0x62, 0xAE, 0x5A, 0xE5, 0x26, 0x26, 0x22, 0x6A, 0x0B, 0x61,
+        0x32, 0x01, 0xE0, 0xA2, 0x00, 0xE0, 0x2A, 0x01, 0x43, 0xDF, 0x5F, 0xEA, 0x88, 0x99, 0xBC, 0xA0,
+        0x69, 0xAC, 0x4C, 0x4C, 0x05, 0x82, 0x7B, 0xBC, 0xEF, 0x0D, 0xCB, 0x85, 0x8F, 0x37, 0x0B, 0x97,
+        0x83, 0x5E, 0x6E, 0x39, 0xB9, 0x78, 0xDC, 0x28, 0xF1, 0xBC, 0x49, 0xDF, 0x16, 0x03, 0x04, 0x79,
+        0xB2, 0x6E, 0x11, 0x61, 0x11, 0x64, 0x62, 0x38, 0x91, 0x9B, 0xC1, 0x19, 0xBF, 0x35, 0x90, 0x4C,
+        0x6E, 0x08, 0xCB, 0xC6, 0xC8, 0x24, 0x1C, 0x1B, 0x06, 0x09, 0x96, 0x0E, 0x58, 0x02, 0xCB, 0x0B,
+        0xF7, 0xF7, 0x83, 0x37, 0xCE, 0xF0, 0x58, 0x00, 0xF3, 0xA1, 0xEC, 0xEC, 0x06, 0xBB, 0xFD, 0xC2,
+        0x06, 0x77, 0x88, 0x12, 0xF2, 0xDE, 0x03, 0xB6, 0xB4, 0x37, 0x63, 0x09, 0x72, 0xCC, 0xA1, 0x16,
+        0x65, 0x82, 0xC4, 0x96, 0x06, 0x37, 0x2E, 0x41, 0xA0, 0xE2, 0x46, 0x39, 0x59, 0x05, 0x0C, 0xAE,
+        0x5C, 0x10, 0x71, 0x10, 0x23, 0x17, 0x0D, 0xCC, 0xDC, 0x44, 0x09, 0xBE, 0x50, 0x33, 0xB9, 0x10,
+        0x01, 0x79, 0x77, 0xFB, 0xEC, 0x04, 0x64, 0x37, 0xCE, 0xF1, 0x2F, 0x9B, 0x00, 0x2C, 0xB0, 0xBD,
+        0xD9, 0x07, 0xB9, 0x96, 0x5E, 0xEC, 0x98, 0x45, 0xC9, 0xB8, 0xC2, 0xE4, 0xA4, 0x11, 0x67, 0x3D,
+        0xE3, 0x0D, 0xE3, 0x10, 0x37, 0x66, 0xB5, 0x6D, 0x2D, 0x85, 0x2F, 0x17, 0x9B, 0x06, 0x03, 0x06,
+        0x77, 0xC4, 0x9B, 0x93, 0x70, 0xB9, 0x34, 0xA1, 0xD3, 0x4E, 0xA5, 0x44, 0xC3, 0x80, 0xC7, 0x9B,
+        0x1C, 0x2E, 0x5C, 0xB8, 0x5C, 0xA0, 0xC1, 0x62, 0x62, 0x06, 0x2D, 0x34, 0xF7, 0xDF, 0xB8, 0x82,
+        0x00, 0x80, 0x21, 0x40, 0x25, 0x21, 0x33, 0x23, 0xE2, 0x83, 0xFE, 0xAB, 0x05, 0xC1, 0x36, 0x13,
+        0x22, 0x94, 0x2D, 0x88, 0xAC, 0x7C, 0x12, 0xBE, 0x7F, 0x00, 0x02, 0xBF, 0xFB, 0xD3, 0x71, 0x2E,
+        0xFF, 0x54, 0xFC, 0x7C, 0x5F, 0xCD, 0x24, 0xC9, 0xC4, 0x6E, 0xC2, 0x24, 0x31, 0x40, 0x38, 0x19,
+        0xC0, 0x80, 0x0E, 0x40, 0x00, 0x04, 0x0B, 0xF8, 0xBF, 0x99, 0x21, 0x84, 0x41, 0x82, 0x10, 0x76,
+        0xD3, 0x4B, 0xCE, 0xF5, 0x80, 0x9A, 0x6B, 0x5E, 0xE7, 0xBB, 0x05, 0x82, 0xF7, 0x7B, 0xB1, 0xB8,
+        0x4E, 0x77, 0x89, 0x0D, 0xF3, 0x72, 0xE1, 0x47, 0x2F, 0x2C, 0x42, 0x03, 0x2E, 0x03, 0x79, 0x63,
+        0x01, 0x97, 0xCD, 0x80, 0x2C, 0x18, 0xE5, 0xE6, 0x98, 0xB0, 0x12, 0x58, 0x0F, 0x36, 0x11, 0x8A,
+        0x38, 0x84, 0xBC, 0xD8, 0x46, 0x32, 0x86, 0xC9, 0x9D, 0xE5, 0x7A, 0xC0, 0xB5, 0x93, 0x5E, 0xFB,
+        0xC5, 0x0F, 0x1B, 0xC4, 0x72, 0x90, 0x65, 0xE0, 0xA5, 0xE2, 0x32, 0xF9, 0xB0, 0x60, 0x05, 0xEE,
+        0xD6, 0x35, 0xDF, 0xA0, 0xB2, 0x58, 0x30, 0x09, 0xBE, 0x6C, 0x05, 0x82, 0xDE, 0xFE, 0xF6, 0x80,
+        0x2C, 0x34, 0x5F, 0xBE, 0xC0, 0x68, 0x58, 0x35, 0xDF, 0xE1, 0xAC, 0x00, 0x60, 0xF3, 0xBC, 0x40,
+        0x2C, 0xBD, 0x59, 0xBE, 0xF6, 0x80, 0xB5, 0xEE, 0xC2, 0xCB, 0xF0, 0xF7, 0x18, 0x4D, 0xC2, 0x6E,
+        0x30, 0x44, 0xCB, 0x09, 0xB9, 0x36, 0x40, 0xBC, 0x0E, 0xD3, 0x2D, 0x65, 0xBB, 0x60, 0x77, 0x93,
+        0x2B, 0xD6, 0xB4, 0x23, 0xCD, 0xC4, 0x25, 0x91, 0x88, 0x2F, 0x36, 0x03, 0x88, 0x32, 0x50, 0x79,
+        0xB9, 0x63, 0x06, 0x03, 0xCE, 0xE0, 0xB0, 0x18, 0xE6, 0xE1, 0x71, 0x80, 0x88, 0x47, 0x37, 0x2E,
+        0x17, 0x2F, 0x07, 0xBC, 0x12, 0x6F, 0x9A, 0x62, 0x0E, 0x0D, 0xCB, 0x00, 0x18, 0xE5, 0x32, 0x86,
+        0xB4, 0xD3, 0x16, 0xEF, 0x03, 0xB3, 0x4D, 0x5E, 0x9B, 0xB1, 0x04, 0x10, 0x10, 0x02, 0x34, 0xC8,
+        0xAD, 0xE0, 0xEA, 0xBF, 0xF4, 0x36, 0xC3, 0x18, 0x22, 0x86, 0xF0, 0x9C, 0x92, 0x51, 0xFD, 0x31,
+        0xF2, 0xFF, 0x55, 0x00, 0x02, 0xBF, 0xFE, 0xB5, 0xDB, 0x8E, 0x7F, 0xEF, 0x17, 0x96, 0x4B, 0x2C,
+        0x94, 0xD8, 0xA0, 0x86, 0x98, 0x10, 0x04, 0x98, 0x37, 0x03, 0x68, 0x2A, 0x02, 0x38, 0x0C, 0x00,
+        0x41, 0x7F, 0xF5, 0xEF, 0xCD, 0x82, 0xC4, 0x07, 0x0C, 0x41, 0x19, 0x70, 0xB8, 0xBE, 0x76, 0x41,
+        0x30, 0x77, 0x18, 0x32, 0xE0, 0xE2, 0x30, 0x6F, 0x19, 0xBC, 0x66, 0xE4, 0xB2, 0x28, 0xC8, 0xB0,
+        0x85, 0xC6, 0x2F, 0x10, 0xED, 0x8F, 0xBF, 0x2C, 0x59, 0xC3, 0xCD, 0xC1, 0x80, 0xC0, 0x2E, 0x42,
+        0x2E, 0x22, 0xE0, 0x45, 0xD0, 0xBA, 0x8B, 0x81, 0x33, 0xBE, 0x6E, 0x58, 0x44, 0x03, 0x03, 0x86,
+        0xEF, 0x77, 0xA6, 0x40, 0xCB, 0xCA, 0x46, 0x5E, 0x2B, 0x92, 0x89, 0x18, 0xC6, 0x31, 0x8E, 0x6E,
+        0x0B, 0x8B, 0x96, 0x39, 0x42, 0x4A, 0x0C, 0x71, 0x63, 0x8A, 0x65, 0x8E, 0x0A, 0xE2, 0xC7, 0x2C,
+        0x8B, 0x94, 0x19, 0x9B, 0x1C, 0xA7, 0x36, 0x38, 0xB8, 0x36, 0x32, 0x2E, 0x2E, 0x23, 0x94, 0x79,
+        0x53, 0x10, 0x19, 0x9B, 0xCA, 0x8C, 0x02, 0x52, 0x66, 0xE5, 0x84, 0xA3, 0x25, 0x91, 0x63, 0x96,
+        0x4B, 0x11, 0xE6, 0x99, 0x63, 0xCA, 0x99, 0x64, 0x45, 0xCB, 0x19, 0x2C, 0x96, 0x39, 0x40, 0xDB,
+        0xB5, 0xB7, 0x69, 0xEA, 0x07, 0x2C, 0x72, 0xC9, 0x65, 0xE5, 0x8C, 0x16, 0x31, 0x8C, 0x4C, 0x6C,
+        0x90, 0x77, 0x18, 0x99, 0xB8, 0x84, 0x10, 0x37, 0x7B, 0xBD, 0x0F, 0x70, 0x61, 0x47, 0x2F, 0x3B,
+        0xE5, 0x2F, 0x97, 0x7C, 0x07, 0x7C, 0xA5, 0xF2, 0xDC, 0x8D, 0xC0, 0x02, 0xC5, 0x9D, 0xFB, 0xEF,
+        0x2C, 0x0B, 0x0D, 0xE0, 0x2E, 0x4D, 0x91, 0x83, 0x70, 0x46, 0x45, 0x91, 0x71, 0x1B, 0xC6, 0x6F,
+        0x19, 0xB8, 0xC2, 0x58, 0x25, 0xC6, 0x0C, 0xBC, 0xA4, 0x14, 0x7C, 0xEC, 0x97, 0x0B, 0x8C, 0xA6,
+        0x5C, 0x40, 0x0C, 0x04, 0x10, 0x11, 0x14, 0x9B, 0x4F, 0x3F, 0xA3, 0xE3, 0xFD, 0xDF, 0xB6, 0xC2,
+        0x50, 0x07, 0xC3, 0x50, 0x50, 0x8A, 0x71, 0x96, 0xB2, 0xCA, 0xFF, 0xDE, 0x30, 0x02, 0xBF, 0xFF,
+        0xA6, 0xF6, 0x3B, 0x1F, 0xFF, 0x48, 0x3B, 0xFC, 0x94, 0x18, 0x14, 0x82, 0xA8, 0x1D, 0x82, 0xE0,
+        0x43, 0x85, 0x40, 0x4B, 0x84, 0x30, 0x39, 0x81, 0xA0, 0x02, 0x9F, 0xFB, 0x7C, 0xEF, 0x16, 0x78,
+        0x29, 0x00, 0x0B, 0x2A, 0x08, 0x92, 0xE1, 0x79, 0xB8, 0x17, 0x18, 0x02, 0x32, 0xC5, 0xEE, 0x60,
+        0xCD, 0xE2, 0x0C, 0x8B, 0xCD, 0x84, 0x15, 0x91, 0x79, 0xB8, 0x90, 0x5E, 0x07, 0xDB, 0x16, 0x98,
+        0xB7, 0x78, 0x59, 0x9D, 0x90, 0x9B, 0x30, 0x6F, 0x9A, 0x32, 0xF9, 0xB2, 0x58, 0x03, 0x96, 0x60,
+        0x7F, 0x7E, 0x76, 0x03, 0xDC, 0x07, 0x28, 0xE5, 0xC1, 0x09, 0x66, 0x22, 0x86, 0x50, 0x32, 0xCB,
+        0xCB, 0x11, 0x32, 0x81, 0x8B, 0x94, 0x0E, 0x68, 0x99, 0x60, 0xC7, 0x29, 0x1C, 0xB8, 0x36, 0x39,
+        0x49, 0x17, 0x29, 0x96, 0x0B, 0x8B, 0x8B, 0x09, 0x63, 0x8A, 0x39, 0x64, 0xB2, 0x53, 0x17, 0x17,
+        0x06, 0xC9, 0x64, 0x41, 0x39, 0xB8, 0xC1, 0xB2, 0x2E, 0x29, 0xCD, 0xC6, 0x5E, 0x0E, 0x92, 0x59,
+        0x17, 0x19, 0x79, 0xA0, 0xC0, 0x8B, 0x8B, 0x96, 0x4B, 0x20, 0xD3, 0x17, 0x17, 0x2C, 0x96, 0x38,
+        0x28, 0xC9, 0x64, 0xB1, 0xCA, 0x65, 0x19, 0x14, 0xCB, 0x1C, 0xB9, 0x62, 0x0E, 0x58, 0xC1, 0xCA,
+        0x73, 0x40, 0xC1, 0xB2, 0x50, 0x32, 0x91, 0xCD, 0xC4, 0x3D, 0xC3, 0xDC, 0x6D, 0xD7, 0xA0, 0x33,
+        0xBD, 0xD9, 0xEE, 0x1E, 0xE0, 0x80, 0x0E, 0x1B, 0xE5, 0x72, 0xC0, 0x41, 0xC5, 0xE7, 0x71, 0xE7,
+        0x72, 0x14, 0x5E, 0x22, 0xF9, 0x59, 0x71, 0x80, 0x13, 0x58, 0xAF, 0xDF, 0x6C, 0x83, 0x2F, 0x36,
+        0x45, 0x91, 0x1E, 0x6C, 0x18, 0xB0, 0x26, 0xF1, 0x13, 0x2C, 0x02, 0xC8, 0xC5, 0xBB, 0xC1, 0x2F,
+        0x37, 0x0B, 0x89, 0x2F, 0x36, 0x0A, 0x00, 0x23, 0x0E, 0x40, 0xA5, 0x21, 0x33, 0x14, 0x6A, 0x7D,
+        0x4F, 0x17, 0xD8, 0xF8, 0xF6, 0x11, 0x00, 0xB6, 0x07, 0x80, 0xAC, 0x05, 0x45, 0x09, 0x7F, 0xAF,
+        0xFF, 0xA4, 0x20, 0x00, 0x00, 0x00, 0x00
+    };
+
+    static const AKWFTableRef tables[count] PROGMEM = {
+        { data +      0, 600 },   //   0 AKWF_R_asym_saw_01
+        { data +    368, 600 },   //   1 AKWF_R_asym_saw_02
+        { data +    695, 600 },   //   2 AKWF_R_asym_saw_03
+        { data +   1004, 600 },   //   3 AKWF_R_asym_saw_04
+        { data +   1308, 600 },   //   4 AKWF_R_asym_saw_05
+        { data +   1608, 600 },   //   5 AKWF_R_asym_saw_06
+        { data +   1912, 600 },   //   6 AKWF_R_asym_saw_07
+        { data +   2209, 600 },   //   7 AKWF_R_asym_saw_08
+        { data +   2499, 600 },   //   8 AKWF_R_asym_saw_09
+        { data +   2789, 600 },   //   9 AKWF_R_asym_saw_10
+        { data +   3074, 600 },   //  10 AKWF_R_asym_saw_11
+        { data +   3366, 600 },   //  11 AKWF_R_asym_saw_12
+        { data +   3647, 600 },   //  12 AKWF_R_asym_saw_13
+        { data +   3939, 600 },   //  13 AKWF_R_asym_saw_14
+        { data +   4220, 600 },   //  14 AKWF_R_asym_saw_15
+        { data +   4492, 600 },   //  15 AKWF_R_asym_saw_16
+        { data +   4758, 600 },   //  16 AKWF_R_asym_saw_17
+        { data +   5024, 600 },   //  17 AKWF_R_asym_saw_18
+        { data +   5286, 600 },   //  18 AKWF_R_asym_saw_19
+        { data +   5544, 600 },   //  19 AKWF_R_asym_saw_20
+        { data +   5800, 600 },   //  20 AKWF_R_asym_saw_21
+        { data +   6061, 600 },   //  21 AKWF_R_asym_saw_22
+        { data +   6316, 600 },   //  22 AKWF_R_asym_saw_23
+        { data +   6575, 600 },   //  23 AKWF_R_asym_saw_24
+        { data +   6836, 600 },   //  24 AKWF_R_asym_saw_25
+        { data +   7097, 600 },   //  25 AKWF_R_asym_saw_26
+        { data +   7357, 600 },   //  26 AKWF_R_sym_saw_01
+        { data +   7724, 600 },   //  27 AKWF_R_sym_saw_02
+        { data +   8059, 600 },   //  28 AKWF_R_sym_saw_03
+        { data +   8381, 600 },   //  29 AKWF_R_sym_saw_04
+        { data +   8698, 600 },   //  30 AKWF_R_sym_saw_05
+        { data +   9013, 600 },   //  31 AKWF_R_sym_saw_06
+        { data +   9323, 600 },   //  32 AKWF_R_sym_saw_07
+        { data +   9634, 600 },   //  33 AKWF_R_sym_saw_08
+        { data +   9945, 600 },   //  34 AKWF_R_sym_saw_09
+        { data +  10254, 600 },   //  35 AKWF_R_sym_saw_10
+        { data +  10563, 600 },   //  36 AKWF_R_sym_saw_11
+        { data +  10874, 600 },   //  37 AKWF_R_sym_saw_12
+        { data +  11169, 600 },   //  38 AKWF_R_sym_saw_13
+        { data +  11465, 600 },   //  39 AKWF_R_sym_saw_14
+        { data +  11756, 600 },   //  40 AKWF_R_sym_saw_15
+        { data +  12048, 600 },   //  41 AKWF_R_sym_saw_16
+        { data +  12341, 600 },   //  42 AKWF_R_sym_saw_17
+        { data +  12628, 600 },   //  43 AKWF_R_sym_saw_18
+        { data +  12906, 600 },   //  44 AKWF_R_sym_saw_19
+        { data +  13183, 600 },   //  45 AKWF_R_sym_saw_20
+        { data +  13454, 600 },   //  46 AKWF_R_sym_saw_21
+        { data +  13736, 600 },   //  47 AKWF_R_sym_saw_22
+        { data +  13996, 600 },   //  48 AKWF_R_sym_saw_23
+        { data +  14266, 600 },   //  49 AKWF_R_sym_saw_24
+        { data +  14532, 600 },   //  50 AKWF_R_sym_saw_25
+        { data +  14813, 600 }    //  51 AKWF_R_sym_saw_26
+    };
+
+} // namespace AKWF_BwSawrounded
@@ -1,1304 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwSawrounded {
-
-    // AKWF_R_asym_saw_01 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_01[600] PROGMEM = {
-        54, 329, 604, 878, 1146, 1414, 1682, 1943, 2204, 2465, 2719, 2973, 
-        3227, 3474, 3728, 3975, 4216, 4456, 4696, 4937, 5170, 5404, 5637, 5864, 
-        6090, 6317, 6543, 6763, 6983, 7196, 7416, 7628, 7834, 8047, 8253, 8452, 
-        8658, 8858, 9057, 9249, 9448, 9640, 9826, 10018, 10203, 10389, 10567, 10746, 
-        10924, 11103, 11275, 11446, 11618, 11790, 11954, 12119, 12277, 12442, 12600, 12758, 
-        12909, 13060, 13211, 13362, 13506, 13651, 13795, 13939, 14076, 14214, 14351, 14481, 
-        14612, 14742, 14873, 14996, 15120, 15244, 15367, 15484, 15601, 15717, 15834, 15944, 
-        16054, 16164, 16267, 16370, 16473, 16576, 16679, 16775, 16871, 16960, 17056, 17146, 
-        17235, 17324, 17407, 17489, 17571, 17654, 17729, 17812, 17887, 17956, 18032, 18100, 
-        18169, 18238, 18299, 18368, 18430, 18492, 18547, 18608, 18663, 18718, 18766, 18821, 
-        18869, 18917, 18965, 19007, 19048, 19089, 19130, 19171, 19206, 19240, 19274, 19309, 
-        19343, 19371, 19398, 19425, 19446, 19474, 19494, 19515, 19535, 19549, 19570, 19583, 
-        19597, 19604, 19618, 19625, 19631, 19638, 19645, 19645, 19645, 19652, 19645, 19645, 
-        19638, 19638, 19631, 19625, 19611, 19604, 19590, 19577, 19563, 19542, 19528, 19508, 
-        19487, 19467, 19446, 19419, 19398, 19371, 19343, 19309, 19281, 19247, 19213, 19178, 
-        19144, 19110, 19068, 19034, 18993, 18952, 18904, 18862, 18814, 18766, 18718, 18670, 
-        18622, 18567, 18519, 18464, 18409, 18347, 18292, 18231, 18176, 18114, 18052, 17983, 
-        17922, 17853, 17791, 17723, 17654, 17578, 17510, 17434, 17365, 17290, 17214, 17132, 
-        17056, 16974, 16899, 16816, 16734, 16651, 16562, 16480, 16390, 16301, 16212, 16123, 
-        16033, 15937, 15848, 15752, 15656, 15559, 15463, 15360, 15264, 15161, 15058, 14962, 
-        14852, 14749, 14646, 14536, 14433, 14323, 14214, 14104, 13987, 13877, 13767, 13651, 
-        13534, 13417, 13300, 13184, 13060, 12943, 12820, 12696, 12579, 12449, 12325, 12202, 
-        12078, 11948, 11817, 11687, 11556, 11426, 11295, 11165, 11027, 10890, 10760, 10622, 
-        10485, 10348, 10203, 10066, 9922, 9785, 9640, 9496, 9352, 9208, 9064, 8913, 
-        8768, 8617, 8473, 8322, 8171, 8020, 7862, 7711, 7560, 7402, 7244, 7086, 
-        6935, 6770, 6612, 6454, 6296, 6131, 5974, 5809, 5644, 5479, 5314, 5150, 
-        4985, 4813, 4648, 4477, 4305, 4140, 3968, 3797, 3625, 3447, 3275, 3096, 
-        2925, 2746, 2575, 2396, 2217, 2039, 1854, 1675, 1496, 1311, 1133, 947, 
-        762, 576, 391, 206, 20, -164, -350, -542, -727, -920, -1112, -1304, 
-        -1496, -1689, -1881, -2073, -2266, -2465, -2657, -2856, -3048, -3247, -3447, -3646, 
-        -3845, -4044, -4243, -4449, -4648, -4847, -5053, -5259, -5459, -5665, -5871, -6077, 
-        -6283, -6489, -6701, -6907, -7113, -7326, -7532, -7745, -7958, -8164, -8377, -8590, 
-        -8803, -9022, -9235, -9448, -9661, -9881, -10094, -10313, -10533, -10746, -10966, -11185, 
-        -11405, -11625, -11845, -12071, -12291, -12511, -12737, -12957, -13184, -13403, -13630, -13857, 
-        -14083, -14310, -14536, -14763, -14990, -15216, -15450, -15676, -15903, -16136, -16363, -16596, 
-        -16830, -17063, -17290, -17523, -17757, -17990, -18224, -18464, -18698, -18931, -19165, -19405, 
-        -19638, -19879, -20112, -20352, -20593, -20833, -21073, -21314, -21547, -21794, -22035, -22275, 
-        -22515, -22756, -23003, -23243, -23491, -23731, -23978, -24218, -24466, -24713, -24960, -25200, 
-        -25448, -25695, -25942, -26189, -26443, -26690, -26938, -27185, -27439, -27686, -27940, -28187, 
-        -28441, -28689, -28943, -29197, -29451, -29698, -29952, -30206, -30460, -30714, -30968, -31229, 
-        -31483, -31731, -31950, -32149, -32314, -32452, -32562, -32651, -32713, -32754, -32767, -32761, 
-        -32740, -32692, -32630, -32555, -32459, -32342, -32218, -32074, -31923, -31751, -31573, -31380, 
-        -31174, -30962, -30735, -30501, -30254, -30000, -29746, -29471, -29197, -28915, -28627, -28332, 
-        -28029, -27727, -27411, -27096, -26780, -26450, -26121, -25791, -25454, -25118, -24775, -24431, 
-        -24081, -23731, -23381, -23030, -22673, -22316, -21959, -21602, -21238, -20881, -20517, -20153, 
-        -19796, -19432, -19068, -18704, -18341, -17977, -17613, -17249, -16892, -16528, -16164, -15807, 
-        -15450, -15086, -14729, -14372, -14014, -13664, -13307, -12957, -12607, -12257, -11906, -11556, 
-        -11213, -10870, -10526, -10183, -9840, -9503, -9167, -8830, -8501, -8171, -7834, -7512, 
-        -7182, -6859, -6537, -6214, -5898, -5582, -5266, -4950, -4641, -4332, -4023, -3721, 
-        -3419, -3117, -2822, -2520, -2224, -1936, -1641, -1352, -1071, -782, -501, -219 
-    };
-
-    // AKWF_R_asym_saw_02 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_02[600] PROGMEM = {
-        26, 327, 628, 924, 1216, 1508, 1796, 2084, 2367, 2646, 2925, 3199, 
-        3469, 3739, 4004, 4270, 4531, 4787, 5044, 5296, 5549, 5792, 6040, 6283, 
-        6522, 6757, 6991, 7226, 7451, 7682, 7903, 8124, 8345, 8562, 8775, 8987, 
-        9195, 9403, 9606, 9810, 10009, 10204, 10399, 10589, 10779, 10969, 11151, 11337, 
-        11514, 11691, 11868, 12040, 12213, 12381, 12545, 12708, 12872, 13031, 13191, 13346, 
-        13496, 13647, 13797, 13943, 14085, 14226, 14368, 14505, 14642, 14775, 14903, 15036, 
-        15160, 15288, 15408, 15532, 15651, 15766, 15881, 15992, 16103, 16213, 16319, 16426, 
-        16527, 16629, 16726, 16824, 16921, 17014, 17103, 17191, 17280, 17364, 17448, 17532, 
-        17611, 17691, 17766, 17842, 17912, 17983, 18054, 18120, 18187, 18249, 18311, 18373, 
-        18430, 18488, 18541, 18594, 18647, 18696, 18744, 18793, 18837, 18881, 18921, 18961, 
-        19001, 19036, 19072, 19107, 19138, 19169, 19196, 19222, 19249, 19275, 19297, 19315, 
-        19337, 19355, 19373, 19386, 19399, 19412, 19421, 19430, 19439, 19443, 19448, 19452, 
-        19452, 19452, 19452, 19448, 19443, 19439, 19430, 19421, 19412, 19404, 19390, 19377, 
-        19359, 19346, 19328, 19306, 19289, 19266, 19240, 19218, 19191, 19165, 19138, 19107, 
-        19076, 19045, 19010, 18974, 18939, 18904, 18864, 18824, 18784, 18740, 18700, 18656, 
-        18607, 18563, 18514, 18466, 18412, 18364, 18311, 18258, 18200, 18147, 18089, 18032, 
-        17970, 17908, 17846, 17784, 17722, 17656, 17589, 17523, 17457, 17386, 17315, 17244, 
-        17173, 17098, 17023, 16948, 16872, 16797, 16718, 16638, 16558, 16474, 16395, 16310, 
-        16226, 16138, 16054, 15965, 15877, 15788, 15700, 15607, 15514, 15421, 15328, 15235, 
-        15138, 15040, 14943, 14846, 14744, 14647, 14545, 14443, 14341, 14235, 14129, 14027, 
-        13921, 13810, 13704, 13593, 13487, 13377, 13262, 13151, 13040, 12925, 12810, 12695, 
-        12580, 12461, 12346, 12226, 12107, 11987, 11863, 11744, 11620, 11496, 11372, 11248, 
-        11124, 10996, 10872, 10744, 10615, 10487, 10354, 10226, 10093, 9960, 9828, 9695, 
-        9562, 9429, 9292, 9155, 9018, 8881, 8744, 8606, 8465, 8328, 8186, 8044, 
-        7903, 7761, 7615, 7474, 7327, 7181, 7035, 6889, 6743, 6597, 6447, 6301, 
-        6150, 6000, 5850, 5699, 5544, 5394, 5239, 5088, 4934, 4779, 4624, 4469, 
-        4310, 4155, 3995, 3841, 3681, 3522, 3363, 3203, 3040, 2880, 2717, 2557, 
-        2393, 2230, 2066, 1902, 1739, 1570, 1407, 1239, 1075, 907, 738, 570, 
-        402, 234, 61, -106, -274, -446, -619, -792, -964, -1137, -1309, -1482, 
-        -1654, -1832, -2004, -2181, -2358, -2535, -2708, -2885, -3066, -3243, -3420, -3597, 
-        -3779, -3960, -4137, -4318, -4500, -4681, -4863, -5044, -5226, -5407, -5593, -5774, 
-        -5960, -6142, -6327, -6513, -6699, -6885, -7071, -7257, -7443, -7628, -7814, -8005, 
-        -8190, -8381, -8571, -8757, -8947, -9137, -9328, -9518, -9708, -9898, -10089, -10283, 
-        -10474, -10668, -10859, -11053, -11244, -11438, -11633, -11828, -12023, -12217, -12412, -12607, 
-        -12801, -12996, -13195, -13390, -13585, -13784, -13978, -14178, -14377, -14571, -14771, -14970, 
-        -15169, -15368, -15567, -15766, -15965, -16164, -16368, -16567, -16766, -16970, -17169, -17373, 
-        -17572, -17775, -17979, -18182, -18381, -18585, -18789, -18992, -19196, -19399, -19603, -19806, 
-        -20010, -20218, -20421, -20625, -20833, -21037, -21244, -21448, -21656, -21860, -22068, -22276, 
-        -22479, -22687, -22895, -23103, -23311, -23519, -23727, -23935, -24143, -24351, -24559, -24767, 
-        -24975, -25187, -25395, -25603, -25811, -26024, -26232, -26444, -26652, -26864, -27072, -27285, 
-        -27497, -27705, -27918, -28130, -28342, -28550, -28763, -28975, -29188, -29400, -29612, -29825, 
-        -30037, -30250, -30462, -30674, -30887, -31099, -31316, -31528, -31741, -31953, -32170, -32369, 
-        -32533, -32652, -32732, -32767, -32767, -32732, -32666, -32564, -32440, -32285, -32108, -31905, 
-        -31683, -31444, -31183, -30909, -30617, -30312, -29993, -29661, -29320, -28966, -28603, -28232, 
-        -27856, -27471, -27077, -26679, -26276, -25869, -25457, -25041, -24621, -24200, -23776, -23351, 
-        -22926, -22497, -22063, -21634, -21205, -20771, -20342, -19908, -19479, -19050, -18620, -18191, 
-        -17762, -17337, -16912, -16487, -16067, -15647, -15231, -14815, -14399, -13987, -13576, -13169, 
-        -12766, -12363, -11961, -11562, -11169, -10775, -10385, -9996, -9611, -9230, -8850, -8474, 
-        -8097, -7726, -7358, -6991, -6628, -6270, -5911, -5557, -5208, -4858, -4513, -4168, 
-        -3832, -3491, -3159, -2827, -2500, -2172, -1849, -1531, -1212, -898, -588, -278 
-    };
-
-    // AKWF_R_asym_saw_03 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_03[600] PROGMEM = {
-        149, 494, 836, 1171, 1506, 1835, 2160, 2482, 2800, 3112, 3424, 3733, 
-        4035, 4333, 4632, 4924, 5213, 5498, 5780, 6059, 6334, 6606, 6875, 7140, 
-        7399, 7658, 7914, 8166, 8415, 8660, 8899, 9138, 9374, 9606, 9835, 10064, 
-        10286, 10505, 10721, 10937, 11146, 11355, 11560, 11759, 11959, 12154, 12350, 12539, 
-        12725, 12911, 13093, 13269, 13445, 13621, 13790, 13960, 14122, 14285, 14444, 14603, 
-        14756, 14909, 15058, 15204, 15347, 15489, 15629, 15765, 15897, 16030, 16160, 16286, 
-        16408, 16531, 16651, 16767, 16883, 16992, 17105, 17211, 17318, 17420, 17520, 17620, 
-        17716, 17809, 17902, 17988, 18077, 18160, 18247, 18326, 18406, 18482, 18555, 18628, 
-        18698, 18768, 18834, 18897, 18960, 19020, 19080, 19136, 19189, 19242, 19292, 19342, 
-        19388, 19435, 19478, 19518, 19557, 19594, 19630, 19664, 19697, 19727, 19757, 19783, 
-        19806, 19830, 19853, 19873, 19889, 19906, 19922, 19936, 19946, 19956, 19966, 19972, 
-        19976, 19979, 19982, 19982, 19982, 19979, 19976, 19969, 19962, 19952, 19942, 19929, 
-        19919, 19903, 19886, 19869, 19849, 19830, 19810, 19786, 19760, 19733, 19707, 19677, 
-        19647, 19617, 19584, 19551, 19514, 19478, 19441, 19401, 19362, 19319, 19275, 19232, 
-        19186, 19139, 19093, 19043, 18993, 18940, 18887, 18834, 18781, 18725, 18665, 18608, 
-        18549, 18489, 18426, 18363, 18300, 18233, 18167, 18101, 18031, 17961, 17892, 17822, 
-        17749, 17676, 17600, 17523, 17447, 17371, 17291, 17211, 17132, 17052, 16969, 16886, 
-        16800, 16717, 16631, 16541, 16455, 16365, 16276, 16186, 16093, 16000, 15907, 15814, 
-        15718, 15622, 15526, 15429, 15330, 15230, 15131, 15031, 14928, 14826, 14723, 14620, 
-        14514, 14407, 14301, 14195, 14086, 13976, 13870, 13757, 13648, 13535, 13422, 13309, 
-        13196, 13083, 12967, 12851, 12735, 12616, 12499, 12380, 12261, 12141, 12022, 11899, 
-        11776, 11653, 11531, 11408, 11285, 11159, 11033, 10907, 10781, 10651, 10525, 10396, 
-        10266, 10137, 10007, 9875, 9742, 9613, 9480, 9344, 9211, 9078, 8942, 8806, 
-        8670, 8534, 8398, 8259, 8123, 7983, 7844, 7705, 7565, 7426, 7283, 7140, 
-        7001, 6858, 6716, 6570, 6427, 6284, 6138, 5992, 5846, 5700, 5554, 5408, 
-        5262, 5113, 4964, 4818, 4668, 4519, 4366, 4217, 4068, 3915, 3766, 3613, 
-        3460, 3308, 3155, 3003, 2847, 2694, 2538, 2385, 2229, 2073, 1917, 1762, 
-        1606, 1446, 1290, 1131, 975, 816, 657, 497, 338, 179, 19, -139, 
-        -298, -461, -620, -783, -945, -1108, -1270, -1433, -1596, -1758, -1921, -2083, 
-        -2249, -2412, -2578, -2740, -2906, -3072, -3238, -3404, -3570, -3736, -3902, -4068, 
-        -4237, -4403, -4572, -4738, -4907, -5073, -5242, -5412, -5581, -5750, -5919, -6089, 
-        -6258, -6427, -6596, -6769, -6938, -7111, -7280, -7452, -7622, -7794, -7967, -8136, 
-        -8308, -8481, -8654, -8826, -8999, -9171, -9344, -9520, -9692, -9865, -10037, -10213, 
-        -10386, -10562, -10734, -10910, -11086, -11258, -11434, -11610, -11783, -11959, -12134, -12310, 
-        -12486, -12662, -12838, -13014, -13190, -13369, -13545, -13721, -13896, -14076, -14252, -14427, 
-        -14607, -14782, -14962, -15137, -15317, -15493, -15672, -15848, -16027, -16206, -16382, -16561, 
-        -16740, -16919, -17099, -17274, -17454, -17633, -17812, -17991, -18170, -18350, -18529, -18708, 
-        -18887, -19066, -19246, -19425, -19607, -19786, -19966, -20145, -20324, -20506, -20686, -20865, 
-        -21044, -21227, -21406, -21585, -21767, -21947, -22129, -22308, -22487, -22670, -22849, -23032, 
-        -23211, -23393, -23573, -23755, -23934, -24117, -24296, -24478, -24658, -24840, -25019, -25202, 
-        -25384, -25564, -25746, -25925, -26108, -26290, -26469, -26652, -26834, -27014, -27196, -27379, 
-        -27558, -27740, -27923, -28102, -28285, -28467, -28646, -28829, -29011, -29190, -29373, -29555, 
-        -29735, -29917, -30100, -30279, -30461, -30644, -30823, -31005, -31188, -31367, -31550, -31732, 
-        -31911, -32094, -32276, -32456, -32615, -32724, -32767, -32751, -32675, -32552, -32383, -32170, 
-        -31921, -31639, -31327, -30989, -30627, -30242, -29837, -29416, -28981, -28530, -28069, -27598, 
-        -27116, -26625, -26131, -25630, -25126, -24614, -24100, -23586, -23071, -22554, -22033, -21515, 
-        -20998, -20480, -19966, -19448, -18937, -18426, -17918, -17411, -16906, -16405, -15907, -15413, 
-        -14922, -14434, -13950, -13472, -12994, -12519, -12051, -11587, -11126, -10668, -10213, -9762, 
-        -9317, -8876, -8438, -8007, -7575, -7150, -6732, -6314, -5903, -5491, -5090, -4688, 
-        -4290, -3898, -3510, -3129, -2747, -2372, -2000, -1632, -1267, -905, -550, -199 
-    };
-
-    // AKWF_R_asym_saw_04 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_04[600] PROGMEM = {
-        399, 804, 1204, 1595, 1984, 2367, 2745, 3117, 3483, 3845, 4203, 4556, 
-        4904, 5246, 5583, 5917, 6245, 6568, 6885, 7200, 7509, 7813, 8114, 8410, 
-        8703, 8990, 9272, 9551, 9825, 10096, 10361, 10621, 10878, 11133, 11382, 11628, 
-        11869, 12107, 12340, 12570, 12794, 13016, 13235, 13448, 13659, 13867, 14070, 14269, 
-        14466, 14658, 14847, 15033, 15216, 15394, 15569, 15742, 15911, 16076, 16237, 16396, 
-        16552, 16705, 16856, 17001, 17143, 17283, 17419, 17553, 17685, 17813, 17939, 18060, 
-        18180, 18298, 18410, 18522, 18629, 18736, 18837, 18936, 19034, 19130, 19220, 19311, 
-        19395, 19480, 19562, 19642, 19718, 19792, 19863, 19932, 20000, 20063, 20126, 20186, 
-        20244, 20299, 20351, 20403, 20452, 20498, 20542, 20583, 20621, 20660, 20695, 20728, 
-        20761, 20788, 20816, 20843, 20865, 20887, 20906, 20923, 20939, 20953, 20964, 20975, 
-        20980, 20988, 20991, 20994, 20994, 20994, 20991, 20985, 20980, 20972, 20961, 20950, 
-        20936, 20923, 20906, 20887, 20868, 20849, 20824, 20799, 20775, 20747, 20720, 20687, 
-        20657, 20624, 20589, 20553, 20515, 20476, 20435, 20394, 20351, 20307, 20260, 20214, 
-        20164, 20115, 20063, 20011, 19959, 19904, 19847, 19789, 19732, 19672, 19612, 19549, 
-        19486, 19420, 19354, 19289, 19220, 19152, 19081, 19009, 18938, 18864, 18791, 18714, 
-        18637, 18561, 18481, 18402, 18323, 18240, 18158, 18073, 17991, 17904, 17819, 17731, 
-        17644, 17553, 17463, 17373, 17280, 17187, 17094, 17001, 16905, 16809, 16711, 16612, 
-        16514, 16415, 16314, 16215, 16111, 16010, 15906, 15802, 15698, 15591, 15484, 15378, 
-        15271, 15162, 15052, 14943, 14830, 14721, 14609, 14494, 14382, 14267, 14152, 14037, 
-        13922, 13804, 13689, 13569, 13451, 13333, 13213, 13092, 12972, 12849, 12728, 12605, 
-        12482, 12359, 12236, 12110, 11984, 11858, 11732, 11606, 11478, 11349, 11223, 11092, 
-        10963, 10835, 10703, 10572, 10440, 10309, 10178, 10044, 9912, 9778, 9644, 9510, 
-        9376, 9239, 9105, 8968, 8831, 8694, 8558, 8418, 8281, 8142, 8005, 7865, 
-        7726, 7586, 7444, 7304, 7162, 7022, 6880, 6738, 6595, 6453, 6311, 6166, 
-        6023, 5878, 5733, 5588, 5443, 5298, 5153, 5008, 4860, 4715, 4567, 4422, 
-        4274, 4127, 3979, 3831, 3683, 3533, 3385, 3234, 3087, 2936, 2788, 2638, 
-        2487, 2337, 2186, 2036, 1882, 1732, 1581, 1428, 1278, 1124, 971, 818, 
-        667, 514, 361, 208, 52, -101, -254, -407, -563, -717, -873, -1026, 
-        -1182, -1338, -1491, -1647, -1803, -1959, -2115, -2271, -2427, -2583, -2739, -2895, 
-        -3054, -3210, -3366, -3525, -3681, -3839, -3995, -4154, -4310, -4469, -4627, -4786, 
-        -4942, -5101, -5260, -5418, -5577, -5736, -5895, -6053, -6212, -6371, -6530, -6688, 
-        -6850, -7009, -7167, -7326, -7487, -7646, -7805, -7966, -8125, -8287, -8445, -8607, 
-        -8766, -8927, -9086, -9247, -9406, -9567, -9726, -9888, -10049, -10208, -10369, -10531, 
-        -10692, -10851, -11012, -11174, -11335, -11494, -11656, -11817, -11979, -12140, -12299, -12460, 
-        -12622, -12783, -12945, -13106, -13268, -13429, -13588, -13749, -13911, -14072, -14234, -14395, 
-        -14557, -14718, -14880, -15041, -15203, -15364, -15526, -15684, -15846, -16007, -16169, -16330, 
-        -16492, -16653, -16815, -16976, -17137, -17299, -17460, -17619, -17781, -17942, -18104, -18265, 
-        -18427, -18588, -18749, -18908, -19070, -19231, -19393, -19554, -19716, -19874, -20036, -20197, 
-        -20359, -20517, -20679, -20840, -21002, -21161, -21322, -21484, -21642, -21804, -21965, -22124, 
-        -22285, -22444, -22606, -22767, -22926, -23087, -23246, -23408, -23566, -23728, -23887, -24048, 
-        -24207, -24365, -24527, -24686, -24844, -25006, -25165, -25323, -25485, -25644, -25802, -25961, 
-        -26120, -26281, -26440, -26599, -26757, -26916, -27075, -27234, -27392, -27551, -27710, -27869, 
-        -28027, -28186, -28345, -28504, -28662, -28818, -28977, -29136, -29294, -29450, -29609, -29768, 
-        -29924, -30083, -30239, -30397, -30556, -30712, -30868, -31027, -31183, -31342, -31498, -31654, 
-        -31812, -31968, -32124, -32283, -32439, -32592, -32718, -32767, -32724, -32592, -32387, -32116, 
-        -31790, -31413, -30991, -30537, -30047, -29533, -28993, -28435, -27860, -27272, -26673, -26065, 
-        -25449, -24828, -24204, -23575, -22945, -22316, -21686, -21059, -20433, -19811, -19190, -18572, 
-        -17959, -17351, -16746, -16147, -15553, -14964, -14382, -13801, -13229, -12663, -12102, -11549, 
-        -10999, -10454, -9918, -9387, -8861, -8344, -7830, -7323, -6822, -6327, -5837, -5355, 
-        -4879, -4406, -3941, -3481, -3026, -2580, -2137, -1699, -1269, -842, -424, -8 
-    };
-
-    // AKWF_R_asym_saw_05 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_05[600] PROGMEM = {
-        67, 558, 1044, 1523, 1993, 2455, 2910, 3358, 3798, 4234, 4660, 5079, 
-        5491, 5898, 6297, 6690, 7075, 7455, 7826, 8195, 8553, 8907, 9256, 9598, 
-        9933, 10263, 10585, 10905, 11216, 11524, 11823, 12119, 12410, 12694, 12973, 13245, 
-        13515, 13777, 14035, 14288, 14536, 14779, 15017, 15251, 15479, 15703, 15922, 16137, 
-        16349, 16553, 16753, 16950, 17143, 17331, 17514, 17694, 17870, 18041, 18207, 18371, 
-        18530, 18684, 18836, 18982, 19127, 19266, 19404, 19536, 19664, 19789, 19912, 20030, 
-        20145, 20256, 20364, 20468, 20569, 20668, 20761, 20855, 20942, 21029, 21111, 21190, 
-        21267, 21339, 21409, 21476, 21541, 21604, 21664, 21720, 21773, 21823, 21871, 21917, 
-        21960, 22001, 22040, 22074, 22107, 22136, 22165, 22192, 22213, 22235, 22254, 22269, 
-        22283, 22295, 22305, 22312, 22317, 22322, 22322, 22322, 22317, 22312, 22305, 22295, 
-        22285, 22271, 22257, 22240, 22220, 22201, 22177, 22153, 22129, 22100, 22071, 22040, 
-        22006, 21972, 21936, 21898, 21859, 21818, 21775, 21732, 21686, 21640, 21590, 21539, 
-        21489, 21436, 21380, 21325, 21267, 21209, 21149, 21089, 21026, 20961, 20896, 20829, 
-        20761, 20694, 20624, 20552, 20480, 20405, 20331, 20254, 20176, 20099, 20020, 19938, 
-        19856, 19774, 19690, 19606, 19519, 19433, 19346, 19257, 19165, 19076, 18985, 18891, 
-        18797, 18703, 18607, 18510, 18414, 18315, 18217, 18118, 18017, 17916, 17812, 17711, 
-        17608, 17502, 17396, 17290, 17184, 17076, 16967, 16859, 16748, 16637, 16527, 16416, 
-        16303, 16190, 16077, 15961, 15845, 15730, 15614, 15496, 15378, 15260, 15142, 15022, 
-        14904, 14781, 14661, 14541, 14418, 14295, 14172, 14047, 13924, 13799, 13674, 13549, 
-        13421, 13296, 13168, 13041, 12913, 12783, 12656, 12526, 12396, 12266, 12136, 12003, 
-        11873, 11741, 11608, 11476, 11343, 11209, 11076, 10941, 10807, 10672, 10537, 10402, 
-        10265, 10130, 9993, 9856, 9718, 9581, 9444, 9307, 9167, 9027, 8890, 8751, 
-        8611, 8471, 8332, 8192, 8050, 7910, 7768, 7626, 7487, 7345, 7203, 7061, 
-        6919, 6774, 6632, 6488, 6346, 6201, 6059, 5915, 5770, 5626, 5481, 5337, 
-        5192, 5048, 4901, 4757, 4610, 4465, 4318, 4174, 4027, 3880, 3733, 3587, 
-        3442, 3295, 3146, 2999, 2852, 2705, 2559, 2409, 2263, 2116, 1966, 1820, 
-        1670, 1521, 1374, 1225, 1076, 929, 780, 630, 481, 332, 182, 33, 
-        -115, -264, -414, -563, -712, -861, -1011, -1160, -1312, -1461, -1610, -1759, 
-        -1911, -2060, -2210, -2361, -2510, -2662, -2811, -2961, -3112, -3262, -3413, -3563, 
-        -3714, -3863, -4015, -4164, -4316, -4465, -4617, -4766, -4918, -5070, -5219, -5371, 
-        -5520, -5671, -5821, -5972, -6124, -6273, -6425, -6574, -6726, -6878, -7027, -7179, 
-        -7328, -7479, -7629, -7780, -7932, -8081, -8233, -8382, -8534, -8683, -8835, -8984, 
-        -9136, -9285, -9437, -9586, -9738, -9887, -10036, -10188, -10337, -10489, -10638, -10787, 
-        -10939, -11088, -11238, -11389, -11538, -11688, -11837, -11989, -12138, -12287, -12436, -12586, 
-        -12737, -12887, -13036, -13185, -13334, -13484, -13633, -13782, -13931, -14081, -14230, -14379, 
-        -14529, -14675, -14825, -14974, -15123, -15272, -15419, -15569, -15718, -15865, -16014, -16163, 
-        -16310, -16459, -16606, -16755, -16902, -17052, -17198, -17345, -17495, -17641, -17788, -17938, 
-        -18084, -18231, -18378, -18525, -18674, -18821, -18968, -19115, -19262, -19408, -19555, -19702, 
-        -19847, -19993, -20140, -20287, -20434, -20579, -20725, -20872, -21017, -21164, -21308, -21455, 
-        -21599, -21746, -21891, -22037, -22182, -22326, -22471, -22618, -22762, -22907, -23051, -23195, 
-        -23340, -23484, -23629, -23773, -23918, -24062, -24207, -24351, -24495, -24637, -24782, -24926, 
-        -25068, -25213, -25355, -25499, -25641, -25786, -25928, -26072, -26214, -26356, -26498, -26643, 
-        -26785, -26927, -27069, -27211, -27353, -27495, -27637, -27779, -27921, -28063, -28203, -28345, 
-        -28487, -28627, -28769, -28911, -29050, -29192, -29332, -29474, -29614, -29753, -29895, -30035, 
-        -30175, -30314, -30454, -30596, -30736, -30875, -31015, -31152, -31292, -31431, -31571, -31711, 
-        -31848, -31987, -32127, -32264, -32404, -32544, -32678, -32767, -32751, -32599, -32329, -31961, 
-        -31511, -30993, -30418, -29799, -29142, -28453, -27741, -27011, -26265, -25511, -24748, -23980, 
-        -23212, -22442, -21674, -20908, -20145, -19389, -18638, -17892, -17155, -16423, -15701, -14986, 
-        -14278, -13580, -12891, -12210, -11538, -10874, -10222, -9576, -8938, -8312, -7694, -7085, 
-        -6483, -5891, -5308, -4733, -4167, -3608, -3059, -2518, -1983, -1458, -943, -433 
-    };
-
-    // AKWF_R_asym_saw_06 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_06[600] PROGMEM = {
-        53, 655, 1245, 1824, 2393, 2952, 3498, 4034, 4562, 5079, 5585, 6081, 
-        6567, 7044, 7512, 7972, 8420, 8862, 9292, 9714, 10129, 10533, 10931, 11320, 
-        11700, 12073, 12437, 12795, 13144, 13486, 13820, 14146, 14464, 14778, 15083, 15381, 
-        15672, 15957, 16236, 16507, 16772, 17031, 17282, 17527, 17768, 18002, 18230, 18453, 
-        18669, 18881, 19087, 19285, 19480, 19670, 19853, 20032, 20206, 20374, 20537, 20696, 
-        20849, 20999, 21143, 21284, 21419, 21549, 21677, 21798, 21916, 22030, 22139, 22245, 
-        22346, 22443, 22536, 22627, 22713, 22794, 22872, 22947, 23017, 23086, 23150, 23212, 
-        23269, 23322, 23373, 23422, 23466, 23508, 23545, 23581, 23612, 23642, 23669, 23691, 
-        23713, 23731, 23746, 23757, 23768, 23775, 23779, 23782, 23782, 23779, 23773, 23766, 
-        23755, 23744, 23729, 23711, 23693, 23671, 23649, 23623, 23596, 23565, 23534, 23501, 
-        23466, 23428, 23388, 23347, 23305, 23258, 23212, 23163, 23115, 23062, 23009, 22953, 
-        22896, 22839, 22779, 22717, 22655, 22589, 22523, 22457, 22388, 22317, 22245, 22172, 
-        22099, 22022, 21946, 21867, 21787, 21708, 21624, 21542, 21458, 21372, 21286, 21198, 
-        21107, 21019, 20926, 20836, 20743, 20648, 20553, 20456, 20359, 20261, 20162, 20063, 
-        19961, 19859, 19756, 19652, 19548, 19442, 19336, 19230, 19122, 19014, 18903, 18795, 
-        18682, 18572, 18459, 18347, 18234, 18119, 18004, 17887, 17773, 17656, 17536, 17419, 
-        17300, 17181, 17061, 16940, 16819, 16697, 16576, 16452, 16328, 16205, 16081, 15955, 
-        15831, 15706, 15577, 15452, 15323, 15198, 15070, 14939, 14811, 14681, 14553, 14422, 
-        14292, 14160, 14029, 13897, 13764, 13632, 13499, 13367, 13234, 13100, 12965, 12830, 
-        12696, 12561, 12426, 12291, 12154, 12018, 11883, 11746, 11609, 11470, 11333, 11196, 
-        11057, 10920, 10781, 10642, 10503, 10363, 10224, 10085, 9946, 9805, 9666, 9526, 
-        9385, 9244, 9102, 8963, 8822, 8681, 8539, 8398, 8254, 8113, 7972, 7828, 
-        7687, 7543, 7402, 7258, 7117, 6974, 6830, 6686, 6543, 6399, 6258, 6112, 
-        5969, 5825, 5682, 5538, 5395, 5251, 5105, 4962, 4818, 4672, 4529, 4385, 
-        4240, 4096, 3950, 3807, 3661, 3517, 3372, 3226, 3082, 2937, 2791, 2647, 
-        2502, 2356, 2212, 2067, 1921, 1777, 1631, 1486, 1340, 1196, 1051, 905, 
-        759, 616, 470, 324, 178, 33, -110, -256, -401, -547, -691, -836, 
-        -982, -1126, -1272, -1417, -1563, -1707, -1852, -1998, -2142, -2287, -2433, -2577, 
-        -2722, -2866, -3012, -3155, -3301, -3447, -3590, -3736, -3880, -4023, -4169, -4312, 
-        -4458, -4602, -4745, -4891, -5035, -5178, -5324, -5467, -5611, -5755, -5898, -6044, 
-        -6187, -6331, -6474, -6618, -6762, -6905, -7049, -7192, -7336, -7479, -7621, -7764, 
-        -7908, -8051, -8193, -8336, -8480, -8621, -8765, -8908, -9049, -9193, -9334, -9476, 
-        -9619, -9761, -9904, -10045, -10187, -10328, -10472, -10613, -10754, -10896, -11037, -11178, 
-        -11320, -11461, -11602, -11744, -11885, -12024, -12165, -12307, -12446, -12587, -12729, -12868, 
-        -13009, -13148, -13290, -13429, -13570, -13709, -13848, -13987, -14129, -14268, -14407, -14546, 
-        -14685, -14824, -14964, -15103, -15242, -15381, -15520, -15657, -15796, -15935, -16072, -16211, 
-        -16350, -16487, -16626, -16763, -16900, -17039, -17176, -17313, -17450, -17589, -17726, -17863, 
-        -18000, -18137, -18274, -18411, -18548, -18682, -18819, -18956, -19093, -19228, -19365, -19502, 
-        -19636, -19773, -19908, -20043, -20180, -20314, -20449, -20584, -20721, -20855, -20990, -21125, 
-        -21260, -21394, -21529, -21664, -21796, -21931, -22066, -22198, -22333, -22468, -22600, -22735, 
-        -22867, -23002, -23135, -23267, -23400, -23534, -23667, -23799, -23932, -24064, -24197, -24329, 
-        -24462, -24594, -24727, -24857, -24990, -25122, -25252, -25385, -25517, -25648, -25778, -25910, 
-        -26041, -26171, -26304, -26434, -26564, -26694, -26825, -26955, -27085, -27216, -27346, -27476, 
-        -27607, -27737, -27865, -27995, -28125, -28254, -28384, -28512, -28642, -28770, -28898, -29029, 
-        -29157, -29285, -29413, -29541, -29669, -29797, -29925, -30053, -30181, -30310, -30438, -30564, 
-        -30692, -30820, -30946, -31074, -31200, -31328, -31454, -31582, -31707, -31833, -31959, -32087, 
-        -32213, -32339, -32465, -32591, -32712, -32767, -32666, -32377, -31928, -31356, -30685, -29936, 
-        -29130, -28278, -27392, -26482, -25555, -24621, -23678, -22735, -21794, -20860, -19930, -19007, 
-        -18095, -17194, -16304, -15425, -14559, -13705, -12863, -12037, -11223, -10421, -9635, -8860, 
-        -8098, -7349, -6614, -5891, -5183, -4485, -3800, -3129, -2468, -1819, -1183, -558 
-    };
-
-    // AKWF_R_asym_saw_07 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_07[600] PROGMEM = {
-        89, 826, 1545, 2249, 2937, 3607, 4266, 4907, 5534, 6146, 6744, 7330, 
-        7900, 8459, 9004, 9536, 10054, 10560, 11056, 11537, 12008, 12468, 12916, 13352, 
-        13777, 14193, 14597, 14991, 15374, 15747, 16112, 16466, 16812, 17147, 17474, 17791, 
-        18099, 18399, 18690, 18974, 19249, 19515, 19776, 20028, 20271, 20507, 20736, 20959, 
-        21173, 21382, 21582, 21777, 21965, 22146, 22321, 22490, 22652, 22811, 22961, 23106, 
-        23246, 23379, 23508, 23631, 23750, 23863, 23971, 24075, 24173, 24265, 24354, 24438, 
-        24517, 24592, 24662, 24729, 24792, 24850, 24904, 24954, 25000, 25042, 25081, 25117, 
-        25148, 25175, 25200, 25221, 25237, 25252, 25262, 25271, 25275, 25277, 25275, 25271, 
-        25264, 25254, 25242, 25225, 25208, 25187, 25162, 25137, 25108, 25079, 25046, 25010, 
-        24971, 24931, 24890, 24844, 24798, 24750, 24698, 24646, 24592, 24535, 24477, 24417, 
-        24354, 24290, 24225, 24156, 24088, 24017, 23944, 23871, 23794, 23717, 23640, 23558, 
-        23477, 23394, 23311, 23225, 23138, 23050, 22961, 22869, 22777, 22684, 22590, 22494, 
-        22398, 22300, 22200, 22100, 22000, 21898, 21794, 21690, 21586, 21480, 21373, 21265, 
-        21157, 21046, 20936, 20826, 20713, 20601, 20486, 20371, 20257, 20140, 20024, 19907, 
-        19790, 19672, 19551, 19432, 19311, 19190, 19067, 18945, 18822, 18699, 18574, 18451, 
-        18326, 18199, 18074, 17947, 17820, 17691, 17564, 17434, 17305, 17176, 17047, 16916, 
-        16787, 16655, 16524, 16391, 16260, 16126, 15993, 15860, 15726, 15593, 15460, 15324, 
-        15189, 15053, 14918, 14783, 14647, 14512, 14374, 14239, 14102, 13964, 13827, 13689, 
-        13552, 13414, 13275, 13137, 12998, 12860, 12721, 12581, 12441, 12302, 12162, 12023, 
-        11883, 11741, 11602, 11462, 11321, 11181, 11040, 10900, 10758, 10617, 10475, 10333, 
-        10194, 10052, 9911, 9769, 9627, 9483, 9342, 9200, 9059, 8917, 8775, 8632, 
-        8490, 8348, 8205, 8063, 7919, 7778, 7636, 7492, 7350, 7207, 7065, 6921, 
-        6780, 6636, 6494, 6351, 6209, 6065, 5924, 5780, 5638, 5495, 5353, 5209, 
-        5065, 4924, 4780, 4638, 4495, 4353, 4209, 4068, 3924, 3782, 3641, 3497, 
-        3355, 3212, 3070, 2928, 2785, 2643, 2501, 2357, 2216, 2074, 1930, 1789, 
-        1647, 1506, 1364, 1222, 1079, 937, 795, 654, 512, 370, 229, 87, 
-        -52, -193, -335, -477, -618, -758, -899, -1041, -1183, -1322, -1464, -1603, 
-        -1745, -1885, -2026, -2166, -2305, -2447, -2587, -2726, -2868, -3007, -3147, -3287, 
-        -3426, -3566, -3705, -3845, -3984, -4124, -4263, -4403, -4540, -4680, -4820, -4957, 
-        -5097, -5236, -5374, -5513, -5651, -5788, -5928, -6065, -6203, -6342, -6480, -6617, 
-        -6755, -6892, -7030, -7167, -7305, -7442, -7580, -7717, -7852, -7990, -8127, -8263, 
-        -8400, -8536, -8673, -8809, -8946, -9081, -9217, -9352, -9490, -9625, -9761, -9896, 
-        -10031, -10167, -10302, -10438, -10573, -10706, -10842, -10977, -11110, -11246, -11381, -11514, 
-        -11650, -11783, -11916, -12052, -12185, -12318, -12452, -12585, -12718, -12852, -12985, -13118, 
-        -13252, -13385, -13518, -13650, -13783, -13916, -14047, -14181, -14312, -14445, -14576, -14708, 
-        -14841, -14972, -15103, -15235, -15366, -15497, -15628, -15760, -15891, -16022, -16153, -16285, 
-        -16414, -16545, -16676, -16805, -16937, -17066, -17197, -17326, -17455, -17584, -17716, -17845, 
-        -17974, -18103, -18232, -18361, -18490, -18620, -18747, -18876, -19005, -19134, -19261, -19390, 
-        -19517, -19647, -19774, -19903, -20030, -20157, -20284, -20411, -20540, -20667, -20794, -20921, 
-        -21048, -21173, -21300, -21428, -21555, -21680, -21807, -21934, -22059, -22186, -22311, -22436, 
-        -22563, -22688, -22813, -22940, -23065, -23190, -23315, -23440, -23565, -23690, -23813, -23938, 
-        -24063, -24188, -24310, -24435, -24558, -24683, -24806, -24931, -25054, -25177, -25302, -25425, 
-        -25548, -25671, -25794, -25916, -26039, -26162, -26285, -26408, -26531, -26652, -26775, -26898, 
-        -27018, -27141, -27262, -27385, -27506, -27627, -27750, -27870, -27991, -28112, -28233, -28354, 
-        -28474, -28595, -28716, -28837, -28958, -29078, -29199, -29318, -29439, -29558, -29678, -29797, 
-        -29918, -30037, -30157, -30276, -30395, -30514, -30632, -30753, -30872, -30991, -31107, -31226, 
-        -31345, -31464, -31582, -31699, -31818, -31936, -32053, -32172, -32288, -32407, -32524, -32643, 
-        -32751, -32767, -32557, -32088, -31411, -30582, -29641, -28618, -27541, -26425, -25287, -24138, 
-        -22981, -21832, -20686, -19553, -18434, -17330, -16243, -15174, -14122, -13091, -12079, -11087, 
-        -10115, -9161, -8225, -7311, -6417, -5540, -4682, -3843, -3020, -2216, -1431, -662 
-    };
-
-    // AKWF_R_asym_saw_08 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_08[600] PROGMEM = {
-        513, 1400, 2265, 3106, 3923, 4721, 5494, 6247, 6980, 7694, 8387, 9062, 
-        9717, 10355, 10972, 11573, 12159, 12726, 13278, 13813, 14333, 14836, 15326, 15801, 
-        16261, 16706, 17140, 17559, 17965, 18358, 18738, 19108, 19465, 19809, 20143, 20466, 
-        20778, 21078, 21369, 21649, 21921, 22180, 22432, 22674, 22908, 23132, 23347, 23553, 
-        23751, 23943, 24124, 24300, 24466, 24626, 24780, 24926, 25063, 25195, 25321, 25441, 
-        25553, 25659, 25761, 25855, 25943, 26026, 26104, 26176, 26244, 26306, 26362, 26416, 
-        26462, 26506, 26544, 26578, 26606, 26632, 26652, 26670, 26682, 26692, 26698, 26698, 
-        26696, 26692, 26682, 26670, 26654, 26636, 26614, 26588, 26560, 26528, 26496, 26458, 
-        26418, 26376, 26332, 26284, 26236, 26182, 26128, 26072, 26013, 25953, 25889, 25823, 
-        25755, 25685, 25615, 25541, 25465, 25389, 25309, 25229, 25147, 25063, 24978, 24890, 
-        24802, 24712, 24620, 24526, 24432, 24336, 24238, 24140, 24041, 23941, 23837, 23735, 
-        23629, 23525, 23417, 23309, 23201, 23092, 22982, 22870, 22756, 22644, 22528, 22414, 
-        22296, 22180, 22063, 21945, 21825, 21705, 21583, 21463, 21341, 21217, 21094, 20970, 
-        20846, 20720, 20594, 20468, 20340, 20215, 20087, 19957, 19829, 19699, 19569, 19439, 
-        19307, 19176, 19044, 18912, 18780, 18648, 18514, 18380, 18247, 18113, 17977, 17843, 
-        17707, 17571, 17435, 17300, 17164, 17028, 16890, 16754, 16616, 16478, 16341, 16203, 
-        16065, 15927, 15787, 15649, 15511, 15372, 15232, 15092, 14954, 14814, 14674, 14534, 
-        14395, 14253, 14113, 13973, 13831, 13691, 13551, 13410, 13270, 13128, 12986, 12846, 
-        12704, 12562, 12423, 12281, 12139, 11997, 11855, 11715, 11573, 11432, 11290, 11148, 
-        11006, 10864, 10722, 10581, 10439, 10297, 10155, 10013, 9871, 9729, 9588, 9446, 
-        9304, 9164, 9022, 8880, 8738, 8597, 8455, 8313, 8171, 8029, 7887, 7747, 
-        7606, 7464, 7322, 7180, 7040, 6898, 6756, 6617, 6475, 6333, 6193, 6051, 
-        5911, 5770, 5630, 5488, 5348, 5206, 5066, 4926, 4785, 4645, 4505, 4365, 
-        4225, 4085, 3943, 3804, 3664, 3524, 3384, 3246, 3106, 2966, 2827, 2687, 
-        2549, 2409, 2269, 2131, 1991, 1854, 1714, 1576, 1436, 1298, 1160, 1022, 
-        883, 745, 607, 469, 331, 193, 55, -81, -219, -355, -493, -631, 
-        -769, -905, -1042, -1178, -1316, -1452, -1590, -1726, -1862, -1997, -2135, -2271, 
-        -2407, -2543, -2679, -2815, -2950, -3086, -3220, -3356, -3492, -3626, -3762, -3897, 
-        -4031, -4165, -4301, -4435, -4569, -4705, -4838, -4972, -5106, -5240, -5374, -5508, 
-        -5642, -5776, -5909, -6041, -6175, -6309, -6441, -6575, -6707, -6840, -6972, -7104, 
-        -7238, -7370, -7502, -7634, -7765, -7897, -8029, -8161, -8293, -8425, -8555, -8686, 
-        -8818, -8948, -9080, -9210, -9342, -9472, -9604, -9733, -9863, -9993, -10123, -10253, 
-        -10385, -10513, -10642, -10772, -10902, -11032, -11162, -11290, -11420, -11548, -11677, -11805, 
-        -11935, -12063, -12191, -12321, -12449, -12576, -12704, -12832, -12960, -13088, -13216, -13344, 
-        -13470, -13597, -13725, -13851, -13979, -14105, -14233, -14359, -14486, -14612, -14738, -14864, 
-        -14992, -15118, -15244, -15370, -15495, -15621, -15745, -15871, -15997, -16123, -16247, -16373, 
-        -16496, -16622, -16746, -16872, -16996, -17120, -17244, -17369, -17493, -17617, -17741, -17865, 
-        -17989, -18111, -18235, -18358, -18482, -18604, -18728, -18852, -18974, -19098, -19220, -19341, 
-        -19465, -19587, -19709, -19831, -19953, -20075, -20197, -20318, -20440, -20562, -20684, -20804, 
-        -20926, -21048, -21168, -21289, -21409, -21531, -21651, -21773, -21893, -22013, -22133, -22252, 
-        -22374, -22494, -22614, -22734, -22852, -22972, -23092, -23211, -23329, -23449, -23569, -23687, 
-        -23807, -23925, -24045, -24162, -24280, -24398, -24518, -24636, -24754, -24872, -24990, -25107, 
-        -25225, -25343, -25459, -25577, -25695, -25813, -25929, -26046, -26162, -26280, -26396, -26514, 
-        -26630, -26746, -26862, -26978, -27095, -27211, -27327, -27443, -27559, -27673, -27789, -27905, 
-        -28020, -28136, -28250, -28366, -28480, -28596, -28710, -28826, -28939, -29053, -29169, -29283, 
-        -29397, -29511, -29625, -29739, -29853, -29966, -30080, -30194, -30308, -30420, -30534, -30648, 
-        -30760, -30873, -30985, -31099, -31211, -31323, -31435, -31549, -31661, -31773, -31884, -31996, 
-        -32108, -32220, -32332, -32444, -32556, -32668, -32767, -32734, -32382, -31677, -30710, -29565, 
-        -28300, -26964, -25581, -24178, -22770, -21369, -19979, -18610, -17264, -15945, -14650, -13386, 
-        -12151, -10942, -9763, -8613, -7492, -6397, -5332, -4291, -3280, -2293, -1332, -397 
-    };
-
-    // AKWF_R_asym_saw_09 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_09[600] PROGMEM = {
-        821, 1890, 2926, 3930, 4900, 5842, 6750, 7632, 8482, 9307, 10103, 10874, 
-        11618, 12339, 13034, 13706, 14355, 14983, 15587, 16172, 16736, 17280, 17803, 18309, 
-        18797, 19266, 19719, 20153, 20572, 20974, 21362, 21734, 22092, 22435, 22764, 23082, 
-        23384, 23675, 23952, 24217, 24471, 24715, 24945, 25166, 25377, 25577, 25767, 25949, 
-        26119, 26282, 26435, 26580, 26716, 26844, 26964, 27076, 27183, 27280, 27371, 27456, 
-        27532, 27603, 27667, 27725, 27779, 27826, 27867, 27902, 27932, 27958, 27977, 27993, 
-        28002, 28008, 28010, 28008, 28000, 27989, 27973, 27954, 27931, 27905, 27874, 27841, 
-        27803, 27764, 27719, 27673, 27624, 27570, 27516, 27458, 27398, 27334, 27268, 27200, 
-        27129, 27055, 26981, 26904, 26824, 26743, 26658, 26573, 26485, 26396, 26305, 26212, 
-        26119, 26023, 25926, 25827, 25726, 25623, 25521, 25416, 25310, 25203, 25095, 24984, 
-        24874, 24761, 24649, 24535, 24419, 24302, 24186, 24068, 23950, 23830, 23708, 23588, 
-        23466, 23342, 23218, 23094, 22968, 22842, 22716, 22588, 22460, 22332, 22204, 22075, 
-        21945, 21813, 21683, 21552, 21420, 21286, 21155, 21021, 20887, 20754, 20618, 20484, 
-        20349, 20213, 20078, 19940, 19804, 19667, 19531, 19394, 19256, 19119, 18981, 18842, 
-        18704, 18565, 18427, 18288, 18148, 18009, 17869, 17730, 17590, 17449, 17309, 17170, 
-        17029, 16889, 16748, 16606, 16467, 16325, 16184, 16043, 15903, 15762, 15620, 15479, 
-        15337, 15196, 15055, 14913, 14772, 14630, 14489, 14348, 14206, 14065, 13923, 13780, 
-        13639, 13497, 13356, 13214, 13073, 12932, 12790, 12649, 12507, 12364, 12223, 12081, 
-        11940, 11798, 11657, 11518, 11376, 11235, 11093, 10952, 10810, 10669, 10528, 10388, 
-        10247, 10105, 9966, 9824, 9683, 9544, 9402, 9263, 9121, 8982, 8840, 8701, 
-        8561, 8420, 8281, 8141, 8002, 7862, 7723, 7581, 7442, 7302, 7165, 7025, 
-        6886, 6746, 6607, 6469, 6330, 6190, 6053, 5913, 5776, 5636, 5499, 5361, 
-        5222, 5084, 4947, 4809, 4672, 4534, 4397, 4259, 4122, 3984, 3847, 3709, 
-        3573, 3436, 3300, 3163, 3027, 2890, 2754, 2617, 2481, 2345, 2210, 2074, 
-        1939, 1803, 1667, 1532, 1396, 1261, 1125, 989, 856, 720, 586, 451, 
-        317, 182, 48, -85, -218, -354, -488, -621, -755, -889, -1022, -1154, 
-        -1288, -1421, -1555, -1687, -1820, -1952, -2086, -2217, -2351, -2483, -2615, -2746, 
-        -2878, -3010, -3143, -3273, -3405, -3537, -3668, -3800, -3930, -4062, -4193, -4323, 
-        -4455, -4585, -4716, -4846, -4976, -5106, -5235, -5367, -5497, -5627, -5755, -5884, 
-        -6014, -6144, -6274, -6402, -6531, -6659, -6789, -6917, -7047, -7175, -7302, -7432, 
-        -7560, -7688, -7816, -7944, -8071, -8199, -8327, -8453, -8581, -8709, -8835, -8962, 
-        -9090, -9216, -9342, -9470, -9596, -9722, -9848, -9976, -10101, -10227, -10353, -10479, 
-        -10603, -10729, -10855, -10981, -11105, -11231, -11357, -11481, -11607, -11731, -11855, -11980, 
-        -12104, -12228, -12352, -12476, -12600, -12724, -12848, -12972, -13096, -13218, -13342, -13466, 
-        -13588, -13712, -13834, -13958, -14080, -14202, -14326, -14448, -14570, -14692, -14814, -14936, 
-        -15059, -15181, -15303, -15425, -15547, -15667, -15789, -15909, -16031, -16153, -16273, -16393, 
-        -16515, -16635, -16755, -16876, -16996, -17118, -17238, -17358, -17476, -17596, -17716, -17836, 
-        -17956, -18075, -18195, -18313, -18433, -18551, -18671, -18789, -18908, -19028, -19146, -19264, 
-        -19382, -19500, -19618, -19737, -19855, -19973, -20091, -20207, -20326, -20444, -20560, -20678, 
-        -20794, -20912, -21029, -21145, -21263, -21379, -21496, -21612, -21728, -21844, -21960, -22077, 
-        -22193, -22309, -22425, -22540, -22656, -22772, -22886, -23003, -23117, -23233, -23347, -23464, 
-        -23578, -23692, -23806, -23921, -24035, -24151, -24264, -24378, -24492, -24606, -24721, -24835, 
-        -24947, -25062, -25176, -25288, -25403, -25515, -25629, -25742, -25854, -25966, -26081, -26193, 
-        -26305, -26418, -26530, -26642, -26755, -26867, -26979, -27090, -27202, -27315, -27425, -27537, 
-        -27648, -27760, -27871, -27983, -28093, -28204, -28316, -28426, -28537, -28647, -28758, -28868, 
-        -28979, -29089, -29199, -29310, -29418, -29529, -29639, -29749, -29858, -29968, -30077, -30187, 
-        -30296, -30404, -30515, -30623, -30732, -30840, -30949, -31057, -31166, -31274, -31382, -31491, 
-        -31599, -31706, -31814, -31923, -32029, -32138, -32246, -32353, -32461, -32568, -32676, -32767, 
-        -32667, -32126, -31117, -29788, -28266, -26631, -24940, -23229, -21523, -19835, -18177, -16556, 
-        -14973, -13431, -11932, -10477, -9063, -7690, -6359, -5067, -3814, -2601, -1423, -282 
-    };
-
-    // AKWF_R_asym_saw_10 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_10[600] PROGMEM = {
-        1224, 2505, 3739, 4926, 6067, 7165, 8223, 9238, 10214, 11151, 12054, 12919, 
-        13750, 14549, 15315, 16049, 16755, 17431, 18078, 18699, 19295, 19865, 20410, 20931, 
-        21430, 21907, 22362, 22797, 23211, 23607, 23985, 24343, 24686, 25011, 25320, 25613, 
-        25891, 26154, 26404, 26639, 26862, 27071, 27269, 27455, 27629, 27792, 27943, 28085, 
-        28217, 28339, 28452, 28554, 28651, 28736, 28816, 28886, 28948, 29005, 29052, 29094, 
-        29130, 29158, 29181, 29196, 29207, 29213, 29211, 29207, 29196, 29181, 29160, 29135, 
-        29107, 29075, 29037, 28995, 28952, 28903, 28850, 28795, 28736, 28674, 28609, 28541, 
-        28471, 28397, 28320, 28242, 28161, 28077, 27990, 27903, 27812, 27720, 27625, 27529, 
-        27430, 27330, 27230, 27125, 27019, 26913, 26806, 26696, 26586, 26472, 26359, 26245, 
-        26128, 26013, 25893, 25774, 25653, 25532, 25411, 25288, 25163, 25038, 24913, 24786, 
-        24659, 24531, 24402, 24273, 24143, 24012, 23881, 23749, 23616, 23484, 23351, 23217, 
-        23083, 22948, 22814, 22678, 22541, 22405, 22269, 22133, 21994, 21858, 21720, 21582, 
-        21444, 21305, 21165, 21027, 20887, 20747, 20607, 20469, 20329, 20187, 20047, 19907, 
-        19767, 19625, 19485, 19343, 19203, 19061, 18919, 18779, 18637, 18495, 18353, 18213, 
-        18071, 17929, 17787, 17645, 17503, 17361, 17219, 17077, 16935, 16793, 16651, 16509, 
-        16367, 16225, 16084, 15942, 15800, 15658, 15518, 15376, 15234, 15092, 14950, 14808, 
-        14666, 14526, 14384, 14242, 14102, 13960, 13818, 13678, 13536, 13396, 13254, 13114, 
-        12972, 12832, 12690, 12550, 12410, 12270, 12128, 11988, 11848, 11708, 11568, 11428, 
-        11287, 11147, 11007, 10867, 10729, 10589, 10449, 10311, 10171, 10033, 9893, 9754, 
-        9614, 9476, 9338, 9200, 9060, 8922, 8783, 8645, 8507, 8369, 8231, 8095, 
-        7956, 7818, 7682, 7544, 7406, 7269, 7133, 6995, 6859, 6722, 6584, 6448, 
-        6312, 6175, 6039, 5903, 5767, 5630, 5496, 5360, 5223, 5089, 4953, 4818, 
-        4682, 4548, 4413, 4277, 4143, 4008, 3874, 3739, 3605, 3471, 3336, 3202, 
-        3069, 2935, 2801, 2668, 2534, 2401, 2267, 2134, 2002, 1869, 1735, 1603, 
-        1470, 1338, 1205, 1073, 942, 810, 677, 545, 414, 282, 151, 18, 
-        -111, -242, -374, -505, -635, -766, -897, -1027, -1158, -1288, -1419, -1548, 
-        -1678, -1809, -1938, -2068, -2197, -2328, -2456, -2585, -2716, -2844, -2973, -3102, 
-        -3230, -3359, -3488, -3616, -3743, -3872, -4001, -4129, -4256, -4385, -4512, -4638, 
-        -4767, -4894, -5021, -5148, -5276, -5403, -5530, -5657, -5784, -5908, -6035, -6162, 
-        -6289, -6414, -6541, -6666, -6792, -6917, -7042, -7169, -7294, -7419, -7544, -7669, 
-        -7794, -7918, -8043, -8168, -8293, -8418, -8541, -8666, -8789, -8914, -9037, -9162, 
-        -9285, -9408, -9533, -9656, -9779, -9902, -10025, -10148, -10271, -10394, -10517, -10640, 
-        -10761, -10884, -11005, -11128, -11251, -11373, -11494, -11617, -11738, -11859, -11980, -12101, 
-        -12224, -12345, -12465, -12586, -12707, -12828, -12949, -13068, -13190, -13311, -13430, -13551, 
-        -13670, -13791, -13911, -14030, -14149, -14268, -14390, -14509, -14628, -14747, -14865, -14984, 
-        -15103, -15222, -15342, -15459, -15578, -15696, -15815, -15932, -16049, -16169, -16286, -16403, 
-        -16521, -16640, -16757, -16875, -16992, -17107, -17225, -17342, -17459, -17577, -17692, -17810, 
-        -17925, -18042, -18158, -18275, -18391, -18506, -18623, -18739, -18854, -18970, -19085, -19201, 
-        -19316, -19432, -19547, -19661, -19776, -19892, -20005, -20121, -20234, -20350, -20463, -20579, 
-        -20692, -20806, -20921, -21035, -21148, -21262, -21375, -21489, -21603, -21716, -21830, -21941, 
-        -22055, -22168, -22280, -22394, -22505, -22619, -22731, -22844, -22956, -23068, -23179, -23293, 
-        -23404, -23516, -23628, -23739, -23851, -23963, -24073, -24184, -24296, -24408, -24517, -24629, 
-        -24739, -24850, -24960, -25072, -25182, -25291, -25403, -25513, -25623, -25732, -25842, -25952, 
-        -26062, -26172, -26281, -26391, -26499, -26609, -26718, -26826, -26936, -27044, -27154, -27262, 
-        -27371, -27479, -27587, -27697, -27805, -27913, -28021, -28129, -28236, -28344, -28452, -28560, 
-        -28666, -28774, -28882, -28990, -29096, -29204, -29310, -29417, -29523, -29631, -29737, -29843, 
-        -29949, -30057, -30163, -30269, -30375, -30481, -30587, -30693, -30799, -30903, -31009, -31115, 
-        -31221, -31325, -31429, -31535, -31639, -31745, -31850, -31956, -32060, -32164, -32268, -32374, 
-        -32478, -32582, -32688, -32767, -32582, -31795, -30398, -28626, -26664, -24612, -22539, -20482, 
-        -18463, -16494, -14585, -12737, -10951, -9224, -7563, -5960, -4413, -2926, -1489, -107 
-    };
-
-    // AKWF_R_asym_saw_11 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_11[600] PROGMEM = {
-        501, 2080, 3588, 5030, 6408, 7723, 8977, 10175, 11318, 12410, 13449, 14438, 
-        15382, 16282, 17137, 17954, 18729, 19467, 20168, 20833, 21467, 22068, 22637, 23178, 
-        23689, 24174, 24634, 25067, 25476, 25863, 26227, 26571, 26894, 27197, 27482, 27750, 
-        27999, 28231, 28449, 28651, 28839, 29012, 29174, 29321, 29454, 29579, 29691, 29791, 
-        29882, 29962, 30035, 30096, 30150, 30194, 30230, 30259, 30280, 30295, 30302, 30302, 
-        30297, 30286, 30269, 30245, 30217, 30183, 30146, 30103, 30055, 30005, 29949, 29889, 
-        29824, 29757, 29687, 29614, 29536, 29456, 29375, 29287, 29200, 29109, 29016, 28919, 
-        28820, 28720, 28618, 28514, 28408, 28300, 28190, 28079, 27967, 27852, 27737, 27619, 
-        27500, 27381, 27259, 27138, 27013, 26891, 26764, 26638, 26511, 26383, 26255, 26125, 
-        25995, 25863, 25731, 25599, 25465, 25331, 25197, 25063, 24927, 24792, 24656, 24518, 
-        24381, 24243, 24106, 23968, 23829, 23691, 23552, 23412, 23273, 23133, 22992, 22853, 
-        22711, 22570, 22430, 22289, 22148, 22007, 21865, 21722, 21581, 21440, 21298, 21155, 
-        21014, 20871, 20729, 20586, 20445, 20302, 20160, 20017, 19874, 19733, 19590, 19446, 
-        19305, 19162, 19021, 18878, 18734, 18593, 18450, 18309, 18166, 18022, 17881, 17740, 
-        17597, 17455, 17312, 17171, 17030, 16886, 16745, 16604, 16463, 16319, 16178, 16037, 
-        15895, 15754, 15613, 15472, 15330, 15189, 15050, 14908, 14767, 14628, 14486, 14345, 
-        14205, 14064, 13925, 13785, 13644, 13505, 13365, 13226, 13086, 12947, 12807, 12668, 
-        12528, 12389, 12250, 12112, 11973, 11833, 11696, 11556, 11419, 11279, 11142, 11004, 
-        10866, 10727, 10589, 10452, 10314, 10177, 10039, 9903, 9766, 9628, 9492, 9355, 
-        9217, 9082, 8946, 8808, 8673, 8537, 8399, 8264, 8128, 7992, 7856, 7721, 
-        7587, 7451, 7315, 7180, 7046, 6910, 6776, 6640, 6507, 6373, 6239, 6103, 
-        5969, 5835, 5702, 5568, 5434, 5302, 5168, 5034, 4900, 4768, 4634, 4502, 
-        4369, 4237, 4105, 3973, 3839, 3707, 3575, 3443, 3311, 3179, 3049, 2917, 
-        2785, 2654, 2522, 2392, 2260, 2130, 1998, 1868, 1738, 1608, 1478, 1347, 
-        1217, 1087, 957, 827, 697, 568, 438, 308, 180, 50, -78, -206, 
-        -336, -464, -593, -721, -849, -977, -1106, -1234, -1362, -1491, -1617, -1745, 
-        -1874, -2000, -2128, -2255, -2383, -2509, -2636, -2762, -2891, -3017, -3143, -3270, 
-        -3396, -3523, -3647, -3774, -3900, -4025, -4151, -4277, -4402, -4528, -4653, -4778, 
-        -4902, -5029, -5153, -5278, -5402, -5527, -5651, -5776, -5899, -6023, -6148, -6271, 
-        -6395, -6520, -6642, -6765, -6890, -7012, -7135, -7260, -7382, -7505, -7628, -7750, 
-        -7873, -7996, -8117, -8239, -8362, -8483, -8606, -8728, -8849, -8970, -9093, -9214, 
-        -9334, -9457, -9578, -9699, -9820, -9941, -10061, -10182, -10303, -10422, -10543, -10664, 
-        -10783, -10904, -11023, -11143, -11262, -11383, -11502, -11621, -11740, -11859, -11980, -12099, 
-        -12218, -12335, -12454, -12573, -12692, -12811, -12928, -13047, -13164, -13283, -13400, -13519, 
-        -13637, -13754, -13873, -13990, -14107, -14224, -14341, -14458, -14575, -14693, -14808, -14925, 
-        -15042, -15159, -15275, -15392, -15507, -15624, -15739, -15855, -15972, -16087, -16202, -16318, 
-        -16433, -16548, -16663, -16779, -16894, -17009, -17123, -17238, -17353, -17466, -17582, -17697, 
-        -17810, -17924, -18039, -18153, -18266, -18381, -18495, -18608, -18721, -18835, -18948, -19062, 
-        -19173, -19287, -19400, -19513, -19625, -19738, -19850, -19963, -20075, -20188, -20300, -20411, 
-        -20525, -20636, -20748, -20859, -20971, -21083, -21194, -21306, -21417, -21527, -21638, -21750, 
-        -21860, -21971, -22083, -22193, -22302, -22414, -22523, -22633, -22745, -22854, -22964, -23074, 
-        -23183, -23293, -23403, -23513, -23622, -23732, -23840, -23949, -24059, -24167, -24277, -24384, 
-        -24494, -24602, -24710, -24820, -24927, -25035, -25143, -25253, -25361, -25468, -25576, -25682, 
-        -25790, -25898, -26006, -26114, -26219, -26327, -26435, -26541, -26649, -26755, -26861, -26969, 
-        -27075, -27181, -27287, -27394, -27500, -27606, -27712, -27818, -27924, -28028, -28134, -28240, 
-        -28346, -28450, -28556, -28662, -28767, -28873, -28977, -29081, -29187, -29291, -29395, -29501, 
-        -29605, -29709, -29813, -29917, -30021, -30126, -30230, -30332, -30436, -30540, -30644, -30747, 
-        -30851, -30953, -31057, -31159, -31263, -31366, -31468, -31570, -31672, -31777, -31879, -31981, 
-        -32083, -32186, -32288, -32390, -32492, -32593, -32697, -32767, -32466, -31356, -29475, -27181, 
-        -24717, -22215, -19740, -17329, -14997, -12755, -10604, -8542, -6568, -4679, -2874, -1148 
-    };
-
-    // AKWF_R_asym_saw_12 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_12[600] PROGMEM = {
-        150, 2066, 3879, 5597, 7226, 8768, 10227, 11608, 12913, 14147, 15312, 16414, 
-        17453, 18433, 19358, 20229, 21051, 21823, 22551, 23235, 23878, 24482, 25048, 25580, 
-        26077, 26542, 26977, 27384, 27762, 28114, 28442, 28745, 29025, 29286, 29524, 29744, 
-        29946, 30131, 30298, 30450, 30586, 30708, 30817, 30912, 30996, 31068, 31128, 31180, 
-        31220, 31251, 31271, 31286, 31290, 31288, 31277, 31260, 31236, 31207, 31170, 31128, 
-        31081, 31029, 30971, 30910, 30842, 30773, 30697, 30619, 30538, 30452, 30364, 30272, 
-        30177, 30079, 29980, 29878, 29773, 29667, 29557, 29445, 29333, 29218, 29102, 28983, 
-        28864, 28743, 28620, 28495, 28371, 28244, 28118, 27989, 27859, 27729, 27599, 27467, 
-        27333, 27201, 27065, 26931, 26796, 26660, 26522, 26385, 26247, 26110, 25970, 25833, 
-        25694, 25552, 25413, 25272, 25132, 24991, 24850, 24709, 24568, 24425, 24284, 24142, 
-        23999, 23856, 23715, 23572, 23429, 23286, 23143, 23000, 22857, 22714, 22571, 22428, 
-        22285, 22142, 21999, 21856, 21713, 21570, 21427, 21284, 21141, 20998, 20855, 20712, 
-        20569, 20426, 20283, 20140, 19997, 19854, 19711, 19569, 19426, 19283, 19140, 18999, 
-        18856, 18715, 18572, 18431, 18288, 18146, 18005, 17862, 17721, 17580, 17439, 17298, 
-        17156, 17015, 16874, 16733, 16592, 16450, 16311, 16170, 16029, 15889, 15748, 15609, 
-        15469, 15328, 15189, 15050, 14910, 14771, 14632, 14492, 14353, 14213, 14074, 13935, 
-        13797, 13658, 13519, 13381, 13243, 13104, 12967, 12829, 12690, 12552, 12415, 12277, 
-        12140, 12002, 11866, 11729, 11591, 11456, 11318, 11181, 11045, 10908, 10772, 10636, 
-        10500, 10363, 10227, 10092, 9956, 9820, 9686, 9551, 9415, 9279, 9145, 9010, 
-        8876, 8740, 8606, 8472, 8337, 8203, 8069, 7935, 7801, 7668, 7534, 7400, 
-        7266, 7134, 7000, 6868, 6734, 6602, 6468, 6336, 6204, 6071, 5938, 5806, 
-        5674, 5542, 5410, 5278, 5146, 5016, 4884, 4752, 4622, 4490, 4360, 4228, 
-        4098, 3967, 3837, 3705, 3575, 3445, 3315, 3184, 3056, 2926, 2796, 2666, 
-        2537, 2407, 2279, 2148, 2020, 1892, 1762, 1633, 1505, 1377, 1248, 1120, 
-        991, 863, 737, 608, 480, 353, 225, 99, -29, -155, -282, -410, 
-        -537, -663, -790, -916, -1043, -1169, -1296, -1422, -1549, -1674, -1800, -1925, 
-        -2051, -2176, -2302, -2427, -2552, -2678, -2803, -2928, -3052, -3177, -3302, -3426, 
-        -3551, -3676, -3799, -3923, -4048, -4171, -4296, -4418, -4541, -4666, -4789, -4912, 
-        -5035, -5159, -5282, -5405, -5528, -5649, -5772, -5894, -6017, -6138, -6261, -6384, 
-        -6505, -6626, -6749, -6870, -6991, -7114, -7235, -7356, -7477, -7598, -7719, -7840, 
-        -7961, -8080, -8201, -8322, -8441, -8562, -8682, -8803, -8922, -9043, -9162, -9281, 
-        -9400, -9519, -9639, -9758, -9877, -9996, -10115, -10235, -10354, -10471, -10590, -10709, 
-        -10827, -10946, -11063, -11181, -11300, -11417, -11535, -11652, -11769, -11887, -12004, -12121, 
-        -12239, -12356, -12473, -12591, -12706, -12824, -12939, -13056, -13172, -13289, -13405, -13520, 
-        -13638, -13753, -13869, -13984, -14100, -14215, -14331, -14446, -14562, -14677, -14791, -14907, 
-        -15022, -15136, -15251, -15365, -15479, -15594, -15708, -15822, -15937, -16051, -16164, -16278, 
-        -16392, -16505, -16619, -16731, -16845, -16958, -17072, -17184, -17298, -17409, -17523, -17635, 
-        -17749, -17860, -17972, -18084, -18198, -18310, -18422, -18533, -18645, -18757, -18869, -18979, 
-        -19091, -19203, -19313, -19425, -19536, -19646, -19758, -19868, -19978, -20090, -20200, -20310, 
-        -20420, -20530, -20640, -20750, -20860, -20970, -21080, -21190, -21300, -21408, -21518, -21628, 
-        -21737, -21847, -21955, -22063, -22173, -22281, -22389, -22499, -22608, -22716, -22824, -22932, 
-        -23040, -23149, -23257, -23363, -23471, -23579, -23688, -23794, -23902, -24008, -24117, -24223, 
-        -24329, -24438, -24544, -24650, -24757, -24865, -24971, -25077, -25184, -25290, -25396, -25501, 
-        -25607, -25714, -25820, -25925, -26031, -26135, -26242, -26346, -26453, -26557, -26662, -26768, 
-        -26873, -26977, -27082, -27186, -27291, -27395, -27500, -27604, -27709, -27813, -27916, -28020, 
-        -28125, -28228, -28332, -28435, -28539, -28642, -28746, -28849, -28952, -29054, -29159, -29262, 
-        -29364, -29467, -29570, -29672, -29775, -29876, -29979, -30081, -30184, -30285, -30388, -30490, 
-        -30591, -30692, -30795, -30895, -30998, -31099, -31200, -31301, -31401, -31502, -31603, -31704, 
-        -31805, -31906, -32007, -32107, -32206, -32307, -32408, -32509, -32608, -32712, -32767, -32315, 
-        -30791, -28316, -25413, -22400, -19421, -16535, -13772, -11139, -8636, -6261, -4008, -1873 
-    };
-
-    // AKWF_R_asym_saw_13 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_13[600] PROGMEM = {
-        812, 3070, 5185, 7168, 9024, 10760, 12388, 13912, 15338, 16673, 17917, 19082, 
-        20166, 21179, 22122, 23000, 23818, 24578, 25283, 25940, 26548, 27110, 27629, 28109, 
-        28552, 28960, 29334, 29678, 29992, 30277, 30538, 30774, 30986, 31179, 31349, 31500, 
-        31634, 31750, 31851, 31937, 32007, 32067, 32113, 32147, 32169, 32182, 32185, 32178, 
-        32163, 32142, 32111, 32073, 32027, 31977, 31920, 31859, 31790, 31717, 31641, 31559, 
-        31472, 31384, 31291, 31193, 31093, 30992, 30886, 30778, 30667, 30555, 30438, 30322, 
-        30203, 30081, 29960, 29834, 29709, 29582, 29454, 29325, 29194, 29062, 28929, 28795, 
-        28661, 28527, 28391, 28253, 28117, 27979, 27839, 27701, 27562, 27422, 27280, 27141, 
-        26999, 26858, 26716, 26575, 26432, 26290, 26147, 26003, 25862, 25719, 25575, 25432, 
-        25287, 25144, 25000, 24857, 24712, 24569, 24425, 24280, 24137, 23994, 23849, 23705, 
-        23562, 23417, 23274, 23130, 22985, 22842, 22699, 22555, 22410, 22267, 22124, 21980, 
-        21837, 21694, 21550, 21407, 21264, 21120, 20977, 20836, 20692, 20549, 20408, 20264, 
-        20123, 19980, 19838, 19695, 19553, 19412, 19270, 19129, 18987, 18846, 18704, 18563, 
-        18421, 18280, 18138, 17999, 17857, 17718, 17576, 17436, 17295, 17155, 17016, 16876, 
-        16734, 16595, 16455, 16315, 16178, 16038, 15898, 15759, 15621, 15481, 15343, 15204, 
-        15066, 14926, 14788, 14650, 14512, 14375, 14237, 14099, 13961, 13823, 13685, 13549, 
-        13411, 13275, 13138, 13001, 12864, 12728, 12592, 12454, 12318, 12182, 12046, 11910, 
-        11775, 11639, 11503, 11367, 11233, 11097, 10963, 10827, 10692, 10556, 10422, 10288, 
-        10154, 10019, 9885, 9751, 9617, 9483, 9348, 9216, 9082, 8947, 8815, 8681, 
-        8548, 8416, 8282, 8149, 8017, 7885, 7752, 7620, 7487, 7355, 7222, 7092, 
-        6959, 6827, 6696, 6564, 6433, 6303, 6170, 6040, 5909, 5779, 5648, 5517, 
-        5387, 5256, 5126, 4995, 4864, 4736, 4605, 4476, 4346, 4217, 4088, 3957, 
-        3829, 3700, 3571, 3442, 3313, 3185, 3056, 2927, 2798, 2671, 2543, 2414, 
-        2287, 2158, 2031, 1904, 1775, 1648, 1521, 1394, 1267, 1140, 1013, 886, 
-        761, 634, 507, 382, 255, 130, 3, -121, -248, -373, -498, -623, 
-        -749, -874, -999, -1124, -1249, -1374, -1500, -1625, -1748, -1873, -1997, -2122, 
-        -2245, -2370, -2494, -2617, -2740, -2864, -2987, -3110, -3234, -3357, -3480, -3604, 
-        -3727, -3849, -3972, -4095, -4217, -4340, -4462, -4583, -4707, -4828, -4950, -5071, 
-        -5193, -5314, -5436, -5557, -5679, -5800, -5922, -6042, -6163, -6283, -6404, -6524, 
-        -6646, -6765, -6885, -7007, -7126, -7246, -7366, -7485, -7605, -7725, -7845, -7962, 
-        -8082, -8202, -8320, -8440, -8559, -8677, -8795, -8915, -9033, -9151, -9269, -9388, 
-        -9506, -9624, -9742, -9860, -9976, -10094, -10212, -10330, -10446, -10564, -10680, -10798, 
-        -10914, -11032, -11148, -11264, -11382, -11498, -11614, -11730, -11846, -11962, -12078, -12194, 
-        -12309, -12425, -12541, -12655, -12771, -12887, -13001, -13116, -13232, -13346, -13460, -13577, 
-        -13691, -13805, -13919, -14034, -14148, -14262, -14376, -14489, -14603, -14717, -14830, -14944, 
-        -15057, -15171, -15283, -15398, -15510, -15623, -15735, -15849, -15962, -16074, -16187, -16299, 
-        -16412, -16522, -16635, -16747, -16860, -16970, -17083, -17193, -17306, -17417, -17529, -17640, 
-        -17750, -17863, -17973, -18084, -18195, -18305, -18416, -18527, -18637, -18748, -18857, -18967, 
-        -19078, -19187, -19298, -19406, -19517, -19626, -19736, -19845, -19954, -20065, -20174, -20282, 
-        -20391, -20500, -20609, -20718, -20827, -20934, -21042, -21151, -21260, -21367, -21476, -21583, 
-        -21692, -21799, -21906, -22015, -22122, -22229, -22336, -22445, -22552, -22659, -22766, -22873, 
-        -22978, -23085, -23192, -23299, -23404, -23511, -23618, -23723, -23830, -23936, -24041, -24148, 
-        -24253, -24358, -24463, -24571, -24676, -24781, -24886, -24991, -25097, -25200, -25305, -25410, 
-        -25516, -25619, -25724, -25828, -25933, -26036, -26141, -26245, -26350, -26453, -26557, -26660, 
-        -26764, -26867, -26972, -27076, -27177, -27280, -27384, -27487, -27591, -27692, -27796, -27899, 
-        -28001, -28104, -28206, -28309, -28411, -28512, -28615, -28717, -28819, -28920, -29022, -29123, 
-        -29225, -29327, -29428, -29530, -29631, -29733, -29833, -29934, -30036, -30136, -30237, -30337, 
-        -30438, -30538, -30638, -30740, -30839, -30939, -31039, -31139, -31238, -31338, -31438, -31536, 
-        -31636, -31735, -31835, -31935, -32035, -32133, -32232, -32332, -32430, -32530, -32626, -32731, 
-        -32767, -32118, -30070, -26880, -23290, -19691, -16219, -12925, -9822, -6903, -4164, -1596 
-    };
-
-    // AKWF_R_asym_saw_14 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_14[600] PROGMEM = {
-        603, 3302, 5800, 8109, 10246, 12221, 14045, 15730, 17286, 18725, 20053, 21276, 
-        22402, 23436, 24388, 25261, 26062, 26794, 27464, 28077, 28634, 29143, 29604, 30020, 
-        30399, 30738, 31042, 31315, 31558, 31773, 31960, 32124, 32267, 32389, 32491, 32575, 
-        32642, 32694, 32732, 32755, 32767, 32767, 32757, 32735, 32707, 32667, 32621, 32567, 
-        32507, 32441, 32367, 32289, 32207, 32119, 32026, 31930, 31830, 31726, 31619, 31510, 
-        31396, 31281, 31163, 31044, 30922, 30799, 30674, 30545, 30417, 30288, 30156, 30024, 
-        29892, 29756, 29622, 29484, 29349, 29211, 29072, 28932, 28793, 28654, 28513, 28373, 
-        28232, 28089, 27948, 27805, 27664, 27521, 27378, 27235, 27092, 26950, 26805, 26662, 
-        26519, 26374, 26231, 26087, 25944, 25801, 25656, 25513, 25369, 25226, 25081, 24938, 
-        24793, 24651, 24506, 24363, 24220, 24075, 23932, 23790, 23647, 23504, 23361, 23216, 
-        23073, 22932, 22789, 22646, 22503, 22360, 22218, 22076, 21934, 21792, 21650, 21508, 
-        21367, 21224, 21083, 20942, 20801, 20660, 20519, 20378, 20237, 20095, 19954, 19815, 
-        19674, 19535, 19393, 19254, 19113, 18974, 18834, 18695, 18554, 18415, 18275, 18138, 
-        17998, 17859, 17720, 17580, 17443, 17303, 17166, 17027, 16889, 16751, 16612, 16475, 
-        16337, 16200, 16062, 15924, 15787, 15651, 15514, 15376, 15240, 15103, 14967, 14829, 
-        14694, 14558, 14422, 14285, 14149, 14013, 13877, 13742, 13608, 13472, 13336, 13202, 
-        13066, 12931, 12797, 12663, 12527, 12393, 12259, 12125, 11991, 11857, 11723, 11589, 
-        11455, 11321, 11189, 11055, 10921, 10789, 10657, 10523, 10390, 10258, 10124, 9992, 
-        9860, 9728, 9596, 9463, 9331, 9201, 9069, 8936, 8806, 8674, 8543, 8411, 
-        8281, 8150, 8020, 7888, 7757, 7627, 7497, 7366, 7238, 7107, 6977, 6846, 
-        6718, 6587, 6459, 6328, 6200, 6071, 5941, 5812, 5684, 5555, 5426, 5298, 
-        5169, 5040, 4914, 4785, 4656, 4530, 4401, 4274, 4146, 4019, 3892, 3763, 
-        3636, 3510, 3383, 3256, 3129, 3002, 2877, 2750, 2624, 2497, 2372, 2245, 
-        2120, 1995, 1868, 1743, 1618, 1493, 1368, 1243, 1118, 993, 868, 743, 
-        618, 494, 369, 246, 121, -1, -126, -250, -373, -496, -621, -744, 
-        -868, -991, -1114, -1237, -1359, -1482, -1605, -1729, -1850, -1973, -2095, -2218, 
-        -2340, -2461, -2583, -2706, -2827, -2949, -3070, -3192, -3313, -3435, -3554, -3676, 
-        -3797, -3917, -4038, -4160, -4279, -4399, -4521, -4640, -4760, -4880, -5001, -5121, 
-        -5241, -5360, -5478, -5598, -5717, -5837, -5957, -6075, -6194, -6312, -6432, -6550, 
-        -6668, -6787, -6905, -7023, -7141, -7259, -7377, -7495, -7613, -7731, -7849, -7965, 
-        -8083, -8200, -8317, -8434, -8551, -8668, -8785, -8901, -9017, -9135, -9251, -9367, 
-        -9483, -9599, -9715, -9831, -9946, -10062, -10178, -10294, -10408, -10524, -10639, -10755, 
-        -10869, -10983, -11100, -11214, -11328, -11443, -11557, -11671, -11786, -11900, -12014, -12129, 
-        -12241, -12355, -12470, -12582, -12697, -12809, -12923, -13036, -13149, -13263, -13375, -13488, 
-        -13600, -13713, -13826, -13938, -14051, -14163, -14276, -14386, -14499, -14611, -14722, -14835, 
-        -14946, -15058, -15169, -15280, -15390, -15503, -15614, -15724, -15835, -15946, -16057, -16167, 
-        -16278, -16387, -16498, -16609, -16718, -16828, -16939, -17048, -17157, -17268, -17377, -17486, 
-        -17596, -17705, -17814, -17923, -18032, -18141, -18250, -18359, -18468, -18575, -18684, -18793, 
-        -18900, -19009, -19118, -19226, -19333, -19442, -19549, -19656, -19765, -19872, -19979, -20087, 
-        -20194, -20301, -20408, -20515, -20621, -20728, -20835, -20942, -21048, -21155, -21260, -21367, 
-        -21473, -21578, -21685, -21791, -21896, -22001, -22109, -22214, -22319, -22425, -22530, -22634, 
-        -22739, -22845, -22950, -23054, -23159, -23264, -23368, -23473, -23577, -23681, -23786, -23890, 
-        -23993, -24097, -24202, -24306, -24409, -24513, -24617, -24718, -24822, -24926, -25029, -25133, 
-        -25235, -25338, -25440, -25544, -25646, -25749, -25851, -25953, -26056, -26158, -26260, -26362, 
-        -26464, -26565, -26667, -26769, -26871, -26973, -27075, -27176, -27276, -27378, -27480, -27580, 
-        -27682, -27782, -27882, -27984, -28084, -28184, -28286, -28386, -28486, -28586, -28686, -28786, 
-        -28886, -28986, -29086, -29186, -29284, -29384, -29484, -29583, -29683, -29783, -29881, -29979, 
-        -30079, -30177, -30276, -30376, -30474, -30572, -30670, -30769, -30867, -30965, -31063, -31162, 
-        -31258, -31355, -31453, -31551, -31649, -31748, -31844, -31942, -32039, -32137, -32233, -32332, 
-        -32426, -32532, -32544, -31646, -28963, -24954, -20638, -16459, -12523, -8861, -5462, -2313 
-    };
-
-    // AKWF_R_asym_saw_15 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_15[600] PROGMEM = {
-        2459, 5449, 8172, 10653, 12912, 14967, 16837, 18534, 20076, 21480, 22756, 23911, 
-        24956, 25900, 26752, 27520, 28211, 28829, 29382, 29877, 30318, 30707, 31052, 31354, 
-        31620, 31849, 32047, 32215, 32358, 32474, 32570, 32643, 32698, 32736, 32759, 32767, 
-        32762, 32745, 32717, 32679, 32630, 32575, 32511, 32441, 32363, 32280, 32191, 32099, 
-        32000, 31900, 31794, 31684, 31571, 31457, 31339, 31219, 31098, 30973, 30848, 30719, 
-        30591, 30460, 30328, 30197, 30063, 29929, 29794, 29657, 29520, 29382, 29245, 29106, 
-        28967, 28829, 28688, 28549, 28409, 28268, 28127, 27987, 27846, 27705, 27563, 27422, 
-        27282, 27140, 26999, 26857, 26716, 26574, 26433, 26291, 26150, 26008, 25867, 25726, 
-        25584, 25443, 25303, 25161, 25020, 24879, 24739, 24598, 24457, 24317, 24176, 24036, 
-        23895, 23754, 23616, 23475, 23334, 23195, 23055, 22916, 22777, 22636, 22498, 22359, 
-        22220, 22081, 21942, 21803, 21664, 21525, 21387, 21249, 21111, 20973, 20835, 20697, 
-        20558, 20421, 20284, 20147, 20010, 19873, 19736, 19599, 19461, 19324, 19189, 19052, 
-        18915, 18779, 18644, 18507, 18371, 18236, 18099, 17963, 17828, 17692, 17559, 17423, 
-        17288, 17153, 17019, 16883, 16748, 16614, 16481, 16345, 16212, 16078, 15944, 15811, 
-        15677, 15543, 15410, 15276, 15142, 15009, 14877, 14743, 14611, 14477, 14345, 14214, 
-        14080, 13948, 13816, 13684, 13552, 13420, 13288, 13156, 13026, 12894, 12764, 12632, 
-        12500, 12370, 12240, 12108, 11978, 11847, 11717, 11587, 11457, 11327, 11196, 11066, 
-        10938, 10808, 10677, 10549, 10419, 10290, 10162, 10032, 9903, 9775, 9646, 9518, 
-        9389, 9261, 9132, 9004, 8877, 8749, 8620, 8494, 8365, 8238, 8110, 7983, 
-        7856, 7730, 7603, 7475, 7348, 7223, 7096, 6969, 6843, 6716, 6591, 6464, 
-        6339, 6213, 6088, 5963, 5836, 5711, 5586, 5461, 5336, 5211, 5086, 4961, 
-        4836, 4713, 4588, 4463, 4339, 4214, 4091, 3966, 3843, 3720, 3596, 3471, 
-        3348, 3225, 3102, 2980, 2857, 2734, 2610, 2487, 2366, 2242, 2121, 1998, 
-        1876, 1755, 1633, 1510, 1388, 1267, 1145, 1024, 902, 782, 661, 539, 
-        420, 298, 178, 57, -62, -184, -303, -423, -543, -663, -782, -904, 
-        -1024, -1142, -1262, -1381, -1501, -1621, -1739, -1859, -1977, -2097, -2215, -2333, 
-        -2452, -2570, -2689, -2807, -2925, -3043, -3161, -3279, -3397, -3513, -3631, -3749, 
-        -3865, -3984, -4102, -4218, -4334, -4452, -4569, -4685, -4801, -4917, -5034, -5150, 
-        -5266, -5383, -5499, -5615, -5730, -5846, -5963, -6077, -6193, -6308, -6423, -6539, 
-        -6653, -6768, -6883, -6997, -7112, -7226, -7341, -7455, -7570, -7685, -7797, -7912, 
-        -8027, -8139, -8254, -8367, -8481, -8594, -8707, -8820, -8934, -9047, -9160, -9273, 
-        -9386, -9497, -9610, -9723, -9835, -9947, -10059, -10172, -10283, -10396, -10507, -10618, 
-        -10731, -10842, -10953, -11065, -11176, -11287, -11398, -11509, -11620, -11731, -11842, -11952, 
-        -12063, -12174, -12283, -12394, -12504, -12615, -12724, -12833, -12943, -13054, -13163, -13273, 
-        -13382, -13491, -13601, -13710, -13818, -13927, -14036, -14146, -14253, -14363, -14470, -14580, 
-        -14687, -14795, -14904, -15012, -15120, -15227, -15335, -15443, -15550, -15658, -15766, -15873, 
-        -15981, -16087, -16194, -16302, -16408, -16515, -16621, -16727, -16835, -16941, -17047, -17153, 
-        -17260, -17366, -17472, -17578, -17684, -17790, -17894, -18000, -18106, -18211, -18316, -18422, 
-        -18527, -18632, -18736, -18842, -18946, -19050, -19156, -19260, -19364, -19468, -19572, -19677, 
-        -19781, -19885, -19989, -20093, -20196, -20300, -20404, -20506, -20611, -20713, -20817, -20920, 
-        -21022, -21126, -21229, -21331, -21433, -21536, -21638, -21741, -21843, -21946, -22048, -22150, 
-        -22253, -22353, -22456, -22558, -22659, -22761, -22862, -22963, -23065, -23166, -23267, -23369, 
-        -23470, -23570, -23671, -23772, -23872, -23973, -24074, -24173, -24273, -24374, -24475, -24574, 
-        -24674, -24773, -24874, -24973, -25074, -25173, -25272, -25372, -25471, -25570, -25669, -25768, 
-        -25867, -25966, -26065, -26164, -26263, -26360, -26459, -26558, -26655, -26754, -26853, -26950, 
-        -27049, -27146, -27244, -27343, -27440, -27537, -27634, -27731, -27829, -27926, -28023, -28120, 
-        -28218, -28315, -28412, -28507, -28605, -28702, -28797, -28895, -28990, -29087, -29183, -29280, 
-        -29375, -29471, -29568, -29664, -29759, -29855, -29950, -30046, -30141, -30236, -30332, -30426, 
-        -30521, -30615, -30709, -30804, -30900, -30993, -31089, -31183, -31278, -31372, -31467, -31561, 
-        -31656, -31747, -31851, -31835, -30637, -27230, -22360, -17352, -12663, -8353, -4416, -819 
-    };
-
-    // AKWF_R_asym_saw_16 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_16[600] PROGMEM = {
-        164, 3899, 7241, 10231, 12903, 15293, 17428, 19332, 21029, 22540, 23885, 25084, 
-        26151, 27098, 27933, 28670, 29317, 29885, 30381, 30811, 31184, 31504, 31778, 32009, 
-        32202, 32361, 32488, 32590, 32666, 32718, 32752, 32767, 32767, 32752, 32723, 32685, 
-        32634, 32573, 32505, 32429, 32346, 32258, 32163, 32063, 31958, 31851, 31739, 31624, 
-        31507, 31387, 31263, 31140, 31013, 30886, 30755, 30625, 30493, 30361, 30227, 30091, 
-        29957, 29820, 29685, 29547, 29410, 29271, 29134, 28995, 28856, 28717, 28579, 28440, 
-        28301, 28162, 28021, 27882, 27743, 27603, 27464, 27325, 27184, 27046, 26907, 26766, 
-        26627, 26488, 26349, 26211, 26070, 25931, 25792, 25653, 25514, 25377, 25238, 25099, 
-        24960, 24823, 24684, 24547, 24408, 24271, 24134, 23995, 23858, 23721, 23583, 23446, 
-        23309, 23172, 23035, 22899, 22762, 22625, 22489, 22352, 22216, 22081, 21944, 21808, 
-        21673, 21537, 21402, 21266, 21131, 20995, 20860, 20726, 20590, 20455, 20321, 20187, 
-        20052, 19918, 19784, 19650, 19516, 19383, 19249, 19115, 18981, 18847, 18713, 18581, 
-        18447, 18315, 18182, 18049, 17917, 17783, 17651, 17519, 17387, 17255, 17123, 16991, 
-        16860, 16728, 16596, 16466, 16334, 16203, 16071, 15941, 15810, 15680, 15548, 15417, 
-        15287, 15156, 15028, 14897, 14767, 14636, 14508, 14377, 14248, 14118, 13989, 13859, 
-        13730, 13601, 13473, 13344, 13215, 13086, 12958, 12829, 12702, 12573, 12444, 12317, 
-        12189, 12062, 11935, 11806, 11679, 11552, 11425, 11298, 11171, 11044, 10917, 10789, 
-        10664, 10537, 10410, 10285, 10158, 10032, 9907, 9780, 9655, 9529, 9404, 9279, 
-        9153, 9028, 8903, 8777, 8654, 8528, 8403, 8279, 8154, 8030, 7905, 7781, 
-        7658, 7534, 7410, 7287, 7163, 7039, 6916, 6792, 6668, 6546, 6423, 6299, 
-        6177, 6053, 5931, 5809, 5686, 5564, 5442, 5320, 5198, 5076, 4954, 4832, 
-        4710, 4590, 4468, 4346, 4226, 4104, 3983, 3863, 3741, 3621, 3501, 3380, 
-        3260, 3140, 3020, 2899, 2779, 2659, 2539, 2420, 2300, 2181, 2061, 1942, 
-        1822, 1704, 1585, 1466, 1346, 1228, 1109, 992, 874, 755, 636, 518, 
-        401, 282, 166, 47, -69, -186, -304, -421, -538, -655, -772, -889, 
-        -1006, -1123, -1239, -1356, -1471, -1588, -1705, -1820, -1937, -2052, -2169, -2285, 
-        -2400, -2515, -2632, -2747, -2862, -2977, -3093, -3206, -3321, -3436, -3552, -3665, 
-        -3780, -3895, -4009, -4122, -4238, -4351, -4465, -4580, -4693, -4807, -4920, -5034, 
-        -5147, -5261, -5372, -5486, -5599, -5713, -5825, -5938, -6050, -6164, -6275, -6387, 
-        -6499, -6612, -6724, -6836, -6948, -7060, -7171, -7283, -7393, -7505, -7617, -7729, 
-        -7839, -7951, -8061, -8172, -8283, -8393, -8504, -8615, -8725, -8835, -8945, -9055, 
-        -9165, -9275, -9385, -9494, -9604, -9714, -9822, -9932, -10041, -10151, -10259, -10369, 
-        -10478, -10586, -10695, -10805, -10913, -11022, -11130, -11238, -11345, -11453, -11562, -11670, 
-        -11777, -11885, -11992, -12101, -12207, -12316, -12422, -12529, -12637, -12744, -12851, -12958, 
-        -13064, -13171, -13278, -13384, -13491, -13596, -13703, -13810, -13915, -14021, -14126, -14233, 
-        -14338, -14445, -14550, -14655, -14760, -14865, -14970, -15075, -15180, -15285, -15390, -15495, 
-        -15600, -15703, -15808, -15913, -16017, -16122, -16225, -16330, -16433, -16537, -16640, -16745, 
-        -16848, -16952, -17055, -17158, -17262, -17365, -17468, -17570, -17673, -17777, -17878, -17982, 
-        -18085, -18187, -18290, -18392, -18493, -18597, -18698, -18800, -18901, -19003, -19105, -19206, 
-        -19308, -19410, -19511, -19613, -19713, -19814, -19916, -20016, -20118, -20218, -20319, -20419, 
-        -20519, -20621, -20721, -20821, -20921, -21020, -21120, -21220, -21320, -21420, -21520, -21620, 
-        -21720, -21818, -21918, -22018, -22116, -22216, -22315, -22413, -22513, -22611, -22709, -22808, 
-        -22907, -23006, -23104, -23202, -23300, -23399, -23495, -23593, -23692, -23790, -23888, -23985, 
-        -24083, -24180, -24278, -24374, -24473, -24569, -24666, -24762, -24860, -24957, -25054, -25150, 
-        -25247, -25343, -25440, -25536, -25631, -25728, -25824, -25921, -26016, -26112, -26207, -26304, 
-        -26399, -26495, -26590, -26685, -26781, -26876, -26971, -27066, -27161, -27256, -27350, -27445, 
-        -27540, -27635, -27728, -27823, -27918, -28013, -28106, -28201, -28294, -28389, -28482, -28575, 
-        -28670, -28763, -28856, -28950, -29044, -29138, -29231, -29324, -29417, -29508, -29602, -29695, 
-        -29788, -29881, -29973, -30064, -30156, -30247, -30342, -30433, -30527, -30616, -30709, -30801, 
-        -30894, -30986, -31079, -31165, -31272, -31219, -29647, -25370, -19540, -13827, -8652, -4000 
-    };
-
-    // AKWF_R_asym_saw_17 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_17[600] PROGMEM = {
-        523, 4846, 8637, 11953, 14855, 17388, 19602, 21532, 23215, 24677, 25946, 27047, 
-        28004, 28833, 29546, 30156, 30675, 31114, 31484, 31793, 32048, 32253, 32418, 32545, 
-        32640, 32706, 32748, 32767, 32766, 32749, 32718, 32671, 32615, 32547, 32471, 32388, 
-        32297, 32199, 32096, 31990, 31879, 31764, 31647, 31526, 31403, 31277, 31151, 31021, 
-        30892, 30761, 30629, 30494, 30362, 30227, 30091, 29955, 29819, 29683, 29546, 29410, 
-        29272, 29135, 28997, 28859, 28722, 28584, 28446, 28309, 28170, 28032, 27894, 27757, 
-        27619, 27481, 27344, 27206, 27069, 26931, 26793, 26657, 26520, 26382, 26246, 26108, 
-        25972, 25835, 25699, 25561, 25425, 25289, 25153, 25017, 24881, 24745, 24609, 24474, 
-        24339, 24203, 24067, 23933, 23797, 23663, 23528, 23394, 23258, 23124, 22989, 22855, 
-        22721, 22588, 22454, 22320, 22185, 22053, 21918, 21786, 21651, 21519, 21386, 21253, 
-        21121, 20988, 20855, 20723, 20590, 20458, 20325, 20194, 20061, 19930, 19798, 19667, 
-        19534, 19403, 19272, 19141, 19010, 18879, 18748, 18617, 18486, 18357, 18226, 18095, 
-        17965, 17834, 17705, 17576, 17446, 17315, 17186, 17057, 16927, 16798, 16669, 16541, 
-        16412, 16282, 16155, 16025, 15898, 15768, 15641, 15513, 15384, 15256, 15128, 15001, 
-        14873, 14745, 14618, 14492, 14364, 14236, 14110, 13983, 13857, 13729, 13603, 13477, 
-        13351, 13223, 13097, 12971, 12847, 12721, 12595, 12469, 12343, 12218, 12092, 11968, 
-        11842, 11718, 11593, 11467, 11343, 11218, 11094, 10970, 10845, 10721, 10597, 10474, 
-        10350, 10225, 10102, 9978, 9855, 9733, 9608, 9486, 9363, 9240, 9118, 8995, 
-        8872, 8749, 8627, 8506, 8383, 8260, 8139, 8017, 7896, 7773, 7652, 7531, 
-        7408, 7287, 7166, 7045, 6924, 6803, 6683, 6562, 6441, 6320, 6201, 6080, 
-        5960, 5841, 5720, 5601, 5481, 5360, 5241, 5121, 5002, 4883, 4763, 4646, 
-        4526, 4407, 4289, 4170, 4052, 3933, 3815, 3695, 3578, 3460, 3342, 3225, 
-        3107, 2989, 2871, 2754, 2636, 2518, 2402, 2284, 2168, 2051, 1935, 1817, 
-        1701, 1585, 1469, 1351, 1235, 1119, 1003, 887, 772, 656, 540, 426, 
-        310, 195, 79, -34, -150, -265, -379, -494, -610, -724, -839, -953, 
-        -1066, -1180, -1295, -1409, -1523, -1636, -1750, -1863, -1978, -2090, -2205, -2318, 
-        -2430, -2543, -2656, -2769, -2881, -2994, -3107, -3220, -3332, -3445, -3556, -3669, 
-        -3780, -3893, -4004, -4117, -4228, -4339, -4452, -4563, -4674, -4785, -4896, -5007, 
-        -5118, -5229, -5339, -5450, -5561, -5670, -5781, -5891, -6002, -6111, -6222, -6332, 
-        -6441, -6551, -6660, -6770, -6879, -6989, -7098, -7207, -7317, -7425, -7534, -7643, 
-        -7751, -7861, -7968, -8076, -8186, -8293, -8401, -8509, -8618, -8726, -8834, -8942, 
-        -9048, -9156, -9263, -9371, -9477, -9585, -9693, -9799, -9907, -10013, -10119, -10227, 
-        -10333, -10439, -10545, -10651, -10759, -10865, -10970, -11076, -11182, -11288, -11394, -11499, 
-        -11605, -11709, -11815, -11920, -12026, -12130, -12237, -12341, -12445, -12550, -12654, -12759, 
-        -12863, -12968, -13072, -13177, -13281, -13384, -13488, -13593, -13696, -13800, -13903, -14007, 
-        -14110, -14213, -14316, -14420, -14523, -14626, -14729, -14831, -14934, -15037, -15138, -15241, 
-        -15344, -15447, -15548, -15651, -15752, -15855, -15956, -16059, -16160, -16261, -16362, -16463, 
-        -16566, -16667, -16768, -16869, -16969, -17070, -17171, -17272, -17373, -17473, -17574, -17674, 
-        -17775, -17874, -17975, -18075, -18176, -18275, -18375, -18474, -18574, -18673, -18773, -18872, 
-        -18972, -19071, -19171, -19269, -19368, -19468, -19565, -19665, -19763, -19862, -19960, -20060, 
-        -20157, -20255, -20353, -20451, -20550, -20648, -20746, -20844, -20940, -21038, -21136, -21234, 
-        -21331, -21428, -21525, -21622, -21719, -21816, -21913, -22010, -22106, -22204, -22300, -22396, 
-        -22492, -22588, -22684, -22781, -22877, -22973, -23069, -23165, -23260, -23356, -23452, -23547, 
-        -23643, -23737, -23833, -23928, -24024, -24119, -24213, -24308, -24404, -24498, -24593, -24687, 
-        -24782, -24876, -24971, -25064, -25158, -25253, -25347, -25440, -25535, -25628, -25722, -25815, 
-        -25909, -26002, -26095, -26190, -26283, -26375, -26468, -26561, -26654, -26747, -26840, -26933, 
-        -27025, -27118, -27209, -27302, -27395, -27486, -27579, -27670, -27763, -27854, -27947, -28039, 
-        -28130, -28223, -28314, -28405, -28496, -28587, -28679, -28770, -28861, -28952, -29043, -29133, 
-        -29224, -29315, -29405, -29494, -29584, -29673, -29765, -29856, -29945, -30037, -30124, -30217, 
-        -30305, -30398, -30486, -30577, -30662, -30769, -30672, -28634, -23328, -16447, -10035, -4413 
-    };
-
-    // AKWF_R_asym_saw_18 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_18[600] PROGMEM = {
-        40, 5182, 9564, 13304, 16484, 19194, 21493, 23446, 25098, 26496, 27673, 28659, 
-        29488, 30186, 30767, 31246, 31636, 31950, 32199, 32393, 32540, 32644, 32714, 32753, 
-        32767, 32759, 32732, 32689, 32632, 32562, 32484, 32396, 32300, 32199, 32094, 31981, 
-        31866, 31747, 31627, 31501, 31376, 31247, 31119, 30988, 30857, 30723, 30590, 30456, 
-        30321, 30186, 30051, 29914, 29779, 29642, 29507, 29371, 29234, 29097, 28960, 28825, 
-        28689, 28552, 28415, 28278, 28143, 28007, 27870, 27735, 27598, 27463, 27328, 27191, 
-        27056, 26921, 26784, 26649, 26514, 26379, 26244, 26110, 25975, 25840, 25705, 25572, 
-        25437, 25303, 25168, 25035, 24901, 24768, 24634, 24501, 24367, 24234, 24100, 23967, 
-        23833, 23701, 23568, 23436, 23303, 23171, 23039, 22906, 22774, 22642, 22510, 22378, 
-        22246, 22116, 21984, 21852, 21722, 21590, 21460, 21328, 21198, 21066, 20936, 20806, 
-        20676, 20545, 20415, 20285, 20155, 20026, 19896, 19766, 19637, 19507, 19378, 19248, 
-        19120, 18991, 18862, 18734, 18605, 18477, 18348, 18220, 18091, 17964, 17835, 17708, 
-        17580, 17453, 17324, 17197, 17070, 16943, 16815, 16688, 16561, 16436, 16309, 16182, 
-        16055, 15929, 15802, 15677, 15550, 15425, 15299, 15173, 15047, 14922, 14797, 14671, 
-        14546, 14421, 14295, 14172, 14046, 13921, 13797, 13672, 13548, 13423, 13299, 13175, 
-        13052, 12928, 12804, 12681, 12557, 12433, 12309, 12186, 12064, 11940, 11818, 11694, 
-        11572, 11448, 11326, 11204, 11082, 10960, 10838, 10716, 10594, 10472, 10350, 10228, 
-        10107, 9985, 9865, 9743, 9622, 9502, 9380, 9259, 9139, 9018, 8898, 8777, 
-        8657, 8537, 8416, 8297, 8177, 8056, 7938, 7817, 7698, 7580, 7459, 7340, 
-        7221, 7103, 6984, 6865, 6746, 6627, 6509, 6390, 6272, 6154, 6036, 5918, 
-        5800, 5682, 5564, 5447, 5328, 5211, 5094, 4977, 4860, 4742, 4625, 4510, 
-        4393, 4275, 4160, 4043, 3927, 3810, 3694, 3579, 3462, 3346, 3230, 3115, 
-        2999, 2884, 2768, 2653, 2539, 2423, 2308, 2194, 2078, 1964, 1849, 1735, 
-        1621, 1505, 1391, 1277, 1163, 1049, 935, 821, 708, 595, 481, 367, 
-        255, 141, 29, -83, -196, -309, -421, -533, -646, -758, -870, -983, 
-        -1095, -1207, -1320, -1432, -1543, -1655, -1766, -1878, -1988, -2101, -2211, -2322, 
-        -2434, -2545, -2656, -2767, -2877, -2988, -3099, -3208, -3318, -3429, -3538, -3649, 
-        -3758, -3868, -3977, -4088, -4197, -4306, -4417, -4526, -4635, -4744, -4853, -4962, 
-        -5071, -5179, -5288, -5397, -5504, -5613, -5722, -5830, -5939, -6046, -6154, -6261, 
-        -6370, -6478, -6585, -6692, -6800, -6907, -7013, -7121, -7228, -7335, -7441, -7549, 
-        -7654, -7762, -7868, -7975, -8081, -8187, -8294, -8400, -8506, -8611, -8717, -8823, 
-        -8927, -9033, -9139, -9245, -9349, -9455, -9559, -9665, -9769, -9875, -9979, -10084, 
-        -10189, -10293, -10397, -10501, -10605, -10709, -10814, -10918, -11022, -11125, -11229, -11333, 
-        -11435, -11540, -11642, -11746, -11849, -11951, -12056, -12158, -12261, -12363, -12466, -12568, 
-        -12671, -12773, -12876, -12978, -13081, -13182, -13284, -13387, -13488, -13590, -13691, -13792, 
-        -13895, -13996, -14097, -14198, -14300, -14401, -14502, -14603, -14704, -14803, -14904, -15005, 
-        -15106, -15205, -15306, -15405, -15506, -15605, -15706, -15806, -15905, -16006, -16105, -16204, 
-        -16304, -16403, -16502, -16602, -16701, -16800, -16898, -16997, -17096, -17194, -17293, -17393, 
-        -17490, -17588, -17687, -17785, -17884, -17982, -18080, -18177, -18275, -18373, -18470, -18568, 
-        -18665, -18763, -18859, -18957, -19054, -19152, -19248, -19346, -19442, -19538, -19636, -19732, 
-        -19828, -19925, -20021, -20117, -20213, -20309, -20405, -20501, -20598, -20694, -20790, -20884, 
-        -20980, -21076, -21170, -21266, -21361, -21457, -21551, -21646, -21742, -21836, -21931, -22025, 
-        -22119, -22214, -22308, -22403, -22497, -22591, -22686, -22780, -22873, -22967, -23062, -23155, 
-        -23249, -23342, -23436, -23529, -23622, -23716, -23809, -23902, -23994, -24087, -24180, -24273, 
-        -24366, -24458, -24551, -24644, -24737, -24828, -24921, -25013, -25104, -25197, -25288, -25381, 
-        -25472, -25563, -25656, -25747, -25839, -25930, -26021, -26112, -26203, -26294, -26385, -26477, 
-        -26568, -26659, -26748, -26840, -26931, -27020, -27111, -27201, -27292, -27382, -27473, -27562, 
-        -27652, -27743, -27832, -27922, -28011, -28101, -28191, -28280, -28370, -28457, -28547, -28637, 
-        -28726, -28814, -28903, -28993, -29079, -29165, -29253, -29343, -29434, -29522, -29611, -29698, 
-        -29787, -29874, -29965, -30051, -30142, -30222, -30334, -30180, -27567, -21055, -13045, -5968 
-    };
-
-    // AKWF_R_asym_saw_19 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_19[600] PROGMEM = {
-        4689, 9921, 14229, 17788, 20713, 23122, 25092, 26707, 28022, 29092, 29955, 30645, 
-        31199, 31643, 31994, 32261, 32460, 32599, 32694, 32747, 32767, 32761, 32732, 32686, 
-        32623, 32546, 32462, 32365, 32263, 32156, 32042, 31925, 31803, 31680, 31555, 31427, 
-        31297, 31167, 31036, 30903, 30770, 30636, 30503, 30368, 30234, 30099, 29963, 29828, 
-        29692, 29558, 29422, 29287, 29151, 29016, 28882, 28746, 28611, 28476, 28342, 28207, 
-        28073, 27938, 27804, 27669, 27535, 27400, 27267, 27133, 27000, 26865, 26732, 26598, 
-        26465, 26332, 26199, 26066, 25933, 25800, 25667, 25534, 25401, 25270, 25137, 25006, 
-        24873, 24741, 24610, 24477, 24346, 24214, 24083, 23952, 23820, 23689, 23559, 23428, 
-        23297, 23167, 23035, 22906, 22776, 22645, 22515, 22385, 22255, 22126, 21996, 21866, 
-        21736, 21608, 21479, 21349, 21221, 21091, 20963, 20835, 20705, 20577, 20449, 20321, 
-        20192, 20064, 19936, 19808, 19680, 19553, 19425, 19299, 19170, 19044, 18916, 18789, 
-        18663, 18536, 18410, 18283, 18157, 18030, 17904, 17779, 17652, 17526, 17401, 17274, 
-        17149, 17023, 16898, 16773, 16648, 16523, 16398, 16273, 16148, 16023, 15898, 15775, 
-        15650, 15527, 15402, 15278, 15153, 15030, 14907, 14783, 14658, 14535, 14412, 14288, 
-        14167, 14043, 13920, 13797, 13675, 13552, 13430, 13307, 13185, 13063, 12940, 12818, 
-        12696, 12575, 12453, 12331, 12211, 12089, 11968, 11846, 11726, 11604, 11484, 11364, 
-        11242, 11122, 11002, 10882, 10760, 10641, 10521, 10401, 10281, 10161, 10041, 9922, 
-        9802, 9684, 9563, 9445, 9326, 9206, 9088, 8969, 8851, 8732, 8614, 8495, 
-        8377, 8260, 8141, 8023, 7906, 7787, 7669, 7552, 7435, 7316, 7199, 7082, 
-        6965, 6848, 6732, 6615, 6498, 6381, 6265, 6149, 6032, 5916, 5799, 5684, 
-        5569, 5452, 5336, 5221, 5106, 4990, 4875, 4760, 4644, 4529, 4414, 4299, 
-        4185, 4069, 3956, 3840, 3727, 3613, 3498, 3384, 3270, 3156, 3043, 2929, 
-        2815, 2702, 2588, 2474, 2362, 2248, 2136, 2022, 1909, 1797, 1685, 1571, 
-        1459, 1347, 1234, 1122, 1010, 898, 786, 674, 563, 451, 339, 229, 
-        116, 6, -104, -216, -326, -437, -547, -658, -768, -879, -989, -1100, 
-        -1210, -1321, -1430, -1540, -1651, -1760, -1870, -1979, -2090, -2199, -2308, -2416, 
-        -2527, -2636, -2745, -2852, -2961, -3070, -3179, -3288, -3395, -3504, -3613, -3720, 
-        -3828, -3937, -4044, -4153, -4260, -4367, -4475, -4582, -4689, -4797, -4904, -5011, 
-        -5119, -5226, -5332, -5439, -5545, -5652, -5758, -5865, -5971, -6078, -6184, -6289, 
-        -6395, -6501, -6607, -6712, -6818, -6924, -7029, -7134, -7239, -7345, -7449, -7555, 
-        -7659, -7763, -7869, -7973, -8077, -8183, -8287, -8391, -8495, -8599, -8703, -8807, 
-        -8910, -9014, -9118, -9221, -9325, -9427, -9531, -9634, -9738, -9840, -9943, -10047, 
-        -10150, -10252, -10355, -10457, -10560, -10662, -10765, -10867, -10968, -11071, -11173, -11274, 
-        -11377, -11477, -11580, -11681, -11782, -11883, -11985, -12086, -12187, -12288, -12389, -12490, 
-        -12591, -12692, -12792, -12892, -12993, -13094, -13193, -13294, -13393, -13494, -13593, -13693, 
-        -13794, -13893, -13992, -14091, -14191, -14290, -14389, -14489, -14588, -14687, -14785, -14884, 
-        -14984, -15081, -15181, -15278, -15378, -15475, -15573, -15672, -15770, -15868, -15965, -16063, 
-        -16161, -16259, -16356, -16454, -16552, -16649, -16745, -16843, -16941, -17037, -17135, -17231, 
-        -17329, -17425, -17521, -17618, -17715, -17811, -17907, -18003, -18099, -18195, -18291, -18387, 
-        -18483, -18579, -18674, -18770, -18866, -18961, -19057, -19151, -19246, -19342, -19436, -19531, 
-        -19627, -19721, -19816, -19910, -20005, -20099, -20194, -20288, -20383, -20476, -20570, -20665, 
-        -20758, -20852, -20947, -21040, -21134, -21227, -21320, -21413, -21507, -21600, -21693, -21786, 
-        -21879, -21972, -22065, -22158, -22251, -22344, -22435, -22528, -22621, -22712, -22805, -22896, 
-        -22989, -23080, -23173, -23264, -23356, -23447, -23540, -23631, -23723, -23814, -23905, -23996, 
-        -24088, -24179, -24269, -24360, -24451, -24541, -24632, -24724, -24813, -24905, -24994, -25084, 
-        -25175, -25265, -25355, -25444, -25536, -25625, -25715, -25805, -25895, -25984, -26072, -26162, 
-        -26252, -26341, -26429, -26519, -26609, -26697, -26787, -26875, -26963, -27053, -27141, -27229, 
-        -27318, -27407, -27495, -27583, -27671, -27759, -27847, -27935, -28023, -28110, -28198, -28286, 
-        -28372, -28460, -28549, -28635, -28720, -28805, -28891, -28981, -29071, -29156, -29244, -29329, 
-        -29418, -29502, -29593, -29676, -29766, -29841, -29961, -29734, -26413, -18498, -9297, -1617 
-    };
-
-    // AKWF_R_asym_saw_20 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_20[600] PROGMEM = {
-        3016, 9492, 14650, 18723, 21953, 24493, 26497, 28059, 29285, 30229, 30959, 31510, 
-        31921, 32224, 32450, 32608, 32704, 32755, 32767, 32749, 32706, 32644, 32568, 32480, 
-        32381, 32275, 32163, 32046, 31924, 31801, 31675, 31547, 31417, 31286, 31153, 31022, 
-        30890, 30755, 30621, 30488, 30354, 30220, 30086, 29951, 29817, 29683, 29549, 29414, 
-        29280, 29147, 29013, 28879, 28745, 28612, 28478, 28345, 28211, 28078, 27946, 27813, 
-        27680, 27548, 27415, 27282, 27150, 27017, 26886, 26753, 26620, 26489, 26358, 26226, 
-        26094, 25963, 25832, 25701, 25570, 25439, 25308, 25177, 25046, 24916, 24785, 24654, 
-        24525, 24395, 24264, 24134, 24005, 23875, 23746, 23616, 23487, 23357, 23228, 23100, 
-        22970, 22842, 22713, 22585, 22456, 22328, 22200, 22072, 21944, 21816, 21688, 21560, 
-        21432, 21304, 21178, 21050, 20924, 20796, 20669, 20541, 20415, 20289, 20162, 20036, 
-        19910, 19783, 19657, 19530, 19404, 19279, 19153, 19028, 18902, 18777, 18651, 18526, 
-        18401, 18276, 18152, 18027, 17902, 17777, 17653, 17528, 17405, 17280, 17157, 17032, 
-        16909, 16784, 16661, 16537, 16414, 16291, 16168, 16045, 15922, 15798, 15675, 15552, 
-        15430, 15307, 15186, 15064, 14941, 14819, 14697, 14574, 14453, 14331, 14209, 14088, 
-        13966, 13846, 13725, 13603, 13483, 13361, 13241, 13120, 13000, 12880, 12758, 12638, 
-        12518, 12398, 12278, 12158, 12038, 11919, 11799, 11679, 11561, 11441, 11322, 11202, 
-        11084, 10965, 10847, 10728, 10608, 10490, 10371, 10255, 10136, 10018, 9899, 9782, 
-        9664, 9545, 9429, 9312, 9193, 9076, 8959, 8843, 8726, 8609, 8492, 8375, 
-        8258, 8143, 8026, 7909, 7794, 7677, 7560, 7445, 7330, 7213, 7097, 6982, 
-        6867, 6751, 6636, 6521, 6406, 6290, 6177, 6061, 5946, 5832, 5717, 5603, 
-        5490, 5374, 5261, 5147, 5033, 4919, 4806, 4692, 4578, 4464, 4351, 4237, 
-        4125, 4011, 3899, 3785, 3673, 3561, 3447, 3335, 3223, 3111, 2999, 2887, 
-        2775, 2662, 2550, 2438, 2328, 2215, 2103, 1993, 1881, 1770, 1659, 1547, 
-        1437, 1326, 1216, 1105, 995, 884, 773, 663, 552, 443, 333, 224, 
-        113, 4, -104, -214, -323, -432, -541, -650, -759, -868, -977, -1086, 
-        -1195, -1304, -1411, -1520, -1629, -1737, -1846, -1953, -2062, -2170, -2277, -2384, 
-        -2493, -2601, -2708, -2814, -2921, -3029, -3136, -3244, -3349, -3457, -3564, -3670, 
-        -3776, -3883, -3989, -4096, -4202, -4308, -4414, -4520, -4626, -4731, -4837, -4943, 
-        -5049, -5155, -5259, -5365, -5471, -5575, -5679, -5785, -5889, -5995, -6099, -6203, 
-        -6308, -6412, -6516, -6620, -6725, -6829, -6933, -7036, -7140, -7244, -7347, -7451, 
-        -7554, -7656, -7761, -7863, -7966, -8070, -8173, -8276, -8378, -8481, -8584, -8686, 
-        -8787, -8890, -8993, -9094, -9196, -9299, -9400, -9501, -9604, -9705, -9806, -9909, 
-        -10010, -10111, -10212, -10313, -10414, -10515, -10616, -10717, -10817, -10918, -11019, -11119, 
-        -11220, -11319, -11420, -11520, -11619, -11719, -11820, -11919, -12019, -12118, -12218, -12317, 
-        -12417, -12516, -12614, -12714, -12813, -12913, -13011, -13110, -13208, -13308, -13406, -13503, 
-        -13603, -13701, -13799, -13897, -13995, -14093, -14190, -14288, -14386, -14484, -14581, -14679, 
-        -14776, -14873, -14971, -15067, -15165, -15261, -15358, -15456, -15552, -15648, -15745, -15841, 
-        -15937, -16034, -16130, -16226, -16323, -16419, -16514, -16610, -16706, -16801, -16898, -16992, 
-        -17089, -17183, -17278, -17375, -17469, -17564, -17659, -17754, -17848, -17943, -18038, -18133, 
-        -18227, -18321, -18415, -18510, -18603, -18698, -18793, -18886, -18979, -19074, -19167, -19260, 
-        -19355, -19448, -19542, -19635, -19728, -19821, -19914, -20007, -20099, -20192, -20285, -20379, 
-        -20470, -20563, -20655, -20748, -20840, -20933, -21025, -21116, -21209, -21301, -21393, -21484, 
-        -21576, -21667, -21759, -21851, -21942, -22034, -22124, -22215, -22305, -22397, -22489, -22579, 
-        -22670, -22760, -22852, -22942, -23032, -23122, -23214, -23304, -23394, -23484, -23574, -23664, 
-        -23752, -23842, -23932, -24022, -24112, -24201, -24291, -24381, -24469, -24559, -24648, -24736, 
-        -24826, -24915, -25003, -25092, -25180, -25270, -25358, -25447, -25534, -25622, -25711, -25799, 
-        -25888, -25974, -26063, -26151, -26238, -26327, -26414, -26502, -26589, -26677, -26764, -26851, 
-        -26938, -27026, -27113, -27200, -27287, -27374, -27461, -27548, -27633, -27720, -27807, -27893, 
-        -27979, -28066, -28151, -28238, -28323, -28407, -28490, -28576, -28664, -28753, -28836, -28925, 
-        -29005, -29095, -29178, -29268, -29348, -29440, -29509, -29639, -29320, -25126, -15585, -5164 
-    };
-
-    // AKWF_R_asym_saw_21 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_21[600] PROGMEM = {
-        7923, 14382, 19256, 22904, 25653, 27688, 29209, 30319, 31137, 31716, 32131, 32407, 
-        32580, 32686, 32747, 32767, 32747, 32699, 32630, 32546, 32449, 32343, 32229, 32110, 
-        31989, 31862, 31736, 31606, 31475, 31344, 31212, 31079, 30946, 30814, 30681, 30547, 
-        30414, 30280, 30147, 30015, 29880, 29748, 29615, 29482, 29348, 29216, 29083, 28950, 
-        28818, 28687, 28554, 28421, 28289, 28157, 28025, 27894, 27763, 27630, 27499, 27368, 
-        27237, 27106, 26975, 26843, 26714, 26583, 26452, 26322, 26191, 26062, 25932, 25801, 
-        25671, 25542, 25412, 25283, 25153, 25024, 24894, 24766, 24637, 24507, 24379, 24250, 
-        24122, 23994, 23864, 23736, 23608, 23480, 23352, 23224, 23096, 22968, 22842, 22714, 
-        22588, 22460, 22333, 22207, 22079, 21953, 21826, 21700, 21573, 21447, 21320, 21194, 
-        21068, 20943, 20816, 20692, 20565, 20440, 20314, 20189, 20064, 19939, 19813, 19688, 
-        19563, 19440, 19315, 19190, 19065, 18942, 18817, 18694, 18569, 18446, 18323, 18199, 
-        18074, 17951, 17828, 17706, 17583, 17460, 17336, 17213, 17091, 16968, 16846, 16723, 
-        16601, 16479, 16358, 16234, 16113, 15991, 15869, 15748, 15626, 15506, 15384, 15262, 
-        15142, 15022, 14900, 14780, 14658, 14538, 14418, 14298, 14178, 14057, 13937, 13817, 
-        13697, 13577, 13458, 13338, 13219, 13099, 12981, 12860, 12742, 12623, 12505, 12384, 
-        12266, 12147, 12030, 11912, 11793, 11674, 11557, 11439, 11322, 11203, 11086, 10967, 
-        10850, 10733, 10616, 10499, 10382, 10265, 10148, 10031, 9914, 9797, 9681, 9564, 
-        9449, 9332, 9216, 9101, 8984, 8868, 8753, 8637, 8522, 8406, 8291, 8176, 
-        8062, 7946, 7831, 7717, 7601, 7486, 7372, 7258, 7142, 7028, 6915, 6801, 
-        6687, 6573, 6459, 6345, 6231, 6119, 6005, 5891, 5778, 5664, 5552, 5438, 
-        5326, 5213, 5101, 4989, 4875, 4762, 4650, 4539, 4427, 4315, 4202, 4090, 
-        3979, 3867, 3756, 3645, 3533, 3422, 3311, 3199, 3088, 2977, 2866, 2756, 
-        2646, 2535, 2425, 2314, 2205, 2094, 1985, 1874, 1765, 1654, 1544, 1435, 
-        1324, 1215, 1106, 997, 889, 780, 671, 561, 452, 344, 235, 127, 
-        18, -88, -196, -304, -413, -521, -628, -736, -844, -951, -1059, -1167, 
-        -1273, -1381, -1488, -1594, -1702, -1808, -1916, -2022, -2130, -2236, -2342, -2448, 
-        -2554, -2660, -2766, -2873, -2979, -3085, -3191, -3295, -3402, -3506, -3612, -3717, 
-        -3823, -3928, -4032, -4138, -4243, -4347, -4452, -4556, -4661, -4766, -4870, -4975, 
-        -5079, -5182, -5287, -5390, -5494, -5597, -5702, -5805, -5908, -6013, -6116, -6219, 
-        -6322, -6425, -6528, -6631, -6734, -6837, -6938, -7041, -7144, -7245, -7348, -7450, 
-        -7551, -7654, -7756, -7857, -7960, -8062, -8163, -8264, -8366, -8467, -8569, -8670, 
-        -8770, -8872, -8971, -9073, -9174, -9274, -9376, -9475, -9575, -9677, -9777, -9877, 
-        -9976, -10076, -10176, -10276, -10376, -10476, -10576, -10676, -10774, -10874, -10974, -11072, 
-        -11172, -11270, -11369, -11468, -11567, -11665, -11763, -11862, -11962, -12060, -12158, -12255, 
-        -12353, -12452, -12550, -12647, -12745, -12843, -12940, -13038, -13135, -13232, -13330, -13427, 
-        -13524, -13622, -13719, -13816, -13912, -14007, -14104, -14201, -14298, -14395, -14490, -14586, 
-        -14683, -14778, -14875, -14970, -15067, -15162, -15258, -15353, -15449, -15545, -15640, -15735, 
-        -15830, -15925, -16021, -16114, -16209, -16305, -16400, -16494, -16589, -16682, -16778, -16871, 
-        -16966, -17060, -17154, -17249, -17342, -17436, -17530, -17623, -17717, -17811, -17904, -17996, 
-        -18090, -18184, -18277, -18369, -18463, -18555, -18649, -18741, -18834, -18927, -19019, -19111, 
-        -19204, -19296, -19388, -19481, -19573, -19665, -19757, -19847, -19939, -20031, -20123, -20214, 
-        -20306, -20397, -20489, -20579, -20671, -20762, -20852, -20944, -21035, -21125, -21216, -21306, 
-        -21397, -21487, -21578, -21668, -21759, -21848, -21938, -22029, -22118, -22208, -22297, -22388, 
-        -22477, -22567, -22656, -22745, -22836, -22925, -23014, -23103, -23192, -23281, -23370, -23459, 
-        -23547, -23635, -23724, -23813, -23902, -23989, -24078, -24165, -24254, -24342, -24431, -24518, 
-        -24606, -24693, -24782, -24869, -24957, -25044, -25131, -25219, -25306, -25394, -25481, -25567, 
-        -25654, -25742, -25827, -25915, -26001, -26088, -26174, -26261, -26347, -26433, -26520, -26606, 
-        -26692, -26778, -26864, -26950, -27035, -27121, -27207, -27293, -27379, -27463, -27549, -27635, 
-        -27719, -27805, -27891, -27975, -28059, -28142, -28223, -28307, -28396, -28484, -28566, -28654, 
-        -28732, -28822, -28902, -28994, -29070, -29163, -29226, -29370, -28933, -23658, -12239, -597 
-    };
-
-    // AKWF_R_asym_saw_22 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_22[600] PROGMEM = {
-        4457, 13069, 19247, 23574, 26600, 28722, 30171, 31175, 31831, 32273, 32537, 32695, 
-        32761, 32767, 32740, 32700, 32638, 32551, 32452, 32344, 32228, 32106, 31981, 31853, 
-        31725, 31594, 31462, 31331, 31198, 31065, 30932, 30801, 30668, 30535, 30403, 30270, 
-        30139, 30006, 29874, 29742, 29610, 29477, 29346, 29215, 29084, 28951, 28819, 28688, 
-        28557, 28427, 28296, 28164, 28033, 27903, 27772, 27642, 27511, 27381, 27252, 27122, 
-        26992, 26862, 26733, 26603, 26473, 26345, 26215, 26085, 25957, 25827, 25699, 25571, 
-        25443, 25313, 25185, 25057, 24928, 24800, 24674, 24545, 24417, 24291, 24162, 24034, 
-        23907, 23781, 23654, 23526, 23399, 23273, 23146, 23019, 22893, 22768, 22641, 22514, 
-        22389, 22262, 22137, 22012, 21886, 21760, 21635, 21510, 21385, 21260, 21135, 21010, 
-        20885, 20761, 20636, 20511, 20387, 20264, 20139, 20015, 19890, 19766, 19643, 19519, 
-        19396, 19272, 19150, 19026, 18903, 18779, 18657, 18534, 18412, 18290, 18166, 18044, 
-        17922, 17800, 17678, 17556, 17434, 17312, 17190, 17069, 16947, 16827, 16705, 16584, 
-        16462, 16342, 16221, 16101, 15979, 15858, 15738, 15617, 15498, 15378, 15257, 15137, 
-        15018, 14898, 14779, 14660, 14539, 14420, 14301, 14182, 14063, 13945, 13826, 13707, 
-        13588, 13469, 13350, 13232, 13113, 12996, 12877, 12760, 12642, 12523, 12406, 12289, 
-        12171, 12054, 11936, 11819, 11703, 11586, 11468, 11353, 11235, 11119, 11002, 10886, 
-        10770, 10653, 10537, 10421, 10305, 10189, 10074, 9958, 9843, 9728, 9612, 9496, 
-        9382, 9266, 9151, 9037, 8921, 8807, 8693, 8578, 8464, 8350, 8236, 8123, 
-        8008, 7894, 7780, 7667, 7553, 7438, 7326, 7213, 7099, 6986, 6873, 6760, 
-        6648, 6535, 6422, 6309, 6197, 6084, 5973, 5860, 5747, 5636, 5523, 5412, 
-        5301, 5189, 5077, 4966, 4854, 4743, 4632, 4521, 4409, 4300, 4189, 4077, 
-        3966, 3856, 3745, 3636, 3526, 3415, 3305, 3195, 3086, 2976, 2866, 2757, 
-        2647, 2537, 2428, 2318, 2210, 2100, 1992, 1882, 1774, 1665, 1556, 1448, 
-        1340, 1231, 1122, 1014, 908, 800, 692, 583, 475, 369, 261, 154, 
-        46, -60, -166, -274, -381, -488, -594, -701, -807, -914, -1021, -1127, 
-        -1234, -1339, -1445, -1550, -1657, -1763, -1869, -1975, -2080, -2185, -2292, -2397, 
-        -2502, -2607, -2712, -2817, -2920, -3025, -3130, -3236, -3339, -3444, -3549, -3653, 
-        -3756, -3861, -3965, -4068, -4173, -4277, -4380, -4484, -4587, -4691, -4794, -4896, 
-        -5000, -5103, -5206, -5308, -5412, -5514, -5617, -5719, -5821, -5925, -6027, -6129, 
-        -6231, -6333, -6434, -6536, -6638, -6739, -6841, -6943, -7045, -7145, -7247, -7347, 
-        -7449, -7550, -7650, -7752, -7852, -7953, -8053, -8154, -8254, -8354, -8455, -8555, 
-        -8656, -8755, -8855, -8954, -9054, -9155, -9253, -9352, -9453, -9552, -9650, -9751, 
-        -9850, -9949, -10047, -10146, -10245, -10342, -10441, -10540, -10639, -10738, -10835, -10934, 
-        -11031, -11130, -11227, -11325, -11422, -11521, -11618, -11716, -11813, -11910, -12008, -12105, 
-        -12202, -12299, -12395, -12493, -12590, -12686, -12783, -12879, -12976, -13072, -13169, -13265, 
-        -13361, -13456, -13554, -13649, -13745, -13841, -13935, -14031, -14127, -14223, -14318, -14413, 
-        -14508, -14603, -14698, -14793, -14888, -14983, -15077, -15173, -15267, -15361, -15455, -15549, 
-        -15644, -15738, -15832, -15926, -16021, -16113, -16207, -16302, -16394, -16489, -16581, -16675, 
-        -16768, -16861, -16955, -17048, -17140, -17233, -17327, -17420, -17513, -17604, -17696, -17789, 
-        -17882, -17974, -18066, -18158, -18251, -18342, -18435, -18526, -18617, -18708, -18801, -18892, 
-        -18983, -19076, -19167, -19258, -19349, -19440, -19530, -19621, -19712, -19803, -19893, -19984, 
-        -20075, -20165, -20256, -20346, -20437, -20526, -20616, -20707, -20797, -20886, -20976, -21065, 
-        -21155, -21244, -21334, -21424, -21513, -21603, -21691, -21780, -21869, -21958, -22046, -22136, 
-        -22225, -22313, -22401, -22491, -22579, -22667, -22755, -22843, -22931, -23019, -23107, -23195, 
-        -23283, -23371, -23460, -23546, -23634, -23722, -23809, -23897, -23983, -24071, -24158, -24246, 
-        -24332, -24419, -24505, -24592, -24678, -24765, -24853, -24939, -25024, -25111, -25197, -25284, 
-        -25370, -25455, -25542, -25627, -25713, -25800, -25885, -25970, -26056, -26141, -26226, -26312, 
-        -26397, -26482, -26567, -26652, -26737, -26822, -26907, -26992, -27077, -27160, -27245, -27330, 
-        -27414, -27499, -27582, -27667, -27751, -27835, -27916, -27996, -28080, -28168, -28256, -28336, 
-        -28424, -28498, -28591, -28666, -28761, -28833, -28929, -28985, -29147, -28557, -21927, -8342 
-    };
-
-    // AKWF_R_asym_saw_23 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_23[600] PROGMEM = {
-        10053, 18352, 23880, 27350, 29570, 30967, 31808, 32324, 32589, 32737, 32767, 32757, 
-        32691, 32602, 32506, 32419, 32321, 32208, 32090, 31967, 31840, 31710, 31580, 31450, 
-        31318, 31187, 31054, 30923, 30791, 30660, 30528, 30397, 30265, 30134, 30002, 29871, 
-        29741, 29609, 29480, 29348, 29218, 29087, 28957, 28827, 28697, 28567, 28436, 28306, 
-        28177, 28047, 27917, 27787, 27659, 27529, 27401, 27271, 27142, 27014, 26886, 26756, 
-        26627, 26500, 26372, 26244, 26115, 25988, 25860, 25731, 25605, 25478, 25349, 25222, 
-        25096, 24969, 24842, 24715, 24588, 24461, 24334, 24209, 24082, 23955, 23830, 23703, 
-        23578, 23452, 23327, 23200, 23075, 22949, 22824, 22700, 22575, 22450, 22324, 22199, 
-        22075, 21951, 21826, 21702, 21578, 21455, 21331, 21205, 21082, 20958, 20835, 20712, 
-        20588, 20466, 20342, 20218, 20096, 19973, 19850, 19727, 19605, 19483, 19359, 19237, 
-        19114, 18994, 18871, 18749, 18628, 18506, 18385, 18263, 18142, 18020, 17899, 17778, 
-        17658, 17537, 17416, 17295, 17175, 17054, 16935, 16814, 16693, 16574, 16453, 16334, 
-        16215, 16094, 15975, 15855, 15736, 15617, 15498, 15378, 15259, 15142, 15022, 14903, 
-        14785, 14668, 14548, 14431, 14313, 14194, 14076, 13958, 13841, 13723, 13605, 13488, 
-        13370, 13254, 13136, 13018, 12902, 12786, 12668, 12552, 12434, 12318, 12202, 12086, 
-        11970, 11854, 11737, 11621, 11507, 11390, 11274, 11160, 11043, 10929, 10814, 10698, 
-        10583, 10469, 10354, 10239, 10125, 10010, 9895, 9781, 9666, 9553, 9438, 9324, 
-        9211, 9096, 8983, 8870, 8757, 8642, 8529, 8416, 8303, 8191, 8078, 7965, 
-        7852, 7739, 7627, 7514, 7402, 7289, 7178, 7065, 6953, 6841, 6730, 6618, 
-        6505, 6394, 6283, 6172, 6060, 5949, 5839, 5727, 5617, 5505, 5395, 5284, 
-        5174, 5064, 4954, 4844, 4733, 4623, 4512, 4403, 4293, 4183, 4075, 3965, 
-        3855, 3746, 3636, 3527, 3419, 3309, 3200, 3092, 2983, 2875, 2766, 2658, 
-        2549, 2441, 2334, 2225, 2117, 2010, 1901, 1794, 1686, 1579, 1472, 1363, 
-        1256, 1149, 1042, 935, 828, 723, 616, 509, 402, 296, 189, 84, 
-        -22, -128, -233, -339, -444, -550, -657, -762, -868, -972, -1077, -1183, 
-        -1288, -1394, -1498, -1603, -1707, -1812, -1916, -2022, -2126, -2230, -2335, -2439, 
-        -2543, -2647, -2751, -2853, -2957, -3061, -3165, -3268, -3372, -3475, -3578, -3680, 
-        -3784, -3887, -3989, -4093, -4195, -4298, -4400, -4503, -4605, -4708, -4810, -4912, 
-        -5013, -5116, -5218, -5319, -5421, -5522, -5623, -5726, -5826, -5927, -6030, -6131, 
-        -6231, -6332, -6433, -6533, -6634, -6734, -6835, -6935, -7036, -7136, -7236, -7335, 
-        -7436, -7535, -7635, -7736, -7835, -7934, -8034, -8133, -8232, -8332, -8431, -8530, 
-        -8628, -8728, -8827, -8925, -9024, -9122, -9221, -9319, -9417, -9515, -9614, -9712, 
-        -9810, -9908, -10006, -10103, -10201, -10299, -10395, -10493, -10591, -10689, -10785, -10883, 
-        -10979, -11077, -11173, -11270, -11366, -11462, -11559, -11656, -11753, -11849, -11945, -12042, 
-        -12138, -12233, -12329, -12425, -12520, -12616, -12711, -12807, -12902, -12998, -13093, -13188, 
-        -13283, -13379, -13474, -13569, -13663, -13757, -13851, -13946, -14041, -14136, -14229, -14324, 
-        -14417, -14512, -14607, -14700, -14793, -14888, -14981, -15074, -15168, -15261, -15356, -15449, 
-        -15540, -15634, -15727, -15820, -15913, -16005, -16098, -16192, -16283, -16377, -16468, -16562, 
-        -16653, -16745, -16838, -16930, -17022, -17113, -17205, -17297, -17389, -17480, -17572, -17664, 
-        -17754, -17846, -17937, -18027, -18119, -18211, -18301, -18391, -18483, -18573, -18663, -18754, 
-        -18844, -18935, -19026, -19116, -19206, -19296, -19385, -19475, -19565, -19655, -19744, -19834, 
-        -19924, -20013, -20103, -20192, -20281, -20371, -20459, -20548, -20637, -20725, -20814, -20903, 
-        -20991, -21080, -21169, -21257, -21346, -21435, -21522, -21610, -21698, -21786, -21873, -21962, 
-        -22051, -22138, -22225, -22314, -22401, -22488, -22575, -22662, -22749, -22836, -22923, -23011, 
-        -23096, -23183, -23270, -23358, -23445, -23530, -23617, -23703, -23790, -23876, -23963, -24049, 
-        -24134, -24220, -24305, -24391, -24477, -24564, -24649, -24735, -24819, -24905, -24990, -25076, 
-        -25161, -25245, -25331, -25415, -25501, -25585, -25670, -25754, -25840, -25924, -26008, -26092, 
-        -26176, -26262, -26346, -26430, -26514, -26598, -26681, -26765, -26849, -26933, -27015, -27100, 
-        -27182, -27266, -27350, -27433, -27515, -27599, -27677, -27757, -27841, -27928, -28017, -28093, 
-        -28183, -28254, -28350, -28419, -28518, -28584, -28685, -28729, -28917, -28125, -19778, -3709 
-    };
-
-    // AKWF_R_asym_saw_24 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_24[600] PROGMEM = {
-        1915, 16240, 23610, 28023, 30335, 31646, 32315, 32628, 32767, 32760, 32731, 32630, 
-        32540, 32413, 32288, 32170, 32073, 31967, 31846, 31723, 31594, 31466, 31335, 31205, 
-        31075, 30943, 30813, 30681, 30551, 30421, 30291, 30161, 30029, 29900, 29770, 29640, 
-        29510, 29381, 29251, 29122, 28992, 28863, 28735, 28604, 28476, 28347, 28218, 28090, 
-        27961, 27832, 27704, 27576, 27448, 27319, 27192, 27063, 26936, 26809, 26682, 26553, 
-        26426, 26300, 26173, 26046, 25919, 25792, 25666, 25539, 25413, 25286, 25160, 25035, 
-        24909, 24782, 24656, 24530, 24405, 24279, 24155, 24029, 23904, 23780, 23654, 23530, 
-        23404, 23280, 23156, 23032, 22906, 22782, 22658, 22535, 22411, 22287, 22163, 22039, 
-        21916, 21792, 21669, 21547, 21424, 21301, 21177, 21055, 20932, 20809, 20687, 20566, 
-        20443, 20320, 20198, 20077, 19954, 19833, 19712, 19589, 19468, 19347, 19226, 19105, 
-        18984, 18862, 18741, 18622, 18501, 18380, 18260, 18139, 18019, 17898, 17779, 17659, 
-        17539, 17418, 17299, 17179, 17061, 16941, 16822, 16704, 16584, 16464, 16346, 16228, 
-        16109, 15991, 15873, 15754, 15635, 15517, 15399, 15282, 15164, 15046, 14928, 14810, 
-        14693, 14577, 14459, 14342, 14225, 14107, 13991, 13874, 13758, 13641, 13525, 13408, 
-        13291, 13175, 13060, 12943, 12828, 12712, 12597, 12481, 12365, 12250, 12135, 12020, 
-        11903, 11790, 11675, 11560, 11444, 11329, 11216, 11101, 10987, 10872, 10759, 10644, 
-        10530, 10417, 10303, 10189, 10076, 9962, 9849, 9735, 9622, 9510, 9396, 9283, 
-        9171, 9057, 8945, 8831, 8719, 8607, 8495, 8383, 8271, 8159, 8047, 7937, 
-        7825, 7713, 7601, 7490, 7378, 7268, 7156, 7045, 6933, 6823, 6712, 6602, 
-        6491, 6381, 6270, 6159, 6049, 5940, 5829, 5719, 5610, 5499, 5390, 5280, 
-        5171, 5062, 4953, 4844, 4735, 4626, 4515, 4406, 4299, 4190, 4081, 3973, 
-        3864, 3755, 3648, 3539, 3431, 3324, 3217, 3109, 3000, 2893, 2785, 2678, 
-        2570, 2464, 2357, 2249, 2142, 2036, 1928, 1822, 1716, 1609, 1503, 1395, 
-        1289, 1183, 1077, 971, 865, 761, 655, 549, 443, 337, 233, 128, 
-        22, -81, -187, -292, -396, -501, -605, -710, -814, -918, -1023, -1127, 
-        -1230, -1335, -1439, -1542, -1647, -1751, -1854, -1957, -2061, -2164, -2267, -2372, 
-        -2475, -2578, -2681, -2784, -2885, -2988, -3091, -3192, -3295, -3398, -3500, -3603, 
-        -3704, -3805, -3908, -4010, -4111, -4213, -4316, -4417, -4518, -4618, -4720, -4821, 
-        -4923, -5023, -5124, -5225, -5325, -5427, -5527, -5627, -5728, -5828, -5928, -6028, 
-        -6129, -6229, -6328, -6427, -6527, -6627, -6727, -6826, -6926, -7024, -7124, -7224, 
-        -7322, -7421, -7519, -7619, -7717, -7816, -7914, -8012, -8111, -8209, -8308, -8406, 
-        -8504, -8601, -8700, -8797, -8895, -8992, -9090, -9187, -9286, -9383, -9479, -9576, 
-        -9675, -9772, -9869, -9965, -10062, -10158, -10255, -10351, -10448, -10544, -10641, -10736, 
-        -10833, -10928, -11025, -11120, -11216, -11311, -11407, -11504, -11599, -11694, -11790, -11885, 
-        -11980, -12074, -12170, -12265, -12359, -12454, -12550, -12643, -12737, -12833, -12927, -13022, 
-        -13116, -13210, -13304, -13397, -13491, -13585, -13679, -13773, -13865, -13959, -14053, -14147, 
-        -14239, -14333, -14425, -14519, -14612, -14705, -14798, -14890, -14982, -15075, -15167, -15259, 
-        -15353, -15444, -15536, -15629, -15721, -15812, -15904, -15997, -16088, -16180, -16271, -16363, 
-        -16454, -16546, -16637, -16728, -16819, -16910, -17002, -17093, -17184, -17273, -17364, -17455, 
-        -17545, -17635, -17726, -17816, -17906, -17997, -18087, -18177, -18266, -18355, -18446, -18535, 
-        -18625, -18714, -18805, -18894, -18984, -19071, -19161, -19250, -19339, -19429, -19516, -19606, 
-        -19695, -19783, -19872, -19960, -20048, -20137, -20225, -20313, -20401, -20490, -20576, -20664, 
-        -20753, -20841, -20927, -21015, -21103, -21191, -21279, -21365, -21453, -21539, -21627, -21713, 
-        -21801, -21887, -21975, -22061, -22148, -22234, -22322, -22408, -22494, -22581, -22667, -22752, 
-        -22838, -22924, -23011, -23097, -23182, -23268, -23353, -23439, -23524, -23610, -23695, -23781, 
-        -23866, -23951, -24035, -24120, -24205, -24290, -24376, -24461, -24546, -24629, -24714, -24798, 
-        -24883, -24966, -25051, -25135, -25219, -25304, -25387, -25471, -25555, -25639, -25722, -25807, 
-        -25890, -25973, -26056, -26140, -26223, -26306, -26390, -26473, -26555, -26638, -26721, -26803, 
-        -26886, -26969, -27051, -27134, -27216, -27299, -27381, -27457, -27536, -27619, -27708, -27796, 
-        -27870, -27961, -28025, -28127, -28188, -28297, -28350, -28461, -28488, -28718, -27641, -17032 
-    };
-
-} // namespace AKWF_BwSawrounded
@@ -1,1304 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwSawrounded {
-
-    // AKWF_R_asym_saw_25 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_25[600] PROGMEM = {
-        8993, 22988, 28439, 31220, 32190, 32678, 32767, 32751, 32681, 32547, 32454, 32303, 
-        32202, 32052, 31925, 31802, 31715, 31605, 31484, 31358, 31231, 31102, 30971, 30842, 
-        30712, 30583, 30452, 30323, 30193, 30064, 29935, 29806, 29677, 29548, 29419, 29292, 
-        29163, 29034, 28906, 28777, 28650, 28522, 28394, 28266, 28139, 28011, 27884, 27756, 
-        27629, 27501, 27374, 27248, 27120, 26993, 26867, 26740, 26614, 26488, 26362, 26236, 
-        26110, 25984, 25858, 25732, 25606, 25482, 25356, 25231, 25105, 24981, 24856, 24732, 
-        24606, 24481, 24357, 24232, 24108, 23984, 23861, 23736, 23612, 23489, 23364, 23241, 
-        23117, 22994, 22871, 22748, 22625, 22502, 22379, 22256, 22133, 22010, 21889, 21766, 
-        21643, 21521, 21400, 21279, 21157, 21034, 20913, 20791, 20670, 20548, 20427, 20307, 
-        20185, 20064, 19944, 19823, 19703, 19581, 19461, 19341, 19220, 19100, 18980, 18860, 
-        18740, 18620, 18502, 18382, 18263, 18143, 18023, 17905, 17785, 17666, 17548, 17429, 
-        17309, 17191, 17073, 16956, 16837, 16719, 16602, 16483, 16365, 16248, 16129, 16012, 
-        15894, 15777, 15660, 15543, 15426, 15309, 15192, 15075, 14958, 14841, 14726, 14609, 
-        14493, 14376, 14261, 14146, 14030, 13913, 13798, 13682, 13567, 13451, 13336, 13220, 
-        13105, 12991, 12875, 12760, 12646, 12532, 12417, 12303, 12189, 12073, 11959, 11845, 
-        11731, 11617, 11503, 11391, 11277, 11163, 11051, 10937, 10823, 10710, 10598, 10484, 
-        10371, 10259, 10146, 10034, 9922, 9809, 9697, 9584, 9473, 9361, 9248, 9136, 
-        9025, 8914, 8801, 8690, 8579, 8469, 8358, 8247, 8136, 8025, 7914, 7803, 
-        7693, 7582, 7471, 7360, 7251, 7140, 7031, 6921, 6810, 6701, 6591, 6482, 
-        6372, 6263, 6153, 6044, 5936, 5826, 5717, 5609, 5500, 5392, 5282, 5174, 
-        5066, 4957, 4849, 4741, 4633, 4525, 4417, 4309, 4201, 4095, 3987, 3879, 
-        3772, 3664, 3558, 3450, 3343, 3237, 3130, 3024, 2916, 2810, 2703, 2597, 
-        2492, 2385, 2279, 2172, 2067, 1961, 1856, 1751, 1644, 1539, 1433, 1328, 
-        1223, 1118, 1013, 908, 803, 698, 595, 490, 385, 280, 176, 71, 
-        -31, -134, -238, -343, -446, -550, -653, -757, -860, -964, -1067, -1169, 
-        -1273, -1376, -1478, -1581, -1683, -1787, -1890, -1992, -2094, -2196, -2300, -2402, 
-        -2504, -2606, -2708, -2810, -2910, -3012, -3114, -3216, -3316, -3418, -3519, -3621, 
-        -3721, -3822, -3922, -4024, -4125, -4225, -4327, -4427, -4526, -4627, -4727, -4828, 
-        -4927, -5027, -5128, -5227, -5327, -5426, -5527, -5626, -5724, -5823, -5924, -6023, 
-        -6122, -6221, -6318, -6417, -6516, -6615, -6714, -6813, -6911, -7010, -7107, -7204, 
-        -7303, -7401, -7498, -7596, -7695, -7792, -7890, -7987, -8085, -8182, -8280, -8376, 
-        -8473, -8570, -8666, -8764, -8860, -8957, -9055, -9151, -9247, -9343, -9439, -9536, 
-        -9632, -9728, -9824, -9920, -10016, -10112, -10206, -10302, -10398, -10493, -10589, -10683, 
-        -10779, -10874, -10970, -11064, -11159, -11253, -11348, -11442, -11538, -11632, -11727, -11821, 
-        -11914, -12009, -12103, -12196, -12291, -12384, -12478, -12571, -12666, -12759, -12853, -12946, 
-        -13039, -13132, -13225, -13319, -13411, -13504, -13597, -13690, -13781, -13874, -13967, -14060, 
-        -14152, -14245, -14336, -14429, -14520, -14612, -14705, -14796, -14888, -14979, -15071, -15162, 
-        -15254, -15345, -15437, -15527, -15618, -15709, -15801, -15891, -15982, -16072, -16164, -16254, 
-        -16344, -16435, -16525, -16615, -16705, -16797, -16887, -16977, -17067, -17155, -17245, -17335, 
-        -17425, -17513, -17603, -17693, -17782, -17872, -17960, -18050, -18139, -18227, -18316, -18404, 
-        -18494, -18582, -18671, -18759, -18848, -18936, -19025, -19112, -19200, -19289, -19377, -19464, 
-        -19553, -19640, -19728, -19815, -19904, -19990, -20077, -20166, -20253, -20340, -20427, -20514, 
-        -20601, -20688, -20773, -20860, -20949, -21034, -21121, -21207, -21294, -21379, -21464, -21551, 
-        -21638, -21724, -21811, -21896, -21982, -22067, -22153, -22238, -22324, -22409, -22495, -22580, 
-        -22666, -22750, -22835, -22920, -23006, -23090, -23175, -23259, -23345, -23429, -23514, -23598, 
-        -23682, -23766, -23850, -23934, -24018, -24104, -24188, -24271, -24355, -24438, -24522, -24606, 
-        -24690, -24772, -24856, -24939, -25023, -25105, -25189, -25272, -25354, -25438, -25521, -25603, 
-        -25685, -25769, -25852, -25934, -26017, -26099, -26180, -26263, -26345, -26428, -26509, -26591, 
-        -26672, -26755, -26837, -26918, -26999, -27081, -27162, -27236, -27314, -27398, -27488, -27575, 
-        -27644, -27741, -27794, -27909, -27954, -28079, -28112, -28244, -28238, -28536, -27035, -13273 
-    };
-
-    // AKWF_R_asym_saw_26 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_asym_saw_26[600] PROGMEM = {
-        18250, 29725, 31810, 32767, 32622, 32693, 32493, 32407, 32265, 32118, 32022, 31858, 
-        31772, 31604, 31490, 31366, 31299, 31180, 31059, 30929, 30803, 30672, 30546, 30416, 
-        30288, 30159, 30032, 29903, 29776, 29648, 29521, 29393, 29266, 29138, 29011, 28885, 
-        28758, 28630, 28504, 28378, 28251, 28125, 27999, 27871, 27746, 27620, 27494, 27368, 
-        27242, 27117, 26991, 26865, 26739, 26615, 26490, 26364, 26240, 26116, 25991, 25867, 
-        25742, 25618, 25493, 25369, 25246, 25121, 24998, 24874, 24751, 24626, 24503, 24380, 
-        24257, 24133, 24011, 23888, 23765, 23642, 23519, 23398, 23275, 23152, 23030, 22909, 
-        22786, 22664, 22543, 22421, 22300, 22178, 22057, 21935, 21814, 21692, 21572, 21451, 
-        21331, 21209, 21089, 20969, 20849, 20729, 20609, 20489, 20367, 20247, 20129, 20009, 
-        19890, 19770, 19650, 19532, 19412, 19293, 19175, 19056, 18936, 18817, 18699, 18580, 
-        18462, 18343, 18226, 18108, 17991, 17872, 17755, 17636, 17519, 17402, 17284, 17167, 
-        17050, 16933, 16815, 16698, 16583, 16466, 16349, 16232, 16116, 15999, 15883, 15768, 
-        15651, 15535, 15420, 15304, 15188, 15073, 14957, 14842, 14726, 14612, 14496, 14381, 
-        14267, 14153, 14037, 13923, 13809, 13695, 13581, 13465, 13351, 13237, 13124, 13010, 
-        12896, 12782, 12668, 12555, 12441, 12328, 12216, 12103, 11989, 11876, 11764, 11651, 
-        11539, 11426, 11313, 11202, 11090, 10977, 10866, 10753, 10642, 10529, 10418, 10307, 
-        10195, 10083, 9972, 9861, 9750, 9639, 9528, 9418, 9307, 9197, 9086, 8975, 
-        8864, 8754, 8645, 8535, 8425, 8316, 8204, 8096, 7987, 7877, 7767, 7658, 
-        7549, 7440, 7330, 7221, 7112, 7004, 6895, 6786, 6678, 6569, 6460, 6352, 
-        6244, 6136, 6028, 5921, 5813, 5705, 5598, 5490, 5383, 5275, 5168, 5060, 
-        4953, 4847, 4740, 4633, 4527, 4420, 4313, 4206, 4100, 3995, 3888, 3781, 
-        3676, 3569, 3464, 3359, 3252, 3147, 3042, 2937, 2830, 2725, 2621, 2516, 
-        2410, 2305, 2202, 2096, 1991, 1887, 1782, 1678, 1575, 1469, 1366, 1262, 
-        1158, 1055, 951, 847, 743, 640, 536, 434, 330, 226, 124, 22, 
-        -81, -183, -285, -388, -490, -592, -694, -798, -900, -1001, -1103, -1206, 
-        -1308, -1409, -1511, -1612, -1714, -1816, -1917, -2018, -2120, -2221, -2322, -2422, 
-        -2523, -2624, -2725, -2825, -2925, -3025, -3126, -3227, -3326, -3427, -3526, -3627, 
-        -3726, -3826, -3925, -4024, -4125, -4224, -4324, -4423, -4522, -4621, -4719, -4818, 
-        -4918, -5017, -5115, -5214, -5312, -5411, -5509, -5607, -5705, -5804, -5902, -5999, 
-        -6097, -6195, -6293, -6389, -6487, -6585, -6683, -6780, -6877, -6975, -7071, -7167, 
-        -7265, -7361, -7458, -7554, -7652, -7748, -7844, -7941, -8037, -8133, -8228, -8324, 
-        -8421, -8516, -8612, -8707, -8803, -8898, -8994, -9089, -9184, -9280, -9375, -9470, 
-        -9565, -9660, -9754, -9849, -9944, -10039, -10132, -10227, -10322, -10417, -10510, -10604, 
-        -10698, -10792, -10887, -10980, -11073, -11167, -11260, -11353, -11447, -11542, -11635, -11727, 
-        -11820, -11914, -12005, -12099, -12191, -12284, -12377, -12469, -12561, -12654, -12746, -12838, 
-        -12932, -13023, -13115, -13207, -13299, -13389, -13481, -13573, -13665, -13757, -13847, -13939, 
-        -14030, -14121, -14212, -14304, -14394, -14485, -14576, -14667, -14757, -14848, -14938, -15028, 
-        -15119, -15209, -15298, -15388, -15479, -15569, -15658, -15749, -15837, -15928, -16017, -16107, 
-        -16196, -16285, -16375, -16464, -16553, -16642, -16731, -16820, -16909, -16998, -17087, -17174, 
-        -17263, -17352, -17439, -17528, -17616, -17705, -17792, -17881, -17968, -18056, -18143, -18231, 
-        -18320, -18407, -18494, -18582, -18669, -18757, -18843, -18930, -19017, -19105, -19191, -19278, 
-        -19366, -19452, -19538, -19625, -19711, -19797, -19884, -19970, -20056, -20142, -20228, -20314, 
-        -20400, -20486, -20572, -20658, -20744, -20828, -20914, -20999, -21085, -21169, -21254, -21340, 
-        -21425, -21510, -21596, -21680, -21765, -21849, -21934, -22018, -22103, -22187, -22272, -22356, 
-        -22439, -22524, -22608, -22692, -22777, -22860, -22943, -23027, -23110, -23195, -23278, -23362, 
-        -23445, -23528, -23611, -23694, -23777, -23860, -23943, -24026, -24109, -24191, -24274, -24357, 
-        -24440, -24521, -24604, -24686, -24769, -24850, -24933, -25014, -25096, -25179, -25260, -25342, 
-        -25423, -25506, -25588, -25669, -25749, -25831, -25912, -25994, -26074, -26156, -26237, -26317, 
-        -26399, -26480, -26560, -26642, -26722, -26802, -26883, -26951, -27031, -27116, -27208, -27294, 
-        -27354, -27460, -27494, -27634, -27649, -27809, -27797, -27977, -27903, -28335, -26107, -7552 
-    };
-
-    // AKWF_R_sym_saw_01 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_01[600] PROGMEM = {
-        174, 531, 889, 1249, 1602, 1959, 2321, 2673, 3031, 3391, 3744, 4099, 
-        4456, 4809, 5169, 5527, 5879, 6236, 6592, 6949, 7302, 7659, 8016, 8368, 
-        8724, 9076, 9439, 9791, 10143, 10496, 10853, 11205, 11558, 11913, 12267, 12615, 
-        12967, 13319, 13672, 14019, 14372, 14719, 15068, 15415, 15764, 16112, 16456, 16803, 
-        17147, 17492, 17834, 18178, 18517, 18861, 19199, 19540, 19874, 20213, 20547, 20882, 
-        21208, 21539, 21870, 22196, 22520, 22843, 23164, 23485, 23802, 24115, 24428, 24736, 
-        25046, 25349, 25653, 25948, 26243, 26534, 26824, 27112, 27388, 27665, 27943, 28207, 
-        28472, 28732, 28982, 29229, 29471, 29715, 29944, 30168, 30388, 30596, 30802, 30996, 
-        31185, 31366, 31534, 31696, 31845, 31992, 32119, 32247, 32358, 32450, 32539, 32613, 
-        32670, 32718, 32749, 32767, 32767, 32749, 32715, 32665, 32595, 32502, 32392, 32269, 
-        32137, 32000, 31869, 31732, 31595, 31459, 31322, 31190, 31049, 30909, 30767, 30630, 
-        30489, 30349, 30202, 30062, 29913, 29773, 29626, 29481, 29331, 29181, 29037, 28887, 
-        28735, 28587, 28437, 28283, 28128, 27978, 27825, 27670, 27512, 27362, 27199, 27044, 
-        26886, 26732, 26573, 26410, 26252, 26093, 25930, 25768, 25604, 25437, 25278, 25111, 
-        24948, 24780, 24617, 24451, 24287, 24115, 23947, 23776, 23608, 23437, 23271, 23098, 
-        22927, 22755, 22582, 22411, 22238, 22067, 21888, 21715, 21539, 21362, 21186, 21010, 
-        20834, 20653, 20477, 20300, 20121, 19940, 19759, 19579, 19403, 19217, 19036, 18852, 
-        18670, 18486, 18305, 18125, 17939, 17750, 17571, 17381, 17200, 17014, 16830, 16637, 
-        16451, 16262, 16077, 15891, 15702, 15513, 15323, 15134, 14944, 14755, 14563, 14373, 
-        14182, 13990, 13800, 13606, 13417, 13222, 13028, 12834, 12644, 12447, 12253, 12063, 
-        11866, 11671, 11477, 11279, 11090, 10893, 10698, 10501, 10301, 10107, 9915, 9715, 
-        9518, 9320, 9121, 8923, 8724, 8527, 8329, 8131, 7937, 7735, 7537, 7338, 
-        7140, 6938, 6738, 6538, 6338, 6139, 5937, 5739, 5537, 5334, 5140, 4937, 
-        4740, 4537, 4333, 4130, 3928, 3730, 3528, 3329, 3126, 2925, 2726, 2519, 
-        2321, 2119, 1919, 1717, 1514, 1312, 1109, 907, 709, 507, 304, 97, 
-        -97, -304, -507, -709, -907, -1109, -1312, -1514, -1717, -1919, -2119, -2321, 
-        -2519, -2726, -2925, -3126, -3329, -3528, -3730, -3928, -4130, -4333, -4537, -4740, 
-        -4937, -5140, -5334, -5537, -5739, -5937, -6139, -6338, -6538, -6738, -6938, -7140, 
-        -7338, -7537, -7735, -7937, -8131, -8329, -8527, -8724, -8923, -9121, -9320, -9518, 
-        -9715, -9915, -10107, -10301, -10501, -10698, -10893, -11090, -11279, -11477, -11671, -11866, 
-        -12063, -12253, -12447, -12644, -12834, -13028, -13222, -13417, -13606, -13800, -13990, -14182, 
-        -14373, -14563, -14755, -14944, -15134, -15323, -15513, -15702, -15891, -16077, -16262, -16451, 
-        -16637, -16830, -17014, -17200, -17381, -17571, -17750, -17939, -18125, -18305, -18486, -18670, 
-        -18852, -19036, -19217, -19403, -19579, -19759, -19940, -20121, -20300, -20477, -20653, -20834, 
-        -21010, -21186, -21362, -21539, -21715, -21888, -22067, -22238, -22411, -22582, -22755, -22927, 
-        -23098, -23271, -23437, -23608, -23776, -23947, -24115, -24287, -24451, -24617, -24780, -24948, 
-        -25111, -25278, -25437, -25604, -25768, -25930, -26093, -26252, -26410, -26573, -26732, -26886, 
-        -27044, -27199, -27362, -27512, -27670, -27825, -27978, -28128, -28283, -28437, -28587, -28735, 
-        -28887, -29037, -29181, -29331, -29481, -29626, -29773, -29913, -30062, -30202, -30349, -30489, 
-        -30630, -30767, -30909, -31049, -31190, -31322, -31459, -31595, -31732, -31869, -32000, -32137, 
-        -32269, -32392, -32502, -32595, -32665, -32715, -32749, -32767, -32767, -32749, -32718, -32670, 
-        -32613, -32539, -32450, -32358, -32247, -32119, -31992, -31845, -31696, -31534, -31366, -31185, 
-        -30996, -30802, -30596, -30388, -30168, -29944, -29715, -29471, -29229, -28982, -28732, -28472, 
-        -28207, -27943, -27665, -27388, -27112, -26824, -26534, -26243, -25948, -25653, -25349, -25046, 
-        -24736, -24428, -24115, -23802, -23485, -23164, -22843, -22520, -22196, -21870, -21539, -21208, 
-        -20882, -20547, -20213, -19874, -19540, -19199, -18861, -18517, -18178, -17834, -17492, -17147, 
-        -16803, -16456, -16112, -15764, -15415, -15068, -14719, -14372, -14019, -13672, -13319, -12967, 
-        -12615, -12267, -11913, -11558, -11205, -10853, -10496, -10143, -9791, -9439, -9076, -8724, 
-        -8368, -8016, -7659, -7302, -6949, -6592, -6236, -5879, -5527, -5169, -4809, -4456, 
-        -4099, -3744, -3391, -3031, -2673, -2321, -1959, -1602, -1249, -889, -531, -174 
-    };
-
-    // AKWF_R_sym_saw_02 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_02[600] PROGMEM = {
-        198, 597, 998, 1396, 1796, 2195, 2595, 2998, 3397, 3797, 4196, 4597, 
-        4994, 5396, 5796, 6199, 6597, 6996, 7399, 7799, 8202, 8599, 9002, 9405, 
-        9808, 10208, 10609, 11012, 11411, 11816, 12215, 12618, 13019, 13422, 13825, 14226, 
-        14626, 15029, 15430, 15833, 16236, 16635, 17035, 17433, 17832, 18235, 18631, 19031, 
-        19427, 19825, 20221, 20614, 21008, 21401, 21789, 22180, 22568, 22952, 23340, 23723, 
-        24099, 24475, 24851, 25222, 25589, 25954, 26316, 26672, 27025, 27372, 27713, 28052, 
-        28379, 28705, 29022, 29335, 29635, 29927, 30211, 30483, 30746, 30998, 31238, 31465, 
-        31676, 31874, 32054, 32220, 32365, 32492, 32593, 32673, 32732, 32764, 32767, 32744, 
-        32689, 32610, 32517, 32428, 32334, 32242, 32148, 32052, 31957, 31858, 31760, 31661, 
-        31561, 31458, 31354, 31250, 31146, 31040, 30931, 30827, 30718, 30607, 30495, 30385, 
-        30273, 30155, 30043, 29927, 29811, 29694, 29575, 29452, 29335, 29215, 29093, 28967, 
-        28844, 28720, 28596, 28468, 28341, 28213, 28084, 27953, 27824, 27689, 27557, 27424, 
-        27292, 27156, 27020, 26884, 26744, 26608, 26466, 26326, 26185, 26046, 25905, 25761, 
-        25615, 25474, 25328, 25182, 25037, 24889, 24738, 24591, 24443, 24293, 24142, 23990, 
-        23839, 23684, 23531, 23375, 23222, 23068, 22909, 22752, 22596, 22437, 22281, 22123, 
-        21960, 21801, 21638, 21480, 21314, 21153, 20992, 20825, 20661, 20498, 20330, 20166, 
-        19998, 19830, 19662, 19494, 19326, 19155, 18984, 18814, 18646, 18473, 18301, 18128, 
-        17956, 17780, 17607, 17433, 17260, 17087, 16909, 16733, 16556, 16380, 16204, 16023, 
-        15848, 15665, 15489, 15309, 15130, 14950, 14770, 14589, 14406, 14223, 14042, 13862, 
-        13677, 13494, 13310, 13127, 12942, 12759, 12575, 12388, 12204, 12016, 11831, 11645, 
-        11457, 11269, 11084, 10896, 10708, 10520, 10332, 10142, 9954, 9764, 9576, 9385, 
-        9197, 9006, 8818, 8626, 8437, 8244, 8050, 7859, 7669, 7478, 7283, 7094, 
-        6902, 6709, 6516, 6323, 6132, 5939, 5744, 5551, 5356, 5163, 4968, 4775, 
-        4581, 4389, 4193, 3998, 3803, 3609, 3416, 3221, 3024, 2833, 2637, 2442, 
-        2246, 2051, 1854, 1661, 1463, 1270, 1072, 879, 683, 488, 292, 99, 
-        -99, -292, -488, -683, -879, -1072, -1270, -1463, -1661, -1854, -2051, -2246, 
-        -2442, -2637, -2833, -3024, -3221, -3416, -3609, -3803, -3998, -4193, -4389, -4581, 
-        -4775, -4968, -5163, -5356, -5551, -5744, -5939, -6132, -6323, -6516, -6709, -6902, 
-        -7094, -7283, -7478, -7669, -7859, -8050, -8244, -8437, -8626, -8818, -9006, -9197, 
-        -9385, -9576, -9764, -9954, -10142, -10332, -10520, -10708, -10896, -11084, -11269, -11457, 
-        -11645, -11831, -12016, -12204, -12388, -12575, -12759, -12942, -13127, -13310, -13494, -13677, 
-        -13862, -14042, -14223, -14406, -14589, -14770, -14950, -15130, -15309, -15489, -15665, -15848, 
-        -16023, -16204, -16380, -16556, -16733, -16909, -17087, -17260, -17433, -17607, -17780, -17956, 
-        -18128, -18301, -18473, -18646, -18814, -18984, -19155, -19326, -19494, -19662, -19830, -19998, 
-        -20166, -20330, -20498, -20661, -20825, -20992, -21153, -21314, -21480, -21638, -21801, -21960, 
-        -22123, -22281, -22437, -22596, -22752, -22909, -23068, -23222, -23375, -23531, -23684, -23839, 
-        -23990, -24142, -24293, -24443, -24591, -24738, -24889, -25037, -25182, -25328, -25474, -25615, 
-        -25761, -25905, -26046, -26185, -26326, -26466, -26608, -26744, -26884, -27020, -27156, -27292, 
-        -27424, -27557, -27689, -27824, -27953, -28084, -28213, -28341, -28468, -28596, -28720, -28844, 
-        -28967, -29093, -29215, -29335, -29452, -29575, -29694, -29811, -29927, -30043, -30155, -30273, 
-        -30385, -30495, -30607, -30718, -30827, -30931, -31040, -31146, -31250, -31354, -31458, -31561, 
-        -31661, -31760, -31858, -31957, -32052, -32148, -32242, -32334, -32428, -32517, -32610, -32689, 
-        -32744, -32767, -32764, -32732, -32673, -32593, -32492, -32365, -32220, -32054, -31874, -31676, 
-        -31465, -31238, -30998, -30746, -30483, -30211, -29927, -29635, -29335, -29022, -28705, -28379, 
-        -28052, -27713, -27372, -27025, -26672, -26316, -25954, -25589, -25222, -24851, -24475, -24099, 
-        -23723, -23340, -22952, -22568, -22180, -21789, -21401, -21008, -20614, -20221, -19825, -19427, 
-        -19031, -18631, -18235, -17832, -17433, -17035, -16635, -16236, -15833, -15430, -15029, -14626, 
-        -14226, -13825, -13422, -13019, -12618, -12215, -11816, -11411, -11012, -10609, -10208, -9808, 
-        -9405, -9002, -8599, -8202, -7799, -7399, -6996, -6597, -6199, -5796, -5396, -4994, 
-        -4597, -4196, -3797, -3397, -2998, -2595, -2195, -1796, -1396, -998, -597, -198 
-    };
-
-    // AKWF_R_sym_saw_03 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_03[600] PROGMEM = {
-        229, 686, 1144, 1603, 2064, 2521, 2980, 3438, 3898, 4354, 4815, 5276, 
-        5737, 6196, 6656, 7119, 7580, 8042, 8503, 8965, 9430, 9892, 10358, 10822, 
-        11284, 11752, 12220, 12685, 13153, 13619, 14085, 14554, 15023, 15491, 15958, 16431, 
-        16900, 17368, 17838, 18309, 18779, 19249, 19719, 20186, 20654, 21121, 21589, 22053, 
-        22515, 22980, 23440, 23896, 24352, 24806, 25255, 25702, 26141, 26578, 27007, 27434, 
-        27852, 28263, 28663, 29056, 29436, 29807, 30165, 30507, 30832, 31142, 31432, 31701, 
-        31946, 32165, 32356, 32513, 32639, 32722, 32767, 32766, 32732, 32680, 32626, 32572, 
-        32518, 32459, 32400, 32339, 32276, 32211, 32150, 32082, 32015, 31947, 31875, 31804, 
-        31731, 31657, 31581, 31505, 31426, 31345, 31267, 31184, 31098, 31016, 30928, 30842, 
-        30754, 30664, 30573, 30480, 30388, 30291, 30197, 30099, 30001, 29903, 29804, 29702, 
-        29598, 29493, 29390, 29284, 29176, 29068, 28960, 28848, 28737, 28624, 28512, 28398, 
-        28281, 28163, 28048, 27927, 27810, 27690, 27569, 27446, 27321, 27198, 27073, 26944, 
-        26820, 26691, 26561, 26431, 26300, 26170, 26038, 25905, 25768, 25633, 25496, 25360, 
-        25223, 25084, 24946, 24806, 24662, 24522, 24379, 24235, 24092, 23948, 23802, 23655, 
-        23506, 23358, 23213, 23062, 22910, 22760, 22608, 22458, 22304, 22153, 21994, 21842, 
-        21685, 21530, 21373, 21212, 21057, 20897, 20738, 20576, 20414, 20254, 20092, 19930, 
-        19766, 19602, 19439, 19271, 19108, 18942, 18774, 18608, 18439, 18272, 18103, 17933, 
-        17764, 17594, 17423, 17251, 17081, 16907, 16733, 16561, 16387, 16211, 16037, 15862, 
-        15686, 15513, 15335, 15158, 14981, 14802, 14626, 14446, 14267, 14086, 13907, 13729, 
-        13548, 13366, 13185, 13004, 12822, 12638, 12456, 12274, 12090, 11907, 11722, 11538, 
-        11352, 11170, 10984, 10798, 10613, 10425, 10240, 10052, 9865, 9679, 9492, 9303, 
-        9114, 8927, 8739, 8552, 8363, 8172, 7983, 7794, 7603, 7411, 7224, 7033, 
-        6842, 6653, 6462, 6272, 6079, 5888, 5698, 5504, 5313, 5120, 4930, 4734, 
-        4542, 4351, 4158, 3964, 3774, 3579, 3385, 3195, 2999, 2808, 2614, 2420, 
-        2227, 2033, 1841, 1645, 1453, 1260, 1065, 870, 676, 484, 290, 96, 
-        -96, -290, -484, -676, -870, -1065, -1260, -1453, -1645, -1841, -2033, -2227, 
-        -2420, -2614, -2808, -2999, -3195, -3385, -3579, -3774, -3964, -4158, -4351, -4542, 
-        -4734, -4930, -5120, -5313, -5504, -5698, -5888, -6079, -6272, -6462, -6653, -6842, 
-        -7033, -7224, -7411, -7603, -7794, -7983, -8172, -8363, -8552, -8739, -8927, -9114, 
-        -9303, -9492, -9679, -9865, -10052, -10240, -10425, -10613, -10798, -10984, -11170, -11352, 
-        -11538, -11722, -11907, -12090, -12274, -12456, -12638, -12822, -13004, -13185, -13366, -13548, 
-        -13729, -13907, -14086, -14267, -14446, -14626, -14802, -14981, -15158, -15335, -15513, -15686, 
-        -15862, -16037, -16211, -16387, -16561, -16733, -16907, -17081, -17251, -17423, -17594, -17764, 
-        -17933, -18103, -18272, -18439, -18608, -18774, -18942, -19108, -19271, -19439, -19602, -19766, 
-        -19930, -20092, -20254, -20414, -20576, -20738, -20897, -21057, -21212, -21373, -21530, -21685, 
-        -21842, -21994, -22153, -22304, -22458, -22608, -22760, -22910, -23062, -23213, -23358, -23506, 
-        -23655, -23802, -23948, -24092, -24235, -24379, -24522, -24662, -24806, -24946, -25084, -25223, 
-        -25360, -25496, -25633, -25768, -25905, -26038, -26170, -26300, -26431, -26561, -26691, -26820, 
-        -26944, -27073, -27198, -27321, -27446, -27569, -27690, -27810, -27927, -28048, -28163, -28281, 
-        -28398, -28512, -28624, -28737, -28848, -28960, -29068, -29176, -29284, -29390, -29493, -29598, 
-        -29702, -29804, -29903, -30001, -30099, -30197, -30291, -30388, -30480, -30573, -30664, -30754, 
-        -30842, -30928, -31016, -31098, -31184, -31267, -31345, -31426, -31505, -31581, -31657, -31731, 
-        -31804, -31875, -31947, -32015, -32082, -32150, -32211, -32276, -32339, -32400, -32459, -32518, 
-        -32572, -32626, -32680, -32732, -32766, -32767, -32722, -32639, -32513, -32356, -32165, -31946, 
-        -31701, -31432, -31142, -30832, -30507, -30165, -29807, -29436, -29056, -28663, -28263, -27852, 
-        -27434, -27007, -26578, -26141, -25702, -25255, -24806, -24352, -23896, -23440, -22980, -22515, 
-        -22053, -21589, -21121, -20654, -20186, -19719, -19249, -18779, -18309, -17838, -17368, -16900, 
-        -16431, -15958, -15491, -15023, -14554, -14085, -13619, -13153, -12685, -12220, -11752, -11284, 
-        -10822, -10358, -9892, -9430, -8965, -8503, -8042, -7580, -7119, -6656, -6196, -5737, 
-        -5276, -4815, -4354, -3898, -3438, -2980, -2521, -2064, -1603, -1144, -686, -229 
-    };
-
-    // AKWF_R_sym_saw_04 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_04[600] PROGMEM = {
-        267, 803, 1340, 1876, 2413, 2951, 3489, 4024, 4562, 5102, 5640, 6181, 
-        6721, 7261, 7803, 8346, 8889, 9434, 9977, 10524, 11070, 11617, 12165, 12717, 
-        13268, 13820, 14371, 14925, 15480, 16038, 16593, 17150, 17706, 18266, 18826, 19385, 
-        19945, 20506, 21065, 21623, 22181, 22736, 23293, 23844, 24396, 24944, 25486, 26024, 
-        26555, 27080, 27596, 28104, 28600, 29083, 29550, 30001, 30433, 30839, 31220, 31572, 
-        31888, 32165, 32399, 32579, 32702, 32761, 32767, 32754, 32739, 32719, 32699, 32677, 
-        32651, 32626, 32598, 32567, 32535, 32500, 32465, 32428, 32387, 32347, 32303, 32260, 
-        32211, 32164, 32113, 32063, 32009, 31954, 31896, 31839, 31780, 31716, 31654, 31589, 
-        31523, 31456, 31385, 31315, 31244, 31170, 31094, 31017, 30938, 30860, 30778, 30696, 
-        30612, 30526, 30440, 30354, 30262, 30173, 30082, 29986, 29893, 29799, 29700, 29603, 
-        29502, 29402, 29300, 29196, 29093, 28985, 28879, 28770, 28662, 28551, 28439, 28328, 
-        28213, 28101, 27983, 27865, 27749, 27630, 27509, 27388, 27267, 27142, 27018, 26893, 
-        26767, 26641, 26512, 26384, 26253, 26121, 25989, 25857, 25723, 25590, 25454, 25318, 
-        25178, 25042, 24900, 24761, 24621, 24480, 24339, 24194, 24051, 23907, 23760, 23614, 
-        23466, 23318, 23168, 23020, 22869, 22721, 22568, 22415, 22264, 22109, 21954, 21799, 
-        21643, 21487, 21329, 21172, 21014, 20854, 20696, 20535, 20375, 20212, 20050, 19887, 
-        19724, 19559, 19396, 19231, 19065, 18898, 18730, 18566, 18397, 18227, 18058, 17889, 
-        17720, 17548, 17377, 17208, 17035, 16862, 16690, 16516, 16344, 16167, 15994, 15819, 
-        15644, 15468, 15291, 15115, 14936, 14758, 14582, 14402, 14223, 14043, 13865, 13685, 
-        13504, 13322, 13144, 12960, 12779, 12597, 12416, 12232, 12049, 11864, 11681, 11497, 
-        11314, 11129, 10944, 10757, 10574, 10387, 10202, 10016, 9829, 9641, 9456, 9267, 
-        9079, 8894, 8704, 8517, 8327, 8141, 7952, 7762, 7574, 7384, 7196, 7005, 
-        6815, 6625, 6435, 6244, 6052, 5862, 5674, 5480, 5288, 5098, 4908, 4715, 
-        4525, 4333, 4140, 3948, 3756, 3565, 3373, 3181, 2986, 2794, 2603, 2409, 
-        2218, 2024, 1833, 1637, 1447, 1252, 1061, 867, 674, 482, 287, 97, 
-        -97, -287, -482, -674, -867, -1061, -1252, -1447, -1637, -1833, -2024, -2218, 
-        -2409, -2603, -2794, -2986, -3181, -3373, -3565, -3756, -3948, -4140, -4333, -4525, 
-        -4715, -4908, -5098, -5288, -5480, -5674, -5862, -6052, -6244, -6435, -6625, -6815, 
-        -7005, -7196, -7384, -7574, -7762, -7952, -8141, -8327, -8517, -8704, -8894, -9079, 
-        -9267, -9456, -9641, -9829, -10016, -10202, -10387, -10574, -10757, -10944, -11129, -11314, 
-        -11497, -11681, -11864, -12049, -12232, -12416, -12597, -12779, -12960, -13144, -13322, -13504, 
-        -13685, -13865, -14043, -14223, -14402, -14582, -14758, -14936, -15115, -15291, -15468, -15644, 
-        -15819, -15994, -16167, -16344, -16516, -16690, -16862, -17035, -17208, -17377, -17548, -17720, 
-        -17889, -18058, -18227, -18397, -18566, -18730, -18898, -19065, -19231, -19396, -19559, -19724, 
-        -19887, -20050, -20212, -20375, -20535, -20696, -20854, -21014, -21172, -21329, -21487, -21643, 
-        -21799, -21954, -22109, -22264, -22415, -22568, -22721, -22869, -23020, -23168, -23318, -23466, 
-        -23614, -23760, -23907, -24051, -24194, -24339, -24480, -24621, -24761, -24900, -25042, -25178, 
-        -25318, -25454, -25590, -25723, -25857, -25989, -26121, -26253, -26384, -26512, -26641, -26767, 
-        -26893, -27018, -27142, -27267, -27388, -27509, -27630, -27749, -27865, -27983, -28101, -28213, 
-        -28328, -28439, -28551, -28662, -28770, -28879, -28985, -29093, -29196, -29300, -29402, -29502, 
-        -29603, -29700, -29799, -29893, -29986, -30082, -30173, -30262, -30354, -30440, -30526, -30612, 
-        -30696, -30778, -30860, -30938, -31017, -31094, -31170, -31244, -31315, -31385, -31456, -31523, 
-        -31589, -31654, -31716, -31780, -31839, -31896, -31954, -32009, -32063, -32113, -32164, -32211, 
-        -32260, -32303, -32347, -32387, -32428, -32465, -32500, -32535, -32567, -32598, -32626, -32651, 
-        -32677, -32699, -32719, -32739, -32754, -32767, -32761, -32702, -32579, -32399, -32165, -31888, 
-        -31572, -31220, -30839, -30433, -30001, -29550, -29083, -28600, -28104, -27596, -27080, -26555, 
-        -26024, -25486, -24944, -24396, -23844, -23293, -22736, -22181, -21623, -21065, -20506, -19945, 
-        -19385, -18826, -18266, -17706, -17150, -16593, -16038, -15480, -14925, -14371, -13820, -13268, 
-        -12717, -12165, -11617, -11070, -10524, -9977, -9434, -8889, -8346, -7803, -7261, -6721, 
-        -6181, -5640, -5102, -4562, -4024, -3489, -2951, -2413, -1876, -1340, -803, -267 
-    };
-
-    // AKWF_R_sym_saw_05 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_05[600] PROGMEM = {
-        326, 978, 1630, 2284, 2940, 3592, 4246, 4904, 5560, 6219, 6876, 7535, 
-        8196, 8858, 9520, 10185, 10850, 11519, 12187, 12859, 13532, 14206, 14881, 15559, 
-        16240, 16920, 17601, 18285, 18969, 19655, 20341, 21025, 21713, 22397, 23079, 23758, 
-        24434, 25107, 25772, 26428, 27075, 27709, 28328, 28930, 29507, 30056, 30575, 31051, 
-        31483, 31856, 32162, 32389, 32527, 32590, 32622, 32649, 32672, 32694, 32711, 32727, 
-        32741, 32751, 32759, 32762, 32766, 32767, 32766, 32762, 32754, 32742, 32732, 32717, 
-        32702, 32682, 32660, 32639, 32612, 32585, 32553, 32523, 32488, 32453, 32413, 32374, 
-        32331, 32286, 32241, 32192, 32142, 32090, 32037, 31980, 31923, 31863, 31801, 31739, 
-        31674, 31607, 31540, 31469, 31398, 31322, 31249, 31172, 31093, 31015, 30934, 30849, 
-        30765, 30680, 30591, 30504, 30412, 30322, 30228, 30135, 30036, 29939, 29840, 29740, 
-        29640, 29536, 29432, 29327, 29220, 29113, 29002, 28892, 28783, 28668, 28556, 28439, 
-        28323, 28204, 28087, 27967, 27846, 27724, 27602, 27478, 27353, 27228, 27099, 26970, 
-        26843, 26714, 26580, 26450, 26316, 26182, 26048, 25913, 25776, 25637, 25498, 25359, 
-        25220, 25078, 24936, 24795, 24650, 24506, 24362, 24213, 24068, 23921, 23773, 23623, 
-        23472, 23322, 23171, 23021, 22867, 22713, 22561, 22405, 22248, 22092, 21935, 21780, 
-        21621, 21462, 21303, 21141, 20982, 20819, 20659, 20497, 20334, 20170, 20007, 19843, 
-        19677, 19510, 19344, 19177, 19011, 18842, 18673, 18506, 18336, 18165, 17996, 17827, 
-        17655, 17482, 17312, 17138, 16966, 16792, 16618, 16444, 16268, 16094, 15918, 15743, 
-        15567, 15390, 15213, 15037, 14858, 14681, 14502, 14323, 14144, 13965, 13784, 13605, 
-        13425, 13244, 13063, 12881, 12699, 12518, 12336, 12153, 11969, 11787, 11605, 11419, 
-        11237, 11053, 10869, 10683, 10497, 10313, 10128, 9942, 9756, 9571, 9383, 9199, 
-        9012, 8826, 8637, 8450, 8263, 8075, 7890, 7701, 7512, 7323, 7135, 6948, 
-        6757, 6570, 6381, 6193, 6001, 5814, 5623, 5434, 5245, 5056, 4865, 4676, 
-        4487, 4295, 4106, 3914, 3725, 3532, 3343, 3153, 2962, 2771, 2580, 2390, 
-        2197, 2008, 1814, 1625, 1435, 1242, 1050, 861, 670, 478, 286, 93, 
-        -93, -286, -478, -670, -861, -1050, -1242, -1435, -1625, -1814, -2008, -2197, 
-        -2390, -2580, -2771, -2962, -3153, -3343, -3532, -3725, -3914, -4106, -4295, -4487, 
-        -4676, -4865, -5056, -5245, -5434, -5623, -5814, -6001, -6193, -6381, -6570, -6757, 
-        -6948, -7135, -7323, -7512, -7701, -7890, -8075, -8263, -8450, -8637, -8826, -9012, 
-        -9199, -9383, -9571, -9756, -9942, -10128, -10313, -10497, -10683, -10869, -11053, -11237, 
-        -11419, -11605, -11787, -11969, -12153, -12336, -12518, -12699, -12881, -13063, -13244, -13425, 
-        -13605, -13784, -13965, -14144, -14323, -14502, -14681, -14858, -15037, -15213, -15390, -15567, 
-        -15743, -15918, -16094, -16268, -16444, -16618, -16792, -16966, -17138, -17312, -17482, -17655, 
-        -17827, -17996, -18165, -18336, -18506, -18673, -18842, -19011, -19177, -19344, -19510, -19677, 
-        -19843, -20007, -20170, -20334, -20497, -20659, -20819, -20982, -21141, -21303, -21462, -21621, 
-        -21780, -21935, -22092, -22248, -22405, -22561, -22713, -22867, -23021, -23171, -23322, -23472, 
-        -23623, -23773, -23921, -24068, -24213, -24362, -24506, -24650, -24795, -24936, -25078, -25220, 
-        -25359, -25498, -25637, -25776, -25913, -26048, -26182, -26316, -26450, -26580, -26714, -26843, 
-        -26970, -27099, -27228, -27353, -27478, -27602, -27724, -27846, -27967, -28087, -28204, -28323, 
-        -28439, -28556, -28668, -28783, -28892, -29002, -29113, -29220, -29327, -29432, -29536, -29640, 
-        -29740, -29840, -29939, -30036, -30135, -30228, -30322, -30412, -30504, -30591, -30680, -30765, 
-        -30849, -30934, -31015, -31093, -31172, -31249, -31322, -31398, -31469, -31540, -31607, -31674, 
-        -31739, -31801, -31863, -31923, -31980, -32037, -32090, -32142, -32192, -32241, -32286, -32331, 
-        -32374, -32413, -32453, -32488, -32523, -32553, -32585, -32612, -32639, -32660, -32682, -32702, 
-        -32717, -32732, -32742, -32754, -32762, -32766, -32767, -32766, -32762, -32759, -32751, -32741, 
-        -32727, -32711, -32694, -32672, -32649, -32622, -32590, -32527, -32389, -32162, -31856, -31483, 
-        -31051, -30575, -30056, -29507, -28930, -28328, -27709, -27075, -26428, -25772, -25107, -24434, 
-        -23758, -23079, -22397, -21713, -21025, -20341, -19655, -18969, -18285, -17601, -16920, -16240, 
-        -15559, -14881, -14206, -13532, -12859, -12187, -11519, -10850, -10185, -9520, -8858, -8196, 
-        -7535, -6876, -6219, -5560, -4904, -4246, -3592, -2940, -2284, -1630, -978, -326 
-    };
-
-    // AKWF_R_sym_saw_06 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_06[600] PROGMEM = {
-        388, 1169, 1950, 2731, 3514, 4298, 5081, 5867, 6654, 7444, 8233, 9025, 
-        9821, 10617, 11416, 12219, 13022, 13829, 14639, 15451, 16267, 17084, 17904, 18724, 
-        19548, 20373, 21196, 22018, 22840, 23658, 24471, 25273, 26065, 26845, 27603, 28335, 
-        29032, 29691, 30295, 30833, 31287, 31637, 31861, 31982, 32057, 32127, 32191, 32253, 
-        32310, 32364, 32415, 32460, 32504, 32544, 32581, 32614, 32643, 32669, 32692, 32712, 
-        32728, 32743, 32754, 32761, 32766, 32767, 32767, 32763, 32756, 32748, 32735, 32722, 
-        32704, 32683, 32660, 32637, 32609, 32580, 32545, 32511, 32473, 32434, 32393, 32351, 
-        32303, 32254, 32204, 32152, 32098, 32040, 31982, 31921, 31857, 31795, 31727, 31658, 
-        31589, 31516, 31442, 31367, 31290, 31209, 31129, 31047, 30962, 30877, 30789, 30701, 
-        30609, 30518, 30424, 30328, 30232, 30134, 30036, 29934, 29831, 29728, 29624, 29518, 
-        29410, 29300, 29191, 29078, 28965, 28853, 28737, 28621, 28505, 28385, 28266, 28145, 
-        28023, 27900, 27776, 27652, 27524, 27397, 27269, 27142, 27011, 26879, 26748, 26614, 
-        26482, 26346, 26211, 26073, 25936, 25799, 25658, 25521, 25379, 25238, 25096, 24953, 
-        24807, 24663, 24518, 24372, 24225, 24078, 23930, 23779, 23631, 23482, 23330, 23180, 
-        23026, 22873, 22721, 22565, 22410, 22257, 22100, 21945, 21786, 21629, 21469, 21312, 
-        21152, 20994, 20833, 20673, 20512, 20350, 20188, 20025, 19863, 19700, 19533, 19369, 
-        19204, 19039, 18873, 18706, 18541, 18373, 18206, 18038, 17870, 17701, 17533, 17363, 
-        17193, 17023, 16852, 16682, 16510, 16340, 16167, 15994, 15822, 15651, 15478, 15304, 
-        15129, 14956, 14783, 14607, 14432, 14257, 14081, 13907, 13731, 13554, 13378, 13201, 
-        13023, 12847, 12670, 12494, 12314, 12138, 11960, 11782, 11602, 11422, 11244, 11066, 
-        10886, 10705, 10527, 10345, 10166, 9986, 9805, 9625, 9445, 9262, 9082, 8901, 
-        8720, 8538, 8355, 8176, 7994, 7811, 7630, 7447, 7262, 7081, 6899, 6715, 
-        6533, 6350, 6168, 5983, 5802, 5619, 5434, 5251, 5066, 4883, 4700, 4516, 
-        4331, 4148, 3965, 3780, 3597, 3413, 3228, 3045, 2860, 2674, 2491, 2308, 
-        2122, 1937, 1753, 1570, 1383, 1200, 1014, 830, 645, 460, 276, 91, 
-        -91, -276, -460, -645, -830, -1014, -1200, -1383, -1570, -1753, -1937, -2122, 
-        -2308, -2491, -2674, -2860, -3045, -3228, -3413, -3597, -3780, -3965, -4148, -4331, 
-        -4516, -4700, -4883, -5066, -5251, -5434, -5619, -5802, -5983, -6168, -6350, -6533, 
-        -6715, -6899, -7081, -7262, -7447, -7630, -7811, -7994, -8176, -8355, -8538, -8720, 
-        -8901, -9082, -9262, -9445, -9625, -9805, -9986, -10166, -10345, -10527, -10705, -10886, 
-        -11066, -11244, -11422, -11602, -11782, -11960, -12138, -12314, -12494, -12670, -12847, -13023, 
-        -13201, -13378, -13554, -13731, -13907, -14081, -14257, -14432, -14607, -14783, -14956, -15129, 
-        -15304, -15478, -15651, -15822, -15994, -16167, -16340, -16510, -16682, -16852, -17023, -17193, 
-        -17363, -17533, -17701, -17870, -18038, -18206, -18373, -18541, -18706, -18873, -19039, -19204, 
-        -19369, -19533, -19700, -19863, -20025, -20188, -20350, -20512, -20673, -20833, -20994, -21152, 
-        -21312, -21469, -21629, -21786, -21945, -22100, -22257, -22410, -22565, -22721, -22873, -23026, 
-        -23180, -23330, -23482, -23631, -23779, -23930, -24078, -24225, -24372, -24518, -24663, -24807, 
-        -24953, -25096, -25238, -25379, -25521, -25658, -25799, -25936, -26073, -26211, -26346, -26482, 
-        -26614, -26748, -26879, -27011, -27142, -27269, -27397, -27524, -27652, -27776, -27900, -28023, 
-        -28145, -28266, -28385, -28505, -28621, -28737, -28853, -28965, -29078, -29191, -29300, -29410, 
-        -29518, -29624, -29728, -29831, -29934, -30036, -30134, -30232, -30328, -30424, -30518, -30609, 
-        -30701, -30789, -30877, -30962, -31047, -31129, -31209, -31290, -31367, -31442, -31516, -31589, 
-        -31658, -31727, -31795, -31857, -31921, -31982, -32040, -32098, -32152, -32204, -32254, -32303, 
-        -32351, -32393, -32434, -32473, -32511, -32545, -32580, -32609, -32637, -32660, -32683, -32704, 
-        -32722, -32735, -32748, -32756, -32763, -32767, -32767, -32766, -32761, -32754, -32743, -32728, 
-        -32712, -32692, -32669, -32643, -32614, -32581, -32544, -32504, -32460, -32415, -32364, -32310, 
-        -32253, -32191, -32127, -32057, -31982, -31861, -31637, -31287, -30833, -30295, -29691, -29032, 
-        -28335, -27603, -26845, -26065, -25273, -24471, -23658, -22840, -22018, -21196, -20373, -19548, 
-        -18724, -17904, -17084, -16267, -15451, -14639, -13829, -13022, -12219, -11416, -10617, -9821, 
-        -9025, -8233, -7444, -6654, -5867, -5081, -4298, -3514, -2731, -1950, -1169, -388 
-    };
-
-    // AKWF_R_sym_saw_07 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_07[600] PROGMEM = {
-        464, 1393, 2321, 3253, 4186, 5117, 6055, 6991, 7931, 8873, 9820, 10771, 
-        11724, 12681, 13641, 14606, 15576, 16549, 17527, 18505, 19487, 20470, 21454, 22433, 
-        23410, 24376, 25329, 26260, 27162, 28024, 28831, 29560, 30192, 30688, 31020, 31207, 
-        31330, 31441, 31549, 31650, 31749, 31839, 31929, 32012, 32088, 32161, 32230, 32294, 
-        32352, 32408, 32460, 32508, 32550, 32587, 32622, 32653, 32679, 32704, 32723, 32739, 
-        32750, 32760, 32764, 32767, 32766, 32763, 32753, 32744, 32729, 32712, 32693, 32669, 
-        32644, 32615, 32584, 32550, 32516, 32477, 32435, 32390, 32344, 32294, 32243, 32189, 
-        32135, 32075, 32015, 31953, 31886, 31820, 31750, 31680, 31607, 31533, 31455, 31378, 
-        31297, 31214, 31130, 31043, 30958, 30867, 30775, 30684, 30590, 30495, 30398, 30298, 
-        30199, 30096, 29994, 29890, 29783, 29677, 29568, 29459, 29348, 29233, 29121, 29007, 
-        28890, 28772, 28655, 28535, 28416, 28294, 28170, 28047, 27921, 27795, 27669, 27541, 
-        27413, 27283, 27153, 27021, 26888, 26755, 26622, 26487, 26352, 26215, 26078, 25939, 
-        25801, 25661, 25520, 25379, 25238, 25096, 24953, 24809, 24665, 24519, 24373, 24227, 
-        24081, 23932, 23784, 23636, 23486, 23338, 23186, 23036, 22883, 22731, 22579, 22425, 
-        22273, 22120, 21964, 21809, 21654, 21497, 21341, 21185, 21028, 20871, 20712, 20555, 
-        20395, 20237, 20078, 19917, 19758, 19595, 19437, 19275, 19112, 18952, 18790, 18627, 
-        18463, 18300, 18137, 17972, 17809, 17644, 17479, 17316, 17151, 16985, 16820, 16654, 
-        16487, 16321, 16155, 15987, 15820, 15654, 15484, 15319, 15151, 14982, 14814, 14646, 
-        14478, 14308, 14139, 13971, 13800, 13630, 13460, 13291, 13120, 12950, 12779, 12609, 
-        12438, 12267, 12096, 11925, 11754, 11584, 11411, 11240, 11067, 10895, 10722, 10551, 
-        10380, 10207, 10034, 9861, 9689, 9514, 9342, 9169, 8996, 8823, 8651, 8476, 
-        8302, 8129, 7955, 7781, 7608, 7434, 7261, 7085, 6912, 6736, 6564, 6388, 
-        6215, 6041, 5866, 5692, 5516, 5342, 5167, 4991, 4819, 4643, 4469, 4293, 
-        4117, 3944, 3766, 3594, 3418, 3242, 3066, 2893, 2717, 2541, 2367, 2191, 
-        2017, 1841, 1667, 1491, 1315, 1141, 965, 789, 613, 438, 261, 87, 
-        -87, -261, -438, -613, -789, -965, -1141, -1315, -1491, -1667, -1841, -2017, 
-        -2191, -2367, -2541, -2717, -2893, -3066, -3242, -3418, -3594, -3766, -3944, -4117, 
-        -4293, -4469, -4643, -4819, -4991, -5167, -5342, -5516, -5692, -5866, -6041, -6215, 
-        -6388, -6564, -6736, -6912, -7085, -7261, -7434, -7608, -7781, -7955, -8129, -8302, 
-        -8476, -8651, -8823, -8996, -9169, -9342, -9514, -9689, -9861, -10034, -10207, -10380, 
-        -10551, -10722, -10895, -11067, -11240, -11411, -11584, -11754, -11925, -12096, -12267, -12438, 
-        -12609, -12779, -12950, -13120, -13291, -13460, -13630, -13800, -13971, -14139, -14308, -14478, 
-        -14646, -14814, -14982, -15151, -15319, -15484, -15654, -15820, -15987, -16155, -16321, -16487, 
-        -16654, -16820, -16985, -17151, -17316, -17479, -17644, -17809, -17972, -18137, -18300, -18463, 
-        -18627, -18790, -18952, -19112, -19275, -19437, -19595, -19758, -19917, -20078, -20237, -20395, 
-        -20555, -20712, -20871, -21028, -21185, -21341, -21497, -21654, -21809, -21964, -22120, -22273, 
-        -22425, -22579, -22731, -22883, -23036, -23186, -23338, -23486, -23636, -23784, -23932, -24081, 
-        -24227, -24373, -24519, -24665, -24809, -24953, -25096, -25238, -25379, -25520, -25661, -25801, 
-        -25939, -26078, -26215, -26352, -26487, -26622, -26755, -26888, -27021, -27153, -27283, -27413, 
-        -27541, -27669, -27795, -27921, -28047, -28170, -28294, -28416, -28535, -28655, -28772, -28890, 
-        -29007, -29121, -29233, -29348, -29459, -29568, -29677, -29783, -29890, -29994, -30096, -30199, 
-        -30298, -30398, -30495, -30590, -30684, -30775, -30867, -30958, -31043, -31130, -31214, -31297, 
-        -31378, -31455, -31533, -31607, -31680, -31750, -31820, -31886, -31953, -32015, -32075, -32135, 
-        -32189, -32243, -32294, -32344, -32390, -32435, -32477, -32516, -32550, -32584, -32615, -32644, 
-        -32669, -32693, -32712, -32729, -32744, -32753, -32763, -32766, -32767, -32764, -32760, -32750, 
-        -32739, -32723, -32704, -32679, -32653, -32622, -32587, -32550, -32508, -32460, -32408, -32352, 
-        -32294, -32230, -32161, -32088, -32012, -31929, -31839, -31749, -31650, -31549, -31441, -31330, 
-        -31207, -31020, -30688, -30192, -29560, -28831, -28024, -27162, -26260, -25329, -24376, -23410, 
-        -22433, -21454, -20470, -19487, -18505, -17527, -16549, -15576, -14606, -13641, -12681, -11724, 
-        -10771, -9820, -8873, -7931, -6991, -6055, -5117, -4186, -3253, -2321, -1393, -464 
-    };
-
-    // AKWF_R_sym_saw_08 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_08[600] PROGMEM = {
-        544, 1631, 2723, 3815, 4907, 6007, 7105, 8209, 9316, 10430, 11549, 12675, 
-        13804, 14940, 16083, 17230, 18385, 19541, 20702, 21859, 23010, 24150, 25269, 26351, 
-        27381, 28332, 29170, 29841, 30294, 30548, 30715, 30870, 31016, 31156, 31288, 31413, 
-        31533, 31646, 31754, 31853, 31950, 32036, 32120, 32197, 32271, 32337, 32398, 32453, 
-        32504, 32551, 32591, 32629, 32660, 32688, 32712, 32732, 32744, 32757, 32763, 32767, 
-        32766, 32761, 32752, 32740, 32726, 32706, 32685, 32659, 32631, 32599, 32564, 32527, 
-        32485, 32442, 32396, 32347, 32295, 32241, 32185, 32125, 32064, 31999, 31933, 31864, 
-        31794, 31722, 31646, 31568, 31490, 31409, 31326, 31240, 31153, 31064, 30975, 30881, 
-        30788, 30692, 30596, 30496, 30396, 30294, 30191, 30087, 29981, 29875, 29765, 29654, 
-        29542, 29430, 29317, 29200, 29085, 28969, 28849, 28729, 28610, 28489, 28366, 28242, 
-        28116, 27990, 27864, 27736, 27608, 27478, 27348, 27216, 27085, 26953, 26820, 26685, 
-        26550, 26415, 26279, 26141, 26004, 25866, 25727, 25587, 25446, 25306, 25164, 25024, 
-        24878, 24737, 24595, 24451, 24305, 24159, 24012, 23868, 23720, 23573, 23426, 23279, 
-        23130, 22981, 22831, 22682, 22532, 22382, 22231, 22079, 21929, 21776, 21624, 21472, 
-        21319, 21165, 21012, 20859, 20704, 20550, 20396, 20241, 20087, 19931, 19774, 19620, 
-        19462, 19305, 19149, 18992, 18836, 18679, 18520, 18363, 18204, 18046, 17888, 17730, 
-        17572, 17413, 17253, 17094, 16936, 16776, 16615, 16456, 16298, 16135, 15976, 15816, 
-        15655, 15494, 15333, 15172, 15009, 14850, 14689, 14526, 14365, 14203, 14040, 13881, 
-        13716, 13554, 13394, 13232, 13069, 12907, 12743, 12582, 12417, 12256, 12092, 11930, 
-        11766, 11603, 11441, 11278, 11114, 10950, 10786, 10623, 10459, 10295, 10132, 9968, 
-        9804, 9642, 9477, 9313, 9149, 8985, 8821, 8657, 8491, 8327, 8163, 8001, 
-        7835, 7671, 7505, 7341, 7177, 7011, 6847, 6683, 6519, 6353, 6189, 6024, 
-        5860, 5695, 5530, 5366, 5200, 5034, 4870, 4706, 4541, 4377, 4211, 4045, 
-        3881, 3716, 3548, 3386, 3220, 3055, 2889, 2725, 2559, 2395, 2229, 2064, 
-        1900, 1734, 1567, 1404, 1237, 1075, 909, 743, 578, 412, 248, 82, 
-        -82, -248, -412, -578, -743, -909, -1075, -1237, -1404, -1567, -1734, -1900, 
-        -2064, -2229, -2395, -2559, -2725, -2889, -3055, -3220, -3386, -3548, -3716, -3881, 
-        -4045, -4211, -4377, -4541, -4706, -4870, -5034, -5200, -5366, -5530, -5695, -5860, 
-        -6024, -6189, -6353, -6519, -6683, -6847, -7011, -7177, -7341, -7505, -7671, -7835, 
-        -8001, -8163, -8327, -8491, -8657, -8821, -8985, -9149, -9313, -9477, -9642, -9804, 
-        -9968, -10132, -10295, -10459, -10623, -10786, -10950, -11114, -11278, -11441, -11603, -11766, 
-        -11930, -12092, -12256, -12417, -12582, -12743, -12907, -13069, -13232, -13394, -13554, -13716, 
-        -13881, -14040, -14203, -14365, -14526, -14689, -14850, -15009, -15172, -15333, -15494, -15655, 
-        -15816, -15976, -16135, -16298, -16456, -16615, -16776, -16936, -17094, -17253, -17413, -17572, 
-        -17730, -17888, -18046, -18204, -18363, -18520, -18679, -18836, -18992, -19149, -19305, -19462, 
-        -19620, -19774, -19931, -20087, -20241, -20396, -20550, -20704, -20859, -21012, -21165, -21319, 
-        -21472, -21624, -21776, -21929, -22079, -22231, -22382, -22532, -22682, -22831, -22981, -23130, 
-        -23279, -23426, -23573, -23720, -23868, -24012, -24159, -24305, -24451, -24595, -24737, -24878, 
-        -25024, -25164, -25306, -25446, -25587, -25727, -25866, -26004, -26141, -26279, -26415, -26550, 
-        -26685, -26820, -26953, -27085, -27216, -27348, -27478, -27608, -27736, -27864, -27990, -28116, 
-        -28242, -28366, -28489, -28610, -28729, -28849, -28969, -29085, -29200, -29317, -29430, -29542, 
-        -29654, -29765, -29875, -29981, -30087, -30191, -30294, -30396, -30496, -30596, -30692, -30788, 
-        -30881, -30975, -31064, -31153, -31240, -31326, -31409, -31490, -31568, -31646, -31722, -31794, 
-        -31864, -31933, -31999, -32064, -32125, -32185, -32241, -32295, -32347, -32396, -32442, -32485, 
-        -32527, -32564, -32599, -32631, -32659, -32685, -32706, -32726, -32740, -32752, -32761, -32766, 
-        -32767, -32763, -32757, -32744, -32732, -32712, -32688, -32660, -32629, -32591, -32551, -32504, 
-        -32453, -32398, -32337, -32271, -32197, -32120, -32036, -31950, -31853, -31754, -31646, -31533, 
-        -31413, -31288, -31156, -31016, -30870, -30715, -30548, -30294, -29841, -29170, -28332, -27381, 
-        -26351, -25269, -24150, -23010, -21859, -20702, -19541, -18385, -17230, -16083, -14940, -13804, 
-        -12675, -11549, -10430, -9316, -8209, -7105, -6007, -4907, -3815, -2723, -1631, -544 
-    };
-
-    // AKWF_R_sym_saw_09 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_09[600] PROGMEM = {
-        640, 1921, 3205, 4491, 5780, 7077, 8375, 9684, 10997, 12319, 13649, 14991, 
-        16341, 17699, 19064, 20434, 21799, 23155, 24487, 25775, 26984, 28071, 28959, 29567, 
-        29908, 30127, 30328, 30517, 30697, 30868, 31030, 31184, 31329, 31465, 31593, 31715, 
-        31828, 31934, 32032, 32123, 32206, 32285, 32355, 32422, 32480, 32534, 32580, 32623, 
-        32657, 32689, 32714, 32735, 32750, 32760, 32766, 32767, 32766, 32759, 32747, 32733, 
-        32712, 32690, 32663, 32632, 32599, 32564, 32522, 32477, 32431, 32382, 32328, 32272, 
-        32214, 32151, 32089, 32022, 31953, 31882, 31807, 31731, 31652, 31572, 31490, 31405, 
-        31317, 31231, 31137, 31047, 30953, 30856, 30758, 30659, 30558, 30456, 30351, 30246, 
-        30140, 30031, 29921, 29809, 29698, 29585, 29470, 29352, 29236, 29117, 28998, 28879, 
-        28758, 28635, 28513, 28388, 28263, 28136, 28011, 27882, 27754, 27624, 27494, 27363, 
-        27232, 27098, 26966, 26834, 26698, 26563, 26429, 26292, 26156, 26019, 25879, 25742, 
-        25604, 25464, 25324, 25184, 25041, 24901, 24760, 24617, 24474, 24331, 24188, 24045, 
-        23901, 23756, 23612, 23468, 23322, 23176, 23030, 22884, 22737, 22591, 22442, 22296, 
-        22147, 22000, 21851, 21702, 21555, 21406, 21257, 21106, 20956, 20807, 20657, 20506, 
-        20356, 20206, 20057, 19905, 19753, 19603, 19451, 19301, 19149, 18997, 18844, 18693, 
-        18540, 18388, 18235, 18083, 17931, 17778, 17624, 17471, 17319, 17166, 17012, 16859, 
-        16706, 16552, 16398, 16246, 16091, 15938, 15783, 15629, 15476, 15321, 15168, 15013, 
-        14858, 14703, 14550, 14397, 14242, 14087, 13932, 13778, 13623, 13466, 13312, 13157, 
-        13003, 12847, 12692, 12539, 12384, 12228, 12073, 11918, 11762, 11607, 11451, 11297, 
-        11141, 10985, 10831, 10675, 10519, 10365, 10209, 10054, 9898, 9743, 9585, 9430, 
-        9276, 9118, 8965, 8808, 8653, 8497, 8341, 8184, 8030, 7873, 7718, 7562, 
-        7406, 7251, 7096, 6940, 6784, 6626, 6472, 6315, 6160, 6003, 5849, 5692, 
-        5536, 5380, 5225, 5069, 4914, 4757, 4601, 4445, 4288, 4134, 3977, 3820, 
-        3665, 3510, 3354, 3197, 3041, 2886, 2730, 2573, 2417, 2261, 2106, 1950, 
-        1793, 1639, 1482, 1326, 1170, 1013, 857, 699, 546, 390, 233, 77, 
-        -77, -233, -390, -546, -699, -857, -1013, -1170, -1326, -1482, -1639, -1793, 
-        -1950, -2106, -2261, -2417, -2573, -2730, -2886, -3041, -3197, -3354, -3510, -3665, 
-        -3820, -3977, -4134, -4288, -4445, -4601, -4757, -4914, -5069, -5225, -5380, -5536, 
-        -5692, -5849, -6003, -6160, -6315, -6472, -6626, -6784, -6940, -7096, -7251, -7406, 
-        -7562, -7718, -7873, -8030, -8184, -8341, -8497, -8653, -8808, -8965, -9118, -9276, 
-        -9430, -9585, -9743, -9898, -10054, -10209, -10365, -10519, -10675, -10831, -10985, -11141, 
-        -11297, -11451, -11607, -11762, -11918, -12073, -12228, -12384, -12539, -12692, -12847, -13003, 
-        -13157, -13312, -13466, -13623, -13778, -13932, -14087, -14242, -14397, -14550, -14703, -14858, 
-        -15013, -15168, -15321, -15476, -15629, -15783, -15938, -16091, -16246, -16398, -16552, -16706, 
-        -16859, -17012, -17166, -17319, -17471, -17624, -17778, -17931, -18083, -18235, -18388, -18540, 
-        -18693, -18844, -18997, -19149, -19301, -19451, -19603, -19753, -19905, -20057, -20206, -20356, 
-        -20506, -20657, -20807, -20956, -21106, -21257, -21406, -21555, -21702, -21851, -22000, -22147, 
-        -22296, -22442, -22591, -22737, -22884, -23030, -23176, -23322, -23468, -23612, -23756, -23901, 
-        -24045, -24188, -24331, -24474, -24617, -24760, -24901, -25041, -25184, -25324, -25464, -25604, 
-        -25742, -25879, -26019, -26156, -26292, -26429, -26563, -26698, -26834, -26966, -27098, -27232, 
-        -27363, -27494, -27624, -27754, -27882, -28011, -28136, -28263, -28388, -28513, -28635, -28758, 
-        -28879, -28998, -29117, -29236, -29352, -29470, -29585, -29698, -29809, -29921, -30031, -30140, 
-        -30246, -30351, -30456, -30558, -30659, -30758, -30856, -30953, -31047, -31137, -31231, -31317, 
-        -31405, -31490, -31572, -31652, -31731, -31807, -31882, -31953, -32022, -32089, -32151, -32214, 
-        -32272, -32328, -32382, -32431, -32477, -32522, -32564, -32599, -32632, -32663, -32690, -32712, 
-        -32733, -32747, -32759, -32766, -32767, -32766, -32760, -32750, -32735, -32714, -32689, -32657, 
-        -32623, -32580, -32534, -32480, -32422, -32355, -32285, -32206, -32123, -32032, -31934, -31828, 
-        -31715, -31593, -31465, -31329, -31184, -31030, -30868, -30697, -30517, -30328, -30127, -29908, 
-        -29567, -28959, -28071, -26984, -25775, -24487, -23155, -21799, -20434, -19064, -17699, -16341, 
-        -14991, -13649, -12319, -10997, -9684, -8375, -7077, -5780, -4491, -3205, -1921, -640 
-    };
-
-    // AKWF_R_sym_saw_10 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_10[600] PROGMEM = {
-        751, 2253, 3760, 5269, 6785, 8308, 9843, 11389, 12947, 14518, 16105, 17704, 
-        19311, 20923, 22524, 24095, 25601, 26983, 28135, 28930, 29371, 29647, 29895, 30131, 
-        30354, 30562, 30761, 30947, 31123, 31286, 31440, 31582, 31716, 31841, 31957, 32062, 
-        32159, 32248, 32329, 32404, 32469, 32527, 32579, 32624, 32663, 32695, 32720, 32740, 
-        32754, 32763, 32767, 32763, 32759, 32746, 32731, 32710, 32685, 32656, 32623, 32585, 
-        32546, 32501, 32452, 32400, 32346, 32288, 32226, 32164, 32096, 32025, 31952, 31877, 
-        31800, 31721, 31638, 31553, 31467, 31379, 31286, 31194, 31099, 31002, 30904, 30804, 
-        30703, 30598, 30493, 30387, 30280, 30170, 30058, 29948, 29834, 29719, 29604, 29486, 
-        29369, 29249, 29132, 29009, 28885, 28764, 28641, 28516, 28390, 28264, 28137, 28009, 
-        27881, 27752, 27621, 27491, 27359, 27227, 27096, 26963, 26829, 26695, 26560, 26425, 
-        26289, 26155, 26017, 25881, 25743, 25604, 25467, 25328, 25190, 25051, 24911, 24770, 
-        24631, 24489, 24350, 24208, 24068, 23925, 23784, 23642, 23499, 23358, 23215, 23072, 
-        22930, 22785, 22642, 22498, 22355, 22210, 22065, 21922, 21779, 21632, 21488, 21343, 
-        21198, 21052, 20908, 20761, 20616, 20470, 20323, 20180, 20034, 19888, 19741, 19595, 
-        19447, 19303, 19156, 19009, 18862, 18716, 18569, 18422, 18275, 18128, 17981, 17833, 
-        17687, 17539, 17393, 17245, 17099, 16951, 16803, 16656, 16509, 16362, 16214, 16065, 
-        15919, 15771, 15623, 15476, 15328, 15180, 15033, 14885, 14736, 14589, 14442, 14294, 
-        14145, 13997, 13850, 13702, 13554, 13406, 13257, 13110, 12962, 12813, 12667, 12517, 
-        12370, 12222, 12073, 11925, 11777, 11628, 11481, 11333, 11185, 11038, 10888, 10741, 
-        10592, 10444, 10296, 10148, 9999, 9852, 9704, 9555, 9407, 9258, 9110, 8964, 
-        8815, 8666, 8519, 8370, 8223, 8073, 7926, 7778, 7629, 7481, 7332, 7184, 
-        7037, 6888, 6740, 6592, 6445, 6295, 6148, 6000, 5851, 5703, 5555, 5406, 
-        5257, 5111, 4963, 4814, 4666, 4517, 4370, 4220, 4073, 3925, 3776, 3628, 
-        3480, 3333, 3184, 3037, 2887, 2739, 2591, 2442, 2296, 2147, 1999, 1850, 
-        1702, 1555, 1405, 1258, 1110, 962, 813, 666, 518, 370, 221, 72, 
-        -72, -221, -370, -518, -666, -813, -962, -1110, -1258, -1405, -1555, -1702, 
-        -1850, -1999, -2147, -2296, -2442, -2591, -2739, -2887, -3037, -3184, -3333, -3480, 
-        -3628, -3776, -3925, -4073, -4220, -4370, -4517, -4666, -4814, -4963, -5111, -5257, 
-        -5406, -5555, -5703, -5851, -6000, -6148, -6295, -6445, -6592, -6740, -6888, -7037, 
-        -7184, -7332, -7481, -7629, -7778, -7926, -8073, -8223, -8370, -8519, -8666, -8815, 
-        -8964, -9110, -9258, -9407, -9555, -9704, -9852, -9999, -10148, -10296, -10444, -10592, 
-        -10741, -10888, -11038, -11185, -11333, -11481, -11628, -11777, -11925, -12073, -12222, -12370, 
-        -12517, -12667, -12813, -12962, -13110, -13257, -13406, -13554, -13702, -13850, -13997, -14145, 
-        -14294, -14442, -14589, -14736, -14885, -15033, -15180, -15328, -15476, -15623, -15771, -15919, 
-        -16065, -16214, -16362, -16509, -16656, -16803, -16951, -17099, -17245, -17393, -17539, -17687, 
-        -17833, -17981, -18128, -18275, -18422, -18569, -18716, -18862, -19009, -19156, -19303, -19447, 
-        -19595, -19741, -19888, -20034, -20180, -20323, -20470, -20616, -20761, -20908, -21052, -21198, 
-        -21343, -21488, -21632, -21779, -21922, -22065, -22210, -22355, -22498, -22642, -22785, -22930, 
-        -23072, -23215, -23358, -23499, -23642, -23784, -23925, -24068, -24208, -24350, -24489, -24631, 
-        -24770, -24911, -25051, -25190, -25328, -25467, -25604, -25743, -25881, -26017, -26155, -26289, 
-        -26425, -26560, -26695, -26829, -26963, -27096, -27227, -27359, -27491, -27621, -27752, -27881, 
-        -28009, -28137, -28264, -28390, -28516, -28641, -28764, -28885, -29009, -29132, -29249, -29369, 
-        -29486, -29604, -29719, -29834, -29948, -30058, -30170, -30280, -30387, -30493, -30598, -30703, 
-        -30804, -30904, -31002, -31099, -31194, -31286, -31379, -31467, -31553, -31638, -31721, -31800, 
-        -31877, -31952, -32025, -32096, -32164, -32226, -32288, -32346, -32400, -32452, -32501, -32546, 
-        -32585, -32623, -32656, -32685, -32710, -32731, -32746, -32759, -32763, -32767, -32763, -32754, 
-        -32740, -32720, -32695, -32663, -32624, -32579, -32527, -32469, -32404, -32329, -32248, -32159, 
-        -32062, -31957, -31841, -31716, -31582, -31440, -31286, -31123, -30947, -30761, -30562, -30354, 
-        -30131, -29895, -29647, -29371, -28930, -28135, -26983, -25601, -24095, -22524, -20923, -19311, 
-        -17704, -16105, -14518, -12947, -11389, -9843, -8308, -6785, -5269, -3760, -2253, -751 
-    };
-
-    // AKWF_R_sym_saw_11 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_11[600] PROGMEM = {
-        909, 2732, 4560, 6398, 8247, 10109, 11988, 13885, 15802, 17735, 19673, 21599, 
-        23479, 25241, 26750, 27813, 28407, 28776, 29105, 29416, 29709, 29985, 30243, 30484, 
-        30710, 30921, 31118, 31299, 31469, 31626, 31771, 31904, 32024, 32135, 32235, 32327, 
-        32406, 32477, 32541, 32595, 32641, 32680, 32712, 32735, 32752, 32763, 32767, 32765, 
-        32758, 32743, 32726, 32702, 32674, 32641, 32603, 32561, 32514, 32465, 32409, 32353, 
-        32292, 32227, 32159, 32088, 32014, 31938, 31858, 31776, 31691, 31605, 31516, 31424, 
-        31329, 31233, 31135, 31037, 30934, 30832, 30727, 30620, 30513, 30403, 30293, 30179, 
-        30066, 29951, 29837, 29719, 29602, 29481, 29361, 29241, 29119, 28996, 28872, 28748, 
-        28622, 28497, 28368, 28242, 28112, 27985, 27856, 27726, 27595, 27464, 27332, 27200, 
-        27069, 26935, 26801, 26668, 26533, 26397, 26264, 26128, 25992, 25858, 25721, 25583, 
-        25447, 25310, 25173, 25037, 24898, 24761, 24622, 24483, 24344, 24207, 24067, 23930, 
-        23788, 23649, 23509, 23370, 23230, 23090, 22950, 22808, 22669, 22529, 22388, 22246, 
-        22107, 21966, 21825, 21682, 21542, 21402, 21261, 21118, 20977, 20836, 20694, 20551, 
-        20411, 20269, 20128, 19986, 19843, 19702, 19560, 19418, 19277, 19134, 18992, 18851, 
-        18709, 18566, 18425, 18283, 18140, 17997, 17855, 17714, 17572, 17428, 17286, 17145, 
-        17002, 16859, 16718, 16575, 16432, 16289, 16148, 16006, 15863, 15722, 15579, 15436, 
-        15294, 15150, 15009, 14866, 14723, 14582, 14439, 14297, 14154, 14013, 13870, 13728, 
-        13585, 13442, 13299, 13157, 13014, 12873, 12731, 12587, 12445, 12302, 12161, 12018, 
-        11876, 11733, 11590, 11448, 11305, 11164, 11021, 10879, 10738, 10595, 10453, 10309, 
-        10167, 10025, 9882, 9739, 9599, 9456, 9312, 9172, 9029, 8886, 8744, 8602, 
-        8459, 8318, 8175, 8033, 7892, 7747, 7606, 7463, 7321, 7179, 7038, 6893, 
-        6752, 6610, 6467, 6326, 6184, 6041, 5900, 5757, 5614, 5472, 5330, 5187, 
-        5046, 4904, 4763, 4620, 4477, 4335, 4192, 4050, 3907, 3764, 3626, 3483, 
-        3340, 3198, 3055, 2913, 2770, 2629, 2486, 2344, 2203, 2061, 1918, 1776, 
-        1633, 1492, 1350, 1207, 1064, 923, 780, 638, 496, 355, 212, 72, 
-        -72, -212, -355, -496, -638, -780, -923, -1064, -1207, -1350, -1492, -1633, 
-        -1776, -1918, -2061, -2203, -2344, -2486, -2629, -2770, -2913, -3055, -3198, -3340, 
-        -3483, -3626, -3764, -3907, -4050, -4192, -4335, -4477, -4620, -4763, -4904, -5046, 
-        -5187, -5330, -5472, -5614, -5757, -5900, -6041, -6184, -6326, -6467, -6610, -6752, 
-        -6893, -7038, -7179, -7321, -7463, -7606, -7747, -7892, -8033, -8175, -8318, -8459, 
-        -8602, -8744, -8886, -9029, -9172, -9312, -9456, -9599, -9739, -9882, -10025, -10167, 
-        -10309, -10453, -10595, -10738, -10879, -11021, -11164, -11305, -11448, -11590, -11733, -11876, 
-        -12018, -12161, -12302, -12445, -12587, -12731, -12873, -13014, -13157, -13299, -13442, -13585, 
-        -13728, -13870, -14013, -14154, -14297, -14439, -14582, -14723, -14866, -15009, -15150, -15294, 
-        -15436, -15579, -15722, -15863, -16006, -16148, -16289, -16432, -16575, -16718, -16859, -17002, 
-        -17145, -17286, -17428, -17572, -17714, -17855, -17997, -18140, -18283, -18425, -18566, -18709, 
-        -18851, -18992, -19134, -19277, -19418, -19560, -19702, -19843, -19986, -20128, -20269, -20411, 
-        -20551, -20694, -20836, -20977, -21118, -21261, -21402, -21542, -21682, -21825, -21966, -22107, 
-        -22246, -22388, -22529, -22669, -22808, -22950, -23090, -23230, -23370, -23509, -23649, -23788, 
-        -23930, -24067, -24207, -24344, -24483, -24622, -24761, -24898, -25037, -25173, -25310, -25447, 
-        -25583, -25721, -25858, -25992, -26128, -26264, -26397, -26533, -26668, -26801, -26935, -27069, 
-        -27200, -27332, -27464, -27595, -27726, -27856, -27985, -28112, -28242, -28368, -28497, -28622, 
-        -28748, -28872, -28996, -29119, -29241, -29361, -29481, -29602, -29719, -29837, -29951, -30066, 
-        -30179, -30293, -30403, -30513, -30620, -30727, -30832, -30934, -31037, -31135, -31233, -31329, 
-        -31424, -31516, -31605, -31691, -31776, -31858, -31938, -32014, -32088, -32159, -32227, -32292, 
-        -32353, -32409, -32465, -32514, -32561, -32603, -32641, -32674, -32702, -32726, -32743, -32758, 
-        -32765, -32767, -32763, -32752, -32735, -32712, -32680, -32641, -32595, -32541, -32477, -32406, 
-        -32327, -32235, -32135, -32024, -31904, -31771, -31626, -31469, -31299, -31118, -30921, -30710, 
-        -30484, -30243, -29985, -29709, -29416, -29105, -28776, -28407, -27813, -26750, -25241, -23479, 
-        -21599, -19673, -17735, -15802, -13885, -11988, -10109, -8247, -6398, -4560, -2732, -909 
-    };
-
-    // AKWF_R_sym_saw_12 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_12[600] PROGMEM = {
-        1091, 3279, 5474, 7683, 9914, 12169, 14448, 16751, 19064, 21358, 23554, 25486, 
-        26869, 27642, 28112, 28526, 28917, 29278, 29616, 29931, 30225, 30498, 30749, 30981, 
-        31195, 31391, 31572, 31737, 31888, 32022, 32145, 32255, 32350, 32436, 32510, 32574, 
-        32629, 32673, 32708, 32736, 32754, 32763, 32767, 32763, 32754, 32737, 32715, 32687, 
-        32652, 32614, 32568, 32521, 32468, 32411, 32349, 32284, 32216, 32144, 32068, 31990, 
-        31907, 31824, 31737, 31648, 31554, 31461, 31362, 31264, 31164, 31062, 30958, 30851, 
-        30743, 30634, 30523, 30412, 30298, 30185, 30067, 29950, 29833, 29713, 29594, 29472, 
-        29350, 29228, 29105, 28980, 28856, 28730, 28605, 28476, 28348, 28221, 28093, 27963, 
-        27834, 27705, 27574, 27444, 27312, 27182, 27049, 26916, 26784, 26652, 26518, 26385, 
-        26252, 26117, 25984, 25850, 25716, 25580, 25445, 25311, 25175, 25039, 24905, 24769, 
-        24633, 24496, 24360, 24226, 24089, 23953, 23816, 23679, 23543, 23406, 23270, 23133, 
-        22995, 22860, 22722, 22585, 22448, 22312, 22175, 22038, 21901, 21764, 21626, 21489, 
-        21351, 21215, 21076, 20939, 20802, 20665, 20526, 20389, 20250, 20113, 19976, 19839, 
-        19700, 19564, 19426, 19289, 19150, 19013, 18876, 18737, 18600, 18463, 18326, 18188, 
-        18050, 17913, 17775, 17638, 17500, 17361, 17225, 17087, 16948, 16812, 16674, 16537, 
-        16399, 16261, 16124, 15986, 15848, 15711, 15574, 15436, 15298, 15161, 15023, 14886, 
-        14748, 14610, 14473, 14335, 14198, 14060, 13923, 13786, 13649, 13510, 13373, 13236, 
-        13097, 12960, 12823, 12686, 12549, 12413, 12274, 12137, 12000, 11861, 11725, 11587, 
-        11450, 11312, 11174, 11038, 10901, 10762, 10625, 10488, 10351, 10214, 10076, 9939, 
-        9802, 9665, 9528, 9390, 9253, 9116, 8979, 8840, 8705, 8567, 8429, 8293, 
-        8154, 8019, 7881, 7744, 7607, 7470, 7333, 7194, 7058, 6921, 6783, 6647, 
-        6510, 6372, 6234, 6098, 5959, 5824, 5686, 5549, 5413, 5275, 5139, 5001, 
-        4863, 4726, 4590, 4452, 4315, 4179, 4042, 3904, 3767, 3630, 3494, 3356, 
-        3219, 3081, 2946, 2807, 2671, 2534, 2397, 2260, 2122, 1985, 1848, 1711, 
-        1574, 1438, 1301, 1164, 1026, 889, 752, 616, 479, 342, 205, 67, 
-        -67, -205, -342, -479, -616, -752, -889, -1026, -1164, -1301, -1438, -1574, 
-        -1711, -1848, -1985, -2122, -2260, -2397, -2534, -2671, -2807, -2946, -3081, -3219, 
-        -3356, -3494, -3630, -3767, -3904, -4042, -4179, -4315, -4452, -4590, -4726, -4863, 
-        -5001, -5139, -5275, -5413, -5549, -5686, -5824, -5959, -6098, -6234, -6372, -6510, 
-        -6647, -6783, -6921, -7058, -7194, -7333, -7470, -7607, -7744, -7881, -8019, -8154, 
-        -8293, -8429, -8567, -8705, -8840, -8979, -9116, -9253, -9390, -9528, -9665, -9802, 
-        -9939, -10076, -10214, -10351, -10488, -10625, -10762, -10901, -11038, -11174, -11312, -11450, 
-        -11587, -11725, -11861, -12000, -12137, -12274, -12413, -12549, -12686, -12823, -12960, -13097, 
-        -13236, -13373, -13510, -13649, -13786, -13923, -14060, -14198, -14335, -14473, -14610, -14748, 
-        -14886, -15023, -15161, -15298, -15436, -15574, -15711, -15848, -15986, -16124, -16261, -16399, 
-        -16537, -16674, -16812, -16948, -17087, -17225, -17361, -17500, -17638, -17775, -17913, -18050, 
-        -18188, -18326, -18463, -18600, -18737, -18876, -19013, -19150, -19289, -19426, -19564, -19700, 
-        -19839, -19976, -20113, -20250, -20389, -20526, -20665, -20802, -20939, -21076, -21215, -21351, 
-        -21489, -21626, -21764, -21901, -22038, -22175, -22312, -22448, -22585, -22722, -22860, -22995, 
-        -23133, -23270, -23406, -23543, -23679, -23816, -23953, -24089, -24226, -24360, -24496, -24633, 
-        -24769, -24905, -25039, -25175, -25311, -25445, -25580, -25716, -25850, -25984, -26117, -26252, 
-        -26385, -26518, -26652, -26784, -26916, -27049, -27182, -27312, -27444, -27574, -27705, -27834, 
-        -27963, -28093, -28221, -28348, -28476, -28605, -28730, -28856, -28980, -29105, -29228, -29350, 
-        -29472, -29594, -29713, -29833, -29950, -30067, -30185, -30298, -30412, -30523, -30634, -30743, 
-        -30851, -30958, -31062, -31164, -31264, -31362, -31461, -31554, -31648, -31737, -31824, -31907, 
-        -31990, -32068, -32144, -32216, -32284, -32349, -32411, -32468, -32521, -32568, -32614, -32652, 
-        -32687, -32715, -32737, -32754, -32763, -32767, -32763, -32754, -32736, -32708, -32673, -32629, 
-        -32574, -32510, -32436, -32350, -32255, -32145, -32022, -31888, -31737, -31572, -31391, -31195, 
-        -30981, -30749, -30498, -30225, -29931, -29616, -29278, -28917, -28526, -28112, -27642, -26869, 
-        -25486, -23554, -21358, -19064, -16751, -14448, -12169, -9914, -7683, -5474, -3279, -1091 
-    };
-
-    // AKWF_R_sym_saw_13 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_13[600] PROGMEM = {
-        1272, 3823, 6390, 8980, 11603, 14261, 16957, 19665, 22317, 24709, 26449, 27408, 
-        27962, 28442, 28890, 29301, 29682, 30031, 30351, 30647, 30915, 31160, 31381, 31582, 
-        31763, 31928, 32073, 32202, 32314, 32412, 32498, 32569, 32629, 32678, 32715, 32742, 
-        32759, 32767, 32767, 32759, 32743, 32721, 32693, 32656, 32616, 32568, 32516, 32458, 
-        32397, 32332, 32261, 32188, 32111, 32029, 31945, 31860, 31769, 31677, 31582, 31484, 
-        31385, 31283, 31179, 31074, 30966, 30858, 30747, 30636, 30523, 30409, 30293, 30176, 
-        30058, 29940, 29821, 29700, 29578, 29456, 29333, 29210, 29085, 28960, 28836, 28709, 
-        28583, 28457, 28329, 28202, 28073, 27945, 27815, 27688, 27559, 27427, 27297, 27168, 
-        27036, 26906, 26776, 26644, 26513, 26382, 26249, 26118, 25988, 25855, 25722, 25590, 
-        25458, 25325, 25193, 25061, 24928, 24795, 24662, 24529, 24396, 24263, 24130, 23997, 
-        23864, 23731, 23598, 23465, 23331, 23198, 23065, 22932, 22798, 22665, 22532, 22398, 
-        22265, 22132, 21999, 21864, 21731, 21597, 21463, 21331, 21197, 21064, 20931, 20796, 
-        20664, 20529, 20398, 20263, 20129, 19996, 19863, 19730, 19596, 19463, 19330, 19195, 
-        19062, 18930, 18795, 18662, 18528, 18396, 18262, 18129, 17995, 17862, 17729, 17596, 
-        17461, 17329, 17196, 17061, 16930, 16795, 16662, 16529, 16396, 16262, 16130, 15996, 
-        15863, 15729, 15596, 15463, 15330, 15198, 15065, 14931, 14798, 14665, 14531, 14399, 
-        14266, 14132, 13999, 13867, 13733, 13600, 13468, 13334, 13201, 13068, 12935, 12802, 
-        12671, 12536, 12403, 12270, 12139, 12004, 11873, 11740, 11606, 11473, 11341, 11208, 
-        11075, 10942, 10809, 10676, 10545, 10410, 10277, 10144, 10013, 9878, 9747, 9614, 
-        9481, 9348, 9215, 9082, 8950, 8817, 8684, 8553, 8418, 8285, 8152, 8021, 
-        7887, 7755, 7623, 7489, 7357, 7226, 7091, 6960, 6827, 6694, 6561, 6429, 
-        6296, 6163, 6030, 5897, 5765, 5633, 5500, 5368, 5234, 5102, 4969, 4836, 
-        4705, 4572, 4439, 4307, 4173, 4041, 3910, 3775, 3644, 3511, 3378, 3246, 
-        3113, 2980, 2847, 2716, 2581, 2450, 2317, 2185, 2052, 1921, 1788, 1655, 
-        1523, 1390, 1257, 1126, 993, 861, 727, 595, 462, 331, 198, 66, 
-        -66, -198, -331, -462, -595, -727, -861, -993, -1126, -1257, -1390, -1523, 
-        -1655, -1788, -1921, -2052, -2185, -2317, -2450, -2581, -2716, -2847, -2980, -3113, 
-        -3246, -3378, -3511, -3644, -3775, -3910, -4041, -4173, -4307, -4439, -4572, -4705, 
-        -4836, -4969, -5102, -5234, -5368, -5500, -5633, -5765, -5897, -6030, -6163, -6296, 
-        -6429, -6561, -6694, -6827, -6960, -7091, -7226, -7357, -7489, -7623, -7755, -7887, 
-        -8021, -8152, -8285, -8418, -8553, -8684, -8817, -8950, -9082, -9215, -9348, -9481, 
-        -9614, -9747, -9878, -10013, -10144, -10277, -10410, -10545, -10676, -10809, -10942, -11075, 
-        -11208, -11341, -11473, -11606, -11740, -11873, -12004, -12139, -12270, -12403, -12536, -12671, 
-        -12802, -12935, -13068, -13201, -13334, -13468, -13600, -13733, -13867, -13999, -14132, -14266, 
-        -14399, -14531, -14665, -14798, -14931, -15065, -15198, -15330, -15463, -15596, -15729, -15863, 
-        -15996, -16130, -16262, -16396, -16529, -16662, -16795, -16930, -17061, -17196, -17329, -17461, 
-        -17596, -17729, -17862, -17995, -18129, -18262, -18396, -18528, -18662, -18795, -18930, -19062, 
-        -19195, -19330, -19463, -19596, -19730, -19863, -19996, -20129, -20263, -20398, -20529, -20664, 
-        -20796, -20931, -21064, -21197, -21331, -21463, -21597, -21731, -21864, -21999, -22132, -22265, 
-        -22398, -22532, -22665, -22798, -22932, -23065, -23198, -23331, -23465, -23598, -23731, -23864, 
-        -23997, -24130, -24263, -24396, -24529, -24662, -24795, -24928, -25061, -25193, -25325, -25458, 
-        -25590, -25722, -25855, -25988, -26118, -26249, -26382, -26513, -26644, -26776, -26906, -27036, 
-        -27168, -27297, -27427, -27559, -27688, -27815, -27945, -28073, -28202, -28329, -28457, -28583, 
-        -28709, -28836, -28960, -29085, -29210, -29333, -29456, -29578, -29700, -29821, -29940, -30058, 
-        -30176, -30293, -30409, -30523, -30636, -30747, -30858, -30966, -31074, -31179, -31283, -31385, 
-        -31484, -31582, -31677, -31769, -31860, -31945, -32029, -32111, -32188, -32261, -32332, -32397, 
-        -32458, -32516, -32568, -32616, -32656, -32693, -32721, -32743, -32759, -32767, -32767, -32759, 
-        -32742, -32715, -32678, -32629, -32569, -32498, -32412, -32314, -32202, -32073, -31928, -31763, 
-        -31582, -31381, -31160, -30915, -30647, -30351, -30031, -29682, -29301, -28890, -28442, -27962, 
-        -27408, -26449, -24709, -22317, -19665, -16957, -14261, -11603, -8980, -6390, -3823, -1272 
-    };
-
-    // AKWF_R_sym_saw_14 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_14[600] PROGMEM = {
-        1524, 4583, 7665, 10787, 13964, 17181, 20391, 23369, 25585, 26807, 27496, 28080, 
-        28619, 29108, 29556, 29961, 30329, 30660, 30961, 31229, 31470, 31684, 31874, 32041, 
-        32189, 32314, 32423, 32514, 32589, 32651, 32696, 32731, 32754, 32766, 32767, 32761, 
-        32743, 32719, 32688, 32648, 32601, 32550, 32492, 32428, 32362, 32290, 32213, 32133, 
-        32048, 31962, 31871, 31778, 31683, 31584, 31483, 31380, 31275, 31168, 31059, 30950, 
-        30838, 30725, 30609, 30494, 30379, 30261, 30142, 30022, 29901, 29780, 29658, 29536, 
-        29414, 29289, 29167, 29041, 28916, 28791, 28665, 28537, 28411, 28285, 28157, 28030, 
-        27904, 27774, 27646, 27517, 27390, 27262, 27132, 27003, 26874, 26746, 26615, 26487, 
-        26358, 26228, 26097, 25969, 25838, 25710, 25579, 25449, 25319, 25190, 25060, 24930, 
-        24798, 24669, 24539, 24409, 24279, 24149, 24017, 23888, 23758, 23628, 23498, 23366, 
-        23236, 23107, 22977, 22847, 22717, 22585, 22455, 22325, 22196, 22066, 21936, 21805, 
-        21675, 21544, 21415, 21285, 21155, 21024, 20894, 20764, 20634, 20504, 20372, 20243, 
-        20113, 19984, 19853, 19724, 19594, 19464, 19333, 19203, 19073, 18943, 18813, 18684, 
-        18554, 18423, 18295, 18163, 18034, 17904, 17774, 17644, 17515, 17385, 17255, 17126, 
-        16995, 16867, 16736, 16606, 16476, 16347, 16218, 16087, 15958, 15828, 15699, 15569, 
-        15440, 15310, 15181, 15051, 14921, 14792, 14662, 14531, 14403, 14274, 14144, 14013, 
-        13885, 13754, 13626, 13497, 13367, 13236, 13108, 12979, 12848, 12720, 12589, 12459, 
-        12332, 12202, 12073, 11943, 11812, 11684, 11555, 11425, 11296, 11167, 11037, 10908, 
-        10779, 10649, 10520, 10390, 10261, 10132, 10003, 9873, 9744, 9615, 9485, 9356, 
-        9228, 9099, 8970, 8838, 8710, 8581, 8452, 8322, 8194, 8064, 7935, 7806, 
-        7677, 7547, 7420, 7290, 7161, 7031, 6902, 6773, 6644, 6515, 6385, 6256, 
-        6127, 5999, 5870, 5741, 5611, 5483, 5353, 5224, 5094, 4965, 4838, 4707, 
-        4579, 4450, 4320, 4191, 4062, 3933, 3804, 3675, 3547, 3416, 3288, 3159, 
-        3030, 2901, 2772, 2643, 2515, 2386, 2257, 2128, 1999, 1869, 1740, 1611, 
-        1482, 1354, 1223, 1096, 967, 838, 708, 579, 452, 323, 193, 64, 
-        -64, -193, -323, -452, -579, -708, -838, -967, -1096, -1223, -1354, -1482, 
-        -1611, -1740, -1869, -1999, -2128, -2257, -2386, -2515, -2643, -2772, -2901, -3030, 
-        -3159, -3288, -3416, -3547, -3675, -3804, -3933, -4062, -4191, -4320, -4450, -4579, 
-        -4707, -4838, -4965, -5094, -5224, -5353, -5483, -5611, -5741, -5870, -5999, -6127, 
-        -6256, -6385, -6515, -6644, -6773, -6902, -7031, -7161, -7290, -7420, -7547, -7677, 
-        -7806, -7935, -8064, -8194, -8322, -8452, -8581, -8710, -8838, -8970, -9099, -9228, 
-        -9356, -9485, -9615, -9744, -9873, -10003, -10132, -10261, -10390, -10520, -10649, -10779, 
-        -10908, -11037, -11167, -11296, -11425, -11555, -11684, -11812, -11943, -12073, -12202, -12332, 
-        -12459, -12589, -12720, -12848, -12979, -13108, -13236, -13367, -13497, -13626, -13754, -13885, 
-        -14013, -14144, -14274, -14403, -14531, -14662, -14792, -14921, -15051, -15181, -15310, -15440, 
-        -15569, -15699, -15828, -15958, -16087, -16218, -16347, -16476, -16606, -16736, -16867, -16995, 
-        -17126, -17255, -17385, -17515, -17644, -17774, -17904, -18034, -18163, -18295, -18423, -18554, 
-        -18684, -18813, -18943, -19073, -19203, -19333, -19464, -19594, -19724, -19853, -19984, -20113, 
-        -20243, -20372, -20504, -20634, -20764, -20894, -21024, -21155, -21285, -21415, -21544, -21675, 
-        -21805, -21936, -22066, -22196, -22325, -22455, -22585, -22717, -22847, -22977, -23107, -23236, 
-        -23366, -23498, -23628, -23758, -23888, -24017, -24149, -24279, -24409, -24539, -24669, -24798, 
-        -24930, -25060, -25190, -25319, -25449, -25579, -25710, -25838, -25969, -26097, -26228, -26358, 
-        -26487, -26615, -26746, -26874, -27003, -27132, -27262, -27390, -27517, -27646, -27774, -27904, 
-        -28030, -28157, -28285, -28411, -28537, -28665, -28791, -28916, -29041, -29167, -29289, -29414, 
-        -29536, -29658, -29780, -29901, -30022, -30142, -30261, -30379, -30494, -30609, -30725, -30838, 
-        -30950, -31059, -31168, -31275, -31380, -31483, -31584, -31683, -31778, -31871, -31962, -32048, 
-        -32133, -32213, -32290, -32362, -32428, -32492, -32550, -32601, -32648, -32688, -32719, -32743, 
-        -32761, -32767, -32766, -32754, -32731, -32696, -32651, -32589, -32514, -32423, -32314, -32189, 
-        -32041, -31874, -31684, -31470, -31229, -30961, -30660, -30329, -29961, -29556, -29108, -28619, 
-        -28080, -27496, -26807, -25585, -23369, -20391, -17181, -13964, -10787, -7665, -4583, -1524 
-    };
-
-    // AKWF_R_sym_saw_15 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_15[600] PROGMEM = {
-        1720, 5179, 8674, 12238, 15886, 19593, 23132, 25811, 27249, 27994, 28610, 29169, 
-        29667, 30113, 30511, 30864, 31178, 31453, 31692, 31903, 32084, 32238, 32370, 32479, 
-        32569, 32640, 32693, 32732, 32757, 32767, 32767, 32757, 32735, 32704, 32666, 32619, 
-        32567, 32507, 32443, 32371, 32296, 32215, 32132, 32044, 31952, 31858, 31761, 31661, 
-        31558, 31455, 31349, 31240, 31129, 31019, 30906, 30791, 30676, 30559, 30442, 30323, 
-        30205, 30085, 29964, 29842, 29721, 29599, 29476, 29353, 29229, 29106, 28982, 28856, 
-        28731, 28607, 28482, 28356, 28231, 28104, 27978, 27853, 27726, 27599, 27473, 27346, 
-        27221, 27094, 26967, 26839, 26713, 26586, 26459, 26331, 26205, 26078, 25950, 25823, 
-        25697, 25569, 25442, 25314, 25188, 25060, 24934, 24806, 24680, 24552, 24424, 24298, 
-        24170, 24042, 23916, 23788, 23661, 23533, 23406, 23280, 23153, 23025, 22898, 22772, 
-        22645, 22518, 22390, 22264, 22136, 22009, 21883, 21755, 21629, 21501, 21375, 21248, 
-        21120, 20993, 20867, 20740, 20613, 20487, 20359, 20233, 20105, 19979, 19852, 19726, 
-        19599, 19472, 19346, 19219, 19092, 18966, 18839, 18711, 18586, 18458, 18332, 18206, 
-        18079, 17952, 17826, 17699, 17571, 17446, 17321, 17193, 17067, 16941, 16814, 16689, 
-        16561, 16434, 16307, 16181, 16054, 15927, 15802, 15675, 15549, 15422, 15296, 15170, 
-        15044, 14917, 14792, 14665, 14538, 14412, 14285, 14158, 14034, 13908, 13781, 13655, 
-        13528, 13403, 13277, 13149, 13024, 12897, 12772, 12645, 12520, 12393, 12267, 12140, 
-        12015, 11890, 11762, 11636, 11510, 11384, 11259, 11132, 11006, 10880, 10754, 10628, 
-        10502, 10377, 10250, 10123, 9999, 9873, 9746, 9621, 9494, 9369, 9242, 9117, 
-        8991, 8866, 8740, 8613, 8486, 8362, 8236, 8109, 7984, 7857, 7732, 7606, 
-        7480, 7353, 7229, 7104, 6976, 6851, 6725, 6600, 6473, 6348, 6221, 6096, 
-        5971, 5845, 5719, 5594, 5467, 5342, 5216, 5090, 4964, 4839, 4712, 4586, 
-        4460, 4335, 4209, 4085, 3958, 3833, 3706, 3581, 3455, 3330, 3205, 3077, 
-        2953, 2826, 2701, 2576, 2449, 2324, 2198, 2073, 1946, 1821, 1696, 1569, 
-        1445, 1319, 1193, 1067, 943, 816, 692, 565, 439, 313, 188, 63, 
-        -63, -188, -313, -439, -565, -692, -816, -943, -1067, -1193, -1319, -1445, 
-        -1569, -1696, -1821, -1946, -2073, -2198, -2324, -2449, -2576, -2701, -2826, -2953, 
-        -3077, -3205, -3330, -3455, -3581, -3706, -3833, -3958, -4085, -4209, -4335, -4460, 
-        -4586, -4712, -4839, -4964, -5090, -5216, -5342, -5467, -5594, -5719, -5845, -5971, 
-        -6096, -6221, -6348, -6473, -6600, -6725, -6851, -6976, -7104, -7229, -7353, -7480, 
-        -7606, -7732, -7857, -7984, -8109, -8236, -8362, -8486, -8613, -8740, -8866, -8991, 
-        -9117, -9242, -9369, -9494, -9621, -9746, -9873, -9999, -10123, -10250, -10377, -10502, 
-        -10628, -10754, -10880, -11006, -11132, -11259, -11384, -11510, -11636, -11762, -11890, -12015, 
-        -12140, -12267, -12393, -12520, -12645, -12772, -12897, -13024, -13149, -13277, -13403, -13528, 
-        -13655, -13781, -13908, -14034, -14158, -14285, -14412, -14538, -14665, -14792, -14917, -15044, 
-        -15170, -15296, -15422, -15549, -15675, -15802, -15927, -16054, -16181, -16307, -16434, -16561, 
-        -16689, -16814, -16941, -17067, -17193, -17321, -17446, -17571, -17699, -17826, -17952, -18079, 
-        -18206, -18332, -18458, -18586, -18711, -18839, -18966, -19092, -19219, -19346, -19472, -19599, 
-        -19726, -19852, -19979, -20105, -20233, -20359, -20487, -20613, -20740, -20867, -20993, -21120, 
-        -21248, -21375, -21501, -21629, -21755, -21883, -22009, -22136, -22264, -22390, -22518, -22645, 
-        -22772, -22898, -23025, -23153, -23280, -23406, -23533, -23661, -23788, -23916, -24042, -24170, 
-        -24298, -24424, -24552, -24680, -24806, -24934, -25060, -25188, -25314, -25442, -25569, -25697, 
-        -25823, -25950, -26078, -26205, -26331, -26459, -26586, -26713, -26839, -26967, -27094, -27221, 
-        -27346, -27473, -27599, -27726, -27853, -27978, -28104, -28231, -28356, -28482, -28607, -28731, 
-        -28856, -28982, -29106, -29229, -29353, -29476, -29599, -29721, -29842, -29964, -30085, -30205, 
-        -30323, -30442, -30559, -30676, -30791, -30906, -31019, -31129, -31240, -31349, -31455, -31558, 
-        -31661, -31761, -31858, -31952, -32044, -32132, -32215, -32296, -32371, -32443, -32507, -32567, 
-        -32619, -32666, -32704, -32735, -32757, -32767, -32767, -32757, -32732, -32693, -32640, -32569, 
-        -32479, -32370, -32238, -32084, -31903, -31692, -31453, -31178, -30864, -30511, -30113, -29667, 
-        -29169, -28610, -27994, -27249, -25811, -23132, -19593, -15886, -12238, -8674, -5179, -1720 
-    };
-
-    // AKWF_R_sym_saw_16 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_16[600] PROGMEM = {
-        2199, 6632, 11132, 15732, 20225, 23748, 25706, 26741, 27581, 28335, 28996, 29581, 
-        30095, 30547, 30939, 31282, 31574, 31826, 32038, 32217, 32366, 32487, 32583, 32656, 
-        32709, 32743, 32761, 32767, 32758, 32736, 32705, 32663, 32614, 32556, 32492, 32423, 
-        32346, 32264, 32179, 32088, 31996, 31899, 31799, 31696, 31590, 31484, 31376, 31265, 
-        31152, 31040, 30924, 30809, 30691, 30574, 30455, 30336, 30215, 30095, 29975, 29851, 
-        29731, 29607, 29485, 29362, 29240, 29115, 28991, 28867, 28743, 28618, 28495, 28370, 
-        28245, 28122, 27996, 27871, 27746, 27622, 27497, 27372, 27246, 27121, 26996, 26870, 
-        26745, 26621, 26496, 26371, 26243, 26119, 25994, 25869, 25743, 25620, 25493, 25369, 
-        25242, 25118, 24993, 24868, 24742, 24617, 24492, 24366, 24243, 24117, 23992, 23867, 
-        23742, 23618, 23491, 23367, 23242, 23117, 22992, 22868, 22743, 22618, 22493, 22367, 
-        22244, 22119, 21994, 21869, 21743, 21618, 21494, 21369, 21245, 21119, 20996, 20871, 
-        20745, 20621, 20497, 20372, 20247, 20124, 19999, 19874, 19749, 19624, 19500, 19375, 
-        19250, 19125, 19002, 18877, 18752, 18628, 18504, 18379, 18255, 18131, 18006, 17882, 
-        17758, 17633, 17509, 17385, 17260, 17136, 17012, 16887, 16764, 16639, 16514, 16391, 
-        16266, 16141, 16018, 15893, 15770, 15645, 15522, 15397, 15273, 15149, 15025, 14900, 
-        14777, 14652, 14529, 14404, 14280, 14156, 14032, 13909, 13784, 13661, 13536, 13412, 
-        13289, 13164, 13041, 12916, 12793, 12669, 12546, 12421, 12298, 12173, 12049, 11925, 
-        11802, 11678, 11553, 11429, 11306, 11183, 11059, 10934, 10811, 10688, 10563, 10441, 
-        10316, 10191, 10069, 9944, 9821, 9696, 9574, 9449, 9326, 9202, 9079, 8954, 
-        8832, 8707, 8584, 8460, 8337, 8214, 8090, 7965, 7842, 7718, 7595, 7470, 
-        7348, 7223, 7100, 6977, 6853, 6730, 6606, 6483, 6359, 6235, 6111, 5988, 
-        5864, 5741, 5617, 5493, 5371, 5246, 5124, 5000, 4876, 4752, 4630, 4505, 
-        4382, 4258, 4135, 4012, 3888, 3765, 3640, 3518, 3393, 3271, 3148, 3023, 
-        2899, 2777, 2653, 2529, 2406, 2284, 2159, 2037, 1913, 1790, 1665, 1542, 
-        1418, 1295, 1171, 1048, 925, 802, 678, 554, 432, 309, 185, 62, 
-        -62, -185, -309, -432, -554, -678, -802, -925, -1048, -1171, -1295, -1418, 
-        -1542, -1665, -1790, -1913, -2037, -2159, -2284, -2406, -2529, -2653, -2777, -2899, 
-        -3023, -3148, -3271, -3393, -3518, -3640, -3765, -3888, -4012, -4135, -4258, -4382, 
-        -4505, -4630, -4752, -4876, -5000, -5124, -5246, -5371, -5493, -5617, -5741, -5864, 
-        -5988, -6111, -6235, -6359, -6483, -6606, -6730, -6853, -6977, -7100, -7223, -7348, 
-        -7470, -7595, -7718, -7842, -7965, -8090, -8214, -8337, -8460, -8584, -8707, -8832, 
-        -8954, -9079, -9202, -9326, -9449, -9574, -9696, -9821, -9944, -10069, -10191, -10316, 
-        -10441, -10563, -10688, -10811, -10934, -11059, -11183, -11306, -11429, -11553, -11678, -11802, 
-        -11925, -12049, -12173, -12298, -12421, -12546, -12669, -12793, -12916, -13041, -13164, -13289, 
-        -13412, -13536, -13661, -13784, -13909, -14032, -14156, -14280, -14404, -14529, -14652, -14777, 
-        -14900, -15025, -15149, -15273, -15397, -15522, -15645, -15770, -15893, -16018, -16141, -16266, 
-        -16391, -16514, -16639, -16764, -16887, -17012, -17136, -17260, -17385, -17509, -17633, -17758, 
-        -17882, -18006, -18131, -18255, -18379, -18504, -18628, -18752, -18877, -19002, -19125, -19250, 
-        -19375, -19500, -19624, -19749, -19874, -19999, -20124, -20247, -20372, -20497, -20621, -20745, 
-        -20871, -20996, -21119, -21245, -21369, -21494, -21618, -21743, -21869, -21994, -22119, -22244, 
-        -22367, -22493, -22618, -22743, -22868, -22992, -23117, -23242, -23367, -23491, -23618, -23742, 
-        -23867, -23992, -24117, -24243, -24366, -24492, -24617, -24742, -24868, -24993, -25118, -25242, 
-        -25369, -25493, -25620, -25743, -25869, -25994, -26119, -26243, -26371, -26496, -26621, -26745, 
-        -26870, -26996, -27121, -27246, -27372, -27497, -27622, -27746, -27871, -27996, -28122, -28245, 
-        -28370, -28495, -28618, -28743, -28867, -28991, -29115, -29240, -29362, -29485, -29607, -29731, 
-        -29851, -29975, -30095, -30215, -30336, -30455, -30574, -30691, -30809, -30924, -31040, -31152, 
-        -31265, -31376, -31484, -31590, -31696, -31799, -31899, -31996, -32088, -32179, -32264, -32346, 
-        -32423, -32492, -32556, -32614, -32663, -32705, -32736, -32758, -32767, -32761, -32743, -32709, 
-        -32656, -32583, -32487, -32366, -32217, -32038, -31826, -31574, -31282, -30939, -30547, -30095, 
-        -29581, -28996, -28335, -27581, -26741, -25706, -23748, -20225, -15732, -11132, -6632, -2199 
-    };
-
-    // AKWF_R_sym_saw_17 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_17[600] PROGMEM = {
-        2618, 7894, 13306, 18715, 23069, 25494, 26720, 27686, 28534, 29262, 29888, 30423, 
-        30885, 31274, 31606, 31881, 32110, 32294, 32441, 32558, 32645, 32708, 32747, 32766, 
-        32767, 32755, 32729, 32691, 32642, 32585, 32520, 32446, 32369, 32284, 32196, 32103, 
-        32006, 31906, 31801, 31696, 31588, 31479, 31368, 31255, 31140, 31025, 30909, 30791, 
-        30673, 30555, 30435, 30315, 30196, 30074, 29953, 29832, 29711, 29588, 29466, 29345, 
-        29222, 29100, 28977, 28854, 28731, 28608, 28485, 28362, 28239, 28117, 27993, 27870, 
-        27746, 27624, 27500, 27377, 27253, 27129, 27007, 26884, 26760, 26637, 26514, 26391, 
-        26268, 26145, 26021, 25897, 25775, 25652, 25528, 25406, 25283, 25159, 25035, 24913, 
-        24790, 24668, 24545, 24421, 24299, 24176, 24054, 23931, 23807, 23685, 23561, 23438, 
-        23316, 23193, 23071, 22948, 22826, 22703, 22579, 22458, 22333, 22212, 22089, 21966, 
-        21845, 21721, 21599, 21476, 21354, 21230, 21109, 20986, 20862, 20741, 20619, 20496, 
-        20372, 20251, 20128, 20006, 19883, 19762, 19640, 19517, 19395, 19272, 19149, 19027, 
-        18904, 18782, 18661, 18539, 18417, 18293, 18172, 18049, 17927, 17806, 17683, 17562, 
-        17438, 17315, 17196, 17073, 16952, 16828, 16707, 16584, 16463, 16341, 16218, 16097, 
-        15974, 15852, 15731, 15609, 15487, 15364, 15243, 15121, 15000, 14877, 14754, 14633, 
-        14512, 14390, 14267, 14146, 14025, 13902, 13781, 13658, 13537, 13415, 13294, 13171, 
-        13050, 12929, 12806, 12684, 12564, 12441, 12319, 12199, 12076, 11954, 11833, 11711, 
-        11590, 11468, 11347, 11224, 11103, 10982, 10860, 10739, 10617, 10494, 10374, 10252, 
-        10131, 10008, 9887, 9767, 9645, 9523, 9401, 9280, 9159, 9036, 8916, 8794, 
-        8672, 8551, 8430, 8308, 8186, 8065, 7944, 7823, 7700, 7579, 7459, 7337, 
-        7216, 7094, 6972, 6852, 6730, 6608, 6487, 6365, 6245, 6122, 6001, 5881, 
-        5759, 5638, 5516, 5395, 5274, 5153, 5030, 4909, 4788, 4667, 4546, 4426, 
-        4303, 4182, 4061, 3940, 3819, 3697, 3575, 3454, 3334, 3211, 3092, 2969, 
-        2848, 2727, 2607, 2484, 2363, 2241, 2119, 1998, 1878, 1756, 1635, 1515, 
-        1394, 1273, 1150, 1030, 908, 788, 667, 545, 423, 302, 181, 59, 
-        -59, -181, -302, -423, -545, -667, -788, -908, -1030, -1150, -1273, -1394, 
-        -1515, -1635, -1756, -1878, -1998, -2119, -2241, -2363, -2484, -2607, -2727, -2848, 
-        -2969, -3092, -3211, -3334, -3454, -3575, -3697, -3819, -3940, -4061, -4182, -4303, 
-        -4426, -4546, -4667, -4788, -4909, -5030, -5153, -5274, -5395, -5516, -5638, -5759, 
-        -5881, -6001, -6122, -6245, -6365, -6487, -6608, -6730, -6852, -6972, -7094, -7216, 
-        -7337, -7459, -7579, -7700, -7823, -7944, -8065, -8186, -8308, -8430, -8551, -8672, 
-        -8794, -8916, -9036, -9159, -9280, -9401, -9523, -9645, -9767, -9887, -10008, -10131, 
-        -10252, -10374, -10494, -10617, -10739, -10860, -10982, -11103, -11224, -11347, -11468, -11590, 
-        -11711, -11833, -11954, -12076, -12199, -12319, -12441, -12564, -12684, -12806, -12929, -13050, 
-        -13171, -13294, -13415, -13537, -13658, -13781, -13902, -14025, -14146, -14267, -14390, -14512, 
-        -14633, -14754, -14877, -15000, -15121, -15243, -15364, -15487, -15609, -15731, -15852, -15974, 
-        -16097, -16218, -16341, -16463, -16584, -16707, -16828, -16952, -17073, -17196, -17315, -17438, 
-        -17562, -17683, -17806, -17927, -18049, -18172, -18293, -18417, -18539, -18661, -18782, -18904, 
-        -19027, -19149, -19272, -19395, -19517, -19640, -19762, -19883, -20006, -20128, -20251, -20372, 
-        -20496, -20619, -20741, -20862, -20986, -21109, -21230, -21354, -21476, -21599, -21721, -21845, 
-        -21966, -22089, -22212, -22333, -22458, -22579, -22703, -22826, -22948, -23071, -23193, -23316, 
-        -23438, -23561, -23685, -23807, -23931, -24054, -24176, -24299, -24421, -24545, -24668, -24790, 
-        -24913, -25035, -25159, -25283, -25406, -25528, -25652, -25775, -25897, -26021, -26145, -26268, 
-        -26391, -26514, -26637, -26760, -26884, -27007, -27129, -27253, -27377, -27500, -27624, -27746, 
-        -27870, -27993, -28117, -28239, -28362, -28485, -28608, -28731, -28854, -28977, -29100, -29222, 
-        -29345, -29466, -29588, -29711, -29832, -29953, -30074, -30196, -30315, -30435, -30555, -30673, 
-        -30791, -30909, -31025, -31140, -31255, -31368, -31479, -31588, -31696, -31801, -31906, -32006, 
-        -32103, -32196, -32284, -32369, -32446, -32520, -32585, -32642, -32691, -32729, -32755, -32767, 
-        -32766, -32747, -32708, -32645, -32558, -32441, -32294, -32110, -31881, -31606, -31274, -30885, 
-        -30423, -29888, -29262, -28534, -27686, -26720, -25494, -23069, -18715, -13306, -7894, -2618 
-    };
-
-    // AKWF_R_sym_saw_18 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_18[600] PROGMEM = {
-        3199, 9703, 16302, 21760, 24844, 26369, 27534, 28530, 29362, 30060, 30638, 31117, 
-        31512, 31837, 32098, 32307, 32466, 32584, 32670, 32728, 32761, 32767, 32758, 32732, 
-        32692, 32640, 32578, 32508, 32430, 32345, 32256, 32161, 32062, 31961, 31857, 31749, 
-        31640, 31529, 31417, 31301, 31186, 31070, 30954, 30837, 30718, 30597, 30480, 30360, 
-        30239, 30119, 29999, 29877, 29757, 29635, 29515, 29394, 29272, 29150, 29029, 28908, 
-        28787, 28665, 28544, 28421, 28300, 28179, 28057, 27937, 27814, 27692, 27571, 27449, 
-        27327, 27207, 27084, 26962, 26842, 26721, 26599, 26477, 26356, 26234, 26113, 25992, 
-        25871, 25750, 25627, 25507, 25386, 25265, 25142, 25022, 24900, 24779, 24657, 24537, 
-        24415, 24295, 24173, 24053, 23932, 23810, 23690, 23568, 23446, 23326, 23206, 23084, 
-        22963, 22844, 22722, 22601, 22480, 22359, 22238, 22117, 21997, 21875, 21755, 21633, 
-        21513, 21393, 21271, 21151, 21030, 20910, 20790, 20668, 20548, 20426, 20306, 20185, 
-        20066, 19944, 19824, 19703, 19583, 19463, 19343, 19222, 19101, 18981, 18859, 18740, 
-        18620, 18498, 18378, 18258, 18137, 18017, 17897, 17777, 17656, 17536, 17416, 17296, 
-        17174, 17055, 16935, 16815, 16694, 16574, 16454, 16334, 16212, 16093, 15973, 15853, 
-        15732, 15612, 15492, 15373, 15253, 15132, 15012, 14892, 14772, 14651, 14531, 14412, 
-        14292, 14172, 14052, 13933, 13812, 13692, 13572, 13452, 13333, 13212, 13092, 12972, 
-        12852, 12731, 12613, 12492, 12373, 12253, 12133, 12014, 11894, 11774, 11655, 11533, 
-        11414, 11294, 11175, 11055, 10936, 10816, 10695, 10575, 10456, 10336, 10217, 10097, 
-        9978, 9858, 9737, 9619, 9498, 9378, 9260, 9139, 9020, 8901, 8779, 8661, 
-        8542, 8423, 8303, 8184, 8063, 7943, 7824, 7704, 7585, 7465, 7346, 7226, 
-        7107, 6987, 6868, 6747, 6627, 6508, 6389, 6269, 6150, 6030, 5911, 5792, 
-        5672, 5552, 5433, 5314, 5194, 5075, 4955, 4836, 4717, 4597, 4476, 4357, 
-        4238, 4118, 3999, 3879, 3762, 3641, 3521, 3402, 3282, 3163, 3043, 2924, 
-        2805, 2685, 2566, 2446, 2327, 2208, 2088, 1969, 1850, 1731, 1611, 1490, 
-        1371, 1251, 1134, 1013, 895, 776, 657, 538, 418, 299, 179, 60, 
-        -60, -179, -299, -418, -538, -657, -776, -895, -1013, -1134, -1251, -1371, 
-        -1490, -1611, -1731, -1850, -1969, -2088, -2208, -2327, -2446, -2566, -2685, -2805, 
-        -2924, -3043, -3163, -3282, -3402, -3521, -3641, -3762, -3879, -3999, -4118, -4238, 
-        -4357, -4476, -4597, -4717, -4836, -4955, -5075, -5194, -5314, -5433, -5552, -5672, 
-        -5792, -5911, -6030, -6150, -6269, -6389, -6508, -6627, -6747, -6868, -6987, -7107, 
-        -7226, -7346, -7465, -7585, -7704, -7824, -7943, -8063, -8184, -8303, -8423, -8542, 
-        -8661, -8779, -8901, -9020, -9139, -9260, -9378, -9498, -9619, -9737, -9858, -9978, 
-        -10097, -10217, -10336, -10456, -10575, -10695, -10816, -10936, -11055, -11175, -11294, -11414, 
-        -11533, -11655, -11774, -11894, -12014, -12133, -12253, -12373, -12492, -12613, -12731, -12852, 
-        -12972, -13092, -13212, -13333, -13452, -13572, -13692, -13812, -13933, -14052, -14172, -14292, 
-        -14412, -14531, -14651, -14772, -14892, -15012, -15132, -15253, -15373, -15492, -15612, -15732, 
-        -15853, -15973, -16093, -16212, -16334, -16454, -16574, -16694, -16815, -16935, -17055, -17174, 
-        -17296, -17416, -17536, -17656, -17777, -17897, -18017, -18137, -18258, -18378, -18498, -18620, 
-        -18740, -18859, -18981, -19101, -19222, -19343, -19463, -19583, -19703, -19824, -19944, -20066, 
-        -20185, -20306, -20426, -20548, -20668, -20790, -20910, -21030, -21151, -21271, -21393, -21513, 
-        -21633, -21755, -21875, -21997, -22117, -22238, -22359, -22480, -22601, -22722, -22844, -22963, 
-        -23084, -23206, -23326, -23446, -23568, -23690, -23810, -23932, -24053, -24173, -24295, -24415, 
-        -24537, -24657, -24779, -24900, -25022, -25142, -25265, -25386, -25507, -25627, -25750, -25871, 
-        -25992, -26113, -26234, -26356, -26477, -26599, -26721, -26842, -26962, -27084, -27207, -27327, 
-        -27449, -27571, -27692, -27814, -27937, -28057, -28179, -28300, -28421, -28544, -28665, -28787, 
-        -28908, -29029, -29150, -29272, -29394, -29515, -29635, -29757, -29877, -29999, -30119, -30239, 
-        -30360, -30480, -30597, -30718, -30837, -30954, -31070, -31186, -31301, -31417, -31529, -31640, 
-        -31749, -31857, -31961, -32062, -32161, -32256, -32345, -32430, -32508, -32578, -32640, -32692, 
-        -32732, -32758, -32767, -32761, -32728, -32670, -32584, -32466, -32307, -32098, -31837, -31512, 
-        -31117, -30638, -30060, -29362, -28530, -27534, -26369, -24844, -21760, -16302, -9703, -3199 
-    };
-
-    // AKWF_R_sym_saw_19 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_19[600] PROGMEM = {
-        3360, 10240, 17437, 23550, 26879, 28283, 29269, 30090, 30742, 31267, 31679, 32002, 
-        32249, 32441, 32582, 32679, 32736, 32762, 32767, 32750, 32716, 32666, 32603, 32532, 
-        32453, 32365, 32274, 32175, 32074, 31970, 31862, 31753, 31641, 31528, 31415, 31300, 
-        31183, 31066, 30950, 30831, 30713, 30596, 30477, 30358, 30239, 30119, 30000, 29879, 
-        29759, 29640, 29521, 29402, 29280, 29161, 29042, 28922, 28800, 28681, 28562, 28442, 
-        28323, 28203, 28084, 27963, 27844, 27723, 27604, 27485, 27364, 27244, 27126, 27006, 
-        26886, 26767, 26648, 26527, 26408, 26288, 26168, 26049, 25928, 25811, 25690, 25571, 
-        25451, 25332, 25213, 25094, 24975, 24855, 24736, 24617, 24498, 24378, 24259, 24140, 
-        24021, 23902, 23781, 23664, 23545, 23424, 23305, 23188, 23067, 22950, 22829, 22710, 
-        22592, 22473, 22354, 22235, 22116, 21997, 21878, 21760, 21640, 21522, 21403, 21284, 
-        21165, 21046, 20927, 20808, 20689, 20572, 20453, 20335, 20215, 20096, 19977, 19859, 
-        19740, 19621, 19504, 19385, 19266, 19147, 19029, 18911, 18792, 18673, 18556, 18437, 
-        18318, 18199, 18080, 17962, 17843, 17726, 17607, 17489, 17370, 17251, 17134, 17016, 
-        16897, 16779, 16660, 16543, 16424, 16305, 16187, 16070, 15949, 15833, 15714, 15596, 
-        15479, 15360, 15242, 15123, 15006, 14887, 14769, 14651, 14533, 14415, 14296, 14178, 
-        14059, 13942, 13824, 13705, 13589, 13470, 13352, 13235, 13116, 12998, 12881, 12763, 
-        12644, 12526, 12409, 12291, 12172, 12055, 11937, 11819, 11702, 11584, 11465, 11347, 
-        11229, 11112, 10993, 10876, 10758, 10640, 10523, 10405, 10288, 10170, 10051, 9933, 
-        9816, 9698, 9581, 9463, 9345, 9226, 9109, 8991, 8874, 8756, 8638, 8521, 
-        8403, 8286, 8168, 8050, 7933, 7815, 7697, 7580, 7462, 7345, 7226, 7109, 
-        6992, 6873, 6757, 6639, 6521, 6404, 6286, 6169, 6050, 5933, 5816, 5698, 
-        5580, 5463, 5345, 5226, 5110, 4992, 4875, 4757, 4640, 4522, 4406, 4288, 
-        4169, 4052, 3934, 3816, 3699, 3581, 3465, 3347, 3230, 3112, 2994, 2877, 
-        2759, 2642, 2524, 2406, 2290, 2171, 2054, 1936, 1820, 1702, 1584, 1468, 
-        1348, 1233, 1115, 998, 880, 763, 646, 529, 411, 294, 176, 58, 
-        -58, -176, -294, -411, -529, -646, -763, -880, -998, -1115, -1233, -1348, 
-        -1468, -1584, -1702, -1820, -1936, -2054, -2171, -2290, -2406, -2524, -2642, -2759, 
-        -2877, -2994, -3112, -3230, -3347, -3465, -3581, -3699, -3816, -3934, -4052, -4169, 
-        -4288, -4406, -4522, -4640, -4757, -4875, -4992, -5110, -5226, -5345, -5463, -5580, 
-        -5698, -5816, -5933, -6050, -6169, -6286, -6404, -6521, -6639, -6757, -6873, -6992, 
-        -7109, -7226, -7345, -7462, -7580, -7697, -7815, -7933, -8050, -8168, -8286, -8403, 
-        -8521, -8638, -8756, -8874, -8991, -9109, -9226, -9345, -9463, -9581, -9698, -9816, 
-        -9933, -10051, -10170, -10288, -10405, -10523, -10640, -10758, -10876, -10993, -11112, -11229, 
-        -11347, -11465, -11584, -11702, -11819, -11937, -12055, -12172, -12291, -12409, -12526, -12644, 
-        -12763, -12881, -12998, -13116, -13235, -13352, -13470, -13589, -13705, -13824, -13942, -14059, 
-        -14178, -14296, -14415, -14533, -14651, -14769, -14887, -15006, -15123, -15242, -15360, -15479, 
-        -15596, -15714, -15833, -15949, -16070, -16187, -16305, -16424, -16543, -16660, -16779, -16897, 
-        -17016, -17134, -17251, -17370, -17489, -17607, -17726, -17843, -17962, -18080, -18199, -18318, 
-        -18437, -18556, -18673, -18792, -18911, -19029, -19147, -19266, -19385, -19504, -19621, -19740, 
-        -19859, -19977, -20096, -20215, -20335, -20453, -20572, -20689, -20808, -20927, -21046, -21165, 
-        -21284, -21403, -21522, -21640, -21760, -21878, -21997, -22116, -22235, -22354, -22473, -22592, 
-        -22710, -22829, -22950, -23067, -23188, -23305, -23424, -23545, -23664, -23781, -23902, -24021, 
-        -24140, -24259, -24378, -24498, -24617, -24736, -24855, -24975, -25094, -25213, -25332, -25451, 
-        -25571, -25690, -25811, -25928, -26049, -26168, -26288, -26408, -26527, -26648, -26767, -26886, 
-        -27006, -27126, -27244, -27364, -27485, -27604, -27723, -27844, -27963, -28084, -28203, -28323, 
-        -28442, -28562, -28681, -28800, -28922, -29042, -29161, -29280, -29402, -29521, -29640, -29759, 
-        -29879, -30000, -30119, -30239, -30358, -30477, -30596, -30713, -30831, -30950, -31066, -31183, 
-        -31300, -31415, -31528, -31641, -31753, -31862, -31970, -32074, -32175, -32274, -32365, -32453, 
-        -32532, -32603, -32666, -32716, -32750, -32767, -32762, -32736, -32679, -32582, -32441, -32249, 
-        -32002, -31679, -31267, -30742, -30090, -29269, -28283, -26879, -23550, -17437, -10240, -3360 
-    };
-
-    // AKWF_R_sym_saw_20 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_20[600] PROGMEM = {
-        4374, 13409, 21269, 25690, 27588, 28877, 29911, 30696, 31310, 31767, 32113, 32359, 
-        32536, 32651, 32726, 32763, 32767, 32750, 32711, 32656, 32588, 32508, 32423, 32330, 
-        32229, 32128, 32021, 31912, 31801, 31689, 31575, 31460, 31344, 31228, 31110, 30993, 
-        30876, 30757, 30639, 30521, 30403, 30283, 30165, 30046, 29928, 29808, 29689, 29571, 
-        29452, 29334, 29214, 29096, 28978, 28859, 28741, 28621, 28502, 28384, 28266, 28148, 
-        28028, 27910, 27792, 27673, 27555, 27435, 27317, 27199, 27080, 26962, 26842, 26724, 
-        26606, 26488, 26370, 26252, 26134, 26016, 25897, 25779, 25661, 25543, 25423, 25305, 
-        25187, 25071, 24951, 24832, 24715, 24597, 24479, 24361, 24243, 24125, 24007, 23889, 
-        23771, 23653, 23535, 23418, 23299, 23182, 23064, 22946, 22828, 22710, 22592, 22474, 
-        22357, 22239, 22121, 22003, 21886, 21768, 21650, 21532, 21416, 21299, 21181, 21063, 
-        20945, 20827, 20710, 20592, 20474, 20358, 20239, 20121, 20005, 19887, 19770, 19652, 
-        19535, 19417, 19301, 19183, 19066, 18948, 18831, 18713, 18598, 18479, 18362, 18245, 
-        18127, 18011, 17893, 17776, 17659, 17541, 17425, 17308, 17190, 17073, 16955, 16837, 
-        16722, 16604, 16487, 16370, 16254, 16136, 16019, 15902, 15784, 15668, 15551, 15434, 
-        15316, 15200, 15084, 14966, 14850, 14732, 14616, 14498, 14382, 14265, 14148, 14032, 
-        13914, 13798, 13682, 13564, 13447, 13330, 13214, 13096, 12980, 12862, 12747, 12629, 
-        12512, 12396, 12279, 12162, 12046, 11929, 11812, 11696, 11579, 11462, 11346, 11231, 
-        11112, 10996, 10879, 10763, 10646, 10529, 10413, 10297, 10181, 10064, 9947, 9831, 
-        9714, 9597, 9481, 9364, 9247, 9131, 9014, 8899, 8782, 8665, 8549, 8432, 
-        8317, 8200, 8083, 7967, 7850, 7733, 7618, 7500, 7383, 7268, 7150, 7035, 
-        6920, 6802, 6686, 6570, 6453, 6338, 6221, 6104, 5988, 5871, 5754, 5638, 
-        5522, 5406, 5290, 5172, 5057, 4940, 4824, 4708, 4592, 4475, 4360, 4243, 
-        4127, 4010, 3893, 3777, 3661, 3545, 3428, 3313, 3196, 3079, 2963, 2846, 
-        2731, 2614, 2499, 2381, 2267, 2149, 2032, 1915, 1799, 1685, 1568, 1453, 
-        1335, 1220, 1104, 988, 871, 756, 639, 522, 406, 290, 174, 57, 
-        -57, -174, -290, -406, -522, -639, -756, -871, -988, -1104, -1220, -1335, 
-        -1453, -1568, -1685, -1799, -1915, -2032, -2149, -2267, -2381, -2499, -2614, -2731, 
-        -2846, -2963, -3079, -3196, -3313, -3428, -3545, -3661, -3777, -3893, -4010, -4127, 
-        -4243, -4360, -4475, -4592, -4708, -4824, -4940, -5057, -5172, -5290, -5406, -5522, 
-        -5638, -5754, -5871, -5988, -6104, -6221, -6338, -6453, -6570, -6686, -6802, -6920, 
-        -7035, -7150, -7268, -7383, -7500, -7618, -7733, -7850, -7967, -8083, -8200, -8317, 
-        -8432, -8549, -8665, -8782, -8899, -9014, -9131, -9247, -9364, -9481, -9597, -9714, 
-        -9831, -9947, -10064, -10181, -10297, -10413, -10529, -10646, -10763, -10879, -10996, -11112, 
-        -11231, -11346, -11462, -11579, -11696, -11812, -11929, -12046, -12162, -12279, -12396, -12512, 
-        -12629, -12747, -12862, -12980, -13096, -13214, -13330, -13447, -13564, -13682, -13798, -13914, 
-        -14032, -14148, -14265, -14382, -14498, -14616, -14732, -14850, -14966, -15084, -15200, -15316, 
-        -15434, -15551, -15668, -15784, -15902, -16019, -16136, -16254, -16370, -16487, -16604, -16722, 
-        -16837, -16955, -17073, -17190, -17308, -17425, -17541, -17659, -17776, -17893, -18011, -18127, 
-        -18245, -18362, -18479, -18598, -18713, -18831, -18948, -19066, -19183, -19301, -19417, -19535, 
-        -19652, -19770, -19887, -20005, -20121, -20239, -20358, -20474, -20592, -20710, -20827, -20945, 
-        -21063, -21181, -21299, -21416, -21532, -21650, -21768, -21886, -22003, -22121, -22239, -22357, 
-        -22474, -22592, -22710, -22828, -22946, -23064, -23182, -23299, -23418, -23535, -23653, -23771, 
-        -23889, -24007, -24125, -24243, -24361, -24479, -24597, -24715, -24832, -24951, -25071, -25187, 
-        -25305, -25423, -25543, -25661, -25779, -25897, -26016, -26134, -26252, -26370, -26488, -26606, 
-        -26724, -26842, -26962, -27080, -27199, -27317, -27435, -27555, -27673, -27792, -27910, -28028, 
-        -28148, -28266, -28384, -28502, -28621, -28741, -28859, -28978, -29096, -29214, -29334, -29452, 
-        -29571, -29689, -29808, -29928, -30046, -30165, -30283, -30403, -30521, -30639, -30757, -30876, 
-        -30993, -31110, -31228, -31344, -31460, -31575, -31689, -31801, -31912, -32021, -32128, -32229, 
-        -32330, -32423, -32508, -32588, -32656, -32711, -32750, -32767, -32763, -32726, -32651, -32536, 
-        -32359, -32113, -31767, -31310, -30696, -29911, -28877, -27588, -25690, -21269, -13409, -4374 
-    };
-
-    // AKWF_R_sym_saw_21 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_21[600] PROGMEM = {
-        4557, 14241, 22958, 27731, 29436, 30447, 31227, 31772, 32169, 32428, 32608, 32707, 
-        32758, 32767, 32757, 32721, 32662, 32592, 32511, 32421, 32325, 32224, 32117, 32007, 
-        31897, 31783, 31670, 31555, 31440, 31323, 31206, 31090, 30973, 30856, 30739, 30621, 
-        30505, 30387, 30268, 30152, 30034, 29917, 29800, 29682, 29564, 29446, 29329, 29211, 
-        29094, 28978, 28861, 28743, 28625, 28508, 28390, 28273, 28157, 28038, 27922, 27805, 
-        27687, 27570, 27454, 27335, 27219, 27102, 26984, 26869, 26751, 26634, 26517, 26400, 
-        26284, 26167, 26049, 25932, 25815, 25699, 25582, 25465, 25349, 25230, 25115, 24997, 
-        24882, 24765, 24647, 24530, 24415, 24297, 24180, 24065, 23948, 23831, 23715, 23598, 
-        23483, 23366, 23249, 23134, 23016, 22899, 22784, 22667, 22550, 22435, 22317, 22201, 
-        22085, 21969, 21851, 21736, 21619, 21504, 21387, 21272, 21155, 21038, 20922, 20806, 
-        20690, 20574, 20459, 20342, 20225, 20110, 19993, 19878, 19760, 19646, 19531, 19414, 
-        19296, 19182, 19065, 18950, 18835, 18719, 18602, 18486, 18370, 18254, 18138, 18023, 
-        17906, 17791, 17676, 17559, 17444, 17328, 17211, 17096, 16979, 16865, 16749, 16633, 
-        16518, 16403, 16287, 16172, 16055, 15940, 15825, 15709, 15593, 15477, 15362, 15247, 
-        15130, 15015, 14901, 14784, 14668, 14553, 14438, 14322, 14207, 14092, 13976, 13860, 
-        13744, 13629, 13514, 13400, 13283, 13168, 13054, 12937, 12823, 12706, 12592, 12476, 
-        12360, 12246, 12131, 12016, 11900, 11784, 11670, 11554, 11439, 11324, 11208, 11093, 
-        10978, 10862, 10747, 10633, 10518, 10402, 10287, 10172, 10056, 9941, 9826, 9710, 
-        9596, 9481, 9366, 9250, 9135, 9021, 8904, 8790, 8675, 8558, 8446, 8330, 
-        8215, 8100, 7984, 7870, 7753, 7640, 7526, 7410, 7293, 7180, 7064, 6949, 
-        6835, 6720, 6604, 6490, 6375, 6258, 6144, 6030, 5915, 5801, 5684, 5570, 
-        5455, 5340, 5226, 5110, 4995, 4881, 4766, 4650, 4535, 4421, 4306, 4192, 
-        4076, 3961, 3847, 3732, 3616, 3501, 3387, 3272, 3158, 3041, 2927, 2813, 
-        2696, 2582, 2467, 2353, 2238, 2124, 2008, 1893, 1778, 1664, 1548, 1434, 
-        1319, 1205, 1091, 976, 860, 746, 631, 516, 400, 286, 171, 56, 
-        -56, -171, -286, -400, -516, -631, -746, -860, -976, -1091, -1205, -1319, 
-        -1434, -1548, -1664, -1778, -1893, -2008, -2124, -2238, -2353, -2467, -2582, -2696, 
-        -2813, -2927, -3041, -3158, -3272, -3387, -3501, -3616, -3732, -3847, -3961, -4076, 
-        -4192, -4306, -4421, -4535, -4650, -4766, -4881, -4995, -5110, -5226, -5340, -5455, 
-        -5570, -5684, -5801, -5915, -6030, -6144, -6258, -6375, -6490, -6604, -6720, -6835, 
-        -6949, -7064, -7180, -7293, -7410, -7526, -7640, -7753, -7870, -7984, -8100, -8215, 
-        -8330, -8446, -8558, -8675, -8790, -8904, -9021, -9135, -9250, -9366, -9481, -9596, 
-        -9710, -9826, -9941, -10056, -10172, -10287, -10402, -10518, -10633, -10747, -10862, -10978, 
-        -11093, -11208, -11324, -11439, -11554, -11670, -11784, -11900, -12016, -12131, -12246, -12360, 
-        -12476, -12592, -12706, -12823, -12937, -13054, -13168, -13283, -13400, -13514, -13629, -13744, 
-        -13860, -13976, -14092, -14207, -14322, -14438, -14553, -14668, -14784, -14901, -15015, -15130, 
-        -15247, -15362, -15477, -15593, -15709, -15825, -15940, -16055, -16172, -16287, -16403, -16518, 
-        -16633, -16749, -16865, -16979, -17096, -17211, -17328, -17444, -17559, -17676, -17791, -17906, 
-        -18023, -18138, -18254, -18370, -18486, -18602, -18719, -18835, -18950, -19065, -19182, -19296, 
-        -19414, -19531, -19646, -19760, -19878, -19993, -20110, -20225, -20342, -20459, -20574, -20690, 
-        -20806, -20922, -21038, -21155, -21272, -21387, -21504, -21619, -21736, -21851, -21969, -22085, 
-        -22201, -22317, -22435, -22550, -22667, -22784, -22899, -23016, -23134, -23249, -23366, -23483, 
-        -23598, -23715, -23831, -23948, -24065, -24180, -24297, -24415, -24530, -24647, -24765, -24882, 
-        -24997, -25115, -25230, -25349, -25465, -25582, -25699, -25815, -25932, -26049, -26167, -26284, 
-        -26400, -26517, -26634, -26751, -26869, -26984, -27102, -27219, -27335, -27454, -27570, -27687, 
-        -27805, -27922, -28038, -28157, -28273, -28390, -28508, -28625, -28743, -28861, -28978, -29094, 
-        -29211, -29329, -29446, -29564, -29682, -29800, -29917, -30034, -30152, -30268, -30387, -30505, 
-        -30621, -30739, -30856, -30973, -31090, -31206, -31323, -31440, -31555, -31670, -31783, -31897, 
-        -32007, -32117, -32224, -32325, -32421, -32511, -32592, -32662, -32721, -32757, -32767, -32758, 
-        -32707, -32608, -32428, -32169, -31772, -31227, -30447, -29436, -27731, -22958, -14241, -4557 
-    };
-
-    // AKWF_R_sym_saw_22 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_22[600] PROGMEM = {
-        6862, 18762, 25629, 28265, 29801, 30907, 31634, 32133, 32433, 32630, 32722, 32767, 
-        32755, 32715, 32653, 32586, 32507, 32418, 32322, 32218, 32111, 32000, 31888, 31774, 
-        31661, 31544, 31429, 31313, 31196, 31080, 30963, 30847, 30731, 30614, 30497, 30380, 
-        30264, 30147, 30031, 29915, 29798, 29681, 29565, 29448, 29331, 29215, 29098, 28982, 
-        28865, 28749, 28632, 28515, 28399, 28283, 28166, 28049, 27933, 27816, 27702, 27585, 
-        27470, 27353, 27237, 27120, 27005, 26889, 26772, 26655, 26539, 26424, 26307, 26191, 
-        26076, 25959, 25843, 25728, 25611, 25495, 25381, 25264, 25148, 25033, 24916, 24800, 
-        24685, 24569, 24453, 24336, 24221, 24105, 23991, 23874, 23758, 23644, 23527, 23412, 
-        23296, 23181, 23065, 22951, 22835, 22718, 22603, 22488, 22373, 22257, 22142, 22026, 
-        21910, 21795, 21679, 21564, 21449, 21334, 21218, 21104, 20988, 20873, 20757, 20642, 
-        20526, 20412, 20296, 20181, 20067, 19951, 19835, 19721, 19606, 19491, 19376, 19260, 
-        19145, 19030, 18915, 18801, 18686, 18571, 18455, 18340, 18225, 18111, 17996, 17880, 
-        17766, 17650, 17536, 17420, 17306, 17191, 17076, 16962, 16847, 16732, 16617, 16503, 
-        16387, 16273, 16159, 16044, 15929, 15813, 15699, 15585, 15470, 15356, 15241, 15126, 
-        15012, 14897, 14782, 14667, 14553, 14438, 14324, 14210, 14094, 13980, 13865, 13752, 
-        13636, 13522, 13406, 13292, 13178, 13064, 12950, 12835, 12721, 12606, 12491, 12377, 
-        12263, 12149, 12034, 11920, 11806, 11690, 11578, 11462, 11348, 11234, 11119, 11005, 
-        10891, 10777, 10663, 10548, 10433, 10319, 10204, 10091, 9977, 9863, 9749, 9635, 
-        9520, 9405, 9292, 9178, 9062, 8948, 8835, 8721, 8605, 8493, 8378, 8264, 
-        8150, 8036, 7921, 7807, 7693, 7579, 7466, 7350, 7236, 7122, 7008, 6895, 
-        6781, 6666, 6552, 6439, 6324, 6210, 6095, 5983, 5867, 5754, 5640, 5526, 
-        5412, 5299, 5184, 5070, 4956, 4842, 4728, 4613, 4499, 4386, 4272, 4158, 
-        4044, 3930, 3817, 3701, 3588, 3474, 3360, 3246, 3131, 3019, 2904, 2790, 
-        2676, 2562, 2448, 2333, 2222, 2106, 1992, 1878, 1765, 1651, 1537, 1424, 
-        1310, 1197, 1082, 968, 854, 740, 626, 511, 397, 284, 170, 57, 
-        -57, -170, -284, -397, -511, -626, -740, -854, -968, -1082, -1197, -1310, 
-        -1424, -1537, -1651, -1765, -1878, -1992, -2106, -2222, -2333, -2448, -2562, -2676, 
-        -2790, -2904, -3019, -3131, -3246, -3360, -3474, -3588, -3701, -3817, -3930, -4044, 
-        -4158, -4272, -4386, -4499, -4613, -4728, -4842, -4956, -5070, -5184, -5299, -5412, 
-        -5526, -5640, -5754, -5867, -5983, -6095, -6210, -6324, -6439, -6552, -6666, -6781, 
-        -6895, -7008, -7122, -7236, -7350, -7466, -7579, -7693, -7807, -7921, -8036, -8150, 
-        -8264, -8378, -8493, -8605, -8721, -8835, -8948, -9062, -9178, -9292, -9405, -9520, 
-        -9635, -9749, -9863, -9977, -10091, -10204, -10319, -10433, -10548, -10663, -10777, -10891, 
-        -11005, -11119, -11234, -11348, -11462, -11578, -11690, -11806, -11920, -12034, -12149, -12263, 
-        -12377, -12491, -12606, -12721, -12835, -12950, -13064, -13178, -13292, -13406, -13522, -13636, 
-        -13752, -13865, -13980, -14094, -14210, -14324, -14438, -14553, -14667, -14782, -14897, -15012, 
-        -15126, -15241, -15356, -15470, -15585, -15699, -15813, -15929, -16044, -16159, -16273, -16387, 
-        -16503, -16617, -16732, -16847, -16962, -17076, -17191, -17306, -17420, -17536, -17650, -17766, 
-        -17880, -17996, -18111, -18225, -18340, -18455, -18571, -18686, -18801, -18915, -19030, -19145, 
-        -19260, -19376, -19491, -19606, -19721, -19835, -19951, -20067, -20181, -20296, -20412, -20526, 
-        -20642, -20757, -20873, -20988, -21104, -21218, -21334, -21449, -21564, -21679, -21795, -21910, 
-        -22026, -22142, -22257, -22373, -22488, -22603, -22718, -22835, -22951, -23065, -23181, -23296, 
-        -23412, -23527, -23644, -23758, -23874, -23991, -24105, -24221, -24336, -24453, -24569, -24685, 
-        -24800, -24916, -25033, -25148, -25264, -25381, -25495, -25611, -25728, -25843, -25959, -26076, 
-        -26191, -26307, -26424, -26539, -26655, -26772, -26889, -27005, -27120, -27237, -27353, -27470, 
-        -27585, -27702, -27816, -27933, -28049, -28166, -28283, -28399, -28515, -28632, -28749, -28865, 
-        -28982, -29098, -29215, -29331, -29448, -29565, -29681, -29798, -29915, -30031, -30147, -30264, 
-        -30380, -30497, -30614, -30731, -30847, -30963, -31080, -31196, -31313, -31429, -31544, -31661, 
-        -31774, -31888, -32000, -32111, -32218, -32322, -32418, -32507, -32586, -32653, -32715, -32755, 
-        -32767, -32722, -32630, -32433, -32133, -31634, -30907, -29801, -28265, -25629, -18762, -6862 
-    };
-
-} // namespace AKWF_BwSawrounded
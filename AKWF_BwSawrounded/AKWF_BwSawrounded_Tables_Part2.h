@@ -1,224 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwSawrounded {
-
-    // AKWF_R_sym_saw_23 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_23[600] PROGMEM = {
-        7382, 20453, 27896, 30182, 31272, 31998, 32394, 32637, 32725, 32767, 32732, 32689, 
-        32605, 32517, 32418, 32324, 32226, 32123, 32019, 31907, 31794, 31680, 31566, 31451, 
-        31336, 31220, 31104, 30990, 30873, 30759, 30643, 30527, 30412, 30296, 30180, 30065, 
-        29949, 29834, 29719, 29604, 29488, 29372, 29257, 29142, 29027, 28911, 28795, 28680, 
-        28565, 28450, 28334, 28219, 28104, 27989, 27874, 27759, 27643, 27527, 27413, 27297, 
-        27183, 27069, 26953, 26839, 26723, 26609, 26493, 26379, 26265, 26149, 26034, 25918, 
-        25805, 25689, 25575, 25461, 25345, 25231, 25115, 25002, 24887, 24771, 24658, 24542, 
-        24428, 24313, 24200, 24084, 23970, 23854, 23741, 23627, 23511, 23397, 23283, 23167, 
-        23054, 22940, 22824, 22711, 22597, 22483, 22370, 22253, 22140, 22026, 21911, 21797, 
-        21683, 21569, 21454, 21340, 21226, 21111, 20999, 20884, 20770, 20657, 20541, 20427, 
-        20313, 20200, 20086, 19971, 19857, 19743, 19630, 19516, 19401, 19287, 19174, 19060, 
-        18947, 18833, 18719, 18604, 18491, 18377, 18263, 18150, 18036, 17923, 17807, 17694, 
-        17581, 17467, 17354, 17238, 17127, 17013, 16898, 16784, 16671, 16558, 16444, 16330, 
-        16218, 16105, 15990, 15877, 15764, 15650, 15537, 15422, 15310, 15197, 15082, 14968, 
-        14855, 14742, 14628, 14514, 14401, 14288, 14174, 14062, 13948, 13835, 13722, 13608, 
-        13495, 13382, 13268, 13154, 13042, 12928, 12815, 12702, 12588, 12476, 12362, 12249, 
-        12136, 12023, 11910, 11796, 11683, 11570, 11456, 11343, 11230, 11117, 11004, 10890, 
-        10779, 10664, 10551, 10438, 10326, 10211, 10100, 9985, 9873, 9761, 9648, 9534, 
-        9421, 9308, 9195, 9082, 8969, 8855, 8744, 8629, 8516, 8404, 8292, 8178, 
-        8065, 7952, 7839, 7726, 7613, 7500, 7387, 7275, 7162, 7047, 6936, 6823, 
-        6710, 6597, 6484, 6373, 6258, 6146, 6033, 5920, 5807, 5694, 5582, 5468, 
-        5357, 5244, 5129, 5017, 4905, 4791, 4678, 4566, 4453, 4341, 4228, 4115, 
-        4002, 3889, 3777, 3663, 3550, 3437, 3324, 3212, 3100, 2986, 2874, 2760, 
-        2647, 2536, 2423, 2310, 2197, 2085, 1972, 1858, 1745, 1634, 1521, 1409, 
-        1296, 1184, 1071, 958, 846, 732, 619, 506, 393, 282, 170, 56, 
-        -56, -170, -282, -393, -506, -619, -732, -846, -958, -1071, -1184, -1296, 
-        -1409, -1521, -1634, -1745, -1858, -1972, -2085, -2197, -2310, -2423, -2536, -2647, 
-        -2760, -2874, -2986, -3100, -3212, -3324, -3437, -3550, -3663, -3777, -3889, -4002, 
-        -4115, -4228, -4341, -4453, -4566, -4678, -4791, -4905, -5017, -5129, -5244, -5357, 
-        -5468, -5582, -5694, -5807, -5920, -6033, -6146, -6258, -6373, -6484, -6597, -6710, 
-        -6823, -6936, -7047, -7162, -7275, -7387, -7500, -7613, -7726, -7839, -7952, -8065, 
-        -8178, -8292, -8404, -8516, -8629, -8744, -8855, -8969, -9082, -9195, -9308, -9421, 
-        -9534, -9648, -9761, -9873, -9985, -10100, -10211, -10326, -10438, -10551, -10664, -10779, 
-        -10890, -11004, -11117, -11230, -11343, -11456, -11570, -11683, -11796, -11910, -12023, -12136, 
-        -12249, -12362, -12476, -12588, -12702, -12815, -12928, -13042, -13154, -13268, -13382, -13495, 
-        -13608, -13722, -13835, -13948, -14062, -14174, -14288, -14401, -14514, -14628, -14742, -14855, 
-        -14968, -15082, -15197, -15310, -15422, -15537, -15650, -15764, -15877, -15990, -16105, -16218, 
-        -16330, -16444, -16558, -16671, -16784, -16898, -17013, -17127, -17238, -17354, -17467, -17581, 
-        -17694, -17807, -17923, -18036, -18150, -18263, -18377, -18491, -18604, -18719, -18833, -18947, 
-        -19060, -19174, -19287, -19401, -19516, -19630, -19743, -19857, -19971, -20086, -20200, -20313, 
-        -20427, -20541, -20657, -20770, -20884, -20999, -21111, -21226, -21340, -21454, -21569, -21683, 
-        -21797, -21911, -22026, -22140, -22253, -22370, -22483, -22597, -22711, -22824, -22940, -23054, 
-        -23167, -23283, -23397, -23511, -23627, -23741, -23854, -23970, -24084, -24200, -24313, -24428, 
-        -24542, -24658, -24771, -24887, -25002, -25115, -25231, -25345, -25461, -25575, -25689, -25805, 
-        -25918, -26034, -26149, -26265, -26379, -26493, -26609, -26723, -26839, -26953, -27069, -27183, 
-        -27297, -27413, -27527, -27643, -27759, -27874, -27989, -28104, -28219, -28334, -28450, -28565, 
-        -28680, -28795, -28911, -29027, -29142, -29257, -29372, -29488, -29604, -29719, -29834, -29949, 
-        -30065, -30180, -30296, -30412, -30527, -30643, -30759, -30873, -30990, -31104, -31220, -31336, 
-        -31451, -31566, -31680, -31794, -31907, -32019, -32123, -32226, -32324, -32418, -32517, -32605, 
-        -32689, -32732, -32767, -32725, -32637, -32394, -31998, -31272, -30182, -27896, -20453, -7382 
-    };
-
-    // AKWF_R_sym_saw_24 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_24[600] PROGMEM = {
-        10195, 23613, 28159, 30408, 31639, 32284, 32616, 32726, 32767, 32709, 32658, 32555, 
-        32468, 32352, 32236, 32128, 32034, 31936, 31827, 31715, 31602, 31489, 31374, 31259, 
-        31145, 31030, 30915, 30799, 30685, 30570, 30455, 30341, 30225, 30110, 29996, 29881, 
-        29766, 29652, 29537, 29422, 29306, 29192, 29078, 28962, 28848, 28733, 28619, 28505, 
-        28391, 28276, 28161, 28047, 27932, 27817, 27703, 27588, 27474, 27359, 27246, 27131, 
-        27016, 26903, 26788, 26674, 26559, 26445, 26331, 26217, 26103, 25989, 25874, 25761, 
-        25646, 25533, 25418, 25304, 25190, 25076, 24963, 24848, 24733, 24621, 24505, 24392, 
-        24278, 24164, 24051, 23938, 23822, 23710, 23595, 23482, 23367, 23254, 23141, 23026, 
-        22913, 22798, 22686, 22572, 22459, 22345, 22231, 22117, 22004, 21891, 21778, 21664, 
-        21551, 21436, 21323, 21210, 21095, 20983, 20869, 20756, 20642, 20529, 20416, 20303, 
-        20189, 20076, 19961, 19850, 19736, 19623, 19510, 19397, 19283, 19170, 19057, 18943, 
-        18830, 18716, 18604, 18490, 18379, 18265, 18151, 18039, 17926, 17812, 17699, 17586, 
-        17473, 17361, 17247, 17134, 17021, 16908, 16794, 16683, 16569, 16456, 16343, 16231, 
-        16118, 16006, 15893, 15779, 15667, 15554, 15441, 15328, 15216, 15102, 14991, 14877, 
-        14764, 14651, 14539, 14426, 14314, 14201, 14089, 13975, 13862, 13750, 13638, 13525, 
-        13412, 13300, 13188, 13074, 12962, 12850, 12737, 12623, 12511, 12398, 12286, 12174, 
-        12061, 11949, 11836, 11724, 11612, 11499, 11386, 11274, 11161, 11050, 10936, 10824, 
-        10712, 10600, 10487, 10373, 10262, 10150, 10036, 9925, 9813, 9701, 9588, 9477, 
-        9364, 9251, 9139, 9027, 8914, 8802, 8688, 8577, 8465, 8353, 8239, 8128, 
-        8016, 7904, 7791, 7679, 7565, 7455, 7342, 7230, 7118, 7005, 6893, 6781, 
-        6669, 6557, 6444, 6333, 6220, 6108, 5995, 5883, 5771, 5659, 5548, 5436, 
-        5322, 5211, 5099, 4987, 4874, 4762, 4651, 4538, 4426, 4314, 4201, 4089, 
-        3977, 3865, 3753, 3642, 3528, 3418, 3305, 3193, 3081, 2968, 2856, 2744, 
-        2632, 2520, 2408, 2295, 2183, 2073, 1959, 1847, 1736, 1624, 1512, 1400, 
-        1288, 1176, 1063, 951, 839, 727, 615, 504, 392, 280, 168, 55, 
-        -55, -168, -280, -392, -504, -615, -727, -839, -951, -1063, -1176, -1288, 
-        -1400, -1512, -1624, -1736, -1847, -1959, -2073, -2183, -2295, -2408, -2520, -2632, 
-        -2744, -2856, -2968, -3081, -3193, -3305, -3418, -3528, -3642, -3753, -3865, -3977, 
-        -4089, -4201, -4314, -4426, -4538, -4651, -4762, -4874, -4987, -5099, -5211, -5322, 
-        -5436, -5548, -5659, -5771, -5883, -5995, -6108, -6220, -6333, -6444, -6557, -6669, 
-        -6781, -6893, -7005, -7118, -7230, -7342, -7455, -7565, -7679, -7791, -7904, -8016, 
-        -8128, -8239, -8353, -8465, -8577, -8688, -8802, -8914, -9027, -9139, -9251, -9364, 
-        -9477, -9588, -9701, -9813, -9925, -10036, -10150, -10262, -10373, -10487, -10600, -10712, 
-        -10824, -10936, -11050, -11161, -11274, -11386, -11499, -11612, -11724, -11836, -11949, -12061, 
-        -12174, -12286, -12398, -12511, -12623, -12737, -12850, -12962, -13074, -13188, -13300, -13412, 
-        -13525, -13638, -13750, -13862, -13975, -14089, -14201, -14314, -14426, -14539, -14651, -14764, 
-        -14877, -14991, -15102, -15216, -15328, -15441, -15554, -15667, -15779, -15893, -16006, -16118, 
-        -16231, -16343, -16456, -16569, -16683, -16794, -16908, -17021, -17134, -17247, -17361, -17473, 
-        -17586, -17699, -17812, -17926, -18039, -18151, -18265, -18379, -18490, -18604, -18716, -18830, 
-        -18943, -19057, -19170, -19283, -19397, -19510, -19623, -19736, -19850, -19961, -20076, -20189, 
-        -20303, -20416, -20529, -20642, -20756, -20869, -20983, -21095, -21210, -21323, -21436, -21551, 
-        -21664, -21778, -21891, -22004, -22117, -22231, -22345, -22459, -22572, -22686, -22798, -22913, 
-        -23026, -23141, -23254, -23367, -23482, -23595, -23710, -23822, -23938, -24051, -24164, -24278, 
-        -24392, -24505, -24621, -24733, -24848, -24963, -25076, -25190, -25304, -25418, -25533, -25646, 
-        -25761, -25874, -25989, -26103, -26217, -26331, -26445, -26559, -26674, -26788, -26903, -27016, 
-        -27131, -27246, -27359, -27474, -27588, -27703, -27817, -27932, -28047, -28161, -28276, -28391, 
-        -28505, -28619, -28733, -28848, -28962, -29078, -29192, -29306, -29422, -29537, -29652, -29766, 
-        -29881, -29996, -30110, -30225, -30341, -30455, -30570, -30685, -30799, -30915, -31030, -31145, 
-        -31259, -31374, -31489, -31602, -31715, -31827, -31936, -32034, -32128, -32236, -32352, -32468, 
-        -32555, -32658, -32709, -32767, -32726, -32616, -32284, -31639, -30408, -28159, -23613, -10195 
-    };
-
-    // AKWF_R_sym_saw_25 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_25[600] PROGMEM = {
-        11991, 26940, 30683, 32021, 32546, 32737, 32767, 32691, 32631, 32497, 32418, 32284, 
-        32192, 32064, 31948, 31836, 31747, 31648, 31540, 31428, 31316, 31203, 31088, 30973, 
-        30860, 30747, 30632, 30519, 30404, 30289, 30176, 30062, 29949, 29834, 29721, 29608, 
-        29493, 29380, 29266, 29151, 29040, 28925, 28811, 28698, 28585, 28471, 28357, 28245, 
-        28130, 28017, 27903, 27790, 27677, 27563, 27450, 27335, 27222, 27109, 26995, 26883, 
-        26770, 26657, 26543, 26430, 26315, 26203, 26090, 25978, 25863, 25751, 25638, 25526, 
-        25411, 25298, 25186, 25072, 24959, 24847, 24734, 24620, 24507, 24395, 24282, 24168, 
-        24055, 23942, 23830, 23718, 23604, 23492, 23379, 23267, 23154, 23040, 22929, 22817, 
-        22703, 22590, 22478, 22366, 22254, 22139, 22027, 21915, 21802, 21690, 21578, 21466, 
-        21353, 21241, 21129, 21015, 20904, 20790, 20678, 20566, 20453, 20341, 20229, 20117, 
-        20004, 19892, 19780, 19668, 19556, 19442, 19330, 19219, 19107, 18993, 18881, 18771, 
-        18657, 18545, 18433, 18323, 18209, 18098, 17987, 17872, 17760, 17650, 17536, 17424, 
-        17312, 17202, 17088, 16978, 16865, 16754, 16641, 16529, 16417, 16306, 16194, 16082, 
-        15970, 15858, 15746, 15636, 15524, 15412, 15300, 15188, 15077, 14964, 14853, 14740, 
-        14629, 14517, 14405, 14294, 14183, 14071, 13959, 13847, 13736, 13623, 13513, 13401, 
-        13289, 13178, 13066, 12955, 12842, 12732, 12621, 12509, 12396, 12285, 12175, 12063, 
-        11951, 11840, 11728, 11617, 11505, 11394, 11282, 11171, 11059, 10948, 10836, 10725, 
-        10613, 10503, 10390, 10279, 10167, 10057, 9946, 9834, 9724, 9612, 9501, 9389, 
-        9279, 9167, 9055, 8943, 8832, 8722, 8610, 8498, 8387, 8275, 8165, 8054, 
-        7942, 7831, 7719, 7609, 7498, 7386, 7274, 7164, 7052, 6941, 6829, 6719, 
-        6608, 6496, 6386, 6275, 6163, 6052, 5940, 5830, 5718, 5607, 5497, 5386, 
-        5274, 5164, 5052, 4940, 4829, 4720, 4608, 4497, 4385, 4275, 4163, 4051, 
-        3942, 3830, 3719, 3607, 3497, 3386, 3274, 3164, 3052, 2941, 2829, 2718, 
-        2608, 2497, 2385, 2275, 2164, 2052, 1942, 1831, 1720, 1608, 1498, 1386, 
-        1277, 1166, 1054, 942, 832, 721, 610, 499, 388, 276, 165, 56, 
-        -56, -165, -276, -388, -499, -610, -721, -832, -942, -1054, -1166, -1277, 
-        -1386, -1498, -1608, -1720, -1831, -1942, -2052, -2164, -2275, -2385, -2497, -2608, 
-        -2718, -2829, -2941, -3052, -3164, -3274, -3386, -3497, -3607, -3719, -3830, -3942, 
-        -4051, -4163, -4275, -4385, -4497, -4608, -4720, -4829, -4940, -5052, -5164, -5274, 
-        -5386, -5497, -5607, -5718, -5830, -5940, -6052, -6163, -6275, -6386, -6496, -6608, 
-        -6719, -6829, -6941, -7052, -7164, -7274, -7386, -7498, -7609, -7719, -7831, -7942, 
-        -8054, -8165, -8275, -8387, -8498, -8610, -8722, -8832, -8943, -9055, -9167, -9279, 
-        -9389, -9501, -9612, -9724, -9834, -9946, -10057, -10167, -10279, -10390, -10503, -10613, 
-        -10725, -10836, -10948, -11059, -11171, -11282, -11394, -11505, -11617, -11728, -11840, -11951, 
-        -12063, -12175, -12285, -12396, -12509, -12621, -12732, -12842, -12955, -13066, -13178, -13289, 
-        -13401, -13513, -13623, -13736, -13847, -13959, -14071, -14183, -14294, -14405, -14517, -14629, 
-        -14740, -14853, -14964, -15077, -15188, -15300, -15412, -15524, -15636, -15746, -15858, -15970, 
-        -16082, -16194, -16306, -16417, -16529, -16641, -16754, -16865, -16978, -17088, -17202, -17312, 
-        -17424, -17536, -17650, -17760, -17872, -17987, -18098, -18209, -18323, -18433, -18545, -18657, 
-        -18771, -18881, -18993, -19107, -19219, -19330, -19442, -19556, -19668, -19780, -19892, -20004, 
-        -20117, -20229, -20341, -20453, -20566, -20678, -20790, -20904, -21015, -21129, -21241, -21353, 
-        -21466, -21578, -21690, -21802, -21915, -22027, -22139, -22254, -22366, -22478, -22590, -22703, 
-        -22817, -22929, -23040, -23154, -23267, -23379, -23492, -23604, -23718, -23830, -23942, -24055, 
-        -24168, -24282, -24395, -24507, -24620, -24734, -24847, -24959, -25072, -25186, -25298, -25411, 
-        -25526, -25638, -25751, -25863, -25978, -26090, -26203, -26315, -26430, -26543, -26657, -26770, 
-        -26883, -26995, -27109, -27222, -27335, -27450, -27563, -27677, -27790, -27903, -28017, -28130, 
-        -28245, -28357, -28471, -28585, -28698, -28811, -28925, -29040, -29151, -29266, -29380, -29493, 
-        -29608, -29721, -29834, -29949, -30062, -30176, -30289, -30404, -30519, -30632, -30747, -30860, 
-        -30973, -31088, -31203, -31316, -31428, -31540, -31648, -31747, -31836, -31948, -32064, -32192, 
-        -32284, -32418, -32497, -32631, -32691, -32767, -32737, -32546, -32021, -30683, -26940, -11991 
-    };
-
-    // AKWF_R_sym_saw_26 → 600 samples
-    static const int16_t akwf_akwf_bwsawrounded_akwf_r_sym_saw_26[600] PROGMEM = {
-        13935, 30154, 32483, 32767, 32729, 32670, 32568, 32436, 32350, 32196, 32126, 31980, 
-        31901, 31764, 31653, 31539, 31460, 31359, 31250, 31136, 31025, 30910, 30799, 30685, 
-        30572, 30459, 30346, 30232, 30121, 30007, 29895, 29782, 29669, 29557, 29443, 29331, 
-        29219, 29105, 28994, 28880, 28768, 28656, 28544, 28430, 28318, 28205, 28093, 27981, 
-        27869, 27756, 27643, 27530, 27418, 27306, 27193, 27081, 26969, 26857, 26744, 26633, 
-        26520, 26407, 26295, 26183, 26072, 25958, 25847, 25735, 25623, 25511, 25398, 25286, 
-        25175, 25063, 24950, 24840, 24727, 24615, 24503, 24392, 24280, 24167, 24055, 23944, 
-        23832, 23719, 23609, 23496, 23385, 23273, 23161, 23050, 22939, 22827, 22714, 22604, 
-        22491, 22379, 22268, 22157, 22046, 21934, 21823, 21711, 21599, 21488, 21377, 21266, 
-        21154, 21043, 20930, 20819, 20707, 20596, 20487, 20374, 20262, 20151, 20040, 19930, 
-        19817, 19705, 19595, 19485, 19374, 19261, 19152, 19040, 18929, 18816, 18707, 18595, 
-        18484, 18374, 18262, 18151, 18040, 17929, 17818, 17706, 17596, 17484, 17373, 17264, 
-        17151, 17041, 16931, 16819, 16708, 16597, 16486, 16375, 16264, 16153, 16042, 15933, 
-        15822, 15711, 15600, 15489, 15380, 15269, 15158, 15046, 14936, 14824, 14714, 14604, 
-        14493, 14382, 14271, 14161, 14049, 13938, 13829, 13719, 13608, 13497, 13386, 13277, 
-        13166, 13055, 12944, 12833, 12724, 12613, 12503, 12391, 12282, 12171, 12061, 11950, 
-        11839, 11730, 11619, 11508, 11397, 11286, 11177, 11067, 10956, 10847, 10736, 10625, 
-        10514, 10403, 10295, 10184, 10073, 9964, 9853, 9743, 9633, 9522, 9412, 9301, 
-        9192, 9081, 8970, 8860, 8749, 8640, 8529, 8420, 8309, 8199, 8088, 7979, 
-        7868, 7757, 7647, 7538, 7428, 7317, 7208, 7097, 6986, 6877, 6766, 6656, 
-        6545, 6436, 6326, 6215, 6106, 5996, 5885, 5775, 5665, 5556, 5445, 5335, 
-        5224, 5115, 5005, 4894, 4785, 4674, 4564, 4455, 4344, 4234, 4125, 4014, 
-        3903, 3794, 3684, 3573, 3464, 3354, 3243, 3134, 3023, 2913, 2804, 2693, 
-        2583, 2474, 2364, 2254, 2144, 2033, 1922, 1814, 1703, 1594, 1484, 1375, 
-        1264, 1154, 1045, 935, 824, 715, 605, 494, 383, 275, 164, 55, 
-        -55, -164, -275, -383, -494, -605, -715, -824, -935, -1045, -1154, -1264, 
-        -1375, -1484, -1594, -1703, -1814, -1922, -2033, -2144, -2254, -2364, -2474, -2583, 
-        -2693, -2804, -2913, -3023, -3134, -3243, -3354, -3464, -3573, -3684, -3794, -3903, 
-        -4014, -4125, -4234, -4344, -4455, -4564, -4674, -4785, -4894, -5005, -5115, -5224, 
-        -5335, -5445, -5556, -5665, -5775, -5885, -5996, -6106, -6215, -6326, -6436, -6545, 
-        -6656, -6766, -6877, -6986, -7097, -7208, -7317, -7428, -7538, -7647, -7757, -7868, 
-        -7979, -8088, -8199, -8309, -8420, -8529, -8640, -8749, -8860, -8970, -9081, -9192, 
-        -9301, -9412, -9522, -9633, -9743, -9853, -9964, -10073, -10184, -10295, -10403, -10514, 
-        -10625, -10736, -10847, -10956, -11067, -11177, -11286, -11397, -11508, -11619, -11730, -11839, 
-        -11950, -12061, -12171, -12282, -12391, -12503, -12613, -12724, -12833, -12944, -13055, -13166, 
-        -13277, -13386, -13497, -13608, -13719, -13829, -13938, -14049, -14161, -14271, -14382, -14493, 
-        -14604, -14714, -14824, -14936, -15046, -15158, -15269, -15380, -15489, -15600, -15711, -15822, 
-        -15933, -16042, -16153, -16264, -16375, -16486, -16597, -16708, -16819, -16931, -17041, -17151, 
-        -17264, -17373, -17484, -17596, -17706, -17818, -17929, -18040, -18151, -18262, -18374, -18484, 
-        -18595, -18707, -18816, -18929, -19040, -19152, -19261, -19374, -19485, -19595, -19705, -19817, 
-        -19930, -20040, -20151, -20262, -20374, -20487, -20596, -20707, -20819, -20930, -21043, -21154, 
-        -21266, -21377, -21488, -21599, -21711, -21823, -21934, -22046, -22157, -22268, -22379, -22491, 
-        -22604, -22714, -22827, -22939, -23050, -23161, -23273, -23385, -23496, -23609, -23719, -23832, 
-        -23944, -24055, -24167, -24280, -24392, -24503, -24615, -24727, -24840, -24950, -25063, -25175, 
-        -25286, -25398, -25511, -25623, -25735, -25847, -25958, -26072, -26183, -26295, -26407, -26520, 
-        -26633, -26744, -26857, -26969, -27081, -27193, -27306, -27418, -27530, -27643, -27756, -27869, 
-        -27981, -28093, -28205, -28318, -28430, -28544, -28656, -28768, -28880, -28994, -29105, -29219, 
-        -29331, -29443, -29557, -29669, -29782, -29895, -30007, -30121, -30232, -30346, -30459, -30572, 
-        -30685, -30799, -30910, -31025, -31136, -31250, -31359, -31460, -31539, -31653, -31764, -31901, 
-        -31980, -32126, -32196, -32350, -32436, -32568, -32670, -32729, -32767, -32483, -30154, -13935 
-    };
-
-} // namespace AKWF_BwSawrounded
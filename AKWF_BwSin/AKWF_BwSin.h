@@ -1,30 +1,274 @@
-// Auto‑generated AKWF bank. Do not edit manually.
+// Auto‑generated AKWF bank (compressed, see AKWFCodec.h). Do not edit manually.
 
 #pragma once
 #include <Arduino.h>
 
-#include "AKWF_BwSin_Tables_Part0.h"
-
 namespace AKWF_BwSin {
+
     constexpr uint16_t count = 12;
-}
 
-// Return a pointer to the n‑th waveform table in this bank.
-// If index is out of range, returns nullptr and length is set to 0.
-inline const int16_t* AKWF_BwSin_get(uint16_t index, uint16_t &length) {
-    switch(index) {
-        case 0: length = 600; return AKWF_BwSin::akwf_akwf_bwsin_akwf_sin_0001;
-        case 1: length = 600; return AKWF_BwSin::akwf_akwf_bwsin_akwf_sin_0002;
-        case 2: length = 600; return AKWF_BwSin::akwf_akwf_bwsin_akwf_sin_0003;
-        case 3: length = 600; return AKWF_BwSin::akwf_akwf_bwsin_akwf_sin_0004;
-        case 4: length = 600; return AKWF_BwSin::akwf_akwf_bwsin_akwf_sin_0005;
-        case 5: length = 600; return AKWF_BwSin::akwf_akwf_bwsin_akwf_sin_0006;
-        case 6: length = 600; return AKWF_BwSin::akwf_akwf_bwsin_akwf_sin_0007;
-        case 7: length = 600; return AKWF_BwSin::akwf_akwf_bwsin_akwf_sin_0008;
-        case 8: length = 600; return AKWF_BwSin::akwf_akwf_bwsin_akwf_sin_0009;
-        case 9: length = 600; return AKWF_BwSin::akwf_akwf_bwsin_akwf_sin_0010;
-        case 10: length = 600; return AKWF_BwSin::akwf_akwf_bwsin_akwf_sin_0011;
-        case 11: length = 600; return AKWF_BwSin::akwf_akwf_bwsin_akwf_sin_0012;
-        default: length = 0; return nullptr;
-    }
-}
+    // 14400 bytes as int16 → 3896 bytes
+
+    static const uint8_t data[3896] PROGMEM = {
+        0x03, 0x6F, 0xF4, 0x5F, 0x97, 0xC3, 0x81, 0x02, 0x10, 0x18, 0x20, 0x62, 0x03, 0x86, 0x06, 0x00,
+        0x10, 0x12, 0x41, 0xD6, 0x7A, 0xDD, 0x38, 0x26, 0xA5, 0x10, 0xC2, 0xF7, 0xDE, 0xB1, 0x18, 0x52,
+        0x6F, 0x94, 0x02, 0x6F, 0x9D, 0xC0, 0x65, 0x33, 0x79, 0x63, 0x0B, 0x82, 0x0C, 0x48, 0xC6, 0xFC,
+        0xF7, 0x8C, 0xDE, 0x23, 0x37, 0x8C, 0xDC, 0x96, 0x38, 0xDF, 0x34, 0x5E, 0x1B, 0x32, 0xC6, 0x17,
+        0x8D, 0xC1, 0x0B, 0x81, 0x71, 0xCD, 0xC1, 0x70, 0x94, 0xD5, 0xE1, 0x84, 0xAE, 0x8C, 0x30, 0x4A,
+        0x9A, 0x29, 0xD3, 0x4E, 0xA6, 0xA6, 0x98, 0x32, 0xC9, 0xAF, 0x53, 0xDC, 0x31, 0x84, 0xAF, 0xCF,
+        0x72, 0x53, 0x9B, 0x09, 0x4E, 0x19, 0x82, 0x6A, 0x6A, 0xF5, 0x9C, 0x48, 0xF3, 0xBF, 0x3B, 0x81,
+        0x70, 0x06, 0x01, 0x18, 0x26, 0x27, 0x56, 0x14, 0x33, 0x57, 0x44, 0xA6, 0x03, 0xA9, 0xC5, 0xAA,
+        0xB8, 0x53, 0x42, 0x6F, 0x17, 0x9B, 0x88, 0x44, 0x88, 0xC1, 0x39, 0xEF, 0x8B, 0xCF, 0x7C, 0x16,
+        0x14, 0x67, 0x8B, 0x51, 0x78, 0x61, 0x07, 0x8C, 0xE8, 0x75, 0xF3, 0x60, 0x39, 0x79, 0xB2, 0x5C,
+        0x20, 0xD2, 0x57, 0x82, 0x44, 0x5E, 0x9B, 0xA2, 0x20, 0xC3, 0x4A, 0x75, 0xBE, 0x33, 0x8B, 0xD5,
+        0x89, 0xE7, 0xBE, 0x50, 0xCA, 0x66, 0xE4, 0xDC, 0x25, 0x34, 0x5E, 0x1B, 0xC5, 0xD1, 0x00, 0xD0,
+        0xD6, 0x11, 0x09, 0x71, 0xCE, 0xF9, 0xA5, 0x05, 0x14, 0x54, 0xF1, 0xCF, 0x12, 0x04, 0x49, 0x55,
+        0xEA, 0xEA, 0x71, 0xBE, 0x25, 0x07, 0x0A, 0x47, 0x04, 0xCB, 0x13, 0x29, 0x9B, 0x38, 0x57, 0x05,
+        0x07, 0x4C, 0x45, 0xE0, 0xBA, 0x64, 0x04, 0x5E, 0xB3, 0x89, 0xAB, 0xD6, 0x68, 0x38, 0x14, 0x96,
+        0x66, 0x92, 0x20, 0x3C, 0x1E, 0xE0, 0xE2, 0x2F, 0x0D, 0xE5, 0x78, 0x34, 0x82, 0x11, 0x79, 0x47,
+        0x9D, 0x1C, 0xCE, 0xF1, 0x61, 0x28, 0x49, 0x41, 0x23, 0x9B, 0x33, 0x61, 0x2E, 0x20, 0x2C, 0x96,
+        0x05, 0xE2, 0x91, 0xCE, 0x8F, 0x95, 0xC2, 0xE2, 0x02, 0x5F, 0xFF, 0xFF, 0x2A, 0xD2, 0xA7, 0x18,
+        0x78, 0x2D, 0x2A, 0x0B, 0x8E, 0x8C, 0x2B, 0xCA, 0xA2, 0x71, 0x56, 0x3C, 0x18, 0xD1, 0x35, 0x61,
+        0x42, 0x9E, 0x39, 0x27, 0x40, 0x41, 0x19, 0x6A, 0xBC, 0x03, 0xAA, 0xF1, 0xE0, 0xDE, 0xC8, 0x2F,
+        0x40, 0x55, 0x9D, 0x0F, 0xAA, 0xD2, 0xC9, 0x68, 0x62, 0xC6, 0x09, 0x2F, 0x31, 0xAE, 0xDC, 0xDF,
+        0x2F, 0x59, 0x17, 0x10, 0x8C, 0x35, 0x7B, 0x1F, 0x37, 0xB7, 0x8C, 0x1E, 0x33, 0x8C, 0xB5, 0x8D,
+        0xBD, 0x68, 0xE7, 0x58, 0xA5, 0xE6, 0x23, 0x89, 0x8C, 0x73, 0xB6, 0xA6, 0xA4, 0xFD, 0xC5, 0xCE,
+        0xDD, 0xDB, 0xBD, 0xC6, 0xE7, 0x24, 0x3B, 0xC7, 0x93, 0x27, 0xB5, 0x37, 0x6C, 0xDE, 0x4A, 0x36,
+        0xF2, 0xAE, 0x5C, 0xB7, 0xBA, 0xF7, 0xAE, 0x49, 0xB9, 0xB3, 0x27, 0x90, 0x76, 0x33, 0x65, 0x97,
+        0x22, 0x67, 0x96, 0x7C, 0x97, 0xEE, 0xBC, 0xE5, 0x72, 0x67, 0x88, 0x3D, 0x46, 0x33, 0x33, 0x7C,
+        0x50, 0xFA, 0xE0, 0x75, 0xBC, 0x23, 0xAD, 0xA2, 0x7B, 0xC0, 0xB8, 0xCA, 0x71, 0x81, 0xBE, 0x74,
+        0x17, 0xD6, 0xC7, 0xBE, 0x8F, 0xBE, 0x8F, 0xAD, 0x8C, 0x8F, 0xAE, 0xC7, 0xBE, 0x41, 0xCF, 0x65,
+        0xD7, 0x02, 0x8E, 0x27, 0xA2, 0xEB, 0x91, 0xE7, 0xA4, 0xE7, 0x40, 0x3C, 0x68, 0x9C, 0x52, 0x21,
+        0x57, 0x20, 0xAB, 0x98, 0xA8, 0xC7, 0x71, 0xE7, 0xA8, 0x77, 0xA6, 0x25, 0xCB, 0x51, 0x41, 0x5D,
+        0x87, 0x8E, 0x23, 0x5B, 0x22, 0xB2, 0xA6, 0x01, 0x82, 0xB9, 0x95, 0x8E, 0xC2, 0x5F, 0x61, 0x0E,
+        0xF8, 0x14, 0x7E, 0x7E, 0xD1, 0xBE, 0xC5, 0xC7, 0xB0, 0x1D, 0x76, 0x0C, 0xFB, 0x29, 0xD7, 0x48,
+        0x6F, 0xD0, 0x8B, 0x3F, 0x01, 0xC7, 0x93, 0x5F, 0x0C, 0x0F, 0x7E, 0xC1, 0x6E, 0xBF, 0x07, 0x3D,
+        0x81, 0xF9, 0x25, 0xF9, 0x50, 0xCA, 0xBD, 0x81, 0x70, 0xC2, 0xBC, 0x88, 0x72, 0x84, 0x27, 0xD0,
+        0xC8, 0x29, 0xA5, 0xF8, 0x49, 0xF2, 0x95, 0x27, 0xC0, 0x99, 0x8F, 0x86, 0x3C, 0x98, 0x70, 0xA0,
+        0xC2, 0x16, 0x5C, 0x28, 0xB9, 0x16, 0x27, 0xE9, 0x60, 0xFC, 0x05, 0xAE, 0x0E, 0xB8, 0x3A, 0x2D,
+        0x1C, 0x6A, 0x2A, 0x17, 0xAB, 0xF0, 0x23, 0x51, 0x05, 0x1C, 0x3E, 0x22, 0xA2, 0x2A, 0x2A, 0xA3,
+        0x0B, 0x05, 0x0B, 0xA7, 0xAA, 0xA5, 0x8C, 0x61, 0xFA, 0x3A, 0xD1, 0x84, 0x25, 0x24, 0x6D, 0x17,
+        0x24, 0x90, 0x70, 0x5B, 0x01, 0xF2, 0x7C, 0x1A, 0x03, 0xD2, 0x32, 0xD9, 0xE0, 0x5C, 0x1E, 0x87,
+        0x42, 0x0D, 0xA3, 0x0D, 0xAF, 0x22, 0xED, 0xAC, 0xB8, 0x5D, 0x8F, 0x6A, 0xA7, 0x4D, 0xEC, 0x3C,
+        0x2F, 0x0C, 0xAE, 0x9C, 0x2E, 0x49, 0x44, 0x68, 0x0D, 0xD5, 0xAA, 0xAA, 0xD5, 0x44, 0x64, 0x04,
+        0xCD, 0x40, 0x4C, 0xD2, 0xE2, 0xA4, 0x54, 0x42, 0x84, 0xE4, 0xBD, 0x92, 0x42, 0x81, 0xB2, 0x51,
+        0x55, 0x28, 0x51, 0x44, 0xE2, 0xAA, 0x13, 0xE6, 0xC6, 0x8E, 0x8A, 0x30, 0x0A, 0xCC, 0xFF, 0x98,
+        0x02, 0x5B, 0x1F, 0xE2, 0x7F, 0xE4, 0x47, 0x40, 0xB2, 0xE2, 0x2E, 0x19, 0x08, 0x16, 0x5C, 0x06,
+        0xCE, 0x18, 0x5C, 0x0F, 0x86, 0x61, 0xC3, 0x70, 0xE1, 0x98, 0x61, 0x74, 0x19, 0x28, 0xBD, 0x90,
+        0x56, 0xC6, 0x3C, 0xF6, 0x56, 0x43, 0xE0, 0x3F, 0x38, 0x61, 0x79, 0xF4, 0xE2, 0x3A, 0x6E, 0x61,
+        0x86, 0xE1, 0xA1, 0xF9, 0xD2, 0x1B, 0x85, 0x33, 0x98, 0x69, 0xE6, 0x90, 0xBE, 0x7C, 0x0F, 0xB9,
+        0xA6, 0x6F, 0x3D, 0x3C, 0xD0, 0x33, 0x74, 0xDC, 0x1C, 0xE6, 0xF3, 0xA7, 0x74, 0x39, 0xDE, 0x9B,
+        0x98, 0x4D, 0xE6, 0x58, 0xEE, 0xE3, 0xBB, 0xC7, 0xB0, 0x3B, 0xB0, 0x3B, 0x04, 0x3B, 0x0F, 0x6D,
+        0xBB, 0x6F, 0x6E, 0x3D, 0xC1, 0x6E, 0xC6, 0xC6, 0xE6, 0x47, 0x67, 0x27, 0x97, 0x65, 0x39, 0x7B,
+        0x1E, 0xF1, 0xED, 0xBF, 0x78, 0xEF, 0x63, 0x65, 0x7B, 0x7B, 0xB7, 0x7D, 0xB7, 0x7E, 0xE3, 0x7E,
+        0xF8, 0x3C, 0xE6, 0x0F, 0x9A, 0x39, 0xEE, 0x01, 0xCF, 0x0C, 0xE6, 0x86, 0xFB, 0xD1, 0xE7, 0x9D,
+        0x1F, 0x78, 0x07, 0x7E, 0x19, 0xCC, 0x0D, 0x1F, 0x7A, 0x1E, 0xF8, 0x3E, 0x70, 0x4E, 0x78, 0x3A,
+        0x73, 0x3C, 0x03, 0x7A, 0x43, 0xCF, 0xA3, 0xEF, 0x91, 0x1E, 0xFA, 0x27, 0x34, 0x81, 0x15, 0xD0,
+        0xB8, 0x31, 0xD8, 0x0A, 0xEC, 0x1C, 0x72, 0x12, 0xB3, 0xE8, 0x69, 0x9E, 0x81, 0x9F, 0x03, 0x9E,
+        0x01, 0x7A, 0x69, 0x33, 0x7C, 0x29, 0xBF, 0x4E, 0x1F, 0x3C, 0x0F, 0x7E, 0x86, 0x99, 0xE0, 0x89,
+        0x1C, 0x04, 0x9E, 0x81, 0xCF, 0x62, 0xD1, 0x3C, 0x08, 0xBF, 0x02, 0xD1, 0x6C, 0x45, 0x74, 0x0D,
+        0x17, 0xD8, 0x37, 0xB1, 0x13, 0xC8, 0x03, 0xBE, 0x08, 0x79, 0xF4, 0x79, 0xD2, 0x9C, 0xF4, 0xA7,
+        0x3E, 0x08, 0x67, 0x8F, 0x20, 0xBE, 0x81, 0x3D, 0x12, 0xF8, 0x60, 0x79, 0xF4, 0x34, 0x9E, 0x10,
+        0x9E, 0x90, 0x85, 0xF4, 0xC3, 0x7F, 0x81, 0x9F, 0x04, 0x42, 0xE8, 0x60, 0x01, 0x04, 0x0B, 0xA1,
+        0x8B, 0xA1, 0x8B, 0xB0, 0xD1, 0x12, 0x1A, 0x4F, 0x48, 0x1E, 0x10, 0x3D, 0x02, 0x8E, 0x78, 0x51,
+        0xE9, 0x47, 0xD0, 0x12, 0x09, 0x04, 0x0D, 0x26, 0x7A, 0x00, 0x60, 0x87, 0x80, 0x50, 0x21, 0x08,
+        0x3F, 0x49, 0x9E, 0x10, 0x1B, 0x06, 0x03, 0x46, 0x84, 0x12, 0x4D, 0x08, 0x1D, 0x0F, 0x08, 0x41,
+        0x29, 0x04, 0xA4, 0x13, 0x04, 0x48, 0x1E, 0x80, 0x9C, 0x1E, 0x9A, 0x3E, 0x18, 0x1D, 0x13, 0x40,
+        0x43, 0xE0, 0xF4, 0xD1, 0xE8, 0x9A, 0x02, 0x70, 0x9D, 0x34, 0x7A, 0x1D, 0x01, 0x13, 0xC3, 0x3A,
+        0x68, 0xE1, 0xC0, 0xC3, 0xA6, 0x74, 0x40, 0x50, 0xB0, 0x64, 0xBE, 0x48, 0x1E, 0x4B, 0x23, 0x02,
+        0x28, 0x8C, 0xD3, 0x86, 0x69, 0xCB, 0x53, 0xF4, 0xE6, 0x81, 0xC3, 0x34, 0xC2, 0xE6, 0x1A, 0x5C,
+        0xFA, 0x77, 0xA3, 0xF4, 0xE6, 0x9A, 0x66, 0x7C, 0x37, 0x41, 0xD0, 0xF7, 0xC0, 0x43, 0xAF, 0x26,
+        0x31, 0xD9, 0x78, 0x20, 0xAD, 0x06, 0xFD, 0x07, 0x3D, 0x95, 0xC0, 0x02, 0x9F, 0x39, 0xBF, 0x93,
+        0x33, 0x23, 0xFA, 0xA5, 0xED, 0xF8, 0xA2, 0x0B, 0x09, 0x00, 0xE0, 0x20, 0x09, 0x00, 0x00, 0x00,
+        0x04, 0x05, 0x80, 0xA4, 0xAE, 0xE3, 0x98, 0xB8, 0xB1, 0x2D, 0x4C, 0x91, 0x36, 0xDB, 0x37, 0xD2,
+        0xBF, 0x63, 0xFA, 0x18, 0xAA, 0xA8, 0xBA, 0x95, 0x52, 0xAF, 0x2C, 0xDA, 0xAA, 0x18, 0x06, 0x84,
+        0x29, 0x21, 0x86, 0x18, 0xE1, 0x1E, 0x42, 0x5F, 0xF2, 0x7F, 0xFD, 0xE4, 0xFC, 0x3F, 0xCE, 0x47,
+        0x0C, 0x27, 0x02, 0xC2, 0xB2, 0x85, 0x25, 0x39, 0x3B, 0x3B, 0x72, 0xEF, 0x2D, 0xE5, 0xDC, 0x92,
+        0xDC, 0xCB, 0xCB, 0xB9, 0xB7, 0x72, 0xF3, 0x6C, 0xA6, 0x6E, 0x66, 0xE6, 0xDB, 0xCD, 0xCB, 0xB6,
+        0x59, 0x79, 0x6E, 0xE6, 0xDE, 0x5D, 0xCB, 0xB9, 0x2B, 0x1C, 0xB7, 0x3B, 0x17, 0x37, 0x27, 0x67,
+        0x24, 0xDE, 0x57, 0x6C, 0xCE, 0x5D, 0xB9, 0x77, 0x25, 0x6D, 0xCD, 0xC9, 0xCC, 0x99, 0xB7, 0x36,
+        0xCD, 0x4D, 0xC2, 0x26, 0xE1, 0x13, 0x38, 0x83, 0x9F, 0xFF, 0x55, 0x47, 0xFF, 0x99, 0xFF, 0xD3,
+        0xA0, 0xF1, 0x65, 0x0A, 0x38, 0xA3, 0x86, 0x28, 0x46, 0x80, 0x59, 0x75, 0xF7, 0xA9, 0xDC, 0x5C,
+        0x93, 0x93, 0x20, 0xB7, 0x8D, 0xCC, 0x6C, 0x93, 0x6C, 0x49, 0x96, 0x40, 0x73, 0x0D, 0xB1, 0x9A,
+        0xCC, 0x5B, 0x59, 0x90, 0x18, 0x07, 0x01, 0xC0, 0x80, 0x2C, 0x01, 0x00, 0x40, 0x50, 0x44, 0x04,
+        0x0A, 0xC3, 0x9E, 0x40, 0xFF, 0x65, 0xA6, 0x3F, 0xF5, 0x45, 0xFF, 0xFF, 0xFA, 0x02, 0x90, 0xAA,
+        0x38, 0xD8, 0x78, 0x88, 0x00, 0x00, 0x08, 0x60, 0x30, 0x08, 0x40, 0x40, 0x19, 0x74, 0xF0, 0xF0,
+        0x2A, 0x0D, 0x52, 0x15, 0x10, 0x50, 0x6B, 0x42, 0x17, 0x05, 0x74, 0x15, 0x55, 0x19, 0x41, 0x86,
+        0xC7, 0x68, 0x47, 0x45, 0xB2, 0x05, 0x85, 0x46, 0x28, 0x41, 0x04, 0x20, 0x14, 0x07, 0x47, 0xFE,
+        0x57, 0xFF, 0xBB, 0xC2, 0xEC, 0x06, 0x69, 0x42, 0xC0, 0xE1, 0x71, 0x4B, 0x55, 0x88, 0xC2, 0xE0,
+        0xA2, 0xA3, 0x1A, 0x88, 0xD4, 0x62, 0x97, 0x15, 0x50, 0x5A, 0x8C, 0x56, 0x23, 0x15, 0x1A, 0xC4,
+        0x55, 0x62, 0x8A, 0xB1, 0x58, 0x88, 0xD6, 0x2A, 0x31, 0x1A, 0x8D, 0x41, 0x46, 0x2B, 0x11, 0xA8,
+        0xC5, 0x46, 0x2B, 0x03, 0xA8, 0x28, 0xAE, 0x06, 0x2B, 0x14, 0xB8, 0x5A, 0x88, 0xD1, 0x2F, 0x10,
+        0xAB, 0x51, 0x88, 0xA8, 0xC5, 0x62, 0x22, 0x8B, 0x14, 0xB5, 0x4A, 0xB1, 0x15, 0x88, 0xA8, 0xC0,
+        0x52, 0x84, 0x20, 0x02, 0x84, 0x10, 0xA0, 0x08, 0x13, 0x79, 0x2F, 0xFE, 0x5F, 0xFF, 0x52, 0x79,
+        0xF5, 0xA4, 0x5A, 0x0D, 0x04, 0x61, 0xB0, 0x49, 0x17, 0x81, 0x66, 0xB8, 0x78, 0xA4, 0xB4, 0xA8,
+        0x71, 0x7C, 0x51, 0x3E, 0x12, 0x58, 0x81, 0x4A, 0xA0, 0x0E, 0x99, 0x44, 0x40, 0xD4, 0xE9, 0xE2,
+        0x0E, 0xA7, 0x18, 0xB4, 0x60, 0x84, 0x68, 0x87, 0xB3, 0xA8, 0x03, 0x5F, 0xFF, 0xB9, 0xFA, 0xBF,
+        0xC7, 0x04, 0x60, 0xC3, 0x00, 0x61, 0x05, 0x08, 0x10, 0x02, 0x00, 0x62, 0x2F, 0x99, 0xF6, 0x4B,
+        0x32, 0xE6, 0x8C, 0x2F, 0x95, 0x66, 0x56, 0x4D, 0x9C, 0x26, 0x1C, 0x3A, 0x9A, 0x69, 0x5D, 0x18,
+        0x63, 0x18, 0xF3, 0xA6, 0x10, 0x35, 0xF9, 0xA3, 0x94, 0xE5, 0x40, 0xF3, 0xEF, 0x96, 0x14, 0xB1,
+        0x69, 0x15, 0x3C, 0x66, 0x08, 0x29, 0x21, 0xDC, 0x59, 0x96, 0xF0, 0x49, 0xB9, 0x85, 0x74, 0x98,
+        0x9A, 0x11, 0x35, 0x75, 0x34, 0x40, 0x4F, 0x56, 0x77, 0xE7, 0x6E, 0x17, 0xC6, 0x36, 0x06, 0x1E,
+        0xE6, 0x4A, 0x31, 0xDF, 0x19, 0x64, 0x28, 0x4E, 0x74, 0x9C, 0x2A, 0xB5, 0x38, 0x9A, 0x9C, 0x58,
+        0x8C, 0x0F, 0xD0, 0x0E, 0x1D, 0xFC, 0xBA, 0x98, 0x06, 0xCE, 0x82, 0x41, 0x14, 0x64, 0x78, 0x46,
+        0x9E, 0x1F, 0x44, 0xC9, 0x0E, 0xFE, 0x5A, 0xCB, 0x25, 0x0A, 0x19, 0x52, 0x50, 0x8D, 0x04, 0x25,
+        0x56, 0x60, 0xAD, 0x4A, 0x22, 0xAE, 0x84, 0xF3, 0x3D, 0xE0, 0x43, 0x2E, 0x33, 0xCE, 0x89, 0xBF,
+        0x09, 0xD9, 0x23, 0x71, 0x18, 0x3B, 0x98, 0x6D, 0xE3, 0x04, 0x61, 0x06, 0x76, 0xFE, 0x2E, 0x37,
+        0x2F, 0x13, 0x3A, 0x39, 0x23, 0x72, 0x2F, 0x1D, 0xC3, 0x28, 0xE6, 0xF3, 0x71, 0x97, 0x8D, 0xC6,
+        0x30, 0x77, 0xC2, 0x88, 0x72, 0x7B, 0xCB, 0x86, 0x8E, 0x40, 0x3B, 0xF9, 0xDC, 0x4C, 0xEF, 0x8A,
+        0x31, 0xE7, 0xDF, 0x96, 0x11, 0x5C, 0x97, 0x08, 0xB8, 0x8B, 0xA6, 0x8D, 0x37, 0x89, 0x30, 0x27,
+        0x34, 0xBC, 0xDF, 0x37, 0x9B, 0x00, 0x82, 0x59, 0x13, 0x34, 0xC7, 0x27, 0x62, 0x33, 0x10, 0xA7,
+        0xCB, 0x47, 0x0E, 0x74, 0x63, 0x8A, 0x60, 0x3B, 0xE6, 0x57, 0x4B, 0x06, 0xAE, 0xA5, 0x43, 0x87,
+        0x7C, 0x00, 0x04, 0xD3, 0xCF, 0xB9, 0xC8, 0x50, 0xDF, 0x2C, 0x31, 0x09, 0x1A, 0x9A, 0x20, 0xBF,
+        0x7F, 0x9F, 0x9E, 0x5F, 0x87, 0xEC, 0x7D, 0x1B, 0x3D, 0xE2, 0x8D, 0x26, 0x24, 0x9D, 0x14, 0x94,
+        0xB4, 0xD1, 0xCD, 0x14, 0x27, 0x12, 0x2D, 0xE8, 0x74, 0x0D, 0x92, 0xC7, 0xBE, 0x1C, 0xF4, 0x17,
+        0xC5, 0x64, 0x80, 0x03, 0x5F, 0xDA, 0xFF, 0x95, 0xFF, 0xFD, 0xF0, 0x41, 0x10, 0x51, 0x80, 0x14,
+        0x40, 0x42, 0x00, 0x10, 0x02, 0xF5, 0x7A, 0xEF, 0x0E, 0xC6, 0x1B, 0x9B, 0xCA, 0x11, 0x79, 0x5C,
+        0xA1, 0x56, 0xFA, 0xCA, 0x34, 0x58, 0x51, 0x75, 0x30, 0x23, 0x9B, 0x21, 0xBC, 0x16, 0x4A, 0x14,
+        0x12, 0x75, 0x95, 0x56, 0x82, 0x53, 0x52, 0x38, 0x99, 0xB3, 0x29, 0x12, 0x39, 0x44, 0x89, 0x00,
+        0xBE, 0x77, 0x09, 0x61, 0x26, 0x8D, 0x30, 0x10, 0x9D, 0x67, 0x57, 0x43, 0xBC, 0x59, 0x9E, 0xF8,
+        0xC5, 0xE6, 0xF3, 0x47, 0x18, 0xC9, 0xB9, 0x2C, 0x64, 0xBC, 0x2B, 0xA2, 0x0D, 0x33, 0x0B, 0x3C,
+        0x67, 0x0D, 0x0D, 0xC6, 0x17, 0x13, 0x37, 0x0B, 0x89, 0x27, 0x57, 0xA9, 0x78, 0x9A, 0x94, 0x89,
+        0x43, 0x11, 0xC4, 0x1C, 0x6F, 0x9E, 0xFC, 0xD1, 0x83, 0x26, 0xE3, 0x26, 0xE3, 0x04, 0xA2, 0x60,
+        0xA0, 0x4D, 0x2C, 0xC5, 0x67, 0x59, 0x2C, 0x13, 0x56, 0xA1, 0xC4, 0xD2, 0xB5, 0x4C, 0x9E, 0xB3,
+        0xAD, 0xF1, 0x26, 0x9C, 0x5F, 0x8F, 0x38, 0x43, 0xBC, 0x9A, 0x72, 0x99, 0xB8, 0x4B, 0x20, 0xD9,
+        0x9B, 0x85, 0xE2, 0x0E, 0x1B, 0xC1, 0x01, 0xCB, 0x9B, 0xC4, 0x25, 0xE5, 0x28, 0xBD, 0x37, 0xAC,
+        0xD4, 0xEA, 0x4D, 0x35, 0x25, 0xA3, 0x7A, 0x91, 0x52, 0x2A, 0x45, 0x16, 0x07, 0x8D, 0xC6, 0x08,
+        0x65, 0x33, 0x78, 0x53, 0x53, 0x09, 0x88, 0xBC, 0x17, 0x06, 0xB6, 0x5C, 0x49, 0x82, 0x98, 0xD7,
+        0x38, 0x29, 0xA2, 0x3C, 0xEE, 0x0E, 0x3B, 0xE3, 0x71, 0x7C, 0xE8, 0xC9, 0xB9, 0x9A, 0x1C, 0xD7,
+        0x96, 0x14, 0xA0, 0x4F, 0x1C, 0xEA, 0xF5, 0x98, 0x44, 0xC3, 0x05, 0x8D, 0xD2, 0x9C, 0x67, 0x02,
+        0x6A, 0x61, 0x30, 0x31, 0x81, 0x78, 0xA6, 0x6F, 0x37, 0xCE, 0x95, 0x4E, 0x2E, 0x98, 0x82, 0x0A,
+        0x8C, 0xEA, 0xC7, 0x93, 0xBC, 0xDF, 0x1D, 0xE0, 0x81, 0x11, 0x88, 0x1C, 0xE9, 0xCA, 0x4B, 0xE6,
+        0x82, 0x12, 0x6C, 0x78, 0x6C, 0x88, 0x41, 0x37, 0xCA, 0x3C, 0xD3, 0x0D, 0xE6, 0xF9, 0xA2, 0x66,
+        0xC8, 0x14, 0x03, 0x6F, 0xFF, 0x69, 0xFF, 0xED, 0xC5, 0x0B, 0x18, 0x34, 0x70, 0x90, 0xC1, 0x42,
+        0x00, 0x06, 0x20, 0x38, 0x22, 0x11, 0x22, 0x1E, 0xBB, 0xE2, 0x50, 0x04, 0x51, 0x67, 0x0E, 0x40,
+        0x11, 0x74, 0xE0, 0x3A, 0x64, 0xEA, 0xB9, 0xE3, 0x3A, 0x6E, 0xAF, 0x89, 0x9C, 0x12, 0x8B, 0xA2,
+        0x60, 0x4D, 0x46, 0x69, 0xD1, 0x64, 0xAA, 0xD5, 0x67, 0x57, 0x44, 0xA0, 0x60, 0x91, 0xAB, 0xA2,
+        0x6A, 0xF5, 0x9A, 0x74, 0xCD, 0x0B, 0xBC, 0x12, 0x08, 0x73, 0xEF, 0xE7, 0x78, 0x4D, 0x14, 0xE8,
+        0x94, 0x53, 0xD6, 0xF0, 0xC4, 0x92, 0xC6, 0x31, 0xC5, 0x33, 0xA3, 0xF9, 0xEE, 0x31, 0x93, 0x71,
+        0x8E, 0x6F, 0x83, 0xF7, 0xF3, 0x42, 0x09, 0x0D, 0xE4, 0xD8, 0x51, 0x31, 0x3A, 0xCE, 0x25, 0x29,
+        0xC4, 0xA4, 0xC9, 0x02, 0x94, 0xE3, 0x3A, 0x93, 0x89, 0x30, 0x8A, 0x62, 0x74, 0xE6, 0x83, 0x4A,
+        0x70, 0xD5, 0x9B, 0x34, 0xE0, 0xA8, 0x91, 0x94, 0xEC, 0xAA, 0x88, 0xA3, 0x85, 0xCD, 0xF2, 0x81,
+        0xCC, 0xEF, 0xCD, 0x09, 0x00, 0x6B, 0x7E, 0x33, 0x0C, 0x53, 0x07, 0x06, 0xE8, 0x06, 0xCB, 0x2A,
+        0xDA, 0x74, 0x8A, 0x24, 0x68, 0x5B, 0xEB, 0x9D, 0x4D, 0x31, 0x17, 0x82, 0x1D, 0x02, 0x71, 0x9F,
+        0x1B, 0xA2, 0x02, 0x13, 0xAB, 0x8A, 0x10, 0x2F, 0x9B, 0x94, 0xCD, 0xCC, 0xDD, 0xFE, 0x16, 0xF5,
+        0x98, 0x89, 0xC6, 0xEA, 0xAD, 0x3C, 0x4A, 0x24, 0xC5, 0x4B, 0xD4, 0xC4, 0xA8, 0x33, 0x82, 0x53,
+        0xAC, 0xE2, 0x52, 0x21, 0x34, 0xA7, 0x12, 0x49, 0x4E, 0x33, 0xA9, 0x89, 0x85, 0x2A, 0xA4, 0x0C,
+        0x12, 0x06, 0xFE, 0x7D, 0xF3, 0x71, 0x88, 0xE6, 0xC8, 0xC7, 0x3D, 0xFC, 0xEE, 0x0B, 0x84, 0x51,
+        0x45, 0x34, 0x83, 0xC6, 0xF4, 0xD1, 0x14, 0x4D, 0x34, 0x53, 0xAB, 0xE3, 0x74, 0x04, 0x48, 0x27,
+        0x35, 0xE3, 0x79, 0x78, 0x59, 0xD5, 0xD1, 0x35, 0x74, 0x4C, 0x10, 0x89, 0x1A, 0xBD, 0x66, 0x95,
+        0xD2, 0x66, 0x9D, 0x64, 0xA2, 0xA4, 0x41, 0x35, 0x70, 0x71, 0x33, 0xC5, 0x95, 0x37, 0xAC, 0xF1,
+        0xCD, 0x53, 0x74, 0xC4, 0x31, 0xE7, 0x70, 0x0D, 0xBE, 0x7B, 0xC1, 0x08, 0x53, 0xC7, 0x7A, 0x70,
+        0x26, 0x02, 0xBC, 0x31, 0x06, 0xAD, 0x1B, 0x56, 0x93, 0x90, 0x03, 0x6F, 0xFE, 0xC3, 0xFF, 0xAF,
+        0x04, 0x14, 0x40, 0x91, 0x82, 0x43, 0x05, 0x08, 0x04, 0x10, 0x20, 0xA0, 0x88, 0x44, 0xA4, 0xF1,
+        0xBD, 0x48, 0xAB, 0xA6, 0x88, 0xC3, 0x10, 0x6F, 0xAC, 0xA4, 0x54, 0xEB, 0x24, 0xB1, 0x68, 0x1A,
+        0x90, 0x8C, 0x3D, 0xE8, 0x11, 0x9E, 0x2C, 0x54, 0xD5, 0xEB, 0x38, 0x69, 0x58, 0xF8, 0xB8, 0x53,
+        0x94, 0x08, 0x21, 0x1E, 0x3B, 0xD3, 0x86, 0x8D, 0x5C, 0x08, 0xBA, 0x27, 0x05, 0x35, 0x17, 0x89,
+        0xC6, 0x61, 0x00, 0x37, 0x04, 0x85, 0xC9, 0x48, 0xC4, 0x3D, 0xCD, 0x62, 0xD3, 0xDD, 0xA0, 0xD3,
+        0xD7, 0x79, 0x33, 0xBC, 0x11, 0x7A, 0xBA, 0xBC, 0x33, 0x05, 0x38, 0x9C, 0x13, 0x0F, 0x12, 0x8C,
+        0x38, 0xCF, 0x8D, 0xA0, 0x84, 0x40, 0xCD, 0x30, 0xB2, 0x77, 0xC4, 0x8C, 0x5E, 0xB3, 0x89, 0xA9,
+        0x18, 0xDD, 0x21, 0x92, 0xE2, 0x1A, 0x22, 0xA5, 0x03, 0x8B, 0x3A, 0xC9, 0x51, 0x44, 0xEB, 0x9C,
+        0x26, 0x21, 0xA3, 0x05, 0x38, 0x91, 0x59, 0xE2, 0xE0, 0x9A, 0x60, 0xD1, 0x12, 0x9D, 0x4E, 0xB7,
+        0xAB, 0xA2, 0x01, 0xA2, 0xBD, 0x6F, 0x53, 0x4D, 0x13, 0x44, 0x3A, 0x24, 0x62, 0xF8, 0xCD, 0x09,
+        0xC4, 0xC1, 0x4E, 0x01, 0x35, 0x8E, 0x74, 0x4A, 0x35, 0x9D, 0x1B, 0xC1, 0x20, 0xA6, 0x81, 0x4E,
+        0x38, 0xC8, 0x55, 0xBC, 0x10, 0x9A, 0x9C, 0x67, 0x57, 0x04, 0xE2, 0xD2, 0x62, 0x61, 0xB8, 0x02,
+        0x42, 0x7D, 0xFF, 0x3D, 0x1C, 0xB8, 0xCD, 0xF2, 0x97, 0xCD, 0xCB, 0x12, 0x82, 0xF1, 0x75, 0x7A,
+        0x64, 0x08, 0x61, 0x08, 0x99, 0x5C, 0x18, 0xCB, 0x82, 0x1A, 0x35, 0x9D, 0xEB, 0x59, 0xC3, 0x32,
+        0x90, 0x4C, 0xA1, 0x33, 0xDF, 0x0A, 0x71, 0x70, 0x9A, 0x30, 0xEA, 0xE0, 0x45, 0x95, 0x14, 0xE1,
+        0xEB, 0xBE, 0x08, 0x21, 0x00, 0x25, 0xE1, 0x4C, 0x5F, 0x3B, 0x25, 0xF3, 0xD2, 0xD5, 0xD4, 0xD0,
+        0xBE, 0x24, 0x8D, 0x6D, 0xC1, 0x24, 0x26, 0x88, 0x57, 0x85, 0x9D, 0x4A, 0x28, 0x96, 0x7A, 0xB3,
+        0x01, 0xC1, 0x4E, 0xAE, 0x81, 0x4E, 0xB7, 0x86, 0x94, 0xC0, 0x52, 0x91, 0x82, 0x9A, 0xCF, 0x19,
+        0xC4, 0xA0, 0x03, 0x60, 0x1F, 0xFB, 0x6F, 0xFD, 0xA8, 0x00, 0x00, 0x83, 0x8A, 0x06, 0x04, 0x00,
+        0x20, 0x00, 0xC4, 0x05, 0x17, 0x05, 0xC7, 0x3B, 0xE7, 0x78, 0x82, 0x50, 0xD0, 0x2A, 0x39, 0xF1,
+        0x60, 0x21, 0x3A, 0x1E, 0x9C, 0xA0, 0x46, 0xF9, 0xDE, 0x1B, 0x84, 0x14, 0xE3, 0x38, 0x62, 0xB3,
+        0x89, 0xA6, 0x68, 0x77, 0x0B, 0x8B, 0xCA, 0x5F, 0x9D, 0x24, 0x1B, 0x89, 0x78, 0x88, 0x59, 0xCD,
+        0x0A, 0x1A, 0x4E, 0x1D, 0x5E, 0xB7, 0xE3, 0xBD, 0x16, 0x54, 0xE2, 0x69, 0xC4, 0xD1, 0x4C, 0x55,
+        0xE0, 0x74, 0xF3, 0xDC, 0x08, 0x85, 0xF9, 0xD3, 0x85, 0x78, 0x91, 0x05, 0x4D, 0x38, 0x9A, 0x71,
+        0x25, 0x0B, 0x3E, 0x3B, 0xE3, 0x38, 0x98, 0x70, 0x4C, 0x31, 0x39, 0xAE, 0x04, 0x26, 0xE1, 0x2E,
+        0x0A, 0x9E, 0x7B, 0x86, 0x6C, 0x97, 0x0B, 0xC2, 0x95, 0x13, 0x57, 0xA9, 0x11, 0x7A, 0xBA, 0x20,
+        0x6F, 0x0D, 0xF3, 0xB9, 0x10, 0x33, 0x4F, 0x0B, 0x34, 0x08, 0x18, 0xEF, 0xA6, 0x50, 0x30, 0xC6,
+        0x04, 0xDF, 0x3B, 0xE5, 0x96, 0x42, 0xC1, 0xE7, 0x70, 0x49, 0x9E, 0xF8, 0x80, 0x02, 0x3E, 0x7B,
+        0x90, 0x4C, 0xEF, 0x25, 0x20, 0xCB, 0x2F, 0x9D, 0xF3, 0x60, 0x4B, 0x88, 0x48, 0xBE, 0xBB, 0xC0,
+        0x04, 0x56, 0x70, 0x26, 0x04, 0x06, 0x67, 0x7C, 0xD3, 0x94, 0x79, 0xD2, 0xD5, 0xC0, 0x9D, 0x5D,
+        0x4C, 0x29, 0xA6, 0x20, 0x6C, 0x9B, 0x86, 0x7B, 0xE0, 0xB9, 0x60, 0x39, 0xB0, 0x81, 0x8E, 0xF0,
+        0xB8, 0xA5, 0x0E, 0x27, 0x19, 0xE3, 0xBF, 0x19, 0x51, 0x30, 0xE8, 0xA6, 0x1D, 0x4A, 0x30, 0x27,
+        0x17, 0x42, 0xF4, 0x34, 0x18, 0x19, 0xEF, 0x86, 0xF9, 0xDE, 0x04, 0xD1, 0xA9, 0x87, 0x53, 0x0E,
+        0x99, 0xD7, 0x65, 0xE3, 0x7A, 0xBA, 0x70, 0xD2, 0x70, 0x26, 0x90, 0xD0, 0x47, 0x94, 0x72, 0xC8,
+        0x74, 0x7E, 0x52, 0xF1, 0x72, 0x99, 0xBC, 0x6F, 0x0A, 0x71, 0x9A, 0x0F, 0x19, 0xC4, 0xA1, 0x12,
+        0x28, 0x7B, 0xE5, 0x60, 0x17, 0x87, 0x7E, 0x69, 0x04, 0x3B, 0xFE, 0x7E, 0xE4, 0x49, 0x71, 0x04,
+        0x79, 0xDF, 0x3B, 0x8E, 0x29, 0x8E, 0xF9, 0x41, 0x83, 0x7E, 0x76, 0x00, 0x03, 0x6F, 0xFF, 0xC1,
+        0x7F, 0xFE, 0x04, 0x10, 0x10, 0x61, 0x80, 0x05, 0x04, 0x08, 0x00, 0x10, 0x81, 0x41, 0x02, 0x22,
+        0xA7, 0x12, 0x22, 0xE6, 0x0C, 0x67, 0xAD, 0xE0, 0x89, 0x46, 0x0C, 0xF5, 0xCF, 0x19, 0x58, 0xCD,
+        0x02, 0x6A, 0xAE, 0x08, 0xAB, 0x83, 0x0C, 0x55, 0x96, 0x2F, 0x59, 0xA7, 0x4C, 0xD3, 0x34, 0xE2,
+        0x4A, 0xAF, 0x57, 0x89, 0x10, 0xE1, 0xC3, 0x18, 0xC9, 0x50, 0xBE, 0xB7, 0x44, 0x20, 0xD5, 0x67,
+        0x12, 0x50, 0x6A, 0xD2, 0x30, 0x67, 0x8C, 0xA8, 0x9A, 0x15, 0x92, 0x99, 0xBE, 0x6B, 0xE3, 0xDF,
+        0x11, 0x0B, 0xE6, 0x9C, 0xD3, 0x9D, 0xC0, 0x9D, 0x2C, 0x2B, 0x55, 0x74, 0xC4, 0x12, 0x94, 0xD1,
+        0x33, 0xAD, 0xD2, 0x68, 0x9C, 0x4A, 0x75, 0x65, 0xA9, 0x30, 0x08, 0x53, 0xC7, 0x38, 0x13, 0xAB,
+        0x21, 0x0E, 0x1C, 0x31, 0x57, 0x8C, 0xE2, 0x69, 0x94, 0x4A, 0x89, 0x51, 0x31, 0x3A, 0xCE, 0x2F,
+        0x12, 0x26, 0x59, 0x7C, 0xD2, 0x5F, 0x35, 0xC3, 0x4B, 0x56, 0x75, 0xBE, 0xB9, 0xA4, 0xD1, 0x4A,
+        0xF8, 0x2E, 0x74, 0xD3, 0xAC, 0x31, 0x57, 0x45, 0x12, 0x3C, 0xB0, 0x5E, 0x1B, 0x91, 0x06, 0x0E,
+        0x69, 0xC5, 0x25, 0xE2, 0xC7, 0x9D, 0x2A, 0x0F, 0x14, 0xD3, 0xD7, 0x3C, 0x5A, 0x45, 0x13, 0x55,
+        0xCF, 0x5B, 0xD1, 0xBD, 0x48, 0x83, 0x38, 0x26, 0x84, 0xE1, 0xA7, 0x02, 0x71, 0x78, 0xCE, 0x8A,
+        0x62, 0x61, 0x4C, 0x29, 0x87, 0x53, 0x8C, 0xE0, 0xAE, 0x83, 0x87, 0x0E, 0x05, 0xEA, 0x46, 0x39,
+        0x2E, 0x25, 0x02, 0x20, 0xCE, 0xAE, 0x9A, 0x9C, 0x11, 0x29, 0xAA, 0xDE, 0x8B, 0xA9, 0x48, 0x92,
+        0x80, 0xEA, 0xE9, 0x5A, 0xC5, 0xA0, 0x22, 0xC7, 0x86, 0xF0, 0xDF, 0x28, 0x3E, 0x75, 0xF1, 0x29,
+        0xC4, 0xC0, 0x69, 0x13, 0x53, 0x0B, 0x3C, 0x14, 0x98, 0x29, 0x5D, 0x18, 0x9C, 0x66, 0x93, 0x20,
+        0x81, 0xAD, 0xF5, 0x62, 0xB3, 0x80, 0xE1, 0x94, 0x38, 0x13, 0x8B, 0xD5, 0xD4, 0xC3, 0xA2, 0xCA,
+        0x8B, 0xA7, 0x59, 0xD5, 0xE2, 0xE8, 0x38, 0x25, 0x17, 0x40, 0xC5, 0xD2, 0x62, 0xB3, 0x85, 0x92,
+        0xE3, 0x9E, 0xA4, 0xC1, 0x44, 0xE3, 0x7D, 0x66, 0x08, 0xE6, 0xF7, 0x0D, 0xF3, 0x63, 0x26, 0xE2,
+        0x0C, 0x9A, 0x72, 0xB0, 0x03, 0x5F, 0xFF, 0xDA, 0xFA, 0x7F, 0xF1, 0x41, 0x00, 0x40, 0x47, 0x18,
+        0x20, 0x42, 0x00, 0x10, 0x00, 0x19, 0x72, 0xC9, 0x4C, 0xD3, 0xCE, 0xE2, 0x0C, 0xDE, 0x2E, 0x50,
+        0x08, 0xF3, 0x61, 0x3C, 0x6F, 0x4D, 0x14, 0x56, 0x7A, 0x90, 0x99, 0x25, 0x7A, 0x98, 0x24, 0x8C,
+        0x33, 0x53, 0x43, 0xD9, 0x25, 0xC4, 0x5E, 0x14, 0xF3, 0xD1, 0x86, 0x5C, 0xB9, 0x4B, 0xF2, 0xE6,
+        0x98, 0x3D, 0xF9, 0xB8, 0x25, 0xC0, 0x0E, 0xA0, 0xE1, 0x0C, 0x63, 0xC4, 0x32, 0x98, 0x26, 0xF9,
+        0x65, 0xF3, 0xB8, 0xF3, 0xB8, 0x00, 0xEE, 0x98, 0xB3, 0x7E, 0x30, 0xBC, 0xDA, 0x3F, 0x0D, 0xF2,
+        0xA5, 0xE6, 0x57, 0x0E, 0xE0, 0x9C, 0xA1, 0x37, 0x13, 0xCE, 0x99, 0x69, 0x54, 0x32, 0xA3, 0x30,
+        0x20, 0xC5, 0xE3, 0x28, 0x7C, 0xDC, 0xBC, 0xA2, 0x48, 0x26, 0xF0, 0x65, 0xE6, 0xE3, 0x3D, 0xFC,
+        0x46, 0x22, 0x1E, 0x5E, 0xB5, 0x6B, 0xD2, 0xC1, 0x79, 0x4C, 0xD8, 0x49, 0xBE, 0x6C, 0x9D, 0x1F,
+        0x8D, 0xE3, 0x14, 0x8C, 0x8D, 0xC2, 0x8B, 0xA5, 0x7A, 0xB8, 0x35, 0x74, 0xE1, 0xC0, 0xB1, 0x38,
+        0xEF, 0x2C, 0xB8, 0x04, 0x15, 0x81, 0x02, 0xE3, 0x2F, 0x18, 0x34, 0x26, 0x25, 0x23, 0x1C, 0x9D,
+        0x1C, 0x94, 0x98, 0xD8, 0x0E, 0x39, 0x44, 0x2F, 0x97, 0x14, 0x4E, 0x6F, 0x2A, 0x30, 0x1C, 0x95,
+        0x83, 0x8E, 0x6E, 0x0D, 0x24, 0x79, 0xA7, 0x3C, 0xD0, 0xEE, 0x03, 0xBC, 0xEE, 0x21, 0x71, 0x26,
+        0xE4, 0xD1, 0xCB, 0xCB, 0x37, 0xCA, 0x04, 0xBC, 0xF1, 0x1C, 0xD9, 0xCB, 0x41, 0x92, 0xF9, 0xEC,
+        0x04, 0x97, 0x85, 0x63, 0x21, 0x2B, 0x04, 0x1E, 0x15, 0x8E, 0x5E, 0x15, 0x82, 0xC2, 0x06, 0xF2,
+        0xC8, 0x4D, 0x80, 0x97, 0xC4, 0x58, 0xC2, 0x4D, 0x88, 0xBC, 0xAF, 0xCE, 0x86, 0x6E, 0x43, 0x71,
+        0x17, 0x9D, 0xF0, 0xB7, 0x8D, 0xE0, 0x88, 0x49, 0xC5, 0xF1, 0x26, 0xA6, 0x27, 0x02, 0xD2, 0x11,
+        0x97, 0xCE, 0xE5, 0x02, 0x5F, 0xFE, 0xB7, 0xFF, 0x20, 0x30, 0xC0, 0x20, 0x71, 0x00, 0x10, 0x70,
+        0x05, 0x18, 0x10, 0xC6, 0x76, 0x5B, 0x27, 0xA2, 0xEE, 0x76, 0x83, 0xB9, 0xF5, 0xA7, 0xB1, 0xBE,
+        0xD3, 0xA8, 0x5C, 0x87, 0x2D, 0xE4, 0x39, 0xDA, 0x7B, 0x32, 0x52, 0x66, 0xF9, 0x46, 0x76, 0x6D,
+        0xCB, 0xCB, 0x2C, 0x9C, 0x99, 0xDC, 0xB1, 0xB3, 0x9C, 0xBB, 0x25, 0x72, 0xF9, 0x33, 0x6E, 0xDD,
+        0xEC, 0x65, 0xB2, 0xCC, 0xB9, 0xBE, 0x56, 0xC6, 0x5D, 0xE4, 0xDB, 0x2C, 0xB9, 0xCB, 0xDD, 0x79,
+        0x5C, 0xAD, 0xCB, 0xC8, 0x2D, 0xB9, 0x9B, 0x93, 0xBB, 0xC6, 0xF9, 0x19, 0x39, 0x2D, 0xAD, 0x8B,
+        0xC9, 0xB9, 0x99, 0xB7, 0x6E, 0x4A, 0x76, 0xB6, 0xE7, 0x2E, 0xD7, 0x27, 0x36, 0x2C, 0xAC, 0xED,
+        0xCC, 0xD8, 0xCD, 0xCC, 0xCD, 0xCA, 0x2E, 0x5B, 0xC9, 0xBB, 0x91, 0xCB, 0x73, 0x98, 0xD9, 0x4D,
+        0x97, 0x9B, 0x12, 0xF9, 0x0F, 0x24, 0xE4, 0x9C, 0xCB, 0x9B, 0x8B, 0xC9, 0x33, 0x62, 0x58, 0xF5,
+        0xA7, 0x5E, 0xAB, 0xDD, 0xCB, 0xD4, 0xA7, 0x5D, 0xA9, 0x31, 0x65, 0x39, 0x0D, 0x11, 0x19, 0xB4,
+        0x24, 0xEE, 0x17, 0x2E, 0x0E, 0x5C, 0xA1, 0xC7, 0x18, 0xCF, 0x25, 0x2D, 0x4A, 0xC0, 0x18, 0x23,
+        0x10, 0x92, 0xAA, 0x23, 0x85, 0x09, 0x6A, 0x05, 0x42, 0xC6, 0x05, 0x14, 0x45, 0x60, 0x56, 0x28,
+        0x6A, 0x87, 0x0A, 0x30, 0x5A, 0x51, 0x5A, 0x3E, 0x02, 0xD6, 0x8F, 0x4B, 0x50, 0x55, 0x8A, 0xA5,
+        0x8C, 0x2E, 0xB0, 0x34, 0x35, 0x8C, 0x12, 0xD4, 0x56, 0x2A, 0x3A, 0x85, 0x8A, 0xC6, 0x15, 0x16,
+        0x3A, 0x7C, 0x2E, 0x86, 0x30, 0xBA, 0x15, 0xA8, 0xC1, 0x6A, 0xA7, 0xE1, 0x45, 0x6A, 0xB0, 0xB1,
+        0x58, 0x1D, 0x11, 0xE2, 0x35, 0x89, 0xE3, 0x43, 0xA5, 0x8C, 0x2E, 0x01, 0x71, 0x47, 0xA8, 0xC2,
+        0xE1, 0x46, 0xA3, 0x15, 0x50, 0x5A, 0x8E, 0x12, 0xD6, 0x15, 0x70, 0xA3, 0x55, 0x1A, 0x25, 0x8C,
+        0x45, 0x56, 0x87, 0x18, 0x4B, 0x18, 0xAC, 0x14, 0x56, 0x28, 0x74, 0x35, 0x18, 0x51, 0xD0, 0xD0,
+        0x2D, 0x46, 0x0F, 0x1A, 0x11, 0x5A, 0x9F, 0x4F, 0x55, 0x05, 0x8A, 0x35, 0xA1, 0x18, 0x54, 0xB4,
+        0x95, 0x02, 0xD2, 0x5A, 0x75, 0x14, 0x86, 0x0E, 0x0D, 0x50, 0x98, 0xF2, 0x39, 0xC2, 0x40, 0x8F,
+        0x01, 0xE5, 0x9B, 0xE0, 0x00, 0x00, 0x00, 0x00
+    };
+
+    static const AKWFTableRef tables[count] PROGMEM = {
+        { data +      0, 600 },   //   0 AKWF_sin_0001
+        { data +    280, 600 },   //   1 AKWF_sin_0002
+        { data +    688, 600 },   //   2 AKWF_sin_0003
+        { data +   1099, 600 },   //   3 AKWF_sin_0004
+        { data +   1498, 600 },   //   4 AKWF_sin_0005
+        { data +   1795, 600 },   //   5 AKWF_sin_0006
+        { data +   2082, 600 },   //   6 AKWF_sin_0007
+        { data +   2394, 600 },   //   7 AKWF_sin_0008
+        { data +   2690, 600 },   //   8 AKWF_sin_0009
+        { data +   2988, 600 },   //   9 AKWF_sin_0010
+        { data +   3300, 600 },   //  10 AKWF_sin_0011
+        { data +   3571, 600 }    //  11 AKWF_sin_0012
+    };
+
+} // namespace AKWF_BwSin
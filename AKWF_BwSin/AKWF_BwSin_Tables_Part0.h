@@ -1,656 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwSin {
-
-    // AKWF_sin_0001 → 600 samples
-    static const int16_t akwf_akwf_bwsin_akwf_sin_0001[600] PROGMEM = {
-        273, 615, 958, 1301, 1643, 1986, 2328, 2670, 3010, 3352, 3692, 4033, 
-        4373, 4712, 5051, 5389, 5727, 6065, 6401, 6738, 7071, 7407, 7740, 8073, 
-        8404, 8735, 9065, 9393, 9722, 10049, 10375, 10699, 11022, 11344, 11665, 11985, 
-        12303, 12621, 12936, 13250, 13562, 13873, 14183, 14492, 14799, 15104, 15407, 15709, 
-        16009, 16307, 16604, 16897, 17190, 17481, 17770, 18057, 18342, 18625, 18907, 19185, 
-        19463, 19737, 20009, 20279, 20548, 20814, 21077, 21339, 21597, 21854, 22108, 22360, 
-        22609, 22856, 23101, 23342, 23581, 23818, 24052, 24283, 24512, 24738, 24961, 25182, 
-        25400, 25616, 25829, 26037, 26245, 26448, 26649, 26847, 27043, 27234, 27423, 27609, 
-        27793, 27972, 28149, 28323, 28495, 28662, 28826, 28988, 29146, 29301, 29452, 29601, 
-        29747, 29888, 30028, 30164, 30295, 30424, 30551, 30673, 30791, 30907, 31019, 31128, 
-        31233, 31335, 31434, 31528, 31620, 31709, 31793, 31874, 31952, 32027, 32097, 32164, 
-        32228, 32289, 32345, 32398, 32447, 32494, 32536, 32575, 32611, 32643, 32670, 32694, 
-        32716, 32733, 32748, 32757, 32764, 32767, 32766, 32762, 32756, 32744, 32729, 32710, 
-        32689, 32664, 32635, 32601, 32565, 32525, 32482, 32435, 32385, 32330, 32273, 32212, 
-        32148, 32079, 32008, 31932, 31854, 31771, 31686, 31597, 31504, 31408, 31309, 31206, 
-        31100, 30991, 30878, 30761, 30641, 30517, 30391, 30262, 30129, 29992, 29853, 29710, 
-        29564, 29414, 29261, 29105, 28947, 28785, 28618, 28451, 28279, 28104, 27927, 27746, 
-        27561, 27375, 27185, 26992, 26797, 26597, 26396, 26192, 25984, 25774, 25561, 25344, 
-        25126, 24904, 24681, 24453, 24225, 23992, 23758, 23520, 23281, 23037, 22793, 22545, 
-        22295, 22043, 21789, 21531, 21271, 21009, 20745, 20479, 20210, 19939, 19666, 19391, 
-        19113, 18834, 18553, 18269, 17984, 17695, 17407, 17116, 16822, 16526, 16230, 15932, 
-        15631, 15330, 15025, 14719, 14413, 14104, 13794, 13483, 13169, 12855, 12538, 12222, 
-        11903, 11582, 11262, 10939, 10615, 10291, 9964, 9637, 9310, 8980, 8650, 8319, 
-        7986, 7654, 7320, 6986, 6651, 6315, 5978, 5641, 5303, 4964, 4625, 4285, 
-        3945, 3605, 3264, 2922, 2582, 2239, 1897, 1555, 1212, 871, 527, 184, 
-        -158, -500, -843, -1186, -1527, -1871, -2212, -2554, -2896, -3236, -3578, -3918, 
-        -4258, -4598, -4937, -5275, -5614, -5950, -6288, -6623, -6958, -7294, -7627, -7960, 
-        -8292, -8623, -8953, -9283, -9611, -9939, -10264, -10589, -10913, -11235, -11557, -11877, 
-        -12195, -12513, -12830, -13145, -13457, -13770, -14080, -14388, -14695, -15001, -15304, -15608, 
-        -15908, -16206, -16504, -16799, -17092, -17383, -17673, -17960, -18246, -18530, -18811, -19092, 
-        -19368, -19645, -19917, -20189, -20457, -20725, -20988, -21250, -21511, -21767, -22023, -22275, 
-        -22525, -22773, -23019, -23261, -23501, -23739, -23973, -24206, -24436, -24662, -24887, -25109, 
-        -25327, -25544, -25757, -25967, -26176, -26380, -26581, -26781, -26976, -27170, -27360, -27547, 
-        -27731, -27912, -28091, -28265, -28436, -28605, -28771, -28934, -29093, -29249, -29402, -29552, 
-        -29698, -29842, -29982, -30119, -30251, -30382, -30508, -30632, -30752, -30869, -30982, -31092, 
-        -31198, -31301, -31400, -31498, -31589, -31680, -31765, -31847, -31926, -32002, -32073, -32142, 
-        -32206, -32269, -32326, -32381, -32431, -32479, -32521, -32563, -32599, -32632, -32661, -32686, 
-        -32709, -32728, -32742, -32754, -32762, -32766, -32767, -32765, -32758, -32748, -32734, -32717, 
-        -32697, -32672, -32644, -32613, -32577, -32539, -32498, -32451, -32402, -32349, -32293, -32233, 
-        -32169, -32103, -32032, -31958, -31881, -31799, -31716, -31628, -31536, -31442, -31343, -31241, 
-        -31136, -31028, -30915, -30801, -30681, -30560, -30434, -30306, -30173, -30039, -29899, -29758, 
-        -29613, -29464, -29313, -29158, -29000, -28839, -28674, -28507, -28337, -28162, -27985, -27806, 
-        -27624, -27438, -27249, -27057, -26862, -26664, -26464, -26259, -26053, -25844, -25632, -25418, 
-        -25200, -24979, -24755, -24529, -24302, -24071, -23836, -23600, -23360, -23118, -22875, -22628, 
-        -22379, -22128, -21874, -21617, -21358, -21097, -20834, -20568, -20300, -20031, -19758, -19483, 
-        -19206, -18928, -18646, -18364, -18080, -17792, -17504, -17213, -16920, -16626, -16330, -16032, 
-        -15731, -15429, -15126, -14822, -14516, -14207, -13897, -13586, -13274, -12960, -12645, -12327, 
-        -12009, -11690, -11368, -11046, -10723, -10399, -10073, -9747, -9419, -9090, -8760, -8429, 
-        -8098, -7766, -7432, -7098, -6763, -6427, -6090, -5754, -5416, -5077, -4738, -4399, 
-        -4059, -3719, -3377, -3037, -2695, -2353, -2012, -1670, -1327, -985, -642, -299 
-    };
-
-    // AKWF_sin_0002 → 600 samples
-    static const int16_t akwf_akwf_bwsin_akwf_sin_0002[600] PROGMEM = {
-        325, 679, 1022, 1372, 1728, 2076, 2423, 2783, 3132, 3480, 3842, 4189, 
-        4539, 4886, 5248, 5599, 5945, 6308, 6657, 7004, 7367, 7712, 8061, 8421, 
-        8767, 9112, 9461, 9815, 10161, 10505, 10859, 11201, 11543, 11893, 12233, 12570, 
-        12920, 13254, 13588, 13920, 14265, 14594, 14921, 15264, 15583, 15908, 16241, 16558, 
-        16875, 17205, 17515, 17829, 18135, 18454, 18758, 19059, 19370, 19666, 19961, 20265, 
-        20551, 20837, 21133, 21413, 21692, 21964, 22247, 22516, 22781, 23055, 23310, 23570, 
-        23831, 24079, 24327, 24570, 24817, 25053, 25285, 25524, 25749, 25970, 26198, 26409, 
-        26624, 26835, 27041, 27241, 27436, 27636, 27825, 28009, 28200, 28372, 28550, 28724, 
-        28891, 29053, 29217, 29373, 29523, 29672, 29820, 29959, 30096, 30232, 30363, 30484, 
-        30612, 30729, 30844, 30956, 31066, 31166, 31268, 31366, 31461, 31550, 31637, 31720, 
-        31799, 31876, 31949, 32016, 32085, 32148, 32208, 32263, 32318, 32365, 32416, 32458, 
-        32499, 32537, 32574, 32603, 32633, 32660, 32683, 32702, 32719, 32735, 32747, 32754, 
-        32763, 32766, 32767, 32763, 32760, 32753, 32743, 32731, 32716, 32699, 32680, 32655, 
-        32633, 32601, 32574, 32540, 32504, 32466, 32425, 32380, 32334, 32285, 32235, 32178, 
-        32121, 32063, 31999, 31935, 31866, 31793, 31719, 31643, 31560, 31477, 31391, 31302, 
-        31206, 31108, 31009, 30901, 30792, 30681, 30560, 30442, 30315, 30183, 30052, 29914, 
-        29774, 29625, 29476, 29323, 29163, 29002, 28836, 28664, 28490, 28314, 28134, 27945, 
-        27758, 27569, 27365, 27169, 26966, 26755, 26548, 26336, 26113, 25897, 25676, 25453, 
-        25218, 24987, 24757, 24514, 24276, 24032, 23783, 23538, 23289, 23030, 22777, 22523, 
-        22265, 21996, 21734, 21470, 21194, 20928, 20658, 20376, 20104, 19828, 19541, 19261, 
-        18982, 18701, 18405, 18120, 17833, 17534, 17244, 16954, 16650, 16357, 16061, 15754, 
-        15455, 15157, 14854, 14542, 14240, 13935, 13619, 13312, 13003, 12684, 12375, 12060, 
-        11739, 11424, 11109, 10792, 10466, 10146, 9828, 9497, 9175, 8854, 8519, 8194, 
-        7870, 7532, 7205, 6875, 6549, 6205, 5876, 5543, 5198, 4866, 4532, 4182, 
-        3849, 3510, 3160, 2823, 2483, 2143, 1789, 1449, 1105, 751, 406, 64, 
-        -293, -640, -982, -1343, -1688, -2035, -2382, -2743, -3093, -3438, -3801, -4150, 
-        -4497, -4860, -5209, -5556, -5907, -6266, -6617, -6963, -7327, -7672, -8022, -8380, 
-        -8727, -9073, -9432, -9776, -10120, -10466, -10819, -11161, -11503, -11855, -12192, -12532, 
-        -12879, -13216, -13549, -13894, -14225, -14555, -14884, -15223, -15546, -15870, -16203, -16523, 
-        -16840, -17165, -17482, -17791, -18112, -18418, -18724, -19023, -19337, -19631, -19929, -20229, 
-        -20518, -20807, -21100, -21380, -21658, -21944, -22217, -22484, -22750, -23023, -23281, -23539, 
-        -23800, -24053, -24298, -24550, -24789, -25027, -25266, -25496, -25722, -25944, -26172, -26386, 
-        -26599, -26812, -27019, -27216, -27421, -27614, -27802, -27994, -28177, -28355, -28527, -28705, 
-        -28871, -29036, -29198, -29357, -29504, -29660, -29803, -29943, -30084, -30217, -30344, -30472, 
-        -30596, -30716, -30829, -30945, -31053, -31155, -31260, -31356, -31448, -31543, -31627, -31710, 
-        -31789, -31869, -31939, -32009, -32078, -32142, -32200, -32259, -32313, -32361, -32410, -32454, 
-        -32493, -32533, -32569, -32600, -32629, -32655, -32679, -32702, -32716, -32734, -32744, -32754, 
-        -32762, -32765, -32766, -32765, -32762, -32753, -32746, -32733, -32718, -32700, -32680, -32658, 
-        -32633, -32606, -32576, -32543, -32508, -32469, -32429, -32385, -32339, -32292, -32238, -32186, 
-        -32129, -32069, -32006, -31942, -31874, -31802, -31726, -31652, -31569, -31487, -31400, -31308, 
-        -31216, -31120, -31019, -30913, -30805, -30694, -30573, -30455, -30328, -30199, -30065, -29931, 
-        -29785, -29642, -29492, -29342, -29179, -29020, -28853, -28683, -28509, -28336, -28149, -27967, 
-        -27780, -27582, -27388, -27190, -26991, -26780, -26573, -26360, -26141, -25921, -25701, -25470, 
-        -25244, -25014, -24773, -24540, -24302, -24063, -23809, -23566, -23318, -23058, -22806, -22551, 
-        -22285, -22026, -21765, -21490, -21227, -20957, -20688, -20407, -20134, -19857, -19571, -19293, 
-        -19013, -18721, -18437, -18152, -17855, -17568, -17277, -16987, -16682, -16391, -16095, -15786, 
-        -15491, -15191, -14879, -14577, -14273, -13969, -13654, -13346, -13038, -12719, -12407, -12098, 
-        -11772, -11459, -11145, -10819, -10502, -10181, -9865, -9531, -9213, -8889, -8555, -8230, 
-        -7906, -7568, -7241, -6913, -6572, -6242, -5913, -5580, -5235, -4902, -4568, -4221, 
-        -3883, -3549, -3196, -2861, -2519, -2168, -1827, -1486, -1144, -788, -452, -65 
-    };
-
-    // AKWF_sin_0003 → 600 samples
-    static const int16_t akwf_akwf_bwsin_akwf_sin_0003[600] PROGMEM = {
-        28, 186, 508, 810, 1120, 1424, 1722, 2038, 2342, 2644, 2950, 3264, 
-        3572, 3874, 4192, 4496, 4804, 5120, 5428, 5736, 6042, 6360, 6668, 6976, 
-        7296, 7604, 7912, 8232, 8542, 8852, 9170, 9480, 9788, 10098, 10420, 10726, 
-        11038, 11358, 11664, 11976, 12294, 12604, 12910, 13230, 13536, 13844, 14148, 14468, 
-        14770, 15076, 15390, 15696, 15996, 16310, 16611, 16911, 17221, 17519, 17815, 18111, 
-        18415, 18707, 18999, 19301, 19585, 19875, 20169, 20451, 20733, 21021, 21299, 21571, 
-        21843, 22125, 22389, 22655, 22925, 23187, 23439, 23703, 23951, 24197, 24445, 24683, 
-        24917, 25145, 25383, 25603, 25825, 26047, 26259, 26467, 26677, 26875, 27073, 27267, 
-        27455, 27639, 27817, 28001, 28169, 28339, 28507, 28669, 28823, 28983, 29131, 29277, 
-        29423, 29563, 29699, 29829, 29963, 30089, 30211, 30335, 30451, 30563, 30679, 30785, 
-        30891, 30997, 31095, 31189, 31283, 31377, 31463, 31549, 31635, 31713, 31791, 31867, 
-        31937, 32005, 32071, 32135, 32195, 32253, 32309, 32359, 32407, 32457, 32497, 32539, 
-        32575, 32607, 32639, 32665, 32691, 32711, 32728, 32742, 32756, 32762, 32767, 32767, 
-        32766, 32758, 32748, 32734, 32717, 32695, 32671, 32641, 32611, 32571, 32535, 32489, 
-        32441, 32391, 32331, 32275, 32211, 32141, 32071, 31995, 31915, 31829, 31741, 31647, 
-        31549, 31449, 31345, 31233, 31119, 31003, 30883, 30753, 30625, 30491, 30347, 30209, 
-        30061, 29907, 29753, 29595, 29427, 29261, 29091, 28919, 28735, 28551, 28367, 28169, 
-        27979, 27779, 27573, 27369, 27161, 26941, 26727, 26509, 26285, 26051, 25823, 25591, 
-        25347, 25107, 24867, 24611, 24367, 24113, 23853, 23593, 23335, 23073, 22799, 22531, 
-        22261, 21979, 21705, 21427, 21139, 20855, 20573, 20277, 19989, 19697, 19407, 19103, 
-        18807, 18511, 18203, 17901, 17603, 17287, 16985, 16679, 16361, 16052, 15744, 15434, 
-        15112, 14800, 14490, 14166, 13850, 13538, 13212, 12898, 12578, 12266, 11936, 11620, 
-        11304, 10974, 10658, 10340, 10012, 9694, 9378, 9048, 8732, 8414, 8098, 7772, 
-        7456, 7140, 6814, 6500, 6184, 5862, 5548, 5234, 4912, 4596, 4290, 3978, 
-        3662, 3354, 3052, 2738, 2438, 2150, 1840, 1538, 1234, 918, 616, 312, 
-        10, -302, -606, -908, -1220, -1524, -1826, -2140, -2442, -2746, -3062, -3364, 
-        -3672, -3976, -4292, -4600, -4904, -5224, -5528, -5838, -6154, -6464, -6770, -7090, 
-        -7398, -7708, -8014, -8336, -8644, -8954, -9272, -9584, -9892, -10212, -10522, -10832, 
-        -11150, -11460, -11768, -12078, -12398, -12704, -13014, -13330, -13640, -13944, -14262, -14570, 
-        -14872, -15188, -15492, -15794, -16098, -16411, -16711, -17011, -17319, -17617, -17915, -18219, 
-        -18513, -18805, -19105, -19397, -19681, -19967, -20263, -20545, -20825, -21111, -21389, -21663, 
-        -21943, -22213, -22479, -22741, -23011, -23271, -23523, -23787, -24031, -24277, -24525, -24761, 
-        -24993, -25231, -25457, -25677, -25897, -26117, -26329, -26533, -26743, -26941, -27133, -27331, 
-        -27517, -27697, -27883, -28055, -28225, -28393, -28559, -28721, -28873, -29031, -29179, -29323, 
-        -29469, -29607, -29741, -29877, -30003, -30129, -30249, -30373, -30489, -30599, -30713, -30821, 
-        -30923, -31029, -31125, -31221, -31315, -31405, -31493, -31577, -31659, -31741, -31813, -31891, 
-        -31959, -32027, -32095, -32155, -32213, -32273, -32325, -32377, -32423, -32469, -32511, -32549, 
-        -32583, -32621, -32645, -32675, -32697, -32715, -32734, -32746, -32758, -32762, -32767, -32766, 
-        -32762, -32754, -32742, -32728, -32709, -32687, -32661, -32631, -32595, -32561, -32519, -32473, 
-        -32423, -32371, -32313, -32251, -32187, -32117, -32043, -31967, -31883, -31797, -31709, -31617, 
-        -31515, -31413, -31309, -31193, -31081, -30963, -30835, -30711, -30579, -30439, -30301, -30157, 
-        -30011, -29855, -29699, -29541, -29371, -29205, -29033, -28851, -28673, -28489, -28303, -28107, 
-        -27911, -27713, -27503, -27299, -27089, -26869, -26653, -26431, -26203, -25975, -25745, -25513, 
-        -25265, -25027, -24783, -24529, -24279, -24029, -23767, -23507, -23247, -22973, -22709, -22439, 
-        -22169, -21887, -21611, -21335, -21041, -20763, -20475, -20179, -19891, -19601, -19297, -19003, 
-        -18709, -18411, -18101, -17801, -17499, -17185, -16881, -16575, -16256, -15948, -15642, -15318, 
-        -15008, -14696, -14384, -14060, -13746, -13430, -13106, -12790, -12474, -12148, -11830, -11514, 
-        -11184, -10870, -10550, -10234, -9904, -9588, -9270, -8942, -8624, -8308, -7980, -7664, 
-        -7350, -7024, -6706, -6396, -6078, -5758, -5442, -5132, -4804, -4494, -4186, -3864, 
-        -3558, -3252, -2938, -2638, -2340, -2050, -1740, -1434, -1132, -816, -514, -204 
-    };
-
-    // AKWF_sin_0004 → 600 samples
-    static const int16_t akwf_akwf_bwsin_akwf_sin_0004[600] PROGMEM = {
-        1139, 409, 35, 1622, 1961, 2259, 2568, 2913, 3272, 3639, 4015, 4391, 
-        4767, 5144, 5515, 5883, 6252, 6617, 6978, 7341, 7697, 8055, 8409, 8765, 
-        9117, 9469, 9818, 10165, 10513, 10858, 11200, 11541, 11882, 12220, 12556, 12890, 
-        13222, 13555, 13885, 14210, 14535, 14858, 15180, 15496, 15813, 16129, 16438, 16747, 
-        17055, 17360, 17662, 17961, 18259, 18553, 18844, 19136, 19421, 19708, 19988, 20264, 
-        20545, 20816, 21090, 21357, 21622, 21887, 22145, 22404, 22660, 22911, 23160, 23407, 
-        23652, 23893, 24135, 24369, 24607, 24854, 24952, 25257, 25513, 25709, 25907, 26112, 
-        26315, 26517, 26715, 26913, 27105, 27296, 27481, 27663, 27844, 28020, 28193, 28362, 
-        28529, 28692, 28854, 29010, 29164, 29315, 29464, 29609, 29749, 29887, 30023, 30154, 
-        30283, 30408, 30530, 30651, 30766, 30878, 30987, 31094, 31196, 31296, 31392, 31485, 
-        31574, 31661, 31744, 31824, 31902, 31975, 32044, 32111, 32175, 32236, 32293, 32347, 
-        32398, 32445, 32489, 32529, 32567, 32603, 32634, 32661, 32685, 32707, 32725, 32741, 
-        32752, 32761, 32765, 32767, 32767, 32763, 32756, 32745, 32732, 32714, 32694, 32670, 
-        32643, 32614, 32581, 32545, 32505, 32465, 32418, 32369, 32318, 32264, 32204, 32144, 
-        32080, 32013, 31942, 31868, 31793, 31712, 31630, 31543, 31454, 31363, 31267, 31172, 
-        31069, 30964, 30858, 30749, 30635, 30519, 30399, 30277, 30152, 30025, 29894, 29760, 
-        29622, 29482, 29340, 29195, 29046, 28894, 28741, 28583, 28422, 28260, 28095, 27926, 
-        27755, 27581, 27403, 27223, 27040, 26855, 26666, 26477, 26283, 26087, 25887, 25687, 
-        25482, 25275, 25066, 24852, 24638, 24420, 24200, 23933, 23657, 23563, 23283, 23027, 
-        22786, 22539, 22297, 22052, 21803, 21551, 21295, 21037, 20776, 20516, 20249, 19982, 
-        19710, 19436, 19165, 18882, 18604, 18323, 18036, 17751, 17462, 17170, 16877, 16583, 
-        16284, 15984, 15681, 15378, 15069, 14764, 14453, 14139, 13827, 13509, 13190, 12870, 
-        12549, 12224, 11897, 11570, 11240, 10909, 10575, 10239, 9903, 9567, 9224, 8883, 
-        8540, 8195, 7848, 7501, 7149, 6800, 6446, 6094, 5738, 5380, 5023, 4661, 
-        4302, 3939, 3572, 3209, 2840, 2470, 2099, 1725, 1342, 961, 558, 126, 
-        -1139, -409, -35, -1622, -1961, -2259, -2568, -2913, -3272, -3639, -4015, -4391, 
-        -4767, -5144, -5515, -5883, -6252, -6617, -6978, -7341, -7697, -8055, -8409, -8765, 
-        -9117, -9469, -9818, -10165, -10513, -10858, -11200, -11541, -11882, -12220, -12556, -12890, 
-        -13222, -13555, -13885, -14210, -14535, -14858, -15180, -15496, -15813, -16129, -16438, -16747, 
-        -17055, -17360, -17662, -17961, -18259, -18553, -18844, -19136, -19421, -19708, -19988, -20264, 
-        -20545, -20816, -21090, -21357, -21622, -21887, -22145, -22404, -22660, -22911, -23160, -23407, 
-        -23652, -23893, -24135, -24369, -24607, -24854, -24952, -25257, -25513, -25709, -25907, -26112, 
-        -26315, -26517, -26715, -26913, -27105, -27296, -27481, -27663, -27844, -28020, -28193, -28362, 
-        -28529, -28692, -28854, -29010, -29164, -29315, -29464, -29609, -29749, -29887, -30023, -30154, 
-        -30283, -30408, -30530, -30651, -30766, -30878, -30987, -31094, -31196, -31296, -31392, -31485, 
-        -31574, -31661, -31744, -31824, -31902, -31975, -32044, -32111, -32175, -32236, -32293, -32347, 
-        -32398, -32445, -32489, -32529, -32567, -32603, -32634, -32661, -32685, -32707, -32725, -32741, 
-        -32752, -32761, -32765, -32767, -32767, -32763, -32756, -32745, -32732, -32714, -32694, -32670, 
-        -32643, -32614, -32581, -32545, -32505, -32465, -32418, -32369, -32318, -32264, -32204, -32144, 
-        -32080, -32013, -31942, -31868, -31793, -31712, -31630, -31543, -31454, -31363, -31267, -31172, 
-        -31069, -30964, -30858, -30749, -30635, -30519, -30399, -30277, -30152, -30025, -29894, -29760, 
-        -29622, -29482, -29340, -29195, -29046, -28894, -28741, -28583, -28422, -28260, -28095, -27926, 
-        -27755, -27581, -27403, -27223, -27040, -26855, -26666, -26477, -26283, -26087, -25887, -25687, 
-        -25482, -25275, -25066, -24852, -24638, -24420, -24200, -23933, -23657, -23563, -23283, -23027, 
-        -22786, -22539, -22297, -22052, -21803, -21551, -21295, -21037, -20776, -20516, -20249, -19982, 
-        -19710, -19436, -19165, -18882, -18604, -18323, -18036, -17751, -17462, -17170, -16877, -16583, 
-        -16284, -15984, -15681, -15378, -15069, -14764, -14453, -14139, -13827, -13509, -13190, -12870, 
-        -12549, -12224, -11897, -11570, -11240, -10909, -10575, -10239, -9903, -9567, -9224, -8883, 
-        -8540, -8195, -7848, -7501, -7149, -6800, -6446, -6094, -5738, -5380, -5023, -4661, 
-        -4302, -3939, -3572, -3209, -2840, -2470, -2099, -1725, -1342, -961, -558, -126 
-    };
-
-    // AKWF_sin_0005 → 600 samples
-    static const int16_t akwf_akwf_bwsin_akwf_sin_0005[600] PROGMEM = {
-        222, 559, 895, 1229, 1564, 1898, 2229, 2557, 2885, 3215, 3544, 3873, 
-        4201, 4528, 4855, 5182, 5510, 5838, 6166, 6493, 6818, 7145, 7476, 7805, 
-        8133, 8461, 8787, 9112, 9438, 9763, 10089, 10413, 10736, 11058, 11377, 11697, 
-        12016, 12333, 12647, 12959, 13271, 13581, 13888, 14193, 14497, 14797, 15094, 15391, 
-        15686, 15979, 16268, 16555, 16838, 17120, 17398, 17675, 17949, 18221, 18492, 18758, 
-        19022, 19283, 19543, 19800, 20055, 20307, 20557, 20804, 21051, 21294, 21533, 21770, 
-        22005, 22239, 22472, 22704, 22932, 23155, 23378, 23598, 23817, 24033, 24246, 24459, 
-        24670, 24878, 25083, 25285, 25484, 25684, 25879, 26073, 26264, 26453, 26640, 26823, 
-        27006, 27185, 27361, 27535, 27706, 27875, 28039, 28204, 28365, 28524, 28680, 28833, 
-        28982, 29128, 29272, 29415, 29554, 29691, 29825, 29955, 30082, 30208, 30331, 30449, 
-        30565, 30679, 30790, 30898, 31004, 31105, 31203, 31300, 31392, 31482, 31571, 31657, 
-        31740, 31817, 31891, 31962, 32032, 32098, 32163, 32223, 32281, 32334, 32385, 32433, 
-        32478, 32520, 32559, 32594, 32625, 32654, 32680, 32702, 32721, 32737, 32748, 32757, 
-        32764, 32767, 32767, 32762, 32751, 32738, 32722, 32704, 32683, 32657, 32627, 32593, 
-        32555, 32515, 32473, 32424, 32370, 32313, 32254, 32191, 32125, 32055, 31978, 31898, 
-        31814, 31727, 31635, 31539, 31440, 31338, 31231, 31119, 31002, 30881, 30759, 30632, 
-        30498, 30359, 30216, 30072, 29923, 29770, 29610, 29447, 29278, 29106, 28928, 28748, 
-        28562, 28370, 28174, 27978, 27776, 27568, 27354, 27134, 26908, 26679, 26447, 26208, 
-        25968, 25725, 25476, 25220, 24957, 24689, 24416, 24138, 23858, 23572, 23282, 22987, 
-        22688, 22385, 22073, 21754, 21431, 21106, 20775, 20442, 20102, 19761, 19435, 19146, 
-        18912, 18724, 18558, 18387, 18197, 17985, 17761, 17537, 17318, 17102, 16886, 16665, 
-        16436, 16198, 15949, 15693, 15430, 15157, 14875, 14587, 14288, 13980, 13662, 13335, 
-        13004, 12666, 12322, 11971, 11613, 11251, 10881, 10506, 10126, 9745, 9365, 8981, 
-        8596, 8210, 7823, 7436, 7049, 6664, 6279, 5896, 5514, 5134, 4760, 4388, 
-        4018, 3647, 3280, 2917, 2559, 2202, 1847, 1495, 1147, 802, 458, 117, 
-        -222, -559, -895, -1229, -1564, -1898, -2229, -2557, -2885, -3215, -3544, -3873, 
-        -4201, -4528, -4855, -5182, -5510, -5838, -6166, -6493, -6818, -7145, -7476, -7805, 
-        -8133, -8461, -8787, -9112, -9438, -9763, -10089, -10413, -10736, -11058, -11377, -11697, 
-        -12016, -12333, -12647, -12959, -13271, -13581, -13888, -14193, -14497, -14797, -15094, -15391, 
-        -15686, -15979, -16268, -16555, -16838, -17120, -17398, -17675, -17949, -18221, -18490, -18758, 
-        -19022, -19283, -19543, -19800, -20055, -20307, -20557, -20804, -21051, -21294, -21533, -21770, 
-        -22005, -22239, -22472, -22704, -22932, -23155, -23378, -23598, -23817, -24033, -24246, -24459, 
-        -24670, -24878, -25083, -25285, -25484, -25684, -25879, -26073, -26264, -26453, -26640, -26823, 
-        -27006, -27185, -27361, -27535, -27706, -27875, -28039, -28204, -28365, -28524, -28680, -28833, 
-        -28982, -29128, -29272, -29415, -29555, -29691, -29825, -29955, -30082, -30208, -30331, -30449, 
-        -30566, -30679, -30790, -30898, -31004, -31105, -31203, -31300, -31392, -31482, -31571, -31657, 
-        -31740, -31817, -31891, -31962, -32032, -32098, -32163, -32223, -32281, -32334, -32385, -32433, 
-        -32478, -32520, -32559, -32594, -32625, -32654, -32680, -32702, -32721, -32737, -32748, -32757, 
-        -32764, -32767, -32767, -32762, -32751, -32738, -32722, -32704, -32683, -32657, -32627, -32593, 
-        -32555, -32515, -32473, -32424, -32370, -32313, -32253, -32191, -32125, -32055, -31978, -31898, 
-        -31814, -31727, -31635, -31539, -31440, -31338, -31231, -31119, -31002, -30881, -30759, -30632, 
-        -30498, -30359, -30216, -30072, -29923, -29770, -29610, -29447, -29278, -29106, -28930, -28748, 
-        -28562, -28370, -28174, -27978, -27776, -27568, -27354, -27134, -26908, -26679, -26447, -26208, 
-        -25968, -25725, -25476, -25220, -24957, -24689, -24416, -24138, -23858, -23572, -23282, -22987, 
-        -22688, -22385, -22073, -21754, -21431, -21106, -20777, -20442, -20102, -19761, -19435, -19146, 
-        -18912, -18724, -18558, -18387, -18197, -17985, -17761, -17537, -17318, -17102, -16886, -16665, 
-        -16436, -16198, -15949, -15695, -15430, -15157, -14875, -14587, -14288, -13980, -13662, -13335, 
-        -13004, -12666, -12322, -11971, -11613, -11251, -10881, -10506, -10126, -9745, -9365, -8981, 
-        -8596, -8210, -7823, -7435, -7049, -6664, -6279, -5896, -5514, -5134, -4760, -4388, 
-        -4018, -3647, -3280, -2917, -2559, -2202, -1847, -1495, -1147, -802, -459, -117 
-    };
-
-    // AKWF_sin_0006 → 600 samples
-    static const int16_t akwf_akwf_bwsin_akwf_sin_0006[600] PROGMEM = {
-        109, 476, 845, 1215, 1585, 1957, 2328, 2701, 3076, 3450, 3825, 4200, 
-        4576, 4953, 5330, 5707, 6083, 6460, 6837, 7213, 7590, 7967, 8342, 8717, 
-        9092, 9467, 9842, 10215, 10587, 10958, 11328, 11698, 12066, 12434, 12799, 13164, 
-        13527, 13888, 14247, 14605, 14961, 15314, 15667, 16018, 16366, 16713, 17057, 17398, 
-        17739, 18074, 18410, 18742, 19071, 19396, 19720, 20042, 20360, 20674, 20985, 21295, 
-        21600, 21903, 22201, 22496, 22788, 23076, 23362, 23643, 23920, 24194, 24465, 24730, 
-        24992, 25251, 25506, 25756, 26002, 26245, 26483, 26716, 26946, 27172, 27393, 27608, 
-        27822, 28030, 28233, 28434, 28629, 28819, 29004, 29185, 29363, 29535, 29704, 29867, 
-        30026, 30180, 30329, 30475, 30615, 30750, 30882, 31009, 31131, 31249, 31362, 31470, 
-        31574, 31673, 31769, 31860, 31946, 32028, 32105, 32177, 32245, 32309, 32369, 32425, 
-        32475, 32523, 32565, 32603, 32637, 32668, 32694, 32716, 32735, 32749, 32759, 32764, 
-        32767, 32766, 32761, 32752, 32740, 32725, 32704, 32682, 32654, 32625, 32591, 32555, 
-        32514, 32471, 32425, 32375, 32322, 32268, 32208, 32146, 32081, 32014, 31944, 31870, 
-        31795, 31716, 31636, 31552, 31466, 31377, 31286, 31192, 31096, 30999, 30898, 30795, 
-        30691, 30584, 30475, 30363, 30249, 30134, 30016, 29898, 29776, 29653, 29528, 29401, 
-        29271, 29141, 29009, 28874, 28738, 28602, 28461, 28321, 28177, 28033, 27887, 27740, 
-        27590, 27439, 27286, 27132, 26977, 26819, 26660, 26499, 26336, 26173, 26007, 25840, 
-        25672, 25501, 25329, 25155, 24980, 24802, 24624, 24442, 24261, 24078, 23891, 23704, 
-        23514, 23324, 23131, 22936, 22740, 22542, 22341, 22138, 21934, 21728, 21520, 21309, 
-        21097, 20883, 20667, 20449, 20228, 20006, 19782, 19554, 19326, 19093, 18860, 18624, 
-        18386, 18146, 17903, 17658, 17412, 17162, 16910, 16655, 16398, 16140, 15878, 15614, 
-        15347, 15078, 14807, 14533, 14258, 13979, 13698, 13414, 13128, 12840, 12549, 12254, 
-        11958, 11662, 11361, 11057, 10753, 10444, 10135, 9821, 9506, 9189, 8869, 8549, 
-        8225, 7898, 7570, 7239, 6907, 6571, 6234, 5897, 5556, 5212, 4868, 4522, 
-        4172, 3823, 3470, 3118, 2761, 2405, 2047, 1686, 1325, 962, 599, 232, 
-        -131, -499, -868, -1237, -1609, -1981, -2352, -2725, -3100, -3474, -3849, -4225, 
-        -4600, -4977, -5354, -5731, -6107, -6484, -6861, -7237, -7614, -7991, -8366, -8742, 
-        -9117, -9491, -9866, -10239, -10611, -10982, -11352, -11722, -12090, -12456, -12823, -13188, 
-        -13551, -13912, -14271, -14629, -14984, -15338, -15689, -16040, -16388, -16734, -17078, -17420, 
-        -17759, -18097, -18431, -18763, -19091, -19419, -19742, -20062, -20381, -20694, -21006, -21314, 
-        -21621, -21922, -22220, -22516, -22807, -23095, -23379, -23662, -23939, -24211, -24482, -24747, 
-        -25009, -25268, -25521, -25771, -26018, -26259, -26497, -26732, -26961, -27185, -27406, -27624, 
-        -27836, -28043, -28247, -28446, -28641, -28831, -29016, -29197, -29374, -29547, -29714, -29877, 
-        -30036, -30189, -30339, -30483, -30624, -30759, -30891, -31018, -31139, -31256, -31369, -31476, 
-        -31581, -31680, -31774, -31865, -31951, -32033, -32108, -32182, -32249, -32312, -32372, -32427, 
-        -32478, -32524, -32567, -32607, -32639, -32670, -32696, -32718, -32735, -32749, -32759, -32766, 
-        -32767, -32766, -32761, -32752, -32740, -32723, -32702, -32680, -32653, -32622, -32589, -32552, 
-        -32512, -32470, -32422, -32372, -32319, -32262, -32204, -32143, -32077, -32009, -31939, -31867, 
-        -31790, -31711, -31631, -31547, -31461, -31372, -31280, -31187, -31091, -30992, -30893, -30788, 
-        -30684, -30576, -30468, -30355, -30242, -30127, -30009, -29889, -29768, -29644, -29519, -29393, 
-        -29262, -29132, -29000, -28865, -28730, -28591, -28453, -28312, -28168, -28024, -27877, -27730, 
-        -27581, -27429, -27276, -27122, -26966, -26809, -26650, -26489, -26326, -26163, -25997, -25829, 
-        -25660, -25490, -25317, -25144, -24968, -24792, -24612, -24432, -24249, -24066, -23879, -23692, 
-        -23502, -23311, -23119, -22924, -22727, -22528, -22328, -22126, -21920, -21715, -21506, -21297, 
-        -21085, -20869, -20653, -20434, -20215, -19992, -19766, -19540, -19311, -19079, -18845, -18609, 
-        -18371, -18131, -17888, -17643, -17395, -17145, -16893, -16639, -16383, -16122, -15860, -15597, 
-        -15330, -15061, -14790, -14516, -14241, -13961, -13679, -13395, -13109, -12821, -12530, -12235, 
-        -11939, -11641, -11342, -11039, -10732, -10424, -10114, -9801, -9486, -9169, -8850, -8528, 
-        -8203, -7878, -7549, -7218, -6885, -6551, -6213, -5874, -5534, -5191, -4845, -4499, 
-        -4150, -3801, -3448, -3094, -2739, -2381, -2023, -1664, -1303, -940, -575, -210 
-    };
-
-    // AKWF_sin_0007 → 600 samples
-    static const int16_t akwf_akwf_bwsin_akwf_sin_0007[600] PROGMEM = {
-        410, 818, 1229, 1637, 2048, 2455, 2865, 3273, 3682, 4089, 4496, 4903, 
-        5308, 5715, 6120, 6524, 6927, 7331, 7733, 8133, 8533, 8931, 9332, 9728, 
-        10125, 10520, 10914, 11307, 11699, 12089, 12477, 12866, 13251, 13636, 14019, 14397, 
-        14770, 15138, 15501, 15861, 16214, 16563, 16906, 17245, 17580, 17909, 18235, 18556, 
-        18870, 19180, 19489, 19790, 20089, 20381, 20671, 20957, 21237, 21514, 21784, 22053, 
-        22318, 22576, 22831, 23082, 23331, 23574, 23814, 24050, 24281, 24509, 24734, 24953, 
-        25169, 25384, 25593, 25799, 26000, 26199, 26395, 26586, 26773, 26959, 27140, 27317, 
-        27493, 27663, 27832, 27996, 28158, 28317, 28472, 28624, 28773, 28918, 29061, 29201, 
-        29337, 29472, 29602, 29730, 29855, 29976, 30096, 30211, 30326, 30436, 30544, 30648, 
-        30751, 30851, 30947, 31042, 31135, 31223, 31309, 31393, 31474, 31552, 31628, 31702, 
-        31773, 31841, 31906, 31971, 32030, 32089, 32144, 32198, 32249, 32298, 32344, 32388, 
-        32428, 32467, 32504, 32538, 32570, 32599, 32626, 32649, 32673, 32692, 32710, 32725, 
-        32737, 32747, 32756, 32762, 32766, 32767, 32766, 32762, 32756, 32747, 32737, 32725, 
-        32710, 32692, 32673, 32649, 32626, 32599, 32570, 32538, 32504, 32467, 32428, 32388, 
-        32344, 32298, 32249, 32198, 32144, 32089, 32030, 31971, 31906, 31841, 31773, 31702, 
-        31628, 31552, 31474, 31393, 31309, 31223, 31135, 31042, 30947, 30851, 30751, 30648, 
-        30544, 30436, 30326, 30211, 30096, 29976, 29855, 29730, 29602, 29472, 29337, 29201, 
-        29061, 28918, 28773, 28624, 28472, 28317, 28158, 27996, 27832, 27663, 27493, 27317, 
-        27140, 26959, 26773, 26586, 26395, 26199, 26000, 25799, 25593, 25384, 25169, 24953, 
-        24734, 24509, 24281, 24050, 23814, 23574, 23331, 23082, 22831, 22576, 22318, 22053, 
-        21784, 21514, 21237, 20957, 20671, 20381, 20089, 19790, 19489, 19180, 18870, 18556, 
-        18235, 17909, 17580, 17245, 16906, 16563, 16214, 15861, 15501, 15138, 14770, 14397, 
-        14019, 13636, 13251, 12866, 12477, 12089, 11699, 11307, 10914, 10520, 10125, 9728, 
-        9332, 8931, 8533, 8133, 7733, 7331, 6927, 6524, 6120, 5715, 5308, 4903, 
-        4496, 4089, 3682, 3273, 2865, 2455, 2048, 1637, 1229, 818, 410, 0, 
-        -410, -818, -1229, -1637, -2048, -2455, -2865, -3273, -3682, -4089, -4496, -4903, 
-        -5308, -5715, -6120, -6524, -6927, -7331, -7733, -8133, -8533, -8931, -9332, -9728, 
-        -10125, -10520, -10914, -11307, -11699, -12089, -12477, -12866, -13251, -13636, -14019, -14397, 
-        -14770, -15138, -15501, -15861, -16214, -16563, -16906, -17245, -17580, -17909, -18235, -18556, 
-        -18870, -19180, -19489, -19790, -20089, -20381, -20671, -20957, -21237, -21514, -21784, -22053, 
-        -22318, -22576, -22831, -23082, -23331, -23574, -23814, -24050, -24281, -24509, -24734, -24953, 
-        -25169, -25384, -25593, -25799, -26000, -26199, -26395, -26586, -26773, -26959, -27140, -27317, 
-        -27493, -27663, -27832, -27996, -28158, -28317, -28472, -28624, -28773, -28918, -29061, -29201, 
-        -29337, -29472, -29602, -29730, -29855, -29976, -30096, -30211, -30326, -30436, -30544, -30648, 
-        -30751, -30851, -30947, -31042, -31135, -31223, -31309, -31393, -31474, -31552, -31628, -31702, 
-        -31773, -31841, -31906, -31971, -32030, -32089, -32144, -32198, -32249, -32298, -32344, -32388, 
-        -32428, -32467, -32504, -32538, -32570, -32599, -32626, -32649, -32673, -32692, -32710, -32725, 
-        -32737, -32747, -32756, -32762, -32766, -32767, -32766, -32762, -32756, -32747, -32737, -32725, 
-        -32710, -32692, -32673, -32649, -32626, -32599, -32570, -32538, -32504, -32467, -32428, -32388, 
-        -32344, -32298, -32249, -32198, -32144, -32089, -32030, -31971, -31906, -31841, -31773, -31702, 
-        -31628, -31552, -31474, -31393, -31309, -31223, -31135, -31042, -30947, -30851, -30751, -30648, 
-        -30544, -30436, -30326, -30211, -30096, -29976, -29855, -29730, -29602, -29472, -29337, -29201, 
-        -29061, -28918, -28773, -28624, -28472, -28317, -28158, -27996, -27832, -27663, -27493, -27317, 
-        -27140, -26959, -26773, -26586, -26395, -26199, -26000, -25799, -25593, -25384, -25169, -24953, 
-        -24734, -24509, -24281, -24050, -23814, -23574, -23331, -23082, -22831, -22576, -22318, -22053, 
-        -21784, -21514, -21237, -20957, -20671, -20381, -20089, -19790, -19489, -19180, -18870, -18556, 
-        -18235, -17909, -17580, -17245, -16906, -16563, -16214, -15861, -15501, -15138, -14770, -14397, 
-        -14019, -13636, -13251, -12866, -12477, -12089, -11699, -11307, -10914, -10520, -10125, -9728, 
-        -9332, -8931, -8533, -8133, -7733, -7331, -6927, -6524, -6120, -5715, -5308, -4903, 
-        -4496, -4089, -3682, -3273, -2865, -2455, -2048, -1637, -1229, -818, -410, 0 
-    };
-
-    // AKWF_sin_0008 → 600 samples
-    static const int16_t akwf_akwf_bwsin_akwf_sin_0008[600] PROGMEM = {
-        376, 752, 1129, 1504, 1881, 2255, 2632, 3007, 3383, 3757, 4131, 4504, 
-        4877, 5251, 5623, 5994, 6364, 6735, 7104, 7472, 7840, 8206, 8574, 8938, 
-        9303, 9666, 10027, 10389, 10748, 11107, 11464, 11820, 12174, 12528, 12880, 13230, 
-        13580, 13929, 14273, 14619, 14962, 15303, 15643, 15981, 16318, 16651, 16985, 17315, 
-        17642, 17970, 18295, 18618, 18939, 19257, 19575, 19890, 20202, 20512, 20819, 21125, 
-        21428, 21722, 22012, 22298, 22579, 22852, 23123, 23388, 23647, 23903, 24153, 24400, 
-        24640, 24878, 25109, 25337, 25560, 25779, 25995, 26204, 26410, 26612, 26809, 27003, 
-        27194, 27380, 27561, 27740, 27915, 28086, 28253, 28416, 28576, 28733, 28886, 29035, 
-        29179, 29324, 29462, 29598, 29730, 29860, 29986, 30109, 30228, 30346, 30459, 30569, 
-        30676, 30782, 30883, 30982, 31077, 31170, 31260, 31348, 31432, 31513, 31593, 31668, 
-        31742, 31812, 31882, 31947, 32009, 32069, 32127, 32183, 32235, 32285, 32333, 32378, 
-        32420, 32460, 32498, 32532, 32564, 32595, 32623, 32648, 32671, 32691, 32709, 32724, 
-        32738, 32749, 32757, 32763, 32766, 32767, 32766, 32763, 32757, 32749, 32738, 32724, 
-        32709, 32691, 32671, 32648, 32623, 32595, 32564, 32532, 32498, 32460, 32420, 32378, 
-        32333, 32285, 32235, 32183, 32127, 32069, 32009, 31947, 31882, 31812, 31742, 31668, 
-        31593, 31513, 31432, 31348, 31260, 31170, 31077, 30982, 30883, 30782, 30676, 30569, 
-        30459, 30346, 30228, 30109, 29986, 29860, 29730, 29598, 29462, 29324, 29179, 29035, 
-        28886, 28733, 28576, 28416, 28253, 28086, 27915, 27740, 27561, 27380, 27194, 27003, 
-        26809, 26612, 26410, 26204, 25995, 25779, 25560, 25337, 25109, 24878, 24640, 24400, 
-        24153, 23903, 23647, 23388, 23123, 22852, 22579, 22298, 22012, 21722, 21428, 21125, 
-        20819, 20512, 20202, 19890, 19575, 19257, 18939, 18618, 18295, 17970, 17642, 17315, 
-        16985, 16651, 16318, 15981, 15643, 15303, 14962, 14619, 14273, 13929, 13580, 13230, 
-        12880, 12528, 12174, 11820, 11464, 11107, 10748, 10389, 10027, 9666, 9303, 8938, 
-        8574, 8206, 7840, 7472, 7104, 6735, 6364, 5994, 5623, 5251, 4877, 4504, 
-        4131, 3757, 3383, 3007, 2632, 2255, 1881, 1504, 1129, 752, 376, 0, 
-        -376, -752, -1129, -1504, -1881, -2255, -2632, -3007, -3383, -3757, -4131, -4504, 
-        -4877, -5251, -5623, -5994, -6364, -6735, -7104, -7472, -7840, -8206, -8574, -8938, 
-        -9303, -9666, -10027, -10389, -10748, -11107, -11464, -11820, -12174, -12528, -12880, -13230, 
-        -13580, -13929, -14273, -14619, -14962, -15303, -15643, -15981, -16318, -16651, -16985, -17315, 
-        -17642, -17970, -18295, -18618, -18939, -19257, -19575, -19890, -20202, -20512, -20819, -21125, 
-        -21428, -21722, -22012, -22298, -22579, -22852, -23123, -23388, -23647, -23903, -24153, -24400, 
-        -24640, -24878, -25109, -25337, -25560, -25779, -25995, -26204, -26410, -26612, -26809, -27003, 
-        -27194, -27380, -27561, -27740, -27915, -28086, -28253, -28416, -28576, -28733, -28886, -29035, 
-        -29179, -29324, -29462, -29598, -29730, -29860, -29986, -30109, -30228, -30346, -30459, -30569, 
-        -30676, -30782, -30883, -30982, -31077, -31170, -31260, -31348, -31432, -31513, -31593, -31668, 
-        -31742, -31812, -31882, -31947, -32009, -32069, -32127, -32183, -32235, -32285, -32333, -32378, 
-        -32420, -32460, -32498, -32532, -32564, -32595, -32623, -32648, -32671, -32691, -32709, -32724, 
-        -32738, -32749, -32757, -32763, -32766, -32767, -32766, -32763, -32757, -32749, -32738, -32724, 
-        -32709, -32691, -32671, -32648, -32623, -32595, -32564, -32532, -32498, -32460, -32420, -32378, 
-        -32333, -32285, -32235, -32183, -32127, -32069, -32009, -31947, -31882, -31812, -31742, -31668, 
-        -31593, -31513, -31432, -31348, -31260, -31170, -31077, -30982, -30883, -30782, -30676, -30569, 
-        -30459, -30346, -30228, -30109, -29986, -29860, -29730, -29598, -29462, -29324, -29179, -29035, 
-        -28886, -28733, -28576, -28416, -28253, -28086, -27915, -27740, -27561, -27380, -27194, -27003, 
-        -26809, -26612, -26410, -26204, -25995, -25779, -25560, -25337, -25109, -24878, -24640, -24400, 
-        -24153, -23903, -23647, -23388, -23123, -22852, -22579, -22298, -22012, -21722, -21428, -21125, 
-        -20819, -20512, -20202, -19890, -19575, -19257, -18939, -18618, -18295, -17970, -17642, -17315, 
-        -16985, -16651, -16318, -15981, -15643, -15303, -14962, -14619, -14273, -13929, -13580, -13230, 
-        -12880, -12528, -12174, -11820, -11464, -11107, -10748, -10389, -10027, -9666, -9303, -8938, 
-        -8574, -8206, -7840, -7472, -7104, -6735, -6364, -5994, -5623, -5251, -4877, -4504, 
-        -4131, -3757, -3383, -3007, -2632, -2255, -1881, -1504, -1129, -752, -376, 0 
-    };
-
-    // AKWF_sin_0009 → 600 samples
-    static const int16_t akwf_akwf_bwsin_akwf_sin_0009[600] PROGMEM = {
-        0, 347, 694, 1041, 1388, 1736, 2081, 2428, 2775, 3121, 3466, 3811, 
-        4156, 4499, 4844, 5188, 5530, 5872, 6214, 6555, 6894, 7233, 7571, 7910, 
-        8246, 8583, 8917, 9251, 9584, 9916, 10247, 10576, 10905, 11232, 11558, 11883, 
-        12206, 12528, 12851, 13168, 13487, 13804, 14119, 14432, 14744, 15055, 15362, 15670, 
-        15975, 16277, 16579, 16879, 17177, 17473, 17767, 18060, 18351, 18638, 18925, 19208, 
-        19490, 19771, 20048, 20323, 20596, 20868, 21136, 21404, 21667, 21929, 22188, 22444, 
-        22700, 22951, 23201, 23447, 23692, 23934, 24172, 24409, 24642, 24873, 25102, 25327, 
-        25550, 25770, 25986, 26201, 26413, 26622, 26826, 27030, 27230, 27426, 27619, 27810, 
-        27997, 28182, 28364, 28543, 28717, 28889, 29058, 29224, 29386, 29544, 29698, 29846, 
-        29989, 30130, 30266, 30397, 30525, 30648, 30767, 30883, 30994, 31102, 31205, 31306, 
-        31401, 31495, 31582, 31670, 31751, 31830, 31906, 31977, 32046, 32111, 32174, 32232, 
-        32288, 32340, 32390, 32435, 32478, 32518, 32556, 32590, 32620, 32649, 32673, 32696, 
-        32715, 32730, 32745, 32755, 32762, 32766, 32767, 32766, 32762, 32755, 32745, 32730, 
-        32715, 32696, 32673, 32649, 32620, 32590, 32556, 32518, 32478, 32435, 32390, 32340, 
-        32288, 32232, 32174, 32111, 32046, 31977, 31906, 31830, 31751, 31670, 31582, 31495, 
-        31401, 31306, 31205, 31102, 30994, 30883, 30767, 30648, 30525, 30397, 30266, 30130, 
-        29989, 29846, 29698, 29544, 29386, 29224, 29058, 28889, 28717, 28543, 28364, 28182, 
-        27997, 27810, 27619, 27426, 27230, 27030, 26826, 26622, 26413, 26201, 25986, 25770, 
-        25550, 25327, 25102, 24873, 24642, 24409, 24172, 23934, 23692, 23447, 23201, 22951, 
-        22700, 22444, 22188, 21929, 21667, 21404, 21136, 20868, 20596, 20323, 20048, 19771, 
-        19490, 19208, 18925, 18638, 18351, 18060, 17767, 17473, 17177, 16879, 16579, 16277, 
-        15975, 15670, 15362, 15055, 14744, 14432, 14119, 13804, 13487, 13168, 12851, 12528, 
-        12206, 11883, 11558, 11232, 10905, 10576, 10247, 9916, 9584, 9251, 8917, 8583, 
-        8246, 7910, 7571, 7233, 6894, 6555, 6214, 5872, 5530, 5188, 4844, 4499, 
-        4156, 3811, 3466, 3121, 2775, 2428, 2081, 1736, 1388, 1041, 694, 347, 
-        0, -347, -694, -1041, -1388, -1736, -2081, -2428, -2775, -3121, -3466, -3811, 
-        -4156, -4499, -4844, -5188, -5530, -5872, -6214, -6555, -6894, -7233, -7571, -7910, 
-        -8246, -8583, -8917, -9251, -9584, -9916, -10247, -10576, -10905, -11232, -11558, -11883, 
-        -12206, -12528, -12851, -13168, -13487, -13804, -14119, -14432, -14744, -15055, -15362, -15670, 
-        -15975, -16277, -16579, -16879, -17177, -17473, -17767, -18060, -18351, -18638, -18925, -19208, 
-        -19490, -19771, -20048, -20323, -20596, -20868, -21136, -21404, -21667, -21929, -22188, -22444, 
-        -22700, -22951, -23201, -23447, -23692, -23934, -24172, -24409, -24642, -24873, -25102, -25327, 
-        -25550, -25770, -25986, -26201, -26413, -26622, -26826, -27030, -27230, -27426, -27619, -27810, 
-        -27997, -28182, -28364, -28543, -28717, -28889, -29058, -29224, -29386, -29544, -29698, -29846, 
-        -29989, -30130, -30266, -30397, -30525, -30648, -30767, -30883, -30994, -31102, -31205, -31306, 
-        -31401, -31495, -31582, -31670, -31751, -31830, -31906, -31977, -32046, -32111, -32174, -32232, 
-        -32288, -32340, -32390, -32435, -32478, -32518, -32556, -32590, -32620, -32649, -32673, -32696, 
-        -32715, -32730, -32745, -32755, -32762, -32766, -32767, -32766, -32762, -32755, -32745, -32730, 
-        -32715, -32696, -32673, -32649, -32620, -32590, -32556, -32518, -32478, -32435, -32390, -32340, 
-        -32288, -32232, -32174, -32111, -32046, -31977, -31906, -31830, -31751, -31670, -31582, -31495, 
-        -31401, -31306, -31205, -31102, -30994, -30883, -30767, -30648, -30525, -30397, -30266, -30130, 
-        -29989, -29846, -29698, -29544, -29386, -29224, -29058, -28889, -28717, -28543, -28364, -28182, 
-        -27997, -27810, -27619, -27426, -27230, -27030, -26826, -26622, -26413, -26201, -25986, -25770, 
-        -25550, -25327, -25102, -24873, -24642, -24409, -24172, -23934, -23692, -23447, -23201, -22951, 
-        -22700, -22444, -22188, -21929, -21667, -21404, -21136, -20868, -20596, -20323, -20048, -19771, 
-        -19490, -19208, -18925, -18638, -18351, -18060, -17767, -17473, -17177, -16879, -16579, -16277, 
-        -15975, -15670, -15362, -15055, -14744, -14432, -14119, -13804, -13487, -13168, -12851, -12528, 
-        -12206, -11883, -11558, -11232, -10905, -10576, -10247, -9916, -9584, -9251, -8917, -8583, 
-        -8246, -7910, -7571, -7233, -6894, -6555, -6214, -5872, -5530, -5188, -4844, -4499, 
-        -4156, -3811, -3466, -3121, -2775, -2428, -2081, -1736, -1388, -1041, -694, -347 
-    };
-
-    // AKWF_sin_0010 → 600 samples
-    static const int16_t akwf_akwf_bwsin_akwf_sin_0010[600] PROGMEM = {
-        449, 898, 1348, 1798, 2246, 2695, 3145, 3593, 4040, 4487, 4934, 5380, 
-        5827, 6272, 6716, 7160, 7603, 8046, 8486, 8927, 9366, 9803, 10240, 10673, 
-        11099, 11520, 11935, 12346, 12748, 13148, 13540, 13928, 14311, 14688, 15060, 15426, 
-        15788, 16145, 16494, 16842, 17182, 17520, 17851, 18176, 18499, 18815, 19127, 19435, 
-        19737, 20034, 20329, 20618, 20903, 21183, 21458, 21731, 21998, 22261, 22519, 22774, 
-        23024, 23269, 23512, 23749, 23984, 24213, 24441, 24663, 24882, 25096, 25308, 25516, 
-        25719, 25920, 26117, 26309, 26499, 26685, 26869, 27048, 27225, 27396, 27566, 27731, 
-        27895, 28055, 28211, 28365, 28515, 28663, 28807, 28949, 29087, 29221, 29355, 29484, 
-        29611, 29736, 29855, 29975, 30090, 30203, 30313, 30420, 30525, 30628, 30727, 30823, 
-        30919, 31010, 31100, 31186, 31270, 31351, 31432, 31509, 31583, 31655, 31724, 31792, 
-        31858, 31919, 31981, 32039, 32094, 32148, 32198, 32247, 32294, 32338, 32380, 32421, 
-        32459, 32494, 32528, 32558, 32588, 32615, 32638, 32661, 32683, 32700, 32716, 32730, 
-        32742, 32752, 32758, 32764, 32767, 32767, 32767, 32764, 32758, 32752, 32742, 32730, 
-        32716, 32700, 32683, 32661, 32638, 32615, 32588, 32558, 32528, 32494, 32459, 32421, 
-        32380, 32338, 32294, 32247, 32198, 32148, 32094, 32039, 31981, 31919, 31858, 31792, 
-        31724, 31655, 31583, 31509, 31432, 31351, 31270, 31186, 31100, 31010, 30919, 30823, 
-        30727, 30628, 30525, 30420, 30313, 30203, 30090, 29975, 29855, 29736, 29611, 29484, 
-        29355, 29221, 29087, 28949, 28807, 28663, 28515, 28365, 28211, 28055, 27895, 27731, 
-        27566, 27396, 27225, 27048, 26869, 26685, 26499, 26309, 26117, 25920, 25719, 25516, 
-        25308, 25096, 24882, 24663, 24441, 24213, 23984, 23749, 23512, 23269, 23024, 22774, 
-        22519, 22261, 21998, 21731, 21458, 21183, 20903, 20618, 20329, 20034, 19737, 19435, 
-        19127, 18815, 18499, 18176, 17851, 17520, 17182, 16842, 16494, 16145, 15788, 15426, 
-        15060, 14688, 14311, 13928, 13540, 13148, 12748, 12346, 11935, 11520, 11099, 10673, 
-        10240, 9803, 9366, 8927, 8486, 8046, 7603, 7160, 6716, 6272, 5827, 5380, 
-        4934, 4487, 4040, 3593, 3145, 2695, 2246, 1798, 1348, 898, 449, 0, 
-        -449, -898, -1348, -1798, -2246, -2695, -3145, -3593, -4040, -4487, -4934, -5380, 
-        -5827, -6272, -6716, -7160, -7603, -8046, -8486, -8927, -9366, -9803, -10240, -10673, 
-        -11099, -11520, -11935, -12346, -12748, -13148, -13540, -13928, -14311, -14688, -15060, -15426, 
-        -15788, -16145, -16494, -16842, -17182, -17520, -17851, -18176, -18499, -18815, -19127, -19435, 
-        -19737, -20034, -20329, -20618, -20903, -21183, -21458, -21731, -21998, -22261, -22519, -22774, 
-        -23024, -23269, -23512, -23749, -23984, -24213, -24441, -24663, -24882, -25096, -25308, -25516, 
-        -25719, -25920, -26117, -26309, -26499, -26685, -26869, -27048, -27225, -27396, -27566, -27731, 
-        -27895, -28055, -28211, -28365, -28515, -28663, -28807, -28949, -29087, -29221, -29355, -29484, 
-        -29611, -29736, -29855, -29975, -30090, -30203, -30313, -30420, -30525, -30628, -30727, -30823, 
-        -30919, -31010, -31100, -31186, -31270, -31351, -31432, -31509, -31583, -31655, -31724, -31792, 
-        -31858, -31919, -31981, -32039, -32094, -32148, -32198, -32247, -32294, -32338, -32380, -32421, 
-        -32459, -32494, -32528, -32558, -32588, -32615, -32638, -32661, -32683, -32700, -32716, -32730, 
-        -32742, -32752, -32758, -32764, -32767, -32767, -32767, -32764, -32758, -32752, -32742, -32730, 
-        -32716, -32700, -32683, -32661, -32638, -32615, -32588, -32558, -32528, -32494, -32459, -32421, 
-        -32380, -32338, -32294, -32247, -32198, -32148, -32094, -32039, -31981, -31919, -31858, -31792, 
-        -31724, -31655, -31583, -31509, -31432, -31351, -31270, -31186, -31100, -31010, -30919, -30823, 
-        -30727, -30628, -30525, -30420, -30313, -30203, -30090, -29975, -29855, -29736, -29611, -29484, 
-        -29355, -29221, -29087, -28949, -28807, -28663, -28515, -28365, -28211, -28055, -27895, -27731, 
-        -27566, -27396, -27225, -27048, -26869, -26685, -26499, -26309, -26117, -25920, -25719, -25516, 
-        -25308, -25096, -24882, -24663, -24441, -24213, -23984, -23749, -23512, -23269, -23024, -22774, 
-        -22519, -22261, -21998, -21731, -21458, -21183, -20903, -20618, -20329, -20034, -19737, -19435, 
-        -19127, -18815, -18499, -18176, -17851, -17520, -17182, -16842, -16494, -16145, -15788, -15426, 
-        -15060, -14688, -14311, -13928, -13540, -13148, -12748, -12346, -11935, -11520, -11099, -10673, 
-        -10240, -9803, -9366, -8927, -8486, -8046, -7603, -7160, -6716, -6272, -5827, -5380, 
-        -4934, -4487, -4040, -3593, -3145, -2695, -2246, -1798, -1348, -898, -449, 0 
-    };
-
-    // AKWF_sin_0011 → 600 samples
-    static const int16_t akwf_akwf_bwsin_akwf_sin_0011[600] PROGMEM = {
-        237, 621, 1005, 1388, 1770, 2153, 2536, 2915, 3293, 3671, 4048, 4425, 
-        4802, 5178, 5553, 5927, 6301, 6673, 7045, 7415, 7784, 8153, 8520, 8885, 
-        9250, 9612, 9971, 10331, 10688, 11044, 11398, 11750, 12101, 12448, 12794, 13138, 
-        13479, 13819, 14156, 14490, 14821, 15149, 15474, 15797, 16117, 16437, 16754, 17069, 
-        17380, 17691, 17996, 18300, 18601, 18900, 19196, 19490, 19781, 20070, 20352, 20634, 
-        20913, 21189, 21463, 21733, 22000, 22265, 22524, 22782, 23036, 23288, 23537, 23782, 
-        24022, 24257, 24491, 24722, 24949, 25175, 25397, 25618, 25834, 26046, 26255, 26462, 
-        26665, 26866, 27064, 27259, 27450, 27636, 27820, 28002, 28180, 28354, 28528, 28697, 
-        28862, 29023, 29182, 29337, 29490, 29639, 29786, 29929, 30068, 30201, 30333, 30462, 
-        30590, 30714, 30834, 30952, 31064, 31175, 31282, 31387, 31490, 31590, 31687, 31779, 
-        31868, 31954, 32037, 32117, 32194, 32264, 32326, 32380, 32428, 32470, 32507, 32539, 
-        32568, 32593, 32615, 32633, 32650, 32665, 32678, 32689, 32700, 32709, 32716, 32723, 
-        32730, 32734, 32739, 32743, 32747, 32749, 32753, 32755, 32757, 32758, 32761, 32762, 
-        32763, 32764, 32765, 32766, 32764, 32756, 32742, 32724, 32701, 32672, 32638, 32596, 
-        32551, 32502, 32450, 32395, 32335, 32273, 32206, 32132, 32056, 31978, 31895, 31811, 
-        31724, 31633, 31538, 31437, 31333, 31228, 31120, 31008, 30894, 30778, 30656, 30530, 
-        30400, 30269, 30135, 29998, 29858, 29716, 29569, 29419, 29265, 29107, 28949, 28787, 
-        28621, 28453, 28281, 28103, 27922, 27740, 27555, 27366, 27174, 26981, 26782, 26579, 
-        26372, 26163, 25951, 25738, 25520, 25301, 25076, 24846, 24615, 24380, 24143, 23902, 
-        23660, 23415, 23167, 22915, 22659, 22400, 22139, 21876, 21610, 21341, 21066, 20788, 
-        20508, 20224, 19939, 19650, 19359, 19065, 18769, 18466, 18162, 17856, 17548, 17237, 
-        16924, 16608, 16289, 15966, 15641, 15314, 14984, 14653, 14320, 13986, 13650, 13311, 
-        12970, 12626, 12281, 11934, 11585, 11233, 10879, 10523, 10164, 9805, 9444, 9081, 
-        8718, 8352, 7984, 7614, 7243, 6872, 6498, 6125, 5750, 5374, 4998, 4618, 
-        4239, 3860, 3479, 3099, 2719, 2340, 1961, 1581, 1200, 819, 437, 55, 
-        -326, -707, -1090, -1473, -1854, -2237, -2619, -2999, -3381, -3760, -4140, -4519, 
-        -4898, -5274, -5651, -6026, -6401, -6774, -7147, -7518, -7888, -8256, -8623, -8989, 
-        -9351, -9710, -10069, -10425, -10780, -11133, -11486, -11837, -12186, -12533, -12878, -13220, 
-        -13560, -13899, -14236, -14571, -14904, -15234, -15561, -15885, -16208, -16528, -16846, -17161, 
-        -17475, -17785, -18092, -18395, -18696, -18995, -19292, -19586, -19875, -20160, -20441, -20720, 
-        -20997, -21271, -21543, -21812, -22079, -22342, -22600, -22857, -23111, -23361, -23609, -23855, 
-        -24098, -24336, -24570, -24802, -25031, -25257, -25480, -25701, -25918, -26132, -26341, -26547, 
-        -26750, -26950, -27149, -27343, -27534, -27720, -27902, -28081, -28257, -28431, -28603, -28770, 
-        -28935, -29095, -29252, -29407, -29559, -29708, -29854, -29998, -30138, -30273, -30405, -30535, 
-        -30662, -30786, -30908, -31026, -31141, -31251, -31359, -31463, -31565, -31665, -31762, -31855, 
-        -31945, -32029, -32110, -32188, -32260, -32322, -32377, -32425, -32466, -32504, -32537, -32565, 
-        -32591, -32612, -32632, -32649, -32664, -32677, -32688, -32699, -32708, -32716, -32723, -32728, 
-        -32734, -32739, -32742, -32746, -32749, -32753, -32755, -32757, -32758, -32761, -32762, -32763, 
-        -32764, -32765, -32766, -32766, -32767, -32766, -32759, -32747, -32728, -32705, -32677, -32641, 
-        -32599, -32553, -32503, -32449, -32392, -32331, -32265, -32196, -32120, -32042, -31961, -31877, 
-        -31790, -31699, -31606, -31508, -31405, -31299, -31191, -31080, -30967, -30851, -30731, -30607, 
-        -30478, -30346, -30212, -30075, -29935, -29792, -29647, -29497, -29342, -29184, -29024, -28861, 
-        -28696, -28527, -28356, -28180, -27999, -27815, -27629, -27440, -27249, -27055, -26858, -26657, 
-        -26452, -26243, -26033, -25819, -25603, -25384, -25161, -24934, -24702, -24468, -24231, -23991, 
-        -23748, -23504, -23255, -23002, -22745, -22485, -22223, -21958, -21691, -21421, -21148, -20871, 
-        -20589, -20305, -20018, -19729, -19439, -19145, -18849, -18552, -18249, -17944, -17637, -17328, 
-        -17015, -16701, -16384, -16063, -15738, -15412, -15083, -14752, -14420, -14084, -13748, -13408, 
-        -13064, -12718, -12372, -12023, -11672, -11321, -10967, -10610, -10251, -9890, -9528, -9165, 
-        -8800, -8435, -8068, -7703, -7334, -6964, -6594, -6221, -5848, -5473, -5099, -4722, 
-        -4342, -3963, -3584, -3204, -2823, -2442, -2060, -1679, -1295, -912, -528, -145 
-    };
-
-    // AKWF_sin_0012 → 600 samples
-    static const int16_t akwf_akwf_bwsin_akwf_sin_0012[600] PROGMEM = {
-        187, 554, 919, 1282, 1645, 2012, 2375, 2740, 3105, 3472, 3835, 4198, 
-        4558, 4921, 5283, 5643, 6004, 6361, 6719, 7075, 7429, 7784, 8140, 8491, 
-        8842, 9192, 9541, 9887, 10235, 10579, 10921, 11263, 11602, 11943, 12278, 12612, 
-        12944, 13276, 13603, 13931, 14258, 14583, 14903, 15221, 15539, 15853, 16166, 16479, 
-        16785, 17091, 17395, 17696, 17995, 18292, 18584, 18876, 19166, 19453, 19734, 20016, 
-        20296, 20570, 20843, 21113, 21380, 21646, 21909, 22168, 22420, 22673, 22925, 23174, 
-        23417, 23659, 23897, 24133, 24366, 24597, 24823, 25047, 25266, 25484, 25697, 25909, 
-        26118, 26321, 26521, 26719, 26917, 27109, 27300, 27486, 27667, 27846, 28021, 28195, 
-        28365, 28532, 28697, 28855, 29012, 29166, 29316, 29464, 29608, 29750, 29888, 30020, 
-        30152, 30279, 30404, 30527, 30645, 30760, 30873, 30983, 31089, 31188, 31288, 31382, 
-        31476, 31565, 31652, 31735, 31813, 31890, 31963, 32034, 32100, 32164, 32225, 32281, 
-        32335, 32383, 32434, 32476, 32519, 32555, 32592, 32623, 32651, 32677, 32698, 32719, 
-        32734, 32747, 32757, 32764, 32767, 32767, 32766, 32759, 32748, 32741, 32728, 32708, 
-        32688, 32663, 32637, 32606, 32569, 32533, 32491, 32449, 32403, 32352, 32300, 32244, 
-        32185, 32123, 32058, 31989, 31918, 31843, 31766, 31686, 31603, 31514, 31426, 31332, 
-        31236, 31137, 31033, 30927, 30817, 30708, 30592, 30475, 30353, 30227, 30101, 29971, 
-        29837, 29702, 29561, 29418, 29272, 29123, 28970, 28817, 28659, 28497, 28332, 28164, 
-        27993, 27818, 27640, 27463, 27279, 27093, 26905, 26712, 26518, 26320, 26118, 25913, 
-        25708, 25496, 25282, 25066, 24847, 24623, 24401, 24173, 23942, 23707, 23471, 23233, 
-        22990, 22743, 22496, 22246, 21994, 21735, 21476, 21215, 20949, 20682, 20414, 20141, 
-        19866, 19588, 19307, 19024, 18738, 18448, 18160, 17868, 17571, 17273, 16974, 16672, 
-        16366, 16060, 15751, 15440, 15125, 14809, 14491, 14173, 13851, 13528, 13201, 12873, 
-        12544, 12214, 11880, 11543, 11208, 10871, 10530, 10188, 9843, 9503, 9155, 8808, 
-        8458, 8107, 7758, 7405, 7051, 6698, 6343, 5985, 5627, 5267, 4908, 4548, 
-        4188, 3827, 3467, 3104, 2739, 2374, 2009, 1645, 1282, 915, 550, 185, 
-        -182, -547, -914, -1279, -1642, -2007, -2370, -2735, -3100, -3465, -3827, -4190, 
-        -4551, -4913, -5274, -5636, -5997, -6354, -6710, -7068, -7421, -7777, -8132, -8483, 
-        -8834, -9185, -9532, -9880, -10228, -10572, -10914, -11255, -11595, -11934, -12270, -12603, 
-        -12937, -13267, -13596, -13923, -14249, -14574, -14894, -15212, -15530, -15845, -16158, -16470, 
-        -16778, -17082, -17386, -17687, -17986, -18283, -18577, -18867, -19157, -19444, -19727, -20007, 
-        -20287, -20562, -20834, -21106, -21372, -21637, -21900, -22159, -22413, -22666, -22917, -23165, 
-        -23408, -23652, -23888, -24124, -24359, -24589, -24814, -25040, -25259, -25477, -25690, -25901, 
-        -26109, -26313, -26514, -26712, -26909, -27102, -27291, -27479, -27660, -27837, -28014, -28186, 
-        -28358, -28525, -28688, -28847, -29005, -29158, -29309, -29457, -29601, -29742, -29881, -30013, 
-        -30143, -30272, -30397, -30519, -30637, -30751, -30864, -30974, -31080, -31179, -31280, -31375, 
-        -31469, -31556, -31643, -31726, -31805, -31883, -31954, -32025, -32093, -32156, -32217, -32274, 
-        -32326, -32375, -32427, -32469, -32510, -32549, -32585, -32616, -32644, -32668, -32691, -32710, 
-        -32726, -32738, -32750, -32755, -32761, -32761, -32759, -32752, -32741, -32733, -32719, -32700, 
-        -32681, -32655, -32628, -32597, -32562, -32526, -32484, -32442, -32394, -32343, -32293, -32236, 
-        -32177, -32114, -32050, -31980, -31909, -31836, -31758, -31678, -31594, -31507, -31417, -31325, 
-        -31228, -31129, -31024, -30918, -30811, -30699, -30583, -30466, -30346, -30220, -30093, -29964, 
-        -29830, -29693, -29554, -29410, -29265, -29116, -28963, -28808, -28650, -28489, -28323, -28157, 
-        -27985, -27809, -27632, -27454, -27272, -27086, -26897, -26704, -26509, -26311, -26109, -25904, 
-        -25699, -25487, -25275, -25058, -24839, -24616, -24392, -24166, -23933, -23700, -23462, -23224, 
-        -22981, -22736, -22487, -22239, -21985, -21726, -21467, -21206, -20942, -20673, -20407, -20132, 
-        -19859, -19581, -19300, -19017, -18730, -18440, -18151, -17859, -17562, -17265, -16966, -16663, 
-        -16359, -16052, -15744, -15431, -15117, -14802, -14484, -14166, -13843, -13519, -13194, -12864, 
-        -12536, -12205, -11872, -11536, -11199, -10862, -10521, -10181, -9837, -9494, -9148, -8799, 
-        -8450, -8099, -7749, -7396, -7042, -6689, -6334, -5976, -5618, -5259, -4899, -4539, 
-        -4179, -3818, -3458, -3095, -2732, -2367, -2002, -1638, -1273, -908, -542, -179 
-    };
-
-} // namespace AKWF_BwSin
@@ -1,122 +1,1711 @@
-// Auto‑generated AKWF bank. Do not edit manually.
+// Auto‑generated AKWF bank (compressed, see AKWFCodec.h). Do not edit manually.
 
 #pragma once
 #include <Arduino.h>
 
-#include "AKWF_BwSqu_Tables_Part0.h"
-#include "AKWF_BwSqu_Tables_Part1.h"
-#include "AKWF_BwSqu_Tables_Part2.h"
-#include "AKWF_BwSqu_Tables_Part3.h"
-#include "AKWF_BwSqu_Tables_Part4.h"
-
 namespace AKWF_BwSqu {
+
     constexpr uint16_t count = 100;
-}
 
-// Return a pointer to the n‑th waveform table in this bank.
-// If index is out of range, returns nullptr and length is set to 0.
-inline const int16_t* AKWF_BwSqu_get(uint16_t index, uint16_t &length) {
-    switch(index) {
-        case 0: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0001;
-        case 1: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0002;
-        case 2: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0003;
-        case 3: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0004;
-        case 4: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0005;
-        case 5: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0006;
-        case 6: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0007;
-        case 7: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0008;
-        case 8: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0009;
-        case 9: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0010;
-        case 10: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0011;
-        case 11: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0012;
-        case 12: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0013;
-        case 13: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0014;
-        case 14: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0015;
-        case 15: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0016;
-        case 16: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0017;
-        case 17: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0018;
-        case 18: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0019;
-        case 19: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0020;
-        case 20: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0021;
-        case 21: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0022;
-        case 22: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0023;
-        case 23: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0024;
-        case 24: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0025;
-        case 25: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0026;
-        case 26: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0027;
-        case 27: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0028;
-        case 28: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0029;
-        case 29: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0030;
-        case 30: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0031;
-        case 31: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0032;
-        case 32: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0033;
-        case 33: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0034;
-        case 34: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0035;
-        case 35: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0036;
-        case 36: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0037;
-        case 37: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0038;
-        case 38: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0039;
-        case 39: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0040;
-        case 40: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0041;
-        case 41: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0042;
-        case 42: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0043;
-        case 43: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0044;
-        case 44: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0045;
-        case 45: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0046;
-        case 46: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0047;
-        case 47: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0048;
-        case 48: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0049;
-        case 49: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0050;
-        case 50: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0051;
-        case 51: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0052;
-        case 52: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0053;
-        case 53: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0054;
-        case 54: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0055;
-        case 55: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0056;
-        case 56: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0057;
-        case 57: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0058;
-        case 58: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0059;
-        case 59: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0060;
-        case 60: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0061;
-        case 61: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0062;
-        case 62: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0063;
-        case 63: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0064;
-        case 64: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0065;
-        case 65: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0066;
-        case 66: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0067;
-        case 67: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0068;
-        case 68: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0069;
-        case 69: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0070;
-        case 70: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0071;
-        case 71: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0072;
-        case 72: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0073;
-        case 73: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0074;
-        case 74: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0075;
-        case 75: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0076;
-        case 76: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0077;
-        case 77: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0078;
-        case 78: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0079;
-        case 79: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0080;
-        case 80: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0081;
-        case 81: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0082;
-        case 82: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0083;
-        case 83: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0084;
-        case 84: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0085;
-        case 85: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0086;
-        case 86: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0087;
-        case 87: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0088;
-        case 88: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0089;
-        case 89: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0090;
-        case 90: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0091;
-        case 91: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0092;
-        case 92: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0093;
-        case 93: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0094;
-        case 94: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0095;
-        case 95: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0096;
-        case 96: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0097;
-        case 97: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0098;
-        case 98: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0099;
-        case 99: length = 600; return AKWF_BwSqu::akwf_akwf_bwsqu_akwf_squ_0100;
-        default: length = 0; return nullptr;
-    }
-}
+    // 120000 bytes as int16 → 25479 bytes
+
+    static const uint8_t data[25479] PROGMEM = {
+        0x02, 0xCF, 0xF2, 0x24, 0x22, 0x47, 0xFF, 0x10, 0x2F, 0x77, 0x26, 0xA0, 0x7B, 0x51, 0x23, 0xD5,
+        0x63, 0xC1, 0xBB, 0xC5, 0xCC, 0x03, 0x50, 0x98, 0x87, 0x00, 0x35, 0xE1, 0x2A, 0x06, 0x9A, 0xFF,
+        0xE1, 0x7E, 0xC8, 0x40, 0x80, 0x00, 0x81, 0x80, 0x00, 0x81, 0x80, 0x20, 0x60, 0x0E, 0x53, 0x2C,
+        0x07, 0x2E, 0x5C, 0xB0, 0x42, 0x59, 0x2E, 0x32, 0xE3, 0x2E, 0x0B, 0x19, 0x71, 0x8C, 0x18, 0xC4,
+        0x60, 0xE2, 0xC6, 0x38, 0x8E, 0x22, 0xC9, 0x64, 0xB2, 0x21, 0x17, 0x05, 0x85, 0xC6, 0x5C, 0x18,
+        0x5C, 0x02, 0xC9, 0x83, 0xBC, 0x00, 0x00, 0x16, 0x78, 0x38, 0x5F, 0xB8, 0xD3, 0x4C, 0x29, 0x94,
+        0x8C, 0x63, 0x96, 0x30, 0x5C, 0x59, 0x37, 0x8B, 0x25, 0x84, 0x0E, 0xCD, 0x5B, 0x4D, 0x34, 0x0B,
+        0x62, 0x69, 0xA6, 0xBC, 0x34, 0x8E, 0x52, 0x4A, 0x65, 0x80, 0x2E, 0x5C, 0xA6, 0x5C, 0xB9, 0x72,
+        0xE5, 0x51, 0x00, 0x0C, 0x40, 0xC4, 0x00, 0x31, 0x01, 0x00, 0x0B, 0xBE, 0xB7, 0xB7, 0xF6, 0xB4,
+        0x0D, 0x50, 0x11, 0x01, 0x04, 0x0C, 0x94, 0x66, 0x42, 0xA3, 0x4F, 0x90, 0x55, 0xBD, 0xBE, 0x88,
+        0x6B, 0x73, 0x9D, 0xB5, 0xB2, 0x7F, 0xC5, 0xCD, 0xFF, 0x0F, 0x4B, 0x58, 0x0A, 0x4E, 0xCD, 0x7F,
+        0x90, 0x6F, 0xD4, 0xEF, 0xC6, 0x67, 0x6A, 0xBA, 0x8E, 0xA7, 0xF6, 0xA4, 0x4D, 0x40, 0xB8, 0xB4,
+        0x13, 0xE2, 0x28, 0x91, 0x8D, 0x20, 0x04, 0x00, 0x03, 0xBC, 0x26, 0xB4, 0xD3, 0x0B, 0x12, 0x5C,
+        0xB8, 0x59, 0x2E, 0x51, 0xCB, 0x25, 0x31, 0x72, 0xC7, 0x2C, 0x16, 0x39, 0x63, 0x18, 0x91, 0x88,
+        0x69, 0xAD, 0xDB, 0x4B, 0xD6, 0x85, 0xC5, 0xC5, 0x80, 0x39, 0x62, 0x39, 0x63, 0x96, 0x26, 0x52,
+        0x26, 0x07, 0x34, 0x64, 0x07, 0x83, 0x80, 0x0B, 0x00, 0x2C, 0x2C, 0x59, 0xDE, 0x05, 0xAC, 0xB7,
+        0x7A, 0xD6, 0xB0, 0xDC, 0x49, 0x64, 0x5C, 0x48, 0xA1, 0x9B, 0xB2, 0xF4, 0xB2, 0xC0, 0xB2, 0xCB,
+        0x2C, 0x8C, 0x0B, 0x77, 0x91, 0xBB, 0xC8, 0x10, 0x97, 0x2E, 0x5C, 0x40, 0x72, 0xB0, 0x40, 0x61,
+        0x01, 0x80, 0x08, 0x0C, 0x23, 0xED, 0x4F, 0x31, 0xEC, 0x7F, 0x61, 0xFA, 0x5E, 0xE3, 0x25, 0xA1,
+        0xB4, 0x8F, 0x30, 0x69, 0xBA, 0x94, 0xCF, 0x0F, 0xCA, 0xF8, 0xC0, 0xDB, 0xF5, 0x5A, 0x00, 0x02,
+        0x9F, 0xFF, 0xEC, 0x87, 0x3D, 0xE9, 0xDD, 0x07, 0xBB, 0xF3, 0x3E, 0x1C, 0xB3, 0x2D, 0xBA, 0x2E,
+        0x4F, 0x99, 0x62, 0xD8, 0x6E, 0x21, 0x84, 0x69, 0x06, 0x31, 0x83, 0x05, 0x68, 0xA2, 0xF6, 0x00,
+        0xF5, 0xD9, 0x8E, 0x34, 0x5A, 0x31, 0xBC, 0x19, 0xDE, 0x0C, 0xEB, 0x5C, 0xF5, 0x9D, 0x73, 0x9E,
+        0xE9, 0xE7, 0x33, 0xDD, 0xEF, 0x3B, 0xB9, 0xEE, 0x13, 0x73, 0x98, 0x5C, 0x26, 0x99, 0xC2, 0x6E,
+        0x97, 0xA5, 0xC1, 0x0B, 0x71, 0x61, 0xC5, 0xA5, 0x71, 0x78, 0xDC, 0x70, 0x5E, 0xF8, 0xB8, 0x70,
+        0xC0, 0x44, 0xC3, 0x86, 0x48, 0x3D, 0x6E, 0x80, 0x0E, 0x03, 0xC5, 0xC1, 0x45, 0xC3, 0xC5, 0x8C,
+        0x30, 0x2F, 0xC7, 0x7C, 0x32, 0x78, 0xBC, 0x5C, 0x00, 0x00, 0x02, 0x37, 0xC1, 0x37, 0x86, 0x00,
+        0x0F, 0x17, 0x8B, 0xC3, 0x65, 0x86, 0x03, 0xC5, 0xE1, 0x87, 0x11, 0xBF, 0x8F, 0xB2, 0xF8, 0xDE,
+        0x1B, 0xC6, 0xFC, 0x6E, 0x21, 0x87, 0x86, 0x4E, 0x22, 0xF1, 0x78, 0x6F, 0x17, 0x8B, 0xC3, 0x04,
+        0xE2, 0x1B, 0xC3, 0x78, 0xBC, 0x5C, 0x45, 0xE0, 0xB7, 0xE2, 0xEF, 0xC6, 0xE2, 0x2F, 0x0C, 0x3C,
+        0x30, 0x4F, 0x17, 0x11, 0x78, 0x77, 0xE3, 0x78, 0x6F, 0x1B, 0x2F, 0x1B, 0x88, 0x6F, 0x0D, 0xE2,
+        0xE0, 0x45, 0xE2, 0x80, 0x18, 0x03, 0x01, 0x00, 0xCD, 0xD6, 0xF1, 0x0B, 0xDF, 0x5E, 0xD8, 0xDC,
+        0x4D, 0x1D, 0x46, 0x23, 0x8C, 0x4D, 0x91, 0xA0, 0xEF, 0x18, 0x23, 0xFF, 0x6C, 0xFA, 0xE7, 0x76,
+        0xF4, 0xED, 0xB2, 0xF1, 0x80, 0x48, 0x1C, 0x0A, 0x16, 0x05, 0x00, 0x08, 0x00, 0x04, 0xD2, 0x04,
+        0x63, 0xA0, 0x08, 0xAF, 0x40, 0xC7, 0x64, 0x0B, 0xD8, 0x89, 0x10, 0x96, 0x48, 0x4C, 0x14, 0x03,
+        0x24, 0x0C, 0x83, 0x01, 0x20, 0x92, 0x43, 0x4C, 0x3A, 0x3F, 0x48, 0x42, 0x98, 0x06, 0x81, 0x82,
+        0x07, 0x03, 0xBF, 0x49, 0xE0, 0x89, 0x03, 0x82, 0x02, 0x40, 0xD1, 0x0D, 0x0E, 0x02, 0xCE, 0x94,
+        0xBE, 0x99, 0xE9, 0x78, 0x21, 0x8E, 0x17, 0x01, 0xCB, 0x97, 0x1C, 0xF7, 0xF0, 0xB3, 0x86, 0x04,
+        0x5F, 0x1B, 0xC5, 0xE1, 0x81, 0x05, 0x78, 0x17, 0x11, 0x78, 0x60, 0x43, 0x78, 0x63, 0x7C, 0xA0,
+        0x01, 0x9D, 0xC3, 0x3B, 0x84, 0x00, 0x11, 0x78, 0x6F, 0x17, 0x8B, 0xC3, 0x04, 0xE0, 0x45, 0xE2,
+        0xF1, 0x71, 0x8E, 0xF8, 0x6E, 0x08, 0x45, 0xE2, 0xF1, 0x78, 0xB8, 0x8B, 0xC5, 0xE2, 0xCE, 0x0F,
+        0x07, 0x81, 0x9D, 0x2F, 0x47, 0x44, 0x7A, 0x5C, 0xBC, 0x77, 0xC5, 0xE1, 0x87, 0x8B, 0x88, 0xBC,
+        0x5E, 0x09, 0xBC, 0x5C, 0x45, 0xE2, 0xE3, 0x1D, 0xF1, 0x78, 0x64, 0xF8, 0xEF, 0x18, 0xEF, 0x10,
+        0xDC, 0x45, 0xE1, 0x83, 0x03, 0x83, 0xA2, 0x3C, 0x1D, 0x11, 0xD1, 0x1F, 0xA5, 0x30, 0x2D, 0xBB,
+        0x78, 0x00, 0xE1, 0x02, 0x35, 0xA7, 0x86, 0x67, 0xD2, 0x60, 0x02, 0x8F, 0xFF, 0xF3, 0x40, 0xEC,
+        0x01, 0x13, 0x99, 0xC4, 0x8F, 0xF4, 0x78, 0xD6, 0x31, 0x67, 0x9A, 0xE2, 0xB6, 0x3A, 0xEC, 0xE6,
+        0xDD, 0x7E, 0x5E, 0x7F, 0x67, 0x83, 0x83, 0xC9, 0xC9, 0xBF, 0xAB, 0x7F, 0x0E, 0x9E, 0x2D, 0x7A,
+        0x34, 0xE3, 0xCF, 0x5E, 0x3A, 0xEF, 0x6D, 0x31, 0xBD, 0x6F, 0x84, 0x23, 0x8C, 0xD1, 0xC1, 0xE1,
+        0x7A, 0x3A, 0x23, 0xE9, 0xBF, 0x03, 0x02, 0x88, 0x80, 0x38, 0x0F, 0x87, 0x87, 0xC3, 0x18, 0x1B,
+        0xE5, 0xF0, 0x0C, 0xCB, 0x81, 0x97, 0xF0, 0xB7, 0x18, 0xB1, 0x8B, 0xC3, 0x8B, 0xE1, 0xDF, 0x16,
+        0x50, 0x03, 0xC5, 0xE2, 0xF1, 0x78, 0x6F, 0x0C, 0x10, 0x00, 0x08, 0xBC, 0x5C, 0x45, 0xF1, 0xB1,
+        0xC1, 0x6F, 0x17, 0x10, 0xC0, 0x0F, 0x0C, 0x3E, 0x36, 0x1E, 0x01, 0xEF, 0xEF, 0x07, 0x8B, 0x7E,
+        0x37, 0x11, 0x78, 0xB8, 0x11, 0x78, 0xB8, 0x82, 0xB8, 0x02, 0x2F, 0x17, 0x02, 0x2F, 0x17, 0x10,
+        0x57, 0x86, 0xE2, 0x2E, 0x22, 0xE2, 0x2E, 0x04, 0x15, 0xC0, 0x8B, 0xC5, 0xC4, 0x5C, 0x45, 0xC0,
+        0x82, 0xB8, 0x11, 0x78, 0xB8, 0x8B, 0xC5, 0xE2, 0xE0, 0x14, 0x5E, 0x2E, 0x04, 0x5C, 0x08, 0xBC,
+        0x6F, 0xC6, 0xCE, 0x0F, 0x03, 0x38, 0x3A, 0x23, 0xA0, 0x23, 0xE9, 0xFF, 0xFF, 0xFE, 0x94, 0x99,
+        0x02, 0x26, 0x2D, 0xFC, 0xE3, 0xF1, 0x2E, 0xAF, 0xEB, 0x7A, 0xCD, 0x89, 0xC0, 0xF3, 0x12, 0x0C,
+        0x81, 0x12, 0x0F, 0x83, 0x28, 0x24, 0x1C, 0x5E, 0xC8, 0xF9, 0x08, 0x32, 0xCE, 0xA9, 0x0C, 0x99,
+        0xE4, 0xF2, 0x01, 0x80, 0x49, 0x1B, 0x29, 0x10, 0x86, 0xB8, 0x90, 0xC4, 0x52, 0x3C, 0xA4, 0x90,
+        0x59, 0x20, 0xE1, 0xA2, 0x46, 0x0B, 0x0E, 0x24, 0x3F, 0x0D, 0x3B, 0x6D, 0x6E, 0x8B, 0xE8, 0x52,
+        0x84, 0x12, 0x8F, 0xA1, 0x7B, 0xF0, 0xE3, 0x7E, 0x3B, 0xC5, 0x86, 0x1B, 0x16, 0x21, 0xD2, 0x9D,
+        0x0E, 0xE5, 0xB7, 0x3A, 0x50, 0xD8, 0x02, 0xF8, 0xF7, 0xF1, 0xD8, 0xC5, 0xC0, 0x2B, 0x80, 0x00,
+        0xBE, 0x1E, 0xFC, 0x5C, 0x5C, 0x02, 0x8B, 0xC5, 0xE2, 0xF1, 0x78, 0xB8, 0x8B, 0x80, 0x08, 0x07,
+        0x8B, 0xC5, 0xC0, 0x8D, 0xF1, 0x78, 0x60, 0x9E, 0x2F, 0x0D, 0xC4, 0x6F, 0x86, 0x00, 0x00, 0x00,
+        0x03, 0xBF, 0xDC, 0x27, 0xC7, 0x7C, 0x5E, 0x1B, 0xC3, 0x0F, 0x17, 0x86, 0x4F, 0x17, 0x8B, 0xC3,
+        0x78, 0x61, 0xE1, 0x86, 0x58, 0xBC, 0x30, 0x1E, 0x1B, 0xC5, 0xE1, 0xBC, 0x13, 0x0F, 0x17, 0x86,
+        0x03, 0xC3, 0x78, 0xBC, 0x15, 0xE1, 0x87, 0x8B, 0xC5, 0xE1, 0x80, 0x00, 0x10, 0xBE, 0x77, 0xCA,
+        0x00, 0x5F, 0x3B, 0xE4, 0x00, 0xC0, 0x60, 0x80, 0x38, 0x20, 0x06, 0x00, 0x01, 0x81, 0x00, 0x80,
+        0xF4, 0xDE, 0x47, 0x69, 0xFF, 0x36, 0x7F, 0xFF, 0xCA, 0x93, 0xFB, 0x39, 0x7A, 0x33, 0x77, 0xDA,
+        0x14, 0xDD, 0x3C, 0x27, 0xC5, 0x70, 0x02, 0xDC, 0xCF, 0x4B, 0xE0, 0x5F, 0x8D, 0x83, 0xEE, 0x56,
+        0x72, 0x98, 0x41, 0x76, 0x0C, 0x58, 0x25, 0x00, 0x50, 0x80, 0x9A, 0x01, 0x38, 0x01, 0x40, 0x00,
+        0x00, 0x11, 0x00, 0x2C, 0x00, 0xF2, 0xEF, 0x9C, 0xCC, 0xA9, 0x08, 0x8A, 0x34, 0x50, 0x91, 0xC6,
+        0x6F, 0x2B, 0x15, 0x9A, 0x0D, 0xF3, 0x9C, 0x73, 0x9F, 0x60, 0xEA, 0xC6, 0xB2, 0xD2, 0x34, 0xA2,
+        0xC0, 0xA6, 0xF2, 0xB0, 0xD9, 0x9A, 0x2C, 0x9B, 0x12, 0x31, 0x65, 0xE6, 0x89, 0xCD, 0x89, 0x1C,
+        0x52, 0x24, 0x14, 0x92, 0xC4, 0xE6, 0x9C, 0xDE, 0x6E, 0x0C, 0xDE, 0x33, 0x72, 0x32, 0x2C, 0x88,
+        0xBC, 0x59, 0x37, 0x8C, 0x63, 0xCA, 0x8F, 0x37, 0x96, 0x32, 0x0B, 0x91, 0x11, 0x86, 0x6F, 0x2C,
+        0x72, 0xC8, 0x1B, 0xC1, 0x06, 0x65, 0x19, 0x97, 0x2B, 0xCA, 0x1E, 0x76, 0xDD, 0xE1, 0xF7, 0xE0,
+        0x01, 0x6F, 0x70, 0xF7, 0x3D, 0xD0, 0xF2, 0x99, 0x72, 0xE5, 0xCB, 0x97, 0x0A, 0x38, 0x6F, 0x2E,
+        0x05, 0xC0, 0xB8, 0x1A, 0x00, 0x18, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+        0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x6B, 0x47, 0xE7, 0x6E, 0x7E, 0x36,
+        0x17, 0xB9, 0x57, 0x5F, 0xFF, 0xFF, 0xFA, 0x62, 0x2E, 0xAC, 0x55, 0x27, 0x94, 0x11, 0x32, 0x13,
+        0x40, 0x98, 0x00, 0x02, 0x40, 0x30, 0x08, 0x01, 0x00, 0x1C, 0x02, 0x80, 0x30, 0xF1, 0xE0, 0xC3,
+        0x66, 0xC4, 0x65, 0x18, 0xF3, 0x72, 0x32, 0x47, 0x83, 0xC0, 0x70, 0xC0, 0xC3, 0x0E, 0x27, 0x24,
+        0x46, 0x64, 0x73, 0x06, 0x61, 0x91, 0x01, 0xC3, 0x9B, 0x91, 0x38, 0xDE, 0x45, 0xE0, 0xB0, 0x63,
+        0x23, 0x9B, 0xC3, 0x78, 0x86, 0x5B, 0xB6, 0x59, 0x65, 0x0E, 0x30, 0xDE, 0x1B, 0xCD, 0xE5, 0x79,
+        0xB0, 0x5E, 0x56, 0x2C, 0x8B, 0x26, 0xC8, 0x2B, 0xCD, 0x8C, 0x66, 0xE4, 0xDE, 0x6E, 0x0B, 0x14,
+        0x92, 0xB0, 0x89, 0x78, 0x3B, 0x8C, 0xB8, 0xA1, 0xCD, 0x08, 0x8D, 0xC2, 0x37, 0x2E, 0x4D, 0xCA,
+        0x62, 0x17, 0xB8, 0x7E, 0xF8, 0x06, 0x16, 0xE0, 0x17, 0x0B, 0x93, 0x70, 0xA3, 0x97, 0x2E, 0x5C,
+        0xB9, 0x4C, 0xA7, 0x34, 0x3D, 0xC7, 0xB8, 0xF7, 0x1E, 0xE0, 0x0F, 0x70, 0x00, 0x03, 0x99, 0x51,
+        0xF8, 0x45, 0xFE, 0xFB, 0x86, 0x09, 0x91, 0x64, 0x5E, 0x08, 0xC1, 0x60, 0x3A, 0x10, 0x85, 0xE0,
+        0xD8, 0x2E, 0x00, 0x81, 0x07, 0x6E, 0x1A, 0x69, 0x95, 0x92, 0x86, 0x4A, 0x68, 0xE0, 0x82, 0xC9,
+        0x23, 0x93, 0x79, 0xBC, 0xA4, 0x46, 0x45, 0xF3, 0x79, 0xDE, 0x4B, 0x23, 0x01, 0x1C, 0x1C, 0xB8,
+        0xE5, 0x31, 0x00, 0xC5, 0xE8, 0x65, 0xB7, 0x07, 0x11, 0xF3, 0xDE, 0x30, 0xBC, 0xDC, 0x01, 0x60,
+        0xC0, 0x60, 0xF3, 0xBC, 0xB0, 0x93, 0x10, 0x4D, 0x5D, 0x34, 0x9A, 0x8B, 0x0F, 0x1B, 0xB0, 0x37,
+        0x60, 0x00, 0x01, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x07, 0x2F, 0xFD, 0x4E, 0xFF, 0x22, 0x2F, 0x22, 0xCD, 0xCA, 0x63, 0xFE, 0x23, 0x41, 0xA6, 0x05,
+        0xEB, 0xFF, 0x47, 0xE8, 0xFD, 0xBC, 0x59, 0x6F, 0x42, 0xA0, 0xE3, 0x01, 0x0E, 0x6A, 0xE9, 0xA6,
+        0x5E, 0x79, 0x7B, 0x83, 0x50, 0xF0, 0x1A, 0x24, 0x8B, 0x2B, 0xCD, 0xE6, 0xE0, 0xC5, 0x90, 0x7B,
+        0xCD, 0xF3, 0x5C, 0x58, 0x84, 0xA0, 0xCB, 0x96, 0x5C, 0x2C, 0x04, 0x20, 0x76, 0x13, 0x57, 0x9D,
+        0x98, 0x7B, 0xF3, 0x62, 0x66, 0xF2, 0x84, 0x48, 0x28, 0x44, 0x9B, 0xE6, 0xE2, 0xE1, 0x46, 0x4D,
+        0xF3, 0x71, 0x71, 0xBE, 0x50, 0x43, 0xD0, 0x2F, 0x40, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x2B, 0x00, 0x94, 0xF3, 0x88, 0x87, 0x11, 0x5C, 0xE5, 0x40, 0x02, 0x8F, 0xFF,
+        0x00, 0x7C, 0xEC, 0x20, 0x46, 0xDB, 0xF7, 0xEC, 0x32, 0xF1, 0x78, 0xBA, 0x5B, 0xED, 0x55, 0xEA,
+        0xC5, 0x36, 0x91, 0x5E, 0xFF, 0x47, 0x8F, 0xB3, 0x9B, 0x93, 0x76, 0xCC, 0xF9, 0x71, 0xDF, 0x7D,
+        0x96, 0xD1, 0x3D, 0x6B, 0x8C, 0xEB, 0x37, 0x79, 0xAA, 0xAB, 0x99, 0xA8, 0xBA, 0xBA, 0x76, 0x34,
+        0xD0, 0xDC, 0x1E, 0xC2, 0x89, 0x62, 0x96, 0x30, 0x69, 0x63, 0x28, 0x0B, 0x2E, 0x51, 0x18, 0xB0,
+        0xB9, 0x49, 0xB2, 0x20, 0x77, 0xBB, 0x4D, 0xDA, 0x00, 0x9B, 0xB5, 0xA6, 0xE6, 0x80, 0x0B, 0x76,
+        0xDD, 0xAD, 0xDE, 0x82, 0xF7, 0x3D, 0xC0, 0xB3, 0xBF, 0x0E, 0xC8, 0xB1, 0x82, 0x12, 0xE5, 0x0C,
+        0xB2, 0x0D, 0x16, 0x05, 0x93, 0x57, 0xEF, 0xB2, 0xC1, 0x18, 0x5C, 0x65, 0xC2, 0x99, 0x70, 0x3B,
+        0x13, 0x5E, 0xE3, 0x40, 0x5B, 0x4B, 0x5B, 0x76, 0xB4, 0x18, 0xBC, 0xAF, 0x36, 0x00, 0x32, 0xD0,
+        0x1D, 0x10, 0x24, 0xDD, 0x6E, 0xFF, 0xEB, 0xDF, 0xED, 0xD7, 0xFC, 0x2F, 0x5F, 0xF0, 0x03, 0x47,
+        0x02, 0x71, 0x58, 0x17, 0xA5, 0x64, 0x6E, 0x13, 0x23, 0xF2, 0x0E, 0xF5, 0xB4, 0x71, 0x6C, 0xAB,
+        0x3A, 0xB9, 0x5D, 0x26, 0xD3, 0xE8, 0x84, 0x49, 0xB1, 0xC1, 0x49, 0x49, 0x3C, 0x9D, 0x9C, 0x9B,
+        0x33, 0x66, 0xAA, 0xAA, 0x22, 0x91, 0xCA, 0x72, 0x10, 0x3E, 0x79, 0x9E, 0x1E, 0x19, 0x24, 0x84,
+        0xC4, 0x1E, 0x0D, 0x63, 0x4C, 0x05, 0xEA, 0xF7, 0x78, 0xB1, 0x61, 0x89, 0x17, 0x19, 0x37, 0x23,
+        0x78, 0x11, 0xEE, 0x3D, 0xCF, 0x77, 0xA0, 0x63, 0x06, 0x0E, 0x31, 0x97, 0x88, 0x97, 0x32, 0x86,
+        0x52, 0x41, 0x88, 0xC6, 0x38, 0xC0, 0x2F, 0x94, 0x88, 0xE2, 0xE3, 0x96, 0x42, 0xE0, 0x44, 0x35,
+        0xE9, 0x8D, 0x66, 0xB6, 0x08, 0xF1, 0x6C, 0xD6, 0xBD, 0x85, 0x81, 0x96, 0x63, 0x09, 0x1C, 0xA3,
+        0xE5, 0x98, 0x33, 0x97, 0x20, 0x64, 0x07, 0x1C, 0xC7, 0x26, 0x13, 0x24, 0xE1, 0x84, 0x30, 0xA2,
+        0x23, 0x09, 0x6A, 0x97, 0x15, 0x1D, 0x38, 0x20, 0x80, 0x40, 0x60, 0x90, 0x70, 0x86, 0x41, 0xEA,
+        0x9D, 0x73, 0x24, 0xC3, 0xB1, 0x0C, 0x12, 0xE9, 0x5C, 0x7A, 0xA4, 0xEA, 0x35, 0x0E, 0x81, 0x38,
+        0x31, 0x28, 0x00, 0x02, 0xCC, 0x83, 0xDF, 0xA0, 0x93, 0xC5, 0x37, 0xE3, 0xAD, 0x5B, 0x39, 0x3E,
+        0x01, 0x22, 0x02, 0x70, 0x09, 0x00, 0x14, 0x00, 0xC0, 0x06, 0x00, 0x20, 0x01, 0xC0, 0x10, 0x00,
+        0x92, 0xD1, 0xA5, 0x30, 0xF5, 0x38, 0x2E, 0x06, 0x24, 0x79, 0x4E, 0x3C, 0xDC, 0x0C, 0x25, 0xE2,
+        0x27, 0x2F, 0x2C, 0x26, 0x5E, 0x53, 0x0C, 0x1B, 0x8C, 0xC7, 0x29, 0xC6, 0x04, 0x03, 0x3D, 0xD9,
+        0xE0, 0xDB, 0x41, 0xC6, 0x3C, 0x18, 0xE1, 0x8B, 0x80, 0xC7, 0x2E, 0x4B, 0xC6, 0x04, 0x22, 0x1B,
+        0x35, 0xAF, 0x5E, 0x2D, 0xB0, 0xBC, 0xD9, 0x08, 0x4B, 0x26, 0x59, 0x05, 0x8E, 0x06, 0x59, 0x1C,
+        0xBC, 0xB8, 0x16, 0x3D, 0x35, 0x9E, 0xBD, 0xC1, 0x87, 0x37, 0x13, 0x06, 0x46, 0x44, 0x63, 0x8C,
+        0x0C, 0xA4, 0xC6, 0xF1, 0x18, 0x42, 0xF1, 0x8C, 0x97, 0x08, 0x8C, 0x4E, 0x59, 0x2C, 0x91, 0x23,
+        0x08, 0x54, 0xA0, 0xF0, 0x6B, 0x30, 0x8E, 0x25, 0x13, 0x88, 0x70, 0x41, 0x88, 0x9C, 0x67, 0x17,
+        0xAC, 0x00, 0x10, 0x00, 0xC0, 0x0C, 0x01, 0x10, 0x07, 0x00, 0x04, 0x01, 0xC0, 0x03, 0x00, 0x20,
+        0x05, 0xC0, 0x70, 0xE1, 0xDF, 0x0E, 0xBF, 0x5D, 0x6F, 0xA2, 0x8B, 0xBE, 0x01, 0xFF, 0xFF, 0xF1,
+        0x0F, 0xFB, 0x4C, 0xB8, 0x18, 0x2C, 0x20, 0x18, 0x14, 0x24, 0x08, 0x24, 0x50, 0x34, 0x18, 0x14,
+        0x14, 0xA2, 0x75, 0x22, 0xD0, 0x38, 0xDC, 0x33, 0x12, 0x3C, 0xEE, 0x69, 0x19, 0xDC, 0xB0, 0xA2,
+        0x0B, 0x3E, 0xD6, 0xA5, 0x6A, 0x18, 0xD8, 0xC4, 0xD9, 0x9B, 0x2B, 0x83, 0x65, 0x94, 0x88, 0xA3,
+        0x9B, 0x81, 0xD1, 0xAA, 0xB1, 0xDB, 0xB0, 0xAE, 0x6C, 0x49, 0xBC, 0xEC, 0x18, 0x84, 0x29, 0xBB,
+        0x48, 0xE1, 0xC3, 0x73, 0x79, 0xB9, 0x65, 0x22, 0x20, 0x5A, 0x76, 0x5B, 0xB5, 0x61, 0x47, 0x2B,
+        0x19, 0x5C, 0x4B, 0x81, 0xF7, 0xAD, 0xC5, 0xEE, 0x40, 0x11, 0x09, 0xBB, 0x57, 0xBE, 0x18, 0x0C,
+        0xA6, 0x58, 0xD8, 0xF2, 0x89, 0xB9, 0x37, 0x9B, 0x17, 0x9B, 0x9B, 0x00, 0x6E, 0xDF, 0x7A, 0xC9,
+        0xD9, 0x85, 0x20, 0x24, 0x46, 0x75, 0x7D, 0x64, 0x1C, 0xF8, 0x80, 0x38, 0x38, 0x1A, 0x01, 0x05,
+        0x84, 0x81, 0x9F, 0xFF, 0xE6, 0xA0, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF,
+        0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF7,
+        0xFD, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+        0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x03, 0xFF, 0xFF, 0xFF, 0xFB, 0xFE, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF,
+        0xFF, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0xFF, 0xFF,
+        0xFF, 0xFE, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF7, 0xFE, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x60, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xEF,
+        0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xBF, 0xEC, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+        0xBF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+        0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xEF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0F, 0xBF, 0xC3, 0xFF, 0xFF, 0xFF, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+        0xFF, 0xFF, 0xFE, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF,
+        0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF,
+        0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x02, 0xB0, 0x00, 0xFF, 0x6A, 0xAF, 0xF5, 0xC7, 0x00, 0x40, 0x03, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x06, 0x00, 0x50, 0x00, 0x00, 0x00, 0x04, 0x00, 0x30, 0x00, 0x00, 0x01, 0x32, 0x81, 0xCE,
+        0xC0, 0xE6, 0x86, 0x07, 0x1E, 0xE3, 0xF7, 0xC3, 0xDC, 0x09, 0x94, 0x39, 0xA3, 0x39, 0xA6, 0x50,
+        0x43, 0x9A, 0xC3, 0x9A, 0x06, 0x50, 0x1C, 0xA0, 0x73, 0x41, 0xF3, 0x4C, 0xA0, 0x87, 0x35, 0x9C,
+        0xD0, 0x32, 0x80, 0x39, 0x43, 0x9A, 0x06, 0x53, 0x28, 0x09, 0xCD, 0x07, 0xCD, 0x03, 0x28, 0x70,
+        0x75, 0x87, 0x34, 0xCA, 0x07, 0x3B, 0x01, 0x39, 0xA1, 0x94, 0x0C, 0xA0, 0x70, 0x74, 0x7C, 0xD0,
+        0xCA, 0x07, 0x3B, 0x01, 0xE6, 0x81, 0x94, 0x0C, 0xA1, 0xCD, 0x30, 0x01, 0xFF, 0xFF, 0xFF, 0xEE,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0xFF, 0xA0, 0x00, 0xFF, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF,
+        0xFF, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF7, 0xFD, 0x80, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x02, 0x3F, 0xFF, 0xFF, 0xFE, 0x86, 0x86, 0x84, 0xF0, 0x54, 0x34, 0x34, 0x25, 0x1C,
+        0xB9, 0x72, 0xE4, 0xD7, 0xC6, 0xE5, 0xE0, 0xB5, 0xF1, 0xB9, 0x78, 0xD3, 0x0B, 0xC1, 0xEF, 0x8D,
+        0x30, 0xBC, 0xEF, 0x8D, 0x32, 0x15, 0xE2, 0x60, 0x31, 0x0A, 0xF1, 0x30, 0xE1, 0x8E, 0x4D, 0xCB,
+        0x97, 0x2E, 0x4D, 0xCB, 0x94, 0x72, 0xF1, 0xB8, 0x53, 0x2F, 0x1B, 0x90, 0xAD, 0x55, 0xE0, 0xB8,
+        0x70, 0xEA, 0xF0, 0x59, 0x43, 0xAB, 0xC5, 0xE0, 0xB8, 0x75, 0x78, 0x98, 0x20, 0xEA, 0xF1, 0x30,
+        0xE0, 0x3A, 0xBC, 0x4C, 0x13, 0x85, 0x78, 0x98, 0x70, 0xE1, 0x5E, 0x26, 0x06, 0xE5, 0xC9, 0xB9,
+        0x72, 0xE5, 0xC9, 0xB8, 0x37, 0x2E, 0x5E, 0x37, 0x2E, 0x5C, 0x9B, 0x83, 0x72, 0xE5, 0xE3, 0x72,
+        0xE5, 0xCB, 0xC4, 0x6E, 0x53, 0x27, 0x7C, 0x6E, 0x53, 0x27, 0x47, 0xC6, 0xE5, 0x32, 0x6E, 0x17,
+        0x29, 0x83, 0x37, 0x0B, 0xCE, 0xCE, 0x37, 0x0A, 0x61, 0x3A, 0x2E, 0x15, 0xAA, 0xBC, 0x17, 0x0A,
+        0xF0, 0x00, 0x40, 0x06, 0x00, 0x38, 0x02, 0x00, 0x02, 0x00, 0x30, 0x02, 0x00, 0x08, 0x00, 0xA0,
+        0x01, 0x00, 0x47, 0xFF, 0xF8, 0x01, 0x41, 0xAB, 0xFF, 0xFD, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0xFE, 0x01, 0xBF, 0xFF, 0xFF, 0xFF,
+        0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0xFF, 0xFD,
+        0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF7, 0xFD, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF7, 0xFD, 0x80,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xEF,
+        0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF7, 0xFE, 0xC0,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xFF, 0xFF,
+        0xFF, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x6F, 0xFF, 0xF7, 0xFE, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x03, 0xFF, 0xFB, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x19, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+        0xBF, 0xDA, 0x1B, 0xFC, 0x77, 0xBF, 0x0A, 0x7F, 0xEE, 0x97, 0x51, 0xF4, 0x1A, 0x08, 0x30, 0x11,
+        0x00, 0x60, 0x16, 0x00, 0x90, 0x0A, 0x00, 0x90, 0x05, 0x00, 0xA0, 0x07, 0x2F, 0x17, 0x56, 0xA9,
+        0xF1, 0x71, 0x2B, 0x06, 0xA4, 0x49, 0x31, 0xE7, 0x73, 0x0C, 0xA1, 0xC4, 0x64, 0xBC, 0x79, 0xB9,
+        0x1C, 0xBC, 0x88, 0x33, 0x18, 0xE3, 0x09, 0x96, 0x43, 0x06, 0xE2, 0x79, 0xB8, 0xC3, 0x07, 0x9B,
+        0xC1, 0x4C, 0xB8, 0x48, 0xE6, 0xF0, 0x93, 0x43, 0xF5, 0xB0, 0xD7, 0xB5, 0x80, 0x7A, 0xDA, 0xC7,
+        0xBB, 0xC6, 0x03, 0x5E, 0x2D, 0xE9, 0xEB, 0x18, 0x2F, 0x5A, 0xF0, 0x7A, 0xCB, 0xC2, 0xC0, 0xCB,
+        0x8F, 0x36, 0x42, 0x38, 0x29, 0x1E, 0x6F, 0x12, 0x38, 0x02, 0x3C, 0x62, 0xF2, 0xE0, 0x06, 0x31,
+        0x18, 0xE1, 0x04, 0x30, 0x73, 0x7C, 0xD1, 0xCC, 0xDC, 0x19, 0x25, 0x24, 0x88, 0x2C, 0xC0, 0xB9,
+        0x78, 0xC9, 0xDE, 0x3F, 0x09, 0xB0, 0x70, 0xF1, 0x2C, 0x46, 0x98, 0xCE, 0x2C, 0x00, 0x40, 0x08,
+        0x02, 0x80, 0x24, 0x01, 0x00, 0x3C, 0x03, 0x80, 0x08, 0x04, 0x00, 0x44, 0x02, 0xF1, 0xA5, 0xFE,
+        0x6B, 0x7F, 0x33, 0xFF, 0x9B, 0x37, 0xF8, 0xED, 0x47, 0xFF, 0xFA, 0x0B, 0xC5, 0x63, 0x80, 0x50,
+        0x44, 0x00, 0x04, 0x01, 0x01, 0x00, 0x20, 0xB0, 0x30, 0x2C, 0x24, 0x09, 0x00, 0x11, 0x9A, 0xBE,
+        0x36, 0x99, 0x80, 0x2E, 0x18, 0x1C, 0xA6, 0x81, 0x2C, 0xF7, 0x22, 0x51, 0x12, 0x52, 0xC2, 0x6B,
+        0x9B, 0x00, 0x5D, 0xA2, 0xB7, 0x6D, 0xDC, 0x17, 0x9B, 0x12, 0x91, 0x1B, 0x82, 0x23, 0x60, 0xCA,
+        0x0C, 0xB2, 0xE0, 0xD0, 0xA4, 0x5C, 0xB7, 0x2C, 0x28, 0x0B, 0x76, 0xAD, 0x5B, 0x98, 0x45, 0x18,
+        0xCA, 0x0C, 0xB9, 0xA3, 0x94, 0x88, 0xB9, 0xBC, 0xD1, 0x80, 0x96, 0x24, 0x54, 0x25, 0xCD, 0x81,
+        0x64, 0xE6, 0x3B, 0x56, 0x86, 0x58, 0xC4, 0x2C, 0x73, 0x62, 0x0E, 0x77, 0xCE, 0x99, 0xBC, 0x54,
+        0x8C, 0xD1, 0xC2, 0xE2, 0x89, 0x06, 0x77, 0x88, 0xB9, 0x66, 0xC8, 0x67, 0xDC, 0x72, 0x68, 0x53,
+        0xA9, 0x83, 0x31, 0x7D, 0x66, 0xA6, 0x51, 0xF5, 0x00, 0xD0, 0x20, 0x4C, 0x0C, 0x03, 0x0D, 0x0F,
+        0xFF, 0xFF, 0x7E, 0x00, 0x02, 0xBF, 0xEC, 0xF1, 0xFC, 0x2C, 0x3F, 0x36, 0x9F, 0xEA, 0x3B, 0x32,
+        0xD4, 0x04, 0x08, 0x90, 0x09, 0x00, 0xB0, 0x06, 0x00, 0x20, 0x10, 0x00, 0x10, 0x05, 0x00, 0x30,
+        0x01, 0x2E, 0xAF, 0x8C, 0xC0, 0x7C, 0x38, 0x66, 0x8D, 0x01, 0x19, 0x24, 0xB8, 0xE4, 0x86, 0xF2,
+        0x0B, 0xC6, 0x6F, 0xCB, 0x20, 0x3E, 0x17, 0x04, 0x21, 0x89, 0x32, 0xE4, 0x65, 0xF0, 0x5C, 0x5C,
+        0x32, 0xC8, 0xE1, 0x97, 0x02, 0xD8, 0xD6, 0xCC, 0xBF, 0x77, 0x86, 0x6F, 0x19, 0x22, 0x13, 0x12,
+        0x21, 0xE3, 0x5E, 0x9E, 0x2F, 0x5E, 0xC3, 0x64, 0x08, 0xE0, 0xE0, 0x3C, 0xA3, 0x20, 0xF3, 0x7C,
+        0xB9, 0x71, 0x91, 0x82, 0xF2, 0xE1, 0x78, 0x90, 0x89, 0x30, 0x22, 0xFD, 0x62, 0xDE, 0x9A, 0x1C,
+        0xBC, 0xB8, 0x30, 0x8E, 0x2F, 0x01, 0x65, 0xF2, 0xE5, 0x92, 0xF0, 0x18, 0x09, 0x97, 0x9B, 0x32,
+        0xF9, 0xB1, 0x86, 0x42, 0xB8, 0x02, 0x88, 0xBE, 0x2F, 0x87, 0x75, 0x7C, 0x11, 0x45, 0xC4, 0xF4,
+        0xD6, 0x4A, 0x8F, 0x59, 0xFE, 0x6C, 0x0B, 0x0C, 0xD7, 0xCB, 0x5F, 0xFC, 0x21, 0xE0, 0x93, 0xFE,
+        0x43, 0x1F, 0x67, 0xE1, 0xB6, 0x29, 0x70, 0x9E, 0x01, 0xF0, 0x1C, 0x00, 0x30, 0x08, 0x01, 0x30,
+        0x04, 0x2B, 0xD0, 0x2B, 0x9E, 0x2D, 0x45, 0xC6, 0x71, 0x34, 0x36, 0x97, 0x8A, 0xDC, 0xDF, 0x2D,
+        0x41, 0x21, 0xA3, 0x0B, 0x9D, 0x85, 0xE6, 0x81, 0x2D, 0xC5, 0xBB, 0x73, 0x87, 0x0D, 0x8E, 0x52,
+        0x91, 0x62, 0x07, 0x69, 0x0E, 0x7B, 0xAB, 0x60, 0xE5, 0x6B, 0x52, 0xDD, 0x90, 0xB2, 0x92, 0xCB,
+        0x26, 0xC4, 0x01, 0x37, 0x9B, 0x1C, 0xB7, 0x2C, 0x44, 0x10, 0x62, 0x84, 0xD9, 0x72, 0xE5, 0x18,
+        0xB2, 0xF3, 0xB0, 0x60, 0xD9, 0x05, 0x65, 0x32, 0x82, 0xC7, 0x37, 0x07, 0xB8, 0x03, 0x36, 0x46,
+        0x77, 0x00, 0x1D, 0xA6, 0xA0, 0xEF, 0x3F, 0x83, 0xF4, 0xDD, 0x61, 0x3E, 0xFC, 0x0A, 0xB0, 0x89,
+        0x4C, 0xB9, 0xDC, 0x46, 0x0C, 0xDC, 0xB9, 0x34, 0x61, 0x94, 0xA6, 0x1E, 0x19, 0x59, 0xD5, 0xF5,
+        0x77, 0x5B, 0xF1, 0x00, 0x90, 0x80, 0x3C, 0x0E, 0x05, 0x0A, 0x01, 0x7F, 0xFF, 0xD6, 0x40, 0x02,
+        0xBF, 0xFD, 0x14, 0xBB, 0x9D, 0x7F, 0x4D, 0xBF, 0xD4, 0xFD, 0x51, 0xCC, 0xE8, 0x2C, 0x40, 0x90,
+        0x01, 0x00, 0x48, 0x02, 0xC0, 0x20, 0x04, 0x40, 0x28, 0x01, 0x80, 0x10, 0xA3, 0x78, 0x74, 0x16,
+        0x39, 0xD1, 0x84, 0x62, 0x4A, 0x8E, 0x09, 0x89, 0xD0, 0x35, 0x28, 0xF1, 0x23, 0x23, 0x0C, 0x08,
+        0xC3, 0xCE, 0xE4, 0x17, 0x81, 0x70, 0x99, 0x71, 0x92, 0x23, 0x13, 0xCB, 0x23, 0x1F, 0x28, 0x62,
+        0x38, 0x4D, 0xF2, 0xF1, 0x97, 0x8C, 0x82, 0x19, 0xFB, 0xB1, 0xB6, 0x8D, 0xB0, 0xB0, 0x78, 0x5E,
+        0x5C, 0x66, 0x2E, 0x0D, 0xF1, 0x96, 0x12, 0x01, 0x1E, 0x22, 0xC8, 0x04, 0x79, 0xBC, 0x26, 0xE6,
+        0x0D, 0x90, 0x97, 0x1E, 0x5C, 0xB2, 0x44, 0x63, 0x31, 0x72, 0xE4, 0x8D, 0xE0, 0x03, 0x0B, 0xF4,
+        0x6D, 0x67, 0x0F, 0x96, 0x11, 0x79, 0x78, 0xB9, 0xBE, 0x23, 0x17, 0x97, 0x00, 0xBE, 0x5E, 0x57,
+        0x09, 0xE1, 0xC3, 0x40, 0x54, 0xD6, 0x63, 0x4E, 0xA8, 0x05, 0x80, 0x60, 0x0A, 0x02, 0x00, 0x40,
+        0x03, 0x00, 0x80, 0x4C, 0x07, 0x00, 0x30, 0x20, 0x0C, 0x8D, 0x1F, 0xF1, 0xBB, 0xFF, 0xFE, 0x1B,
+        0xFE, 0x2A, 0x6B, 0xFF, 0xF8, 0x8A, 0xFF, 0xF9, 0x8A, 0x98, 0x06, 0x76, 0x2B, 0x81, 0x58, 0x02,
+        0x01, 0xE0, 0x20, 0x01, 0x80, 0xE0, 0x0A, 0x01, 0xC0, 0x08, 0x07, 0x01, 0xC4, 0xD6, 0x51, 0x9D,
+        0x4C, 0x6D, 0x44, 0xE2, 0xC0, 0x96, 0x33, 0x49, 0xBC, 0x5A, 0x30, 0x46, 0x90, 0xDC, 0x69, 0x94,
+        0xB0, 0x57, 0x0B, 0x63, 0x14, 0xB2, 0x51, 0x95, 0xE7, 0x71, 0x47, 0x36, 0x28, 0x24, 0xB3, 0x4C,
+        0x56, 0x6E, 0x32, 0x8C, 0xDC, 0x41, 0xBC, 0xEE, 0x09, 0x60, 0x15, 0x65, 0xB8, 0x3B, 0x0A, 0xE2,
+        0x8C, 0xB8, 0xD8, 0x80, 0x97, 0x14, 0x95, 0x82, 0x47, 0x43, 0x7A, 0x92, 0xF7, 0x2D, 0x30, 0xEE,
+        0x6F, 0x28, 0x33, 0x7C, 0xD0, 0x60, 0x42, 0x59, 0xD9, 0x01, 0x58, 0xC2, 0x91, 0x33, 0x5C, 0x45,
+        0x8B, 0x94, 0x96, 0x5C, 0x61, 0xA2, 0x47, 0x29, 0x72, 0xE1, 0xB9, 0xBE, 0x68, 0xE3, 0x43, 0x28,
+        0x5E, 0x77, 0xC6, 0xA4, 0x30, 0xC3, 0x21, 0x56, 0x6B, 0x75, 0x0A, 0xA4, 0x11, 0x02, 0x00, 0xD0,
+        0x48, 0x06, 0x00, 0xC6, 0x8F, 0xFE, 0x42, 0x00, 0x02, 0xBC, 0x29, 0xBF, 0xFA, 0x9F, 0x4A, 0x9F,
+        0xFD, 0x40, 0xFC, 0xA7, 0x49, 0x28, 0x5D, 0x82, 0x54, 0x05, 0x00, 0x1C, 0x03, 0x80, 0x00, 0x04,
+        0x00, 0x2C, 0x01, 0x00, 0x24, 0xAB, 0x03, 0x5D, 0xC0, 0xC0, 0x41, 0xC0, 0x88, 0x29, 0xAB, 0xD3,
+        0xC1, 0x09, 0xC5, 0x12, 0x28, 0x9D, 0x10, 0x8E, 0xAE, 0x8A, 0x31, 0x13, 0x80, 0xFB, 0xF4, 0xF0,
+        0xC7, 0x86, 0x12, 0x04, 0x78, 0x99, 0x70, 0x32, 0x8E, 0x39, 0x18, 0xC3, 0x01, 0x9C, 0xA2, 0x60,
+        0x5F, 0x94, 0x8E, 0x3C, 0x58, 0x26, 0x0C, 0x8C, 0xCB, 0x80, 0xCE, 0x0F, 0x7C, 0xB0, 0x91, 0x91,
+        0xCB, 0x0C, 0x16, 0x0F, 0x2C, 0x31, 0x79, 0xBE, 0x5C, 0x0E, 0xF2, 0xF6, 0xAD, 0xB1, 0x6C, 0x0F,
+        0x73, 0x36, 0x98, 0xF3, 0x86, 0x42, 0x39, 0x61, 0x85, 0xC6, 0x41, 0x06, 0x18, 0x5C, 0xBC, 0x64,
+        0xB0, 0x8D, 0x34, 0x9C, 0x3E, 0x2D, 0x13, 0x87, 0x45, 0x28, 0xBF, 0x56, 0xB3, 0x48, 0x71, 0xB8,
+        0xEF, 0xC5, 0x80, 0x10, 0x06, 0x00, 0x88, 0x02, 0xE1, 0xF3, 0xFC, 0x52, 0x7E, 0x3E, 0x3F, 0x1C,
+        0x4F, 0xEF, 0x65, 0x80, 0x92, 0x05, 0x81, 0xA0, 0x07, 0x00, 0x88, 0x02, 0x80, 0x71, 0x4E, 0x0F,
+        0x75, 0x9F, 0x52, 0x5C, 0xD4, 0xEA, 0x48, 0xDB, 0xF3, 0x66, 0xB2, 0xF3, 0x66, 0xC1, 0x18, 0xD1,
+        0xCB, 0x36, 0x20, 0xCD, 0x06, 0x53, 0xBC, 0xE5, 0x60, 0x68, 0xC6, 0x34, 0x72, 0xC6, 0xE0, 0x76,
+        0x92, 0xCE, 0xB5, 0xA8, 0x42, 0xC9, 0xBC, 0xEE, 0x22, 0x4E, 0xE0, 0x6F, 0xBD, 0xCB, 0x5A, 0x89,
+        0x06, 0x96, 0xA2, 0xD3, 0xBC, 0x1B, 0x15, 0xE6, 0xC2, 0xE5, 0x8A, 0x0B, 0xCE, 0xE1, 0x48, 0xB1,
+        0x2E, 0x01, 0xCD, 0x5A, 0x4D, 0x2B, 0x0C, 0xDE, 0x77, 0x2E, 0x5C, 0x77, 0x96, 0x20, 0xA4, 0xB9,
+        0x49, 0x63, 0x1B, 0x88, 0x84, 0xEF, 0x17, 0x9A, 0xC6, 0x31, 0x09, 0xA4, 0x1B, 0xEF, 0x7D, 0xE0,
+        0x8B, 0x12, 0x22, 0xE5, 0xCD, 0x82, 0xE2, 0x28, 0x79, 0xEE, 0x57, 0x1C, 0x26, 0x4C, 0xFA, 0xCD,
+        0x73, 0x49, 0xF1, 0x95, 0xDF, 0x4C, 0x10, 0x00, 0x21, 0xA0, 0x44, 0x3F, 0xFF, 0xFE, 0xE0, 0x02,
+        0xBF, 0xB9, 0xA7, 0xFA, 0x79, 0x7A, 0x83, 0xFF, 0x8C, 0xBE, 0x5A, 0x28, 0x74, 0x01, 0xC0, 0x4A,
+        0x01, 0x80, 0x0A, 0x00, 0x60, 0x00, 0x01, 0xC0, 0x02, 0x01, 0x00, 0x1E, 0x5A, 0xBE, 0x8A, 0x8C,
+        0xE1, 0xE1, 0x34, 0xF0, 0x06, 0x46, 0x5F, 0x1C, 0x18, 0x72, 0xE2, 0x27, 0x2F, 0x2E, 0x27, 0x8B,
+        0x23, 0x38, 0x3B, 0xCB, 0x31, 0xE6, 0xC3, 0x09, 0x2C, 0x1C, 0x19, 0x9B, 0xC8, 0xC0, 0x30, 0x81,
+        0x63, 0x7B, 0x9E, 0x3C, 0x81, 0xF3, 0x72, 0x6F, 0x08, 0x12, 0xF1, 0xC4, 0x60, 0xF1, 0x83, 0x24,
+        0x63, 0x30, 0x59, 0x78, 0xC0, 0xCB, 0x8C, 0x8C, 0x10, 0x31, 0x83, 0xE5, 0x32, 0x93, 0x01, 0x36,
+        0xBD, 0x3D, 0xDE, 0x01, 0xC6, 0x12, 0xCC, 0x72, 0xC7, 0x25, 0x1C, 0x64, 0x71, 0x96, 0x63, 0x9D,
+        0xE0, 0x38, 0xB9, 0x79, 0x70, 0xB8, 0xE4, 0xB0, 0x5E, 0x6F, 0x8A, 0xCC, 0x79, 0x56, 0x7E, 0x40,
+        0x14, 0x04, 0x0B, 0x04, 0x00, 0x80, 0x00, 0xC0, 0x68, 0x20, 0x26, 0x10, 0x02, 0x03, 0x82, 0x60,
+        0x5F, 0xFF, 0xF7, 0x2D, 0xFF, 0x10, 0x1F, 0x8E, 0x0F, 0xC6, 0x53, 0xFB, 0xB1, 0x5F, 0xF9, 0x00,
+        0x40, 0xC0, 0x03, 0x80, 0x44, 0x01, 0x40, 0x30, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3C, 0x02, 0x0B,
+        0x7F, 0x19, 0x56, 0xF1, 0x7C, 0x6E, 0x24, 0xE2, 0xE0, 0x5A, 0xBE, 0x76, 0x50, 0x79, 0xEF, 0x3B,
+        0x04, 0x0D, 0xCA, 0x66, 0xCD, 0xCB, 0x8D, 0x11, 0x85, 0xCE, 0xF3, 0x64, 0xAB, 0x01, 0x12, 0x99,
+        0x66, 0xC2, 0xE5, 0xCD, 0x12, 0x29, 0x2B, 0x18, 0xDC, 0xB0, 0x24, 0x39, 0xEF, 0x9A, 0x38, 0x34,
+        0xDC, 0xB2, 0x97, 0xBB, 0x0B, 0x63, 0x95, 0xCA, 0x0C, 0x58, 0x2B, 0x9B, 0x06, 0x15, 0xC5, 0xCE,
+        0x8E, 0x17, 0x37, 0x9B, 0x94, 0x8A, 0xE2, 0x2C, 0xB1, 0x33, 0xB8, 0x92, 0xCA, 0x00, 0x3B, 0xDD,
+        0xEE, 0xBD, 0xC0, 0x0A, 0xF5, 0x2D, 0x7B, 0x94, 0x32, 0x1B, 0x8B, 0x97, 0x3B, 0x8C, 0x11, 0x9B,
+        0x8B, 0x97, 0x36, 0x00, 0xA8, 0xF9, 0xB0, 0xEF, 0x94, 0x18, 0xBC, 0xD8, 0x4E, 0x1D, 0x4C, 0x49,
+        0xC4, 0xC3, 0x0C, 0x68, 0xAE, 0xB7, 0x10, 0xF5, 0xB8, 0x91, 0xC5, 0xD7, 0x3A, 0x80, 0x58, 0x30,
+        0x08, 0x04, 0x05, 0x80, 0x8D, 0x3F, 0xFA, 0x38, 0x02, 0xBF, 0xE6, 0xB1, 0xFB, 0x89, 0x7C, 0x93,
+        0xFF, 0xAF, 0xBD, 0xBC, 0xCF, 0xD0, 0x11, 0x40, 0x2C, 0x04, 0x00, 0x20, 0x01, 0xC0, 0x00, 0x01,
+        0x40, 0x04, 0x04, 0x00, 0x0C, 0xB5, 0xCD, 0x11, 0xC3, 0x57, 0x4A, 0x22, 0xE9, 0x8E, 0x19, 0x37,
+        0xCB, 0x90, 0x9B, 0xC3, 0xCD, 0x18, 0x3E, 0x30, 0x71, 0xF2, 0xC7, 0x01, 0x39, 0xBC, 0x5F, 0x2E,
+        0x5E, 0x24, 0xC4, 0x59, 0x84, 0x63, 0xCB, 0x93, 0x7C, 0xDF, 0x04, 0xB8, 0xF3, 0x73, 0x2E, 0x32,
+        0x00, 0x39, 0x78, 0xC2, 0xF8, 0xC7, 0x17, 0xCA, 0x32, 0x30, 0x99, 0x47, 0xC6, 0x30, 0x19, 0x12,
+        0x06, 0x30, 0x66, 0x5F, 0x07, 0xBC, 0xDF, 0x07, 0x37, 0x21, 0x06, 0x00, 0xF5, 0x97, 0x83, 0x3D,
+        0x43, 0x8E, 0x5F, 0x34, 0x92, 0x05, 0x98, 0x0C, 0x62, 0x61, 0xCF, 0x70, 0xC0, 0x9A, 0x38, 0x60,
+        0xCB, 0x98, 0x36, 0x4C, 0x08, 0x2E, 0x7C, 0x4E, 0x9C, 0x91, 0xC3, 0xE3, 0xDB, 0x16, 0x0B, 0x7A,
+        0xB7, 0xFF, 0x3E, 0xDE, 0xFB, 0xBF, 0x92, 0xA7, 0xF1, 0xEA, 0x90, 0xD1, 0xE7, 0x83, 0xE0, 0x00,
+        0x00, 0x90, 0x01, 0x80, 0x20, 0x08, 0x80, 0x00, 0x03, 0x11, 0xD7, 0x38, 0xE6, 0x84, 0x2E, 0xF0,
+        0xE1, 0xA2, 0x3B, 0x97, 0x8D, 0x37, 0x18, 0x51, 0x82, 0x34, 0x9B, 0xE6, 0x94, 0xCB, 0x2A, 0x31,
+        0x97, 0x34, 0x60, 0xB2, 0xB0, 0x73, 0xB9, 0xB8, 0xB9, 0xDC, 0x46, 0x50, 0x40, 0x59, 0x72, 0x86,
+        0xF9, 0xB0, 0x1A, 0x31, 0x8A, 0x39, 0x73, 0x5E, 0x0F, 0x70, 0xA4, 0x58, 0x85, 0xCB, 0x81, 0xF3,
+        0x45, 0x6D, 0xC9, 0x78, 0x2A, 0xD6, 0x93, 0xBD, 0x6E, 0x02, 0xF7, 0x09, 0xB8, 0xDC, 0x10, 0x9B,
+        0x22, 0x53, 0x2E, 0x6C, 0x02, 0xD3, 0xBD, 0x27, 0xBE, 0x68, 0x2C, 0x42, 0x56, 0x38, 0xA5, 0xC1,
+        0xB8, 0x6E, 0x24, 0xA0, 0x05, 0xC1, 0xB1, 0x93, 0x48, 0xE5, 0x2E, 0x08, 0xC5, 0x97, 0x9B, 0x12,
+        0x20, 0x51, 0x84, 0x37, 0x2C, 0x70, 0xEC, 0x82, 0x0D, 0xF7, 0xAF, 0x5C, 0xC4, 0xB1, 0x4E, 0xAE,
+        0xAC, 0x43, 0xD4, 0xB9, 0x1E, 0x33, 0xA8, 0x0A, 0x82, 0x00, 0xE0, 0xC0, 0x20, 0x39, 0x23, 0xFF,
+        0xE3, 0xE0, 0x02, 0xBF, 0xDB, 0x93, 0xF8, 0xDB, 0x7A, 0x5D, 0xFF, 0x73, 0xBC, 0x6F, 0x50, 0x18,
+        0x02, 0x00, 0x7C, 0x05, 0x00, 0x1C, 0x03, 0xC0, 0x28, 0x01, 0x80, 0x10, 0x02, 0x00, 0x3C, 0xB5,
+        0x38, 0x42, 0xB7, 0x83, 0x85, 0x35, 0x38, 0x63, 0xC2, 0x37, 0xE3, 0x88, 0x1F, 0x36, 0x04, 0x29,
+        0xD3, 0x15, 0x38, 0x0A, 0x68, 0xAA, 0x1D, 0xE2, 0xE1, 0xCD, 0xE5, 0x98, 0xC6, 0x0C, 0xC4, 0x8E,
+        0x39, 0x37, 0x8F, 0x2C, 0x1C, 0xDE, 0x38, 0xE3, 0x1C, 0x89, 0x20, 0xB8, 0x32, 0x3E, 0x52, 0x5E,
+        0x00, 0x38, 0x38, 0xCB, 0x98, 0xC7, 0x2C, 0xC1, 0x79, 0xB0, 0x84, 0x89, 0x0C, 0xB8, 0x37, 0x20,
+        0x38, 0xE3, 0x26, 0xF0, 0xC1, 0xB1, 0x98, 0xC6, 0x07, 0x2C, 0xDE, 0x0E, 0x31, 0x89, 0x90, 0xB2,
+        0x19, 0x47, 0x2C, 0xC7, 0x37, 0x94, 0xF1, 0x37, 0x02, 0x84, 0x56, 0x74, 0xFA, 0xB9, 0x57, 0xF5,
+        0xBE, 0xB9, 0xB0, 0x07, 0x00, 0x10, 0x57, 0xD4, 0x57, 0xF9, 0x75, 0xF7, 0x55, 0xFC, 0x5F, 0x3F,
+        0x87, 0xA4, 0x7C, 0x0F, 0x14, 0x1F, 0x80, 0x08, 0x03, 0x80, 0x04, 0x01, 0x00, 0x4C, 0x95, 0x1D,
+        0x6E, 0x33, 0x08, 0x2C, 0xA3, 0x04, 0x46, 0x92, 0x56, 0x77, 0x97, 0x0D, 0x05, 0xCB, 0x2C, 0xA6,
+        0x51, 0x60, 0x88, 0xAF, 0x3B, 0x94, 0x96, 0x25, 0xC1, 0x59, 0x65, 0x97, 0x1A, 0x19, 0x41, 0xB0,
+        0xB8, 0xD8, 0xC4, 0x29, 0x05, 0x1C, 0xEE, 0x05, 0x94, 0xE6, 0x80, 0xDC, 0x59, 0x72, 0x8C, 0xB8,
+        0xDC, 0x11, 0xB2, 0x6F, 0x36, 0x5C, 0x5C, 0xD8, 0x13, 0x73, 0x57, 0xAE, 0x35, 0x06, 0xED, 0x6B,
+        0x70, 0xD7, 0x60, 0x59, 0xC6, 0x76, 0x8B, 0x70, 0x7A, 0x9A, 0xB4, 0x1D, 0xA1, 0x22, 0xE5, 0x22,
+        0xB8, 0xCA, 0x08, 0xE5, 0xCA, 0x5E, 0x6C, 0x9B, 0x82, 0x32, 0xE6, 0xE3, 0x15, 0x91, 0x2E, 0x09,
+        0x72, 0xC5, 0xE6, 0xC4, 0x22, 0x0D, 0x92, 0xE5, 0x8C, 0xB1, 0xCE, 0xE0, 0x20, 0xCD, 0xE5, 0x93,
+        0x43, 0x2C, 0x07, 0x7C, 0xD8, 0x0D, 0xE6, 0xFC, 0xE8, 0xBE, 0x13, 0x8B, 0x08, 0xE2, 0x56, 0xF1,
+        0x4E, 0xB9, 0xC4, 0x02, 0x41, 0x40, 0x40, 0x10, 0x1C, 0x08, 0x6B, 0xFF, 0xCF, 0xC0, 0x02, 0xBF,
+        0x63, 0x6F, 0xF5, 0x12, 0xCE, 0x27, 0xFC, 0x3E, 0xF9, 0x9E, 0x96, 0xD0, 0x5E, 0x02, 0x68, 0x0F,
+        0x00, 0x28, 0x01, 0x80, 0x28, 0x01, 0x00, 0x08, 0x07, 0x00, 0x19, 0x45, 0x8C, 0x4F, 0x8D, 0xE3,
+        0x35, 0x02, 0xB3, 0x86, 0x33, 0xE6, 0xC6, 0x49, 0x96, 0x39, 0x08, 0x37, 0xCB, 0x24, 0x1E, 0x5C,
+        0x97, 0x0E, 0x0F, 0x7E, 0x37, 0x9B, 0xF1, 0x8B, 0xC2, 0x08, 0xE3, 0x8E, 0x4D, 0xE1, 0x1C, 0x61,
+        0x06, 0x31, 0xC2, 0x0F, 0x2E, 0x46, 0x23, 0x09, 0x2F, 0x1C, 0x4C, 0xB8, 0x40, 0x62, 0x43, 0x8D,
+        0xC3, 0x13, 0x2E, 0x0B, 0x80, 0x12, 0x4B, 0x97, 0x23, 0xC1, 0xD9, 0x97, 0x8C, 0x5F, 0x2C, 0x85,
+        0x83, 0x86, 0x77, 0x09, 0x9B, 0xCD, 0xF1, 0x88, 0x31, 0xE5, 0xC5, 0xCB, 0xF2, 0x83, 0x81, 0x54,
+        0x82, 0x3A, 0x95, 0x9A, 0x4A, 0xA4, 0x6E, 0xC0, 0x28, 0x02, 0x80, 0x28, 0x04, 0x40, 0x1F, 0x02,
+        0xBF, 0xDA, 0x9F, 0xDF, 0xEF, 0xDF, 0x4B, 0xFA, 0x60, 0x5D, 0x40, 0xF5, 0x40, 0xB8, 0x03, 0x80,
+        0x3C, 0x01, 0x4B, 0x41, 0x2E, 0xEA, 0xFC, 0x49, 0x91, 0x17, 0xAB, 0x11, 0x79, 0xB0, 0xD9, 0x79,
+        0x4A, 0x41, 0x73, 0xB9, 0xA4, 0x96, 0xE2, 0x2E, 0x0E, 0xC1, 0x9B, 0x9B, 0x97, 0x14, 0x60, 0xAC,
+        0xA1, 0x2C, 0xB0, 0xB1, 0x46, 0x31, 0x29, 0x96, 0x58, 0x85, 0x1C, 0xB2, 0xC4, 0x8D, 0xC5, 0x04,
+        0x34, 0xAC, 0x77, 0xB9, 0x7A, 0x83, 0xBD, 0x6E, 0xF7, 0x10, 0x50, 0xC1, 0x94, 0x88, 0x33, 0x7C,
+        0xEE, 0x07, 0x34, 0xBD, 0xCB, 0x2B, 0x61, 0xAE, 0x52, 0x58, 0xCD, 0xE2, 0xCA, 0x0F, 0x72, 0xD3,
+        0x4E, 0xF7, 0x60, 0xDC, 0x44, 0xCD, 0x21, 0x71, 0x51, 0xC6, 0x36, 0x67, 0x7C, 0xEE, 0x24, 0x51,
+        0x72, 0xE5, 0xCA, 0xC6, 0x08, 0x51, 0xC1, 0x18, 0xE6, 0xC6, 0x39, 0x41, 0x49, 0x71, 0x63, 0x19,
+        0x4C, 0xA2, 0x02, 0xE3, 0x12, 0x6F, 0x1A, 0x0E, 0x20, 0x23, 0xCE, 0xF3, 0x61, 0x11, 0x27, 0x78,
+        0x0D, 0xCB, 0x83, 0x9F, 0x7E, 0x14, 0xE0, 0xDC, 0x4E, 0xAF, 0x0E, 0x43, 0xF1, 0x69, 0xC2, 0xC0,
+        0x00, 0x02, 0x02, 0x02, 0x20, 0xBF, 0xFC, 0x70, 0x02, 0xB8, 0x18, 0x7F, 0xDB, 0x73, 0x42, 0x2F,
+        0xDD, 0x5F, 0xF2, 0x17, 0x58, 0x33, 0x04, 0x09, 0x70, 0x2E, 0x00, 0x00, 0x10, 0x01, 0x30, 0x0A,
+        0x00, 0x70, 0x06, 0x00, 0x62, 0x55, 0xCD, 0x3E, 0x14, 0xEB, 0x78, 0x14, 0x42, 0x27, 0x89, 0xE2,
+        0x44, 0x4F, 0x13, 0x45, 0xE1, 0xD0, 0x89, 0x38, 0x0C, 0x26, 0x5C, 0x70, 0x5C, 0x97, 0x19, 0x8F,
+        0x36, 0x43, 0x11, 0xCD, 0xE1, 0x22, 0x42, 0x41, 0xE5, 0x1E, 0x5C, 0x18, 0x71, 0x25, 0xE1, 0x11,
+        0xCB, 0x32, 0x25, 0xF8, 0x84, 0xB9, 0xC1, 0xDC, 0x1C, 0x78, 0x81, 0x8C, 0x70, 0x59, 0x0C, 0xD9,
+        0x0E, 0x6C, 0x21, 0x80, 0xEC, 0xFD, 0x0D, 0x7E, 0xB7, 0x0B, 0x0E, 0x09, 0x89, 0xEA, 0x54, 0xC2,
+        0x7D, 0x64, 0xAB, 0x78, 0xC3, 0x8C, 0xEA, 0xF1, 0x0F, 0x1E, 0x78, 0x76, 0x01, 0xC0, 0x5C, 0x2F,
+        0xFC, 0xAD, 0x7F, 0x9C, 0xFE, 0x63, 0x7F, 0xC0, 0x13, 0xF1, 0x86, 0x51, 0x82, 0xFF, 0x0A, 0x00,
+        0x23, 0x00, 0x00, 0x11, 0x00, 0xC0, 0x05, 0x2F, 0x19, 0x91, 0x7D, 0x4C, 0x4B, 0x06, 0x9A, 0xB1,
+        0x92, 0xE6, 0xF3, 0xA6, 0x59, 0xB9, 0x60, 0x23, 0xB8, 0xC2, 0xA6, 0x50, 0xB0, 0x6E, 0x16, 0x5C,
+        0xD8, 0x05, 0x22, 0x11, 0x67, 0x6B, 0x71, 0xA8, 0x37, 0x6A, 0x69, 0x0E, 0xF4, 0x2B, 0x94, 0xCE,
+        0xE2, 0x30, 0xA4, 0x14, 0x65, 0xCD, 0xC3, 0x79, 0xB2, 0x50, 0x02, 0xB5, 0xBB, 0xDD, 0x60, 0x21,
+        0xDE, 0x96, 0xAD, 0x02, 0x32, 0xE6, 0xE2, 0xE5, 0x09, 0xB8, 0x11, 0x67, 0x34, 0x6E, 0x41, 0x88,
+        0xB5, 0xAB, 0xDC, 0x01, 0x6A, 0xD6, 0x73, 0xDC, 0xC1, 0x11, 0xA7, 0x7B, 0xB1, 0x05, 0xEA, 0xD0,
+        0x5A, 0xDD, 0x85, 0x85, 0x8C, 0x2C, 0x09, 0xBC, 0xD1, 0x84, 0x6E, 0x5C, 0xB9, 0x62, 0x4A, 0x1A,
+        0x34, 0x77, 0x87, 0xDF, 0xA1, 0x73, 0x72, 0xC9, 0x65, 0xE7, 0x70, 0x88, 0x77, 0xAD, 0x23, 0x25,
+        0x78, 0x42, 0x91, 0xE5, 0x4B, 0xE6, 0xF3, 0xB8, 0x4D, 0x63, 0x35, 0x98, 0x83, 0x5B, 0xC6, 0x63,
+        0x4C, 0xCA, 0xF4, 0x7B, 0x21, 0x7F, 0xE0, 0x02, 0xB7, 0x0C, 0xFF, 0x97, 0x97, 0x18, 0x4F, 0xCD,
+        0xB7, 0xF4, 0xB5, 0x78, 0xB3, 0x74, 0x07, 0xD0, 0x14, 0x00, 0x70, 0x06, 0x00, 0xF0, 0x0E, 0x00,
+        0x10, 0x0A, 0x00, 0x02, 0x9A, 0xDF, 0x87, 0x4A, 0xE0, 0xF1, 0x30, 0x2F, 0x42, 0xF9, 0x65, 0x9F,
+        0x37, 0x06, 0x1C, 0x60, 0xB2, 0x18, 0xC6, 0x63, 0xE7, 0xBC, 0x01, 0xE5, 0xCB, 0x87, 0x29, 0x97,
+        0x97, 0xC5, 0x28, 0x78, 0x26, 0xAF, 0x4D, 0x41, 0x2A, 0x10, 0xB1, 0xCB, 0xF3, 0x60, 0x63, 0xE7,
+        0x70, 0x13, 0x97, 0x2C, 0x8F, 0x97, 0x29, 0x84, 0x17, 0x13, 0x97, 0x17, 0x20, 0x0F, 0x05, 0x92,
+        0xE3, 0x84, 0x5E, 0x5E, 0x08, 0x86, 0x3C, 0x6E, 0x5F, 0x97, 0x9D, 0x90, 0x39, 0x45, 0x9D, 0x20,
+        0x2D, 0x5A, 0x45, 0xA4, 0x69, 0x8D, 0x80, 0x70, 0x01, 0x80, 0x70, 0x17, 0x0B, 0xEF, 0x26, 0x7F,
+        0xE5, 0xE7, 0x97, 0x0F, 0xEE, 0xC5, 0xF8, 0x7A, 0x28, 0x51, 0x7A, 0x84, 0xE0, 0x0F, 0x80, 0x18,
+        0x06, 0x96, 0x9F, 0x16, 0xDB, 0xEB, 0x35, 0x60, 0x1A, 0xB1, 0xF3, 0xF7, 0x80, 0x59, 0x63, 0x0D,
+        0xCE, 0x8E, 0x65, 0x37, 0x18, 0x6C, 0x60, 0x83, 0x65, 0xE5, 0x73, 0xB8, 0x4D, 0x85, 0x80, 0x96,
+        0x87, 0x6B, 0x57, 0x87, 0xB9, 0x1B, 0x0B, 0x88, 0xB0, 0x46, 0x59, 0x63, 0x17, 0x3B, 0xE5, 0x66,
+        0x87, 0xAC, 0xE6, 0x96, 0xEC, 0x70, 0xE3, 0x64, 0x50, 0x26, 0xE2, 0x22, 0x12, 0xCB, 0x09, 0xBC,
+        0xB7, 0x04, 0x2D, 0x6B, 0x70, 0x2D, 0x43, 0x2E, 0x16, 0x39, 0xD9, 0x96, 0x20, 0x25, 0x92, 0xCB,
+        0x25, 0x8C, 0x40, 0x44, 0x96, 0x17, 0x2E, 0x58, 0x90, 0x3E, 0xFD, 0x40, 0x76, 0xB6, 0xE1, 0x72,
+        0xE5, 0x89, 0x37, 0x26, 0xC0, 0x0B, 0x26, 0xE6, 0x9B, 0xB2, 0x10, 0x97, 0x16, 0x5C, 0x65, 0x96,
+        0x06, 0x91, 0xEE, 0x2C, 0xB4, 0x2F, 0x36, 0x05, 0xCB, 0x85, 0x1C, 0x01, 0x5A, 0xF7, 0x5A, 0xC1,
+        0xC3, 0x25, 0x8C, 0x2F, 0x2B, 0x9B, 0x8E, 0x0D, 0x07, 0x94, 0x48, 0x0C, 0xDC, 0x18, 0xCA, 0x07,
+        0x37, 0x3E, 0xF8, 0x64, 0xF4, 0xDA, 0xB8, 0x26, 0x18, 0xE3, 0xF2, 0x02, 0xBA, 0xE3, 0x7F, 0xC1,
+        0x33, 0x2C, 0x6F, 0xDB, 0x8F, 0xF0, 0x99, 0x50, 0x52, 0xEE, 0x09, 0x70, 0x22, 0x00, 0x60, 0x0A,
+        0x00, 0x90, 0x08, 0x00, 0xD0, 0x0A, 0x00, 0x42, 0x55, 0x98, 0x7A, 0x02, 0xB3, 0x83, 0x40, 0xD0,
+        0xFB, 0xF0, 0xC6, 0x17, 0xE5, 0xC1, 0x87, 0x04, 0x9B, 0x98, 0xE0, 0xC3, 0x8C, 0x60, 0xC2, 0x44,
+        0x99, 0x7C, 0xDC, 0x72, 0x51, 0xF3, 0xBC, 0x78, 0x5C, 0x70, 0x39, 0xB8, 0x8E, 0x10, 0x64, 0x31,
+        0x97, 0xCB, 0x80, 0xB9, 0x7E, 0x51, 0x98, 0xE0, 0x27, 0x83, 0x71, 0x03, 0xCB, 0x2E, 0x47, 0x00,
+        0x6E, 0x61, 0x36, 0x1C, 0x03, 0x7E, 0x5E, 0x11, 0x2A, 0x74, 0x60, 0x5C, 0x3F, 0x5B, 0xA9, 0x76,
+        0x00, 0x40, 0x08, 0x02, 0x40, 0x16, 0x02, 0xE0, 0x4C, 0x5C, 0x7D, 0xDF, 0x7F, 0x92, 0x2B, 0xBF,
+        0xFF, 0x3B, 0x4F, 0x90, 0x20, 0xC5, 0x12, 0xB8, 0x47, 0x00, 0xB9, 0x7D, 0x5F, 0x5E, 0xE1, 0xC2,
+        0x11, 0xCD, 0x3A, 0x24, 0x95, 0xD4, 0xE2, 0x4C, 0x5E, 0x18, 0x68, 0x58, 0xFC, 0x6A, 0x65, 0x96,
+        0x57, 0x96, 0x51, 0x60, 0x5C, 0xAE, 0x59, 0x72, 0xBC, 0x0E, 0xA6, 0xBD, 0xF0, 0xB4, 0x80, 0x5E,
+        0xFB, 0x5A, 0x5B, 0xB0, 0x2B, 0xDC, 0x6A, 0xB6, 0xED, 0x02, 0xD2, 0xF7, 0x3B, 0xD2, 0xC8, 0x37,
+        0x59, 0xA8, 0xB2, 0xB0, 0xA0, 0x21, 0x9D, 0xE6, 0xC8, 0xB0, 0x3B, 0x5E, 0xE5, 0xEA, 0x13, 0x0D,
+        0xC5, 0x97, 0x2C, 0x10, 0x18, 0x28, 0xC2, 0xE5, 0x92, 0x8E, 0x58, 0x10, 0x2D, 0xDA, 0xCA, 0xF0,
+        0x73, 0x3B, 0x5B, 0x7D, 0x82, 0x12, 0x5C, 0xB1, 0x71, 0x72, 0xC4, 0x02, 0xD6, 0xAF, 0x73, 0x3B,
+        0x02, 0x7B, 0xB5, 0x64, 0xD2, 0xC1, 0x65, 0x6B, 0x5B, 0xB6, 0x90, 0x69, 0xEE, 0xB1, 0x69, 0x7A,
+        0x03, 0xBD, 0x68, 0xBD, 0xCD, 0x41, 0xB4, 0x87, 0xB9, 0xDE, 0x02, 0xB2, 0x16, 0x5C, 0x62, 0xCD,
+        0xF0, 0x45, 0x63, 0xCA, 0x24, 0x72, 0x84, 0xD5, 0x35, 0x74, 0x46, 0x33, 0x17, 0x14, 0x50, 0xCF,
+        0x53, 0x64, 0x10, 0x3E, 0xA0, 0x02, 0xBD, 0xB2, 0xBF, 0xCD, 0x3A, 0x50, 0xDF, 0xC8, 0x7F, 0xE6,
+        0xD6, 0x45, 0x65, 0x14, 0x15, 0xA0, 0x28, 0x01, 0x60, 0x18, 0x01, 0x20, 0x28, 0x00, 0xE0, 0x08,
+        0x00, 0xE4, 0xA0, 0x71, 0xBC, 0x5C, 0x50, 0xAC, 0xD1, 0x88, 0x17, 0x36, 0x66, 0x4D, 0xC7, 0x24,
+        0x18, 0x26, 0x40, 0x70, 0xC8, 0x8F, 0x97, 0x83, 0x64, 0xBF, 0x2E, 0x53, 0x84, 0x72, 0xC1, 0xE3,
+        0x2C, 0x87, 0x1C, 0xDC, 0x26, 0x68, 0xE3, 0xC0, 0x96, 0x4C, 0x2F, 0x37, 0x90, 0x41, 0xCB, 0xE3,
+        0x12, 0x18, 0xC8, 0x53, 0x83, 0x52, 0x81, 0xE2, 0xF1, 0x98, 0x83, 0x82, 0xBA, 0x98, 0xA7, 0xAD,
+        0xD3, 0x8C, 0x3C, 0x7B, 0xE2, 0xC0, 0x04, 0x03, 0x00, 0xC0, 0x5E, 0x78, 0xF5, 0xFF, 0x1E, 0x3C,
+        0xA2, 0xFF, 0x66, 0x2F, 0xC0, 0x51, 0x3D, 0x0B, 0xA4, 0x27, 0x00, 0x8C, 0x00, 0x00, 0x3C, 0x02,
+        0x89, 0xF5, 0x92, 0xDE, 0x9A, 0x32, 0x8D, 0x4A, 0x1A, 0xC7, 0x13, 0xB3, 0x94, 0xB0, 0xA3, 0x97,
+        0x34, 0x82, 0xC4, 0x61, 0x43, 0x4D, 0xDB, 0xB0, 0xEB, 0xCE, 0x0F, 0x75, 0xAC, 0x91, 0xB8, 0x0B,
+        0xDC, 0x26, 0xAD, 0x4C, 0x11, 0x69, 0x6E, 0xDA, 0xEC, 0x17, 0x2B, 0x18, 0x85, 0xC6, 0x14, 0x37,
+        0x63, 0x7F, 0x7E, 0x95, 0x80, 0x4D, 0xCD, 0x6E, 0xD0, 0x42, 0x4B, 0x94, 0x97, 0x29, 0x12, 0x21,
+        0x69, 0x32, 0xB6, 0xE3, 0x07, 0x3D, 0xC2, 0xD6, 0x8B, 0x09, 0x64, 0xB1, 0x25, 0x8E, 0x52, 0x0A,
+        0xC1, 0x8B, 0x89, 0x72, 0xE2, 0x09, 0xA6, 0xED, 0x68, 0x01, 0xDE, 0xB7, 0x6B, 0x2B, 0xD0, 0x2C,
+        0x40, 0x9B, 0xC5, 0x64, 0xB0, 0x44, 0x97, 0x0B, 0x18, 0x99, 0xB8, 0x36, 0x4A, 0x06, 0x52, 0xE3,
+        0x04, 0x62, 0x32, 0x6E, 0x5C, 0x2E, 0x58, 0x89, 0x96, 0x6F, 0x12, 0x50, 0x8C, 0x44, 0x1C, 0x59,
+        0x71, 0x97, 0x37, 0x20, 0xAC, 0x65, 0xE6, 0xE5, 0xCA, 0x65, 0xC1, 0xEF, 0x18, 0x6C, 0x39, 0x59,
+        0xDF, 0x18, 0x44, 0xA7, 0x4E, 0x24, 0xC3, 0xEB, 0x9A, 0xB2, 0xA4, 0x06, 0x61, 0xE0, 0x2A, 0x6F,
+        0xFD, 0xA0, 0x02, 0xBD, 0x25, 0xBF, 0xC8, 0x52, 0xED, 0x5F, 0xBD, 0x7F, 0xD8, 0x74, 0xED, 0x4B,
+        0x30, 0x29, 0xC0, 0x38, 0x00, 0x00, 0x58, 0x01, 0x40, 0x28, 0x03, 0xC0, 0x18, 0x00, 0x88, 0xF5,
+        0x9D, 0x6F, 0x02, 0x2B, 0x30, 0x21, 0x24, 0x53, 0x4E, 0xA1, 0xC3, 0x84, 0xA2, 0x61, 0xE0, 0x5C,
+        0x9B, 0xCB, 0xE3, 0x19, 0x97, 0xCB, 0x08, 0xAA, 0x75, 0x30, 0x9E, 0xA6, 0x98, 0x84, 0x23, 0x8E,
+        0x39, 0x29, 0x38, 0xBC, 0xE9, 0x60, 0x28, 0xCD, 0x1C, 0x14, 0x1C, 0x1D, 0x48, 0xC2, 0xF8, 0xF9,
+        0xAC, 0x3C, 0x66, 0xE0, 0x4A, 0xA6, 0xAE, 0x28, 0xE3, 0x35, 0x31, 0xC4, 0xC5, 0x80, 0x78, 0x06,
+        0x00, 0x08, 0x06, 0x01, 0x70, 0xB9, 0xF1, 0xC5, 0xFE, 0x31, 0x39, 0x37, 0xFE, 0xC2, 0x1F, 0x7C,
+        0xA4, 0xE8, 0x2E, 0x30, 0x9C, 0x02, 0x50, 0x02, 0x2E, 0xF4, 0xFA, 0x9C, 0xA9, 0xE2, 0xF1, 0x94,
+        0xC6, 0x07, 0xB2, 0x92, 0xF9, 0xEE, 0x53, 0x2E, 0x68, 0x25, 0xE2, 0x52, 0x33, 0x72, 0xC1, 0x1C,
+        0xEE, 0x5C, 0x2C, 0xB9, 0x62, 0x08, 0xC6, 0x37, 0x2E, 0x28, 0xE5, 0x88, 0xB2, 0xF3, 0x73, 0x70,
+        0xA6, 0x59, 0x60, 0x42, 0x6A, 0xD6, 0xEF, 0x70, 0x16, 0x41, 0x37, 0x6E, 0xFC, 0x1F, 0x68, 0xD1,
+        0x6E, 0xCD, 0xF0, 0x7A, 0x26, 0xED, 0xB8, 0x01, 0xDB, 0x56, 0x45, 0xA6, 0x82, 0xD6, 0x85, 0xBB,
+        0x6E, 0xD0, 0x6E, 0xF7, 0x6B, 0x42, 0xD0, 0x31, 0xB8, 0x21, 0x2C, 0x5C, 0x60, 0x73, 0x4D, 0x2C,
+        0xEC, 0x60, 0xA1, 0x79, 0xCD, 0x5B, 0x70, 0x69, 0xEE, 0x77, 0x8B, 0x56, 0xC2, 0xB2, 0xE3, 0x2E,
+        0x58, 0xE5, 0x60, 0x93, 0x79, 0xDC, 0xCD, 0xE5, 0x2E, 0x05, 0x1C, 0x65, 0xC5, 0x8C, 0x16, 0x08,
+        0xE5, 0xCA, 0x04, 0xDE, 0x6F, 0x16, 0x21, 0x66, 0xED, 0x35, 0xAD, 0xCC, 0x32, 0xC6, 0x31, 0x71,
+        0x72, 0xC4, 0x0C, 0x8B, 0x16, 0xB0, 0x51, 0x91, 0x2E, 0x30, 0xB9, 0x60, 0x91, 0x47, 0x96, 0x2C,
+        0x79, 0xB8, 0x36, 0xF9, 0x72, 0xA5, 0xFC, 0xDC, 0xE9, 0x04, 0x62, 0xC5, 0x1B, 0x94, 0x3F, 0xF4,
+        0x00, 0x02, 0xBF, 0x9F, 0x47, 0xEE, 0xD1, 0x3F, 0x3F, 0xEB, 0xE3, 0xD6, 0x9C, 0x92, 0x84, 0x90,
+        0x1C, 0x40, 0x68, 0x02, 0x40, 0x0C, 0x00, 0x00, 0x50, 0x01, 0x40, 0x20, 0x04, 0x4B, 0x41, 0x6B,
+        0x3A, 0xDE, 0x12, 0x89, 0x87, 0xA6, 0x33, 0x37, 0xCB, 0xC9, 0x61, 0x0E, 0x08, 0x27, 0x97, 0x12,
+        0x1F, 0x3B, 0x8C, 0x87, 0x07, 0x70, 0x79, 0x0B, 0xCB, 0x99, 0x71, 0x06, 0x64, 0xDE, 0x30, 0xC2,
+        0xF2, 0xF0, 0x09, 0x4E, 0x0C, 0x2B, 0xC4, 0xE9, 0xA5, 0x7A, 0x23, 0x82, 0x9F, 0x37, 0xCD, 0x94,
+        0xFF, 0x34, 0xDB, 0x00, 0x40, 0x02, 0x00, 0x20, 0x0A, 0x00, 0xD0, 0x08, 0x00, 0xF0, 0x0E, 0x00,
+        0x80, 0x08, 0x00, 0xD0, 0x09, 0xB9, 0xFF, 0xE7, 0x0F, 0xEB, 0x5F, 0xEB, 0x15, 0x5F, 0xFF, 0x94,
+        0xAE, 0x9C, 0x1D, 0x08, 0x30, 0x01, 0x40, 0x2C, 0x02, 0x80, 0x80, 0x04, 0x01, 0x00, 0x18, 0x0B,
+        0x01, 0x00, 0x1C, 0x07, 0x00, 0x51, 0x1F, 0x7F, 0x3B, 0xE6, 0xA3, 0xCA, 0x2C, 0x06, 0xFB, 0x3B,
+        0x11, 0x68, 0x37, 0x10, 0x66, 0xF2, 0xC4, 0x44, 0x36, 0xE2, 0xF7, 0x13, 0x40, 0x97, 0x2C, 0x65,
+        0x31, 0x58, 0x23, 0x10, 0xB8, 0x58, 0xCB, 0x25, 0x00, 0xB5, 0xAB, 0x1D, 0xA6, 0x0B, 0x71, 0xAB,
+        0x2D, 0x58, 0x37, 0x0B, 0x12, 0x2E, 0x52, 0x20, 0x16, 0xAC, 0xB7, 0x7A, 0x98, 0x25, 0xEA, 0x6A,
+        0xCB, 0x76, 0x05, 0x96, 0xEC, 0x4B, 0xD4, 0x1A, 0x1A, 0xB4, 0x2F, 0x40, 0xEC, 0x08, 0xDD, 0xAC,
+        0x08, 0x16, 0x9A, 0xDD, 0x86, 0xE3, 0x2E, 0x53, 0x28, 0x44, 0x05, 0xCD, 0x99, 0xB0, 0x01, 0x09,
+        0x47, 0x19, 0xB8, 0xC6, 0x50, 0xCA, 0x60, 0x73, 0x4B, 0x59, 0xBE, 0xC6, 0x1B, 0x06, 0x0C, 0xB9,
+        0x64, 0xB2, 0x87, 0xAD, 0x6E, 0xC4, 0xD1, 0xE1, 0xAC, 0x60, 0xC4, 0x79, 0xB0, 0x00, 0xB5, 0xBB,
+        0xC7, 0x6B, 0x02, 0xCB, 0xCB, 0x2C, 0x96, 0x4A, 0x18, 0x37, 0x3B, 0x91, 0x09, 0xB8, 0xC1, 0x84,
+        0xE1, 0xD1, 0x98, 0x78, 0x94, 0x4C, 0x4E, 0x8A, 0x4A, 0x74, 0xE9, 0xB2, 0xB5, 0x31, 0xDE, 0x1C,
+        0x00, 0x18, 0x08, 0x14, 0x14, 0x0D, 0x1F, 0xFC, 0x40, 0x02, 0xBD, 0x0A, 0xBF, 0xBC, 0x26, 0x4E,
+        0x5F, 0xAB, 0x2F, 0xDD, 0xB5, 0x3B, 0x4B, 0x68, 0x25, 0x40, 0xA0, 0x00, 0x00, 0x38, 0x02, 0xC0,
+        0x28, 0x03, 0xC0, 0x20, 0x02, 0x88, 0xEB, 0xCF, 0x13, 0x50, 0x22, 0xF1, 0x3C, 0x30, 0x89, 0xE0,
+        0xD1, 0x30, 0x68, 0x05, 0x3A, 0x9D, 0x0D, 0x8B, 0xF2, 0xE5, 0xE2, 0x72, 0xF1, 0x47, 0x1F, 0x2C,
+        0xBC, 0x24, 0xB8, 0xE4, 0x4A, 0xAE, 0x8D, 0x27, 0x17, 0xA3, 0x01, 0xA0, 0x3E, 0x59, 0x37, 0x97,
+        0xE1, 0x47, 0xC7, 0x12, 0x28, 0xF0, 0xD5, 0xAA, 0x1C, 0x77, 0xAE, 0xF8, 0xAB, 0x00, 0xC0, 0x0F,
+        0x00, 0xBB, 0xAF, 0xFE, 0x79, 0xBE, 0xB6, 0xFE, 0xBC, 0x1F, 0xC5, 0xBA, 0xCD, 0x47, 0x46, 0x06,
+        0x00, 0x18, 0x01, 0xA0, 0x0A, 0x01, 0x00, 0x00, 0x3C, 0x7D, 0xCB, 0xF3, 0x52, 0xE3, 0x9B, 0x28,
+        0xBE, 0x6E, 0x55, 0x91, 0x17, 0x2E, 0x07, 0xDE, 0xE0, 0x85, 0x9D, 0x82, 0xD4, 0x1A, 0xEC, 0x58,
+        0x6C, 0x06, 0x58, 0x86, 0x77, 0x18, 0x2B, 0x0B, 0x97, 0x28, 0xE2, 0xCA, 0x18, 0xEF, 0x5A, 0xAF,
+        0x39, 0xA0, 0x27, 0xBE, 0xC5, 0xBB, 0xD5, 0x81, 0x59, 0x68, 0xB4, 0xD0, 0x23, 0x77, 0xAB, 0x76,
+        0xD0, 0x16, 0x96, 0xB5, 0x61, 0xDE, 0x15, 0xCB, 0x17, 0x17, 0x28, 0x00, 0xC6, 0xF3, 0x60, 0x30,
+        0xB8, 0x5C, 0x1B, 0x18, 0xCB, 0x1C, 0xA1, 0x10, 0x2D, 0x6B, 0x76, 0x58, 0x81, 0x1C, 0xB9, 0xB2,
+        0x2C, 0x94, 0x20, 0x40, 0xB5, 0x7A, 0x5E, 0xE0, 0x6E, 0xF3, 0x9E, 0xED, 0x1A, 0x05, 0xEE, 0x69,
+        0xA0, 0x38, 0x3C, 0xB5, 0x7A, 0xB3, 0xB6, 0x40, 0xB0, 0x8F, 0x72, 0xF7, 0x60, 0x23, 0x40, 0x1C,
+        0x1E, 0x8D, 0xD9, 0xBB, 0x5A, 0xD0, 0x17, 0x95, 0xEE, 0x3D, 0xCD, 0x01, 0xAB, 0x2D, 0x69, 0xAC,
+        0x34, 0x99, 0xB1, 0x89, 0x0B, 0x9B, 0xC1, 0x2E, 0x6E, 0x38, 0xB3, 0x7C, 0xDE, 0x6C, 0x26, 0xB1,
+        0x2A, 0x44, 0x0A, 0xCC, 0x67, 0x14, 0x50, 0x8D, 0x42, 0x5C, 0x42, 0x7C, 0x80, 0x02, 0xBB, 0xFE,
+        0x7F, 0x5A, 0xAE, 0x3E, 0x1F, 0x84, 0x0F, 0xE6, 0xC2, 0xFA, 0x66, 0xBC, 0x0E, 0x60, 0x1C, 0x00,
+        0xE0, 0x04, 0x01, 0x60, 0x14, 0x00, 0x40, 0x18, 0x00, 0x25, 0x9A, 0x9E, 0x8A, 0x25, 0x0E, 0x19,
+        0x2B, 0x04, 0xF1, 0x70, 0x06, 0x27, 0x12, 0x84, 0x43, 0xC1, 0x66, 0x29, 0xE2, 0x69, 0xA5, 0x0A,
+        0xE0, 0x50, 0x8F, 0x3B, 0xC9, 0x06, 0x1C, 0xB8, 0x83, 0x8F, 0x06, 0x5F, 0x1C, 0x58, 0xFE, 0x52,
+        0x4C, 0x54, 0xF1, 0x28, 0x8D, 0x5F, 0x5D, 0xF1, 0xBB, 0x00, 0xA0, 0x06, 0x00, 0x00, 0x04, 0x01,
+        0x30, 0x0E, 0x00, 0x10, 0x0A, 0x03, 0x21, 0x71, 0xE2, 0xC3, 0xFC, 0x2D, 0x72, 0x25, 0xFD, 0x50,
+        0xBE, 0xE2, 0xC9, 0xB0, 0xBF, 0xFF, 0xFF, 0xB3, 0xEC, 0x41, 0x00, 0xF3, 0x05, 0x30, 0x12, 0xC4,
+        0x1C, 0xE2, 0x46, 0x0C, 0x9A, 0x7A, 0x91, 0x22, 0xA7, 0x19, 0xC6, 0x54, 0x0A, 0x5C, 0xA6, 0x51,
+        0x1C, 0x9D, 0x82, 0xE5, 0x82, 0x5C, 0x94, 0x5C, 0x46, 0x25, 0xCB, 0x8D, 0x91, 0x60, 0x89, 0x72,
+        0x6C, 0x26, 0xE5, 0xCB, 0x25, 0x04, 0xF7, 0x05, 0xBB, 0xDC, 0xC0, 0x73, 0x4D, 0x5A, 0xF7, 0x03,
+        0x71, 0x25, 0x82, 0x12, 0xC7, 0x06, 0xB1, 0xCB, 0x10, 0xB8, 0x0C, 0x0A, 0xCE, 0xC0, 0x8D, 0x02,
+        0x68, 0x5B, 0xBC, 0xA0, 0xE5, 0x97, 0x29, 0x94, 0x88, 0xC8, 0x3B, 0xCA, 0x3C, 0xB7, 0x18, 0x83,
+        0x82, 0xB1, 0x97, 0x2E, 0x58, 0x20, 0x05, 0xEA, 0xD1, 0x66, 0xAC, 0x1B, 0x25, 0x8C, 0x62, 0xE0,
+        0xA0, 0xE5, 0x22, 0x0C, 0x26, 0xF3, 0x64, 0x14, 0x00, 0xB9, 0x64, 0xB8, 0xB8, 0x36, 0x30, 0x5C,
+        0x5C, 0xB9, 0x62, 0x0D, 0xF7, 0xE8, 0x2D, 0x34, 0x05, 0x82, 0x6E, 0xF7, 0x7A, 0xC3, 0x48, 0xC6,
+        0x2F, 0x37, 0x17, 0x28, 0x62, 0x34, 0x0D, 0x70, 0xF3, 0x72, 0x6C, 0x89, 0x11, 0x24, 0x1D, 0xC2,
+        0xE0, 0x8C, 0x97, 0x2C, 0x46, 0x24, 0x5C, 0x63, 0x29, 0x1C, 0x0E, 0xD6, 0x2B, 0x7B, 0xB7, 0x60,
+        0xA1, 0xA9, 0x82, 0xA2, 0x6B, 0x78, 0x34, 0xBB, 0x39, 0x47, 0x21, 0x6A, 0xAF, 0xA0, 0x02, 0xB8,
+        0xAD, 0x7E, 0xF7, 0x1E, 0xCF, 0x1E, 0x7C, 0x7F, 0xC5, 0x0E, 0xE2, 0x67, 0x30, 0x02, 0xE0, 0x0E,
+        0x01, 0x80, 0x08, 0x01, 0x60, 0x00, 0x00, 0x80, 0x00, 0x01, 0xC5, 0x9E, 0x3C, 0xE9, 0x52, 0x94,
+        0x68, 0x42, 0x9A, 0x29, 0xE1, 0xC1, 0x78, 0x34, 0x08, 0x3A, 0x74, 0x34, 0x8F, 0xE6, 0xC5, 0xF9,
+        0x78, 0xB2, 0x12, 0x15, 0x28, 0x28, 0x11, 0x9A, 0x50, 0xAC, 0xB1, 0x7A, 0x0A, 0x39, 0xD3, 0xE1,
+        0x98, 0xBC, 0x1B, 0x00, 0xC0, 0x03, 0x00, 0x70, 0x04, 0x00, 0x90, 0x18, 0x00, 0x90, 0x0A, 0x00,
+        0xB0, 0x07, 0x00, 0x20, 0x53, 0xCD, 0xA7, 0xF6, 0x4B, 0xE9, 0xB7, 0xF5, 0x98, 0x9F, 0xFF, 0xFF,
+        0xFC, 0x76, 0xF4, 0xAA, 0xB9, 0x8D, 0x80, 0x30, 0x18, 0x00, 0x00, 0x40, 0x78, 0x08, 0x02, 0x00,
+        0x60, 0x60, 0x16, 0x01, 0x00, 0x63, 0x8C, 0xCF, 0x72, 0xE2, 0x4D, 0xCB, 0x20, 0xB3, 0xB8, 0xE1,
+        0x46, 0x12, 0xB0, 0x40, 0x59, 0x2C, 0xB9, 0x4C, 0xDC, 0x0E, 0xD3, 0x45, 0xBB, 0xD4, 0x06, 0xEF,
+        0x71, 0xAB, 0x43, 0x70, 0x1A, 0xB5, 0xBB, 0xD2, 0x30, 0x4B, 0x4D, 0x59, 0xDE, 0xB7, 0x0C, 0x2E,
+        0x2E, 0x58, 0xC2, 0xC6, 0x04, 0xD2, 0xC8, 0xDD, 0xAC, 0x0E, 0xCB, 0xDC, 0x6A, 0xC8, 0x1E, 0xE7,
+        0x78, 0x43, 0x76, 0xC3, 0x65, 0x83, 0x96, 0x39, 0x58, 0xC0, 0xB5, 0xEE, 0x2C, 0xB5, 0x7A, 0x0D,
+        0xD9, 0x68, 0x5E, 0xE3, 0x04, 0xD2, 0xD7, 0xBA, 0xFD, 0xC0, 0x4B, 0x8C, 0x2C, 0x8B, 0x8B, 0x28,
+        0x79, 0x58, 0x23, 0xDF, 0x7E, 0xE0, 0xB5, 0xAF, 0x70, 0x2C, 0x02, 0xD6, 0x9A, 0xB2, 0xC8, 0x62,
+        0x12, 0xE5, 0xCA, 0x65, 0x88, 0x1A, 0x37, 0x65, 0xEE, 0xD6, 0x80, 0x1B, 0xB0, 0xEF, 0x2D, 0x0C,
+        0xB0, 0x71, 0x61, 0x71, 0x97, 0x01, 0x5E, 0xEC, 0x5E, 0xE6, 0x98, 0x51, 0xE5, 0x63, 0x88, 0xE5,
+        0x78, 0x1D, 0xA1, 0xA2, 0xCD, 0xD8, 0x6E, 0x01, 0x72, 0xE2, 0x4D, 0xE5, 0x83, 0x37, 0x06, 0x08,
+        0xE3, 0x2E, 0x68, 0xE1, 0x9A, 0x27, 0x97, 0x3A, 0x13, 0xCF, 0x50, 0xCF, 0x42, 0x10, 0xB6, 0x7F,
+        0x18, 0x02, 0xB9, 0x5C, 0x7E, 0xF9, 0xDE, 0x9C, 0x1E, 0xAF, 0xBF, 0xC1, 0xD6, 0xC0, 0xA7, 0x24,
+        0x05, 0xE0, 0x16, 0x02, 0x00, 0x08, 0x00, 0xA0, 0x02, 0x00, 0x20, 0x06, 0x02, 0x85, 0x7A, 0xEF,
+        0x01, 0x62, 0xF5, 0x9A, 0x18, 0x17, 0x82, 0x9D, 0x38, 0x53, 0x89, 0xD1, 0x00, 0xD0, 0x81, 0x10,
+        0xF1, 0x85, 0xF3, 0xBF, 0xCD, 0xCD, 0xC1, 0xC7, 0xCD, 0x21, 0xC7, 0x9D, 0xC3, 0x32, 0x95, 0x6F,
+        0x0A, 0x23, 0x38, 0xBD, 0x0A, 0x3C, 0xE8, 0xD8, 0x09, 0x00, 0x28, 0x00, 0x80, 0x48, 0x01, 0x00,
+        0x18, 0x3C, 0x4A, 0xC7, 0xED, 0xF3, 0xF5, 0x53, 0xE6, 0x21, 0xFC, 0xFD, 0x34, 0x4E, 0x36, 0xD0,
+        0x35, 0x04, 0x42, 0xE5, 0x4B, 0x78, 0x35, 0x61, 0xAC, 0x5D, 0x72, 0x3E, 0x0E, 0x6E, 0x6C, 0x0C,
+        0xD1, 0xE5, 0x16, 0x32, 0xE2, 0xCB, 0x96, 0x4D, 0x84, 0x6A, 0xE9, 0x9A, 0xBA, 0x69, 0xA0, 0x60,
+        0x2E, 0xC5, 0xA5, 0xAD, 0x02, 0x17, 0x11, 0x8C, 0xB9, 0x4C, 0xA2, 0x32, 0x6F, 0x28, 0xC0, 0x65,
+        0x81, 0x65, 0xA2, 0xD1, 0xA0, 0x5A, 0x03, 0xBC, 0xAC, 0x16, 0x5C, 0x5C, 0xB1, 0x08, 0xB0, 0x2D,
+        0x07, 0x79, 0x5E, 0x90, 0x6B, 0x3B, 0x0B, 0x26, 0x81, 0x68, 0xD0, 0xB7, 0x7A, 0x0D, 0xDB, 0x76,
+        0x46, 0xE6, 0x02, 0xCA, 0xCB, 0xDD, 0xA6, 0x80, 0x3B, 0xCB, 0x3B, 0x2F, 0x50, 0x6E, 0xF7, 0x7A,
+        0x04, 0xF7, 0x41, 0xB4, 0xB5, 0xEE, 0xD0, 0xD0, 0x26, 0xB5, 0x6D, 0xDB, 0x56, 0x11, 0x8C, 0xB8,
+        0x53, 0x29, 0x96, 0x0B, 0x9D, 0xE2, 0x45, 0x93, 0x79, 0x48, 0x11, 0xA0, 0x59, 0x30, 0x5B, 0xBD,
+        0x2F, 0x56, 0x59, 0x06, 0x83, 0x76, 0x2C, 0x83, 0x13, 0x36, 0x32, 0x22, 0x62, 0x86, 0x8D, 0x01,
+        0xEF, 0xEF, 0x00, 0xB3, 0xBC, 0xB5, 0xBB, 0xD4, 0x30, 0x97, 0x2E, 0x6E, 0x32, 0x69, 0x01, 0xCA,
+        0x0E, 0x33, 0x72, 0xF2, 0xE5, 0x47, 0x2E, 0x0A, 0x73, 0x72, 0x8D, 0xFF, 0x35, 0x00, 0xB4, 0x0C,
+        0xC4, 0x67, 0xF7, 0x80, 0x02, 0xB3, 0x8E, 0xFB, 0x92, 0x7E, 0x21, 0x99, 0x43, 0xFF, 0x46, 0xBE,
+        0x23, 0x65, 0x64, 0x15, 0x40, 0x9A, 0x04, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0xC0, 0x0E, 0x02,
+        0x85, 0x9C, 0x66, 0x21, 0xF1, 0x35, 0x6A, 0x14, 0x38, 0x26, 0xB0, 0x63, 0x34, 0x94, 0x3A, 0xBC,
+        0x1C, 0x0D, 0x63, 0xF9, 0x49, 0x71, 0xF9, 0x5C, 0xA5, 0x87, 0x82, 0xE1, 0xF0, 0xD3, 0x80, 0x35,
+        0x65, 0x0D, 0x61, 0xEB, 0x75, 0x38, 0xA0, 0xB9, 0xC2, 0xB0, 0x0A, 0x02, 0xE1, 0x6B, 0xE2, 0x1F,
+        0xFB, 0xFB, 0xE3, 0xD7, 0xFA, 0x4A, 0x7D, 0x9E, 0x93, 0x28, 0xB4, 0x42, 0x58, 0x07, 0xC0, 0x0C,
+        0x02, 0x40, 0x28, 0x01, 0xCB, 0x81, 0xB5, 0x3C, 0x4D, 0x58, 0x0F, 0x59, 0xC6, 0x47, 0x07, 0x2C,
+        0xAF, 0x2C, 0xB1, 0x30, 0x68, 0xB2, 0x16, 0x5C, 0x29, 0x10, 0xBF, 0x7D, 0xEE, 0x02, 0x68, 0x16,
+        0xB7, 0x7B, 0xB5, 0xA1, 0x01, 0xA5, 0xAD, 0x58, 0xEF, 0x70, 0xE2, 0xC6, 0x58, 0xC1, 0x09, 0xA3,
+        0xCD, 0xE6, 0xC0, 0x04, 0x96, 0x00, 0x5A, 0xDD, 0xEE, 0x64, 0x18, 0x3E, 0xCD, 0x05, 0xAD, 0xDA,
+        0x18, 0xE6, 0xE2, 0xE5, 0xCA, 0x04, 0x41, 0x64, 0xD0, 0xB5, 0x82, 0x8E, 0x2C, 0x65, 0xCB, 0x25,
+        0xC1, 0xA1, 0x10, 0x18, 0xE6, 0xCC, 0xD0, 0xC0, 0x77, 0x9D, 0x80, 0x2D, 0x68, 0xDC, 0xF7, 0x3D,
+        0xC0, 0x6A, 0xCB, 0x5A, 0xF7, 0xD8, 0x00, 0x3B, 0xD6, 0xED, 0xBB, 0x61, 0xD9, 0x05, 0xC1, 0x72,
+        0xE5, 0xCA, 0x0F, 0x71, 0xA2, 0xF7, 0x65, 0x82, 0xD0, 0xD2, 0xC4, 0xC0, 0xEF, 0x43, 0x56, 0xB2,
+        0xC2, 0xC1, 0x97, 0x2C, 0x97, 0x29, 0x10, 0xF7, 0x1A, 0x35, 0x66, 0xA0, 0x64, 0x6B, 0xDC, 0x58,
+        0x05, 0x87, 0x7A, 0xCE, 0xDB, 0xB0, 0x37, 0x6B, 0x2F, 0x51, 0xEB, 0x83, 0xDD, 0xEB, 0x39, 0xE8,
+        0x58, 0x01, 0x1E, 0xFB, 0x5F, 0xB9, 0xB8, 0x91, 0xA6, 0x43, 0xD5, 0xEA, 0xDC, 0x4F, 0x59, 0x44,
+        0x2C, 0x20, 0x31, 0x99, 0xFC, 0xE0, 0x02, 0xBD, 0x22, 0x3F, 0x94, 0x26, 0xD8, 0xDF, 0x8E, 0xBF,
+        0xE2, 0xB6, 0xD3, 0x26, 0x54, 0x0F, 0x60, 0x38, 0x00, 0x20, 0x10, 0x02, 0x60, 0x18, 0x00, 0xA0,
+        0x18, 0x00, 0x84, 0xE3, 0x9E, 0x8E, 0x9B, 0xA9, 0xD1, 0xA6, 0x60, 0x5F, 0xCA, 0x87, 0x9B, 0xF2,
+        0x81, 0xE5, 0xE1, 0x4C, 0x38, 0xC1, 0x57, 0x50, 0x71, 0x71, 0x38, 0x24, 0xAB, 0xBC, 0x0C, 0x11,
+        0x1B, 0xE0, 0xE9, 0xCD, 0x80, 0x10, 0x02, 0x80, 0x90, 0x03, 0x80, 0x80, 0x09, 0x80, 0x18, 0x02,
+        0x02, 0xBE, 0x6C, 0x7F, 0xB2, 0x4F, 0x4D, 0x5F, 0xAC, 0x97, 0xE8, 0xE1, 0x12, 0xC3, 0x79, 0x3F,
+        0xFF, 0xC9, 0xA4, 0x05, 0x74, 0x20, 0x94, 0x49, 0x50, 0x08, 0x4D, 0xCD, 0xC0, 0x9B, 0x97, 0x0B,
+        0x34, 0x3C, 0xF7, 0xC3, 0x4B, 0x40, 0x4B, 0x83, 0x2C, 0x41, 0xCB, 0x94, 0x41, 0xCB, 0x12, 0x25,
+        0xC6, 0x50, 0xD6, 0x5A, 0x47, 0xBA, 0xD8, 0x54, 0x19, 0x9D, 0xC1, 0x71, 0x60, 0x59, 0x6E, 0x7B,
+        0x9A, 0x2F, 0x05, 0x34, 0x0E, 0xF5, 0xBB, 0x0B, 0x06, 0x5C, 0xB9, 0x4C, 0xA1, 0x03, 0xB5, 0xAD,
+        0x00, 0xEF, 0x04, 0xDD, 0xAC, 0xB4, 0x6E, 0x0E, 0x58, 0x84, 0x49, 0xB3, 0x16, 0x04, 0x07, 0x7A,
+        0xD5, 0xEA, 0x18, 0x31, 0x97, 0x0A, 0x65, 0x22, 0x06, 0x9B, 0xB2, 0x6B, 0xDF, 0x60, 0x05, 0x8E,
+        0xF5, 0xBB, 0x60, 0xAC, 0xB4, 0x67, 0x6D, 0xD8, 0x09, 0xAB, 0x2F, 0x4B, 0x60, 0xED, 0x68, 0x00,
+        0xE1, 0xC0, 0x49, 0x71, 0x96, 0x0E, 0x50, 0x62, 0x6E, 0xF3, 0x9E, 0x90, 0x7B, 0x98, 0x8D, 0xD9,
+        0xA8, 0x35, 0xEA, 0x69, 0xA0, 0x00, 0x0B, 0x3B, 0xCB, 0x70, 0x6D, 0x6E, 0xCD, 0xDA, 0xCB, 0x05,
+        0x97, 0x94, 0x97, 0x19, 0x72, 0xC0, 0x42, 0xF2, 0x91, 0xCD, 0xCB, 0xCA, 0xE0, 0x4D, 0x5A, 0xDB,
+        0xB4, 0xD7, 0x86, 0x81, 0x18, 0x83, 0xCD, 0xCA, 0x0E, 0x3C, 0xF7, 0x13, 0x1C, 0xEE, 0x5F, 0x00,
+        0xC6, 0xF9, 0x1E, 0x93, 0x7F, 0xB0, 0x02, 0xB4, 0x26, 0xF9, 0xEA, 0x7E, 0x47, 0xD7, 0x35, 0xFE,
+        0x8B, 0xBC, 0xB9, 0xC9, 0xD8, 0x38, 0x81, 0x54, 0x07, 0x00, 0x2C, 0x00, 0x40, 0x0C, 0x02, 0x80,
+        0x1C, 0x05, 0x0B, 0x9D, 0x6D, 0x70, 0xF1, 0xBA, 0x34, 0x94, 0x6E, 0x8A, 0x20, 0x3A, 0x9A, 0x42,
+        0xAE, 0x1F, 0x04, 0x8E, 0x6F, 0x9B, 0xF8, 0xA9, 0xE3, 0xC7, 0x60, 0x76, 0x34, 0x9A, 0x40, 0xE9,
+        0x38, 0x5E, 0xCD, 0x2A, 0xBD, 0xDB, 0xDF, 0xF2, 0x85, 0xF4, 0xF7, 0xF4, 0xD2, 0xFE, 0x05, 0x96,
+        0x2E, 0x39, 0x10, 0x30, 0x00, 0x80, 0x09, 0x00, 0x50, 0x0A, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0D,
+        0x2A, 0x9E, 0xA4, 0x89, 0xA7, 0x4C, 0xA9, 0xD5, 0x8F, 0x36, 0x6F, 0x0B, 0xCD, 0x61, 0x11, 0x0B,
+        0xCA, 0xD6, 0x76, 0x4F, 0x70, 0x5A, 0xD7, 0xB9, 0x62, 0xDD, 0x83, 0x56, 0x8D, 0xDE, 0xED, 0x18,
+        0x2B, 0x5E, 0xE1, 0x62, 0xD0, 0xB2, 0x6E, 0x0C, 0xB9, 0x60, 0x20, 0x6E, 0xCB, 0xDD, 0xA2, 0xC0,
+        0x59, 0x71, 0x06, 0x17, 0x0B, 0x94, 0x72, 0x92, 0x6C, 0x25, 0x92, 0xC4, 0x00, 0x58, 0xB5, 0xA4,
+        0x30, 0x2E, 0x24, 0x47, 0x2C, 0x9A, 0x1B, 0x4D, 0xDA, 0xCB, 0xDC, 0xD0, 0x84, 0x6F, 0x1B, 0xCD,
+        0xC4, 0x88, 0x1D, 0xE2, 0xD3, 0x45, 0xB7, 0x0C, 0x62, 0x46, 0x5C, 0xB1, 0xCA, 0x07, 0xB9, 0xAD,
+        0x58, 0xB2, 0xC1, 0x69, 0xA5, 0x82, 0x43, 0x8C, 0x49, 0x71, 0x72, 0xC6, 0x02, 0xC6, 0x2E, 0x32,
+        0xC0, 0x72, 0x83, 0xDC, 0x68, 0x6A, 0xC0, 0x59, 0x6B, 0xDF, 0x6D, 0x00, 0x63, 0x72, 0x58, 0x5C,
+        0x0B, 0x8C, 0x1B, 0x21, 0x63, 0x8B, 0x25, 0x88, 0x24, 0x63, 0x2E, 0x2E, 0x14, 0xCA, 0x18, 0xB4,
+        0xF7, 0x1A, 0x30, 0x4B, 0x35, 0x6B, 0x26, 0xC1, 0xDA, 0x69, 0xA3, 0x40, 0x46, 0x19, 0xDC, 0x1C,
+        0xDC, 0x60, 0x0C, 0xEF, 0x18, 0x93, 0x78, 0xC3, 0x79, 0xA5, 0x44, 0xA2, 0xA7, 0x4C, 0x87, 0x0F,
+        0xAD, 0x98, 0x2A, 0x31, 0x18, 0x7F, 0xFD, 0x40, 0x02, 0xBD, 0x48, 0xBF, 0x85, 0x36, 0xF7, 0x9F,
+        0x87, 0x2F, 0xE3, 0x56, 0xDF, 0xE6, 0x78, 0x0E, 0xA0, 0x2C, 0x00, 0x60, 0x0C, 0x02, 0xA0, 0x1C,
+        0x00, 0x00, 0x14, 0x00, 0x45, 0x78, 0xDE, 0x87, 0x0E, 0xEA, 0x7C, 0x34, 0xCE, 0x09, 0xF1, 0x29,
+        0x8E, 0xAF, 0x5B, 0xC3, 0x5C, 0x5D, 0x15, 0xD1, 0xAC, 0x67, 0x5D, 0xE9, 0x70, 0x72, 0x04, 0x58,
+        0x3B, 0x26, 0x1F, 0xA2, 0x2F, 0xEC, 0x8E, 0x99, 0x9F, 0xD0, 0x93, 0xC5, 0x20, 0x41, 0xC5, 0x84,
+        0x21, 0x00, 0x8C, 0x01, 0x80, 0x44, 0x02, 0x80, 0x1C, 0x03, 0x09, 0x86, 0xE0, 0xE2, 0xE2, 0xD4,
+        0x18, 0xB4, 0x06, 0x3F, 0xBF, 0x77, 0xA2, 0xC8, 0x73, 0x42, 0x4B, 0x11, 0xE5, 0xB8, 0x86, 0xB4,
+        0xB1, 0x37, 0x3D, 0x0A, 0x46, 0x2E, 0x58, 0x99, 0x44, 0x30, 0x9A, 0xB6, 0xED, 0x60, 0xDC, 0x5C,
+        0xB1, 0x8C, 0x5C, 0xB0, 0x2F, 0x70, 0xF7, 0xD9, 0x64, 0xC1, 0x6A, 0xC2, 0x6E, 0xF4, 0x0C, 0xB1,
+        0x8C, 0x65, 0x8E, 0x5C, 0xA2, 0x06, 0x56, 0x01, 0x37, 0x9B, 0xCD, 0x0C, 0xD0, 0x4C, 0x9B, 0x86,
+        0x38, 0xB8, 0xB1, 0x8B, 0x8C, 0x0E, 0x7B, 0xBD, 0xC3, 0xDC, 0xD0, 0x06, 0xED, 0x6B, 0x46, 0xAC,
+        0x00, 0x77, 0xA3, 0x76, 0xDC, 0x1E, 0xAC, 0xB5, 0xAD, 0x1A, 0x17, 0x2E, 0x53, 0x2E, 0x50, 0x88,
+        0x02, 0xF4, 0x5A, 0xF4, 0x9A, 0x0D, 0x0D, 0x05, 0x96, 0x01, 0xDE, 0x8D, 0x0D, 0xD8, 0x37, 0x6B,
+        0x2D, 0x1A, 0xD6, 0x12, 0xC9, 0x72, 0xE5, 0xCA, 0x65, 0x00, 0xC4, 0x68, 0xD1, 0xB8, 0x31, 0x7B,
+        0xB2, 0xD3, 0x5E, 0xE0, 0xB7, 0xB8, 0xB3, 0xDD, 0x60, 0x05, 0x8E, 0xF1, 0x35, 0xA1, 0x97, 0x19,
+        0x71, 0x71, 0x26, 0xF2, 0x8E, 0x37, 0x1C, 0x4B, 0x8C, 0x65, 0xC1, 0x65, 0xC2, 0xE5, 0x90, 0xA4,
+        0x20, 0xD3, 0x37, 0xCD, 0xCD, 0x99, 0x72, 0xCB, 0x84, 0x04, 0x5A, 0x02, 0x1D, 0x6F, 0x0F, 0x0A,
+        0x4C, 0x27, 0x80, 0x65, 0x5C, 0x7E, 0xC0, 0x02, 0xBC, 0x24, 0xBF, 0x67, 0xEE, 0xEB, 0xDF, 0x2C,
+        0x5F, 0xD5, 0x86, 0x4D, 0xA6, 0xEC, 0x0F, 0xE0, 0x26, 0x00, 0xC0, 0x20, 0x00, 0x60, 0x18, 0x01,
+        0x60, 0x00, 0x00, 0x45, 0x3E, 0xAF, 0x19, 0x80, 0xB5, 0x78, 0xCC, 0x50, 0xC1, 0x6F, 0x5B, 0xE1,
+        0x25, 0xBC, 0x1E, 0x0B, 0x8B, 0xD5, 0x00, 0x10, 0x14, 0x00, 0x40, 0x48, 0x04, 0x00, 0xA0, 0x50,
+        0x03, 0x80, 0xC0, 0x16, 0x02, 0x40, 0x20, 0x53, 0xF6, 0x8F, 0xFF, 0xF3, 0xD7, 0xFC, 0x54, 0xD7,
+        0xFF, 0x29, 0x5F, 0xFF, 0x03, 0x59, 0x1A, 0x6E, 0x61, 0xD0, 0x02, 0x00, 0xA0, 0x02, 0x01, 0x80,
+        0x68, 0x00, 0x00, 0x40, 0x10, 0x02, 0x00, 0x50, 0x00, 0x37, 0x08, 0x6C, 0x66, 0x6F, 0x3B, 0x8C,
+        0x14, 0xCD, 0x97, 0x01, 0x23, 0x2C, 0x12, 0xE1, 0x72, 0xE5, 0xCB, 0x2C, 0x94, 0x63, 0x96, 0x20,
+        0x4D, 0xC1, 0x88, 0x35, 0x67, 0x78, 0xEF, 0x76, 0x02, 0xD6, 0xED, 0xBB, 0x5E, 0xE0, 0x07, 0xBE,
+        0xCB, 0x5B, 0xB6, 0x88, 0x35, 0xAD, 0x17, 0xAB, 0x4C, 0x16, 0xAF, 0x44, 0x64, 0xC1, 0x2C, 0xB5,
+        0xA5, 0xB4, 0x02, 0x67, 0x79, 0xDB, 0x76, 0x02, 0xD6, 0x8D, 0x6E, 0xC4, 0x0C, 0x9A, 0x1A, 0xB2,
+        0xC1, 0x69, 0xA3, 0x56, 0x01, 0x2E, 0x17, 0x19, 0x64, 0xB1, 0x88, 0xE3, 0x64, 0x19, 0x64, 0xB9,
+        0x60, 0x0B, 0x2D, 0x0D, 0x1A, 0x10, 0x63, 0x1C, 0xDE, 0x54, 0xC4, 0x06, 0x82, 0xD6, 0x1D, 0xE0,
+        0x8D, 0x01, 0x7A, 0xB0, 0xB0, 0x63, 0x19, 0x71, 0x97, 0x11, 0x07, 0x2E, 0x53, 0x29, 0x06, 0x20,
+        0x68, 0xD3, 0x7D, 0xFA, 0x58, 0x2F, 0x56, 0xB4, 0xD6, 0x80, 0x68, 0x34, 0x58, 0xB0, 0x2C, 0x3B,
+        0xCB, 0x77, 0xAD, 0xC3, 0x8B, 0x8C, 0x58, 0xE2, 0x31, 0x0C, 0xB5, 0x96, 0x8C, 0xA1, 0xC2, 0xE2,
+        0xE5, 0xCB, 0x88, 0xE2, 0x09, 0xEE, 0xF7, 0x7B, 0x8C, 0x40, 0x61, 0xDB, 0x5E, 0xFB, 0x5E, 0x08,
+        0x5E, 0x1D, 0x16, 0x1E, 0xA6, 0x9C, 0xA0, 0x72, 0x74, 0x98, 0x3F, 0x0E, 0x60, 0x02, 0xB8, 0x28,
+        0x7E, 0x0F, 0x5F, 0x49, 0xAE, 0x61, 0xBF, 0xCC, 0xAF, 0x3D, 0x13, 0x6E, 0x03, 0x40, 0x43, 0x00,
+        0xA0, 0x02, 0x00, 0x40, 0x0C, 0x00, 0x20, 0x0B, 0x00, 0x82, 0xE7, 0xD3, 0xE2, 0xDC, 0x3F, 0x52,
+        0x9B, 0xD3, 0xE8, 0xDC, 0x9D, 0x28, 0x30, 0xC6, 0xCE, 0xD0, 0x18, 0x6B, 0x6B, 0x00, 0x00, 0x0A,
+        0x02, 0xE1, 0x67, 0xE1, 0x97, 0xFB, 0xB1, 0xE3, 0x77, 0xFA, 0x05, 0x7D, 0x7F, 0x92, 0xE8, 0xB2,
+        0x42, 0x60, 0x08, 0xC0, 0x08, 0x03, 0xC0, 0x38, 0x77, 0xE3, 0xD2, 0xF8, 0xE6, 0xB1, 0xCB, 0x05,
+        0x71, 0x97, 0x36, 0x4B, 0xE7, 0xBC, 0xDC, 0x01, 0x5E, 0x73, 0xDC, 0x68, 0x23, 0x88, 0x91, 0xCD,
+        0x83, 0x94, 0x31, 0xDB, 0x3B, 0x2C, 0xB0, 0x6E, 0x32, 0x99, 0x60, 0x24, 0xB0, 0x1B, 0xB5, 0xA3,
+        0xDC, 0x00, 0xEF, 0x2D, 0x5E, 0xB5, 0x62, 0x19, 0x70, 0x40, 0x94, 0xCB, 0x1C, 0x0E, 0xBD, 0x37,
+        0x6D, 0xD8, 0x80, 0x68, 0x68, 0xB3, 0xBD, 0x06, 0xB4, 0xB6, 0x96, 0x3B, 0xC0, 0xEF, 0x77, 0xA0,
+        0xBD, 0x4C, 0x2C, 0x63, 0x2C, 0x8B, 0x96, 0x38, 0x1C, 0xC8, 0xD6, 0x80, 0x33, 0x72, 0x2C, 0xBC,
+        0xDE, 0x6C, 0x88, 0x06, 0xAC, 0x77, 0x9D, 0xE3, 0x87, 0x18, 0x92, 0xE5, 0x92, 0xC6, 0x23, 0x18,
+        0xC6, 0x5C, 0x63, 0x2C, 0x81, 0xD8, 0xDC, 0xF7, 0x6B, 0x4C, 0x08, 0x68, 0x6A, 0xC0, 0x59, 0x2B,
+        0xC5, 0x8C, 0x48, 0x81, 0xA6, 0x96, 0x37, 0x65, 0x80, 0x4C, 0xB4, 0xCE, 0xF4, 0x32, 0xE3, 0x2C,
+        0x97, 0x16, 0x32, 0x0D, 0x8C, 0x19, 0x36, 0x46, 0x0C, 0x0E, 0xF5, 0xA2, 0xF4, 0x1B, 0x83, 0x2F,
+        0x76, 0x2D, 0x61, 0x03, 0xDC, 0x68, 0xD1, 0xA0, 0x34, 0x5E, 0x96, 0xD5, 0xA1, 0x83, 0x95, 0xE2,
+        0xC6, 0x39, 0x51, 0x87, 0x36, 0x59, 0x18, 0xCB, 0x20, 0x33, 0xB8, 0x1C, 0xD9, 0xB8, 0x61, 0xB9,
+        0xEA, 0x38, 0x6E, 0x6A, 0x43, 0x93, 0xC6, 0x02, 0xB1, 0xE6, 0xF1, 0x80, 0xFD, 0xB8, 0x0B, 0x83,
+        0xF8, 0xEF, 0xFA, 0xB4, 0x84, 0x98, 0xF3, 0x04, 0x18, 0x14, 0x00, 0x18, 0x02, 0x00, 0xA8, 0x05,
+        0x00, 0x18, 0x0C, 0x1C, 0x48, 0xD6, 0xCB, 0x68, 0xA2, 0x86, 0x53, 0xC2, 0xF0, 0xB0, 0x07, 0x00,
+        0xA0, 0x06, 0x00, 0x00, 0x02, 0x00, 0xF0, 0x0C, 0x00, 0x00, 0x0A, 0x03, 0x21, 0x6B, 0xE1, 0xB3,
+        0xFB, 0xC1, 0xE3, 0x83, 0xFA, 0x12, 0x7D, 0x85, 0x9F, 0xFE, 0x85, 0xF4, 0xD8, 0xA0, 0xE8, 0x08,
+        0x58, 0x50, 0x18, 0x50, 0x18, 0x28, 0x00, 0x18, 0x50, 0x28, 0x20, 0xD6, 0x12, 0xE5, 0x07, 0x18,
+        0xD0, 0xF5, 0xEE, 0x2F, 0x5A, 0x9A, 0x06, 0xED, 0xA4, 0xF7, 0x68, 0x04, 0xCA, 0xC2, 0xE4, 0xDC,
+        0x42, 0x50, 0xC5, 0x9D, 0xE4, 0xDD, 0xEE, 0xC0, 0x5A, 0x6B, 0x4D, 0xDA, 0xF0, 0x76, 0x5A, 0x1A,
+        0x16, 0x05, 0x93, 0x76, 0xD3, 0x5D, 0xE1, 0x23, 0x70, 0x2E, 0x5C, 0x42, 0x50, 0xC5, 0xAD, 0x6B,
+        0x5B, 0xB4, 0x1E, 0xB7, 0x65, 0xAC, 0x8D, 0x00, 0x69, 0x65, 0xAD, 0x60, 0xB4, 0xD2, 0xDA, 0x08,
+        0x63, 0x2E, 0x01, 0x70, 0xB2, 0x5C, 0x08, 0xB2, 0xD7, 0xBB, 0x58, 0x12, 0xE3, 0x2C, 0x97, 0x2C,
+        0x07, 0x03, 0x99, 0x32, 0xD0, 0xD0, 0x84, 0x46, 0x0C, 0x63, 0x9B, 0xC0, 0xED, 0x6B, 0x5A, 0x34,
+        0x03, 0x4E, 0xF6, 0x83, 0xBC, 0x06, 0xE3, 0x0B, 0x8C, 0x2C, 0x97, 0x01, 0x59, 0x2C, 0x64, 0xB8,
+        0xB0, 0x46, 0x31, 0x82, 0xE0, 0xC6, 0x5C, 0x16, 0x16, 0x4B, 0x97, 0x2C, 0x1C, 0xA1, 0xB7, 0x6B,
+        0x2C, 0xBD, 0xC6, 0x09, 0xEE, 0x68, 0xD1, 0x7A, 0x03, 0x56, 0x6E, 0xC5, 0xEE, 0xC2, 0x0E, 0x6F,
+        0x2C, 0x60, 0x99, 0x60, 0x46, 0x9A, 0x34, 0x00, 0xD0, 0x01, 0x60, 0x2C, 0x1D, 0xE1, 0x60, 0x1D,
+        0xE5, 0x88, 0xC3, 0x86, 0x42, 0x56, 0x42, 0x3B, 0x97, 0xF3, 0x4C, 0x0C, 0xE0, 0x36, 0x0F, 0xE2,
+        0x02, 0xBA, 0x5D, 0x7E, 0x44, 0xDE, 0xDF, 0x1E, 0x43, 0x7F, 0xC3, 0xAE, 0xF1, 0xE7, 0x24, 0x00,
+        0x60, 0x1E, 0x02, 0xC0, 0x06, 0x03, 0x20, 0x10, 0x01, 0x00, 0x10, 0x01, 0x47, 0x78, 0x4E, 0x81,
+        0x63, 0xAB, 0x2E, 0xCF, 0x4A, 0xCE, 0x16, 0x0A, 0x79, 0x8A, 0xFE, 0xAC, 0xFD, 0x18, 0xFE, 0x9B,
+        0x5F, 0x9C, 0xC4, 0x41, 0x8D, 0xA4, 0x1C, 0x80, 0x10, 0x02, 0x80, 0x04, 0x01, 0x00, 0x2C, 0x00,
+        0x00, 0x18, 0x9F, 0x1B, 0xAB, 0x88, 0x71, 0x28, 0xC1, 0x00, 0x0E, 0xFC, 0xE6, 0x9A, 0x6E, 0xC0,
+        0xDD, 0x97, 0xB9, 0xA1, 0xA0, 0x16, 0x59, 0x6E, 0xDA, 0xC1, 0xD8, 0xB2, 0xCE, 0xF2, 0xDC, 0x38,
+        0x83, 0x96, 0x26, 0x58, 0xCA, 0x32, 0x23, 0x8C, 0xB1, 0xCA, 0x44, 0x3D, 0xC0, 0x1A, 0x00, 0xB5,
+        0xAC, 0xED, 0xAD, 0x10, 0x7A, 0x16, 0x77, 0x89, 0xB8, 0x72, 0xE0, 0x84, 0xA4, 0x96, 0x30, 0x5C,
+        0xB1, 0x8C, 0xB2, 0x32, 0xC8, 0x28, 0x26, 0x2E, 0x53, 0x2C, 0x60, 0x41, 0xEE, 0x59, 0xEF, 0xB0,
+        0x23, 0x26, 0xF1, 0x63, 0x12, 0x30, 0x2D, 0x5F, 0xBE, 0xC6, 0x86, 0x82, 0xC1, 0xDE, 0x0E, 0xF7,
+        0x78, 0x16, 0x99, 0xDB, 0x76, 0xBD, 0x43, 0x19, 0x2C, 0x96, 0x31, 0x8C, 0x05, 0x8B, 0x83, 0x19,
+        0x64, 0x2C, 0x19, 0x72, 0xC9, 0x72, 0xE5, 0x80, 0xE0, 0x73, 0xDC, 0xCB, 0x2D, 0x1E, 0x0E, 0x68,
+        0xD1, 0xA2, 0xC3, 0x11, 0x84, 0x58, 0xC9, 0xBC, 0x45, 0x8C, 0x63, 0x9B, 0xCB, 0x18, 0x81, 0xA6,
+        0xB4, 0x68, 0xD0, 0x06, 0xAF, 0x40, 0x58, 0x05, 0x85, 0xAC, 0x77, 0x80, 0xB1, 0xDE, 0x5B, 0xBD,
+        0x60, 0xDC, 0x65, 0xC6, 0x5C, 0x10, 0x20, 0x5B, 0xB5, 0xE8, 0x6A, 0xF5, 0x06, 0x6E, 0xD6, 0xD5,
+        0xAC, 0xB0, 0x2D, 0x65, 0xAD, 0xDF, 0xA7, 0x07, 0x8B, 0x2C, 0x7C, 0xAD, 0xE5, 0xCC, 0xEA, 0x19,
+        0x6C, 0x1B, 0x1A, 0xCF, 0xD6, 0x02, 0xB3, 0x76, 0xF5, 0x66, 0xFD, 0x5E, 0x17, 0x1F, 0xF9, 0xDF,
+        0xF8, 0x20, 0x8A, 0x10, 0xAC, 0x04, 0x08, 0x0A, 0x00, 0x30, 0x06, 0x00, 0x50, 0x00, 0x00, 0xA8,
+        0x05, 0x58, 0x04, 0x80, 0xD0, 0x02, 0x80, 0x50, 0x04, 0x80, 0x88, 0x05, 0x02, 0x9E, 0x61, 0xFF,
+        0xAA, 0xAF, 0x46, 0x1F, 0xA6, 0x97, 0xE7, 0x0D, 0x10, 0x63, 0x67, 0x07, 0x02, 0x8E, 0x0A, 0xDA,
+        0x81, 0x57, 0x12, 0xA0, 0xC0, 0xEC, 0xB9, 0x12, 0xF2, 0xC1, 0x88, 0x0D, 0x0D, 0x05, 0x90, 0xCB,
+        0xC4, 0xBC, 0xD9, 0x11, 0xE6, 0xC0, 0x2C, 0x58, 0xEF, 0x26, 0x1B, 0x97, 0x10, 0x97, 0x2C, 0x60,
+        0x0B, 0x18, 0xC6, 0x2E, 0x31, 0x70, 0x6C, 0x96, 0x4B, 0x06, 0x31, 0x88, 0x3D, 0xC6, 0x56, 0x34,
+        0x08, 0xC2, 0x6F, 0x16, 0x5E, 0x2B, 0xC1, 0xDE, 0x6C, 0x88, 0x44, 0x08, 0xA1, 0x83, 0xBC, 0x2C,
+        0x98, 0x58, 0x24, 0x2E, 0x2E, 0x5C, 0x60, 0xD9, 0x2C, 0x96, 0x32, 0x58, 0xC4, 0x35, 0xAD, 0x65,
+        0xAD, 0xDB, 0x05, 0x72, 0xE2, 0xE2, 0x12, 0xE5, 0x07, 0x2C, 0x94, 0xCA, 0x65, 0x32, 0x98, 0x1D,
+        0xEE, 0x35, 0x90, 0xD0, 0x49, 0xBC, 0x46, 0x45, 0x80, 0xE0, 0xEF, 0x11, 0x91, 0x63, 0x18, 0xC1,
+        0x73, 0x79, 0x48, 0xC4, 0x88, 0x40, 0xB4, 0x34, 0x1A, 0x00, 0xB0, 0x00, 0xE0, 0xF0, 0x77, 0x82,
+        0xD3, 0x01, 0xDE, 0xB3, 0xBD, 0x69, 0xAC, 0x28, 0x46, 0x5C, 0x65, 0xC5, 0xC4, 0x65, 0x91, 0x64,
+        0xB2, 0x2E, 0x28, 0x65, 0xAF, 0x4B, 0x5E, 0x96, 0x0B, 0x2D, 0x65, 0x96, 0xB0, 0x59, 0x71, 0x83,
+        0x19, 0x70, 0x60, 0xDC, 0x61, 0x71, 0x97, 0x19, 0x71, 0x03, 0x77, 0x9D, 0x8C, 0xEF, 0x76, 0x10,
+        0x01, 0xC5, 0xCB, 0x97, 0x2C, 0x11, 0xCB, 0x96, 0x00, 0xC4, 0xCA, 0x51, 0x34, 0xC5, 0x4A, 0x22,
+        0x1D, 0x5D, 0x64, 0xE8, 0x08, 0xEE, 0xD9, 0x7C, 0x40, 0x02, 0xBC, 0x0A, 0xBF, 0x37, 0x4F, 0x23,
+        0x6F, 0x75, 0x9F, 0xDA, 0x46, 0x89, 0xA6, 0xF8, 0x09, 0xA0, 0x2E, 0x02, 0x40, 0x28, 0x00, 0xE0,
+        0x08, 0x02, 0xE0, 0x14, 0x01, 0x16, 0x00, 0xC0, 0x70, 0x2D, 0xFC, 0x30, 0x7F, 0x75, 0x5C, 0x6C,
+        0x7F, 0x3F, 0xAF, 0xAF, 0x62, 0x60, 0x16, 0x88, 0x4C, 0x00, 0xE8, 0x00, 0x80, 0x58, 0x05, 0x00,
+        0x09, 0x42, 0xCC, 0x4F, 0x17, 0x52, 0x13, 0xA2, 0x18, 0xC9, 0x70, 0xB1, 0xCB, 0x8B, 0x18, 0x2E,
+        0x36, 0x41, 0x1C, 0x62, 0xE0, 0xDC, 0xB2, 0x53, 0x2C, 0x72, 0x86, 0x07, 0x34, 0x1E, 0xEB, 0x1A,
+        0x02, 0xCB, 0x6E, 0xCB, 0x5A, 0x0D, 0x34, 0xD2, 0xDA, 0x00, 0x2C, 0x1D, 0xE0, 0xE1, 0xC2, 0xE0,
+        0xC2, 0xE5, 0xC6, 0x5C, 0x15, 0xC5, 0x92, 0xC9, 0x63, 0x18, 0x01, 0x6A, 0xF2, 0xD6, 0x82, 0x46,
+        0x5C, 0x5C, 0x2C, 0x94, 0xC1, 0xB9, 0x72, 0xC0, 0x60, 0xC1, 0x80, 0x46, 0x5A, 0x34, 0x06, 0x8D,
+        0x0D, 0x59, 0xA0, 0xB2, 0xDA, 0x5A, 0xF7, 0x64, 0x31, 0x8E, 0x6F, 0x29, 0x18, 0xC1, 0x13, 0x36,
+        0x65, 0x22, 0x0F, 0x28, 0x07, 0x78, 0x1A, 0x77, 0xBD, 0xC8, 0x32, 0xC0, 0x77, 0x96, 0x83, 0x16,
+        0xEF, 0x16, 0x77, 0xAC, 0x25, 0xC4, 0x89, 0x19, 0x71, 0x94, 0x71, 0x71, 0x8B, 0x8B, 0x88, 0xE0,
+        0xAE, 0x23, 0x8B, 0x09, 0x63, 0x01, 0xBB, 0x59, 0x65, 0xAC, 0x83, 0x2D, 0x65, 0x96, 0xB7, 0x78,
+        0x16, 0x8C, 0xB7, 0x7A, 0xDD, 0xE0, 0x46, 0x8D, 0xDE, 0xEF, 0x58, 0x37, 0x2E, 0x59, 0x2E, 0x5C,
+        0xB9, 0x72, 0x8E, 0x20, 0x39, 0x71, 0x72, 0xC0, 0x17, 0x2C, 0x1C, 0xA6, 0x5C, 0xB1, 0x82, 0x39,
+        0x4C, 0xB0, 0x10, 0xCB, 0x83, 0x62, 0x65, 0xCD, 0xC1, 0xCD, 0xCB, 0xC0, 0xEC, 0xB4, 0xD3, 0x4F,
+        0x76, 0x15, 0xCB, 0xCD, 0x92, 0xE0, 0xA1, 0x10, 0xC7, 0x0A, 0xDC, 0x0A, 0x3F, 0x58, 0x02, 0xB1,
+        0x92, 0xE7, 0x51, 0xFB, 0xDF, 0x52, 0x7B, 0xF6, 0xF1, 0xF9, 0x92, 0x95, 0xE9, 0x4A, 0x05, 0x08,
+        0x02, 0x00, 0x10, 0x06, 0x00, 0x40, 0x1B, 0x0B, 0x6F, 0x0D, 0xDB, 0xFD, 0xE3, 0xF1, 0xC9, 0xFD,
+        0x0E, 0x3E, 0xC3, 0x89, 0x84, 0x5A, 0xA1, 0x38, 0x04, 0x60, 0x08, 0x01, 0x20, 0x08, 0x00, 0x20,
+        0x10, 0x00, 0x20, 0x0A, 0x00, 0x83, 0xDF, 0x96, 0x16, 0x30, 0x10, 0x80, 0x43, 0x5A, 0x1A, 0x00,
+        0x59, 0x62, 0xD6, 0x38, 0x70, 0x48, 0xCB, 0x82, 0xE3, 0x28, 0xC9, 0x71, 0x61, 0x2C, 0x71, 0x60,
+        0x2D, 0x6B, 0xDC, 0xD6, 0x8C, 0x0A, 0xF3, 0xB6, 0x76, 0x37, 0x78, 0x69, 0x97, 0x2C, 0x01, 0x83,
+        0x94, 0x0F, 0x73, 0x4F, 0x73, 0x47, 0x83, 0xED, 0xAC, 0xAC, 0xBD, 0x18, 0x2B, 0x2F, 0x4B, 0x6E,
+        0xCB, 0x0B, 0x8B, 0x18, 0xC4, 0xCA, 0x44, 0x34, 0xD6, 0x8D, 0x0F, 0x70, 0x58, 0x1A, 0x00, 0x00,
+        0x1D, 0xE0, 0x41, 0xAC, 0x59, 0xDE, 0x58, 0x81, 0xAD, 0x6E, 0xF5, 0x9D, 0xB0, 0x25, 0xC6, 0x2E,
+        0x2E, 0x23, 0x20, 0xD9, 0x17, 0x11, 0xC5, 0xC4, 0x43, 0x5E, 0x96, 0x58, 0x2C, 0x0B, 0x2D, 0x65,
+        0x96, 0xB0, 0x3B, 0xD6, 0x5A, 0xDD, 0xE5, 0x82, 0xCB, 0x8C, 0xB8, 0x5C, 0x65, 0xC4, 0x65, 0xC2,
+        0xE2, 0x12, 0xE5, 0xC4, 0x10, 0x25, 0xCB, 0x97, 0x2E, 0x5C, 0xB8, 0x37, 0x2E, 0x58, 0x00, 0x39,
+        0x72, 0x83, 0xDC, 0xF7, 0x7B, 0xB0, 0x4C, 0x0B, 0x13, 0xDD, 0x89, 0xEE, 0x0D, 0x3D, 0xCD, 0x31,
+        0x3D, 0xC3, 0x10, 0x8E, 0x51, 0xE5, 0x89, 0x02, 0x68, 0xD3, 0x4D, 0x30, 0x4D, 0x34, 0x69, 0xA4,
+        0x3C, 0xB2, 0xC2, 0x24, 0x49, 0x72, 0x8C, 0x88, 0xE2, 0x3C, 0xD9, 0x2C, 0x06, 0x58, 0xC8, 0x89,
+        0x1E, 0x68, 0x91, 0xE1, 0x8D, 0xC4, 0xB0, 0x02, 0xC2, 0xE7, 0x67, 0x5C, 0xE3, 0x26, 0x5F, 0x4F,
+        0x60, 0xAD, 0x90, 0xA2, 0x3A, 0x09, 0x10, 0x0F, 0xC2, 0x93, 0x45, 0x8F, 0x38, 0x2C, 0x34, 0x7C,
+        0x78, 0x9B, 0x6A, 0x89, 0x74, 0xBF, 0xFF, 0xFF, 0xA3, 0xEC, 0x3A, 0x00, 0xE2, 0x04, 0x08, 0x80,
+        0x86, 0x00, 0x80, 0x84, 0x08, 0x83, 0x97, 0x28, 0x65, 0x32, 0x98, 0x1C, 0x35, 0x90, 0xD0, 0x1A,
+        0x1A, 0xB1, 0xBB, 0x00, 0xBD, 0x2C, 0xB6, 0xED, 0x68, 0x63, 0x07, 0x36, 0x65, 0x8C, 0x48, 0x16,
+        0x8D, 0x34, 0x1A, 0x02, 0xFD, 0xCB, 0x00, 0x02, 0xC0, 0x1D, 0xE0, 0x0E, 0xF0, 0x5B, 0xBC, 0x4C,
+        0x2C, 0x2E, 0x32, 0xE0, 0xCB, 0x8C, 0x1B, 0x8C, 0xB8, 0xC5, 0xC6, 0x5C, 0x42, 0xF5, 0x7A, 0x0B,
+        0x6E, 0xC1, 0x96, 0x38, 0x8C, 0x71, 0x60, 0x86, 0x5A, 0xF5, 0x65, 0x96, 0x83, 0x77, 0xAC, 0xB2,
+        0xD6, 0x58, 0x3B, 0xD1, 0xAC, 0x8D, 0x03, 0x2E, 0x32, 0xE1, 0x64, 0xB8, 0x30, 0x50, 0x97, 0x2E,
+        0x53, 0x2E, 0x5C, 0x44, 0x71, 0x07, 0x2E, 0x5C, 0xB9, 0x41, 0xCB, 0x97, 0x29, 0x97, 0x2C, 0x01,
+        0x0C, 0x5E, 0xE7, 0xB9, 0x8B, 0xDC, 0x26, 0x52, 0x39, 0x4C, 0xA4, 0x72, 0x83, 0x4F, 0x73, 0x4C,
+        0xB4, 0x0D, 0x7B, 0x9A, 0x34, 0xD7, 0xB8, 0x0D, 0x34, 0xD3, 0x46, 0x09, 0xA6, 0x8D, 0x5B, 0x40,
+        0xD3, 0x45, 0xE9, 0xA5, 0xE0, 0x8D, 0xD9, 0xA6, 0xAD, 0xA0, 0xB3, 0x76, 0x69, 0x7A, 0xB0, 0x62,
+        0xC8, 0xB2, 0x58, 0x38, 0xA3, 0x09, 0x63, 0x22, 0xC9, 0x63, 0x04, 0x71, 0x64, 0xB0, 0x71, 0x62,
+        0x38, 0xB0, 0x72, 0xC1, 0xCA, 0x44, 0x64, 0xB0, 0x63, 0x96, 0x31, 0xCA, 0x1A, 0xD3, 0xDD, 0xA1,
+        0x9B, 0xF8, 0xD0, 0x51, 0x0E, 0x29, 0xFF, 0x70, 0x02, 0xC6, 0xF5, 0x70, 0xDC, 0x66, 0x5A, 0xC5,
+        0x7F, 0xD4, 0x03, 0x9F, 0x9F, 0x8F, 0x06, 0x1C, 0xBE, 0x3E, 0xCD, 0xBF, 0xC4, 0xB4, 0x16, 0x88,
+        0x25, 0x00, 0x36, 0x00, 0x00, 0x00, 0x8B, 0x80, 0xCD, 0xE1, 0x71, 0x1C, 0x42, 0xCB, 0xD5, 0x97,
+        0xAB, 0x20, 0xD7, 0xA5, 0x96, 0xB2, 0x78, 0x6B, 0x84, 0xDC, 0x63, 0x06, 0x14, 0x36, 0x5B, 0xBC,
+        0xAF, 0x2C, 0xE1, 0x90, 0xB8, 0xCB, 0x88, 0x4B, 0x80, 0xDC, 0x5C, 0x2E, 0x5C, 0x65, 0x30, 0x1B,
+        0x97, 0x2C, 0x09, 0x72, 0xE5, 0x30, 0x6E, 0x5C, 0xB9, 0x72, 0x99, 0x72, 0xE5, 0x1C, 0xB0, 0x60,
+        0x39, 0x72, 0x99, 0x41, 0x89, 0xEE, 0xCB, 0x5E, 0xE0, 0x62, 0x65, 0xAF, 0x73, 0x5E, 0x0E, 0x34,
+        0xF7, 0x69, 0xA7, 0xB8, 0x1A, 0x69, 0xA6, 0x9A, 0x07, 0xB9, 0xA6, 0x9A, 0x34, 0x0D, 0x34, 0xBC,
+        0x4B, 0x68, 0x1A, 0x6A, 0xDA, 0x35, 0x60, 0xD3, 0x56, 0xD3, 0x56, 0xF7, 0x0B, 0x25, 0x8C, 0x8B,
+        0x22, 0x38, 0x11, 0x7A, 0x6E, 0xCB, 0xDD, 0x83, 0x2C, 0x09, 0x63, 0x22, 0xC7, 0x05, 0x1C, 0xB0,
+        0x71, 0x18, 0xE2, 0x2C, 0x96, 0x32, 0x58, 0xC9, 0x62, 0x31, 0xC5, 0x83, 0x96, 0x31, 0xC4, 0x58,
+        0xE5, 0x8C, 0x71, 0x62, 0x41, 0x96, 0x31, 0xCB, 0x18, 0xE5, 0x88, 0xC7, 0x2C, 0x62, 0x65, 0x8C,
+        0x60, 0xB9, 0x48, 0xC7, 0x29, 0x18, 0xE0, 0x76, 0x9B, 0x73, 0x4D, 0x3D, 0xC1, 0xAD, 0x35, 0xEE,
+        0x35, 0xA0, 0x7B, 0xB5, 0xA3, 0xDC, 0xD3, 0x40, 0xF7, 0x35, 0xA6, 0x8F, 0x76, 0x08, 0xD3, 0xDC,
+        0xD3, 0x40, 0x7B, 0x9A, 0xD0, 0xF7, 0x1A, 0x06, 0x9E, 0xE1, 0xA6, 0x80, 0x34, 0x3D, 0xDA, 0x5B,
+        0x10, 0x23, 0x30, 0xD4, 0xD9, 0xBF, 0x94, 0x01, 0xC5, 0x1D, 0x7D, 0xC5, 0x9F, 0xF3, 0x45, 0x04,
+        0x3B, 0xFF, 0x02, 0x9F, 0xE4, 0xB9, 0x0C, 0xC9, 0x44, 0x82, 0xF2, 0x00, 0x00, 0x28, 0x80, 0x30,
+        0x01, 0x00, 0x2C, 0x01, 0x28, 0x01, 0x4F, 0xBA, 0xD1, 0xB9, 0x77, 0x6C, 0x69, 0x40, 0xB6, 0x6D,
+        0x3E, 0x47, 0x45, 0x6C, 0xF4, 0x0C, 0x80, 0x01, 0x74, 0x66, 0x00, 0x2A, 0x1E, 0x86, 0x05, 0xF5,
+        0x5C, 0x0A, 0x9A, 0xAC, 0x17, 0x12, 0x28, 0x70, 0x2A, 0x45, 0x62, 0x80, 0x92, 0xAA, 0xAA, 0x90,
+        0x2A, 0x80, 0x00, 0x74, 0x04, 0x0E, 0x1C, 0xE6, 0xF0, 0xE7, 0x00, 0xE1, 0x62, 0x80, 0x03, 0x81,
+        0x40, 0x50, 0xE8, 0x50, 0xEF, 0x0E, 0x70, 0x0E, 0x1C, 0xF0, 0x00, 0xA8, 0x54, 0xD0, 0xAA, 0x9A,
+        0x9A, 0x02, 0x80, 0x1F, 0xBF, 0xC3, 0xF3, 0xF0, 0x7E, 0x0F, 0x03, 0x87, 0x00, 0x3C, 0xE1, 0xC0,
+        0x13, 0x87, 0x03, 0x87, 0x0F, 0x3A, 0x78, 0x70, 0x03, 0xF3, 0xF7, 0xDF, 0x8F, 0xC0, 0x3C, 0x00,
+        0x3C, 0x38, 0x6F, 0x37, 0x9C, 0x00, 0xFC, 0xFC, 0x1F, 0x9F, 0x80, 0x7C, 0x39, 0xBC, 0x0E, 0x1C,
+        0x03, 0x80, 0x40, 0x50, 0x15, 0x34, 0x06, 0x2F, 0x17, 0x80, 0x0F, 0xC0, 0xFC, 0xF8, 0xFD, 0xF8,
+        0x01, 0xF8, 0x3F, 0x03, 0xF7, 0xF8, 0x01, 0xF8, 0x1F, 0x9F, 0x80, 0x3F, 0x03, 0xF0, 0x3F, 0xC0,
+        0x07, 0xEF, 0x83, 0xF0, 0x07, 0xE0, 0x3F, 0x01, 0xF8, 0x01, 0xF8, 0x7E, 0x1F, 0xE0, 0x27, 0x37,
+        0x80, 0x1C, 0xDE, 0x07, 0x34, 0x01, 0xF9, 0xF7, 0xEF, 0xBF, 0x00, 0x1E, 0x06, 0xF3, 0x78, 0x06,
+        0xF3, 0x81, 0xA3, 0xC3, 0x80, 0x6F, 0x0F, 0x3B, 0xE0, 0x70, 0x1E, 0x68, 0x1C, 0x00, 0x39, 0xCD,
+        0x34, 0x3F, 0x00, 0x01, 0xF8, 0x74, 0xDE, 0x00, 0x07, 0x03, 0x4E, 0x09, 0xCD, 0x03, 0x87, 0x34,
+        0x0E, 0x1E, 0x10, 0xBC, 0x0E, 0x24, 0x01, 0x43, 0x8D, 0x89, 0xA2, 0xA0, 0x37, 0x42, 0xAB, 0x62,
+        0x68, 0x50, 0xD9, 0x09, 0xE0, 0x48, 0xE7, 0x17, 0xD0, 0xE6, 0x77, 0xE8, 0x23, 0x9A, 0xB0, 0x17,
+        0x01, 0x4D, 0x4A, 0xE8, 0x45, 0xD3, 0xB2, 0x94, 0x45, 0xD4, 0x60, 0xD6, 0x5A, 0x3A, 0xC0, 0x02,
+        0xCE, 0x48, 0xCF, 0xE0, 0x4C, 0xFF, 0xC7, 0x22, 0x00, 0x90, 0x02, 0x80, 0x1C, 0x00, 0x00, 0x09,
+        0x00, 0x28, 0x00, 0xC0, 0x0E, 0x00, 0x70, 0x00, 0x80, 0x14, 0x00, 0xA0, 0x03, 0x2C, 0xB9, 0x6E,
+        0x72, 0x32, 0xC6, 0x64, 0xDB, 0x2B, 0x2D, 0xED, 0x4B, 0x96, 0xE5, 0xCB, 0x91, 0x3A, 0xF5, 0x5F,
+        0x69, 0xB6, 0x9F, 0x60, 0xEC, 0xFA, 0x53, 0xA9, 0xE9, 0x4B, 0xBA, 0x31, 0xE8, 0xDA, 0x6D, 0x2B,
+        0x3D, 0xC1, 0xF4, 0x29, 0xB3, 0x4D, 0x8D, 0xAC, 0x1D, 0x27, 0x58, 0xE8, 0x2B, 0x40, 0x67, 0x66,
+        0xF3, 0x4A, 0xC3, 0x62, 0x51, 0x00, 0xD2, 0x37, 0x9A, 0x1B, 0xCA, 0x23, 0x16, 0x52, 0x25, 0xCB,
+        0x9A, 0x18, 0xB2, 0xB5, 0xAB, 0xF7, 0xC0, 0xD3, 0x46, 0x9A, 0x37, 0xC1, 0xE3, 0x4D, 0x1A, 0x68,
+        0x3C, 0xD9, 0x18, 0xC6, 0x4D, 0xE0, 0xC1, 0x32, 0xBE, 0x77, 0xCE, 0xF2, 0x20, 0x00, 0xF3, 0x79,
+        0xBC, 0x63, 0x1E, 0x5C, 0xB8, 0x08, 0x06, 0x5E, 0x37, 0x99, 0xA4, 0xC3, 0x00, 0x0A, 0x00, 0x60,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x18, 0x01, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x07,
+        0xFF, 0x1E, 0xD8, 0x15, 0x7F, 0xF1, 0xC9, 0x00, 0x28, 0xAB, 0x03, 0x55, 0x18, 0xC2, 0xAA, 0x8D,
+        0x45, 0x41, 0x45, 0x68, 0x6A, 0x06, 0xA9, 0x62, 0x30, 0xA2, 0x0B, 0x83, 0x51, 0x51, 0x1A, 0x7A,
+        0x8A, 0x18, 0x58, 0x24, 0x96, 0xA0, 0x54, 0x40, 0xE0, 0xD1, 0xE0, 0x0E, 0x1E, 0x43, 0xE1, 0x86,
+        0x73, 0x8C, 0xF0, 0x19, 0x99, 0x8F, 0x86, 0x47, 0xE5, 0xF8, 0x18, 0x27, 0x1E, 0x1C, 0x66, 0x64,
+        0x78, 0x3E, 0x0C, 0x67, 0x02, 0x49, 0x80, 0xF8, 0xF0, 0x77, 0x86, 0x44, 0xE3, 0x0C, 0x00, 0x1E,
+        0x0C, 0xCD, 0xE0, 0x73, 0x70, 0x8C, 0x18, 0xE0, 0xC3, 0x2E, 0x5E, 0x21, 0x05, 0x24, 0x63, 0x26,
+        0xF0, 0x60, 0x86, 0x2C, 0xB1, 0x7E, 0xE2, 0x0C, 0xB1, 0x65, 0x9F, 0x7E, 0xA1, 0x8C, 0x62, 0xF3,
+        0x48, 0x97, 0x20, 0xF7, 0xCE, 0xF9, 0xAC, 0x00, 0x37, 0x9B, 0xC1, 0xD8, 0xC6, 0x6E, 0x5C, 0xA0,
+        0x00, 0xDC, 0xD9, 0x9B, 0x37, 0x8D, 0xE6, 0x80, 0x25, 0xCA, 0x66, 0xC0, 0x02, 0x4C, 0x1E, 0xEB,
+        0x8A, 0x57, 0x1B, 0x4D, 0x0C, 0xA4, 0x19, 0xB3, 0x85, 0xC8, 0x93, 0xE8, 0xC7, 0x0E, 0x20, 0x6D,
+        0x8B, 0x77, 0x49, 0xB1, 0x47, 0x2E, 0x05, 0x35, 0xD9, 0xC7, 0x8E, 0x4A, 0x8A, 0xAB, 0xC2, 0xF5,
+        0x7E, 0x27, 0xC5, 0xF5, 0xB6, 0x79, 0xB6, 0x3A, 0x47, 0x1E, 0xA7, 0x48, 0x9B, 0xFF, 0x3E, 0x6B,
+        0x6E, 0x7F, 0xDB, 0x1E, 0x0A, 0x21, 0x48, 0x2A, 0x61, 0xD4, 0x27, 0xE1, 0xB4, 0x14, 0x60, 0x26,
+        0x05, 0x8B, 0xAA, 0xB8, 0xE4, 0xD9, 0x5C, 0x68, 0xB2, 0x62, 0x5D, 0x8A, 0xE3, 0x38, 0x70, 0x90,
+        0xBE, 0x12, 0xD9, 0xCB, 0x3E, 0x4E, 0xF2, 0xD1, 0xD6, 0x3B, 0x34, 0xDA, 0x84, 0x4B, 0xDD, 0x1D,
+        0x21, 0x67, 0x0C, 0x80, 0x7B, 0xD9, 0x3C, 0xB8, 0x15, 0x58, 0x70, 0x02, 0xB3, 0x28, 0x49, 0xA0,
+        0x44, 0x6D, 0xFD, 0x2A, 0xF9, 0xB9, 0x4A, 0x06, 0xAE, 0xB1, 0xD7, 0x50, 0x81, 0x44, 0xE8, 0x97,
+        0x4B, 0xB5, 0x04, 0x40, 0x92, 0x6E, 0x7B, 0xA2, 0xD7, 0x05, 0x16, 0xB8, 0xEC, 0xC3, 0xC5, 0x4D,
+        0xBB, 0x10, 0x97, 0x83, 0x93, 0xDF, 0xA2, 0xA7, 0xE7, 0xE0, 0x27, 0x0E, 0xA9, 0x36, 0xE0, 0x51,
+        0x62, 0xCA, 0x4A, 0x38, 0xB8, 0x12, 0xDF, 0xA8, 0x96, 0x6E, 0xB2, 0x6F, 0x98, 0xB1, 0xA4, 0x83,
+        0x32, 0x08, 0x74, 0x84, 0xE4, 0xF5, 0x28, 0xB2, 0x96, 0x15, 0x51, 0x13, 0x35, 0xB0, 0xF0, 0x37,
+        0x3F, 0x51, 0x6B, 0x90, 0xCD, 0x90, 0xDB, 0x77, 0x24, 0x19, 0xC3, 0xB9, 0xB2, 0xE6, 0xC2, 0x09,
+        0xA0, 0x9D, 0x51, 0x4A, 0x54, 0xD1, 0xA6, 0x88, 0x25, 0x3E, 0x00, 0xBE, 0x61, 0x4E, 0x6C, 0x18,
+        0xE8, 0x34, 0xBA, 0x6D, 0x8E, 0xC0, 0x78, 0xDA, 0xD9, 0xEC, 0x1C, 0x76, 0x4B, 0x07, 0x08, 0xD6,
+        0xB4, 0xFE, 0xEF, 0x3B, 0x2C, 0xDF, 0x8A, 0x0E, 0x5C, 0xC8, 0xC8, 0xC5, 0x12, 0xE9, 0xD1, 0x47,
+        0x0E, 0xEA, 0x40, 0x0A, 0x2D, 0x22, 0x5C, 0x6C, 0x79, 0x29, 0xB2, 0xDA, 0x1B, 0x32, 0x67, 0xBA,
+        0x8C, 0xA5, 0x4D, 0x0F, 0x01, 0x83, 0x2F, 0x04, 0xB2, 0xE0, 0x9B, 0xAF, 0x43, 0x23, 0x4D, 0x81,
+        0x30, 0x0F, 0x81, 0x08, 0x30, 0x02, 0x28, 0x03, 0x81, 0xB0, 0x16, 0x80, 0xC0, 0x35, 0x82, 0x8E,
+        0x44, 0xBE, 0x1F, 0x7C, 0xE8, 0xFB, 0x42, 0x7C, 0x30, 0x1F, 0xFF, 0xC8, 0x83, 0x28, 0x03, 0xEA,
+        0x85, 0xEA, 0x08, 0x46, 0x28, 0x47, 0xC5, 0x27, 0x08, 0x06, 0x28, 0x49, 0xE2, 0xE3, 0xF2, 0x30,
+        0x58, 0x28, 0x61, 0x9D, 0xB9, 0x0B, 0xCC, 0xE4, 0xA6, 0x88, 0x13, 0xAA, 0x19, 0x94, 0xE2, 0xC9,
+        0x56, 0x3E, 0xE6, 0xC2, 0xA4, 0xE8, 0x9E, 0xBD, 0xC2, 0x31, 0xF2, 0x69, 0xD8, 0x37, 0xBA, 0x8D,
+        0x79, 0x91, 0x94, 0xB3, 0x06, 0x72, 0xF6, 0x23, 0xE7, 0xE0, 0x56, 0x7C, 0x99, 0xB0, 0xD2, 0x9C,
+        0x55, 0xC3, 0xB2, 0x79, 0xF3, 0x0E, 0xBD, 0x13, 0xE1, 0xB3, 0x66, 0xDA, 0xD3, 0xD5, 0xC2, 0xDD,
+        0xD6, 0x9D, 0x8E, 0xCE, 0x0E, 0xAE, 0x10, 0xC0, 0xDA, 0xD3, 0x89, 0xFA, 0xF8, 0x87, 0x9D, 0xDA,
+        0x38, 0xC5, 0x76, 0xB9, 0xAA, 0xE7, 0x5A, 0x7D, 0xDE, 0xFA, 0xFA, 0x85, 0x9C, 0x38, 0xB2, 0x93,
+        0x36, 0x18, 0x66, 0x1D, 0x2A, 0xF3, 0x5B, 0xF5, 0x82, 0x9E, 0xA5, 0x2B, 0xEB, 0x35, 0x1C, 0x08,
+        0x90, 0xE3, 0xA7, 0x43, 0x3B, 0xEC, 0x9B, 0x6C, 0x0C, 0xA4, 0x93, 0x56, 0x39, 0x8F, 0x3A, 0x44,
+        0x6D, 0x2C, 0xE4, 0xE9, 0x2E, 0x8E, 0x14, 0x71, 0x75, 0xAA, 0x43, 0xD2, 0x90, 0x49, 0xB6, 0x20,
+        0x05, 0x30, 0x34, 0x48, 0xC2, 0xAC, 0x18, 0xCE, 0x97, 0x53, 0x03, 0xF0, 0x73, 0xAB, 0x15, 0x60,
+        0x14, 0xDC, 0x76, 0x03, 0x5A, 0x55, 0x45, 0x71, 0x23, 0x7C, 0x9A, 0xBC, 0x78, 0x8A, 0x27, 0xB8,
+        0xDA, 0x53, 0x75, 0x64, 0x10, 0xAD, 0xAA, 0x20, 0x02, 0x5D, 0xAB, 0x4D, 0xC3, 0xB0, 0x36, 0x2E,
+        0x63, 0xEB, 0xCA, 0x6D, 0x24, 0xC1, 0x05, 0x12, 0x68, 0xB5, 0xF4, 0x1F, 0x2C, 0x10, 0x70, 0xE8,
+        0x9B, 0x5A, 0x95, 0x4A, 0x3F, 0xD1, 0xD6, 0xC9, 0x0B, 0xB7, 0x21, 0xAB, 0x90, 0x05, 0x2C, 0xD5,
+        0xA1, 0x98, 0x2D, 0xBA, 0x85, 0x96, 0x26, 0x2D, 0xBD, 0xDE, 0x94, 0x60, 0x96, 0x41, 0x91, 0x28,
+        0x37, 0x04, 0x82, 0x50, 0xD0, 0x03, 0x1B, 0xCF, 0xE5, 0x85, 0x7E, 0x56, 0x4C, 0x24, 0x8B, 0xAB,
+        0xBF, 0xFF, 0xFB, 0xA9, 0x7F, 0xF9, 0x1A, 0x7F, 0xDE, 0xEF, 0xA0, 0x6A, 0x22, 0x86, 0x60, 0x4A,
+        0x82, 0x08, 0x31, 0x05, 0x48, 0x11, 0x02, 0x88, 0x1D, 0x03, 0x78, 0x14, 0x00, 0xF8, 0x04, 0xA7,
+        0xDB, 0x53, 0x78, 0xCE, 0x2E, 0x77, 0xC9, 0xE7, 0x01, 0xB5, 0xDB, 0x03, 0xD3, 0x7E, 0x0A, 0x75,
+        0x80, 0x50, 0xDE, 0x66, 0xA4, 0x71, 0xEF, 0xDD, 0x7A, 0x3E, 0x24, 0xDE, 0xDC, 0xDC, 0x2B, 0xCD,
+        0xC2, 0x19, 0xB2, 0x86, 0x8B, 0xD2, 0x3C, 0x43, 0xD7, 0x03, 0x2D, 0x6E, 0x8C, 0x21, 0x80, 0x7A,
+        0x66, 0x91, 0x67, 0xCA, 0x3B, 0x97, 0x95, 0x0B, 0xAF, 0x53, 0x63, 0x1D, 0x15, 0x90, 0xAF, 0x79,
+        0x74, 0xA4, 0xD1, 0x09, 0x70, 0x6B, 0xA2, 0x64, 0x7C, 0x7F, 0x01, 0xB6, 0xCC, 0x85, 0x82, 0xC2,
+        0x89, 0xAF, 0x59, 0xD4, 0x64, 0x07, 0x26, 0xE1, 0x9A, 0xB6, 0x84, 0x4B, 0xE4, 0xB3, 0x59, 0x7B,
+        0x93, 0xED, 0xF9, 0x81, 0xE1, 0xEC, 0x39, 0x57, 0x42, 0x81, 0x0F, 0x02, 0x2A, 0xF9, 0x52, 0xCF,
+        0x8C, 0x4A, 0xE4, 0x72, 0x39, 0x2B, 0xF0, 0x17, 0x06, 0x0F, 0x5A, 0xC8, 0xAB, 0x15, 0x25, 0x49,
+        0xDA, 0x38, 0x41, 0x22, 0x9C, 0x64, 0x4A, 0xEC, 0x18, 0xCF, 0x66, 0xBB, 0x32, 0x73, 0xC9, 0x72,
+        0xE5, 0xB1, 0x09, 0x8F, 0x71, 0x31, 0xC9, 0x55, 0x32, 0xF2, 0x5F, 0x10, 0x17, 0x40, 0x51, 0x11,
+        0xA7, 0x55, 0x38, 0x9B, 0x5D, 0x51, 0x69, 0xC8, 0x21, 0x9C, 0x48, 0xC1, 0xCC, 0xD5, 0xAB, 0x00,
+        0xBC, 0xFD, 0x53, 0xC3, 0x93, 0x47, 0x4F, 0x12, 0xA2, 0xFD, 0x43, 0xCF, 0x22, 0x26, 0x9E, 0xD4,
+        0x14, 0xD8, 0x56, 0x97, 0xC5, 0xE9, 0xDE, 0x40, 0x7E, 0x34, 0x3D, 0x36, 0xFA, 0xD7, 0x7C, 0x9C,
+        0x9C, 0x78, 0x1C, 0x01, 0x08, 0x0A, 0x80, 0xA0, 0x05, 0x00, 0x98, 0x0C, 0x00, 0x04, 0x03, 0x01,
+        0x99, 0x1A, 0x6E, 0xAB, 0x8D, 0x37, 0x34, 0xFE, 0x40, 0xBB, 0x05, 0x41, 0xA9, 0x09, 0x88, 0xD7,
+        0x16, 0x07, 0x71, 0x47, 0x7F, 0xD9, 0x19, 0xB1, 0x09, 0xB8, 0x91, 0x41, 0x4E, 0x27, 0x90, 0xDC,
+        0x52, 0xCD, 0x06, 0x5B, 0x30, 0x6D, 0x89, 0x14, 0xC2, 0xE2, 0xBE, 0x40, 0x0D, 0x7B, 0x27, 0x8F,
+        0xC5, 0xC6, 0x65, 0x23, 0x0E, 0xEA, 0x64, 0x4E, 0x2B, 0xDA, 0xE5, 0x09, 0x2C, 0x5A, 0x11, 0x70,
+        0x47, 0x23, 0x48, 0x86, 0xC3, 0x73, 0x39, 0xE2, 0xC9, 0x6C, 0xC9, 0x3D, 0x72, 0x32, 0x0C, 0xF3,
+        0x2D, 0x20, 0xBB, 0x1E, 0x03, 0xF3, 0xE6, 0x43, 0xD7, 0xD5, 0x94, 0xC5, 0x92, 0x95, 0xD4, 0x8E,
+        0x39, 0x99, 0x79, 0x13, 0x77, 0x2B, 0x91, 0x19, 0xF0, 0x47, 0x4E, 0x81, 0xE7, 0x88, 0xD1, 0xB9,
+        0x45, 0x24, 0x9A, 0x94, 0xD1, 0x71, 0x2B, 0xB7, 0x17, 0x92, 0xF4, 0x0A, 0x65, 0x2A, 0x04, 0xB7,
+        0x31, 0x57, 0x69, 0x47, 0x46, 0xC3, 0x6E, 0x9D, 0x53, 0x14, 0x95, 0xAC, 0x9C, 0x7A, 0x0B, 0xB3,
+        0x84, 0xEC, 0xF5, 0x22, 0x62, 0xD4, 0x3A, 0x0C, 0x34, 0xF1, 0x3F, 0x0E, 0x25, 0xE5, 0xC8, 0x59,
+        0xD9, 0x25, 0x6F, 0xD9, 0x6E, 0x95, 0xD4, 0x75, 0xB4, 0x16, 0xA6, 0x15, 0x28, 0x69, 0xC8, 0x55,
+        0x16, 0x01, 0x6D, 0x26, 0x45, 0xF4, 0x1E, 0x37, 0x45, 0x96, 0x64, 0x61, 0x64, 0x49, 0xB5, 0x31,
+        0x2B, 0x86, 0x47, 0x4E, 0x5D, 0x80, 0x02, 0x4E, 0x66, 0x73, 0x4F, 0xAF, 0xB9, 0x7B, 0xF1, 0x4D,
+        0xC3, 0xA0, 0xED, 0x7E, 0xE4, 0xD2, 0x3D, 0x50, 0xC6, 0x08, 0xB3, 0xF0, 0x3D, 0xE8, 0x92, 0x33,
+        0xC4, 0x91, 0x96, 0xE6, 0xCB, 0x90, 0x1C, 0xFB, 0x01, 0x3C, 0x92, 0x69, 0x16, 0xA5, 0xAA, 0x63,
+        0x8C, 0x71, 0x6F, 0x1D, 0xB7, 0xC4, 0x33, 0x2E, 0x31, 0x93, 0x60, 0x44, 0x4F, 0x3C, 0x5C, 0x5B,
+        0xCB, 0x44, 0xA0, 0xC0, 0x3D, 0xB3, 0x38, 0x59, 0x68, 0x47, 0x5B, 0x89, 0xB0, 0xC0, 0x6B, 0xEC,
+        0x34, 0x6B, 0xCD, 0x8D, 0x5C, 0x0B, 0x8A, 0xC2, 0x4A, 0xB7, 0x89, 0x05, 0x34, 0x81, 0x24, 0x7A,
+        0x54, 0xDA, 0x51, 0x38, 0xC7, 0xC9, 0x95, 0x83, 0xC9, 0xD2, 0x4D, 0x59, 0x6C, 0x2D, 0x9D, 0x28,
+        0xB0, 0x22, 0x05, 0x30, 0x2E, 0x03, 0x20, 0x11, 0x03, 0x10, 0x6C, 0x0A, 0x50, 0x78, 0x04, 0x81,
+        0x5B, 0x33, 0x06, 0xE7, 0xFB, 0x37, 0x7F, 0xE4, 0x75, 0xFF, 0xD5, 0x2E, 0x3F, 0xFF, 0xFF, 0xFA,
+        0xDC, 0x28, 0x65, 0x20, 0x93, 0x41, 0x01, 0x12, 0x78, 0x60, 0x66, 0x31, 0x03, 0x80, 0x86, 0xE4,
+        0xB1, 0xF2, 0x77, 0xE7, 0x22, 0xFD, 0x78, 0x21, 0xF0, 0xC0, 0xBD, 0x39, 0xF7, 0x77, 0xB6, 0x44,
+        0xE9, 0x54, 0xA3, 0x8D, 0xE1, 0x9D, 0xB0, 0x73, 0x89, 0x97, 0x96, 0x24, 0x97, 0x8F, 0x53, 0x6D,
+        0x64, 0x65, 0x56, 0xD7, 0x06, 0xF6, 0x3A, 0x04, 0xE3, 0x1E, 0x8C, 0xF0, 0xA0, 0x09, 0x99, 0x5D,
+        0xB5, 0x32, 0xB5, 0xE2, 0x48, 0x5E, 0x84, 0x3C, 0x50, 0x5E, 0x6D, 0x1B, 0x63, 0xF1, 0x69, 0xC7,
+        0xF0, 0x25, 0xFA, 0x7A, 0x13, 0xBF, 0x06, 0x6E, 0x94, 0x62, 0xC7, 0x02, 0x9E, 0x09, 0x15, 0x0A,
+        0xF2, 0x90, 0xAA, 0xF3, 0x94, 0xD6, 0x72, 0x9B, 0x94, 0x29, 0xAB, 0x59, 0x43, 0x8F, 0xC4, 0xCD,
+        0x87, 0x21, 0xCD, 0x3E, 0x11, 0x0C, 0xAE, 0xA2, 0x54, 0x6F, 0x22, 0x3A, 0xF2, 0x41, 0x84, 0xDD,
+        0x1C, 0xE7, 0xD8, 0x91, 0x82, 0xAF, 0xCB, 0xE8, 0xB0, 0x08, 0x72, 0x5E, 0x9A, 0x7F, 0x11, 0x97,
+        0x31, 0xFE, 0x21, 0x9B, 0x9B, 0x0B, 0xF0, 0x43, 0x03, 0x20, 0x0C, 0x00, 0xD8, 0x3B, 0x01, 0x50,
+        0x0A, 0x81, 0x72, 0xEA, 0x2B, 0x13, 0x4A, 0x8D, 0x0C, 0x05, 0x8F, 0xD6, 0x00, 0xEC, 0x01, 0x46,
+        0x61, 0x68, 0x06, 0xC3, 0x4B, 0xE1, 0x20, 0x63, 0x31, 0x29, 0x2F, 0x80, 0x56, 0x0D, 0x05, 0xCA,
+        0xE8, 0xF0, 0x29, 0x59, 0x5A, 0x44, 0x76, 0xA6, 0x3A, 0x14, 0xC4, 0xCD, 0xA0, 0x8A, 0xBE, 0x6D,
+        0x5A, 0x4B, 0xE0, 0xCA, 0x7E, 0x27, 0xCB, 0x91, 0x56, 0x99, 0x63, 0x23, 0x0F, 0x5A, 0x4C, 0x3B,
+        0xCC, 0x92, 0xF0, 0xB0, 0x68, 0x22, 0x8A, 0x4B, 0x33, 0x05, 0xE6, 0x1D, 0x83, 0x71, 0x70, 0xDC,
+        0x16, 0x7D, 0x20, 0xB2, 0x72, 0x14, 0xEB, 0xEC, 0x20, 0x8A, 0x08, 0xD0, 0xDF, 0xB0, 0xB6, 0xAB,
+        0xDB, 0x99, 0xE6, 0xAC, 0xE6, 0xC7, 0x89, 0x56, 0x52, 0x63, 0x43, 0x94, 0x1C, 0xB7, 0xA4, 0x6B,
+        0xD6, 0x46, 0x61, 0xBF, 0xD5, 0xAE, 0x3D, 0x93, 0xD7, 0x75, 0x1E, 0xFF, 0x25, 0x61, 0x52, 0x22,
+        0xF4, 0xE0, 0x4F, 0x1F, 0xD1, 0xB6, 0x1A, 0x92, 0xF3, 0x06, 0x00, 0x26, 0x31, 0xC9, 0x05, 0x68,
+        0x42, 0xD2, 0xBC, 0x97, 0xC5, 0x29, 0x08, 0x91, 0x57, 0x83, 0x7B, 0x27, 0x0F, 0x25, 0x70, 0x34,
+        0x2D, 0x0B, 0xF6, 0x29, 0x33, 0x5C, 0x69, 0x95, 0xD6, 0x42, 0xCC, 0x66, 0x29, 0xA0, 0xC5, 0x38,
+        0x89, 0x27, 0x2A, 0x22, 0x2C, 0xBA, 0x2F, 0xA7, 0xDD, 0xCE, 0xD8, 0x2A, 0xD3, 0x02, 0x32, 0xB3,
+        0xE2, 0x17, 0x5F, 0x50, 0x75, 0xB3, 0x17, 0x0B, 0xB8, 0x3B, 0x42, 0x9D, 0x9C, 0xE9, 0xD5, 0x4A,
+        0xF7, 0x3F, 0xA7, 0xC0, 0x0D, 0x33, 0x2C, 0xB3, 0xA5, 0x97, 0xF1, 0x5D, 0xD2, 0x7B, 0xA5, 0x10,
+        0xEA, 0xDA, 0xEC, 0x5C, 0x32, 0x24, 0x5A, 0xD9, 0xBB, 0xBD, 0x58, 0x90, 0x02, 0x4E, 0xAA, 0xDD,
+        0x9B, 0x1C, 0xBD, 0x17, 0xBD, 0x17, 0x4E, 0xBC, 0x19, 0x50, 0x9A, 0xB8, 0xEE, 0x2B, 0xCB, 0xA2,
+        0x3C, 0x3C, 0x47, 0xCF, 0x62, 0x97, 0x1A, 0xD0, 0x96, 0x2B, 0x04, 0x47, 0xA4, 0xEA, 0x34, 0x0B,
+        0xA3, 0x0A, 0x56, 0x4C, 0x24, 0x9B, 0x9D, 0x9B, 0x09, 0xC6, 0xC4, 0xC8, 0x3B, 0xBA, 0x79, 0x21,
+        0xC3, 0x22, 0x68, 0xC6, 0x98, 0x24, 0xCA, 0xA5, 0x4F, 0x5F, 0xD5, 0xDA, 0x4E, 0x2E, 0x53, 0x26,
+        0x4D, 0xA6, 0xCD, 0x94, 0x93, 0x3D, 0x6C, 0xC5, 0xAC, 0x86, 0xAE, 0x24, 0xEA, 0xE7, 0xAF, 0xC9,
+        0xB4, 0x73, 0x02, 0x96, 0x6A, 0xED, 0xC4, 0x1B, 0x5C, 0xB2, 0xAE, 0x81, 0x58, 0x5A, 0x78, 0x51,
+        0x5B, 0x72, 0x15, 0x34, 0x92, 0x4D, 0xB4, 0xEC, 0xC2, 0x7D, 0x9C, 0xA0, 0xCC, 0x4D, 0x33, 0x62,
+        0xE3, 0x2F, 0x05, 0xE6, 0x33, 0xC6, 0x80, 0x3E, 0x0B, 0x1D, 0xFC, 0x83, 0x33, 0x1E, 0x9E, 0x6B,
+        0x31, 0xD5, 0xEC, 0x2F, 0x1F, 0x09, 0x75, 0xD0, 0x11, 0x76, 0x1C, 0x8A, 0x9D, 0x80, 0xB0, 0x19,
+        0x03, 0xC8, 0x50, 0x05, 0x28, 0x43, 0x02, 0x78, 0x01, 0x06, 0x21, 0x06, 0x9C, 0xE2, 0x87, 0xA0,
+        0x44, 0xE2, 0x3F, 0xFE, 0x2C, 0x1F, 0x90, 0x3D, 0x7F, 0xFF, 0x19, 0xB3, 0x26, 0xA1, 0x18, 0x1A,
+        0x32, 0x38, 0x22, 0xA0, 0x0F, 0x89, 0x70, 0xA4, 0x17, 0xC1, 0x00, 0x55, 0x01, 0x40, 0x74, 0x1F,
+        0xAA, 0xD2, 0x6E, 0xBC, 0xED, 0xD3, 0x80, 0xCF, 0xA9, 0x5E, 0xEA, 0x08, 0xD9, 0xAC, 0x90, 0xDF,
+        0xA4, 0x8C, 0xEB, 0x20, 0x35, 0xA2, 0xAF, 0x18, 0x91, 0x85, 0x2B, 0x3B, 0x0C, 0xB8, 0x0E, 0xC9,
+        0x59, 0x8B, 0xA1, 0x4E, 0x97, 0x06, 0x93, 0xB0, 0x56, 0xA2, 0x79, 0x38, 0x02, 0x5F, 0x9C, 0x02,
+        0x30, 0x68, 0x2B, 0x3E, 0xF4, 0x13, 0x6C, 0x03, 0x80, 0x1C, 0x03, 0x41, 0x8C, 0x46, 0x25, 0x33,
+        0xE3, 0xCB, 0xF1, 0x6D, 0x6F, 0xAF, 0xE5, 0xB1, 0x80, 0xB0, 0x60, 0x01, 0x40, 0x3A, 0x00, 0xD0,
+        0x1B, 0xAF, 0xC2, 0x08, 0xE8, 0xDB, 0x59, 0xF2, 0xBB, 0x13, 0x4A, 0xE8, 0x06, 0xAF, 0x21, 0x77,
+        0x95, 0x6B, 0x10, 0xE7, 0x21, 0x20, 0x27, 0x90, 0x10, 0xCB, 0x55, 0xF6, 0x97, 0x39, 0x60, 0x3C,
+        0xFC, 0x66, 0x19, 0x2A, 0xF4, 0xBA, 0x0C, 0x0F, 0x2F, 0x78, 0x58, 0xE9, 0xB1, 0x16, 0xF4, 0x33,
+        0x87, 0x36, 0x2D, 0x66, 0xF8, 0x3B, 0x55, 0xB0, 0x39, 0x53, 0x10, 0xD3, 0x88, 0xB0, 0x09, 0x67,
+        0x64, 0x04, 0x6C, 0x18, 0xBD, 0x69, 0x77, 0x47, 0x95, 0x7F, 0x9B, 0xBE, 0x67, 0x67, 0x88, 0x8A,
+        0x7D, 0x83, 0xC2, 0x96, 0x11, 0xEA, 0x8B, 0x5D, 0x91, 0x56, 0x28, 0x15, 0xD7, 0xC9, 0x16, 0xF4,
+        0x66, 0x4B, 0xE5, 0xDD, 0xA6, 0xA9, 0xA5, 0xA6, 0x46, 0x61, 0xB8, 0x57, 0xA4, 0x8E, 0xBD, 0xC6,
+        0x6B, 0x17, 0x47, 0x3F, 0x21, 0xB8, 0xEC, 0x75, 0xA8, 0x29, 0x16, 0x49, 0x2F, 0x9F, 0xB2, 0x94,
+        0xCF, 0x10, 0xCF, 0x05, 0x0B, 0x36, 0x94, 0xD3, 0x69, 0x36, 0x9C, 0x82, 0x65, 0xBC, 0xD5, 0x78,
+        0x0F, 0x51, 0x53, 0xE8, 0x1E, 0xDC, 0xE9, 0x60, 0xD6, 0xA2, 0xAE, 0x12, 0xF2, 0x5C, 0x51, 0x35,
+        0x66, 0x65, 0x57, 0x98, 0x65, 0x79, 0x84, 0xD1, 0xB4, 0x8A, 0x22, 0x2D, 0x05, 0x32, 0x4E, 0x55,
+        0x3E, 0x4A, 0x6E, 0x96, 0x5E, 0x24, 0xED, 0xD0, 0xEE, 0x15, 0x3A, 0x56, 0x5E, 0xA4, 0x5A, 0xAE,
+        0x48, 0xC5, 0xCC, 0x4C, 0x18, 0xAD, 0x18, 0xEA, 0x0B, 0x15, 0x2F, 0xE0, 0xCA, 0xFC, 0x09, 0xA7,
+        0x01, 0xB7, 0xE6, 0x75, 0x2A, 0x2A, 0xD1, 0x50, 0x79, 0x3A, 0xBA, 0x49, 0xD9, 0xAC, 0x44, 0xF7,
+        0x0C, 0x8A, 0x98, 0x1A, 0xB5, 0x3A, 0x51, 0xE0, 0x8D, 0x22, 0xA3, 0x08, 0x73, 0x72, 0xA6, 0x0A,
+        0xAD, 0x19, 0x1A, 0xE3, 0x34, 0xEE, 0x9B, 0xA7, 0x57, 0x77, 0xF5, 0xAC, 0x85, 0x28, 0xCA, 0x71,
+        0xF5, 0x54, 0x01, 0x4B, 0x10, 0x7C, 0xD3, 0x47, 0xB1, 0x5C, 0xB8, 0x15, 0xA7, 0x26, 0x08, 0xA3,
+        0x3F, 0x00, 0x2C, 0xBC, 0xBB, 0xE5, 0x91, 0xC2, 0x42, 0xDD, 0x03, 0x54, 0xAA, 0x62, 0x83, 0x93,
+        0x87, 0x72, 0x12, 0x3E, 0x08, 0xD0, 0x68, 0x1A, 0x7C, 0x25, 0x5A, 0x78, 0x4D, 0x4F, 0x6C, 0xE5,
+        0xD8, 0x52, 0x52, 0x4A, 0xF4, 0x42, 0xDC, 0x00, 0x87, 0x81, 0x95, 0xA2, 0x48, 0x50, 0xA9, 0x92,
+        0xBD, 0x53, 0x78, 0xF1, 0x2B, 0x9F, 0x06, 0x0C, 0x31, 0x44, 0x97, 0xE4, 0x98, 0xFC, 0x4A, 0x14,
+        0x0C, 0xAF, 0x2B, 0x2F, 0x5F, 0x02, 0xBF, 0x08, 0x1E, 0x29, 0xE1, 0xCC, 0x1A, 0xB8, 0xFF, 0x48,
+        0xE7, 0x40, 0x12, 0xC9, 0x2B, 0x9A, 0x04, 0xA7, 0x04, 0xEF, 0xC0, 0x6B, 0xF8, 0x03, 0x84, 0x38,
+        0x92, 0x18, 0xEC, 0x04, 0xAA, 0x91, 0x33, 0x46, 0x99, 0x03, 0x89, 0x76, 0xA4, 0xDC, 0x25, 0xC4,
+        0xB8, 0x1C, 0x90, 0x4D, 0x1A, 0xE8, 0x3B, 0x58, 0x8A, 0x8D, 0x91, 0x4F, 0x98, 0x71, 0xC3, 0x71,
+        0x5B, 0x71, 0xF3, 0xE2, 0x46, 0x4E, 0x7A, 0x9A, 0xBC, 0x11, 0xA6, 0xE6, 0xC3, 0x24, 0x0D, 0x22,
+        0x2A, 0xBC, 0x40, 0xBD, 0xCA, 0x0D, 0x77, 0x23, 0x87, 0x51, 0xD5, 0x86, 0xC0, 0x50, 0x00, 0x00,
+        0x7C, 0x1B, 0x02, 0x7C, 0x2C, 0x83, 0xD4, 0x66, 0xFF, 0x51, 0x2F, 0xFF, 0xF7, 0x96, 0xF8, 0x72,
+        0x22, 0xA0, 0xED, 0x22, 0xD0, 0xC7, 0x1C, 0x05, 0x8F, 0xB1, 0x40, 0x0F, 0xB0, 0xCB, 0x12, 0x04,
+        0x4D, 0x7E, 0x3B, 0xFF, 0xFC, 0x69, 0xFF, 0xE2, 0xE7, 0x75, 0xB2, 0xCB, 0x21, 0x91, 0xB1, 0x1B,
+        0xD1, 0x9B, 0x1B, 0xB8, 0x96, 0x68, 0x9A, 0x9E, 0x5F, 0x97, 0x65, 0x79, 0x3E, 0x41, 0x90, 0xE3,
+        0x78, 0x06, 0x2F, 0x88, 0x5A, 0xB0, 0xEC, 0x16, 0xF5, 0x5B, 0x4D, 0xAE, 0x8B, 0x4B, 0xAF, 0xD0,
+        0x66, 0xB2, 0x79, 0xFC, 0x4E, 0x4B, 0x2D, 0x7D, 0x80, 0xC9, 0xDA, 0xB7, 0x03, 0x83, 0xA3, 0x89,
+        0xBF, 0xB5, 0x95, 0xBB, 0x97, 0x89, 0x93, 0x9F, 0x66, 0xB6, 0x25, 0x72, 0xD3, 0xE4, 0x96, 0xAF,
+        0x46, 0x3B, 0x3B, 0x30, 0x41, 0x02, 0xAA, 0x64, 0xCB, 0x43, 0x82, 0xBD, 0x34, 0x0B, 0x08, 0x95,
+        0x6C, 0x4E, 0x0C, 0x39, 0x0A, 0x8D, 0xC0, 0xC2, 0x44, 0xE6, 0xD9, 0xC0, 0xA0, 0x6A, 0x98, 0xD1,
+        0x48, 0x99, 0x34, 0x58, 0x7B, 0xBA, 0x03, 0x76, 0xE9, 0xA4, 0xE0, 0xCC, 0x8D, 0x5B, 0x94, 0x63,
+        0x37, 0x07, 0x81, 0x5A, 0x02, 0xD4, 0x98, 0x81, 0x3A, 0x01, 0xD7, 0x36, 0x96, 0x8C, 0xAA, 0xC6,
+        0xC0, 0xD8, 0x52, 0x06, 0x04, 0x81, 0x20, 0x58, 0x80, 0xD6, 0x12, 0x81, 0x33, 0x08, 0xC6, 0xAB,
+        0x62, 0x0D, 0x32, 0xB2, 0x8D, 0x52, 0x90, 0x65, 0xA5, 0x80, 0xD5, 0x86, 0x14, 0x91, 0x02, 0x53,
+        0xD8, 0x0C, 0x19, 0x8C, 0x32, 0x9A, 0x0B, 0x08, 0x59, 0xD5, 0x87, 0x9D, 0x70, 0x28, 0x59, 0x0A,
+        0x19, 0x51, 0xE4, 0x2B, 0x2D, 0x40, 0xD0, 0xD2, 0x11, 0x08, 0x87, 0x35, 0x4A, 0xC1, 0x6A, 0x4C,
+        0x55, 0x84, 0xFC, 0x46, 0x2F, 0x56, 0xE5, 0x74, 0x04, 0x1E, 0xAD, 0x86, 0x9B, 0x73, 0x31, 0x26,
+        0x69, 0x9D, 0xAA, 0x20, 0x78, 0x09, 0x04, 0x9D, 0x07, 0xBB, 0x14, 0x94, 0x27, 0x80, 0xAA, 0xC9,
+        0x22, 0x2A, 0xEA, 0x2D, 0x1C, 0x4A, 0x45, 0x48, 0xB9, 0x39, 0x28, 0xB7, 0x07, 0xC1, 0x48, 0x7B,
+        0x07, 0x16, 0xA2, 0x13, 0x25, 0x90, 0xA7, 0x26, 0x03, 0xE0, 0xD5, 0xC9, 0x9F, 0x01, 0xAB, 0x57,
+        0xA2, 0x1E, 0x04, 0x11, 0x28, 0xE8, 0x24, 0x7B, 0x00, 0x2D, 0x8C, 0x25, 0x0A, 0x0C, 0xD5, 0x21,
+        0x05, 0xB0, 0x0B, 0xE8, 0x82, 0xBE, 0x26, 0x05, 0x98, 0x98, 0x39, 0x80, 0x8A, 0xB1, 0xC9, 0xC5,
+        0x66, 0x9C, 0x1A, 0x0A, 0x69, 0x87, 0x05, 0x51, 0x24, 0x76, 0x4D, 0x0A, 0xB6, 0x47, 0x70, 0x02,
+        0x5D, 0x2D, 0x29, 0x69, 0xE1, 0x4F, 0x40, 0x84, 0x41, 0x41, 0x35, 0x61, 0x04, 0x9A, 0x0A, 0x2A,
+        0xD1, 0x24, 0xEB, 0x52, 0x96, 0x22, 0x52, 0xCD, 0x1C, 0xEA, 0x83, 0x4E, 0x96, 0xF0, 0xAE, 0x9C,
+        0xC5, 0x39, 0x43, 0x41, 0x47, 0x85, 0xFF, 0xFE, 0x9D, 0xFE, 0xD0, 0x1F, 0x83, 0x07, 0xFD, 0x9A,
+        0x73, 0xEB, 0x0A, 0x90, 0xC6, 0x17, 0x50, 0xFE, 0x0C, 0x10, 0x24, 0x03, 0x50, 0x02, 0x01, 0xF0,
+        0x4F, 0x04, 0x00, 0x53, 0x49, 0xC5, 0x4E, 0xB2, 0x97, 0xA4, 0x03, 0xDE, 0xB8, 0xB3, 0xDA, 0x37,
+        0x9E, 0xB7, 0xC3, 0xF3, 0x50, 0xD5, 0x53, 0xD7, 0x3B, 0x2F, 0x8A, 0x4C, 0xFB, 0xE4, 0xBC, 0x57,
+        0x2E, 0x79, 0xE5, 0x1E, 0xAD, 0x0D, 0x46, 0x09, 0x78, 0xEE, 0x9E, 0xDA, 0x05, 0x59, 0x99, 0x9E,
+        0x27, 0x5A, 0xFD, 0x49, 0x5A, 0x19, 0x6D, 0x3A, 0x0F, 0x4C, 0x93, 0x79, 0xF2, 0x60, 0xCE, 0x5B,
+        0x10, 0xF6, 0xDC, 0x4D, 0xB6, 0x59, 0xAC, 0x1A, 0xB3, 0xB1, 0x06, 0xAE, 0x44, 0xC1, 0xEB, 0xA3,
+        0x46, 0x9A, 0xA0, 0xB4, 0x74, 0x0A, 0x77, 0x2B, 0x0D, 0xC8, 0xED, 0x7D, 0x57, 0xDB, 0xA9, 0x85,
+        0xC7, 0x90, 0x30, 0xD4, 0x55, 0xA8, 0xD0, 0xE8, 0x03, 0x1D, 0x26, 0x0D, 0xD3, 0xFA, 0xFF, 0x0D,
+        0x57, 0x24, 0xB3, 0x6C, 0x82, 0x44, 0xB8, 0x07, 0x1D, 0x4E, 0xC6, 0xE3, 0x47, 0x51, 0xE1, 0xD4,
+        0x78, 0x35, 0x74, 0xCC, 0xAC, 0x76, 0x18, 0xA0, 0x1D, 0x9C, 0x76, 0x58, 0xC9, 0x58, 0x76, 0x1F,
+        0x1D, 0x19, 0x92, 0x06, 0xE7, 0xEE, 0x7C, 0x76, 0x3A, 0xD5, 0x60, 0xB5, 0x7A, 0x25, 0x85, 0x30,
+        0x12, 0x7B, 0x15, 0x68, 0xF3, 0x36, 0xDE, 0x45, 0xBE, 0xC8, 0x5A, 0x8E, 0x14, 0x12, 0xD8, 0x53,
+        0xC4, 0x5A, 0xF8, 0x9B, 0x2B, 0x28, 0x8D, 0x18, 0x6C, 0x38, 0x14, 0x79, 0x5D, 0x82, 0xF2, 0xE4,
+        0xA4, 0xBC, 0x9A, 0x54, 0xDB, 0x50, 0x47, 0x40, 0xA6, 0xDE, 0x32, 0xAB, 0x51, 0x28, 0xA1, 0x42,
+        0x9D, 0x80, 0x30, 0x10, 0x01, 0x78, 0x14, 0x02, 0x68, 0x44, 0x05, 0xA9, 0xE4, 0xF1, 0x25, 0xF9,
+        0x71, 0x91, 0xDF, 0xE2, 0xAD, 0xA2, 0xD1, 0xAB, 0x03, 0xF8, 0x5F, 0x2E, 0x9F, 0x94, 0x98, 0xBD,
+        0x45, 0xE1, 0x11, 0x8C, 0xAC, 0x6B, 0x42, 0x05, 0x41, 0xA4, 0x3D, 0xD8, 0x0C, 0xED, 0x90, 0xB3,
+        0xAA, 0x37, 0x62, 0x52, 0x6C, 0xDC, 0x98, 0x60, 0xB2, 0x5D, 0x17, 0x56, 0xC5, 0x68, 0xCF, 0x14,
+        0x10, 0x3F, 0x51, 0xE6, 0x7E, 0x03, 0xC7, 0xD2, 0x11, 0x2C, 0x9C, 0xA4, 0x13, 0xFC, 0x93, 0x58,
+        0x68, 0x18, 0x6E, 0x9D, 0xB4, 0x2E, 0x6A, 0x66, 0x77, 0x97, 0xC0, 0x6F, 0x54, 0xCA, 0x77, 0xE5,
+        0xD7, 0x0B, 0x71, 0x93, 0x6F, 0x4C, 0x0F, 0x59, 0x57, 0x0E, 0x7B, 0x13, 0xDF, 0xCB, 0xEB, 0xE1,
+        0x98, 0x0A, 0x24, 0xD8, 0x43, 0x56, 0x73, 0x66, 0xDE, 0x82, 0x10, 0xAB, 0xBA, 0xF3, 0xA5, 0x90,
+        0xAF, 0x06, 0x93, 0x5D, 0xC2, 0xCA, 0x2B, 0x11, 0x14, 0xF5, 0xA6, 0x0E, 0x3B, 0x00, 0x77, 0xA9,
+        0x4B, 0x87, 0x47, 0x2E, 0x25, 0x6D, 0x89, 0x00, 0x18, 0xE2, 0x43, 0xDE, 0xC6, 0xD8, 0xDC, 0xFA,
+        0x91, 0x8C, 0x89, 0x24, 0x74, 0xE6, 0x57, 0x87, 0x34, 0x99, 0xD0, 0x28, 0x2D, 0x88, 0x36, 0xA5,
+        0x89, 0xAF, 0x74, 0x74, 0xC1, 0x36, 0x12, 0xE0, 0xCB, 0x10, 0x8B, 0x5A, 0x62, 0x1D, 0xEC, 0xBB,
+        0x6C, 0x13, 0x4F, 0x0E, 0xEB, 0xF7, 0xFA, 0x13, 0xBD, 0x15, 0xC1, 0xAC, 0xF7, 0x07, 0x4E, 0xE9,
+        0xED, 0xD8, 0xBA, 0x60, 0x92, 0xF4, 0x26, 0x2C, 0x34, 0xEA, 0x1F, 0x0C, 0xC0, 0x02, 0x4A, 0x8D,
+        0x39, 0x7B, 0xB9, 0xDF, 0xE4, 0xD2, 0x99, 0x03, 0x8F, 0x32, 0x31, 0xA6, 0xA5, 0xD3, 0x92, 0xB7,
+        0x61, 0xD9, 0x0A, 0xE6, 0x3D, 0x79, 0xA4, 0xE7, 0x51, 0x6E, 0x2A, 0xCC, 0x02, 0x61, 0xC6, 0x1A,
+        0x3C, 0x09, 0x5B, 0x2A, 0x58, 0x9E, 0x90, 0x3B, 0x28, 0x72, 0x45, 0xD7, 0x82, 0xCF, 0x5E, 0x8D,
+        0x1B, 0x5F, 0x25, 0x49, 0xAF, 0x14, 0x60, 0x89, 0xA7, 0xAA, 0xBC, 0x54, 0xAA, 0x10, 0x54, 0xB4,
+        0x6B, 0xAA, 0xDE, 0xC9, 0x0B, 0x7F, 0x66, 0xD2, 0xE6, 0x8F, 0x0F, 0x13, 0xD1, 0xF6, 0x16, 0x55,
+        0x49, 0x8C, 0x19, 0x05, 0xA6, 0x68, 0xB0, 0xAB, 0x42, 0x75, 0xC1, 0x76, 0xB7, 0x58, 0xF2, 0xA0,
+        0x6B, 0x64, 0x5A, 0x6A, 0x81, 0x1B, 0x7E, 0xC6, 0xCB, 0xC1, 0x8E, 0x1C, 0x0E, 0xD3, 0x06, 0x0C,
+        0xE5, 0xE2, 0x4D, 0x68, 0x32, 0xDC, 0x24, 0x73, 0xE8, 0xBB, 0x95, 0x58, 0x21, 0x7E, 0x64, 0x5D,
+        0xB8, 0xA3, 0x0B, 0x15, 0x48, 0x73, 0x61, 0x05, 0x96, 0xB7, 0x99, 0x33, 0x96, 0xA3, 0x4E, 0x2C,
+        0x1A, 0x49, 0x62, 0x6B, 0xD0, 0xF6, 0x89, 0x92, 0x1B, 0x12, 0x48, 0x29, 0x36, 0x0C, 0xDC, 0x45,
+        0xE0, 0xB7, 0xFB, 0xCA, 0xF6, 0xFE, 0x82, 0xC8, 0x2C, 0xD6, 0x94, 0x8D, 0x60, 0x06, 0x93, 0xFF,
+        0xE4, 0x25, 0xAB, 0xCF, 0xFD, 0xF3, 0x59, 0x4C, 0x60, 0x8A, 0x94, 0x7D, 0x06, 0xD4, 0x43, 0x83,
+        0x2C, 0x00, 0x52, 0x4F, 0xE3, 0xD1, 0xD6, 0x3E, 0xB5, 0xC3, 0xC2, 0x77, 0xEB, 0x5A, 0xF4, 0xDB,
+        0x60, 0x2C, 0x07, 0x20, 0x02, 0x05, 0xA0, 0x5C, 0x0E, 0x60, 0x50, 0x00, 0xC1, 0x7A, 0x27, 0x8C,
+        0x8F, 0xE2, 0x9F, 0xFD, 0xFB, 0xFB, 0x2D, 0x7F, 0x4B, 0x47, 0x3C, 0x6F, 0xBE, 0xB0, 0xCF, 0xF1,
+        0x8D, 0xDB, 0x13, 0x94, 0x2A, 0x0E, 0xB1, 0x9B, 0x05, 0x01, 0x09, 0xA7, 0x93, 0x55, 0x61, 0xF4,
+        0x42, 0x8E, 0xC7, 0xCB, 0xEE, 0x1C, 0x7B, 0xAC, 0xC6, 0x9C, 0xC0, 0x60, 0x30, 0x53, 0x66, 0xA7,
+        0xDB, 0xC5, 0x8A, 0x3A, 0xFC, 0x16, 0xA6, 0x84, 0x1D, 0x3A, 0xA9, 0x66, 0x28, 0x5B, 0x8A, 0x8C,
+        0x73, 0x5D, 0x6A, 0x81, 0x3A, 0x0B, 0x3B, 0x91, 0x5F, 0x9C, 0xA4, 0x11, 0x64, 0x22, 0xCE, 0x24,
+        0x94, 0x81, 0x4F, 0x81, 0x49, 0x6D, 0xD3, 0x61, 0x5F, 0x57, 0x5C, 0xCE, 0x91, 0x69, 0xBD, 0x02,
+        0x9A, 0xC6, 0x3A, 0x64, 0x46, 0x53, 0xA4, 0x7B, 0x34, 0x15, 0x58, 0xAB, 0x42, 0xAB, 0x40, 0x69,
+        0xEB, 0x40, 0x46, 0x0D, 0x24, 0x59, 0xA4, 0xDA, 0x34, 0xDB, 0xB9, 0xC7, 0xDD, 0xCA, 0x3C, 0x47,
+        0xA7, 0x13, 0x69, 0xBA, 0xC5, 0xBA, 0x45, 0x46, 0x63, 0xDE, 0x75, 0x76, 0x96, 0x8E, 0xB1, 0x8B,
+        0xA3, 0x41, 0x53, 0x87, 0x40, 0x6B, 0x32, 0x12, 0x9E, 0xC2, 0x17, 0xEA, 0x42, 0xC3, 0x49, 0xC4,
+        0xBD, 0x42, 0x8B, 0x3C, 0x90, 0x63, 0xB8, 0xD9, 0x53, 0xD5, 0x9D, 0xBA, 0x94, 0xF8, 0xB8, 0xC9,
+        0xC7, 0x3A, 0x45, 0x92, 0xA4, 0x36, 0xCD, 0x21, 0x6C, 0xDA, 0x40, 0x67, 0xA2, 0x4C, 0xE9, 0xE2,
+        0xB5, 0xBB, 0x31, 0x8C, 0x1A, 0xB2, 0xA9, 0x09, 0x58, 0x79, 0xB4, 0xC7, 0xCD, 0x2C, 0xF5, 0x1B,
+        0x0A, 0x30, 0x61, 0x62, 0x60, 0xD3, 0xA7, 0xE4, 0x7E, 0x74, 0x55, 0x87, 0x12, 0x35, 0xC1, 0x14,
+        0xA9, 0x4B, 0x20, 0xE7, 0xE0, 0xA6, 0xDE, 0x46, 0x73, 0xDC, 0x86, 0xB6, 0x6A, 0x58, 0x90, 0x03,
+        0xB7, 0xDD, 0x39, 0xC3, 0xAB, 0xAD, 0x5B, 0x38, 0x4B, 0x98, 0xEF, 0x43, 0x2B, 0x0D, 0x8E, 0xC6,
+        0xA7, 0x2B, 0x7F, 0x10, 0xF4, 0xEA, 0x3E, 0x74, 0xC9, 0x36, 0xF2, 0x66, 0xBC, 0xB8, 0xA1, 0xAF,
+        0x33, 0x3A, 0xF4, 0x59, 0xE7, 0x4C, 0x95, 0x37, 0x6E, 0xE3, 0xA4, 0xD0, 0x5F, 0x31, 0xB7, 0xF1,
+        0x02, 0xD4, 0x46, 0x4D, 0xA1, 0xC4, 0xFC, 0xB8, 0x80, 0x01, 0xCF, 0x59, 0x27, 0xF1, 0xF4, 0x27,
+        0x2F, 0x74, 0x29, 0x33, 0x61, 0x0C, 0x28, 0x11, 0x69, 0xC5, 0xEE, 0x1A, 0x20, 0xBA, 0x01, 0x74,
+        0x13, 0xE0, 0x06, 0x02, 0x00, 0x02, 0x07, 0xFF, 0xBD, 0xF3, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x2A,
+        0x9E, 0x62, 0x8F, 0xF8, 0xB8, 0xDA, 0x1D, 0x7D, 0x3E, 0x72, 0x73, 0x27, 0x43, 0x09, 0x9C, 0x88,
+        0x58, 0xA0, 0x22, 0xD4, 0x05, 0xF0, 0x0D, 0x0A, 0xFF, 0xF4, 0xF7, 0xBE, 0x00, 0xB7, 0xC7, 0x60,
+        0x81, 0xC3, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x0A, 0xA9, 0x18, 0xA5, 0xE1, 0x71, 0x40,
+        0x01, 0xBF, 0x98, 0x57, 0xFF, 0xDF, 0x5B, 0xFF, 0xA8, 0x93, 0xD0, 0x03, 0x40, 0x02, 0x00, 0x00,
+        0x00, 0x80, 0x08, 0x00, 0x80, 0x08, 0x00, 0x80, 0x08, 0x01, 0x80, 0x08, 0x01, 0x8A, 0xED, 0x6E,
+        0xDB, 0xB6, 0xED, 0xBD, 0xC0, 0x01, 0x80, 0x0C, 0x00, 0xE0, 0x03, 0x00, 0x2F, 0xA0, 0xC7, 0xFF,
+        0x99, 0xDE, 0x0B, 0x50, 0x72, 0x80, 0x3C, 0x00, 0xA0, 0x03, 0x00, 0x18, 0x01, 0x40, 0x02, 0x00,
+        0x31, 0x75, 0x5B, 0x55, 0x51, 0xA8, 0x25, 0x23, 0x90, 0x80, 0x40, 0x20, 0x00, 0x01, 0x80, 0x00,
+        0xC0, 0x60, 0x03, 0x03, 0xC1, 0x80, 0x18, 0x60, 0x60, 0x0C, 0x3C, 0x18, 0x03, 0x06, 0x0C, 0x01,
+        0x86, 0x0F, 0x06, 0x01, 0x83, 0x06, 0x00, 0xC3, 0xC1, 0x80, 0x30, 0xC1, 0x83, 0x00, 0xC1, 0xE0,
+        0xC0, 0x30, 0x60, 0xC3, 0x00, 0x78, 0x30, 0x60, 0x30, 0x61, 0x83, 0xC0, 0x18, 0x60, 0xC0, 0x18,
+        0x30, 0xC1, 0xE0, 0x0C, 0x18, 0x60, 0x0C, 0x18, 0x3C, 0x03, 0x06, 0x0C, 0x18, 0x06, 0x0F, 0x06,
+        0x00, 0xC3, 0x06, 0x00, 0xC1, 0x87, 0x83, 0x00, 0x60, 0xC1, 0x80, 0x60, 0xF0, 0x60, 0x0C, 0x30,
+        0x60, 0xC0, 0x18, 0x3C, 0x18, 0x06, 0x0C, 0x18, 0x03, 0x07, 0x86, 0x0C, 0x01, 0x83, 0x06, 0x00,
+        0xF0, 0xC1, 0x80, 0x30, 0x60, 0xC1, 0x80, 0x3C, 0x00, 0x01, 0xBF, 0xDF, 0x4B, 0xFF, 0xFB, 0xBC,
+        0x7F, 0xA6, 0x41, 0xDC, 0x01, 0x90, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00,
+        0x00, 0x08, 0x01, 0x80, 0x08, 0x00, 0x8D, 0x5B, 0x6D, 0xB6, 0xDD, 0x77, 0x69, 0x4B, 0x99, 0x73,
+        0x2E, 0x65, 0xDC, 0xBB, 0x92, 0x9B, 0x73, 0x73, 0x6E, 0xE6, 0xDD, 0xCD, 0xC9, 0x5B, 0xBB, 0x9B,
+        0xB7, 0x73, 0x77, 0x37, 0x32, 0x57, 0x77, 0x37, 0x6E, 0xEE, 0xE6, 0xED, 0xDD, 0xE0, 0x01, 0xC0,
+        0x0A, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x03, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x50,
+        0x03, 0x80, 0x1F, 0xFE, 0x1A, 0xFF, 0xFA, 0xD5, 0x52, 0xFE, 0x7F, 0xFF, 0xEF, 0x35, 0x53, 0x33,
+        0x51, 0x51, 0x13, 0x33, 0x10, 0x5D, 0x2E, 0x44, 0x70, 0x00, 0x00, 0xF0, 0x0C, 0x31, 0xE3, 0x30,
+        0x1E, 0x66, 0x79, 0x99, 0xE6, 0x06, 0x67, 0x9B, 0x3C, 0xCD, 0xE0, 0x66, 0x7B, 0x33, 0xD9, 0x9E,
+        0x0C, 0xCF, 0x66, 0x7B, 0x37, 0x98, 0x1B, 0xCD, 0x99, 0xEC, 0xCF, 0x60, 0x6F, 0x36, 0x79, 0xB3,
+        0xD9, 0x81, 0xEC, 0xDE, 0x66, 0xF3, 0x67, 0x81, 0xB3, 0x79, 0xB3, 0xCD, 0xBC, 0x0C, 0xDE, 0x6C,
+        0xF3, 0x67, 0xB0, 0x37, 0x99, 0xBC, 0xD9, 0xE6, 0xC0, 0xDE, 0x66, 0xF3, 0x67, 0x9B, 0x03, 0xD9,
+        0xBC, 0xCD, 0xE6, 0xCF, 0x03, 0x67, 0xB3, 0x3D, 0x9B, 0x3C, 0x0D, 0x9E, 0xCC, 0xF6, 0x6F, 0x30,
+        0x37, 0x9B, 0x3C, 0xD9, 0xEC, 0xC0, 0xF6, 0x67, 0xB3, 0x67, 0x9B, 0x03, 0xD9, 0x9E, 0xCD, 0xE6,
+        0x6F, 0x03, 0x67, 0x9B, 0x3C, 0xD9, 0xEC, 0x0C, 0xF6, 0x6C, 0xF3, 0x67, 0x98, 0x33, 0xD9, 0x9E,
+        0xCD, 0xE6, 0x60, 0xF3, 0x37, 0x9B, 0x3C, 0xD9, 0xE0, 0x6C, 0xDE, 0x66, 0xF3, 0x37, 0x81, 0xB3,
+        0xCD, 0x9E, 0x6C, 0xF6, 0x06, 0x7B, 0x33, 0xD9, 0x9E, 0xC0, 0xD9, 0xE6, 0xCF, 0x36, 0x7B, 0x03,
+        0x3D, 0x99, 0xEC, 0xCF, 0x66, 0x70, 0x40, 0x00, 0x20, 0x00, 0x20, 0x40, 0x0F, 0xFB, 0xF0, 0x02,
+        0xCF, 0xDD, 0x09, 0x34, 0x67, 0xF4, 0xA9, 0xAC, 0x6C, 0x12, 0x60, 0x0B, 0x00, 0x00, 0x00, 0x00,
+        0x04, 0x00, 0x30, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x20, 0x00, 0x46, 0x58, 0xE5, 0x8B,
+        0x23, 0x2C, 0x46, 0x4D, 0x99, 0xBC, 0xA3, 0xCA, 0xC3, 0x03, 0xEC, 0x2C, 0x16, 0x01, 0xDE, 0x58,
+        0xEF, 0x16, 0x98, 0x1D, 0xE3, 0xBC, 0x9A, 0xDD, 0xE0, 0x3B, 0xCE, 0xF1, 0xDE, 0x8D, 0x06, 0x5C,
+        0x0B, 0x85, 0xC2, 0xE1, 0x70, 0x26, 0x8C, 0xEF, 0x3B, 0xCE, 0xF0, 0x3B, 0xCE, 0xF3, 0xBD, 0x1A,
+        0x61, 0xB8, 0x5C, 0x2E, 0x17, 0x0B, 0x85, 0x0F, 0x3B, 0xD3, 0x46, 0x77, 0x9D, 0x9F, 0x77, 0xEF,
+        0xFD, 0xCE, 0x3F, 0xFF, 0x97, 0x5A, 0x65, 0xC0, 0x99, 0x00, 0x40, 0x00, 0x40, 0x01, 0x00, 0x20,
+        0x01, 0x40, 0x0C, 0x00, 0x10, 0x01, 0x00, 0x04, 0x00, 0x80, 0x03, 0x0D, 0xBB, 0xD6, 0x3B, 0xC0,
+        0xF0, 0xD0, 0x89, 0x96, 0x39, 0x72, 0xC4, 0x71, 0x70, 0x5C, 0x62, 0xE0, 0xC0, 0xAF, 0x2D, 0x65,
+        0xAD, 0x60, 0x5A, 0xCB, 0x5A, 0xCB, 0x58, 0x16, 0xB3, 0x76, 0xB2, 0xD7, 0xE1, 0xD8, 0xC1, 0x8C,
+        0x79, 0xB1, 0x80, 0x5A, 0xDA, 0xB5, 0x96, 0xD4, 0x1A, 0xD6, 0x5E, 0x96, 0xB2, 0x0F, 0x56, 0x5A,
+        0xDA, 0xB5, 0x81, 0x6D, 0x5A, 0xCB, 0x6E, 0xC8, 0x63, 0x09, 0x60, 0xC6, 0x3C, 0xD8, 0x16, 0x5A,
+        0xF4, 0xB5, 0x97, 0x82, 0x5A, 0xD6, 0x6E, 0xCB, 0x43, 0x1E, 0x6C, 0x60, 0xC7, 0x9B, 0x18, 0x16,
+        0x5B, 0x56, 0xB2, 0xD7, 0x82, 0x5A, 0xCB, 0x6E, 0xCB, 0x41, 0x97, 0xA5, 0xAD, 0x66, 0xEC, 0x0B,
+        0x59, 0x7A, 0xB2, 0xD6, 0x05, 0xEA, 0xCB, 0x59, 0xBB, 0x02, 0xD6, 0xB3, 0x76, 0x5A, 0xC0, 0xB6,
+        0xEC, 0xB5, 0x96, 0xDD, 0x81, 0x6B, 0x2D, 0xAB, 0x5A, 0xC0, 0xB6, 0xAD, 0x6B, 0x2D, 0x7E, 0xB0,
+        0x05, 0x00, 0x20, 0x01, 0x00, 0x20, 0x00, 0x00, 0x10, 0x02, 0xFF, 0xEA, 0xD0, 0x02, 0xBF, 0xFF,
+        0xC8, 0x0B, 0x32, 0x2F, 0xFF, 0xE9, 0xB6, 0xFA, 0x60, 0xCE, 0x00, 0xE0, 0x06, 0x00, 0x80, 0x00,
+        0x00, 0x60, 0x00, 0x00, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x05, 0xC2, 0xE5, 0x32, 0x99,
+        0x40, 0x01, 0x5E, 0x1D, 0xE1, 0x38, 0x13, 0x4E, 0x1C, 0x38, 0x71, 0x34, 0xC7, 0x2E, 0x53, 0x37,
+        0x94, 0xCA, 0x65, 0x47, 0x94, 0xCA, 0x19, 0xB3, 0x28, 0x65, 0x16, 0x65, 0x0C, 0xA3, 0xCA, 0x19,
+        0x44, 0x79, 0x43, 0x28, 0x3C, 0xA1, 0x83, 0x46, 0x65, 0x0C, 0xA3, 0x32, 0x80, 0x7B, 0xEC, 0xF7,
+        0x0B, 0xF7, 0x03, 0x94, 0x1E, 0x50, 0x32, 0xB3, 0x28, 0x0F, 0x75, 0xBD, 0xC3, 0xDF, 0x60, 0x3D,
+        0xC7, 0xBE, 0xC7, 0xB8, 0xD0, 0x0F, 0x72, 0xFD, 0xC3, 0xDC, 0x87, 0x94, 0x0C, 0xAC, 0xCA, 0x06,
+        0x51, 0x66, 0x50, 0x33, 0x61, 0x94, 0x30, 0x6B, 0x0C, 0xA1, 0x9B, 0x0C, 0xA0, 0x26, 0x6C, 0x32,
+        0x86, 0x6C, 0x0C, 0xBB, 0xF4, 0x36, 0x79, 0xD0, 0x7F, 0xE5, 0x38, 0x27, 0xAC, 0x08, 0x80, 0x00,
+        0xC0, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x60, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x60, 0x02,
+        0x00, 0x00, 0x00, 0x7B, 0xBD, 0xCF, 0x3B, 0xC0, 0xEF, 0xD0, 0x00, 0x7E, 0x1D, 0x03, 0x29, 0x94,
+        0xC5, 0xCB, 0x83, 0x4C, 0xB9, 0x79, 0xB9, 0x72, 0xE5, 0xCA, 0x3C, 0x6E, 0x5C, 0xB8, 0x32, 0xE1,
+        0x70, 0x6E, 0x4D, 0xCB, 0x85, 0xC2, 0xF3, 0x70, 0x1B, 0x85, 0xC9, 0xB9, 0x70, 0xB8, 0x30, 0x4B,
+        0x85, 0xC1, 0x85, 0xCB, 0x85, 0x1E, 0x37, 0x0B, 0x85, 0xE3, 0x70, 0xB8, 0x25, 0xE3, 0x70, 0xB8,
+        0x5E, 0x37, 0x01, 0xB9, 0x72, 0x6E, 0x17, 0x0B, 0x93, 0x70, 0x4B, 0x85, 0xC9, 0xB8, 0x5C, 0x2E,
+        0x51, 0xE3, 0x70, 0xB8, 0x5E, 0x37, 0x0B, 0x82, 0x5E, 0x37, 0x2E, 0x17, 0x26, 0xE1, 0x47, 0x0B,
+        0x93, 0x72, 0xE1, 0x70, 0x60, 0x37, 0x0B, 0x83, 0x2E, 0x17, 0x0B, 0xC1, 0x6E, 0x17, 0x2E, 0x4D,
+        0xC2, 0xE1, 0x47, 0x2F, 0x1B, 0x85, 0xC2, 0xF3, 0x70, 0xB8, 0x00, 0x40, 0x00, 0x00, 0x0C, 0x00,
+        0x80, 0x02, 0x00, 0x29, 0x56, 0x3F, 0xF0, 0x92, 0x00, 0x02, 0xBF, 0xFF, 0x13, 0x6F, 0xFD, 0x39,
+        0xE7, 0x4A, 0x12, 0xE0, 0x12, 0x00, 0x20, 0x04, 0x00, 0x60, 0x04, 0x00, 0x20, 0x08, 0x00, 0x20,
+        0x06, 0x00, 0x40, 0x04, 0x00, 0x21, 0x7B, 0xBD, 0xDA, 0x00, 0x08, 0x30, 0xB8, 0x5C, 0x65, 0xC6,
+        0x0D, 0x92, 0xE2, 0xC9, 0x63, 0x96, 0x23, 0x25, 0x8C, 0x71, 0x62, 0x46, 0x05, 0xEA, 0xD6, 0xB4,
+        0xD6, 0xB0, 0x5A, 0xD6, 0x9A, 0xD6, 0xB4, 0x1A, 0xD6, 0x9A, 0xD6, 0xB5, 0x82, 0xD3, 0x5A, 0xD5,
+        0xEB, 0x40, 0xD6, 0xB5, 0xAD, 0x69, 0xAC, 0x16, 0xB7, 0x6D, 0x35, 0xAD, 0x60, 0xB5, 0xA6, 0xB5,
+        0xAD, 0x68, 0x2D, 0xAD, 0x6B, 0x5A, 0xD3, 0x05, 0xAD, 0x6B, 0x5A, 0xD2, 0xF0, 0x5A, 0xD6, 0xB4,
+        0xD6, 0xB4, 0x1A, 0xD6, 0x9A, 0xD6, 0xB5, 0x83, 0xB3, 0x5A, 0xD6, 0xB5, 0xA0, 0x6B, 0x5A, 0xD6,
+        0xB4, 0xD6, 0x0B, 0x5A, 0xDD, 0x9A, 0xD6, 0xB0, 0x5A, 0xD3, 0x5A, 0xD6, 0xB4, 0x1A, 0xD3, 0x5B,
+        0xB6, 0xB5, 0xA0, 0x6B, 0x5A, 0xD6, 0xB4, 0xD0, 0x6B, 0x5A, 0xD6, 0x9A, 0xD6, 0x0B, 0x5A, 0xD3,
+        0x5A, 0xD6, 0x83, 0x5A, 0x5E, 0xB5, 0xAD, 0x68, 0x1A, 0xD6, 0xB5, 0xAD, 0x35, 0x80, 0x02, 0x00,
+        0x08, 0x00, 0xBD, 0xD6, 0xFF, 0xFB, 0xF6, 0xFF, 0xFF, 0x1C, 0x45, 0x34, 0x01, 0x58, 0x00, 0xA0,
+        0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x17, 0x2C, 0x96, 0x46, 0x32,
+        0x59, 0x05, 0x71, 0x97, 0x26, 0xE0, 0x30, 0x00, 0x1A, 0x00, 0x03, 0xDC, 0x1E, 0xE3, 0xDC, 0x78,
+        0x69, 0x18, 0xC4, 0xCA, 0x65, 0x30, 0x69, 0x13, 0x2E, 0x53, 0x29, 0x10, 0x72, 0xE5, 0x32, 0xC4,
+        0xCA, 0x65, 0x82, 0xC1, 0xCA, 0x65, 0x89, 0x97, 0x28, 0x3D, 0xDA, 0x7B, 0xBD, 0xCC, 0x41, 0xCB,
+        0x94, 0x8E, 0x53, 0x2C, 0x19, 0x80, 0x01, 0x00, 0x20, 0x00, 0xC0, 0x00, 0x00, 0x40, 0x01, 0xFC,
+        0xEC, 0x1D, 0xA7, 0x40, 0x01, 0xAF, 0xFA, 0x7E, 0xFE, 0x1B, 0x8C, 0x30, 0x18, 0x01, 0x40, 0x10,
+        0x03, 0x00, 0x20, 0x0C, 0x00, 0x80, 0x30, 0x04, 0x00, 0x40, 0x18, 0x01, 0x00, 0x20, 0xF3, 0x7B,
+        0x33, 0xCC, 0x60, 0x00, 0x01, 0x00, 0x8E, 0x44, 0xE4, 0x07, 0x49, 0xC9, 0x72, 0x70, 0x29, 0xD2,
+        0x74, 0xB9, 0x70, 0x29, 0xD2, 0xE5, 0x72, 0xE0, 0x53, 0xA9, 0xD3, 0xA9, 0xC1, 0x2E, 0x97, 0x2E,
+        0x97, 0x02, 0xB9, 0x5C, 0xBA, 0x5C, 0x82, 0xE5, 0xD2, 0xE5, 0x72, 0x83, 0x97, 0x2B, 0x95, 0xCA,
+        0x0D, 0x68, 0xA5, 0x52, 0xB4, 0x42, 0x75, 0x3A, 0x9D, 0x3A, 0x81, 0xD4, 0xE9, 0xD4, 0xE9, 0x0D,
+        0x46, 0xA5, 0x46, 0xA3, 0x41, 0x5C, 0xBA, 0x5C, 0xAE, 0x05, 0xCA, 0xE5, 0x3A, 0x9D, 0x0D, 0x14,
+        0xAA, 0x55, 0x2B, 0x41, 0x4E, 0xA7, 0x4E, 0xA7, 0x04, 0xBA, 0x5C, 0xBA, 0x5C, 0x0A, 0xE5, 0x72,
+        0xE5, 0x72, 0x09, 0xD3, 0xA9, 0xD2, 0xE8, 0x17, 0x2E, 0x97, 0x2B, 0x94, 0x0E, 0xB9, 0x4E, 0xA7,
+        0x4E, 0x0A, 0x74, 0xB9, 0x5C, 0xB8, 0x15, 0xCA, 0x75, 0xCA, 0x74, 0x0B, 0xA5, 0xCB, 0xA5, 0xC8,
+        0x2E, 0x53, 0xA7, 0x53, 0xA6, 0x00, 0x04, 0x00, 0x60, 0x00, 0x00, 0x08, 0x00, 0xC0, 0x02, 0x00,
+        0x00, 0x00, 0x80, 0x0E, 0x54, 0x7F, 0xFF, 0xEB, 0x23, 0xDD, 0x32, 0x27, 0xD0, 0x0F, 0x80, 0x04,
+        0x00, 0x02, 0x40, 0x98, 0x49, 0x92, 0x64, 0xE4, 0x28, 0x88, 0x88, 0xA8, 0x88, 0xAA, 0xA8, 0x88,
+        0xA2, 0xAC, 0x54, 0x55, 0x54, 0x6A, 0x2A, 0xB1, 0x51, 0x82, 0xAC, 0x55, 0x62, 0xB1, 0x18, 0xAC,
+        0x56, 0x2B, 0x14, 0x58, 0xAC, 0x46, 0x2B, 0x18, 0xAC, 0x56, 0x31, 0x58, 0xA2, 0xC6, 0x2B, 0x18,
+        0xAC, 0x62, 0xB1, 0x88, 0xD4, 0x63, 0x45, 0x18, 0xC6, 0xA3, 0x18, 0xAC, 0x62, 0xB1, 0x8A, 0xC6,
+        0x30, 0x00, 0xC0, 0x08, 0x00, 0x40, 0x01, 0x80, 0x10, 0x00, 0x8C, 0x40, 0x9F, 0xE0, 0xCA, 0x01,
+        0xBF, 0xFF, 0xFF, 0xCC, 0x8F, 0xFE, 0x19, 0xE7, 0xAA, 0x06, 0x20, 0x02, 0x00, 0x00, 0x04, 0x00,
+        0x00, 0x04, 0x00, 0x40, 0x04, 0x00, 0x80, 0x04, 0x00, 0x40, 0x04, 0x00, 0x45, 0x49, 0x54, 0x2A,
+        0x85, 0x51, 0x51, 0x51, 0x82, 0x8A, 0x88, 0xC5, 0x46, 0x23, 0x11, 0x88, 0xC4, 0x60, 0xA3, 0x18,
+        0x8C, 0x55, 0x62, 0xB1, 0x18, 0xC5, 0x62, 0x32, 0x11, 0x8F, 0xDF, 0xBD, 0xFE, 0x06, 0x4A, 0xE3,
+        0x82, 0xF8, 0x01, 0xA0, 0x02, 0x00, 0x18, 0x00, 0x80, 0x06, 0x00, 0x20, 0x01, 0x80, 0x04, 0x00,
+        0x40, 0x02, 0x00, 0x10, 0x64, 0xE4, 0x93, 0x21, 0x26, 0x12, 0x01, 0x98, 0xF1, 0x83, 0x00, 0x00,
+        0x08, 0x00, 0x83, 0x84, 0x02, 0x11, 0x0E, 0x20, 0x22, 0x38, 0x88, 0x08, 0x9C, 0x44, 0x40, 0x8E,
+        0x22, 0x47, 0x01, 0x22, 0x47, 0x10, 0x22, 0x39, 0x11, 0x02, 0x38, 0x91, 0x20, 0x38, 0x91, 0x1C,
+        0x80, 0x89, 0x1C, 0x88, 0x09, 0xC4, 0x48, 0x80, 0xE4, 0x44, 0x8E, 0x02, 0x44, 0xE2, 0x20, 0x44,
+        0x72, 0x22, 0x04, 0x71, 0x22, 0x70, 0x12, 0x22, 0x71, 0x01, 0x23, 0x89, 0x10, 0x13, 0x88, 0x91,
+        0x01, 0xC8, 0x89, 0xC4, 0x04, 0x48, 0xE2, 0x40, 0x47, 0x22, 0x24, 0x07, 0x12, 0x22, 0x38, 0x11,
+        0x13, 0x88, 0x81, 0x11, 0xC4, 0x88, 0x0E, 0x44, 0x44, 0xE0, 0x22, 0x44, 0x71, 0x02, 0x23, 0x91,
+        0x10, 0x13, 0x88, 0x89, 0x01, 0xC4, 0x88, 0xE2, 0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x01, 0x00,
+        0x7F, 0xFC, 0xE2, 0x01, 0xCF, 0xDA, 0x7F, 0xFE, 0x9A, 0x94, 0x4C, 0x81, 0xD4, 0x00, 0x60, 0x02,
+        0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x40, 0x06, 0x00, 0x10, 0x00,
+        0xB0, 0x00, 0x80, 0x04, 0x00, 0x20, 0x01, 0x00, 0x08, 0x00, 0x42, 0x86, 0x7D, 0x84, 0xDF, 0xB6,
+        0xC3, 0xA0, 0x88, 0x5F, 0x40, 0x2E, 0x00, 0x20, 0x01, 0x80, 0x04, 0x00, 0x41, 0x93, 0x32, 0x49,
+        0x24, 0x32, 0x42, 0x06, 0x66, 0x67, 0x8C, 0x60, 0x18, 0x30, 0x00, 0x60, 0x00, 0x00, 0x08, 0x00,
+        0x01, 0x00, 0x20, 0x00, 0x80, 0x20, 0x01, 0xC0, 0x20, 0x02, 0x01, 0x00, 0x10, 0x10, 0x01, 0x00,
+        0x80, 0x0E, 0x01, 0x00, 0x10, 0x10, 0x00, 0x80, 0x80, 0x80, 0x07, 0x01, 0x00, 0x08, 0x08, 0x00,
+        0x80, 0x40, 0x04, 0x02, 0x00, 0x38, 0x20, 0x10, 0x01, 0x00, 0x80, 0x08, 0x04, 0x00, 0x40, 0x38,
+        0x00, 0x80, 0x80, 0x04, 0x04, 0x00, 0x20, 0x20, 0x1C, 0x00, 0x40, 0x20, 0x01, 0x01, 0x00, 0x08,
+        0x08, 0x00, 0x40, 0x70, 0x00, 0x80, 0x80, 0x04, 0x02, 0x00, 0x20, 0x10, 0x01, 0x00, 0xE0, 0x01,
+        0x01, 0x00, 0x80, 0x04, 0x04, 0x00, 0x20, 0x01, 0xC1, 0xC7, 0xFF, 0xF9, 0xAC, 0x78, 0xB9, 0x45,
+        0x66, 0x02, 0x10, 0x00, 0x00, 0x08, 0x00, 0x40, 0x00, 0x00, 0x10, 0x00, 0xAA, 0x7A, 0xFD, 0x0D,
+        0x9F, 0xBF, 0xF2, 0x10, 0xA0, 0x75, 0x0F, 0xF2, 0x64, 0x90, 0x90, 0x90, 0x86, 0x03, 0x31, 0x8C,
+        0x60, 0x18, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x04,
+        0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00,
+        0x00, 0x70, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x08, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x08,
+        0x00, 0x00, 0x80, 0x00, 0x04, 0x00, 0x00, 0x70, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x80,
+        0x00, 0x08, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x40, 0x00, 0x02, 0x00, 0x03, 0x80, 0x00,
+        0x04, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x02, 0xA0, 0x01,
+        0xFF, 0xEC, 0xD8, 0x01, 0x80, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x98, 0x80, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x7F, 0xF0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+        0x90, 0x03, 0xFF, 0xD9, 0xA0, 0x08, 0x05, 0x01, 0x80, 0x30, 0x08, 0x02, 0x01, 0x40, 0x60, 0x17,
+        0xFF, 0xD9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x7F, 0xF0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+        0x7F, 0xFF, 0xFF, 0xFA, 0x80, 0x28, 0x10, 0x20, 0x18, 0x08, 0x10, 0x20, 0x18, 0x00, 0x20, 0x28,
+        0x10, 0x20, 0x18, 0x0B, 0x81, 0x02, 0x01, 0x80, 0xFF, 0xFF, 0xFF, 0xD2, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x07, 0xFF, 0xF7, 0xFE, 0x80, 0x03, 0xFF, 0xFB, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xDF, 0xFC, 0x02, 0x7F, 0xFF, 0xF8, 0x50, 0x18,
+        0x20, 0x18, 0x30, 0x08, 0x18, 0x00, 0x20, 0x10, 0x28, 0x20, 0x18, 0x30, 0x28, 0x23, 0x81, 0x82,
+        0x01, 0x02, 0x82, 0x01, 0x83, 0x03, 0x84, 0x00, 0x81, 0x80, 0x03, 0x03, 0xFF, 0xFF, 0xC0, 0xC0,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF7, 0xFE, 0x80, 0x03,
+        0xFF, 0xFB, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+        0xFF, 0xDF, 0xFC, 0x02, 0x6F, 0xFF, 0xFF, 0xFA, 0x41, 0x01, 0x40, 0x82, 0x00, 0x00, 0x20, 0x30,
+        0x00, 0x00, 0x82, 0x00, 0x10, 0x18, 0x05, 0xFE, 0xFA, 0xC7, 0xB8, 0x98, 0x10, 0x00, 0x80, 0xC0,
+        0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFB, 0xFF, 0x40, 0x01, 0xFF, 0xFD, 0xFF, 0xC0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0xFE, 0x02, 0x6F, 0xFF,
+        0xFF, 0x44, 0x14, 0x10, 0x40, 0xA0, 0x82, 0x03, 0x02, 0x18, 0x18, 0x10, 0x41, 0x02, 0x82, 0x1C,
+        0xAF, 0x2B, 0xCA, 0x66, 0xCC, 0xD9, 0x83, 0x5E, 0x56, 0x66, 0xCC, 0xAF, 0x2B, 0xC6, 0x06, 0x07,
+        0xFF, 0xFF, 0xCD, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0xFF, 0xA0, 0x00, 0xFF, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF7, 0xFF, 0x00, 0x02, 0x6F, 0xFF,
+        0xF8, 0x40, 0x40, 0x02, 0x86, 0x02, 0x0C, 0x30, 0x00, 0x00, 0x41, 0x05, 0x0C, 0x00, 0x28, 0xF1,
+        0x86, 0xF0, 0x6F, 0x01, 0x64, 0x13, 0x78, 0xC3, 0x78, 0xC3, 0x78, 0x35, 0x83, 0x00, 0x0A, 0x28,
+        0x38, 0x20, 0x41, 0x43, 0x00, 0x02, 0x0F, 0xFF, 0xFD, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x07, 0xFF, 0xF7, 0xFE, 0x80, 0x03, 0xFF, 0xFB, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xDF, 0xFC, 0x02, 0x5F, 0xFF, 0xFF, 0xFF, 0x94,
+        0x18, 0x41, 0x06, 0x10, 0x41, 0x84, 0x10, 0x21, 0x06, 0x30, 0xA0, 0x15, 0x4A, 0x4E, 0xA4, 0x54,
+        0xA4, 0xD2, 0x65, 0x52, 0x93, 0x49, 0xD4, 0x8A, 0x9A, 0x90, 0x55, 0x35, 0x22, 0xA4, 0x54, 0x8A,
+        0x9A, 0x90, 0xA3, 0x0A, 0x00, 0xC2, 0x81, 0xFF, 0xFF, 0xFF, 0xF1, 0x40, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0xFF, 0xA0, 0x00, 0xFF, 0xFE, 0xFF, 0xE0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF7, 0xFF, 0x00, 0x02, 0x5F,
+        0xFF, 0xFF, 0xFA, 0x81, 0x8C, 0x00, 0xA3, 0x0A, 0x20, 0x63, 0x00, 0x28, 0xC2, 0x88, 0x11, 0x4D,
+        0x4D, 0x4D, 0x17, 0x53, 0x53, 0x44, 0xA2, 0x75, 0x34, 0x26, 0x0A, 0x74, 0x26, 0xA6, 0x09, 0x4D,
+        0x4D, 0x4C, 0x29, 0xA9, 0xA9, 0xA2, 0xCA, 0xA6, 0xA6, 0x89, 0x4E, 0x84, 0xD4, 0xC3, 0x5F, 0xFF,
+        0xFF, 0xF9, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE,
+        0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x03, 0xFF, 0xFB, 0xFF, 0x80, 0x02, 0x5F, 0xFF, 0xFF, 0xD8, 0x00, 0x20, 0x43, 0x18,
+        0x10, 0x81, 0x08, 0x51, 0x02, 0x04, 0x20, 0x46, 0x37, 0x8C, 0x6E, 0x46, 0x31, 0xA3, 0xC6, 0x37,
+        0x8C, 0x63, 0x37, 0x08, 0x2D, 0xE6, 0x7B, 0x91, 0x9B, 0x91, 0x8D, 0x2D, 0x66, 0x8A, 0x2E, 0x11,
+        0x45, 0xEB, 0x34, 0xA0, 0x84, 0x08, 0x63, 0x02, 0x10, 0x21, 0x0F, 0xFF, 0xFF, 0xFA, 0x20, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0F, 0xFF, 0xEF, 0xFD, 0x00, 0x07, 0xFF, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xBF, 0xF8, 0x02, 0x5F, 0xFF, 0xFF, 0x40,
+        0x21, 0x44, 0x08, 0x51, 0x02, 0x14, 0x40, 0x85, 0x10, 0x21, 0x46, 0x16, 0xF1, 0xBC, 0x6F, 0x37,
+        0x26, 0xE4, 0xD2, 0xA2, 0xE8, 0xBA, 0x2E, 0x8B, 0xA2, 0xE8, 0x4D, 0xC9, 0xB9, 0x37, 0x26, 0xE4,
+        0xDC, 0x85, 0x34, 0x5D, 0x17, 0x45, 0xD4, 0xC2, 0x98, 0x19, 0xBC, 0x6F, 0x1B, 0xC6, 0xF1, 0xBC,
+        0x54, 0x31, 0x80, 0x1F, 0xFF, 0xFF, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x7F,
+        0xE8, 0x00, 0x3F, 0xFF, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x01, 0xFF, 0xFD, 0xFF, 0xC0, 0x02, 0x5F, 0xFF, 0xFD, 0x20, 0x80, 0x00, 0x40, 0xC1, 0x08,
+        0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x0B, 0x3D, 0xCB, 0x16, 0x02, 0xC5, 0xBD, 0xC5, 0x8B, 0x01,
+        0x61, 0x7F, 0xBF, 0xB1, 0x60, 0x2C, 0x58, 0xF7, 0x58, 0x83, 0x16, 0x2C, 0xF7, 0x2C, 0x50, 0x01,
+        0x08, 0x00, 0x01, 0x08, 0x00, 0x01, 0x08, 0x61, 0xC3, 0xFF, 0xFF, 0xCD, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF7, 0xFE, 0x80, 0x03,
+        0xFF, 0xFB, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+        0xFF, 0xDF, 0xFC, 0x02, 0x5F, 0xFF, 0xF8, 0x81, 0x80, 0x30, 0xA3, 0x0A, 0x00, 0xC2, 0x80, 0x20,
+        0x60, 0x0C, 0x28, 0xF3, 0x79, 0xA6, 0x32, 0x9C, 0xD3, 0x9A, 0x0F, 0x37, 0x2F, 0x34, 0xE6, 0x9C,
+        0xDC, 0x5C, 0x26, 0x2A, 0x6A, 0x6A, 0x44, 0x34, 0x98, 0xA2, 0x9A, 0x91, 0x53, 0x0E, 0xA4, 0x54,
+        0x8A, 0x91, 0x31, 0x97, 0x9A, 0x73, 0x4E, 0x6E, 0x50, 0x79, 0xA7, 0x34, 0xE3, 0x64, 0xA7, 0x34,
+        0x51, 0x85, 0x18, 0x50, 0x04, 0x0C, 0x0F, 0xFF, 0xF7, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0xFF, 0xA0, 0x00, 0xFF,
+        0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+        0xF7, 0xFF, 0x00, 0x02, 0x4F, 0xFF, 0xFF, 0xFF, 0xEC, 0x28, 0x82, 0x20, 0x98, 0x60, 0x08, 0x88,
+        0x51, 0x04, 0x42, 0x66, 0xCC, 0xD8, 0xCC, 0xAC, 0x66, 0x0D, 0x63, 0xCA, 0xCC, 0xAC, 0x79, 0x51,
+        0x83, 0xCA, 0xCC, 0xAC, 0x79, 0x58, 0x26, 0x6C, 0x63, 0xCA, 0x66, 0xC6, 0x60, 0xD6, 0x33, 0x36,
+        0x33, 0x2B, 0x33, 0x46, 0x0F, 0x2B, 0x19, 0x95, 0x8F, 0x28, 0xB3, 0x2B, 0x1E, 0x51, 0x8F, 0x2A,
+        0x82, 0x0F, 0xFF, 0xFF, 0xFF, 0xF2, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x7F, 0xE8, 0x00, 0x3F, 0xFF, 0xBF, 0xF8,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0xFF, 0xC0,
+        0x02, 0x4F, 0xFF, 0xFF, 0xFF, 0xA0, 0xA2, 0x08, 0x80, 0x42, 0x88, 0x22, 0x01, 0x0A, 0x20, 0x8C,
+        0x33, 0x61, 0x9B, 0x19, 0x95, 0x88, 0xCC, 0xAC, 0x1E, 0x56, 0x65, 0x62, 0x33, 0x2B, 0x07, 0x95,
+        0x86, 0x6C, 0x47, 0xCE, 0xC6, 0x19, 0xB1, 0x86, 0x6C, 0x47, 0xCE, 0xC6, 0x3E, 0x76, 0x33, 0x2B,
+        0x11, 0x99, 0x59, 0x95, 0x8C, 0xCA, 0xC4, 0x66, 0x56, 0x33, 0x2B, 0xE7, 0x63, 0x14, 0x41, 0xC4,
+        0x11, 0x05, 0x07, 0x10, 0x44, 0x1F, 0xFF, 0xFF, 0xFF, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0xFD, 0x00, 0x07, 0xFF, 0xF7, 0xFF, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xBF, 0xF8, 0x02, 0x4F, 0xFF,
+        0xFF, 0xFE, 0x40, 0x18, 0xA0, 0x00, 0x04, 0x10, 0x00, 0xCB, 0x61, 0x44, 0x28, 0x1C, 0xF7, 0xC5,
+        0x00, 0xE7, 0xBF, 0x03, 0xE0, 0xD3, 0xF7, 0xC3, 0x41, 0x39, 0xA1, 0x1E, 0x7D, 0xE7, 0x34, 0x88,
+        0x03, 0xF7, 0xDA, 0x1A, 0xF5, 0x00, 0xD3, 0xF7, 0xC3, 0x47, 0xEF, 0x80, 0xD1, 0xFB, 0xE3, 0x43,
+        0xF0, 0xED, 0xF9, 0xA0, 0x1C, 0xDB, 0xF3, 0x40, 0x24, 0x8D, 0xF1, 0x20, 0x23, 0x5B, 0xAA, 0x90,
+        0x82, 0x08, 0x0C, 0xB3, 0x7F, 0xFF, 0xFF, 0xF1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x7F, 0xE8, 0x00, 0x3F, 0xFF, 0xBF, 0xF8, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0xFF, 0xC0, 0x02, 0x4F, 0xFF,
+        0xFF, 0xFA, 0x80, 0x23, 0xA0, 0x20, 0x11, 0xD0, 0x11, 0x04, 0x64, 0x00, 0xCE, 0xF8, 0x93, 0x70,
+        0x8D, 0xC2, 0x23, 0x72, 0x37, 0x08, 0xDC, 0x89, 0x70, 0x63, 0x72, 0x25, 0xC8, 0x97, 0x88, 0x33,
+        0xBE, 0x25, 0xE2, 0x4E, 0xF8, 0x93, 0x47, 0x09, 0xDF, 0x12, 0x77, 0xC6, 0x37, 0x01, 0x8D, 0xC2,
+        0x6E, 0x11, 0xB8, 0x44, 0x6E, 0x46, 0xE1, 0x1B, 0x91, 0x2E, 0x0C, 0x6E, 0x44, 0xB9, 0x12, 0xF1,
+        0x06, 0x77, 0xC4, 0x9B, 0x84, 0x6E, 0x13, 0xA9, 0xFF, 0xFF, 0xFF, 0x18, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0xFF, 0xA0, 0x00, 0xFF, 0xFE,
+        0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF7,
+        0xFF, 0x00, 0x02, 0x4F, 0xFF, 0xFF, 0xF0, 0x08, 0x89, 0x51, 0x44, 0x11, 0x04, 0x41, 0x11, 0x0A,
+        0x21, 0x63, 0x19, 0x9E, 0xFC, 0xD8, 0x31, 0x82, 0xF2, 0xB1, 0x8C, 0x63, 0x33, 0x60, 0xB1, 0x8C,
+        0xCF, 0x7E, 0x56, 0x31, 0x82, 0xF2, 0xB1, 0x8C, 0x79, 0xEF, 0xCA, 0xC1, 0x63, 0x0C, 0xF7, 0xE6,
+        0xC6, 0x31, 0x83, 0x9B, 0x18, 0xC6, 0x67, 0xBF, 0x36, 0x30, 0x46, 0x3C, 0xAC, 0x63, 0x18, 0xC1,
+        0xCD, 0x8C, 0x63, 0x33, 0xDF, 0x95, 0x88, 0xC6, 0x3C, 0xAC, 0x63, 0x1E, 0x7B, 0xF1, 0x06, 0x11,
+        0x04, 0x41, 0x10, 0x50, 0xDF, 0xFF, 0xFF, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+        0xFE, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x03, 0xFF, 0xFB, 0xFF, 0x80, 0x02, 0x4F, 0xFF, 0xFF, 0xD8, 0x00, 0x00, 0x41,
+        0x00, 0x04, 0x74, 0x04, 0x00, 0x10, 0x40, 0xD7, 0xDF, 0xE8, 0xD1, 0xA0, 0x34, 0xEF, 0x34, 0x68,
+        0xE0, 0xF3, 0x46, 0x8D, 0x1D, 0xE0, 0xD1, 0xA1, 0xDE, 0xD1, 0x82, 0x34, 0x6F, 0xEF, 0xF4, 0x34,
+        0x21, 0x3B, 0xE3, 0xCD, 0xB8, 0x11, 0x00, 0xD3, 0xBC, 0x68, 0xD3, 0xBC, 0x3C, 0xDB, 0x84, 0x42,
+        0x21, 0x70, 0x18, 0x84, 0x42, 0xE7, 0x36, 0xE4, 0x40, 0x68, 0xEF, 0x68, 0xD1, 0x00, 0x23, 0x9B,
+        0xFF, 0xFF, 0xF5, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xDF, 0xFA, 0x00,
+        0x0F, 0xFF, 0xEF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x7F, 0xFF, 0x7F, 0xF0, 0x02, 0x4F, 0xFF, 0xFF, 0x98, 0x46, 0x28, 0x00, 0x41, 0x80, 0x00, 0x01,
+        0x8A, 0x00, 0x03, 0xDC, 0x7E, 0xF8, 0x1E, 0xE0, 0x79, 0xA0, 0x65, 0x00, 0xE6, 0x82, 0x3E, 0x68,
+        0x06, 0x50, 0xE6, 0x81, 0x81, 0xC1, 0xFB, 0xE1, 0xEE, 0x01, 0xE6, 0x81, 0x94, 0x39, 0xA0, 0x08,
+        0xF9, 0xA1, 0x94, 0x03, 0x9A, 0x06, 0x0D, 0x0E, 0x68, 0x01, 0x94, 0x39, 0xA0, 0x3D, 0xC1, 0xFB,
+        0xE3, 0xDC, 0x00, 0xF7, 0x1F, 0xBE, 0x1E, 0xE0, 0x0F, 0xDF, 0x0F, 0x70, 0x7E, 0xF9, 0x00, 0x00,
+        0x10, 0x60, 0x01, 0x8A, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xBF, 0xF4,
+        0x00, 0x1F, 0xFF, 0xDF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xFF, 0xFE, 0xFF, 0xE0, 0x02, 0x4F, 0xFF, 0xFF, 0x40, 0x00, 0x23, 0xA0, 0x20, 0x00, 0x8E,
+        0x80, 0x80, 0x41, 0x1D, 0xF1, 0x23, 0x70, 0x23, 0x70, 0x82, 0x97, 0x08, 0x97, 0x08, 0x97, 0x03,
+        0x4E, 0xF3, 0x4E, 0xF3, 0x4E, 0x0F, 0x68, 0xEF, 0x68, 0xEF, 0x68, 0x33, 0xBE, 0x21, 0x3B, 0xE2,
+        0x13, 0xBE, 0x22, 0x4E, 0xF8, 0x84, 0xEF, 0x88, 0x4E, 0xF8, 0x13, 0x5D, 0xE3, 0x5D, 0xE3, 0x43,
+        0x70, 0x89, 0x70, 0x89, 0x70, 0x82, 0x97, 0x22, 0x5C, 0x22, 0x5C, 0x03, 0x4E, 0xF6, 0x8E, 0xF6,
+        0x8E, 0x1C, 0x89, 0x3B, 0xE2, 0x13, 0xBE, 0x20, 0x82, 0x3A, 0x02, 0x01, 0x04, 0xBF, 0xFF, 0xFE,
+        0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x03, 0xFF, 0xFB, 0xFF, 0x40, 0x01, 0xFF, 0xFD, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0xFE, 0x02, 0x4F, 0xFF, 0xFE,
+        0x81, 0x04, 0x45, 0x20, 0x80, 0x52, 0x08, 0x22, 0x29, 0x04, 0x26, 0xE4, 0x66, 0xE4, 0x37, 0x23,
+        0x01, 0xDC, 0x8C, 0xDC, 0x83, 0x78, 0xCD, 0xC1, 0x83, 0x78, 0xCD, 0xE3, 0x19, 0xB9, 0x04, 0x6F,
+        0x18, 0xDE, 0x0D, 0xE3, 0x01, 0xDC, 0x8D, 0xE3, 0x0D, 0xC8, 0xC6, 0x8F, 0x06, 0xF1, 0x8B, 0x23,
+        0x37, 0x20, 0x9B, 0x91, 0x9B, 0x90, 0x66, 0xE4, 0x46, 0xF0, 0x66, 0xE4, 0x1B, 0xC6, 0x6E, 0x0C,
+        0x1B, 0xC6, 0x33, 0x78, 0xCD, 0xC8, 0x23, 0x78, 0xCD, 0xC8, 0x37, 0x8C, 0x46, 0xF0, 0x63, 0x78,
+        0x37, 0x8C, 0x68, 0xF0, 0x6F, 0x18, 0xDE, 0x0C, 0xDC, 0x88, 0x11, 0xFF, 0xFF, 0xF1, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x07, 0xFF, 0xF7, 0xFE, 0x80, 0x03, 0xFF, 0xFB, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xDF, 0xFC, 0x02, 0x4F, 0xFF, 0xFD, 0x02,
+        0x00, 0x00, 0x00, 0x00, 0x28, 0x28, 0x02, 0x20, 0x00, 0x3E, 0xFF, 0xF7, 0xCB, 0x01, 0x60, 0x02,
+        0xC0, 0xF7, 0x00, 0x57, 0xFB, 0x82, 0xC0, 0x05, 0x80, 0xB1, 0xEE, 0x00, 0x7D, 0xFF, 0xB8, 0x0B,
+        0x00, 0x16, 0x01, 0x61, 0xE6, 0xB0, 0x37, 0xF3, 0x46, 0x00, 0x01, 0x60, 0x2C, 0x00, 0x7B, 0x85,
+        0x7F, 0xB8, 0x20, 0xC0, 0x58, 0x08, 0x30, 0xF7, 0x07, 0xDF, 0xFB, 0x80, 0x0B, 0x01, 0x60, 0x80,
+        0x00, 0x02, 0x20, 0x18, 0xA1, 0x10, 0x0B, 0xFF, 0xFF, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xD0, 0x00, 0x7F, 0xFF, 0x7F,
+        0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFB, 0xFF,
+        0x80, 0x02, 0x4F, 0xFF, 0xFB, 0x86, 0x62, 0x98, 0xA6, 0x29, 0x8A, 0x62, 0x98, 0xA6, 0x28, 0xF3,
+        0x71, 0x8C, 0x64, 0xDE, 0x69, 0xCD, 0x2A, 0x9A, 0x9A, 0x9A, 0x9A, 0x98, 0x29, 0x4D, 0x14, 0xD4,
+        0xD4, 0xD4, 0xD4, 0x8A, 0x9A, 0x9A, 0x92, 0xA2, 0xEA, 0x6A, 0x6A, 0x6A, 0x6A, 0x6A, 0x68, 0xA6,
+        0xA6, 0xA6, 0x0A, 0x28, 0xA7, 0x53, 0x45, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x30, 0x51, 0x14,
+        0x53, 0xA9, 0xA1, 0x35, 0x35, 0x35, 0x23, 0x8B, 0xCD, 0xC6, 0x31, 0x93, 0x79, 0xA5, 0x53, 0x53,
+        0x53, 0x53, 0x05, 0x14, 0xD2, 0x25, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x25, 0x05, 0x14,
+        0xEA, 0x6A, 0x6A, 0x6A, 0x6A, 0x47, 0x9B, 0xC5, 0x8C, 0xB2, 0x31, 0x94, 0xAA, 0x6A, 0x6A, 0x68,
+        0x4D, 0x4C, 0x14, 0x52, 0x0C, 0xC5, 0x31, 0x41, 0xFF, 0xFF, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x7F, 0xE8, 0x00, 0x3F,
+        0xFF, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF,
+        0xFD, 0xFF, 0xC0, 0x02, 0x4F, 0xFF, 0xF8, 0x08, 0x30, 0x00, 0x00, 0x31, 0x40, 0x03, 0x14, 0x00,
+        0x00, 0x3F, 0x7C, 0x3D, 0xC1, 0xFB, 0xE0, 0x79, 0xA0, 0x73, 0x40, 0x32, 0xC7, 0x03, 0x87, 0xEF,
+        0x83, 0xF7, 0xC0, 0x3C, 0xD0, 0xCA, 0x07, 0x34, 0x03, 0x83, 0xA0, 0x1C, 0xD3, 0x29, 0x13, 0x28,
+        0x80, 0x73, 0x40, 0xE6, 0x87, 0x34, 0x01, 0xEE, 0x36, 0xE0, 0xFD, 0xF0, 0x1F, 0xBE, 0x0F, 0x51,
+        0xEE, 0x09, 0xCD, 0x00, 0xE6, 0x81, 0xCD, 0x00, 0x3D, 0xCD, 0xB8, 0x7E, 0xF8, 0x03, 0xF7, 0xC1,
+        0xFB, 0xE3, 0xDC, 0x07, 0x9A, 0x01, 0xCD, 0x00, 0xE6, 0x98, 0x34, 0x23, 0x94, 0x03, 0x9A, 0x73,
+        0xE8, 0xFE, 0x68, 0x62, 0x81, 0x94, 0x01, 0x3F, 0xFF, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF7, 0xFE, 0x80, 0x03,
+        0xFF, 0xFB, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+        0xFF, 0xDF, 0xFC, 0x02, 0x3F, 0xFF, 0xFF, 0xFF, 0xF4, 0x26, 0x50, 0x01, 0x20, 0x00, 0x00, 0x00,
+        0x00, 0x5F, 0xEF, 0x85, 0x80, 0x02, 0xFF, 0x7C, 0x16, 0x00, 0x1E, 0xE0, 0x2C, 0x00, 0x7B, 0x80,
+        0x58, 0x03, 0xDC, 0x00, 0xB0, 0x0F, 0xDF, 0xD8, 0x01, 0x60, 0x3F, 0x7D, 0x60, 0x05, 0xBF, 0x07,
+        0xC5, 0x80, 0x17, 0xF8, 0x3E, 0x16, 0x00, 0xF7, 0x00, 0x2C, 0x03, 0xDC, 0x00, 0x58, 0x0F, 0x70,
+        0x00, 0xB0, 0x7B, 0x80, 0x01, 0x63, 0xF7, 0xD6, 0x00, 0x05, 0xBF, 0x7C, 0x46, 0x40, 0x00, 0x00,
+        0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x3F, 0xFF, 0xBF, 0xF4, 0x00, 0x1F, 0xFF, 0xDF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xE0, 0x02, 0x4F, 0xFF, 0xEA, 0x41, 0xC4, 0x00,
+        0x04, 0x40, 0x00, 0x02, 0x83, 0x88, 0x00, 0x58, 0xBF, 0xDF, 0x58, 0xB0, 0x0F, 0x75, 0x8F, 0x72,
+        0xC4, 0x18, 0xF7, 0x2C, 0x2C, 0xF7, 0x01, 0x62, 0xCF, 0x71, 0x60, 0x7B, 0x8B, 0x16, 0x7B, 0x88,
+        0x30, 0xB7, 0xB8, 0x58, 0xF0, 0x72, 0xC5, 0xBF, 0x7F, 0x62, 0xC1, 0x07, 0xCE, 0xC0, 0x60, 0x0F,
+        0x9D, 0x0C, 0x3D, 0xD6, 0x16, 0x3C, 0x1C, 0xB1, 0x63, 0xDC, 0xB0, 0x16, 0x3D, 0xCB, 0x1E, 0xE4,
+        0x18, 0x59, 0xEE, 0x2C, 0x41, 0x9E, 0xE2, 0xC5, 0x9E, 0xE0, 0x2C, 0xF7, 0x16, 0x16, 0xF0, 0x70,
+        0xB1, 0x6F, 0xDF, 0xD8, 0x8C, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0xFD, 0x00, 0x07, 0xFF, 0xF7, 0xFF, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xBF, 0xF8, 0x02, 0x3F,
+        0xFF, 0xFF, 0xFF, 0xD9, 0x48, 0x05, 0x8C, 0x10, 0xC5, 0x8C, 0x06, 0x03, 0xD8, 0x66, 0xCC, 0xAF,
+        0x9D, 0x86, 0x6C, 0x13, 0x2B, 0xCA, 0x65, 0x66, 0x56, 0x60, 0xD7, 0xCE, 0xCC, 0xAC, 0x32, 0xBC,
+        0xA0, 0xE5, 0x66, 0x56, 0x65, 0x7C, 0xEC, 0xCA, 0x2C, 0xCA, 0x3C, 0xA6, 0x57, 0x94, 0x47, 0x94,
+        0x7C, 0xEF, 0x28, 0xCC, 0xA3, 0xC1, 0xA6, 0x6C, 0xCA, 0x3C, 0xA3, 0xE7, 0x61, 0x43, 0x38, 0xB4,
+        0x22, 0x50, 0x89, 0xC5, 0xA1, 0x33, 0x60, 0xF9, 0xD9, 0x97, 0x2B, 0x11, 0xF3, 0xB0, 0xCD, 0x99,
+        0x4C, 0xD8, 0x65, 0x16, 0x65, 0xCA, 0xCC, 0xAC, 0xCA, 0xC1, 0xCB, 0x95, 0x99, 0x46, 0x65, 0xCA,
+        0x8C, 0xCA, 0xCC, 0xAC, 0xCB, 0x95, 0x98, 0x34, 0x79, 0x47, 0x97, 0x28, 0xF2, 0x82, 0xCC, 0xB9,
+        0x5F, 0x3B, 0x07, 0x94, 0x4D, 0x8D, 0x0C, 0x05, 0x8C, 0x06, 0x0E, 0x43, 0xFF, 0xFF, 0xFF, 0xF7,
+        0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xDF, 0xFA, 0x00, 0x0F, 0xFF, 0xEF, 0xFE, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x7F, 0xF0, 0x02, 0x3F,
+        0xFF, 0xFF, 0xFF, 0xA0, 0x2B, 0x1A, 0x2B, 0x01, 0xA1, 0xA0, 0x2B, 0x13, 0x89, 0xA5, 0x74, 0xE0,
+        0x4D, 0x38, 0x12, 0x58, 0xBA, 0x70, 0x26, 0x83, 0x87, 0x02, 0x68, 0x9C, 0x09, 0xC5, 0xD0, 0x71,
+        0x34, 0xE0, 0x49, 0x62, 0xE8, 0x38, 0x9A, 0x70, 0x1C, 0x4D, 0x01, 0x2E, 0x6F, 0x2E, 0x17, 0x37,
+        0x85, 0xCD, 0x2C, 0x5D, 0x07, 0x13, 0x41, 0xC3, 0x89, 0xA0, 0x37, 0x37, 0x85, 0xCB, 0x86, 0xF0,
+        0xB9, 0xA5, 0x83, 0x34, 0xE2, 0x68, 0x38, 0x70, 0x26, 0x86, 0xE6, 0xF0, 0xB9, 0x70, 0xDE, 0x5C,
+        0x34, 0xB0, 0x66, 0x9C, 0x09, 0xA7, 0x13, 0x83, 0x34, 0x37, 0x0D, 0xE5, 0xC2, 0xE6, 0xF2, 0xE1,
+        0xA5, 0x8B, 0xA0, 0xE2, 0x68, 0x38, 0x0E, 0x26, 0x84, 0xB9, 0xBC, 0xB8, 0x5C, 0xDE, 0x17, 0x34,
+        0xA9, 0xC0, 0x71, 0x34, 0x1C, 0x4E, 0x2E, 0x81, 0x07, 0x13, 0x4A, 0xE9, 0xC4, 0xD0, 0x71, 0x25,
+        0x4A, 0xE9, 0xC4, 0xD0, 0x71, 0x38, 0x33, 0x46, 0x68, 0xAC, 0x06, 0x8B, 0xFF, 0xFF, 0xFF, 0xEA,
+        0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFB, 0xFF, 0x40, 0x01, 0xFF, 0xFD, 0xFF, 0xC0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xEF, 0xFE, 0x02, 0x3F,
+        0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x3F, 0x7C, 0x0B, 0x00,
+        0x00, 0x16, 0x00, 0x00, 0x7B, 0x80, 0x01, 0x60, 0x00, 0x01, 0x60, 0x0F, 0x07, 0xF7, 0x82, 0xC0,
+        0x7E, 0xFE, 0x0C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x7E, 0xF8, 0x58, 0x00, 0x00, 0x58, 0x00,
+        0x00, 0xF7, 0x00, 0x7D, 0xF8, 0x07, 0xB8, 0x00, 0x16, 0x00, 0x00, 0x16, 0x00, 0x0F, 0x70, 0x00,
+        0x01, 0x60, 0x00, 0x01, 0x61, 0xFB, 0xE2, 0xC1, 0x80, 0x00, 0x00, 0x28, 0x36, 0xC0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xBF, 0xF4, 0x00, 0x1F,
+        0xFF, 0xDF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+        0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00
+    };
+
+    static const AKWFTableRef tables[count] PROGMEM = {
+        { data +      0, 600 },   //   0 AKWF_squ_0001
+        { data +    319, 600 },   //   1 AKWF_squ_0002
+        { data +    714, 600 },   //   2 AKWF_squ_0003
+        { data +   1110, 600 },   //   3 AKWF_squ_0004
+        { data +   1421, 600 },   //   4 AKWF_squ_0005
+        { data +   1661, 600 },   //   5 AKWF_squ_0006
+        { data +   1971, 600 },   //   6 AKWF_squ_0007
+        { data +   2278, 600 },   //   7 AKWF_squ_0008
+        { data +   2427, 600 },   //   8 AKWF_squ_0009
+        { data +   2576, 600 },   //   9 AKWF_squ_0010
+        { data +   2781, 600 },   //  10 AKWF_squ_0011
+        { data +   2986, 600 },   //  11 AKWF_squ_0012
+        { data +   3135, 600 },   //  12 AKWF_squ_0013
+        { data +   3340, 600 },   //  13 AKWF_squ_0014
+        { data +   3489, 600 },   //  14 AKWF_squ_0015
+        { data +   3693, 600 },   //  15 AKWF_squ_0016
+        { data +   3842, 600 },   //  16 AKWF_squ_0017
+        { data +   4075, 600 },   //  17 AKWF_squ_0018
+        { data +   4224, 600 },   //  18 AKWF_squ_0019
+        { data +   4429, 600 },   //  19 AKWF_squ_0020
+        { data +   4639, 600 },   //  20 AKWF_squ_0021
+        { data +   4948, 600 },   //  21 AKWF_squ_0022
+        { data +   5247, 600 },   //  22 AKWF_squ_0023
+        { data +   5560, 600 },   //  23 AKWF_squ_0024
+        { data +   5855, 600 },   //  24 AKWF_squ_0025
+        { data +   6168, 600 },   //  25 AKWF_squ_0026
+        { data +   6466, 600 },   //  26 AKWF_squ_0027
+        { data +   6766, 600 },   //  27 AKWF_squ_0028
+        { data +   7064, 600 },   //  28 AKWF_squ_0029
+        { data +   7351, 600 },   //  29 AKWF_squ_0030
+        { data +   7643, 600 },   //  30 AKWF_squ_0031
+        { data +   7925, 600 },   //  31 AKWF_squ_0032
+        { data +   8210, 600 },   //  32 AKWF_squ_0033
+        { data +   8497, 600 },   //  33 AKWF_squ_0034
+        { data +   8793, 600 },   //  34 AKWF_squ_0035
+        { data +   9069, 600 },   //  35 AKWF_squ_0036
+        { data +   9358, 600 },   //  36 AKWF_squ_0037
+        { data +   9649, 600 },   //  37 AKWF_squ_0038
+        { data +   9924, 600 },   //  38 AKWF_squ_0039
+        { data +  10198, 600 },   //  39 AKWF_squ_0040
+        { data +  10470, 600 },   //  40 AKWF_squ_0041
+        { data +  10744, 600 },   //  41 AKWF_squ_0042
+        { data +  11015, 600 },   //  42 AKWF_squ_0043
+        { data +  11293, 600 },   //  43 AKWF_squ_0044
+        { data +  11559, 600 },   //  44 AKWF_squ_0045
+        { data +  11824, 600 },   //  45 AKWF_squ_0046
+        { data +  12085, 600 },   //  46 AKWF_squ_0047
+        { data +  12345, 600 },   //  47 AKWF_squ_0048
+        { data +  12606, 600 },   //  48 AKWF_squ_0049
+        { data +  12855, 600 },   //  49 AKWF_squ_0050
+        { data +  13096, 600 },   //  50 AKWF_squ_0051
+        { data +  13335, 600 },   //  51 AKWF_squ_0052
+        { data +  13631, 600 },   //  52 AKWF_squ_0053
+        { data +  13932, 600 },   //  53 AKWF_squ_0054
+        { data +  14456, 600 },   //  54 AKWF_squ_0055
+        { data +  14982, 600 },   //  55 AKWF_squ_0056
+        { data +  15516, 600 },   //  56 AKWF_squ_0057
+        { data +  16050, 600 },   //  57 AKWF_squ_0058
+        { data +  16575, 600 },   //  58 AKWF_squ_0059
+        { data +  17069, 600 },   //  59 AKWF_squ_0060
+        { data +  17593, 600 },   //  60 AKWF_squ_0061
+        { data +  17776, 600 },   //  61 AKWF_squ_0062
+        { data +  17961, 600 },   //  62 AKWF_squ_0063
+        { data +  18239, 600 },   //  63 AKWF_squ_0064
+        { data +  18509, 600 },   //  64 AKWF_squ_0065
+        { data +  18809, 600 },   //  65 AKWF_squ_0066
+        { data +  19076, 600 },   //  66 AKWF_squ_0067
+        { data +  19343, 600 },   //  67 AKWF_squ_0068
+        { data +  19555, 600 },   //  68 AKWF_squ_0069
+        { data +  19719, 600 },   //  69 AKWF_squ_0070
+        { data +  19853, 600 },   //  70 AKWF_squ_0071
+        { data +  19999, 600 },   //  71 AKWF_squ_0072
+        { data +  20143, 600 },   //  72 AKWF_squ_0073
+        { data +  20314, 600 },   //  73 AKWF_squ_0074
+        { data +  20483, 600 },   //  74 AKWF_squ_0075
+        { data +  20653, 600 },   //  75 AKWF_squ_0076
+        { data +  20829, 600 },   //  76 AKWF_squ_0077
+        { data +  21002, 600 },   //  77 AKWF_squ_0078
+        { data +  21182, 600 },   //  78 AKWF_squ_0079
+        { data +  21367, 600 },   //  79 AKWF_squ_0080
+        { data +  21547, 600 },   //  80 AKWF_squ_0081
+        { data +  21734, 600 },   //  81 AKWF_squ_0082
+        { data +  21907, 600 },   //  82 AKWF_squ_0083
+        { data +  22099, 600 },   //  83 AKWF_squ_0084
+        { data +  22288, 600 },   //  84 AKWF_squ_0085
+        { data +  22477, 600 },   //  85 AKWF_squ_0086
+        { data +  22669, 600 },   //  86 AKWF_squ_0087
+        { data +  22866, 600 },   //  87 AKWF_squ_0088
+        { data +  23064, 600 },   //  88 AKWF_squ_0089
+        { data +  23252, 600 },   //  89 AKWF_squ_0090
+        { data +  23445, 600 },   //  90 AKWF_squ_0091
+        { data +  23644, 600 },   //  91 AKWF_squ_0092
+        { data +  23851, 600 },   //  92 AKWF_squ_0093
+        { data +  24033, 600 },   //  93 AKWF_squ_0094
+        { data +  24259, 600 },   //  94 AKWF_squ_0095
+        { data +  24467, 600 },   //  95 AKWF_squ_0096
+        { data +  24649, 600 },   //  96 AKWF_squ_0097
+        { data +  24846, 600 },   //  97 AKWF_squ_0098
+        { data +  25070, 600 },   //  98 AKWF_squ_0099
+        { data +  25310, 600 }    //  99 AKWF_squ_0100
+    };
+
+} // namespace AKWF_BwSqu
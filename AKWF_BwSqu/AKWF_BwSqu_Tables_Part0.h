@@ -1,1304 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwSqu {
-
-    // AKWF_squ_0001 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0001[600] PROGMEM = {
-        16932, 32767, 27863, 31009, 28775, 30287, 29260, 29829, 29510, 29562, 29587, 29459, 
-        29555, 29435, 29464, 29387, 29471, 29446, 29422, 29397, 29372, 29347, 29324, 29299, 
-        29274, 29249, 29226, 29201, 29176, 29153, 29128, 29103, 29080, 29055, 29030, 29007, 
-        28982, 28958, 28934, 28910, 28885, 28862, 28837, 28814, 28789, 28766, 28741, 28717, 
-        28693, 28669, 28646, 28621, 28597, 28574, 28549, 28526, 28502, 28479, 28454, 28431, 
-        28407, 28384, 28359, 28336, 28312, 28289, 28265, 28242, 28217, 28194, 28170, 28147, 
-        28123, 28100, 28077, 28053, 28030, 28006, 27983, 27959, 27936, 27913, 27889, 27867, 
-        27844, 27820, 27797, 27773, 27750, 27726, 27704, 27681, 27658, 27634, 27612, 27589, 
-        27565, 27542, 27520, 27496, 27473, 27451, 27427, 27404, 27382, 27359, 27336, 27313, 
-        27291, 27268, 27244, 27222, 27199, 27177, 27155, 27131, 27109, 27086, 27064, 27040, 
-        27018, 26996, 26973, 26951, 26929, 26905, 26883, 26861, 26838, 26816, 26794, 26771, 
-        26748, 26726, 26704, 26682, 26660, 26638, 26614, 26592, 26570, 26548, 26526, 26504, 
-        26482, 26460, 26438, 26416, 26394, 26372, 26350, 26328, 26306, 26284, 26262, 26240, 
-        26217, 26195, 26173, 26153, 26131, 26109, 26087, 26065, 26042, 26022, 26000, 25978, 
-        25956, 25935, 25913, 25891, 25870, 25848, 25826, 25805, 25783, 25761, 25741, 25719, 
-        25697, 25676, 25654, 25633, 25611, 25590, 25568, 25548, 25526, 25505, 25483, 25462, 
-        25440, 25420, 25399, 25377, 25356, 25336, 25313, 25293, 25272, 25250, 25229, 25209, 
-        25187, 25166, 25145, 25125, 25103, 25082, 25061, 25041, 25020, 24998, 24977, 24957, 
-        24936, 24915, 24895, 24874, 24853, 24833, 24812, 24791, 24769, 24748, 24728, 24708, 
-        24688, 24667, 24646, 24626, 24605, 24584, 24564, 24543, 24522, 24502, 24481, 24462, 
-        24441, 24420, 24400, 24379, 24360, 24339, 24318, 24298, 24279, 24258, 24237, 24218, 
-        24197, 24177, 24157, 24137, 24116, 24097, 24076, 24057, 24036, 24015, 23996, 23975, 
-        23956, 23935, 23916, 23895, 23876, 23855, 23836, 23815, 23796, 23777, 23756, 23737, 
-        23716, 23697, 23678, 23657, 23638, 23618, 23598, 23578, 23527, 23551, 23497, 23536, 
-        23468, 23434, 23530, 23223, 23734, 22894, 24046, 22454, 24434, 21888, 25289, 17581, 
-        -23638, -31600, -28553, -30863, -28946, -30436, -29264, -30055, -29495, -29767, -29614, -29616, 
-        -29630, -29554, -29558, -29493, -29574, -29550, -29525, -29500, -29477, -29452, -29427, -29402, 
-        -29377, -29353, -29329, -29304, -29280, -29255, -29231, -29207, -29182, -29158, -29134, -29109, 
-        -29085, -29060, -29036, -29012, -28987, -28964, -28939, -28916, -28891, -28866, -28843, -28819, 
-        -28794, -28771, -28746, -28723, -28698, -28675, -28651, -28626, -28603, -28580, -28555, -28531, 
-        -28508, -28483, -28460, -28436, -28413, -28388, -28365, -28341, -28318, -28294, -28271, -28246, 
-        -28223, -28199, -28176, -28152, -28129, -28105, -28082, -28059, -28035, -28012, -27988, -27965, 
-        -27941, -27918, -27895, -27871, -27848, -27824, -27802, -27779, -27755, -27732, -27709, -27687, 
-        -27663, -27640, -27616, -27593, -27571, -27547, -27524, -27502, -27478, -27455, -27433, -27410, 
-        -27387, -27364, -27341, -27319, -27295, -27273, -27250, -27228, -27204, -27182, -27159, -27137, 
-        -27113, -27091, -27068, -27046, -27024, -27000, -26978, -26956, -26933, -26911, -26889, -26865, 
-        -26843, -26821, -26798, -26776, -26754, -26732, -26709, -26686, -26664, -26642, -26620, -26598, 
-        -26576, -26554, -26532, -26508, -26486, -26464, -26442, -26420, -26398, -26376, -26354, -26332, 
-        -26310, -26288, -26266, -26245, -26223, -26201, -26179, -26157, -26135, -26113, -26092, -26070, 
-        -26048, -26026, -26004, -25983, -25961, -25939, -25917, -25896, -25874, -25852, -25832, -25810, 
-        -25788, -25767, -25745, -25724, -25702, -25680, -25659, -25637, -25617, -25595, -25574, -25552, 
-        -25531, -25509, -25488, -25466, -25446, -25424, -25403, -25382, -25360, -25340, -25319, -25297, 
-        -25276, -25256, -25234, -25213, -25192, -25170, -25149, -25129, -25108, -25087, -25065, -25045, 
-        -25024, -25003, -24983, -24961, -24940, -24919, -24899, -24878, -24857, -24837, -24816, -24795, 
-        -24775, -24754, -24733, -24713, -24692, -24671, -24651, -24630, -24609, -24589, -24568, -24547, 
-        -24527, -24507, -24487, -24466, -24445, -24425, -24404, -24385, -24364, -24343, -24323, -24303, 
-        -24283, -24262, -24243, -24222, -24201, -24181, -24161, -24141, -24121, -24101, -24080, -24061, 
-        -24040, -24021, -24000, -23981, -23960, -23940, -23920, -23900, -23880, -23861, -23840, -23821, 
-        -23800, -23781, -23760, -23741, -23722, -23701, -23682, -23661, -23609, -23642, -23567, -23645, 
-        -23507, -23580, -23529, -23405, -23718, -23059, -24092, -22482, -24728, -21474, -26522, -12446 
-    };
-
-    // AKWF_squ_0002 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0002[600] PROGMEM = {
-        4040, 7188, 9922, 12268, 14118, 15608, 16813, 17813, 18593, 19233, 19793, 20251, 
-        20663, 21047, 21397, 21729, 22069, 22391, 22711, 23031, 23367, 23689, 24015, 24353, 
-        24675, 25003, 25331, 25655, 25965, 26289, 26595, 26891, 27181, 27475, 27751, 28019, 
-        28287, 28535, 28775, 29015, 29235, 29449, 29657, 29853, 30035, 30213, 30385, 30545, 
-        30693, 30843, 30975, 31101, 31225, 31337, 31445, 31545, 31639, 31725, 31807, 31887, 
-        31955, 32023, 32085, 32143, 32195, 32247, 32291, 32335, 32373, 32413, 32443, 32477, 
-        32505, 32529, 32555, 32573, 32597, 32613, 32629, 32647, 32659, 32673, 32683, 32693, 
-        32701, 32711, 32717, 32724, 32732, 32736, 32742, 32744, 32750, 32750, 32752, 32760, 
-        32758, 32762, 32762, 32764, 32764, 32766, 32766, 32766, 32766, 32767, 32767, 32766, 
-        32767, 32766, 32767, 32766, 32766, 32766, 32764, 32767, 32764, 32764, 32764, 32764, 
-        32764, 32762, 32762, 32762, 32760, 32762, 32760, 32760, 32762, 32760, 32760, 32758, 
-        32760, 32758, 32756, 32758, 32758, 32758, 32758, 32754, 32758, 32754, 32756, 32756, 
-        32754, 32756, 32754, 32756, 32754, 32754, 32754, 32754, 32754, 32754, 32754, 32754, 
-        32754, 32756, 32752, 32754, 32754, 32752, 32754, 32754, 32754, 32754, 32754, 32754, 
-        32752, 32754, 32752, 32754, 32752, 32754, 32754, 32752, 32754, 32754, 32754, 32754, 
-        32752, 32754, 32752, 32754, 32754, 32754, 32752, 32752, 32754, 32750, 32756, 32750, 
-        32754, 32752, 32754, 32754, 32752, 32754, 32750, 32754, 32752, 32752, 32754, 32754, 
-        32754, 32752, 32754, 32754, 32752, 32752, 32754, 32752, 32754, 32752, 32754, 32754, 
-        32752, 32754, 32752, 32754, 32752, 32754, 32754, 32754, 32752, 32752, 32754, 32754, 
-        32752, 32754, 32754, 32752, 32754, 32752, 32754, 32752, 32752, 32754, 32752, 32754, 
-        32750, 32754, 32754, 32750, 32754, 32752, 32752, 32754, 32752, 32754, 32754, 32754, 
-        32752, 32754, 32754, 32754, 32752, 32754, 32752, 32752, 32754, 32752, 32754, 32754, 
-        32750, 32754, 32752, 32754, 32754, 32752, 32754, 32750, 32754, 32752, 32752, 32754, 
-        32754, 32752, 32754, 32754, 32752, 32754, 32752, 32752, 32752, 32754, 32752, 32754, 
-        32754, 32752, 32754, 32730, 32235, 30137, 26001, 20407, 14360, 9110, 4470, 284, 
-        -3592, -6852, -9634, -12030, -13924, -15452, -16729, -17711, -18511, -19187, -19735, -20203, 
-        -20615, -21007, -21355, -21693, -22031, -22353, -22675, -23007, -23331, -23651, -23989, -24315, 
-        -24641, -24963, -25299, -25615, -25933, -26253, -26559, -26857, -27161, -27443, -27721, -27989, 
-        -28255, -28507, -28749, -28989, -29213, -29425, -29637, -29831, -30017, -30197, -30369, -30525, 
-        -30679, -30825, -30961, -31087, -31211, -31327, -31429, -31535, -31627, -31715, -31799, -31877, 
-        -31947, -32017, -32077, -32137, -32189, -32239, -32289, -32327, -32373, -32405, -32443, -32473, 
-        -32501, -32527, -32549, -32573, -32593, -32611, -32629, -32645, -32657, -32671, -32683, -32693, 
-        -32701, -32711, -32717, -32724, -32728, -32736, -32742, -32742, -32750, -32748, -32756, -32754, 
-        -32760, -32762, -32762, -32764, -32764, -32764, -32766, -32766, -32766, -32766, -32767, -32766, 
-        -32767, -32766, -32767, -32766, -32766, -32764, -32767, -32764, -32766, -32764, -32764, -32764, 
-        -32764, -32762, -32764, -32760, -32762, -32760, -32762, -32760, -32760, -32760, -32760, -32758, 
-        -32760, -32758, -32756, -32758, -32758, -32756, -32758, -32756, -32756, -32756, -32756, -32754, 
-        -32754, -32756, -32754, -32754, -32756, -32754, -32754, -32754, -32754, -32754, -32754, -32754, 
-        -32754, -32752, -32754, -32754, -32754, -32752, -32754, -32754, -32754, -32754, -32754, -32754, 
-        -32752, -32754, -32752, -32752, -32754, -32752, -32754, -32752, -32754, -32752, -32752, -32752, 
-        -32754, -32754, -32754, -32752, -32754, -32752, -32754, -32752, -32754, -32754, -32750, -32754, 
-        -32752, -32752, -32754, -32754, -32754, -32752, -32754, -32752, -32754, -32752, -32754, -32752, 
-        -32754, -32754, -32752, -32754, -32752, -32754, -32752, -32754, -32752, -32754, -32752, -32754, 
-        -32752, -32752, -32754, -32750, -32754, -32752, -32754, -32754, -32752, -32754, -32750, -32754, 
-        -32750, -32754, -32752, -32754, -32752, -32752, -32752, -32754, -32752, -32754, -32754, -32752, 
-        -32754, -32752, -32754, -32752, -32752, -32754, -32752, -32754, -32754, -32752, -32754, -32752, 
-        -32754, -32754, -32750, -32754, -32752, -32754, -32752, -32752, -32754, -32750, -32754, -32754, 
-        -32750, -32754, -32754, -32752, -32752, -32754, -32754, -32752, -32754, -32752, -32752, -32752, 
-        -32752, -32754, -32752, -32754, -32754, -32752, -32754, -32752, -32754, -32754, -32752, -32754, 
-        -32754, -32752, -32754, -32742, -32345, -30481, -26569, -21089, -14990, -9644, -5018, -98 
-    };
-
-    // AKWF_squ_0003 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0003[600] PROGMEM = {
-        2100, 4170, 6240, 8162, 10032, 11920, 13680, 15368, 17029, 18537, 19941, 21291, 
-        22491, 23591, 24597, 25545, 26373, 27125, 27829, 28443, 28991, 29505, 29945, 30343, 
-        30709, 31021, 31301, 31545, 31769, 31955, 32117, 32261, 32379, 32477, 32561, 32627, 
-        32679, 32715, 32744, 32760, 32766, 32764, 32756, 32740, 32715, 32689, 32661, 32623, 
-        32587, 32547, 32507, 32463, 32423, 32375, 32333, 32287, 32243, 32201, 32155, 32119, 
-        32071, 32035, 31997, 31959, 31923, 31889, 31857, 31825, 31793, 31767, 31741, 31713, 
-        31691, 31667, 31647, 31625, 31609, 31591, 31573, 31559, 31543, 31531, 31517, 31507, 
-        31497, 31487, 31477, 31469, 31463, 31455, 31449, 31443, 31437, 31433, 31427, 31427, 
-        31421, 31417, 31417, 31413, 31409, 31409, 31405, 31405, 31403, 31403, 31399, 31401, 
-        31401, 31397, 31399, 31397, 31397, 31397, 31397, 31395, 31397, 31395, 31397, 31395, 
-        31397, 31395, 31397, 31397, 31395, 31397, 31397, 31397, 31397, 31397, 31397, 31397, 
-        31397, 31399, 31397, 31399, 31397, 31397, 31399, 31397, 31401, 31399, 31397, 31401, 
-        31399, 31401, 31399, 31399, 31401, 31401, 31401, 31401, 31401, 31399, 31401, 31401, 
-        31401, 31399, 31403, 31401, 31401, 31401, 31401, 31401, 31401, 31401, 31401, 31401, 
-        31403, 31401, 31401, 31401, 31401, 31401, 31401, 31403, 31399, 31403, 31401, 31401, 
-        31403, 31401, 31403, 31401, 31401, 31401, 31403, 31401, 31403, 31401, 31401, 31403, 
-        31401, 31401, 31401, 31401, 31403, 31401, 31403, 31401, 31401, 31401, 31403, 31401, 
-        31403, 31401, 31401, 31403, 31401, 31403, 31403, 31401, 31401, 31403, 31401, 31401, 
-        31403, 31401, 31401, 31403, 31401, 31401, 31401, 31403, 31401, 31401, 31401, 31403, 
-        31401, 31403, 31401, 31401, 31403, 31401, 31401, 31403, 31401, 31401, 31401, 31403, 
-        31401, 31401, 31401, 31403, 31401, 31403, 31401, 31401, 31403, 31401, 31403, 31401, 
-        31403, 31401, 31401, 31401, 31403, 31401, 31403, 31401, 31401, 31401, 31403, 31401, 
-        31401, 31401, 31403, 31401, 31403, 31399, 31403, 31401, 31403, 31401, 31403, 31403, 
-        31401, 31403, 31401, 31401, 31403, 31401, 31401, 31401, 31403, 31401, 31409, 31515, 
-        31927, 32373, 31703, 28757, 24199, 19289, 15258, 12150, 9198, 6124, 3122, 520, 
-        -1808, -4012, -6014, -7944, -9886, -11714, -13480, -15178, -16851, -18367, -19783, -21149, 
-        -22357, -23471, -24521, -25443, -26283, -27069, -27755, -28373, -28931, -29449, -29899, -30299, 
-        -30669, -30989, -31269, -31527, -31745, -31935, -32099, -32245, -32367, -32467, -32553, -32621, 
-        -32673, -32715, -32742, -32758, -32767, -32762, -32760, -32740, -32719, -32693, -32663, -32629, 
-        -32593, -32551, -32513, -32465, -32427, -32381, -32337, -32291, -32251, -32203, -32163, -32119, 
-        -32079, -32039, -32001, -31963, -31927, -31893, -31859, -31829, -31799, -31769, -31743, -31717, 
-        -31693, -31669, -31649, -31629, -31609, -31593, -31575, -31559, -31545, -31533, -31519, -31509, 
-        -31497, -31487, -31479, -31471, -31463, -31455, -31451, -31441, -31441, -31431, -31429, -31427, 
-        -31421, -31419, -31415, -31411, -31411, -31409, -31407, -31405, -31403, -31401, -31403, -31399, 
-        -31397, -31401, -31397, -31397, -31395, -31397, -31397, -31397, -31395, -31397, -31395, -31397, 
-        -31395, -31397, -31395, -31397, -31395, -31397, -31397, -31395, -31397, -31397, -31397, -31397, 
-        -31397, -31397, -31399, -31397, -31399, -31397, -31399, -31399, -31399, -31397, -31401, -31399, 
-        -31401, -31399, -31399, -31399, -31401, -31399, -31401, -31399, -31399, -31401, -31401, -31399, 
-        -31403, -31401, -31401, -31401, -31401, -31401, -31401, -31401, -31401, -31401, -31401, -31401, 
-        -31401, -31401, -31401, -31401, -31401, -31401, -31401, -31401, -31403, -31401, -31401, -31401, 
-        -31403, -31399, -31403, -31401, -31403, -31401, -31401, -31403, -31401, -31401, -31401, -31403, 
-        -31401, -31403, -31401, -31401, -31403, -31401, -31403, -31401, -31403, -31401, -31401, -31403, 
-        -31401, -31401, -31401, -31403, -31401, -31401, -31401, -31403, -31401, -31403, -31401, -31401, 
-        -31401, -31401, -31403, -31401, -31401, -31403, -31401, -31403, -31401, -31401, -31403, -31401, 
-        -31401, -31401, -31403, -31401, -31403, -31401, -31401, -31401, -31401, -31403, -31401, -31401, 
-        -31403, -31401, -31403, -31401, -31403, -31401, -31401, -31401, -31403, -31401, -31403, -31401, 
-        -31403, -31401, -31401, -31401, -31401, -31401, -31401, -31401, -31401, -31401, -31403, -31401, 
-        -31403, -31401, -31401, -31401, -31401, -31401, -31401, -31401, -31403, -31401, -31403, -31401, 
-        -31401, -31403, -31401, -31403, -31401, -31401, -31401, -31403, -31403, -31401, -31407, -31491, 
-        -31867, -32349, -31881, -29195, -24767, -19839, -15534, -12462, -9546, -6472, -3478, -528 
-    };
-
-    // AKWF_squ_0004 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0004[600] PROGMEM = {
-        9850, 27765, 20239, 32767, 31678, 30776, 30269, 30058, 30008, 30035, 30101, 30177, 
-        30253, 30320, 30381, 30434, 30479, 30517, 30550, 30580, 30607, 30635, 30660, 30685, 
-        30711, 30736, 30761, 30789, 30816, 30846, 30875, 30905, 30935, 30966, 30996, 31028, 
-        31059, 31091, 31120, 31152, 31182, 31211, 31241, 31270, 31298, 31325, 31353, 31378, 
-        31403, 31429, 31452, 31475, 31496, 31517, 31536, 31555, 31574, 31591, 31608, 31623, 
-        31638, 31650, 31663, 31676, 31686, 31695, 31703, 31712, 31720, 31726, 31731, 31737, 
-        31741, 31743, 31745, 31748, 31750, 31750, 31750, 31748, 31745, 31743, 31741, 31739, 
-        31735, 31731, 31724, 31720, 31714, 31707, 31701, 31695, 31686, 31678, 31672, 31663, 
-        31653, 31644, 31636, 31625, 31615, 31604, 31593, 31583, 31572, 31562, 31551, 31539, 
-        31528, 31515, 31505, 31492, 31479, 31469, 31456, 31444, 31431, 31418, 31406, 31393, 
-        31382, 31370, 31357, 31344, 31332, 31319, 31306, 31294, 31281, 31268, 31256, 31245, 
-        31232, 31220, 31207, 31194, 31184, 31171, 31158, 31148, 31135, 31125, 31112, 31101, 
-        31091, 31078, 31068, 31057, 31047, 31034, 31023, 31013, 31002, 30992, 30983, 30973, 
-        30962, 30952, 30943, 30933, 30922, 30914, 30905, 30895, 30886, 30878, 30867, 30859, 
-        30850, 30842, 30833, 30825, 30816, 30810, 30802, 30793, 30787, 30778, 30772, 30764, 
-        30757, 30749, 30742, 30736, 30730, 30723, 30715, 30709, 30704, 30698, 30692, 30685, 
-        30679, 30673, 30669, 30662, 30658, 30652, 30647, 30641, 30637, 30631, 30626, 30622, 
-        30618, 30614, 30607, 30603, 30599, 30595, 30590, 30586, 30584, 30580, 30576, 30571, 
-        30567, 30565, 30561, 30559, 30555, 30550, 30548, 30544, 30542, 30540, 30536, 30533, 
-        30531, 30527, 30525, 30523, 30521, 30519, 30514, 30512, 30510, 30508, 30506, 30504, 
-        30502, 30500, 30498, 30495, 30493, 30493, 30491, 30489, 30487, 30485, 30485, 30483, 
-        30481, 30481, 30479, 30476, 30476, 30474, 30472, 30472, 30470, 30470, 30468, 30468, 
-        30466, 30466, 30464, 30464, 30462, 30462, 30462, 30460, 30460, 30460, 30457, 30457, 
-        30455, 30455, 30455, 30455, 30453, 30453, 30453, 30453, 30451, 30451, 30451, 30451, 
-        30449, 30449, 30449, 30449, 30449, 30449, 30447, 30447, 30447, 30447, 30447, 30447, 
-        -9850, -27765, -20239, -32767, -31678, -30776, -30269, -30058, -30008, -30035, -30101, -30177, 
-        -30253, -30320, -30381, -30434, -30479, -30517, -30550, -30580, -30607, -30635, -30660, -30685, 
-        -30711, -30736, -30761, -30789, -30816, -30846, -30875, -30905, -30935, -30966, -30996, -31028, 
-        -31059, -31091, -31120, -31152, -31182, -31211, -31241, -31270, -31298, -31325, -31353, -31378, 
-        -31403, -31429, -31452, -31475, -31496, -31517, -31536, -31555, -31574, -31591, -31608, -31623, 
-        -31638, -31650, -31663, -31676, -31686, -31695, -31703, -31712, -31720, -31726, -31731, -31737, 
-        -31741, -31743, -31745, -31748, -31750, -31750, -31750, -31748, -31745, -31743, -31741, -31739, 
-        -31735, -31731, -31724, -31720, -31714, -31707, -31701, -31695, -31686, -31678, -31672, -31663, 
-        -31653, -31644, -31636, -31625, -31615, -31604, -31593, -31583, -31572, -31562, -31551, -31539, 
-        -31528, -31515, -31505, -31492, -31479, -31469, -31456, -31444, -31431, -31418, -31406, -31393, 
-        -31382, -31370, -31357, -31344, -31332, -31319, -31306, -31294, -31281, -31268, -31256, -31245, 
-        -31232, -31220, -31207, -31194, -31184, -31171, -31158, -31148, -31135, -31125, -31112, -31101, 
-        -31091, -31078, -31068, -31057, -31047, -31034, -31023, -31013, -31002, -30992, -30983, -30973, 
-        -30962, -30952, -30943, -30933, -30922, -30914, -30905, -30895, -30886, -30878, -30867, -30859, 
-        -30850, -30842, -30833, -30825, -30816, -30810, -30802, -30793, -30787, -30778, -30772, -30764, 
-        -30757, -30749, -30742, -30736, -30730, -30723, -30715, -30709, -30704, -30698, -30692, -30685, 
-        -30679, -30673, -30669, -30662, -30658, -30652, -30647, -30641, -30637, -30631, -30626, -30622, 
-        -30618, -30614, -30607, -30603, -30599, -30595, -30590, -30586, -30584, -30580, -30576, -30571, 
-        -30567, -30565, -30561, -30559, -30555, -30550, -30548, -30544, -30542, -30540, -30536, -30533, 
-        -30531, -30527, -30525, -30523, -30521, -30519, -30514, -30512, -30510, -30508, -30506, -30504, 
-        -30502, -30500, -30498, -30495, -30493, -30493, -30491, -30489, -30487, -30485, -30485, -30483, 
-        -30481, -30481, -30479, -30476, -30476, -30474, -30472, -30472, -30470, -30470, -30468, -30468, 
-        -30466, -30466, -30464, -30464, -30462, -30462, -30462, -30460, -30460, -30460, -30457, -30457, 
-        -30455, -30455, -30455, -30455, -30453, -30453, -30453, -30453, -30451, -30451, -30451, -30451, 
-        -30449, -30449, -30449, -30449, -30449, -30449, -30447, -30447, -30447, -30447, -30447, -30447 
-    };
-
-    // AKWF_squ_0005 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0005[600] PROGMEM = {
-        340, 2573, 4399, 5842, 7055, 8127, 9152, 10165, 11188, 12206, 13202, 14152, 
-        15042, 15860, 16605, 17281, 17895, 18459, 18983, 19477, 19950, 20409, 20856, 21297, 
-        21730, 22156, 22572, 22976, 23370, 23750, 24116, 24470, 24811, 25140, 25458, 25766, 
-        26065, 26354, 26635, 26909, 27173, 27430, 27677, 27917, 28148, 28370, 28584, 28789, 
-        28986, 29176, 29358, 29531, 29699, 29859, 30014, 30160, 30300, 30435, 30563, 30685, 
-        30802, 30913, 31019, 31120, 31216, 31306, 31392, 31474, 31551, 31625, 31694, 31760, 
-        31822, 31882, 31938, 31990, 32040, 32087, 32131, 32172, 32211, 32248, 32283, 32315, 
-        32346, 32375, 32402, 32427, 32450, 32472, 32493, 32512, 32530, 32548, 32564, 32578, 
-        32592, 32605, 32617, 32627, 32639, 32648, 32657, 32665, 32673, 32681, 32687, 32694, 
-        32699, 32704, 32709, 32714, 32718, 32722, 32726, 32729, 32732, 32735, 32738, 32740, 
-        32742, 32744, 32745, 32748, 32749, 32751, 32752, 32753, 32755, 32756, 32756, 32757, 
-        32758, 32758, 32760, 32760, 32761, 32761, 32761, 32762, 32762, 32762, 32764, 32764, 
-        32764, 32764, 32764, 32765, 32765, 32765, 32765, 32765, 32765, 32765, 32765, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 29311, 19681, 10294, 5524, 2406, 
-        -340, -2573, -4399, -5842, -7055, -8127, -9152, -10165, -11188, -12206, -13202, -14152, 
-        -15042, -15860, -16605, -17281, -17895, -18459, -18983, -19477, -19950, -20409, -20856, -21297, 
-        -21730, -22156, -22572, -22976, -23370, -23750, -24116, -24470, -24811, -25140, -25458, -25766, 
-        -26065, -26354, -26635, -26909, -27173, -27430, -27677, -27917, -28148, -28370, -28584, -28789, 
-        -28986, -29176, -29358, -29531, -29699, -29859, -30014, -30160, -30300, -30435, -30563, -30685, 
-        -30802, -30913, -31019, -31120, -31216, -31306, -31392, -31474, -31551, -31625, -31694, -31760, 
-        -31822, -31882, -31938, -31990, -32040, -32087, -32131, -32172, -32211, -32248, -32283, -32315, 
-        -32346, -32375, -32402, -32427, -32450, -32472, -32493, -32512, -32530, -32548, -32564, -32578, 
-        -32592, -32605, -32617, -32627, -32639, -32648, -32657, -32665, -32673, -32681, -32687, -32694, 
-        -32699, -32704, -32709, -32714, -32718, -32722, -32726, -32729, -32732, -32735, -32738, -32740, 
-        -32742, -32744, -32745, -32748, -32749, -32751, -32752, -32753, -32755, -32756, -32756, -32757, 
-        -32758, -32758, -32760, -32760, -32761, -32761, -32761, -32762, -32762, -32762, -32764, -32764, 
-        -32764, -32764, -32764, -32765, -32765, -32765, -32765, -32765, -32765, -32765, -32765, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -29311, -19681, -10294, -5524, -2406 
-    };
-
-    // AKWF_squ_0006 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0006[600] PROGMEM = {
-        1536, 3771, 6022, 8202, 10142, 11827, 13371, 14794, 16096, 17281, 18354, 19320, 
-        20191, 20973, 21677, 22308, 22875, 23385, 23843, 24256, 24630, 24967, 25273, 25550, 
-        25803, 26034, 26245, 26440, 26619, 26785, 26937, 27080, 27212, 27337, 27453, 27563, 
-        27666, 27763, 27856, 27945, 28028, 28108, 28185, 28259, 28329, 28397, 28463, 28526, 
-        28588, 28647, 28705, 28762, 28816, 28870, 28920, 28971, 29021, 29069, 29117, 29162, 
-        29207, 29252, 29294, 29338, 29378, 29419, 29460, 29499, 29538, 29576, 29614, 29650, 
-        29687, 29723, 29758, 29793, 29826, 29860, 29893, 29927, 29959, 29991, 30021, 30052, 
-        30082, 30113, 30142, 30171, 30200, 30229, 30257, 30284, 30312, 30338, 30366, 30392, 
-        30418, 30443, 30469, 30494, 30518, 30543, 30568, 30591, 30616, 30639, 30662, 30686, 
-        30707, 30729, 30752, 30774, 30796, 30818, 30838, 30860, 30880, 30901, 30921, 30941, 
-        30962, 30981, 31001, 31020, 31039, 31058, 31077, 31096, 31114, 31132, 31151, 31168, 
-        31186, 31203, 31221, 31238, 31255, 31273, 31289, 31305, 31322, 31338, 31354, 31370, 
-        31386, 31402, 31418, 31434, 31449, 31465, 31479, 31494, 31510, 31524, 31539, 31553, 
-        31568, 31581, 31596, 31610, 31623, 31638, 31651, 31664, 31679, 31692, 31705, 31718, 
-        31731, 31744, 31757, 31769, 31782, 31795, 31806, 31820, 31831, 31843, 31856, 31868, 
-        31879, 31891, 31902, 31914, 31926, 31937, 31948, 31959, 31971, 31981, 31993, 32003, 
-        32014, 32025, 32035, 32046, 32057, 32067, 32077, 32087, 32097, 32107, 32118, 32128, 
-        32138, 32148, 32157, 32167, 32177, 32186, 32196, 32206, 32215, 32224, 32234, 32243, 
-        32251, 32262, 32270, 32279, 32288, 32296, 32305, 32314, 32323, 32331, 32340, 32349, 
-        32356, 32365, 32373, 32382, 32389, 32398, 32407, 32414, 32421, 32430, 32437, 32446, 
-        32453, 32461, 32469, 32477, 32484, 32491, 32499, 32506, 32515, 32522, 32529, 32536, 
-        32544, 32551, 32558, 32565, 32571, 32578, 32586, 32593, 32600, 32606, 32613, 32619, 
-        32626, 32634, 32640, 32647, 32653, 32660, 32666, 32672, 32679, 32685, 32690, 32698, 
-        32704, 32709, 32717, 32722, 32728, 32734, 32740, 32746, 32752, 32757, 32763, 32767, 
-        32756, 32680, 32448, 31849, 25750, 16648, 11689, 7753, 3815, 161, -3415, -6647, 
-        -9690, -12388, -14866, -17038, -19002, -20713, -22244, -23572, -24751, -25773, -26674, -27453, 
-        -28141, -28734, -29255, -29703, -30097, -30435, -30732, -30988, -31210, -31402, -31568, -31712, 
-        -31837, -31943, -32036, -32116, -32184, -32243, -32292, -32334, -32371, -32401, -32427, -32449, 
-        -32467, -32481, -32493, -32501, -32509, -32513, -32517, -32519, -32520, -32520, -32519, -32517, 
-        -32515, -32512, -32507, -32503, -32499, -32493, -32487, -32481, -32475, -32469, -32462, -32456, 
-        -32449, -32442, -32435, -32427, -32420, -32413, -32405, -32397, -32389, -32382, -32373, -32365, 
-        -32358, -32349, -32342, -32333, -32324, -32315, -32307, -32298, -32289, -32280, -32272, -32263, 
-        -32253, -32244, -32235, -32225, -32216, -32208, -32198, -32189, -32179, -32168, -32160, -32150, 
-        -32139, -32129, -32121, -32110, -32100, -32090, -32080, -32068, -32058, -32048, -32038, -32026, 
-        -32016, -32006, -31994, -31984, -31972, -31961, -31950, -31939, -31927, -31916, -31904, -31892, 
-        -31881, -31869, -31857, -31846, -31833, -31821, -31808, -31796, -31783, -31772, -31758, -31745, 
-        -31732, -31721, -31708, -31693, -31680, -31667, -31654, -31639, -31626, -31613, -31599, -31584, 
-        -31569, -31555, -31540, -31526, -31511, -31497, -31482, -31468, -31452, -31437, -31421, -31405, 
-        -31389, -31373, -31359, -31341, -31325, -31309, -31292, -31276, -31258, -31241, -31225, -31207, 
-        -31190, -31171, -31154, -31136, -31117, -31098, -31081, -31062, -31043, -31024, -31004, -30985, 
-        -30965, -30946, -30925, -30905, -30885, -30864, -30843, -30822, -30800, -30779, -30757, -30735, 
-        -30712, -30690, -30667, -30643, -30620, -30597, -30574, -30549, -30524, -30499, -30475, -30450, 
-        -30424, -30398, -30371, -30345, -30318, -30292, -30264, -30235, -30207, -30178, -30149, -30120, 
-        -30089, -30060, -30030, -29998, -29967, -29935, -29903, -29870, -29836, -29803, -29768, -29735, 
-        -29698, -29663, -29627, -29589, -29551, -29514, -29476, -29435, -29396, -29355, -29313, -29271, 
-        -29229, -29185, -29140, -29095, -29048, -29002, -28954, -28904, -28855, -28804, -28752, -28698, 
-        -28644, -28589, -28532, -28474, -28415, -28353, -28291, -28227, -28163, -28095, -28026, -27955, 
-        -27882, -27807, -27728, -27648, -27567, -27481, -27392, -27302, -27206, -27107, -27006, -26898, 
-        -26788, -26670, -26548, -26420, -26283, -26139, -25987, -25691, -25097, -24265, -23287, -22174, 
-        -20925, -19546, -18045, -16434, -14717, -12907, -11020, -9062, -7039, -4960, -2832, -664 
-    };
-
-    // AKWF_squ_0007 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0007[600] PROGMEM = {
-        4623, 22576, 32003, 32767, 32071, 32011, 31878, 31725, 31581, 31434, 31290, 31149, 
-        31010, 30867, 30728, 30584, 30445, 30305, 30168, 30032, 29893, 29756, 29617, 29483, 
-        29346, 29213, 29079, 28943, 28809, 28675, 28545, 28412, 28282, 28150, 28018, 27889, 
-        27759, 27632, 27502, 27374, 27246, 27118, 26992, 26866, 26741, 26614, 26490, 26365, 
-        26240, 26118, 25994, 25873, 25750, 25628, 25506, 25385, 25266, 25145, 25027, 24907, 
-        24787, 24669, 24551, 24435, 24317, 24201, 24084, 23968, 23854, 23739, 23626, 23511, 
-        23396, 23284, 23171, 23059, 22947, 22835, 22724, 22613, 22503, 22393, 22285, 22175, 
-        22066, 21957, 21850, 21743, 21636, 21529, 21422, 21316, 21211, 21107, 21002, 20897, 
-        20794, 20690, 20587, 20483, 20382, 20281, 20179, 20078, 19976, 19876, 19776, 19678, 
-        19579, 19479, 19381, 19283, 19186, 19088, 18992, 18894, 18798, 18703, 18606, 18512, 
-        18417, 18323, 18229, 18135, 18042, 17949, 17857, 17764, 17672, 17581, 17490, 17400, 
-        17309, 17219, 17128, 17039, 16949, 16861, 16773, 16685, 16596, 16508, 16421, 16335, 
-        16248, 16164, 16077, 15991, 15906, 15821, 15737, 15653, 15570, 15485, 15401, 15318, 
-        15237, 15154, 15072, 14991, 14909, 14828, 14746, 14666, 14586, 14506, 14428, 14348, 
-        14269, 14191, 14112, 14035, 13956, 13880, 13802, 13726, 13649, 13573, 13497, 13421, 
-        13347, 13272, 13197, 13123, 13048, 12974, 12900, 12828, 12755, 12684, 12611, 12538, 
-        12466, 12394, 12325, 12253, 12183, 12112, 12041, 11972, 11903, 11833, 11764, 11696, 
-        11627, 11559, 11492, 11424, 11357, 11289, 11223, 11156, 11090, 11024, 10958, 10894, 
-        10828, 10762, 10697, 10634, 10570, 10504, 10441, 10377, 10314, 10251, 10189, 10127, 
-        10063, 10002, 9940, 9879, 9817, 9756, 9696, 9634, 9574, 9514, 9455, 9395, 
-        9336, 9276, 9216, 9159, 9100, 9042, 8985, 8926, 8868, 8811, 8755, 8698, 
-        8641, 8585, 8528, 8472, 8416, 8363, 8307, 8252, 8197, 8140, 8087, 8033, 
-        7982, 7926, 7872, 7819, 7765, 7715, 7662, 7610, 7556, 7504, 7454, 7402, 
-        7352, 7301, 7250, 7198, 7148, 7100, 7049, 7002, 6950, 6902, 6850, 6803, 
-        6757, 6709, 6664, 6610, 6563, 6515, 6474, 6431, 6390, 6337, 6312, 4480, 
-        -5780, -23679, -32281, -32755, -32069, -32012, -31868, -31721, -31580, -31435, -31287, -31142, 
-        -31002, -30861, -30725, -30579, -30440, -30298, -30159, -30023, -29885, -29750, -29610, -29473, 
-        -29336, -29203, -29069, -28935, -28802, -28665, -28534, -28401, -28270, -28140, -28008, -27879, 
-        -27747, -27619, -27489, -27362, -27235, -27107, -26980, -26852, -26728, -26602, -26478, -26353, 
-        -26228, -26105, -25982, -25860, -25738, -25617, -25495, -25373, -25254, -25134, -25015, -24895, 
-        -24776, -24658, -24540, -24423, -24307, -24190, -24074, -23959, -23843, -23728, -23615, -23501, 
-        -23388, -23274, -23161, -23048, -22938, -22827, -22714, -22604, -22493, -22384, -22276, -22166, 
-        -22058, -21949, -21842, -21734, -21628, -21522, -21415, -21309, -21203, -21098, -20994, -20890, 
-        -20787, -20682, -20580, -20476, -20374, -20273, -20172, -20071, -19969, -19868, -19768, -19669, 
-        -19571, -19472, -19373, -19274, -19177, -19079, -18983, -18886, -18790, -18695, -18598, -18504, 
-        -18409, -18315, -18221, -18126, -18034, -17939, -17848, -17756, -17664, -17573, -17481, -17390, 
-        -17300, -17210, -17120, -17030, -16941, -16853, -16765, -16676, -16589, -16501, -16414, -16327, 
-        -16241, -16155, -16069, -15985, -15899, -15813, -15730, -15645, -15563, -15478, -15396, -15312, 
-        -15230, -15147, -15066, -14985, -14903, -14822, -14741, -14661, -14581, -14501, -14422, -14342, 
-        -14263, -14184, -14107, -14029, -13951, -13874, -13796, -13720, -13643, -13567, -13492, -13416, 
-        -13341, -13266, -13192, -13116, -13042, -12969, -12895, -12822, -12748, -12676, -12605, -12532, 
-        -12460, -12388, -12318, -12246, -12177, -12106, -12036, -11965, -11896, -11827, -11758, -11690, 
-        -11620, -11552, -11484, -11417, -11350, -11283, -11216, -11149, -11083, -11017, -10951, -10886, 
-        -10821, -10756, -10691, -10627, -10563, -10498, -10435, -10371, -10308, -10246, -10182, -10121, 
-        -10059, -9997, -9935, -9874, -9812, -9752, -9692, -9630, -9570, -9509, -9449, -9391, 
-        -9332, -9274, -9213, -9154, -9095, -9039, -8981, -8922, -8866, -8807, -8751, -8694, 
-        -8638, -8583, -8525, -8470, -8413, -8359, -8304, -8249, -8194, -8138, -8084, -8029, 
-        -7977, -7923, -7870, -7816, -7762, -7709, -7656, -7605, -7553, -7501, -7448, -7395, 
-        -7345, -7295, -7245, -7194, -7142, -7091, -7040, -6994, -6943, -6896, -6842, -6793, 
-        -6744, -6696, -6653, -6602, -6555, -6501, -6454, -6408, -6368, -6319, -6264, -4108 
-    };
-
-    // AKWF_squ_0008 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0008[600] PROGMEM = {
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767 
-    };
-
-    // AKWF_squ_0009 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0009[600] PROGMEM = {
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767 
-    };
-
-    // AKWF_squ_0010 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0010[600] PROGMEM = {
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767 
-    };
-
-    // AKWF_squ_0011 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0011[600] PROGMEM = {
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767 
-    };
-
-    // AKWF_squ_0012 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0012[600] PROGMEM = {
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767 
-    };
-
-    // AKWF_squ_0013 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0013[600] PROGMEM = {
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -20487, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767 
-    };
-
-    // AKWF_squ_0014 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0014[600] PROGMEM = {
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767 
-    };
-
-    // AKWF_squ_0015 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0015[600] PROGMEM = {
-        0, 9045, 9158, 9273, 9386, 9499, 9612, 9725, 9841, 9954, 10067, 10180, 
-        10295, 10408, 10521, 10634, 10747, 10862, 10975, 11088, 11201, 11314, 11430, 11542, 
-        11655, 11768, 11881, 11997, 12110, 12223, 12336, 12451, 12564, 12677, 12790, 12905, 
-        13018, 13131, 13244, 13360, 13473, 13586, 13699, 13812, 13927, 14040, 14153, 14266, 
-        14379, 14494, 14607, 14720, 14833, 14949, 15062, 15175, 15287, 15400, 15516, 15629, 
-        15742, 15857, 15970, 16083, 16196, 16309, 16425, 16538, 16650, 16763, 16876, 16992, 
-        17105, 17218, 17331, 17444, 17559, 17672, 17785, 17898, 18013, 18126, 18239, 18352, 
-        18465, 18581, 18694, 18807, 18920, 19032, 19148, 19261, 19374, 19489, 19602, 19715, 
-        19828, 19941, 20057, 20170, 20282, 20395, 20511, 20624, 20737, 20850, 20963, 21078, 
-        21191, 21304, 21417, 21530, 21645, 21758, 21871, 21984, 22100, 22213, 22326, 22439, 
-        22552, 22667, 22780, 22893, 23008, 23121, 23234, 23347, 23460, 23576, 23689, 23802, 
-        23915, 24027, 24143, 24256, 24369, 24482, 24595, 24710, 24823, 24936, 25049, 25165, 
-        25278, 25390, 25503, 25616, 25732, 25845, 25958, 26073, 26186, 26299, 26412, 26525, 
-        26641, 26753, 26866, 26979, 27092, 27208, 27321, 27434, 27547, 27662, 27775, 27888, 
-        28001, 28114, 28229, 28342, 28455, 28568, 28681, 28797, 28910, 29023, 29135, 29251, 
-        29364, 29477, 29590, 29705, 29818, 29931, 30044, 30157, 30273, 30385, 30498, 30611, 
-        30727, 30840, 30953, 31066, 31179, 31294, 31407, 31520, 31633, 31746, 31861, 31974, 
-        32087, 32200, 32316, 32429, 32542, 32655, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        0, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767 
-    };
-
-    // AKWF_squ_0016 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0016[600] PROGMEM = {
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767 
-    };
-
-    // AKWF_squ_0017 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0017[600] PROGMEM = {
-        110, 218, 328, 436, 546, 657, 764, 875, 983, 1093, 1201, 1311, 
-        1419, 1529, 1640, 1748, 1858, 1966, 2076, 2184, 2294, 2402, 2512, 2623, 
-        2731, 2838, 2949, 3059, 3167, 3277, 3385, 3496, 3606, 3714, 3821, 3932, 
-        4042, 4150, 4260, 4368, 4479, 4589, 4697, 4805, 4915, 5025, 5133, 5244, 
-        5351, 5462, 5572, 5680, 5788, 5898, 6008, 6116, 6227, 6334, 6445, 6555, 
-        6663, 6771, 6881, 6992, 7099, 7210, 7318, 7428, 7538, 7646, 7754, 7864, 
-        7975, 8082, 8193, 8301, 8411, 8519, 8629, 8737, 8847, 8958, 9066, 9176, 
-        9284, 9394, 9502, 9612, 9720, 9830, 9941, 10049, 10159, 10267, 10377, 10485, 
-        10595, 10703, 10814, 10924, 11032, 11142, 11252, 11360, 11468, 11578, 11686, 11797, 
-        11907, 12015, 12125, 12236, 12343, 12451, 12562, 12669, 12780, 12890, 12998, 13108, 
-        13216, 13326, 13434, 13545, 13652, 13763, 13873, 13981, 14091, 14199, 14310, 14417, 
-        14528, 14635, 14746, 14856, 14964, 15074, 15182, 15293, 15400, 15511, 15619, 15729, 
-        15839, 15947, 16058, 16165, 16276, 16384, 16494, 16602, 16712, 16822, 16930, 17041, 
-        17148, 17259, 17367, 17477, 17585, 17695, 17806, 17913, 18024, 18132, 18242, 18350, 
-        18460, 18568, 18678, 18789, 18896, 19007, 19115, 19225, 19333, 19443, 19551, 19661, 
-        19772, 19880, 19990, 20098, 20208, 20316, 20426, 20534, 20644, 20755, 20863, 20973, 
-        21081, 21191, 21299, 21409, 21517, 21628, 21738, 21846, 21956, 22064, 22174, 22282, 
-        22392, 22503, 22611, 22721, 22829, 22939, 23047, 23157, 23265, 23376, 23486, 23594, 
-        23704, 23812, 23922, 24030, 24140, 24248, 24359, 24469, 24577, 24687, 24795, 24903, 
-        25013, 25124, 25231, 25342, 25452, 25560, 25670, 25778, 25886, 25996, 26107, 26214, 
-        26325, 26435, 26543, 26653, 26761, 26869, 26979, 27090, 27198, 27308, 27418, 27526, 
-        27636, 27744, 27852, 27962, 28073, 28181, 28291, 28401, 28509, 28620, 28727, 28835, 
-        28946, 29056, 29164, 29274, 29384, 29492, 29600, 29710, 29818, 29929, 30039, 30147, 
-        30257, 30368, 30475, 30583, 30694, 30801, 30912, 31022, 31130, 31240, 31351, 31458, 
-        31566, 31677, 31784, 31895, 32005, 32113, 32223, 32334, 32442, 32549, 32660, 0, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 0 
-    };
-
-    // AKWF_squ_0018 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0018[600] PROGMEM = {
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767 
-    };
-
-    // AKWF_squ_0019 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0019[600] PROGMEM = {
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767 
-    };
-
-    // AKWF_squ_0020 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0020[600] PROGMEM = {
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767 
-    };
-
-    // AKWF_squ_0021 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0021[600] PROGMEM = {
-        6979, 22389, 31571, 32651, 32051, 31976, 31835, 31685, 31538, 31402, 31261, 31125, 
-        30984, 30840, 30701, 30558, 30423, 30284, 30148, 30008, 29869, 29733, 29595, 29463, 
-        29327, 29193, 29056, 28920, 28788, 28655, 28525, 28392, 28259, 28127, 27996, 27867, 
-        27737, 27610, 27479, 27350, 27223, 27096, 26971, 26844, 26717, 26590, 26466, 26341, 
-        26217, 26094, 25969, 25847, 25724, 25604, 25481, 25360, 25240, 25119, 25000, 24879, 
-        24761, 24644, 24526, 24408, 24291, 24176, 24060, 23945, 23829, 23715, 23600, 23486, 
-        23372, 23259, 23148, 23035, 22923, 22812, 22701, 22592, 22481, 22372, 22262, 22152, 
-        22046, 21937, 21830, 21722, 21615, 21508, 21403, 21298, 21192, 21089, 20983, 20880, 
-        20776, 20672, 20570, 20466, 20364, 20262, 20161, 20061, 19960, 19861, 19759, 19660, 
-        19561, 19463, 19366, 19266, 19169, 19071, 18974, 18878, 18782, 18686, 18590, 18495, 
-        18399, 18305, 18212, 18118, 18025, 17932, 17839, 17746, 17655, 17563, 17472, 17382, 
-        17291, 17201, 17111, 17021, 16933, 16843, 16755, 16667, 16579, 16492, 16405, 16318, 
-        16232, 16145, 16060, 15975, 15890, 15804, 15719, 15636, 15552, 15468, 15386, 15303, 
-        15221, 15139, 15057, 14976, 14894, 14814, 14733, 14653, 14572, 14493, 14414, 14335, 
-        14256, 14177, 14100, 14022, 13945, 13868, 13790, 13714, 13637, 13561, 13485, 13409, 
-        13335, 13259, 13185, 13110, 13038, 12963, 12889, 12816, 12743, 12671, 12598, 12527, 
-        12455, 12383, 12312, 12240, 12171, 12099, 12030, 11960, 11890, 11821, 11751, 11683, 
-        11615, 11547, 11479, 11410, 11344, 11277, 11211, 11144, 11076, 11011, 10944, 10879, 
-        10814, 10749, 10684, 10619, 10556, 10492, 10429, 10365, 10302, 10238, 10176, 10114, 
-        10053, 9992, 9930, 9868, 9806, 9746, 9686, 9625, 9566, 9504, 9446, 9385, 
-        9326, 9269, 9209, 9151, 9093, 9034, 8976, 8919, 8863, 8805, 8747, 8690, 
-        8634, 8579, 8523, 8467, 8410, 8354, 8300, 8246, 8192, 8136, 8082, 8026, 
-        7973, 7919, 7866, 7814, 7758, 7705, 7651, 7602, 7551, 7498, 7445, 7391, 
-        7341, 7289, 7241, 7190, 7137, 7084, 7033, 6987, 6939, 6891, 6838, 6789, 
-        6739, 6690, 6646, 6597, 6550, 6495, 6447, 6400, 6361, 6313, 6259, 3946, 
-        -5965, -21412, -31304, -32767, -32117, -32001, -31857, -31708, -31568, -31428, -31286, -31143, 
-        -30998, -30854, -30716, -30575, -30440, -30296, -30157, -30018, -29880, -29745, -29607, -29473, 
-        -29333, -29199, -29064, -28931, -28799, -28665, -28531, -28397, -28267, -28135, -28005, -27875, 
-        -27743, -27613, -27483, -27356, -27229, -27102, -26975, -26847, -26721, -26594, -26472, -26348, 
-        -26223, -26099, -25975, -25853, -25731, -25610, -25489, -25367, -25247, -25127, -25009, -24890, 
-        -24771, -24651, -24534, -24418, -24300, -24185, -24069, -23953, -23837, -23722, -23609, -23495, 
-        -23382, -23269, -23156, -23044, -22933, -22821, -22711, -22600, -22488, -22378, -22270, -22162, 
-        -22055, -21945, -21838, -21730, -21623, -21516, -21411, -21306, -21200, -21095, -20990, -20886, 
-        -20784, -20680, -20576, -20473, -20370, -20268, -20168, -20067, -19966, -19866, -19765, -19666, 
-        -19567, -19468, -19370, -19271, -19174, -19076, -18980, -18882, -18786, -18690, -18594, -18500, 
-        -18406, -18311, -18217, -18124, -18029, -17936, -17845, -17752, -17661, -17569, -17477, -17387, 
-        -17297, -17207, -17117, -17028, -16938, -16850, -16761, -16673, -16586, -16498, -16411, -16325, 
-        -16238, -16153, -16068, -15982, -15896, -15811, -15727, -15643, -15560, -15476, -15393, -15309, 
-        -15227, -15145, -15063, -14982, -14900, -14820, -14738, -14659, -14578, -14499, -14420, -14340, 
-        -14261, -14182, -14104, -14027, -13948, -13872, -13793, -13717, -13641, -13566, -13490, -13414, 
-        -13338, -13264, -13189, -13115, -13041, -12966, -12892, -12819, -12747, -12675, -12603, -12530, 
-        -12459, -12386, -12316, -12245, -12175, -12104, -12033, -11963, -11893, -11825, -11757, -11688, 
-        -11619, -11550, -11483, -11415, -11348, -11282, -11215, -11149, -11082, -11017, -10951, -10886, 
-        -10820, -10755, -10690, -10625, -10562, -10498, -10435, -10370, -10308, -10245, -10183, -10121, 
-        -10057, -9997, -9933, -9873, -9813, -9751, -9692, -9630, -9569, -9509, -9450, -9391, 
-        -9331, -9272, -9212, -9155, -9096, -9037, -8980, -8921, -8863, -8806, -8749, -8693, 
-        -8637, -8580, -8523, -8467, -8410, -8357, -8301, -8246, -8192, -8136, -8082, -8027, 
-        -7975, -7922, -7868, -7814, -7758, -7708, -7656, -7605, -7552, -7498, -7447, -7396, 
-        -7348, -7295, -7245, -7193, -7142, -7094, -7044, -6998, -6945, -6897, -6846, -6798, 
-        -6753, -6707, -6662, -6608, -6561, -6512, -6473, -6431, -6391, -6338, -6317, -4378 
-    };
-
-    // AKWF_squ_0022 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0022[600] PROGMEM = {
-        7996, 23248, 31919, 32767, 32184, 32115, 31977, 31834, 31685, 31539, 31394, 31257, 
-        31119, 30978, 30835, 30691, 30554, 30413, 30278, 30138, 30000, 29862, 29722, 29588, 
-        29452, 29318, 29182, 29045, 28911, 28776, 28644, 28512, 28380, 28247, 28115, 27984, 
-        27854, 27725, 27594, 27465, 27335, 27207, 27080, 26954, 26828, 26699, 26573, 26448, 
-        26322, 26199, 26075, 25952, 25826, 25705, 25582, 25460, 25339, 25218, 25097, 24975, 
-        24857, 24739, 24619, 24501, 24383, 24265, 24148, 24031, 23916, 23800, 23684, 23569, 
-        23456, 23341, 23228, 23116, 23003, 22891, 22777, 22667, 22556, 22447, 22337, 22226, 
-        22117, 22008, 21901, 21792, 21684, 21577, 21469, 21363, 21257, 21153, 21047, 20943, 
-        20838, 20734, 20631, 20528, 20425, 20323, 20220, 20118, 20017, 19916, 19816, 19716, 
-        19615, 19517, 19417, 19319, 19222, 19122, 19025, 18927, 18830, 18734, 18639, 18543, 
-        18447, 18351, 18256, 18163, 18069, 17975, 17882, 17788, 17696, 17604, 17512, 17421, 
-        17329, 17239, 17148, 17057, 16968, 16879, 16790, 16700, 16612, 16523, 16436, 16350, 
-        16262, 16175, 16089, 16003, 15917, 15832, 15746, 15662, 15578, 15493, 15410, 15327, 
-        15244, 15160, 15079, 14996, 14914, 14833, 14752, 14670, 14591, 14509, 14431, 14351, 
-        14273, 14193, 14115, 14036, 13958, 13881, 13803, 13726, 13648, 13573, 13496, 13421, 
-        13346, 13269, 13195, 13120, 13045, 12971, 12897, 12824, 12750, 12676, 12603, 12532, 
-        12460, 12388, 12316, 12243, 12173, 12102, 12032, 11962, 11892, 11821, 11751, 11683, 
-        11614, 11545, 11477, 11408, 11341, 11272, 11206, 11138, 11072, 11006, 10939, 10873, 
-        10807, 10742, 10676, 10612, 10547, 10481, 10418, 10355, 10291, 10228, 10163, 10102, 
-        10039, 9978, 9915, 9853, 9792, 9729, 9669, 9609, 9549, 9488, 9428, 9368, 
-        9308, 9250, 9190, 9133, 9073, 9014, 8957, 8898, 8843, 8785, 8728, 8670, 
-        8613, 8556, 8501, 8447, 8389, 8333, 8277, 8221, 8168, 8114, 8060, 8002, 
-        7950, 7894, 7844, 7792, 7736, 7683, 7626, 7575, 7523, 7472, 7420, 7366, 
-        7314, 7259, 7211, 7161, 7112, 7058, 7003, 6949, 6897, 6854, 6806, 6743, 
-        6702, 6250, 1338, -11834, -26067, -31840, -31662, -31265, -31200, -31056, -30928, -30786, 
-        -30646, -30502, -30368, -30232, -30100, -29963, -29826, -29690, -29553, -29423, -29287, -29155, 
-        -29022, -28887, -28756, -28623, -28495, -28363, -28234, -28102, -27972, -27844, -27716, -27590, 
-        -27461, -27333, -27206, -27080, -26956, -26830, -26707, -26580, -26455, -26332, -26210, -26088, 
-        -25966, -25843, -25720, -25600, -25480, -25361, -25241, -25121, -25003, -24883, -24767, -24650, 
-        -24533, -24418, -24300, -24185, -24070, -23955, -23841, -23727, -23614, -23500, -23388, -23276, 
-        -23164, -23053, -22941, -22831, -22720, -22611, -22502, -22395, -22286, -22177, -22071, -21964, 
-        -21858, -21750, -21644, -21538, -21434, -21330, -21225, -21121, -21018, -20914, -20811, -20708, 
-        -20607, -20505, -20404, -20303, -20203, -20103, -20003, -19903, -19805, -19707, -19607, -19509, 
-        -19412, -19316, -19219, -19121, -19025, -18929, -18834, -18740, -18645, -18551, -18456, -18362, 
-        -18269, -18176, -18084, -17991, -17900, -17808, -17716, -17625, -17535, -17444, -17355, -17266, 
-        -17176, -17088, -16999, -16912, -16824, -16735, -16649, -16562, -16476, -16390, -16304, -16218, 
-        -16132, -16049, -15963, -15880, -15796, -15713, -15628, -15545, -15464, -15381, -15300, -15218, 
-        -15137, -15056, -14976, -14896, -14816, -14736, -14657, -14577, -14498, -14420, -14342, -14264, 
-        -14185, -14109, -14032, -13957, -13880, -13805, -13728, -13653, -13577, -13502, -13428, -13353, 
-        -13280, -13204, -13132, -13059, -12986, -12914, -12841, -12768, -12696, -12626, -12555, -12483, 
-        -12412, -12342, -12271, -12202, -12133, -12062, -11993, -11924, -11855, -11787, -11720, -11652, 
-        -11585, -11516, -11450, -11382, -11318, -11252, -11186, -11120, -11054, -10989, -10923, -10860, 
-        -10796, -10731, -10667, -10602, -10541, -10478, -10415, -10352, -10289, -10228, -10166, -10105, 
-        -10044, -9982, -9921, -9861, -9801, -9741, -9681, -9621, -9563, -9503, -9443, -9387, 
-        -9328, -9270, -9212, -9153, -9096, -9040, -8983, -8926, -8869, -8812, -8756, -8700, 
-        -8647, -8591, -8535, -8479, -8424, -8370, -8317, -8263, -8209, -8154, -8100, -8046, 
-        -7994, -7942, -7888, -7836, -7782, -7732, -7680, -7629, -7577, -7525, -7474, -7422, 
-        -7373, -7322, -7273, -7222, -7170, -7121, -7072, -7024, -6975, -6926, -6875, -6826, 
-        -6780, -6732, -6686, -6636, -6588, -6541, -6493, -6450, -6402, -6358, -6307, -6260, 
-        -6217, -6171, -6131, -6083, -6040, -5989, -5946, -5907, -5871, -5825, -5782, -3602 
-    };
-
-    // AKWF_squ_0023 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0023[600] PROGMEM = {
-        10793, 25583, 32583, 32767, 32275, 32196, 32028, 31878, 31730, 31591, 31446, 31305, 
-        31155, 31010, 30868, 30728, 30590, 30446, 30306, 30164, 30025, 29886, 29748, 29614, 
-        29473, 29337, 29200, 29065, 28931, 28796, 28663, 28527, 28394, 28260, 28130, 27999, 
-        27867, 27737, 27604, 27476, 27348, 27219, 27093, 26964, 26836, 26707, 26584, 26458, 
-        26333, 26209, 26084, 25960, 25836, 25714, 25592, 25470, 25349, 25227, 25106, 24985, 
-        24868, 24747, 24628, 24510, 24391, 24275, 24159, 24043, 23925, 23809, 23693, 23578, 
-        23465, 23350, 23237, 23123, 23010, 22898, 22787, 22675, 22564, 22452, 22340, 22232, 
-        22122, 22013, 21905, 21796, 21688, 21579, 21474, 21367, 21260, 21153, 21048, 20942, 
-        20838, 20734, 20631, 20525, 20423, 20319, 20218, 20116, 20015, 19912, 19812, 19711, 
-        19611, 19512, 19413, 19313, 19214, 19115, 19019, 18921, 18824, 18727, 18630, 18534, 
-        18439, 18345, 18250, 18155, 18060, 17966, 17873, 17781, 17688, 17596, 17504, 17411, 
-        17321, 17231, 17139, 17050, 16959, 16870, 16780, 16691, 16604, 16516, 16427, 16340, 
-        16251, 16166, 16080, 15995, 15908, 15822, 15736, 15651, 15567, 15483, 15399, 15315, 
-        15232, 15148, 15067, 14985, 14902, 14820, 14739, 14658, 14577, 14496, 14416, 14335, 
-        14257, 14176, 14098, 14020, 13943, 13863, 13785, 13709, 13631, 13554, 13478, 13402, 
-        13327, 13250, 13175, 13099, 13026, 12951, 12878, 12803, 12729, 12656, 12584, 12511, 
-        12439, 12366, 12294, 12224, 12153, 12081, 12011, 11939, 11869, 11800, 11732, 11663, 
-        11592, 11524, 11456, 11388, 11320, 11253, 11186, 11119, 11052, 10984, 10919, 10853, 
-        10787, 10721, 10656, 10592, 10527, 10463, 10399, 10333, 10271, 10207, 10144, 10081, 
-        10019, 9956, 9892, 9831, 9768, 9708, 9647, 9585, 9525, 9462, 9403, 9343, 
-        9284, 9224, 9163, 9105, 9045, 8987, 8929, 8871, 8813, 8753, 8697, 8639, 
-        8584, 8527, 8469, 8413, 8355, 8301, 8245, 8191, 8135, 8080, 8025, 7970, 
-        7918, 7863, 7811, 7754, 7699, 7649, 7597, 7548, 7493, 7441, 7386, 7335, 
-        7288, 7239, 7192, 7135, 7085, 7033, 6989, 6970, 6741, 2817, -9355, -24172, 
-        -31240, -31455, -30966, -30891, -30729, -30589, -30448, -30315, -30178, -30043, -29901, -29762, 
-        -29627, -29493, -29363, -29226, -29091, -28955, -28824, -28692, -28561, -28433, -28300, -28170, 
-        -28038, -27912, -27785, -27656, -27530, -27400, -27274, -27148, -27022, -26898, -26773, -26649, 
-        -26524, -26402, -26280, -26157, -26037, -25914, -25792, -25671, -25552, -25433, -25315, -25196, 
-        -25077, -24959, -24843, -24727, -24610, -24493, -24379, -24263, -24148, -24035, -23922, -23807, 
-        -23694, -23581, -23470, -23358, -23247, -23137, -23025, -22913, -22803, -22695, -22586, -22478, 
-        -22369, -22261, -22154, -22047, -21942, -21836, -21729, -21624, -21518, -21414, -21311, -21205, 
-        -21103, -20999, -20896, -20794, -20692, -20591, -20488, -20388, -20287, -20187, -20088, -19989, 
-        -19890, -19790, -19692, -19593, -19497, -19401, -19303, -19206, -19110, -19015, -18919, -18826, 
-        -18731, -18637, -18542, -18449, -18355, -18264, -18171, -18079, -17987, -17895, -17804, -17715, 
-        -17623, -17535, -17445, -17355, -17266, -17177, -17090, -17002, -16914, -16826, -16739, -16653, 
-        -16568, -16482, -16396, -16311, -16225, -16141, -16057, -15973, -15889, -15805, -15723, -15640, 
-        -15558, -15477, -15394, -15312, -15231, -15150, -15070, -14989, -14910, -14829, -14749, -14671, 
-        -14592, -14514, -14436, -14358, -14280, -14204, -14126, -14049, -13973, -13897, -13820, -13745, 
-        -13671, -13596, -13521, -13447, -13373, -13298, -13224, -13153, -13081, -13007, -12934, -12862, 
-        -12790, -12719, -12648, -12578, -12506, -12436, -12366, -12297, -12227, -12158, -12089, -12019, 
-        -11952, -11883, -11817, -11748, -11681, -11614, -11547, -11481, -11414, -11350, -11282, -11217, 
-        -11152, -11087, -11023, -10958, -10894, -10830, -10766, -10702, -10639, -10576, -10514, -10451, 
-        -10388, -10327, -10265, -10203, -10142, -10081, -10020, -9959, -9899, -9840, -9780, -9721, 
-        -9661, -9601, -9543, -9485, -9426, -9368, -9310, -9250, -9193, -9137, -9079, -9022, 
-        -8966, -8909, -8853, -8798, -8741, -8686, -8631, -8575, -8521, -8466, -8413, -8358, 
-        -8304, -8249, -8194, -8142, -8090, -8037, -7985, -7931, -7879, -7827, -7777, -7725, 
-        -7675, -7623, -7571, -7522, -7471, -7423, -7371, -7322, -7271, -7221, -7173, -7125, 
-        -7077, -7027, -6979, -6931, -6883, -6837, -6788, -6743, -6694, -6646, -6600, -6555, 
-        -6510, -6461, -6414, -6367, -6322, -6278, -6234, -6189, -6141, -6098, -6052, -6012, 
-        -5969, -5924, -5878, -5829, -5789, -5745, -5708, -5662, -5613, -5566, -5467, -2486 
-    };
-
-    // AKWF_squ_0024 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0024[600] PROGMEM = {
-        2131, 16197, 28899, 32767, 32204, 31934, 31851, 31693, 31545, 31393, 31248, 31103, 
-        30966, 30823, 30682, 30536, 30393, 30254, 30115, 29981, 29839, 29699, 29559, 29423, 
-        29287, 29152, 29017, 28880, 28745, 28610, 28477, 28346, 28212, 28081, 27946, 27816, 
-        27684, 27556, 27427, 27298, 27170, 27040, 26912, 26787, 26661, 26534, 26407, 26283, 
-        26157, 26034, 25910, 25786, 25663, 25539, 25420, 25297, 25177, 25056, 24936, 24815, 
-        24696, 24579, 24459, 24343, 24224, 24108, 23991, 23874, 23759, 23644, 23529, 23414, 
-        23300, 23186, 23072, 22960, 22848, 22736, 22624, 22513, 22402, 22292, 22182, 22072, 
-        21963, 21853, 21746, 21638, 21530, 21424, 21316, 21210, 21104, 20998, 20894, 20788, 
-        20684, 20579, 20476, 20374, 20271, 20169, 20066, 19964, 19862, 19762, 19662, 19562, 
-        19461, 19361, 19264, 19165, 19066, 18969, 18872, 18775, 18676, 18582, 18486, 18390, 
-        18295, 18199, 18105, 18010, 17918, 17825, 17731, 17638, 17545, 17454, 17363, 17271, 
-        17180, 17090, 16999, 16909, 16821, 16731, 16643, 16555, 16467, 16378, 16290, 16205, 
-        16116, 16031, 15944, 15858, 15772, 15687, 15603, 15518, 15434, 15351, 15267, 15185, 
-        15101, 15018, 14935, 14854, 14772, 14691, 14610, 14528, 14449, 14368, 14288, 14208, 
-        14130, 14051, 13971, 13894, 13814, 13738, 13660, 13584, 13506, 13430, 13354, 13277, 
-        13202, 13128, 13053, 12977, 12902, 12828, 12755, 12682, 12609, 12535, 12462, 12390, 
-        12318, 12248, 12176, 12104, 12033, 11962, 11892, 11823, 11753, 11683, 11614, 11545, 
-        11476, 11409, 11342, 11273, 11205, 11138, 11071, 11005, 10938, 10873, 10806, 10740, 
-        10674, 10610, 10546, 10480, 10416, 10351, 10287, 10224, 10161, 10098, 10034, 9971, 
-        9908, 9847, 9786, 9723, 9662, 9599, 9539, 9478, 9418, 9359, 9298, 9238, 
-        9177, 9119, 9059, 9000, 8942, 8882, 8824, 8764, 8710, 8652, 8595, 8537, 
-        8478, 8423, 8366, 8312, 8255, 8199, 8142, 8083, 8033, 7979, 7926, 7868, 
-        7813, 7759, 7705, 7657, 7603, 7551, 7491, 7439, 7388, 7343, 7289, 7232, 
-        5002, -4561, -19493, -29079, -30512, -29888, -29782, -29650, -29511, -29381, -29254, -29120, 
-        -28989, -28854, -28720, -28594, -28465, -28341, -28208, -28078, -27949, -27822, -27698, -27571, 
-        -27447, -27318, -27192, -27067, -26944, -26823, -26697, -26574, -26450, -26329, -26209, -26088, 
-        -25969, -25847, -25728, -25608, -25491, -25373, -25255, -25138, -25020, -24903, -24788, -24673, 
-        -24559, -24443, -24329, -24214, -24102, -23989, -23877, -23765, -23653, -23542, -23430, -23321, 
-        -23212, -23102, -22992, -22883, -22775, -22667, -22561, -22453, -22345, -22239, -22133, -22028, 
-        -21924, -21819, -21714, -21609, -21506, -21403, -21301, -21198, -21096, -20993, -20891, -20791, 
-        -20691, -20592, -20491, -20392, -20292, -20193, -20096, -19997, -19900, -19802, -19705, -19608, 
-        -19512, -19416, -19321, -19225, -19129, -19035, -18942, -18848, -18755, -18661, -18568, -18476, 
-        -18384, -18292, -18202, -18111, -18019, -17930, -17838, -17750, -17660, -17571, -17482, -17394, 
-        -17306, -17217, -17132, -17045, -16957, -16872, -16785, -16700, -16615, -16531, -16446, -16362, 
-        -16277, -16193, -16110, -16027, -15944, -15862, -15780, -15699, -15617, -15536, -15455, -15375, 
-        -15294, -15214, -15135, -15056, -14977, -14899, -14820, -14742, -14664, -14588, -14510, -14432, 
-        -14356, -14279, -14203, -14128, -14054, -13977, -13903, -13828, -13753, -13680, -13605, -13532, 
-        -13458, -13385, -13313, -13241, -13170, -13096, -13026, -12954, -12882, -12812, -12742, -12671, 
-        -12601, -12532, -12462, -12393, -12324, -12257, -12188, -12119, -12052, -11985, -11917, -11850, 
-        -11784, -11717, -11651, -11585, -11520, -11455, -11389, -11324, -11259, -11195, -11132, -11068, 
-        -11003, -10941, -10876, -10815, -10752, -10691, -10628, -10567, -10504, -10442, -10383, -10321, 
-        -10261, -10200, -10140, -10080, -10021, -9962, -9902, -9844, -9784, -9726, -9668, -9609, 
-        -9552, -9494, -9437, -9379, -9322, -9267, -9210, -9154, -9098, -9042, -8985, -8932, 
-        -8876, -8821, -8767, -8710, -8656, -8603, -8549, -8496, -8442, -8389, -8335, -8282, 
-        -8230, -8178, -8125, -8073, -8021, -7970, -7919, -7868, -7817, -7766, -7714, -7665, 
-        -7614, -7566, -7516, -7466, -7416, -7367, -7319, -7270, -7222, -7174, -7125, -7077, 
-        -7029, -6982, -6936, -6888, -6842, -6794, -6749, -6703, -6658, -6611, -6565, -6519, 
-        -6474, -6430, -6386, -6342, -6294, -6251, -6206, -6163, -6121, -6077, -6034, -5989, 
-        -5946, -5904, -5863, -5825, -5778, -5736, -5691, -5653, -5612, -5570, -5530, -5484, 
-        -5443, -5401, -5367, -5326, -5283, -5240, -5196, -5159, -5123, -5083, -5075, -4559 
-    };
-
-} // namespace AKWF_BwSqu
@@ -1,1304 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwSqu {
-
-    // AKWF_squ_0025 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0025[600] PROGMEM = {
-        6042, 20909, 31036, 32767, 32089, 31952, 31822, 31673, 31530, 31384, 31236, 31088, 
-        30947, 30805, 30667, 30521, 30380, 30235, 30097, 29958, 29820, 29684, 29543, 29406, 
-        29267, 29132, 28998, 28862, 28727, 28590, 28457, 28324, 28192, 28061, 27929, 27798, 
-        27665, 27536, 27406, 27278, 27150, 27021, 26893, 26765, 26640, 26513, 26388, 26262, 
-        26136, 26013, 25888, 25766, 25642, 25520, 25397, 25274, 25155, 25035, 24914, 24794, 
-        24675, 24555, 24436, 24320, 24201, 24085, 23967, 23850, 23735, 23619, 23506, 23390, 
-        23275, 23160, 23047, 22934, 22822, 22711, 22598, 22486, 22376, 22266, 22155, 22045, 
-        21937, 21826, 21718, 21611, 21503, 21396, 21289, 21182, 21075, 20970, 20865, 20761, 
-        20656, 20552, 20448, 20344, 20241, 20140, 20037, 19934, 19833, 19732, 19631, 19532, 
-        19433, 19333, 19233, 19133, 19037, 18938, 18841, 18745, 18646, 18550, 18454, 18359, 
-        18264, 18169, 18075, 17979, 17886, 17792, 17700, 17607, 17515, 17423, 17330, 17240, 
-        17149, 17059, 16969, 16878, 16788, 16699, 16611, 16522, 16434, 16345, 16257, 16171, 
-        16084, 15998, 15910, 15825, 15739, 15654, 15569, 15484, 15401, 15316, 15233, 15149, 
-        15066, 14984, 14901, 14819, 14737, 14655, 14573, 14493, 14412, 14332, 14252, 14171, 
-        14094, 14015, 13936, 13859, 13780, 13701, 13623, 13547, 13471, 13394, 13317, 13241, 
-        13166, 13090, 13016, 12941, 12866, 12793, 12718, 12645, 12572, 12499, 12426, 12353, 
-        12282, 12210, 12139, 12068, 11998, 11926, 11855, 11786, 11716, 11648, 11578, 11509, 
-        11439, 11371, 11304, 11235, 11168, 11100, 11033, 10967, 10900, 10835, 10769, 10704, 
-        10637, 10571, 10507, 10442, 10379, 10312, 10248, 10184, 10122, 10059, 9995, 9933, 
-        9869, 9808, 9745, 9684, 9623, 9560, 9499, 9437, 9377, 9318, 9257, 9197, 
-        9136, 9078, 9017, 8960, 8902, 8843, 8783, 8724, 8667, 8609, 8554, 8497, 
-        8439, 8380, 8322, 8270, 8215, 8161, 8101, 8045, 7990, 7935, 7886, 7830, 
-        7778, 7716, 7662, 7610, 7565, 7510, 7452, 5231, -4287, -19150, -28691, -30119, 
-        -29500, -29394, -29264, -29127, -28999, -28874, -28743, -28612, -28481, -28349, -28225, -28097, 
-        -27975, -27843, -27716, -27588, -27464, -27342, -27216, -27094, -26966, -26844, -26720, -26599, 
-        -26479, -26355, -26235, -26113, -25992, -25873, -25755, -25638, -25517, -25400, -25282, -25166, 
-        -25050, -24934, -24819, -24701, -24588, -24472, -24360, -24247, -24134, -24021, -23908, -23798, 
-        -23686, -23576, -23466, -23354, -23245, -23135, -23028, -22919, -22812, -22703, -22595, -22489, 
-        -22383, -22278, -22172, -22066, -21962, -21856, -21754, -21649, -21547, -21444, -21340, -21238, 
-        -21137, -21037, -20936, -20835, -20734, -20634, -20534, -20436, -20338, -20238, -20140, -20041, 
-        -19945, -19848, -19751, -19656, -19559, -19464, -19367, -19273, -19179, -19084, -18990, -18897, 
-        -18804, -18710, -18618, -18527, -18435, -18344, -18252, -18161, -18072, -17981, -17892, -17802, 
-        -17713, -17624, -17536, -17448, -17360, -17272, -17186, -17100, -17012, -16927, -16842, -16756, 
-        -16671, -16586, -16501, -16418, -16334, -16251, -16168, -16084, -16002, -15920, -15839, -15757, 
-        -15675, -15594, -15514, -15434, -15355, -15274, -15195, -15115, -15036, -14959, -14881, -14804, 
-        -14725, -14648, -14572, -14494, -14418, -14342, -14266, -14191, -14115, -14040, -13966, -13891, 
-        -13817, -13744, -13669, -13597, -13524, -13451, -13379, -13306, -13233, -13162, -13092, -13020, 
-        -12949, -12879, -12807, -12739, -12669, -12599, -12531, -12461, -12394, -12324, -12257, -12188, 
-        -12121, -12054, -11986, -11919, -11853, -11788, -11721, -11655, -11590, -11524, -11460, -11395, 
-        -11331, -11267, -11201, -11139, -11075, -11012, -10949, -10885, -10823, -10760, -10699, -10638, 
-        -10577, -10516, -10455, -10394, -10333, -10274, -10213, -10154, -10093, -10034, -9976, -9916, 
-        -9858, -9800, -9742, -9684, -9626, -9568, -9511, -9455, -9397, -9340, -9284, -9228, 
-        -9173, -9117, -9062, -9005, -8950, -8895, -8841, -8788, -8734, -8679, -8624, -8572, 
-        -8518, -8465, -8413, -8359, -8307, -8253, -8203, -8151, -8100, -8048, -7996, -7945, 
-        -7893, -7844, -7793, -7743, -7694, -7643, -7594, -7543, -7495, -7446, -7397, -7348, 
-        -7299, -7251, -7204, -7158, -7108, -7061, -7013, -6965, -6921, -6873, -6827, -6781, 
-        -6735, -6690, -6644, -6599, -6555, -6508, -6464, -6419, -6376, -6331, -6288, -6242, 
-        -6199, -6154, -6112, -6071, -6026, -5984, -5940, -5898, -5856, -5816, -5776, -5731, 
-        -5690, -5646, -5608, -5568, -5526, -5486, -5441, -5402, -5361, -5323, -5285, -5241, 
-        -5201, -5158, -5122, -5081, -5046, -5005, -4962, -4917, -4878, -4838, -4851, -3513 
-    };
-
-    // AKWF_squ_0026 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0026[600] PROGMEM = {
-        7596, 22241, 31470, 32767, 32150, 32039, 31893, 31741, 31597, 31457, 31313, 31169, 
-        31022, 30874, 30734, 30592, 30455, 30311, 30170, 30028, 29886, 29750, 29612, 29475, 
-        29334, 29196, 29059, 28924, 28791, 28654, 28520, 28384, 28250, 28116, 27984, 27853, 
-        27719, 27589, 27457, 27327, 27198, 27069, 26941, 26810, 26682, 26554, 26430, 26303, 
-        26177, 26051, 25924, 25801, 25677, 25554, 25431, 25307, 25185, 25062, 24943, 24822, 
-        24702, 24581, 24462, 24343, 24224, 24108, 23989, 23873, 23756, 23638, 23524, 23408, 
-        23294, 23178, 23065, 22951, 22837, 22724, 22613, 22501, 22388, 22276, 22166, 22056, 
-        21947, 21837, 21728, 21618, 21511, 21402, 21295, 21189, 21080, 20975, 20867, 20763, 
-        20659, 20553, 20449, 20344, 20242, 20137, 20034, 19933, 19830, 19729, 19627, 19526, 
-        19426, 19326, 19226, 19126, 19028, 18928, 18831, 18733, 18636, 18539, 18440, 18345, 
-        18249, 18154, 18058, 17964, 17869, 17773, 17681, 17587, 17494, 17402, 17309, 17217, 
-        17125, 17034, 16945, 16854, 16763, 16671, 16583, 16494, 16406, 16317, 16229, 16141, 
-        16054, 15968, 15881, 15794, 15708, 15622, 15536, 15452, 15367, 15283, 15199, 15114, 
-        15030, 14948, 14864, 14784, 14700, 14619, 14535, 14455, 14375, 14294, 14215, 14133, 
-        14053, 13974, 13895, 13817, 13739, 13660, 13582, 13504, 13426, 13350, 13273, 13197, 
-        13121, 13044, 12969, 12894, 12819, 12744, 12669, 12595, 12521, 12449, 12376, 12302, 
-        12230, 12157, 12086, 12013, 11944, 11872, 11800, 11729, 11659, 11590, 11521, 11452, 
-        11381, 11311, 11243, 11175, 11108, 11040, 10973, 10905, 10837, 10771, 10705, 10642, 
-        10574, 10508, 10442, 10378, 10314, 10250, 10187, 10121, 10057, 9993, 9931, 9869, 
-        9806, 9744, 9680, 9618, 9558, 9498, 9437, 9374, 9312, 9251, 9192, 9133, 
-        9074, 9016, 8951, 8894, 8834, 8779, 8722, 8662, 8601, 8540, 8485, 8428, 
-        8377, 8316, 8253, 8190, 8081, 5228, -5296, -19899, -28060, -28808, -28263, -28206, 
-        -28087, -27968, -27840, -27714, -27586, -27467, -27348, -27226, -27105, -26979, -26860, -26737, 
-        -26621, -26502, -26383, -26262, -26140, -26026, -25908, -25792, -25674, -25558, -25441, -25325, 
-        -25212, -25097, -24984, -24868, -24753, -24640, -24527, -24417, -24305, -24194, -24082, -23970, 
-        -23860, -23750, -23641, -23531, -23421, -23312, -23205, -23098, -22990, -22885, -22776, -22670, 
-        -22564, -22460, -22356, -22250, -22146, -22041, -21938, -21836, -21733, -21631, -21528, -21427, 
-        -21324, -21224, -21124, -21025, -20925, -20825, -20726, -20628, -20529, -20432, -20336, -20239, 
-        -20140, -20045, -19948, -19854, -19758, -19663, -19569, -19473, -19381, -19287, -19194, -19101, 
-        -19009, -18916, -18825, -18734, -18643, -18552, -18461, -18371, -18282, -18192, -18104, -18014, 
-        -17926, -17838, -17750, -17665, -17576, -17490, -17403, -17316, -17231, -17146, -17062, -16977, 
-        -16893, -16808, -16724, -16641, -16558, -16476, -16392, -16310, -16226, -16145, -16065, -15982, 
-        -15903, -15822, -15741, -15662, -15583, -15503, -15424, -15346, -15267, -15189, -15111, -15033, 
-        -14957, -14879, -14803, -14725, -14650, -14575, -14499, -14424, -14349, -14274, -14200, -14127, 
-        -14053, -13978, -13905, -13832, -13760, -13688, -13617, -13544, -13472, -13401, -13331, -13260, 
-        -13190, -13119, -13049, -12979, -12910, -12841, -12774, -12705, -12637, -12568, -12501, -12434, 
-        -12367, -12301, -12233, -12167, -12101, -12035, -11969, -11904, -11839, -11773, -11709, -11645, 
-        -11581, -11516, -11453, -11390, -11327, -11264, -11200, -11139, -11077, -11014, -10952, -10890, 
-        -10830, -10770, -10708, -10648, -10586, -10527, -10467, -10407, -10348, -10288, -10229, -10170, 
-        -10113, -10054, -9996, -9938, -9881, -9824, -9765, -9709, -9653, -9596, -9540, -9484, 
-        -9429, -9373, -9318, -9263, -9208, -9152, -9098, -9045, -8991, -8938, -8883, -8829, 
-        -8776, -8723, -8672, -8619, -8568, -8515, -8462, -8412, -8360, -8309, -8258, -8206, 
-        -8156, -8106, -8056, -8006, -7956, -7906, -7858, -7808, -7760, -7711, -7663, -7614, 
-        -7564, -7517, -7470, -7422, -7375, -7326, -7279, -7232, -7187, -7140, -7093, -7047, 
-        -7000, -6954, -6909, -6863, -6819, -6772, -6728, -6683, -6639, -6595, -6550, -6506, 
-        -6462, -6418, -6374, -6332, -6289, -6246, -6202, -6158, -6117, -6074, -6033, -5991, 
-        -5950, -5907, -5864, -5825, -5785, -5744, -5703, -5663, -5623, -5582, -5544, -5504, 
-        -5465, -5424, -5384, -5346, -5308, -5269, -5230, -5191, -5153, -5115, -5078, -5040, 
-        -5005, -4965, -4929, -4890, -4855, -4820, -4783, -4748, -4708, -4671, -4636, -4604, 
-        -4572, -4532, -4497, -4457, -4428, -4395, -4366, -4331, -4294, -4250, -4279, -2741 
-    };
-
-    // AKWF_squ_0027 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0027[600] PROGMEM = {
-        7026, 21439, 31150, 32767, 32113, 31974, 31839, 31688, 31547, 31402, 31249, 31101, 
-        30956, 30813, 30674, 30527, 30385, 30240, 30099, 29959, 29819, 29682, 29539, 29400, 
-        29260, 29124, 28989, 28851, 28716, 28578, 28444, 28308, 28175, 28042, 27910, 27777, 
-        27642, 27512, 27381, 27252, 27122, 26992, 26862, 26732, 26607, 26479, 26352, 26225, 
-        26098, 25974, 25848, 25725, 25600, 25475, 25353, 25228, 25107, 24986, 24866, 24743, 
-        24623, 24502, 24382, 24265, 24145, 24028, 23910, 23791, 23674, 23557, 23443, 23326, 
-        23212, 23096, 22981, 22868, 22754, 22641, 22527, 22414, 22302, 22192, 22081, 21970, 
-        21860, 21749, 21640, 21530, 21422, 21315, 21205, 21098, 20990, 20885, 20778, 20672, 
-        20568, 20461, 20357, 20252, 20149, 20045, 19943, 19840, 19738, 19635, 19534, 19434, 
-        19333, 19232, 19132, 19033, 18933, 18835, 18737, 18638, 18540, 18443, 18345, 18251, 
-        18155, 18059, 17964, 17867, 17773, 17679, 17585, 17491, 17399, 17307, 17214, 17123, 
-        17031, 16940, 16847, 16756, 16667, 16577, 16488, 16398, 16310, 16220, 16131, 16044, 
-        15956, 15871, 15783, 15696, 15609, 15523, 15437, 15352, 15268, 15183, 15098, 15014, 
-        14930, 14848, 14764, 14682, 14598, 14516, 14435, 14354, 14273, 14191, 14111, 14030, 
-        13951, 13871, 13792, 13714, 13633, 13555, 13477, 13401, 13323, 13246, 13168, 13091, 
-        13016, 12940, 12865, 12789, 12714, 12639, 12564, 12492, 12418, 12345, 12269, 12196, 
-        12125, 12053, 11982, 11910, 11839, 11767, 11695, 11625, 11556, 11487, 11416, 11346, 
-        11277, 11208, 11141, 11072, 11005, 10936, 10868, 10802, 10735, 10670, 10602, 10537, 
-        10470, 10403, 10340, 10276, 10212, 10145, 10080, 10015, 9952, 9890, 9827, 9765, 
-        9698, 9636, 9572, 9515, 9454, 9390, 9327, 9260, 9204, 9142, 9087, 9025, 
-        8959, 8892, 8781, 5971, -4381, -18744, -26773, -27512, -26979, -26929, -26816, -26702, 
-        -26581, -26461, -26339, -26227, -26114, -25998, -25883, -25763, -25649, -25533, -25422, -25309, 
-        -25195, -25081, -24966, -24856, -24745, -24635, -24523, -24412, -24301, -24191, -24083, -23975, 
-        -23866, -23756, -23648, -23541, -23433, -23329, -23222, -23117, -23010, -22903, -22799, -22695, 
-        -22592, -22487, -22384, -22280, -22178, -22075, -21974, -21873, -21770, -21669, -21568, -21468, 
-        -21369, -21269, -21169, -21070, -20971, -20873, -20776, -20680, -20581, -20486, -20389, -20294, 
-        -20199, -20103, -20009, -19914, -19820, -19726, -19634, -19540, -19447, -19355, -19262, -19171, 
-        -19079, -18989, -18898, -18809, -18718, -18628, -18540, -18452, -18364, -18274, -18186, -18098, 
-        -18012, -17925, -17838, -17753, -17666, -17580, -17496, -17411, -17327, -17242, -17158, -17074, 
-        -16990, -16908, -16826, -16743, -16661, -16579, -16498, -16415, -16336, -16255, -16174, -16093, 
-        -16014, -15934, -15856, -15778, -15697, -15619, -15541, -15463, -15387, -15309, -15232, -15156, 
-        -15079, -15004, -14927, -14852, -14777, -14703, -14628, -14555, -14480, -14406, -14334, -14260, 
-        -14186, -14113, -14042, -13970, -13897, -13827, -13754, -13684, -13613, -13544, -13473, -13403, 
-        -13334, -13263, -13195, -13126, -13058, -12990, -12921, -12854, -12787, -12719, -12652, -12586, 
-        -12518, -12451, -12386, -12321, -12256, -12190, -12125, -12061, -11996, -11933, -11869, -11806, 
-        -11742, -11679, -11615, -11553, -11491, -11429, -11367, -11304, -11242, -11182, -11121, -11060, 
-        -11000, -10939, -10878, -10819, -10760, -10701, -10641, -10581, -10523, -10464, -10406, -10348, 
-        -10290, -10233, -10175, -10119, -10061, -10004, -9948, -9892, -9835, -9779, -9724, -9668, 
-        -9613, -9558, -9503, -9448, -9393, -9340, -9286, -9233, -9180, -9126, -9073, -9021, 
-        -8967, -8915, -8863, -8810, -8758, -8707, -8657, -8605, -8554, -8502, -8452, -8402, 
-        -8352, -8303, -8252, -8203, -8152, -8103, -8054, -8007, -7957, -7910, -7862, -7813, 
-        -7767, -7719, -7671, -7624, -7576, -7530, -7482, -7437, -7390, -7344, -7297, -7251, 
-        -7206, -7162, -7117, -7071, -7026, -6981, -6938, -6893, -6848, -6805, -6760, -6717, 
-        -6673, -6630, -6588, -6543, -6501, -6458, -6416, -6374, -6332, -6289, -6247, -6205, 
-        -6165, -6124, -6082, -6042, -6000, -5960, -5919, -5879, -5838, -5799, -5759, -5720, 
-        -5679, -5642, -5603, -5564, -5525, -5486, -5448, -5409, -5373, -5334, -5297, -5259, 
-        -5220, -5184, -5148, -5112, -5074, -5038, -5001, -4964, -4930, -4892, -4857, -4821, 
-        -4785, -4749, -4714, -4681, -4645, -4612, -4574, -4540, -4506, -4473, -4441, -4405, 
-        -4371, -4335, -4303, -4271, -4238, -4206, -4170, -4137, -4103, -4075, -4043, -4008, 
-        -3975, -3939, -3910, -3877, -3849, -3816, -3781, -3745, -3713, -3679, -3699, -2376 
-    };
-
-    // AKWF_squ_0028 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0028[600] PROGMEM = {
-        4891, 18623, 29854, 32767, 32193, 31984, 31869, 31715, 31576, 31434, 31290, 31143, 
-        30997, 30850, 30710, 30568, 30428, 30284, 30140, 30000, 29857, 29722, 29581, 29444, 
-        29302, 29163, 29026, 28889, 28755, 28616, 28481, 28344, 28208, 28077, 27943, 27810, 
-        27676, 27543, 27411, 27280, 27151, 27020, 26890, 26759, 26630, 26502, 26374, 26247, 
-        26118, 25993, 25866, 25740, 25615, 25491, 25367, 25242, 25120, 24996, 24874, 24753, 
-        24630, 24509, 24388, 24270, 24148, 24031, 23913, 23793, 23676, 23556, 23441, 23325, 
-        23210, 23094, 22977, 22863, 22749, 22636, 22523, 22409, 22297, 22184, 22073, 21961, 
-        21851, 21742, 21630, 21521, 21412, 21304, 21195, 21088, 20980, 20873, 20766, 20660, 
-        20555, 20449, 20344, 20238, 20134, 20030, 19927, 19824, 19720, 19619, 19516, 19415, 
-        19315, 19214, 19114, 19013, 18913, 18813, 18714, 18616, 18516, 18419, 18321, 18225, 
-        18128, 18031, 17936, 17839, 17744, 17649, 17555, 17461, 17368, 17274, 17180, 17087, 
-        16994, 16904, 16813, 16720, 16629, 16538, 16449, 16359, 16269, 16181, 16091, 16003, 
-        15914, 15827, 15740, 15653, 15566, 15479, 15393, 15308, 15224, 15138, 15054, 14968, 
-        14884, 14801, 14717, 14636, 14552, 14469, 14388, 14305, 14225, 14144, 14064, 13983, 
-        13901, 13823, 13743, 13664, 13586, 13508, 13428, 13349, 13272, 13195, 13120, 13041, 
-        12964, 12887, 12811, 12737, 12660, 12586, 12509, 12436, 12362, 12289, 12215, 12141, 
-        12068, 11994, 11923, 11850, 11779, 11707, 11634, 11563, 11490, 11422, 11352, 11282, 
-        11212, 11141, 11072, 11003, 10937, 10868, 10799, 10729, 10659, 10596, 10530, 10465, 
-        10395, 10328, 10262, 10197, 10135, 10070, 10005, 9934, 9868, 9807, 9751, 9686, 
-        9617, 7478, -1657, -15910, -25066, -26446, -25866, -25777, -25665, -25546, -25435, -25327, 
-        -25214, -25101, -24987, -24872, -24765, -24655, -24549, -24435, -24324, -24214, -24107, -24000, 
-        -23891, -23786, -23676, -23570, -23464, -23359, -23255, -23148, -23044, -22939, -22834, -22732, 
-        -22629, -22528, -22424, -22322, -22220, -22120, -22020, -21919, -21819, -21717, -21619, -21519, 
-        -21422, -21325, -21227, -21128, -21031, -20936, -20839, -20743, -20647, -20552, -20458, -20362, 
-        -20269, -20175, -20081, -19988, -19894, -19803, -19710, -19620, -19528, -19438, -19346, -19255, 
-        -19165, -19075, -18986, -18896, -18807, -18719, -18630, -18543, -18456, -18369, -18281, -18195, 
-        -18108, -18023, -17937, -17851, -17767, -17682, -17598, -17515, -17431, -17348, -17264, -17181, 
-        -17098, -17017, -16936, -16853, -16772, -16690, -16610, -16529, -16449, -16369, -16289, -16211, 
-        -16131, -16053, -15974, -15897, -15819, -15742, -15665, -15587, -15510, -15435, -15358, -15282, 
-        -15207, -15132, -15057, -14983, -14908, -14834, -14760, -14687, -14615, -14542, -14469, -14396, 
-        -14325, -14252, -14181, -14110, -14040, -13968, -13897, -13827, -13759, -13689, -13620, -13550, 
-        -13482, -13412, -13344, -13276, -13208, -13141, -13074, -13007, -12940, -12873, -12807, -12742, 
-        -12676, -12610, -12545, -12479, -12415, -12351, -12286, -12222, -12158, -12094, -12031, -11967, 
-        -11906, -11841, -11780, -11717, -11656, -11595, -11533, -11472, -11411, -11351, -11289, -11229, 
-        -11169, -11110, -11050, -10990, -10931, -10873, -10814, -10754, -10696, -10639, -10580, -10523, 
-        -10466, -10408, -10352, -10295, -10239, -10182, -10128, -10071, -10015, -9960, -9904, -9850, 
-        -9796, -9740, -9686, -9632, -9579, -9525, -9472, -9419, -9365, -9312, -9259, -9208, 
-        -9155, -9104, -9052, -9000, -8950, -8898, -8847, -8796, -8746, -8696, -8644, -8595, 
-        -8546, -8496, -8446, -8398, -8348, -8299, -8251, -8204, -8155, -8107, -8058, -8010, 
-        -7964, -7917, -7868, -7823, -7774, -7729, -7682, -7636, -7590, -7543, -7497, -7452, 
-        -7408, -7362, -7318, -7272, -7228, -7182, -7138, -7095, -7051, -7008, -6964, -6920, 
-        -6877, -6834, -6791, -6750, -6707, -6664, -6622, -6580, -6539, -6497, -6456, -6413, 
-        -6373, -6332, -6292, -6251, -6211, -6169, -6129, -6089, -6050, -6011, -5971, -5933, 
-        -5893, -5854, -5816, -5777, -5739, -5700, -5662, -5623, -5586, -5549, -5510, -5473, 
-        -5436, -5399, -5362, -5326, -5291, -5254, -5218, -5181, -5145, -5109, -5072, -5038, 
-        -5001, -4965, -4931, -4897, -4861, -4826, -4791, -4756, -4721, -4687, -4653, -4620, 
-        -4584, -4552, -4517, -4485, -4452, -4419, -4385, -4352, -4319, -4285, -4255, -4222, 
-        -4189, -4156, -4124, -4094, -4062, -4032, -4000, -3968, -3937, -3904, -3877, -3845, 
-        -3816, -3783, -3751, -3723, -3693, -3666, -3634, -3606, -3574, -3544, -3517, -3490, 
-        -3465, -3432, -3403, -3373, -3349, -3325, -3301, -3273, -3241, -3205, -3236, -2549 
-    };
-
-    // AKWF_squ_0029 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0029[600] PROGMEM = {
-        1048, 12190, 25909, 32544, 32767, 32284, 32187, 32014, 31864, 31714, 31572, 31420, 
-        31273, 31122, 30974, 30829, 30685, 30544, 30396, 30251, 30104, 29963, 29823, 29680, 
-        29542, 29398, 29258, 29118, 28981, 28843, 28705, 28568, 28429, 28294, 28156, 28024, 
-        27889, 27754, 27621, 27485, 27355, 27222, 27092, 26961, 26828, 26699, 26568, 26440, 
-        26312, 26183, 26054, 25926, 25801, 25676, 25551, 25425, 25300, 25175, 25051, 24929, 
-        24805, 24683, 24560, 24439, 24317, 24197, 24078, 23957, 23838, 23718, 23599, 23482, 
-        23364, 23249, 23131, 23014, 22898, 22782, 22668, 22553, 22440, 22324, 22211, 22098, 
-        21986, 21875, 21763, 21651, 21540, 21429, 21319, 21210, 21101, 20991, 20884, 20775, 
-        20669, 20561, 20455, 20349, 20242, 20136, 20030, 19927, 19823, 19719, 19616, 19511, 
-        19409, 19307, 19206, 19104, 19004, 18902, 18801, 18702, 18604, 18505, 18406, 18305, 
-        18209, 18112, 18015, 17918, 17822, 17724, 17628, 17535, 17439, 17345, 17251, 17156, 
-        17063, 16969, 16878, 16786, 16694, 16602, 16510, 16420, 16329, 16239, 16148, 16059, 
-        15969, 15880, 15792, 15704, 15618, 15529, 15441, 15354, 15267, 15183, 15096, 15010, 
-        14924, 14839, 14754, 14671, 14588, 14503, 14419, 14335, 14254, 14172, 14090, 14008, 
-        13926, 13845, 13763, 13684, 13604, 13525, 13444, 13363, 13286, 13207, 13130, 13052, 
-        12973, 12896, 12816, 12743, 12667, 12592, 12514, 12438, 12363, 12286, 12216, 12141, 
-        12069, 11991, 11917, 11847, 11775, 11705, 11630, 11560, 11486, 11416, 11348, 11278, 
-        11212, 11137, 11068, 10997, 10933, 10892, 10659, 7007, -4277, -18007, -24567, -24788, 
-        -24357, -24310, -24183, -24074, -23965, -23865, -23759, -23656, -23545, -23439, -23336, -23233, 
-        -23134, -23028, -22925, -22820, -22718, -22618, -22518, -22419, -22317, -22217, -22116, -22019, 
-        -21921, -21822, -21725, -21626, -21530, -21431, -21336, -21241, -21144, -21049, -20953, -20860, 
-        -20765, -20672, -20578, -20484, -20390, -20297, -20207, -20115, -20024, -19932, -19840, -19750, 
-        -19661, -19572, -19481, -19392, -19303, -19214, -19127, -19039, -18953, -18865, -18777, -18691, 
-        -18604, -18519, -18432, -18348, -18263, -18178, -18093, -18008, -17925, -17842, -17758, -17675, 
-        -17593, -17511, -17429, -17348, -17266, -17184, -17104, -17023, -16943, -16862, -16783, -16704, 
-        -16625, -16545, -16466, -16388, -16309, -16232, -16154, -16077, -16001, -15925, -15848, -15772, 
-        -15696, -15621, -15546, -15471, -15396, -15323, -15248, -15174, -15101, -15029, -14955, -14883, 
-        -14811, -14737, -14667, -14595, -14524, -14453, -14383, -14312, -14241, -14172, -14103, -14033, 
-        -13964, -13895, -13827, -13758, -13691, -13622, -13556, -13488, -13420, -13355, -13287, -13222, 
-        -13156, -13089, -13024, -12959, -12894, -12829, -12764, -12699, -12635, -12572, -12508, -12445, 
-        -12381, -12319, -12255, -12193, -12132, -12070, -12008, -11946, -11885, -11824, -11763, -11702, 
-        -11643, -11582, -11522, -11462, -11403, -11343, -11284, -11226, -11167, -11109, -11051, -10993, 
-        -10935, -10878, -10820, -10764, -10706, -10651, -10594, -10538, -10483, -10426, -10371, -10316, 
-        -10261, -10205, -10152, -10097, -10043, -9989, -9935, -9882, -9828, -9774, -9722, -9670, 
-        -9617, -9565, -9513, -9461, -9408, -9357, -9306, -9256, -9205, -9154, -9103, -9053, 
-        -9003, -8953, -8904, -8854, -8805, -8755, -8706, -8658, -8608, -8560, -8512, -8464, 
-        -8416, -8368, -8321, -8273, -8226, -8180, -8133, -8087, -8040, -7993, -7948, -7903, 
-        -7856, -7811, -7766, -7720, -7675, -7630, -7585, -7541, -7497, -7453, -7408, -7364, 
-        -7320, -7278, -7234, -7192, -7149, -7106, -7063, -7021, -6980, -6937, -6895, -6854, 
-        -6812, -6771, -6730, -6689, -6648, -6607, -6567, -6526, -6486, -6445, -6406, -6366, 
-        -6327, -6287, -6247, -6209, -6170, -6132, -6093, -6054, -6017, -5979, -5941, -5903, 
-        -5864, -5828, -5789, -5753, -5716, -5679, -5641, -5604, -5569, -5532, -5497, -5460, 
-        -5425, -5388, -5353, -5317, -5282, -5247, -5211, -5177, -5142, -5108, -5074, -5040, 
-        -5005, -4971, -4937, -4903, -4871, -4837, -4803, -4769, -4735, -4704, -4670, -4637, 
-        -4605, -4571, -4540, -4507, -4476, -4444, -4411, -4380, -4348, -4318, -4285, -4256, 
-        -4225, -4194, -4162, -4131, -4102, -4071, -4041, -4010, -3980, -3950, -3921, -3892, 
-        -3863, -3833, -3803, -3774, -3745, -3717, -3690, -3661, -3632, -3603, -3576, -3549, 
-        -3521, -3494, -3464, -3436, -3409, -3382, -3357, -3328, -3302, -3273, -3248, -3221, 
-        -3196, -3170, -3140, -3115, -3087, -3064, -3039, -3012, -2986, -2957, -2934, -2907, 
-        -2885, -2861, -2832, -2805, -2777, -2757, -2731, -2709, -2680, -2649, -2617, -2545 
-    };
-
-    // AKWF_squ_0030 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0030[600] PROGMEM = {
-        902, 11397, 25158, 32336, 32767, 32232, 32139, 31983, 31837, 31687, 31540, 31385, 
-        31237, 31088, 30944, 30800, 30653, 30509, 30359, 30217, 30073, 29932, 29792, 29648, 
-        29506, 29363, 29226, 29086, 28948, 28810, 28668, 28531, 28393, 28259, 28123, 27988, 
-        27851, 27715, 27584, 27450, 27318, 27186, 27053, 26921, 26789, 26660, 26530, 26401, 
-        26271, 26142, 26014, 25886, 25760, 25633, 25507, 25380, 25254, 25130, 25005, 24884, 
-        24758, 24635, 24512, 24389, 24269, 24147, 24027, 23905, 23785, 23665, 23548, 23429, 
-        23310, 23193, 23074, 22958, 22840, 22726, 22611, 22495, 22381, 22265, 22153, 22040, 
-        21926, 21815, 21700, 21590, 21478, 21367, 21258, 21148, 21037, 20927, 20819, 20712, 
-        20604, 20497, 20389, 20283, 20175, 20072, 19966, 19861, 19756, 19651, 19548, 19444, 
-        19344, 19240, 19138, 19036, 18934, 18835, 18734, 18635, 18534, 18434, 18335, 18235, 
-        18139, 18041, 17945, 17847, 17749, 17653, 17557, 17462, 17366, 17272, 17177, 17082, 
-        16990, 16896, 16804, 16711, 16617, 16525, 16434, 16343, 16252, 16161, 16069, 15980, 
-        15890, 15801, 15713, 15623, 15535, 15446, 15359, 15272, 15186, 15099, 15011, 14926, 
-        14839, 14755, 14671, 14586, 14501, 14416, 14333, 14249, 14168, 14086, 14002, 13920, 
-        13836, 13757, 13676, 13598, 13516, 13435, 13355, 13275, 13200, 13120, 13043, 12962, 
-        12883, 12808, 12732, 12659, 12579, 12505, 12426, 12350, 12279, 12206, 12135, 12055, 
-        11982, 11907, 11839, 11794, 11558, 7942, -3220, -16799, -23289, -23513, -23092, -23050, 
-        -22930, -22826, -22724, -22629, -22529, -22431, -22327, -22227, -22129, -22033, -21939, -21838, 
-        -21742, -21643, -21548, -21453, -21358, -21264, -21167, -21074, -20977, -20887, -20794, -20701, 
-        -20608, -20515, -20424, -20332, -20242, -20151, -20061, -19970, -19879, -19791, -19701, -19615, 
-        -19527, -19437, -19349, -19261, -19176, -19089, -19003, -18916, -18829, -18745, -18660, -18576, 
-        -18491, -18406, -18322, -18238, -18156, -18073, -17992, -17908, -17826, -17745, -17662, -17583, 
-        -17502, -17421, -17339, -17260, -17180, -17100, -17022, -16943, -16864, -16786, -16708, -16631, 
-        -16553, -16476, -16399, -16322, -16245, -16170, -16094, -16019, -15943, -15868, -15794, -15718, 
-        -15646, -15572, -15497, -15423, -15351, -15278, -15205, -15134, -15061, -14989, -14917, -14846, 
-        -14776, -14705, -14634, -14564, -14493, -14424, -14354, -14286, -14217, -14149, -14080, -14012, 
-        -13945, -13876, -13811, -13742, -13675, -13609, -13542, -13478, -13412, -13347, -13281, -13215, 
-        -13151, -13087, -13022, -12958, -12894, -12831, -12767, -12705, -12642, -12579, -12516, -12455, 
-        -12392, -12330, -12270, -12209, -12147, -12086, -12026, -11966, -11906, -11846, -11785, -11727, 
-        -11667, -11608, -11549, -11491, -11433, -11375, -11316, -11259, -11201, -11145, -11088, -11031, 
-        -10973, -10918, -10860, -10804, -10750, -10694, -10638, -10583, -10529, -10474, -10420, -10365, 
-        -10311, -10256, -10203, -10150, -10097, -10044, -9991, -9938, -9886, -9833, -9781, -9730, 
-        -9678, -9628, -9576, -9524, -9474, -9423, -9373, -9321, -9273, -9224, -9173, -9124, 
-        -9074, -9025, -8976, -8927, -8878, -8831, -8783, -8734, -8687, -8639, -8593, -8546, 
-        -8498, -8452, -8405, -8359, -8312, -8266, -8220, -8174, -8128, -8083, -8038, -7992, 
-        -7948, -7903, -7858, -7815, -7770, -7727, -7682, -7639, -7595, -7552, -7509, -7465, 
-        -7424, -7380, -7337, -7295, -7253, -7211, -7169, -7127, -7085, -7043, -7003, -6962, 
-        -6922, -6881, -6839, -6799, -6760, -6719, -6680, -6639, -6600, -6560, -6521, -6482, 
-        -6442, -6405, -6366, -6326, -6289, -6251, -6213, -6175, -6138, -6100, -6062, -6025, 
-        -5988, -5950, -5914, -5878, -5841, -5805, -5769, -5732, -5697, -5661, -5625, -5590, 
-        -5555, -5520, -5484, -5450, -5414, -5379, -5345, -5310, -5277, -5242, -5208, -5173, 
-        -5140, -5106, -5074, -5041, -5007, -4974, -4941, -4909, -4877, -4845, -4811, -4779, 
-        -4747, -4715, -4684, -4652, -4620, -4589, -4557, -4526, -4496, -4463, -4433, -4402, 
-        -4371, -4340, -4311, -4280, -4251, -4220, -4189, -4160, -4131, -4103, -4073, -4043, 
-        -4013, -3984, -3956, -3927, -3899, -3869, -3841, -3814, -3786, -3759, -3731, -3703, 
-        -3675, -3647, -3619, -3593, -3566, -3538, -3512, -3485, -3459, -3432, -3405, -3380, 
-        -3352, -3326, -3301, -3274, -3250, -3224, -3199, -3172, -3147, -3122, -3097, -3073, 
-        -3046, -3021, -2996, -2972, -2948, -2923, -2898, -2873, -2849, -2824, -2802, -2778, 
-        -2753, -2729, -2704, -2681, -2658, -2635, -2612, -2586, -2563, -2538, -2519, -2496, 
-        -2473, -2448, -2422, -2401, -2377, -2360, -2335, -2308, -2273, -2247, -2230, -2192 
-    };
-
-    // AKWF_squ_0031 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0031[600] PROGMEM = {
-        1763, 12780, 26200, 32594, 32767, 32297, 32202, 32031, 31877, 31726, 31580, 31429, 
-        31282, 31128, 30979, 30832, 30686, 30543, 30395, 30249, 30101, 29958, 29815, 29672, 
-        29532, 29387, 29246, 29104, 28965, 28826, 28686, 28549, 28407, 28270, 28133, 27998, 
-        27862, 27727, 27592, 27455, 27323, 27189, 27057, 26925, 26792, 26660, 26528, 26399, 
-        26270, 26142, 26011, 25882, 25755, 25627, 25501, 25375, 25248, 25122, 24996, 24873, 
-        24749, 24626, 24502, 24379, 24257, 24135, 24014, 23894, 23773, 23652, 23532, 23414, 
-        23294, 23178, 23059, 22942, 22824, 22708, 22593, 22476, 22363, 22246, 22132, 22017, 
-        21905, 21793, 21679, 21567, 21454, 21343, 21232, 21121, 21013, 20902, 20793, 20683, 
-        20575, 20467, 20360, 20253, 20145, 20038, 19932, 19826, 19722, 19617, 19513, 19407, 
-        19305, 19201, 19099, 18997, 18894, 18793, 18690, 18592, 18492, 18392, 18291, 18191, 
-        18093, 17994, 17897, 17800, 17703, 17605, 17507, 17413, 17317, 17223, 17128, 17033, 
-        16938, 16843, 16752, 16659, 16567, 16473, 16381, 16290, 16198, 16108, 16018, 15928, 
-        15836, 15746, 15658, 15570, 15483, 15393, 15304, 15215, 15129, 15043, 14957, 14871, 
-        14782, 14698, 14612, 14529, 14445, 14360, 14276, 14189, 14107, 14024, 13943, 13862, 
-        13777, 13694, 13609, 13533, 13451, 13372, 13290, 13206, 13123, 13042, 12970, 12892, 
-        12802, 12731, 12290, 7818, -4113, -17004, -22253, -22124, -21798, -21772, -21675, -21590, 
-        -21494, -21402, -21303, -21214, -21123, -21034, -20943, -20851, -20759, -20665, -20578, -20488, 
-        -20400, -20309, -20219, -20130, -20040, -19954, -19865, -19779, -19689, -19602, -19516, -19428, 
-        -19344, -19256, -19170, -19084, -19000, -18915, -18830, -18749, -18663, -18578, -18495, -18413, 
-        -18331, -18247, -18165, -18082, -18001, -17919, -17839, -17760, -17678, -17598, -17517, -17438, 
-        -17360, -17281, -17202, -17123, -17046, -16967, -16890, -16814, -16736, -16660, -16583, -16508, 
-        -16431, -16356, -16282, -16205, -16130, -16056, -15983, -15910, -15836, -15763, -15688, -15616, 
-        -15544, -15472, -15400, -15329, -15257, -15186, -15115, -15045, -14975, -14905, -14835, -14766, 
-        -14695, -14627, -14558, -14490, -14421, -14353, -14285, -14218, -14150, -14084, -14017, -13950, 
-        -13884, -13819, -13752, -13687, -13622, -13557, -13491, -13426, -13362, -13299, -13235, -13170, 
-        -13107, -13043, -12980, -12917, -12855, -12792, -12730, -12668, -12607, -12544, -12483, -12422, 
-        -12363, -12302, -12242, -12182, -12123, -12063, -12003, -11944, -11884, -11826, -11769, -11711, 
-        -11653, -11594, -11536, -11479, -11422, -11365, -11309, -11252, -11195, -11139, -11084, -11028, 
-        -10973, -10918, -10863, -10808, -10754, -10700, -10646, -10590, -10538, -10483, -10431, -10378, 
-        -10324, -10271, -10219, -10166, -10115, -10063, -10012, -9959, -9908, -9857, -9807, -9755, 
-        -9704, -9654, -9604, -9554, -9504, -9455, -9406, -9356, -9308, -9258, -9209, -9161, 
-        -9112, -9065, -9016, -8969, -8921, -8873, -8826, -8779, -8732, -8685, -8639, -8592, 
-        -8546, -8500, -8455, -8409, -8363, -8319, -8273, -8229, -8184, -8138, -8094, -8050, 
-        -8007, -7962, -7919, -7875, -7832, -7789, -7746, -7703, -7660, -7617, -7575, -7532, 
-        -7491, -7449, -7408, -7366, -7324, -7283, -7243, -7201, -7161, -7121, -7080, -7039, 
-        -7000, -6960, -6921, -6881, -6840, -6802, -6763, -6724, -6685, -6646, -6607, -6569, 
-        -6531, -6492, -6455, -6416, -6379, -6341, -6304, -6268, -6230, -6193, -6157, -6119, 
-        -6083, -6046, -6010, -5974, -5938, -5902, -5867, -5831, -5796, -5760, -5725, -5691, 
-        -5655, -5621, -5587, -5552, -5517, -5484, -5450, -5416, -5383, -5350, -5315, -5282, 
-        -5248, -5215, -5183, -5150, -5117, -5085, -5053, -5020, -4988, -4956, -4925, -4893, 
-        -4862, -4830, -4798, -4767, -4737, -4706, -4676, -4645, -4615, -4584, -4555, -4525, 
-        -4494, -4464, -4434, -4405, -4375, -4346, -4317, -4286, -4257, -4229, -4200, -4171, 
-        -4142, -4114, -4085, -4057, -4029, -4002, -3973, -3945, -3917, -3889, -3863, -3835, 
-        -3808, -3780, -3753, -3726, -3699, -3673, -3645, -3619, -3593, -3566, -3540, -3515, 
-        -3489, -3462, -3436, -3410, -3385, -3360, -3335, -3310, -3283, -3258, -3233, -3210, 
-        -3185, -3160, -3135, -3110, -3086, -3063, -3039, -3014, -2989, -2966, -2942, -2920, 
-        -2896, -2873, -2849, -2826, -2804, -2781, -2761, -2737, -2713, -2690, -2668, -2647, 
-        -2625, -2604, -2580, -2558, -2536, -2515, -2494, -2472, -2451, -2428, -2407, -2386, 
-        -2367, -2347, -2324, -2303, -2281, -2263, -2242, -2222, -2202, -2178, -2159, -2138, 
-        -2121, -2102, -2080, -2059, -2035, -2019, -1998, -1984, -1960, -1935, -1910, -1840 
-    };
-
-    // AKWF_squ_0032 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0032[600] PROGMEM = {
-        2917, 14449, 27328, 32767, 32648, 32251, 32179, 32020, 31871, 31716, 31567, 31413, 
-        31269, 31121, 30975, 30825, 30676, 30529, 30382, 30241, 30094, 29951, 29804, 29659, 
-        29517, 29375, 29236, 29092, 28951, 28809, 28669, 28531, 28392, 28255, 28115, 27976, 
-        27839, 27704, 27570, 27433, 27298, 27162, 27028, 26895, 26763, 26631, 26498, 26366, 
-        26234, 26104, 25975, 25846, 25717, 25587, 25459, 25331, 25205, 25080, 24954, 24828, 
-        24701, 24578, 24453, 24331, 24207, 24084, 23962, 23838, 23719, 23598, 23479, 23358, 
-        23237, 23119, 23001, 22884, 22766, 22650, 22532, 22415, 22301, 22186, 22072, 21956, 
-        21841, 21727, 21613, 21502, 21390, 21280, 21167, 21056, 20945, 20835, 20727, 20616, 
-        20507, 20397, 20290, 20183, 20076, 19970, 19862, 19755, 19649, 19545, 19441, 19335, 
-        19232, 19126, 19023, 18921, 18819, 18717, 18614, 18513, 18410, 18311, 18211, 18112, 
-        18012, 17912, 17813, 17714, 17617, 17519, 17422, 17326, 17227, 17132, 17036, 16943, 
-        16847, 16752, 16657, 16561, 16471, 16377, 16287, 16192, 16099, 16008, 15916, 15828, 
-        15736, 15647, 15555, 15465, 15378, 15289, 15205, 15115, 15028, 14939, 14852, 14769, 
-        14684, 14603, 14512, 14427, 14341, 14261, 14205, 13960, 10397, -576, -13923, -20309, 
-        -20541, -20139, -20110, -20003, -19914, -19825, -19744, -19658, -19574, -19483, -19397, -19312, 
-        -19229, -19148, -19062, -18978, -18893, -18809, -18728, -18646, -18565, -18481, -18400, -18318, 
-        -18238, -18159, -18079, -18000, -17919, -17839, -17759, -17683, -17606, -17526, -17448, -17370, 
-        -17294, -17217, -17140, -17065, -16988, -16913, -16836, -16762, -16688, -16613, -16538, -16464, 
-        -16391, -16317, -16244, -16171, -16099, -16026, -15953, -15882, -15810, -15739, -15668, -15596, 
-        -15526, -15455, -15386, -15316, -15246, -15176, -15106, -15038, -14971, -14902, -14833, -14766, 
-        -14697, -14630, -14564, -14497, -14431, -14364, -14297, -14231, -14165, -14100, -14035, -13970, 
-        -13904, -13840, -13776, -13712, -13649, -13584, -13521, -13458, -13395, -13332, -13270, -13208, 
-        -13145, -13083, -13022, -12960, -12899, -12839, -12779, -12718, -12658, -12598, -12538, -12479, 
-        -12419, -12360, -12301, -12243, -12184, -12127, -12069, -12010, -11952, -11896, -11839, -11782, 
-        -11726, -11668, -11612, -11557, -11501, -11446, -11390, -11335, -11280, -11225, -11172, -11117, 
-        -11063, -11008, -10953, -10900, -10846, -10794, -10741, -10688, -10635, -10581, -10531, -10478, 
-        -10426, -10374, -10323, -10273, -10222, -10171, -10120, -10069, -10019, -9969, -9918, -9869, 
-        -9820, -9770, -9721, -9671, -9623, -9574, -9526, -9478, -9430, -9382, -9334, -9287, 
-        -9240, -9192, -9146, -9098, -9052, -9006, -8959, -8914, -8867, -8822, -8777, -8731, 
-        -8686, -8641, -8595, -8550, -8506, -8461, -8417, -8373, -8330, -8287, -8243, -8199, 
-        -8156, -8114, -8071, -8027, -7985, -7943, -7901, -7858, -7817, -7776, -7733, -7692, 
-        -7651, -7610, -7569, -7529, -7488, -7448, -7407, -7367, -7327, -7287, -7248, -7208, 
-        -7168, -7130, -7091, -7051, -7013, -6974, -6936, -6898, -6859, -6822, -6784, -6747, 
-        -6708, -6671, -6634, -6596, -6559, -6523, -6486, -6449, -6413, -6376, -6340, -6305, 
-        -6268, -6232, -6196, -6162, -6126, -6092, -6056, -6021, -5986, -5952, -5918, -5883, 
-        -5849, -5815, -5780, -5747, -5713, -5680, -5646, -5613, -5580, -5547, -5514, -5481, 
-        -5448, -5417, -5384, -5352, -5319, -5288, -5256, -5225, -5193, -5161, -5130, -5100, 
-        -5068, -5037, -5006, -4975, -4945, -4914, -4884, -4854, -4824, -4794, -4763, -4735, 
-        -4704, -4674, -4645, -4617, -4588, -4558, -4530, -4501, -4472, -4444, -4416, -4387, 
-        -4360, -4331, -4302, -4275, -4247, -4220, -4192, -4165, -4138, -4109, -4083, -4055, 
-        -4029, -4002, -3974, -3948, -3922, -3896, -3870, -3842, -3816, -3790, -3766, -3740, 
-        -3715, -3689, -3663, -3638, -3612, -3587, -3562, -3538, -3513, -3487, -3464, -3439, 
-        -3416, -3391, -3366, -3343, -3318, -3295, -3271, -3248, -3225, -3200, -3177, -3153, 
-        -3132, -3108, -3085, -3062, -3038, -3016, -2994, -2972, -2949, -2927, -2904, -2882, 
-        -2860, -2838, -2817, -2794, -2772, -2751, -2729, -2709, -2687, -2666, -2644, -2624, 
-        -2602, -2583, -2562, -2540, -2519, -2499, -2478, -2458, -2437, -2418, -2396, -2377, 
-        -2356, -2337, -2316, -2297, -2278, -2257, -2238, -2217, -2200, -2180, -2161, -2141, 
-        -2121, -2104, -2086, -2068, -2047, -2028, -2010, -1991, -1976, -1957, -1939, -1920, 
-        -1902, -1885, -1867, -1851, -1832, -1815, -1796, -1780, -1765, -1748, -1733, -1711, 
-        -1696, -1678, -1664, -1651, -1634, -1619, -1598, -1585, -1572, -1570, -1575, -1423 
-    };
-
-    // AKWF_squ_0033 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0033[600] PROGMEM = {
-        2635, 13728, 26794, 32732, 32767, 32327, 32245, 32079, 31920, 31761, 31613, 31462, 
-        31316, 31162, 31011, 30861, 30710, 30566, 30417, 30273, 30123, 29977, 29831, 29687, 
-        29546, 29400, 29256, 29112, 28970, 28829, 28689, 28550, 28408, 28269, 28128, 27990, 
-        27854, 27716, 27580, 27442, 27306, 27171, 27037, 26905, 26770, 26637, 26502, 26371, 
-        26239, 26109, 25980, 25848, 25719, 25588, 25461, 25333, 25206, 25078, 24951, 24826, 
-        24699, 24576, 24451, 24327, 24202, 24078, 23957, 23834, 23714, 23591, 23470, 23350, 
-        23228, 23111, 22991, 22874, 22755, 22636, 22519, 22403, 22287, 22170, 22055, 21939, 
-        21825, 21710, 21597, 21485, 21371, 21257, 21144, 21034, 20923, 20811, 20702, 20589, 
-        20480, 20371, 20263, 20157, 20046, 19938, 19829, 19724, 19618, 19513, 19408, 19301, 
-        19196, 19090, 18989, 18885, 18782, 18679, 18574, 18473, 18371, 18273, 18172, 18070, 
-        17969, 17868, 17771, 17673, 17576, 17476, 17378, 17280, 17183, 17089, 16992, 16898, 
-        16800, 16704, 16611, 16517, 16427, 16332, 16240, 16145, 16052, 15965, 15875, 15787, 
-        15691, 15601, 15510, 15425, 15363, 15115, 11568, 656, -12616, -18968, -19203, -18810, 
-        -18787, -18686, -18604, -18521, -18446, -18366, -18288, -18203, -18121, -18044, -17966, -17891, 
-        -17810, -17733, -17652, -17576, -17499, -17424, -17349, -17270, -17195, -17119, -17045, -16971, 
-        -16896, -16823, -16746, -16674, -16600, -16528, -16456, -16382, -16310, -16236, -16165, -16094, 
-        -16023, -15954, -15882, -15811, -15740, -15671, -15602, -15532, -15463, -15393, -15326, -15257, 
-        -15190, -15122, -15054, -14987, -14918, -14853, -14786, -14721, -14654, -14587, -14522, -14456, 
-        -14392, -14326, -14262, -14197, -14133, -14069, -14005, -13942, -13878, -13815, -13751, -13688, 
-        -13627, -13564, -13503, -13440, -13378, -13317, -13256, -13196, -13134, -13074, -13013, -12953, 
-        -12894, -12834, -12776, -12715, -12657, -12597, -12540, -12481, -12422, -12365, -12308, -12249, 
-        -12192, -12134, -12078, -12021, -11965, -11909, -11853, -11797, -11742, -11687, -11631, -11576, 
-        -11522, -11467, -11413, -11358, -11305, -11250, -11197, -11144, -11091, -11039, -10986, -10933, 
-        -10881, -10829, -10777, -10725, -10673, -10622, -10571, -10519, -10469, -10418, -10369, -10317, 
-        -10268, -10218, -10169, -10120, -10071, -10021, -9972, -9923, -9874, -9826, -9777, -9730, 
-        -9682, -9634, -9585, -9539, -9491, -9444, -9397, -9350, -9304, -9258, -9211, -9166, 
-        -9120, -9073, -9028, -8983, -8938, -8893, -8848, -8803, -8760, -8716, -8671, -8627, 
-        -8584, -8540, -8496, -8453, -8410, -8367, -8325, -8282, -8240, -8198, -8155, -8113, 
-        -8072, -8030, -7989, -7947, -7906, -7865, -7824, -7783, -7743, -7702, -7663, -7623, 
-        -7582, -7543, -7503, -7464, -7424, -7386, -7346, -7308, -7269, -7231, -7192, -7154, 
-        -7116, -7078, -7040, -7003, -6965, -6928, -6891, -6854, -6816, -6779, -6744, -6707, 
-        -6670, -6634, -6598, -6562, -6525, -6490, -6454, -6419, -6385, -6349, -6314, -6278, 
-        -6244, -6210, -6175, -6141, -6107, -6072, -6038, -6004, -5971, -5937, -5903, -5871, 
-        -5838, -5805, -5772, -5738, -5705, -5673, -5641, -5609, -5577, -5546, -5513, -5480, 
-        -5449, -5418, -5386, -5355, -5325, -5294, -5262, -5232, -5201, -5171, -5141, -5109, 
-        -5079, -5049, -5021, -4991, -4961, -4931, -4902, -4872, -4843, -4815, -4786, -4756, 
-        -4727, -4699, -4670, -4643, -4614, -4586, -4557, -4530, -4501, -4474, -4446, -4419, 
-        -4390, -4363, -4337, -4310, -4283, -4255, -4230, -4202, -4178, -4152, -4124, -4099, 
-        -4071, -4045, -4019, -3995, -3969, -3943, -3917, -3893, -3867, -3842, -3816, -3792, 
-        -3766, -3741, -3717, -3692, -3668, -3643, -3618, -3594, -3571, -3547, -3523, -3500, 
-        -3475, -3452, -3427, -3404, -3381, -3358, -3335, -3311, -3290, -3266, -3245, -3221, 
-        -3198, -3176, -3153, -3131, -3110, -3088, -3066, -3043, -3022, -3000, -2979, -2958, 
-        -2936, -2915, -2893, -2872, -2850, -2830, -2810, -2789, -2767, -2747, -2726, -2706, 
-        -2685, -2665, -2644, -2624, -2605, -2584, -2564, -2545, -2524, -2505, -2485, -2466, 
-        -2447, -2428, -2408, -2388, -2369, -2350, -2331, -2313, -2294, -2275, -2256, -2238, 
-        -2219, -2201, -2182, -2163, -2145, -2127, -2110, -2092, -2073, -2055, -2037, -2021, 
-        -2003, -1986, -1968, -1950, -1934, -1916, -1900, -1883, -1866, -1848, -1831, -1815, 
-        -1799, -1784, -1766, -1750, -1733, -1717, -1702, -1686, -1671, -1653, -1638, -1621, 
-        -1606, -1593, -1576, -1561, -1544, -1529, -1515, -1501, -1489, -1471, -1456, -1439, 
-        -1426, -1413, -1399, -1385, -1365, -1351, -1336, -1331, -1319, -1302, -1287, -1204 
-    };
-
-    // AKWF_squ_0034 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0034[600] PROGMEM = {
-        5620, 18332, 29514, 32767, 32224, 31974, 31870, 31709, 31561, 31408, 31253, 31098, 
-        30953, 30805, 30661, 30508, 30360, 30212, 30065, 29923, 29776, 29634, 29486, 29342, 
-        29199, 29057, 28917, 28774, 28633, 28490, 28352, 28212, 28073, 27936, 27796, 27660, 
-        27522, 27387, 27253, 27117, 26982, 26847, 26713, 26579, 26448, 26317, 26185, 26053, 
-        25921, 25793, 25663, 25535, 25406, 25277, 25149, 25021, 24898, 24771, 24646, 24520, 
-        24395, 24271, 24147, 24026, 23902, 23780, 23658, 23535, 23415, 23296, 23177, 23056, 
-        22938, 22818, 22700, 22584, 22466, 22350, 22233, 22116, 22000, 21886, 21773, 21657, 
-        21544, 21430, 21317, 21204, 21093, 20982, 20869, 20759, 20647, 20538, 20429, 20320, 
-        20212, 20101, 19994, 19886, 19780, 19675, 19566, 19461, 19353, 19250, 19145, 19041, 
-        18938, 18831, 18729, 18626, 18525, 18424, 18322, 18219, 18116, 18018, 17917, 17820, 
-        17720, 17621, 17520, 17419, 17326, 17230, 17134, 17035, 16938, 16842, 16747, 16657, 
-        16560, 16467, 16366, 16272, 16182, 16096, 16003, 15905, 13855, 5209, -8261, -16926, 
-        -18258, -17742, -17691, -17616, -17536, -17462, -17391, -17316, -17240, -17162, -17086, -17016, 
-        -16942, -16872, -16795, -16721, -16647, -16574, -16506, -16432, -16362, -16288, -16217, -16147, 
-        -16077, -16008, -15936, -15866, -15796, -15727, -15659, -15590, -15521, -15451, -15384, -15316, 
-        -15248, -15182, -15115, -15048, -14981, -14915, -14849, -14783, -14718, -14652, -14587, -14522, 
-        -14459, -14394, -14330, -14266, -14202, -14139, -14075, -14014, -13950, -13888, -13825, -13763, 
-        -13701, -13640, -13579, -13519, -13458, -13396, -13336, -13276, -13216, -13157, -13096, -13037, 
-        -12978, -12919, -12861, -12803, -12744, -12686, -12628, -12570, -12512, -12456, -12398, -12342, 
-        -12285, -12229, -12172, -12117, -12062, -12005, -11949, -11894, -11840, -11785, -11730, -11676, 
-        -11621, -11567, -11513, -11459, -11407, -11353, -11299, -11247, -11194, -11142, -11089, -11038, 
-        -10986, -10933, -10882, -10831, -10780, -10729, -10679, -10628, -10578, -10527, -10477, -10428, 
-        -10378, -10328, -10278, -10230, -10181, -10133, -10085, -10036, -9988, -9939, -9892, -9845, 
-        -9798, -9750, -9703, -9657, -9610, -9563, -9517, -9470, -9424, -9379, -9333, -9287, 
-        -9243, -9197, -9151, -9107, -9062, -9018, -8974, -8929, -8885, -8842, -8797, -8754, 
-        -8711, -8667, -8624, -8581, -8538, -8495, -8453, -8410, -8368, -8327, -8285, -8243, 
-        -8202, -8160, -8120, -8078, -8037, -7997, -7957, -7916, -7876, -7836, -7797, -7756, 
-        -7716, -7677, -7638, -7598, -7559, -7521, -7482, -7443, -7405, -7366, -7329, -7291, 
-        -7253, -7216, -7178, -7140, -7103, -7065, -7029, -6992, -6955, -6918, -6882, -6846, 
-        -6811, -6774, -6738, -6703, -6667, -6632, -6597, -6562, -6527, -6491, -6456, -6422, 
-        -6387, -6353, -6319, -6285, -6251, -6218, -6183, -6149, -6115, -6083, -6050, -6017, 
-        -5984, -5951, -5918, -5885, -5853, -5821, -5789, -5756, -5725, -5693, -5662, -5630, 
-        -5598, -5567, -5536, -5505, -5474, -5443, -5412, -5382, -5351, -5321, -5291, -5260, 
-        -5230, -5199, -5170, -5140, -5112, -5082, -5053, -5023, -4995, -4965, -4937, -4909, 
-        -4879, -4851, -4823, -4795, -4766, -4738, -4710, -4682, -4655, -4626, -4600, -4573, 
-        -4544, -4518, -4491, -4464, -4437, -4410, -4383, -4357, -4331, -4305, -4278, -4253, 
-        -4226, -4200, -4173, -4149, -4123, -4098, -4072, -4047, -4021, -3997, -3973, -3949, 
-        -3923, -3899, -3875, -3849, -3825, -3801, -3776, -3752, -3728, -3705, -3681, -3658, 
-        -3634, -3610, -3585, -3563, -3540, -3517, -3494, -3470, -3448, -3425, -3402, -3380, 
-        -3357, -3334, -3312, -3289, -3268, -3245, -3224, -3202, -3179, -3158, -3136, -3116, 
-        -3094, -3073, -3051, -3030, -3008, -2988, -2967, -2946, -2925, -2905, -2885, -2864, 
-        -2844, -2824, -2804, -2782, -2762, -2743, -2723, -2704, -2684, -2664, -2645, -2625, 
-        -2606, -2587, -2569, -2548, -2530, -2511, -2492, -2473, -2454, -2435, -2417, -2398, 
-        -2380, -2361, -2344, -2325, -2306, -2287, -2270, -2252, -2235, -2217, -2199, -2181, 
-        -2164, -2146, -2130, -2111, -2094, -2076, -2060, -2043, -2025, -2009, -1992, -1974, 
-        -1958, -1942, -1926, -1908, -1892, -1874, -1860, -1844, -1827, -1811, -1795, -1779, 
-        -1762, -1748, -1732, -1717, -1701, -1685, -1670, -1654, -1640, -1624, -1610, -1593, 
-        -1577, -1564, -1549, -1536, -1519, -1505, -1490, -1476, -1463, -1448, -1436, -1419, 
-        -1405, -1392, -1378, -1366, -1351, -1338, -1322, -1308, -1296, -1285, -1273, -1256, 
-        -1242, -1226, -1218, -1206, -1194, -1179, -1163, -1150, -1140, -1132, -1160, -668 
-    };
-
-    // AKWF_squ_0035 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0035[600] PROGMEM = {
-        2581, 13292, 26364, 32601, 32767, 32302, 32202, 32027, 31872, 31717, 31569, 31415, 
-        31266, 31109, 30956, 30808, 30659, 30515, 30362, 30215, 30065, 29918, 29773, 29628, 
-        29485, 29338, 29195, 29049, 28909, 28767, 28625, 28484, 28341, 28202, 28062, 27925, 
-        27787, 27648, 27511, 27373, 27238, 27103, 26968, 26834, 26697, 26565, 26430, 26300, 
-        26168, 26037, 25905, 25772, 25644, 25514, 25386, 25256, 25129, 25001, 24873, 24748, 
-        24621, 24497, 24372, 24246, 24122, 23997, 23876, 23753, 23631, 23507, 23386, 23265, 
-        23145, 23026, 22905, 22786, 22666, 22548, 22431, 22313, 22198, 22079, 21963, 21846, 
-        21732, 21619, 21504, 21391, 21274, 21162, 21049, 20938, 20827, 20714, 20602, 20490, 
-        20382, 20272, 20163, 20055, 19944, 19836, 19726, 19621, 19516, 19409, 19302, 19194, 
-        19090, 18985, 18882, 18778, 18673, 18569, 18464, 18365, 18264, 18164, 18060, 17957, 
-        17857, 17757, 17663, 17561, 17464, 17359, 17260, 17164, 17074, 16976, 16872, 14800, 
-        6097, -7434, -16117, -17449, -16936, -16889, -16818, -16741, -16671, -16604, -16533, -16462, 
-        -16388, -16315, -16247, -16177, -16109, -16036, -15966, -15897, -15828, -15761, -15692, -15624, 
-        -15554, -15487, -15419, -15353, -15288, -15219, -15153, -15085, -15019, -14954, -14890, -14825, 
-        -14759, -14694, -14629, -14565, -14502, -14437, -14374, -14309, -14247, -14183, -14121, -14059, 
-        -13997, -13935, -13873, -13812, -13751, -13690, -13629, -13569, -13508, -13447, -13388, -13328, 
-        -13269, -13209, -13150, -13092, -13034, -12976, -12918, -12860, -12801, -12743, -12687, -12630, 
-        -12573, -12516, -12460, -12403, -12348, -12292, -12236, -12180, -12125, -12069, -12015, -11960, 
-        -11906, -11852, -11798, -11742, -11690, -11636, -11583, -11529, -11476, -11424, -11371, -11318, 
-        -11267, -11214, -11163, -11110, -11059, -11008, -10958, -10906, -10855, -10805, -10754, -10705, 
-        -10655, -10605, -10555, -10507, -10457, -10408, -10358, -10309, -10261, -10214, -10165, -10116, 
-        -10069, -10022, -9974, -9927, -9880, -9833, -9787, -9741, -9693, -9648, -9602, -9556, 
-        -9510, -9465, -9419, -9375, -9329, -9284, -9240, -9195, -9150, -9106, -9063, -9019, 
-        -8975, -8932, -8888, -8845, -8802, -8759, -8717, -8674, -8632, -8590, -8547, -8505, 
-        -8463, -8422, -8381, -8340, -8298, -8258, -8216, -8175, -8135, -8094, -8055, -8015, 
-        -7974, -7934, -7894, -7854, -7815, -7775, -7736, -7697, -7659, -7620, -7582, -7543, 
-        -7505, -7468, -7430, -7392, -7354, -7316, -7280, -7242, -7205, -7169, -7131, -7095, 
-        -7058, -7022, -6987, -6950, -6914, -6879, -6842, -6807, -6772, -6737, -6702, -6667, 
-        -6631, -6596, -6563, -6527, -6494, -6460, -6426, -6392, -6359, -6325, -6291, -6259, 
-        -6225, -6191, -6159, -6125, -6093, -6060, -6028, -5995, -5963, -5930, -5899, -5867, 
-        -5836, -5803, -5772, -5741, -5710, -5678, -5647, -5616, -5586, -5555, -5525, -5494, 
-        -5464, -5433, -5404, -5374, -5344, -5315, -5285, -5255, -5225, -5196, -5167, -5138, 
-        -5109, -5081, -5051, -5023, -4993, -4966, -4938, -4909, -4881, -4854, -4826, -4797, 
-        -4770, -4743, -4716, -4688, -4661, -4634, -4607, -4580, -4553, -4526, -4500, -4473, 
-        -4447, -4422, -4395, -4369, -4343, -4318, -4291, -4266, -4241, -4215, -4191, -4165, 
-        -4139, -4115, -4091, -4065, -4041, -4016, -3992, -3968, -3944, -3919, -3895, -3871, 
-        -3848, -3823, -3800, -3777, -3753, -3730, -3707, -3683, -3660, -3637, -3614, -3591, 
-        -3568, -3545, -3522, -3501, -3478, -3455, -3433, -3410, -3388, -3367, -3344, -3322, 
-        -3301, -3279, -3257, -3237, -3216, -3194, -3172, -3151, -3130, -3110, -3089, -3068, 
-        -3047, -3026, -3006, -2986, -2966, -2944, -2924, -2904, -2885, -2864, -2845, -2825, 
-        -2805, -2785, -2766, -2747, -2728, -2708, -2689, -2670, -2651, -2632, -2613, -2594, 
-        -2575, -2556, -2537, -2520, -2501, -2483, -2465, -2447, -2428, -2411, -2393, -2375, 
-        -2356, -2339, -2321, -2304, -2286, -2269, -2251, -2234, -2217, -2200, -2184, -2166, 
-        -2148, -2131, -2115, -2097, -2081, -2065, -2049, -2031, -2015, -1999, -1982, -1966, 
-        -1950, -1934, -1917, -1901, -1886, -1870, -1854, -1839, -1823, -1808, -1792, -1777, 
-        -1762, -1746, -1731, -1715, -1701, -1687, -1672, -1655, -1641, -1626, -1612, -1597, 
-        -1583, -1569, -1554, -1539, -1526, -1511, -1499, -1484, -1469, -1456, -1441, -1429, 
-        -1415, -1402, -1387, -1373, -1360, -1346, -1335, -1320, -1308, -1293, -1281, -1268, 
-        -1257, -1245, -1229, -1216, -1202, -1191, -1180, -1167, -1154, -1138, -1127, -1114, 
-        -1106, -1094, -1079, -1065, -1049, -1040, -1027, -1019, -1004, -987, -968, -907 
-    };
-
-    // AKWF_squ_0036 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0036[600] PROGMEM = {
-        2046, 11985, 25244, 32294, 32767, 32238, 32140, 31984, 31835, 31682, 31530, 31372, 
-        31219, 31067, 30921, 30774, 30622, 30473, 30321, 30176, 30030, 29885, 29739, 29592, 
-        29446, 29300, 29160, 29018, 28875, 28731, 28588, 28449, 28308, 28171, 28030, 27891, 
-        27752, 27613, 27478, 27340, 27206, 27069, 26933, 26797, 26663, 26531, 26397, 26267, 
-        26132, 25999, 25869, 25737, 25609, 25478, 25350, 25220, 25091, 24963, 24837, 24712, 
-        24583, 24456, 24329, 24205, 24081, 23956, 23834, 23708, 23585, 23463, 23342, 23221, 
-        23099, 22978, 22857, 22739, 22619, 22501, 22382, 22263, 22146, 22028, 21913, 21798, 
-        21682, 21567, 21450, 21337, 21223, 21111, 20998, 20884, 20771, 20657, 20549, 20439, 
-        20330, 20219, 20108, 20000, 19889, 19784, 19676, 19569, 19461, 19353, 19250, 19143, 
-        19043, 18935, 18833, 18725, 18622, 18522, 18422, 18324, 18216, 18115, 18013, 17916, 
-        17844, 17587, 14081, 3316, -9772, -16043, -16287, -15911, -15900, -15813, -15743, -15673, 
-        -15611, -15543, -15478, -15407, -15337, -15273, -15207, -15145, -15076, -15012, -14945, -14880, 
-        -14817, -14753, -14691, -14624, -14560, -14496, -14435, -14374, -14310, -14249, -14184, -14124, 
-        -14060, -14001, -13941, -13879, -13818, -13757, -13698, -13637, -13578, -13519, -13458, -13399, 
-        -13340, -13282, -13224, -13167, -13108, -13048, -12992, -12935, -12879, -12821, -12765, -12708, 
-        -12651, -12595, -12539, -12485, -12429, -12372, -12317, -12262, -12208, -12155, -12100, -12046, 
-        -11991, -11937, -11883, -11831, -11777, -11725, -11671, -11618, -11567, -11515, -11462, -11410, 
-        -11359, -11307, -11255, -11204, -11153, -11104, -11053, -11001, -10952, -10902, -10852, -10801, 
-        -10753, -10703, -10655, -10605, -10557, -10508, -10458, -10410, -10362, -10315, -10268, -10219, 
-        -10172, -10125, -10078, -10031, -9984, -9938, -9891, -9846, -9799, -9754, -9709, -9663, 
-        -9617, -9571, -9527, -9483, -9438, -9394, -9350, -9305, -9261, -9218, -9174, -9131, 
-        -9086, -9043, -9000, -8957, -8916, -8873, -8831, -8789, -8746, -8705, -8663, -8621, 
-        -8580, -8539, -8498, -8456, -8416, -8375, -8335, -8293, -8253, -8214, -8174, -8135, 
-        -8094, -8055, -8015, -7976, -7937, -7898, -7861, -7822, -7783, -7744, -7706, -7667, 
-        -7629, -7592, -7554, -7516, -7480, -7443, -7406, -7369, -7332, -7295, -7258, -7222, 
-        -7186, -7150, -7113, -7077, -7041, -7006, -6971, -6935, -6900, -6865, -6830, -6795, 
-        -6761, -6726, -6693, -6658, -6623, -6589, -6556, -6523, -6488, -6455, -6421, -6389, 
-        -6355, -6323, -6291, -6257, -6225, -6193, -6160, -6128, -6096, -6065, -6033, -6000, 
-        -5970, -5937, -5906, -5875, -5845, -5812, -5781, -5752, -5721, -5691, -5660, -5630, 
-        -5600, -5570, -5541, -5510, -5480, -5451, -5421, -5392, -5362, -5334, -5304, -5276, 
-        -5246, -5218, -5189, -5160, -5132, -5104, -5076, -5048, -5021, -4992, -4964, -4937, 
-        -4909, -4882, -4855, -4828, -4802, -4775, -4748, -4720, -4693, -4667, -4640, -4613, 
-        -4588, -4562, -4535, -4510, -4484, -4459, -4433, -4408, -4382, -4357, -4333, -4307, 
-        -4281, -4256, -4232, -4208, -4182, -4158, -4134, -4109, -4085, -4061, -4037, -4014, 
-        -3990, -3966, -3941, -3919, -3894, -3872, -3849, -3825, -3802, -3779, -3756, -3733, 
-        -3710, -3687, -3666, -3643, -3622, -3600, -3577, -3556, -3533, -3511, -3490, -3467, 
-        -3446, -3424, -3403, -3381, -3359, -3338, -3318, -3296, -3275, -3255, -3233, -3213, 
-        -3191, -3171, -3150, -3130, -3110, -3089, -3071, -3050, -3030, -3010, -2990, -2970, 
-        -2950, -2931, -2911, -2892, -2873, -2853, -2834, -2815, -2796, -2778, -2759, -2740, 
-        -2721, -2702, -2683, -2665, -2647, -2628, -2611, -2592, -2575, -2556, -2538, -2519, 
-        -2502, -2485, -2467, -2450, -2432, -2415, -2397, -2380, -2364, -2345, -2329, -2311, 
-        -2294, -2278, -2260, -2244, -2227, -2210, -2193, -2177, -2161, -2145, -2128, -2112, 
-        -2096, -2080, -2064, -2048, -2032, -2015, -1999, -1985, -1968, -1954, -1938, -1921, 
-        -1907, -1892, -1876, -1861, -1846, -1830, -1815, -1800, -1786, -1772, -1757, -1741, 
-        -1728, -1713, -1698, -1685, -1670, -1655, -1641, -1627, -1614, -1600, -1585, -1572, 
-        -1557, -1544, -1530, -1517, -1503, -1490, -1477, -1463, -1450, -1438, -1424, -1411, 
-        -1397, -1384, -1370, -1358, -1346, -1333, -1321, -1307, -1295, -1282, -1270, -1257, 
-        -1244, -1231, -1219, -1208, -1196, -1182, -1170, -1157, -1146, -1134, -1122, -1110, 
-        -1096, -1084, -1071, -1061, -1049, -1038, -1026, -1012, -1001, -987, -979, -967, 
-        -956, -942, -927, -920, -908, -901, -885, -870, -852, -841, -833, -807 
-    };
-
-    // AKWF_squ_0037 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0037[600] PROGMEM = {
-        1197, 9526, 22779, 31438, 32767, 32166, 32025, 31872, 31715, 31564, 31415, 31260, 
-        31105, 30952, 30799, 30653, 30502, 30357, 30203, 30054, 29906, 29761, 29617, 29470, 
-        29324, 29177, 29033, 28889, 28747, 28606, 28462, 28321, 28177, 28039, 27899, 27761, 
-        27622, 27481, 27344, 27206, 27071, 26936, 26800, 26664, 26527, 26395, 26261, 26130, 
-        25997, 25864, 25732, 25599, 25472, 25342, 25213, 25083, 24952, 24826, 24698, 24573, 
-        24447, 24320, 24194, 24069, 23945, 23821, 23700, 23576, 23453, 23330, 23208, 23088, 
-        22968, 22850, 22727, 22607, 22488, 22371, 22255, 22135, 22019, 21899, 21784, 21669, 
-        21555, 21443, 21324, 21210, 21094, 20984, 20872, 20759, 20648, 20533, 20422, 20310, 
-        20204, 20096, 19984, 19874, 19759, 19656, 19548, 19445, 19336, 19223, 19111, 18957, 
-        16318, 6729, -6554, -14001, -14733, -14292, -14293, -14240, -14184, -14122, -14060, -13997, 
-        -13942, -13885, -13826, -13769, -13706, -13649, -13591, -13535, -13477, -13420, -13362, -13302, 
-        -13247, -13190, -13135, -13078, -13022, -12966, -12909, -12855, -12799, -12745, -12690, -12634, 
-        -12579, -12523, -12471, -12417, -12364, -12309, -12254, -12201, -12148, -12096, -12043, -11990, 
-        -11936, -11884, -11833, -11781, -11729, -11677, -11625, -11574, -11524, -11473, -11421, -11371, 
-        -11320, -11271, -11220, -11171, -11122, -11071, -11023, -10973, -10925, -10876, -10828, -10780, 
-        -10731, -10683, -10635, -10587, -10540, -10492, -10446, -10398, -10351, -10305, -10259, -10213, 
-        -10166, -10121, -10074, -10029, -9984, -9939, -9893, -9848, -9804, -9759, -9715, -9671, 
-        -9627, -9583, -9538, -9495, -9452, -9409, -9365, -9322, -9280, -9237, -9195, -9152, 
-        -9111, -9068, -9026, -8984, -8943, -8902, -8861, -8819, -8778, -8737, -8697, -8656, 
-        -8616, -8576, -8535, -8495, -8456, -8416, -8376, -8338, -8298, -8259, -8219, -8181, 
-        -8142, -8103, -8066, -8027, -7989, -7952, -7913, -7876, -7838, -7801, -7763, -7725, 
-        -7689, -7652, -7616, -7579, -7543, -7507, -7470, -7434, -7398, -7363, -7327, -7291, 
-        -7256, -7221, -7186, -7150, -7116, -7081, -7047, -7012, -6977, -6944, -6910, -6876, 
-        -6843, -6808, -6775, -6742, -6709, -6675, -6642, -6610, -6577, -6544, -6512, -6480, 
-        -6446, -6414, -6382, -6352, -6320, -6288, -6256, -6224, -6193, -6162, -6131, -6100, 
-        -6068, -6038, -6007, -5975, -5945, -5914, -5885, -5855, -5825, -5796, -5765, -5736, 
-        -5706, -5677, -5646, -5617, -5589, -5560, -5532, -5503, -5475, -5446, -5418, -5388, 
-        -5360, -5332, -5304, -5277, -5249, -5221, -5194, -5166, -5139, -5113, -5085, -5058, 
-        -5030, -5004, -4977, -4950, -4924, -4897, -4871, -4845, -4819, -4793, -4768, -4741, 
-        -4716, -4691, -4666, -4640, -4615, -4590, -4564, -4539, -4514, -4490, -4465, -4441, 
-        -4415, -4391, -4368, -4342, -4318, -4294, -4270, -4246, -4222, -4200, -4176, -4153, 
-        -4129, -4105, -4083, -4060, -4036, -4013, -3991, -3967, -3944, -3922, -3899, -3878, 
-        -3855, -3832, -3810, -3789, -3767, -3745, -3723, -3701, -3679, -3658, -3637, -3616, 
-        -3593, -3573, -3550, -3529, -3509, -3488, -3468, -3447, -3427, -3405, -3385, -3365, 
-        -3345, -3325, -3305, -3285, -3266, -3246, -3226, -3206, -3186, -3167, -3147, -3128, 
-        -3108, -3089, -3070, -3050, -3031, -3013, -2994, -2975, -2957, -2938, -2919, -2901, 
-        -2882, -2864, -2846, -2828, -2809, -2792, -2773, -2756, -2737, -2720, -2703, -2684, 
-        -2667, -2649, -2632, -2615, -2597, -2580, -2563, -2546, -2528, -2512, -2495, -2478, 
-        -2462, -2444, -2428, -2411, -2395, -2378, -2362, -2346, -2330, -2314, -2298, -2282, 
-        -2265, -2250, -2234, -2218, -2202, -2186, -2172, -2156, -2140, -2125, -2109, -2094, 
-        -2078, -2064, -2049, -2034, -2020, -2004, -1989, -1975, -1960, -1945, -1932, -1917, 
-        -1903, -1888, -1875, -1860, -1845, -1831, -1818, -1803, -1790, -1776, -1762, -1748, 
-        -1735, -1720, -1707, -1694, -1680, -1667, -1654, -1640, -1627, -1614, -1602, -1587, 
-        -1574, -1562, -1549, -1537, -1523, -1510, -1497, -1485, -1471, -1459, -1448, -1434, 
-        -1422, -1409, -1397, -1385, -1373, -1361, -1348, -1336, -1324, -1312, -1301, -1289, 
-        -1277, -1264, -1253, -1241, -1231, -1219, -1207, -1195, -1183, -1173, -1161, -1151, 
-        -1139, -1128, -1117, -1105, -1096, -1084, -1074, -1063, -1051, -1042, -1031, -1020, 
-        -1010, -999, -988, -978, -968, -959, -948, -938, -927, -918, -907, -899, 
-        -889, -879, -867, -858, -849, -841, -833, -821, -811, -799, -791, -783, 
-        -775, -766, -753, -745, -734, -731, -724, -713, -698, -689, -674, -717 
-    };
-
-    // AKWF_squ_0038 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0038[600] PROGMEM = {
-        1372, 9887, 23122, 31558, 32767, 32181, 32052, 31899, 31740, 31589, 31440, 31288, 
-        31135, 30981, 30825, 30679, 30529, 30384, 30231, 30082, 29933, 29785, 29641, 29493, 
-        29350, 29202, 29057, 28912, 28771, 28630, 28485, 28344, 28200, 28061, 27920, 27781, 
-        27643, 27502, 27365, 27225, 27090, 26954, 26818, 26682, 26545, 26411, 26277, 26145, 
-        26013, 25880, 25747, 25614, 25485, 25355, 25226, 25097, 24966, 24839, 24708, 24584, 
-        24457, 24332, 24204, 24078, 23954, 23829, 23708, 23584, 23460, 23337, 23214, 23094, 
-        22973, 22855, 22733, 22613, 22493, 22375, 22259, 22141, 22026, 21905, 21788, 21672, 
-        21558, 21446, 21329, 21216, 21099, 20987, 20875, 20766, 20656, 20539, 20427, 20314, 
-        20210, 20103, 19995, 19882, 19770, 19656, 19602, 18179, 10743, -2495, -12269, -14369, 
-        -13870, -13810, -13777, -13710, -13650, -13589, -13531, -13475, -13421, -13363, -13306, -13246, 
-        -13190, -13134, -13080, -13025, -12966, -12911, -12853, -12802, -12747, -12692, -12638, -12582, 
-        -12529, -12474, -12422, -12369, -12316, -12263, -12208, -12156, -12104, -12053, -11999, -11947, 
-        -11896, -11844, -11793, -11741, -11691, -11639, -11588, -11538, -11487, -11438, -11387, -11338, 
-        -11288, -11237, -11189, -11140, -11092, -11041, -10994, -10944, -10896, -10849, -10799, -10753, 
-        -10704, -10657, -10609, -10563, -10516, -10469, -10423, -10375, -10328, -10283, -10237, -10191, 
-        -10145, -10100, -10054, -10009, -9964, -9920, -9875, -9831, -9786, -9742, -9698, -9654, 
-        -9610, -9566, -9524, -9480, -9437, -9394, -9352, -9309, -9267, -9224, -9183, -9140, 
-        -9099, -9058, -9015, -8974, -8933, -8893, -8852, -8810, -8771, -8729, -8689, -8649, 
-        -8610, -8570, -8530, -8490, -8451, -8411, -8373, -8334, -8296, -8257, -8218, -8180, 
-        -8141, -8103, -8065, -8027, -7990, -7952, -7915, -7878, -7841, -7803, -7766, -7729, 
-        -7693, -7656, -7620, -7584, -7548, -7512, -7476, -7440, -7404, -7370, -7334, -7298, 
-        -7263, -7229, -7194, -7159, -7125, -7090, -7057, -7022, -6988, -6955, -6920, -6887, 
-        -6853, -6820, -6787, -6754, -6720, -6687, -6655, -6622, -6590, -6557, -6525, -6493, 
-        -6461, -6429, -6397, -6367, -6335, -6303, -6272, -6242, -6210, -6179, -6148, -6118, 
-        -6087, -6057, -6026, -5995, -5966, -5936, -5906, -5876, -5846, -5817, -5787, -5757, 
-        -5728, -5699, -5669, -5640, -5611, -5583, -5554, -5526, -5498, -5470, -5441, -5413, 
-        -5385, -5357, -5329, -5302, -5274, -5248, -5220, -5193, -5165, -5139, -5112, -5084, 
-        -5058, -5031, -5004, -4978, -4952, -4926, -4899, -4874, -4849, -4823, -4797, -4771, 
-        -4746, -4720, -4694, -4669, -4645, -4620, -4595, -4571, -4545, -4521, -4496, -4472, 
-        -4448, -4423, -4399, -4375, -4351, -4327, -4303, -4281, -4257, -4233, -4210, -4186, 
-        -4162, -4140, -4117, -4094, -4072, -4048, -4025, -4003, -3980, -3959, -3936, -3915, 
-        -3892, -3870, -3848, -3826, -3804, -3782, -3760, -3739, -3718, -3695, -3674, -3654, 
-        -3633, -3611, -3590, -3569, -3549, -3528, -3508, -3486, -3466, -3445, -3425, -3405, 
-        -3385, -3365, -3344, -3324, -3304, -3285, -3266, -3246, -3227, -3207, -3188, -3170, 
-        -3151, -3131, -3113, -3094, -3074, -3055, -3037, -3018, -2999, -2981, -2962, -2944, 
-        -2925, -2908, -2889, -2870, -2853, -2836, -2817, -2800, -2783, -2764, -2747, -2729, 
-        -2712, -2693, -2678, -2660, -2643, -2626, -2608, -2591, -2575, -2558, -2540, -2525, 
-        -2507, -2491, -2475, -2458, -2442, -2426, -2410, -2393, -2377, -2361, -2345, -2329, 
-        -2313, -2297, -2282, -2266, -2250, -2235, -2220, -2204, -2189, -2173, -2159, -2143, 
-        -2128, -2113, -2099, -2083, -2068, -2054, -2039, -2024, -2010, -1995, -1980, -1966, 
-        -1951, -1937, -1923, -1909, -1895, -1881, -1866, -1853, -1839, -1825, -1811, -1798, 
-        -1784, -1770, -1757, -1744, -1730, -1717, -1704, -1689, -1677, -1664, -1652, -1639, 
-        -1625, -1612, -1599, -1587, -1575, -1561, -1548, -1536, -1523, -1511, -1499, -1487, 
-        -1474, -1462, -1450, -1438, -1426, -1414, -1402, -1390, -1376, -1366, -1354, -1342, 
-        -1330, -1318, -1307, -1295, -1283, -1273, -1261, -1249, -1238, -1226, -1215, -1203, 
-        -1193, -1181, -1170, -1160, -1149, -1138, -1126, -1116, -1104, -1094, -1082, -1073, 
-        -1062, -1052, -1041, -1029, -1020, -1011, -1001, -991, -979, -969, -959, -949, 
-        -940, -929, -919, -908, -900, -890, -882, -871, -862, -851, -842, -834, 
-        -824, -816, -806, -796, -787, -779, -771, -760, -752, -742, -734, -726, 
-        -719, -714, -701, -691, -681, -677, -669, -663, -654, -643, -626, -673 
-    };
-
-    // AKWF_squ_0039 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0039[600] PROGMEM = {
-        455, 6944, 19711, 30106, 32767, 32214, 32006, 31883, 31721, 31575, 31425, 31275, 
-        31121, 30970, 30815, 30670, 30520, 30374, 30223, 30074, 29927, 29778, 29635, 29489, 
-        29346, 29199, 29053, 28909, 28766, 28625, 28482, 28341, 28198, 28056, 27918, 27779, 
-        27642, 27500, 27361, 27223, 27086, 26951, 26814, 26680, 26542, 26408, 26273, 26142, 
-        26009, 25875, 25742, 25608, 25480, 25350, 25220, 25091, 24960, 24831, 24701, 24576, 
-        24449, 24321, 24195, 24067, 23943, 23817, 23695, 23572, 23447, 23324, 23199, 23080, 
-        22959, 22839, 22717, 22597, 22477, 22357, 22242, 22123, 22006, 21887, 21769, 21655, 
-        21539, 21428, 21311, 21197, 21080, 20967, 20857, 20747, 20638, 20522, 20410, 20299, 
-        20193, 20110, 19845, 16372, 5735, -7196, -13397, -13649, -13288, -13288, -13213, -13154, 
-        -13097, -13045, -12988, -12935, -12876, -12817, -12764, -12710, -12659, -12602, -12548, -12491, 
-        -12438, -12385, -12332, -12281, -12225, -12174, -12119, -12069, -12017, -11965, -11914, -11861, 
-        -11810, -11758, -11708, -11659, -11607, -11557, -11506, -11457, -11407, -11358, -11309, -11258, 
-        -11209, -11160, -11112, -11065, -11017, -10968, -10919, -10872, -10824, -10778, -10730, -10682, 
-        -10636, -10590, -10543, -10497, -10452, -10404, -10359, -10312, -10267, -10222, -10177, -10132, 
-        -10087, -10042, -9997, -9953, -9909, -9864, -9820, -9776, -9733, -9689, -9646, -9602, 
-        -9560, -9516, -9474, -9431, -9389, -9346, -9304, -9262, -9220, -9178, -9137, -9096, 
-        -9055, -9013, -8972, -8931, -8891, -8850, -8810, -8769, -8729, -8690, -8650, -8610, 
-        -8570, -8532, -8492, -8454, -8414, -8375, -8337, -8298, -8260, -8221, -8184, -8146, 
-        -8109, -8071, -8033, -7996, -7959, -7922, -7884, -7849, -7811, -7776, -7738, -7703, 
-        -7667, -7631, -7595, -7559, -7523, -7488, -7453, -7417, -7383, -7348, -7313, -7278, 
-        -7244, -7209, -7175, -7140, -7107, -7072, -7039, -7006, -6972, -6938, -6905, -6872, 
-        -6839, -6806, -6773, -6739, -6708, -6676, -6644, -6611, -6579, -6547, -6515, -6483, 
-        -6451, -6420, -6388, -6357, -6325, -6295, -6264, -6234, -6203, -6173, -6141, -6112, 
-        -6081, -6051, -6022, -5991, -5962, -5931, -5902, -5873, -5844, -5815, -5785, -5756, 
-        -5727, -5699, -5670, -5641, -5613, -5585, -5556, -5528, -5500, -5472, -5444, -5417, 
-        -5389, -5362, -5334, -5306, -5279, -5252, -5226, -5198, -5171, -5145, -5118, -5092, 
-        -5065, -5040, -5013, -4988, -4962, -4935, -4910, -4883, -4858, -4833, -4808, -4782, 
-        -4757, -4732, -4707, -4682, -4658, -4633, -4609, -4583, -4560, -4536, -4510, -4487, 
-        -4463, -4439, -4415, -4391, -4367, -4343, -4319, -4297, -4273, -4249, -4227, -4204, 
-        -4181, -4158, -4135, -4112, -4090, -4067, -4045, -4022, -4000, -3978, -3956, -3933, 
-        -3912, -3891, -3868, -3847, -3826, -3803, -3782, -3761, -3740, -3718, -3697, -3677, 
-        -3656, -3635, -3615, -3594, -3574, -3553, -3533, -3511, -3492, -3472, -3452, -3432, 
-        -3412, -3392, -3372, -3352, -3332, -3312, -3294, -3274, -3255, -3235, -3217, -3198, 
-        -3178, -3160, -3141, -3121, -3104, -3086, -3067, -3048, -3030, -3013, -2994, -2975, 
-        -2957, -2940, -2921, -2904, -2885, -2868, -2849, -2832, -2815, -2796, -2779, -2762, 
-        -2745, -2727, -2710, -2693, -2676, -2660, -2642, -2626, -2609, -2592, -2576, -2559, 
-        -2543, -2526, -2510, -2494, -2478, -2462, -2445, -2429, -2413, -2398, -2382, -2366, 
-        -2350, -2335, -2320, -2304, -2288, -2274, -2258, -2243, -2228, -2213, -2198, -2182, 
-        -2167, -2153, -2138, -2124, -2109, -2094, -2080, -2065, -2051, -2036, -2021, -2007, 
-        -1992, -1979, -1964, -1951, -1937, -1922, -1909, -1894, -1881, -1868, -1854, -1841, 
-        -1826, -1813, -1800, -1787, -1773, -1760, -1747, -1734, -1720, -1707, -1695, -1682, 
-        -1669, -1655, -1642, -1630, -1618, -1605, -1592, -1580, -1568, -1556, -1543, -1531, 
-        -1517, -1505, -1493, -1481, -1470, -1458, -1446, -1434, -1422, -1411, -1399, -1387, 
-        -1375, -1363, -1353, -1341, -1330, -1318, -1306, -1296, -1285, -1273, -1263, -1252, 
-        -1241, -1229, -1219, -1208, -1198, -1187, -1176, -1166, -1154, -1143, -1133, -1123, 
-        -1113, -1101, -1090, -1081, -1070, -1061, -1050, -1040, -1029, -1018, -1009, -1000, 
-        -989, -979, -969, -959, -949, -940, -930, -920, -910, -900, -890, -880, 
-        -871, -862, -853, -842, -834, -825, -817, -806, -797, -788, -778, -770, 
-        -761, -753, -742, -733, -725, -717, -711, -700, -693, -681, -673, -667, 
-        -659, -654, -642, -635, -624, -619, -615, -611, -604, -594, -578, -622 
-    };
-
-    // AKWF_squ_0040 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0040[600] PROGMEM = {
-        2628, 12746, 25779, 32432, 32767, 32257, 32152, 31985, 31832, 31678, 31528, 31368, 
-        31214, 31057, 30906, 30757, 30606, 30457, 30301, 30152, 30002, 29857, 29710, 29561, 
-        29415, 29266, 29122, 28977, 28835, 28691, 28546, 28403, 28259, 28121, 27981, 27840, 
-        27699, 27558, 27421, 27281, 27146, 27009, 26872, 26735, 26598, 26465, 26330, 26198, 
-        26063, 25930, 25795, 25662, 25533, 25403, 25274, 25141, 25011, 24883, 24754, 24629, 
-        24500, 24373, 24243, 24117, 23992, 23868, 23747, 23618, 23493, 23368, 23247, 23125, 
-        23003, 22883, 22757, 22637, 22516, 22400, 22282, 22161, 22041, 21918, 21804, 21686, 
-        21576, 21456, 21334, 21214, 21050, 18404, 8809, -4477, -11930, -12671, -12238, -12250, 
-        -12205, -12157, -12104, -12051, -11997, -11951, -11903, -11854, -11805, -11751, -11702, -11652, 
-        -11605, -11556, -11507, -11457, -11407, -11360, -11311, -11265, -11217, -11169, -11121, -11072, 
-        -11026, -10978, -10932, -10884, -10836, -10790, -10743, -10699, -10653, -10607, -10559, -10514, 
-        -10469, -10424, -10379, -10333, -10288, -10243, -10199, -10154, -10110, -10066, -10022, -9978, 
-        -9934, -9892, -9848, -9804, -9761, -9717, -9675, -9632, -9590, -9548, -9506, -9465, 
-        -9422, -9381, -9338, -9297, -9256, -9215, -9175, -9133, -9093, -9052, -9012, -8972, 
-        -8931, -8891, -8851, -8813, -8773, -8734, -8694, -8656, -8617, -8579, -8540, -8501, 
-        -8463, -8424, -8386, -8348, -8311, -8274, -8237, -8198, -8161, -8125, -8088, -8050, 
-        -8013, -7977, -7941, -7905, -7870, -7834, -7796, -7762, -7726, -7690, -7655, -7621, 
-        -7585, -7550, -7516, -7481, -7447, -7412, -7377, -7343, -7308, -7275, -7242, -7207, 
-        -7174, -7141, -7107, -7074, -7041, -7008, -6976, -6942, -6909, -6877, -6845, -6812, 
-        -6780, -6748, -6716, -6684, -6652, -6620, -6590, -6558, -6527, -6495, -6465, -6434, 
-        -6404, -6373, -6342, -6312, -6281, -6252, -6221, -6192, -6161, -6132, -6103, -6072, 
-        -6043, -6014, -5985, -5955, -5927, -5898, -5870, -5841, -5813, -5784, -5756, -5728, 
-        -5700, -5672, -5644, -5616, -5588, -5560, -5534, -5506, -5479, -5452, -5424, -5398, 
-        -5371, -5345, -5318, -5291, -5265, -5238, -5212, -5186, -5160, -5133, -5108, -5083, 
-        -5056, -5031, -5005, -4980, -4955, -4930, -4904, -4879, -4854, -4828, -4805, -4781, 
-        -4755, -4730, -4706, -4681, -4657, -4633, -4609, -4585, -4561, -4537, -4513, -4491, 
-        -4467, -4444, -4420, -4397, -4375, -4351, -4328, -4306, -4283, -4260, -4238, -4215, 
-        -4193, -4170, -4149, -4126, -4103, -4082, -4061, -4038, -4017, -3996, -3974, -3953, 
-        -3932, -3911, -3889, -3868, -3847, -3825, -3805, -3784, -3763, -3743, -3723, -3702, 
-        -3682, -3660, -3641, -3621, -3601, -3581, -3561, -3541, -3521, -3502, -3482, -3462, 
-        -3442, -3424, -3404, -3385, -3365, -3347, -3328, -3308, -3289, -3271, -3252, -3233, 
-        -3215, -3196, -3178, -3160, -3142, -3123, -3104, -3087, -3069, -3050, -3033, -3015, 
-        -2997, -2979, -2962, -2945, -2927, -2910, -2894, -2877, -2860, -2844, -2826, -2809, 
-        -2792, -2776, -2759, -2741, -2725, -2708, -2692, -2675, -2659, -2643, -2627, -2611, 
-        -2595, -2579, -2563, -2547, -2531, -2515, -2499, -2485, -2469, -2453, -2437, -2422, 
-        -2407, -2391, -2377, -2361, -2346, -2330, -2316, -2301, -2286, -2272, -2256, -2242, 
-        -2228, -2213, -2198, -2183, -2169, -2155, -2140, -2127, -2112, -2097, -2084, -2071, 
-        -2056, -2042, -2028, -2015, -2000, -1987, -1974, -1960, -1946, -1932, -1919, -1906, 
-        -1893, -1879, -1867, -1854, -1841, -1827, -1814, -1802, -1789, -1777, -1763, -1750, 
-        -1738, -1726, -1713, -1701, -1689, -1676, -1664, -1652, -1640, -1628, -1616, -1604, 
-        -1592, -1580, -1568, -1556, -1544, -1532, -1520, -1509, -1497, -1485, -1475, -1463, 
-        -1451, -1440, -1428, -1418, -1407, -1395, -1384, -1372, -1362, -1351, -1340, -1328, 
-        -1318, -1307, -1297, -1286, -1275, -1265, -1254, -1243, -1233, -1222, -1213, -1201, 
-        -1191, -1181, -1170, -1161, -1150, -1140, -1129, -1120, -1109, -1100, -1090, -1080, 
-        -1070, -1060, -1052, -1041, -1032, -1023, -1013, -1004, -993, -985, -975, -967, 
-        -956, -947, -939, -929, -920, -911, -901, -892, -884, -875, -867, -858, 
-        -848, -840, -831, -823, -815, -806, -798, -788, -780, -772, -764, -756, 
-        -747, -739, -730, -722, -714, -706, -699, -689, -682, -673, -666, -659, 
-        -650, -642, -631, -625, -617, -610, -603, -594, -586, -576, -570, -562, 
-        -556, -546, -536, -526, -517, -516, -506, -498, -480, -468, -460, -429 
-    };
-
-    // AKWF_squ_0041 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0041[600] PROGMEM = {
-        531, 6672, 19244, 29869, 32767, 32221, 31990, 31872, 31711, 31564, 31411, 31257, 
-        31101, 30950, 30795, 30650, 30498, 30351, 30198, 30046, 29900, 29752, 29608, 29458, 
-        29311, 29163, 29018, 28874, 28731, 28590, 28443, 28299, 28157, 28017, 27877, 27735, 
-        27596, 27454, 27315, 27177, 27039, 26904, 26765, 26628, 26489, 26356, 26222, 26087, 
-        25954, 25818, 25686, 25551, 25422, 25292, 25161, 25029, 24897, 24769, 24640, 24514, 
-        24387, 24257, 24128, 23999, 23877, 23753, 23631, 23503, 23377, 23255, 23131, 23013, 
-        22889, 22769, 22641, 22520, 22402, 22289, 22169, 22045, 20005, 11498, -1741, -10267, 
-        -11603, -11124, -11102, -11056, -11006, -10961, -10919, -10872, -10825, -10776, -10727, -10685, 
-        -10640, -10598, -10549, -10503, -10458, -10413, -10371, -10326, -10283, -10237, -10193, -10150, 
-        -10106, -10065, -10019, -9977, -9932, -9890, -9847, -9807, -9764, -9721, -9680, -9636, 
-        -9595, -9555, -9514, -9473, -9431, -9390, -9349, -9309, -9270, -9229, -9188, -9148, 
-        -9109, -9069, -9030, -8990, -8950, -8912, -8873, -8834, -8796, -8758, -8718, -8680, 
-        -8643, -8605, -8568, -8530, -8493, -8454, -8417, -8380, -8344, -8307, -8270, -8233, 
-        -8197, -8160, -8125, -8089, -8052, -8016, -7981, -7945, -7910, -7875, -7840, -7804, 
-        -7770, -7734, -7700, -7665, -7631, -7597, -7563, -7528, -7494, -7461, -7427, -7394, 
-        -7359, -7326, -7293, -7260, -7227, -7195, -7162, -7129, -7096, -7064, -7031, -6999, 
-        -6968, -6936, -6903, -6873, -6841, -6809, -6778, -6746, -6716, -6684, -6654, -6623, 
-        -6592, -6561, -6531, -6501, -6470, -6441, -6411, -6381, -6352, -6321, -6292, -6262, 
-        -6233, -6204, -6175, -6147, -6118, -6089, -6060, -6031, -6003, -5974, -5947, -5918, 
-        -5890, -5862, -5834, -5807, -5779, -5751, -5725, -5697, -5669, -5643, -5615, -5589, 
-        -5561, -5535, -5509, -5482, -5454, -5429, -5403, -5377, -5350, -5325, -5299, -5272, 
-        -5247, -5221, -5196, -5171, -5146, -5121, -5096, -5071, -5046, -5022, -4997, -4972, 
-        -4947, -4923, -4898, -4874, -4849, -4825, -4801, -4778, -4754, -4730, -4706, -4684, 
-        -4660, -4637, -4614, -4590, -4567, -4544, -4522, -4498, -4476, -4453, -4429, -4408, 
-        -4386, -4363, -4341, -4319, -4296, -4275, -4253, -4232, -4210, -4188, -4167, -4144, 
-        -4123, -4102, -4080, -4059, -4038, -4017, -3995, -3974, -3955, -3933, -3912, -3893, 
-        -3871, -3852, -3831, -3811, -3791, -3770, -3750, -3730, -3712, -3692, -3672, -3652, 
-        -3633, -3613, -3594, -3575, -3555, -3536, -3517, -3498, -3480, -3461, -3441, -3423, 
-        -3404, -3386, -3367, -3349, -3331, -3312, -3294, -3275, -3258, -3239, -3222, -3204, 
-        -3187, -3168, -3151, -3134, -3115, -3098, -3081, -3063, -3046, -3028, -3011, -2995, 
-        -2978, -2961, -2944, -2928, -2911, -2894, -2878, -2861, -2845, -2828, -2812, -2796, 
-        -2779, -2763, -2747, -2732, -2716, -2700, -2684, -2668, -2652, -2637, -2622, -2608, 
-        -2592, -2577, -2561, -2546, -2531, -2515, -2501, -2485, -2470, -2456, -2440, -2426, 
-        -2411, -2397, -2382, -2367, -2353, -2338, -2324, -2309, -2295, -2282, -2267, -2253, 
-        -2238, -2225, -2211, -2197, -2183, -2170, -2155, -2142, -2129, -2114, -2101, -2088, 
-        -2075, -2061, -2048, -2035, -2022, -2009, -1995, -1982, -1970, -1957, -1944, -1931, 
-        -1919, -1906, -1893, -1881, -1868, -1856, -1842, -1831, -1819, -1806, -1794, -1782, 
-        -1770, -1758, -1746, -1734, -1721, -1709, -1699, -1687, -1674, -1663, -1651, -1639, 
-        -1629, -1617, -1605, -1593, -1583, -1571, -1560, -1548, -1538, -1527, -1515, -1503, 
-        -1493, -1482, -1472, -1460, -1449, -1439, -1428, -1416, -1406, -1395, -1385, -1375, 
-        -1365, -1354, -1344, -1333, -1323, -1312, -1303, -1292, -1282, -1273, -1262, -1251, 
-        -1242, -1233, -1222, -1213, -1203, -1193, -1183, -1174, -1164, -1155, -1146, -1135, 
-        -1126, -1117, -1108, -1098, -1089, -1080, -1071, -1061, -1052, -1043, -1035, -1026, 
-        -1017, -1007, -998, -990, -981, -973, -964, -955, -947, -939, -930, -920, 
-        -912, -903, -895, -887, -878, -870, -862, -853, -845, -837, -829, -820, 
-        -812, -804, -796, -788, -780, -773, -765, -757, -747, -741, -733, -725, 
-        -718, -709, -703, -695, -688, -680, -672, -664, -655, -650, -642, -635, 
-        -627, -620, -613, -605, -600, -592, -585, -577, -569, -564, -556, -551, 
-        -543, -536, -530, -523, -517, -510, -506, -497, -490, -484, -478, -474, 
-        -468, -464, -453, -448, -443, -441, -437, -430, -422, -416, -410, -459 
-    };
-
-    // AKWF_squ_0042 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0042[600] PROGMEM = {
-        2705, 12661, 25655, 32390, 32767, 32248, 32143, 31979, 31826, 31671, 31519, 31356, 
-        31200, 31044, 30893, 30743, 30589, 30439, 30283, 30132, 29981, 29836, 29689, 29538, 
-        29390, 29239, 29096, 28951, 28807, 28661, 28514, 28371, 28226, 28087, 27945, 27804, 
-        27661, 27518, 27382, 27242, 27107, 26966, 26829, 26690, 26552, 26420, 26284, 26151, 
-        26014, 25880, 25745, 25613, 25485, 25352, 25224, 25088, 24957, 24827, 24703, 24578, 
-        24448, 24318, 24188, 24060, 23991, 23312, 17990, 5720, -5936, -9894, -9592, -9422, 
-        -9429, -9370, -9329, -9285, -9250, -9210, -9174, -9132, -9092, -9052, -9014, -8978, 
-        -8940, -8903, -8862, -8825, -8786, -8751, -8715, -8677, -8640, -8601, -8566, -8530, 
-        -8494, -8458, -8421, -8384, -8347, -8314, -8278, -8244, -8208, -8173, -8138, -8103, 
-        -8069, -8034, -7999, -7965, -7929, -7896, -7863, -7830, -7796, -7761, -7728, -7694, 
-        -7661, -7628, -7596, -7561, -7528, -7497, -7464, -7432, -7399, -7367, -7334, -7302, 
-        -7270, -7239, -7207, -7175, -7143, -7112, -7081, -7049, -7019, -6989, -6957, -6926, 
-        -6896, -6866, -6835, -6805, -6774, -6744, -6715, -6684, -6655, -6625, -6596, -6567, 
-        -6536, -6507, -6478, -6450, -6421, -6392, -6363, -6334, -6306, -6278, -6249, -6221, 
-        -6194, -6166, -6137, -6110, -6082, -6055, -6027, -5999, -5973, -5945, -5918, -5892, 
-        -5864, -5838, -5811, -5785, -5758, -5732, -5705, -5679, -5654, -5627, -5602, -5576, 
-        -5551, -5524, -5499, -5474, -5449, -5424, -5397, -5373, -5348, -5323, -5299, -5274, 
-        -5249, -5225, -5201, -5176, -5152, -5127, -5103, -5080, -5056, -5032, -5008, -4984, 
-        -4961, -4938, -4914, -4892, -4868, -4845, -4822, -4799, -4775, -4753, -4730, -4708, 
-        -4685, -4663, -4640, -4618, -4595, -4574, -4552, -4531, -4508, -4487, -4464, -4443, 
-        -4422, -4401, -4380, -4357, -4336, -4316, -4295, -4274, -4253, -4232, -4210, -4191, 
-        -4169, -4150, -4128, -4109, -4089, -4069, -4048, -4028, -4008, -3988, -3968, -3948, 
-        -3929, -3910, -3890, -3870, -3851, -3832, -3812, -3794, -3775, -3757, -3737, -3718, 
-        -3700, -3680, -3661, -3643, -3624, -3606, -3587, -3569, -3552, -3533, -3515, -3496, 
-        -3479, -3462, -3443, -3426, -3407, -3390, -3373, -3356, -3339, -3320, -3303, -3286, 
-        -3268, -3251, -3234, -3217, -3200, -3183, -3165, -3149, -3132, -3116, -3099, -3083, 
-        -3066, -3050, -3034, -3018, -3001, -2985, -2970, -2954, -2938, -2922, -2906, -2890, 
-        -2874, -2858, -2844, -2828, -2813, -2798, -2783, -2767, -2753, -2738, -2722, -2708, 
-        -2692, -2677, -2663, -2648, -2633, -2619, -2604, -2590, -2575, -2561, -2546, -2532, 
-        -2518, -2504, -2489, -2475, -2462, -2447, -2434, -2419, -2406, -2393, -2378, -2365, 
-        -2350, -2337, -2324, -2311, -2297, -2284, -2271, -2258, -2245, -2233, -2219, -2206, 
-        -2193, -2180, -2168, -2155, -2143, -2129, -2116, -2103, -2091, -2079, -2066, -2054, 
-        -2041, -2029, -2017, -2005, -1993, -1980, -1968, -1956, -1944, -1932, -1920, -1909, 
-        -1897, -1885, -1874, -1862, -1850, -1838, -1826, -1816, -1804, -1793, -1782, -1771, 
-        -1759, -1748, -1737, -1726, -1715, -1703, -1693, -1682, -1670, -1660, -1649, -1639, 
-        -1628, -1617, -1607, -1596, -1586, -1576, -1566, -1555, -1545, -1534, -1524, -1513, 
-        -1502, -1493, -1483, -1472, -1463, -1452, -1443, -1432, -1423, -1412, -1403, -1394, 
-        -1383, -1374, -1365, -1356, -1346, -1336, -1326, -1317, -1308, -1299, -1289, -1280, 
-        -1271, -1262, -1252, -1243, -1234, -1225, -1215, -1207, -1198, -1189, -1180, -1172, 
-        -1162, -1154, -1145, -1136, -1128, -1119, -1111, -1103, -1094, -1086, -1076, -1068, 
-        -1061, -1053, -1043, -1035, -1027, -1019, -1012, -1004, -996, -986, -978, -971, 
-        -963, -955, -947, -939, -931, -923, -916, -908, -900, -892, -886, -878, 
-        -870, -862, -855, -848, -840, -833, -825, -818, -810, -804, -796, -789, 
-        -781, -775, -767, -760, -754, -746, -739, -732, -724, -719, -711, -705, 
-        -697, -690, -685, -678, -672, -664, -657, -650, -645, -638, -632, -625, 
-        -619, -612, -607, -600, -594, -587, -582, -575, -568, -563, -556, -551, 
-        -545, -538, -531, -526, -521, -515, -509, -502, -497, -492, -485, -481, 
-        -473, -468, -461, -457, -452, -445, -440, -433, -428, -422, -418, -412, 
-        -406, -400, -392, -388, -383, -378, -373, -366, -361, -353, -351, -345, 
-        -341, -333, -324, -318, -312, -312, -304, -296, -279, -269, -268, -244 
-    };
-
-    // AKWF_squ_0043 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0043[600] PROGMEM = {
-        2121, 11217, 24328, 31964, 32767, 32235, 32146, 31993, 31830, 31670, 31518, 31364, 
-        31216, 31062, 30908, 30755, 30599, 30452, 30301, 30154, 30002, 29852, 29702, 29553, 
-        29409, 29261, 29117, 28968, 28821, 28677, 28533, 28393, 28247, 28106, 27959, 27818, 
-        27678, 27539, 27401, 27257, 27117, 26976, 26841, 26705, 26567, 26431, 26291, 26156, 
-        26020, 25889, 25757, 25620, 25485, 25347, 25219, 25087, 24961, 24829, 24692, 24557, 
-        24380, 21735, 12188, -1028, -8447, -9197, -8782, -8809, -8778, -8745, -8707, -8670, 
-        -8630, -8597, -8564, -8530, -8494, -8456, -8421, -8386, -8353, -8318, -8283, -8247, 
-        -8211, -8178, -8144, -8111, -8077, -8041, -8008, -7972, -7940, -7906, -7873, -7839, 
-        -7806, -7773, -7738, -7706, -7673, -7642, -7609, -7576, -7543, -7511, -7479, -7446, 
-        -7414, -7381, -7350, -7318, -7286, -7256, -7224, -7192, -7162, -7130, -7100, -7068, 
-        -7038, -7006, -6976, -6945, -6916, -6886, -6855, -6826, -6796, -6767, -6736, -6707, 
-        -6677, -6648, -6619, -6590, -6561, -6531, -6504, -6475, -6446, -6418, -6389, -6361, 
-        -6333, -6304, -6276, -6249, -6221, -6193, -6167, -6139, -6111, -6083, -6057, -6029, 
-        -6003, -5976, -5949, -5922, -5896, -5869, -5843, -5816, -5791, -5765, -5738, -5713, 
-        -5687, -5662, -5635, -5610, -5585, -5560, -5535, -5510, -5485, -5458, -5434, -5409, 
-        -5384, -5360, -5335, -5311, -5286, -5263, -5239, -5214, -5190, -5166, -5142, -5119, 
-        -5095, -5072, -5048, -5025, -5001, -4978, -4955, -4932, -4910, -4886, -4863, -4841, 
-        -4818, -4796, -4774, -4751, -4729, -4706, -4684, -4663, -4640, -4618, -4596, -4574, 
-        -4553, -4532, -4511, -4489, -4467, -4446, -4425, -4403, -4382, -4361, -4341, -4320, 
-        -4299, -4279, -4258, -4238, -4217, -4197, -4177, -4158, -4138, -4117, -4097, -4077, 
-        -4057, -4037, -4018, -3999, -3979, -3959, -3941, -3921, -3901, -3883, -3864, -3844, 
-        -3826, -3807, -3788, -3769, -3751, -3732, -3714, -3695, -3677, -3659, -3641, -3622, 
-        -3604, -3585, -3568, -3550, -3532, -3514, -3497, -3480, -3462, -3444, -3427, -3410, 
-        -3392, -3375, -3358, -3341, -3324, -3306, -3289, -3273, -3256, -3239, -3223, -3206, 
-        -3190, -3173, -3157, -3141, -3124, -3108, -3092, -3076, -3059, -3043, -3028, -3012, 
-        -2996, -2980, -2964, -2948, -2932, -2918, -2902, -2886, -2872, -2856, -2841, -2825, 
-        -2811, -2796, -2780, -2766, -2751, -2737, -2722, -2708, -2692, -2677, -2664, -2650, 
-        -2635, -2620, -2606, -2591, -2578, -2564, -2549, -2536, -2521, -2508, -2494, -2480, 
-        -2466, -2453, -2439, -2425, -2412, -2398, -2385, -2372, -2359, -2346, -2332, -2319, 
-        -2306, -2293, -2279, -2266, -2253, -2240, -2228, -2215, -2203, -2190, -2178, -2164, 
-        -2153, -2139, -2127, -2116, -2105, -2092, -2080, -2068, -2056, -2043, -2031, -2019, 
-        -2007, -1995, -1983, -1972, -1960, -1949, -1937, -1925, -1913, -1901, -1891, -1879, 
-        -1868, -1857, -1846, -1834, -1823, -1812, -1801, -1790, -1779, -1768, -1757, -1747, 
-        -1735, -1724, -1714, -1703, -1693, -1682, -1671, -1661, -1650, -1640, -1629, -1619, 
-        -1608, -1599, -1588, -1578, -1567, -1558, -1547, -1537, -1527, -1517, -1508, -1497, 
-        -1488, -1477, -1468, -1459, -1448, -1439, -1430, -1420, -1410, -1401, -1391, -1382, 
-        -1373, -1364, -1354, -1345, -1336, -1327, -1317, -1308, -1299, -1289, -1282, -1272, 
-        -1263, -1254, -1246, -1237, -1229, -1219, -1210, -1202, -1193, -1185, -1176, -1168, 
-        -1160, -1151, -1143, -1134, -1126, -1118, -1110, -1102, -1093, -1085, -1077, -1069, 
-        -1061, -1053, -1044, -1036, -1028, -1020, -1013, -1005, -997, -989, -982, -974, 
-        -966, -959, -951, -943, -935, -927, -921, -913, -905, -898, -890, -884, 
-        -876, -869, -861, -855, -847, -840, -834, -826, -819, -811, -804, -798, 
-        -791, -785, -777, -770, -763, -757, -750, -744, -737, -730, -724, -717, 
-        -711, -704, -697, -691, -684, -678, -672, -666, -659, -652, -646, -641, 
-        -634, -627, -622, -615, -609, -604, -597, -592, -585, -580, -573, -567, 
-        -561, -556, -549, -543, -537, -532, -527, -520, -515, -508, -503, -496, 
-        -491, -486, -481, -475, -469, -463, -458, -453, -448, -442, -436, -430, 
-        -424, -420, -415, -409, -404, -397, -393, -388, -384, -378, -372, -366, 
-        -360, -358, -352, -348, -341, -335, -331, -327, -325, -318, -314, -307, 
-        -302, -300, -297, -294, -286, -282, -276, -276, -276, -280, -272, -278 
-    };
-
-    // AKWF_squ_0044 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0044[600] PROGMEM = {
-        1064, 8333, 21311, 30826, 32767, 32171, 32014, 31883, 31718, 31558, 31399, 31242, 
-        31091, 30941, 30785, 30633, 30474, 30324, 30172, 30026, 29876, 29724, 29574, 29422, 
-        29279, 29133, 28988, 28841, 28692, 28548, 28402, 28263, 28120, 27978, 27832, 27688, 
-        27550, 27411, 27276, 27132, 26995, 26854, 26716, 26582, 26447, 26316, 26174, 26039, 
-        25904, 25774, 25667, 25380, 21919, 11368, -1453, -7613, -7886, -7554, -7579, -7528, 
-        -7495, -7461, -7435, -7402, -7372, -7337, -7303, -7273, -7243, -7215, -7183, -7152, 
-        -7119, -7089, -7060, -7030, -7001, -6970, -6941, -6911, -6882, -6854, -6824, -6795, 
-        -6765, -6737, -6707, -6680, -6652, -6623, -6596, -6565, -6539, -6510, -6484, -6456, 
-        -6428, -6400, -6372, -6345, -6319, -6291, -6263, -6237, -6211, -6183, -6157, -6131, 
-        -6105, -6078, -6052, -6026, -6000, -5975, -5948, -5922, -5896, -5871, -5846, -5820, 
-        -5795, -5768, -5744, -5719, -5694, -5670, -5644, -5620, -5595, -5570, -5545, -5522, 
-        -5498, -5473, -5448, -5425, -5401, -5377, -5354, -5330, -5306, -5283, -5259, -5235, 
-        -5213, -5189, -5166, -5142, -5120, -5098, -5074, -5052, -5029, -5006, -4983, -4961, 
-        -4939, -4916, -4895, -4873, -4851, -4828, -4807, -4785, -4764, -4742, -4721, -4700, 
-        -4679, -4656, -4635, -4614, -4593, -4572, -4551, -4530, -4511, -4490, -4469, -4449, 
-        -4428, -4408, -4389, -4368, -4348, -4327, -4307, -4288, -4268, -4248, -4228, -4209, 
-        -4189, -4171, -4151, -4131, -4112, -4093, -4074, -4055, -4035, -4017, -3999, -3979, 
-        -3961, -3942, -3924, -3904, -3886, -3869, -3850, -3832, -3814, -3795, -3778, -3760, 
-        -3741, -3724, -3706, -3688, -3670, -3653, -3636, -3619, -3602, -3584, -3567, -3550, 
-        -3533, -3516, -3498, -3481, -3464, -3447, -3431, -3414, -3397, -3382, -3365, -3349, 
-        -3332, -3316, -3299, -3283, -3267, -3252, -3236, -3219, -3203, -3187, -3172, -3156, 
-        -3140, -3124, -3110, -3094, -3078, -3064, -3048, -3034, -3018, -3003, -2988, -2973, 
-        -2958, -2943, -2929, -2913, -2898, -2884, -2870, -2855, -2841, -2826, -2812, -2797, 
-        -2783, -2768, -2755, -2741, -2726, -2712, -2699, -2684, -2671, -2657, -2644, -2629, 
-        -2616, -2603, -2589, -2575, -2562, -2549, -2536, -2522, -2509, -2495, -2482, -2469, 
-        -2456, -2443, -2430, -2417, -2403, -2392, -2379, -2365, -2352, -2340, -2327, -2316, 
-        -2302, -2291, -2277, -2266, -2254, -2241, -2229, -2217, -2205, -2193, -2180, -2168, 
-        -2157, -2145, -2133, -2121, -2111, -2099, -2087, -2077, -2065, -2053, -2041, -2031, 
-        -2019, -2008, -1996, -1985, -1974, -1962, -1952, -1940, -1930, -1919, -1907, -1897, 
-        -1886, -1876, -1865, -1855, -1844, -1834, -1823, -1813, -1802, -1792, -1781, -1772, 
-        -1761, -1751, -1740, -1730, -1719, -1710, -1700, -1689, -1680, -1670, -1660, -1650, 
-        -1639, -1630, -1621, -1610, -1601, -1591, -1582, -1572, -1563, -1554, -1544, -1534, 
-        -1525, -1516, -1507, -1498, -1488, -1479, -1470, -1461, -1452, -1442, -1433, -1425, 
-        -1416, -1407, -1398, -1389, -1381, -1372, -1362, -1354, -1347, -1337, -1328, -1320, 
-        -1311, -1303, -1294, -1286, -1278, -1269, -1261, -1253, -1244, -1236, -1228, -1219, 
-        -1211, -1203, -1196, -1188, -1180, -1172, -1163, -1156, -1148, -1140, -1133, -1125, 
-        -1117, -1109, -1101, -1094, -1087, -1079, -1071, -1064, -1056, -1049, -1042, -1034, 
-        -1026, -1020, -1012, -1005, -997, -991, -983, -976, -968, -962, -955, -947, 
-        -941, -933, -926, -920, -913, -907, -900, -892, -886, -879, -873, -866, 
-        -859, -853, -846, -838, -833, -827, -820, -814, -807, -800, -794, -787, 
-        -782, -775, -769, -762, -756, -750, -744, -739, -732, -726, -720, -714, 
-        -708, -702, -695, -690, -684, -678, -673, -666, -661, -655, -649, -643, 
-        -638, -632, -627, -621, -615, -609, -603, -598, -593, -586, -581, -576, 
-        -571, -565, -560, -555, -550, -544, -539, -534, -529, -523, -518, -513, 
-        -508, -502, -497, -492, -487, -483, -477, -472, -467, -463, -458, -452, 
-        -447, -443, -438, -434, -429, -424, -420, -414, -410, -407, -401, -396, 
-        -392, -387, -383, -378, -374, -368, -364, -361, -357, -353, -346, -342, 
-        -337, -334, -330, -325, -321, -316, -312, -307, -304, -300, -295, -290, 
-        -284, -282, -278, -274, -270, -263, -259, -254, -252, -248, -244, -238, 
-        -232, -229, -224, -224, -217, -212, -200, -195, -195, -196, -179, -196 
-    };
-
-    // AKWF_squ_0045 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0045[600] PROGMEM = {
-        243, 4774, 16329, 28252, 32767, 32493, 32145, 32040, 31869, 31718, 31565, 31414, 
-        31252, 31095, 30936, 30789, 30637, 30486, 30333, 30177, 30028, 29876, 29731, 29581, 
-        29433, 29282, 29131, 28989, 28841, 28701, 28553, 28409, 28261, 28118, 27978, 27838, 
-        27699, 27552, 27411, 27270, 27134, 27023, 26730, 23256, 12676, -177, -6356, -6636, 
-        -6307, -6337, -6293, -6264, -6236, -6214, -6187, -6162, -6132, -6104, -6079, -6054, 
-        -6031, -6003, -5978, -5951, -5926, -5902, -5877, -5852, -5826, -5802, -5776, -5752, 
-        -5728, -5704, -5681, -5656, -5632, -5607, -5583, -5561, -5537, -5514, -5489, -5466, 
-        -5443, -5420, -5398, -5374, -5351, -5327, -5304, -5282, -5260, -5237, -5215, -5193, 
-        -5170, -5149, -5127, -5104, -5082, -5060, -5039, -5018, -4995, -4974, -4952, -4931, 
-        -4910, -4889, -4868, -4847, -4826, -4803, -4782, -4762, -4741, -4720, -4701, -4680, 
-        -4658, -4639, -4618, -4598, -4578, -4558, -4537, -4518, -4498, -4478, -4458, -4439, 
-        -4419, -4399, -4381, -4361, -4341, -4322, -4303, -4283, -4265, -4245, -4227, -4208, 
-        -4189, -4170, -4152, -4133, -4115, -4097, -4078, -4060, -4041, -4023, -4005, -3986, 
-        -3969, -3951, -3934, -3915, -3898, -3880, -3862, -3845, -3827, -3810, -3793, -3776, 
-        -3759, -3741, -3724, -3707, -3690, -3673, -3657, -3640, -3623, -3607, -3590, -3573, 
-        -3557, -3541, -3524, -3509, -3493, -3476, -3460, -3444, -3427, -3411, -3397, -3381, 
-        -3365, -3348, -3332, -3318, -3302, -3286, -3270, -3256, -3240, -3226, -3210, -3195, 
-        -3180, -3165, -3149, -3135, -3120, -3105, -3090, -3076, -3061, -3047, -3032, -3018, 
-        -3003, -2989, -2974, -2960, -2945, -2932, -2918, -2905, -2890, -2876, -2861, -2848, 
-        -2834, -2820, -2807, -2793, -2780, -2766, -2752, -2739, -2726, -2713, -2699, -2686, 
-        -2673, -2660, -2647, -2634, -2620, -2607, -2594, -2582, -2569, -2556, -2544, -2531, 
-        -2519, -2506, -2494, -2481, -2469, -2456, -2444, -2432, -2419, -2407, -2395, -2384, 
-        -2372, -2359, -2347, -2335, -2323, -2311, -2299, -2288, -2276, -2265, -2253, -2243, 
-        -2231, -2219, -2207, -2195, -2185, -2173, -2161, -2151, -2140, -2128, -2118, -2106, 
-        -2095, -2084, -2073, -2063, -2052, -2041, -2031, -2020, -2010, -1998, -1988, -1977, 
-        -1967, -1956, -1945, -1934, -1923, -1914, -1903, -1893, -1882, -1873, -1863, -1852, 
-        -1843, -1832, -1823, -1813, -1803, -1793, -1784, -1773, -1764, -1755, -1745, -1735, 
-        -1726, -1717, -1707, -1697, -1688, -1678, -1669, -1660, -1651, -1642, -1632, -1623, 
-        -1614, -1605, -1595, -1586, -1577, -1569, -1560, -1551, -1543, -1534, -1526, -1517, 
-        -1509, -1499, -1492, -1482, -1474, -1465, -1457, -1448, -1440, -1431, -1423, -1414, 
-        -1406, -1398, -1390, -1381, -1373, -1365, -1357, -1349, -1340, -1332, -1324, -1318, 
-        -1310, -1301, -1293, -1285, -1277, -1269, -1261, -1255, -1247, -1239, -1231, -1223, 
-        -1217, -1209, -1202, -1194, -1186, -1180, -1172, -1165, -1157, -1149, -1143, -1136, 
-        -1128, -1122, -1114, -1106, -1099, -1093, -1086, -1078, -1072, -1065, -1059, -1052, 
-        -1044, -1038, -1030, -1023, -1017, -1010, -1003, -997, -990, -984, -977, -971, 
-        -964, -957, -951, -946, -939, -932, -926, -919, -913, -906, -901, -894, 
-        -888, -881, -874, -869, -863, -856, -851, -844, -839, -832, -827, -821, 
-        -815, -810, -803, -798, -792, -785, -780, -774, -769, -763, -757, -752, 
-        -746, -740, -735, -728, -723, -718, -713, -707, -702, -697, -690, -685, 
-        -680, -674, -669, -664, -659, -653, -648, -643, -638, -634, -628, -623, 
-        -618, -613, -607, -602, -598, -593, -588, -582, -578, -573, -568, -563, 
-        -559, -553, -549, -544, -539, -534, -530, -524, -521, -515, -511, -506, 
-        -502, -497, -492, -488, -484, -478, -474, -469, -465, -461, -457, -452, 
-        -448, -444, -439, -435, -431, -427, -422, -418, -414, -410, -406, -402, 
-        -398, -393, -389, -385, -381, -377, -373, -369, -365, -361, -357, -353, 
-        -349, -346, -342, -338, -334, -331, -327, -323, -319, -315, -311, -309, 
-        -305, -301, -297, -293, -290, -286, -282, -278, -274, -272, -268, -264, 
-        -261, -257, -253, -249, -246, -243, -240, -236, -232, -228, -224, -222, 
-        -219, -215, -211, -206, -203, -201, -198, -194, -190, -185, -181, -180, 
-        -177, -176, -169, -165, -161, -159, -159, -155, -152, -142, -132, -151 
-    };
-
-    // AKWF_squ_0046 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0046[600] PROGMEM = {
-        1629, 9677, 22713, 31383, 32767, 32159, 32008, 31855, 31694, 31544, 31392, 31227, 
-        31066, 30909, 30756, 30608, 30452, 30300, 30142, 29990, 29838, 29693, 29546, 29392, 
-        29241, 29087, 28944, 28797, 28656, 28508, 28354, 28204, 28012, 25377, 15906, 2801, 
-        -4563, -5323, -4928, -4970, -4955, -4938, -4916, -4895, -4872, -4855, -4838, -4818, 
-        -4800, -4776, -4758, -4737, -4720, -4701, -4680, -4661, -4640, -4622, -4603, -4585, 
-        -4565, -4546, -4527, -4508, -4489, -4470, -4453, -4433, -4413, -4395, -4377, -4358, 
-        -4340, -4322, -4303, -4285, -4267, -4248, -4231, -4213, -4195, -4176, -4159, -4141, 
-        -4123, -4106, -4087, -4070, -4053, -4035, -4018, -4001, -3984, -3967, -3949, -3932, 
-        -3915, -3898, -3881, -3865, -3848, -3831, -3815, -3798, -3781, -3765, -3748, -3733, 
-        -3717, -3700, -3684, -3667, -3652, -3636, -3620, -3604, -3589, -3573, -3557, -3542, 
-        -3526, -3510, -3496, -3480, -3464, -3449, -3433, -3419, -3403, -3388, -3373, -3358, 
-        -3344, -3328, -3314, -3299, -3285, -3271, -3255, -3241, -3226, -3212, -3197, -3184, 
-        -3170, -3155, -3141, -3127, -3114, -3099, -3085, -3070, -3057, -3043, -3030, -3015, 
-        -3002, -2989, -2975, -2962, -2947, -2934, -2921, -2908, -2895, -2882, -2869, -2856, 
-        -2843, -2830, -2816, -2803, -2790, -2777, -2764, -2751, -2739, -2726, -2714, -2701, 
-        -2689, -2676, -2663, -2652, -2640, -2627, -2615, -2602, -2590, -2578, -2566, -2555, 
-        -2542, -2530, -2518, -2506, -2494, -2483, -2471, -2459, -2449, -2437, -2425, -2413, 
-        -2402, -2391, -2379, -2369, -2357, -2347, -2335, -2323, -2312, -2301, -2290, -2278, 
-        -2268, -2258, -2247, -2235, -2225, -2214, -2204, -2193, -2183, -2171, -2161, -2150, 
-        -2140, -2129, -2119, -2108, -2099, -2089, -2078, -2068, -2057, -2048, -2038, -2027, 
-        -2017, -2007, -1997, -1988, -1979, -1968, -1958, -1949, -1938, -1929, -1920, -1909, 
-        -1900, -1890, -1881, -1871, -1862, -1853, -1844, -1835, -1826, -1815, -1806, -1797, 
-        -1789, -1780, -1771, -1760, -1752, -1743, -1734, -1725, -1716, -1708, -1699, -1689, 
-        -1682, -1672, -1663, -1655, -1646, -1638, -1629, -1621, -1613, -1604, -1596, -1587, 
-        -1579, -1570, -1562, -1555, -1545, -1538, -1530, -1522, -1514, -1505, -1497, -1489, 
-        -1481, -1473, -1464, -1456, -1449, -1441, -1433, -1425, -1417, -1409, -1403, -1395, 
-        -1387, -1379, -1371, -1363, -1357, -1349, -1343, -1335, -1327, -1320, -1312, -1305, 
-        -1298, -1290, -1282, -1276, -1269, -1261, -1255, -1248, -1242, -1234, -1227, -1221, 
-        -1214, -1208, -1201, -1193, -1187, -1180, -1172, -1166, -1159, -1153, -1146, -1140, 
-        -1133, -1127, -1120, -1113, -1107, -1100, -1094, -1089, -1082, -1075, -1069, -1062, 
-        -1056, -1049, -1044, -1038, -1031, -1024, -1019, -1013, -1006, -1001, -994, -989, 
-        -983, -976, -971, -964, -959, -952, -947, -941, -935, -929, -924, -917, 
-        -912, -907, -900, -895, -890, -884, -878, -873, -867, -861, -856, -850, 
-        -845, -840, -835, -828, -823, -818, -812, -807, -802, -797, -791, -786, 
-        -781, -776, -770, -765, -760, -755, -751, -746, -740, -735, -730, -726, 
-        -721, -716, -710, -705, -701, -696, -692, -687, -681, -678, -672, -667, 
-        -663, -658, -654, -649, -645, -640, -636, -630, -627, -621, -617, -612, 
-        -608, -603, -599, -595, -590, -586, -582, -577, -573, -568, -564, -560, 
-        -556, -551, -547, -543, -539, -534, -530, -526, -522, -518, -514, -509, 
-        -505, -502, -497, -493, -489, -485, -481, -477, -473, -469, -466, -462, 
-        -458, -454, -450, -447, -443, -439, -435, -431, -428, -424, -421, -417, 
-        -413, -409, -407, -403, -399, -395, -392, -388, -384, -380, -378, -374, 
-        -370, -367, -363, -361, -357, -354, -350, -346, -344, -340, -337, -333, 
-        -331, -327, -324, -320, -318, -314, -310, -307, -304, -301, -298, -294, 
-        -291, -287, -285, -282, -280, -276, -273, -270, -267, -264, -260, -257, 
-        -255, -251, -248, -246, -243, -240, -236, -234, -231, -229, -226, -222, 
-        -219, -217, -214, -212, -209, -206, -204, -201, -198, -196, -193, -191, 
-        -188, -185, -183, -180, -178, -175, -174, -170, -167, -164, -163, -162, 
-        -158, -155, -153, -150, -149, -147, -146, -141, -138, -136, -136, -133, 
-        -132, -129, -124, -123, -119, -121, -117, -115, -107, -106, -99, -146 
-    };
-
-    // AKWF_squ_0047 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0047[600] PROGMEM = {
-        443, 5673, 17747, 29081, 32767, 32324, 32042, 31932, 31757, 31592, 31430, 31274, 
-        31123, 30972, 30810, 30653, 30491, 30342, 30190, 30043, 29891, 29730, 29574, 29376, 
-        26738, 17273, 4175, -3186, -3952, -3563, -3610, -3601, -3590, -3573, -3557, -3540, 
-        -3529, -3517, -3503, -3489, -3472, -3459, -3444, -3432, -3419, -3404, -3390, -3374, 
-        -3361, -3347, -3335, -3321, -3306, -3292, -3278, -3266, -3251, -3238, -3224, -3210, 
-        -3197, -3183, -3170, -3157, -3144, -3130, -3117, -3104, -3091, -3078, -3064, -3051, 
-        -3038, -3025, -3012, -2999, -2987, -2974, -2961, -2949, -2936, -2925, -2911, -2898, 
-        -2885, -2874, -2860, -2849, -2837, -2824, -2812, -2800, -2789, -2775, -2764, -2752, 
-        -2740, -2728, -2717, -2705, -2693, -2681, -2670, -2658, -2646, -2634, -2624, -2612, 
-        -2600, -2589, -2578, -2566, -2556, -2544, -2534, -2522, -2511, -2500, -2489, -2477, 
-        -2467, -2455, -2445, -2434, -2424, -2413, -2402, -2391, -2381, -2370, -2360, -2349, 
-        -2339, -2328, -2318, -2307, -2297, -2288, -2277, -2267, -2256, -2246, -2237, -2226, 
-        -2217, -2207, -2196, -2187, -2177, -2166, -2157, -2147, -2137, -2128, -2118, -2109, 
-        -2099, -2090, -2080, -2071, -2062, -2051, -2042, -2033, -2024, -2014, -2004, -1995, 
-        -1987, -1978, -1969, -1960, -1950, -1941, -1932, -1923, -1914, -1906, -1897, -1888, 
-        -1878, -1871, -1861, -1852, -1844, -1835, -1828, -1818, -1809, -1801, -1794, -1784, 
-        -1777, -1767, -1760, -1752, -1743, -1735, -1727, -1719, -1710, -1702, -1694, -1686, 
-        -1678, -1669, -1661, -1654, -1646, -1638, -1630, -1622, -1614, -1608, -1600, -1592, 
-        -1584, -1576, -1569, -1561, -1553, -1546, -1539, -1531, -1524, -1516, -1508, -1501, 
-        -1494, -1486, -1478, -1472, -1464, -1457, -1451, -1443, -1437, -1429, -1422, -1414, 
-        -1408, -1401, -1393, -1387, -1380, -1372, -1366, -1359, -1353, -1346, -1338, -1332, 
-        -1325, -1319, -1312, -1306, -1299, -1293, -1286, -1280, -1273, -1267, -1260, -1253, 
-        -1247, -1240, -1234, -1227, -1222, -1216, -1209, -1202, -1196, -1191, -1184, -1179, 
-        -1172, -1166, -1161, -1154, -1148, -1142, -1136, -1129, -1124, -1117, -1112, -1107, 
-        -1100, -1095, -1089, -1082, -1077, -1072, -1065, -1060, -1055, -1048, -1043, -1038, 
-        -1031, -1026, -1021, -1014, -1009, -1002, -997, -992, -987, -981, -976, -970, 
-        -964, -959, -954, -949, -944, -938, -933, -928, -923, -917, -914, -908, 
-        -903, -898, -894, -889, -883, -878, -874, -869, -864, -859, -855, -849, 
-        -846, -840, -835, -830, -826, -821, -815, -810, -806, -801, -797, -792, 
-        -788, -783, -779, -774, -770, -764, -761, -755, -751, -747, -742, -738, 
-        -733, -729, -725, -720, -716, -712, -708, -703, -699, -694, -690, -686, 
-        -682, -678, -673, -669, -665, -661, -657, -653, -648, -644, -640, -636, 
-        -632, -628, -625, -621, -617, -613, -609, -605, -601, -597, -593, -589, 
-        -585, -581, -577, -575, -571, -567, -563, -559, -555, -553, -549, -545, 
-        -541, -537, -533, -530, -526, -523, -520, -516, -512, -508, -506, -502, 
-        -499, -495, -491, -489, -485, -482, -478, -475, -472, -468, -465, -461, 
-        -458, -455, -452, -448, -445, -441, -439, -435, -432, -428, -426, -422, 
-        -419, -417, -413, -410, -406, -404, -401, -397, -394, -392, -389, -385, 
-        -383, -380, -376, -373, -371, -367, -364, -362, -359, -356, -354, -351, 
-        -349, -345, -342, -339, -337, -334, -332, -328, -325, -322, -320, -317, 
-        -315, -312, -309, -307, -304, -302, -299, -296, -294, -291, -288, -286, 
-        -283, -281, -278, -275, -273, -270, -269, -266, -264, -261, -258, -256, 
-        -253, -251, -248, -247, -244, -241, -239, -236, -235, -232, -230, -227, 
-        -224, -223, -220, -218, -215, -214, -211, -209, -206, -205, -202, -200, 
-        -198, -196, -193, -192, -189, -186, -185, -183, -181, -179, -176, -173, 
-        -172, -169, -168, -166, -164, -162, -160, -158, -156, -155, -152, -150, 
-        -149, -146, -145, -142, -141, -138, -137, -135, -133, -132, -129, -128, 
-        -125, -124, -122, -120, -118, -116, -115, -113, -112, -111, -108, -107, 
-        -104, -104, -101, -100, -99, -95, -94, -92, -91, -90, -87, -86, 
-        -82, -82, -79, -81, -77, -73, -67, -65, -67, -66, -56, -67 
-    };
-
-    // AKWF_squ_0048 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0048[600] PROGMEM = {
-        2069, 10724, 23758, 31755, 32767, 32204, 32087, 31931, 31763, 31604, 31455, 31302, 
-        31151, 30988, 30830, 30676, 30525, 30402, 30095, 26619, 16060, 3236, -2935, -3228, 
-        -2913, -2959, -2929, -2914, -2900, -2892, -2879, -2867, -2853, -2838, -2828, -2816, 
-        -2807, -2792, -2781, -2767, -2756, -2745, -2733, -2723, -2710, -2698, -2686, -2676, 
-        -2665, -2653, -2643, -2631, -2619, -2609, -2598, -2588, -2576, -2566, -2554, -2543, 
-        -2533, -2522, -2512, -2501, -2491, -2479, -2468, -2459, -2449, -2438, -2427, -2417, 
-        -2407, -2398, -2387, -2377, -2366, -2356, -2347, -2336, -2327, -2316, -2307, -2297, 
-        -2286, -2277, -2268, -2257, -2248, -2238, -2229, -2218, -2209, -2200, -2191, -2180, 
-        -2171, -2162, -2152, -2143, -2134, -2125, -2116, -2107, -2096, -2087, -2079, -2070, 
-        -2061, -2052, -2042, -2033, -2024, -2015, -2007, -1998, -1989, -1981, -1972, -1962, 
-        -1954, -1945, -1936, -1928, -1919, -1911, -1902, -1894, -1885, -1877, -1869, -1860, 
-        -1852, -1844, -1835, -1827, -1819, -1812, -1804, -1795, -1787, -1779, -1771, -1763, 
-        -1755, -1747, -1739, -1732, -1724, -1716, -1708, -1700, -1692, -1686, -1678, -1670, 
-        -1662, -1654, -1646, -1640, -1632, -1624, -1618, -1610, -1602, -1595, -1587, -1579, 
-        -1573, -1565, -1559, -1551, -1544, -1536, -1530, -1522, -1515, -1509, -1501, -1494, 
-        -1488, -1481, -1473, -1467, -1460, -1452, -1446, -1439, -1433, -1426, -1420, -1413, 
-        -1406, -1399, -1392, -1385, -1379, -1372, -1366, -1361, -1354, -1347, -1341, -1334, 
-        -1328, -1321, -1315, -1309, -1303, -1296, -1290, -1283, -1278, -1271, -1265, -1260, 
-        -1253, -1246, -1241, -1235, -1228, -1223, -1218, -1211, -1206, -1199, -1194, -1187, 
-        -1182, -1176, -1170, -1164, -1159, -1153, -1147, -1142, -1136, -1130, -1125, -1119, 
-        -1113, -1107, -1102, -1097, -1092, -1086, -1080, -1075, -1069, -1064, -1059, -1054, 
-        -1048, -1043, -1038, -1033, -1027, -1022, -1017, -1012, -1006, -1001, -996, -991, 
-        -986, -980, -975, -971, -966, -961, -955, -950, -946, -941, -936, -932, 
-        -927, -921, -916, -911, -907, -902, -898, -892, -888, -883, -878, -874, 
-        -869, -865, -860, -856, -850, -847, -841, -837, -833, -828, -824, -819, 
-        -815, -810, -805, -801, -797, -791, -788, -784, -778, -774, -770, -765, 
-        -761, -757, -753, -750, -744, -740, -736, -732, -730, -726, -722, -718, 
-        -714, -710, -706, -701, -697, -693, -691, -687, -681, -677, -673, -670, 
-        -666, -662, -659, -655, -651, -647, -643, -639, -635, -631, -629, -625, 
-        -621, -618, -614, -611, -607, -603, -599, -596, -592, -590, -586, -582, 
-        -578, -575, -571, -567, -565, -561, -558, -554, -550, -548, -544, -541, 
-        -538, -534, -531, -528, -524, -521, -517, -515, -511, -508, -504, -502, 
-        -498, -495, -493, -489, -486, -482, -479, -477, -473, -470, -468, -464, 
-        -461, -458, -456, -452, -449, -447, -443, -440, -437, -435, -431, -428, 
-        -426, -423, -420, -416, -414, -411, -409, -406, -403, -399, -397, -394, 
-        -392, -389, -386, -384, -381, -378, -376, -373, -371, -368, -365, -363, 
-        -360, -357, -355, -352, -350, -347, -344, -342, -339, -336, -334, -331, 
-        -329, -326, -325, -322, -319, -317, -314, -312, -310, -308, -305, -302, 
-        -300, -297, -296, -293, -291, -288, -287, -284, -281, -279, -277, -275, 
-        -272, -270, -268, -266, -263, -262, -259, -258, -255, -253, -250, -247, 
-        -246, -243, -242, -239, -238, -236, -233, -232, -229, -228, -225, -224, 
-        -221, -220, -217, -216, -213, -211, -209, -207, -205, -204, -201, -200, 
-        -197, -195, -194, -191, -190, -188, -186, -184, -183, -180, -179, -177, 
-        -175, -174, -171, -170, -169, -166, -165, -162, -161, -159, -158, -156, 
-        -154, -153, -150, -149, -148, -145, -144, -142, -140, -138, -137, -136, 
-        -135, -132, -131, -128, -127, -125, -124, -123, -120, -119, -116, -116, 
-        -114, -112, -111, -108, -108, -106, -106, -103, -102, -100, -98, -97, 
-        -95, -94, -93, -91, -90, -89, -87, -86, -85, -82, -81, -79, 
-        -78, -78, -76, -76, -73, -73, -72, -70, -70, -68, -66, -65, 
-        -65, -65, -65, -64, -60, -60, -61, -68, -68, -68, -56, -98 
-    };
-
-} // namespace AKWF_BwSqu
@@ -1,1304 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwSqu {
-
-    // AKWF_squ_0049 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0049[600] PROGMEM = {
-        201, 3942, 14818, 27309, 32767, 32702, 32286, 32200, 32033, 31868, 31704, 31546, 
-        31392, 31265, 30955, 27462, 16857, 3975, -2223, -2519, -2206, -2256, -2228, -2218, 
-        -2206, -2199, -2190, -2182, -2170, -2159, -2151, -2141, -2135, -2124, -2115, -2105, 
-        -2095, -2087, -2078, -2070, -2061, -2052, -2043, -2035, -2027, -2019, -2010, -2001, 
-        -1993, -1985, -1977, -1969, -1960, -1952, -1943, -1935, -1927, -1919, -1911, -1902, 
-        -1894, -1886, -1878, -1870, -1862, -1854, -1847, -1839, -1831, -1824, -1816, -1808, 
-        -1800, -1793, -1785, -1778, -1770, -1762, -1754, -1748, -1740, -1732, -1725, -1718, 
-        -1710, -1703, -1695, -1689, -1681, -1673, -1666, -1660, -1652, -1645, -1637, -1631, 
-        -1624, -1616, -1610, -1602, -1595, -1589, -1582, -1575, -1567, -1561, -1554, -1548, 
-        -1540, -1533, -1527, -1520, -1513, -1507, -1500, -1494, -1487, -1481, -1473, -1467, 
-        -1461, -1454, -1448, -1441, -1435, -1429, -1423, -1416, -1409, -1403, -1398, -1391, 
-        -1384, -1379, -1373, -1366, -1359, -1354, -1348, -1342, -1336, -1329, -1324, -1317, 
-        -1312, -1307, -1300, -1295, -1288, -1283, -1277, -1271, -1265, -1259, -1254, -1248, 
-        -1242, -1237, -1230, -1225, -1220, -1215, -1208, -1203, -1198, -1192, -1187, -1182, 
-        -1175, -1170, -1165, -1159, -1154, -1149, -1144, -1137, -1133, -1128, -1122, -1117, 
-        -1111, -1105, -1100, -1096, -1091, -1086, -1082, -1076, -1071, -1066, -1061, -1055, 
-        -1050, -1046, -1041, -1036, -1032, -1026, -1021, -1016, -1012, -1007, -1001, -997, 
-        -992, -987, -983, -978, -974, -968, -963, -959, -954, -950, -945, -941, 
-        -936, -932, -928, -922, -918, -914, -909, -905, -900, -896, -892, -887, 
-        -883, -878, -874, -870, -866, -861, -857, -853, -849, -845, -839, -835, 
-        -832, -828, -824, -820, -816, -812, -808, -803, -799, -795, -791, -787, 
-        -783, -779, -775, -771, -767, -763, -759, -755, -751, -747, -743, -739, 
-        -737, -733, -729, -725, -721, -717, -713, -710, -706, -703, -699, -695, 
-        -691, -688, -684, -680, -678, -674, -670, -667, -663, -659, -655, -652, 
-        -649, -645, -642, -638, -635, -631, -629, -625, -622, -618, -614, -612, 
-        -609, -605, -601, -597, -593, -591, -587, -584, -580, -577, -575, -571, 
-        -568, -566, -562, -559, -556, -554, -551, -547, -545, -542, -538, -535, 
-        -533, -529, -526, -523, -521, -517, -514, -512, -508, -505, -502, -500, 
-        -497, -495, -491, -488, -485, -483, -480, -477, -475, -472, -469, -466, 
-        -463, -460, -458, -455, -452, -450, -447, -444, -442, -439, -437, -434, 
-        -431, -429, -426, -423, -421, -418, -416, -413, -410, -409, -406, -404, 
-        -401, -398, -396, -393, -391, -388, -387, -384, -381, -379, -376, -373, 
-        -371, -368, -367, -364, -362, -359, -358, -355, -352, -351, -348, -346, 
-        -343, -342, -339, -337, -334, -333, -330, -327, -326, -323, -321, -319, 
-        -317, -314, -313, -310, -309, -306, -304, -302, -300, -298, -296, -293, 
-        -292, -289, -288, -285, -284, -281, -280, -277, -276, -273, -272, -269, 
-        -268, -265, -264, -261, -260, -258, -256, -254, -252, -250, -248, -247, 
-        -244, -243, -240, -239, -238, -235, -234, -233, -230, -229, -226, -225, 
-        -223, -221, -219, -217, -215, -214, -213, -211, -209, -208, -206, -204, 
-        -202, -201, -200, -197, -196, -194, -192, -190, -189, -188, -185, -184, 
-        -182, -181, -180, -177, -176, -175, -173, -172, -171, -169, -167, -165, 
-        -164, -163, -160, -159, -157, -156, -155, -154, -152, -151, -148, -147, 
-        -146, -146, -143, -142, -140, -139, -138, -136, -135, -134, -132, -131, 
-        -130, -129, -127, -126, -125, -123, -122, -121, -119, -118, -117, -115, 
-        -114, -113, -111, -110, -109, -107, -106, -105, -104, -102, -101, -100, 
-        -98, -97, -96, -96, -93, -92, -90, -90, -89, -88, -86, -85, 
-        -84, -82, -81, -80, -78, -78, -76, -76, -75, -73, -72, -71, 
-        -71, -69, -68, -67, -67, -64, -64, -63, -61, -61, -60, -59, 
-        -57, -57, -56, -56, -55, -53, -52, -51, -51, -51, -50, -50, 
-        -47, -47, -47, -48, -50, -46, -44, -42, -46, -48, -53, -60 
-    };
-
-    // AKWF_squ_0050 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0050[600] PROGMEM = {
-        743, 6524, 18852, 29655, 32767, 32228, 31974, 31865, 31724, 31418, 27951, 17441, 
-        4673, -1469, -1766, -1458, -1511, -1488, -1480, -1472, -1468, -1462, -1455, -1449, 
-        -1441, -1434, -1429, -1424, -1417, -1411, -1404, -1398, -1392, -1386, -1381, -1374, 
-        -1369, -1362, -1357, -1352, -1347, -1340, -1335, -1330, -1323, -1318, -1313, -1306, 
-        -1301, -1296, -1291, -1286, -1280, -1275, -1269, -1263, -1258, -1253, -1248, -1243, 
-        -1237, -1232, -1227, -1222, -1216, -1211, -1206, -1201, -1196, -1190, -1185, -1181, 
-        -1176, -1171, -1166, -1160, -1156, -1151, -1146, -1141, -1136, -1132, -1126, -1121, 
-        -1116, -1112, -1107, -1102, -1098, -1093, -1087, -1083, -1078, -1074, -1069, -1065, 
-        -1060, -1056, -1051, -1046, -1042, -1036, -1033, -1029, -1023, -1019, -1014, -1010, 
-        -1005, -1001, -997, -992, -988, -983, -979, -975, -971, -966, -962, -958, 
-        -953, -949, -945, -941, -937, -933, -928, -924, -920, -916, -913, -907, 
-        -903, -899, -896, -892, -888, -884, -880, -876, -872, -868, -864, -860, 
-        -856, -853, -849, -845, -841, -837, -833, -829, -825, -821, -817, -815, 
-        -811, -807, -803, -799, -795, -793, -789, -785, -781, -777, -773, -770, 
-        -766, -764, -760, -756, -752, -749, -746, -742, -739, -735, -731, -729, 
-        -725, -722, -718, -716, -712, -708, -705, -701, -699, -695, -692, -688, 
-        -686, -682, -679, -675, -673, -669, -666, -662, -659, -657, -653, -650, 
-        -646, -644, -640, -637, -635, -631, -628, -626, -622, -619, -616, -613, 
-        -610, -607, -605, -602, -598, -596, -593, -590, -586, -584, -581, -579, 
-        -575, -572, -569, -567, -564, -562, -558, -555, -553, -550, -547, -545, 
-        -542, -539, -537, -534, -532, -528, -525, -523, -520, -517, -515, -512, 
-        -509, -507, -504, -502, -499, -498, -495, -493, -490, -487, -485, -482, 
-        -479, -477, -474, -472, -469, -466, -464, -461, -460, -457, -455, -453, 
-        -451, -448, -446, -443, -440, -438, -436, -434, -431, -429, -427, -425, 
-        -422, -421, -418, -416, -413, -412, -409, -406, -405, -403, -400, -399, 
-        -396, -393, -391, -388, -386, -384, -382, -379, -378, -375, -374, -371, 
-        -370, -369, -366, -365, -362, -361, -358, -356, -354, -353, -350, -348, 
-        -346, -344, -343, -340, -339, -336, -335, -332, -331, -328, -327, -326, 
-        -323, -322, -319, -318, -315, -314, -313, -310, -309, -306, -305, -303, 
-        -301, -299, -297, -296, -294, -292, -290, -289, -286, -285, -284, -281, 
-        -280, -279, -277, -275, -273, -272, -269, -268, -267, -264, -263, -262, 
-        -260, -259, -256, -255, -254, -251, -250, -249, -247, -246, -243, -242, 
-        -241, -239, -238, -237, -234, -233, -232, -230, -229, -228, -226, -224, 
-        -223, -221, -220, -219, -217, -216, -213, -212, -211, -209, -208, -207, 
-        -206, -204, -203, -202, -200, -199, -196, -195, -194, -193, -191, -190, 
-        -189, -187, -186, -185, -183, -182, -181, -179, -178, -177, -176, -174, 
-        -173, -172, -170, -169, -168, -166, -165, -164, -163, -161, -160, -160, 
-        -159, -157, -156, -155, -153, -152, -151, -149, -148, -147, -146, -146, 
-        -144, -143, -142, -140, -139, -138, -138, -136, -135, -134, -133, -131, 
-        -131, -130, -129, -127, -126, -125, -123, -122, -122, -121, -119, -118, 
-        -118, -117, -116, -114, -114, -113, -112, -110, -109, -108, -108, -106, 
-        -105, -105, -104, -103, -101, -100, -100, -99, -97, -96, -96, -95, 
-        -93, -93, -92, -91, -91, -89, -88, -88, -87, -86, -84, -84, 
-        -83, -83, -82, -80, -79, -79, -78, -76, -76, -75, -75, -74, 
-        -73, -73, -71, -70, -70, -69, -67, -67, -66, -65, -65, -63, 
-        -62, -62, -61, -61, -59, -58, -58, -57, -56, -56, -54, -54, 
-        -53, -52, -52, -50, -50, -50, -49, -49, -48, -46, -46, -45, 
-        -44, -44, -43, -43, -41, -41, -40, -40, -39, -39, -37, -37, 
-        -36, -36, -35, -35, -35, -33, -33, -32, -32, -32, -32, -32, 
-        -31, -30, -28, -30, -30, -31, -30, -27, -26, -30, -32, -74 
-    };
-
-    // AKWF_squ_0051 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0051[600] PROGMEM = {
-        1781, 9926, 22980, 31586, 32767, 28840, 18288, 5458, -726, -1023, -718, -774, 
-        -756, -752, -748, -745, -743, -739, -735, -731, -728, -724, -723, -719, 
-        -715, -713, -709, -706, -703, -701, -697, -694, -692, -689, -686, -684, 
-        -680, -677, -675, -672, -669, -667, -663, -660, -658, -655, -652, -650, 
-        -647, -645, -641, -638, -635, -633, -630, -627, -625, -622, -620, -617, 
-        -614, -612, -610, -606, -604, -603, -600, -597, -593, -592, -589, -587, 
-        -584, -582, -579, -576, -574, -571, -568, -567, -565, -562, -559, -557, 
-        -554, -553, -550, -547, -545, -544, -541, -538, -536, -533, -530, -529, 
-        -527, -524, -521, -520, -517, -515, -512, -511, -508, -506, -504, -502, 
-        -499, -498, -495, -492, -491, -488, -486, -485, -482, -479, -478, -475, 
-        -474, -471, -469, -466, -465, -464, -461, -458, -457, -454, -453, -450, 
-        -449, -447, -445, -443, -440, -439, -436, -435, -432, -431, -430, -427, 
-        -426, -423, -422, -419, -418, -415, -414, -411, -410, -409, -406, -405, 
-        -402, -401, -398, -397, -394, -393, -391, -389, -388, -386, -384, -382, 
-        -381, -378, -377, -374, -373, -372, -369, -368, -367, -365, -363, -361, 
-        -360, -359, -356, -355, -353, -351, -350, -348, -347, -344, -343, -342, 
-        -340, -338, -336, -335, -334, -332, -330, -329, -327, -326, -323, -322, 
-        -321, -319, -318, -315, -314, -313, -312, -310, -309, -308, -305, -304, 
-        -302, -301, -300, -298, -297, -296, -293, -292, -291, -289, -288, -287, 
-        -285, -284, -283, -281, -280, -279, -277, -276, -275, -273, -272, -271, 
-        -268, -267, -266, -264, -263, -262, -260, -259, -258, -256, -255, -254, 
-        -253, -251, -250, -249, -247, -246, -245, -243, -242, -241, -241, -239, 
-        -237, -235, -234, -233, -233, -232, -230, -229, -228, -226, -225, -224, 
-        -222, -221, -221, -220, -218, -217, -216, -215, -213, -212, -212, -211, 
-        -209, -208, -207, -205, -204, -204, -203, -201, -200, -199, -197, -196, 
-        -196, -195, -192, -191, -191, -190, -188, -188, -187, -187, -186, -184, 
-        -183, -183, -182, -180, -179, -178, -178, -176, -175, -174, -173, -173, 
-        -171, -170, -169, -167, -167, -166, -165, -165, -163, -163, -162, -161, 
-        -159, -159, -158, -157, -156, -154, -154, -153, -153, -152, -150, -149, 
-        -149, -148, -148, -146, -145, -144, -144, -142, -142, -141, -140, -140, 
-        -138, -137, -136, -136, -135, -135, -133, -132, -132, -131, -129, -129, 
-        -128, -128, -127, -125, -125, -124, -124, -123, -121, -121, -120, -120, 
-        -119, -119, -117, -116, -116, -115, -114, -114, -112, -112, -111, -111, 
-        -110, -110, -108, -107, -107, -106, -106, -104, -104, -103, -103, -102, 
-        -102, -100, -99, -99, -98, -98, -98, -97, -95, -95, -94, -94, 
-        -93, -93, -91, -91, -90, -90, -89, -89, -87, -87, -86, -86, 
-        -85, -85, -83, -83, -82, -82, -81, -81, -81, -79, -79, -78, 
-        -78, -77, -77, -76, -76, -74, -74, -74, -73, -73, -72, -72, 
-        -70, -70, -70, -69, -69, -68, -68, -66, -66, -65, -65, -65, 
-        -64, -62, -62, -62, -61, -61, -61, -60, -60, -60, -58, -58, 
-        -57, -57, -56, -56, -56, -55, -55, -53, -53, -53, -53, -52, 
-        -52, -51, -51, -51, -49, -49, -48, -48, -47, -47, -47, -47, 
-        -45, -45, -45, -44, -44, -44, -43, -43, -43, -41, -41, -41, 
-        -40, -40, -39, -39, -39, -38, -38, -38, -38, -36, -36, -35, 
-        -35, -35, -35, -34, -34, -34, -32, -32, -32, -31, -31, -31, 
-        -30, -30, -30, -30, -28, -28, -28, -27, -27, -26, -26, -26, 
-        -26, -26, -24, -24, -24, -24, -23, -23, -23, -22, -22, -22, 
-        -20, -20, -20, -20, -20, -19, -19, -19, -18, -18, -18, -18, 
-        -18, -18, -17, -17, -17, -17, -17, -15, -15, -14, -14, -14, 
-        -15, -15, -14, -13, -13, -15, -14, -15, -11, -14, -6, -57 
-    };
-
-    // AKWF_squ_0052 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0052[600] PROGMEM = {
-        1309, 13363, 32632, 32767, 12245, -648, -853, -204, -393, -393, -434, -428, 
-        -424, -402, -421, -424, -440, -443, -437, -434, -421, -437, -434, -443, 
-        -437, -431, -431, -424, -434, -431, -437, -424, -418, -421, -418, -428, 
-        -418, -418, -409, -409, -409, -409, -412, -402, -399, -396, -396, -396, 
-        -393, -393, -384, -384, -380, -380, -384, -377, -374, -368, -368, -365, 
-        -368, -365, -362, -358, -352, -355, -355, -352, -352, -346, -346, -343, 
-        -346, -346, -343, -339, -336, -336, -336, -339, -336, -333, -330, -327, 
-        -330, -330, -330, -327, -324, -324, -324, -324, -324, -324, -317, -317, 
-        -317, -317, -317, -314, -314, -311, -308, -311, -308, -308, -305, -302, 
-        -302, -302, -302, -299, -295, -292, -292, -292, -292, -292, -286, -286, 
-        -283, -283, -283, -280, -280, -273, -273, -270, -273, -270, -270, -267, 
-        -264, -264, -264, -264, -261, -261, -258, -254, -254, -254, -254, -254, 
-        -251, -251, -248, -251, -248, -248, -245, -242, -245, -242, -245, -242, 
-        -242, -242, -239, -239, -239, -239, -236, -232, -232, -232, -232, -229, 
-        -229, -226, -226, -226, -226, -226, -223, -223, -220, -220, -220, -217, 
-        -217, -214, -214, -214, -214, -214, -210, -207, -207, -204, -204, -204, 
-        -204, -201, -201, -198, -198, -198, -195, -195, -192, -192, -188, -192, 
-        -192, -188, -188, -185, -185, -185, -185, -185, -182, -182, -179, -182, 
-        -179, -179, -179, -176, -176, -176, -176, -176, -173, -173, -173, -173, 
-        -173, -173, -169, -169, -166, -166, -169, -166, -169, -166, -163, -163, 
-        -163, -163, -160, -160, -157, -157, -157, -157, -157, -154, -154, -151, 
-        -151, -151, -151, -151, -147, -147, -144, -147, -144, -144, -144, -141, 
-        -141, -138, -138, -138, -138, -135, -135, -135, -135, -135, -132, -132, 
-        -132, -129, -132, -129, -129, -129, -125, -129, -125, -129, -125, -125, 
-        -125, -122, -122, -122, -122, -122, -122, -119, -119, -122, -122, -122, 
-        -119, -116, -116, -116, -116, -116, -116, -113, -113, -113, -113, -113, 
-        -110, -110, -110, -110, -110, -110, -107, -103, -103, -103, -103, -103, 
-        -103, -100, -100, -100, -100, -100, -100, -97, -97, -94, -94, -94, 
-        -94, -94, -91, -91, -91, -91, -91, -91, -88, -88, -88, -88, 
-        -88, -88, -84, -84, -84, -84, -84, -84, -84, -81, -84, -84, 
-        -84, -84, -84, -81, -81, -81, -81, -81, -78, -78, -78, -78, 
-        -78, -78, -78, -75, -75, -75, -75, -75, -75, -75, -72, -72, 
-        -72, -72, -72, -72, -69, -69, -69, -69, -66, -66, -66, -66, 
-        -62, -62, -62, -62, -62, -59, -62, -59, -59, -59, -59, -59, 
-        -56, -59, -56, -56, -56, -53, -56, -56, -56, -56, -56, -53, 
-        -53, -56, -53, -56, -53, -53, -53, -53, -53, -53, -53, -53, 
-        -50, -50, -50, -53, -50, -53, -50, -50, -50, -50, -53, -50, 
-        -47, -47, -47, -50, -47, -47, -44, -44, -44, -44, -47, -44, 
-        -44, -40, -44, -40, -40, -40, -37, -37, -34, -37, -37, -37, 
-        -37, -34, -34, -34, -34, -34, -34, -31, -28, -31, -31, -34, 
-        -31, -31, -31, -31, -31, -31, -31, -31, -31, -31, -31, -31, 
-        -31, -31, -31, -28, -31, -31, -34, -31, -31, -31, -31, -31, 
-        -31, -31, -28, -28, -28, -31, -31, -28, -28, -25, -28, -28, 
-        -28, -28, -25, -25, -22, -25, -25, -25, -25, -22, -22, -18, 
-        -18, -22, -18, -18, -12, -15, -15, -15, -15, -12, -12, -6, 
-        -12, -12, -15, -12, -9, -9, -9, -15, -12, -12, -9, -6, 
-        -12, -12, -15, -12, -12, -9, -9, -15, -15, -18, -12, -12, 
-        -15, -15, -22, -18, -22, -15, -15, -22, -25, -31, -22, -22, 
-        -15, -22, -28, -28, -31, -15, -18, -15, -28, -34, -22, -18, 
-        -3, -15, -9, -22, -18, -3, 9, 25, 3, 0, 12, -18 
-    };
-
-    // AKWF_squ_0053 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0053[600] PROGMEM = {
-        6726, 27826, 27989, 28147, 28302, 28453, 28604, 28750, 28893, 29034, 29171, 29304, 
-        29436, 29565, 29691, 29815, 29934, 30051, 30165, 30277, 30387, 30494, 30596, 30698, 
-        30795, 30890, 30985, 31075, 31162, 31248, 31330, 31410, 31486, 31561, 31634, 31705, 
-        31770, 31836, 31899, 31960, 32018, 32074, 32128, 32179, 32228, 32274, 32318, 32359, 
-        32400, 32437, 32473, 32505, 32536, 32566, 32595, 32619, 32641, 32663, 32682, 32699, 
-        32714, 32729, 32738, 32748, 32755, 32763, 32765, 32767, 32767, 32767, 32763, 32758, 
-        32753, 32743, 32733, 32721, 32709, 32695, 32678, 32658, 32639, 32619, 32595, 32571, 
-        32546, 32519, 32490, 32461, 32429, 32395, 32361, 32325, 32288, 32252, 32211, 32172, 
-        32128, 32084, 32040, 31994, 31948, 31899, 31851, 31800, 31749, 31695, 31642, 31588, 
-        31532, 31474, 31415, 31357, 31296, 31235, 31175, 31111, 31046, 30982, 30917, 30849, 
-        30781, 30713, 30644, 30574, 30503, 30430, 30357, 30284, 30212, 30136, 30061, 29983, 
-        29908, 29830, 29752, 29672, 29591, 29511, 29431, 29348, 29266, 29183, 29100, 29015, 
-        28930, 28845, 28760, 28675, 28587, 28499, 28412, 28324, 28234, 28147, 28057, 27967, 
-        27877, 27784, 27694, 27602, 27510, 27417, 27325, 27232, 27138, 27045, 26950, 26855, 
-        26761, 26666, 26571, 26474, 26379, 26282, 26187, 26089, 25992, 25895, 25798, 25700, 
-        25603, 25506, 25408, 25309, 25211, 25112, 25014, 24915, 24815, 24718, 24618, 24518, 
-        24419, 24319, 24219, 24120, 24020, 23920, 23820, 23721, 23621, 23521, 23422, 23322, 
-        23222, 23122, 23023, 22921, 22821, 22721, 22621, 22522, 22422, 22322, 22223, 22123, 
-        22023, 21923, 21824, 21724, 21624, 21525, 21425, 21325, 21228, 21128, 21029, 20931, 
-        20832, 20734, 20635, 20537, 20438, 20340, 20243, 20143, 20046, 19949, 19851, 19754, 
-        19657, 19562, 19465, 19367, 19273, 19175, 19081, 18983, 18888, 18794, 18699, 18604, 
-        18509, 18414, 18319, 18224, 18132, 18037, 17945, 17850, 17758, 17665, 17573, 17480, 
-        17388, 17295, 17205, 17113, 17023, 16931, 16841, 16751, 16661, 16571, 16481, 16391, 
-        16303, 16213, 16126, 16038, 15948, 15861, 15776, 15688, 15600, 15513, 15428, 15343, 
-        15255, 15170, 15085, 15000, 14915, 14832, 14747, 14664, 14581, 14496, 14414, 14331, 
-        -6726, -27826, -27989, -28147, -28302, -28453, -28604, -28750, -28893, -29034, -29171, -29304, 
-        -29436, -29565, -29691, -29815, -29934, -30051, -30165, -30277, -30387, -30494, -30596, -30698, 
-        -30795, -30890, -30985, -31075, -31162, -31248, -31330, -31410, -31486, -31561, -31634, -31705, 
-        -31770, -31836, -31899, -31960, -32018, -32074, -32128, -32177, -32228, -32274, -32318, -32359, 
-        -32400, -32437, -32473, -32505, -32536, -32566, -32595, -32619, -32641, -32663, -32682, -32699, 
-        -32714, -32729, -32738, -32748, -32755, -32763, -32765, -32767, -32767, -32767, -32763, -32758, 
-        -32753, -32743, -32733, -32721, -32709, -32695, -32678, -32658, -32639, -32619, -32595, -32571, 
-        -32546, -32519, -32490, -32459, -32429, -32395, -32361, -32325, -32288, -32252, -32211, -32172, 
-        -32128, -32084, -32040, -31994, -31948, -31899, -31851, -31800, -31749, -31695, -31642, -31588, 
-        -31532, -31474, -31415, -31357, -31296, -31235, -31175, -31111, -31046, -30982, -30917, -30849, 
-        -30781, -30713, -30644, -30574, -30503, -30430, -30357, -30284, -30212, -30136, -30061, -29983, 
-        -29908, -29830, -29752, -29672, -29591, -29511, -29431, -29348, -29266, -29183, -29100, -29015, 
-        -28930, -28845, -28760, -28675, -28587, -28499, -28412, -28324, -28234, -28147, -28057, -27967, 
-        -27877, -27784, -27694, -27602, -27510, -27417, -27325, -27232, -27138, -27045, -26950, -26855, 
-        -26761, -26666, -26571, -26474, -26379, -26282, -26187, -26089, -25992, -25895, -25798, -25700, 
-        -25603, -25506, -25408, -25309, -25211, -25112, -25014, -24915, -24815, -24718, -24618, -24518, 
-        -24419, -24319, -24219, -24120, -24020, -23920, -23820, -23721, -23621, -23521, -23422, -23322, 
-        -23222, -23122, -23023, -22921, -22821, -22721, -22621, -22522, -22422, -22322, -22223, -22123, 
-        -22023, -21923, -21824, -21724, -21624, -21525, -21425, -21325, -21228, -21128, -21029, -20931, 
-        -20832, -20734, -20635, -20537, -20438, -20340, -20243, -20143, -20046, -19949, -19851, -19754, 
-        -19657, -19562, -19465, -19367, -19273, -19175, -19081, -18983, -18888, -18794, -18699, -18604, 
-        -18509, -18414, -18319, -18224, -18132, -18037, -17945, -17850, -17758, -17665, -17573, -17480, 
-        -17388, -17295, -17205, -17113, -17023, -16931, -16841, -16751, -16661, -16571, -16481, -16391, 
-        -16303, -16213, -16126, -16038, -15948, -15861, -15773, -15688, -15600, -15513, -15428, -15340, 
-        -15255, -15170, -15085, -15000, -14915, -14832, -14747, -14664, -14581, -14496, -14414, -14331 
-    };
-
-    // AKWF_squ_0054 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0054[600] PROGMEM = {
-        16, 71, 141, 208, 272, 343, 417, 470, 535, 606, 664, 722, 
-        799, 856, 912, 975, 1033, 1087, 1161, 1217, 1264, 1328, 1392, 1433, 
-        1483, 1556, 1600, 1647, 1711, 1765, 1808, 1867, 1919, 1956, 2016, 2068, 
-        2116, 2159, 2212, 2254, 2285, 2365, 2370, 2457, 2461, 2540, 2574, 2553, 
-        2765, 2521, 2946, 2820, 12409, 23900, 25307, 25649, 26073, 26327, 26698, 26909, 
-        27229, 27467, 27695, 27945, 28152, 28347, 28538, 28724, 28881, 29026, 29174, 29303, 
-        29411, 29537, 29632, 29708, 29798, 29875, 29918, 29978, 30035, 30059, 30080, 30115, 
-        30123, 30119, 30133, 30115, 30094, 30085, 30046, 30005, 29978, 29930, 29867, 29808, 
-        29744, 29672, 29607, 29532, 29444, 29355, 29272, 29164, 29066, 28968, 28862, 28748, 
-        28640, 28520, 28389, 28274, 28148, 28004, 27876, 27749, 27593, 27458, 27325, 27169, 
-        27013, 26875, 26723, 26555, 26428, 26273, 26079, 25922, 25765, 25565, 25408, 25258, 
-        25077, 24904, 24747, 24565, 24390, 24233, 24045, 23851, 23686, 23504, 23324, 23145, 
-        22977, 22781, 22600, 22428, 22234, 22048, 21874, 21685, 21503, 21317, 21137, 20940, 
-        20768, 20583, 20383, 20205, 20029, 19837, 19645, 19479, 19273, 19087, 18914, 18733, 
-        18532, 18355, 18180, 17980, 17801, 17632, 17440, 17264, 17085, 16887, 16710, 16542, 
-        16354, 16163, 16004, 15823, 15626, 15455, 15293, 15092, 14934, 14766, 14582, 14404, 
-        14245, 14065, 13884, 13725, 13549, 13371, 13218, 13067, 12863, 12717, 12546, 12362, 
-        12187, 12045, 11876, 11709, 11561, 11398, 11226, 11078, 10923, 10748, 10602, 10453, 
-        10290, 10137, 9987, 9830, 9683, 9539, 9372, 9228, 9092, 8936, 8779, 8645, 
-        8504, 8352, 8219, 8069, 7919, 7780, 7649, 7506, 7368, 7239, 7099, 6956, 
-        6833, 6689, 6557, 6433, 6298, 6159, 6036, 5912, 5780, 5659, 5539, 5407, 
-        5278, 5165, 5034, 4915, 4798, 4673, 4550, 4438, 4317, 4207, 4097, 3985, 
-        3864, 3750, 3643, 3526, 3420, 3314, 3195, 3087, 2993, 2897, 2792, 2685, 
-        2572, 2453, 2329, 2260, 2155, 2056, 1971, 1862, 1770, 1686, 1575, 1483, 
-        1397, 1301, 1206, 1120, 1028, 923, 838, 765, 667, 592, 504, 416, 
-        328, 252, 161, 72, -2, -73, -162, -233, -317, -387, -472, -545, 
-        -625, -694, -768, -854, -925, -984, -1062, -1143, -1204, -1273, -1342, -1408, 
-        -1475, -1553, -1607, -1672, -1748, -1808, -1857, -1936, -1995, -2048, -2111, -2179, 
-        -2228, -2293, -2375, -2409, -2478, -2551, -2597, -2666, -2723, -2834, -2986, -5461, 
-        -12158, -22393, -28722, -29835, -30163, -30485, -30711, -30953, -31153, -31377, -31561, -31712, 
-        -31888, -32031, -32143, -32276, -32381, -32454, -32552, -32617, -32649, -32707, -32731, -32749, 
-        -32766, -32767, -32756, -32739, -32719, -32692, -32642, -32588, -32540, -32473, -32399, -32330, 
-        -32241, -32144, -32052, -31939, -31835, -31720, -31600, -31473, -31349, -31215, -31068, -30939, 
-        -30779, -30626, -30482, -30333, -30156, -29991, -29840, -29666, -29491, -29313, -29139, -28947, 
-        -28776, -28583, -28392, -28209, -28019, -27817, -27637, -27438, -27233, -27041, -26843, -26629, 
-        -26435, -26244, -26023, -25798, -25617, -25412, -25202, -25012, -24804, -24577, -24367, -24170, 
-        -23948, -23740, -23541, -23320, -23111, -22914, -22698, -22484, -22284, -22064, -21856, -21665, 
-        -21460, -21233, -21029, -20839, -20612, -20410, -20215, -19997, -19794, -19595, -19390, -19178, 
-        -18986, -18794, -18573, -18377, -18182, -17979, -17783, -17601, -17394, -17195, -17018, -16816, 
-        -16616, -16436, -16249, -16042, -15861, -15679, -15482, -15307, -15121, -14922, -14751, -14586, 
-        -14374, -14202, -14044, -13857, -13669, -13501, -13334, -13150, -12985, -12818, -12632, -12463, 
-        -12303, -12132, -11963, -11807, -11636, -11452, -11316, -11153, -10989, -10849, -10699, -10524, 
-        -10381, -10227, -10060, -9913, -9766, -9601, -9454, -9327, -9172, -9011, -8882, -8739, 
-        -8585, -8454, -8315, -8170, -8038, -7904, -7759, -7628, -7499, -7359, -7223, -7099, 
-        -6966, -6830, -6715, -6594, -6447, -6329, -6214, -6079, -5969, -5855, -5716, -5607, 
-        -5493, -5369, -5249, -5142, -5027, -4902, -4800, -4689, -4578, -4468, -4363, -4250, 
-        -4144, -4037, -3926, -3832, -3733, -3618, -3521, -3428, -3320, -3225, -3122, -3027, 
-        -2916, -2833, -2745, -2640, -2549, -2458, -2366, -2263, -2186, -2095, -2004, -1935, 
-        -1853, -1759, -1679, -1590, -1497, -1428, -1349, -1249, -1183, -1100, -1020, -939, 
-        -866, -786, -703, -641, -556, -485, -412, -338, -263, -203, -130, -48 
-    };
-
-    // AKWF_squ_0055 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0055[600] PROGMEM = {
-        45, 119, 179, 221, 291, 364, 402, 478, 538, 586, 655, 710, 
-        774, 828, 881, 933, 980, 1030, 1089, 1126, 1191, 1252, 1294, 1344, 
-        1402, 1435, 1488, 1552, 1594, 1641, 1693, 1732, 1763, 1830, 1867, 1910, 
-        1963, 2013, 2040, 2085, 2133, 2167, 2211, 2255, 2296, 2334, 2383, 2418, 
-        2456, 2500, 2545, 2567, 2610, 2654, 2679, 2713, 2753, 2787, 2814, 2872, 
-        2893, 2918, 2959, 2989, 3006, 3060, 3086, 3121, 3137, 3179, 3219, 3203, 
-        3314, 3248, 3373, 3325, 3374, 3568, 2819, 6912, 21527, 25936, 26754, 27025, 
-        27398, 27696, 27961, 28275, 28504, 28750, 28955, 29189, 29367, 29565, 29747, 29924, 
-        30054, 30197, 30333, 30443, 30549, 30656, 30735, 30806, 30887, 30932, 30977, 31025, 
-        31051, 31062, 31081, 31092, 31079, 31082, 31072, 31040, 31008, 30977, 30937, 30881, 
-        30828, 30768, 30703, 30636, 30559, 30458, 30380, 30286, 30184, 30091, 29993, 29879, 
-        29758, 29656, 29529, 29396, 29282, 29143, 29003, 28874, 28726, 28577, 28440, 28287, 
-        28124, 27978, 27830, 27660, 27498, 27342, 27171, 26993, 26835, 26660, 26484, 26316, 
-        26146, 25955, 25775, 25605, 25411, 25238, 25072, 24852, 24669, 24503, 24277, 24077, 
-        23921, 23729, 23528, 23338, 23156, 22946, 22767, 22576, 22372, 22171, 21979, 21788, 
-        21591, 21402, 21191, 20992, 20804, 20620, 20394, 20208, 20025, 19819, 19624, 19433, 
-        19225, 19029, 18843, 18647, 18439, 18258, 18062, 17857, 17672, 17485, 17277, 17099, 
-        16927, 16712, 16526, 16342, 16142, 15952, 15776, 15578, 15377, 15207, 15032, 14818, 
-        14647, 14476, 14272, 14098, 13920, 13739, 13552, 13377, 13202, 13009, 12848, 12668, 
-        12476, 12321, 12144, 11959, 11793, 11622, 11439, 11260, 11133, 10953, 10761, 10617, 
-        10440, 10246, 10111, 9947, 9780, 9624, 9473, 9301, 9139, 9000, 8820, 8673, 
-        8527, 8372, 8207, 8061, 7910, 7753, 7610, 7465, 7318, 7167, 7030, 6871, 
-        6726, 6599, 6444, 6299, 6169, 6033, 5886, 5753, 5622, 5473, 5347, 5223, 
-        5081, 4949, 4830, 4698, 4555, 4438, 4305, 4181, 4057, 3927, 3809, 3690, 
-        3575, 3450, 3320, 3211, 3089, 2984, 2872, 2746, 2633, 2529, 2404, 2297, 
-        2191, 2083, 1971, 1860, 1755, 1648, 1552, 1449, 1340, 1236, 1148, 1061, 
-        938, 844, 738, 623, 526, 449, 343, 262, 172, 66, -14, -102, 
-        -198, -290, -364, -480, -551, -639, -737, -823, -920, -992, -1147, -1360, 
-        -3879, -10703, -21221, -27940, -29226, -29601, -29920, -30206, -30471, -30716, -30951, -31167, 
-        -31359, -31552, -31739, -31875, -32018, -32158, -32269, -32365, -32458, -32540, -32595, -32662, 
-        -32695, -32729, -32756, -32767, -32765, -32764, -32750, -32732, -32697, -32659, -32606, -32556, 
-        -32498, -32433, -32343, -32263, -32199, -32089, -31989, -31886, -31766, -31645, -31531, -31400, 
-        -31264, -31129, -30999, -30852, -30713, -30572, -30428, -30259, -30101, -29932, -29755, -29597, 
-        -29425, -29237, -29072, -28898, -28719, -28534, -28352, -28153, -27970, -27777, -27584, -27393, 
-        -27208, -27001, -26806, -26621, -26403, -26211, -26016, -25816, -25610, -25408, -25199, -25003, 
-        -24797, -24596, -24378, -24176, -23981, -23779, -23572, -23364, -23161, -22952, -22749, -22542, 
-        -22341, -22132, -21933, -21724, -21522, -21318, -21110, -20909, -20717, -20510, -20297, -20112, 
-        -19918, -19706, -19509, -19301, -19105, -18923, -18731, -18533, -18327, -18141, -17944, -17753, 
-        -17567, -17381, -17180, -16997, -16798, -16603, -16436, -16250, -16068, -15900, -15703, -15525, 
-        -15344, -15166, -14978, -14803, -14634, -14452, -14266, -14106, -13935, -13758, -13597, -13434, 
-        -13248, -13089, -12923, -12753, -12593, -12437, -12265, -12103, -11954, -11785, -11618, -11471, 
-        -11315, -11156, -11007, -10851, -10698, -10550, -10407, -10238, -10095, -9961, -9813, -9656, 
-        -9530, -9374, -9230, -9107, -8969, -8815, -8687, -8554, -8413, -8277, -8155, -8011, 
-        -7878, -7760, -7617, -7494, -7380, -7238, -7110, -6997, -6877, -6731, -6620, -6514, 
-        -6381, -6258, -6155, -6028, -5913, -5811, -5676, -5556, -5460, -5354, -5230, -5141, 
-        -5026, -4904, -4799, -4712, -4592, -4480, -4385, -4273, -4167, -4080, -3975, -3873, 
-        -3783, -3687, -3581, -3489, -3405, -3299, -3208, -3138, -3026, -2929, -2846, -2755, 
-        -2653, -2577, -2500, -2398, -2314, -2240, -2146, -2063, -1989, -1903, -1818, -1747, 
-        -1665, -1579, -1509, -1427, -1349, -1281, -1206, -1122, -1057, -981, -901, -838, 
-        -769, -691, -618, -560, -485, -405, -350, -285, -213, -153, -96, -17 
-    };
-
-    // AKWF_squ_0056 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0056[600] PROGMEM = {
-        27, 60, 120, 168, 194, 251, 302, 329, 373, 428, 458, 508, 
-        554, 593, 624, 678, 711, 742, 794, 837, 870, 903, 945, 967, 
-        1013, 1051, 1081, 1115, 1159, 1193, 1223, 1262, 1291, 1317, 1358, 1392, 
-        1415, 1456, 1497, 1510, 1545, 1580, 1603, 1636, 1679, 1701, 1724, 1768, 
-        1785, 1808, 1845, 1894, 1892, 1921, 1957, 1947, 1987, 2033, 2041, 2068, 
-        2101, 2111, 2137, 2181, 2189, 2206, 2248, 2266, 2281, 2308, 2324, 2340, 
-        2372, 2402, 2409, 2427, 2452, 2478, 2485, 2504, 2530, 2541, 2569, 2590, 
-        2602, 2622, 2645, 2652, 2673, 2697, 2711, 2719, 2746, 2755, 2769, 2807, 
-        2810, 2825, 2849, 2862, 2861, 2894, 2910, 2916, 2931, 2945, 2954, 2959, 
-        2989, 2993, 3010, 3037, 3038, 3037, 3062, 3068, 3080, 3090, 3118, 3117, 
-        3118, 3140, 3143, 3160, 3174, 3202, 3201, 3204, 3224, 3202, 3203, 3229, 
-        3246, 3238, 3284, 3247, 3270, 3329, 3214, 3507, 2916, 8268, 24145, 28080, 
-        28467, 28864, 29210, 29523, 29797, 30075, 30344, 30573, 30814, 31029, 31219, 31405, 
-        31592, 31751, 31872, 32024, 32144, 32244, 32346, 32442, 32500, 32574, 32639, 32671, 
-        32711, 32745, 32758, 32751, 32767, 32751, 32728, 32715, 32673, 32636, 32588, 32538, 
-        32478, 32410, 32341, 32260, 32172, 32092, 31984, 31877, 31776, 31659, 31539, 31428, 
-        31306, 31158, 31031, 30897, 30748, 30605, 30452, 30296, 30145, 29971, 29804, 29636, 
-        29452, 29274, 29103, 28940, 28751, 28560, 28389, 28198, 27998, 27802, 27606, 27405, 
-        27215, 27030, 26814, 26611, 26414, 26203, 25986, 25786, 25577, 25360, 25147, 24938, 
-        24721, 24505, 24297, 24073, 23852, 23651, 23427, 23193, 22992, 22770, 22530, 22330, 
-        22114, 21877, 21668, 21454, 21216, 20994, 20791, 20559, 20331, 20120, 19891, 19670, 
-        19454, 19230, 19006, 18792, 18586, 18352, 18139, 17934, 17702, 17485, 17282, 17053, 
-        16835, 16631, 16401, 16185, 15993, 15775, 15546, 15344, 15140, 14916, 14742, 14529, 
-        14298, 14087, 13890, 13651, 13461, 13275, 13076, 12865, 12664, 12472, 12255, 12069, 
-        11887, 11675, 11481, 11295, 11092, 10892, 10720, 10520, 10316, 10134, 9947, 9758, 
-        9569, 9393, 9166, 8975, 8788, 7686, 2894, -7159, -18133, -21805, -22506, -23016, 
-        -23459, -23852, -24233, -24628, -24964, -25279, -25605, -25908, -26169, -26441, -26695, -26908, 
-        -27146, -27360, -27542, -27713, -27892, -28028, -28164, -28293, -28390, -28490, -28587, -28672, 
-        -28733, -28796, -28847, -28885, -28935, -28952, -28961, -28964, -28980, -28978, -28951, -28936, 
-        -28889, -28837, -28818, -28775, -28695, -28672, -28601, -28505, -28438, -28360, -28262, -28184, 
-        -28093, -27980, -27882, -27783, -27662, -27551, -27447, -27319, -27186, -27069, -26941, -26792, 
-        -26664, -26539, -26382, -26244, -26110, -25951, -25800, -25660, -25502, -25339, -25191, -25040, 
-        -24870, -24709, -24566, -24380, -24215, -24068, -23890, -23725, -23565, -23390, -23218, -23063, 
-        -22884, -22714, -22553, -22383, -22191, -22032, -21858, -21672, -21501, -21347, -21163, -20991, 
-        -20821, -20637, -20456, -20299, -20117, -19934, -19788, -19606, -19417, -19260, -19091, -18914, 
-        -18746, -18570, -18403, -18212, -18069, -17898, -17716, -17577, -17423, -17223, -17063, -16910, 
-        -16734, -16572, -16414, -16238, -16089, -15919, -15759, -15596, -15451, -15285, -15121, -14979, 
-        -14822, -14645, -14512, -14352, -14186, -14037, -13904, -13734, -13586, -13448, -13288, -13140, 
-        -13006, -12857, -12696, -12575, -12420, -12279, -12139, -11994, -11845, -11712, -11584, -11440, 
-        -11301, -11188, -11031, -10897, -10772, -10634, -10501, -10376, -10248, -10121, -9986, -9851, 
-        -9734, -9619, -9494, -9361, -9242, -9119, -8992, -8871, -8755, -8645, -8517, -8405, 
-        -8284, -8174, -8062, -7948, -7825, -7716, -7591, -7490, -7383, -7288, -7194, -7074, 
-        -6968, -6854, -6747, -6641, -6542, -6444, -6354, -6242, -6135, -6051, -5953, -5842, 
-        -5744, -5658, -5561, -5456, -5380, -5285, -5178, -5097, -5008, -4907, -4832, -4739, 
-        -4636, -4560, -4480, -4391, -4305, -4230, -4135, -4056, -3990, -3885, -3808, -3738, 
-        -3660, -3569, -3499, -3421, -3337, -3267, -3201, -3118, -3034, -2980, -2897, -2815, 
-        -2755, -2689, -2606, -2548, -2483, -2394, -2336, -2279, -2192, -2133, -2079, -2004, 
-        -1942, -1886, -1807, -1736, -1694, -1620, -1546, -1493, -1429, -1371, -1316, -1273, 
-        -1216, -1175, -1109, -1028, -976, -928, -865, -813, -760, -709, -645, -604, 
-        -556, -491, -451, -401, -342, -305, -262, -196, -162, -123, -67, -7 
-    };
-
-    // AKWF_squ_0057 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0057[600] PROGMEM = {
-        29, 44, 66, 107, 130, 142, 182, 206, 222, 242, 277, 300, 
-        317, 350, 364, 382, 421, 434, 462, 487, 504, 518, 552, 576, 
-        583, 615, 643, 651, 673, 700, 721, 732, 767, 780, 790, 812, 
-        838, 844, 875, 891, 898, 929, 954, 954, 971, 1009, 1010, 1028, 
-        1057, 1058, 1065, 1094, 1125, 1130, 1141, 1147, 1163, 1177, 1206, 1206, 
-        1232, 1249, 1249, 1259, 1289, 1301, 1308, 1323, 1348, 1354, 1365, 1381, 
-        1385, 1375, 1410, 1414, 1420, 1451, 1455, 1462, 1487, 1489, 1494, 1518, 
-        1523, 1530, 1548, 1558, 1562, 1572, 1599, 1604, 1611, 1621, 1617, 1622, 
-        1656, 1662, 1654, 1680, 1683, 1684, 1696, 1708, 1707, 1712, 1738, 1733, 
-        1745, 1756, 1752, 1755, 1779, 1772, 1765, 1785, 1802, 1793, 1817, 1822, 
-        1813, 1818, 1840, 1836, 1841, 1855, 1859, 1849, 1869, 1872, 1871, 1892, 
-        1886, 1880, 1893, 1908, 1902, 1907, 1929, 1925, 1918, 1935, 1936, 1940, 
-        1942, 1935, 1934, 1933, 1931, 1945, 1956, 1962, 1956, 1967, 1978, 1979, 
-        1978, 1976, 1988, 1982, 1998, 1999, 1988, 2005, 2010, 1995, 2013, 2019, 
-        2013, 2015, 2019, 2011, 2015, 2033, 2032, 2021, 2021, 2046, 2010, 2054, 
-        2015, 2043, 2031, 2020, 2107, 1931, 2217, 1855, 2009, 3639, 18757, 27471, 
-        28402, 28619, 29158, 29311, 29745, 29954, 30247, 30524, 30725, 30967, 31161, 31371, 
-        31538, 31710, 31867, 31992, 32128, 32243, 32327, 32426, 32510, 32563, 32623, 32683, 
-        32703, 32749, 32767, 32754, 32749, 32735, 32692, 32676, 32651, 32610, 32548, 32488, 
-        32434, 32350, 32268, 32186, 32082, 31982, 31895, 31774, 31654, 31538, 31405, 31267, 
-        31152, 31003, 30848, 30709, 30555, 30380, 30216, 30064, 29881, 29699, 29540, 29359, 
-        29161, 28988, 28800, 28595, 28416, 28227, 28001, 27807, 27615, 27391, 27190, 26989, 
-        26779, 26552, 26349, 26135, 25897, 25690, 25466, 25235, 25011, 24783, 24548, 24263, 
-        24118, 22616, 16775, 5631, -4620, -7339, -7999, -8563, -9107, -9593, -10066, -10567, 
-        -10987, -11406, -11818, -12211, -12559, -12947, -13314, -13621, -13951, -14276, -14545, -14816, 
-        -15098, -15328, -15570, -15797, -16013, -16201, -16407, -16590, -16765, -16920, -17074, -17213, 
-        -17344, -17473, -17596, -17690, -17812, -17889, -17978, -18060, -18126, -18177, -18244, -18292, 
-        -18328, -18377, -18421, -18434, -18469, -18480, -18479, -18482, -18507, -18485, -18466, -18467, 
-        -18446, -18421, -18411, -18373, -18329, -18310, -18272, -18217, -18184, -18148, -18072, -18027, 
-        -17977, -17905, -17834, -17782, -17713, -17646, -17584, -17505, -17429, -17345, -17260, -17181, 
-        -17106, -17025, -16936, -16845, -16761, -16669, -16560, -16489, -16403, -16289, -16210, -16137, 
-        -16013, -15921, -15818, -15708, -15618, -15519, -15418, -15312, -15214, -15102, -14992, -14899, 
-        -14792, -14683, -14582, -14476, -14361, -14268, -14161, -14045, -13943, -13840, -13729, -13613, 
-        -13527, -13415, -13294, -13197, -13094, -12973, -12868, -12774, -12657, -12561, -12452, -12332, 
-        -12223, -12127, -12021, -11909, -11814, -11704, -11593, -11498, -11393, -11281, -11185, -11082, 
-        -10976, -10877, -10772, -10673, -10562, -10479, -10370, -10258, -10172, -10072, -9965, -9873, 
-        -9780, -9677, -9580, -9481, -9372, -9279, -9198, -9087, -8989, -8896, -8815, -8725, 
-        -8637, -8553, -8461, -8357, -8276, -8170, -8087, -8011, -7910, -7823, -7746, -7649, 
-        -7557, -7487, -7402, -7304, -7234, -7148, -7047, -6971, -6903, -6811, -6727, -6657, 
-        -6564, -6493, -6423, -6326, -6254, -6193, -6099, -6017, -5956, -5881, -5796, -5721, 
-        -5659, -5575, -5518, -5446, -5362, -5291, -5232, -5151, -5075, -5024, -4944, -4873, 
-        -4811, -4747, -4672, -4614, -4538, -4474, -4413, -4347, -4289, -4221, -4166, -4096, 
-        -4037, -3989, -3916, -3848, -3803, -3738, -3666, -3619, -3565, -3490, -3453, -3374, 
-        -3314, -3281, -3234, -3167, -3135, -3065, -3005, -2946, -2906, -2853, -2794, -2750, 
-        -2705, -2643, -2594, -2553, -2488, -2442, -2404, -2350, -2301, -2265, -2213, -2158, 
-        -2127, -2077, -2020, -1976, -1935, -1883, -1850, -1809, -1753, -1707, -1688, -1628, 
-        -1578, -1557, -1509, -1457, -1429, -1387, -1339, -1310, -1265, -1227, -1195, -1158, 
-        -1114, -1081, -1050, -1003, -966, -934, -901, -856, -828, -801, -755, -736, 
-        -701, -653, -620, -589, -556, -530, -497, -461, -432, -407, -375, -332, 
-        -318, -283, -217, -213, -189, -155, -146, -116, -72, -44, -27, 0 
-    };
-
-    // AKWF_squ_0058 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0058[600] PROGMEM = {
-        14, 18, 14, 33, 44, 34, 56, 61, 34, 50, 55, 34, 
-        52, 68, 77, 67, 83, 83, 84, 93, 110, 94, 103, 112, 
-        110, 114, 119, 118, 121, 135, 135, 124, 137, 148, 145, 145, 
-        171, 146, 169, 173, 168, 166, 190, 180, 184, 187, 195, 188, 
-        200, 205, 198, 204, 220, 214, 211, 209, 220, 210, 215, 230, 
-        229, 231, 236, 241, 227, 247, 238, 231, 247, 247, 238, 262, 
-        268, 254, 258, 268, 259, 263, 268, 279, 265, 286, 297, 263, 
-        280, 285, 257, 273, 289, 272, 281, 290, 285, 277, 295, 306, 
-        289, 290, 294, 300, 300, 309, 301, 306, 313, 310, 295, 311, 
-        312, 304, 316, 320, 311, 313, 329, 315, 315, 318, 311, 302, 
-        332, 327, 317, 323, 323, 322, 323, 332, 318, 329, 337, 332, 
-        327, 343, 331, 323, 339, 342, 326, 350, 349, 332, 331, 348, 
-        339, 329, 343, 343, 332, 337, 347, 342, 353, 343, 338, 348, 
-        347, 364, 358, 343, 354, 329, 326, 343, 337, 345, 352, 347, 
-        347, 358, 348, 342, 354, 350, 343, 349, 354, 344, 350, 359, 
-        347, 366, 364, 354, 345, 360, 357, 350, 365, 361, 341, 358, 
-        364, 352, 348, 361, 354, 348, 364, 354, 349, 364, 357, 348, 
-        358, 366, 359, 361, 366, 352, 369, 369, 353, 360, 365, 364, 
-        350, 365, 369, 344, 365, 361, 366, 349, 359, 359, 343, 397, 
-        317, 406, 283, 77, 6870, 24225, 29459, 30013, 30250, 30807, 31006, 31454, 
-        31705, 32025, 32276, 32479, 32767, 31588, 26228, 14752, 5350, 3384, 3026, 2757, 
-        2540, 2317, 2111, 1889, 1716, 1519, 1307, 1131, 956, 784, 616, 455, 
-        293, 137, 8, -144, -289, -396, -539, -673, -780, -897, -1015, -1114, 
-        -1216, -1328, -1425, -1516, -1600, -1696, -1770, -1853, -1940, -2003, -2068, -2152, 
-        -2207, -2272, -2338, -2388, -2425, -2489, -2548, -2591, -2653, -2697, -2734, -2776, 
-        -2824, -2850, -2873, -2910, -2948, -2958, -3011, -3017, -3028, -3085, -3105, -3118, 
-        -3163, -3180, -3181, -3181, -3208, -3218, -3223, -3245, -3249, -3249, -3263, -3284, 
-        -3272, -3271, -3288, -3287, -3282, -3297, -3288, -3281, -3282, -3291, -3273, -3276, 
-        -3283, -3267, -3261, -3259, -3250, -3243, -3250, -3236, -3212, -3207, -3207, -3186, 
-        -3175, -3172, -3163, -3153, -3135, -3115, -3101, -3105, -3090, -3062, -3063, -3048, 
-        -3025, -3014, -3004, -2980, -2961, -2957, -2936, -2913, -2910, -2904, -2858, -2862, 
-        -2846, -2819, -2803, -2792, -2767, -2755, -2739, -2716, -2700, -2693, -2663, -2618, 
-        -2643, -2622, -2595, -2602, -2586, -2542, -2532, -2516, -2484, -2464, -2462, -2446, 
-        -2418, -2402, -2389, -2356, -2356, -2334, -2301, -2295, -2282, -2255, -2221, -2218, 
-        -2196, -2169, -2159, -2146, -2121, -2101, -2095, -2066, -2050, -2037, -2009, -1997, 
-        -1987, -1967, -1951, -1930, -1915, -1883, -1871, -1865, -1830, -1827, -1817, -1777, 
-        -1760, -1763, -1740, -1713, -1717, -1694, -1664, -1663, -1646, -1610, -1600, -1594, 
-        -1568, -1553, -1545, -1518, -1492, -1494, -1486, -1445, -1443, -1435, -1417, -1410, 
-        -1397, -1372, -1344, -1350, -1340, -1318, -1329, -1317, -1268, -1265, -1268, -1239, 
-        -1216, -1211, -1183, -1184, -1184, -1147, -1125, -1122, -1111, -1088, -1082, -1065, 
-        -1046, -1035, -1028, -1007, -998, -998, -966, -964, -956, -946, -918, -922, 
-        -907, -890, -880, -868, -836, -839, -834, -816, -806, -802, -789, -760, 
-        -763, -751, -726, -721, -717, -704, -700, -685, -659, -647, -662, -646, 
-        -606, -619, -620, -590, -592, -583, -562, -560, -558, -540, -526, -535, 
-        -509, -493, -497, -481, -460, -434, -454, -438, -435, -449, -444, -408, 
-        -417, -393, -389, -387, -375, -347, -345, -355, -333, -333, -332, -310, 
-        -304, -302, -290, -285, -286, -275, -262, -258, -257, -235, -235, -241, 
-        -213, -205, -219, -194, -188, -189, -183, -166, -160, -162, -151, -151, 
-        -146, -132, -125, -130, -113, -99, -120, -104, -84, -87, -84, -73, 
-        -75, -67, -54, -45, -55, -41, -30, -39, -34, -12, -22, -7 
-    };
-
-    // AKWF_squ_0059 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0059[600] PROGMEM = {
-        41, 123, 183, 233, 316, 375, 442, 513, 575, 636, 705, 764, 
-        812, 877, 943, 999, 1056, 1122, 1174, 1230, 1296, 1350, 1398, 1451, 
-        1509, 1561, 1614, 1669, 1711, 1759, 1827, 1867, 1915, 1976, 2022, 2062, 
-        2117, 2169, 2206, 2250, 2306, 2336, 2387, 2441, 2478, 2506, 2583, 2394, 
-        9181, 22160, 25102, 25494, 25801, 26207, 26426, 26772, 27021, 27288, 27528, 27769, 
-        27994, 28179, 28396, 28571, 28734, 28898, 29049, 29178, 29304, 29427, 29521, 29615, 
-        29707, 29775, 29837, 29908, 29959, 29995, 30029, 30055, 30070, 30077, 30092, 30081, 
-        30067, 30053, 30028, 30000, 29974, 29929, 29874, 29826, 29775, 29707, 29641, 29569, 
-        29481, 29402, 29320, 29225, 29127, 29038, 28935, 28822, 28718, 28609, 28485, 28364, 
-        28247, 28119, 27990, 27865, 27724, 27581, 27453, 27313, 27158, 27015, 26873, 26717, 
-        26564, 26417, 26250, 26092, 25941, 25775, 25601, 25448, 25281, 25118, 24961, 24789, 
-        24604, 24439, 24270, 24088, 23916, 23755, 23558, 23379, 23216, 23033, 22847, 22675, 
-        22499, 22308, 22132, 21958, 21761, 21578, 21409, 21218, 21027, 20857, 20667, 20483, 
-        20303, 20126, 19935, 19754, 19589, 19386, 19195, 19024, 18832, 18653, 18482, 18296, 
-        18108, 17932, 17757, 17570, 17390, 17215, 17023, 16846, 16676, 16484, 16321, 16142, 
-        15948, 15775, 15608, 15438, 15250, 15080, 14909, 14729, 14562, 14392, 14216, 14045, 
-        13876, 13705, 13540, 13375, 13209, 13038, 12877, 12710, 12543, 12379, 12229, 12048, 
-        11895, 11731, 11564, 11406, 11262, 11095, 10938, 10782, 10630, 10467, 10320, 10171, 
-        10012, 9866, 9727, 9570, 9420, 9273, 9116, 8972, 8836, 8685, 8533, 8393, 
-        8256, 8112, 7978, 7834, 7691, 7555, 7417, 7286, 7154, 7017, 6882, 6747, 
-        6619, 6487, 6354, 6232, 6107, 5977, 5852, 5724, 5599, 5473, 5358, 5242, 
-        5109, 4986, 4866, 4749, 4640, 4524, 4388, 4283, 4170, 4047, 3938, 3836, 
-        3719, 3607, 3511, 3400, 3283, 3186, 3078, 2961, 2860, 2761, 2650, 2553, 
-        2461, 2354, 2245, 2155, 2058, 1946, 1860, 1768, 1668, 1582, 1487, 1385, 
-        1290, 1196, 1110, 1013, 930, 844, 754, 673, 589, 491, 418, 338, 
-        247, 162, 89, 6, -71, -145, -236, -311, -381, -455, -540, -618, 
-        -680, -758, -839, -902, -978, -1057, -1110, -1184, -1265, -1317, -1386, -1459, 
-        -1524, -1584, -1658, -1717, -1770, -1850, -1917, -1966, -2040, -2106, -2148, -2216, 
-        -2281, -2330, -2403, -2456, -2548, -2572, -2687, -3287, -7106, -16415, -26010, -29290, 
-        -29965, -30213, -30525, -30742, -31001, -31191, -31391, -31594, -31739, -31896, -32036, -32172, 
-        -32273, -32385, -32478, -32542, -32604, -32665, -32702, -32726, -32754, -32767, -32764, -32758, 
-        -32745, -32710, -32684, -32652, -32591, -32540, -32482, -32407, -32327, -32252, -32163, -32051, 
-        -31956, -31853, -31736, -31630, -31504, -31363, -31236, -31103, -30965, -30807, -30669, -30522, 
-        -30367, -30204, -30049, -29873, -29707, -29543, -29363, -29184, -29018, -28834, -28646, -28463, 
-        -28279, -28086, -27897, -27707, -27512, -27317, -27128, -26914, -26722, -26531, -26328, -26127, 
-        -25927, -25712, -25509, -25313, -25105, -24903, -24690, -24490, -24279, -24061, -23878, -23663, 
-        -23452, -23248, -23042, -22827, -22618, -22417, -22203, -22004, -21797, -21583, -21382, -21176, 
-        -20967, -20770, -20567, -20356, -20156, -19951, -19753, -19547, -19355, -19152, -18948, -18748, 
-        -18556, -18347, -18161, -17959, -17767, -17575, -17384, -17191, -16987, -16800, -16614, -16415, 
-        -16236, -16054, -15853, -15676, -15495, -15312, -15127, -14945, -14769, -14578, -14403, -14232, 
-        -14047, -13871, -13701, -13515, -13350, -13182, -12999, -12841, -12677, -12501, -12339, -12176, 
-        -12011, -11841, -11679, -11523, -11351, -11205, -11045, -10885, -10729, -10581, -10428, -10270, 
-        -10118, -9975, -9812, -9676, -9523, -9365, -9230, -9086, -8942, -8799, -8666, -8524, 
-        -8378, -8240, -8110, -7974, -7845, -7702, -7566, -7450, -7313, -7172, -7049, -6924, 
-        -6789, -6664, -6552, -6421, -6285, -6182, -6060, -5928, -5816, -5700, -5583, -5458, 
-        -5348, -5229, -5111, -5008, -4891, -4779, -4681, -4560, -4449, -4351, -4245, -4128, 
-        -4028, -3931, -3818, -3724, -3621, -3517, -3416, -3329, -3225, -3123, -3037, -2945, 
-        -2838, -2754, -2662, -2559, -2468, -2386, -2281, -2192, -2127, -2026, -1930, -1858, 
-        -1781, -1680, -1601, -1526, -1436, -1347, -1279, -1188, -1109, -1045, -959, -879, 
-        -812, -737, -652, -583, -512, -424, -353, -295, -216, -139, -87, -24 
-    };
-
-    // AKWF_squ_0060 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0060[600] PROGMEM = {
-        13, 29, 33, 34, 66, 70, 66, 96, 105, 109, 123, 136, 
-        131, 145, 163, 163, 184, 199, 201, 221, 227, 240, 236, 254, 
-        263, 266, 280, 290, 286, 301, 326, 323, 317, 341, 354, 354, 
-        370, 381, 374, 386, 401, 396, 407, 439, 426, 423, 448, 449, 
-        458, 474, 471, 467, 481, 504, 497, 506, 529, 514, 519, 544, 
-        546, 540, 544, 561, 556, 568, 570, 572, 583, 587, 587, 600, 
-        599, 615, 618, 626, 625, 624, 636, 642, 641, 647, 666, 661, 
-        662, 673, 681, 673, 695, 694, 690, 705, 710, 698, 711, 716, 
-        713, 724, 732, 729, 731, 743, 737, 731, 743, 756, 748, 751, 
-        763, 758, 758, 778, 768, 766, 779, 770, 768, 780, 784, 785, 
-        790, 793, 790, 793, 805, 796, 800, 812, 817, 806, 817, 821, 
-        814, 831, 830, 820, 826, 839, 831, 831, 847, 843, 836, 854, 
-        850, 850, 853, 850, 854, 859, 868, 849, 850, 866, 855, 849, 
-        859, 860, 853, 865, 871, 862, 870, 868, 865, 868, 876, 871, 
-        865, 878, 874, 870, 880, 875, 863, 878, 873, 865, 870, 878, 
-        874, 871, 884, 876, 870, 878, 881, 870, 879, 880, 874, 869, 
-        882, 881, 875, 878, 878, 868, 882, 870, 886, 864, 907, 854, 
-        895, 880, 837, 938, 777, 1045, 655, 969, 1493, 15594, 26946, 28083, 
-        28410, 28930, 29111, 29542, 29754, 30101, 30346, 30590, 30844, 31040, 31256, 31442, 
-        31626, 31780, 31928, 32067, 32181, 32291, 32393, 32473, 32547, 32615, 32662, 32694, 
-        32737, 32751, 32764, 32754, 32767, 32722, 32697, 32675, 32558, 32599, 31836, 26809, 
-        13598, 4272, 2716, 2086, 1647, 1264, 801, 440, 51, -311, -683, -1013, 
-        -1354, -1697, -1986, -2301, -2592, -2863, -3132, -3411, -3656, -3880, -4118, -4357, 
-        -4560, -4772, -4980, -5158, -5344, -5541, -5699, -5859, -6029, -6176, -6309, -6460, 
-        -6584, -6708, -6826, -6944, -7046, -7161, -7262, -7342, -7430, -7533, -7611, -7672, 
-        -7743, -7828, -7881, -7949, -7997, -8041, -8089, -8142, -8174, -8219, -8258, -8280, 
-        -8311, -8349, -8370, -8379, -8406, -8422, -8423, -8439, -8455, -8448, -8458, -8481, 
-        -8458, -8454, -8466, -8455, -8434, -8430, -8429, -8408, -8396, -8397, -8364, -8352, 
-        -8332, -8307, -8290, -8265, -8235, -8210, -8192, -8159, -8115, -8088, -8067, -8017, 
-        -7997, -7966, -7928, -7880, -7858, -7821, -7768, -7741, -7703, -7659, -7630, -7595, 
-        -7542, -7502, -7472, -7417, -7370, -7336, -7278, -7231, -7203, -7164, -7108, -7079, 
-        -7026, -6970, -6938, -6895, -6836, -6786, -6753, -6695, -6646, -6610, -6549, -6502, 
-        -6462, -6419, -6353, -6315, -6279, -6212, -6172, -6134, -6079, -6028, -5990, -5935, 
-        -5887, -5852, -5802, -5738, -5705, -5668, -5605, -5555, -5525, -5464, -5418, -5384, 
-        -5337, -5279, -5241, -5192, -5137, -5094, -5060, -5002, -4954, -4924, -4870, -4813, 
-        -4785, -4737, -4680, -4647, -4602, -4549, -4528, -4481, -4417, -4387, -4348, -4295, 
-        -4258, -4216, -4173, -4121, -4089, -4047, -3997, -3965, -3918, -3868, -3837, -3811, 
-        -3756, -3721, -3693, -3644, -3603, -3581, -3524, -3477, -3450, -3416, -3362, -3337, 
-        -3307, -3257, -3221, -3198, -3150, -3105, -3089, -3044, -2999, -2974, -2937, -2890, 
-        -2863, -2841, -2794, -2762, -2737, -2690, -2661, -2634, -2607, -2559, -2530, -2496, 
-        -2460, -2438, -2417, -2369, -2342, -2325, -2281, -2248, -2227, -2193, -2156, -2136, 
-        -2112, -2072, -2049, -2020, -1975, -1951, -1948, -1903, -1866, -1849, -1828, -1794, 
-        -1777, -1743, -1705, -1689, -1665, -1632, -1610, -1593, -1562, -1523, -1512, -1477, 
-        -1455, -1448, -1415, -1376, -1365, -1339, -1309, -1286, -1270, -1243, -1229, -1209, 
-        -1181, -1153, -1156, -1120, -1096, -1076, -1057, -1017, -1007, -992, -955, -943, 
-        -934, -906, -882, -866, -847, -823, -816, -795, -767, -757, -742, -720, 
-        -693, -690, -662, -636, -631, -605, -583, -581, -561, -530, -523, -514, 
-        -486, -474, -465, -439, -422, -419, -397, -369, -371, -353, -321, -325, 
-        -311, -284, -264, -267, -247, -231, -220, -206, -184, -178, -161, -141, 
-        -145, -124, -103, -97, -87, -59, -54, -50, -29, -16, -22, -11 
-    };
-
-    // AKWF_squ_0061 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0061[600] PROGMEM = {
-        9618, 24454, 23200, 17245, 16630, 18812, 19453, 18729, 18349, 18558, 18744, 18697, 
-        18617, 18620, 18652, 18656, 18644, 18640, 18644, 18646, 18646, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 18644, 
-        18644, 18644, 18644, 18644, 18644, 18644, 18644, -22998, -32767, 740, -9618, -24454, 
-        -23200, -17245, -16630, -18812, -19453, -18729, -18349, -18558, -18744, -18697, -18617, -18620, 
-        -18652, -18656, -18644, -18640, -18644, -18646, -18646, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 
-        -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, -18644, 22998, 32767, -740 
-    };
-
-    // AKWF_squ_0062 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0062[600] PROGMEM = {
-        5509, 19824, 31737, 32713, 32765, 32767, 32767, 32766, 32765, 32764, 32763, 32762, 
-        32761, 32759, 32758, 32756, 32755, 32754, 32751, 32749, 32748, 32746, 32743, 32741, 
-        32739, 32736, 32734, 32732, 32729, 32727, 32725, 32721, 32719, 32717, 32713, 32711, 
-        32708, 23467, 111, -2028, -2143, -2151, -2154, -2156, -2158, -2161, -2162, -2164, 
-        -2165, -2168, -2169, -2170, -2171, -2173, -2175, -2176, -2177, -2178, -2179, -2180, 
-        -2180, -2181, -2183, -2184, -2184, -2185, -2185, -2186, -2187, -2187, -2188, -2188, 
-        -2188, -2190, -2190, -2191, -2191, -2191, -2191, -2192, -2192, -2192, -2192, -2193, 
-        -2193, -2193, -2193, -2193, -2193, -2193, -2193, -2194, -2194, -2194, -2194, -2194, 
-        -2194, -2194, -2194, -2194, -2194, -2194, -2194, -2194, -2194, -2194, -2194, -2193, 
-        -2193, -2193, -2193, -2193, -2193, -2193, -2193, -2193, -2193, -2193, -2192, -2192, 
-        -2192, -2192, -2192, -2192, -2192, -2191, -2191, -2191, -2191, -2191, -2191, -2191, 
-        -2190, -2190, -2190, -2190, -2190, -2190, -2188, -2188, -2188, -2188, -2188, -2187, 
-        -2187, -2187, -2187, -2187, -2187, -2186, -2186, -2186, -2186, -2185, -2185, -2185, 
-        -2185, -2185, -2185, -2184, -2184, -2184, -2184, -2184, -2183, -2183, -2183, -2183, 
-        -2181, -2181, -2181, -2181, -2181, -2180, -2180, -2180, -2180, -2180, -2179, -2179, 
-        -2179, -2179, -2179, -2178, -2178, -2178, -2178, -2178, -2177, -2177, -2177, -2177, 
-        -2177, -2176, -2176, -2176, -2176, -2175, -2175, -2175, -2175, -2175, -2173, -2173, 
-        -2173, -2173, -2173, -2172, -2172, -2172, -2172, -2171, -2171, -2171, -2171, -2171, 
-        -2170, -2170, -2170, -2170, -2170, -2169, -2169, -2169, -2169, -2169, -2168, -2168, 
-        -2168, -2168, -2166, -2166, -2166, -2166, -2166, -2165, -2165, -2165, -2165, -2165, 
-        -2164, -2164, -2164, -2164, -2163, -2163, -2163, -2163, -2163, -2162, -2162, -2162, 
-        -2162, -2162, -2161, -2161, -2161, -2161, -2160, -2160, -2160, -2160, -2160, -2158, 
-        -2158, -2158, -2158, -2158, -2157, -2157, -2157, -2157, -2156, -2156, -2156, -2156, 
-        -2156, -2155, -2155, -2155, -2155, -2155, -2154, -2154, -2154, -2154, -2153, -2153, 
-        -2153, -2153, -2153, -2151, -2151, -2151, -2151, -2151, -2150, -2150, -2150, -2150, 
-        -2150, -2149, -2149, -2149, -2148, -2148, -2148, -2148, -2148, -2147, -2147, -2147, 
-        -2147, -2146, -2146, -2146, -2146, -2146, -2144, -2144, -2144, -2144, -2144, -2143, 
-        -2143, -2143, -2143, -2142, -2142, -2142, -2142, -2142, -2141, -2141, -2141, -2141, 
-        -2141, -2140, -2140, -2140, -2140, -2140, -2139, -2139, -2139, -2139, -2138, -2138, 
-        -2138, -2138, -2138, -2136, -2136, -2136, -2136, -2136, -2135, -2135, -2135, -2135, 
-        -2135, -2134, -2134, -2134, -2134, -2133, -2133, -2133, -2133, -2133, -2132, -2132, 
-        -2132, -2132, -2132, -2131, -2131, -2131, -2131, -2131, -2129, -2129, -2129, -2129, 
-        -2128, -2128, -2128, -2128, -2128, -2127, -2127, -2127, -2127, -2127, -2126, -2126, 
-        -2126, -2126, -2126, -2125, -2125, -2125, -2125, -2124, -2124, -2124, -2124, -2124, 
-        -2122, -2122, -2122, -2122, -2122, -2121, -2121, -2121, -2121, -2121, -2120, -2120, 
-        -2120, -2120, -2119, -2119, -2119, -2119, -2119, -2118, -2118, -2118, -2118, -2118, 
-        -2117, -2117, -2117, -2117, -2117, -2116, -2116, -2116, -2116, -2114, -2114, -2114, 
-        -2114, -2114, -2113, -2113, -2113, -2113, -2113, -2112, -2112, -2112, -2112, -2112, 
-        -2111, -2111, -2111, -2111, -2111, -2110, -2110, -2110, -2110, -2109, -2109, -2109, 
-        -2109, -2109, -2107, -2107, -2107, -2107, -2107, -2106, -2106, -2106, -2106, -2106, 
-        -2105, -2105, -2105, -2105, -2104, -2104, -2104, -2104, -2104, -2103, -2103, -2103, 
-        -2103, -2103, -2102, -2102, -2102, -2102, -2102, -2101, -2101, -2101, -2101, -2101, 
-        -2099, -2099, -2099, -2099, -2099, -2098, -2098, -2098, -2098, -2097, -2097, -2097, 
-        -2097, -2097, -2096, -2096, -2096, -2096, -2096, -2095, -2095, -2095, -2095, -2095, 
-        -2094, -2094, -2094, -2094, -2094, -2092, -2092, -2092, -2092, -2091, -2091, -2091, 
-        -2091, -2091, -2090, -2090, -2090, -2090, -2090, -2089, -2089, -2089, -2089, -2089, 
-        -2088, -2088, -2088, -2088, -2088, -2087, -2087, -2087, -2087, -2087, -2085, -2085, 
-        -2085, -2085, -2084, -2084, -2084, -2084, -2084, -2083, -2083, -2083, -2083, -2083, 
-        -2082, -2082, -2082, -2082, -2082, -2081, -2081, -2081, -2081, -2081, -2080, -2080, 
-        -2080, -2080, -2080, -2079, -2079, -2079, -2079, -2079, -2077, -2077, -2077, -2077 
-    };
-
-    // AKWF_squ_0063 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0063[600] PROGMEM = {
-        7145, 23461, 32265, 32741, 32766, 32767, 32767, 32767, 32766, 32766, 32765, 32765, 
-        32764, 32762, 32761, 32760, 32758, 32757, 32756, 32754, 32752, 32750, 32748, 32746, 
-        32744, 32742, 32740, 32737, 32736, 32733, 32730, 32728, 32725, 32723, 32720, 32717, 
-        32715, 32712, 32709, 32707, 32704, 32701, 32699, 32695, 32692, 32690, 32686, 32683, 
-        32680, 32676, 32674, 32671, 32667, 32664, 32660, 32658, 32654, 32651, 32647, 32645, 
-        32641, 32638, 32634, 32631, 32627, 32625, 32621, 32617, 32614, 32610, 32606, 32604, 
-        32600, 32597, 32593, 32589, 32586, 32582, 32579, 32576, 32572, 32568, 32564, 32561, 
-        32557, 32553, 32551, 32547, 32543, 32539, 32536, 32532, 32528, 32526, 32522, 32518, 
-        32514, 32511, 32507, 32503, 32499, 32495, 32493, 32489, 32485, 32481, 32478, 32474, 
-        32470, 13822, -6061, -7277, -7345, -7351, -7354, -7357, -7359, -7361, -7363, -7366, 
-        -7367, -7370, -7371, -7372, -7374, -7376, -7378, -7379, -7379, -7380, -7382, -7383, 
-        -7383, -7384, -7386, -7386, -7387, -7387, -7387, -7388, -7388, -7388, -7390, -7390, 
-        -7390, -7390, -7390, -7390, -7390, -7390, -7390, -7390, -7390, -7390, -7390, -7390, 
-        -7390, -7390, -7388, -7388, -7388, -7388, -7387, -7387, -7387, -7387, -7386, -7386, 
-        -7386, -7384, -7384, -7384, -7383, -7383, -7382, -7382, -7382, -7380, -7380, -7379, 
-        -7379, -7378, -7378, -7376, -7376, -7375, -7375, -7374, -7374, -7372, -7372, -7371, 
-        -7371, -7370, -7370, -7369, -7369, -7367, -7367, -7366, -7365, -7365, -7363, -7363, 
-        -7362, -7362, -7361, -7359, -7359, -7358, -7358, -7357, -7357, -7355, -7354, -7354, 
-        -7353, -7353, -7351, -7350, -7350, -7349, -7349, -7347, -7346, -7346, -7345, -7345, 
-        -7343, -7342, -7342, -7341, -7341, -7339, -7338, -7338, -7337, -7335, -7335, -7334, 
-        -7334, -7333, -7331, -7331, -7330, -7329, -7329, -7328, -7328, -7326, -7325, -7325, 
-        -7324, -7324, -7322, -7321, -7321, -7320, -7318, -7318, -7317, -7316, -7316, -7314, 
-        -7314, -7313, -7312, -7312, -7310, -7309, -7309, -7308, -7308, -7306, -7305, -7305, 
-        -7304, -7302, -7302, -7301, -7301, -7300, -7298, -7298, -7297, -7296, -7296, -7294, 
-        -7294, -7293, -7292, -7292, -7291, -7289, -7289, -7288, -7287, -7287, -7285, -7285, 
-        -7284, -7283, -7281, -7281, -7280, -7280, -7279, -7277, -7277, -7276, -7275, -7275, 
-        -7273, -7273, -7272, -7271, -7271, -7269, -7268, -7268, -7267, -7265, -7265, -7264, 
-        -7264, -7263, -7261, -7261, -7260, -7259, -7259, -7257, -7257, -7256, -7255, -7255, 
-        -7254, -7252, -7252, -7251, -7251, -7250, -7248, -7248, -7247, -7246, -7246, -7244, 
-        -7244, -7243, -7242, -7242, -7240, -7239, -7239, -7238, -7236, -7236, -7235, -7235, 
-        -7234, -7232, -7232, -7231, -7230, -7230, -7228, -7228, -7227, -7226, -7226, -7224, 
-        -7223, -7223, -7222, -7222, -7220, -7219, -7219, -7218, -7217, -7217, -7215, -7215, 
-        -7214, -7213, -7213, -7211, -7210, -7210, -7209, -7209, -7207, -7206, -7206, -7205, 
-        -7203, -7203, -7202, -7202, -7201, -7199, -7199, -7198, -7197, -7197, -7195, -7195, 
-        -7194, -7193, -7193, -7191, -7190, -7190, -7189, -7189, -7187, -7186, -7186, -7185, 
-        -7185, -7183, -7182, -7182, -7181, -7180, -7180, -7178, -7178, -7177, -7176, -7176, 
-        -7174, -7173, -7173, -7172, -7172, -7170, -7169, -7169, -7168, -7166, -7166, -7165, 
-        -7165, -7164, -7162, -7162, -7161, -7160, -7160, -7158, -7158, -7157, -7156, -7156, 
-        -7154, -7154, -7153, -7152, -7152, -7150, -7149, -7149, -7148, -7148, -7146, -7145, 
-        -7145, -7144, -7143, -7143, -7141, -7141, -7140, -7139, -7139, -7137, -7137, -7136, 
-        -7135, -7135, -7133, -7132, -7132, -7131, -7131, -7129, -7128, -7128, -7127, -7125, 
-        -7125, -7124, -7124, -7123, -7121, -7121, -7120, -7120, -7119, -7117, -7117, -7116, 
-        -7115, -7115, -7113, -7113, -7112, -7111, -7111, -7109, -7109, -7108, -7107, -7107, 
-        -7106, -7104, -7104, -7103, -7103, -7102, -7100, -7100, -7099, -7099, -7098, -7096, 
-        -7096, -7095, -7094, -7094, -7092, -7092, -7091, -7090, -7090, -7088, -7088, -7087, 
-        -7086, -7086, -7084, -7083, -7083, -7082, -7082, -7080, -7079, -7079, -7078, -7078, 
-        -7076, -7075, -7075, -7074, -7074, -7072, -7071, -7071, -7070, -7069, -7069, -7067, 
-        -7067, -7066, -7065, -7065, -7063, -7063, -7062, -7061, -7061, -7059, -7058, -7058, 
-        -7057, -7057, -7055, -7054, -7054, -7053, -7053, -7051, -7050, -7050, -7049, -7049, 
-        -7047, -7046, -7046, -7045, -7043, -7043, -7042, -7042, -7041, -7039, -7039, -6400 
-    };
-
-    // AKWF_squ_0064 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0064[600] PROGMEM = {
-        14146, 31178, 32680, 32760, 32766, 32766, 32766, 32766, 32767, 32766, 32766, 32766, 
-        32766, 32764, 32764, 32763, 32763, 32761, 32760, 32758, 32758, 32756, 32755, 32753, 
-        32750, 32748, 32747, 32745, 32744, 32741, 32739, 32736, 32734, 32733, 32729, 32726, 
-        32725, 32721, 32720, 32717, 32714, 32710, 32709, 32706, 32702, 32699, 32696, 32695, 
-        32691, 32688, 32685, 32682, 32679, 32675, 32672, 32669, 32666, 32663, 32660, 32656, 
-        32653, 32650, 32647, 32644, 32639, 32636, 32633, 32629, 32626, 32623, 32620, 32615, 
-        32612, 32609, 32606, 32602, 32599, 32595, 32591, 32588, 32585, 32580, 32577, 32574, 
-        32571, 32566, 32563, 32560, 32556, 32552, 32549, 32545, 32542, 32537, 32534, 32531, 
-        32528, 32523, 32520, 32517, 32512, 32509, 32506, 32503, 32498, 32495, 32491, 32487, 
-        32483, 32480, 32476, 32472, 32469, 32464, 32461, 32458, 32455, 32450, 32447, 32444, 
-        32439, 32436, 32433, 32428, 32425, 32422, 32417, 32414, 32410, 32406, 32403, 32399, 
-        32395, 32391, 32388, 32385, 32380, 32377, 32374, 32369, 32366, 32363, 32358, 32355, 
-        32352, 32347, 32344, 32341, 32336, 32333, 32330, 32325, 32322, 32318, 32314, 32310, 
-        32307, 32303, 32299, 32296, 32291, 32288, 32285, 32280, 32277, 32274, 32269, 32266, 
-        32263, 32258, 32255, 32252, 32247, 32244, 32241, 32236, 32233, 32230, 32225, 32222, 
-        32218, 32214, 32211, 32207, 32203, 32199, 32196, 32193, 32188, 32185, 32182, 32177, 
-        20013, -12432, -15458, -15622, -15633, -15636, -15638, -15641, -15642, -15646, -15647, -15649, 
-        -15650, -15652, -15652, -15654, -15655, -15655, -15657, -15657, -15658, -15658, -15658, -15658, 
-        -15660, -15660, -15660, -15660, -15660, -15660, -15660, -15658, -15658, -15658, -15658, -15657, 
-        -15657, -15657, -15655, -15655, -15654, -15654, -15652, -15652, -15650, -15650, -15649, -15649, 
-        -15647, -15646, -15646, -15644, -15642, -15641, -15641, -15639, -15638, -15636, -15635, -15635, 
-        -15633, -15631, -15630, -15628, -15627, -15627, -15625, -15623, -15622, -15620, -15619, -15617, 
-        -15615, -15614, -15612, -15611, -15609, -15608, -15606, -15604, -15603, -15601, -15600, -15598, 
-        -15596, -15595, -15593, -15592, -15590, -15589, -15587, -15585, -15584, -15582, -15581, -15579, 
-        -15577, -15576, -15574, -15573, -15571, -15569, -15566, -15565, -15563, -15562, -15560, -15558, 
-        -15557, -15555, -15554, -15550, -15549, -15547, -15546, -15544, -15542, -15541, -15539, -15538, 
-        -15536, -15535, -15531, -15530, -15528, -15527, -15525, -15523, -15522, -15520, -15519, -15517, 
-        -15514, -15512, -15511, -15509, -15508, -15506, -15504, -15503, -15501, -15498, -15496, -15495, 
-        -15493, -15492, -15490, -15489, -15487, -15485, -15484, -15481, -15479, -15477, -15476, -15474, 
-        -15473, -15471, -15469, -15468, -15465, -15463, -15462, -15460, -15458, -15457, -15455, -15454, 
-        -15452, -15449, -15447, -15446, -15444, -15443, -15441, -15439, -15438, -15436, -15433, -15431, 
-        -15430, -15428, -15427, -15425, -15423, -15422, -15420, -15417, -15416, -15414, -15412, -15411, 
-        -15409, -15408, -15406, -15404, -15401, -15400, -15398, -15396, -15395, -15393, -15392, -15390, 
-        -15389, -15385, -15384, -15382, -15381, -15379, -15377, -15376, -15374, -15373, -15370, -15368, 
-        -15366, -15365, -15363, -15362, -15360, -15358, -15357, -15354, -15352, -15350, -15349, -15347, 
-        -15346, -15344, -15343, -15341, -15339, -15336, -15335, -15333, -15331, -15330, -15328, -15327, 
-        -15325, -15324, -15320, -15319, -15317, -15316, -15314, -15312, -15311, -15309, -15308, -15304, 
-        -15303, -15301, -15300, -15298, -15297, -15295, -15293, -15292, -15290, -15287, -15285, -15284, 
-        -15282, -15281, -15279, -15277, -15276, -15274, -15273, -15270, -15268, -15266, -15265, -15263, 
-        -15262, -15260, -15258, -15257, -15255, -15252, -15251, -15249, -15247, -15246, -15244, -15243, 
-        -15241, -15239, -15238, -15235, -15233, -15231, -15230, -15228, -15227, -15225, -15224, -15222, 
-        -15220, -15217, -15216, -15214, -15212, -15211, -15209, -15208, -15206, -15204, -15203, -15200, 
-        -15198, -15197, -15195, -15193, -15192, -15190, -15189, -15187, -15185, -15184, -15181, -15179, 
-        -15178, -15176, -15174, -15173, -15171, -15170, -15168, -15166, -15163, -15162, -15160, -15158, 
-        -15157, -15155, -15154, -15152, -15151, -15149, -15147, -15144, -15143, -15141, -15139, -15138, 
-        -15136, -15135, -15133, -15131, -15130, -15128, -15125, -15124, -15122, -15120, -15119, -15117, 
-        -15116, -15114, -15112, -15111, -15109, -15106, -15105, -15103, -15101, -15100, -15098, -15097, 
-        -15095, -15093, -15092, -15090, -15087, -15085, -15084, -15082, -15081, -15079, -15078, -15076, 
-        -15074, -15073, -15071, -15068, -15066, -15065, -15063, -15062, -15060, -15059, -15057, -15055, 
-        -15054, -15052, -15051, -15047, -15046, -15044, -15043, -15041, -15039, -15038, -15036, -3078 
-    };
-
-    // AKWF_squ_0065 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0065[600] PROGMEM = {
-        14593, 31635, 32695, 32753, 32759, 32761, 32761, 32763, 32765, 32765, 32765, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32765, 32765, 32765, 32763, 32763, 
-        32761, 32759, 32759, 32757, 32755, 32755, 32753, 32751, 32749, 32747, 32745, 32743, 
-        32741, 32739, 32737, 32734, 32730, 32728, 32726, 32724, 32722, 32718, 32716, 32714, 
-        32710, 32708, 32706, 32701, 32699, 32695, 32693, 32689, 32687, 32683, 32681, 32677, 
-        32675, 32670, 32668, 32664, 32662, 32658, 32656, 32652, 32648, 32646, 32641, 32639, 
-        32635, 32631, 32629, 32625, 32621, 32619, 32615, 32610, 32608, 32604, 32600, 32598, 
-        32594, 32590, 32586, 32584, 32579, 32575, 32573, 32569, 32565, 32561, 32559, 32555, 
-        32550, 32546, 32544, 32540, 32536, 32532, 32530, 32526, 32522, 32517, 32515, 32511, 
-        32507, 32503, 32501, 32497, 32493, 32488, 32486, 32482, 32478, 32474, 32472, 32468, 
-        32464, 32460, 32455, 32453, 32449, 32445, 32441, 32439, 32435, 32431, 32426, 32422, 
-        32420, 32416, 32412, 32408, 32406, 32402, 32398, 32393, 32389, 32387, 32383, 32379, 
-        32375, 32371, 32369, 32364, 32360, 32356, 32354, 32350, 32346, 32342, 32338, 32333, 
-        32331, 32327, 32323, 32319, 32317, 32313, 32309, 32305, 32300, 32298, 32294, 32290, 
-        32286, 32282, 32280, 32276, 32271, 32267, 32265, 32261, 32257, 32253, 32249, 32247, 
-        32243, 32238, 32234, 32232, 32228, 32224, 32220, 32216, 32214, 32209, 32205, 32201, 
-        32197, 32195, 32191, 32187, 32183, 32181, 32176, 32172, 32168, 32164, 32162, 32158, 
-        32154, 32150, 32147, 32143, 32139, 32135, 32131, 32129, 32125, 32121, 32116, 32114, 
-        32110, 32106, 32102, 32098, 32096, 32092, 32088, 32083, 32081, 32077, 32073, 32069, 
-        32065, 32063, 32059, 32054, 32050, 32048, 32044, 32040, 32036, 32032, 32030, 32026, 
-        32021, 32017, 32015, 32011, 32007, 32003, 31999, 31997, 31992, 31988, 31984, 31982, 
-        31978, 31974, 31970, 31968, 31964, 31959, 31955, 31951, 31949, 31945, 31941, 31937, 
-        31935, 31930, 31926, 31922, 31920, 31916, 31912, 31908, 31904, 31902, 31897, 31893, 
-        31889, 31887, 31883, 31879, 31875, 31873, 31868, 31864, 31860, 31856, 31854, 31850, 
-        9209, -27578, -30261, -30405, -30413, -30418, -30420, -30422, -30422, -30424, -30426, -30426, 
-        -30426, -30428, -30428, -30428, -30428, -30428, -30428, -30428, -30428, -30428, -30426, -30426, 
-        -30424, -30424, -30424, -30422, -30420, -30420, -30418, -30416, -30416, -30413, -30411, -30409, 
-        -30407, -30405, -30403, -30401, -30399, -30397, -30395, -30393, -30391, -30389, -30387, -30382, 
-        -30380, -30378, -30376, -30374, -30370, -30368, -30366, -30362, -30360, -30358, -30354, -30351, 
-        -30349, -30345, -30343, -30339, -30337, -30335, -30331, -30329, -30325, -30323, -30318, -30316, 
-        -30312, -30310, -30306, -30304, -30300, -30298, -30294, -30292, -30287, -30283, -30281, -30277, 
-        -30275, -30271, -30269, -30265, -30261, -30258, -30254, -30252, -30248, -30244, -30242, -30238, 
-        -30236, -30232, -30227, -30225, -30221, -30219, -30215, -30211, -30209, -30205, -30201, -30199, 
-        -30194, -30192, -30188, -30184, -30182, -30178, -30174, -30172, -30168, -30163, -30161, -30157, 
-        -30155, -30151, -30147, -30145, -30141, -30137, -30134, -30130, -30126, -30124, -30120, -30116, 
-        -30114, -30110, -30106, -30103, -30099, -30095, -30093, -30089, -30087, -30083, -30079, -30077, 
-        -30072, -30068, -30066, -30062, -30058, -30056, -30052, -30048, -30046, -30041, -30037, -30035, 
-        -30031, -30027, -30025, -30021, -30017, -30015, -30010, -30006, -30004, -30000, -29996, -29994, 
-        -29990, -29986, -29984, -29979, -29975, -29973, -29969, -29965, -29963, -29959, -29957, -29953, 
-        -29948, -29946, -29942, -29938, -29936, -29932, -29928, -29926, -29922, -29917, -29915, -29911, 
-        -29907, -29905, -29901, -29897, -29895, -29891, -29886, -29884, -29880, -29876, -29874, -29870, 
-        -29866, -29864, -29860, -29858, -29853, -29849, -29847, -29843, -29839, -29837, -29833, -29829, 
-        -29827, -29822, -29818, -29816, -29812, -29808, -29806, -29802, -29798, -29796, -29791, -29787, 
-        -29785, -29781, -29779, -29775, -29771, -29769, -29765, -29760, -29758, -29754, -29750, -29748, 
-        -29744, -29740, -29738, -29734, -29729, -29727, -29723, -29721, -29717, -29713, -29711, -29707, 
-        -29703, -29700, -29696, -29692, -29690, -29686, -29682, -29680, -29676, -29672, -29669, -29665, 
-        -29663, -29659, -29655, -29653, -29649, -29645, -29643, -29638, -29634, -29632, -29628, -29624, 
-        -29622, -29618, -29616, -29612, -29607, -29605, -29601, -29597, -29595, -29591, -29587, -29585, 
-        -29581, -29579, -29574, -29570, -29568, -29564, -29560, -29558, -29554, -29550, -29548, -29543, 
-        -29541, -29537, -29533, -29531, -29527, -29523, -29521, -29517, -29512, -29510, -28824, -7512 
-    };
-
-    // AKWF_squ_0066 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0066[600] PROGMEM = {
-        12443, 14018, 14102, 14110, 14113, 14115, 14118, 14119, 14121, 14122, 14125, 14127, 
-        14127, 14128, 14130, 14131, 14131, 14133, 14133, 14135, 14135, 14136, 14136, 14136, 
-        14136, 14136, 14136, 14136, 14136, 14136, 14136, 14136, 14136, 14136, 14135, 14135, 
-        14135, 14133, 14133, 14133, 14131, 14131, 14130, 14130, 14128, 14128, 14127, 14127, 
-        14125, 14124, 14124, 14122, 14122, 14121, 14119, 14118, 14118, 14116, 14115, 14113, 
-        14113, 14111, 14110, 14108, 14107, 14107, 14105, 14104, 14102, 14101, 14099, 14099, 
-        14098, 14096, 14095, 14093, 14091, 14090, 14088, 14087, 14085, 14085, 14084, 14082, 
-        14081, 14079, 14078, 14076, 14075, 14073, 14071, 14070, 14068, 14067, 14065, 14064, 
-        14062, 14061, 14059, 14058, 14056, 14055, 14053, 14051, 14050, 14048, 14047, 14045, 
-        14044, 14042, 14041, 14039, 14038, 14036, 14035, 14033, 14032, 14030, 14028, 14027, 
-        14025, 14024, 14022, 14021, 14019, 14018, 14016, 14015, 14013, 14012, 14010, 14008, 
-        14007, 14005, 14004, 14002, 14001, 13999, 13996, 13995, 13993, 13992, 13990, 13988, 
-        13987, 13985, 13984, 13982, 13981, 13979, 13978, 13976, 13975, 13973, 13972, 13970, 
-        13968, 13967, 13965, 13964, 13962, 13961, 13959, 13958, 13955, 13953, 13952, 13950, 
-        13948, 13947, 13945, 13944, 13942, 13941, 13939, 13938, 13936, 13935, 13933, 13932, 
-        13930, 13928, 13927, 13925, 13924, 13922, 13921, 13919, 13918, 13916, 13915, 13913, 
-        13910, 13908, 13907, 13905, 13904, 13902, 13901, 13899, 13898, 13896, 13895, 13893, 
-        13892, 13890, 13888, 13887, 13885, 13884, 13882, 13881, 13879, 13878, 13876, 13875, 
-        13873, 13872, 13870, 13869, 13867, 13865, 13862, 13861, 13859, 13858, 13856, 13855, 
-        13853, 13852, 13850, 13849, 13847, 13845, 13844, 13842, 13841, 13839, 13838, 13836, 
-        13835, 13833, 13832, 13830, 13829, 13827, 13825, 13824, 13822, 13821, 13819, 13818, 
-        13816, 13815, 13813, 13812, 13809, 13807, 13805, 13804, 13802, 13801, 13799, 13798, 
-        13796, 13795, 13793, 13792, 13790, 13789, 13787, 13785, 13784, 13782, 13781, 13779, 
-        13778, 13776, 13775, 13773, 13772, 13770, 13769, 13767, 13765, 13764, 13762, 13761, 
-        13759, 13758, 13756, 13755, 13753, 13752, 13749, 13747, 13745, 13744, 13742, 13741, 
-        13739, 13738, 13736, 13735, 13733, 13732, 13730, 13729, 13727, 13725, 13724, 13722, 
-        13721, 13719, 13718, 13716, 13715, 13713, 13712, 13710, 13709, 13707, 13706, 13704, 
-        13702, 13701, 13699, 13698, 13695, 13693, 13692, 13690, 13689, 13687, 13686, 13684, 
-        13682, 13681, 13679, 13678, 13676, 13675, 13673, 13672, 13670, 13669, 13667, 13666, 
-        13664, 13662, 13661, 13659, 13658, 13656, 13655, 13653, 13652, 13650, 13649, 13647, 
-        13646, 13644, 13642, 13641, 13639, 13638, 13636, 13635, 13633, 13632, 13630, 13629, 
-        13627, 13626, 13624, 13622, 13621, 13619, 13618, 13616, 13615, 13613, 13612, 13610, 
-        13609, 13607, 13606, 13604, 13602, 13599, 13598, 13596, 13595, 13593, 13592, 13590, 
-        13589, 13587, 13586, 13584, 13582, 13581, 13579, 13578, 13576, 13575, 13573, 13572, 
-        13570, 13569, 13567, 13566, 13564, 13562, 13561, 13559, 13558, 13556, 13555, 3478, 
-        -29109, -32572, -32755, -32766, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32766, 
-        -32766, -32764, -32764, -32763, -32761, -32761, -32760, -32758, -32757, -32755, -32754, -32752, 
-        -32749, -32748, -32746, -32743, -32741, -32740, -32737, -32735, -32732, -32731, -32728, -32724, 
-        -32723, -32720, -32717, -32714, -32712, -32709, -32706, -32703, -32700, -32697, -32694, -32691, 
-        -32688, -32684, -32681, -32678, -32675, -32672, -32669, -32666, -32663, -32660, -32657, -32654, 
-        -32651, -32646, -32643, -32640, -32637, -32634, -32631, -32626, -32623, -32620, -32617, -32612, 
-        -32609, -32606, -32603, -32598, -32595, -32592, -32588, -32585, -32581, -32578, -32574, -32571, 
-        -32568, -32563, -32560, -32557, -32552, -32549, -32546, -32541, -32538, -32535, -32531, -32528, 
-        -32525, -32520, -32517, -32512, -32509, -32506, -32501, -32498, -32495, -32491, -32488, -32485, 
-        -32480, -32477, -32472, -32469, -32466, -32461, -32458, -32454, -32451, -32448, -32443, -32440, 
-        -32437, -32432, -32429, -32425, -32422, -32418, -32414, -32411, -32406, -32403, -32400, -32395, 
-        -32392, -32388, -32385, -32382, -32377, -32374, -32369, -32366, -32363, -32358, -32355, -32351, 
-        -32348, -32345, -32340, -32337, -32332, -32329, -32326, -32322, -32318, -32314, -32311, -32308, 
-        -32303, -32300, -32295, -32292, -32289, -32285, -32282, -32277, -32274, -32271, -32266, -32263, 
-        -32259, -32255, -32252, -32248, -32245, -32240, -32237, -32234, -32229, -32226, -21039, -2015 
-    };
-
-    // AKWF_squ_0067 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0067[600] PROGMEM = {
-        4927, 8566, 8761, 8773, 8778, 8780, 8783, 8784, 8787, 8788, 8791, 8793, 
-        8794, 8797, 8798, 8799, 8801, 8801, 8802, 8804, 8805, 8805, 8806, 8806, 
-        8808, 8808, 8809, 8809, 8809, 8810, 8810, 8810, 8810, 8810, 8810, 8810, 
-        8810, 8810, 8810, 8810, 8810, 8810, 8810, 8810, 8810, 8809, 8809, 8809, 
-        8809, 8808, 8808, 8808, 8806, 8806, 8805, 8805, 8805, 8804, 8804, 8802, 
-        8802, 8801, 8801, 8801, 8799, 8798, 8798, 8797, 8797, 8795, 8795, 8794, 
-        8794, 8793, 8791, 8791, 8790, 8790, 8788, 8788, 8787, 8786, 8786, 8784, 
-        8783, 8783, 8782, 8782, 8780, 8779, 8779, 8778, 8776, 8776, 8775, 8773, 
-        8773, 8772, 8771, 8771, 8769, 8768, 8768, 8767, 8765, 8765, 8764, 8763, 
-        8761, 8761, 8760, 8758, 8758, 8757, 8756, 8756, 8754, 8753, 8752, 8752, 
-        8750, 8749, 8749, 8747, 8746, 8745, 8745, 8743, 8742, 8742, 8741, 8739, 
-        8738, 8738, 8737, 8735, 8735, 8734, 8732, 8731, 8731, 8730, 8728, 8728, 
-        8727, 8726, 8724, 8724, 8723, 8722, 8720, 8720, 8719, 8717, 8716, 8716, 
-        8715, 8713, 8713, 8712, 8711, 8709, 8709, 8708, 8706, 8705, 8705, 8704, 
-        8702, 8702, 8701, 8700, 8698, 8698, 8697, 8696, 8694, 8694, 8693, 8691, 
-        8691, 8690, 8689, 8687, 8687, 8686, 8685, 8683, 8683, 8682, 8681, 8681, 
-        8679, 8678, 8676, 8676, 8675, 8674, 8674, 8672, 8671, 8670, 8670, 8668, 
-        8667, 8665, 8665, 8664, 8663, 8663, 8661, 8660, 8659, 8659, 8657, 8656, 
-        8655, 8655, 8653, 8652, 8652, 8650, 8649, 8648, 8648, 8646, 8645, 8644, 
-        8644, 8642, 8641, 8641, 8639, 8638, 8637, 8637, 8635, 8634, 8634, 8633, 
-        8631, 8630, 8630, 8629, 8627, 8626, 8626, 8624, 8623, 8623, 8622, 8620, 
-        8619, 8619, 8618, 8616, 8616, 8615, 8614, 8612, 8612, 8611, 8609, 8608, 
-        8608, 8607, 8605, 8605, 8604, 8603, 8601, 8601, 8600, 8598, 8598, 8597, 
-        8596, 8594, 8594, 8593, 8592, 8592, 8590, 8589, 8588, 8588, 8586, 8585, 
-        8583, 8583, 8582, 8581, 8581, 8579, 8578, 8577, 8577, 8575, 8574, 8573, 
-        8573, 8571, 8570, 8568, 8568, 8567, 8566, 8566, 8564, 8563, 8562, 8562, 
-        8560, 8559, 8559, 8557, 8556, 8555, 8555, 8553, 8552, 8552, 8551, 8549, 
-        8548, 8548, 8547, 8545, 8545, 8544, 8542, 8541, 8541, 8540, 8538, 8538, 
-        8537, 8536, 8534, 8534, 8533, 8532, 8530, 8530, 8529, 8527, 8527, 8526, 
-        8525, 8523, 8523, 8522, 8521, 8521, 8519, 8518, 8518, 8516, 8515, 8514, 
-        8514, 8512, 8511, 8511, 8510, 8508, 8507, 8507, 8506, 8504, 8504, 8503, 
-        8501, 8500, 8500, 8499, 8497, 8497, 8496, 8495, 8493, 8493, 8492, 8491, 
-        8491, 8489, 8488, 8486, 8486, 8485, 8484, 8484, 8482, 8481, 8480, 8480, 
-        8478, 8477, 8477, 8475, 8474, 8473, 8473, 8471, 8470, 8470, 8469, 8467, 
-        8467, 8466, 8465, 8463, 8463, 8462, 8460, 8460, 8459, 8458, 8456, 8456, 
-        8455, 8454, 8454, 8452, 8451, 8449, 8449, 8448, 8447, 8447, 8445, 8444, 
-        8444, 8443, 8441, 8440, 8440, 8439, 8437, 8437, 8436, 8434, 8433, 8433, 
-        8432, 8430, 8430, 8429, 8428, 8426, 8426, 8425, 8424, 8424, 8422, 8421, 
-        8421, 8419, 8418, 8417, 8417, 8415, 8414, 8414, 8413, 8411, 8411, 8410, 
-        8408, 8407, 8407, 8406, 8404, 5680, -26466, -32431, -32750, -32766, -32767, -32767, 
-        -32767, -32766, -32766, -32766, -32765, -32763, -32763, -32762, -32761, -32759, -32758, -32757, 
-        -32755, -32754, -32751, -32750, -32748, -32746, -32744, -32742, -32740, -32737, -32735, -32733, 
-        -32731, -32728, -32725, -32722, -32720, -32718, -32716, -32713, -32710, -32706, -32703, -32701, 
-        -32698, -32695, -32692, -32690, -32685, -32683, -32680, -32677, -32673, -32670, -32668, -32664, 
-        -32661, -32657, -32654, -32651, -32647, -32644, -32640, -32638, -32634, -32631, -32627, -32624, 
-        -32620, -32617, -32613, -32610, -32606, -32603, -32599, -32597, -32593, -32590, -32586, -32582, 
-        -32579, -32575, -32572, -32568, -32564, -32561, -32557, -32554, -32550, -32546, -32543, -32539, 
-        -32535, -32532, -32528, -32524, -32521, -32517, -32513, -32511, -32506, -32504, -32500, -32495, 
-        -32493, -32489, -32485, -32480, -32478, -32474, -32470, -32467, -32463, -32459, -32456, -32452, 
-        -32448, -32445, -32441, -32437, -32434, -32430, -32426, -32423, -32419, -32415, -28061, -11576 
-    };
-
-    // AKWF_squ_0068 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0068[600] PROGMEM = {
-        -22930, -32250, -32741, -32766, -32767, -32767, -32766, -32766, -32765, -32764, -32763, -32761, 
-        -32760, -32759, -32758, -32757, -32754, -32753, -32752, -32749, -32747, -32746, -32743, -32741, 
-        -32740, -32737, -32735, -32732, -32730, -32727, -32725, -32721, -32719, -32716, -32714, -32712, 
-        -32708, -32705, -32703, -32699, -32697, -32693, -32691, -32687, -32685, -32681, -32679, -32675, 
-        -32673, -32669, -32665, -32663, -32659, -32656, -32653, -32649, -32646, -32642, -32640, -32636, 
-        -32632, -32629, -32625, -32623, -30435, -16116, 318, 3845, 4035, 4048, 4050, 4053, 
-        4055, 4058, 4060, 4063, 4064, 4066, 4068, 4070, 4071, 4072, 4075, 4076, 
-        4077, 4078, 4080, 4081, 4081, 4082, 4083, 4085, 4085, 4086, 4087, 4087, 
-        4088, 4088, 4089, 4089, 4089, 4091, 4091, 4091, 4092, 4092, 4092, 4092, 
-        4092, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 4093, 
-        4093, 4093, 4093, 4093, 4093, 4092, 4092, 4092, 4092, 4092, 4092, 4092, 
-        4091, 4091, 4091, 4091, 4091, 4089, 4089, 4089, 4089, 4088, 4088, 4088, 
-        4088, 4087, 4087, 4087, 4087, 4086, 4086, 4086, 4085, 4085, 4085, 4085, 
-        4083, 4083, 4083, 4082, 4082, 4082, 4081, 4081, 4081, 4080, 4080, 4080, 
-        4078, 4078, 4078, 4077, 4077, 4077, 4076, 4076, 4076, 4075, 4075, 4075, 
-        4074, 4074, 4072, 4072, 4072, 4071, 4071, 4071, 4070, 4070, 4070, 4069, 
-        4069, 4068, 4068, 4068, 4066, 4066, 4066, 4065, 4065, 4065, 4064, 4064, 
-        4063, 4063, 4063, 4061, 4061, 4061, 4060, 4060, 4059, 4059, 4059, 4058, 
-        4058, 4057, 4057, 4057, 4055, 4055, 4055, 4054, 4054, 4053, 4053, 4053, 
-        4052, 4052, 4052, 4050, 4050, 4049, 4049, 4049, 4048, 4048, 4048, 4047, 
-        4047, 4046, 4046, 4046, 4044, 4044, 4044, 4043, 4043, 4042, 4042, 4042, 
-        4041, 4041, 4040, 4040, 4040, 4038, 4038, 4038, 4037, 4037, 4036, 4036, 
-        4036, 4035, 4035, 4035, 4033, 4033, 4032, 4032, 4032, 4031, 4031, 4031, 
-        4030, 4030, 4029, 4029, 4029, 4027, 4027, 4026, 4026, 4026, 4025, 4025, 
-        4025, 4024, 4024, 4022, 4022, 4022, 4021, 4021, 4021, 4020, 4020, 4019, 
-        4019, 4019, 4018, 4018, 4018, 4016, 4016, 4015, 4015, 4015, 4014, 4014, 
-        4014, 4013, 4013, 4012, 4012, 4012, 4010, 4010, 4010, 4009, 4009, 4008, 
-        4008, 4008, 4007, 4007, 4005, 4005, 4005, 4004, 4004, 4004, 4003, 4003, 
-        4002, 4002, 4002, 4001, 4001, 4001, 3999, 3999, 3998, 3998, 3998, 3997, 
-        3997, 3997, 3996, 3996, 3995, 3995, 3995, 3993, 3993, 3993, 3992, 3992, 
-        3991, 3991, 3991, 3990, 3990, 3988, 3988, 3988, 3987, 3987, 3986, 3986, 
-        3986, 3985, 3985, 3985, 3984, 3984, 3982, 3982, 3982, 3981, 3981, 3981, 
-        3980, 3980, 3979, 3979, 3979, 3977, 3977, 3977, 3976, 3976, 3975, 3975, 
-        3975, 3974, 3974, 3974, 3973, 3973, 3971, 3971, 3971, 3970, 3970, 3970, 
-        3969, 3969, 3968, 3968, 3968, 3967, 3967, 3967, 3965, 3965, 3964, 3964, 
-        3964, 3963, 3963, 3963, 3962, 3962, 3960, 3960, 3960, 3959, 3959, 3959, 
-        3958, 3958, 3958, 3957, 3957, 3956, 3956, 3956, 3954, 3954, 3954, 3953, 
-        3953, 3952, 3952, 3952, 3951, 3951, 3951, 3949, 3949, 3948, 3948, 3948, 
-        3947, 3947, 3947, 3946, 3946, 3945, 3945, 3945, 3943, 3943, 3943, 3942, 
-        3942, 3941, 3941, 3941, 3940, 3940, 3940, 3939, 3939, 3939, 3937, 3937, 
-        3936, 3936, 3936, 3935, 3935, 3935, 3934, 3934, 3932, 3932, 3932, 3931, 
-        3931, 3931, 3930, 3930, 3929, 3929, 3929, 3928, 3928, 3928, 3926, 3926, 
-        3926, 3925, 3925, 3924, 3924, 3924, 3923, 3923, 3923, 3921, 3921, 3920, 
-        3920, 3920, 3919, 3919, 3919, 3918, 3918, 3918, 3917, 3917, 3915, 3915, 
-        3915, 3914, 3914, 3914, 3913, 3913, 3912, 3912, 3912, 3911, 3911, 3911, 
-        3909, 3909, 3909, 3908, 3908, 3907, 3907, 3907, 3906, 3906, 3906, 3904, 
-        3904, 3903, 3903, 3903, 3902, 3902, 3902, 3901, 3901, 3901, 3900, 3900, 
-        3898, 3898, 3898, 3897, 3897, 3897, 3896, 3896, 3896, 3895, 3895, 3894, 
-        3894, 3894, 3892, 3892, 3892, 3891, 3891, 3890, 3890, 3890, 3889, 3889, 
-        3889, 3887, 3887, 3887, 3886, 3886, 3885, 3885, 3885, 3884, 3884, 2163 
-    };
-
-    // AKWF_squ_0069 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0069[600] PROGMEM = {
-        -13984, -31605, -32706, -32765, -32767, -32766, -32766, -32765, -32764, -32763, -32762, -32761, 
-        -32760, -32757, -32756, -32755, -32753, -32751, -32749, -32747, -32745, -32743, -32097, -20302, 
-        -6262, 923, 1304, 1327, 1329, 1332, 1333, 1335, 1336, 1337, 1339, 1341, 
-        1342, 1343, 1344, 1345, 1346, 1347, 1347, 1349, 1350, 1351, 1351, 1352, 
-        1353, 1353, 1354, 1354, 1355, 1355, 1356, 1356, 1358, 1358, 1358, 1359, 
-        1359, 1359, 1360, 1360, 1360, 1360, 1361, 1361, 1361, 1361, 1361, 1362, 
-        1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1363, 1363, 1363, 1363, 
-        1363, 1363, 1363, 1363, 1363, 1363, 1363, 1363, 1363, 1363, 1363, 1363, 
-        1363, 1363, 1363, 1363, 1363, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 
-        1362, 1362, 1362, 1362, 1362, 1362, 1362, 1361, 1361, 1361, 1361, 1361, 
-        1361, 1361, 1361, 1361, 1361, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 
-        1360, 1360, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1358, 
-        1358, 1358, 1358, 1358, 1358, 1358, 1358, 1356, 1356, 1356, 1356, 1356, 
-        1356, 1356, 1356, 1355, 1355, 1355, 1355, 1355, 1355, 1355, 1354, 1354, 
-        1354, 1354, 1354, 1354, 1354, 1354, 1353, 1353, 1353, 1353, 1353, 1353, 
-        1353, 1352, 1352, 1352, 1352, 1352, 1352, 1352, 1351, 1351, 1351, 1351, 
-        1351, 1351, 1351, 1350, 1350, 1350, 1350, 1350, 1350, 1350, 1350, 1349, 
-        1349, 1349, 1349, 1349, 1349, 1349, 1347, 1347, 1347, 1347, 1347, 1347, 
-        1347, 1347, 1346, 1346, 1346, 1346, 1346, 1346, 1346, 1345, 1345, 1345, 
-        1345, 1345, 1345, 1345, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 
-        1343, 1343, 1343, 1343, 1343, 1343, 1343, 1342, 1342, 1342, 1342, 1342, 
-        1342, 1342, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1339, 1339, 
-        1339, 1339, 1339, 1339, 1339, 1338, 1338, 1338, 1338, 1338, 1338, 1338, 
-        1338, 1337, 1337, 1337, 1337, 1337, 1337, 1337, 1336, 1336, 1336, 1336, 
-        1336, 1336, 1336, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1334, 
-        1334, 1334, 1334, 1334, 1334, 1334, 1333, 1333, 1333, 1333, 1333, 1333, 
-        1333, 1333, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 1330, 1330, 1330, 
-        1330, 1330, 1329, 1329, 1329, 1329, 1329, 1329, 1329, 1329, 1328, 1328, 
-        1328, 1328, 1328, 1328, 1328, 1327, 1327, 1327, 1327, 1327, 1327, 1327, 
-        1327, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1325, 1325, 1325, 1325, 
-        1325, 1325, 1325, 1325, 1324, 1324, 1324, 1324, 1324, 1324, 1324, 1323, 
-        1323, 1323, 1323, 1323, 1323, 1323, 1323, 1321, 1321, 1321, 1321, 1321, 
-        1321, 1321, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 1319, 1319, 1319, 
-        1319, 1319, 1319, 1319, 1319, 1318, 1318, 1318, 1318, 1318, 1318, 1318, 
-        1317, 1317, 1317, 1317, 1317, 1317, 1317, 1317, 1316, 1316, 1316, 1316, 
-        1316, 1316, 1316, 1315, 1315, 1315, 1315, 1315, 1315, 1315, 1315, 1313, 
-        1313, 1313, 1313, 1313, 1313, 1313, 1312, 1312, 1312, 1312, 1312, 1312, 
-        1312, 1312, 1311, 1311, 1311, 1311, 1311, 1311, 1311, 1311, 1310, 1310, 
-        1310, 1310, 1310, 1310, 1310, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 
-        1309, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1307, 1307, 1307, 1307, 
-        1307, 1307, 1307, 1307, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1304, 
-        1304, 1304, 1304, 1304, 1304, 1304, 1304, 1303, 1303, 1303, 1303, 1303, 
-        1303, 1303, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1301, 1301, 
-        1301, 1301, 1301, 1301, 1301, 1301, 1300, 1300, 1300, 1300, 1300, 1300, 
-        1300, 1299, 1299, 1299, 1299, 1299, 1299, 1299, 1299, 1298, 1298, 1298, 
-        1298, 1298, 1298, 1298, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 
-        1295, 1295, 1295, 1295, 1295, 1295, 1295, 1295, 1294, 1294, 1294, 1294, 
-        1294, 1294, 1294, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1292, 
-        1292, 1292, 1292, 1292, 1292, 1292, 1292, 1291, 1291, 1291, 1291, 1291, 
-        1291, 1291, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1289, 1289 
-    };
-
-    // AKWF_squ_0070 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0070[600] PROGMEM = {
-        -456, -25889, -32404, -32750, -32767, -32767, -32766, -32765, -32765, -32764, -32763, -29374, 
-        -16008, -1674, 507, 624, 631, 632, 634, 635, 636, 637, 637, 638, 
-        639, 639, 640, 641, 641, 642, 642, 644, 644, 645, 645, 646, 
-        646, 646, 647, 647, 647, 648, 648, 648, 649, 649, 649, 649, 
-        650, 650, 650, 650, 650, 651, 651, 651, 651, 651, 651, 651, 
-        651, 652, 652, 652, 652, 652, 652, 652, 652, 652, 652, 652, 
-        652, 652, 652, 652, 652, 652, 652, 652, 652, 652, 652, 652, 
-        652, 652, 652, 652, 652, 652, 652, 652, 652, 652, 652, 652, 
-        652, 652, 652, 652, 652, 652, 652, 652, 652, 652, 652, 652, 
-        652, 652, 652, 652, 652, 652, 652, 652, 651, 651, 651, 651, 
-        651, 651, 651, 651, 651, 651, 651, 651, 651, 651, 651, 651, 
-        651, 651, 651, 650, 650, 650, 650, 650, 650, 650, 650, 650, 
-        650, 650, 650, 650, 650, 650, 650, 649, 649, 649, 649, 649, 
-        649, 649, 649, 649, 649, 649, 649, 649, 649, 648, 648, 648, 
-        648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 
-        647, 647, 647, 647, 647, 647, 647, 647, 647, 647, 647, 647, 
-        647, 647, 647, 646, 646, 646, 646, 646, 646, 646, 646, 646, 
-        646, 646, 646, 646, 646, 646, 645, 645, 645, 645, 645, 645, 
-        645, 645, 645, 645, 645, 645, 645, 645, 645, 644, 644, 644, 
-        644, 644, 644, 644, 644, 644, 644, 644, 644, 644, 644, 644, 
-        642, 642, 642, 642, 642, 642, 642, 642, 642, 642, 642, 642, 
-        642, 642, 642, 642, 641, 641, 641, 641, 641, 641, 641, 641, 
-        641, 641, 641, 641, 641, 641, 641, 640, 640, 640, 640, 640, 
-        640, 640, 640, 640, 640, 640, 640, 640, 640, 640, 639, 639, 
-        639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 
-        639, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 
-        637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 637, 
-        637, 637, 637, 636, 636, 636, 636, 636, 636, 636, 636, 636, 
-        636, 636, 636, 636, 636, 636, 635, 635, 635, 635, 635, 635, 
-        635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 634, 634, 
-        634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 
-        634, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 
-        632, 632, 632, 632, 631, 631, 631, 631, 631, 631, 631, 631, 
-        631, 631, 631, 631, 631, 631, 631, 630, 630, 630, 630, 630, 
-        630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 629, 
-        629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 
-        629, 629, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 
-        628, 628, 628, 628, 628, 628, 627, 627, 627, 627, 627, 627, 
-        627, 627, 627, 627, 627, 627, 627, 627, 627, 626, 626, 626, 
-        626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 
-        625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 
-        625, 625, 625, 625, 624, 624, 624, 624, 624, 624, 624, 624, 
-        624, 624, 624, 624, 624, 624, 624, 622, 622, 622, 622, 622, 
-        622, 622, 622, 622, 622, 622, 622, 622, 622, 622, 622, 621, 
-        621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 
-        621, 621, 621, 620, 620, 620, 620, 620, 620, 620, 620, 620, 
-        620, 620, 620, 620, 620, 620, 619, 619, 619, 619, 619, 619, 
-        619, 619, 619, 619, 619, 619, 619, 619, 619, 619, 618, 618, 
-        618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 618, 
-        618, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617 
-    };
-
-    // AKWF_squ_0071 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0071[600] PROGMEM = {
-        0, 6555, 13108, 19661, 26214, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        0, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767 
-    };
-
-    // AKWF_squ_0072 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0072[600] PROGMEM = {
-        0, 3277, 6555, 9830, 13108, 16384, 19661, 22939, 26214, 29492, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        0, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767 
-    };
-
-} // namespace AKWF_BwSqu
@@ -1,224 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwSqu {
-
-    // AKWF_squ_0097 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0097[600] PROGMEM = {
-        125, 254, 379, 505, 631, 757, 882, 1008, 1134, 1260, 1386, 1511, 
-        1640, 1765, 1891, 2017, 2143, 2269, 2394, 2520, 2646, 2772, 2897, 3026, 
-        3152, 3277, 3403, 3529, 3655, 3780, 3906, 4032, 4158, 4284, 4412, 4538, 
-        4663, 4789, 4915, 5041, 5169, 5295, 5421, 5546, 5672, 5798, 5924, 6049, 
-        6175, 6301, 6427, 6555, 6681, 6807, 6932, 7058, 7184, 7310, 7436, 7561, 
-        7687, 7813, 7941, 8067, 8193, 8319, 8444, 8570, 8696, 8822, 8947, 9073, 
-        9199, 9327, 9453, 9579, 9705, 9830, 9956, 10082, 10210, 10336, 10462, 10588, 
-        10713, 10839, 10965, 11091, 11216, 11342, 11468, 11596, 11722, 11848, 11974, 12099, 
-        12225, 12351, 12477, 12603, 12728, 12854, 12982, 13108, 13234, 13360, 13486, 13611, 
-        13737, 13863, 13989, 14117, 14243, 14369, 14494, 14620, 14746, 14872, 14997, 15123, 
-        15252, 15377, 15503, 15629, 15755, 15880, 16006, 16132, 16258, 16384, 16509, 16638, 
-        16763, 16889, 17015, 17141, 17266, 17392, 17518, 17644, 17770, 17895, 18024, 18149, 
-        18275, 18401, 18527, 18653, 18781, 18907, 19032, 19158, 19284, 19410, 19536, 19661, 
-        19787, 19913, 20039, 20167, 20293, 20419, 20544, 20670, 20796, 20922, 21047, 21173, 
-        21299, 21425, 21553, 21679, 21805, 21930, 22056, 22182, 22308, 22433, 22559, 22685, 
-        22811, 22939, 23065, 23191, 23316, 23442, 23568, 23694, 23822, 23948, 24074, 24199, 
-        24325, 24451, 24577, 24703, 24828, 24954, 25080, 25208, 25334, 25460, 25586, 25711, 
-        25837, 25963, 26089, 26214, 26340, 26466, 26594, 26720, 26846, 26972, 27097, 27223, 
-        27349, 27475, 27600, 27726, 27852, 27980, 28106, 28232, 28358, 28483, 28609, 28735, 
-        28863, 28989, 29115, 29241, 29366, 29492, 29618, 29744, 29870, 29995, 30121, 30249, 
-        30375, 30501, 30627, 30753, 30878, 31004, 31130, 31256, 31381, 31507, 31636, 31761, 
-        31887, 32013, 32139, 32264, 32390, 32516, 32642, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 0, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 0 
-    };
-
-    // AKWF_squ_0098 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0098[600] PROGMEM = {
-        123, 243, 364, 485, 605, 728, 849, 970, 1093, 1214, 1334, 1457, 
-        1578, 1699, 1819, 1943, 2063, 2184, 2305, 2428, 2548, 2669, 2792, 2913, 
-        3033, 3157, 3277, 3398, 3519, 3642, 3762, 3883, 4004, 4127, 4248, 4368, 
-        4491, 4612, 4733, 4856, 4977, 5097, 5218, 5341, 5462, 5582, 5703, 5826, 
-        5947, 6067, 6191, 6311, 6432, 6555, 6676, 6796, 6917, 7038, 7161, 7282, 
-        7402, 7525, 7646, 7767, 7890, 8011, 8131, 8252, 8375, 8496, 8616, 8737, 
-        8860, 8981, 9101, 9225, 9345, 9466, 9589, 9710, 9830, 9951, 10074, 10195, 
-        10316, 10436, 10559, 10680, 10801, 10924, 11045, 11165, 11288, 11409, 11530, 11650, 
-        11773, 11894, 12015, 12135, 12259, 12379, 12502, 12623, 12744, 12864, 12985, 13108, 
-        13229, 13350, 13470, 13593, 13714, 13835, 13958, 14078, 14199, 14322, 14443, 14564, 
-        14684, 14807, 14928, 15049, 15169, 15293, 15413, 15534, 15657, 15778, 15898, 16022, 
-        16142, 16263, 16384, 16507, 16627, 16748, 16869, 16992, 17112, 17236, 17356, 17477, 
-        17598, 17721, 17841, 17962, 18083, 18203, 18327, 18447, 18568, 18691, 18812, 18935, 
-        19056, 19176, 19297, 19417, 19541, 19661, 19782, 19903, 20026, 20146, 20267, 20390, 
-        20511, 20632, 20755, 20875, 20996, 21117, 21240, 21361, 21481, 21602, 21725, 21846, 
-        21969, 22090, 22210, 22331, 22454, 22575, 22695, 22816, 22939, 23060, 23180, 23301, 
-        23424, 23545, 23668, 23789, 23909, 24030, 24153, 24274, 24395, 24515, 24636, 24759, 
-        24880, 25003, 25124, 25244, 25365, 25488, 25609, 25729, 25850, 25973, 26094, 26214, 
-        26335, 26458, 26579, 26702, 26823, 26943, 27064, 27187, 27308, 27429, 27549, 27672, 
-        27793, 27914, 28034, 28157, 28278, 28401, 28522, 28643, 28763, 28886, 29007, 29128, 
-        29248, 29369, 29492, 29613, 29736, 29857, 29977, 30101, 30221, 30342, 30463, 30583, 
-        30706, 30827, 30948, 31068, 31191, 31312, 31435, 31556, 31677, 31797, 31920, 32041, 
-        32162, 32282, 32406, 32526, 32647, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 0, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 0 
-    };
-
-    // AKWF_squ_0099 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0099[600] PROGMEM = {
-        118, 236, 351, 469, 585, 703, 818, 936, 1054, 1170, 1288, 1404, 
-        1522, 1640, 1755, 1873, 1989, 2107, 2222, 2340, 2459, 2574, 2692, 2808, 
-        2926, 3044, 3159, 3277, 3393, 3511, 3629, 3744, 3863, 3978, 4096, 4212, 
-        4330, 4448, 4563, 4681, 4799, 4915, 5033, 5149, 5267, 5385, 5500, 5618, 
-        5734, 5852, 5970, 6085, 6204, 6319, 6437, 6555, 6671, 6789, 6904, 7022, 
-        7138, 7256, 7374, 7489, 7608, 7723, 7841, 7959, 8075, 8193, 8308, 8426, 
-        8542, 8660, 8778, 8894, 9012, 9127, 9245, 9363, 9481, 9597, 9715, 9830, 
-        9948, 10064, 10182, 10300, 10416, 10534, 10649, 10767, 10885, 11001, 11119, 11234, 
-        11353, 11468, 11586, 11704, 11820, 11938, 12053, 12171, 12289, 12405, 12523, 12639, 
-        12757, 12872, 12990, 13108, 13224, 13342, 13457, 13575, 13693, 13809, 13927, 14043, 
-        14161, 14279, 14394, 14512, 14630, 14746, 14864, 14979, 15098, 15216, 15331, 15449, 
-        15565, 15683, 15798, 15916, 16034, 16150, 16268, 16384, 16502, 16620, 16735, 16853, 
-        16969, 17087, 17202, 17320, 17438, 17554, 17672, 17788, 17906, 18024, 18139, 18257, 
-        18373, 18491, 18609, 18724, 18843, 18961, 19076, 19194, 19310, 19428, 19546, 19661, 
-        19779, 19895, 20013, 20128, 20247, 20365, 20480, 20598, 20714, 20832, 20950, 21065, 
-        21183, 21299, 21417, 21535, 21651, 21769, 21884, 22002, 22118, 22236, 22354, 22469, 
-        22588, 22703, 22821, 22939, 23055, 23173, 23288, 23406, 23524, 23640, 23758, 23876, 
-        23992, 24110, 24225, 24343, 24461, 24577, 24695, 24810, 24928, 25044, 25162, 25280, 
-        25396, 25514, 25629, 25747, 25865, 25981, 26099, 26214, 26332, 26448, 26566, 26684, 
-        26800, 26918, 27033, 27151, 27269, 27385, 27503, 27618, 27737, 27852, 27970, 28088, 
-        28206, 28322, 28440, 28555, 28673, 28792, 28907, 29025, 29141, 29259, 29374, 29492, 
-        29610, 29726, 29844, 29959, 30077, 30196, 30311, 30429, 30545, 30663, 30778, 30896, 
-        31014, 31130, 31248, 31363, 31482, 31600, 31715, 31833, 31949, 32067, 32182, 32300, 
-        32418, 32534, 32652, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 0, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 0 
-    };
-
-    // AKWF_squ_0100 → 600 samples
-    static const int16_t akwf_akwf_bwsqu_akwf_squ_0100[600] PROGMEM = {
-        112, 225, 338, 451, 564, 677, 790, 903, 1016, 1129, 1242, 1355, 
-        1468, 1581, 1694, 1807, 1919, 2032, 2145, 2261, 2374, 2487, 2600, 2713, 
-        2826, 2939, 3051, 3164, 3277, 3390, 3503, 3616, 3729, 3842, 3955, 4068, 
-        4181, 4294, 4407, 4520, 4633, 4746, 4858, 4971, 5084, 5197, 5310, 5423, 
-        5536, 5649, 5762, 5875, 5988, 6101, 6214, 6327, 6440, 6555, 6668, 6781, 
-        6894, 7007, 7120, 7233, 7346, 7459, 7572, 7685, 7797, 7910, 8023, 8136, 
-        8249, 8362, 8475, 8588, 8701, 8814, 8927, 9040, 9153, 9266, 9379, 9492, 
-        9605, 9717, 9830, 9943, 10056, 10169, 10282, 10395, 10508, 10621, 10734, 10849, 
-        10960, 11073, 11186, 11299, 11412, 11525, 11637, 11750, 11863, 11976, 12089, 12202, 
-        12315, 12428, 12544, 12656, 12769, 12882, 12995, 13108, 13221, 13334, 13447, 13560, 
-        13673, 13786, 13899, 14012, 14125, 14238, 14351, 14464, 14576, 14689, 14802, 14915, 
-        15028, 15141, 15254, 15367, 15480, 15593, 15706, 15819, 15932, 16045, 16158, 16271, 
-        16384, 16496, 16609, 16722, 16835, 16951, 17064, 17177, 17290, 17403, 17515, 17628, 
-        17741, 17854, 17967, 18080, 18193, 18306, 18419, 18532, 18645, 18758, 18871, 18984, 
-        19097, 19210, 19323, 19435, 19548, 19661, 19774, 19887, 20000, 20113, 20226, 20339, 
-        20452, 20565, 20678, 20791, 20904, 21017, 21130, 21245, 21358, 21471, 21584, 21697, 
-        21810, 21920, 22033, 22146, 22259, 22372, 22485, 22598, 22711, 22824, 22939, 23052, 
-        23165, 23278, 23391, 23504, 23617, 23730, 23843, 23956, 24069, 24181, 24294, 24407, 
-        24520, 24633, 24746, 24859, 24972, 25085, 25198, 25311, 25424, 25537, 25650, 25763, 
-        25876, 25989, 26101, 26214, 26327, 26440, 26553, 26666, 26779, 26892, 27005, 27118, 
-        27233, 27346, 27459, 27572, 27685, 27798, 27911, 28024, 28137, 28250, 28363, 28476, 
-        28589, 28702, 28815, 28928, 29040, 29153, 29266, 29379, 29492, 29605, 29718, 29831, 
-        29944, 30057, 30170, 30283, 30396, 30509, 30622, 30735, 30848, 30960, 31073, 31186, 
-        31299, 31412, 31528, 31641, 31754, 31867, 31979, 32092, 32205, 32318, 32431, 32544, 
-        32657, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 0, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 0 
-    };
-
-} // namespace AKWF_BwSqu
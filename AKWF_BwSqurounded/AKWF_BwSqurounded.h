@@ -1,72 +1,905 @@
-// Auto‑generated AKWF bank. Do not edit manually.
+// Auto‑generated AKWF bank (compressed, see AKWFCodec.h). Do not edit manually.
 
 #pragma once
 #include <Arduino.h>
 
-#include "AKWF_BwSqurounded_Tables_Part0.h"
-#include "AKWF_BwSqurounded_Tables_Part1.h"
-#include "AKWF_BwSqurounded_Tables_Part2.h"
-
 namespace AKWF_BwSqurounded {
+
     constexpr uint16_t count = 52;
-}
 
-// Return a pointer to the n‑th waveform table in this bank.
-// If index is out of range, returns nullptr and length is set to 0.
-inline const int16_t* AKWF_BwSqurounded_get(uint16_t index, uint16_t &length) {
-    switch(index) {
-        case 0: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_01;
-        case 1: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_02;
-        case 2: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_03;
-        case 3: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_04;
-        case 4: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_05;
-        case 5: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_06;
-        case 6: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_07;
-        case 7: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_08;
-        case 8: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_09;
-        case 9: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_10;
-        case 10: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_11;
-        case 11: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_12;
-        case 12: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_13;
-        case 13: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_14;
-        case 14: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_15;
-        case 15: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_16;
-        case 16: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_17;
-        case 17: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_18;
-        case 18: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_19;
-        case 19: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_20;
-        case 20: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_21;
-        case 21: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_22;
-        case 22: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_23;
-        case 23: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_24;
-        case 24: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_25;
-        case 25: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rasymsqu_26;
-        case 26: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_01;
-        case 27: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_02;
-        case 28: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_03;
-        case 29: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_04;
-        case 30: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_05;
-        case 31: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_06;
-        case 32: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_07;
-        case 33: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_08;
-        case 34: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_09;
-        case 35: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_10;
-        case 36: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_11;
-        case 37: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_12;
-        case 38: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_13;
-        case 39: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_14;
-        case 40: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_15;
-        case 41: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_16;
-        case 42: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_17;
-        case 43: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_18;
-        case 44: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_19;
-        case 45: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_20;
-        case 46: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_21;
-        case 47: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_22;
-        case 48: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_23;
-        case 49: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_24;
-        case 50: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_25;
-        case 51: length = 600; return AKWF_BwSqurounded::akwf_akwf_bwsqurounded_akwf_rsymsqu_26;
-        default: length = 0; return nullptr;
-    }
-}
+    // 62400 bytes as int16 → 13352 bytes
+
+    static const uint8_t data[13352] PROGMEM = {
+        0x02, 0x4F, 0xFF, 0xF0, 0x7F, 0xFF, 0x60, 0x0A, 0x10, 0x00, 0x49, 0x11, 0x8A, 0x73, 0x14, 0x02,
+        0x01, 0xD0, 0x9E, 0xF9, 0xA3, 0x3B, 0xC2, 0x90, 0x2F, 0x16, 0x02, 0x37, 0x89, 0x19, 0xD1, 0x5D,
+        0x48, 0x17, 0x8B, 0x00, 0x4D, 0x5A, 0x24, 0xAE, 0xA4, 0x14, 0x2F, 0x16, 0x04, 0xD5, 0x96, 0x24,
+        0xCD, 0x4E, 0x32, 0x85, 0xE2, 0xE9, 0x91, 0xEF, 0x86, 0xA4, 0x77, 0x9A, 0x30, 0x47, 0x48, 0x81,
+        0xD3, 0xCD, 0x77, 0x9B, 0xC1, 0xD6, 0x0E, 0x9E, 0x74, 0x3B, 0xE6, 0xF3, 0xA6, 0x04, 0x20, 0xA3,
+        0x28, 0x90, 0x0A, 0xEB, 0xE7, 0xEB, 0xEA, 0x98, 0x6F, 0xC7, 0x5D, 0xF5, 0xD7, 0x7A, 0xF3, 0xAE,
+        0x79, 0x63, 0x9D, 0xA7, 0x5D, 0xEB, 0x5B, 0xD6, 0xAF, 0xA8, 0x6A, 0xEA, 0xF7, 0x52, 0xB9, 0xBE,
+        0xC4, 0xD8, 0xE4, 0x58, 0xB9, 0x16, 0x21, 0xDD, 0x63, 0xA1, 0xA8, 0x4F, 0x49, 0x54, 0x99, 0xC1,
+        0x57, 0x83, 0x38, 0x33, 0x81, 0x77, 0xC1, 0x8C, 0x1F, 0x37, 0x9B, 0xC0, 0x62, 0x79, 0xDF, 0x00,
+        0x0F, 0x3B, 0xC8, 0x11, 0xD6, 0x74, 0x42, 0xAB, 0xC0, 0x03, 0x17, 0x44, 0x85, 0x4D, 0x04, 0x55,
+        0x0B, 0xF5, 0x91, 0x43, 0x01, 0xF8, 0xEF, 0x3C, 0xDE, 0x00, 0x05, 0x80, 0x0E, 0xAE, 0x82, 0x38,
+        0x9A, 0x03, 0x05, 0x78, 0x00, 0xAC, 0x5D, 0x0D, 0x67, 0x13, 0x40, 0x86, 0x2F, 0x00, 0x0A, 0x9C,
+        0x14, 0x71, 0x34, 0x41, 0x11, 0x8B, 0xC0, 0x15, 0x38, 0xBA, 0x54, 0x53, 0x57, 0xA2, 0x31, 0x78,
+        0x98, 0x58, 0xB1, 0x43, 0x06, 0x73, 0x78, 0x44, 0x9C, 0x18, 0x20, 0x78, 0x77, 0x93, 0x9B, 0xCD,
+        0xE4, 0x42, 0x54, 0x2F, 0x00, 0x62, 0xEA, 0x70, 0x0A, 0x08, 0x61, 0x25, 0x41, 0x00, 0x8D, 0x36,
+        0x4C, 0xD9, 0xB1, 0x60, 0xC9, 0x62, 0x60, 0xB2, 0xCC, 0x0C, 0xD0, 0xCA, 0x26, 0x92, 0x87, 0x3A,
+        0x87, 0x38, 0xF0, 0xB5, 0xA1, 0xB0, 0x6D, 0x06, 0x86, 0x0D, 0x06, 0x86, 0x04, 0x2B, 0x03, 0xA1,
+        0x81, 0x8A, 0x18, 0x03, 0x14, 0x31, 0x9C, 0x0E, 0x40, 0x7E, 0x3B, 0xC8, 0x55, 0x68, 0xE2, 0xD5,
+        0x5A, 0xAB, 0x55, 0x60, 0x63, 0x12, 0x77, 0x9B, 0xCD, 0x18, 0x74, 0xB1, 0x60, 0x00, 0x2F, 0x12,
+        0x42, 0xCE, 0xB2, 0x30, 0x77, 0xCE, 0x81, 0xDF, 0x35, 0x37, 0x83, 0xA3, 0x1D, 0x3C, 0x02, 0x47,
+        0x7F, 0xFF, 0xFF, 0xFF, 0x70, 0xC2, 0x10, 0x8C, 0x00, 0x28, 0xC0, 0x01, 0x84, 0x62, 0x50, 0xDA,
+        0x0F, 0x79, 0xA6, 0xCD, 0x12, 0xE7, 0x63, 0xAC, 0xAC, 0xDD, 0xE5, 0x1D, 0x09, 0xD5, 0x26, 0xAB,
+        0x34, 0x13, 0x66, 0x91, 0xBB, 0xCD, 0x28, 0x68, 0xC6, 0xC7, 0x62, 0xA5, 0x15, 0x12, 0x6A, 0xE6,
+        0xDE, 0x6D, 0xCD, 0x9B, 0xC1, 0xDB, 0x95, 0x52, 0x6E, 0x7B, 0xCA, 0xC1, 0xDC, 0xB7, 0x2A, 0xC7,
+        0xBC, 0xA0, 0x0E, 0x93, 0x46, 0x15, 0x9B, 0x96, 0x74, 0x79, 0x4D, 0xC5, 0xB9, 0x58, 0x6C, 0x50,
+        0x03, 0x31, 0x53, 0x87, 0x7F, 0x7F, 0x2F, 0x1E, 0xFD, 0x79, 0xF4, 0xE3, 0xBD, 0x31, 0xD7, 0x3D,
+        0xB3, 0xC3, 0x4C, 0x6B, 0x95, 0xAD, 0x3C, 0x2B, 0x29, 0x5F, 0x72, 0xEE, 0x65, 0xB9, 0x64, 0x96,
+        0x0A, 0x69, 0x97, 0x08, 0xBA, 0x34, 0xE2, 0x68, 0xA1, 0xD2, 0x29, 0x40, 0xA9, 0xD3, 0xC3, 0xA1,
+        0xC1, 0xF1, 0xE1, 0x86, 0x4C, 0x38, 0xF0, 0x4C, 0x38, 0x60, 0x7C, 0xB9, 0x93, 0x1F, 0x05, 0x39,
+        0x87, 0x07, 0x87, 0x26, 0x39, 0x03, 0x6F, 0x1F, 0xBC, 0x7B, 0x79, 0xE0, 0xAA, 0x00, 0x58, 0x9A,
+        0x14, 0x68, 0x43, 0xC0, 0xB3, 0x91, 0xC8, 0xF3, 0x9B, 0x9C, 0x04, 0x7C, 0x90, 0x79, 0x24, 0x78,
+        0x1C, 0x78, 0x23, 0x33, 0x9B, 0xC3, 0x03, 0x8C, 0xC4, 0x67, 0x19, 0x21, 0x84, 0x90, 0x79, 0x09,
+        0x3A, 0x89, 0xA8, 0x74, 0x6A, 0x6A, 0x1C, 0x12, 0x48, 0x1A, 0x7A, 0x98, 0x46, 0x9C, 0x40, 0xDC,
+        0x91, 0x9E, 0x6E, 0x01, 0xC1, 0xE0, 0x91, 0x32, 0x3C, 0xB8, 0xF9, 0xB8, 0x70, 0x6C, 0x99, 0x72,
+        0x27, 0x18, 0x66, 0xF1, 0x4A, 0x85, 0x43, 0x02, 0xB5, 0x4A, 0x13, 0x24, 0x4A, 0x89, 0x02, 0x23,
+        0x8C, 0x3C, 0x7C, 0x32, 0xE5, 0xA5, 0x36, 0xB5, 0xA1, 0x95, 0x1A, 0x18, 0x32, 0x16, 0x2A, 0xA2,
+        0x2A, 0x12, 0x50, 0x2A, 0x61, 0x0E, 0x56, 0x66, 0xCD, 0xCB, 0xCD, 0xB9, 0xA8, 0xC5, 0xA6, 0xF3,
+        0xDC, 0xEE, 0x6D, 0x27, 0x46, 0x69, 0x4A, 0xD3, 0x66, 0x94, 0xD1, 0x28, 0x7B, 0x96, 0xB6, 0x76,
+        0x1B, 0x44, 0xD2, 0x69, 0xA8, 0x02, 0x5F, 0xFF, 0xB9, 0xDE, 0x14, 0x10, 0x43, 0x0C, 0x11, 0x41,
+        0x14, 0x21, 0xC0, 0x1C, 0x01, 0x75, 0x74, 0xE8, 0x6E, 0xCB, 0xAD, 0x19, 0xB5, 0xD9, 0x76, 0x6A,
+        0x76, 0x6A, 0x27, 0x65, 0x6D, 0x9A, 0xAD, 0x3B, 0x83, 0xDE, 0x7B, 0x35, 0x52, 0xD1, 0x6A, 0x2A,
+        0x6C, 0xB4, 0xB3, 0x6C, 0x5A, 0x2C, 0xB4, 0xA5, 0x9A, 0x2A, 0x23, 0xB9, 0x68, 0x56, 0x76, 0x33,
+        0xB1, 0x12, 0xD8, 0xA9, 0x45, 0x9B, 0x34, 0x33, 0xA8, 0xE2, 0x9D, 0x61, 0x55, 0x94, 0x50, 0xA5,
+        0xCA, 0x2C, 0xA2, 0xCD, 0xE6, 0xAC, 0x2C, 0x42, 0x90, 0x60, 0x00, 0xC0, 0x06, 0xED, 0xF9, 0x7E,
+        0x3F, 0x7F, 0x97, 0xBF, 0xAD, 0x38, 0xF7, 0xE9, 0xCF, 0x86, 0xFB, 0xE5, 0x96, 0x77, 0xAE, 0x34,
+        0xAD, 0x23, 0xDE, 0xDD, 0x76, 0xE7, 0x72, 0xE3, 0x22, 0x58, 0x01, 0x52, 0x81, 0x81, 0x11, 0x49,
+        0x60, 0x85, 0x50, 0xA8, 0x88, 0xC1, 0xD1, 0xC4, 0x44, 0x12, 0xAA, 0x18, 0x81, 0x51, 0x4A, 0x29,
+        0x45, 0x10, 0x8C, 0x0C, 0x1D, 0x1C, 0x08, 0xC0, 0x8A, 0x44, 0xA2, 0x15, 0x2A, 0x38, 0x18, 0x0A,
+        0x92, 0x2A, 0x18, 0x02, 0xA8, 0xC5, 0x28, 0x35, 0x08, 0x78, 0xE7, 0x1E, 0x43, 0xC7, 0x90, 0xF1,
+        0xC1, 0x99, 0x8F, 0x24, 0x98, 0x66, 0x66, 0xFC, 0x47, 0x92, 0x43, 0x30, 0x93, 0x24, 0x87, 0x05,
+        0xCC, 0x31, 0xE6, 0x6F, 0xC7, 0x23, 0x98, 0x26, 0x18, 0xF0, 0x92, 0x12, 0x61, 0x82, 0x19, 0x1F,
+        0x18, 0xF8, 0xC3, 0x31, 0x19, 0x21, 0x84, 0x8F, 0x1E, 0x26, 0x40, 0xC7, 0x8D, 0x9E, 0xD6, 0xDB,
+        0x0B, 0x84, 0x81, 0x86, 0x5C, 0x8E, 0x03, 0x23, 0xCD, 0xE4, 0x89, 0x8F, 0x2E, 0x0A, 0x00, 0x80,
+        0x00, 0x74, 0xED, 0x6D, 0x4D, 0x0C, 0x6C, 0x0B, 0x95, 0x28, 0x4A, 0x90, 0x98, 0xB0, 0x60, 0x9A,
+        0x6A, 0x20, 0x64, 0x8A, 0x62, 0x90, 0x82, 0x18, 0x67, 0x32, 0xF9, 0x72, 0xC5, 0x9D, 0x04, 0x75,
+        0xA7, 0x4B, 0x75, 0x7A, 0x6E, 0x85, 0x2D, 0xBB, 0x59, 0x56, 0xDB, 0x33, 0x20, 0x7B, 0x4D, 0xBA,
+        0xDD, 0x6E, 0x97, 0xA1, 0x5A, 0xCA, 0xB0, 0xEC, 0x03, 0x6F, 0xFB, 0x6F, 0xF9, 0xD3, 0xA0, 0x43,
+        0x03, 0x00, 0x08, 0x08, 0x10, 0x80, 0x00, 0x01, 0x00, 0x00, 0x79, 0xEF, 0x25, 0x78, 0x6E, 0x05,
+        0xE1, 0xA3, 0xC5, 0x92, 0xE6, 0xF9, 0xB0, 0x96, 0x41, 0x47, 0x95, 0xC5, 0xE3, 0xBC, 0x9D, 0xE1,
+        0x29, 0x48, 0xC4, 0xA4, 0xAF, 0x59, 0xD6, 0x70, 0x2A, 0x49, 0xB8, 0x09, 0xCF, 0x7C, 0xBC, 0x1F,
+        0x7E, 0x69, 0x00, 0x2F, 0x96, 0xF1, 0x04, 0x2F, 0x9B, 0xCE, 0xE0, 0x4B, 0x22, 0x90, 0xD7, 0x7C,
+        0x30, 0x02, 0x9C, 0x33, 0x52, 0x89, 0x31, 0xAE, 0x75, 0x35, 0x78, 0xBD, 0x5A, 0x4C, 0x70, 0x42,
+        0x5E, 0x77, 0xC6, 0xE4, 0xEE, 0x0C, 0x0B, 0x39, 0xD3, 0x01, 0x97, 0x02, 0x74, 0xC2, 0x0E, 0xAF,
+        0x8D, 0xE2, 0x60, 0x13, 0x47, 0x93, 0x92, 0x1A, 0x29, 0x63, 0xF8, 0xFE, 0xEC, 0x9C, 0x88, 0x7C,
+        0x56, 0x31, 0xA1, 0x5A, 0x7A, 0x49, 0x1D, 0x11, 0x46, 0x21, 0xA4, 0xF5, 0xBE, 0xB3, 0x06, 0x06,
+        0xF3, 0x71, 0x8C, 0xBC, 0xA4, 0x2E, 0x08, 0x5E, 0x77, 0xE7, 0x64, 0x40, 0xCD, 0x82, 0x12, 0xE3,
+        0x7C, 0xD8, 0x3E, 0x7D, 0xE4, 0x1D, 0xC1, 0x92, 0x84, 0x0D, 0xF9, 0xA8, 0xE4, 0xD3, 0x94, 0x33,
+        0x4E, 0x6C, 0x88, 0xB9, 0x79, 0xDE, 0x23, 0x8B, 0x09, 0xA3, 0x92, 0xC9, 0xB3, 0x9A, 0xF9, 0xAF,
+        0x14, 0x93, 0xA2, 0x4E, 0x33, 0xAC, 0xEA, 0xD2, 0x04, 0x8D, 0x30, 0x10, 0x9D, 0x5C, 0x4E, 0xB3,
+        0x40, 0x50, 0x0C, 0xEE, 0x66, 0xC0, 0x33, 0xA5, 0x53, 0x86, 0x01, 0x82, 0x52, 0x19, 0xF1, 0xB1,
+        0xC0, 0x1E, 0x77, 0x26, 0xF1, 0x70, 0xF4, 0xBA, 0xCD, 0x4E, 0x2F, 0x19, 0xC1, 0x30, 0xC2, 0x02,
+        0x39, 0xBE, 0x76, 0x65, 0x7C, 0xA8, 0x60, 0xBB, 0xE1, 0x42, 0x39, 0x4C, 0xDC, 0x08, 0x88, 0x9C,
+        0x6F, 0x8B, 0xA6, 0x13, 0xC6, 0x70, 0x62, 0x68, 0x6C, 0x39, 0x7E, 0x5F, 0xC1, 0x4F, 0x88, 0x66,
+        0xAE, 0x3D, 0xF4, 0xDF, 0x73, 0xD5, 0x67, 0xB1, 0x94, 0x9C, 0x13, 0x19, 0xE3, 0x9D, 0x34, 0xE2,
+        0x69, 0x8C, 0x63, 0x9B, 0x82, 0x65, 0x0C, 0xD1, 0xF3, 0xDF, 0x16, 0x01, 0x78, 0x83, 0x83, 0x66,
+        0x77, 0x89, 0x00, 0x03, 0x5F, 0xFF, 0xB5, 0xC5, 0xFF, 0xDF, 0x18, 0x10, 0x42, 0x08, 0x30, 0x80,
+        0x00, 0x20, 0x41, 0x10, 0x5C, 0xEF, 0x94, 0x8E, 0x6E, 0x0F, 0x3B, 0xC2, 0x62, 0xAF, 0x13, 0x13,
+        0xAC, 0xD0, 0x9C, 0x16, 0x33, 0x2C, 0xBC, 0xB1, 0x31, 0xB9, 0x9D, 0x1C, 0x1C, 0x5C, 0xB8, 0xB8,
+        0x80, 0x48, 0x9A, 0x65, 0x56, 0x68, 0xA7, 0x8C, 0xE8, 0xB3, 0x89, 0xC5, 0xA4, 0xA6, 0x01, 0x8B,
+        0xD3, 0x14, 0x93, 0x78, 0xB9, 0x60, 0xF3, 0xDF, 0x83, 0xB8, 0xA7, 0x36, 0x45, 0x92, 0xE2, 0x20,
+        0x4B, 0x88, 0x12, 0xF3, 0x72, 0x94, 0x14, 0xEA, 0x6A, 0xE9, 0x67, 0xAC, 0x8A, 0x62, 0x44, 0x20,
+        0xC6, 0x6F, 0xE7, 0xDE, 0x42, 0xCF, 0x59, 0x49, 0x5E, 0x1A, 0x31, 0x29, 0x01, 0x18, 0xE6, 0xE4,
+        0xEF, 0x8D, 0xF3, 0xB8, 0x99, 0x12, 0xB2, 0xA1, 0x18, 0x17, 0x5F, 0xFA, 0xFF, 0xD5, 0xBB, 0x64,
+        0x7D, 0xAD, 0x6B, 0x52, 0x12, 0x49, 0x04, 0x02, 0x07, 0x25, 0x2A, 0x07, 0x59, 0xA8, 0xBA, 0x28,
+        0x18, 0x9A, 0x29, 0xA6, 0x8C, 0x4D, 0x4D, 0x5E, 0xAD, 0x04, 0x4D, 0x29, 0xC4, 0x8A, 0xCE, 0x18,
+        0x89, 0xA9, 0x19, 0x17, 0x10, 0x64, 0xB2, 0xF9, 0xD1, 0xC1, 0x97, 0x94, 0x9B, 0xE6, 0xE1, 0xBE,
+        0x15, 0xD3, 0xAC, 0xEA, 0x45, 0x5A, 0x82, 0xE0, 0x8E, 0x6E, 0x30, 0xB3, 0x2D, 0xF2, 0x92, 0x8C,
+        0x97, 0x2C, 0x96, 0x00, 0xC9, 0xA5, 0x08, 0xCE, 0xA5, 0x18, 0xBD, 0x67, 0x57, 0x56, 0x3E, 0x2B,
+        0xCA, 0x4B, 0xE7, 0xB9, 0x05, 0x2A, 0x94, 0x9C, 0x10, 0xA7, 0x59, 0xA6, 0x90, 0x9B, 0xC5, 0x91,
+        0x72, 0xC0, 0x11, 0xCB, 0x00, 0x73, 0x79, 0x72, 0xC7, 0x0A, 0x6A, 0x71, 0x27, 0x5C, 0xE8, 0x4C,
+        0x02, 0x81, 0x02, 0x11, 0x46, 0xB7, 0xC4, 0x9D, 0x73, 0xA2, 0x2B, 0xE7, 0x71, 0x97, 0x8A, 0x11,
+        0x84, 0xE9, 0x9C, 0x5A, 0x8B, 0xC3, 0x44, 0xD4, 0xA1, 0x86, 0x12, 0x00, 0x37, 0x7B, 0xBD, 0xC5,
+        0xB6, 0x1B, 0x5A, 0xD6, 0x96, 0xEF, 0x2F, 0x22, 0xC5, 0xC6, 0x6A, 0x42, 0xC9, 0x6A, 0x5E, 0x25,
+        0x10, 0x9D, 0x4D, 0x4C, 0x12, 0x4E, 0xA6, 0xA7, 0x19, 0xC1, 0x06, 0x09, 0xA2, 0xBA, 0x13, 0xAB,
+        0x80, 0x03, 0x5F, 0xFF, 0xAD, 0x9D, 0xFF, 0xFE, 0x78, 0x62, 0x02, 0x10, 0x00, 0x88, 0x18, 0x41,
+        0x0A, 0x50, 0xE3, 0xCE, 0xF2, 0x29, 0xCE, 0xF9, 0xB8, 0x90, 0x1B, 0xCB, 0x07, 0x0D, 0xF3, 0xBC,
+        0x0B, 0x09, 0x29, 0x55, 0x9D, 0x4A, 0x06, 0xA4, 0x40, 0x1B, 0x88, 0x41, 0x24, 0xEF, 0xCE, 0xF2,
+        0x89, 0x8D, 0xF9, 0xF7, 0xC2, 0xC2, 0x5C, 0x60, 0xEF, 0x01, 0x70, 0x62, 0x67, 0x7E, 0x74, 0x7C,
+        0xF7, 0x93, 0x79, 0x60, 0x30, 0x71, 0x16, 0x12, 0xC7, 0x9B, 0x1C, 0x62, 0x8C, 0x97, 0x0D, 0xF1,
+        0xEF, 0xC5, 0x70, 0x45, 0xE6, 0xE1, 0x71, 0x8B, 0xE7, 0xBF, 0x3A, 0x16, 0xB9, 0xE2, 0xD2, 0x01,
+        0xAA, 0xB8, 0x28, 0x0D, 0xC9, 0xB8, 0x09, 0x9B, 0x92, 0x90, 0x4B, 0xE7, 0x70, 0x60, 0x39, 0x5F,
+        0x34, 0x1B, 0x73, 0x0E, 0xFD, 0xDE, 0xA2, 0x10, 0x62, 0x00, 0x02, 0x4D, 0xFF, 0xD3, 0xF9, 0xDD,
+        0xCD, 0x9B, 0x45, 0x53, 0x17, 0xC7, 0x8D, 0x71, 0xA5, 0x58, 0x0A, 0x80, 0x46, 0x81, 0xF7, 0xB4,
+        0x01, 0xDF, 0xBE, 0x1C, 0xB8, 0x8E, 0x6C, 0xCD, 0x99, 0xD9, 0x83, 0x62, 0x4B, 0x8B, 0xCF, 0x7C,
+        0xDF, 0x35, 0x19, 0x0D, 0xF3, 0xBC, 0xB0, 0x4C, 0xDC, 0x44, 0x94, 0xE7, 0x7C, 0xD0, 0xC5, 0x78,
+        0x8E, 0xFC, 0xF7, 0x89, 0x37, 0x85, 0x32, 0xC0, 0x44, 0x82, 0xF9, 0xEF, 0x9B, 0x85, 0x98, 0x3E,
+        0xFE, 0x74, 0xC4, 0x72, 0xC7, 0x9A, 0x04, 0x93, 0x08, 0xA0, 0xF1, 0x9C, 0x5E, 0xA4, 0x8F, 0x37,
+        0x10, 0x89, 0x2C, 0x88, 0x8E, 0x33, 0x78, 0xCB, 0x19, 0x17, 0x29, 0x0A, 0xB5, 0x8C, 0xA4, 0x98,
+        0x4A, 0x69, 0x90, 0x86, 0x8A, 0x57, 0xAC, 0xE0, 0x67, 0xAD, 0xE0, 0x54, 0x31, 0xDF, 0x2C, 0x4C,
+        0xAF, 0x06, 0x84, 0x2F, 0x2B, 0x82, 0x67, 0x7C, 0x1A, 0x44, 0x25, 0xC9, 0xDE, 0x0B, 0x82, 0x20,
+        0x66, 0xE5, 0x90, 0xB8, 0x88, 0x01, 0x0F, 0x83, 0xFA, 0xBF, 0x43, 0x79, 0x72, 0xE7, 0xA6, 0x58,
+        0xDE, 0x95, 0x8F, 0xAE, 0xF4, 0x74, 0x19, 0xA7, 0x2A, 0x18, 0x03, 0xDF, 0x7E, 0xEF, 0x76, 0x12,
+        0x5E, 0x37, 0x88, 0x03, 0x6F, 0xFF, 0xDB, 0x7F, 0xF3, 0x7D, 0x78, 0x00, 0x80, 0x40, 0x00, 0x08,
+        0x0C, 0x10, 0x10, 0xC0, 0xC0, 0x88, 0x29, 0x49, 0xD4, 0xAA, 0x95, 0x17, 0x40, 0xD1, 0x5D, 0x35,
+        0x0C, 0x05, 0x19, 0xD4, 0xD5, 0xD0, 0x82, 0xF9, 0xB9, 0xBE, 0x6C, 0x82, 0xE0, 0xCD, 0xC8, 0xDE,
+        0x1B, 0xE6, 0xC3, 0x36, 0x0E, 0x6E, 0x0E, 0x52, 0x12, 0xC1, 0xC1, 0x29, 0xCA, 0x3E, 0x76, 0x19,
+        0xBC, 0xDC, 0x17, 0x37, 0x96, 0x38, 0xDE, 0x5C, 0xB0, 0x12, 0x77, 0xF3, 0xDE, 0x20, 0x12, 0xC8,
+        0x92, 0x69, 0x09, 0xD6, 0x71, 0x2A, 0x26, 0x9B, 0x1F, 0x9A, 0xE0, 0x5E, 0x6E, 0x0C, 0xBC, 0x46,
+        0xF2, 0x90, 0x63, 0x9B, 0xCA, 0x40, 0x4B, 0xE6, 0xBE, 0x77, 0x25, 0x32, 0xBE, 0x69, 0x44, 0xD4,
+        0xE2, 0xE8, 0x91, 0x0E, 0x1A, 0x63, 0xE5, 0xBC, 0x37, 0x01, 0xE7, 0x70, 0x02, 0x0A, 0xF8, 0xDE,
+        0x03, 0x41, 0xE2, 0x52, 0x95, 0x12, 0xFF, 0xDD, 0xF2, 0xE0, 0x6D, 0x65, 0x50, 0xA8, 0xD3, 0x0B,
+        0x14, 0x90, 0x45, 0x12, 0xA8, 0x74, 0x6A, 0x61, 0xC2, 0xBA, 0x60, 0x90, 0x98, 0x57, 0x8B, 0xA6,
+        0x04, 0x66, 0x80, 0xD8, 0x17, 0x19, 0xB9, 0x3B, 0xC5, 0xC1, 0xDE, 0x3B, 0xC6, 0xF9, 0xA4, 0xDF,
+        0x37, 0x11, 0xB8, 0x0D, 0xF9, 0xEF, 0x37, 0xCD, 0x09, 0x0A, 0xE9, 0xD5, 0xD1, 0x21, 0x26, 0x69,
+        0x91, 0x99, 0xA7, 0x3B, 0xC4, 0xBC, 0x6F, 0x28, 0x32, 0xE0, 0x8E, 0x24, 0xA6, 0x1A, 0x50, 0x15,
+        0xE0, 0x87, 0x53, 0x4D, 0x3A, 0x91, 0xC6, 0x59, 0x9B, 0x97, 0x10, 0x7C, 0xFA, 0x3F, 0x36, 0x00,
+        0x38, 0xB1, 0xC5, 0x21, 0x59, 0xD5, 0xD1, 0x75, 0x31, 0x19, 0xA4, 0xC4, 0x33, 0x79, 0x48, 0xE6,
+        0xCC, 0xDC, 0x05, 0x23, 0x2F, 0x37, 0x04, 0x33, 0xBC, 0x25, 0x78, 0x66, 0x03, 0x85, 0x74, 0xEA,
+        0x68, 0xAF, 0x12, 0x90, 0x70, 0xE0, 0xC5, 0xC4, 0x48, 0x9C, 0xA1, 0x37, 0xCA, 0x00, 0xF9, 0xF5,
+        0x18, 0x70, 0x10, 0x20, 0x21, 0xCC, 0x10, 0x98, 0x7E, 0x0F, 0xFE, 0xEF, 0xF6, 0x25, 0xFF, 0x4F,
+        0xA7, 0x7F, 0x1D, 0x33, 0xCA, 0x98, 0x42, 0x90, 0x94, 0x64, 0x1D, 0x9B, 0xCB, 0x95, 0xF3, 0x70,
+        0x4E, 0x51, 0x7C, 0xEF, 0x9B, 0x80, 0x03, 0x7F, 0xFD, 0xFB, 0xFF, 0x67, 0x31, 0x05, 0x02, 0x06,
+        0x05, 0x04, 0x02, 0x01, 0x02, 0x01, 0x04, 0x01, 0x04, 0x01, 0x12, 0x38, 0xC7, 0x18, 0x30, 0xCA,
+        0x30, 0x33, 0xBF, 0x36, 0x19, 0xB8, 0x33, 0x06, 0x84, 0x94, 0xE6, 0xE0, 0xC7, 0x29, 0x43, 0x87,
+        0x4D, 0x14, 0x60, 0xBD, 0x66, 0x82, 0x69, 0x8B, 0x2D, 0xBB, 0xC3, 0x71, 0x02, 0x16, 0x73, 0xB0,
+        0xC4, 0x58, 0xC0, 0x73, 0x7C, 0xD3, 0x95, 0x07, 0x19, 0x71, 0x70, 0x5C, 0x9A, 0x70, 0x77, 0x18,
+        0x21, 0x9B, 0x32, 0x99, 0xA3, 0x8E, 0x57, 0xCD, 0x78, 0xA6, 0x6F, 0x29, 0x44, 0xC2, 0x9A, 0x24,
+        0xEB, 0x78, 0x21, 0xE0, 0xAE, 0x9A, 0x53, 0x09, 0xC5, 0xE9, 0x94, 0x86, 0x90, 0x96, 0x0C, 0xCF,
+        0x7E, 0x6C, 0x4A, 0xAE, 0x9A, 0x8B, 0x80, 0xF0, 0xD5, 0xE9, 0x8B, 0x26, 0xF0, 0xA6, 0x23, 0x8D,
+        0xF1, 0x45, 0x08, 0x00, 0x85, 0x20, 0x72, 0x07, 0xDD, 0xFF, 0x47, 0xF0, 0x73, 0x3D, 0x2E, 0xA6,
+        0x91, 0xFE, 0x9F, 0x0F, 0x4C, 0x32, 0x84, 0x18, 0x90, 0x41, 0x95, 0x0C, 0x41, 0xCD, 0x79, 0xDC,
+        0xA4, 0x35, 0xE0, 0xBB, 0xCA, 0xC6, 0x59, 0x60, 0xCA, 0x1A, 0xDD, 0xA6, 0x9D, 0xE8, 0xE1, 0xF3,
+        0xDE, 0x25, 0xE5, 0x23, 0x70, 0x11, 0x70, 0xDE, 0x52, 0x32, 0xE5, 0xCB, 0x83, 0xB8, 0xC6, 0x59,
+        0x9E, 0xFC, 0xD8, 0x30, 0x11, 0xA6, 0xAF, 0x77, 0xBB, 0x04, 0x13, 0x1D, 0xF1, 0x2C, 0x8C, 0x44,
+        0x25, 0xE7, 0x78, 0x6E, 0x42, 0xC7, 0x06, 0xC9, 0x49, 0x2B, 0xC3, 0x79, 0x62, 0x24, 0x0B, 0xC6,
+        0xE1, 0x79, 0x65, 0xC2, 0x57, 0x4A, 0x52, 0x0E, 0xA6, 0x1D, 0x32, 0x55, 0x29, 0x2C, 0xF1, 0x68,
+        0x45, 0xE2, 0x60, 0x8B, 0xCA, 0xE5, 0xF3, 0xDC, 0x8B, 0x82, 0x0B, 0x89, 0x1B, 0xF3, 0xDE, 0x33,
+        0x7C, 0xDC, 0x16, 0xF9, 0x4C, 0xEE, 0x3E, 0x7B, 0x91, 0x78, 0x3A, 0x61, 0x61, 0x2C, 0xCE, 0xF1,
+        0x16, 0x0C, 0x1C, 0x40, 0x71, 0x13, 0xDE, 0x4B, 0x82, 0x8B, 0xC8, 0xD9, 0xC8, 0xB3, 0x4E, 0x8C,
+        0x79, 0x79, 0xBB, 0x92, 0xD0, 0x9A, 0x70, 0x02, 0x63, 0xC9, 0xBE, 0x5C, 0x10, 0x03, 0x7F, 0x97,
+        0x71, 0x2F, 0xF7, 0x10, 0x80, 0x70, 0x80, 0x50, 0xA0, 0x50, 0x60, 0x10, 0x20, 0x60, 0xB0, 0xE0,
+        0x11, 0xBC, 0xBC, 0x4C, 0x60, 0x65, 0xC9, 0x47, 0x19, 0x18, 0x11, 0xC3, 0x7C, 0x40, 0x69, 0xE9,
+        0xAD, 0x7A, 0x30, 0xB2, 0x59, 0x9D, 0xF3, 0x78, 0xDE, 0x2E, 0x09, 0x70, 0xBE, 0x7B, 0xE5, 0xCB,
+        0x94, 0xC0, 0x6F, 0x3B, 0xF3, 0xB2, 0x30, 0x60, 0xC0, 0x82, 0xBD, 0x1B, 0xD3, 0x30, 0x40, 0x8B,
+        0x81, 0xCA, 0xE0, 0x86, 0x6E, 0x26, 0x50, 0x73, 0x71, 0x31, 0xBC, 0xB9, 0xB8, 0x20, 0xE2, 0x5C,
+        0x96, 0x03, 0x1C, 0xB8, 0x3B, 0xC6, 0xF9, 0x6E, 0x4B, 0x25, 0x31, 0x11, 0x80, 0x0E, 0x37, 0xE7,
+        0xDF, 0x18, 0x53, 0x44, 0xC1, 0x78, 0x94, 0x14, 0xE2, 0xE8, 0x4D, 0xCC, 0xEF, 0x2C, 0x88, 0xC9,
+        0xBC, 0x16, 0x58, 0xF3, 0x63, 0xCD, 0x30, 0xDE, 0x13, 0x87, 0x57, 0x4E, 0x1D, 0x5D, 0x34, 0x9B,
+        0x63, 0xFF, 0x13, 0xDB, 0xE3, 0xBB, 0x0D, 0x35, 0x74, 0x13, 0x82, 0xC6, 0x88, 0x01, 0x1C, 0x04,
+        0x00, 0x90, 0xD9, 0x73, 0xDF, 0x3A, 0x22, 0x74, 0xB1, 0x75, 0x9A, 0x94, 0x67, 0x8E, 0x54, 0x4C,
+        0x48, 0xC2, 0xC4, 0x2E, 0x57, 0x2C, 0x50, 0xD1, 0x6E, 0x7E, 0xFE, 0xC5, 0x81, 0xD9, 0x6B, 0x76,
+        0x2D, 0x5E, 0x16, 0xF9, 0xDE, 0x6C, 0xCD, 0x92, 0x99, 0x42, 0x8B, 0xD5, 0xC3, 0x87, 0x01, 0x88,
+        0x9C, 0x64, 0x7C, 0x58, 0x91, 0x22, 0x0F, 0x9E, 0x92, 0xC6, 0x61, 0x34, 0x03, 0xC3, 0x70, 0x98,
+        0x90, 0x2F, 0x2C, 0x2E, 0x17, 0x96, 0x09, 0x66, 0x6E, 0x5E, 0x52, 0x16, 0x18, 0x35, 0xC4, 0x23,
+        0x2E, 0x5E, 0x6C, 0xC1, 0xEE, 0x65, 0x71, 0x70, 0xB0, 0x88, 0x40, 0x04, 0xD4, 0x67, 0x8B, 0x46,
+        0xA5, 0x22, 0x6A, 0x2E, 0x88, 0x35, 0x78, 0x91, 0x4D, 0x8F, 0x9B, 0x8B, 0x08, 0xBC, 0xD8, 0xE2,
+        0x33, 0x78, 0xCD, 0xE1, 0x4E, 0x6E, 0x5C, 0xD5, 0x20, 0x51, 0x03, 0x10, 0x52, 0x05, 0x10, 0x10,
+        0x44, 0xF4, 0x3F, 0xFC, 0xAF, 0xEC, 0x79, 0xAB, 0xFC, 0xFF, 0x8B, 0xCD, 0xC1, 0xAE, 0xAB, 0x27,
+        0x84, 0x68, 0x40, 0x00, 0x08, 0x03, 0x11, 0x87, 0xAB, 0xC0, 0x40, 0x03, 0x7F, 0xEA, 0xD4, 0x0F,
+        0xFA, 0xE8, 0x10, 0x20, 0x00, 0x20, 0x10, 0x08, 0x40, 0x08, 0x10, 0x20, 0x10, 0x00, 0x00, 0xE3,
+        0xC2, 0x3C, 0xBC, 0x66, 0x6F, 0x22, 0x30, 0xCB, 0xC5, 0xCC, 0xEF, 0x89, 0x9B, 0xC0, 0xB1, 0x96,
+        0x65, 0xB4, 0x12, 0x67, 0x79, 0x79, 0x60, 0xC2, 0x5E, 0x14, 0xD4, 0xD3, 0x4A, 0x71, 0x7A, 0xCD,
+        0x14, 0x46, 0x0B, 0xE6, 0xC0, 0x72, 0xE5, 0x90, 0x50, 0x8B, 0xCD, 0xC2, 0xE0, 0xCA, 0x39, 0x37,
+        0x06, 0x5E, 0x25, 0xF3, 0xDF, 0x01, 0xDC, 0x2F, 0xCF, 0xBE, 0x2C, 0x07, 0x2C, 0x19, 0xB9, 0x2C,
+        0x07, 0x17, 0x37, 0x89, 0x29, 0xA9, 0xC3, 0x28, 0x29, 0xC4, 0x8A, 0xB2, 0x84, 0xD4, 0x5D, 0x31,
+        0x01, 0xA5, 0x34, 0x45, 0x4D, 0x38, 0x13, 0x4E, 0x1D, 0x5D, 0x32, 0x49, 0xD5, 0xC2, 0x69, 0x34,
+        0x22, 0xE0, 0x1B, 0xB3, 0x76, 0x1E, 0xFE, 0xF0, 0x0D, 0xD8, 0x0D, 0xD8, 0x38, 0x00, 0x00, 0x00,
+        0x00, 0x05, 0x47, 0xCA, 0xF3, 0x5B, 0xF6, 0xF1, 0x60, 0x84, 0x2B, 0x15, 0x11, 0x06, 0x17, 0x0F,
+        0x56, 0x62, 0xC8, 0x77, 0x06, 0xC1, 0x1A, 0x56, 0x76, 0x35, 0x0B, 0x34, 0x16, 0x6E, 0x6C, 0x6F,
+        0x35, 0x89, 0x70, 0x76, 0x4B, 0x7C, 0xEC, 0x2F, 0x36, 0x20, 0x13, 0x49, 0xAB, 0x17, 0x7F, 0x87,
+        0x73, 0x71, 0x22, 0x39, 0xBC, 0xDE, 0x69, 0x41, 0x35, 0x78, 0xCE, 0xA5, 0x14, 0x42, 0x43, 0xDE,
+        0x21, 0x2E, 0x5C, 0x58, 0x08, 0xC9, 0xBC, 0xA6, 0x52, 0x39, 0x5E, 0x51, 0x23, 0x9B, 0x0C, 0xEF,
+        0xCE, 0x9C, 0xA6, 0x0F, 0xBF, 0x9D, 0x91, 0x09, 0x71, 0x79, 0x51, 0xC4, 0x25, 0x92, 0xF3, 0x63,
+        0xCD, 0xE0, 0xF7, 0x22, 0x3C, 0xEF, 0x0D, 0xF2, 0xB8, 0x8D, 0xF3, 0x70, 0xA6, 0x2F, 0x36, 0x3C,
+        0xD1, 0xCA, 0x73, 0x72, 0xE6, 0xF9, 0xB8, 0xB9, 0xA3, 0xE5, 0x71, 0x71, 0x2F, 0x94, 0x71, 0x05,
+        0xE8, 0x77, 0xFB, 0x85, 0xE8, 0x00, 0xBD, 0x00, 0x70, 0x0A, 0x97, 0x96, 0x66, 0xD7, 0xDD, 0xDE,
+        0xBF, 0x07, 0x55, 0x29, 0x21, 0x0B, 0x0B, 0x04, 0x09, 0x08, 0x24, 0xF0, 0x84, 0x61, 0x80, 0x03,
+        0x7F, 0xFC, 0x40, 0x33, 0xFF, 0x82, 0x84, 0x00, 0x83, 0x04, 0x01, 0x84, 0x02, 0x02, 0x00, 0x03,
+        0x01, 0x86, 0x00, 0x90, 0xC1, 0xA3, 0x09, 0x0A, 0x28, 0x62, 0xF4, 0x4D, 0x24, 0x10, 0x34, 0xAF,
+        0x89, 0x15, 0x23, 0xE6, 0xF2, 0xE1, 0x7C, 0xA4, 0x03, 0x11, 0xBE, 0x6E, 0x17, 0x8B, 0xCD, 0xC1,
+        0x89, 0x28, 0xB8, 0x45, 0x11, 0x13, 0x8C, 0xEB, 0x3A, 0x1A, 0xE2, 0xCC, 0xEF, 0x94, 0x0C, 0xEF,
+        0x84, 0xE2, 0x46, 0xB7, 0x40, 0x3A, 0x68, 0x18, 0x1B, 0x2F, 0x9D, 0xC9, 0x4C, 0x5C, 0xA6, 0x0B,
+        0x7C, 0xD8, 0xE2, 0xE3, 0x7C, 0xEF, 0x9D, 0x2C, 0x5D, 0x35, 0x17, 0x4C, 0x40, 0x69, 0x49, 0x51,
+        0x35, 0x22, 0x1D, 0x5D, 0x34, 0x9D, 0x0F, 0x72, 0x59, 0x2C, 0x33, 0xB8, 0x12, 0x86, 0x37, 0x60,
+        0xF7, 0xF7, 0x80, 0x06, 0xEC, 0x00, 0x00, 0x37, 0x60, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x5F, 0xDE, 0x77, 0x3E, 0x5D, 0xE5, 0x59, 0x04, 0x88, 0xFF,
+        0xF2, 0xF6, 0xD9, 0x25, 0x58, 0x54, 0x15, 0xC4, 0x62, 0x2E, 0x4A, 0x6E, 0x2D, 0xB1, 0x31, 0xB4,
+        0x2D, 0x48, 0xCA, 0xA6, 0xC4, 0xEF, 0x9E, 0xE2, 0xA4, 0x08, 0x52, 0x71, 0xBA, 0x13, 0x57, 0x53,
+        0x03, 0x4C, 0xEE, 0x08, 0x16, 0x67, 0x79, 0x44, 0xCD, 0x93, 0x79, 0x48, 0xC6, 0xF9, 0x48, 0xA2,
+        0x83, 0xAB, 0xD6, 0x75, 0x98, 0x4D, 0x0C, 0x6F, 0x9D, 0xC0, 0x2F, 0x9D, 0xCB, 0xC0, 0x7D, 0xFC,
+        0xD0, 0xCD, 0xC4, 0x97, 0x1C, 0xE8, 0xF9, 0x5C, 0x2C, 0x97, 0x0B, 0x33, 0xBC, 0x22, 0x9A, 0x4D,
+        0x45, 0xE2, 0xF1, 0x78, 0x98, 0x16, 0xF9, 0xB8, 0x53, 0x17, 0x9B, 0x26, 0x8F, 0x0B, 0x9B, 0xE6,
+        0xE2, 0xE6, 0xF9, 0x5C, 0x15, 0xC4, 0xBE, 0x50, 0x71, 0x04, 0x3D, 0x07, 0x7F, 0xB8, 0x00, 0x5E,
+        0x80, 0x00, 0x05, 0xE8, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x65, 0x9F, 0x7A,
+        0xDD, 0x39, 0x6F, 0x94, 0xE3, 0xF2, 0x15, 0x12, 0x51, 0x50, 0x32, 0xCF, 0x57, 0xD0, 0xAC, 0x20,
+        0x03, 0x8F, 0xF8, 0xFB, 0xF3, 0x2F, 0x38, 0x83, 0x80, 0x40, 0x60, 0x40, 0x20, 0x04, 0x06, 0x05,
+        0x00, 0x80, 0x00, 0xE0, 0x18, 0x20, 0x87, 0x0E, 0x28, 0x61, 0xD2, 0xA9, 0xE2, 0xF4, 0x05, 0xC8,
+        0x60, 0x65, 0xF2, 0xE0, 0x18, 0x37, 0xCE, 0xF8, 0x8F, 0x10, 0xCD, 0xF3, 0x70, 0x58, 0x11, 0x20,
+        0x3C, 0xEF, 0x0A, 0x3C, 0xDE, 0x58, 0x0E, 0x2C, 0x82, 0x08, 0x46, 0x31, 0x39, 0xD3, 0xCD, 0x7C,
+        0x1E, 0xF9, 0xAF, 0x2E, 0x58, 0xE2, 0x98, 0x88, 0xE3, 0x7C, 0xEF, 0x9D, 0xC8, 0x8C, 0x85, 0x34,
+        0x53, 0x10, 0xEA, 0x44, 0x3A, 0xB8, 0x19, 0x72, 0xCC, 0xEE, 0x12, 0xC0, 0x94, 0x31, 0xEF, 0xEF,
+        0x01, 0xBB, 0x00, 0x00, 0xDD, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x3F, 0xF0, 0x5E,
+        0x43, 0xF3, 0xA6, 0xFF, 0xF0, 0x5F, 0x4D, 0x9E, 0x8A, 0x30, 0x20, 0x18, 0x12, 0x60, 0x86, 0x89,
+        0x02, 0x3C, 0x08, 0xD2, 0x33, 0x76, 0x67, 0x24, 0x73, 0x16, 0x37, 0x0C, 0xA4, 0x5C, 0x49, 0x9A,
+        0xDE, 0x32, 0x13, 0x20, 0x68, 0x5C, 0xEE, 0x50, 0x2E, 0x77, 0xCE, 0x8C, 0x26, 0xC0, 0xBC, 0xEF,
+        0x2C, 0x40, 0x58, 0x21, 0x37, 0xCD, 0x33, 0x79, 0xB8, 0x11, 0xBB, 0x6A, 0x61, 0x62, 0x28, 0xA1,
+        0x38, 0x17, 0x4A, 0xF1, 0x74, 0x87, 0x72, 0xE3, 0x2C, 0x85, 0x84, 0xB0, 0x73, 0xBE, 0x77, 0xCA,
+        0xC2, 0x2F, 0x36, 0x23, 0x85, 0xCD, 0xE1, 0x73, 0x7C, 0xAE, 0x5C, 0x16, 0xF9, 0x47, 0x10, 0x71,
+        0x0A, 0x1F, 0xEE, 0x02, 0xF4, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x27, 0xF8, 0x37, 0x22,
+        0xF9, 0xCF, 0xE0, 0x3B, 0x2C, 0x75, 0x24, 0xF7, 0x74, 0x2D, 0x06, 0xD2, 0x03, 0x8F, 0xAC, 0x39,
+        0x83, 0xFE, 0xEF, 0x08, 0x03, 0x01, 0x01, 0x00, 0x20, 0x48, 0x08, 0x06, 0x07, 0x00, 0x81, 0x80,
+        0x60, 0x11, 0x6A, 0xA1, 0x62, 0x86, 0x02, 0xE2, 0x6A, 0x11, 0x2D, 0x14, 0x74, 0xE0, 0xE2, 0x69,
+        0xEA, 0xE2, 0x8A, 0xE9, 0x3A, 0x69, 0x26, 0x84, 0x38, 0x22, 0xF2, 0xE5, 0xCB, 0x82, 0xF9, 0xB1,
+        0x83, 0x17, 0x9B, 0x33, 0xBE, 0x52, 0x0C, 0x46, 0x32, 0x6F, 0x2C, 0x72, 0x9C, 0xD7, 0xC2, 0x6F,
+        0x17, 0x8B, 0x84, 0xD2, 0x68, 0xD4, 0x89, 0x97, 0x9A, 0x49, 0x79, 0xDC, 0x96, 0x01, 0xBB, 0x1E,
+        0xFE, 0xF0, 0x6E, 0xC0, 0x00, 0xDD, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x07, 0xFF, 0xFE, 0x2C, 0x7C, 0x9F, 0x5D, 0xF9, 0x03, 0xC1, 0x94, 0x42, 0x48, 0x54, 0x06,
+        0x06, 0x82, 0x42, 0x20, 0xB0, 0x98, 0x3C, 0x12, 0x0F, 0x2D, 0xDF, 0x6F, 0xCB, 0x9E, 0x4E, 0xE4,
+        0xE6, 0x59, 0x2B, 0x91, 0x60, 0xEE, 0xA5, 0x95, 0x94, 0x51, 0x66, 0x1A, 0xBA, 0x98, 0xCE, 0x1C,
+        0xE2, 0x4C, 0x0E, 0xE2, 0xB8, 0x97, 0x2C, 0x9B, 0x94, 0x72, 0xE5, 0x24, 0xEF, 0x18, 0xB2, 0x68,
+        0xF1, 0xBE, 0x77, 0x04, 0x8C, 0x62, 0x95, 0x4C, 0x14, 0xE0, 0x4D, 0x2B, 0x88, 0xBC, 0x0F, 0x7C,
+        0xAE, 0x2E, 0x33, 0x78, 0x5C, 0xD1, 0xE0, 0xB9, 0xBE, 0x57, 0x11, 0xC4, 0x07, 0x7F, 0xB8, 0x2F,
+        0x40, 0x00, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x64, 0x6F, 0x94, 0x2B, 0xCF, 0x1F, 0xF8, 0x2D, 0xBF, 0x0F, 0x91, 0x52, 0x14, 0x70, 0xA2, 0x43,
+        0x00, 0x03, 0x8F, 0xFA, 0xAA, 0xED, 0xFF, 0x7A, 0x85, 0x03, 0x01, 0x00, 0xA0, 0x48, 0x18, 0x0E,
+        0x09, 0x01, 0x82, 0x00, 0x80, 0x70, 0x10, 0xB8, 0xD0, 0xF0, 0x78, 0x58, 0x1C, 0x1A, 0x1A, 0x34,
+        0x47, 0x06, 0x81, 0xD4, 0xE2, 0x70, 0xE8, 0x4E, 0x89, 0xC4, 0xE9, 0xBD, 0x5D, 0x3A, 0x68, 0xA4,
+        0x29, 0x9B, 0x99, 0xEF, 0x83, 0x7E, 0x76, 0x44, 0x63, 0x9B, 0x39, 0xDC, 0x07, 0x37, 0x9B, 0xE0,
+        0xDB, 0xE7, 0x72, 0x59, 0x29, 0x86, 0xF1, 0x16, 0x67, 0x79, 0x64, 0xB0, 0xCE, 0xE0, 0x03, 0x76,
+        0x01, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0E, 0x15, 0xFD, 0xF3, 0x43, 0xFE,
+        0x4E, 0xF8, 0xBA, 0x8E, 0x2D, 0x02, 0x82, 0xA1, 0xD0, 0xB8, 0x74, 0x32, 0x17, 0x09, 0x9E, 0xF7,
+        0xCF, 0x19, 0xD7, 0x15, 0xBB, 0xD4, 0xE7, 0x10, 0xB9, 0x2D, 0x9B, 0x1B, 0x52, 0x32, 0xA5, 0x5A,
+        0x92, 0x0B, 0x35, 0x75, 0x71, 0x22, 0xB3, 0x0E, 0xB2, 0x39, 0x9E, 0xF9, 0xB9, 0xB8, 0xC5, 0x85,
+        0xE1, 0x37, 0xAB, 0x0A, 0x33, 0x82, 0x51, 0x4E, 0x88, 0xCE, 0x18, 0x09, 0xD4, 0xD5, 0xC4, 0x5E,
+        0x06, 0xB8, 0xB8, 0x53, 0x9B, 0x23, 0x7C, 0x1D, 0xC5, 0xC4, 0xBE, 0x50, 0x1C, 0x40, 0x05, 0xE8,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xFC, 0x5B, 0xFF, 0xEF, 0x5C, 0x22, 0x3F, 0x26, 0xFC, 0x5B, 0x46, 0x96, 0x41, 0x21,
+        0x60, 0xF0, 0x60, 0x03, 0x8F, 0xD3, 0x9F, 0xDB, 0x5F, 0xFF, 0xE4, 0x11, 0x80, 0x70, 0x40, 0x24,
+        0x0A, 0x07, 0x82, 0x81, 0x60, 0x90, 0x40, 0x24, 0x0E, 0x07, 0x16, 0xBC, 0x47, 0x51, 0xD4, 0x56,
+        0x16, 0x21, 0x62, 0x18, 0xFC, 0x8F, 0x33, 0x7E, 0x38, 0x38, 0x62, 0x0E, 0x31, 0xC1, 0x8F, 0x9E,
+        0xF0, 0x64, 0x14, 0x70, 0xDF, 0x9D, 0xC9, 0xB8, 0xE6, 0xF0, 0x56, 0x03, 0x25, 0x92, 0x98, 0x68,
+        0xE4, 0xB9, 0x66, 0x77, 0x02, 0x58, 0x00, 0x37, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x89, 0xFF, 0xDE, 0xB0, 0x1F, 0xFC, 0x1D, 0xF9, 0x92,
+        0x40, 0x0D, 0x09, 0xC6, 0x22, 0xD1, 0xA8, 0x7C, 0x5E, 0x95, 0xDF, 0x8E, 0x3B, 0x63, 0x96, 0x17,
+        0xC2, 0xD6, 0xA5, 0xE3, 0x69, 0x3E, 0x5C, 0xD9, 0xB6, 0x6D, 0xC6, 0x4A, 0x91, 0xBC, 0xF6, 0x52,
+        0x52, 0xC2, 0xC6, 0x0D, 0x23, 0x3B, 0xF3, 0x48, 0xB0, 0x94, 0x85, 0x67, 0x0C, 0xD3, 0x4E, 0xA5,
+        0x22, 0x04, 0x8B, 0x8B, 0x85, 0x39, 0x5C, 0xA1, 0xEB, 0xBF, 0xDC, 0x5E, 0x81, 0x07, 0xA0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xEA, 0x27, 0xCF, 0x64, 0x13, 0xD0, 0xDE, 0x31, 0xA7, 0xE0,
+        0xC8, 0x50, 0x19, 0x00, 0x03, 0x9F, 0xFB, 0xBD, 0xFD, 0xEF, 0xE2, 0xA8, 0x88, 0x17, 0x07, 0x81,
+        0x40, 0x50, 0x12, 0x04, 0xC0, 0xC0, 0x34, 0x0F, 0x02, 0x00, 0x80, 0x38, 0x69, 0xB4, 0xA5, 0x2B,
+        0x22, 0x60, 0x30, 0x46, 0x40, 0x91, 0x13, 0xD5, 0xC5, 0x11, 0x8B, 0xA0, 0x8A, 0x43, 0x37, 0x97,
+        0x8A, 0x73, 0x4E, 0x50, 0x82, 0x09, 0x8D, 0xF3, 0xB9, 0x29, 0x86, 0x8F, 0x2E, 0x59, 0x9D, 0xC9,
+        0x60, 0x04, 0x0E, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x4F, 0xD5, 0x50, 0x3B, 0xF2, 0x4B, 0xAF, 0x85, 0x50,
+        0x86, 0x2A, 0x8A, 0x22, 0x98, 0x7A, 0x21, 0xA6, 0xDE, 0xBC, 0xF9, 0xF1, 0xE5, 0x9E, 0x9B, 0x5E,
+        0xFA, 0xC7, 0x2A, 0x52, 0x59, 0xE5, 0xBE, 0xD5, 0xB9, 0x63, 0x29, 0x73, 0x81, 0xBB, 0x0E, 0xF9,
+        0xA3, 0x15, 0xE6, 0xE0, 0xEC, 0x86, 0xF0, 0xDC, 0x04, 0x20, 0x36, 0x67, 0x7C, 0xAE, 0x14, 0xE6,
+        0xE5, 0xC1, 0x6F, 0x95, 0xC4, 0x01, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x62, 0xB6, 0xAC, 0x03, 0x78, 0x91, 0xB7, 0xB1, 0x52, 0x11,
+        0x02, 0xB0, 0x03, 0x9F, 0xFF, 0xE0, 0x97, 0xFF, 0xFA, 0x0A, 0x25, 0x8C, 0x02, 0xF0, 0x90, 0x23,
+        0x08, 0x01, 0x70, 0x64, 0x13, 0x05, 0x40, 0xE0, 0x30, 0x10, 0x02, 0x47, 0x96, 0x19, 0x52, 0x50,
+        0xC0, 0x24, 0xD0, 0x19, 0x11, 0x20, 0x9C, 0xCE, 0xF9, 0x1C, 0x02, 0x4B, 0x90, 0xA5, 0x51, 0x69,
+        0x18, 0x67, 0x17, 0x8B, 0x81, 0x79, 0xA6, 0x5E, 0x77, 0x25, 0x80, 0x40, 0xEC, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x1D, 0x4D, 0xFE, 0x0E, 0xBB, 0x9F, 0xE7, 0x87, 0x8A, 0x82, 0x39, 0x4A, 0x48,
+        0x90, 0x23, 0x88, 0xBE, 0xBB, 0xB8, 0xF8, 0xB7, 0xE6, 0xD1, 0x8B, 0x25, 0xB5, 0xDF, 0x45, 0x13,
+        0xD1, 0x2C, 0xB3, 0x7D, 0x8C, 0xCD, 0xAC, 0x92, 0xC4, 0xBC, 0x0F, 0x59, 0x40, 0x5C, 0xAF, 0x1D,
+        0x85, 0x04, 0xA7, 0x0A, 0xF1, 0x78, 0x6A, 0x68, 0x0D, 0xCD, 0xF2, 0xB8, 0x80, 0xE2, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40,
+        0x02, 0xD3, 0xBA, 0x1E, 0x3B, 0x7E, 0x3B, 0xF0, 0xA6, 0x12, 0x05, 0x30, 0x03, 0xAF, 0xF8, 0x48,
+        0xFF, 0xC9, 0x68, 0x6A, 0x14, 0xC2, 0x28, 0x3C, 0x06, 0xC0, 0xA4, 0x13, 0x82, 0x30, 0x2E, 0x07,
+        0x00, 0xA0, 0x10, 0x02, 0x00, 0x30, 0x7B, 0x70, 0xA4, 0xB6, 0x29, 0x51, 0x09, 0xA4, 0x6C, 0xC6,
+        0x3C, 0x21, 0x8B, 0xE6, 0xF9, 0xDC, 0x97, 0x28, 0xF9, 0xDC, 0x02, 0xF1, 0x79, 0xDC, 0x96, 0x03,
+        0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0x2F, 0xFD, 0x53, 0xCA,
+        0xEF, 0xFE, 0x21, 0x79, 0x60, 0xD5, 0x9E, 0x67, 0x39, 0x76, 0x52, 0xAF, 0x93, 0xD7, 0xE5, 0xE8,
+        0xE6, 0xE2, 0xCD, 0xAF, 0x1D, 0xF7, 0xD7, 0x55, 0x72, 0xC9, 0x2F, 0x93, 0x9D, 0xB3, 0x39, 0x89,
+        0x98, 0x90, 0x41, 0x34, 0xAE, 0xAF, 0x0C, 0xC3, 0x8B, 0xC3, 0x02, 0x19, 0xB2, 0x6F, 0x95, 0xC4,
+        0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x33, 0x19, 0xE5, 0x52, 0x2B, 0x7E, 0x90, 0x71, 0x5E,
+        0x6B, 0x00, 0x03, 0xAF, 0xF9, 0x27, 0xFF, 0x91, 0xEA, 0x5C, 0x22, 0x23, 0x9C, 0x5A, 0x8A, 0x31,
+        0x02, 0x19, 0xC2, 0xD8, 0x4B, 0x07, 0xE0, 0xB4, 0x15, 0x82, 0x70, 0x36, 0x79, 0xEB, 0x8D, 0x6A,
+        0xAE, 0xEA, 0x2A, 0x60, 0x2A, 0x03, 0x9A, 0x30, 0xDE, 0x1B, 0x23, 0x0A, 0x0F, 0xDF, 0x7A, 0x5E,
+        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x60,
+        0xF8, 0xFC, 0xC7, 0x2F, 0xF0, 0xF3, 0x85, 0x36, 0xAC, 0x58, 0x0A, 0x81, 0x12, 0x6E, 0xA3, 0x6D,
+        0xA4, 0xC1, 0x54, 0x4E, 0x46, 0x40, 0x2E, 0x58, 0xA0, 0xE1, 0x42, 0xC4, 0x87, 0x17, 0x55, 0x8C,
+        0x52, 0xA8, 0x0A, 0x83, 0xA0, 0x85, 0x39, 0xA7, 0x16, 0x26, 0x1B, 0xCA, 0x19, 0xBB, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x2F, 0xE9, 0xF7, 0x0E, 0x6E, 0x8F, 0x50, 0x54,
+        0x03, 0xAF, 0xE9, 0x2B, 0xAC, 0xDF, 0xC6, 0xBA, 0x04, 0x2E, 0x44, 0xD0, 0x7B, 0x0C, 0x01, 0x34,
+        0x1F, 0x82, 0xF0, 0x50, 0x08, 0x40, 0xB8, 0x15, 0x02, 0x02, 0xFA, 0xFC, 0x71, 0xEA, 0xB5, 0x85,
+        0x50, 0x28, 0xA4, 0x85, 0x91, 0x79, 0x64, 0xDE, 0x59, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xCF, 0xF2, 0x07, 0xD6,
+        0xD7, 0xFB, 0xB2, 0xAF, 0xA9, 0x6B, 0x38, 0xA8, 0x0D, 0xBE, 0xC7, 0xD9, 0xF6, 0xBB, 0xFC, 0xCD,
+        0xEC, 0xEC, 0x7C, 0x0A, 0xD5, 0x27, 0xCA, 0x97, 0x16, 0x44, 0x77, 0xDE, 0xBB, 0x4D, 0x8A, 0xC5,
+        0x83, 0x37, 0x17, 0x9B, 0x8B, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x05, 0xFD, 0x38, 0x82, 0x5B, 0x67, 0xCE, 0xC4, 0x03, 0xAD, 0xF1, 0x7F, 0xAC, 0xAF,
+        0xFF, 0xE0, 0xBD, 0x35, 0x2F, 0x63, 0xC4, 0x62, 0x89, 0x00, 0xE2, 0x14, 0xC2, 0x08, 0x2F, 0x04,
+        0x80, 0x7C, 0x08, 0x81, 0x31, 0x7E, 0x3A, 0xF1, 0xAE, 0x15, 0x0C, 0x04, 0x61, 0x12, 0x1E, 0xDC,
+        0xDB, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xF7, 0xD5, 0xAF, 0x73, 0x6F, 0x9E, 0xF2, 0x18, 0x3E,
+        0xB9, 0x34, 0xBF, 0xDD, 0x7B, 0x0F, 0x09, 0xC7, 0xEC, 0x32, 0x58, 0x0A, 0xEA, 0x39, 0xE9, 0x09,
+        0x28, 0xB8, 0x68, 0x78, 0x48, 0xFD, 0x74, 0xE8, 0xCA, 0xC9, 0x5C, 0x02, 0xBD, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xF9, 0xD5, 0xB3,
+        0x73, 0x50, 0x03, 0xAF, 0xFF, 0xA0, 0x0F, 0xFF, 0x3F, 0x3E, 0xFD, 0x5A, 0xB4, 0x18, 0x23, 0xE3,
+        0xB8, 0x4F, 0x07, 0x30, 0xA0, 0x0F, 0x01, 0x38, 0x1D, 0x02, 0x80, 0x44, 0x03, 0x8B, 0xE9, 0x75,
+        0x0A, 0x04, 0x00, 0x88, 0x86, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x25, 0xF9, 0x07, 0xF9,
+        0x6C, 0x7E, 0x9A, 0x40, 0xEB, 0x2E, 0x73, 0x55, 0x7F, 0xF2, 0xFF, 0x3D, 0xEB, 0x79, 0xDD, 0x96,
+        0x3E, 0xEE, 0x9A, 0x72, 0x4E, 0x42, 0x1A, 0x2A, 0x02, 0x1A, 0x06, 0x17, 0x38, 0xB3, 0xBD, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+        0x24, 0xCF, 0x21, 0x0F, 0x2D, 0x70, 0x03, 0xBA, 0x3F, 0x7F, 0x61, 0xCF, 0xFF, 0x9A, 0xAD, 0xA9,
+        0x13, 0x39, 0x5E, 0x09, 0x70, 0x87, 0x04, 0x58, 0x36, 0x81, 0xD0, 0x18, 0x80, 0xB0, 0x09, 0x80,
+        0x68, 0x03, 0x87, 0x9F, 0x0E, 0x65, 0x86, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x07, 0x8F, 0x2F, 0xB5, 0xFF, 0xE6, 0x51, 0xFD, 0x9C, 0x20, 0x6B, 0x6A, 0x37, 0xFF, 0xA6, 0xFF,
+        0xEE, 0xFE, 0xB7, 0xE3, 0x78, 0xAD, 0x65, 0xCD, 0x84, 0xAC, 0x94, 0x64, 0x34, 0x14, 0x24, 0x00,
+        0x14, 0x3B, 0xD3, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC7, 0x9B, 0xDB, 0x00, 0x03, 0xBF, 0xEF, 0x19, 0xF2,
+        0x9B, 0xFE, 0x69, 0x39, 0xB3, 0x34, 0x83, 0x2C, 0x10, 0x51, 0x0C, 0x04, 0xF0, 0x56, 0x01, 0xC0,
+        0x1A, 0x00, 0x90, 0x09, 0x00, 0x20, 0x04, 0x03, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x36, 0x1B, 0xEB, 0x01, 0xF5, 0x66, 0x79, 0xF4, 0xA5, 0x09, 0x8D, 0x96, 0x3F,
+        0x47, 0xFE, 0x57, 0xC1, 0x38, 0x5D, 0x3A, 0xAB, 0x1B, 0x8C, 0xC2, 0x21, 0x10, 0x18, 0x1C, 0x00,
+        0x01, 0x00, 0x80, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x60, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x43, 0x8F, 0x98, 0x10, 0x01, 0xBF, 0xFF, 0xE8,
+        0xB9, 0xFF, 0x0E, 0xEE, 0xF6, 0x17, 0x2A, 0x64, 0x23, 0x3A, 0x13, 0x00, 0xB8, 0x03, 0x40, 0x2E,
+        0x00, 0x40, 0x0C, 0x00, 0x00, 0x04, 0x00, 0x10, 0x02, 0x0B, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x97, 0xFF, 0xE3, 0xAD, 0xFF, 0xB5, 0xE7, 0xD1, 0xDB, 0x7D,
+        0x7B, 0xCA, 0x5F, 0xFF, 0xD0, 0x7F, 0x39, 0xCB, 0xE6, 0xE6, 0x65, 0xA0, 0x61, 0x60, 0x00, 0x60,
+        0x40, 0x20, 0x40, 0x20, 0x40, 0x21, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x66, 0x1F, 0xF8, 0xEB, 0x80,
+        0x01, 0xBF, 0x2D, 0xAF, 0xFF, 0xFF, 0x13, 0x4F, 0xA1, 0x64, 0xCC, 0x0E, 0x30, 0x22, 0x01, 0xE0,
+        0x08, 0x40, 0xA8, 0x06, 0xC0, 0x60, 0x03, 0xC0, 0x30, 0x02, 0x40, 0x20, 0x01, 0xC7, 0x97, 0x2E,
+        0x5C, 0xB9, 0x72, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF1,
+        0xB4, 0xFF, 0xFB, 0xD7, 0x7F, 0xF0, 0x99, 0xEC, 0x2B, 0x59, 0x7B, 0x7F, 0xFE, 0x2F, 0x0F, 0x6E,
+        0x89, 0x49, 0xC2, 0xE4, 0x05, 0x8A, 0x0E, 0x20, 0x28, 0x40, 0x61, 0x06, 0xE5, 0xCB, 0x97, 0x2E,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x6D, 0x40, 0x02, 0x5F, 0xF1, 0xBF, 0xD2, 0x00, 0x30, 0x82,
+        0x0C, 0x20, 0x42, 0x08, 0x10, 0xC4, 0x08, 0x71, 0xF1, 0x8C, 0xEF, 0x8D, 0xC9, 0x48, 0xE0, 0xB7,
+        0x2E, 0x29, 0xCD, 0x31, 0x6F, 0xC1, 0xF7, 0xCD, 0xC6, 0xF3, 0x62, 0xF2, 0xDC, 0x45, 0x86, 0xE5,
+        0xCA, 0x4B, 0xBC, 0xD1, 0x19, 0x3B, 0x63, 0x3B, 0x96, 0xB7, 0x36, 0x94, 0x85, 0x91, 0x71, 0x77,
+        0x8E, 0x64, 0xB3, 0x92, 0xC9, 0x5E, 0x46, 0x5E, 0xE6, 0x73, 0x9E, 0x66, 0xF6, 0x73, 0x8D, 0xD7,
+        0x39, 0xD6, 0x78, 0xDF, 0x1C, 0xEB, 0xAD, 0xF7, 0x2F, 0x79, 0x61, 0x80, 0x03, 0x0F, 0x3E, 0xFE,
+        0xFB, 0x3D, 0x6B, 0x9E, 0x37, 0xC6, 0x75, 0x9E, 0x6B, 0x78, 0xCE, 0x6E, 0x53, 0xCE, 0x73, 0x33,
+        0xB7, 0x91, 0xE5, 0x1C, 0xE4, 0x93, 0x33, 0xCE, 0x2E, 0xE2, 0xC6, 0x50, 0x97, 0x23, 0x95, 0xB7,
+        0x3B, 0x19, 0x7B, 0x22, 0x0E, 0xF3, 0x6C, 0x2E, 0x5C, 0xD2, 0x2E, 0x13, 0x74, 0x4A, 0x9A, 0x66,
+        0x27, 0x19, 0xD3, 0x15, 0xC3, 0x78, 0x2E, 0x5C, 0xAE, 0x23, 0x0B, 0x32, 0xBE, 0x76, 0x31, 0xF3,
+        0xB0, 0x72, 0xB2, 0x32, 0xC9, 0x4F, 0xCF, 0xA6, 0x0A, 0xE3, 0x16, 0x65, 0x7C, 0xEC, 0x60, 0xBE,
+        0x76, 0x65, 0x70, 0x65, 0x99, 0x70, 0x9A, 0x42, 0x68, 0x34, 0xA3, 0x3A, 0xBA, 0x63, 0x33, 0x78,
+        0xC9, 0xB9, 0x96, 0x44, 0xE0, 0xDC, 0xB8, 0x39, 0xCD, 0xE1, 0x17, 0xCC, 0x22, 0x8E, 0x1C, 0x42,
+        0x87, 0x51, 0x40, 0xE8, 0x86, 0x1E, 0x31, 0x7D, 0x52, 0x85, 0xAD, 0x23, 0xE8, 0xC2, 0x49, 0x46,
+        0x69, 0x4A, 0xCD, 0x0A, 0x52, 0x58, 0x31, 0xE9, 0x4B, 0x53, 0x2C, 0x32, 0xD2, 0xDB, 0x61, 0xC3,
+        0x49, 0x20, 0x1A, 0x00, 0x00, 0x20, 0x24, 0xB4, 0xE1, 0x86, 0xD6, 0xD3, 0x23, 0xC3, 0x2A, 0x5A,
+        0x9A, 0x36, 0x12, 0xA5, 0x20, 0xD6, 0x94, 0x8A, 0xAB, 0x88, 0xD0, 0xF4, 0x56, 0xB4, 0xA1, 0x57,
+        0x45, 0x78, 0xC3, 0xC0, 0xD1, 0x15, 0x14, 0xE1, 0x40, 0xE5, 0xF1, 0x8E, 0x78, 0xB0, 0xE6, 0xF3,
+        0x05, 0x32, 0xE5, 0xE0, 0xC9, 0x73, 0x36, 0x12, 0x35, 0x30, 0x9D, 0x5E, 0xB3, 0x09, 0x30, 0x3C,
+        0xD2, 0x4B, 0x97, 0x25, 0x89, 0x88, 0xDC, 0x9D, 0xF1, 0x8C, 0xEF, 0x8D, 0xC8, 0x8B, 0x1C, 0x5C,
+        0x00, 0x02, 0x5F, 0xF9, 0x5F, 0xF3, 0x00, 0x10, 0x10, 0x83, 0x10, 0x10, 0x40, 0x10, 0x21, 0x44,
+        0x0C, 0x64, 0x71, 0x61, 0x37, 0xCB, 0x2F, 0x9D, 0x1C, 0x71, 0xCA, 0x11, 0xE3, 0x4E, 0x68, 0xC7,
+        0x8B, 0x19, 0x2B, 0x97, 0x95, 0x1C, 0xEE, 0x30, 0x54, 0x51, 0x7A, 0x38, 0xE9, 0x6D, 0xD3, 0xD3,
+        0x7D, 0xDB, 0xD3, 0x75, 0x8C, 0x6A, 0x77, 0xAB, 0xE7, 0x8C, 0x73, 0xCF, 0x5C, 0x4F, 0x7E, 0x7B,
+        0xF3, 0xEB, 0xDF, 0xD7, 0xAD, 0x66, 0x02, 0x4A, 0x08, 0x3E, 0xE2, 0x6F, 0x3A, 0x32, 0xAC, 0x68,
+        0xB9, 0x68, 0x82, 0x5B, 0x8D, 0x46, 0x2D, 0x89, 0xDE, 0x68, 0xE7, 0xB8, 0x21, 0x44, 0x10, 0x2D,
+        0xB6, 0xE5, 0xBE, 0xDA, 0xE7, 0xAE, 0x78, 0x65, 0x3C, 0xF3, 0x8E, 0x39, 0xBD, 0x6E, 0x75, 0x8C,
+        0x55, 0xDC, 0xC7, 0x7D, 0xD3, 0xD3, 0x6D, 0xA6, 0xB9, 0xD4, 0x51, 0x45, 0x48, 0xE7, 0x71, 0xA3,
+        0xCB, 0x8D, 0x91, 0x8B, 0xC6, 0x6F, 0x04, 0xAF, 0x18, 0x17, 0x1C, 0x73, 0xBE, 0x0D, 0x97, 0xCD,
+        0x84, 0x5C, 0x64, 0xB8, 0x3B, 0x30, 0x5C, 0xB1, 0xC2, 0x25, 0x18, 0xE5, 0x90, 0xAF, 0x2E, 0x2C,
+        0xA3, 0x22, 0x3C, 0xEE, 0x39, 0xDF, 0x2C, 0xB0, 0x6E, 0x03, 0x36, 0x61, 0xBC, 0x66, 0xC1, 0x8C,
+        0x5C, 0x97, 0x37, 0x25, 0xF2, 0xC1, 0x49, 0x21, 0x21, 0x27, 0x96, 0x70, 0x28, 0x88, 0xA1, 0xA1,
+        0x5A, 0xA8, 0xC6, 0x2B, 0x5A, 0x47, 0x12, 0x07, 0x22, 0x48, 0x95, 0x24, 0x93, 0x45, 0x45, 0x94,
+        0x58, 0x7D, 0xBC, 0x3D, 0xBB, 0x5A, 0x80, 0x42, 0xC0, 0x72, 0x32, 0x01, 0xE6, 0xF8, 0x47, 0x24,
+        0x66, 0x4B, 0x98, 0x24, 0x08, 0x66, 0x59, 0x91, 0x93, 0x05, 0x87, 0x9B, 0xC2, 0x5F, 0x94, 0xE3,
+        0x04, 0x63, 0xAE, 0xCD, 0x82, 0xEB, 0x28, 0xB2, 0x88, 0xA6, 0x92, 0x45, 0x44, 0x7A, 0x42, 0xD8,
+        0x25, 0xA5, 0x26, 0x84, 0x11, 0xA4, 0xC0, 0x5A, 0x15, 0x11, 0x02, 0x93, 0xC2, 0x41, 0x21, 0x24,
+        0x83, 0x2F, 0x96, 0x66, 0xE5, 0x83, 0x8B, 0x19, 0x36, 0x3C, 0xD3, 0x26, 0x8C, 0x43, 0x2C, 0xB2,
+        0xF9, 0xDC, 0x73, 0xA3, 0xC4, 0x64, 0xB1, 0x72, 0xF1, 0xA0, 0xC9, 0x71, 0x94, 0x02, 0x5F, 0xFD,
+        0x0F, 0xFD, 0x20, 0x42, 0x00, 0x00, 0x44, 0x0C, 0x40, 0xC6, 0x04, 0x00, 0xC6, 0x16, 0x30, 0xCA,
+        0x60, 0xC8, 0x4D, 0x1F, 0x25, 0x24, 0x1E, 0x0C, 0x8C, 0x80, 0x33, 0x7D, 0xFE, 0x89, 0xA0, 0xB2,
+        0xCD, 0xB1, 0xDB, 0xA7, 0x6F, 0x7D, 0x42, 0xBC, 0x6B, 0x6C, 0x29, 0x96, 0x58, 0x69, 0xAE, 0x9B,
+        0xF2, 0xE3, 0x3F, 0xAF, 0xD7, 0xF1, 0xFD, 0x79, 0xB8, 0x18, 0x09, 0x80, 0x9A, 0x38, 0xC2, 0x9D,
+        0xF3, 0xD8, 0x77, 0x28, 0xEF, 0x06, 0xBB, 0x14, 0xB7, 0x34, 0x37, 0x28, 0xD9, 0x6C, 0x55, 0x96,
+        0xCB, 0x70, 0x74, 0x37, 0x2D, 0x16, 0x6B, 0x79, 0xA4, 0x43, 0x8B, 0x0B, 0x38, 0xB0, 0x2E, 0xAE,
+        0x10, 0x61, 0x00, 0xC2, 0x01, 0x80, 0xF5, 0xF2, 0xF0, 0xED, 0xDB, 0x8F, 0x19, 0xF9, 0xEF, 0xCF,
+        0x8E, 0x3A, 0xEB, 0x1C, 0x6B, 0x33, 0xBA, 0xC5, 0xC6, 0xF4, 0xDB, 0xAC, 0xBB, 0x2C, 0x28, 0x19,
+        0x17, 0xFB, 0xEC, 0xC3, 0x61, 0x64, 0x4E, 0x24, 0x85, 0x9E, 0x6C, 0x12, 0x44, 0xC2, 0xE1, 0x18,
+        0xF2, 0x88, 0xF2, 0xE5, 0xC4, 0x23, 0x18, 0x88, 0x4B, 0x97, 0x36, 0x19, 0xB1, 0x88, 0x97, 0x0A,
+        0x45, 0x1E, 0x75, 0xC0, 0x29, 0xBE, 0x6A, 0xD4, 0x21, 0x1E, 0x76, 0x04, 0x13, 0x07, 0x12, 0xA8,
+        0x2A, 0xA2, 0x86, 0x23, 0x1A, 0xAF, 0x11, 0xC2, 0x3A, 0x25, 0x4D, 0x34, 0x55, 0x59, 0x46, 0x4C,
+        0x99, 0x37, 0x6E, 0xE2, 0xE6, 0x2F, 0xE3, 0x02, 0x02, 0x80, 0xA1, 0xE2, 0x70, 0x01, 0x62, 0xF4,
+        0x46, 0x1C, 0x05, 0x53, 0x0A, 0x88, 0xC8, 0x66, 0x5E, 0x07, 0x2E, 0x63, 0x98, 0x2C, 0x92, 0x39,
+        0x8E, 0x65, 0xE0, 0x70, 0x6E, 0x61, 0x23, 0xC9, 0x9B, 0xC8, 0x65, 0x1F, 0x07, 0xE7, 0x7C, 0x30,
+        0x7C, 0xB9, 0x0C, 0x41, 0x00, 0x80, 0x45, 0x9C, 0xDC, 0x5B, 0xB7, 0x64, 0xCD, 0x82, 0xAB, 0x2A,
+        0x3C, 0xB6, 0xDA, 0x59, 0x5A, 0x89, 0x83, 0x4A, 0x09, 0x00, 0x61, 0xCE, 0x47, 0x38, 0xE3, 0x08,
+        0x90, 0x06, 0xFE, 0xFD, 0x21, 0x5A, 0xB0, 0x9B, 0x05, 0x31, 0xEF, 0x11, 0x60, 0x94, 0xCA, 0x31,
+        0x9B, 0x84, 0xDC, 0x1B, 0x96, 0x03, 0x00, 0x02, 0x5F, 0xFE, 0xE7, 0xFF, 0x94, 0x18, 0x01, 0x00,
+        0x08, 0x40, 0x04, 0x08, 0x40, 0x00, 0x20, 0xA3, 0xE3, 0x03, 0x07, 0x21, 0x09, 0xCD, 0x2C, 0x14,
+        0x92, 0x0A, 0x9C, 0x1C, 0x3C, 0x48, 0xE4, 0x4E, 0x51, 0x64, 0xFA, 0xCE, 0xFD, 0x40, 0xA5, 0x6B,
+        0x6B, 0xE3, 0x9E, 0x99, 0xF4, 0xE1, 0xDB, 0xCB, 0xCB, 0xE3, 0x3F, 0xF8, 0xFF, 0xC7, 0xE3, 0x51,
+        0x30, 0x30, 0x33, 0x47, 0x01, 0x21, 0xF7, 0x1E, 0xE3, 0x6C, 0xAA, 0x8D, 0x12, 0xD9, 0x65, 0xD8,
+        0xB4, 0x2A, 0x3B, 0xCD, 0x66, 0x96, 0x5B, 0x29, 0xB0, 0x5D, 0x33, 0xA8, 0x3D, 0xC3, 0x59, 0xA2,
+        0x59, 0x6C, 0xA6, 0xC7, 0x79, 0xAD, 0x10, 0xAB, 0x36, 0xCB, 0x2D, 0x2A, 0x22, 0xB6, 0x5A, 0xE7,
+        0x5C, 0xF6, 0x28, 0x03, 0x90, 0x63, 0x00, 0xC0, 0x30, 0xB7, 0x4F, 0xA7, 0xD3, 0xE3, 0xE5, 0x4E,
+        0x5D, 0xB8, 0x74, 0xCF, 0x4C, 0xF1, 0xBD, 0xAB, 0x5A, 0x42, 0xB3, 0x8C, 0x7E, 0xC8, 0xA5, 0xE0,
+        0xCC, 0xDF, 0x09, 0xE0, 0xC3, 0xA4, 0x12, 0x48, 0xE2, 0x68, 0x61, 0x09, 0x89, 0x81, 0x1F, 0x37,
+        0x04, 0x23, 0x08, 0x90, 0xBF, 0xCF, 0xDC, 0x05, 0x22, 0x31, 0x0B, 0xCE, 0xC4, 0x12, 0x92, 0xA2,
+        0x3B, 0xCE, 0xC5, 0x15, 0x1D, 0xCB, 0x3B, 0x9D, 0xE5, 0x60, 0x53, 0x01, 0x22, 0x78, 0x47, 0x1C,
+        0x2D, 0x71, 0xC2, 0x9C, 0x82, 0x8C, 0x34, 0xC4, 0xA8, 0x53, 0xAB, 0x56, 0xC4, 0xCA, 0xCA, 0x94,
+        0x70, 0xCC, 0x30, 0xCC, 0xBE, 0x11, 0xF9, 0x67, 0x83, 0x66, 0x63, 0x92, 0x42, 0x61, 0x98, 0x8E,
+        0x39, 0xC6, 0x4C, 0x0C, 0x9C, 0xDE, 0x41, 0x78, 0x63, 0x98, 0xE1, 0xC6, 0x70, 0xA3, 0xE4, 0x09,
+        0xE5, 0x39, 0x1E, 0x18, 0xE0, 0xE3, 0x87, 0x19, 0xCD, 0xE4, 0xC0, 0xC8, 0x31, 0xE6, 0x38, 0xE6,
+        0x19, 0x09, 0x21, 0x41, 0x88, 0x4F, 0x09, 0xE8, 0xA1, 0x87, 0x08, 0x40, 0x10, 0x04, 0x13, 0xB5,
+        0x7A, 0xBD, 0x5E, 0x4E, 0x6E, 0x6D, 0xD8, 0xB5, 0x1F, 0x0E, 0x5C, 0x34, 0xC2, 0xD4, 0xA4, 0x8A,
+        0x90, 0x12, 0xA0, 0x8B, 0x21, 0x9A, 0x46, 0xF3, 0xB9, 0xD9, 0x47, 0x35, 0x15, 0x67, 0x79, 0xA8,
+        0x82, 0xD8, 0x50, 0x67, 0x79, 0x41, 0x81, 0x2C, 0x9E, 0x02, 0x5F, 0xFF, 0xC2, 0xFF, 0xFC, 0x20,
+        0x44, 0x00, 0x10, 0x82, 0x00, 0x20, 0x44, 0x08, 0x00, 0x02, 0x1C, 0x26, 0x13, 0x1F, 0x09, 0x3C,
+        0x73, 0x06, 0x4C, 0x99, 0xCB, 0xC8, 0x61, 0x70, 0x50, 0xA3, 0x29, 0xD6, 0x79, 0x63, 0x97, 0x0E,
+        0x3D, 0x7C, 0xBD, 0x7E, 0x9F, 0xAD, 0x3F, 0x3F, 0xEB, 0xF0, 0xC6, 0x01, 0x84, 0xA4, 0x38, 0x42,
+        0x02, 0x80, 0x62, 0xD3, 0x66, 0x95, 0xB2, 0xEC, 0xA0, 0xDA, 0x2D, 0x52, 0x9D, 0xE7, 0xB1, 0x14,
+        0xEE, 0x76, 0x25, 0x68, 0xB6, 0x0D, 0xB2, 0xD9, 0xDC, 0xA5, 0x46, 0x83, 0x66, 0x8D, 0x0A, 0x9B,
+        0x29, 0x45, 0x1A, 0x5C, 0xEC, 0xB6, 0x5B, 0x28, 0xA9, 0x5A, 0x33, 0xB9, 0xD1, 0x60, 0xFB, 0xCE,
+        0x94, 0x5A, 0xA5, 0xA5, 0x19, 0xB6, 0x56, 0x9B, 0x34, 0xAD, 0x10, 0xA0, 0x08, 0x4E, 0x42, 0x84,
+        0x60, 0x8F, 0xC3, 0xFA, 0xFF, 0x3F, 0xD7, 0xE9, 0x4E, 0xBE, 0x5D, 0x78, 0xF0, 0xCB, 0x1C, 0xA7,
+        0x59, 0xCA, 0x32, 0x84, 0x03, 0x94, 0xC2, 0x72, 0xF3, 0x26, 0x49, 0x98, 0x2F, 0x92, 0x1E, 0x39,
+        0x0C, 0x86, 0x40, 0x1B, 0xD6, 0x6D, 0x3D, 0x1B, 0x81, 0xA9, 0x6E, 0x8B, 0x97, 0x08, 0xD9, 0xD1,
+        0x7B, 0x2D, 0x5A, 0x8D, 0xDC, 0xD4, 0xA6, 0x52, 0x73, 0x39, 0xE2, 0x98, 0x42, 0xCA, 0x2D, 0x0A,
+        0x24, 0xCA, 0xD7, 0x32, 0xB7, 0x39, 0x1C, 0xCC, 0x25, 0x04, 0xC9, 0xCB, 0xE4, 0x87, 0x0C, 0x98,
+        0x70, 0x5E, 0x19, 0x31, 0xCE, 0x38, 0x66, 0x10, 0x66, 0x48, 0x61, 0xE6, 0xFC, 0x64, 0x3C, 0xA3,
+        0xE3, 0x0C, 0x98, 0x49, 0x8E, 0x63, 0x83, 0x8F, 0x97, 0x0C, 0x84, 0xC3, 0x1E, 0x03, 0x30, 0x32,
+        0x1C, 0x70, 0xC8, 0x4C, 0x13, 0x2F, 0x8E, 0x63, 0x98, 0xE4, 0x86, 0x0C, 0xC2, 0x3E, 0x5F, 0x09,
+        0x1F, 0x9B, 0xE0, 0x38, 0x49, 0x92, 0x19, 0x86, 0x3C, 0xC4, 0x72, 0x61, 0xC7, 0x86, 0x4C, 0x38,
+        0x48, 0xA4, 0x06, 0x30, 0x42, 0x00, 0xA6, 0x17, 0x33, 0x91, 0xB9, 0x95, 0x72, 0xB4, 0xC8, 0x87,
+        0xE5, 0xB6, 0x9B, 0x42, 0x90, 0x64, 0x62, 0x03, 0x40, 0x31, 0x1D, 0xCD, 0xAD, 0x5B, 0x67, 0x54,
+        0x4E, 0xCA, 0x95, 0x2A, 0x0D, 0x81, 0x2B, 0x3B, 0x00, 0x03, 0x5F, 0xFF, 0xF4, 0x82, 0xFF, 0xFF,
+        0x44, 0x10, 0x81, 0x00, 0x41, 0x46, 0x00, 0x31, 0x8B, 0x40, 0x51, 0x6F, 0xC7, 0x78, 0xCB, 0x82,
+        0x10, 0x2B, 0xD4, 0x82, 0xF1, 0xB3, 0x5E, 0xF1, 0xB9, 0xE7, 0xB3, 0x3E, 0x3B, 0xF5, 0x0F, 0xC3,
+        0xFE, 0x5A, 0x31, 0x8A, 0x08, 0x02, 0x0F, 0x7C, 0xB1, 0x08, 0x31, 0x83, 0x09, 0xC2, 0x68, 0xA5,
+        0x35, 0x3A, 0xE7, 0x86, 0x44, 0x99, 0xDC, 0x00, 0x9B, 0xC6, 0xF9, 0x48, 0xC3, 0x51, 0x9D, 0x4C,
+        0x17, 0xAD, 0xF1, 0x9A, 0x14, 0x25, 0x84, 0xB2, 0x5E, 0x6C, 0x08, 0x29, 0xC0, 0xDF, 0x03, 0x7C,
+        0x0B, 0xA2, 0x00, 0xBC, 0xDC, 0x5C, 0x47, 0x10, 0x9A, 0x5A, 0xDF, 0x19, 0x84, 0xEB, 0x3A, 0x66,
+        0x1A, 0x81, 0xEE, 0x4D, 0xE2, 0x01, 0x7C, 0xA9, 0x0A, 0x37, 0xD6, 0x6A, 0x68, 0x94, 0x60, 0xB8,
+        0x23, 0x06, 0x30, 0x42, 0x39, 0xDF, 0x29, 0x80, 0x11, 0x92, 0x2E, 0x7F, 0xF1, 0xFB, 0x87, 0x6E,
+        0x1C, 0x93, 0x03, 0xB3, 0x51, 0xF4, 0x52, 0xA3, 0xA1, 0x03, 0x46, 0x00, 0x28, 0x42, 0xE3, 0x37,
+        0x93, 0xDC, 0x9C, 0x2E, 0xF8, 0x98, 0x13, 0x4C, 0x22, 0x83, 0x08, 0x8A, 0x0E, 0xA4, 0x44, 0xF1,
+        0xDD, 0x28, 0xCA, 0x1E, 0x6C, 0x72, 0x90, 0x13, 0xCF, 0x78, 0x19, 0x23, 0xD0, 0x97, 0x47, 0xA3,
+        0x5B, 0x04, 0xE5, 0xC3, 0xB1, 0x87, 0xDF, 0xFE, 0x39, 0xAA, 0x11, 0x90, 0x01, 0xC1, 0xD0, 0x43,
+        0x13, 0x5A, 0x6B, 0xDD, 0x78, 0x8A, 0x26, 0xA6, 0xB3, 0xD6, 0xE1, 0x02, 0xF0, 0x34, 0x01, 0xE6,
+        0xCC, 0xEE, 0x4B, 0x89, 0x3D, 0x66, 0x9A, 0x8C, 0xF1, 0xBD, 0x4A, 0x00, 0x8E, 0x23, 0x8B, 0x9B,
+        0xC4, 0x1E, 0x74, 0x87, 0x1B, 0x1C, 0x6C, 0x62, 0x50, 0x0A, 0x69, 0x92, 0x4D, 0x04, 0xD0, 0x06,
+        0xB3, 0xC6, 0xF4, 0x4C, 0xC4, 0xEB, 0x30, 0x9C, 0x17, 0x86, 0x68, 0xA5, 0x00, 0x04, 0x5C, 0x20,
+        0x5F, 0x1C, 0xE8, 0x77, 0x9B, 0x23, 0x2C, 0xCB, 0x12, 0x23, 0x12, 0x03, 0x2F, 0x9D, 0xC0, 0x71,
+        0x02, 0x33, 0x49, 0xEA, 0xE0, 0x05, 0xB3, 0xD2, 0x37, 0xB4, 0xAB, 0x41, 0x7B, 0xA3, 0xBC, 0x32,
+        0x27, 0x56, 0x10, 0x04, 0x84, 0x34, 0x6A, 0x4E, 0x99, 0x9F, 0x1B, 0xA6, 0x27, 0x37, 0x06, 0x20,
+        0x02, 0x6F, 0xFB, 0x4F, 0xFB, 0x80, 0x00, 0x80, 0x08, 0x0A, 0x20, 0x00, 0x40, 0xC0, 0x05, 0x00,
+        0x10, 0x18, 0xA9, 0x71, 0x8A, 0xAA, 0xD5, 0x62, 0xA2, 0x91, 0x0A, 0x29, 0xE9, 0xBF, 0x2E, 0xCE,
+        0xAF, 0x3F, 0xD1, 0xFC, 0x5F, 0xD7, 0xF2, 0xE3, 0x80, 0x58, 0x63, 0x6D, 0xEB, 0xAF, 0xB9, 0xED,
+        0x75, 0xDA, 0x4B, 0x2C, 0x1B, 0x0E, 0xD3, 0x97, 0x16, 0xC5, 0x6C, 0xEA, 0xB4, 0xAD, 0x36, 0x0D,
+        0xA9, 0x55, 0x9E, 0xC3, 0x65, 0x07, 0xB0, 0xA5, 0x2C, 0xAD, 0xCD, 0x11, 0x2A, 0x59, 0x51, 0x67,
+        0x62, 0x8C, 0xEC, 0x1A, 0x15, 0x27, 0x62, 0x8C, 0xEC, 0x51, 0xB2, 0x8D, 0x10, 0x77, 0x2B, 0x65,
+        0x29, 0x49, 0xD2, 0x8C, 0xD2, 0x7B, 0x15, 0xA3, 0x6C, 0xD1, 0x2B, 0x4A, 0xAF, 0x65, 0x5B, 0xD1,
+        0xCB, 0xB6, 0x76, 0x9D, 0x4B, 0xEC, 0xBA, 0x46, 0x4B, 0xCC, 0x64, 0xC9, 0xB6, 0xDB, 0xDA, 0x81,
+        0x1F, 0xCB, 0xFD, 0x7F, 0xC5, 0xF4, 0x79, 0xFA, 0xB6, 0x65, 0xBE, 0x99, 0xE2, 0x80, 0x09, 0x2A,
+        0x8A, 0xC5, 0x6A, 0xAA, 0xB1, 0xC2, 0xAA, 0xC0, 0x9F, 0x0E, 0x61, 0xE6, 0xF8, 0x43, 0x28, 0x90,
+        0xBA, 0xB0, 0xE4, 0x64, 0x5C, 0xC9, 0xDD, 0x9A, 0xAA, 0xC5, 0x5D, 0x4D, 0x44, 0x81, 0xB0, 0xD3,
+        0xC1, 0x66, 0x5A, 0xD6, 0xE8, 0x7A, 0x5F, 0x8D, 0xFB, 0x1E, 0x64, 0x80, 0x0C, 0x10, 0x41, 0x04,
+        0x20, 0x95, 0x2D, 0x3D, 0x42, 0xA5, 0x50, 0x75, 0x00, 0x96, 0x04, 0x60, 0xC5, 0x43, 0xC4, 0x25,
+        0x04, 0x7C, 0x92, 0x61, 0x93, 0x0E, 0x39, 0x90, 0x1C, 0x92, 0x3F, 0x13, 0x8E, 0x1E, 0x26, 0x09,
+        0x86, 0x39, 0x32, 0xF0, 0x86, 0x40, 0x71, 0xC8, 0x48, 0xF8, 0xC8, 0xF8, 0x83, 0x30, 0x32, 0x0F,
+        0x8C, 0x8F, 0x8C, 0x18, 0x4C, 0x70, 0x98, 0x43, 0x97, 0x20, 0xE3, 0x86, 0x18, 0x3E, 0x18, 0xF0,
+        0x47, 0xE3, 0x24, 0xC2, 0x66, 0x3C, 0x32, 0x61, 0x08, 0x49, 0x60, 0xC2, 0x51, 0x87, 0x15, 0x04,
+        0x71, 0x03, 0x08, 0x46, 0x8C, 0x52, 0xA5, 0x08, 0xA1, 0xA8, 0x46, 0x12, 0x08, 0x42, 0x11, 0x80,
+        0xD1, 0xFE, 0xCF, 0xFF, 0xA1, 0x7F, 0x1B, 0xD2, 0xE8, 0x6B, 0x5A, 0x99, 0x01, 0x44, 0x06, 0x00,
+        0x20, 0x45, 0x0C, 0x52, 0xB9, 0xCC, 0xCC, 0xDE, 0xCC, 0xCD, 0x8C, 0x89, 0x1A, 0x77, 0x9D, 0x10,
+        0x02, 0x6F, 0xFE, 0xC3, 0xFF, 0xB4, 0x08, 0x08, 0x00, 0x40, 0x42, 0x82, 0x04, 0x10, 0x20, 0x50,
+        0x61, 0x83, 0x11, 0x10, 0x19, 0xC8, 0x62, 0x8C, 0x01, 0x2E, 0x1C, 0xFC, 0xFF, 0x0F, 0xF8, 0x57,
+        0xEA, 0xFF, 0x8F, 0xFF, 0x27, 0xF2, 0x6C, 0x8E, 0x19, 0x61, 0x8E, 0x38, 0x24, 0x8E, 0x09, 0x22,
+        0xFA, 0xF6, 0xEE, 0xBE, 0x9D, 0x3B, 0xA6, 0x8E, 0xD6, 0xE9, 0xBA, 0x6C, 0xED, 0x36, 0x0F, 0x4E,
+        0xE7, 0x46, 0xA9, 0xB4, 0x51, 0x6C, 0xD4, 0x5A, 0xE6, 0xAC, 0xD1, 0x13, 0x61, 0xB1, 0x4D, 0xE5,
+        0xA8, 0xC5, 0xB0, 0xAC, 0x56, 0x54, 0x04, 0xE2, 0x8E, 0x44, 0x36, 0x2B, 0x1A, 0x4A, 0xB1, 0xA3,
+        0x79, 0xA2, 0xCD, 0x26, 0x89, 0xB0, 0x57, 0x71, 0xAA, 0x3B, 0x2A, 0xA2, 0x5D, 0x16, 0xA7, 0x73,
+        0xA7, 0x66, 0x89, 0x7B, 0x34, 0xDD, 0x36, 0xB7, 0x74, 0x1D, 0xE9, 0xD3, 0xD7, 0x76, 0xF5, 0xF5,
+        0xF5, 0x60, 0xE2, 0x40, 0x87, 0x0E, 0x0C, 0x58, 0x30, 0xEE, 0x78, 0x9F, 0x53, 0xE1, 0xF6, 0xB8,
+        0x19, 0x13, 0xFD, 0xFD, 0xF1, 0x99, 0x03, 0x4A, 0x90, 0xB3, 0x61, 0x0A, 0x50, 0xAB, 0x58, 0xC4,
+        0x46, 0x94, 0x05, 0x10, 0xD9, 0x20, 0xCE, 0x5B, 0xBB, 0xCC, 0xEF, 0x77, 0xDC, 0xF2, 0xC1, 0xC5,
+        0x89, 0x0A, 0x00, 0x08, 0xC2, 0x4A, 0x1C, 0x49, 0x60, 0xB6, 0xDE, 0x23, 0xD5, 0x71, 0x47, 0xFC,
+        0xA0, 0x94, 0x48, 0x40, 0xA5, 0x02, 0x91, 0x48, 0xA0, 0x51, 0x54, 0xB4, 0x30, 0x31, 0x42, 0xAA,
+        0x14, 0x15, 0x0A, 0xA1, 0x47, 0x10, 0x28, 0xE0, 0x61, 0x8F, 0x84, 0xC9, 0x0E, 0x61, 0x24, 0xC7,
+        0x83, 0x09, 0x32, 0x5E, 0x48, 0xF0, 0x87, 0x05, 0x38, 0xC8, 0x73, 0x73, 0x23, 0x26, 0x04, 0xF6,
+        0xB6, 0xD7, 0xB1, 0x9E, 0x03, 0x63, 0xCC, 0x6F, 0x5B, 0x0C, 0x66, 0x0E, 0x48, 0xCC, 0xCD, 0xE0,
+        0x32, 0x3C, 0x1E, 0x10, 0xE3, 0x27, 0x28, 0xCC, 0x90, 0x9C, 0x72, 0x48, 0x67, 0x01, 0x93, 0x21,
+        0xE5, 0xF0, 0xF1, 0xE1, 0x9E, 0x25, 0x42, 0xA8, 0x54, 0x28, 0xAA, 0x15, 0x81, 0x82, 0x1A, 0x55,
+        0x51, 0x85, 0xA5, 0xA5, 0x8D, 0x2C, 0x30, 0x80, 0x83, 0x02, 0x08, 0x75, 0xC5, 0x7A, 0xAF, 0x11,
+        0xB6, 0xC1, 0x49, 0x38, 0x50, 0x48, 0x61, 0x11, 0x39, 0xDD, 0xF3, 0x3D, 0xDE, 0xF7, 0x39, 0xBB,
+        0x1B, 0x7D, 0x68, 0xD0, 0x03, 0x6F, 0xFF, 0xCE, 0x06, 0xFF, 0xFD, 0x08, 0x81, 0x24, 0x06, 0x90,
+        0x12, 0x18, 0x20, 0x30, 0xC1, 0x42, 0x04, 0x50, 0xC3, 0x04, 0x14, 0x47, 0x6E, 0x0D, 0x7D, 0x3E,
+        0xAE, 0x5F, 0x81, 0xF9, 0x58, 0x85, 0x0F, 0x72, 0x53, 0x96, 0x4E, 0xF8, 0x5C, 0x41, 0x39, 0xEF,
+        0x86, 0xF0, 0x40, 0x80, 0x8C, 0x64, 0xB8, 0x8E, 0x4E, 0xF2, 0x68, 0x5A, 0xDE, 0x09, 0x40, 0x8A,
+        0xBA, 0x2F, 0x04, 0x6B, 0xE3, 0x64, 0xB8, 0xCB, 0x86, 0xF8, 0x2A, 0xE4, 0xDC, 0xB8, 0x4E, 0xF9,
+        0xBC, 0xD1, 0xE3, 0xBE, 0x37, 0x8A, 0x19, 0xBE, 0x6D, 0x2E, 0x32, 0x91, 0x86, 0x21, 0xA2, 0x75,
+        0xB8, 0x2A, 0xBA, 0x60, 0x25, 0x30, 0xAE, 0x94, 0xD1, 0x4D, 0x5E, 0x08, 0x70, 0xE8, 0xB4, 0x95,
+        0x8F, 0x0B, 0x8C, 0xB8, 0xB9, 0x3B, 0x32, 0x15, 0xC2, 0x9C, 0x48, 0x40, 0xA5, 0x7C, 0x64, 0x0F,
+        0x1D, 0xF1, 0xB0, 0x97, 0x16, 0x30, 0x41, 0x02, 0x1B, 0xC3, 0xBF, 0x34, 0x06, 0x5C, 0x3B, 0xE2,
+        0xE6, 0x98, 0xDF, 0x3D, 0x5C, 0x3F, 0xC9, 0xEF, 0xE6, 0x75, 0xB5, 0x2C, 0x42, 0x70, 0x84, 0x82,
+        0x08, 0x41, 0x03, 0x33, 0x65, 0x43, 0x59, 0x5E, 0xD7, 0x93, 0xB4, 0xD9, 0xCB, 0x5D, 0xF5, 0xDE,
+        0xA5, 0xC4, 0xD3, 0x71, 0x09, 0x2A, 0x44, 0x39, 0x0A, 0xC6, 0xA7, 0x5B, 0x33, 0xBF, 0xF9, 0x38,
+        0x64, 0x90, 0x18, 0x22, 0x09, 0xB8, 0xBE, 0x74, 0xCB, 0x03, 0x7E, 0x74, 0x1F, 0xBE, 0x61, 0x1A,
+        0xD4, 0x50, 0xD0, 0x4C, 0xE2, 0x4D, 0x0C, 0xF1, 0x68, 0x62, 0x43, 0x7C, 0xD9, 0x9D, 0x99, 0x3B,
+        0x07, 0x17, 0x2C, 0x72, 0x9C, 0xEC, 0x92, 0x91, 0xA7, 0x0C, 0x1C, 0x5D, 0x4D, 0x4A, 0xAB, 0x25,
+        0x12, 0x90, 0x0E, 0xAE, 0xA3, 0x7A, 0x24, 0x93, 0x80, 0xE0, 0xA5, 0x9E, 0x1C, 0xE2, 0x60, 0x41,
+        0x79, 0x5F, 0x35, 0xE6, 0xF3, 0x7C, 0xE8, 0xC3, 0x2E, 0x6C, 0xC5, 0x7C, 0xD3, 0x28, 0xC7, 0x2C,
+        0x95, 0xF1, 0xAF, 0x95, 0xE1, 0x5D, 0x02, 0x11, 0x38, 0xDE, 0x84, 0xAA, 0xB0, 0xDE, 0x97, 0xBB,
+        0x6B, 0x46, 0x08, 0x27, 0x34, 0xF3, 0xDE, 0x03, 0x94, 0x44, 0x1C, 0x42, 0x19, 0x80, 0x31, 0x10,
+        0xEA, 0xF2, 0x7F, 0xFA, 0xBF, 0xC1, 0xEB, 0x4F, 0xE5, 0xF8, 0xF9, 0xF0, 0xD6, 0x78, 0x42, 0x11,
+        0x8C, 0x84, 0x29, 0x86, 0x68, 0xD1, 0xC2, 0xB8, 0x46, 0x00, 0x02, 0x7F, 0xF6, 0x0F, 0xF6, 0x60,
+        0x40, 0x40, 0xA0, 0xE0, 0xC1, 0x40, 0xE1, 0x61, 0x61, 0xC1, 0x61, 0x81, 0x61, 0x06, 0x06, 0x4E,
+        0x0E, 0xFF, 0xB5, 0xFD, 0x7F, 0xFA, 0xDF, 0xC9, 0xDE, 0x8B, 0x22, 0x34, 0x98, 0xB1, 0x63, 0x4B,
+        0x9D, 0xEF, 0x7B, 0xCE, 0xF6, 0xFB, 0xB9, 0xDB, 0xDC, 0x95, 0xEC, 0xCE, 0x5D, 0xB9, 0xB3, 0x6D,
+        0xBC, 0x8A, 0xDD, 0x75, 0xAD, 0xB5, 0x3B, 0x07, 0xB9, 0xA6, 0xA2, 0xA7, 0x72, 0x94, 0x63, 0xB1,
+        0x13, 0x71, 0xB1, 0x60, 0x70, 0xE6, 0xEB, 0xF7, 0xC2, 0x0B, 0x2C, 0x11, 0x97, 0x15, 0xCA, 0x39,
+        0xB1, 0x88, 0x31, 0x9B, 0x97, 0x02, 0xAF, 0x76, 0x93, 0x76, 0x90, 0x0F, 0xBF, 0x5D, 0x9C, 0x3B,
+        0x42, 0xCA, 0xE6, 0x88, 0xCD, 0x65, 0x06, 0xE7, 0x45, 0x47, 0x4D, 0xCE, 0xCE, 0x88, 0xDB, 0x5A,
+        0xEB, 0xB5, 0x7D, 0xA4, 0xDD, 0x9B, 0x97, 0x6F, 0x32, 0x77, 0x73, 0xB3, 0x39, 0xAB, 0xDC, 0xE7,
+        0x38, 0xCE, 0x73, 0x9D, 0x6B, 0x36, 0x16, 0x4C, 0x69, 0x11, 0x77, 0xBF, 0x93, 0xFF, 0x5B, 0xFA,
+        0xFE, 0xD6, 0xFE, 0x0C, 0x98, 0x32, 0x05, 0x8F, 0x86, 0xDD, 0x36, 0xDA, 0xDA, 0x52, 0xD2, 0x44,
+        0x65, 0x33, 0x44, 0xB5, 0x71, 0xB6, 0x59, 0x6B, 0x96, 0x79, 0x5E, 0x49, 0x3C, 0x9F, 0xE0, 0x6E,
+        0xDB, 0xF6, 0x1F, 0xEB, 0xBF, 0x29, 0x7C, 0x30, 0x90, 0xE2, 0x83, 0x06, 0x0E, 0x1C, 0x30, 0x60,
+        0xC3, 0xA4, 0xA9, 0x44, 0xC2, 0x0D, 0x44, 0xA3, 0x42, 0x84, 0xC5, 0xA8, 0xC4, 0x56, 0x16, 0x22,
+        0x23, 0x49, 0x45, 0x12, 0xA5, 0x0A, 0x22, 0x10, 0xC1, 0xC3, 0xA0, 0x3C, 0x84, 0x90, 0xF2, 0xE1,
+        0x8C, 0xE2, 0x19, 0x9F, 0xBB, 0x7A, 0xDA, 0xF0, 0x1C, 0x1C, 0x9B, 0xC0, 0x21, 0x1C, 0x44, 0x84,
+        0x72, 0xC9, 0x2E, 0x5E, 0x30, 0x58, 0x11, 0x8F, 0x2E, 0x59, 0x25, 0x0F, 0x59, 0x97, 0xAC, 0xC3,
+        0xF0, 0xEC, 0xC4, 0xC0, 0x31, 0x91, 0xC8, 0x37, 0x84, 0x23, 0xC8, 0xE1, 0x97, 0xC0, 0x64, 0x84,
+        0xE1, 0xCB, 0xE3, 0xE1, 0x33, 0x0A, 0x14, 0x2A, 0x55, 0x09, 0x6A, 0x22, 0x30, 0x8E, 0x0C, 0x90,
+        0x49, 0x31, 0x52, 0x0D, 0x44, 0xA3, 0x40, 0xF0, 0x4A, 0x52, 0x54, 0xA5, 0x29, 0x6B, 0x52, 0x9A,
+        0x5B, 0x26, 0x19, 0x7D, 0xF9, 0x4F, 0xF5, 0xDF, 0xB0, 0xED, 0xB0, 0x10, 0x85, 0x02, 0x0F, 0x2A,
+        0x5C, 0xA9, 0xB2, 0xA7, 0xAD, 0x73, 0x9D, 0x62, 0x66, 0x03, 0x7F, 0xFD, 0x30, 0x33, 0xFF, 0x51,
+        0x04, 0x08, 0x02, 0x04, 0x06, 0x00, 0x0C, 0x07, 0x00, 0x09, 0x0F, 0x25, 0x53, 0x6C, 0x5F, 0x97,
+        0xE3, 0xF6, 0x9F, 0x84, 0xCC, 0x01, 0x00, 0x08, 0x30, 0x71, 0x00, 0xC2, 0x01, 0x04, 0x39, 0xB9,
+        0x9B, 0x39, 0xB8, 0xE5, 0xE5, 0x20, 0x19, 0x6B, 0xD3, 0x4D, 0xA1, 0x60, 0x67, 0x7C, 0xA6, 0x6E,
+        0x4B, 0x02, 0x35, 0x6B, 0x19, 0xD6, 0x68, 0x9C, 0x67, 0x13, 0x04, 0xA5, 0x20, 0xF5, 0xCF, 0x12,
+        0x04, 0x4D, 0x30, 0xFD, 0xFD, 0xEB, 0x0B, 0x0B, 0x08, 0x07, 0xAB, 0x38, 0xCE, 0x99, 0x41, 0x4E,
+        0x07, 0xB9, 0x2C, 0x00, 0x1C, 0x6F, 0x9D, 0x2A, 0x20, 0xA8, 0xCE, 0xAD, 0x63, 0x30, 0x00, 0x16,
+        0x00, 0xC0, 0x19, 0x7C, 0xDC, 0x29, 0xA6, 0x05, 0x6F, 0xAC, 0xC0, 0x26, 0x8B, 0x2A, 0xBD, 0x5A,
+        0x53, 0xAC, 0xEA, 0xCE, 0x25, 0x01, 0x71, 0xBC, 0xA6, 0x77, 0xCA, 0x0C, 0x81, 0x4D, 0x37, 0x6B,
+        0x22, 0x13, 0x37, 0x2C, 0xBC, 0xD7, 0x96, 0xF2, 0xAC, 0x08, 0x18, 0x40, 0xE2, 0x02, 0x81, 0x00,
+        0x0B, 0x2F, 0xF8, 0x3D, 0x9F, 0x21, 0xE6, 0x31, 0x92, 0x87, 0xED, 0x84, 0x82, 0x13, 0x05, 0x31,
+        0x73, 0x6D, 0xD8, 0xD4, 0x70, 0x43, 0x14, 0x02, 0xC8, 0x00, 0xA4, 0x23, 0x6A, 0x79, 0x9F, 0xEC,
+        0x7E, 0x87, 0xD3, 0x5F, 0xFF, 0x0F, 0xD7, 0x08, 0x00, 0x45, 0x20, 0x71, 0x03, 0x08, 0x10, 0xC6,
+        0x0C, 0x31, 0xE3, 0xBC, 0xB2, 0xE6, 0xE0, 0x82, 0x06, 0xB7, 0x65, 0x95, 0xB4, 0x0D, 0xF3, 0xB8,
+        0x5E, 0x57, 0x12, 0x6F, 0x89, 0x5E, 0xB3, 0xA9, 0x4A, 0xF5, 0x74, 0xCD, 0x12, 0x42, 0x33, 0xD6,
+        0xE8, 0x07, 0x53, 0x13, 0x86, 0x82, 0x1A, 0x1A, 0x1E, 0xFF, 0x8B, 0x0A, 0xF5, 0x98, 0x44, 0x1A,
+        0xBC, 0x33, 0x02, 0x80, 0x12, 0xCC, 0xEF, 0x9B, 0x08, 0x2D, 0xF9, 0xEF, 0x8F, 0x7E, 0x50, 0x22,
+        0x02, 0x44, 0x08, 0xE7, 0x79, 0x79, 0xB8, 0x10, 0x9E, 0x39, 0xD3, 0x09, 0x4A, 0x89, 0xC6, 0x70,
+        0x44, 0xD6, 0x75, 0x9C, 0x2B, 0xA2, 0x13, 0x50, 0x3B, 0x85, 0xF3, 0xB8, 0x11, 0x64, 0x10, 0xCB,
+        0xD6, 0x98, 0xCE, 0xFD, 0xC3, 0x8E, 0x6F, 0x26, 0xE6, 0x6E, 0x47, 0x2F, 0x8C, 0x1C, 0x30, 0x20,
+        0x00, 0x73, 0x1F, 0x84, 0xDA, 0x71, 0xFE, 0x5F, 0x17, 0x26, 0x94, 0x78, 0x90, 0x05, 0x7C, 0x0A,
+        0x85, 0x88, 0x02, 0x8F, 0xCB, 0x1F, 0x99, 0x01, 0x81, 0x40, 0xE0, 0x88, 0x5C, 0x34, 0x1A, 0x0D,
+        0x85, 0x80, 0xE2, 0x3B, 0xBF, 0x3A, 0xF6, 0x5B, 0x7F, 0xF7, 0x7D, 0x8A, 0x53, 0xE7, 0x4D, 0x9D,
+        0x2E, 0x64, 0xC9, 0x32, 0xE3, 0xCC, 0x8D, 0x22, 0x77, 0xC7, 0x17, 0xC6, 0x75, 0x8C, 0xE3, 0x35,
+        0xA8, 0xDC, 0xC7, 0xBB, 0xEB, 0xEB, 0xE9, 0xEB, 0xD3, 0xA6, 0xA3, 0xA6, 0xD1, 0xAA, 0xA7, 0x71,
+        0xD1, 0x96, 0x2B, 0x36, 0x14, 0x8A, 0x04, 0x5A, 0x4D, 0x1D, 0xB0, 0xD9, 0x37, 0x19, 0x73, 0x70,
+        0x42, 0x0A, 0x45, 0xCA, 0x65, 0x8C, 0x62, 0x00, 0x00, 0x58, 0x58, 0xCB, 0x85, 0xC5, 0x83, 0x01,
+        0x13, 0x37, 0x2C, 0x73, 0x64, 0xB2, 0x07, 0x16, 0x4B, 0x44, 0x85, 0x85, 0x26, 0xC5, 0x65, 0x9A,
+        0x8E, 0x74, 0x55, 0xA9, 0x74, 0xD7, 0x48, 0x58, 0xB3, 0x91, 0x93, 0x93, 0x99, 0xB7, 0xD9, 0x8D,
+        0x56, 0x71, 0x9C, 0x6B, 0x3C, 0x5F, 0x1C, 0x6F, 0x8D, 0x5C, 0x64, 0x3C, 0x5C, 0x4C, 0x64, 0x64,
+        0x5C, 0x74, 0x6C, 0x74, 0x7C, 0x96, 0xE3, 0xF7, 0xBF, 0xE9, 0x7E, 0xEA, 0xBF, 0xCF, 0xC7, 0x3A,
+        0x65, 0x6A, 0x95, 0x27, 0x42, 0x71, 0x43, 0x0C, 0x2C, 0xB4, 0xDC, 0x6C, 0x84, 0xB4, 0xCC, 0xCC,
+        0xD4, 0xAC, 0x35, 0x22, 0xE1, 0xEE, 0xDF, 0xD3, 0x3E, 0xF9, 0x72, 0x26, 0x20, 0x4B, 0xAC, 0xBA,
+        0x8A, 0xAA, 0x92, 0x88, 0x2A, 0x74, 0x50, 0x45, 0x12, 0x0F, 0x2A, 0x5A, 0x54, 0x95, 0x1A, 0xC5,
+        0x82, 0x41, 0xA4, 0x45, 0xA5, 0xA1, 0xA5, 0x81, 0x81, 0x4A, 0x85, 0x40, 0x93, 0x24, 0x90, 0xF2,
+        0xCE, 0x38, 0xC0, 0xDA, 0xFD, 0x3C, 0xB6, 0x63, 0x05, 0x99, 0x63, 0xD5, 0xEA, 0xFC, 0x36, 0x39,
+        0x79, 0x48, 0x0C, 0x18, 0x1B, 0xBC, 0xEF, 0x5A, 0xD6, 0x00, 0x00, 0x35, 0xAD, 0x07, 0xB9, 0xEE,
+        0xDA, 0x68, 0xCE, 0x1E, 0x5C, 0x65, 0xE2, 0xE2, 0xE0, 0x40, 0x99, 0xAC, 0x66, 0xD3, 0xC2, 0x3C,
+        0x64, 0x8E, 0x3C, 0x97, 0xC2, 0x12, 0x4A, 0x10, 0x8A, 0x14, 0xA8, 0x60, 0x60, 0x96, 0x86, 0x96,
+        0x96, 0xAB, 0x11, 0xE1, 0x75, 0x5C, 0x22, 0x98, 0xA7, 0x32, 0x24, 0x45, 0x14, 0x11, 0x3A, 0xA8,
+        0x28, 0x91, 0xC6, 0x86, 0x86, 0x07, 0x87, 0x07, 0x88, 0x09, 0xAE, 0x5F, 0x7C, 0xFE, 0x99, 0xEE,
+        0xD7, 0x04, 0x80, 0xD2, 0xB5, 0xAB, 0x4E, 0x9C, 0xD8, 0x2D, 0xA6, 0x58, 0x03, 0x8F, 0xED, 0x40,
+        0x67, 0xF6, 0x58, 0x48, 0x1C, 0x0A, 0x06, 0x01, 0x02, 0x24, 0x16, 0x1D, 0xF7, 0x88, 0xDD, 0x1A,
+        0xB2, 0x20, 0x2A, 0xA3, 0x10, 0x8E, 0x1C, 0x42, 0x9D, 0x34, 0x38, 0xE3, 0x1E, 0x26, 0x59, 0xCF,
+        0x7E, 0x68, 0xE4, 0xB3, 0x36, 0x65, 0xC5, 0xE6, 0xE0, 0x23, 0x26, 0xF0, 0x46, 0x73, 0xB2, 0x21,
+        0xAC, 0x9E, 0xED, 0x61, 0x62, 0x53, 0x11, 0x9C, 0x09, 0xC5, 0xC2, 0x21, 0xD1, 0x09, 0xC5, 0xE2,
+        0xE2, 0x24, 0x43, 0x86, 0xA0, 0x3F, 0xBC, 0xDD, 0x86, 0xEC, 0x00, 0x0D, 0xCF, 0x40, 0x00, 0xBD,
+        0x0B, 0xD3, 0xBF, 0xDC, 0x46, 0x1C, 0x31, 0x4D, 0xE2, 0xF1, 0x74, 0x24, 0xA0, 0x22, 0xF1, 0x74,
+        0x2F, 0x4D, 0xD1, 0x21, 0x85, 0xAF, 0x73, 0x2D, 0x61, 0x5F, 0x35, 0x84, 0x37, 0x8B, 0x00, 0x6F,
+        0x36, 0x4B, 0x95, 0xE5, 0x71, 0xBC, 0x1F, 0x7E, 0x6B, 0x94, 0x9B, 0x19, 0x65, 0x50, 0x89, 0x30,
+        0x46, 0x32, 0x1C, 0x41, 0x18, 0xC4, 0x52, 0xFF, 0xFF, 0xDE, 0xFF, 0x2B, 0xB3, 0xF9, 0x27, 0x7C,
+        0xA2, 0x21, 0x09, 0x01, 0x85, 0x84, 0x86, 0x88, 0x83, 0x8B, 0x83, 0x88, 0xB8, 0x68, 0x48, 0x58,
+        0x18, 0x92, 0x15, 0x13, 0xBE, 0x79, 0x25, 0x9F, 0xE5, 0x78, 0xF8, 0x28, 0x28, 0x10, 0x18, 0xD6,
+        0x77, 0x2D, 0x79, 0xEE, 0x36, 0x58, 0x2C, 0xD8, 0x5C, 0x77, 0xE7, 0xBC, 0xAE, 0x23, 0x78, 0xDC,
+        0xB2, 0x6F, 0x28, 0x45, 0x1E, 0x69, 0x08, 0xEF, 0x8B, 0x18, 0x83, 0x0B, 0x8C, 0x40, 0x8B, 0xCB,
+        0x4B, 0x56, 0x2A, 0xF0, 0xCA, 0x11, 0x22, 0xAF, 0x03, 0xDF, 0x2D, 0xE1, 0x72, 0xE3, 0x7C, 0xA2,
+        0x1E, 0x85, 0xE8, 0x00, 0x17, 0x9D, 0x80, 0x18, 0x6C, 0x02, 0x58, 0x67, 0x72, 0x5C, 0xA5, 0x02,
+        0x62, 0x2F, 0x17, 0x89, 0x14, 0xC1, 0x43, 0x9D, 0xF3, 0x4F, 0x3D, 0xCC, 0xD9, 0x10, 0x06, 0x32,
+        0xE0, 0x91, 0x8C, 0x9D, 0xE0, 0xC4, 0x4E, 0x6C, 0x88, 0x66, 0xF1, 0x23, 0x0E, 0x14, 0xC2, 0x6A,
+        0x27, 0x59, 0xA4, 0x37, 0x07, 0x8C, 0x71, 0xC9, 0x7E, 0x6C, 0x70, 0x40, 0x40, 0x30, 0x80, 0x10,
+        0x20, 0x40, 0x40, 0x10, 0x60, 0x6C, 0x83, 0xE5, 0x96, 0x8F, 0x23, 0xEF, 0x6B, 0xF8, 0x78, 0x28,
+        0x88, 0x61, 0x47, 0x24, 0x03, 0x8F, 0xF9, 0x70, 0x1D, 0xFF, 0x22, 0x87, 0x83, 0x00, 0xE0, 0x60,
+        0xA5, 0x73, 0xA5, 0x78, 0x6D, 0x8D, 0xD1, 0x14, 0x60, 0x20, 0x04, 0x55, 0x4F, 0xA9, 0xD1, 0xA7,
+        0xC4, 0xE2, 0x74, 0xD1, 0x54, 0xD0, 0x40, 0x0A, 0x9A, 0x9D, 0x49, 0xA1, 0x18, 0xE2, 0x4B, 0x93,
+        0x7C, 0xD7, 0xE0, 0xFB, 0xE5, 0x79, 0xB8, 0xE5, 0x23, 0x94, 0x1C, 0xDF, 0x34, 0xCB, 0x07, 0x11,
+        0x30, 0x96, 0x70, 0x4D, 0x5D, 0x38, 0x69, 0x35, 0x01, 0xFD, 0xE3, 0x76, 0x0D, 0xD8, 0x00, 0x01,
+        0xBB, 0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x02, 0xF4, 0x17, 0xA3, 0xBF, 0xDC, 0x2E, 0x2E, 0x5C,
+        0xDF, 0x36, 0x4E, 0xFC, 0x68, 0x90, 0x96, 0x0E, 0x53, 0x9D, 0xE5, 0x0A, 0x1A, 0x22, 0x1A, 0x75,
+        0x2A, 0x2F, 0x59, 0x19, 0xCE, 0xF1, 0xB8, 0x92, 0xC6, 0x1A, 0x33, 0x9E, 0xF3, 0x79, 0xA0, 0x26,
+        0xF3, 0x52, 0x8C, 0xD5, 0xD6, 0xE2, 0x56, 0x6B, 0x98, 0x99, 0x2E, 0x0F, 0xC2, 0xFF, 0x83, 0xD1,
+        0x7F, 0x1C, 0xF8, 0xB4, 0xE8, 0xA8, 0x2C, 0x34, 0x5C, 0x74, 0x54, 0x6C, 0x54, 0x75, 0xC5, 0xC3,
+        0x42, 0xCA, 0xA7, 0x5F, 0x16, 0xFC, 0x72, 0x8B, 0xFC, 0x1F, 0x85, 0x83, 0x80, 0x82, 0x82, 0x82,
+        0x06, 0x95, 0x65, 0x4C, 0x6E, 0xAE, 0xB3, 0x06, 0x6A, 0x40, 0xA0, 0x6F, 0x37, 0x9E, 0xF2, 0x69,
+        0x18, 0x4D, 0x03, 0x0C, 0xD5, 0xD2, 0xCE, 0xAE, 0x11, 0x4D, 0x34, 0xE0, 0x14, 0xE0, 0x3A, 0xBA,
+        0x12, 0xE2, 0x4B, 0x08, 0x57, 0xE7, 0x60, 0xCD, 0xF3, 0x72, 0xE2, 0xE3, 0x7C, 0xA0, 0x17, 0xA0,
+        0xBD, 0x00, 0x00, 0x2F, 0x40, 0x00, 0x00, 0x37, 0x60, 0x00, 0x06, 0xEC, 0x20, 0x12, 0xC0, 0xCE,
+        0xE4, 0xB2, 0x0D, 0xCB, 0xCE, 0xF1, 0x7C, 0xF6, 0x60, 0x88, 0xE2, 0x4B, 0x86, 0xF9, 0xB8, 0x5C,
+        0x61, 0x07, 0x06, 0x26, 0x8B, 0xC6, 0x74, 0x67, 0x12, 0x33, 0x2C, 0x1C, 0x62, 0x71, 0xDF, 0x9A,
+        0x55, 0x34, 0x00, 0x42, 0xA6, 0x93, 0xD4, 0xE1, 0x82, 0x8C, 0x06, 0x18, 0x08, 0xA0, 0xA3, 0x81,
+        0x86, 0x0C, 0x08, 0x47, 0xE3, 0x3F, 0xFF, 0x11, 0xC3, 0x3F, 0xE3, 0x7F, 0x15, 0x9C, 0x94, 0x86,
+        0x07, 0x0C, 0x0F, 0x00, 0x03, 0x9F, 0xB0, 0x00, 0xB7, 0xD4, 0xF0, 0xB0, 0x24, 0x00, 0x08, 0x7A,
+        0x63, 0x8D, 0xA4, 0x46, 0x42, 0x42, 0x20, 0x00, 0x14, 0x00, 0xC1, 0x02, 0x3A, 0xC3, 0xE1, 0x40,
+        0xC3, 0xD1, 0x83, 0x86, 0x51, 0x0E, 0x22, 0xF0, 0x9C, 0x11, 0x4D, 0x31, 0xE0, 0x99, 0xB9, 0x2F,
+        0x34, 0xE6, 0xF3, 0x4A, 0xA6, 0x9A, 0x22, 0x1D, 0x67, 0x57, 0x8C, 0xE0, 0x96, 0x70, 0x54, 0xD3,
+        0x87, 0x0D, 0x45, 0xC0, 0x37, 0x63, 0x76, 0x00, 0x03, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x17, 0xA0, 0x00, 0x2F, 0x45, 0xE9, 0xC5, 0x86, 0x61, 0xC3, 0x89, 0xA2,
+        0xAF, 0x46, 0xCB, 0x57, 0x8C, 0xEA, 0x61, 0x84, 0x62, 0x6A, 0x68, 0x77, 0x9A, 0x73, 0x71, 0xBC,
+        0xA4, 0x37, 0x05, 0xCD, 0x25, 0xC7, 0xBE, 0x5B, 0x96, 0xE1, 0x5A, 0x6B, 0x31, 0x61, 0x9D, 0xC5,
+        0xE5, 0x76, 0xE0, 0x82, 0x60, 0x1E, 0x43, 0xFF, 0x03, 0x83, 0xFF, 0xB7, 0x7E, 0x65, 0x08, 0x00,
+        0x23, 0x2B, 0x2F, 0x2B, 0x2F, 0x2B, 0x72, 0x30, 0x08, 0x47, 0xE6, 0x5F, 0xED, 0xD0, 0x7F, 0xF8,
+        0x1F, 0x90, 0x80, 0x09, 0x82, 0x07, 0x81, 0x04, 0x83, 0x82, 0x16, 0xCB, 0x17, 0x19, 0x4D, 0x5C,
+        0x37, 0x0C, 0x6F, 0x9D, 0x72, 0xC3, 0x71, 0xCD, 0x20, 0x4E, 0x99, 0x89, 0xA1, 0x35, 0x35, 0x35,
+        0x30, 0x45, 0x07, 0x13, 0xAC, 0xE2, 0xF5, 0x67, 0x56, 0x85, 0xE6, 0xE5, 0xCB, 0x8D, 0xF2, 0x8E,
+        0x20, 0x5E, 0x80, 0x08, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
+        0xD8, 0x00, 0x42, 0x58, 0x12, 0xC3, 0x3B, 0x92, 0x94, 0x38, 0x75, 0x28, 0xE3, 0x2B, 0x19, 0xC5,
+        0xE8, 0xB3, 0x4E, 0x01, 0x4E, 0xA6, 0xA6, 0xA6, 0x80, 0xEF, 0x2C, 0xCD, 0xC1, 0x39, 0x65, 0xE0,
+        0x2E, 0x59, 0xE7, 0x73, 0x2E, 0x65, 0xF1, 0xC5, 0x4A, 0x0C, 0x80, 0x04, 0x08, 0xC0, 0xC8, 0x28,
+        0x14, 0x03, 0x50, 0x0F, 0xFF, 0xF8, 0x51, 0xE8, 0x44, 0x47, 0x9B, 0x78, 0xC5, 0x0E, 0x00, 0x12,
+        0x0B, 0x00, 0x03, 0x9F, 0xD3, 0x80, 0xB3, 0xF3, 0xC4, 0x4E, 0x0E, 0x03, 0x9B, 0x47, 0xC3, 0x70,
+        0x2B, 0x70, 0x26, 0x70, 0x20, 0x07, 0x01, 0x00, 0x40, 0x18, 0x55, 0xA5, 0xA1, 0x88, 0x1C, 0x4D,
+        0x25, 0x02, 0x06, 0xE6, 0x39, 0x70, 0x23, 0x97, 0x00, 0x5C, 0xB9, 0x79, 0xB8, 0x2F, 0x9A, 0x66,
+        0x96, 0x2F, 0x19, 0xD3, 0x74, 0x4C, 0x35, 0x17, 0x01, 0xBB, 0x1B, 0xB0, 0x0C, 0x1D, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xE8,
+        0x00, 0x5E, 0x8B, 0xD7, 0x16, 0x19, 0x86, 0x94, 0xC4, 0x67, 0x57, 0x8B, 0xA1, 0xA7, 0x3B, 0x21,
+        0x79, 0xB9, 0x72, 0xC0, 0x4B, 0x96, 0x21, 0x72, 0xCB, 0x72, 0x90, 0x64, 0xCD, 0x6C, 0x3B, 0x19,
+        0x39, 0x9D, 0xC0, 0x1C, 0x0E, 0x0D, 0x07, 0xEC, 0xDF, 0xAF, 0xC1, 0x3F, 0x8E, 0x3A, 0x90, 0x74,
+        0x37, 0x26, 0x91, 0x4A, 0xE4, 0x52, 0x6C, 0x0D, 0xC7, 0x5D, 0x49, 0xF8, 0xE0, 0x13, 0xF5, 0xFE,
+        0xCD, 0x07, 0x83, 0x40, 0xE0, 0x70, 0x58, 0x14, 0x12, 0x01, 0x04, 0x89, 0xDA, 0x7D, 0xE6, 0xAD,
+        0x2E, 0x5B, 0x06, 0xE5, 0x06, 0x5C, 0xA1, 0x2E, 0x52, 0x89, 0xA6, 0x12, 0xBA, 0x0E, 0xAF, 0x17,
+        0xA1, 0xF7, 0x33, 0x64, 0xB8, 0xDF, 0x2B, 0x88, 0x0B, 0xD0, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD8, 0x04, 0x09,
+        0x60, 0x4B, 0x33, 0xB9, 0x29, 0x41, 0x34, 0xDE, 0xB3, 0x8B, 0xC4, 0xC0, 0x9C, 0x0A, 0x99, 0xBC,
+        0xB9, 0x71, 0x0C, 0xB8, 0x2C, 0x0C, 0xB8, 0xE6, 0x5C, 0x32, 0x43, 0x65, 0xA0, 0x24, 0x02, 0x45,
+        0x26, 0xA4, 0x21, 0x6C, 0x26, 0x67, 0x6E, 0x00, 0x15, 0xC3, 0x7B, 0x46, 0x1C, 0x87, 0x02, 0x70,
+        0x03, 0x9F, 0xEB, 0x40, 0x81, 0xFC, 0xE1, 0x1F, 0x05, 0xAC, 0x09, 0xF1, 0x4C, 0xCD, 0xE9, 0x35,
+        0xC2, 0x03, 0x81, 0x80, 0x38, 0x0E, 0x03, 0x80, 0x82, 0xD5, 0x74, 0xAA, 0x30, 0x28, 0x62, 0x78,
+        0x9A, 0x25, 0x07, 0x17, 0x10, 0x4A, 0xAB, 0x55, 0x7A, 0xB1, 0x8F, 0x95, 0x78, 0x85, 0xE2, 0x3C,
+        0x0F, 0xEF, 0x6E, 0xCD, 0xD8, 0x0C, 0x1D, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xE8, 0x40, 0x01,
+        0xC4, 0x71, 0xBE, 0x68, 0xC2, 0x6E, 0x04, 0xD9, 0x33, 0xB1, 0xF0, 0xB3, 0x89, 0x38, 0x92, 0x93,
+        0x78, 0xB4, 0xD1, 0x4D, 0x6E, 0xAC, 0x48, 0xB7, 0x27, 0x99, 0xCD, 0xC0, 0x34, 0x1A, 0x0D, 0x0B,
+        0x83, 0x7B, 0x07, 0xF8, 0x95, 0x9D, 0xFE, 0x54, 0xF0, 0x51, 0x64, 0xF6, 0x85, 0x3F, 0xA1, 0x4F,
+        0x70, 0x59, 0xF0, 0x57, 0xF9, 0x51, 0x9D, 0xFC, 0x4B, 0xD8, 0x20, 0xD0, 0xB8, 0x34, 0x1A, 0x0D,
+        0x03, 0x82, 0x40, 0xA0, 0xD0, 0x09, 0x4B, 0xB1, 0x22, 0xEB, 0x75, 0x29, 0xAB, 0xC1, 0x36, 0x91,
+        0x9C, 0x19, 0xC6, 0x70, 0x55, 0xC0, 0xC9, 0xB0, 0x33, 0x61, 0x37, 0xCA, 0xE0, 0x4B, 0xD0, 0x17,
+        0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xB0, 0x08, 0x4B, 0x09, 0x66, 0x77, 0x88, 0xF0, 0x98,
+        0x06, 0x89, 0x78, 0x2A, 0xF5, 0x74, 0x8A, 0xE9, 0x13, 0x11, 0x78, 0x30, 0x6A, 0x78, 0x93, 0x80,
+        0x30, 0x41, 0x18, 0xAC, 0xD2, 0x85, 0xAD, 0x6E, 0x12, 0x07, 0x5C, 0x2E, 0x93, 0x19, 0xBE, 0x29,
+        0xE0, 0x48, 0xB4, 0x3E, 0x00, 0x03, 0xAF, 0x49, 0x81, 0xDB, 0xCB, 0xA9, 0x2A, 0x81, 0x3D, 0x72,
+        0xA2, 0x1C, 0x6C, 0x47, 0x50, 0x22, 0x03, 0x00, 0x70, 0x0A, 0x01, 0x00, 0x20, 0x03, 0x0B, 0x5E,
+        0x06, 0x38, 0x43, 0x42, 0x05, 0x15, 0x52, 0x54, 0x61, 0xE3, 0x38, 0x70, 0x1D, 0x4D, 0x4C, 0x0E,
+        0x7B, 0xE3, 0x37, 0x25, 0x92, 0xC0, 0x01, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xBD, 0x02, 0x0E, 0x2E, 0x37, 0x8C, 0xEF, 0xCB, 0x4A, 0xA6, 0xA6, 0x03, 0x8B, 0xD5,
+        0xC3, 0x53, 0x45, 0x25, 0x48, 0x63, 0x20, 0xEE, 0xC7, 0x79, 0xDC, 0x03, 0xC1, 0xE1, 0x30, 0xD8,
+        0x5C, 0x43, 0xEE, 0x9F, 0xF6, 0xBE, 0x22, 0xFF, 0xDC, 0xDE, 0x14, 0x8A, 0x5A, 0xAE, 0xB6, 0xAC,
+        0x53, 0x1E, 0x14, 0xFF, 0xDC, 0xD8, 0x8B, 0xFD, 0xAF, 0xEE, 0x91, 0x08, 0x5C, 0x36, 0x13, 0x07,
+        0x83, 0xC1, 0x60, 0x90, 0x78, 0x00, 0x0E, 0x3F, 0x53, 0xD2, 0x9B, 0x1D, 0xE6, 0xCB, 0x85, 0x7A,
+        0xB8, 0x62, 0x26, 0xA6, 0x9B, 0xD5, 0xA1, 0x79, 0x5C, 0x5C, 0x40, 0x1C, 0x40, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xEC, 0x1B, 0x89, 0x26, 0xA2, 0x51, 0xC6, 0x62, 0x26,
+        0xA6, 0x89, 0x88, 0x78, 0xCE, 0x1C, 0x1A, 0x9A, 0x46, 0x8C, 0x10, 0x24, 0x05, 0x48, 0x06, 0x12,
+        0xA6, 0x18, 0x69, 0xD2, 0x41, 0x80, 0x8B, 0x3A, 0xBC, 0xD8, 0x84, 0x3F, 0x39, 0x70, 0x4D, 0x2A,
+        0x03, 0xAF, 0xA6, 0xA1, 0x5D, 0xF0, 0x22, 0xE8, 0xF9, 0xC9, 0x81, 0x7D, 0x69, 0x53, 0x80, 0x36,
+        0x05, 0x00, 0xB0, 0x0F, 0x01, 0x80, 0x28, 0x05, 0x80, 0x61, 0x71, 0x5E, 0x29, 0x60, 0x60, 0x25,
+        0x00, 0x0A, 0x1D, 0xC0, 0x97, 0x8D, 0xC2, 0x6F, 0x2C, 0x0D, 0xD8, 0x6E, 0xC0, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0x0B, 0xD4, 0x39, 0xBC, 0x4B,
+        0x93, 0x71, 0x0B, 0xCD, 0x20, 0x03, 0x24, 0x58, 0xB3, 0x3D, 0xCE, 0xF7, 0x20, 0xA8, 0x26, 0x0B,
+        0x83, 0xA1, 0x58, 0x4E, 0x1A, 0xF1, 0xBF, 0xE6, 0x8E, 0x0C, 0x7E, 0xE5, 0x5A, 0x48, 0xAE, 0xAD,
+        0xC5, 0x7B, 0x49, 0x3F, 0xB9, 0x58, 0x31, 0xF3, 0x47, 0x8D, 0xE1, 0xA8, 0x4E, 0x15, 0x83, 0xA0,
+        0xB8, 0x26, 0x0A, 0x81, 0x60, 0x58, 0x0A, 0x07, 0x80, 0xA2, 0xF4, 0xE8, 0xB4, 0x0D, 0xE5, 0x01,
+        0x73, 0x66, 0x51, 0xE6, 0xE2, 0xE2, 0x01, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x2C, 0x02, 0x59, 0x2F, 0x36, 0x09, 0x95, 0xE5, 0x81, 0x9B,
+        0xC0, 0x30, 0xC8, 0x82, 0x01, 0x02, 0x6C, 0x1A, 0x94, 0xDB, 0x4E, 0x1D, 0xA8, 0x16, 0x02, 0x80,
+        0x6D, 0x4E, 0x1A, 0xD2, 0x81, 0x7E, 0x72, 0x5D, 0x18, 0x03, 0xAF, 0xE1, 0xD1, 0x5B, 0x7F, 0x61,
+        0xFE, 0x33, 0xEA, 0xEF, 0x91, 0xEC, 0x3C, 0x05, 0xC0, 0xA0, 0x10, 0x01, 0x50, 0x2C, 0x03, 0xC0,
+        0x70, 0x08, 0x01, 0x62, 0x5E, 0xAB, 0x11, 0x10, 0x75, 0x38, 0x9C, 0x34, 0x86, 0xF3, 0x72, 0x6F,
+        0x2E, 0x58, 0x12, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x01, 0x0E, 0x20, 0xE5, 0xCD, 0xE3, 0x79, 0xB8, 0x91, 0x8B, 0xAB, 0xAC, 0xA6,
+        0xDD, 0xCF, 0x93, 0xF3, 0x40, 0x3C, 0x0D, 0x81, 0xD0, 0x56, 0x0A, 0x41, 0xF8, 0x4F, 0x0B, 0x78,
+        0x77, 0xE4, 0x76, 0xAF, 0x3C, 0x68, 0x29, 0xC9, 0x6B, 0x53, 0x9E, 0x34, 0x23, 0xF5, 0xE7, 0xFF,
+        0xC3, 0xBF, 0xE7, 0x72, 0xD9, 0x3C, 0x7E, 0x29, 0x15, 0x87, 0x43, 0x60, 0xF0, 0xA8, 0x04, 0x22,
+        0x05, 0x03, 0x93, 0x6D, 0x66, 0xAE, 0xAE, 0x09, 0x89, 0xA6, 0x2F, 0x37, 0x2E, 0x20, 0xE2, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+        0x76, 0x09, 0x38, 0x75, 0x2A, 0x26, 0x9A, 0x4F, 0x12, 0x70, 0x59, 0x0A, 0x22, 0x41, 0xB2, 0x2D,
+        0xB0, 0xE9, 0xDB, 0xE9, 0x40, 0xA8, 0x20, 0x05, 0x00, 0xB9, 0x87, 0x8E, 0x47, 0xAA, 0xEF, 0xC6,
+        0x78, 0x03, 0xAF, 0xFB, 0xF4, 0x42, 0xBF, 0xFF, 0x9F, 0x7D, 0x33, 0xF8, 0x32, 0xD9, 0x80, 0xC4,
+        0x11, 0xC1, 0xC8, 0x2C, 0x03, 0xA0, 0x64, 0x09, 0x80, 0xE0, 0x12, 0x02, 0x45, 0xD5, 0x69, 0x45,
+        0x23, 0x08, 0x00, 0x21, 0x83, 0xDD, 0x9B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xD2, 0xF7, 0x3C, 0x34, 0x01,
+        0xB1, 0xDA, 0xFB, 0xBF, 0xBF, 0xED, 0x01, 0x10, 0x36, 0x09, 0x41, 0x88, 0x39, 0x0A, 0xE1, 0xC4,
+        0x46, 0x8C, 0x3D, 0x97, 0xF8, 0x31, 0xD3, 0x47, 0xA0, 0x48, 0x2C, 0xF4, 0x09, 0xA6, 0x88, 0xFF,
+        0xFF, 0x18, 0xFF, 0xF1, 0x7B, 0x0D, 0x1A, 0x71, 0x2B, 0x8E, 0x46, 0x22, 0x50, 0xD8, 0x44, 0x22,
+        0x0D, 0x02, 0x82, 0x40, 0x23, 0x75, 0x95, 0x00, 0xB8, 0x5C, 0x41, 0x7A, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBB,
+        0x37, 0x79, 0xDE, 0x06, 0x04, 0x82, 0x4C, 0x85, 0x26, 0xB6, 0x59, 0x74, 0xF6, 0xFC, 0xA8, 0x1D,
+        0x05, 0x80, 0xE4, 0x23, 0x86, 0x26, 0xCC, 0x3C, 0x19, 0x69, 0x9C, 0x03, 0xBF, 0x93, 0x70, 0x1F,
+        0x7F, 0x76, 0x7B, 0xDE, 0xE6, 0x41, 0x64, 0x40, 0xEC, 0x0A, 0x00, 0x76, 0x04, 0xA0, 0x40, 0x02,
+        0x60, 0x1E, 0x01, 0x00, 0x18, 0x00, 0x02, 0xF0, 0x70, 0x31, 0x29, 0x43, 0x45, 0x26, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x04, 0x38, 0xB1, 0xCA, 0xBC, 0xE9, 0xD9, 0xFD, 0x28, 0x0B, 0x80, 0xF0, 0x3A,
+        0x09, 0x41, 0xF8, 0x49, 0x0E, 0xA2, 0x7C, 0x75, 0xF4, 0x87, 0xEC, 0x7F, 0xBB, 0xEF, 0x8F, 0xA0,
+        0xF7, 0xF1, 0xF5, 0xDD, 0xF4, 0xFF, 0xD1, 0xFF, 0xE2, 0x19, 0xD6, 0x4F, 0x8E, 0xA2, 0x48, 0x7E,
+        0x12, 0x83, 0xA0, 0x78, 0x2E, 0x00, 0x01, 0xE0, 0x10, 0x0E, 0x00, 0x0F, 0x78, 0xB7, 0x18, 0xB8,
+        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xB4, 0x64, 0x68, 0x44, 0xB0, 0x08, 0x0E, 0x01, 0xC3,
+        0x0E, 0xDE, 0xD4, 0x10, 0x02, 0x50, 0x76, 0x14, 0x03, 0xB3, 0xA4, 0x4F, 0x64, 0x1D, 0xDE, 0x80,
+        0x02, 0xBF, 0xF0, 0x04, 0xF0, 0xCE, 0xFD, 0x2B, 0xF8, 0xFF, 0xB5, 0x19, 0xF4, 0x95, 0xD8, 0xD5,
+        0x89, 0x08, 0x59, 0x83, 0xD8, 0x24, 0x81, 0x98, 0x10, 0x80, 0x88, 0x07, 0x87, 0xF5, 0xFF, 0x6E,
+        0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xC1, 0x2C, 0xF5, 0xEF, 0xF7, 0xFD, 0xB0,
+        0x21, 0x03, 0x30, 0x49, 0x07, 0xB0, 0xB3, 0x12, 0x11, 0xAB, 0x2B, 0xB3, 0xE9, 0x6A, 0x3E, 0x3F,
+        0xFF, 0xA5, 0x7F, 0x73, 0x5E, 0xE6, 0xDF, 0xA5, 0x87, 0x20, 0x08, 0xFD, 0x49, 0xDD, 0x5A, 0xF2,
+        0xAC, 0x88, 0x96, 0x87, 0xC2, 0x50, 0xD0, 0x44, 0x12, 0x08, 0x02, 0x00, 0x40, 0xA0, 0x08, 0x79,
+        0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x10, 0x08, 0x04, 0x0A, 0x84, 0x88, 0x22,
+        0xC5, 0xC9, 0xEA, 0xFE, 0xCB, 0x0B, 0x41, 0x22, 0x1A, 0xC2, 0xBC, 0x3E, 0xA6, 0xA4, 0xE4, 0x01,
+        0xFA, 0x58, 0x00, 0x02, 0xBF, 0xF7, 0xF0, 0xF4, 0x08, 0xFE, 0xD9, 0x7D, 0xE4, 0xD8, 0xCC, 0xC1,
+        0x47, 0xFC, 0x3C, 0xC2, 0x94, 0x14, 0x40, 0xCC, 0x05, 0xC0, 0x3C, 0x02, 0xC0, 0x04, 0x01, 0x41,
+        0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x4F, 0xAB, 0x00, 0xB0, 0x0F, 0x01,
+        0x70, 0x33, 0x05, 0x10, 0xA5, 0x0F, 0x31, 0xFF, 0x30, 0x56, 0x33, 0xEF, 0x27, 0xFD, 0xB2, 0xFC,
+        0xF9, 0xFC, 0xFA, 0x3F, 0xB6, 0x67, 0x79, 0x47, 0xFF, 0xF3, 0x4F, 0xC1, 0xBC, 0x02, 0xE9, 0x26,
+        0x52, 0x34, 0x18, 0x10, 0x0C, 0x02, 0x06, 0x00, 0x02, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x14, 0x29, 0x71, 0xE3, 0xF1, 0xFF, 0xF1, 0x60, 0xA4, 0x14,
+        0xC1, 0xE8, 0x40, 0x06, 0x0C, 0xC6, 0x9D, 0xE5, 0x3F, 0xB6, 0x60, 0x02, 0xBF, 0xFB, 0x5E, 0x7B,
+        0xCA, 0x7F, 0xC3, 0x77, 0xD7, 0x75, 0x1C, 0xC6, 0x04, 0x40, 0xC0, 0xFC, 0x0F, 0x40, 0x0C, 0x05,
+        0xC0, 0x18, 0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x30, 0x00, 0x00, 0x05, 0x00, 0x30, 0x05, 0xC0, 0x06, 0x03, 0xD0, 0x1F, 0x84, 0x0C,
+        0x30, 0x24, 0x73, 0xCB, 0xBB, 0xE8, 0xDD, 0xCE, 0x4F, 0x9C, 0xA3, 0xD1, 0xBD, 0x97, 0x79, 0xBF,
+        0xFF, 0xED, 0x3F, 0x05, 0xE1, 0x20, 0x1F, 0x04, 0x30, 0x14, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x0E, 0x6F, 0xFF, 0x96,
+        0x00, 0x80, 0x7C, 0x08, 0x02, 0x08, 0x30, 0x48, 0xE9, 0xEB, 0xBD, 0xFF, 0x0D, 0xE0, 0x01, 0xBF,
+        0xFF, 0x7B, 0x0F, 0xFF, 0xE4, 0xAD, 0xB0, 0xA2, 0xCD, 0x0E, 0x30, 0x22, 0x01, 0xE0, 0x08, 0x80,
+        0xB0, 0x06, 0x80, 0x60, 0x03, 0x80, 0x30, 0x02, 0x80, 0x30, 0x02, 0x87, 0x80, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7E, 0xFB, 0xF6, 0x00, 0x14, 0x01, 0x00, 0x0B, 0x00, 0x70,
+        0x05, 0x40, 0x24, 0x03, 0xB0, 0x21, 0x87, 0x14, 0xB3, 0x33, 0x09, 0xFF, 0x52, 0xAF, 0xFF, 0xBD,
+        0x7F, 0xFA, 0x95, 0x66, 0x13, 0x2C, 0xCA, 0xFF, 0xFE, 0x2E, 0x1D, 0xB4, 0x95, 0x38, 0xB2, 0x05,
+        0x18, 0x51, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03,
+        0x37, 0x9B, 0xCE, 0xFE, 0x7E, 0xE0, 0x05, 0x80, 0x22, 0x03, 0xC0, 0x22, 0x07, 0x18, 0xB3, 0x53,
+        0x0A, 0x7F, 0x52, 0xB0, 0x00, 0x00, 0x00, 0x00
+    };
+
+    static const AKWFTableRef tables[count] PROGMEM = {
+        { data +      0, 600 },   //   0 AKWF_rAsymSqu_01
+        { data +    318, 600 },   //   1 AKWF_rAsymSqu_02
+        { data +    613, 600 },   //   2 AKWF_rAsymSqu_03
+        { data +    904, 600 },   //   3 AKWF_rAsymSqu_04
+        { data +   1203, 600 },   //   4 AKWF_rAsymSqu_05
+        { data +   1505, 600 },   //   5 AKWF_rAsymSqu_06
+        { data +   1795, 600 },   //   6 AKWF_rAsymSqu_07
+        { data +   2102, 600 },   //   7 AKWF_rAsymSqu_08
+        { data +   2397, 600 },   //   8 AKWF_rAsymSqu_09
+        { data +   2699, 600 },   //   9 AKWF_rAsymSqu_10
+        { data +   2991, 600 },   //  10 AKWF_rAsymSqu_11
+        { data +   3280, 600 },   //  11 AKWF_rAsymSqu_12
+        { data +   3548, 600 },   //  12 AKWF_rAsymSqu_13
+        { data +   3809, 600 },   //  13 AKWF_rAsymSqu_14
+        { data +   4051, 600 },   //  14 AKWF_rAsymSqu_15
+        { data +   4276, 600 },   //  15 AKWF_rAsymSqu_16
+        { data +   4482, 600 },   //  16 AKWF_rAsymSqu_17
+        { data +   4684, 600 },   //  17 AKWF_rAsymSqu_18
+        { data +   4882, 600 },   //  18 AKWF_rAsymSqu_19
+        { data +   5072, 600 },   //  19 AKWF_rAsymSqu_20
+        { data +   5258, 600 },   //  20 AKWF_rAsymSqu_21
+        { data +   5442, 600 },   //  21 AKWF_rAsymSqu_22
+        { data +   5622, 600 },   //  22 AKWF_rAsymSqu_23
+        { data +   5803, 600 },   //  23 AKWF_rAsymSqu_24
+        { data +   5980, 600 },   //  24 AKWF_rAsymSqu_25
+        { data +   6160, 600 },   //  25 AKWF_rAsymSqu_26
+        { data +   6344, 600 },   //  26 AKWF_rSymSqu_01
+        { data +   6657, 600 },   //  27 AKWF_rSymSqu_02
+        { data +   6957, 600 },   //  28 AKWF_rSymSqu_03
+        { data +   7255, 600 },   //  29 AKWF_rSymSqu_04
+        { data +   7561, 600 },   //  30 AKWF_rSymSqu_05
+        { data +   7865, 600 },   //  31 AKWF_rSymSqu_06
+        { data +   8176, 600 },   //  32 AKWF_rSymSqu_07
+        { data +   8496, 600 },   //  33 AKWF_rSymSqu_08
+        { data +   8820, 600 },   //  34 AKWF_rSymSqu_09
+        { data +   9146, 600 },   //  35 AKWF_rSymSqu_10
+        { data +   9481, 600 },   //  36 AKWF_rSymSqu_11
+        { data +   9810, 600 },   //  37 AKWF_rSymSqu_12
+        { data +  10140, 600 },   //  38 AKWF_rSymSqu_13
+        { data +  10452, 600 },   //  39 AKWF_rSymSqu_14
+        { data +  10756, 600 },   //  40 AKWF_rSymSqu_15
+        { data +  11042, 600 },   //  41 AKWF_rSymSqu_16
+        { data +  11296, 600 },   //  42 AKWF_rSymSqu_17
+        { data +  11541, 600 },   //  43 AKWF_rSymSqu_18
+        { data +  11776, 600 },   //  44 AKWF_rSymSqu_19
+        { data +  11993, 600 },   //  45 AKWF_rSymSqu_20
+        { data +  12209, 600 },   //  46 AKWF_rSymSqu_21
+        { data +  12411, 600 },   //  47 AKWF_rSymSqu_22
+        { data +  12608, 600 },   //  48 AKWF_rSymSqu_23
+        { data +  12803, 600 },   //  49 AKWF_rSymSqu_24
+        { data +  12987, 600 },   //  50 AKWF_rSymSqu_25
+        { data +  13166, 600 }    //  51 AKWF_rSymSqu_26
+    };
+
+} // namespace AKWF_BwSqurounded
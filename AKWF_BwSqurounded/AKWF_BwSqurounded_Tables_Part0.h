@@ -1,1304 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwSqurounded {
-
-    // AKWF_rAsymSqu_01 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_01[600] PROGMEM = {
-        128, 382, 636, 887, 1137, 1387, 1637, 1888, 2134, 2381, 2631, 2878, 
-        3121, 3367, 3610, 3853, 4096, 4339, 4582, 4825, 5064, 5303, 5542, 5782, 
-        6017, 6256, 6492, 6728, 6963, 7199, 7431, 7666, 7898, 8130, 8362, 8590, 
-        8822, 9050, 9278, 9506, 9735, 9963, 10187, 10415, 10640, 10865, 11085, 11310, 
-        11531, 11755, 11976, 12197, 12418, 12635, 12856, 13073, 13290, 13507, 13724, 13938, 
-        14155, 14368, 14582, 14795, 15009, 15219, 15432, 15642, 15852, 16061, 16271, 16481, 
-        16687, 16897, 17103, 17309, 17515, 17718, 17924, 18126, 18332, 18535, 18737, 18936, 
-        19138, 19337, 19540, 19738, 19937, 20136, 20331, 20530, 20725, 20923, 21119, 21314, 
-        21505, 21700, 21895, 22087, 22278, 22469, 22661, 22852, 23040, 23231, 23419, 23607, 
-        23794, 23982, 24170, 24357, 24541, 24725, 24910, 25094, 25278, 25462, 25646, 25826, 
-        26006, 26190, 26371, 26551, 26728, 26908, 27085, 27265, 27442, 27618, 27795, 27972, 
-        28148, 28321, 28494, 28671, 28844, 29017, 29190, 29359, 29532, 29702, 29875, 30044, 
-        30213, 30383, 30552, 30721, 30887, 31052, 31222, 31387, 31553, 31719, 31884, 32046, 
-        32197, 32330, 32444, 32539, 32617, 32679, 32723, 32753, 32767, 32767, 32753, 32723, 
-        32687, 32631, 32569, 32495, 32410, 32315, 32208, 32094, 31973, 31840, 31700, 31553, 
-        31398, 31236, 31067, 30894, 30710, 30526, 30331, 30132, 29930, 29724, 29510, 29293, 
-        29072, 28848, 28620, 28384, 28148, 27909, 27666, 27423, 27173, 26923, 26669, 26415, 
-        26157, 25896, 25635, 25370, 25105, 24840, 24571, 24299, 24026, 23754, 23481, 23205, 
-        22929, 22653, 22374, 22094, 21814, 21534, 21255, 20971, 20688, 20408, 20125, 19841, 
-        19554, 19271, 18987, 18704, 18417, 18134, 17850, 17563, 17280, 16996, 16709, 16426, 
-        16142, 15855, 15572, 15289, 15005, 14722, 14438, 14155, 13872, 13588, 13308, 13025, 
-        12745, 12462, 12182, 11902, 11623, 11343, 11063, 10787, 10507, 10231, 9955, 9679, 
-        9403, 9127, 8851, 8579, 8303, 8030, 7758, 7486, 7213, 6945, 6672, 6404, 
-        6135, 5866, 5598, 5333, 5064, 4799, 4534, 4269, 4004, 3743, 3478, 3216, 
-        2955, 2694, 2436, 2175, 1917, 1659, 1402, 1144, 887, 633, 379, 121, 
-        -128, -382, -636, -887, -1137, -1387, -1637, -1888, -2134, -2381, -2631, -2878, 
-        -3121, -3367, -3610, -3853, -4096, -4339, -4582, -4825, -5064, -5303, -5542, -5782, 
-        -6017, -6256, -6492, -6728, -6963, -7199, -7431, -7666, -7898, -8130, -8362, -8590, 
-        -8822, -9050, -9278, -9506, -9735, -9963, -10187, -10415, -10640, -10865, -11085, -11310, 
-        -11531, -11755, -11976, -12197, -12418, -12635, -12856, -13073, -13290, -13507, -13724, -13938, 
-        -14155, -14368, -14582, -14795, -15009, -15219, -15432, -15642, -15852, -16061, -16271, -16481, 
-        -16687, -16897, -17103, -17309, -17515, -17718, -17924, -18126, -18332, -18535, -18737, -18936, 
-        -19138, -19337, -19540, -19738, -19937, -20136, -20331, -20530, -20725, -20923, -21119, -21314, 
-        -21505, -21700, -21895, -22087, -22278, -22469, -22661, -22852, -23040, -23231, -23419, -23607, 
-        -23794, -23982, -24170, -24357, -24541, -24725, -24910, -25094, -25278, -25462, -25646, -25826, 
-        -26006, -26190, -26371, -26551, -26728, -26908, -27085, -27265, -27442, -27618, -27795, -27972, 
-        -28148, -28321, -28494, -28671, -28844, -29017, -29190, -29359, -29532, -29702, -29875, -30044, 
-        -30213, -30383, -30552, -30721, -30887, -31052, -31222, -31387, -31553, -31719, -31884, -32046, 
-        -32197, -32330, -32444, -32539, -32617, -32679, -32723, -32753, -32767, -32767, -32753, -32723, 
-        -32687, -32631, -32569, -32495, -32410, -32315, -32208, -32094, -31973, -31840, -31700, -31553, 
-        -31398, -31236, -31067, -30894, -30710, -30526, -30331, -30132, -29930, -29724, -29510, -29293, 
-        -29072, -28848, -28620, -28384, -28148, -27909, -27666, -27423, -27173, -26923, -26669, -26415, 
-        -26157, -25896, -25635, -25370, -25105, -24840, -24571, -24299, -24026, -23754, -23481, -23205, 
-        -22929, -22653, -22374, -22094, -21814, -21534, -21255, -20971, -20688, -20408, -20125, -19841, 
-        -19554, -19271, -18987, -18704, -18417, -18134, -17850, -17563, -17280, -16996, -16709, -16426, 
-        -16142, -15855, -15572, -15289, -15005, -14722, -14438, -14155, -13872, -13588, -13308, -13025, 
-        -12745, -12462, -12182, -11902, -11623, -11343, -11063, -10787, -10507, -10231, -9955, -9679, 
-        -9403, -9127, -8851, -8579, -8303, -8030, -7758, -7486, -7213, -6945, -6672, -6404, 
-        -6135, -5866, -5598, -5333, -5064, -4799, -4534, -4269, -4004, -3743, -3478, -3216, 
-        -2955, -2694, -2436, -2175, -1917, -1659, -1402, -1144, -887, -633, -379, -121 
-    };
-
-    // AKWF_rAsymSqu_02 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_02[600] PROGMEM = {
-        7, 269, 529, 788, 1046, 1303, 1558, 1813, 2068, 2320, 2570, 2820, 
-        3070, 3318, 3565, 3810, 4055, 4298, 4541, 4784, 5024, 5262, 5500, 5738, 
-        5975, 6208, 6444, 6677, 6910, 7140, 7371, 7599, 7827, 8053, 8281, 8505, 
-        8730, 8954, 9175, 9395, 9616, 9835, 10053, 10272, 10488, 10701, 10917, 11131, 
-        11342, 11553, 11764, 11976, 12184, 12391, 12597, 12803, 13010, 13214, 13417, 13619, 
-        13820, 14022, 14221, 14420, 14619, 14815, 15012, 15206, 15400, 15595, 15789, 15981, 
-        16170, 16362, 16551, 16740, 16927, 17114, 17301, 17485, 17670, 17854, 18036, 18219, 
-        18401, 18580, 18760, 18939, 19117, 19294, 19471, 19646, 19821, 19995, 20168, 20340, 
-        20512, 20685, 20855, 21024, 21192, 21362, 21529, 21694, 21862, 22027, 22190, 22355, 
-        22517, 22680, 22840, 23003, 23163, 23321, 23481, 23639, 23796, 23952, 24107, 24262, 
-        24418, 24571, 24726, 24876, 25029, 25180, 25330, 25481, 25629, 25779, 25927, 26073, 
-        26221, 26367, 26512, 26656, 26801, 26945, 27085, 27228, 27369, 27510, 27651, 27792, 
-        27930, 28068, 28207, 28343, 28479, 28614, 28750, 28886, 29020, 29153, 29287, 29418, 
-        29551, 29682, 29814, 29942, 30073, 30202, 30331, 30457, 30585, 30712, 30838, 30962, 
-        31088, 31212, 31335, 31459, 31583, 31704, 31826, 31947, 32068, 32187, 32309, 32428, 
-        32542, 32639, 32712, 32753, 32767, 32755, 32719, 32661, 32583, 32484, 32367, 32234, 
-        32083, 31918, 31741, 31549, 31345, 31132, 30906, 30670, 30428, 30175, 29915, 29648, 
-        29377, 29097, 28811, 28522, 28229, 27928, 27624, 27318, 27008, 26695, 26379, 26061, 
-        25741, 25418, 25093, 24767, 24440, 24112, 23782, 23452, 23119, 22789, 22457, 22124, 
-        21789, 21456, 21124, 20791, 20456, 20124, 19791, 19461, 19129, 18799, 18466, 18136, 
-        17808, 17478, 17151, 16825, 16498, 16172, 15847, 15524, 15201, 14881, 14558, 14240, 
-        13920, 13604, 13286, 12971, 12658, 12345, 12031, 11721, 11410, 11102, 10794, 10488, 
-        10182, 9878, 9575, 9274, 8973, 8675, 8376, 8080, 7784, 7490, 7196, 6905, 
-        6614, 6325, 6036, 5747, 5463, 5177, 4893, 4611, 4330, 4051, 3771, 3495, 
-        3218, 2941, 2667, 2395, 2123, 1854, 1585, 1315, 1048, 781, 517, 254, 
-        -7, -269, -529, -788, -1046, -1303, -1558, -1813, -2068, -2320, -2570, -2820, 
-        -3070, -3318, -3565, -3810, -4055, -4298, -4541, -4784, -5024, -5262, -5500, -5738, 
-        -5975, -6208, -6444, -6677, -6910, -7140, -7371, -7599, -7827, -8053, -8281, -8505, 
-        -8730, -8954, -9175, -9395, -9616, -9835, -10053, -10272, -10488, -10701, -10917, -11131, 
-        -11342, -11553, -11764, -11976, -12184, -12391, -12597, -12803, -13010, -13214, -13417, -13619, 
-        -13820, -14022, -14221, -14420, -14619, -14815, -15012, -15206, -15400, -15595, -15789, -15981, 
-        -16170, -16362, -16551, -16740, -16927, -17114, -17301, -17485, -17670, -17854, -18036, -18219, 
-        -18401, -18580, -18760, -18939, -19117, -19294, -19471, -19646, -19821, -19995, -20168, -20340, 
-        -20512, -20685, -20855, -21024, -21192, -21362, -21529, -21694, -21862, -22027, -22190, -22355, 
-        -22517, -22680, -22840, -23003, -23163, -23321, -23481, -23639, -23796, -23952, -24107, -24262, 
-        -24418, -24571, -24726, -24876, -25029, -25180, -25330, -25481, -25629, -25779, -25927, -26073, 
-        -26221, -26367, -26512, -26656, -26801, -26945, -27085, -27228, -27369, -27510, -27651, -27792, 
-        -27930, -28068, -28207, -28343, -28479, -28614, -28750, -28886, -29020, -29153, -29287, -29418, 
-        -29551, -29682, -29814, -29942, -30073, -30202, -30331, -30457, -30585, -30712, -30838, -30962, 
-        -31088, -31212, -31335, -31459, -31583, -31704, -31826, -31947, -32068, -32187, -32309, -32428, 
-        -32542, -32639, -32712, -32753, -32767, -32755, -32719, -32661, -32583, -32484, -32367, -32234, 
-        -32083, -31918, -31741, -31549, -31345, -31132, -30906, -30670, -30428, -30175, -29915, -29648, 
-        -29377, -29097, -28811, -28522, -28229, -27928, -27624, -27318, -27008, -26695, -26379, -26061, 
-        -25741, -25418, -25093, -24767, -24440, -24112, -23782, -23452, -23119, -22789, -22457, -22124, 
-        -21789, -21456, -21124, -20791, -20456, -20124, -19791, -19461, -19129, -18799, -18466, -18136, 
-        -17808, -17478, -17151, -16825, -16498, -16172, -15847, -15524, -15201, -14881, -14558, -14240, 
-        -13920, -13604, -13286, -12971, -12658, -12345, -12031, -11721, -11410, -11102, -10794, -10488, 
-        -10182, -9878, -9575, -9274, -8973, -8675, -8376, -8080, -7784, -7490, -7196, -6905, 
-        -6614, -6325, -6036, -5747, -5463, -5177, -4893, -4611, -4330, -4051, -3771, -3495, 
-        -3218, -2941, -2667, -2395, -2123, -1854, -1585, -1315, -1048, -781, -517, -254 
-    };
-
-    // AKWF_rAsymSqu_03 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_03[600] PROGMEM = {
-        222, 507, 789, 1070, 1350, 1628, 1904, 2179, 2451, 2722, 2990, 3259, 
-        3524, 3789, 4050, 4311, 4571, 4828, 5084, 5339, 5591, 5843, 6091, 6339, 
-        6587, 6832, 7074, 7317, 7558, 7796, 8033, 8268, 8504, 8737, 8968, 9198, 
-        9425, 9653, 9879, 10102, 10326, 10547, 10767, 10987, 11203, 11420, 11634, 11847, 
-        12060, 12269, 12479, 12687, 12894, 13099, 13302, 13506, 13707, 13907, 14106, 14304, 
-        14500, 14696, 14888, 15082, 15272, 15465, 15653, 15842, 16028, 16213, 16397, 16580, 
-        16763, 16944, 17123, 17302, 17480, 17657, 17832, 18006, 18179, 18351, 18523, 18692, 
-        18862, 19030, 19196, 19362, 19526, 19691, 19853, 20013, 20174, 20334, 20493, 20650, 
-        20806, 20963, 21118, 21271, 21424, 21575, 21726, 21875, 22025, 22172, 22319, 22465, 
-        22610, 22754, 22898, 23041, 23181, 23323, 23463, 23601, 23739, 23877, 24013, 24148, 
-        24284, 24416, 24549, 24681, 24814, 24943, 25073, 25202, 25331, 25458, 25583, 25709, 
-        25834, 25958, 26081, 26204, 26325, 26446, 26566, 26685, 26805, 26922, 27040, 27155, 
-        27271, 27387, 27501, 27614, 27726, 27838, 27950, 28060, 28170, 28280, 28389, 28497, 
-        28605, 28711, 28816, 28922, 29027, 29131, 29234, 29336, 29439, 29540, 29641, 29741, 
-        29840, 29939, 30038, 30135, 30232, 30327, 30424, 30519, 30613, 30708, 30801, 30894, 
-        30986, 31077, 31169, 31258, 31350, 31439, 31527, 31614, 31702, 31790, 31876, 31963, 
-        32047, 32133, 32217, 32301, 32385, 32467, 32549, 32631, 32706, 32758, 32767, 32734, 
-        32661, 32553, 32413, 32243, 32047, 31827, 31586, 31325, 31047, 30753, 30443, 30122, 
-        29790, 29446, 29094, 28736, 28368, 27995, 27616, 27232, 26844, 26452, 26058, 25661, 
-        25263, 24862, 24459, 24058, 23653, 23250, 22845, 22442, 22038, 21635, 21233, 20830, 
-        20431, 20032, 19633, 19235, 18840, 18446, 18054, 17662, 17274, 16886, 16500, 16116, 
-        15735, 15355, 14976, 14601, 14226, 13854, 13485, 13116, 12750, 12386, 12024, 11664, 
-        11308, 10951, 10599, 10246, 9897, 9550, 9205, 8862, 8520, 8181, 7845, 7509, 
-        7177, 6847, 6517, 6190, 5865, 5543, 5222, 4903, 4587, 4272, 3959, 3649, 
-        3339, 3031, 2727, 2423, 2123, 1822, 1526, 1229, 936, 643, 352, 65, 
-        -222, -507, -789, -1070, -1350, -1628, -1904, -2179, -2451, -2722, -2990, -3259, 
-        -3524, -3789, -4050, -4311, -4571, -4828, -5084, -5339, -5591, -5843, -6091, -6339, 
-        -6587, -6832, -7074, -7317, -7558, -7796, -8033, -8268, -8504, -8737, -8968, -9198, 
-        -9425, -9653, -9879, -10102, -10326, -10547, -10767, -10987, -11203, -11420, -11634, -11847, 
-        -12060, -12269, -12479, -12687, -12894, -13099, -13302, -13506, -13707, -13907, -14106, -14304, 
-        -14500, -14696, -14890, -15082, -15272, -15465, -15653, -15842, -16028, -16213, -16397, -16580, 
-        -16763, -16944, -17123, -17302, -17480, -17657, -17832, -18006, -18179, -18351, -18523, -18692, 
-        -18862, -19030, -19196, -19362, -19526, -19691, -19853, -20013, -20176, -20334, -20493, -20650, 
-        -20806, -20963, -21118, -21271, -21424, -21575, -21726, -21875, -22025, -22172, -22319, -22465, 
-        -22610, -22754, -22898, -23041, -23183, -23323, -23463, -23601, -23739, -23877, -24013, -24148, 
-        -24284, -24416, -24549, -24681, -24814, -24943, -25073, -25202, -25331, -25458, -25583, -25709, 
-        -25834, -25958, -26081, -26204, -26325, -26446, -26566, -26685, -26805, -26922, -27040, -27155, 
-        -27271, -27387, -27501, -27614, -27726, -27838, -27950, -28060, -28170, -28280, -28389, -28497, 
-        -28605, -28711, -28816, -28922, -29027, -29131, -29234, -29336, -29439, -29540, -29641, -29741, 
-        -29840, -29939, -30038, -30135, -30232, -30327, -30424, -30519, -30613, -30708, -30801, -30894, 
-        -30986, -31077, -31169, -31258, -31350, -31439, -31527, -31614, -31702, -31790, -31876, -31963, 
-        -32047, -32133, -32217, -32301, -32385, -32467, -32549, -32631, -32706, -32758, -32767, -32734, 
-        -32661, -32553, -32413, -32243, -32047, -31827, -31586, -31325, -31047, -30753, -30443, -30122, 
-        -29790, -29446, -29094, -28736, -28368, -27995, -27616, -27232, -26844, -26452, -26058, -25661, 
-        -25263, -24862, -24459, -24058, -23653, -23250, -22845, -22442, -22038, -21635, -21233, -20830, 
-        -20431, -20032, -19633, -19235, -18840, -18446, -18054, -17662, -17274, -16886, -16500, -16116, 
-        -15735, -15355, -14976, -14601, -14226, -13854, -13485, -13116, -12750, -12386, -12024, -11664, 
-        -11308, -10951, -10599, -10246, -9897, -9550, -9205, -8862, -8520, -8181, -7845, -7509, 
-        -7177, -6847, -6517, -6190, -5865, -5543, -5222, -4903, -4587, -4272, -3959, -3649, 
-        -3339, -3031, -2727, -2423, -2123, -1822, -1526, -1229, -936, -643, -352, -65 
-    };
-
-    // AKWF_rAsymSqu_04 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_04[600] PROGMEM = {
-        315, 642, 966, 1286, 1605, 1921, 2234, 2545, 2853, 3157, 3459, 3759, 
-        4057, 4352, 4644, 4933, 5222, 5506, 5788, 6069, 6347, 6621, 6894, 7166, 
-        7434, 7700, 7964, 8226, 8484, 8741, 8997, 9249, 9500, 9749, 9995, 10239, 
-        10482, 10722, 10961, 11196, 11431, 11663, 11893, 12121, 12348, 12572, 12794, 13015, 
-        13234, 13451, 13665, 13879, 14091, 14300, 14508, 14714, 14917, 15120, 15322, 15520, 
-        15717, 15914, 16107, 16299, 16491, 16680, 16867, 17053, 17237, 17421, 17602, 17781, 
-        17959, 18137, 18311, 18486, 18657, 18829, 18997, 19165, 19332, 19497, 19660, 19822, 
-        19984, 20143, 20301, 20458, 20614, 20768, 20920, 21073, 21222, 21371, 21518, 21666, 
-        21810, 21955, 22098, 22239, 22379, 22518, 22656, 22793, 22929, 23062, 23196, 23329, 
-        23459, 23589, 23718, 23846, 23973, 24099, 24222, 24346, 24468, 24591, 24711, 24830, 
-        24948, 25065, 25182, 25297, 25411, 25525, 25638, 25749, 25858, 25970, 26077, 26185, 
-        26292, 26398, 26503, 26607, 26711, 26812, 26914, 27015, 27114, 27214, 27312, 27409, 
-        27506, 27601, 27694, 27790, 27882, 27975, 28066, 28158, 28247, 28337, 28424, 28513, 
-        28600, 28686, 28772, 28856, 28940, 29024, 29107, 29189, 29270, 29351, 29430, 29510, 
-        29587, 29665, 29743, 29819, 29895, 29972, 30046, 30119, 30192, 30265, 30338, 30409, 
-        30479, 30551, 30621, 30689, 30757, 30825, 30893, 30960, 31027, 31092, 31157, 31222, 
-        31285, 31349, 31412, 31474, 31536, 31598, 31658, 31719, 31777, 31838, 31896, 31955, 
-        32012, 32069, 32126, 32182, 32239, 32293, 32349, 32403, 32456, 32510, 32563, 32617, 
-        32669, 32720, 32761, 32767, 32710, 32593, 32418, 32198, 31933, 31633, 31301, 30941, 
-        30557, 30154, 29732, 29294, 28845, 28383, 27913, 27436, 26953, 26465, 25971, 25476, 
-        24979, 24481, 23981, 23481, 22983, 22485, 21988, 21493, 20998, 20508, 20017, 19532, 
-        19048, 18567, 18088, 17613, 17140, 16672, 16206, 15744, 15285, 14830, 14378, 13930, 
-        13484, 13043, 12605, 12170, 11739, 11312, 10887, 10466, 10049, 9636, 9225, 8819, 
-        8414, 8015, 7618, 7224, 6834, 6447, 6063, 5682, 5304, 4931, 4560, 4192, 
-        3827, 3465, 3107, 2751, 2399, 2050, 1702, 1359, 1018, 680, 345, 12, 
-        -315, -642, -966, -1286, -1605, -1921, -2234, -2545, -2853, -3157, -3459, -3759, 
-        -4057, -4352, -4644, -4933, -5222, -5506, -5788, -6069, -6347, -6621, -6894, -7166, 
-        -7434, -7700, -7964, -8226, -8484, -8741, -8997, -9249, -9500, -9749, -9995, -10239, 
-        -10482, -10722, -10961, -11196, -11431, -11663, -11893, -12121, -12348, -12572, -12794, -13015, 
-        -13234, -13451, -13665, -13879, -14091, -14300, -14508, -14714, -14917, -15120, -15322, -15520, 
-        -15717, -15914, -16107, -16299, -16491, -16680, -16867, -17053, -17237, -17421, -17602, -17781, 
-        -17959, -18137, -18311, -18486, -18657, -18829, -18997, -19165, -19332, -19497, -19660, -19822, 
-        -19984, -20143, -20301, -20458, -20614, -20768, -20920, -21073, -21222, -21371, -21518, -21666, 
-        -21810, -21955, -22098, -22239, -22379, -22518, -22656, -22793, -22929, -23062, -23196, -23329, 
-        -23459, -23589, -23718, -23846, -23973, -24099, -24222, -24346, -24468, -24591, -24711, -24830, 
-        -24948, -25065, -25182, -25297, -25411, -25525, -25638, -25749, -25858, -25970, -26077, -26185, 
-        -26292, -26398, -26503, -26607, -26711, -26812, -26914, -27015, -27114, -27214, -27312, -27409, 
-        -27506, -27601, -27694, -27790, -27882, -27975, -28066, -28158, -28247, -28337, -28424, -28513, 
-        -28600, -28686, -28772, -28856, -28940, -29024, -29107, -29189, -29270, -29351, -29430, -29510, 
-        -29587, -29665, -29743, -29819, -29895, -29972, -30046, -30119, -30192, -30265, -30338, -30409, 
-        -30479, -30551, -30621, -30689, -30757, -30825, -30893, -30960, -31027, -31092, -31157, -31222, 
-        -31285, -31349, -31412, -31474, -31536, -31598, -31658, -31719, -31777, -31838, -31896, -31955, 
-        -32012, -32069, -32126, -32182, -32239, -32293, -32349, -32403, -32456, -32510, -32563, -32617, 
-        -32669, -32720, -32761, -32767, -32710, -32593, -32418, -32198, -31933, -31633, -31301, -30941, 
-        -30557, -30154, -29732, -29294, -28845, -28383, -27913, -27436, -26953, -26465, -25971, -25476, 
-        -24979, -24481, -23981, -23481, -22983, -22485, -21988, -21493, -20998, -20508, -20017, -19532, 
-        -19048, -18567, -18088, -17613, -17140, -16672, -16206, -15744, -15285, -14830, -14378, -13930, 
-        -13484, -13043, -12605, -12170, -11739, -11312, -10887, -10466, -10049, -9636, -9225, -8819, 
-        -8414, -8015, -7618, -7224, -6834, -6447, -6063, -5682, -5304, -4931, -4560, -4192, 
-        -3827, -3465, -3107, -2751, -2399, -2050, -1702, -1359, -1018, -680, -345, -12 
-    };
-
-    // AKWF_rAsymSqu_05 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_05[600] PROGMEM = {
-        221, 612, 997, 1379, 1757, 2130, 2499, 2865, 3226, 3583, 3936, 4285, 
-        4631, 4973, 5310, 5644, 5974, 6302, 6624, 6944, 7260, 7572, 7881, 8186, 
-        8489, 8787, 9082, 9374, 9662, 9949, 10231, 10511, 10787, 11059, 11330, 11596, 
-        11861, 12122, 12381, 12635, 12889, 13138, 13385, 13630, 13870, 14109, 14346, 14579, 
-        14809, 15038, 15264, 15488, 15708, 15927, 16143, 16357, 16568, 16776, 16983, 17188, 
-        17389, 17588, 17787, 17982, 18175, 18366, 18554, 18741, 18926, 19108, 19289, 19467, 
-        19644, 19819, 19991, 20162, 20331, 20498, 20663, 20826, 20988, 21148, 21305, 21462, 
-        21617, 21769, 21919, 22070, 22217, 22363, 22507, 22650, 22790, 22931, 23068, 23206, 
-        23340, 23474, 23605, 23737, 23866, 23993, 24119, 24245, 24368, 24490, 24611, 24730, 
-        24849, 24964, 25080, 25195, 25308, 25419, 25529, 25639, 25746, 25853, 25959, 26063, 
-        26167, 26269, 26370, 26470, 26568, 26667, 26762, 26858, 26952, 27046, 27139, 27230, 
-        27319, 27409, 27497, 27584, 27671, 27757, 27841, 27924, 28007, 28088, 28169, 28249, 
-        28328, 28406, 28483, 28560, 28635, 28710, 28784, 28857, 28929, 29000, 29071, 29140, 
-        29210, 29278, 29346, 29412, 29478, 29543, 29608, 29671, 29735, 29797, 29860, 29920, 
-        29980, 30041, 30098, 30158, 30216, 30272, 30329, 30385, 30440, 30495, 30549, 30602, 
-        30654, 30706, 30758, 30809, 30860, 30910, 30960, 31007, 31057, 31104, 31151, 31199, 
-        31243, 31290, 31335, 31379, 31423, 31468, 31510, 31553, 31595, 31637, 31678, 31720, 
-        31760, 31799, 31838, 31877, 31916, 31954, 31992, 32029, 32067, 32103, 32139, 32176, 
-        32210, 32245, 32280, 32313, 32348, 32381, 32414, 32446, 32478, 32511, 32542, 32574, 
-        32604, 32634, 32665, 32695, 32724, 32753, 32767, 32727, 32594, 32371, 32073, 31709, 
-        31294, 30835, 30339, 29813, 29263, 28693, 28108, 27510, 26904, 26290, 25672, 25050, 
-        24428, 23804, 23183, 22562, 21944, 21329, 20716, 20110, 19506, 18907, 18315, 17726, 
-        17143, 16565, 15993, 15427, 14866, 14312, 13762, 13219, 12680, 12148, 11621, 11100, 
-        10584, 10075, 9570, 9072, 8578, 8091, 7607, 7131, 6659, 6192, 5730, 5274, 
-        4822, 4375, 3934, 3496, 3065, 2638, 2215, 1799, 1385, 977, 573, 173, 
-        -221, -612, -997, -1379, -1757, -2130, -2499, -2865, -3226, -3583, -3936, -4285, 
-        -4631, -4973, -5310, -5644, -5974, -6302, -6624, -6944, -7260, -7572, -7881, -8186, 
-        -8489, -8787, -9082, -9374, -9662, -9949, -10231, -10511, -10787, -11059, -11330, -11596, 
-        -11861, -12122, -12381, -12635, -12889, -13138, -13385, -13630, -13870, -14109, -14346, -14579, 
-        -14809, -15038, -15264, -15488, -15708, -15927, -16143, -16357, -16568, -16776, -16983, -17188, 
-        -17389, -17588, -17787, -17982, -18175, -18366, -18554, -18741, -18926, -19108, -19289, -19467, 
-        -19644, -19819, -19991, -20162, -20331, -20498, -20663, -20826, -20988, -21148, -21305, -21462, 
-        -21617, -21769, -21919, -22070, -22217, -22363, -22507, -22650, -22790, -22931, -23068, -23206, 
-        -23340, -23474, -23605, -23737, -23866, -23993, -24119, -24245, -24368, -24490, -24611, -24730, 
-        -24849, -24964, -25080, -25195, -25308, -25419, -25529, -25639, -25746, -25853, -25959, -26063, 
-        -26167, -26269, -26370, -26470, -26568, -26667, -26762, -26858, -26952, -27046, -27139, -27230, 
-        -27319, -27409, -27497, -27584, -27671, -27757, -27841, -27924, -28007, -28088, -28169, -28249, 
-        -28328, -28406, -28483, -28560, -28635, -28710, -28784, -28857, -28929, -29000, -29071, -29140, 
-        -29210, -29278, -29346, -29412, -29478, -29543, -29608, -29671, -29735, -29797, -29860, -29920, 
-        -29980, -30041, -30098, -30158, -30216, -30272, -30329, -30385, -30440, -30495, -30549, -30602, 
-        -30654, -30706, -30758, -30809, -30860, -30910, -30960, -31007, -31057, -31104, -31151, -31199, 
-        -31243, -31290, -31335, -31379, -31423, -31468, -31510, -31553, -31595, -31637, -31678, -31720, 
-        -31760, -31799, -31838, -31877, -31916, -31954, -31992, -32029, -32067, -32103, -32139, -32176, 
-        -32210, -32245, -32280, -32313, -32348, -32381, -32414, -32446, -32478, -32511, -32542, -32574, 
-        -32604, -32634, -32665, -32695, -32724, -32753, -32767, -32727, -32594, -32371, -32073, -31709, 
-        -31294, -30835, -30339, -29813, -29263, -28693, -28108, -27510, -26904, -26290, -25672, -25050, 
-        -24428, -23804, -23183, -22562, -21944, -21329, -20716, -20110, -19506, -18907, -18315, -17726, 
-        -17143, -16565, -15993, -15427, -14866, -14312, -13762, -13219, -12680, -12148, -11621, -11100, 
-        -10584, -10075, -9570, -9072, -8578, -8091, -7607, -7131, -6659, -6192, -5730, -5274, 
-        -4822, -4375, -3934, -3496, -3065, -2638, -2215, -1799, -1385, -977, -573, -173 
-    };
-
-    // AKWF_rAsymSqu_06 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_06[600] PROGMEM = {
-        219, 696, 1167, 1630, 2087, 2537, 2981, 3419, 3850, 4276, 4695, 5108, 
-        5516, 5916, 6313, 6703, 7089, 7467, 7840, 8209, 8573, 8931, 9283, 9632, 
-        9974, 10313, 10646, 10975, 11299, 11618, 11933, 12244, 12549, 12851, 13148, 13441, 
-        13730, 14014, 14295, 14573, 14845, 15115, 15379, 15640, 15898, 16153, 16403, 16649, 
-        16892, 17133, 17369, 17601, 17832, 18057, 18281, 18501, 18718, 18932, 19142, 19351, 
-        19556, 19757, 19956, 20153, 20346, 20537, 20725, 20910, 21092, 21272, 21450, 21625, 
-        21797, 21967, 22136, 22300, 22464, 22624, 22783, 22939, 23092, 23244, 23394, 23540, 
-        23687, 23829, 23970, 24110, 24247, 24382, 24515, 24647, 24776, 24904, 25030, 25155, 
-        25276, 25396, 25515, 25633, 25749, 25862, 25974, 26085, 26194, 26302, 26408, 26512, 
-        26616, 26716, 26817, 26915, 27014, 27109, 27203, 27297, 27388, 27479, 27568, 27656, 
-        27743, 27829, 27913, 27996, 28078, 28158, 28238, 28317, 28394, 28470, 28545, 28620, 
-        28693, 28765, 28835, 28906, 28975, 29043, 29109, 29175, 29240, 29305, 29369, 29431, 
-        29492, 29553, 29612, 29671, 29730, 29786, 29843, 29900, 29953, 30007, 30061, 30114, 
-        30165, 30216, 30267, 30317, 30365, 30414, 30461, 30508, 30555, 30600, 30645, 30689, 
-        30733, 30776, 30817, 30860, 30900, 30942, 30982, 31020, 31061, 31098, 31137, 31174, 
-        31210, 31246, 31282, 31318, 31352, 31385, 31420, 31453, 31486, 31518, 31550, 31582, 
-        31612, 31642, 31673, 31702, 31731, 31760, 31789, 31817, 31844, 31872, 31898, 31924, 
-        31951, 31977, 32002, 32027, 32052, 32075, 32100, 32123, 32146, 32169, 32191, 32213, 
-        32235, 32257, 32278, 32300, 32321, 32340, 32361, 32381, 32400, 32419, 32439, 32458, 
-        32476, 32494, 32512, 32530, 32548, 32564, 32581, 32597, 32614, 32631, 32647, 32662, 
-        32678, 32693, 32708, 32723, 32738, 32752, 32767, 32759, 32667, 32439, 32082, 31623, 
-        31081, 30476, 29821, 29127, 28404, 27660, 26900, 26130, 25355, 24576, 23796, 23019, 
-        22245, 21475, 20712, 19956, 19207, 18466, 17732, 17008, 16294, 15587, 14889, 14201, 
-        13522, 12852, 12191, 11539, 10896, 10262, 9637, 9021, 8414, 7814, 7224, 6641, 
-        6067, 5500, 4942, 4392, 3850, 3315, 2789, 2269, 1756, 1252, 754, 263, 
-        -219, -696, -1167, -1630, -2087, -2537, -2981, -3419, -3850, -4276, -4695, -5108, 
-        -5516, -5916, -6313, -6703, -7089, -7467, -7840, -8209, -8573, -8931, -9283, -9632, 
-        -9974, -10313, -10646, -10975, -11299, -11618, -11933, -12244, -12549, -12851, -13148, -13441, 
-        -13730, -14014, -14295, -14573, -14845, -15115, -15379, -15640, -15898, -16153, -16403, -16649, 
-        -16892, -17133, -17369, -17601, -17832, -18057, -18281, -18501, -18718, -18932, -19142, -19351, 
-        -19556, -19757, -19956, -20153, -20346, -20537, -20725, -20910, -21092, -21272, -21450, -21625, 
-        -21797, -21967, -22136, -22300, -22464, -22624, -22783, -22939, -23092, -23244, -23394, -23540, 
-        -23687, -23829, -23970, -24110, -24247, -24382, -24515, -24647, -24776, -24904, -25030, -25155, 
-        -25276, -25396, -25515, -25633, -25749, -25862, -25974, -26085, -26194, -26302, -26408, -26512, 
-        -26616, -26716, -26817, -26915, -27014, -27109, -27203, -27297, -27388, -27479, -27568, -27656, 
-        -27743, -27829, -27913, -27996, -28078, -28158, -28238, -28317, -28394, -28470, -28545, -28620, 
-        -28693, -28765, -28835, -28906, -28975, -29043, -29109, -29175, -29240, -29305, -29369, -29431, 
-        -29492, -29553, -29612, -29671, -29730, -29786, -29843, -29900, -29953, -30007, -30061, -30114, 
-        -30165, -30216, -30267, -30317, -30365, -30414, -30461, -30508, -30555, -30600, -30645, -30689, 
-        -30733, -30776, -30817, -30860, -30900, -30942, -30982, -31020, -31061, -31098, -31137, -31174, 
-        -31210, -31246, -31282, -31318, -31352, -31385, -31420, -31453, -31486, -31518, -31550, -31582, 
-        -31612, -31642, -31673, -31702, -31731, -31760, -31789, -31817, -31844, -31872, -31898, -31924, 
-        -31951, -31977, -32002, -32027, -32052, -32075, -32100, -32123, -32146, -32169, -32191, -32213, 
-        -32235, -32257, -32278, -32300, -32321, -32340, -32361, -32381, -32400, -32419, -32439, -32458, 
-        -32476, -32494, -32512, -32530, -32548, -32564, -32581, -32597, -32614, -32631, -32647, -32662, 
-        -32678, -32693, -32708, -32723, -32738, -32752, -32767, -32759, -32667, -32439, -32082, -31623, 
-        -31081, -30476, -29821, -29127, -28404, -27660, -26900, -26130, -25355, -24576, -23796, -23019, 
-        -22245, -21475, -20712, -19956, -19207, -18466, -17732, -17008, -16294, -15587, -14889, -14201, 
-        -13522, -12852, -12191, -11539, -10896, -10262, -9637, -9021, -8414, -7814, -7224, -6641, 
-        -6067, -5500, -4942, -4392, -3850, -3315, -2789, -2269, -1756, -1252, -754, -263 
-    };
-
-    // AKWF_rAsymSqu_07 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_07[600] PROGMEM = {
-        475, 1059, 1632, 2194, 2747, 3290, 3823, 4346, 4861, 5366, 5862, 6348, 
-        6827, 7297, 7757, 8211, 8656, 9093, 9523, 9944, 10359, 10765, 11163, 11556, 
-        11941, 12319, 12692, 13056, 13414, 13766, 14111, 14452, 14785, 15113, 15434, 15749, 
-        16060, 16365, 16664, 16957, 17245, 17530, 17807, 18081, 18349, 18614, 18872, 19126, 
-        19376, 19622, 19863, 20098, 20331, 20559, 20784, 21003, 21220, 21432, 21640, 21845, 
-        22047, 22245, 22438, 22628, 22816, 22999, 23179, 23357, 23532, 23702, 23870, 24036, 
-        24197, 24357, 24513, 24666, 24816, 24965, 25110, 25252, 25393, 25530, 25665, 25798, 
-        25928, 26057, 26183, 26306, 26427, 26546, 26664, 26779, 26892, 27003, 27111, 27218, 
-        27324, 27427, 27527, 27627, 27725, 27821, 27914, 28008, 28099, 28188, 28275, 28362, 
-        28446, 28530, 28611, 28691, 28769, 28847, 28922, 28997, 29070, 29142, 29212, 29282, 
-        29351, 29417, 29483, 29547, 29611, 29673, 29734, 29794, 29853, 29912, 29967, 30024, 
-        30078, 30132, 30185, 30237, 30288, 30338, 30387, 30436, 30483, 30529, 30575, 30620, 
-        30665, 30708, 30750, 30792, 30834, 30873, 30914, 30952, 30991, 31028, 31064, 31101, 
-        31136, 31172, 31207, 31239, 31273, 31306, 31337, 31368, 31399, 31430, 31459, 31489, 
-        31517, 31545, 31573, 31600, 31627, 31652, 31678, 31704, 31728, 31753, 31777, 31800, 
-        31823, 31846, 31868, 31890, 31911, 31933, 31953, 31974, 31994, 32013, 32032, 32051, 
-        32070, 32087, 32106, 32124, 32140, 32158, 32174, 32190, 32207, 32223, 32238, 32254, 
-        32269, 32282, 32297, 32311, 32326, 32339, 32353, 32365, 32379, 32391, 32404, 32417, 
-        32429, 32440, 32452, 32463, 32475, 32486, 32497, 32506, 32517, 32528, 32537, 32547, 
-        32558, 32567, 32576, 32585, 32594, 32602, 32612, 32620, 32628, 32636, 32644, 32652, 
-        32660, 32669, 32675, 32684, 32690, 32697, 32705, 32712, 32719, 32726, 32731, 32738, 
-        32744, 32750, 32757, 32762, 32767, 32740, 32586, 32235, 31703, 31035, 30268, 29426, 
-        28535, 27608, 26657, 25693, 24721, 23750, 22781, 21819, 20865, 19922, 18992, 18073, 
-        17168, 16276, 15400, 14537, 13689, 12854, 12034, 11230, 10438, 9661, 8897, 8146, 
-        7409, 6686, 5974, 5275, 4590, 3915, 3254, 2603, 1965, 1338, 722, 117, 
-        -475, -1059, -1632, -2194, -2747, -3290, -3823, -4346, -4861, -5366, -5862, -6348, 
-        -6827, -7297, -7757, -8211, -8656, -9093, -9523, -9944, -10359, -10765, -11163, -11556, 
-        -11941, -12319, -12692, -13056, -13414, -13766, -14111, -14452, -14785, -15113, -15434, -15749, 
-        -16060, -16365, -16664, -16957, -17245, -17530, -17807, -18081, -18349, -18614, -18872, -19126, 
-        -19376, -19622, -19863, -20098, -20331, -20559, -20784, -21003, -21220, -21432, -21640, -21845, 
-        -22047, -22245, -22438, -22628, -22816, -22999, -23179, -23357, -23532, -23702, -23870, -24036, 
-        -24197, -24357, -24513, -24666, -24816, -24965, -25110, -25252, -25393, -25530, -25665, -25798, 
-        -25928, -26057, -26183, -26306, -26427, -26546, -26664, -26779, -26892, -27003, -27111, -27218, 
-        -27324, -27427, -27527, -27627, -27725, -27821, -27914, -28008, -28099, -28188, -28275, -28362, 
-        -28446, -28530, -28611, -28691, -28769, -28847, -28922, -28997, -29070, -29142, -29212, -29282, 
-        -29351, -29417, -29483, -29547, -29611, -29673, -29734, -29794, -29853, -29912, -29967, -30024, 
-        -30078, -30132, -30185, -30237, -30288, -30338, -30387, -30436, -30483, -30529, -30575, -30620, 
-        -30665, -30708, -30750, -30792, -30834, -30873, -30914, -30952, -30991, -31028, -31064, -31101, 
-        -31136, -31172, -31207, -31239, -31273, -31306, -31337, -31368, -31399, -31430, -31459, -31489, 
-        -31517, -31545, -31573, -31600, -31627, -31652, -31678, -31704, -31728, -31753, -31777, -31800, 
-        -31823, -31846, -31868, -31890, -31911, -31933, -31953, -31974, -31994, -32013, -32032, -32051, 
-        -32070, -32087, -32106, -32124, -32140, -32158, -32174, -32190, -32207, -32223, -32238, -32254, 
-        -32269, -32282, -32297, -32311, -32326, -32339, -32353, -32365, -32379, -32391, -32404, -32417, 
-        -32429, -32440, -32452, -32463, -32475, -32486, -32497, -32506, -32517, -32528, -32537, -32547, 
-        -32558, -32567, -32576, -32585, -32594, -32602, -32612, -32620, -32628, -32636, -32644, -32652, 
-        -32660, -32669, -32675, -32684, -32690, -32697, -32705, -32712, -32719, -32726, -32731, -32738, 
-        -32744, -32750, -32757, -32762, -32767, -32740, -32586, -32235, -31703, -31035, -30268, -29426, 
-        -28535, -27608, -26657, -25693, -24721, -23750, -22781, -21819, -20865, -19922, -18992, -18073, 
-        -17168, -16276, -15400, -14537, -13689, -12854, -12034, -11230, -10438, -9661, -8897, -8146, 
-        -7409, -6686, -5974, -5275, -4590, -3915, -3254, -2603, -1965, -1338, -722, -117 
-    };
-
-    // AKWF_rAsymSqu_08 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_08[600] PROGMEM = {
-        703, 1417, 2117, 2800, 3467, 4121, 4759, 5383, 5994, 6591, 7175, 7745, 
-        8303, 8848, 9382, 9904, 10414, 10913, 11400, 11877, 12343, 12799, 13244, 13680, 
-        14106, 14523, 14931, 15329, 15718, 16098, 16471, 16835, 17191, 17539, 17879, 18213, 
-        18537, 18856, 19167, 19471, 19768, 20060, 20344, 20622, 20894, 21159, 21418, 21673, 
-        21922, 22165, 22402, 22634, 22862, 23084, 23300, 23513, 23720, 23923, 24122, 24316, 
-        24506, 24691, 24873, 25050, 25224, 25393, 25559, 25720, 25879, 26034, 26186, 26334, 
-        26479, 26620, 26759, 26895, 27026, 27157, 27283, 27407, 27528, 27646, 27762, 27875, 
-        27985, 28093, 28199, 28303, 28404, 28503, 28600, 28694, 28786, 28877, 28965, 29052, 
-        29136, 29219, 29300, 29379, 29456, 29531, 29605, 29678, 29748, 29816, 29885, 29951, 
-        30015, 30077, 30139, 30200, 30259, 30317, 30373, 30428, 30482, 30535, 30586, 30637, 
-        30685, 30734, 30781, 30826, 30872, 30917, 30960, 31001, 31042, 31082, 31122, 31160, 
-        31198, 31235, 31270, 31305, 31340, 31374, 31406, 31438, 31471, 31502, 31531, 31561, 
-        31589, 31617, 31644, 31671, 31698, 31724, 31749, 31773, 31798, 31821, 31843, 31866, 
-        31888, 31909, 31931, 31951, 31971, 31990, 32010, 32029, 32046, 32065, 32083, 32099, 
-        32116, 32133, 32149, 32164, 32180, 32194, 32209, 32223, 32238, 32251, 32264, 32278, 
-        32290, 32303, 32316, 32328, 32338, 32351, 32361, 32372, 32383, 32394, 32403, 32414, 
-        32423, 32433, 32442, 32451, 32461, 32469, 32477, 32486, 32494, 32503, 32509, 32517, 
-        32525, 32532, 32539, 32547, 32554, 32560, 32566, 32572, 32579, 32585, 32591, 32597, 
-        32602, 32607, 32614, 32618, 32624, 32629, 32634, 32638, 32644, 32648, 32653, 32657, 
-        32661, 32667, 32671, 32675, 32679, 32681, 32685, 32689, 32694, 32696, 32700, 32704, 
-        32707, 32710, 32714, 32716, 32719, 32723, 32726, 32728, 32731, 32734, 32737, 32739, 
-        32742, 32745, 32746, 32749, 32751, 32753, 32755, 32758, 32759, 32762, 32763, 32766, 
-        32767, 32719, 32485, 31968, 31206, 30272, 29224, 28103, 26935, 25740, 24536, 23331, 
-        22134, 20949, 19780, 18630, 17500, 16392, 15305, 14239, 13197, 12176, 11178, 10201, 
-        9245, 8310, 7395, 6502, 5628, 4772, 3937, 3119, 2320, 1538, 773, 26, 
-        -703, -1417, -2117, -2800, -3467, -4121, -4759, -5383, -5994, -6591, -7175, -7745, 
-        -8303, -8848, -9382, -9904, -10414, -10913, -11400, -11877, -12343, -12799, -13244, -13680, 
-        -14106, -14523, -14931, -15329, -15718, -16098, -16471, -16835, -17191, -17539, -17879, -18213, 
-        -18537, -18856, -19167, -19471, -19768, -20060, -20344, -20622, -20894, -21159, -21418, -21673, 
-        -21922, -22165, -22402, -22634, -22862, -23084, -23300, -23513, -23720, -23923, -24122, -24316, 
-        -24506, -24691, -24873, -25050, -25224, -25393, -25559, -25720, -25879, -26034, -26186, -26334, 
-        -26479, -26620, -26759, -26895, -27026, -27157, -27283, -27407, -27528, -27646, -27762, -27875, 
-        -27985, -28093, -28199, -28303, -28404, -28503, -28600, -28694, -28786, -28877, -28965, -29052, 
-        -29136, -29219, -29300, -29379, -29456, -29531, -29605, -29678, -29748, -29816, -29885, -29951, 
-        -30015, -30077, -30139, -30200, -30259, -30317, -30373, -30428, -30482, -30535, -30586, -30637, 
-        -30685, -30734, -30781, -30826, -30872, -30917, -30960, -31001, -31042, -31082, -31122, -31160, 
-        -31198, -31235, -31270, -31305, -31340, -31374, -31406, -31438, -31471, -31502, -31531, -31561, 
-        -31589, -31617, -31644, -31671, -31698, -31724, -31749, -31773, -31798, -31821, -31843, -31866, 
-        -31888, -31909, -31931, -31951, -31971, -31990, -32010, -32029, -32046, -32065, -32083, -32099, 
-        -32116, -32133, -32149, -32164, -32180, -32194, -32209, -32223, -32238, -32251, -32264, -32278, 
-        -32290, -32303, -32316, -32328, -32338, -32351, -32361, -32372, -32383, -32394, -32403, -32414, 
-        -32423, -32433, -32442, -32451, -32461, -32469, -32477, -32486, -32494, -32503, -32509, -32517, 
-        -32525, -32532, -32539, -32547, -32554, -32560, -32566, -32572, -32579, -32585, -32591, -32597, 
-        -32602, -32607, -32614, -32618, -32624, -32629, -32634, -32638, -32644, -32648, -32653, -32657, 
-        -32661, -32667, -32671, -32675, -32679, -32681, -32685, -32689, -32694, -32696, -32700, -32704, 
-        -32707, -32710, -32714, -32716, -32719, -32723, -32726, -32728, -32731, -32734, -32737, -32739, 
-        -32742, -32745, -32746, -32749, -32751, -32753, -32755, -32758, -32759, -32762, -32763, -32766, 
-        -32767, -32719, -32485, -31968, -31206, -30272, -29224, -28103, -26935, -25740, -24536, -23331, 
-        -22134, -20949, -19780, -18630, -17500, -16392, -15305, -14239, -13197, -12176, -11178, -10201, 
-        -9245, -8310, -7395, -6502, -5628, -4772, -3937, -3119, -2320, -1538, -773, -26 
-    };
-
-    // AKWF_rAsymSqu_09 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_09[600] PROGMEM = {
-        343, 1230, 2092, 2933, 3749, 4544, 5315, 6067, 6797, 7508, 8199, 8871, 
-        9527, 10161, 10780, 11383, 11968, 12538, 13091, 13630, 14154, 14663, 15159, 15641, 
-        16110, 16566, 17009, 17441, 17860, 18268, 18666, 19052, 19428, 19793, 20148, 20494, 
-        20830, 21157, 21475, 21784, 22085, 22377, 22662, 22940, 23208, 23470, 23725, 23973, 
-        24214, 24449, 24677, 24898, 25114, 25324, 25528, 25727, 25920, 26108, 26290, 26468, 
-        26641, 26809, 26972, 27131, 27285, 27435, 27582, 27724, 27862, 27998, 28128, 28256, 
-        28379, 28500, 28618, 28731, 28842, 28950, 29054, 29156, 29256, 29352, 29446, 29538, 
-        29626, 29714, 29797, 29879, 29958, 30036, 30111, 30185, 30256, 30324, 30391, 30457, 
-        30520, 30583, 30642, 30702, 30759, 30814, 30868, 30920, 30971, 31021, 31069, 31116, 
-        31162, 31206, 31249, 31291, 31332, 31373, 31410, 31448, 31486, 31520, 31555, 31589, 
-        31621, 31653, 31684, 31714, 31743, 31773, 31800, 31826, 31853, 31879, 31903, 31927, 
-        31951, 31974, 31996, 32017, 32039, 32059, 32079, 32098, 32116, 32135, 32153, 32170, 
-        32188, 32204, 32220, 32235, 32249, 32264, 32279, 32292, 32306, 32319, 32333, 32345, 
-        32357, 32369, 32380, 32390, 32401, 32412, 32423, 32432, 32441, 32451, 32460, 32469, 
-        32478, 32487, 32495, 32503, 32510, 32518, 32525, 32533, 32539, 32546, 32553, 32558, 
-        32565, 32572, 32577, 32582, 32588, 32593, 32598, 32604, 32609, 32613, 32618, 32623, 
-        32628, 32632, 32636, 32640, 32644, 32648, 32652, 32655, 32659, 32663, 32665, 32670, 
-        32672, 32675, 32678, 32682, 32684, 32687, 32690, 32692, 32695, 32698, 32699, 32702, 
-        32704, 32706, 32708, 32711, 32712, 32715, 32716, 32718, 32721, 32722, 32723, 32726, 
-        32727, 32729, 32730, 32731, 32733, 32735, 32737, 32738, 32739, 32741, 32741, 32742, 
-        32743, 32745, 32746, 32747, 32747, 32749, 32750, 32751, 32751, 32753, 32754, 32754, 
-        32755, 32757, 32757, 32758, 32758, 32759, 32759, 32761, 32761, 32762, 32762, 32763, 
-        32763, 32765, 32765, 32766, 32766, 32766, 32767, 32767, 32694, 32351, 31614, 30554, 
-        29291, 27908, 26460, 24980, 23496, 22019, 20562, 19133, 17731, 16363, 15028, 13726, 
-        12457, 11222, 10021, 8851, 7713, 6605, 5529, 4480, 3462, 2471, 1507, 569, 
-        -343, -1230, -2092, -2933, -3749, -4544, -5315, -6067, -6797, -7508, -8199, -8871, 
-        -9527, -10161, -10780, -11383, -11968, -12538, -13091, -13630, -14154, -14663, -15159, -15641, 
-        -16110, -16566, -17009, -17441, -17860, -18268, -18666, -19052, -19428, -19793, -20148, -20494, 
-        -20830, -21157, -21475, -21784, -22085, -22377, -22662, -22940, -23208, -23470, -23725, -23973, 
-        -24214, -24449, -24677, -24898, -25114, -25324, -25528, -25727, -25920, -26108, -26290, -26468, 
-        -26641, -26809, -26972, -27131, -27285, -27435, -27582, -27724, -27862, -27998, -28128, -28256, 
-        -28379, -28500, -28618, -28731, -28842, -28950, -29054, -29156, -29256, -29352, -29446, -29538, 
-        -29626, -29714, -29797, -29879, -29958, -30036, -30111, -30185, -30256, -30324, -30391, -30457, 
-        -30520, -30583, -30642, -30702, -30759, -30814, -30868, -30920, -30971, -31021, -31069, -31116, 
-        -31162, -31206, -31249, -31291, -31332, -31373, -31410, -31448, -31486, -31520, -31555, -31589, 
-        -31621, -31653, -31684, -31714, -31743, -31773, -31800, -31826, -31853, -31879, -31903, -31927, 
-        -31951, -31974, -31996, -32017, -32039, -32059, -32079, -32098, -32116, -32135, -32153, -32170, 
-        -32188, -32204, -32220, -32235, -32249, -32264, -32279, -32292, -32306, -32319, -32333, -32345, 
-        -32357, -32369, -32380, -32390, -32401, -32412, -32423, -32432, -32441, -32451, -32460, -32469, 
-        -32478, -32487, -32495, -32503, -32510, -32518, -32525, -32533, -32539, -32546, -32553, -32558, 
-        -32565, -32572, -32577, -32582, -32588, -32593, -32598, -32604, -32609, -32613, -32618, -32623, 
-        -32628, -32632, -32636, -32640, -32644, -32648, -32652, -32655, -32659, -32663, -32665, -32670, 
-        -32672, -32675, -32678, -32682, -32684, -32687, -32690, -32692, -32695, -32698, -32699, -32702, 
-        -32704, -32706, -32708, -32711, -32712, -32715, -32716, -32718, -32721, -32722, -32723, -32726, 
-        -32727, -32729, -32730, -32731, -32733, -32735, -32737, -32738, -32739, -32741, -32741, -32742, 
-        -32743, -32745, -32746, -32747, -32747, -32749, -32750, -32751, -32751, -32753, -32754, -32754, 
-        -32755, -32757, -32757, -32758, -32758, -32759, -32759, -32761, -32761, -32762, -32762, -32763, 
-        -32763, -32765, -32765, -32766, -32766, -32766, -32767, -32767, -32694, -32351, -31614, -30554, 
-        -29291, -27908, -26460, -24980, -23496, -22019, -20562, -19133, -17731, -16363, -15028, -13726, 
-        -12457, -11222, -10021, -8851, -7713, -6605, -5529, -4480, -3462, -2471, -1507, -569 
-    };
-
-    // AKWF_rAsymSqu_10 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_10[600] PROGMEM = {
-        491, 1569, 2611, 3618, 4592, 5533, 6443, 7323, 8172, 8994, 9788, 10555, 
-        11297, 12015, 12709, 13379, 14027, 14652, 15257, 15842, 16408, 16954, 17483, 17993, 
-        18487, 18964, 19425, 19872, 20302, 20718, 21121, 21510, 21886, 22249, 22601, 22940, 
-        23269, 23587, 23893, 24189, 24477, 24753, 25021, 25280, 25530, 25773, 26006, 26232, 
-        26450, 26661, 26865, 27062, 27253, 27438, 27616, 27788, 27954, 28115, 28271, 28421, 
-        28566, 28707, 28843, 28974, 29100, 29222, 29342, 29456, 29567, 29673, 29777, 29877, 
-        29974, 30068, 30158, 30245, 30329, 30411, 30489, 30566, 30639, 30711, 30779, 30846, 
-        30910, 30972, 31033, 31090, 31147, 31200, 31254, 31304, 31353, 31400, 31446, 31490, 
-        31533, 31575, 31615, 31652, 31690, 31726, 31761, 31795, 31828, 31859, 31890, 31919, 
-        31948, 31975, 32001, 32027, 32052, 32076, 32099, 32122, 32144, 32164, 32185, 32204, 
-        32223, 32242, 32259, 32276, 32293, 32309, 32325, 32339, 32353, 32368, 32381, 32394, 
-        32407, 32419, 32431, 32441, 32452, 32463, 32474, 32483, 32494, 32502, 32511, 32521, 
-        32529, 32537, 32545, 32551, 32560, 32566, 32573, 32580, 32586, 32592, 32598, 32604, 
-        32609, 32615, 32620, 32625, 32631, 32635, 32639, 32644, 32648, 32652, 32656, 32660, 
-        32663, 32667, 32671, 32674, 32678, 32680, 32683, 32686, 32690, 32692, 32695, 32696, 
-        32699, 32702, 32704, 32706, 32708, 32711, 32712, 32715, 32717, 32718, 32721, 32722, 
-        32723, 32725, 32726, 32727, 32730, 32731, 32733, 32734, 32734, 32735, 32737, 32738, 
-        32739, 32741, 32741, 32742, 32743, 32745, 32745, 32746, 32746, 32747, 32749, 32749, 
-        32750, 32750, 32751, 32751, 32753, 32753, 32754, 32754, 32754, 32755, 32755, 32757, 
-        32757, 32757, 32758, 32758, 32758, 32759, 32759, 32759, 32759, 32761, 32761, 32761, 
-        32761, 32762, 32762, 32762, 32762, 32763, 32763, 32763, 32763, 32763, 32763, 32765, 
-        32765, 32765, 32765, 32765, 32765, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32662, 32174, 31148, 29711, 28051, 26280, 24466, 22652, 20859, 19104, 17393, 
-        15732, 14119, 12559, 11048, 9585, 8172, 6805, 5483, 4206, 2972, 1777, 623, 
-        -491, -1569, -2611, -3618, -4592, -5533, -6443, -7323, -8172, -8994, -9788, -10555, 
-        -11297, -12015, -12709, -13379, -14027, -14652, -15257, -15842, -16408, -16954, -17483, -17993, 
-        -18487, -18964, -19425, -19872, -20302, -20718, -21121, -21510, -21886, -22249, -22601, -22940, 
-        -23269, -23587, -23893, -24189, -24477, -24753, -25021, -25280, -25530, -25773, -26006, -26232, 
-        -26450, -26661, -26865, -27062, -27253, -27438, -27616, -27788, -27954, -28115, -28271, -28421, 
-        -28566, -28707, -28843, -28974, -29100, -29222, -29342, -29456, -29567, -29673, -29777, -29877, 
-        -29974, -30068, -30158, -30245, -30329, -30411, -30489, -30566, -30639, -30711, -30779, -30846, 
-        -30910, -30972, -31033, -31090, -31147, -31200, -31254, -31304, -31353, -31400, -31446, -31490, 
-        -31533, -31575, -31615, -31652, -31690, -31726, -31761, -31795, -31828, -31859, -31890, -31919, 
-        -31948, -31975, -32001, -32027, -32052, -32076, -32099, -32122, -32144, -32164, -32185, -32204, 
-        -32223, -32242, -32259, -32276, -32293, -32309, -32325, -32339, -32353, -32368, -32381, -32394, 
-        -32407, -32419, -32431, -32441, -32452, -32463, -32474, -32483, -32494, -32502, -32511, -32521, 
-        -32529, -32537, -32545, -32551, -32560, -32566, -32573, -32580, -32586, -32592, -32598, -32604, 
-        -32609, -32615, -32620, -32625, -32631, -32635, -32639, -32644, -32648, -32652, -32656, -32660, 
-        -32663, -32667, -32671, -32674, -32678, -32680, -32683, -32686, -32690, -32692, -32695, -32696, 
-        -32699, -32702, -32704, -32706, -32708, -32711, -32712, -32715, -32717, -32718, -32721, -32722, 
-        -32723, -32725, -32726, -32727, -32730, -32731, -32733, -32734, -32734, -32735, -32737, -32738, 
-        -32739, -32741, -32741, -32742, -32743, -32745, -32745, -32746, -32746, -32747, -32749, -32749, 
-        -32750, -32750, -32751, -32751, -32753, -32753, -32754, -32754, -32754, -32755, -32755, -32757, 
-        -32757, -32757, -32758, -32758, -32758, -32759, -32759, -32759, -32759, -32761, -32761, -32761, 
-        -32761, -32762, -32762, -32762, -32762, -32763, -32763, -32763, -32763, -32763, -32763, -32765, 
-        -32765, -32765, -32765, -32765, -32765, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32662, -32174, -31148, -29711, -28051, -26280, -24466, -22652, -20859, -19104, -17393, 
-        -15732, -14119, -12559, -11048, -9585, -8172, -6805, -5483, -4206, -2972, -1777, -623 
-    };
-
-    // AKWF_rAsymSqu_11 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_11[600] PROGMEM = {
-        648, 1950, 3199, 4399, 5549, 6652, 7712, 8727, 9701, 10636, 11534, 12395, 
-        13222, 14013, 14774, 15504, 16203, 16875, 17519, 18138, 18731, 19300, 19846, 20370, 
-        20872, 21355, 21818, 22262, 22687, 23097, 23488, 23865, 24226, 24572, 24904, 25223, 
-        25529, 25823, 26105, 26374, 26633, 26883, 27120, 27350, 27570, 27780, 27983, 28176, 
-        28363, 28541, 28713, 28877, 29035, 29187, 29331, 29471, 29605, 29733, 29856, 29974, 
-        30087, 30195, 30300, 30401, 30496, 30589, 30677, 30762, 30844, 30921, 30996, 31068, 
-        31136, 31203, 31266, 31327, 31386, 31442, 31496, 31547, 31596, 31645, 31690, 31733, 
-        31775, 31815, 31854, 31891, 31926, 31961, 31993, 32026, 32055, 32085, 32111, 32138, 
-        32164, 32188, 32212, 32235, 32256, 32276, 32297, 32315, 32334, 32352, 32369, 32385, 
-        32400, 32416, 32429, 32443, 32456, 32470, 32482, 32492, 32505, 32515, 32525, 32535, 
-        32545, 32553, 32562, 32570, 32578, 32586, 32593, 32601, 32608, 32615, 32620, 32627, 
-        32632, 32637, 32643, 32648, 32652, 32657, 32662, 32666, 32671, 32675, 32678, 32682, 
-        32686, 32688, 32692, 32695, 32698, 32700, 32703, 32706, 32708, 32711, 32714, 32715, 
-        32718, 32719, 32722, 32723, 32726, 32727, 32729, 32730, 32731, 32734, 32735, 32737, 
-        32738, 32738, 32739, 32741, 32742, 32743, 32745, 32745, 32746, 32747, 32747, 32749, 
-        32750, 32750, 32751, 32751, 32753, 32753, 32754, 32754, 32754, 32755, 32755, 32757, 
-        32757, 32757, 32758, 32758, 32758, 32759, 32759, 32759, 32759, 32761, 32761, 32761, 
-        32761, 32761, 32762, 32762, 32762, 32762, 32762, 32763, 32763, 32763, 32763, 32763, 
-        32763, 32763, 32765, 32765, 32765, 32765, 32765, 32765, 32765, 32765, 32765, 32765, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32617, 31936, 30538, 28638, 26513, 24307, 22101, 
-        19936, 17831, 15797, 13836, 11953, 10141, 8404, 6735, 5134, 3598, 2123, 708, 
-        -648, -1950, -3199, -4399, -5549, -6652, -7712, -8727, -9701, -10636, -11534, -12395, 
-        -13222, -14013, -14774, -15504, -16203, -16875, -17519, -18138, -18731, -19300, -19846, -20370, 
-        -20872, -21355, -21818, -22262, -22687, -23097, -23488, -23865, -24226, -24572, -24904, -25223, 
-        -25529, -25823, -26105, -26374, -26633, -26883, -27120, -27350, -27570, -27780, -27983, -28176, 
-        -28363, -28541, -28713, -28877, -29035, -29187, -29331, -29471, -29605, -29733, -29856, -29974, 
-        -30087, -30195, -30300, -30401, -30496, -30589, -30677, -30762, -30844, -30921, -30996, -31068, 
-        -31136, -31203, -31266, -31327, -31386, -31442, -31496, -31547, -31596, -31645, -31690, -31733, 
-        -31775, -31815, -31854, -31891, -31926, -31961, -31993, -32026, -32055, -32085, -32111, -32138, 
-        -32164, -32188, -32212, -32235, -32256, -32276, -32297, -32315, -32334, -32352, -32369, -32385, 
-        -32400, -32416, -32429, -32443, -32456, -32470, -32482, -32492, -32505, -32515, -32525, -32535, 
-        -32545, -32553, -32562, -32570, -32578, -32586, -32593, -32601, -32608, -32615, -32620, -32627, 
-        -32632, -32637, -32643, -32648, -32652, -32657, -32662, -32666, -32671, -32675, -32678, -32682, 
-        -32686, -32688, -32692, -32695, -32698, -32700, -32703, -32706, -32708, -32711, -32714, -32715, 
-        -32718, -32719, -32722, -32723, -32726, -32727, -32729, -32730, -32731, -32734, -32735, -32737, 
-        -32738, -32738, -32739, -32741, -32742, -32743, -32745, -32745, -32746, -32747, -32747, -32749, 
-        -32750, -32750, -32751, -32751, -32753, -32753, -32754, -32754, -32754, -32755, -32755, -32757, 
-        -32757, -32757, -32758, -32758, -32758, -32759, -32759, -32759, -32759, -32761, -32761, -32761, 
-        -32761, -32761, -32762, -32762, -32762, -32762, -32762, -32763, -32763, -32763, -32763, -32763, 
-        -32763, -32763, -32765, -32765, -32765, -32765, -32765, -32765, -32765, -32765, -32765, -32765, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32617, -31936, -30538, -28638, -26513, -24307, -22101, 
-        -19936, -17831, -15797, -13836, -11953, -10141, -8404, -6735, -5134, -3598, -2123, -708 
-    };
-
-    // AKWF_rAsymSqu_12 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_12[600] PROGMEM = {
-        1183, 2730, 4200, 5600, 6931, 8196, 9399, 10544, 11632, 12666, 13651, 14588, 
-        15477, 16325, 17130, 17896, 18623, 19317, 19976, 20602, 21198, 21764, 22304, 22816, 
-        23303, 23766, 24208, 24626, 25026, 25404, 25765, 26109, 26435, 26745, 27040, 27320, 
-        27587, 27841, 28082, 28312, 28529, 28737, 28934, 29122, 29301, 29471, 29632, 29786, 
-        29931, 30071, 30202, 30328, 30448, 30562, 30669, 30772, 30870, 30963, 31051, 31136, 
-        31215, 31292, 31364, 31433, 31498, 31560, 31619, 31675, 31729, 31780, 31828, 31874, 
-        31918, 31960, 31999, 32038, 32073, 32107, 32140, 32170, 32200, 32227, 32254, 32279, 
-        32303, 32326, 32348, 32368, 32388, 32407, 32424, 32440, 32456, 32472, 32487, 32501, 
-        32514, 32526, 32538, 32549, 32560, 32570, 32580, 32589, 32597, 32607, 32615, 32621, 
-        32629, 32636, 32641, 32648, 32653, 32660, 32666, 32670, 32675, 32679, 32684, 32688, 
-        32692, 32695, 32699, 32703, 32706, 32708, 32711, 32714, 32717, 32719, 32722, 32725, 
-        32726, 32729, 32730, 32733, 32734, 32735, 32737, 32739, 32741, 32742, 32743, 32745, 
-        32745, 32746, 32747, 32749, 32750, 32750, 32751, 32751, 32753, 32754, 32754, 32755, 
-        32755, 32757, 32757, 32757, 32758, 32758, 32759, 32759, 32759, 32761, 32761, 32761, 
-        32761, 32762, 32762, 32762, 32762, 32762, 32763, 32763, 32763, 32763, 32763, 32765, 
-        32765, 32765, 32765, 32765, 32765, 32765, 32765, 32765, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32557, 31622, 29753, 27299, 
-        24645, 21970, 19353, 16831, 14416, 12112, 9917, 7830, 5841, 3951, 2153, 442, 
-        -1183, -2730, -4200, -5600, -6931, -8196, -9399, -10544, -11632, -12666, -13651, -14588, 
-        -15477, -16325, -17130, -17896, -18623, -19317, -19976, -20602, -21198, -21764, -22304, -22816, 
-        -23303, -23766, -24208, -24626, -25026, -25404, -25765, -26109, -26435, -26745, -27040, -27320, 
-        -27587, -27841, -28082, -28312, -28529, -28737, -28934, -29122, -29301, -29471, -29632, -29786, 
-        -29931, -30071, -30202, -30328, -30448, -30562, -30669, -30772, -30870, -30963, -31051, -31136, 
-        -31215, -31292, -31364, -31433, -31498, -31560, -31619, -31675, -31729, -31780, -31828, -31874, 
-        -31918, -31960, -31999, -32038, -32073, -32107, -32140, -32170, -32200, -32227, -32254, -32279, 
-        -32303, -32326, -32348, -32368, -32388, -32407, -32424, -32440, -32456, -32472, -32487, -32501, 
-        -32514, -32526, -32538, -32549, -32560, -32570, -32580, -32589, -32597, -32607, -32615, -32621, 
-        -32629, -32636, -32641, -32648, -32653, -32660, -32666, -32670, -32675, -32679, -32684, -32688, 
-        -32692, -32695, -32699, -32703, -32706, -32708, -32711, -32714, -32717, -32719, -32722, -32725, 
-        -32726, -32729, -32730, -32733, -32734, -32735, -32737, -32739, -32741, -32742, -32743, -32745, 
-        -32745, -32746, -32747, -32749, -32750, -32750, -32751, -32751, -32753, -32754, -32754, -32755, 
-        -32755, -32757, -32757, -32757, -32758, -32758, -32759, -32759, -32759, -32761, -32761, -32761, 
-        -32761, -32762, -32762, -32762, -32762, -32762, -32763, -32763, -32763, -32763, -32763, -32765, 
-        -32765, -32765, -32765, -32765, -32765, -32765, -32765, -32765, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32557, -31622, -29753, -27299, 
-        -24645, -21970, -19353, -16831, -14416, -12112, -9917, -7830, -5841, -3951, -2153, -442 
-    };
-
-    // AKWF_rAsymSqu_13 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_13[600] PROGMEM = {
-        728, 2616, 4392, 6064, 7638, 9118, 10512, 11822, 13057, 14219, 15311, 16340, 
-        17307, 18218, 19076, 19882, 20641, 21356, 22029, 22661, 23256, 23817, 24344, 24841, 
-        25308, 25746, 26161, 26550, 26916, 27261, 27586, 27890, 28178, 28449, 28704, 28942, 
-        29168, 29380, 29580, 29767, 29945, 30111, 30268, 30414, 30554, 30684, 30806, 30923, 
-        31031, 31133, 31230, 31320, 31406, 31486, 31561, 31632, 31700, 31763, 31822, 31877, 
-        31930, 31979, 32026, 32070, 32110, 32149, 32185, 32220, 32252, 32283, 32311, 32338, 
-        32364, 32388, 32409, 32431, 32451, 32470, 32487, 32503, 32519, 32534, 32547, 32561, 
-        32573, 32584, 32596, 32605, 32615, 32624, 32632, 32640, 32648, 32655, 32662, 32668, 
-        32674, 32679, 32684, 32690, 32694, 32699, 32703, 32707, 32710, 32714, 32717, 32719, 
-        32723, 32726, 32727, 32730, 32733, 32734, 32737, 32738, 32741, 32742, 32743, 32745, 
-        32746, 32747, 32749, 32750, 32751, 32751, 32753, 32754, 32754, 32755, 32755, 32757, 
-        32758, 32758, 32758, 32759, 32759, 32761, 32761, 32761, 32762, 32762, 32762, 32762, 
-        32763, 32763, 32763, 32763, 32763, 32765, 32765, 32765, 32765, 32765, 32765, 32765, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32476, 
-        31214, 28759, 25655, 22420, 19250, 16218, 13345, 10634, 8078, 5672, 3407, 1277, 
-        -728, -2616, -4392, -6064, -7638, -9118, -10512, -11822, -13057, -14219, -15311, -16340, 
-        -17307, -18218, -19076, -19882, -20641, -21356, -22029, -22661, -23256, -23817, -24344, -24841, 
-        -25308, -25746, -26161, -26550, -26916, -27261, -27586, -27890, -28178, -28449, -28704, -28942, 
-        -29168, -29380, -29580, -29767, -29945, -30111, -30268, -30414, -30554, -30684, -30806, -30923, 
-        -31031, -31133, -31230, -31320, -31406, -31486, -31561, -31632, -31700, -31763, -31822, -31877, 
-        -31930, -31979, -32026, -32070, -32110, -32149, -32185, -32220, -32252, -32283, -32311, -32338, 
-        -32364, -32388, -32409, -32431, -32451, -32470, -32487, -32503, -32519, -32534, -32547, -32561, 
-        -32573, -32584, -32596, -32605, -32615, -32624, -32632, -32640, -32648, -32655, -32662, -32668, 
-        -32674, -32679, -32684, -32690, -32694, -32699, -32703, -32707, -32710, -32714, -32717, -32719, 
-        -32723, -32726, -32727, -32730, -32733, -32734, -32737, -32738, -32741, -32742, -32743, -32745, 
-        -32746, -32747, -32749, -32750, -32751, -32751, -32753, -32754, -32754, -32755, -32755, -32757, 
-        -32758, -32758, -32758, -32759, -32759, -32761, -32761, -32761, -32762, -32762, -32762, -32762, 
-        -32763, -32763, -32763, -32763, -32763, -32765, -32765, -32765, -32765, -32765, -32765, -32765, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32476, 
-        -31214, -28759, -25655, -22420, -19250, -16218, -13345, -10634, -8078, -5672, -3407, -1277 
-    };
-
-    // AKWF_rAsymSqu_14 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_14[600] PROGMEM = {
-        1237, 3464, 5534, 7457, 9245, 10906, 12450, 13886, 15220, 16459, 17612, 18682, 
-        19677, 20601, 21461, 22259, 23001, 23692, 24332, 24929, 25482, 25997, 26475, 26920, 
-        27332, 27717, 28074, 28406, 28713, 29000, 29266, 29514, 29743, 29957, 30155, 30340, 
-        30512, 30670, 30819, 30956, 31085, 31203, 31314, 31416, 31512, 31602, 31683, 31760, 
-        31831, 31898, 31958, 32016, 32070, 32118, 32165, 32207, 32247, 32283, 32318, 32350, 
-        32380, 32407, 32432, 32456, 32478, 32498, 32518, 32535, 32551, 32568, 32581, 32594, 
-        32607, 32619, 32628, 32639, 32648, 32656, 32664, 32671, 32678, 32684, 32691, 32696, 
-        32700, 32706, 32710, 32714, 32718, 32722, 32725, 32729, 32731, 32734, 32735, 32738, 
-        32741, 32742, 32745, 32746, 32747, 32749, 32750, 32751, 32753, 32754, 32754, 32755, 
-        32757, 32757, 32758, 32759, 32759, 32759, 32761, 32761, 32762, 32762, 32762, 32763, 
-        32763, 32763, 32763, 32765, 32765, 32765, 32765, 32765, 32765, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32372, 30689, 27522, 23678, 19820, 16147, 12704, 9496, 6512, 3737, 1159, 
-        -1237, -3464, -5534, -7457, -9245, -10906, -12450, -13886, -15220, -16459, -17612, -18682, 
-        -19677, -20601, -21461, -22259, -23001, -23692, -24332, -24929, -25482, -25997, -26475, -26920, 
-        -27332, -27717, -28074, -28406, -28713, -29000, -29266, -29514, -29743, -29957, -30155, -30340, 
-        -30512, -30670, -30819, -30956, -31085, -31203, -31314, -31416, -31512, -31602, -31683, -31760, 
-        -31831, -31898, -31958, -32016, -32070, -32118, -32165, -32207, -32247, -32283, -32318, -32350, 
-        -32380, -32407, -32432, -32456, -32478, -32498, -32518, -32535, -32551, -32568, -32581, -32594, 
-        -32607, -32619, -32628, -32639, -32648, -32656, -32664, -32671, -32678, -32684, -32691, -32696, 
-        -32700, -32706, -32710, -32714, -32718, -32722, -32725, -32729, -32731, -32734, -32735, -32738, 
-        -32741, -32742, -32745, -32746, -32747, -32749, -32750, -32751, -32753, -32754, -32754, -32755, 
-        -32757, -32757, -32758, -32759, -32759, -32759, -32761, -32761, -32762, -32762, -32762, -32763, 
-        -32763, -32763, -32763, -32765, -32765, -32765, -32765, -32765, -32765, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32372, -30689, -27522, -23678, -19820, -16147, -12704, -9496, -6512, -3737, -1159 
-    };
-
-    // AKWF_rAsymSqu_15 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_15[600] PROGMEM = {
-        846, 3543, 6010, 8271, 10340, 12233, 13968, 15555, 17009, 18340, 19559, 20675, 
-        21696, 22631, 23487, 24271, 24988, 25646, 26247, 26798, 27301, 27763, 28186, 28573, 
-        28928, 29252, 29549, 29821, 30069, 30297, 30507, 30697, 30872, 31033, 31179, 31313, 
-        31437, 31548, 31651, 31745, 31832, 31912, 31984, 32050, 32110, 32166, 32217, 32263, 
-        32306, 32345, 32381, 32413, 32443, 32471, 32496, 32519, 32539, 32560, 32577, 32593, 
-        32608, 32621, 32633, 32645, 32656, 32666, 32674, 32682, 32690, 32695, 32702, 32707, 
-        32712, 32718, 32722, 32726, 32729, 32733, 32735, 32738, 32741, 32743, 32745, 32747, 
-        32749, 32750, 32751, 32753, 32754, 32755, 32757, 32758, 32758, 32759, 32761, 32761, 
-        32761, 32762, 32762, 32763, 32763, 32763, 32765, 32765, 32765, 32765, 32765, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32235, 30024, 26004, 21334, 16832, 12658, 8825, 5313, 2097, 
-        -846, -3543, -6010, -8271, -10340, -12233, -13968, -15555, -17009, -18340, -19559, -20675, 
-        -21696, -22631, -23487, -24271, -24988, -25646, -26247, -26798, -27301, -27763, -28186, -28573, 
-        -28928, -29252, -29549, -29821, -30069, -30297, -30507, -30697, -30872, -31033, -31179, -31313, 
-        -31437, -31548, -31651, -31745, -31832, -31912, -31984, -32050, -32110, -32166, -32217, -32263, 
-        -32306, -32345, -32381, -32413, -32443, -32471, -32496, -32519, -32539, -32560, -32577, -32593, 
-        -32608, -32621, -32633, -32645, -32656, -32666, -32674, -32682, -32690, -32695, -32702, -32707, 
-        -32712, -32718, -32722, -32726, -32729, -32733, -32735, -32738, -32741, -32743, -32745, -32747, 
-        -32749, -32750, -32751, -32753, -32754, -32755, -32757, -32758, -32758, -32759, -32761, -32761, 
-        -32761, -32762, -32762, -32763, -32763, -32763, -32765, -32765, -32765, -32765, -32765, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32235, -30024, -26004, -21334, -16832, -12658, -8825, -5313, -2097 
-    };
-
-    // AKWF_rAsymSqu_16 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_16[600] PROGMEM = {
-        2543, 5589, 8327, 10791, 13004, 14996, 16787, 18397, 19844, 21147, 22318, 23370, 
-        24318, 25170, 25934, 26624, 27242, 27799, 28300, 28750, 29154, 29519, 29847, 30140, 
-        30406, 30644, 30858, 31050, 31223, 31379, 31518, 31645, 31759, 31859, 31952, 32034, 
-        32107, 32174, 32234, 32287, 32337, 32380, 32419, 32454, 32486, 32514, 32539, 32562, 
-        32584, 32602, 32619, 32633, 32647, 32660, 32671, 32680, 32690, 32698, 32704, 32711, 
-        32717, 32722, 32726, 32730, 32734, 32738, 32741, 32743, 32746, 32749, 32750, 32753, 
-        32754, 32755, 32757, 32758, 32758, 32759, 32761, 32761, 32762, 32762, 32763, 32763, 
-        32763, 32765, 32765, 32765, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32058, 29189, 24167, 18601, 13449, 8796, 4608, 842, 
-        -2543, -5589, -8327, -10791, -13004, -14996, -16787, -18397, -19844, -21147, -22318, -23370, 
-        -24318, -25170, -25934, -26624, -27242, -27799, -28300, -28750, -29154, -29519, -29847, -30140, 
-        -30406, -30644, -30858, -31050, -31223, -31379, -31518, -31645, -31759, -31859, -31952, -32034, 
-        -32107, -32174, -32234, -32287, -32337, -32380, -32419, -32454, -32486, -32514, -32539, -32562, 
-        -32584, -32602, -32619, -32633, -32647, -32660, -32671, -32680, -32690, -32698, -32704, -32711, 
-        -32717, -32722, -32726, -32730, -32734, -32738, -32741, -32743, -32746, -32749, -32750, -32753, 
-        -32754, -32755, -32757, -32758, -32758, -32759, -32761, -32761, -32762, -32762, -32763, -32763, 
-        -32763, -32765, -32765, -32765, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32058, -29189, -24167, -18601, -13449, -8796, -4608, -842 
-    };
-
-    // AKWF_rAsymSqu_17 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_17[600] PROGMEM = {
-        3849, 7320, 10375, 13062, 15428, 17509, 19340, 20953, 22371, 23619, 24716, 25683, 
-        26534, 27281, 27940, 28520, 29030, 29478, 29873, 30221, 30527, 30795, 31033, 31241, 
-        31424, 31585, 31728, 31852, 31962, 32059, 32144, 32219, 32284, 32342, 32395, 32439, 
-        32478, 32513, 32543, 32570, 32594, 32615, 32633, 32649, 32664, 32676, 32687, 32698, 
-        32706, 32712, 32719, 32726, 32731, 32735, 32739, 32742, 32746, 32749, 32750, 32753, 
-        32754, 32757, 32758, 32759, 32759, 32761, 32762, 32762, 32763, 32763, 32765, 32765, 
-        32765, 32766, 32766, 32766, 32766, 32766, 32766, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 31832, 28155, 21974, 15457, 9670, 4577, 95, 
-        -3849, -7320, -10375, -13062, -15428, -17509, -19340, -20953, -22371, -23619, -24716, -25683, 
-        -26534, -27281, -27940, -28520, -29030, -29478, -29873, -30221, -30527, -30795, -31033, -31241, 
-        -31424, -31585, -31728, -31852, -31962, -32059, -32144, -32219, -32284, -32342, -32395, -32439, 
-        -32478, -32513, -32543, -32570, -32594, -32615, -32633, -32649, -32664, -32676, -32687, -32698, 
-        -32706, -32712, -32719, -32726, -32731, -32735, -32739, -32742, -32746, -32749, -32750, -32753, 
-        -32754, -32757, -32758, -32759, -32759, -32761, -32762, -32762, -32763, -32763, -32765, -32765, 
-        -32765, -32766, -32766, -32766, -32766, -32766, -32766, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -31832, -28155, -21974, -15457, -9670, -4577, -95 
-    };
-
-    // AKWF_rAsymSqu_18 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_18[600] PROGMEM = {
-        4644, 8661, 12104, 15056, 17586, 19754, 21614, 23207, 24572, 25744, 26746, 27606, 
-        28344, 28976, 29518, 29982, 30379, 30721, 31014, 31263, 31479, 31663, 31820, 31956, 
-        32073, 32172, 32256, 32330, 32392, 32445, 32492, 32531, 32565, 32594, 32619, 32640, 
-        32659, 32675, 32687, 32699, 32708, 32718, 32725, 32731, 32737, 32741, 32745, 32747, 
-        32751, 32753, 32755, 32757, 32759, 32761, 32761, 32762, 32763, 32763, 32765, 32765, 
-        32765, 32766, 32766, 32766, 32766, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 31545, 26883, 19380, 11885, 5510, 41, 
-        -4644, -8661, -12104, -15056, -17586, -19754, -21614, -23207, -24572, -25744, -26746, -27606, 
-        -28344, -28976, -29518, -29982, -30379, -30721, -31014, -31263, -31479, -31663, -31820, -31956, 
-        -32073, -32172, -32256, -32330, -32392, -32445, -32492, -32531, -32565, -32594, -32619, -32640, 
-        -32659, -32675, -32687, -32699, -32708, -32718, -32725, -32731, -32737, -32741, -32745, -32747, 
-        -32751, -32753, -32755, -32757, -32759, -32761, -32761, -32762, -32763, -32763, -32765, -32765, 
-        -32765, -32766, -32766, -32766, -32766, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -31545, -26883, -19380, -11885, -5510, -41 
-    };
-
-    // AKWF_rAsymSqu_19 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_19[600] PROGMEM = {
-        -4756, -9517, -13469, -16749, -19473, -21732, -23608, -25166, -26458, -27530, -28420, -29160, 
-        -29773, -30281, -30704, -31056, -31347, -31588, -31788, -31954, -32093, -32208, -32303, -32382, 
-        -32448, -32502, -32547, -32585, -32616, -32641, -32663, -32682, -32696, -32708, -32718, -32727, 
-        -32734, -32739, -32745, -32749, -32751, -32754, -32757, -32759, -32761, -32762, -32762, -32763, 
-        -32765, -32765, -32766, -32766, -32766, -32766, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -31183, -25329, -16344, -7873, -982, 
-        4756, 9517, 13469, 16749, 19473, 21732, 23608, 25166, 26458, 27530, 28420, 29160, 
-        29773, 30281, 30704, 31056, 31347, 31588, 31788, 31954, 32093, 32208, 32303, 32382, 
-        32448, 32502, 32547, 32585, 32616, 32641, 32663, 32682, 32696, 32708, 32718, 32727, 
-        32734, 32739, 32745, 32749, 32751, 32754, 32757, 32759, 32761, 32762, 32762, 32763, 
-        32765, 32765, 32766, 32766, 32766, 32766, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 31183, 25329, 16344, 7873, 982 
-    };
-
-    // AKWF_rAsymSqu_20 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_20[600] PROGMEM = {
-        3877, 9736, 14397, 18118, 21084, 23449, 25336, 26841, 28041, 28999, 29762, 30370, 
-        30856, 31243, 31552, 31799, 31995, 32152, 32276, 32376, 32455, 32518, 32569, 32609, 
-        32641, 32667, 32687, 32704, 32717, 32727, 32735, 32742, 32747, 32751, 32755, 32758, 
-        32759, 32761, 32762, 32763, 32765, 32765, 32766, 32766, 32766, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 30725, 23439, 12810, 3407, 
-        -3877, -9736, -14397, -18118, -21084, -23449, -25336, -26841, -28041, -28999, -29762, -30370, 
-        -30856, -31243, -31552, -31799, -31995, -32152, -32276, -32376, -32455, -32518, -32569, -32609, 
-        -32641, -32667, -32687, -32704, -32717, -32727, -32735, -32742, -32747, -32751, -32755, -32758, 
-        -32759, -32761, -32762, -32763, -32765, -32765, -32766, -32766, -32766, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -30725, -23439, -12810, -3407 
-    };
-
-    // AKWF_rAsymSqu_21 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_21[600] PROGMEM = {
-        1521, 9016, 14781, 19125, 22427, 24928, 26825, 28262, 29352, 30178, 30805, 31280, 
-        31639, 31913, 32119, 32276, 32396, 32486, 32554, 32605, 32645, 32675, 32698, 32714, 
-        32727, 32737, 32745, 32750, 32754, 32758, 32761, 32762, 32763, 32765, 32766, 32766, 
-        32766, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 30145, 21135, 8708, 
-        -1521, -9016, -14781, -19125, -22427, -24928, -26825, -28262, -29352, -30178, -30805, -31280, 
-        -31639, -31913, -32119, -32276, -32396, -32486, -32554, -32605, -32645, -32675, -32698, -32714, 
-        -32727, -32737, -32745, -32750, -32754, -32758, -32761, -32762, -32763, -32765, -32766, -32766, 
-        -32766, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -30145, -21135, -8708 
-    };
-
-    // AKWF_rAsymSqu_22 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_22[600] PROGMEM = {
-        6912, 14339, 19726, 23500, 26197, 28104, 29459, 30420, 31102, 31585, 31929, 32173, 
-        32346, 32468, 32556, 32617, 32662, 32692, 32714, 32730, 32741, 32749, 32754, 32758, 
-        32761, 32763, 32765, 32766, 32766, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 29401, 18309, 3951, 
-        -6912, -14339, -19726, -23500, -26197, -28104, -29459, -30420, -31102, -31585, -31929, -32173, 
-        -32346, -32468, -32556, -32617, -32662, -32692, -32714, -32730, -32741, -32749, -32754, -32758, 
-        -32761, -32763, -32765, -32766, -32766, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -29401, -18309, -3951 
-    };
-
-    // AKWF_rAsymSqu_23 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_23[600] PROGMEM = {
-        1599, 12747, 19705, 24347, 27288, 29228, 30469, 31281, 31803, 32144, 32362, 32506, 
-        32598, 32657, 32696, 32722, 32738, 32749, 32755, 32759, 32763, 32765, 32766, 32766, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 28428, 14790, 
-        -1599, -12747, -19705, -24347, -27288, -29228, -30469, -31281, -31803, -32144, -32362, -32506, 
-        -32598, -32657, -32696, -32722, -32738, -32749, -32755, -32759, -32763, -32765, -32766, -32766, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -28428, -14790 
-    };
-
-    // AKWF_rAsymSqu_24 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_24[600] PROGMEM = {
-        8134, 18948, 24853, 28332, 30225, 31344, 31950, 32311, 32506, 32621, 32684, 32721, 
-        32741, 32753, 32759, 32763, 32765, 32766, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 27107, 10282, 
-        -8134, -18948, -24853, -28332, -30225, -31344, -31950, -32311, -32506, -32621, -32684, -32721, 
-        -32741, -32753, -32759, -32763, -32765, -32766, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -27107, -10282 
-    };
-
-} // namespace AKWF_BwSqurounded
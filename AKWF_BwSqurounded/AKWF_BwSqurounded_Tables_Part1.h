@@ -1,1304 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwSqurounded {
-
-    // AKWF_rAsymSqu_25 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_25[600] PROGMEM = {
-        15918, 25253, 29309, 31250, 32051, 32464, 32616, 32708, 32734, 32757, 32759, 32765, 
-        32765, 32767, 32766, 32767, 32766, 32767, 32766, 32767, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 25190, 4239, 
-        -15918, -25253, -29309, -31250, -32051, -32464, -32616, -32708, -32734, -32757, -32759, -32765, 
-        -32765, -32767, -32766, -32767, -32766, -32767, -32766, -32767, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -25190, -4239 
-    };
-
-    // AKWF_rAsymSqu_26 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rasymsqu_26[600] PROGMEM = {
-        4461, 25095, 30749, 32181, 32635, 32703, 32763, 32746, 32767, 32753, 32765, 32757, 
-        32763, 32758, 32762, 32758, 32761, 32759, 32761, 32759, 32761, 32759, 32761, 32759, 
-        32761, 32759, 32761, 32759, 32761, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 
-        32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 32759, 22082, 
-        -4461, -25095, -30749, -32181, -32635, -32703, -32763, -32746, -32767, -32753, -32765, -32757, 
-        -32763, -32758, -32762, -32758, -32761, -32759, -32761, -32759, -32761, -32759, -32761, -32759, 
-        -32761, -32759, -32761, -32759, -32761, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, 
-        -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -32759, -22082 
-    };
-
-    // AKWF_rSymSqu_01 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_01[600] PROGMEM = {
-        131, 399, 667, 933, 1200, 1468, 1734, 2001, 2267, 2534, 2802, 3069, 
-        3334, 3601, 3869, 4133, 4401, 4668, 4936, 5203, 5471, 5735, 6003, 6270, 
-        6535, 6802, 7070, 7336, 7602, 7869, 8135, 8403, 8670, 8935, 9202, 9467, 
-        9734, 10000, 10265, 10530, 10798, 11063, 11328, 11595, 11861, 12126, 12389, 12657, 
-        12920, 13187, 13451, 13717, 13982, 14245, 14511, 14774, 15038, 15301, 15563, 15828, 
-        16091, 16352, 16615, 16877, 17138, 17400, 17662, 17921, 18182, 18441, 18702, 18961, 
-        19220, 19480, 19738, 19993, 20251, 20506, 20761, 21015, 21270, 21526, 21778, 22028, 
-        22279, 22529, 22780, 23027, 23276, 23523, 23768, 24012, 24254, 24498, 24739, 24978, 
-        25214, 25450, 25687, 25919, 26151, 26379, 26609, 26835, 27057, 27283, 27502, 27718, 
-        27933, 28146, 28358, 28565, 28767, 28968, 29170, 29363, 29556, 29744, 29930, 30110, 
-        30287, 30461, 30630, 30794, 30951, 31105, 31255, 31399, 31537, 31670, 31795, 31917, 
-        32029, 32135, 32234, 32327, 32411, 32487, 32554, 32611, 32661, 32700, 32731, 32750, 
-        32759, 32763, 32765, 32767, 32767, 32767, 32767, 32767, 32767, 32765, 32763, 32759, 
-        32750, 32731, 32700, 32661, 32611, 32554, 32487, 32411, 32327, 32234, 32135, 32029, 
-        31917, 31795, 31670, 31537, 31399, 31255, 31105, 30951, 30794, 30630, 30461, 30287, 
-        30110, 29930, 29744, 29556, 29363, 29170, 28968, 28767, 28565, 28358, 28146, 27933, 
-        27718, 27502, 27283, 27057, 26835, 26609, 26379, 26151, 25919, 25687, 25450, 25214, 
-        24978, 24739, 24498, 24254, 24012, 23768, 23523, 23276, 23027, 22780, 22529, 22279, 
-        22028, 21778, 21526, 21270, 21015, 20761, 20506, 20251, 19993, 19738, 19480, 19220, 
-        18961, 18702, 18441, 18182, 17921, 17662, 17400, 17138, 16877, 16615, 16352, 16091, 
-        15828, 15563, 15301, 15038, 14774, 14511, 14245, 13982, 13717, 13451, 13187, 12920, 
-        12657, 12389, 12126, 11861, 11595, 11328, 11063, 10798, 10530, 10265, 10000, 9734, 
-        9467, 9202, 8935, 8670, 8403, 8135, 7869, 7602, 7336, 7070, 6802, 6535, 
-        6270, 6003, 5735, 5471, 5203, 4936, 4668, 4401, 4133, 3869, 3601, 3334, 
-        3069, 2802, 2534, 2267, 2001, 1734, 1468, 1200, 933, 667, 399, 131, 
-        -131, -399, -667, -933, -1200, -1468, -1734, -2001, -2267, -2534, -2802, -3069, 
-        -3334, -3601, -3869, -4133, -4401, -4668, -4936, -5203, -5471, -5735, -6003, -6270, 
-        -6535, -6802, -7070, -7336, -7602, -7869, -8135, -8403, -8670, -8935, -9202, -9467, 
-        -9734, -10000, -10265, -10530, -10798, -11063, -11328, -11595, -11861, -12126, -12389, -12657, 
-        -12920, -13187, -13451, -13717, -13982, -14245, -14511, -14774, -15038, -15301, -15563, -15828, 
-        -16091, -16352, -16615, -16877, -17138, -17400, -17662, -17921, -18182, -18441, -18702, -18961, 
-        -19220, -19480, -19738, -19993, -20251, -20506, -20761, -21015, -21270, -21526, -21778, -22028, 
-        -22279, -22529, -22780, -23027, -23276, -23523, -23768, -24012, -24254, -24498, -24739, -24978, 
-        -25214, -25450, -25687, -25919, -26151, -26379, -26609, -26835, -27057, -27283, -27502, -27718, 
-        -27933, -28146, -28358, -28565, -28767, -28968, -29170, -29363, -29556, -29744, -29930, -30110, 
-        -30287, -30461, -30630, -30794, -30951, -31105, -31255, -31399, -31537, -31670, -31795, -31917, 
-        -32029, -32135, -32234, -32327, -32411, -32487, -32554, -32611, -32661, -32700, -32731, -32750, 
-        -32759, -32763, -32765, -32767, -32767, -32767, -32767, -32767, -32767, -32765, -32763, -32759, 
-        -32750, -32731, -32700, -32661, -32611, -32554, -32487, -32411, -32327, -32234, -32135, -32029, 
-        -31917, -31795, -31670, -31537, -31399, -31255, -31105, -30951, -30794, -30630, -30461, -30287, 
-        -30110, -29930, -29744, -29556, -29363, -29170, -28968, -28767, -28565, -28358, -28146, -27933, 
-        -27718, -27502, -27283, -27057, -26835, -26609, -26379, -26151, -25919, -25687, -25450, -25214, 
-        -24978, -24739, -24498, -24254, -24012, -23768, -23523, -23276, -23027, -22780, -22529, -22279, 
-        -22028, -21778, -21526, -21270, -21015, -20761, -20506, -20251, -19993, -19738, -19480, -19220, 
-        -18961, -18702, -18441, -18182, -17921, -17662, -17400, -17138, -16877, -16615, -16352, -16091, 
-        -15828, -15563, -15301, -15038, -14774, -14511, -14245, -13982, -13717, -13451, -13187, -12920, 
-        -12657, -12389, -12126, -11861, -11595, -11328, -11063, -10798, -10530, -10265, -10000, -9734, 
-        -9467, -9202, -8935, -8670, -8403, -8135, -7869, -7602, -7336, -7070, -6802, -6535, 
-        -6270, -6003, -5735, -5471, -5203, -4936, -4668, -4401, -4133, -3869, -3601, -3334, 
-        -3069, -2802, -2534, -2267, -2001, -1734, -1468, -1200, -933, -667, -399, -131 
-    };
-
-    // AKWF_rSymSqu_02 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_02[600] PROGMEM = {
-        149, 448, 747, 1048, 1348, 1649, 1948, 2249, 2549, 2848, 3147, 3448, 
-        3750, 4049, 4350, 4649, 4949, 5250, 5550, 5852, 6153, 6453, 6754, 7055, 
-        7357, 7656, 7959, 8260, 8562, 8862, 9166, 9466, 9768, 10069, 10372, 10674, 
-        10978, 11280, 11582, 11884, 12187, 12489, 12794, 13098, 13400, 13702, 14007, 14309, 
-        14612, 14914, 15219, 15523, 15826, 16130, 16433, 16737, 17042, 17345, 17647, 17951, 
-        18253, 18558, 18861, 19163, 19467, 19767, 20069, 20370, 20672, 20974, 21275, 21575, 
-        21874, 22173, 22471, 22768, 23065, 23361, 23656, 23947, 24240, 24532, 24821, 25110, 
-        25397, 25682, 25965, 26245, 26525, 26800, 27075, 27347, 27614, 27878, 28140, 28398, 
-        28652, 28903, 29149, 29390, 29624, 29856, 30080, 30297, 30510, 30713, 30907, 31096, 
-        31275, 31444, 31602, 31751, 31888, 32011, 32122, 32219, 32301, 32367, 32414, 32446, 
-        32471, 32490, 32509, 32527, 32546, 32562, 32578, 32596, 32609, 32624, 32638, 32652, 
-        32663, 32677, 32687, 32697, 32706, 32716, 32724, 32731, 32737, 32744, 32750, 32754, 
-        32757, 32762, 32765, 32766, 32767, 32767, 32767, 32767, 32766, 32765, 32762, 32757, 
-        32754, 32750, 32744, 32737, 32731, 32724, 32716, 32706, 32697, 32687, 32677, 32663, 
-        32652, 32638, 32624, 32609, 32596, 32578, 32562, 32546, 32527, 32509, 32490, 32471, 
-        32446, 32414, 32367, 32301, 32219, 32122, 32011, 31888, 31751, 31602, 31444, 31275, 
-        31096, 30907, 30713, 30510, 30297, 30080, 29856, 29624, 29390, 29149, 28903, 28652, 
-        28398, 28140, 27878, 27614, 27347, 27075, 26800, 26525, 26245, 25965, 25682, 25397, 
-        25110, 24821, 24532, 24240, 23947, 23656, 23361, 23065, 22768, 22471, 22173, 21874, 
-        21575, 21275, 20974, 20672, 20370, 20069, 19767, 19467, 19163, 18861, 18558, 18253, 
-        17951, 17647, 17345, 17042, 16737, 16433, 16130, 15826, 15523, 15219, 14914, 14612, 
-        14309, 14007, 13702, 13400, 13098, 12794, 12489, 12187, 11884, 11582, 11280, 10978, 
-        10674, 10372, 10069, 9768, 9466, 9166, 8862, 8562, 8260, 7959, 7656, 7357, 
-        7055, 6754, 6453, 6153, 5852, 5550, 5250, 4949, 4649, 4350, 4049, 3750, 
-        3448, 3147, 2848, 2549, 2249, 1948, 1649, 1348, 1048, 747, 448, 149, 
-        -149, -448, -747, -1048, -1348, -1649, -1948, -2249, -2549, -2848, -3147, -3448, 
-        -3750, -4049, -4350, -4649, -4949, -5250, -5550, -5852, -6153, -6453, -6754, -7055, 
-        -7357, -7656, -7959, -8260, -8562, -8862, -9166, -9466, -9768, -10069, -10372, -10674, 
-        -10978, -11280, -11582, -11884, -12187, -12489, -12794, -13098, -13400, -13702, -14007, -14309, 
-        -14612, -14914, -15219, -15523, -15826, -16130, -16433, -16737, -17042, -17345, -17647, -17951, 
-        -18253, -18558, -18861, -19163, -19467, -19767, -20069, -20370, -20672, -20974, -21275, -21575, 
-        -21874, -22173, -22471, -22768, -23065, -23361, -23656, -23947, -24240, -24532, -24821, -25110, 
-        -25397, -25682, -25965, -26245, -26525, -26800, -27075, -27347, -27614, -27878, -28140, -28398, 
-        -28652, -28903, -29149, -29390, -29624, -29856, -30080, -30297, -30510, -30713, -30907, -31096, 
-        -31275, -31444, -31602, -31751, -31888, -32011, -32122, -32219, -32301, -32367, -32414, -32446, 
-        -32471, -32490, -32509, -32527, -32546, -32562, -32578, -32596, -32609, -32624, -32638, -32652, 
-        -32663, -32677, -32687, -32697, -32706, -32716, -32724, -32731, -32737, -32744, -32750, -32754, 
-        -32757, -32762, -32765, -32766, -32767, -32767, -32767, -32767, -32766, -32765, -32762, -32757, 
-        -32754, -32750, -32744, -32737, -32731, -32724, -32716, -32706, -32697, -32687, -32677, -32663, 
-        -32652, -32638, -32624, -32609, -32596, -32578, -32562, -32546, -32527, -32509, -32490, -32471, 
-        -32446, -32414, -32367, -32301, -32219, -32122, -32011, -31888, -31751, -31602, -31444, -31275, 
-        -31096, -30907, -30713, -30510, -30297, -30080, -29856, -29624, -29390, -29149, -28903, -28652, 
-        -28398, -28140, -27878, -27614, -27347, -27075, -26800, -26525, -26245, -25965, -25682, -25397, 
-        -25110, -24821, -24532, -24240, -23947, -23656, -23361, -23065, -22768, -22471, -22173, -21874, 
-        -21575, -21275, -20974, -20672, -20370, -20069, -19767, -19467, -19163, -18861, -18558, -18253, 
-        -17951, -17647, -17345, -17042, -16737, -16433, -16130, -15826, -15523, -15219, -14914, -14612, 
-        -14309, -14007, -13702, -13400, -13098, -12794, -12489, -12187, -11884, -11582, -11280, -10978, 
-        -10674, -10372, -10069, -9768, -9466, -9166, -8862, -8562, -8260, -7959, -7656, -7357, 
-        -7055, -6754, -6453, -6153, -5852, -5550, -5250, -4949, -4649, -4350, -4049, -3750, 
-        -3448, -3147, -2848, -2549, -2249, -1948, -1649, -1348, -1048, -747, -448, -149 
-    };
-
-    // AKWF_rSymSqu_03 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_03[600] PROGMEM = {
-        168, 505, 841, 1178, 1515, 1852, 2188, 2526, 2862, 3200, 3536, 3875, 
-        4213, 4551, 4887, 5226, 5564, 5903, 6241, 6580, 6919, 7260, 7599, 7938, 
-        8279, 8620, 8960, 9301, 9643, 9985, 10328, 10668, 11012, 11357, 11700, 12043, 
-        12387, 12732, 13077, 13421, 13768, 14115, 14461, 14808, 15156, 15503, 15851, 16200, 
-        16549, 16898, 17247, 17597, 17947, 18298, 18646, 18998, 19349, 19700, 20051, 20401, 
-        20751, 21102, 21452, 21802, 22151, 22501, 22849, 23198, 23544, 23888, 24233, 24577, 
-        24918, 25257, 25593, 25929, 26261, 26591, 26917, 27238, 27556, 27866, 28174, 28476, 
-        28771, 29057, 29338, 29608, 29867, 30117, 30354, 30577, 30787, 30981, 31156, 31313, 
-        31447, 31558, 31644, 31703, 31748, 31789, 31830, 31869, 31908, 31946, 31982, 32018, 
-        32053, 32086, 32121, 32152, 32184, 32216, 32246, 32276, 32302, 32332, 32357, 32383, 
-        32409, 32431, 32455, 32477, 32499, 32520, 32538, 32559, 32578, 32596, 32611, 32627, 
-        32642, 32656, 32670, 32682, 32692, 32704, 32713, 32722, 32731, 32737, 32745, 32751, 
-        32755, 32760, 32763, 32764, 32766, 32767, 32767, 32766, 32764, 32763, 32760, 32755, 
-        32751, 32745, 32737, 32731, 32722, 32713, 32704, 32692, 32682, 32670, 32656, 32642, 
-        32627, 32611, 32596, 32578, 32559, 32538, 32520, 32499, 32477, 32455, 32431, 32409, 
-        32383, 32357, 32332, 32302, 32276, 32246, 32216, 32186, 32152, 32121, 32086, 32053, 
-        32018, 31982, 31946, 31908, 31869, 31830, 31789, 31748, 31703, 31644, 31558, 31447, 
-        31313, 31156, 30981, 30788, 30577, 30354, 30117, 29867, 29608, 29338, 29057, 28771, 
-        28476, 28174, 27866, 27556, 27238, 26917, 26591, 26261, 25929, 25593, 25257, 24918, 
-        24577, 24233, 23888, 23544, 23198, 22849, 22501, 22151, 21802, 21453, 21102, 20751, 
-        20401, 20051, 19700, 19349, 18998, 18646, 18298, 17947, 17597, 17247, 16898, 16549, 
-        16200, 15851, 15503, 15156, 14808, 14461, 14115, 13768, 13421, 13077, 12732, 12387, 
-        12043, 11700, 11357, 11012, 10668, 10328, 9985, 9643, 9301, 8960, 8620, 8279, 
-        7938, 7599, 7260, 6919, 6580, 6241, 5903, 5564, 5226, 4887, 4551, 4213, 
-        3875, 3536, 3200, 2862, 2526, 2188, 1852, 1515, 1178, 841, 505, 168, 
-        -168, -505, -841, -1178, -1515, -1852, -2188, -2526, -2862, -3200, -3536, -3875, 
-        -4213, -4551, -4887, -5226, -5564, -5903, -6241, -6580, -6919, -7260, -7599, -7938, 
-        -8279, -8620, -8960, -9301, -9643, -9985, -10328, -10668, -11012, -11357, -11700, -12043, 
-        -12387, -12732, -13077, -13421, -13768, -14115, -14461, -14808, -15156, -15503, -15851, -16200, 
-        -16549, -16898, -17247, -17597, -17947, -18298, -18646, -18998, -19349, -19700, -20051, -20401, 
-        -20751, -21102, -21453, -21802, -22151, -22501, -22849, -23198, -23544, -23888, -24233, -24577, 
-        -24918, -25257, -25593, -25929, -26261, -26591, -26917, -27238, -27556, -27866, -28174, -28476, 
-        -28771, -29057, -29338, -29608, -29867, -30117, -30354, -30577, -30788, -30981, -31156, -31313, 
-        -31447, -31558, -31644, -31703, -31748, -31789, -31830, -31869, -31908, -31946, -31982, -32018, 
-        -32053, -32086, -32121, -32152, -32186, -32216, -32246, -32276, -32302, -32332, -32357, -32383, 
-        -32409, -32431, -32455, -32477, -32499, -32520, -32538, -32559, -32578, -32596, -32611, -32627, 
-        -32642, -32656, -32670, -32682, -32692, -32704, -32713, -32722, -32731, -32737, -32745, -32751, 
-        -32755, -32760, -32763, -32764, -32766, -32767, -32767, -32766, -32764, -32763, -32760, -32755, 
-        -32751, -32745, -32737, -32731, -32722, -32713, -32704, -32692, -32682, -32670, -32656, -32642, 
-        -32627, -32611, -32596, -32578, -32559, -32538, -32520, -32499, -32477, -32455, -32431, -32409, 
-        -32383, -32357, -32332, -32302, -32276, -32246, -32216, -32184, -32152, -32121, -32086, -32053, 
-        -32018, -31982, -31946, -31908, -31869, -31830, -31789, -31748, -31703, -31644, -31558, -31447, 
-        -31313, -31156, -30981, -30787, -30577, -30354, -30117, -29867, -29608, -29338, -29057, -28771, 
-        -28476, -28174, -27866, -27556, -27238, -26917, -26591, -26261, -25929, -25593, -25257, -24918, 
-        -24577, -24233, -23888, -23544, -23198, -22849, -22501, -22151, -21802, -21452, -21102, -20751, 
-        -20401, -20051, -19700, -19349, -18998, -18646, -18298, -17947, -17597, -17247, -16898, -16549, 
-        -16200, -15851, -15503, -15156, -14808, -14461, -14115, -13768, -13421, -13077, -12732, -12387, 
-        -12043, -11700, -11357, -11012, -10668, -10328, -9985, -9643, -9301, -8960, -8620, -8279, 
-        -7938, -7599, -7260, -6919, -6580, -6241, -5903, -5564, -5226, -4887, -4551, -4213, 
-        -3875, -3536, -3200, -2862, -2526, -2188, -1852, -1515, -1178, -841, -505, -168 
-    };
-
-    // AKWF_rSymSqu_04 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_04[600] PROGMEM = {
-        190, 577, 962, 1347, 1733, 2119, 2504, 2890, 3276, 3663, 4049, 4436, 
-        4823, 5210, 5599, 5985, 6375, 6764, 7154, 7544, 7934, 8326, 8718, 9109, 
-        9502, 9896, 10290, 10685, 11080, 11476, 11875, 12271, 12671, 13070, 13470, 13871, 
-        14273, 14676, 15079, 15483, 15890, 16295, 16702, 17108, 17518, 17926, 18338, 18747, 
-        19158, 19570, 19981, 20392, 20806, 21218, 21630, 22041, 22451, 22862, 23274, 23680, 
-        24085, 24491, 24893, 25289, 25684, 26074, 26458, 26836, 27207, 27570, 27923, 28264, 
-        28592, 28908, 29203, 29481, 29736, 29964, 30165, 30332, 30462, 30555, 30627, 30692, 
-        30756, 30818, 30880, 30940, 31000, 31058, 31114, 31172, 31226, 31280, 31333, 31387, 
-        31436, 31487, 31537, 31583, 31631, 31678, 31723, 31766, 31810, 31852, 31893, 31933, 
-        31972, 32011, 32049, 32085, 32121, 32155, 32187, 32220, 32251, 32283, 32313, 32340, 
-        32368, 32395, 32421, 32445, 32469, 32493, 32515, 32536, 32554, 32575, 32593, 32610, 
-        32628, 32643, 32658, 32671, 32685, 32697, 32707, 32718, 32727, 32736, 32742, 32749, 
-        32755, 32758, 32761, 32766, 32767, 32767, 32767, 32767, 32766, 32761, 32758, 32755, 
-        32749, 32742, 32736, 32727, 32718, 32707, 32697, 32685, 32671, 32658, 32643, 32628, 
-        32610, 32593, 32575, 32554, 32536, 32515, 32493, 32469, 32445, 32421, 32395, 32368, 
-        32340, 32313, 32283, 32251, 32220, 32187, 32155, 32121, 32085, 32049, 32011, 31972, 
-        31933, 31893, 31852, 31810, 31766, 31723, 31678, 31631, 31583, 31537, 31487, 31436, 
-        31387, 31333, 31280, 31226, 31172, 31114, 31058, 31000, 30940, 30880, 30818, 30756, 
-        30692, 30627, 30555, 30462, 30332, 30165, 29964, 29736, 29481, 29203, 28908, 28592, 
-        28264, 27923, 27570, 27207, 26836, 26458, 26074, 25684, 25289, 24893, 24491, 24085, 
-        23680, 23274, 22862, 22451, 22041, 21630, 21218, 20806, 20392, 19981, 19570, 19158, 
-        18747, 18338, 17926, 17518, 17108, 16702, 16295, 15890, 15483, 15079, 14676, 14273, 
-        13871, 13470, 13070, 12671, 12271, 11875, 11476, 11080, 10685, 10290, 9896, 9502, 
-        9109, 8718, 8326, 7934, 7544, 7154, 6764, 6375, 5985, 5599, 5210, 4823, 
-        4436, 4049, 3663, 3276, 2890, 2504, 2119, 1733, 1347, 962, 577, 190, 
-        -190, -577, -962, -1347, -1733, -2119, -2504, -2890, -3276, -3663, -4049, -4436, 
-        -4823, -5210, -5599, -5985, -6375, -6764, -7154, -7544, -7934, -8326, -8718, -9109, 
-        -9502, -9896, -10290, -10685, -11080, -11476, -11875, -12271, -12671, -13070, -13470, -13871, 
-        -14273, -14676, -15079, -15483, -15890, -16295, -16702, -17108, -17518, -17926, -18338, -18747, 
-        -19158, -19570, -19981, -20392, -20806, -21218, -21630, -22041, -22451, -22862, -23274, -23680, 
-        -24085, -24491, -24893, -25289, -25684, -26074, -26458, -26836, -27207, -27570, -27923, -28264, 
-        -28592, -28908, -29203, -29481, -29736, -29964, -30165, -30332, -30462, -30555, -30627, -30692, 
-        -30756, -30818, -30880, -30940, -31000, -31058, -31114, -31172, -31226, -31280, -31333, -31387, 
-        -31436, -31487, -31537, -31583, -31631, -31678, -31723, -31766, -31810, -31852, -31893, -31933, 
-        -31972, -32011, -32049, -32085, -32121, -32155, -32187, -32220, -32251, -32283, -32313, -32340, 
-        -32368, -32395, -32421, -32445, -32469, -32493, -32515, -32536, -32554, -32575, -32593, -32610, 
-        -32628, -32643, -32658, -32671, -32685, -32697, -32707, -32718, -32727, -32736, -32742, -32749, 
-        -32755, -32758, -32761, -32766, -32767, -32767, -32767, -32767, -32766, -32761, -32758, -32755, 
-        -32749, -32742, -32736, -32727, -32718, -32707, -32697, -32685, -32671, -32658, -32643, -32628, 
-        -32610, -32593, -32575, -32554, -32536, -32515, -32493, -32469, -32445, -32421, -32395, -32368, 
-        -32340, -32313, -32283, -32251, -32220, -32187, -32155, -32121, -32085, -32049, -32011, -31972, 
-        -31933, -31893, -31852, -31810, -31766, -31723, -31678, -31631, -31583, -31537, -31487, -31436, 
-        -31387, -31333, -31280, -31226, -31172, -31114, -31058, -31000, -30940, -30880, -30818, -30756, 
-        -30692, -30627, -30555, -30462, -30332, -30165, -29964, -29736, -29481, -29203, -28908, -28592, 
-        -28264, -27923, -27570, -27207, -26836, -26458, -26074, -25684, -25289, -24893, -24491, -24085, 
-        -23680, -23274, -22862, -22451, -22041, -21630, -21218, -20806, -20392, -19981, -19570, -19158, 
-        -18747, -18338, -17926, -17518, -17108, -16702, -16295, -15890, -15483, -15079, -14676, -14273, 
-        -13871, -13470, -13070, -12671, -12271, -11875, -11476, -11080, -10685, -10290, -9896, -9502, 
-        -9109, -8718, -8326, -7934, -7544, -7154, -6764, -6375, -5985, -5599, -5210, -4823, 
-        -4436, -4049, -3663, -3276, -2890, -2504, -2119, -1733, -1347, -962, -577, -190 
-    };
-
-    // AKWF_rSymSqu_05 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_05[600] PROGMEM = {
-        225, 675, 1124, 1575, 2026, 2476, 2927, 3379, 3831, 4284, 4736, 5190, 
-        5645, 6100, 6555, 7011, 7469, 7927, 8386, 8847, 9308, 9770, 10234, 10697, 
-        11164, 11631, 12099, 12568, 13041, 13513, 13987, 14463, 14940, 15418, 15898, 16379, 
-        16862, 17348, 17832, 18319, 18807, 19295, 19785, 20275, 20763, 21253, 21743, 22232, 
-        22718, 23202, 23683, 24160, 24631, 25098, 25554, 26000, 26435, 26853, 27253, 27631, 
-        27982, 28303, 28587, 28825, 29011, 29143, 29242, 29331, 29420, 29507, 29593, 29676, 
-        29761, 29842, 29922, 30001, 30080, 30156, 30232, 30306, 30379, 30450, 30521, 30589, 
-        30658, 30724, 30790, 30854, 30917, 30978, 31040, 31100, 31157, 31215, 31271, 31327, 
-        31381, 31433, 31485, 31536, 31586, 31634, 31681, 31727, 31773, 31817, 31861, 31901, 
-        31944, 31982, 32021, 32059, 32096, 32133, 32166, 32201, 32232, 32264, 32295, 32326, 
-        32355, 32383, 32409, 32435, 32460, 32484, 32506, 32529, 32550, 32569, 32589, 32607, 
-        32623, 32640, 32653, 32668, 32681, 32694, 32705, 32715, 32725, 32734, 32741, 32748, 
-        32753, 32759, 32762, 32765, 32767, 32767, 32767, 32767, 32765, 32762, 32759, 32753, 
-        32748, 32741, 32734, 32725, 32715, 32705, 32694, 32681, 32668, 32653, 32640, 32623, 
-        32607, 32589, 32569, 32550, 32529, 32506, 32484, 32460, 32435, 32409, 32383, 32355, 
-        32326, 32295, 32264, 32232, 32201, 32166, 32133, 32096, 32059, 32021, 31982, 31944, 
-        31901, 31861, 31817, 31773, 31727, 31681, 31634, 31586, 31536, 31485, 31433, 31381, 
-        31327, 31271, 31215, 31157, 31100, 31040, 30978, 30917, 30854, 30790, 30724, 30658, 
-        30589, 30521, 30450, 30379, 30306, 30232, 30156, 30080, 30001, 29922, 29842, 29761, 
-        29676, 29593, 29507, 29420, 29331, 29242, 29143, 29011, 28825, 28587, 28303, 27982, 
-        27631, 27253, 26853, 26435, 26000, 25554, 25098, 24631, 24160, 23683, 23202, 22718, 
-        22232, 21743, 21253, 20763, 20275, 19785, 19295, 18807, 18319, 17832, 17348, 16862, 
-        16379, 15898, 15418, 14940, 14463, 13987, 13513, 13041, 12568, 12099, 11631, 11164, 
-        10697, 10234, 9770, 9308, 8847, 8386, 7927, 7469, 7011, 6555, 6100, 5645, 
-        5190, 4736, 4284, 3831, 3379, 2927, 2476, 2026, 1575, 1124, 675, 225, 
-        -225, -675, -1124, -1575, -2026, -2476, -2927, -3379, -3831, -4284, -4736, -5190, 
-        -5645, -6100, -6555, -7011, -7469, -7927, -8386, -8847, -9308, -9770, -10234, -10697, 
-        -11164, -11631, -12099, -12568, -13041, -13513, -13987, -14463, -14940, -15418, -15898, -16379, 
-        -16862, -17348, -17832, -18319, -18807, -19295, -19785, -20275, -20763, -21253, -21743, -22232, 
-        -22718, -23202, -23683, -24160, -24631, -25098, -25554, -26000, -26435, -26853, -27253, -27631, 
-        -27982, -28303, -28587, -28825, -29011, -29143, -29242, -29331, -29420, -29507, -29593, -29676, 
-        -29761, -29842, -29922, -30001, -30080, -30156, -30232, -30306, -30379, -30450, -30521, -30589, 
-        -30658, -30724, -30790, -30854, -30917, -30978, -31040, -31100, -31157, -31215, -31271, -31327, 
-        -31381, -31433, -31485, -31536, -31586, -31634, -31681, -31727, -31773, -31817, -31861, -31901, 
-        -31944, -31982, -32021, -32059, -32096, -32133, -32166, -32201, -32232, -32264, -32295, -32326, 
-        -32355, -32383, -32409, -32435, -32460, -32484, -32506, -32529, -32550, -32569, -32589, -32607, 
-        -32623, -32640, -32653, -32668, -32681, -32694, -32705, -32715, -32725, -32734, -32741, -32748, 
-        -32753, -32759, -32762, -32765, -32767, -32767, -32767, -32767, -32765, -32762, -32759, -32753, 
-        -32748, -32741, -32734, -32725, -32715, -32705, -32694, -32681, -32668, -32653, -32640, -32623, 
-        -32607, -32589, -32569, -32550, -32529, -32506, -32484, -32460, -32435, -32409, -32383, -32355, 
-        -32326, -32295, -32264, -32232, -32201, -32166, -32133, -32096, -32059, -32021, -31982, -31944, 
-        -31901, -31861, -31817, -31773, -31727, -31681, -31634, -31586, -31536, -31485, -31433, -31381, 
-        -31327, -31271, -31215, -31157, -31100, -31040, -30978, -30917, -30854, -30790, -30724, -30658, 
-        -30589, -30521, -30450, -30379, -30306, -30232, -30156, -30080, -30001, -29922, -29842, -29761, 
-        -29676, -29593, -29507, -29420, -29331, -29242, -29143, -29011, -28825, -28587, -28303, -27982, 
-        -27631, -27253, -26853, -26435, -26000, -25554, -25098, -24631, -24160, -23683, -23202, -22718, 
-        -22232, -21743, -21253, -20763, -20275, -19785, -19295, -18807, -18319, -17832, -17348, -16862, 
-        -16379, -15898, -15418, -14940, -14463, -13987, -13513, -13041, -12568, -12099, -11631, -11164, 
-        -10697, -10234, -9770, -9308, -8847, -8386, -7927, -7469, -7011, -6555, -6100, -5645, 
-        -5190, -4736, -4284, -3831, -3379, -2927, -2476, -2026, -1575, -1124, -675, -225 
-    };
-
-    // AKWF_rSymSqu_06 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_06[600] PROGMEM = {
-        265, 796, 1328, 1860, 2393, 2926, 3459, 3994, 4528, 5064, 5602, 6140, 
-        6681, 7219, 7762, 8307, 8853, 9398, 9947, 10499, 11051, 11606, 12163, 12723, 
-        13284, 13848, 14415, 14984, 15555, 16128, 16704, 17283, 17861, 18443, 19026, 19610, 
-        20194, 20776, 21360, 21940, 22515, 23088, 23649, 24202, 24741, 25263, 25761, 26227, 
-        26659, 27044, 27370, 27622, 27800, 27928, 28043, 28155, 28267, 28377, 28484, 28590, 
-        28694, 28796, 28896, 28996, 29092, 29188, 29282, 29375, 29466, 29555, 29642, 29728, 
-        29813, 29896, 29978, 30058, 30137, 30215, 30291, 30366, 30438, 30509, 30580, 30649, 
-        30717, 30783, 30848, 30913, 30975, 31037, 31096, 31157, 31213, 31270, 31326, 31380, 
-        31432, 31483, 31535, 31584, 31632, 31679, 31725, 31770, 31814, 31858, 31899, 31940, 
-        31980, 32017, 32055, 32092, 32127, 32162, 32195, 32227, 32260, 32289, 32319, 32347, 
-        32375, 32402, 32426, 32452, 32474, 32498, 32519, 32540, 32560, 32579, 32597, 32615, 
-        32631, 32646, 32660, 32674, 32686, 32697, 32708, 32717, 32727, 32735, 32742, 32748, 
-        32753, 32758, 32760, 32763, 32767, 32766, 32766, 32767, 32763, 32760, 32758, 32753, 
-        32748, 32742, 32735, 32727, 32717, 32708, 32697, 32686, 32674, 32660, 32646, 32631, 
-        32615, 32597, 32579, 32560, 32540, 32519, 32498, 32474, 32452, 32426, 32402, 32375, 
-        32347, 32319, 32289, 32260, 32227, 32195, 32162, 32127, 32092, 32055, 32017, 31980, 
-        31940, 31899, 31858, 31814, 31770, 31725, 31679, 31632, 31584, 31535, 31483, 31432, 
-        31380, 31326, 31270, 31213, 31157, 31096, 31037, 30975, 30913, 30848, 30783, 30717, 
-        30649, 30580, 30509, 30438, 30366, 30291, 30215, 30137, 30058, 29978, 29896, 29813, 
-        29728, 29642, 29555, 29466, 29375, 29282, 29188, 29092, 28996, 28896, 28796, 28694, 
-        28590, 28484, 28377, 28267, 28155, 28043, 27928, 27800, 27622, 27370, 27044, 26659, 
-        26227, 25761, 25263, 24741, 24202, 23649, 23088, 22515, 21940, 21360, 20776, 20194, 
-        19610, 19026, 18443, 17861, 17283, 16704, 16128, 15555, 14984, 14415, 13848, 13284, 
-        12723, 12163, 11606, 11051, 10499, 9947, 9398, 8853, 8307, 7762, 7219, 6681, 
-        6140, 5602, 5064, 4528, 3994, 3459, 2926, 2393, 1860, 1328, 796, 265, 
-        -265, -796, -1328, -1860, -2393, -2926, -3459, -3994, -4528, -5064, -5602, -6140, 
-        -6681, -7219, -7762, -8307, -8853, -9398, -9947, -10499, -11051, -11606, -12163, -12723, 
-        -13284, -13848, -14415, -14984, -15555, -16128, -16704, -17283, -17861, -18443, -19026, -19610, 
-        -20194, -20776, -21360, -21940, -22515, -23088, -23649, -24202, -24741, -25263, -25761, -26227, 
-        -26659, -27044, -27370, -27622, -27800, -27928, -28043, -28155, -28267, -28377, -28484, -28590, 
-        -28694, -28796, -28896, -28996, -29092, -29188, -29282, -29375, -29466, -29555, -29642, -29728, 
-        -29813, -29896, -29978, -30058, -30137, -30215, -30291, -30366, -30438, -30509, -30580, -30649, 
-        -30717, -30783, -30848, -30913, -30975, -31037, -31096, -31157, -31213, -31270, -31326, -31380, 
-        -31432, -31483, -31535, -31584, -31632, -31679, -31725, -31770, -31814, -31858, -31899, -31940, 
-        -31980, -32017, -32055, -32092, -32127, -32162, -32195, -32227, -32260, -32289, -32319, -32347, 
-        -32375, -32402, -32426, -32452, -32474, -32498, -32519, -32540, -32560, -32579, -32597, -32615, 
-        -32631, -32646, -32660, -32674, -32686, -32697, -32708, -32717, -32727, -32735, -32742, -32748, 
-        -32753, -32758, -32760, -32763, -32767, -32766, -32766, -32767, -32763, -32760, -32758, -32753, 
-        -32748, -32742, -32735, -32727, -32717, -32708, -32697, -32686, -32674, -32660, -32646, -32631, 
-        -32615, -32597, -32579, -32560, -32540, -32519, -32498, -32474, -32452, -32426, -32402, -32375, 
-        -32347, -32319, -32289, -32260, -32227, -32195, -32162, -32127, -32092, -32055, -32017, -31980, 
-        -31940, -31899, -31858, -31814, -31770, -31725, -31679, -31632, -31584, -31535, -31483, -31432, 
-        -31380, -31326, -31270, -31213, -31157, -31096, -31037, -30975, -30913, -30848, -30783, -30717, 
-        -30649, -30580, -30509, -30438, -30366, -30291, -30215, -30137, -30058, -29978, -29896, -29813, 
-        -29728, -29642, -29555, -29466, -29375, -29282, -29188, -29092, -28996, -28896, -28796, -28694, 
-        -28590, -28484, -28377, -28267, -28155, -28043, -27928, -27800, -27622, -27370, -27044, -26659, 
-        -26227, -25761, -25263, -24741, -24202, -23649, -23088, -22515, -21940, -21360, -20776, -20194, 
-        -19610, -19026, -18443, -17861, -17283, -16704, -16128, -15555, -14984, -14415, -13848, -13284, 
-        -12723, -12163, -11606, -11051, -10499, -9947, -9398, -8853, -8307, -7762, -7219, -6681, 
-        -6140, -5602, -5064, -4528, -3994, -3459, -2926, -2393, -1860, -1328, -796, -265 
-    };
-
-    // AKWF_rSymSqu_07 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_07[600] PROGMEM = {
-        314, 944, 1574, 2205, 2836, 3471, 4103, 4739, 5375, 6013, 6654, 7295, 
-        7941, 8587, 9237, 9890, 10546, 11203, 11866, 12533, 13203, 13876, 14552, 15233, 
-        15917, 16605, 17296, 17989, 18685, 19382, 20078, 20774, 21467, 22152, 22827, 23486, 
-        24123, 24731, 25296, 25805, 26241, 26578, 26807, 26966, 27105, 27244, 27377, 27508, 
-        27637, 27764, 27889, 28010, 28130, 28247, 28363, 28474, 28587, 28695, 28801, 28906, 
-        29008, 29109, 29207, 29303, 29400, 29492, 29582, 29672, 29761, 29846, 29931, 30014, 
-        30093, 30173, 30251, 30326, 30399, 30474, 30545, 30614, 30682, 30749, 30814, 30880, 
-        30942, 31003, 31063, 31122, 31179, 31236, 31291, 31345, 31397, 31449, 31498, 31548, 
-        31596, 31642, 31687, 31732, 31775, 31817, 31858, 31898, 31939, 31975, 32012, 32049, 
-        32083, 32118, 32151, 32184, 32213, 32243, 32273, 32301, 32329, 32355, 32381, 32405, 
-        32430, 32453, 32475, 32495, 32517, 32536, 32555, 32573, 32591, 32607, 32622, 32637, 
-        32650, 32664, 32676, 32687, 32698, 32708, 32717, 32727, 32733, 32740, 32746, 32751, 
-        32757, 32759, 32762, 32765, 32767, 32767, 32767, 32767, 32765, 32762, 32759, 32757, 
-        32751, 32746, 32740, 32733, 32727, 32717, 32708, 32698, 32687, 32676, 32664, 32650, 
-        32637, 32622, 32607, 32591, 32573, 32555, 32536, 32517, 32495, 32475, 32453, 32430, 
-        32405, 32381, 32355, 32329, 32301, 32273, 32243, 32213, 32184, 32151, 32118, 32083, 
-        32049, 32012, 31975, 31939, 31898, 31858, 31817, 31775, 31732, 31687, 31642, 31596, 
-        31548, 31498, 31449, 31397, 31345, 31291, 31236, 31179, 31122, 31063, 31003, 30942, 
-        30880, 30814, 30749, 30682, 30614, 30545, 30474, 30399, 30326, 30251, 30173, 30093, 
-        30014, 29931, 29846, 29761, 29672, 29582, 29492, 29400, 29303, 29207, 29109, 29008, 
-        28906, 28801, 28695, 28587, 28474, 28363, 28247, 28130, 28010, 27889, 27764, 27637, 
-        27508, 27377, 27244, 27105, 26966, 26807, 26578, 26241, 25805, 25296, 24731, 24123, 
-        23486, 22827, 22152, 21467, 20774, 20078, 19382, 18685, 17989, 17296, 16605, 15917, 
-        15233, 14552, 13876, 13203, 12533, 11866, 11203, 10546, 9890, 9237, 8587, 7941, 
-        7295, 6654, 6013, 5375, 4739, 4103, 3471, 2836, 2205, 1574, 944, 314, 
-        -314, -944, -1574, -2205, -2836, -3471, -4103, -4739, -5375, -6013, -6654, -7295, 
-        -7941, -8587, -9237, -9890, -10546, -11203, -11866, -12533, -13203, -13876, -14552, -15233, 
-        -15917, -16605, -17296, -17989, -18685, -19382, -20078, -20774, -21467, -22152, -22827, -23486, 
-        -24123, -24731, -25296, -25805, -26241, -26578, -26807, -26966, -27105, -27244, -27377, -27508, 
-        -27637, -27764, -27889, -28010, -28130, -28247, -28363, -28474, -28587, -28695, -28801, -28906, 
-        -29008, -29109, -29207, -29303, -29400, -29492, -29582, -29672, -29761, -29846, -29931, -30014, 
-        -30093, -30173, -30251, -30326, -30399, -30474, -30545, -30614, -30682, -30749, -30814, -30880, 
-        -30942, -31003, -31063, -31122, -31179, -31236, -31291, -31345, -31397, -31449, -31498, -31548, 
-        -31596, -31642, -31687, -31732, -31775, -31817, -31858, -31898, -31939, -31975, -32012, -32049, 
-        -32083, -32118, -32151, -32184, -32213, -32243, -32273, -32301, -32329, -32355, -32381, -32405, 
-        -32430, -32453, -32475, -32495, -32517, -32536, -32555, -32573, -32591, -32607, -32622, -32637, 
-        -32650, -32664, -32676, -32687, -32698, -32708, -32717, -32727, -32733, -32740, -32746, -32751, 
-        -32757, -32759, -32762, -32765, -32767, -32767, -32767, -32767, -32765, -32762, -32759, -32757, 
-        -32751, -32746, -32740, -32733, -32727, -32717, -32708, -32698, -32687, -32676, -32664, -32650, 
-        -32637, -32622, -32607, -32591, -32573, -32555, -32536, -32517, -32495, -32475, -32453, -32430, 
-        -32405, -32381, -32355, -32329, -32301, -32273, -32243, -32213, -32184, -32151, -32118, -32083, 
-        -32049, -32012, -31975, -31939, -31898, -31858, -31817, -31775, -31732, -31687, -31642, -31596, 
-        -31548, -31498, -31449, -31397, -31345, -31291, -31236, -31179, -31122, -31063, -31003, -30942, 
-        -30880, -30814, -30749, -30682, -30614, -30545, -30474, -30399, -30326, -30251, -30173, -30093, 
-        -30014, -29931, -29846, -29761, -29672, -29582, -29492, -29400, -29303, -29207, -29109, -29008, 
-        -28906, -28801, -28695, -28587, -28474, -28363, -28247, -28130, -28010, -27889, -27764, -27637, 
-        -27508, -27377, -27244, -27105, -26966, -26807, -26578, -26241, -25805, -25296, -24731, -24123, 
-        -23486, -22827, -22152, -21467, -20774, -20078, -19382, -18685, -17989, -17296, -16605, -15917, 
-        -15233, -14552, -13876, -13203, -12533, -11866, -11203, -10546, -9890, -9237, -8587, -7941, 
-        -7295, -6654, -6013, -5375, -4739, -4103, -3471, -2836, -2205, -1574, -944, -314 
-    };
-
-    // AKWF_rSymSqu_08 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_08[600] PROGMEM = {
-        376, 1130, 1886, 2643, 3400, 4159, 4919, 5684, 6451, 7220, 7993, 8770, 
-        9552, 10337, 11128, 11925, 12726, 13535, 14347, 15166, 15989, 16818, 17652, 18489, 
-        19326, 20164, 20996, 21819, 22622, 23397, 24131, 24800, 25378, 25824, 26121, 26317, 
-        26484, 26647, 26808, 26963, 27116, 27265, 27410, 27554, 27693, 27828, 27962, 28091, 
-        28219, 28342, 28464, 28582, 28698, 28811, 28921, 29030, 29134, 29238, 29338, 29438, 
-        29534, 29627, 29720, 29810, 29897, 29982, 30066, 30148, 30227, 30306, 30382, 30455, 
-        30528, 30598, 30669, 30736, 30801, 30866, 30928, 30991, 31050, 31109, 31164, 31221, 
-        31274, 31327, 31379, 31429, 31478, 31526, 31574, 31619, 31662, 31705, 31747, 31788, 
-        31828, 31866, 31905, 31941, 31976, 32011, 32045, 32078, 32109, 32139, 32171, 32200, 
-        32228, 32255, 32283, 32308, 32333, 32357, 32381, 32402, 32424, 32446, 32465, 32485, 
-        32504, 32522, 32540, 32555, 32573, 32589, 32603, 32616, 32630, 32643, 32655, 32665, 
-        32676, 32687, 32696, 32704, 32713, 32721, 32728, 32734, 32741, 32746, 32750, 32754, 
-        32758, 32761, 32764, 32765, 32766, 32767, 32767, 32766, 32765, 32764, 32761, 32758, 
-        32754, 32750, 32746, 32741, 32734, 32728, 32721, 32713, 32704, 32696, 32687, 32676, 
-        32665, 32655, 32643, 32630, 32616, 32603, 32589, 32573, 32555, 32540, 32522, 32504, 
-        32485, 32465, 32446, 32424, 32402, 32381, 32357, 32333, 32308, 32283, 32255, 32228, 
-        32200, 32171, 32139, 32109, 32078, 32045, 32011, 31976, 31941, 31905, 31866, 31828, 
-        31788, 31747, 31705, 31662, 31619, 31574, 31526, 31478, 31429, 31379, 31327, 31274, 
-        31221, 31164, 31109, 31050, 30991, 30928, 30866, 30801, 30736, 30669, 30598, 30528, 
-        30455, 30382, 30306, 30227, 30148, 30066, 29982, 29897, 29810, 29720, 29627, 29534, 
-        29438, 29338, 29238, 29134, 29030, 28921, 28811, 28698, 28582, 28464, 28342, 28219, 
-        28091, 27962, 27828, 27693, 27554, 27410, 27265, 27116, 26963, 26808, 26647, 26484, 
-        26317, 26121, 25824, 25378, 24800, 24131, 23397, 22622, 21819, 20996, 20164, 19326, 
-        18489, 17652, 16818, 15989, 15166, 14347, 13535, 12726, 11925, 11128, 10337, 9552, 
-        8770, 7993, 7220, 6451, 5684, 4919, 4159, 3400, 2643, 1886, 1130, 376, 
-        -376, -1130, -1886, -2643, -3400, -4159, -4919, -5684, -6451, -7220, -7993, -8770, 
-        -9552, -10337, -11128, -11925, -12726, -13535, -14347, -15166, -15989, -16818, -17652, -18489, 
-        -19326, -20164, -20996, -21819, -22622, -23397, -24131, -24800, -25378, -25824, -26121, -26317, 
-        -26484, -26647, -26808, -26963, -27116, -27265, -27410, -27554, -27693, -27828, -27962, -28091, 
-        -28219, -28342, -28464, -28582, -28698, -28811, -28921, -29030, -29134, -29238, -29338, -29438, 
-        -29534, -29627, -29720, -29810, -29897, -29982, -30066, -30148, -30227, -30306, -30382, -30455, 
-        -30528, -30598, -30669, -30736, -30801, -30866, -30928, -30991, -31050, -31109, -31164, -31221, 
-        -31274, -31327, -31379, -31429, -31478, -31526, -31574, -31619, -31662, -31705, -31747, -31788, 
-        -31828, -31866, -31905, -31941, -31976, -32011, -32045, -32078, -32109, -32139, -32171, -32200, 
-        -32228, -32255, -32283, -32308, -32333, -32357, -32381, -32402, -32424, -32446, -32465, -32485, 
-        -32504, -32522, -32540, -32555, -32573, -32589, -32603, -32616, -32630, -32643, -32655, -32665, 
-        -32676, -32687, -32696, -32704, -32713, -32721, -32728, -32734, -32741, -32746, -32750, -32754, 
-        -32758, -32761, -32764, -32765, -32766, -32767, -32767, -32766, -32765, -32764, -32761, -32758, 
-        -32754, -32750, -32746, -32741, -32734, -32728, -32721, -32713, -32704, -32696, -32687, -32676, 
-        -32665, -32655, -32643, -32630, -32616, -32603, -32589, -32573, -32555, -32540, -32522, -32504, 
-        -32485, -32465, -32446, -32424, -32402, -32381, -32357, -32333, -32308, -32283, -32255, -32228, 
-        -32200, -32171, -32139, -32109, -32078, -32045, -32011, -31976, -31941, -31905, -31866, -31828, 
-        -31788, -31747, -31705, -31662, -31619, -31574, -31526, -31478, -31429, -31379, -31327, -31274, 
-        -31221, -31164, -31109, -31050, -30991, -30928, -30866, -30801, -30736, -30669, -30598, -30528, 
-        -30455, -30382, -30306, -30227, -30148, -30066, -29982, -29897, -29810, -29720, -29627, -29534, 
-        -29438, -29338, -29238, -29134, -29030, -28921, -28811, -28698, -28582, -28464, -28342, -28219, 
-        -28091, -27962, -27828, -27693, -27554, -27410, -27265, -27116, -26963, -26808, -26647, -26484, 
-        -26317, -26121, -25824, -25378, -24800, -24131, -23397, -22622, -21819, -20996, -20164, -19326, 
-        -18489, -17652, -16818, -15989, -15166, -14347, -13535, -12726, -11925, -11128, -10337, -9552, 
-        -8770, -7993, -7220, -6451, -5684, -4919, -4159, -3400, -2643, -1886, -1130, -376 
-    };
-
-    // AKWF_rSymSqu_09 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_09[600] PROGMEM = {
-        462, 1389, 2316, 3247, 4177, 5114, 6051, 6996, 7944, 8898, 9860, 10828, 
-        11805, 12788, 13779, 14780, 15789, 16804, 17824, 18848, 19867, 20877, 21864, 22811, 
-        23690, 24459, 25059, 25452, 25702, 25910, 26110, 26307, 26497, 26682, 26863, 27038, 
-        27207, 27373, 27534, 27691, 27845, 27992, 28136, 28277, 28413, 28546, 28675, 28800, 
-        28921, 29041, 29155, 29267, 29377, 29482, 29585, 29686, 29784, 29879, 29971, 30060, 
-        30147, 30232, 30315, 30395, 30473, 30548, 30621, 30693, 30762, 30830, 30896, 30960, 
-        31021, 31081, 31141, 31197, 31252, 31307, 31359, 31408, 31459, 31506, 31553, 31599, 
-        31643, 31686, 31728, 31768, 31806, 31845, 31881, 31917, 31952, 31984, 32017, 32050, 
-        32081, 32109, 32138, 32167, 32194, 32220, 32246, 32270, 32294, 32317, 32340, 32361, 
-        32382, 32403, 32421, 32440, 32459, 32477, 32493, 32509, 32526, 32541, 32556, 32569, 
-        32582, 32595, 32609, 32620, 32632, 32642, 32653, 32662, 32672, 32682, 32689, 32697, 
-        32705, 32711, 32718, 32725, 32731, 32736, 32740, 32745, 32748, 32753, 32757, 32758, 
-        32762, 32764, 32765, 32766, 32766, 32767, 32767, 32766, 32766, 32765, 32764, 32762, 
-        32758, 32757, 32753, 32748, 32745, 32740, 32736, 32731, 32725, 32718, 32711, 32705, 
-        32697, 32689, 32682, 32672, 32662, 32653, 32642, 32632, 32620, 32609, 32595, 32582, 
-        32569, 32556, 32541, 32526, 32509, 32493, 32477, 32459, 32440, 32421, 32403, 32382, 
-        32361, 32340, 32317, 32294, 32270, 32246, 32220, 32194, 32167, 32138, 32109, 32081, 
-        32050, 32017, 31984, 31952, 31917, 31881, 31845, 31806, 31768, 31728, 31686, 31643, 
-        31599, 31553, 31506, 31459, 31408, 31359, 31307, 31252, 31197, 31141, 31081, 31021, 
-        30960, 30896, 30830, 30762, 30693, 30621, 30548, 30473, 30395, 30315, 30232, 30147, 
-        30060, 29971, 29879, 29784, 29686, 29585, 29482, 29377, 29267, 29155, 29041, 28921, 
-        28800, 28675, 28546, 28413, 28277, 28136, 27992, 27845, 27691, 27534, 27373, 27207, 
-        27038, 26863, 26682, 26497, 26307, 26110, 25910, 25702, 25452, 25059, 24459, 23690, 
-        22811, 21864, 20877, 19867, 18848, 17824, 16804, 15789, 14780, 13779, 12788, 11805, 
-        10828, 9860, 8898, 7944, 6996, 6051, 5114, 4177, 3247, 2316, 1389, 462, 
-        -462, -1389, -2316, -3247, -4177, -5114, -6051, -6996, -7944, -8898, -9860, -10828, 
-        -11805, -12788, -13779, -14780, -15789, -16804, -17824, -18848, -19867, -20877, -21864, -22811, 
-        -23690, -24459, -25059, -25452, -25702, -25910, -26110, -26307, -26497, -26682, -26863, -27038, 
-        -27207, -27373, -27534, -27691, -27845, -27992, -28136, -28277, -28413, -28546, -28675, -28800, 
-        -28921, -29041, -29155, -29267, -29377, -29482, -29585, -29686, -29784, -29879, -29971, -30060, 
-        -30147, -30232, -30315, -30395, -30473, -30548, -30621, -30693, -30762, -30830, -30896, -30960, 
-        -31021, -31081, -31141, -31197, -31252, -31307, -31359, -31408, -31459, -31506, -31553, -31599, 
-        -31643, -31686, -31728, -31768, -31806, -31845, -31881, -31917, -31952, -31984, -32017, -32050, 
-        -32081, -32109, -32138, -32167, -32194, -32220, -32246, -32270, -32294, -32317, -32340, -32361, 
-        -32382, -32403, -32421, -32440, -32459, -32477, -32493, -32509, -32526, -32541, -32556, -32569, 
-        -32582, -32595, -32609, -32620, -32632, -32642, -32653, -32662, -32672, -32682, -32689, -32697, 
-        -32705, -32711, -32718, -32725, -32731, -32736, -32740, -32745, -32748, -32753, -32757, -32758, 
-        -32762, -32764, -32765, -32766, -32766, -32767, -32767, -32766, -32766, -32765, -32764, -32762, 
-        -32758, -32757, -32753, -32748, -32745, -32740, -32736, -32731, -32725, -32718, -32711, -32705, 
-        -32697, -32689, -32682, -32672, -32662, -32653, -32642, -32632, -32620, -32609, -32595, -32582, 
-        -32569, -32556, -32541, -32526, -32509, -32493, -32477, -32459, -32440, -32421, -32403, -32382, 
-        -32361, -32340, -32317, -32294, -32270, -32246, -32220, -32194, -32167, -32138, -32109, -32081, 
-        -32050, -32017, -31984, -31952, -31917, -31881, -31845, -31806, -31768, -31728, -31686, -31643, 
-        -31599, -31553, -31506, -31459, -31408, -31359, -31307, -31252, -31197, -31141, -31081, -31021, 
-        -30960, -30896, -30830, -30762, -30693, -30621, -30548, -30473, -30395, -30315, -30232, -30147, 
-        -30060, -29971, -29879, -29784, -29686, -29585, -29482, -29377, -29267, -29155, -29041, -28921, 
-        -28800, -28675, -28546, -28413, -28277, -28136, -27992, -27845, -27691, -27534, -27373, -27207, 
-        -27038, -26863, -26682, -26497, -26307, -26110, -25910, -25702, -25452, -25059, -24459, -23690, 
-        -22811, -21864, -20877, -19867, -18848, -17824, -16804, -15789, -14780, -13779, -12788, -11805, 
-        -10828, -9860, -8898, -7944, -6996, -6051, -5114, -4177, -3247, -2316, -1389, -462 
-    };
-
-    // AKWF_rSymSqu_10 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_10[600] PROGMEM = {
-        560, 1683, 2808, 3935, 5067, 6206, 7351, 8506, 9668, 10841, 12025, 13223, 
-        14432, 15653, 16885, 18125, 19363, 20591, 21785, 22915, 23922, 24713, 25225, 25535, 
-        25782, 26023, 26255, 26480, 26695, 26904, 27107, 27303, 27492, 27675, 27852, 28023, 
-        28188, 28348, 28502, 28650, 28796, 28934, 29068, 29199, 29324, 29447, 29564, 29678, 
-        29788, 29892, 29995, 30095, 30190, 30283, 30372, 30459, 30543, 30623, 30702, 30777, 
-        30850, 30921, 30990, 31054, 31117, 31179, 31239, 31296, 31352, 31405, 31457, 31507, 
-        31556, 31603, 31648, 31691, 31733, 31775, 31813, 31852, 31887, 31924, 31958, 31992, 
-        32023, 32053, 32083, 32112, 32140, 32167, 32194, 32217, 32242, 32265, 32288, 32309, 
-        32331, 32352, 32370, 32389, 32407, 32425, 32442, 32459, 32473, 32489, 32504, 32517, 
-        32531, 32544, 32556, 32569, 32580, 32591, 32602, 32613, 32622, 32631, 32641, 32649, 
-        32656, 32666, 32673, 32680, 32687, 32694, 32700, 32706, 32711, 32717, 32721, 32726, 
-        32731, 32735, 32739, 32742, 32746, 32748, 32752, 32755, 32757, 32758, 32761, 32762, 
-        32765, 32765, 32766, 32766, 32767, 32767, 32767, 32767, 32766, 32766, 32765, 32765, 
-        32762, 32761, 32758, 32757, 32755, 32752, 32748, 32746, 32742, 32739, 32735, 32731, 
-        32726, 32721, 32717, 32711, 32706, 32700, 32694, 32687, 32680, 32673, 32666, 32656, 
-        32649, 32641, 32631, 32622, 32613, 32602, 32591, 32580, 32569, 32556, 32544, 32531, 
-        32517, 32504, 32489, 32473, 32459, 32442, 32425, 32407, 32389, 32370, 32352, 32331, 
-        32309, 32288, 32265, 32242, 32217, 32194, 32167, 32140, 32112, 32083, 32053, 32023, 
-        31992, 31958, 31924, 31887, 31852, 31813, 31775, 31733, 31691, 31648, 31603, 31556, 
-        31507, 31457, 31405, 31352, 31296, 31239, 31179, 31117, 31054, 30990, 30921, 30850, 
-        30777, 30702, 30623, 30543, 30459, 30372, 30283, 30190, 30095, 29995, 29892, 29788, 
-        29678, 29564, 29447, 29324, 29199, 29068, 28934, 28796, 28650, 28502, 28348, 28188, 
-        28023, 27852, 27675, 27492, 27303, 27107, 26904, 26695, 26480, 26255, 26023, 25782, 
-        25535, 25225, 24713, 23922, 22915, 21785, 20591, 19363, 18125, 16885, 15653, 14432, 
-        13223, 12025, 10841, 9668, 8506, 7351, 6206, 5067, 3935, 2808, 1683, 560, 
-        -560, -1683, -2808, -3935, -5067, -6206, -7351, -8506, -9668, -10841, -12025, -13223, 
-        -14432, -15653, -16885, -18125, -19363, -20591, -21785, -22915, -23922, -24713, -25225, -25535, 
-        -25782, -26023, -26255, -26480, -26695, -26904, -27107, -27303, -27492, -27675, -27852, -28023, 
-        -28188, -28348, -28502, -28650, -28796, -28934, -29068, -29199, -29324, -29447, -29564, -29678, 
-        -29788, -29892, -29995, -30095, -30190, -30283, -30372, -30459, -30543, -30623, -30702, -30777, 
-        -30850, -30921, -30990, -31054, -31117, -31179, -31239, -31296, -31352, -31405, -31457, -31507, 
-        -31556, -31603, -31648, -31691, -31733, -31775, -31813, -31852, -31887, -31924, -31958, -31992, 
-        -32023, -32053, -32083, -32112, -32140, -32167, -32194, -32217, -32242, -32265, -32288, -32309, 
-        -32331, -32352, -32370, -32389, -32407, -32425, -32442, -32459, -32473, -32489, -32504, -32517, 
-        -32531, -32544, -32556, -32569, -32580, -32591, -32602, -32613, -32622, -32631, -32641, -32649, 
-        -32656, -32666, -32673, -32680, -32687, -32694, -32700, -32706, -32711, -32717, -32721, -32726, 
-        -32731, -32735, -32739, -32742, -32746, -32748, -32752, -32755, -32757, -32758, -32761, -32762, 
-        -32765, -32765, -32766, -32766, -32767, -32767, -32767, -32767, -32766, -32766, -32765, -32765, 
-        -32762, -32761, -32758, -32757, -32755, -32752, -32748, -32746, -32742, -32739, -32735, -32731, 
-        -32726, -32721, -32717, -32711, -32706, -32700, -32694, -32687, -32680, -32673, -32666, -32656, 
-        -32649, -32641, -32631, -32622, -32613, -32602, -32591, -32580, -32569, -32556, -32544, -32531, 
-        -32517, -32504, -32489, -32473, -32459, -32442, -32425, -32407, -32389, -32370, -32352, -32331, 
-        -32309, -32288, -32265, -32242, -32217, -32194, -32167, -32140, -32112, -32083, -32053, -32023, 
-        -31992, -31958, -31924, -31887, -31852, -31813, -31775, -31733, -31691, -31648, -31603, -31556, 
-        -31507, -31457, -31405, -31352, -31296, -31239, -31179, -31117, -31054, -30990, -30921, -30850, 
-        -30777, -30702, -30623, -30543, -30459, -30372, -30283, -30190, -30095, -29995, -29892, -29788, 
-        -29678, -29564, -29447, -29324, -29199, -29068, -28934, -28796, -28650, -28502, -28348, -28188, 
-        -28023, -27852, -27675, -27492, -27303, -27107, -26904, -26695, -26480, -26255, -26023, -25782, 
-        -25535, -25225, -24713, -23922, -22915, -21785, -20591, -19363, -18125, -16885, -15653, -14432, 
-        -13223, -12025, -10841, -9668, -8506, -7351, -6206, -5067, -3935, -2808, -1683, -560 
-    };
-
-    // AKWF_rSymSqu_11 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_11[600] PROGMEM = {
-        678, 2040, 3405, 4775, 6154, 7543, 8944, 10360, 11791, 13243, 14712, 16198, 
-        17696, 19198, 20685, 22115, 23418, 24454, 25119, 25503, 25800, 26086, 26360, 26622, 
-        26873, 27116, 27347, 27570, 27783, 27988, 28184, 28372, 28554, 28727, 28893, 29054, 
-        29207, 29353, 29495, 29630, 29760, 29884, 30004, 30118, 30229, 30335, 30436, 30533, 
-        30626, 30715, 30801, 30884, 30963, 31039, 31111, 31181, 31248, 31312, 31374, 31433, 
-        31489, 31543, 31596, 31647, 31695, 31741, 31785, 31827, 31869, 31907, 31945, 31981, 
-        32015, 32049, 32080, 32110, 32140, 32168, 32195, 32221, 32245, 32270, 32292, 32312, 
-        32334, 32353, 32374, 32392, 32410, 32427, 32442, 32459, 32473, 32488, 32501, 32514, 
-        32528, 32540, 32551, 32562, 32573, 32582, 32594, 32602, 32612, 32621, 32629, 32636, 
-        32644, 32650, 32657, 32663, 32671, 32677, 32683, 32688, 32693, 32698, 32703, 32708, 
-        32712, 32716, 32720, 32724, 32728, 32731, 32734, 32737, 32740, 32743, 32744, 32748, 
-        32751, 32752, 32755, 32755, 32757, 32759, 32760, 32761, 32762, 32764, 32764, 32766, 
-        32766, 32766, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32766, 32766, 
-        32766, 32764, 32764, 32762, 32761, 32760, 32759, 32757, 32755, 32755, 32752, 32751, 
-        32748, 32744, 32743, 32740, 32737, 32734, 32731, 32728, 32724, 32720, 32716, 32712, 
-        32708, 32703, 32698, 32693, 32688, 32683, 32677, 32671, 32663, 32657, 32650, 32644, 
-        32636, 32629, 32621, 32612, 32602, 32594, 32582, 32573, 32562, 32551, 32540, 32528, 
-        32514, 32501, 32488, 32473, 32459, 32442, 32427, 32410, 32392, 32374, 32353, 32334, 
-        32312, 32292, 32270, 32245, 32221, 32195, 32168, 32140, 32110, 32080, 32049, 32015, 
-        31981, 31945, 31907, 31869, 31827, 31785, 31741, 31695, 31647, 31596, 31543, 31489, 
-        31433, 31374, 31312, 31248, 31181, 31111, 31039, 30963, 30884, 30801, 30715, 30626, 
-        30533, 30436, 30335, 30229, 30118, 30004, 29884, 29760, 29630, 29495, 29353, 29207, 
-        29054, 28893, 28727, 28554, 28372, 28184, 27988, 27783, 27570, 27347, 27116, 26873, 
-        26622, 26360, 26086, 25800, 25503, 25119, 24454, 23418, 22115, 20685, 19198, 17696, 
-        16198, 14712, 13243, 11791, 10360, 8944, 7543, 6154, 4775, 3405, 2040, 678, 
-        -678, -2040, -3405, -4775, -6154, -7543, -8944, -10360, -11791, -13243, -14712, -16198, 
-        -17696, -19198, -20685, -22115, -23418, -24454, -25119, -25503, -25800, -26086, -26360, -26622, 
-        -26873, -27116, -27347, -27570, -27783, -27988, -28184, -28372, -28554, -28727, -28893, -29054, 
-        -29207, -29353, -29495, -29630, -29760, -29884, -30004, -30118, -30229, -30335, -30436, -30533, 
-        -30626, -30715, -30801, -30884, -30963, -31039, -31111, -31181, -31248, -31312, -31374, -31433, 
-        -31489, -31543, -31596, -31647, -31695, -31741, -31785, -31827, -31869, -31907, -31945, -31981, 
-        -32015, -32049, -32080, -32110, -32140, -32168, -32195, -32221, -32245, -32270, -32292, -32312, 
-        -32334, -32353, -32374, -32392, -32410, -32427, -32442, -32459, -32473, -32488, -32501, -32514, 
-        -32528, -32540, -32551, -32562, -32573, -32582, -32594, -32602, -32612, -32621, -32629, -32636, 
-        -32644, -32650, -32657, -32663, -32671, -32677, -32683, -32688, -32693, -32698, -32703, -32708, 
-        -32712, -32716, -32720, -32724, -32728, -32731, -32734, -32737, -32740, -32743, -32744, -32748, 
-        -32751, -32752, -32755, -32755, -32757, -32759, -32760, -32761, -32762, -32764, -32764, -32766, 
-        -32766, -32766, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32766, -32766, 
-        -32766, -32764, -32764, -32762, -32761, -32760, -32759, -32757, -32755, -32755, -32752, -32751, 
-        -32748, -32744, -32743, -32740, -32737, -32734, -32731, -32728, -32724, -32720, -32716, -32712, 
-        -32708, -32703, -32698, -32693, -32688, -32683, -32677, -32671, -32663, -32657, -32650, -32644, 
-        -32636, -32629, -32621, -32612, -32602, -32594, -32582, -32573, -32562, -32551, -32540, -32528, 
-        -32514, -32501, -32488, -32473, -32459, -32442, -32427, -32410, -32392, -32374, -32353, -32334, 
-        -32312, -32292, -32270, -32245, -32221, -32195, -32168, -32140, -32110, -32080, -32049, -32015, 
-        -31981, -31945, -31907, -31869, -31827, -31785, -31741, -31695, -31647, -31596, -31543, -31489, 
-        -31433, -31374, -31312, -31248, -31181, -31111, -31039, -30963, -30884, -30801, -30715, -30626, 
-        -30533, -30436, -30335, -30229, -30118, -30004, -29884, -29760, -29630, -29495, -29353, -29207, 
-        -29054, -28893, -28727, -28554, -28372, -28184, -27988, -27783, -27570, -27347, -27116, -26873, 
-        -26622, -26360, -26086, -25800, -25503, -25119, -24454, -23418, -22115, -20685, -19198, -17696, 
-        -16198, -14712, -13243, -11791, -10360, -8944, -7543, -6154, -4775, -3405, -2040, -678 
-    };
-
-    // AKWF_rSymSqu_12 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_12[600] PROGMEM = {
-        812, 2442, 4078, 5724, 7384, 9061, 10761, 12487, 14239, 16018, 17819, 19627, 
-        21399, 23051, 24388, 25239, 25708, 26056, 26385, 26698, 26996, 27280, 27549, 27806, 
-        28050, 28281, 28502, 28711, 28912, 29100, 29281, 29453, 29617, 29772, 29918, 30060, 
-        30193, 30320, 30440, 30555, 30664, 30768, 30866, 30961, 31049, 31136, 31215, 31292, 
-        31365, 31435, 31500, 31564, 31623, 31681, 31734, 31787, 31835, 31882, 31925, 31968, 
-        32007, 32046, 32082, 32117, 32149, 32181, 32210, 32237, 32264, 32290, 32314, 32337, 
-        32359, 32380, 32400, 32420, 32436, 32454, 32471, 32485, 32500, 32513, 32527, 32540, 
-        32552, 32563, 32575, 32584, 32594, 32604, 32612, 32620, 32629, 32637, 32644, 32651, 
-        32657, 32663, 32669, 32674, 32680, 32685, 32690, 32694, 32698, 32703, 32707, 32711, 
-        32715, 32717, 32720, 32724, 32726, 32729, 32733, 32734, 32737, 32739, 32742, 32743, 
-        32746, 32746, 32748, 32750, 32751, 32752, 32753, 32755, 32756, 32757, 32759, 32760, 
-        32760, 32762, 32762, 32762, 32764, 32764, 32765, 32765, 32766, 32766, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32766, 32766, 32765, 32765, 32764, 32764, 32762, 32762, 32762, 32760, 
-        32760, 32759, 32757, 32756, 32755, 32753, 32752, 32751, 32750, 32748, 32746, 32746, 
-        32743, 32742, 32739, 32737, 32734, 32733, 32729, 32726, 32724, 32720, 32717, 32715, 
-        32711, 32707, 32703, 32698, 32694, 32690, 32685, 32680, 32674, 32669, 32663, 32657, 
-        32651, 32644, 32637, 32629, 32620, 32612, 32604, 32594, 32584, 32575, 32563, 32552, 
-        32540, 32527, 32513, 32500, 32485, 32471, 32454, 32436, 32420, 32400, 32380, 32359, 
-        32337, 32314, 32290, 32264, 32237, 32210, 32181, 32149, 32117, 32082, 32046, 32007, 
-        31968, 31925, 31882, 31835, 31787, 31734, 31681, 31623, 31564, 31500, 31435, 31365, 
-        31292, 31215, 31136, 31049, 30961, 30866, 30768, 30664, 30555, 30440, 30320, 30193, 
-        30060, 29918, 29772, 29617, 29453, 29281, 29100, 28912, 28711, 28502, 28281, 28050, 
-        27806, 27549, 27280, 26996, 26698, 26385, 26056, 25708, 25239, 24388, 23051, 21399, 
-        19627, 17819, 16018, 14239, 12487, 10761, 9061, 7384, 5724, 4078, 2442, 812, 
-        -812, -2442, -4078, -5724, -7384, -9061, -10761, -12487, -14239, -16018, -17819, -19627, 
-        -21399, -23051, -24388, -25239, -25708, -26056, -26385, -26698, -26996, -27280, -27549, -27806, 
-        -28050, -28281, -28502, -28711, -28912, -29100, -29281, -29453, -29617, -29772, -29918, -30060, 
-        -30193, -30320, -30440, -30555, -30664, -30768, -30866, -30961, -31049, -31136, -31215, -31292, 
-        -31365, -31435, -31500, -31564, -31623, -31681, -31734, -31787, -31835, -31882, -31925, -31968, 
-        -32007, -32046, -32082, -32117, -32149, -32181, -32210, -32237, -32264, -32290, -32314, -32337, 
-        -32359, -32380, -32400, -32420, -32436, -32454, -32471, -32485, -32500, -32513, -32527, -32540, 
-        -32552, -32563, -32575, -32584, -32594, -32604, -32612, -32620, -32629, -32637, -32644, -32651, 
-        -32657, -32663, -32669, -32674, -32680, -32685, -32690, -32694, -32698, -32703, -32707, -32711, 
-        -32715, -32717, -32720, -32724, -32726, -32729, -32733, -32734, -32737, -32739, -32742, -32743, 
-        -32746, -32746, -32748, -32750, -32751, -32752, -32753, -32755, -32756, -32757, -32759, -32760, 
-        -32760, -32762, -32762, -32762, -32764, -32764, -32765, -32765, -32766, -32766, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32766, -32766, -32765, -32765, -32764, -32764, -32762, -32762, -32762, -32760, 
-        -32760, -32759, -32757, -32756, -32755, -32753, -32752, -32751, -32750, -32748, -32746, -32746, 
-        -32743, -32742, -32739, -32737, -32734, -32733, -32729, -32726, -32724, -32720, -32717, -32715, 
-        -32711, -32707, -32703, -32698, -32694, -32690, -32685, -32680, -32674, -32669, -32663, -32657, 
-        -32651, -32644, -32637, -32629, -32620, -32612, -32604, -32594, -32584, -32575, -32563, -32552, 
-        -32540, -32527, -32513, -32500, -32485, -32471, -32454, -32436, -32420, -32400, -32380, -32359, 
-        -32337, -32314, -32290, -32264, -32237, -32210, -32181, -32149, -32117, -32082, -32046, -32007, 
-        -31968, -31925, -31882, -31835, -31787, -31734, -31681, -31623, -31564, -31500, -31435, -31365, 
-        -31292, -31215, -31136, -31049, -30961, -30866, -30768, -30664, -30555, -30440, -30320, -30193, 
-        -30060, -29918, -29772, -29617, -29453, -29281, -29100, -28912, -28711, -28502, -28281, -28050, 
-        -27806, -27549, -27280, -26996, -26698, -26385, -26056, -25708, -25239, -24388, -23051, -21399, 
-        -19627, -17819, -16018, -14239, -12487, -10761, -9061, -7384, -5724, -4078, -2442, -812 
-    };
-
-    // AKWF_rSymSqu_13 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_13[600] PROGMEM = {
-        1002, 3012, 5032, 7071, 9136, 11232, 13365, 15537, 17739, 19938, 22036, 23779, 
-        24893, 25494, 25924, 26327, 26706, 27064, 27400, 27716, 28014, 28295, 28558, 28807, 
-        29040, 29259, 29466, 29662, 29844, 30017, 30179, 30331, 30475, 30610, 30738, 30858, 
-        30971, 31076, 31176, 31270, 31358, 31442, 31520, 31593, 31664, 31728, 31790, 31847, 
-        31901, 31953, 32001, 32046, 32090, 32130, 32167, 32203, 32236, 32268, 32298, 32325, 
-        32352, 32376, 32399, 32421, 32442, 32461, 32479, 32497, 32512, 32527, 32542, 32556, 
-        32569, 32580, 32590, 32602, 32612, 32621, 32630, 32638, 32646, 32653, 32660, 32667, 
-        32673, 32678, 32684, 32689, 32694, 32698, 32702, 32706, 32710, 32714, 32717, 32720, 
-        32724, 32726, 32728, 32732, 32733, 32735, 32738, 32739, 32742, 32743, 32744, 32746, 
-        32748, 32750, 32750, 32751, 32753, 32753, 32755, 32755, 32757, 32757, 32757, 32759, 
-        32760, 32760, 32761, 32761, 32762, 32762, 32762, 32764, 32764, 32764, 32764, 32765, 
-        32765, 32765, 32765, 32765, 32765, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32767, 32767, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32765, 32765, 32765, 32765, 32765, 
-        32765, 32764, 32764, 32764, 32764, 32762, 32762, 32762, 32761, 32761, 32760, 32760, 
-        32759, 32757, 32757, 32757, 32755, 32755, 32753, 32753, 32751, 32750, 32750, 32748, 
-        32746, 32744, 32743, 32742, 32739, 32738, 32735, 32733, 32732, 32728, 32726, 32724, 
-        32720, 32717, 32714, 32710, 32706, 32702, 32698, 32694, 32689, 32684, 32678, 32673, 
-        32667, 32660, 32653, 32646, 32638, 32630, 32621, 32612, 32602, 32590, 32580, 32569, 
-        32556, 32542, 32527, 32512, 32497, 32479, 32461, 32442, 32421, 32399, 32376, 32352, 
-        32325, 32298, 32268, 32236, 32203, 32167, 32130, 32090, 32046, 32001, 31953, 31901, 
-        31847, 31790, 31728, 31664, 31593, 31520, 31442, 31358, 31270, 31176, 31076, 30971, 
-        30858, 30738, 30610, 30475, 30331, 30179, 30017, 29844, 29662, 29466, 29259, 29040, 
-        28807, 28558, 28295, 28014, 27716, 27400, 27064, 26706, 26327, 25924, 25494, 24893, 
-        23779, 22036, 19938, 17739, 15537, 13365, 11232, 9136, 7071, 5032, 3012, 1002, 
-        -1002, -3012, -5032, -7071, -9136, -11232, -13365, -15537, -17739, -19938, -22036, -23779, 
-        -24893, -25494, -25924, -26327, -26706, -27064, -27400, -27716, -28014, -28295, -28558, -28807, 
-        -29040, -29259, -29466, -29662, -29844, -30017, -30179, -30331, -30475, -30610, -30738, -30858, 
-        -30971, -31076, -31176, -31270, -31358, -31442, -31520, -31593, -31664, -31728, -31790, -31847, 
-        -31901, -31953, -32001, -32046, -32090, -32130, -32167, -32203, -32236, -32268, -32298, -32325, 
-        -32352, -32376, -32399, -32421, -32442, -32461, -32479, -32497, -32512, -32527, -32542, -32556, 
-        -32569, -32580, -32590, -32602, -32612, -32621, -32630, -32638, -32646, -32653, -32660, -32667, 
-        -32673, -32678, -32684, -32689, -32694, -32698, -32702, -32706, -32710, -32714, -32717, -32720, 
-        -32724, -32726, -32728, -32732, -32733, -32735, -32738, -32739, -32742, -32743, -32744, -32746, 
-        -32748, -32750, -32750, -32751, -32753, -32753, -32755, -32755, -32757, -32757, -32757, -32759, 
-        -32760, -32760, -32761, -32761, -32762, -32762, -32762, -32764, -32764, -32764, -32764, -32765, 
-        -32765, -32765, -32765, -32765, -32765, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32767, -32767, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32765, -32765, -32765, -32765, -32765, 
-        -32765, -32764, -32764, -32764, -32764, -32762, -32762, -32762, -32761, -32761, -32760, -32760, 
-        -32759, -32757, -32757, -32757, -32755, -32755, -32753, -32753, -32751, -32750, -32750, -32748, 
-        -32746, -32744, -32743, -32742, -32739, -32738, -32735, -32733, -32732, -32728, -32726, -32724, 
-        -32720, -32717, -32714, -32710, -32706, -32702, -32698, -32694, -32689, -32684, -32678, -32673, 
-        -32667, -32660, -32653, -32646, -32638, -32630, -32621, -32612, -32602, -32590, -32580, -32569, 
-        -32556, -32542, -32527, -32512, -32497, -32479, -32461, -32442, -32421, -32399, -32376, -32352, 
-        -32325, -32298, -32268, -32236, -32203, -32167, -32130, -32090, -32046, -32001, -31953, -31901, 
-        -31847, -31790, -31728, -31664, -31593, -31520, -31442, -31358, -31270, -31176, -31076, -30971, 
-        -30858, -30738, -30610, -30475, -30331, -30179, -30017, -29844, -29662, -29466, -29259, -29040, 
-        -28807, -28558, -28295, -28014, -27716, -27400, -27064, -26706, -26327, -25924, -25494, -24893, 
-        -23779, -22036, -19938, -17739, -15537, -13365, -11232, -9136, -7071, -5032, -3012, -1002 
-    };
-
-    // AKWF_rSymSqu_14 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_14[600] PROGMEM = {
-        1198, 3601, 6022, 8476, 10975, 13526, 16135, 18781, 21371, 23574, 24992, 25724, 
-        26222, 26684, 27114, 27513, 27884, 28230, 28549, 28848, 29124, 29382, 29621, 29844, 
-        30049, 30242, 30420, 30587, 30740, 30884, 31017, 31140, 31256, 31362, 31461, 31553, 
-        31639, 31719, 31793, 31861, 31926, 31985, 32041, 32091, 32140, 32185, 32225, 32263, 
-        32299, 32332, 32363, 32391, 32418, 32443, 32466, 32488, 32507, 32525, 32543, 32558, 
-        32574, 32588, 32599, 32612, 32622, 32633, 32643, 32651, 32660, 32667, 32674, 32680, 
-        32687, 32693, 32698, 32703, 32707, 32712, 32716, 32719, 32723, 32725, 32729, 32732, 
-        32734, 32737, 32739, 32741, 32743, 32744, 32746, 32748, 32750, 32751, 32751, 32752, 
-        32755, 32755, 32756, 32757, 32757, 32759, 32759, 32760, 32760, 32761, 32761, 32761, 
-        32762, 32762, 32762, 32764, 32764, 32764, 32764, 32764, 32765, 32765, 32765, 32765, 
-        32765, 32765, 32765, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32765, 32765, 32765, 
-        32765, 32765, 32765, 32765, 32764, 32764, 32764, 32764, 32764, 32762, 32762, 32762, 
-        32761, 32761, 32761, 32760, 32760, 32759, 32759, 32757, 32757, 32756, 32755, 32755, 
-        32752, 32751, 32751, 32750, 32748, 32746, 32744, 32743, 32741, 32739, 32737, 32734, 
-        32732, 32729, 32725, 32723, 32719, 32716, 32712, 32707, 32703, 32698, 32693, 32687, 
-        32680, 32674, 32667, 32660, 32651, 32643, 32633, 32622, 32612, 32599, 32588, 32574, 
-        32558, 32543, 32525, 32507, 32488, 32466, 32443, 32418, 32391, 32363, 32332, 32299, 
-        32263, 32225, 32185, 32140, 32091, 32041, 31985, 31926, 31861, 31793, 31719, 31639, 
-        31553, 31461, 31362, 31256, 31140, 31017, 30884, 30740, 30587, 30420, 30242, 30049, 
-        29844, 29621, 29382, 29124, 28848, 28549, 28230, 27884, 27513, 27114, 26684, 26222, 
-        25724, 24992, 23574, 21371, 18781, 16135, 13526, 10975, 8476, 6022, 3601, 1198, 
-        -1198, -3601, -6022, -8476, -10975, -13526, -16135, -18781, -21371, -23574, -24992, -25724, 
-        -26222, -26684, -27114, -27513, -27884, -28230, -28549, -28848, -29124, -29382, -29621, -29844, 
-        -30049, -30242, -30420, -30587, -30740, -30884, -31017, -31140, -31256, -31362, -31461, -31553, 
-        -31639, -31719, -31793, -31861, -31926, -31985, -32041, -32091, -32140, -32185, -32225, -32263, 
-        -32299, -32332, -32363, -32391, -32418, -32443, -32466, -32488, -32507, -32525, -32543, -32558, 
-        -32574, -32588, -32599, -32612, -32622, -32633, -32643, -32651, -32660, -32667, -32674, -32680, 
-        -32687, -32693, -32698, -32703, -32707, -32712, -32716, -32719, -32723, -32725, -32729, -32732, 
-        -32734, -32737, -32739, -32741, -32743, -32744, -32746, -32748, -32750, -32751, -32751, -32752, 
-        -32755, -32755, -32756, -32757, -32757, -32759, -32759, -32760, -32760, -32761, -32761, -32761, 
-        -32762, -32762, -32762, -32764, -32764, -32764, -32764, -32764, -32765, -32765, -32765, -32765, 
-        -32765, -32765, -32765, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32765, -32765, -32765, 
-        -32765, -32765, -32765, -32765, -32764, -32764, -32764, -32764, -32764, -32762, -32762, -32762, 
-        -32761, -32761, -32761, -32760, -32760, -32759, -32759, -32757, -32757, -32756, -32755, -32755, 
-        -32752, -32751, -32751, -32750, -32748, -32746, -32744, -32743, -32741, -32739, -32737, -32734, 
-        -32732, -32729, -32725, -32723, -32719, -32716, -32712, -32707, -32703, -32698, -32693, -32687, 
-        -32680, -32674, -32667, -32660, -32651, -32643, -32633, -32622, -32612, -32599, -32588, -32574, 
-        -32558, -32543, -32525, -32507, -32488, -32466, -32443, -32418, -32391, -32363, -32332, -32299, 
-        -32263, -32225, -32185, -32140, -32091, -32041, -31985, -31926, -31861, -31793, -31719, -31639, 
-        -31553, -31461, -31362, -31256, -31140, -31017, -30884, -30740, -30587, -30420, -30242, -30049, 
-        -29844, -29621, -29382, -29124, -28848, -28549, -28230, -27884, -27513, -27114, -26684, -26222, 
-        -25724, -24992, -23574, -21371, -18781, -16135, -13526, -10975, -8476, -6022, -3601, -1198 
-    };
-
-    // AKWF_rSymSqu_15 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_15[600] PROGMEM = {
-        1472, 4427, 7417, 10464, 13586, 16783, 19987, 22789, 24622, 25554, 26163, 26722, 
-        27231, 27700, 28127, 28520, 28878, 29206, 29508, 29782, 30034, 30265, 30477, 30670, 
-        30848, 31009, 31158, 31294, 31419, 31532, 31637, 31732, 31819, 31900, 31973, 32040, 
-        32103, 32158, 32209, 32257, 32300, 32340, 32376, 32408, 32439, 32467, 32493, 32515, 
-        32536, 32556, 32574, 32590, 32606, 32619, 32631, 32643, 32653, 32664, 32673, 32680, 
-        32688, 32694, 32701, 32706, 32712, 32716, 32721, 32725, 32729, 32732, 32734, 32737, 
-        32739, 32743, 32744, 32747, 32748, 32751, 32751, 32752, 32755, 32755, 32756, 32757, 
-        32759, 32759, 32760, 32760, 32761, 32761, 32762, 32762, 32762, 32764, 32764, 32764, 
-        32764, 32765, 32765, 32765, 32765, 32765, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32765, 32765, 32765, 32765, 32765, 32764, 
-        32764, 32764, 32764, 32762, 32762, 32762, 32761, 32761, 32760, 32760, 32759, 32759, 
-        32757, 32756, 32755, 32755, 32752, 32751, 32751, 32748, 32747, 32744, 32743, 32739, 
-        32737, 32734, 32732, 32729, 32725, 32721, 32716, 32712, 32706, 32701, 32694, 32688, 
-        32680, 32673, 32664, 32653, 32643, 32631, 32619, 32606, 32590, 32574, 32556, 32536, 
-        32515, 32493, 32467, 32439, 32408, 32376, 32340, 32300, 32257, 32209, 32158, 32103, 
-        32040, 31973, 31900, 31819, 31732, 31637, 31532, 31419, 31294, 31158, 31009, 30848, 
-        30670, 30477, 30265, 30034, 29782, 29508, 29206, 28878, 28520, 28127, 27700, 27231, 
-        26722, 26163, 25554, 24622, 22789, 19987, 16783, 13586, 10464, 7417, 4427, 1472, 
-        -1472, -4427, -7417, -10464, -13586, -16783, -19987, -22789, -24622, -25554, -26163, -26722, 
-        -27231, -27700, -28127, -28520, -28878, -29206, -29508, -29782, -30034, -30265, -30477, -30670, 
-        -30848, -31009, -31158, -31294, -31419, -31532, -31637, -31732, -31819, -31900, -31973, -32040, 
-        -32103, -32158, -32209, -32257, -32300, -32340, -32376, -32408, -32439, -32467, -32493, -32515, 
-        -32536, -32556, -32574, -32590, -32606, -32619, -32631, -32643, -32653, -32664, -32673, -32680, 
-        -32688, -32694, -32701, -32706, -32712, -32716, -32721, -32725, -32729, -32732, -32734, -32737, 
-        -32739, -32743, -32744, -32747, -32748, -32751, -32751, -32752, -32755, -32755, -32756, -32757, 
-        -32759, -32759, -32760, -32760, -32761, -32761, -32762, -32762, -32762, -32764, -32764, -32764, 
-        -32764, -32765, -32765, -32765, -32765, -32765, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32765, -32765, -32765, -32765, -32765, -32764, 
-        -32764, -32764, -32764, -32762, -32762, -32762, -32761, -32761, -32760, -32760, -32759, -32759, 
-        -32757, -32756, -32755, -32755, -32752, -32751, -32751, -32748, -32747, -32744, -32743, -32739, 
-        -32737, -32734, -32732, -32729, -32725, -32721, -32716, -32712, -32706, -32701, -32694, -32688, 
-        -32680, -32673, -32664, -32653, -32643, -32631, -32619, -32606, -32590, -32574, -32556, -32536, 
-        -32515, -32493, -32467, -32439, -32408, -32376, -32340, -32300, -32257, -32209, -32158, -32103, 
-        -32040, -31973, -31900, -31819, -31732, -31637, -31532, -31419, -31294, -31158, -31009, -30848, 
-        -30670, -30477, -30265, -30034, -29782, -29508, -29206, -28878, -28520, -28127, -27700, -27231, 
-        -26722, -26163, -25554, -24622, -22789, -19987, -16783, -13586, -10464, -7417, -4427, -1472 
-    };
-
-    // AKWF_rSymSqu_16 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_16[600] PROGMEM = {
-        1692, 5098, 8561, 12120, 15803, 19581, 22988, 25228, 26306, 26958, 27543, 28069, 
-        28543, 28969, 29351, 29695, 30004, 30283, 30533, 30759, 30961, 31143, 31307, 31453, 
-        31587, 31706, 31813, 31909, 31995, 32073, 32143, 32207, 32263, 32313, 32359, 32400, 
-        32438, 32471, 32501, 32528, 32552, 32574, 32593, 32611, 32626, 32640, 32653, 32665, 
-        32675, 32685, 32693, 32701, 32707, 32714, 32719, 32724, 32729, 32733, 32735, 32739, 
-        32742, 32744, 32747, 32748, 32751, 32752, 32755, 32755, 32757, 32759, 32759, 32760, 
-        32761, 32761, 32762, 32762, 32762, 32764, 32764, 32764, 32765, 32765, 32765, 32765, 
-        32765, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 32765, 
-        32765, 32765, 32765, 32765, 32764, 32764, 32764, 32762, 32762, 32762, 32761, 32761, 
-        32760, 32759, 32759, 32757, 32755, 32755, 32752, 32751, 32748, 32747, 32744, 32742, 
-        32739, 32735, 32733, 32729, 32724, 32719, 32714, 32707, 32701, 32693, 32685, 32675, 
-        32665, 32653, 32640, 32626, 32611, 32593, 32574, 32552, 32528, 32501, 32471, 32438, 
-        32400, 32359, 32313, 32263, 32207, 32143, 32073, 31995, 31909, 31813, 31706, 31587, 
-        31453, 31307, 31143, 30961, 30759, 30533, 30283, 30004, 29695, 29351, 28969, 28543, 
-        28069, 27543, 26958, 26306, 25228, 22988, 19581, 15803, 12120, 8561, 5098, 1692, 
-        -1692, -5098, -8561, -12120, -15803, -19581, -22988, -25228, -26306, -26958, -27543, -28069, 
-        -28543, -28969, -29351, -29695, -30004, -30283, -30533, -30759, -30961, -31143, -31307, -31453, 
-        -31587, -31706, -31813, -31909, -31995, -32073, -32143, -32207, -32263, -32313, -32359, -32400, 
-        -32438, -32471, -32501, -32528, -32552, -32574, -32593, -32611, -32626, -32640, -32653, -32665, 
-        -32675, -32685, -32693, -32701, -32707, -32714, -32719, -32724, -32729, -32733, -32735, -32739, 
-        -32742, -32744, -32747, -32748, -32751, -32752, -32755, -32755, -32757, -32759, -32759, -32760, 
-        -32761, -32761, -32762, -32762, -32762, -32764, -32764, -32764, -32765, -32765, -32765, -32765, 
-        -32765, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32765, 
-        -32765, -32765, -32765, -32765, -32764, -32764, -32764, -32762, -32762, -32762, -32761, -32761, 
-        -32760, -32759, -32759, -32757, -32755, -32755, -32752, -32751, -32748, -32747, -32744, -32742, 
-        -32739, -32735, -32733, -32729, -32724, -32719, -32714, -32707, -32701, -32693, -32685, -32675, 
-        -32665, -32653, -32640, -32626, -32611, -32593, -32574, -32552, -32528, -32501, -32471, -32438, 
-        -32400, -32359, -32313, -32263, -32207, -32143, -32073, -31995, -31909, -31813, -31706, -31587, 
-        -31453, -31307, -31143, -30961, -30759, -30533, -30283, -30004, -29695, -29351, -28969, -28543, 
-        -28069, -27543, -26958, -26306, -25228, -22988, -19581, -15803, -12120, -8561, -5098, -1692 
-    };
-
-    // AKWF_rSymSqu_17 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_17[600] PROGMEM = {
-        1972, 5948, 10023, 14259, 18701, 22832, 25586, 26860, 27569, 28194, 28742, 29225, 
-        29650, 30024, 30354, 30644, 30899, 31122, 31320, 31494, 31647, 31781, 31900, 32004, 
-        32096, 32176, 32248, 32309, 32365, 32413, 32456, 32493, 32526, 32554, 32581, 32603, 
-        32622, 32640, 32656, 32669, 32680, 32692, 32701, 32708, 32716, 32721, 32728, 32733, 
-        32737, 32739, 32743, 32747, 32750, 32751, 32753, 32755, 32757, 32759, 32759, 32760, 
-        32761, 32762, 32762, 32764, 32764, 32764, 32765, 32765, 32765, 32765, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32766, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32766, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32765, 32765, 32765, 32765, 32764, 32764, 32764, 32762, 32762, 32761, 
-        32760, 32759, 32759, 32757, 32755, 32753, 32751, 32750, 32747, 32743, 32739, 32737, 
-        32733, 32728, 32721, 32716, 32708, 32701, 32692, 32680, 32669, 32656, 32640, 32622, 
-        32603, 32581, 32554, 32526, 32493, 32456, 32413, 32365, 32309, 32248, 32176, 32096, 
-        32004, 31900, 31781, 31647, 31494, 31320, 31122, 30899, 30644, 30354, 30024, 29650, 
-        29225, 28742, 28194, 27569, 26860, 25586, 22832, 18701, 14259, 10023, 5948, 1972, 
-        -1972, -5948, -10023, -14259, -18701, -22832, -25586, -26860, -27569, -28194, -28742, -29225, 
-        -29650, -30024, -30354, -30644, -30899, -31122, -31320, -31494, -31647, -31781, -31900, -32004, 
-        -32096, -32176, -32248, -32309, -32365, -32413, -32456, -32493, -32526, -32554, -32581, -32603, 
-        -32622, -32640, -32656, -32669, -32680, -32692, -32701, -32708, -32716, -32721, -32728, -32733, 
-        -32737, -32739, -32743, -32747, -32750, -32751, -32753, -32755, -32757, -32759, -32759, -32760, 
-        -32761, -32762, -32762, -32764, -32764, -32764, -32765, -32765, -32765, -32765, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32766, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32766, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32765, -32765, -32765, -32765, -32764, -32764, -32764, -32762, -32762, -32761, 
-        -32760, -32759, -32759, -32757, -32755, -32753, -32751, -32750, -32747, -32743, -32739, -32737, 
-        -32733, -32728, -32721, -32716, -32708, -32701, -32692, -32680, -32669, -32656, -32640, -32622, 
-        -32603, -32581, -32554, -32526, -32493, -32456, -32413, -32365, -32309, -32248, -32176, -32096, 
-        -32004, -31900, -31781, -31647, -31494, -31320, -31122, -30899, -30644, -30354, -30024, -29650, 
-        -29225, -28742, -28194, -27569, -26860, -25586, -22832, -18701, -14259, -10023, -5948, -1972 
-    };
-
-    // AKWF_rSymSqu_18 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_18[600] PROGMEM = {
-        2342, 7085, 11994, 17218, 22235, 25650, 27190, 27987, 28670, 29256, 29757, 30187, 
-        30556, 30872, 31143, 31375, 31573, 31745, 31891, 32015, 32123, 32216, 32294, 32362, 
-        32420, 32470, 32512, 32549, 32580, 32606, 32630, 32649, 32666, 32680, 32693, 32703, 
-        32714, 32721, 32728, 32733, 32738, 32743, 32746, 32750, 32752, 32755, 32756, 32757, 
-        32760, 32760, 32761, 32762, 32764, 32764, 32764, 32765, 32765, 32765, 32766, 32766, 
-        32766, 32766, 32766, 32766, 32766, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32766, 32766, 32766, 32766, 32766, 
-        32766, 32766, 32765, 32765, 32765, 32764, 32764, 32764, 32762, 32761, 32760, 32760, 
-        32757, 32756, 32755, 32752, 32750, 32746, 32743, 32738, 32733, 32728, 32721, 32714, 
-        32703, 32693, 32680, 32666, 32649, 32630, 32606, 32580, 32549, 32512, 32470, 32420, 
-        32362, 32294, 32216, 32123, 32015, 31891, 31745, 31573, 31375, 31143, 30872, 30556, 
-        30187, 29757, 29256, 28670, 27987, 27190, 25650, 22235, 17218, 11994, 7085, 2342, 
-        -2342, -7085, -11994, -17218, -22235, -25650, -27190, -27987, -28670, -29256, -29757, -30187, 
-        -30556, -30872, -31143, -31375, -31573, -31745, -31891, -32015, -32123, -32216, -32294, -32362, 
-        -32420, -32470, -32512, -32549, -32580, -32606, -32630, -32649, -32666, -32680, -32693, -32703, 
-        -32714, -32721, -32728, -32733, -32738, -32743, -32746, -32750, -32752, -32755, -32756, -32757, 
-        -32760, -32760, -32761, -32762, -32764, -32764, -32764, -32765, -32765, -32765, -32766, -32766, 
-        -32766, -32766, -32766, -32766, -32766, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32766, -32766, -32766, -32766, -32766, 
-        -32766, -32766, -32765, -32765, -32765, -32764, -32764, -32764, -32762, -32761, -32760, -32760, 
-        -32757, -32756, -32755, -32752, -32750, -32746, -32743, -32738, -32733, -32728, -32721, -32714, 
-        -32703, -32693, -32680, -32666, -32649, -32630, -32606, -32580, -32549, -32512, -32470, -32420, 
-        -32362, -32294, -32216, -32123, -32015, -31891, -31745, -31573, -31375, -31143, -30872, -30556, 
-        -30187, -29757, -29256, -28670, -27987, -27190, -25650, -22235, -17218, -11994, -7085, -2342 
-    };
-
-    // AKWF_rSymSqu_19 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_19[600] PROGMEM = {
-        2869, 8694, 14906, 21039, 25328, 27249, 28187, 28966, 29613, 30148, 30593, 30963, 
-        31270, 31524, 31736, 31912, 32058, 32177, 32277, 32361, 32430, 32488, 32535, 32575, 
-        32608, 32635, 32657, 32676, 32692, 32705, 32715, 32725, 32732, 32738, 32743, 32747, 
-        32751, 32753, 32756, 32759, 32760, 32761, 32762, 32764, 32764, 32765, 32765, 32765, 
-        32766, 32766, 32766, 32766, 32766, 32766, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32766, 32766, 32766, 32766, 32766, 32766, 
-        32765, 32765, 32765, 32764, 32764, 32762, 32761, 32760, 32759, 32756, 32753, 32751, 
-        32747, 32743, 32738, 32732, 32725, 32715, 32705, 32692, 32676, 32657, 32635, 32608, 
-        32575, 32535, 32488, 32430, 32361, 32277, 32177, 32058, 31912, 31736, 31524, 31270, 
-        30963, 30593, 30148, 29613, 28966, 28187, 27249, 25328, 21039, 14906, 8694, 2869, 
-        -2869, -8694, -14906, -21039, -25328, -27249, -28187, -28966, -29613, -30148, -30593, -30963, 
-        -31270, -31524, -31736, -31912, -32058, -32177, -32277, -32361, -32430, -32488, -32535, -32575, 
-        -32608, -32635, -32657, -32676, -32692, -32705, -32715, -32725, -32732, -32738, -32743, -32747, 
-        -32751, -32753, -32756, -32759, -32760, -32761, -32762, -32764, -32764, -32765, -32765, -32765, 
-        -32766, -32766, -32766, -32766, -32766, -32766, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32766, -32766, -32766, -32766, -32766, -32766, 
-        -32765, -32765, -32765, -32764, -32764, -32762, -32761, -32760, -32759, -32756, -32753, -32751, 
-        -32747, -32743, -32738, -32732, -32725, -32715, -32705, -32692, -32676, -32657, -32635, -32608, 
-        -32575, -32535, -32488, -32430, -32361, -32277, -32177, -32058, -31912, -31736, -31524, -31270, 
-        -30963, -30593, -30148, -29613, -28966, -28187, -27249, -25328, -21039, -14906, -8694, -2869 
-    };
-
-    // AKWF_rSymSqu_20 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_20[600] PROGMEM = {
-        3642, 11273, 18917, 24422, 26926, 28108, 29052, 29804, 30404, 30884, 31265, 31569, 
-        31811, 32005, 32159, 32284, 32381, 32459, 32521, 32571, 32611, 32643, 32669, 32688, 
-        32705, 32717, 32728, 32735, 32742, 32747, 32751, 32755, 32757, 32760, 32761, 32762, 
-        32764, 32764, 32765, 32765, 32766, 32766, 32766, 32766, 32766, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32766, 32766, 32766, 32766, 32766, 32765, 32765, 32764, 32764, 
-        32762, 32761, 32760, 32757, 32755, 32751, 32747, 32742, 32735, 32728, 32717, 32705, 
-        32688, 32669, 32643, 32611, 32571, 32521, 32459, 32381, 32284, 32159, 32005, 31811, 
-        31569, 31265, 30884, 30404, 29804, 29052, 28108, 26926, 24422, 18917, 11273, 3642, 
-        -3642, -11273, -18917, -24422, -26926, -28108, -29052, -29804, -30404, -30884, -31265, -31569, 
-        -31811, -32005, -32159, -32284, -32381, -32459, -32521, -32571, -32611, -32643, -32669, -32688, 
-        -32705, -32717, -32728, -32735, -32742, -32747, -32751, -32755, -32757, -32760, -32761, -32762, 
-        -32764, -32764, -32765, -32765, -32766, -32766, -32766, -32766, -32766, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32766, -32766, -32766, -32766, -32766, -32765, -32765, -32764, -32764, 
-        -32762, -32761, -32760, -32757, -32755, -32751, -32747, -32742, -32735, -32728, -32717, -32705, 
-        -32688, -32669, -32643, -32611, -32571, -32521, -32459, -32381, -32284, -32159, -32005, -31811, 
-        -31569, -31265, -30884, -30404, -29804, -29052, -28108, -26926, -24422, -18917, -11273, -3642 
-    };
-
-    // AKWF_rSymSqu_21 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_21[600] PROGMEM = {
-        5114, 15075, 22463, 25946, 27597, 28848, 29797, 30515, 31059, 31473, 31786, 32023, 
-        32203, 32340, 32443, 32521, 32581, 32626, 32661, 32687, 32706, 32721, 32733, 32741, 
-        32747, 32752, 32756, 32759, 32761, 32762, 32764, 32765, 32765, 32766, 32766, 32766, 
-        32766, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32766, 
-        32766, 32766, 32766, 32765, 32765, 32764, 32762, 32761, 32759, 32756, 32752, 32747, 
-        32741, 32733, 32721, 32706, 32687, 32661, 32626, 32581, 32521, 32443, 32340, 32203, 
-        32023, 31786, 31473, 31059, 30515, 29797, 28848, 27597, 25946, 22463, 15075, 5114, 
-        -5114, -15075, -22463, -25946, -27597, -28848, -29797, -30515, -31059, -31473, -31786, -32023, 
-        -32203, -32340, -32443, -32521, -32581, -32626, -32661, -32687, -32706, -32721, -32733, -32741, 
-        -32747, -32752, -32756, -32759, -32761, -32762, -32764, -32765, -32765, -32766, -32766, -32766, 
-        -32766, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32766, 
-        -32766, -32766, -32766, -32765, -32765, -32764, -32762, -32761, -32759, -32756, -32752, -32747, 
-        -32741, -32733, -32721, -32706, -32687, -32661, -32626, -32581, -32521, -32443, -32340, -32203, 
-        -32023, -31786, -31473, -31059, -30515, -29797, -28848, -27597, -25946, -22463, -15075, -5114 
-    };
-
-    // AKWF_rSymSqu_22 → 600 samples
-    static const int16_t akwf_akwf_bwsqurounded_akwf_rsymsqu_22[600] PROGMEM = {
-        5431, 16324, 24563, 28133, 29482, 30436, 31113, 31593, 31935, 32176, 32348, 32470, 
-        32557, 32617, 32662, 32692, 32715, 32730, 32741, 32748, 32755, 32759, 32761, 32762, 
-        32764, 32765, 32766, 32766, 32766, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 
-        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32766, 32766, 32766, 32765, 32764, 
-        32762, 32761, 32759, 32755, 32748, 32741, 32730, 32715, 32692, 32662, 32617, 32557, 
-        32470, 32348, 32176, 31935, 31593, 31113, 30436, 29482, 28133, 24563, 16324, 5431, 
-        -5431, -16324, -24563, -28133, -29482, -30436, -31113, -31593, -31935, -32176, -32348, -32470, 
-        -32557, -32617, -32662, -32692, -32715, -32730, -32741, -32748, -32755, -32759, -32761, -32762, 
-        -32764, -32765, -32766, -32766, -32766, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, 
-        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32766, -32766, -32766, -32765, -32764, 
-        -32762, -32761, -32759, -32755, -32748, -32741, -32730, -32715, -32692, -32662, -32617, -32557, 
-        -32470, -32348, -32176, -31935, -31593, -31113, -30436, -29482, -28133, -24563, -16324, -5431 
-    };
-
-} // namespace AKWF_BwSqurounded
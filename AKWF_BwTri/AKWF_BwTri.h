@@ -1,44 +1,562 @@
-// Auto‑generated AKWF bank. Do not edit manually.
+// Auto‑generated AKWF bank (compressed, see AKWFCodec.h). Do not edit manually.
 
 #pragma once
 #include <Arduino.h>
 
-#include "AKWF_BwTri_Tables_Part0.h"
-#include "AKWF_BwTri_Tables_Part1.h"
-
 namespace AKWF_BwTri {
+
     constexpr uint16_t count = 25;
-}
 
-// Return a pointer to the n‑th waveform table in this bank.
-// If index is out of range, returns nullptr and length is set to 0.
-inline const int16_t* AKWF_BwTri_get(uint16_t index, uint16_t &length) {
-    switch(index) {
-        case 0: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0001;
-        case 1: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0002;
-        case 2: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0003;
-        case 3: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0004;
-        case 4: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0005;
-        case 5: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0006;
-        case 6: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0007;
-        case 7: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0008;
-        case 8: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0009;
-        case 9: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0010;
-        case 10: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0011;
-        case 11: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0012;
-        case 12: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0013;
-        case 13: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0014;
-        case 14: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0015;
-        case 15: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0016;
-        case 16: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0017;
-        case 17: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0018;
-        case 18: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0019;
-        case 19: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0020;
-        case 20: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0021;
-        case 21: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0022;
-        case 22: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0023;
-        case 23: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0024;
-        case 24: length = 600; return AKWF_BwTri::akwf_akwf_bwtri_akwf_tri_0025;
-        default: length = 0; return nullptr;
-    }
-}
+    // 30000 bytes as int16 → 8295 bytes
+
+    static const uint8_t data[8295] PROGMEM = {
+        0x02, 0x54, 0x3F, 0xFF, 0xD8, 0x14, 0x00, 0xC1, 0x0C, 0x10, 0xC0, 0x14, 0x11, 0x42, 0x1C, 0x21,
+        0xB5, 0xAD, 0x9D, 0x4B, 0x4D, 0x51, 0x6A, 0xD4, 0xEC, 0xAD, 0x2B, 0xA3, 0x2A, 0xD3, 0xB1, 0xA9,
+        0x6A, 0x89, 0x5A, 0x35, 0x55, 0xA2, 0x8D, 0x54, 0xAA, 0xD9, 0xA5, 0x9A, 0x32, 0xB5, 0x95, 0xB3,
+        0x42, 0x94, 0x29, 0x5C, 0xA7, 0x39, 0x70, 0x6E, 0x9C, 0x9D, 0x2A, 0x82, 0xB6, 0x36, 0x6C, 0x52,
+        0xA2, 0x0E, 0x4A, 0x9C, 0x93, 0x83, 0x7D, 0xA9, 0xDB, 0xA2, 0xA1, 0x88, 0x19, 0x19, 0x2B, 0x45,
+        0x8C, 0xE1, 0x9F, 0x97, 0xF8, 0xB5, 0xC7, 0xF3, 0x3F, 0xFA, 0x18, 0x43, 0x64, 0x03, 0x03, 0x1C,
+        0x1C, 0x80, 0x11, 0x00, 0x82, 0x04, 0x2A, 0x18, 0x51, 0x11, 0x50, 0xA9, 0x45, 0x2A, 0x25, 0x14,
+        0xA9, 0x42, 0xAA, 0x11, 0x81, 0x10, 0x50, 0xB0, 0x21, 0x55, 0x08, 0x55, 0x0A, 0x20, 0x94, 0x42,
+        0xA1, 0x4A, 0x15, 0x25, 0x10, 0x8A, 0x21, 0x2A, 0x4A, 0x21, 0x28, 0x88, 0x50, 0x26, 0x64, 0xC3,
+        0x93, 0x24, 0xC9, 0x33, 0x82, 0xE6, 0x63, 0xC9, 0x38, 0x4E, 0x3C, 0x30, 0x72, 0x49, 0x32, 0x61,
+        0x92, 0x70, 0x90, 0x70, 0xCC, 0x73, 0x30, 0x38, 0x64, 0x90, 0x66, 0x19, 0x21, 0xC2, 0x49, 0x90,
+        0xC0, 0x7B, 0x6C, 0xF6, 0xDB, 0x6D, 0xB6, 0x19, 0x8C, 0xE3, 0x92, 0x13, 0x09, 0x20, 0xE3, 0x92,
+        0x43, 0x1C, 0xC0, 0xC8, 0x06, 0xCF, 0x66, 0xCF, 0x6C, 0x7A, 0x1E, 0x12, 0x07, 0x07, 0x8F, 0x13,
+        0x88, 0x78, 0xF3, 0xD6, 0xDB, 0x33, 0x61, 0x91, 0xC3, 0x2F, 0x89, 0x21, 0x80, 0xC0, 0x80, 0x06,
+        0x0A, 0x28, 0x38, 0xA0, 0xE2, 0x81, 0x83, 0x3D, 0x13, 0xFF, 0x94, 0xFE, 0xB2, 0xC4, 0xFF, 0x87,
+        0xBE, 0x55, 0x52, 0x9A, 0x4C, 0xA2, 0x0A, 0x26, 0xA3, 0x4F, 0x4B, 0x76, 0xDA, 0xDE, 0x9A, 0x8D,
+        0xE9, 0xA6, 0xE9, 0xAE, 0x9E, 0xCD, 0x47, 0xB3, 0x6D, 0x6D, 0xAE, 0xAE, 0xA8, 0xEB, 0x5D, 0x2D,
+        0xB5, 0x6D, 0xA0, 0xEB, 0x69, 0x6D, 0x02, 0x5F, 0xFF, 0x9C, 0xFC, 0x42, 0xD4, 0x0C, 0xC1, 0x50,
+        0x14, 0x62, 0x00, 0x10, 0x01, 0x0B, 0x0E, 0x95, 0x5F, 0x46, 0xB3, 0xEB, 0x7E, 0x33, 0x58, 0x2B,
+        0xD3, 0x1C, 0x5C, 0x01, 0x8B, 0xE3, 0x35, 0x59, 0x2A, 0x34, 0xC2, 0x9D, 0x67, 0x0D, 0xD3, 0x4C,
+        0x82, 0x73, 0xC7, 0x9F, 0x1D, 0xD3, 0x00, 0xEF, 0xAE, 0x49, 0x12, 0x39, 0xF1, 0xEF, 0x57, 0x31,
+        0x61, 0xB6, 0x51, 0xDF, 0x1D, 0xA1, 0xCA, 0x13, 0x94, 0x39, 0xAB, 0x2C, 0xE3, 0xB0, 0x73, 0x5E,
+        0xF8, 0xE5, 0xB3, 0x6D, 0xA1, 0x4A, 0x04, 0x8C, 0xA3, 0x0A, 0x42, 0x70, 0x97, 0x3F, 0xFF, 0x1F,
+        0xF2, 0x9F, 0xF3, 0xEE, 0x77, 0x00, 0x76, 0x71, 0x35, 0x17, 0x8B, 0x1E, 0xF0, 0x5C, 0xDA, 0xAE,
+        0x31, 0x88, 0xBC, 0xCA, 0xE2, 0x67, 0x30, 0xC6, 0x9A, 0xA5, 0xDA, 0x2E, 0xED, 0x8A, 0x29, 0x5B,
+        0x32, 0xD8, 0xE7, 0x5E, 0xF5, 0x72, 0xC0, 0x38, 0x91, 0xBC, 0x22, 0xB4, 0xDF, 0x2A, 0x90, 0x3A,
+        0x29, 0x26, 0x63, 0x38, 0xCD, 0x5D, 0x4D, 0x48, 0x44, 0x6E, 0x03, 0x85, 0xC1, 0xF9, 0xEF, 0x97,
+        0xC2, 0x9C, 0x15, 0x57, 0xEB, 0x35, 0x8C, 0xF4, 0x21, 0x51, 0xA1, 0x41, 0x11, 0x28, 0xBB, 0x1D,
+        0x93, 0x23, 0xE1, 0x24, 0x55, 0x54, 0x66, 0x91, 0x78, 0x65, 0x96, 0x55, 0xB4, 0xED, 0x0B, 0x4A,
+        0x63, 0xB8, 0xC9, 0x2C, 0xEF, 0xAF, 0x35, 0x64, 0x0F, 0x73, 0x4A, 0xB5, 0x9A, 0x17, 0x78, 0x3D,
+        0xCD, 0x86, 0xC4, 0xB8, 0xB2, 0x85, 0x8D, 0xD0, 0x29, 0xE0, 0xBC, 0x5F, 0x1C, 0xFA, 0xC9, 0x8E,
+        0x17, 0xC2, 0x34, 0x8C, 0x92, 0x39, 0x4E, 0x40, 0x10, 0x29, 0xD0, 0x50, 0xA0, 0xF1, 0x7A, 0x43,
+        0x40, 0x16, 0x10, 0xE1, 0xEA, 0x7A, 0x3A, 0x9E, 0x81, 0xF5, 0x25, 0x88, 0x85, 0x88, 0x88, 0xD4,
+        0xF8, 0x7A, 0x88, 0x84, 0x50, 0x10, 0x24, 0x18, 0x0C, 0x04, 0xDF, 0xFA, 0x3F, 0xD9, 0xD9, 0x91,
+        0xC8, 0x21, 0x80, 0x78, 0x9D, 0x1E, 0x15, 0x62, 0x31, 0x1C, 0x14, 0x61, 0x78, 0x85, 0xC6, 0x07,
+        0x51, 0x5C, 0x0D, 0x22, 0xE0, 0x70, 0x38, 0x15, 0x58, 0x85, 0x88, 0x18, 0xE0, 0xB7, 0xE8, 0xE0,
+        0x52, 0xA3, 0xA2, 0xB8, 0xCF, 0x89, 0x2C, 0x1A, 0x89, 0xEA, 0xF0, 0x9E, 0x89, 0xC3, 0xA3, 0x05,
+        0xB4, 0xF0, 0xAD, 0x1E, 0x51, 0x60, 0x22, 0x8D, 0x0B, 0x34, 0x5E, 0xB9, 0xA8, 0xDE, 0xB7, 0x8C,
+        0xEB, 0x94, 0x51, 0xBC, 0x5C, 0xD5, 0xB1, 0x2C, 0x5B, 0x2C, 0xDD, 0x55, 0x46, 0x37, 0x97, 0x58,
+        0x71, 0x1D, 0x71, 0xBF, 0xDD, 0x21, 0x15, 0xD9, 0x11, 0x80, 0x1E, 0x60, 0x03, 0x6F, 0xFE, 0x1B,
+        0xFF, 0xA7, 0x68, 0xD5, 0x51, 0xB2, 0xC2, 0xC6, 0x0B, 0x24, 0x44, 0x90, 0x00, 0x24, 0x8E, 0x78,
+        0x2D, 0x9C, 0xA4, 0xF0, 0x27, 0xA2, 0xAC, 0xB5, 0x3D, 0x33, 0x38, 0x63, 0x07, 0x18, 0xC2, 0x6F,
+        0x6D, 0xE4, 0x27, 0x8E, 0x55, 0x04, 0xAE, 0x57, 0x44, 0x8D, 0x27, 0x25, 0x91, 0xCE, 0x8A, 0x89,
+        0x1B, 0x2B, 0x02, 0xD0, 0x23, 0x63, 0x31, 0xA4, 0x49, 0x92, 0xB9, 0x45, 0x01, 0xA7, 0x69, 0xE0,
+        0x79, 0xE9, 0x8E, 0xDB, 0xE5, 0x14, 0x39, 0x5F, 0x09, 0xA0, 0x19, 0xCB, 0x1C, 0xA6, 0x40, 0x91,
+        0x94, 0xE9, 0x58, 0x0A, 0xD0, 0xF8, 0xF4, 0xE2, 0xD5, 0x49, 0xFF, 0x2B, 0xFB, 0x4D, 0x05, 0xC9,
+        0xCC, 0x04, 0x80, 0x8D, 0x1A, 0xB9, 0x6B, 0xC3, 0x5B, 0x4E, 0x04, 0x44, 0xEB, 0x7C, 0x58, 0xAD,
+        0xE8, 0xDF, 0x1B, 0xC1, 0x4A, 0x4E, 0x37, 0xEB, 0xBD, 0x5C, 0x10, 0x98, 0x28, 0x6A, 0x68, 0xAC,
+        0xFA, 0xFB, 0xF8, 0xB3, 0x59, 0xC1, 0x95, 0x72, 0xAA, 0x34, 0xE4, 0x60, 0x34, 0xE3, 0xE1, 0xC6,
+        0xC5, 0x78, 0xCF, 0x1B, 0xF1, 0xEF, 0xA3, 0x7A, 0x98, 0x69, 0x19, 0x5F, 0x85, 0x46, 0x0B, 0x09,
+        0xDA, 0x21, 0x05, 0x25, 0x47, 0x35, 0x90, 0xD9, 0x4A, 0x19, 0x0C, 0x51, 0xC4, 0x54, 0xCD, 0x39,
+        0xED, 0x74, 0x61, 0x7A, 0x57, 0x6E, 0x3A, 0x38, 0x10, 0x91, 0x46, 0x70, 0x51, 0x7A, 0xB4, 0x80,
+        0xD2, 0x82, 0xCE, 0xB7, 0x53, 0x0D, 0x82, 0x7B, 0xD7, 0x2A, 0x48, 0x15, 0xCF, 0x13, 0x38, 0xDF,
+        0x53, 0xC6, 0x75, 0xA6, 0x82, 0x72, 0x5C, 0x15, 0x3F, 0x36, 0x1C, 0x51, 0xD0, 0xB5, 0x2E, 0xA2,
+        0xFB, 0xF8, 0xB1, 0x89, 0x15, 0x21, 0x2C, 0xD4, 0x6C, 0xA0, 0x2F, 0x3F, 0x1B, 0x01, 0xA2, 0xDF,
+        0x8F, 0xCF, 0xC1, 0xCC, 0x65, 0x7A, 0x46, 0x51, 0x1A, 0x56, 0x01, 0x3D, 0xB8, 0x9E, 0xD7, 0xA4,
+        0xF0, 0xC7, 0x4D, 0x72, 0x1A, 0xED, 0x8D, 0x23, 0x81, 0xDE, 0x00, 0x40, 0x2D, 0x1C, 0xB1, 0xC1,
+        0xCA, 0x97, 0xE0, 0x71, 0xD0, 0xF8, 0xEE, 0xB5, 0x94, 0xF2, 0x5A, 0x47, 0x09, 0xD0, 0xEA, 0x18,
+        0x6F, 0x92, 0x88, 0xE5, 0xC7, 0x67, 0x18, 0x4E, 0xC7, 0x3A, 0x44, 0x72, 0xC6, 0x09, 0x1C, 0x33,
+        0xD2, 0xB2, 0x76, 0x11, 0x80, 0x66, 0xE4, 0xB3, 0x3B, 0xF9, 0xD2, 0x7D, 0x77, 0xF1, 0xF3, 0xEA,
+        0xC2, 0x08, 0xBE, 0x32, 0x4B, 0x89, 0xCF, 0xC7, 0x23, 0x0C, 0xC3, 0x89, 0xC3, 0x25, 0x04, 0x1A,
+        0x6E, 0x83, 0x47, 0x5E, 0xFD, 0x59, 0xB4, 0x65, 0x3C, 0xB8, 0xF6, 0xD5, 0x9A, 0x74, 0xBF, 0x0D,
+        0x6C, 0x75, 0xC2, 0xF4, 0x52, 0x14, 0x54, 0x08, 0xED, 0xAC, 0x18, 0xB2, 0x35, 0x98, 0x05, 0x0B,
+        0xF1, 0xCC, 0x08, 0xCA, 0x31, 0x6C, 0x7D, 0x18, 0xF9, 0x3D, 0xA0, 0x03, 0x6E, 0xEB, 0xCB, 0x7F,
+        0xE0, 0xF2, 0x91, 0xAF, 0x97, 0xAC, 0x3A, 0x60, 0xB9, 0xC3, 0x29, 0x0D, 0xA0, 0x3C, 0xF8, 0x46,
+        0x12, 0xBD, 0xA1, 0x9F, 0x2B, 0xB2, 0x2A, 0x54, 0xA2, 0xBF, 0x3E, 0xBB, 0x24, 0xC8, 0x9B, 0x89,
+        0xBC, 0x1D, 0xD0, 0xAB, 0x68, 0x8B, 0x5F, 0x86, 0xB0, 0x21, 0x3A, 0x15, 0x8C, 0x34, 0x62, 0xA6,
+        0x8A, 0x51, 0x7F, 0x07, 0xBE, 0xD1, 0x65, 0xCB, 0x39, 0x21, 0x92, 0x3D, 0x27, 0x22, 0x60, 0x40,
+        0xCF, 0x5B, 0xA4, 0xDF, 0x5E, 0xFC, 0x72, 0x74, 0x55, 0xC3, 0x18, 0x08, 0x09, 0x2C, 0x27, 0x6D,
+        0x78, 0x1E, 0xF4, 0x74, 0xCD, 0xB1, 0xF6, 0xD0, 0xB9, 0x67, 0x85, 0xD1, 0xC8, 0x82, 0x82, 0x9F,
+        0x1D, 0xEA, 0x45, 0x6F, 0x56, 0x58, 0x93, 0x04, 0x46, 0x78, 0xE7, 0x46, 0x68, 0xC9, 0x71, 0xDF,
+        0x56, 0xA7, 0x05, 0x84, 0x1D, 0x5D, 0x1B, 0xD2, 0x70, 0x76, 0x07, 0x80, 0xAD, 0x2F, 0x67, 0x33,
+        0xCB, 0x7B, 0x15, 0x72, 0xBC, 0x9E, 0x99, 0xF4, 0xE7, 0x80, 0xA9, 0xA2, 0x3A, 0x01, 0x04, 0x72,
+        0xD7, 0x6B, 0xC9, 0x41, 0x0C, 0xA7, 0x44, 0xCF, 0x48, 0xA0, 0x84, 0x35, 0xED, 0xAD, 0x26, 0x79,
+        0x63, 0x23, 0x44, 0xC7, 0x69, 0x84, 0x2B, 0xB7, 0x1E, 0x18, 0x9C, 0x8A, 0x72, 0x6C, 0x70, 0x9E,
+        0x58, 0xA4, 0xAB, 0x69, 0xA1, 0x62, 0xCE, 0x2F, 0x59, 0x88, 0x67, 0x17, 0xAC, 0x02, 0xBE, 0x32,
+        0xEA, 0x54, 0xC6, 0x75, 0xF9, 0xD3, 0x99, 0x20, 0x18, 0xDF, 0xEB, 0xFD, 0xFD, 0x66, 0x82, 0xA7,
+        0xAC, 0x1C, 0x76, 0x9C, 0x12, 0x55, 0xD8, 0x46, 0x40, 0xC6, 0xCC, 0x66, 0x7A, 0x73, 0xF0, 0xCC,
+        0xA4, 0xA6, 0xC6, 0x4F, 0x4A, 0x95, 0x38, 0xDD, 0x46, 0xF1, 0x98, 0x12, 0x78, 0xF7, 0x83, 0x86,
+        0xFC, 0x2E, 0xD1, 0x90, 0xC6, 0x45, 0x8E, 0xD9, 0xE5, 0x73, 0x92, 0xB3, 0xC0, 0x57, 0x0D, 0x78,
+        0x6F, 0xC3, 0x3C, 0x27, 0x62, 0xC8, 0xA7, 0x45, 0x4E, 0x01, 0xAC, 0xFC, 0x79, 0xFA, 0x38, 0xE4,
+        0x57, 0xF1, 0x3B, 0xC2, 0xFC, 0xAB, 0x42, 0x00, 0x23, 0x09, 0xE9, 0x9C, 0x84, 0x0E, 0x91, 0x44,
+        0x9E, 0xDC, 0x76, 0x3A, 0xC1, 0x33, 0xE5, 0x51, 0xC3, 0x1B, 0x4E, 0xD1, 0x42, 0x52, 0xD5, 0xC2,
+        0xBE, 0xB7, 0x86, 0x2A, 0x60, 0x8C, 0x17, 0x7E, 0xB2, 0xA2, 0xF0, 0xEB, 0x3A, 0x1B, 0xEA, 0x41,
+        0x28, 0xEF, 0xD3, 0x9A, 0x25, 0x22, 0x52, 0x66, 0xCF, 0x2A, 0xD9, 0xD1, 0x60, 0xA8, 0xF9, 0x71,
+        0xDA, 0x68, 0x84, 0xB2, 0x1A, 0x25, 0x60, 0x9F, 0x44, 0xF1, 0x47, 0x54, 0x6A, 0x38, 0xC9, 0x48,
+        0x50, 0x56, 0xD8, 0xE1, 0x9F, 0x2C, 0x42, 0x06, 0x15, 0xC1, 0x4E, 0x11, 0x66, 0xC7, 0x28, 0x90,
+        0xCB, 0x15, 0x59, 0x75, 0x13, 0x81, 0x47, 0x13, 0x74, 0x02, 0x4F, 0xEE, 0xFF, 0xFF, 0xFB, 0x82,
+        0x41, 0x88, 0x24, 0x18, 0x82, 0x41, 0x88, 0x24, 0x1A, 0x47, 0x2C, 0x72, 0xC7, 0x2C, 0x47, 0x2C,
+        0x72, 0xC7, 0x2C, 0x72, 0xC4, 0x72, 0xC7, 0x2C, 0x72, 0xC7, 0x2C, 0x47, 0x2C, 0x72, 0xC7, 0x2C,
+        0x72, 0xC4, 0x72, 0xC7, 0x2C, 0x72, 0xC7, 0x2C, 0x47, 0x2C, 0x4C, 0xB1, 0xCB, 0x1C, 0xB0, 0x5C,
+        0xB1, 0xC5, 0x32, 0xC7, 0x2C, 0x50, 0x42, 0x00, 0x00, 0x42, 0x00, 0x00, 0x78, 0x3F, 0x4F, 0x76,
+        0x4D, 0x17, 0xDF, 0x3C, 0x77, 0xAD, 0x71, 0xAC, 0xEF, 0x79, 0xC6, 0xEF, 0x15, 0x89, 0x4E, 0x66,
+        0x5E, 0x5C, 0xCC, 0xCC, 0xB9, 0x6C, 0x76, 0xE9, 0xD7, 0x4D, 0x74, 0xD2, 0xA3, 0x55, 0xB3, 0x4A,
+        0x1B, 0x9B, 0x28, 0x1C, 0x3B, 0x38, 0x4C, 0x34, 0x96, 0x4A, 0x4B, 0x07, 0x28, 0x1A, 0x00, 0x77,
+        0x88, 0x31, 0xDE, 0x46, 0x46, 0x81, 0xAD, 0xDE, 0xB4, 0x69, 0xA1, 0x88, 0x44, 0x23, 0x2F, 0x2C,
+        0xA3, 0x8C, 0xB8, 0xCB, 0x8C, 0xB8, 0x30, 0x6E, 0x32, 0xE3, 0x2E, 0x32, 0xE3, 0x06, 0xE3, 0x2E,
+        0x32, 0xE3, 0x2E, 0x30, 0x6E, 0x32, 0xE3, 0x2E, 0x32, 0xE3, 0x06, 0xE3, 0x2E, 0x32, 0xE3, 0x2E,
+        0x30, 0x6E, 0x32, 0xE3, 0x2E, 0x32, 0xE3, 0x04, 0xB8, 0xCB, 0x8C, 0xB8, 0xCB, 0x88, 0xCB, 0x21,
+        0x71, 0x97, 0x18, 0x82, 0x84, 0x08, 0x00, 0x05, 0xC2, 0xFA, 0x9B, 0xD2, 0xA9, 0x40, 0x80, 0x93,
+        0x07, 0x1C, 0x79, 0x5A, 0x98, 0x61, 0x49, 0x61, 0x09, 0x34, 0x9A, 0x4C, 0xC5, 0x1A, 0x8A, 0xAA,
+        0xAA, 0x8A, 0x88, 0xA8, 0xA0, 0x58, 0x54, 0x29, 0x50, 0xA1, 0x0A, 0x12, 0x43, 0x8F, 0x0C, 0x0E,
+        0x5E, 0x38, 0x18, 0x01, 0xE9, 0xE1, 0x97, 0x97, 0x82, 0xBC, 0xBD, 0x37, 0x79, 0x60, 0x00, 0x7B,
+        0x8D, 0x1E, 0x0E, 0x62, 0x62, 0xCB, 0x41, 0xEE, 0xD6, 0x2C, 0xB5, 0x80, 0xB1, 0x6B, 0xC0, 0x03,
+        0x6E, 0x1B, 0xE6, 0xBF, 0xD2, 0x81, 0x08, 0x0C, 0x30, 0x70, 0xC0, 0x42, 0x05, 0x04, 0x08, 0x08,
+        0x02, 0x45, 0x3C, 0x5D, 0x5E, 0xA4, 0x56, 0x75, 0x20, 0x72, 0xC2, 0x58, 0x11, 0xBE, 0x6E, 0x03,
+        0x64, 0x49, 0x70, 0x65, 0xC1, 0x47, 0xCE, 0xE5, 0xE5, 0x83, 0x2F, 0x16, 0x23, 0x06, 0x4A, 0xF9,
+        0xA6, 0x29, 0x89, 0x03, 0x0D, 0x29, 0xA2, 0x0D, 0x5D, 0x4E, 0x87, 0xA6, 0x2E, 0x2E, 0x16, 0x4B,
+        0x89, 0x8B, 0x3C, 0xA2, 0xC6, 0x83, 0xFD, 0x7F, 0x5F, 0xE9, 0xD8, 0xE8, 0x05, 0x87, 0xAB, 0xA2,
+        0x11, 0x4F, 0x13, 0x08, 0x80, 0xCB, 0x3B, 0xF7, 0x6B, 0x00, 0xB6, 0xEC, 0x6A, 0xDA, 0xBF, 0x13,
+        0x7A, 0xB8, 0x70, 0x42, 0x31, 0x78, 0x9A, 0x1D, 0xC1, 0x0C, 0xB2, 0xE0, 0xC6, 0x07, 0x78, 0x9A,
+        0x64, 0xD0, 0x61, 0x72, 0xE0, 0x91, 0x71, 0x20, 0xAE, 0x5C, 0x65, 0x39, 0xA4, 0x96, 0x08, 0xE5,
+        0x8C, 0x9B, 0x39, 0xEF, 0x06, 0x11, 0x4E, 0x08, 0x44, 0xD6, 0x78, 0x9A, 0xA4, 0x37, 0x37, 0xCD,
+        0x97, 0x8B, 0x06, 0x38, 0x57, 0x89, 0xC6, 0x68, 0x4E, 0xB3, 0x41, 0xC1, 0x02, 0xE2, 0x0C, 0xCE,
+        0xF2, 0x98, 0xB0, 0x47, 0x29, 0x1C, 0xA4, 0x9D, 0xF2, 0xE0, 0xEE, 0x24, 0x73, 0x64, 0x62, 0x44,
+        0x5C, 0x9D, 0xE1, 0x64, 0x2C, 0x25, 0xC2, 0x26, 0xA5, 0x05, 0x38, 0x9A, 0xCE, 0x03, 0x43, 0x2C,
+        0x94, 0xC5, 0xCB, 0x26, 0xF9, 0xEA, 0x28, 0xA4, 0x18, 0xBB, 0xB9, 0xBA, 0xED, 0x22, 0xC0, 0x72,
+        0x25, 0x03, 0xB0, 0x63, 0x9D, 0xE5, 0x60, 0x08, 0x34, 0xF7, 0xDE, 0xB4, 0x35, 0x0E, 0x20, 0xC8,
+        0xB2, 0x6E, 0x67, 0xBE, 0x13, 0x86, 0x81, 0x4F, 0x17, 0x53, 0x4C, 0x21, 0x0B, 0x8E, 0x52, 0x31,
+        0xCA, 0x01, 0x96, 0x4C, 0xB2, 0x7B, 0x87, 0x29, 0x06, 0x4B, 0x06, 0x4B, 0x83, 0x63, 0x86, 0xF0,
+        0x5C, 0x49, 0x70, 0x58, 0xBC, 0x77, 0xE6, 0x91, 0x8E, 0x52, 0x40, 0xA5, 0x3A, 0xD8, 0x02, 0x4E,
+        0x6F, 0xFF, 0xFF, 0x88, 0xE3, 0x0A, 0x42, 0x50, 0x94, 0x25, 0x08, 0x42, 0x50, 0xDD, 0x2D, 0x59,
+        0x8D, 0xB0, 0xC9, 0x8F, 0x38, 0x61, 0xE1, 0xE1, 0xCC, 0x85, 0x54, 0x2A, 0x22, 0x22, 0x92, 0xA8,
+        0x58, 0x23, 0xC9, 0xC3, 0x84, 0xE1, 0x30, 0x32, 0x40, 0xBD, 0x63, 0xDC, 0xDD, 0xA3, 0x07, 0xC9,
+        0x4E, 0x55, 0xD2, 0x14, 0xD2, 0x94, 0x69, 0x50, 0xD0, 0x2E, 0xDC, 0x95, 0x9C, 0x90, 0x83, 0x00,
+        0x00, 0x00, 0x00, 0x1E, 0x9F, 0xDB, 0x1A, 0x1A, 0xB9, 0x52, 0x39, 0x67, 0xAE, 0x9B, 0x69, 0xA6,
+        0xD9, 0xEB, 0x8E, 0x79, 0x61, 0x9C, 0xF1, 0xBE, 0x73, 0xCE, 0x38, 0xBD, 0x66, 0xF3, 0x38, 0xBA,
+        0x8E, 0xEB, 0xEA, 0xDB, 0xA3, 0x6A, 0xD1, 0x9B, 0x4A, 0xE9, 0xA7, 0x67, 0x5B, 0xA2, 0x6E, 0xBD,
+        0x3A, 0xED, 0xB5, 0xF6, 0x68, 0xDA, 0xEC, 0xE8, 0xAA, 0xC2, 0xE0, 0xD9, 0x8E, 0x1C, 0x27, 0x0F,
+        0x26, 0x72, 0x16, 0x2A, 0xA9, 0x63, 0x4B, 0x58, 0x8C, 0x47, 0x11, 0xA2, 0xA8, 0xE2, 0xAA, 0xB5,
+        0x51, 0x8C, 0x2E, 0x16, 0x20, 0x96, 0x95, 0x2A, 0x54, 0x92, 0xA3, 0x08, 0x06, 0xB6, 0x91, 0x55,
+        0x76, 0x1D, 0xD2, 0x9D, 0x3A, 0x6D, 0x77, 0x4D, 0x1B, 0x6D, 0xD5, 0xDA, 0xF6, 0x6B, 0xA0, 0xE8,
+        0xE8, 0xD0, 0xAB, 0x2C, 0x40, 0xEF, 0x2F, 0x58, 0xBF, 0x30, 0x36, 0x79, 0xB6, 0xF6, 0x6C, 0xFC,
+        0x0F, 0x3C, 0xDE, 0x7B, 0x1F, 0x8D, 0xE0, 0xBC, 0xCD, 0xA7, 0x9B, 0xBC, 0x20, 0x00, 0x00, 0x03,
+        0xD5, 0xFB, 0xA4, 0x3B, 0x99, 0x34, 0x93, 0x51, 0x62, 0x55, 0x75, 0x55, 0x5D, 0x45, 0x92, 0x51,
+        0x34, 0x54, 0x45, 0x04, 0x8C, 0x3D, 0x25, 0x94, 0x2D, 0x48, 0x51, 0x9A, 0x4C, 0xCC, 0x52, 0x19,
+        0x33, 0x92, 0x4C, 0xC9, 0x31, 0xE6, 0x05, 0x0A, 0x85, 0x0C, 0x1C, 0x28, 0xA1, 0x54, 0x8B, 0x03,
+        0x0A, 0xA2, 0x21, 0x68, 0xD4, 0x42, 0xA1, 0x7C, 0x24, 0x92, 0x26, 0x5C, 0x68, 0x23, 0xA3, 0xA7,
+        0x5B, 0xAF, 0x77, 0x74, 0x8D, 0xE4, 0xE6, 0xDD, 0xBD, 0xBC, 0xCB, 0xDC, 0x94, 0xCE, 0x65, 0xDB,
+        0xC8, 0x02, 0x61, 0xDF, 0xFE, 0xD3, 0xA7, 0x8C, 0x3E, 0x54, 0xB0, 0x84, 0xA3, 0x80, 0x15, 0x00,
+        0xC9, 0xB9, 0x55, 0x80, 0x45, 0x38, 0x88, 0x57, 0x30, 0xA0, 0xB3, 0xF8, 0x89, 0xEA, 0xCE, 0xE6,
+        0x74, 0xD6, 0xEE, 0x01, 0x9E, 0x4F, 0xD4, 0xC1, 0x76, 0xB4, 0xB7, 0xF0, 0xA5, 0xBA, 0xE2, 0x9A,
+        0x6A, 0xD5, 0xEB, 0x32, 0xF7, 0xB5, 0x49, 0xE2, 0x6D, 0x9B, 0x69, 0x9C, 0x5C, 0x80, 0xA9, 0xAA,
+        0xCA, 0x6C, 0xD2, 0x81, 0x24, 0xD6, 0x99, 0x04, 0x22, 0xAC, 0xC4, 0xA5, 0xBA, 0xA4, 0x60, 0x59,
+        0x3F, 0x1B, 0x35, 0xA0, 0xD1, 0xA7, 0xB4, 0x4E, 0xCE, 0x23, 0x19, 0xAA, 0x66, 0x77, 0x2C, 0x6C,
+        0x6B, 0x72, 0xF6, 0x8F, 0x4B, 0xC9, 0xE1, 0x2F, 0x82, 0xE7, 0x29, 0x75, 0xE9, 0x61, 0x8F, 0x7A,
+        0x1D, 0x5C, 0x60, 0xEE, 0x91, 0x3A, 0xE9, 0x14, 0x93, 0x4D, 0xBA, 0xA9, 0x86, 0x21, 0x94, 0x21,
+        0x9E, 0xA8, 0x34, 0xD3, 0xEA, 0xE5, 0x55, 0x6D, 0x2F, 0x77, 0x4A, 0xEC, 0x24, 0xE0, 0x5D, 0x49,
+        0x48, 0x65, 0xEB, 0x61, 0xAA, 0xAD, 0x0A, 0xFE, 0x44, 0xB9, 0xB9, 0x50, 0x61, 0xAC, 0xB2, 0xE9,
+        0xC8, 0x86, 0xA2, 0xD2, 0xAF, 0x68, 0x7E, 0xAC, 0xEA, 0x5A, 0x6E, 0x67, 0x11, 0xD9, 0x7B, 0x85,
+        0xBE, 0xA7, 0xDE, 0x07, 0x0E, 0xD4, 0xB6, 0x71, 0x04, 0xC3, 0x98, 0x5C, 0x1A, 0x87, 0xBE, 0xA7,
+        0x4A, 0xCD, 0x52, 0x21, 0x35, 0xED, 0x1D, 0x97, 0x21, 0x06, 0x51, 0x9D, 0x3E, 0x41, 0x40, 0x78,
+        0x59, 0x1A, 0x07, 0xB3, 0x49, 0x19, 0x02, 0xE9, 0x57, 0xFE, 0x9B, 0x7F, 0xF7, 0xBF, 0x46, 0x5C,
+        0x03, 0xD8, 0x7D, 0x0A, 0x97, 0x25, 0x2A, 0x9C, 0xB7, 0x0B, 0x4D, 0x59, 0xDC, 0x38, 0xC2, 0x0B,
+        0x17, 0xDC, 0xFE, 0x2A, 0x99, 0x12, 0x1E, 0xCF, 0xFB, 0x1C, 0xFC, 0x32, 0x14, 0x6C, 0x87, 0x9B,
+        0x75, 0x28, 0x49, 0xA5, 0xC0, 0x9E, 0xEC, 0x9E, 0x3C, 0xD6, 0x75, 0xEA, 0x9F, 0x23, 0xC5, 0x02,
+        0x69, 0xFE, 0x2F, 0xAD, 0x9B, 0x27, 0x7E, 0x84, 0x3D, 0x12, 0x2C, 0x78, 0x98, 0x97, 0xF1, 0x42,
+        0x05, 0x43, 0xD0, 0x55, 0xB7, 0xC0, 0x93, 0xDB, 0xF6, 0x6B, 0x61, 0xF3, 0xCE, 0x4D, 0xC0, 0x0C,
+        0x3A, 0x4A, 0x69, 0x07, 0x67, 0xB2, 0x43, 0x57, 0xB8, 0x40, 0xB8, 0x2E, 0x20, 0xEE, 0x10, 0xAA,
+        0xA7, 0x59, 0x53, 0x79, 0x5A, 0x74, 0x9B, 0xC4, 0x5C, 0x3D, 0x48, 0x68, 0xE4, 0x32, 0x13, 0x7C,
+        0x2C, 0x13, 0x27, 0x22, 0xAE, 0x22, 0x6A, 0x10, 0x98, 0x9D, 0x5D, 0x27, 0x26, 0xCE, 0x58, 0xF6,
+        0x70, 0x17, 0x2D, 0x68, 0xCB, 0x3E, 0xB1, 0x98, 0x35, 0x2E, 0x65, 0xE0, 0x11, 0x44, 0x2C, 0xC8,
+        0xE9, 0xE9, 0x04, 0xBA, 0x35, 0x0A, 0xEF, 0x78, 0xF8, 0x3A, 0x0C, 0x83, 0xD4, 0x76, 0x76, 0x49,
+        0x14, 0x9D, 0x53, 0x69, 0x0D, 0x14, 0x6E, 0x56, 0x5B, 0xF9, 0x07, 0xC5, 0xDE, 0xA2, 0x9E, 0x75,
+        0x74, 0x25, 0x51, 0x36, 0x3C, 0x08, 0x8F, 0x12, 0xDB, 0xE0, 0xE1, 0x07, 0x93, 0x85, 0x42, 0x90,
+        0x3C, 0x58, 0xD7, 0x34, 0x40, 0xD0, 0x9E, 0xAE, 0x62, 0x74, 0xE0, 0x67, 0x2E, 0xCB, 0x13, 0x2F,
+        0xD4, 0x58, 0xF7, 0xF6, 0xB3, 0x47, 0xD0, 0x3D, 0x1F, 0x23, 0xF2, 0xD6, 0x56, 0x76, 0x1E, 0x0F,
+        0xF8, 0x1B, 0x65, 0xC1, 0xC0, 0x96, 0x5E, 0xA4, 0xB2, 0x62, 0x38, 0xAA, 0xD9, 0xF5, 0x2F, 0x89,
+        0x51, 0x10, 0x60, 0x00, 0x1B, 0xD7, 0xB5, 0x65, 0x5C, 0x59, 0xA1, 0x6A, 0x51, 0x0F, 0x4B, 0x1D,
+        0x3E, 0x10, 0xB9, 0xB8, 0x97, 0x3B, 0xAF, 0x76, 0x9B, 0xC7, 0xBB, 0xCB, 0xFF, 0xC8, 0x78, 0xEF,
+        0xA7, 0x83, 0x8B, 0x92, 0x2E, 0x00, 0x71, 0xA4, 0x62, 0x16, 0x31, 0xF0, 0x90, 0x82, 0xD9, 0xB4,
+        0x2C, 0xC7, 0x4D, 0x27, 0x81, 0xCB, 0x03, 0xBF, 0xD8, 0x14, 0x5C, 0x71, 0xA6, 0x2B, 0x27, 0x51,
+        0x59, 0x74, 0x87, 0x19, 0x76, 0x0E, 0x93, 0xB0, 0x9F, 0x9D, 0xDE, 0xAA, 0x7A, 0x77, 0x41, 0x3C,
+        0x77, 0x0C, 0xEA, 0xDA, 0xAE, 0x25, 0x47, 0x07, 0x12, 0x49, 0x0C, 0x27, 0x0C, 0x02, 0x4D, 0x9F,
+        0xFF, 0xFF, 0xD0, 0x11, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x83, 0x00, 0x07, 0xB9, 0x60, 0x7B,
+        0x80, 0xB0, 0x7B, 0x8B, 0x7E, 0xF8, 0x2C, 0x1E, 0xE2, 0xC0, 0x0F, 0x71, 0x60, 0xF7, 0x00, 0xB7,
+        0xEF, 0xEC, 0x3D, 0xC1, 0x60, 0x3D, 0xC1, 0x61, 0xEE, 0x00, 0xB1, 0xEE, 0x0B, 0xFD, 0xF0, 0x2C,
+        0x1E, 0xE2, 0xC7, 0x98, 0x18, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x40, 0x60, 0x25, 0xFD,
+        0xCF, 0xF5, 0x7F, 0xC9, 0xB7, 0xA3, 0xA3, 0x71, 0x88, 0xD5, 0x67, 0xB0, 0x93, 0xD0, 0xCB, 0x0C,
+        0x10, 0x08, 0x18, 0x08, 0x61, 0xB8, 0x5C, 0x09, 0xDE, 0x44, 0x00, 0x1D, 0xE3, 0x47, 0x78, 0x30,
+        0xBB, 0xC8, 0x80, 0x13, 0xBC, 0x88, 0x01, 0xBF, 0xBF, 0x34, 0x0E, 0x0F, 0x3B, 0xC6, 0x81, 0xDE,
+        0x06, 0x80, 0xEF, 0x34, 0x00, 0xEF, 0x1A, 0x77, 0x83, 0x83, 0xC6, 0x83, 0xBC, 0xD6, 0x80, 0x1A,
+        0x3B, 0xC0, 0x0E, 0xF3, 0x40, 0xEF, 0x1A, 0x00, 0xEF, 0x1A, 0xFB, 0xF6, 0x80, 0x3B, 0xC6, 0x81,
+        0xDE, 0x03, 0x41, 0xDE, 0x1A, 0xFB, 0xFC, 0x10, 0xEF, 0x06, 0x8E, 0xF0, 0x06, 0x87, 0x78, 0x30,
+        0x47, 0x78, 0x37, 0xF7, 0xE6, 0x80, 0x3B, 0xC6, 0x8E, 0xF0, 0x60, 0x00, 0x01, 0x01, 0x00, 0x0C,
+        0x20, 0x09, 0x8F, 0x75, 0xFD, 0x67, 0xF2, 0x9E, 0x92, 0x91, 0xBE, 0x1D, 0x7E, 0x4F, 0xBB, 0xE1,
+        0xEE, 0xE2, 0xCB, 0x5C, 0xF0, 0xC5, 0x08, 0x51, 0x03, 0x00, 0x40, 0xE2, 0xFF, 0x7D, 0x60, 0x7B,
+        0x80, 0xB1, 0xEE, 0x0B, 0x7E, 0xFA, 0x0C, 0x0B, 0xFD, 0xF5, 0x80, 0x2F, 0x9A, 0x30, 0x00, 0xCA,
+        0x65, 0x02, 0xC0, 0xF7, 0x2C, 0x00, 0x7B, 0x96, 0x07, 0xB8, 0x0B, 0x3D, 0xC1, 0xEE, 0x20, 0xC1,
+        0xEE, 0x00, 0x02, 0x4B, 0xBF, 0xFF, 0xFF, 0x40, 0x00, 0x31, 0x08, 0x03, 0x20, 0x42, 0x42, 0x98,
+        0x60, 0xD2, 0xD6, 0x5A, 0xD6, 0x05, 0xAC, 0xB5, 0x96, 0xB2, 0x18, 0xC3, 0x72, 0x66, 0xC1, 0x8C,
+        0x05, 0x8F, 0x2B, 0x06, 0x30, 0x66, 0x0E, 0xC6, 0x0C, 0x66, 0x6C, 0xCD, 0x80, 0xB1, 0x86, 0x6C,
+        0x63, 0x06, 0x60, 0xEC, 0x60, 0xF2, 0xB1, 0x83, 0x11, 0xE5, 0x18, 0xC7, 0x94, 0x63, 0x11, 0x99,
+        0x58, 0xC7, 0x9D, 0x9C, 0xAC, 0x58, 0x10, 0x00, 0x20, 0x80, 0x82, 0x08, 0x0C, 0x08, 0x29, 0x3F,
+        0x5B, 0xFD, 0x5F, 0xF5, 0xFF, 0x43, 0xAF, 0x57, 0xEE, 0x72, 0xB9, 0x5C, 0xEC, 0xCC, 0x09, 0x90,
+        0x20, 0x2C, 0xC1, 0xCD, 0x24, 0x92, 0x59, 0x14, 0x55, 0x51, 0x14, 0x53, 0x49, 0x25, 0x4A, 0x91,
+        0xD3, 0x38, 0xE1, 0xA5, 0x2D, 0x0C, 0x20, 0x96, 0x83, 0x40, 0x24, 0x8C, 0x32, 0x60, 0xF2, 0x20,
+        0x5C, 0xB6, 0x0B, 0xB1, 0xB4, 0x36, 0x69, 0x4E, 0xC1, 0x5B, 0x1A, 0x1B, 0x36, 0x31, 0x05, 0x94,
+        0x29, 0x97, 0x0A, 0x65, 0xC1, 0xA6, 0x5C, 0xB8, 0x5C, 0x8B, 0x00, 0x71, 0x4C, 0xB2, 0x5E, 0x6E,
+        0x0C, 0x03, 0x5A, 0x6B, 0x5A, 0x6B, 0x40, 0xD6, 0x9A, 0xD3, 0x5A, 0x0F, 0x2B, 0x78, 0x91, 0x89,
+        0x19, 0xA3, 0x91, 0x23, 0x12, 0x37, 0x8C, 0x44, 0x8C, 0x6F, 0x1B, 0xC4, 0x8C, 0x44, 0xBC, 0x63,
+        0x12, 0x37, 0x8C, 0x44, 0x9B, 0x91, 0x89, 0x19, 0xB8, 0x41, 0x63, 0x37, 0x08, 0xC6, 0x37, 0x20,
+        0xB1, 0x9B, 0xE3, 0xB9, 0x18, 0x91, 0x70, 0x20, 0x10, 0x30, 0x40, 0x20, 0x15, 0x4C, 0xBB, 0xB6,
+        0x77, 0x0D, 0x8A, 0x60, 0x40, 0x76, 0xD2, 0xD2, 0xBC, 0xDC, 0xBB, 0xF2, 0xDF, 0x7D, 0x55, 0xCD,
+        0x65, 0x14, 0x5B, 0x45, 0x16, 0x4F, 0x7C, 0x71, 0xD7, 0x3C, 0xF8, 0xC7, 0x3A, 0xEB, 0x57, 0xCE,
+        0x75, 0x2B, 0xEE, 0xDF, 0x37, 0x36, 0x32, 0xE4, 0x96, 0x06, 0x6B, 0x00, 0xCB, 0x98, 0xCE, 0x30,
+        0x73, 0x03, 0x8F, 0x0C, 0x3C, 0x64, 0xC4, 0x66, 0x07, 0x1E, 0x31, 0x84, 0x70, 0x13, 0x0B, 0x94,
+        0xC2, 0xE5, 0xC2, 0xE0, 0xDC, 0xA6, 0x56, 0x00, 0x03, 0x3F, 0xFE, 0x9F, 0xF8, 0xCC, 0xD1, 0x50,
+        0xD0, 0x51, 0xAA, 0xCF, 0x02, 0x18, 0xE7, 0x8D, 0xE1, 0xA1, 0x8A, 0x71, 0x99, 0xF0, 0x53, 0x0A,
+        0xE0, 0x89, 0xE1, 0xBF, 0x1E, 0xF1, 0x9E, 0x04, 0xBF, 0x3D, 0x71, 0x25, 0xFC, 0xDA, 0x5C, 0x2D,
+        0x6F, 0x12, 0x14, 0x34, 0xC3, 0xE2, 0x5E, 0x0A, 0x71, 0x9C, 0x0C, 0xE2, 0xF0, 0x62, 0x32, 0xE8,
+        0x10, 0xA6, 0xF1, 0x9A, 0x62, 0x06, 0xBC, 0xE2, 0xE0, 0xB5, 0x7A, 0xE7, 0x59, 0x80, 0x70, 0x53,
+        0xB8, 0x82, 0x41, 0x16, 0xE2, 0x4F, 0x01, 0xCD, 0x6F, 0x82, 0x53, 0x0A, 0x42, 0x98, 0x55, 0x31,
+        0xDF, 0x0D, 0x48, 0x0C, 0x00, 0x87, 0x20, 0x12, 0x4C, 0x14, 0xC2, 0xF9, 0xBF, 0xFD, 0x7F, 0xF6,
+        0xFC, 0xA5, 0xFF, 0xF5, 0xBF, 0xEA, 0x63, 0x57, 0xCF, 0x6C, 0x64, 0x08, 0x08, 0x62, 0x42, 0x24,
+        0x60, 0xCB, 0xAC, 0x88, 0x37, 0x08, 0xD5, 0xEB, 0x31, 0xCF, 0xA1, 0xB7, 0xCD, 0xB8, 0xDC, 0xCB,
+        0x87, 0xDC, 0x0A, 0x0A, 0x59, 0x83, 0x57, 0x87, 0x11, 0xEF, 0xA2, 0x30, 0x05, 0xCF, 0x7F, 0x2E,
+        0x1A, 0x5C, 0x2C, 0x48, 0x89, 0x43, 0x3D, 0x31, 0x52, 0xE7, 0xA2, 0x62, 0xB7, 0xAB, 0x8B, 0xC2,
+        0x78, 0x9B, 0x54, 0x48, 0x31, 0x06, 0xE2, 0xA7, 0x59, 0xC6, 0xE0, 0x0E, 0x73, 0xA0, 0xE5, 0x32,
+        0x5C, 0xE9, 0xC2, 0x11, 0x9C, 0x5D, 0xA0, 0x12, 0x0B, 0x6A, 0x0A, 0x15, 0xEA, 0xEF, 0xC7, 0x7C,
+        0x35, 0x0D, 0xCD, 0x16, 0x9C, 0xE3, 0x9F, 0x1D, 0xEA, 0xF8, 0x71, 0x2D, 0xE8, 0x5C, 0x9E, 0xF9,
+        0xD8, 0xE1, 0x83, 0xD7, 0xF0, 0x6C, 0x2E, 0x34, 0x98, 0xF9, 0xF5, 0xC0, 0xA0, 0x9C, 0x6F, 0x0E,
+        0x6A, 0x22, 0xD3, 0x9D, 0x12, 0x31, 0x6A, 0x39, 0xF1, 0xBC, 0x41, 0x36, 0x74, 0x43, 0x16, 0x93,
+        0x78, 0x9A, 0x86, 0x4B, 0x82, 0xC1, 0x67, 0x13, 0x34, 0x21, 0xE2, 0xDC, 0x4B, 0x10, 0x0E, 0x04,
+        0x30, 0x70, 0x40, 0x01, 0xDF, 0x7D, 0x47, 0xA4, 0xC2, 0xFE, 0x57, 0xDB, 0xC6, 0xC0, 0x1F, 0xFE,
+        0x9D, 0x2A, 0xF9, 0xCA, 0x32, 0x21, 0x28, 0x54, 0x81, 0x09, 0x00, 0x54, 0xE3, 0x3A, 0x05, 0x07,
+        0x7D, 0x10, 0x13, 0xC7, 0x78, 0x0C, 0x71, 0x78, 0x72, 0x74, 0x29, 0x1B, 0x85, 0x3C, 0xEF, 0xE7,
+        0x77, 0x02, 0x49, 0x5E, 0xB9, 0xC0, 0x30, 0x00, 0x93, 0xA2, 0x9D, 0x66, 0x08, 0x13, 0x50, 0xA6,
+        0x2C, 0xD1, 0x42, 0x98, 0xBD, 0x6F, 0x0E, 0x83, 0xAD, 0xE1, 0x94, 0x28, 0xDD, 0x26, 0xC0, 0x03,
+        0x40, 0x7E, 0x8F, 0xD6, 0x12, 0x15, 0xCB, 0x2A, 0x8E, 0xA1, 0x99, 0x6A, 0x2B, 0x10, 0x10, 0x22,
+        0x1F, 0x0F, 0x1B, 0xC2, 0x1F, 0xBC, 0xBE, 0x24, 0x6B, 0xC3, 0x29, 0x4A, 0x03, 0x18, 0x78, 0xE5,
+        0x41, 0x89, 0xE3, 0x30, 0x57, 0x86, 0x21, 0xE1, 0xDC, 0x08, 0x01, 0x58, 0xCC, 0xDC, 0x90, 0xBD,
+        0xF0, 0xCB, 0x97, 0x0B, 0x35, 0x19, 0xE2, 0x60, 0xB0, 0x30, 0xC3, 0xC1, 0x5C, 0x5F, 0x5B, 0xD3,
+        0xAE, 0xEA, 0x9E, 0x2E, 0x19, 0x01, 0x19, 0xA8, 0x90, 0x5D, 0x44, 0xE3, 0x38, 0x2B, 0x10, 0x60,
+        0xC5, 0xC5, 0xE2, 0x2F, 0x0D, 0xA8, 0x80, 0x80, 0x29, 0x81, 0x80, 0x21, 0x63, 0x06, 0x37, 0x3F,
+        0xFF, 0x9B, 0xFE, 0xEF, 0x90, 0xBF, 0xFE, 0x67, 0xFC, 0xEC, 0xAA, 0x3A, 0x69, 0x84, 0xA0, 0xA6,
+        0x0A, 0x20, 0x60, 0x88, 0x09, 0x34, 0x1E, 0x1A, 0x9C, 0x4B, 0xE3, 0x78, 0x60, 0x9E, 0x33, 0x89,
+        0xD5, 0xC5, 0x8A, 0x9E, 0x26, 0x60, 0x8B, 0x10, 0x22, 0xF1, 0xB8, 0x18, 0x6A, 0xF4, 0x5B, 0xD5,
+        0xAA, 0x70, 0xC5, 0xF1, 0x7C, 0x6F, 0x04, 0xB3, 0xC4, 0x98, 0xAB, 0x89, 0x0A, 0x00, 0x70, 0x57,
+        0x11, 0x78, 0x0E, 0xAE, 0x78, 0x04, 0x1A, 0x2D, 0xD2, 0x70, 0x11, 0xBC, 0x38, 0x4C, 0x22, 0x75,
+        0xCF, 0x89, 0x41, 0x59, 0xC2, 0x70, 0xC1, 0x18, 0x91, 0x0D, 0xC7, 0x7C, 0x03, 0x0A, 0xE0, 0x88,
+        0x59, 0xF0, 0x73, 0xC7, 0x78, 0x02, 0x03, 0x82, 0xB8, 0x6B, 0x5B, 0xEB, 0xBD, 0x6E, 0xB1, 0x78,
+        0xB8, 0x21, 0x71, 0x0F, 0x0D, 0x81, 0x3F, 0x1C, 0x8A, 0x64, 0x4C, 0x3C, 0x38, 0x6D, 0xF0, 0xCE,
+        0xB6, 0x88, 0x26, 0xA1, 0xE2, 0xC5, 0xF0, 0xF1, 0x61, 0x13, 0x40, 0xC2, 0x56, 0xF1, 0x7E, 0x37,
+        0x00, 0x95, 0x33, 0x4E, 0x9C, 0x4B, 0xA8, 0x70, 0xD1, 0x0C, 0xF1, 0x78, 0x01, 0x87, 0x03, 0x19,
+        0xC6, 0x58, 0x20, 0x40, 0x00, 0xC0, 0x02, 0x00, 0x0A, 0xB3, 0xEA, 0xBD, 0x36, 0x1F, 0xF2, 0x7E,
+        0xA6, 0x25, 0x91, 0xFF, 0xE9, 0xA0, 0xDD, 0x40, 0x60, 0x71, 0xC0, 0x4C, 0x91, 0xCB, 0x1B, 0xD1,
+        0x0A, 0x1D, 0xE0, 0x08, 0x66, 0x09, 0x67, 0x00, 0x04, 0xB7, 0x4A, 0x13, 0x86, 0x40, 0x3C, 0x3C,
+        0x5C, 0x5A, 0x84, 0x27, 0x8E, 0x4A, 0x83, 0x81, 0x01, 0xDE, 0x02, 0x57, 0xA9, 0x27, 0x57, 0x84,
+        0x27, 0x1B, 0x81, 0x86, 0x03, 0x28, 0x17, 0x58, 0xCE, 0x1C, 0xC1, 0xA0, 0x4C, 0x0D, 0x1E, 0x5C,
+        0x28, 0x03, 0x3F, 0x2F, 0x6F, 0xFB, 0xA0, 0x10, 0x09, 0x90, 0x32, 0xA0, 0x18, 0xE6, 0xC3, 0x83,
+        0xE6, 0xE3, 0xE5, 0x2E, 0x09, 0xBF, 0x3E, 0xFC, 0x2E, 0x5B, 0x98, 0x22, 0x49, 0xC1, 0x42, 0xA6,
+        0xE8, 0x62, 0xE2, 0x70, 0x46, 0xD6, 0x2F, 0x02, 0x55, 0xE8, 0x07, 0x8B, 0x20, 0x9D, 0x18, 0x71,
+        0xBA, 0x84, 0x26, 0x18, 0xC1, 0xC7, 0x0A, 0x6E, 0x7C, 0xEC, 0x12, 0x89, 0x0A, 0x1E, 0x37, 0x4D,
+        0x41, 0x4D, 0x0D, 0x48, 0xE1, 0x9F, 0xDF, 0x0E, 0x36, 0x25, 0x12, 0x21, 0xE0, 0x5C, 0x6F, 0xC3,
+        0x00, 0x86, 0x04, 0x0C, 0x08, 0x80, 0xA1, 0x80, 0x01, 0x0A, 0x02, 0xC7, 0xE5, 0x7C, 0xEE, 0x0B,
+        0xF1, 0x5E, 0xA1, 0x3C, 0x9C, 0x3F, 0x0C, 0x60, 0x92, 0x03, 0xA5, 0x07, 0x30, 0x08, 0x71, 0x14,
+        0x6F, 0x4E, 0x1D, 0x3B, 0xC3, 0x50, 0xD3, 0x13, 0x3B, 0x33, 0x2D, 0x96, 0x73, 0x71, 0xA2, 0x93,
+        0xCF, 0x71, 0x0B, 0xE6, 0xF2, 0xC0, 0xAF, 0x0E, 0x1A, 0x81, 0xBC, 0x07, 0xC6, 0xE9, 0x94, 0x37,
+        0x80, 0xE0, 0x48, 0x4A, 0x2F, 0x16, 0x30, 0x86, 0xFE, 0x74, 0x01, 0xF1, 0xF7, 0xF0, 0xAE, 0x26,
+        0x8A, 0x8C, 0xC1, 0x89, 0xEB, 0x68, 0x09, 0xBF, 0x9E, 0xE4, 0xCD, 0x6F, 0x80, 0xC0, 0xA6, 0x2D,
+        0x35, 0x56, 0x2F, 0xC6, 0xF8, 0x92, 0x09, 0x0B, 0xC0, 0x8B, 0xC6, 0xE8, 0x08, 0x26, 0x07, 0xBC,
+        0xAF, 0x8E, 0x74, 0x21, 0x09, 0xD2, 0xC5, 0xC1, 0x3C, 0x48, 0xB8, 0x18, 0xBA, 0xBA, 0x14, 0xA7,
+        0x88, 0xD7, 0xC1, 0x25, 0x19, 0x4C, 0xCD, 0xC6, 0xBF, 0x3B, 0xCB, 0x88, 0x9D, 0xF2, 0xF0, 0xB2,
+        0x87, 0x33, 0x71, 0x19, 0x43, 0x0C, 0xDD, 0xF1, 0x26, 0x68, 0x40, 0x3C, 0x07, 0x02, 0xE1, 0x3D,
+        0x5D, 0x5B, 0x06, 0x0A, 0x00, 0x10, 0xA1, 0x77, 0x5F, 0x3D, 0xE4, 0xAF, 0x7F, 0x1B, 0xE6, 0xE3,
+        0xDD, 0x43, 0x20, 0x27, 0xEF, 0x63, 0x42, 0x24, 0x3C, 0x10, 0x13, 0x1C, 0x06, 0x6E, 0x7C, 0xFB,
+        0x92, 0xE0, 0x25, 0x17, 0x8B, 0xE2, 0x44, 0x48, 0x3E, 0x32, 0x2A, 0xC6, 0x66, 0x9E, 0x5C, 0xD4,
+        0xE0, 0x5C, 0xA5, 0x05, 0xC0, 0x87, 0x1B, 0xE3, 0x3C, 0x30, 0xE0, 0x9C, 0x31, 0xAD, 0xEA, 0x5E,
+        0x2F, 0x04, 0x18, 0x29, 0x86, 0x30, 0xC2, 0xB5, 0x4F, 0x1B, 0xD4, 0x8C, 0x47, 0xCD, 0xF3, 0xD0,
+        0x03, 0x3F, 0xFB, 0x7E, 0x3D, 0x40, 0x0D, 0x0D, 0x1E, 0x07, 0x05, 0x14, 0x29, 0x5C, 0x4E, 0xAF,
+        0x5C, 0xC4, 0x07, 0x8B, 0xC6, 0xCA, 0x90, 0x30, 0xB7, 0xAB, 0xC3, 0x10, 0xF1, 0xD9, 0x71, 0x75,
+        0x05, 0xA7, 0x59, 0xE2, 0xF0, 0xE3, 0x63, 0xC8, 0x44, 0x72, 0xDF, 0x0B, 0xE7, 0x41, 0xBE, 0x39,
+        0xB8, 0x97, 0x2F, 0x85, 0x11, 0x72, 0x00, 0xDE, 0x6E, 0x73, 0xBE, 0x75, 0x1C, 0x9B, 0xF9, 0xAB,
+        0xCE, 0xE0, 0xC1, 0xE8, 0xF8, 0xE3, 0x70, 0x2E, 0x07, 0x7C, 0x29, 0x63, 0x78, 0x01, 0xC4, 0xE2,
+        0x5F, 0x0E, 0x71, 0x2C, 0x0C, 0x30, 0x00, 0xC1, 0xC1, 0x56, 0xFC, 0x4F, 0x91, 0xC0, 0x7D, 0xC7,
+        0x92, 0x92, 0x81, 0x7E, 0x6C, 0x8F, 0xC7, 0x87, 0x31, 0x70, 0xE9, 0x88, 0x78, 0xEC, 0x7C, 0x70,
+        0xCF, 0xBC, 0x11, 0xC2, 0x54, 0x8E, 0x25, 0x00, 0xAF, 0x5B, 0xA0, 0x23, 0x78, 0x1A, 0x63, 0x9B,
+        0x06, 0x5F, 0x29, 0x9F, 0x4B, 0x53, 0x89, 0x82, 0x0B, 0xC3, 0x87, 0x8D, 0xE0, 0xB3, 0x84, 0xE2,
+        0x71, 0x24, 0x40, 0x7C, 0x6C, 0x10, 0x48, 0x2B, 0xD5, 0xA7, 0x86, 0x21, 0x81, 0xB8, 0x61, 0xDF,
+        0x3D, 0xF1, 0x1E, 0x27, 0x4A, 0x04, 0x45, 0xC5, 0xF1, 0xBA, 0x4E, 0x8E, 0xE8, 0x7D, 0xC9, 0x0A,
+        0x65, 0xBE, 0x59, 0x0D, 0x27, 0xA7, 0x4D, 0xE3, 0x7C, 0x6F, 0x00, 0x0A, 0xEC, 0x78, 0x7C, 0xEC,
+        0x4C, 0xEE, 0x07, 0x34, 0x85, 0x9C, 0x53, 0x0E, 0x1C, 0x30, 0x30, 0xD5, 0x91, 0xA8, 0x9D, 0x77,
+        0xE3, 0x70, 0xE1, 0x4F, 0x13, 0x64, 0x38, 0xCE, 0x26, 0x9C, 0xE1, 0x85, 0x13, 0x5B, 0x2A, 0x4A,
+        0x78, 0xEF, 0x82, 0x62, 0x70, 0x27, 0x12, 0x37, 0x0F, 0x3B, 0x94, 0x0C, 0xA7, 0x97, 0xA5, 0x02,
+        0x2B, 0xBE, 0xAC, 0x44, 0xE2, 0x61, 0x39, 0x61, 0x00, 0x6B, 0xBE, 0x2B, 0xC9, 0x5D, 0xFD, 0xFF,
+        0x91, 0x89, 0x7D, 0x00, 0x80, 0x48, 0xB0, 0xE0, 0xC5, 0xF3, 0x2E, 0x34, 0xC2, 0xE6, 0x34, 0x27,
+        0xC4, 0x85, 0x19, 0xC3, 0x30, 0x8C, 0x4A, 0x12, 0xFC, 0xBB, 0xF9, 0xA0, 0x18, 0x5F, 0x3D, 0x13,
+        0x89, 0x27, 0x70, 0x02, 0x39, 0xA4, 0x0F, 0x19, 0xC5, 0xC3, 0x86, 0x22, 0xAC, 0xC1, 0x35, 0x13,
+        0xAD, 0xF1, 0xDF, 0x8D, 0xC0, 0xC4, 0x90, 0x46, 0x0E, 0x33, 0x8B, 0xC6, 0xF0, 0x04, 0x37, 0x82,
+        0xDE, 0x20, 0xB4, 0x10, 0x03, 0x3D, 0xBF, 0xF4, 0xFF, 0xF9, 0x9A, 0x01, 0xA0, 0x88, 0x41, 0xD9,
+        0x60, 0x46, 0x83, 0xC3, 0x75, 0x9A, 0xAB, 0xC5, 0xA4, 0x26, 0xF0, 0x71, 0xAF, 0x97, 0x29, 0x89,
+        0x31, 0x06, 0x03, 0x78, 0xBD, 0x5E, 0xB7, 0x40, 0x57, 0x26, 0xF9, 0xDC, 0xB8, 0x03, 0xCF, 0xA3,
+        0xF1, 0xB3, 0x95, 0x03, 0x11, 0xCA, 0x40, 0x03, 0xC6, 0x62, 0xE1, 0x04, 0x33, 0xE3, 0x91, 0xE1,
+        0x73, 0x2D, 0xCE, 0xE1, 0x94, 0xBC, 0x22, 0xF1, 0x74, 0xAC, 0xEA, 0xD5, 0x32, 0x80, 0xEF, 0x2F,
+        0x11, 0x13, 0x89, 0xBE, 0x2C, 0x1C, 0x30, 0x4A, 0x9F, 0x47, 0xDC, 0xD9, 0x7C, 0x87, 0x79, 0x10,
+        0xDD, 0xD9, 0x30, 0xA6, 0x00, 0x14, 0x16, 0x8E, 0x37, 0x8B, 0xC5, 0xE9, 0xBA, 0xB2, 0xA7, 0x13,
+        0x82, 0xC1, 0xC4, 0x9C, 0x5C, 0x32, 0xC6, 0xE9, 0x3A, 0x37, 0x57, 0x80, 0x2F, 0x00, 0x7B, 0x99,
+        0x4C, 0x3B, 0xE6, 0xE3, 0x8D, 0xE1, 0x48, 0xA9, 0xC5, 0xE3, 0x78, 0x01, 0xC0, 0x28, 0x9A, 0x4E,
+        0x9D, 0x6D, 0x60, 0x5E, 0x9C, 0xC0, 0x80, 0x65, 0x1C, 0xDF, 0x29, 0x9A, 0x12, 0x06, 0x14, 0xC4,
+        0xA8, 0x78, 0xB4, 0xAC, 0xB0, 0xE1, 0xA4, 0x2F, 0x13, 0x56, 0xA4, 0x41, 0x5D, 0x11, 0x89, 0x9C,
+        0x5E, 0x09, 0x83, 0x38, 0x14, 0xDF, 0x10, 0xB9, 0x7C, 0xF7, 0xC2, 0xC2, 0x70, 0xE0, 0x04, 0xE7,
+        0x15, 0xBA, 0x4C, 0x8F, 0x3B, 0xE5, 0x30, 0xEE, 0x3C, 0x36, 0x62, 0x3B, 0x90, 0x0B, 0x07, 0xCE,
+        0xF9, 0xD3, 0xE1, 0x77, 0xA0, 0xE2, 0xB6, 0x85, 0x34, 0x44, 0x32, 0x71, 0x0F, 0x0C, 0x38, 0x02,
+        0xB3, 0x8B, 0xC0, 0xEC, 0x23, 0x8E, 0xE4, 0xDF, 0xCD, 0x73, 0x4C, 0x80, 0x80, 0x8D, 0xA2, 0x8C,
+        0xE5, 0x05, 0x0F, 0xFE, 0xCD, 0xEC, 0xBB, 0x0A, 0x7F, 0x9D, 0xEB, 0xE2, 0xDC, 0x3C, 0x28, 0x08,
+        0x58, 0xB0, 0x00, 0x82, 0x01, 0x24, 0xC4, 0x45, 0xE3, 0x31, 0x13, 0x89, 0x86, 0x88, 0x27, 0x0A,
+        0xE9, 0x5E, 0x1C, 0x38, 0x9A, 0x13, 0x67, 0x9B, 0xE7, 0x43, 0x00, 0x2E, 0x10, 0xBE, 0x2E, 0x84,
+        0xC3, 0x51, 0x3A, 0xDD, 0x22, 0xBC, 0x5F, 0x1B, 0xE2, 0xDE, 0x1A, 0x30, 0x4C, 0x0E, 0xE3, 0x9B,
+        0xE5, 0x3B, 0xF0, 0x40, 0x06, 0xE1, 0x2F, 0x3B, 0x97, 0xCD, 0xC4, 0x94, 0x8E, 0xB7, 0x55, 0x71,
+        0x60, 0x02, 0x3E, 0x9F, 0xFF, 0xFB, 0x08, 0xA9, 0x98, 0x38, 0x18, 0x41, 0x11, 0x0A, 0x96, 0x86,
+        0x22, 0x22, 0x8E, 0xA2, 0x94, 0x51, 0x28, 0xAA, 0x58, 0x18, 0x11, 0x4B, 0x50, 0x68, 0xA2, 0x2A,
+        0x86, 0x82, 0xA8, 0x88, 0xA5, 0x48, 0x96, 0x20, 0x62, 0x21, 0x2A, 0x55, 0x81, 0x14, 0x47, 0x0A,
+        0xA8, 0x44, 0x44, 0x45, 0x2A, 0x08, 0x96, 0x22, 0x22, 0x92, 0x55, 0x03, 0x80, 0x20, 0x78, 0xFC,
+        0x90, 0x60, 0xC3, 0x14, 0x0B, 0x2C, 0x55, 0x9A, 0xFB, 0x11, 0x45, 0x4C, 0x19, 0x00, 0xA0, 0xC7,
+        0xFF, 0xFF, 0xDB, 0x7C, 0x8F, 0xF9, 0xDF, 0xE0, 0xF4, 0x2D, 0x29, 0x9F, 0x08, 0x0E, 0x2C, 0x21,
+        0x21, 0x42, 0x82, 0x0A, 0x2A, 0xD6, 0x38, 0x8D, 0x55, 0x63, 0x55, 0xAC, 0x63, 0x08, 0xB5, 0x58,
+        0xD5, 0x55, 0x6A, 0x2A, 0xAB, 0x55, 0x54, 0x51, 0x55, 0x51, 0x10, 0xA8, 0x52, 0xA8, 0x88, 0x21,
+        0x18, 0x54, 0x95, 0x0C, 0x40, 0xC5, 0x1A, 0x24, 0xB1, 0x11, 0x03, 0x45, 0x55, 0x44, 0x40, 0x28,
+        0x8D, 0x1A, 0x55, 0x02, 0x22, 0x34, 0x68, 0x96, 0x84, 0x60, 0x44, 0x52, 0x4B, 0x43, 0x0F, 0x04,
+        0x34, 0x6A, 0x94, 0x40, 0x88, 0x8C, 0x41, 0x43, 0xCC, 0xC3, 0xC3, 0x0E, 0xDB, 0x75, 0xDE, 0x95,
+        0xC5, 0xB9, 0x59, 0x72, 0x5C, 0x97, 0x32, 0x3A, 0x5E, 0x97, 0x5F, 0x4D, 0x6D, 0xDD, 0x13, 0xD1,
+        0xDB, 0x6E, 0xBA, 0xE8, 0xFD, 0x16, 0xD5, 0xD7, 0x7A, 0x5D, 0x9D, 0x74, 0x74, 0xB6, 0xDA, 0xEE,
+        0xD9, 0xA7, 0x7A, 0x2A, 0x6B, 0xB4, 0xED, 0xA6, 0xCF, 0x51, 0x48, 0x91, 0x2F, 0x37, 0x22, 0x41,
+        0x42, 0x48, 0x8C, 0xE6, 0xFC, 0xD8, 0xB0, 0x20, 0x80, 0x43, 0x00, 0x00, 0x08, 0x08, 0x00, 0x80,
+        0x26, 0x3E, 0x4B, 0xFC, 0xF7, 0xF0, 0x9A, 0x24, 0xE3, 0xFC, 0xBD, 0xA7, 0x61, 0x01, 0x09, 0x5A,
+        0x74, 0x89, 0xA7, 0x59, 0x3C, 0xCC, 0xDE, 0x67, 0x37, 0x6F, 0x33, 0x37, 0x92, 0x99, 0x9C, 0xB9,
+        0x9C, 0x99, 0xE4, 0xBC, 0xB2, 0x3A, 0x75, 0x7A, 0xBB, 0x6D, 0x2F, 0x51, 0xD5, 0xDA, 0x74, 0xEE,
+        0xCD, 0x5E, 0xD2, 0x6C, 0x65, 0x19, 0x96, 0xD8, 0xB8, 0xE5, 0x0E, 0xBA, 0x74, 0xB7, 0x75, 0x9E,
+        0x97, 0xA2, 0x77, 0x3D, 0x57, 0xD2, 0xDA, 0x7B, 0x3D, 0x19, 0xB6, 0x96, 0xD0, 0x02, 0x4F, 0xAB,
+        0xFF, 0x70, 0x06, 0x50, 0x04, 0x23, 0x41, 0x88, 0x42, 0x18, 0x84, 0x35, 0x03, 0x02, 0x86, 0x1E,
+        0x95, 0x24, 0x0A, 0xA2, 0x21, 0x1D, 0x3C, 0x24, 0xB0, 0xE2, 0x06, 0x4E, 0x19, 0x21, 0xC3, 0x32,
+        0x46, 0x0F, 0x30, 0x3E, 0x6F, 0x02, 0x78, 0xE4, 0x78, 0x21, 0xE5, 0xE4, 0xBC, 0x31, 0xF1, 0xCB,
+        0xC1, 0x78, 0x60, 0x65, 0xCE, 0x6F, 0xC1, 0x70, 0x70, 0x2E, 0x5D, 0x9A, 0x11, 0xEE, 0x7A, 0x3C,
+        0xD9, 0xB9, 0xDC, 0xE8, 0xD8, 0xDA, 0x30, 0x50, 0x40, 0x40, 0x81, 0x06, 0x14, 0x10, 0x00, 0xA0,
+        0xC3, 0x44, 0xF8, 0xDF, 0xDA, 0xFD, 0x4A, 0x7F, 0x6E, 0x2F, 0x93, 0x88, 0x8B, 0x29, 0x60, 0x22,
+        0x0C, 0x42, 0x01, 0x45, 0x18, 0x58, 0x15, 0x88, 0x8A, 0x8A, 0x54, 0x34, 0x4A, 0xA2, 0xB0, 0x06,
+        0x86, 0x06, 0xA0, 0x43, 0x1F, 0x8C, 0xCC, 0x03, 0x39, 0x79, 0x0E, 0x22, 0x67, 0x0C, 0xBE, 0x5C,
+        0xE1, 0x99, 0x70, 0x28, 0xA1, 0x02, 0x00, 0xA3, 0xA7, 0xA2, 0xF4, 0x45, 0x60, 0x0A, 0x47, 0x0F,
+        0x02, 0xA2, 0x74, 0x4F, 0x09, 0x28, 0x80, 0xA8, 0xE2, 0x1C, 0x51, 0x1E, 0x08, 0xD4, 0xE8, 0x08,
+        0x8A, 0x48, 0x41, 0x50, 0x4A, 0x2C, 0x76, 0x9C, 0xB1, 0x96, 0xC4, 0xBA, 0x5B, 0xAE, 0xA9, 0xB6,
+        0xD1, 0x66, 0xDA, 0xAF, 0x72, 0xD5, 0xD0, 0x6A, 0x9A, 0x5A, 0xAC, 0x7A, 0x68, 0xC3, 0x41, 0xEC,
+        0xAC, 0xD0, 0xEE, 0x0E, 0xB9, 0xA5, 0x9D, 0x97, 0x36, 0x69, 0x44, 0x0A, 0x1B, 0x79, 0xA5, 0xCA,
+        0x05, 0x15, 0x3A, 0x9A, 0x06, 0x80, 0xA4, 0x8A, 0x1C, 0xC0, 0xC9, 0x8F, 0x03, 0x38, 0xC8, 0xC0,
+        0x82, 0x06, 0x02, 0x00, 0x50, 0x30, 0x8F, 0xBC, 0xC7, 0xEB, 0xBE, 0xAB, 0x0C, 0x96, 0x4D, 0x89,
+        0x3E, 0x38, 0x9C, 0xBB, 0x96, 0xD9, 0xBB, 0x36, 0x52, 0xB2, 0x2C, 0xDB, 0xC8, 0x66, 0x65, 0xE4,
+        0x4A, 0x7A, 0x74, 0xF6, 0x94, 0x57, 0xA3, 0x94, 0x2E, 0xE6, 0xA6, 0xC2, 0xE8, 0x37, 0x3B, 0x97,
+        0x4B, 0x72, 0xDC, 0xF4, 0xA2, 0x50, 0xD9, 0xB7, 0x79, 0xD8, 0xBD, 0x04, 0xD6, 0x77, 0x3A, 0x6D,
+        0x89, 0xD5, 0x1D, 0xCE, 0x8B, 0xB4, 0xA6, 0xCF, 0xB2, 0x8B, 0x3D, 0xCE, 0x97, 0x40, 0x02, 0x42,
+        0x7F, 0xFF, 0xFF, 0xEA, 0x20, 0x00, 0x02, 0x0C, 0x82, 0x09, 0x80, 0x62, 0x80, 0x4C, 0x2F, 0x12,
+        0x33, 0x7E, 0x69, 0x11, 0x89, 0x18, 0xF3, 0xDC, 0x89, 0x18, 0x2D, 0xC8, 0xC6, 0xE5, 0xE6, 0xE1,
+        0x40, 0x7E, 0xF9, 0xEE, 0x05, 0x80, 0xDC, 0xDE, 0x1B, 0xCB, 0x9B, 0x19, 0x9B, 0x47, 0x8C, 0x6E,
+        0x46, 0x9C, 0xDC, 0xA0, 0x25, 0x1B, 0x59, 0xEB, 0x34, 0xA7, 0xA2, 0x33, 0x68, 0x7A, 0x1E, 0xE5,
+        0x9D, 0xAA, 0x00, 0x60, 0x82, 0x08, 0x01, 0x8A, 0x00, 0x75, 0xFF, 0x37, 0xFF, 0x37, 0xFC, 0xFE,
+        0x6B, 0x47, 0xFE, 0x1E, 0x4D, 0x33, 0x39, 0x02, 0x21, 0x20, 0x32, 0x29, 0x70, 0x52, 0xC4, 0x4E,
+        0x91, 0xA1, 0x14, 0x50, 0xE4, 0x9C, 0x24, 0x98, 0x1C, 0x6F, 0x11, 0xBC, 0x63, 0x1E, 0x56, 0x3C,
+        0x2E, 0x0D, 0xCD, 0xE0, 0x00, 0x19, 0x79, 0xA0, 0x99, 0x78, 0xDE, 0x33, 0x72, 0x24, 0x46, 0x31,
+        0xE5, 0xCD, 0x23, 0xC2, 0xE6, 0x8C, 0x78, 0x6F, 0x0B, 0x9B, 0xCD, 0xE1, 0x51, 0xE5, 0x79, 0xBC,
+        0xAC, 0x66, 0xF1, 0xA0, 0x85, 0xCA, 0xCD, 0x37, 0x85, 0xCA, 0x8C, 0x7C, 0xEC, 0x79, 0xEF, 0x06,
+        0x30, 0x43, 0x59, 0x6B, 0x2D, 0x67, 0xBE, 0x18, 0xCC, 0xB9, 0xBC, 0xA6, 0x6F, 0x02, 0x8E, 0x17,
+        0xCA, 0x11, 0x03, 0x2F, 0x34, 0x43, 0x8C, 0xDC, 0x8C, 0xDC, 0xE5, 0x60, 0x99, 0xB3, 0x0D, 0xE1,
+        0x70, 0x30, 0x85, 0x03, 0x40, 0xE0, 0xD0, 0x81, 0xA7, 0xA9, 0xA1, 0xC0, 0xF8, 0x1F, 0x2E, 0x3E,
+        0x3F, 0x8C, 0x58, 0x30, 0x40, 0x01, 0x82, 0x03, 0x79, 0xC7, 0x7C, 0x77, 0x96, 0xA2, 0x26, 0xFD,
+        0x08, 0x51, 0x83, 0x99, 0xE9, 0x6B, 0x4D, 0xA1, 0x5E, 0x8E, 0x7A, 0x47, 0xD0, 0xBB, 0x1A, 0xBA,
+        0x22, 0xB4, 0x37, 0x95, 0x99, 0xB1, 0x18, 0xC6, 0xF1, 0x9A, 0x65, 0xCB, 0xCD, 0x10, 0x00, 0x0B,
+        0x9B, 0xC2, 0xE6, 0x8C, 0x79, 0x73, 0x63, 0x06, 0x31, 0xA3, 0xC6, 0xF0, 0x66, 0xE5, 0x38, 0xB2,
+        0x90, 0xA9, 0x87, 0x53, 0x53, 0x0C, 0x51, 0x52, 0x3C, 0xDC, 0x8C, 0x78, 0x02, 0x5F, 0xFF, 0x2B,
+        0xFC, 0xA2, 0x8C, 0x10, 0x53, 0x4F, 0x24, 0x53, 0xC0, 0x24, 0x31, 0x4B, 0x1E, 0xBD, 0x7D, 0x3D,
+        0x3D, 0x6D, 0x6D, 0xE9, 0x2D, 0xA2, 0xB6, 0x8B, 0x91, 0x2A, 0x62, 0xC8, 0xB2, 0xA6, 0xB7, 0x59,
+        0xAD, 0xD4, 0xA2, 0x07, 0xDE, 0x69, 0x3B, 0x19, 0xAB, 0x9A, 0x51, 0x19, 0xBC, 0xD0, 0xAD, 0xE6,
+        0xE5, 0x06, 0xA1, 0x79, 0xDF, 0x3E, 0xE2, 0x80, 0x0F, 0xA1, 0xB4, 0x37, 0x66, 0xE9, 0x3B, 0x07,
+        0x6B, 0x43, 0x69, 0xA5, 0x68, 0x29, 0x20, 0x02, 0x10, 0xA1, 0x82, 0x14, 0xFF, 0x97, 0xFE, 0x5F,
+        0xF2, 0xF3, 0x56, 0xA8, 0xC0, 0xAF, 0xD9, 0xCC, 0x0E, 0x6F, 0x1F, 0x23, 0x84, 0x50, 0xA3, 0x42,
+        0xA6, 0xA7, 0x4E, 0x2A, 0x47, 0x80, 0x64, 0x79, 0x5B, 0xC6, 0xE4, 0x1D, 0x05, 0xC5, 0xCD, 0x0B,
+        0x93, 0xA3, 0x06, 0x6F, 0x34, 0x0A, 0xC6, 0x23, 0x43, 0x79, 0xA4, 0xEC, 0x34, 0x00, 0x7D, 0xE6,
+        0xB2, 0xB5, 0x9B, 0x73, 0xDC, 0xA3, 0xEE, 0x5D, 0x0F, 0x4D, 0xBA, 0x6D, 0xBD, 0x2B, 0x36, 0x73,
+        0x91, 0xDC, 0xDF, 0x97, 0x7E, 0x73, 0xB3, 0x36, 0xB6, 0x12, 0xA2, 0x34, 0x92, 0x81, 0x62, 0x81,
+        0x16, 0x86, 0x86, 0x94, 0x42, 0xC3, 0xE0, 0xF0, 0x51, 0x1E, 0x27, 0x42, 0x85, 0x1A, 0x78, 0x43,
+        0x52, 0x42, 0xAA, 0x75, 0x3C, 0x4D, 0x14, 0x22, 0x80, 0x23, 0x89, 0xD4, 0xD2, 0x4A, 0x6A, 0x1E,
+        0xA6, 0x87, 0x78, 0x19, 0x33, 0x79, 0x70, 0xC8, 0x03, 0x9B, 0x33, 0x96, 0x40, 0x0F, 0x81, 0xC2,
+        0x87, 0x85, 0x46, 0xA8, 0x1C, 0x1A, 0x85, 0x02, 0x1C, 0xC3, 0x86, 0x4C, 0x0F, 0x97, 0xE6, 0xA8,
+        0xC2, 0x04, 0x0D, 0x0F, 0x99, 0xFE, 0x67, 0xF3, 0x33, 0x95, 0xA6, 0x99, 0x27, 0x10, 0x08, 0xED,
+        0x0D, 0xE6, 0xCE, 0xCD, 0x22, 0x68, 0xDE, 0x6E, 0xF0, 0xDB, 0x97, 0x79, 0xA0, 0x0D, 0x6F, 0x19,
+        0x9B, 0x32, 0xE6, 0xF0, 0xE0, 0xE9, 0x25, 0xE1, 0x94, 0x7C, 0x49, 0x05, 0x78, 0x06, 0x46, 0x33,
+        0x03, 0x83, 0xBC, 0x1F, 0x13, 0x80, 0x64, 0x79, 0x08, 0xC2, 0x84, 0x6A, 0x1E, 0x9C, 0x54, 0x0A,
+        0x20, 0x34, 0x2A, 0x28, 0x54, 0x46, 0x23, 0x51, 0x83, 0x1C, 0x03, 0x06, 0x86, 0x48, 0x02, 0x5F,
+        0xFF, 0xFF, 0xC4, 0xFD, 0x86, 0x08, 0x6E, 0x1C, 0xF7, 0x55, 0x5D, 0x14, 0xCF, 0x34, 0xB4, 0xCA,
+        0x7D, 0xCF, 0x6F, 0x77, 0x77, 0x3B, 0x79, 0x1B, 0x63, 0x77, 0xEC, 0xDD, 0xAF, 0x74, 0xDA, 0xDA,
+        0x3A, 0x1F, 0x61, 0xF7, 0x9B, 0x76, 0x35, 0xA2, 0x56, 0x8A, 0xEC, 0xD0, 0x34, 0x1A, 0x1A, 0x5C,
+        0xD9, 0xA6, 0xF3, 0x48, 0x3A, 0xCD, 0x00, 0xAD, 0xE6, 0x86, 0x89, 0x74, 0xD9, 0xA6, 0x97, 0x43,
+        0x68, 0x87, 0xDE, 0x5D, 0x0F, 0x72, 0xE8, 0x51, 0x45, 0x14, 0x00, 0x87, 0x08, 0x09, 0x3E, 0x9F,
+        0xF4, 0x7F, 0x07, 0x3D, 0x69, 0x4D, 0x04, 0x56, 0xE4, 0x71, 0x78, 0x89, 0x50, 0x00, 0x84, 0x23,
+        0x32, 0xFC, 0xDE, 0x6F, 0x03, 0x2E, 0x42, 0x89, 0x51, 0x38, 0x33, 0x59, 0x85, 0x30, 0xC0, 0x86,
+        0x84, 0x4A, 0xDE, 0x6F, 0x37, 0x47, 0x95, 0xB9, 0x43, 0x4A, 0xC1, 0xA2, 0x56, 0x8B, 0x3A, 0xD0,
+        0xAD, 0x15, 0x7D, 0x15, 0xF4, 0xBA, 0x6F, 0xA1, 0x0C, 0xED, 0x4E, 0x46, 0xDE, 0x72, 0x79, 0x9C,
+        0xE5, 0x21, 0x3A, 0xDA, 0xF7, 0xCA, 0xDA, 0x65, 0xB6, 0xFB, 0x75, 0xCE, 0x74, 0xB3, 0x27, 0x05,
+        0xD3, 0x51, 0x14, 0x90, 0x39, 0x92, 0x31, 0x0C, 0x80, 0xD2, 0x90, 0x84, 0x1A, 0x89, 0x20, 0xA2,
+        0x25, 0x01, 0x0A, 0xAA, 0x28, 0x68, 0x54, 0x28, 0x85, 0x84, 0x07, 0x38, 0x1C, 0xCE, 0x33, 0x26,
+        0x19, 0x30, 0x49, 0x27, 0x19, 0xE5, 0x38, 0x61, 0xCD, 0x2A, 0x87, 0x46, 0x85, 0x4D, 0x03, 0x48,
+        0xD0, 0x80, 0x64, 0xCD, 0xE0, 0x70, 0xCE, 0x03, 0xC7, 0x87, 0x0C, 0xE0, 0x73, 0x03, 0xF3, 0x47,
+        0x38, 0x71, 0x99, 0xC0, 0xC3, 0x9C, 0x15, 0x20, 0x10, 0x25, 0x7A, 0x9F, 0xD2, 0xFC, 0x2D, 0x05,
+        0x64, 0xB2, 0x09, 0x05, 0x0A, 0x30, 0xFD, 0xF3, 0xB7, 0x8D, 0x02, 0xA4, 0x69, 0x46, 0x6A, 0x6A,
+        0x40, 0x70, 0xEF, 0x00, 0xB2, 0xAB, 0x55, 0x31, 0x8B, 0xA7, 0x00, 0x0A, 0x02, 0x33, 0x2F, 0x1E,
+        0x1B, 0xCE, 0x6E, 0x4C, 0x1B, 0x87, 0x37, 0x99, 0x12, 0x61, 0x93, 0x04, 0x92, 0x1C, 0x7F, 0x37,
+        0x21, 0xF1, 0xF1, 0x2A, 0x49, 0x68, 0x45, 0x0A, 0xA5, 0x8D, 0x08, 0x36, 0x90, 0x51, 0x24, 0xD2,
+        0x93, 0x4A, 0x59, 0x42, 0x96, 0x48, 0x20, 0x99, 0xD5, 0x4D, 0x76, 0x00, 0x02, 0x7F, 0xF9, 0x67,
+        0x64, 0x12, 0x77, 0x9D, 0xCA, 0xDA, 0xCE, 0xCB, 0xCA, 0x49, 0x4A, 0xC9, 0x47, 0xC4, 0xC7, 0x4F,
+        0x1C, 0x75, 0xD6, 0xB8, 0xC6, 0x75, 0x9C, 0xDE, 0x73, 0x89, 0x96, 0xC7, 0x73, 0x93, 0x73, 0x32,
+        0xF6, 0x1C, 0xE4, 0xA3, 0x32, 0x32, 0x56, 0xD1, 0xC8, 0x95, 0x6C, 0x4D, 0x2E, 0x8D, 0x9D, 0xAC,
+        0xD2, 0x8A, 0x5D, 0x0D, 0x23, 0xB4, 0x0D, 0x12, 0xE7, 0xB9, 0x45, 0x4D, 0xE7, 0xB9, 0x4A, 0x6B,
+        0x61, 0x89, 0x24, 0x8C, 0xD6, 0xEA, 0x47, 0x79, 0xE8, 0x69, 0xA4, 0xDD, 0xCE, 0xC5, 0x47, 0x20,
+        0x70, 0xC0, 0x15, 0x9E, 0xBF, 0xD9, 0xF8, 0x76, 0x50, 0x80, 0x80, 0x00, 0x0F, 0xDF, 0x1B, 0x87,
+        0x2B, 0xC0, 0xB8, 0x02, 0x73, 0x72, 0xF3, 0x78, 0x19, 0x58, 0x60, 0xDE, 0x76, 0x03, 0x40, 0x9D,
+        0x2E, 0x0D, 0x1A, 0x06, 0xC7, 0x7C, 0xFB, 0x94, 0x1D, 0x27, 0x63, 0x45, 0xE9, 0x35, 0xA2, 0x1E,
+        0x8D, 0xD8, 0xDE, 0xAF, 0xD8, 0x14, 0xBB, 0x6E, 0xD6, 0xD9, 0xCB, 0xD8, 0xDD, 0x98, 0xDC, 0x2B,
+        0x57, 0x7A, 0xCE, 0x37, 0x9E, 0xB5, 0xD7, 0x76, 0x1A, 0x65, 0x09, 0x94, 0xE8, 0xD7, 0xAF, 0x87,
+        0x83, 0xA7, 0xC2, 0xE5, 0x71, 0x64, 0x6E, 0x17, 0xEE, 0x7C, 0xCE, 0x65, 0xCA, 0x12, 0xA3, 0x4C,
+        0x8D, 0x01, 0x47, 0x92, 0x49, 0xC2, 0x8F, 0x4C, 0xA5, 0x4B, 0x52, 0x90, 0xA5, 0x24, 0x94, 0x64,
+        0xA1, 0x69, 0x62, 0xAA, 0xA3, 0x81, 0x1C, 0x15, 0xAA, 0x05, 0x51, 0x42, 0x31, 0x02, 0x8E, 0x20,
+        0x50, 0x82, 0xA0, 0xA0, 0xE2, 0x11, 0xA1, 0x0A, 0x1E, 0x84, 0x39, 0x78, 0xF3, 0x00, 0xE1, 0x97,
+        0xE0, 0xDC, 0x24, 0x87, 0x18, 0x67, 0x03, 0x85, 0x02, 0x92, 0x43, 0x53, 0xC4, 0xD5, 0x4E, 0x80,
+        0x9C, 0x38, 0x3C, 0xE0, 0x4F, 0x2B, 0xF9, 0x54, 0x41, 0x9A, 0xEC, 0x7D, 0xAF, 0x89, 0x68, 0xF6,
+        0x5B, 0x18, 0x03, 0x07, 0x20, 0x71, 0x86, 0xE5, 0xE6, 0xE5, 0x00, 0xDE, 0x51, 0xCD, 0xE6, 0xDC,
+        0x08, 0x97, 0x37, 0xC4, 0x42, 0x60, 0x19, 0x7E, 0x53, 0x09, 0x82, 0x07, 0x18, 0x67, 0x2E, 0x1C,
+        0x18, 0x3C, 0xC0, 0x93, 0xC1, 0xE4, 0xC3, 0x26, 0x12, 0x8A, 0x9D, 0x0C, 0x2C, 0x08, 0x15, 0x18,
+        0x82, 0x8C, 0x40, 0xAD, 0x54, 0x70, 0x38, 0xC2, 0xF1, 0x14, 0x91, 0x21, 0x0E, 0x34, 0xCA, 0x89,
+        0x52, 0x4D, 0x43, 0xAA, 0xC5, 0x53, 0x28, 0x48, 0xC1, 0x84, 0x14, 0x85, 0x45, 0xD0, 0x02, 0x85,
+        0x87, 0xFE, 0xCA, 0x2F, 0x54, 0xB9, 0xE6, 0xED, 0x75, 0x92, 0x42, 0xA2, 0xF1, 0xE9, 0x34, 0x5E,
+        0x2D, 0x12, 0x86, 0xD2, 0x5C, 0x31, 0xDA, 0xD8, 0xE3, 0x4C, 0xE9, 0x5B, 0xD6, 0x95, 0xA4, 0xB6,
+        0xF7, 0x39, 0xDC, 0xBD, 0xCB, 0x39, 0xC9, 0x65, 0xB0, 0xED, 0x8D, 0xAE, 0x71, 0xB1, 0x2C, 0xB1,
+        0xD3, 0x4B, 0xD9, 0xA6, 0x95, 0xAD, 0x13, 0x43, 0x67, 0x66, 0xB3, 0x43, 0x60, 0xF6, 0x33, 0xB3,
+        0x43, 0x42, 0x74, 0x83, 0xDA, 0x1A, 0x5E, 0xC6, 0x86, 0xE8, 0x33, 0xB1, 0xA6, 0x9A, 0x17, 0x3D,
+        0xCF, 0x54, 0x61, 0x40, 0x00, 0x50, 0x1B, 0xDD, 0xF6, 0x7B, 0xB4, 0xCC, 0x69, 0x20, 0x09, 0x16,
+        0x33, 0x36, 0x33, 0x37, 0xCE, 0xF2, 0xE0, 0xD7, 0x84, 0xEF, 0x2E, 0x6F, 0x89, 0x70, 0x29, 0xC5,
+        0xA2, 0xAD, 0x4D, 0x5A, 0x02, 0x50, 0xBB, 0x12, 0xEE, 0x53, 0x79, 0xB5, 0x06, 0xB7, 0x9D, 0xB3,
+        0xA5, 0x67, 0x68, 0x0F, 0xA9, 0x4D, 0xDD, 0x9D, 0xA6, 0xED, 0x4B, 0x23, 0x25, 0xED, 0x9C, 0xCE,
+        0x6D, 0xBF, 0x32, 0x6B, 0x73, 0x9C, 0xEF, 0x3A, 0xE3, 0x3B, 0xEB, 0x7E, 0x7B, 0xF1, 0x71, 0xF1,
+        0xD2, 0x52, 0xB2, 0xB3, 0xB4, 0x95, 0x16, 0x78, 0x5C, 0xFF, 0x41, 0xEE, 0xBD, 0xB5, 0x5F, 0x90,
+        0x37, 0xFD, 0xD7, 0xF5, 0xDD, 0x64, 0x51, 0x66, 0x0F, 0xA3, 0x98, 0x2E, 0x4C, 0x70, 0xB2, 0x23,
+        0x44, 0x8F, 0x4D, 0x34, 0x97, 0x09, 0x53, 0x0A, 0x4A, 0x92, 0xA2, 0x52, 0x84, 0x7D, 0x54, 0x71,
+        0x43, 0x55, 0xA5, 0x1C, 0x08, 0xC1, 0x40, 0xE0, 0xF5, 0x7C, 0x0A, 0x85, 0x14, 0x28, 0x14, 0x60,
+        0xD0, 0xA1, 0x0A, 0x11, 0xE2, 0x6A, 0x84, 0x7C, 0x79, 0x1E, 0x07, 0x1F, 0x18, 0x8F, 0x8F, 0x03,
+        0x86, 0xFC, 0xBC, 0xC9, 0x80, 0x3C, 0x33, 0xC6, 0x60, 0x73, 0x83, 0xE3, 0x07, 0x0E, 0x1C, 0x07,
+        0xCC, 0xBF, 0x37, 0x80, 0xA3, 0x00, 0xE6, 0xF7, 0xB5, 0xDE, 0xA8, 0x5B, 0x28, 0x80, 0x50, 0x40,
+        0x84, 0x09, 0x29, 0x84, 0x5D, 0x5E, 0x26, 0x15, 0xE2, 0x41, 0x43, 0x10, 0xEA, 0xD0, 0x86, 0x2A,
+        0xF0, 0x49, 0x1C, 0x1A, 0x9C, 0x5F, 0x13, 0x45, 0x51, 0x43, 0x97, 0x3C, 0x43, 0x86, 0x43, 0x26,
+        0x69, 0x70, 0xD6, 0x2A, 0xF0, 0x71, 0x02, 0x8E, 0x04, 0x10, 0xAA, 0xA3, 0x88, 0x15, 0x50, 0xB4,
+        0x34, 0x8E, 0x40, 0xD2, 0x66, 0x91, 0x60, 0x39, 0x33, 0x60, 0x94, 0x46, 0x40, 0xC7, 0x44, 0xC8,
+        0x26, 0x82, 0xCA, 0x2A, 0xC1, 0x76, 0x6D, 0x8E, 0x60, 0x68, 0x9C, 0xA4, 0xD1, 0x0C, 0xA0, 0x68,
+        0x40, 0x02, 0x9F, 0xCC, 0xED, 0xD6, 0xB5, 0xFA, 0x8B, 0x69, 0x55, 0x90, 0x10, 0x34, 0x05, 0xC6,
+        0x11, 0x9C, 0x51, 0x0A, 0xC2, 0x30, 0x7C, 0x1B, 0x4C, 0xF5, 0xC7, 0x6C, 0x31, 0xC3, 0x2A, 0xDE,
+        0xF5, 0xAD, 0xEB, 0x49, 0x4F, 0x73, 0xBD, 0xB9, 0xCF, 0x2B, 0x6F, 0x62, 0x76, 0x35, 0xF6, 0xBB,
+        0xE9, 0xBB, 0x3B, 0x77, 0x41, 0x3E, 0xCE, 0xD0, 0xDD, 0xAC, 0xD6, 0xE9, 0x00, 0xEE, 0xB3, 0x56,
+        0xC4, 0xD4, 0xB2, 0x06, 0xB4, 0x66, 0x9A, 0x15, 0x2A, 0x34, 0xD3, 0x43, 0x67, 0x67, 0x61, 0xA0,
+        0x9B, 0xBC, 0xBD, 0xF3, 0xB4, 0x66, 0x86, 0xA0, 0x00, 0x30, 0x8D, 0x7E, 0xFF, 0xE1, 0xFD, 0xB6,
+        0xA2, 0x28, 0x8A, 0x14, 0x95, 0x09, 0xA0, 0x04, 0xD4, 0xD4, 0xD4, 0x8A, 0x1D, 0x00, 0xE6, 0xDC,
+        0x0D, 0xE5, 0xCD, 0x12, 0x76, 0x31, 0xA7, 0x60, 0x68, 0x0D, 0x4A, 0xCD, 0x66, 0xEF, 0x36, 0xA0,
+        0xD6, 0x9A, 0x2F, 0x77, 0xCF, 0xAC, 0xDD, 0x20, 0xED, 0x83, 0x67, 0x68, 0xE5, 0x9D, 0xA2, 0x9D,
+        0xCB, 0x99, 0x9D, 0xBD, 0xBD, 0xCE, 0xF3, 0xB4, 0x4A, 0xD6, 0xF7, 0x96, 0x76, 0xCE, 0xBA, 0x67,
+        0x96, 0xFB, 0x6F, 0x81, 0x68, 0x9C, 0x5E, 0x39, 0x23, 0x93, 0x4C, 0x68, 0x75, 0x8C, 0x03, 0x84,
+        0x7B, 0xEF, 0xCC, 0x2E, 0xDE, 0xB8, 0xF9, 0x01, 0xBF, 0xFF, 0x4D, 0xF2, 0x82, 0x59, 0xA4, 0x9C,
+        0xA8, 0x92, 0x58, 0x91, 0x02, 0x23, 0x88, 0x8A, 0x1E, 0x3C, 0xB4, 0xCB, 0x0E, 0x12, 0xC2, 0x94,
+        0xC2, 0x92, 0xA2, 0x52, 0x87, 0x44, 0x69, 0x58, 0x68, 0x94, 0x06, 0xA2, 0x14, 0x90, 0x97, 0x06,
+        0xAA, 0x8F, 0x57, 0xC5, 0x0A, 0x11, 0x81, 0xC0, 0xE7, 0x32, 0x3C, 0x99, 0xC0, 0xCF, 0x0A, 0x75,
+        0x38, 0x81, 0x53, 0xA7, 0x42, 0x14, 0x01, 0x8F, 0x0E, 0x06, 0x43, 0x26, 0x1C, 0x07, 0x81, 0xC7,
+        0xC7, 0xC4, 0xE0, 0x73, 0x9A, 0x51, 0x8B, 0xC4, 0x04, 0x68, 0x0A, 0x10, 0xE9, 0x08, 0xCF, 0x83,
+        0xF8, 0xBF, 0x75, 0xC7, 0x86, 0x13, 0x09, 0x45, 0x01, 0x8A, 0x20, 0x73, 0x79, 0xBC, 0xDE, 0x1B,
+        0xC0, 0x04, 0x37, 0x99, 0x4E, 0x69, 0x90, 0x7C, 0x46, 0x33, 0x0F, 0x10, 0xE0, 0x64, 0x30, 0x63,
+        0xC8, 0xF3, 0x9B, 0xCC, 0x86, 0x4C, 0x0A, 0x82, 0x58, 0xA2, 0x30, 0x6A, 0x84, 0x62, 0x08, 0x2C,
+        0x2A, 0xD0, 0x58, 0x55, 0xA1, 0xC5, 0x41, 0xB3, 0x35, 0x12, 0x89, 0x46, 0xA4, 0xA9, 0x2A, 0x53,
+        0x04, 0x81, 0x8C, 0x92, 0x2A, 0x24, 0xA2, 0x6C, 0x17, 0x60, 0xDD, 0xA3, 0x83, 0xAA, 0x09, 0x04,
+        0xE3, 0x52, 0x09, 0x59, 0x04, 0x61, 0x2E, 0xF6, 0x02, 0x9F, 0xD2, 0x6F, 0x89, 0x1A, 0x97, 0xD7,
+        0x3C, 0xE3, 0x5E, 0x45, 0x61, 0xF0, 0x07, 0x1E, 0xC8, 0x11, 0x6C, 0x33, 0x07, 0x41, 0xB0, 0x85,
+        0x30, 0xE3, 0xAE, 0xB8, 0x5F, 0x3C, 0xE9, 0x9D, 0x2D, 0x6C, 0x63, 0x84, 0xA7, 0x79, 0xDE, 0xDD,
+        0xE7, 0x73, 0x33, 0x91, 0xCB, 0x29, 0x76, 0xED, 0xCC, 0x8D, 0x86, 0x72, 0x58, 0x9F, 0x4D, 0x36,
+        0x76, 0xB5, 0xA6, 0x83, 0xBA, 0x1B, 0x3B, 0x3B, 0x1A, 0x76, 0x69, 0x56, 0xEA, 0x66, 0xA5, 0xC4,
+        0xB8, 0xDE, 0x37, 0x03, 0x75, 0x9A, 0x68, 0x57, 0x49, 0xD8, 0x2D, 0x67, 0x66, 0x81, 0xAC, 0xA8,
+        0x80, 0x28, 0x06, 0x49, 0xF9, 0xFE, 0xFF, 0x9F, 0x0A, 0xA2, 0x31, 0x92, 0x11, 0x02, 0x3B, 0xC9,
+        0xDE, 0x6C, 0x4F, 0x3A, 0x25, 0xCB, 0x9B, 0xE7, 0x62, 0x46, 0x77, 0xC2, 0xB5, 0x25, 0x09, 0x05,
+        0xD6, 0xEA, 0x55, 0x95, 0x4C, 0xA2, 0xCA, 0xB5, 0x68, 0x4C, 0xD1, 0x6E, 0xB7, 0x5B, 0xC5, 0xB2,
+        0xED, 0x09, 0x99, 0x21, 0x2B, 0x94, 0x72, 0x26, 0x66, 0x65, 0x6E, 0xC9, 0x6E, 0x5F, 0x2B, 0x7B,
+        0x1E, 0x5D, 0xE7, 0x3C, 0xE5, 0x16, 0xB7, 0xB5, 0xAD, 0x7C, 0xEF, 0x9D, 0xF8, 0x63, 0xBF, 0x1E,
+        0x58, 0x11, 0x8C, 0xC6, 0x63, 0x72, 0x89, 0x54, 0xCA, 0x91, 0x5F, 0xC2, 0xBA, 0x3F, 0xE7, 0xDF,
+        0xCA, 0xF3, 0x5F, 0xCA, 0x5F, 0xCD, 0xCF, 0xFF, 0x64, 0xDE, 0x95, 0x5E, 0xC2, 0x1F, 0x20, 0x4B,
+        0x86, 0x83, 0xC3, 0x84, 0x44, 0x44, 0x83, 0x82, 0xC9, 0x72, 0xA8, 0xA1, 0x51, 0x4C, 0x87, 0x48,
+        0x48, 0x8C, 0xC5, 0x30, 0xE8, 0x90, 0x95, 0x03, 0x20, 0x90, 0x59, 0x19, 0x20, 0x85, 0x88, 0xAA,
+        0x1C, 0x08, 0x5A, 0x51, 0x42, 0x81, 0x70, 0x0E, 0x06, 0x82, 0x81, 0x55, 0x3C, 0x00, 0x54, 0x70,
+        0x70, 0x54, 0x0C, 0x1A, 0x9E, 0x26, 0x8A, 0xA6, 0x84, 0x28, 0x40, 0xF0, 0xE2, 0x91, 0x1E, 0x1C,
+        0x0C, 0x9C, 0x1F, 0x19, 0x91, 0x1F, 0x1E, 0x6F, 0x38, 0x47, 0x20, 0x70, 0xC4, 0x1D, 0x1D, 0x1F,
+        0x83, 0xE8, 0xB8, 0x32, 0x94, 0xAA, 0x1B, 0x0A, 0x00, 0x92, 0xA9, 0x38, 0x9A, 0x28, 0x5E, 0x2A,
+        0xD0, 0x28, 0x57, 0x82, 0xF8, 0xB4, 0x71, 0x78, 0x89, 0xC1, 0x11, 0x41, 0x44, 0xF1, 0x34, 0x71,
+        0x3C, 0x4C, 0x12, 0x84, 0x70, 0x70, 0x6A, 0x78, 0x9E, 0x27, 0x89, 0x2E, 0x2F, 0x10, 0xA3, 0x04,
+        0x55, 0x50, 0xA3, 0xD1, 0x15, 0xA1, 0x55, 0x55, 0x47, 0x8C, 0x1E, 0x2A, 0x0E, 0xC8, 0x19, 0x06,
+        0x49, 0x09, 0x4A, 0xD2, 0xA5, 0x30, 0xB2, 0x9C, 0x72, 0x0C, 0x20, 0xC2, 0x10, 0x94, 0x81, 0x12,
+        0x34, 0x4A, 0x95, 0x2C, 0x41, 0x48, 0xAC, 0x66, 0x49, 0x30, 0x21, 0x6D, 0x21, 0xF3, 0xC0, 0x02,
+        0x9F, 0xD6, 0x8F, 0xB9, 0x5B, 0xA3, 0xE1, 0x2E, 0xA8, 0xB2, 0x23, 0x61, 0x24, 0x06, 0x8F, 0xA4,
+        0x38, 0xD2, 0x18, 0x83, 0xA1, 0x08, 0x42, 0x99, 0xED, 0xC3, 0x3D, 0x31, 0xCA, 0xF9, 0xD7, 0x29,
+        0xE3, 0x6A, 0x61, 0x27, 0xED, 0xEF, 0x6F, 0x7B, 0x9D, 0x8C, 0xEC, 0x6E, 0x4B, 0x6A, 0xDE, 0xC4,
+        0xCE, 0x63, 0x27, 0x22, 0x64, 0x4D, 0xAD, 0xED, 0x35, 0x9F, 0x49, 0xDD, 0x20, 0xCB, 0x16, 0x84,
+        0xCC, 0x5C, 0x6E, 0xA4, 0x76, 0x33, 0xB3, 0xB3, 0xBE, 0x6E, 0x9A, 0x03, 0xBA, 0x13, 0xF7, 0x95,
+        0xA3, 0x4D, 0x46, 0x1A, 0x68, 0x54, 0x2B, 0x3B, 0x10, 0x23, 0x08, 0x81, 0x1E, 0xFF, 0x9F, 0xCB,
+        0x59, 0x98, 0xC0, 0x8C, 0xA2, 0xCE, 0x76, 0x06, 0xE4, 0xDE, 0x68, 0x21, 0xBE, 0xFC, 0xF8, 0x07,
+        0xDA, 0x09, 0xB1, 0xD8, 0xD6, 0x35, 0xA0, 0x52, 0x0A, 0xDE, 0x2E, 0x6B, 0x78, 0xB5, 0x6C, 0x92,
+        0x99, 0xAD, 0x89, 0x03, 0x78, 0xE5, 0x5A, 0x92, 0x99, 0x13, 0x2B, 0x95, 0x6E, 0x66, 0x5D, 0xC9,
+        0x3D, 0x8D, 0xCB, 0xDD, 0xE5, 0xF3, 0x9B, 0xE6, 0xFB, 0x43, 0xB6, 0x34, 0xC2, 0xF8, 0x61, 0x96,
+        0x79, 0x67, 0xC3, 0x5E, 0x1D, 0x30, 0x2D, 0x15, 0x8E, 0xC7, 0xA4, 0x93, 0x09, 0xCD, 0x2A, 0xC1,
+        0x8A, 0x75, 0xCF, 0xDF, 0xBF, 0xBC, 0xE9, 0x9F, 0xB3, 0x3F, 0xC4, 0xCF, 0xFF, 0xA9, 0x71, 0x86,
+        0x58, 0xB8, 0x73, 0xF4, 0x21, 0xA8, 0xC8, 0x78, 0x88, 0x88, 0xA0, 0x90, 0x58, 0x88, 0xF2, 0xE1,
+        0xB6, 0x1C, 0x29, 0x96, 0x18, 0x5A, 0x59, 0x26, 0x89, 0x43, 0xA2, 0x52, 0x8C, 0xD4, 0x4A, 0x05,
+        0x28, 0x09, 0x04, 0x2E, 0x05, 0x54, 0x62, 0x16, 0x85, 0x50, 0xA8, 0x45, 0x18, 0x80, 0xB5, 0x3C,
+        0x03, 0xD4, 0xD4, 0x28, 0x20, 0xB5, 0x35, 0x4F, 0x0F, 0x89, 0xAA, 0x28, 0x8F, 0x8F, 0x8C, 0xC3,
+        0x87, 0x03, 0xF3, 0x78, 0x11, 0xC5, 0x15, 0x01, 0x40, 0xA4, 0x6A, 0x78, 0x1D, 0xE1, 0x90, 0x32,
+        0x3E, 0x3E, 0x77, 0xC5, 0x01, 0x27, 0x07, 0xD1, 0xE6, 0xB0, 0xAB, 0x58, 0x88, 0x61, 0x04, 0xA8,
+        0x14, 0x39, 0x5E, 0x6F, 0x02, 0x3C, 0xD0, 0x78, 0x6F, 0xE6, 0x81, 0xC6, 0x1C, 0xDC, 0x83, 0xC6,
+        0x65, 0xF9, 0x72, 0x60, 0x70, 0x98, 0x40, 0xE2, 0xA6, 0xA1, 0x1C, 0x42, 0x89, 0xE2, 0x4B, 0x80,
+        0x38, 0x9E, 0x2F, 0xA3, 0x83, 0x55, 0x42, 0x8A, 0x8F, 0x47, 0x11, 0x55, 0x51, 0x8A, 0x8E, 0x07,
+        0x06, 0xC9, 0x48, 0x49, 0x2D, 0x28, 0x5A, 0x18, 0x52, 0x94, 0xC1, 0x52, 0x41, 0x24, 0x96, 0x61,
+        0x66, 0x21, 0x39, 0x0A, 0x54, 0xE9, 0x97, 0x2F, 0x41, 0x28, 0xC4, 0x74, 0x4B, 0x30, 0xA2, 0xAD,
+        0x81, 0xF7, 0xC0, 0x00, 0x00, 0x00, 0x00
+    };
+
+    static const AKWFTableRef tables[count] PROGMEM = {
+        { data +      0, 600 },   //   0 AKWF_tri_0001
+        { data +    278, 600 },   //   1 AKWF_tri_0002
+        { data +    636, 600 },   //   2 AKWF_tri_0003
+        { data +   1019, 600 },   //   3 AKWF_tri_0004
+        { data +   1401, 600 },   //   4 AKWF_tri_0005
+        { data +   1663, 600 },   //   5 AKWF_tri_0006
+        { data +   1934, 600 },   //   6 AKWF_tri_0007
+        { data +   2225, 600 },   //   7 AKWF_tri_0008
+        { data +   2781, 600 },   //   8 AKWF_tri_0009
+        { data +   3026, 600 },   //   9 AKWF_tri_0010
+        { data +   3320, 600 },   //  10 AKWF_tri_0011
+        { data +   3663, 600 },   //  11 AKWF_tri_0012
+        { data +   4001, 600 },   //  12 AKWF_tri_0013
+        { data +   4320, 600 },   //  13 AKWF_tri_0014
+        { data +   4644, 600 },   //  14 AKWF_tri_0015
+        { data +   4961, 600 },   //  15 AKWF_tri_0016
+        { data +   5277, 600 },   //  16 AKWF_tri_0017
+        { data +   5582, 600 },   //  17 AKWF_tri_0018
+        { data +   5868, 600 },   //  18 AKWF_tri_0019
+        { data +   6174, 600 },   //  19 AKWF_tri_0020
+        { data +   6492, 600 },   //  20 AKWF_tri_0021
+        { data +   6830, 600 },   //  21 AKWF_tri_0022
+        { data +   7185, 600 },   //  22 AKWF_tri_0023
+        { data +   7544, 600 },   //  23 AKWF_tri_0024
+        { data +   7919, 600 }    //  24 AKWF_tri_0025
+    };
+
+} // namespace AKWF_BwTri
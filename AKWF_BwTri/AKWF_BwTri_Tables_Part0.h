@@ -1,1304 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwTri {
-
-    // AKWF_tri_0001 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0001[600] PROGMEM = {
-        8, 284, 557, 830, 1101, 1371, 1639, 1906, 2171, 2436, 2698, 2959, 
-        3217, 3476, 3731, 3987, 4241, 4493, 4744, 4993, 5241, 5487, 5734, 5977, 
-        6219, 6461, 6701, 6939, 7177, 7412, 7646, 7879, 8111, 8341, 8570, 8798, 
-        9024, 9249, 9474, 9695, 9917, 10137, 10356, 10573, 10790, 11005, 11219, 11430, 
-        11642, 11852, 12061, 12269, 12475, 12681, 12883, 13086, 13288, 13488, 13687, 13886, 
-        14083, 14278, 14472, 14665, 14858, 15049, 15239, 15427, 15615, 15802, 15987, 16171, 
-        16354, 16536, 16717, 16897, 17075, 17253, 17430, 17606, 17780, 17953, 18125, 18296, 
-        18467, 18636, 18804, 18971, 19137, 19301, 19466, 19628, 19790, 19950, 20111, 20269, 
-        20428, 20585, 20741, 20895, 21048, 21202, 21354, 21505, 21654, 21804, 21951, 22098, 
-        22245, 22390, 22535, 22678, 22820, 22961, 23102, 23242, 23381, 23518, 23655, 23791, 
-        23926, 24061, 24194, 24327, 24458, 24589, 24719, 24847, 24976, 25103, 25229, 25355, 
-        25479, 25603, 25726, 25849, 25970, 26090, 26210, 26329, 26447, 26564, 26680, 26796, 
-        26911, 27025, 27137, 27250, 27362, 27472, 27583, 27691, 27800, 27908, 28015, 28122, 
-        28227, 28331, 28435, 28538, 28641, 28742, 28843, 28943, 29043, 29142, 29240, 29337, 
-        29434, 29529, 29624, 29718, 29812, 29905, 29998, 30089, 30181, 30270, 30360, 30449, 
-        30537, 30625, 30711, 30798, 30883, 30967, 31051, 31135, 31218, 31300, 31381, 31462, 
-        31542, 31622, 31700, 31779, 31856, 31934, 32009, 32087, 32160, 32236, 32310, 32382, 
-        32458, 32524, 32607, 32657, 32767, 32640, 32176, 31746, 31302, 30866, 30433, 29998, 
-        29570, 29138, 28714, 28289, 27868, 27448, 27030, 26614, 26201, 25788, 25379, 24971, 
-        24565, 24161, 23759, 23360, 22963, 22567, 22174, 21782, 21392, 21005, 20619, 20236, 
-        19854, 19474, 19097, 18721, 18348, 17976, 17606, 17237, 16871, 16508, 16145, 15784, 
-        15427, 15070, 14715, 14362, 14011, 13661, 13315, 12969, 12625, 12282, 11942, 11605, 
-        11268, 10933, 10599, 10268, 9939, 9611, 9285, 8961, 8638, 8317, 7998, 7680, 
-        7365, 7050, 6738, 6427, 6118, 5810, 5505, 5201, 4898, 4597, 4298, 4000, 
-        3704, 3410, 3117, 2825, 2536, 2248, 1961, 1676, 1393, 1111, 830, 551, 
-        274, -1, -275, -547, -819, -1089, -1357, -1624, -1889, -2154, -2416, -2677, 
-        -2936, -3194, -3451, -3706, -3960, -4213, -4464, -4712, -4961, -5208, -5453, -5696, 
-        -5940, -6181, -6421, -6660, -6896, -7132, -7367, -7599, -7832, -8062, -8292, -8520, 
-        -8746, -8971, -9195, -9418, -9640, -9860, -10079, -10296, -10513, -10728, -10942, -11155, 
-        -11365, -11575, -11784, -11992, -12198, -12404, -12608, -12810, -13013, -13214, -13413, -13610, 
-        -13807, -14004, -14198, -14392, -14584, -14775, -14965, -15154, -15342, -15528, -15714, -15898, 
-        -16081, -16263, -16445, -16624, -16803, -16981, -17158, -17334, -17508, -17681, -17854, -18025, 
-        -18196, -18365, -18533, -18700, -18866, -19032, -19196, -19359, -19521, -19682, -19842, -20001, 
-        -20159, -20316, -20472, -20627, -20781, -20933, -21086, -21238, -21387, -21537, -21685, -21832, 
-        -21978, -22124, -22269, -22412, -22555, -22697, -22838, -22978, -23116, -23255, -23392, -23528, 
-        -23663, -23797, -23931, -24063, -24196, -24327, -24456, -24585, -24714, -24841, -24967, -25093, 
-        -25218, -25342, -25466, -25588, -25709, -25830, -25950, -26069, -26188, -26305, -26421, -26536, 
-        -26651, -26766, -26879, -26993, -27104, -27215, -27325, -27434, -27543, -27652, -27758, -27864, 
-        -27971, -28075, -28180, -28282, -28385, -28488, -28588, -28689, -28788, -28887, -28986, -29083, 
-        -29180, -29275, -29371, -29466, -29560, -29653, -29745, -29837, -29928, -30019, -30109, -30198, 
-        -30286, -30373, -30461, -30547, -30633, -30717, -30803, -30885, -30968, -31051, -31133, -31214, 
-        -31295, -31374, -31453, -31532, -31610, -31688, -31763, -31841, -31914, -31991, -32063, -32139, 
-        -32210, -32283, -32358, -32418, -32515, -32282, -31803, -31381, -30931, -30501, -30062, -29630, 
-        -29201, -28771, -28347, -27921, -27501, -27080, -26664, -26248, -25835, -25423, -25013, -24606, 
-        -24201, -23796, -23396, -22996, -22598, -22202, -21809, -21418, -21029, -20642, -20256, -19872, 
-        -19492, -19112, -18735, -18359, -17985, -17615, -17245, -16878, -16511, -16147, -15786, -15425, 
-        -15067, -14710, -14356, -14002, -13653, -13303, -12956, -12610, -12268, -11925, -11585, -11247, 
-        -10911, -10576, -10243, -9912, -9583, -9255, -8930, -8606, -8283, -7963, -7644, -7326, 
-        -7011, -6697, -6385, -6074, -5766, -5458, -5152, -4848, -4546, -4246, -3947, -3649, 
-        -3353, -3059, -2767, -2475, -2186, -1898, -1612, -1328, -1044, -762, -482, -204 
-    };
-
-    // AKWF_tri_0002 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0002[600] PROGMEM = {
-        215, 414, 631, 842, 1063, 1282, 1507, 1729, 1959, 2186, 2416, 2650, 
-        2884, 3120, 3356, 3594, 3836, 4076, 4319, 4563, 4810, 5053, 5303, 5552, 
-        5804, 6051, 6307, 6557, 6815, 7068, 7324, 7584, 7840, 8101, 8360, 8619, 
-        8884, 9145, 9408, 9671, 9934, 10201, 10464, 10733, 10997, 11264, 11534, 11799, 
-        12067, 12334, 12604, 12872, 13140, 13409, 13675, 13946, 14212, 14482, 14750, 15016, 
-        15285, 15552, 15820, 16086, 16352, 16619, 16884, 17146, 17414, 17673, 17940, 18199, 
-        18461, 18721, 18981, 19241, 19500, 19753, 20013, 20266, 20520, 20773, 21025, 21277, 
-        21522, 21775, 22018, 22266, 22510, 22751, 22994, 23233, 23472, 23709, 23944, 24177, 
-        24412, 24639, 24872, 25097, 25323, 25549, 25768, 25988, 26208, 26425, 26637, 26850, 
-        27063, 27269, 27478, 27683, 27883, 28087, 28283, 28479, 28674, 28864, 29057, 29240, 
-        29429, 29611, 29791, 29969, 30146, 30319, 30490, 30659, 30825, 30988, 31151, 31309, 
-        31465, 31618, 31769, 31919, 32064, 32208, 32348, 32487, 32623, 32739, 32765, 32732, 
-        32669, 32590, 32509, 32420, 32331, 32242, 32149, 32059, 31965, 31870, 31773, 31673, 
-        31572, 31467, 31357, 31250, 31131, 31016, 30898, 30770, 30645, 30513, 30377, 30240, 
-        30098, 29951, 29803, 29651, 29493, 29336, 29171, 29005, 28837, 28663, 28489, 28306, 
-        28129, 27941, 27755, 27561, 27370, 27174, 26974, 26770, 26569, 26359, 26151, 25940, 
-        25725, 25508, 25290, 25069, 24846, 24621, 24396, 24164, 23937, 23700, 23468, 23232, 
-        22993, 22752, 22511, 22270, 22024, 21779, 21532, 21281, 21034, 20782, 20527, 20278, 
-        20017, 19765, 19506, 19248, 18990, 18728, 18468, 18205, 17943, 17679, 17414, 17151, 
-        16883, 16619, 16350, 16084, 15814, 15547, 15277, 15010, 14740, 14470, 14201, 13931, 
-        13659, 13389, 13119, 12849, 12578, 12309, 12040, 11769, 11500, 11231, 10961, 10696, 
-        10426, 10160, 9892, 9628, 9361, 9098, 8834, 8571, 8311, 8047, 7792, 7532, 
-        7275, 7022, 6764, 6513, 6262, 6013, 5765, 5520, 5277, 5035, 4797, 4561, 
-        4327, 4095, 3869, 3640, 3422, 3202, 2989, 2778, 2576, 2372, 2180, 1993, 
-        1811, 1642, 1485, 1347, 1219, 1085, 934, 772, 599, 415, 225, 28, 
-        -173, -381, -590, -806, -1025, -1242, -1467, -1690, -1918, -2147, -2377, -2609, 
-        -2842, -3081, -3313, -3554, -3792, -4034, -4277, -4520, -4767, -5012, -5260, -5508, 
-        -5758, -6009, -6261, -6515, -6770, -7024, -7281, -7538, -7795, -8054, -8316, -8575, 
-        -8838, -9099, -9363, -9626, -9889, -10155, -10420, -10686, -10952, -11220, -11486, -11753, 
-        -12021, -12288, -12557, -12826, -13091, -13362, -13630, -13898, -14167, -14435, -14705, -14971, 
-        -15238, -15507, -15772, -16041, -16304, -16574, -16835, -17101, -17368, -17627, -17894, -18153, 
-        -18417, -18675, -18938, -19196, -19452, -19713, -19965, -20223, -20476, -20729, -20982, -21231, 
-        -21483, -21730, -21977, -22223, -22467, -22710, -22951, -23193, -23429, -23669, -23904, -24138, 
-        -24372, -24601, -24830, -25059, -25284, -25508, -25732, -25950, -26170, -26385, -26603, -26814, 
-        -27026, -27233, -27443, -27646, -27849, -28053, -28248, -28446, -28640, -28832, -29022, -29211, 
-        -29396, -29579, -29760, -29939, -30113, -30290, -30459, -30630, -30796, -30960, -31122, -31282, 
-        -31437, -31592, -31743, -31893, -32039, -32182, -32325, -32462, -32599, -32725, -32767, -32739, 
-        -32681, -32605, -32522, -32435, -32348, -32257, -32166, -32076, -31980, -31887, -31789, -31692, 
-        -31589, -31485, -31378, -31267, -31154, -31037, -30918, -30793, -30666, -30535, -30403, -30263, 
-        -30121, -29978, -29829, -29676, -29523, -29363, -29201, -29036, -28865, -28694, -28518, -28341, 
-        -28158, -27975, -27786, -27597, -27402, -27207, -27009, -26808, -26603, -26396, -26188, -25976, 
-        -25762, -25548, -25330, -25106, -24888, -24661, -24435, -24205, -23975, -23742, -23508, -23271, 
-        -23035, -22794, -22554, -22313, -22066, -21824, -21574, -21327, -21076, -20826, -20573, -20318, 
-        -20066, -19807, -19552, -19293, -19033, -18775, -18512, -18250, -17989, -17724, -17461, -17195, 
-        -16929, -16666, -16396, -16132, -15860, -15595, -15324, -15057, -14785, -14518, -14248, -13978, 
-        -13707, -13435, -13168, -12895, -12627, -12356, -12086, -11818, -11545, -11279, -11010, -10739, 
-        -10474, -10204, -9940, -9672, -9409, -9141, -8880, -8618, -8354, -8096, -7834, -7576, 
-        -7321, -7063, -6809, -6557, -6305, -6056, -5809, -5562, -5319, -5078, -4838, -4600, 
-        -4366, -4135, -3907, -3682, -3458, -3239, -3028, -2812, -2611, -2406, -2214, -2023, 
-        -1843, -1672, -1509, -1370, -1240, -1109, -963, -799, -631, -447, -263, -44 
-    };
-
-    // AKWF_tri_0003 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0003[600] PROGMEM = {
-        355, 693, 1040, 1369, 1701, 2022, 2343, 2658, 2973, 3282, 3594, 3900, 
-        4209, 4521, 4835, 5160, 5490, 5833, 6186, 6556, 6939, 7336, 7752, 8183, 
-        8633, 9103, 9589, 10097, 10624, 11167, 11731, 12305, 12899, 13503, 14115, 14739, 
-        15366, 16000, 16637, 17276, 17912, 18549, 19181, 19804, 20425, 21032, 21630, 22218, 
-        22787, 23346, 23888, 24413, 24923, 25411, 25886, 26340, 26775, 27193, 27589, 27969, 
-        28327, 28668, 28989, 29295, 29580, 29850, 30102, 30338, 30560, 30763, 30954, 31130, 
-        31294, 31446, 31583, 31711, 31830, 31935, 32033, 32122, 32201, 32276, 32342, 32400, 
-        32453, 32503, 32543, 32582, 32615, 32644, 32669, 32693, 32710, 32727, 32738, 32751, 
-        32756, 32763, 32763, 32767, 32763, 32760, 32753, 32744, 32731, 32719, 32700, 32682, 
-        32659, 32633, 32604, 32570, 32536, 32493, 32450, 32401, 32347, 32288, 32226, 32156, 
-        32083, 32001, 31916, 31821, 31720, 31612, 31494, 31372, 31233, 31091, 30933, 30762, 
-        30571, 30362, 30129, 29901, 29670, 29455, 29250, 29057, 28875, 28700, 28533, 28370, 
-        28211, 28055, 27903, 27755, 27612, 27472, 27337, 27210, 27084, 26968, 26851, 26745, 
-        26639, 26540, 26442, 26349, 26260, 26175, 26091, 26013, 25935, 25863, 25793, 25725, 
-        25662, 25598, 25538, 25481, 25423, 25370, 25316, 25265, 25214, 25164, 25116, 25068, 
-        25022, 24972, 24927, 24879, 24833, 24785, 24737, 24688, 24638, 24588, 24536, 24482, 
-        24428, 24372, 24315, 24254, 24192, 24128, 24063, 23992, 23924, 23847, 23771, 23692, 
-        23609, 23525, 23435, 23343, 23250, 23149, 23049, 22943, 22833, 22722, 22604, 22484, 
-        22360, 22232, 22099, 21967, 21823, 21683, 21534, 21383, 21226, 21067, 20901, 20734, 
-        20560, 20387, 20205, 20021, 19834, 19640, 19444, 19243, 19039, 18830, 18617, 18401, 
-        18183, 17955, 17729, 17498, 17261, 17022, 16778, 16533, 16281, 16029, 15772, 15510, 
-        15247, 14980, 14710, 14434, 14159, 13878, 13597, 13307, 13022, 12729, 12432, 12137, 
-        11835, 11535, 11227, 10920, 10611, 10295, 9983, 9663, 9346, 9024, 8699, 8374, 
-        8048, 7717, 7387, 7051, 6720, 6381, 6044, 5705, 5364, 5022, 4678, 4333, 
-        3989, 3641, 3293, 2944, 2595, 2245, 1892, 1541, 1188, 834, 480, 126, 
-        -228, -577, -920, -1255, -1587, -1911, -2233, -2550, -2865, -3176, -3485, -3794, 
-        -4103, -4413, -4725, -5047, -5374, -5713, -6063, -6427, -6805, -7198, -7605, -8033, 
-        -8476, -8937, -9419, -9918, -10440, -10978, -11535, -12105, -12693, -13294, -13903, -14522, 
-        -15150, -15780, -16417, -17054, -17692, -18326, -18964, -19587, -20212, -20822, -21427, -22015, 
-        -22592, -23153, -23704, -24232, -24749, -25245, -25724, -26186, -26627, -27050, -27455, -27839, 
-        -28205, -28553, -28882, -29191, -29485, -29761, -30017, -30259, -30485, -30695, -30888, -31073, 
-        -31240, -31395, -31538, -31669, -31790, -31900, -32000, -32092, -32178, -32250, -32321, -32381, 
-        -32436, -32487, -32529, -32570, -32604, -32636, -32661, -32684, -32706, -32721, -32736, -32747, 
-        -32754, -32763, -32763, -32767, -32764, -32762, -32755, -32749, -32736, -32725, -32706, -32690, 
-        -32668, -32641, -32616, -32582, -32548, -32508, -32467, -32417, -32366, -32310, -32249, -32182, 
-        -32109, -32031, -31945, -31856, -31755, -31651, -31536, -31414, -31284, -31140, -30990, -30822, 
-        -30641, -30437, -30212, -29979, -29750, -29528, -29320, -29121, -28937, -28759, -28590, -28424, 
-        -28266, -28108, -27956, -27804, -27659, -27521, -27382, -27254, -27128, -27007, -26892, -26784, 
-        -26674, -26575, -26476, -26381, -26291, -26202, -26120, -26038, -25962, -25886, -25815, -25750, 
-        -25682, -25620, -25560, -25500, -25445, -25387, -25336, -25282, -25232, -25181, -25133, -25085, 
-        -25037, -24990, -24943, -24896, -24849, -24802, -24753, -24705, -24656, -24605, -24554, -24502, 
-        -24447, -24393, -24334, -24274, -24215, -24150, -24087, -24016, -23948, -23874, -23798, -23720, 
-        -23639, -23555, -23467, -23376, -23284, -23185, -23084, -22982, -22873, -22760, -22648, -22527, 
-        -22404, -22279, -22148, -22013, -21875, -21732, -21586, -21435, -21282, -21123, -20960, -20794, 
-        -20623, -20448, -20269, -20087, -19899, -19707, -19513, -19314, -19110, -18903, -18692, -18478, 
-        -18256, -18036, -17809, -17579, -17343, -17106, -16863, -16620, -16368, -16120, -15861, -15602, 
-        -15340, -15072, -14804, -14530, -14258, -13976, -13695, -13408, -13122, -12829, -12537, -12240, 
-        -11941, -11639, -11335, -11027, -10718, -10406, -10091, -9778, -9456, -9136, -8814, -8487, 
-        -8160, -7833, -7501, -7169, -6835, -6499, -6162, -5823, -5482, -5143, -4798, -4454, 
-        -4109, -3763, -3414, -3067, -2716, -2367, -2014, -1665, -1308, -961, -598, -258 
-    };
-
-    // AKWF_tri_0004 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0004[600] PROGMEM = {
-        125, 514, 845, 1192, 1516, 1848, 2164, 2486, 2799, 3115, 3422, 3734, 
-        4038, 4352, 4662, 4984, 5308, 5646, 5993, 6353, 6731, 7119, 7524, 7950, 
-        8387, 8848, 9325, 9821, 10338, 10873, 11428, 11996, 12579, 13180, 13786, 14406, 
-        15032, 15663, 16298, 16936, 17574, 18212, 18847, 19475, 20098, 20713, 21316, 21911, 
-        22490, 23055, 23607, 24139, 24658, 25159, 25641, 26107, 26549, 26979, 27386, 27774, 
-        28144, 28495, 28825, 29140, 29436, 29713, 29975, 30220, 30449, 30661, 30858, 31043, 
-        31213, 31371, 31516, 31649, 31771, 31884, 31984, 32081, 32163, 32241, 32310, 32373, 
-        32427, 32481, 32525, 32564, 32600, 32631, 32658, 32683, 32702, 32721, 32734, 32746, 
-        32755, 32761, 32764, 32766, 32767, 32762, 32758, 32749, 32738, 32726, 32711, 32691, 
-        32673, 32647, 32621, 32588, 32554, 32516, 32471, 32427, 32375, 32319, 32258, 32192, 
-        32120, 32043, 31958, 31869, 31770, 31668, 31552, 31434, 31302, 31162, 31010, 30848, 
-        30666, 30467, 30242, 30010, 29781, 29556, 29348, 29147, 28961, 28782, 28612, 28447, 
-        28286, 28129, 27975, 27825, 27679, 27538, 27399, 27270, 27143, 27023, 26907, 26795, 
-        26690, 26586, 26488, 26392, 26302, 26215, 26130, 26049, 25971, 25896, 25826, 25756, 
-        25692, 25627, 25566, 25508, 25450, 25395, 25342, 25288, 25239, 25187, 25139, 25091, 
-        25044, 24995, 24948, 24902, 24855, 24807, 24759, 24711, 24661, 24612, 24560, 24508, 
-        24452, 24398, 24340, 24282, 24220, 24157, 24093, 24024, 23954, 23882, 23805, 23729, 
-        23646, 23563, 23476, 23383, 23293, 23194, 23093, 22991, 22881, 22772, 22656, 22538, 
-        22414, 22290, 22156, 22026, 21886, 21744, 21599, 21448, 21293, 21136, 20973, 20806, 
-        20635, 20461, 20284, 20099, 19915, 19721, 19528, 19328, 19126, 18919, 18707, 18492, 
-        18275, 18050, 17823, 17596, 17359, 17122, 16880, 16635, 16386, 16133, 15880, 15616, 
-        15356, 15089, 14821, 14546, 14273, 13993, 13711, 13425, 13137, 12849, 12552, 12257, 
-        11958, 11655, 11352, 11042, 10736, 10421, 10109, 9791, 9472, 9153, 8828, 8502, 
-        8178, 7847, 7517, 7182, 6851, 6515, 6176, 5839, 5497, 5157, 4813, 4467, 
-        4123, 3777, 3428, 3080, 2729, 2380, 2028, 1675, 1323, 970, 615, 262, 
-        -93, -445, -790, -1128, -1463, -1789, -2111, -2431, -2746, -3059, -3369, -3679, 
-        -3987, -4298, -4607, -4927, -5253, -5587, -5932, -6291, -6664, -7051, -7454, -7873, 
-        -8314, -8764, -9241, -9734, -10248, -10780, -11330, -11897, -12478, -13075, -13683, -14298, 
-        -14925, -15553, -16188, -16826, -17465, -18100, -18738, -19368, -19991, -20608, -21214, -21809, 
-        -22390, -22959, -23513, -24049, -24569, -25075, -25557, -26029, -26475, -26905, -27318, -27709, 
-        -28081, -28436, -28771, -29088, -29386, -29669, -29931, -30179, -30410, -30626, -30825, -31013, 
-        -31187, -31345, -31493, -31627, -31752, -31866, -31969, -32064, -32152, -32227, -32299, -32364, 
-        -32418, -32473, -32517, -32558, -32593, -32627, -32655, -32678, -32701, -32719, -32731, -32746, 
-        -32753, -32762, -32764, -32767, -32766, -32764, -32758, -32752, -32742, -32729, -32716, -32695, 
-        -32677, -32650, -32626, -32593, -32561, -32522, -32482, -32434, -32383, -32329, -32269, -32205, 
-        -32134, -32057, -31973, -31885, -31789, -31685, -31574, -31453, -31327, -31186, -31039, -30875, 
-        -30699, -30502, -30283, -30050, -29820, -29595, -29383, -29180, -28994, -28812, -28641, -28475, 
-        -28313, -28155, -28001, -27850, -27702, -27563, -27423, -27292, -27165, -27043, -26926, -26816, 
-        -26707, -26604, -26505, -26408, -26319, -26227, -26145, -26062, -25985, -25910, -25835, -25770, 
-        -25702, -25638, -25579, -25517, -25461, -25404, -25352, -25298, -25247, -25197, -25147, -25100, 
-        -25051, -25004, -24957, -24909, -24864, -24815, -24768, -24719, -24670, -24621, -24569, -24517, 
-        -24463, -24408, -24352, -24291, -24233, -24169, -24104, -24037, -23966, -23895, -23820, -23743, 
-        -23661, -23579, -23492, -23400, -23309, -23212, -23112, -23009, -22902, -22789, -22678, -22560, 
-        -22437, -22312, -22182, -22048, -21911, -21770, -21624, -21474, -21321, -21164, -21002, -20837, 
-        -20666, -20493, -20313, -20133, -19946, -19756, -19561, -19364, -19161, -18955, -18744, -18532, 
-        -18310, -18091, -17864, -17635, -17400, -17164, -16921, -16680, -16429, -16179, -15924, -15663, 
-        -15404, -15135, -14868, -14594, -14323, -14042, -13761, -13475, -13189, -12898, -12605, -12309, 
-        -12011, -11709, -11404, -11099, -10787, -10477, -10161, -9849, -9528, -9207, -8886, -8561, 
-        -8232, -7906, -7575, -7242, -6909, -6572, -6236, -5898, -5555, -5216, -4872, -4528, 
-        -4183, -3838, -3488, -3142, -2789, -2441, -2088, -1740, -1381, -1036, -671, -333 
-    };
-
-    // AKWF_tri_0005 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0005[600] PROGMEM = {
-        63, 301, 538, 777, 1014, 1252, 1489, 1728, 1965, 2203, 2440, 2679, 
-        2916, 3154, 3391, 3630, 3867, 4104, 4342, 4579, 4818, 5055, 5293, 5530, 
-        5769, 6006, 6244, 6481, 6720, 6957, 7195, 7432, 7671, 7908, 8146, 8383, 
-        8622, 8859, 9097, 9334, 9573, 9810, 10048, 10285, 10524, 10761, 10999, 11236, 
-        11475, 11712, 11950, 12187, 12426, 12663, 12901, 13138, 13377, 13614, 13852, 14089, 
-        14328, 14565, 14803, 15040, 15279, 15516, 15754, 15991, 16230, 16467, 16705, 16942, 
-        17181, 17418, 17656, 17893, 18132, 18369, 18607, 18844, 19083, 19320, 19558, 19795, 
-        20034, 20271, 20509, 20746, 20985, 21222, 21460, 21697, 21936, 22173, 22411, 22648, 
-        22887, 23124, 23362, 23599, 23836, 24075, 24312, 24550, 24787, 25026, 25263, 25501, 
-        25738, 25977, 26214, 26452, 26689, 26928, 27165, 27403, 27640, 27879, 28117, 28354, 
-        28591, 28830, 29067, 29305, 29542, 29781, 30018, 30256, 30493, 30731, 30969, 31207, 
-        31444, 31682, 31920, 32158, 32395, 32583, 32681, 32732, 32762, 32767, 32756, 32729, 
-        32693, 32645, 32590, 32528, 32457, 32379, 32295, 32203, 32103, 31997, 31886, 31767, 
-        31644, 31516, 31385, 31249, 31110, 30966, 30819, 30669, 30517, 30360, 30201, 30039, 
-        29874, 29706, 29535, 29361, 29185, 29006, 28825, 28642, 28456, 28268, 28077, 27886, 
-        27691, 27495, 27296, 27097, 26895, 26692, 26486, 26280, 26071, 25862, 25651, 25439, 
-        25225, 25010, 24794, 24577, 24358, 24140, 23919, 23698, 23475, 23252, 23029, 22803, 
-        22579, 22352, 22126, 21898, 21670, 21442, 21212, 20982, 20752, 20522, 20290, 20059, 
-        19828, 19595, 19362, 19129, 18896, 18662, 18428, 18195, 17960, 17725, 17491, 17255, 
-        17020, 16786, 16550, 16314, 16079, 15842, 15606, 15370, 15133, 14898, 14661, 14424, 
-        14188, 13951, 13714, 13477, 13240, 13003, 12766, 12529, 12292, 12055, 11818, 11579, 
-        11342, 11105, 10868, 10630, 10393, 10156, 9919, 9680, 9443, 9206, 8968, 8730, 
-        8492, 8255, 8018, 7780, 7542, 7304, 7067, 6829, 6591, 6354, 6116, 5879, 
-        5640, 5403, 5165, 4928, 4690, 4452, 4214, 3977, 3739, 3501, 3264, 3026, 
-        2789, 2551, 2313, 2075, 1838, 1600, 1362, 1124, 887, 649, 412, 173, 
-        -63, -301, -538, -777, -1014, -1252, -1489, -1728, -1965, -2203, -2440, -2679, 
-        -2916, -3154, -3391, -3630, -3867, -4104, -4342, -4579, -4818, -5055, -5293, -5530, 
-        -5769, -6006, -6244, -6481, -6720, -6957, -7195, -7432, -7671, -7908, -8146, -8383, 
-        -8622, -8859, -9097, -9334, -9573, -9810, -10048, -10285, -10524, -10761, -10999, -11236, 
-        -11475, -11712, -11950, -12187, -12426, -12663, -12901, -13138, -13377, -13614, -13852, -14089, 
-        -14328, -14565, -14803, -15040, -15279, -15516, -15754, -15991, -16230, -16467, -16705, -16942, 
-        -17181, -17418, -17656, -17893, -18132, -18369, -18607, -18844, -19083, -19320, -19558, -19795, 
-        -20034, -20271, -20509, -20746, -20985, -21222, -21460, -21697, -21936, -22173, -22411, -22648, 
-        -22887, -23124, -23362, -23599, -23836, -24075, -24312, -24550, -24787, -25026, -25263, -25501, 
-        -25738, -25977, -26214, -26452, -26689, -26928, -27165, -27403, -27640, -27879, -28117, -28354, 
-        -28591, -28830, -29067, -29305, -29542, -29781, -30018, -30256, -30493, -30731, -30969, -31207, 
-        -31444, -31682, -31920, -32158, -32395, -32583, -32681, -32732, -32762, -32767, -32756, -32729, 
-        -32693, -32645, -32590, -32528, -32457, -32379, -32295, -32203, -32103, -31997, -31886, -31767, 
-        -31644, -31516, -31385, -31249, -31110, -30966, -30819, -30669, -30517, -30360, -30201, -30039, 
-        -29874, -29706, -29535, -29361, -29185, -29006, -28825, -28642, -28456, -28268, -28077, -27886, 
-        -27691, -27495, -27296, -27097, -26895, -26692, -26486, -26280, -26071, -25862, -25651, -25439, 
-        -25225, -25010, -24794, -24577, -24358, -24140, -23919, -23698, -23475, -23252, -23029, -22803, 
-        -22579, -22352, -22126, -21898, -21670, -21442, -21212, -20982, -20752, -20522, -20290, -20059, 
-        -19828, -19595, -19362, -19129, -18896, -18662, -18428, -18195, -17960, -17725, -17491, -17255, 
-        -17020, -16786, -16550, -16314, -16079, -15842, -15606, -15370, -15133, -14898, -14661, -14424, 
-        -14188, -13951, -13714, -13477, -13240, -13003, -12766, -12529, -12292, -12055, -11818, -11579, 
-        -11342, -11105, -10868, -10630, -10393, -10156, -9919, -9680, -9443, -9206, -8968, -8730, 
-        -8492, -8255, -8018, -7780, -7542, -7304, -7067, -6829, -6591, -6354, -6116, -5879, 
-        -5640, -5403, -5165, -4928, -4690, -4452, -4214, -3977, -3739, -3501, -3264, -3026, 
-        -2789, -2551, -2313, -2075, -1838, -1600, -1362, -1124, -887, -649, -412, -173 
-    };
-
-    // AKWF_tri_0006 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0006[600] PROGMEM = {
-        99, 470, 838, 1202, 1564, 1922, 2279, 2631, 2981, 3328, 3674, 4016, 
-        4355, 4692, 5026, 5357, 5686, 6012, 6336, 6656, 6976, 7292, 7607, 7917, 
-        8227, 8534, 8838, 9142, 9441, 9740, 10036, 10329, 10621, 10910, 11197, 11482, 
-        11766, 12047, 12326, 12603, 12878, 13152, 13424, 13692, 13960, 14225, 14489, 14752, 
-        15012, 15270, 15527, 15782, 16035, 16287, 16536, 16784, 17031, 17276, 17520, 17761, 
-        18001, 18240, 18477, 18711, 18946, 19178, 19409, 19637, 19865, 20091, 20316, 20540, 
-        20762, 20983, 21201, 21419, 21636, 21851, 22065, 22277, 22488, 22698, 22906, 23113, 
-        23320, 23525, 23727, 23930, 24131, 24330, 24529, 24727, 24923, 25117, 25311, 25504, 
-        25696, 25886, 26076, 26264, 26451, 26638, 26822, 27006, 27189, 27371, 27551, 27732, 
-        27910, 28088, 28263, 28440, 28615, 28788, 28961, 29133, 29303, 29473, 29642, 29809, 
-        29976, 30143, 30308, 30472, 30636, 30798, 30960, 31121, 31280, 31440, 31597, 31756, 
-        31912, 32068, 32222, 32376, 32529, 32650, 32712, 32745, 32764, 32767, 32760, 32743, 
-        32720, 32689, 32655, 32614, 32569, 32519, 32464, 32405, 32341, 32273, 32199, 32123, 
-        32042, 31958, 31872, 31783, 31691, 31596, 31498, 31398, 31296, 31191, 31084, 30975, 
-        30862, 30748, 30631, 30512, 30390, 30266, 30140, 30012, 29882, 29749, 29614, 29478, 
-        29339, 29198, 29055, 28910, 28764, 28616, 28465, 28312, 28158, 28002, 27843, 27684, 
-        27523, 27358, 27194, 27027, 26859, 26688, 26516, 26342, 26166, 25989, 25810, 25631, 
-        25448, 25265, 25079, 24893, 24704, 24514, 24323, 24130, 23935, 23738, 23541, 23342, 
-        23142, 22939, 22735, 22530, 22323, 22115, 21905, 21694, 21480, 21265, 21049, 20832, 
-        20613, 20392, 20170, 19946, 19720, 19493, 19265, 19035, 18803, 18570, 18335, 18098, 
-        17860, 17621, 17379, 17136, 16890, 16643, 16395, 16145, 15893, 15640, 15385, 15127, 
-        14868, 14607, 14344, 14080, 13814, 13545, 13275, 13002, 12728, 12452, 12175, 11895, 
-        11612, 11329, 11043, 10754, 10463, 10171, 9876, 9579, 9280, 8978, 8675, 8369, 
-        8061, 7750, 7437, 7123, 6805, 6484, 6163, 5837, 5509, 5179, 4846, 4511, 
-        4173, 3833, 3489, 3143, 2794, 2442, 2088, 1731, 1370, 1008, 640, 272, 
-        -99, -470, -838, -1202, -1564, -1922, -2279, -2631, -2981, -3328, -3674, -4016, 
-        -4355, -4692, -5026, -5357, -5686, -6012, -6336, -6656, -6976, -7292, -7607, -7917, 
-        -8227, -8534, -8838, -9142, -9441, -9740, -10036, -10329, -10621, -10910, -11197, -11482, 
-        -11766, -12047, -12326, -12603, -12878, -13152, -13424, -13692, -13960, -14225, -14489, -14752, 
-        -15012, -15270, -15527, -15782, -16035, -16287, -16536, -16784, -17031, -17276, -17520, -17761, 
-        -18001, -18240, -18477, -18711, -18946, -19178, -19409, -19637, -19865, -20091, -20316, -20540, 
-        -20762, -20983, -21201, -21419, -21636, -21851, -22065, -22277, -22488, -22698, -22906, -23113, 
-        -23320, -23525, -23727, -23930, -24131, -24330, -24529, -24727, -24923, -25117, -25311, -25504, 
-        -25696, -25886, -26076, -26264, -26451, -26638, -26822, -27006, -27189, -27371, -27551, -27732, 
-        -27910, -28088, -28263, -28440, -28615, -28788, -28961, -29133, -29303, -29473, -29642, -29809, 
-        -29976, -30143, -30308, -30472, -30636, -30798, -30960, -31121, -31280, -31440, -31597, -31756, 
-        -31912, -32068, -32222, -32376, -32529, -32650, -32712, -32745, -32764, -32767, -32760, -32743, 
-        -32720, -32689, -32655, -32614, -32569, -32519, -32464, -32405, -32341, -32273, -32199, -32123, 
-        -32042, -31958, -31872, -31783, -31691, -31596, -31498, -31398, -31296, -31191, -31084, -30975, 
-        -30862, -30748, -30631, -30512, -30390, -30266, -30140, -30012, -29882, -29749, -29614, -29478, 
-        -29339, -29198, -29055, -28910, -28764, -28616, -28465, -28312, -28158, -28002, -27843, -27684, 
-        -27523, -27358, -27194, -27027, -26859, -26688, -26516, -26342, -26166, -25989, -25810, -25631, 
-        -25448, -25265, -25079, -24893, -24704, -24514, -24323, -24130, -23935, -23738, -23541, -23342, 
-        -23142, -22939, -22735, -22530, -22323, -22115, -21905, -21694, -21480, -21265, -21049, -20832, 
-        -20613, -20392, -20170, -19946, -19720, -19493, -19265, -19035, -18803, -18570, -18335, -18098, 
-        -17860, -17621, -17379, -17136, -16890, -16643, -16395, -16145, -15893, -15640, -15385, -15127, 
-        -14868, -14607, -14344, -14080, -13814, -13545, -13275, -13002, -12728, -12452, -12175, -11895, 
-        -11612, -11329, -11043, -10754, -10463, -10171, -9876, -9579, -9280, -8978, -8675, -8369, 
-        -8061, -7750, -7437, -7123, -6805, -6484, -6163, -5837, -5509, -5179, -4846, -4511, 
-        -4173, -3833, -3489, -3143, -2794, -2442, -2088, -1731, -1370, -1008, -640, -272 
-    };
-
-    // AKWF_tri_0007 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0007[600] PROGMEM = {
-        27, 223, 415, 605, 794, 978, 1161, 1341, 1520, 1696, 1871, 2043, 
-        2214, 2384, 2553, 2719, 2886, 3051, 3215, 3379, 3542, 3706, 3869, 4031, 
-        4194, 4357, 4521, 4685, 4849, 5014, 5180, 5347, 5515, 5684, 5855, 6025, 
-        6198, 6374, 6550, 6728, 6906, 7088, 7270, 7456, 7642, 7831, 8022, 8214, 
-        8409, 8607, 8805, 9006, 9209, 9414, 9621, 9830, 10042, 10255, 10469, 10686, 
-        10905, 11125, 11349, 11572, 11798, 12025, 12255, 12485, 12718, 12951, 13185, 13422, 
-        13659, 13897, 14137, 14377, 14617, 14859, 15102, 15346, 15589, 15834, 16078, 16323, 
-        16568, 16813, 17060, 17305, 17550, 17796, 18040, 18285, 18529, 18773, 19017, 19262, 
-        19504, 19746, 19987, 20228, 20468, 20707, 20946, 21183, 21420, 21656, 21891, 22125, 
-        22357, 22588, 22819, 23049, 23278, 23507, 23733, 23959, 24183, 24407, 24629, 24851, 
-        25072, 25291, 25510, 25727, 25943, 26159, 26375, 26588, 26801, 27014, 27226, 27436, 
-        27647, 27856, 28065, 28273, 28481, 28688, 28894, 29101, 29308, 29513, 29718, 29922, 
-        30128, 30332, 30536, 30740, 30944, 31148, 31352, 31556, 31760, 31927, 32039, 32141, 
-        32247, 32346, 32439, 32521, 32593, 32654, 32703, 32738, 32760, 32767, 32761, 32742, 
-        32708, 32662, 32602, 32532, 32450, 32357, 32255, 32141, 32018, 31887, 31746, 31599, 
-        31442, 31280, 31109, 30934, 30752, 30564, 30372, 30174, 29974, 29769, 29560, 29348, 
-        29133, 28915, 28696, 28472, 28247, 28021, 27793, 27563, 27330, 27097, 26863, 26627, 
-        26389, 26150, 25910, 25668, 25427, 25183, 24937, 24691, 24443, 24194, 23942, 23690, 
-        23435, 23180, 22921, 22663, 22401, 22138, 21873, 21605, 21337, 21066, 20792, 20517, 
-        20238, 19959, 19676, 19392, 19105, 18816, 18525, 18232, 17938, 17639, 17341, 17040, 
-        16737, 16432, 16126, 15817, 15509, 15197, 14885, 14572, 14258, 13943, 13627, 13310, 
-        12994, 12678, 12360, 12044, 11726, 11409, 11094, 10778, 10464, 10150, 9839, 9528, 
-        9218, 8911, 8604, 8301, 7999, 7699, 7402, 7106, 6814, 6525, 6239, 5956, 
-        5674, 5396, 5123, 4851, 4584, 4321, 4060, 3803, 3548, 3299, 3052, 2810, 
-        2571, 2334, 2103, 1875, 1650, 1428, 1211, 997, 785, 577, 373, 170, 
-        -27, -223, -415, -605, -794, -978, -1161, -1341, -1520, -1696, -1871, -2043, 
-        -2214, -2384, -2553, -2719, -2886, -3051, -3215, -3379, -3542, -3706, -3869, -4031, 
-        -4194, -4357, -4521, -4685, -4849, -5014, -5180, -5347, -5515, -5684, -5855, -6025, 
-        -6198, -6374, -6550, -6728, -6906, -7088, -7270, -7456, -7642, -7831, -8022, -8214, 
-        -8409, -8607, -8805, -9006, -9209, -9414, -9621, -9830, -10042, -10255, -10469, -10686, 
-        -10905, -11125, -11349, -11572, -11798, -12025, -12255, -12485, -12718, -12951, -13185, -13422, 
-        -13659, -13897, -14137, -14377, -14617, -14859, -15102, -15346, -15589, -15834, -16078, -16323, 
-        -16568, -16813, -17060, -17305, -17550, -17796, -18040, -18285, -18529, -18773, -19017, -19262, 
-        -19504, -19746, -19987, -20228, -20468, -20707, -20946, -21183, -21420, -21656, -21891, -22125, 
-        -22357, -22588, -22819, -23049, -23278, -23507, -23733, -23959, -24183, -24407, -24629, -24851, 
-        -25072, -25291, -25510, -25727, -25943, -26159, -26375, -26588, -26801, -27014, -27226, -27436, 
-        -27647, -27856, -28065, -28273, -28481, -28688, -28894, -29101, -29308, -29513, -29718, -29922, 
-        -30128, -30332, -30536, -30740, -30944, -31148, -31352, -31556, -31760, -31927, -32039, -32141, 
-        -32247, -32346, -32439, -32521, -32593, -32654, -32703, -32738, -32760, -32767, -32761, -32742, 
-        -32708, -32662, -32602, -32532, -32450, -32357, -32255, -32141, -32018, -31887, -31746, -31599, 
-        -31442, -31280, -31109, -30934, -30752, -30564, -30372, -30174, -29973, -29769, -29560, -29348, 
-        -29133, -28915, -28696, -28472, -28247, -28021, -27793, -27562, -27330, -27097, -26863, -26627, 
-        -26389, -26150, -25910, -25668, -25427, -25183, -24937, -24691, -24443, -24194, -23942, -23690, 
-        -23435, -23180, -22921, -22663, -22401, -22138, -21873, -21605, -21337, -21066, -20792, -20517, 
-        -20238, -19959, -19676, -19392, -19105, -18816, -18525, -18232, -17938, -17639, -17341, -17040, 
-        -16737, -16432, -16126, -15817, -15509, -15197, -14885, -14572, -14258, -13943, -13627, -13310, 
-        -12994, -12678, -12360, -12044, -11726, -11409, -11094, -10779, -10464, -10150, -9839, -9528, 
-        -9218, -8911, -8604, -8301, -7999, -7699, -7402, -7106, -6814, -6525, -6239, -5956, 
-        -5674, -5396, -5123, -4851, -4584, -4321, -4060, -3803, -3548, -3299, -3052, -2810, 
-        -2571, -2334, -2103, -1875, -1650, -1428, -1211, -997, -785, -577, -371, -170 
-    };
-
-    // AKWF_tri_0008 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0008[600] PROGMEM = {
-        7, 424, 725, 1064, 1387, 1699, 2022, 2349, 2657, 2972, 3287, 3591, 
-        3895, 4224, 4525, 4815, 5121, 5431, 5715, 6017, 6327, 6609, 6897, 7190, 
-        7484, 7738, 8042, 8336, 8587, 8861, 9189, 9459, 9698, 9969, 10246, 10454, 
-        10752, 11017, 11267, 11544, 11799, 12038, 12310, 12560, 12795, 13044, 13303, 13520, 
-        13750, 14011, 14243, 14453, 14710, 14924, 15133, 15392, 15605, 15811, 16046, 16268, 
-        16455, 16678, 16902, 17100, 17309, 17528, 17702, 17901, 18116, 18310, 18497, 18697, 
-        18884, 19070, 19257, 19449, 19612, 19793, 19999, 20158, 20321, 20516, 20682, 20840, 
-        21033, 21187, 21354, 21519, 21675, 21805, 21980, 22150, 22275, 22434, 22605, 22737, 
-        22875, 23052, 23175, 23301, 23462, 23593, 23702, 23856, 24002, 24157, 24243, 24378, 
-        24501, 24591, 24695, 24852, 24965, 25103, 25207, 25307, 25438, 25551, 25637, 25758, 
-        25877, 25965, 26057, 26172, 26256, 26344, 26457, 26560, 26640, 26741, 26829, 26908, 
-        26996, 27082, 27165, 27247, 27328, 27397, 27479, 27569, 27638, 27694, 27787, 27853, 
-        27908, 27992, 28064, 28105, 28187, 28238, 28306, 28364, 28438, 28481, 28533, 28595, 
-        28639, 28677, 28758, 28805, 28841, 28890, 28936, 28966, 29032, 29076, 29097, 29155, 
-        29196, 29219, 29253, 29298, 29331, 29354, 29397, 29422, 29444, 29491, 29510, 29558, 
-        29602, 29587, 29595, 29628, 29619, 29624, 29668, 29716, 29703, 29705, 29756, 29759, 
-        29754, 29780, 29805, 29796, 29816, 29814, 29799, 29818, 29839, 29826, 29835, 29838, 
-        29824, 29836, 29840, 29828, 29823, 29839, 29816, 29803, 29808, 29808, 29780, 29781, 
-        29789, 29759, 29749, 29747, 29732, 29708, 29707, 29682, 29667, 29667, 29622, 29629, 
-        29574, 29624, 29533, 29436, 29744, 32767, 32726, 32032, 31562, 31215, 30805, 30416, 
-        29990, 29573, 29182, 28737, 28306, 27869, 27422, 26964, 26529, 26044, 25578, 25114, 
-        24647, 24161, 23753, 23230, 22713, 22214, 21697, 21135, 20713, 20235, 19723, 19215, 
-        18717, 18205, 17697, 17204, 16697, 16175, 15662, 15166, 14649, 14139, 13629, 13107, 
-        12600, 12111, 11588, 11084, 10594, 10074, 9575, 9064, 8571, 8070, 7570, 7078, 
-        6565, 6109, 5607, 5111, 4637, 4151, 3657, 3183, 2713, 2235, 1761, 1297, 
-        827, 355, -100, -549, -1014, -1454, -1903, -2352, -2796, -3249, -3674, -4102, 
-        -4536, -4977, -5386, -5800, -6218, -6651, -7038, -7447, -7864, -8234, -8633, -9046, 
-        -9427, -9802, -10192, -10573, -10909, -11229, -11671, -12024, -12394, -12818, -13150, -13466, 
-        -13815, -14150, -14477, -14819, -15128, -15440, -15763, -16096, -16402, -16719, -17043, -17314, 
-        -17627, -17915, -18217, -18485, -18787, -19047, -19325, -19612, -19863, -20127, -20390, -20667, 
-        -20895, -21156, -21411, -21643, -21884, -22136, -22354, -22582, -22809, -23034, -23225, -23475, 
-        -23684, -23879, -24097, -24292, -24476, -24668, -24873, -25046, -25231, -25422, -25602, -25763, 
-        -25948, -26106, -26258, -26443, -26602, -26731, -26898, -27033, -27164, -27320, -27475, -27592, 
-        -27729, -27876, -27982, -28087, -28233, -28353, -28468, -28520, -28640, -28793, -28906, -29032, 
-        -29159, -29228, -29312, -29373, -29471, -29565, -29634, -29718, -29809, -29875, -29938, -30020, 
-        -30099, -30125, -30189, -30269, -30313, -30365, -30436, -30460, -30509, -30568, -30588, -30636, 
-        -30682, -30715, -30739, -30770, -30811, -30836, -30857, -30888, -30902, -30922, -30949, -30944, 
-        -30964, -30984, -30970, -30981, -30991, -30981, -30975, -30988, -30982, -30946, -30951, -30956, 
-        -30921, -30910, -30910, -30872, -30844, -30842, -30824, -30767, -30755, -30731, -30685, -30671, 
-        -30631, -30580, -30537, -30510, -30438, -30405, -30376, -30307, -30246, -30194, -30074, -30056, 
-        -30017, -29939, -29895, -29884, -29745, -29652, -29565, -29495, -29393, -29313, -29239, -29123, 
-        -29029, -28940, -28833, -28712, -28602, -28521, -28366, -28243, -28118, -27967, -27825, -27684, 
-        -27527, -27370, -27215, -27045, -26844, -26686, -26507, -26298, -26112, -25925, -25696, -25492, 
-        -25290, -25047, -24840, -24643, -24397, -24154, -23950, -23712, -23444, -23239, -23019, -22738, 
-        -22593, -22478, -22439, -22104, -21634, -21344, -21088, -20870, -20611, -20364, -20117, -19863, 
-        -19596, -19347, -19094, -18819, -18560, -18299, -18004, -17715, -17452, -17163, -16863, -16588, 
-        -16230, -15914, -15663, -15337, -15013, -14753, -14405, -14047, -13725, -13400, -13053, -12717, 
-        -12402, -12045, -11699, -11375, -11026, -10681, -10333, -9997, -9649, -9294, -8960, -8582, 
-        -8256, -7923, -7553, -7196, -6868, -6517, -6158, -5811, -5474, -5122, -4772, -4426, 
-        -4075, -3747, -3414, -3056, -2707, -2391, -2041, -1712, -1379, -1034, -699, -382 
-    };
-
-    // AKWF_tri_0009 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0009[600] PROGMEM = {
-        22, 232, 441, 651, 861, 1071, 1281, 1491, 1701, 1910, 2120, 2330, 
-        2540, 2752, 2962, 3172, 3382, 3592, 3802, 4012, 4224, 4434, 4644, 4853, 
-        5063, 5273, 5483, 5693, 5903, 6113, 6325, 6535, 6745, 6955, 7164, 7374, 
-        7584, 7794, 8004, 8214, 8426, 8636, 8846, 9056, 9265, 9475, 9688, 9898, 
-        10107, 10317, 10527, 10737, 10947, 11157, 11369, 11579, 11789, 11999, 12208, 12418, 
-        12628, 12838, 13048, 13258, 13468, 13680, 13890, 14100, 14310, 14519, 14729, 14939, 
-        15149, 15359, 15569, 15781, 15991, 16201, 16411, 16621, 16830, 17040, 17253, 17462, 
-        17672, 17882, 18092, 18302, 18514, 18724, 18934, 19144, 19354, 19564, 19773, 19983, 
-        20193, 20403, 20615, 20825, 21035, 21245, 21455, 21665, 21874, 22084, 22294, 22504, 
-        22714, 22926, 23136, 23346, 23556, 23766, 23976, 24185, 24395, 24605, 24815, 25027, 
-        25237, 25447, 25657, 25867, 26077, 26286, 26499, 26709, 26919, 27128, 27338, 27548, 
-        27758, 27968, 28178, 28390, 28600, 28810, 29020, 29229, 29439, 29649, 29859, 30071, 
-        30281, 30491, 30701, 30911, 31121, 31331, 31540, 31750, 31960, 32172, 32382, 32592, 
-        32758, 32767, 32530, 32059, 31442, 30775, 30136, 29565, 29079, 28672, 28331, 28037, 
-        27778, 27541, 27316, 27099, 26884, 26672, 26459, 26249, 26037, 25827, 25617, 25405, 
-        25195, 24985, 24775, 24566, 24353, 24143, 23934, 23724, 23514, 23304, 23094, 22884, 
-        22674, 22462, 22252, 22042, 21832, 21623, 21413, 21203, 20993, 20781, 20571, 20361, 
-        20151, 19941, 19731, 19522, 19312, 19099, 18889, 18680, 18470, 18260, 18050, 17840, 
-        17630, 17420, 17211, 16998, 16788, 16579, 16369, 16159, 15949, 15739, 15529, 15319, 
-        15110, 14897, 14687, 14477, 14268, 14058, 13848, 13638, 13428, 13218, 13008, 12796, 
-        12586, 12376, 12164, 11954, 11744, 11534, 11325, 11115, 10905, 10695, 10485, 10275, 
-        10065, 9853, 9643, 9433, 9224, 9014, 8804, 8594, 8384, 8174, 7964, 7754, 
-        7542, 7332, 7122, 6913, 6703, 6493, 6283, 6073, 5863, 5653, 5441, 5231, 
-        5021, 4811, 4602, 4392, 4182, 3970, 3760, 3550, 3340, 3130, 2920, 2708, 
-        2498, 2288, 2078, 1869, 1659, 1449, 1239, 1029, 819, 607, 397, 187, 
-        -22, -232, -441, -651, -861, -1071, -1281, -1491, -1701, -1910, -2120, -2330, 
-        -2540, -2752, -2962, -3172, -3382, -3592, -3802, -4012, -4224, -4434, -4644, -4853, 
-        -5063, -5273, -5483, -5693, -5903, -6113, -6325, -6535, -6745, -6955, -7164, -7374, 
-        -7584, -7794, -8004, -8214, -8426, -8636, -8846, -9056, -9265, -9475, -9688, -9898, 
-        -10107, -10317, -10527, -10737, -10947, -11157, -11369, -11579, -11789, -11999, -12208, -12418, 
-        -12628, -12838, -13048, -13258, -13468, -13680, -13890, -14100, -14310, -14519, -14729, -14939, 
-        -15149, -15359, -15569, -15781, -15991, -16201, -16411, -16621, -16830, -17040, -17253, -17462, 
-        -17672, -17882, -18092, -18302, -18514, -18724, -18934, -19144, -19354, -19564, -19773, -19983, 
-        -20193, -20403, -20615, -20825, -21035, -21245, -21455, -21665, -21874, -22084, -22294, -22504, 
-        -22714, -22926, -23136, -23346, -23556, -23766, -23976, -24185, -24395, -24605, -24815, -25027, 
-        -25237, -25447, -25657, -25867, -26077, -26286, -26499, -26709, -26919, -27128, -27338, -27548, 
-        -27758, -27968, -28178, -28390, -28600, -28810, -29020, -29229, -29439, -29649, -29859, -30071, 
-        -30281, -30491, -30701, -30911, -31121, -31331, -31540, -31750, -31960, -32172, -32382, -32592, 
-        -32758, -32767, -32530, -32059, -31442, -30775, -30136, -29565, -29079, -28672, -28331, -28037, 
-        -27778, -27541, -27316, -27099, -26884, -26672, -26459, -26249, -26037, -25827, -25617, -25405, 
-        -25195, -24985, -24775, -24566, -24353, -24143, -23934, -23724, -23514, -23304, -23094, -22884, 
-        -22674, -22462, -22252, -22042, -21832, -21623, -21413, -21203, -20993, -20781, -20571, -20361, 
-        -20151, -19941, -19731, -19522, -19312, -19099, -18889, -18680, -18470, -18260, -18050, -17840, 
-        -17630, -17420, -17211, -16998, -16788, -16579, -16369, -16159, -15949, -15739, -15529, -15319, 
-        -15110, -14897, -14687, -14477, -14268, -14058, -13848, -13638, -13428, -13218, -13008, -12796, 
-        -12586, -12376, -12164, -11954, -11744, -11534, -11325, -11115, -10905, -10695, -10485, -10275, 
-        -10065, -9853, -9643, -9433, -9224, -9014, -8804, -8594, -8384, -8174, -7964, -7754, 
-        -7542, -7332, -7122, -6913, -6703, -6493, -6283, -6073, -5863, -5653, -5441, -5231, 
-        -5021, -4811, -4602, -4392, -4182, -3970, -3760, -3550, -3340, -3130, -2920, -2708, 
-        -2498, -2288, -2078, -1869, -1659, -1449, -1239, -1029, -819, -607, -397, -187 
-    };
-
-    // AKWF_tri_0010 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0010[600] PROGMEM = {
-        15, 210, 405, 600, 793, 987, 1182, 1377, 1570, 1765, 1959, 2152, 
-        2347, 2539, 2734, 2927, 3120, 3314, 3507, 3700, 3892, 4085, 4277, 4470, 
-        4663, 4855, 5048, 5240, 5433, 5625, 5818, 6011, 6203, 6396, 6588, 6781, 
-        6974, 7166, 7359, 7551, 7744, 7937, 8129, 8322, 8514, 8707, 8900, 9092, 
-        9285, 9477, 9670, 9863, 10053, 10245, 10438, 10633, 10825, 11018, 11211, 11403, 
-        11596, 11788, 11981, 12174, 12366, 12559, 12751, 12946, 13139, 13331, 13524, 13717, 
-        13909, 14102, 14294, 14487, 14680, 14872, 15065, 15260, 15452, 15645, 15837, 16030, 
-        16223, 16415, 16608, 16800, 16993, 17188, 17380, 17573, 17768, 17960, 18153, 18346, 
-        18538, 18731, 18923, 19116, 19309, 19504, 19696, 19889, 20081, 20274, 20466, 20659, 
-        20852, 21044, 21237, 21432, 21624, 21817, 22009, 22202, 22395, 22587, 22782, 22975, 
-        23167, 23360, 23552, 23745, 23938, 24130, 24323, 24515, 24710, 24903, 25096, 25288, 
-        25481, 25673, 25866, 26058, 26253, 26446, 26639, 26831, 27024, 27216, 27409, 27601, 
-        27794, 27989, 28182, 28374, 28567, 28759, 28952, 29144, 29339, 29530, 29722, 29917, 
-        30110, 30302, 30495, 30687, 30880, 31073, 31265, 31458, 31650, 31843, 32038, 32231, 
-        32423, 32616, 32767, 32767, 32521, 32027, 31356, 30597, 29822, 29077, 28385, 27746, 
-        27162, 26616, 26102, 25610, 25134, 24674, 24225, 23788, 23358, 22941, 22533, 22134, 
-        21749, 21373, 21006, 20652, 20310, 19977, 19653, 19340, 19037, 18744, 18464, 18189, 
-        17924, 17666, 17419, 17179, 16943, 16717, 16497, 16284, 16075, 15874, 15677, 15482, 
-        15294, 15110, 14929, 14752, 14575, 14403, 14233, 14066, 13900, 13735, 13572, 13409, 
-        13245, 13084, 12924, 12763, 12602, 12441, 12280, 12117, 11956, 11793, 11628, 11464, 
-        11299, 11131, 10964, 10796, 10626, 10454, 10282, 10110, 9935, 9761, 9584, 9407, 
-        9228, 9049, 8866, 8684, 8501, 8317, 8131, 7946, 7760, 7572, 7384, 7196, 
-        7005, 6815, 6622, 6430, 6237, 6045, 5852, 5659, 5465, 5272, 5077, 4882, 
-        4687, 4490, 4293, 4098, 3901, 3706, 3511, 3314, 3117, 2922, 2725, 2530, 
-        2333, 2136, 1941, 1744, 1549, 1352, 1157, 962, 765, 570, 376, 181, 
-        -15, -210, -405, -600, -793, -987, -1182, -1377, -1570, -1765, -1959, -2152, 
-        -2347, -2539, -2734, -2927, -3120, -3314, -3507, -3700, -3892, -4085, -4277, -4470, 
-        -4663, -4855, -5048, -5240, -5433, -5625, -5818, -6011, -6203, -6396, -6588, -6781, 
-        -6974, -7166, -7359, -7551, -7744, -7937, -8129, -8322, -8514, -8707, -8900, -9092, 
-        -9285, -9477, -9670, -9863, -10053, -10245, -10438, -10633, -10825, -11018, -11211, -11403, 
-        -11596, -11788, -11981, -12174, -12366, -12559, -12751, -12946, -13139, -13331, -13524, -13717, 
-        -13909, -14102, -14294, -14487, -14680, -14872, -15065, -15260, -15452, -15645, -15837, -16030, 
-        -16223, -16415, -16608, -16800, -16993, -17188, -17380, -17573, -17768, -17960, -18153, -18346, 
-        -18538, -18731, -18923, -19116, -19309, -19504, -19696, -19889, -20081, -20274, -20466, -20659, 
-        -20852, -21044, -21237, -21432, -21624, -21817, -22009, -22202, -22395, -22587, -22782, -22975, 
-        -23167, -23360, -23552, -23745, -23938, -24130, -24323, -24515, -24710, -24903, -25096, -25288, 
-        -25481, -25673, -25866, -26058, -26253, -26446, -26639, -26831, -27024, -27216, -27409, -27601, 
-        -27794, -27989, -28182, -28374, -28567, -28759, -28952, -29144, -29339, -29530, -29722, -29917, 
-        -30110, -30302, -30495, -30687, -30880, -31073, -31265, -31458, -31650, -31843, -32038, -32231, 
-        -32423, -32616, -32767, -32767, -32521, -32027, -31356, -30597, -29822, -29077, -28385, -27746, 
-        -27162, -26616, -26102, -25610, -25134, -24674, -24225, -23788, -23358, -22941, -22533, -22134, 
-        -21749, -21373, -21006, -20652, -20310, -19977, -19653, -19340, -19037, -18744, -18464, -18189, 
-        -17924, -17666, -17419, -17179, -16943, -16717, -16497, -16284, -16075, -15874, -15677, -15482, 
-        -15294, -15110, -14929, -14752, -14575, -14403, -14233, -14066, -13900, -13735, -13572, -13409, 
-        -13245, -13084, -12924, -12763, -12602, -12441, -12280, -12117, -11956, -11793, -11628, -11464, 
-        -11299, -11131, -10964, -10796, -10626, -10454, -10282, -10110, -9935, -9761, -9584, -9407, 
-        -9228, -9049, -8866, -8684, -8501, -8317, -8131, -7946, -7760, -7572, -7384, -7196, 
-        -7005, -6815, -6622, -6430, -6237, -6045, -5852, -5659, -5465, -5272, -5077, -4882, 
-        -4687, -4490, -4293, -4098, -3901, -3706, -3511, -3314, -3117, -2922, -2725, -2530, 
-        -2333, -2136, -1941, -1744, -1549, -1352, -1157, -962, -765, -570, -376, -181 
-    };
-
-    // AKWF_tri_0011 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0011[600] PROGMEM = {
-        46, 97, 147, 194, 240, 282, 322, 358, 392, 423, 453, 485, 
-        512, 537, 556, 573, 588, 605, 617, 630, 638, 645, 649, 651, 
-        651, 653, 660, 670, 685, 700, 712, 729, 748, 771, 799, 828, 
-        860, 894, 930, 965, 1005, 1048, 1092, 1145, 1197, 1252, 1305, 1362, 
-        1423, 1486, 1556, 1628, 1701, 1777, 1855, 1935, 2018, 2102, 2193, 2288, 
-        2385, 2484, 2583, 2684, 2792, 2901, 3015, 3131, 3249, 3370, 3496, 3625, 
-        3758, 3893, 4030, 4167, 4310, 4456, 4603, 4755, 4909, 5069, 5230, 5396, 
-        5567, 5738, 5913, 6088, 6267, 6449, 6636, 6830, 7026, 7222, 7421, 7623, 
-        7828, 8039, 8254, 8471, 8694, 8918, 9146, 9376, 9608, 9844, 10084, 10333, 
-        10582, 10835, 11088, 11343, 11605, 11870, 12143, 12417, 12697, 12978, 13262, 13549, 
-        13838, 14133, 14433, 14739, 15049, 15359, 15671, 15987, 16308, 16634, 16966, 17303, 
-        17643, 17984, 18328, 18672, 19015, 19363, 19716, 20072, 20428, 20787, 21143, 21502, 
-        21865, 22229, 22596, 22967, 23339, 23712, 24087, 24461, 24836, 25213, 25595, 25979, 
-        26367, 26751, 27137, 27523, 27913, 28305, 28699, 29096, 29492, 29891, 30292, 30690, 
-        31091, 31492, 31899, 32306, 32658, 32767, 32491, 31899, 31194, 30530, 29942, 29402, 
-        28870, 28332, 27791, 27255, 26728, 26211, 25707, 25211, 24724, 24241, 23765, 23294, 
-        22835, 22383, 21938, 21502, 21074, 20650, 20232, 19821, 19416, 19020, 18629, 18248, 
-        17872, 17503, 17134, 16774, 16421, 16073, 15734, 15401, 15072, 14749, 14431, 14116, 
-        13806, 13503, 13205, 12914, 12630, 12347, 12067, 11790, 11518, 11250, 10987, 10730, 
-        10474, 10221, 9970, 9724, 9479, 9239, 9002, 8770, 8545, 8317, 8093, 7872, 
-        7655, 7442, 7233, 7028, 6826, 6626, 6430, 6233, 6041, 5852, 5668, 5489, 
-        5312, 5137, 4962, 4789, 4622, 4458, 4297, 4141, 3987, 3836, 3688, 3538, 
-        3393, 3251, 3112, 2979, 2849, 2720, 2589, 2463, 2340, 2220, 2106, 1992, 
-        1883, 1775, 1670, 1564, 1461, 1362, 1265, 1174, 1086, 997, 908, 822, 
-        740, 662, 586, 512, 442, 375, 307, 240, 177, 115, 59, 4, 
-        -46, -97, -147, -196, -242, -282, -320, -356, -390, -423, -453, -482, 
-        -510, -535, -556, -575, -590, -605, -620, -632, -641, -645, -649, -649, 
-        -649, -653, -660, -670, -683, -698, -714, -731, -748, -771, -799, -830, 
-        -862, -894, -930, -965, -1003, -1048, -1092, -1143, -1195, -1250, -1307, -1364, 
-        -1423, -1486, -1556, -1630, -1703, -1777, -1855, -1933, -2018, -2102, -2193, -2286, 
-        -2385, -2484, -2585, -2686, -2790, -2899, -3015, -3133, -3254, -3376, -3498, -3625, 
-        -3753, -3886, -4023, -4165, -4310, -4458, -4607, -4757, -4909, -5067, -5232, -5398, 
-        -5567, -5738, -5911, -6088, -6267, -6449, -6636, -6828, -7024, -7222, -7423, -7623, 
-        -7828, -8039, -8254, -8473, -8694, -8918, -9146, -9374, -9608, -9844, -10084, -10331, 
-        -10582, -10835, -11088, -11345, -11605, -11870, -12143, -12419, -12697, -12978, -13260, -13547, 
-        -13838, -14131, -14433, -14736, -15046, -15359, -15673, -15989, -16308, -16634, -16968, -17305, 
-        -17645, -17984, -18326, -18670, -19015, -19363, -19716, -20070, -20428, -20787, -21145, -21504, 
-        -21865, -22229, -22598, -22970, -23341, -23712, -24085, -24461, -24836, -25213, -25595, -25979, 
-        -26365, -26751, -27139, -27525, -27913, -28305, -28699, -29098, -29494, -29891, -30290, -30688, 
-        -31089, -31492, -31897, -32306, -32656, -32767, -32493, -31901, -31194, -30528, -29942, -29404, 
-        -28872, -28332, -27791, -27253, -26728, -26211, -25707, -25211, -24722, -24241, -23767, -23296, 
-        -22835, -22383, -21940, -21504, -21074, -20650, -20232, -19821, -19416, -19020, -18629, -18248, 
-        -17872, -17501, -17136, -16776, -16421, -16073, -15736, -15403, -15074, -14749, -14431, -14114, 
-        -13806, -13503, -13205, -12914, -12630, -12347, -12069, -11792, -11518, -11250, -10989, -10730, 
-        -10474, -10221, -9970, -9722, -9479, -9239, -9002, -8770, -8543, -8317, -8096, -7874, 
-        -7655, -7442, -7233, -7028, -6826, -6626, -6427, -6233, -6039, -5852, -5668, -5487, 
-        -5310, -5135, -4962, -4791, -4622, -4458, -4300, -4143, -3990, -3836, -3686, -3538, 
-        -3393, -3251, -3112, -2979, -2849, -2720, -2591, -2465, -2340, -2220, -2106, -1995, 
-        -1885, -1775, -1668, -1562, -1461, -1360, -1265, -1172, -1083, -995, -908, -824, 
-        -740, -662, -586, -514, -444, -375, -305, -240, -177, -115, -56, -2 
-    };
-
-    // AKWF_tri_0012 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0012[600] PROGMEM = {
-        0, 52, 102, 149, 195, 237, 282, 324, 360, 395, 425, 455, 
-        483, 512, 536, 560, 580, 596, 610, 622, 633, 643, 651, 657, 
-        663, 667, 675, 685, 701, 717, 737, 762, 786, 812, 838, 868, 
-        901, 937, 977, 1020, 1064, 1108, 1155, 1205, 1260, 1318, 1379, 1441, 
-        1506, 1574, 1643, 1713, 1788, 1866, 1951, 2036, 2122, 2211, 2302, 2397, 
-        2493, 2596, 2701, 2810, 2919, 3032, 3147, 3264, 3385, 3508, 3637, 3770, 
-        3903, 4038, 4175, 4316, 4461, 4610, 4764, 4919, 5076, 5237, 5399, 5564, 
-        5733, 5907, 6086, 6268, 6449, 6633, 6820, 7012, 7207, 7407, 7610, 7818, 
-        8026, 8237, 8453, 8669, 8891, 9116, 9346, 9580, 9816, 10054, 10294, 10540, 
-        10790, 11044, 11300, 11562, 11826, 12094, 12362, 12637, 12913, 13195, 13481, 13774, 
-        14066, 14360, 14659, 14961, 15270, 15582, 15899, 16219, 16542, 16868, 17199, 17530, 
-        17864, 18203, 18544, 18887, 19231, 19574, 19919, 20268, 20618, 20973, 21328, 21687, 
-        22046, 22405, 22766, 23128, 23493, 23860, 24231, 24602, 24975, 25346, 25719, 26096, 
-        26473, 26854, 27237, 27620, 28005, 28391, 28778, 29163, 29552, 29943, 30336, 30733, 
-        31128, 31524, 31919, 32316, 32659, 32765, 32491, 31905, 31205, 30542, 29953, 29413, 
-        28880, 28344, 27806, 27276, 26751, 26237, 25731, 25235, 24747, 24266, 23794, 23330, 
-        22872, 22421, 21977, 21538, 21108, 20685, 20270, 19860, 19459, 19064, 18673, 18292, 
-        17915, 17546, 17183, 16826, 16473, 16128, 15786, 15451, 15120, 14798, 14481, 14171, 
-        13864, 13560, 13262, 12967, 12681, 12401, 12124, 11852, 11584, 11318, 11054, 10794, 
-        10538, 10288, 10040, 9798, 9556, 9316, 9078, 8846, 8618, 8395, 8173, 7957, 
-        7741, 7530, 7320, 7112, 6909, 6709, 6514, 6322, 6133, 5943, 5758, 5574, 
-        5397, 5221, 5050, 4883, 4715, 4552, 4391, 4231, 4074, 3923, 3774, 3629, 
-        3485, 3342, 3201, 3064, 2931, 2802, 2675, 2552, 2429, 2308, 2191, 2074, 
-        1961, 1852, 1745, 1643, 1542, 1439, 1340, 1245, 1153, 1064, 977, 895, 
-        812, 731, 653, 576, 502, 431, 364, 300, 235, 173, 112, 54, 
-        0, -52, -102, -149, -195, -237, -282, -322, -360, -395, -427, -455, 
-        -483, -512, -538, -560, -580, -596, -610, -622, -633, -641, -649, -657, 
-        -663, -669, -677, -685, -701, -719, -739, -762, -786, -810, -838, -868, 
-        -901, -937, -975, -1020, -1064, -1108, -1157, -1205, -1260, -1318, -1379, -1443, 
-        -1508, -1574, -1643, -1713, -1788, -1866, -1949, -2036, -2122, -2213, -2302, -2397, 
-        -2493, -2596, -2703, -2810, -2921, -3032, -3147, -3264, -3383, -3508, -3637, -3768, 
-        -3903, -4038, -4175, -4316, -4461, -4610, -4766, -4919, -5076, -5237, -5399, -5564, 
-        -5733, -5907, -6084, -6266, -6449, -6635, -6822, -7012, -7207, -7409, -7612, -7818, 
-        -8028, -8237, -8451, -8669, -8891, -9116, -9346, -9580, -9816, -10056, -10296, -10540, 
-        -10788, -11044, -11302, -11564, -11826, -12092, -12362, -12635, -12913, -13195, -13481, -13772, 
-        -14066, -14362, -14659, -14961, -15270, -15582, -15901, -16219, -16542, -16868, -17197, -17530, 
-        -17864, -18201, -18542, -18884, -19229, -19574, -19921, -20268, -20618, -20973, -21330, -21687, 
-        -22046, -22405, -22766, -23128, -23491, -23860, -24229, -24602, -24975, -25348, -25721, -26096, 
-        -26473, -26854, -27237, -27622, -28005, -28391, -28776, -29165, -29556, -29947, -30338, -30731, 
-        -31126, -31522, -31919, -32316, -32659, -32767, -32493, -31905, -31205, -30542, -29953, -29413, 
-        -28880, -28344, -27806, -27274, -26751, -26237, -25733, -25235, -24745, -24268, -23796, -23330, 
-        -22872, -22421, -21975, -21538, -21106, -20685, -20270, -19862, -19461, -19066, -18675, -18290, 
-        -17915, -17546, -17183, -16826, -16473, -16126, -15786, -15451, -15120, -14798, -14481, -14169, 
-        -13862, -13560, -13262, -12967, -12681, -12401, -12126, -11854, -11584, -11318, -11054, -10794, 
-        -10538, -10286, -10040, -9796, -9556, -9316, -9080, -8846, -8618, -8395, -8175, -7957, 
-        -7741, -7530, -7318, -7112, -6909, -6709, -6514, -6322, -6133, -5945, -5758, -5574, 
-        -5397, -5223, -5052, -4883, -4715, -4552, -4389, -4229, -4074, -3921, -3774, -3629, 
-        -3485, -3342, -3203, -3064, -2931, -2802, -2677, -2552, -2429, -2308, -2189, -2074, 
-        -1961, -1850, -1745, -1643, -1540, -1441, -1342, -1245, -1153, -1064, -979, -895, 
-        -812, -731, -653, -576, -502, -431, -364, -298, -235, -173, -112, -54 
-    };
-
-    // AKWF_tri_0013 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0013[600] PROGMEM = {
-        17, 70, 119, 166, 211, 255, 298, 339, 376, 410, 441, 472, 
-        500, 527, 553, 576, 598, 616, 631, 643, 655, 667, 678, 692, 
-        706, 722, 739, 761, 786, 814, 843, 875, 910, 945, 985, 1024, 
-        1067, 1114, 1163, 1216, 1271, 1326, 1383, 1444, 1509, 1577, 1648, 1721, 
-        1797, 1874, 1954, 2036, 2121, 2209, 2303, 2400, 2496, 2594, 2694, 2800, 
-        2908, 3020, 3133, 3251, 3373, 3495, 3618, 3746, 3875, 4009, 4148, 4289, 
-        4433, 4576, 4723, 4874, 5029, 5186, 5349, 5514, 5681, 5851, 6022, 6197, 
-        6375, 6558, 6744, 6935, 7125, 7317, 7513, 7714, 7920, 8128, 8340, 8554, 
-        8771, 8991, 9213, 9439, 9668, 9902, 10141, 10383, 10628, 10873, 11120, 11374, 
-        11631, 11892, 12157, 12425, 12698, 12973, 13250, 13530, 13815, 14103, 14398, 14694, 
-        14994, 15296, 15601, 15911, 16225, 16544, 16866, 17192, 17520, 17849, 18179, 18511, 
-        18844, 19180, 19519, 19863, 20204, 20546, 20889, 21236, 21586, 21937, 22290, 22644, 
-        23001, 23358, 23715, 24074, 24433, 24796, 25163, 25530, 25899, 26264, 26633, 27004, 
-        27377, 27752, 28128, 28505, 28884, 29263, 29641, 30022, 30403, 30787, 31174, 31563, 
-        31951, 32338, 32667, 32767, 32495, 31916, 31227, 30576, 29997, 29465, 28939, 28409, 
-        27875, 27347, 26833, 26329, 25830, 25340, 24855, 24378, 23909, 23450, 22997, 22551, 
-        22114, 21680, 21254, 20834, 20422, 20016, 19619, 19229, 18842, 18462, 18087, 17718, 
-        17357, 17002, 16654, 16311, 15973, 15642, 15314, 14990, 14672, 14362, 14058, 13758, 
-        13463, 13171, 12883, 12602, 12325, 12054, 11788, 11525, 11264, 11005, 10749, 10500, 
-        10253, 10010, 9770, 9533, 9299, 9066, 8838, 8612, 8391, 8173, 7959, 7749, 
-        7539, 7333, 7129, 6929, 6731, 6536, 6346, 6161, 5975, 5792, 5612, 5433, 
-        5261, 5090, 4923, 4758, 4597, 4438, 4279, 4124, 3973, 3824, 3679, 3538, 
-        3398, 3259, 3122, 2988, 2859, 2731, 2608, 2486, 2366, 2248, 2133, 2021, 
-        1909, 1803, 1699, 1597, 1497, 1399, 1303, 1208, 1118, 1032, 945, 863, 
-        782, 704, 626, 551, 478, 408, 343, 278, 215, 153, 94, 35, 
-        -17, -68, -117, -164, -209, -255, -296, -337, -376, -412, -443, -472, 
-        -500, -529, -555, -578, -598, -616, -631, -643, -655, -665, -677, -690, 
-        -706, -724, -741, -761, -784, -814, -843, -877, -910, -945, -983, -1024, 
-        -1067, -1112, -1163, -1216, -1271, -1326, -1385, -1444, -1509, -1577, -1648, -1722, 
-        -1797, -1874, -1954, -2035, -2121, -2209, -2301, -2398, -2496, -2596, -2696, -2800, 
-        -2908, -3020, -3135, -3253, -3373, -3495, -3618, -3746, -3875, -4009, -4146, -4287, 
-        -4433, -4578, -4725, -4874, -5029, -5188, -5351, -5514, -5681, -5849, -6022, -6197, 
-        -6375, -6556, -6742, -6933, -7125, -7319, -7515, -7714, -7918, -8128, -8340, -8554, 
-        -8771, -8991, -9213, -9439, -9668, -9902, -10141, -10383, -10626, -10873, -11122, -11374, 
-        -11631, -11894, -12158, -12427, -12698, -12973, -13250, -13530, -13813, -14103, -14396, -14694, 
-        -14994, -15296, -15602, -15911, -16225, -16544, -16868, -17194, -17520, -17849, -18179, -18511, 
-        -18844, -19180, -19519, -19861, -20204, -20548, -20891, -21236, -21586, -21937, -22290, -22645, 
-        -23001, -23356, -23713, -24072, -24433, -24796, -25163, -25530, -25897, -26266, -26635, -27004, 
-        -27377, -27752, -28128, -28507, -28884, -29263, -29641, -30022, -30403, -30787, -31174, -31563, 
-        -31949, -32338, -32669, -32767, -32495, -31916, -31229, -30576, -29997, -29463, -28939, -28409, 
-        -27875, -27347, -26831, -26327, -25830, -25340, -24855, -24378, -23909, -23450, -22997, -22551, 
-        -22112, -21680, -21254, -20836, -20424, -20018, -19618, -19225, -18838, -18460, -18089, -17720, 
-        -17359, -17004, -16654, -16311, -15973, -15640, -15312, -14990, -14672, -14362, -14056, -13758, 
-        -13462, -13171, -12885, -12602, -12325, -12054, -11790, -11525, -11264, -11007, -10751, -10500, 
-        -10253, -10008, -9768, -9533, -9299, -9068, -8838, -8612, -8391, -8175, -7961, -7749, 
-        -7539, -7333, -7129, -6929, -6731, -6536, -6346, -6159, -5975, -5792, -5612, -5433, 
-        -5261, -5090, -4925, -4760, -4597, -4436, -4279, -4124, -3973, -3824, -3679, -3538, 
-        -3396, -3259, -3122, -2988, -2859, -2731, -2608, -2486, -2366, -2248, -2133, -2019, 
-        -1909, -1801, -1697, -1597, -1497, -1399, -1303, -1208, -1118, -1032, -947, -865, 
-        -782, -704, -626, -551, -478, -408, -341, -278, -215, -155, -94, -37 
-    };
-
-    // AKWF_tri_0014 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0014[600] PROGMEM = {
-        39, 92, 144, 195, 245, 292, 338, 381, 423, 460, 496, 529, 
-        563, 595, 624, 652, 676, 697, 721, 745, 774, 804, 840, 875, 
-        911, 950, 992, 1035, 1083, 1132, 1186, 1239, 1294, 1352, 1413, 1476, 
-        1543, 1615, 1686, 1761, 1836, 1915, 1996, 2079, 2166, 2255, 2350, 2443, 
-        2540, 2637, 2737, 2842, 2951, 3062, 3176, 3291, 3410, 3528, 3651, 3775, 
-        3904, 4036, 4173, 4309, 4447, 4588, 4732, 4880, 5031, 5185, 5341, 5501, 
-        5663, 5825, 5991, 6161, 6333, 6511, 6691, 6873, 7055, 7241, 7430, 7624, 
-        7820, 8020, 8223, 8429, 8636, 8846, 9057, 9273, 9494, 9718, 9945, 10174, 
-        10404, 10637, 10874, 11115, 11360, 11609, 11861, 12114, 12371, 12629, 12890, 13157, 
-        13426, 13701, 13978, 14256, 14537, 14822, 15108, 15401, 15698, 15998, 16300, 16607, 
-        16915, 17226, 17540, 17856, 18175, 18497, 18821, 19143, 19467, 19792, 20120, 20450, 
-        20780, 21112, 21446, 21782, 22118, 22456, 22796, 23138, 23478, 23820, 24164, 24508, 
-        24856, 25202, 25550, 25900, 26252, 26604, 26958, 27311, 27667, 28023, 28377, 28735, 
-        29095, 29454, 29816, 30178, 30538, 30899, 31261, 31627, 31993, 32360, 32673, 32767, 
-        32505, 31951, 31293, 30668, 30117, 29607, 29106, 28600, 28088, 27580, 27084, 26598, 
-        26119, 25649, 25184, 24726, 24273, 23828, 23389, 22956, 22531, 22112, 21703, 21296, 
-        20895, 20499, 20110, 19728, 19355, 18985, 18621, 18263, 17910, 17562, 17218, 16880, 
-        16548, 16223, 15903, 15587, 15274, 14968, 14666, 14369, 14077, 13790, 13509, 13230, 
-        12958, 12687, 12420, 12157, 11898, 11645, 11392, 11143, 10896, 10651, 10410, 10172, 
-        9939, 9708, 9480, 9255, 9032, 8812, 8593, 8379, 8168, 7960, 7757, 7553, 
-        7353, 7154, 6960, 6768, 6580, 6395, 6213, 6033, 5853, 5677, 5503, 5333, 
-        5165, 5003, 4841, 4683, 4524, 4368, 4216, 4066, 3920, 3775, 3635, 3497, 
-        3360, 3224, 3091, 2961, 2832, 2710, 2589, 2469, 2350, 2233, 2119, 2008, 
-        1901, 1794, 1692, 1591, 1492, 1393, 1298, 1205, 1114, 1027, 942, 859, 
-        776, 695, 616, 541, 470, 399, 332, 264, 199, 136, 75, 15, 
-        -41, -94, -144, -195, -245, -294, -340, -381, -421, -458, -496, -529, 
-        -563, -595, -624, -652, -676, -697, -721, -745, -774, -806, -840, -875, 
-        -911, -950, -992, -1035, -1081, -1132, -1184, -1239, -1296, -1354, -1413, -1476, 
-        -1545, -1615, -1688, -1761, -1836, -1915, -1994, -2079, -2164, -2255, -2348, -2443, 
-        -2540, -2639, -2737, -2842, -2951, -3064, -3176, -3291, -3408, -3528, -3651, -3775, 
-        -3904, -4036, -4171, -4309, -4447, -4588, -4732, -4878, -5031, -5187, -5343, -5501, 
-        -5661, -5825, -5991, -6161, -6333, -6509, -6689, -6873, -7057, -7243, -7430, -7622, 
-        -7820, -8021, -8223, -8429, -8634, -8846, -9057, -9273, -9492, -9716, -9943, -10172, 
-        -10406, -10639, -10874, -11115, -11362, -11609, -11861, -12114, -12371, -12629, -12890, -13157, 
-        -13426, -13699, -13976, -14256, -14537, -14822, -15108, -15401, -15698, -15998, -16300, -16607, 
-        -16913, -17226, -17540, -17856, -18175, -18495, -18819, -19143, -19467, -19794, -20120, -20448, 
-        -20780, -21114, -21450, -21784, -22120, -22456, -22794, -23134, -23476, -23820, -24164, -24510, 
-        -24858, -25204, -25550, -25900, -26252, -26606, -26960, -27311, -27667, -28021, -28377, -28735, 
-        -29093, -29454, -29814, -30176, -30538, -30899, -31261, -31627, -31993, -32360, -32673, -32767, 
-        -32505, -31949, -31291, -30668, -30117, -29607, -29106, -28598, -28088, -27582, -27084, -26596, 
-        -26119, -25649, -25184, -24726, -24273, -23826, -23387, -22956, -22531, -22112, -21701, -21296, 
-        -20895, -20499, -20110, -19728, -19355, -18985, -18621, -18263, -17910, -17560, -17218, -16880, 
-        -16548, -16223, -15903, -15587, -15276, -14968, -14666, -14369, -14077, -13792, -13509, -13230, 
-        -12958, -12687, -12420, -12157, -11898, -11643, -11392, -11143, -10896, -10653, -10410, -10172, 
-        -9939, -9708, -9480, -9255, -9032, -8810, -8593, -8379, -8168, -7960, -7755, -7553, 
-        -7353, -7156, -6960, -6768, -6580, -6397, -6213, -6033, -5853, -5677, -5503, -5333, 
-        -5165, -5001, -4841, -4683, -4524, -4368, -4216, -4066, -3920, -3777, -3635, -3497, 
-        -3358, -3224, -3089, -2961, -2832, -2708, -2587, -2469, -2350, -2233, -2119, -2008, 
-        -1901, -1796, -1694, -1591, -1492, -1393, -1298, -1203, -1114, -1027, -942, -859, 
-        -776, -695, -618, -541, -470, -401, -332, -264, -199, -136, -75, -15 
-    };
-
-    // AKWF_tri_0015 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0015[600] PROGMEM = {
-        11, 75, 138, 198, 257, 315, 370, 424, 476, 525, 571, 618, 
-        662, 706, 747, 789, 831, 876, 924, 973, 1027, 1084, 1142, 1204, 
-        1265, 1328, 1396, 1465, 1539, 1614, 1691, 1771, 1854, 1937, 2023, 2112, 
-        2203, 2298, 2396, 2495, 2594, 2697, 2802, 2911, 3022, 3135, 3252, 3372, 
-        3493, 3615, 3740, 3867, 3998, 4133, 4270, 4407, 4548, 4689, 4835, 4982, 
-        5135, 5288, 5444, 5603, 5764, 5926, 6091, 6260, 6430, 6605, 6781, 6960, 
-        7140, 7323, 7509, 7698, 7890, 8084, 8283, 8481, 8683, 8888, 9094, 9302, 
-        9515, 9731, 9949, 10169, 10391, 10615, 10843, 11074, 11308, 11544, 11784, 12026, 
-        12270, 12516, 12764, 13013, 13269, 13527, 13789, 14051, 14315, 14582, 14852, 15126, 
-        15404, 15681, 15965, 16249, 16536, 16826, 17117, 17411, 17710, 18012, 18315, 18621, 
-        18926, 19232, 19539, 19849, 20160, 20472, 20783, 21096, 21410, 21723, 22039, 22354, 
-        22671, 22991, 23310, 23627, 23947, 24266, 24585, 24907, 25230, 25553, 25877, 26202, 
-        26525, 26849, 27172, 27497, 27823, 28150, 28477, 28804, 29130, 29455, 29782, 30110, 
-        30439, 30766, 31095, 31425, 31752, 32079, 32408, 32686, 32767, 32526, 32020, 31417, 
-        30843, 30334, 29862, 29397, 28929, 28455, 27987, 27525, 27071, 26624, 26182, 25746, 
-        25315, 24893, 24474, 24062, 23653, 23251, 22852, 22461, 22076, 21695, 21321, 20950, 
-        20585, 20224, 19869, 19517, 19172, 18833, 18498, 18167, 17839, 17518, 17201, 16887, 
-        16580, 16276, 15977, 15681, 15392, 15104, 14820, 14541, 14265, 13995, 13730, 13466, 
-        13206, 12946, 12690, 12438, 12190, 11942, 11698, 11458, 11218, 10980, 10746, 10514, 
-        10284, 10058, 9836, 9614, 9396, 9179, 8965, 8753, 8545, 8340, 8136, 7936, 
-        7737, 7539, 7345, 7152, 6964, 6777, 6595, 6412, 6232, 6055, 5881, 5708, 
-        5538, 5371, 5206, 5044, 4883, 4724, 4568, 4413, 4262, 4113, 3969, 3824, 
-        3679, 3538, 3401, 3264, 3132, 3003, 2874, 2747, 2622, 2499, 2378, 2259, 
-        2144, 2031, 1920, 1810, 1703, 1596, 1493, 1392, 1293, 1198, 1104, 1011, 
-        920, 831, 743, 658, 577, 497, 420, 343, 267, 194, 122, 55, 
-        -11, -75, -136, -198, -257, -315, -370, -424, -476, -525, -571, -618, 
-        -662, -706, -747, -789, -831, -876, -924, -973, -1027, -1083, -1142, -1204, 
-        -1265, -1328, -1396, -1465, -1539, -1614, -1691, -1771, -1852, -1935, -2023, -2112, 
-        -2203, -2296, -2394, -2493, -2594, -2697, -2802, -2911, -3022, -3137, -3252, -3372, 
-        -3493, -3615, -3740, -3867, -3998, -4131, -4268, -4407, -4548, -4691, -4835, -4982, 
-        -5135, -5290, -5444, -5603, -5764, -5926, -6091, -6260, -6430, -6605, -6781, -6960, 
-        -7142, -7325, -7509, -7698, -7890, -8086, -8283, -8481, -8683, -8888, -9094, -9302, 
-        -9515, -9731, -9949, -10169, -10391, -10615, -10843, -11074, -11308, -11546, -11784, -12026, 
-        -12268, -12514, -12764, -13013, -13269, -13527, -13787, -14051, -14317, -14582, -14852, -15126, 
-        -15404, -15683, -15965, -16249, -16536, -16826, -17117, -17411, -17710, -18012, -18315, -18621, 
-        -18926, -19232, -19539, -19849, -20160, -20472, -20785, -21096, -21410, -21723, -22039, -22354, 
-        -22671, -22989, -23308, -23627, -23947, -24266, -24585, -24907, -25230, -25553, -25879, -26202, 
-        -26525, -26849, -27172, -27497, -27823, -28150, -28477, -28804, -29130, -29457, -29782, -30110, 
-        -30439, -30766, -31095, -31425, -31752, -32079, -32406, -32686, -32766, -32526, -32018, -31417, 
-        -30843, -30334, -29862, -29397, -28929, -28457, -27987, -27525, -27071, -26624, -26182, -25746, 
-        -25315, -24891, -24474, -24062, -23653, -23251, -22852, -22461, -22076, -21695, -21321, -20950, 
-        -20585, -20224, -19869, -19519, -19174, -18833, -18498, -18167, -17839, -17518, -17201, -16887, 
-        -16580, -16276, -15977, -15681, -15390, -15102, -14820, -14541, -14265, -13995, -13730, -13466, 
-        -13206, -12946, -12690, -12438, -12190, -11944, -11700, -11458, -11218, -10980, -10746, -10514, 
-        -10284, -10060, -9836, -9616, -9397, -9179, -8965, -8753, -8545, -8340, -8136, -7936, 
-        -7735, -7539, -7345, -7152, -6964, -6777, -6595, -6412, -6234, -6055, -5879, -5708, 
-        -5538, -5371, -5206, -5044, -4883, -4724, -4568, -4413, -4262, -4113, -3967, -3822, 
-        -3681, -3540, -3401, -3264, -3133, -3003, -2874, -2747, -2622, -2499, -2378, -2259, 
-        -2144, -2031, -1920, -1810, -1703, -1596, -1493, -1392, -1295, -1198, -1104, -1011, 
-        -920, -831, -743, -658, -577, -495, -418, -343, -267, -194, -122, -55 
-    };
-
-    // AKWF_tri_0016 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0016[600] PROGMEM = {
-        14, 103, 191, 278, 362, 444, 524, 604, 680, 756, 830, 904, 
-        982, 1062, 1144, 1228, 1315, 1403, 1496, 1589, 1686, 1785, 1886, 1989, 
-        2095, 2200, 2310, 2422, 2537, 2653, 2771, 2892, 3014, 3138, 3265, 3395, 
-        3526, 3661, 3796, 3935, 4074, 4215, 4359, 4504, 4654, 4806, 4957, 5111, 
-        5267, 5425, 5586, 5750, 5914, 6083, 6252, 6422, 6595, 6770, 6947, 7126, 
-        7308, 7491, 7677, 7864, 8052, 8244, 8438, 8632, 8830, 9030, 9232, 9435, 
-        9639, 9846, 10054, 10265, 10480, 10695, 10912, 11132, 11351, 11574, 11798, 12025, 
-        12255, 12485, 12717, 12951, 13187, 13425, 13665, 13908, 14152, 14399, 14646, 14894, 
-        15143, 15396, 15651, 15908, 16167, 16429, 16692, 16956, 17221, 17489, 17759, 18029, 
-        18305, 18581, 18857, 19135, 19416, 19696, 19981, 20267, 20554, 20841, 21127, 21414, 
-        21701, 21987, 22274, 22561, 22850, 23138, 23425, 23712, 23998, 24285, 24572, 24858, 
-        25145, 25432, 25719, 26005, 26290, 26574, 26859, 27144, 27430, 27715, 27997, 28280, 
-        28562, 28845, 29127, 29410, 29690, 29972, 30253, 30531, 30809, 31087, 31364, 31642, 
-        31920, 32196, 32472, 32704, 32767, 32559, 32125, 31610, 31121, 30683, 30276, 29873, 
-        29466, 29053, 28642, 28240, 27843, 27451, 27061, 26676, 26294, 25917, 25544, 25177, 
-        24812, 24452, 24095, 23741, 23391, 23046, 22704, 22367, 22034, 21705, 21380, 21056, 
-        20737, 20421, 20109, 19802, 19498, 19197, 18899, 18606, 18315, 18027, 17742, 17460, 
-        17183, 16909, 16638, 16370, 16104, 15841, 15581, 15324, 15069, 14816, 14565, 14315, 
-        14068, 13821, 13577, 13334, 13094, 12856, 12620, 12386, 12152, 11920, 11692, 11465, 
-        11241, 11018, 10796, 10577, 10358, 10143, 9930, 9717, 9508, 9302, 9095, 8891, 
-        8688, 8486, 8288, 8092, 7898, 7706, 7514, 7327, 7139, 6952, 6768, 6587, 
-        6408, 6231, 6056, 5881, 5708, 5537, 5371, 5204, 5040, 4877, 4717, 4559, 
-        4401, 4245, 4091, 3939, 3792, 3644, 3499, 3353, 3212, 3071, 2932, 2797, 
-        2662, 2529, 2398, 2270, 2143, 2017, 1892, 1772, 1652, 1536, 1418, 1304, 
-        1190, 1081, 971, 864, 760, 657, 556, 457, 358, 261, 166, 73, 
-        -16, -103, -191, -278, -362, -444, -524, -604, -680, -756, -830, -904, 
-        -982, -1062, -1144, -1228, -1315, -1403, -1494, -1589, -1688, -1785, -1886, -1989, 
-        -2095, -2200, -2310, -2422, -2537, -2653, -2771, -2892, -3014, -3138, -3265, -3395, 
-        -3528, -3661, -3796, -3935, -4074, -4215, -4359, -4504, -4654, -4804, -4957, -5111, 
-        -5267, -5425, -5586, -5750, -5914, -6083, -6252, -6422, -6595, -6770, -6947, -7126, 
-        -7308, -7491, -7677, -7864, -8054, -8244, -8435, -8632, -8830, -9030, -9232, -9435, 
-        -9639, -9846, -10054, -10265, -10480, -10695, -10912, -11132, -11351, -11574, -11798, -12025, 
-        -12255, -12485, -12717, -12951, -13187, -13425, -13665, -13906, -14150, -14397, -14646, -14894, 
-        -15145, -15396, -15651, -15910, -16170, -16431, -16692, -16956, -17221, -17489, -17759, -18029, 
-        -18303, -18579, -18857, -19135, -19416, -19696, -19981, -20267, -20554, -20841, -21127, -21414, 
-        -21701, -21987, -22274, -22561, -22850, -23136, -23425, -23712, -23998, -24285, -24572, -24858, 
-        -25145, -25432, -25719, -26005, -26290, -26574, -26859, -27144, -27430, -27715, -27997, -28282, 
-        -28562, -28845, -29127, -29410, -29692, -29972, -30253, -30531, -30809, -31087, -31364, -31642, 
-        -31920, -32196, -32472, -32704, -32767, -32559, -32125, -31610, -31121, -30683, -30276, -29873, 
-        -29464, -29053, -28642, -28240, -27841, -27449, -27061, -26678, -26294, -25917, -25544, -25177, 
-        -24812, -24452, -24095, -23741, -23391, -23046, -22704, -22367, -22034, -21705, -21378, -21056, 
-        -20737, -20421, -20109, -19802, -19498, -19197, -18899, -18606, -18315, -18027, -17742, -17462, 
-        -17183, -16907, -16638, -16370, -16104, -15843, -15584, -15326, -15071, -14816, -14565, -14315, 
-        -14066, -13821, -13577, -13334, -13094, -12856, -12620, -12386, -12152, -11920, -11692, -11465, 
-        -11241, -11018, -10796, -10577, -10360, -10143, -9930, -9717, -9508, -9302, -9095, -8891, 
-        -8688, -8486, -8288, -8092, -7898, -7706, -7514, -7327, -7139, -6952, -6768, -6587, 
-        -6408, -6231, -6056, -5881, -5710, -5537, -5371, -5204, -5040, -4877, -4717, -4557, 
-        -4401, -4245, -4091, -3939, -3790, -3644, -3499, -3353, -3212, -3071, -2932, -2797, 
-        -2662, -2531, -2398, -2270, -2143, -2017, -1892, -1772, -1652, -1534, -1418, -1304, 
-        -1190, -1081, -971, -866, -760, -657, -556, -457, -358, -261, -166, -73 
-    };
-
-    // AKWF_tri_0017 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0017[600] PROGMEM = {
-        45, 177, 309, 439, 566, 693, 819, 944, 1067, 1194, 1324, 1456, 
-        1590, 1726, 1865, 2006, 2147, 2293, 2441, 2589, 2741, 2893, 3048, 3203, 
-        3362, 3519, 3681, 3844, 4010, 4177, 4345, 4513, 4684, 4857, 5032, 5209, 
-        5387, 5564, 5746, 5926, 6110, 6295, 6481, 6668, 6859, 7048, 7239, 7432, 
-        7626, 7821, 8019, 8217, 8417, 8618, 8820, 9022, 9227, 9432, 9639, 9848, 
-        10058, 10269, 10479, 10690, 10904, 11120, 11336, 11552, 11773, 11991, 12212, 12433, 
-        12654, 12876, 13102, 13327, 13554, 13782, 14009, 14239, 14469, 14699, 14933, 15165, 
-        15400, 15636, 15870, 16107, 16344, 16583, 16821, 17063, 17304, 17547, 17788, 18032, 
-        18275, 18521, 18767, 19015, 19263, 19511, 19761, 20009, 20259, 20512, 20762, 21017, 
-        21272, 21526, 21779, 22034, 22291, 22548, 22805, 23060, 23317, 23572, 23824, 24077, 
-        24327, 24577, 24827, 25078, 25328, 25574, 25822, 26065, 26311, 26554, 26798, 27039, 
-        27282, 27521, 27762, 27999, 28236, 28472, 28706, 28941, 29175, 29407, 29637, 29867, 
-        30094, 30322, 30549, 30775, 31000, 31223, 31443, 31664, 31885, 32103, 32319, 32538, 
-        32720, 32767, 32595, 32242, 31826, 31427, 31070, 30738, 30408, 30072, 29733, 29391, 
-        29057, 28725, 28397, 28072, 27749, 27428, 27107, 26791, 26477, 26167, 25858, 25553, 
-        25248, 24946, 24648, 24352, 24058, 23767, 23478, 23192, 22907, 22625, 22343, 22066, 
-        21790, 21517, 21246, 20978, 20714, 20450, 20186, 19927, 19668, 19413, 19158, 18908, 
-        18660, 18412, 18166, 17918, 17675, 17431, 17188, 16947, 16708, 16469, 16230, 15991, 
-        15754, 15520, 15284, 15051, 14819, 14587, 14358, 14128, 13898, 13670, 13445, 13220, 
-        12997, 12772, 12551, 12328, 12107, 11889, 11671, 11455, 11241, 11025, 10811, 10597, 
-        10385, 10176, 9967, 9760, 9553, 9348, 9143, 8938, 8736, 8533, 8335, 8135, 
-        7940, 7744, 7546, 7353, 7159, 6966, 6777, 6588, 6399, 6213, 6028, 5842, 
-        5660, 5476, 5296, 5116, 4939, 4764, 4586, 4413, 4238, 4067, 3897, 3728, 
-        3560, 3394, 3230, 3066, 2903, 2743, 2582, 2425, 2270, 2113, 1958, 1806, 
-        1653, 1506, 1358, 1210, 1067, 921, 780, 639, 498, 359, 222, 88, 
-        -45, -177, -309, -439, -566, -693, -819, -944, -1067, -1194, -1321, -1456, 
-        -1590, -1726, -1865, -2006, -2147, -2293, -2441, -2591, -2741, -2893, -3048, -3203, 
-        -3360, -3519, -3681, -3844, -4010, -4177, -4345, -4513, -4684, -4857, -5032, -5209, 
-        -5387, -5564, -5744, -5926, -6110, -6295, -6481, -6668, -6859, -7048, -7239, -7432, 
-        -7626, -7821, -8019, -8217, -8417, -8618, -8820, -9022, -9227, -9432, -9639, -9848, 
-        -10058, -10269, -10481, -10692, -10904, -11120, -11336, -11555, -11773, -11991, -12212, -12433, 
-        -12654, -12876, -13102, -13327, -13554, -13782, -14009, -14239, -14469, -14699, -14933, -15165, 
-        -15400, -15636, -15870, -16107, -16344, -16583, -16821, -17063, -17304, -17547, -17788, -18032, 
-        -18275, -18521, -18767, -19015, -19263, -19511, -19759, -20009, -20259, -20509, -20762, -21017, 
-        -21269, -21524, -21779, -22036, -22291, -22548, -22805, -23062, -23317, -23569, -23824, -24074, 
-        -24327, -24577, -24827, -25078, -25326, -25574, -25822, -26067, -26311, -26554, -26798, -27041, 
-        -27282, -27521, -27760, -27999, -28236, -28472, -28706, -28941, -29173, -29405, -29637, -29867, 
-        -30094, -30322, -30549, -30775, -31000, -31223, -31443, -31664, -31885, -32101, -32319, -32535, 
-        -32720, -32765, -32595, -32244, -31826, -31427, -31070, -30738, -30408, -30072, -29730, -29391, 
-        -29057, -28725, -28397, -28072, -27749, -27428, -27109, -26791, -26477, -26167, -25858, -25553, 
-        -25251, -24948, -24650, -24352, -24058, -23765, -23476, -23189, -22907, -22625, -22345, -22066, 
-        -21790, -21517, -21246, -20980, -20714, -20450, -20186, -19927, -19668, -19413, -19158, -18908, 
-        -18660, -18412, -18166, -17920, -17675, -17431, -17188, -16949, -16708, -16469, -16230, -15991, 
-        -15754, -15520, -15284, -15051, -14819, -14587, -14358, -14128, -13898, -13670, -13445, -13220, 
-        -12997, -12772, -12551, -12328, -12107, -11889, -11671, -11455, -11241, -11025, -10811, -10599, 
-        -10385, -10176, -9967, -9760, -9553, -9348, -9143, -8938, -8736, -8533, -8333, -8135, 
-        -7940, -7742, -7548, -7353, -7159, -6966, -6777, -6588, -6399, -6213, -6028, -5842, 
-        -5660, -5476, -5296, -5116, -4939, -4764, -4588, -4413, -4238, -4067, -3897, -3728, 
-        -3562, -3394, -3230, -3066, -2903, -2741, -2582, -2425, -2268, -2113, -1958, -1806, 
-        -1653, -1506, -1358, -1212, -1067, -921, -780, -637, -498, -359, -222, -88 
-    };
-
-    // AKWF_tri_0018 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0018[600] PROGMEM = {
-        2, 217, 434, 651, 868, 1085, 1304, 1521, 1740, 1960, 2179, 2401, 
-        2623, 2848, 3070, 3292, 3514, 3738, 3962, 4184, 4409, 4633, 4857, 5082, 
-        5306, 5531, 5753, 5980, 6204, 6428, 6653, 6877, 7102, 7326, 7550, 7775, 
-        7999, 8224, 8448, 8675, 8897, 9121, 9346, 9570, 9794, 10019, 10243, 10468, 
-        10692, 10914, 11138, 11363, 11587, 11812, 12036, 12258, 12482, 12704, 12929, 13151, 
-        13375, 13599, 13821, 14043, 14265, 14490, 14712, 14934, 15158, 15380, 15602, 15824, 
-        16046, 16268, 16490, 16711, 16933, 17155, 17377, 17599, 17819, 18041, 18260, 18482, 
-        18704, 18923, 19145, 19365, 19587, 19806, 20026, 20245, 20465, 20687, 20906, 21123, 
-        21343, 21562, 21782, 22001, 22218, 22437, 22657, 22876, 23093, 23310, 23530, 23747, 
-        23966, 24183, 24400, 24617, 24834, 25049, 25264, 25478, 25690, 25900, 26109, 26319, 
-        26524, 26728, 26933, 27135, 27337, 27537, 27737, 27932, 28127, 28321, 28516, 28708, 
-        28898, 29088, 29278, 29463, 29648, 29833, 30013, 30195, 30375, 30556, 30733, 30908, 
-        31083, 31256, 31428, 31599, 31769, 31939, 32107, 32272, 32437, 32600, 32735, 32767, 
-        32632, 32361, 32035, 31722, 31441, 31177, 30916, 30649, 30380, 30109, 29843, 29577, 
-        29313, 29051, 28790, 28531, 28272, 28016, 27762, 27505, 27254, 27002, 26751, 26501, 
-        26255, 26011, 25764, 25522, 25281, 25039, 24800, 24561, 24324, 24090, 23855, 23621, 
-        23389, 23158, 22928, 22701, 22474, 22248, 22023, 21799, 21577, 21355, 21133, 20914, 
-        20694, 20472, 20253, 20033, 19811, 19592, 19372, 19153, 18933, 18714, 18494, 18277, 
-        18058, 17838, 17619, 17399, 17182, 16965, 16746, 16529, 16310, 16093, 15873, 15656, 
-        15439, 15222, 15005, 14788, 14571, 14354, 14137, 13922, 13705, 13491, 13274, 13057, 
-        12840, 12625, 12408, 12194, 11979, 11762, 11548, 11333, 11119, 10902, 10687, 10473, 
-        10258, 10043, 9829, 9614, 9400, 9185, 8971, 8756, 8544, 8330, 8118, 7903, 
-        7688, 7474, 7259, 7047, 6835, 6621, 6409, 6194, 5980, 5765, 5553, 5341, 
-        5126, 4914, 4702, 4488, 4276, 4061, 3849, 3634, 3422, 3210, 2996, 2781, 
-        2569, 2355, 2140, 1928, 1713, 1501, 1287, 1072, 858, 643, 429, 212, 
-        -2, -217, -434, -651, -868, -1085, -1304, -1521, -1740, -1960, -2179, -2401, 
-        -2623, -2848, -3070, -3292, -3516, -3738, -3962, -4187, -4411, -4636, -4857, -5082, 
-        -5306, -5531, -5753, -5980, -6204, -6428, -6653, -6877, -7102, -7326, -7550, -7775, 
-        -7999, -8224, -8448, -8672, -8897, -9121, -9346, -9570, -9794, -10019, -10243, -10468, 
-        -10692, -10916, -11138, -11363, -11587, -11812, -12036, -12258, -12482, -12704, -12929, -13151, 
-        -13375, -13599, -13821, -14046, -14268, -14490, -14712, -14936, -15158, -15380, -15604, -15824, 
-        -16046, -16268, -16490, -16711, -16933, -17155, -17377, -17599, -17819, -18041, -18260, -18482, 
-        -18704, -18926, -19145, -19365, -19584, -19806, -20026, -20245, -20465, -20684, -20906, -21126, 
-        -21343, -21562, -21782, -22001, -22220, -22437, -22657, -22876, -23093, -23310, -23530, -23747, 
-        -23964, -24183, -24400, -24617, -24834, -25049, -25264, -25478, -25690, -25902, -26109, -26316, 
-        -26524, -26728, -26933, -27135, -27337, -27537, -27737, -27932, -28129, -28321, -28516, -28708, 
-        -28898, -29088, -29278, -29463, -29648, -29833, -30013, -30195, -30375, -30556, -30733, -30911, 
-        -31083, -31256, -31428, -31601, -31771, -31939, -32107, -32272, -32435, -32600, -32735, -32767, 
-        -32632, -32358, -32035, -31722, -31441, -31177, -30916, -30649, -30380, -30109, -29843, -29577, 
-        -29313, -29051, -28790, -28531, -28272, -28016, -27762, -27508, -27254, -27002, -26751, -26504, 
-        -26255, -26011, -25767, -25522, -25278, -25039, -24800, -24561, -24324, -24090, -23855, -23621, 
-        -23389, -23158, -22928, -22701, -22474, -22248, -22023, -21799, -21577, -21355, -21133, -20914, 
-        -20692, -20472, -20253, -20033, -19811, -19592, -19372, -19153, -18933, -18714, -18494, -18275, 
-        -18058, -17838, -17619, -17399, -17182, -16965, -16746, -16529, -16310, -16093, -15873, -15656, 
-        -15439, -15222, -15005, -14788, -14571, -14354, -14137, -13920, -13705, -13488, -13274, -13057, 
-        -12840, -12625, -12408, -12194, -11979, -11765, -11548, -11333, -11116, -10902, -10687, -10473, 
-        -10258, -10043, -9829, -9614, -9400, -9185, -8971, -8759, -8544, -8330, -8118, -7903, 
-        -7688, -7474, -7259, -7047, -6833, -6621, -6409, -6194, -5980, -5767, -5553, -5341, 
-        -5129, -4914, -4702, -4488, -4276, -4061, -3849, -3634, -3422, -3208, -2996, -2784, 
-        -2569, -2355, -2140, -1928, -1713, -1501, -1287, -1072, -858, -643, -429, -212 
-    };
-
-    // AKWF_tri_0019 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0019[600] PROGMEM = {
-        197, 527, 862, 1203, 1546, 1886, 2219, 2544, 2864, 3181, 3490, 3799, 
-        4103, 4405, 4704, 4997, 5286, 5574, 5858, 6141, 6419, 6697, 6970, 7243, 
-        7511, 7778, 8043, 8306, 8568, 8828, 9086, 9340, 9595, 9844, 10094, 10343, 
-        10593, 10837, 11082, 11326, 11568, 11807, 12046, 12282, 12519, 12753, 12989, 13221, 
-        13452, 13681, 13909, 14138, 14364, 14593, 14816, 15042, 15263, 15487, 15705, 15926, 
-        16144, 16363, 16581, 16799, 17012, 17228, 17441, 17654, 17868, 18078, 18289, 18499, 
-        18710, 18918, 19125, 19331, 19539, 19744, 19949, 20152, 20355, 20557, 20760, 20960, 
-        21163, 21363, 21563, 21763, 21961, 22158, 22353, 22551, 22746, 22943, 23138, 23333, 
-        23526, 23718, 23910, 24102, 24292, 24485, 24674, 24867, 25054, 25243, 25431, 25618, 
-        25805, 25992, 26179, 26366, 26548, 26730, 26912, 27091, 27268, 27445, 27622, 27796, 
-        27967, 28139, 28308, 28474, 28640, 28807, 28970, 29134, 29295, 29454, 29612, 29768, 
-        29924, 30080, 30233, 30384, 30535, 30683, 30831, 30977, 31122, 31265, 31408, 31551, 
-        31689, 31827, 31964, 32102, 32237, 32370, 32502, 32635, 32744, 32767, 32656, 32427, 
-        32159, 31902, 31671, 31452, 31232, 31011, 30784, 30558, 30335, 30114, 29893, 29672, 
-        29454, 29233, 29015, 28796, 28581, 28367, 28152, 27939, 27725, 27512, 27299, 27089, 
-        26878, 26670, 26462, 26257, 26049, 25844, 25636, 25433, 25228, 25025, 24825, 24622, 
-        24422, 24222, 24022, 23822, 23624, 23427, 23229, 23034, 22837, 22639, 22439, 22242, 
-        22044, 21844, 21646, 21449, 21249, 21049, 20849, 20648, 20446, 20246, 20045, 19843, 
-        19643, 19440, 19237, 19034, 18829, 18626, 18424, 18218, 18013, 17808, 17602, 17397, 
-        17189, 16984, 16776, 16568, 16360, 16152, 15942, 15731, 15521, 15310, 15100, 14889, 
-        14676, 14463, 14250, 14034, 13821, 13605, 13389, 13174, 12955, 12737, 12519, 12298, 
-        12077, 11856, 11635, 11414, 11188, 10965, 10739, 10512, 10286, 10058, 9829, 9598, 
-        9366, 9135, 8901, 8665, 8431, 8192, 7955, 7716, 7472, 7230, 6986, 6739, 
-        6492, 6245, 5993, 5741, 5486, 5229, 4969, 4709, 4446, 4181, 3914, 3643, 
-        3368, 3092, 2812, 2531, 2245, 1954, 1663, 1364, 1062, 756, 441, 124, 
-        -197, -527, -862, -1203, -1546, -1886, -2219, -2544, -2864, -3178, -3490, -3799, 
-        -4103, -4405, -4701, -4997, -5286, -5574, -5858, -6141, -6419, -6697, -6970, -7243, 
-        -7511, -7778, -8043, -8306, -8568, -8826, -9086, -9340, -9595, -9844, -10094, -10343, 
-        -10593, -10837, -11084, -11326, -11568, -11807, -12046, -12282, -12519, -12753, -12989, -13221, 
-        -13452, -13683, -13909, -14138, -14367, -14593, -14816, -15042, -15263, -15487, -15705, -15926, 
-        -16144, -16363, -16581, -16799, -17015, -17228, -17441, -17654, -17868, -18078, -18291, -18499, 
-        -18710, -18918, -19125, -19331, -19536, -19744, -19949, -20152, -20357, -20557, -20760, -20960, 
-        -21163, -21363, -21563, -21763, -21961, -22158, -22353, -22551, -22746, -22943, -23138, -23333, 
-        -23526, -23718, -23910, -24102, -24292, -24485, -24677, -24867, -25054, -25243, -25431, -25618, 
-        -25805, -25992, -26179, -26366, -26548, -26730, -26912, -27091, -27268, -27447, -27622, -27796, 
-        -27967, -28139, -28308, -28474, -28640, -28807, -28970, -29134, -29295, -29454, -29612, -29768, 
-        -29924, -30080, -30233, -30384, -30535, -30683, -30831, -30977, -31122, -31265, -31408, -31551, 
-        -31689, -31829, -31964, -32102, -32237, -32370, -32502, -32635, -32744, -32767, -32656, -32427, 
-        -32159, -31902, -31671, -31450, -31234, -31011, -30784, -30558, -30335, -30114, -29893, -29672, 
-        -29454, -29233, -29015, -28796, -28581, -28365, -28152, -27939, -27725, -27512, -27299, -27089, 
-        -26881, -26670, -26462, -26257, -26049, -25841, -25636, -25433, -25228, -25025, -24825, -24622, 
-        -24422, -24222, -24022, -23822, -23624, -23427, -23232, -23034, -22837, -22639, -22439, -22242, 
-        -22044, -21844, -21646, -21446, -21249, -21049, -20849, -20646, -20446, -20246, -20045, -19843, 
-        -19643, -19440, -19237, -19032, -18829, -18626, -18424, -18218, -18013, -17808, -17602, -17395, 
-        -17189, -16984, -16776, -16568, -16360, -16152, -15942, -15731, -15521, -15310, -15100, -14889, 
-        -14676, -14463, -14250, -14034, -13821, -13605, -13389, -13174, -12955, -12737, -12519, -12298, 
-        -12077, -11856, -11635, -11412, -11188, -10965, -10739, -10512, -10286, -10058, -9829, -9598, 
-        -9366, -9135, -8901, -8665, -8431, -8192, -7955, -7716, -7474, -7230, -6986, -6739, 
-        -6492, -6245, -5993, -5741, -5486, -5229, -4969, -4709, -4446, -4181, -3914, -3643, 
-        -3370, -3092, -2812, -2528, -2245, -1954, -1663, -1364, -1062, -756, -441, -124 
-    };
-
-    // AKWF_tri_0020 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0020[600] PROGMEM = {
-        354, 816, 1290, 1768, 2232, 2678, 3100, 3507, 3903, 4287, 4662, 5027, 
-        5384, 5734, 6078, 6412, 6743, 7064, 7382, 7692, 8000, 8302, 8600, 8894, 
-        9184, 9471, 9752, 10031, 10305, 10579, 10847, 11113, 11377, 11638, 11893, 12149, 
-        12402, 12652, 12900, 13147, 13390, 13630, 13870, 14107, 14342, 14576, 14808, 15038, 
-        15265, 15492, 15719, 15940, 16162, 16384, 16600, 16819, 17035, 17249, 17460, 17672, 
-        17883, 18092, 18300, 18506, 18712, 18916, 19119, 19320, 19521, 19721, 19920, 20118, 
-        20313, 20509, 20702, 20895, 21088, 21281, 21471, 21661, 21849, 22037, 22225, 22410, 
-        22595, 22778, 22963, 23145, 23328, 23508, 23688, 23865, 24045, 24222, 24399, 24577, 
-        24752, 24926, 25101, 25273, 25445, 25617, 25789, 25961, 26131, 26300, 26467, 26637, 
-        26804, 26971, 27138, 27302, 27466, 27628, 27787, 27946, 28102, 28259, 28413, 28567, 
-        28718, 28869, 29018, 29164, 29310, 29456, 29599, 29740, 29881, 30022, 30157, 30295, 
-        30431, 30564, 30697, 30830, 30958, 31088, 31216, 31341, 31466, 31591, 31714, 31837, 
-        31957, 32074, 32191, 32309, 32423, 32538, 32653, 32747, 32767, 32666, 32468, 32230, 
-        32003, 31797, 31604, 31412, 31216, 31018, 30817, 30616, 30421, 30222, 30027, 29834, 
-        29638, 29443, 29250, 29057, 28864, 28671, 28480, 28290, 28100, 27909, 27719, 27531, 
-        27341, 27156, 26968, 26783, 26595, 26410, 26225, 26040, 25857, 25672, 25489, 25307, 
-        25127, 24944, 24762, 24582, 24399, 24220, 24040, 23857, 23677, 23492, 23309, 23127, 
-        22942, 22759, 22574, 22389, 22204, 22019, 21831, 21643, 21455, 21268, 21080, 20892, 
-        20702, 20511, 20318, 20128, 19935, 19745, 19552, 19356, 19163, 18968, 18772, 18574, 
-        18378, 18180, 17982, 17784, 17583, 17382, 17179, 16975, 16772, 16569, 16365, 16159, 
-        15953, 15745, 15536, 15325, 15114, 14902, 14689, 14477, 14261, 14044, 13825, 13606, 
-        13387, 13166, 12944, 12720, 12495, 12269, 12042, 11810, 11578, 11345, 11111, 10876, 
-        10636, 10396, 10154, 9909, 9664, 9416, 9163, 8910, 8657, 8399, 8135, 7872, 
-        7606, 7335, 7064, 6787, 6508, 6224, 5935, 5645, 5348, 5048, 4743, 4433, 
-        4114, 3791, 3462, 3126, 2782, 2430, 2067, 1697, 1314, 920, 511, 86, 
-        -354, -816, -1290, -1768, -2232, -2678, -3100, -3507, -3903, -4287, -4662, -5027, 
-        -5384, -5734, -6078, -6412, -6740, -7064, -7382, -7692, -8000, -8302, -8600, -8894, 
-        -9184, -9471, -9752, -10031, -10305, -10579, -10847, -11113, -11377, -11635, -11893, -12149, 
-        -12402, -12652, -12900, -13145, -13390, -13630, -13870, -14107, -14342, -14576, -14808, -15038, 
-        -15267, -15492, -15716, -15940, -16162, -16381, -16600, -16819, -17035, -17249, -17460, -17672, 
-        -17883, -18092, -18300, -18506, -18712, -18916, -19119, -19320, -19521, -19721, -19920, -20118, 
-        -20313, -20509, -20704, -20895, -21088, -21281, -21471, -21661, -21849, -22037, -22222, -22410, 
-        -22595, -22778, -22963, -23145, -23328, -23508, -23688, -23865, -24045, -24222, -24399, -24577, 
-        -24752, -24926, -25101, -25273, -25445, -25617, -25789, -25961, -26131, -26300, -26467, -26637, 
-        -26804, -26971, -27138, -27302, -27466, -27628, -27787, -27946, -28102, -28259, -28413, -28567, 
-        -28718, -28869, -29018, -29164, -29310, -29456, -29599, -29740, -29881, -30022, -30157, -30295, 
-        -30431, -30564, -30697, -30827, -30958, -31088, -31216, -31341, -31466, -31591, -31714, -31837, 
-        -31957, -32074, -32191, -32309, -32423, -32538, -32653, -32747, -32767, -32666, -32468, -32230, 
-        -32003, -31797, -31604, -31412, -31216, -31015, -30817, -30616, -30421, -30222, -30027, -29834, 
-        -29638, -29443, -29250, -29057, -28864, -28671, -28480, -28290, -28100, -27909, -27719, -27531, 
-        -27341, -27156, -26968, -26783, -26595, -26410, -26225, -26040, -25857, -25672, -25489, -25310, 
-        -25127, -24944, -24762, -24582, -24399, -24220, -24040, -23857, -23677, -23495, -23309, -23127, 
-        -22942, -22759, -22574, -22389, -22204, -22019, -21831, -21643, -21455, -21268, -21080, -20890, 
-        -20702, -20511, -20321, -20128, -19935, -19745, -19552, -19356, -19163, -18968, -18772, -18574, 
-        -18378, -18180, -17982, -17781, -17583, -17382, -17179, -16975, -16772, -16569, -16365, -16159, 
-        -15953, -15745, -15536, -15325, -15114, -14902, -14689, -14475, -14261, -14044, -13828, -13606, 
-        -13387, -13166, -12944, -12722, -12495, -12269, -12039, -11810, -11578, -11345, -11111, -10876, 
-        -10636, -10396, -10154, -9909, -9664, -9416, -9165, -8913, -8657, -8396, -8135, -7872, 
-        -7606, -7335, -7064, -6787, -6508, -6224, -5937, -5645, -5348, -5048, -4743, -4433, 
-        -4114, -3791, -3462, -3126, -2782, -2430, -2067, -1697, -1314, -920, -511, -86 
-    };
-
-    // AKWF_tri_0021 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0021[600] PROGMEM = {
-        598, 1438, 2287, 3076, 3771, 4380, 4935, 5460, 5961, 6441, 6902, 7341, 
-        7761, 8165, 8559, 8938, 9308, 9669, 10019, 10358, 10690, 11013, 11331, 11643, 
-        11948, 12247, 12540, 12829, 13112, 13389, 13661, 13931, 14195, 14459, 14715, 14968, 
-        15216, 15463, 15706, 15946, 16183, 16417, 16649, 16875, 17101, 17325, 17546, 17762, 
-        17980, 18193, 18403, 18613, 18818, 19022, 19227, 19426, 19626, 19825, 20019, 20213, 
-        20404, 20596, 20784, 20970, 21156, 21339, 21522, 21703, 21881, 22059, 22236, 22411, 
-        22587, 22759, 22929, 23098, 23268, 23435, 23602, 23767, 23931, 24095, 24257, 24416, 
-        24575, 24734, 24890, 25046, 25203, 25359, 25512, 25663, 25814, 25965, 26116, 26264, 
-        26412, 26558, 26706, 26849, 26994, 27137, 27280, 27422, 27563, 27703, 27843, 27980, 
-        28120, 28255, 28392, 28527, 28659, 28794, 28923, 29052, 29179, 29306, 29430, 29553, 
-        29675, 29796, 29917, 30033, 30152, 30265, 30381, 30494, 30604, 30717, 30825, 30933, 
-        31041, 31146, 31251, 31353, 31455, 31558, 31658, 31755, 31854, 31949, 32045, 32140, 
-        32231, 32326, 32417, 32506, 32595, 32681, 32754, 32767, 32687, 32525, 32334, 32151, 
-        31984, 31825, 31666, 31507, 31342, 31181, 31019, 30855, 30693, 30531, 30372, 30211, 
-        30049, 29890, 29731, 29572, 29411, 29252, 29093, 28934, 28775, 28619, 28460, 28303, 
-        28144, 27988, 27829, 27673, 27517, 27361, 27207, 27051, 26894, 26738, 26582, 26428, 
-        26272, 26119, 25962, 25806, 25650, 25494, 25337, 25178, 25019, 24860, 24701, 24543, 
-        24381, 24219, 24055, 23893, 23729, 23565, 23400, 23233, 23066, 22899, 22732, 22562, 
-        22393, 22223, 22050, 21881, 21706, 21533, 21358, 21183, 21005, 20827, 20650, 20469, 
-        20289, 20108, 19925, 19742, 19558, 19373, 19184, 18995, 18807, 18616, 18424, 18230, 
-        18036, 17842, 17643, 17444, 17244, 17042, 16837, 16633, 16428, 16221, 16010, 15798, 
-        15585, 15366, 15148, 14930, 14709, 14486, 14259, 14030, 13799, 13564, 13330, 13090, 
-        12848, 12605, 12357, 12107, 11851, 11595, 11333, 11067, 10800, 10525, 10250, 9968, 
-        9679, 9386, 9089, 8785, 8475, 8160, 7837, 7508, 7168, 6821, 6463, 6093, 
-        5716, 5326, 4919, 4499, 4059, 3601, 3119, 2613, 2071, 1495, 867, 172, 
-        -598, -1438, -2287, -3076, -3771, -4380, -4935, -5460, -5961, -6441, -6902, -7341, 
-        -7761, -8165, -8559, -8938, -9308, -9669, -10016, -10358, -10690, -11013, -11331, -11643, 
-        -11948, -12247, -12540, -12829, -13112, -13389, -13661, -13931, -14195, -14456, -14715, -14968, 
-        -15216, -15463, -15706, -15946, -16183, -16417, -16649, -16875, -17101, -17325, -17543, -17762, 
-        -17980, -18193, -18403, -18613, -18820, -19025, -19227, -19429, -19629, -19825, -20019, -20213, 
-        -20404, -20596, -20784, -20970, -21156, -21339, -21522, -21703, -21881, -22059, -22236, -22411, 
-        -22587, -22759, -22929, -23098, -23268, -23435, -23602, -23767, -23931, -24093, -24257, -24416, 
-        -24575, -24734, -24890, -25048, -25203, -25359, -25512, -25663, -25814, -25965, -26116, -26264, 
-        -26412, -26558, -26706, -26849, -26994, -27137, -27280, -27422, -27563, -27703, -27843, -27980, 
-        -28118, -28255, -28392, -28527, -28659, -28791, -28923, -29052, -29179, -29306, -29430, -29553, 
-        -29675, -29796, -29917, -30033, -30152, -30265, -30381, -30494, -30604, -30717, -30825, -30933, 
-        -31041, -31146, -31251, -31353, -31455, -31558, -31658, -31755, -31852, -31949, -32045, -32137, 
-        -32231, -32326, -32415, -32506, -32595, -32681, -32754, -32767, -32687, -32525, -32334, -32151, 
-        -31981, -31825, -31666, -31507, -31342, -31181, -31016, -30855, -30693, -30531, -30372, -30211, 
-        -30052, -29890, -29731, -29570, -29411, -29252, -29093, -28934, -28775, -28619, -28460, -28303, 
-        -28144, -27988, -27829, -27673, -27519, -27363, -27207, -27051, -26894, -26738, -26582, -26428, 
-        -26272, -26119, -25962, -25806, -25650, -25494, -25337, -25178, -25019, -24860, -24701, -24540, 
-        -24381, -24217, -24055, -23893, -23729, -23565, -23400, -23233, -23066, -22899, -22732, -22562, 
-        -22393, -22223, -22053, -21881, -21706, -21533, -21358, -21183, -21005, -20827, -20650, -20472, 
-        -20291, -20108, -19925, -19742, -19558, -19373, -19184, -18995, -18807, -18616, -18424, -18230, 
-        -18036, -17840, -17643, -17444, -17244, -17042, -16837, -16635, -16428, -16221, -16010, -15798, 
-        -15582, -15366, -15148, -14930, -14709, -14486, -14259, -14030, -13799, -13564, -13327, -13090, 
-        -12850, -12605, -12357, -12107, -11851, -11595, -11333, -11067, -10800, -10525, -10248, -9968, 
-        -9679, -9386, -9089, -8785, -8478, -8160, -7837, -7505, -7168, -6821, -6463, -6093, 
-        -5716, -5326, -4919, -4499, -4059, -3601, -3119, -2613, -2074, -1495, -864, -172 
-    };
-
-    // AKWF_tri_0022 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0022[600] PROGMEM = {
-        88, 1557, 3073, 4378, 5366, 6107, 6730, 7316, 7891, 8442, 8962, 9443, 
-        9900, 10334, 10749, 11150, 11540, 11913, 12276, 12624, 12965, 13296, 13617, 13933, 
-        14237, 14536, 14829, 15114, 15393, 15667, 15935, 16198, 16455, 16710, 16959, 17205, 
-        17446, 17681, 17913, 18143, 18367, 18588, 18807, 19025, 19238, 19446, 19653, 19858, 
-        20057, 20256, 20453, 20646, 20837, 21028, 21213, 21399, 21578, 21761, 21938, 22115, 
-        22289, 22461, 22632, 22801, 22967, 23133, 23296, 23459, 23620, 23777, 23935, 24090, 
-        24245, 24397, 24549, 24699, 24848, 24995, 25141, 25285, 25429, 25570, 25711, 25852, 
-        25990, 26129, 26264, 26400, 26533, 26665, 26798, 26928, 27058, 27188, 27315, 27443, 
-        27567, 27692, 27816, 27941, 28062, 28184, 28303, 28422, 28541, 28657, 28773, 28889, 
-        29006, 29119, 29232, 29346, 29456, 29564, 29672, 29780, 29885, 29990, 30093, 30192, 
-        30292, 30391, 30488, 30585, 30682, 30776, 30867, 30958, 31050, 31138, 31227, 31315, 
-        31401, 31487, 31570, 31653, 31733, 31813, 31893, 31971, 32051, 32126, 32203, 32275, 
-        32350, 32422, 32494, 32566, 32635, 32704, 32759, 32767, 32698, 32566, 32408, 32256, 
-        32117, 31987, 31857, 31722, 31586, 31451, 31315, 31180, 31047, 30911, 30776, 30640, 
-        30505, 30372, 30236, 30104, 29968, 29835, 29700, 29567, 29432, 29296, 29163, 29030, 
-        28898, 28762, 28629, 28494, 28361, 28225, 28093, 27960, 27827, 27692, 27559, 27426, 
-        27290, 27158, 27022, 26887, 26751, 26616, 26477, 26339, 26198, 26060, 25918, 25777, 
-        25636, 25495, 25351, 25208, 25064, 24917, 24771, 24624, 24477, 24328, 24176, 24026, 
-        23874, 23722, 23567, 23415, 23260, 23103, 22945, 22787, 22627, 22466, 22303, 22143, 
-        21979, 21813, 21648, 21479, 21310, 21139, 20967, 20796, 20621, 20444, 20267, 20090, 
-        19908, 19725, 19542, 19357, 19172, 18984, 18793, 18599, 18406, 18209, 18010, 17811, 
-        17609, 17404, 17197, 16989, 16776, 16563, 16345, 16126, 15905, 15678, 15449, 15219, 
-        14984, 14746, 14503, 14256, 14007, 13756, 13496, 13233, 12967, 12693, 12417, 12135, 
-        11847, 11551, 11249, 10940, 10622, 10298, 9966, 9623, 9272, 8907, 8530, 8140, 
-        7734, 7313, 6873, 6411, 5927, 5413, 4862, 4270, 3626, 2912, 2102, 1131, 
-        -91, -1560, -3073, -4378, -5366, -6107, -6730, -7316, -7891, -8442, -8962, -9443, 
-        -9900, -10334, -10749, -11150, -11540, -11913, -12273, -12624, -12965, -13296, -13617, -13933, 
-        -14237, -14536, -14829, -15114, -15393, -15667, -15935, -16198, -16455, -16710, -16959, -17202, 
-        -17446, -17681, -17913, -18143, -18367, -18588, -18809, -19025, -19238, -19446, -19653, -19858, 
-        -20057, -20256, -20453, -20646, -20837, -21028, -21213, -21399, -21578, -21761, -21938, -22115, 
-        -22289, -22461, -22632, -22801, -22967, -23133, -23296, -23459, -23620, -23777, -23935, -24090, 
-        -24245, -24397, -24549, -24699, -24848, -24995, -25141, -25288, -25429, -25573, -25714, -25852, 
-        -25990, -26129, -26264, -26400, -26533, -26665, -26798, -26928, -27058, -27188, -27315, -27443, 
-        -27567, -27692, -27816, -27941, -28062, -28184, -28303, -28422, -28541, -28657, -28773, -28892, 
-        -29006, -29122, -29235, -29346, -29456, -29564, -29672, -29780, -29885, -29990, -30093, -30192, 
-        -30292, -30391, -30488, -30585, -30682, -30776, -30867, -30958, -31050, -31138, -31227, -31315, 
-        -31401, -31487, -31570, -31653, -31733, -31813, -31893, -31974, -32051, -32126, -32203, -32275, 
-        -32350, -32422, -32494, -32566, -32635, -32704, -32759, -32767, -32698, -32566, -32408, -32256, 
-        -32117, -31987, -31857, -31722, -31586, -31451, -31315, -31180, -31044, -30911, -30776, -30640, 
-        -30505, -30372, -30236, -30104, -29968, -29835, -29700, -29564, -29432, -29296, -29163, -29030, 
-        -28895, -28762, -28629, -28494, -28361, -28225, -28093, -27960, -27827, -27692, -27559, -27426, 
-        -27290, -27158, -27022, -26887, -26751, -26616, -26477, -26339, -26198, -26060, -25918, -25780, 
-        -25636, -25495, -25351, -25208, -25064, -24917, -24771, -24624, -24475, -24328, -24179, -24026, 
-        -23874, -23722, -23570, -23415, -23260, -23103, -22945, -22787, -22627, -22466, -22303, -22143, 
-        -21977, -21813, -21648, -21479, -21307, -21139, -20967, -20796, -20621, -20444, -20267, -20087, 
-        -19908, -19725, -19542, -19357, -19172, -18984, -18793, -18599, -18406, -18209, -18010, -17811, 
-        -17609, -17404, -17197, -16989, -16776, -16563, -16345, -16126, -15902, -15678, -15451, -15219, 
-        -14984, -14746, -14503, -14259, -14007, -13756, -13496, -13233, -12967, -12693, -12417, -12135, 
-        -11847, -11551, -11249, -10940, -10622, -10298, -9966, -9623, -9272, -8907, -8530, -8140, 
-        -7734, -7313, -6873, -6411, -5925, -5413, -4862, -4270, -3626, -2912, -2102, -1131 
-    };
-
-    // AKWF_tri_0023 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0023[600] PROGMEM = {
-        1639, 4025, 5939, 7178, 7950, 8549, 9150, 9777, 10392, 10958, 11472, 11945, 
-        12396, 12829, 13246, 13649, 14032, 14401, 14760, 15104, 15439, 15764, 16080, 16385, 
-        16684, 16975, 17258, 17535, 17806, 18069, 18326, 18578, 18827, 19068, 19306, 19538, 
-        19764, 19988, 20209, 20425, 20634, 20844, 21048, 21250, 21446, 21642, 21835, 22022, 
-        22207, 22391, 22570, 22747, 22923, 23096, 23264, 23432, 23597, 23759, 23922, 24081, 
-        24238, 24392, 24543, 24694, 24845, 24990, 25136, 25278, 25418, 25558, 25698, 25835, 
-        25969, 26101, 26232, 26364, 26493, 26621, 26747, 26870, 26993, 27116, 27237, 27354, 
-        27474, 27589, 27707, 27821, 27933, 28045, 28154, 28266, 28375, 28482, 28588, 28694, 
-        28798, 28901, 29002, 29103, 29203, 29304, 29402, 29500, 29595, 29690, 29785, 29878, 
-        29970, 30062, 30152, 30241, 30328, 30415, 30499, 30583, 30664, 30745, 30826, 30904, 
-        30983, 31058, 31134, 31206, 31279, 31352, 31422, 31492, 31562, 31629, 31693, 31760, 
-        31825, 31886, 31951, 32012, 32071, 32130, 32188, 32247, 32303, 32359, 32415, 32468, 
-        32521, 32574, 32625, 32675, 32723, 32765, 32767, 32712, 32602, 32477, 32356, 32244, 
-        32141, 32035, 31928, 31816, 31707, 31598, 31486, 31377, 31268, 31159, 31050, 30938, 
-        30829, 30717, 30608, 30496, 30387, 30275, 30163, 30054, 29942, 29830, 29718, 29606, 
-        29494, 29385, 29273, 29159, 29047, 28935, 28823, 28708, 28596, 28482, 28370, 28255, 
-        28140, 28026, 27908, 27791, 27673, 27556, 27438, 27318, 27198, 27074, 26951, 26828, 
-        26705, 26579, 26453, 26327, 26199, 26070, 25941, 25810, 25678, 25547, 25413, 25278, 
-        25144, 25007, 24867, 24730, 24590, 24448, 24305, 24162, 24017, 23871, 23723, 23575, 
-        23424, 23273, 23121, 22968, 22811, 22651, 22495, 22333, 22170, 22008, 21843, 21675, 
-        21507, 21337, 21163, 20987, 20811, 20634, 20453, 20271, 20083, 19896, 19708, 19515, 
-        19320, 19124, 18922, 18721, 18517, 18307, 18094, 17879, 17661, 17440, 17216, 16986, 
-        16754, 16516, 16276, 16030, 15781, 15526, 15266, 15000, 14729, 14452, 14169, 13878, 
-        13579, 13277, 12963, 12642, 12309, 11970, 11618, 11254, 10879, 10488, 10082, 9660, 
-        9215, 8750, 8261, 7743, 7189, 6596, 5953, 5242, 4442, 3513, 2319, 615, 
-        -1650, -4034, -5942, -7178, -7947, -8546, -9150, -9780, -10392, -10958, -11472, -11945, 
-        -12396, -12829, -13246, -13646, -14032, -14401, -14760, -15104, -15439, -15764, -16080, -16388, 
-        -16684, -16975, -17258, -17535, -17806, -18069, -18326, -18578, -18824, -19068, -19306, -19538, 
-        -19764, -19988, -20209, -20425, -20634, -20844, -21048, -21250, -21446, -21642, -21835, -22022, 
-        -22207, -22391, -22570, -22747, -22923, -23093, -23264, -23432, -23597, -23759, -23922, -24078, 
-        -24238, -24392, -24543, -24694, -24842, -24990, -25136, -25278, -25418, -25558, -25698, -25835, 
-        -25969, -26101, -26232, -26364, -26493, -26621, -26747, -26870, -26993, -27116, -27237, -27354, 
-        -27474, -27589, -27707, -27821, -27933, -28045, -28154, -28266, -28373, -28482, -28588, -28694, 
-        -28798, -28901, -29002, -29103, -29203, -29304, -29402, -29500, -29595, -29690, -29785, -29878, 
-        -29970, -30062, -30152, -30241, -30328, -30415, -30499, -30583, -30664, -30745, -30826, -30904, 
-        -30983, -31058, -31134, -31206, -31279, -31352, -31422, -31492, -31562, -31629, -31693, -31760, 
-        -31825, -31886, -31951, -32012, -32071, -32130, -32188, -32247, -32303, -32359, -32415, -32468, 
-        -32521, -32572, -32625, -32675, -32723, -32765, -32767, -32712, -32602, -32477, -32356, -32244, 
-        -32141, -32035, -31928, -31816, -31707, -31598, -31486, -31377, -31268, -31159, -31050, -30938, 
-        -30829, -30717, -30608, -30496, -30387, -30275, -30163, -30054, -29942, -29830, -29718, -29606, 
-        -29494, -29382, -29273, -29161, -29047, -28935, -28823, -28708, -28596, -28484, -28370, -28255, 
-        -28140, -28026, -27908, -27791, -27673, -27556, -27438, -27318, -27198, -27074, -26951, -26828, 
-        -26705, -26579, -26453, -26327, -26199, -26070, -25941, -25810, -25678, -25547, -25413, -25278, 
-        -25144, -25007, -24867, -24730, -24590, -24448, -24305, -24162, -24017, -23871, -23723, -23575, 
-        -23424, -23273, -23121, -22968, -22811, -22651, -22492, -22333, -22170, -22008, -21843, -21675, 
-        -21507, -21337, -21163, -20987, -20811, -20634, -20453, -20271, -20086, -19896, -19706, -19515, 
-        -19320, -19124, -18925, -18721, -18517, -18307, -18094, -17879, -17661, -17440, -17216, -16986, 
-        -16754, -16516, -16276, -16030, -15781, -15526, -15266, -15000, -14729, -14452, -14169, -13878, 
-        -13579, -13274, -12963, -12642, -12312, -11970, -11618, -11254, -10879, -10488, -10082, -9660, 
-        -9215, -8750, -8261, -7743, -7189, -6596, -5950, -5239, -4442, -3513, -2319, -618 
-    };
-
-    // AKWF_tri_0024 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0024[600] PROGMEM = {
-        1683, 4682, 7003, 8370, 9111, 9663, 10258, 10915, 11568, 12159, 12685, 13165, 
-        13619, 14058, 14483, 14891, 15282, 15655, 16014, 16359, 16695, 17023, 17339, 17643, 
-        17942, 18229, 18511, 18786, 19054, 19312, 19568, 19815, 20059, 20297, 20530, 20757, 
-        20978, 21197, 21412, 21622, 21826, 22027, 22225, 22420, 22610, 22800, 22983, 23164, 
-        23342, 23518, 23690, 23860, 24026, 24190, 24351, 24509, 24667, 24819, 24971, 25121, 
-        25270, 25414, 25557, 25698, 25839, 25974, 26109, 26241, 26373, 26502, 26632, 26758, 
-        26882, 27005, 27126, 27246, 27364, 27482, 27597, 27712, 27824, 27933, 28042, 28151, 
-        28257, 28364, 28467, 28571, 28671, 28772, 28872, 28970, 29068, 29162, 29257, 29349, 
-        29444, 29533, 29625, 29714, 29800, 29889, 29975, 30059, 30145, 30228, 30309, 30392, 
-        30469, 30550, 30625, 30702, 30777, 30849, 30920, 30992, 31061, 31130, 31196, 31262, 
-        31328, 31392, 31455, 31515, 31575, 31636, 31693, 31751, 31808, 31863, 31917, 31972, 
-        32023, 32075, 32124, 32173, 32222, 32271, 32317, 32362, 32408, 32452, 32495, 32538, 
-        32581, 32621, 32661, 32699, 32739, 32767, 32767, 32719, 32627, 32518, 32414, 32319, 
-        32227, 32138, 32044, 31949, 31854, 31759, 31664, 31570, 31475, 31377, 31282, 31188, 
-        31090, 30995, 30897, 30800, 30702, 30604, 30510, 30412, 30314, 30214, 30116, 30016, 
-        29918, 29817, 29720, 29619, 29519, 29418, 29317, 29217, 29116, 29016, 28912, 28812, 
-        28708, 28605, 28499, 28392, 28286, 28180, 28071, 27962, 27852, 27740, 27631, 27516, 
-        27404, 27289, 27175, 27057, 26942, 26824, 26703, 26583, 26462, 26339, 26215, 26092, 
-        25965, 25839, 25709, 25580, 25451, 25319, 25184, 25052, 24914, 24779, 24638, 24500, 
-        24356, 24216, 24072, 23926, 23779, 23630, 23477, 23325, 23173, 23018, 22860, 22699, 
-        22538, 22374, 22211, 22041, 21872, 21702, 21527, 21352, 21174, 20993, 20809, 20622, 
-        20432, 20243, 20048, 19849, 19651, 19447, 19240, 19031, 18815, 18600, 18379, 18152, 
-        17925, 17689, 17451, 17209, 16962, 16710, 16451, 16187, 15917, 15641, 15357, 15066, 
-        14768, 14463, 14150, 13825, 13492, 13147, 12794, 12424, 12044, 11648, 11234, 10801, 
-        10350, 9873, 9370, 8839, 8267, 7652, 6986, 6247, 5412, 4438, 3136, 1131, 
-        -1686, -4685, -7003, -8370, -9111, -9663, -10258, -10915, -11568, -12159, -12685, -13165, 
-        -13619, -14058, -14483, -14891, -15282, -15655, -16014, -16362, -16695, -17023, -17339, -17643, 
-        -17942, -18232, -18511, -18786, -19054, -19312, -19568, -19815, -20059, -20297, -20530, -20757, 
-        -20978, -21197, -21412, -21622, -21826, -22030, -22225, -22420, -22610, -22800, -22983, -23164, 
-        -23342, -23518, -23690, -23860, -24026, -24190, -24351, -24509, -24667, -24819, -24971, -25121, 
-        -25270, -25414, -25557, -25698, -25836, -25974, -26109, -26244, -26373, -26502, -26632, -26758, 
-        -26884, -27005, -27126, -27246, -27364, -27482, -27597, -27709, -27824, -27933, -28042, -28151, 
-        -28257, -28364, -28467, -28571, -28671, -28772, -28872, -28970, -29068, -29162, -29257, -29349, 
-        -29444, -29533, -29625, -29714, -29800, -29889, -29975, -30061, -30145, -30228, -30309, -30389, 
-        -30469, -30550, -30625, -30702, -30777, -30849, -30920, -30992, -31061, -31130, -31196, -31262, 
-        -31328, -31392, -31455, -31515, -31575, -31636, -31693, -31751, -31808, -31863, -31917, -31972, 
-        -32023, -32075, -32124, -32176, -32225, -32271, -32317, -32362, -32408, -32452, -32495, -32538, 
-        -32581, -32621, -32661, -32699, -32739, -32767, -32767, -32719, -32627, -32520, -32414, -32319, 
-        -32227, -32138, -32044, -31952, -31854, -31759, -31664, -31570, -31475, -31377, -31282, -31188, 
-        -31090, -30995, -30897, -30800, -30702, -30604, -30510, -30412, -30311, -30214, -30116, -30018, 
-        -29918, -29817, -29720, -29619, -29519, -29421, -29317, -29217, -29116, -29016, -28912, -28812, 
-        -28708, -28602, -28499, -28392, -28286, -28180, -28071, -27962, -27852, -27740, -27631, -27516, 
-        -27404, -27289, -27175, -27057, -26942, -26821, -26703, -26583, -26462, -26339, -26215, -26092, 
-        -25965, -25839, -25709, -25580, -25448, -25319, -25184, -25052, -24914, -24779, -24638, -24500, 
-        -24356, -24216, -24072, -23926, -23779, -23630, -23477, -23325, -23173, -23018, -22860, -22699, 
-        -22538, -22374, -22211, -22041, -21872, -21702, -21527, -21352, -21174, -20993, -20809, -20622, 
-        -20432, -20243, -20048, -19849, -19651, -19447, -19240, -19031, -18815, -18597, -18379, -18152, 
-        -17925, -17689, -17451, -17209, -16962, -16710, -16451, -16187, -15917, -15641, -15357, -15066, 
-        -14768, -14463, -14150, -13825, -13492, -13147, -12794, -12424, -12044, -11648, -11234, -10801, 
-        -10350, -9873, -9370, -8839, -8267, -7652, -6986, -6247, -5412, -4438, -3136, -1134 
-    };
-
-} // namespace AKWF_BwTri
@@ -1,62 +0,0 @@
-// Auto‑generated AKWF bank part. Do not edit manually.
-
-#pragma once
-#include <Arduino.h>
-
-namespace AKWF_BwTri {
-
-    // AKWF_tri_0025 → 600 samples
-    static const int16_t akwf_akwf_bwtri_akwf_tri_0025[600] PROGMEM = {
-        1716, 4941, 7421, 8858, 9614, 10169, 10778, 11460, 12135, 12747, 13291, 13782, 
-        14248, 14699, 15133, 15550, 15947, 16329, 16694, 17047, 17387, 17717, 18036, 18347, 
-        18646, 18939, 19221, 19499, 19767, 20028, 20284, 20531, 20776, 21011, 21244, 21471, 
-        21692, 21911, 22124, 22331, 22535, 22733, 22931, 23124, 23311, 23498, 23679, 23857, 
-        24029, 24202, 24371, 24538, 24699, 24860, 25018, 25173, 25323, 25475, 25622, 25768, 
-        25909, 26050, 26188, 26323, 26458, 26590, 26720, 26849, 26976, 27099, 27220, 27341, 
-        27459, 27576, 27694, 27806, 27918, 28031, 28140, 28246, 28352, 28456, 28559, 28660, 
-        28761, 28858, 28956, 29054, 29149, 29241, 29335, 29425, 29517, 29603, 29692, 29778, 
-        29861, 29945, 30028, 30112, 30192, 30273, 30350, 30428, 30502, 30580, 30655, 30727, 
-        30799, 30868, 30937, 31006, 31072, 31135, 31198, 31261, 31325, 31382, 31442, 31500, 
-        31557, 31612, 31667, 31721, 31773, 31825, 31874, 31922, 31971, 32020, 32066, 32112, 
-        32155, 32198, 32241, 32282, 32322, 32362, 32402, 32440, 32477, 32515, 32549, 32584, 
-        32618, 32650, 32681, 32713, 32745, 32767, 32765, 32719, 32638, 32543, 32451, 32365, 
-        32285, 32204, 32121, 32035, 31948, 31862, 31779, 31692, 31606, 31520, 31434, 31345, 
-        31258, 31172, 31083, 30997, 30908, 30819, 30730, 30640, 30551, 30459, 30370, 30281, 
-        30189, 30097, 30005, 29913, 29821, 29729, 29637, 29545, 29450, 29356, 29261, 29166, 
-        29071, 28973, 28876, 28778, 28677, 28577, 28476, 28373, 28269, 28166, 28062, 27956, 
-        27849, 27740, 27631, 27522, 27410, 27298, 27185, 27073, 26955, 26841, 26723, 26602, 
-        26484, 26360, 26240, 26116, 25993, 25866, 25737, 25607, 25478, 25346, 25211, 25079, 
-        24941, 24803, 24662, 24521, 24380, 24233, 24090, 23940, 23791, 23638, 23486, 23331, 
-        23173, 23012, 22851, 22687, 22520, 22354, 22181, 22009, 21833, 21655, 21474, 21290, 
-        21103, 20914, 20721, 20525, 20327, 20123, 19919, 19709, 19496, 19281, 19060, 18835, 
-        18605, 18373, 18134, 17890, 17642, 17387, 17128, 16861, 16590, 16312, 16024, 15731, 
-        15429, 15119, 14800, 14472, 14133, 13782, 13420, 13046, 12655, 12250, 11828, 11385, 
-        10919, 10431, 9913, 9364, 8778, 8143, 7450, 6682, 5817, 4803, 3440, 1310, 
-        -1710, -4935, -7418, -8858, -9617, -10172, -10778, -11460, -12135, -12747, -13291, -13782, 
-        -14248, -14699, -15133, -15550, -15947, -16326, -16694, -17045, -17387, -17717, -18036, -18347, 
-        -18646, -18939, -19223, -19499, -19767, -20028, -20284, -20531, -20776, -21011, -21244, -21471, 
-        -21692, -21911, -22124, -22331, -22535, -22736, -22931, -23124, -23311, -23498, -23679, -23854, 
-        -24029, -24202, -24371, -24538, -24699, -24860, -25018, -25173, -25326, -25475, -25622, -25768, 
-        -25909, -26050, -26188, -26323, -26458, -26590, -26720, -26849, -26976, -27099, -27220, -27341, 
-        -27461, -27576, -27694, -27806, -27918, -28031, -28137, -28246, -28352, -28456, -28559, -28660, 
-        -28761, -28861, -28956, -29054, -29149, -29241, -29335, -29425, -29517, -29603, -29692, -29778, 
-        -29861, -29945, -30028, -30112, -30192, -30273, -30350, -30428, -30505, -30580, -30655, -30727, 
-        -30799, -30868, -30937, -31006, -31069, -31135, -31198, -31261, -31325, -31385, -31442, -31500, 
-        -31557, -31612, -31667, -31721, -31773, -31825, -31874, -31922, -31971, -32017, -32066, -32109, 
-        -32155, -32198, -32241, -32282, -32322, -32362, -32402, -32440, -32477, -32515, -32549, -32584, 
-        -32615, -32650, -32681, -32713, -32745, -32767, -32765, -32719, -32638, -32543, -32451, -32365, 
-        -32285, -32204, -32121, -32035, -31948, -31862, -31779, -31692, -31606, -31520, -31434, -31345, 
-        -31258, -31172, -31083, -30997, -30908, -30819, -30730, -30640, -30551, -30459, -30370, -30281, 
-        -30189, -30097, -30008, -29913, -29821, -29729, -29637, -29545, -29450, -29356, -29261, -29166, 
-        -29068, -28973, -28876, -28778, -28677, -28577, -28476, -28373, -28272, -28166, -28062, -27956, 
-        -27849, -27740, -27631, -27522, -27410, -27298, -27185, -27070, -26955, -26841, -26723, -26602, 
-        -26484, -26363, -26240, -26116, -25993, -25866, -25737, -25607, -25475, -25346, -25211, -25079, 
-        -24941, -24803, -24665, -24521, -24380, -24233, -24090, -23940, -23791, -23638, -23486, -23331, 
-        -23173, -23012, -22851, -22687, -22520, -22354, -22181, -22009, -21833, -21655, -21474, -21290, 
-        -21103, -20914, -20721, -20525, -20327, -20123, -19919, -19709, -19496, -19281, -19060, -18835, 
-        -18605, -18373, -18134, -17890, -17642, -17387, -17128, -16861, -16588, -16309, -16024, -15731, 
-        -15429, -15119, -14800, -14472, -14133, -13782, -13420, -13046, -12655, -12250, -11828, -11385, 
-        -10919, -10431, -9913, -9364, -8778, -8143, -7450, -6682, -5817, -4803, -3437, -1307 
-    };
-
-} // namespace AKWF_BwTri
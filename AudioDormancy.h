@@ -0,0 +1,76 @@
+#pragma once
+#include <Audio.h>
+
+// ============================================================================
+// AudioDormancy: dormant-node elision helpers
+// ----------------------------------------------------------------------------
+// The audio library only calls update() on objects whose 'active' flag is
+// set.  Each block (OscillatorBlock, VoiceBlock, SynthEngine) knows which of
+// its objects can only reach the output through zero gains; it parks them
+// with setActive(false) so they cost nothing, and wakes them again when a
+// gain becomes non-zero.
+//
+// Parking rules:
+// - A parked node never transmits, so cords *out of* it need no handling.
+// - Cords *into* a parked node from a node that stays live must be unlinked,
+//   otherwise one block per input stays queued (and out of the pool) until
+//   the node wakes.  AudioConnection::disconnect() releases that block.
+// - Wake everything in one AudioLock::hold() section so a node and the
+//   cords that feed it come back in the same audio cycle (no half-patched
+//   block, no click).
+// - Only setActive() wakes a node.  AudioConnection::connect() sets 'active'
+//   on both ends, so every connect in a block that parks nodes goes through
+//   link() or connect() below, which put both flags back, and marks that
+//   block's dormancy dirty so its next pass decides what runs.
+// ============================================================================
+
+namespace AudioDormancy {
+
+// AudioStream::active is protected.  A pointer-to-member formed through a
+// derived class is the conforming way to reach it for stock objects.
+struct Access : public AudioStream {
+    static bool AudioStream::* activeFlag() { return &Access::active; }
+};
+
+inline void setActive(AudioStream& node, bool on) {
+    node.*Access::activeFlag() = on;
+}
+
+inline bool isActive(AudioStream& node) {
+    return node.*Access::activeFlag();
+}
+
+// AudioConnection's end points are protected; same trick as Access.
+struct CordAccess : public AudioConnection {
+    static AudioStream* AudioConnection::* srcPtr() { return &CordAccess::src; }
+    static AudioStream* AudioConnection::* dstPtr() { return &CordAccess::dst; }
+};
+
+// Connect without waking either end (ISR held off by the caller)
+inline void connect(AudioConnection& cord, AudioStream& src, unsigned char srcOut,
+                    AudioStream& dst, unsigned char dstIn) {
+    const bool srcOn = isActive(src), dstOn = isActive(dst);
+    cord.connect(src, srcOut, dst, dstIn);
+    setActive(src, srcOn);
+    setActive(dst, dstOn);
+}
+
+// Link or unlink a patch cord, only when its state changes; linking leaves
+// both ends parked or live as they were.
+// 'linked' is the caller's record of the cord state (cords start linked).
+inline void link(AudioConnection* cord, bool& linked, bool on) {
+    if (!cord || linked == on) return;
+    if (on) {
+        AudioStream* src = cord->*CordAccess::srcPtr();
+        AudioStream* dst = cord->*CordAccess::dstPtr();
+        const bool srcOn = src && isActive(*src), dstOn = dst && isActive(*dst);
+        cord->connect();
+        if (src) setActive(*src, srcOn);
+        if (dst) setActive(*dst, dstOn);
+    } else {
+        cord->disconnect();
+    }
+    linked = on;
+}
+
+} // namespace AudioDormancy
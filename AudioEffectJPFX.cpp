@@ -82,6 +82,10 @@ AudioEffectJPFX::AudioEffectJPFX()
     lfoPhaseR = 0.5f;
     lfoIncL = 0.0f;
     lfoIncR = 0.0f;
+    lfoValL = lfoValR = 0.0f;
+    lfoSlopeL = lfoSlopeR = 0.0f;
+    modLfoDecimation = 1;
+    modLfoCountdown = 0;
 
     // Initialize delay state
     delayType = JPFX_DELAY_OFF;
@@ -355,6 +359,12 @@ void AudioEffectJPFX::setModFeedback(float fb)
     }
 }
 
+void AudioEffectJPFX::setModLfoDecimation(uint8_t samples)
+{
+    modLfoDecimation = constrain(samples, (uint8_t)1, (uint8_t)32);
+    modLfoCountdown = 0;   // Re-evaluate on the next sample
+}
+
 void AudioEffectJPFX::setDelayEffect(DelayEffectType type)
 {
     if (type != delayType) {
@@ -447,13 +457,22 @@ inline void AudioEffectJPFX::processModulation(float inL, float inR, float &outL
     const float wetMix = modMix * presetMix;
     const float dryMix = 1.0f - wetMix;
     
-    // Compute LFO values
-    const float lfoValL = sinf(lfoPhaseL);
-    const float lfoValR = sinf(lfoPhaseR);
-    lfoPhaseL += lfoIncL;
-    if (lfoPhaseL > 6.283185307179586f) lfoPhaseL -= 6.283185307179586f;
-    lfoPhaseR += lfoIncR;
-    if (lfoPhaseR > 6.283185307179586f) lfoPhaseR -= 6.283185307179586f;
+    // Compute LFO values: evaluated every modLfoDecimation samples and
+    // ramped linearly in between (decimation 1 = exact per-sample LFO)
+    if (modLfoCountdown == 0) {
+        const uint8_t n = modLfoDecimation;
+        const float inv = 1.0f / (float)n;
+        lfoSlopeL = (sinf(lfoPhaseL) - lfoValL) * inv;
+        lfoSlopeR = (sinf(lfoPhaseR) - lfoValR) * inv;
+        lfoPhaseL += lfoIncL * n;
+        while (lfoPhaseL > 6.283185307179586f) lfoPhaseL -= 6.283185307179586f;
+        lfoPhaseR += lfoIncR * n;
+        while (lfoPhaseR > 6.283185307179586f) lfoPhaseR -= 6.283185307179586f;
+        modLfoCountdown = n;
+    }
+    modLfoCountdown--;
+    lfoValL += lfoSlopeL;
+    lfoValR += lfoSlopeR;
     
     // Convert delay times to samples
     const float fs = AUDIO_SAMPLE_RATE_EXACT;
@@ -85,6 +85,10 @@ public:
     void setModMix(float mix);          // 0.0..1.0, default 0.5
     void setModRate(float rate);        // Hz, 0 = use preset
     void setModFeedback(float fb);      // 0.0..0.99, -1 = use preset
+    // Mod LFO evaluated every N samples and ramped in between (1 = every
+    // sample, default).  Raised by the CPU governor under load.
+    void setModLfoDecimation(uint8_t samples);
+    uint8_t getModLfoDecimation() const { return modLfoDecimation; }
 
     // ----- Delay effect interface -----
     void setDelayEffect(DelayEffectType type);
@@ -148,6 +152,10 @@ private:
     float modFeedbackOverride;
     float lfoPhaseL, lfoPhaseR;
     float lfoIncL, lfoIncR;
+    float lfoValL, lfoValR;             // Current (ramped) LFO output
+    float lfoSlopeL, lfoSlopeR;         // Per-sample ramp to the next LFO point
+    uint8_t modLfoDecimation;           // Samples between LFO evaluations
+    uint8_t modLfoCountdown;
 
     void updateLfoIncrements();
     inline void processModulation(float inL, float inR, float &outL, float &outR);
@@ -0,0 +1,62 @@
+#pragma once
+#include <Audio.h>
+#include "LFORamp.h"
+
+// ============================================================================
+// AudioEffectLFOFade: sample-counted LFO delay / fade-in stage
+// ----------------------------------------------------------------------------
+// - 1 input, 1 output.  Sits directly after the LFO waveform generator so
+//   every destination (pitch, filter, PWM, amp) sees the same faded signal.
+// - retrigger() restarts a linear 0 → 1 ramp lasting setDelayMs() ms.
+//   The ramp is advanced per sample inside update(), so it has no
+//   dependency on loop() timing and no 1 ms stepping.
+// - Once the ramp has finished (or delay = 0) the input block is passed
+//   straight through with no copy and no per-sample work.
+// - Control-side calls are single 32-bit stores; safe against the audio ISR.
+// ============================================================================
+
+class AudioEffectLFOFade : public AudioStream {
+public:
+    AudioEffectLFOFade() : AudioStream(1, _inputQueue) {}
+
+    // Fade-in length in milliseconds.  0 disables the ramp (pass-through).
+    void setDelayMs(float ms) { _len = LFORamp::lengthFromMs(ms); }
+
+    // Restart the ramp from silence (called on noteOn).
+    void retrigger() { _pos = 0; }
+
+    // True while the ramp is still rising.
+    bool isRamping() const { return LFORamp::isRamping(_pos, _len); }
+
+protected:
+    void update() override {
+        audio_block_t* in = receiveReadOnly(0);
+        if (!in) return;
+
+        const uint32_t len = _len;
+        uint32_t       pos = _pos;
+
+        // Ramp finished: forward the block untouched
+        if (pos >= len) {
+            transmit(in);
+            release(in);
+            return;
+        }
+
+        audio_block_t* out = allocate();
+        if (!out) { release(in); return; }
+
+        pos = LFORamp::apply(in->data, out->data, pos, len);
+        // update() runs in the audio ISR, so retrigger() cannot land mid-block
+        _pos = pos;
+
+        transmit(out);
+        release(out);
+        release(in);
+    }
+
+private:
+    audio_block_t*    _inputQueue[1];
+    volatile uint32_t _len = 0;   // ramp length in samples
+    volatile uint32_t _pos = 0;   // samples elapsed since retrigger()
+};
@@ -0,0 +1,35 @@
+#pragma once
+#include <Audio.h>
+#include "Q15Kernels.h"
+
+// ============================================================================
+// AudioEffectMultiplyQ15: drop-in AudioEffectMultiply (ring modulator) on the
+// Q15 kernels
+// ----------------------------------------------------------------------------
+// out = sat16((a · b) >> 15), bit-identical to the stock effect.  Either
+// input missing → the product is silence, so nothing is transmitted.
+// ============================================================================
+
+class AudioEffectMultiplyQ15 : public AudioStream {
+public:
+    AudioEffectMultiplyQ15() : AudioStream(2, _inputQueue) {}
+
+protected:
+    void update() override {
+        audio_block_t* a = receiveReadOnly(0);
+        audio_block_t* b = receiveReadOnly(1);
+        if (a && b) {
+            audio_block_t* out = allocate();
+            if (out) {
+                Q15::multiply(out->data, a->data, b->data);
+                transmit(out);
+                release(out);
+            }
+        }
+        if (a) release(a);
+        if (b) release(b);
+    }
+
+private:
+    audio_block_t* _inputQueue[2];
+};
@@ -0,0 +1,132 @@
+#pragma once
+#include <Audio.h>
+#include "AudioSynthLFO.h"
+#include "LFORamp.h"
+
+// ============================================================================
+// AudioEffectVoiceLFO: one voice's copy of a shared LFO
+// ----------------------------------------------------------------------------
+// - 1 input (the shared AudioSynthLFO), 1 output to the voice's pitch / PWM /
+//   filter mod mixers.  The mixer gains only carry the depths; everything
+//   that happens per note happens here, inside the audio update.
+// - Delay: retrigger() (noteOn) restarts a linear 0 → 1 ramp lasting
+//   setDelayMs() ms, the same LFORamp as AudioEffectLFOFade, so a new note
+//   fades in its own modulation without touching the other voices.
+// - Key sync: instead of forwarding the shared signal the stage runs its
+//   own phase, restarted at 0 by retrigger(), at the shared generator's
+//   current rate, shape and amplitude (one value per LFO_SUBBLOCK_SAMPLES,
+//   interpolated, like AudioSynthLFO itself).
+// - Ramp finished and not key-synced: the input block is forwarded with no
+//   copy and no per-sample work.
+// - Control-side calls are single 32-bit stores; safe against the audio ISR.
+// ============================================================================
+
+class AudioEffectVoiceLFO : public AudioStream {
+public:
+    AudioEffectVoiceLFO() : AudioStream(1, _inputQueue) {}
+
+    // Shared generator to follow when key-synced (rate, shape, amplitude)
+    void setSource(const AudioSynthLFO* src) { _src = src; }
+
+    // Fade-in length in milliseconds.  0 disables the ramp.
+    void setDelayMs(float ms) { _len = LFORamp::lengthFromMs(ms); }
+
+    // Run this voice's own phase instead of the shared one
+    void setKeySync(bool on) { _keySync = on; }
+
+    // Restart the ramp (and the key-synced phase) at the next block (noteOn)
+    void retrigger() { _restart = true; }
+
+    // True while the ramp is still rising.
+    bool isRamping() const { return LFORamp::isRamping(_pos, _len); }
+
+protected:
+    void update() override {
+        audio_block_t* in = receiveReadOnly(0);
+
+        if (_restart) {
+            _restart = false;
+            _pos     = 0;
+            _phase   = 0;
+        }
+
+        const AudioSynthLFO* src = _src;
+        if (_keySync && src) {
+            if (in) release(in);
+            _updateKeySynced(*src);
+            return;
+        }
+
+        // Shared signal muted: the ramp still counts from noteOn
+        if (!in) { _advance(AUDIO_BLOCK_SAMPLES); return; }
+
+        const uint32_t len = _len;
+        uint32_t       pos = _pos;
+
+        // Ramp finished: forward the block untouched
+        if (pos >= len) {
+            transmit(in);
+            release(in);
+            return;
+        }
+
+        audio_block_t* out = allocate();
+        if (!out) { release(in); _advance(AUDIO_BLOCK_SAMPLES); return; }
+
+        pos = LFORamp::apply(in->data, out->data, pos, len);
+        _pos = pos;
+
+        transmit(out);
+        release(out);
+        release(in);
+    }
+
+private:
+    void _advance(uint32_t n) { _pos = LFORamp::advance(_pos, _len, n); }
+
+    void _updateKeySynced(const AudioSynthLFO& src) {
+        const uint32_t inc = src.getIncrement();
+        const float    amp = src.getAmplitude();
+
+        audio_block_t* out = (amp > 0.0f) ? allocate() : nullptr;
+        if (!out) {
+            _phase  += inc * AUDIO_BLOCK_SAMPLES;
+            _lastOut = 0.0f;
+            _advance(AUDIO_BLOCK_SAMPLES);
+            return;
+        }
+
+        const uint32_t subInc = inc * LFO_SUBBLOCK_SAMPLES;
+        const uint32_t len    = _len;
+        const float    scale  = amp * 32767.0f;
+        int16_t* dst = out->data;
+
+        for (uint16_t s = 0; s < AUDIO_BLOCK_SAMPLES; s += LFO_SUBBLOCK_SAMPLES) {
+            _phase += subInc;
+            _advance(LFO_SUBBLOCK_SAMPLES);
+            const float fade   = LFORamp::level(_pos, len);
+            const float target = src.valueAt(_phase) * scale * fade;
+            const float step   = (target - _lastOut) * (1.0f / LFO_SUBBLOCK_SAMPLES);
+            float v = _lastOut;
+            for (uint16_t i = 0; i < LFO_SUBBLOCK_SAMPLES; ++i) {
+                v += step;
+                dst[s + i] = (int16_t)v;
+            }
+            _lastOut = target;
+        }
+
+        transmit(out);
+        release(out);
+    }
+
+    audio_block_t*    _inputQueue[1];
+    const AudioSynthLFO* volatile _src = nullptr;
+    volatile uint32_t _len     = 0;      // ramp length in samples
+    volatile bool     _keySync = false;
+    volatile bool     _restart = false;
+
+    // Audio ISR only
+    uint32_t _pos     = UINT32_MAX;      // samples since retrigger() (idle until the first)
+    uint32_t _phase   = 0;               // key-synced phase
+    float    _lastOut = 0.0f;            // key-synced value at the last sub-block
+};
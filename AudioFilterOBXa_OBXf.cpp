@@ -113,9 +113,10 @@ struct AudioFilterOBXa::Core
         return (((((0.0103592f) * x + 0.00920833f) * x + 0.185f) * x + 0.05f) * x + 1.f);
     }
 
+    template <bool Push>
     inline float resolveFeedback2Pole(float sample, float g)
     {
-        float push = -1.f - (push2Pole ? 0.035f : 0.0f);
+        float push = -1.f - (Push ? 0.035f : 0.0f);
         float tCfb = diodePairResistanceApprox(state.pole1 * 0.0876f) + push;
 
         float y = (sample
@@ -128,10 +129,11 @@ struct AudioFilterOBXa::Core
         return y;
     }
 
+    template <bool BpBlend, bool Push>
     float process2Pole(float x, float cutoffHz)
     {
         float g = tanf(cutoffHz * fsInv * OBXA_PI);
-        float v = resolveFeedback2Pole(x, g);
+        float v = resolveFeedback2Pole<Push>(x, g);
 
         float y1 = v * g + state.pole1;
         state.pole1 = v * g + y1;
@@ -140,7 +142,7 @@ struct AudioFilterOBXa::Core
         state.pole2 = y1 * g + y2;
 
         float out;
-        if (bpBlend2Pole)
+        if (BpBlend)
         {
             if (multimode01 < 0.5f) out = 2.f * ((0.5f - multimode01) * y2 + (multimode01 * y1));
             else                    out = 2.f * ((1.f - multimode01) * y1 + (multimode01 - 0.5f) * v);
@@ -152,6 +154,15 @@ struct AudioFilterOBXa::Core
         return out;
     }
 
+    // Generic path: options read at run time
+    float process2Pole(float x, float cutoffHz)
+    {
+        if (bpBlend2Pole) return push2Pole ? process2Pole<true, true>(x, cutoffHz)
+                                           : process2Pole<true, false>(x, cutoffHz);
+        return push2Pole ? process2Pole<false, true>(x, cutoffHz)
+                         : process2Pole<false, false>(x, cutoffHz);
+    }
+
     inline float resolveFeedback4Pole(float sample, float g, float lpc)
     {
         float ml = 1.f / (1.f + g);
@@ -163,16 +174,13 @@ struct AudioFilterOBXa::Core
         return y;
     }
 
+    template <bool Xpander>
     float process4Pole(float x, float cutoffHz)
     {
-        float cutoffHzRequested = cutoffHz;
-
         // Prewarp
         float g = tanf(cutoffHz * fsInv * OBXA_PI);
         float lpc = g / (1.f + g);
 
-
-
         float y0 = resolveFeedback4Pole(x, g, lpc);
 
         // Inline first pole with nonlinearity
@@ -189,7 +197,7 @@ struct AudioFilterOBXa::Core
 
         float out = 0.f;
 
-        if (xpander4Pole)
+        if (Xpander)
         {
             const float *m = poleMixFactors[xpanderMode];
             out = y0 * m[0] + y1 * m[1] + y2 * m[2] + y3 * m[3] + y4 * m[4];
@@ -206,20 +214,16 @@ struct AudioFilterOBXa::Core
             }
         }
 
-        // Detect anomalies
-        bool nonfinite =
-            (!isfinite(y0) || !isfinite(y1) || !isfinite(y2) || !isfinite(y3) || !isfinite(y4) || !isfinite(out) ||
-             !isfinite(state.pole1) || !isfinite(state.pole2) || !isfinite(state.pole3) || !isfinite(state.pole4) ||
-             !isfinite(g) || !isfinite(lpc));
-
-        bool huge =
-            (obxa_is_huge(state.pole1) || obxa_is_huge(state.pole2) ||
-             obxa_is_huge(state.pole3) || obxa_is_huge(state.pole4) ||
-             obxa_is_huge(out) || obxa_is_huge(y0));
-
         // Resonance-dependent volume compensation
         return out * (1.f + state.res4Pole * 0.45f);
     }
+
+    // Generic path: options read at run time
+    float process4Pole(float x, float cutoffHz)
+    {
+        return xpander4Pole ? process4Pole<true>(x, cutoffHz)
+                            : process4Pole<false>(x, cutoffHz);
+    }
 };
 
 constexpr float AudioFilterOBXa::Core::poleMixFactors[OBXA_NUM_XPANDER_MODES][5];
@@ -228,14 +232,19 @@ constexpr float AudioFilterOBXa::Core::poleMixFactors[OBXA_NUM_XPANDER_MODES][5]
 // Wrapper implementation
 // -----------------------------------------------------------------------------
 AudioFilterOBXa::AudioFilterOBXa()
-    : AudioStream(3, _inQ)
+    : AudioStream(2 + OBXA_MIX_INPUTS, _inQ)
 {
     _core = new Core();
     _core->setSampleRate(AUDIO_SAMPLE_RATE_EXACT);
     _core->setResonance(_res01Target);
     _core->setMultimode(_multimode01);
+    _selectKernel();
+}
 
-
+void AudioFilterOBXa::mixGain(uint8_t src, float gain)
+{
+    if (src >= OBXA_MIX_INPUTS) return;
+    _mixGain[src] = gain * (1.0f / 32768.0f);
 }
 
 void AudioFilterOBXa::frequency(float hz)
@@ -266,12 +275,14 @@ void AudioFilterOBXa::multimode(float m01)
 void AudioFilterOBXa::setTwoPole(bool enabled)
 {
     _useTwoPole = enabled;
+    _selectKernel();
 }
 
 void AudioFilterOBXa::setXpander4Pole(bool enabled)
 {
     _xpander4Pole = enabled;
     _core->xpander4Pole = enabled;
+    _selectKernel();
 }
 
 void AudioFilterOBXa::setXpanderMode(uint8_t mode)
@@ -285,12 +296,14 @@ void AudioFilterOBXa::setBPBlend2Pole(bool enabled)
 {
     _bpBlend2Pole = enabled;
     _core->bpBlend2Pole = enabled;
+    _selectKernel();
 }
 
 void AudioFilterOBXa::setPush2Pole(bool enabled)
 {
     _push2Pole = enabled;
     _core->push2Pole = enabled;
+    _selectKernel();
 }
 
 void AudioFilterOBXa::setCutoffModOctaves(float oct)
@@ -305,6 +318,7 @@ void AudioFilterOBXa::setResonanceModDepth(float depth01)
     if (depth01 < 0.f) depth01 = 0.f;
     if (depth01 > 1.f) depth01 = 1.f;
     _resModDepth = depth01;
+    _selectKernel();
 }
 
 void AudioFilterOBXa::setKeyTrack(float amount01)
@@ -336,55 +350,50 @@ void AudioFilterOBXa::setEnvValue(float env01)
 }
 
 
-void AudioFilterOBXa::update(void)
+// -----------------------------------------------------------------------------
+// Block kernels
+// -----------------------------------------------------------------------------
+// One loop body, instantiated per topology so the per-sample mode branches,
+// flag mirroring and resonance-mod work fold away at compile time.
+// OBXA_FEAT_GENERIC reads every option at run time (any other combination).
+template <uint8_t F>
+void AudioFilterOBXa::_kernel(const float *xin, const audio_block_t *in1,
+                              const audio_block_t *in2, int16_t *out, float keyMul)
 {
-    audio_block_t *in0 = receiveReadOnly(0);
-    audio_block_t *in1 = receiveReadOnly(1); // cutoff mod bus
-    audio_block_t *in2 = receiveReadOnly(2); // resonance mod bus
-
-    audio_block_t *out = allocate();
-    if (!out)
-    {
-        // Release any inputs we received
-        if (in0) release(in0);
-        if (in1) release(in1);
-        if (in2) release(in2);
-        return;
-    }
+    constexpr bool generic = (F & OBXA_FEAT_GENERIC) != 0;
+    constexpr bool twoPole = (F & OBXA_FEAT_TWO_POLE) != 0;
+    constexpr bool resMod  = generic || (F & OBXA_FEAT_RES_MOD) != 0;
 
-    // If we recently had a reset, optionally mute a couple blocks to avoid thumps
-    if (_cooldownBlocks > 0) _cooldownBlocks--;
+    const bool useTwoPole = generic ? _useTwoPole : twoPole;
+    const float maxHz = 0.24f * AUDIO_SAMPLE_RATE_EXACT;
 
-    // Precompute keytrack factor (control-rate)
-    // note=60 => 1.0; note+12 => x2; note-12 => x0.5
-    float keyOct = (_midiNote - 60.0f) / 12.0f;
-    float keyMul = powf(2.0f, _keyTrack * keyOct);
+    // Without resonance modulation the core resonance is constant per block
+    if (!resMod || !in2) _core->setResonance(_res01Target);
 
     for (int i = 0; i < AUDIO_BLOCK_SAMPLES; ++i)
     {
         // *** KEY CHANGE: Use 0.0f if no input, allowing self-oscillation ***
-        float x = in0 ? ((float)in0->data[i] * (1.0f / 32768.0f)) : 0.0f;
+        float x = xin ? xin[i] : 0.0f;
 
-        // Audio-rate mods
-        float cutMod = in1 ? ((float)in1->data[i] * (1.0f / 32768.0f)) : 0.0f;  // -1..+1
-        float resMod = in2 ? ((float)in2->data[i] * (1.0f / 32768.0f)) : 0.0f;  // -1..+1
-
-        // Convert cutoff mods to a multiplier in octaves:
+        // Audio-rate cutoff mod (-1..+1), converted to a multiplier in octaves
+        float cutMod = in1 ? ((float)in1->data[i] * (1.0f / 32768.0f)) : 0.0f;
         float modOct = (cutMod * _cutoffModOct) + (_envValue * _envModOct);
         float modMul = powf(2.0f, modOct);
 
         float cutoffHz = _cutoffHzTarget * keyMul * modMul;
 
         // Keep stable
-        float maxHz = 0.24f * AUDIO_SAMPLE_RATE_EXACT;
         if (cutoffHz < 5.0f) cutoffHz = 5.0f;
         if (cutoffHz > maxHz) cutoffHz = maxHz;
 
         // Resonance (0..1) plus optional audio-rate modulation depth
-        float r01 = _res01Target + (resMod * _resModDepth);
-        if (r01 < 0.0f) r01 = 0.0f;
-        if (r01 > 1.0f) r01 = 1.0f;
-        _core->setResonance(r01);
+        if (resMod && in2)
+        {
+            float r01 = _res01Target + ((float)in2->data[i] * (1.0f / 32768.0f)) * _resModDepth;
+            if (r01 < 0.0f) r01 = 0.0f;
+            if (r01 > 1.0f) r01 = 1.0f;
+            _core->setResonance(r01);
+        }
 
         float y = 0.0f;
 
@@ -392,17 +401,19 @@ void AudioFilterOBXa::update(void)
         {
             y = 0.0f;
         }
-        else if (_useTwoPole)
+        else if (generic)
         {
-            _core->bpBlend2Pole = _bpBlend2Pole;
-            _core->push2Pole = _push2Pole;
-            y = _core->process2Pole(x, cutoffHz);
+            y = useTwoPole ? _core->process2Pole(x, cutoffHz)
+                           : _core->process4Pole(x, cutoffHz);
+        }
+        else if (twoPole)
+        {
+            y = _core->template process2Pole<(F & OBXA_FEAT_BP_BLEND) != 0,
+                                             (F & OBXA_FEAT_PUSH) != 0>(x, cutoffHz);
         }
         else
         {
-            _core->xpander4Pole = _xpander4Pole;
-            _core->xpanderMode = _xpanderMode;
-            y = _core->process4Pole(x, cutoffHz);
+            y = _core->template process4Pole<(F & OBXA_FEAT_XPANDER) != 0>(x, cutoffHz);
         }
 
 #if OBXA_STATE_GUARD
@@ -424,13 +435,107 @@ void AudioFilterOBXa::update(void)
         if (y > 1.0f) y = 1.0f;
         if (y < -1.0f) y = -1.0f;
 
-        out->data[i] = (int16_t)(y * 32767.0f);
+        out[i] = (int16_t)(y * 32767.0f);
     }
+}
+
+// Precompiled variants: the common patch topologies.  Anything else
+// (e.g. 2-pole BP blend + push, or either option with resonance mod)
+// runs the generic kernel.
+const AudioFilterOBXa::KernelEntry AudioFilterOBXa::kKernels[] = {
+    { 0,                                              &AudioFilterOBXa::_kernel<0>,                                              "4P" },
+    { OBXA_FEAT_XPANDER,                              &AudioFilterOBXa::_kernel<OBXA_FEAT_XPANDER>,                              "4P Xpander" },
+    { OBXA_FEAT_RES_MOD,                              &AudioFilterOBXa::_kernel<OBXA_FEAT_RES_MOD>,                              "4P ResMod" },
+    { OBXA_FEAT_XPANDER | OBXA_FEAT_RES_MOD,          &AudioFilterOBXa::_kernel<OBXA_FEAT_XPANDER | OBXA_FEAT_RES_MOD>,          "4P Xpander ResMod" },
+    { OBXA_FEAT_TWO_POLE,                             &AudioFilterOBXa::_kernel<OBXA_FEAT_TWO_POLE>,                             "2P" },
+    { OBXA_FEAT_TWO_POLE | OBXA_FEAT_BP_BLEND,        &AudioFilterOBXa::_kernel<OBXA_FEAT_TWO_POLE | OBXA_FEAT_BP_BLEND>,        "2P BP" },
+    { OBXA_FEAT_TWO_POLE | OBXA_FEAT_PUSH,            &AudioFilterOBXa::_kernel<OBXA_FEAT_TWO_POLE | OBXA_FEAT_PUSH>,            "2P Push" },
+    { OBXA_FEAT_TWO_POLE | OBXA_FEAT_RES_MOD,         &AudioFilterOBXa::_kernel<OBXA_FEAT_TWO_POLE | OBXA_FEAT_RES_MOD>,         "2P ResMod" },
+};
+
+void AudioFilterOBXa::_selectKernel()
+{
+    // Feature mask of the current settings; options that the active
+    // topology ignores are left out so they don't force the generic path.
+    uint8_t f = 0;
+    if (_useTwoPole)
+    {
+        f |= OBXA_FEAT_TWO_POLE;
+        if (_bpBlend2Pole) f |= OBXA_FEAT_BP_BLEND;
+        if (_push2Pole)    f |= OBXA_FEAT_PUSH;
+    }
+    else if (_xpander4Pole)
+    {
+        f |= OBXA_FEAT_XPANDER;
+    }
+    if (_resModDepth > 0.0f) f |= OBXA_FEAT_RES_MOD;
+
+    KernelFn    fn   = &AudioFilterOBXa::_kernel<OBXA_FEAT_GENERIC>;
+    const char* name = "Generic";
+    if (!_forceGeneric)
+    {
+        for (const KernelEntry& k : kKernels)
+        {
+            if (k.features == f) { fn = k.fn; name = k.name; break; }
+        }
+    }
+
+    // Single-word stores; update() reads _kernel once per block
+    _kernelFeatures = f;
+    _kernelName     = name;
+    _kernelFn       = fn;
+}
+
+bool AudioFilterOBXa::mixBlocks(const audio_block_t *const *in, const float *scaledGain,
+                                uint8_t n, float *mix)
+{
+    bool any = false;
+    for (uint8_t s = 0; s < n; ++s)
+    {
+        const float g = scaledGain[s];
+        if (!in[s] || g == 0.0f) continue;
+        const int16_t *d = in[s]->data;
+        if (any) for (int i = 0; i < AUDIO_BLOCK_SAMPLES; ++i) mix[i] += (float)d[i] * g;
+        else     for (int i = 0; i < AUDIO_BLOCK_SAMPLES; ++i) mix[i]  = (float)d[i] * g;
+        any = true;
+    }
+    return any;
+}
+
+void AudioFilterOBXa::update(void)
+{
+    // Input mixer: every source is converted once, straight into float
+    audio_block_t *src[OBXA_MIX_INPUTS];
+    for (uint8_t s = 0; s < OBXA_MIX_INPUTS; ++s) src[s] = receiveReadOnly(mixInputPort(s));
+    float mix[AUDIO_BLOCK_SAMPLES];
+    const bool any = mixBlocks(src, _mixGain, OBXA_MIX_INPUTS, mix);
+    for (uint8_t s = 0; s < OBXA_MIX_INPUTS; ++s) if (src[s]) release(src[s]);
+
+    audio_block_t *in1 = receiveReadOnly(1); // cutoff mod bus
+    audio_block_t *in2 = receiveReadOnly(2); // resonance mod bus
+
+    audio_block_t *out = allocate();
+    if (!out)
+    {
+        // Release any inputs we received
+        if (in1) release(in1);
+        if (in2) release(in2);
+        return;
+    }
+
+    // If we recently had a reset, optionally mute a couple blocks to avoid thumps
+    if (_cooldownBlocks > 0) _cooldownBlocks--;
+
+    // Precompute keytrack factor (control-rate)
+    // note=60 => 1.0; note+12 => x2; note-12 => x0.5
+    float keyOct = (_midiNote - 60.0f) / 12.0f;
+    float keyMul = powf(2.0f, _keyTrack * keyOct);
+
+    (this->*_kernelFn)(any ? mix : nullptr, in1, in2, out->data, keyMul);
 
     transmit(out);
 
     release(out);
-    if (in0) release(in0);
     if (in1) release(in1);
     if (in2) release(in2);
-}
\ No newline at end of file
+}
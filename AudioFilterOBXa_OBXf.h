@@ -9,14 +9,20 @@
 //  - Optional Xpander 4-pole pole-mix modes (setXpander4Pole / setXpanderMode).
 //  - Optional 2-pole behaviours (BP blend / push) for parity with original core.
 //  - Modulation inputs (Audio.h-style): audio in + cutoffMod + resonanceMod.
+//  - Float input mixer: up to OBXA_MIX_INPUTS audio sources, each with its
+//    own gain, summed in float straight into the filter core (the voice's
+//    source mix needs no int16 mixer stages in front of the filter).
 //  - Control-rate modulation: key tracking + envelope amount (optional).
+//  - Topology-specialised block kernels: the mode setters pick a precompiled
+//    loop for the current feature mask (generic fallback for the rest).
 //  - Debug capture with **pre-event** ring + **rising-edge** fault latch
 //    to avoid log spam; safe recovery/reset when unstable.
 //
-// Wiring (3 inputs):
-//   input 0: audio
+// Wiring (2 + OBXA_MIX_INPUTS inputs):
+//   input 0: audio (mix source 0)
 //   input 1: cutoff modulation bus  (-1..+1), scaled by setCutoffModOctaves()
 //   input 2: resonance modulation bus (-1..+1), scaled by setResonanceModDepth()
+//   input 3..: audio mix sources 1..OBXA_MIX_INPUTS-1 (see mixInputPort())
 //
 // Debug usage:
 //   - Ensure OBXA_DEBUG == 1
@@ -39,6 +45,19 @@
 #define OBXA_HUGE_THRESHOLD 1.0e6f
 #endif
 
+// Audio sources summed at the filter input (input 0 plus inputs 3..)
+#ifndef OBXA_MIX_INPUTS
+#define OBXA_MIX_INPUTS 6
+#endif
+
+// Kernel feature mask (see kernelFeatures())
+#define OBXA_FEAT_TWO_POLE  0x01
+#define OBXA_FEAT_XPANDER   0x02   // 4-pole only
+#define OBXA_FEAT_BP_BLEND  0x04   // 2-pole only
+#define OBXA_FEAT_PUSH      0x08   // 2-pole only
+#define OBXA_FEAT_RES_MOD   0x10   // resonance mod depth > 0
+#define OBXA_FEAT_GENERIC   0x80   // all options read at run time
+
 // -----------------------------------------------------------------------------
 // AudioFilterOBXa
 // -----------------------------------------------------------------------------
@@ -69,6 +88,18 @@ public:
     void setPush2Pole(bool enabled);
     bool getPush2Pole() const { return _push2Pole; }
 
+    // --- Input mixer ---
+    // Gain of mix source 'src' (0..OBXA_MIX_INPUTS-1); source 0 defaults to
+    // 1.0, the rest to 0.  Zero-gain sources are skipped.
+    void mixGain(uint8_t src, float gain);
+    static constexpr uint8_t mixInputPort(uint8_t src) { return src == 0 ? 0 : (uint8_t)(src + 2); }
+
+    // The mixer loop on its own: 'n' blocks (nullptr skipped), each times its
+    // pre-scaled gain (gain / 32768; zero skipped), summed into 'mix'.
+    // false when nothing was summed.  update() runs it on the mix inputs.
+    static bool mixBlocks(const audio_block_t *const *in, const float *scaledGain,
+                          uint8_t n, float *mix);
+
     // --- Modulation scaling (Audio input busses) ---
     // Cutoff modulation amount in octaves per +1.0 on input1
     void setCutoffModOctaves(float oct);
@@ -104,14 +135,21 @@ public:
     void setEnvModOct(float oct)             { setEnvModOctaves(oct); }
     float getEnvModOct() const               { return getEnvModOctaves(); }
 
+    // --- Kernel selection (diagnostics) ---
+    uint8_t     kernelFeatures() const { return _kernelFeatures; }
+    const char* kernelName() const     { return _kernelName; }
 
-
-
+    // Run the generic kernel whatever the mask (A/B against the specialised
+    // ones: same output, more cycles)
+    void forceGenericKernel(bool on) { _forceGeneric = on; _selectKernel(); }
 
     virtual void update(void) override;
 
 private:
-    audio_block_t *_inQ[3]{};
+    audio_block_t *_inQ[2 + OBXA_MIX_INPUTS]{};
+
+    // Mix gains, pre-scaled to full scale (gain / 32768)
+    float _mixGain[OBXA_MIX_INPUTS] = { 1.0f / 32768.0f };
 
     // Internal control state
     float _cutoffHzTarget = 1000.0f;
@@ -139,5 +177,24 @@ private:
     struct Core;
     Core *_core = nullptr;
 
-
+    // Block kernel for the current topology, chosen by _selectKernel()
+    // whenever a mode setter changes the feature mask.
+    typedef void (AudioFilterOBXa::*KernelFn)(const float *x, const audio_block_t *in1,
+                                              const audio_block_t *in2, int16_t *out, float keyMul);
+    struct KernelEntry {
+        uint8_t     features;
+        KernelFn    fn;
+        const char* name;
+    };
+    static const KernelEntry kKernels[];
+
+    template <uint8_t F>
+    void _kernel(const float *x, const audio_block_t *in1,
+                 const audio_block_t *in2, int16_t *out, float keyMul);
+    void _selectKernel();
+
+    KernelFn    _kernelFn       = nullptr;
+    uint8_t     _kernelFeatures = 0;
+    const char* _kernelName     = "";
+    bool        _forceGeneric   = false;
 };
@@ -0,0 +1,30 @@
+#pragma once
+#include <Audio.h>
+
+// ============================================================================
+// AudioLock: nesting AudioNoInterrupts() / AudioInterrupts() (loop context)
+// ----------------------------------------------------------------------------
+// The library's pair does not nest: the first AudioInterrupts() unmasks the
+// audio ISR whatever its caller still has to write.  Blocks guard their own
+// few writes with hold() / release(); only the outermost release() unmasks,
+// so the same helpers run unchanged inside a larger section — the preset
+// swap applies held CCs and publishes a whole patch under one hold().
+//
+// Never call from the audio ISR: the depth is loop-context state.
+// ============================================================================
+
+namespace AudioLock {
+
+inline uint8_t depth = 0;
+
+inline void hold() {
+    if (depth++ == 0) AudioNoInterrupts();
+}
+
+inline void release() {
+    if (depth && --depth == 0) AudioInterrupts();
+}
+
+inline bool held() { return depth != 0; }
+
+} // namespace AudioLock
@@ -0,0 +1,80 @@
+#pragma once
+#include <Audio.h>
+#include "Q15Kernels.h"
+
+// ============================================================================
+// AudioMixer4Q15: drop-in AudioMixer4 on the Q15 kernels
+// ----------------------------------------------------------------------------
+// Same gain() and output as the stock mixer (bit-identical), with less work:
+// - Zero-gain and missing inputs are released unread.
+// - One live input at unity is passed through (no copy, no new block).
+// - The first live input is written straight into a fresh block rather than
+//   copied by receiveWritable() and then scaled in place.
+// - No input blocks → nothing is transmitted; blocks that all sit on zero
+//   gains → a silent block (both as stock).
+// ============================================================================
+
+class AudioMixer4Q15 : public AudioStream {
+public:
+    AudioMixer4Q15() : AudioStream(4, _inputQueue) {
+        for (uint8_t i = 0; i < 4; ++i) _mult[i] = Q15::kUnity;
+    }
+
+    void gain(unsigned int channel, float g) {
+        if (channel >= 4) return;
+        _mult[channel] = Q15::gainQ16(g);
+    }
+
+protected:
+    void update() override {
+        audio_block_t* in[4];
+        uint8_t live = 0, first = 0;
+        bool    any  = false;
+
+        for (uint8_t ch = 0; ch < 4; ++ch) {
+            in[ch] = receiveReadOnly(ch);
+            if (in[ch] && _mult[ch] == 0) {
+                release(in[ch]);
+                in[ch] = nullptr;
+                any = true;
+            }
+            if (in[ch] && live++ == 0) first = ch;
+        }
+
+        if (live == 0) {
+            if (!any) return;
+            audio_block_t* out = allocate();
+            if (!out) return;
+            memset(out->data, 0, sizeof(out->data));
+            transmit(out);
+            release(out);
+            return;
+        }
+
+        if (live == 1 && _mult[first] == Q15::kUnity) {
+            transmit(in[first]);
+            release(in[first]);
+            return;
+        }
+
+        audio_block_t* out = allocate();
+        if (out) {
+            if (_mult[first] == Q15::kUnity) memcpy(out->data, in[first]->data, sizeof(out->data));
+            else                             Q15::scale(out->data, in[first]->data, _mult[first]);
+            for (uint8_t ch = first + 1; ch < 4; ++ch) {
+                if (!in[ch]) continue;
+                if (_mult[ch] == Q15::kUnity) Q15::add(out->data, in[ch]->data);
+                else                          Q15::scaleAdd(out->data, in[ch]->data, _mult[ch]);
+            }
+            transmit(out);
+            release(out);
+        }
+        for (uint8_t ch = first; ch < 4; ++ch) {
+            if (in[ch]) release(in[ch]);
+        }
+    }
+
+private:
+    audio_block_t* _inputQueue[4];
+    int32_t        _mult[4];   // Q16 (65536 = unity)
+};
@@ -0,0 +1,150 @@
+#pragma once
+#include <Audio.h>
+
+// ============================================================================
+// AudioMixerN: N-input 32-bit summing bus with master gain, amp mod and a
+// soft limiter in one pass
+// ----------------------------------------------------------------------------
+// - Inputs 0..N-1: voices.  Input N (MOD_INPUT): amp-mod bus, Q15 (optional).
+// - Voices accumulate into int32 (exact; unity-gain inputs are plain adds),
+//   so there is one requantisation per block instead of one per mixer stage.
+// - Missing input blocks (idle voices, whose envelope transmits nothing) are
+//   skipped.  No voice blocks at all → nothing is transmitted.
+// - No amp-mod block (chain parked by dormant-node elision) → unity.
+// - Soft limiter: linear up to the knee, then x/(1+x)-shaped towards full
+//   scale (slope 1 at the knee, no hard clip).
+// - Bus fade (preset changes): linear per-sample ramp of the whole sum
+//   towards a target level; a handful of float ops per block, advanced even
+//   while nothing sounds so fadeDone() never waits on a voice.
+// ============================================================================
+
+template <uint8_t N>
+class AudioMixerN : public AudioStream {
+public:
+    static constexpr uint8_t MOD_INPUT = N;
+
+    AudioMixerN() : AudioStream(N + 1, _inputQueue) {
+        for (uint8_t i = 0; i < N; ++i) _gainQ16[i] = kUnityQ16;
+    }
+
+    // Per-input gain (0..4); unity inputs take the add-only path
+    void gain(uint8_t ch, float g) {
+        if (ch >= N) return;
+        if (g < 0.0f) g = 0.0f;
+        if (g > 4.0f) g = 4.0f;
+        _gainQ16[ch] = (int32_t)(g * 65536.0f + 0.5f);
+    }
+
+    // Applied once to the 32-bit sum
+    void masterGain(float g) { _master = (g < 0.0f) ? 0.0f : g; }
+
+    // Knee in full-scale units (0.5..1); 1.0 disables the limiter
+    void softLimit(float knee) {
+        if (knee < 0.5f) knee = 0.5f;
+        if (knee > 1.0f) knee = 1.0f;
+        _knee = knee;
+    }
+
+    // Ramp the bus to `level` (0..1) over `ms`; a full 0 → 1 ramp takes `ms`
+    // whatever the starting level.  0 ms: within the next block.  Single
+    // 32-bit stores (step before target); safe against the audio ISR.
+    void fade(float level, float ms) {
+        if (level < 0.0f) level = 0.0f;
+        if (level > 1.0f) level = 1.0f;
+        const float n = ms * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f);
+        _fadeStep   = (n >= 1.0f) ? 1.0f / n : 1.0f;
+        _fadeTarget = level;
+    }
+
+    // True once the bus has reached the last fade() level
+    bool  fadeDone() const  { return _fade == _fadeTarget; }
+    float fadeLevel() const { return _fade; }
+
+protected:
+    void update() override {
+        int32_t acc[AUDIO_BLOCK_SAMPLES];
+        bool any = false;
+
+        // Bus fade: this block ramps g0 → g1
+        const float g0 = _fade;
+        float g1 = g0;
+        if (g0 != _fadeTarget) {
+            const float tgt  = _fadeTarget;
+            const float span = _fadeStep * AUDIO_BLOCK_SAMPLES;
+            g1 = (g0 < tgt) ? fminf(g0 + span, tgt) : fmaxf(g0 - span, tgt);
+            _fade = g1;
+        }
+
+        for (uint8_t ch = 0; ch < N; ++ch) {
+            audio_block_t* in = receiveReadOnly(ch);
+            if (!in) continue;
+            const int32_t g = _gainQ16[ch];
+            if (g != 0) {
+                const int16_t* s = in->data;
+                if (g == kUnityQ16) {
+                    if (any) for (uint16_t i = 0; i < AUDIO_BLOCK_SAMPLES; ++i) acc[i] += s[i];
+                    else     for (uint16_t i = 0; i < AUDIO_BLOCK_SAMPLES; ++i) acc[i]  = s[i];
+                } else {
+                    // Q16 gain; 64-bit product (single SMULL on the M7)
+                    if (any) for (uint16_t i = 0; i < AUDIO_BLOCK_SAMPLES; ++i) acc[i] += (int32_t)(((int64_t)s[i] * g) >> 16);
+                    else     for (uint16_t i = 0; i < AUDIO_BLOCK_SAMPLES; ++i) acc[i]  = (int32_t)(((int64_t)s[i] * g) >> 16);
+                }
+                any = true;
+            }
+            release(in);
+        }
+
+        audio_block_t* mod = receiveReadOnly(MOD_INPUT);
+        if (!any) {
+            if (mod) release(mod);
+            return;
+        }
+
+        audio_block_t* out = allocate();
+        if (!out) {
+            if (mod) release(mod);
+            return;
+        }
+
+        const float scale = _master * (1.0f / 32768.0f);   // int32 sum → full scale
+        float       gain  = scale * g0;
+        const float gainStep = scale * (g1 - g0) * (1.0f / AUDIO_BLOCK_SAMPLES);
+        const float knee  = _knee;
+        const float span  = 1.0f - knee;
+        const float spanInv = (span > 0.0f) ? 1.0f / span : 0.0f;
+        int16_t* d = out->data;
+
+        for (uint16_t i = 0; i < AUDIO_BLOCK_SAMPLES; ++i) {
+            gain += gainStep;                       // Block ends exactly on g1
+            float x = (float)acc[i] * gain;
+            if (mod) x *= (float)mod->data[i] * (1.0f / 32768.0f);
+
+            const float a = fabsf(x);
+            if (a > knee) {
+                float y = 1.0f;
+                if (span > 0.0f) {
+                    const float t = (a - knee) * spanInv;
+                    y = knee + span * t / (1.0f + t);
+                }
+                x = (x < 0.0f) ? -y : y;
+            }
+            d[i] = (int16_t)(x * 32767.0f);
+        }
+
+        transmit(out);
+        release(out);
+        if (mod) release(mod);
+    }
+
+private:
+    static constexpr int32_t kUnityQ16 = 65536;
+
+    audio_block_t* _inputQueue[N + 1];
+    int32_t        _gainQ16[N];
+    float          _master = 1.0f;
+    float          _knee   = 0.9f;
+
+    volatile float _fade       = 1.0f;   // Current bus level (ISR-owned)
+    volatile float _fadeTarget = 1.0f;
+    volatile float _fadeStep   = 1.0f;   // Level change per sample
+};
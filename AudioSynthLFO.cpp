@@ -0,0 +1,139 @@
+#include "AudioSynthLFO.h"
+
+AudioSynthLFO::AudioSynthLFO() : AudioStream(0, nullptr) {}
+
+void AudioSynthLFO::begin(uint8_t waveform) {
+    _shape = waveform;
+}
+
+void AudioSynthLFO::frequency(float hz) {
+    if (hz < 0.0f) hz = 0.0f;
+    const float maxHz = AUDIO_SAMPLE_RATE_EXACT * 0.5f;
+    if (hz > maxHz) hz = maxHz;
+    _inc = (uint32_t)(hz * (4294967296.0f / AUDIO_SAMPLE_RATE_EXACT));
+}
+
+void AudioSynthLFO::amplitude(float amp) {
+    if (amp < 0.0f) amp = 0.0f;
+    if (amp > 1.0f) amp = 1.0f;
+    _amp = amp;
+}
+
+void AudioSynthLFO::pulseWidth(float width) {
+    if (width < 0.0f) width = 0.0f;
+    if (width > 1.0f) width = 1.0f;
+    _pw = (uint32_t)(width * 4294967295.0f);
+}
+
+void AudioSynthLFO::syncPhase(float phase01) {
+    phase01 -= floorf(phase01);
+    _syncTarget  = (uint32_t)(phase01 * 4294967296.0f);
+    _syncPending = true;  // written last: update() reads target only after this
+}
+
+void AudioSynthLFO::lockToClock(const BPMClockManager* clock, uint32_t ticksPerCycle) {
+    if (!clock || ticksPerCycle == 0) {
+        _clock = nullptr;
+        return;
+    }
+    _ticksPerCycle = ticksPerCycle;
+    _clock = clock;  // written last: update() only reads the length once set
+}
+
+float AudioSynthLFO::_shapeAt(uint32_t phase) const {
+    const float p = (float)phase * (1.0f / 4294967296.0f);  // 0..1
+    switch (_shape) {
+        case WAVEFORM_SAWTOOTH:
+        case WAVEFORM_BANDLIMIT_SAWTOOTH:
+            return 2.0f * p - 1.0f;
+        case WAVEFORM_SAWTOOTH_REVERSE:
+        case WAVEFORM_BANDLIMIT_SAWTOOTH_REVERSE:
+            return 1.0f - 2.0f * p;
+        case WAVEFORM_SQUARE:
+        case WAVEFORM_BANDLIMIT_SQUARE:
+            return (phase < 0x80000000u) ? 1.0f : -1.0f;
+        case WAVEFORM_PULSE:
+        case WAVEFORM_BANDLIMIT_PULSE:
+            return (phase < _pw) ? 1.0f : -1.0f;
+        case WAVEFORM_TRIANGLE:
+            return (p < 0.5f) ? (4.0f * p - 1.0f) : (3.0f - 4.0f * p);
+        case WAVEFORM_TRIANGLE_VARIABLE: {
+            const float apex = (float)_pw * (1.0f / 4294967296.0f);
+            if (apex <= 0.0f)  return 1.0f - 2.0f * p;
+            if (apex >= 1.0f)  return 2.0f * p - 1.0f;
+            return (p < apex) ? (2.0f * p / apex - 1.0f)
+                              : (1.0f - 2.0f * (p - apex) / (1.0f - apex));
+        }
+        case WAVEFORM_SAMPLE_HOLD:
+            return _shValue;
+        case WAVEFORM_SINE:
+        default:
+            return sinf(p * TWO_PI);
+    }
+}
+
+void AudioSynthLFO::update(void) {
+    // Apply a pending phase sync at the block boundary
+    if (_syncPending) {
+        _phase       = _syncTarget;
+        _syncPending = false;
+    }
+
+    uint32_t inc = _inc;
+
+    // Clock-locked: phase and rate from the song position at block start
+    const BPMClockManager* clock = _clock;
+    if (clock) {
+        const ClockSnapshot snap = clock->getSnapshot();
+        if (snap.ticksPerUs > 0.0f) {
+            const uint32_t tpc = _ticksPerCycle;
+            _phase = snap.phaseAt(micros(), tpc);
+            inc    = (uint32_t)(snap.ticksPerUs / (float)tpc
+                                * (1.0e6f / AUDIO_SAMPLE_RATE_EXACT) * 4294967296.0f);
+        }
+    }
+    _blockInc = inc;
+    const uint32_t subInc = inc * LFO_SUBBLOCK_SAMPLES;
+    const float    amp    = _amp;
+
+    // Muted: keep phase running, send nothing
+    if (amp <= 0.0f) {
+        _phase  += inc * AUDIO_BLOCK_SAMPLES;
+        _lastOut = 0.0f;
+        return;
+    }
+
+    audio_block_t* block = allocate();
+    if (!block) {
+        _phase += inc * AUDIO_BLOCK_SAMPLES;
+        return;
+    }
+
+    const float scale = amp * 32767.0f;
+    int16_t* out = block->data;
+
+    for (uint16_t s = 0; s < AUDIO_BLOCK_SAMPLES; s += LFO_SUBBLOCK_SAMPLES) {
+        const uint32_t prev = _phase;
+        _phase += subInc;
+
+        // Sample & hold draws a new value on every cycle wrap
+        if (_shape == WAVEFORM_SAMPLE_HOLD && _phase < prev) {
+            _rng ^= _rng << 13;
+            _rng ^= _rng >> 17;
+            _rng ^= _rng << 5;
+            _shValue = (float)(int32_t)_rng * (1.0f / 2147483648.0f);
+        }
+
+        const float target = _shapeAt(_phase) * scale;
+        const float step   = (target - _lastOut) * (1.0f / LFO_SUBBLOCK_SAMPLES);
+        float v = _lastOut;
+        for (uint16_t i = 0; i < LFO_SUBBLOCK_SAMPLES; ++i) {
+            v += step;
+            out[s + i] = (int16_t)v;
+        }
+        _lastOut = target;
+    }
+
+    transmit(block);
+    release(block);
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Audio.h>
+#include "BPMClockManager.h"
+
+// Samples per control-rate step.  One waveform value is evaluated per
+// sub-block and linearly interpolated across it (8 evaluations / block).
+#define LFO_SUBBLOCK_SAMPLES 16
+
+/**
+ * @brief Control-rate LFO source (0 inputs, 1 output)
+ *
+ * Drop-in replacement for AudioSynthWaveform in the LFO role.  Instead of
+ * evaluating the waveform for every sample it computes one value per
+ * LFO_SUBBLOCK_SAMPLES and ramps between them, which is plenty for
+ * modulation up to a few hundred Hz and costs almost nothing.
+ *
+ * Shapes use the Teensy waveform IDs (WAVEFORM_SINE … WAVEFORM_SAMPLE_HOLD).
+ * Band-limited IDs fall back to their naive counterparts since aliasing is
+ * irrelevant at LFO rates; anything unknown runs as a sine.
+ *
+ * Phase is a 32-bit accumulator.  syncPhase() lets the control thread land
+ * the phase on an exact value at the next block boundary.  lockToClock()
+ * goes further: every block the phase and rate are taken straight from the
+ * clock's song position at the block's start time, so tempo-synced
+ * modulation tracks the (DLL-filtered) clock with no drift.  The position
+ * is whole ticks plus a fraction, wrapped to the cycle in integers, so the
+ * phase stays exact however long the song has been running.  The
+ * interpolation ramp hides the small per-block corrections.
+ *
+ * While amplitude is 0 no block is transmitted (downstream mixers see
+ * silence) but the phase keeps running so the LFO stays free-running.
+ */
+class AudioSynthLFO : public AudioStream {
+public:
+    AudioSynthLFO();
+
+    void begin(uint8_t waveform);
+    void frequency(float hz);
+    void amplitude(float amp);
+    void pulseWidth(float width);
+
+    /**
+     * @brief Set phase at the next block boundary
+     * @param phase01 Target phase, 0..1 (wrapped)
+     */
+    void syncPhase(float phase01);
+
+    /**
+     * @brief Derive phase from the clock position each block
+     * @param clock         Clock to follow, or nullptr to free-run
+     * @param ticksPerCycle LFO cycle length in MIDI clock ticks (24 PPQN)
+     *
+     * While the clock is stopped (zero slope) the LFO free-runs at the
+     * last frequency() so modulation doesn't freeze.
+     */
+    void lockToClock(const BPMClockManager* clock, uint32_t ticksPerCycle);
+
+    /**
+     * @brief Current phase as 0..1 (approximate, for UI / diagnostics)
+     */
+    float getPhase() const { return (float)_phase * (1.0f / 4294967296.0f); }
+
+    /**
+     * @brief Evaluate the current shape at an arbitrary phase, -1..1
+     *
+     * Lets a per-voice key-synced stage (AudioEffectVoiceLFO) run its own
+     * phase through this generator's shape.  Amplitude is not applied.
+     */
+    float valueAt(uint32_t phase) const { return _shapeAt(phase); }
+
+    /**
+     * @brief Phase increment per sample used by the last update()
+     * Includes the clock-locked rate, so key-synced copies follow tempo.
+     */
+    uint32_t getIncrement() const { return _blockInc; }
+
+    float getAmplitude() const { return _amp; }
+
+    virtual void update(void) override;
+
+private:
+    // Evaluate the current shape at 'phase', result in -1..1
+    float _shapeAt(uint32_t phase) const;
+
+    volatile uint8_t  _shape   = WAVEFORM_SINE;
+    volatile uint32_t _inc     = 0;        // Phase increment per sample
+    volatile uint32_t _blockInc = 0;       // Increment actually used (clock-locked or _inc)
+    volatile float    _amp     = 0.0f;
+    volatile uint32_t _pw      = 0x80000000u;  // Pulse width / triangle apex
+
+    uint32_t _phase    = 0;
+    float    _lastOut  = 0.0f;   // Value at the end of the previous sub-block
+    float    _shValue  = 0.0f;   // Held sample & hold value
+    uint32_t _rng      = 22222u; // xorshift state for S&H
+
+    volatile uint32_t _syncTarget  = 0;
+    volatile bool     _syncPending = false;
+
+    const BPMClockManager* volatile _clock = nullptr;
+    volatile uint32_t _ticksPerCycle = 0;
+};
@@ -48,6 +48,63 @@ static inline float saw_polyblep(float phase, float phaseInc)
     return s;
 }
 
+// -----------------------------------------------------------------------------
+// BLEP residual table
+//
+// One band-limited step (integral of a Blackman-windowed sinc spanning
+// SUPERSAW_BLEP_TAPS samples) minus the ideal step, sampled at
+// SUPERSAW_BLEP_PHASES + 1 fractional offsets of the discontinuity.  Row j
+// is the correction for a wrap that happened j/PHASES of a sample before
+// the first post-wrap sample; tap k lands on that sample + k - TAPS/2.
+// Built once (the first supersaw constructed) and shared by every instance.
+#define BLEP_HALF    (SUPERSAW_BLEP_TAPS / 2)
+#define BLEP_CUTOFF  0.80f   // Windowed-sinc cutoff, fraction of Nyquist
+
+static float s_blepRes[SUPERSAW_BLEP_PHASES + 1][SUPERSAW_BLEP_TAPS];
+static bool  s_blepReady = false;
+
+static void buildBlepTable()
+{
+    // Running integral of the windowed sinc on a 1/PHASES grid over
+    // [-HALF, HALF]; every (row, tap) time offset falls on a grid point.
+    const int   points = SUPERSAW_BLEP_TAPS * SUPERSAW_BLEP_PHASES + 1;
+    const int   sub    = 4;   // Integration sub-steps per grid interval
+    const float h      = 1.0f / (SUPERSAW_BLEP_PHASES * sub);
+    static float integral[SUPERSAW_BLEP_TAPS * SUPERSAW_BLEP_PHASES + 1];
+
+    auto kernel = [](float t) {
+        const float x = 3.14159265f * BLEP_CUTOFF * t;
+        const float sinc = (fabsf(x) < 1e-6f) ? 1.0f : sinf(x) / x;
+        const float w = 2.0f * 3.14159265f * (t + BLEP_HALF) / SUPERSAW_BLEP_TAPS;
+        const float blackman = 0.42f - 0.5f * cosf(w) + 0.08f * cosf(2.0f * w);
+        return sinc * blackman;
+    };
+
+    double sum = 0.0;
+    integral[0] = 0.0f;
+    for (int g = 1; g < points; ++g) {
+        const float t0 = -BLEP_HALF + (float)(g - 1) / SUPERSAW_BLEP_PHASES;
+        for (int s = 0; s < sub; ++s) {
+            const float a = t0 + s * h;
+            sum += 0.5 * h * (kernel(a) + kernel(a + h));   // Trapezoid
+        }
+        integral[g] = (float)sum;
+    }
+
+    // Normalise to a unit step and subtract the ideal step.  Taps from HALF
+    // on are post-wrap samples; the ideal step is keyed on the tap rather
+    // than on t so row PHASES (t = 0 at tap HALF-1) holds the left limit and
+    // interpolation never straddles the jump.
+    const float norm = 1.0f / integral[points - 1];
+    for (int j = 0; j <= SUPERSAW_BLEP_PHASES; ++j) {
+        for (int k = 0; k < SUPERSAW_BLEP_TAPS; ++k) {
+            const int g = k * SUPERSAW_BLEP_PHASES + j;   // t = k - HALF + j/PHASES
+            s_blepRes[j][k] = integral[g] * norm - ((k >= BLEP_HALF) ? 1.0f : 0.0f);
+        }
+    }
+    s_blepReady = true;
+}
+
 // ============================================================================
 // LOOKUP TABLE: Pre-calculated Detune Curve
 // ============================================================================
@@ -238,6 +295,12 @@ AudioSynthSupersaw::AudioSynthSupersaw()
         phases[i] = kPhaseOffsets[i];
     }
 
+    if (!s_blepReady) buildBlepTable();
+    useBlepTable = true;
+    for (int n = 0; n < AUDIO_BLOCK_SAMPLES + SUPERSAW_BLEP_TAPS; ++n) {
+        blepAcc[n] = 0.0f;
+    }
+
     calculateIncrements();
     calculateGains();
     calculateHPF();
@@ -312,6 +375,16 @@ void AudioSynthSupersaw::setBandLimited(bool enable) {
     usePolyBLEP = enable;
 }
 
+void AudioSynthSupersaw::setBlepTable(bool enable) {
+    if (enable && !useBlepTable) {
+        // Drop any residual tail left from a previous run of this path
+        for (int n = 0; n < AUDIO_BLOCK_SAMPLES + SUPERSAW_BLEP_TAPS; ++n) {
+            blepAcc[n] = 0.0f;
+        }
+    }
+    useBlepTable = enable;
+}
+
 // “noteOn” should reset phases in a repeatable hardware-like way.
 // (If you want “free-running” behaviour, make this a no-op.)
 void AudioSynthSupersaw::noteOn() {
@@ -322,6 +395,15 @@ void AudioSynthSupersaw::noteOn() {
 
 
 
+void AudioSynthSupersaw::reset() {
+    noteOn();
+    hpfPrevIn  = 0.0f;
+    hpfPrevOut = 0.0f;
+    for (int n = 0; n < AUDIO_BLOCK_SAMPLES + SUPERSAW_BLEP_TAPS; ++n) {
+        blepAcc[n] = 0.0f;
+    }
+}
+
 void AudioSynthSupersaw::calculateIncrements() {
     const float sr = AUDIO_SAMPLE_RATE_EXACT;
     const float nyquist = 0.5f * sr;
@@ -339,6 +421,7 @@ void AudioSynthSupersaw::calculateIncrements() {
         if (oscFreq > nyquist) oscFreq = nyquist;
 
         phaseInc[i] = oscFreq / sr;
+        phaseIncInv[i] = (oscFreq > 0.0f) ? sr / oscFreq : 0.0f;
     }
 }
 
@@ -367,6 +450,58 @@ void AudioSynthSupersaw::calculateHPF() {
     hpfAlpha = rc / (rc + dt);
 }
 
+// -----------------------------------------------------------------------------
+// BLEP table rendering
+//
+// acc[0 .. BLOCK) receives the output; acc[0 .. TAPS) arrives holding the
+// residual tail carried from the previous block, and acc[BLOCK .. BLOCK+TAPS)
+// leaves holding the tail for the next one.  Naive samples are written
+// BLEP_HALF samples late so each residual can start before its wrap.
+void AudioSynthSupersaw::renderBlep(float* acc)
+{
+    for (int n = SUPERSAW_BLEP_TAPS; n < AUDIO_BLOCK_SAMPLES + SUPERSAW_BLEP_TAPS; ++n) {
+        acc[n] = 0.0f;
+    }
+
+    for (int i = 0; i < SUPERSAW_VOICES; ++i) {
+        const float dt = phaseInc[i];
+        float p = phases[i];
+        const float g = gains[i];
+
+        if (g == 0.0f) {
+            // Silent voice (mix at 0 or 1): keep its phase running only
+            p += dt * AUDIO_BLOCK_SAMPLES;
+            phases[i] = p - floorf(p);
+            continue;
+        }
+
+        const float g2   = 2.0f * g;
+        const float step = -g2;   // Saw falls by 2 at each wrap
+        const float inv  = phaseIncInv[i] * (float)SUPERSAW_BLEP_PHASES;
+        float* dst = acc + BLEP_HALF;
+
+        for (int n = 0; n < AUDIO_BLOCK_SAMPLES; ++n) {
+            dst[n] += p * g2 - g;   // Naive saw, (2p - 1)·g
+            p += dt;
+            if (p >= 1.0f) {
+                p -= 1.0f;
+                // Fraction of a sample since the wrap, in table rows
+                const float pos = p * inv;
+                int j = (int)pos;
+                if (j > SUPERSAW_BLEP_PHASES - 1) j = SUPERSAW_BLEP_PHASES - 1;   // Rounding at p ≈ dt
+                const float f = pos - (float)j;
+                const float* r0 = s_blepRes[j];
+                const float* r1 = s_blepRes[j + 1];
+                float* out = acc + n + 1;
+                for (int k = 0; k < SUPERSAW_BLEP_TAPS; ++k) {
+                    out[k] += step * (r0[k] + f * (r1[k] - r0[k]));
+                }
+            }
+        }
+        phases[i] = p;
+    }
+}
+
 void AudioSynthSupersaw::update(void) {
     audio_block_t *block = allocate();
     if (!block) return;
@@ -377,7 +512,33 @@ void AudioSynthSupersaw::update(void) {
         mixGain = 1.0f + mixAmt * (compensationMaxGain - 1.0f);
     }
 
-    if (!oversample2x) {
+    if (!oversample2x && useBlepTable) {
+        // -----------------------------------------------------------------
+        // BLEP table rendering (default)
+        //
+        // Saws are summed naively into the residual accumulator with a
+        // table step correction at each wrap; the sum then goes through
+        // the same HPF, clip and gain stages as the other paths.
+        // -----------------------------------------------------------------
+        float* acc = blepAcc;
+        renderBlep(acc);
+        for (int n = 0; n < AUDIO_BLOCK_SAMPLES; ++n) {
+            const float sample = acc[n];
+            // high-pass filter
+            float hpOut = hpfAlpha * (hpfPrevOut + sample - hpfPrevIn);
+            hpfPrevIn = sample;
+            hpfPrevOut = hpOut;
+            // clip and apply output gain and optional mix compensation
+            hpOut = fmaxf(-1.0f, fminf(1.0f, hpOut));
+            float out = hpOut * outputGain * mixGain;
+            out = fmaxf(-1.0f, fminf(1.0f, out));
+            block->data[n] = (int16_t)(out * 32767.0f);
+        }
+        // Residual tail becomes the head of the next block
+        for (int k = 0; k < SUPERSAW_BLEP_TAPS; ++k) {
+            acc[k] = acc[AUDIO_BLOCK_SAMPLES + k];
+        }
+    } else if (!oversample2x) {
         // -----------------------------------------------------------------
         // Standard (44.1 kHz) rendering
         //
@@ -5,6 +5,11 @@
 
 #define SUPERSAW_VOICES 7
 
+// BLEP table anti-aliasing (see setBlepTable()): residual taps around each
+// wrap, and table resolution in fractional-sample positions
+#define SUPERSAW_BLEP_TAPS    8
+#define SUPERSAW_BLEP_PHASES  64
+
 class AudioSynthSupersaw : public AudioStream {
 public:
     AudioSynthSupersaw();
@@ -60,8 +65,29 @@ public:
      * @param enable Set to true to enable PolyBLEP band‑limited saws.
      */
     void setBandLimited(bool enable);
+
+    /**
+     * @brief Enable or disable band-limited steps from a precomputed table.
+     *
+     * Each saw is rendered naively; only at a wrap (a few per block per saw)
+     * a SUPERSAW_BLEP_TAPS-sample residual of a windowed-sinc step is added
+     * around the discontinuity, positioned with a precomputed reciprocal of
+     * the phase increment (no per-sample divide).  Close to raw-saw cost with
+     * alias suppression better than 2× oversampling.  Output is delayed by
+     * SUPERSAW_BLEP_TAPS/2 samples.  Enabled by default; 2× oversampling,
+     * when enabled, takes precedence, and PolyBLEP applies only with this off.
+     *
+     * @param enable Set to true to use the BLEP table.
+     */
+    void setBlepTable(bool enable);
     void noteOn();
 
+    /**
+     * @brief Return to the power-on render state: start phases, HPF and
+     * BLEP history cleared.  Used when an engine changes hands (SupersawPool).
+     */
+    void reset();
+
     virtual void update(void) override;
 
 private:
@@ -72,6 +98,7 @@ private:
     float outputGain;
     float phases[SUPERSAW_VOICES];
     float phaseInc[SUPERSAW_VOICES];
+    float phaseIncInv[SUPERSAW_VOICES];   // 1 / phaseInc (0 when stopped)
     float gains[SUPERSAW_VOICES];
     float hpfPrevIn;
     float hpfPrevOut;
@@ -84,6 +111,11 @@ private:
     // When false a simple naive saw is generated.
     bool usePolyBLEP;
 
+    // BLEP table path: residual accumulator, carried across blocks
+    bool  useBlepTable;
+    float blepAcc[AUDIO_BLOCK_SAMPLES + SUPERSAW_BLEP_TAPS];
+    void  renderBlep(float* acc);
+
     float detuneCurve(float x);
     void calculateIncrements();
     void calculateGains();
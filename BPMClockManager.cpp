@@ -1,6 +1,5 @@
 #include "BPMClockManager.h"
-
-#include "BPMClockManager.h"
+#include "MIDIClockMaster.h"
 
 // Human-readable names for UI display
 extern const char* TimingModeNames[NUM_TIMING_MODES] = {
@@ -29,15 +28,20 @@ BPMClockManager::BPMClockManager()
     , _externalClockRunning(false)
     , _lastClockTime(0)
     , _clockPulseCount(0)
-    , _lastQuarterNoteTime(0)
-    , _measuredBPM(120.0f)
-    , _bpmHistoryIndex(0)
+    , _dllLocked(false)
+    , _dllTime(0.0)
+    , _dllT0(0.0)
+    , _dllT1(0.0)
+    , _dllPeriod(60000000.0 / (120.0 * MIDI_CLOCK_PPQN))
+    , _snapIndex(0)
+    , _master(nullptr)
+    , _tempoRevision(0)
+    , _transportRevision(0)
 {
-    // Initialize BPM history for smoothing
-    for (int i = 0; i < BPM_SMOOTH_SAMPLES; i++) {
-        _bpmHistory[i] = 120.0f;
-    }
-    
+    // Internal clock runs from position 0 at boot
+    _snap[0] = { 0, 0, 0.0f, 120.0f * MIDI_CLOCK_PPQN / 60000000.0f, 1.0e9f };
+    _snap[1] = _snap[0];
+
     // Pre-calculate beat multipliers for default BPM
     updateBeatMultipliers();
 }
@@ -48,9 +52,14 @@ BPMClockManager::BPMClockManager()
 
 void BPMClockManager::setClockSource(ClockSource source) {
     _clockSource = source;
+
+    // An internal transport can't keep running under an external clock
+    if (source == CLOCK_EXTERNAL_MIDI && _master) _master->stop();
     
     // When switching to internal, use the stored internal BPM
     if (source == CLOCK_INTERNAL) {
+        // Continue the internal position from wherever the song was
+        rebase(micros(), _internalBPM * MIDI_CLOCK_PPQN / 60000000.0f, 1.0e9f);
         _currentBPM = _internalBPM;
         updateBeatMultipliers();
     }
@@ -70,9 +79,28 @@ void BPMClockManager::setInternalBPM(float bpm) {
     
     // If currently using internal clock, update immediately
     if (_clockSource == CLOCK_INTERNAL) {
+        // Rebase the position so it stays continuous across the tempo change
+        rebase(micros(), bpm * MIDI_CLOCK_PPQN / 60000000.0f, 1.0e9f);
         _currentBPM = bpm;
         updateBeatMultipliers();  // Recalculate multipliers
     }
+    if (_master) _master->setBPM(bpm);
+}
+
+void BPMClockManager::setInternalTimebase(MIDIClockMaster* master) {
+    _master = master;
+    if (_master) _master->setBPM(_internalBPM);
+}
+
+void BPMClockManager::startTransport() {
+    if (_clockSource != CLOCK_INTERNAL || !_master) return;
+    _master->start();
+    _transportRevision++;
+}
+
+void BPMClockManager::stopTransport() {
+    if (!_master) return;
+    _master->stop();
 }
 
 // ═════════════════════════════════════════════════════════════════
@@ -80,73 +108,81 @@ void BPMClockManager::setInternalBPM(float bpm) {
 // ═════════════════════════════════════════════════════════════════
 
 void BPMClockManager::handleMIDIClock() {
+    handleMIDIClock(micros());
+}
+
+void BPMClockManager::handleMIDIClock(uint32_t stampUs) {
     // Only process if external clock is selected
     if (_clockSource != CLOCK_EXTERNAL_MIDI) return;
-    
-    uint32_t now = micros();  // High-precision timestamp
-    
-    // First pulse - just record timestamp
-    if (_clockPulseCount == 0) {
-        _lastClockTime = now;
-        _lastQuarterNoteTime = now;
-        _clockPulseCount = 1;
-        _externalClockRunning = true;
-        return;
-    }
-    
+
+    _externalClockRunning = true;
+
+    // Unwrap the 32-bit micros() stamp into a continuous double timeline
+    if (_dllLocked) _dllTime += (double)(uint32_t)(stampUs - _lastClockTime);
+    _lastClockTime = stampUs;
     _clockPulseCount++;
-    
-    // Every 24 pulses = 1 quarter note
-    if (_clockPulseCount % MIDI_CLOCK_PPQN == 0) {
-        // Calculate time for this quarter note
-        uint32_t quarterNoteDuration = now - _lastQuarterNoteTime;
-        
-        // Calculate BPM: 60,000,000 microseconds per minute
-        // BPM = 60,000,000 / microseconds_per_quarter_note
-        if (quarterNoteDuration > 0) {
-            float instantBPM = 60000000.0f / quarterNoteDuration;
-            
-            // Smooth BPM using running average
-            _bpmHistory[_bpmHistoryIndex] = instantBPM;
-            _bpmHistoryIndex = (_bpmHistoryIndex + 1) % BPM_SMOOTH_SAMPLES;
-            
-            // Calculate average
-            float sum = 0.0f;
-            for (int i = 0; i < BPM_SMOOTH_SAMPLES; i++) {
-                sum += _bpmHistory[i];
-            }
-            _measuredBPM = sum / BPM_SMOOTH_SAMPLES;
-            
-            // Update current BPM and recalculate multipliers
-            _currentBPM = _measuredBPM;
-            updateBeatMultipliers();
+
+    if (!_dllLocked) {
+        // First tick after Start/Continue/dropout: seed from last known tempo
+        _dllTime   = 0.0;
+        _dllPeriod = 60000000.0 / ((double)_currentBPM * MIDI_CLOCK_PPQN);
+        _dllT0     = 0.0;
+        _dllT1     = _dllPeriod;
+        _dllLocked = true;
+    } else {
+        // Second-order DLL (Adriaensen): phase error e feeds the tick time
+        // with gain b and the period with gain c.
+        const double e = _dllTime - _dllT1;
+
+        // A gap of several periods means clocks were lost — start over
+        if (e > _dllPeriod * 4.0 || e < -_dllPeriod) {
+            _dllTime   = 0.0;
+            _dllT0     = 0.0;
+            _dllT1     = _dllPeriod;
+        } else {
+            const double omega = 2.0 * M_PI * CLOCK_DLL_BANDWIDTH_HZ * _dllPeriod * 1.0e-6;
+            const double b     = 1.41421356 * omega;
+            const double c     = omega * omega;
+            _dllT0      = _dllT1;
+            _dllT1     += b * e + _dllPeriod;
+            _dllPeriod += c * e;
         }
-        
-        _lastQuarterNoteTime = now;
     }
-    
-    _lastClockTime = now;
+
+    // Publish position: tick N (0-based) sits at the filtered time _dllT0
+    const double   tickLen  = _dllT1 - _dllT0;
+    const uint32_t anchorUs = stampUs - (uint32_t)(int32_t)(_dllTime - _dllT0);
+    publishSnapshot(anchorUs, _clockPulseCount - 1, 0.0f, (float)(1.0 / tickLen), 1.0f);
+
+    // Tempo from the filtered period — only on a real change, so
+    // tempo-derived parameters aren't re-sent every tick
+    const float bpm = (float)(60000000.0 / (_dllPeriod * MIDI_CLOCK_PPQN));
+    if (fabsf(bpm - _currentBPM) > 0.01f) {
+        _currentBPM = bpm;
+        updateBeatMultipliers();
+    }
 }
 
 void BPMClockManager::handleMIDIStart() {
     if (_clockSource != CLOCK_EXTERNAL_MIDI) return;
     
-    // Reset all tracking state
+    // Reset all tracking state; the next clock is song position 0
     _clockPulseCount = 0;
     _lastClockTime = micros();
-    _lastQuarterNoteTime = _lastClockTime;
     _externalClockRunning = true;
-    
-    // Reset BPM history for clean start
-    for (int i = 0; i < BPM_SMOOTH_SAMPLES; i++) {
-        _bpmHistory[i] = _currentBPM;  // Use last known BPM
-    }
-    _bpmHistoryIndex = 0;
+    resetFollower();
+    publishSnapshot(_lastClockTime, 0, 0.0f, 0.0f, 0.0f);
+
+    // Position restarts at zero; synced LFOs re-lock their phase
+    _transportRevision++;
 }
 
 void BPMClockManager::handleMIDIStop() {
     if (_clockSource != CLOCK_EXTERNAL_MIDI) return;
     _externalClockRunning = false;
+
+    // Freeze the position where it is
+    rebase(micros(), 0.0f, 0.0f);
     // Note: We keep _currentBPM so LFOs/delays maintain last tempo
 }
 
@@ -154,6 +190,45 @@ void BPMClockManager::handleMIDIContinue() {
     if (_clockSource != CLOCK_EXTERNAL_MIDI) return;
     _externalClockRunning = true;
     _lastClockTime = micros();
+    // Tick count carries on; only the timing estimate restarts
+    resetFollower();
+}
+
+void BPMClockManager::update() {
+    if (_clockSource != CLOCK_INTERNAL) return;
+
+    // Sample-clocked position from the master, refreshed every pass
+    if (_master) {
+        uint32_t us, tick; float frac, slope;
+        _master->getPosition(us, tick, frac, slope);
+        publishSnapshot(us, tick, frac, slope, 1.0e9f);
+        return;
+    }
+
+    const uint32_t now = micros();
+    const ClockSnapshot& snap = _snap[_snapIndex];
+    if ((uint32_t)(now - snap.anchorUs) > 1000000u) {
+        rebase(now, snap.ticksPerUs, snap.maxAhead);
+    }
+}
+
+void BPMClockManager::resetFollower() {
+    _dllLocked = false;
+}
+
+void BPMClockManager::publishSnapshot(uint32_t anchorUs, uint32_t anchorTick, float anchorFrac,
+                                      float ticksPerUs, float maxAhead) {
+    // Write the idle buffer, then flip.  The audio ISR cannot interrupt
+    // itself, so a reader never sees the buffer being written.
+    const uint8_t next = _snapIndex ^ 1;
+    _snap[next] = { anchorUs, anchorTick, anchorFrac, ticksPerUs, maxAhead };
+    _snapIndex = next;
+}
+
+void BPMClockManager::rebase(uint32_t now, float ticksPerUs, float maxAhead) {
+    uint32_t tick; float frac;
+    _snap[_snapIndex].positionAt(now, tick, frac);
+    publishSnapshot(now, tick, frac, ticksPerUs, maxAhead);
 }
 
 // ═════════════════════════════════════════════════════════════════
@@ -166,9 +241,10 @@ float BPMClockManager::getFrequencyForMode(TimingMode mode) const {
     // Use pre-calculated multiplier
     float multiplier = _beatMultipliers[mode];
     
-    // frequency = (BPM / 60) * multiplier
-    // Example: 120 BPM, quarter note → (120/60) * 1.0 = 2.0 Hz
-    return (_currentBPM / 60.0f) * multiplier;
+    // frequency = (BPM / 60) / multiplier  (multiplier = beats per cycle)
+    // Example: 120 BPM, quarter note → (120/60) / 1.0 = 2.0 Hz
+    //          120 BPM, 1 bar        → (120/60) / 4.0 = 0.5 Hz
+    return (_currentBPM / 60.0f) / multiplier;
 }
 
 float BPMClockManager::getTimeForMode(TimingMode mode) const {
@@ -186,6 +262,14 @@ float BPMClockManager::getTimeForMode(TimingMode mode) const {
 // Status and Diagnostics
 // ═════════════════════════════════════════════════════════════════
 
+float BPMClockManager::getBeatPosition() const {
+    return getBeatPositionAt(micros());
+}
+
+float BPMClockManager::getBeatPositionAt(uint32_t us) const {
+    return _snap[_snapIndex].beatAt(us);
+}
+
 uint32_t BPMClockManager::getTimeSinceLastClock() const {
     if (!_externalClockRunning) return 0;
     return (micros() - _lastClockTime) / 1000;  // Convert to milliseconds
@@ -208,9 +292,12 @@ void BPMClockManager::updateBeatMultipliers() {
     _beatMultipliers[TIMING_1_8]    = 0.5f;      // Eighth note
     _beatMultipliers[TIMING_1_16]   = 0.25f;     // Sixteenth note
     _beatMultipliers[TIMING_1_32]   = 0.125f;    // 32nd note
-    _beatMultipliers[TIMING_1_4T]   = 0.6667f;   // Quarter triplet (2/3)
-    _beatMultipliers[TIMING_1_8T]   = 0.3333f;   // Eighth triplet (1/3)
-    _beatMultipliers[TIMING_1_16T]  = 0.1667f;   // Sixteenth triplet (1/6)
+    _beatMultipliers[TIMING_1_4T]   = 2.0f / 3.0f;  // Quarter triplet (2/3)
+    _beatMultipliers[TIMING_1_8T]   = 1.0f / 3.0f;  // Eighth triplet (1/3)
+    _beatMultipliers[TIMING_1_16T]  = 1.0f / 6.0f;  // Sixteenth triplet (1/6)
+
+    // Every call follows a BPM change — let consumers pick it up
+    _tempoRevision++;
 }
 
 float BPMClockManager::getBeatMultiplier(TimingMode mode) const {
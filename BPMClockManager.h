@@ -24,6 +24,12 @@ enum TimingMode {
 // Human-readable names for UI display
 extern const char* TimingModeNames[NUM_TIMING_MODES];
 
+class MIDIClockMaster;  // Sample-clocked internal clock output (optional)
+
+// Clock follower (DLL) loop bandwidth.  Higher = faster tempo tracking,
+// lower = more jitter rejection.  ~1 Hz settles in well under a second.
+#define CLOCK_DLL_BANDWIDTH_HZ 1.0f
+
 // Clock source selection
 enum ClockSource {
     CLOCK_INTERNAL,
@@ -31,13 +37,60 @@ enum ClockSource {
     NUM_CLOCK_SOURCES
 };
 
+/**
+ * @brief Song-position snapshot published for the audio thread
+ *
+ * Position is kept in MIDI clock ticks (24 PPQN): a whole tick count plus a
+ * fraction, so it never loses resolution however long the song runs.
+ * ticksAt(us) = anchorFrac + (us - anchorUs) * ticksPerUs, clamped to at most
+ * maxAhead ticks past the anchor so a late/stopped clock never overshoots.
+ * Written by the control side into a double buffer; readers in the audio
+ * ISR always see a complete snapshot.
+ */
+struct ClockSnapshot {
+    uint32_t anchorUs;     // micros() at the anchor
+    uint32_t anchorTick;   // Whole ticks since Start at anchorUs
+    float    anchorFrac;   // Fraction of a tick at anchorUs, 0..1
+    float    ticksPerUs;   // Slope (0 while stopped)
+    float    maxAhead;     // Extrapolation limit in ticks
+
+    // Ticks past anchorTick at 'us' (small: anchors are refreshed often)
+    float ticksAt(uint32_t us) const {
+        float d = (float)(int32_t)(us - anchorUs) * ticksPerUs;
+        if (d > maxAhead) d = maxAhead;
+        return anchorFrac + d;
+    }
+
+    // Position at 'us' as whole ticks + fraction (for re-anchoring)
+    void positionAt(uint32_t us, uint32_t& tick, float& frac) const {
+        const float t     = ticksAt(us);
+        const float whole = floorf(t);
+        tick = anchorTick + (uint32_t)(int32_t)whole;
+        frac = t - whole;
+    }
+
+    // Quarter notes since Start (float: for display, not for phase)
+    float beatAt(uint32_t us) const {
+        return (float)(((double)anchorTick + ticksAt(us)) * (1.0 / MIDI_CLOCK_PPQN));
+    }
+
+    // Phase (0..2^32) within a cycle of 'ticksPerCycle' whole ticks.  The
+    // whole-tick part is wrapped in integers first, so the result is exact
+    // at any song position.
+    uint32_t phaseAt(uint32_t us, uint32_t ticksPerCycle) const {
+        float c = ((float)(anchorTick % ticksPerCycle) + ticksAt(us)) / (float)ticksPerCycle;
+        c -= floorf(c);
+        return (uint32_t)(c * 4294967296.0f);
+    }
+};
+
 /**
  * @brief BPM clock manager for tempo-synced modulation and effects
  * 
  * Features:
  * - Internal/external MIDI clock support
  * - MIDI clock (0xF8) message handling (24 PPQN)
- * - BPM calculation and smoothing
+ * - Second-order DLL clock follower: tempo + continuous beat phase
  * - Musical note division conversion
  * - CPU-efficient: calculations only when BPM changes
  */
@@ -76,6 +129,23 @@ public:
      * @return Current BPM (internal or calculated from external MIDI clock)
      */
     float getCurrentBPM() const { return _currentBPM; }
+
+    /**
+     * @brief Drive the internal clock from a sample-counted master
+     * @param master Clock master (nullptr = micros()-based internal clock)
+     *
+     * With a master attached the internal song position is taken from the
+     * audio sample count, so synced LFOs/delay share the exact timebase of
+     * the outgoing MIDI clock.  Internal BPM changes are forwarded to it.
+     */
+    void setInternalTimebase(MIDIClockMaster* master);
+
+    /**
+     * @brief Start/stop the internal transport (sends MIDI Start/Stop)
+     * Only acts with CLOCK_INTERNAL and a master attached.
+     */
+    void startTransport();
+    void stopTransport();
     
     // ─────────────────────────────────────────────────────────────
     // MIDI Clock Message Handling (External Clock)
@@ -87,6 +157,15 @@ public:
      * Automatically calculates BPM from pulse timing (24 PPQN)
      */
     void handleMIDIClock();
+
+    /**
+     * @brief Handle a MIDI clock pulse with an explicit arrival timestamp
+     * @param stampUs micros() at (or estimated at) byte arrival
+     *
+     * Use when the caller can stamp closer to the wire than the handler,
+     * e.g. DIN MIDI backing out bytes still queued in the UART FIFO.
+     */
+    void handleMIDIClock(uint32_t stampUs);
     
     /**
      * @brief Handle MIDI Start message (0xFA)
@@ -105,6 +184,14 @@ public:
      * Resumes external clock tracking
      */
     void handleMIDIContinue();
+
+    /**
+     * @brief Housekeeping — call once per loop()
+     * Re-anchors the internal-clock snapshot (from the clock master when
+     * attached, otherwise every second) so the int32 µs offset in
+     * ClockSnapshot::beatAt() never wraps.
+     */
+    void update();
     
     // ─────────────────────────────────────────────────────────────
     // Timing Conversions (Core Calculation Methods)
@@ -133,6 +220,53 @@ public:
      *   TIMING_1_16 → 125 ms
      */
     float getTimeForMode(TimingMode mode) const;
+
+    /**
+     * @brief Length of one cycle of a timing mode, in whole clock ticks
+     * @param mode Musical division
+     * @return Ticks per cycle (96 = one bar, 16 = quarter triplet), 0 if free
+     */
+    uint32_t getTicksForMode(TimingMode mode) const {
+        return (uint32_t)lroundf(getBeatMultiplier(mode) * MIDI_CLOCK_PPQN);
+    }
+
+    // ─────────────────────────────────────────────────────────────
+    // Transport Position (for phase-locked modulation)
+    // ─────────────────────────────────────────────────────────────
+
+    /**
+     * @brief Current song position in quarter notes since Start
+     *
+     * External clock: whole MIDI clock ticks since Start plus the fraction
+     * of a tick elapsed since the last one (clamped, so a late clock never
+     * jumps the position backwards).  Internal clock: derived from
+     * micros(), rebased on every tempo change so it stays continuous.
+     */
+    float getBeatPosition() const;
+
+    /**
+     * @brief Song position at an arbitrary micros() time (audio-thread safe)
+     * @param us Timestamp, typically micros() at block start plus
+     *           sampleIndex * 1e6 / AUDIO_SAMPLE_RATE_EXACT
+     */
+    float getBeatPositionAt(uint32_t us) const;
+
+    /**
+     * @brief Copy the current position snapshot (audio-thread safe)
+     */
+    ClockSnapshot getSnapshot() const { return _snap[_snapIndex]; }
+
+    /**
+     * @brief Incremented whenever the effective BPM changes
+     * Consumers compare against a cached value instead of re-sending
+     * tempo-derived parameters every loop.
+     */
+    uint32_t getTempoRevision() const { return _tempoRevision; }
+
+    /**
+     * @brief Incremented on MIDI Start (position reset to zero)
+     */
+    uint32_t getTransportRevision() const { return _transportRevision; }
     
     // ─────────────────────────────────────────────────────────────
     // Status and Diagnostics
@@ -163,16 +297,26 @@ private:
     bool _externalClockRunning;         // Is MIDI clock active?
     uint32_t _lastClockTime;            // Timestamp of last MIDI clock (micros)
     uint32_t _clockPulseCount;          // Pulses since start (24 per quarter)
-    uint32_t _lastQuarterNoteTime;      // Time of last quarter note boundary
-    float _measuredBPM;                 // Calculated BPM from MIDI timing
-    
-    // BPM smoothing for stable external clock
-    static const int BPM_SMOOTH_SAMPLES = 4;  // Average over N quarter notes
-    float _bpmHistory[BPM_SMOOTH_SAMPLES];
-    int _bpmHistoryIndex;
-    
+
+    // DLL clock follower state (times in µs, unwrapped to double)
+    bool     _dllLocked;                // false until first tick after reset
+    double   _dllTime;                  // Unwrapped time of last stamp
+    double   _dllT0;                    // Filtered time of current tick
+    double   _dllT1;                    // Predicted time of next tick
+    double   _dllPeriod;                // Filtered tick period
+
+    // Position snapshot, double-buffered for lock-free audio-thread reads
+    ClockSnapshot     _snap[2];
+    volatile uint8_t  _snapIndex;
+
     // Cached multipliers for efficiency (updated only when BPM changes)
     float _beatMultipliers[NUM_TIMING_MODES];
+
+    MIDIClockMaster* _master;           // Internal timebase / clock out
+
+    // Change counters (see getTempoRevision / getTransportRevision)
+    uint32_t _tempoRevision;
+    uint32_t _transportRevision;
     
     // ─────────────────────────────────────────────────────────────
     // Internal Helper Methods
@@ -192,8 +336,18 @@ private:
     float getBeatMultiplier(TimingMode mode) const;
     
     /**
-     * @brief Update BPM from external clock measurements
-     * Applies smoothing and validation
+     * @brief Restart the DLL (Start/Continue, or after a dropout)
+     */
+    void resetFollower();
+
+    /**
+     * @brief Publish a new position snapshot
+     */
+    void publishSnapshot(uint32_t anchorUs, uint32_t anchorTick, float anchorFrac,
+                         float ticksPerUs, float maxAhead);
+
+    /**
+     * @brief Re-anchor at 'now' with a new slope, position continuous
      */
-    void updateExternalBPM();
+    void rebase(uint32_t now, float ticksPerUs, float maxAhead);
 };
\ No newline at end of file
@@ -178,11 +178,23 @@ namespace CC {
     static constexpr uint8_t LFO1_TIMING_MODE    = 120;  // 0-11 (TimingMode enum)
     static constexpr uint8_t LFO2_TIMING_MODE    = 121;  // 0-11 (TimingMode enum)
     static constexpr uint8_t DELAY_TIMING_MODE   = 122;  // 0-11 (TimingMode enum)
+    static constexpr uint8_t BPM_TRANSPORT       = 14;   // 0-63 Stop, 64-127 Start (internal clock out)
+    static constexpr uint8_t LFO1_KEY_SYNC       = 15;   // 0-63 Free, 64-127 per-voice phase reset at noteOn
+    static constexpr uint8_t LFO2_KEY_SYNC       = 16;   // 0-63 Free, 64-127 per-voice phase reset at noteOn
+
+    // -------------------------------------------------------------------------
+    // 14-bit parameter prefix
+    // -------------------------------------------------------------------------
+    // Send the low 7 bits here, then the parameter CC with the high 7 bits:
+    // the pair lands as one 14-bit update (same idea as MIDI's CC 88
+    // high-resolution velocity prefix).  The standard MSB/LSB pairs (n, n+32)
+    // and the NRPN numbers (6/38/98/99) are all taken by parameters here.
+    static constexpr uint8_t HIRES_LSB           = 20;
 
     // -------------------------------------------------------------------------
     // Utility: return human-readable name for a CC
     // -------------------------------------------------------------------------
-    inline const char* name(uint8_t cc) {
+    constexpr const char* name(uint8_t cc) {
         switch (cc) {
             // Oscillators
             case OSC1_WAVE:           return "OSC1 Wave";
@@ -294,9 +306,13 @@ namespace CC {
             // BPM Timing (NEW)
             case BPM_CLOCK_SOURCE:    return "Clock Src";
             case BPM_INTERNAL_TEMPO:  return "Int BPM";
+            case BPM_TRANSPORT:       return "Transport";
             case LFO1_TIMING_MODE:    return "LFO1 Sync";
             case LFO2_TIMING_MODE:    return "LFO2 Sync";
+            case LFO1_KEY_SYNC:       return "LFO1 Key";
+            case LFO2_KEY_SYNC:       return "LFO2 Key";
             case DELAY_TIMING_MODE:   return "Dly Sync";
+            case HIRES_LSB:           return "Hi-Res LSB";
 
             default:                  return nullptr;
         }
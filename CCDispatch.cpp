@@ -0,0 +1,482 @@
+// CCDispatch.cpp
+// =============================================================================
+// CC handlers and the descriptor table (see CCDispatch.h).
+// =============================================================================
+
+#include "CCDispatch.h"
+#include "SynthEngine.h"
+#include "Mapping.h"
+#include "PatchSchema.h"
+#include "Waveforms.h"
+#include "WaveTablePool.h"
+#include "DebugTrace.h"
+
+namespace CCDispatch {
+
+// =============================================================================
+// HANDLERS
+// Raw-curve handlers receive the 7-bit value in both x and v and bin it
+// themselves; the rest receive the curve output in x.
+// =============================================================================
+
+namespace {
+
+// Enum binning shared with the UI (SectionScreen writes bucket midpoints)
+inline uint8_t bin(uint8_t v, uint8_t count) {
+    const uint8_t i = (uint8_t)((uint16_t(v) * count) / 128u);
+    return (i >= count) ? count - 1 : i;
+}
+
+// Coarse pitch: 5 semitone steps (−24/−12/0/+12/+24)
+inline float coarseSemis(uint8_t v) {
+    return (v <= 25) ? -24.0f : (v <= 51) ? -12.0f :
+           (v <= 76) ?   0.0f : (v <= 101) ? 12.0f : 24.0f;
+}
+
+// FX feedback: 0 = use preset default (−1), 1..127 → 0..0.99
+inline float fxFeedback(uint8_t v) { return (v == 0) ? -1.0f : ((v - 1) / 126.0f) * 0.99f; }
+
+// ---- Oscillators ------------------------------------------------------------
+
+void handleOsc1Wave(SynthEngine& s, float, uint8_t v) {
+    const WaveformType t = waveformFromCC(v);
+    s.setOsc1Waveform((int)t);
+    JT_LOGF("[CC OSC1_WAVE] -> %s\n", waveformShortName(t));
+}
+void handleOsc2Wave(SynthEngine& s, float, uint8_t v) {
+    const WaveformType t = waveformFromCC(v);
+    s.setOsc2Waveform((int)t);
+    JT_LOGF("[CC OSC2_WAVE] -> %s\n", waveformShortName(t));
+}
+
+void handleOsc1PitchOffset(SynthEngine& s, float, uint8_t v) { s.setOsc1PitchOffset(coarseSemis(v)); }
+void handleOsc2PitchOffset(SynthEngine& s, float, uint8_t v) { s.setOsc2PitchOffset(coarseSemis(v)); }
+void handleOsc1Detune(SynthEngine& s, float x, uint8_t)      { s.setOsc1Detune(x); }
+void handleOsc2Detune(SynthEngine& s, float x, uint8_t)      { s.setOsc2Detune(x); }
+void handleOsc1FineTune(SynthEngine& s, float x, uint8_t)    { s.setOsc1FineTune(x); }
+void handleOsc2FineTune(SynthEngine& s, float x, uint8_t)    { s.setOsc2FineTune(x); }
+
+// OSC balance: 0 = full osc1, 127 = full osc2
+void handleOscMixBalance(SynthEngine& s, float x, uint8_t) { s.setOscMix(1.0f - x, x); }
+void handleOsc1Mix(SynthEngine& s, float x, uint8_t)       { s.setOsc1Mix(x); }
+void handleOsc2Mix(SynthEngine& s, float x, uint8_t)       { s.setOsc2Mix(x); }
+void handleSubMix(SynthEngine& s, float x, uint8_t)        { s.setSubMix(x); }
+void handleNoiseMix(SynthEngine& s, float x, uint8_t)      { s.setNoiseMix(x); }
+
+void handleSupersaw1Detune(SynthEngine& s, float x, uint8_t) { s.setSupersawDetune(0, x); }
+void handleSupersaw1Mix(SynthEngine& s, float x, uint8_t)    { s.setSupersawMix(0, x); }
+void handleSupersaw2Detune(SynthEngine& s, float x, uint8_t) { s.setSupersawDetune(1, x); }
+void handleSupersaw2Mix(SynthEngine& s, float x, uint8_t)    { s.setSupersawMix(1, x); }
+
+// Freq DC range is 0..DC_PITCH_MAX_SEMITONES expressed as FM input (see SynthEngine.h)
+void handleOsc1FreqDC(SynthEngine& s, float x, uint8_t)  { s.setOsc1FrequencyDcAmp(x); }
+void handleOsc2FreqDC(SynthEngine& s, float x, uint8_t)  { s.setOsc2FrequencyDcAmp(x); }
+void handleOsc1ShapeDC(SynthEngine& s, float x, uint8_t) { s.setOsc1ShapeDcAmp(x); }
+void handleOsc2ShapeDC(SynthEngine& s, float x, uint8_t) { s.setOsc2ShapeDcAmp(x); }
+void handleRing1Mix(SynthEngine& s, float x, uint8_t)    { s.setRing1Mix(x); }
+void handleRing2Mix(SynthEngine& s, float x, uint8_t)    { s.setRing2Mix(x); }
+
+void handleOsc1FeedbackAmount(SynthEngine& s, float x, uint8_t) { s.setOsc1FeedbackAmount(x); }
+void handleOsc2FeedbackAmount(SynthEngine& s, float x, uint8_t) { s.setOsc2FeedbackAmount(x); }
+void handleOsc1FeedbackMix(SynthEngine& s, float x, uint8_t)    { s.setOsc1FeedbackMix(x); }
+void handleOsc2FeedbackMix(SynthEngine& s, float x, uint8_t)    { s.setOsc2FeedbackMix(x); }
+
+// Arbitrary waveform bank: 0..127 spread over built-in + loaded user banks
+void handleOsc1ArbBank(SynthEngine& s, float, uint8_t v) {
+    const ArbBank bank = static_cast<ArbBank>(bin(v, wavebank_count()));
+    s.setOsc1ArbBank(bank);
+    JT_LOGF("[CC OSC1_BANK] -> %s\n", wavebank_name(bank));
+}
+void handleOsc2ArbBank(SynthEngine& s, float, uint8_t v) {
+    const ArbBank bank = static_cast<ArbBank>(bin(v, wavebank_count()));
+    s.setOsc2ArbBank(bank);
+    JT_LOGF("[CC OSC2_BANK] -> %s\n", wavebank_name(bank));
+}
+
+// Table index: 0..127 spread over the tables of the current bank
+inline uint16_t arbIndex(uint8_t v, uint16_t count) {
+    if (count == 0) return 0;
+    const uint16_t idx = (uint16_t)((uint32_t(v) * count) / 128u);
+    return (idx >= count) ? count - 1 : idx;
+}
+void handleOsc1ArbIndex(SynthEngine& s, float, uint8_t v) {
+    s.setOsc1ArbIndex(arbIndex(v, wavebank_tableCount(s.getOsc1ArbBank())));
+}
+void handleOsc2ArbIndex(SynthEngine& s, float, uint8_t v) {
+    s.setOsc2ArbIndex(arbIndex(v, wavebank_tableCount(s.getOsc2ArbBank())));
+}
+
+// ---- Filter -----------------------------------------------------------------
+
+void handleFilterCutoff(SynthEngine& s, float x, uint8_t)      { s.setFilterCutoff(x); }
+void handleFilterResonance(SynthEngine& s, float x, uint8_t)   { s.setFilterResonance(x); }
+void handleFilterEnvAmount(SynthEngine& s, float x, uint8_t)   { s.setFilterEnvAmount(x); }
+void handleFilterKeyTrack(SynthEngine& s, float x, uint8_t)    { s.setFilterKeyTrackAmount(x); }
+void handleFilterOctaveControl(SynthEngine& s, float x, uint8_t) { s.setFilterOctaveControl(x); }
+void handleFilterMultimode(SynthEngine& s, float x, uint8_t)   { s.setFilterMultimode(x); }
+void handleFilterResModDepth(SynthEngine& s, float x, uint8_t) { s.setFilterResonanceModDepth(x); }
+
+void handleFilterTwoPole(SynthEngine& s, float, uint8_t v)      { s.setFilterTwoPole(JT4000Map::cc_to_bool(v)); }
+void handleFilterXpander4Pole(SynthEngine& s, float, uint8_t v) { s.setFilterXpander4Pole(JT4000Map::cc_to_bool(v)); }
+void handleFilterBPBlend2Pole(SynthEngine& s, float, uint8_t v) { s.setFilterBPBlend2Pole(JT4000Map::cc_to_bool(v)); }
+void handleFilterPush2Pole(SynthEngine& s, float, uint8_t v)    { s.setFilterPush2Pole(JT4000Map::cc_to_bool(v)); }
+void handleFilterXpanderMode(SynthEngine& s, float, uint8_t v)  { s.setFilterXpanderMode(JT4000Map::cc_to_obxa_xpander_mode(v)); }
+
+// ---- Envelopes --------------------------------------------------------------
+
+void handleAmpAttack(SynthEngine& s, float x, uint8_t)         { s.setAmpAttack(x); }
+void handleAmpDecay(SynthEngine& s, float x, uint8_t)          { s.setAmpDecay(x); }
+void handleAmpSustain(SynthEngine& s, float x, uint8_t)        { s.setAmpSustain(x); }
+void handleAmpRelease(SynthEngine& s, float x, uint8_t)        { s.setAmpRelease(x); }
+void handleFilterEnvAttack(SynthEngine& s, float x, uint8_t)   { s.setFilterEnvAttack(x); }
+void handleFilterEnvDecay(SynthEngine& s, float x, uint8_t)    { s.setFilterEnvDecay(x); }
+void handleFilterEnvSustain(SynthEngine& s, float x, uint8_t)  { s.setFilterEnvSustain(x); }
+void handleFilterEnvRelease(SynthEngine& s, float x, uint8_t)  { s.setFilterEnvRelease(x); }
+
+void handlePitchEnvAttack(SynthEngine& s, float x, uint8_t)    { s.setPitchEnvAttack(x); }
+void handlePitchEnvDecay(SynthEngine& s, float x, uint8_t)     { s.setPitchEnvDecay(x); }
+void handlePitchEnvSustain(SynthEngine& s, float x, uint8_t)   { s.setPitchEnvSustain(x); }
+void handlePitchEnvRelease(SynthEngine& s, float x, uint8_t)   { s.setPitchEnvRelease(x); }
+void handlePitchEnvDepth(SynthEngine& s, float x, uint8_t)     { s.setPitchEnvDepth(x); }
+
+// ---- LFOs -------------------------------------------------------------------
+
+void handleLFO1Freq(SynthEngine& s, float x, uint8_t)  { s.setLFO1Frequency(x); }
+void handleLFO2Freq(SynthEngine& s, float x, uint8_t)  { s.setLFO2Frequency(x); }
+void handleLFO1Depth(SynthEngine& s, float x, uint8_t) { s.setLFO1Amount(x); }
+void handleLFO2Depth(SynthEngine& s, float x, uint8_t) { s.setLFO2Amount(x); }
+void handleLFO1Dest(SynthEngine& s, float, uint8_t v)  { s.setLFO1Destination((LFODestination)JT4000Map::lfoDestFromCC(v)); }
+void handleLFO2Dest(SynthEngine& s, float, uint8_t v)  { s.setLFO2Destination((LFODestination)JT4000Map::lfoDestFromCC(v)); }
+void handleLFO1Wave(SynthEngine& s, float, uint8_t v)  { s.setLFO1Waveform((int)waveformFromCC(v)); }
+void handleLFO2Wave(SynthEngine& s, float, uint8_t v)  { s.setLFO2Waveform((int)waveformFromCC(v)); }
+
+void handleLFO1PitchDepth(SynthEngine& s, float x, uint8_t)  { s.setLFO1PitchDepth(x); }
+void handleLFO1FilterDepth(SynthEngine& s, float x, uint8_t) { s.setLFO1FilterDepth(x); }
+void handleLFO1PWMDepth(SynthEngine& s, float x, uint8_t)    { s.setLFO1PWMDepth(x); }
+void handleLFO1AmpDepth(SynthEngine& s, float x, uint8_t)    { s.setLFO1AmpDepth(x); }
+void handleLFO1Delay(SynthEngine& s, float x, uint8_t)       { s.setLFO1Delay(x); }
+void handleLFO2PitchDepth(SynthEngine& s, float x, uint8_t)  { s.setLFO2PitchDepth(x); }
+void handleLFO2FilterDepth(SynthEngine& s, float x, uint8_t) { s.setLFO2FilterDepth(x); }
+void handleLFO2PWMDepth(SynthEngine& s, float x, uint8_t)    { s.setLFO2PWMDepth(x); }
+void handleLFO2AmpDepth(SynthEngine& s, float x, uint8_t)    { s.setLFO2AmpDepth(x); }
+void handleLFO2Delay(SynthEngine& s, float x, uint8_t)       { s.setLFO2Delay(x); }
+
+// Key sync: 0-63 free, 64-127 phase restarts per voice at noteOn
+void handleLFO1KeySync(SynthEngine& s, float, uint8_t v) { s.setLFO1KeySync(v >= 64); }
+void handleLFO2KeySync(SynthEngine& s, float, uint8_t v) { s.setLFO2KeySync(v >= 64); }
+
+// Timing modes spread evenly across 0-127
+void handleLFO1TimingMode(SynthEngine& s, float, uint8_t v) {
+    const TimingMode mode = (TimingMode)bin(v, NUM_TIMING_MODES);
+    s.setLFO1TimingMode(mode);
+    JT_LOGF("[CC LFO1_TIMING] %s\n", TimingModeNames[(int)mode]);
+}
+void handleLFO2TimingMode(SynthEngine& s, float, uint8_t v) {
+    const TimingMode mode = (TimingMode)bin(v, NUM_TIMING_MODES);
+    s.setLFO2TimingMode(mode);
+    JT_LOGF("[CC LFO2_TIMING] %s\n", TimingModeNames[(int)mode]);
+}
+void handleDelayTimingMode(SynthEngine& s, float, uint8_t v) {
+    const TimingMode mode = (TimingMode)bin(v, NUM_TIMING_MODES);
+    s.setDelayTimingMode(mode);
+    JT_LOGF("[CC DELAY_TIMING] %s\n", TimingModeNames[(int)mode]);
+}
+
+// ---- FX ---------------------------------------------------------------------
+
+void handleFXBassGain(SynthEngine& s, float x, uint8_t)   { s.setFXBassGain(x); }
+void handleFXTrebleGain(SynthEngine& s, float x, uint8_t) { s.setFXTrebleGain(x); }
+
+// Modulation effect: 0 = off (−1), 1-127 → variation 0-10
+void handleFXModEffect(SynthEngine& s, float, uint8_t v) {
+    s.setFXModEffect((v == 0) ? -1 : (int8_t)min(10u, ((v - 1) * 11u) / 127u));
+    JT_LOGF("[CC FX_MOD_EFFECT] %s\n", s.getFXModEffectName());
+}
+void handleFXModMix(SynthEngine& s, float x, uint8_t)       { s.setFXModMix(x); }
+void handleFXModRate(SynthEngine& s, float x, uint8_t)      { s.setFXModRate(x); }
+void handleFXModFeedback(SynthEngine& s, float, uint8_t v)  { s.setFXModFeedback(fxFeedback(v)); }
+
+// Delay effect: 0 = off (−1), 1-127 → variation 0-4
+void handleFXDelayEffect(SynthEngine& s, float, uint8_t v) {
+    s.setFXDelayEffect((v == 0) ? -1 : (int8_t)min(4u, ((v - 1) * 5u) / 127u));
+    JT_LOGF("[CC FX_DELAY_EFFECT] %s\n", s.getFXDelayEffectName());
+}
+void handleFXDelayMix(SynthEngine& s, float x, uint8_t)      { s.setFXDelayMix(x); }
+void handleFXDelayFeedback(SynthEngine& s, float, uint8_t v) { s.setFXDelayFeedback(fxFeedback(v)); }
+void handleFXDelayTime(SynthEngine& s, float x, uint8_t)     { s.setFXDelayTime(x); }
+
+void handleFXReverbSize(SynthEngine& s, float x, uint8_t)   { s.setFXReverbRoomSize(x); }
+void handleFXReverbHiDamp(SynthEngine& s, float x, uint8_t) { s.setFXReverbHiDamping(x); }
+void handleFXReverbLoDamp(SynthEngine& s, float x, uint8_t) { s.setFXReverbLoDamping(x); }
+void handleFXReverbMix(SynthEngine& s, float x, uint8_t)    { s.setFXReverbMix(x, x); }
+void handleFXReverbBypass(SynthEngine& s, float, uint8_t v) { s.setFXReverbBypass(v >= 64); }
+void handleFXDryMix(SynthEngine& s, float x, uint8_t)       { s.setFXDryMix(x); }
+void handleFXJPFXMix(SynthEngine& s, float x, uint8_t)      { s.setFXJPFXMix(x, x); }
+
+// ---- Global -----------------------------------------------------------------
+
+void handleGlideEnable(SynthEngine& s, float, uint8_t v)  { s.setGlideEnabled(v >= 1); }
+void handleGlideTime(SynthEngine& s, float x, uint8_t)    { s.setGlideTime(x); }
+void handleAmpModFixed(SynthEngine& s, float x, uint8_t)  { s.SetAmpModFixedLevel(x); }
+void handlePitchBendRange(SynthEngine& s, float x, uint8_t) { s.setPitchBendRange(x); }
+
+void handleVelocityAmpSens(SynthEngine& s, float x, uint8_t)    { s.setVelocityAmpSens(x); }
+void handleVelocityFilterSens(SynthEngine& s, float x, uint8_t) { s.setVelocityFilterSens(x); }
+void handleVelocityEnvSens(SynthEngine& s, float x, uint8_t)    { s.setVelocityEnvSens(x); }
+
+// BPM: source 0-63 internal / 64-127 external; transport 0-63 stop / 64-127 start
+void handleBPMClockSource(SynthEngine& s, float, uint8_t v)   { s.setBPMClockSource(v >= 64); }
+void handleBPMInternalTempo(SynthEngine& s, float x, uint8_t) { s.setBPMInternalTempo(x); }
+void handleBPMTransport(SynthEngine& s, float, uint8_t v)     { s.setBPMTransport(v >= 64); }
+
+// =============================================================================
+// DESCRIPTOR TABLE
+// =============================================================================
+
+// Shared-state groups (Descriptor::link)
+enum : uint8_t { LINK_NONE = 0, LINK_OSC_MIX, LINK_LFO1_RATE, LINK_LFO1_DEST, LINK_LFO2_DEST,
+                 LINK_OSC1_ARB, LINK_OSC2_ARB };
+
+constexpr Table build() {
+    Table t{};
+    using C = Curve;
+    constexpr uint8_t P = PATCH, F = FANOUT, V = FANOUT | STAGED;
+
+    // Oscillators
+    t.cc[CC::OSC1_WAVE]            = { handleOsc1Wave,           C::Raw,    0.0f,   0.0f,  P | V };
+    t.cc[CC::OSC2_WAVE]            = { handleOsc2Wave,           C::Raw,    0.0f,   0.0f,  P | V };
+    t.cc[CC::OSC1_PITCH_OFFSET]    = { handleOsc1PitchOffset,    C::Raw,    0.0f,   0.0f,  P | V };
+    t.cc[CC::OSC2_PITCH_OFFSET]    = { handleOsc2PitchOffset,    C::Raw,    0.0f,   0.0f,  P | V };
+    t.cc[CC::OSC1_DETUNE]          = { handleOsc1Detune,         C::Linear, -1.0f,  1.0f,  P | V };
+    t.cc[CC::OSC2_DETUNE]          = { handleOsc2Detune,         C::Linear, -1.0f,  1.0f,  P | V };
+    t.cc[CC::OSC1_FINE_TUNE]       = { handleOsc1FineTune,       C::Linear, -100.0f, 100.0f, P | V };
+    t.cc[CC::OSC2_FINE_TUNE]       = { handleOsc2FineTune,       C::Linear, -100.0f, 100.0f, P | V };
+    t.cc[CC::OSC_MIX_BALANCE]      = { handleOscMixBalance,      C::Linear, 0.0f,   1.0f,  P | V, LINK_OSC_MIX };
+    t.cc[CC::OSC1_MIX]             = { handleOsc1Mix,            C::Linear, 0.0f,   1.0f,  P | V, LINK_OSC_MIX };
+    t.cc[CC::OSC2_MIX]             = { handleOsc2Mix,            C::Linear, 0.0f,   1.0f,  P | V, LINK_OSC_MIX };
+    t.cc[CC::SUB_MIX]              = { handleSubMix,             C::Linear, 0.0f,   1.0f,  P | V };
+    t.cc[CC::NOISE_MIX]            = { handleNoiseMix,           C::Linear, 0.0f,   1.0f,  P | V };
+    t.cc[CC::SUPERSAW1_DETUNE]     = { handleSupersaw1Detune,    C::Linear, 0.0f,   1.0f,  P | V };
+    t.cc[CC::SUPERSAW1_MIX]        = { handleSupersaw1Mix,       C::Linear, 0.0f,   1.0f,  P | V };
+    t.cc[CC::SUPERSAW2_DETUNE]     = { handleSupersaw2Detune,    C::Linear, 0.0f,   1.0f,  P | V };
+    t.cc[CC::SUPERSAW2_MIX]        = { handleSupersaw2Mix,       C::Linear, 0.0f,   1.0f,  P | V };
+    t.cc[CC::OSC1_FREQ_DC]         = { handleOsc1FreqDC,         C::Linear, 0.0f,   DC_PITCH_MAX_SEMITONES * FM_SEMITONE_SCALE, P | V };
+    t.cc[CC::OSC2_FREQ_DC]         = { handleOsc2FreqDC,         C::Linear, 0.0f,   DC_PITCH_MAX_SEMITONES * FM_SEMITONE_SCALE, P | V };
+    t.cc[CC::OSC1_SHAPE_DC]        = { handleOsc1ShapeDC,        C::Linear, 0.0f,   1.0f,  P | V };
+    t.cc[CC::OSC2_SHAPE_DC]        = { handleOsc2ShapeDC,        C::Linear, 0.0f,   1.0f,  P | V };
+    t.cc[CC::RING1_MIX]            = { handleRing1Mix,           C::Linear, 0.0f,   1.0f,  P | V };
+    t.cc[CC::RING2_MIX]            = { handleRing2Mix,           C::Linear, 0.0f,   1.0f,  P | V };
+    t.cc[CC::OSC1_FEEDBACK_AMOUNT] = { handleOsc1FeedbackAmount, C::Linear, 0.0f,   1.0f,  V };
+    t.cc[CC::OSC2_FEEDBACK_AMOUNT] = { handleOsc2FeedbackAmount, C::Linear, 0.0f,   1.0f,  V };
+    t.cc[CC::OSC1_FEEDBACK_MIX]    = { handleOsc1FeedbackMix,    C::Linear, 0.0f,   1.0f,  V };
+    t.cc[CC::OSC2_FEEDBACK_MIX]    = { handleOsc2FeedbackMix,    C::Linear, 0.0f,   1.0f,  V };
+    t.cc[CC::OSC1_ARB_BANK]        = { handleOsc1ArbBank,        C::Raw,    0.0f,   0.0f,  V, LINK_OSC1_ARB };
+    t.cc[CC::OSC2_ARB_BANK]        = { handleOsc2ArbBank,        C::Raw,    0.0f,   0.0f,  V, LINK_OSC2_ARB };
+    t.cc[CC::OSC1_ARB_INDEX]       = { handleOsc1ArbIndex,       C::Raw,    0.0f,   0.0f,  V, LINK_OSC1_ARB };
+    t.cc[CC::OSC2_ARB_INDEX]       = { handleOsc2ArbIndex,       C::Raw,    0.0f,   0.0f,  V, LINK_OSC2_ARB };
+
+    // Filter
+    t.cc[CC::FILTER_CUTOFF]        = { handleFilterCutoff,       C::Cutoff, 0.0f,   0.0f,  P | V };
+    t.cc[CC::FILTER_RESONANCE]     = { handleFilterResonance,    C::Resonance, 0.0f, 0.0f, P | V };
+    t.cc[CC::FILTER_ENV_AMOUNT]    = { handleFilterEnvAmount,    C::Linear, -1.0f,  1.0f,  P | V };
+    t.cc[CC::FILTER_KEY_TRACK]     = { handleFilterKeyTrack,     C::Linear, -1.0f,  1.0f,  P | V };
+    t.cc[CC::FILTER_OCTAVE_CONTROL]= { handleFilterOctaveControl,C::Linear, 0.0f,   10.0f, P | V };
+    t.cc[CC::FILTER_OBXA_MULTIMODE]       = { handleFilterMultimode,    C::Linear, 0.0f, 1.0f, V };
+    t.cc[CC::FILTER_OBXA_TWO_POLE]        = { handleFilterTwoPole,      C::Raw,    0.0f, 0.0f, V };
+    t.cc[CC::FILTER_OBXA_XPANDER_4_POLE]  = { handleFilterXpander4Pole, C::Raw,    0.0f, 0.0f, V };
+    t.cc[CC::FILTER_OBXA_XPANDER_MODE]    = { handleFilterXpanderMode,  C::Raw,    0.0f, 0.0f, V };
+    t.cc[CC::FILTER_OBXA_BP_BLEND_2_POLE] = { handleFilterBPBlend2Pole, C::Raw,    0.0f, 0.0f, V };
+    t.cc[CC::FILTER_OBXA_PUSH_2_POLE]     = { handleFilterPush2Pole,    C::Raw,    0.0f, 0.0f, V };
+    t.cc[CC::FILTER_OBXA_RES_MOD_DEPTH]   = { handleFilterResModDepth,  C::Linear, 0.0f, 1.0f, V };
+
+    // Envelopes
+    t.cc[CC::AMP_ATTACK]           = { handleAmpAttack,          C::Time,   0.0f,   0.0f,  P | V };
+    t.cc[CC::AMP_DECAY]            = { handleAmpDecay,           C::Time,   0.0f,   0.0f,  P | V };
+    t.cc[CC::AMP_SUSTAIN]          = { handleAmpSustain,         C::Linear, 0.0f,   1.0f,  P | V };
+    t.cc[CC::AMP_RELEASE]          = { handleAmpRelease,         C::Time,   0.0f,   0.0f,  P | V };
+    t.cc[CC::FILTER_ENV_ATTACK]    = { handleFilterEnvAttack,    C::Time,   0.0f,   0.0f,  P | V };
+    t.cc[CC::FILTER_ENV_DECAY]     = { handleFilterEnvDecay,     C::Time,   0.0f,   0.0f,  P | V };
+    t.cc[CC::FILTER_ENV_SUSTAIN]   = { handleFilterEnvSustain,   C::Linear, 0.0f,   1.0f,  P | V };
+    t.cc[CC::FILTER_ENV_RELEASE]   = { handleFilterEnvRelease,   C::Time,   0.0f,   0.0f,  P | V };
+    t.cc[CC::PITCH_ENV_ATTACK]     = { handlePitchEnvAttack,     C::Time,   0.0f,   0.0f,  P | V };
+    t.cc[CC::PITCH_ENV_DECAY]      = { handlePitchEnvDecay,      C::Time,   0.0f,   0.0f,  P | V };
+    t.cc[CC::PITCH_ENV_SUSTAIN]    = { handlePitchEnvSustain,    C::Linear, 0.0f,   1.0f,  P | V };
+    t.cc[CC::PITCH_ENV_RELEASE]    = { handlePitchEnvRelease,    C::Time,   0.0f,   0.0f,  P | V };
+    // Bipolar, CC 64 = 0: (v − 64) · 24/64 semitones
+    t.cc[CC::PITCH_ENV_DEPTH]      = { handlePitchEnvDepth,      C::Linear, -24.0f, 23.625f, P | V };
+
+    // LFOs
+    t.cc[1]                        = { handleLFO1Freq,           C::LfoHz,  0.0f,   0.0f,  0, LINK_LFO1_RATE };  // Mod wheel
+    t.cc[CC::LFO1_FREQ]            = { handleLFO1Freq,           C::LfoHz,  0.0f,   0.0f,  P, LINK_LFO1_RATE };
+    t.cc[CC::LFO2_FREQ]            = { handleLFO2Freq,           C::LfoHz,  0.0f,   0.0f,  P };
+    t.cc[CC::LFO1_DEPTH]           = { handleLFO1Depth,          C::Linear, 0.0f,   1.0f,  P | F };
+    t.cc[CC::LFO2_DEPTH]           = { handleLFO2Depth,          C::Linear, 0.0f,   1.0f,  P | F };
+    t.cc[CC::LFO1_DESTINATION]     = { handleLFO1Dest,           C::Raw,    0.0f,   0.0f,  P | F, LINK_LFO1_DEST };
+    t.cc[CC::LFO2_DESTINATION]     = { handleLFO2Dest,           C::Raw,    0.0f,   0.0f,  P | F, LINK_LFO2_DEST };
+    t.cc[CC::LFO1_WAVEFORM]        = { handleLFO1Wave,           C::Raw,    0.0f,   0.0f,  P };
+    t.cc[CC::LFO2_WAVEFORM]        = { handleLFO2Wave,           C::Raw,    0.0f,   0.0f,  P };
+    t.cc[CC::LFO1_PITCH_DEPTH]     = { handleLFO1PitchDepth,     C::Linear, 0.0f,   1.0f,  P | F, LINK_LFO1_DEST };
+    t.cc[CC::LFO1_FILTER_DEPTH]    = { handleLFO1FilterDepth,    C::Linear, 0.0f,   1.0f,  P | F, LINK_LFO1_DEST };
+    t.cc[CC::LFO1_PWM_DEPTH]       = { handleLFO1PWMDepth,       C::Linear, 0.0f,   1.0f,  P | F, LINK_LFO1_DEST };
+    t.cc[CC::LFO1_AMP_DEPTH]       = { handleLFO1AmpDepth,       C::Linear, 0.0f,   1.0f,  P | F, LINK_LFO1_DEST };
+    t.cc[CC::LFO2_PITCH_DEPTH]     = { handleLFO2PitchDepth,     C::Linear, 0.0f,   1.0f,  P | F, LINK_LFO2_DEST };
+    t.cc[CC::LFO2_FILTER_DEPTH]    = { handleLFO2FilterDepth,    C::Linear, 0.0f,   1.0f,  P | F, LINK_LFO2_DEST };
+    t.cc[CC::LFO2_PWM_DEPTH]       = { handleLFO2PWMDepth,       C::Linear, 0.0f,   1.0f,  P | F, LINK_LFO2_DEST };
+    t.cc[CC::LFO2_AMP_DEPTH]       = { handleLFO2AmpDepth,       C::Linear, 0.0f,   1.0f,  P | F, LINK_LFO2_DEST };
+    t.cc[CC::LFO1_DELAY]           = { handleLFO1Delay,          C::Linear, 0.0f,   4000.0f, P | F };
+    t.cc[CC::LFO2_DELAY]           = { handleLFO2Delay,          C::Linear, 0.0f,   4000.0f, P | F };
+    t.cc[CC::LFO1_KEY_SYNC]        = { handleLFO1KeySync,        C::Raw,    0.0f,   0.0f,  P | F };
+    t.cc[CC::LFO2_KEY_SYNC]        = { handleLFO2KeySync,        C::Raw,    0.0f,   0.0f,  P | F };
+    t.cc[CC::LFO1_TIMING_MODE]     = { handleLFO1TimingMode,     C::Raw,    0.0f,   0.0f,  0 };
+    t.cc[CC::LFO2_TIMING_MODE]     = { handleLFO2TimingMode,     C::Raw,    0.0f,   0.0f,  0 };
+
+    // FX
+    t.cc[CC::FX_BASS_GAIN]           = { handleFXBassGain,       C::Linear, -12.0f, 12.0f, P };
+    t.cc[CC::FX_TREBLE_GAIN]         = { handleFXTrebleGain,     C::Linear, -12.0f, 12.0f, P };
+    t.cc[CC::FX_MOD_EFFECT]          = { handleFXModEffect,      C::Raw,    0.0f,   0.0f,  P };
+    t.cc[CC::FX_MOD_MIX]             = { handleFXModMix,         C::Linear, 0.0f,   1.0f,  P };
+    t.cc[CC::FX_MOD_RATE]            = { handleFXModRate,        C::Linear, 0.0f,   20.0f, P };
+    t.cc[CC::FX_MOD_FEEDBACK]        = { handleFXModFeedback,    C::Raw,    0.0f,   0.0f,  P };
+    t.cc[CC::FX_JPFX_DELAY_EFFECT]   = { handleFXDelayEffect,    C::Raw,    0.0f,   0.0f,  P };
+    t.cc[CC::FX_JPFX_DELAY_MIX]      = { handleFXDelayMix,       C::Linear, 0.0f,   1.0f,  P };
+    t.cc[CC::FX_JPFX_DELAY_FEEDBACK] = { handleFXDelayFeedback,  C::Raw,    0.0f,   0.0f,  P };
+    t.cc[CC::FX_JPFX_DELAY_TIME]     = { handleFXDelayTime,      C::Linear, 0.0f,   1500.0f, P };
+    t.cc[CC::DELAY_TIMING_MODE]      = { handleDelayTimingMode,  C::Raw,    0.0f,   0.0f,  0 };
+    t.cc[CC::FX_REVERB_SIZE]         = { handleFXReverbSize,     C::Linear, 0.0f,   1.0f,  0 };
+    t.cc[CC::FX_REVERB_DAMP]         = { handleFXReverbHiDamp,   C::Linear, 0.0f,   1.0f,  0 };
+    t.cc[CC::FX_REVERB_LODAMP]       = { handleFXReverbLoDamp,   C::Linear, 0.0f,   1.0f,  0 };
+    t.cc[CC::FX_REVERB_MIX]          = { handleFXReverbMix,      C::Linear, 0.0f,   1.0f,  0 };
+    t.cc[CC::FX_REVERB_BYPASS]       = { handleFXReverbBypass,   C::Raw,    0.0f,   0.0f,  0 };
+    t.cc[CC::FX_DRY_MIX]             = { handleFXDryMix,         C::Linear, 0.0f,   1.0f,  P };
+    t.cc[CC::FX_JPFX_MIX]            = { handleFXJPFXMix,        C::Linear, 0.0f,   1.0f,  0 };
+
+    // Global
+    t.cc[CC::GLIDE_ENABLE]         = { handleGlideEnable,        C::Raw,    0.0f,   0.0f,  P | V };
+    t.cc[CC::GLIDE_TIME]           = { handleGlideTime,          C::Time,   0.0f,   0.0f,  P | V };
+    t.cc[CC::AMP_MOD_FIXED_LEVEL]  = { handleAmpModFixed,        C::Linear, 0.0f,   1.0f,  P };
+    t.cc[CC::PITCH_BEND_RANGE]     = { handlePitchBendRange,     C::Linear, 0.0f,   PITCH_BEND_MAX_SEMITONES, 0 };
+    t.cc[CC::VELOCITY_AMP_SENS]    = { handleVelocityAmpSens,    C::Linear, 0.0f,   1.0f,  P | V };
+    t.cc[CC::VELOCITY_FILTER_SENS] = { handleVelocityFilterSens, C::Linear, 0.0f,   1.0f,  P | V };
+    t.cc[CC::VELOCITY_ENV_SENS]    = { handleVelocityEnvSens,    C::Linear, 0.0f,   1.0f,  P | V };
+
+    // BPM clock
+    t.cc[CC::BPM_CLOCK_SOURCE]     = { handleBPMClockSource,     C::Raw,    0.0f,   0.0f,  0 };
+    t.cc[CC::BPM_INTERNAL_TEMPO]   = { handleBPMInternalTempo,   C::Linear, 40.0f,  300.0f, 0 };
+    t.cc[CC::BPM_TRANSPORT]        = { handleBPMTransport,       C::Raw,    0.0f,   0.0f,  ALWAYS };
+
+    return t;
+}
+
+// Every PatchSchema CC is flagged PATCH and every PATCH CC is in PatchSchema
+constexpr bool inPatchSchema(uint8_t cc) {
+    return PatchSchema::kIndex.slotOf[cc] != PatchSchema::kNoSlot;
+}
+constexpr bool patchFlagsMatchSchema(const Table& t) {
+    for (int cc = 0; cc < 128; ++cc) {
+        if (((t.cc[cc].flags & PATCH) != 0) != inPatchSchema((uint8_t)cc)) return false;
+    }
+    return true;
+}
+
+Stats s_stats;
+
+inline uint32_t cycleCount() {
+#if defined(__IMXRT1062__)
+    return ARM_DWT_CYCCNT;
+#else
+    return 0;
+#endif
+}
+
+} // namespace
+
+extern const Table kTable;
+constexpr Table kTable = build();
+
+static_assert(patchFlagsMatchSchema(kTable), "CCDispatch PATCH flags disagree with PatchSchema::kPatchableCCs");
+
+// Every CC that CCDefs names has a descriptor at that number.  The old
+// positional table lost an entry and shifted every handler from OSC1_WAVE
+// up by one; keyed assignment can't do that, and this catches a descriptor
+// that goes missing or lands on the wrong constant.  The legacy FX_DELAY_*
+// CCs are named but not handled; HIRES_LSB is consumed before the table.
+constexpr bool namedButUnhandled(uint8_t cc) {
+    return cc == CC::HIRES_LSB
+        || cc == CC::FX_DELAY_TIME     || cc == CC::FX_DELAY_FEEDBACK
+        || cc == CC::FX_DELAY_MOD_RATE || cc == CC::FX_DELAY_MOD_DEPTH
+        || cc == CC::FX_DELAY_INERTIA  || cc == CC::FX_DELAY_TREBLE;
+}
+constexpr bool namedCCsHandled(const Table& t) {
+    for (int cc = 0; cc < 128; ++cc) {
+        if (CC::name((uint8_t)cc) && !t.cc[cc].fn && !namedButUnhandled((uint8_t)cc)) return false;
+    }
+    return true;
+}
+static_assert(namedCCsHandled(kTable), "A CC named in CCDefs.h has no CCDispatch descriptor");
+
+// =============================================================================
+// DISPATCH
+// =============================================================================
+
+void apply(SynthEngine& synth, uint8_t cc, uint8_t v, uint16_t v14, bool hires) {
+    const Descriptor& d = kTable.cc[cc & 0x7F];
+    if (!d.fn) {
+        JT_LOGF("[CC %u] unmapped (val=%u)\n", cc, v);
+        return;
+    }
+
+    const uint32_t t0 = cycleCount();
+
+    // 7-bit values read the precomputed Mapping.h tables; only 14-bit input
+    // evaluates the curve.
+    const float n = hires ? v14 * (1.0f / 16383.0f) : v / 127.0f;
+    float x;
+    switch (d.curve) {
+        case Curve::Linear:    x = d.lo + (d.hi - d.lo) * n; break;
+        case Curve::Time:      x = hires ? JT4000Map::norm_to_time_ms(n)
+                                         : JT4000Map::cc_to_time_ms(v); break;
+        case Curve::Cutoff:    x = hires ? JT4000Map::norm_to_obxa_cutoff_hz(n)
+                                         : JT4000Map::cc_to_obxa_cutoff_hz(v); break;
+        case Curve::Resonance: x = JT4000Map::norm_to_obxa_res01(n); break;
+        case Curve::LfoHz:     x = hires ? JT4000Map::norm_to_lfo_hz(n)
+                                         : JT4000Map::cc_to_lfo_hz(v); break;
+        default:               x = v; break;
+    }
+    d.fn(synth, x, v);
+
+    s_stats.cycles[cc & 0x7F] += cycleCount() - t0;
+    s_stats.calls[cc & 0x7F]++;
+    s_stats.applied++;
+    if (hires) s_stats.hires++;
+    if (d.flags & FANOUT) s_stats.voiceWrites += MAX_VOICES;
+
+    const char* name = CC::name(cc);
+    JT_LOGF("[CC %u:%s] %.4f%s\n", cc, name ? name : "?", x, hires ? " (14-bit)" : "");
+}
+
+const Stats& stats() { return s_stats; }
+void resetStats()    { s_stats = Stats(); }
+
+void noteReceived(uint8_t cc, bool suppressed) {
+    s_stats.received++;
+    if (!suppressed) return;
+    s_stats.suppressed++;
+    if (kTable.cc[cc & 0x7F].flags & FANOUT) s_stats.voiceSaved += MAX_VOICES;
+}
+
+void report() {
+    JT_LOGF("[CCDISPATCH] received %lu, applied %lu, suppressed %lu, 14-bit %lu, voice writes %lu (saved %lu)\n",
+            (unsigned long)s_stats.received, (unsigned long)s_stats.applied,
+            (unsigned long)s_stats.suppressed, (unsigned long)s_stats.hires,
+            (unsigned long)s_stats.voiceWrites, (unsigned long)s_stats.voiceSaved);
+    for (uint8_t cc = 0; cc < 128; ++cc) {
+        const uint32_t calls = s_stats.calls[cc];
+        if (!calls) continue;
+        const char* name = CC::name(cc);
+        JT_LOGF("[CCDISPATCH] CC %3u %-12s %6lu calls, %6lu cycles/call\n",
+                cc, name ? name : "?", (unsigned long)calls,
+                (unsigned long)(s_stats.cycles[cc] / calls));
+    }
+}
+
+} // namespace CCDispatch
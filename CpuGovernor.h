@@ -0,0 +1,89 @@
+#pragma once
+#include <Arduino.h>
+
+// ============================================================================
+// CPU GOVERNOR — load shedding with hysteresis
+// ============================================================================
+// SynthEngine::update() feeds AudioProcessorUsage() to sample() and the
+// governor keeps the peak over each window.  A window peak above
+// CPU_GOV_HIGH_PCT steps one degradation level down; CPU_GOV_RESTORE_MS of
+// windows below CPU_GOV_LOW_PCT steps one back.
+// Levels (cumulative, cheapest-to-hear first):
+//   1  JPFX mod LFO evaluated every CPU_GOV_MOD_DECIMATION samples
+//   2  Supersaw oversampling off (BLEP-table path instead)
+//   3  Reverb shed (bypassed, wet muted)
+//   4  Voices capped at 3/4 of MAX_VOICES (oldest released, not cut)
+//   5  Voices capped at 1/2 of MAX_VOICES
+// A level whose feature is already off in the current patch (mod effect
+// off, oversampling off, reverb bypassed or at zero mix) would save
+// nothing, so the step passes over it in either direction: the next
+// window then sees a step that actually changed the load.
+// ============================================================================
+#define CPU_GOV_WINDOW_MS        250
+#define CPU_GOV_HIGH_PCT         85.0f
+#define CPU_GOV_LOW_PCT          65.0f
+#define CPU_GOV_RESTORE_MS       3000
+#define CPU_GOV_MOD_DECIMATION   8
+#define CPU_GOV_MAX_LEVEL        5
+
+class CpuGovernor {
+public:
+    // 'sheds' bit n set: level n changes something in the current patch
+    // (levels 4 and 5 always do).  Returns true when the level changed.
+    bool sample(float cpu, uint32_t nowMs, uint8_t sheds) {
+        if (cpu > _windowPeak) _windowPeak = cpu;
+        if ((nowMs - _windowStartMs) < CPU_GOV_WINDOW_MS) return false;
+        _lastPeak      = _windowPeak;
+        _windowPeak    = 0.0f;
+        _windowStartMs = nowMs;
+
+        sheds |= (1u << 4) | (1u << 5);
+        uint8_t level = _level;
+        if (_lastPeak > CPU_GOV_HIGH_PCT) {
+            // Overloaded: one effective step per window, so the next window
+            // sees the effect
+            _calm = false;
+            while (level < CPU_GOV_MAX_LEVEL) {
+                if (sheds & (1u << ++level)) break;
+            }
+        } else if (_lastPeak < CPU_GOV_LOW_PCT) {
+            // Headroom: restore one effective step after a sustained calm run
+            if (!_calm) {
+                _calm        = true;
+                _calmSinceMs = nowMs;
+            } else if (level > 0 && (nowMs - _calmSinceMs) >= CPU_GOV_RESTORE_MS) {
+                while (--level > 0 && !(sheds & (1u << level))) {}
+                _calmSinceMs = nowMs;
+            }
+        } else {
+            _calm = false;   // Inside the hysteresis band: hold
+        }
+
+        if (level == _level) return false;
+        _level = level;
+        return true;
+    }
+
+    // Forget the open window and calm run (level kept)
+    void restartWindow() {
+        _windowPeak = 0.0f;
+        _calm       = false;
+    }
+
+    // Back to full quality
+    void reset() {
+        _level = 0;
+        restartWindow();
+    }
+
+    uint8_t level() const    { return _level; }
+    float   lastPeak() const { return _lastPeak; }   // Peak of the window just closed
+
+private:
+    uint8_t  _level         = 0;
+    float    _windowPeak    = 0.0f;
+    float    _lastPeak      = 0.0f;
+    uint32_t _windowStartMs = 0;
+    uint32_t _calmSinceMs   = 0;   // Start of the current below-LOW run
+    bool     _calm          = false;
+};
@@ -27,7 +27,7 @@ public:
     float getDecayTime() const { return _decayTime; }
     float getSustainLevel() const { return _sustainLevel; }
     float getReleaseTime() const { return _releaseTime; }
-    //bool isIdle() const { return _envelope.isActive() == false; }
+    bool isIdle() { return !_envelope.isActive(); }
 
 
 private:
@@ -273,6 +273,16 @@ bool FXChainBlock::getReverbBypass() const {
     return _reverbManualBypass;
 }
 
+void FXChainBlock::setReverbLoadShed(bool shed) {
+    if (shed == _reverbLoadShed) return;
+    _reverbLoadShed = shed;
+
+    // Mute the wet channel too: a bypassed plate passes its input through
+    _mixerOutL.gain(2, shed ? 0.0f : _reverbMixL);
+    _mixerOutR.gain(2, shed ? 0.0f : _reverbMixR);
+    updateReverbBypass();
+}
+
 // ============================================================================
 // MIX CONTROLS
 // ============================================================================
@@ -299,9 +309,9 @@ void FXChainBlock::setReverbMix(float left, float right) {
     _reverbMixL = left;
     _reverbMixR = right;
     
-    // Update mixer gains (channel 2 = reverb wet)
-    _mixerOutL.gain(2, left);
-    _mixerOutR.gain(2, right);
+    // Update mixer gains (channel 2 = reverb wet; held at 0 while shed)
+    _mixerOutL.gain(2, _reverbLoadShed ? 0.0f : left);
+    _mixerOutR.gain(2, _reverbLoadShed ? 0.0f : right);
     
     // CPU OPTIMIZATION: Update reverb bypass state
     updateReverbBypass();
@@ -336,6 +346,7 @@ float FXChainBlock::getReverbMixR() const { return _reverbMixR; }
 void FXChainBlock::updateReverbBypass() {
     // Check if reverb is needed
     bool reverbNeeded = !_reverbManualBypass &&          // Not manually bypassed
+                        !_reverbLoadShed &&              // Not shed by the CPU governor
                        (_reverbMixL > 0.001f ||          // Left mix > 0
                         _reverbMixR > 0.001f);           // Right mix > 0
     
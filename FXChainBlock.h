@@ -56,6 +56,8 @@ public:
     float getModRate() const;
     float getModFeedback() const;
     const char* getModEffectName() const;
+    // Mod LFO resolution (CPU governor): LFO evaluated every N samples
+    void setModLfoDecimation(uint8_t samples) { _jpfx.setModLfoDecimation(samples); }
 
     // ADD to public methods:
     void updateFromBPMClock(const BPMClockManager& bpmClock);
@@ -88,6 +90,16 @@ public:
     void setReverbBypass(bool bypass);       // Manual bypass override
     bool getReverbBypass() const;
 
+    // Load shedding (CPU governor): reverb bypassed and its wet channel
+    // muted, independent of the user mix and manual bypass
+    void setReverbLoadShed(bool shed);
+    bool getReverbLoadShed() const { return _reverbLoadShed; }
+
+    // Reverb would run if not shed (not bypassed, some wet mix)
+    bool reverbWanted() const {
+        return !_reverbManualBypass && (_reverbMixL > 0.001f || _reverbMixR > 0.001f);
+    }
+
     // =========================================================================
     // MIX CONTROLS (dry + JPFX + reverb)
     // =========================================================================
@@ -167,6 +179,7 @@ private:
     float _reverbHiDamp = 0.5f;    // 0..1
     float _reverbLoDamp = 0.5f;    // 0..1
     bool _reverbManualBypass = false;  // Manual bypass override
+    bool _reverbLoadShed = false;      // CPU governor override
     
     // Mix levels
     float _dryMixL = 1.0f;      // Dry left gain
@@ -109,4 +109,4 @@ float FilterBlock::getKeyTrackAmount() const { return _keyTrackAmount; }
 AudioStream& FilterBlock::input() { return _filter; }
 AudioStream& FilterBlock::output() { return _filter; }
 AudioStream& FilterBlock::envmod() { return _envModDc; };
-AudioMixer4& FilterBlock::modMixer() { return _modMixer; }
+AudioMixer4Q15& FilterBlock::modMixer() { return _modMixer; }
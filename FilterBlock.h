@@ -1,6 +1,7 @@
 #pragma once
 #include <Audio.h>
 #include "AudioFilterOBXa_OBXf.h"
+#include "AudioMixer4Q15.h"
 
 
 class FilterBlock {
@@ -61,14 +62,24 @@ public:
     void setEnvValue(float env01);   // 0..1 (latest envelope sample)
     float getEnvValue() const { return _envValue; }
 
+    // Block kernel picked for the current topology (see AudioFilterOBXa)
+    uint8_t kernelFeatures() const { return _filter.kernelFeatures(); }
+    const char* kernelName() const { return _filter.kernelName(); }
+
+    // Voice sources are summed in float inside the filter (see
+    // AudioFilterOBXa input mixer): connect source 'src' to input() port
+    // inputPort(src) and set its level with setInputGain().
+    void setInputGain(uint8_t src, float gain) { _filter.mixGain(src, gain); }
+    static constexpr uint8_t inputPort(uint8_t src) { return AudioFilterOBXa::mixInputPort(src); }
+
     AudioStream& input();
     AudioStream& output();
     AudioStream& envmod();
-    AudioMixer4& modMixer();
+    AudioMixer4Q15& modMixer();
 
 private:
     AudioFilterOBXa _filter;
-    AudioMixer4 _modMixer;
+    AudioMixer4Q15 _modMixer;
     AudioSynthWaveformDc _envModDc; // going to patch this to the input of the Filter envelope
     AudioSynthWaveformDc _keyTrackDc;
 
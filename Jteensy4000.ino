@@ -2,7 +2,7 @@
  * Jteensy4000.ino — JT-4000 polyphonic synthesizer  (v6)
  *
  * Audio path:
- *   SynthEngine (8 voices) → FXChainBlock → mixerI2S{L/R} → I2S → PCM5102A
+ *   SynthEngine (JT_POLYPHONY voices) → FXChainBlock → mixerI2S{L/R} → I2S → PCM5102A
  *                                         → scopeTap      (waveform capture)
  *                                         → ampUSB{L/R}   → usbOut (DAW monitor)
  *
@@ -57,6 +57,9 @@
 #include "Presets.h"
 #include "AudioScopeTap.h"
 #include "BPMClockManager.h"
+#include "MIDIClockMaster.h"
+#include "WavFileLoader.h"
+#include "WaveSysEx.h"
 
 // ---------------------------------------------------------------------------
 // PCM5102A mute pin — wire to XSMT on DAC board
@@ -100,6 +103,7 @@ AudioOutputI2S  i2sOut;    // I2S1: BCK=21, LRCK=20, DATA=7 → PCM5102A
 AudioInputUSB   usbIn;     // USB audio in  (DAW loopback)
 AudioOutputUSB  usbOut;    // USB audio out (DAW monitor)
 AudioScopeTap   scopeTap;  // Waveform capture for home screen scope
+MIDIClockMaster clockOut;  // Internal 24-PPQN clock, ticks counted off the audio blocks
 
 // Post-FX signal split: one copy goes to I2S (hardware), one to USB (DAW)
 AudioMixer4    mixerI2SL;
@@ -119,6 +123,7 @@ AudioConnection* patchAmpUSBR   = nullptr;
 AudioConnection* patchOutUSBL   = nullptr;
 AudioConnection* patchOutUSBR   = nullptr;
 AudioConnection* patchOutScope  = nullptr;
+AudioConnection* patchClockOut  = nullptr;
 
 // ---------------------------------------------------------------------------
 // Core objects
@@ -127,6 +132,8 @@ SynthEngine                  synth;
 HardwareInterface_MicroDexed hw;
 UIManager_TFT                ui;
 BPMClockManager              bpmClock;
+WavFileLoader                waveLoader;   // SD single-cycle WAVs → user wavetable banks
+WaveSysEx                    waveSysEx;    // SysEx wavetable uploads → "SysEx" bank slots
 
 // ---------------------------------------------------------------------------
 // USB Host MIDI  (keyboard → Teensy USB-A host port)
@@ -221,6 +228,24 @@ static void onPitchBend(byte channel, int value) {
     JT_LOGF("[MIDI] PitchBend ch%u val=%d\n", (unsigned)channel, value);
 }
 
+// SysEx wavetable upload (USB device only: DIN is far too slow for it).
+// usbMIDI hands over partial messages as they arrive; WaveSysEx decodes each
+// piece straight away and answers every command with an ACK/NAK SysEx.
+static void onSysEx(const uint8_t* data, uint16_t length, bool last) {
+    waveSysEx.feed(data, length, last);
+}
+
+// Replies are queued on clockOut: its timer ISR is the only usbMIDI writer,
+// so an ACK can't be preempted mid-packet by a clock byte.
+static void sendSysExReply(const uint8_t* msg, uint16_t len) {
+    clockOut.sendSysEx(msg, len);
+}
+
+static void onWaveStored(ArbBank bank, uint16_t slot) {
+    synth.reloadArbTable(bank, slot);
+    midiLog("SYSEX", "Wave", (uint8_t)bank, (uint8_t)slot);
+}
+
 // Real-time clock messages — forwarded to BPMClockManager only (no logging —
 // these fire up to 24× per beat and would flood the ring).
 static void onMIDIClock()    { bpmClock.handleMIDIClock();    }
@@ -228,6 +253,15 @@ static void onMIDIStart()    { bpmClock.handleMIDIStart();    midiLog("MIDI","St
 static void onMIDIStop()     { bpmClock.handleMIDIStop();     midiLog("MIDI","Stop",0,0);  }
 static void onMIDIContinue() { bpmClock.handleMIDIContinue(); midiLog("MIDI","Cont",0,0);  }
 
+// DIN clock: the MIDI library parses bytes in loop(), so by the time this
+// fires the clock byte may have waited behind a UI repaint.  Every byte still
+// queued in the Serial1 FIFO arrived after it, 320 µs apart at 31250 baud —
+// backing those out recovers the wire arrival time to within one byte.
+static constexpr uint32_t DIN_BYTE_US = 320;
+static void onDINClock() {
+    bpmClock.handleMIDIClock(micros() - (uint32_t)Serial1.available() * DIN_BYTE_US);
+}
+
 /** USB Host real-time byte dispatcher (USBHost_t36 API). */
 static void onUSBHostRealTime(uint8_t byte) {
     switch (byte) {
@@ -266,9 +300,12 @@ void setup() {
 
     // -------------------------------------------------------------------------
     // STEP 2: Audio memory pool.
-    // 200 blocks = 51200 bytes DMAMEM.  256 was marginal under heavy SPI.
+    // 216 blocks = 55296 bytes DMAMEM at 8 voices (scales with JT_POLYPHONY).
+    // 256 was marginal under heavy SPI.
     // -------------------------------------------------------------------------
-    AudioMemory(200);
+    AudioMemory(AUDIO_MEMORY_BLOCKS);
+    Serial.printf("[JT4000] %u voices, %u audio blocks\n",
+                  (unsigned)MAX_VOICES, (unsigned)AUDIO_MEMORY_BLOCKS);
 
     // -------------------------------------------------------------------------
     // STEP 3: USB Host MIDI  (keyboard on host port)
@@ -291,6 +328,8 @@ void setup() {
     usbMIDI.setHandleControlChange(onCC);
     usbMIDI.setHandlePitchChange(onPitchBend);    // pitch wheel
     usbMIDI.setHandleRealTimeSystem(onUSBHostRealTime);
+    usbMIDI.setHandleSystemExclusive(onSysEx);
+    waveSysEx.begin(sendSysExReply, onWaveStored);
 
     Serial.println("[JT4000] USB Device MIDI configured");
 
@@ -302,7 +341,7 @@ void setup() {
     midi1.setHandleNoteOff(onNoteOff);
     midi1.setHandleControlChange(onCC);
     midi1.setHandlePitchBend(onPitchBend);        // pitch wheel (MIDI lib uses different name)
-    midi1.setHandleClock(onMIDIClock);
+    midi1.setHandleClock(onDINClock);             // arrival-corrected stamp
     midi1.setHandleStart(onMIDIStart);
     midi1.setHandleStop(onMIDIStop);
     midi1.setHandleContinue(onMIDIContinue);
@@ -313,6 +352,7 @@ void setup() {
     // -------------------------------------------------------------------------
     // STEP 6: Hardware encoders + synth engine
     // -------------------------------------------------------------------------
+    JT4000Map::buildCurveTables();   // CC curve tables, before the first CC
     hw.begin();
     ui.begin(synth);
     synth.setNotifier(onCCHandled);
@@ -335,6 +375,11 @@ void setup() {
     // -------------------------------------------------------------------------
     // STEP 8: BPM clock
     // -------------------------------------------------------------------------
+    // clockOut sends 0xF8/0xFA/0xFC on DIN + USB (and queued SysEx replies)
+    // from its own timer; it also becomes the internal timebase so synced
+    // LFOs/delay match the clock out.
+    clockOut.begin(&Serial1, true);
+    bpmClock.setInternalTimebase(&clockOut);
     bpmClock.setInternalBPM(120.0f);
     bpmClock.setClockSource(CLOCK_INTERNAL);
     synth.setBPMClock(&bpmClock);
@@ -353,6 +398,7 @@ void setup() {
     patchOutUSBL   = new AudioConnection(ampUSBL, 0, usbOut, 0);
     patchOutUSBR   = new AudioConnection(ampUSBR, 0, usbOut, 1);
     patchOutScope  = new AudioConnection(synth.getFXOutL(), 0, scopeTap, 0);
+    patchClockOut  = new AudioConnection(synth.getFXOutL(), 0, clockOut, 0);  // block tick only
 
     // Gain settings
     mixerI2SL.gain(0, 1.0f);   // Synth → I2S L
@@ -362,6 +408,16 @@ void setup() {
     ampUSBL.gain(0.7f);         // USB output trim
     ampUSBR.gain(0.7f);
 
+    // -------------------------------------------------------------------------
+    // STEP 10: User wavetables from SD (/WAVES/<bank>/*.wav).  Loading runs
+    // in slices from loop(); banks appear after the AKWF banks as they land.
+    // -------------------------------------------------------------------------
+    if (SD.begin(BUILTIN_SDCARD)) {
+        waveLoader.begin("/WAVES");
+    } else {
+        Serial.println("[JT4000] No SD card, built-in wavetables only");
+    }
+
     Serial.println("[JT4000] Ready");
 }
 
@@ -372,7 +428,8 @@ void setup() {
 //   1. Service all MIDI sources FIRST — highest priority, smallest latency.
 //   2. USB host task (required by USBHost_t36 every iteration).
 //   3. Drain serial MIDI log (non-blocking, safe here).
-//   4. Synth update (voice management, envelope clocking).
+//   4. Synth update (voice management, envelope clocking), then one slice of
+//      SD wavetable loading (one sector read or resample slice, if busy).
 //   5. Hardware poll (encoders, buttons) — feeds UI.
 //   6. UI input poll (touch + encoders → screen actions).
 //   7. UI display update (rate-limited inside UIManager to ~30 fps).
@@ -407,6 +464,10 @@ void loop() {
 
     // Synth update: voice management, LFO, etc.
     synth.update();
+    waveLoader.poll();
+
+    // Clock out: send-timer gating + periodic jitter report
+    clockOut.poll();
 
     // Encoder + button poll
     hw.update();
@@ -1,4 +1,5 @@
 #include "LFOBlock.h"
+#include "AudioDormancy.h"
 
 
 // --- Lifecycle
@@ -11,6 +12,25 @@ LFOBlock::LFOBlock() {
     _lfo.frequency(5);
     _lfo.pulseWidth(0.5);
     _enabled = false;
+
+    // Waveform → fade stage.  The global amp destination patches from
+    // output() (the fade stage); voices patch rawOutput() into their own
+    // AudioEffectVoiceLFO stages.
+    _patchLfoToFade = new AudioConnection(_lfo, 0, _fade, 0);
+}
+
+void LFOBlock::setDelayTime(float ms) {
+    _delayMs = (ms > 0.0f) ? ms : 0.0f;
+    _fade.setDelayMs(_delayMs);
+}
+
+void LFOBlock::retrigger() {
+    if (_delayMs > 0.0f) _fade.retrigger();
+}
+
+void LFOBlock::setFadeActive(bool on) {
+    AudioDormancy::link(_patchLfoToFade, _fadeLinked, on);
+    AudioDormancy::setActive(_fade, on);
 }
 
 // ADD new method implementation:
@@ -18,7 +38,8 @@ void LFOBlock::setTimingMode(TimingMode mode) {
     _timingMode = mode;
     
     if (mode == TIMING_FREE) {
-        // Restore free-running frequency
+        // Restore free-running frequency and detach from the clock
+        _lfo.lockToClock(nullptr, 0);
         setFrequency(_freeRunningFreq);
     }
     // When switching to BPM mode, frequency will be updated by
@@ -36,6 +57,15 @@ void LFOBlock::updateFromBPMClock(const BPMClockManager& bpmClock) {
     }
 }
 
+void LFOBlock::syncToClock(const BPMClockManager& bpmClock) {
+    if (_timingMode == TIMING_FREE) return;
+
+    const uint32_t ticksPerCycle = bpmClock.getTicksForMode(_timingMode);
+    if (ticksPerCycle == 0) return;
+
+    _lfo.lockToClock(&bpmClock, ticksPerCycle);
+}
+
 // MODIFY setFrequency (line 40):
 void LFOBlock::setFrequency(float hz) {
     _freeRunningFreq = hz;  // Always store for mode switching
@@ -45,7 +75,7 @@ void LFOBlock::setFrequency(float hz) {
         _freq = hz;
         _lfo.frequency(hz);
     }
-    // BPM-sync mode: frequency is managed by updateFromBPMClock() each frame
+    // BPM-sync mode: frequency is managed by updateFromBPMClock() on tempo change
 }
 
 void LFOBlock::update() {    
@@ -116,6 +146,10 @@ float LFOBlock::getAmplitude() const {
 }
 
 AudioStream& LFOBlock::output(){ 
+    return _fade;
+}
+
+AudioStream& LFOBlock::rawOutput(){
     return _lfo;
 }
 
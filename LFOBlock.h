@@ -1,8 +1,10 @@
 #pragma once
 #include <Arduino.h>
 #include <Audio.h>
+#include "AudioSynthLFO.h"   // Control-rate waveform source
 #include "Waveforms.h"  // ✅ use the same waveform IDs & names as main osc
 #include "BPMClockManager.h"  // For tempo sync
+#include "AudioEffectLFOFade.h"  // Sample-counted delay / fade-in stage
 
 enum LFODestination {
     LFO_DEST_NONE = 0,
@@ -69,7 +71,39 @@ public:
      */
     void updateFromBPMClock(const BPMClockManager& bpmClock);
 
+    /**
+     * @brief Lock phase to the clock's song position (synced modes only)
+     *
+     * Phase = fractional number of LFO cycles since Start, so the LFO
+     * restarts on MIDI Start and lands on the same point of its cycle on
+     * every bar line.  Evaluated by the audio update every block.
+     */
+    void syncToClock(const BPMClockManager& bpmClock);
+
+    /**
+     * @brief Set the fade-in time applied after each retrigger()
+     * @param ms Ramp length in milliseconds (0 = no delay)
+     */
+    void setDelayTime(float ms);
+
+    /**
+     * @brief Restart the fade-in ramp on output() (called on noteOn)
+     *
+     * The ramp itself is sample-counted inside the audio update.  Only the
+     * global amp destination listens to output(); per-voice destinations
+     * patch rawOutput() into each voice's AudioEffectVoiceLFO stage, which
+     * runs that voice's own ramp.
+     */
+    void retrigger();
+    float getDelayTime() const { return _delayMs; }
 
+    /**
+     * @brief Park or wake the fade stage behind output()
+     *
+     * Only the global amp-mod mixer listens to output(); SynthEngine parks
+     * the stage while that LFO has no amp depth (see AudioDormancy.h).
+     */
+    void setFadeActive(bool on);
 
 
     // --- Parameter Getters
@@ -78,7 +112,11 @@ public:
     int getWaveform() const;
     LFODestination getDestination() const;
     // --- Outputs
-    AudioStream& output();
+    AudioStream& output();      // Faded by the shared delay ramp (amp destination)
+    AudioStream& rawOutput();   // Unfaded; voices apply their own delay ramp
+
+    // Shared generator, followed by key-synced voice stages
+    const AudioSynthLFO& generator() const { return _lfo; }
 
 private:
     int _type = 0;
@@ -91,7 +129,11 @@ private:
     bool _enabled = false;
     TimingMode _timingMode = TIMING_FREE;  // Default: free-running Hz
     float _freeRunningFreq = 1.0f;         // Stored Hz when in free mode
-    AudioSynthWaveform _lfo;
+    float _delayMs = 0.0f;                 // Fade-in time after retrigger()
+    AudioSynthLFO      _lfo;
+    AudioEffectLFOFade _fade;              // Delay ramp; this is the block output
+    AudioConnection*   _patchLfoToFade = nullptr;
+    bool               _fadeLinked     = true;
     LFODestination _destination = LFO_DEST_NONE;
     // Preserve the current phase when muting/unmuting.  AudioSynthWaveform
     // stores its phase in a private accumulator, so we approximate
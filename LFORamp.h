@@ -0,0 +1,58 @@
+#pragma once
+#include <stdint.h>
+#include <AudioStream.h>
+
+// ============================================================================
+// LFORamp: the sample-counted LFO delay / fade-in ramp
+// ----------------------------------------------------------------------------
+// Shared by AudioEffectLFOFade (the global LFO) and AudioEffectVoiceLFO (each
+// voice's copy).  A linear 0 → 1 gain over 'len' samples; the owner keeps
+// the length (control side) and the position (audio ISR) and passes them in,
+// so both stages count and shape the ramp identically.
+// ============================================================================
+
+namespace LFORamp {
+
+// Ramp length in samples for a delay in milliseconds; 0 = no ramp
+inline uint32_t lengthFromMs(float ms) {
+    if (ms <= 0.0f) return 0;
+    const float n = ms * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f);
+    return (n >= 1.0f) ? (uint32_t)n : 1u;
+}
+
+// True while the ramp is still rising
+inline bool isRamping(uint32_t pos, uint32_t len) { return pos < len; }
+
+// Gain at 'pos' samples into the ramp, 1 once it has finished
+inline float level(uint32_t pos, uint32_t len) {
+    return (pos < len) ? (float)pos / (float)len : 1.0f;
+}
+
+// 'pos' moved on by 'n' samples, stopping at the end of the ramp
+inline uint32_t advance(uint32_t pos, uint32_t len, uint32_t n) {
+    if (pos >= len) return pos;
+    return (len - pos > n) ? pos + n : len;
+}
+
+// One block through the ramp from 'pos': dst = src × gain, samples past the
+// end copied as they are.  Returns the position after the block.
+inline uint32_t apply(const int16_t* src, int16_t* dst, uint32_t pos, uint32_t len) {
+    // Q32 gain, stepped once per sample: a Q16 step would truncate to 0 for
+    // ramps over 65536 samples (1.5 s; LFO delays go to 4 s).  The top 16
+    // bits (at most 65536 while ramping) scale the sample.
+    const uint64_t step = (1ull << 32) / len;
+    uint64_t gain = ((uint64_t)pos << 32) / len;
+
+    for (uint16_t i = 0; i < AUDIO_BLOCK_SAMPLES; ++i) {
+        if (pos < len) {
+            dst[i] = (int16_t)(((int32_t)src[i] * (int32_t)(gain >> 16)) >> 16);
+            gain += step;
+            ++pos;
+        } else {
+            dst[i] = src[i];
+        }
+    }
+    return pos;
+}
+
+} // namespace LFORamp
@@ -0,0 +1,217 @@
+#include "MIDIClockMaster.h"
+#include "DebugTrace.h"
+
+MIDIClockMaster* MIDIClockMaster::_instance = nullptr;
+
+// ═════════════════════════════════════════════════════════════════
+// Constructor / setup
+// ═════════════════════════════════════════════════════════════════
+
+MIDIClockMaster::MIDIClockMaster()
+    : AudioStream(1, _inputQueue)
+    , _samplesPerBeat(AUDIO_SAMPLE_RATE_EXACT * 60.0 / 120.0)
+{
+}
+
+void MIDIClockMaster::begin(HardwareSerial* din, bool usbOut) {
+    _din      = din;
+    _usbOut   = usbOut;
+    _instance = this;
+}
+
+// ═════════════════════════════════════════════════════════════════
+// Transport (loop side)
+// ═════════════════════════════════════════════════════════════════
+
+void MIDIClockMaster::setBPM(float bpm) {
+    bpm = constrain(bpm, 40.0f, 300.0f);
+    _samplesPerBeat = (double)AUDIO_SAMPLE_RATE_EXACT * 60.0 / (double)bpm;
+}
+
+void MIDIClockMaster::start() {
+    _startRequest = true;   // Picked up at the next block boundary
+}
+
+void MIDIClockMaster::stop() {
+    _stopRequest = true;
+}
+
+bool MIDIClockMaster::sendSysEx(const uint8_t* msg, uint16_t len) {
+    const uint8_t next = (_sxWrite + 1) & (MIDI_CLOCK_SYSEX_SLOTS - 1);
+    if (len > MIDI_CLOCK_SYSEX_MAX || next == _sxRead) { _statDropped++; return false; }
+    SysEx& m = _sysex[_sxWrite];
+    memcpy(m.data, msg, len);
+    m.len = (uint8_t)len;
+    _sxWrite = next;   // written last: the ISR reads the slot only after this
+    _gateTimer();      // Don't wait for the next poll()
+    return true;
+}
+
+void MIDIClockMaster::getPosition(uint32_t& us, uint32_t& tick, float& frac, float& ticksPerUs) const {
+    __disable_irq();
+    us = _posUs;
+    const double ticks = _posBeat * MIDI_CLOCK_PPQN;
+    const double spb   = _samplesPerBeat;
+    __enable_irq();
+    const double whole = floor(ticks);
+    tick = (uint32_t)whole;
+    frac = (float)(ticks - whole);
+    ticksPerUs = (float)(AUDIO_SAMPLE_RATE_EXACT * MIDI_CLOCK_PPQN / (spb * 1000000.0));
+}
+
+// ═════════════════════════════════════════════════════════════════
+// Audio update — schedule ticks to the sample
+// ═════════════════════════════════════════════════════════════════
+
+void MIDIClockMaster::update(void) {
+    // Input is only patched so the library runs us every block
+    audio_block_t* block = receiveReadOnly(0);
+    if (block) release(block);
+
+    _schedule(micros() + MIDI_CLOCK_OUT_LEAD_US);
+}
+
+// One block's worth of transport: 'baseUs' is when the block's first
+// sample is heard.  Everything here is counted in samples; baseUs only
+// stamps the queued events, so the tick grid never drifts with micros().
+void MIDIClockMaster::_schedule(uint32_t baseUs) {
+    const double   spb         = _samplesPerBeat;
+    const float    usPerSample = 1000000.0f / AUDIO_SAMPLE_RATE_EXACT;
+
+    if (_startRequest) {
+        _startRequest = false;
+        _beat      = 0.0;
+        _tickCount = 0;
+        _running   = true;
+        _push(baseUs, 0xFA);   // Start, immediately followed by tick 0
+    }
+    if (_stopRequest) {
+        _stopRequest = false;
+        if (_running) {
+            _running = false;
+            _push(baseUs, 0xFC);
+        }
+    }
+
+    if (_running) {
+        // Every tick whose position falls inside this block
+        for (;;) {
+            const double tickBeat = (double)_tickCount * (1.0 / MIDI_CLOCK_PPQN);
+            double offset = (tickBeat - _beat) * spb;   // samples into block
+            if (offset >= AUDIO_BLOCK_SAMPLES) break;
+            if (offset < 0.0) offset = 0.0;
+            _push(baseUs + (uint32_t)((float)offset * usPerSample), 0xF8);
+            _tickCount++;
+        }
+    }
+
+    // Publish the block-start position, then advance
+    _posUs   = baseUs;
+    _posBeat = _beat;
+    _beat   += (double)AUDIO_BLOCK_SAMPLES / spb;
+}
+
+void MIDIClockMaster::_push(uint32_t dueUs, uint8_t status) {
+    const uint8_t next = (_qWrite + 1) & (MIDI_CLOCK_QUEUE_LEN - 1);
+    if (next == _qRead) { _statDropped++; return; }
+    _queue[_qWrite] = { dueUs, status };
+    _qWrite = next;
+}
+
+// ═════════════════════════════════════════════════════════════════
+// Send timer
+// ═════════════════════════════════════════════════════════════════
+
+void MIDIClockMaster::_timerISR() {
+    if (_instance) _instance->_service();
+}
+
+// Runs at priority 32, above the audio ISR and USB.  This is the only
+// place in the firmware that writes to usbMIDI (see the class comment).
+void MIDIClockMaster::_service() {
+    while (_qRead != _qWrite) {
+        const Event& ev = _queue[_qRead];
+        const uint32_t now = micros();
+        if ((int32_t)(now - ev.dueUs) < 0) break;    // Not yet due
+
+        if (_din) {
+            if (_din->availableForWrite() > 0) _din->write(ev.status);
+            else _statDropped++;
+        }
+        if (_usbOut) {
+            usbMIDI.sendRealTime(ev.status);
+            usbMIDI.send_now();
+        }
+
+        if (ev.status == 0xF8) {
+            const uint32_t late = now - ev.dueUs;
+            _statTicks++;
+            _statLateSumUs += late;
+            if (late > _statLateMaxUs) _statLateMaxUs = late;
+
+            // Interval jitter: actual spacing vs scheduled spacing
+            if (_haveLast) {
+                const int32_t actual = (int32_t)(now - _lastSentUs);
+                const int32_t ideal  = (int32_t)(ev.dueUs - _lastDueUs);
+                const uint32_t j = (uint32_t)abs(actual - ideal);
+                if (j > _statJitterMaxUs) _statJitterMaxUs = j;
+            }
+            _lastSentUs = now;
+            _lastDueUs  = ev.dueUs;
+            _haveLast   = true;
+        } else {
+            _haveLast = false;   // Start/Stop breaks the tick sequence
+        }
+
+        _qRead = (_qRead + 1) & (MIDI_CLOCK_QUEUE_LEN - 1);
+    }
+
+    // Queued SysEx goes out between clock bytes, never inside one's packet
+    while (_sxRead != _sxWrite) {
+        const SysEx& m = _sysex[_sxRead];
+        usbMIDI.sendSysEx(m.len, m.data, true);
+        usbMIDI.send_now();
+        _sxRead = (_sxRead + 1) & (MIDI_CLOCK_SYSEX_SLOTS - 1);
+    }
+}
+
+// ═════════════════════════════════════════════════════════════════
+// Housekeeping
+// ═════════════════════════════════════════════════════════════════
+
+void MIDIClockMaster::_gateTimer() {
+    // Run the send timer only while there is something to send
+    const bool busy = _running || _startRequest || _stopRequest
+                   || (_qRead != _qWrite) || (_sxRead != _sxWrite);
+    if (busy && !_timerOn) {
+        _timerOn = _timer.begin(_timerISR, MIDI_CLOCK_TIMER_US);
+        _timer.priority(32);   // Above the audio update so sends aren't delayed by DSP
+    } else if (!busy && _timerOn) {
+        _timer.end();
+        _timerOn = false;
+    }
+}
+
+void MIDIClockMaster::poll() {
+    _gateTimer();
+
+    // Jitter report every 5 s while running
+    const uint32_t nowMs = millis();
+    if (!_running || (nowMs - _lastReportMs) < 5000) return;
+    _lastReportMs = nowMs;
+
+    __disable_irq();
+    const uint32_t ticks   = _statTicks;
+    const uint32_t lateSum = _statLateSumUs;
+    const uint32_t lateMax = _statLateMaxUs;
+    const uint32_t jitMax  = _statJitterMaxUs;
+    const uint32_t dropped = _statDropped;
+    _statTicks = _statLateSumUs = _statLateMaxUs = _statJitterMaxUs = _statDropped = 0;
+    __enable_irq();
+
+    if (ticks) {
+        JT_LOGF("[CLK OUT] %lu ticks  late avg %.1f us max %lu us  interval jitter max %lu us  dropped %lu\n",
+                (unsigned long)ticks, (float)lateSum / ticks,
+                (unsigned long)lateMax, (unsigned long)jitMax, (unsigned long)dropped);
+    }
+}
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Audio.h>
+#include "BPMClockManager.h"
+
+// Lead time between the audio block that schedules a clock byte and the
+// moment it goes out — one block, so every due time is in the future.
+#define MIDI_CLOCK_OUT_LEAD_US   ((uint32_t)(AUDIO_BLOCK_SAMPLES * 1000000.0f / AUDIO_SAMPLE_RATE_EXACT))
+
+// Send-timer period.  Output jitter is bounded by this plus UART framing.
+#define MIDI_CLOCK_TIMER_US      25
+
+// Scheduled real-time bytes in flight (a block holds at most ~3 ticks at 300 BPM)
+#define MIDI_CLOCK_QUEUE_LEN     16
+
+// Short SysEx messages (upload ACKs) waiting for the send timer
+#define MIDI_CLOCK_SYSEX_SLOTS   4
+#define MIDI_CLOCK_SYSEX_MAX     16     // Bytes per message, F0..F7 inclusive
+
+/**
+ * @brief Internal MIDI clock master (24 PPQN) driven by the audio sample clock
+ *
+ * An AudioStream sink (1 input, 0 outputs) patched from the synth output so
+ * its update() runs once per audio block.  Each block it advances a
+ * sample-counted song position and schedules any clock ticks that fall
+ * inside the block, time-stamped to the sample.  A high-priority
+ * IntervalTimer then sends the queued bytes on DIN and/or USB at their due
+ * time — nothing is sent from loop().
+ *
+ * Because ticks are derived from the same sample count that BPMClockManager
+ * publishes as the internal song position (see setInternalTimebase()),
+ * synced LFOs and delay stay phase-coherent with the outgoing clock.
+ *
+ * Threading:
+ *   - setBPM()/start()/stop(): loop side, single-word stores / request flags
+ *   - update() → _schedule(): audio ISR — only producer into the send queue
+ *   - _timerISR() → _service(): IntervalTimer — only consumer; preempts the
+ *     audio ISR
+ *
+ * usbMIDI is not reentrant: a transmit from loop() that this timer
+ * preempts corrupts the USB packet being built.  With USB output enabled
+ * the timer ISR must therefore be the only usbMIDI writer in the firmware;
+ * nothing else may call usbMIDI.send*() while it can run.  Other USB
+ * output (SysEx replies) goes through sendSysEx(), which queues it for
+ * the same ISR.
+ */
+class MIDIClockMaster : public AudioStream {
+public:
+    MIDIClockMaster();
+
+    // ─────────────────────────────────────────────────────────────
+    // Setup
+    // ─────────────────────────────────────────────────────────────
+
+    /**
+     * @brief Select outputs; call once from setup()
+     * @param din    Serial port for DIN out (nullptr = none)
+     * @param usbOut true to also send on USB device MIDI
+     */
+    void begin(HardwareSerial* din, bool usbOut);
+
+    // ─────────────────────────────────────────────────────────────
+    // Transport (loop side)
+    // ─────────────────────────────────────────────────────────────
+
+    void setBPM(float bpm);
+    void start();   // 0xFA, position → 0, ticks follow from the same sample
+    void stop();    // 0xFC, ticks stop; position keeps running
+    bool isRunning() const { return _running; }
+
+    /**
+     * @brief Queue a short SysEx message for USB (loop side)
+     * @param msg Complete message, F0..F7
+     * @param len Length in bytes, at most MIDI_CLOCK_SYSEX_MAX
+     * @return false if too long or the queue is full (message dropped)
+     *
+     * Sent by the timer ISR after any real-time bytes that are due, so it
+     * never interleaves with a clock byte inside a USB packet.
+     */
+    bool sendSysEx(const uint8_t* msg, uint16_t len);
+
+    /**
+     * @brief Sample-derived song position at the most recent block
+     * @param us         micros() at which the position is heard (block start + lead)
+     * @param tick       Whole clock ticks since start()
+     * @param frac       Fraction of a tick, 0..1
+     * @param ticksPerUs Slope
+     */
+    void getPosition(uint32_t& us, uint32_t& tick, float& frac, float& ticksPerUs) const;
+
+    /**
+     * @brief Housekeeping from loop(): timer gating and jitter report
+     */
+    void poll();
+
+    virtual void update(void) override;
+
+private:
+    struct Event {
+        uint32_t dueUs;
+        uint8_t  status;
+    };
+
+    struct SysEx {
+        uint8_t len;
+        uint8_t data[MIDI_CLOCK_SYSEX_MAX];
+    };
+
+    void _schedule(uint32_t baseUs);
+    void _push(uint32_t dueUs, uint8_t status);
+    static void _timerISR();
+    void _service();
+    void _gateTimer();
+
+    audio_block_t* _inputQueue[1];
+
+    // Outputs
+    HardwareSerial* _din    = nullptr;
+    bool            _usbOut = false;
+
+    // Tempo / position (audio ISR owns _beat and _tickCount)
+    volatile double _samplesPerBeat;
+    double          _beat      = 0.0;   // Position at current block start
+    uint32_t        _tickCount = 0;     // Ticks sent since start()
+    volatile bool   _running   = false;
+    volatile bool   _startRequest = false;
+    volatile bool   _stopRequest  = false;
+
+    // Published for getPosition()
+    volatile uint32_t _posUs   = 0;
+    volatile double   _posBeat = 0.0;
+
+    // Send queue: audio ISR → timer ISR
+    Event             _queue[MIDI_CLOCK_QUEUE_LEN];
+    volatile uint8_t  _qWrite = 0;
+    volatile uint8_t  _qRead  = 0;
+
+    // SysEx queue: loop → timer ISR
+    SysEx             _sysex[MIDI_CLOCK_SYSEX_SLOTS];
+    volatile uint8_t  _sxWrite = 0;
+    volatile uint8_t  _sxRead  = 0;
+
+    // Send timer
+    IntervalTimer     _timer;
+    bool              _timerOn = false;
+    static MIDIClockMaster* _instance;
+
+    // Output jitter stats (timer ISR writes, poll() reads and clears)
+    volatile uint32_t _statTicks      = 0;
+    volatile uint32_t _statLateSumUs  = 0;
+    volatile uint32_t _statLateMaxUs  = 0;
+    volatile uint32_t _statJitterMaxUs = 0;   // |actual − ideal| tick interval
+    volatile uint32_t _statDropped    = 0;    // Queue full or TX buffer full
+    uint32_t          _lastSentUs     = 0;
+    uint32_t          _lastDueUs      = 0;
+    bool              _haveLast       = false;
+    uint32_t          _lastReportMs   = 0;
+};
@@ -5,6 +5,7 @@
 
 #pragma once
 #include <math.h>
+#include <string.h>
 #include <Arduino.h>
 #include "CCDefs.h"
 #include "LFOBlock.h"  // for NUM_LFO_DESTS used in LFO destination binning
@@ -114,31 +115,124 @@ namespace JT4000Map {
     inline float cc_to_norm(uint8_t cc) { if (cc>127) cc=127; return cc/127.0f; }
     inline uint8_t norm_to_cc(float n) { n = clamp01(n); return (uint8_t)constrain(lroundf(n*127.0f),0,127); }
 
-    inline float applyTaper(float t) {
-        switch (cutoffTaperMode) { case TAPER_LOW: return powf(t,0.5f);
-                                   case TAPER_HIGH:return powf(t,2.0f);
-                                   default:        return t; }
+    // ----- Curve tables -----
+    // Each exponential curve keeps its analytic form (forward + inverse,
+    // logf/powf as before) and is sampled once into a 128-entry table, so
+    // cc_to_* is a single load equal bit for bit to the analytic value.
+    //
+    // Inverses count edges instead: edge k is the smallest input the
+    // analytic inverse maps above k, found by bisecting float bit patterns
+    // (positive floats order like their bits).  Counting the edges <= x
+    // (binary search, 7 compares) then returns exactly the analytic
+    // lroundf() result for every x, without a logf/powf.
+    //
+    // norm_to_* still evaluate the curve directly — they serve 14-bit input.
+    // A table fills on first use; setup() calls buildCurveTables() so no CC
+    // pays for it.
+    namespace _curve_internal {
+        struct Table {
+            float fwd[128];    // Curve at CC 0..127
+            float edge[127];   // Smallest input the inverse maps above k
+            bool  ready;
+        };
+
+        inline float    fromBits(uint32_t b) { float x;    memcpy(&x, &b, sizeof x); return x; }
+        inline uint32_t toBits(float x)      { uint32_t b; memcpy(&b, &x, sizeof b); return b; }
+
+        // fwd(cc) and inv(x) are the analytic pair over [lo, hi], with
+        // inv(lo) == 0 and inv(hi) == 127
+        template <typename Fwd, typename Inv>
+        void fill(Table& t, Fwd fwd, Inv inv, float lo, float hi) {
+            for (int i = 0; i < 128; ++i) t.fwd[i] = fwd((uint8_t)i);
+            for (int k = 0; k < 127; ++k) {
+                uint32_t a = toBits(lo), b = toBits(hi);   // inv(a) <= k < inv(b)
+                while (b - a > 1) {
+                    const uint32_t m = a + ((b - a) >> 1);
+                    if (inv(fromBits(m)) > k) b = m;
+                    else                      a = m;
+                }
+                t.edge[k] = fromBits(b);
+            }
+            t.ready = true;
+        }
+
+        // Number of edges <= x, i.e. the analytic inverse on a rising curve
+        inline uint8_t search(const Table& t, float x) {
+            uint8_t lo = 0, hi = 127;
+            while (lo < hi) {
+                const uint8_t mid = (uint8_t)((lo + hi) >> 1);
+                if (t.edge[mid] <= x) lo = mid + 1;
+                else                  hi = mid;
+            }
+            return lo;
+        }
+
+        inline uint8_t cc7(uint8_t cc) { return cc > 127 ? 127 : cc; }
+    } // namespace _curve_internal
+
+    inline float taper(float t, CutoffTaper mode) {
+        switch (mode) { case TAPER_LOW: return powf(t,0.5f);
+                        case TAPER_HIGH:return powf(t,2.0f);
+                        default:        return t; }
     }
+    inline float applyTaper(float t) { return taper(t, cutoffTaperMode); }
 
-    inline float cc_to_cutoff_hz(uint8_t cc) {
-        float t = applyTaper(cc_to_norm(cc));
+    // Analytic cutoff curve and its inverse
+    inline float cutoff_curve(float n, CutoffTaper mode) {
+        float t = taper(clamp01(n), mode);
         return CUTOFF_MIN_HZ * powf(CUTOFF_MAX_HZ / CUTOFF_MIN_HZ, t);
     }
-    inline uint8_t cutoff_hz_to_cc(float hz) {
+    inline uint8_t cutoff_curve_to_cc(float hz, CutoffTaper mode) {
         hz = fmaxf(CUTOFF_MIN_HZ, fminf(hz, CUTOFF_MAX_HZ));
         float t = logf(hz / CUTOFF_MIN_HZ) / logf(CUTOFF_MAX_HZ / CUTOFF_MIN_HZ);
-        if (cutoffTaperMode==TAPER_LOW)  t = powf(t,2.0f);
-        if (cutoffTaperMode==TAPER_HIGH) t = powf(t,0.5f);
+        if (mode==TAPER_LOW)  t = powf(t,2.0f);
+        if (mode==TAPER_HIGH) t = powf(t,0.5f);
         return (uint8_t)constrain(lroundf(t*127.0f),0,127);
     }
 
-    const float msMin = 1.0f;      // <<< set your desired minimum (e.g. 1 ms)
-    const float msMax = 11880.0f;  // <<< set your desired maximum (e.g. 30 s)
+    inline const _curve_internal::Table& cutoffTable(CutoffTaper mode) {
+        static _curve_internal::Table t[3];   // Indexed by CutoffTaper
+        if (!t[mode].ready) {
+            _curve_internal::fill(t[mode],
+                [mode](uint8_t cc) { return cutoff_curve(cc_to_norm(cc), mode); },
+                [mode](float hz)   { return cutoff_curve_to_cc(hz, mode); },
+                CUTOFF_MIN_HZ, CUTOFF_MAX_HZ);
+        }
+        return t[mode];
+    }
+
+    // Curves take a normalised 0..1 position so 14-bit controllers
+    // (CCDispatch) get full resolution; the cc_to_* forms read the tables.
+    inline float norm_to_cutoff_hz(float n) { return cutoff_curve(n, cutoffTaperMode); }
+    inline float cc_to_cutoff_hz(uint8_t cc) {
+        return cutoffTable(cutoffTaperMode).fwd[_curve_internal::cc7(cc)];
+    }
+    inline uint8_t cutoff_hz_to_cc(float hz) {
+        return _curve_internal::search(cutoffTable(cutoffTaperMode), hz);
+    }
+
+    static constexpr float msMin = 1.0f;      // <<< set your desired minimum (e.g. 1 ms)
+    static constexpr float msMax = 11880.0f;  // <<< set your desired maximum (e.g. 30 s)
 
-    inline float cc_to_time_ms(uint8_t cc) {
-    const float t = (float)cc / 127.0f;
-    return msMin * powf(msMax / msMin, t);
-}
+    // Analytic envelope time curve and its inverse
+    inline float norm_to_time_ms(float n) { return msMin * powf(msMax / msMin, clamp01(n)); }
+    inline uint8_t time_curve_to_cc(float ms) {
+        if (ms <= msMin) return 0;
+        if (ms >= msMax) return 127;
+        const float cc = 127.0f * logf(ms / msMin) / logf(msMax / msMin);
+        return (uint8_t)constrain(lroundf(cc), 0, 127);
+    }
+
+    inline const _curve_internal::Table& timeTable() {
+        static _curve_internal::Table t;
+        if (!t.ready) {
+            _curve_internal::fill(t, [](uint8_t cc) { return norm_to_time_ms((float)cc / 127.0f); },
+                                  time_curve_to_cc, msMin, msMax);
+        }
+        return t;
+    }
+
+    inline float cc_to_time_ms(uint8_t cc) { return timeTable().fwd[_curve_internal::cc7(cc)]; }
     // =================== OBXa (OB-Xf) helpers ===================
     //
     // The OBXa core becomes numerically fragile near:
@@ -155,9 +249,16 @@ namespace JT4000Map {
     static constexpr float OBXA_CUTOFF_MAX_HZ = 18000.0f;
     static constexpr float OBXA_CUTOFF_MIN_HZ = CUTOFF_MIN_HZ;
 
+    inline float norm_to_obxa_cutoff_hz(float n)
+    {
+        float hz = norm_to_cutoff_hz(n); // reuse your exponential cutoff curve
+        if (hz < OBXA_CUTOFF_MIN_HZ) hz = OBXA_CUTOFF_MIN_HZ;
+        if (hz > OBXA_CUTOFF_MAX_HZ) hz = OBXA_CUTOFF_MAX_HZ;
+        return hz;
+    }
     inline float cc_to_obxa_cutoff_hz(uint8_t cc)
     {
-        float hz = cc_to_cutoff_hz(cc); // reuse your exponential cutoff curve
+        float hz = cc_to_cutoff_hz(cc);
         if (hz < OBXA_CUTOFF_MIN_HZ) hz = OBXA_CUTOFF_MIN_HZ;
         if (hz > OBXA_CUTOFF_MAX_HZ) hz = OBXA_CUTOFF_MAX_HZ;
         return hz;
@@ -173,13 +274,13 @@ namespace JT4000Map {
     // Resonance for OBXa is 0..1. To avoid "exactly 1.0" edge cases, clamp slightly below 1.
     static constexpr float OBXA_RES_MAX = 0.91f; // tweak 0.99..0.999 as needed
 
-    inline float cc_to_obxa_res01(uint8_t cc)
+    inline float norm_to_obxa_res01(float r)
     {
-        float r = cc_to_norm(cc);       // 0..1
         if (r > OBXA_RES_MAX) r = OBXA_RES_MAX;
         if (r < 0.0f) r = 0.0f;
         return r;
     }
+    inline float cc_to_obxa_res01(uint8_t cc) { return norm_to_obxa_res01(cc_to_norm(cc)); }
 
     inline uint8_t obxa_res01_to_cc(float r)
     {
@@ -220,22 +321,32 @@ namespace JT4000Map {
     inline bool cc_to_obxa_bpblend_2pole(uint8_t cc){ return cc_to_bool(cc); }
     inline bool cc_to_obxa_push_2pole(uint8_t cc)   { return cc_to_bool(cc); }
 
-inline uint8_t time_ms_to_cc(float ms) {
-    if (ms <= msMin) return 0;
-    if (ms >= msMax) return 127;
-    const float cc = 127.0f * logf(ms / msMin) / logf(msMax / msMin);
-    return (uint8_t)constrain(lroundf(cc), 0, 127);
-}
+    inline uint8_t time_ms_to_cc(float ms) { return _curve_internal::search(timeTable(), ms); }
 
+    static constexpr float LFO_MIN_HZ = 0.03f;
+    static constexpr float LFO_RANGE  = 1300.0f;   // max = LFO_MIN_HZ * LFO_RANGE
 
-    inline float cc_to_lfo_hz(uint8_t cc) { return 0.03f * powf(1300.0f, cc_to_norm(cc)); }
-    inline uint8_t lfo_hz_to_cc(float hz) {
-        if (hz <= 0.03f) return 0;
-        if (hz >= 0.03f*1300.0f) return 127;
-        float n = logf(hz/0.03f)/logf(1300.0f);
+    // Analytic LFO rate curve and its inverse
+    inline float norm_to_lfo_hz(float n)  { return LFO_MIN_HZ * powf(LFO_RANGE, clamp01(n)); }
+    inline uint8_t lfo_curve_to_cc(float hz) {
+        if (hz <= LFO_MIN_HZ) return 0;
+        if (hz >= LFO_MIN_HZ*LFO_RANGE) return 127;
+        float n = logf(hz/LFO_MIN_HZ)/logf(LFO_RANGE);
         return norm_to_cc(n);
     }
 
+    inline const _curve_internal::Table& lfoTable() {
+        static _curve_internal::Table t;
+        if (!t.ready) {
+            _curve_internal::fill(t, [](uint8_t cc) { return norm_to_lfo_hz(cc_to_norm(cc)); },
+                                  lfo_curve_to_cc, LFO_MIN_HZ, LFO_MIN_HZ * LFO_RANGE);
+        }
+        return t;
+    }
+
+    inline float cc_to_lfo_hz(uint8_t cc) { return lfoTable().fwd[_curve_internal::cc7(cc)]; }
+    inline uint8_t lfo_hz_to_cc(float hz) { return _curve_internal::search(lfoTable(), hz); }
+
     inline uint8_t ccFromLfoDest(int dest) {
         if (dest < 0) dest = 0;
         if (dest >= NUM_LFO_DESTS) dest = NUM_LFO_DESTS - 1;
@@ -283,7 +394,7 @@ inline uint8_t time_ms_to_cc(float ms) {
     static constexpr float RES_CURVE_Z3 = 2.20f;  // strong skew 4..20
 
     // Clamp for safety
-    static inline float clamp_res_k(float k) {
+    constexpr float clamp_res_k(float k) {
         if (k < RES_MIN_K) return RES_MIN_K;
         if (k > RES_MAX_K) return RES_MAX_K;
         return k;
@@ -306,9 +417,9 @@ inline uint8_t time_ms_to_cc(float ms) {
         }
     } // namespace _res_internal
 
-    // CC (0..127) → k (0..20) with 3-zone response
-    static inline float cc_to_res_k(uint8_t cc) {
-        const float n = clamp01(cc / 127.0f);
+    // Normalised 0..1 → k (0..20) with 3-zone response
+    inline float res_k_curve(float n) {
+        n = clamp01(n);
         const float W1 = RES_W1;
         const float W2 = RES_W2;
         const float W3 = RES_W3; // = 1 - W1 - W2
@@ -328,8 +439,8 @@ inline uint8_t time_ms_to_cc(float ms) {
         }
     }
 
-    // k (0..20) → CC (0..127), inverse of above for UI round-trip stability
-    static inline uint8_t res_k_to_cc(float k) {
+    // k (0..20) → CC (0..127), the analytic inverse of the above
+    inline uint8_t res_k_curve_to_cc(float k) {
         k = clamp_res_k(k);
 
         const float W1 = RES_W1;
@@ -352,4 +463,29 @@ inline uint8_t time_ms_to_cc(float ms) {
         return (uint8_t)constrain(lroundf(n * 127.0f), 0, 127);
     }
 
+    inline const _curve_internal::Table& resKTable() {
+        static _curve_internal::Table t;
+        if (!t.ready) {
+            _curve_internal::fill(t, [](uint8_t cc) { return res_k_curve(cc / 127.0f); },
+                                  res_k_curve_to_cc, RES_MIN_K, RES_MAX_K);
+        }
+        return t;
+    }
+
+    // CC (0..127) → k (0..20)
+    static inline float cc_to_res_k(uint8_t cc) { return resKTable().fwd[_curve_internal::cc7(cc)]; }
+
+    // k (0..20) → CC (0..127), inverse of above for UI round-trip stability
+    static inline uint8_t res_k_to_cc(float k) { return _curve_internal::search(resKTable(), k); }
+
+    // Fill every curve table now rather than on the first CC that reads it
+    inline void buildCurveTables() {
+        cutoffTable(TAPER_NEUTRAL);
+        cutoffTable(TAPER_LOW);
+        cutoffTable(TAPER_HIGH);
+        timeTable();
+        lfoTable();
+        resKTable();
+    }
+
 } // namespace JT4000Map
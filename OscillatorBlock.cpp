@@ -1,18 +1,21 @@
 #include "OscillatorBlock.h"
 #include "AKWF_All.h"
+#include "WaveTablePool.h"
+#include "AudioDormancy.h"
+#include "AudioLock.h"
+#include "SupersawPool.h"
 
 // ============================================================================
 // CONSTRUCTOR - Dual Signal Path (Normal + Feedback)
 // ============================================================================
-OscillatorBlock::OscillatorBlock(bool enableSupersaw)
+OscillatorBlock::OscillatorBlock()
     : _supersaw(nullptr),
-      _supersawEnabled(enableSupersaw),
       _patchfrequencyDc(new AudioConnection(_frequencyDc, 0, _frequencyModMixer, 0)),
       _patchshapeDc(new AudioConnection(_shapeDc, 0, _shapeModMixer, 0)),
       _patchfrequency(new AudioConnection(_frequencyModMixer, 0, _mainOsc, 0)),
       _patchshape(new AudioConnection(_shapeModMixer, 0, _mainOsc, 1)),
       _patchMainOsc(new AudioConnection(_mainOsc, 0, _outputMix, 0)),
-      _patchSupersaw(nullptr),
+      _patchSupersaw(new AudioConnection()),
       _baseFreq(440.0f)
 {
     _mainOsc.begin(_currentType);
@@ -37,7 +40,7 @@ OscillatorBlock::OscillatorBlock(bool enableSupersaw)
     // OUTPUT MIXER - DUAL PATH ARCHITECTURE
     // =========================================================================
     // Channel 0: Main oscillator (stays active!)
-    // Channel 1: Supersaw oscillator (if enabled)
+    // Channel 1: Supersaw oscillator (leased engine, see SupersawPool.h)
     // Channel 2: Feedback comb output (added when feedback enabled)
     // Channel 3: Unused
     // KEY: Normal output (0/1) stays on when feedback is enabled!
@@ -63,58 +66,195 @@ OscillatorBlock::OscillatorBlock(bool enableSupersaw)
     _patchDelayToComb    = new AudioConnection(_combDelay, 0, _combMixer, 2);
     _patchCombToDelay    = new AudioConnection(_combMixer, 0, _combDelay, 0);
     _patchDelayToOut     = new AudioConnection(_combDelay, 0, _outputMix, 2);
-    
-    _patchSupersawToComb = nullptr;
-    
-    if (_supersawEnabled) {
-        _supersaw = new AudioSynthSupersaw();
-        _patchSupersaw       = new AudioConnection(*_supersaw, 0, _outputMix, 1);
-        _patchSupersawToComb = new AudioConnection(*_supersaw, 0, _combMixer, 1);
+
+    // Supersaw cords are wired to an engine only while one is leased
+    _patchSupersawToComb = new AudioConnection();
+}
+
+// ============================================================================
+// SUPERSAW ENGINE LEASE
+// ============================================================================
+
+bool OscillatorBlock::_leaseSupersaw() {
+    if (_supersaw) return true;
+    _supersaw = SupersawPool::lease();
+    if (!_supersaw) return false;
+
+    _supersaw->setDetune(_supersawDetune);
+    _supersaw->setMix(_supersawMix);
+    _supersaw->setFrequency(_lastFreq > 0.0f ? _lastFreq : _targetFreq);
+
+    // Engine comes back parked from the pool and the connects leave it (and
+    // a parked comb) that way; applyDormancy() decides what runs
+    AudioLock::hold();
+    AudioDormancy::connect(*_patchSupersaw,       *_supersaw, 0, _outputMix, 1);
+    AudioDormancy::connect(*_patchSupersawToComb, *_supersaw, 0, _combMixer, 1);
+    AudioLock::release();
+    _linkSawToComb = true;   // applyDormancy() unlinks it again if the comb is parked
+    _dormancyDirty = true;
+    applyDormancy();
+    return true;
+}
+
+void OscillatorBlock::_returnSupersaw() {
+    if (!_supersaw) return;
+
+    // Parked in the same section, so no cycle runs it with its cords cut
+    AudioLock::hold();
+    _patchSupersaw->disconnect();
+    AudioDormancy::link(_patchSupersawToComb, _linkSawToComb, false);
+    SupersawPool::giveBack(_supersaw);
+    AudioLock::release();
+    _supersaw = nullptr;
+    _dormancyDirty = true;
+    applyDormancy();
+}
+
+void OscillatorBlock::_routeSupersaw() {
+    if (_supersaw) {
+        // Route through supersaw
+        _outputMix.gain(0, 0.0f);  // Mute main
+        _outputMix.gain(1, 0.9f);  // Enable supersaw
         
-        _supersaw->setOversample(false);
-        _supersaw->setMixCompensation(true);
-        _supersaw->setCompensationMaxGain(1.5f);
-        _supersaw->setBandLimited(false);
+        // Also route supersaw to comb input if feedback exists
+        if (_feedbackEnabled) {
+            _combMixer.gain(0, 0.0f);  // Mute main to comb
+            _combMixer.gain(1, 1.0f);  // Supersaw to comb
+        }
+    } else {
+        // Fallback to sawtooth (no engine held, or the pool is exhausted)
+        _mainOsc.begin(WAVEFORM_SAWTOOTH);
+        _outputMix.gain(0, 0.7f);
+        _outputMix.gain(1, 0.0f);
+        
+        if (_feedbackEnabled) {
+            _combMixer.gain(0, 1.0f);
+            _combMixer.gain(1, 0.0f);
+        }
     }
 }
 
+void OscillatorBlock::voiceIdle() {
+    _sounding = false;
+    if (!_supersaw) return;
+    _returnSupersaw();
+    _routeSupersaw();
+}
+
 // ============================================================================
 // ARBITRARY WAVEFORM HELPERS
 // ============================================================================
 
-void OscillatorBlock::_applyArbWave() {
-    uint16_t len = 0;
-    const int16_t* table = akwf_get(_arbBank, _arbIndex, len);
-    if (table && len > 0) {
-        const float maxFreq = AUDIO_SAMPLE_RATE_EXACT / (float)len;
-        _mainOsc.arbitraryWaveform(table, maxFreq);
+// _arbBuf layout: [0], [1] front/back, then the fade source and the
+// full-band fallback table
+#define ARB_BUF_TABLES    4
+#define ARB_BUF_FROM      2
+#define ARB_BUF_RAW       3
+#define ARB_XFADE_BLOCKS  8   // ≈ 23 ms at 128 samples / 44.1 kHz
+
+static const uint32_t kArbBlockUs =
+    (uint32_t)(AUDIO_BLOCK_SAMPLES * 1000000.0f / AUDIO_SAMPLE_RATE_EXACT);
+
+void OscillatorBlock::_applyArbWave(bool crossfade) {
+    if (!_arbBuf) _arbBuf = new int16_t[ARB_BUF_TABLES * AKWF_MIP_SIZE];
+
+    // Fade from whatever is playing now (possibly a fade in progress)
+    if (crossfade && _arbPlaying) {
+        memcpy(_arbBuf + ARB_BUF_FROM * AKWF_MIP_SIZE,
+               _arbBuf + _arbBufFront * AKWF_MIP_SIZE,
+               AKWF_MIP_SIZE * sizeof(int16_t));
+        _arbFadeStep = 1;
+    } else {
+        _arbFadeStep = 0;
+    }
+
+    // Swap to the new table's mip set (built on first use, shared by voices)
+    AKWFMip::release(_arbMip);
+    _arbMip    = AKWFMip::acquire(_arbBank, _arbIndex);
+    _arbMipKey = -1;
+
+    // Fallback (every cache slot held): the raw cycle resampled into our own
+    // table, full band at every pitch.  Playback still never reads flash.
+    if (!_arbMip && !AKWFMip::resampleRaw(_arbBank, _arbIndex, _arbBuf + ARB_BUF_RAW * AKWF_MIP_SIZE)) {
+        _arbFadeStep = 0;
+        return;
     }
+    _arbStepUs = micros();
+    _updateArbMip(_lastFreq > 0.0f ? _lastFreq : _targetFreq);
+}
+
+void OscillatorBlock::_serviceArbSwitch() {
+    if (_currentType != WAVEFORM_ARBITRARY || (!_arbPending && _arbFadeStep == 0)) return;
+
+    // The ISR picks up a new table pointer at its next block; publishing
+    // faster than that only burns loop time, so coalesce to one per block
+    if ((uint32_t)(micros() - _arbStepUs) < kArbBlockUs) return;
+
+    if (_arbPending) {
+        _arbPending = false;
+        _applyArbWave(true);
+        return;
+    }
+    _arbStepUs = micros();
+    if (++_arbFadeStep > ARB_XFADE_BLOCKS) _arbFadeStep = 0;   // Last step renders the pure table
+    _arbMipKey = -1;
+    _updateArbMip(_lastFreq > 0.0f ? _lastFreq : _targetFreq);
+}
+
+void OscillatorBlock::_updateArbMip(float freqHz) {
+    if (!_arbBuf) return;
+
+    // The audio ISR only ever reads the front half; write the back half,
+    // then publish it with a single pointer store
+    int16_t* back = _arbBuf + (_arbBufFront ^ 1) * AKWF_MIP_SIZE;
+
+    if (_arbMip) {
+        const float   lf   = AKWFMip::levelFor(freqHz);
+        const uint8_t a    = (uint8_t)lf;
+        const uint8_t step = (uint8_t)((lf - a) * 16.0f);
+        const int16_t key  = (int16_t)(a * 16 + step);
+        if (key == _arbMipKey) return;
+        _arbMipKey = key;
+        AKWFMip::blend(*_arbMip, a, step * (1.0f / 16.0f), back);
+    } else {
+        if (_arbMipKey == 0) return;   // Full-band table already published
+        _arbMipKey = 0;
+        memcpy(back, _arbBuf + ARB_BUF_RAW * AKWF_MIP_SIZE, AKWF_MIP_SIZE * sizeof(int16_t));
+    }
+
+    // Mid-switch: morph from the table that was playing
+    if (_arbFadeStep) {
+        const int16_t* from = _arbBuf + ARB_BUF_FROM * AKWF_MIP_SIZE;
+        const int32_t  w    = (int32_t)_arbFadeStep * 32768 / (ARB_XFADE_BLOCKS + 1);   // Q15, new table
+        for (uint16_t n = 0; n < AKWF_MIP_SIZE; ++n) {
+            back[n] = (int16_t)(from[n] + (((back[n] - from[n]) * w) >> 15));
+        }
+    }
+
+    _arbBufFront ^= 1;
+    _arbPlaying = true;
+    _mainOsc.arbitraryWaveform(back, AUDIO_SAMPLE_RATE_EXACT * 0.5f);
 }
 
 void OscillatorBlock::setArbBank(ArbBank b) {
     _arbBank = b;
-    uint16_t count = akwf_bankCount(b);
+    uint16_t count = wavebank_tableCount(b);
     if (count > 0 && _arbIndex >= count) {
         _arbIndex = count - 1;
     }
-    if (_currentType == WAVEFORM_ARBITRARY) {
-        _applyArbWave();
-        _mainOsc.begin(WAVEFORM_ARBITRARY);
-    }
+    // Applied (and coalesced) by update()
+    if (_currentType == WAVEFORM_ARBITRARY) _arbPending = true;
 }
 
 void OscillatorBlock::setArbTableIndex(uint16_t idx) {
-    uint16_t count = akwf_bankCount(_arbBank);
+    uint16_t count = wavebank_tableCount(_arbBank);
     if (count == 0) {
         _arbIndex = 0;
         return;
     }
     if (idx >= count) idx = count - 1;
     _arbIndex = idx;
-    if (_currentType == WAVEFORM_ARBITRARY) {
-        _applyArbWave();
-        _mainOsc.begin(WAVEFORM_ARBITRARY);
-    }
+    if (_currentType == WAVEFORM_ARBITRARY) _arbPending = true;
 }
 
 // ============================================================================
@@ -124,35 +264,22 @@ void OscillatorBlock::setArbTableIndex(uint16_t idx) {
 void OscillatorBlock::setWaveformType(int type) {
     _currentType = type;
     _freqDirty = true;
+    _dormancyDirty = true;
+
+    // Engine held only while supersaw is selected and the voice sounds
+    if (type != WAVEFORM_SUPERSAW) _returnSupersaw();
+    else if (_sounding)            _leaseSupersaw();
 
     // ========================================================================
     // WAVEFORM ROUTING - Independent of feedback state
     // ========================================================================
     
     if (type == WAVEFORM_SUPERSAW) {
-        if (_supersawEnabled && _supersaw) {
-            // Route through supersaw
-            _outputMix.gain(0, 0.0f);  // Mute main
-            _outputMix.gain(1, 0.9f);  // Enable supersaw
-            
-            // Also route supersaw to comb input if feedback exists
-            if (_feedbackEnabled) {
-                _combMixer.gain(0, 0.0f);  // Mute main to comb
-                _combMixer.gain(1, 1.0f);  // Supersaw to comb
-            }
-        } else {
-            // Fallback to sawtooth
-            _mainOsc.begin(WAVEFORM_SAWTOOTH);
-            _outputMix.gain(0, 0.7f);
-            _outputMix.gain(1, 0.0f);
-            
-            if (_feedbackEnabled) {
-                _combMixer.gain(0, 1.0f);
-                _combMixer.gain(1, 0.0f);
-            }
-        }
+        _routeSupersaw();
     } else if (type == WAVEFORM_ARBITRARY) {
-        _applyArbWave();
+        // A waveform change restarts anyway: no fade, nothing left pending
+        _arbPending = false;
+        _applyArbWave(false);
         _mainOsc.begin(WAVEFORM_ARBITRARY);
         _outputMix.gain(0, 0.7f);
         _outputMix.gain(1, 0.0f);
@@ -207,8 +334,15 @@ void OscillatorBlock::noteOn(float freq, float velocity) {
         _baseFreq = _targetFreq;
         _glideActive = false;
     }
+
+    // Lease an engine for this note (a failed lease keeps the saw fallback
+    // and is retried at the next noteOn)
+    _sounding = true;
+    if (_currentType == WAVEFORM_SUPERSAW && !_supersaw && _leaseSupersaw()) {
+        _routeSupersaw();
+    }
     
-    AudioNoInterrupts();
+    AudioLock::hold();
     if (_currentType == WAVEFORM_SUPERSAW && _supersaw) {
         _mainOsc.amplitude(0);
         _supersaw->setAmplitude(amp);
@@ -216,7 +350,7 @@ void OscillatorBlock::noteOn(float freq, float velocity) {
         _mainOsc.amplitude(amp);
         if (_supersaw) _supersaw->setAmplitude(0);
     }
-    AudioInterrupts();
+    AudioLock::release();
 
     _lastVelocity = velocity;
 }
@@ -280,6 +414,7 @@ void OscillatorBlock::setGlideTime(float ms) {
 }
 
 void OscillatorBlock::update() {
+    _serviceArbSwitch();
     if (_targetFreq <= 0.0f) return;
 
     bool updateRequired = false;
@@ -311,12 +446,13 @@ void OscillatorBlock::update() {
     const float finalFreq     = fmaxf(0.0f, pitchAdjusted + detuneHz);
 
     if (updateRequired || fabsf(finalFreq - _lastFreq) > 0.01f) {
-        AudioNoInterrupts();
+        AudioLock::hold();
         _mainOsc.frequency(finalFreq);
         if (_supersaw) _supersaw->setFrequency(finalFreq);
-        AudioInterrupts();
+        AudioLock::release();
 
         _lastFreq = finalFreq;
+        if (_currentType == WAVEFORM_ARBITRARY) _updateArbMip(finalFreq);
     }
 }
 
@@ -331,6 +467,7 @@ void OscillatorBlock::setFeedbackAmount(float amount) {
 
         
     _feedbackEnabled = _feedbackGain > 0.0f;
+    _dormancyDirty = true;
 
         
     if (_feedbackEnabled) {
@@ -375,6 +512,7 @@ void OscillatorBlock::setFeedbackAmount(float amount) {
 void OscillatorBlock::setFeedbackMix(float mix) {
     // NEW METHOD: Control how much feedback comb is blended with dry signal
     _feedbackMixLevel = constrain(mix, 0.0f, 1.0f);
+    _dormancyDirty = true;
     
     if (_feedbackEnabled) {
 
@@ -383,13 +521,52 @@ void OscillatorBlock::setFeedbackMix(float mix) {
     }
 }
 
+// ============================================================================
+// DORMANT-NODE ELISION
+// ============================================================================
+
+void OscillatorBlock::setDormant(bool dormant) {
+    if (dormant == _dormant) return;
+    _dormant = dormant;
+    _dormancyDirty = true;
+}
+
+void OscillatorBlock::applyDormancy() {
+    if (!_dormancyDirty) return;
+    _dormancyDirty = false;
+
+    // Main osc and supersaw are mutually exclusive (see setWaveformType)
+    const bool sawSelected = (_currentType == WAVEFORM_SUPERSAW) && _supersaw;
+    const bool live     = !_dormant;
+    const bool mainLive = live && !sawSelected;
+    const bool sawLive  = live && sawSelected;
+    const bool combLive = live && _feedbackEnabled && _feedbackMixLevel > 0.0f;
+
+    AudioLock::hold();
+    // Mod mixers and DC sources stay live so LFO / pitch-env blocks keep
+    // being consumed; only their cords into a parked oscillator are cut.
+    AudioDormancy::link(_patchfrequency,      _linkFrequency,  mainLive);
+    AudioDormancy::link(_patchshape,          _linkShape,      mainLive);
+    AudioDormancy::link(_patchMainToComb,     _linkMainToComb, mainLive && combLive);
+    AudioDormancy::link(_patchSupersawToComb, _linkSawToComb,  sawLive && combLive);
+
+    AudioDormancy::setActive(_mainOsc,   mainLive);
+    if (_supersaw) AudioDormancy::setActive(*_supersaw, sawLive);
+    AudioDormancy::setActive(_combMixer, combLive);
+    AudioDormancy::setActive(_combDelay, combLive);
+    AudioDormancy::setActive(_outputMix, live);
+    AudioLock::release();
+
+    _dormantNodes = (uint8_t)(!mainLive + (_supersaw && !sawLive) + 2 * !combLive + !live);
+}
+
 // ============================================================================
 // AUDIO OUTPUTS & GETTERS
 // ============================================================================
 
 AudioStream& OscillatorBlock::output() { return _outputMix; }
-AudioMixer4& OscillatorBlock::frequencyModMixer() { return _frequencyModMixer; }
-AudioMixer4& OscillatorBlock::shapeModMixer() { return _shapeModMixer; }
+AudioMixer4Q15& OscillatorBlock::frequencyModMixer() { return _frequencyModMixer; }
+AudioMixer4Q15& OscillatorBlock::shapeModMixer() { return _shapeModMixer; }
 
 int OscillatorBlock::getWaveform() const { return _currentType; }
 float OscillatorBlock::getPitchOffset() const { return _pitchOffset; }
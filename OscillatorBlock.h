@@ -3,7 +3,9 @@
 #include <Audio.h>
 #include "Waveforms.h"
 #include "AKWF_All.h"
+#include "AKWFMip.h"
 #include "AudioSynthSupersaw.h"
+#include "AudioMixer4Q15.h"
 
 /**
  * @brief Oscillator block with JP-8000 style feedback oscillation
@@ -13,7 +15,8 @@
  * - Resonant feedback comb (JP-8000 simulation)
  * - Arbitrary waveform support (AKWF)
  * - Modulation inputs for frequency and shape
- * - Null-safe supersaw (OSC1 only, OSC2 fallback)
+ * - Supersaw engine leased from SupersawPool while sounding (either osc;
+ *   plain saw fallback when the pool is exhausted)
  * - CPU-efficient dirty flag system
  */
 class OscillatorBlock {
@@ -22,11 +25,7 @@ public:
     // LIFECYCLE
     // =========================================================================
     
-    /**
-     * @brief Constructor with optional supersaw capability
-     * @param enableSupersaw true for OSC1 (supersaw capable), false for OSC2
-     */
-    OscillatorBlock(bool enableSupersaw = false);
+    OscillatorBlock();
     
     /**
      * @brief Update frequency and pitch parameters (called from voice update)
@@ -46,6 +45,12 @@ public:
      */
     void noteOff();
 
+    /**
+     * @brief The voice's release has finished: hand any supersaw engine
+     * back to the pool (leased again at the next noteOn)
+     */
+    void voiceIdle();
+
     // =========================================================================
     // WAVEFORM & AMPLITUDE CONTROL
     // =========================================================================
@@ -69,6 +74,7 @@ public:
     
     void setSupersawDetune(float amount);  // Supersaw detune amount (0-1)
     void setSupersawMix(float mix);        // Supersaw voice mix (0-1)
+    bool hasSupersawEngine() const { return _supersaw != nullptr; }
     
     // =========================================================================
     // GLIDE (PORTAMENTO)
@@ -93,6 +99,9 @@ public:
     ArbBank getArbBank() const { return _arbBank; }
     uint16_t getArbTableIndex() const { return _arbIndex; }
 
+    // Peak CPU of the main oscillator per audio block (% of one block)
+    float mainOscCpuMax() { return _mainOsc.processorUsageMax(); }
+
     // =========================================================================
     // FEEDBACK OSCILLATION (JP-8000 STYLE)
     // =========================================================================
@@ -149,8 +158,27 @@ public:
     // =========================================================================
     
     AudioStream& output();
-    AudioMixer4& frequencyModMixer();
-    AudioMixer4& shapeModMixer();
+    AudioMixer4Q15& frequencyModMixer();
+    AudioMixer4Q15& shapeModMixer();
+
+    // =========================================================================
+    // DORMANT-NODE ELISION (see AudioDormancy.h)
+    // =========================================================================
+
+    /**
+     * @brief Park or wake the whole oscillator (decided by VoiceBlock from
+     * its mixer gains).  Takes effect at the next applyDormancy().
+     */
+    void setDormant(bool dormant);
+
+    /**
+     * @brief Park every node that can only reach output() through zero
+     * gains: main osc while supersaw is selected, supersaw otherwise, and
+     * the comb while feedback is off.  No-op unless something changed.
+     */
+    void applyDormancy();
+
+    uint8_t dormantNodes() const { return _dormantNodes; }
 
 private:
     // =========================================================================
@@ -158,11 +186,11 @@ private:
     // =========================================================================
     AudioSynthWaveformDc _frequencyDc;
     AudioSynthWaveformDc _shapeDc;
-    AudioMixer4 _frequencyModMixer;
-    AudioMixer4 _shapeModMixer;
+    AudioMixer4Q15 _frequencyModMixer;
+    AudioMixer4Q15 _shapeModMixer;
     AudioSynthWaveformModulated _mainOsc;
-    AudioSynthSupersaw* _supersaw;  // Pointer: nullptr if disabled (OSC2)
-    AudioMixer4 _outputMix;
+    AudioSynthSupersaw* _supersaw;  // Leased from SupersawPool, nullptr when none held
+    AudioMixer4Q15 _outputMix;
     
     // Audio connections - main path
     AudioConnection* _patchfrequencyDc;
@@ -170,7 +198,7 @@ private:
     AudioConnection* _patchfrequency;
     AudioConnection* _patchshape;
     AudioConnection* _patchMainOsc;
-    AudioConnection* _patchSupersaw;  // Conditional: only if supersaw enabled
+    AudioConnection* _patchSupersaw;  // Linked to the leased engine only
 
     // =========================================================================
     // FEEDBACK COMB NETWORK (JP-8000 SIMULATION)
@@ -185,12 +213,12 @@ private:
     static constexpr float FEEDBACK_DELAY_MS = 5.0f;
     
     // Comb filter components
-    AudioMixer4 _combMixer;          // Mixes exciter + feedback
+    AudioMixer4Q15 _combMixer;       // Mixes exciter + feedback
     AudioEffectDelay _combDelay;     // Short resonant delay
     
     // Audio connections - feedback path
     AudioConnection* _patchMainToComb;      // Main osc → comb mixer
-    AudioConnection* _patchSupersawToComb;  // Supersaw → comb mixer (may be nullptr)
+    AudioConnection* _patchSupersawToComb;  // Supersaw → comb mixer (leased engine only)
     AudioConnection* _patchDelayToComb;     // Delay out → comb mixer (feedback)
     AudioConnection* _patchCombToDelay;     // Comb mixer → delay in
     AudioConnection* _patchDelayToOut;      // Delay out → output mixer
@@ -199,7 +227,7 @@ private:
     // OSCILLATOR STATE
     // =========================================================================
     
-    bool _supersawEnabled;     // True if this osc can use supersaw (OSC1 only)
+    bool _sounding = false;    // Between noteOn and voiceIdle (supersaw lease window)
     bool _freqDirty = true;    // Frequency needs recalculation (CPU optimization)
     
     int _currentType = 1;
@@ -224,12 +252,41 @@ private:
     float _frequencyDcAmp = 0.0f;
     float _shapeDcAmp = 0.0f;
     
+    // Dormant-node elision
+    bool    _dormant        = false;   // Whole block parked by VoiceBlock
+    bool    _dormancyDirty  = true;
+    uint8_t _dormantNodes   = 0;
+    bool    _linkFrequency  = true;    // Cord states — every cord starts linked
+    bool    _linkShape      = true;
+    bool    _linkMainToComb = true;
+    bool    _linkSawToComb  = false;   // Unlinked until an engine is leased
+
     // Arbitrary waveforms
     ArbBank  _arbBank  = ArbBank::BwBlended;
     uint16_t _arbIndex = 0;
-    
+
+    // Band-limited playback (see AKWFMip.h): the shared mip set is blended
+    // by pitch into the back half of _arbBuf, then the halves swap
+    const AKWFMipSet* _arbMip      = nullptr;
+    int16_t*          _arbBuf      = nullptr;   // 4 × AKWF_MIP_SIZE (layout in .cpp), allocated on first use
+    uint8_t           _arbBufFront = 0;
+    int16_t           _arbMipKey   = -1;        // Level × 16 + blend step (sixteenths of the fade)
+
+    // Table switching: selects only mark a switch pending; update() applies
+    // the latest one at most once per audio block and morphs the playing
+    // table into the new one over ARB_XFADE_BLOCKS (phase runs on, no begin())
+    bool     _arbPending  = false;
+    bool     _arbPlaying  = false;   // _arbBuf front holds a published table
+    uint8_t  _arbFadeStep = 0;       // 0 = idle, else 1..ARB_XFADE_BLOCKS
+    uint32_t _arbStepUs   = 0;       // micros() of the last switch/fade step
+
     // =========================================================================
     // PRIVATE HELPERS
     // =========================================================================
-    void _applyArbWave();  // Load arbitrary waveform table
+    void _applyArbWave(bool crossfade);   // Acquire the selected table
+    void _serviceArbSwitch();             // Pending switch / fade step, once per block
+    void _updateArbMip(float freqHz);     // Re-render when the pitch crosses a step (or fading)
+    bool _leaseSupersaw();                // Engine from the pool, wired in; false when exhausted
+    void _returnSupersaw();               // Unwire and give the engine back
+    void _routeSupersaw();                // Gains for WAVEFORM_SUPERSAW (engine or saw fallback)
 };
\ No newline at end of file
@@ -7,18 +7,16 @@ using namespace JT4000Map;
 using namespace CC;
 
 int Patch::buildUsedCCList(uint8_t* outList, int maxCount) const {
-    const int n = min(maxCount, PatchSchema::kPatchableCount);
-    for (int i=0;i<n;++i) outList[i] = PatchSchema::kPatchableCCs[i];
+    const int n = min(maxCount, kSlots);
+    for (int i=0;i<n;++i) outList[i] = PatchSchema::ccOf((uint8_t)i);
     return n;
 }
 
 void Patch::captureFrom(SynthEngine& synth) {
     clear();
-    uint8_t used[128];
-    int n = buildUsedCCList(used, 128);
 
-    for (int i=0;i<n;++i) {
-        uint8_t cc = used[i];
+    for (int i=0;i<kSlots;++i) {
+        uint8_t cc = PatchSchema::ccOf((uint8_t)i);
         uint8_t cv = 0;
         switch (cc) {
             case FILTER_CUTOFF:    cv = cutoff_hz_to_cc(synth.getFilterCutoff()); break;
@@ -51,17 +49,17 @@ void Patch::captureFrom(SynthEngine& synth) {
             case GLIDE_ENABLE: cv = synth.getGlideEnabled() ? 127 : 0; break;
             case GLIDE_TIME:   cv = (uint8_t)constrain(lroundf((synth.getGlideTimeMs()/500.0f)*127.0f),0,127); break;
 
-            default: cv = value[cc]; break; // fallback
+            default: cv = value[i]; break; // fallback
         }
-        setCC(cc, cv);
+        setSlot((uint8_t)i, cv);
     }
 }
 
 void Patch::applyTo(SynthEngine& synth, uint8_t midiChannel, bool batch) const {
-    if (batch) AudioNoInterrupts();
-    for (int cc=0; cc<128; ++cc) {
-        if (!has[cc]) continue;
-        synth.handleControlChange(midiChannel, (uint8_t)cc, value[cc]);
+    if (batch) synth.beginPresetChange();
+    for (int i=0; i<kSlots; ++i) {
+        if (!hasSlot((uint8_t)i)) continue;
+        synth.handleControlChange(midiChannel, PatchSchema::ccOf((uint8_t)i), value[i]);
     }
-    if (batch) AudioInterrupts();
+    if (batch) synth.commitPresetChange();
 }
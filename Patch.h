@@ -3,41 +3,62 @@
 //#include "CCMap.h"       // use your existing ccMap pages/rows
 #include "SynthEngine.h" // for getters and CC apply
 #include "Mapping.h"     // JT4000Map: conversions for capture from engine
+#include "PatchSchema.h" // Patchable CCs and their slots
 
 // -----------------------------------------------------------------------------
 // Patch: CC-centric snapshot of a sound. 
-// - Only stores CCs that your UI actually uses (discovered from ccMap).
+// - Stores only the PatchSchema CCs, one byte per dense slot (PatchSchema.h)
+//   plus a stored-slot bitmask.
 // - Apply: calls SynthEngine::handleControlChange(ch, cc, val).
 // - Capture: converts engine getters -> CC values (uses Mapping.h curves).
+// - No patch-level diff: the engine drops every CC whose value it already
+//   holds (and re-applies CCs a linked CC overwrote), so applying a full
+//   patch only runs the handlers for what changed.
 // -----------------------------------------------------------------------------
 struct Patch {
+  static constexpr int kSlots = PatchSchema::kSlotCount;
+  static constexpr int kWords = (kSlots + 31) / 32;
+
   // Optional metadata
   char     name[24]   = "Init";
   uint8_t  version    = 1;
 
-  // Storage: for each CC (0..127), whether we store it and the last value
-  bool     has[128];            // initialized in clear()
-  uint8_t  value[128];          // 0..127
+  // Storage: per slot, whether we store it and the last value
+  uint32_t has[kWords];         // Bit per slot; initialized in clear()
+  uint8_t  value[kSlots];       // 0..127
 
   Patch() { clear(); }
 
   // Reset contents
   void clear() {
-    for (int i = 0; i < 128; ++i) { has[i] = false; value[i] = 0; }
+    for (int w = 0; w < kWords; ++w) has[w] = 0;
+    for (int i = 0; i < kSlots; ++i) value[i] = 0;
   }
 
-  // Set / get a single CC explicitly
-  void setCC(uint8_t cc, uint8_t v) { has[cc] = true; value[cc] = v; }
-  bool getCC(uint8_t cc, uint8_t &out) const { if (!has[cc]) return false; out = value[cc]; return true; }
+  // Per slot (0..kSlots-1)
+  bool hasSlot(uint8_t slot) const { return (has[slot >> 5] >> (slot & 31)) & 1u; }
+  void setSlot(uint8_t slot, uint8_t v) { has[slot >> 5] |= 1u << (slot & 31); value[slot] = v; }
+
+  // Set / get a single CC explicitly (CCs outside PatchSchema are ignored)
+  void setCC(uint8_t cc, uint8_t v) {
+    const uint8_t s = PatchSchema::slotOf(cc);
+    if (s != PatchSchema::kNoSlot) setSlot(s, v);
+  }
+  bool getCC(uint8_t cc, uint8_t &out) const {
+    const uint8_t s = PatchSchema::slotOf(cc);
+    if (s == PatchSchema::kNoSlot || !hasSlot(s)) return false;
+    out = value[s]; return true;
+  }
 
-  // Build the set of CCs used by the UI pages (unique set from ccMap)
+  // Build the set of patchable CCs (PatchSchema slot order)
   // Returns how many CCs were found
   int buildUsedCCList(uint8_t* outList, int maxCount) const;
 
-  // Capture engine state into CCs (only those present in ccMap)
+  // Capture engine state into CCs (every PatchSchema CC)
   void captureFrom(SynthEngine& synth);
 
-  // Apply CCs to engine (optionally batch with AudioNoInterrupts)
+  // Apply CCs to engine (batch: as one preset change — staged, swapped at
+  // a block boundary behind the bus crossfade; see SynthEngine.h)
   void applyTo(SynthEngine& synth, uint8_t midiChannel = 1, bool batch = true) const;
 
   // Serialize as compact JSON: {"name":"...", "v":1, "cc":{"23":64,"24":80,...}}
@@ -4,6 +4,11 @@
  * -------------
  * Defines which CCs are captured/restored by patches.
  * This intentionally does NOT depend on any UI layout.
+ *
+ * Each CC may appear once (checked at compile time).  Patches store one byte
+ * per patchable CC in a dense slot (kSlotCount of them); slots are generated
+ * from this list in ascending CC order, so walking the slots applies a patch
+ * in the same order as a 0..127 sweep.
  */
 
 #include <Arduino.h>
@@ -38,6 +43,7 @@ static constexpr uint8_t kPatchableCCs[] = {
     // LFOs
     CC::LFO1_FREQ, CC::LFO1_DEPTH, CC::LFO1_DESTINATION, CC::LFO1_WAVEFORM,
     CC::LFO2_FREQ, CC::LFO2_DEPTH, CC::LFO2_DESTINATION, CC::LFO2_WAVEFORM,
+    CC::LFO1_KEY_SYNC, CC::LFO2_KEY_SYNC,
 
     // Pitch envelope
     CC::PITCH_ENV_ATTACK, CC::PITCH_ENV_DECAY, CC::PITCH_ENV_SUSTAIN, CC::PITCH_ENV_RELEASE,
@@ -82,19 +88,50 @@ CC::FX_DRY_MIX,
     CC::RING1_MIX, CC::RING2_MIX,
     CC::OSC1_FREQ_DC, CC::OSC1_SHAPE_DC,
     CC::OSC2_FREQ_DC, CC::OSC2_SHAPE_DC,
-
-    // LFO per-destination depths (NEW)
-    CC::LFO1_PITCH_DEPTH,  CC::LFO1_FILTER_DEPTH, CC::LFO1_PWM_DEPTH, CC::LFO1_AMP_DEPTH, CC::LFO1_DELAY,
-    CC::LFO2_PITCH_DEPTH,  CC::LFO2_FILTER_DEPTH, CC::LFO2_PWM_DEPTH, CC::LFO2_AMP_DEPTH, CC::LFO2_DELAY,
-
-    // Pitch envelope (NEW)
-    CC::PITCH_ENV_ATTACK, CC::PITCH_ENV_DECAY, CC::PITCH_ENV_SUSTAIN,
-    CC::PITCH_ENV_RELEASE, CC::PITCH_ENV_DEPTH,
-
-    // Velocity sensitivity (NEW)
-    CC::VELOCITY_AMP_SENS, CC::VELOCITY_FILTER_SENS, CC::VELOCITY_ENV_SENS,
 };
 
 static constexpr int kPatchableCount = sizeof(kPatchableCCs) / sizeof(kPatchableCCs[0]);
 
+// ---- Generated slot index ---------------------------------------------------
+static constexpr uint8_t kNoSlot   = 0xFF;
+static constexpr int     kSlotCount = kPatchableCount;
+
+namespace _schema_internal {
+    constexpr bool unique() {
+        for (int i = 0; i < kPatchableCount; ++i)
+            for (int j = i + 1; j < kPatchableCount; ++j)
+                if (kPatchableCCs[i] == kPatchableCCs[j]) return false;
+        return true;
+    }
+
+    constexpr bool listed(int cc) {
+        for (int i = 0; i < kPatchableCount; ++i)
+            if (kPatchableCCs[i] == cc) return true;
+        return false;
+    }
+
+    struct Index {
+        uint8_t slotOf[128];          // CC → slot, kNoSlot if not patchable
+        uint8_t ccOf[kSlotCount];     // Slot → CC, ascending
+    };
+
+    constexpr Index build() {
+        Index x{};
+        int n = 0;
+        for (int cc = 0; cc < 128; ++cc) {
+            x.slotOf[cc] = kNoSlot;
+            if (listed(cc)) { x.slotOf[cc] = (uint8_t)n; x.ccOf[n++] = (uint8_t)cc; }
+        }
+        return x;
+    }
+} // namespace _schema_internal
+
+static_assert(_schema_internal::unique(), "PatchSchema::kPatchableCCs lists a CC twice");
+static_assert(kSlotCount < kNoSlot, "Patch slots must fit in a byte");
+
+inline constexpr _schema_internal::Index kIndex = _schema_internal::build();
+
+inline uint8_t slotOf(uint8_t cc)  { return kIndex.slotOf[cc & 0x7F]; }
+inline uint8_t ccOf(uint8_t slot)  { return kIndex.ccOf[slot]; }
+
 } // namespace PatchSchema
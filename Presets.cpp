@@ -62,6 +62,7 @@ void loadInitTemplateByWave(SynthEngine &synth, uint8_t waveIndex) {
     uint8_t waveCC = ccFromWaveform(wfType);
 
     // Now send CC values using the full 0–127 range.
+    synth.beginPresetChange();
     sendCC(synth, CC::OSC1_WAVE, waveCC);
     sendCC(synth, CC::OSC2_WAVE, waveCC);
 
@@ -138,11 +139,11 @@ sendCC(synth, CC::FX_DRY_MIX, 127);      // Full dry (effects off)
     sendCC(synth, CC::GLIDE_TIME,   0);
     sendCC(synth, CC::AMP_MOD_FIXED_LEVEL, 127);
 
-    AudioInterrupts();
+    synth.commitPresetChange();
 }
 
 void loadRawPatchViaCC(SynthEngine& synth, const uint8_t data[64], uint8_t midiCh) {
-    AudioNoInterrupts();
+    synth.beginPresetChange();
     for (const auto& row : JT4000Map::kSlots) {
         uint8_t idx0 = (row.byte1 >= 1) ? (row.byte1 - 1) : 0;
         if (idx0 >= 64) continue;
@@ -150,7 +151,7 @@ void loadRawPatchViaCC(SynthEngine& synth, const uint8_t data[64], uint8_t midiC
         uint8_t val = JT4000Map::toCC(raw, row.xf);
         synth.handleControlChange(midiCh, row.cc, val);
     }
-    AudioInterrupts();
+    synth.commitPresetChange();
 }
 
 void loadMicrospherePreset(SynthEngine& synth, int index, uint8_t midiCh) {
@@ -170,7 +171,7 @@ void loadTUSPreset(SynthEngine& synth, int index) {
     TUSPatch p;
     memcpy_P(&p, &kTUS_Patches[index], sizeof(TUSPatch));
 
-    AudioNoInterrupts();
+    synth.beginPresetChange();
 
     sendCC(synth, CC::OSC1_WAVE,        p.osc1Wave);
     sendCC(synth, CC::OSC2_WAVE,        p.osc2Wave);
@@ -221,7 +222,7 @@ void loadTUSPreset(SynthEngine& synth, int index) {
         sendCC(synth, CC::FX_JPFX_DELAY_FEEDBACK, p.fxParam2);
     }
 
-    AudioInterrupts();
+    synth.commitPresetChange();
 }
 
 } // namespace Presets
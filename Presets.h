@@ -9,6 +9,8 @@ namespace Presets {
   // Load the “init” template for a given OSC1 waveform index (0..8).
   // Applies by sending CC values through SynthEngine::handleControlChange
   // to keep everything aligned with your current CC pipeline.
+  // Every loader here brackets its CCs with begin/commitPresetChange(), so
+  // the patch swaps in at one block boundary behind the bus crossfade.
   void loadInitTemplateByWave(SynthEngine& synth, uint8_t waveIndex);
 
   // Convenience: load by a simple 0..8 number (same as waveIndex).
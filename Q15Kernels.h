@@ -0,0 +1,140 @@
+#pragma once
+#include <stdint.h>
+#include <AudioStream.h>
+
+// ============================================================================
+// Q15Kernels: block kernels for the voice mixers and ring modulators
+// ----------------------------------------------------------------------------
+// Same arithmetic as the stock AudioMixer4 / AudioEffectMultiply, so the
+// replacements are level- and bit-identical:
+//   scale     out = sat16((m · in) >> 16)            m: Q16 gain (65536 = 1.0)
+//   scaleAdd  out = sat16(out + ((m · in) >> 16))
+//   add       out = sat16(out + in)
+//   multiply  out = sat16((a · b) >> 15)
+//
+// On the Teensy 4 (Cortex-M7 DSP extension) each loop step handles two
+// samples per 32-bit word: SMULWB/SMULWT for the gains, SSAT + PKHBT to pack,
+// QADD16 for the saturating adds, SMULBB/SMULTT for the products.  Host
+// builds use a portable C++ version with the same results.  Q15_DSP
+// selects the dual-sample path; the host tests set it over an emulated
+// dspinst.h to hold both paths and the stock objects to the same output.
+//
+// Blocks must be word-aligned (audio_block_t::data is).
+// ============================================================================
+
+#if !defined(Q15_DSP) && defined(__IMXRT1062__)
+#define Q15_DSP 1
+#endif
+
+#if Q15_DSP
+#include <dspinst.h>
+#endif
+
+namespace Q15 {
+
+static constexpr int32_t kUnity = 65536;   // Q16 unity gain
+
+// AudioMixer4::gain() conversion (clamped, truncated)
+inline int32_t gainQ16(float g) {
+    if (g >  32767.0f) g =  32767.0f;
+    if (g < -32767.0f) g = -32767.0f;
+    return (int32_t)(g * 65536.0f);
+}
+
+// Portable path, always built
+namespace portable {
+
+inline int16_t sat16(int32_t v) {
+    return (int16_t)(v > 32767 ? 32767 : (v < -32768 ? -32768 : v));
+}
+
+inline void scale(int16_t* out, const int16_t* in, int32_t m) {
+    for (uint16_t i = 0; i < AUDIO_BLOCK_SAMPLES; ++i) {
+        out[i] = sat16((int32_t)(((int64_t)m * in[i]) >> 16));
+    }
+}
+
+inline void scaleAdd(int16_t* out, const int16_t* in, int32_t m) {
+    for (uint16_t i = 0; i < AUDIO_BLOCK_SAMPLES; ++i) {
+        out[i] = sat16(out[i] + sat16((int32_t)(((int64_t)m * in[i]) >> 16)));
+    }
+}
+
+inline void add(int16_t* out, const int16_t* in) {
+    for (uint16_t i = 0; i < AUDIO_BLOCK_SAMPLES; ++i) {
+        out[i] = sat16(out[i] + in[i]);
+    }
+}
+
+inline void multiply(int16_t* out, const int16_t* a, const int16_t* b) {
+    for (uint16_t i = 0; i < AUDIO_BLOCK_SAMPLES; ++i) {
+        out[i] = sat16(((int32_t)a[i] * b[i]) >> 15);
+    }
+}
+
+} // namespace portable
+
+#if Q15_DSP
+
+// Two samples per word (Cortex-M7 DSP extension)
+namespace dsp {
+
+inline void scale(int16_t* out, const int16_t* in, int32_t m) {
+    const uint32_t* s = (const uint32_t*)in;
+    uint32_t*       d = (uint32_t*)out;
+    for (uint16_t i = 0; i < AUDIO_BLOCK_SAMPLES / 2; ++i) {
+        const uint32_t w = s[i];
+        const int32_t lo = signed_saturate_rshift(signed_multiply_32x16b(m, w), 16, 0);
+        const int32_t hi = signed_saturate_rshift(signed_multiply_32x16t(m, w), 16, 0);
+        d[i] = pack_16b_16b(hi, lo);
+    }
+}
+
+inline void scaleAdd(int16_t* out, const int16_t* in, int32_t m) {
+    const uint32_t* s = (const uint32_t*)in;
+    uint32_t*       d = (uint32_t*)out;
+    for (uint16_t i = 0; i < AUDIO_BLOCK_SAMPLES / 2; ++i) {
+        const uint32_t w = s[i];
+        const int32_t lo = signed_saturate_rshift(signed_multiply_32x16b(m, w), 16, 0);
+        const int32_t hi = signed_saturate_rshift(signed_multiply_32x16t(m, w), 16, 0);
+        d[i] = signed_add_16_and_16(d[i], pack_16b_16b(hi, lo));
+    }
+}
+
+inline void add(int16_t* out, const int16_t* in) {
+    const uint32_t* s = (const uint32_t*)in;
+    uint32_t*       d = (uint32_t*)out;
+    for (uint16_t i = 0; i < AUDIO_BLOCK_SAMPLES / 2; ++i) {
+        d[i] = signed_add_16_and_16(d[i], s[i]);
+    }
+}
+
+inline void multiply(int16_t* out, const int16_t* a, const int16_t* b) {
+    const uint32_t* pa = (const uint32_t*)a;
+    const uint32_t* pb = (const uint32_t*)b;
+    uint32_t*       d  = (uint32_t*)out;
+    for (uint16_t i = 0; i < AUDIO_BLOCK_SAMPLES / 2; ++i) {
+        const uint32_t wa = pa[i], wb = pb[i];
+        const int32_t lo = signed_saturate_rshift(multiply_16bx16b(wa, wb), 16, 15);
+        const int32_t hi = signed_saturate_rshift(multiply_16tx16t(wa, wb), 16, 15);
+        d[i] = pack_16b_16b(hi, lo);
+    }
+}
+
+} // namespace dsp
+
+using dsp::scale;
+using dsp::scaleAdd;
+using dsp::add;
+using dsp::multiply;
+
+#else
+
+using portable::scale;
+using portable::scaleAdd;
+using portable::add;
+using portable::multiply;
+
+#endif
+
+} // namespace Q15
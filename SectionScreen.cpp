@@ -410,6 +410,8 @@ void SectionScreen::_openEnumEntry(uint8_t cc, const char* title) {
                                       "1/2","1/4","1/8","1/16",
                                       "1/4T","1/8T","1/16T","1/32T" };
     static const char* kClkSrc[]  = { "Internal","External" };
+    static const char* kTransport[] = { "Stop","Play" };
+    static const char* kKeySync[] = { "Free","Key" };
     static const char* kOnOff[]   = { "Off","On" };
     static const char* kBypass[]  = { "Active","Bypass" };
 
@@ -434,6 +436,9 @@ void SectionScreen::_openEnumEntry(uint8_t cc, const char* title) {
         case CC::LFO2_TIMING_MODE:
         case CC::DELAY_TIMING_MODE: opts = kSync;   count = 12; break;
         case CC::BPM_CLOCK_SOURCE: opts = kClkSrc;  count = 2;  break;
+        case CC::BPM_TRANSPORT:    opts = kTransport; count = 2; break;
+        case CC::LFO1_KEY_SYNC:
+        case CC::LFO2_KEY_SYNC:    opts = kKeySync; count = 2;  break;
         case CC::FX_REVERB_BYPASS: opts = kBypass;  count = 2;  break;
         default:                   opts = kOnOff;   count = 2;  break;
     }
@@ -601,6 +606,8 @@ const char* SectionScreen::_ccName(uint8_t cc) const {
             cc == CC::LFO1_DESTINATION      || cc == CC::LFO2_DESTINATION       ||
             cc == CC::LFO1_TIMING_MODE      || cc == CC::LFO2_TIMING_MODE       ||
             cc == CC::DELAY_TIMING_MODE     || cc == CC::BPM_CLOCK_SOURCE       ||
+            cc == CC::BPM_TRANSPORT         ||
+            cc == CC::LFO1_KEY_SYNC         || cc == CC::LFO2_KEY_SYNC          ||
             cc == CC::GLIDE_ENABLE          || cc == CC::FX_REVERB_BYPASS       ||
             cc == CC::FILTER_OBXA_TWO_POLE  ||
             cc == CC::FILTER_OBXA_BP_BLEND_2_POLE ||
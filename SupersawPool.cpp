@@ -0,0 +1,77 @@
+#include "SupersawPool.h"
+#include "AudioDormancy.h"
+#include "AudioLock.h"
+#include "DebugTrace.h"
+
+namespace {
+
+AudioSynthSupersaw* s_engines[SUPERSAW_POOL_SIZE] = { nullptr };
+bool                s_leased[SUPERSAW_POOL_SIZE]  = { false };
+bool                s_oversample = false;
+SupersawPool::Stats s_stats;
+
+} // namespace
+
+namespace SupersawPool {
+
+AudioSynthSupersaw* lease() {
+    int8_t slot = -1;
+    for (uint8_t i = 0; i < s_stats.created; ++i) {
+        if (!s_leased[i]) { slot = (int8_t)i; break; }
+    }
+
+    if (slot < 0 && s_stats.created < SUPERSAW_POOL_SIZE) {
+        // Joins the audio update list, parked like every engine in the
+        // pool; keep the ISR out while it does
+        AudioLock::hold();
+        AudioSynthSupersaw* e = new AudioSynthSupersaw();
+        AudioDormancy::setActive(*e, false);
+        AudioLock::release();
+        e->setMixCompensation(true);
+        e->setCompensationMaxGain(1.5f);
+        e->setBandLimited(false);
+        e->setBlepTable(true);
+        slot = (int8_t)s_stats.created;
+        s_engines[s_stats.created++] = e;
+    }
+
+    if (slot < 0) {
+        s_stats.exhausted++;
+        JT_LOGF("[SSPOOL] exhausted: %u engines leased, plain saw fallback (%lu refused)\n",
+                SUPERSAW_POOL_SIZE, (unsigned long)s_stats.exhausted);
+        return nullptr;
+    }
+
+    AudioSynthSupersaw* e = s_engines[slot];
+    AudioLock::hold();
+    e->reset();
+    e->setAmplitude(0.0f);
+    e->setOversample(s_oversample);
+    AudioLock::release();
+
+    s_leased[slot] = true;
+    if (++s_stats.leased > s_stats.peak) s_stats.peak = s_stats.leased;
+    return e;
+}
+
+void giveBack(AudioSynthSupersaw* engine) {
+    if (!engine) return;
+    for (uint8_t i = 0; i < s_stats.created; ++i) {
+        if (s_engines[i] != engine || !s_leased[i]) continue;
+        AudioDormancy::setActive(*engine, false);
+        s_leased[i] = false;
+        s_stats.leased--;
+        return;
+    }
+}
+
+void setOversample(bool enable) {
+    s_oversample = enable;
+    AudioLock::hold();
+    for (uint8_t i = 0; i < s_stats.created; ++i) s_engines[i]->setOversample(enable);
+    AudioLock::release();
+}
+
+Stats stats() { return s_stats; }
+
+} // namespace SupersawPool
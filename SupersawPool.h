@@ -0,0 +1,44 @@
+#pragma once
+#include <Arduino.h>
+#include "AudioSynthSupersaw.h"
+
+// ============================================================================
+// SupersawPool: supersaw engines leased to oscillators on demand
+// ----------------------------------------------------------------------------
+// Any OscillatorBlock (OSC1 or OSC2 of any voice) playing WAVEFORM_SUPERSAW
+// leases an engine at note-on and returns it when its voice has gone idle
+// or its waveform changes, so patches without supersaw carry no engines and
+// dual-supersaw patches are possible.
+//
+// Engines are created on first demand (up to SUPERSAW_POOL_SIZE, never
+// freed) and parked while unleased.  When every engine is out, lease()
+// returns nullptr and the oscillator falls back to a plain saw on its main
+// oscillator until a later note-on finds an engine free.
+//
+// Loop context only (same as every OscillatorBlock setter).
+// ============================================================================
+
+#ifndef SUPERSAW_POOL_SIZE
+#define SUPERSAW_POOL_SIZE  8   // One per voice; dual-supersaw patches share them
+#endif
+
+namespace SupersawPool {
+
+// Engine in its power-on state, not yet connected; nullptr when exhausted
+AudioSynthSupersaw* lease();
+
+// Hand an engine back (its cords must already be disconnected)
+void giveBack(AudioSynthSupersaw* engine);
+
+// 2× oversampling for every engine, including ones created later
+void setOversample(bool enable);
+
+struct Stats {
+    uint8_t  created   = 0;   // Engines allocated so far
+    uint8_t  leased    = 0;   // Currently held by an oscillator
+    uint8_t  peak      = 0;   // Most held at once since boot
+    uint32_t exhausted = 0;   // Leases refused (oscillator fell back to a saw)
+};
+Stats stats();
+
+} // namespace SupersawPool
@@ -2,7 +2,13 @@
 #include "SynthEngine.h"
 #include "Mapping.h"
 #include "CCDefs.h"
+#include "AudioDormancy.h"
+#include "AudioLock.h"
 #include "Waveforms.h"   // ensure waveformFromCC + names are available
+#include "AKWFMip.h"
+#include "WaveTablePool.h"
+#include "SupersawPool.h"
+#include "CCDispatch.h"
  
 
 using namespace CC;
@@ -30,81 +36,46 @@ SynthEngine::SynthEngine()
     }
     for (int i = 0; i < 128; i++) {
         _noteToVoice[i] = VOICE_NONE;
+        _ccApplied[i]   = CC_NEVER;
     }
 
     // =========================================================================
     // SETUP AMP MODULATION DC SOURCES
     // =========================================================================
     _ampModFixedDc.amplitude(_ampModFixedLevel);
-    _ampModLimitFixedDc.amplitude(1.0f);
-    
-    // Amp mod mixer: Fixed DC + LFO1 + LFO2 → multiply with voice mixer
+
+    // Amp mod mixer: Fixed DC + LFO1 + LFO2 → _voiceSum mod input
     _ampModMixer.gain(0, 1.0f);  // Fixed DC
     _ampModMixer.gain(1, 0.0f);  // LFO1 (amount controlled by setLFO1Amount)
     _ampModMixer.gain(2, 0.0f);  // LFO2 (amount controlled by setLFO2Amount)
     _ampModMixer.gain(3, 0.0f);  // Unused
-    
-    _ampModLimiterMixer.gain(0, 1.0f);  // Amp mod output
-    _ampModLimiterMixer.gain(1, 0.0f);  // Limiter (unused)
-    _ampModLimiterMixer.gain(2, 0.0f);  // Unused
-    _ampModLimiterMixer.gain(3, 0.0f);  // Unused
 
     // =========================================================================
-    // SETUP 8-VOICE MIXER ARCHITECTURE
+    // SETUP VOICE SUMMING BUS (see AudioMixerN.h)
     // =========================================================================
-    
-    // Sub-mixer A (voices 0-3) - gain 0.5 prevents clipping
-    for (int i = 0; i < 4; i++) {
-        _voiceMixerA.gain(i, 1.0f);
-    }
-    
-    // Sub-mixer B (voices 4-7) - gain 0.5 prevents clipping
-    for (int i = 0; i < 4; i++) {
-        _voiceMixerB.gain(i, 1.0f);
-    }
-    
-    // Final mixer (combines A and B) - gain 0.5 prevents clipping
-    _voiceMixerFinal.gain(0, 0.1f);  // Sub-mixer A
-    _voiceMixerFinal.gain(1, 0.1f);  // Sub-mixer B
-    _voiceMixerFinal.gain(2, 0.0f);  // Unused
-    _voiceMixerFinal.gain(3, 0.0f);  // Unused
 
-    // =========================================================================
-    // CREATE AUDIO CONNECTIONS - VOICES TO MIXERS
-    // =========================================================================
-    
-    // Connect voices 0-3 to sub-mixer A
-    for (int i = 0; i < 4; i++) {
-        _voicePatch[i] = new AudioConnection(_voices[i].output(), 0, _voiceMixerA, i);
-    }
-    
-    // Connect voices 4-7 to sub-mixer B  
-    for (int i = 4; i < 8; i++) {
-        _voicePatch[i] = new AudioConnection(_voices[i].output(), 0, _voiceMixerB, i - 4);
+    // Voices at unity into the 32-bit sum; headroom applied once as master
+    _voiceSum.masterGain(VOICE_SUM_GAIN);
+    _voiceSum.softLimit(0.9f);
+
+    for (int i = 0; i < MAX_VOICES; i++) {
+        _voicePatch[i] = new AudioConnection(_voices[i].output(), 0, _voiceSum, i);
     }
-    
-    // Connect sub-mixers to final mixer
-    _patchMixerAToFinal = new AudioConnection(_voiceMixerA, 0, _voiceMixerFinal, 0);
-    _patchMixerBToFinal = new AudioConnection(_voiceMixerB, 0, _voiceMixerFinal, 1);
 
     // =========================================================================
-    // CREATE AUDIO CONNECTIONS - LFO TO VOICES (8 VOICES)
+    // CREATE AUDIO CONNECTIONS - LFO TO VOICES
     // =========================================================================
     
+    // Voices patch the unfaded LFO output into their own LFO stage, which
+    // applies the delay ramp (and optional key sync) per voice in the audio
+    // update and feeds the voice's mod mixers (see VoiceBlock.h).
     for (int i = 0; i < MAX_VOICES; i++) {
-        // LFO1 connections - use your actual VoiceBlock method names
-        _voicePatchLFO1ShapeOsc1[i]     = new AudioConnection(_lfo1.output(), 0, _voices[i].shapeModMixerOsc1(), 1);
-        _voicePatchLFO1ShapeOsc2[i]     = new AudioConnection(_lfo1.output(), 0, _voices[i].shapeModMixerOsc2(), 1);
-        _voicePatchLFO1FrequencyOsc1[i] = new AudioConnection(_lfo1.output(), 0, _voices[i].frequencyModMixerOsc1(), 1);
-        _voicePatchLFO1FrequencyOsc2[i] = new AudioConnection(_lfo1.output(), 0, _voices[i].frequencyModMixerOsc2(), 1);
-        _voicePatchLFO1Filter[i]        = new AudioConnection(_lfo1.output(), 0, _voices[i].filterModMixer(), 2);
-        
-        // LFO2 connections - use your actual VoiceBlock method names
-        _voicePatchLFO2ShapeOsc1[i]     = new AudioConnection(_lfo2.output(), 0, _voices[i].shapeModMixerOsc1(), 2);
-        _voicePatchLFO2ShapeOsc2[i]     = new AudioConnection(_lfo2.output(), 0, _voices[i].shapeModMixerOsc2(), 2);
-        _voicePatchLFO2FrequencyOsc1[i] = new AudioConnection(_lfo2.output(), 0, _voices[i].frequencyModMixerOsc1(), 2);
-        _voicePatchLFO2FrequencyOsc2[i] = new AudioConnection(_lfo2.output(), 0, _voices[i].frequencyModMixerOsc2(), 2);
-        _voicePatchLFO2Filter[i]        = new AudioConnection(_lfo2.output(), 0, _voices[i].filterModMixer(), 3);
+        _voices[i].attachParams(&_params);
+        _voices[i].setLFOSource(0, &_lfo1);
+        _voices[i].setLFOSource(1, &_lfo2);
+
+        _voicePatchLFO1[i] = new AudioConnection(_lfo1.rawOutput(), 0, _voices[i].lfoInput(0), 0);
+        _voicePatchLFO2[i] = new AudioConnection(_lfo2.rawOutput(), 0, _voices[i].lfoInput(1), 0);
     }
 
     // =========================================================================
@@ -157,19 +128,19 @@ SynthEngine::SynthEngine()
     _patchAmpModFixedDcToAmpModMixer = new AudioConnection(_ampModFixedDc, 0, _ampModMixer, 0);
     _patchLFO1ToAmpModMixer          = new AudioConnection(_lfo1.output(), 0, _ampModMixer, 1);
     _patchLFO2ToAmpModMixer          = new AudioConnection(_lfo2.output(), 0, _ampModMixer, 2);
-    _patchAmpModMixerToAmpMultiply   = new AudioConnection(_ampModMixer, 0, _ampMultiply, 0);
-    _patchVoiceMixerToAmpMultiply    = new AudioConnection(_voiceMixerFinal, 0, _ampMultiply, 1);
+    _patchAmpModMixerToVoiceSum      = new AudioConnection(_ampModMixer, 0, _voiceSum, AudioMixerN<MAX_VOICES>::MOD_INPUT);
 
-// Connect amp to JPFX (stereo)
-_fxPatchInL = new AudioConnection(_ampMultiply, 0, _fxChain.getJPFXInput(), 0);
-_fxPatchInR = new AudioConnection(_ampMultiply, 0, _fxChain.getJPFXInput(), 1);
+// Connect voice sum to JPFX (stereo)
+_fxPatchInL = new AudioConnection(_voiceSum, 0, _fxChain.getJPFXInput(), 0);
+_fxPatchInR = new AudioConnection(_voiceSum, 0, _fxChain.getJPFXInput(), 1);
 
-// Connect amp dry to mixer (channel 0)
-_fxPatchDryL = new AudioConnection(_ampMultiply, 0, _fxChain.getOutputLeft(), 0);
-_fxPatchDryR = new AudioConnection(_ampMultiply, 0, _fxChain.getOutputRight(), 0);
-}
+// Connect voice sum dry to mixer (channel 0)
+_fxPatchDryL = new AudioConnection(_voiceSum, 0, _fxChain.getOutputLeft(), 0);
+_fxPatchDryR = new AudioConnection(_voiceSum, 0, _fxChain.getOutputRight(), 0);
 
-static inline float CCtoTime(uint8_t cc) { return JT4000Map::cc_to_time_ms(cc); }
+    // Amp-mod chain starts parked (no LFO amp depth, unity fixed level)
+    _applyAmpModDormancy();
+}
 
 // Safe CC-name lookup for logs (avoids nullptr)
 static inline const char* ccname(uint8_t cc) {
@@ -187,30 +158,44 @@ void SynthEngine::setBPMClock(BPMClockManager* clock) {
     _bpmClock = clock;
 }
 
+void SynthEngine::setBPMClockSource(bool external) {
+    if (!_bpmClock) return;
+    _bpmClock->setClockSource(external ? ClockSource::CLOCK_EXTERNAL_MIDI : ClockSource::CLOCK_INTERNAL);
+}
+
+void SynthEngine::setBPMInternalTempo(float bpm) {
+    if (_bpmClock) _bpmClock->setInternalBPM(bpm);
+}
+
+// Internal clock master → DIN/USB
+void SynthEngine::setBPMTransport(bool play) {
+    if (!_bpmClock) return;
+    if (play) _bpmClock->startTransport();
+    else      _bpmClock->stopTransport();
+}
+
 void SynthEngine::updateBPMSync() {
-    // Called from update() to refresh BPM-synced parameters
+    // Called from update().  Tempo-derived parameters are only re-sent when
+    // the clock reports a tempo change.
     if (!_bpmClock) return;
-    
-    // Update LFO1 if synced
-    TimingMode lfo1Mode = _lfo1.getTimingMode();
-    if (lfo1Mode != TimingMode::TIMING_FREE) {
-        float hz = _bpmClock->getFrequencyForMode(lfo1Mode);
-        _lfo1.setFrequency(hz);
-    }
-    
-    // Update LFO2 if synced
-    TimingMode lfo2Mode = _lfo2.getTimingMode();
-    if (lfo2Mode != TimingMode::TIMING_FREE) {
-        float hz = _bpmClock->getFrequencyForMode(lfo2Mode);
-        _lfo2.setFrequency(hz);
-    }
-    
-    // Update delay if synced
-    TimingMode delayMode = _fxChain.getDelayTimingMode();
-    if (delayMode != TimingMode::TIMING_FREE) {
-        float ms = _bpmClock->getTimeForMode(delayMode);
-        _fxChain.setDelayTime(ms);
+
+    // Tempo change → new LFO rates and delay time
+    const uint32_t tempoRev = _bpmClock->getTempoRevision();
+    if (tempoRev != _bpmTempoRevision) {
+        _bpmTempoRevision = tempoRev;
+        _lfo1.updateFromBPMClock(*_bpmClock);
+        _lfo2.updateFromBPMClock(*_bpmClock);
+
+        TimingMode delayMode = _fxChain.getDelayTimingMode();
+        if (delayMode != TimingMode::TIMING_FREE) {
+            float ms = _bpmClock->getTimeForMode(delayMode);
+            _fxChain.setDelayTime(ms);
+        }
     }
+
+    // Synced LFO phase is read from the clock snapshot by the audio update
+    // itself (see AudioSynthLFO::lockToClock), so nothing else to do here.
+    _bpmClock->update();
 }
 
 // ============================================================================
@@ -224,9 +209,9 @@ void SynthEngine::setLFO1TimingMode(TimingMode mode) {
         // Restore manual frequency control
         _lfo1.setFrequency(_lfo1Frequency);
     } else if (_bpmClock) {
-        // Lock to BPM
-        float hz = _bpmClock->getFrequencyForMode(mode);
-        _lfo1.setFrequency(hz);
+        // Lock to BPM — rate and phase
+        _lfo1.updateFromBPMClock(*_bpmClock);
+        _lfo1.syncToClock(*_bpmClock);
     }
 }
 
@@ -237,9 +222,9 @@ void SynthEngine::setLFO2TimingMode(TimingMode mode) {
         // Restore manual frequency control
         _lfo2.setFrequency(_lfo2Frequency);
     } else if (_bpmClock) {
-        // Lock to BPM
-        float hz = _bpmClock->getFrequencyForMode(mode);
-        _lfo2.setFrequency(hz);
+        // Lock to BPM — rate and phase
+        _lfo2.updateFromBPMClock(*_bpmClock);
+        _lfo2.syncToClock(*_bpmClock);
     }
 }
 
@@ -278,13 +263,18 @@ void SynthEngine::noteOn(byte note, float velocity) {
     float freq = 440.0f * powf(2.0f, (note - 69) / 12.0f);
     _lastNoteFreq = freq;
 
-    // Restart LFO delay ramps on any noteOn (standard JP-8000 retrigger behaviour)
-    if (_lfo1DelayMs > 0.0f) { _lfo1NoteOnMs = millis(); _lfo1Ramping = true; _lfo1CurrentAmp = 0.0f; }
-    if (_lfo2DelayMs > 0.0f) { _lfo2NoteOnMs = millis(); _lfo2Ramping = true; _lfo2CurrentAmp = 0.0f; }
+    // Parameters set since the last update() must reach the voice first
+    _publishParams();
+
+    // Restart the shared LFO delay ramp for the global amp destination.
+    // Voice destinations restart their own ramp in VoiceBlock::noteOn().
+    _lfo1.retrigger();
+    _lfo2.retrigger();
 
     // Limit per-voice amplitude to 0.95 — leaves headroom when multiple
-    // voices sound simultaneously.  With 8 voices all at 1.0 the summed
-    // signal would clip the final mixer; 0.95 keeps worst-case < full scale.
+    // voices sound simultaneously.  With every voice at 1.0 the summed
+    // signal would push _voiceSum into its soft limiter; 0.95 keeps the
+    // worst case below the knee.
     static constexpr float MAX_VOICE_VELOCITY = 0.95f;
     if (velocity > MAX_VOICE_VELOCITY) velocity = MAX_VOICE_VELOCITY;
 
@@ -294,9 +284,25 @@ void SynthEngine::noteOn(byte note, float velocity) {
         _noteTimestamps[v] = _clock++;
         return;
     }
-    // free voice
+    // Voice cap (CPU governor): release the oldest held note so the new one
+    // takes another voice while the released one finishes its tail
+    int released = -1;
+    if (_voiceLimit < MAX_VOICES) {
+        int held = 0, oldestHeld = -1;
+        for (int i = 0; i < MAX_VOICES; ++i) {
+            if (!_activeNotes[i]) continue;
+            held++;
+            if (oldestHeld < 0 || _noteTimestamps[i] < _noteTimestamps[oldestHeld]) oldestHeld = i;
+        }
+        if (held >= _voiceLimit && oldestHeld >= 0) {
+            _releaseVoice(oldestHeld);
+            released = oldestHeld;
+        }
+    }
+
+    // free voice (the one just released only as a last resort)
     for (int i = 0; i < MAX_VOICES; ++i) {
-        if (!_activeNotes[i]) {
+        if (!_activeNotes[i] && i != released) {
             _voices[i].noteOn(freq, velocity);
             _activeNotes[i] = true;
             _noteToVoice[note] = i;
@@ -304,6 +310,13 @@ void SynthEngine::noteOn(byte note, float velocity) {
             return;
         }
     }
+    if (released >= 0) {
+        _voices[released].noteOn(freq, velocity);
+        _activeNotes[released] = true;
+        _noteToVoice[note] = released;
+        _noteTimestamps[released] = _clock++;
+        return;
+    }
     // steal oldest
     int oldest = 0;
     for (int i = 1; i < MAX_VOICES; ++i)
@@ -327,112 +340,299 @@ void SynthEngine::noteOff(byte note) {
     }
 }
 
+void SynthEngine::_releaseVoice(int v) {
+    _voices[v].noteOff();
+    _activeNotes[v] = false;
+    for (int n = 0; n < 128; ++n)
+        if (_noteToVoice[n] == v) { _noteToVoice[n] = VOICE_NONE; break; }
+}
+
+void SynthEngine::_enforceVoiceLimit() {
+    for (;;) {
+        int held = 0, oldest = -1;
+        for (int i = 0; i < MAX_VOICES; ++i) {
+            if (!_activeNotes[i]) continue;
+            held++;
+            if (oldest < 0 || _noteTimestamps[i] < _noteTimestamps[oldest]) oldest = i;
+        }
+        if (held <= _voiceLimit || oldest < 0) return;
+        _releaseVoice(oldest);
+    }
+}
+
 void SynthEngine::update() {
     // Update BPM-synced parameters
     if (_bpmClock) {
         updateBPMSync();
     }
 
-    // Update LFO delay ramps (must run every loop iteration)
-    _updateLFODelay();
-
     // Update LFO enabled state
     _lfo1.update();
     _lfo2.update();
 
-    // Update all voices
+    // Preset change: swap once the bus has faded out
+    if (_presetState == PRESET_COMMITTED && _voiceSum.fadeDone()) _swapPreset();
+
+    // Parameter changes since the last pass, applied once per voice
+    _publishParams();
+
+    // Update all voices — VoiceBlock::update() skips oscillator work for
+    // idle voices but still hands finished voices' supersaw engines back
     for (uint8_t v = 0; v < MAX_VOICES; v++) {
-        if (_activeNotes[v] || v == 0) {
-            _voices[v].update();
-        }
+        _voices[v].update();
     }
 
-}
+    _updateGovernor();
 
-// ---- Filter / Env ----
-void SynthEngine::setFilterCutoff(float value) {
-    // Validate range
-    value = constrain(value, CUTOFF_MIN_HZ, CUTOFF_MAX_HZ);
-    _filterCutoffHz = value;
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setFilterCutoff(value);
+    _measurePresetCpu();
 }
-void SynthEngine::setFilterResonance(float value) {
-    _filterResonance = value;
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setFilterResonance(value);
+
+void SynthEngine::_publishParams() {
+    if (_presetState != PRESET_IDLE) return;   // Held for _swapPreset()
+
+    const uint32_t changed = _params.publish();
+    if (!changed) return;
+
+    const uint32_t t0 = ARM_DWT_CYCCNT;
+    for (uint8_t v = 0; v < MAX_VOICES; v++) _voices[v].syncParams();
+    _params.noteSyncCycles(ARM_DWT_CYCCNT - t0);
+
+    if (changed & (VoiceParam::OSC1_ARB | VoiceParam::OSC2_ARB)) _logWavetableCache();
 }
-void SynthEngine::setFilterEnvAmount(float amt) {
-    _filterEnvAmount = amt;
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setFilterEnvAmount(amt);
+
+// ============================================================================
+// Preset change
+// ============================================================================
+// Staging costs what the CCs cost (STAGED ones only write _params); the swap
+// is the held CCs plus one publish, timed separately so both can be read per
+// preset.  Rapid browsing re-enters STAGING while the bus is still fading out
+// and keeps holding into the same table: one entry per CC, so the swap
+// replays each CC once, with the newest value, in the order the newest
+// values arrived.
+
+void SynthEngine::beginPresetChange() {
+    if (_presetState == PRESET_IDLE) _clearPresetHeld();
+    _presetState = PRESET_STAGING;
+    _presetT0    = ARM_DWT_CYCCNT;
+    if (_presetFadeMs > 0.0f) _voiceSum.fade(0.0f, _presetFadeMs * 0.5f);
 }
-void SynthEngine::setFilterKeyTrackAmount(float amt) {
-    _filterKeyTrack = amt;
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setFilterKeyTrackAmount(amt);
+
+void SynthEngine::commitPresetChange() {
+    if (_presetState != PRESET_STAGING) return;
+
+    const uint32_t c = ARM_DWT_CYCCNT - _presetT0;
+    _presetStats.loads++;
+    _presetStats.buildCycles = c;
+    if (c > _presetStats.buildCyclesMax) _presetStats.buildCyclesMax = c;
+
+    _presetState = PRESET_COMMITTED;
+    if (_voiceSum.fadeDone()) _swapPreset();   // No fade, or already silent
 }
-void SynthEngine::setFilterOctaveControl(float octaves) {
-    _filterOctaves = octaves;
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setFilterOctaveControl(octaves);
+
+void SynthEngine::setPresetCrossfadeMs(float ms) {
+    _presetFadeMs = constrain(ms, 0.0f, PRESET_CROSSFADE_MS_MAX);
 }
 
-void SynthEngine::setFilterMultimode(float amount) {
-    _filterMultimode = amount;
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setMultimode(amount);
+void SynthEngine::_holdPresetCC(uint8_t cc, uint8_t value, uint16_t v14, bool hires) {
+    uint32_t&      word = _presetHeldMask[cc >> 5];
+    const uint32_t bit  = 1u << (cc & 31);
+    if (word & bit) {
+        // Held already: the newer value replaces it and moves to the end
+        uint8_t i = 0;
+        while (_presetHeldOrder[i] != cc) ++i;
+        memmove(&_presetHeldOrder[i], &_presetHeldOrder[i + 1], _presetHeldCount - i - 1);
+        _presetHeldCount--;
+    }
+    word |= bit;
+    _presetHeld[cc] = { value, v14, hires };
+    _presetHeldOrder[_presetHeldCount++] = cc;
 }
 
-void SynthEngine::setFilterTwoPole(bool enabled) {
-    _filterUseTwoPole = enabled;
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setTwoPole(enabled);
+void SynthEngine::_clearPresetHeld() {
+    _presetHeldCount = 0;
+    memset(_presetHeldMask, 0, sizeof(_presetHeldMask));
 }
 
-void SynthEngine::setFilterXpander4Pole(bool enabled) {
-    _filterXpander4Pole = enabled;
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setXpander4Pole(enabled);
+void SynthEngine::_swapPreset() {
+    const uint32_t t0 = ARM_DWT_CYCCNT;
+    const uint8_t held = _presetHeldCount;
 
-}
+    // One section for the lot: handlers and publish nest their own
+    // AudioLock sections inside it
+    _presetState = PRESET_IDLE;
+    AudioLock::hold();
+    for (uint8_t i = 0; i < held; ++i) {
+        const uint8_t cc = _presetHeldOrder[i];
+        const HeldCC& h  = _presetHeld[cc];
+        CCDispatch::apply(*this, cc, h.value, h.v14, h.hires);
+    }
+    _publishParams();
+    AudioLock::release();
+    _clearPresetHeld();
+
+    _voiceSum.fade(1.0f, _presetFadeMs * 0.5f);   // Also restores a bus left faded
+
+    const uint32_t c = ARM_DWT_CYCCNT - t0;
+    _presetStats.swapCycles = c;
+    if (c > _presetStats.swapCyclesMax) _presetStats.swapCyclesMax = c;
+    _presetStats.swapHeld = held;
+    if (held > _presetStats.swapHeldMax) _presetStats.swapHeldMax = held;
+    JT_LOGF("[PRESET] staged in %lu cycles, swapped in %lu cycles (%u held CCs), crossfade %.0f ms\n",
+            (unsigned long)_presetStats.buildCycles, (unsigned long)c, held, _presetFadeMs);
+
+    // Measure the new patch once it is back at full level
+    _cpuMeasuring  = true;
+    _cpuWindowOpen = false;
+}
+
+void SynthEngine::_measurePresetCpu() {
+    if (!_cpuMeasuring) return;
+
+    if (!_cpuWindowOpen) {
+        if (!_voiceSum.fadeDone()) return;
+        _cpuWindowOpen    = true;
+        _cpuWindowStartMs = millis();
+        _cpuSum           = 0.0f;
+        _cpuSamples       = 0;
+        AudioProcessorUsageMaxReset();
+        return;
+    }
+
+    _cpuSum += AudioProcessorUsage();
+    _cpuSamples++;
+    if ((millis() - _cpuWindowStartMs) < PRESET_CPU_WINDOW_MS) return;
 
-void SynthEngine::setFilterXpanderMode(uint8_t amount) {
-    _filterXpanderMode = amount;
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setXpanderMode(amount);
+    uint16_t dormant = _ampDormantNodes;
+    for (uint8_t v = 0; v < MAX_VOICES; v++) dormant += _voices[v].dormantNodes();
+
+    _cpuMeasuring              = false;
+    _presetStats.cpuAvg        = _cpuSum / (float)_cpuSamples;
+    _presetStats.cpuMax        = AudioProcessorUsageMax();
+    _presetStats.dormantNodes  = dormant;
+    JT_LOGF("[PRESET] CPU %.1f%% avg, %.1f%% max over %lu ms; %u audio objects parked, voice features 0x%04X, filter kernel %s\n",
+            _presetStats.cpuAvg, _presetStats.cpuMax, (unsigned long)PRESET_CPU_WINDOW_MS,
+            dormant, _voices[0].featureMask(), _voices[0].filterKernelName());
 }
 
-void SynthEngine::setFilterBPBlend2Pole(bool enabled) {
-    _filterBpBlend2Pole = enabled;
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setBPBlend2Pole(enabled);
+// ============================================================================
+// CPU governor
+// ============================================================================
+
+static const char* const kGovernorLevelNames[CPU_GOV_MAX_LEVEL + 1] = {
+    "full quality",
+    "JPFX mod LFO decimated",
+    "supersaw oversampling off",
+    "reverb shed",
+    "voices capped 3/4",
+    "voices capped 1/2",
+};
+
+void SynthEngine::_updateGovernor() {
+    if (!_govEnabled) return;
+
+    float cpu = AudioProcessorUsage();
+    if (_govCpuOverride > cpu) cpu = _govCpuOverride;
+
+    const uint8_t from = _gov.level();
+    if (!_gov.sample(cpu, millis(), _governorSheds())) return;
+
+    const uint8_t level = _gov.level();
+    JT_LOGF("[GOV] level %u -> %u (%s), CPU peak %.1f%%\n",
+            from, level, kGovernorLevelNames[level], _gov.lastPeak());
+    _applyGovernorLevel(level);
 }
 
-void SynthEngine::setFilterPush2Pole(bool enabled) {
-    _filterPush2Pole = enabled;
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setPush2Pole(enabled);
+uint8_t SynthEngine::_governorSheds() const {
+    uint8_t m = 0;
+    if (_fxChain.getModEffect() >= 0) m |= 1u << 1;   // Mod LFO only runs with a mod effect
+    if (_supersawOversample)          m |= 1u << 2;
+    if (_fxChain.reverbWanted())      m |= 1u << 3;
+    return m;
 }
 
-void SynthEngine::setFilterResonanceModDepth(float amount) {
-    _filterResonaceModDepth = amount;
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setResonanceModDepth(amount);
+void SynthEngine::_applyGovernorLevel(uint8_t level) {
+    _fxChain.setModLfoDecimation(level >= 1 ? CPU_GOV_MOD_DECIMATION : 1);
+
+    SupersawPool::setOversample(_supersawOversample && level < 2);
+
+    _fxChain.setReverbLoadShed(level >= 3);
+
+    _voiceLimit = (level >= 5) ? MAX_VOICES / 2
+                : (level >= 4) ? (MAX_VOICES * 3) / 4
+                :                MAX_VOICES;
+    _enforceVoiceLimit();
 }
 
-float SynthEngine::getFilterCutoff() const         { return _filterCutoffHz; }
-float SynthEngine::getFilterResonance() const      { return _filterResonance; }
-float SynthEngine::getFilterEnvAmount() const      { return _filterEnvAmount; }
-float SynthEngine::getFilterKeyTrackAmount() const { return _filterKeyTrack; }
-float SynthEngine::getFilterOctaveControl() const  { return _filterOctaves; }
+void SynthEngine::setGovernorEnabled(bool enabled) {
+    _govEnabled = enabled;
+    if (enabled) { _gov.restartWindow(); return; }
+    const uint8_t from = _gov.level();
+    _gov.reset();
+    if (from != 0) {
+        JT_LOGF("[GOV] disabled, level %u -> 0 (%s)\n", from, kGovernorLevelNames[0]);
+        _applyGovernorLevel(0);
+    }
+}
 
-// ---- Envelopes (read-through to voices; uses voice 0 as representative) ----
-float SynthEngine::getAmpAttack()  const { return MAX_VOICES ? _voices[0].getAmpAttack()  : 0.0f; }
-float SynthEngine::getAmpDecay()   const { return MAX_VOICES ? _voices[0].getAmpDecay()   : 0.0f; }
-float SynthEngine::getAmpSustain() const { return MAX_VOICES ? _voices[0].getAmpSustain() : 0.0f; }
-float SynthEngine::getAmpRelease() const { return MAX_VOICES ? _voices[0].getAmpRelease() : 0.0f; }
+void SynthEngine::setSupersawOversample(bool enable) {
+    _supersawOversample = enable;
+    SupersawPool::setOversample(enable && _gov.level() < 2);
+}
 
-float SynthEngine::getFilterEnvAttack()  const { return MAX_VOICES ? _voices[0].getFilterEnvAttack()  : 0.0f; }
-float SynthEngine::getFilterEnvDecay()   const { return MAX_VOICES ? _voices[0].getFilterEnvDecay()   : 0.0f; }
-float SynthEngine::getFilterEnvSustain() const { return MAX_VOICES ? _voices[0].getFilterEnvSustain() : 0.0f; }
-float SynthEngine::getFilterEnvRelease() const { return MAX_VOICES ? _voices[0].getFilterEnvRelease() : 0.0f; }
+// ---- Filter / Env ----
+// Voice parameters go into the shared block; voices apply them at the next
+// publish (_publishParams()), so none of these loops over the voices.
+void SynthEngine::setFilterCutoff(float value) {
+    // Validate range
+    value = constrain(value, CUTOFF_MIN_HZ, CUTOFF_MAX_HZ);
+    _params.edit(VoiceParam::FILTER_CUTOFF).cutoffHz = value;
+}
+void SynthEngine::setFilterResonance(float value)     { _params.edit(VoiceParam::FILTER_RES).resonance    = value; }
+void SynthEngine::setFilterEnvAmount(float amt)       { _params.edit(VoiceParam::FILTER_ENV_AMT).envAmount = amt; }
+void SynthEngine::setFilterKeyTrackAmount(float amt)  { _params.edit(VoiceParam::FILTER_KEYTRACK).keyTrack = amt; }
+void SynthEngine::setFilterOctaveControl(float octaves) { _params.edit(VoiceParam::FILTER_OCTAVES).octaves = octaves; }
+
+void SynthEngine::setFilterMultimode(float amount)      { _params.edit(VoiceParam::FILTER_MODE).multimode    = amount; }
+void SynthEngine::setFilterTwoPole(bool enabled)        { _params.edit(VoiceParam::FILTER_MODE).twoPole      = enabled; }
+void SynthEngine::setFilterXpander4Pole(bool enabled)   { _params.edit(VoiceParam::FILTER_MODE).xpander4Pole = enabled; }
+void SynthEngine::setFilterXpanderMode(uint8_t amount)  { _params.edit(VoiceParam::FILTER_MODE).xpanderMode  = amount; }
+void SynthEngine::setFilterBPBlend2Pole(bool enabled)   { _params.edit(VoiceParam::FILTER_MODE).bpBlend2Pole = enabled; }
+void SynthEngine::setFilterPush2Pole(bool enabled)      { _params.edit(VoiceParam::FILTER_MODE).push2Pole    = enabled; }
+void SynthEngine::setFilterResonanceModDepth(float amount) { _params.edit(VoiceParam::FILTER_MODE).resModDepth = amount; }
+
+float SynthEngine::getFilterCutoff() const         { return _params.staged().cutoffHz; }
+float SynthEngine::getFilterResonance() const      { return _params.staged().resonance; }
+float SynthEngine::getFilterEnvAmount() const      { return _params.staged().envAmount; }
+float SynthEngine::getFilterKeyTrackAmount() const { return _params.staged().keyTrack; }
+float SynthEngine::getFilterOctaveControl() const  { return _params.staged().octaves; }
+
+// ---- Envelopes ----
+void SynthEngine::setAmpAttack(float ms)          { _params.edit(VoiceParam::AMP_ENV).ampEnv.attack     = ms; }
+void SynthEngine::setAmpDecay(float ms)           { _params.edit(VoiceParam::AMP_ENV).ampEnv.decay      = ms; }
+void SynthEngine::setAmpSustain(float level)      { _params.edit(VoiceParam::AMP_ENV).ampEnv.sustain    = level; }
+void SynthEngine::setAmpRelease(float ms)         { _params.edit(VoiceParam::AMP_ENV).ampEnv.release    = ms; }
+void SynthEngine::setFilterEnvAttack(float ms)    { _params.edit(VoiceParam::FILTER_ENV).filterEnv.attack  = ms; }
+void SynthEngine::setFilterEnvDecay(float ms)     { _params.edit(VoiceParam::FILTER_ENV).filterEnv.decay   = ms; }
+void SynthEngine::setFilterEnvSustain(float l)    { _params.edit(VoiceParam::FILTER_ENV).filterEnv.sustain = l; }
+void SynthEngine::setFilterEnvRelease(float ms)   { _params.edit(VoiceParam::FILTER_ENV).filterEnv.release = ms; }
+
+float SynthEngine::getAmpAttack()  const { return _params.staged().ampEnv.attack; }
+float SynthEngine::getAmpDecay()   const { return _params.staged().ampEnv.decay; }
+float SynthEngine::getAmpSustain() const { return _params.staged().ampEnv.sustain; }
+float SynthEngine::getAmpRelease() const { return _params.staged().ampEnv.release; }
+
+float SynthEngine::getFilterEnvAttack()  const { return _params.staged().filterEnv.attack; }
+float SynthEngine::getFilterEnvDecay()   const { return _params.staged().filterEnv.decay; }
+float SynthEngine::getFilterEnvSustain() const { return _params.staged().filterEnv.sustain; }
+float SynthEngine::getFilterEnvRelease() const { return _params.staged().filterEnv.release; }
 
 // ---- Oscillators / mixes ----
 void SynthEngine::setOscWaveforms(int wave1, int wave2) { setOsc1Waveform(wave1); setOsc2Waveform(wave2); }
-void SynthEngine::setOsc1Waveform(int wave) { _osc1Wave = wave; for (int i=0;i<MAX_VOICES;++i) _voices[i].setOsc1Waveform(wave); }
-void SynthEngine::setOsc2Waveform(int wave) { _osc2Wave = wave; for (int i=0;i<MAX_VOICES;++i) _voices[i].setOsc2Waveform(wave); }
+void SynthEngine::setOsc1Waveform(int wave) { _params.edit(VoiceParam::OSC1_WAVE).osc[0].wave = wave; }
+void SynthEngine::setOsc2Waveform(int wave) { _params.edit(VoiceParam::OSC2_WAVE).osc[1].wave = wave; }
 
-void SynthEngine::setOsc1PitchOffset(float semis) { _osc1PitchSemi = semis; for (int i=0;i<MAX_VOICES;++i) _voices[i].setOsc1PitchOffset(semis); }
-void SynthEngine::setOsc2PitchOffset(float semis) { _osc2PitchSemi = semis; for (int i=0;i<MAX_VOICES;++i) _voices[i].setOsc2PitchOffset(semis); }
+void SynthEngine::setOsc1PitchOffset(float semis) { _params.edit(VoiceParam::OSC1_PITCH).osc[0].pitchSemi = semis; }
+void SynthEngine::setOsc2PitchOffset(float semis) { _params.edit(VoiceParam::OSC2_PITCH).osc[1].pitchSemi = semis; }
 
 // ============================================================================
 // PITCH BEND
@@ -490,103 +690,108 @@ void SynthEngine::handlePitchBend(uint8_t /*channel*/, int16_t value) {
     }
 }
 
-void SynthEngine::setOsc1Detune(float semis) { _osc1DetuneSemi = semis; for (int i=0;i<MAX_VOICES;++i) _voices[i].setOsc1Detune(semis); }
-void SynthEngine::setOsc2Detune(float semis) { _osc2DetuneSemi = semis; for (int i=0;i<MAX_VOICES;++i) _voices[i].setOsc2Detune(semis); }
+void SynthEngine::setOsc1Detune(float semis) { _params.edit(VoiceParam::OSC1_PITCH).osc[0].detune = semis; }
+void SynthEngine::setOsc2Detune(float semis) { _params.edit(VoiceParam::OSC2_PITCH).osc[1].detune = semis; }
 
-void SynthEngine::setOsc1FineTune(float cents) { _osc1FineCents = cents; for (int i=0;i<MAX_VOICES;++i) _voices[i].setOsc1FineTune(cents); }
-void SynthEngine::setOsc2FineTune(float cents) { _osc2FineCents = cents; for (int i=0;i<MAX_VOICES;++i) _voices[i].setOsc2FineTune(cents); }
+void SynthEngine::setOsc1FineTune(float cents) { _params.edit(VoiceParam::OSC1_PITCH).osc[0].fineCents = cents; }
+void SynthEngine::setOsc2FineTune(float cents) { _params.edit(VoiceParam::OSC2_PITCH).osc[1].fineCents = cents; }
 
 void SynthEngine::setOscMix(float osc1Level, float osc2Level) {
-    _osc1Mix = osc1Level; _osc2Mix = osc2Level;
-    for (int i=0;i<MAX_VOICES;++i) _voices[i].setOscMix(osc1Level, osc2Level);
+    VoiceParams& p = _params.edit(VoiceParam::MIX);
+    p.osc[0].level = osc1Level;
+    p.osc[1].level = osc2Level;
 }
-void SynthEngine::setOsc1Mix(float oscLevel) { _osc1Mix = oscLevel; for (int i=0;i<MAX_VOICES;++i) _voices[i].setOsc1Mix(oscLevel); }
-void SynthEngine::setOsc2Mix(float oscLevel) { _osc2Mix = oscLevel; for (int i=0;i<MAX_VOICES;++i) _voices[i].setOsc2Mix(oscLevel); }
-void SynthEngine::setSubMix(float mix)  { _subMix = mix;  for (int i=0;i<MAX_VOICES;++i) _voices[i].setSubMix(mix); }
-void SynthEngine::setNoiseMix(float mix){ _noiseMix = mix;for (int i=0;i<MAX_VOICES;++i) _voices[i].setNoiseMix(mix); }
+void SynthEngine::setOsc1Mix(float oscLevel) { _params.edit(VoiceParam::MIX).osc[0].level = oscLevel; }
+void SynthEngine::setOsc2Mix(float oscLevel) { _params.edit(VoiceParam::MIX).osc[1].level = oscLevel; }
+void SynthEngine::setSubMix(float mix)       { _params.edit(VoiceParam::MIX).sub   = mix; }
+void SynthEngine::setNoiseMix(float mix)     { _params.edit(VoiceParam::MIX).noise = mix; }
 
 void SynthEngine::setSupersawDetune(uint8_t oscIndex, float amount) {
     if (oscIndex > 1) return;
-    for (int i = 0; i < MAX_VOICES; ++i) {
-        if (oscIndex == 0) _voices[i].setOsc1SupersawDetune(amount);
-        else                _voices[i].setOsc2SupersawDetune(amount);
-    }
+    _params.edit(VoiceParam::OSC1_SUPERSAW << oscIndex).osc[oscIndex].ssDetune = amount;
 }
 
 void SynthEngine::setSupersawMix(uint8_t oscIndex, float amount) {
     if (oscIndex > 1) return;
-    for (int i = 0; i < MAX_VOICES; ++i) {
-        if (oscIndex == 0) _voices[i].setOsc1SupersawMix(amount);
-        else                _voices[i].setOsc2SupersawMix(amount);
-    }
+    _params.edit(VoiceParam::OSC1_SUPERSAW << oscIndex).osc[oscIndex].ssMix = amount;
 }
 
-void SynthEngine::setOsc1FrequencyDcAmp(float amp) { _osc1FreqDc = amp; for (int i=0;i<MAX_VOICES;++i) _voices[i].setOsc1FrequencyDcAmp(amp); }
-void SynthEngine::setOsc2FrequencyDcAmp(float amp) { _osc2FreqDc = amp; for (int i=0;i<MAX_VOICES;++i) _voices[i].setOsc2FrequencyDcAmp(amp); }
-void SynthEngine::setOsc1ShapeDcAmp(float amp)     { _osc1ShapeDc = amp; for (int i=0;i<MAX_VOICES;++i) _voices[i].setOsc1ShapeDcAmp(amp); }
-void SynthEngine::setOsc2ShapeDcAmp(float amp)     { _osc2ShapeDc = amp; for (int i=0;i<MAX_VOICES;++i) _voices[i].setOsc2ShapeDcAmp(amp); }
+void SynthEngine::setOsc1FrequencyDcAmp(float amp) { _params.edit(VoiceParam::OSC1_DC).osc[0].freqDc  = amp; }
+void SynthEngine::setOsc2FrequencyDcAmp(float amp) { _params.edit(VoiceParam::OSC2_DC).osc[1].freqDc  = amp; }
+void SynthEngine::setOsc1ShapeDcAmp(float amp)     { _params.edit(VoiceParam::OSC1_DC).osc[0].shapeDc = amp; }
+void SynthEngine::setOsc2ShapeDcAmp(float amp)     { _params.edit(VoiceParam::OSC2_DC).osc[1].shapeDc = amp; }
 
-void SynthEngine::setRing1Mix(float level) { _ring1Mix = level; for (int i=0;i<MAX_VOICES;++i) _voices[i].setRing1Mix(level); }
-void SynthEngine::setRing2Mix(float level) { _ring2Mix = level; for (int i=0;i<MAX_VOICES;++i) _voices[i].setRing2Mix(level); }
+void SynthEngine::setRing1Mix(float level) { _params.edit(VoiceParam::MIX).ring[0] = level; }
+void SynthEngine::setRing2Mix(float level) { _params.edit(VoiceParam::MIX).ring[1] = level; }
 
-void SynthEngine::setOsc1FeedbackAmount(float amount) { _osc1FeedbackAmount = amount; for (int i=0;i<MAX_VOICES;++i) _voices[i].setOsc1FeedbackAmount(amount); }
-void SynthEngine::setOsc2FeedbackAmount(float amount) { _osc2FeedbackAmount = amount; for (int i=0;i<MAX_VOICES;++i) _voices[i].setOsc2FeedbackAmount(amount); }
+void SynthEngine::setOsc1FeedbackAmount(float amount) { _params.edit(VoiceParam::OSC1_FEEDBACK).osc[0].fbAmount = amount; }
+void SynthEngine::setOsc2FeedbackAmount(float amount) { _params.edit(VoiceParam::OSC2_FEEDBACK).osc[1].fbAmount = amount; }
 
-void SynthEngine::setOsc1FeedbackMix(float mix) { _osc1FeedbackMix = mix; for (int i=0;i<MAX_VOICES;++i) _voices[i].setOsc1FeedbackMix(mix); }
-void SynthEngine::setOsc2FeedbackMix(float mix) { _osc2FeedbackMix = mix; for (int i=0;i<MAX_VOICES;++i) _voices[i].setOsc2FeedbackMix(mix); }
+void SynthEngine::setOsc1FeedbackMix(float mix) { _params.edit(VoiceParam::OSC1_FEEDBACK).osc[0].fbMix = mix; }
+void SynthEngine::setOsc2FeedbackMix(float mix) { _params.edit(VoiceParam::OSC2_FEEDBACK).osc[1].fbMix = mix; }
 
 
 
 // ---- Arbitrary waveform bank/index selection ----
+// Cache report follows the publish that hands the selection to the voices.
 void SynthEngine::setOsc1ArbBank(ArbBank b) {
-    _osc1ArbBank = b;
+    VoiceParam::Osc& o = _params.edit(VoiceParam::OSC1_ARB).osc[0];
+    o.arbBank = b;
     // Clamp current index against the new bank count
-    uint16_t count = akwf_bankCount(b);
-    if (count > 0 && _osc1ArbIndex >= count) _osc1ArbIndex = count - 1;
-    for (int i = 0; i < MAX_VOICES; ++i) {
-        _voices[i].setOsc1ArbBank(b);
-        // also update index on voice since setArbBank may clamp index internally
-        _voices[i].setOsc1ArbIndex(_osc1ArbIndex);
-    }
+    uint16_t count = wavebank_tableCount(b);
+    if (count > 0 && o.arbIndex >= count) o.arbIndex = count - 1;
 }
 
 void SynthEngine::setOsc2ArbBank(ArbBank b) {
-    _osc2ArbBank = b;
-    uint16_t count = akwf_bankCount(b);
-    if (count > 0 && _osc2ArbIndex >= count) _osc2ArbIndex = count - 1;
-    for (int i = 0; i < MAX_VOICES; ++i) {
-        _voices[i].setOsc2ArbBank(b);
-        _voices[i].setOsc2ArbIndex(_osc2ArbIndex);
-    }
+    VoiceParam::Osc& o = _params.edit(VoiceParam::OSC2_ARB).osc[1];
+    o.arbBank = b;
+    uint16_t count = wavebank_tableCount(b);
+    if (count > 0 && o.arbIndex >= count) o.arbIndex = count - 1;
 }
 
 void SynthEngine::setOsc1ArbIndex(uint16_t idx) {
+    VoiceParam::Osc& o = _params.edit(VoiceParam::OSC1_ARB).osc[0];
     // Clamp index by current bank
-    uint16_t count = akwf_bankCount(_osc1ArbBank);
+    uint16_t count = wavebank_tableCount(o.arbBank);
     if (count == 0) {
-        _osc1ArbIndex = 0;
+        o.arbIndex = 0;
     } else {
         if (idx >= count) idx = count - 1;
-        _osc1ArbIndex = idx;
+        o.arbIndex = idx;
     }
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setOsc1ArbIndex(_osc1ArbIndex);
 }
 
 void SynthEngine::setOsc2ArbIndex(uint16_t idx) {
-    uint16_t count = akwf_bankCount(_osc2ArbBank);
+    VoiceParam::Osc& o = _params.edit(VoiceParam::OSC2_ARB).osc[1];
+    uint16_t count = wavebank_tableCount(o.arbBank);
     if (count == 0) {
-        _osc2ArbIndex = 0;
+        o.arbIndex = 0;
     } else {
         if (idx >= count) idx = count - 1;
-        _osc2ArbIndex = idx;
+        o.arbIndex = idx;
     }
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setOsc2ArbIndex(_osc2ArbIndex);
+}
+
+void SynthEngine::reloadArbTable(ArbBank b, uint16_t idx) {
+    // Same selection again: the oscillators re-acquire and morph to the new data
+    if (getOsc1ArbBank() == b && getOsc1ArbIndex() == idx) setOsc1ArbIndex(idx);
+    if (getOsc2ArbBank() == b && getOsc2ArbIndex() == idx) setOsc2ArbIndex(idx);
+}
+
+void SynthEngine::_logWavetableCache() {
+    const AKWFMip::Stats st = AKWFMip::stats();
+    // Oscillator figures are per-block peaks since boot
+    JT_LOGF("[WTCACHE] %u/%u resident (%u held), hits %lu, misses %lu, evictions %lu; voice 0 osc CPU max %.2f%% / %.2f%%\n",
+            st.resident, AKWF_MIP_POOL, st.held,
+            (unsigned long)st.hits, (unsigned long)st.misses, (unsigned long)st.evictions,
+            _voices[0].osc1CpuMax(), _voices[0].osc2CpuMax());
 }
 
 // ---- Amp mod DC ----
 void SynthEngine::SetAmpModFixedLevel(float level) {
     _ampModFixedLevel = level;
     _ampModFixedDc.amplitude(level);
+    _applyAmpModDormancy();
 }
 float SynthEngine::GetAmpModFixedLevel() const { return _ampModFixedLevel; }
 float SynthEngine::getAmpModFixedLevel() const { return _ampModFixedLevel; }
@@ -597,12 +802,12 @@ void SynthEngine::setLFO2Frequency(float hz) { _lfo2Frequency = hz; _lfo2.setFre
 void SynthEngine::setLFO1Amount(float amt) {
     _lfo1Amount = amt;
     _lfo1.setAmplitude(amt);
-    if (!_lfo1Ramping) _applyLFO1Gains(); // only if not mid-delay ramp
+    _applyLFO1Gains();
 }
 void SynthEngine::setLFO2Amount(float amt) {
     _lfo2Amount = amt;
     _lfo2.setAmplitude(amt);
-    if (!_lfo2Ramping) _applyLFO2Gains();
+    _applyLFO2Gains();
 }
 
 void SynthEngine::setLFO1Waveform(int type) { _lfo1Type = type; _lfo1.setWaveformType(type); }
@@ -722,14 +927,13 @@ void SynthEngine::_applyLFO1Gains() {
     const float pwmG    = eff1 * _lfo1PWMDepth;
     const float ampG    = eff1 * _lfo1AmpDepth;
 
+    // Voices scale these by their own delay fade before writing the mixers
     for (int i = 0; i < MAX_VOICES; ++i) {
-        _voices[i].frequencyModMixerOsc1().gain(1, pitchG);
-        _voices[i].frequencyModMixerOsc2().gain(1, pitchG);
-        _voices[i].filterModMixer().gain(2, filterG);
-        _voices[i].shapeModMixerOsc1().gain(1, pwmG);
-        _voices[i].shapeModMixerOsc2().gain(1, pwmG);
+        _voices[i].setLFOGains(0, pitchG, filterG, pwmG);
     }
     _ampModMixer.gain(1, ampG);
+    _lfo1AmpGain = ampG;
+    _applyAmpModDormancy();
 }
 
 void SynthEngine::_applyLFO2Gains() {
@@ -746,125 +950,81 @@ void SynthEngine::_applyLFO2Gains() {
     const float pwmG    = eff2 * _lfo2PWMDepth;
     const float ampG    = eff2 * _lfo2AmpDepth;
     for (int i = 0; i < MAX_VOICES; ++i) {
-        _voices[i].frequencyModMixerOsc1().gain(2, pitchG);
-        _voices[i].frequencyModMixerOsc2().gain(2, pitchG);
-        _voices[i].filterModMixer().gain(3, filterG);
-        _voices[i].shapeModMixerOsc1().gain(2, pwmG);
-        _voices[i].shapeModMixerOsc2().gain(2, pwmG);
+        _voices[i].setLFOGains(1, pitchG, filterG, pwmG);
     }
     _ampModMixer.gain(2, ampG);
+    _lfo2AmpGain = ampG;
+    _applyAmpModDormancy();
+}
+
+void SynthEngine::_applyAmpModDormancy() {
+    // With no LFO amp depth and a unity fixed level the chain only multiplies
+    // by 1.0: park it; _voiceSum treats a missing mod block as unity.
+    const bool amp1 = (_lfo1AmpGain != 0.0f);
+    const bool amp2 = (_lfo2AmpGain != 0.0f);
+    const bool live = amp1 || amp2 || (_ampModFixedLevel != 1.0f);
+
+    AudioLock::hold();
+    _lfo1.setFadeActive(amp1);   // Fade stages feed only the amp-mod mixer
+    _lfo2.setFadeActive(amp2);
+    AudioDormancy::setActive(_ampModFixedDc, live);
+    AudioDormancy::setActive(_ampModMixer,   live);
+    AudioLock::release();
+
+    _ampDormantNodes = (uint8_t)(!amp1 + !amp2 + 2 * !live);
 }
 
 void SynthEngine::setLFO1PitchDepth(float d)  { _lfo1PitchDepth  = d; _applyLFO1Gains(); }
 void SynthEngine::setLFO1FilterDepth(float d) { _lfo1FilterDepth = d; _applyLFO1Gains(); }
 void SynthEngine::setLFO1PWMDepth(float d)    { _lfo1PWMDepth    = d; _applyLFO1Gains(); }
 void SynthEngine::setLFO1AmpDepth(float d)    { _lfo1AmpDepth    = d; _applyLFO1Gains(); }
-void SynthEngine::setLFO1Delay(float ms)      { _lfo1DelayMs     = ms; }
+void SynthEngine::setLFO1Delay(float ms) {
+    _lfo1DelayMs = ms;
+    // Global amp path ramps in LFOBlock; pitch/filter/PWM ramp per voice
+    _lfo1.setDelayTime(ms);
+    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setLFODelay(0, ms);
+}
+void SynthEngine::setLFO1KeySync(bool on) {
+    _lfo1KeySync = on;
+    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setLFOKeySync(0, on);
+}
 
 void SynthEngine::setLFO2PitchDepth(float d)  { _lfo2PitchDepth  = d; _applyLFO2Gains(); }
 void SynthEngine::setLFO2FilterDepth(float d) { _lfo2FilterDepth = d; _applyLFO2Gains(); }
 void SynthEngine::setLFO2PWMDepth(float d)    { _lfo2PWMDepth    = d; _applyLFO2Gains(); }
 void SynthEngine::setLFO2AmpDepth(float d)    { _lfo2AmpDepth    = d; _applyLFO2Gains(); }
-void SynthEngine::setLFO2Delay(float ms)      { _lfo2DelayMs     = ms; }
-
-// ============================================================================
-// NEW: LFO DELAY RAMP — called from update() every Arduino loop iteration
-// Linear fade-in from 0 → target amplitude over the delay period.
-// ============================================================================
-void SynthEngine::_updateLFODelay() {
-    const uint32_t now = millis();
-
-    // LFO1 delay ramp
-    if (_lfo1Ramping && _lfo1DelayMs > 0.0f) {
-        const float elapsed = (float)(now - _lfo1NoteOnMs);
-        const float t = (elapsed >= _lfo1DelayMs) ? 1.0f : (elapsed / _lfo1DelayMs);
-        _lfo1CurrentAmp = _lfo1Amount * t;
-        if (t >= 1.0f) _lfo1Ramping = false;
-
-        // Apply ramped amplitude — pitch gains use the same FM_SEMITONE_SCALE as _applyLFO1Gains
-        const float pitchScale1 = LFO_PITCH_MAX_SEMITONES * FM_SEMITONE_SCALE;
-        const float pitchG  = _lfo1CurrentAmp * _lfo1PitchDepth * pitchScale1;
-        const float filterG = _lfo1CurrentAmp * _lfo1FilterDepth;
-        const float pwmG    = _lfo1CurrentAmp * _lfo1PWMDepth;
-        const float ampG    = _lfo1CurrentAmp * _lfo1AmpDepth;
-        for (int i = 0; i < MAX_VOICES; ++i) {
-            _voices[i].frequencyModMixerOsc1().gain(1, pitchG);
-            _voices[i].frequencyModMixerOsc2().gain(1, pitchG);
-            _voices[i].filterModMixer().gain(2, filterG);
-            _voices[i].shapeModMixerOsc1().gain(1, pwmG);
-            _voices[i].shapeModMixerOsc2().gain(1, pwmG);
-        }
-        _ampModMixer.gain(1, ampG);
-    }
-
-    // LFO2 delay ramp
-    if (_lfo2Ramping && _lfo2DelayMs > 0.0f) {
-        const float elapsed = (float)(now - _lfo2NoteOnMs);
-        const float t = (elapsed >= _lfo2DelayMs) ? 1.0f : (elapsed / _lfo2DelayMs);
-        _lfo2CurrentAmp = _lfo2Amount * t;
-        if (t >= 1.0f) _lfo2Ramping = false;
-
-        const float pitchScale2 = LFO_PITCH_MAX_SEMITONES * FM_SEMITONE_SCALE;
-        const float pitchG  = _lfo2CurrentAmp * _lfo2PitchDepth * pitchScale2;
-        const float filterG = _lfo2CurrentAmp * _lfo2FilterDepth;
-        const float pwmG    = _lfo2CurrentAmp * _lfo2PWMDepth;
-        const float ampG    = _lfo2CurrentAmp * _lfo2AmpDepth;
-        for (int i = 0; i < MAX_VOICES; ++i) {
-            _voices[i].frequencyModMixerOsc1().gain(2, pitchG);
-            _voices[i].frequencyModMixerOsc2().gain(2, pitchG);
-            _voices[i].filterModMixer().gain(3, filterG);
-            _voices[i].shapeModMixerOsc1().gain(2, pwmG);
-            _voices[i].shapeModMixerOsc2().gain(2, pwmG);
-        }
-        _ampModMixer.gain(2, ampG);
-    }
+void SynthEngine::setLFO2Delay(float ms) {
+    _lfo2DelayMs = ms;
+    _lfo2.setDelayTime(ms);
+    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setLFODelay(1, ms);
+}
+void SynthEngine::setLFO2KeySync(bool on) {
+    _lfo2KeySync = on;
+    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setLFOKeySync(1, on);
 }
 
 // ============================================================================
 // NEW: PITCH ENVELOPE
 // ============================================================================
 
-void SynthEngine::setPitchEnvAttack(float ms) {
-    _pitchEnvAttack = ms;
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setPitchEnvAttack(ms);
-}
-void SynthEngine::setPitchEnvDecay(float ms) {
-    _pitchEnvDecay = ms;
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setPitchEnvDecay(ms);
-}
-void SynthEngine::setPitchEnvSustain(float l) {
-    _pitchEnvSustain = l;
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setPitchEnvSustain(l);
-}
-void SynthEngine::setPitchEnvRelease(float ms) {
-    _pitchEnvRelease = ms;
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setPitchEnvRelease(ms);
-}
+void SynthEngine::setPitchEnvAttack(float ms)  { _params.edit(VoiceParam::PITCH_ENV).pitchEnv.attack  = ms; }
+void SynthEngine::setPitchEnvDecay(float ms)   { _params.edit(VoiceParam::PITCH_ENV).pitchEnv.decay   = ms; }
+void SynthEngine::setPitchEnvSustain(float l)  { _params.edit(VoiceParam::PITCH_ENV).pitchEnv.sustain = l; }
+void SynthEngine::setPitchEnvRelease(float ms) { _params.edit(VoiceParam::PITCH_ENV).pitchEnv.release = ms; }
 void SynthEngine::setPitchEnvDepth(float semitones) {
-    semitones = constrain(semitones, -24.0f, 24.0f);
-    _pitchEnvDepth = semitones;
-    // VoiceBlock::setPitchEnvDepth writes amplitude = semitones / 12.0 to _pitchEnvDc.
-    // Range: -1.0 (full down) to +1.0 (full up), 0 = no pitch shift.
-    // freqModMixer gain(3) is fixed at 1/10 set at construction — do NOT change it here.
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setPitchEnvDepth(semitones);
+    // VoiceBlock::setPitchEnvDepth writes amplitude = semitones × FM_SEMITONE_SCALE
+    // to its _pitchEnvDc; freqModMixer gain(3) stays at its construction value.
+    _params.edit(VoiceParam::PITCH_ENV).pitchEnvDepth = constrain(semitones, -24.0f, 24.0f);
 }
 
 // ============================================================================
 // NEW: VELOCITY SENSITIVITY
 // ============================================================================
+// Read by each voice at noteOn straight from the live block.
 
-void SynthEngine::setVelocityAmpSens(float s) {
-    _velAmpSens = s;
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setVelocityAmpSens(s);
-}
-void SynthEngine::setVelocityFilterSens(float s) {
-    _velFilterSens = s;
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setVelocityFilterSens(s);
-}
-void SynthEngine::setVelocityEnvSens(float s) {
-    _velEnvSens = s;
-    for (int i = 0; i < MAX_VOICES; ++i) _voices[i].setVelocityEnvSens(s);
-}
+void SynthEngine::setVelocityAmpSens(float s)    { _params.edit(VoiceParam::VELOCITY).velAmpSens    = s; }
+void SynthEngine::setVelocityFilterSens(float s) { _params.edit(VoiceParam::VELOCITY).velFilterSens = s; }
+void SynthEngine::setVelocityEnvSens(float s)    { _params.edit(VoiceParam::VELOCITY).velEnvSens    = s; }
 
 // ============================================================================
 // JPFX TONE CONTROL
@@ -1040,641 +1200,99 @@ bool SynthEngine::getFXReverbBypass() const {
 
 
 // ---- UI helper getters ----
-int SynthEngine::getOsc1Waveform() const { return _osc1Wave; }
-int SynthEngine::getOsc2Waveform() const { return _osc2Wave; }
+int SynthEngine::getOsc1Waveform() const { return _params.staged().osc[0].wave; }
+int SynthEngine::getOsc2Waveform() const { return _params.staged().osc[1].wave; }
 const char* SynthEngine::getOsc1WaveformName() const {
-    return waveformShortName((WaveformType)_osc1Wave);
+    return waveformShortName((WaveformType)getOsc1Waveform());
 }
 const char* SynthEngine::getOsc2WaveformName() const {
-    return waveformShortName((WaveformType)_osc2Wave);
+    return waveformShortName((WaveformType)getOsc2Waveform());
 }
 
 
-float SynthEngine::getSupersawDetune(uint8_t osc) const { return (osc<2)?_supersawDetune[osc]:0.0f; }
-float SynthEngine::getSupersawMix(uint8_t osc)    const { return (osc<2)?_supersawMix[osc]:0.0f; }
-float SynthEngine::getOsc1PitchOffset() const { return _osc1PitchSemi; }
-float SynthEngine::getOsc2PitchOffset() const { return _osc2PitchSemi; }
-float SynthEngine::getOsc1Detune() const { return _osc1DetuneSemi; }
-float SynthEngine::getOsc2Detune() const { return _osc2DetuneSemi; }
-float SynthEngine::getOsc1FineTune() const { return _osc1FineCents; }
-float SynthEngine::getOsc2FineTune() const { return _osc2FineCents; }
-float SynthEngine::getOscMix1() const { return _osc1Mix; }
-float SynthEngine::getOscMix2() const { return _osc2Mix; }
-float SynthEngine::getSubMix() const { return _subMix; }
-float SynthEngine::getNoiseMix() const { return _noiseMix; }
-float SynthEngine::getRing1Mix() const { return _ring1Mix; }
-float SynthEngine::getRing2Mix() const { return _ring2Mix; }
-float SynthEngine::getOsc1FrequencyDc() const { return _osc1FreqDc; }
-float SynthEngine::getOsc2FrequencyDc() const { return _osc2FreqDc; }
-float SynthEngine::getOsc1ShapeDc() const     { return _osc1ShapeDc; }
-float SynthEngine::getOsc2ShapeDc() const     { return _osc2ShapeDc; }
+float SynthEngine::getSupersawDetune(uint8_t osc) const { return (osc<2)?_params.staged().osc[osc].ssDetune:0.0f; }
+float SynthEngine::getSupersawMix(uint8_t osc)    const { return (osc<2)?_params.staged().osc[osc].ssMix:0.0f; }
+float SynthEngine::getOsc1PitchOffset() const { return _params.staged().osc[0].pitchSemi; }
+float SynthEngine::getOsc2PitchOffset() const { return _params.staged().osc[1].pitchSemi; }
+float SynthEngine::getOsc1Detune() const { return _params.staged().osc[0].detune; }
+float SynthEngine::getOsc2Detune() const { return _params.staged().osc[1].detune; }
+float SynthEngine::getOsc1FineTune() const { return _params.staged().osc[0].fineCents; }
+float SynthEngine::getOsc2FineTune() const { return _params.staged().osc[1].fineCents; }
+float SynthEngine::getOscMix1() const { return _params.staged().osc[0].level; }
+float SynthEngine::getOscMix2() const { return _params.staged().osc[1].level; }
+float SynthEngine::getSubMix() const { return _params.staged().sub; }
+float SynthEngine::getNoiseMix() const { return _params.staged().noise; }
+float SynthEngine::getRing1Mix() const { return _params.staged().ring[0]; }
+float SynthEngine::getRing2Mix() const { return _params.staged().ring[1]; }
+float SynthEngine::getOsc1FrequencyDc() const { return _params.staged().osc[0].freqDc; }
+float SynthEngine::getOsc2FrequencyDc() const { return _params.staged().osc[1].freqDc; }
+float SynthEngine::getOsc1ShapeDc() const     { return _params.staged().osc[0].shapeDc; }
+float SynthEngine::getOsc2ShapeDc() const     { return _params.staged().osc[1].shapeDc; }
 
-float SynthEngine::getOsc1FeedbackAmount( ) const {return _osc1FeedbackAmount;}
-float SynthEngine::getOsc2FeedbackAmount( ) const {return _osc2FeedbackAmount;}
+float SynthEngine::getOsc1FeedbackAmount( ) const {return _params.staged().osc[0].fbAmount;}
+float SynthEngine::getOsc2FeedbackAmount( ) const {return _params.staged().osc[1].fbAmount;}
 
-float SynthEngine::getOsc1FeedbackMix( ) const {return _osc1FeedbackMix;}
-float SynthEngine::getOsc2FeedbackMix( ) const {return _osc2FeedbackMix;}
+float SynthEngine::getOsc1FeedbackMix( ) const {return _params.staged().osc[0].fbMix;}
+float SynthEngine::getOsc2FeedbackMix( ) const {return _params.staged().osc[1].fbMix;}
 
-bool  SynthEngine::getGlideEnabled() const { return _glideEnabled; }
-float SynthEngine::getGlideTimeMs()  const { return _glideTimeMs; }
+void SynthEngine::setGlideEnabled(bool on) { _params.edit(VoiceParam::GLIDE).glideEnabled = on; }
+void SynthEngine::setGlideTime(float ms)   { _params.edit(VoiceParam::GLIDE).glideTimeMs  = ms; }
 
+bool  SynthEngine::getGlideEnabled() const { return _params.staged().glideEnabled; }
+float SynthEngine::getGlideTimeMs()  const { return _params.staged().glideTimeMs; }
 
 
-// ---- MIDI CC dispatcher with JT_LOGF tracing --------------------------------
-// ---- MIDI CC dispatcher: now using CCDefs.h names consistently ----
-void SynthEngine::handleControlChange(byte /*channel*/, byte control, byte value) {
-    // Human-readable CC name for logs
-    const char* ccName = CC::name(control);
-    if (!ccName) ccName = "?";
-
-    const float norm = value / 127.0f;
-
-    switch (control) {
-        // ------------------- OSC waveforms -------------------
-        case CC::OSC1_WAVE: {
-            WaveformType t = waveformFromCC(value);
-            setOsc1Waveform((int)t);
-            JT_LOGF("[CC %u:%s] OSC1 Waveform -> %s (%d)\n", control, ccName, waveformShortName(t), (int)t);
-        } break;
-
-        case CC::OSC2_WAVE: {
-            WaveformType t = waveformFromCC(value);
-            setOsc2Waveform((int)t);
-            JT_LOGF("[CC %u:%s] OSC2 Waveform -> %s (%d)\n", control, ccName, waveformShortName(t), (int)t);
-        } break;
-
-        // ------------------- Mod Wheel (example: LFO1 frequency) -------------------
-        case 1: { // MIDI ModWheel
-            float hz = JT4000Map::cc_to_lfo_hz(value);
-            setLFO1Frequency(hz);
-            JT_LOGF("[CC %u:ModWheel] LFO1 Freq = %.4f Hz\n", control, hz);
-        } break;
-
-        // ------------------- Filter main -------------------
-        case CC::FILTER_CUTOFF: {
-            float hz = JT4000Map::cc_to_obxa_cutoff_hz(value);
-            hz = fminf(fmaxf(hz, CUTOFF_MIN_HZ), CUTOFF_MAX_HZ);
-            setFilterCutoff(hz);
-            JT_LOGF("[CC %u:%s] Cutoff = %.2f Hz\n", control, ccName, hz);
-        } break;
-
-        case CC::FILTER_RESONANCE: {
-            float r = JT4000Map::cc_to_obxa_res01(value);
-            setFilterResonance(r);
-            JT_LOGF("[CC %u:%s] Resonance (k) = %.4f\n", control, ccName, r);
-        } break;
-
-        // ------------------- Amp envelope -------------------
-        case CC::AMP_ATTACK: {
-            float ms = CCtoTime(value);
-            for (int i=0; i<MAX_VOICES; ++i) _voices[i].setAmpAttack(ms);
-            JT_LOGF("[CC %u:%s] Amp Attack = %.2f ms\n", control, ccName, ms);
-        } break;
-
-        case CC::AMP_DECAY: {
-            float ms = CCtoTime(value);
-            for (int i=0; i<MAX_VOICES; ++i) _voices[i].setAmpDecay(ms);
-            JT_LOGF("[CC %u:%s] Amp Decay = %.2f ms\n", control, ccName, ms);
-        } break;
-
-        case CC::AMP_SUSTAIN: {
-            for (int i=0; i<MAX_VOICES; ++i) _voices[i].setAmpSustain(norm);
-            JT_LOGF("[CC %u:%s] Amp Sustain = %.3f\n", control, ccName, norm);
-        } break;
-
-        case CC::AMP_RELEASE: {
-            float ms = CCtoTime(value);
-            for (int i=0; i<MAX_VOICES; ++i) _voices[i].setAmpRelease(ms);
-            JT_LOGF("[CC %u:%s] Amp Release = %.2f ms\n", control, ccName, ms);
-        } break;
-
-        // ------------------- Filter envelope -------------------
-        case CC::FILTER_ENV_ATTACK: {
-            float ms = CCtoTime(value);
-            for (int i=0; i<MAX_VOICES; ++i) _voices[i].setFilterAttack(ms);
-            JT_LOGF("[CC %u:%s] Filt Env Attack = %.2f ms\n", control, ccName, ms);
-        } break;
-
-        case CC::FILTER_ENV_DECAY: {
-            float ms = CCtoTime(value);
-            for (int i=0; i<MAX_VOICES; ++i) _voices[i].setFilterDecay(ms);
-            JT_LOGF("[CC %u:%s] Filt Env Decay = %.2f ms\n", control, ccName, ms);
-        } break;
-
-        case CC::FILTER_ENV_SUSTAIN: {
-            for (int i=0; i<MAX_VOICES; ++i) _voices[i].setFilterSustain(norm);
-            JT_LOGF("[CC %u:%s] Filt Env Sustain = %.3f\n", control, ccName, norm);
-        } break;
-
-        case CC::FILTER_ENV_RELEASE: {
-            float ms = CCtoTime(value);
-            for (int i=0; i<MAX_VOICES; ++i) _voices[i].setFilterRelease(ms);
-            JT_LOGF("[CC %u:%s] Filt Env Release = %.2f ms\n", control, ccName, ms);
-        } break;
-
-        // ------------------- Coarse pitch (stepped) -------------------
-        case CC::OSC1_PITCH_OFFSET: {
-            float semis;
-            if (value <= 25)       semis = -24.0f;
-            else if (value <= 51)  semis = -12.0f;
-            else if (value <= 76)  semis =   0.0f;
-            else if (value <= 101) semis = +12.0f;
-            else                   semis = +24.0f;
-            setOsc1PitchOffset(semis);
-            JT_LOGF("[CC %u:%s] OSC1 Coarse = %.1f semitones\n", control, ccName, semis);
-        } break;
-
-        case CC::OSC2_PITCH_OFFSET: {
-            float semis;
-            if (value <= 25)       semis = -24.0f;
-            else if (value <= 51)  semis = -12.0f;
-            else if (value <= 76)  semis =   0.0f;
-            else if (value <= 101) semis = +12.0f;
-            else                   semis = +24.0f;
-            setOsc2PitchOffset(semis);
-            JT_LOGF("[CC %u:%s] OSC2 Coarse = %.1f semitones\n", control, ccName, semis);
-        } break;
-
-        // ------------------- Detune / Fine -------------------
-        case CC::OSC1_DETUNE:    { float d = norm * 2.0f - 1.0f;     setOsc1Detune(d);      JT_LOGF("[CC %u:%s] OSC1 Detune = %.3f\n",        control, ccName, d); } break;
-        case CC::OSC2_DETUNE:    { float d = norm * 2.0f - 1.0f;     setOsc2Detune(d);      JT_LOGF("[CC %u:%s] OSC2 Detune = %.3f\n",        control, ccName, d); } break;
-        case CC::OSC1_FINE_TUNE: { float c = norm * 200.0f - 100.0f; setOsc1FineTune(c);    JT_LOGF("[CC %u:%s] OSC1 Fine = %.1f cents\n",    control, ccName, c); } break;
-        case CC::OSC2_FINE_TUNE: { float c = norm * 200.0f - 100.0f; setOsc2FineTune(c);    JT_LOGF("[CC %u:%s] OSC2 Fine = %.1f cents\n",    control, ccName, c); } break;
-
-        // ------------------- Osc mix + taps -------------------
-        case CC::OSC1_FEEDBACK_AMOUNT: {
-            float a = norm;
-            setOsc1FeedbackAmount(norm);
-            JT_LOGF("[CC %u:%s] Osc1 feedback amount = %.3f \n", control, ccName, a);
-        } break;
-
-        case CC::OSC2_FEEDBACK_AMOUNT: {
-            float a = norm;
-            setOsc2FeedbackAmount(norm);
-            JT_LOGF("[CC %u:%s] Osc2 feedback amount = %.3f \n", control, ccName, a);
-        } break;
-
-        case CC::OSC1_FEEDBACK_MIX: {
-            float a = norm;
-            setOsc1FeedbackMix(norm);
-            JT_LOGF("[CC %u:%s] Osc1 feedback mix = %.3f \n", control, ccName, a);
-        } break;
-
-         case CC::OSC2_FEEDBACK_MIX: {
-            float a = norm;
-            setOsc1FeedbackMix(norm);
-            JT_LOGF("[CC %u:%s] Osc2 feedback mix = %.3f \n", control, ccName, a);
-        } break;
-
-        // ------------------- Osc mix + taps -------------------
-        case CC::OSC_MIX_BALANCE: {
-            float l = 1.0f - norm, r = norm;
-            setOscMix(l, r);
-            JT_LOGF("[CC %u:%s] Osc Mix balance L=%.3f R=%.3f\n", control, ccName, l, r);
-        } break;
-
-        case CC::OSC1_MIX: {
-            for (int i=0; i<MAX_VOICES; ++i) _voices[i].setOsc1Mix(norm);
-            _osc1Mix = norm;
-            JT_LOGF("[CC %u:%s] OSC1 Mix = %.3f\n", control, ccName, norm);
-        } break;
-
-        case CC::OSC2_MIX: {
-            for (int i=0; i<MAX_VOICES; ++i) _voices[i].setOsc2Mix(norm);
-            _osc2Mix = norm;
-            JT_LOGF("[CC %u:%s] OSC2 Mix = %.3f\n", control, ccName, norm);
-        } break;
-
-        case CC::SUB_MIX:   { setSubMix(norm);   JT_LOGF("[CC %u:%s] Sub Mix   = %.3f\n", control, ccName, norm); } break;
-        case CC::NOISE_MIX: { setNoiseMix(norm); JT_LOGF("[CC %u:%s] Noise Mix = %.3f\n", control, ccName, norm); } break;
-
-        // ------------------- Filter modulation -------------------
-        case CC::FILTER_ENV_AMOUNT: {
-            float a = norm * 2.0f - 1.0f;
-            setFilterEnvAmount(a);
-            JT_LOGF("[CC %u:%s] Filt Env Amount = %.3f\n", control, ccName, a);
-        } break;
-
-        case CC::FILTER_KEY_TRACK: {
-            float k = norm * 2.0f - 1.0f;
-            setFilterKeyTrackAmount(k);
-            JT_LOGF("[CC %u:%s] KeyTrack = %.3f\n", control, ccName, k);
-        } break;
-
-        case CC::FILTER_OCTAVE_CONTROL: {
-            float o = norm * 10.0f;
-            setFilterOctaveControl(o);
-            JT_LOGF("[CC %u:%s] Filter Octave = %.3f\n", control, ccName, o);
-        } break;
-
-            case CC::FILTER_OBXA_MULTIMODE:  {setFilterMultimode((value));  JT_LOGF("[CC %u:%s] FILTER_OBXA_MULTIMODE = %.3f\n", control, ccName, value);} break;      
-            case CC::FILTER_OBXA_TWO_POLE:    {setFilterTwoPole((value));JT_LOGF("[CC %u:%s] FILTER_OBXA_TWO_POLE  = %.3f\n", control, ccName, value);} break;         
-            case CC::FILTER_OBXA_XPANDER_4_POLE: {setFilterXpander4Pole((value));JT_LOGF("[CC %u:%s] FILTER_OBXA_XPANDER_4_POLE  = %.3f\n", control, ccName, value);} break;    
-            case CC::FILTER_OBXA_XPANDER_MODE:  {setFilterXpanderMode((value));JT_LOGF("[CC %u:%s] FILTER_OBXA_XPANDER_MODE  = %.3f\n", control, ccName, value);} break;   
-            case CC::FILTER_OBXA_BP_BLEND_2_POLE: {setFilterBPBlend2Pole((value));JT_LOGF("[CC %u:%s] FILTER_OBXA_BP_BLEND_2_POLE  = %.3f\n", control, ccName, value);} break;  
-            case CC::FILTER_OBXA_PUSH_2_POLE:  {setFilterPush2Pole((value) );JT_LOGF("[CC %u:%s] FILTER_OBXA_PUSH_2_POLE  = %.3f\n", control, ccName, value);} break;      
-            case CC::FILTER_OBXA_RES_MOD_DEPTH:  {setFilterResonanceModDepth(value);JT_LOGF("[CC %u:%s] FILTER_OBXA_RES_MOD_DEPTH  = %.3f\n", control, ccName, value);} break;    
-
-        // ------------------- LFO1 -------------------
-        case CC::LFO1_FREQ:        { float hz = JT4000Map::cc_to_lfo_hz(value); setLFO1Frequency(hz); JT_LOGF("[CC %u:%s] LFO1 Freq = %.4f Hz\n", control, ccName, hz); } break;
-        case CC::LFO1_DEPTH:       { setLFO1Amount(norm); JT_LOGF("[CC %u:%s] LFO1 Depth = %.3f\n", control, ccName, norm); } break;
-        case CC::LFO1_DESTINATION: { int d = JT4000Map::lfoDestFromCC(value); setLFO1Destination((LFODestination)d); JT_LOGF("[CC %u:%s] LFO1 Dest = %d\n", control, ccName, d); } break;
-        case CC::LFO1_WAVEFORM:    { WaveformType t = waveformFromCC(value); setLFO1Waveform((int)t); JT_LOGF("[CC %u:%s] LFO1 Wave -> %s (%d)\n", control, ccName, waveformShortName(t), (int)t); } break;
-
-        // ------------------- LFO2 -------------------
-        case CC::LFO2_FREQ:        { float hz = JT4000Map::cc_to_lfo_hz(value); setLFO2Frequency(hz); JT_LOGF("[CC %u:%s] LFO2 Freq = %.4f Hz\n", control, ccName, hz); } break;
-        case CC::LFO2_DEPTH:       { setLFO2Amount(norm); JT_LOGF("[CC %u:%s] LFO2 Depth = %.3f\n", control, ccName, norm); } break;
-        case CC::LFO2_DESTINATION: { int d = JT4000Map::lfoDestFromCC(value); setLFO2Destination((LFODestination)d); JT_LOGF("[CC %u:%s] LFO2 Dest = %d\n", control, ccName, d); } break;
-        case CC::LFO2_WAVEFORM:    { WaveformType t = waveformFromCC(value); setLFO2Waveform((int)t); JT_LOGF("[CC %u:%s] LFO2 Wave -> %s (%d)\n", control, ccName, waveformShortName(t), (int)t); } break;
-
-        
-        // ============================================================================
-        // JPFX CC HANDLERS (add to handleControlChange switch)
-        // ============================================================================
-
-
-        // --- JPFX Tone Control ---
-        case CC::FX_BASS_GAIN: {
-            float dB = (norm * 24.0f) - 12.0f; // 0..1 → -12..+12 dB
-            setFXBassGain(dB);
-            JT_LOGF("[CC %u:%s] Bass = %.1f dB\n", control, ccName, dB);
-        } break;
-
-        case CC::FX_TREBLE_GAIN: {
-            float dB = (norm * 24.0f) - 12.0f; // 0..1 → -12..+12 dB
-            setFXTrebleGain(dB);
-            JT_LOGF("[CC %u:%s] Treble = %.1f dB\n", control, ccName, dB);
-        } break;
-
-        // --- JPFX Modulation Effects ---
-        case CC::FX_MOD_EFFECT: {
-            // Map CC 0..127 to -1..10 (off + 11 variations)
-            int8_t variation = -1;
-            if (value > 0) {
-                // Map 1..127 evenly across 0..10
-                variation = ((uint16_t)(value - 1) * 11) / 127;
-                if (variation > 10) variation = 10;
-            }
-            setFXModEffect(variation);
-            JT_LOGF("[CC %u:%s] Mod Effect = %d (%s)\n", 
-                    control, ccName, variation, getFXModEffectName());
-        } break;
-
-        case CC::FX_MOD_MIX: {
-            setFXModMix(norm);
-            JT_LOGF("[CC %u:%s] Mod Mix = %.3f\n", control, ccName, norm);
-        } break;
-
-        case CC::FX_MOD_RATE: {
-            float hz = norm * 20.0f; // 0..1 → 0..20 Hz
-            setFXModRate(hz);
-            JT_LOGF("[CC %u:%s] Mod Rate = %.2f Hz\n", control, ccName, hz);
-        } break;
-
-        case CC::FX_MOD_FEEDBACK: {
-            // Map CC 0..127 to -1..0.99 (0 = use preset)
-            float fb = -1.0f;
-            if (value > 0) {
-                fb = ((value - 1) / 126.0f) * 0.99f;
-            }
-            setFXModFeedback(fb);
-            JT_LOGF("[CC %u:%s] Mod FB = %.3f\n", control, ccName, fb);
-        } break;
-
-        // --- JPFX Delay Effects ---
-        case CC::FX_JPFX_DELAY_EFFECT: {
-            // Map CC 0..127 to -1..4 (off + 5 variations)
-            int8_t variation = -1;
-            if (value > 0) {
-                variation = ((uint16_t)(value - 1) * 5) / 127;
-                if (variation > 4) variation = 4;
-            }
-            setFXDelayEffect(variation);
-            JT_LOGF("[CC %u:%s] Delay Effect = %d (%s)\n", 
-                    control, ccName, variation, getFXDelayEffectName());
-        } break;
-
-        case CC::FX_JPFX_DELAY_MIX: {
-            setFXDelayMix(norm);
-            JT_LOGF("[CC %u:%s] Delay Mix = %.3f\n", control, ccName, norm);
-        } break;
-
-        case CC::FX_JPFX_DELAY_FEEDBACK: {
-            // Map CC 0..127 to -1..0.99 (0 = use preset)
-            float fb = -1.0f;
-            if (value > 0) {
-                fb = ((value - 1) / 126.0f) * 0.99f;
-            }
-            setFXDelayFeedback(fb);
-            JT_LOGF("[CC %u:%s] Delay FB = %.3f\n", control, ccName, fb);
-        } break;
-
-        case CC::FX_JPFX_DELAY_TIME: {
-            float ms = norm * 1500.0f; // 0..1 → 0..1500 ms
-            setFXDelayTime(ms);
-            JT_LOGF("[CC %u:%s] Delay Time = %.1f ms\n", control, ccName, ms);
-        } break;
-
-        // --- JPFX Dry Mix ---
-        case CC::FX_DRY_MIX: {
-            setFXDryMix(norm);
-            JT_LOGF("[CC %u:%s] Dry Mix = %.3f\n", control, ccName, norm);
-        } break;
-        case CC::FX_REVERB_SIZE: {
-    setFXReverbRoomSize(norm);
-    JT_LOGF("[CC %u:%s] Reverb Size = %.3f\n", control, ccName, norm);
-} break;
-
-case CC::FX_REVERB_DAMP: {
-    setFXReverbHiDamping(norm);
-    JT_LOGF("[CC %u:%s] Reverb HiDamp = %.3f\n", control, ccName, norm);
-} break;
-
-case CC::FX_REVERB_LODAMP: {
-    setFXReverbLoDamping(norm);
-    JT_LOGF("[CC %u:%s] Reverb LoDamp = %.3f\n", control, ccName, norm);
-} break;
-
-case CC::FX_REVERB_MIX: {
-    setFXReverbMix(norm, norm);  // Stereo
-    JT_LOGF("[CC %u:%s] Reverb Mix = %.3f\n", control, ccName, norm);
-} break;
 
-// ============================================================================
-// NEW CC HANDLERS FOR FX MIX CONTROLS
-// ============================================================================
+// ---- MIDI CC dispatcher ------------------------------------------------------
+// Every CC source lands here.  The per-CC work (curve, handler, fan-out) lives
+// in the CCDispatch descriptor table; this layer assembles 14-bit values and
+// drops CCs that would not change anything.
+void SynthEngine::handleControlChange(byte /*channel*/, byte control, byte value) {
+    if (control >= 128) return;
+    value &= 0x7F;
 
-case CC::FX_JPFX_MIX: {
-    // FX_JPFX_MIX controls the JPFX output level (bypasses reverb)
-    // This is the "JPFX Mix" control on Page 19
-    float mix = norm;  // norm is already calculated from CC value
-    setFXJPFXMix(mix, mix);  // Set both L and R channels
-    JT_LOGF("[CC %u:%s] JPFX Mix = %.3f\n", control, ccName, mix);
-    if (_notify) _notify(control, value);
-} break;
-
-case CC::FX_REVERB_BYPASS: {
-    // FX_REVERB_BYPASS toggles reverb on/off for CPU savings
-    // Values > 63 = bypassed, <= 63 = active
-    bool bypass = (value > 63);
-    setFXReverbBypass(bypass);
-    JT_LOGF("[CC %u:%s] Reverb Bypass = %s\n", control, ccName, bypass ? "ON" : "OFF");
-    if (_notify) _notify(control, value);
-} break;
-
-
-        // ------------------- Supersaw / DC / Ring -------------------
-        case CC::SUPERSAW1_DETUNE: { setSupersawDetune(0, norm); JT_LOGF("[CC %u:%s] Supersaw1 Detune = %.3f\n", control, ccName, norm); } break;
-        case CC::SUPERSAW1_MIX:    { setSupersawMix(0, norm);    JT_LOGF("[CC %u:%s] Supersaw1 Mix    = %.3f\n", control, ccName, norm); } break;
-        case CC::SUPERSAW2_DETUNE: { setSupersawDetune(1, norm); JT_LOGF("[CC %u:%s] Supersaw2 Detune = %.3f\n", control, ccName, norm); } break;
-        case CC::SUPERSAW2_MIX:    { setSupersawMix(1, norm);    JT_LOGF("[CC %u:%s] Supersaw2 Mix    = %.3f\n", control, ccName, norm); } break;
-
-        // OSC1/2 FREQ DC — static pitch offset injected into the FM mixer.
-        // Unipolar: CC=0 → no shift, CC=127 → +24 semitones (2 octaves up).
-        //
-        // PROBLEM with old code (setOsc1FrequencyDcAmp(norm)):
-        //   norm=1.0 → FM input=1.0 → shift = 2^(1.0 × 10) = 1024× freq = 10 octaves
-        //   (well beyond audio range — inaudible; hence "no effect")
-        //   norm=0.0 → no shift — also "no effect"
-        //
-        // FIX: scale so CC=127 → +24 semitones using FM_SEMITONE_SCALE.
-        //   amp = norm × DC_PITCH_MAX_SEMITONES × FM_SEMITONE_SCALE
-        //       = norm × 24 × (1/120) = norm × 0.2
-        //
-        // Presets with CC=0 (default/unset) still play in tune — no regression.
-        case CC::OSC1_FREQ_DC: {
-            const float dcAmp = norm * DC_PITCH_MAX_SEMITONES * FM_SEMITONE_SCALE;
-            setOsc1FrequencyDcAmp(dcAmp);
-            JT_LOGF("[CC %u:%s] Osc1 Freq DC %.0f semitones (amp %.4f)\n",
-                    control, ccName, norm * DC_PITCH_MAX_SEMITONES, dcAmp);
-        } break;
-        case CC::OSC1_SHAPE_DC: { setOsc1ShapeDcAmp(norm); JT_LOGF("[CC %u:%s] Osc1 Shape DC = %.3f\n", control, ccName, norm); } break;
-        case CC::OSC2_FREQ_DC: {
-            const float dcAmp = norm * DC_PITCH_MAX_SEMITONES * FM_SEMITONE_SCALE;
-            setOsc2FrequencyDcAmp(dcAmp);
-            JT_LOGF("[CC %u:%s] Osc2 Freq DC %.0f semitones (amp %.4f)\n",
-                    control, ccName, norm * DC_PITCH_MAX_SEMITONES, dcAmp);
-        } break;
-        case CC::OSC2_SHAPE_DC: { setOsc2ShapeDcAmp(norm); JT_LOGF("[CC %u:%s] Osc2 Shape DC = %.3f\n", control, ccName, norm); } break;
-
-        case CC::RING1_MIX: { setRing1Mix(norm); JT_LOGF("[CC %u:%s] Ring1 Mix = %.3f\n", control, ccName, norm); } break;
-        case CC::RING2_MIX: { setRing2Mix(norm); JT_LOGF("[CC %u:%s] Ring2 Mix = %.3f\n", control, ccName, norm); } break;
-
-        // ------------------- Arbitrary waveform bank selection -------------------
-        case CC::OSC1_ARB_BANK: {
-            // Map CC value (0..127) evenly across number of banks
-            const uint8_t numBanks = static_cast<uint8_t>(ArbBank::BwTri) + 1;
-            uint8_t bankIdx = (static_cast<uint16_t>(value) * numBanks) / 128;
-            if (bankIdx >= numBanks) bankIdx = numBanks - 1;
-            ArbBank bank = static_cast<ArbBank>(bankIdx);
-            setOsc1ArbBank(bank);
-            JT_LOGF("[CC %u:%s] OSC1 Bank -> %s (%u)\n", control, ccName, akwf_bankName(bank), bankIdx);
-        } break;
-
-        case CC::OSC2_ARB_BANK: {
-            const uint8_t numBanks = static_cast<uint8_t>(ArbBank::BwTri) + 1;
-            uint8_t bankIdx = (static_cast<uint16_t>(value) * numBanks) / 128;
-            if (bankIdx >= numBanks) bankIdx = numBanks - 1;
-            ArbBank bank = static_cast<ArbBank>(bankIdx);
-            setOsc2ArbBank(bank);
-            JT_LOGF("[CC %u:%s] OSC2 Bank -> %s (%u)\n", control, ccName, akwf_bankName(bank), bankIdx);
-        } break;
-
-        // ------------------- Arbitrary waveform table index ----------------------
-        case CC::OSC1_ARB_INDEX: {
-            uint16_t count = akwf_bankCount(_osc1ArbBank);
-            uint16_t idx = 0;
-            if (count > 0) {
-                idx = (static_cast<uint16_t>(value) * count) / 128;
-                if (idx >= count) idx = count - 1;
-            }
-            setOsc1ArbIndex(idx);
-            JT_LOGF("[CC %u:%s] OSC1 Table -> %u/%u\n", control, ccName, idx, count);
-        } break;
-
-        case CC::OSC2_ARB_INDEX: {
-            uint16_t count = akwf_bankCount(_osc2ArbBank);
-            uint16_t idx = 0;
-            if (count > 0) {
-                idx = (static_cast<uint16_t>(value) * count) / 128;
-                if (idx >= count) idx = count - 1;
-            }
-            setOsc2ArbIndex(idx);
-            JT_LOGF("[CC %u:%s] OSC2 Table -> %u/%u\n", control, ccName, idx, count);
-        } break;
-
-        // ------------------- Glide -------------------
-        case CC::GLIDE_ENABLE: {
-            _glideEnabled = (value >= 1);
-            for (int i=0; i<MAX_VOICES; ++i) _voices[i].setGlideEnabled(_glideEnabled);
-            JT_LOGF("[CC %u:%s] Glide Enabled = %d\n", control, ccName, (int)_glideEnabled);
-        } break;
-
-        case CC::GLIDE_TIME: {
-            float ms = CCtoTime(value);
-            _glideTimeMs = ms;
-            for (int i=0; i<MAX_VOICES; ++i) _voices[i].setGlideTime(ms);
-            JT_LOGF("[CC %u:%s] Glide Time = %.2f ms\n", control, ccName, ms);
-        } break;
-
-        //AMP_MOD_FIXED_LEVEL
-        case CC::AMP_MOD_FIXED_LEVEL: { SetAmpModFixedLevel(norm); JT_LOGF("[CC %u:%s] Amp mod fixed level = %.3f\n", control, ccName, norm); } break;
-
-case CC::BPM_CLOCK_SOURCE: {
-    // 0-63 = Internal, 64-127 = External
-    bool useExternal = (value >= 64);
-    if (_bpmClock) {
-        _bpmClock->setClockSource(useExternal ? 
-            ClockSource::CLOCK_EXTERNAL_MIDI : 
-            ClockSource::CLOCK_INTERNAL);
-        JT_LOGF("[CC %u:%s] Clock Source = %s\n", 
-                control, ccName, useExternal ? "EXTERNAL" : "INTERNAL");
+    // 14-bit prefix: hold the LSB for the next CC
+    if (control == CC::HIRES_LSB) {
+        _hiresLsb = value;
+        return;
     }
-    
-    break;
-}
 
-case CC::BPM_INTERNAL_TEMPO: {
-    // 0-127 → 40-300 BPM
-    float bpm = 40.0f + (value / 127.0f) * (300.0f - 40.0f);
-    if (_bpmClock) {
-        _bpmClock->setInternalBPM(bpm);
-        JT_LOGF("[CC %u:%s] Internal BPM = %.1f\n", control, ccName, bpm);
-    }
-    break;
-}
-
-case CC::LFO1_TIMING_MODE: {
-    // Map value 0-127 to 12 timing modes
-    TimingMode mode = TimingMode::TIMING_FREE;
-    if (value >= 0 && value <= 10)       mode = TimingMode::TIMING_FREE;
-    else if (value >= 11 && value <= 21) mode = TimingMode::TIMING_4_BARS;
-    else if (value >= 22 && value <= 32) mode = TimingMode::TIMING_2_BARS;
-    else if (value >= 33 && value <= 43) mode = TimingMode::TIMING_1_BAR;
-    else if (value >= 44 && value <= 54) mode = TimingMode::TIMING_1_2;
-    else if (value >= 55 && value <= 65) mode = TimingMode::TIMING_1_4;
-    else if (value >= 66 && value <= 76) mode = TimingMode::TIMING_1_8;
-    else if (value >= 77 && value <= 87) mode = TimingMode::TIMING_1_16;
-    else if (value >= 88 && value <= 98) mode = TimingMode::TIMING_1_32;
-    else if (value >= 99 && value <= 109) mode = TimingMode::TIMING_1_4T;
-    else if (value >= 110 && value <= 120) mode = TimingMode::TIMING_1_8T;
-    else if (value >= 121 && value <= 127) mode = TimingMode::TIMING_1_16T;
-    
-    setLFO1TimingMode(mode);
-    JT_LOGF("[CC %u:%s] LFO1 Timing = %s\n", 
-            control, ccName, TimingModeNames[(int)mode]);
-    break;
-}
-
-case CC::LFO2_TIMING_MODE: {
-    // Same mapping as LFO1
-    TimingMode mode = TimingMode::TIMING_FREE;
-    if (value >= 0 && value <= 10)       mode = TimingMode::TIMING_FREE;
-    else if (value >= 11 && value <= 21) mode = TimingMode::TIMING_4_BARS;
-    else if (value >= 22 && value <= 32) mode = TimingMode::TIMING_2_BARS;
-    else if (value >= 33 && value <= 43) mode = TimingMode::TIMING_1_BAR;
-    else if (value >= 44 && value <= 54) mode = TimingMode::TIMING_1_2;
-    else if (value >= 55 && value <= 65) mode = TimingMode::TIMING_1_4;
-    else if (value >= 66 && value <= 76) mode = TimingMode::TIMING_1_8;
-    else if (value >= 77 && value <= 87) mode = TimingMode::TIMING_1_16;
-    else if (value >= 88 && value <= 98) mode = TimingMode::TIMING_1_32;
-    else if (value >= 99 && value <= 109) mode = TimingMode::TIMING_1_4T;
-    else if (value >= 110 && value <= 120) mode = TimingMode::TIMING_1_8T;
-    else if (value >= 121 && value <= 127) mode = TimingMode::TIMING_1_16T;
-    
-    setLFO2TimingMode(mode);
-    JT_LOGF("[CC %u:%s] LFO2 Timing = %s\n", 
-            control, ccName, TimingModeNames[(int)mode]);
-    break;
-}
-
-case CC::DELAY_TIMING_MODE: {
-    // Same mapping as LFOs
-    TimingMode mode = TimingMode::TIMING_FREE;
-    if (value >= 0 && value <= 10)       mode = TimingMode::TIMING_FREE;
-    else if (value >= 11 && value <= 21) mode = TimingMode::TIMING_4_BARS;
-    else if (value >= 22 && value <= 32) mode = TimingMode::TIMING_2_BARS;
-    else if (value >= 33 && value <= 43) mode = TimingMode::TIMING_1_BAR;
-    else if (value >= 44 && value <= 54) mode = TimingMode::TIMING_1_2;
-    else if (value >= 55 && value <= 65) mode = TimingMode::TIMING_1_4;
-    else if (value >= 66 && value <= 76) mode = TimingMode::TIMING_1_8;
-    else if (value >= 77 && value <= 87) mode = TimingMode::TIMING_1_16;
-    else if (value >= 88 && value <= 98) mode = TimingMode::TIMING_1_32;
-    else if (value >= 99 && value <= 109) mode = TimingMode::TIMING_1_4T;
-    else if (value >= 110 && value <= 120) mode = TimingMode::TIMING_1_8T;
-    else if (value >= 121 && value <= 127) mode = TimingMode::TIMING_1_16T;
-    
-    setDelayTimingMode(mode);
-    JT_LOGF("[CC %u:%s] Delay Timing = %s\n", 
-            control, ccName, TimingModeNames[(int)mode]);
-    break;
-}
-
-
-
-        // =================== NEW: LFO per-destination depths ===================
-        // Each CC maps to a 0..1 depth for a specific LFO→destination lane.
-        // Final mixer gain = masterAmount * depthScalar.
-
-        case CC::LFO1_PITCH_DEPTH:  { setLFO1PitchDepth(norm);  JT_LOGF("[CC %u] LFO1 Pitch depth %.3f\n",  control, norm); } break;
-        case CC::LFO1_FILTER_DEPTH: { setLFO1FilterDepth(norm); JT_LOGF("[CC %u] LFO1 Filter depth %.3f\n", control, norm); } break;
-        case CC::LFO1_PWM_DEPTH:    { setLFO1PWMDepth(norm);    JT_LOGF("[CC %u] LFO1 PWM depth %.3f\n",    control, norm); } break;
-        case CC::LFO1_AMP_DEPTH:    { setLFO1AmpDepth(norm);    JT_LOGF("[CC %u] LFO1 Amp depth %.3f\n",    control, norm); } break;
-        case CC::LFO1_DELAY:
-        {   // CC 0-127 → 0-4000 ms delay before LFO reaches full depth
-            const float ms = norm * 4000.0f;
-            setLFO1Delay(ms);
-            JT_LOGF("[CC %u] LFO1 Delay %.0f ms\n", control, ms);
-        } break;
-
-        case CC::LFO2_PITCH_DEPTH:  { setLFO2PitchDepth(norm);  JT_LOGF("[CC %u] LFO2 Pitch depth %.3f\n",  control, norm); } break;
-        case CC::LFO2_FILTER_DEPTH: { setLFO2FilterDepth(norm); JT_LOGF("[CC %u] LFO2 Filter depth %.3f\n", control, norm); } break;
-        case CC::LFO2_PWM_DEPTH:    { setLFO2PWMDepth(norm);    JT_LOGF("[CC %u] LFO2 PWM depth %.3f\n",    control, norm); } break;
-        case CC::LFO2_AMP_DEPTH:    { setLFO2AmpDepth(norm);    JT_LOGF("[CC %u] LFO2 Amp depth %.3f\n",    control, norm); } break;
-        case CC::LFO2_DELAY:
-        {   const float ms = norm * 4000.0f;
-            setLFO2Delay(ms);
-            JT_LOGF("[CC %u] LFO2 Delay %.0f ms\n", control, ms);
-        } break;
-
-        // =================== NEW: Pitch envelope ===================
-        // ADSR times share the same cc_to_time_ms() mapping as amp/filter envs.
-        // DEPTH is bipolar: CC64 = 0 semitones; 0 = -24; 127 = +24.
-
-        case CC::PITCH_ENV_ATTACK:  { setPitchEnvAttack(CCtoTime(value));  JT_LOGF("[CC %u] PEnv Attack %.1f ms\n",  control, CCtoTime(value)); } break;
-        case CC::PITCH_ENV_DECAY:   { setPitchEnvDecay(CCtoTime(value));   JT_LOGF("[CC %u] PEnv Decay %.1f ms\n",   control, CCtoTime(value)); } break;
-        case CC::PITCH_ENV_SUSTAIN: { setPitchEnvSustain(norm);            JT_LOGF("[CC %u] PEnv Sustain %.3f\n",    control, norm);            } break;
-        case CC::PITCH_ENV_RELEASE: { setPitchEnvRelease(CCtoTime(value)); JT_LOGF("[CC %u] PEnv Release %.1f ms\n", control, CCtoTime(value)); } break;
-        case CC::PITCH_ENV_DEPTH:
-        {   // Bipolar: CC 64 = 0 semis, 0 = -24, 127 = +24
-            const float semis = ((float)value - 64.0f) * (24.0f / 64.0f);
-            setPitchEnvDepth(semis);
-            JT_LOGF("[CC %u] PEnv Depth %.1f semitones\n", control, semis);
-        } break;
-
-        // =================== NEW: Velocity sensitivity ===================
-        case CC::VELOCITY_AMP_SENS:    { setVelocityAmpSens(norm);    JT_LOGF("[CC %u] Vel Amp Sens %.3f\n",    control, norm); } break;
-        case CC::VELOCITY_FILTER_SENS: { setVelocityFilterSens(norm); JT_LOGF("[CC %u] Vel Filter Sens %.3f\n", control, norm); } break;
-        case CC::VELOCITY_ENV_SENS:    { setVelocityEnvSens(norm);    JT_LOGF("[CC %u] Vel Env Sens %.3f\n",    control, norm); } break;
-
-        // PITCH_BEND_RANGE: CC 0..127 → 0..PITCH_BEND_MAX_SEMITONES (24).
-        // Default = 2 semitones (standard MIDI keyboard).
-        // Setting to 12 gives a full-octave wheel; 24 gives 2-octave.
-        case CC::PITCH_BEND_RANGE: {
-            const float rangeSemis = norm * PITCH_BEND_MAX_SEMITONES;
-            setPitchBendRange(rangeSemis);
-            JT_LOGF("[CC %u:%s] Bend range = ±%.1f semitones\n", control, ccName, rangeSemis);
-        } break;
-
-        // ------------------- Fallback -------------------
-        default:
-            JT_LOGF("[CC %u:%s] Unmapped value=%u\n", control, ccName, value);
-            break;
+    const CCDispatch::Descriptor& d = CCDispatch::descriptor(control);
+    uint16_t v14   = (uint16_t)((value << 7) | value);
+    bool     hires = false;
+    if (_hiresLsb >= 0) {
+        if (d.curve != CCDispatch::Curve::Raw) {
+            v14   = (uint16_t)((value << 7) | _hiresLsb);
+            hires = true;
+        }
+        _hiresLsb = -1;
     }
 
     // Keep raw CC cache in sync — lets the UI read back any value via getCC()
     // without needing a typed getter for every parameter.
-    if (control < 128) {
-        _ccState[control] = value;
+    _ccState[control] = value;
+
+    const bool unchanged = !(d.flags & CCDispatch::ALWAYS) && _ccApplied[control] == v14;
+    CCDispatch::noteReceived(control, unchanged);
+    if (unchanged) return;
+
+    // Other CCs writing the same engine state must re-apply next time
+    if (d.link) {
+        for (uint8_t cc = 0; cc < 128; ++cc) {
+            if (CCDispatch::kTable.cc[cc].link == d.link) _ccApplied[cc] = CC_NEVER;
+        }
     }
-}
\ No newline at end of file
+    _ccApplied[control] = v14;
+
+    // Preset change: anything that is not staged voice state waits for the
+    // swap
+    if (_presetState != PRESET_IDLE && !(d.flags & (CCDispatch::STAGED | CCDispatch::ALWAYS)) && d.fn) {
+        _holdPresetCC(control, value, v14, hires);
+        _presetStats.deferred++;
+        if (_notify) _notify(control, value);
+        return;
+    }
+
+    CCDispatch::apply(*this, control, value, v14, hires);
+    if (_notify) _notify(control, value);
+}
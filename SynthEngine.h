@@ -1,6 +1,6 @@
 #pragma once
-// SynthEngine.h — 8-voice polyphonic synthesizer engine
-// Mixer topology: Voices 0-3 → MixerA, Voices 4-7 → MixerB, A+B → MixerFinal
+// SynthEngine.h — polyphonic synthesizer engine (JT_POLYPHONY voices, default 8)
+// Mixer topology: voices + amp mod → AudioMixerN summing bus → FX chain
 // CPU target: < 80% @ 44.1 kHz on Teensy 4.1
 
 #include <Arduino.h>
@@ -12,6 +12,9 @@
 #include "DebugTrace.h"
 #include "AKWF_All.h"
 #include "BPMClockManager.h"
+#include "AudioMixerN.h"
+#include "VoiceParams.h"
+#include "CpuGovernor.h"
 
 using namespace JT4000Map;
 
@@ -19,7 +22,7 @@ using namespace JT4000Map;
 // FREQUENCY MODULATION SCALING — READ THIS BEFORE TOUCHING ANY PITCH GAINS
 // ============================================================================
 //
-// OscillatorBlock wires a 4-channel AudioMixer4 into the FM input of every
+// OscillatorBlock wires a 4-channel AudioMixer4Q15 into the FM input of every
 // AudioSynthWaveformModulated oscillator.  The call:
 //
 //     _mainOsc.frequencyModulation(FM_OCTAVE_RANGE)   // = 10
@@ -67,7 +70,42 @@ using namespace JT4000Map;
 //   The bend amount is applied to all active voices via SynthEngine::setPitchBend().
 // ============================================================================
 
-#define MAX_VOICES 8   // 8-voice polyphony
+// ============================================================================
+// POLYPHONY — compile-time voice count
+// ============================================================================
+// Build with -DJT_POLYPHONY=N (4, 6, 8, 12 or 16).  Everything sized by voice
+// count derives from it: voice/patch arrays, the allocator, the summing bus
+// width (AudioMixerN<MAX_VOICES>), the headroom gain and the audio block pool.
+// ============================================================================
+#ifndef JT_POLYPHONY
+#define JT_POLYPHONY 8
+#endif
+
+#define MAX_VOICES JT_POLYPHONY
+
+static_assert(MAX_VOICES == 4 || MAX_VOICES == 6 || MAX_VOICES == 8 ||
+              MAX_VOICES == 12 || MAX_VOICES == 16,
+              "JT_POLYPHONY must be 4, 6, 8, 12 or 16");
+
+// Headroom: the full-correlation peak stays where the original 8-voice
+// mix had it (8 × 0.1), applied once to the bus's 32-bit sum.
+static constexpr float VOICE_SUM_GAIN = 0.8f / MAX_VOICES;
+
+// Preset change: the voice bus dips out over half the crossfade, the new
+// patch swaps in at silence, and the bus fades back in over the other half.
+// 0 = hard switch (the swap still lands on one block boundary).
+static constexpr float PRESET_CROSSFADE_MS_DEFAULT = 20.0f;
+static constexpr float PRESET_CROSSFADE_MS_MAX     = 500.0f;
+
+// After each swap the audio CPU is measured over this window (from the end
+// of the fade-in) and logged with the parked-object count for that preset.
+static constexpr uint32_t PRESET_CPU_WINDOW_MS = 1000;
+
+// AudioMemory() pool: 216 blocks at 8 voices, 10 more per extra voice
+// (2 of them for the voice's AudioEffectVoiceLFO stages, which allocate
+// while their ramp is rising or they are key-synced)
+#define AUDIO_MEMORY_BLOCKS (136 + 10 * MAX_VOICES)
+
 
 // Must equal the argument passed to _mainOsc.frequencyModulation(N) in OscillatorBlock.
 static constexpr float FM_OCTAVE_RANGE = 10.0f;
@@ -187,10 +225,12 @@ inline bool isVoiceActive(uint8_t v) const {
     void setOsc2ArbBank(ArbBank b);
     void setOsc1ArbIndex(uint16_t idx);
     void setOsc2ArbIndex(uint16_t idx);
-    ArbBank  getOsc1ArbBank()  const { return _osc1ArbBank; }
-    ArbBank  getOsc2ArbBank()  const { return _osc2ArbBank; }
-    uint16_t getOsc1ArbIndex() const { return _osc1ArbIndex; }
-    uint16_t getOsc2ArbIndex() const { return _osc2ArbIndex; }
+    // A user table was rewritten (SysEx upload): re-select it where playing
+    void reloadArbTable(ArbBank b, uint16_t idx);
+    ArbBank  getOsc1ArbBank()  const { return _params.staged().osc[0].arbBank; }
+    ArbBank  getOsc2ArbBank()  const { return _params.staged().osc[1].arbBank; }
+    uint16_t getOsc1ArbIndex() const { return _params.staged().osc[0].arbIndex; }
+    uint16_t getOsc2ArbIndex() const { return _params.staged().osc[1].arbIndex; }
 
     // =========================================================================
     // Amp modulation DC offset
@@ -240,6 +280,8 @@ inline bool isVoiceActive(uint8_t v) const {
     float getLFO1PWMDepth()    const { return _lfo1PWMDepth; }
     float getLFO1AmpDepth()    const { return _lfo1AmpDepth; }
     float getLFO1Delay()       const { return _lfo1DelayMs; }
+    void  setLFO1KeySync(bool on);      // Per-voice phase restart at noteOn
+    bool  getLFO1KeySync()     const { return _lfo1KeySync; }
 
     void  setLFO2PitchDepth(float d);   void  setLFO2FilterDepth(float d);
     void  setLFO2PWMDepth(float d);     void  setLFO2AmpDepth(float d);
@@ -249,6 +291,8 @@ inline bool isVoiceActive(uint8_t v) const {
     float getLFO2PWMDepth()    const { return _lfo2PWMDepth; }
     float getLFO2AmpDepth()    const { return _lfo2AmpDepth; }
     float getLFO2Delay()       const { return _lfo2DelayMs; }
+    void  setLFO2KeySync(bool on);
+    bool  getLFO2KeySync()     const { return _lfo2KeySync; }
 
     // =========================================================================
     // NEW: Pitch envelope — separate ADSR that modulates oscillator pitch.
@@ -257,11 +301,11 @@ inline bool isVoiceActive(uint8_t v) const {
     void setPitchEnvAttack(float ms);   void setPitchEnvDecay(float ms);
     void setPitchEnvSustain(float l);   void setPitchEnvRelease(float ms);
     void setPitchEnvDepth(float semitones);
-    float getPitchEnvAttack()  const { return _pitchEnvAttack; }
-    float getPitchEnvDecay()   const { return _pitchEnvDecay; }
-    float getPitchEnvSustain() const { return _pitchEnvSustain; }
-    float getPitchEnvRelease() const { return _pitchEnvRelease; }
-    float getPitchEnvDepth()   const { return _pitchEnvDepth; }
+    float getPitchEnvAttack()  const { return _params.staged().pitchEnv.attack; }
+    float getPitchEnvDecay()   const { return _params.staged().pitchEnv.decay; }
+    float getPitchEnvSustain() const { return _params.staged().pitchEnv.sustain; }
+    float getPitchEnvRelease() const { return _params.staged().pitchEnv.release; }
+    float getPitchEnvDepth()   const { return _params.staged().pitchEnvDepth; }
 
     // =========================================================================
     // NEW: Velocity sensitivity — three targets matching JP-8000
@@ -271,9 +315,9 @@ inline bool isVoiceActive(uint8_t v) const {
     void  setVelocityAmpSens(float s);    // → VCA level scale
     void  setVelocityFilterSens(float s); // → filter cutoff offset (octaves)
     void  setVelocityEnvSens(float s);    // → filter env depth scale
-    float getVelocityAmpSens()    const { return _velAmpSens; }
-    float getVelocityFilterSens() const { return _velFilterSens; }
-    float getVelocityEnvSens()    const { return _velEnvSens; }
+    float getVelocityAmpSens()    const { return _params.staged().velAmpSens; }
+    float getVelocityFilterSens() const { return _params.staged().velFilterSens; }
+    float getVelocityEnvSens()    const { return _params.staged().velEnvSens; }
 
     // =========================================================================
     // Filter
@@ -296,17 +340,22 @@ inline bool isVoiceActive(uint8_t v) const {
     float   getFilterEnvAmount()       const;
     float   getFilterKeyTrackAmount()  const;
     float   getFilterOctaveControl()   const;
-    float   getFilterMultimode()       const { return _filterMultimode; }
-    bool    getFilterTwoPole()         const { return _filterUseTwoPole; }
-    bool    getFilterXpander4Pole()    const { return _filterXpander4Pole; }
-    uint8_t getFilterXpanderMode()     const { return _filterXpanderMode; }
-    bool    getFilterBPBlend2Pole()    const { return _filterBpBlend2Pole; }
-    bool    getFilterPush2Pole()       const { return _filterPush2Pole; }
-    float   getFilterResonanceModDepth() const { return _filterResonaceModDepth; }
+    float   getFilterMultimode()       const { return _params.staged().multimode; }
+    bool    getFilterTwoPole()         const { return _params.staged().twoPole; }
+    bool    getFilterXpander4Pole()    const { return _params.staged().xpander4Pole; }
+    uint8_t getFilterXpanderMode()     const { return _params.staged().xpanderMode; }
+    bool    getFilterBPBlend2Pole()    const { return _params.staged().bpBlend2Pole; }
+    bool    getFilterPush2Pole()       const { return _params.staged().push2Pole; }
+    float   getFilterResonanceModDepth() const { return _params.staged().resModDepth; }
 
     // =========================================================================
     // Envelopes
     // =========================================================================
+    void  setAmpAttack(float ms);        void setAmpDecay(float ms);
+    void  setAmpSustain(float level);    void setAmpRelease(float ms);
+    void  setFilterEnvAttack(float ms);  void setFilterEnvDecay(float ms);
+    void  setFilterEnvSustain(float l);  void setFilterEnvRelease(float ms);
+
     float getAmpAttack()         const;
     float getAmpDecay()          const;
     float getAmpSustain()        const;
@@ -404,22 +453,82 @@ inline bool isVoiceActive(uint8_t v) const {
     float getOsc1ShapeDc()     const;
     float getOsc2ShapeDc()     const;
 
+    void  setGlideEnabled(bool on);
+    void  setGlideTime(float ms);
     bool  getGlideEnabled() const;
     float getGlideTimeMs()  const;
 
     // =========================================================================
     // MIDI
     // =========================================================================
+    // Single CC entry point (MIDI, UI, presets) — table-driven, see CCDispatch.h.
+    // A CC whose value has not changed since it was last applied is dropped.
     void handleControlChange(byte channel, byte control, byte value);
 
     // Callback fired after every CC is processed; UI uses this to stay in sync
     using NotifyFn = void(*)(uint8_t cc, uint8_t val);
     void setNotifier(NotifyFn fn);
 
+    // =========================================================================
+    // Preset change — bracket a preset load (loop context)
+    // =========================================================================
+    // beginPresetChange() fades the voice bus out and holds publishing: CCs
+    // that follow build the staged voice snapshot (CCDispatch STAGED) or are
+    // held for the swap (everything else).  commitPresetChange() ends the
+    // load; once the bus is silent, update() applies the held CCs and
+    // publishes the snapshot in one AudioLock section, then fades the bus
+    // back in.  The audio thread only ever sees the bus fade.
+    //
+    // The swap is not O(1): held CCs are kept one per CC (latest value wins)
+    // and replayed through their handlers with audio masked, so the section
+    // costs up to one handler per non-staged CC (LFO, FX and global CCs)
+    // plus one publish.  presetStats() reports it per load (swapCycles,
+    // swapHeld); tests/host/test_preset_swap measures the built-in presets.
+    void  beginPresetChange();
+    void  commitPresetChange();
+    bool  presetChangePending() const { return _presetState != PRESET_IDLE; }
+
+    void  setPresetCrossfadeMs(float ms);
+    float getPresetCrossfadeMs() const { return _presetFadeMs; }
+
+    // Since boot; cycles are CPU cycles (loop context)
+    struct PresetStats {
+        uint32_t loads          = 0;
+        uint32_t deferred       = 0;   // CCs held for the swap
+        uint32_t buildCycles    = 0;   // begin → commit, last load
+        uint32_t buildCyclesMax = 0;
+        uint32_t swapCycles     = 0;   // Held CCs + publish, last swap
+        uint32_t swapCyclesMax  = 0;
+        uint8_t  swapHeld       = 0;   // Held CCs replayed by the last swap
+        uint8_t  swapHeldMax    = 0;
+        float    cpuAvg         = 0.0f;   // Audio CPU % over PRESET_CPU_WINDOW_MS, last load
+        float    cpuMax         = 0.0f;
+        uint16_t dormantNodes   = 0;      // Objects parked at the end of that window
+    };
+    const PresetStats& presetStats() const { return _presetStats; }
+
+    // =========================================================================
+    // CPU governor (see CpuGovernor.h)
+    // =========================================================================
+    void    setGovernorEnabled(bool enabled);
+    bool    getGovernorEnabled() const { return _govEnabled; }
+    uint8_t getGovernorLevel() const   { return _gov.level(); }
+
+    // Simulated CPU ceiling: the governor sees max(real, pct) so the policy
+    // can be exercised on a light patch.  Negative disables the override.
+    void    setGovernorCpuOverride(float pct) { _govCpuOverride = pct; }
+
+    // Supersaw 2× oversampling (quality setting; governor level ≥ 2 drops it)
+    void    setSupersawOversample(bool enable);
+    bool    getSupersawOversample() const { return _supersawOversample; }
+
+    // Shared voice parameter block counters (see VoiceParams.h)
+    const VoiceParamBlock::Stats& voiceParamStats() const { return _params.stats(); }
+
     // =========================================================================
     // Audio graph outputs
     // =========================================================================
-    AudioMixer4& getVoiceMixer() { return _voiceMixerFinal; }
+    AudioStream& getVoiceMixer() { return _voiceSum; }
     AudioMixer4& getFXOutL()     { return _fxChain.getOutputLeft(); }
     AudioMixer4& getFXOutR()     { return _fxChain.getOutputRight(); }
 
@@ -427,7 +536,10 @@ inline bool isVoiceActive(uint8_t v) const {
     // BPM clock sync
     // =========================================================================
     void setBPMClock(BPMClockManager* clock);
-    void updateBPMSync();   // Called from update() to refresh synced params
+    void setBPMClockSource(bool external);
+    void setBPMInternalTempo(float bpm);
+    void setBPMTransport(bool play);
+    void updateBPMSync();   // Called from update(); acts only on clock events
 
     void       setLFO1TimingMode(TimingMode mode);
     void       setLFO2TimingMode(TimingMode mode);
@@ -439,15 +551,15 @@ inline bool isVoiceActive(uint8_t v) const {
 
 private:
     // =========================================================================
-    // 8-voice audio architecture
+    // Voice audio architecture (MAX_VOICES voices)
     //
-    //   Voices 0-3 → _voiceMixerA  
-    //                                → _voiceMixerFinal → FX chain
-    //   Voices 4-7 → _voiceMixerB  
+    //   Voices 0..MAX_VOICES-1 ─┐
+    //                            ├→ _voiceSum (AudioMixerN) → FX chain
+    //   _ampModMixer (amp mod) ──┘
     //
-    // Each voice contributes 1/8 of full scale.
-    // CPU @ 44.1 kHz: ~30-40% for voices, leaves headroom for FX.
-    // RAM: 8 × VoiceBlock (~8 KB each) = ~64 KB.
+    // One pass: 32-bit sum, × VOICE_SUM_GAIN, × amp mod, soft limit.
+    // CPU @ 44.1 kHz: ~30-40% for 8 voices, leaves headroom for FX.
+    // RAM: ~8 KB per VoiceBlock.
     // =========================================================================
 
     VoiceBlock  _voices[MAX_VOICES];
@@ -465,17 +577,15 @@ private:
     // Amp envelope × LFO multiply chain
     float                _ampModFixedLevel = 1.0f;
     AudioSynthWaveformDc _ampModFixedDc;
-    AudioSynthWaveformDc _ampModLimitFixedDc;
-    AudioEffectMultiply  _ampMultiply;
-    AudioMixer4          _ampModMixer;       // Fixed DC + LFO1 + LFO2
-    AudioMixer4          _ampModLimiterMixer;
+    AudioMixer4Q15       _ampModMixer;       // Fixed DC + LFO1 + LFO2 → _voiceSum mod input
+    float                _lfo1AmpGain = 0.0f, _lfo2AmpGain = 0.0f;   // Last _ampModMixer LFO gains
+    uint8_t              _ampDormantNodes = 0;
 
     // -------------------------------------------------------------------------
-    // Voice mixing — three-stage architecture
+    // Voice mixing — single summing bus (declared after the voices and the
+    // amp-mod mixer so it updates after them in the same audio cycle)
     // -------------------------------------------------------------------------
-    AudioMixer4 _voiceMixerA;      // Voices 0-3
-    AudioMixer4 _voiceMixerB;      // Voices 4-7
-    AudioMixer4 _voiceMixerFinal;  // A + B → FX chain
+    AudioMixerN<MAX_VOICES> _voiceSum;
 
     // -------------------------------------------------------------------------
     // FX chain
@@ -486,51 +596,62 @@ private:
     // Audio patch cables (heap-allocated, persistent)
     // -------------------------------------------------------------------------
     AudioConnection* _voicePatch[MAX_VOICES];
-    AudioConnection* _voicePatchLFO1ShapeOsc1[MAX_VOICES];
-    AudioConnection* _voicePatchLFO1ShapeOsc2[MAX_VOICES];
-    AudioConnection* _voicePatchLFO1FrequencyOsc1[MAX_VOICES];
-    AudioConnection* _voicePatchLFO1FrequencyOsc2[MAX_VOICES];
-    AudioConnection* _voicePatchLFO1Filter[MAX_VOICES];
-    AudioConnection* _voicePatchLFO2ShapeOsc1[MAX_VOICES];
-    AudioConnection* _voicePatchLFO2ShapeOsc2[MAX_VOICES];
-    AudioConnection* _voicePatchLFO2FrequencyOsc1[MAX_VOICES];
-    AudioConnection* _voicePatchLFO2FrequencyOsc2[MAX_VOICES];
-    AudioConnection* _voicePatchLFO2Filter[MAX_VOICES];
+    AudioConnection* _voicePatchLFO1[MAX_VOICES];   // → VoiceBlock::lfoInput(0)
+    AudioConnection* _voicePatchLFO2[MAX_VOICES];   // → VoiceBlock::lfoInput(1)
 
     AudioConnection* _patchAmpModFixedDcToAmpModMixer;
     AudioConnection* _patchLFO1ToAmpModMixer;
     AudioConnection* _patchLFO2ToAmpModMixer;
-    AudioConnection* _patchAmpModMixerToAmpMultiply;
-    AudioConnection* _patchVoiceMixerToAmpMultiply;
-    AudioConnection* _fxPatchInL;    // Amp multiply → JPFX left input
-    AudioConnection* _fxPatchInR;    // Amp multiply → JPFX right input
-    AudioConnection* _fxPatchDryL;   // Amp multiply → dry mixer left
-    AudioConnection* _fxPatchDryR;   // Amp multiply → dry mixer right
-
-    AudioConnection* _patchMixerAToFinal;  // Sub-mixer A → final
-    AudioConnection* _patchMixerBToFinal;  // Sub-mixer B → final
+    AudioConnection* _patchAmpModMixerToVoiceSum;
+    AudioConnection* _fxPatchInL;    // Voice sum → JPFX left input
+    AudioConnection* _fxPatchInR;    // Voice sum → JPFX right input
+    AudioConnection* _fxPatchDryL;   // Voice sum → dry mixer left
+    AudioConnection* _fxPatchDryR;   // Voice sum → dry mixer right
+
+    // =========================================================================
+    // Voice patch parameters — written once here, applied by each voice at
+    // the next publish (update() / noteOn()); UI getters read staged()
+    // =========================================================================
+    VoiceParamBlock _params;
+
+    void _publishParams();      // Staged → live, then every voice applies it
+
+    // Preset change (beginPresetChange() / commitPresetChange())
+    enum PresetState : uint8_t { PRESET_IDLE, PRESET_STAGING, PRESET_COMMITTED };
+    struct HeldCC {
+        uint8_t  value;
+        uint16_t v14;
+        bool     hires;
+    };
+
+    PresetState _presetState  = PRESET_IDLE;
+    float       _presetFadeMs = PRESET_CROSSFADE_MS_DEFAULT;
+    uint32_t    _presetT0     = 0;
+    HeldCC      _presetHeld[128];          // Latest held value, indexed by CC
+    uint8_t     _presetHeldOrder[128];     // Held CCs in order of latest arrival
+    uint8_t     _presetHeldCount = 0;
+    uint32_t    _presetHeldMask[4] = {};   // Bit per CC in _presetHeldOrder
+    PresetStats _presetStats;
+
+    // Per-preset CPU window (loop context)
+    bool        _cpuMeasuring = false;
+    bool        _cpuWindowOpen = false;   // Fade-in done, samples being taken
+    uint32_t    _cpuWindowStartMs = 0;
+    float       _cpuSum = 0.0f;
+    uint32_t    _cpuSamples = 0;
+
+    void _holdPresetCC(uint8_t cc, uint8_t value, uint16_t v14, bool hires);
+    void _clearPresetHeld();
+    void _swapPreset();         // Held CCs + publish at silence, then fade in
+    void _measurePresetCpu();   // One sample per update() pass while a window runs
 
     // =========================================================================
     // Cached synthesis parameters (typed, for UI getters)
     // =========================================================================
 
-    // Oscillator
-    int   _osc1Wave = 0,  _osc2Wave = 0;
-    float _osc1PitchSemi = 0.0f, _osc2PitchSemi = 0.0f;
     // Pitch bend state — shared across all voices.
     float _pitchBendRange = PITCH_BEND_DEFAULT_SEMITONES;  // ±semitones at wheel extremes
     float _pitchBendSemis = 0.0f;                          // current bend in semitones
-    float _osc1DetuneSemi = 0.0f, _osc2DetuneSemi = 0.0f;
-    float _osc1FineCents = 0.0f,  _osc2FineCents = 0.0f;
-    float _osc1Mix = 1.0f,  _osc2Mix = 1.0f;
-    float _subMix = 0.0f,   _noiseMix = 0.0f;
-    float _ring1Mix = 0.0f, _ring2Mix = 0.0f;
-    float _supersawDetune[2] = {0.0f, 0.0f};
-    float _supersawMix[2]    = {0.0f, 0.0f};
-    float _osc1FreqDc = 0.0f,  _osc2FreqDc = 0.0f;
-    float _osc1ShapeDc = 0.0f, _osc2ShapeDc = 0.0f;
-    float _osc1FeedbackAmount = 0.0f, _osc2FeedbackAmount = 0.0f;
-    float _osc1FeedbackMix    = 0.0f, _osc2FeedbackMix    = 0.0f;
 
     // LFO mirrors
     float _lfo1Frequency = 0.0f, _lfo2Frequency = 0.0f;
@@ -539,32 +660,8 @@ private:
     LFODestination _lfo1Dest = (LFODestination)0;
     LFODestination _lfo2Dest = (LFODestination)0;
 
-    // Filter
-    float   _filterCutoffHz   = 20000.0f;
-    float   _filterResonance  = 0.0f;
-    float   _filterEnvAmount  = 0.0f;
-    float   _filterKeyTrack   = 0.0f;
-    float   _filterOctaves    = 0.0f;
-    float   _filterMultimode  = 0.0f;
-    bool    _filterUseTwoPole   = false;
-    bool    _filterXpander4Pole = false;
-    uint8_t _filterXpanderMode  = 0;
-    bool    _filterBpBlend2Pole = false;
-    bool    _filterPush2Pole    = false;
-    float   _filterResModDepth    = 0.0f;
-    float   _filterResonaceModDepth = 0.0f;  // note: intentional spelling kept for ABI
-
-    // Glide
-    bool  _glideEnabled = false;
-    float _glideTimeMs  = 0.0f;
     float _lastNoteFreq = 0.0f;
 
-    // Arbitrary waveform selection
-    ArbBank  _osc1ArbBank  = ArbBank::BwBlended;
-    ArbBank  _osc2ArbBank  = ArbBank::BwBlended;
-    uint16_t _osc1ArbIndex = 0;
-    uint16_t _osc2ArbIndex = 0;
-
     // JPFX cached parameters
     float  _fxBassGain       = 0.0f;
     float  _fxTrebleGain     = 0.0f;
@@ -592,16 +689,41 @@ private:
     // =========================================================================
     uint8_t _ccState[128] = {};
 
+    // Last applied 14-bit value per CC (7-bit v → v << 7 | v); CC_NEVER until
+    // first applied.  Drives no-op suppression in handleControlChange().
+    static constexpr uint16_t CC_NEVER = 0xFFFF;
+    uint16_t _ccApplied[128];
+    int16_t  _hiresLsb = -1;   // Pending CC::HIRES_LSB value, -1 = none
+
     // =========================================================================
     // BPM / timing
     // =========================================================================
     BPMClockManager* _bpmClock = nullptr;  // Pointer to global clock (not owned)
+    uint32_t _bpmTempoRevision = 0xFFFFFFFFu;  // Last tempo change applied
 
     // =========================================================================
     // UI notifier callback
     // =========================================================================
     NotifyFn _notify = nullptr;
 
+    // =========================================================================
+    // CPU governor state
+    // =========================================================================
+    CpuGovernor _gov;
+    bool     _govEnabled        = true;
+    float    _govCpuOverride    = -1.0f;
+    uint8_t  _voiceLimit        = MAX_VOICES; // Held notes allowed (levels 4/5)
+    bool     _supersawOversample = false;
+
+    void    _updateGovernor();
+    uint8_t _governorSheds() const;           // CpuGovernor::sample() 'sheds' mask
+    void    _applyGovernorLevel(uint8_t level);
+    void _releaseVoice(int v);
+    void _enforceVoiceLimit();
+
+    // Wavetable cache report after an arbitrary-table select
+    void _logWavetableCache();
+
     // =========================================================================
     // NEW: LFO per-destination depth scalars (0..1 each)
     // =========================================================================
@@ -610,26 +732,14 @@ private:
     float _lfo2PitchDepth  = 0.0f, _lfo2FilterDepth = 0.0f;
     float _lfo2PWMDepth    = 0.0f, _lfo2AmpDepth    = 0.0f;
 
-    // NEW: LFO delay (fade-in) state — managed in update()
+    // NEW: LFO delay (fade-in) time — each voice's LFO stage ramps its own
+    // pitch/filter/PWM signal from its noteOn; the global amp path uses
+    // LFOBlock's fade stage
     float    _lfo1DelayMs    = 0.0f, _lfo2DelayMs    = 0.0f;
-    float    _lfo1CurrentAmp = 0.0f, _lfo2CurrentAmp = 0.0f;
-    uint32_t _lfo1NoteOnMs   = 0,    _lfo2NoteOnMs   = 0;
-    bool     _lfo1Ramping    = false, _lfo2Ramping    = false;
-
-    // NEW: Pitch envelope cached ADSR and depth
-    float _pitchEnvAttack  = 1.0f;
-    float _pitchEnvDecay   = 80.0f;
-    float _pitchEnvSustain = 0.0f;
-    float _pitchEnvRelease = 50.0f;
-    float _pitchEnvDepth   = 0.0f;  // semitones, signed
-
-    // NEW: Velocity sensitivity scalars (0..1)
-    float _velAmpSens    = 0.0f;
-    float _velFilterSens = 0.0f;
-    float _velEnvSens    = 0.0f;
+    bool     _lfo1KeySync    = false, _lfo2KeySync   = false;
 
     // NEW: Private helpers
     void _applyLFO1Gains();     // Recompute all LFO1 destination mixer gains
     void _applyLFO2Gains();     // Recompute all LFO2 destination mixer gains
-    void _updateLFODelay();     // Called from update(): handle delay ramps
+    void _applyAmpModDormancy(); // Park the amp-mod chain while it is a unity multiply
 };
\ No newline at end of file
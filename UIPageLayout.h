@@ -34,7 +34,7 @@
 //   LFO      : 15 LFO1 freq/depth/dest/wave
 //              16 LFO2 freq/depth/dest/wave
 //
-//   LFO sync : 17 LFO1 timing / LFO2 timing / - / -
+//   LFO sync : 17 LFO1 timing / LFO2 timing / LFO1 key / LFO2 key
 //
 //   FX       : 18 Bass / Treble / ModFX / ModMix
 //              19 ModRate / ModFB / DelayFX / DelayMix
@@ -146,8 +146,8 @@ static constexpr uint8_t ccMap[NUM_PAGES][PARAMS_PER_PAGE] = {
     // Page 16: LFO2 — rate, depth, destination, waveform
     { CC::LFO2_FREQ, CC::LFO2_DEPTH, CC::LFO2_DESTINATION, CC::LFO2_WAVEFORM },
 
-    // Page 17: LFO BPM sync modes (free / note divisions)
-    { CC::LFO1_TIMING_MODE, CC::LFO2_TIMING_MODE, 255, 255 },
+    // Page 17: LFO BPM sync modes (free / note divisions) + per-voice key sync
+    { CC::LFO1_TIMING_MODE, CC::LFO2_TIMING_MODE, CC::LFO1_KEY_SYNC, CC::LFO2_KEY_SYNC },
 
     // =========================================================================
     // FX  (pages 18-22)
@@ -182,8 +182,8 @@ static constexpr uint8_t ccMap[NUM_PAGES][PARAMS_PER_PAGE] = {
     // BPM CLOCK  (page 25)
     // =========================================================================
 
-    // Page 25: BPM clock source and internal tempo
-    { CC::BPM_CLOCK_SOURCE, CC::BPM_INTERNAL_TEMPO, 255, 255 },
+    // Page 25: BPM clock source, internal tempo and clock-out transport
+    { CC::BPM_CLOCK_SOURCE, CC::BPM_INTERNAL_TEMPO, CC::BPM_TRANSPORT, 255 },
 
  
 
@@ -264,7 +264,7 @@ static constexpr const char* ccNames[NUM_PAGES][PARAMS_PER_PAGE] = {
     { "LFO2 Freq", "LFO2 Depth", "LFO2 Dest",  "LFO2 Wave" },
 
     // Page 17 — LFO sync
-    { "LFO1 Sync", "LFO2 Sync",  "---",        "---"       },
+    { "LFO1 Sync", "LFO2 Sync",  "LFO1 Key",   "LFO2 Key"  },
 
     // Page 18 — JPFX tone + mod effect
     { "Bass",      "Treble",     "Mod FX",     "Mod Mix"   },
@@ -288,7 +288,7 @@ static constexpr const char* ccNames[NUM_PAGES][PARAMS_PER_PAGE] = {
     { "OSC1 Bank", "OSC1 Wave#", "OSC2 Bank",  "OSC2 Wave#"},
 
     // Page 25 — BPM clock
-    { "Clock Src", "Int BPM",    "---",        "---"       },
+    { "Clock Src", "Int BPM",    "Transport",  "---"       },
 
     // Page 26 — LFO1 per-dest depths
     { "L1 Pitch",  "L1 Filter",  "L1 PWM",     "L1 Amp"    },
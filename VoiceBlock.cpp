@@ -1,26 +1,27 @@
 #include "synth_waveform.h"
 //#include "usb_serial.h"
 #include "VoiceBlock.h"
+#include "AudioDormancy.h"
+#include "AudioLock.h"
 
-VoiceBlock::VoiceBlock() : _osc1(true), _osc2(false)    // ← OSC1: supersaw enabled ← OSC2: supersaw disabled (saves CPU) 
+VoiceBlock::VoiceBlock()
 {
-    _patchCables[0] = new AudioConnection(_osc1.output(), 0, _oscMixer, 0);
-    _patchCables[1] = new AudioConnection(_osc2.output(), 0, _oscMixer, 1);
+    // Sources go straight into the filter's float input mixer: one int16 →
+    // float conversion per source, no intermediate mixer stages
+    _patchCables[0] = new AudioConnection(_osc1.output(), 0, _filter.input(), FilterBlock::inputPort(SRC_OSC1));
+    _patchCables[1] = new AudioConnection(_osc2.output(), 0, _filter.input(), FilterBlock::inputPort(SRC_OSC2));
     _patchCables[2] = new AudioConnection(_osc1.output(), 0, _ring1, 0);
     _patchCables[3] = new AudioConnection(_osc2.output(), 0, _ring1, 1);
     _patchCables[4] = new AudioConnection(_osc1.output(), 0, _ring2, 0);
     _patchCables[5] = new AudioConnection(_osc2.output(), 0, _ring2, 0);
-    _patchCables[6] = new AudioConnection(_ring1, 0, _oscMixer, 2);
-    _patchCables[7] = new AudioConnection(_ring2, 0, _oscMixer, 3);
-    _patchCables[8] = new AudioConnection(_oscMixer, 0, _voiceMixer, 0);
-    _patchCables[9] = new AudioConnection(_subOsc.output(), 0, _voiceMixer, 2);
-    _patchCables[10] = new AudioConnection(_noise, 0, _voiceMixer, 3); 
-    _patchCables[11] = new AudioConnection(_voiceMixer, 0, _filter.input(), 0);    
-    _patchCables[12] = new AudioConnection(_filter.output(), 0, _ampEnvelope.input(), 0);
-    //_patchCables[12] = new AudioConnection(_voiceMixer, 0, _ampEnvelope.input(), 0);
+    _patchCables[6] = new AudioConnection(_ring1, 0, _filter.input(), FilterBlock::inputPort(SRC_RING1));
+    _patchCables[7] = new AudioConnection(_ring2, 0, _filter.input(), FilterBlock::inputPort(SRC_RING2));
+    _patchCables[8] = new AudioConnection(_subOsc.output(), 0, _filter.input(), FilterBlock::inputPort(SRC_SUB));
+    _patchCables[9] = new AudioConnection(_noise, 0, _filter.input(), FilterBlock::inputPort(SRC_NOISE));
+    _patchCables[10] = new AudioConnection(_filter.output(), 0, _ampEnvelope.input(), 0);
     
-    _patchCables[13] = new AudioConnection(_filter.envmod(), 0 , _filterEnvelope.input(), 0); 
-    _patchCables[14] = new AudioConnection(_filterEnvelope.output(), 0, _filter.modMixer(), 1);
+    _patchCables[11] = new AudioConnection(_filter.envmod(), 0 , _filterEnvelope.input(), 0); 
+    _patchCables[12] = new AudioConnection(_filterEnvelope.output(), 0, _filter.modMixer(), 1);
     // Pitch envelope DC source.
     // _pitchEnvDc amplitude = semitones / 12.0 (set by SynthEngine::setPitchEnvDepth).
     // Positive amplitude → pitch UP, negative → pitch DOWN.
@@ -28,17 +29,16 @@ VoiceBlock::VoiceBlock() : _osc1(true), _osc2(false)    // ← OSC1: supersaw en
     // freqModMixer gain(3) is fixed at 1/10 (set by SynthEngine at construction).
     // At amplitude=1.0, gain=0.1, frequencyModulation(10): shift = 2^(1×0.1×10) = 2^1 = 1 oct.
     _pitchEnvDc.amplitude(0.0f);   // starts at 0; setPitchEnvDepth() writes the real value
-    _patchCables[15] = new AudioConnection(_pitchEnvDc, 0, _pitchEnvelope.input(), 0);
+    _patchCables[13] = new AudioConnection(_pitchEnvDc, 0, _pitchEnvelope.input(), 0);
 
-    _oscMixer.gain(0, _on);
-    _oscMixer.gain(1, _on);
-    _oscMixer.gain(2, 0.0f);
-    _oscMixer.gain(3, 0.0f);
-
-    _voiceMixer.gain(0, _on);
-    _voiceMixer.gain(1, 0.0f);
-    _voiceMixer.gain(2, 0.0f);
-    _voiceMixer.gain(3, 0.0f);
+    // Oscillator and ring levels carry the former voice-mixer headroom
+    // stage (_on) on top of their own level
+    _filter.setInputGain(SRC_OSC1,  _on * _on);
+    _filter.setInputGain(SRC_OSC2,  _on * _on);
+    _filter.setInputGain(SRC_RING1, 0.0f);
+    _filter.setInputGain(SRC_RING2, 0.0f);
+    _filter.setInputGain(SRC_SUB,   0.0f);
+    _filter.setInputGain(SRC_NOISE, 0.0f);
 
     _subOsc.setWaveform(WAVEFORM_SINE);
     _subOsc.setAmplitude(0.0f);
@@ -47,12 +47,22 @@ VoiceBlock::VoiceBlock() : _osc1(true), _osc2(false)    // ← OSC1: supersaw en
 
     _osc1.setWaveformType(WAVEFORM_SAWTOOTH);
     _osc2.setWaveformType(WAVEFORM_SAWTOOTH);
-    
-    
+
+    // Per-voice LFO stages → mod mixers (LFO1: slots 1/1/2, LFO2: 2/2/3)
+    for (uint8_t i = 0; i < 2; ++i) {
+        _lfoCables[i][0] = new AudioConnection(_lfoStage[i], 0, _osc1.frequencyModMixer(), i + 1);
+        _lfoCables[i][1] = new AudioConnection(_lfoStage[i], 0, _osc2.frequencyModMixer(), i + 1);
+        _lfoCables[i][2] = new AudioConnection(_lfoStage[i], 0, _osc1.shapeModMixer(), i + 1);
+        _lfoCables[i][3] = new AudioConnection(_lfoStage[i], 0, _osc2.shapeModMixer(), i + 1);
+        _lfoCables[i][4] = new AudioConnection(_lfoStage[i], 0, _filter.modMixer(), i + 2);
+    }
 }
 
 void VoiceBlock::noteOn(float freq, float velocity) {
+    syncParams();
+
     _isActive    = true;
+    _isIdle      = false;
     _currentFreq = freq;
 
     // velocity arrives here already normalised 0.0-1.0.
@@ -60,21 +70,30 @@ void VoiceBlock::noteOn(float freq, float velocity) {
     // so dividing again here would give ~0.008 max — essentially muting everything.
     const float velNorm = velocity;
 
+    // Velocity sensitivity (0 = flat, 1 = full) lives in the shared block
+    float velAmpSens = 0.0f, velFilterSens = 0.0f, velEnvSens = 0.0f;
+    if (const VoiceParamBlock* block = _params.block()) {
+        const VoiceParams& p = block->live();
+        velAmpSens    = p.velAmpSens;
+        velFilterSens = p.velFilterSens;
+        velEnvSens    = p.velEnvSens;
+    }
+
     // ---- Velocity → amp level ----
-    // _velAmpSens=0: full amplitude regardless of velocity.
-    // _velAmpSens=1: amplitude tracks velocity linearly.
+    // velAmpSens=0: full amplitude regardless of velocity.
+    // velAmpSens=1: amplitude tracks velocity linearly.
     // Blend between these two for intermediate values.
-    const float velAmpScale = (1.0f - _velAmpSens) + (_velAmpSens * velNorm);
+    const float velAmpScale = (1.0f - velAmpSens) + (velAmpSens * velNorm);
 
     // ---- Velocity → filter cutoff offset ----
     // Positive sensitivity opens the filter harder hits (±3 octaves max).
     static constexpr float kVelFilterOctRange = 3.0f;
-    const float cutoffOctOffset = _velFilterSens * (velNorm - 0.5f) * kVelFilterOctRange;
+    const float cutoffOctOffset = velFilterSens * (velNorm - 0.5f) * kVelFilterOctRange;
     _filter.setCutoff(_baseCutoff * powf(2.0f, cutoffOctOffset));
 
     // ---- Velocity → filter env depth ----
     // Scale stored base amount; does NOT permanently change _baseFilterEnvAmount.
-    const float envDepthScale = (1.0f - _velEnvSens) + (_velEnvSens * velNorm);
+    const float envDepthScale = (1.0f - velEnvSens) + (velEnvSens * velNorm);
     _filter.setEnvModAmount(_baseFilterEnvAmount * envDepthScale);
 
     // ---- Trigger oscillators with velocity-scaled amplitude ----
@@ -100,6 +119,11 @@ void VoiceBlock::noteOn(float freq, float velocity) {
     if (norm >  1.0f) norm =  1.0f;
     if (norm < -1.0f) norm = -1.0f;
     _filter.setKeyTrackAmount(norm);
+
+    // ---- Per-voice LFO: restart this voice's delay ramp and key-sync phase ----
+    // Other sounding voices are untouched, so chords don't re-fade vibrato.
+    _lfoStage[0].retrigger();
+    _lfoStage[1].retrigger();
 }
 
 void VoiceBlock::noteOff() {
@@ -137,40 +161,45 @@ void VoiceBlock::setOscMix(float _osc1Lvl, float _osc2Lvl) {
     
     _osc1Level = _osc1Lvl;
     _osc2Level = _osc2Lvl;
-    _oscMixer.gain(0, _clampedLevel(_osc1Level));
-    _oscMixer.gain(1, _clampedLevel(_osc2Level));
-   
+    _filter.setInputGain(SRC_OSC1, _clampedLevel(_osc1Level) * _on);
+    _filter.setInputGain(SRC_OSC2, _clampedLevel(_osc2Level) * _on);
+    _dormancyDirty = true;
 }
 
 void VoiceBlock::setOsc1Mix(float _oscLvl) {
     _osc1Level = _oscLvl;
-    _oscMixer.gain(0, _clampedLevel(_osc1Level));
+    _filter.setInputGain(SRC_OSC1, _clampedLevel(_osc1Level) * _on);
+    _dormancyDirty = true;
 }
 
 void VoiceBlock::setOsc2Mix(float _oscLvl) {
     _osc2Level = _oscLvl;
-    _oscMixer.gain(1, _clampedLevel(_osc2Level));
+    _filter.setInputGain(SRC_OSC2, _clampedLevel(_osc2Level) * _on);
+    _dormancyDirty = true;
 }
 
 void VoiceBlock::setRing1Mix(float level) {
     _ring1Level = level;
-    _oscMixer.gain(2, _clampedLevel(_ring1Level));    
+    _filter.setInputGain(SRC_RING1, _clampedLevel(_ring1Level) * _on);
+    _dormancyDirty = true;
 }
 
 void VoiceBlock::setRing2Mix(float level) {
     _ring2Level = level;
-    _oscMixer.gain(3, _clampedLevel(_ring2Level));    
+    _filter.setInputGain(SRC_RING2, _clampedLevel(_ring2Level) * _on);
+    _dormancyDirty = true;
 }
 
 void VoiceBlock::setSubMix(float level) {
     _subMix = level;
     // Sub-oscillator has TWO amplitude controls that must both be set:
     //   _subOsc internal amplitude — the DSP source output level
-    //   _voiceMixer.gain(2)        — the channel gate in the voice mixer
+    //   filter input gain          — the channel gate in the filter's input mixer
     // Constructor initialises both to 0.  Only setting the mixer gain leaves
     // the source silent regardless of mixer level.
     _subOsc.setAmplitude(_subMix);
-    _voiceMixer.gain(2, _clampedLevel(_subMix));
+    _filter.setInputGain(SRC_SUB, _clampedLevel(_subMix));
+    _dormancyDirty = true;
 }
 
 void VoiceBlock::setNoiseMix(float level) {
@@ -178,7 +207,8 @@ void VoiceBlock::setNoiseMix(float level) {
     // Same dual-control pattern as setSubMix.
     // AudioSynthNoisePink starts at amplitude(0.0f) — must be driven here.
     _noise.amplitude(_noiseMix);
-    _voiceMixer.gain(3, _clampedLevel(_noiseMix));
+    _filter.setInputGain(SRC_NOISE, _clampedLevel(_noiseMix));
+    _dormancyDirty = true;
 }
 
 void VoiceBlock::setOsc1SupersawDetune(float amount) {
@@ -331,29 +361,203 @@ void VoiceBlock::update() {
         _osc2.update();
     }
 
+    // Release finished: supersaw engines go back to the pool
+    if (!_isActive && !_isIdle && _ampEnvelope.isIdle()) {
+        _isIdle = true;
+        _osc1.voiceIdle();
+        _osc2.voiceIdle();
+    }
+
+    // Dormant-node elision: re-evaluated only after a relevant gain changed
+    if (_dormancyDirty) {
+        _dormancyDirty = false;
+        _applyDormancy();
+    }
+    _osc1.applyDormancy();
+    _osc2.applyDormancy();
+}
+
+uint8_t VoiceBlock::dormantNodes() const {
+    return _dormantNodes + _osc1.dormantNodes() + _osc2.dormantNodes();
+}
+
+uint16_t VoiceBlock::featureMask() const {
+    uint16_t f = 0;
+    if (_osc1Level != 0.0f)  f |= VOICE_FEAT_OSC1;
+    if (_osc2Level != 0.0f)  f |= VOICE_FEAT_OSC2;
+    if (_ring1Level != 0.0f || _ring2Level != 0.0f) f |= VOICE_FEAT_RING;
+    if (_subMix != 0.0f)     f |= VOICE_FEAT_SUB;
+    if (_noiseMix != 0.0f)   f |= VOICE_FEAT_NOISE;
+    if (_osc1.getFeedbackEnabled() || _osc2.getFeedbackEnabled()) f |= VOICE_FEAT_FEEDBACK;
+    if (_osc1.getWaveform() == WAVEFORM_SUPERSAW ||
+        _osc2.getWaveform() == WAVEFORM_SUPERSAW) f |= VOICE_FEAT_SUPERSAW;
+    return f | ((uint16_t)_filter.kernelFeatures() << 8);
+}
+
+void VoiceBlock::_applyDormancy() {
+    const bool ring1 = _ring1Level    != 0.0f;
+    const bool ring2 = _ring2Level    != 0.0f;
+    const bool noise = _noiseMix      != 0.0f;
+    const bool sub   = _subMix        != 0.0f;
+    const bool pEnv  = _pitchEnvDepth != 0.0f;
+
+    // Each oscillator is needed for its own mixer channel or for a ring mod
+    _osc1.setDormant(_osc1Level == 0.0f && !ring1 && !ring2);
+    _osc2.setDormant(_osc2Level == 0.0f && !ring1 && !ring2);
+
+    AudioLock::hold();
+    // Oscillator → ring cords (cables 2-5); a live osc must not queue into a parked ring
+    AudioDormancy::link(_patchCables[2], _linkRingCable[0], ring1);
+    AudioDormancy::link(_patchCables[3], _linkRingCable[1], ring1);
+    AudioDormancy::link(_patchCables[4], _linkRingCable[2], ring2);
+    AudioDormancy::link(_patchCables[5], _linkRingCable[3], ring2);
+
+    AudioDormancy::setActive(_ring1, ring1);
+    AudioDormancy::setActive(_ring2, ring2);
+    AudioDormancy::setActive(_noise, noise);
+    AudioDormancy::setActive(_subOsc.output(), sub);
+    AudioDormancy::setActive(_pitchEnvDc, pEnv);
+    AudioDormancy::setActive(_pitchEnvelope.output(), pEnv);
+    AudioLock::release();
+
+    _dormantNodes = (uint8_t)(!ring1 + !ring2 + !noise + !sub + 2 * !pEnv);
 }
 
 AudioStream& VoiceBlock::output() {
     return _ampEnvelope.output();
 }
 
-AudioMixer4& VoiceBlock::frequencyModMixerOsc1(){
+AudioMixer4Q15& VoiceBlock::frequencyModMixerOsc1(){
     return _osc1.frequencyModMixer();
 }
-AudioMixer4& VoiceBlock::shapeModMixerOsc1(){
+AudioMixer4Q15& VoiceBlock::shapeModMixerOsc1(){
     return _osc1.shapeModMixer();
 }
 
-AudioMixer4& VoiceBlock::frequencyModMixerOsc2(){
+AudioMixer4Q15& VoiceBlock::frequencyModMixerOsc2(){
     return _osc2.frequencyModMixer();
 }
-AudioMixer4& VoiceBlock::shapeModMixerOsc2(){
+AudioMixer4Q15& VoiceBlock::shapeModMixerOsc2(){
     return _osc2.shapeModMixer();
 }
-AudioMixer4& VoiceBlock::filterModMixer(){
+AudioMixer4Q15& VoiceBlock::filterModMixer(){
     return _filter.modMixer();
 }
 
+// ============================================================================
+// SHARED PATCH PARAMETERS
+// ============================================================================
+
+void VoiceBlock::attachParams(const VoiceParamBlock* block) {
+    _params.attach(block);
+}
+
+void VoiceBlock::syncParams() {
+    // SynthEngine syncs every voice on each publish; a voice that somehow
+    // missed one re-applies everything
+    const uint32_t groups = _params.take();
+    if (groups) _applyParams(_params.block()->live(), groups);
+}
+
+void VoiceBlock::_applyOscParams(OscillatorBlock& osc, const VoiceParam::Osc& o, uint32_t g) {
+    using namespace VoiceParam;
+    if (g & OSC1_WAVE) osc.setWaveformType(o.wave);
+    if (g & OSC1_PITCH) {
+        osc.setPitchOffset(o.pitchSemi);
+        osc.setDetune(o.detune);
+        osc.setFineTune(o.fineCents);
+    }
+    if (g & OSC1_SUPERSAW) {
+        osc.setSupersawDetune(o.ssDetune);
+        osc.setSupersawMix(o.ssMix);
+    }
+    if (g & OSC1_DC) {
+        osc.setFrequencyDcAmp(o.freqDc);
+        osc.setShapeDcAmp(o.shapeDc);
+    }
+    if (g & OSC1_FEEDBACK) {
+        osc.setFeedbackAmount(o.fbAmount);
+        osc.setFeedbackMix(o.fbMix);
+    }
+    if (g & OSC1_ARB) {
+        osc.setArbBank(o.arbBank);
+        osc.setArbTableIndex(o.arbIndex);
+    }
+}
+
+void VoiceBlock::_applyParams(const VoiceParams& p, uint32_t g) {
+    using namespace VoiceParam;
+
+    _applyOscParams(_osc1, p.osc[0], g & OSC1_GROUPS);
+    _applyOscParams(_osc2, p.osc[1], (g >> 1) & OSC1_GROUPS);
+
+    if (g & MIX) {
+        setOsc1Mix(p.osc[0].level);
+        setOsc2Mix(p.osc[1].level);
+        setRing1Mix(p.ring[0]);
+        setRing2Mix(p.ring[1]);
+        setSubMix(p.sub);
+        setNoiseMix(p.noise);
+    }
+
+    if (g & FILTER_CUTOFF)   setFilterCutoff(p.cutoffHz);
+    if (g & FILTER_RES)      setFilterResonance(p.resonance);
+    if (g & FILTER_ENV_AMT)  setFilterEnvAmount(p.envAmount);
+    if (g & FILTER_OCTAVES)  setFilterOctaveControl(p.octaves);
+    if (g & FILTER_KEYTRACK) setFilterKeyTrackAmount(p.keyTrack);
+    if (g & FILTER_MODE) {
+        // The mode setters log and may switch kernels: only what moved
+        if (p.multimode    != _multimode)         setMultimode(p.multimode);
+        if (p.twoPole      != _useTwoPole)        setTwoPole(p.twoPole);
+        if (p.xpander4Pole != _xpander4Pole)      setXpander4Pole(p.xpander4Pole);
+        if (p.xpanderMode  != _xpanderMode)       setXpanderMode(p.xpanderMode);
+        if (p.bpBlend2Pole != _bpBlend2Pole)      setBPBlend2Pole(p.bpBlend2Pole);
+        if (p.push2Pole    != _push2Pole)         setPush2Pole(p.push2Pole);
+        if (p.resModDepth  != _resonanceModDepth) setResonanceModDepth(p.resModDepth);
+    }
+
+    if (g & AMP_ENV)    _ampEnvelope.setADSR(p.ampEnv.attack, p.ampEnv.decay, p.ampEnv.sustain, p.ampEnv.release);
+    if (g & FILTER_ENV) _filterEnvelope.setADSR(p.filterEnv.attack, p.filterEnv.decay, p.filterEnv.sustain, p.filterEnv.release);
+    if (g & PITCH_ENV) {
+        _pitchEnvelope.setADSR(p.pitchEnv.attack, p.pitchEnv.decay, p.pitchEnv.sustain, p.pitchEnv.release);
+        if (p.pitchEnvDepth != _pitchEnvDepth) setPitchEnvDepth(p.pitchEnvDepth);
+    }
+
+    if (g & GLIDE) {
+        setGlideEnabled(p.glideEnabled);
+        setGlideTime(p.glideTimeMs);
+    }
+}
+
+// ============================================================================
+// PER-VOICE LFO MODULATION
+// ============================================================================
+
+void VoiceBlock::setLFOSource(uint8_t idx, const LFOBlock* lfo) {
+    if (idx > 1) return;
+    _lfoStage[idx].setSource(lfo ? &lfo->generator() : nullptr);
+}
+
+void VoiceBlock::setLFOGains(uint8_t idx, float pitchG, float filterG, float pwmG) {
+    if (idx > 1) return;
+    // LFO1 → freq/shape slot 1, filter slot 2; LFO2 → slot 2 / slot 3
+    _osc1.frequencyModMixer().gain(idx + 1, pitchG);
+    _osc2.frequencyModMixer().gain(idx + 1, pitchG);
+    _osc1.shapeModMixer().gain(idx + 1, pwmG);
+    _osc2.shapeModMixer().gain(idx + 1, pwmG);
+    _filter.modMixer().gain(idx + 2, filterG);
+}
+
+void VoiceBlock::setLFODelay(uint8_t idx, float ms) {
+    if (idx > 1) return;
+    _lfoStage[idx].setDelayMs(ms);
+}
+
+void VoiceBlock::setLFOKeySync(uint8_t idx, bool enabled) {
+    if (idx > 1) return;
+    _lfoStage[idx].setKeySync(enabled);
+}
+
 // ============================================================================
 // PITCH ENVELOPE
 // ============================================================================
@@ -368,6 +572,7 @@ void VoiceBlock::setPitchEnvDepth(float semitones) {
     if (semitones >  24.0f) semitones =  24.0f;
     if (semitones < -24.0f) semitones = -24.0f;
     _pitchEnvDepth = semitones;
+    _dormancyDirty = true;
 
     // Write depth into the DC source amplitude.
     //
@@ -444,8 +649,8 @@ float VoiceBlock::getFilterEnvRelease() const { return _filterEnvelope.getReleas
 // === Arbitrary waveform bank/index forwarding ===
 // These functions allow the SynthEngine to set the current AKWF bank and
 // table index for each oscillator.  When the oscillator waveform type is
-// WAVEFORM_ARBITRARY, the OscillatorBlock will call akwf_get() to fetch
-// the correct table from AKWF_All.h based on the bank and index.  See
+// WAVEFORM_ARBITRARY, the OscillatorBlock fetches the table (decoded from
+// the compressed banks in AKWF_All.h) via AKWFMip.  See
 // OscillatorBlock::setArbBank() and setArbTableIndex().
 
 void VoiceBlock::setOsc1ArbBank(ArbBank bank) {
@@ -1,5 +1,5 @@
 #include "synth_pinknoise.h"
-#include "effect_multiply.h"
+#include "AudioEffectMultiplyQ15.h"
 #pragma once
 
 #include <Audio.h>
@@ -9,17 +9,29 @@
 #include "FilterBlock.h"
 #include "AmpBlock.h"
 #include "LFOBlock.h"
+#include "AudioEffectVoiceLFO.h"
 #include "SubOscillatorBlock.h"
+#include "VoiceParams.h"
+
+// Voice feature mask (see featureMask()); filter kernel bits in the high byte
+#define VOICE_FEAT_OSC1      0x01
+#define VOICE_FEAT_OSC2      0x02
+#define VOICE_FEAT_RING      0x04
+#define VOICE_FEAT_SUB       0x08
+#define VOICE_FEAT_NOISE     0x10
+#define VOICE_FEAT_FEEDBACK  0x20
+#define VOICE_FEAT_SUPERSAW  0x40
 
 /**
  * @brief Complete voice with dual oscillators, filter, envelopes, and feedback
  * 
  * VoiceBlock combines:
- * - 2 oscillators (OSC1 with supersaw, OSC2 standard)
+ * - 2 oscillators (either can play supersaw, engines from SupersawPool)
  * - Sub oscillator
  * - Pink noise generator
  * - Ring modulators
- * - Resonant filter
+ * - Resonant filter (sources are mixed in float at its input; the voice
+ *   converts back to int16 once, at the filter output)
  * - Amp & filter envelopes
  * - Feedback oscillation support (NEW)
  */
@@ -34,6 +46,15 @@ public:
     void noteOff();
     void setAmplitude(float amp);
 
+    // =========================================================================
+    // SHARED PATCH PARAMETERS (see VoiceParams.h)
+    // SynthEngine writes patch parameters once into its VoiceParamBlock; each
+    // voice applies whatever groups the last publish changed.  The setters
+    // below stay as the per-voice apply path.
+    // =========================================================================
+    void attachParams(const VoiceParamBlock* block);
+    void syncParams();              // Apply the last publish (no-op if current)
+
     // =========================================================================
     // OSCILLATOR CONFIGURATION
     // =========================================================================
@@ -145,13 +166,18 @@ public:
     AudioSynthWaveformDc& pitchEnvDcRef();  // DC source — amplitude set by setPitchEnvDepth()
 
     // =========================================================================
-    // NEW: VELOCITY SENSITIVITY
-    // Three 0..1 scalars applied on noteOn.
-    //   0 = no velocity effect  |  1 = full velocity control
+    // NEW: PER-VOICE LFO MODULATION
+    // The two LFOBlocks stay single shared generators.  SynthEngine patches
+    // each one into lfoInput(idx), a per-voice AudioEffectVoiceLFO stage that
+    // applies this voice's delay ramp (from its own noteOn) and, with key
+    // sync, runs its own phase.  Mixer gains only hold the depths.
+    // idx: 0 = LFO1, 1 = LFO2.
     // =========================================================================
-    void setVelocityAmpSens(float s)    { _velAmpSens    = s; }
-    void setVelocityFilterSens(float s) { _velFilterSens = s; }
-    void setVelocityEnvSens(float s)    { _velEnvSens    = s; }
+    AudioStream& lfoInput(uint8_t idx) { return _lfoStage[idx & 1]; }
+    void setLFOSource(uint8_t idx, const LFOBlock* lfo);
+    void setLFOGains(uint8_t idx, float pitchG, float filterG, float pwmG);
+    void setLFODelay(uint8_t idx, float ms);
+    void setLFOKeySync(uint8_t idx, bool enabled);
 
     // =========================================================================
     // GETTERS (UI/STATE QUERY)
@@ -211,28 +237,40 @@ public:
     // AUDIO OUTPUTS & MODULATION MIXERS
     // =========================================================================
     AudioStream& output();
-    AudioMixer4& frequencyModMixerOsc1();
-    AudioMixer4& frequencyModMixerOsc2();
-    AudioMixer4& shapeModMixerOsc1();
-    AudioMixer4& shapeModMixerOsc2();
-    AudioMixer4& filterModMixer();
+    AudioMixer4Q15& frequencyModMixerOsc1();
+    AudioMixer4Q15& frequencyModMixerOsc2();
+    AudioMixer4Q15& shapeModMixerOsc1();
+    AudioMixer4Q15& shapeModMixerOsc2();
+    AudioMixer4Q15& filterModMixer();
 
     // --- Modulation
     void setModInputs(audio_block_t** modSources);
 
+    // Audio objects currently parked by dormant-node elision (diagnostics)
+    uint8_t dormantNodes() const;
+
+    // Features the current patch actually uses: VOICE_FEAT_* in the low
+    // byte, the filter's OBXA_FEAT_* kernel mask in the high byte.  The
+    // low byte decides what dormancy parks; the high byte which precompiled
+    // filter kernel runs.
+    uint16_t featureMask() const;
+    const char* filterKernelName() const { return _filter.kernelName(); }
+
+    // Peak per-block CPU of each main oscillator (wavetable cache reporting)
+    float osc1CpuMax() { return _osc1.mainOscCpuMax(); }
+    float osc2CpuMax() { return _osc2.mainOscCpuMax(); }
+
     // SynthEngine needs to access _pitchEnvPatch1/2 and pitchEnvOutput()
     // to wire the pitch envelope into the audio graph at construction time.
     friend class SynthEngine;
 
 private:
     // Audio components
-    OscillatorBlock _osc1{true};   // OSC1 has supersaw capability
-    OscillatorBlock _osc2{false};  // OSC2 no supersaw
-    AudioEffectMultiply _ring1, _ring2;
+    OscillatorBlock _osc1;
+    OscillatorBlock _osc2;
+    AudioEffectMultiplyQ15 _ring1, _ring2;
     SubOscillatorBlock _subOsc;
     AudioSynthNoisePink _noise;
-    AudioMixer4 _oscMixer;
-    AudioMixer4 _voiceMixer;
 
     FilterBlock _filter;
 
@@ -262,6 +300,7 @@ private:
     bool    _push2Pole    = false;
 
     bool _isActive = false;
+    bool _isIdle   = true;    // Release finished (oscillators told via voiceIdle())
 
     float _currentFreq = 0.0f;
     float _osc1PitchOffset = 0.0f;
@@ -276,7 +315,10 @@ private:
     float _on = 0.9f;
     float _clampedLevel(float level);
 
-    AudioConnection* _patchCables[16];  // +1 for pitch envelope DC source
+    AudioConnection* _patchCables[14];  // +1 for pitch envelope DC source
+
+    // Filter input-mixer sources (FilterBlock::inputPort / setInputGain)
+    enum : uint8_t { SRC_OSC1, SRC_OSC2, SRC_RING1, SRC_RING2, SRC_SUB, SRC_NOISE };
 
     // -----------------------------------------------------------------------
     // NEW: Pitch envelope
@@ -301,12 +343,34 @@ private:
     float _pitchEnvDepth = 0.0f;
 
     // -----------------------------------------------------------------------
-    // NEW: Velocity sensitivity scalars
+    // Shared patch parameters (velocity sensitivity is read from here at
+    // noteOn; everything else is applied into the blocks by syncParams())
     // -----------------------------------------------------------------------
-    float _velAmpSens    = 0.0f;
-    float _velFilterSens = 0.0f;
-    float _velEnvSens    = 0.0f;
+    VoiceParamCursor _params;
+
+    void _applyParams(const VoiceParams& p, uint32_t groups);
+    static void _applyOscParams(OscillatorBlock& osc, const VoiceParam::Osc& o, uint32_t groups);
 
     // Base filter env amount (before velocity scaling)
     float _baseFilterEnvAmount = 0.0f;
+
+    // -----------------------------------------------------------------------
+    // NEW: Per-voice LFO stages
+    // Shared LFO → _lfoStage[idx] → freq/shape mixers (slot idx+1) and the
+    // filter mod mixer (slot idx+2).  Gains are the full-depth values from
+    // SynthEngine::_applyLFOxGains(); delay and key sync live in the stage.
+    // -----------------------------------------------------------------------
+    AudioEffectVoiceLFO _lfoStage[2];
+    AudioConnection*    _lfoCables[2][5];
+
+    // -----------------------------------------------------------------------
+    // NEW: Dormant-node elision (see AudioDormancy.h)
+    // Mix/depth setters set _dormancyDirty; update() re-parks the ring mods,
+    // noise, sub, pitch envelope and idle oscillator paths.
+    // -----------------------------------------------------------------------
+    bool    _dormancyDirty    = true;
+    uint8_t _dormantNodes     = 0;
+    bool    _linkRingCable[4] = { true, true, true, true };   // _patchCables[2..5]
+
+    void _applyDormancy();
 };
\ No newline at end of file
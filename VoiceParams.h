@@ -0,0 +1,198 @@
+#pragma once
+#include <Arduino.h>
+#include "AKWF_All.h"   // ArbBank
+
+// ============================================================================
+// VoiceParams: patch parameters shared by every voice, held once
+// ----------------------------------------------------------------------------
+// SynthEngine owns one VoiceParamBlock.  Its setters write the staged copy
+// and mark the parameter's group; nothing touches the voices, so a CC costs
+// the same at any polyphony and a knob sweep arriving between two updates
+// collapses into one change.
+//
+// publish() (SynthEngine::update() and noteOn(), loop context) makes the
+// staged copy live.  Each voice then reads the live copy and applies only
+// the groups that changed to its own audio objects — once per group per
+// publish, however many writes went into it.
+//
+// Voices keep only what is genuinely theirs (note, velocity, envelope stage,
+// LFO fades); values used only at note-on (velocity sensitivity) are read
+// straight from the live copy.
+//
+// Getters read staged(): the value last set, whether published yet or not.
+// ============================================================================
+
+namespace VoiceParam {
+
+// Change groups — one bit per set of voice setters applied together
+enum Group : uint32_t {
+    OSC1_WAVE       = 1u << 0,
+    OSC2_WAVE       = 1u << 1,
+    OSC1_PITCH      = 1u << 2,    // Coarse, detune, fine
+    OSC2_PITCH      = 1u << 3,
+    OSC1_SUPERSAW   = 1u << 4,    // Detune, mix
+    OSC2_SUPERSAW   = 1u << 5,
+    OSC1_DC         = 1u << 6,    // Frequency / shape DC
+    OSC2_DC         = 1u << 7,
+    OSC1_FEEDBACK   = 1u << 8,    // Amount, mix
+    OSC2_FEEDBACK   = 1u << 9,
+    OSC1_ARB        = 1u << 10,   // Bank, index
+    OSC2_ARB        = 1u << 11,
+    MIX             = 1u << 12,   // Osc / ring / sub / noise levels
+    FILTER_CUTOFF   = 1u << 13,
+    FILTER_RES      = 1u << 14,
+    FILTER_ENV_AMT  = 1u << 15,
+    FILTER_OCTAVES  = 1u << 16,
+    FILTER_KEYTRACK = 1u << 17,   // Applied after FILTER_OCTAVES (depends on it)
+    FILTER_MODE     = 1u << 18,   // Multimode, pole/Xpander switches, res mod depth
+    AMP_ENV         = 1u << 19,
+    FILTER_ENV      = 1u << 20,
+    PITCH_ENV       = 1u << 21,   // ADSR and depth
+    GLIDE           = 1u << 22,
+    VELOCITY        = 1u << 23,   // Read at note-on, nothing to apply
+
+    ALL             = (1u << 24) - 1,
+};
+
+// Each OSC2 group is its OSC1 group shifted left by one
+static constexpr uint32_t OSC1_GROUPS =
+    OSC1_WAVE | OSC1_PITCH | OSC1_SUPERSAW | OSC1_DC | OSC1_FEEDBACK | OSC1_ARB;
+static_assert((OSC1_GROUPS << 1) ==
+    (OSC2_WAVE | OSC2_PITCH | OSC2_SUPERSAW | OSC2_DC | OSC2_FEEDBACK | OSC2_ARB),
+    "OSC2 groups must sit one bit above their OSC1 groups");
+
+struct Osc {
+    int      wave        = 0;
+    float    pitchSemi   = 0.0f;
+    float    detune      = 0.0f;
+    float    fineCents   = 0.0f;
+    float    level       = 1.0f;
+    float    ssDetune    = 0.0f;
+    float    ssMix       = 0.0f;
+    float    freqDc      = 0.0f;
+    float    shapeDc     = 0.0f;
+    float    fbAmount    = 0.0f;
+    float    fbMix       = 0.0f;
+    ArbBank  arbBank     = ArbBank::BwBlended;
+    uint16_t arbIndex    = 0;
+};
+
+struct Env {
+    float attack;
+    float decay;
+    float sustain;
+    float release;
+};
+
+} // namespace VoiceParam
+
+struct VoiceParams {
+    VoiceParam::Osc osc[2];          // [0] = OSC1, [1] = OSC2
+
+    float ring[2]  = {0.0f, 0.0f};
+    float sub      = 0.0f;
+    float noise    = 0.0f;
+
+    // Filter
+    float   cutoffHz     = 20000.0f;
+    float   resonance    = 0.0f;
+    float   envAmount    = 0.0f;
+    float   keyTrack     = 0.0f;
+    float   octaves      = 0.0f;
+    float   multimode    = 0.0f;
+    float   resModDepth  = 0.0f;
+    bool    twoPole      = false;
+    bool    xpander4Pole = false;
+    uint8_t xpanderMode  = 0;
+    bool    bpBlend2Pole = false;
+    bool    push2Pole    = false;
+
+    // Envelopes (EnvelopeBlock power-on values for amp / filter)
+    VoiceParam::Env ampEnv    = { 0.01f, 0.1f, 0.8f, 0.2f };
+    VoiceParam::Env filterEnv = { 0.01f, 0.1f, 0.8f, 0.2f };
+    VoiceParam::Env pitchEnv  = { 1.0f, 80.0f, 0.0f, 50.0f };
+    float pitchEnvDepth = 0.0f;      // Semitones, signed
+
+    // Velocity sensitivity (0..1)
+    float velAmpSens    = 0.0f;
+    float velFilterSens = 0.0f;
+    float velEnvSens    = 0.0f;
+
+    bool  glideEnabled = false;
+    float glideTimeMs  = 0.0f;
+};
+
+class VoiceParamBlock {
+public:
+    // Writer side: the staged copy, with the groups about to change marked
+    VoiceParams& edit(uint32_t groups) {
+        _stats.writes++;
+        if ((_pending & groups) == groups) _stats.coalesced++;
+        _pending |= groups;
+        return _buf[_live ^ 1];
+    }
+    const VoiceParams& staged() const { return _buf[_live ^ 1]; }
+    uint32_t pending() const          { return _pending; }
+
+    // Staged → live.  Returns the groups that changed (0: nothing to do).
+    // The new staged copy starts from the new live one.
+    uint32_t publish() {
+        if (!_pending) return 0;
+        _live ^= 1;
+        _buf[_live ^ 1] = _buf[_live];
+        _changed = _pending;
+        _pending = 0;
+        _serial++;
+        _stats.publishes++;
+        _stats.groups += (uint32_t)__builtin_popcount(_changed);
+        return _changed;
+    }
+
+    // Reader side (voices)
+    const VoiceParams& live() const { return _buf[_live]; }
+    uint32_t changed() const        { return _changed; }   // Groups in the last publish
+    uint32_t serial() const         { return _serial; }    // Publish count
+
+    // Since boot; syncCycles is CPU time the voices spent applying
+    struct Stats {
+        uint32_t writes      = 0;
+        uint32_t coalesced   = 0;   // Writes into a group already pending
+        uint32_t publishes   = 0;
+        uint32_t groups      = 0;   // Groups published (each applied once per voice)
+        uint32_t syncCycles  = 0;
+    };
+    const Stats& stats() const        { return _stats; }
+    void noteSyncCycles(uint32_t c)   { _stats.syncCycles += c; }
+
+private:
+    VoiceParams _buf[2];
+    uint8_t     _live    = 0;
+    uint32_t    _pending = 0;
+    uint32_t    _changed = 0;
+    uint32_t    _serial  = 0;
+    Stats       _stats;
+};
+
+// Voice side: the last publish a voice applied
+class VoiceParamCursor {
+public:
+    void attach(const VoiceParamBlock* block) {
+        _block  = block;
+        _serial = block ? block->serial() : 0;
+    }
+    const VoiceParamBlock* block() const { return _block; }
+
+    // Groups to apply to catch up: the last publish's, or ALL when more
+    // than one went by (rather than guess what changed); 0 when current
+    uint32_t take() {
+        if (!_block || _block->serial() == _serial) return 0;
+        const uint32_t groups = (_block->serial() - _serial == 1) ? _block->changed()
+                                                                 : VoiceParam::ALL;
+        _serial = _block->serial();
+        return groups;
+    }
+
+private:
+    const VoiceParamBlock* _block  = nullptr;
+    uint32_t               _serial = 0;
+};
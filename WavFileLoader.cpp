@@ -0,0 +1,389 @@
+#include "WavFileLoader.h"
+#include "DebugTrace.h"
+#include <strings.h>
+#if !defined(__IMXRT1062__)
+  #include <dirent.h>
+  #include <sys/stat.h>
+#endif
+
+namespace {
+
+inline uint16_t rd16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+inline uint32_t rd32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+bool isWavName(const char* name) {
+    const size_t n = strlen(name);
+    // Skip hidden files (macOS leaves "._x.wav" resource forks on SD cards)
+    return name[0] != '.' && n > 4 && strcasecmp(name + n - 4, ".wav") == 0;
+}
+
+// false if the result would not fit
+bool joinPath(char* out, const char* dir, const char* name) {
+    const size_t d = strlen(dir);
+    const char*  sep = (d > 0 && dir[d - 1] == '/') ? "" : "/";
+    return snprintf(out, WAV_PATH_MAX, "%s%s%s", dir, sep, name) < WAV_PATH_MAX;
+}
+
+} // namespace
+
+// ============================================================================
+// STORAGE BACKEND
+// ============================================================================
+
+#if defined(__IMXRT1062__)
+
+bool WaveFS::openDir(const char* path) {
+    closeDir();
+    _dir = SD.open(path);
+    if (_dir && _dir.isDirectory()) return true;
+    closeDir();
+    return false;
+}
+
+bool WaveFS::nextEntry(char* name, size_t cap, bool& isDir) {
+    File f = _dir.openNextFile();
+    if (!f) return false;
+    strncpy(name, f.name(), cap - 1);
+    name[cap - 1] = '\0';
+    isDir = f.isDirectory();
+    f.close();
+    return true;
+}
+
+void WaveFS::closeDir() { if (_dir) _dir.close(); }
+
+bool WaveFS::openFile(const char* path) {
+    closeFile();
+    _file = SD.open(path, FILE_READ);
+    return (bool)_file;
+}
+
+int32_t WaveFS::read(uint8_t* buf, uint32_t n) { return _file.read(buf, n); }
+bool    WaveFS::skip(uint32_t n)               { return _file.seek(_file.position() + n); }
+void    WaveFS::closeFile()                    { if (_file) _file.close(); }
+
+#else
+
+bool WaveFS::openDir(const char* path) {
+    closeDir();
+    _dir = opendir(path);
+    strncpy(_dirPath, path, WAV_PATH_MAX - 1);
+    return _dir != nullptr;
+}
+
+bool WaveFS::nextEntry(char* name, size_t cap, bool& isDir) {
+    if (!_dir) return false;
+    for (;;) {
+        const dirent* e = readdir((DIR*)_dir);
+        if (!e) return false;
+        if (!strcmp(e->d_name, ".") || !strcmp(e->d_name, "..")) continue;
+        strncpy(name, e->d_name, cap - 1);
+        name[cap - 1] = '\0';
+        isDir = (e->d_type == DT_DIR);
+        if (e->d_type == DT_UNKNOWN) {
+            char p[WAV_PATH_MAX];
+            struct stat st;
+            isDir = joinPath(p, _dirPath, e->d_name) && stat(p, &st) == 0 && S_ISDIR(st.st_mode);
+        }
+        return true;
+    }
+}
+
+void WaveFS::closeDir() {
+    if (_dir) closedir((DIR*)_dir);
+    _dir = nullptr;
+}
+
+bool WaveFS::openFile(const char* path) {
+    closeFile();
+    _file = fopen(path, "rb");
+    return _file != nullptr;
+}
+
+int32_t WaveFS::read(uint8_t* buf, uint32_t n) { return _file ? (int32_t)fread(buf, 1, n, _file) : -1; }
+bool    WaveFS::skip(uint32_t n)               { return _file && fseek(_file, (long)n, SEEK_CUR) == 0; }
+
+void WaveFS::closeFile() {
+    if (_file) fclose(_file);
+    _file = nullptr;
+}
+
+#endif
+
+// ============================================================================
+// LOADER
+// ============================================================================
+
+bool WavFileLoader::begin(const char* root) {
+    if (busy()) return false;
+
+    strncpy(_root, root, WAV_PATH_MAX - 1);
+    _root[WAV_PATH_MAX - 1] = '\0';
+    if (!_fs.openDir(_root)) {
+        JT_LOGF("[WAVLOAD] %s: no such folder\n", _root);
+        return false;
+    }
+
+    if (!_src) _src = (float*)malloc(WAV_MAX_FRAMES * sizeof(float));
+    if (!_out) _out = (float*)malloc(WAVE_TABLE_LEN * sizeof(float));
+    if (!_src || !_out) {
+        JT_LOGF("[WAVLOAD] out of memory\n");
+        _fs.closeDir();
+        _finish();
+        return false;
+    }
+
+    _stats      = Stats();
+    _dirCount   = 0;
+    _rootHasWav = false;
+    _state      = State::ScanRoot;
+    JT_LOGF("[WAVLOAD] scanning %s\n", _root);
+    return true;
+}
+
+void WavFileLoader::poll() {
+    if (_state == State::Idle) return;
+    const uint32_t t0 = micros();
+    _step();
+    const uint32_t dt = micros() - t0;
+    _stats.busyUs += dt;
+    if (dt > _stats.maxPollUs) _stats.maxPollUs = dt;
+}
+
+void WavFileLoader::_finish() {
+    free(_src); _src = nullptr;
+    free(_out); _out = nullptr;
+    if (_state != State::Idle) {
+        JT_LOGF("[WAVLOAD] done: %u banks, %u tables, %u skipped, %lu KB read, %lu ms busy, longest poll %lu us\n",
+                _stats.banks, _stats.tables, _stats.rejected,
+                (unsigned long)(_stats.bytesRead >> 10), (unsigned long)(_stats.busyUs / 1000),
+                (unsigned long)_stats.maxPollUs);
+    }
+    _state = State::Idle;
+}
+
+void WavFileLoader::_openBank(const char* dir) {
+    if (dir) {
+        if (!joinPath(_bankPath, _root, dir)) return;
+        strncpy(_bankName, dir, WAVE_BANK_NAME - 1);
+    } else {
+        strncpy(_bankPath, _root, WAV_PATH_MAX - 1);
+        const char* base = strrchr(_root, '/');
+        base = base ? base + 1 : _root;
+        strncpy(_bankName, *base ? base : "SD", WAVE_BANK_NAME - 1);
+    }
+    _bankName[WAVE_BANK_NAME - 1] = '\0';
+
+    if (!_fs.openDir(_bankPath)) return;
+    _bank       = -1;
+    _bankTables = 0;
+    _state      = State::ScanBank;
+}
+
+void WavFileLoader::_rejectFile(const char* why) {
+    JT_LOGF("[WAVLOAD] skip %s: %s\n", _file, why);
+    _fs.closeFile();
+    _stats.rejected++;
+    _state = State::ScanBank;
+}
+
+bool WavFileLoader::_readExact(uint32_t n) {
+    const int32_t got = _fs.read(_io, n);
+    if (got > 0) _stats.bytesRead += (uint32_t)got;
+    return got == (int32_t)n;
+}
+
+float WavFileLoader::_sampleAt(const uint8_t* p) const {
+    if (_fmtTag == 3) {
+        float f;
+        memcpy(&f, p, sizeof(f));
+        return f;
+    }
+    switch (_bits) {
+        case 8:  return ((int16_t)p[0] - 128) * (1.0f / 128.0f);
+        case 16: return (int16_t)rd16(p) * (1.0f / 32768.0f);
+        case 24: return (int32_t)(((uint32_t)p[0] << 8) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 24))
+                        * (1.0f / 2147483648.0f);
+        default: return (int32_t)rd32(p) * (1.0f / 2147483648.0f);
+    }
+}
+
+void WavFileLoader::_step() {
+    char name[WAV_PATH_MAX];
+    bool isDir = false;
+
+    switch (_state) {
+    case State::Idle:
+        break;
+
+    // ---- Directory walk: one entry per poll ----
+    case State::ScanRoot:
+        if (!_fs.nextEntry(name, sizeof(name), isDir)) {
+            _fs.closeDir();
+            _dirCursor = _rootHasWav ? -1 : 0;
+            _state     = State::NextBank;
+        } else if (isDir) {
+            if (name[0] != '.' && _dirCount < WAVE_USER_BANKS) {
+                strncpy(_dirs[_dirCount], name, WAVE_BANK_NAME - 1);
+                _dirs[_dirCount][WAVE_BANK_NAME - 1] = '\0';
+                _dirCount++;
+            }
+        } else if (isWavName(name)) {
+            _rootHasWav = true;
+        }
+        break;
+
+    case State::NextBank:
+        if (_dirCursor >= (int8_t)_dirCount) {
+            _finish();
+            break;
+        }
+        _openBank(_dirCursor < 0 ? nullptr : _dirs[_dirCursor]);
+        _dirCursor++;
+        break;
+
+    case State::ScanBank:
+        if (!_fs.nextEntry(name, sizeof(name), isDir)) {
+            _fs.closeDir();
+            if (_bankTables) {
+                JT_LOGF("[WAVLOAD] bank '%s': %u tables\n", _bankName, _bankTables);
+            }
+            _state = State::NextBank;
+            break;
+        }
+        if (isDir || !isWavName(name)) break;
+        if (!joinPath(_file, _bankPath, name)) {
+            JT_LOGF("[WAVLOAD] skip %s: path too long\n", name);
+            _stats.rejected++;
+            break;
+        }
+        if (!_fs.openFile(_file)) {
+            _rejectFile("cannot open");
+            break;
+        }
+        _fmtSeen = false;
+        _state   = State::RiffHeader;
+        break;
+
+    // ---- RIFF parsing ----
+    case State::RiffHeader:
+        if (!_readExact(12) || memcmp(_io, "RIFF", 4) != 0 || memcmp(_io + 8, "WAVE", 4) != 0) {
+            _rejectFile("not a RIFF/WAVE file");
+            break;
+        }
+        _state = State::ChunkHeader;
+        break;
+
+    case State::ChunkHeader: {
+        if (!_readExact(8)) {
+            _rejectFile("no data chunk");
+            break;
+        }
+        const uint32_t size = rd32(_io + 4);
+        if (memcmp(_io, "fmt ", 4) == 0) {
+            _chunkLeft = size + (size & 1);
+            _state     = State::ReadFmt;
+        } else if (memcmp(_io, "data", 4) == 0) {
+            if (!_fmtSeen) {
+                _rejectFile("data before fmt");
+                break;
+            }
+            _framesTotal = size / _blockAlign;
+            if (_framesTotal < 8 || _framesTotal > WAV_MAX_FRAMES) {
+                _rejectFile("cycle length out of range");
+                break;
+            }
+            _chunkLeft = _framesTotal * _blockAlign;
+            _frames    = 0;
+            _state     = State::ReadData;
+        } else {
+            _chunkLeft = size + (size & 1);   // Chunks are word aligned
+            _state     = State::SkipChunk;
+        }
+    } break;
+
+    case State::ReadFmt: {
+        const uint32_t n = (_chunkLeft < 40) ? _chunkLeft : 40;
+        if (n < 16 || !_readExact(n)) {
+            _rejectFile("bad fmt chunk");
+            break;
+        }
+        _chunkLeft -= n;
+        _fmtTag     = rd16(_io);
+        _channels   = rd16(_io + 2);
+        _blockAlign = rd16(_io + 12);
+        _bits       = rd16(_io + 14);
+        if (_fmtTag == 0xFFFE && n >= 26) _fmtTag = rd16(_io + 24);   // EXTENSIBLE: sub-format
+
+        const bool pcm   = (_fmtTag == 1) && (_bits == 8 || _bits == 16 || _bits == 24 || _bits == 32);
+        const bool fl32  = (_fmtTag == 3) && (_bits == 32);
+        if (!(pcm || fl32) || _channels == 0 || _blockAlign != _channels * (_bits / 8)
+            || _blockAlign > WAV_CHUNK_BYTES) {
+            _rejectFile("unsupported sample format");
+            break;
+        }
+        _fmtSeen = true;
+        _state   = _chunkLeft ? State::SkipChunk : State::ChunkHeader;
+    } break;
+
+    case State::SkipChunk:
+        if (!_fs.skip(_chunkLeft)) {
+            _rejectFile("truncated");
+            break;
+        }
+        _chunkLeft = 0;
+        _state     = State::ChunkHeader;
+        break;
+
+    // ---- Sample data: one chunk per poll ----
+    case State::ReadData: {
+        const uint32_t whole = (WAV_CHUNK_BYTES / _blockAlign) * _blockAlign;
+        const uint32_t n     = (_chunkLeft < whole) ? _chunkLeft : whole;
+        if (!_readExact(n)) {
+            _rejectFile("truncated");
+            break;
+        }
+        for (const uint8_t* p = _io; p < _io + n; p += _blockAlign) {
+            _src[_frames++] = _sampleAt(p);   // First channel
+        }
+        _chunkLeft -= n;
+        if (_chunkLeft == 0) {
+            _fs.closeFile();
+            _outPos = 0;
+            _state  = State::Resample;
+        }
+    } break;
+
+    // ---- Resample to WAVE_TABLE_LEN, a slice per poll ----
+    case State::Resample: {
+        const uint16_t end = (_outPos + WAV_SLICE_SAMPLES < WAVE_TABLE_LEN)
+                           ? _outPos + WAV_SLICE_SAMPLES : WAVE_TABLE_LEN;
+        WaveTablePool::resampleCycle(_src, _framesTotal, _out, _outPos, end);
+        _outPos = end;
+        if (_outPos >= WAVE_TABLE_LEN) _state = State::Commit;
+    } break;
+
+    // ---- DC removal, normalise, store ----
+    case State::Commit: {
+        int16_t table[WAVE_TABLE_LEN];
+        if (!WaveTablePool::normaliseCycle(_out, table)) {
+            _rejectFile("silent");
+            break;
+        }
+
+        if (_bank < 0) {
+            _bank = WaveTablePool::createBank(_bankName);
+            if (_bank >= 0) _stats.banks++;
+        }
+        if (_bank < 0 || WaveTablePool::addTable((uint8_t)_bank, table) < 0) {
+            _rejectFile("wavetable pool full");
+            break;
+        }
+        _bankTables++;
+        _stats.tables++;
+        _state = State::ScanBank;
+    } break;
+    }
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include <Arduino.h>
+#include "WaveTablePool.h"
+#if defined(__IMXRT1062__)
+  #include <SD.h>
+#else
+  #include <stdio.h>
+#endif
+
+// ============================================================================
+// WavFileLoader: single-cycle WAV files from SD into WaveTablePool banks
+// ----------------------------------------------------------------------------
+// Layout: each sub-folder of the root is one bank named after the folder,
+// holding *.wav single cycles (AKWF, single frames from other synths; any
+// length up to WAV_MAX_FRAMES).  WAVs in the root itself form one more bank.
+//
+// Work is sliced so loop() (MIDI, UI) never waits on it: each poll() does one
+// directory step, one read of at most WAV_CHUNK_BYTES, or WAV_SLICE_SAMPLES
+// of resampling.  Cycles are resampled to WAVE_TABLE_LEN (box-averaged when
+// shortening, linear when stretching), DC-removed and peak-normalised.
+//
+// Formats: PCM 8/16/24/32-bit, IEEE float 32, WAVE_FORMAT_EXTENSIBLE; any
+// channel count (first channel used).
+//
+// Storage is the Teensy SD library on target and POSIX stdio/dirent on a
+// host, so the same loader runs in host tests and benchmarks.
+// ============================================================================
+
+#define WAV_CHUNK_BYTES    512    // One SD sector per read
+#define WAV_SLICE_SAMPLES  150    // Output samples resampled per poll()
+#define WAV_MAX_FRAMES     4096   // Longest accepted cycle
+#define WAV_PATH_MAX       96
+
+// Directory and file access used by the loader
+class WaveFS {
+public:
+    bool    openDir(const char* path);
+    bool    nextEntry(char* name, size_t cap, bool& isDir);   // false at the end
+    void    closeDir();
+
+    bool    openFile(const char* path);
+    int32_t read(uint8_t* buf, uint32_t n);                  // Bytes read, < 0 on error
+    bool    skip(uint32_t n);
+    void    closeFile();
+
+private:
+#if defined(__IMXRT1062__)
+    File _dir;
+    File _file;
+#else
+    void* _dir  = nullptr;                  // DIR*
+    FILE* _file = nullptr;
+    char  _dirPath[WAV_PATH_MAX] = {0};     // For stat() when d_type is unknown
+#endif
+};
+
+class WavFileLoader {
+public:
+    struct Stats {
+        uint16_t banks     = 0;
+        uint16_t tables    = 0;
+        uint16_t rejected  = 0;   // Unsupported, too long, silent or pool full
+        uint32_t bytesRead = 0;
+        uint32_t busyUs    = 0;   // Total time spent inside poll()
+        uint32_t maxPollUs = 0;   // Longest single poll()
+    };
+
+    // Start loading from 'root' (e.g. "/WAVES"); false if it cannot be opened
+    bool begin(const char* root);
+
+    // One bounded slice of work; call every loop() iteration
+    void poll();
+
+    bool         busy()  const { return _state != State::Idle; }
+    const Stats& stats() const { return _stats; }
+
+private:
+    enum class State : uint8_t {
+        Idle, ScanRoot, NextBank, ScanBank,
+        RiffHeader, ChunkHeader, ReadFmt, SkipChunk, ReadData,
+        Resample, Commit
+    };
+
+    void _step();
+    void _finish();
+    void _openBank(const char* dir);    // nullptr: the root itself
+    void _rejectFile(const char* why);
+    bool _readExact(uint32_t n);        // Fill _io[0..n) from the open file
+    float _sampleAt(const uint8_t* p) const;
+
+    WaveFS _fs;
+    State  _state = State::Idle;
+    Stats  _stats;
+
+    char    _root[WAV_PATH_MAX]     = {0};
+    char    _bankPath[WAV_PATH_MAX] = {0};
+    char    _bankName[WAVE_BANK_NAME] = {0};
+    char    _file[WAV_PATH_MAX]     = {0};
+    char    _dirs[WAVE_USER_BANKS][WAVE_BANK_NAME];
+    uint8_t _dirCount   = 0;
+    int8_t  _dirCursor  = -1;           // -1: root bank (if it holds WAVs)
+    bool    _rootHasWav = false;
+    int8_t  _bank       = -1;           // WaveTablePool bank, created on first table
+    uint16_t _bankTables = 0;
+
+    // Current file
+    uint8_t  _io[WAV_CHUNK_BYTES];
+    uint32_t _chunkLeft  = 0;
+    bool     _fmtSeen    = false;
+    uint16_t _fmtTag     = 0;           // 1 = PCM, 3 = float
+    uint16_t _channels   = 0;
+    uint16_t _bits       = 0;
+    uint16_t _blockAlign = 0;
+    uint32_t _frames     = 0;           // Decoded so far
+    uint32_t _framesTotal = 0;
+    uint16_t _outPos     = 0;
+
+    float*   _src = nullptr;            // WAV_MAX_FRAMES, first channel
+    float*   _out = nullptr;            // WAVE_TABLE_LEN
+};
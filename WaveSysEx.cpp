@@ -0,0 +1,173 @@
+#include "WaveSysEx.h"
+#include "AKWFMip.h"
+
+namespace {
+
+constexpr uint8_t kHeader[4] = { 0xF0, WAVE_SYSEX_ID0, WAVE_SYSEX_ID1, WAVE_SYSEX_ID2 };
+
+// Fixed payload bytes ahead of the sample triplets / checksum
+inline uint8_t fieldsFor(uint8_t cmd) {
+    switch (cmd) {
+        case WaveSysEx::BEGIN: return 3;
+        case WaveSysEx::DATA:  return 2;
+        default:               return 0;
+    }
+}
+
+} // namespace
+
+void WaveSysEx::feed(const uint8_t* data, uint16_t len, bool /*last*/) {
+    // F0/F7 delimit messages; 'last' only says whether more pieces follow
+    for (uint16_t i = 0; i < len; ++i) _byte(data[i]);
+}
+
+void WaveSysEx::_byte(uint8_t b) {
+    if (b == 0xF0) {
+        _state    = State::Header;
+        _hdr      = 1;
+        _sum      = 0;
+        _fieldLen = 0;
+        _triLen   = 0;
+        _error    = OK;
+        return;
+    }
+    if (b == 0xF7) {
+        if (_state == State::Payload) _endOfMessage();
+        _state = State::Idle;
+        return;
+    }
+    if (b & 0x80) {                     // Any other status byte ends ours
+        _state = State::Ignore;
+        return;
+    }
+
+    switch (_state) {
+    case State::Header:
+        if (b != kHeader[_hdr]) {
+            _state = State::Ignore;     // Someone else's SysEx
+        } else if (++_hdr == sizeof(kHeader)) {
+            _state = State::Command;
+            _stats.bytes += sizeof(kHeader);
+        }
+        break;
+
+    case State::Command:
+        _stats.bytes++;
+        _cmd   = b;
+        _sum   = b;
+        _state = State::Payload;
+        if (_cmd == DATA) _chunkPos = _received;
+        if (_cmd != BEGIN && _cmd != DATA && _cmd != END) _error = BAD_MESSAGE;
+        break;
+
+    case State::Payload:
+        _stats.bytes++;
+        _sum = (_sum + b) & 0x7F;
+
+        if (_fieldLen < fieldsFor(_cmd)) {
+            _field[_fieldLen++] = b;
+            if (_cmd == DATA && _fieldLen == 2 && _error == OK) {
+                if (!_active)                                     _error = NO_UPLOAD;
+                else if ((uint16_t)(_field[0] | (_field[1] << 7)) != _nextSeq) _error = BAD_SEQUENCE;
+            }
+            break;
+        }
+
+        // Sample triplets; the checksum is left over as a lone byte at F7
+        _tri[_triLen++] = b;
+        if (_triLen == 3) {
+            _triLen = 0;
+            if (_cmd != DATA) {
+                _error = BAD_MESSAGE;
+            } else if (_error == OK) {
+                if (_chunkPos >= _frames) {
+                    _error = BAD_LENGTH;
+                } else {
+                    const uint16_t u = (uint16_t)(((_tri[0] & 0x03) << 14) | (_tri[1] << 7) | _tri[2]);
+                    _staging[_chunkPos++] = (int16_t)u * (1.0f / 32768.0f);
+                }
+            }
+        }
+        break;
+
+    case State::Idle:
+    case State::Ignore:
+        break;
+    }
+}
+
+void WaveSysEx::_endOfMessage() {
+    const uint16_t seq = (_cmd == DATA) ? (uint16_t)(_field[0] | (_field[1] << 7)) : 0;
+    uint8_t status = _error;
+
+    if (status == OK && (_triLen != 1 || _fieldLen != fieldsFor(_cmd))) status = BAD_MESSAGE;
+    if (status == OK && _sum != 0) status = BAD_CHECKSUM;
+
+    if (status == OK) {
+        switch (_cmd) {
+        case BEGIN: {
+            const uint32_t frames = (uint32_t)_field[1] | ((uint32_t)_field[2] << 7);
+            if (frames < 8 || frames > WAV_MAX_FRAMES || _field[0] >= WAVE_USER_TABLES) {
+                status = BAD_LENGTH;
+                break;
+            }
+            if (!_staging) {
+                _staging = (float*)malloc(WAV_MAX_FRAMES * sizeof(float));
+                if (_staging) _stats.allocations++;
+            }
+            if (!_staging) {
+                status = NO_MEMORY;
+                break;
+            }
+            _active   = true;
+            _slot     = _field[0];
+            _frames   = frames;
+            _received = 0;
+            _nextSeq  = 0;
+        } break;
+
+        case DATA:
+            // Samples already sit in staging; accepting the chunk just
+            // moves the committed position past them
+            _received = _chunkPos;
+            _nextSeq++;
+            _stats.chunks++;
+            break;
+
+        case END:
+            if (!_active)                  status = NO_UPLOAD;
+            else if (_received != _frames) status = BAD_LENGTH;
+            else                           status = _commit();
+            _active = false;
+            break;
+        }
+    }
+
+    if (status != OK) _stats.naks++;
+    _reply(_cmd, seq, status);
+}
+
+uint8_t WaveSysEx::_commit() {
+    float   conformed[WAVE_TABLE_LEN];
+    int16_t table[WAVE_TABLE_LEN];
+    WaveTablePool::resampleCycle(_staging, _frames, conformed, 0, WAVE_TABLE_LEN);
+    if (!WaveTablePool::normaliseCycle(conformed, table)) return SILENT;
+
+    if (_bank < 0) _bank = WaveTablePool::createBank("SysEx");
+    if (_bank < 0 || !WaveTablePool::setTable((uint8_t)_bank, _slot, table)) return NO_MEMORY;
+
+    const ArbBank bank = (ArbBank)(AKWF_BANK_COUNT + _bank);
+    AKWFMip::invalidate(bank, _slot);
+    _stats.tables++;
+    if (_stored) _stored(bank, _slot);
+    return OK;
+}
+
+void WaveSysEx::_reply(uint8_t cmd, uint16_t seq, uint8_t status) {
+    if (!_send) return;
+    const uint8_t msg[] = {
+        0xF0, WAVE_SYSEX_ID0, WAVE_SYSEX_ID1, WAVE_SYSEX_ID2, ACK,
+        (uint8_t)(cmd & 0x7F), (uint8_t)(seq & 0x7F), (uint8_t)((seq >> 7) & 0x7F), status, 0xF7
+    };
+    _send(msg, sizeof(msg));
+}
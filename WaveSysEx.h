@@ -0,0 +1,101 @@
+#pragma once
+#include <Arduino.h>
+#include "WaveTablePool.h"
+#include "WavFileLoader.h"   // WAV_MAX_FRAMES
+
+// ============================================================================
+// WaveSysEx: single-cycle wavetable upload over SysEx
+// ----------------------------------------------------------------------------
+// Every message: F0 7D 4A 54 <cmd> <payload> <chk> F7
+//   7D = non-commercial ID, 4A 54 = "JT".  <chk> makes the 7-bit sum of
+//   <cmd>, <payload> and <chk> zero.
+//
+//   01 BEGIN  slot, frames lo7, frames hi7        start an upload (8..4096 frames)
+//   02 DATA   seq lo7, seq hi7, n × (b15-14, b13-7, b6-0)
+//                                                 n int16 samples, seq from 0
+//   03 END                                        conform and store the slot
+//
+// Every command is answered with
+//   F0 7D 4A 54 7F <cmd> <seq lo7> <seq hi7> <status> F7
+// A DATA chunk with a bad checksum or out-of-order seq is NAKed and can be
+// resent with the same seq; nothing of it is kept.
+//
+// Bytes are decoded as they arrive (usbMIDI's chunked SysEx handler hands
+// over partial messages), straight into one staging buffer that is
+// allocated on the first upload and reused.  The slots form one user bank,
+// "SysEx", created on the first upload.  All work runs in loop() inside the
+// MIDI read, bounded by the bytes received, so notes are never queued
+// behind an upload.
+// ============================================================================
+
+#define WAVE_SYSEX_ID0  0x7D
+#define WAVE_SYSEX_ID1  0x4A
+#define WAVE_SYSEX_ID2  0x54
+
+class WaveSysEx {
+public:
+    enum Cmd : uint8_t { BEGIN = 0x01, DATA = 0x02, END = 0x03, ACK = 0x7F };
+
+    enum Status : uint8_t {
+        OK           = 0,
+        BAD_CHECKSUM = 1,
+        BAD_SEQUENCE = 2,
+        NO_UPLOAD    = 3,   // DATA / END without BEGIN
+        BAD_LENGTH   = 4,   // Frame count out of range, or END before all frames
+        NO_MEMORY    = 5,   // Staging buffer, bank or slot allocation failed
+        BAD_MESSAGE  = 6,   // Unknown command or malformed payload
+        SILENT       = 7
+    };
+
+    typedef void (*SendFn)(const uint8_t* msg, uint16_t len);
+    typedef void (*StoredFn)(ArbBank bank, uint16_t slot);
+
+    struct Stats {
+        uint32_t bytes       = 0;   // SysEx bytes consumed (ours only)
+        uint32_t chunks      = 0;   // DATA chunks accepted
+        uint32_t naks        = 0;
+        uint16_t tables      = 0;   // Slots stored
+        uint8_t  allocations = 0;   // Staging buffer allocations (1 after the first upload)
+    };
+
+    // 'send' transmits replies; 'stored' runs after a slot is (re)written
+    void begin(SendFn send, StoredFn stored) { _send = send; _stored = stored; }
+
+    // Feed SysEx bytes; matches usbMIDI's chunked handler signature
+    void feed(const uint8_t* data, uint16_t len, bool last);
+
+    const Stats& stats() const { return _stats; }
+
+private:
+    enum class State : uint8_t { Idle, Header, Command, Payload, Ignore };
+
+    void _byte(uint8_t b);
+    void _endOfMessage();
+    void _reply(uint8_t cmd, uint16_t seq, uint8_t status);
+    uint8_t _commit();
+
+    SendFn   _send   = nullptr;
+    StoredFn _stored = nullptr;
+    Stats    _stats;
+
+    // Message parse
+    State    _state    = State::Idle;
+    uint8_t  _hdr      = 0;     // Header bytes matched
+    uint8_t  _cmd      = 0;
+    uint8_t  _sum      = 0;     // 7-bit running sum from <cmd>
+    uint8_t  _field[3] = {0};
+    uint8_t  _fieldLen = 0;
+    uint8_t  _tri[3]   = {0};   // Sample triplet in progress
+    uint8_t  _triLen   = 0;
+    uint8_t  _error    = OK;    // First problem seen in this message
+    uint32_t _chunkPos = 0;     // Next staging frame for this DATA chunk
+
+    // Upload session
+    bool     _active   = false;
+    uint8_t  _slot     = 0;
+    uint32_t _frames   = 0;     // Announced by BEGIN
+    uint32_t _received = 0;     // Frames in accepted chunks
+    uint16_t _nextSeq  = 0;
+    int8_t   _bank     = -1;    // WaveTablePool bank of the slots
+    float*   _staging  = nullptr;   // WAV_MAX_FRAMES, kept between uploads
+};
@@ -0,0 +1,120 @@
+#include "WaveTablePool.h"
+
+namespace {
+
+struct UserBank {
+    char     name[WAVE_BANK_NAME] = {0};
+    uint16_t count                = 0;
+    int16_t* tables[WAVE_USER_TABLES] = {nullptr};
+};
+
+UserBank s_banks[WAVE_USER_BANKS];
+uint8_t  s_bankCount = 0;
+
+// PSRAM first (Teensy 4.1 with chips fitted), then regular RAM
+int16_t* allocTable() {
+    const size_t bytes = WAVE_TABLE_LEN * sizeof(int16_t);
+#if defined(__IMXRT1062__)
+    int16_t* t = (int16_t*)extmem_malloc(bytes);
+    if (t) return t;
+#endif
+    return (int16_t*)malloc(bytes);
+}
+
+} // namespace
+
+namespace WaveTablePool {
+
+int8_t createBank(const char* name) {
+    if (s_bankCount >= WAVE_USER_BANKS) return -1;
+    UserBank& b = s_banks[s_bankCount];
+    strncpy(b.name, name ? name : "User", WAVE_BANK_NAME - 1);
+    b.name[WAVE_BANK_NAME - 1] = '\0';
+    b.count = 0;
+    return (int8_t)s_bankCount++;
+}
+
+int16_t addTable(uint8_t bank, const int16_t* table) {
+    if (bank >= s_bankCount || !table) return -1;
+    UserBank& b = s_banks[bank];
+    if (b.count >= WAVE_USER_TABLES) return -1;
+    int16_t* t = allocTable();
+    if (!t) return -1;
+    memcpy(t, table, WAVE_TABLE_LEN * sizeof(int16_t));
+    b.tables[b.count] = t;
+    return (int16_t)b.count++;
+}
+
+bool setTable(uint8_t bank, uint16_t index, const int16_t* table) {
+    if (bank >= s_bankCount || index >= WAVE_USER_TABLES || !table) return false;
+    UserBank& b = s_banks[bank];
+    if (!b.tables[index]) b.tables[index] = allocTable();
+    if (!b.tables[index]) return false;
+    memcpy(b.tables[index], table, WAVE_TABLE_LEN * sizeof(int16_t));
+    if (index >= b.count) b.count = index + 1;
+    return true;
+}
+
+uint8_t bankCount() { return s_bankCount; }
+
+const char* bankName(uint8_t bank) {
+    return (bank < s_bankCount) ? s_banks[bank].name : "?";
+}
+
+uint16_t tableCount(uint8_t bank) {
+    return (bank < s_bankCount) ? s_banks[bank].count : 0;
+}
+
+const int16_t* table(uint8_t bank, uint16_t index) {
+    if (bank >= s_bankCount || index >= s_banks[bank].count) return nullptr;
+    return s_banks[bank].tables[index];
+}
+
+void resampleCycle(const float* src, uint32_t frames, float* out, uint16_t from, uint16_t to) {
+    const float ratio = (float)frames / (float)WAVE_TABLE_LEN;
+    for (uint16_t n = from; n < to; ++n) {
+        const float pos = n * ratio;
+        uint32_t    i0  = (uint32_t)pos;
+        if (ratio > 1.0f) {
+            // Shortening: average the source span this output sample covers
+            uint32_t i1 = (uint32_t)(pos + ratio);
+            if (i1 > frames) i1 = frames;
+            if (i1 <= i0) i1 = i0 + 1;
+            float sum = 0.0f;
+            for (uint32_t i = i0; i < i1; ++i) sum += src[i];
+            out[n] = sum / (float)(i1 - i0);
+        } else {
+            // Stretching: linear, wrapping around the cycle
+            const float    frac = pos - (float)i0;
+            const uint32_t i1   = (i0 + 1 < frames) ? i0 + 1 : 0;
+            out[n] = src[i0] + (src[i1] - src[i0]) * frac;
+        }
+    }
+}
+
+bool normaliseCycle(const float* in, int16_t* out) {
+    float mean = 0.0f;
+    for (uint16_t n = 0; n < WAVE_TABLE_LEN; ++n) mean += in[n];
+    mean /= (float)WAVE_TABLE_LEN;
+    float peak = 0.0f;
+    for (uint16_t n = 0; n < WAVE_TABLE_LEN; ++n) peak = fmaxf(peak, fabsf(in[n] - mean));
+    if (peak < 1.0e-6f) return false;
+
+    const float scale = 32767.0f / peak;
+    for (uint16_t n = 0; n < WAVE_TABLE_LEN; ++n) {
+        out[n] = (int16_t)lrintf((in[n] - mean) * scale);
+    }
+    return true;
+}
+
+} // namespace WaveTablePool
+
+uint16_t wavebank_decode(ArbBank b, uint16_t idx, int16_t* out) {
+    const uint8_t i = (uint8_t)b;
+    if (i < AKWF_BANK_COUNT) return akwf_decode(b, idx, out);
+
+    const int16_t* t = WaveTablePool::table(i - AKWF_BANK_COUNT, idx);
+    if (!t) return 0;
+    memcpy(out, t, WAVE_TABLE_LEN * sizeof(int16_t));
+    return WAVE_TABLE_LEN;
+}
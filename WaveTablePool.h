@@ -0,0 +1,70 @@
+#pragma once
+#include <Arduino.h>
+#include "AKWF_All.h"
+
+// ============================================================================
+// WaveTablePool: user wavetable banks in RAM / PSRAM
+// ----------------------------------------------------------------------------
+// Banks loaded at run time (SD card, see WavFileLoader; SysEx uploads, see
+// WaveSysEx) sit after the
+// built-in AKWF banks: ArbBank values 0..AKWF_BANK_COUNT-1 are the flash
+// banks, AKWF_BANK_COUNT.. the user banks.  The wavebank_* functions below
+// cover both and are what the engine uses for bank names, counts and data.
+//
+// User tables are stored like the AKWF cycles (WAVE_TABLE_LEN samples,
+// peak-normalised) and only ever read in loop context (AKWFMip builds the
+// playable RAM copies), so no audio interrupt guard is needed.
+// ============================================================================
+
+#define WAVE_USER_BANKS   4
+#define WAVE_USER_TABLES  64                   // Per bank
+#define WAVE_TABLE_LEN    AKWF_MAX_TABLE_LEN   // Samples per stored cycle
+#define WAVE_BANK_NAME    16                   // Including terminator
+
+namespace WaveTablePool {
+
+// New empty bank; user bank number, -1 when every bank is taken
+int8_t createBank(const char* name);
+
+// Append a WAVE_TABLE_LEN-sample cycle (copied); table index, -1 when the
+// bank is full or out of memory
+int16_t addTable(uint8_t bank, const int16_t* table);
+
+// Write a numbered slot (copied), growing the bank to index + 1.  Slots are
+// allocated once and overwritten in place.  false when out of range / memory.
+bool setTable(uint8_t bank, uint16_t index, const int16_t* table);
+
+uint8_t        bankCount();
+const char*    bankName(uint8_t bank);
+uint16_t       tableCount(uint8_t bank);
+const int16_t* table(uint8_t bank, uint16_t index);   // nullptr if absent
+
+// Conform any single cycle to WAVE_TABLE_LEN, in slices if needed:
+// resample output samples [from, to) of 'out' (box average when shortening,
+// linear when stretching), then DC-remove and peak-normalise the whole
+// table (false if it is silent).
+void resampleCycle(const float* src, uint32_t frames, float* out, uint16_t from, uint16_t to);
+bool normaliseCycle(const float* in, int16_t* out);
+
+} // namespace WaveTablePool
+
+// ---- Built-in + user banks ----
+
+inline uint8_t wavebank_count() {
+    return AKWF_BANK_COUNT + WaveTablePool::bankCount();
+}
+
+inline const char* wavebank_name(ArbBank b) {
+    const uint8_t i = (uint8_t)b;
+    return (i < AKWF_BANK_COUNT) ? akwf_bankName(b)
+                                 : WaveTablePool::bankName(i - AKWF_BANK_COUNT);
+}
+
+inline uint16_t wavebank_tableCount(ArbBank b) {
+    const uint8_t i = (uint8_t)b;
+    return (i < AKWF_BANK_COUNT) ? akwf_bankCount(b)
+                                 : WaveTablePool::tableCount(i - AKWF_BANK_COUNT);
+}
+
+// Table samples into 'out' (AKWF_MAX_TABLE_LEN of room); 0 if absent
+uint16_t wavebank_decode(ArbBank b, uint16_t idx, int16_t* out);
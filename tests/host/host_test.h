@@ -0,0 +1,17 @@
+// Minimal checks for the host tests: every failure is printed, main()
+// returns the failure count through HOST_TEST_END.
+#pragma once
+#include <stdio.h>
+
+inline int hostTestFailures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { \
+    printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); hostTestFailures++; } } while (0)
+
+#define CHECK_NEAR(a, b, tol) do { const double _a = (a), _b = (b); \
+    if (!(fabs(_a - _b) <= (tol))) { \
+        printf("  FAIL %s:%d: %s = %g, %s = %g (tol %g)\n", __FILE__, __LINE__, #a, _a, #b, _b, (double)(tol)); \
+        hostTestFailures++; } } while (0)
+
+#define HOST_TEST_END() do { \
+    printf("%s\n", hostTestFailures ? "FAILED" : "ok"); return hostTestFailures ? 1 : 0; } while (0)
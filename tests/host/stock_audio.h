@@ -0,0 +1,141 @@
+// Stock Teensy Audio objects the engine's own replace, as references for
+// the host tests: AudioMixer4 (mixer.cpp) and AudioEffectMultiply
+// (effect_multiply.cpp), their __ARM_ARCH_7EM__ code over stubs/dspinst.h.
+// update() is public so tests can run them.
+#pragma once
+#include <Audio.h>
+#include <dspinst.h>
+
+#define MULTI_UNITYGAIN 65536
+
+inline void applyGain(int16_t *data, int32_t mult)
+{
+	uint32_t *p = (uint32_t *)data;
+	const uint32_t *end = (uint32_t *)(data + AUDIO_BLOCK_SAMPLES);
+
+	do {
+		uint32_t tmp32 = *p; // read 2 samples from *data
+		int32_t val1 = signed_multiply_32x16b(mult, tmp32);
+		int32_t val2 = signed_multiply_32x16t(mult, tmp32);
+		val1 = signed_saturate_rshift(val1, 16, 0);
+		val2 = signed_saturate_rshift(val2, 16, 0);
+		*p++ = pack_16b_16b(val2, val1);
+	} while (p < end);
+}
+
+inline void applyGainThenAdd(int16_t *data, const int16_t *in, int32_t mult)
+{
+	uint32_t *dst = (uint32_t *)data;
+	const uint32_t *src = (uint32_t *)in;
+	const uint32_t *end = (uint32_t *)(data + AUDIO_BLOCK_SAMPLES);
+
+	if (mult == MULTI_UNITYGAIN) {
+		do {
+			uint32_t tmp32 = *dst;
+			*dst++ = signed_add_16_and_16(tmp32, *src++);
+			tmp32 = *dst;
+			*dst++ = signed_add_16_and_16(tmp32, *src++);
+		} while (dst < end);
+	} else {
+		do {
+			uint32_t tmp32 = *src++; // read 2 samples from *data
+			int32_t val1 = signed_multiply_32x16b(mult, tmp32);
+			int32_t val2 = signed_multiply_32x16t(mult, tmp32);
+			val1 = signed_saturate_rshift(val1, 16, 0);
+			val2 = signed_saturate_rshift(val2, 16, 0);
+			tmp32 = pack_16b_16b(val2, val1);
+			uint32_t tmp32b = *dst;
+			*dst++ = signed_add_16_and_16(tmp32, tmp32b);
+		} while (dst < end);
+	}
+}
+
+class StockMixer4 : public AudioStream {
+public:
+	StockMixer4(void) : AudioStream(4, inputQueueArray) {
+		for (int i=0; i<4; i++) multiplier[i] = 65536;
+	}
+	void update(void);
+	void gain(unsigned int channel, float gain) {
+		if (channel >= 4) return;
+		if (gain > 32767.0f) gain = 32767.0f;
+		else if (gain < -32767.0f) gain = -32767.0f;
+		multiplier[channel] = gain * 65536.0f; // TODO: proper roundoff?
+	}
+private:
+	int32_t multiplier[4];
+	audio_block_t *inputQueueArray[4];
+};
+
+inline void StockMixer4::update(void)
+{
+	audio_block_t *in, *out=NULL;
+	unsigned int channel;
+
+	for (channel=0; channel < 4; channel++) {
+		if (!out) {
+			out = receiveWritable(channel);
+			if (out) {
+				int32_t mult = multiplier[channel];
+				if (mult != MULTI_UNITYGAIN) applyGain(out->data, mult);
+			}
+		} else {
+			in = receiveReadOnly(channel);
+			if (in) {
+				applyGainThenAdd(out->data, in->data, multiplier[channel]);
+				release(in);
+			}
+		}
+	}
+	if (out) {
+		transmit(out);
+		release(out);
+	}
+}
+
+class StockMultiply : public AudioStream {
+public:
+	StockMultiply() : AudioStream(2, inputQueueArray) { }
+	void update(void);
+private:
+	audio_block_t *inputQueueArray[2];
+};
+
+inline void StockMultiply::update(void)
+{
+	audio_block_t *blocka, *blockb;
+	uint32_t *pa, *pb, *end;
+	uint32_t a12, a34; //, a56, a78;
+	uint32_t b12, b34; //, b56, b78;
+
+	blocka = receiveWritable(0);
+	blockb = receiveReadOnly(1);
+	if (!blocka) {
+		if (blockb) release(blockb);
+		return;
+	}
+	if (!blockb) {
+		release(blocka);
+		return;
+	}
+	pa = (uint32_t *)(blocka->data);
+	pb = (uint32_t *)(blockb->data);
+	end = pa + AUDIO_BLOCK_SAMPLES/2;
+	while (pa < end) {
+		a12 = *pa;
+		a34 = *(pa+1);
+		b12 = *pb++;
+		b34 = *pb++;
+		a12 = pack_16b_16b(
+			signed_saturate_rshift(multiply_16tx16t(a12, b12), 16, 15),
+			signed_saturate_rshift(multiply_16bx16b(a12, b12), 16, 15));
+		a34 = pack_16b_16b(
+			signed_saturate_rshift(multiply_16tx16t(a34, b34), 16, 15),
+			signed_saturate_rshift(multiply_16bx16b(a34, b34), 16, 15));
+		*pa++ = a12;
+		*pa++ = a34;
+	}
+	transmit(blocka);
+	release(blocka);
+	release(blockb);
+}
@@ -0,0 +1,73 @@
+// Host stand-in for the Teensy core: just enough of Arduino.h for the
+// engine sources under test.  Time is simulated — tests set hostMicros.
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+#include <chrono>
+
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+
+#ifndef PI
+#define PI      3.14159265358979f
+#endif
+#define TWO_PI  6.28318530717959f
+#define PROGMEM
+#define DMAMEM
+#define FLASHMEM
+#define FASTRUN
+#define memcpy_P memcpy
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define constrain(x, lo, hi) ((x) < (lo) ? (lo) : ((x) > (hi) ? (hi) : (x)))
+
+// Simulated clocks
+inline uint32_t hostMicros = 0;
+inline uint32_t micros() { return hostMicros; }
+inline uint32_t millis() { return hostMicros / 1000u; }
+
+// Cycle counter: host nanoseconds, so the engine's cycle stats read as ns
+inline uint32_t hostCycleCount() {
+    using namespace std::chrono;
+    return (uint32_t)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+#define ARM_DWT_CYCCNT (hostCycleCount())
+
+inline void __disable_irq() {}
+inline void __enable_irq()  {}
+
+struct HostSerial {
+    template <class... A> void printf(const char* f, A... a) { if (!quiet) ::printf(f, a...); }
+    void println(const char* s = "") { if (!quiet) ::printf("%s\n", s); }
+    void print(const char* s)        { if (!quiet) ::printf("%s", s); }
+    void print(long v)               { if (!quiet) ::printf("%ld", v); }
+    void print(unsigned long v)      { if (!quiet) ::printf("%lu", v); }
+    void print(int v)                { print((long)v); }
+    void print(unsigned v)           { print((unsigned long)v); }
+    bool quiet = true;
+};
+inline HostSerial Serial;
+
+class String : public std::string {
+public:
+    using std::string::string;
+    String(const std::string& s) : std::string(s) {}
+    String(int v) : std::string(std::to_string(v)) {}
+    int indexOf(char c, unsigned from = 0) const { auto p = find(c, from); return p == npos ? -1 : (int)p; }
+    String substring(size_t a, size_t b = npos) const { return String(substr(a, b == npos ? npos : b - a)); }
+    long toInt() const { return atol(c_str()); }
+};
+
+class HardwareSerial {
+public:
+    int  availableForWrite() { return 64; }
+    int  available()         { return 0; }
+    size_t write(uint8_t b)  { written.push_back(b); return 1; }
+    std::string written;
+};
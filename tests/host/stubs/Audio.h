@@ -0,0 +1,305 @@
+// Host stand-in for the Teensy Audio library: AudioStream with block
+// queues the tests can feed and read, plus the constants engine code uses.
+// The stock objects the engine builds on record their settings and render
+// nothing; every AudioStream joins an update list, as in the library, so a
+// test can run an audio cycle over a whole graph.
+#pragma once
+#include <Arduino.h>
+#include <vector>
+#include <functional>
+
+#define AUDIO_BLOCK_SAMPLES     128
+#define AUDIO_SAMPLE_RATE_EXACT 44117.64706f
+#define AUDIO_SAMPLE_RATE       AUDIO_SAMPLE_RATE_EXACT
+
+#define WAVEFORM_SINE                     0
+#define WAVEFORM_SAWTOOTH                 1
+#define WAVEFORM_SQUARE                   2
+#define WAVEFORM_TRIANGLE                 3
+#define WAVEFORM_ARBITRARY                4
+#define WAVEFORM_PULSE                    5
+#define WAVEFORM_SAWTOOTH_REVERSE         6
+#define WAVEFORM_SAMPLE_HOLD              7
+#define WAVEFORM_TRIANGLE_VARIABLE        8
+#define WAVEFORM_BANDLIMIT_SAWTOOTH       9
+#define WAVEFORM_BANDLIMIT_SAWTOOTH_REVERSE 10
+#define WAVEFORM_BANDLIMIT_SQUARE         11
+#define WAVEFORM_BANDLIMIT_PULSE          12
+
+struct audio_block_t {
+    int16_t data[AUDIO_BLOCK_SAMPLES];
+};
+
+// Audio interrupt mask.  hostAudioIsr models an update that came due while
+// masked: it runs at every unmask, so a test sees the graph exactly as an
+// audio cycle would (nullptr: no cycle pending).
+inline bool hostAudioMasked = false;
+inline void (*hostAudioIsr)() = nullptr;
+inline void AudioNoInterrupts() { hostAudioMasked = true; }
+inline void AudioInterrupts()   { hostAudioMasked = false; if (hostAudioIsr) hostAudioIsr(); }
+
+inline float AudioProcessorUsage()         { return 0.0f; }
+inline float AudioProcessorUsageMax()      { return 0.0f; }
+inline void  AudioProcessorUsageMaxReset() {}
+#define AudioMemory(n) do {} while (0)
+
+class AudioStream;
+// Every AudioStream alive, in construction order (the library's update list)
+inline std::vector<AudioStream*>& hostAudioStreams() {
+    static std::vector<AudioStream*> list;
+    return list;
+}
+
+// Blocks are plain heap objects; a test owns what it feeds in and what an
+// object transmits (collected per output in 'sent').
+class AudioStream {
+public:
+    AudioStream(unsigned char nIn, audio_block_t** queue)
+        : _nIn(nIn), _in(nIn, nullptr) { (void)queue; hostAudioStreams().push_back(this); }
+    virtual ~AudioStream() {
+        auto& l = hostAudioStreams();
+        l.erase(std::remove(l.begin(), l.end(), this), l.end());
+    }
+    virtual void update() = 0;
+    float processorUsageMax() const { return 0.0f; }
+
+    // Test side
+    void feed(unsigned ch, audio_block_t* b) { _in[ch] = b; }
+    std::vector<std::pair<unsigned, audio_block_t>> sent;
+    bool active = true;
+
+protected:
+    audio_block_t* receiveReadOnly(unsigned ch = 0) {
+        audio_block_t* b = ch < _nIn ? _in[ch] : nullptr;
+        if (ch < _nIn) _in[ch] = nullptr;
+        return b;
+    }
+    audio_block_t* receiveWritable(unsigned ch = 0) { return receiveReadOnly(ch); }
+    static audio_block_t* allocate() { return &scratch(); }
+    void transmit(audio_block_t* b, unsigned ch = 0) { sent.push_back({ ch, *b }); }
+    static void release(audio_block_t*) {}
+
+private:
+    static audio_block_t& scratch() { static audio_block_t s; return s; }
+    unsigned _nIn;
+    std::vector<audio_block_t*> _in;
+};
+
+class AudioConnection;
+// Every patch cord alive, in construction order
+inline std::vector<AudioConnection*>& hostAudioCords() {
+    static std::vector<AudioConnection*> list;
+    return list;
+}
+
+// Patch cord: connect() sets 'active' on both ends, as the library's does
+class AudioConnection {
+public:
+    AudioConnection() { hostAudioCords().push_back(this); }
+    AudioConnection(AudioStream& s, unsigned char so, AudioStream& d, unsigned char di)
+        : AudioConnection() {
+        connect(s, so, d, di);
+    }
+    AudioConnection(AudioStream& s, AudioStream& d) : AudioConnection() { connect(s, 0, d, 0); }
+    AudioConnection(const AudioConnection&) = delete;
+    AudioConnection& operator=(const AudioConnection&) = delete;
+    ~AudioConnection() {
+        auto& l = hostAudioCords();
+        l.erase(std::remove(l.begin(), l.end(), this), l.end());
+    }
+    int connect(AudioStream& s, unsigned char so, AudioStream& d, unsigned char di) {
+        src = &s; dst = &d; src_index = so; dest_index = di;
+        return connect();
+    }
+    int connect() {
+        if (!src || !dst) return 4;
+        isConnected = true;
+        src->active = true;
+        dst->active = true;
+        return 0;
+    }
+    int disconnect() { isConnected = false; return 0; }
+    bool connected() const { return isConnected; }   // Test side
+    AudioStream* source() const      { return src; }
+    AudioStream* destination() const { return dst; }
+    unsigned char sourceOutput() const     { return src_index; }
+    unsigned char destinationInput() const { return dest_index; }
+
+protected:
+    AudioStream*  src = nullptr;
+    AudioStream*  dst = nullptr;
+    unsigned char src_index = 0, dest_index = 0;
+    bool          isConnected = false;
+};
+
+// One audio cycle: update() on every active object in list order, outputs
+// cleared first.  Returns the number of update() calls.
+inline unsigned hostAudioUpdate() {
+    unsigned n = 0;
+    for (AudioStream* s : hostAudioStreams()) {
+        if (!s->active) continue;
+        s->sent.clear();
+        s->update();
+        n++;
+    }
+    return n;
+}
+
+// ---- Stock objects: settings only --------------------------------------------
+
+class AudioSynthWaveformDc : public AudioStream {
+public:
+    AudioSynthWaveformDc() : AudioStream(0, nullptr) {}
+    void amplitude(float n)            { level = n; }
+    void amplitude(float n, float)     { level = n; }
+    float read() const                 { return level; }
+    float level = 0.0f;
+protected:
+    void update() override {}
+};
+
+class AudioSynthWaveform : public AudioStream {
+public:
+    AudioSynthWaveform() : AudioStream(0, nullptr) {}
+    void begin(short type)             { tone = type; }
+    void begin(float a, float f, short type) { amp = a; freq = f; tone = type; }
+    void frequency(float f)            { freq = f; }
+    void amplitude(float a)            { amp = a; }
+    void phase(float)                  {}
+    void pulseWidth(float)             {}
+    short tone = WAVEFORM_SINE;
+    float freq = 0.0f, amp = 0.0f;
+protected:
+    void update() override {}
+};
+
+class AudioSynthWaveformModulated : public AudioStream {
+public:
+    AudioSynthWaveformModulated() : AudioStream(2, _inputQueue) {}
+    void begin(short type)             { tone = type; }
+    void begin(float a, float f, short type) { amp = a; freq = f; tone = type; }
+    void frequency(float f)            { freq = f; }
+    void amplitude(float a)            { amp = a; }
+    void offset(float)                 {}
+    void arbitraryWaveform(const int16_t* data, float) { arb = data; }
+    void frequencyModulation(float)    {}
+    void phaseModulation(float)        {}
+    short          tone = WAVEFORM_SINE;
+    float          freq = 0.0f, amp = 0.0f;
+    const int16_t* arb  = nullptr;
+protected:
+    void update() override {}
+private:
+    audio_block_t* _inputQueue[2];
+};
+
+class AudioSynthNoisePink : public AudioStream {
+public:
+    AudioSynthNoisePink() : AudioStream(0, nullptr) {}
+    void amplitude(float a) { amp = a; }
+    float amp = 0.0f;
+protected:
+    void update() override {}
+};
+
+class AudioEffectEnvelope : public AudioStream {
+public:
+    AudioEffectEnvelope() : AudioStream(1, _inputQueue) {}
+    void noteOn()                  { on = true; }
+    void noteOff()                 { on = false; }
+    void delay(float)              {}
+    void attack(float ms)          { a = ms; }
+    void hold(float)               {}
+    void decay(float ms)           { d = ms; }
+    void sustain(float level)      { s = level; }
+    void release(float ms)         { r = ms; }
+    void releaseNoteOn(float)      {}
+    bool isActive() const          { return on; }
+    bool isSustain() const         { return on; }
+    bool  on = false;
+    float a = 0.0f, d = 0.0f, s = 1.0f, r = 0.0f;
+protected:
+    void update() override {}
+private:
+    audio_block_t* _inputQueue[1];
+};
+
+class AudioEffectDelay : public AudioStream {
+public:
+    AudioEffectDelay() : AudioStream(1, _inputQueue) {}
+    void delay(uint8_t, float) {}
+    void disable(uint8_t)      {}
+protected:
+    void update() override {}
+private:
+    audio_block_t* _inputQueue[1];
+};
+
+class AudioAmplifier : public AudioStream {
+public:
+    AudioAmplifier() : AudioStream(1, _inputQueue) {}
+    void gain(float g) { level = g; }
+    float level = 1.0f;
+protected:
+    void update() override {}
+private:
+    audio_block_t* _inputQueue[1];
+};
+
+class AudioMixer4 : public AudioStream {
+public:
+    AudioMixer4() : AudioStream(4, _inputQueue) {}
+    void gain(unsigned ch, float g) { if (ch < 4) level[ch] = g; }
+    float level[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+protected:
+    void update() override {}
+private:
+    audio_block_t* _inputQueue[4];
+};
+
+class AudioEffectPlateReverb_i16 : public AudioStream {
+public:
+    AudioEffectPlateReverb_i16() : AudioStream(2, _inputQueue) {}
+    void bypass_set(bool b) { bypass = b; }
+    void mix(float m)       { wet = m; }
+    void size(float n)      { room = n; }
+    void hidamp(float n)    { hi = n; }
+    void lodamp(float n)    { lo = n; }
+    bool  bypass = false;
+    float wet = 0.0f, room = 0.0f, hi = 0.0f, lo = 0.0f;
+protected:
+    void update() override {}
+private:
+    audio_block_t* _inputQueue[2];
+};
+
+// The most recently started timer's callback; tests call it to model the
+// timer firing (nullptr while stopped)
+inline void (*hostTimerFn)() = nullptr;
+inline bool hostInTimerISR = false;   // Set by tests around hostTimerFn()
+
+class IntervalTimer {
+public:
+    bool begin(void (*fn)(), float) { hostTimerFn = fn; return true; }
+    void end()                      { hostTimerFn = nullptr; }
+    void priority(uint8_t)          {}
+};
+
+// usbMIDI transmit side, recorded so tests can check who writes and when
+struct HostUsbMidi {
+    void sendRealTime(uint8_t b) { bytes.push_back(b); stamps.push_back(hostMicros); _writer(); }
+    void sendSysEx(uint32_t n, const uint8_t* d, bool) {
+        bytes.insert(bytes.end(), d, d + n);
+        stamps.insert(stamps.end(), n, hostMicros);
+        _writer();
+    }
+    void send_now() { flushes++; }
+    void clear()    { bytes.clear(); stamps.clear(); flushes = 0; outsideTimer = 0; }
+    std::vector<uint8_t>  bytes;
+    std::vector<uint32_t> stamps;   // micros() at which each byte went out
+    unsigned flushes      = 0;
+    unsigned outsideTimer = 0;      // Writes not made from the timer ISR
+private:
+    void _writer() { if (!hostInTimerISR) outsideTimer++; }
+};
+inline HostUsbMidi usbMIDI;
@@ -0,0 +1,3 @@
+// AudioStream.h is part of the Audio library stand-in
+#pragma once
+#include <Audio.h>
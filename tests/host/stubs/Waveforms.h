@@ -0,0 +1,4 @@
+// The sketch includes "Waveforms.h" for WaveForms.h; the Teensy toolchain
+// is mostly run on case-insensitive filesystems, a Linux host isn't.
+#pragma once
+#include "WaveForms.h"
@@ -0,0 +1,3 @@
+// arm_math.h is part of the Audio library stand-in
+#pragma once
+#include <Audio.h>
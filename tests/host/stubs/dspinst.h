@@ -0,0 +1,44 @@
+// Host stand-in for the Teensy core's dspinst.h: the Cortex-M7 DSP
+// instructions it wraps, written out from their architectural definitions
+// (little-endian halfwords: b = bits 15..0, t = bits 31..16).
+#pragma once
+#include <stdint.h>
+
+// SSAT Rd, #bits, Rn, ASR #rshift
+static inline int32_t signed_saturate_rshift(int32_t val, int bits, int rshift) {
+    const int32_t v   = val >> rshift;
+    const int32_t max = (1 << (bits - 1)) - 1;
+    const int32_t min = -(1 << (bits - 1));
+    return v > max ? max : (v < min ? min : v);
+}
+
+// SMULWB / SMULWT: top 32 bits of the 48-bit product
+static inline int32_t signed_multiply_32x16b(int32_t a, uint32_t b) {
+    return (int32_t)(((int64_t)a * (int16_t)(b & 0xFFFF)) >> 16);
+}
+static inline int32_t signed_multiply_32x16t(int32_t a, uint32_t b) {
+    return (int32_t)(((int64_t)a * (int16_t)(b >> 16)) >> 16);
+}
+
+// PKHBT Rd, b, a, LSL #16
+static inline uint32_t pack_16b_16b(int32_t a, int32_t b) {
+    return ((uint32_t)a << 16) | ((uint32_t)b & 0xFFFF);
+}
+
+// QADD16
+static inline uint32_t signed_add_16_and_16(uint32_t a, uint32_t b) {
+    auto lane = [](int32_t x) -> uint32_t {
+        return (uint16_t)(x > 32767 ? 32767 : (x < -32768 ? -32768 : x));
+    };
+    const uint32_t lo = lane((int16_t)(a & 0xFFFF) + (int16_t)(b & 0xFFFF));
+    const uint32_t hi = lane((int16_t)(a >> 16) + (int16_t)(b >> 16));
+    return (hi << 16) | lo;
+}
+
+// SMULBB / SMULTT
+static inline int32_t multiply_16bx16b(uint32_t a, uint32_t b) {
+    return (int32_t)(int16_t)(a & 0xFFFF) * (int16_t)(b & 0xFFFF);
+}
+static inline int32_t multiply_16tx16t(uint32_t a, uint32_t b) {
+    return (int32_t)(int16_t)(a >> 16) * (int16_t)(b >> 16);
+}
@@ -0,0 +1,3 @@
+// effect_envelope.h is part of the Audio library stand-in
+#pragma once
+#include <Audio.h>
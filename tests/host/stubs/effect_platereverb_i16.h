@@ -0,0 +1,3 @@
+// effect_platereverb_i16.h is part of the Audio library stand-in
+#pragma once
+#include <Audio.h>
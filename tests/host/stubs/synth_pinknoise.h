@@ -0,0 +1,3 @@
+// synth_pinknoise.h is part of the Audio library stand-in
+#pragma once
+#include <Audio.h>
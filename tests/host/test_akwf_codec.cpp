@@ -0,0 +1,57 @@
+// AKWFCodec: every compressed AKWF table decodes to the original samples.
+// Golden values are FNV-1a hashes (little-endian int16) of each bank's
+// tables as stored uncompressed before the codec, in bank order.
+#include "host_test.h"
+#include "AKWF_All.h"
+
+static uint32_t fnv(uint32_t h, const int16_t* s, uint16_t n) {
+    for (uint16_t i = 0; i < n; i++) {
+        h = (h ^ (uint8_t)(s[i] & 0xFF)) * 0x01000193u;
+        h = (h ^ (uint8_t)((uint16_t)s[i] >> 8)) * 0x01000193u;
+    }
+    return h;
+}
+
+static void testBanksMatchOriginal() {
+    printf("Every table decodes to the original uncompressed samples\n");
+    static const struct { ArbBank bank; uint16_t count; uint32_t hash; } golden[] = {
+        { ArbBank::BwBlended,      73, 0xb9eb9e3au },
+        { ArbBank::BwPerfectwaves,  4, 0xa635876fu },
+        { ArbBank::BwSaw,          50, 0x8bd33adfu },
+        { ArbBank::BwSawbright,    10, 0x848dae69u },
+        { ArbBank::BwSawgap,       42, 0x681e22bfu },
+        { ArbBank::BwSawrounded,   52, 0x58c58791u },
+        { ArbBank::BwSin,          12, 0x999b5ab9u },
+        { ArbBank::BwSqu,         100, 0xef2c191au },
+        { ArbBank::BwSqurounded,   52, 0x329ad1c9u },
+        { ArbBank::BwTri,          25, 0x16c79884u },
+    };
+    static_assert(sizeof(golden) / sizeof(golden[0]) == AKWF_BANK_COUNT, "one entry per bank");
+
+    unsigned tables = 0;
+    for (const auto& g : golden) {
+        CHECK(akwf_bankCount(g.bank) == g.count);
+        uint32_t h = 0x811C9DC5u;
+        for (uint16_t i = 0; i < akwf_bankCount(g.bank); i++) {
+            int16_t buf[AKWF_MAX_TABLE_LEN + 1];
+            buf[AKWF_MAX_TABLE_LEN] = 0x5A5A;
+            const uint16_t n = akwf_decode(g.bank, i, buf);
+            CHECK(n > 0 && n <= AKWF_MAX_TABLE_LEN);
+            CHECK(buf[AKWF_MAX_TABLE_LEN] == 0x5A5A);   // Never writes past the length
+            h = fnv(h, buf, n);
+            tables++;
+        }
+        if (h != g.hash) printf("  %s: hash %08x, want %08x\n", akwf_bankName(g.bank), h, g.hash);
+        CHECK(h == g.hash);
+    }
+    printf("  %u tables\n", tables);
+    CHECK(tables == 420);
+
+    int16_t buf[AKWF_MAX_TABLE_LEN];
+    CHECK(akwf_decode(ArbBank::BwSaw, 50, buf) == 0);
+}
+
+int main() {
+    testBanksMatchOriginal();
+    HOST_TEST_END();
+}
@@ -0,0 +1,100 @@
+// AKWFMip: the table OscillatorBlock plays at a pitch (levelFor + blend,
+// keyed in sixteenths like _updateArbMip) carries no harmonic that folds
+// over Nyquist, measured on real AKWF banks across the keyboard.
+#include "host_test.h"
+#include <Audio.h>
+#include "AKWFMip.h"
+#include "WaveTablePool.h"
+#include <vector>
+
+// Per-harmonic power of a 256-sample table (DFT, h = 1..128)
+static std::vector<double> spectrum(const int16_t* t) {
+    std::vector<double> p(AKWF_MIP_SIZE / 2 + 1, 0.0);
+    for (unsigned h = 1; h <= AKWF_MIP_SIZE / 2; h++) {
+        double re = 0.0, im = 0.0;
+        for (unsigned n = 0; n < AKWF_MIP_SIZE; n++) {
+            const double w = 2.0 * M_PI * h * n / AKWF_MIP_SIZE;
+            re += t[n] * cos(w);
+            im += t[n] * sin(w);
+        }
+        p[h] = re * re + im * im;
+    }
+    return p;
+}
+
+// Energy above Nyquist relative to the whole table, dB
+static double aliasDb(const int16_t* t, double f) {
+    const auto p = spectrum(t);
+    double total = 0.0, alias = 0.0;
+    for (unsigned h = 1; h < p.size(); h++) {
+        total += p[h];
+        if (h * f > AUDIO_SAMPLE_RATE_EXACT * 0.5) alias += p[h];
+    }
+    if (total <= 0.0) return -200.0;
+    return 10.0 * log10(alias / total + 1e-20);
+}
+
+// As OscillatorBlock::_updateArbMip keys and blends it
+static void tableAt(const AKWFMipSet& set, float f, int16_t* out) {
+    const float   lf   = AKWFMip::levelFor(f);
+    const uint8_t a    = (uint8_t)lf;
+    const uint8_t step = (uint8_t)((lf - a) * 16.0f);
+    AKWFMip::blend(set, a, step * (1.0f / 16.0f), out);
+}
+
+// The mapping this replaced: floor(l) crossfaded towards l + 1, so level
+// floor(l) kept weight above its own limit
+static void tableAtFloor(const AKWFMipSet& set, float f, int16_t* out) {
+    float l = log2f(f * (256.0f / AUDIO_SAMPLE_RATE_EXACT));
+    l = l < 0.0f ? 0.0f : l > AKWF_MIP_LEVELS - 1 ? AKWF_MIP_LEVELS - 1 : l;
+    const uint8_t a = (uint8_t)l;
+    AKWFMip::blend(set, a, (uint8_t)((l - a) * 16.0f) * (1.0f / 16.0f), out);
+}
+
+static void testNoAliasAcrossKeyboard() {
+    printf("Alias energy of the played table, 27.5 Hz .. 8 kHz in 1/48-octave steps\n");
+    const struct { ArbBank bank; uint16_t index; } tables[] = {
+        { ArbBank::BwSaw, 0 }, { ArbBank::BwSqu, 0 }, { ArbBank::BwBlended, 10 },
+    };
+    for (const auto& tb : tables) {
+        const AKWFMipSet* set = AKWFMip::acquire(tb.bank, tb.index);
+        CHECK(set != nullptr);
+        if (!set) continue;
+
+        int16_t buf[AKWF_MIP_SIZE];
+        double worst = -200.0, worstF = 0.0, worstOld = -200.0;
+        for (double f = 27.5; f < 8000.0; f *= pow(2.0, 1.0 / 48.0)) {
+            tableAt(*set, (float)f, buf);
+            const double db = aliasDb(buf, f);
+            if (db > worst) { worst = db; worstF = f; }
+            tableAtFloor(*set, (float)f, buf);
+            worstOld = std::max(worstOld, aliasDb(buf, f));
+        }
+        printf("  %s #%u: worst %.1f dB at %.0f Hz (floor mapping: %.1f dB)\n",
+               wavebank_name(tb.bank), tb.index, worst, worstF, worstOld);
+        CHECK(worst < -85.0);      // int16 rounding only
+        CHECK(worstOld > -40.0);   // The check does see the old fold-over
+        AKWFMip::release(set);
+    }
+}
+
+static void testLevelsAreMonotonic() {
+    printf("levelFor: continuous, rising with pitch, full band at the bottom\n");
+    CHECK(AKWFMip::levelFor(20.0f) == 0.0f);
+    CHECK(AKWFMip::levelFor(0.0f) == 0.0f);
+    CHECK(AKWFMip::levelFor(20000.0f) == (float)(AKWF_MIP_LEVELS - 1));
+    float prev = 0.0f, maxJump = 0.0f;
+    for (float f = 20.0f; f < 20000.0f; f *= 1.001f) {
+        const float l = AKWFMip::levelFor(f);
+        CHECK(l >= prev);
+        maxJump = std::max(maxJump, l - prev);
+        prev = l;
+    }
+    CHECK(maxJump < 0.01f);
+}
+
+int main() {
+    testNoAliasAcrossKeyboard();
+    testLevelsAreMonotonic();
+    HOST_TEST_END();
+}
@@ -0,0 +1,159 @@
+// CC dispatch: a knob session as controllers send it (sweeps, jittery
+// repeats, 14-bit pairs on CC 20) replayed through
+// SynthEngine::handleControlChange, with ns per CC on this host for applied
+// and suppressed CCs.  Also checks that a repeated value is suppressed, that
+// HIRES_LSB pairs with the next non-Raw CC only, and that applying a CC
+// invalidates the others of its link group so they apply again.
+#include "host_test.h"
+#include "SynthEngine.h"
+#include "CCDispatch.h"
+#include <chrono>
+#include <random>
+#include <vector>
+
+static SynthEngine* synth;
+
+struct Msg { uint8_t cc, value; };
+
+// Mostly one knob at a time; each move is a run of adjacent values with
+// the odd resend, a 14-bit controller prefixes its MSB with CC 20
+static std::vector<Msg> session() {
+    static const uint8_t kKnobs[] = {
+        CC::FILTER_CUTOFF, CC::FILTER_RESONANCE, 1 /* mod wheel */, CC::LFO1_FREQ,
+        CC::LFO1_PITCH_DEPTH, CC::OSC_MIX_BALANCE, CC::AMP_ATTACK, CC::FX_REVERB_SIZE,
+        CC::OSC1_WAVE, CC::GLIDE_TIME,
+    };
+    std::mt19937 rng(11);
+    std::vector<Msg> s;
+    uint8_t pos[128] = {};
+    for (int move = 0; move < 400; move++) {
+        const uint8_t cc   = kKnobs[rng() % sizeof(kKnobs)];
+        const bool    hi   = cc == CC::FILTER_CUTOFF && (rng() & 1);
+        const int     dir  = (rng() & 1) ? 1 : -1;
+        const int     len  = 4 + (int)(rng() % 40);
+        for (int i = 0; i < len; i++) {
+            const int v = std::min(127, std::max(0, pos[cc] + dir * (int)(rng() % 3)));
+            pos[cc] = (uint8_t)v;
+            if (hi) s.push_back({ CC::HIRES_LSB, (uint8_t)(rng() & 0x7F) });
+            s.push_back({ cc, pos[cc] });
+        }
+    }
+    return s;
+}
+
+static void testSessionCost() {
+    printf("Knob session through handleControlChange, ns per CC on this host\n");
+    const auto s = session();
+    CCDispatch::resetStats();
+    const auto& st = CCDispatch::stats();
+    std::vector<double> ns(128, 0.0);
+    std::vector<unsigned> n(128, 0);
+    double nsApplied = 0.0, nsSuppressed = 0.0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (const auto& m : s) {
+        const uint32_t sup = st.suppressed;
+        const auto a = std::chrono::steady_clock::now();
+        synth->handleControlChange(1, m.cc, m.value);
+        const double t = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - a).count();
+        ns[m.cc] += t;
+        n[m.cc]++;
+        if (m.cc == CC::HIRES_LSB) continue;
+        (st.suppressed != sup ? nsSuppressed : nsApplied) += t;
+    }
+    const double total = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+    printf("  %zu messages: %u CCs, %u applied, %u suppressed, %u 14-bit; %.0f ns per message\n",
+           s.size(), (unsigned)st.received, (unsigned)st.applied, (unsigned)st.suppressed,
+           (unsigned)st.hires, total / s.size());
+    printf("  applied %.0f ns each, suppressed %.0f ns each\n",
+           nsApplied / st.applied, nsSuppressed / st.suppressed);
+    for (unsigned cc = 0; cc < 128; cc++) {
+        if (!n[cc]) continue;
+        const char* name = cc == 1 ? "Mod Wheel" : CC::name(cc) ? CC::name(cc) : "-";
+        printf("  CC %3u %-14s %5u sent, %6.0f ns each\n", cc, name, n[cc], ns[cc] / n[cc]);
+    }
+    CHECK(st.applied + st.suppressed == st.received);
+    CHECK(st.suppressed > 0);
+    CHECK(st.hires > 0);
+}
+
+static void testRepeatSuppressed() {
+    printf("A repeated value is suppressed\n");
+    synth->handleControlChange(1, CC::FILTER_RESONANCE, 40);
+    CCDispatch::resetStats();
+    synth->handleControlChange(1, CC::FILTER_RESONANCE, 40);
+    synth->handleControlChange(1, CC::FILTER_RESONANCE, 40);
+    CHECK(CCDispatch::stats().suppressed == 2);
+    CHECK(CCDispatch::stats().applied == 0);
+    synth->handleControlChange(1, CC::FILTER_RESONANCE, 41);
+    CHECK(CCDispatch::stats().applied == 1);
+    CHECK(synth->getCC(CC::FILTER_RESONANCE) == 41);
+}
+
+static void testHiresPairing() {
+    printf("HIRES_LSB pairs with the next non-Raw CC only\n");
+    synth->handleControlChange(1, CC::FILTER_CUTOFF, 64);
+    const float coarse = synth->getFilterCutoff();
+
+    // LSB + MSB: a 14-bit value, between the 7-bit steps
+    CCDispatch::resetStats();
+    synth->handleControlChange(1, CC::HIRES_LSB, 100);
+    CHECK(CCDispatch::stats().received == 0);            // The prefix is not a CC of its own
+    synth->handleControlChange(1, CC::FILTER_CUTOFF, 64);
+    const float fine = synth->getFilterCutoff();
+    synth->handleControlChange(1, CC::FILTER_CUTOFF, 65);
+    const float next = synth->getFilterCutoff();
+    printf("  cutoff 64 → %.1f Hz, 64+100/128 → %.1f Hz, 65 → %.1f Hz\n", coarse, fine, next);
+    CHECK(CCDispatch::stats().hires == 1);               // Consumed by the first MSB
+    CHECK(fine > coarse && fine < next);
+
+    // Same MSB with another LSB is a different value, not a repeat
+    synth->handleControlChange(1, CC::HIRES_LSB, 10);
+    synth->handleControlChange(1, CC::FILTER_CUTOFF, 65);
+    CHECK(CCDispatch::stats().hires == 2);
+    CHECK(synth->getFilterCutoff() < next);
+
+    // A Raw-curve CC takes its 7-bit value and drops the LSB
+    synth->handleControlChange(1, CC::HIRES_LSB, 100);
+    synth->handleControlChange(1, CC::OSC1_WAVE, 10);
+    synth->handleControlChange(1, CC::FILTER_CUTOFF, 64);
+    CHECK(CCDispatch::stats().hires == 2);
+    CHECK(synth->getFilterCutoff() == coarse);
+}
+
+static void testLinkInvalidates() {
+    printf("Applying a CC re-arms the others of its link group\n");
+    // OSC1_MIX and OSC_MIX_BALANCE both write osc 1's level
+    synth->handleControlChange(1, CC::OSC1_MIX, 100);
+    const float mix = synth->getOscMix1();
+    synth->handleControlChange(1, CC::OSC_MIX_BALANCE, 127);
+    CHECK(synth->getOscMix1() != mix);
+    CCDispatch::resetStats();
+    synth->handleControlChange(1, CC::OSC1_MIX, 100);     // Same value, but stale now
+    CHECK(CCDispatch::stats().applied == 1);
+    CHECK(synth->getOscMix1() == mix);
+
+    // Mod wheel and LFO1_FREQ both set LFO 1's rate
+    synth->handleControlChange(1, CC::LFO1_FREQ, 30);
+    const float rate = synth->getLFO1Frequency();
+    synth->handleControlChange(1, 1, 120);
+    CHECK(synth->getLFO1Frequency() != rate);
+    synth->handleControlChange(1, CC::LFO1_FREQ, 30);
+    CHECK(synth->getLFO1Frequency() == rate);
+
+    // Outside a group a repeat stays suppressed
+    synth->handleControlChange(1, CC::FILTER_RESONANCE, 50);
+    synth->handleControlChange(1, CC::OSC_MIX_BALANCE, 0);
+    CCDispatch::resetStats();
+    synth->handleControlChange(1, CC::FILTER_RESONANCE, 50);
+    CHECK(CCDispatch::stats().suppressed == 1);
+}
+
+int main() {
+    static SynthEngine engine;
+    synth = &engine;
+    testSessionCost();
+    testRepeatSuppressed();
+    testHiresPairing();
+    testLinkInvalidates();
+    HOST_TEST_END();
+}
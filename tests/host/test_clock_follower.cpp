@@ -0,0 +1,145 @@
+// BPMClockManager clock follower: DLL jitter rejection and settling on a
+// simulated MIDI clock, and song-position resolution over a long session.
+#include "host_test.h"
+#include "BPMClockManager.h"
+
+// Deterministic uniform jitter in [-amp, +amp] µs
+static uint32_t lcg = 12345;
+static double jitter(double amp) {
+    lcg = lcg * 1664525u + 1013904223u;
+    return ((double)(lcg >> 8) / 16777216.0 * 2.0 - 1.0) * amp;
+}
+
+// Feed 'count' ticks at 'bpm' starting at ideal time *t (µs, double),
+// each stamped with ±jitterUs.  Calls probe(tickIndex, idealUs) after each.
+template <class Probe>
+static void feed(BPMClockManager& clk, double& t, uint32_t& n, double bpm,
+                 uint32_t count, double jitterUs, Probe probe) {
+    const double tickUs = 60000000.0 / (bpm * MIDI_CLOCK_PPQN);
+    for (uint32_t i = 0; i < count; i++) {
+        hostMicros = (uint32_t)(uint64_t)(t + jitter(jitterUs));
+        clk.handleMIDIClock();
+        probe(n, t);
+        n++;
+        t += tickUs;
+    }
+}
+
+static void testJitterRejection() {
+    printf("DLL jitter rejection (120 BPM, +/-320 us stamps)\n");
+    BPMClockManager clk;
+    clk.setClockSource(CLOCK_EXTERNAL_MIDI);
+    hostMicros = 1000;
+    clk.handleMIDIStart();
+
+    double t = 2000.0; uint32_t n = 0;
+    const double tickUs = 60000000.0 / (120.0 * MIDI_CLOCK_PPQN);
+    double maxBpmErr = 0.0, maxPosErrUs = 0.0, sumSq = 0.0;
+    uint32_t count = 0;
+
+    // 5 s to settle, then measure for 20 s
+    feed(clk, t, n, 120.0, 240, 320.0, [](uint32_t, double) {});
+    feed(clk, t, n, 120.0, 960, 320.0, [&](uint32_t tick, double ideal) {
+        maxBpmErr = std::max(maxBpmErr, fabs(clk.getCurrentBPM() - 120.0));
+        // Position the audio thread would read half a tick after the ideal time
+        const double at = ideal + tickUs * 0.5;
+        const ClockSnapshot s = clk.getSnapshot();
+        const double pos = (double)s.anchorTick + s.ticksAt((uint32_t)(uint64_t)at);
+        const double errUs = (pos - (tick + 0.5)) * tickUs;
+        maxPosErrUs = std::max(maxPosErrUs, fabs(errUs));
+        sumSq += errUs * errUs;
+        count++;
+    });
+    const double rmsUs = sqrt(sumSq / count);
+    printf("  tempo error max %.4f BPM, position error rms %.1f us, max %.1f us\n",
+           maxBpmErr, rmsUs, maxPosErrUs);
+    CHECK(maxBpmErr < 0.1);
+    CHECK(rmsUs < 320.0 / sqrt(3.0) * 0.5);   // At least halves the raw stamp jitter
+    CHECK(maxPosErrUs < 320.0);
+}
+
+static void testTempoStepSettling() {
+    printf("DLL settling (120 -> 140 BPM step)\n");
+    BPMClockManager clk;
+    clk.setClockSource(CLOCK_EXTERNAL_MIDI);
+    hostMicros = 1000;
+    clk.handleMIDIStart();
+
+    double t = 2000.0; uint32_t n = 0;
+    feed(clk, t, n, 120.0, 480, 0.0, [](uint32_t, double) {});
+
+    // Settled = within 0.5 BPM and staying there
+    const double stepAt = t;
+    double settledAt = -1.0, peak = 0.0;
+    feed(clk, t, n, 140.0, 24 * 20, 50.0, [&](uint32_t, double ideal) {
+        const double err = fabs(clk.getCurrentBPM() - 140.0);
+        peak = std::max(peak, (double)clk.getCurrentBPM());
+        if (err < 0.5) { if (settledAt < 0.0) settledAt = ideal; }
+        else settledAt = -1.0;
+    });
+    const double settleS = settledAt < 0.0 ? 1e9 : (settledAt - stepAt) * 1e-6;
+    printf("  settled in %.2f s, peak %.2f BPM\n", settleS, peak);
+    CHECK(settleS < 2.0);
+    CHECK(peak < 146.0);
+}
+
+static void testDropoutRecovers() {
+    printf("DLL restarts after a clock dropout\n");
+    BPMClockManager clk;
+    clk.setClockSource(CLOCK_EXTERNAL_MIDI);
+    hostMicros = 1000;
+    clk.handleMIDIStart();
+    double t = 2000.0; uint32_t n = 0;
+    feed(clk, t, n, 120.0, 240, 0.0, [](uint32_t, double) {});
+    t += 2000000.0;   // 2 s of silence, then the same tempo resumes
+    feed(clk, t, n, 120.0, 48, 0.0, [](uint32_t, double) {});
+    CHECK_NEAR(clk.getCurrentBPM(), 120.0, 0.1);
+}
+
+// Phase of a synced LFO computed from the snapshot, against the exact
+// value, hours into a song — the float beat position this replaced had
+// ~0.2 tick resolution at 10 h and 120 BPM.
+static void testLongSessionPhase() {
+    printf("Song position resolution over 10 h (internal clock)\n");
+    hostMicros = 0;
+    BPMClockManager clk;
+    clk.setInternalBPM(120.0f);
+
+    const uint32_t stepUs = 10000;
+    const uint32_t steps  = 10u * 3600u * 100u;   // 10 h in 10 ms loop passes
+    for (uint32_t i = 0; i < steps; i++) {
+        hostMicros += stepUs;                     // Wraps after 71 min
+        clk.update();
+    }
+
+    // Consecutive reads one audio block apart must advance by the slope
+    const ClockSnapshot s = clk.getSnapshot();
+    const uint32_t tpc = 96;                      // One bar
+    const uint32_t blockUs = 2902;
+    double maxErr = 0.0;
+    for (uint32_t k = 0; k < 200; k++) {
+        const uint32_t a = hostMicros + k * blockUs;
+        const uint32_t p0 = s.phaseAt(a, tpc);
+        const uint32_t p1 = s.phaseAt(a + blockUs, tpc);
+        const double got  = (double)(uint32_t)(p1 - p0) / 4294967296.0;
+        const double want = (double)s.ticksPerUs * blockUs / tpc;
+        maxErr = std::max(maxErr, fabs(got - want));
+    }
+    printf("  whole ticks %lu, per-block phase step error max %.2e cycles\n",
+           (unsigned long)s.anchorTick, maxErr);
+    CHECK(s.anchorTick > 24u * 120u * 60u * 9u);
+    CHECK(maxErr < 1.0e-5);
+
+    // Phase at the anchor is exact: whole ticks wrap in integers
+    const uint32_t p = s.phaseAt(s.anchorUs, tpc);
+    const double want = fmod((double)(s.anchorTick % tpc) + s.anchorFrac, tpc) / tpc;
+    CHECK_NEAR((double)p / 4294967296.0, want, 1.0e-6);
+}
+
+int main() {
+    testJitterRejection();
+    testTempoStepSettling();
+    testDropoutRecovers();
+    testLongSessionPhase();
+    HOST_TEST_END();
+}
@@ -0,0 +1,196 @@
+// MIDIClockMaster: ticks scheduled by _schedule() off a simulated sample
+// clock, sent by _service() from a simulated 25 us timer, checked against
+// the ideal sample-exact tick grid.
+#include "host_test.h"
+#include "MIDIClockMaster.h"
+
+static const double kBlockUs = AUDIO_BLOCK_SAMPLES * 1000000.0 / AUDIO_SAMPLE_RATE_EXACT;
+
+// Audio blocks at exact sample-clock times, the send timer on its own grid;
+// events run in time order the way the two interrupts would.
+struct Sim {
+    MIDIClockMaster clk;
+    HardwareSerial  din;
+    double   nextBlock = 10000.0;
+    double   nextTimer = 10000.0;
+    uint32_t lastBlockUs = 0;
+
+    Sim() {
+        usbMIDI.clear();
+        hostTimerFn = nullptr;
+        clk.begin(&din, true);
+    }
+
+    // Run until 'untilUs'; clk.poll() stands in for loop() between events
+    void run(double untilUs) {
+        while (nextBlock < untilUs || nextTimer < untilUs) {
+            if (nextBlock <= nextTimer) {
+                lastBlockUs = hostMicros = (uint32_t)llround(nextBlock);
+                clk.update();
+                nextBlock += kBlockUs;
+            } else {
+                hostMicros = (uint32_t)llround(nextTimer);
+                hostInTimerISR = true;
+                if (hostTimerFn) hostTimerFn();
+                hostInTimerISR = false;
+                nextTimer += MIDI_CLOCK_TIMER_US;
+            }
+            clk.poll();
+        }
+    }
+
+    // Stamps of every usbMIDI byte equal to 'status', from index 'from'
+    std::vector<uint32_t> sent(uint8_t status, size_t from = 0) const {
+        std::vector<uint32_t> v;
+        for (size_t i = from; i < usbMIDI.bytes.size(); i++)
+            if (usbMIDI.bytes[i] == status) v.push_back(usbMIDI.stamps[i]);
+        return v;
+    }
+};
+
+static double tickUsAt(double bpm) {
+    // Tick grid in samples, as _schedule() counts it, converted to µs
+    return (AUDIO_SAMPLE_RATE_EXACT * 60.0 / bpm / MIDI_CLOCK_PPQN) * 1000000.0 / AUDIO_SAMPLE_RATE_EXACT;
+}
+
+static void testTickGrid() {
+    printf("Tick timing at 120 BPM against the sample grid\n");
+    Sim sim;
+    sim.clk.setBPM(120.0f);
+    sim.clk.start();
+    sim.run(10001.0);      // First block picks up the start request
+    const uint32_t startBase = sim.lastBlockUs + MIDI_CLOCK_OUT_LEAD_US;
+    sim.run(10020000.0);   // 10 s
+
+    CHECK(!usbMIDI.bytes.empty() && usbMIDI.bytes[0] == 0xFA);
+    const auto ticks = sim.sent(0xF8);
+    const double tickUs = tickUsAt(120.0);
+    printf("  %zu ticks in 10 s\n", ticks.size());
+    CHECK(ticks.size() >= 480 && ticks.size() <= 482);
+
+    // Each tick leaves within one timer period (+1 us of block-time rounding)
+    // of its ideal time, never early.
+    double worstLate = 0.0, worstEarly = 0.0, worstJitter = 0.0;
+    for (size_t n = 0; n < ticks.size(); n++) {
+        const double ideal = startBase + n * tickUs;
+        const double err   = (double)ticks[n] - ideal;
+        worstLate  = std::max(worstLate, err);
+        worstEarly = std::min(worstEarly, err);
+        if (n) worstJitter = std::max(worstJitter, fabs((double)(ticks[n] - ticks[n - 1]) - tickUs));
+    }
+    printf("  late max %.1f us, early max %.1f us, interval jitter max %.1f us\n",
+           worstLate, -worstEarly, worstJitter);
+    CHECK(worstLate <= MIDI_CLOCK_TIMER_US + 1.0);
+    CHECK(worstEarly >= -1.0);
+    CHECK(worstJitter <= MIDI_CLOCK_TIMER_US + 2.0);
+
+    // DIN carries the same byte stream
+    CHECK(sim.din.written == std::string(usbMIDI.bytes.begin(), usbMIDI.bytes.end()));
+}
+
+static void testTempoChange() {
+    printf("Tempo change takes effect at the next block\n");
+    Sim sim;
+    sim.clk.setBPM(120.0f);
+    sim.clk.start();
+    sim.run(2000000.0);
+    sim.clk.setBPM(173.0f);
+    const size_t mark = usbMIDI.bytes.size();
+    sim.run(6000000.0);
+
+    // Skip ticks already queued under the old tempo
+    const auto ticks = sim.sent(0xF8, mark);
+    const double tickUs = tickUsAt(173.0);
+    double worst = 0.0;
+    for (size_t n = 3; n < ticks.size(); n++)
+        worst = std::max(worst, fabs((double)(ticks[n] - ticks[n - 1]) - tickUs));
+    printf("  interval error max %.1f us at %.1f us/tick\n", worst, tickUs);
+    CHECK(worst <= MIDI_CLOCK_TIMER_US + 2.0);
+
+    uint32_t us, tick; float frac, ticksPerUs;
+    sim.clk.getPosition(us, tick, frac, ticksPerUs);
+    CHECK_NEAR(ticksPerUs, 1.0 / tickUs, 1.0e-9);
+    CHECK(frac >= 0.0f && frac < 1.0f);
+}
+
+static void testStop() {
+    printf("Stop sends 0xFC and no further ticks; timer idles\n");
+    Sim sim;
+    sim.clk.start();
+    sim.run(1000000.0);
+    sim.clk.stop();
+    sim.run(1010000.0);
+    const auto stops = sim.sent(0xFC);
+    CHECK(stops.size() == 1);
+    const size_t ticksAtStop = sim.sent(0xF8).size();
+    sim.run(2000000.0);
+    CHECK(sim.sent(0xF8).size() == ticksAtStop);
+    CHECK(!sim.clk.isRunning());
+    CHECK(hostTimerFn == nullptr);
+}
+
+// Upload ACKs while the clock runs at 300 BPM: every usbMIDI write comes
+// from the timer ISR, each reply arrives whole, and ticks stay on time.
+static void testSysExSingleWriter() {
+    printf("SysEx replies share the timer ISR with the clock\n");
+    Sim sim;
+    sim.clk.setBPM(300.0f);
+    sim.clk.start();
+    sim.run(10001.0);
+    const uint32_t startBase = sim.lastBlockUs + MIDI_CLOCK_OUT_LEAD_US;
+
+    uint8_t ack[] = { 0xF0, 0x7D, 0x4A, 0x54, 0x7F, 0x02, 0x00, 0x00, 0x00, 0xF7 };
+    unsigned queued = 0;
+    for (double t = 20000.0; t < 2000000.0; t += 1700.0) {   // Off the tick grid
+        sim.run(t);
+        ack[6] = (uint8_t)(queued & 0x7F);
+        if (sim.clk.sendSysEx(ack, sizeof(ack))) queued++;
+    }
+    sim.run(2010000.0);
+
+    CHECK(usbMIDI.outsideTimer == 0);
+
+    // Every reply contiguous and in order
+    unsigned found = 0;
+    for (size_t i = 0; i + sizeof(ack) <= usbMIDI.bytes.size(); i++) {
+        if (usbMIDI.bytes[i] != 0xF0) continue;
+        bool whole = usbMIDI.bytes[i + 9] == 0xF7 && usbMIDI.bytes[i + 6] == (found & 0x7F);
+        for (size_t k = 1; k < 9; k++) whole = whole && usbMIDI.bytes[i + k] < 0x80;
+        CHECK(whole);
+        found++;
+    }
+    printf("  %u replies queued, %u sent whole\n", queued, found);
+    CHECK(queued > 1000 && found == queued);
+
+    const auto ticks = sim.sent(0xF8);
+    const double tickUs = tickUsAt(300.0);
+    double worstLate = 0.0;
+    for (size_t n = 0; n < ticks.size(); n++)
+        worstLate = std::max(worstLate, (double)ticks[n] - (startBase + n * tickUs));
+    CHECK(worstLate <= MIDI_CLOCK_TIMER_US + 1.0);
+
+    // Over-long messages are refused rather than truncated
+    uint8_t big[MIDI_CLOCK_SYSEX_MAX + 1] = { 0xF0 };
+    CHECK(!sim.clk.sendSysEx(big, sizeof(big)));
+}
+
+static void testSysExWakesTimer() {
+    printf("SysEx reply with the clock stopped still goes out\n");
+    Sim sim;
+    const uint8_t ack[] = { 0xF0, 0x7D, 0x4A, 0x54, 0x7F, 0x01, 0x00, 0x00, 0x00, 0xF7 };
+    CHECK(hostTimerFn == nullptr);
+    CHECK(sim.clk.sendSysEx(ack, sizeof(ack)));
+    sim.run(10100.0);
+    CHECK(usbMIDI.bytes.size() == sizeof(ack));
+    CHECK(usbMIDI.outsideTimer == 0);
+    CHECK(hostTimerFn == nullptr);   // Idle again once drained
+}
+
+int main() {
+    testTickGrid();
+    testTempoChange();
+    testStop();
+    testSysExSingleWriter();
+    testSysExWakesTimer();
+    HOST_TEST_END();
+}
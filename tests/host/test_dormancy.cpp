@@ -0,0 +1,296 @@
+// AudioDormancy: linking a cord or wiring a leased engine never wakes a
+// parked node; only setActive() does.  Then, on the whole engine: every
+// built-in preset with the nodes it parks and the update() calls that saves
+// (per block and per second), checked against the count the engine reports;
+// every audio cycle (stubs/Audio.h hostAudioIsr) sees each parked node with
+// its input cords unlinked and each live one fully patched, including while
+// knobs wake and park nodes; and a woken LFO fade stage resumes in phase
+// with one that never slept.
+#include "host_test.h"
+#include "AudioDormancy.h"
+#include "SynthEngine.h"
+#include "Presets.h"
+#include "SupersawPool.h"
+#include <vector>
+
+using namespace Presets;
+
+struct Node : AudioStream {
+    audio_block_t* q[1];
+    Node() : AudioStream(1, q) {}
+    void update() override {}
+};
+
+static void testStockConnectWakes() {
+    printf("Stock AudioConnection::connect() wakes both ends (the hazard)\n");
+    Node a, b;
+    AudioDormancy::setActive(a, false);
+    AudioDormancy::setActive(b, false);
+    AudioConnection cord;
+    cord.connect(a, 0, b, 0);
+    CHECK(AudioDormancy::isActive(a) && AudioDormancy::isActive(b));
+}
+
+static void testLinkKeepsParked() {
+    printf("link(): re-linking a cord into a parked node leaves it parked\n");
+    Node osc, ring;
+    AudioConnection* cord = new AudioConnection(osc, 0, ring, 0);
+    bool linked = true;
+
+    AudioDormancy::link(cord, linked, false);
+    AudioDormancy::setActive(ring, false);
+    CHECK(!linked && !cord->connected());
+
+    AudioDormancy::link(cord, linked, true);
+    CHECK(linked && cord->connected());
+    CHECK(AudioDormancy::isActive(osc));
+    CHECK(!AudioDormancy::isActive(ring));
+
+    // Parked source stays parked too
+    AudioDormancy::link(cord, linked, false);
+    AudioDormancy::setActive(osc, false);
+    AudioDormancy::setActive(ring, true);
+    AudioDormancy::link(cord, linked, true);
+    CHECK(!AudioDormancy::isActive(osc) && AudioDormancy::isActive(ring));
+
+    // No state change: nothing touched
+    AudioDormancy::link(cord, linked, true);
+    CHECK(!AudioDormancy::isActive(osc));
+    AudioDormancy::link(nullptr, linked, false);
+    CHECK(linked);
+    delete cord;
+}
+
+// OscillatorBlock::_leaseSupersaw(): engine from the pool (parked) wired to
+// the output mixer and to a comb parked because feedback is off
+static void testLeaseConnectKeepsParked() {
+    printf("connect(): leased engine and parked comb stay parked until applied\n");
+    Node engine, outputMix, combMixer;
+    AudioDormancy::setActive(engine, false);
+    AudioDormancy::setActive(combMixer, false);
+    AudioConnection toOut, toComb;
+    AudioDormancy::connect(toOut,  engine, 0, outputMix, 1);
+    AudioDormancy::connect(toComb, engine, 0, combMixer, 1);
+    CHECK(toOut.connected() && toComb.connected());
+    CHECK(!AudioDormancy::isActive(engine));
+    CHECK(!AudioDormancy::isActive(combMixer));
+    CHECK(AudioDormancy::isActive(outputMix));
+}
+
+// ---- Whole engine ------------------------------------------------------------
+
+static SynthEngine* synth;
+
+static unsigned parkedNodes() {
+    unsigned n = 0;
+    for (AudioStream* s : hostAudioStreams()) n += !AudioDormancy::isActive(*s);
+    return n;
+}
+
+// What one audio cycle sees.  A live source linked into a parked node
+// queues a block nobody takes; a cord left unlinked between two live nodes
+// is a half-patched cycle (e.g. an oscillator woken before its FM cord).
+struct CycleCheck {
+    unsigned cycles = 0, queued = 0, halfPatched = 0;
+    bool     on = false;
+};
+static CycleCheck cycleCheck;
+
+static void audioIsr() {
+    hostAudioUpdate();
+    if (!cycleCheck.on) return;
+    cycleCheck.cycles++;
+    for (AudioConnection* c : hostAudioCords()) {
+        if (!c->source() || !c->destination()) continue;
+        const bool srcOn = AudioDormancy::isActive(*c->source());
+        const bool dstOn = AudioDormancy::isActive(*c->destination());
+        if (c->connected()  && srcOn && !dstOn) cycleCheck.queued++;
+        if (!c->connected() && srcOn && dstOn)  cycleCheck.halfPatched++;
+    }
+}
+
+// One loop pass and the audio cycle after it; the clock advances a block
+static void pass() {
+    synth->update();
+    audioIsr();
+    hostMicros += (uint32_t)(1e6f * AUDIO_BLOCK_SAMPLES / AUDIO_SAMPLE_RATE_EXACT);
+}
+
+static void testPresetsParkNodes() {
+    printf("Built-in presets: nodes parked, update() calls saved (%zu objects)\n",
+           hostAudioStreams().size());
+    const float blocksPerSec = AUDIO_SAMPLE_RATE_EXACT / AUDIO_BLOCK_SAMPLES;
+    const unsigned settle = (unsigned)(blocksPerSec * (PRESET_CPU_WINDOW_MS + 500) / 1000.0f);
+
+    cycleCheck = CycleCheck{};
+    cycleCheck.on = true;
+    unsigned mismatched = 0, sumParked = 0, minParked = ~0u, maxParked = 0;
+    for (int p = 0; p < presets_totalCount(); p++) {
+        presets_loadByGlobalIndex(*synth, p);
+        // Swap, crossfade back up, then the engine's CPU window closes
+        for (unsigned n = 0; n < settle + 2000 && synth->presetChangePending(); n++) pass();
+        for (unsigned n = 0; n < settle; n++) pass();
+
+        const unsigned parked = parkedNodes();
+        const unsigned calls  = hostAudioUpdate();
+        CHECK(calls + parked == hostAudioStreams().size());
+
+        // The engine's figure leaves out engines idle in the supersaw pool
+        const auto pool = SupersawPool::stats();
+        const unsigned reported = synth->presetStats().dormantNodes + (pool.created - pool.leased);
+        mismatched += reported != parked;
+
+        sumParked += parked;
+        minParked = std::min(minParked, parked);
+        maxParked = std::max(maxParked, parked);
+        printf("  %-24s %3u parked, %3u update() calls per block, %6.0f saved per second%s\n",
+               presets_nameByGlobalIndex(p), parked, calls, parked * blocksPerSec,
+               reported != parked ? "  (engine reports a different count)" : "");
+    }
+    cycleCheck.on = false;
+    const int n = presets_totalCount();
+    printf("  parked %u..%u, mean %.1f of %zu objects: %.0f update() calls saved per second\n",
+           minParked, maxParked, (double)sumParked / n, hostAudioStreams().size(),
+           sumParked * blocksPerSec / n);
+    printf("  %u audio cycles: %u blocks queued into a parked node, %u half-patched cords\n",
+           cycleCheck.cycles, cycleCheck.queued, cycleCheck.halfPatched);
+    CHECK(mismatched == 0);
+    CHECK(minParked > 0);
+    CHECK(cycleCheck.queued == 0);
+    CHECK(cycleCheck.halfPatched == 0);
+}
+
+// Knobs crossing zero and notes leasing supersaws: every node that wakes
+// comes back with its cords in the same cycle, every node that parks goes
+// with them
+static void testWakeWholeCycle() {
+    printf("Waking and parking under knob moves: every cycle fully patched\n");
+    presets_loadByGlobalIndex(*synth, 0);
+    for (int n = 0; n < 2000 && synth->presetChangePending(); n++) pass();
+
+    cycleCheck = CycleCheck{};
+    cycleCheck.on = true;
+    const unsigned parked0 = parkedNodes();
+    unsigned woke = 0, parkedAgain = 0;
+    for (int round = 0; round < 4; round++) {
+        const float on = (round & 1) ? 0.0f : 0.6f;
+        const unsigned before = parkedNodes();
+        synth->setOsc2Mix(on);
+        synth->setRing1Mix(on);
+        synth->setRing2Mix(on);
+        synth->setNoiseMix(on);
+        synth->setSubMix(on);
+        synth->setPitchEnvDepth(on * 12.0f);
+        synth->setLFO1AmpDepth(on);
+        synth->setOsc1FeedbackAmount(on);
+        synth->setOsc1FeedbackMix(on);
+        synth->setOsc1Waveform(round < 2 ? WAVEFORM_SUPERSAW : WAVEFORM_SAWTOOTH);
+        synth->noteOn(60, 0.8f);
+        synth->noteOn(64, 0.8f);
+        for (int n = 0; n < 20; n++) pass();
+        synth->noteOff(60);
+        synth->noteOff(64);
+        for (int n = 0; n < 400; n++) pass();
+        const unsigned after = parkedNodes();
+        (on != 0.0f ? woke : parkedAgain) += on != 0.0f ? before - std::min(before, after)
+                                                        : after - std::min(after, before);
+    }
+    cycleCheck.on = false;
+    printf("  %u cycles, %u nodes woken, %u parked again (from %u parked): "
+           "%u blocks queued into a parked node, %u half-patched cords\n",
+           cycleCheck.cycles, woke, parkedAgain, parked0, cycleCheck.queued, cycleCheck.halfPatched);
+    CHECK(woke > 0 && parkedAgain > 0);
+    CHECK(cycleCheck.queued == 0);
+    CHECK(cycleCheck.halfPatched == 0);
+}
+
+// ---- LFO fade stage ----------------------------------------------------------
+
+// One library cycle over an LFOBlock: generator, then the fade stage if it
+// runs and its cord is linked
+static const int16_t* lfoCycle(LFOBlock& lfo) {
+    auto& gen  = const_cast<AudioSynthLFO&>(lfo.generator());
+    auto& fade = lfo.output();
+    gen.sent.clear();
+    fade.sent.clear();
+    gen.update();
+    bool linked = false;
+    for (AudioConnection* c : hostAudioCords()) linked |= c->source() == &gen && c->destination() == &fade && c->connected();
+    if (!AudioDormancy::isActive(fade)) return nullptr;
+    if (linked && !gen.sent.empty()) fade.feed(0, &gen.sent[0].second);
+    fade.update();
+    return fade.sent.empty() ? nullptr : fade.sent[0].second.data;
+}
+
+static void testFadeWakesInPhase() {
+    printf("LFO fade stage woken after 37 blocks: in phase, no step\n");
+    LFOBlock slept, awake;
+    for (LFOBlock* l : { &slept, &awake }) {
+        l->setWaveformType(WAVEFORM_SINE);
+        l->setFrequency(3.0f);
+        l->setAmplitude(1.0f);
+        l->update();
+    }
+
+    // Both running; largest sample-to-sample step of the sine
+    int maxStep = 0, prev = 0;
+    for (int b = 0; b < 40; b++) {
+        lfoCycle(slept);
+        const int16_t* a = lfoCycle(awake);
+        for (int i = 0; a && i < AUDIO_BLOCK_SAMPLES; i++) {
+            if (b || i) maxStep = std::max(maxStep, abs(a[i] - prev));
+            prev = a[i];
+        }
+    }
+
+    // Park one of them for 37 blocks
+    unsigned differ = 0;
+    int wakeStep = 0, last = 0;
+    slept.setFadeActive(false);
+    for (int b = 0; b < 37; b++) {
+        CHECK(lfoCycle(slept) == nullptr);
+        last = lfoCycle(awake)[AUDIO_BLOCK_SAMPLES - 1];
+    }
+    slept.setFadeActive(true);
+    for (int b = 0; b < 20; b++) {
+        const int16_t* s = lfoCycle(slept);
+        const int16_t* a = lfoCycle(awake);
+        CHECK(s && a);
+        if (!s || !a) return;
+        differ += memcmp(s, a, sizeof(audio_block_t::data)) != 0;
+        if (b == 0) wakeStep = abs(s[0] - last);
+    }
+    printf("  first woken sample steps %d from the last one the awake stage sent "
+           "(sine steps up to %d); %u of 20 blocks differ\n", wakeStep, maxStep, differ);
+    CHECK(differ == 0);
+    CHECK(wakeStep <= maxStep);
+
+    // A retrigger while parked: the ramp starts from silence on waking
+    slept.setDelayTime(100.0f);
+    slept.setFadeActive(false);
+    lfoCycle(slept);
+    slept.retrigger();
+    lfoCycle(slept);
+    slept.setFadeActive(true);
+    const int16_t* s = lfoCycle(slept);
+    CHECK(s != nullptr);
+    if (s) {
+        printf("  retriggered while parked: first woken sample %d\n", s[0]);
+        CHECK(s[0] == 0);
+    }
+}
+
+int main() {
+    testStockConnectWakes();
+    testLinkKeepsParked();
+    testLeaseConnectKeepsParked();
+
+    static SynthEngine engine;
+    synth = &engine;
+    hostAudioIsr = audioIsr;
+    testPresetsParkNodes();
+    testWakeWholeCycle();
+    hostAudioIsr = nullptr;
+    testFadeWakesInPhase();
+    HOST_TEST_END();
+}
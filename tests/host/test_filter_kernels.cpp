@@ -0,0 +1,165 @@
+// OB-Xa filter kernels: every specialised _kernel<F> in kKernels gives the
+// same output, bit for bit, as OBXA_FEAT_GENERIC (the run-time branching
+// loop the kernels replaced) under parameter changes between blocks, with
+// and without a resonance mod block (per-block setResonance), and through a
+// state-guard trip (the removed per-sample anomaly scan fed nothing; the
+// guard alone resets and mutes).  Then loads every built-in preset into the
+// engine and times voice 0's filter with its kernel against the generic
+// one: ns per block on this host and the saving.
+#include "host_test.h"
+#include "SynthEngine.h"
+#include "Presets.h"
+#include "AudioFilterOBXa_OBXf.h"
+#include <chrono>
+#include <vector>
+
+using namespace Presets;
+
+// Voice-like inputs: saw on mix input 0, a sweep on the cutoff bus, a
+// faster wobble on the resonance bus
+struct Inputs {
+    audio_block_t saw, cut, res;
+    uint32_t n0 = 0;
+    void render() {
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+            const double t = (double)(n0 + i) / AUDIO_SAMPLE_RATE_EXACT;
+            saw.data[i] = (int16_t)lrint(16000.0 * (2.0 * fmod(110.0 * t, 1.0) - 1.0));
+            cut.data[i] = (int16_t)lrint(16000.0 * sin(2.0 * M_PI * 0.7 * t));
+            res.data[i] = (int16_t)lrint(20000.0 * sin(2.0 * M_PI * 5.0 * t));
+        }
+        n0 += AUDIO_BLOCK_SAMPLES;
+    }
+};
+
+static void feed(AudioFilterOBXa& f, Inputs& in, bool resBus) {
+    f.feed(0, &in.saw);
+    f.feed(1, &in.cut);
+    if (resBus) f.feed(2, &in.res);
+}
+
+// A filter set up for kernel mask 'm'
+static void configure(AudioFilterOBXa& f, uint8_t m) {
+    f.setTwoPole(m & OBXA_FEAT_TWO_POLE);
+    f.setXpander4Pole(m & OBXA_FEAT_XPANDER);
+    f.setBPBlend2Pole(m & OBXA_FEAT_BP_BLEND);
+    f.setPush2Pole(m & OBXA_FEAT_PUSH);
+    f.setResonanceModDepth((m & OBXA_FEAT_RES_MOD) ? 0.4f : 0.0f);
+    f.setCutoffModOctaves(2.0f);
+    f.setKeyTrack(0.5f);
+    f.setMidiNote(48.0f);
+    f.frequency(800.0f);
+    f.resonance(0.6f);
+}
+
+static void testKernelsMatchGeneric() {
+    printf("Each kernel == OBXA_FEAT_GENERIC, bit for bit\n");
+    const uint8_t masks[] = {
+        0, OBXA_FEAT_XPANDER, OBXA_FEAT_RES_MOD, OBXA_FEAT_XPANDER | OBXA_FEAT_RES_MOD,
+        OBXA_FEAT_TWO_POLE, OBXA_FEAT_TWO_POLE | OBXA_FEAT_BP_BLEND,
+        OBXA_FEAT_TWO_POLE | OBXA_FEAT_PUSH, OBXA_FEAT_TWO_POLE | OBXA_FEAT_RES_MOD,
+        OBXA_FEAT_TWO_POLE | OBXA_FEAT_BP_BLEND | OBXA_FEAT_PUSH,   // Generic either way
+    };
+    for (uint8_t m : masks) {
+        AudioFilterOBXa k, g;
+        configure(k, m);
+        configure(g, m);
+        g.forceGenericKernel(true);
+        CHECK(k.kernelFeatures() == m);
+        CHECK(!strcmp(g.kernelName(), "Generic"));
+
+        Inputs in;
+        unsigned differ = 0, trips = 0;
+        for (int b = 0; b < 600; b++) {
+            // Settings move between blocks as CCs would
+            if (b % 50 == 10) { k.resonance(b / 600.0f); g.resonance(b / 600.0f); }
+            if (b % 70 == 20) { k.multimode(b / 700.0f); g.multimode(b / 700.0f); }
+            if (b % 90 == 30) { k.setXpanderMode(b / 40); g.setXpanderMode(b / 40); }
+            if (b % 40 == 5)  { k.setEnvModOctaves(1.5f); g.setEnvModOctaves(1.5f);
+                                k.setEnvValue(b / 600.0f); g.setEnvValue(b / 600.0f); }
+            // Resonance bus present in stretches: after one, the next
+            // plain block must be back at the set resonance
+            const bool resBus = (b / 25) % 3 == 1;
+            // A runaway input: the state guard resets and mutes in both
+            const bool fault = b == 400;
+            if (fault)     { k.mixGain(0, 1e12f); g.mixGain(0, 1e12f); }
+            if (b == 401)  { k.mixGain(0, 1.0f);  g.mixGain(0, 1.0f); }
+
+            in.render();
+            feed(k, in, resBus);
+            feed(g, in, resBus);
+            k.sent.clear(); g.sent.clear();
+            k.update();
+            g.update();
+            const int16_t* a = k.sent[0].second.data;
+            const int16_t* c = g.sent[0].second.data;
+            differ += memcmp(a, c, sizeof(audio_block_t::data)) != 0;
+            if (fault) {
+                bool muted = true;
+                for (int i = AUDIO_BLOCK_SAMPLES - 8; i < AUDIO_BLOCK_SAMPLES; i++) muted &= a[i] == 0;
+                trips += muted;
+            }
+            if (b == 404) {
+                int peak = 0;
+                for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) peak = std::max(peak, abs((int)a[i]));
+                CHECK(peak > 0);   // Recovered after the cooldown
+            }
+        }
+        printf("  %-18s %u of 600 blocks differ, guard tripped: %s\n",
+               k.kernelName(), differ, trips ? "yes" : "no");
+        CHECK(differ == 0);
+        CHECK(trips == 1);
+    }
+}
+
+static double nsPerBlock(AudioFilterOBXa& f, unsigned blocks) {
+    Inputs in;
+    in.render();
+    const auto t0 = std::chrono::steady_clock::now();
+    for (unsigned b = 0; b < blocks; b++) {
+        feed(f, in, false);   // The voice graph leaves the resonance bus open
+        f.update();
+        f.sent.clear();
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / blocks;
+}
+
+static void benchPresets() {
+    printf("Built-in presets, voice 0 filter, ns per block on this host\n");
+    static SynthEngine synth;
+    AudioFilterOBXa* f = nullptr;
+    for (AudioStream* s : hostAudioStreams()) {
+        if ((f = dynamic_cast<AudioFilterOBXa*>(s))) break;
+    }
+    CHECK(f != nullptr);
+    if (!f) return;
+
+    double sumK = 0.0, sumG = 0.0;
+    unsigned specialised = 0;
+    for (int p = 0; p < presets_totalCount(); p++) {
+        presets_loadByGlobalIndex(synth, p);
+        for (int n = 0; n < 1000 && synth.presetChangePending(); n++) { synth.update(); hostAudioUpdate(); }
+
+        // Best of five alternating runs each, to keep host noise out
+        double k = 1e30, g = 1e30;
+        for (int r = 0; r < 5; r++) {
+            k = std::min(k, nsPerBlock(*f, 400));
+            f->forceGenericKernel(true);
+            g = std::min(g, nsPerBlock(*f, 400));
+            f->forceGenericKernel(false);
+        }
+        sumK += k;
+        sumG += g;
+        specialised += strcmp(f->kernelName(), "Generic") != 0;
+        printf("  %-18s %-18s %7.0f  generic %7.0f  saving %5.1f%%\n",
+               presets_nameByGlobalIndex(p), f->kernelName(), k, g, 100.0 * (g - k) / g);
+    }
+    const int n = presets_totalCount();
+    printf("  %u of %d presets on a specialised kernel; mean %.0f vs %.0f ns, saving %.1f%%\n",
+           specialised, n, sumK / n, sumG / n, 100.0 * (sumG - sumK) / sumG);
+}
+
+int main() {
+    testKernelsMatchGeneric();
+    benchPresets();
+    HOST_TEST_END();
+}
@@ -0,0 +1,148 @@
+// Voice source mix: the filter's float input mixer
+// (AudioFilterOBXa::mixBlocks, one int16 → float conversion per source)
+// against the two AudioMixer4 stages it replaced (osc1, osc2, ring1, ring2
+// → osc mixer; that, sub, noise → voice mixer; int16 into the filter).
+// Sources are a saw, a square, their ring products, a sine sub and noise
+// at the voice's gains.  Reports the error of each against a
+// double-precision mix (noise floor, dB of full scale) and ns per block on
+// this host for the mixing and conversion in front of the filter core.
+#include "host_test.h"
+#include "AudioFilterOBXa_OBXf.h"
+#include "stock_audio.h"
+#include <chrono>
+#include <math.h>
+#include <random>
+#include <vector>
+
+enum { OSC1, OSC2, RING1, RING2, SUB, NOISE, NUM_SRC };
+
+static const float kOn = 0.9f;   // VoiceBlock::_on, the old voice-mixer headroom stage
+// Per-source levels of a busy patch that stays clear of clipping, before _on
+static const float kLevel[NUM_SRC] = { 0.35f, 0.3f, 0.15f, 0.1f, 0.25f, 0.08f };
+
+struct Sources {
+    audio_block_t b[NUM_SRC];
+    uint32_t n0 = 0;
+    std::mt19937 rng{ 5 };
+    void render() {
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+            const double t = (double)(n0 + i) / AUDIO_SAMPLE_RATE_EXACT;
+            const double saw = 2.0 * fmod(220.0 * t, 1.0) - 1.0;
+            const double sq  = fmod(331.0 * t, 1.0) < 0.5 ? 1.0 : -1.0;
+            b[OSC1].data[i]  = (int16_t)lrint(29000.0 * saw);
+            b[OSC2].data[i]  = (int16_t)lrint(29000.0 * sq);
+            // AudioEffectMultiply: (a × b) >> 15
+            b[RING1].data[i] = (int16_t)(((int32_t)b[OSC1].data[i] * b[OSC2].data[i]) >> 15);
+            b[RING2].data[i] = (int16_t)(((int32_t)b[OSC1].data[i] * b[OSC1].data[i]) >> 15);
+            b[SUB].data[i]   = (int16_t)lrint(30000.0 * sin(2.0 * M_PI * 110.0 * t));
+            b[NOISE].data[i] = (int16_t)((int32_t)(rng() % 60001) - 30000);
+        }
+        n0 += AUDIO_BLOCK_SAMPLES;
+    }
+};
+
+// The replaced path: two stock mixers, then the filter's int16 → float
+struct TwoStages {
+    StockMixer4 osc, voice;
+    audio_block_t in[NUM_SRC];
+    TwoStages() {
+        osc.gain(0, kLevel[OSC1]);  osc.gain(1, kLevel[OSC2]);
+        osc.gain(2, kLevel[RING1]); osc.gain(3, kLevel[RING2]);
+        voice.gain(0, kOn); voice.gain(1, 0.0f);
+        voice.gain(2, kLevel[SUB]); voice.gain(3, kLevel[NOISE]);
+    }
+    void run(const Sources& s, float* mix) {
+        memcpy(in, s.b, sizeof(in));   // Stock mixers scale channel 0 in place
+        osc.sent.clear();
+        voice.sent.clear();
+        for (int c = 0; c < 4; c++) osc.feed(c, &in[c]);
+        osc.update();
+        voice.feed(0, &osc.sent[0].second);
+        voice.feed(2, &in[SUB]);
+        voice.feed(3, &in[NOISE]);
+        voice.update();
+        const int16_t* d = voice.sent[0].second.data;
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) mix[i] = d[i] * (1.0f / 32768.0f);
+    }
+};
+
+// VoiceBlock folds _on into the osc and ring gains
+static void floatGains(float* g) {
+    for (int s = 0; s < NUM_SRC; s++) {
+        const float level = (s <= RING2) ? kLevel[s] * kOn : kLevel[s];
+        g[s] = level * (1.0f / 32768.0f);   // mixGain() pre-scaling
+    }
+}
+
+static void floatMix(const Sources& s, const float* g, float* mix) {
+    const audio_block_t* in[NUM_SRC];
+    for (int c = 0; c < NUM_SRC; c++) in[c] = &s.b[c];
+    AudioFilterOBXa::mixBlocks(in, g, NUM_SRC, mix);
+}
+
+static void testNoiseFloor() {
+    printf("Error against a double-precision mix, 20000 blocks\n");
+    Sources src;
+    TwoStages old;
+    float g[NUM_SRC];
+    floatGains(g);
+
+    double sig = 0, eOld = 0, eFloat = 0, biasOld = 0;
+    unsigned clipped = 0;
+    float a[AUDIO_BLOCK_SAMPLES], b[AUDIO_BLOCK_SAMPLES];
+    const unsigned blocks = 20000;
+    for (unsigned n = 0; n < blocks; n++) {
+        src.render();
+        old.run(src, a);
+        floatMix(src, g, b);
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+            double ref = 0;
+            for (int s = 0; s < NUM_SRC; s++) {
+                const double level = (s <= RING2) ? (double)kLevel[s] * kOn : kLevel[s];
+                ref += src.b[s].data[i] / 32768.0 * level;
+            }
+            clipped += fabs(ref) >= 1.0;
+            sig     += ref * ref;
+            eOld    += (a[i] - ref) * (a[i] - ref);
+            eFloat  += (b[i] - ref) * (b[i] - ref);
+            biasOld += a[i] - ref;
+        }
+    }
+    const double n = (double)blocks * AUDIO_BLOCK_SAMPLES;
+    const double dbOld = 10.0 * log10(eOld / n), dbFloat = 10.0 * log10(eFloat / n);
+    printf("  mix %.1f dBFS rms; two int16 stages %.1f dBFS (bias %.1f LSB), float mix %.1f dBFS\n",
+           10.0 * log10(sig / n), dbOld, biasOld / n * 32768.0, dbFloat);
+    CHECK(clipped == 0);            // The old path's clips would dominate otherwise
+    CHECK(dbFloat < -120.0);
+    CHECK(dbFloat < dbOld - 40.0);
+}
+
+static void testCost() {
+    printf("Mixing and conversion in front of the filter core, ns per block on this host\n");
+    Sources src;
+    src.render();
+    TwoStages old;
+    float g[NUM_SRC];
+    floatGains(g);
+    float mix[AUDIO_BLOCK_SAMPLES];
+    volatile float sink = 0;
+
+    double tOld = 1e30, tFloat = 1e30;
+    const unsigned blocks = 20000;
+    for (int r = 0; r < 5; r++) {
+        auto t0 = std::chrono::steady_clock::now();
+        for (unsigned n = 0; n < blocks; n++) { old.run(src, mix); sink = sink + mix[n & 127]; }
+        tOld = std::min(tOld, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / blocks);
+        t0 = std::chrono::steady_clock::now();
+        for (unsigned n = 0; n < blocks; n++) { floatMix(src, g, mix); sink = sink + mix[n & 127]; }
+        tFloat = std::min(tFloat, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / blocks);
+    }
+    printf("  two stock mixers + int16 → float %.0f ns, float mix %.0f ns (6 sources)\n", tOld, tFloat);
+    CHECK(tFloat < tOld);
+}
+
+int main() {
+    testNoiseFloor();
+    testCost();
+    HOST_TEST_END();
+}
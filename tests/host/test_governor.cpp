@@ -0,0 +1,111 @@
+// CpuGovernor: shedding order rendered offline against a per-feature load
+// model — every step it takes must lower the load, levels whose feature
+// the patch doesn't use are passed over, and restores retrace the order.
+#include "host_test.h"
+#include "CpuGovernor.h"
+#include <vector>
+
+// Audio CPU % of a patch at a governor level (rough Teensy 4.1 figures)
+struct Patch {
+    bool  modEffect;     // JPFX chorus/flanger running
+    bool  oversample;    // Supersaw 2x
+    bool  reverb;        // Wet mix > 0, not bypassed
+    float voiceCost;     // Per held voice
+    uint8_t held;        // Notes held (of 8)
+
+    float load(uint8_t level) const {
+        float cpu = 12.0f;                                   // FX chain dry path, LFOs
+        if (modEffect)  cpu += (level >= 1) ? 3.0f : 7.0f;
+        if (reverb)     cpu += (level >= 3) ? 0.0f : 14.0f;
+        const uint8_t cap = (level >= 5) ? 4 : (level >= 4) ? 6 : 8;
+        const uint8_t n   = held < cap ? held : cap;
+        cpu += n * voiceCost * ((oversample && level < 2) ? 1.6f : 1.0f);
+        return cpu;
+    }
+    uint8_t sheds() const {
+        return (uint8_t)((modEffect << 1) | (oversample << 2) | (reverb << 3));
+    }
+};
+
+// Windows of CPU_GOV_WINDOW_MS; returns the level after each change
+static std::vector<uint8_t> render(CpuGovernor& gov, const Patch& p, uint32_t& t,
+                                   uint32_t windows, float extra = 0.0f) {
+    std::vector<uint8_t> steps;
+    for (uint32_t w = 0; w < windows; w++) {
+        for (uint32_t ms = 0; ms < CPU_GOV_WINDOW_MS; ms += 10, t += 10) {
+            if (gov.sample(p.load(gov.level()) + extra, t, p.sheds())) steps.push_back(gov.level());
+        }
+    }
+    return steps;
+}
+
+static void testDefaultPatchSkipsOffLevels() {
+    printf("Default patch (no mod effect, oversampling off): first step sheds the reverb\n");
+    CpuGovernor gov;
+    const Patch p = { false, false, true, 10.0f, 8 };   // 106 % at level 0
+    uint32_t t = 0;
+    const auto steps = render(gov, p, t, 20);
+    CHECK(!steps.empty() && steps[0] == 3);
+    for (uint8_t s : steps) CHECK(s != 1 && s != 2);
+    // Every step lowered the modelled load
+    float prev = p.load(0);
+    for (uint8_t s : steps) { CHECK(p.load(s) < prev); prev = p.load(s); }
+    printf("  levels:");
+    for (uint8_t s : steps) printf(" %u", s);
+    printf(" -> %.0f%%\n", p.load(gov.level()));
+    CHECK(p.load(gov.level()) <= CPU_GOV_HIGH_PCT);
+}
+
+static void testFullPatchVisitsEveryLevel() {
+    printf("Patch using every feature: levels 1..5 in order, one per window\n");
+    CpuGovernor gov;
+    const Patch p = { true, true, true, 14.0f, 8 };
+    uint32_t t = 0;
+    const auto steps = render(gov, p, t, 6, 200.0f);   // Overloaded whatever is shed
+    CHECK(steps.size() == 5);
+    for (size_t i = 0; i < steps.size(); i++) CHECK(steps[i] == i + 1);
+
+    // Restore retraces them, one per CPU_GOV_RESTORE_MS of calm
+    const Patch idle = { true, true, true, 14.0f, 0 };
+    const uint32_t calmWindows = CPU_GOV_RESTORE_MS / CPU_GOV_WINDOW_MS;
+    const auto back = render(gov, idle, t, 6 * calmWindows + 2);
+    CHECK(back.size() == 5);
+    for (size_t i = 0; i < back.size(); i++) CHECK(back[i] == 4 - i);
+}
+
+static void testRestoreSkipsOffLevels() {
+    printf("Restore passes over levels that shed nothing\n");
+    CpuGovernor gov;
+    const Patch p = { false, false, true, 10.0f, 8 };
+    uint32_t t = 0;
+    render(gov, p, t, 6, 200.0f);
+    CHECK(gov.level() == 5);
+    const Patch idle = { false, false, true, 10.0f, 0 };
+    const auto back = render(gov, idle, t, 40);
+    CHECK((back == std::vector<uint8_t>{ 4, 3, 0 }));
+}
+
+static void testHysteresisHolds() {
+    printf("Load inside the hysteresis band holds the level\n");
+    CpuGovernor gov;
+    const Patch p = { true, true, true, 10.0f, 8 };
+    gov.sample(200.0f, 0, p.sheds());                   // One overloaded window
+    CHECK(gov.sample(200.0f, CPU_GOV_WINDOW_MS, p.sheds()));
+    CHECK(gov.level() == 1);
+    uint32_t t = CPU_GOV_WINDOW_MS + 10;
+    // 75 % flat: neither over HIGH nor under LOW
+    const Patch flat = { false, false, false, 0.0f, 0 };
+    const auto steps = render(gov, flat, t, 40, 75.0f - flat.load(0));
+    CHECK(steps.empty() && gov.level() == 1);
+
+    gov.reset();
+    CHECK(gov.level() == 0);
+}
+
+int main() {
+    testDefaultPatchSkipsOffLevels();
+    testFullPatchVisitsEveryLevel();
+    testRestoreSkipsOffLevels();
+    testHysteresisHolds();
+    HOST_TEST_END();
+}
@@ -0,0 +1,261 @@
+// Mapping.h: the curve tables give exactly what the analytic mappings they
+// replaced computed — every CC 0..127 forward, and the inverses over a
+// sweep and on both sides of every edge.  Old:: is the previous Mapping.h
+// code, verbatim.
+#include "host_test.h"
+#include "Mapping.h"
+
+namespace Old {
+    using JT4000Map::CutoffTaper;
+    using JT4000Map::TAPER_LOW;
+    using JT4000Map::TAPER_HIGH;
+    using JT4000Map::CUTOFF_MIN_HZ;
+    using JT4000Map::CUTOFF_MAX_HZ;
+    using JT4000Map::clamp01;
+    using JT4000Map::cc_to_norm;
+    using JT4000Map::norm_to_cc;
+    static CutoffTaper cutoffTaperMode = TAPER_LOW;
+
+    inline float applyTaper(float t) {
+        switch (cutoffTaperMode) { case TAPER_LOW: return powf(t,0.5f);
+                                   case TAPER_HIGH:return powf(t,2.0f);
+                                   default:        return t; }
+    }
+
+    inline float norm_to_cutoff_hz(float n) {
+        float t = applyTaper(clamp01(n));
+        return CUTOFF_MIN_HZ * powf(CUTOFF_MAX_HZ / CUTOFF_MIN_HZ, t);
+    }
+    inline float cc_to_cutoff_hz(uint8_t cc) { return norm_to_cutoff_hz(cc_to_norm(cc)); }
+    inline uint8_t cutoff_hz_to_cc(float hz) {
+        hz = fmaxf(CUTOFF_MIN_HZ, fminf(hz, CUTOFF_MAX_HZ));
+        float t = logf(hz / CUTOFF_MIN_HZ) / logf(CUTOFF_MAX_HZ / CUTOFF_MIN_HZ);
+        if (cutoffTaperMode==TAPER_LOW)  t = powf(t,2.0f);
+        if (cutoffTaperMode==TAPER_HIGH) t = powf(t,0.5f);
+        return (uint8_t)constrain(lroundf(t*127.0f),0,127);
+    }
+
+    const float msMin = 1.0f;
+    const float msMax = 11880.0f;
+
+    inline float norm_to_time_ms(float n) {
+    return msMin * powf(msMax / msMin, clamp01(n));
+}
+    inline float cc_to_time_ms(uint8_t cc) { return norm_to_time_ms((float)cc / 127.0f); }
+
+    static constexpr float OBXA_CUTOFF_MAX_HZ = 18000.0f;
+    static constexpr float OBXA_CUTOFF_MIN_HZ = CUTOFF_MIN_HZ;
+
+    inline float norm_to_obxa_cutoff_hz(float n)
+    {
+        float hz = norm_to_cutoff_hz(n); // reuse your exponential cutoff curve
+        if (hz < OBXA_CUTOFF_MIN_HZ) hz = OBXA_CUTOFF_MIN_HZ;
+        if (hz > OBXA_CUTOFF_MAX_HZ) hz = OBXA_CUTOFF_MAX_HZ;
+        return hz;
+    }
+    inline float cc_to_obxa_cutoff_hz(uint8_t cc) { return norm_to_obxa_cutoff_hz(cc_to_norm(cc)); }
+
+    inline uint8_t obxa_cutoff_hz_to_cc(float hz)
+    {
+        if (hz < OBXA_CUTOFF_MIN_HZ) hz = OBXA_CUTOFF_MIN_HZ;
+        if (hz > OBXA_CUTOFF_MAX_HZ) hz = OBXA_CUTOFF_MAX_HZ;
+        return cutoff_hz_to_cc(hz); // inverse of your shared curve (with clamp)
+    }
+
+inline uint8_t time_ms_to_cc(float ms) {
+    if (ms <= msMin) return 0;
+    if (ms >= msMax) return 127;
+    const float cc = 127.0f * logf(ms / msMin) / logf(msMax / msMin);
+    return (uint8_t)constrain(lroundf(cc), 0, 127);
+}
+
+    inline float norm_to_lfo_hz(float n)  { return 0.03f * powf(1300.0f, clamp01(n)); }
+    inline float cc_to_lfo_hz(uint8_t cc) { return norm_to_lfo_hz(cc_to_norm(cc)); }
+    inline uint8_t lfo_hz_to_cc(float hz) {
+        if (hz <= 0.03f) return 0;
+        if (hz >= 0.03f*1300.0f) return 127;
+        float n = logf(hz/0.03f)/logf(1300.0f);
+        return norm_to_cc(n);
+    }
+
+    static constexpr float RES_MIN_K  = 0.0f;
+    static constexpr float RES_Z1_MAX = 1.5f;
+    static constexpr float RES_Z2_MAX = 4.0f;
+    static constexpr float RES_MAX_K  = 20.0f;
+
+    static constexpr float RES_W1 = 0.75f;
+    static constexpr float RES_W2 = 0.20f;
+    static constexpr float RES_W3 = 0.05f;
+
+    static constexpr float RES_CURVE_Z1 = 1.60f;
+    static constexpr float RES_CURVE_Z2 = 1.20f;
+    static constexpr float RES_CURVE_Z3 = 2.20f;
+
+    static inline float clamp_res_k(float k) {
+        if (k < RES_MIN_K) return RES_MIN_K;
+        if (k > RES_MAX_K) return RES_MAX_K;
+        return k;
+    }
+
+    namespace _res_internal {
+        inline float zone_map(float t, float a, float b, float curve) {
+            if (t <= 0.0f) return a;
+            if (t >= 1.0f) return b;
+            float u = powf(t, curve);
+            return a + (b - a) * u;
+        }
+        inline float zone_map_inv(float v, float a, float b, float curve) {
+            if (v <= a) return 0.0f;
+            if (v >= b) return 1.0f;
+            float u = (v - a) / (b - a);
+            if (curve <= 0.0f) return u; // defensive; we only use >1.0
+            return powf(u, 1.0f / curve);
+        }
+    } // namespace _res_internal
+
+    static inline float cc_to_res_k(uint8_t cc) {
+        const float n = clamp01(cc / 127.0f);
+        const float W1 = RES_W1;
+        const float W2 = RES_W2;
+        const float W3 = RES_W3; // = 1 - W1 - W2
+
+        if (n <= W1) {
+            const float t = (W1 > 0.0f) ? (n / W1) : 0.0f;
+            return clamp_res_k(_res_internal::zone_map(t, RES_MIN_K, RES_Z1_MAX, RES_CURVE_Z1));
+        } else if (n <= (W1 + W2)) {
+            const float t = (W2 > 0.0f) ? ((n - W1) / W2) : 0.0f;
+            return clamp_res_k(_res_internal::zone_map(t, RES_Z1_MAX, RES_Z2_MAX, RES_CURVE_Z2));
+        } else {
+            const float t = (W3 > 0.0f) ? ((n - W1 - W2) / W3) : 0.0f;
+            return clamp_res_k(_res_internal::zone_map(t, RES_Z2_MAX, RES_MAX_K, RES_CURVE_Z3));
+        }
+    }
+
+    static inline uint8_t res_k_to_cc(float k) {
+        k = clamp_res_k(k);
+
+        const float W1 = RES_W1;
+        const float W2 = RES_W2;
+        const float W3 = RES_W3;
+
+        float n = 0.0f; // normalized [0..1]
+
+        if (k <= RES_Z1_MAX) {
+            const float t = _res_internal::zone_map_inv(k, RES_MIN_K, RES_Z1_MAX, RES_CURVE_Z1);
+            n = t * W1;
+        } else if (k <= RES_Z2_MAX) {
+            const float t = _res_internal::zone_map_inv(k, RES_Z1_MAX, RES_Z2_MAX, RES_CURVE_Z2);
+            n = W1 + t * W2;
+        } else {
+            const float t = _res_internal::zone_map_inv(k, RES_Z2_MAX, RES_MAX_K, RES_CURVE_Z3);
+            n = W1 + W2 + t * W3;
+        }
+
+        return (uint8_t)constrain(lroundf(n * 127.0f), 0, 127);
+    }
+} // namespace Old
+
+using JT4000Map::_curve_internal::Table;
+using JT4000Map::_curve_internal::toBits;
+using JT4000Map::_curve_internal::fromBits;
+
+static bool same(float a, float b) { return toBits(a) == toBits(b); }
+
+struct Curve {
+    const char* name;
+    float   (*fwdNew)(uint8_t);
+    float   (*fwdOld)(uint8_t);
+    uint8_t (*invNew)(float);
+    uint8_t (*invOld)(float);
+    float   (*normNew)(float);
+    float   (*normOld)(float);
+    const Table& (*table)();
+    float lo, hi;
+};
+
+static void setTaper(JT4000Map::CutoffTaper m) {
+    JT4000Map::cutoffTaperMode = m;
+    Old::cutoffTaperMode = m;
+}
+
+static const Table& cutoffTable() { return JT4000Map::cutoffTable(JT4000Map::cutoffTaperMode); }
+
+static const Curve kCurves[] = {
+    { "cutoff", JT4000Map::cc_to_cutoff_hz, Old::cc_to_cutoff_hz, JT4000Map::cutoff_hz_to_cc, Old::cutoff_hz_to_cc,
+      JT4000Map::norm_to_cutoff_hz, Old::norm_to_cutoff_hz, cutoffTable, 20.0f, 20000.0f },
+    { "obxa cutoff", JT4000Map::cc_to_obxa_cutoff_hz, Old::cc_to_obxa_cutoff_hz,
+      JT4000Map::obxa_cutoff_hz_to_cc, Old::obxa_cutoff_hz_to_cc,
+      JT4000Map::norm_to_obxa_cutoff_hz, Old::norm_to_obxa_cutoff_hz, cutoffTable, 20.0f, 18000.0f },
+    { "time", JT4000Map::cc_to_time_ms, Old::cc_to_time_ms, JT4000Map::time_ms_to_cc, Old::time_ms_to_cc,
+      JT4000Map::norm_to_time_ms, Old::norm_to_time_ms, JT4000Map::timeTable, 1.0f, 11880.0f },
+    { "lfo", JT4000Map::cc_to_lfo_hz, Old::cc_to_lfo_hz, JT4000Map::lfo_hz_to_cc, Old::lfo_hz_to_cc,
+      JT4000Map::norm_to_lfo_hz, Old::norm_to_lfo_hz, JT4000Map::lfoTable, 0.03f, 39.0f },
+    { "res k", JT4000Map::cc_to_res_k, Old::cc_to_res_k, JT4000Map::res_k_to_cc, Old::res_k_to_cc,
+      nullptr, nullptr, JT4000Map::resKTable, 0.0f, 20.0f },
+};
+
+static void testCurve(const Curve& c) {
+    int fwdBad = 0, normBad = 0, invBad = 0, inputs = 0;
+
+    // Forward: every CC, bit for bit; 14-bit input through norm_to_*
+    for (int cc = 0; cc < 128; cc++) {
+        if (!same(c.fwdNew((uint8_t)cc), c.fwdOld((uint8_t)cc))) fwdBad++;
+        if (c.invNew(c.fwdNew((uint8_t)cc)) != c.invOld(c.fwdOld((uint8_t)cc))) invBad++;
+    }
+    if (c.normNew) {
+        for (int v = 0; v < 16384; v++) {
+            const float n = v * (1.0f / 16383.0f);
+            if (!same(c.normNew(n), c.normOld(n))) normBad++;
+        }
+    }
+
+    auto inv = [&](float x) {
+        inputs++;
+        if (c.invNew(x) != c.invOld(x)) invBad++;
+    };
+    // Both sides of every edge
+    const Table& t = c.table();
+    for (int k = 0; k < 127; k++) {
+        const uint32_t b = toBits(t.edge[k]);
+        for (int d = -4; d <= 4; d++) inv(fromBits(b + d));
+    }
+    // Log sweep from well below to well above the range, plus the specials
+    const float lo = c.lo > 0.0f ? c.lo : 1e-4f;
+    for (double x = lo * 0.25; x < c.hi * 4.0; x *= 1.00005) inv((float)x);
+    for (float x : { -1.0f, 0.0f, c.lo, c.hi, INFINITY, -INFINITY }) inv(x);
+
+    printf("  %-11s forward %d/128 differ, 14-bit %d differ, inverse %d/%d differ\n",
+           c.name, fwdBad, normBad, invBad, inputs + 128);
+    CHECK(fwdBad == 0);
+    CHECK(normBad == 0);
+    CHECK(invBad == 0);
+}
+
+static void testMatchesAnalytic() {
+    printf("Tables reproduce the analytic mappings exactly\n");
+    const JT4000Map::CutoffTaper tapers[] = { JT4000Map::TAPER_NEUTRAL, JT4000Map::TAPER_LOW, JT4000Map::TAPER_HIGH };
+    for (auto m : tapers) {
+        printf(" taper %d\n", (int)m);
+        setTaper(m);
+        testCurve(kCurves[0]);
+        testCurve(kCurves[1]);
+    }
+    setTaper(JT4000Map::TAPER_LOW);
+    for (size_t i = 2; i < sizeof(kCurves) / sizeof(kCurves[0]); i++) testCurve(kCurves[i]);
+}
+
+static void testEveryCcRoundTrips() {
+    printf("Every CC maps back to itself\n");
+    for (const Curve& c : kCurves) {
+        // The OBXa clamp folds the top of the cutoff curve onto one value
+        const int top = (c.hi == 18000.0f) ? JT4000Map::cutoff_hz_to_cc(18000.0f) : 127;
+        for (int cc = 0; cc <= top; cc++) CHECK(c.invNew(c.fwdNew((uint8_t)cc)) == cc);
+    }
+}
+
+int main() {
+    JT4000Map::buildCurveTables();
+    testMatchesAnalytic();
+    testEveryCcRoundTrips();
+    HOST_TEST_END();
+}
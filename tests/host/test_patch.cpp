@@ -0,0 +1,143 @@
+// Patch: slot storage across the has-mask word boundary (slots 31/32 and
+// the last slot), buildUsedCCList() truncated at maxCount, and applyTo()
+// sending exactly the stored slots.  Patches carry no diff of their own:
+// the engine drops CCs whose value it already holds, so a full-list load
+// only runs the handlers for what changed (and for CCs a linked CC has
+// overwritten since).  Checked over every built-in preset reloaded onto
+// itself and onto its neighbour, plus the linked case a patch-level diff
+// would get wrong: a CC whose value matches but whose state a linked CC
+// overwrote must be applied again.
+#include "host_test.h"
+#include "Patch.h"
+#include "Presets.h"
+#include "CCDispatch.h"
+
+using namespace Presets;
+
+static void settle(SynthEngine& synth) {
+    for (int n = 0; n < 2000 && synth.presetChangePending(); n++) { synth.update(); hostAudioUpdate(); }
+}
+
+static void testSlotMask() {
+    printf("Stored-slot mask across the word boundary\n");
+    static_assert(Patch::kSlots > 32, "slot 32 must exist for this test");
+    CHECK(Patch::kWords == (Patch::kSlots + 31) / 32);
+
+    Patch p;
+    const uint8_t edges[] = { 0, 31, 32, (uint8_t)(Patch::kSlots - 1) };
+    for (uint8_t s : edges) p.setSlot(s, (uint8_t)(s + 1));
+    CHECK(p.has[0] == ((1u << 31) | 1u));
+    CHECK((p.has[1] & 1u) == 1u);
+    unsigned stored = 0;
+    for (int s = 0; s < Patch::kSlots; s++) stored += p.hasSlot((uint8_t)s);
+    CHECK(stored == 4);
+    for (uint8_t s : edges) {
+        uint8_t v = 0;
+        CHECK(p.hasSlot(s));
+        CHECK(p.getCC(PatchSchema::ccOf(s), v) && v == s + 1);
+    }
+    CHECK(!p.hasSlot(30) && !p.hasSlot(33));
+
+    // CCs outside the schema are neither stored nor reported
+    uint8_t nonSchema = 0;
+    while (PatchSchema::slotOf(nonSchema) != PatchSchema::kNoSlot) nonSchema++;
+    p.setCC(nonSchema, 99);
+    uint8_t v = 0;
+    CHECK(!p.getCC(nonSchema, v));
+    stored = 0;
+    for (int s = 0; s < Patch::kSlots; s++) stored += p.hasSlot((uint8_t)s);
+    CHECK(stored == 4);
+
+    p.clear();
+    for (int w = 0; w < Patch::kWords; w++) CHECK(p.has[w] == 0);
+    printf("  %d slots in %d mask words\n", Patch::kSlots, Patch::kWords);
+}
+
+static void testUsedCCList() {
+    printf("buildUsedCCList: ascending schema CCs, truncated at maxCount\n");
+    Patch p;
+    uint8_t list[Patch::kSlots + 8];
+    CHECK(p.buildUsedCCList(list, Patch::kSlots + 8) == Patch::kSlots);
+    for (int i = 1; i < Patch::kSlots; i++) CHECK(list[i] > list[i - 1]);
+
+    memset(list, 0xEE, sizeof(list));
+    CHECK(p.buildUsedCCList(list, 33) == 33);
+    CHECK(list[32] == PatchSchema::ccOf(32));
+    CHECK(list[33] == 0xEE);
+    CHECK(p.buildUsedCCList(list, 0) == 0);
+}
+
+static void testApplySendsStoredSlots(SynthEngine& synth) {
+    printf("applyTo sends the stored slots and nothing else\n");
+    presets_loadByGlobalIndex(synth, 0);
+    settle(synth);
+
+    Patch p;
+    const uint8_t slots[] = { 31, 32, (uint8_t)(Patch::kSlots - 1) };
+    for (uint8_t s : slots) p.setSlot(s, (uint8_t)(synth.getCC(PatchSchema::ccOf(s)) ^ 0x15));
+    CCDispatch::resetStats();
+    p.applyTo(synth);
+    settle(synth);
+    CHECK(CCDispatch::stats().received == 3);
+    for (uint8_t s : slots) CHECK(synth.getCC(PatchSchema::ccOf(s)) == p.value[s]);
+}
+
+static void testReloadSendsOnlyChanges(SynthEngine& synth) {
+    printf("Full-list preset loads run handlers only for changed CCs\n");
+    const int total = presets_totalCount();
+    unsigned reloadApplied = 0, reloadUnlinked = 0, nextReceived = 0, nextApplied = 0;
+    for (int i = 0; i < total; i++) {
+        presets_loadByGlobalIndex(synth, i);
+        settle(synth);
+        CCDispatch::resetStats();
+        presets_loadByGlobalIndex(synth, i);   // Same preset again
+        settle(synth);
+        reloadApplied += CCDispatch::stats().applied;
+        for (int cc = 0; cc < 128; cc++) {
+            if (CCDispatch::stats().calls[cc] && !CCDispatch::descriptor(cc).link) reloadUnlinked++;
+        }
+
+        CCDispatch::resetStats();
+        presets_loadByGlobalIndex(synth, i + 1);
+        settle(synth);
+        nextReceived += CCDispatch::stats().received;
+        nextApplied  += CCDispatch::stats().applied;
+    }
+    printf("  reloading each of %d presets applied %u CCs, %u outside a link group\n",
+           total, reloadApplied, reloadUnlinked);
+    printf("  each onto its neighbour: %u of %u CCs applied (%.0f%%)\n",
+           nextApplied, nextReceived, 100.0 * nextApplied / nextReceived);
+    CHECK(reloadUnlinked == 0);        // Only CCs a linked CC later in the load overwrote
+    CHECK(reloadApplied < nextApplied / 4);
+    CHECK(nextApplied < nextReceived);
+}
+
+static void testLinkedReapplied(SynthEngine& synth) {
+    printf("A CC overwritten by a linked CC is applied again at the next load\n");
+    const int tus = presets_totalCount() - 1;   // TUS presets send OSC1_MIX / OSC2_MIX
+    presets_loadByGlobalIndex(synth, tus);
+    settle(synth);
+    const float mix1 = synth.getOscMix1();
+
+    // The balance knob writes the same mix state
+    synth.handleControlChange(1, CC::OSC_MIX_BALANCE, synth.getCC(CC::OSC1_MIX) < 64 ? 127 : 0);
+    CHECK(synth.getOscMix1() != mix1);
+
+    CCDispatch::resetStats();
+    presets_loadByGlobalIndex(synth, tus);
+    settle(synth);
+    CHECK(CCDispatch::stats().calls[CC::OSC1_MIX] == 1);
+    CHECK(CCDispatch::stats().calls[CC::OSC2_MIX] == 1);
+    CHECK_NEAR(synth.getOscMix1(), mix1, 1e-6f);
+    printf("  osc 1 mix back to %.3f after the reload\n", mix1);
+}
+
+int main() {
+    testSlotMask();
+    testUsedCCList();
+    static SynthEngine engine;
+    testApplySendsStoredSlots(engine);
+    testReloadSendsOnlyChanges(engine);
+    testLinkedReapplied(engine);
+    HOST_TEST_END();
+}
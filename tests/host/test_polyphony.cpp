@@ -0,0 +1,76 @@
+// Polyphony: built once per JT_POLYPHONY (4, 6, 8, 12, 16; see Makefile).
+// The engine graph builds with one voice per summing-bus input and the amp
+// mod on MOD_INPUT; VOICE_SUM_GAIN keeps the full-correlation peak at the
+// 8-voice level (0.8 of full scale) at any width; AUDIO_MEMORY_BLOCKS is 216
+// at 8 voices, 10 per voice either side; and a chord of MAX_VOICES notes takes
+// every voice, one more steals.
+#include "host_test.h"
+#include "SynthEngine.h"
+#include "Presets.h"
+
+using namespace Presets;
+
+static void testSizing() {
+    printf("%d voices: bus width, headroom gain, block pool\n", MAX_VOICES);
+    CHECK(MAX_VOICES == JT_POLYPHONY);
+    CHECK(AudioMixerN<MAX_VOICES>::MOD_INPUT == MAX_VOICES);
+    CHECK_NEAR(VOICE_SUM_GAIN * MAX_VOICES, 0.8f, 1e-6f);
+    CHECK(AUDIO_MEMORY_BLOCKS == 216 + 10 * (MAX_VOICES - 8));
+    printf("  VOICE_SUM_GAIN %.4f, AUDIO_MEMORY_BLOCKS %d\n", VOICE_SUM_GAIN, AUDIO_MEMORY_BLOCKS);
+
+    // Every voice at full scale, in phase: the bus peak is the same at any width
+    AudioMixerN<MAX_VOICES> bus;
+    bus.masterGain(VOICE_SUM_GAIN);
+    bus.softLimit(1.0f);
+    audio_block_t full;
+    for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) full.data[i] = (i & 1) ? 32767 : -32767;
+    for (int v = 0; v < MAX_VOICES; v++) bus.feed(v, &full);
+    static_cast<AudioStream&>(bus).update();   // Protected in AudioMixerN
+    CHECK(bus.sent.size() == 1);
+    if (bus.sent.empty()) return;
+    int peak = 0;
+    for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) peak = std::max(peak, abs((int)bus.sent[0].second.data[i]));
+    printf("  %d voices at full scale in phase: bus peak %.3f of full scale\n", MAX_VOICES, peak / 32767.0);
+    CHECK_NEAR(peak / 32767.0f, 0.8f, 0.001f);
+}
+
+static void testGraph(SynthEngine& synth) {
+    printf("Engine graph: one cord per bus input\n");
+    AudioStream& bus = synth.getVoiceMixer();
+    unsigned perInput[MAX_VOICES + 1] = {};
+    for (AudioConnection* c : hostAudioCords()) {
+        if (c->destination() != &bus) continue;
+        CHECK(c->destinationInput() <= MAX_VOICES);
+        if (c->destinationInput() <= MAX_VOICES) perInput[c->destinationInput()]++;
+    }
+    unsigned wired = 0;
+    for (int i = 0; i <= MAX_VOICES; i++) wired += perInput[i] == 1;
+    printf("  %u of %d inputs wired once (voices + amp mod), %zu objects, %zu cords\n",
+           wired, MAX_VOICES + 1, hostAudioStreams().size(), hostAudioCords().size());
+    CHECK(wired == MAX_VOICES + 1);
+}
+
+static void testEveryVoicePlays(SynthEngine& synth) {
+    printf("Chord of %d notes takes every voice; one more steals\n", MAX_VOICES);
+    presets_loadByGlobalIndex(synth, 0);
+    for (int n = 0; n < 2000 && synth.presetChangePending(); n++) { synth.update(); hostAudioUpdate(); }
+    for (int v = 0; v < MAX_VOICES; v++) synth.noteOn(40 + v, 0.8f);
+    synth.update();
+    unsigned active = 0;
+    for (int v = 0; v < MAX_VOICES; v++) active += synth.isVoiceActive(v);
+    CHECK(active == MAX_VOICES);
+    synth.noteOn(40 + MAX_VOICES, 0.8f);
+    synth.update();
+    active = 0;
+    for (int v = 0; v < MAX_VOICES; v++) active += synth.isVoiceActive(v);
+    printf("  %u voices active after %d notes\n", active, MAX_VOICES + 1);
+    CHECK(active == MAX_VOICES);
+}
+
+int main() {
+    testSizing();
+    static SynthEngine engine;
+    testGraph(engine);
+    testEveryVoicePlays(engine);
+    HOST_TEST_END();
+}
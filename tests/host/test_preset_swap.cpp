@@ -0,0 +1,166 @@
+// Preset swap: every built-in preset is staged into a running engine the
+// way the browser loads it (Presets.cpp, begin → CCs → commit), with audio
+// cycles run at every unmask of the audio interrupt (stubs/Audio.h
+// hostAudioIsr).  Checks that no cycle sees any of the new patch before the
+// swap and that the first cycle after it sees all of it, that rapid
+// browsing holds one entry per CC with the newest value, and reports build
+// and swap cost per preset (ARM_DWT_CYCCNT is host ns here).
+#include "host_test.h"
+#include "SynthEngine.h"
+#include "Presets.h"
+#include "CCDispatch.h"
+#include <vector>
+
+using namespace Presets;
+
+static SynthEngine* synth;
+
+// What an audio cycle can see: the settings of every stock object in the
+// graph, plus the engine state the held (non-staged) handlers write
+static std::vector<float> snapshot() {
+    std::vector<float> s;
+    for (AudioStream* a : hostAudioStreams()) {
+        if (auto* o = dynamic_cast<AudioSynthWaveformDc*>(a)) { s.push_back(o->level); }
+        else if (auto* o = dynamic_cast<AudioSynthWaveformModulated*>(a)) { s.push_back(o->tone); s.push_back(o->amp); }
+        else if (auto* o = dynamic_cast<AudioSynthWaveform*>(a)) { s.push_back(o->tone); s.push_back(o->amp); }
+        else if (auto* o = dynamic_cast<AudioSynthNoisePink*>(a)) { s.push_back(o->amp); }
+        else if (auto* o = dynamic_cast<AudioEffectEnvelope*>(a)) { s.insert(s.end(), { o->a, o->d, o->s, o->r }); }
+        else if (auto* o = dynamic_cast<AudioAmplifier*>(a)) { s.push_back(o->level); }
+        else if (auto* o = dynamic_cast<AudioMixer4*>(a)) { s.insert(s.end(), o->level, o->level + 4); }
+        else if (auto* o = dynamic_cast<AudioEffectPlateReverb_i16*>(a)) {
+            s.insert(s.end(), { (float)o->bypass, o->wet, o->room, o->hi, o->lo });
+        }
+    }
+    const SynthEngine& e = *synth;
+    s.insert(s.end(), {
+        e.getLFO1Frequency(), e.getLFO2Frequency(), e.getLFO1AmpDepth(), e.getLFO2AmpDepth(),
+        e.getAmpModFixedLevel(), e.getFXBassGain(), e.getFXTrebleGain(),
+        (float)e.getFXModEffect(), e.getFXModMix(), e.getFXModRate(), e.getFXModFeedback(),
+        (float)e.getFXDelayEffect(), e.getFXDelayMix(), e.getFXDelayFeedback(), e.getFXDelayTime(),
+        e.getFXReverbRoomSize(), e.getFXReverbHiDamping(), e.getFXReverbLoDamping(),
+        e.getFXDryMix(), e.getFXJPFXMixL(), e.getFXReverbMixL(),
+    });
+    return s;
+}
+
+// Audio cycles taken at unmasks during one load
+struct Watch {
+    std::vector<std::vector<float>> beforeSwap, afterSwap;
+    unsigned cycles = 0;
+    bool     on = false;
+};
+static Watch watch;
+
+static void audioIsr() {
+    hostAudioUpdate();
+    if (!watch.on) return;
+    watch.cycles++;
+    (synth->presetChangePending() ? watch.beforeSwap : watch.afterSwap).push_back(snapshot());
+}
+
+// Loop passes (each followed by an audio cycle) until the swap is done
+static unsigned runUntilSwapped() {
+    unsigned passes = 0;
+    while (synth->presetChangePending() && passes < 10000) {
+        synth->update();
+        audioIsr();
+        passes++;
+    }
+    return passes;
+}
+
+static void testEveryPresetSwapsWhole() {
+    printf("Built-in presets: staged, then swapped whole (%d presets)\n", presets_totalCount());
+    presets_loadByGlobalIndex(*synth, 0);
+    runUntilSwapped();
+
+    int partial = 0, early = 0;
+    double buildSum = 0.0, swapSum = 0.0;
+    unsigned heldMax = 0, worstSwap = 0;
+    for (int p = 1; p <= presets_totalCount(); p++) {
+        const int idx = p % presets_totalCount();   // Ends back on preset 0
+        const std::vector<float> before = snapshot();
+
+        watch = Watch{};
+        watch.on = true;
+        presets_loadByGlobalIndex(*synth, idx);
+        const unsigned passes = runUntilSwapped();
+        watch.on = false;
+        const std::vector<float> after = snapshot();
+
+        // Staging: nothing of the new patch reaches an audio cycle
+        for (const auto& s : watch.beforeSwap) early += s != before;
+
+        // First cycle once the swap started: all of what the load changed
+        bool whole = !watch.afterSwap.empty();
+        if (whole) {
+            const auto& s = watch.afterSwap.front();
+            for (size_t i = 0; i < after.size(); i++) {
+                if (before[i] != after[i] && s[i] != after[i]) whole = false;
+            }
+        }
+        if (!whole) {
+            partial++;
+            printf("  %-24s first cycle after the swap saw a partial patch\n", presets_nameByGlobalIndex(idx));
+        }
+
+        const auto& st = synth->presetStats();
+        buildSum += st.buildCycles;
+        swapSum  += st.swapCycles;
+        worstSwap = std::max(worstSwap, (unsigned)st.swapCycles);
+        if (st.swapHeld > heldMax) heldMax = st.swapHeld;
+        printf("  %-24s build %7.1f us, swap %6.1f us (%2u held CCs), %3u passes to silence\n",
+               presets_nameByGlobalIndex(idx), st.buildCycles / 1000.0, st.swapCycles / 1000.0,
+               st.swapHeld, passes);
+    }
+    const int n = presets_totalCount();
+    printf("  mean build %.1f us, mean swap %.1f us, worst swap %.1f us, at most %u held CCs\n",
+           buildSum / n / 1000.0, swapSum / n / 1000.0, worstSwap / 1000.0, heldMax);
+    CHECK(early == 0);
+    CHECK(partial == 0);
+}
+
+static void testHeldDedupedByCC() {
+    printf("Rapid browsing: one held entry per CC, newest value wins\n");
+    // Three loads before the bus is silent, one swap
+    synth->setPresetCrossfadeMs(200.0f);
+    const uint32_t deferred0 = synth->presetStats().deferred;
+    for (int p : { 3, 4, 5 }) {
+        presets_loadByGlobalIndex(*synth, p);
+        synth->update();
+        audioIsr();
+    }
+    const uint32_t deferred = synth->presetStats().deferred - deferred0;
+    runUntilSwapped();
+    const auto& st = synth->presetStats();
+    const std::vector<float> browsed = snapshot();
+
+    // Same end state as loading the last preset on its own
+    presets_loadByGlobalIndex(*synth, 0);
+    runUntilSwapped();
+    presets_loadByGlobalIndex(*synth, 5);
+    runUntilSwapped();
+    printf("  %u CCs held over three loads, %u replayed\n", (unsigned)deferred, st.swapHeld);
+    CHECK(st.swapHeld <= deferred);
+    CHECK(snapshot() == browsed);
+
+    // Bound: one per CC that can be held
+    unsigned holdable = 0;
+    for (unsigned cc = 0; cc < 128; cc++) {
+        const auto& d = CCDispatch::kTable.cc[cc];
+        holdable += d.fn && !(d.flags & (CCDispatch::STAGED | CCDispatch::ALWAYS));
+    }
+    printf("  %u CCs can be held; most held by a swap so far: %u\n", holdable, st.swapHeldMax);
+    CHECK(st.swapHeldMax <= holdable);
+    synth->setPresetCrossfadeMs(PRESET_CROSSFADE_MS_DEFAULT);
+}
+
+int main() {
+    static SynthEngine engine;
+    synth = &engine;
+    hostAudioIsr = audioIsr;
+    testEveryPresetSwapsWhole();
+    testHeldDedupedByCC();
+    hostAudioIsr = nullptr;
+    HOST_TEST_END();
+}
@@ -0,0 +1,209 @@
+// Q15 kernels: the dual-sample path (run over stubs/dspinst.h) and the
+// portable path give the same output; AudioMixer4Q15 and
+// AudioEffectMultiplyQ15 match the stock AudioMixer4 and
+// AudioEffectMultiply (stock_audio.h) bit for bit, and
+// stay within the truncation of a float model of the mix.  Also times both
+// mixers' update() in the configurations the voices use.
+#define Q15_DSP 1
+#include "host_test.h"
+#include <Audio.h>
+#include "AudioMixer4Q15.h"
+#include "AudioEffectMultiplyQ15.h"
+#include "stock_audio.h"
+#include <chrono>
+#include <random>
+#include <vector>
+
+struct Mixer    : AudioMixer4Q15         { using AudioMixer4Q15::update; };
+struct Multiply : AudioEffectMultiplyQ15 { using AudioEffectMultiplyQ15::update; };
+
+static std::mt19937 rng(7);
+
+// Full-scale noise, with runs of the extremes so saturation is exercised
+static audio_block_t randomBlock() {
+    audio_block_t b;
+    std::uniform_int_distribution<int> s(-32768, 32767), pick(0, 7);
+    for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+        const int k = pick(rng);
+        b.data[i] = (int16_t)(k == 0 ? -32768 : k == 1 ? 32767 : s(rng));
+    }
+    return b;
+}
+
+static float randomGain() {
+    static const float kGains[] = { 0.0f, 1.0f, -1.0f, 0.5f, 0.25f, 0.7071f, 1.5f, 3.7f,
+                                    -2.2f, 1e-5f, 32767.0f, -40000.0f, 0.999985f };
+    std::uniform_int_distribution<int> pick(0, 15);
+    const int k = pick(rng);
+    if (k < 13) return kGains[k];
+    return std::uniform_real_distribution<float>(-4.0f, 4.0f)(rng);
+}
+
+static bool sameOutput(const AudioStream& a, const AudioStream& b) {
+    if (a.sent.size() != b.sent.size()) return false;
+    for (size_t i = 0; i < a.sent.size(); i++) {
+        if (memcmp(a.sent[i].second.data, b.sent[i].second.data, sizeof(audio_block_t::data)) != 0) return false;
+    }
+    return true;
+}
+
+static void testKernelPathsAgree() {
+    printf("Dual-sample and portable kernels agree\n");
+    int bad = 0;
+    for (int trial = 0; trial < 2000; trial++) {
+        const audio_block_t a = randomBlock(), b = randomBlock();
+        const int32_t m = Q15::gainQ16(randomGain());
+        audio_block_t p, d;
+
+        Q15::portable::scale(p.data, a.data, m);
+        Q15::dsp::scale(d.data, a.data, m);
+        bad += memcmp(p.data, d.data, sizeof p.data) != 0;
+
+        p = b; d = b;
+        Q15::portable::scaleAdd(p.data, a.data, m);
+        Q15::dsp::scaleAdd(d.data, a.data, m);
+        bad += memcmp(p.data, d.data, sizeof p.data) != 0;
+
+        p = b; d = b;
+        Q15::portable::add(p.data, a.data);
+        Q15::dsp::add(d.data, a.data);
+        bad += memcmp(p.data, d.data, sizeof p.data) != 0;
+
+        Q15::portable::multiply(p.data, a.data, b.data);
+        Q15::dsp::multiply(d.data, a.data, b.data);
+        bad += memcmp(p.data, d.data, sizeof p.data) != 0;
+    }
+    printf("  %d of 8000 kernel calls differ\n", bad);
+    CHECK(bad == 0);
+}
+
+static void testMixerMatchesStock() {
+    printf("AudioMixer4Q15 == AudioMixer4 for any inputs and gains\n");
+    int bad = 0, silent = 0, passed = 0;
+    for (int trial = 0; trial < 4000; trial++) {
+        StockMixer4 stock;
+        Mixer       q15;
+        std::uniform_int_distribution<int> mask(0, 15);
+        const int present = mask(rng);
+        // Every other trial: a single unity input, the pass-through case
+        const bool single = (trial & 1) && present;
+        audio_block_t in[4], copy[4];
+        for (unsigned ch = 0; ch < 4; ch++) {
+            const float g = single ? 1.0f : randomGain();
+            stock.gain(ch, g);
+            q15.gain(ch, g);
+            in[ch] = copy[ch] = randomBlock();
+            const bool on = single ? (ch == (unsigned)__builtin_ctz(present)) : (present >> ch) & 1;
+            if (on) {
+                stock.feed(ch, &copy[ch]);   // The stock mixer writes into its first input
+                q15.feed(ch, &in[ch]);
+            }
+        }
+        stock.update();
+        q15.update();
+        if (!sameOutput(stock, q15)) bad++;
+        if (q15.sent.empty()) silent++;
+        if (single) passed++;
+    }
+    printf("  %d of 4000 differ (%d with no output, %d pass-through)\n", bad, silent, passed);
+    CHECK(bad == 0);
+}
+
+static void testMultiplyMatchesStock() {
+    printf("AudioEffectMultiplyQ15 == AudioEffectMultiply\n");
+    int bad = 0;
+    for (int trial = 0; trial < 1000; trial++) {
+        StockMultiply stock;
+        Multiply      q15;
+        audio_block_t a = randomBlock(), b = randomBlock(), ca = a, cb = b;
+        const int present = trial & 3;
+        if (present & 1) { stock.feed(0, &ca); q15.feed(0, &a); }
+        if (present & 2) { stock.feed(1, &cb); q15.feed(1, &b); }
+        stock.update();
+        q15.update();
+        if (!sameOutput(stock, q15)) bad++;
+        if (present != 3 && !q15.sent.empty()) bad++;
+    }
+    printf("  %d of 1000 differ\n", bad);
+    CHECK(bad == 0);
+}
+
+static void testAgainstFloatModel() {
+    printf("Mix and product against float, away from saturation\n");
+    // Each scaled input truncates (< 1 LSB) after a Q16 gain (< 0.5 LSB)
+    double worstMix = 0.0, worstMul = 0.0;
+    for (int trial = 0; trial < 2000; trial++) {
+        Mixer q15;
+        audio_block_t in[4];
+        float g[4];
+        const int scaled = 4;
+        std::uniform_real_distribution<float> u(-0.25f, 0.25f);   // Σ|g| <= 1
+        for (unsigned ch = 0; ch < 4; ch++) {
+            g[ch] = u(rng);
+            q15.gain(ch, g[ch]);
+            in[ch] = randomBlock();
+            q15.feed(ch, &in[ch]);
+        }
+        q15.update();
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+            double ref = 0.0;
+            for (unsigned ch = 0; ch < 4; ch++) ref += (double)g[ch] * in[ch].data[i];
+            const double err = fabs(q15.sent[0].second.data[i] - ref) / scaled;
+            if (err > worstMix) worstMix = err;
+        }
+
+        Multiply mul;
+        audio_block_t a = randomBlock(), b = randomBlock();
+        mul.feed(0, &a);
+        mul.feed(1, &b);
+        mul.update();
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+            const double ref = std::min((double)a.data[i] * b.data[i] / 32768.0, 32767.0);
+            worstMul = std::max(worstMul, fabs(mul.sent[0].second.data[i] - ref));
+        }
+    }
+    printf("  mixer: worst %.3f LSB per input, multiply: worst %.3f LSB\n", worstMix, worstMul);
+    CHECK(worstMix < 1.5);
+    CHECK(worstMul < 1.0);
+}
+
+template <typename M>
+static double nsPerUpdate(M& m, audio_block_t* in, const bool* on) {
+    const int N = 20000;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int n = 0; n < N; n++) {
+        for (unsigned ch = 0; ch < 4; ch++) if (on[ch]) m.feed(ch, &in[ch]);
+        m.update();
+        m.sent.clear();
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / N;
+}
+
+static void benchMixer() {
+    printf("update() cost, ns per block on this host (dual-sample path)\n");
+    const struct { const char* name; float g[4]; bool on[4]; } cases[] = {
+        { "one input at unity",       { 1.0f, 1.0f, 1.0f, 1.0f },  { true, false, false, false } },
+        { "osc pair 0.5 / 0.5",       { 0.5f, 0.5f, 0.0f, 0.0f },  { true, true,  false, false } },
+        { "4 inputs, 2 at zero gain", { 0.7f, 0.0f, 0.3f, 0.0f },  { true, true,  true,  true  } },
+        { "4 inputs, all scaled",     { 0.4f, 0.3f, 0.2f, 0.1f },  { true, true,  true,  true  } },
+    };
+    for (const auto& c : cases) {
+        StockMixer4 stock;
+        Mixer       q15;
+        for (unsigned ch = 0; ch < 4; ch++) { stock.gain(ch, c.g[ch]); q15.gain(ch, c.g[ch]); }
+        audio_block_t in[4] = { randomBlock(), randomBlock(), randomBlock(), randomBlock() };
+        const double s = nsPerUpdate(stock, in, c.on);
+        const double q = nsPerUpdate(q15, in, c.on);
+        printf("  %-26s stock %6.1f  Q15 %6.1f\n", c.name, s, q);
+    }
+}
+
+int main() {
+    testKernelPathsAgree();
+    testMixerMatchesStock();
+    testMultiplyMatchesStock();
+    testAgainstFloatModel();
+    benchMixer();
+    HOST_TEST_END();
+}
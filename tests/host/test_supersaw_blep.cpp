@@ -0,0 +1,163 @@
+// AudioSynthSupersaw render paths: naive, PolyBLEP, 2× oversampling and the
+// BLEP table (the default).  For a single saw (mix 0) at three high notes,
+// harmonic against inharmonic (alias) energy up to 20 kHz and up to 10 kHz
+// from a windowed 64k-point spectrum, and the BLEP path's droop near 10 kHz
+// against the naive saw; then ns per block on this host for the full
+// 7-voice supersaw in each mode.  The BLEP table must beat the naive saw,
+// PolyBLEP and 2× oversampling on alias suppression and cost less than
+// oversampling.
+#include "host_test.h"
+#include "AudioSynthSupersaw.h"
+#include <chrono>
+#include <complex>
+#include <math.h>
+#include <vector>
+
+enum Mode { NAIVE, POLYBLEP, OVERSAMPLE, BLEP_TABLE, NUM_MODES };
+static const char* kModeNames[NUM_MODES] = { "naive", "PolyBLEP", "2x OS", "BLEP table" };
+
+static void setMode(AudioSynthSupersaw& s, Mode m) {
+    s.setOversample(m == OVERSAMPLE);
+    s.setBlepTable(m == BLEP_TABLE);
+    s.setBandLimited(m == POLYBLEP);
+}
+
+static const unsigned kN = 65536;
+
+static void fft(std::vector<std::complex<double>>& a) {
+    const size_t n = a.size();
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(a[i], a[j]);
+    }
+    for (size_t len = 2; len <= n; len <<= 1) {
+        const std::complex<double> w(cos(-2.0 * M_PI / len), sin(-2.0 * M_PI / len));
+        for (size_t i = 0; i < n; i += len) {
+            std::complex<double> wn(1.0);
+            for (size_t k = 0; k < len / 2; k++) {
+                const auto u = a[i + k], v = a[i + k + len / 2] * wn;
+                a[i + k] = u + v;
+                a[i + k + len / 2] = u - v;
+                wn *= w;
+            }
+        }
+    }
+}
+
+struct Spectrum {
+    double snr20 = 0.0, snr10 = 0.0;   // Harmonic / inharmonic energy, dB
+    double level10 = 0.0;              // Harmonic nearest 10 kHz × its number, vs the fundamental, dB
+};
+
+// Power spectrum of kN samples of one saw at bin-centred frequency k·fs/N
+static Spectrum measure(Mode m, unsigned k) {
+    AudioSynthSupersaw s;
+    setMode(s, m);
+    s.setMix(0.0f);
+    s.setMixCompensation(false);
+    s.setAmplitude(0.5f);
+    const double fs = AUDIO_SAMPLE_RATE_EXACT, f0 = k * fs / kN;
+    s.setFrequency((float)f0);
+
+    for (int b = 0; b < 64; b++) { s.sent.clear(); s.update(); }   // HPF settles
+    std::vector<std::complex<double>> x(kN);
+    for (unsigned b = 0; b < kN / AUDIO_BLOCK_SAMPLES; b++) {
+        s.sent.clear();
+        s.update();
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+            const unsigned n = b * AUDIO_BLOCK_SAMPLES + i;
+            // 4-term Blackman-Harris: leakage well under the int16 floor
+            const double t = 2.0 * M_PI * n / kN;
+            const double w = 0.35875 - 0.48829 * cos(t) + 0.14128 * cos(2 * t) - 0.01168 * cos(3 * t);
+            x[n] = s.sent[0].second.data[i] / 32768.0 * w;
+        }
+    }
+    fft(x);
+
+    // Each harmonic owns the bins within ±kSpread of m·k
+    const int kSpread = 6;
+    double h20 = 0, a20 = 0, h10 = 0, a10 = 0;
+    std::vector<double> p(kN / 2);
+    for (unsigned i = 1; i < kN / 2; i++) p[i] = std::norm(x[i]);
+    for (unsigned i = 4; i < kN / 2; i++) {
+        const double f = i * fs / kN;
+        if (f > 20000.0) break;
+        const unsigned near = (i + k / 2) / k * k;
+        const bool harmonic = near && abs((int)i - (int)near) <= kSpread;
+        (harmonic ? h20 : a20) += p[i];
+        if (f <= 10000.0) (harmonic ? h10 : a10) += p[i];
+    }
+
+    // Harmonic amplitude near 10 kHz vs the fundamental's / harmonic number
+    auto peak = [&](unsigned c) {
+        double e = 0;
+        for (int d = -kSpread; d <= kSpread; d++) e += p[c + d];
+        return e;
+    };
+    const unsigned mh = (unsigned)lrint(10000.0 / f0);
+    Spectrum r;
+    r.snr20   = 10.0 * log10(h20 / a20);
+    r.snr10   = 10.0 * log10(h10 / a10);
+    r.level10 = 10.0 * log10(peak(mh * k) * mh * mh / peak(k));
+    return r;
+}
+
+static void testAliasSuppression() {
+    printf("Single saw: harmonic / inharmonic energy to 20 kHz / to 10 kHz, dB\n");
+    const double notes[] = { 1046.5, 2093.0, 4186.0 };
+    for (double hz : notes) {
+        const unsigned k = (unsigned)lrint(hz * kN / AUDIO_SAMPLE_RATE_EXACT);
+        Spectrum r[NUM_MODES];
+        printf("  %4.0f Hz", hz);
+        for (int m = 0; m < NUM_MODES; m++) {
+            r[m] = measure((Mode)m, k);
+            printf("  %s %5.1f/%5.1f", kModeNames[m], r[m].snr20, r[m].snr10);
+        }
+        const double droop = r[BLEP_TABLE].level10 - r[NAIVE].level10;
+        printf("\n            BLEP table vs naive saw at %.0f Hz: %+.1f dB\n",
+               lrint(10000.0 / (k * AUDIO_SAMPLE_RATE_EXACT / kN)) * k * AUDIO_SAMPLE_RATE_EXACT / kN, droop);
+        CHECK(r[BLEP_TABLE].snr20 > r[NAIVE].snr20 + 20.0);
+        CHECK(r[BLEP_TABLE].snr20 > r[POLYBLEP].snr20 + 6.0);
+        CHECK(r[BLEP_TABLE].snr20 > r[OVERSAMPLE].snr20);
+        CHECK(r[BLEP_TABLE].snr10 > r[POLYBLEP].snr10);
+        CHECK(droop > -1.5);
+    }
+}
+
+static double nsPerBlock(AudioSynthSupersaw& s, unsigned blocks) {
+    const auto t0 = std::chrono::steady_clock::now();
+    for (unsigned b = 0; b < blocks; b++) {
+        s.sent.clear();
+        s.update();
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / blocks;
+}
+
+static void testCostPerMode() {
+    printf("Full supersaw (7 saws, mix 0.5, detune 0.5), ns per block on this host\n");
+    AudioSynthSupersaw s[NUM_MODES];
+    double best[NUM_MODES];
+    for (int m = 0; m < NUM_MODES; m++) {
+        setMode(s[m], (Mode)m);
+        s[m].setMix(0.5f);
+        s[m].setDetune(0.5f);
+        s[m].setFrequency(220.0f);
+        best[m] = 1e30;
+    }
+    // Best of five interleaved runs keeps host noise out
+    for (int r = 0; r < 5; r++) {
+        for (int m = 0; m < NUM_MODES; m++) best[m] = std::min(best[m], nsPerBlock(s[m], 2000));
+    }
+    for (int m = 0; m < NUM_MODES; m++) {
+        printf("  %-10s %6.0f ns (%.2fx naive)\n", kModeNames[m], best[m], best[m] / best[NAIVE]);
+    }
+    CHECK(best[BLEP_TABLE] < best[OVERSAMPLE]);
+}
+
+int main() {
+    testAliasSuppression();
+    testCostPerMode();
+    HOST_TEST_END();
+}
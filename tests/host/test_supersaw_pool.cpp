@@ -0,0 +1,124 @@
+// SupersawPool: engines are created only on demand, reused once handed
+// back, refused (not stolen) when all are out, and a re-leased engine
+// renders exactly like a new one — no phase, HPF or BLEP state carries
+// over from its previous oscillator.
+#include "host_test.h"
+#include "SupersawPool.h"
+#include <vector>
+
+// As OscillatorBlock sets up a leased engine
+static void play(AudioSynthSupersaw& e, float hz) {
+    e.setFrequency(hz);
+    e.setDetune(0.6f);
+    e.setMix(0.8f);
+    e.setAmplitude(0.9f);
+}
+
+static std::vector<int16_t> render(AudioSynthSupersaw& e, unsigned blocks) {
+    std::vector<int16_t> out;
+    e.sent.clear();
+    for (unsigned b = 0; b < blocks; b++) e.update();
+    for (const auto& s : e.sent) out.insert(out.end(), s.second.data, s.second.data + AUDIO_BLOCK_SAMPLES);
+    return out;
+}
+
+// What a brand-new engine with the pool's settings renders
+static std::vector<int16_t> reference(float hz, bool oversample, unsigned blocks) {
+    AudioSynthSupersaw e;
+    e.setMixCompensation(true);
+    e.setCompensationMaxGain(1.5f);
+    e.setBandLimited(false);
+    e.setBlepTable(true);
+    e.setOversample(oversample);
+    play(e, hz);
+    return render(e, blocks);
+}
+
+static void testCreatedOnDemand() {
+    printf("No engines until a lease; a returned engine is reused and parked\n");
+    CHECK(SupersawPool::stats().created == 0);
+
+    AudioSynthSupersaw* a = SupersawPool::lease();
+    CHECK(a != nullptr);
+    CHECK(SupersawPool::stats().created == 1 && SupersawPool::stats().leased == 1);
+
+    SupersawPool::giveBack(a);
+    CHECK(!a->active);
+    CHECK(SupersawPool::stats().leased == 0);
+
+    CHECK(SupersawPool::lease() == a);
+    CHECK(SupersawPool::stats().created == 1);
+    SupersawPool::giveBack(a);
+    SupersawPool::giveBack(a);   // Twice: ignored
+    CHECK(SupersawPool::stats().leased == 0);
+}
+
+static void testReleasedEngineStartsClean() {
+    printf("A re-leased engine renders exactly like a new one\n");
+    const auto fresh = reference(220.0f, false, 8);
+
+    AudioSynthSupersaw* e = SupersawPool::lease();
+    play(*e, 1234.5f);               // Previous owner: another pitch, mid-cycle
+    render(*e, 5);
+    SupersawPool::giveBack(e);
+
+    AudioSynthSupersaw* again = SupersawPool::lease();
+    CHECK(again == e);
+    play(*again, 220.0f);
+    CHECK(render(*again, 8) == fresh);
+    SupersawPool::giveBack(again);
+}
+
+static void testExhaustedRefuses() {
+    printf("All %u engines out: lease refused, nothing taken from a holder\n", (unsigned)SUPERSAW_POOL_SIZE);
+    std::vector<AudioSynthSupersaw*> held;
+    for (unsigned i = 0; i < SUPERSAW_POOL_SIZE; i++) held.push_back(SupersawPool::lease());
+    for (auto* e : held) CHECK(e != nullptr);
+    for (unsigned i = 0; i < held.size(); i++)
+        for (unsigned j = i + 1; j < held.size(); j++) CHECK(held[i] != held[j]);
+    CHECK(SupersawPool::stats().created == SUPERSAW_POOL_SIZE);
+    CHECK(SupersawPool::stats().peak == SUPERSAW_POOL_SIZE);
+
+    CHECK(SupersawPool::lease() == nullptr);
+    CHECK(SupersawPool::lease() == nullptr);
+    CHECK(SupersawPool::stats().exhausted == 2);
+    CHECK(SupersawPool::stats().created == SUPERSAW_POOL_SIZE);
+
+    // The next lease after a return gets that engine
+    SupersawPool::giveBack(held[3]);
+    CHECK(SupersawPool::lease() == held[3]);
+    for (auto* e : held) SupersawPool::giveBack(e);
+    CHECK(SupersawPool::stats().leased == 0);
+}
+
+static void testOversampleIsPoolWide() {
+    printf("Oversampling reaches every engine, leased or parked\n");
+    const auto over  = reference(330.0f, true, 4);
+    const auto plain = reference(330.0f, false, 4);
+    CHECK(over != plain);
+
+    AudioSynthSupersaw* held = SupersawPool::lease();
+    SupersawPool::setOversample(true);
+    play(*held, 330.0f);
+    CHECK(render(*held, 4) == over);            // Leased when it was switched
+
+    AudioSynthSupersaw* parked = SupersawPool::lease();
+    play(*parked, 330.0f);
+    CHECK(render(*parked, 4) == over);          // Parked when it was switched
+
+    SupersawPool::setOversample(false);
+    SupersawPool::giveBack(held);
+    AudioSynthSupersaw* e = SupersawPool::lease();
+    play(*e, 330.0f);
+    CHECK(render(*e, 4) == plain);
+    SupersawPool::giveBack(e);
+    SupersawPool::giveBack(parked);
+}
+
+int main() {
+    testCreatedOnDemand();
+    testReleasedEngineStartsClean();
+    testExhaustedRefuses();
+    testOversampleIsPoolWide();
+    HOST_TEST_END();
+}
@@ -0,0 +1,191 @@
+// AudioEffectVoiceLFO: per-voice delay ramp and key-synced phase run in the
+// audio update, with nothing on the control side between blocks; and the
+// shared LFORamp it runs with AudioEffectLFOFade, held to the ideal line
+// for ramps longer than 65536 samples.
+#include "host_test.h"
+#include "AudioEffectVoiceLFO.h"
+#include "AudioEffectLFOFade.h"
+
+// Stages' update() is protected (the library calls it); expose it here
+struct Stage : AudioEffectVoiceLFO { using AudioEffectVoiceLFO::update; };
+struct Fade  : AudioEffectLFOFade  { using AudioEffectLFOFade::update; };
+
+static audio_block_t constantBlock(int16_t v) {
+    audio_block_t b;
+    for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) b.data[i] = v;
+    return b;
+}
+
+// One block through 'st'; returns false if nothing was transmitted
+static bool run(Stage& st, audio_block_t* in, audio_block_t& out) {
+    st.sent.clear();
+    if (in) st.feed(0, in);
+    st.update();
+    if (st.sent.empty()) return false;
+    out = st.sent.back().second;
+    return true;
+}
+
+static void testDelayRampPerVoice() {
+    printf("Delay ramp: sample-counted from this voice's noteOn only\n");
+    Stage a, b;
+    a.setDelayMs(10.0f);
+    b.setDelayMs(10.0f);
+    const uint32_t len = (uint32_t)(10.0f * (AUDIO_SAMPLE_RATE_EXACT / 1000.0f));
+
+    audio_block_t in = constantBlock(16000), out;
+
+    // b has been sounding for a while; a gets a noteOn now
+    b.retrigger();
+    for (int k = 0; k < 10; k++) run(b, &in, out);
+    a.retrigger();
+
+    uint32_t n = 0;
+    int worst = 0;
+    bool bUntouched = true;
+    for (int k = 0; k < 8; k++) {
+        run(a, &in, out);
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++, n++) {
+            const int want = n < len ? (int)(16000.0 * n / len) : 16000;
+            worst = std::max(worst, abs(out.data[i] - want));
+        }
+        audio_block_t outB;
+        run(b, &in, outB);
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) bUntouched &= outB.data[i] == 16000;
+    }
+    printf("  ramp of %u samples, max error %d LSB\n", len, worst);
+    CHECK(worst <= 1);    // Q32 gain: truncation only
+    CHECK(bUntouched);
+    CHECK(!a.isRamping());
+
+    // Ramp keeps counting while the shared LFO is muted (no input block)
+    a.retrigger();
+    for (int k = 0; k < 2; k++) CHECK(!run(a, nullptr, out));
+    run(a, &in, out);
+    CHECK_NEAR(out.data[0], 16000.0 * (2 * AUDIO_BLOCK_SAMPLES) / len, 2.0);
+}
+
+static void testKeySyncPhase() {
+    printf("Key sync: each voice restarts the shared LFO's phase at its noteOn\n");
+    AudioSynthLFO shared;
+    shared.begin(WAVEFORM_SINE);
+    shared.frequency(5.0f);
+    shared.amplitude(1.0f);
+
+    Stage a, b;
+    a.setSource(&shared); a.setKeySync(true);
+    b.setSource(&shared); b.setKeySync(true);
+
+    // Reference: a fresh generator started at each noteOn
+    AudioSynthLFO refA, refB;
+    for (AudioSynthLFO* r : { &refA, &refB }) { r->begin(WAVEFORM_SINE); r->frequency(5.0f); r->amplitude(1.0f); }
+
+    a.retrigger();
+    int worst = 0;
+    for (int k = 0; k < 200; k++) {
+        shared.update();            // Shared generator runs first, as in the graph
+        if (k == 37) b.retrigger();
+        audio_block_t outA, outB;
+        run(a, nullptr, outA);
+        refA.sent.clear(); refA.update();
+        const audio_block_t& wantA = refA.sent.back().second;
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) worst = std::max(worst, abs(outA.data[i] - wantA.data[i]));
+
+        const bool gotB = run(b, nullptr, outB);
+        if (k >= 37) {
+            refB.sent.clear(); refB.update();
+            const audio_block_t& wantB = refB.sent.back().second;
+            // First sub-block after b's noteOn glides from its previous value
+            const int from = (k == 37) ? LFO_SUBBLOCK_SAMPLES : 0;
+            CHECK(gotB);
+            for (int i = from; i < AUDIO_BLOCK_SAMPLES; i++) worst = std::max(worst, abs(outB.data[i] - wantB.data[i]));
+        }
+    }
+    printf("  max deviation from a generator started at noteOn: %d LSB\n", worst);
+    CHECK(worst <= 1);
+
+    // Follows the shared rate
+    shared.frequency(11.0f);
+    shared.update();
+    CHECK(shared.getIncrement() == (uint32_t)(11.0f * (4294967296.0f / AUDIO_SAMPLE_RATE_EXACT)));
+}
+
+static void testKeySyncWithDelay() {
+    printf("Key sync and delay together\n");
+    AudioSynthLFO shared;
+    shared.begin(WAVEFORM_SQUARE);
+    shared.frequency(1.0f);
+    shared.amplitude(0.5f);
+    Stage a;
+    a.setSource(&shared); a.setKeySync(true); a.setDelayMs(20.0f);
+    a.retrigger();
+    audio_block_t out;
+    int16_t peakFirst = 0, peakLater = 0;
+    for (int k = 0; k < 20; k++) {
+        shared.update();
+        run(a, nullptr, out);
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+            if (k == 0) peakFirst = std::max(peakFirst, out.data[i]);
+            if (k == 19) peakLater = std::max(peakLater, out.data[i]);
+        }
+    }
+    CHECK(peakFirst < 0.5f * 32767 * 0.2f);      // 128 of 882 samples in
+    CHECK_NEAR(peakLater, 0.5f * 32767, 2.0);
+}
+
+// Whole ramp through 'st' against 16000 × n / len; returns the worst error
+// and the smallest rise across a block while ramping
+template <class S>
+static int rampError(S& st, uint32_t len, int& minRise) {
+    audio_block_t in = constantBlock(16000);
+    int worst = 0;
+    minRise = 1 << 30;
+    uint32_t n = 0;
+    while (n < len + AUDIO_BLOCK_SAMPLES) {
+        st.sent.clear();
+        st.feed(0, &in);
+        st.update();
+        CHECK(st.sent.size() == 1);
+        if (st.sent.empty()) return 1 << 30;
+        const int16_t* d = st.sent.back().second.data;
+        for (int i = 0; i < AUDIO_BLOCK_SAMPLES; i++, n++) {
+            const int want = n < len ? (int)(16000.0 * n / len) : 16000;
+            worst = std::max(worst, abs(d[i] - want));
+        }
+        if (n < len) minRise = std::min(minRise, d[AUDIO_BLOCK_SAMPLES - 1] - d[0]);
+    }
+    return worst;
+}
+
+static void testLongRamp() {
+    printf("Ramps longer than 65536 samples rise every sample (LFORamp Q32 gain)\n");
+    const float msList[] = { 1000.0f, 2000.0f, 4000.0f };   // 4000 ms is the CC maximum
+    for (float ms : msList) {
+        const uint32_t len = LFORamp::lengthFromMs(ms);
+        Stage voice;
+        Fade  fade;
+        voice.setDelayMs(ms);
+        fade.setDelayMs(ms);
+        voice.retrigger();
+        fade.retrigger();
+        int riseVoice = 0, riseFade = 0;
+        const int errVoice = rampError(voice, len, riseVoice);
+        const int errFade  = rampError(fade, len, riseFade);
+        printf("  %4.0f ms (%6u samples): max error %d / %d LSB, smallest rise per block %d / %d LSB (voice / global)\n",
+               ms, len, errVoice, errFade, riseVoice, riseFade);
+        CHECK(errVoice <= 1);
+        CHECK(errFade <= 1);
+        // A truncated Q16 step (0 above 65536 samples) held each block flat
+        CHECK(riseVoice >= (int)(16000.0 * (AUDIO_BLOCK_SAMPLES - 1) / len) - 1);
+        CHECK(riseFade >= (int)(16000.0 * (AUDIO_BLOCK_SAMPLES - 1) / len) - 1);
+        CHECK(!voice.isRamping() && !fade.isRamping());
+    }
+}
+
+int main() {
+    testDelayRampPerVoice();
+    testLongRamp();
+    testKeySyncPhase();
+    testKeySyncWithDelay();
+    HOST_TEST_END();
+}
@@ -0,0 +1,158 @@
+// VoiceParamBlock: a CC costs the same at any polyphony.  A recorded knob
+// session is replayed the way SynthEngine runs it (setters edit() the
+// block, update() publishes, every voice syncs through its
+// VoiceParamCursor) at 4, 8 and 16 voices: CC handling does no voice work,
+// each voice applies each changed group once per publish however many
+// writes went into it, and a voice that missed a publish re-applies all.
+#include "host_test.h"
+#include "VoiceParams.h"
+#include <random>
+#include <vector>
+
+// Counts what VoiceBlock::_applyParams would apply
+struct ProbeVoice {
+    VoiceParamCursor params;
+    uint32_t applies = 0;           // Group applies
+    float    cutoffHz = 0.0f;       // As the filter would receive it
+
+    void sync() {
+        const uint32_t groups = params.take();
+        if (!groups) return;
+        applies += (uint32_t)__builtin_popcount(groups);
+        if (groups & VoiceParam::FILTER_CUTOFF) cutoffHz = params.block()->live().cutoffHz;
+    }
+};
+
+// SynthEngine's side: setters and _publishParams()
+struct Engine {
+    VoiceParamBlock         block;
+    std::vector<ProbeVoice> voices;
+
+    explicit Engine(unsigned n) : voices(n) {
+        for (auto& v : voices) v.params.attach(&block);
+    }
+    uint32_t voiceApplies() const {
+        uint32_t n = 0;
+        for (const auto& v : voices) n += v.applies;
+        return n;
+    }
+    uint32_t publish() {
+        const uint32_t changed = block.publish();
+        if (changed) for (auto& v : voices) v.sync();
+        return changed;
+    }
+
+    void setFilterCutoff(float hz)  { block.edit(VoiceParam::FILTER_CUTOFF).cutoffHz = hz; }
+    void setFilterResonance(float r){ block.edit(VoiceParam::FILTER_RES).resonance = r; }
+    void setAmpAttack(float ms)     { block.edit(VoiceParam::AMP_ENV).ampEnv.attack = ms; }
+    void setOsc1Detune(float d)     { block.edit(VoiceParam::OSC1_PITCH).osc[0].detune = d; }
+};
+
+// One CC of the session: setter and value, or -1 for an update() tick
+struct Event { int setter; float value; };
+
+// Knob sweeps as a controller sends them: bursts of 0..12 CCs between
+// updates, mostly one knob at a time
+static std::vector<Event> session() {
+    std::mt19937 rng(3);
+    std::vector<Event> ev;
+    for (int tick = 0; tick < 500; tick++) {
+        const int burst = (int)(rng() % 13);
+        const int knob  = (int)(rng() % 4);
+        for (int i = 0; i < burst; i++) {
+            const int s = (rng() % 8 == 0) ? (int)(rng() % 4) : knob;
+            ev.push_back({ s, (float)(rng() % 16384) });
+        }
+        ev.push_back({ -1, 0.0f });
+    }
+    return ev;
+}
+
+static void testCcCostIndependentOfPolyphony() {
+    printf("Recorded session replayed at 4, 8 and 16 voices\n");
+    const auto ev = session();
+    uint32_t ccs = 0;
+    for (const auto& e : ev) ccs += e.setter >= 0;
+
+    uint32_t writesAt4 = 0, publishesAt4 = 0, groupsAt4 = 0;
+    for (unsigned n : { 4u, 8u, 16u }) {
+        Engine eng(n);
+        uint32_t ccVoiceWork = 0, badSync = 0, groups = 0;
+        float lastCutoff = -1.0f;
+        for (const auto& e : ev) {
+            if (e.setter < 0) {
+                const uint32_t before = eng.voiceApplies();
+                const uint32_t changed = eng.publish();
+                groups += (uint32_t)__builtin_popcount(changed);
+                // Each voice: each changed group once
+                if (eng.voiceApplies() - before != n * (uint32_t)__builtin_popcount(changed)) badSync++;
+                for (const auto& v : eng.voices) {
+                    if (lastCutoff >= 0.0f && v.cutoffHz != lastCutoff) badSync++;
+                }
+                continue;
+            }
+            const uint32_t before = eng.voiceApplies();
+            switch (e.setter) {
+                case 0: eng.setFilterCutoff(e.value); lastCutoff = e.value; break;
+                case 1: eng.setFilterResonance(e.value); break;
+                case 2: eng.setAmpAttack(e.value); break;
+                default: eng.setOsc1Detune(e.value); break;
+            }
+            ccVoiceWork += eng.voiceApplies() - before;
+        }
+        const auto& st = eng.block.stats();
+        printf("  %2u voices: %u CCs, voice work during CCs %u, %u publishes, "
+               "%u group applies (fan-out: %u setter calls)\n",
+               n, (unsigned)ccs, (unsigned)ccVoiceWork, (unsigned)st.publishes,
+               (unsigned)eng.voiceApplies(), (unsigned)(ccs * n));
+        CHECK(ccVoiceWork == 0);
+        CHECK(badSync == 0);
+        CHECK(st.writes == ccs);
+        CHECK(eng.voiceApplies() == n * groups);
+        if (n == 4) { writesAt4 = st.writes; publishesAt4 = st.publishes; groupsAt4 = groups; }
+        // CC-side work and publishes don't depend on the voice count
+        CHECK(st.writes == writesAt4 && st.publishes == publishesAt4 && groups == groupsAt4);
+    }
+    CHECK(groupsAt4 < ccs / 3);   // Sweeps coalesce
+}
+
+static void testSweepCoalesces() {
+    printf("100 writes between updates: one apply per voice\n");
+    Engine eng(8);
+    for (int i = 0; i < 100; i++) eng.setFilterCutoff(100.0f + i);
+    CHECK(eng.voiceApplies() == 0);
+    CHECK(eng.publish() == VoiceParam::FILTER_CUTOFF);
+    CHECK(eng.voiceApplies() == 8);
+    for (const auto& v : eng.voices) CHECK(v.cutoffHz == 199.0f);
+    CHECK(eng.block.stats().coalesced == 99);
+    CHECK(eng.publish() == 0);                 // Nothing pending
+    CHECK(eng.voiceApplies() == 8);
+}
+
+static void testMissedPublishAppliesAll() {
+    printf("A voice that missed a publish re-applies every group\n");
+    VoiceParamBlock block;
+    VoiceParamCursor cur;
+    cur.attach(&block);
+    CHECK(cur.take() == 0);
+    block.edit(VoiceParam::GLIDE).glideTimeMs = 10.0f;
+    block.publish();
+    CHECK(cur.take() == VoiceParam::GLIDE);
+    CHECK(cur.take() == 0);
+    block.edit(VoiceParam::MIX).sub = 0.5f;
+    block.publish();
+    block.edit(VoiceParam::MIX).noise = 0.5f;
+    block.publish();
+    CHECK(cur.take() == VoiceParam::ALL);
+    CHECK(cur.take() == 0);
+
+    VoiceParamCursor detached;
+    CHECK(detached.take() == 0);
+}
+
+int main() {
+    testCcCostIndependentOfPolyphony();
+    testSweepCoalesces();
+    testMissedPublishAppliesAll();
+    HOST_TEST_END();
+}
@@ -0,0 +1,230 @@
+// AudioMixerN against the voice mixer tree it replaced (bus AudioMixer4s at
+// unity → final AudioMixer4 at VOICE_SUM_GAIN → AudioEffectAmpMod), both fed
+// the same eight voices: error against an exact sum (noise floor, DC), bus
+// clipping the tree applied before its headroom gain, and update() time.
+#include "host_test.h"
+#include <Audio.h>
+#include "AudioMixerN.h"
+#include "stock_audio.h"
+#include <chrono>
+#include <vector>
+
+static constexpr uint8_t kVoices  = 8;
+static constexpr float   kSumGain = 0.8f / kVoices;   // VOICE_SUM_GAIN at 8 voices
+
+// The tree's amp-mod stage (AudioEffectAmpMod.h before the bus), verbatim
+class OldAmpMod : public AudioStream {
+public:
+    OldAmpMod() : AudioStream(2, _inputQueue) {}
+
+    void update() override {
+        audio_block_t* mod = receiveReadOnly(0);
+        if (!mod) {
+            audio_block_t* carrier = receiveReadOnly(1);
+            if (!carrier) return;
+            transmit(carrier);
+            release(carrier);
+            return;
+        }
+
+        audio_block_t* out = receiveWritable(1);
+        if (!out) { release(mod); return; }
+
+        const int16_t* m = mod->data;
+        int16_t*       d = out->data;
+        for (uint16_t i = 0; i < AUDIO_BLOCK_SAMPLES; ++i) {
+            int32_t p = ((int32_t)d[i] * (int32_t)m[i]) >> 15;
+            if (p > 32767) p = 32767;            // only -32768 × -32768 overflows
+            d[i] = (int16_t)p;
+        }
+
+        transmit(out);
+        release(out);
+        release(mod);
+    }
+
+private:
+    audio_block_t* _inputQueue[2];
+};
+
+// Voices → 2 bus mixers → final mixer → amp mod, run by hand in graph order
+struct OldTree {
+    StockMixer4 bus[2], fin;
+    OldAmpMod   amp;
+    audio_block_t busOut[2], finOut;
+
+    OldTree() {
+        for (unsigned ch = 0; ch < 4; ch++) { bus[0].gain(ch, 1.0f); bus[1].gain(ch, 1.0f); }
+        for (unsigned ch = 0; ch < 4; ch++) fin.gain(ch, ch < 2 ? kSumGain : 0.0f);
+    }
+
+    // Returns the output block, nullptr when nothing was transmitted
+    const audio_block_t* run(audio_block_t* voices[kVoices], audio_block_t* mod) {
+        for (unsigned b = 0; b < 2; b++) {
+            for (unsigned ch = 0; ch < 4; ch++) if (voices[b * 4 + ch]) bus[b].feed(ch, voices[b * 4 + ch]);
+            bus[b].sent.clear();
+            bus[b].update();
+            if (!bus[b].sent.empty()) { busOut[b] = bus[b].sent[0].second; fin.feed(b, &busOut[b]); }
+        }
+        fin.sent.clear();
+        fin.update();
+        if (fin.sent.empty()) return nullptr;
+        finOut = fin.sent[0].second;
+        if (mod) amp.feed(0, mod);
+        amp.feed(1, &finOut);
+        amp.sent.clear();
+        amp.update();
+        return amp.sent.empty() ? nullptr : &amp.sent[0].second;
+    }
+};
+
+struct NewSum : AudioMixerN<kVoices> {
+    using AudioMixerN<kVoices>::update;
+    NewSum() { masterGain(kSumGain); softLimit(0.9f); }
+
+    const audio_block_t* run(audio_block_t* voices[kVoices], audio_block_t* mod) {
+        for (unsigned ch = 0; ch < kVoices; ch++) if (voices[ch]) feed(ch, voices[ch]);
+        if (mod) feed(MOD_INPUT, mod);
+        sent.clear();
+        update();
+        return sent.empty() ? nullptr : &sent[0].second;
+    }
+};
+
+// Eight detuned sines at `level` (fraction of full scale each), voice v at
+// phase offset v; `held` voices sound, the rest transmit nothing
+struct Voices {
+    audio_block_t block[kVoices];
+    double level;
+    unsigned held;
+    bool inPhase;
+
+    void render(uint32_t n0) {
+        for (unsigned v = 0; v < kVoices; v++) {
+            const double f = inPhase ? 220.0 : 110.0 * (1.0 + 0.37 * v);
+            for (unsigned i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+                const double ph = 2.0 * M_PI * f * (n0 + i) / AUDIO_SAMPLE_RATE_EXACT + (inPhase ? 0.0 : v);
+                block[v].data[i] = (int16_t)lrint(level * 32767.0 * sin(ph));
+            }
+        }
+    }
+};
+
+// Tremolo between 0.5 and 1.0 (Q15), as the amp-mod mixer sends it
+static void renderMod(audio_block_t& m, uint32_t n0) {
+    for (unsigned i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+        const double t = 0.75 + 0.25 * sin(2.0 * M_PI * 5.0 * (n0 + i) / AUDIO_SAMPLE_RATE_EXACT);
+        m.data[i] = (int16_t)lrint(t * 32767.0);
+    }
+}
+
+struct Error {
+    double sum = 0.0, sq = 0.0, peak = 0.0;
+    size_t n = 0;
+    void add(double e) { sum += e; sq += e * e; peak = std::max(peak, fabs(e)); n++; }
+    double mean() const { return n ? sum / n : 0.0; }
+    double rms() const  { return n ? sqrt(sq / n) : 0.0; }
+    double db() const   { return 20.0 * log10(rms() / 32768.0 + 1e-30); }
+};
+
+// Output minus the exact sum × VOICE_SUM_GAIN (× mod), in LSB
+static void measure(Voices& v, bool withMod, unsigned blocks, Error& oldErr, Error& newErr) {
+    OldTree oldTree;
+    NewSum  newSum;
+    audio_block_t mod;
+    for (unsigned b = 0; b < blocks; b++) {
+        const uint32_t n0 = b * AUDIO_BLOCK_SAMPLES;
+        v.render(n0);
+        renderMod(mod, n0);
+        audio_block_t copies[kVoices];
+        audio_block_t *oldIn[kVoices], *newIn[kVoices];
+        for (unsigned c = 0; c < kVoices; c++) {
+            copies[c] = v.block[c];   // The stock mixer writes into its first input
+            oldIn[c] = c < v.held ? &copies[c] : nullptr;
+            newIn[c] = c < v.held ? &v.block[c] : nullptr;
+        }
+        audio_block_t modCopy = mod;
+        const audio_block_t* o = oldTree.run(oldIn, withMod ? &modCopy : nullptr);
+        const audio_block_t* n = newSum.run(newIn, withMod ? &mod : nullptr);
+        CHECK(o && n);
+        if (!o || !n) return;
+        for (unsigned i = 0; i < AUDIO_BLOCK_SAMPLES; i++) {
+            double ref = 0.0;
+            for (unsigned c = 0; c < v.held; c++) ref += v.block[c].data[i];
+            ref *= kSumGain;
+            if (withMod) ref *= mod.data[i] / 32768.0;
+            oldErr.add(o->data[i] - ref);
+            newErr.add(n->data[i] - ref);
+        }
+    }
+}
+
+static void testNoiseFloor() {
+    printf("Error against the exact sum (8 voices, 2000 blocks)\n");
+    const struct { const char* name; double level; bool mod; } cases[] = {
+        { "quiet tails (-50 dBFS/voice)", 0.00316, false },
+        { "quiet tails, tremolo",         0.00316, true  },
+        { "playing (-12 dBFS/voice)",     0.25,    false },
+        { "playing, tremolo",             0.25,    true  },
+    };
+    for (const auto& c : cases) {
+        Voices v{ {}, c.level, kVoices, false };
+        Error o, n;
+        measure(v, c.mod, 2000, o, n);
+        printf("  %-30s tree: %6.1f dBFS rms, DC %+.2f LSB   bus: %6.1f dBFS rms, DC %+.2f LSB\n",
+               c.name, o.db(), o.mean(), n.db(), n.mean());
+        CHECK(fabs(n.mean()) < 0.1);          // Truncation towards zero: no DC
+        CHECK(n.rms() <= o.rms());
+        CHECK(n.peak < 2.0);                  // One requantisation (+ 32767 vs 32768 scale)
+    }
+}
+
+static void testNoBusClipping() {
+    printf("Four voices in phase at 0.4 FS: the tree clipped its bus before the gain\n");
+    Voices v{ {}, 0.4, 4, true };
+    Error o, n;
+    measure(v, false, 50, o, n);
+    printf("  tree peak error %.0f LSB, bus peak error %.2f LSB\n", o.peak, n.peak);
+    CHECK(o.peak > 1000.0);
+    CHECK(n.peak < 2.0);
+}
+
+static double nsPerBlock(Voices& v, bool withMod, bool tree) {
+    OldTree oldTree;
+    NewSum  newSum;
+    audio_block_t mod;
+    renderMod(mod, 0);
+    v.render(0);
+    const int N = 20000;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < N; r++) {
+        audio_block_t* in[kVoices];
+        for (unsigned c = 0; c < kVoices; c++) in[c] = c < v.held ? &v.block[c] : nullptr;
+        if (tree) oldTree.run(in, withMod ? &mod : nullptr);
+        else      newSum.run(in, withMod ? &mod : nullptr);
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / N;
+}
+
+static void benchSum() {
+    printf("Voice sum cost, ns per block on this host\n");
+    const struct { const char* name; unsigned held; bool mod; } cases[] = {
+        { "8 voices, mod parked", 8, false },
+        { "8 voices, tremolo",    8, true  },
+        { "2 voices, mod parked", 2, false },
+    };
+    for (const auto& c : cases) {
+        Voices v{ {}, 0.05, c.held, false };
+        const double t = nsPerBlock(v, c.mod, true);
+        const double n = nsPerBlock(v, c.mod, false);
+        printf("  %-22s tree %7.1f  bus %7.1f\n", c.name, t, n);
+    }
+}
+
+int main() {
+    testNoiseFloor();
+    testNoBusClipping();
+    benchSum();
+    HOST_TEST_END();
+}
@@ -0,0 +1,196 @@
+// WavFileLoader on a host folder (its POSIX WaveFS backend): a tree of
+// generated single cycles in every accepted format, plus files it must
+// skip, loaded slice by slice.  Checks the banks and tables it creates,
+// that each loaded cycle is the sine it was written as, that no poll()
+// reads more than one WAV_CHUNK_BYTES chunk, and reports polls and the
+// longest poll() in ns on this host.
+#include "host_test.h"
+#include "WavFileLoader.h"
+#include <chrono>
+#include <math.h>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static std::string g_root;
+
+static void put16(std::vector<uint8_t>& b, uint16_t v) { b.push_back(v & 0xFF); b.push_back(v >> 8); }
+static void put32(std::vector<uint8_t>& b, uint32_t v) { put16(b, v & 0xFFFF); put16(b, v >> 16); }
+static void tag(std::vector<uint8_t>& b, const char* t) { b.insert(b.end(), t, t + 4); }
+
+struct WavSpec {
+    uint16_t fmt = 1;          // 1 PCM, 3 float
+    uint16_t bits = 16;
+    uint16_t channels = 1;
+    uint32_t frames = 600;
+    bool     extensible = false;
+    uint32_t junkBytes = 0;    // Unknown chunk ahead of fmt (odd sizes are padded)
+    float    amp = 0.9f;
+};
+
+// One cycle of a sine on the first channel, a different signal on the rest
+static std::vector<uint8_t> makeWav(const WavSpec& s) {
+    std::vector<uint8_t> data;
+    for (uint32_t n = 0; n < s.frames; n++) {
+        for (uint16_t c = 0; c < s.channels; c++) {
+            const double x = c ? 0.5 * cos(6.0 * M_PI * n / s.frames)
+                               : s.amp * sin(2.0 * M_PI * n / s.frames);
+            if (s.fmt == 3) {
+                const float f = (float)x;
+                uint32_t u; memcpy(&u, &f, 4);
+                put32(data, u);
+            } else if (s.bits == 8) {
+                data.push_back((uint8_t)lrint(128.0 + 127.0 * x));
+            } else if (s.bits == 16) {
+                put16(data, (uint16_t)(int16_t)lrint(32767.0 * x));
+            } else if (s.bits == 24) {
+                const int32_t v = (int32_t)lrint(8388607.0 * x);
+                data.push_back(v & 0xFF); data.push_back((v >> 8) & 0xFF); data.push_back((v >> 16) & 0xFF);
+            } else {
+                put32(data, (uint32_t)(int32_t)lrint(2147483647.0 * x));
+            }
+        }
+    }
+
+    std::vector<uint8_t> w;
+    tag(w, "RIFF"); put32(w, 0); tag(w, "WAVE");
+    if (s.junkBytes) {
+        tag(w, "junk"); put32(w, s.junkBytes);
+        w.insert(w.end(), s.junkBytes + (s.junkBytes & 1), 0xAA);
+    }
+    const uint16_t align = s.channels * (s.bits / 8);
+    tag(w, "fmt "); put32(w, s.extensible ? 40 : 16);
+    put16(w, s.extensible ? 0xFFFE : s.fmt);
+    put16(w, s.channels);
+    put32(w, 44100);
+    put32(w, 44100 * align);
+    put16(w, align);
+    put16(w, s.bits);
+    if (s.extensible) {
+        put16(w, 22); put16(w, s.bits); put32(w, 0);
+        put16(w, s.fmt);                                   // Sub-format GUID, first word
+        const uint8_t guid[14] = { 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00,
+                                   0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71 };
+        w.insert(w.end(), guid, guid + 14);
+    }
+    tag(w, "data"); put32(w, (uint32_t)data.size());
+    w.insert(w.end(), data.begin(), data.end());
+    const uint32_t riff = (uint32_t)w.size() - 8;
+    memcpy(&w[4], &riff, 4);
+    return w;
+}
+
+static void writeFile(const std::string& path, const std::vector<uint8_t>& bytes) {
+    FILE* f = fopen(path.c_str(), "wb");
+    CHECK(f != nullptr);
+    if (!f) return;
+    fwrite(bytes.data(), 1, bytes.size(), f);
+    fclose(f);
+}
+
+static void makeTree() {
+    char tmpl[] = "/tmp/jt_wavXXXXXX";
+    CHECK(mkdtemp(tmpl) != nullptr);
+    g_root = std::string(tmpl) + "/WAVES";
+    mkdir(g_root.c_str(), 0755);
+    mkdir((g_root + "/Float").c_str(), 0755);
+    mkdir((g_root + "/Mixed").c_str(), 0755);
+
+    WavSpec s;
+    writeFile(g_root + "/root.wav", makeWav(s));                       // Root bank, as stored
+    writeFile(g_root + "/readme.txt", { 'h', 'i' });                   // Not a WAV: ignored
+
+    s = WavSpec{}; s.fmt = 3; s.bits = 32; s.frames = 256; s.junkBytes = 27;
+    writeFile(g_root + "/Float/float256.wav", makeWav(s));              // Stretched, odd junk
+    s = WavSpec{}; s.bits = 8; s.frames = 64;
+    writeFile(g_root + "/Float/pcm8.wav", makeWav(s));
+    writeFile(g_root + "/Float/._pcm8.wav", makeWav(s));                // Resource fork: ignored
+
+    s = WavSpec{}; s.bits = 24; s.channels = 2; s.frames = 1024;
+    writeFile(g_root + "/Mixed/stereo24.wav", makeWav(s));              // Box-averaged, channel 0
+    s = WavSpec{}; s.bits = 32; s.frames = 2048; s.extensible = true;
+    writeFile(g_root + "/Mixed/ext32.wav", makeWav(s));
+    s = WavSpec{}; s.frames = WAV_MAX_FRAMES + 1;
+    writeFile(g_root + "/Mixed/toolong.wav", makeWav(s));               // Rejected
+    s = WavSpec{}; s.amp = 0.0f;
+    writeFile(g_root + "/Mixed/silent.wav", makeWav(s));                // Rejected
+    writeFile(g_root + "/Mixed/garbage.wav", std::vector<uint8_t>(300, 0x5A));   // Rejected
+}
+
+// Largest distance from a unit sine, over the best sub-sample alignment
+// (box averaging shifts the cycle by a fraction of a sample)
+static double sineError(const int16_t* t) {
+    double best = 1e9;
+    for (double ph = -1.0; ph <= 1.0; ph += 0.05) {
+        double err = 0.0;
+        for (int i = 0; i < WAVE_TABLE_LEN; i++) {
+            err = std::max(err, fabs(t[i] / 32767.0 - sin(2.0 * M_PI * (i + ph) / WAVE_TABLE_LEN)));
+        }
+        best = std::min(best, err);
+    }
+    return best;
+}
+
+static void testLoadTree() {
+    printf("Loading a host folder of generated WAVs\n");
+    makeTree();
+    static WavFileLoader loader;
+    CHECK(loader.begin(g_root.c_str()));
+
+    unsigned polls = 0, bigReads = 0;
+    double maxNs = 0.0, totalNs = 0.0;
+    while (loader.busy() && polls < 100000) {
+        const uint32_t bytes = loader.stats().bytesRead;
+        const auto t0 = std::chrono::steady_clock::now();
+        loader.poll();
+        const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+        maxNs = std::max(maxNs, ns);
+        totalNs += ns;
+        bigReads += loader.stats().bytesRead - bytes > WAV_CHUNK_BYTES;
+        polls++;
+    }
+    const auto& st = loader.stats();
+    printf("  %u banks, %u tables, %u skipped, %lu bytes read\n",
+           st.banks, st.tables, st.rejected, (unsigned long)st.bytesRead);
+    printf("  %u polls, %.1f us busy, longest poll %.1f us on this host\n",
+           polls, totalNs / 1000.0, maxNs / 1000.0);
+    CHECK(!loader.busy());
+    CHECK(st.banks == 3);
+    CHECK(st.tables == 5);
+    CHECK(st.rejected == 3);
+    CHECK(bigReads == 0);
+
+    // Each table is the sine it was written as
+    CHECK(WaveTablePool::bankCount() == 3);
+    unsigned named = 0;
+    for (uint8_t b = 0; b < WaveTablePool::bankCount(); b++) {
+        const char* name = WaveTablePool::bankName(b);
+        named += !strcmp(name, "WAVES") || !strcmp(name, "Float") || !strcmp(name, "Mixed");
+        for (uint16_t i = 0; i < WaveTablePool::tableCount(b); i++) {
+            const int16_t* t = WaveTablePool::table(b, i);
+            CHECK(t != nullptr);
+            if (!t) continue;
+            const double err = sineError(t);
+            printf("  %-6s table %u: max error %.4f of full scale\n", name, i, err);
+            CHECK(err < 0.02);
+        }
+    }
+    CHECK(named == 3);
+    CHECK(WaveTablePool::tableCount(0) + WaveTablePool::tableCount(1) + WaveTablePool::tableCount(2) == 5);
+}
+
+static void testMissingRoot() {
+    printf("A missing root folder is refused\n");
+    WavFileLoader loader;
+    CHECK(!loader.begin((g_root + "/nope").c_str()));
+    CHECK(!loader.busy());
+}
+
+int main() {
+    testLoadTree();
+    testMissingRoot();
+    std::string rm = "rm -rf " + g_root.substr(0, g_root.rfind('/'));
+    CHECK(system(rm.c_str()) == 0);
+    HOST_TEST_END();
+}
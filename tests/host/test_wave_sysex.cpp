@@ -0,0 +1,192 @@
+// WaveSysEx: wavetable uploads streamed through feed() in 16-byte pieces
+// the way usbMIDI's chunked handler delivers them.  Reports MB/s on this
+// host including conform and store, and checks that once every slot has
+// been written the stream allocates nothing (malloc is counted), that an
+// uploaded cycle is stored as sent, and the NAK paths: a corrupt chunk and
+// its resend, a repeated seq, DATA before BEGIN, END short of the frames,
+// and someone else's SysEx.
+#include "host_test.h"
+#include "WaveSysEx.h"
+#include <chrono>
+#include <math.h>
+#include <vector>
+
+// Every malloc in the process; glibc's own entry point does the work
+static unsigned g_mallocs = 0;
+extern "C" void* __libc_malloc(size_t);
+extern "C" void* malloc(size_t n) noexcept { g_mallocs++; return __libc_malloc(n); }
+
+struct Reply { uint8_t cmd; uint16_t seq; uint8_t status; };
+static std::vector<Reply> g_replies;
+
+static void onReply(const uint8_t* m, uint16_t len) {
+    if (len == 10) g_replies.push_back({ m[5], (uint16_t)(m[6] | (m[7] << 7)), m[8] });
+}
+
+static unsigned g_stored = 0;
+static void onStored(ArbBank, uint16_t) { g_stored++; }
+
+// F0 7D 4A 54 <cmd> <payload> <chk> F7
+static void message(std::vector<uint8_t>& out, uint8_t cmd, const std::vector<uint8_t>& payload) {
+    out.insert(out.end(), { 0xF0, WAVE_SYSEX_ID0, WAVE_SYSEX_ID1, WAVE_SYSEX_ID2, cmd });
+    uint8_t sum = cmd;
+    for (uint8_t b : payload) { out.push_back(b); sum = (sum + b) & 0x7F; }
+    out.push_back((uint8_t)(-sum & 0x7F));
+    out.push_back(0xF7);
+}
+
+static void beginMsg(std::vector<uint8_t>& out, uint8_t slot, uint16_t frames) {
+    message(out, WaveSysEx::BEGIN, { slot, (uint8_t)(frames & 0x7F), (uint8_t)(frames >> 7) });
+}
+
+static void dataMsg(std::vector<uint8_t>& out, uint16_t seq, const int16_t* s, unsigned n) {
+    std::vector<uint8_t> p = { (uint8_t)(seq & 0x7F), (uint8_t)(seq >> 7) };
+    for (unsigned i = 0; i < n; i++) {
+        const uint16_t u = (uint16_t)s[i];
+        p.insert(p.end(), { (uint8_t)(u >> 14), (uint8_t)((u >> 7) & 0x7F), (uint8_t)(u & 0x7F) });
+    }
+    message(out, WaveSysEx::DATA, p);
+}
+
+// A whole upload: BEGIN, DATA chunks of 'chunk' samples, END
+static std::vector<uint8_t> upload(uint8_t slot, const std::vector<int16_t>& wave, unsigned chunk = 64) {
+    std::vector<uint8_t> out;
+    beginMsg(out, slot, (uint16_t)wave.size());
+    uint16_t seq = 0;
+    for (size_t i = 0; i < wave.size(); i += chunk) {
+        dataMsg(out, seq++, &wave[i], (unsigned)std::min<size_t>(chunk, wave.size() - i));
+    }
+    message(out, WaveSysEx::END, {});
+    return out;
+}
+
+static std::vector<int16_t> sine(unsigned frames, double harmonic = 1.0) {
+    std::vector<int16_t> w(frames);
+    for (unsigned n = 0; n < frames; n++) w[n] = (int16_t)lrint(30000.0 * sin(2.0 * M_PI * harmonic * n / frames));
+    return w;
+}
+
+// usbMIDI hands over SysEx in pieces
+static void feedPieces(WaveSysEx& sx, const std::vector<uint8_t>& bytes, unsigned piece = 16) {
+    for (size_t i = 0; i < bytes.size(); i += piece) {
+        const uint16_t n = (uint16_t)std::min<size_t>(piece, bytes.size() - i);
+        sx.feed(&bytes[i], n, i + n >= bytes.size());
+    }
+}
+
+static WaveSysEx sx;
+
+static void testStream() {
+    printf("Streaming uploads in 16-byte pieces\n");
+    // First write of every slot allocates it (and the staging buffer once)
+    const auto wave = sine(2048);
+    std::vector<std::vector<uint8_t>> msgs;
+    for (uint8_t slot = 0; slot < WAVE_USER_TABLES; slot++) msgs.push_back(upload(slot, wave));
+    const unsigned warm0 = g_mallocs;
+    for (const auto& m : msgs) feedPieces(sx, m);
+    CHECK(g_mallocs - warm0 >= 1 + WAVE_USER_TABLES);   // The counter sees them
+    CHECK(sx.stats().allocations == 1);
+    CHECK(sx.stats().tables == WAVE_USER_TABLES);
+
+    // Steady state: every slot rewritten in place
+    msgs.clear();
+    for (unsigned u = 0; u < WAVE_USER_TABLES; u++) msgs.push_back(upload((uint8_t)u, sine(2048, 1 + u % 5)));
+    g_replies.clear();
+    g_replies.reserve(200000);
+    const auto st0 = sx.stats();
+    size_t bytes = 0;
+    const unsigned mallocs0 = g_mallocs;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (unsigned r = 0; r < 16; r++) {
+        for (const auto& m : msgs) { feedPieces(sx, m); bytes += m.size(); }
+    }
+    const double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    const unsigned mallocs = g_mallocs - mallocs0;
+    const auto& st = sx.stats();
+    printf("  %u uploads of 2048 frames, %.1f MB: %.0f MB/s on this host, %.1f us per upload\n",
+           16 * WAVE_USER_TABLES, bytes / 1e6, bytes / 1e6 / s, s * 1e6 / (16 * WAVE_USER_TABLES));
+    printf("  %zu replies, %u NAKs, staging allocated %u time(s), %u mallocs while streaming\n",
+           g_replies.size(), st.naks - st0.naks, st.allocations, mallocs);
+    CHECK(st.naks == st0.naks);
+    CHECK(st.tables - st0.tables == 16 * WAVE_USER_TABLES);
+    CHECK(g_replies.size() == 16 * WAVE_USER_TABLES * (2 + 2048 / 64));
+    CHECK(st.allocations == 1);
+    CHECK(mallocs == 0);
+}
+
+static void testStoredAsSent() {
+    printf("An uploaded cycle is stored as sent\n");
+    const unsigned stored = g_stored;
+    const auto wave = sine(600);
+    feedPieces(sx, upload(7, wave), 5);
+    CHECK(g_stored == stored + 1);
+    const int8_t bank = (int8_t)(WaveTablePool::bankCount() - 1);
+    CHECK(!strcmp(WaveTablePool::bankName(bank), "SysEx"));
+    const int16_t* t = WaveTablePool::table(bank, 7);
+    CHECK(t != nullptr);
+    if (!t) return;
+    int err = 0;
+    for (int i = 0; i < WAVE_TABLE_LEN; i++) err = std::max(err, abs(t[i] - (int)lrint(wave[i] * 32767.0 / 30000.0)));
+    printf("  600 frames in slot 7: max error %d LSB after normalising\n", err);
+    CHECK(err <= 2);
+}
+
+static void testNaks() {
+    printf("NAKs: corrupt chunk, resend, repeated seq, no BEGIN, short END, foreign SysEx\n");
+    const auto wave = sine(128);
+    std::vector<uint8_t> m;
+
+    g_replies.clear();
+    beginMsg(m, 3, 128);
+    feedPieces(sx, m);
+    CHECK(g_replies.back().status == WaveSysEx::OK);
+
+    // Corrupt one sample byte: checksum NAK, nothing kept; the resend is ACKed
+    m.clear();
+    dataMsg(m, 0, &wave[0], 64);
+    std::vector<uint8_t> bad = m;
+    bad[10] ^= 0x01;
+    feedPieces(sx, bad);
+    CHECK(g_replies.back().cmd == WaveSysEx::DATA && g_replies.back().status == WaveSysEx::BAD_CHECKSUM);
+    feedPieces(sx, m);
+    CHECK(g_replies.back().status == WaveSysEx::OK && g_replies.back().seq == 0);
+
+    // Same seq again: out of order
+    feedPieces(sx, m);
+    CHECK(g_replies.back().status == WaveSysEx::BAD_SEQUENCE);
+
+    // END with half the frames
+    m.clear();
+    message(m, WaveSysEx::END, {});
+    feedPieces(sx, m);
+    CHECK(g_replies.back().cmd == WaveSysEx::END && g_replies.back().status == WaveSysEx::BAD_LENGTH);
+
+    // DATA with no upload open
+    m.clear();
+    dataMsg(m, 0, &wave[0], 64);
+    feedPieces(sx, m);
+    CHECK(g_replies.back().status == WaveSysEx::NO_UPLOAD);
+
+    // Out-of-range BEGIN
+    m.clear();
+    beginMsg(m, WAVE_USER_TABLES, 128);
+    feedPieces(sx, m);
+    CHECK(g_replies.back().status == WaveSysEx::BAD_LENGTH);
+
+    // Another manufacturer's SysEx: no reply, bytes not ours
+    const size_t replies = g_replies.size();
+    const uint32_t bytes = sx.stats().bytes;
+    const std::vector<uint8_t> other = { 0xF0, 0x43, 0x10, 0x4C, 0x00, 0x00, 0x7E, 0x00, 0xF7 };
+    feedPieces(sx, other, 3);
+    CHECK(g_replies.size() == replies);
+    CHECK(sx.stats().bytes == bytes);
+    printf("  %zu replies, %u NAKs so far\n", g_replies.size(), (unsigned)sx.stats().naks);
+}
+
+int main() {
+    sx.begin(onReply, onStored);
+    testStream();
+    testStoredAsSent();
+    testNaks();
+    HOST_TEST_END();
+}
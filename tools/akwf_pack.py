@@ -0,0 +1,356 @@
+#!/usr/bin/env python3
+"""Generate the compressed AKWF bank sources (see AKWFCodec.h).
+
+Writes, under --out (default: the repo root):
+  AKWF_<Bank>/AKWF_<Bank>.h   one compressed stream per table + directory
+  AKWF_All.h, AKWF_All.cpp    ArbBank enum and the bank directory
+
+Input, one of:
+  --wav DIR    DIR/<Bank>/*.wav, 16-bit mono single cycles; a bank's tables
+               are its files in name order, each named after its file stem
+  --repack     the bank headers already under --out, decoded and encoded
+               again (regenerates them after a change to this script)
+
+Encoding (AKWFCodec.h documents the stream): per table the predictor order
+1..3 with the shortest stream wins, lowest order on a tie; per block of
+AKWF_CODEC_BLOCK samples the Rice parameter 0..15 with the fewest bits
+wins, lowest on a tie.  Output is deterministic: running --repack on an
+unchanged tree rewrites it byte for byte (tools/test_akwf_pack.py).
+"""
+import argparse
+import os
+import re
+import sys
+import wave
+
+BLOCK = 16          # AKWF_CODEC_BLOCK
+K_BITS = 4
+MAX_ORDER = 3
+PAD_BYTES = 4       # The decoder's 32-bit reader may run this far past a stream
+MAX_TABLE_LEN = 600
+
+GEN = "Auto‑generated"
+
+
+# ---------------------------------------------------------------------------
+# Codec
+# ---------------------------------------------------------------------------
+
+def _predict(order, p1, p2, p3):
+    if order == 1:
+        return p1
+    if order == 2:
+        return 2 * p1 - p2
+    return 3 * p1 - 3 * p2 + p3
+
+
+def _zigzag(r):
+    return (r << 1) if r >= 0 else ((-r << 1) - 1)
+
+
+def _residuals(samples, order):
+    p1 = p2 = p3 = 0
+    out = []
+    for v in samples:
+        out.append(v - _predict(order, p1, p2, p3))
+        p3, p2, p1 = p2, p1, v
+    return out
+
+
+class _BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.n = 0
+
+    def put(self, value, nbits):
+        for i in range(nbits - 1, -1, -1):
+            self.acc = (self.acc << 1) | ((value >> i) & 1)
+            self.n += 1
+            if self.n == 8:
+                self.out.append(self.acc)
+                self.acc = self.n = 0
+
+    def unary(self, q):
+        for _ in range(q):
+            self.put(1, 1)
+        self.put(0, 1)
+
+    def flush(self):
+        if self.n:
+            self.out.append(self.acc << (8 - self.n))
+            self.acc = self.n = 0
+        return bytes(self.out)
+
+
+def _best_k(us):
+    best_bits, best_k = None, 0
+    for k in range(1 << K_BITS):
+        bits = sum((u >> k) + 1 + k for u in us)
+        if best_bits is None or bits < best_bits:
+            best_bits, best_k = bits, k
+    return best_k
+
+
+def encode_order(samples, order):
+    us = [_zigzag(r) for r in _residuals(samples, order)]
+    w = _BitWriter()
+    for i in range(0, len(us), BLOCK):
+        blk = us[i:i + BLOCK]
+        k = _best_k(blk)
+        w.put(k, K_BITS)
+        for u in blk:
+            w.unary(u >> k)
+            w.put(u & ((1 << k) - 1), k)
+    return bytes([order]) + w.flush()
+
+
+def encode(samples):
+    """Shortest stream over predictor orders 1..MAX_ORDER."""
+    best = None
+    for order in range(1, MAX_ORDER + 1):
+        s = encode_order(samples, order)
+        if best is None or len(s) < len(best):
+            best = s
+    return best
+
+
+def decode(buf, offset, length):
+    """Samples of the stream at buf[offset]; also returns the end offset."""
+    order = buf[offset]
+    pos = (offset + 1) * 8
+
+    def bit():
+        nonlocal pos
+        b = (buf[pos >> 3] >> (7 - (pos & 7))) & 1
+        pos += 1
+        return b
+
+    def bits(n):
+        v = 0
+        for _ in range(n):
+            v = (v << 1) | bit()
+        return v
+
+    out = []
+    p1 = p2 = p3 = 0
+    k = 0
+    for n in range(length):
+        if n % BLOCK == 0:
+            k = bits(K_BITS)
+        q = 0
+        while bit():
+            q += 1
+        u = (q << k) | bits(k)
+        v = _predict(order, p1, p2, p3) + ((u >> 1) ^ -(u & 1))
+        out.append(v)
+        p3, p2, p1 = p2, p1, v
+    return out, (pos + 7) // 8
+
+
+# ---------------------------------------------------------------------------
+# Sources
+# ---------------------------------------------------------------------------
+
+def read_wav_banks(root):
+    """[(bank, [(name, samples)])] from root/<Bank>/*.wav, banks by name."""
+    banks = []
+    for bank in sorted(os.listdir(root)):
+        d = os.path.join(root, bank)
+        if not os.path.isdir(d):
+            continue
+        tables = []
+        for f in sorted(os.listdir(d)):
+            if not f.lower().endswith(".wav"):
+                continue
+            with wave.open(os.path.join(d, f), "rb") as w:
+                if w.getsampwidth() != 2 or w.getnchannels() != 1:
+                    sys.exit("%s/%s: need 16-bit mono" % (bank, f))
+                raw = w.readframes(w.getnframes())
+            n = len(raw) // 2
+            if n > MAX_TABLE_LEN:
+                sys.exit("%s/%s: %d samples (max %d)" % (bank, f, n, MAX_TABLE_LEN))
+            samples = [int.from_bytes(raw[2 * i:2 * i + 2], "little", signed=True) for i in range(n)]
+            tables.append((os.path.splitext(f)[0], samples))
+        if tables:
+            banks.append((bank, tables))
+    return banks
+
+
+_REF = re.compile(r"\{ data \+\s*(\d+), (\d+) \}.*?//\s*\d+ (\S+)")
+
+
+def read_bank_header(path):
+    """[(name, samples)] decoded from a generated bank header."""
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    head, tail = text.split("static const AKWFTableRef", 1)
+    data = bytes(int(h, 16) for h in re.findall(r"0x([0-9A-F]{2})", head))
+    tables = []
+    for off, length, name in _REF.findall(tail):
+        samples, _ = decode(data, int(off), int(length))
+        tables.append((name, samples))
+    return tables
+
+
+def read_header_banks(root):
+    banks = []
+    for d in sorted(os.listdir(root)):
+        path = os.path.join(root, d, d + ".h")
+        if d.startswith("AKWF_") and os.path.isfile(path):
+            banks.append((d[len("AKWF_"):], read_bank_header(path)))
+    return banks
+
+
+# ---------------------------------------------------------------------------
+# Output
+# ---------------------------------------------------------------------------
+
+def bank_header(bank, tables):
+    streams = [encode(s) for _, s in tables]
+    data = b"".join(streams) + bytes(PAD_BYTES)
+    raw_bytes = sum(len(s) for _, s in tables) * 2
+
+    lines = [
+        "// %s AKWF bank (compressed, see AKWFCodec.h). Do not edit manually." % GEN,
+        "",
+        "#pragma once",
+        "#include <Arduino.h>",
+        "",
+        "namespace AKWF_%s {" % bank,
+        "",
+        "    constexpr uint16_t count = %d;" % len(tables),
+        "",
+        "    // %d bytes as int16 → %d bytes" % (raw_bytes, len(data)),
+        "",
+        "    static const uint8_t data[%d] PROGMEM = {" % len(data),
+    ]
+    rows = [data[i:i + 16] for i in range(0, len(data), 16)]
+    for r, row in enumerate(rows):
+        cells = ", ".join("0x%02X" % b for b in row)
+        lines.append("        " + cells + ("," if r < len(rows) - 1 else ""))
+    lines += ["    };", "", "    static const AKWFTableRef tables[count] PROGMEM = {"]
+    off = 0
+    for i, ((name, samples), s) in enumerate(zip(tables, streams)):
+        last = i == len(tables) - 1
+        lines.append("        { data + %6d, %d }%s   // %3d %s"
+                     % (off, len(samples), " " if last else ",", i, name))
+        off += len(s)
+    lines += ["    };", "", "} // namespace AKWF_%s" % bank, ""]
+    return "\n".join(lines)
+
+
+def all_header(banks):
+    names = [b for b, _ in banks]
+    longest = max(len(s) for _, t in banks for _, s in t)
+    enum = ",\n".join("    " + n for n in names)
+    return """// %s AKWF bank catalog. Do not edit manually.
+
+#pragma once
+#include <Arduino.h>
+#include "AKWFCodec.h"
+
+enum class ArbBank : uint8_t {
+%s
+};
+
+#define AKWF_BANK_COUNT     %d
+#define AKWF_MAX_TABLE_LEN  %d   // Longest table in any bank (samples)
+
+// One compressed table: stream start and decoded length
+struct AKWFTableRef {
+    const uint8_t* data;
+    uint16_t       length;
+};
+
+struct AKWFBankDir {
+    const char*         name;
+    const AKWFTableRef* tables;
+    uint16_t            count;
+};
+
+// Bank directory, indexed by ArbBank (AKWF_All.cpp)
+extern const AKWFBankDir akwf_banks[AKWF_BANK_COUNT];
+
+inline const char* akwf_bankName(ArbBank b) {
+    const uint8_t i = (uint8_t)b;
+    return (i < AKWF_BANK_COUNT) ? akwf_banks[i].name : "?";
+}
+
+inline uint16_t akwf_bankCount(ArbBank b) {
+    const uint8_t i = (uint8_t)b;
+    return (i < AKWF_BANK_COUNT) ? akwf_banks[i].count : 0;
+}
+
+// Directory entry of the n‑th table in a bank (O(1)); nullptr if out of range.
+inline const AKWFTableRef* akwf_get(ArbBank b, uint16_t idx) {
+    const uint8_t i = (uint8_t)b;
+    if (i >= AKWF_BANK_COUNT || idx >= akwf_banks[i].count) return nullptr;
+    return &akwf_banks[i].tables[idx];
+}
+
+// Decode a table into 'out' (AKWF_MAX_TABLE_LEN samples of room).
+// Returns the sample count, 0 if the table does not exist.
+inline uint16_t akwf_decode(ArbBank b, uint16_t idx, int16_t* out) {
+    const AKWFTableRef* t = akwf_get(b, idx);
+    if (!t) return 0;
+    AKWFCodec::decode(t->data, t->length, out);
+    return t->length;
+}
+""" % (GEN, enum, len(names), longest)
+
+
+def all_source(banks):
+    names = [b for b, _ in banks]
+    includes = "\n".join('#include "AKWF_%s/AKWF_%s.h"' % (n, n) for n in names)
+    entries = ",\n".join('    { "%s", AKWF_%s::tables, AKWF_%s::count }' % (n, n, n) for n in names)
+    return """// %s AKWF bank catalog. Do not edit manually.
+
+#include "AKWF_All.h"
+
+%s
+
+const AKWFBankDir akwf_banks[AKWF_BANK_COUNT] = {
+%s
+};
+""" % (GEN, includes, entries)
+
+
+def generate(banks):
+    """{relative path: file text} for every generated file."""
+    files = {}
+    for bank, tables in banks:
+        files["AKWF_%s/AKWF_%s.h" % (bank, bank)] = bank_header(bank, tables)
+    files["AKWF_All.h"] = all_header(banks)
+    files["AKWF_All.cpp"] = all_source(banks)
+    return files
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    src = ap.add_mutually_exclusive_group(required=True)
+    src.add_argument("--wav", metavar="DIR", help="DIR/<Bank>/*.wav single cycles")
+    src.add_argument("--repack", action="store_true", help="re-encode the bank headers under --out")
+    ap.add_argument("--out", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."),
+                    help="repo root to write (default: this script's repo)")
+    args = ap.parse_args()
+
+    banks = read_wav_banks(args.wav) if args.wav else read_header_banks(args.out)
+    if not banks:
+        sys.exit("no banks found")
+
+    raw = packed = 0
+    for path, text in generate(banks).items():
+        full = os.path.join(args.out, path)
+        os.makedirs(os.path.dirname(full), exist_ok=True)
+        with open(full, "w", encoding="utf-8", newline="\n") as f:
+            f.write(text)
+    for bank, tables in banks:
+        raw += sum(len(s) for _, s in tables) * 2
+        packed += sum(len(encode(s)) for _, s in tables)
+    print("%d banks, %d tables: %d bytes as int16 -> %d bytes (%.1f%%)"
+          % (len(banks), sum(len(t) for _, t in banks), raw, packed, 100.0 * packed / raw))
+
+
+if __name__ == "__main__":
+    main()